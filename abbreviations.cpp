@@ -0,0 +1,153 @@
+#include "abbreviations.h"
+#include "element_data.h"
+#include <cctype>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <unordered_map>
+
+namespace {
+    struct AbbreviationTable {
+        std::unordered_map<uint32_t, const Abbreviation*> byName; // packed name, like element symbols
+        std::vector<std::unique_ptr<Abbreviation>> storage; // replaced entries stay valid for tokens holding them
+        bool seeded = false;
+    };
+
+    // the common organic groups; acetyl (Ac) and tosyl (Ts) are left out, they would hide actinium
+    // and tennessine, an abbreviation file can still add them with ":="
+    const char* const defaultAbbreviations[][2] = {
+        {"Me",  "CH3"},
+        {"Et",  "C2H5"},
+        {"nPr", "C3H7"},
+        {"iPr", "C3H7"},
+        {"Bu",  "C4H9"},
+        {"nBu", "C4H9"},
+        {"iBu", "C4H9"},
+        {"sBu", "C4H9"},
+        {"tBu", "C4H9"},
+        {"Cy",  "C6H11"},
+        {"Ph",  "C6H5"},
+        {"Bn",  "C7H7"},
+        {"Cp",  "C5H5"},
+        {"Bz",  "C7H5O"},
+        {"Boc", "C5H9O2"},
+        {"Cbz", "C8H7O2"},
+        {"Ms",  "CH3SO2"},
+        {"Tf",  "CF3SO2"},
+    };
+
+    bool packName(const char* name, size_t length, uint32_t& key) {
+        if (length == 0 || length > ABBREVIATION_MAX_LENGTH) return false;
+        key = 0;
+        for (size_t i = 0; i < length; i++) {
+            key = (key << 8) | (unsigned char)name[i];
+        }
+        return true;
+    }
+
+    AbbreviationTable& getTable() {
+        static AbbreviationTable table;
+        if (!table.seeded) {
+            // set first: compiling an expansion tokenizes it, which looks names up in this table
+            table.seeded = true;
+            for (const auto& entry : defaultAbbreviations) {
+                RegisterAbbreviation(entry[0], entry[1]);
+            }
+        }
+        return table;
+    }
+
+    // seed during static initialization, not on the first parse
+    const AbbreviationTable& tableAtStartup = getTable();
+}
+
+bool RegisterAbbreviation(const std::string& name, const std::string& expansion, bool replaceElement) {
+    // [a-z]*[A-Z][a-z]*, the shape the tokenizer looks for
+    size_t i = 0;
+    while (i < name.length() && std::islower((unsigned char)name[i])) i++;
+    bool validName = i < name.length() && std::isupper((unsigned char)name[i]);
+    for (i++; validName && i < name.length(); i++) {
+        validName = std::islower((unsigned char)name[i]) != 0;
+    }
+
+    uint32_t key;
+    if (!validName || !packName(name.data(), name.length(), key)) {
+        printf("Warning: Invalid abbreviation name '%s'\n", name.c_str());
+        return false;
+    }
+    if (!replaceElement && FindElementBySymbol(name.data(), name.length())) {
+        printf("Warning: Abbreviation %s would hide the element symbol, use %s := %s to replace it\n",
+               name.c_str(), name.c_str(), expansion.c_str());
+        return false;
+    }
+
+    ElementCounts counts;
+    if (!CountElements(expansion, counts) || counts.present.empty() || counts.charge != 0) {
+        printf("Warning: Could not compile abbreviation %s = %s\n", name.c_str(), expansion.c_str());
+        return false;
+    }
+
+    std::unique_ptr<Abbreviation> abbreviation(new Abbreviation());
+    abbreviation->name = name;
+    abbreviation->expansion = expansion;
+    for (int atomicNumber : counts.present) {
+        abbreviation->counts.push_back(std::make_pair(atomicNumber, (int)counts.byAtomicNumber[atomicNumber]));
+    }
+
+    AbbreviationTable& table = getTable();
+    table.byName[key] = abbreviation.get();
+    table.storage.push_back(std::move(abbreviation));
+    return true;
+}
+
+bool UnregisterAbbreviation(const std::string& name) {
+    uint32_t key;
+    if (!packName(name.data(), name.length(), key)) return false;
+    return getTable().byName.erase(key) > 0;
+}
+
+const Abbreviation* FindAbbreviation(const char* name, size_t length) {
+    uint32_t key;
+    if (!packName(name, length, key)) return nullptr;
+
+    const auto& byName = getTable().byName;
+    auto it = byName.find(key);
+    return (it != byName.end()) ? it->second : nullptr;
+}
+
+size_t LoadAbbreviationFile(const char* path) {
+    FILE* file = fopen(path, "r");
+    if (!file) {
+        printf("Warning: Could not open abbreviation file %s\n", path);
+        return 0;
+    }
+
+    size_t added = 0;
+    char line[256];
+    while (fgets(line, sizeof(line), file)) {
+        std::string text(line);
+        size_t comment = text.find('#');
+        if (comment != std::string::npos) text.erase(comment);
+
+        size_t equals = text.find('=');
+        if (equals == std::string::npos) continue;
+        // "Ac := C2H3O" takes a name over from an element symbol
+        bool replaceElement = equals > 0 && text[equals - 1] == ':';
+        size_t nameEnd = replaceElement ? equals - 1 : equals;
+
+        // trim both sides
+        auto trim = [](const std::string& part) {
+            size_t begin = 0;
+            size_t end = part.length();
+            while (begin < end && std::isspace((unsigned char)part[begin])) begin++;
+            while (end > begin && std::isspace((unsigned char)part[end - 1])) end--;
+            return part.substr(begin, end - begin);
+        };
+        if (RegisterAbbreviation(trim(text.substr(0, nameEnd)), trim(text.substr(equals + 1)), replaceElement)) {
+            added++;
+        }
+    }
+
+    fclose(file);
+    return added;
+}
@@ -0,0 +1,27 @@
+#pragma once
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#define ABBREVIATION_MAX_LENGTH 4
+
+// shorthand for a fixed group of atoms (Me = CH3, Ph = C6H5, tBu = C4H9)
+// the expansion is compiled to element counts once, when it is registered
+struct Abbreviation {
+    std::string name;
+    std::string expansion;
+    std::vector<std::pair<int, int>> counts; // (atomic number, count)
+};
+
+// names are an optional lowercase prefix, one capital and lowercase letters, at most
+// ABBREVIATION_MAX_LENGTH characters; a name equal to an element symbol is refused unless
+// replaceElement is set, and then takes precedence over the element (Ac as acetyl, not actinium);
+// the table is not locked, so register before formulas are parsed on other threads
+bool RegisterAbbreviation(const std::string& name, const std::string& expansion, bool replaceElement = false);
+bool UnregisterAbbreviation(const std::string& name);
+const Abbreviation* FindAbbreviation(const char* name, size_t length);
+
+// registers "Name = Expansion" lines ('#' starts a comment), "Name := Expansion" replaces an
+// element symbol; returns how many were added
+size_t LoadAbbreviationFile(const char* path);
@@ -0,0 +1,38 @@
+#include "app_fonts.h"
+#include "resources/NOTO_SYMBOLS.h"
+#include "resources/ROBOTO_REGULAR.h"
+#include "resources/ROBOTO_MEDIUM.h"
+#include "resources/ROBOTO_BOLD.h"
+
+void RegisterAppFonts(FontLibrary& fonts) {
+    // Noto Symbols: ASCII + arrows/symbols only
+    std::vector<int> notoCodepoints;
+    
+    // ASCII printable characters (32-126)
+    for (int c = 32; c <= 126; c++) {
+        notoCodepoints.push_back(c);
+    }
+    
+    // extra symbols for Noto
+    notoCodepoints.push_back(0x27A4); // ➤ right arrow
+    notoCodepoints.push_back(0x25BC); // ▼ down triangle
+    
+    fonts.Register(FontId::Symbols, font_data_symbol, sizeof(font_data_symbol), notoCodepoints);
+    
+    std::vector<int> robotoCodepoints;
+    
+    // ASCII printable characters (32-126)
+    for (int c = 32; c <= 126; c++) {
+        robotoCodepoints.push_back(c);
+    }
+    
+    // subscript digits (U+2080 to U+2089): ₀₁₂₃₄₅₆₇₈₉
+    for (int i = 0; i < 10; i++) {
+        robotoCodepoints.push_back(0x2080 + i);
+    }
+    
+    // Roboto headers are subset to these codepoints and compressed by ttf_to_header.py --compress
+    fonts.RegisterCompressed(FontId::Regular, font_data_regular, sizeof(font_data_regular), robotoCodepoints);
+    fonts.RegisterCompressed(FontId::Medium, font_data_medium, sizeof(font_data_medium), robotoCodepoints);
+    fonts.RegisterCompressed(FontId::Bold, font_data_bold, sizeof(font_data_bold), robotoCodepoints);
+}
@@ -0,0 +1,10 @@
+#pragma once
+
+#include "font_library.h"
+
+// one small distance-field atlas per font stays sharp at every UI scale
+#define APP_FONT_SIZE 32
+#define APP_FONT_RENDER_MODE FontRenderMode::Sdf
+
+// the fonts and codepoints the calculator uses, shared by main.cpp and the atlas baker
+void RegisterAppFonts(FontLibrary& fonts);
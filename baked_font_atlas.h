@@ -0,0 +1,31 @@
+#pragma once
+
+#include "raylib.h"
+
+// layout of the headers written by resources/bake_font_atlas.cpp
+
+struct BakedGlyph {
+    int value;      // codepoint
+    int offsetX;
+    int offsetY;
+    int advanceX;
+    float x, y, width, height; // rectangle in the atlas
+};
+
+struct BakedFont {
+    int glyphCount;
+    int glyphPadding;
+    const BakedGlyph* glyphs;
+};
+
+struct BakedFontAtlas {
+    int width;
+    int height;
+    int fontSize;
+    bool sdf;
+    Rectangle shapesRect;
+    const unsigned char* data; // gray-alpha texels, raw DEFLATE
+    int dataSize;
+    const BakedFont* fonts;    // indexed by FontId
+    int fontCount;
+};
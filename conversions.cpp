@@ -0,0 +1,87 @@
+#include "conversions.h"
+#include "element_data.h"
+#include "weight_table.h"
+#include <algorithm>
+#include <limits>
+
+// the default build has no -O flag, so only the array loops ask gcc for vectorization
+#if defined(__GNUC__) && !defined(__clang__)
+    #define VECTORIZED_KERNEL __attribute__((optimize("O3")))
+#else
+    #define VECTORIZED_KERNEL
+#endif
+
+// __restrict lets the compiler assume the arrays don't overlap and emit packed divides
+
+VECTORIZED_KERNEL void GramsToMoles(const double* __restrict grams, double* __restrict moles, size_t count, double molarMass) {
+    for (size_t i = 0; i < count; i++) {
+        moles[i] = grams[i] / molarMass;
+    }
+}
+
+VECTORIZED_KERNEL void MolesToGrams(const double* __restrict moles, double* __restrict grams, size_t count, double molarMass) {
+    for (size_t i = 0; i < count; i++) {
+        grams[i] = moles[i] * molarMass;
+    }
+}
+
+VECTORIZED_KERNEL void MolesToParticles(const double* __restrict moles, double* __restrict particles, size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        particles[i] = moles[i] * AVOGADRO_CONSTANT;
+    }
+}
+
+VECTORIZED_KERNEL void GramsToParticles(const double* __restrict grams, double* __restrict particles, size_t count, double molarMass) {
+    for (size_t i = 0; i < count; i++) {
+        particles[i] = grams[i] / molarMass * AVOGADRO_CONSTANT;
+    }
+}
+
+VECTORIZED_KERNEL void GramsToMolarity(const double* __restrict grams, const double* __restrict litres, double* __restrict molarity,
+                                       size_t count, double molarMass) {
+    for (size_t i = 0; i < count; i++) {
+        molarity[i] = grams[i] / (molarMass * litres[i]);
+    }
+}
+
+VECTORIZED_KERNEL void MolarityToGrams(const double* __restrict molarity, const double* __restrict litres, double* __restrict grams,
+                                       size_t count, double molarMass) {
+    for (size_t i = 0; i < count; i++) {
+        grams[i] = molarity[i] * litres[i] * molarMass;
+    }
+}
+
+// the whole formula or nothing: CalculateMolarMass() would skip an unknown symbol and return the
+// mass of the rest, which looks like a valid result in bulk output
+static double strictMolarMass(const std::string& formula) {
+    ElementCounts counts;
+    if (!CountElements(formula, counts) || counts.present.empty()) {
+        return 0.0;
+    }
+    const WeightTable& weights = GetActiveWeights();
+    double molarMass = 0.0;
+    for (int atomicNumber : counts.present) {
+        molarMass += weights.Get(atomicNumber) * counts.byAtomicNumber[atomicNumber];
+    }
+    return molarMass;
+}
+
+double GramsToMoles(const std::string& formula, const double* grams, double* moles, size_t count) {
+    double molarMass = strictMolarMass(formula);
+    if (molarMass > 0.0) {
+        GramsToMoles(grams, moles, count, molarMass);
+    } else {
+        std::fill_n(moles, count, std::numeric_limits<double>::quiet_NaN());
+    }
+    return molarMass;
+}
+
+double MolesToGrams(const std::string& formula, const double* moles, double* grams, size_t count) {
+    double molarMass = strictMolarMass(formula);
+    if (molarMass > 0.0) {
+        MolesToGrams(moles, grams, count, molarMass);
+    } else {
+        std::fill_n(grams, count, std::numeric_limits<double>::quiet_NaN());
+    }
+    return molarMass;
+}
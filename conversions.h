@@ -0,0 +1,21 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+#define AVOGADRO_CONSTANT 6.02214076e23 // per mole, exact since SI 2019
+
+// batch unit conversions for one substance
+// inputs and outputs are separate contiguous arrays (no aliasing) so the loops vectorize;
+// molarMass is in g/mol, e.g. from CalculateMolarMass(), volumes are in litres
+void GramsToMoles(const double* grams, double* moles, size_t count, double molarMass);
+void MolesToGrams(const double* moles, double* grams, size_t count, double molarMass);
+void MolesToParticles(const double* moles, double* particles, size_t count);
+void GramsToParticles(const double* grams, double* particles, size_t count, double molarMass);
+void GramsToMolarity(const double* grams, const double* litres, double* molarity, size_t count, double molarMass); // mol/L
+void MolarityToGrams(const double* molarity, const double* litres, double* grams, size_t count, double molarMass);
+
+// same, parsing the formula once for the whole batch; returns its molar mass, or 0 and fills the
+// outputs with NaN if any symbol is unknown, the brackets don't balance or there are no elements
+double GramsToMoles(const std::string& formula, const double* grams, double* moles, size_t count);
+double MolesToGrams(const std::string& formula, const double* moles, double* grams, size_t count);
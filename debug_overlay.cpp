@@ -0,0 +1,98 @@
+#include "debug_overlay.h"
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+static std::atomic<size_t> allocationCount(0);
+static int textDrawCount = 0;
+
+// global allocation hook, counts every heap allocation made through operator new
+void* operator new(std::size_t size) {
+    allocationCount.fetch_add(1, std::memory_order_relaxed);
+    void* ptr = std::malloc(size ? size : 1);
+    if (!ptr) throw std::bad_alloc();
+    return ptr;
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept {
+    allocationCount.fetch_add(1, std::memory_order_relaxed);
+    return std::malloc(size ? size : 1);
+}
+
+void operator delete(void* ptr) noexcept {
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept {
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, const std::nothrow_t&) noexcept {
+    std::free(ptr);
+}
+
+void DebugCountTextDraw() {
+    textDrawCount++;
+}
+
+size_t DebugGetAllocationCount() {
+    return allocationCount.load(std::memory_order_relaxed);
+}
+
+DebugOverlay::DebugOverlay(int key)
+    : visible(false), toggleKey(key),
+      frameStart(0.0), updateEnd(0.0), drawEnd(0.0),
+      allocStart(0), textDrawStart(0),
+      stats{0.0f, 0.0, 0.0, 0, 0, 0} {}
+
+void DebugOverlay::BeginFrame() {
+    // allocation and text counts span the whole previous frame, including EndDrawing
+    size_t allocNow = DebugGetAllocationCount();
+    stats.allocations = allocNow - allocStart;
+    stats.textDrawCalls = textDrawCount - textDrawStart;
+    stats.frameTime = GetFrameTime();
+
+    allocStart = allocNow;
+    textDrawStart = textDrawCount;
+    frameStart = GetTime();
+
+    if (IsKeyPressed(toggleKey)) {
+        visible = !visible;
+    }
+}
+
+void DebugOverlay::EndUpdate() {
+    updateEnd = GetTime();
+    stats.updateTime = updateEnd - frameStart;
+}
+
+void DebugOverlay::EndDraw(int uiElements) {
+    drawEnd = GetTime();
+    stats.drawTime = drawEnd - updateEnd;
+    stats.uiElements = uiElements;
+}
+
+void DebugOverlay::Draw(Font font, float scale) const {
+    if (!visible) return;
+
+    const float fontSize = 16.0f * scale;
+    const float lineHeight = 20.0f * scale;
+    Rectangle panel = {GetScreenWidth() - 260.0f * scale, 70.0f * scale, 250.0f * scale, 6 * lineHeight + 12.0f * scale};
+
+    DrawRectangleRec(panel, (Color){0, 0, 0, 170});
+
+    // TextFormat only keeps a few buffers, so each line is drawn as soon as it is formatted
+    Vector2 pos = {panel.x + 8.0f * scale, panel.y + 6.0f * scale};
+    Color color = {0, 255, 197, 255};
+    auto line = [&](const char* text) {
+        DrawTextEx(font, text, pos, fontSize, 0.0f, color);
+        pos.y += lineHeight;
+    };
+
+    line(TextFormat("frame   %6.2f ms (%d fps)", stats.frameTime * 1000.0f, GetFPS()));
+    line(TextFormat("update  %6.3f ms", stats.updateTime * 1000.0));
+    line(TextFormat("draw    %6.3f ms", stats.drawTime * 1000.0));
+    line(TextFormat("text draws  %d", stats.textDrawCalls));
+    line(TextFormat("ui elements %d", stats.uiElements));
+    line(TextFormat("allocs/frame %d", (int)stats.allocations));
+}
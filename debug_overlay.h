@@ -0,0 +1,44 @@
+#pragma once
+
+#include <cstddef>
+#include "raylib.h"
+
+struct FrameStats {
+    float frameTime;
+    double updateTime;
+    double drawTime;
+    int textDrawCalls;
+    int uiElements;
+    size_t allocations;
+};
+
+// counters fed from the rest of the app
+void DebugCountTextDraw();
+size_t DebugGetAllocationCount();
+
+class DebugOverlay {
+private:
+    bool visible;
+    int toggleKey;
+
+    double frameStart;
+    double updateEnd;
+    double drawEnd;
+    size_t allocStart;
+    int textDrawStart;
+
+    FrameStats stats;
+
+public:
+    DebugOverlay(int key = KEY_F3);
+
+    void BeginFrame();  // top of the main loop, closes out the previous frame
+    void EndUpdate();   // after input/logic
+    void EndDraw(int uiElements); // after the scene is drawn, before Draw()
+
+    void Draw(Font font, float scale) const;
+
+    bool IsVisible() const { return visible; }
+    void SetVisible(bool show) { visible = show; }
+    const FrameStats& GetStats() const { return stats; }
+};
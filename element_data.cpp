@@ -1,14 +1,14 @@
 #include "element_data.h"
+#include "abbreviations.h"
+#include "weight_table.h"
 #include <algorithm>
 #include <cctype>
+#include <cstdio>
 #include <cstdlib>
+#include <cstdint>
+#include <unordered_map>
 
 
-struct MoleculeComponent {
-    std::string element;
-    int count;
-};
-
 // helper to convert UTF-8 subscript to digit
 int utf8SubscriptToDigit(const std::string& str, size_t& pos) {
     if (pos + 2 < str.length() && 
@@ -24,78 +24,274 @@ int utf8SubscriptToDigit(const std::string& str, size_t& pos) {
     return -1;
 }
 
-double CalculateMolarMass(const std::string& formula) {
-    std::vector<MoleculeComponent> components;
-    size_t i = 0;
-    int leadingMultiplier = 1;
+// count after a symbol or closing bracket: subscript or ASCII digits, 1 if absent
+static int parseCount(const std::string& formula, size_t& i) {
+    int count = 1;
     
-    // parse leading number (e.g., 2H2O)
-    if (i < formula.length() && std::isdigit((unsigned char)formula[i])) {
-        leadingMultiplier = 0;
+    // check for UTF-8 subscript digits
+    int subscriptDigit = utf8SubscriptToDigit(formula, i);
+    if (subscriptDigit >= 0) {
+        count = subscriptDigit;
+        // parse additional subscript digits
+        while ((subscriptDigit = utf8SubscriptToDigit(formula, i)) >= 0) {
+            count = count * 10 + subscriptDigit;
+        }
+    }
+    // check for ASCII digits
+    else if (i < formula.length() && std::isdigit((unsigned char)formula[i])) {
+        count = 0;
         while (i < formula.length() && std::isdigit((unsigned char)formula[i])) {
-            leadingMultiplier = leadingMultiplier * 10 + (formula[i] - '0');
+            count = count * 10 + (formula[i] - '0');
             i++;
         }
     }
+    return count;
+}
+
+// superscript digit 0-9, or SUPERSCRIPT_PLUS / SUPERSCRIPT_MINUS, advancing pos; -1 otherwise
+static const int SUPERSCRIPT_PLUS = 10;
+static const int SUPERSCRIPT_MINUS = 11;
+
+static int utf8Superscript(const std::string& str, size_t& pos) {
+    if (pos + 1 < str.length() && (unsigned char)str[pos] == 0xC2) {
+        unsigned char second = (unsigned char)str[pos + 1];
+        int value = (second == 0xB9) ? 1 : (second == 0xB2) ? 2 : (second == 0xB3) ? 3 : -1;
+        if (value >= 0) pos += 2;
+        return value;
+    }
+    if (pos + 2 < str.length() && (unsigned char)str[pos] == 0xE2 && (unsigned char)str[pos + 1] == 0x81) {
+        unsigned char third = (unsigned char)str[pos + 2];
+        int value = -1;
+        if (third == 0xB0) value = 0;
+        else if (third >= 0xB4 && third <= 0xB9) value = third - 0xB0;
+        else if (third == 0xBA) value = SUPERSCRIPT_PLUS;
+        else if (third == 0xBB) value = SUPERSCRIPT_MINUS;
+        if (value >= 0) pos += 3;
+        return value;
+    }
+    return -1;
+}
+
+// a bare +/- is only a charge when it ends the species (NH4+, Fe+++), so "CH3-CH2-OH" stays neutral
+static bool isTrailingSign(const std::string& str, size_t pos) {
+    size_t end = pos;
+    while (end < str.length() && (str[end] == '+' || str[end] == '-')) end++;
+    return end > pos && end == str.length();
+}
+
+static bool isChargeStart(const std::string& str, size_t pos) {
+    char c = str[pos];
+    if (c == '^') return true;
+    if (c == '+' || c == '-') return isTrailingSign(str, pos);
+    return utf8Superscript(str, pos) >= 0;
+}
+
+// reads digits at pos (superscript, or ASCII when allowed) into value, false if there are none
+static bool parseChargeDigits(const std::string& formula, size_t& i, bool allowAscii, int& value) {
+    bool any = false;
+    for (;;) {
+        size_t next = i;
+        int digit = -1;
+        if (allowAscii && next < formula.length() && std::isdigit((unsigned char)formula[next])) {
+            digit = formula[next] - '0';
+            next++;
+        } else {
+            digit = utf8Superscript(formula, next);
+            if (digit > 9) digit = -1;
+        }
+        if (digit < 0) return any;
+        value = value * 10 + digit;
+        any = true;
+        i = next;
+    }
+}
+
+// charge after '^' or in superscripts: digits then sign (2-, ²⁻), a sign alone means 1 and repeats
+// count (Fe+++); after '^' the sign may also come first (^-2); returns 0 without a sign
+static int parseCharge(const std::string& formula, size_t& i, bool afterCaret) {
+    int magnitude = 0;
+    bool hasDigits = parseChargeDigits(formula, i, afterCaret, magnitude);
+
+    int sign = 0;
+    int signs = 0;
+    for (;;) {
+        size_t next = i;
+        int thisSign = 0;
+        if (next < formula.length() && (formula[next] == '+' || formula[next] == '-')) {
+            thisSign = (formula[next] == '+') ? 1 : -1;
+            next++;
+        } else {
+            int value = utf8Superscript(formula, next);
+            if (value == SUPERSCRIPT_PLUS) thisSign = 1;
+            if (value == SUPERSCRIPT_MINUS) thisSign = -1;
+        }
+        if (thisSign == 0 || (sign != 0 && thisSign != sign)) break;
+        sign = thisSign;
+        signs++;
+        i = next;
+    }
+
+    if (sign == 0) return 0;
+    if (!hasDigits && afterCaret && signs == 1) {
+        hasDigits = parseChargeDigits(formula, i, true, magnitude);
+    }
+    return sign * (hasDigits ? magnitude : signs);
+}
+
+// abbreviation of the form [a-z]+[A-Z][a-z]* starting at i (tBu, iPr), advancing i past its name
+static const Abbreviation* lowercaseAbbreviationAt(const std::string& formula, size_t& i) {
+    size_t end = i;
+    while (end < formula.length() && std::islower((unsigned char)formula[end]) && end - i < ABBREVIATION_MAX_LENGTH) end++;
+    if (end == i || end >= formula.length() || !std::isupper((unsigned char)formula[end])) return nullptr;
+    end++;
+    while (end < formula.length() && std::islower((unsigned char)formula[end])) end++;
+
+    const Abbreviation* abbreviation = FindAbbreviation(formula.data() + i, end - i);
+    if (abbreviation) i = end;
+    return abbreviation;
+}
+
+static bool isGroupOpen(char c) { return c == '(' || c == '['; }
+static bool isGroupClose(char c) { return c == ')' || c == ']'; }
+
+bool NextFormulaToken(const std::string& formula, size_t& pos, FormulaToken& token) {
+    if (pos >= formula.length()) return false;
     
-    // parse element symbols and their counts
-    while (i < formula.length()) {
-        // skip whitespace
-        if (std::isspace((unsigned char)formula[i])) {
+    size_t i = pos;
+    token.begin = pos;
+    token.symbolLength = 0;
+    token.count = 0;
+    token.element = nullptr;
+    token.abbreviation = nullptr;
+    
+    // parse leading number (e.g., 2H2O)
+    if (i == 0 && std::isdigit((unsigned char)formula[i])) {
+        while (i < formula.length() && std::isdigit((unsigned char)formula[i])) {
+            token.count = token.count * 10 + (formula[i] - '0');
             i++;
-            continue;
         }
-    
-        // parse element symbol (uppercase + optional lowercase)
-        if (std::isupper((unsigned char)formula[i])) {
-            std::string element;
-            element += formula[i];
+        token.type = FormulaTokenType::Multiplier;
+    }
+    // parse element symbol or abbreviation (uppercase + optional lowercase, abbreviations first)
+    else if (std::isupper((unsigned char)formula[i])) {
+        i++;
+        while (i < formula.length() && std::islower((unsigned char)formula[i])) {
             i++;
-            
-            while (i < formula.length() && std::islower((unsigned char)formula[i])) {
-                element += formula[i];
-                i++;
-            }            
-    
-            // parse count/subscript
-            int count = 1;
-            
-            // check for UTF-8 subscript digits
-            int subscriptDigit = utf8SubscriptToDigit(formula, i);
-            if (subscriptDigit >= 0) {
-                count = subscriptDigit;
-                // parse additional subscript digits
-                while ((subscriptDigit = utf8SubscriptToDigit(formula, i)) >= 0) {
-                    count = count * 10 + subscriptDigit;
-                }
-            }
-            // check for ASCII digits
-            else if (i < formula.length() && std::isdigit((unsigned char)formula[i])) {
-                count = 0;
-                while (i < formula.length() && std::isdigit((unsigned char)formula[i])) {
-                    count = count * 10 + (formula[i] - '0');
-                    i++;
-                }
+        }
+        token.symbolLength = i - pos;
+        token.abbreviation = FindAbbreviation(formula.data() + pos, token.symbolLength);
+        if (!token.abbreviation) {
+            token.element = FindElementBySymbol(formula.data() + pos, token.symbolLength);
+            // "OtBu": the capital alone when the lowercase run starts an abbreviation
+            size_t next = pos + 1;
+            if (!token.element && token.symbolLength > 1 && lowercaseAbbreviationAt(formula, next)) {
+                i = pos + 1;
+                token.symbolLength = 1;
+                token.abbreviation = FindAbbreviation(formula.data() + pos, 1);
+                token.element = token.abbreviation ? nullptr : FindElementBySymbol(formula.data() + pos, 1);
             }
-            
-            components.push_back({element, count});
-        } else {
-            i++; // skip unknown characters
         }
+        
+        token.count = parseCount(formula, i);
+        token.type = token.abbreviation ? FormulaTokenType::Abbreviation : FormulaTokenType::Element;
+    }
+    // abbreviation with a lowercase prefix, e.g. tBu
+    else if (std::islower((unsigned char)formula[i]) && (token.abbreviation = lowercaseAbbreviationAt(formula, i)) != nullptr) {
+        token.symbolLength = i - pos;
+        token.count = parseCount(formula, i);
+        token.type = FormulaTokenType::Abbreviation;
+    }
+    // brackets, the closing one carries the group count, e.g. (OH)2
+    else if (isGroupOpen(formula[i])) {
+        i++;
+        token.type = FormulaTokenType::GroupOpen;
+    }
+    else if (isGroupClose(formula[i])) {
+        i++;
+        token.count = parseCount(formula, i);
+        token.type = FormulaTokenType::GroupClose;
+    }
+    // ion charge: ^2-, trailing +/-, or superscripts
+    else if (isChargeStart(formula, i)) {
+        bool afterCaret = (formula[i] == '^');
+        if (afterCaret) i++;
+        token.count = parseCharge(formula, i, afterCaret);
+        token.type = (token.count != 0) ? FormulaTokenType::Charge : FormulaTokenType::Skip;
+    }
+    // skip whitespace and unknown characters up to the next symbol, abbreviation, bracket or charge
+    else {
+        while (i < formula.length() && !std::isupper((unsigned char)formula[i]) &&
+               !isGroupOpen(formula[i]) && !isGroupClose(formula[i]) && !isChargeStart(formula, i)) {
+            size_t name = i;
+            if (i > pos && lowercaseAbbreviationAt(formula, name)) break; // " iPr" is isopropyl, not Pr
+            i++;
+        }
+        token.type = FormulaTokenType::Skip;
     }
     
-    // calculate total molar mass
+    token.end = i;
+    pos = i;
+    return true;
+}
+
+double CalculateMolarMass(const std::string& formula) {
+    return CalculateMolarMass(formula, nullptr, false);
+}
+
+double CalculateMolarMass(const std::string& formula, int* charge, bool correctForElectrons) {
     double totalMass = 0.0;
+    int leadingMultiplier = 1;
+    int netCharge = 0;
+    const WeightTable& weights = GetActiveWeights(); // one dataset for the whole formula
+    double outerMasses[FORMULA_MAX_GROUP_DEPTH]; // running total outside each open group
+    int depth = 0;
     
-    for (const auto& comp : components) {
-        const Element* elem = FindElementBySymbol(comp.element);
-        if (elem) {
-            totalMass += elem->molarMass * comp.count * leadingMultiplier;
-        } else {
-            printf("Warning: Element '%s' not found\n", comp.element.c_str());
+    size_t pos = 0;
+    FormulaToken token;
+    while (NextFormulaToken(formula, pos, token)) {
+        if (token.type == FormulaTokenType::Multiplier) {
+            leadingMultiplier = token.count;
+        } else if (token.type == FormulaTokenType::Element) {
+            if (token.element) {
+                totalMass += weights.Get(token.element->atomicNumber) * token.count * leadingMultiplier;
+            } else {
+                printf("Warning: Element '%.*s' not found\n", (int)token.symbolLength, formula.c_str() + token.begin);
+            }
+        } else if (token.type == FormulaTokenType::Abbreviation) {
+            for (const auto& term : token.abbreviation->counts) {
+                totalMass += weights.Get(term.first) * term.second * token.count * leadingMultiplier;
+            }
+        } else if (token.type == FormulaTokenType::GroupOpen) {
+            if (depth == FORMULA_MAX_GROUP_DEPTH) {
+                printf("Warning: Brackets nested deeper than %d levels\n", FORMULA_MAX_GROUP_DEPTH);
+                if (charge) {
+                    *charge = 0;
+                }
+                return 0.0;
+            }
+            outerMasses[depth++] = totalMass;
+            totalMass = 0.0;
+        } else if (token.type == FormulaTokenType::GroupClose) {
+            // an unmatched close is ignored, like any other stray character
+            if (depth > 0) {
+                totalMass = outerMasses[--depth] + totalMass * token.count;
+            }
+        } else if (token.type == FormulaTokenType::Charge) {
+            netCharge += token.count;
         }
     }
+    // groups still open at the end (usually mid-typing) count once
+    while (depth > 0) {
+        totalMass += outerMasses[--depth];
+    }
+    netCharge *= leadingMultiplier;
     
+    if (correctForElectrons) {
+        totalMass -= netCharge * ELECTRON_MOLAR_MASS; // cations lost electrons, anions gained them
+    }
+    if (charge) {
+        *charge = netCharge;
+    }
     return totalMass;
 }
 
@@ -223,9 +419,248 @@ const std::vector<Element>& GetPeriodicTable() {
     return periodicTable;
 }
 
+namespace {
+    // symbols are at most 3 ASCII letters, packed into one integer key
+    bool packSymbol(const char* symbol, size_t length, uint32_t& key) {
+        if (length == 0 || length > 3) return false;
+        key = 0;
+        for (size_t i = 0; i < length; i++) {
+            key = (key << 8) | (unsigned char)symbol[i];
+        }
+        return true;
+    }
+
+    struct ElementIndices {
+        std::vector<const Element*> byAtomicNumber;
+        std::unordered_map<uint32_t, const Element*> bySymbol;
+        std::unordered_map<std::string, const Element*> byName; // lowercase keys
+        std::vector<int> alphabetical; // atomic numbers ordered by symbol, for Hill order
+
+        ElementIndices() {
+            const auto& table = GetPeriodicTable();
+            bySymbol.reserve(table.size());
+            byName.reserve(table.size());
+
+            for (const Element& e : table) {
+                if (e.atomicNumber >= (int)byAtomicNumber.size()) {
+                    byAtomicNumber.resize(e.atomicNumber + 1, nullptr);
+                }
+                byAtomicNumber[e.atomicNumber] = &e;
+
+                uint32_t key;
+                if (packSymbol(e.symbol.data(), e.symbol.length(), key)) {
+                    bySymbol.emplace(key, &e);
+                }
+
+                std::string name = e.name;
+                std::transform(name.begin(), name.end(), name.begin(), [](unsigned char c) { return (char)std::tolower(c); });
+                byName.emplace(name, &e);
+                alphabetical.push_back(e.atomicNumber);
+            }
+
+            std::sort(alphabetical.begin(), alphabetical.end(),
+                      [this](int a, int b) { return byAtomicNumber[a]->symbol < byAtomicNumber[b]->symbol; });
+        }
+    };
+
+    const ElementIndices& getIndices() {
+        static const ElementIndices indices;
+        return indices;
+    }
+
+    // build at static init rather than on the first lookup, getIndices() still covers earlier callers
+    const ElementIndices& indicesAtStartup = getIndices();
+}
+
 const Element* FindElementBySymbol(const std::string& symbol) {
-    const auto& table = GetPeriodicTable();
-    auto it = std::find_if(table.begin(), table.end(),
-        [&](const Element& e) { return e.symbol == symbol; });
-    return (it != table.end()) ? &(*it) : nullptr;
+    return FindElementBySymbol(symbol.data(), symbol.length());
+}
+
+const Element* FindElementBySymbol(const char* symbol, size_t length) {
+    uint32_t key;
+    if (!packSymbol(symbol, length, key)) return nullptr;
+
+    const auto& bySymbol = getIndices().bySymbol;
+    auto it = bySymbol.find(key);
+    return (it != bySymbol.end()) ? it->second : nullptr;
+}
+
+const Element* FindElementByAtomicNumber(int atomicNumber) {
+    const auto& byAtomicNumber = getIndices().byAtomicNumber;
+    if (atomicNumber <= 0 || atomicNumber >= (int)byAtomicNumber.size()) return nullptr;
+    return byAtomicNumber[atomicNumber];
+}
+
+const Element* FindElementByName(const std::string& name) {
+    return FindElementByName(name.data(), name.length());
+}
+
+const Element* FindElementByName(const char* name, size_t length) {
+    // names fit the small-string buffer, so lowering into a local doesn't allocate
+    std::string key(name, length);
+    std::transform(key.begin(), key.end(), key.begin(), [](unsigned char c) { return (char)std::tolower(c); });
+
+    const auto& byName = getIndices().byName;
+    auto it = byName.find(key);
+    return (it != byName.end()) ? it->second : nullptr;
+}
+
+ElementCounts::ElementCounts() : byAtomicNumber(getIndices().byAtomicNumber.size(), 0), charge(0) {}
+
+void ElementCounts::Clear() {
+    for (int atomicNumber : present) {
+        byAtomicNumber[atomicNumber] = 0;
+    }
+    present.clear();
+}
+
+bool CountElements(const std::string& formula, ElementCounts& counts) {
+    counts.Clear();
+    counts.charge = 0;
+    counts.terms.clear();
+    counts.groupStarts.clear();
+
+    long long multiplier = 1;
+    size_t pos = 0;
+    FormulaToken token;
+    while (NextFormulaToken(formula, pos, token)) {
+        switch (token.type) {
+            case FormulaTokenType::Multiplier:
+                multiplier = token.count;
+                break;
+            case FormulaTokenType::Element:
+                if (!token.element) return false;
+                counts.terms.push_back(std::make_pair(token.element->atomicNumber, (long long)token.count));
+                break;
+            case FormulaTokenType::Abbreviation:
+                for (const auto& term : token.abbreviation->counts) {
+                    counts.terms.push_back(std::make_pair(term.first, (long long)term.second * token.count));
+                }
+                break;
+            case FormulaTokenType::GroupOpen:
+                if (counts.groupStarts.size() == FORMULA_MAX_GROUP_DEPTH) return false;
+                counts.groupStarts.push_back(counts.terms.size());
+                break;
+            case FormulaTokenType::GroupClose:
+                if (counts.groupStarts.empty()) return false;
+                // expand the group in place, nested groups were already multiplied out
+                for (size_t i = counts.groupStarts.back(); i < counts.terms.size(); i++) {
+                    counts.terms[i].second *= token.count;
+                }
+                counts.groupStarts.pop_back();
+                break;
+            case FormulaTokenType::Charge:
+                counts.charge += token.count;
+                break;
+            case FormulaTokenType::Skip:
+                break;
+        }
+    }
+    if (!counts.groupStarts.empty()) return false;
+    counts.charge *= (int)multiplier;
+
+    // counting sort: duplicates merge in their atomic-number bucket
+    for (const auto& term : counts.terms) {
+        long long& bucket = counts.byAtomicNumber[term.first];
+        if (bucket == 0 && term.second != 0) {
+            counts.present.push_back(term.first);
+        }
+        bucket += term.second * multiplier;
+    }
+    return true;
+}
+
+static void appendCount(std::string& out, long long count, SubscriptStyle style) {
+    if (count == 1) return;
+
+    char digits[24];
+    int length = snprintf(digits, sizeof(digits), "%lld", count);
+    for (int i = 0; i < length; i++) {
+        if (style == SubscriptStyle::Utf8) {
+            // U+2080..U+2089
+            out += '\xE2';
+            out += '\x82';
+            out += (char)(0x80 + (digits[i] - '0'));
+        } else {
+            out += digits[i];
+        }
+    }
+}
+
+static void appendCharge(std::string& out, int charge, SubscriptStyle style) {
+    int magnitude = charge < 0 ? -charge : charge;
+    char digits[16];
+    int length = (magnitude > 1) ? snprintf(digits, sizeof(digits), "%d", magnitude) : 0;
+
+    if (style == SubscriptStyle::Utf8) {
+        // superscripts: ¹ ² ³ are Latin-1, the rest U+2070..U+2079, signs U+207A / U+207B
+        static const char* const superscripts[10] = {
+            "\xE2\x81\xB0", "\xC2\xB9", "\xC2\xB2", "\xC2\xB3", "\xE2\x81\xB4",
+            "\xE2\x81\xB5", "\xE2\x81\xB6", "\xE2\x81\xB7", "\xE2\x81\xB8", "\xE2\x81\xB9"
+        };
+        for (int i = 0; i < length; i++) {
+            out += superscripts[digits[i] - '0'];
+        }
+        out += (charge > 0) ? "\xE2\x81\xBA" : "\xE2\x81\xBB";
+    } else {
+        if (length > 0) {
+            out += '^';
+            out.append(digits, length);
+        }
+        out += (charge > 0) ? '+' : '-';
+    }
+}
+
+static void appendElement(std::string& out, const ElementCounts& counts, int atomicNumber, SubscriptStyle style) {
+    long long count = counts.byAtomicNumber[atomicNumber];
+    if (count <= 0) return;
+    out += getIndices().byAtomicNumber[atomicNumber]->symbol;
+    appendCount(out, count, style);
+}
+
+void FormatHillFormula(const ElementCounts& counts, std::string& out, SubscriptStyle style) {
+    out.clear();
+
+    // with carbon: C, H, then the rest alphabetically; without carbon everything is alphabetical
+    const int carbon = 6;
+    const int hydrogen = 1;
+    bool hasCarbon = counts.byAtomicNumber[carbon] > 0;
+    if (hasCarbon) {
+        appendElement(out, counts, carbon, style);
+        appendElement(out, counts, hydrogen, style);
+    }
+
+    for (int atomicNumber : getIndices().alphabetical) {
+        if (hasCarbon && (atomicNumber == carbon || atomicNumber == hydrogen)) continue;
+        appendElement(out, counts, atomicNumber, style);
+    }
+
+    if (counts.charge != 0) {
+        appendCharge(out, counts.charge, style);
+    }
+}
+
+bool CanonicalizeFormula(const std::string& formula, std::string& canonical, SubscriptStyle style) {
+    ElementCounts counts;
+    if (!CountElements(formula, counts)) {
+        canonical.clear();
+        return false;
+    }
+    FormatHillFormula(counts, canonical, style);
+    return true;
+}
+
+size_t CanonicalizeFormulas(const std::string* formulas, size_t count, std::string* canonical, SubscriptStyle style) {
+    // one set of buckets for the whole batch, only the touched ones are reset between formulas
+    ElementCounts counts;
+    size_t converted = 0;
+    for (size_t i = 0; i < count; i++) {
+        if (CountElements(formulas[i], counts)) {
+            FormatHillFormula(counts, canonical[i], style);
+            converted++;
+        } else {
+            canonical[i].clear();
+        }
+    }
+    return converted;
 }
@@ -2,6 +2,8 @@
 #include <string>
 #include <vector>
 
+struct Abbreviation;
+
 struct Element {
     int atomicNumber;
     std::string symbol;
@@ -9,8 +11,72 @@ struct Element {
     double molarMass;
 };
 
+enum class FormulaTokenType {
+    Multiplier, // leading coefficient, e.g. the 2 in 2H2O
+    Element,    // symbol plus its ASCII or subscript count
+    Abbreviation, // registered group such as Ph or tBu, plus its count
+    GroupOpen,  // ( or [
+    GroupClose, // ) or ] plus the group count
+    Charge,     // ion charge in count, signed: NH4+, SO4^2-, Fe^3+, SO₄²⁻
+    Skip        // anything the parser ignores (whitespace, lowercase runs, stray digits)
+};
+
+struct FormulaToken {
+    FormulaTokenType type;
+    size_t begin;         // byte range in the formula
+    size_t end;
+    size_t symbolLength;  // element symbol or abbreviation is formula[begin, begin + symbolLength)
+    int count;            // multiplier value, element or group count, or signed charge
+    const Element* element; // nullptr for unknown symbols
+    const Abbreviation* abbreviation; // set for Abbreviation tokens
+};
+
 const std::vector<Element>& GetPeriodicTable();
 
+#define ELECTRON_MOLAR_MASS 0.000548579909 // g/mol
+#define FORMULA_MAX_GROUP_DEPTH 16 // deeper bracket nesting is rejected as malformed
+
+// 0 for brackets nested deeper than FORMULA_MAX_GROUP_DEPTH
 double CalculateMolarMass(const std::string& formula);
+// also reports the net ion charge (nullptr to ignore it); with correctForElectrons the mass
+// of the electrons an ion lost or gained is taken off or added
+double CalculateMolarMass(const std::string& formula, int* charge, bool correctForElectrons);
 
+// reads the token starting at pos and advances pos past it, false at end of input
+bool NextFormulaToken(const std::string& formula, size_t& pos, FormulaToken& token);
+
+// constant-time lookups, the indices are built once during static initialization
 const Element* FindElementBySymbol(const std::string& symbol);
+const Element* FindElementBySymbol(const char* symbol, size_t length);
+const Element* FindElementByAtomicNumber(int atomicNumber);
+const Element* FindElementByName(const std::string& name); // case-insensitive, e.g. "sodium"
+const Element* FindElementByName(const char* name, size_t length);
+
+// element totals of one formula with brackets expanded and the leading multiplier applied
+struct ElementCounts {
+    std::vector<long long> byAtomicNumber; // dense buckets, so duplicates merge without sorting
+    std::vector<int> present;              // atomic numbers with a bucket in use, unordered
+    int charge;                            // net ion charge, multiplier applied
+
+    // parse scratch, kept here so a reused ElementCounts doesn't allocate
+    std::vector<std::pair<int, long long>> terms;
+    std::vector<size_t> groupStarts;
+
+    ElementCounts();
+    void Clear();
+};
+
+enum class SubscriptStyle {
+    Ascii, // H2O
+    Utf8   // H₂O
+};
+
+// false on unknown symbols, unbalanced brackets or nesting deeper than FORMULA_MAX_GROUP_DEPTH
+bool CountElements(const std::string& formula, ElementCounts& counts);
+
+// Hill order: C, H, then alphabetical (all alphabetical without carbon), duplicates merged,
+// so "OH2", "H2O", "H₂O" and "H(OH)" share one key; a charge is written last as "+", "^2-" (or "⁺", "²⁻")
+void FormatHillFormula(const ElementCounts& counts, std::string& out, SubscriptStyle style = SubscriptStyle::Ascii);
+bool CanonicalizeFormula(const std::string& formula, std::string& canonical, SubscriptStyle style = SubscriptStyle::Ascii);
+// bulk form reusing one set of buckets, failed entries come out empty; returns how many succeeded
+size_t CanonicalizeFormulas(const std::string* formulas, size_t count, std::string* canonical, SubscriptStyle style = SubscriptStyle::Ascii);
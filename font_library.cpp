@@ -0,0 +1,322 @@
+#include "font_library.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#define FONT_GLYPH_PADDING 4 // matches raylib's FONT_TTF_DEFAULT_CHARS_PADDING
+#define SHAPES_BLOCK_SIZE 16  // white block for shapes, sampled away from its edges to avoid bleeding
+
+// distance is stored in alpha with the outline at 0.5; the screen-space derivative keeps the
+// edge about one pixel wide at any scale, and is clamped so flat regions (alpha 1) stay opaque
+static const char* SDF_FRAGMENT_SHADER =
+    "#version 330\n"
+    "in vec2 fragTexCoord;\n"
+    "in vec4 fragColor;\n"
+    "uniform sampler2D texture0;\n"
+    "uniform vec4 colDiffuse;\n"
+    "out vec4 finalColor;\n"
+    "void main()\n"
+    "{\n"
+    "    float dist = texture(texture0, fragTexCoord).a - 0.5;\n"
+    "    float width = max(length(vec2(dFdx(dist), dFdy(dist))), 0.0001);\n"
+    "    float alpha = smoothstep(-width, width, dist);\n"
+    "    finalColor = vec4(fragColor.rgb*colDiffuse.rgb, fragColor.a*colDiffuse.a*alpha);\n"
+    "}\n";
+
+FontLibrary::FontLibrary(int size, FontRenderMode renderMode)
+    : fontSize(size), mode(renderMode), sdfShader{}, sharedAtlas{}, shapesRect{0, 0, 0, 0} {
+    for (Slot& slot : slots) {
+        slot.data = nullptr;
+        slot.dataSize = 0;
+        slot.compressed = false;
+        slot.font = Font{};
+        slot.registered = false;
+        slot.loaded = false;
+        slot.shared = false;
+    }
+}
+
+FontLibrary::~FontLibrary() {
+    // never leave a worker writing into a destroyed slot
+    for (Slot& slot : slots) {
+        if (slot.pending.valid()) {
+            RasterizedFont raster = slot.pending.get();
+            UnloadFontData(raster.glyphs, (int)slot.codepoints.size());
+            RL_FREE(raster.recs);
+            UnloadImage(raster.atlas);
+        }
+    }
+}
+
+// CPU only (stb_truetype + atlas packing), no GL calls so it can run off the main thread
+FontLibrary::RasterizedFont FontLibrary::rasterize(const unsigned char* data, int dataSize, bool compressed,
+                                                   const int* codepoints, int count, int fontSize, FontRenderMode mode) {
+    RasterizedFont raster;
+    raster.glyphs = nullptr;
+    raster.recs = nullptr;
+    raster.atlas = Image{};
+
+    unsigned char* inflated = nullptr;
+    if (compressed) {
+        int inflatedSize = 0;
+        inflated = DecompressData(data, dataSize, &inflatedSize);
+        if (!inflated) return raster;
+
+        data = inflated;
+        dataSize = inflatedSize;
+    }
+
+    // SDF glyph images already carry their own falloff padding
+    bool sdf = (mode == FontRenderMode::Sdf);
+    raster.glyphs = LoadFontData(data, dataSize, fontSize, const_cast<int*>(codepoints), count, sdf ? FONT_SDF : FONT_DEFAULT);
+    if (raster.glyphs) {
+        raster.atlas = GenImageFontAtlas(raster.glyphs, &raster.recs, count, fontSize, sdf ? 0 : FONT_GLYPH_PADDING, sdf ? 1 : 0);
+    }
+
+    // glyph images are copies, the font file is no longer needed
+    if (inflated) {
+        MemFree(inflated);
+    }
+    return raster;
+}
+
+int FontLibrary::glyphPadding() const {
+    return (mode == FontRenderMode::Sdf) ? 0 : FONT_GLYPH_PADDING;
+}
+
+void FontLibrary::finishTexture(Texture2D& texture) {
+    SetTextureFilter(texture, TEXTURE_FILTER_BILINEAR);
+
+    // distance fields interpolate cleanly at any scale, only coverage atlases need mipmaps
+    if (mode == FontRenderMode::Bitmap) {
+        GenTextureMipmaps(&texture);
+    } else if (sdfShader.id == 0) {
+        sdfShader = LoadShaderFromMemory(nullptr, SDF_FRAGMENT_SHADER);
+    }
+}
+
+FontLibrary::RasterizedFont FontLibrary::finish(Slot& slot) {
+    if (slot.pending.valid()) {
+        return slot.pending.get();
+    }
+    return rasterize(slot.data, slot.dataSize, slot.compressed, slot.codepoints.data(), (int)slot.codepoints.size(), fontSize, mode);
+}
+
+void FontLibrary::upload(Slot& slot, RasterizedFont raster) {
+    Font& font = slot.font;
+    font.baseSize = fontSize;
+    font.glyphCount = (int)slot.codepoints.size();
+    font.glyphPadding = glyphPadding();
+    font.glyphs = raster.glyphs;
+    font.recs = raster.recs;
+    font.texture = LoadTextureFromImage(raster.atlas);
+    UnloadImage(raster.atlas);
+
+    finishTexture(font.texture);
+
+    slot.loaded = true;
+}
+
+void FontLibrary::Register(FontId id, const unsigned char* data, int dataSize, const std::vector<int>& codepoints) {
+    Slot& slot = slots[(int)id];
+    slot.data = data;
+    slot.dataSize = dataSize;
+    slot.compressed = false;
+    slot.codepoints = codepoints;
+    slot.registered = true;
+}
+
+void FontLibrary::RegisterCompressed(FontId id, const unsigned char* data, int dataSize, const std::vector<int>& codepoints) {
+    Register(id, data, dataSize, codepoints);
+    slots[(int)id].compressed = true;
+}
+
+void FontLibrary::Prefetch(FontId id) {
+    Slot& slot = slots[(int)id];
+    if (!slot.registered || slot.loaded || slot.pending.valid()) return;
+
+    slot.pending = std::async(std::launch::async, &FontLibrary::rasterize,
+                              slot.data, slot.dataSize, slot.compressed, slot.codepoints.data(), (int)slot.codepoints.size(), fontSize, mode);
+}
+
+const Font& FontLibrary::Get(FontId id) {
+    Slot& slot = slots[(int)id];
+    if (slot.loaded || !slot.registered) return slot.font;
+
+    upload(slot, finish(slot));
+    return slot.font;
+}
+
+// CPU half of BuildSharedAtlas: fills in every packed font except its texture
+Image FontLibrary::packSharedAtlas() {
+    RasterizedFont rasters[(int)FontId::Count];
+    bool included[(int)FontId::Count] = {};
+    int width = SHAPES_BLOCK_SIZE;
+    int height = SHAPES_BLOCK_SIZE;
+
+    for (int i = 0; i < (int)FontId::Count; i++) {
+        Slot& slot = slots[i];
+        if (!slot.registered || slot.loaded) continue;
+
+        rasters[i] = finish(slot);
+        if (!rasters[i].glyphs) continue;
+
+        ImageFormat(&rasters[i].atlas, PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA);
+        width = std::max(width, rasters[i].atlas.width);
+        height += rasters[i].atlas.height;
+        included[i] = true;
+    }
+
+    // stack the per-font atlases vertically under the white block, 2 bytes per texel (gray, alpha)
+    unsigned char* pixels = (unsigned char*)RL_CALLOC((size_t)width * height, 2);
+    for (int y = 0; y < SHAPES_BLOCK_SIZE; y++) {
+        std::memset(pixels + (size_t)y * width * 2, 0xFF, SHAPES_BLOCK_SIZE * 2);
+    }
+
+    int offsetY = SHAPES_BLOCK_SIZE;
+    for (int i = 0; i < (int)FontId::Count; i++) {
+        if (!included[i]) continue;
+
+        const Image& atlas = rasters[i].atlas;
+        for (int y = 0; y < atlas.height; y++) {
+            std::memcpy(pixels + ((size_t)(offsetY + y) * width) * 2,
+                        (const unsigned char*)atlas.data + (size_t)y * atlas.width * 2,
+                        (size_t)atlas.width * 2);
+        }
+
+        Slot& slot = slots[i];
+        for (size_t g = 0; g < slot.codepoints.size(); g++) {
+            rasters[i].recs[g].y += (float)offsetY;
+        }
+        offsetY += atlas.height;
+        UnloadImage(rasters[i].atlas);
+
+        slot.font.baseSize = fontSize;
+        slot.font.glyphCount = (int)slot.codepoints.size();
+        slot.font.glyphPadding = glyphPadding();
+        slot.font.glyphs = rasters[i].glyphs;
+        slot.font.recs = rasters[i].recs;
+        slot.font.texture = Texture2D{};
+        slot.loaded = true;
+        slot.shared = true;
+    }
+
+    float inset = SHAPES_BLOCK_SIZE / 4.0f;
+    shapesRect = {inset, inset, SHAPES_BLOCK_SIZE - 2 * inset, SHAPES_BLOCK_SIZE - 2 * inset};
+
+    Image combined = {pixels, width, height, 1, PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA};
+    return combined;
+}
+
+void FontLibrary::uploadSharedAtlas(Image combined) {
+    sharedAtlas = LoadTextureFromImage(combined);
+    finishTexture(sharedAtlas);
+
+    for (Slot& slot : slots) {
+        if (slot.shared) {
+            slot.font.texture = sharedAtlas;
+        }
+    }
+}
+
+void FontLibrary::BuildSharedAtlas() {
+    if (sharedAtlas.id != 0) return;
+
+    Image combined = packSharedAtlas();
+    uploadSharedAtlas(combined);
+    UnloadImage(combined);
+}
+
+Image FontLibrary::BakeSharedAtlas() {
+    return packSharedAtlas();
+}
+
+bool FontLibrary::LoadBakedAtlas(const BakedFontAtlas& baked) {
+    if (sharedAtlas.id != 0) return true;
+
+    // inflate before touching any slot, so a bad atlas leaves the library free to rasterize
+    int pixelsSize = 0;
+    unsigned char* pixels = DecompressData(baked.data, baked.dataSize, &pixelsSize);
+    if (!pixels || pixelsSize != baked.width * baked.height * 2) {
+        if (pixels) MemFree(pixels);
+        printf("Warning: Could not inflate baked font atlas\n");
+        return false;
+    }
+
+    fontSize = baked.fontSize;
+    mode = baked.sdf ? FontRenderMode::Sdf : FontRenderMode::Bitmap;
+    shapesRect = baked.shapesRect;
+
+    for (int f = 0; f < baked.fontCount && f < (int)FontId::Count; f++) {
+        const BakedFont& source = baked.fonts[f];
+        Slot& slot = slots[f];
+        if (slot.loaded || source.glyphCount == 0) continue;
+
+        // raylib owns and frees these through UnloadFontData / RL_FREE
+        GlyphInfo* glyphs = (GlyphInfo*)RL_CALLOC(source.glyphCount, sizeof(GlyphInfo));
+        Rectangle* recs = (Rectangle*)RL_MALLOC(source.glyphCount * sizeof(Rectangle));
+        for (int g = 0; g < source.glyphCount; g++) {
+            const BakedGlyph& glyph = source.glyphs[g];
+            glyphs[g].value = glyph.value;
+            glyphs[g].offsetX = glyph.offsetX;
+            glyphs[g].offsetY = glyph.offsetY;
+            glyphs[g].advanceX = glyph.advanceX;
+            recs[g] = {glyph.x, glyph.y, glyph.width, glyph.height};
+        }
+
+        slot.font.baseSize = baked.fontSize;
+        slot.font.glyphCount = source.glyphCount;
+        slot.font.glyphPadding = source.glyphPadding;
+        slot.font.glyphs = glyphs;
+        slot.font.recs = recs;
+        slot.registered = true;
+        slot.loaded = true;
+        slot.shared = true;
+    }
+
+    Image combined = {pixels, baked.width, baked.height, 1, PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA};
+    uploadSharedAtlas(combined);
+    MemFree(pixels);
+    return true;
+}
+
+void FontLibrary::BeginFontShader() {
+    if (mode == FontRenderMode::Sdf && sdfShader.id != 0) {
+        BeginShaderMode(sdfShader);
+    }
+}
+
+void FontLibrary::EndFontShader() {
+    if (mode == FontRenderMode::Sdf && sdfShader.id != 0) {
+        EndShaderMode();
+    }
+}
+
+void FontLibrary::UnloadAll() {
+    for (Slot& slot : slots) {
+        if (!slot.loaded) continue;
+
+        if (slot.shared) {
+            // the texture is owned by the library, only the glyph tables belong to the font
+            UnloadFontData(slot.font.glyphs, slot.font.glyphCount);
+            RL_FREE(slot.font.recs);
+        } else {
+            UnloadFont(slot.font);
+        }
+        slot.font = Font{};
+        slot.loaded = false;
+        slot.shared = false;
+    }
+
+    if (sharedAtlas.id != 0) {
+        SetShapesTexture(Texture2D{}, Rectangle{0, 0, 0, 0}); // back to raylib's default white texel
+        UnloadTexture(sharedAtlas);
+        sharedAtlas = Texture2D{};
+    }
+
+    if (sdfShader.id != 0) {
+        UnloadShader(sdfShader);
+        sdfShader = Shader{};
+    }
+}
@@ -0,0 +1,91 @@
+#pragma once
+
+#include <future>
+#include <vector>
+#include "raylib.h"
+#include "baked_font_atlas.h"
+
+enum class FontRenderMode {
+    Bitmap, // coverage atlas with mipmaps, blurs when scaled far from the base size
+    Sdf     // signed distance field atlas, drawn through the SDF shader at any size
+};
+
+enum class FontId {
+    Symbols,
+    Regular,
+    Medium,
+    Bold,
+    Count
+};
+
+// fonts are rasterized on demand; Prefetch() moves the CPU side onto a worker thread
+// so it can overlap window creation, Get() uploads the atlas on first use
+class FontLibrary {
+private:
+    struct RasterizedFont {
+        GlyphInfo* glyphs;
+        Rectangle* recs;
+        Image atlas;
+    };
+
+    struct Slot {
+        const unsigned char* data;
+        int dataSize;
+        bool compressed; // raw DEFLATE, inflated on the rasterizing thread
+        std::vector<int> codepoints;
+        std::future<RasterizedFont> pending;
+        Font font;
+        bool registered;
+        bool loaded;
+        bool shared; // glyphs live in sharedAtlas instead of their own texture
+    };
+
+    Slot slots[(int)FontId::Count];
+    int fontSize;
+    FontRenderMode mode;
+    Shader sdfShader;
+
+    Texture2D sharedAtlas;
+    Rectangle shapesRect; // opaque white texels inside sharedAtlas
+
+    static RasterizedFont rasterize(const unsigned char* data, int dataSize, bool compressed,
+                                    const int* codepoints, int count, int fontSize, FontRenderMode mode);
+    int glyphPadding() const;
+    void finishTexture(Texture2D& texture);
+    RasterizedFont finish(Slot& slot);
+    void upload(Slot& slot, RasterizedFont raster);
+    Image packSharedAtlas();
+    void uploadSharedAtlas(Image combined);
+
+public:
+    explicit FontLibrary(int size = 40, FontRenderMode renderMode = FontRenderMode::Bitmap);
+    ~FontLibrary();
+
+    void Register(FontId id, const unsigned char* data, int dataSize, const std::vector<int>& codepoints);
+    // for headers generated with ttf_to_header.py --compress
+    void RegisterCompressed(FontId id, const unsigned char* data, int dataSize, const std::vector<int>& codepoints);
+    void Prefetch(FontId id);  // safe to call before InitWindow
+    const Font& Get(FontId id); // needs a GL context
+    bool IsLoaded(FontId id) const { return slots[(int)id].loaded; }
+
+    // packs every registered, not yet loaded font into one texture so switching fonts
+    // (or drawing shapes, via SetShapesTexture with GetShapesRect) never breaks the batch
+    void BuildSharedAtlas();
+    Texture2D GetSharedAtlas() const { return sharedAtlas; }
+    int GetFontSize() const { return fontSize; }
+
+    // build-time path: BakeSharedAtlas() packs on the CPU only (no window needed) and returns
+    // the atlas image, LoadBakedAtlas() skips rasterization and just uploads the result
+    // (false if the data doesn't inflate to width * height gray-alpha pixels, nothing is changed)
+    Image BakeSharedAtlas();
+    bool LoadBakedAtlas(const BakedFontAtlas& baked);
+    Rectangle GetShapesRect() const { return shapesRect; }
+
+    // in SDF mode everything drawn between these goes through the SDF shader;
+    // shapes stay opaque since the shared atlas' white block reads as "deep inside"
+    void BeginFontShader();
+    void EndFontShader();
+    FontRenderMode GetRenderMode() const { return mode; }
+
+    void UnloadAll();
+};
@@ -0,0 +1,117 @@
+#include "formula_solver.h"
+#include "element_data.h"
+#include "weight_table.h"
+#include <algorithm>
+#include <cmath>
+
+namespace {
+    void appendFormula(std::string& out, const std::vector<std::pair<int, int>>& counts, int multiplier) {
+        out.clear();
+        for (const auto& count : counts) {
+            const Element* element = FindElementByAtomicNumber(count.first);
+            out += element->symbol;
+            if (count.second * multiplier != 1) {
+                out += std::to_string(count.second * multiplier);
+            }
+        }
+    }
+
+    // scratch reused across a batch so solving a row doesn't allocate beyond its result
+    struct SolverScratch {
+        std::vector<int> atomicNumbers;
+        std::vector<double> ratios; // moles relative to the scarcest element
+        std::vector<int> order;     // largest ratio first, those amplify error the most
+    };
+
+    FormulaSolution solve(const CompositionInput& input, const FormulaSolverOptions& options, const WeightTable& weights,
+                          SolverScratch& scratch) {
+        FormulaSolution solution;
+        solution.found = false;
+        solution.empiricalMass = 0.0;
+        solution.molecularMultiplier = 0;
+        solution.molecularMass = 0.0;
+        solution.maxRatioError = 0.0;
+
+        scratch.atomicNumbers.clear();
+        scratch.ratios.clear();
+
+        double percentSum = 0.0;
+        for (const ElementPercent& entry : input.percents) {
+            if (!FindElementByAtomicNumber(entry.atomicNumber) || entry.percent <= 0.0) continue;
+            scratch.atomicNumbers.push_back(entry.atomicNumber);
+            scratch.ratios.push_back(entry.percent / weights.Get(entry.atomicNumber));
+            percentSum += entry.percent;
+        }
+        if (input.remainderElement > 0 && percentSum < 100.0 && FindElementByAtomicNumber(input.remainderElement)) {
+            scratch.atomicNumbers.push_back(input.remainderElement);
+            scratch.ratios.push_back((100.0 - percentSum) / weights.Get(input.remainderElement));
+        }
+        if (scratch.ratios.empty()) {
+            return solution;
+        }
+
+        double smallest = *std::min_element(scratch.ratios.begin(), scratch.ratios.end());
+        for (double& ratio : scratch.ratios) {
+            ratio /= smallest;
+        }
+
+        size_t n = scratch.ratios.size();
+        scratch.order.resize(n);
+        for (size_t i = 0; i < n; i++) scratch.order[i] = (int)i;
+        std::sort(scratch.order.begin(), scratch.order.end(),
+                  [&](int a, int b) { return scratch.ratios[a] > scratch.ratios[b]; });
+
+        // smallest multiplier that brings every ratio within tolerance of an integer;
+        // a multiplier is abandoned at the first element that misses
+        int bestMultiplier = 0;
+        double bestError = 1.0;
+        for (int k = 1; k <= options.maxMultiplier; k++) {
+            double worst = 0.0;
+            for (size_t j = 0; j < n; j++) {
+                double scaled = scratch.ratios[scratch.order[j]] * k;
+                worst = std::max(worst, std::fabs(scaled - std::round(scaled)));
+                if (worst > options.ratioTolerance && worst >= bestError) break;
+            }
+            if (worst < bestError) {
+                bestError = worst;
+                bestMultiplier = k;
+            }
+            if (worst <= options.ratioTolerance) break;
+        }
+
+        solution.found = bestError <= options.ratioTolerance;
+        solution.maxRatioError = bestError;
+        for (size_t i = 0; i < n; i++) {
+            int count = (int)std::lround(scratch.ratios[i] * bestMultiplier);
+            solution.counts.push_back(std::make_pair(scratch.atomicNumbers[i], std::max(count, 1)));
+            solution.empiricalMass += weights.Get(scratch.atomicNumbers[i]) * solution.counts.back().second;
+        }
+        appendFormula(solution.empiricalFormula, solution.counts, 1);
+
+        if (input.targetMolarMass > 0.0 && solution.empiricalMass > 0.0) {
+            int multiplier = (int)std::lround(input.targetMolarMass / solution.empiricalMass);
+            double molecularMass = solution.empiricalMass * multiplier;
+            if (multiplier >= 1 && std::fabs(molecularMass - input.targetMolarMass) <= options.massTolerance * input.targetMolarMass) {
+                solution.molecularMultiplier = multiplier;
+                solution.molecularMass = molecularMass;
+                appendFormula(solution.molecularFormula, solution.counts, multiplier);
+            }
+        }
+        return solution;
+    }
+}
+
+FormulaSolution SolveEmpiricalFormula(const CompositionInput& input, const FormulaSolverOptions& options) {
+    SolverScratch scratch;
+    return solve(input, options, GetActiveWeights(), scratch);
+}
+
+void SolveEmpiricalFormulas(const CompositionInput* inputs, size_t count, FormulaSolution* solutions,
+                            const FormulaSolverOptions& options) {
+    // one weight table snapshot for the whole batch
+    const WeightTable& weights = GetActiveWeights();
+    SolverScratch scratch;
+    for (size_t i = 0; i < count; i++) {
+        solutions[i] = solve(inputs[i], options, weights, scratch);
+    }
+}
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+struct ElementPercent {
+    int atomicNumber;
+    double percent; // mass percent, e.g. 40.0 for carbon in glucose
+};
+
+// one elemental analysis to solve, e.g. a row of a CHNS analyzer export
+struct CompositionInput {
+    std::vector<ElementPercent> percents;
+    double targetMolarMass;  // 0 to skip the molecular formula
+    int remainderElement;    // atomic number that receives 100% minus the rest (usually 8), 0 for none
+};
+
+struct FormulaSolution {
+    bool found;
+    std::vector<std::pair<int, int>> counts; // (atomic number, count) of the empirical formula, input order
+    std::string empiricalFormula;            // ASCII digits, e.g. "CH2O"
+    double empiricalMass;
+    int molecularMultiplier;                 // 0 when no target mass was given or it didn't fit
+    std::string molecularFormula;            // e.g. "C6H12O6"
+    double molecularMass;
+    double maxRatioError;                    // worst distance of a scaled mole ratio from its integer
+};
+
+struct FormulaSolverOptions {
+    int maxMultiplier = 12;        // largest factor tried to turn mole ratios into integers
+    double ratioTolerance = 0.12;  // allowed distance from an integer after scaling
+    double massTolerance = 0.02;   // relative fit of the target molar mass to n x empirical mass
+};
+
+// inverse of CalculateMolarMass: smallest-integer formula matching the mass percentages,
+// and the molecular formula when a target molar mass is given; weights come from the active table
+FormulaSolution SolveEmpiricalFormula(const CompositionInput& input, const FormulaSolverOptions& options = FormulaSolverOptions());
+void SolveEmpiricalFormulas(const CompositionInput* inputs, size_t count, FormulaSolution* solutions,
+                            const FormulaSolverOptions& options = FormulaSolverOptions());
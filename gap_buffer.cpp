@@ -0,0 +1,68 @@
+#include "gap_buffer.h"
+#include <cstring>
+
+GapBuffer::GapBuffer(size_t initialCapacity)
+    : buffer(initialCapacity), gapStart(0), gapEnd(initialCapacity) {}
+
+void GapBuffer::moveGap(size_t pos) {
+    if (pos == gapStart) return;
+
+    size_t gapSize = gapEnd - gapStart;
+    if (pos < gapStart) {
+        // shift [pos, gapStart) to the end of the gap
+        size_t count = gapStart - pos;
+        std::memmove(buffer.data() + gapEnd - count, buffer.data() + pos, count);
+    } else {
+        // shift [gapEnd, pos + gapSize) to the start of the gap
+        size_t count = pos - gapStart;
+        std::memmove(buffer.data() + gapStart, buffer.data() + gapEnd, count);
+    }
+    gapStart = pos;
+    gapEnd = pos + gapSize;
+}
+
+void GapBuffer::ensureGap(size_t count) {
+    size_t gapSize = gapEnd - gapStart;
+    if (gapSize >= count) return;
+
+    // grow geometrically so a run of inserts stays amortized O(1)
+    size_t oldSize = buffer.size();
+    size_t newSize = oldSize ? oldSize * 2 : 64;
+    while (newSize - Size() < count) {
+        newSize *= 2;
+    }
+
+    size_t tailSize = oldSize - gapEnd;
+    buffer.resize(newSize);
+    if (tailSize > 0) {
+        std::memmove(buffer.data() + newSize - tailSize, buffer.data() + gapEnd, tailSize);
+    }
+    gapEnd = newSize - tailSize;
+}
+
+void GapBuffer::Insert(size_t pos, unsigned char value) {
+    Insert(pos, &value, 1);
+}
+
+void GapBuffer::Insert(size_t pos, const unsigned char* data, size_t count) {
+    if (count == 0 || pos > Size()) return;
+
+    ensureGap(count);
+    moveGap(pos);
+    std::memcpy(buffer.data() + gapStart, data, count);
+    gapStart += count;
+}
+
+void GapBuffer::Erase(size_t pos, size_t count) {
+    size_t size = Size();
+    if (pos >= size) return;
+    if (count > size - pos) count = size - pos;
+
+    moveGap(pos);
+    gapEnd += count;
+}
+
+void GapBuffer::Clear() {
+    gapStart = 0;
+    gapEnd = buffer.size();
+}
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+// byte gap buffer, edits at the gap are O(1) and moving the gap costs the distance moved
+class GapBuffer {
+private:
+    std::vector<unsigned char> buffer;
+    size_t gapStart;
+    size_t gapEnd;
+
+    void moveGap(size_t pos);
+    void ensureGap(size_t count);
+
+public:
+    explicit GapBuffer(size_t initialCapacity = 64);
+
+    size_t Size() const { return buffer.size() - (gapEnd - gapStart); }
+    bool Empty() const { return Size() == 0; }
+
+    unsigned char At(size_t index) const {
+        return index < gapStart ? buffer[index] : buffer[index + (gapEnd - gapStart)];
+    }
+    void Set(size_t index, unsigned char value) {
+        if (index < gapStart) buffer[index] = value;
+        else buffer[index + (gapEnd - gapStart)] = value;
+    }
+
+    void Insert(size_t pos, unsigned char value);
+    void Insert(size_t pos, const unsigned char* data, size_t count);
+    void Erase(size_t pos, size_t count = 1);
+    void Clear();
+};
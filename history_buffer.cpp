@@ -0,0 +1,116 @@
+#include "history_buffer.h"
+#include "element_data.h"
+#include <cstdio>
+
+const char* CalculationHistory::GetMassText(int decimals) {
+    if (decimals != massTextDecimals) {
+        snprintf(massText, sizeof(massText), "%.*f g/mol", decimals, molarMass);
+        massTextDecimals = decimals;
+    }
+    return massText;
+}
+
+HistoryBuffer::HistoryBuffer(size_t capacity)
+    : entries(capacity > 0 ? capacity : 1), start(0), count(0), revision(0),
+      newestSequence(-1), evictedSinceRebuild(0) {
+    for (CalculationHistory& entry : entries) {
+        entry.molarMass = 0.0;
+        entry.massText[0] = '\0';
+        entry.massTextDecimals = -1;
+    }
+}
+
+void HistoryBuffer::Push(const std::string& formula, double molarMass, int decimals) {
+    size_t slot;
+    if (count < entries.size()) {
+        slot = (start + count) % entries.size();
+        count++;
+    } else {
+        // full: the oldest slot becomes the newest, its string buffer is reused
+        slot = start;
+        start = (start + 1) % entries.size();
+        evictedSinceRebuild++;
+    }
+    newestSequence++;
+    revision++;
+
+    CalculationHistory& entry = entries[slot];
+    entry.formula.assign(formula);
+    entry.molarMass = molarMass;
+    entry.massTextDecimals = -1;
+    entry.GetMassText(decimals);
+
+    // evicted entries stay in the index until a capacity's worth has piled up
+    if (evictedSinceRebuild >= entries.size()) {
+        rebuildIndex();
+    } else {
+        index.AddNewest(newestSequence, entry.formula);
+    }
+}
+
+bool HistoryBuffer::PushOlder(const std::string& formula, double molarMass, int decimals) {
+    if (count == entries.size()) {
+        return false;
+    }
+    long long sequence = newestSequence - (long long)count;
+    start = (start + entries.size() - 1) % entries.size();
+    count++;
+    revision++;
+
+    CalculationHistory& entry = entries[start];
+    entry.formula.assign(formula);
+    entry.molarMass = molarMass;
+    entry.massTextDecimals = -1;
+    entry.GetMassText(decimals);
+    index.AddOldest(sequence, entry.formula);
+    return true;
+}
+
+void HistoryBuffer::Clear() {
+    start = 0;
+    count = 0;
+    revision++;
+    index.Clear();
+    evictedSinceRebuild = 0;
+}
+
+void HistoryBuffer::rebuildIndex() {
+    index.Clear();
+    for (size_t i = count; i-- > 0;) {
+        index.AddNewest(newestSequence - (long long)i, (*this)[i].formula);
+    }
+    evictedSinceRebuild = 0;
+}
+
+void HistoryBuffer::Search(const std::string& query, std::vector<size_t>& results) const {
+    results.clear();
+    searchScratch.clear();
+    if (query.empty()) {
+        return;
+    }
+
+    // element filter when every token is a known symbol without a count
+    queryElements.clear();
+    size_t pos = 0;
+    FormulaToken token;
+    bool elementsOnly = true;
+    while (elementsOnly && NextFormulaToken(query, pos, token)) {
+        elementsOnly = token.type == FormulaTokenType::Element && token.element &&
+                       token.end - token.begin == token.symbolLength;
+        if (elementsOnly) {
+            queryElements.push_back(token.element->atomicNumber);
+        }
+    }
+
+    long long oldestLive = newestSequence - (long long)count + 1;
+    if (elementsOnly && !queryElements.empty()) {
+        index.FindByElements(queryElements.data(), queryElements.size(), oldestLive, searchScratch);
+    } else {
+        index.FindByPrefix(query, oldestLive, searchScratch);
+    }
+
+    results.reserve(searchScratch.size());
+    for (long long sequence : searchScratch) {
+        results.push_back((size_t)(newestSequence - sequence));
+    }
+}
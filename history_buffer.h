@@ -0,0 +1,58 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include "history_index.h"
+
+struct CalculationHistory {
+    std::string formula;
+    double molarMass;
+    
+    // display string, e.g. "18.02 g/mol", only reformatted when the precision changes
+    char massText[32];
+    int massTextDecimals; // -1 until formatted
+    
+    const char* GetMassText(int decimals);
+};
+
+// fixed-capacity ring of calculations, index 0 is the newest entry;
+// once full, pushing a new entry overwrites the oldest in place
+class HistoryBuffer {
+private:
+    std::vector<CalculationHistory> entries;
+    size_t start; // physical slot of the oldest entry
+    size_t count;
+    unsigned int revision;
+
+    // every entry gets a sequence number, index i holds newestSequence - i
+    long long newestSequence;
+    HistoryIndex index;
+    size_t evictedSinceRebuild;
+    mutable std::vector<long long> searchScratch;
+    mutable std::vector<int> queryElements;
+
+    void rebuildIndex();
+
+    size_t slotOf(size_t index) const { return (start + count - 1 - index) % entries.size(); }
+
+public:
+    explicit HistoryBuffer(size_t capacity);
+
+    void Push(const std::string& formula, double molarMass, int decimals);
+    // appends behind the oldest entry (used when loading saved history), fails once full
+    bool PushOlder(const std::string& formula, double molarMass, int decimals);
+    void Clear();
+
+    // newest-first indices of matching entries; a query made only of element symbols
+    // (e.g. "NaCl") matches entries containing all of them, anything else is a formula prefix
+    void Search(const std::string& query, std::vector<size_t>& results) const;
+
+    size_t Size() const { return count; }
+    size_t Capacity() const { return entries.size(); }
+    bool Empty() const { return count == 0; }
+    bool Full() const { return count == entries.size(); }
+    unsigned int GetRevision() const { return revision; } // bumps whenever entries are added or cleared
+
+    const CalculationHistory& operator[](size_t index) const { return entries[slotOf(index)]; }
+    CalculationHistory& operator[](size_t index) { return entries[slotOf(index)]; }
+};
@@ -0,0 +1,140 @@
+#include "history_index.h"
+#include "element_data.h"
+#include "abbreviations.h"
+#include <algorithm>
+
+bool PostingList::Contains(long long sequence) const {
+    // older is descending, newer ascending
+    if (!newer.empty() && sequence >= newer.front()) {
+        return std::binary_search(newer.begin(), newer.end(), sequence);
+    }
+    return std::binary_search(older.begin(), older.end(), sequence, [](long long a, long long b) { return a > b; });
+}
+
+HistoryIndex::HistoryIndex() {
+    Clear();
+}
+
+void HistoryIndex::Clear() {
+    nodes.clear();
+    nodes.push_back(TrieNode{-1, -1, 0, PostingList()});
+
+    int maxAtomicNumber = 0;
+    for (const Element& element : GetPeriodicTable()) {
+        maxAtomicNumber = std::max(maxAtomicNumber, element.atomicNumber);
+    }
+    elementEntries.assign(maxAtomicNumber + 1, PostingList());
+    seenElement.assign(maxAtomicNumber + 1, false);
+}
+
+int HistoryIndex::childOf(int node, unsigned char byte) const {
+    for (int child = nodes[node].firstChild; child >= 0; child = nodes[child].nextSibling) {
+        if (nodes[child].byte == byte) {
+            return child;
+        }
+    }
+    return -1;
+}
+
+int HistoryIndex::addChild(int node, unsigned char byte) {
+    int child = (int)nodes.size();
+    nodes.push_back(TrieNode{-1, nodes[node].firstChild, byte, PostingList()});
+    nodes[node].firstChild = child; // may reallocate, so index rather than reference
+    return child;
+}
+
+void HistoryIndex::addElement(int atomicNumber, long long sequence, bool older) {
+    if (seenElement[atomicNumber]) {
+        return;
+    }
+    seenElement[atomicNumber] = true;
+    seenList.push_back(atomicNumber);
+
+    if (older) {
+        elementEntries[atomicNumber].PushFront(sequence);
+    } else {
+        elementEntries[atomicNumber].PushBack(sequence);
+    }
+}
+
+void HistoryIndex::add(long long sequence, const std::string& formula, bool older) {
+    // one trie node per byte, UTF-8 subscripts match byte for byte
+    int node = 0;
+    for (unsigned char byte : formula) {
+        int child = childOf(node, byte);
+        node = child >= 0 ? child : addChild(node, byte);
+        if (older) {
+            nodes[node].entries.PushFront(sequence);
+        } else {
+            nodes[node].entries.PushBack(sequence);
+        }
+    }
+
+    size_t pos = 0;
+    FormulaToken token;
+    while (NextFormulaToken(formula, pos, token)) {
+        if (token.type == FormulaTokenType::Element && token.element) {
+            addElement(token.element->atomicNumber, sequence, older);
+        } else if (token.type == FormulaTokenType::Abbreviation) {
+            for (const auto& term : token.abbreviation->counts) {
+                addElement(term.first, sequence, older);
+            }
+        }
+    }
+    for (int atomicNumber : seenList) {
+        seenElement[atomicNumber] = false;
+    }
+    seenList.clear();
+}
+
+void HistoryIndex::FindByPrefix(const std::string& prefix, long long oldestLive, std::vector<long long>& results) const {
+    int node = 0;
+    for (unsigned char byte : prefix) {
+        node = childOf(node, byte);
+        if (node < 0) {
+            return;
+        }
+    }
+
+    const PostingList& entries = nodes[node].entries;
+    for (size_t i = entries.Size(); i-- > 0;) {
+        if (entries[i] < oldestLive) {
+            break;
+        }
+        results.push_back(entries[i]);
+    }
+}
+
+void HistoryIndex::FindByElements(const int* atomicNumbers, size_t count, long long oldestLive, std::vector<long long>& results) const {
+    if (count == 0) {
+        return;
+    }
+
+    // walk the shortest list and probe the others
+    const PostingList* shortest = nullptr;
+    for (size_t i = 0; i < count; i++) {
+        if (atomicNumbers[i] <= 0 || atomicNumbers[i] >= (int)elementEntries.size()) {
+            return;
+        }
+        const PostingList& list = elementEntries[atomicNumbers[i]];
+        if (!shortest || list.Size() < shortest->Size()) {
+            shortest = &list;
+        }
+    }
+
+    for (size_t i = shortest->Size(); i-- > 0;) {
+        long long sequence = (*shortest)[i];
+        if (sequence < oldestLive) {
+            break;
+        }
+
+        bool inAll = true;
+        for (size_t j = 0; j < count && inAll; j++) {
+            const PostingList& list = elementEntries[atomicNumbers[j]];
+            inAll = &list == shortest || list.Contains(sequence);
+        }
+        if (inAll) {
+            results.push_back(sequence);
+        }
+    }
+}
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+// ascending list of entry sequence numbers that grows at both ends:
+// newer entries are appended, entries loaded from older sessions are prepended
+class PostingList {
+private:
+    std::vector<long long> older; // prepended entries, stored newest first
+    std::vector<long long> newer; // appended entries, stored oldest first
+
+public:
+    void PushFront(long long sequence) { older.push_back(sequence); }
+    void PushBack(long long sequence) { newer.push_back(sequence); }
+    void Clear() { older.clear(); newer.clear(); }
+
+    size_t Size() const { return older.size() + newer.size(); }
+    long long operator[](size_t i) const { // ascending order
+        return i < older.size() ? older[older.size() - 1 - i] : newer[i - older.size()];
+    }
+    bool Contains(long long sequence) const;
+};
+
+// search index over history formulas, keyed by entry sequence number
+// a byte trie answers prefix queries and per-element posting lists answer "contains" queries;
+// adding a formula costs O(formula length), evicted sequences are skipped at query time
+class HistoryIndex {
+private:
+    struct TrieNode {
+        int firstChild;
+        int nextSibling;
+        unsigned char byte;
+        PostingList entries; // every formula passing through this node, i.e. having this prefix
+    };
+
+    std::vector<TrieNode> nodes; // nodes[0] is the root
+    std::vector<PostingList> elementEntries; // by atomic number
+    std::vector<bool> seenElement; // scratch for de-duplicating symbols within one formula
+    std::vector<int> seenList;
+
+    int childOf(int node, unsigned char byte) const;
+    int addChild(int node, unsigned char byte);
+    void addElement(int atomicNumber, long long sequence, bool older);
+    void add(long long sequence, const std::string& formula, bool older);
+
+public:
+    HistoryIndex();
+
+    void AddNewest(long long sequence, const std::string& formula) { add(sequence, formula, false); }
+    void AddOldest(long long sequence, const std::string& formula) { add(sequence, formula, true); }
+    void Clear();
+
+    // both append matching sequences >= oldestLive to results, newest first
+    void FindByPrefix(const std::string& prefix, long long oldestLive, std::vector<long long>& results) const;
+    void FindByElements(const int* atomicNumbers, size_t count, long long oldestLive, std::vector<long long>& results) const;
+};
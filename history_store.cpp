@@ -0,0 +1,258 @@
+#include "history_store.h"
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+// kept out of any TU that includes raylib.h, the Windows headers clash with its names
+#ifdef _WIN32
+    #define WIN32_LEAN_AND_MEAN
+    #define NOMINMAX
+    #include <windows.h>
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+HistoryStore::HistoryStore(const char* path)
+    : path(path), mapped(nullptr), mappedSize(0), readPos(0), unterminated(false),
+#ifdef _WIN32
+      fileHandle(nullptr), mappingHandle(nullptr),
+#endif
+      stopping(false) {}
+
+HistoryStore::~HistoryStore() {
+    Close();
+}
+
+bool HistoryStore::Open() {
+    bool hasLog = mapLog();
+
+    // a crash can leave a torn last line, cut it off so it is neither read nor joined to the next entry
+    if (hasLog && mapped[mappedSize - 1] != '\n') {
+        size_t lastLineEnd = mappedSize;
+        while (lastLineEnd > 0 && mapped[lastLineEnd - 1] != '\n') {
+            lastLineEnd--;
+        }
+        unmapLog();
+        truncateLog(lastLineEnd);
+        hasLog = mapLog();
+    }
+    readPos = mappedSize;
+
+    // if it could not be cut, skip it and let the writer end it before this session appends
+    unterminated = (mappedSize > 0 && mapped[mappedSize - 1] != '\n');
+    while (readPos > 0 && mapped[readPos - 1] != '\n') {
+        readPos--;
+    }
+
+    if (!writer.joinable()) {
+        stopping = false;
+        writer = std::thread(&HistoryStore::writerLoop, this);
+    }
+    return hasLog;
+}
+
+void HistoryStore::Close() {
+    if (writer.joinable()) {
+        {
+            std::lock_guard<std::mutex> lock(queueMutex);
+            stopping = true;
+        }
+        queueReady.notify_one();
+        writer.join();
+    }
+    unmapLog();
+}
+
+void HistoryStore::Append(const std::string& formula, double molarMass) {
+    char massText[32];
+    snprintf(massText, sizeof(massText), "%.17g\t", molarMass); // round-trips exactly
+
+    std::string line;
+    line.reserve(strlen(massText) + formula.size() + 1);
+    line.append(massText);
+    line.append(formula);
+    line.push_back('\n');
+
+    {
+        std::lock_guard<std::mutex> lock(queueMutex);
+        pending.push_back(std::move(line));
+    }
+    queueReady.notify_one();
+}
+
+void HistoryStore::writerLoop() {
+    // the mapping only covers the size at Open(), appending past it is fine on both platforms
+    FILE* file = fopen(path.c_str(), "ab");
+    if (!file) {
+        printf("Warning: Could not open history log %s, this session will not be saved\n", path.c_str());
+    } else if (unterminated) {
+        fputc('\n', file);
+    }
+
+    std::deque<std::string> batch;
+    for (;;) {
+        {
+            std::unique_lock<std::mutex> lock(queueMutex);
+            queueReady.wait(lock, [this]() { return stopping || !pending.empty(); });
+            batch.swap(pending);
+            if (batch.empty() && stopping) {
+                break;
+            }
+        }
+
+        if (file) {
+            for (const std::string& line : batch) {
+                fwrite(line.data(), 1, line.size(), file);
+            }
+            fflush(file); // one flush per wakeup, a crash loses at most the entries in flight
+        }
+        batch.clear();
+    }
+
+    if (file) {
+        fclose(file);
+    }
+}
+
+bool HistoryStore::ReadOlder(std::string& formula, double& molarMass) {
+    while (readPos > 0) {
+        size_t lineEnd = readPos;
+        if (mapped[lineEnd - 1] == '\n') {
+            lineEnd--;
+        }
+        size_t lineStart = lineEnd;
+        while (lineStart > 0 && mapped[lineStart - 1] != '\n') {
+            lineStart--;
+        }
+        readPos = lineStart;
+
+        const char* line = mapped + lineStart;
+        size_t length = lineEnd - lineStart;
+        const char* tab = (const char*)memchr(line, '\t', length);
+        if (!tab || tab == line || (size_t)(tab - line) >= 32 || tab + 1 == line + length) {
+            continue;
+        }
+
+        // the mapping is not null terminated, so parse the mass from a copy
+        char massText[32];
+        size_t massLength = tab - line;
+        memcpy(massText, line, massLength);
+        massText[massLength] = '\0';
+
+        char* parseEnd = nullptr;
+        double mass = strtod(massText, &parseEnd);
+        if (parseEnd != massText + massLength) {
+            continue;
+        }
+
+        molarMass = mass;
+        formula.assign(tab + 1, line + length);
+        return true;
+    }
+    return false;
+}
+
+#ifdef _WIN32
+bool HistoryStore::mapLog() {
+    HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE, nullptr,
+                              OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        return false;
+    }
+
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(file, &size) || size.QuadPart == 0) {
+        CloseHandle(file);
+        return false;
+    }
+
+    HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    const void* view = mapping ? MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0) : nullptr;
+    if (!view) {
+        printf("Warning: Could not map history log %s\n", path.c_str());
+        if (mapping) {
+            CloseHandle(mapping);
+        }
+        CloseHandle(file);
+        return false;
+    }
+
+    fileHandle = file;
+    mappingHandle = mapping;
+    mapped = (const char*)view;
+    mappedSize = (size_t)size.QuadPart;
+    return true;
+}
+
+bool HistoryStore::truncateLog(size_t size) {
+    HANDLE file = CreateFileA(path.c_str(), GENERIC_WRITE, FILE_SHARE_READ | FILE_SHARE_WRITE, nullptr,
+                              OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    LARGE_INTEGER end;
+    end.QuadPart = (LONGLONG)size;
+    bool truncated = file != INVALID_HANDLE_VALUE && SetFilePointerEx(file, end, nullptr, FILE_BEGIN) && SetEndOfFile(file);
+    if (file != INVALID_HANDLE_VALUE) {
+        CloseHandle(file);
+    }
+    if (!truncated) {
+        printf("Warning: Could not repair history log %s\n", path.c_str());
+    }
+    return truncated;
+}
+
+void HistoryStore::unmapLog() {
+    if (mapped) {
+        UnmapViewOfFile(mapped);
+        CloseHandle((HANDLE)mappingHandle);
+        CloseHandle((HANDLE)fileHandle);
+    }
+    mapped = nullptr;
+    mappedSize = 0;
+    readPos = 0;
+    fileHandle = nullptr;
+    mappingHandle = nullptr;
+}
+#else
+bool HistoryStore::mapLog() {
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return false;
+    }
+
+    struct stat info;
+    if (fstat(fd, &info) != 0 || info.st_size == 0) {
+        close(fd);
+        return false;
+    }
+
+    void* view = mmap(nullptr, (size_t)info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd); // the mapping keeps the file alive
+    if (view == MAP_FAILED) {
+        printf("Warning: Could not map history log %s\n", path.c_str());
+        return false;
+    }
+
+    mapped = (const char*)view;
+    mappedSize = (size_t)info.st_size;
+    return true;
+}
+
+bool HistoryStore::truncateLog(size_t size) {
+    if (truncate(path.c_str(), (off_t)size) != 0) {
+        printf("Warning: Could not repair history log %s\n", path.c_str());
+        return false;
+    }
+    return true;
+}
+
+void HistoryStore::unmapLog() {
+    if (mapped) {
+        munmap((void*)mapped, mappedSize);
+    }
+    mapped = nullptr;
+    mappedSize = 0;
+    readPos = 0;
+}
+#endif
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+
+// append-only on-disk log of calculations, one "<mass>\t<formula>\n" line per entry
+// appends are queued and written by a worker thread so the render loop never touches the disk;
+// the log from previous sessions is memory-mapped and read backwards in batches on demand
+class HistoryStore {
+private:
+    std::string path;
+
+    // previous sessions, mapped read-only at Open()
+    const char* mapped;
+    size_t mappedSize;
+    size_t readPos; // entries before this byte offset have not been read yet
+    bool unterminated; // the log still ends in a partial line after Open() tried to cut it off
+#ifdef _WIN32
+    void* fileHandle;
+    void* mappingHandle;
+#endif
+
+    // async writer
+    std::thread writer;
+    std::mutex queueMutex;
+    std::condition_variable queueReady;
+    std::deque<std::string> pending;
+    bool stopping;
+
+    void writerLoop();
+    bool mapLog();
+    void unmapLog();
+    bool truncateLog(size_t size);
+
+public:
+    explicit HistoryStore(const char* path);
+    ~HistoryStore();
+
+    HistoryStore(const HistoryStore&) = delete;
+    HistoryStore& operator=(const HistoryStore&) = delete;
+
+    // maps the existing log (if any) and starts the writer, returns false if nothing could be mapped;
+    // a torn last line left by a crash is cut off first
+    bool Open();
+    // flushes queued entries and releases the mapping
+    void Close();
+
+    // queues an entry, never blocks on I/O
+    void Append(const std::string& formula, double molarMass);
+
+    // reads the next older entry from the mapped log, newest first; torn or malformed lines are skipped
+    bool ReadOlder(std::string& formula, double& molarMass);
+    bool HasOlder() const { return readPos > 0; }
+};
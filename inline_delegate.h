@@ -0,0 +1,81 @@
+#pragma once
+
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+// fixed-size, non-allocating replacement for std::function<void()>
+// the callable is stored inline; anything larger than Capacity fails to compile
+template <std::size_t Capacity = 4 * sizeof(void*)>
+class InlineDelegate {
+private:
+    typedef void (*InvokeFn)(void*);
+    typedef void (*CopyFn)(void* dst, const void* src);
+    typedef void (*DestroyFn)(void*);
+
+    alignas(std::max_align_t) mutable unsigned char storage[Capacity];
+    InvokeFn invokeFn;
+    CopyFn copyFn;
+    DestroyFn destroyFn;
+
+    template <typename F>
+    static void invokeImpl(void* obj) { (*static_cast<F*>(obj))(); }
+
+    template <typename F>
+    static void copyImpl(void* dst, const void* src) { new (dst) F(*static_cast<const F*>(src)); }
+
+    template <typename F>
+    static void destroyImpl(void* obj) { static_cast<F*>(obj)->~F(); }
+
+    void copyFrom(const InlineDelegate& other) {
+        invokeFn = other.invokeFn;
+        copyFn = other.copyFn;
+        destroyFn = other.destroyFn;
+        if (copyFn) {
+            copyFn(storage, other.storage);
+        }
+    }
+
+public:
+    InlineDelegate() : invokeFn(nullptr), copyFn(nullptr), destroyFn(nullptr) {}
+    InlineDelegate(std::nullptr_t) : InlineDelegate() {}
+
+    template <typename F,
+              typename Fn = typename std::decay<F>::type,
+              typename = typename std::enable_if<!std::is_same<Fn, InlineDelegate>::value>::type>
+    InlineDelegate(F&& f) {
+        static_assert(sizeof(Fn) <= Capacity, "callback captures too much state for InlineDelegate");
+        static_assert(alignof(Fn) <= alignof(std::max_align_t), "callback alignment too strict for InlineDelegate");
+
+        new (storage) Fn(std::forward<F>(f));
+        invokeFn = &invokeImpl<Fn>;
+        copyFn = &copyImpl<Fn>;
+        destroyFn = &destroyImpl<Fn>;
+    }
+
+    InlineDelegate(const InlineDelegate& other) { copyFrom(other); }
+
+    InlineDelegate& operator=(const InlineDelegate& other) {
+        if (this != &other) {
+            Reset();
+            copyFrom(other);
+        }
+        return *this;
+    }
+
+    ~InlineDelegate() { Reset(); }
+
+    void Reset() {
+        if (destroyFn) {
+            destroyFn(storage);
+        }
+        invokeFn = nullptr;
+        copyFn = nullptr;
+        destroyFn = nullptr;
+    }
+
+    explicit operator bool() const { return invokeFn != nullptr; }
+
+    void operator()() const { invokeFn(storage); }
+};
@@ -1,5 +1,6 @@
 #include <cstdlib>
 #include <cstdio>
+#include <algorithm>
 #include "raylib.h"
 #include "rlgl.h"
 #include "text_align.h"
@@ -7,10 +8,17 @@
 #include "ui_context.h"
 #include "text_box.h"
 #include "element_data.h"
-#include "resources/NOTO_SYMBOLS.h"
-#include "resources/ROBOTO_REGULAR.h"
-#include "resources/ROBOTO_MEDIUM.h"
-#include "resources/ROBOTO_BOLD.h"
+#include "debug_overlay.h"
+#include "mass_preview.h"
+#include "app_fonts.h"
+#include "history_buffer.h"
+#include "history_store.h"
+#include "weight_table.h"
+#include "abbreviations.h"
+
+#ifdef USE_BAKED_FONT_ATLAS
+#include "resources/FONT_ATLAS.h" // generated by resources/bake_font_atlas.cpp
+#endif
 
 #define NATIVE_WIDTH 1600
 #define NATIVE_HEIGHT 800
@@ -22,20 +30,32 @@
 #define BUTTON_NORMAL (Color){125, 145, 142, 255}
 #define BUTTON_HOVER (Color){105, 125, 122, 255}
 
+#define HISTORY_CAPACITY 10000
+#define HISTORY_TOP 100        // native y of the first row
+#define HISTORY_ROW_HEIGHT 50
+#define HISTORY_LOG_PATH "history.log" // kept next to the executable, as are the data files below
+#define HISTORY_LOAD_BATCH 64  // saved entries read per frame while the list is near its end
+#define WEIGHTS_DEFAULT_PATH "weights.bin" // optional dataset picked up at startup, others can be dropped on the window
+#define ABBREVIATIONS_PATH "abbreviations.txt" // optional "Name = Expansion" lines added to the built-in groups
+
 Font NOTO_SYMBOLS;
 
 Font ROBOTO_REGULAR;
 Font ROBOTO_MEDIUM;
 Font ROBOTO_BOLD;
 
-void loadFonts();
-
-struct CalculationHistory {
-    std::string formula;
-    double molarMass;
-};
+void drawStaticLayer(const UIContext& ui);
 
 int main(void) {
+    FontLibrary fonts(APP_FONT_SIZE, APP_FONT_RENDER_MODE);
+#ifndef USE_BAKED_FONT_ATLAS
+    // every font is on the first frame, so start rasterizing them all while the window is created
+    RegisterAppFonts(fonts);
+    for (int i = 0; i < (int)FontId::Count; i++) {
+        fonts.Prefetch((FontId)i);
+    }
+#endif
+
     SetConfigFlags(FLAG_WINDOW_RESIZABLE | FLAG_MSAA_4X_HINT | FLAG_WINDOW_UNDECORATED);
     InitWindow(NATIVE_WIDTH, NATIVE_HEIGHT, "Molar Mass Calculator");
     SetTargetFPS(60);
@@ -47,10 +67,34 @@ int main(void) {
     ui.SetResizeHandle(NATIVE_WIDTH - 20, NATIVE_HEIGHT - 20, 8.0f);
     ui.SetTopBar(60);
 
-    std::vector<CalculationHistory> history;
-    const int MAX_HISTORY = 10;
+    HistoryBuffer history(HISTORY_CAPACITY);
+    float historyScroll = 0.0f; // native pixels scrolled from the newest entry
+
+    // data files sit next to the executable, not wherever it was launched from
+    const std::string appDirectory = GetApplicationDirectory();
+
+    // previous sessions are mapped, not parsed, entries are pulled in as the list is scrolled
+    const std::string historyLogPath = appDirectory + HISTORY_LOG_PATH;
+    HistoryStore historyStore(historyLogPath.c_str());
+    historyStore.Open();
+    std::string loadedFormula;
+
+    // one texture for all glyphs and shapes, so font switches don't split the draw batch
+#ifdef USE_BAKED_FONT_ATLAS
+    // size and render mode come from the baked atlas, a corrupt one falls back to rasterizing
+    if (!fonts.LoadBakedAtlas(font_atlas)) {
+        RegisterAppFonts(fonts);
+        fonts.BuildSharedAtlas();
+    }
+#else
+    fonts.BuildSharedAtlas();
+#endif
+    SetShapesTexture(fonts.GetSharedAtlas(), fonts.GetShapesRect());
 
-    loadFonts();
+    NOTO_SYMBOLS = fonts.Get(FontId::Symbols);
+    ROBOTO_REGULAR = fonts.Get(FontId::Regular);
+    ROBOTO_MEDIUM = fonts.Get(FontId::Medium);
+    ROBOTO_BOLD = fonts.Get(FontId::Bold);
 
     TextBox formulaInput(
         Rectangle{ui.X(600), ui.Y(350), ui.S(800), ui.S(50)}, 
@@ -64,14 +108,65 @@ int main(void) {
         (Color){120, 140, 135, 255}   
     );
 
+    // history search: element symbols ("NaCl") filter by contents, anything else by prefix
+    TextBox historySearch(
+        Rectangle{ui.X(200), ui.Y(66), ui.S(180), ui.S(28)},
+        ROBOTO_MEDIUM,
+        ROBOTO_MEDIUM,
+        ui.S(16)
+    );
+    historySearch.SetPlaceholder("Search history...");
+    historySearch.SetColors(TEXT_LIGHT, (Color){102, 129, 127, 255});
+    historySearch.SetBackgroundColor((Color){31, 34, 39, 255});
+    std::vector<size_t> searchResults; // history indices, newest first
+    unsigned int searchRevision = historySearch.GetRevision();
+    unsigned int searchedHistoryRevision = history.GetRevision();
+    bool searching = false;
+
     // dropdown state
     bool dropdownOpen = false;
     int selectedDecimal = 1; // 0: 0.1, 1: 0.01, 2: 0.001
     const char* decimalValues[] = {"0.1", "0.01", "0.001"};
 
+    DebugOverlay debugOverlay(KEY_F3); // frame stats, toggled with F3
+
+    RenderTexture2D staticLayer = {}; // rebuilt on resize
+
+    const std::string weightsPath = appDirectory + WEIGHTS_DEFAULT_PATH;
+    if (FileExists(weightsPath.c_str())) {
+        LoadWeightTableFile(weightsPath.c_str());
+    }
+    const std::string abbreviationsPath = appDirectory + ABBREVIATIONS_PATH;
+    if (FileExists(abbreviationsPath.c_str())) {
+        LoadAbbreviationFile(abbreviationsPath.c_str());
+    }
+
+    // live molar mass shown under the input while typing
+    MassPreview massPreview;
+    unsigned int previewRevision = formulaInput.GetRevision();
+
     while (!WindowShouldClose()) {
+        debugOverlay.BeginFrame();
+
         ui.Update();      
         formulaInput.Update();
+        historySearch.Update();
+
+        // dropping a .bin dataset switches the atomic weights used by every new calculation
+        if (IsFileDropped()) {
+            FilePathList dropped = LoadDroppedFiles();
+            for (unsigned int i = 0; i < dropped.count; i++) {
+                if (IsFileExtension(dropped.paths[i], ".bin") && LoadWeightTableFile(dropped.paths[i])) {
+                    massPreview.RefreshWeights();
+                }
+            }
+            UnloadDroppedFiles(dropped);
+        }
+
+        if (formulaInput.GetRevision() != previewRevision) {
+            previewRevision = formulaInput.GetRevision();
+            massPreview.Update(formulaInput.GetFormattedText());
+        }
         
         // Button coordinates
         Rectangle calculateBtn = {ui.X(1360), ui.Y(410), ui.S(30), ui.S(30)};
@@ -89,6 +184,42 @@ int main(void) {
             dropdownItems[i] = {decimalBtn.x, decimalBtn.y + decimalBtn.height + (i * dropdownItemHeight), decimalBtn.width, dropdownItemHeight};
         }
 
+        // re-run the search when the query or the history changes, both are index lookups
+        if (historySearch.GetRevision() != searchRevision || history.GetRevision() != searchedHistoryRevision) {
+            if (historySearch.GetRevision() != searchRevision) {
+                historyScroll = 0.0f;
+            }
+            searchRevision = historySearch.GetRevision();
+            searchedHistoryRevision = history.GetRevision();
+
+            const std::string& query = historySearch.GetFormattedText();
+            searching = !query.empty();
+            history.Search(query, searchResults);
+        }
+        size_t historyRows = searching ? searchResults.size() : history.Size();
+
+        // history scrolling
+        float historyViewHeight = NATIVE_HEIGHT - HISTORY_TOP;
+        float historyMaxScroll = (float)historyRows * HISTORY_ROW_HEIGHT - historyViewHeight;
+        if (ui.IsMouseOver(0, HISTORY_TOP, 400, historyViewHeight)) {
+            historyScroll -= GetMouseWheelMove() * HISTORY_ROW_HEIGHT;
+        }
+        historyScroll = std::max(0.0f, std::min(historyScroll, historyMaxScroll));
+
+        // page in saved history when fewer than a batch of rows remain below the view; a search has
+        // to see every saved entry, so it keeps paging a batch per frame until the log runs out
+        // (each batch bumps the history revision, which re-runs the query above)
+        size_t rowsShown = (size_t)((historyScroll + historyViewHeight) / HISTORY_ROW_HEIGHT) + 1;
+        bool needOlder = searching || history.Size() < rowsShown + HISTORY_LOAD_BATCH;
+        if (historyStore.HasOlder() && !history.Full() && needOlder) {
+            double loadedMass;
+            for (int i = 0; i < HISTORY_LOAD_BATCH && historyStore.ReadOlder(loadedFormula, loadedMass); i++) {
+                if (!history.PushOlder(loadedFormula, loadedMass, selectedDecimal + 1)) {
+                    break;
+                }
+            }
+        }
+
         // dropdown interactions
         if (IsMouseButtonPressed(MOUSE_BUTTON_LEFT)) {
             if (CheckCollisionPointRec(GetMousePosition(), decimalBtn)) {
@@ -109,23 +240,20 @@ int main(void) {
             }
         }
         
-        // button bindings 
-        ui.AddElement(calculateBtn, [&formulaInput, &selectedDecimal, &history]() {
-            std::string formula = formulaInput.GetFormattedText();              
+        // button bindings (re-registered each frame, storage is reused so nothing allocates)
+        ui.ClearElements();
+        ui.AddElement(calculateBtn, [&formulaInput, &history, &historyStore, &historyScroll, &selectedDecimal]() {
+            const std::string& formula = formulaInput.GetFormattedText();              
            
             if (formula.empty()) {              
                 return;
             }           
 
             double molarMass = CalculateMolarMass(formula);  
-            // add to recent queue
-            history.insert(history.begin(), {formula, molarMass});
-            if (history.size() > MAX_HISTORY) {
-                history.pop_back();
-            }
-            
-            // format based on decimal precision selection
-            const char* formatStr[] = {"%.1f", "%.2f", "%.3f"};
+            // add to recent queue and jump back to it
+            history.Push(formula, molarMass, selectedDecimal + 1);
+            historyStore.Append(formula, molarMass);
+            historyScroll = 0.0f;
         });
         ui.AddElement(subscriptBtn, [&formulaInput]() {
             formulaInput.ToggleSubscript(true);
@@ -148,20 +276,28 @@ int main(void) {
             ? BUTTON_HOVER   
             : BUTTON_NORMAL; 
 
-        BeginDrawing();
-            ClearBackground((Color){41, 44, 49, 255});
+        debugOverlay.EndUpdate();
 
-            DrawRectangle(0, 0, (int)ui.GetWidth(), (int)ui.S(60), (Color){31, 34, 39, 255}); // top bar
-            
-            DrawRectangleGradientV(0, (int)ui.GetHeight() - ui.Y(600), (int)ui.GetWidth(), (int)ui.Y(600), (Color){0, 255, 197, 0}, (Color){0, 255, 197, 20}); // background gradient
+        // background, panels and labels only change with the window size
+        if (staticLayer.texture.width != GetScreenWidth() || staticLayer.texture.height != GetScreenHeight()) {
+            UnloadRenderTexture(staticLayer);
+            staticLayer = LoadRenderTexture(GetScreenWidth(), GetScreenHeight());
 
-            DrawCircle((int)ui.GetWidth() - ui.X(20), (int)ui.GetHeight() - ui.Y(20), ui.S(8.0f), (Color){31, 43, 41, 255}); // resize circle
+            BeginTextureMode(staticLayer);
+                fonts.BeginFontShader();
+                drawStaticLayer(ui);
+                fonts.EndFontShader();
+            EndTextureMode();
+        }
 
-            DrawRectangle(0, (int)ui.Y(60), (int)ui.S(400), (int)ui.GetHeight() - ui.Y(60), (Color){39, 42, 47, 200}); // history backing
-            DrawLine((int)ui.X(400), (int)ui.Y(60), (int)ui.X(400), (int)ui.GetHeight(), (Color){58, 62, 66, 255}); // history divider line
+        BeginDrawing();
+            // copy the cached layer as-is (its alpha is a by-product of blending and not meant to be composited)
+            rlSetBlendFactors(RL_ONE, RL_ZERO, RL_FUNC_ADD);
+            BeginBlendMode(BLEND_CUSTOM);
+            DrawTextureRec(staticLayer.texture, (Rectangle){0, 0, (float)staticLayer.texture.width, -(float)staticLayer.texture.height}, (Vector2){0, 0}, WHITE);
+            EndBlendMode();
 
-            DrawRectangleRounded((Rectangle){ui.X(600), ui.Y(350), ui.S(800), ui.S(100)}, 0.24f, 8, (Color){151, 172, 169, 255}); // search box background
-            DrawTextAligned(ROBOTO_REGULAR, "Tip: Use your arrow keys to quickly switch between subscript and regular numbers", (Rectangle){ui.X(600), ui.Y(460), ui.S(800), ui.S(100)}, ui.S(20), 0.0f, (Color){82, 109, 107, 255}, HorizontalAlign::Center, VerticalAlign::Top);
+            fonts.BeginFontShader();
             DrawRectangleRounded(calculateBtn, 0.4f, 6, calculateBtnClr); // calculate background button
             DrawTextAligned(NOTO_SYMBOLS, "➤", calculateBtn, ui.S(32), 0.0f, TEXT_LIGHT, HorizontalAlign::Center, VerticalAlign::Middle); // calculate icon
             
@@ -175,16 +311,24 @@ int main(void) {
             DrawRectangleRounded(clearBtn, 0.4f, 6, clearBtnClr); // clear button
             DrawTextAligned(ROBOTO_MEDIUM, "CLEAR", clearBtn, ui.S(20), 0.0f, TEXT_DARK, HorizontalAlign::Center, VerticalAlign::Middle);
 
-            DrawTextAlignedAt(ROBOTO_MEDIUM, "Molecular Formla", ui.X(600), ui.Y(346), ui.S(24), 0.0f, (Color){102, 129, 127, 255}, HorizontalAlign::Left, VerticalAlign::Bottom);
-
-            DrawTextAlignedAt(ROBOTO_BOLD, "Recent Data", ui.X(20), ui.Y(70), ui.S(24), 0.0f, (Color){81, 91, 110, 255}, HorizontalAlign::Left, VerticalAlign::Top);
+            if (!massPreview.IsEmpty()) { // live preview
+                const char* previewFormat[] = {"%.1f g/mol", "%.2f g/mol", "%.3f g/mol"};
+                const char* previewText = massPreview.HasUnknownElements()
+                    ? "Unknown element"
+                    : TextFormat(previewFormat[selectedDecimal], massPreview.GetMass());
+                DrawTextAlignedAt(ROBOTO_MEDIUM, previewText, ui.X(735), ui.Y(425), ui.S(20), 0.0f, TEXT_DARK, HorizontalAlign::Left, VerticalAlign::Middle);
+            }
 
-            DrawTextAlignedAt(ROBOTO_BOLD, "Molar Mass Calculator", ui.X(20), ui.Y(30), ui.S(30), 0.0f, (Color){50, 56, 66, 255}, HorizontalAlign::Left, VerticalAlign::Middle);
+            DrawTextAligned(ROBOTO_REGULAR, TextFormat("Atomic weights: %s", GetActiveWeights().name.c_str()), (Rectangle){ui.X(600), ui.Y(490), ui.S(800), ui.S(30)}, ui.S(18), 0.0f, (Color){82, 109, 107, 255}, HorizontalAlign::Center, VerticalAlign::Top);
 
             formulaInput.SetBounds(Rectangle{ui.X(600), ui.Y(350), ui.S(800), ui.S(50)});
             formulaInput.SetFontSize(ui.S(24));
             formulaInput.Draw();
 
+            historySearch.SetBounds(Rectangle{ui.X(200), ui.Y(66), ui.S(180), ui.S(28)});
+            historySearch.SetFontSize(ui.S(16));
+            historySearch.Draw();
+
             if (dropdownOpen) { // dropdown menu
                 DrawRectangleRounded(dropdownMenu, 0.2f, 6, BUTTON_HOVER); 
                 
@@ -218,82 +362,65 @@ int main(void) {
                 }
             }
 
-            float historyY = ui.Y(100);
-            for (size_t i = 0; i < history.size(); i++) {            
-                DrawTextAlignedAt(ROBOTO_BOLD, history[i].formula.c_str(), ui.X(20), historyY, ui.S(18), 0.0f, TEXT_LIGHT, HorizontalAlign::Left, VerticalAlign::Top); // formula
-                
-                // get decimal precision for display
-                const char* formatStr[] = {"%.1f", "%.2f", "%.3f"};
-                const char* molarMassStr = TextFormat(formatStr[selectedDecimal], history[i].molarMass);
+            // only the rows intersecting the panel are drawn, whatever the history size
+            size_t firstRow = (size_t)(historyScroll / HISTORY_ROW_HEIGHT);
+            size_t rowCount = (size_t)(historyViewHeight / HISTORY_ROW_HEIGHT) + 2;
+            size_t lastRow = std::min(historyRows, firstRow + rowCount);
+
+            BeginScissorMode(0, (int)ui.Y(HISTORY_TOP - 4), (int)ui.S(400), (int)(ui.GetHeight() - ui.Y(HISTORY_TOP - 4)));
+            for (size_t i = firstRow; i < lastRow; i++) {
+                float historyY = ui.Y(HISTORY_TOP + i * HISTORY_ROW_HEIGHT - historyScroll);
+
+                CalculationHistory& entry = history[searching ? searchResults[i] : i];
+                DrawTextAlignedAt(ROBOTO_BOLD, entry.formula.c_str(), ui.X(20), historyY, ui.S(18), 0.0f, TEXT_LIGHT, HorizontalAlign::Left, VerticalAlign::Top); // formula
                 
-                // draw molar mass in medium below formula
-                DrawTextAlignedAt(ROBOTO_MEDIUM, TextFormat("%s g/mol", molarMassStr), ui.X(20), historyY + ui.S(22), ui.S(16), 0.0f, (Color){102, 129, 127, 255}, HorizontalAlign::Left, VerticalAlign::Top);
+                // draw molar mass in medium below formula, reformatted only after a precision change
+                DrawTextAlignedAt(ROBOTO_MEDIUM, entry.GetMassText(selectedDecimal + 1), ui.X(20), historyY + ui.S(22), ui.S(16), 0.0f, (Color){102, 129, 127, 255}, HorizontalAlign::Left, VerticalAlign::Top);
                 
-                historyY += ui.S(50);
+                historyY += ui.S(HISTORY_ROW_HEIGHT);
                 
                 DrawLine((int)ui.X(20), (int)historyY - ui.S(8), (int)ui.X(380), (int)historyY - ui.S(8), (Color){58, 62, 66, 255}); // seperator line
             }
+            EndScissorMode();
+
+            if (historyMaxScroll > 0.0f) { // scrollbar
+                float trackHeight = historyViewHeight - 10;
+                float thumbHeight = std::max(20.0f, trackHeight * historyViewHeight / (historyMaxScroll + historyViewHeight));
+                float thumbY = HISTORY_TOP + (trackHeight - thumbHeight) * (historyScroll / historyMaxScroll);
+                DrawRectangleRounded(ui.Rect(392, thumbY, 4, thumbHeight), 1.0f, 4, (Color){58, 62, 66, 255});
+            }
+
+            debugOverlay.EndDraw(ui.GetElementCount());
+            debugOverlay.Draw(ROBOTO_MEDIUM, ui.GetScale());
+            fonts.EndFontShader();
         EndDrawing();
     }
     
-    UnloadFont(NOTO_SYMBOLS);
-    UnloadFont(ROBOTO_REGULAR);
-    UnloadFont(ROBOTO_MEDIUM);
-    UnloadFont(ROBOTO_BOLD);
+    historyStore.Close(); // flush pending writes
+    UnloadRenderTexture(staticLayer);
+    fonts.UnloadAll();
     CloseWindow();
     return 0;
 }
 
-void loadFonts() {
-    // Noto Symbols: ASCII + arrows/symbols only
-    int notoAsciiCount = 95;
-    int notoSymbols = 2; // ➤ and ▼
-    int notoTotalCount = notoAsciiCount + notoSymbols;
-    
-    int *notoCodepoints = (int *)malloc(notoTotalCount * sizeof(int));
-    
-    // ASCII printable characters (32-126)
-    for (int i = 0; i < notoAsciiCount; i++) {
-        notoCodepoints[i] = 32 + i;
-    }
-    
-    // extra symbols for Noto
-    notoCodepoints[notoAsciiCount + 0] = 0x27A4; // ➤ right arrow
-    notoCodepoints[notoAsciiCount + 1] = 0x25BC; // ▼ down triangle
-    
-    NOTO_SYMBOLS = LoadFontFromMemory(".ttf", font_data_symbol, sizeof(font_data_symbol), 40, notoCodepoints, notoTotalCount);
-    
-    free(notoCodepoints);
-    
-    int robotoAsciiCount = 95;
-    int subscriptCount = 10;
-    int robotoTotalCount = robotoAsciiCount + subscriptCount;
-    
-    int *robotoCodepoints = (int *)malloc(robotoTotalCount * sizeof(int));
-    
-    // ASCII printable characters (32-126)
-    for (int i = 0; i < robotoAsciiCount; i++) {
-        robotoCodepoints[i] = 32 + i;
-    }
-    
-    // subscript digits (U+2080 to U+2089): ₀₁₂₃₄₅₆₇₈₉
-    for (int i = 0; i < subscriptCount; i++) {
-        robotoCodepoints[robotoAsciiCount + i] = 0x2080 + i;
-    }
-    
-    ROBOTO_REGULAR = LoadFontFromMemory(".ttf", font_data_regular, sizeof(font_data_regular), 40, robotoCodepoints, robotoTotalCount);
-    ROBOTO_MEDIUM = LoadFontFromMemory(".ttf", font_data_medium, sizeof(font_data_medium), 40, robotoCodepoints, robotoTotalCount);
-    ROBOTO_BOLD = LoadFontFromMemory(".ttf", font_data_bold, sizeof(font_data_bold), 40, robotoCodepoints, robotoTotalCount);
+void drawStaticLayer(const UIContext& ui) {
+    ClearBackground((Color){41, 44, 49, 255});
+
+    DrawRectangle(0, 0, (int)ui.GetWidth(), (int)ui.S(60), (Color){31, 34, 39, 255}); // top bar
     
-    free(robotoCodepoints);
-
-    SetTextureFilter(NOTO_SYMBOLS.texture, TEXTURE_FILTER_BILINEAR);
-    SetTextureFilter(ROBOTO_REGULAR.texture, TEXTURE_FILTER_BILINEAR);
-    SetTextureFilter(ROBOTO_MEDIUM.texture, TEXTURE_FILTER_BILINEAR);
-    SetTextureFilter(ROBOTO_BOLD.texture, TEXTURE_FILTER_BILINEAR);
-
-    GenTextureMipmaps(&NOTO_SYMBOLS.texture);
-    GenTextureMipmaps(&ROBOTO_REGULAR.texture);
-    GenTextureMipmaps(&ROBOTO_MEDIUM.texture);
-    GenTextureMipmaps(&ROBOTO_BOLD.texture);
-}
\ No newline at end of file
+    DrawRectangleGradientV(0, (int)ui.GetHeight() - ui.Y(600), (int)ui.GetWidth(), (int)ui.Y(600), (Color){0, 255, 197, 0}, (Color){0, 255, 197, 20}); // background gradient
+
+    DrawCircle((int)ui.GetWidth() - ui.X(20), (int)ui.GetHeight() - ui.Y(20), ui.S(8.0f), (Color){31, 43, 41, 255}); // resize circle
+
+    DrawRectangle(0, (int)ui.Y(60), (int)ui.S(400), (int)ui.GetHeight() - ui.Y(60), (Color){39, 42, 47, 200}); // history backing
+    DrawLine((int)ui.X(400), (int)ui.Y(60), (int)ui.X(400), (int)ui.GetHeight(), (Color){58, 62, 66, 255}); // history divider line
+
+    DrawRectangleRounded((Rectangle){ui.X(600), ui.Y(350), ui.S(800), ui.S(100)}, 0.24f, 8, (Color){151, 172, 169, 255}); // search box background
+    DrawTextAligned(ROBOTO_REGULAR, "Tip: Use your arrow keys to quickly switch between subscript and regular numbers", (Rectangle){ui.X(600), ui.Y(460), ui.S(800), ui.S(100)}, ui.S(20), 0.0f, (Color){82, 109, 107, 255}, HorizontalAlign::Center, VerticalAlign::Top);
+
+    DrawTextAlignedAt(ROBOTO_MEDIUM, "Molecular Formla", ui.X(600), ui.Y(346), ui.S(24), 0.0f, (Color){102, 129, 127, 255}, HorizontalAlign::Left, VerticalAlign::Bottom);
+
+    DrawTextAlignedAt(ROBOTO_BOLD, "Recent Data", ui.X(20), ui.Y(70), ui.S(24), 0.0f, (Color){81, 91, 110, 255}, HorizontalAlign::Left, VerticalAlign::Top);
+
+    DrawTextAlignedAt(ROBOTO_BOLD, "Molar Mass Calculator", ui.X(20), ui.Y(30), ui.S(30), 0.0f, (Color){50, 56, 66, 255}, HorizontalAlign::Left, VerticalAlign::Middle);
+}
@@ -0,0 +1,176 @@
+#include "mass_preview.h"
+#include "weight_table.h"
+#include <algorithm>
+
+// token parsing looks up to 3 bytes past its end (UTF-8 subscript check), and a capital split off
+// before a lowercase-prefixed abbreviation ("OtBu") depends on the name that follows it
+static const size_t TOKEN_LOOKAHEAD = ABBREVIATION_MAX_LENGTH + 1;
+
+MassPreview::MassPreview()
+    : elementCounts(GetPeriodicTable().size() + 1, 0),
+      groupTokens(0), groupsTooDeep(false), multiplier(1), unknownSymbols(0), mass(0.0) {}
+
+static bool isGroupToken(FormulaTokenType type) {
+    return type == FormulaTokenType::GroupOpen || type == FormulaTokenType::GroupClose;
+}
+
+void MassPreview::applyToken(const Token& token, int sign) {
+    if (token.type == FormulaTokenType::Multiplier) {
+        multiplier = (sign > 0) ? token.count : 1;
+    } else if (isGroupToken(token.type)) {
+        groupTokens += sign;
+    } else if (token.unknown) {
+        unknownSymbols += sign;
+    } else if (token.abbreviation) {
+        for (const auto& term : token.abbreviation->counts) {
+            elementCounts[term.first] += (long long)sign * token.count * term.second * token.groupMultiplier;
+        }
+    } else if (token.atomicNumber > 0) {
+        elementCounts[token.atomicNumber] += (long long)sign * token.count * token.groupMultiplier;
+    }
+}
+
+// a group's count comes after its contents, so an edit can change the multiplier of tokens far
+// before it; brackets are matched front to back like CalculateMolarMass (a stray close is ignored,
+// an unclosed group counts once), then multipliers are pushed back to front
+void MassPreview::updateGroupMultipliers() {
+    openGroups.clear();
+    groupsTooDeep = false;
+    for (Token& token : tokens) {
+        token.closesGroup = false;
+    }
+    for (size_t i = 0; i < tokens.size(); i++) {
+        if (tokens[i].type == FormulaTokenType::GroupOpen) {
+            groupsTooDeep = groupsTooDeep || openGroups.size() == FORMULA_MAX_GROUP_DEPTH;
+            openGroups.push_back(i);
+        } else if (tokens[i].type == FormulaTokenType::GroupClose && !openGroups.empty()) {
+            tokens[i].closesGroup = true;
+            openGroups.pop_back();
+        }
+    }
+
+    // an unclosed open is always reached with an empty stack, so it pops nothing
+    groupMultipliers.clear();
+    for (size_t i = tokens.size(); i-- > 0;) {
+        Token& token = tokens[i];
+        long long current = groupMultipliers.empty() ? 1 : groupMultipliers.back();
+        if (token.closesGroup) {
+            groupMultipliers.push_back(current * token.count);
+        } else if (token.type == FormulaTokenType::GroupOpen) {
+            if (!groupMultipliers.empty()) groupMultipliers.pop_back();
+        } else if (token.groupMultiplier != current) {
+            applyToken(token, -1);
+            token.groupMultiplier = current;
+            applyToken(token, +1);
+        }
+    }
+}
+
+void MassPreview::recomputeMass() {
+    // per-element totals are exact integers, so repeated edits never accumulate rounding drift
+    const auto& table = GetPeriodicTable();
+    const WeightTable& weights = GetActiveWeights();
+    double sum = 0.0;
+    for (size_t i = 0; i < table.size(); i++) {
+        long long count = elementCounts[table[i].atomicNumber];
+        if (count != 0) {
+            sum += weights.Get(table[i].atomicNumber) * count;
+        }
+    }
+    mass = groupsTooDeep ? 0.0 : sum * multiplier;
+}
+
+void MassPreview::Update(const std::string& formula) {
+    if (formula == text) return;
+    
+    size_t oldLength = text.length();
+    size_t newLength = formula.length();
+    
+    // locate the edited span [prefix, length - suffix) in both versions
+    size_t limit = std::min(oldLength, newLength);
+    size_t prefix = 0;
+    while (prefix < limit && text[prefix] == formula[prefix]) {
+        prefix++;
+    }
+    size_t suffix = 0;
+    while (suffix < limit - prefix && text[oldLength - 1 - suffix] == formula[newLength - 1 - suffix]) {
+        suffix++;
+    }
+    size_t oldChangeEnd = oldLength - suffix;
+    size_t newChangeEnd = newLength - suffix;
+    
+    // first token whose parse could have seen the edit
+    size_t first = 0;
+    while (first < tokens.size() && tokens[first].end + TOKEN_LOOKAHEAD <= prefix) {
+        first++;
+    }
+    size_t pos = (first < tokens.size()) ? tokens[first].begin : (tokens.empty() ? 0 : tokens.back().end);
+    
+    // re-tokenize until a token boundary lines up with an unchanged old boundary
+    scratch.clear();
+    size_t last = first; // old tokens [first, last) get replaced
+    FormulaToken parsed;
+    while (true) {
+        if (pos >= newChangeEnd) {
+            size_t oldPos = pos - newChangeEnd + oldChangeEnd;
+            while (last < tokens.size() && tokens[last].begin < oldPos) {
+                last++;
+            }
+            bool atStart = (pos == 0);
+            if (last < tokens.size() && tokens[last].begin == oldPos && atStart == (oldPos == 0)) {
+                break;
+            }
+            if (pos >= newLength) {
+                last = tokens.size();
+                break;
+            }
+        }
+        
+        NextFormulaToken(formula, pos, parsed);
+        Token token;
+        token.begin = parsed.begin;
+        token.end = parsed.end;
+        token.count = parsed.count;
+        token.type = parsed.type;
+        token.unknown = (parsed.type == FormulaTokenType::Element && !parsed.element);
+        token.atomicNumber = parsed.element ? parsed.element->atomicNumber : 0;
+        token.abbreviation = parsed.abbreviation;
+        token.groupMultiplier = 1; // settled once the new tokens are spliced in
+        token.closesGroup = false;
+        scratch.push_back(token);
+    }
+    
+    bool hadGroups = (groupTokens > 0);
+    for (size_t i = first; i < last; i++) {
+        applyToken(tokens[i], -1);
+    }
+    for (const Token& token : scratch) {
+        applyToken(token, +1);
+    }
+    
+    // splice the new tokens in and shift the untouched tail by the length change
+    long long delta = (long long)newLength - (long long)oldLength;
+    for (size_t i = last; i < tokens.size(); i++) {
+        tokens[i].begin += delta;
+        tokens[i].end += delta;
+    }
+    tokens.erase(tokens.begin() + first, tokens.begin() + last);
+    tokens.insert(tokens.begin() + first, scratch.begin(), scratch.end());
+    if (hadGroups || groupTokens > 0) {
+        updateGroupMultipliers();
+    }
+    
+    text = formula;
+    recomputeMass();
+}
+
+void MassPreview::Clear() {
+    text.clear();
+    tokens.clear();
+    std::fill(elementCounts.begin(), elementCounts.end(), 0);
+    groupTokens = 0;
+    groupsTooDeep = false;
+    multiplier = 1;
+    unknownSymbols = 0;
+    mass = 0.0;
+}
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include "element_data.h"
+#include "abbreviations.h"
+
+// running molar mass of a formula that is being edited
+// each Update() diffs against the previous text and re-tokenizes only the edited region
+class MassPreview {
+private:
+    struct Token {
+        size_t begin;
+        size_t end;
+        FormulaTokenType type;
+        int atomicNumber; // 0 for skipped text, multipliers, abbreviations and unknown symbols
+        const Abbreviation* abbreviation;
+        int count;
+        long long groupMultiplier; // product of the counts of the groups around it
+        bool closesGroup; // a GroupClose with a matching open
+        bool unknown;
+    };
+
+    std::string text;
+    std::vector<Token> tokens;
+    std::vector<Token> scratch; // re-tokenized span, reused between edits
+    std::vector<size_t> openGroups; // bracket matching, reused between edits
+    std::vector<long long> groupMultipliers; // one per enclosing group, innermost last
+    std::vector<long long> elementCounts; // indexed by atomic number
+    int groupTokens; // brackets in tokens
+    bool groupsTooDeep; // nesting past FORMULA_MAX_GROUP_DEPTH, the mass is 0 like CalculateMolarMass
+    int multiplier;
+    int unknownSymbols;
+    double mass;
+
+    void applyToken(const Token& token, int sign);
+    void updateGroupMultipliers();
+    void recomputeMass();
+
+public:
+    MassPreview();
+
+    void Update(const std::string& formula);
+    void Clear();
+    void RefreshWeights() { recomputeMass(); } // after the active weight table changes
+
+    double GetMass() const { return mass; }
+    bool IsEmpty() const { return tokens.empty(); }
+    bool HasUnknownElements() const { return unknownSymbols > 0; }
+};
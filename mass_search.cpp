@@ -0,0 +1,228 @@
+#include "mass_search.h"
+#include "element_data.h"
+#include "weight_table.h"
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <thread>
+
+namespace {
+    struct IsotopeData {
+        int atomicNumber;
+        double monoisotopicMass;
+        int valence; // for the ring/double-bond check, 0 if it doesn't apply
+    };
+
+    // most abundant isotopes of the elements mass-spec searches usually allow (AME 2020)
+    const IsotopeData isotopeTable[] = {
+        {1,  1.00782503207, 1}, // H
+        {5,  11.0093054,    3}, // B
+        {6,  12.0,          4}, // C
+        {7,  14.0030740048, 3}, // N
+        {8,  15.99491461956, 2}, // O
+        {9,  18.99840322,   1}, // F
+        {11, 22.9897692809, 1}, // Na
+        {14, 27.9769265325, 4}, // Si
+        {15, 30.97376163,   3}, // P
+        {16, 31.97207100,   2}, // S
+        {17, 34.96885268,   1}, // Cl
+        {19, 38.96370668,   1}, // K
+        {35, 78.9183371,    1}, // Br
+        {53, 126.904473,    1}, // I
+    };
+
+    const IsotopeData* findIsotopeData(int atomicNumber) {
+        for (const IsotopeData& data : isotopeTable) {
+            if (data.atomicNumber == atomicNumber) return &data;
+        }
+        return nullptr;
+    }
+
+    // search state in heaviest-first order, laid out as parallel arrays
+    struct SearchPlan {
+        std::vector<double> masses;
+        std::vector<int> minCounts;
+        std::vector<int> maxCounts;
+        std::vector<int> valences;
+        std::vector<int> queryIndex; // back to the caller's element order
+        std::vector<double> minRest; // least mass elements i.. must add
+        std::vector<double> maxRest; // most mass elements i.. can add
+        double low;
+        double high;
+        bool chemicalFilter;
+    };
+
+    struct SearchWorker {
+        const SearchPlan* plan;
+        std::vector<int> counts;
+        std::vector<MassCandidate> results;
+
+        void accept(double mass) {
+            const SearchPlan& p = *plan;
+            if (p.chemicalFilter) {
+                // twice the ring/double-bond equivalents: 2 + sum n * (valence - 2)
+                long long doubled = 2;
+                for (size_t i = 0; i < counts.size(); i++) {
+                    if (p.valences[i] == 0) continue;
+                    doubled += (long long)counts[i] * (p.valences[i] - 2);
+                }
+                if (doubled < 0 || doubled % 2 != 0) return;
+            }
+
+            MassCandidate candidate;
+            candidate.counts.assign(counts.size(), 0);
+            for (size_t i = 0; i < counts.size(); i++) {
+                candidate.counts[p.queryIndex[i]] = counts[i];
+            }
+            candidate.mass = mass;
+            results.push_back(std::move(candidate));
+        }
+
+        // budget is twice the ring/double-bond equivalents of the counts so far,
+        // with a monovalent last element (hydrogen) it caps how many of those can still fit
+        void search(size_t level, double mass, long long budget) {
+            const SearchPlan& p = *plan;
+            size_t last = p.masses.size() - 1;
+            double elementMass = p.masses[level];
+            bool budgeted = p.chemicalFilter && p.valences[last] == 1;
+
+            if (level == last) {
+                // the lightest element closes the gap directly
+                int lo = std::max(p.minCounts[level], (int)std::ceil((p.low - mass) / elementMass));
+                int hi = std::min(p.maxCounts[level], (int)std::floor((p.high - mass) / elementMass));
+                if (budgeted) hi = (int)std::min<long long>(hi, budget);
+                for (int c = lo; c <= hi; c++) {
+                    counts[level] = c;
+                    accept(mass + c * elementMass);
+                }
+                return;
+            }
+
+            int first = p.minCounts[level];
+            int valenceGain = p.valences[level] > 0 ? p.valences[level] - 2 : 0;
+            if (budgeted && level + 1 == last) {
+                // the last element must cover the rest of the mass but can't exceed the budget:
+                // (low - mass - m*c) / mLast <= budget + gain*c
+                double lastMass = p.masses[last];
+                double perCount = elementMass + lastMass * valenceGain;
+                if (perCount > 0.0) {
+                    first = std::max(first, (int)std::ceil((p.low - mass - lastMass * budget) / perCount));
+                }
+            }
+
+            for (int c = first; c <= p.maxCounts[level]; c++) {
+                double partial = mass + c * elementMass;
+                if (partial + p.minRest[level + 1] > p.high) break; // only grows from here
+                if (partial + p.maxRest[level + 1] < p.low) continue;
+                counts[level] = c;
+                search(level + 1, partial, budget + (long long)c * valenceGain);
+            }
+        }
+    };
+}
+
+double GetMonoisotopicMass(int atomicNumber) {
+    const IsotopeData* data = findIsotopeData(atomicNumber);
+    return data ? data->monoisotopicMass : GetAtomicWeight(atomicNumber);
+}
+
+std::vector<MassCandidate> FindFormulasByMass(const MassSearchQuery& query) {
+    std::vector<MassCandidate> results;
+    size_t n = query.elements.size();
+    if (n == 0 || query.targetMass <= 0.0) return results;
+
+    double tolerance = query.targetMass * query.tolerancePpm * 1e-6;
+
+    SearchPlan plan;
+    plan.low = query.targetMass - tolerance;
+    plan.high = query.targetMass + tolerance;
+    plan.chemicalFilter = query.chemicalFilter;
+
+    std::vector<int> order(n);
+    for (size_t i = 0; i < n; i++) order[i] = (int)i;
+    std::sort(order.begin(), order.end(), [&](int a, int b) {
+        return GetMonoisotopicMass(query.elements[a].atomicNumber) > GetMonoisotopicMass(query.elements[b].atomicNumber);
+    });
+
+    for (int i : order) {
+        const ElementRange& range = query.elements[i];
+        const IsotopeData* data = findIsotopeData(range.atomicNumber);
+        double mass = GetMonoisotopicMass(range.atomicNumber);
+        if (mass <= 0.0) return results;
+
+        int fit = (int)std::floor(plan.high / mass);
+        plan.masses.push_back(mass);
+        plan.minCounts.push_back(std::max(0, range.minCount));
+        plan.maxCounts.push_back(range.maxCount < 0 ? fit : std::min(range.maxCount, fit));
+        plan.valences.push_back(data ? data->valence : 0);
+        plan.queryIndex.push_back(i);
+    }
+
+    plan.minRest.assign(n + 1, 0.0);
+    plan.maxRest.assign(n + 1, 0.0);
+    for (size_t i = n; i-- > 0;) {
+        plan.minRest[i] = plan.minRest[i + 1] + plan.minCounts[i] * plan.masses[i];
+        plan.maxRest[i] = plan.maxRest[i + 1] + plan.maxCounts[i] * plan.masses[i];
+    }
+
+    // threads pull top-level counts from a shared counter, the subtrees are uneven
+    int threadCount = query.threads > 0 ? query.threads : (int)std::thread::hardware_concurrency();
+    int topLevelCounts = plan.maxCounts[0] - plan.minCounts[0] + 1;
+    threadCount = std::max(1, std::min(threadCount, topLevelCounts));
+
+    std::atomic<int> nextCount(plan.minCounts[0]);
+    std::vector<SearchWorker> workers(threadCount);
+    auto run = [&plan, &nextCount, n](SearchWorker& worker) {
+        worker.plan = &plan;
+        worker.counts.assign(n, 0);
+        for (int c = nextCount++; c <= plan.maxCounts[0]; c = nextCount++) {
+            double mass = c * plan.masses[0];
+            if (n == 1) {
+                if (mass >= plan.low && mass <= plan.high) {
+                    worker.counts[0] = c;
+                    worker.accept(mass);
+                }
+                continue;
+            }
+            if (mass + plan.minRest[1] > plan.high) break;
+            if (mass + plan.maxRest[1] < plan.low) continue;
+            worker.counts[0] = c;
+            int valenceGain = plan.valences[0] > 0 ? plan.valences[0] - 2 : 0;
+            worker.search(1, mass, 2 + (long long)c * valenceGain);
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for (int t = 1; t < threadCount; t++) {
+        threads.emplace_back(run, std::ref(workers[t]));
+    }
+    run(workers[0]);
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+
+    for (SearchWorker& worker : workers) {
+        results.insert(results.end(), std::make_move_iterator(worker.results.begin()), std::make_move_iterator(worker.results.end()));
+    }
+
+    for (MassCandidate& candidate : results) {
+        candidate.errorPpm = (candidate.mass - query.targetMass) / query.targetMass * 1e6;
+    }
+    std::sort(results.begin(), results.end(), [](const MassCandidate& a, const MassCandidate& b) {
+        return std::fabs(a.errorPpm) < std::fabs(b.errorPpm);
+    });
+    if (query.maxResults > 0 && results.size() > query.maxResults) {
+        results.resize(query.maxResults);
+    }
+
+    // formulas only for what is returned
+    for (MassCandidate& candidate : results) {
+        for (size_t i = 0; i < n; i++) {
+            int count = candidate.counts[i];
+            if (count == 0) continue;
+            candidate.formula += FindElementByAtomicNumber(query.elements[i].atomicNumber)->symbol;
+            if (count != 1) candidate.formula += std::to_string(count);
+        }
+    }
+    return results;
+}
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+struct ElementRange {
+    int atomicNumber;
+    int minCount;
+    int maxCount; // -1 for "as many as fit the target mass"
+};
+
+struct MassSearchQuery {
+    double targetMass;            // measured neutral monoisotopic mass in Da
+    double tolerancePpm = 5.0;
+    std::vector<ElementRange> elements;
+    bool chemicalFilter = true;   // require a whole, non-negative ring/double-bond count
+    size_t maxResults = 0;        // keep only the closest N, 0 for all
+    int threads = 0;              // 0 for one per hardware thread
+};
+
+struct MassCandidate {
+    std::vector<int> counts; // in query element order
+    double mass;
+    double errorPpm;
+    std::string formula;     // query element order, ASCII digits
+};
+
+// every formula within tolerance of the target, closest first
+// depth-first over the element counts, heaviest element first, pruned by the mass the
+// remaining elements can still add; the top-level counts are shared out between threads
+std::vector<MassCandidate> FindFormulasByMass(const MassSearchQuery& query);
+
+// exact mass of the most abundant isotope, falls back to the active average weight
+double GetMonoisotopicMass(int atomicNumber);
@@ -0,0 +1,234 @@
+#include "reaction.h"
+#include "element_data.h"
+#include "weight_table.h"
+#include <algorithm>
+#include <cctype>
+#include <climits>
+#include <cstdlib>
+
+namespace {
+    long long gcd(long long a, long long b) {
+        a = std::llabs(a);
+        b = std::llabs(b);
+        while (b != 0) {
+            long long t = a % b;
+            a = b;
+            b = t;
+        }
+        return a;
+    }
+
+    // a * b - c * d, false on signed overflow (large networks can outgrow long long)
+    bool mulSub(long long a, long long b, long long c, long long d, long long& result) {
+        long long ab, cd;
+        return !__builtin_mul_overflow(a, b, &ab) && !__builtin_mul_overflow(c, d, &cd) &&
+               !__builtin_sub_overflow(ab, cd, &result);
+    }
+
+    std::string trim(const std::string& text, size_t begin, size_t end) {
+        while (begin < end && std::isspace((unsigned char)text[begin])) begin++;
+        while (end > begin && std::isspace((unsigned char)text[end - 1])) end--;
+        return text.substr(begin, end - begin);
+    }
+
+    // splits one side of the equation on '+' into species; when the side is written with
+    // spaced separators ("NH4+ + OH-") only those split, so ion charges stay attached
+    bool addSide(const std::string& equation, size_t begin, size_t end, bool product, Reaction& reaction) {
+        bool spaced = false;
+        for (size_t i = begin + 1; i + 1 < end && !spaced; i++) {
+            spaced = equation[i] == '+' && std::isspace((unsigned char)equation[i - 1]) && std::isspace((unsigned char)equation[i + 1]);
+        }
+
+        size_t start = begin;
+        for (size_t i = begin; i <= end; i++) {
+            if (i < end) {
+                if (equation[i] != '+') continue;
+                if (spaced && (i == begin || i + 1 >= end ||
+                               !std::isspace((unsigned char)equation[i - 1]) || !std::isspace((unsigned char)equation[i + 1]))) continue;
+            }
+
+            std::string formula = trim(equation, start, i);
+            if (formula.empty()) {
+                reaction.error = "Empty species";
+                return false;
+            }
+
+            // drop a written coefficient, it is recomputed
+            size_t digits = 0;
+            while (digits < formula.length() && std::isdigit((unsigned char)formula[digits])) digits++;
+            formula = trim(formula, digits, formula.length());
+
+            reaction.species.push_back(ReactionSpecies{formula, product, 0, 0.0});
+            start = i + 1;
+        }
+        return true;
+    }
+
+    // sparse element counts of one species, (atomic number, count) pairs
+    struct SpeciesCounts {
+        std::vector<std::pair<int, long long>> counts;
+    };
+}
+
+bool BalanceReaction(const std::string& equation, Reaction& reaction) {
+    reaction.species.clear();
+    reaction.balanced = false;
+    reaction.error.clear();
+
+    size_t arrow = equation.find("->");
+    size_t arrowLength = 2;
+    if (arrow == std::string::npos) {
+        arrow = equation.find("\xE2\x86\x92"); // U+2192 RIGHTWARDS ARROW
+        arrowLength = 3;
+    }
+    if (arrow == std::string::npos) {
+        arrow = equation.find('=');
+        arrowLength = 1;
+    }
+    if (arrow == std::string::npos) {
+        reaction.error = "Missing '->' between reactants and products";
+        return false;
+    }
+
+    if (!addSide(equation, 0, arrow, false, reaction) ||
+        !addSide(equation, arrow + arrowLength, equation.length(), true, reaction)) {
+        return false;
+    }
+
+    // one parse per species (brackets expanded) gives both its element counts and its molar mass
+    const WeightTable& weights = GetActiveWeights();
+    std::vector<SpeciesCounts> speciesCounts(reaction.species.size());
+    std::vector<int> rowOf(GetPeriodicTable().size() + 1, -1); // atomic number -> matrix row
+    int rows = 0;
+    ElementCounts elementCounts;
+
+    for (size_t s = 0; s < reaction.species.size(); s++) {
+        ReactionSpecies& species = reaction.species[s];
+        if (!CountElements(species.formula, elementCounts)) {
+            reaction.error = "Unknown element or unbalanced brackets in " + species.formula;
+            return false;
+        }
+
+        for (int atomicNumber : elementCounts.present) {
+            long long count = elementCounts.byAtomicNumber[atomicNumber];
+            species.molarMass += weights.Get(atomicNumber) * count;
+
+            if (rowOf[atomicNumber] < 0) {
+                rowOf[atomicNumber] = rows++;
+            }
+            speciesCounts[s].counts.push_back(std::make_pair(atomicNumber, count));
+        }
+
+        // charge is conserved too, it gets the unused atomic number 0 as its row
+        if (elementCounts.charge != 0) {
+            if (rowOf[0] < 0) {
+                rowOf[0] = rows++;
+            }
+            speciesCounts[s].counts.push_back(std::make_pair(0, (long long)elementCounts.charge));
+        }
+    }
+
+    // element x species matrix in one contiguous row-major block, products negated
+    // so the balanced coefficients are its null space
+    const int cols = (int)reaction.species.size();
+    std::vector<long long> matrix((size_t)rows * cols, 0);
+    for (int s = 0; s < cols; s++) {
+        long long sign = reaction.species[s].product ? -1 : 1;
+        for (const auto& count : speciesCounts[s].counts) {
+            matrix[(size_t)rowOf[count.first] * cols + s] += sign * count.second;
+        }
+    }
+
+    // fraction-free reduction to reduced row echelon form, rows kept small by their gcd
+    std::vector<int> pivotCol;
+    int rank = 0;
+    for (int c = 0; c < cols && rank < rows; c++) {
+        int pivot = -1;
+        for (int r = rank; r < rows; r++) {
+            if (matrix[(size_t)r * cols + c] != 0) {
+                pivot = r;
+                break;
+            }
+        }
+        if (pivot < 0) continue;
+
+        long long* pivotRow = &matrix[(size_t)pivot * cols];
+        if (pivot != rank) {
+            std::swap_ranges(pivotRow, pivotRow + cols, &matrix[(size_t)rank * cols]);
+            pivotRow = &matrix[(size_t)rank * cols];
+        }
+
+        for (int r = 0; r < rows; r++) {
+            long long* row = &matrix[(size_t)r * cols];
+            if (r == rank || row[c] == 0) continue;
+
+            long long factor = row[c];
+            long long pivotValue = pivotRow[c];
+            long long rowGcd = 0;
+            for (int k = 0; k < cols; k++) {
+                if (!mulSub(row[k], pivotValue, pivotRow[k], factor, row[k])) {
+                    reaction.error = "Reaction coefficients are too large";
+                    return false;
+                }
+                rowGcd = gcd(rowGcd, row[k]);
+            }
+            if (rowGcd > 1) {
+                for (int k = 0; k < cols; k++) row[k] /= rowGcd;
+            }
+        }
+
+        pivotCol.push_back(c);
+        rank++;
+    }
+
+    if (cols - rank != 1) {
+        reaction.error = (cols - rank == 0)
+            ? "Reaction cannot be balanced"
+            : "Reaction has more than one independent balance";
+        return false;
+    }
+
+    // the single free column gets the lcm of the pivots, every pivot column follows from its row
+    int freeCol = 0;
+    for (int r = 0; r < rank && pivotCol[r] == freeCol; r++) {
+        freeCol++;
+    }
+
+    long long scale = 1;
+    for (int r = 0; r < rank; r++) {
+        long long pivotValue = std::llabs(matrix[(size_t)r * cols + pivotCol[r]]);
+        if (__builtin_mul_overflow(scale / gcd(scale, pivotValue), pivotValue, &scale)) {
+            reaction.error = "Reaction coefficients are too large";
+            return false;
+        }
+    }
+
+    std::vector<long long> coefficients(cols, 0);
+    coefficients[freeCol] = scale;
+    for (int r = 0; r < rank; r++) {
+        const long long* row = &matrix[(size_t)r * cols];
+        if (__builtin_mul_overflow(-row[freeCol], scale / row[pivotCol[r]], &coefficients[pivotCol[r]])) {
+            reaction.error = "Reaction coefficients are too large";
+            return false;
+        }
+    }
+
+    long long common = 0;
+    for (long long value : coefficients) common = gcd(common, value);
+    if (coefficients[0] < 0) common = -common;
+    for (int s = 0; s < cols; s++) {
+        long long value = coefficients[s] / common;
+        if (value <= 0) {
+            reaction.error = "Reaction cannot be balanced with positive coefficients";
+            return false;
+        }
+        if (value > INT_MAX) {
+            reaction.error = "Reaction coefficients are too large";
+            return false;
+        }
+        reaction.species[s].coefficient = (int)value;
+    }
+
+    reaction.balanced = true;
+    return true;
+}
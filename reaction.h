@@ -0,0 +1,21 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+struct ReactionSpecies {
+    std::string formula; // as written, without its coefficient
+    bool product;
+    int coefficient;     // smallest positive integer solution, 0 until balanced
+    double molarMass;    // of one formula unit, from the active weight table
+};
+
+struct Reaction {
+    std::vector<ReactionSpecies> species; // reactants first, in input order
+    bool balanced;
+    std::string error; // why balancing failed, empty on success
+};
+
+// parses "C3H8 + O2 -> CO2 + H2O" ("=" and "→" also separate the sides, written coefficients are ignored)
+// and solves the element and charge balance with exact integer elimination; returns reaction.balanced
+bool BalanceReaction(const std::string& equation, Reaction& reaction);
@@ -1,9136 +1,532 @@
 #ifndef ROBOTO_LIGHT_H
 #define ROBOTO_LIGHT_H
 
+// subset to 105 codepoints, raw DEFLATE, 8373 bytes -> 11356 bytes
 static const unsigned char font_data_light[] = {
-    0x00, 0x01, 0x00, 0x00, 0x00, 0x12, 0x01, 0x00, 0x00, 0x04, 0x00, 0x20, 0x47, 0x44, 0x45, 0x46,
-    0xa6, 0x43, 0xa4, 0x4c, 0x00, 0x00, 0x03, 0x90, 0x00, 0x00, 0x02, 0x58, 0x47, 0x50, 0x4f, 0x53,
-    0x07, 0xd2, 0xda, 0xe4, 0x00, 0x00, 0x5d, 0xf4, 0x00, 0x00, 0x58, 0xc0, 0x47, 0x53, 0x55, 0x42,
-    0xfb, 0x94, 0xe5, 0x31, 0x00, 0x00, 0x47, 0xfc, 0x00, 0x00, 0x15, 0xf6, 0x4f, 0x53, 0x2f, 0x32,
-    0x97, 0x1f, 0xb1, 0x74, 0x00, 0x00, 0x02, 0x30, 0x00, 0x00, 0x00, 0x60, 0x53, 0x54, 0x41, 0x54,
-    0x5e, 0xfa, 0x40, 0x15, 0x00, 0x00, 0x01, 0xd4, 0x00, 0x00, 0x00, 0x5a, 0x63, 0x6d, 0x61, 0x70,
-    0xc1, 0x25, 0x61, 0xd3, 0x00, 0x00, 0x08, 0xb8, 0x00, 0x00, 0x06, 0x84, 0x63, 0x76, 0x74, 0x20,
-    0x3b, 0xf8, 0x26, 0x7d, 0x00, 0x00, 0x02, 0x90, 0x00, 0x00, 0x00, 0xfe, 0x66, 0x70, 0x67, 0x6d,
-    0xa8, 0x05, 0x84, 0x32, 0x00, 0x00, 0x23, 0xd0, 0x00, 0x00, 0x0f, 0x86, 0x67, 0x61, 0x73, 0x70,
-    0x00, 0x08, 0x00, 0x19, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0x00, 0x0c, 0x67, 0x6c, 0x79, 0x66,
-    0xfa, 0x28, 0xb6, 0x6f, 0x00, 0x00, 0xb6, 0xb4, 0x00, 0x01, 0x83, 0xd2, 0x68, 0x65, 0x61, 0x64,
-    0x09, 0x2f, 0x61, 0x31, 0x00, 0x00, 0x01, 0x9c, 0x00, 0x00, 0x00, 0x36, 0x68, 0x68, 0x65, 0x61,
-    0x0a, 0xa9, 0x0a, 0xb3, 0x00, 0x00, 0x01, 0x78, 0x00, 0x00, 0x00, 0x24, 0x68, 0x6d, 0x74, 0x78,
-    0xa6, 0xfd, 0xcd, 0xa8, 0x00, 0x00, 0x33, 0x58, 0x00, 0x00, 0x14, 0xa4, 0x6c, 0x6f, 0x63, 0x61,
-    0x9f, 0x68, 0xfc, 0x0a, 0x00, 0x00, 0x19, 0x7c, 0x00, 0x00, 0x0a, 0x54, 0x6d, 0x61, 0x78, 0x70,
-    0x08, 0xd9, 0x10, 0xc6, 0x00, 0x00, 0x01, 0x38, 0x00, 0x00, 0x00, 0x20, 0x6e, 0x61, 0x6d, 0x65,
-    0xb8, 0x12, 0xa8, 0x23, 0x00, 0x00, 0x0f, 0x3c, 0x00, 0x00, 0x0a, 0x3e, 0x70, 0x6f, 0x73, 0x74,
-    0xff, 0x6d, 0x00, 0x64, 0x00, 0x00, 0x01, 0x58, 0x00, 0x00, 0x00, 0x20, 0x70, 0x72, 0x65, 0x70,
-    0x79, 0x58, 0xce, 0xd3, 0x00, 0x00, 0x05, 0xe8, 0x00, 0x00, 0x02, 0xce, 0x00, 0x01, 0x00, 0x02,
-    0x00, 0x08, 0x00, 0x08, 0xff, 0xff, 0x00, 0x0f, 0x00, 0x01, 0x00, 0x00, 0x05, 0x29, 0x00, 0xa9,
-    0x00, 0x15, 0x00, 0x76, 0x00, 0x07, 0x00, 0x02, 0x00, 0x10, 0x00, 0x2f, 0x00, 0x9a, 0x00, 0x00,
-    0x02, 0xe6, 0x0f, 0x75, 0x00, 0x03, 0x00, 0x01, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xff, 0x6a, 0x00, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x07, 0x6c, 0xfe, 0x0c,
-    0x00, 0x00, 0x09, 0x38, 0xfa, 0x1f, 0xfe, 0x45, 0x09, 0x1b, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x29, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0x03, 0x02, 0x4e, 0x34, 0x80, 0xea, 0x57, 0x5f, 0x0f, 0x3c, 0xf5, 0x00, 0x1b, 0x08, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xc4, 0xf0, 0x11, 0x2e, 0x00, 0x00, 0x00, 0x00, 0xe1, 0xd4, 0x02, 0x6f,
-    0xfa, 0x1f, 0xfd, 0xd5, 0x09, 0x1b, 0x08, 0x73, 0x00, 0x00, 0x00, 0x09, 0x00, 0x02, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x08, 0x00, 0x03, 0x00, 0x00, 0x00, 0x14,
-    0x00, 0x03, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x02, 0x77, 0x64, 0x74, 0x68, 0x01, 0x01, 0x00, 0x00,
-    0x77, 0x67, 0x68, 0x74, 0x01, 0x00, 0x00, 0x01, 0x69, 0x74, 0x61, 0x6c, 0x01, 0x02, 0x00, 0x02,
-    0x00, 0x22, 0x00, 0x16, 0x00, 0x06, 0x00, 0x03, 0x00, 0x02, 0x00, 0x02, 0x01, 0x28, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x01, 0x05, 0x01, 0x2c,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x01, 0x27, 0x00, 0x64, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x04, 0x04, 0x72, 0x01, 0x2c, 0x00, 0x05, 0x00, 0x00, 0x05, 0x9a, 0x05, 0x33, 0x00, 0x00,
-    0x01, 0x1f, 0x05, 0x9a, 0x05, 0x33, 0x00, 0x00, 0x03, 0xd1, 0x00, 0x66, 0x02, 0x00, 0x00, 0x00,
-    0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x02, 0xff, 0x50, 0x00,
-    0x20, 0x5b, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x47, 0x4f, 0x4f, 0x47, 0x00, 0x40,
-    0x00, 0x00, 0xff, 0xfd, 0x06, 0x00, 0xfe, 0x00, 0x00, 0x66, 0x07, 0x9a, 0x02, 0x00, 0x20, 0x00,
-    0x01, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x04, 0x3a, 0x05, 0xb0, 0x00, 0x00, 0x00, 0x20, 0x00, 0x03,
-    0x06, 0x00, 0x00, 0x15, 0x05, 0xb0, 0x00, 0x14, 0x05, 0xb0, 0x00, 0x14, 0x04, 0x3a, 0x00, 0x14,
-    0x00, 0x00, 0xff, 0xec, 0x00, 0x00, 0xff, 0xec, 0x00, 0x00, 0xff, 0xec, 0xfe, 0x60, 0xff, 0xf5,
-    0x05, 0xb0, 0x00, 0x15, 0x00, 0x00, 0xff, 0xeb, 0x00, 0x00, 0x00, 0xbd, 0x00, 0xc0, 0x00, 0x9d,
-    0x00, 0x9d, 0x00, 0xba, 0x00, 0x97, 0x00, 0x97, 0x00, 0x27, 0x00, 0xc0, 0x00, 0x9d, 0x00, 0x86,
-    0x00, 0xbc, 0x00, 0xab, 0x00, 0xba, 0x00, 0x9a, 0x00, 0xd3, 0x00, 0xb3, 0x00, 0x99, 0x01, 0xe0,
-    0x00, 0x96, 0x00, 0xba, 0x00, 0x9a, 0x00, 0xa9, 0x01, 0x0b, 0x00, 0x82, 0x00, 0xae, 0x00, 0xa0,
-    0x00, 0x8c, 0x00, 0x95, 0x00, 0xb9, 0x00, 0xa9, 0x00, 0x17, 0x00, 0x93, 0x00, 0x9a, 0x00, 0x7b,
-    0x00, 0x8b, 0x00, 0xa1, 0x00, 0xde, 0x00, 0xa0, 0x00, 0x8c, 0x00, 0x9d, 0x00, 0xb6, 0x00, 0x27,
-    0x00, 0xc0, 0x00, 0x9d, 0x00, 0xa4, 0x00, 0x86, 0x00, 0xa2, 0x00, 0xab, 0x00, 0xb6, 0x00, 0xbf,
-    0x00, 0xba, 0x00, 0x82, 0x00, 0x8e, 0x00, 0x9a, 0x00, 0xa2, 0x00, 0xb2, 0x00, 0xd3, 0x00, 0x91,
-    0x00, 0x99, 0x00, 0xad, 0x00, 0xb3, 0x00, 0xbe, 0x01, 0xc9, 0x01, 0xfd, 0x00, 0x96, 0x00, 0xba,
-    0x00, 0x47, 0x00, 0x98, 0x00, 0x9d, 0x00, 0xa9, 0x01, 0x0b, 0x00, 0x82, 0x00, 0x99, 0x00, 0x9f,
-    0x00, 0xa9, 0x00, 0xb0, 0x00, 0x81, 0x00, 0x85, 0x00, 0x8b, 0x00, 0x94, 0x00, 0xa9, 0x00, 0xb5,
-    0x00, 0xba, 0x00, 0x17, 0x00, 0x50, 0x00, 0x63, 0x00, 0x78, 0x00, 0x7d, 0x00, 0x83, 0x00, 0x8b,
-    0x00, 0x90, 0x00, 0x98, 0x00, 0xa2, 0x00, 0xae, 0x00, 0xd4, 0x00, 0xde, 0x01, 0x26, 0x00, 0x7b,
-    0x00, 0x89, 0x00, 0x93, 0x00, 0x9d, 0x00, 0xa5, 0x00, 0xb4, 0x04, 0x8d, 0x00, 0x10, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x02, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x28, 0x00, 0x02,
-    0x00, 0x59, 0x00, 0x25, 0x00, 0x3e, 0x00, 0x01, 0x00, 0x44, 0x00, 0x5e, 0x00, 0x01, 0x00, 0x6a,
-    0x00, 0x6a, 0x00, 0x01, 0x00, 0x70, 0x00, 0x70, 0x00, 0x01, 0x00, 0x75, 0x00, 0x75, 0x00, 0x01,
-    0x00, 0x81, 0x00, 0x81, 0x00, 0x01, 0x00, 0x83, 0x00, 0x83, 0x00, 0x01, 0x00, 0x86, 0x00, 0x86,
-    0x00, 0x01, 0x00, 0x89, 0x00, 0x89, 0x00, 0x01, 0x00, 0x8b, 0x00, 0x96, 0x00, 0x01, 0x00, 0x98,
-    0x00, 0x9f, 0x00, 0x01, 0x00, 0xa1, 0x00, 0xa3, 0x00, 0x01, 0x00, 0xa5, 0x00, 0xa6, 0x00, 0x01,
-    0x00, 0xa8, 0x00, 0xad, 0x00, 0x03, 0x00, 0xb1, 0x00, 0xb1, 0x00, 0x01, 0x00, 0xba, 0x00, 0xbb,
-    0x00, 0x01, 0x00, 0xbf, 0x00, 0xbf, 0x00, 0x01, 0x00, 0xc1, 0x00, 0xc1, 0x00, 0x01, 0x00, 0xc3,
-    0x00, 0xc4, 0x00, 0x01, 0x00, 0xc7, 0x00, 0xc7, 0x00, 0x01, 0x00, 0xcb, 0x00, 0xcb, 0x00, 0x01,
-    0x00, 0xcd, 0x00, 0xce, 0x00, 0x01, 0x00, 0xd0, 0x00, 0xd1, 0x00, 0x01, 0x00, 0xd3, 0x00, 0xd3,
-    0x00, 0x01, 0x00, 0xda, 0x00, 0xde, 0x00, 0x01, 0x00, 0xe1, 0x00, 0xe1, 0x00, 0x01, 0x00, 0xe5,
-    0x00, 0xe5, 0x00, 0x01, 0x00, 0xe7, 0x00, 0xe9, 0x00, 0x01, 0x00, 0xeb, 0x00, 0xfb, 0x00, 0x01,
-    0x00, 0xfd, 0x00, 0xfd, 0x00, 0x01, 0x00, 0xff, 0x01, 0x01, 0x00, 0x01, 0x01, 0x03, 0x01, 0x03,
-    0x00, 0x01, 0x01, 0x08, 0x01, 0x09, 0x00, 0x01, 0x01, 0x16, 0x01, 0x1a, 0x00, 0x01, 0x01, 0x1c,
-    0x01, 0x1c, 0x00, 0x01, 0x01, 0x20, 0x01, 0x22, 0x00, 0x01, 0x01, 0x24, 0x01, 0x27, 0x00, 0x03,
-    0x01, 0x2a, 0x01, 0x2b, 0x00, 0x01, 0x01, 0x33, 0x01, 0x34, 0x00, 0x01, 0x01, 0x36, 0x01, 0x36,
-    0x00, 0x01, 0x01, 0x3b, 0x01, 0x3c, 0x00, 0x01, 0x01, 0x41, 0x01, 0x44, 0x00, 0x01, 0x01, 0x47,
-    0x01, 0x48, 0x00, 0x01, 0x01, 0x4b, 0x01, 0x4d, 0x00, 0x01, 0x01, 0x51, 0x01, 0x51, 0x00, 0x01,
-    0x01, 0x54, 0x01, 0x58, 0x00, 0x01, 0x01, 0x5d, 0x01, 0x5e, 0x00, 0x01, 0x01, 0x62, 0x01, 0x62,
-    0x00, 0x01, 0x01, 0x64, 0x01, 0x64, 0x00, 0x01, 0x01, 0x68, 0x01, 0x68, 0x00, 0x01, 0x01, 0x6a,
-    0x01, 0x6c, 0x00, 0x01, 0x01, 0x6e, 0x01, 0x6e, 0x00, 0x01, 0x01, 0x70, 0x01, 0x70, 0x00, 0x01,
-    0x01, 0xd5, 0x01, 0xdb, 0x00, 0x02, 0x01, 0xec, 0x02, 0x00, 0x00, 0x01, 0x02, 0x04, 0x02, 0x04,
-    0x00, 0x01, 0x02, 0x0d, 0x02, 0x0d, 0x00, 0x01, 0x02, 0x0f, 0x02, 0x0f, 0x00, 0x01, 0x02, 0x16,
-    0x02, 0x18, 0x00, 0x01, 0x02, 0x1a, 0x02, 0x1b, 0x00, 0x01, 0x02, 0x1d, 0x02, 0x1d, 0x00, 0x01,
-    0x02, 0x21, 0x02, 0x21, 0x00, 0x01, 0x02, 0x23, 0x02, 0x25, 0x00, 0x01, 0x02, 0x2b, 0x02, 0x2b,
-    0x00, 0x01, 0x02, 0x30, 0x02, 0x32, 0x00, 0x01, 0x02, 0x34, 0x02, 0x34, 0x00, 0x01, 0x02, 0x42,
-    0x02, 0x42, 0x00, 0x01, 0x02, 0x45, 0x02, 0x45, 0x00, 0x01, 0x02, 0x47, 0x02, 0x47, 0x00, 0x01,
-    0x02, 0x4a, 0x02, 0x4d, 0x00, 0x01, 0x02, 0x79, 0x02, 0x7d, 0x00, 0x01, 0x02, 0x8d, 0x02, 0x92,
-    0x00, 0x01, 0x02, 0x95, 0x02, 0xfd, 0x00, 0x01, 0x03, 0x00, 0x03, 0xbf, 0x00, 0x01, 0x03, 0xc1,
-    0x03, 0xc1, 0x00, 0x01, 0x03, 0xc3, 0x03, 0xcd, 0x00, 0x01, 0x03, 0xcf, 0x03, 0xd8, 0x00, 0x01,
-    0x03, 0xda, 0x03, 0xf5, 0x00, 0x01, 0x03, 0xf9, 0x03, 0xf9, 0x00, 0x01, 0x03, 0xfb, 0x04, 0x02,
-    0x00, 0x01, 0x04, 0x04, 0x04, 0x06, 0x00, 0x01, 0x04, 0x09, 0x04, 0x0d, 0x00, 0x01, 0x04, 0x0f,
-    0x04, 0x9a, 0x00, 0x01, 0x04, 0x9d, 0x04, 0x9e, 0x00, 0x01, 0x04, 0xa0, 0x04, 0xa1, 0x00, 0x01,
-    0x04, 0xa3, 0x04, 0xa6, 0x00, 0x01, 0x04, 0xb0, 0x05, 0x0c, 0x00, 0x01, 0x05, 0x0e, 0x05, 0x18,
-    0x00, 0x01, 0x05, 0x1b, 0x05, 0x28, 0x00, 0x01, 0x00, 0x01, 0x00, 0x03, 0x00, 0x00, 0x00, 0x2a,
-    0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x10, 0x00, 0x02, 0x00, 0x02, 0x00, 0xa8, 0x00, 0xac,
-    0x00, 0x00, 0x01, 0x24, 0x01, 0x27, 0x00, 0x05, 0x00, 0x02, 0x00, 0x01, 0x00, 0xa8, 0x00, 0xac,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0xad, 0x40, 0xff, 0x7e, 0x34, 0x7d, 0x55, 0x7c, 0x3e,
-    0xff, 0x1f, 0x7b, 0x3b, 0xff, 0x1f, 0x7a, 0x3d, 0xff, 0x1f, 0x79, 0x3b, 0x40, 0x1f, 0x78, 0x3c,
-    0xff, 0x1f, 0x77, 0x3c, 0x3d, 0x1f, 0x76, 0x35, 0x07, 0x1f, 0x75, 0x3a, 0xff, 0x1f, 0x74, 0x3a,
-    0x67, 0x1f, 0x73, 0x39, 0x4f, 0x1f, 0x72, 0x39, 0xff, 0x1f, 0x71, 0x36, 0xff, 0x1f, 0x70, 0x38,
-    0xcd, 0x1f, 0x6f, 0x38, 0xff, 0x1f, 0x6e, 0x37, 0x5e, 0x1f, 0x6d, 0x37, 0xcd, 0x1f, 0x6c, 0x37,
-    0xff, 0x1f, 0x6b, 0x37, 0x2d, 0x1f, 0x6a, 0x37, 0x18, 0x1f, 0x69, 0x34, 0xff, 0x1f, 0x68, 0x32,
-    0xff, 0x1f, 0x67, 0x32, 0xcd, 0x1f, 0x66, 0x33, 0xff, 0x1f, 0x65, 0x31, 0xff, 0x1f, 0x64, 0x30,
-    0xff, 0x1f, 0x63, 0x30, 0xab, 0x1f, 0x62, 0x30, 0x67, 0x1f, 0x61, 0x2e, 0xff, 0x1f, 0x60, 0x2e,
-    0x80, 0x1f, 0x5f, 0x2f, 0xff, 0x1f, 0x5e, 0x2f, 0x93, 0x1f, 0x5d, 0x2d, 0xff, 0x1f, 0x5c, 0x2c,
-    0xff, 0x1f, 0x5b, 0x2b, 0xff, 0x1f, 0x5a, 0x2a, 0xcd, 0x1f, 0x59, 0x2a, 0xff, 0x1f, 0x58, 0x2a,
-    0x0d, 0x1f, 0x57, 0x29, 0xff, 0x1f, 0x56, 0x28, 0xff, 0x1f, 0x55, 0x27, 0x24, 0x1f, 0x54, 0x27,
-    0x2d, 0x1f, 0x53, 0x25, 0x5e, 0x1f, 0x52, 0x25, 0xff, 0x1f, 0x51, 0x25, 0xab, 0x1f, 0x50, 0x26,
-    0xff, 0x1f, 0x4f, 0x26, 0x80, 0x1f, 0x4e, 0x24, 0xff, 0x1f, 0x4d, 0x23, 0x2b, 0x1f, 0x4c, 0x23,
-    0xab, 0x1f, 0x4b, 0x23, 0xff, 0x1f, 0x4a, 0x23, 0x56, 0x1f, 0x49, 0x23, 0x2b, 0x1f, 0x48, 0x22,
-    0xff, 0x1f, 0x47, 0x20, 0xff, 0x1f, 0x46, 0x20, 0x72, 0x1f, 0x45, 0x21, 0xff, 0x1f, 0x44, 0x21,
-    0x72, 0x1f, 0x43, 0x1f, 0xff, 0x1f, 0x42, 0x1e, 0x93, 0x1f, 0x41, 0x1e, 0xff, 0x1f, 0x40, 0x1d,
-    0xff, 0x1f, 0x3f, 0x1c, 0xff, 0x1f, 0x3d, 0x3b, 0x93, 0x40, 0xea, 0x1f, 0x3c, 0x3b, 0x34, 0x1f,
-    0x3a, 0x35, 0x0e, 0x1f, 0x39, 0x36, 0x72, 0x1f, 0x38, 0x36, 0x4f, 0x1f, 0x37, 0x36, 0x22, 0x1f,
-    0x36, 0x35, 0x93, 0x1f, 0x33, 0x32, 0x40, 0x1f, 0x31, 0x30, 0x72, 0x1f, 0x2f, 0x2e, 0x4a, 0x1f,
-    0x2b, 0x2a, 0x40, 0x1f, 0x27, 0x19, 0x04, 0x1f, 0x26, 0x25, 0x28, 0x1f, 0x25, 0x33, 0x1b, 0x19,
-    0x5c, 0x24, 0x1a, 0x12, 0x1f, 0x23, 0x05, 0x1a, 0x19, 0x5c, 0x22, 0x19, 0xff, 0x1f, 0x21, 0x20,
-    0x3d, 0x1f, 0x20, 0x38, 0x18, 0x16, 0x5c, 0x1f, 0x18, 0x2d, 0x1f, 0x1e, 0x17, 0xff, 0x1f, 0x1d,
-    0x16, 0xff, 0x1f, 0x1c, 0x16, 0x07, 0x1f, 0x1b, 0x33, 0x19, 0x1c, 0x5b, 0x18, 0x34, 0x16, 0x1c,
-    0x5b, 0x1a, 0x33, 0x19, 0x1c, 0x5b, 0x17, 0x34, 0x16, 0x1c, 0x5b, 0x15, 0x19, 0x3e, 0x16, 0xa6,
-    0x5a, 0x13, 0x31, 0x12, 0x55, 0x11, 0x31, 0x10, 0x55, 0x12, 0x59, 0x10, 0x59, 0x0d, 0x34, 0x0c,
-    0x55, 0x05, 0x34, 0x04, 0x55, 0x0c, 0x59, 0x04, 0x59, 0x1f, 0x04, 0x5f, 0x04, 0x02, 0x0f, 0x04,
-    0x7f, 0x04, 0xef, 0x04, 0x03, 0x0f, 0x5e, 0x0e, 0x55, 0x0b, 0x34, 0x0a, 0x55, 0x07, 0x34, 0x06,
-    0x55, 0x01, 0x31, 0x00, 0x55, 0x0e, 0x59, 0x0a, 0x59, 0x06, 0x59, 0x7f, 0x06, 0x01, 0x2f, 0x06,
-    0x4f, 0x06, 0x6f, 0x06, 0x03, 0x3f, 0x06, 0x5f, 0x06, 0x7f, 0x06, 0x03, 0x00, 0x59, 0x2f, 0x00,
-    0x01, 0x2f, 0x00, 0x6f, 0x00, 0xef, 0x00, 0x03, 0x09, 0x34, 0x08, 0x55, 0x03, 0x34, 0x02, 0x55,
-    0x08, 0x59, 0x02, 0x59, 0x1f, 0x02, 0x5f, 0x02, 0x02, 0x0f, 0x02, 0x7f, 0x02, 0xef, 0x02, 0x03,
-    0x03, 0x40, 0x40, 0x05, 0x01, 0xb8, 0x01, 0x90, 0xb0, 0x54, 0x2b, 0x4b, 0xb8, 0x07, 0xff, 0x52,
-    0x4b, 0xb0, 0x09, 0x50, 0x5b, 0xb0, 0x01, 0x88, 0xb0, 0x25, 0x53, 0xb0, 0x01, 0x88, 0xb0, 0x40,
-    0x51, 0x5a, 0xb0, 0x06, 0x88, 0xb0, 0x00, 0x55, 0x5a, 0x5b, 0x58, 0xb1, 0x01, 0x01, 0x8e, 0x59,
-    0x85, 0x8d, 0x8d, 0x00, 0x1d, 0x42, 0x4b, 0xb0, 0x90, 0x53, 0x58, 0xb2, 0x03, 0x00, 0x00, 0x1d,
-    0x42, 0x59, 0xb1, 0x02, 0x02, 0x43, 0x51, 0x58, 0xb1, 0x04, 0x03, 0x8e, 0x59, 0x73, 0x74, 0x00,
-    0x2b, 0x00, 0x2b, 0x2b, 0x2b, 0x73, 0x74, 0x00, 0x2b, 0x73, 0x74, 0x75, 0x00, 0x2b, 0x00, 0x2b,
-    0x00, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x73, 0x74, 0x00, 0x2b, 0x00, 0x2b, 0x2b, 0x2b, 0x00, 0x2b,
-    0x00, 0x2b, 0x2b, 0x2b, 0x01, 0x2b, 0x01, 0x2b, 0x01, 0x2b, 0x01, 0x2b, 0x01, 0x2b, 0x01, 0x2b,
-    0x2b, 0x00, 0x2b, 0x2b, 0x01, 0x2b, 0x2b, 0x01, 0x2b, 0x00, 0x2b, 0x00, 0x2b, 0x01, 0x2b, 0x2b,
-    0x2b, 0x2b, 0x2b, 0x01, 0x2b, 0x2b, 0x00, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x01, 0x2b,
-    0x2b, 0x00, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x01, 0x2b, 0x00, 0x2b, 0x2b, 0x2b, 0x2b,
-    0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x01, 0x2b, 0x2b, 0x00, 0x2b, 0x2b, 0x2b,
-    0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x01, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x00,
-    0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b,
-    0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x03,
-    0x00, 0x00, 0x00, 0x14, 0x00, 0x03, 0x00, 0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x04, 0x06, 0x70,
-    0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x0d,
-    0x00, 0x7e, 0x00, 0xa0, 0x00, 0xac, 0x00, 0xad, 0x00, 0xbf, 0x00, 0xc6, 0x00, 0xcf, 0x00, 0xe6,
-    0x00, 0xef, 0x00, 0xfe, 0x01, 0x0f, 0x01, 0x11, 0x01, 0x25, 0x01, 0x27, 0x01, 0x30, 0x01, 0x38,
-    0x01, 0x40, 0x01, 0x53, 0x01, 0x5f, 0x01, 0x67, 0x01, 0x7e, 0x01, 0x7f, 0x01, 0x8f, 0x01, 0x92,
-    0x01, 0xa1, 0x01, 0xb0, 0x01, 0xf0, 0x01, 0xfb, 0x01, 0xff, 0x02, 0x1b, 0x02, 0x37, 0x02, 0x59,
-    0x02, 0xbc, 0x02, 0xc7, 0x02, 0xc9, 0x02, 0xdd, 0x02, 0xf3, 0x03, 0x01, 0x03, 0x03, 0x03, 0x09,
-    0x03, 0x0f, 0x03, 0x23, 0x03, 0x8a, 0x03, 0x8c, 0x03, 0x92, 0x03, 0xa1, 0x03, 0xb0, 0x03, 0xb9,
-    0x03, 0xc9, 0x03, 0xce, 0x03, 0xd2, 0x03, 0xd6, 0x04, 0x25, 0x04, 0x2f, 0x04, 0x45, 0x04, 0x4f,
-    0x04, 0x62, 0x04, 0x6f, 0x04, 0x79, 0x04, 0x86, 0x04, 0x8b, 0x04, 0x9f, 0x04, 0xa9, 0x04, 0xb1,
-    0x04, 0xba, 0x04, 0xc2, 0x04, 0xca, 0x04, 0xce, 0x04, 0xd7, 0x04, 0xe1, 0x04, 0xf5, 0x05, 0x01,
-    0x05, 0x10, 0x05, 0x13, 0x1e, 0x01, 0x1e, 0x3f, 0x1e, 0x85, 0x1e, 0xf1, 0x1e, 0xf3, 0x1e, 0xf9,
-    0x1f, 0x4d, 0x20, 0x09, 0x20, 0x0b, 0x20, 0x11, 0x20, 0x15, 0x20, 0x1e, 0x20, 0x22, 0x20, 0x27,
-    0x20, 0x30, 0x20, 0x33, 0x20, 0x3a, 0x20, 0x3c, 0x20, 0x44, 0x20, 0x70, 0x20, 0x8e, 0x20, 0xa4,
-    0x20, 0xaa, 0x20, 0xac, 0x20, 0xb1, 0x20, 0xba, 0x20, 0xbd, 0x21, 0x05, 0x21, 0x13, 0x21, 0x16,
-    0x21, 0x22, 0x21, 0x26, 0x21, 0x2e, 0x21, 0x5e, 0x22, 0x02, 0x22, 0x06, 0x22, 0x0f, 0x22, 0x12,
-    0x22, 0x1a, 0x22, 0x1e, 0x22, 0x2b, 0x22, 0x48, 0x22, 0x60, 0x22, 0x65, 0x25, 0xca, 0xee, 0x02,
-    0xf6, 0xc3, 0xfb, 0x04, 0xfe, 0xff, 0xff, 0xfd, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0x00, 0x0d, 0x00, 0x20, 0x00, 0xa0, 0x00, 0xa1, 0x00, 0xad, 0x00, 0xae, 0x00, 0xc0, 0x00, 0xc7,
-    0x00, 0xd0, 0x00, 0xe7, 0x00, 0xf0, 0x00, 0xff, 0x01, 0x10, 0x01, 0x12, 0x01, 0x26, 0x01, 0x28,
-    0x01, 0x31, 0x01, 0x39, 0x01, 0x41, 0x01, 0x54, 0x01, 0x60, 0x01, 0x68, 0x01, 0x7f, 0x01, 0x8f,
-    0x01, 0x92, 0x01, 0xa0, 0x01, 0xaf, 0x01, 0xf0, 0x01, 0xfa, 0x01, 0xfc, 0x02, 0x18, 0x02, 0x37,
-    0x02, 0x59, 0x02, 0xbc, 0x02, 0xc6, 0x02, 0xc9, 0x02, 0xd8, 0x02, 0xf3, 0x03, 0x00, 0x03, 0x03,
-    0x03, 0x09, 0x03, 0x0f, 0x03, 0x23, 0x03, 0x84, 0x03, 0x8c, 0x03, 0x8e, 0x03, 0x93, 0x03, 0xa3,
-    0x03, 0xb1, 0x03, 0xba, 0x03, 0xca, 0x03, 0xd1, 0x03, 0xd6, 0x04, 0x00, 0x04, 0x26, 0x04, 0x30,
-    0x04, 0x46, 0x04, 0x50, 0x04, 0x63, 0x04, 0x70, 0x04, 0x7a, 0x04, 0x88, 0x04, 0x8c, 0x04, 0xa0,
-    0x04, 0xaa, 0x04, 0xb2, 0x04, 0xbb, 0x04, 0xc3, 0x04, 0xcb, 0x04, 0xcf, 0x04, 0xd8, 0x04, 0xe2,
-    0x04, 0xf6, 0x05, 0x02, 0x05, 0x11, 0x1e, 0x00, 0x1e, 0x3e, 0x1e, 0x80, 0x1e, 0xa0, 0x1e, 0xf2,
-    0x1e, 0xf4, 0x1f, 0x4d, 0x20, 0x00, 0x20, 0x0a, 0x20, 0x10, 0x20, 0x13, 0x20, 0x17, 0x20, 0x20,
-    0x20, 0x25, 0x20, 0x30, 0x20, 0x32, 0x20, 0x39, 0x20, 0x3c, 0x20, 0x44, 0x20, 0x70, 0x20, 0x74,
-    0x20, 0xa3, 0x20, 0xa6, 0x20, 0xab, 0x20, 0xb1, 0x20, 0xb9, 0x20, 0xbc, 0x21, 0x05, 0x21, 0x13,
-    0x21, 0x16, 0x21, 0x22, 0x21, 0x26, 0x21, 0x2e, 0x21, 0x5b, 0x22, 0x02, 0x22, 0x06, 0x22, 0x0f,
-    0x22, 0x11, 0x22, 0x1a, 0x22, 0x1e, 0x22, 0x2b, 0x22, 0x48, 0x22, 0x60, 0x22, 0x64, 0x25, 0xca,
-    0xee, 0x01, 0xf6, 0xc3, 0xfb, 0x01, 0xfe, 0xff, 0xff, 0xfc, 0xff, 0xff, 0x00, 0x01, 0x00, 0x00,
-    0xff, 0xf6, 0xff, 0xe4, 0x01, 0xf3, 0xff, 0xc2, 0x01, 0xe7, 0xff, 0xc1, 0x00, 0x00, 0x01, 0xda,
-    0x00, 0x00, 0x01, 0xd5, 0x00, 0x00, 0x01, 0xd1, 0x00, 0x00, 0x01, 0xcf, 0x00, 0x00, 0x01, 0xcd,
-    0x00, 0x00, 0x01, 0xcb, 0x00, 0x00, 0x01, 0xc5, 0x00, 0x00, 0x01, 0xc7, 0xff, 0x16, 0xff, 0x07,
-    0xff, 0x05, 0xfe, 0xf8, 0xfe, 0xeb, 0x02, 0x09, 0x00, 0x00, 0x01, 0x4a, 0x00, 0x00, 0xfe, 0x65,
-    0xfe, 0x44, 0x01, 0x3e, 0xfd, 0xd8, 0xfd, 0xd7, 0xfd, 0xc9, 0xfd, 0xb4, 0xfd, 0xa8, 0xfd, 0xa7,
-    0xfd, 0xa2, 0xfd, 0x9d, 0xfd, 0x8a, 0x00, 0x00, 0x00, 0x19, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00,
-    0xfd, 0x0a, 0x00, 0x00, 0xff, 0xf9, 0xfc, 0xfe, 0xfc, 0xfb, 0x00, 0x00, 0xfc, 0xba, 0x00, 0x00,
-    0xfc, 0xb2, 0x00, 0x00, 0xfc, 0xa7, 0x00, 0x00, 0xfc, 0xa1, 0xfc, 0xa0, 0x00, 0x00, 0xfc, 0x99,
-    0x00, 0x00, 0xfc, 0x91, 0x00, 0x00, 0xfc, 0x8b, 0x00, 0x00, 0xff, 0x43, 0x00, 0x00, 0xff, 0x40,
-    0x00, 0x00, 0xfc, 0x5e, 0x00, 0x00, 0xe5, 0xfd, 0xe5, 0xbd, 0xe5, 0x6e, 0xe5, 0x99, 0xe5, 0x02,
-    0xe5, 0x97, 0xe5, 0x98, 0xe1, 0x72, 0xe1, 0x73, 0xe1, 0x6f, 0x00, 0x00, 0xe1, 0x6c, 0xe1, 0x6b,
-    0xe1, 0x69, 0xe1, 0x61, 0xe3, 0xc4, 0xe1, 0x59, 0xe3, 0xbc, 0xe1, 0x50, 0xe1, 0x25, 0xe1, 0x22,
-    0x00, 0x00, 0xe1, 0x0c, 0x00, 0x00, 0xe1, 0x07, 0xe1, 0x00, 0xe0, 0xff, 0xe0, 0xb8, 0xe0, 0xab,
-    0xe0, 0xa9, 0xe0, 0x9e, 0xdf, 0x94, 0xe0, 0x93, 0xe0, 0x67, 0xdf, 0xc4, 0xde, 0xac, 0xdf, 0xb8,
-    0xdf, 0xb7, 0xdf, 0xb0, 0xdf, 0xad, 0xdf, 0xa1, 0xdf, 0x85, 0xdf, 0x6e, 0xdf, 0x6b, 0xdc, 0x07,
-    0x13, 0xd1, 0x0b, 0x11, 0x06, 0xd5, 0x02, 0xdd, 0x01, 0xe1, 0x00, 0x01, 0x00, 0x00, 0x00, 0xfe,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf2, 0x00, 0x00,
-    0x00, 0xfc, 0x00, 0x00, 0x01, 0x26, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00,
-    0x01, 0x40, 0x00, 0x00, 0x01, 0x4c, 0x00, 0x00, 0x01, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x6e, 0x00, 0x00, 0x01, 0x6e, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x5c, 0x00, 0x00, 0x00, 0x00, 0x01, 0x64, 0x01, 0x80,
-    0x00, 0x00, 0x01, 0x98, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xb0, 0x00, 0x00, 0x01, 0xf8,
-    0x00, 0x00, 0x02, 0x20, 0x00, 0x00, 0x02, 0x42, 0x00, 0x00, 0x00, 0x00, 0x02, 0x50, 0x00, 0x00,
-    0x02, 0x74, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0x02, 0x8c, 0x00, 0x00, 0x02, 0x90, 0x00, 0x00,
-    0x02, 0xa0, 0x00, 0x00, 0x02, 0xb4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xa4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0x94, 0x00, 0x00, 0x02, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x9a,
-    0x02, 0x9b, 0x02, 0x9c, 0x02, 0x9d, 0x02, 0x9e, 0x02, 0x9f, 0x00, 0x81, 0x02, 0x96, 0x02, 0xaa,
-    0x02, 0xab, 0x02, 0xac, 0x02, 0xad, 0x02, 0xae, 0x02, 0xaf, 0x00, 0x82, 0x00, 0x83, 0x02, 0xb0,
-    0x02, 0xb1, 0x02, 0xb2, 0x02, 0xb3, 0x02, 0xb4, 0x00, 0x84, 0x00, 0x85, 0x02, 0xb5, 0x02, 0xb6,
-    0x02, 0xb7, 0x02, 0xb8, 0x02, 0xb9, 0x02, 0xba, 0x00, 0x86, 0x00, 0x87, 0x02, 0xc5, 0x02, 0xc6,
-    0x02, 0xc7, 0x02, 0xc8, 0x02, 0xc9, 0x02, 0xca, 0x00, 0x88, 0x00, 0x89, 0x02, 0xcb, 0x02, 0xcc,
-    0x02, 0xcd, 0x02, 0xce, 0x02, 0xcf, 0x00, 0x8a, 0x02, 0x95, 0x00, 0x8b, 0x00, 0x8c, 0x02, 0x97,
-    0x00, 0x8d, 0x02, 0xfe, 0x02, 0xff, 0x03, 0x00, 0x03, 0x01, 0x03, 0x02, 0x03, 0x03, 0x00, 0x8e,
-    0x00, 0x8f, 0x00, 0x90, 0x03, 0x0c, 0x03, 0x0d, 0x03, 0x0e, 0x03, 0x0f, 0x03, 0x10, 0x03, 0x11,
-    0x03, 0x12, 0x00, 0x91, 0x00, 0x92, 0x03, 0x13, 0x03, 0x14, 0x03, 0x15, 0x03, 0x16, 0x03, 0x17,
-    0x03, 0x18, 0x00, 0x93, 0x00, 0x94, 0x03, 0x27, 0x03, 0x28, 0x03, 0x2b, 0x03, 0x2c, 0x03, 0x2d,
-    0x03, 0x2e, 0x02, 0x98, 0x02, 0x99, 0x02, 0xa0, 0x02, 0xbb, 0x03, 0x25, 0x03, 0x26, 0x03, 0x29,
-    0x03, 0x2a, 0x00, 0xae, 0x00, 0xaf, 0x03, 0xa1, 0x00, 0xb0, 0x03, 0xa2, 0x03, 0xa3, 0x03, 0xa4,
-    0x00, 0xb1, 0x00, 0xb2, 0x03, 0xab, 0x03, 0xac, 0x03, 0xad, 0x00, 0xb3, 0x03, 0xae, 0x03, 0xaf,
-    0x00, 0xb4, 0x03, 0xb0, 0x03, 0xb1, 0x00, 0xb5, 0x03, 0xb2, 0x00, 0xb6, 0x03, 0xb3, 0x00, 0xb7,
-    0x03, 0xb4, 0x03, 0xb5, 0x00, 0xb8, 0x03, 0xb6, 0x00, 0xb9, 0x00, 0xba, 0x03, 0xb7, 0x03, 0xb8,
-    0x03, 0xb9, 0x03, 0xba, 0x03, 0xbb, 0x03, 0xbc, 0x03, 0xbd, 0x03, 0xbe, 0x00, 0xc4, 0x03, 0xc0,
-    0x03, 0xc1, 0x00, 0xc5, 0x03, 0xbf, 0x00, 0xc6, 0x00, 0xc7, 0x00, 0xc8, 0x00, 0xc9, 0x00, 0xca,
-    0x00, 0xcb, 0x00, 0xcc, 0x03, 0xc2, 0x00, 0xcd, 0x00, 0xce, 0x03, 0xff, 0x03, 0xc8, 0x00, 0xd2,
-    0x03, 0xc9, 0x00, 0xd3, 0x03, 0xca, 0x03, 0xcb, 0x03, 0xcc, 0x03, 0xcd, 0x00, 0xd4, 0x00, 0xd5,
-    0x00, 0xd6, 0x03, 0xcf, 0x04, 0x00, 0x03, 0xd0, 0x00, 0xd7, 0x03, 0xd1, 0x00, 0xd8, 0x03, 0xd2,
-    0x03, 0xd3, 0x00, 0xd9, 0x03, 0xd4, 0x00, 0xda, 0x00, 0xdb, 0x00, 0xdc, 0x03, 0xd5, 0x03, 0xce,
-    0x00, 0xdd, 0x03, 0xd6, 0x03, 0xd7, 0x03, 0xd8, 0x03, 0xd9, 0x03, 0xda, 0x03, 0xdb, 0x03, 0xdc,
-    0x00, 0xde, 0x00, 0xdf, 0x03, 0xdd, 0x03, 0xde, 0x00, 0xea, 0x00, 0xeb, 0x00, 0xec, 0x00, 0xed,
-    0x03, 0xdf, 0x00, 0xee, 0x00, 0xef, 0x00, 0xf0, 0x03, 0xe0, 0x00, 0xf1, 0x00, 0xf2, 0x00, 0xf3,
-    0x00, 0xf4, 0x03, 0xe1, 0x00, 0xf5, 0x03, 0xe2, 0x03, 0xe3, 0x00, 0xf6, 0x03, 0xe4, 0x00, 0xf7,
-    0x03, 0xe5, 0x04, 0x01, 0x03, 0xe6, 0x01, 0x02, 0x03, 0xe7, 0x01, 0x03, 0x03, 0xe8, 0x03, 0xe9,
-    0x03, 0xea, 0x03, 0xeb, 0x01, 0x04, 0x01, 0x05, 0x01, 0x06, 0x03, 0xec, 0x04, 0x02, 0x03, 0xed,
-    0x01, 0x07, 0x01, 0x08, 0x01, 0x09, 0x04, 0x9c, 0x04, 0x03, 0x04, 0x04, 0x01, 0x17, 0x01, 0x18,
-    0x01, 0x19, 0x01, 0x1a, 0x04, 0x05, 0x04, 0x06, 0x04, 0x08, 0x04, 0x07, 0x04, 0x9b, 0x01, 0x2c,
-    0x01, 0x2d, 0x01, 0x2e, 0x01, 0x2f, 0x01, 0x30, 0x04, 0x9d, 0x04, 0x9e, 0x01, 0x31, 0x01, 0x32,
-    0x01, 0x33, 0x01, 0x34, 0x04, 0x09, 0x04, 0x0a, 0x01, 0x35, 0x01, 0x36, 0x01, 0x37, 0x01, 0x38,
-    0x04, 0x9f, 0x04, 0xa0, 0x04, 0x0b, 0x04, 0x0c, 0x04, 0x92, 0x04, 0x93, 0x04, 0x0d, 0x04, 0x0e,
-    0x04, 0xa1, 0x04, 0xa2, 0x04, 0x9a, 0x01, 0x4c, 0x01, 0x4d, 0x04, 0x98, 0x04, 0x99, 0x04, 0x0f,
-    0x04, 0x10, 0x04, 0x11, 0x04, 0x94, 0x04, 0x95, 0x01, 0x56, 0x01, 0x57, 0x01, 0x58, 0x04, 0x1c,
-    0x04, 0x1b, 0x04, 0x1d, 0x04, 0x1e, 0x04, 0x1f, 0x04, 0x20, 0x04, 0x21, 0x01, 0x59, 0x01, 0x5a,
-    0x04, 0x96, 0x04, 0x97, 0x04, 0x36, 0x04, 0x37, 0x01, 0x5b, 0x01, 0x5c, 0x01, 0x5d, 0x01, 0x5e,
-    0x04, 0xa3, 0x04, 0xa4, 0x01, 0x5f, 0x04, 0x38, 0x04, 0xa5, 0x01, 0x6f, 0x01, 0x70, 0x01, 0x81,
-    0x01, 0x82, 0x04, 0xa7, 0x04, 0xa6, 0x01, 0xb1, 0x04, 0x91, 0x01, 0xb7, 0x00, 0x00, 0x00, 0x3b,
-    0x02, 0xca, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x00, 0x00, 0xb2, 0x06, 0xc2, 0x00, 0x03,
-    0x00, 0x01, 0x04, 0x09, 0x00, 0x01, 0x00, 0x18, 0x06, 0xaa, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
-    0x00, 0x02, 0x00, 0x0e, 0x06, 0x9c, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x03, 0x00, 0x2e,
-    0x06, 0x6e, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x04, 0x00, 0x18, 0x06, 0xaa, 0x00, 0x03,
-    0x00, 0x01, 0x04, 0x09, 0x00, 0x05, 0x00, 0x26, 0x06, 0x48, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
-    0x00, 0x06, 0x00, 0x18, 0x06, 0x30, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x07, 0x00, 0x40,
-    0x05, 0xf0, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x08, 0x00, 0x0c, 0x05, 0xe4, 0x00, 0x03,
-    0x00, 0x01, 0x04, 0x09, 0x00, 0x09, 0x00, 0x26, 0x05, 0xbe, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
-    0x00, 0x0b, 0x00, 0x14, 0x05, 0xaa, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x0c, 0x00, 0x14,
-    0x05, 0xaa, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x0d, 0x01, 0x22, 0x04, 0x88, 0x00, 0x03,
-    0x00, 0x01, 0x04, 0x09, 0x00, 0x0e, 0x00, 0x36, 0x04, 0x52, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
-    0x00, 0x10, 0x00, 0x0c, 0x04, 0x46, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x11, 0x00, 0x0a,
-    0x04, 0x3c, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x19, 0x00, 0x0c, 0x04, 0x46, 0x00, 0x03,
-    0x00, 0x01, 0x04, 0x09, 0x01, 0x00, 0x00, 0x0c, 0x04, 0x30, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
-    0x01, 0x01, 0x00, 0x0a, 0x04, 0x26, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x01, 0x02, 0x00, 0x0c,
-    0x04, 0x1a, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x01, 0x03, 0x00, 0x08, 0x04, 0x12, 0x00, 0x03,
-    0x00, 0x01, 0x04, 0x09, 0x01, 0x04, 0x00, 0x14, 0x03, 0xfe, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
-    0x01, 0x05, 0x00, 0x0a, 0x04, 0x3c, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x01, 0x06, 0x00, 0x0e,
-    0x06, 0x9c, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x01, 0x07, 0x00, 0x0c, 0x03, 0xf2, 0x00, 0x03,
-    0x00, 0x01, 0x04, 0x09, 0x01, 0x08, 0x00, 0x10, 0x03, 0xe2, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
-    0x01, 0x09, 0x00, 0x08, 0x03, 0xda, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x01, 0x0a, 0x00, 0x12,
-    0x03, 0xc8, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x01, 0x0b, 0x00, 0x0a, 0x03, 0xbe, 0x00, 0x03,
-    0x00, 0x01, 0x04, 0x09, 0x01, 0x14, 0x00, 0x1c, 0x03, 0xa2, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
-    0x01, 0x15, 0x00, 0x28, 0x03, 0x7a, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x01, 0x16, 0x00, 0x1e,
-    0x03, 0x5c, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x01, 0x17, 0x00, 0x22, 0x03, 0x3a, 0x00, 0x03,
-    0x00, 0x01, 0x04, 0x09, 0x01, 0x18, 0x00, 0x20, 0x03, 0x1a, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
-    0x01, 0x19, 0x00, 0x24, 0x02, 0xf6, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x01, 0x1a, 0x00, 0x1c,
-    0x02, 0xda, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x01, 0x1b, 0x00, 0x26, 0x02, 0xb4, 0x00, 0x03,
-    0x00, 0x01, 0x04, 0x09, 0x01, 0x1c, 0x00, 0x1e, 0x02, 0x96, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
-    0x01, 0x26, 0x00, 0x12, 0x02, 0x84, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x01, 0x27, 0x00, 0x0c,
-    0x02, 0x78, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x01, 0x28, 0x00, 0x0a, 0x02, 0x6e, 0x00, 0x03,
-    0x00, 0x01, 0x04, 0x09, 0x01, 0x29, 0x00, 0x16, 0x02, 0x58, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
-    0x01, 0x2a, 0x00, 0x22, 0x02, 0x36, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x01, 0x2b, 0x00, 0x18,
-    0x06, 0x30, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x01, 0x2c, 0x00, 0x1c, 0x02, 0x1a, 0x00, 0x03,
-    0x00, 0x01, 0x04, 0x09, 0x01, 0x2d, 0x00, 0x1a, 0x02, 0x00, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
-    0x01, 0x2e, 0x00, 0x1e, 0x01, 0xe2, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x01, 0x2f, 0x00, 0x16,
-    0x01, 0xcc, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x01, 0x30, 0x00, 0x20, 0x01, 0xac, 0x00, 0x03,
-    0x00, 0x01, 0x04, 0x09, 0x01, 0x31, 0x00, 0x18, 0x01, 0x94, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
-    0x01, 0x3b, 0x00, 0x28, 0x01, 0x6c, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x01, 0x3c, 0x00, 0x34,
-    0x01, 0x38, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x01, 0x3d, 0x00, 0x2a, 0x01, 0x0e, 0x00, 0x03,
-    0x00, 0x01, 0x04, 0x09, 0x01, 0x3e, 0x00, 0x2e, 0x00, 0xe0, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
-    0x01, 0x3f, 0x00, 0x2c, 0x00, 0xb4, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x01, 0x40, 0x00, 0x30,
-    0x00, 0x84, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x01, 0x41, 0x00, 0x28, 0x00, 0x5c, 0x00, 0x03,
-    0x00, 0x01, 0x04, 0x09, 0x01, 0x42, 0x00, 0x32, 0x00, 0x2a, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
-    0x01, 0x43, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x52, 0x00, 0x6f, 0x00, 0x62, 0x00, 0x6f, 0x00, 0x74,
-    0x00, 0x6f, 0x00, 0x2d, 0x00, 0x43, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x64, 0x00, 0x65, 0x00, 0x6e,
-    0x00, 0x73, 0x00, 0x65, 0x00, 0x64, 0x00, 0x42, 0x00, 0x6c, 0x00, 0x61, 0x00, 0x63, 0x00, 0x6b,
-    0x00, 0x52, 0x00, 0x6f, 0x00, 0x62, 0x00, 0x6f, 0x00, 0x74, 0x00, 0x6f, 0x00, 0x2d, 0x00, 0x43,
-    0x00, 0x6f, 0x00, 0x6e, 0x00, 0x64, 0x00, 0x65, 0x00, 0x6e, 0x00, 0x73, 0x00, 0x65, 0x00, 0x64,
-    0x00, 0x45, 0x00, 0x78, 0x00, 0x74, 0x00, 0x72, 0x00, 0x61, 0x00, 0x42, 0x00, 0x6f, 0x00, 0x6c,
-    0x00, 0x64, 0x00, 0x52, 0x00, 0x6f, 0x00, 0x62, 0x00, 0x6f, 0x00, 0x74, 0x00, 0x6f, 0x00, 0x2d,
-    0x00, 0x43, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x64, 0x00, 0x65, 0x00, 0x6e, 0x00, 0x73, 0x00, 0x65,
-    0x00, 0x64, 0x00, 0x42, 0x00, 0x6f, 0x00, 0x6c, 0x00, 0x64, 0x00, 0x52, 0x00, 0x6f, 0x00, 0x62,
-    0x00, 0x6f, 0x00, 0x74, 0x00, 0x6f, 0x00, 0x2d, 0x00, 0x43, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x64,
-    0x00, 0x65, 0x00, 0x6e, 0x00, 0x73, 0x00, 0x65, 0x00, 0x64, 0x00, 0x53, 0x00, 0x65, 0x00, 0x6d,
-    0x00, 0x69, 0x00, 0x42, 0x00, 0x6f, 0x00, 0x6c, 0x00, 0x64, 0x00, 0x52, 0x00, 0x6f, 0x00, 0x62,
-    0x00, 0x6f, 0x00, 0x74, 0x00, 0x6f, 0x00, 0x2d, 0x00, 0x43, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x64,
-    0x00, 0x65, 0x00, 0x6e, 0x00, 0x73, 0x00, 0x65, 0x00, 0x64, 0x00, 0x4d, 0x00, 0x65, 0x00, 0x64,
-    0x00, 0x69, 0x00, 0x75, 0x00, 0x6d, 0x00, 0x52, 0x00, 0x6f, 0x00, 0x62, 0x00, 0x6f, 0x00, 0x74,
-    0x00, 0x6f, 0x00, 0x2d, 0x00, 0x43, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x64, 0x00, 0x65, 0x00, 0x6e,
-    0x00, 0x73, 0x00, 0x65, 0x00, 0x64, 0x00, 0x52, 0x00, 0x65, 0x00, 0x67, 0x00, 0x75, 0x00, 0x6c,
-    0x00, 0x61, 0x00, 0x72, 0x00, 0x52, 0x00, 0x6f, 0x00, 0x62, 0x00, 0x6f, 0x00, 0x74, 0x00, 0x6f,
-    0x00, 0x2d, 0x00, 0x43, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x64, 0x00, 0x65, 0x00, 0x6e, 0x00, 0x73,
-    0x00, 0x65, 0x00, 0x64, 0x00, 0x4c, 0x00, 0x69, 0x00, 0x67, 0x00, 0x68, 0x00, 0x74, 0x00, 0x52,
-    0x00, 0x6f, 0x00, 0x62, 0x00, 0x6f, 0x00, 0x74, 0x00, 0x6f, 0x00, 0x2d, 0x00, 0x43, 0x00, 0x6f,
-    0x00, 0x6e, 0x00, 0x64, 0x00, 0x65, 0x00, 0x6e, 0x00, 0x73, 0x00, 0x65, 0x00, 0x64, 0x00, 0x45,
-    0x00, 0x78, 0x00, 0x74, 0x00, 0x72, 0x00, 0x61, 0x00, 0x4c, 0x00, 0x69, 0x00, 0x67, 0x00, 0x68,
-    0x00, 0x74, 0x00, 0x52, 0x00, 0x6f, 0x00, 0x62, 0x00, 0x6f, 0x00, 0x74, 0x00, 0x6f, 0x00, 0x2d,
-    0x00, 0x43, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x64, 0x00, 0x65, 0x00, 0x6e, 0x00, 0x73, 0x00, 0x65,
-    0x00, 0x64, 0x00, 0x54, 0x00, 0x68, 0x00, 0x69, 0x00, 0x6e, 0x00, 0x52, 0x00, 0x6f, 0x00, 0x62,
-    0x00, 0x6f, 0x00, 0x74, 0x00, 0x6f, 0x00, 0x2d, 0x00, 0x42, 0x00, 0x6c, 0x00, 0x61, 0x00, 0x63,
-    0x00, 0x6b, 0x00, 0x52, 0x00, 0x6f, 0x00, 0x62, 0x00, 0x6f, 0x00, 0x74, 0x00, 0x6f, 0x00, 0x2d,
-    0x00, 0x45, 0x00, 0x78, 0x00, 0x74, 0x00, 0x72, 0x00, 0x61, 0x00, 0x42, 0x00, 0x6f, 0x00, 0x6c,
-    0x00, 0x64, 0x00, 0x52, 0x00, 0x6f, 0x00, 0x62, 0x00, 0x6f, 0x00, 0x74, 0x00, 0x6f, 0x00, 0x2d,
-    0x00, 0x42, 0x00, 0x6f, 0x00, 0x6c, 0x00, 0x64, 0x00, 0x52, 0x00, 0x6f, 0x00, 0x62, 0x00, 0x6f,
-    0x00, 0x74, 0x00, 0x6f, 0x00, 0x2d, 0x00, 0x53, 0x00, 0x65, 0x00, 0x6d, 0x00, 0x69, 0x00, 0x42,
-    0x00, 0x6f, 0x00, 0x6c, 0x00, 0x64, 0x00, 0x52, 0x00, 0x6f, 0x00, 0x62, 0x00, 0x6f, 0x00, 0x74,
-    0x00, 0x6f, 0x00, 0x2d, 0x00, 0x4d, 0x00, 0x65, 0x00, 0x64, 0x00, 0x69, 0x00, 0x75, 0x00, 0x6d,
-    0x00, 0x52, 0x00, 0x6f, 0x00, 0x62, 0x00, 0x6f, 0x00, 0x74, 0x00, 0x6f, 0x00, 0x2d, 0x00, 0x52,
-    0x00, 0x65, 0x00, 0x67, 0x00, 0x75, 0x00, 0x6c, 0x00, 0x61, 0x00, 0x72, 0x00, 0x52, 0x00, 0x6f,
-    0x00, 0x62, 0x00, 0x6f, 0x00, 0x74, 0x00, 0x6f, 0x00, 0x2d, 0x00, 0x45, 0x00, 0x78, 0x00, 0x74,
-    0x00, 0x72, 0x00, 0x61, 0x00, 0x4c, 0x00, 0x69, 0x00, 0x67, 0x00, 0x68, 0x00, 0x74, 0x00, 0x52,
-    0x00, 0x6f, 0x00, 0x62, 0x00, 0x6f, 0x00, 0x74, 0x00, 0x6f, 0x00, 0x2d, 0x00, 0x54, 0x00, 0x68,
-    0x00, 0x69, 0x00, 0x6e, 0x00, 0x52, 0x00, 0x6f, 0x00, 0x6d, 0x00, 0x61, 0x00, 0x6e, 0x00, 0x4e,
-    0x00, 0x6f, 0x00, 0x72, 0x00, 0x6d, 0x00, 0x61, 0x00, 0x6c, 0x00, 0x43, 0x00, 0x6f, 0x00, 0x6e,
-    0x00, 0x64, 0x00, 0x65, 0x00, 0x6e, 0x00, 0x73, 0x00, 0x65, 0x00, 0x64, 0x00, 0x43, 0x00, 0x6f,
-    0x00, 0x6e, 0x00, 0x64, 0x00, 0x65, 0x00, 0x6e, 0x00, 0x73, 0x00, 0x65, 0x00, 0x64, 0x00, 0x20,
-    0x00, 0x42, 0x00, 0x6c, 0x00, 0x61, 0x00, 0x63, 0x00, 0x6b, 0x00, 0x43, 0x00, 0x6f, 0x00, 0x6e,
-    0x00, 0x64, 0x00, 0x65, 0x00, 0x6e, 0x00, 0x73, 0x00, 0x65, 0x00, 0x64, 0x00, 0x20, 0x00, 0x45,
-    0x00, 0x78, 0x00, 0x74, 0x00, 0x72, 0x00, 0x61, 0x00, 0x42, 0x00, 0x6f, 0x00, 0x6c, 0x00, 0x64,
-    0x00, 0x43, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x64, 0x00, 0x65, 0x00, 0x6e, 0x00, 0x73, 0x00, 0x65,
-    0x00, 0x64, 0x00, 0x20, 0x00, 0x42, 0x00, 0x6f, 0x00, 0x6c, 0x00, 0x64, 0x00, 0x43, 0x00, 0x6f,
-    0x00, 0x6e, 0x00, 0x64, 0x00, 0x65, 0x00, 0x6e, 0x00, 0x73, 0x00, 0x65, 0x00, 0x64, 0x00, 0x20,
-    0x00, 0x53, 0x00, 0x65, 0x00, 0x6d, 0x00, 0x69, 0x00, 0x42, 0x00, 0x6f, 0x00, 0x6c, 0x00, 0x64,
-    0x00, 0x43, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x64, 0x00, 0x65, 0x00, 0x6e, 0x00, 0x73, 0x00, 0x65,
-    0x00, 0x64, 0x00, 0x20, 0x00, 0x4d, 0x00, 0x65, 0x00, 0x64, 0x00, 0x69, 0x00, 0x75, 0x00, 0x6d,
-    0x00, 0x43, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x64, 0x00, 0x65, 0x00, 0x6e, 0x00, 0x73, 0x00, 0x65,
-    0x00, 0x64, 0x00, 0x20, 0x00, 0x52, 0x00, 0x65, 0x00, 0x67, 0x00, 0x75, 0x00, 0x6c, 0x00, 0x61,
-    0x00, 0x72, 0x00, 0x43, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x64, 0x00, 0x65, 0x00, 0x6e, 0x00, 0x73,
-    0x00, 0x65, 0x00, 0x64, 0x00, 0x20, 0x00, 0x4c, 0x00, 0x69, 0x00, 0x67, 0x00, 0x68, 0x00, 0x74,
-    0x00, 0x43, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x64, 0x00, 0x65, 0x00, 0x6e, 0x00, 0x73, 0x00, 0x65,
-    0x00, 0x64, 0x00, 0x20, 0x00, 0x45, 0x00, 0x78, 0x00, 0x74, 0x00, 0x72, 0x00, 0x61, 0x00, 0x4c,
-    0x00, 0x69, 0x00, 0x67, 0x00, 0x68, 0x00, 0x74, 0x00, 0x43, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x64,
-    0x00, 0x65, 0x00, 0x6e, 0x00, 0x73, 0x00, 0x65, 0x00, 0x64, 0x00, 0x20, 0x00, 0x54, 0x00, 0x68,
-    0x00, 0x69, 0x00, 0x6e, 0x00, 0x42, 0x00, 0x6c, 0x00, 0x61, 0x00, 0x63, 0x00, 0x6b, 0x00, 0x45,
-    0x00, 0x78, 0x00, 0x74, 0x00, 0x72, 0x00, 0x61, 0x00, 0x42, 0x00, 0x6f, 0x00, 0x6c, 0x00, 0x64,
-    0x00, 0x42, 0x00, 0x6f, 0x00, 0x6c, 0x00, 0x64, 0x00, 0x53, 0x00, 0x65, 0x00, 0x6d, 0x00, 0x69,
-    0x00, 0x42, 0x00, 0x6f, 0x00, 0x6c, 0x00, 0x64, 0x00, 0x4d, 0x00, 0x65, 0x00, 0x64, 0x00, 0x69,
-    0x00, 0x75, 0x00, 0x6d, 0x00, 0x45, 0x00, 0x78, 0x00, 0x74, 0x00, 0x72, 0x00, 0x61, 0x00, 0x4c,
-    0x00, 0x69, 0x00, 0x67, 0x00, 0x68, 0x00, 0x74, 0x00, 0x54, 0x00, 0x68, 0x00, 0x69, 0x00, 0x6e,
-    0x00, 0x49, 0x00, 0x74, 0x00, 0x61, 0x00, 0x6c, 0x00, 0x69, 0x00, 0x63, 0x00, 0x57, 0x00, 0x69,
-    0x00, 0x64, 0x00, 0x74, 0x00, 0x68, 0x00, 0x57, 0x00, 0x65, 0x00, 0x69, 0x00, 0x67, 0x00, 0x68,
-    0x00, 0x74, 0x00, 0x4c, 0x00, 0x69, 0x00, 0x67, 0x00, 0x68, 0x00, 0x74, 0x00, 0x52, 0x00, 0x6f,
-    0x00, 0x62, 0x00, 0x6f, 0x00, 0x74, 0x00, 0x6f, 0x00, 0x68, 0x00, 0x74, 0x00, 0x74, 0x00, 0x70,
-    0x00, 0x73, 0x00, 0x3a, 0x00, 0x2f, 0x00, 0x2f, 0x00, 0x6f, 0x00, 0x70, 0x00, 0x65, 0x00, 0x6e,
-    0x00, 0x66, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x74, 0x00, 0x6c, 0x00, 0x69, 0x00, 0x63, 0x00, 0x65,
-    0x00, 0x6e, 0x00, 0x73, 0x00, 0x65, 0x00, 0x2e, 0x00, 0x6f, 0x00, 0x72, 0x00, 0x67, 0x00, 0x54,
-    0x00, 0x68, 0x00, 0x69, 0x00, 0x73, 0x00, 0x20, 0x00, 0x46, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x74,
-    0x00, 0x20, 0x00, 0x53, 0x00, 0x6f, 0x00, 0x66, 0x00, 0x74, 0x00, 0x77, 0x00, 0x61, 0x00, 0x72,
-    0x00, 0x65, 0x00, 0x20, 0x00, 0x69, 0x00, 0x73, 0x00, 0x20, 0x00, 0x6c, 0x00, 0x69, 0x00, 0x63,
-    0x00, 0x65, 0x00, 0x6e, 0x00, 0x73, 0x00, 0x65, 0x00, 0x64, 0x00, 0x20, 0x00, 0x75, 0x00, 0x6e,
-    0x00, 0x64, 0x00, 0x65, 0x00, 0x72, 0x00, 0x20, 0x00, 0x74, 0x00, 0x68, 0x00, 0x65, 0x00, 0x20,
-    0x00, 0x53, 0x00, 0x49, 0x00, 0x4c, 0x00, 0x20, 0x00, 0x4f, 0x00, 0x70, 0x00, 0x65, 0x00, 0x6e,
-    0x00, 0x20, 0x00, 0x46, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x74, 0x00, 0x20, 0x00, 0x4c, 0x00, 0x69,
-    0x00, 0x63, 0x00, 0x65, 0x00, 0x6e, 0x00, 0x73, 0x00, 0x65, 0x00, 0x2c, 0x00, 0x20, 0x00, 0x56,
-    0x00, 0x65, 0x00, 0x72, 0x00, 0x73, 0x00, 0x69, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x20, 0x00, 0x31,
-    0x00, 0x2e, 0x00, 0x31, 0x00, 0x2e, 0x00, 0x20, 0x00, 0x54, 0x00, 0x68, 0x00, 0x69, 0x00, 0x73,
-    0x00, 0x20, 0x00, 0x6c, 0x00, 0x69, 0x00, 0x63, 0x00, 0x65, 0x00, 0x6e, 0x00, 0x73, 0x00, 0x65,
-    0x00, 0x20, 0x00, 0x69, 0x00, 0x73, 0x00, 0x20, 0x00, 0x61, 0x00, 0x76, 0x00, 0x61, 0x00, 0x69,
-    0x00, 0x6c, 0x00, 0x61, 0x00, 0x62, 0x00, 0x6c, 0x00, 0x65, 0x00, 0x20, 0x00, 0x77, 0x00, 0x69,
-    0x00, 0x74, 0x00, 0x68, 0x00, 0x20, 0x00, 0x61, 0x00, 0x20, 0x00, 0x46, 0x00, 0x41, 0x00, 0x51,
-    0x00, 0x20, 0x00, 0x61, 0x00, 0x74, 0x00, 0x3a, 0x00, 0x20, 0x00, 0x68, 0x00, 0x74, 0x00, 0x74,
-    0x00, 0x70, 0x00, 0x73, 0x00, 0x3a, 0x00, 0x2f, 0x00, 0x2f, 0x00, 0x6f, 0x00, 0x70, 0x00, 0x65,
-    0x00, 0x6e, 0x00, 0x66, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x74, 0x00, 0x6c, 0x00, 0x69, 0x00, 0x63,
-    0x00, 0x65, 0x00, 0x6e, 0x00, 0x73, 0x00, 0x65, 0x00, 0x2e, 0x00, 0x6f, 0x00, 0x72, 0x00, 0x67,
-    0x00, 0x47, 0x00, 0x6f, 0x00, 0x6f, 0x00, 0x67, 0x00, 0x6c, 0x00, 0x65, 0x00, 0x2e, 0x00, 0x63,
-    0x00, 0x6f, 0x00, 0x6d, 0x00, 0x43, 0x00, 0x68, 0x00, 0x72, 0x00, 0x69, 0x00, 0x73, 0x00, 0x74,
-    0x00, 0x69, 0x00, 0x61, 0x00, 0x6e, 0x00, 0x20, 0x00, 0x52, 0x00, 0x6f, 0x00, 0x62, 0x00, 0x65,
-    0x00, 0x72, 0x00, 0x74, 0x00, 0x73, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x47, 0x00, 0x6f, 0x00, 0x6f,
-    0x00, 0x67, 0x00, 0x6c, 0x00, 0x65, 0x00, 0x52, 0x00, 0x6f, 0x00, 0x62, 0x00, 0x6f, 0x00, 0x74,
-    0x00, 0x6f, 0x00, 0x20, 0x00, 0x69, 0x00, 0x73, 0x00, 0x20, 0x00, 0x61, 0x00, 0x20, 0x00, 0x74,
-    0x00, 0x72, 0x00, 0x61, 0x00, 0x64, 0x00, 0x65, 0x00, 0x6d, 0x00, 0x61, 0x00, 0x72, 0x00, 0x6b,
-    0x00, 0x20, 0x00, 0x6f, 0x00, 0x66, 0x00, 0x20, 0x00, 0x47, 0x00, 0x6f, 0x00, 0x6f, 0x00, 0x67,
-    0x00, 0x6c, 0x00, 0x65, 0x00, 0x2e, 0x00, 0x52, 0x00, 0x6f, 0x00, 0x62, 0x00, 0x6f, 0x00, 0x74,
-    0x00, 0x6f, 0x00, 0x2d, 0x00, 0x4c, 0x00, 0x69, 0x00, 0x67, 0x00, 0x68, 0x00, 0x74, 0x00, 0x56,
-    0x00, 0x65, 0x00, 0x72, 0x00, 0x73, 0x00, 0x69, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x20, 0x00, 0x33,
-    0x00, 0x2e, 0x00, 0x30, 0x00, 0x30, 0x00, 0x39, 0x00, 0x3b, 0x00, 0x20, 0x00, 0x32, 0x00, 0x30,
-    0x00, 0x32, 0x00, 0x34, 0x00, 0x33, 0x00, 0x2e, 0x00, 0x30, 0x00, 0x30, 0x00, 0x39, 0x00, 0x3b,
-    0x00, 0x47, 0x00, 0x4f, 0x00, 0x4f, 0x00, 0x47, 0x00, 0x3b, 0x00, 0x52, 0x00, 0x6f, 0x00, 0x62,
-    0x00, 0x6f, 0x00, 0x74, 0x00, 0x6f, 0x00, 0x2d, 0x00, 0x4c, 0x00, 0x69, 0x00, 0x67, 0x00, 0x68,
-    0x00, 0x74, 0x00, 0x52, 0x00, 0x65, 0x00, 0x67, 0x00, 0x75, 0x00, 0x6c, 0x00, 0x61, 0x00, 0x72,
-    0x00, 0x52, 0x00, 0x6f, 0x00, 0x62, 0x00, 0x6f, 0x00, 0x74, 0x00, 0x6f, 0x00, 0x20, 0x00, 0x4c,
-    0x00, 0x69, 0x00, 0x67, 0x00, 0x68, 0x00, 0x74, 0x00, 0x43, 0x00, 0x6f, 0x00, 0x70, 0x00, 0x79,
-    0x00, 0x72, 0x00, 0x69, 0x00, 0x67, 0x00, 0x68, 0x00, 0x74, 0x00, 0x20, 0x00, 0x32, 0x00, 0x30,
-    0x00, 0x31, 0x00, 0x31, 0x00, 0x20, 0x00, 0x54, 0x00, 0x68, 0x00, 0x65, 0x00, 0x20, 0x00, 0x52,
-    0x00, 0x6f, 0x00, 0x62, 0x00, 0x6f, 0x00, 0x74, 0x00, 0x6f, 0x00, 0x20, 0x00, 0x50, 0x00, 0x72,
-    0x00, 0x6f, 0x00, 0x6a, 0x00, 0x65, 0x00, 0x63, 0x00, 0x74, 0x00, 0x20, 0x00, 0x41, 0x00, 0x75,
-    0x00, 0x74, 0x00, 0x68, 0x00, 0x6f, 0x00, 0x72, 0x00, 0x73, 0x00, 0x20, 0x00, 0x28, 0x00, 0x68,
-    0x00, 0x74, 0x00, 0x74, 0x00, 0x70, 0x00, 0x73, 0x00, 0x3a, 0x00, 0x2f, 0x00, 0x2f, 0x00, 0x67,
-    0x00, 0x69, 0x00, 0x74, 0x00, 0x68, 0x00, 0x75, 0x00, 0x62, 0x00, 0x2e, 0x00, 0x63, 0x00, 0x6f,
-    0x00, 0x6d, 0x00, 0x2f, 0x00, 0x67, 0x00, 0x6f, 0x00, 0x6f, 0x00, 0x67, 0x00, 0x6c, 0x00, 0x65,
-    0x00, 0x66, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x74, 0x00, 0x73, 0x00, 0x2f, 0x00, 0x72, 0x00, 0x6f,
-    0x00, 0x62, 0x00, 0x6f, 0x00, 0x74, 0x00, 0x6f, 0x00, 0x2d, 0x00, 0x63, 0x00, 0x6c, 0x00, 0x61,
-    0x00, 0x73, 0x00, 0x73, 0x00, 0x69, 0x00, 0x63, 0x00, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32,
-    0x00, 0x32, 0x00, 0x32, 0x00, 0x32, 0x00, 0x32, 0x00, 0x5a, 0x00, 0x7a, 0x00, 0xb1, 0x01, 0x25,
-    0x01, 0xa6, 0x02, 0x1a, 0x02, 0x2e, 0x02, 0x5e, 0x02, 0x8e, 0x02, 0xbb, 0x02, 0xd8, 0x02, 0xf2,
-    0x03, 0x03, 0x03, 0x1e, 0x03, 0x32, 0x03, 0x7f, 0x03, 0x98, 0x03, 0xd7, 0x04, 0x3e, 0x04, 0x69,
-    0x04, 0xb6, 0x05, 0x10, 0x05, 0x2d, 0x05, 0x9c, 0x05, 0xf6, 0x06, 0x02, 0x06, 0x0e, 0x06, 0x34,
-    0x06, 0x4f, 0x06, 0x75, 0x06, 0xc6, 0x07, 0x70, 0x07, 0xa7, 0x08, 0x07, 0x08, 0x4b, 0x08, 0x89,
-    0x08, 0xb9, 0x08, 0xe2, 0x09, 0x2f, 0x09, 0x57, 0x09, 0x6b, 0x09, 0x96, 0x09, 0xc9, 0x09, 0xe7,
-    0x0a, 0x1a, 0x0a, 0x3d, 0x0a, 0x85, 0x0a, 0xb8, 0x0b, 0x0d, 0x0b, 0x52, 0x0b, 0xb1, 0x0b, 0xcf,
-    0x0b, 0xfd, 0x0c, 0x24, 0x0c, 0x67, 0x0c, 0x94, 0x0c, 0xb8, 0x0c, 0xe5, 0x0c, 0xfe, 0x0d, 0x12,
-    0x0d, 0x2b, 0x0d, 0x50, 0x0d, 0x60, 0x0d, 0x73, 0x0d, 0xdc, 0x0e, 0x30, 0x0e, 0x76, 0x0e, 0xca,
-    0x0f, 0x17, 0x0f, 0x47, 0x0f, 0xb0, 0x0f, 0xe8, 0x10, 0x0e, 0x10, 0x47, 0x10, 0x7a, 0x10, 0x8e,
-    0x10, 0xea, 0x11, 0x24, 0x11, 0x6a, 0x11, 0xbe, 0x12, 0x13, 0x12, 0x47, 0x12, 0x9e, 0x12, 0xce,
-    0x13, 0x05, 0x13, 0x2c, 0x13, 0x70, 0x13, 0x9d, 0x13, 0xd9, 0x14, 0x05, 0x14, 0x4b, 0x14, 0x5d,
-    0x14, 0xa4, 0x14, 0xe3, 0x15, 0x07, 0x15, 0x61, 0x15, 0xad, 0x16, 0x0e, 0x16, 0x56, 0x16, 0x70,
-    0x17, 0x02, 0x17, 0x2f, 0x17, 0xa7, 0x17, 0xfd, 0x18, 0x09, 0x18, 0x26, 0x18, 0xc0, 0x18, 0xd1,
-    0x19, 0x04, 0x19, 0x29, 0x19, 0x60, 0x19, 0xbe, 0x19, 0xd1, 0x1a, 0x10, 0x1a, 0x2e, 0x1a, 0x48,
-    0x1a, 0x71, 0x1a, 0x88, 0x1a, 0xc6, 0x1a, 0xd2, 0x1a, 0xe3, 0x1a, 0xf4, 0x1b, 0x05, 0x1b, 0x55,
-    0x1b, 0xa2, 0x1b, 0xc0, 0x1c, 0x17, 0x1c, 0x50, 0x1c, 0xad, 0x1d, 0x4b, 0x1d, 0xad, 0x1d, 0xe4,
-    0x1e, 0x38, 0x1e, 0x8d, 0x1e, 0xea, 0x1f, 0x1b, 0x1f, 0x2f, 0x1f, 0x61, 0x1f, 0x8a, 0x1f, 0xa9,
-    0x1f, 0xe5, 0x20, 0x32, 0x20, 0x9d, 0x21, 0x26, 0x21, 0x4c, 0x21, 0x98, 0x21, 0xe7, 0x22, 0x46,
-    0x22, 0x9d, 0x22, 0xdc, 0x23, 0x26, 0x23, 0x4c, 0x23, 0x96, 0x23, 0xb5, 0x23, 0xd2, 0x23, 0xda,
-    0x23, 0xfc, 0x24, 0x17, 0x24, 0x47, 0x24, 0x72, 0x24, 0xae, 0x24, 0xcc, 0x24, 0xf8, 0x25, 0x0c,
-    0x25, 0x20, 0x25, 0x29, 0x25, 0x54, 0x25, 0x71, 0x25, 0x8b, 0x25, 0x9e, 0x25, 0xd8, 0x25, 0xe0,
-    0x25, 0xf7, 0x26, 0x26, 0x26, 0x7d, 0x26, 0xa4, 0x26, 0xcb, 0x26, 0xe8, 0x27, 0x1c, 0x27, 0x6f,
-    0x27, 0xac, 0x28, 0x0b, 0x28, 0x75, 0x28, 0xd7, 0x29, 0x05, 0x29, 0x6f, 0x29, 0xd5, 0x2a, 0x26,
-    0x2a, 0x60, 0x2a, 0xbb, 0x2a, 0xe1, 0x2b, 0x34, 0x2b, 0xa4, 0x2b, 0xdd, 0x2c, 0x2b, 0x2c, 0x75,
-    0x2c, 0xc8, 0x2c, 0xf8, 0x2d, 0x30, 0x2d, 0x81, 0x2d, 0xc1, 0x2e, 0x28, 0x2e, 0x87, 0x2e, 0xdd,
-    0x2f, 0x50, 0x2f, 0x99, 0x2f, 0xe9, 0x30, 0x46, 0x30, 0x8e, 0x30, 0xcd, 0x30, 0xf1, 0x31, 0x34,
-    0x31, 0x87, 0x31, 0xd2, 0x32, 0x39, 0x32, 0x5b, 0x32, 0x94, 0x32, 0xd1, 0x33, 0x22, 0x33, 0x4b,
-    0x33, 0x81, 0x33, 0xa6, 0x33, 0xd7, 0x34, 0x14, 0x34, 0x53, 0x34, 0x88, 0x34, 0xd8, 0x35, 0x36,
-    0x35, 0x75, 0x35, 0xe3, 0x36, 0x48, 0x36, 0x5f, 0x36, 0xa4, 0x36, 0xf3, 0x37, 0x57, 0x37, 0x79,
-    0x37, 0xab, 0x37, 0xe3, 0x38, 0x12, 0x38, 0x3a, 0x38, 0x60, 0x38, 0x7c, 0x39, 0x10, 0x39, 0x38,
-    0x39, 0x6c, 0x39, 0x91, 0x39, 0xc2, 0x3a, 0x00, 0x3a, 0x3e, 0x3a, 0x73, 0x3a, 0xc1, 0x3b, 0x1f,
-    0x3b, 0x5f, 0x3b, 0xba, 0x3c, 0x08, 0x3c, 0x63, 0x3c, 0xac, 0x3c, 0xec, 0x3d, 0x11, 0x3d, 0x66,
-    0x3d, 0xbc, 0x3d, 0xfb, 0x3e, 0x54, 0x3e, 0xae, 0x3e, 0xe9, 0x3f, 0x22, 0x3f, 0x74, 0x3f, 0xc3,
-    0x40, 0x26, 0x40, 0x87, 0x40, 0xfd, 0x41, 0x74, 0x41, 0xf0, 0x42, 0x6b, 0x42, 0xce, 0x43, 0x20,
-    0x43, 0x56, 0x43, 0x8f, 0x43, 0xf2, 0x44, 0x51, 0x44, 0xf5, 0x45, 0x98, 0x46, 0x00, 0x46, 0x69,
-    0x46, 0xac, 0x46, 0xed, 0x47, 0x1d, 0x47, 0x39, 0x47, 0x64, 0x47, 0x79, 0x47, 0x8e, 0x48, 0x26,
-    0x48, 0x77, 0x48, 0x93, 0x48, 0xaf, 0x48, 0xea, 0x49, 0x2d, 0x49, 0x92, 0x49, 0xb4, 0x49, 0xd6,
-    0x4a, 0x11, 0x4a, 0x4c, 0x4a, 0x5f, 0x4a, 0x72, 0x4a, 0x7e, 0x4a, 0x91, 0x4a, 0xcf, 0x4b, 0x0c,
-    0x4b, 0x46, 0x4b, 0x80, 0x4b, 0x93, 0x4b, 0xa6, 0x4b, 0xd7, 0x4c, 0x08, 0x4c, 0x47, 0x4c, 0x90,
-    0x4c, 0xfb, 0x4d, 0x62, 0x4d, 0x75, 0x4d, 0x88, 0x4d, 0xba, 0x4d, 0xed, 0x4e, 0x00, 0x4e, 0x13,
-    0x4e, 0x57, 0x4e, 0x99, 0x4e, 0xcf, 0x4f, 0x30, 0x4f, 0x8e, 0x4f, 0xd7, 0x50, 0x1e, 0x50, 0x31,
-    0x50, 0x44, 0x50, 0x7b, 0x50, 0xb4, 0x50, 0xc7, 0x50, 0xda, 0x50, 0xed, 0x51, 0x00, 0x51, 0x4d,
-    0x51, 0x98, 0x51, 0xe3, 0x51, 0xf2, 0x52, 0x01, 0x52, 0x0d, 0x52, 0x19, 0x52, 0x4b, 0x52, 0xa1,
-    0x53, 0x17, 0x53, 0x8c, 0x54, 0x01, 0x54, 0x6c, 0x54, 0xd8, 0x55, 0x36, 0x55, 0x95, 0x55, 0xe1,
-    0x56, 0x30, 0x56, 0x7c, 0x56, 0xc6, 0x57, 0x07, 0x57, 0x49, 0x57, 0xb1, 0x57, 0xbd, 0x57, 0xc9,
-    0x57, 0xf1, 0x57, 0xf1, 0x57, 0xf1, 0x57, 0xf1, 0x57, 0xf1, 0x57, 0xf1, 0x57, 0xf1, 0x57, 0xf1,
-    0x57, 0xf1, 0x57, 0xf1, 0x57, 0xf1, 0x57, 0xf1, 0x57, 0xf1, 0x57, 0xf1, 0x57, 0xf9, 0x58, 0x01,
-    0x58, 0x12, 0x58, 0x23, 0x58, 0x3d, 0x58, 0x57, 0x58, 0x72, 0x58, 0x8c, 0x58, 0xa6, 0x58, 0xb2,
-    0x58, 0xbe, 0x58, 0xe9, 0x59, 0x08, 0x59, 0x32, 0x59, 0x4e, 0x59, 0x5a, 0x59, 0x6a, 0x59, 0x84,
-    0x5a, 0x38, 0x5a, 0x5c, 0x5a, 0x7c, 0x5a, 0x93, 0x5a, 0x9c, 0x5a, 0xa5, 0x5a, 0xae, 0x5a, 0xb7,
-    0x5a, 0xc0, 0x5a, 0xc9, 0x5a, 0xd2, 0x5a, 0xf1, 0x5b, 0x02, 0x5b, 0x1c, 0x5b, 0x46, 0x5b, 0x71,
-    0x5b, 0xa5, 0x5b, 0xae, 0x5b, 0xb7, 0x5b, 0xc0, 0x5b, 0xc9, 0x5b, 0xd2, 0x5b, 0xdb, 0x5b, 0xe4,
-    0x5b, 0xed, 0x5b, 0xf6, 0x5b, 0xff, 0x5c, 0x08, 0x5c, 0x11, 0x5c, 0x1a, 0x5c, 0x41, 0x5c, 0x68,
-    0x5c, 0xbb, 0x5c, 0xf2, 0x5d, 0x4b, 0x5d, 0x57, 0x5d, 0xaf, 0x5d, 0xf5, 0x5e, 0x47, 0x5e, 0x91,
-    0x5e, 0xe1, 0x5f, 0x1e, 0x5f, 0x59, 0x5f, 0x94, 0x60, 0x12, 0x60, 0x5c, 0x60, 0xbc, 0x60, 0xf5,
-    0x61, 0x3d, 0x61, 0x53, 0x61, 0x64, 0x61, 0x7a, 0x61, 0x90, 0x61, 0xf5, 0x62, 0x0f, 0x62, 0x42,
-    0x62, 0x53, 0x62, 0x7e, 0x63, 0x0c, 0x63, 0x46, 0x63, 0xa5, 0x63, 0xd2, 0x64, 0x05, 0x64, 0x38,
-    0x64, 0x6c, 0x64, 0x79, 0x64, 0x95, 0x64, 0xaf, 0x64, 0xbb, 0x64, 0xf2, 0x65, 0x2e, 0x65, 0x8a,
-    0x65, 0xed, 0x66, 0x48, 0x66, 0xef, 0x66, 0xef, 0x67, 0xe5, 0x68, 0x2b, 0x68, 0x60, 0x68, 0x84,
-    0x68, 0xc1, 0x69, 0x13, 0x69, 0x84, 0x69, 0x9e, 0x69, 0xee, 0x6a, 0x32, 0x6a, 0x59, 0x6a, 0xbb,
-    0x6a, 0xf5, 0x6b, 0x0d, 0x6b, 0x53, 0x6b, 0x7f, 0x6b, 0xb0, 0x6b, 0xdb, 0x6c, 0x1f, 0x6c, 0x42,
-    0x6c, 0x6e, 0x6c, 0x8a, 0x6c, 0xe6, 0x6d, 0x26, 0x6d, 0x7b, 0x6d, 0xad, 0x6d, 0xf3, 0x6e, 0x13,
-    0x6e, 0x43, 0x6e, 0x5e, 0x6e, 0x8d, 0x6e, 0xb5, 0x6e, 0xc7, 0x6e, 0xee, 0x6f, 0x37, 0x6f, 0x60,
-    0x6f, 0xd3, 0x70, 0x20, 0x70, 0x5e, 0x70, 0x79, 0x70, 0xa8, 0x70, 0xf8, 0x71, 0x1b, 0x71, 0x41,
-    0x71, 0x64, 0x71, 0x9a, 0x71, 0xe5, 0x72, 0x24, 0x72, 0x83, 0x72, 0xca, 0x73, 0x16, 0x73, 0x6b,
-    0x73, 0xaf, 0x73, 0xeb, 0x74, 0x1a, 0x74, 0x55, 0x74, 0x9c, 0x74, 0xed, 0x75, 0x51, 0x75, 0x7c,
-    0x75, 0xae, 0x75, 0xe6, 0x76, 0x21, 0x76, 0x52, 0x76, 0x84, 0x76, 0xb2, 0x76, 0xef, 0x77, 0x27,
-    0x77, 0x33, 0x77, 0x63, 0x77, 0xb0, 0x78, 0x0b, 0x78, 0x53, 0x78, 0x7b, 0x78, 0xd6, 0x79, 0x13,
-    0x79, 0x51, 0x79, 0x8a, 0x79, 0xf1, 0x79, 0xfd, 0x7a, 0x35, 0x7a, 0x6f, 0x7a, 0xae, 0x7a, 0xdf,
-    0x7b, 0x35, 0x7b, 0x7e, 0x7b, 0xc8, 0x7c, 0x23, 0x7c, 0x7b, 0x7c, 0xcc, 0x7d, 0x2e, 0x7d, 0x6a,
-    0x7d, 0xbe, 0x7d, 0xe6, 0x7e, 0x23, 0x7e, 0x6e, 0x7e, 0x87, 0x7e, 0xed, 0x7f, 0x38, 0x7f, 0x49,
-    0x7f, 0x82, 0x7f, 0xb1, 0x80, 0x50, 0x80, 0xaa, 0x81, 0x00, 0x81, 0x33, 0x81, 0x64, 0x81, 0x93,
-    0x81, 0xc6, 0x82, 0x01, 0x82, 0x43, 0x82, 0xa2, 0x82, 0xd2, 0x82, 0xed, 0x83, 0x18, 0x83, 0x54,
-    0x83, 0x77, 0x83, 0x9c, 0x83, 0xd9, 0x84, 0x1e, 0x84, 0x47, 0x84, 0x72, 0x84, 0xbf, 0x84, 0xc8,
-    0x84, 0xd1, 0x84, 0xda, 0x84, 0xe3, 0x84, 0xec, 0x84, 0xf5, 0x84, 0xfe, 0x85, 0x45, 0x85, 0x95,
-    0x85, 0xd2, 0x86, 0x1e, 0x86, 0x79, 0x86, 0x96, 0x86, 0xd5, 0x87, 0x15, 0x87, 0x3c, 0x87, 0x84,
-    0x87, 0x9f, 0x87, 0xef, 0x88, 0x00, 0x88, 0x70, 0x88, 0xcc, 0x88, 0xef, 0x88, 0xf7, 0x88, 0xff,
-    0x89, 0x07, 0x89, 0x0f, 0x89, 0x17, 0x89, 0x1f, 0x89, 0x27, 0x89, 0x2f, 0x89, 0x37, 0x89, 0x3f,
-    0x89, 0x47, 0x89, 0x4f, 0x89, 0x57, 0x89, 0x69, 0x89, 0x71, 0x89, 0xd2, 0x8a, 0x17, 0x8a, 0x34,
-    0x8a, 0x88, 0x8a, 0xce, 0x8b, 0x22, 0x8b, 0x8b, 0x8b, 0xd1, 0x8c, 0x25, 0x8c, 0x7a, 0x8c, 0xc3,
-    0x8d, 0x2b, 0x8d, 0x78, 0x8d, 0x80, 0x8d, 0xec, 0x8e, 0x16, 0x8e, 0x63, 0x8e, 0x96, 0x8e, 0xeb,
-    0x8f, 0x19, 0x8f, 0x58, 0x8f, 0x58, 0x8f, 0x60, 0x8f, 0xa9, 0x8f, 0xf2, 0x90, 0x32, 0x90, 0x57,
-    0x90, 0x93, 0x90, 0xa6, 0x90, 0xb9, 0x90, 0xcc, 0x90, 0xdf, 0x90, 0xf3, 0x91, 0x07, 0x91, 0x1d,
-    0x91, 0x30, 0x91, 0x43, 0x91, 0x56, 0x91, 0x69, 0x91, 0x7d, 0x91, 0x90, 0x91, 0xa3, 0x91, 0xb6,
-    0x91, 0xca, 0x91, 0xdd, 0x91, 0xf0, 0x92, 0x03, 0x92, 0x16, 0x92, 0x29, 0x92, 0x3d, 0x92, 0x50,
-    0x92, 0x63, 0x92, 0x76, 0x92, 0x8a, 0x92, 0x9d, 0x92, 0xb0, 0x92, 0xc3, 0x92, 0xd6, 0x92, 0xe9,
-    0x92, 0xfd, 0x93, 0x11, 0x93, 0x27, 0x93, 0x3a, 0x93, 0x4d, 0x93, 0x60, 0x93, 0x73, 0x93, 0x87,
-    0x93, 0x9a, 0x93, 0xac, 0x93, 0xbf, 0x93, 0xd3, 0x93, 0xe6, 0x93, 0xf9, 0x94, 0x0c, 0x94, 0x1f,
-    0x94, 0x32, 0x94, 0x46, 0x94, 0x59, 0x94, 0x6c, 0x94, 0x7f, 0x94, 0x93, 0x94, 0xa6, 0x94, 0xb9,
-    0x94, 0xcc, 0x94, 0xdf, 0x94, 0xf2, 0x95, 0x05, 0x95, 0x5b, 0x95, 0xe3, 0x95, 0xf6, 0x96, 0x09,
-    0x96, 0x1c, 0x96, 0x2e, 0x96, 0x41, 0x96, 0x54, 0x96, 0x67, 0x96, 0x79, 0x96, 0x8c, 0x96, 0x9f,
-    0x96, 0xb2, 0x96, 0xc4, 0x96, 0xd7, 0x96, 0xea, 0x96, 0xfd, 0x97, 0x10, 0x97, 0x65, 0x97, 0xd3,
-    0x97, 0xe6, 0x97, 0xf9, 0x98, 0x0c, 0x98, 0x1e, 0x98, 0x31, 0x98, 0x44, 0x98, 0x57, 0x98, 0x6a,
-    0x98, 0x7e, 0x98, 0x91, 0x98, 0xa4, 0x98, 0xb7, 0x98, 0xca, 0x98, 0xdd, 0x98, 0xf0, 0x99, 0x03,
-    0x99, 0x16, 0x99, 0x29, 0x99, 0x3b, 0x99, 0x4d, 0x99, 0x60, 0x99, 0x6c, 0x99, 0x78, 0x99, 0x8b,
-    0x99, 0x9e, 0x99, 0xb2, 0x99, 0xc6, 0x99, 0xd9, 0x99, 0xec, 0x9a, 0x00, 0x9a, 0x14, 0x9a, 0x27,
-    0x9a, 0x3a, 0x9a, 0x46, 0x9a, 0x52, 0x9a, 0x65, 0x9a, 0x78, 0x9a, 0x8c, 0x9a, 0xa0, 0x9a, 0xb3,
-    0x9a, 0xc6, 0x9a, 0xd9, 0x9a, 0xec, 0x9a, 0xff, 0x9b, 0x12, 0x9b, 0x25, 0x9b, 0x39, 0x9b, 0x4d,
-    0x9b, 0x60, 0x9b, 0x73, 0x9b, 0x87, 0x9b, 0x9b, 0x9b, 0xae, 0x9b, 0xc0, 0x9b, 0xd3, 0x9b, 0xe6,
-    0x9b, 0xf9, 0x9c, 0x0b, 0x9c, 0x1e, 0x9c, 0x31, 0x9c, 0x45, 0x9c, 0x59, 0x9c, 0x6c, 0x9c, 0x7e,
-    0x9c, 0x92, 0x9c, 0xa6, 0x9c, 0xb9, 0x9c, 0xcc, 0x9c, 0xdf, 0x9c, 0xf3, 0x9d, 0x06, 0x9d, 0x19,
-    0x9d, 0x2c, 0x9d, 0x3f, 0x9d, 0x52, 0x9d, 0x65, 0x9d, 0x79, 0x9d, 0x8d, 0x9d, 0xa1, 0x9d, 0xb5,
-    0x9e, 0x05, 0x9e, 0x60, 0x9e, 0x73, 0x9e, 0x86, 0x9e, 0x99, 0x9e, 0xab, 0x9e, 0xbf, 0x9e, 0xd2,
-    0x9e, 0xe5, 0x9e, 0xf8, 0x9f, 0x0b, 0x9f, 0x1e, 0x9f, 0x30, 0x9f, 0x43, 0x9f, 0x56, 0x9f, 0x69,
-    0x9f, 0x7c, 0x9f, 0x88, 0x9f, 0x94, 0x9f, 0x9f, 0x9f, 0xb2, 0x9f, 0xc5, 0x9f, 0xd7, 0x9f, 0xe9,
-    0x9f, 0xfd, 0xa0, 0x11, 0xa0, 0x1d, 0xa0, 0x29, 0xa0, 0x3c, 0xa0, 0x4f, 0xa0, 0x61, 0xa0, 0x74,
-    0xa0, 0x86, 0xa0, 0x98, 0xa0, 0xab, 0xa0, 0xbf, 0xa0, 0xd2, 0xa0, 0xe5, 0xa0, 0xf8, 0xa1, 0x0b,
-    0xa1, 0x1e, 0xa1, 0x32, 0xa1, 0x45, 0xa1, 0x58, 0xa1, 0x6b, 0xa1, 0x7f, 0xa1, 0x92, 0xa1, 0xa4,
-    0xa1, 0xb7, 0xa2, 0x08, 0xa2, 0x1b, 0xa2, 0x2e, 0xa2, 0x41, 0xa2, 0x54, 0xa2, 0x66, 0xa2, 0x78,
-    0xa2, 0x8a, 0xa2, 0x9d, 0xa2, 0xef, 0xa3, 0x01, 0xa3, 0x14, 0xa3, 0x27, 0xa3, 0x3a, 0xa3, 0x4e,
-    0xa3, 0x61, 0xa3, 0x74, 0xa3, 0x87, 0xa3, 0x9a, 0xa3, 0xa5, 0xa3, 0xb7, 0xa3, 0xca, 0xa3, 0xd6,
-    0xa3, 0xe8, 0xa3, 0xfc, 0xa4, 0x08, 0xa4, 0x14, 0xa4, 0x27, 0xa4, 0x33, 0xa4, 0x46, 0xa4, 0x59,
-    0xa4, 0x6c, 0xa4, 0x80, 0xa4, 0x93, 0xa4, 0x9f, 0xa4, 0xb1, 0xa4, 0xc4, 0xa4, 0xd6, 0xa4, 0xe2,
-    0xa4, 0xf4, 0xa5, 0x08, 0xa5, 0x1a, 0xa5, 0x26, 0xa5, 0x39, 0xa5, 0x4c, 0xa5, 0x5f, 0xa5, 0x73,
-    0xa5, 0x87, 0xa5, 0xd6, 0xa5, 0xe9, 0xa5, 0xfb, 0xa6, 0x0e, 0xa6, 0x21, 0xa6, 0x34, 0xa6, 0x46,
-    0xa6, 0x59, 0xa6, 0x6d, 0xa6, 0x79, 0xa6, 0x8d, 0xa6, 0xa1, 0xa6, 0xb4, 0xa6, 0xc8, 0xa6, 0xdd,
-    0xa6, 0xe5, 0xa6, 0xed, 0xa6, 0xf5, 0xa6, 0xfd, 0xa7, 0x05, 0xa7, 0x0d, 0xa7, 0x15, 0xa7, 0x1d,
-    0xa7, 0x25, 0xa7, 0x2d, 0xa7, 0x35, 0xa7, 0x3d, 0xa7, 0x45, 0xa7, 0x4d, 0xa7, 0x61, 0xa7, 0x75,
-    0xa7, 0x88, 0xa7, 0x9b, 0xa7, 0xae, 0xa7, 0xc0, 0xa7, 0xd4, 0xa7, 0xdc, 0xa7, 0xe4, 0xa7, 0xec,
-    0xa7, 0xf4, 0xa7, 0xfc, 0xa8, 0x10, 0xa8, 0x23, 0xa8, 0x36, 0xa8, 0x49, 0xa8, 0x5c, 0xa8, 0x70,
-    0xa8, 0x83, 0xa8, 0xe0, 0xa8, 0xe8, 0xa8, 0xfc, 0xa9, 0x04, 0xa9, 0x0c, 0xa9, 0x1f, 0xa9, 0x32,
-    0xa9, 0x3a, 0xa9, 0x42, 0xa9, 0x4a, 0xa9, 0x52, 0xa9, 0x65, 0xa9, 0x6d, 0xa9, 0x75, 0xa9, 0x7d,
-    0xa9, 0x85, 0xa9, 0x8d, 0xa9, 0x95, 0xa9, 0x9d, 0xa9, 0xa5, 0xa9, 0xad, 0xa9, 0xb5, 0xa9, 0xc8,
-    0xa9, 0xd0, 0xa9, 0xd8, 0xaa, 0x1b, 0xaa, 0x23, 0xaa, 0x2b, 0xaa, 0x3f, 0xaa, 0x52, 0xaa, 0x5a,
-    0xaa, 0x62, 0xaa, 0x76, 0xaa, 0x7e, 0xaa, 0x91, 0xaa, 0xa3, 0xaa, 0xb6, 0xaa, 0xc9, 0xaa, 0xdc,
-    0xaa, 0xef, 0xab, 0x03, 0xab, 0x17, 0xab, 0x2a, 0xab, 0x3d, 0xab, 0x45, 0xab, 0x4d, 0xab, 0x59,
-    0xab, 0x6c, 0xab, 0x74, 0xab, 0x87, 0xab, 0x9a, 0xab, 0xaf, 0xab, 0xc4, 0xab, 0xd7, 0xab, 0xea,
-    0xab, 0xfd, 0xac, 0x10, 0xac, 0x18, 0xac, 0x20, 0xac, 0x34, 0xac, 0x48, 0xac, 0x54, 0xac, 0x60,
-    0xac, 0x73, 0xac, 0x86, 0xac, 0x99, 0xac, 0xac, 0xac, 0xb4, 0xac, 0xbc, 0xac, 0xc4, 0xac, 0xd7,
-    0xac, 0xea, 0xac, 0xf2, 0xad, 0x05, 0xad, 0x18, 0xad, 0x2c, 0xad, 0x40, 0xad, 0x48, 0xad, 0x50,
-    0xad, 0x63, 0xad, 0x76, 0xad, 0x8a, 0xad, 0x92, 0xad, 0xa6, 0xad, 0xba, 0xad, 0xce, 0xad, 0xe2,
-    0xad, 0xf5, 0xae, 0x08, 0xae, 0x1b, 0xae, 0x2f, 0xae, 0x43, 0xae, 0x57, 0xae, 0x6b, 0xae, 0x73,
-    0xae, 0x7b, 0xae, 0x8f, 0xae, 0xa3, 0xae, 0xb7, 0xae, 0xca, 0xae, 0xdd, 0xae, 0xef, 0xaf, 0x03,
-    0xaf, 0x16, 0xaf, 0x2a, 0xaf, 0x3e, 0xaf, 0x52, 0xaf, 0x65, 0xaf, 0x79, 0xaf, 0x8d, 0xaf, 0x95,
-    0xaf, 0xa9, 0xaf, 0xbd, 0xaf, 0xd0, 0xaf, 0xe3, 0xaf, 0xf7, 0xb0, 0x0b, 0xb0, 0x1f, 0xb0, 0x33,
-    0xb0, 0x47, 0xb0, 0x5b, 0xb0, 0x6f, 0xb0, 0x83, 0xb0, 0xa0, 0xb0, 0xbd, 0xb0, 0xd1, 0xb0, 0xe5,
-    0xb0, 0xf9, 0xb1, 0x0d, 0xb1, 0x21, 0xb1, 0x35, 0xb1, 0x49, 0xb1, 0x5d, 0xb1, 0x7a, 0xb1, 0x97,
-    0xb1, 0xab, 0xb1, 0xbf, 0xb1, 0xd2, 0xb1, 0xe5, 0xb1, 0xf8, 0xb2, 0x0b, 0xb2, 0x1f, 0xb2, 0x33,
-    0xb2, 0x47, 0xb2, 0x5a, 0xb2, 0x6e, 0xb2, 0x82, 0xb2, 0x96, 0xb2, 0xa9, 0xb2, 0xc6, 0xb2, 0xe3,
-    0xb2, 0xf6, 0xb3, 0x09, 0xb3, 0x1d, 0xb3, 0x31, 0xb3, 0x45, 0xb3, 0x59, 0xb3, 0x6c, 0xb3, 0x7f,
-    0xb3, 0x93, 0xb3, 0xa7, 0xb3, 0xbb, 0xb3, 0xcf, 0xb3, 0xe3, 0xb3, 0xf7, 0xb4, 0x0b, 0xb4, 0x1f,
-    0xb4, 0x3c, 0xb4, 0x59, 0xb4, 0x6c, 0xb4, 0x7f, 0xb4, 0x92, 0xb4, 0xa5, 0xb4, 0xb8, 0xb4, 0xcb,
-    0xb4, 0xde, 0xb4, 0xf1, 0xb5, 0x05, 0xb5, 0x19, 0xb5, 0x2d, 0xb5, 0x41, 0xb5, 0x54, 0xb5, 0x67,
-    0xb5, 0x7a, 0xb5, 0x8d, 0xb5, 0xa0, 0xb5, 0xb3, 0xb5, 0xc6, 0xb5, 0xd9, 0xb5, 0xec, 0xb5, 0xff,
-    0xb6, 0x13, 0xb6, 0x27, 0xb6, 0x3b, 0xb6, 0x4f, 0xb6, 0x62, 0xb6, 0x75, 0xb6, 0x88, 0xb6, 0x9a,
-    0xb6, 0xb7, 0xb6, 0xca, 0xb6, 0xdd, 0xb6, 0xf0, 0xb7, 0x03, 0xb7, 0x16, 0xb7, 0x29, 0xb7, 0x3c,
-    0xb7, 0x4f, 0xb7, 0x57, 0xb7, 0x94, 0xb7, 0xd0, 0xb7, 0xf2, 0xb8, 0x14, 0xb8, 0x53, 0xb8, 0x94,
-    0xb8, 0xc2, 0xb8, 0xf6, 0xb9, 0x2c, 0xb9, 0x62, 0xb9, 0x6a, 0xb9, 0x7e, 0xb9, 0x86, 0xb9, 0x8e,
-    0xb9, 0x96, 0xb9, 0x9e, 0xb9, 0xa6, 0xb9, 0xae, 0xb9, 0xb6, 0xb9, 0xbe, 0xb9, 0xc6, 0xb9, 0xd9,
-    0xb9, 0xec, 0xb9, 0xff, 0xba, 0x12, 0xba, 0x26, 0xba, 0x3a, 0xba, 0x4e, 0xba, 0x62, 0xba, 0x76,
-    0xba, 0x8a, 0xba, 0x9e, 0xba, 0xb2, 0xba, 0xc6, 0xba, 0xda, 0xba, 0xee, 0xbb, 0x02, 0xbb, 0x0e,
-    0xbb, 0x22, 0xbb, 0x36, 0xbb, 0x4a, 0xbb, 0x5e, 0xbb, 0x72, 0xbb, 0x86, 0xbb, 0x9a, 0xbb, 0xae,
-    0xbb, 0xc1, 0xbb, 0xd4, 0xbb, 0xe8, 0xbb, 0xfc, 0xbc, 0x10, 0xbc, 0x24, 0xbc, 0x38, 0xbc, 0x4c,
-    0xbc, 0x60, 0xbc, 0x74, 0xbc, 0x88, 0xbc, 0x9b, 0xbc, 0xae, 0xbc, 0xc2, 0xbc, 0xd6, 0xbc, 0xea,
-    0xbc, 0xfe, 0xbd, 0x12, 0xbd, 0x26, 0xbd, 0x3a, 0xbd, 0x4d, 0xbd, 0x5f, 0xbd, 0x73, 0xbd, 0x87,
-    0xbd, 0x9b, 0xbd, 0xaf, 0xbd, 0xc3, 0xbd, 0xd7, 0xbd, 0xeb, 0xbd, 0xf7, 0xbe, 0x03, 0xbe, 0x0f,
-    0xbe, 0x1b, 0xbe, 0x27, 0xbe, 0x33, 0xbe, 0x3f, 0xbe, 0x47, 0xbe, 0x4f, 0xbe, 0x57, 0xbe, 0x5f,
-    0xbe, 0x67, 0xbe, 0x6f, 0xbe, 0x77, 0xbe, 0x7f, 0xbe, 0x87, 0xbe, 0x8f, 0xbe, 0x97, 0xbe, 0x9f,
-    0xbe, 0xa7, 0xbe, 0xaf, 0xbe, 0xc3, 0xbe, 0xd6, 0xbe, 0xe9, 0xbe, 0xfc, 0xbf, 0x04, 0xbf, 0x0c,
-    0xbf, 0x20, 0xbf, 0x28, 0xbf, 0x3b, 0xbf, 0x4d, 0xbf, 0x55, 0xbf, 0x5d, 0xbf, 0x65, 0xbf, 0x6d,
-    0xbf, 0x80, 0xbf, 0x88, 0xbf, 0x90, 0xbf, 0x98, 0xbf, 0xa0, 0xbf, 0xa8, 0xbf, 0xb0, 0xbf, 0xb8,
-    0xbf, 0xc0, 0xc0, 0x30, 0xc0, 0x60, 0xc0, 0xac, 0xc0, 0xb4, 0xc0, 0xc0, 0xc0, 0xd3, 0xc0, 0xe5,
-    0xc0, 0xed, 0xc0, 0xf9, 0xc1, 0x0c, 0xc1, 0x1f, 0xc1, 0x2b, 0xc1, 0x3e, 0xc1, 0x51, 0xc1, 0x65,
-    0xc1, 0x71, 0xc1, 0x84, 0xc1, 0x97, 0xc1, 0xaa, 0xc1, 0xbd, 0xc1, 0xc9, 0xc1, 0xd5, 0xc1, 0xe9,
-    0x40, 0x4a, 0x99, 0x98, 0x97, 0x96, 0x87, 0x86, 0x85, 0x84, 0x83, 0x82, 0x81, 0x80, 0x7f, 0x7e,
-    0x7d, 0x7c, 0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x74, 0x73, 0x72, 0x71, 0x70, 0x6f, 0x6e,
-    0x6d, 0x6c, 0x6b, 0x6a, 0x69, 0x68, 0x67, 0x66, 0x65, 0x64, 0x63, 0x62, 0x61, 0x60, 0x5f, 0x5e,
-    0x5d, 0x5c, 0x5b, 0x5a, 0x59, 0x58, 0x57, 0x56, 0x55, 0x54, 0x53, 0x51, 0x50, 0x4f, 0x4e, 0x4d,
-    0x4c, 0x4b, 0x4a, 0x49, 0x48, 0x47, 0x46, 0x28, 0x1f, 0x10, 0x0a, 0x09, 0x2c, 0x01, 0xb1, 0x0b,
-    0x0a, 0x43, 0x23, 0x43, 0x65, 0x0a, 0x2d, 0x2c, 0x00, 0xb1, 0x0a, 0x0b, 0x43, 0x23, 0x43, 0x0b,
-    0x2d, 0x2c, 0x01, 0xb0, 0x06, 0x43, 0xb0, 0x07, 0x43, 0x65, 0x0a, 0x2d, 0x2c, 0xb0, 0x4f, 0x2b,
-    0x20, 0xb0, 0x40, 0x51, 0x58, 0x21, 0x4b, 0x52, 0x58, 0x45, 0x44, 0x1b, 0x21, 0x21, 0x59, 0x1b,
-    0x23, 0x21, 0xb0, 0x40, 0xb0, 0x04, 0x25, 0x45, 0xb0, 0x04, 0x25, 0x45, 0x61, 0x64, 0x8a, 0x63,
-    0x52, 0x58, 0x45, 0x44, 0x1b, 0x21, 0x21, 0x59, 0x59, 0x2d, 0x2c, 0x00, 0xb0, 0x07, 0x43, 0xb0,
-    0x06, 0x43, 0x0b, 0x2d, 0x2c, 0x4b, 0x53, 0x23, 0x4b, 0x51, 0x5a, 0x58, 0x20, 0x45, 0x8a, 0x60,
-    0x44, 0x1b, 0x21, 0x21, 0x59, 0x2d, 0x2c, 0x4b, 0x54, 0x58, 0x20, 0x45, 0x8a, 0x60, 0x44, 0x1b,
-    0x21, 0x21, 0x59, 0x2d, 0x2c, 0x4b, 0x53, 0x23, 0x4b, 0x51, 0x5a, 0x58, 0x38, 0x1b, 0x21, 0x21,
-    0x59, 0x2d, 0x2c, 0x4b, 0x54, 0x58, 0x38, 0x1b, 0x21, 0x21, 0x59, 0x2d, 0x2c, 0xb0, 0x02, 0x43,
-    0x54, 0x58, 0xb0, 0x46, 0x2b, 0x1b, 0x21, 0x21, 0x21, 0x21, 0x59, 0x2d, 0x2c, 0xb0, 0x02, 0x43,
-    0x54, 0x58, 0xb0, 0x47, 0x2b, 0x1b, 0x21, 0x21, 0x21, 0x59, 0x2d, 0x2c, 0xb0, 0x02, 0x43, 0x54,
-    0x58, 0xb0, 0x48, 0x2b, 0x1b, 0x21, 0x21, 0x21, 0x21, 0x59, 0x2d, 0x2c, 0xb0, 0x02, 0x43, 0x54,
-    0x58, 0xb0, 0x49, 0x2b, 0x1b, 0x21, 0x21, 0x21, 0x59, 0x2d, 0x2c, 0x23, 0x20, 0xb0, 0x00, 0x50,
-    0x8a, 0x8a, 0x64, 0xb1, 0x00, 0x03, 0x25, 0x54, 0x58, 0xb0, 0x40, 0x1b, 0xb1, 0x01, 0x03, 0x25,
-    0x54, 0x58, 0xb0, 0x05, 0x43, 0x8b, 0x59, 0xb0, 0x4f, 0x2b, 0x59, 0x23, 0xb0, 0x62, 0x2b, 0x23,
-    0x21, 0x23, 0x58, 0x65, 0x59, 0x2d, 0x2c, 0xb1, 0x08, 0x00, 0x0c, 0x21, 0x54, 0x60, 0x43, 0x2d,
-    0x2c, 0xb1, 0x0c, 0x00, 0x0c, 0x21, 0x54, 0x60, 0x43, 0x2d, 0x2c, 0x01, 0x20, 0x47, 0xb0, 0x02,
-    0x43, 0x20, 0xb8, 0x10, 0x00, 0x62, 0xb8, 0x10, 0x00, 0x63, 0x57, 0x23, 0xb8, 0x01, 0x00, 0x62,
-    0xb8, 0x10, 0x00, 0x63, 0x57, 0x5a, 0x58, 0xb0, 0x20, 0x60, 0x66, 0x59, 0x48, 0x2d, 0x2c, 0xb1,
-    0x00, 0x02, 0x25, 0xb0, 0x02, 0x25, 0xb0, 0x02, 0x25, 0x53, 0xb8, 0x00, 0x35, 0x23, 0x78, 0xb0,
-    0x02, 0x25, 0xb0, 0x02, 0x25, 0x60, 0xb0, 0x20, 0x63, 0x20, 0x20, 0xb0, 0x06, 0x25, 0x23, 0x62,
-    0x50, 0x58, 0x8a, 0x21, 0xb0, 0x01, 0x60, 0x23, 0x1b, 0x20, 0x20, 0xb0, 0x06, 0x25, 0x23, 0x62,
-    0x52, 0x58, 0x23, 0x21, 0xb0, 0x01, 0x61, 0x1b, 0x8a, 0x21, 0x23, 0x21, 0x20, 0x59, 0x59, 0xb8,
-    0xff, 0xc1, 0x1c, 0x60, 0xb0, 0x20, 0x63, 0x23, 0x21, 0x2d, 0x2c, 0xb1, 0x02, 0x00, 0x42, 0xb1,
-    0x23, 0x01, 0x88, 0x51, 0xb1, 0x40, 0x01, 0x88, 0x53, 0x5a, 0x58, 0xb8, 0x10, 0x00, 0xb0, 0x20,
-    0x88, 0x54, 0x58, 0xb2, 0x02, 0x01, 0x02, 0x43, 0x60, 0x42, 0x59, 0xb1, 0x24, 0x01, 0x88, 0x51,
-    0x58, 0xb8, 0x20, 0x00, 0xb0, 0x40, 0x88, 0x54, 0x58, 0xb2, 0x02, 0x02, 0x02, 0x43, 0x60, 0x42,
-    0xb1, 0x24, 0x01, 0x88, 0x54, 0x58, 0xb2, 0x02, 0x20, 0x02, 0x43, 0x60, 0x42, 0x00, 0x4b, 0x01,
-    0x4b, 0x52, 0x58, 0xb2, 0x02, 0x08, 0x02, 0x43, 0x60, 0x42, 0x59, 0x1b, 0xb8, 0x40, 0x00, 0xb0,
-    0x80, 0x88, 0x54, 0x58, 0xb2, 0x02, 0x04, 0x02, 0x43, 0x60, 0x42, 0x59, 0xb8, 0x40, 0x00, 0xb0,
-    0x80, 0x63, 0xb8, 0x01, 0x00, 0x88, 0x54, 0x58, 0xb2, 0x02, 0x08, 0x02, 0x43, 0x60, 0x42, 0x59,
-    0xb9, 0x40, 0x00, 0x01, 0x00, 0x63, 0xb8, 0x02, 0x00, 0x88, 0x54, 0x58, 0xb2, 0x02, 0x10, 0x02,
-    0x43, 0x60, 0x42, 0x59, 0xb1, 0x26, 0x01, 0x88, 0x51, 0x58, 0xb9, 0x40, 0x00, 0x02, 0x00, 0x63,
-    0xb8, 0x04, 0x00, 0x88, 0x54, 0x58, 0xb2, 0x02, 0x40, 0x02, 0x43, 0x60, 0x42, 0x59, 0xb9, 0x40,
-    0x00, 0x04, 0x00, 0x63, 0xb8, 0x08, 0x00, 0x88, 0x54, 0x58, 0xb2, 0x02, 0x80, 0x02, 0x43, 0x60,
-    0x42, 0x59, 0xb1, 0x28, 0x01, 0x88, 0x51, 0x58, 0xb9, 0x40, 0x00, 0x08, 0x00, 0x63, 0xb8, 0x10,
-    0x00, 0x88, 0x54, 0x58, 0xb9, 0x00, 0x02, 0x01, 0x00, 0xb0, 0x02, 0x43, 0x60, 0x42, 0x59, 0x59,
-    0x59, 0x59, 0x59, 0x59, 0x59, 0xb1, 0x00, 0x02, 0x43, 0x54, 0x58, 0x40, 0x0a, 0x05, 0x40, 0x08,
-    0x40, 0x09, 0x40, 0x0c, 0x02, 0x0d, 0x02, 0x1b, 0xb1, 0x01, 0x02, 0x43, 0x54, 0x58, 0xb2, 0x05,
-    0x40, 0x08, 0xba, 0x01, 0x00, 0x00, 0x09, 0x01, 0x00, 0xb3, 0x0c, 0x01, 0x0d, 0x01, 0x1b, 0xb1,
-    0x80, 0x02, 0x43, 0x52, 0x58, 0xb2, 0x05, 0x40, 0x08, 0xb8, 0x01, 0x80, 0xb1, 0x09, 0x40, 0x1b,
-    0xb8, 0x01, 0x00, 0xb0, 0x02, 0x43, 0x52, 0x58, 0xb2, 0x05, 0x40, 0x08, 0xba, 0x01, 0x80, 0x00,
-    0x09, 0x01, 0x40, 0x1b, 0xb8, 0x01, 0x80, 0xb0, 0x02, 0x43, 0x52, 0x58, 0xb2, 0x05, 0x40, 0x08,
-    0xb8, 0x02, 0x00, 0xb1, 0x09, 0x40, 0x1b, 0xb2, 0x05, 0x40, 0x08, 0xba, 0x01, 0x00, 0x00, 0x09,
-    0x01, 0x00, 0x59, 0x59, 0x59, 0xb8, 0x40, 0x00, 0xb0, 0x80, 0x88, 0x55, 0xb9, 0x40, 0x00, 0x02,
-    0x00, 0x63, 0xb8, 0x04, 0x00, 0x88, 0x55, 0x5a, 0x58, 0xb3, 0x0c, 0x00, 0x0d, 0x01, 0x1b, 0xb3,
-    0x0c, 0x00, 0x0d, 0x01, 0x59, 0x59, 0x59, 0x42, 0x42, 0x42, 0x42, 0x42, 0x2d, 0x2c, 0x45, 0xb1,
-    0x02, 0x4e, 0x2b, 0x23, 0xb0, 0x4f, 0x2b, 0x20, 0xb0, 0x40, 0x51, 0x58, 0x21, 0x4b, 0x51, 0x58,
-    0xb0, 0x02, 0x25, 0x45, 0xb1, 0x01, 0x4e, 0x2b, 0x60, 0x59, 0x1b, 0x23, 0x4b, 0x51, 0x58, 0xb0,
-    0x03, 0x25, 0x45, 0x20, 0x64, 0x8a, 0x63, 0xb0, 0x40, 0x53, 0x58, 0xb1, 0x02, 0x4e, 0x2b, 0x60,
-    0x1b, 0x21, 0x59, 0x1b, 0x21, 0x59, 0x59, 0x44, 0x2d, 0x2c, 0x20, 0xb0, 0x00, 0x50, 0x20, 0x58,
-    0x23, 0x65, 0x1b, 0x23, 0x59, 0xb1, 0x14, 0x14, 0x8a, 0x70, 0x45, 0xb0, 0x4f, 0x2b, 0x23, 0xb1,
-    0x61, 0x06, 0x26, 0x60, 0x2b, 0x8a, 0x58, 0xb0, 0x05, 0x43, 0x8b, 0x59, 0x23, 0x58, 0x65, 0x59,
-    0x23, 0x10, 0x3a, 0x2d, 0x2c, 0xb0, 0x03, 0x25, 0x49, 0x63, 0x23, 0x46, 0x60, 0xb0, 0x4f, 0x2b,
-    0x23, 0xb0, 0x04, 0x25, 0xb0, 0x04, 0x25, 0x49, 0xb0, 0x03, 0x25, 0x63, 0x56, 0x20, 0x60, 0xb0,
-    0x62, 0x60, 0x2b, 0xb0, 0x03, 0x25, 0x20, 0x10, 0x46, 0x8a, 0x46, 0x60, 0xb0, 0x20, 0x63, 0x61,
-    0x3a, 0x2d, 0x2c, 0xb0, 0x00, 0x16, 0xb1, 0x02, 0x03, 0x25, 0xb1, 0x01, 0x04, 0x25, 0x01, 0x3e,
-    0x00, 0x3e, 0xb1, 0x01, 0x02, 0x06, 0x0c, 0xb0, 0x0a, 0x23, 0x65, 0x42, 0xb0, 0x0b, 0x23, 0x42,
-    0xb1, 0x02, 0x03, 0x25, 0xb1, 0x01, 0x04, 0x25, 0x01, 0x3f, 0x00, 0x3f, 0xb1, 0x01, 0x02, 0x06,
-    0x0c, 0xb0, 0x06, 0x23, 0x65, 0x42, 0xb0, 0x07, 0x23, 0x42, 0xb0, 0x01, 0x16, 0xb1, 0x00, 0x02,
-    0x43, 0x54, 0x58, 0x45, 0x23, 0x45, 0x20, 0x18, 0x69, 0x8a, 0x63, 0x23, 0x62, 0x20, 0x20, 0xb0,
-    0x40, 0x50, 0x58, 0x67, 0x1b, 0x66, 0x59, 0x61, 0xb0, 0x20, 0x63, 0xb0, 0x40, 0x23, 0x61, 0xb0,
-    0x04, 0x23, 0x42, 0x1b, 0xb1, 0x04, 0x00, 0x42, 0x21, 0x21, 0x59, 0x18, 0x01, 0x2d, 0x2c, 0x20,
-    0x45, 0xb1, 0x00, 0x4e, 0x2b, 0x44, 0x2d, 0x2c, 0x4b, 0x51, 0xb1, 0x40, 0x4f, 0x2b, 0x50, 0x5b,
-    0x58, 0x20, 0x45, 0xb1, 0x01, 0x4e, 0x2b, 0x20, 0x8a, 0x8a, 0x44, 0x20, 0xb1, 0x40, 0x04, 0x26,
-    0x61, 0x63, 0x61, 0xb1, 0x01, 0x4e, 0x2b, 0x44, 0x21, 0x1b, 0x23, 0x21, 0x8a, 0x45, 0xb1, 0x01,
-    0x4e, 0x2b, 0x20, 0x8a, 0x23, 0x44, 0x44, 0x59, 0x2d, 0x2c, 0x4b, 0x51, 0xb1, 0x40, 0x4f, 0x2b,
-    0x50, 0x5b, 0x58, 0x45, 0x20, 0x8a, 0xb0, 0x40, 0x61, 0x63, 0x60, 0x1b, 0x23, 0x21, 0x45, 0x59,
-    0xb1, 0x01, 0x4e, 0x2b, 0x44, 0x2d, 0x2c, 0x23, 0x45, 0x20, 0x8a, 0x45, 0x23, 0x61, 0x20, 0x64,
-    0xb0, 0x40, 0x51, 0xb0, 0x04, 0x25, 0x20, 0xb0, 0x00, 0x53, 0x23, 0xb0, 0x40, 0x51, 0x5a, 0x5a,
-    0xb1, 0x40, 0x4f, 0x2b, 0x54, 0x5a, 0x58, 0x8a, 0x0c, 0x64, 0x23, 0x64, 0x23, 0x53, 0x58, 0xb1,
-    0x40, 0x40, 0x8a, 0x61, 0x20, 0x63, 0x61, 0x1b, 0x20, 0x63, 0x59, 0x1b, 0x8a, 0x59, 0x63, 0xb1,
-    0x02, 0x4e, 0x2b, 0x60, 0x44, 0x2d, 0x2c, 0x01, 0x2d, 0x2c, 0x00, 0x2d, 0x2c, 0x05, 0xb1, 0x0b,
-    0x0a, 0x43, 0x23, 0x43, 0x65, 0x0a, 0x2d, 0x2c, 0xb1, 0x0a, 0x0b, 0x43, 0x23, 0x43, 0x0b, 0x02,
-    0x2d, 0x2c, 0xb0, 0x02, 0x25, 0x63, 0x66, 0xb0, 0x02, 0x25, 0xb8, 0x20, 0x00, 0x62, 0x60, 0x23,
-    0x62, 0x2d, 0x2c, 0xb0, 0x02, 0x25, 0x63, 0xb0, 0x20, 0x60, 0x66, 0xb0, 0x02, 0x25, 0xb8, 0x20,
-    0x00, 0x62, 0x60, 0x23, 0x62, 0x2d, 0x2c, 0xb0, 0x02, 0x25, 0x63, 0x67, 0xb0, 0x02, 0x25, 0xb8,
-    0x20, 0x00, 0x62, 0x60, 0x23, 0x62, 0x2d, 0x2c, 0xb0, 0x02, 0x25, 0x63, 0x66, 0xb0, 0x20, 0x60,
-    0xb0, 0x02, 0x25, 0xb8, 0x20, 0x00, 0x62, 0x60, 0x23, 0x62, 0x2d, 0x2c, 0x23, 0x4a, 0xb1, 0x02,
-    0x4e, 0x2b, 0x2d, 0x2c, 0x23, 0x4a, 0xb1, 0x01, 0x4e, 0x2b, 0x2d, 0x2c, 0x23, 0x8a, 0x4a, 0x23,
-    0x45, 0x64, 0xb0, 0x02, 0x25, 0x64, 0xb0, 0x02, 0x25, 0x61, 0x64, 0xb0, 0x03, 0x43, 0x52, 0x58,
-    0x21, 0x20, 0x64, 0x59, 0xb1, 0x02, 0x4e, 0x2b, 0x23, 0xb0, 0x00, 0x50, 0x58, 0x65, 0x59, 0x2d,
-    0x2c, 0x23, 0x8a, 0x4a, 0x23, 0x45, 0x64, 0xb0, 0x02, 0x25, 0x64, 0xb0, 0x02, 0x25, 0x61, 0x64,
-    0xb0, 0x03, 0x43, 0x52, 0x58, 0x21, 0x20, 0x64, 0x59, 0xb1, 0x01, 0x4e, 0x2b, 0x23, 0xb0, 0x00,
-    0x50, 0x58, 0x65, 0x59, 0x2d, 0x2c, 0x20, 0xb0, 0x03, 0x25, 0x4a, 0xb1, 0x02, 0x4e, 0x2b, 0x8a,
-    0x10, 0x3b, 0x2d, 0x2c, 0x20, 0xb0, 0x03, 0x25, 0x4a, 0xb1, 0x01, 0x4e, 0x2b, 0x8a, 0x10, 0x3b,
-    0x2d, 0x2c, 0xb0, 0x03, 0x25, 0xb0, 0x03, 0x25, 0x8a, 0xb0, 0x67, 0x2b, 0x8a, 0x10, 0x3b, 0x2d,
-    0x2c, 0xb0, 0x03, 0x25, 0xb0, 0x03, 0x25, 0x8a, 0xb0, 0x68, 0x2b, 0x8a, 0x10, 0x3b, 0x2d, 0x2c,
-    0xb0, 0x03, 0x25, 0x46, 0xb0, 0x03, 0x25, 0x46, 0x60, 0xb0, 0x04, 0x25, 0x2e, 0xb0, 0x04, 0x25,
-    0xb0, 0x04, 0x25, 0xb0, 0x04, 0x26, 0x20, 0xb0, 0x00, 0x50, 0x58, 0x21, 0xb0, 0x6a, 0x1b, 0xb0,
-    0x6c, 0x59, 0x2b, 0xb0, 0x03, 0x25, 0x46, 0xb0, 0x03, 0x25, 0x46, 0x60, 0x61, 0xb0, 0x80, 0x62,
-    0x20, 0x8a, 0x20, 0x10, 0x23, 0x3a, 0x23, 0x20, 0x10, 0x23, 0x3a, 0x2d, 0x2c, 0xb0, 0x03, 0x25,
-    0x47, 0xb0, 0x03, 0x25, 0x47, 0x60, 0xb0, 0x05, 0x25, 0x47, 0xb0, 0x80, 0x63, 0x61, 0xb0, 0x02,
-    0x25, 0xb0, 0x06, 0x25, 0x49, 0x63, 0x23, 0xb0, 0x05, 0x25, 0x4a, 0xb0, 0x80, 0x63, 0x20, 0x58,
-    0x62, 0x1b, 0x21, 0x59, 0xb0, 0x04, 0x26, 0x46, 0x60, 0x8a, 0x46, 0x8a, 0x46, 0x60, 0xb0, 0x20,
-    0x63, 0x61, 0x2d, 0x2c, 0xb0, 0x04, 0x26, 0xb0, 0x04, 0x25, 0xb0, 0x04, 0x25, 0xb0, 0x04, 0x26,
-    0xb0, 0x6e, 0x2b, 0x20, 0x8a, 0x20, 0x10, 0x23, 0x3a, 0x23, 0x20, 0x10, 0x23, 0x3a, 0x2d, 0x2c,
-    0x23, 0x20, 0xb0, 0x01, 0x54, 0x58, 0x21, 0xb0, 0x02, 0x25, 0xb1, 0x02, 0x4e, 0x2b, 0xb0, 0x80,
-    0x50, 0x20, 0x60, 0x59, 0x20, 0x60, 0x60, 0x20, 0xb0, 0x01, 0x51, 0x58, 0x21, 0x21, 0x1b, 0x20,
-    0xb0, 0x05, 0x51, 0x58, 0x21, 0x20, 0x66, 0x61, 0xb0, 0x40, 0x23, 0x61, 0xb1, 0x00, 0x03, 0x25,
-    0x50, 0xb0, 0x03, 0x25, 0xb0, 0x03, 0x25, 0x50, 0x5a, 0x58, 0x20, 0xb0, 0x03, 0x25, 0x61, 0x8a,
-    0x53, 0x58, 0x21, 0xb0, 0x00, 0x59, 0x1b, 0x21, 0x59, 0x1b, 0xb0, 0x07, 0x54, 0x58, 0x20, 0x66,
-    0x61, 0x65, 0x23, 0x21, 0x1b, 0x21, 0x21, 0xb0, 0x00, 0x59, 0x59, 0x59, 0xb1, 0x02, 0x4e, 0x2b,
-    0x2d, 0x2c, 0xb0, 0x02, 0x25, 0xb0, 0x04, 0x25, 0x4a, 0xb0, 0x00, 0x53, 0x58, 0xb0, 0x00, 0x1b,
-    0x8a, 0x8a, 0x23, 0x8a, 0xb0, 0x01, 0x59, 0xb0, 0x04, 0x25, 0x46, 0x20, 0x66, 0x61, 0x20, 0xb0,
-    0x05, 0x26, 0xb0, 0x06, 0x26, 0x49, 0xb0, 0x05, 0x26, 0xb0, 0x05, 0x26, 0xb0, 0x70, 0x2b, 0x23,
-    0x61, 0x65, 0xb0, 0x20, 0x60, 0x20, 0x66, 0x61, 0xb0, 0x20, 0x61, 0x65, 0x2d, 0x2c, 0xb0, 0x02,
-    0x25, 0x46, 0x20, 0x8a, 0x20, 0xb0, 0x00, 0x50, 0x58, 0x21, 0xb1, 0x02, 0x4e, 0x2b, 0x1b, 0x45,
-    0x23, 0x21, 0x59, 0x61, 0x65, 0xb0, 0x02, 0x25, 0x10, 0x3b, 0x2d, 0x2c, 0xb0, 0x04, 0x26, 0x20,
-    0xb8, 0x02, 0x00, 0x62, 0x20, 0xb8, 0x02, 0x00, 0x63, 0x8a, 0x23, 0x61, 0x20, 0xb0, 0x5d, 0x60,
-    0x2b, 0xb0, 0x05, 0x25, 0x11, 0x8a, 0x12, 0x8a, 0x20, 0x39, 0x8a, 0x58, 0xb9, 0x00, 0x5d, 0x10,
-    0x00, 0xb0, 0x04, 0x26, 0x63, 0x56, 0x60, 0x2b, 0x23, 0x21, 0x20, 0x10, 0x20, 0x46, 0x20, 0xb1,
-    0x02, 0x4e, 0x2b, 0x23, 0x61, 0x1b, 0x23, 0x21, 0x20, 0x8a, 0x20, 0x10, 0x49, 0xb1, 0x02, 0x4e,
-    0x2b, 0x59, 0x3b, 0x2d, 0x2c, 0xb9, 0x00, 0x5d, 0x10, 0x00, 0xb0, 0x09, 0x25, 0x63, 0x56, 0x60,
-    0x2b, 0xb0, 0x05, 0x25, 0xb0, 0x05, 0x25, 0xb0, 0x05, 0x26, 0xb0, 0x6d, 0x2b, 0xb1, 0x5d, 0x07,
-    0x25, 0x60, 0x2b, 0xb0, 0x05, 0x25, 0xb0, 0x05, 0x25, 0xb0, 0x05, 0x25, 0xb0, 0x05, 0x25, 0xb0,
-    0x6f, 0x2b, 0xb9, 0x00, 0x5d, 0x10, 0x00, 0xb0, 0x08, 0x26, 0x63, 0x56, 0x60, 0x2b, 0x20, 0xb0,
-    0x00, 0x52, 0x58, 0xb0, 0x50, 0x2b, 0xb0, 0x05, 0x25, 0xb0, 0x05, 0x25, 0xb0, 0x07, 0x25, 0xb0,
-    0x07, 0x25, 0xb0, 0x05, 0x25, 0xb0, 0x71, 0x2b, 0xb0, 0x02, 0x17, 0x38, 0xb0, 0x00, 0x52, 0xb0,
-    0x02, 0x25, 0xb0, 0x01, 0x52, 0x5a, 0x58, 0xb0, 0x04, 0x25, 0xb0, 0x06, 0x25, 0x49, 0xb0, 0x03,
-    0x25, 0xb0, 0x05, 0x25, 0x49, 0x60, 0x20, 0xb0, 0x40, 0x52, 0x58, 0x21, 0x1b, 0xb0, 0x00, 0x52,
-    0x58, 0x20, 0xb0, 0x02, 0x54, 0x58, 0xb0, 0x04, 0x25, 0xb0, 0x04, 0x25, 0xb0, 0x07, 0x25, 0xb0,
-    0x07, 0x25, 0x49, 0xb0, 0x02, 0x17, 0x38, 0x1b, 0xb0, 0x04, 0x25, 0xb0, 0x04, 0x25, 0xb0, 0x04,
-    0x25, 0xb0, 0x06, 0x25, 0x49, 0xb0, 0x02, 0x17, 0x38, 0x59, 0x59, 0x59, 0x59, 0x59, 0x21, 0x21,
-    0x21, 0x21, 0x21, 0x2d, 0x2c, 0xb9, 0x00, 0x5d, 0x10, 0x00, 0xb0, 0x0b, 0x25, 0x63, 0x56, 0x60,
-    0x2b, 0xb0, 0x07, 0x25, 0xb0, 0x07, 0x25, 0xb0, 0x06, 0x25, 0xb0, 0x06, 0x25, 0xb0, 0x0c, 0x25,
-    0xb0, 0x0c, 0x25, 0xb0, 0x09, 0x25, 0xb0, 0x08, 0x25, 0xb0, 0x6e, 0x2b, 0xb0, 0x04, 0x17, 0x38,
-    0xb0, 0x07, 0x25, 0xb0, 0x07, 0x25, 0xb0, 0x07, 0x26, 0xb0, 0x6d, 0x2b, 0xb0, 0x04, 0x25, 0xb0,
-    0x04, 0x25, 0xb0, 0x04, 0x26, 0xb0, 0x6d, 0x2b, 0xb0, 0x50, 0x2b, 0xb0, 0x06, 0x25, 0xb0, 0x06,
-    0x25, 0xb0, 0x03, 0x25, 0xb0, 0x71, 0x2b, 0xb0, 0x05, 0x25, 0xb0, 0x05, 0x25, 0xb0, 0x03, 0x25,
-    0xb0, 0x02, 0x17, 0x38, 0x20, 0xb0, 0x06, 0x25, 0xb0, 0x06, 0x25, 0xb0, 0x05, 0x25, 0xb0, 0x71,
-    0x2b, 0x60, 0xb0, 0x06, 0x25, 0xb0, 0x06, 0x25, 0xb0, 0x04, 0x25, 0x65, 0xb0, 0x02, 0x17, 0x38,
-    0xb0, 0x02, 0x25, 0xb0, 0x02, 0x25, 0x60, 0x20, 0xb0, 0x40, 0x53, 0x58, 0x21, 0xb0, 0x40, 0x61,
-    0x23, 0xb0, 0x40, 0x61, 0x23, 0x1b, 0xb8, 0xff, 0xc0, 0x50, 0x58, 0xb0, 0x40, 0x60, 0x23, 0xb0,
-    0x40, 0x60, 0x23, 0x59, 0x59, 0xb0, 0x08, 0x25, 0xb0, 0x08, 0x25, 0xb0, 0x04, 0x26, 0xb0, 0x02,
-    0x17, 0x38, 0xb0, 0x05, 0x25, 0xb0, 0x05, 0x25, 0x8a, 0xb0, 0x02, 0x17, 0x38, 0x20, 0xb0, 0x00,
-    0x52, 0x58, 0xb0, 0x06, 0x25, 0xb0, 0x08, 0x25, 0x49, 0xb0, 0x03, 0x25, 0xb0, 0x05, 0x25, 0x49,
-    0x60, 0x20, 0xb0, 0x40, 0x52, 0x58, 0x21, 0x1b, 0xb0, 0x00, 0x52, 0x58, 0xb0, 0x06, 0x25, 0xb0,
-    0x06, 0x25, 0xb0, 0x06, 0x25, 0xb0, 0x06, 0x25, 0xb0, 0x0b, 0x25, 0xb0, 0x0b, 0x25, 0x49, 0xb0,
-    0x04, 0x17, 0x38, 0xb0, 0x06, 0x25, 0xb0, 0x06, 0x25, 0xb0, 0x06, 0x25, 0xb0, 0x06, 0x25, 0xb0,
-    0x0a, 0x25, 0xb0, 0x0a, 0x25, 0xb0, 0x07, 0x25, 0xb0, 0x71, 0x2b, 0xb0, 0x04, 0x17, 0x38, 0xb0,
-    0x04, 0x25, 0xb0, 0x04, 0x25, 0xb0, 0x05, 0x25, 0xb0, 0x07, 0x25, 0xb0, 0x05, 0x25, 0xb0, 0x71,
-    0x2b, 0xb0, 0x02, 0x17, 0x38, 0x1b, 0xb0, 0x04, 0x25, 0xb0, 0x04, 0x25, 0xb8, 0xff, 0xc0, 0xb0,
-    0x02, 0x17, 0x38, 0x59, 0x59, 0x59, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x2d, 0x2c,
-    0xb0, 0x04, 0x25, 0xb0, 0x03, 0x25, 0x87, 0xb0, 0x03, 0x25, 0xb0, 0x03, 0x25, 0x8a, 0x20, 0xb0,
-    0x00, 0x50, 0x58, 0x21, 0xb0, 0x65, 0x1b, 0xb0, 0x68, 0x59, 0x2b, 0x64, 0xb0, 0x04, 0x25, 0xb0,
-    0x04, 0x25, 0x06, 0xb0, 0x04, 0x25, 0xb0, 0x04, 0x25, 0x49, 0x20, 0x20, 0x63, 0xb0, 0x03, 0x25,
-    0x20, 0x63, 0x51, 0xb1, 0x00, 0x03, 0x25, 0x54, 0x5b, 0x58, 0x21, 0x21, 0x23, 0x21, 0x07, 0x1b,
-    0x20, 0x63, 0xb0, 0x02, 0x25, 0x20, 0x63, 0x61, 0x20, 0xb0, 0x53, 0x2b, 0x8a, 0x63, 0xb0, 0x05,
-    0x25, 0xb0, 0x05, 0x25, 0x87, 0xb0, 0x04, 0x25, 0xb0, 0x04, 0x26, 0x4a, 0xb0, 0x00, 0x50, 0x58,
-    0x65, 0x59, 0xb0, 0x04, 0x26, 0x20, 0x01, 0x46, 0x23, 0x00, 0x46, 0xb0, 0x05, 0x26, 0x20, 0x01,
-    0x46, 0x23, 0x00, 0x46, 0xb0, 0x00, 0x16, 0x00, 0xb0, 0x00, 0x23, 0x48, 0x01, 0xb0, 0x00, 0x23,
-    0x48, 0x00, 0x20, 0xb0, 0x01, 0x23, 0x48, 0xb0, 0x02, 0x23, 0x48, 0x01, 0x20, 0xb0, 0x01, 0x23,
-    0x48, 0xb0, 0x02, 0x23, 0x48, 0x23, 0xb2, 0x02, 0x00, 0x01, 0x08, 0x23, 0x38, 0xb2, 0x02, 0x00,
-    0x01, 0x09, 0x23, 0x38, 0xb1, 0x02, 0x01, 0x07, 0xb0, 0x01, 0x16, 0x59, 0x2d, 0x2c, 0x23, 0x10,
-    0x0d, 0x0c, 0x8a, 0x63, 0x23, 0x8a, 0x63, 0x60, 0x64, 0xb9, 0x40, 0x00, 0x04, 0x00, 0x63, 0x50,
-    0x58, 0xb0, 0x00, 0x38, 0x1b, 0x3c, 0x59, 0x2d, 0x2c, 0xb0, 0x06, 0x25, 0xb0, 0x09, 0x25, 0xb0,
-    0x09, 0x25, 0xb0, 0x07, 0x26, 0xb0, 0x76, 0x2b, 0x23, 0xb0, 0x00, 0x54, 0x58, 0x05, 0x1b, 0x04,
-    0x59, 0xb0, 0x04, 0x25, 0xb0, 0x06, 0x26, 0xb0, 0x77, 0x2b, 0xb0, 0x05, 0x25, 0xb0, 0x05, 0x26,
-    0xb0, 0x05, 0x25, 0xb0, 0x05, 0x26, 0xb0, 0x76, 0x2b, 0xb0, 0x00, 0x54, 0x58, 0x05, 0x1b, 0x04,
-    0x59, 0xb0, 0x77, 0x2b, 0x2d, 0x2c, 0xb0, 0x07, 0x25, 0xb0, 0x0a, 0x25, 0xb0, 0x0a, 0x25, 0xb0,
-    0x08, 0x26, 0xb0, 0x76, 0x2b, 0x8a, 0xb0, 0x00, 0x54, 0x58, 0x05, 0x1b, 0x04, 0x59, 0xb0, 0x05,
-    0x25, 0xb0, 0x07, 0x26, 0xb0, 0x77, 0x2b, 0xb0, 0x06, 0x25, 0xb0, 0x06, 0x26, 0xb0, 0x06, 0x25,
-    0xb0, 0x06, 0x26, 0xb0, 0x76, 0x2b, 0x08, 0xb0, 0x77, 0x2b, 0x2d, 0x2c, 0xb0, 0x07, 0x25, 0xb0,
-    0x0a, 0x25, 0xb0, 0x0a, 0x25, 0xb0, 0x08, 0x26, 0xb0, 0x76, 0x2b, 0x8a, 0x8a, 0x08, 0xb0, 0x04,
-    0x25, 0xb0, 0x06, 0x26, 0xb0, 0x77, 0x2b, 0xb0, 0x05, 0x25, 0xb0, 0x05, 0x26, 0xb0, 0x05, 0x25,
-    0xb0, 0x05, 0x26, 0xb0, 0x76, 0x2b, 0xb0, 0x00, 0x54, 0x58, 0x05, 0x1b, 0x04, 0x59, 0xb0, 0x77,
-    0x2b, 0x2d, 0x2c, 0xb0, 0x08, 0x25, 0xb0, 0x0b, 0x25, 0xb0, 0x0b, 0x25, 0xb0, 0x09, 0x26, 0xb0,
-    0x76, 0x2b, 0xb0, 0x04, 0x26, 0xb0, 0x04, 0x26, 0x08, 0xb0, 0x05, 0x25, 0xb0, 0x07, 0x26, 0xb0,
-    0x77, 0x2b, 0xb0, 0x06, 0x25, 0xb0, 0x06, 0x26, 0xb0, 0x06, 0x25, 0xb0, 0x06, 0x26, 0xb0, 0x76,
-    0x2b, 0x08, 0xb0, 0x77, 0x2b, 0x2d, 0x2c, 0x03, 0xb0, 0x03, 0x25, 0xb0, 0x03, 0x25, 0x4a, 0xb0,
-    0x04, 0x25, 0xb0, 0x03, 0x25, 0x4a, 0x02, 0xb0, 0x05, 0x25, 0xb0, 0x05, 0x26, 0x4a, 0xb0, 0x05,
-    0x26, 0xb0, 0x05, 0x26, 0x4a, 0xb0, 0x04, 0x26, 0x63, 0x8a, 0x8a, 0x63, 0x61, 0x2d, 0x2c, 0xb1,
-    0x5d, 0x0e, 0x25, 0x60, 0x2b, 0xb0, 0x0c, 0x26, 0x11, 0xb0, 0x05, 0x26, 0x12, 0xb0, 0x0a, 0x25,
-    0x39, 0xb0, 0x07, 0x25, 0x39, 0xb0, 0x0a, 0x25, 0xb0, 0x0a, 0x25, 0xb0, 0x09, 0x25, 0xb0, 0x7c,
-    0x2b, 0xb0, 0x00, 0x50, 0xb0, 0x0b, 0x25, 0xb0, 0x08, 0x25, 0xb0, 0x0a, 0x25, 0xb0, 0x7c, 0x2b,
-    0xb0, 0x00, 0x50, 0x54, 0x58, 0xb0, 0x07, 0x25, 0xb0, 0x0b, 0x25, 0x87, 0xb0, 0x04, 0x25, 0xb0,
-    0x04, 0x25, 0x0b, 0xb0, 0x0a, 0x25, 0x10, 0xb0, 0x09, 0x25, 0xc1, 0xb0, 0x02, 0x25, 0xb0, 0x02,
-    0x25, 0x0b, 0xb0, 0x07, 0x25, 0x10, 0xb0, 0x06, 0x25, 0xc1, 0x1b, 0xb0, 0x07, 0x25, 0xb0, 0x0b,
-    0x25, 0xb0, 0x0b, 0x25, 0xb8, 0xff, 0xff, 0xb0, 0x76, 0x2b, 0xb0, 0x04, 0x25, 0xb0, 0x04, 0x25,
-    0x0b, 0xb0, 0x07, 0x25, 0xb0, 0x0a, 0x25, 0xb0, 0x77, 0x2b, 0xb0, 0x0a, 0x25, 0xb0, 0x08, 0x25,
-    0xb0, 0x08, 0x25, 0xb8, 0xff, 0xff, 0xb0, 0x76, 0x2b, 0xb0, 0x02, 0x25, 0xb0, 0x02, 0x25, 0x0b,
-    0xb0, 0x0a, 0x25, 0xb0, 0x07, 0x25, 0xb0, 0x77, 0x2b, 0x59, 0xb0, 0x0a, 0x25, 0x46, 0xb0, 0x0a,
-    0x25, 0x46, 0x60, 0xb0, 0x08, 0x25, 0x46, 0xb0, 0x08, 0x25, 0x46, 0x60, 0xb0, 0x06, 0x25, 0xb0,
-    0x06, 0x25, 0x0b, 0xb0, 0x0c, 0x25, 0xb0, 0x0c, 0x25, 0xb0, 0x0c, 0x26, 0x20, 0xb0, 0x00, 0x50,
-    0x58, 0x21, 0xb0, 0x6a, 0x1b, 0xb0, 0x6c, 0x59, 0x2b, 0xb0, 0x04, 0x25, 0xb0, 0x04, 0x25, 0x0b,
-    0xb0, 0x09, 0x25, 0xb0, 0x09, 0x25, 0xb0, 0x09, 0x26, 0x20, 0xb0, 0x00, 0x50, 0x58, 0x21, 0xb0,
-    0x6a, 0x1b, 0xb0, 0x6c, 0x59, 0x2b, 0x23, 0xb0, 0x0a, 0x25, 0x46, 0xb0, 0x0a, 0x25, 0x46, 0x60,
-    0x61, 0xb0, 0x20, 0x63, 0x23, 0xb0, 0x08, 0x25, 0x46, 0xb0, 0x08, 0x25, 0x46, 0x60, 0x61, 0xb0,
-    0x20, 0x63, 0xb1, 0x01, 0x0c, 0x25, 0x54, 0x58, 0x04, 0x1b, 0x05, 0x59, 0xb0, 0x0a, 0x26, 0x20,
-    0x10, 0xb0, 0x03, 0x25, 0x3a, 0xb0, 0x06, 0x26, 0xb0, 0x06, 0x26, 0x0b, 0xb0, 0x07, 0x26, 0x20,
-    0x10, 0x8a, 0x3a, 0xb1, 0x01, 0x07, 0x26, 0x54, 0x58, 0x04, 0x1b, 0x05, 0x59, 0xb0, 0x05, 0x26,
-    0x20, 0x10, 0xb0, 0x02, 0x25, 0x3a, 0x8a, 0x8a, 0x0b, 0x23, 0x20, 0x10, 0x23, 0x3a, 0x2d, 0x2c,
-    0x23, 0xb0, 0x01, 0x54, 0x58, 0xb9, 0x00, 0x00, 0x40, 0x00, 0x1b, 0xb8, 0x40, 0x00, 0xb0, 0x00,
-    0x59, 0x8a, 0xb0, 0x01, 0x54, 0x58, 0xb9, 0x00, 0x00, 0x40, 0x00, 0x1b, 0xb8, 0x40, 0x00, 0xb0,
-    0x00, 0x59, 0xb0, 0x7d, 0x2b, 0x2d, 0x2c, 0x8a, 0x8a, 0x08, 0x0d, 0x8a, 0xb0, 0x01, 0x54, 0x58,
-    0xb9, 0x00, 0x00, 0x40, 0x00, 0x1b, 0xb8, 0x40, 0x00, 0xb0, 0x00, 0x59, 0xb0, 0x7d, 0x2b, 0x2d,
-    0x2c, 0x08, 0xb0, 0x01, 0x54, 0x58, 0xb9, 0x00, 0x00, 0x40, 0x00, 0x1b, 0xb8, 0x40, 0x00, 0xb0,
-    0x00, 0x59, 0x0d, 0xb0, 0x7d, 0x2b, 0x2d, 0x2c, 0xb0, 0x04, 0x26, 0xb0, 0x04, 0x26, 0x08, 0x0d,
-    0xb0, 0x04, 0x26, 0xb0, 0x04, 0x26, 0x08, 0x0d, 0xb0, 0x7d, 0x2b, 0x2d, 0x2c, 0x20, 0x01, 0x46,
-    0x23, 0x00, 0x46, 0xb0, 0x0a, 0x43, 0xb0, 0x0b, 0x43, 0x8a, 0x63, 0x23, 0x62, 0x61, 0x2d, 0x2c,
-    0xb0, 0x09, 0x2b, 0xb0, 0x06, 0x25, 0x2e, 0xb0, 0x05, 0x25, 0x7d, 0xc5, 0xb0, 0x06, 0x25, 0xb0,
-    0x05, 0x25, 0xb0, 0x04, 0x25, 0x20, 0xb0, 0x00, 0x50, 0x58, 0x21, 0xb0, 0x6a, 0x1b, 0xb0, 0x6c,
-    0x59, 0x2b, 0xb0, 0x05, 0x25, 0xb0, 0x04, 0x25, 0xb0, 0x03, 0x25, 0x20, 0xb0, 0x00, 0x50, 0x58,
-    0x21, 0xb0, 0x6a, 0x1b, 0xb0, 0x6c, 0x59, 0x2b, 0x18, 0xb0, 0x08, 0x25, 0xb0, 0x07, 0x25, 0xb0,
-    0x06, 0x25, 0xb0, 0x0a, 0x25, 0xb0, 0x6f, 0x2b, 0xb0, 0x06, 0x25, 0xb0, 0x05, 0x25, 0xb0, 0x04,
-    0x26, 0x20, 0xb0, 0x00, 0x50, 0x58, 0x21, 0xb0, 0x66, 0x1b, 0xb0, 0x68, 0x59, 0x2b, 0xb0, 0x05,
-    0x25, 0xb0, 0x04, 0x25, 0xb0, 0x04, 0x26, 0x20, 0xb0, 0x00, 0x50, 0x58, 0x21, 0xb0, 0x66, 0x1b,
-    0xb0, 0x68, 0x59, 0x2b, 0x54, 0x58, 0x7d, 0xb0, 0x04, 0x25, 0x10, 0xb0, 0x03, 0x25, 0xc5, 0xb0,
-    0x02, 0x25, 0x10, 0xb0, 0x01, 0x25, 0xc5, 0xb0, 0x05, 0x26, 0x21, 0xb0, 0x05, 0x26, 0x21, 0x1b,
-    0xb0, 0x06, 0x26, 0xb0, 0x04, 0x25, 0xb0, 0x03, 0x25, 0xb0, 0x08, 0x26, 0xb0, 0x6f, 0x2b, 0x59,
-    0xb1, 0x00, 0x02, 0x43, 0x54, 0x58, 0x7d, 0xb0, 0x02, 0x25, 0xb0, 0x82, 0x2b, 0xb0, 0x05, 0x25,
-    0xb0, 0x82, 0x2b, 0x20, 0x20, 0x69, 0x61, 0xb0, 0x04, 0x43, 0x01, 0x23, 0x61, 0xb0, 0x60, 0x60,
-    0x20, 0x69, 0x61, 0xb0, 0x20, 0x61, 0x20, 0xb0, 0x08, 0x26, 0xb0, 0x08, 0x26, 0x8a, 0xb0, 0x02,
-    0x17, 0x38, 0x8a, 0x8a, 0x61, 0x20, 0x69, 0x61, 0x61, 0xb0, 0x02, 0x17, 0x38, 0x1b, 0x21, 0x21,
-    0x21, 0x21, 0x59, 0x18, 0x2d, 0x2c, 0x4b, 0x52, 0xb1, 0x01, 0x02, 0x43, 0x53, 0x5a, 0x58, 0x23,
-    0x10, 0x20, 0x01, 0x3c, 0x00, 0x3c, 0x1b, 0x21, 0x21, 0x59, 0x2d, 0x2c, 0x23, 0xb0, 0x02, 0x25,
-    0xb0, 0x02, 0x25, 0x53, 0x58, 0x20, 0xb0, 0x04, 0x25, 0x58, 0x3c, 0x1b, 0x39, 0x59, 0xb0, 0x01,
-    0x60, 0xb8, 0xff, 0xe9, 0x1c, 0x59, 0x21, 0x21, 0x21, 0x2d, 0x2c, 0xb0, 0x02, 0x25, 0x47, 0xb0,
-    0x02, 0x25, 0x47, 0x54, 0x8a, 0x20, 0x20, 0x10, 0x11, 0xb0, 0x01, 0x60, 0x8a, 0x20, 0x12, 0xb0,
-    0x01, 0x61, 0xb0, 0x85, 0x2b, 0x2d, 0x2c, 0xb0, 0x04, 0x25, 0x47, 0xb0, 0x02, 0x25, 0x47, 0x54,
-    0x23, 0x20, 0x12, 0xb0, 0x01, 0x61, 0x23, 0x20, 0xb0, 0x06, 0x26, 0x20, 0x20, 0x10, 0x11, 0xb0,
-    0x01, 0x60, 0xb0, 0x06, 0x26, 0xb0, 0x85, 0x2b, 0x8a, 0x8a, 0xb0, 0x85, 0x2b, 0x2d, 0x2c, 0xb0,
-    0x02, 0x43, 0x54, 0x58, 0x0c, 0x02, 0x8a, 0x4b, 0x53, 0xb0, 0x04, 0x26, 0x4b, 0x51, 0x5a, 0x58,
-    0x0a, 0x38, 0x1b, 0x0a, 0x21, 0x21, 0x59, 0x1b, 0x21, 0x21, 0x21, 0x21, 0x59, 0x2d, 0x2c, 0xb0,
-    0x98, 0x2b, 0x58, 0x0c, 0x02, 0x8a, 0x4b, 0x53, 0xb0, 0x04, 0x26, 0x4b, 0x51, 0x5a, 0x58, 0x0a,
-    0x38, 0x1b, 0x0a, 0x21, 0x21, 0x59, 0x1b, 0x21, 0x21, 0x21, 0x21, 0x59, 0x2d, 0x2c, 0x20, 0xb0,
-    0x02, 0x43, 0x54, 0xb0, 0x01, 0x23, 0xb8, 0x00, 0x68, 0x23, 0x78, 0x21, 0xb1, 0x00, 0x02, 0x43,
-    0xb8, 0x00, 0x5e, 0x23, 0x79, 0x21, 0xb0, 0x02, 0x43, 0x23, 0xb0, 0x20, 0x20, 0x5c, 0x58, 0x21,
-    0x21, 0x21, 0xb0, 0x00, 0xb8, 0x00, 0x4d, 0x1c, 0x59, 0x8a, 0x8a, 0x20, 0x8a, 0x20, 0x8a, 0x23,
-    0xb8, 0x10, 0x00, 0x63, 0x56, 0x58, 0xb8, 0x10, 0x00, 0x63, 0x56, 0x58, 0x21, 0x21, 0x21, 0xb0,
-    0x01, 0xb8, 0x00, 0x30, 0x1c, 0x59, 0x1b, 0x21, 0x59, 0xb0, 0x80, 0x62, 0x20, 0x5c, 0x58, 0x21,
-    0x21, 0x21, 0xb0, 0x00, 0xb8, 0x00, 0x1d, 0x1c, 0x59, 0x23, 0xb0, 0x80, 0x62, 0x20, 0x5c, 0x58,
-    0x21, 0x21, 0x21, 0xb0, 0x00, 0xb8, 0x00, 0x0c, 0x1c, 0x59, 0x8a, 0xb0, 0x01, 0x61, 0xb8, 0xff,
-    0xab, 0x1c, 0x23, 0x21, 0x2d, 0x2c, 0x20, 0xb0, 0x02, 0x43, 0x54, 0xb0, 0x01, 0x23, 0xb8, 0x00,
-    0x81, 0x23, 0x78, 0x21, 0xb1, 0x00, 0x02, 0x43, 0xb8, 0x00, 0x77, 0x23, 0x79, 0x21, 0xb1, 0x00,
-    0x02, 0x43, 0x8a, 0xb0, 0x20, 0x20, 0x5c, 0x58, 0x21, 0x21, 0x21, 0xb8, 0x00, 0x67, 0x1c, 0x59,
-    0x8a, 0x8a, 0x20, 0x8a, 0x20, 0x8a, 0x23, 0xb8, 0x10, 0x00, 0x63, 0x56, 0x58, 0xb8, 0x10, 0x00,
-    0x63, 0x56, 0x58, 0xb0, 0x04, 0x26, 0xb0, 0x01, 0x5b, 0xb0, 0x04, 0x26, 0xb0, 0x04, 0x26, 0xb0,
-    0x04, 0x26, 0x1b, 0x21, 0x21, 0x21, 0x21, 0xb8, 0x00, 0x38, 0xb0, 0x00, 0x23, 0x1c, 0x59, 0x1b,
-    0x21, 0x59, 0xb0, 0x04, 0x26, 0x23, 0xb0, 0x80, 0x62, 0x20, 0x5c, 0x58, 0x8a, 0x5c, 0x8a, 0x5a,
-    0x23, 0x21, 0x23, 0x21, 0xb8, 0x00, 0x1e, 0x1c, 0x59, 0x8a, 0xb0, 0x80, 0x62, 0x20, 0x5c, 0x58,
-    0x21, 0x21, 0x23, 0x21, 0xb8, 0x00, 0x0e, 0x1c, 0x59, 0xb0, 0x04, 0x26, 0xb0, 0x01, 0x61, 0xb8,
-    0xff, 0x93, 0x1c, 0x23, 0x21, 0x2d, 0x00, 0x00, 0x03, 0x8c, 0x00, 0x64, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xf3, 0x00, 0x00, 0x01, 0xf3, 0x00, 0x00, 0x01, 0xcf, 0x00, 0x9a,
-    0x02, 0x4d, 0x00, 0x90, 0x04, 0xa7, 0x00, 0x55, 0x04, 0x70, 0x00, 0x74, 0x05, 0xea, 0x00, 0x6e,
-    0x04, 0xed, 0x00, 0x6d, 0x01, 0x5d, 0x00, 0x78, 0x02, 0x8e, 0x00, 0x8d, 0x02, 0x9c, 0x00, 0x22,
-    0x03, 0x65, 0x00, 0x1d, 0x04, 0x85, 0x00, 0x4c, 0x01, 0x89, 0x00, 0x3d, 0x02, 0x4b, 0x00, 0x32,
-    0x01, 0xea, 0x00, 0x92, 0x03, 0x2e, 0x00, 0x1f, 0x04, 0x70, 0x00, 0x78, 0x04, 0x70, 0x00, 0xb3,
-    0x04, 0x70, 0x00, 0x6a, 0x04, 0x70, 0x00, 0x63, 0x04, 0x70, 0x00, 0x44, 0x04, 0x70, 0x00, 0xa8,
-    0x04, 0x70, 0x00, 0x83, 0x04, 0x70, 0x00, 0x4e, 0x04, 0x70, 0x00, 0x6b, 0x04, 0x70, 0x00, 0x66,
-    0x01, 0xae, 0x00, 0x7e, 0x01, 0x8f, 0x00, 0x3d, 0x04, 0x17, 0x00, 0x4d, 0x04, 0x6d, 0x00, 0x96,
-    0x04, 0x26, 0x00, 0x7d, 0x03, 0xa3, 0x00, 0x54, 0x07, 0x4f, 0x00, 0x74, 0x05, 0x00, 0x00, 0x1f,
-    0x04, 0xe8, 0x00, 0xb9, 0x05, 0x32, 0x00, 0x84, 0x05, 0x3e, 0x00, 0xb9, 0x04, 0x8d, 0x00, 0xb9,
-    0x04, 0x80, 0x00, 0xb9, 0x05, 0x79, 0x00, 0x91, 0x05, 0xaa, 0x00, 0xb9, 0x02, 0x22, 0x00, 0xd4,
-    0x04, 0x68, 0x00, 0x48, 0x05, 0x0d, 0x00, 0xb9, 0x04, 0x38, 0x00, 0xb9, 0x06, 0xec, 0x00, 0xb9,
-    0x05, 0xaf, 0x00, 0xb9, 0x05, 0x6b, 0x00, 0x7e, 0x04, 0xed, 0x00, 0xb9, 0x05, 0x6b, 0x00, 0x7a,
-    0x05, 0x15, 0x00, 0xb6, 0x04, 0xbe, 0x00, 0x59, 0x04, 0xc7, 0x00, 0x35, 0x05, 0x43, 0x00, 0xa3,
-    0x04, 0xf0, 0x00, 0x20, 0x07, 0x2c, 0x00, 0x3d, 0x04, 0xe6, 0x00, 0x38, 0x04, 0xcb, 0x00, 0x18,
-    0x04, 0xca, 0x00, 0x5b, 0x01, 0xeb, 0x00, 0xa4, 0x03, 0x28, 0x00, 0x31, 0x01, 0xeb, 0x00, 0x01,
-    0x03, 0x55, 0x00, 0x4e, 0x03, 0x75, 0x00, 0x02, 0x02, 0x49, 0x00, 0x67, 0x04, 0x4a, 0x00, 0x65,
-    0x04, 0x70, 0x00, 0x9b, 0x04, 0x20, 0x00, 0x5f, 0x04, 0x72, 0x00, 0x6d, 0x04, 0x23, 0x00, 0x5a,
-    0x02, 0xa7, 0x00, 0x40, 0x04, 0x71, 0x00, 0x6d, 0x04, 0x65, 0x00, 0x9d, 0x01, 0xcc, 0x00, 0x96,
-    0x01, 0xd4, 0xff, 0x98, 0x03, 0xec, 0x00, 0x9d, 0x01, 0xcc, 0x00, 0xab, 0x07, 0x18, 0x00, 0x96,
-    0x04, 0x66, 0x00, 0x9d, 0x04, 0x7c, 0x00, 0x5b, 0x04, 0x70, 0x00, 0x9b, 0x04, 0x77, 0x00, 0x6d,
-    0x02, 0xb2, 0x00, 0x9d, 0x04, 0x0e, 0x00, 0x66, 0x02, 0x93, 0x00, 0x18, 0x04, 0x65, 0x00, 0x99,
-    0x03, 0xd9, 0x00, 0x26, 0x06, 0x09, 0x00, 0x3f, 0x03, 0xe5, 0x00, 0x31, 0x03, 0xce, 0x00, 0x21,
-    0x03, 0xe5, 0x00, 0x58, 0x02, 0xa5, 0x00, 0x45, 0x01, 0xc5, 0x00, 0xb3, 0x02, 0xa5, 0x00, 0x0a,
-    0x05, 0x7b, 0x00, 0x92, 0x01, 0xc5, 0x00, 0x8d, 0x04, 0x5c, 0x00, 0x78, 0x04, 0x93, 0x00, 0x5d,
-    0x05, 0xca, 0x00, 0x6e, 0x04, 0x21, 0x00, 0x18, 0x01, 0xbd, 0x00, 0xa0, 0x04, 0xd8, 0x00, 0x67,
-    0x03, 0x72, 0x00, 0x8a, 0x06, 0x66, 0x00, 0x6c, 0x03, 0x8b, 0x00, 0x9e, 0x03, 0xa5, 0x00, 0x7b,
-    0x04, 0x5e, 0x00, 0x7d, 0x06, 0x6a, 0x00, 0x67, 0x03, 0x6b, 0x00, 0x8a, 0x03, 0x06, 0x00, 0x90,
-    0x04, 0x3e, 0x00, 0x55, 0x02, 0xe4, 0x00, 0x4c, 0x02, 0xe4, 0x00, 0x48, 0x02, 0x41, 0x00, 0x7d,
-    0x04, 0x75, 0x00, 0xa3, 0x03, 0xce, 0x00, 0x54, 0x01, 0xf8, 0x00, 0xa4, 0x01, 0xf3, 0x00, 0x63,
-    0x02, 0xe4, 0x00, 0x7f, 0x03, 0x9b, 0x00, 0x88, 0x03, 0xa1, 0x00, 0x74, 0x05, 0xcc, 0x00, 0x73,
-    0x06, 0x0d, 0x00, 0x65, 0x06, 0x36, 0x00, 0x76, 0x03, 0xad, 0x00, 0x58, 0x07, 0x49, 0x00, 0x12,
-    0x04, 0x31, 0x00, 0x5e, 0x05, 0x6b, 0x00, 0x7e, 0x04, 0xbf, 0x00, 0xb8, 0x04, 0xb1, 0x00, 0x98,
-    0x06, 0xc5, 0x00, 0x56, 0x04, 0xa8, 0x00, 0x96, 0x04, 0x8d, 0x00, 0x48, 0x04, 0x75, 0x00, 0x5a,
-    0x04, 0x7f, 0x00, 0xa0, 0x04, 0x95, 0x00, 0x6d, 0x05, 0x84, 0x00, 0x19, 0x01, 0xc9, 0x00, 0xa9,
-    0x04, 0x58, 0x00, 0xa3, 0x04, 0x3a, 0x00, 0x16, 0x02, 0x12, 0x00, 0x1a, 0x05, 0x9b, 0x00, 0xb5,
-    0x04, 0x75, 0x00, 0x9e, 0x07, 0x79, 0x00, 0x6d, 0x07, 0x64, 0x00, 0x5f, 0x01, 0xd1, 0x00, 0xa8,
-    0x05, 0x9a, 0x00, 0x7d, 0x02, 0x9f, 0xff, 0xc5, 0x05, 0x95, 0x00, 0x85, 0x04, 0x7b, 0x00, 0x5a,
-    0x05, 0x73, 0x00, 0xa3, 0x04, 0xb0, 0x00, 0x99, 0x01, 0xd5, 0xff, 0x8c, 0x04, 0x20, 0x00, 0x5d,
-    0x03, 0x70, 0x00, 0xa1, 0x03, 0x45, 0x00, 0x90, 0x03, 0x6b, 0x00, 0x8a, 0x03, 0x62, 0x00, 0x8b,
-    0x01, 0xcc, 0x00, 0x95, 0x02, 0x7c, 0x00, 0x76, 0x02, 0x01, 0x00, 0x3d, 0x03, 0x7c, 0x00, 0x6b,
-    0x03, 0x06, 0x00, 0x79, 0x02, 0x6e, 0x00, 0x9e, 0x00, 0x00, 0xfc, 0xe0, 0x00, 0x00, 0xfd, 0x98,
-    0x00, 0x00, 0xfc, 0xaa, 0x00, 0x00, 0xfd, 0x6c, 0x00, 0x00, 0xfc, 0x2f, 0x00, 0x00, 0xfd, 0x60,
-    0x02, 0x08, 0x00, 0xc8, 0x03, 0xd6, 0x00, 0x9a, 0x01, 0xf8, 0x00, 0xa4, 0x04, 0x6b, 0x00, 0xba,
-    0x05, 0x94, 0x00, 0x2d, 0x05, 0x63, 0x00, 0x76, 0x05, 0x30, 0x00, 0x45, 0x04, 0x7a, 0x00, 0x74,
-    0x05, 0xaa, 0x00, 0xbd, 0x04, 0x7a, 0x00, 0x40, 0x05, 0xb9, 0x00, 0x59, 0x05, 0x8f, 0x00, 0x7b,
-    0x05, 0x3e, 0x00, 0x78, 0x04, 0x82, 0x00, 0x6f, 0x04, 0xbd, 0x00, 0xb2, 0x03, 0xeb, 0x00, 0x2d,
-    0x04, 0x75, 0x00, 0x5c, 0x04, 0x5a, 0x00, 0x6c, 0x03, 0xf0, 0x00, 0x4a, 0x04, 0x75, 0x00, 0x9f,
-    0x04, 0x96, 0x00, 0x8b, 0x02, 0x67, 0x00, 0xb7, 0x04, 0x68, 0x00, 0x32, 0x03, 0xed, 0x00, 0x78,
-    0x04, 0xc4, 0x00, 0x34, 0x04, 0x75, 0x00, 0x9f, 0x04, 0x48, 0x00, 0x70, 0x04, 0x73, 0x00, 0x5c,
-    0x04, 0x18, 0x00, 0x4d, 0x04, 0x48, 0x00, 0x9c, 0x05, 0x7c, 0x00, 0x72, 0x05, 0x78, 0x00, 0x7a,
-    0x06, 0x99, 0x00, 0x89, 0x04, 0x98, 0x00, 0x86, 0x04, 0x4b, 0xff, 0xd1, 0x06, 0x4a, 0x00, 0x39,
-    0x05, 0xf5, 0x00, 0x37, 0x05, 0x49, 0x00, 0x86, 0x08, 0x72, 0x00, 0x34, 0x08, 0xa3, 0x00, 0xbb,
-    0x06, 0x70, 0x00, 0x36, 0x05, 0xa4, 0x00, 0xba, 0x05, 0x06, 0x00, 0xb2, 0x05, 0xcb, 0x00, 0x48,
-    0x07, 0x0a, 0x00, 0x17, 0x04, 0xc3, 0x00, 0x5a, 0x05, 0xaf, 0x00, 0xbd, 0x05, 0x9f, 0x00, 0x29,
-    0x05, 0x06, 0x00, 0x37, 0x05, 0xf2, 0x00, 0x4d, 0x05, 0xb6, 0x00, 0xb4, 0x05, 0x54, 0x00, 0xad,
-    0x07, 0x69, 0x00, 0xb6, 0x07, 0x8b, 0x00, 0xb6, 0x06, 0x32, 0xff, 0xf6, 0x06, 0xae, 0x00, 0xba,
-    0x04, 0xe6, 0x00, 0xb2, 0x05, 0x49, 0x00, 0x8e, 0x07, 0x48, 0x00, 0xd2, 0x04, 0xe4, 0x00, 0x5d,
-    0x04, 0x68, 0x00, 0x62, 0x04, 0x7a, 0x00, 0xaa, 0x03, 0x60, 0x00, 0xa4, 0x04, 0x96, 0x00, 0x35,
-    0x06, 0x24, 0x00, 0x19, 0x04, 0x0e, 0x00, 0x63, 0x04, 0x80, 0x00, 0xa5, 0x04, 0x26, 0x00, 0xa4,
-    0x04, 0x81, 0x00, 0x2c, 0x05, 0xda, 0x00, 0xaa, 0x04, 0x7f, 0x00, 0xa5, 0x04, 0x80, 0x00, 0xa5,
-    0x03, 0xce, 0x00, 0x28, 0x05, 0xcd, 0x00, 0x6f, 0x04, 0x8f, 0x00, 0xa5, 0x04, 0x43, 0x00, 0x6f,
-    0x06, 0x5a, 0x00, 0xa5, 0x06, 0x6c, 0x00, 0x9f, 0x05, 0x0a, 0x00, 0x23, 0x06, 0x02, 0x00, 0xaa,
-    0x04, 0x48, 0x00, 0xaa, 0x04, 0x48, 0x00, 0x6f, 0x06, 0x82, 0x00, 0xaa, 0x04, 0x59, 0x00, 0x5d,
-    0x04, 0x65, 0xff, 0xe5, 0x04, 0x48, 0x00, 0x6c, 0x06, 0xd7, 0x00, 0x25, 0x06, 0xe4, 0x00, 0xa5,
-    0x04, 0x75, 0xff, 0xf0, 0x04, 0x80, 0x00, 0xa5, 0x07, 0x1b, 0x00, 0xab, 0x06, 0x97, 0x00, 0x9d,
-    0x04, 0x48, 0xff, 0xe2, 0x07, 0x27, 0x00, 0xd3, 0x05, 0xf4, 0x00, 0xa7, 0x04, 0xce, 0x00, 0x25,
-    0x04, 0x39, 0x00, 0x1a, 0x07, 0x07, 0x00, 0xe5, 0x06, 0x07, 0x00, 0xca, 0x06, 0x86, 0x00, 0x9d,
-    0x05, 0xa8, 0x00, 0x9f, 0x08, 0xa6, 0x00, 0xd2, 0x07, 0x6b, 0x00, 0xa9, 0x04, 0x1f, 0x00, 0x75,
-    0x03, 0xe0, 0x00, 0x5e, 0x05, 0x63, 0x00, 0x76, 0x04, 0x87, 0x00, 0x5a, 0x04, 0xee, 0x00, 0x1d,
-    0x03, 0xf2, 0x00, 0x2d, 0x05, 0x63, 0x00, 0x76, 0x04, 0x75, 0x00, 0x5a, 0x07, 0x11, 0x00, 0xab,
-    0x06, 0x64, 0x00, 0x8d, 0x07, 0x1b, 0x00, 0xab, 0x06, 0x97, 0x00, 0x9d, 0x05, 0x10, 0x00, 0x83,
-    0x04, 0x30, 0x00, 0x6f, 0x04, 0xe2, 0x00, 0x88, 0x00, 0x00, 0xfc, 0xa2, 0x00, 0x00, 0xfc, 0x7f,
-    0x00, 0x00, 0xfd, 0x74, 0x00, 0x00, 0xfd, 0xa7, 0x00, 0x00, 0xfa, 0x1f, 0x00, 0x00, 0xfa, 0x28,
-    0x05, 0xb3, 0x00, 0xbd, 0x04, 0x93, 0x00, 0xa5, 0x04, 0x48, 0xff, 0xe2, 0x05, 0x0e, 0x00, 0xb5,
-    0x04, 0x85, 0x00, 0x9b, 0x04, 0x63, 0x00, 0xb2, 0x03, 0x81, 0x00, 0x9f, 0x04, 0x9e, 0x00, 0xba,
-    0x03, 0xfc, 0x00, 0x9f, 0x07, 0x52, 0x00, 0x17, 0x06, 0x35, 0x00, 0x19, 0x05, 0x59, 0x00, 0xbd,
-    0x04, 0x7a, 0x00, 0xa4, 0x04, 0xe9, 0x00, 0xb4, 0x04, 0x53, 0x00, 0xa3, 0x06, 0x76, 0x00, 0x52,
-    0x05, 0x48, 0x00, 0x34, 0x05, 0xa9, 0x00, 0xb9, 0x04, 0x89, 0x00, 0xa5, 0x08, 0x10, 0x00, 0xb6,
-    0x05, 0xcb, 0x00, 0x9f, 0x08, 0x28, 0x00, 0xb2, 0x06, 0xd1, 0x00, 0x9f, 0x05, 0xf3, 0x00, 0x7b,
-    0x04, 0xc1, 0x00, 0x77, 0x04, 0xf8, 0x00, 0x38, 0x03, 0xf3, 0x00, 0x31, 0x06, 0xf3, 0x00, 0x23,
-    0x05, 0x3b, 0x00, 0x1d, 0x05, 0x51, 0x00, 0xad, 0x04, 0x4d, 0x00, 0x6f, 0x05, 0x4f, 0x00, 0xad,
-    0x04, 0x67, 0x00, 0x98, 0x05, 0x4f, 0x00, 0xa6, 0x06, 0x0b, 0x00, 0x25, 0x04, 0xb9, 0xff, 0xf6,
-    0x04, 0xe9, 0x00, 0xb4, 0x04, 0x38, 0x00, 0xa3, 0x05, 0xa5, 0x00, 0x29, 0x04, 0x94, 0x00, 0x2c,
-    0x05, 0xa4, 0x00, 0xbb, 0x04, 0x75, 0x00, 0x9f, 0x05, 0xb2, 0x00, 0xb9, 0x04, 0x92, 0x00, 0xa5,
-    0x06, 0xef, 0x00, 0xb9, 0x05, 0xee, 0x00, 0xaa, 0x05, 0x9a, 0x00, 0x7d, 0x04, 0x9b, 0x00, 0x71,
-    0x04, 0x9b, 0x00, 0x72, 0x04, 0x8d, 0x00, 0x19, 0x03, 0x87, 0x00, 0x11, 0x05, 0x03, 0x00, 0x38,
-    0x03, 0xfe, 0x00, 0x31, 0x04, 0x96, 0x00, 0x4b, 0x06, 0x40, 0x00, 0x4d, 0x06, 0xe0, 0x00, 0x6f,
-    0x06, 0x52, 0x00, 0x34, 0x05, 0x27, 0x00, 0x2f, 0x04, 0x45, 0x00, 0x63, 0x04, 0x03, 0x00, 0x71,
-    0x07, 0xbd, 0x00, 0x43, 0x06, 0x71, 0x00, 0x33, 0x07, 0xcb, 0x00, 0xbe, 0x06, 0x9d, 0x00, 0x97,
-    0x04, 0xf2, 0x00, 0x88, 0x04, 0x19, 0x00, 0x76, 0x05, 0xa9, 0x00, 0x22, 0x05, 0x1c, 0x00, 0x44,
-    0x05, 0x49, 0x00, 0x91, 0x05, 0xa8, 0x00, 0x29, 0x04, 0x97, 0x00, 0x2c, 0x02, 0xb7, 0x00, 0x60,
-    0x04, 0x14, 0x00, 0x00, 0x08, 0x29, 0x00, 0x00, 0x04, 0x14, 0x00, 0x00, 0x08, 0x29, 0x00, 0x00,
-    0x02, 0xb9, 0x00, 0x00, 0x02, 0x0a, 0x00, 0x00, 0x01, 0x5c, 0x00, 0x00, 0x04, 0x7f, 0x00, 0x00,
-    0x02, 0x30, 0x00, 0x00, 0x01, 0xa2, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0x42, 0x00, 0x32, 0x02, 0x42, 0x00, 0x32, 0x05, 0x36, 0x00, 0x9f,
-    0x06, 0x2c, 0x00, 0x7f, 0x03, 0xa1, 0x00, 0x2d, 0x01, 0x6d, 0x00, 0x63, 0x01, 0x6d, 0x00, 0x3f,
-    0x01, 0x62, 0x00, 0x2a, 0x01, 0x6d, 0x00, 0x5a, 0x02, 0x64, 0x00, 0x64, 0x02, 0x69, 0x00, 0x45,
-    0x02, 0x52, 0x00, 0x2a, 0x04, 0x68, 0x00, 0x44, 0x04, 0x83, 0x00, 0x55, 0x02, 0x97, 0x00, 0x93,
-    0x03, 0xa1, 0x00, 0xa7, 0x05, 0x21, 0x00, 0xa7, 0x01, 0x5b, 0x00, 0x5b, 0x07, 0xce, 0x00, 0x5c,
-    0x02, 0x62, 0x00, 0x6c, 0x02, 0x62, 0x00, 0x62, 0x03, 0x96, 0x00, 0x3f, 0x02, 0xe4, 0x00, 0x58,
-    0x02, 0xe4, 0x00, 0x3c, 0x02, 0xe4, 0x00, 0x6d, 0x02, 0xe4, 0x00, 0x61, 0x02, 0xe4, 0x00, 0x3f,
-    0x02, 0xe4, 0x00, 0x50, 0x02, 0xe4, 0x00, 0x4c, 0x03, 0x26, 0x00, 0x50, 0x02, 0xd4, 0x00, 0x50,
-    0x02, 0xd3, 0x00, 0x50, 0x01, 0xef, 0x00, 0x66, 0x01, 0xef, 0x00, 0x50, 0x03, 0x5f, 0x00, 0x7b,
-    0x02, 0xe4, 0x00, 0x58, 0x02, 0xe4, 0x00, 0x7f, 0x02, 0xe4, 0x00, 0x4c, 0x02, 0xe4, 0x00, 0x48,
-    0x02, 0xe4, 0x00, 0x3c, 0x02, 0xe4, 0x00, 0x6d, 0x02, 0xe4, 0x00, 0x61, 0x02, 0xe4, 0x00, 0x3f,
-    0x02, 0xe4, 0x00, 0x50, 0x02, 0xe4, 0x00, 0x4c, 0x03, 0x26, 0x00, 0x50, 0x02, 0xd4, 0x00, 0x50,
-    0x02, 0xd3, 0x00, 0x50, 0x01, 0xef, 0x00, 0x66, 0x01, 0xef, 0x00, 0x50, 0x04, 0x93, 0x00, 0x61,
-    0x06, 0x28, 0x00, 0x24, 0x06, 0x8c, 0x00, 0xb9, 0x08, 0x5f, 0x00, 0xb6, 0x06, 0x14, 0x00, 0x24,
-    0x06, 0x1a, 0x00, 0x9b, 0x04, 0x70, 0x00, 0x54, 0x05, 0x7e, 0x00, 0x24, 0x03, 0xe9, 0x00, 0x34,
-    0x04, 0x1b, 0x00, 0x2d, 0x05, 0x41, 0x00, 0x6b, 0x05, 0x23, 0x00, 0x24, 0x05, 0xe3, 0x00, 0x77,
-    0x03, 0xb9, 0x00, 0x5b, 0x08, 0x29, 0x00, 0xb1, 0x04, 0xf0, 0x00, 0x6c, 0x05, 0x13, 0x00, 0x96,
-    0x06, 0x1f, 0x00, 0x63, 0x06, 0xdc, 0x00, 0x81, 0x06, 0xc4, 0x00, 0x79, 0x06, 0x6a, 0x00, 0x6c,
-    0x04, 0x92, 0x00, 0x6a, 0x05, 0x43, 0x00, 0xaf, 0x04, 0x9f, 0x00, 0x40, 0x04, 0x91, 0x00, 0xa6,
-    0x04, 0x5f, 0x00, 0x40, 0x08, 0x75, 0x00, 0x78, 0x02, 0x08, 0xff, 0x88, 0x04, 0x82, 0x00, 0x65,
-    0x04, 0x6d, 0x00, 0x96, 0x04, 0x17, 0x00, 0x44, 0x04, 0x26, 0x00, 0x77, 0x04, 0x0a, 0x00, 0x38,
-    0x02, 0x08, 0x00, 0xa8, 0x02, 0x4d, 0x00, 0x76, 0x01, 0xe8, 0x00, 0x7a, 0x04, 0xc3, 0x00, 0x40,
-    0x04, 0x4d, 0x00, 0x31, 0x04, 0x5b, 0x00, 0x40, 0x06, 0xa0, 0x00, 0x40, 0x06, 0xa0, 0x00, 0x40,
-    0x04, 0xbf, 0x00, 0x40, 0x06, 0x7c, 0x00, 0x66, 0x00, 0x00, 0x00, 0x00, 0x08, 0x2f, 0x00, 0x59,
-    0x08, 0x35, 0x00, 0x5c, 0x02, 0xe4, 0x00, 0x4c, 0x02, 0xe4, 0x00, 0x7f, 0x02, 0xe4, 0x00, 0x58,
-    0x04, 0x01, 0x00, 0x56, 0x04, 0x01, 0x00, 0x5d, 0x04, 0x01, 0x00, 0x44, 0x04, 0x01, 0x00, 0x7b,
-    0x04, 0x01, 0x00, 0x92, 0x04, 0x01, 0x00, 0x3d, 0x04, 0x01, 0x00, 0x56, 0x04, 0x01, 0x00, 0x5b,
-    0x04, 0x01, 0x00, 0xa0, 0x04, 0x01, 0x00, 0x6a, 0x04, 0x20, 0x00, 0x4c, 0x04, 0x24, 0x00, 0x16,
-    0x04, 0x3a, 0x00, 0x2b, 0x06, 0x27, 0x00, 0x33, 0x04, 0x44, 0x00, 0x19, 0x04, 0x88, 0x00, 0x89,
-    0x04, 0x22, 0x00, 0x2c, 0x04, 0x19, 0x00, 0x4b, 0x04, 0x63, 0x00, 0x98, 0x04, 0xaa, 0x00, 0x66,
-    0x04, 0x41, 0x00, 0x9b, 0x04, 0xaa, 0x00, 0x69, 0x04, 0xe1, 0x00, 0x9b, 0x05, 0xf5, 0x00, 0x9b,
-    0x03, 0xa3, 0x00, 0x9b, 0x04, 0x59, 0x00, 0x9b, 0x03, 0xcb, 0x00, 0x3c, 0x01, 0xdb, 0x00, 0xb2,
-    0x04, 0xdd, 0x00, 0x9b, 0x04, 0xb2, 0x00, 0x79, 0x03, 0xdd, 0x00, 0x9b, 0x04, 0x19, 0x00, 0x4b,
-    0x04, 0x07, 0x00, 0x2a, 0x03, 0xa3, 0x00, 0x16, 0x03, 0xb1, 0x00, 0x9b, 0x04, 0x44, 0x00, 0x19,
-    0x04, 0xaa, 0x00, 0x69, 0x04, 0x44, 0x00, 0x19, 0x03, 0x94, 0x00, 0x47, 0x04, 0xc5, 0x00, 0x9b,
-    0x03, 0xe1, 0x00, 0x3c, 0x05, 0x5f, 0x00, 0x6a, 0x04, 0xf0, 0x00, 0x6a, 0x04, 0xe8, 0x00, 0x81,
-    0x05, 0x54, 0x00, 0x23, 0x04, 0x79, 0x00, 0x6e, 0x07, 0x37, 0x00, 0x26, 0x07, 0x46, 0x00, 0x9b,
-    0x05, 0x5a, 0x00, 0x2c, 0x04, 0xc5, 0x00, 0x9b, 0x04, 0x42, 0x00, 0x9b, 0x05, 0x09, 0x00, 0x35,
-    0x06, 0x1a, 0x00, 0x25, 0x04, 0x36, 0x00, 0x4f, 0x04, 0xe8, 0x00, 0x9b, 0x04, 0x41, 0x00, 0xa1,
-    0x04, 0xb0, 0x00, 0x26, 0x04, 0x15, 0x00, 0x21, 0x05, 0x0e, 0x00, 0x9b, 0x04, 0x4c, 0x00, 0x43,
-    0x06, 0x17, 0x00, 0x9b, 0x06, 0x60, 0x00, 0x9b, 0x05, 0x08, 0x00, 0x05, 0x05, 0x90, 0x00, 0x9b,
-    0x04, 0x34, 0x00, 0x9b, 0x04, 0x75, 0x00, 0x5f, 0x06, 0x49, 0x00, 0x9b, 0x04, 0x6e, 0x00, 0x50,
-    0x04, 0x1d, 0x00, 0x10, 0x06, 0x58, 0x00, 0x25, 0x04, 0x64, 0x00, 0xa1, 0x04, 0xae, 0x00, 0xa1,
-    0x05, 0x1d, 0x00, 0x12, 0x05, 0xba, 0x00, 0x69, 0x04, 0x52, 0x00, 0x16, 0x04, 0x85, 0x00, 0x2b,
-    0x06, 0x39, 0x00, 0x23, 0x04, 0x4c, 0x00, 0x43, 0x04, 0x4c, 0x00, 0x9b, 0x05, 0x93, 0x00, 0x0b,
-    0x04, 0xaa, 0x00, 0x5f, 0x04, 0x36, 0x00, 0x4f, 0x04, 0xaa, 0x00, 0x69, 0x04, 0x07, 0x00, 0x2a,
-    0x03, 0xbf, 0x00, 0x36, 0x07, 0xdc, 0x00, 0x9b, 0x04, 0x9a, 0x00, 0x28, 0x02, 0xe4, 0x00, 0x48,
-    0x02, 0xe4, 0x00, 0x3c, 0x02, 0xe4, 0x00, 0x6d, 0x02, 0xe4, 0x00, 0x61, 0x02, 0xe4, 0x00, 0x3f,
-    0x02, 0xe4, 0x00, 0x50, 0x02, 0xe4, 0x00, 0x4c, 0x03, 0x61, 0x00, 0x7e, 0x02, 0xa5, 0x00, 0xb1,
-    0x03, 0xe8, 0x00, 0x9b, 0x04, 0x37, 0x00, 0x3d, 0x04, 0xac, 0x00, 0x6f, 0x05, 0x44, 0x00, 0xbb,
-    0x05, 0x1c, 0x00, 0xbd, 0x03, 0xef, 0x00, 0xa0, 0x05, 0x29, 0x00, 0xbd, 0x03, 0xd6, 0x00, 0xa0,
-    0x04, 0x80, 0x00, 0x9b, 0x04, 0x79, 0x00, 0x6e, 0x04, 0x3d, 0x00, 0x9b, 0x04, 0x54, 0x00, 0x18,
-    0x01, 0xc7, 0x00, 0x97, 0x03, 0xa0, 0x00, 0x8b, 0x00, 0x00, 0xfc, 0xb6, 0x03, 0x5f, 0x00, 0x5d,
-    0x03, 0x76, 0xff, 0x90, 0x04, 0x0a, 0x00, 0x6e, 0x03, 0x7a, 0x00, 0x6e, 0x03, 0xb1, 0x00, 0x9b,
-    0x03, 0x83, 0x00, 0x8b, 0x03, 0x7e, 0x00, 0x8b, 0x02, 0xe4, 0x00, 0x58, 0x02, 0xe4, 0x00, 0x3c,
-    0x02, 0xe4, 0x00, 0x6d, 0x02, 0xe4, 0x00, 0x61, 0x02, 0xe4, 0x00, 0x3f, 0x02, 0xe4, 0x00, 0x50,
-    0x02, 0xe4, 0x00, 0x4c, 0x05, 0x5d, 0x00, 0x80, 0x05, 0xa2, 0x00, 0x80, 0x05, 0x79, 0x00, 0xbd,
-    0x05, 0xb5, 0x00, 0x80, 0x05, 0xb7, 0x00, 0x80, 0x03, 0xd5, 0x00, 0xa0, 0x04, 0x82, 0x00, 0x83,
-    0x04, 0x5e, 0x00, 0x0f, 0x04, 0xcc, 0x00, 0x3e, 0x04, 0x6b, 0x00, 0x65, 0x04, 0x2e, 0x00, 0x4a,
-    0x03, 0xa0, 0x00, 0x96, 0x01, 0x95, 0x00, 0x8f, 0x06, 0xaf, 0x00, 0x69, 0x04, 0x9d, 0x00, 0x71,
-    0x01, 0xd1, 0xff, 0x8d, 0x04, 0x70, 0x00, 0x3c, 0x04, 0x70, 0x00, 0x6e, 0x04, 0x70, 0x00, 0x1b,
-    0x04, 0x70, 0x00, 0x72, 0x04, 0x70, 0x00, 0x6c, 0x04, 0x70, 0x00, 0x38, 0x04, 0x70, 0x00, 0x7c,
-    0x04, 0x70, 0x00, 0x63, 0x04, 0x70, 0x00, 0x69, 0x04, 0x70, 0x01, 0x10, 0x01, 0xe2, 0xff, 0x8c,
-    0x01, 0xd5, 0xff, 0x8c, 0x01, 0xc9, 0x00, 0xa9, 0x01, 0xc9, 0xff, 0xfa, 0x01, 0xc9, 0x00, 0xa9,
-    0x04, 0x3d, 0x00, 0x9b, 0x04, 0xf9, 0x00, 0x7d, 0x03, 0xfb, 0x00, 0x39, 0x04, 0x6f, 0x00, 0x9b,
-    0x04, 0x2d, 0x00, 0x61, 0x04, 0x79, 0x00, 0x60, 0x04, 0x77, 0x00, 0x60, 0x04, 0x83, 0x00, 0x5a,
-    0x04, 0x77, 0x00, 0x9b, 0x04, 0x7e, 0x00, 0x60, 0x04, 0x23, 0x00, 0x5a, 0x04, 0x71, 0x00, 0x6d,
-    0x04, 0x45, 0x00, 0x40, 0x03, 0x82, 0x00, 0x71, 0x04, 0xdb, 0x00, 0x79, 0x03, 0xa3, 0x00, 0x05,
-    0x06, 0x26, 0x00, 0x0f, 0x03, 0xdd, 0x00, 0x9b, 0x04, 0xaa, 0x00, 0x69, 0x04, 0xdc, 0x00, 0x3f,
-    0x04, 0xe1, 0x00, 0x9b, 0x01, 0xf3, 0x00, 0x00, 0x02, 0x4b, 0x00, 0x32, 0x05, 0x5c, 0x00, 0x40,
-    0x05, 0x5c, 0x00, 0x40, 0x04, 0x83, 0x00, 0x1f, 0x04, 0xc7, 0x00, 0x35, 0x02, 0x93, 0x00, 0x0f,
-    0x05, 0x00, 0x00, 0x1f, 0x05, 0x00, 0x00, 0x1f, 0x05, 0x00, 0x00, 0x1f, 0x05, 0x00, 0x00, 0x1f,
-    0x05, 0x00, 0x00, 0x1f, 0x05, 0x00, 0x00, 0x1f, 0x05, 0x00, 0x00, 0x1f, 0x05, 0x32, 0x00, 0x84,
-    0x04, 0x8d, 0x00, 0xb9, 0x04, 0x8d, 0x00, 0xb9, 0x04, 0x8d, 0x00, 0xb9, 0x04, 0x8d, 0x00, 0xb9,
-    0x02, 0x22, 0x00, 0x0c, 0x02, 0x22, 0x00, 0xcb, 0x02, 0x22, 0xff, 0xfe, 0x02, 0x22, 0xff, 0xe7,
-    0x05, 0xaf, 0x00, 0xb9, 0x05, 0x6b, 0x00, 0x7e, 0x05, 0x6b, 0x00, 0x7e, 0x05, 0x6b, 0x00, 0x7e,
-    0x05, 0x6b, 0x00, 0x7e, 0x05, 0x6b, 0x00, 0x7e, 0x05, 0x43, 0x00, 0xa3, 0x05, 0x43, 0x00, 0xa3,
-    0x05, 0x43, 0x00, 0xa3, 0x05, 0x43, 0x00, 0xa3, 0x04, 0xcb, 0x00, 0x18, 0x04, 0x4a, 0x00, 0x65,
-    0x04, 0x4a, 0x00, 0x65, 0x04, 0x4a, 0x00, 0x65, 0x04, 0x4a, 0x00, 0x65, 0x04, 0x4a, 0x00, 0x65,
-    0x04, 0x4a, 0x00, 0x65, 0x04, 0x4a, 0x00, 0x65, 0x04, 0x20, 0x00, 0x5f, 0x04, 0x23, 0x00, 0x5a,
-    0x04, 0x23, 0x00, 0x5a, 0x04, 0x23, 0x00, 0x5a, 0x04, 0x23, 0x00, 0x5a, 0x01, 0xc9, 0xff, 0xe1,
-    0x01, 0xc9, 0x00, 0xa0, 0x01, 0xc9, 0xff, 0xd3, 0x01, 0xc9, 0xff, 0xbc, 0x04, 0x66, 0x00, 0x9d,
-    0x04, 0x7c, 0x00, 0x5b, 0x04, 0x7c, 0x00, 0x5b, 0x04, 0x7c, 0x00, 0x5b, 0x04, 0x7c, 0x00, 0x5b,
-    0x04, 0x7c, 0x00, 0x5b, 0x04, 0x65, 0x00, 0x99, 0x04, 0x65, 0x00, 0x99, 0x04, 0x65, 0x00, 0x99,
-    0x04, 0x65, 0x00, 0x99, 0x03, 0xce, 0x00, 0x21, 0x03, 0xce, 0x00, 0x21, 0x05, 0x00, 0x00, 0x1f,
-    0x04, 0x4a, 0x00, 0x65, 0x05, 0x00, 0x00, 0x1f, 0x04, 0x4a, 0x00, 0x65, 0x05, 0x00, 0x00, 0x1f,
-    0x04, 0x4a, 0x00, 0x65, 0x05, 0x32, 0x00, 0x84, 0x04, 0x20, 0x00, 0x5f, 0x05, 0x32, 0x00, 0x84,
-    0x04, 0x20, 0x00, 0x5f, 0x05, 0x32, 0x00, 0x84, 0x04, 0x20, 0x00, 0x5f, 0x05, 0x32, 0x00, 0x84,
-    0x04, 0x20, 0x00, 0x5f, 0x05, 0x3e, 0x00, 0xb9, 0x05, 0x08, 0x00, 0x6d, 0x04, 0x8d, 0x00, 0xb9,
-    0x04, 0x23, 0x00, 0x5a, 0x04, 0x8d, 0x00, 0xb9, 0x04, 0x23, 0x00, 0x5a, 0x04, 0x8d, 0x00, 0xb9,
-    0x04, 0x23, 0x00, 0x5a, 0x04, 0x8d, 0x00, 0xb9, 0x04, 0x23, 0x00, 0x5a, 0x04, 0x8d, 0x00, 0xb9,
-    0x04, 0x23, 0x00, 0x5a, 0x05, 0x79, 0x00, 0x91, 0x04, 0x71, 0x00, 0x6d, 0x05, 0x79, 0x00, 0x91,
-    0x04, 0x71, 0x00, 0x6d, 0x05, 0x79, 0x00, 0x91, 0x04, 0x71, 0x00, 0x6d, 0x05, 0x79, 0x00, 0x91,
-    0x04, 0x71, 0x00, 0x6d, 0x05, 0xaa, 0x00, 0xb9, 0x04, 0x65, 0x00, 0x9d, 0x02, 0x22, 0xff, 0xc6,
-    0x01, 0xc9, 0xff, 0x9b, 0x02, 0x22, 0xff, 0xe0, 0x01, 0xc9, 0xff, 0xb5, 0x02, 0x22, 0xff, 0xf0,
-    0x01, 0xc9, 0xff, 0xc5, 0x02, 0x22, 0x00, 0x26, 0x01, 0xcc, 0xff, 0xfb, 0x02, 0x22, 0x00, 0xc0,
-    0x06, 0x89, 0x00, 0xd4, 0x03, 0xa0, 0x00, 0x96, 0x04, 0x68, 0x00, 0x48, 0x01, 0xd5, 0xff, 0x8c,
-    0x05, 0x0d, 0x00, 0xb9, 0x03, 0xec, 0x00, 0x9d, 0x04, 0x38, 0x00, 0xb1, 0x01, 0xcc, 0x00, 0xa1,
-    0x04, 0x38, 0x00, 0xb9, 0x01, 0xcc, 0x00, 0x67, 0x04, 0x38, 0x00, 0xb9, 0x02, 0x62, 0x00, 0xab,
-    0x04, 0x38, 0x00, 0xb9, 0x02, 0xa8, 0x00, 0xab, 0x05, 0xaf, 0x00, 0xb9, 0x04, 0x66, 0x00, 0x9d,
-    0x05, 0xaf, 0x00, 0xb9, 0x04, 0x66, 0x00, 0x9d, 0x05, 0xaf, 0x00, 0xb9, 0x04, 0x66, 0x00, 0x9d,
-    0x04, 0x66, 0xff, 0xd0, 0x05, 0x6b, 0x00, 0x7e, 0x04, 0x7c, 0x00, 0x5b, 0x05, 0x6b, 0x00, 0x7e,
-    0x04, 0x7c, 0x00, 0x5b, 0x05, 0x6b, 0x00, 0x7e, 0x04, 0x7c, 0x00, 0x5b, 0x05, 0x15, 0x00, 0xb6,
-    0x02, 0xb2, 0x00, 0x9d, 0x05, 0x15, 0x00, 0xb6, 0x02, 0xb2, 0x00, 0x5e, 0x05, 0x15, 0x00, 0xb6,
-    0x02, 0xb2, 0x00, 0x83, 0x04, 0xbe, 0x00, 0x59, 0x04, 0x0e, 0x00, 0x66, 0x04, 0xbe, 0x00, 0x59,
-    0x04, 0x0e, 0x00, 0x66, 0x04, 0xbe, 0x00, 0x59, 0x04, 0x0e, 0x00, 0x66, 0x04, 0xbe, 0x00, 0x59,
-    0x04, 0x0e, 0x00, 0x66, 0x04, 0xbe, 0x00, 0x59, 0x04, 0x0e, 0x00, 0x66, 0x04, 0xc7, 0x00, 0x35,
-    0x02, 0x93, 0x00, 0x18, 0x04, 0xc7, 0x00, 0x35, 0x02, 0x93, 0x00, 0x18, 0x04, 0xc7, 0x00, 0x35,
-    0x02, 0xbb, 0x00, 0x18, 0x05, 0x43, 0x00, 0xa3, 0x04, 0x65, 0x00, 0x99, 0x05, 0x43, 0x00, 0xa3,
-    0x04, 0x65, 0x00, 0x99, 0x05, 0x43, 0x00, 0xa3, 0x04, 0x65, 0x00, 0x99, 0x05, 0x43, 0x00, 0xa3,
-    0x04, 0x65, 0x00, 0x99, 0x05, 0x43, 0x00, 0xa3, 0x04, 0x65, 0x00, 0x99, 0x05, 0x43, 0x00, 0xa3,
-    0x04, 0x65, 0x00, 0x99, 0x07, 0x2c, 0x00, 0x3d, 0x06, 0x09, 0x00, 0x3f, 0x04, 0xcb, 0x00, 0x18,
-    0x03, 0xce, 0x00, 0x21, 0x04, 0xcb, 0x00, 0x18, 0x04, 0xca, 0x00, 0x5b, 0x03, 0xe5, 0x00, 0x58,
-    0x04, 0xca, 0x00, 0x5b, 0x03, 0xe5, 0x00, 0x58, 0x04, 0xca, 0x00, 0x5b, 0x03, 0xe5, 0x00, 0x58,
-    0x07, 0x49, 0x00, 0x12, 0x06, 0xc5, 0x00, 0x56, 0x05, 0x6b, 0x00, 0x7e, 0x04, 0x75, 0x00, 0x5a,
-    0x04, 0x80, 0xff, 0xd3, 0x04, 0x80, 0xff, 0xd3, 0x04, 0x22, 0x00, 0x2c, 0x04, 0x54, 0x00, 0x18,
-    0x04, 0x54, 0x00, 0x18, 0x04, 0x54, 0x00, 0x18, 0x04, 0x54, 0x00, 0x18, 0x04, 0x54, 0x00, 0x18,
-    0x04, 0x54, 0x00, 0x18, 0x04, 0x54, 0x00, 0x18, 0x04, 0x79, 0x00, 0x6e, 0x03, 0xe8, 0x00, 0x9b,
-    0x03, 0xe8, 0x00, 0x9b, 0x03, 0xe8, 0x00, 0x9b, 0x03, 0xe8, 0x00, 0x9b, 0x01, 0xdb, 0xff, 0xe8,
-    0x01, 0xdb, 0x00, 0xa6, 0x01, 0xdb, 0xff, 0xda, 0x01, 0xdb, 0xff, 0xc2, 0x04, 0xe1, 0x00, 0x9b,
-    0x04, 0xaa, 0x00, 0x69, 0x04, 0xaa, 0x00, 0x69, 0x04, 0xaa, 0x00, 0x69, 0x04, 0xaa, 0x00, 0x69,
-    0x04, 0xaa, 0x00, 0x69, 0x04, 0x88, 0x00, 0x89, 0x04, 0x88, 0x00, 0x89, 0x04, 0x88, 0x00, 0x89,
-    0x04, 0x88, 0x00, 0x89, 0x04, 0x24, 0x00, 0x16, 0x04, 0x54, 0x00, 0x18, 0x04, 0x54, 0x00, 0x18,
-    0x04, 0x54, 0x00, 0x18, 0x04, 0x79, 0x00, 0x6e, 0x04, 0x79, 0x00, 0x6e, 0x04, 0x79, 0x00, 0x6e,
-    0x04, 0x79, 0x00, 0x6e, 0x04, 0x80, 0x00, 0x9b, 0x03, 0xe8, 0x00, 0x9b, 0x03, 0xe8, 0x00, 0x9b,
-    0x03, 0xe8, 0x00, 0x9b, 0x03, 0xe8, 0x00, 0x9b, 0x03, 0xe8, 0x00, 0x9b, 0x04, 0xb2, 0x00, 0x79,
-    0x04, 0xb2, 0x00, 0x79, 0x04, 0xb2, 0x00, 0x79, 0x04, 0xb2, 0x00, 0x79, 0x04, 0xdd, 0x00, 0x9b,
-    0x01, 0xdb, 0xff, 0xa1, 0x01, 0xdb, 0xff, 0xbc, 0x01, 0xdb, 0xff, 0xcc, 0x01, 0xdb, 0x00, 0x0a,
-    0x01, 0xdb, 0x00, 0x9b, 0x03, 0xcb, 0x00, 0x3c, 0x04, 0x59, 0x00, 0x9b, 0x03, 0xa3, 0x00, 0x92,
-    0x03, 0xa3, 0x00, 0x9b, 0x03, 0xa3, 0x00, 0x9b, 0x03, 0xa3, 0x00, 0x9b, 0x04, 0xe1, 0x00, 0x9b,
-    0x04, 0xe1, 0x00, 0x9b, 0x04, 0xe1, 0x00, 0x9b, 0x04, 0xaa, 0x00, 0x69, 0x04, 0xaa, 0x00, 0x69,
-    0x04, 0xaa, 0x00, 0x69, 0x04, 0x63, 0x00, 0x98, 0x04, 0x63, 0x00, 0x98, 0x04, 0x63, 0x00, 0x98,
-    0x04, 0x19, 0x00, 0x4b, 0x04, 0x19, 0x00, 0x4b, 0x04, 0x19, 0x00, 0x4b, 0x04, 0x19, 0x00, 0x4b,
-    0x04, 0x22, 0x00, 0x2c, 0x04, 0x22, 0x00, 0x2c, 0x04, 0x22, 0x00, 0x2c, 0x04, 0x88, 0x00, 0x89,
-    0x04, 0x88, 0x00, 0x89, 0x04, 0x88, 0x00, 0x89, 0x04, 0x88, 0x00, 0x89, 0x04, 0x88, 0x00, 0x89,
-    0x04, 0x88, 0x00, 0x89, 0x06, 0x27, 0x00, 0x33, 0x04, 0x24, 0x00, 0x16, 0x04, 0x24, 0x00, 0x16,
-    0x04, 0x20, 0x00, 0x4c, 0x04, 0x20, 0x00, 0x4c, 0x04, 0x20, 0x00, 0x4c, 0x05, 0x00, 0x00, 0x1f,
-    0x04, 0xf1, 0xff, 0xa2, 0x06, 0x0e, 0xff, 0xaf, 0x02, 0x86, 0xff, 0xbf, 0x05, 0x7f, 0x00, 0x15,
-    0x05, 0x2f, 0xff, 0x96, 0x05, 0x52, 0x00, 0x20, 0x02, 0x67, 0xff, 0xa3, 0x05, 0x00, 0x00, 0x1f,
-    0x04, 0xe8, 0x00, 0xb9, 0x04, 0x8d, 0x00, 0xb9, 0x04, 0xca, 0x00, 0x5b, 0x05, 0xaa, 0x00, 0xb9,
-    0x02, 0x22, 0x00, 0xd4, 0x05, 0x0d, 0x00, 0xb9, 0x06, 0xec, 0x00, 0xb9, 0x05, 0xaf, 0x00, 0xb9,
-    0x05, 0x6b, 0x00, 0x7e, 0x04, 0xed, 0x00, 0xb9, 0x04, 0xc7, 0x00, 0x35, 0x04, 0xcb, 0x00, 0x18,
-    0x04, 0xe6, 0x00, 0x38, 0x02, 0x22, 0xff, 0xe7, 0x04, 0xcb, 0x00, 0x18, 0x04, 0x82, 0x00, 0x6f,
-    0x04, 0x5a, 0x00, 0x6c, 0x04, 0x75, 0x00, 0x9f, 0x02, 0x67, 0x00, 0xb7, 0x04, 0x48, 0x00, 0x9c,
-    0x04, 0x58, 0x00, 0xa3, 0x04, 0x7c, 0x00, 0x5b, 0x04, 0x75, 0x00, 0xa3, 0x03, 0xd9, 0x00, 0x26,
-    0x04, 0x45, 0x00, 0x40, 0x02, 0x67, 0xff, 0xca, 0x04, 0x48, 0x00, 0x9c, 0x04, 0x7c, 0x00, 0x5b,
-    0x04, 0x48, 0x00, 0x9c, 0x06, 0x99, 0x00, 0x89, 0x04, 0x8d, 0x00, 0xb9, 0x04, 0x6b, 0x00, 0xba,
-    0x04, 0xbe, 0x00, 0x59, 0x02, 0x22, 0x00, 0xd4, 0x02, 0x22, 0xff, 0xe7, 0x04, 0x68, 0x00, 0x48,
-    0x05, 0x1c, 0x00, 0xbd, 0x05, 0x0d, 0x00, 0xb9, 0x05, 0x06, 0x00, 0x37, 0x05, 0x00, 0x00, 0x1f,
-    0x04, 0xe8, 0x00, 0xb9, 0x04, 0x6b, 0x00, 0xba, 0x04, 0x8d, 0x00, 0xb9, 0x05, 0xaf, 0x00, 0xbd,
-    0x06, 0xec, 0x00, 0xb9, 0x05, 0xaa, 0x00, 0xb9, 0x05, 0x6b, 0x00, 0x7e, 0x05, 0xaa, 0x00, 0xbd,
-    0x04, 0xed, 0x00, 0xb9, 0x05, 0x32, 0x00, 0x84, 0x04, 0xc7, 0x00, 0x35, 0x04, 0xe6, 0x00, 0x38,
-    0x04, 0x4a, 0x00, 0x65, 0x04, 0x23, 0x00, 0x5a, 0x04, 0x80, 0x00, 0xa5, 0x04, 0x7c, 0x00, 0x5b,
-    0x04, 0x70, 0x00, 0x9b, 0x04, 0x20, 0x00, 0x5f, 0x03, 0xce, 0x00, 0x21, 0x03, 0xe5, 0x00, 0x31,
-    0x04, 0x23, 0x00, 0x5a, 0x03, 0x60, 0x00, 0xa4, 0x04, 0x0e, 0x00, 0x66, 0x01, 0xcc, 0x00, 0x96,
-    0x01, 0xc9, 0xff, 0xbc, 0x01, 0xd4, 0xff, 0x98, 0x04, 0x26, 0x00, 0xa4, 0x03, 0xce, 0x00, 0x21,
-    0x07, 0x2c, 0x00, 0x3d, 0x06, 0x09, 0x00, 0x3f, 0x07, 0x2c, 0x00, 0x3d, 0x06, 0x09, 0x00, 0x3f,
-    0x07, 0x2c, 0x00, 0x3d, 0x06, 0x09, 0x00, 0x3f, 0x04, 0xcb, 0x00, 0x18, 0x03, 0xce, 0x00, 0x21,
-    0x01, 0x5d, 0x00, 0x78, 0x02, 0x4d, 0x00, 0x90, 0x03, 0x9d, 0x00, 0x9a, 0x01, 0xd5, 0xff, 0x8c,
-    0x01, 0x6d, 0x00, 0x3f, 0x06, 0xec, 0x00, 0xb9, 0x07, 0x18, 0x00, 0x96, 0x05, 0x00, 0x00, 0x1f,
-    0x04, 0x4a, 0x00, 0x65, 0x04, 0x8d, 0x00, 0xb9, 0x05, 0xaf, 0x00, 0xbd, 0x04, 0x23, 0x00, 0x5a,
-    0x04, 0x80, 0x00, 0xa5, 0x05, 0x8f, 0x00, 0x7b, 0x05, 0x78, 0x00, 0x7a, 0x04, 0xee, 0x00, 0x1d,
-    0x03, 0xf2, 0x00, 0x0a, 0x08, 0x49, 0x00, 0x5b, 0x09, 0x38, 0x00, 0x7e, 0x04, 0xc3, 0x00, 0x5a,
-    0x04, 0x0e, 0x00, 0x63, 0x05, 0x32, 0x00, 0x84, 0x04, 0x20, 0x00, 0x5f, 0x04, 0xcb, 0x00, 0x18,
-    0x03, 0xeb, 0x00, 0x2d, 0x02, 0x22, 0x00, 0xd4, 0x07, 0x0a, 0x00, 0x17, 0x06, 0x24, 0x00, 0x19,
-    0x02, 0x22, 0x00, 0xd4, 0x05, 0x00, 0x00, 0x1f, 0x04, 0x4a, 0x00, 0x65, 0x05, 0x00, 0x00, 0x1f,
-    0x04, 0x4a, 0x00, 0x65, 0x07, 0x49, 0x00, 0x12, 0x06, 0xc5, 0x00, 0x56, 0x04, 0x8d, 0x00, 0xb9,
-    0x04, 0x23, 0x00, 0x5a, 0x05, 0x9a, 0x00, 0x7d, 0x04, 0x20, 0x00, 0x5d, 0x04, 0x20, 0x00, 0x5d,
-    0x07, 0x0a, 0x00, 0x17, 0x06, 0x24, 0x00, 0x19, 0x04, 0xc3, 0x00, 0x5a, 0x04, 0x0e, 0x00, 0x63,
-    0x05, 0xaf, 0x00, 0xbd, 0x04, 0x80, 0x00, 0xa5, 0x05, 0xaf, 0x00, 0xbd, 0x04, 0x80, 0x00, 0xa5,
-    0x05, 0x6b, 0x00, 0x7e, 0x04, 0x7c, 0x00, 0x5b, 0x05, 0x63, 0x00, 0x76, 0x04, 0x87, 0x00, 0x5a,
-    0x05, 0x63, 0x00, 0x76, 0x04, 0x87, 0x00, 0x5a, 0x05, 0x49, 0x00, 0x8e, 0x04, 0x48, 0x00, 0x6f,
-    0x05, 0x06, 0x00, 0x37, 0x03, 0xce, 0x00, 0x21, 0x05, 0x06, 0x00, 0x37, 0x03, 0xce, 0x00, 0x21,
-    0x05, 0x06, 0x00, 0x37, 0x03, 0xce, 0x00, 0x21, 0x05, 0x54, 0x00, 0xad, 0x04, 0x43, 0x00, 0x6f,
-    0x06, 0xae, 0x00, 0xba, 0x06, 0x02, 0x00, 0xaa, 0x04, 0x72, 0x00, 0x6d, 0x05, 0x00, 0x00, 0x1f,
-    0x04, 0x4a, 0x00, 0x65, 0x05, 0x00, 0x00, 0x1f, 0x04, 0x4a, 0x00, 0x65, 0x05, 0x00, 0x00, 0x1f,
-    0x04, 0x4a, 0x00, 0x65, 0x05, 0x00, 0x00, 0x1f, 0x04, 0x4a, 0x00, 0x1b, 0x05, 0x00, 0x00, 0x1f,
-    0x04, 0x4a, 0x00, 0x65, 0x05, 0x00, 0x00, 0x1f, 0x04, 0x4a, 0x00, 0x65, 0x05, 0x00, 0x00, 0x1f,
-    0x04, 0x4a, 0x00, 0x65, 0x05, 0x00, 0x00, 0x1f, 0x04, 0x4a, 0x00, 0x65, 0x05, 0x00, 0x00, 0x1f,
-    0x04, 0x4a, 0x00, 0x65, 0x05, 0x00, 0x00, 0x1f, 0x04, 0x4a, 0x00, 0x65, 0x05, 0x00, 0x00, 0x1f,
-    0x04, 0x4a, 0x00, 0x65, 0x05, 0x00, 0x00, 0x1f, 0x04, 0x4a, 0x00, 0x65, 0x04, 0x8d, 0x00, 0xb9,
-    0x04, 0x23, 0x00, 0x5a, 0x04, 0x8d, 0x00, 0xb9, 0x04, 0x23, 0x00, 0x5a, 0x04, 0x8d, 0x00, 0xb9,
-    0x04, 0x23, 0x00, 0x5a, 0x04, 0x8d, 0x00, 0xb9, 0x04, 0x23, 0x00, 0x5a, 0x04, 0x8d, 0x00, 0x42,
-    0x04, 0x23, 0x00, 0x0d, 0x04, 0x8d, 0x00, 0xb9, 0x04, 0x23, 0x00, 0x5a, 0x04, 0x8d, 0x00, 0xb9,
-    0x04, 0x23, 0x00, 0x5a, 0x04, 0x8d, 0x00, 0xb9, 0x04, 0x23, 0x00, 0x5a, 0x02, 0x22, 0x00, 0xc4,
-    0x01, 0xc9, 0x00, 0x99, 0x02, 0x22, 0x00, 0xba, 0x01, 0xcc, 0x00, 0x8e, 0x05, 0x6b, 0x00, 0x7e,
-    0x04, 0x7c, 0x00, 0x5b, 0x05, 0x6b, 0x00, 0x7e, 0x04, 0x7c, 0x00, 0x5b, 0x05, 0x6b, 0x00, 0x7e,
-    0x04, 0x7c, 0x00, 0x5b, 0x05, 0x6b, 0x00, 0x7e, 0x04, 0x7c, 0x00, 0x12, 0x05, 0x6b, 0x00, 0x7e,
-    0x04, 0x7c, 0x00, 0x5b, 0x05, 0x6b, 0x00, 0x7e, 0x04, 0x7c, 0x00, 0x5b, 0x05, 0x6b, 0x00, 0x7e,
-    0x04, 0x7c, 0x00, 0x5b, 0x05, 0x95, 0x00, 0x85, 0x04, 0x7b, 0x00, 0x5a, 0x05, 0x95, 0x00, 0x85,
-    0x04, 0x7b, 0x00, 0x5a, 0x05, 0x95, 0x00, 0x85, 0x04, 0x7b, 0x00, 0x5a, 0x05, 0x95, 0x00, 0x85,
-    0x04, 0x7b, 0x00, 0x5a, 0x05, 0x95, 0x00, 0x85, 0x04, 0x7b, 0x00, 0x5a, 0x05, 0x43, 0x00, 0xa3,
-    0x04, 0x65, 0x00, 0x99, 0x05, 0x43, 0x00, 0xa3, 0x04, 0x65, 0x00, 0x99, 0x05, 0x73, 0x00, 0xa3,
-    0x04, 0xb0, 0x00, 0x99, 0x05, 0x73, 0x00, 0xa3, 0x04, 0xb0, 0x00, 0x99, 0x05, 0x73, 0x00, 0xa3,
-    0x04, 0xb0, 0x00, 0x99, 0x05, 0x73, 0x00, 0xa3, 0x04, 0xb0, 0x00, 0x99, 0x05, 0x73, 0x00, 0xa3,
-    0x04, 0xb0, 0x00, 0x99, 0x04, 0xcb, 0x00, 0x18, 0x03, 0xce, 0x00, 0x21, 0x04, 0xcb, 0x00, 0x18,
-    0x03, 0xce, 0x00, 0x21, 0x04, 0xcb, 0x00, 0x18, 0x03, 0xce, 0x00, 0x21, 0x04, 0x90, 0x00, 0x6d,
-    0x04, 0xc7, 0x00, 0x35, 0x03, 0xce, 0x00, 0x28, 0x05, 0x54, 0x00, 0xad, 0x04, 0x43, 0x00, 0x6f,
-    0x04, 0x6b, 0x00, 0xba, 0x03, 0x60, 0x00, 0xa4, 0x06, 0x0b, 0x00, 0x25, 0x04, 0xb9, 0xff, 0xf6,
-    0x04, 0x65, 0x00, 0x9d, 0x04, 0xe6, 0xff, 0xfd, 0x04, 0xe6, 0xff, 0xfd, 0x04, 0x6b, 0x00, 0x2b,
-    0x03, 0x60, 0x00, 0x01, 0x05, 0x30, 0x00, 0x07, 0x04, 0x03, 0x00, 0x09, 0x04, 0xcb, 0x00, 0x18,
-    0x03, 0xeb, 0x00, 0x2d, 0x04, 0xe6, 0x00, 0x38, 0x03, 0xe5, 0x00, 0x31, 0x04, 0x5a, 0x00, 0x6c,
-    0x04, 0x80, 0x00, 0x19, 0x06, 0x2c, 0x00, 0x7f, 0x04, 0x70, 0x00, 0x6a, 0x04, 0x70, 0x00, 0x63,
-    0x04, 0x70, 0x00, 0x44, 0x04, 0x70, 0x00, 0xa8, 0x04, 0x84, 0x00, 0x97, 0x04, 0x98, 0x00, 0x7f,
-    0x04, 0x84, 0x00, 0x66, 0x04, 0x98, 0x00, 0x8c, 0x05, 0x79, 0x00, 0x91, 0x04, 0x71, 0x00, 0x6d,
-    0x05, 0xaf, 0x00, 0xb9, 0x04, 0x66, 0x00, 0x9d, 0x05, 0x00, 0x00, 0x1f, 0x04, 0x4a, 0x00, 0x65,
-    0x04, 0x8d, 0x00, 0x91, 0x04, 0x23, 0x00, 0x5a, 0x02, 0x22, 0xff, 0x37, 0x01, 0xc9, 0xff, 0x0c,
-    0x05, 0x6b, 0x00, 0x7e, 0x04, 0x7c, 0x00, 0x5b, 0x05, 0x15, 0x00, 0x86, 0x02, 0xb2, 0xff, 0xc0,
-    0x05, 0x43, 0x00, 0xa3, 0x04, 0x65, 0x00, 0x63, 0x04, 0xaf, 0xff, 0x4f, 0x04, 0xe8, 0x00, 0xb9,
-    0x04, 0x70, 0x00, 0x9b, 0x05, 0x3e, 0x00, 0xb9, 0x04, 0x72, 0x00, 0x6d, 0x05, 0x3e, 0x00, 0xb9,
-    0x04, 0x72, 0x00, 0x6d, 0x05, 0xaa, 0x00, 0xb9, 0x04, 0x65, 0x00, 0x9d, 0x05, 0x0d, 0x00, 0xb9,
-    0x03, 0xec, 0x00, 0x9d, 0x05, 0x0d, 0x00, 0xb9, 0x03, 0xec, 0x00, 0x9d, 0x04, 0x38, 0x00, 0xb9,
-    0x01, 0xcc, 0x00, 0x90, 0x06, 0xec, 0x00, 0xb9, 0x07, 0x18, 0x00, 0x96, 0x05, 0xaf, 0x00, 0xb9,
-    0x04, 0x66, 0x00, 0x9d, 0x05, 0x6b, 0x00, 0x7e, 0x04, 0xed, 0x00, 0xb9, 0x04, 0x70, 0x00, 0x9b,
-    0x05, 0x15, 0x00, 0xb6, 0x02, 0xb2, 0x00, 0x87, 0x04, 0xbe, 0x00, 0x59, 0x04, 0x0e, 0x00, 0x66,
-    0x04, 0xc7, 0x00, 0x35, 0x02, 0x93, 0x00, 0x18, 0x05, 0x43, 0x00, 0xa3, 0x04, 0xf0, 0x00, 0x20,
-    0x03, 0xd9, 0x00, 0x26, 0x04, 0xf0, 0x00, 0x20, 0x03, 0xd9, 0x00, 0x26, 0x07, 0x2c, 0x00, 0x3d,
-    0x06, 0x09, 0x00, 0x3f, 0x04, 0xca, 0x00, 0x5b, 0x03, 0xe5, 0x00, 0x58, 0x05, 0xb1, 0xfe, 0xc9,
-    0x04, 0x54, 0x00, 0x18, 0x04, 0x24, 0xff, 0xc7, 0x05, 0x19, 0xff, 0xdb, 0x02, 0x17, 0xff, 0xe8,
-    0x04, 0xb4, 0x00, 0x07, 0x04, 0x60, 0xff, 0x77, 0x04, 0xf2, 0x00, 0x31, 0x04, 0x54, 0x00, 0x18,
-    0x04, 0x3d, 0x00, 0x9b, 0x03, 0xe8, 0x00, 0x9b, 0x04, 0x20, 0x00, 0x4c, 0x04, 0xdd, 0x00, 0x9b,
-    0x01, 0xdb, 0x00, 0xb2, 0x04, 0x59, 0x00, 0x9b, 0x05, 0xf5, 0x00, 0x9b, 0x04, 0xe1, 0x00, 0x9b,
-    0x04, 0xaa, 0x00, 0x69, 0x04, 0x41, 0x00, 0x9b, 0x04, 0x22, 0x00, 0x2c, 0x04, 0x24, 0x00, 0x16,
-    0x04, 0x3a, 0x00, 0x2b, 0x01, 0xdb, 0xff, 0xc2, 0x04, 0x24, 0x00, 0x16, 0x03, 0xe8, 0x00, 0x9b,
-    0x03, 0xb1, 0x00, 0x9b, 0x04, 0x19, 0x00, 0x4b, 0x01, 0xdb, 0x00, 0xb2, 0x01, 0xdb, 0xff, 0xc2,
-    0x03, 0xcb, 0x00, 0x3c, 0x04, 0x59, 0x00, 0x9b, 0x04, 0x15, 0x00, 0x21, 0x04, 0x54, 0x00, 0x18,
-    0x04, 0x3d, 0x00, 0x9b, 0x03, 0xb1, 0x00, 0x9b, 0x03, 0xe8, 0x00, 0x9b, 0x04, 0xe8, 0x00, 0x9b,
-    0x05, 0xf5, 0x00, 0x9b, 0x04, 0xdd, 0x00, 0x9b, 0x04, 0xaa, 0x00, 0x69, 0x04, 0xc5, 0x00, 0x9b,
-    0x04, 0x41, 0x00, 0x9b, 0x04, 0x79, 0x00, 0x6e, 0x04, 0x22, 0x00, 0x2c, 0x04, 0x3a, 0x00, 0x2b,
-    0x04, 0x36, 0x00, 0x4f, 0x04, 0xdd, 0x00, 0x9b, 0x04, 0x79, 0x00, 0x6e, 0x04, 0x24, 0x00, 0x16,
-    0x05, 0x93, 0x00, 0x0b, 0x04, 0xe8, 0x00, 0x9b, 0x04, 0x15, 0x00, 0x21, 0x05, 0x5f, 0x00, 0x6a,
-    0x05, 0xa6, 0x00, 0xb2, 0x06, 0x26, 0x00, 0x0f, 0x04, 0xaa, 0x00, 0x69, 0x04, 0x19, 0x00, 0x4b,
-    0x06, 0x27, 0x00, 0x33, 0x06, 0x27, 0x00, 0x33, 0x06, 0x27, 0x00, 0x33, 0x04, 0x24, 0x00, 0x16,
-    0x05, 0x00, 0x00, 0x1f, 0x04, 0x4a, 0x00, 0x65, 0x04, 0x8d, 0x00, 0xb9, 0x04, 0x23, 0x00, 0x5a,
-    0x04, 0x54, 0x00, 0x18, 0x03, 0xe8, 0x00, 0x9b, 0x01, 0xc9, 0x00, 0x8e, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0x0a, 0x01, 0xac, 0x03, 0x00, 0x00, 0x04, 0x44, 0x46, 0x4c, 0x54, 0x01, 0x70, 0x63, 0x79,
-    0x72, 0x6c, 0x01, 0x70, 0x67, 0x72, 0x65, 0x6b, 0x01, 0x70, 0x6c, 0x61, 0x74, 0x6e, 0x00, 0x1a,
-    0x01, 0x26, 0x00, 0x07, 0x41, 0x5a, 0x45, 0x20, 0x00, 0xf6, 0x43, 0x52, 0x54, 0x20, 0x00, 0xf6,
-    0x46, 0x52, 0x41, 0x20, 0x00, 0xc4, 0x4d, 0x4f, 0x4c, 0x20, 0x00, 0x92, 0x4e, 0x41, 0x56, 0x20,
-    0x00, 0x60, 0x52, 0x4f, 0x4d, 0x20, 0x00, 0x2e, 0x54, 0x52, 0x4b, 0x20, 0x00, 0xf6, 0x00, 0x00,
-    0xff, 0xff, 0x00, 0x16, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x03, 0x00, 0x04, 0x00, 0x06,
-    0x00, 0x08, 0x00, 0x0c, 0x00, 0x0d, 0x00, 0x0e, 0x00, 0x0f, 0x00, 0x10, 0x00, 0x11, 0x00, 0x12,
-    0x00, 0x13, 0x00, 0x14, 0x00, 0x15, 0x00, 0x16, 0x00, 0x17, 0x00, 0x18, 0x00, 0x19, 0x00, 0x1a,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x16, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x03, 0x00, 0x04,
-    0x00, 0x06, 0x00, 0x08, 0x00, 0x0b, 0x00, 0x0d, 0x00, 0x0e, 0x00, 0x0f, 0x00, 0x10, 0x00, 0x11,
-    0x00, 0x12, 0x00, 0x13, 0x00, 0x14, 0x00, 0x15, 0x00, 0x16, 0x00, 0x17, 0x00, 0x18, 0x00, 0x19,
-    0x00, 0x1a, 0x00, 0x00, 0xff, 0xff, 0x00, 0x16, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x03,
-    0x00, 0x04, 0x00, 0x06, 0x00, 0x08, 0x00, 0x0a, 0x00, 0x0d, 0x00, 0x0e, 0x00, 0x0f, 0x00, 0x10,
-    0x00, 0x11, 0x00, 0x12, 0x00, 0x13, 0x00, 0x14, 0x00, 0x15, 0x00, 0x16, 0x00, 0x17, 0x00, 0x18,
-    0x00, 0x19, 0x00, 0x1a, 0x00, 0x00, 0xff, 0xff, 0x00, 0x16, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02,
-    0x00, 0x03, 0x00, 0x04, 0x00, 0x06, 0x00, 0x08, 0x00, 0x09, 0x00, 0x0d, 0x00, 0x0e, 0x00, 0x0f,
-    0x00, 0x10, 0x00, 0x11, 0x00, 0x12, 0x00, 0x13, 0x00, 0x14, 0x00, 0x15, 0x00, 0x16, 0x00, 0x17,
-    0x00, 0x18, 0x00, 0x19, 0x00, 0x1a, 0x00, 0x00, 0xff, 0xff, 0x00, 0x15, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x02, 0x00, 0x03, 0x00, 0x04, 0x00, 0x05, 0x00, 0x08, 0x00, 0x0d, 0x00, 0x0e, 0x00, 0x0f,
-    0x00, 0x10, 0x00, 0x11, 0x00, 0x12, 0x00, 0x13, 0x00, 0x14, 0x00, 0x15, 0x00, 0x16, 0x00, 0x17,
-    0x00, 0x18, 0x00, 0x19, 0x00, 0x1a, 0x00, 0x00, 0xff, 0xff, 0x00, 0x15, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x02, 0x00, 0x03, 0x00, 0x04, 0x00, 0x07, 0x00, 0x08, 0x00, 0x0d, 0x00, 0x0e, 0x00, 0x0f,
-    0x00, 0x10, 0x00, 0x11, 0x00, 0x12, 0x00, 0x13, 0x00, 0x14, 0x00, 0x15, 0x00, 0x16, 0x00, 0x17,
-    0x00, 0x18, 0x00, 0x19, 0x00, 0x1a, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x14,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x03, 0x00, 0x04, 0x00, 0x08, 0x00, 0x0d, 0x00, 0x0e,
-    0x00, 0x0f, 0x00, 0x10, 0x00, 0x11, 0x00, 0x12, 0x00, 0x13, 0x00, 0x14, 0x00, 0x15, 0x00, 0x16,
-    0x00, 0x17, 0x00, 0x18, 0x00, 0x19, 0x00, 0x1a, 0x00, 0x1b, 0x63, 0x32, 0x73, 0x63, 0x01, 0x4e,
-    0x63, 0x63, 0x6d, 0x70, 0x01, 0x46, 0x64, 0x6c, 0x69, 0x67, 0x01, 0x40, 0x64, 0x6e, 0x6f, 0x6d,
-    0x01, 0x3a, 0x66, 0x72, 0x61, 0x63, 0x01, 0x30, 0x6c, 0x69, 0x67, 0x61, 0x01, 0x2a, 0x6c, 0x69,
-    0x67, 0x61, 0x01, 0x1e, 0x6c, 0x69, 0x67, 0x61, 0x01, 0x16, 0x6c, 0x6e, 0x75, 0x6d, 0x01, 0x10,
-    0x6c, 0x6f, 0x63, 0x6c, 0x01, 0x0a, 0x6c, 0x6f, 0x63, 0x6c, 0x01, 0x04, 0x6c, 0x6f, 0x63, 0x6c,
-    0x00, 0xfe, 0x6c, 0x6f, 0x63, 0x6c, 0x00, 0xf8, 0x6e, 0x75, 0x6d, 0x72, 0x00, 0xf2, 0x6f, 0x6e,
-    0x75, 0x6d, 0x00, 0xec, 0x70, 0x6e, 0x75, 0x6d, 0x00, 0xe6, 0x73, 0x6d, 0x63, 0x70, 0x00, 0xe0,
-    0x73, 0x73, 0x30, 0x31, 0x00, 0xda, 0x73, 0x73, 0x30, 0x32, 0x00, 0xd4, 0x73, 0x73, 0x30, 0x33,
-    0x00, 0xce, 0x73, 0x73, 0x30, 0x34, 0x00, 0xc8, 0x73, 0x73, 0x30, 0x35, 0x00, 0xc2, 0x73, 0x73,
-    0x30, 0x36, 0x00, 0xbc, 0x73, 0x73, 0x30, 0x37, 0x00, 0xb6, 0x73, 0x75, 0x62, 0x73, 0x00, 0xb0,
-    0x73, 0x75, 0x70, 0x73, 0x00, 0xaa, 0x74, 0x6e, 0x75, 0x6d, 0x00, 0xa4, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x15, 0x00, 0x00, 0x00, 0x01, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x01, 0x00, 0x1e, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x12, 0x00, 0x00, 0x00, 0x01, 0x00, 0x11, 0x00, 0x00, 0x00, 0x01, 0x00, 0x10,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x0d, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x14, 0x00, 0x00, 0x00, 0x01, 0x00, 0x13, 0x00, 0x00, 0x00, 0x01, 0x00, 0x1c,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x06, 0x00, 0x00, 0x00, 0x01, 0x00, 0x07, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x05, 0x00, 0x00, 0x00, 0x01, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x16, 0x00, 0x00,
-    0x00, 0x02, 0x00, 0x09, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x04, 0x00, 0x09, 0x00, 0x0a, 0x00, 0x09,
-    0x00, 0x0a, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x03, 0x00, 0x17, 0x00, 0x18,
-    0x00, 0x1a, 0x00, 0x00, 0x00, 0x01, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0b, 0x00, 0x00,
-    0x00, 0x02, 0x00, 0x02, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1f, 0x0e, 0xfc,
-    0x0b, 0x3e, 0x0a, 0xbe, 0x0a, 0xa4, 0x04, 0x00, 0x03, 0xea, 0x03, 0xea, 0x03, 0xc0, 0x03, 0xac,
-    0x03, 0x82, 0x03, 0x5e, 0x03, 0x22, 0x03, 0x0e, 0x02, 0xfa, 0x02, 0xe6, 0x02, 0xcc, 0x02, 0xba,
-    0x02, 0x78, 0x02, 0x5a, 0x02, 0x08, 0x01, 0xc2, 0x01, 0x60, 0x01, 0x02, 0x00, 0xee, 0x00, 0xb4,
-    0x00, 0x92, 0x00, 0x70, 0x00, 0x92, 0x00, 0x70, 0x00, 0x4e, 0x00, 0x40, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x08, 0x00, 0x01, 0x00, 0x86, 0x01, 0x8e, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x08, 0x00, 0x02, 0x00, 0x78, 0x00, 0x0a, 0x01, 0x95, 0x00, 0x7a, 0x00, 0x73, 0x00, 0x74,
-    0x01, 0x96, 0x01, 0x97, 0x01, 0x98, 0x01, 0x99, 0x01, 0x9a, 0x01, 0x9b, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x08, 0x00, 0x02, 0x00, 0x56, 0x00, 0x0a, 0x02, 0x58, 0x00, 0x7a, 0x00, 0x73,
-    0x00, 0x74, 0x02, 0x59, 0x02, 0x5a, 0x02, 0x5b, 0x02, 0x5c, 0x02, 0x5d, 0x02, 0x5e, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x08, 0x00, 0x02, 0x00, 0x34, 0x00, 0x0a, 0x01, 0xe1, 0x01, 0xe0,
-    0x01, 0xdf, 0x02, 0x39, 0x02, 0x3a, 0x02, 0x3b, 0x02, 0x3c, 0x02, 0x3d, 0x02, 0x3e, 0x02, 0x3f,
-    0x00, 0x06, 0x00, 0x00, 0x00, 0x01, 0x00, 0x08, 0x00, 0x03, 0x00, 0x01, 0x00, 0x1c, 0x00, 0x01,
-    0x00, 0x12, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x19, 0x00, 0x02, 0x00, 0x01, 0x00, 0x14,
-    0x00, 0x1d, 0x00, 0x00, 0x00, 0x02, 0x00, 0x03, 0x01, 0x94, 0x01, 0x94, 0x00, 0x00, 0x01, 0xdf,
-    0x01, 0xe1, 0x00, 0x01, 0x02, 0x39, 0x02, 0x3f, 0x00, 0x04, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x08, 0x00, 0x01, 0x00, 0x06, 0x01, 0x81, 0x00, 0x01, 0x00, 0x01, 0x00, 0x13, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x08, 0x00, 0x02, 0x00, 0x2e, 0x00, 0x14, 0x04, 0xac, 0x04, 0xad,
-    0x02, 0x8b, 0x04, 0xa8, 0x04, 0xa9, 0x04, 0xaa, 0x04, 0xab, 0x02, 0x80, 0x04, 0xae, 0x00, 0x17,
-    0x00, 0x19, 0x00, 0x18, 0x00, 0x16, 0x00, 0x1b, 0x00, 0x14, 0x00, 0x1a, 0x00, 0x1d, 0x00, 0x1c,
-    0x00, 0x15, 0x04, 0xaf, 0x00, 0x02, 0x00, 0x06, 0x00, 0x1a, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x1c,
-    0x00, 0x1c, 0x00, 0x01, 0x02, 0x64, 0x02, 0x69, 0x00, 0x02, 0x02, 0x6d, 0x02, 0x6d, 0x00, 0x08,
-    0x02, 0x6f, 0x02, 0x78, 0x00, 0x09, 0x02, 0x7f, 0x02, 0x7f, 0x00, 0x13, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x08, 0x00, 0x02, 0x00, 0x2e, 0x00, 0x14, 0x02, 0x75, 0x02, 0x77, 0x02, 0x78,
-    0x02, 0x72, 0x02, 0x6f, 0x02, 0x71, 0x02, 0x70, 0x02, 0x73, 0x02, 0x76, 0x02, 0x74, 0x00, 0x1b,
-    0x00, 0x15, 0x00, 0x16, 0x00, 0x17, 0x00, 0x18, 0x00, 0x19, 0x00, 0x1a, 0x00, 0x1c, 0x00, 0x1d,
-    0x00, 0x14, 0x00, 0x01, 0x00, 0x14, 0x00, 0x1a, 0x00, 0x1c, 0x02, 0x64, 0x02, 0x65, 0x02, 0x66,
-    0x02, 0x67, 0x02, 0x68, 0x02, 0x69, 0x02, 0x6d, 0x02, 0x7f, 0x02, 0x80, 0x02, 0x8b, 0x04, 0xa8,
-    0x04, 0xa9, 0x04, 0xaa, 0x04, 0xab, 0x04, 0xac, 0x04, 0xad, 0x04, 0xae, 0x04, 0xaf, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x08, 0x00, 0x02, 0x00, 0x2e, 0x00, 0x14, 0x04, 0xaf, 0x02, 0x8b,
-    0x04, 0xa8, 0x04, 0xa9, 0x04, 0xaa, 0x04, 0xab, 0x04, 0xac, 0x02, 0x80, 0x04, 0xad, 0x04, 0xae,
-    0x02, 0x66, 0x02, 0x68, 0x02, 0x67, 0x02, 0x65, 0x02, 0x69, 0x02, 0x7f, 0x00, 0x1a, 0x02, 0x6d,
-    0x00, 0x1c, 0x02, 0x64, 0x00, 0x02, 0x00, 0x02, 0x00, 0x14, 0x00, 0x1d, 0x00, 0x00, 0x02, 0x6f,
-    0x02, 0x78, 0x00, 0x0a, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x08, 0x00, 0x02, 0x00, 0x2e,
-    0x00, 0x14, 0x02, 0x74, 0x02, 0x78, 0x02, 0x72, 0x02, 0x6f, 0x02, 0x71, 0x02, 0x70, 0x02, 0x75,
-    0x02, 0x73, 0x02, 0x77, 0x02, 0x76, 0x02, 0x69, 0x02, 0x64, 0x02, 0x65, 0x02, 0x66, 0x02, 0x67,
-    0x02, 0x68, 0x00, 0x1a, 0x00, 0x1c, 0x02, 0x6d, 0x02, 0x7f, 0x00, 0x02, 0x00, 0x04, 0x00, 0x14,
-    0x00, 0x1d, 0x00, 0x00, 0x02, 0x80, 0x02, 0x80, 0x00, 0x0a, 0x02, 0x8b, 0x02, 0x8b, 0x00, 0x0b,
-    0x04, 0xa8, 0x04, 0xaf, 0x00, 0x0c, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x08, 0x00, 0x02,
-    0x00, 0x0c, 0x00, 0x03, 0x02, 0x88, 0x02, 0x89, 0x02, 0x89, 0x00, 0x01, 0x00, 0x03, 0x00, 0x49,
-    0x00, 0x4b, 0x02, 0x84, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x08, 0x00, 0x02, 0x00, 0x1e,
-    0x00, 0x0c, 0x02, 0x5f, 0x02, 0x61, 0x02, 0x60, 0x02, 0x62, 0x02, 0x63, 0x02, 0x81, 0x02, 0x82,
-    0x02, 0x83, 0x02, 0x84, 0x02, 0x85, 0x02, 0x86, 0x02, 0x87, 0x00, 0x01, 0x00, 0x0c, 0x00, 0x27,
-    0x00, 0x28, 0x00, 0x2b, 0x00, 0x33, 0x00, 0x35, 0x00, 0x46, 0x00, 0x47, 0x00, 0x48, 0x00, 0x4b,
-    0x00, 0x53, 0x00, 0x54, 0x00, 0x55, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x08, 0x00, 0x02,
-    0x00, 0x1c, 0x00, 0x02, 0x02, 0x48, 0x02, 0x49, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x08,
-    0x00, 0x02, 0x00, 0x0a, 0x00, 0x02, 0x02, 0x46, 0x02, 0x47, 0x00, 0x01, 0x00, 0x02, 0x00, 0x2f,
-    0x00, 0x4f, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x08, 0x00, 0x01, 0x00, 0x06, 0x02, 0x0f,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x36, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x08, 0x00, 0x01,
-    0x00, 0x06, 0x01, 0x89, 0x00, 0x01, 0x00, 0x01, 0x00, 0xbb, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x08, 0x00, 0x01, 0x00, 0x06, 0x01, 0xf8, 0x00, 0x01, 0x00, 0x01, 0x00, 0x4b, 0x00, 0x04,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x08, 0x00, 0x01, 0x00, 0x2a, 0x00, 0x03, 0x00, 0x20, 0x00, 0x16,
-    0x00, 0x0c, 0x00, 0x01, 0x00, 0x04, 0x01, 0xda, 0x00, 0x02, 0x00, 0x58, 0x00, 0x01, 0x00, 0x04,
-    0x01, 0xdb, 0x00, 0x02, 0x00, 0x58, 0x00, 0x01, 0x00, 0x04, 0x01, 0xd5, 0x00, 0x02, 0x00, 0x4a,
-    0x00, 0x01, 0x00, 0x03, 0x00, 0x4a, 0x00, 0x57, 0x00, 0x95, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x08, 0x00, 0x01, 0x00, 0x40, 0x00, 0x01, 0x00, 0x08, 0x00, 0x02, 0x00, 0x0c, 0x00, 0x06,
-    0x01, 0xd7, 0x00, 0x02, 0x00, 0x50, 0x01, 0xd9, 0x00, 0x03, 0x00, 0x4a, 0x00, 0x50, 0x00, 0x04,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x08, 0x00, 0x01, 0x00, 0x1c, 0x00, 0x01, 0x00, 0x08, 0x00, 0x02,
-    0x00, 0x0c, 0x00, 0x06, 0x01, 0xd6, 0x00, 0x02, 0x00, 0x4d, 0x01, 0xd8, 0x00, 0x03, 0x00, 0x4a,
-    0x00, 0x4d, 0x00, 0x01, 0x00, 0x01, 0x00, 0x4a, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x08,
-    0x00, 0x01, 0x00, 0x06, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x01, 0x7b, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x08, 0x00, 0x02, 0x00, 0x12, 0x00, 0x06, 0x05, 0x22, 0x05, 0x23, 0x05, 0x24,
-    0x05, 0x25, 0x05, 0x26, 0x05, 0x27, 0x00, 0x01, 0x00, 0x06, 0x02, 0xd5, 0x02, 0xd6, 0x02, 0xe7,
-    0x02, 0xe8, 0x03, 0x6a, 0x03, 0x73, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x08, 0x00, 0x01,
-    0x00, 0x06, 0x00, 0x02, 0x00, 0x01, 0x00, 0x02, 0x03, 0x23, 0x03, 0x24, 0x00, 0x04, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x08, 0x00, 0x01, 0x06, 0x32, 0x00, 0x36, 0x06, 0x00, 0x05, 0xf6, 0x05, 0xec,
-    0x05, 0xda, 0x05, 0xa8, 0x05, 0x96, 0x05, 0x8c, 0x05, 0x5a, 0x05, 0x40, 0x05, 0x26, 0x05, 0x14,
-    0x04, 0xea, 0x04, 0xae, 0x04, 0xa4, 0x04, 0x82, 0x04, 0x68, 0x04, 0x56, 0x04, 0x1a, 0x04, 0x08,
-    0x03, 0xee, 0x03, 0xc4, 0x03, 0xb2, 0x03, 0x80, 0x03, 0x76, 0x03, 0x6c, 0x03, 0x5a, 0x03, 0x28,
-    0x03, 0x1e, 0x03, 0x14, 0x03, 0x0a, 0x02, 0xf0, 0x02, 0xd6, 0x02, 0xc4, 0x02, 0x9a, 0x02, 0x68,
-    0x02, 0x5e, 0x02, 0x3c, 0x02, 0x22, 0x02, 0x10, 0x01, 0xde, 0x01, 0xcc, 0x01, 0xb2, 0x01, 0x88,
-    0x01, 0x76, 0x01, 0x6c, 0x01, 0x62, 0x01, 0x58, 0x01, 0x4e, 0x01, 0x24, 0x00, 0xfa, 0x00, 0xd0,
-    0x00, 0xa6, 0x00, 0x7c, 0x00, 0x72, 0x00, 0x01, 0x00, 0x04, 0x04, 0xc0, 0x00, 0x02, 0x00, 0xa9,
-    0x00, 0x05, 0x00, 0x24, 0x00, 0x1e, 0x00, 0x18, 0x00, 0x12, 0x00, 0x0c, 0x04, 0x88, 0x00, 0x02,
-    0x00, 0xaa, 0x04, 0x86, 0x00, 0x02, 0x00, 0xab, 0x04, 0x84, 0x00, 0x02, 0x00, 0xa8, 0x04, 0x8a,
-    0x00, 0x02, 0x00, 0xad, 0x04, 0x82, 0x00, 0x02, 0x00, 0xa9, 0x00, 0x05, 0x00, 0x24, 0x00, 0x1e,
-    0x00, 0x18, 0x00, 0x12, 0x00, 0x0c, 0x04, 0x87, 0x00, 0x02, 0x00, 0xaa, 0x04, 0x85, 0x00, 0x02,
-    0x00, 0xab, 0x04, 0x83, 0x00, 0x02, 0x00, 0xa8, 0x04, 0x89, 0x00, 0x02, 0x00, 0xad, 0x04, 0x81,
-    0x00, 0x02, 0x00, 0xa9, 0x00, 0x05, 0x00, 0x24, 0x00, 0x1e, 0x00, 0x18, 0x00, 0x12, 0x00, 0x0c,
-    0x04, 0x7a, 0x00, 0x02, 0x00, 0xaa, 0x04, 0x78, 0x00, 0x02, 0x00, 0xab, 0x04, 0x76, 0x00, 0x02,
-    0x00, 0xa8, 0x04, 0x7c, 0x00, 0x02, 0x00, 0xad, 0x04, 0x74, 0x00, 0x02, 0x00, 0xa9, 0x00, 0x05,
-    0x00, 0x24, 0x00, 0x1e, 0x00, 0x18, 0x00, 0x12, 0x00, 0x0c, 0x04, 0x79, 0x00, 0x02, 0x00, 0xaa,
-    0x04, 0x77, 0x00, 0x02, 0x00, 0xab, 0x04, 0x75, 0x00, 0x02, 0x00, 0xa8, 0x04, 0x7b, 0x00, 0x02,
-    0x00, 0xad, 0x04, 0x73, 0x00, 0x02, 0x00, 0xa9, 0x00, 0x05, 0x00, 0x24, 0x00, 0x1e, 0x00, 0x18,
-    0x00, 0x12, 0x00, 0x0c, 0x04, 0xb9, 0x00, 0x02, 0x00, 0xac, 0x02, 0xf6, 0x00, 0x02, 0x00, 0xaa,
-    0x04, 0x62, 0x00, 0x02, 0x00, 0xab, 0x02, 0xc1, 0x00, 0x02, 0x00, 0xa8, 0x02, 0xc2, 0x00, 0x02,
-    0x00, 0xa9, 0x00, 0x01, 0x00, 0x04, 0x03, 0x49, 0x00, 0x02, 0x00, 0xa9, 0x00, 0x01, 0x00, 0x04,
-    0x03, 0x47, 0x00, 0x02, 0x00, 0xa9, 0x00, 0x01, 0x00, 0x04, 0x03, 0x48, 0x00, 0x02, 0x00, 0xa9,
-    0x00, 0x01, 0x00, 0x04, 0x03, 0x46, 0x00, 0x02, 0x00, 0xa9, 0x00, 0x02, 0x00, 0x0c, 0x00, 0x06,
-    0x04, 0xe4, 0x00, 0x02, 0x00, 0xad, 0x03, 0x41, 0x00, 0x02, 0x00, 0xa9, 0x00, 0x05, 0x00, 0x24,
-    0x00, 0x1e, 0x00, 0x18, 0x00, 0x12, 0x00, 0x0c, 0x04, 0x90, 0x00, 0x02, 0x00, 0xaa, 0x04, 0x8e,
-    0x00, 0x02, 0x00, 0xab, 0x03, 0xf5, 0x00, 0x02, 0x00, 0xa8, 0x04, 0x8c, 0x00, 0x02, 0x00, 0xad,
-    0x02, 0xcf, 0x00, 0x02, 0x00, 0xa9, 0x00, 0x03, 0x00, 0x14, 0x00, 0x0e, 0x00, 0x08, 0x03, 0xef,
-    0x00, 0x02, 0x00, 0xa8, 0x04, 0xe2, 0x00, 0x02, 0x00, 0xad, 0x03, 0xf1, 0x00, 0x02, 0x00, 0xa9,
-    0x00, 0x02, 0x00, 0x0c, 0x00, 0x06, 0x04, 0xde, 0x00, 0x02, 0x00, 0xaa, 0x04, 0xe0, 0x00, 0x02,
-    0x00, 0xad, 0x00, 0x06, 0x00, 0x2c, 0x00, 0x26, 0x00, 0x20, 0x00, 0x1a, 0x00, 0x14, 0x00, 0x0e,
-    0x04, 0xbf, 0x00, 0x02, 0x00, 0xac, 0x03, 0x30, 0x00, 0x02, 0x00, 0xaa, 0x04, 0x80, 0x00, 0x02,
-    0x00, 0xab, 0x02, 0xcb, 0x00, 0x02, 0x00, 0xa8, 0x04, 0x7e, 0x00, 0x02, 0x00, 0xad, 0x02, 0xcc,
-    0x00, 0x02, 0x00, 0xa9, 0x00, 0x02, 0x00, 0x0c, 0x00, 0x06, 0x04, 0xdb, 0x00, 0x02, 0x00, 0xad,
-    0x03, 0x2a, 0x00, 0x02, 0x01, 0xd4, 0x00, 0x03, 0x00, 0x14, 0x00, 0x0e, 0x00, 0x08, 0x04, 0xd9,
-    0x00, 0x02, 0x00, 0xad, 0x03, 0x26, 0x00, 0x02, 0x01, 0xd4, 0x03, 0x20, 0x00, 0x02, 0x00, 0xa9,
-    0x00, 0x04, 0x00, 0x1c, 0x00, 0x16, 0x00, 0x10, 0x00, 0x0a, 0x04, 0xbd, 0x00, 0x02, 0x00, 0xac,
-    0x04, 0xd7, 0x00, 0x02, 0x00, 0xad, 0x03, 0x1c, 0x00, 0x02, 0x01, 0xd4, 0x03, 0x1a, 0x00, 0x02,
-    0x00, 0xa9, 0x00, 0x01, 0x00, 0x04, 0x04, 0xd5, 0x00, 0x02, 0x00, 0xa9, 0x00, 0x06, 0x00, 0x2c,
-    0x00, 0x26, 0x00, 0x20, 0x00, 0x1a, 0x00, 0x14, 0x00, 0x0e, 0x04, 0xbb, 0x00, 0x02, 0x00, 0xac,
-    0x02, 0xc9, 0x00, 0x02, 0x00, 0xaa, 0x04, 0x68, 0x00, 0x02, 0x00, 0xab, 0x02, 0xc6, 0x00, 0x02,
-    0x00, 0xa8, 0x04, 0x66, 0x00, 0x02, 0x00, 0xad, 0x02, 0xc7, 0x00, 0x02, 0x00, 0xa9, 0x00, 0x05,
-    0x00, 0x24, 0x00, 0x1e, 0x00, 0x18, 0x00, 0x12, 0x00, 0x0c, 0x02, 0xc5, 0x00, 0x02, 0x00, 0xaa,
-    0x04, 0xb3, 0x00, 0x02, 0x00, 0xa8, 0x04, 0xd2, 0x00, 0x02, 0x00, 0xad, 0x03, 0x0f, 0x00, 0x02,
-    0x01, 0xd4, 0x03, 0x0d, 0x00, 0x02, 0x00, 0xa9, 0x00, 0x02, 0x00, 0x0c, 0x00, 0x06, 0x04, 0xd0,
-    0x00, 0x02, 0x00, 0xad, 0x03, 0xfc, 0x00, 0x02, 0x00, 0xa9, 0x00, 0x03, 0x00, 0x14, 0x00, 0x0e,
-    0x00, 0x08, 0x04, 0xce, 0x00, 0x02, 0x00, 0xad, 0x03, 0x07, 0x00, 0x02, 0x01, 0xd4, 0x03, 0x05,
-    0x00, 0x02, 0x00, 0xa9, 0x00, 0x03, 0x00, 0x14, 0x00, 0x0e, 0x00, 0x08, 0x04, 0xcc, 0x00, 0x02,
-    0x00, 0xad, 0x03, 0x03, 0x00, 0x02, 0x01, 0xd4, 0x04, 0xca, 0x00, 0x02, 0x00, 0xa9, 0x00, 0x01,
-    0x00, 0x04, 0x04, 0x64, 0x00, 0x02, 0x00, 0xad, 0x00, 0x01, 0x00, 0x04, 0x04, 0xc8, 0x00, 0x02,
-    0x00, 0xad, 0x00, 0x01, 0x00, 0x04, 0x04, 0xb1, 0x00, 0x02, 0x00, 0xa9, 0x00, 0x06, 0x00, 0x2c,
-    0x00, 0x26, 0x00, 0x20, 0x00, 0x1a, 0x00, 0x14, 0x00, 0x0e, 0x04, 0xb7, 0x00, 0x02, 0x00, 0xac,
-    0x04, 0x56, 0x00, 0x02, 0x00, 0xaa, 0x04, 0x54, 0x00, 0x02, 0x00, 0xab, 0x02, 0xbd, 0x00, 0x02,
-    0x00, 0xa8, 0x04, 0x52, 0x00, 0x02, 0x00, 0xad, 0x02, 0xbe, 0x00, 0x02, 0x00, 0xa9, 0x00, 0x02,
-    0x00, 0x0c, 0x00, 0x06, 0x04, 0xc4, 0x00, 0x02, 0x00, 0xad, 0x04, 0xc6, 0x00, 0x02, 0x01, 0xd4,
-    0x00, 0x01, 0x00, 0x04, 0x02, 0xd8, 0x00, 0x02, 0x00, 0xa9, 0x00, 0x01, 0x00, 0x04, 0x04, 0xc2,
-    0x00, 0x02, 0x00, 0xad, 0x00, 0x06, 0x00, 0x2c, 0x00, 0x26, 0x00, 0x20, 0x00, 0x1a, 0x00, 0x14,
-    0x00, 0x0e, 0x04, 0xb5, 0x00, 0x02, 0x00, 0xac, 0x02, 0xb8, 0x00, 0x02, 0x00, 0xaa, 0x04, 0x3c,
-    0x00, 0x02, 0x00, 0xab, 0x02, 0xb5, 0x00, 0x02, 0x00, 0xa8, 0x04, 0x3a, 0x00, 0x02, 0x00, 0xad,
-    0x02, 0xb6, 0x00, 0x02, 0x00, 0xa9, 0x00, 0x02, 0x00, 0x0c, 0x00, 0x06, 0x04, 0xe3, 0x00, 0x02,
-    0x00, 0xad, 0x03, 0x40, 0x00, 0x02, 0x00, 0xa9, 0x00, 0x05, 0x00, 0x24, 0x00, 0x1e, 0x00, 0x18,
-    0x00, 0x12, 0x00, 0x0c, 0x04, 0x8f, 0x00, 0x02, 0x00, 0xaa, 0x04, 0x8d, 0x00, 0x02, 0x00, 0xab,
-    0x03, 0xf4, 0x00, 0x02, 0x00, 0xa8, 0x04, 0x8b, 0x00, 0x02, 0x00, 0xad, 0x02, 0xb4, 0x00, 0x02,
-    0x00, 0xa9, 0x00, 0x03, 0x00, 0x14, 0x00, 0x0e, 0x00, 0x08, 0x03, 0xee, 0x00, 0x02, 0x00, 0xa8,
-    0x04, 0xe1, 0x00, 0x02, 0x00, 0xad, 0x03, 0xf0, 0x00, 0x02, 0x00, 0xa9, 0x00, 0x02, 0x00, 0x0c,
-    0x00, 0x06, 0x04, 0xdd, 0x00, 0x02, 0x00, 0xaa, 0x04, 0xdf, 0x00, 0x02, 0x00, 0xad, 0x00, 0x07,
-    0x00, 0x34, 0x00, 0x2e, 0x00, 0x28, 0x00, 0x22, 0x00, 0x1c, 0x00, 0x16, 0x00, 0x10, 0x04, 0xbe,
-    0x00, 0x02, 0x00, 0xac, 0x03, 0x2f, 0x00, 0x02, 0x00, 0xaa, 0x04, 0x7f, 0x00, 0x02, 0x00, 0xab,
-    0x02, 0xb0, 0x00, 0x02, 0x00, 0xa8, 0x04, 0x7d, 0x00, 0x02, 0x00, 0xad, 0x02, 0xb1, 0x00, 0x02,
-    0x00, 0xa9, 0x04, 0xdc, 0x00, 0x03, 0x00, 0xaa, 0x00, 0xa9, 0x00, 0x02, 0x00, 0x0c, 0x00, 0x06,
-    0x04, 0xda, 0x00, 0x02, 0x00, 0xad, 0x03, 0x29, 0x00, 0x02, 0x01, 0xd4, 0x00, 0x03, 0x00, 0x14,
-    0x00, 0x0e, 0x00, 0x08, 0x04, 0xd8, 0x00, 0x02, 0x00, 0xad, 0x03, 0x25, 0x00, 0x02, 0x01, 0xd4,
-    0x03, 0x1f, 0x00, 0x02, 0x00, 0xa9, 0x00, 0x04, 0x00, 0x1c, 0x00, 0x16, 0x00, 0x10, 0x00, 0x0a,
-    0x04, 0xbc, 0x00, 0x02, 0x00, 0xac, 0x04, 0xd6, 0x00, 0x02, 0x00, 0xad, 0x03, 0x1b, 0x00, 0x02,
-    0x01, 0xd4, 0x03, 0x19, 0x00, 0x02, 0x00, 0xa9, 0x00, 0x01, 0x00, 0x04, 0x04, 0xd4, 0x00, 0x02,
-    0x00, 0xa9, 0x00, 0x07, 0x00, 0x34, 0x00, 0x2e, 0x00, 0x28, 0x00, 0x22, 0x00, 0x1c, 0x00, 0x16,
-    0x00, 0x10, 0x04, 0xba, 0x00, 0x02, 0x00, 0xac, 0x02, 0xae, 0x00, 0x02, 0x00, 0xaa, 0x04, 0x67,
-    0x00, 0x02, 0x00, 0xab, 0x02, 0xab, 0x00, 0x02, 0x00, 0xa8, 0x04, 0x65, 0x00, 0x02, 0x00, 0xad,
-    0x02, 0xac, 0x00, 0x02, 0x00, 0xa9, 0x04, 0xd3, 0x00, 0x03, 0x00, 0xaa, 0x00, 0xa9, 0x00, 0x05,
-    0x00, 0x24, 0x00, 0x1e, 0x00, 0x18, 0x00, 0x12, 0x00, 0x0c, 0x02, 0xaa, 0x00, 0x02, 0x00, 0xaa,
-    0x04, 0xb2, 0x00, 0x02, 0x00, 0xa8, 0x04, 0xd1, 0x00, 0x02, 0x00, 0xad, 0x03, 0x0e, 0x00, 0x02,
-    0x01, 0xd4, 0x03, 0x0c, 0x00, 0x02, 0x00, 0xa9, 0x00, 0x02, 0x00, 0x0c, 0x00, 0x06, 0x04, 0xcf,
-    0x00, 0x02, 0x00, 0xad, 0x03, 0xfb, 0x00, 0x02, 0x00, 0xa9, 0x00, 0x03, 0x00, 0x14, 0x00, 0x0e,
-    0x00, 0x08, 0x04, 0xcd, 0x00, 0x02, 0x00, 0xad, 0x03, 0x06, 0x00, 0x02, 0x01, 0xd4, 0x03, 0x04,
-    0x00, 0x02, 0x00, 0xa9, 0x00, 0x03, 0x00, 0x14, 0x00, 0x0e, 0x00, 0x08, 0x04, 0xcb, 0x00, 0x02,
-    0x00, 0xad, 0x03, 0x02, 0x00, 0x02, 0x01, 0xd4, 0x04, 0xc9, 0x00, 0x02, 0x00, 0xa9, 0x00, 0x06,
-    0x00, 0x2c, 0x00, 0x26, 0x00, 0x20, 0x00, 0x1a, 0x00, 0x14, 0x00, 0x0e, 0x04, 0xb8, 0x00, 0x02,
-    0x00, 0xac, 0x02, 0xf5, 0x00, 0x02, 0x00, 0xaa, 0x04, 0x61, 0x00, 0x02, 0x00, 0xab, 0x02, 0xa6,
-    0x00, 0x02, 0x00, 0xa8, 0x04, 0x63, 0x00, 0x02, 0x00, 0xad, 0x02, 0xa7, 0x00, 0x02, 0x00, 0xa9,
-    0x00, 0x01, 0x00, 0x04, 0x04, 0xc7, 0x00, 0x02, 0x00, 0xad, 0x00, 0x02, 0x00, 0x0c, 0x00, 0x06,
-    0x02, 0xf1, 0x00, 0x02, 0x01, 0xd4, 0x04, 0xb0, 0x00, 0x02, 0x00, 0xa9, 0x00, 0x06, 0x00, 0x2c,
-    0x00, 0x26, 0x00, 0x20, 0x00, 0x1a, 0x00, 0x14, 0x00, 0x0e, 0x04, 0xb6, 0x00, 0x02, 0x00, 0xac,
-    0x04, 0x55, 0x00, 0x02, 0x00, 0xaa, 0x04, 0x53, 0x00, 0x02, 0x00, 0xab, 0x02, 0xa2, 0x00, 0x02,
-    0x00, 0xa8, 0x04, 0x51, 0x00, 0x02, 0x00, 0xad, 0x02, 0xa3, 0x00, 0x02, 0x00, 0xa9, 0x00, 0x02,
-    0x00, 0x0c, 0x00, 0x06, 0x04, 0xc3, 0x00, 0x02, 0x00, 0xad, 0x04, 0xc5, 0x00, 0x02, 0x01, 0xd4,
-    0x00, 0x01, 0x00, 0x04, 0x02, 0xd7, 0x00, 0x02, 0x00, 0xa9, 0x00, 0x01, 0x00, 0x04, 0x04, 0xc1,
-    0x00, 0x02, 0x00, 0xad, 0x00, 0x06, 0x00, 0x2c, 0x00, 0x26, 0x00, 0x20, 0x00, 0x1a, 0x00, 0x14,
-    0x00, 0x0e, 0x04, 0xb4, 0x00, 0x02, 0x00, 0xac, 0x02, 0x9d, 0x00, 0x02, 0x00, 0xaa, 0x04, 0x3b,
-    0x00, 0x02, 0x00, 0xab, 0x02, 0x9a, 0x00, 0x02, 0x00, 0xa8, 0x04, 0x39, 0x00, 0x02, 0x00, 0xad,
-    0x02, 0x9b, 0x00, 0x02, 0x00, 0xa9, 0x00, 0x02, 0x00, 0x11, 0x00, 0x25, 0x00, 0x29, 0x00, 0x00,
-    0x00, 0x2b, 0x00, 0x2d, 0x00, 0x05, 0x00, 0x2f, 0x00, 0x34, 0x00, 0x08, 0x00, 0x36, 0x00, 0x3b,
-    0x00, 0x0e, 0x00, 0x3d, 0x00, 0x3e, 0x00, 0x14, 0x00, 0x45, 0x00, 0x49, 0x00, 0x16, 0x00, 0x4b,
-    0x00, 0x4d, 0x00, 0x1b, 0x00, 0x4f, 0x00, 0x54, 0x00, 0x1e, 0x00, 0x56, 0x00, 0x5b, 0x00, 0x24,
-    0x00, 0x5d, 0x00, 0x5e, 0x00, 0x2a, 0x00, 0x81, 0x00, 0x81, 0x00, 0x2c, 0x00, 0x83, 0x00, 0x83,
-    0x00, 0x2d, 0x00, 0x86, 0x00, 0x86, 0x00, 0x2e, 0x00, 0x89, 0x00, 0x89, 0x00, 0x2f, 0x00, 0x8d,
-    0x00, 0x8d, 0x00, 0x30, 0x00, 0x98, 0x00, 0x9b, 0x00, 0x31, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0x35,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x08, 0x00, 0x02, 0x00, 0x82, 0x00, 0x06, 0x02, 0x7b,
-    0x02, 0x79, 0x02, 0x7c, 0x02, 0x7d, 0x02, 0x7a, 0x05, 0x28, 0x00, 0x06, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x08, 0x00, 0x02, 0x00, 0x68, 0x00, 0x64, 0x00, 0x3c, 0x00, 0x2c, 0x00, 0x07, 0x00, 0x00,
-    0x00, 0x1a, 0x00, 0x1a, 0x00, 0x1a, 0x00, 0x1a, 0x00, 0x1a, 0x00, 0x1a, 0x00, 0x01, 0x00, 0x04,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x02,
-    0x00, 0x02, 0x00, 0xa8, 0x00, 0xac, 0x00, 0x01, 0x01, 0x24, 0x01, 0x27, 0x00, 0x01, 0x00, 0x02,
-    0x00, 0x06, 0x00, 0x4d, 0x00, 0x4d, 0x00, 0x06, 0x00, 0x4e, 0x00, 0x4e, 0x00, 0x04, 0x02, 0xfc,
-    0x02, 0xfc, 0x00, 0x05, 0x03, 0xe9, 0x03, 0xe9, 0x00, 0x03, 0x03, 0xeb, 0x03, 0xeb, 0x00, 0x02,
-    0x04, 0x64, 0x04, 0x64, 0x00, 0x01, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x06, 0x00, 0x4d,
-    0x00, 0x4e, 0x02, 0xfc, 0x03, 0xe9, 0x03, 0xeb, 0x04, 0x64, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x08, 0x00, 0x02, 0x01, 0xdc, 0x00, 0xeb, 0x02, 0x8c, 0x02, 0x4d, 0x02, 0x4c, 0x02, 0x4b,
-    0x02, 0x4a, 0x02, 0x42, 0x02, 0x00, 0x01, 0xff, 0x01, 0xfe, 0x01, 0xfd, 0x01, 0xfc, 0x01, 0xfb,
-    0x01, 0xfa, 0x01, 0xf9, 0x01, 0xf8, 0x01, 0xf7, 0x01, 0xf6, 0x01, 0xf5, 0x01, 0xf4, 0x01, 0xf3,
-    0x01, 0xf2, 0x01, 0xf1, 0x01, 0xf0, 0x01, 0xef, 0x01, 0xee, 0x01, 0xed, 0x01, 0xec, 0x02, 0x7e,
-    0x02, 0x8e, 0x03, 0x4b, 0x02, 0x90, 0x02, 0x8f, 0x03, 0x4a, 0x01, 0xfd, 0x02, 0x8d, 0x02, 0x92,
-    0x02, 0x6c, 0x04, 0xed, 0x04, 0xee, 0x02, 0x04, 0x02, 0x05, 0x04, 0xef, 0x04, 0xf0, 0x04, 0xf1,
-    0x02, 0x06, 0x04, 0xf2, 0x02, 0x07, 0x02, 0x08, 0x02, 0x09, 0x04, 0xf7, 0x02, 0x0a, 0x02, 0x0a,
-    0x04, 0xf8, 0x04, 0xf9, 0x02, 0x0b, 0x02, 0x0c, 0x02, 0x0d, 0x02, 0x14, 0x05, 0x06, 0x05, 0x07,
-    0x02, 0x15, 0x02, 0x16, 0x02, 0x17, 0x02, 0x18, 0x02, 0x19, 0x02, 0x1a, 0x05, 0x0a, 0x05, 0x0b,
-    0x05, 0x0d, 0x05, 0x10, 0x05, 0x19, 0x02, 0x1c, 0x02, 0x1d, 0x02, 0x1e, 0x02, 0x1f, 0x02, 0x20,
-    0x02, 0x21, 0x02, 0x22, 0x02, 0x23, 0x02, 0x24, 0x02, 0x25, 0x02, 0x0e, 0x02, 0x0f, 0x02, 0x10,
-    0x02, 0x11, 0x02, 0x12, 0x02, 0x13, 0x02, 0x55, 0x02, 0x27, 0x02, 0x28, 0x02, 0x29, 0x02, 0x2a,
-    0x05, 0x13, 0x02, 0x2b, 0x02, 0x2d, 0x02, 0x2e, 0x02, 0x2f, 0x02, 0x31, 0x02, 0x33, 0x02, 0x91,
-    0x03, 0x4c, 0x03, 0x4d, 0x03, 0x4e, 0x03, 0x4f, 0x03, 0x50, 0x03, 0x51, 0x03, 0x52, 0x03, 0x53,
-    0x03, 0x54, 0x03, 0x55, 0x03, 0x56, 0x03, 0x57, 0x03, 0x58, 0x03, 0x59, 0x03, 0x5a, 0x03, 0x5b,
-    0x03, 0x5c, 0x03, 0x5d, 0x03, 0x5e, 0x03, 0x5f, 0x03, 0x60, 0x03, 0x61, 0x03, 0x62, 0x03, 0x63,
-    0x03, 0x64, 0x03, 0x65, 0x03, 0x66, 0x03, 0x67, 0x03, 0x9d, 0x03, 0x68, 0x03, 0x69, 0x03, 0x6a,
-    0x03, 0x6b, 0x03, 0x6c, 0x03, 0x6d, 0x03, 0x6e, 0x03, 0x6f, 0x03, 0x70, 0x03, 0x71, 0x03, 0x72,
-    0x03, 0x73, 0x03, 0x74, 0x03, 0x75, 0x03, 0x76, 0x03, 0x77, 0x03, 0x78, 0x03, 0x79, 0x03, 0x7a,
-    0x03, 0x7b, 0x03, 0x7c, 0x03, 0x7d, 0x05, 0x1a, 0x03, 0x7f, 0x03, 0x80, 0x03, 0x81, 0x03, 0x82,
-    0x03, 0x83, 0x03, 0x84, 0x03, 0x85, 0x03, 0x86, 0x03, 0x87, 0x03, 0x88, 0x03, 0x89, 0x03, 0x8a,
-    0x03, 0x8b, 0x03, 0x8c, 0x03, 0x8d, 0x03, 0x8e, 0x03, 0x8f, 0x03, 0x90, 0x05, 0x1d, 0x03, 0x91,
-    0x03, 0x92, 0x03, 0x94, 0x03, 0x93, 0x03, 0x95, 0x03, 0x96, 0x03, 0x97, 0x03, 0x98, 0x03, 0x99,
-    0x03, 0x9a, 0x03, 0x9b, 0x03, 0x9c, 0x03, 0x9e, 0x03, 0x9f, 0x03, 0xa0, 0x05, 0x1b, 0x05, 0x1c,
-    0x04, 0xe6, 0x04, 0xe7, 0x04, 0xe8, 0x04, 0xe9, 0x04, 0xf3, 0x04, 0xf6, 0x04, 0xf4, 0x04, 0xf5,
-    0x04, 0xfa, 0x04, 0xfb, 0x04, 0xfc, 0x04, 0xea, 0x04, 0xeb, 0x04, 0xec, 0x05, 0x05, 0x05, 0x08,
-    0x05, 0x09, 0x05, 0x0c, 0x05, 0x0e, 0x05, 0x0f, 0x02, 0x1b, 0x05, 0x11, 0x04, 0xfd, 0x04, 0xfe,
-    0x04, 0xff, 0x05, 0x00, 0x05, 0x01, 0x05, 0x02, 0x05, 0x03, 0x05, 0x04, 0x05, 0x1e, 0x05, 0x1f,
-    0x05, 0x20, 0x05, 0x21, 0x05, 0x12, 0x05, 0x14, 0x05, 0x15, 0x02, 0x32, 0x05, 0x17, 0x02, 0x34,
-    0x05, 0x18, 0x05, 0x16, 0x02, 0x30, 0x02, 0x26, 0x02, 0x2c, 0x05, 0x26, 0x05, 0x27, 0x00, 0x01,
-    0x00, 0xeb, 0x00, 0x0a, 0x00, 0x45, 0x00, 0x46, 0x00, 0x47, 0x00, 0x48, 0x00, 0x49, 0x00, 0x4a,
-    0x00, 0x4b, 0x00, 0x4c, 0x00, 0x4d, 0x00, 0x4e, 0x00, 0x4f, 0x00, 0x50, 0x00, 0x51, 0x00, 0x52,
-    0x00, 0x53, 0x00, 0x54, 0x00, 0x55, 0x00, 0x56, 0x00, 0x57, 0x00, 0x58, 0x00, 0x59, 0x00, 0x5a,
-    0x00, 0x5b, 0x00, 0x5c, 0x00, 0x5d, 0x00, 0x5e, 0x00, 0x85, 0x00, 0x86, 0x00, 0x87, 0x00, 0x89,
-    0x00, 0x8a, 0x00, 0x8b, 0x00, 0x8d, 0x00, 0x90, 0x00, 0x92, 0x00, 0x94, 0x00, 0xbb, 0x00, 0xbc,
-    0x00, 0xbd, 0x00, 0xbe, 0x00, 0xbf, 0x00, 0xc0, 0x00, 0xc1, 0x00, 0xc2, 0x00, 0xc3, 0x00, 0xc4,
-    0x00, 0xc5, 0x00, 0xc6, 0x00, 0xc7, 0x00, 0xc8, 0x00, 0xc9, 0x00, 0xca, 0x00, 0xcb, 0x00, 0xcc,
-    0x00, 0xcd, 0x00, 0xce, 0x00, 0xea, 0x00, 0xeb, 0x00, 0xec, 0x00, 0xed, 0x00, 0xee, 0x00, 0xef,
-    0x00, 0xf0, 0x00, 0xf1, 0x00, 0xf2, 0x00, 0xf3, 0x00, 0xf4, 0x00, 0xf5, 0x00, 0xf6, 0x00, 0xf7,
-    0x00, 0xf8, 0x00, 0xf9, 0x00, 0xfa, 0x00, 0xfb, 0x00, 0xfc, 0x00, 0xfd, 0x00, 0xfe, 0x00, 0xff,
-    0x01, 0x00, 0x01, 0x01, 0x01, 0x02, 0x01, 0x03, 0x01, 0x04, 0x01, 0x05, 0x01, 0x06, 0x01, 0x07,
-    0x01, 0x30, 0x01, 0x34, 0x01, 0x36, 0x01, 0x38, 0x01, 0x3a, 0x01, 0x3c, 0x01, 0x42, 0x01, 0x44,
-    0x01, 0x46, 0x01, 0x4a, 0x01, 0x4d, 0x01, 0x5a, 0x02, 0x97, 0x02, 0x99, 0x02, 0xb5, 0x02, 0xb6,
-    0x02, 0xb7, 0x02, 0xb8, 0x02, 0xb9, 0x02, 0xba, 0x02, 0xbb, 0x02, 0xbc, 0x02, 0xbd, 0x02, 0xbe,
-    0x02, 0xbf, 0x02, 0xc0, 0x02, 0xc1, 0x02, 0xc2, 0x02, 0xc3, 0x02, 0xc4, 0x02, 0xc5, 0x02, 0xc6,
-    0x02, 0xc7, 0x02, 0xc8, 0x02, 0xc9, 0x02, 0xca, 0x02, 0xcb, 0x02, 0xcc, 0x02, 0xcd, 0x02, 0xce,
-    0x02, 0xcf, 0x02, 0xd0, 0x02, 0xd2, 0x02, 0xd4, 0x02, 0xd6, 0x02, 0xd8, 0x02, 0xda, 0x02, 0xdc,
-    0x02, 0xde, 0x02, 0xe0, 0x02, 0xe2, 0x02, 0xe4, 0x02, 0xe6, 0x02, 0xe8, 0x02, 0xea, 0x02, 0xec,
-    0x02, 0xee, 0x02, 0xf0, 0x02, 0xf2, 0x02, 0xf4, 0x02, 0xf6, 0x02, 0xf8, 0x02, 0xfa, 0x02, 0xfc,
-    0x02, 0xff, 0x03, 0x01, 0x03, 0x03, 0x03, 0x05, 0x03, 0x07, 0x03, 0x09, 0x03, 0x0b, 0x03, 0x0d,
-    0x03, 0x0f, 0x03, 0x11, 0x03, 0x14, 0x03, 0x16, 0x03, 0x18, 0x03, 0x1a, 0x03, 0x1c, 0x03, 0x1e,
-    0x03, 0x20, 0x03, 0x22, 0x03, 0x24, 0x03, 0x26, 0x03, 0x28, 0x03, 0x2a, 0x03, 0x2c, 0x03, 0x2e,
-    0x03, 0x30, 0x03, 0x32, 0x03, 0x34, 0x03, 0x36, 0x03, 0x38, 0x03, 0x3a, 0x03, 0x3c, 0x03, 0x3e,
-    0x03, 0x41, 0x03, 0x43, 0x03, 0x45, 0x03, 0x47, 0x03, 0x49, 0x03, 0xb9, 0x03, 0xba, 0x03, 0xbb,
-    0x03, 0xbc, 0x03, 0xbe, 0x03, 0xbf, 0x03, 0xc0, 0x03, 0xc1, 0x03, 0xc2, 0x03, 0xc3, 0x03, 0xc4,
-    0x03, 0xc5, 0x03, 0xc6, 0x03, 0xc7, 0x03, 0xde, 0x03, 0xdf, 0x03, 0xe0, 0x03, 0xe1, 0x03, 0xe2,
-    0x03, 0xe3, 0x03, 0xe4, 0x03, 0xe5, 0x03, 0xe6, 0x03, 0xe7, 0x03, 0xe8, 0x03, 0xe9, 0x03, 0xea,
-    0x03, 0xeb, 0x03, 0xec, 0x03, 0xed, 0x03, 0xef, 0x03, 0xf1, 0x03, 0xf3, 0x03, 0xf5, 0x04, 0x0a,
-    0x04, 0x0c, 0x04, 0x0e, 0x04, 0x1c, 0x04, 0x23, 0x04, 0x29, 0x04, 0x2f, 0x04, 0x99, 0x04, 0x9a,
-    0x04, 0x9e, 0x04, 0xa2, 0x05, 0x23, 0x05, 0x25, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x08,
-    0x00, 0x02, 0x01, 0xfa, 0x00, 0xfa, 0x02, 0x01, 0x02, 0x8c, 0x01, 0xeb, 0x01, 0xea, 0x01, 0xe9,
-    0x01, 0xe8, 0x01, 0xe7, 0x01, 0xe6, 0x01, 0xe5, 0x01, 0xe4, 0x01, 0xe3, 0x01, 0xe2, 0x02, 0x4d,
-    0x02, 0x4c, 0x02, 0x4b, 0x02, 0x4a, 0x02, 0x42, 0x02, 0x00, 0x01, 0xff, 0x01, 0xfe, 0x01, 0xfd,
-    0x01, 0xfc, 0x01, 0xfb, 0x01, 0xfa, 0x01, 0xf9, 0x01, 0xf8, 0x01, 0xf7, 0x01, 0xf6, 0x01, 0xf5,
-    0x01, 0xf4, 0x01, 0xf3, 0x01, 0xf2, 0x01, 0xf1, 0x01, 0xf0, 0x01, 0xef, 0x01, 0xee, 0x01, 0xed,
-    0x01, 0xec, 0x02, 0x02, 0x02, 0x03, 0x02, 0x8e, 0x02, 0x90, 0x02, 0x8f, 0x02, 0x91, 0x02, 0x8d,
-    0x02, 0x92, 0x02, 0x6c, 0x02, 0x04, 0x02, 0x05, 0x02, 0x06, 0x02, 0x07, 0x02, 0x08, 0x02, 0x09,
-    0x02, 0x0a, 0x02, 0x0b, 0x02, 0x0c, 0x02, 0x0d, 0x02, 0x0e, 0x02, 0x0f, 0x02, 0x10, 0x02, 0x11,
-    0x02, 0x12, 0x02, 0x13, 0x02, 0x14, 0x02, 0x15, 0x02, 0x16, 0x02, 0x17, 0x02, 0x18, 0x02, 0x1a,
-    0x02, 0x1b, 0x05, 0x19, 0x02, 0x1c, 0x02, 0x1d, 0x02, 0x1e, 0x02, 0x1f, 0x02, 0x20, 0x02, 0x21,
-    0x02, 0x22, 0x02, 0x23, 0x02, 0x24, 0x02, 0x25, 0x02, 0x55, 0x02, 0x27, 0x02, 0x28, 0x02, 0x29,
-    0x02, 0x2a, 0x05, 0x13, 0x02, 0x2b, 0x02, 0x2d, 0x02, 0x2e, 0x02, 0x2f, 0x02, 0x30, 0x02, 0x31,
-    0x02, 0x32, 0x02, 0x33, 0x02, 0x35, 0x02, 0x36, 0x02, 0x38, 0x02, 0x37, 0x03, 0x4a, 0x03, 0x4b,
-    0x03, 0x4c, 0x03, 0x4d, 0x03, 0x4e, 0x03, 0x4f, 0x03, 0x50, 0x03, 0x51, 0x03, 0x52, 0x03, 0x53,
-    0x03, 0x54, 0x03, 0x55, 0x03, 0x56, 0x03, 0x57, 0x03, 0x58, 0x03, 0x59, 0x03, 0x5a, 0x03, 0x5b,
-    0x03, 0x5c, 0x03, 0x5d, 0x03, 0x5e, 0x03, 0x5f, 0x03, 0x60, 0x03, 0x61, 0x03, 0x62, 0x03, 0x63,
-    0x03, 0x64, 0x03, 0x65, 0x03, 0x66, 0x03, 0x67, 0x03, 0x68, 0x03, 0x69, 0x03, 0x6a, 0x03, 0x6b,
-    0x03, 0x6c, 0x03, 0x6d, 0x03, 0x6e, 0x03, 0x6f, 0x03, 0x70, 0x03, 0x71, 0x03, 0x72, 0x03, 0x73,
-    0x03, 0x74, 0x03, 0x75, 0x03, 0x76, 0x03, 0x77, 0x03, 0x78, 0x03, 0x79, 0x03, 0x7a, 0x03, 0x7b,
-    0x03, 0x7c, 0x03, 0x7d, 0x03, 0x7e, 0x05, 0x1a, 0x03, 0x7f, 0x03, 0x80, 0x03, 0x81, 0x03, 0x82,
-    0x03, 0x83, 0x03, 0x84, 0x03, 0x85, 0x03, 0x86, 0x03, 0x87, 0x03, 0x88, 0x03, 0x89, 0x03, 0x8a,
-    0x03, 0x8b, 0x03, 0x8c, 0x03, 0x8d, 0x03, 0x8e, 0x03, 0x8f, 0x03, 0x90, 0x05, 0x1d, 0x03, 0x91,
-    0x03, 0x92, 0x03, 0x94, 0x03, 0x93, 0x03, 0x95, 0x03, 0x96, 0x03, 0x97, 0x03, 0x98, 0x03, 0x99,
-    0x03, 0x9a, 0x03, 0x9b, 0x03, 0x9c, 0x03, 0x9d, 0x03, 0x9e, 0x03, 0x9f, 0x03, 0xa0, 0x05, 0x1b,
-    0x05, 0x1c, 0x04, 0xe6, 0x04, 0xe7, 0x04, 0xe8, 0x04, 0xe9, 0x04, 0xea, 0x04, 0xeb, 0x04, 0xec,
-    0x04, 0xed, 0x04, 0xee, 0x04, 0xef, 0x04, 0xf0, 0x04, 0xf1, 0x04, 0xf2, 0x04, 0xf3, 0x04, 0xf4,
-    0x04, 0xf5, 0x04, 0xf6, 0x04, 0xf7, 0x04, 0xf8, 0x04, 0xf9, 0x04, 0xfa, 0x04, 0xfb, 0x04, 0xfc,
-    0x04, 0xfd, 0x04, 0xfe, 0x04, 0xff, 0x05, 0x00, 0x05, 0x01, 0x05, 0x02, 0x02, 0x19, 0x05, 0x03,
-    0x05, 0x04, 0x05, 0x05, 0x05, 0x06, 0x05, 0x07, 0x05, 0x08, 0x05, 0x09, 0x05, 0x0a, 0x05, 0x0b,
-    0x05, 0x0c, 0x05, 0x0d, 0x05, 0x0e, 0x05, 0x0f, 0x05, 0x10, 0x05, 0x11, 0x05, 0x1e, 0x05, 0x1f,
-    0x05, 0x20, 0x05, 0x21, 0x05, 0x12, 0x05, 0x14, 0x05, 0x15, 0x05, 0x17, 0x02, 0x34, 0x05, 0x18,
-    0x05, 0x16, 0x02, 0x26, 0x02, 0x2c, 0x05, 0x26, 0x05, 0x27, 0x00, 0x01, 0x00, 0xfa, 0x00, 0x08,
-    0x00, 0x0a, 0x00, 0x14, 0x00, 0x15, 0x00, 0x16, 0x00, 0x17, 0x00, 0x18, 0x00, 0x19, 0x00, 0x1a,
-    0x00, 0x1b, 0x00, 0x1c, 0x00, 0x1d, 0x00, 0x25, 0x00, 0x26, 0x00, 0x27, 0x00, 0x28, 0x00, 0x29,
-    0x00, 0x2a, 0x00, 0x2b, 0x00, 0x2c, 0x00, 0x2d, 0x00, 0x2e, 0x00, 0x2f, 0x00, 0x30, 0x00, 0x31,
-    0x00, 0x32, 0x00, 0x33, 0x00, 0x34, 0x00, 0x35, 0x00, 0x36, 0x00, 0x37, 0x00, 0x38, 0x00, 0x39,
-    0x00, 0x3a, 0x00, 0x3b, 0x00, 0x3c, 0x00, 0x3d, 0x00, 0x3e, 0x00, 0x65, 0x00, 0x67, 0x00, 0x81,
-    0x00, 0x83, 0x00, 0x84, 0x00, 0x8c, 0x00, 0x8f, 0x00, 0x91, 0x00, 0x93, 0x00, 0xb1, 0x00, 0xb2,
-    0x00, 0xb3, 0x00, 0xb4, 0x00, 0xb5, 0x00, 0xb6, 0x00, 0xb7, 0x00, 0xb8, 0x00, 0xb9, 0x00, 0xba,
-    0x00, 0xd2, 0x00, 0xd3, 0x00, 0xd4, 0x00, 0xd5, 0x00, 0xd6, 0x00, 0xd7, 0x00, 0xd8, 0x00, 0xd9,
-    0x00, 0xda, 0x00, 0xdb, 0x00, 0xdc, 0x00, 0xdd, 0x00, 0xde, 0x00, 0xdf, 0x00, 0xe0, 0x00, 0xe1,
-    0x00, 0xe2, 0x00, 0xe3, 0x00, 0xe4, 0x00, 0xe5, 0x00, 0xe6, 0x00, 0xe7, 0x00, 0xe8, 0x00, 0xe9,
-    0x01, 0x2f, 0x01, 0x33, 0x01, 0x35, 0x01, 0x37, 0x01, 0x39, 0x01, 0x3b, 0x01, 0x41, 0x01, 0x43,
-    0x01, 0x45, 0x01, 0x49, 0x01, 0x4b, 0x01, 0x4c, 0x01, 0x58, 0x01, 0x59, 0x01, 0xb1, 0x01, 0xb7,
-    0x01, 0xbc, 0x01, 0xbf, 0x02, 0x95, 0x02, 0x96, 0x02, 0x98, 0x02, 0x9a, 0x02, 0x9b, 0x02, 0x9c,
-    0x02, 0x9d, 0x02, 0x9e, 0x02, 0x9f, 0x02, 0xa0, 0x02, 0xa1, 0x02, 0xa2, 0x02, 0xa3, 0x02, 0xa4,
-    0x02, 0xa5, 0x02, 0xa6, 0x02, 0xa7, 0x02, 0xa8, 0x02, 0xa9, 0x02, 0xaa, 0x02, 0xab, 0x02, 0xac,
-    0x02, 0xad, 0x02, 0xae, 0x02, 0xaf, 0x02, 0xb0, 0x02, 0xb1, 0x02, 0xb2, 0x02, 0xb3, 0x02, 0xb4,
-    0x02, 0xd1, 0x02, 0xd3, 0x02, 0xd5, 0x02, 0xd7, 0x02, 0xd9, 0x02, 0xdb, 0x02, 0xdd, 0x02, 0xdf,
-    0x02, 0xe1, 0x02, 0xe3, 0x02, 0xe5, 0x02, 0xe7, 0x02, 0xe9, 0x02, 0xeb, 0x02, 0xed, 0x02, 0xef,
-    0x02, 0xf1, 0x02, 0xf3, 0x02, 0xf5, 0x02, 0xf7, 0x02, 0xf9, 0x02, 0xfb, 0x02, 0xfd, 0x02, 0xfe,
-    0x03, 0x00, 0x03, 0x02, 0x03, 0x04, 0x03, 0x06, 0x03, 0x08, 0x03, 0x0a, 0x03, 0x0c, 0x03, 0x0e,
-    0x03, 0x10, 0x03, 0x13, 0x03, 0x15, 0x03, 0x17, 0x03, 0x19, 0x03, 0x1b, 0x03, 0x1d, 0x03, 0x1f,
-    0x03, 0x21, 0x03, 0x23, 0x03, 0x25, 0x03, 0x27, 0x03, 0x29, 0x03, 0x2b, 0x03, 0x2d, 0x03, 0x2f,
-    0x03, 0x31, 0x03, 0x33, 0x03, 0x35, 0x03, 0x37, 0x03, 0x39, 0x03, 0x3b, 0x03, 0x3d, 0x03, 0x3f,
-    0x03, 0x40, 0x03, 0x42, 0x03, 0x44, 0x03, 0x46, 0x03, 0x48, 0x03, 0xa1, 0x03, 0xa2, 0x03, 0xa3,
-    0x03, 0xa4, 0x03, 0xa5, 0x03, 0xa6, 0x03, 0xa7, 0x03, 0xa9, 0x03, 0xaa, 0x03, 0xab, 0x03, 0xac,
-    0x03, 0xad, 0x03, 0xae, 0x03, 0xaf, 0x03, 0xb0, 0x03, 0xb1, 0x03, 0xb2, 0x03, 0xb3, 0x03, 0xb4,
-    0x03, 0xb5, 0x03, 0xb6, 0x03, 0xb7, 0x03, 0xb8, 0x03, 0xc8, 0x03, 0xc9, 0x03, 0xca, 0x03, 0xcb,
-    0x03, 0xcc, 0x03, 0xcd, 0x03, 0xce, 0x03, 0xcf, 0x03, 0xd0, 0x03, 0xd1, 0x03, 0xd2, 0x03, 0xd3,
-    0x03, 0xd4, 0x03, 0xd5, 0x03, 0xd6, 0x03, 0xd7, 0x03, 0xd8, 0x03, 0xd9, 0x03, 0xda, 0x03, 0xdb,
-    0x03, 0xdc, 0x03, 0xdd, 0x03, 0xee, 0x03, 0xf0, 0x03, 0xf2, 0x03, 0xf4, 0x04, 0x09, 0x04, 0x0b,
-    0x04, 0x0d, 0x04, 0x22, 0x04, 0x28, 0x04, 0x2e, 0x04, 0x98, 0x04, 0x9d, 0x04, 0xa1, 0x05, 0x22,
-    0x05, 0x24, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x5c, 0x00, 0xa0, 0x00, 0x04,
-    0x44, 0x46, 0x4c, 0x54, 0x00, 0x44, 0x63, 0x79, 0x72, 0x6c, 0x00, 0x36, 0x67, 0x72, 0x65, 0x6b,
-    0x00, 0x28, 0x6c, 0x61, 0x74, 0x6e, 0x00, 0x1a, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x02,
-    0x00, 0x00, 0x00, 0x04, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x02, 0x00, 0x00,
-    0x00, 0x03, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02,
-    0x00, 0x05, 0x63, 0x70, 0x73, 0x70, 0x00, 0x3e, 0x6b, 0x65, 0x72, 0x6e, 0x00, 0x36, 0x6b, 0x65,
-    0x72, 0x6e, 0x00, 0x30, 0x6b, 0x65, 0x72, 0x6e, 0x00, 0x28, 0x6b, 0x65, 0x72, 0x6e, 0x00, 0x20,
-    0x00, 0x00, 0x00, 0x02, 0x00, 0x04, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x04, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x56, 0x16, 0x30, 0xfc, 0x25, 0xdc, 0x01, 0x58, 0x00, 0x0c,
-    0x00, 0x02, 0x00, 0x08, 0x00, 0x02, 0x00, 0xfc, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x38, 0x00, 0x04,
-    0x00, 0x00, 0x00, 0xc4, 0x00, 0x60, 0x00, 0x04, 0x00, 0x05, 0x00, 0x00, 0xff, 0x95, 0x00, 0x00,
-    0x00, 0x00, 0xff, 0x88, 0x00, 0x00, 0xff, 0x56, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x88, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x12, 0x00, 0x06, 0x00, 0x0b, 0x00, 0x10, 0x00, 0x12, 0x00, 0x96,
-    0x00, 0xb2, 0x01, 0x84, 0x01, 0x85, 0x01, 0x86, 0x01, 0x87, 0x01, 0x88, 0x01, 0x89, 0x01, 0x8a,
-    0x01, 0x8e, 0x01, 0x8f, 0x03, 0xf6, 0x03, 0xf7, 0x03, 0xfa, 0x00, 0x02, 0x00, 0x10, 0x00, 0x06,
-    0x00, 0x06, 0x00, 0x01, 0x00, 0x0b, 0x00, 0x0b, 0x00, 0x01, 0x00, 0x10, 0x00, 0x10, 0x00, 0x02,
-    0x00, 0x11, 0x00, 0x11, 0x00, 0x03, 0x00, 0x12, 0x00, 0x12, 0x00, 0x02, 0x00, 0xb2, 0x00, 0xb2,
-    0x00, 0x04, 0x01, 0x81, 0x01, 0x82, 0x00, 0x03, 0x01, 0x84, 0x01, 0x85, 0x00, 0x01, 0x01, 0x86,
-    0x01, 0x86, 0x00, 0x02, 0x01, 0x87, 0x01, 0x89, 0x00, 0x01, 0x01, 0x8a, 0x01, 0x8a, 0x00, 0x02,
-    0x01, 0x8e, 0x01, 0x8f, 0x00, 0x02, 0x02, 0x94, 0x02, 0x94, 0x00, 0x03, 0x03, 0xf6, 0x03, 0xf7,
-    0x00, 0x01, 0x03, 0xfa, 0x03, 0xfa, 0x00, 0x01, 0x04, 0xa7, 0x04, 0xa7, 0x00, 0x03, 0x00, 0x02,
-    0x00, 0x07, 0x00, 0x10, 0x00, 0x10, 0x00, 0x01, 0x00, 0x12, 0x00, 0x12, 0x00, 0x01, 0x00, 0x96,
-    0x00, 0x96, 0x00, 0x02, 0x00, 0xb2, 0x00, 0xb2, 0x00, 0x03, 0x01, 0x86, 0x01, 0x86, 0x00, 0x01,
-    0x01, 0x8a, 0x01, 0x8a, 0x00, 0x01, 0x01, 0x8e, 0x01, 0x8f, 0x00, 0x01, 0x00, 0x01, 0x00, 0x10,
-    0x00, 0x04, 0x00, 0x00, 0x00, 0x03, 0x00, 0x4a, 0x00, 0x20, 0x00, 0x1a, 0x00, 0x01, 0x00, 0x03,
-    0x00, 0x13, 0x00, 0x9d, 0x00, 0xb2, 0x00, 0x01, 0x00, 0x23, 0xff, 0xc3, 0x00, 0x0a, 0x00, 0x06,
-    0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x01, 0x84, 0x00, 0x00, 0x01, 0x85, 0x00, 0x00, 0x01, 0x87,
-    0x00, 0x00, 0x01, 0x88, 0x00, 0x00, 0x01, 0x89, 0x00, 0x00, 0x03, 0xf6, 0x00, 0x00, 0x03, 0xf7,
-    0x00, 0x00, 0x03, 0xfa, 0x00, 0x00, 0x00, 0x01, 0x00, 0x13, 0xff, 0x20, 0x00, 0x02, 0x00, 0x08,
-    0x00, 0x02, 0x17, 0x4c, 0x00, 0x0a, 0x00, 0x02, 0x09, 0x5c, 0x00, 0x04, 0x00, 0x00, 0x11, 0xb6,
-    0x0b, 0x7c, 0x00, 0x23, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xeb, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xed, 0x00, 0x00,
-    0x00, 0x00, 0xff, 0xd5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x9a, 0xff, 0xe5, 0xff, 0xe9,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xea, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xff, 0xea, 0xff, 0xf5, 0xff, 0xed, 0xff, 0xeb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xff, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00,
-    0xff, 0xf5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf4, 0xff, 0xef,
-    0x00, 0x00, 0xff, 0xf1, 0x00, 0x00, 0xff, 0xce, 0xff, 0x88, 0xff, 0xa2, 0x00, 0x00, 0x00, 0x00,
-    0xff, 0xbb, 0x00, 0x00, 0xff, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0xff, 0xc4,
-    0xff, 0xa9, 0x00, 0x00, 0xff, 0xdd, 0xff, 0xc7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf1, 0xff, 0xbd, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xed, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xff, 0xef, 0xff, 0xed, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe6,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x00, 0xff, 0xed, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xff, 0xf3, 0xff, 0xf2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf1, 0xff, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xff, 0xeb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xea, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xeb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xff, 0xeb, 0xff, 0xea, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xff, 0x98, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xea, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xff, 0xee, 0x00, 0x00, 0xff, 0xec, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xff, 0xec, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xbf,
-    0x00, 0x00, 0x00, 0x00, 0xff, 0xd8, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf3, 0x00, 0x00, 0xff, 0xf1, 0x00, 0x00, 0x00, 0x00,
-    0xff, 0xf1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x95, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xc5, 0xff, 0x88, 0xff, 0xce,
-    0x00, 0x00, 0x00, 0x00, 0xff, 0xc3, 0x00, 0x00, 0xff, 0xec, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xff, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe3, 0xff, 0xbf,
-    0xff, 0xa2, 0xff, 0xb7, 0xff, 0xcb, 0xff, 0xd9, 0xff, 0xbf, 0xff, 0xa0, 0xff, 0xd8, 0x00, 0x00,
-    0xff, 0xab, 0xff, 0xec, 0x00, 0x00, 0x00, 0x12, 0xff, 0xc6, 0xff, 0xf0, 0x00, 0x11, 0xff, 0x2d,
-    0x00, 0x11, 0x00, 0x00, 0xff, 0xcc, 0x00, 0x00, 0xff, 0xe2, 0x00, 0x00, 0x00, 0x12, 0xff, 0xa0,
-    0xff, 0xf3, 0xff, 0xf3, 0x00, 0x0d, 0xff, 0xef, 0xff, 0xab, 0xff, 0xa2, 0xff, 0xe9, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xff, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xff, 0xbf, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0xff, 0xf2, 0xff, 0xd4,
-    0x00, 0x00, 0xff, 0xca, 0x00, 0x00, 0xff, 0xda, 0x00, 0x13, 0xff, 0x7b, 0x00, 0x00, 0xff, 0x11,
-    0x00, 0x00, 0x00, 0x00, 0xff, 0x71, 0x00, 0x00, 0xfe, 0xed, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xff, 0x3f, 0xff, 0x51, 0x00, 0x00, 0xff, 0x91, 0xff, 0x3b, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x13, 0x00, 0x13, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe4, 0xff, 0x9d, 0xff, 0xb1, 0xff, 0x8f,
-    0xff, 0xb9, 0xff, 0xa1, 0xff, 0x9d, 0x00, 0x00, 0xff, 0x93, 0x00, 0x00, 0xff, 0xaf, 0xff, 0xb8,
-    0x00, 0x00, 0x00, 0x10, 0xff, 0x8c, 0xff, 0xf0, 0x00, 0x0f, 0xff, 0x26, 0x00, 0x10, 0x00, 0x00,
-    0xff, 0x18, 0xff, 0xbc, 0xff, 0xc4, 0x00, 0x00, 0x00, 0x10, 0xff, 0x10, 0xff, 0xf1, 0xff, 0xf1,
-    0x00, 0x00, 0xff, 0xed, 0xff, 0xaf, 0xff, 0xb1, 0xff, 0xb3, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe1,
-    0xff, 0xd5, 0xff, 0xdf, 0xff, 0xe7, 0xff, 0xed, 0xff, 0xe1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xff, 0xcb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x85,
-    0x00, 0x0e, 0x00, 0x00, 0xff, 0xc4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xcb, 0xff, 0xd5, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xed, 0x00, 0x00, 0xff, 0xd8, 0x00, 0x00, 0x00, 0x00,
-    0xff, 0xec, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x10, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x85, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe6, 0xff, 0xeb, 0x00, 0x0d, 0x00, 0x00,
-    0xff, 0xec, 0xff, 0xed, 0xff, 0xeb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0xff, 0xe5,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xff, 0xf5, 0xff, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf1, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xef, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xff, 0xec, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xb4,
-    0x00, 0x00, 0x00, 0x00, 0xff, 0xd5, 0xff, 0xbb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xff, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe1, 0xff, 0xe6, 0x00, 0x00, 0x00, 0x00,
-    0xff, 0xe7, 0xff, 0xe9, 0xff, 0xe5, 0x00, 0x00, 0xff, 0xe9, 0x00, 0x00, 0x00, 0x00, 0xff, 0xd8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xff, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf3, 0xff, 0xd4,
-    0xff, 0xb5, 0xff, 0xd2, 0xff, 0xd9, 0xff, 0xe4, 0xff, 0xd2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xff, 0xb4, 0xff, 0xf5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x1f,
-    0x00, 0x00, 0x00, 0x00, 0xff, 0xdb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xb4, 0xff, 0xb5, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xc9,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xff, 0xe8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf3, 0xff, 0x76, 0xff, 0xf5,
-    0x00, 0x00, 0x00, 0x00, 0xff, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xc6, 0x00, 0x0f,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xbc, 0x00, 0x00, 0xff, 0xe6,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0x00,
-    0xff, 0xe1, 0x00, 0x00, 0xff, 0xc6, 0xff, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xff, 0xeb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xff, 0xe7, 0xff, 0xe6, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe7, 0xff, 0xeb, 0xff, 0xeb, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xd2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf2, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xec, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xff, 0xbf, 0x00, 0x00, 0x00, 0x00, 0xff, 0xd8, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xeb, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xed, 0x00, 0x00,
-    0x00, 0x00, 0xff, 0xd5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x9a, 0xff, 0xe5, 0xff, 0xe9,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xea, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xff, 0xea, 0xff, 0xf5, 0xff, 0xed, 0xff, 0xeb, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf5, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf4, 0xff, 0xef, 0x00, 0x00, 0xff, 0xf1,
-    0x00, 0x00, 0xff, 0xce, 0x00, 0x00, 0xff, 0xa2, 0x00, 0x00, 0x00, 0x00, 0xff, 0xbb, 0x00, 0x00,
-    0xff, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0xff, 0xc4, 0xff, 0xa9, 0x00, 0x00,
-    0xff, 0xdd, 0xff, 0xc7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xff, 0xec, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xec, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0x00, 0x5a, 0x00, 0x06, 0x00, 0x06, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x0b,
-    0x00, 0x01, 0x00, 0x25, 0x00, 0x29, 0x00, 0x02, 0x00, 0x2c, 0x00, 0x34, 0x00, 0x07, 0x00, 0x38,
-    0x00, 0x3e, 0x00, 0x10, 0x00, 0x45, 0x00, 0x47, 0x00, 0x17, 0x00, 0x49, 0x00, 0x49, 0x00, 0x1a,
-    0x00, 0x4c, 0x00, 0x4c, 0x00, 0x1b, 0x00, 0x51, 0x00, 0x54, 0x00, 0x1c, 0x00, 0x56, 0x00, 0x56,
-    0x00, 0x20, 0x00, 0x5a, 0x00, 0x5a, 0x00, 0x21, 0x00, 0x5c, 0x00, 0x5e, 0x00, 0x22, 0x00, 0x8a,
-    0x00, 0x8a, 0x00, 0x25, 0x00, 0x96, 0x00, 0x96, 0x00, 0x26, 0x00, 0xb2, 0x00, 0xb2, 0x00, 0x27,
-    0x01, 0x84, 0x01, 0x85, 0x00, 0x28, 0x01, 0x87, 0x01, 0x89, 0x00, 0x2a, 0x01, 0xf2, 0x01, 0xf2,
-    0x00, 0x2d, 0x01, 0xf7, 0x01, 0xf7, 0x00, 0x2e, 0x01, 0xfa, 0x01, 0xfb, 0x00, 0x2f, 0x02, 0x05,
-    0x02, 0x05, 0x00, 0x31, 0x02, 0x4a, 0x02, 0x4a, 0x00, 0x32, 0x02, 0x4d, 0x02, 0x4d, 0x00, 0x33,
-    0x02, 0x5f, 0x02, 0x5f, 0x00, 0x34, 0x02, 0x61, 0x02, 0x62, 0x00, 0x35, 0x02, 0x95, 0x02, 0x96,
-    0x00, 0x37, 0x02, 0x98, 0x02, 0x98, 0x00, 0x39, 0x02, 0x9a, 0x02, 0xc0, 0x00, 0x3a, 0x02, 0xc5,
-    0x02, 0xca, 0x00, 0x61, 0x02, 0xcf, 0x02, 0xdf, 0x00, 0x67, 0x02, 0xe1, 0x02, 0xea, 0x00, 0x78,
-    0x02, 0xf3, 0x02, 0xf5, 0x00, 0x82, 0x02, 0xf7, 0x02, 0xf7, 0x00, 0x85, 0x02, 0xf9, 0x02, 0xf9,
-    0x00, 0x86, 0x02, 0xfb, 0x02, 0xfb, 0x00, 0x87, 0x02, 0xfd, 0x02, 0xfd, 0x00, 0x88, 0x03, 0x00,
-    0x03, 0x00, 0x00, 0x89, 0x03, 0x02, 0x03, 0x02, 0x00, 0x8a, 0x03, 0x04, 0x03, 0x04, 0x00, 0x8b,
-    0x03, 0x06, 0x03, 0x06, 0x00, 0x8c, 0x03, 0x08, 0x03, 0x08, 0x00, 0x8d, 0x03, 0x0a, 0x03, 0x0a,
-    0x00, 0x8e, 0x03, 0x0c, 0x03, 0x18, 0x00, 0x8f, 0x03, 0x1a, 0x03, 0x1a, 0x00, 0x9c, 0x03, 0x1c,
-    0x03, 0x1c, 0x00, 0x9d, 0x03, 0x1e, 0x03, 0x1e, 0x00, 0x9e, 0x03, 0x29, 0x03, 0x29, 0x00, 0x9f,
-    0x03, 0x2b, 0x03, 0x2b, 0x00, 0xa0, 0x03, 0x2d, 0x03, 0x2d, 0x00, 0xa1, 0x03, 0x2f, 0x03, 0x2f,
-    0x00, 0xa2, 0x03, 0x31, 0x03, 0x31, 0x00, 0xa3, 0x03, 0x33, 0x03, 0x33, 0x00, 0xa4, 0x03, 0x35,
-    0x03, 0x35, 0x00, 0xa5, 0x03, 0x37, 0x03, 0x37, 0x00, 0xa6, 0x03, 0x39, 0x03, 0x39, 0x00, 0xa7,
-    0x03, 0x3b, 0x03, 0x3b, 0x00, 0xa8, 0x03, 0x3d, 0x03, 0x45, 0x00, 0xa9, 0x03, 0x4a, 0x03, 0x53,
-    0x00, 0xb2, 0x03, 0x5e, 0x03, 0x62, 0x00, 0xbc, 0x03, 0x68, 0x03, 0x6a, 0x00, 0xc1, 0x03, 0x6f,
-    0x03, 0x6f, 0x00, 0xc4, 0x03, 0x80, 0x03, 0x84, 0x00, 0xc5, 0x03, 0x88, 0x03, 0x8a, 0x00, 0xca,
-    0x03, 0x93, 0x03, 0x93, 0x00, 0xcd, 0x03, 0xee, 0x03, 0xee, 0x00, 0xce, 0x03, 0xf0, 0x03, 0xf0,
-    0x00, 0xcf, 0x03, 0xf2, 0x03, 0xf2, 0x00, 0xd0, 0x03, 0xf4, 0x03, 0xf7, 0x00, 0xd1, 0x03, 0xfa,
-    0x03, 0xfe, 0x00, 0xd5, 0x04, 0x39, 0x04, 0x61, 0x00, 0xda, 0x04, 0x63, 0x04, 0x63, 0x01, 0x03,
-    0x04, 0x65, 0x04, 0x72, 0x01, 0x04, 0x04, 0x7a, 0x04, 0x7a, 0x01, 0x12, 0x04, 0x7d, 0x04, 0x7d,
-    0x01, 0x13, 0x04, 0x7f, 0x04, 0x7f, 0x01, 0x14, 0x04, 0x8b, 0x04, 0x90, 0x01, 0x15, 0x04, 0xb2,
-    0x04, 0xb6, 0x01, 0x1b, 0x04, 0xb8, 0x04, 0xb8, 0x01, 0x20, 0x04, 0xba, 0x04, 0xbb, 0x01, 0x21,
-    0x04, 0xbd, 0x04, 0xbd, 0x01, 0x23, 0x04, 0xc1, 0x04, 0xc3, 0x01, 0x24, 0x04, 0xc5, 0x04, 0xc5,
-    0x01, 0x27, 0x04, 0xc7, 0x04, 0xc9, 0x01, 0x28, 0x04, 0xcb, 0x04, 0xcb, 0x01, 0x2b, 0x04, 0xcd,
-    0x04, 0xcd, 0x01, 0x2c, 0x04, 0xcf, 0x04, 0xd5, 0x01, 0x2d, 0x04, 0xd7, 0x04, 0xd7, 0x01, 0x34,
-    0x04, 0xda, 0x04, 0xda, 0x01, 0x35, 0x04, 0xdc, 0x04, 0xe1, 0x01, 0x36, 0x04, 0xe3, 0x04, 0xe4,
-    0x01, 0x3c, 0x00, 0x02, 0x01, 0x09, 0x00, 0x06, 0x00, 0x06, 0x00, 0x0d, 0x00, 0x0b, 0x00, 0x0b,
-    0x00, 0x0d, 0x00, 0x10, 0x00, 0x10, 0x00, 0x12, 0x00, 0x11, 0x00, 0x11, 0x00, 0x15, 0x00, 0x12,
-    0x00, 0x12, 0x00, 0x12, 0x00, 0x25, 0x00, 0x25, 0x00, 0x03, 0x00, 0x27, 0x00, 0x27, 0x00, 0x01,
-    0x00, 0x2b, 0x00, 0x2b, 0x00, 0x01, 0x00, 0x2e, 0x00, 0x2e, 0x00, 0x1a, 0x00, 0x33, 0x00, 0x33,
-    0x00, 0x01, 0x00, 0x35, 0x00, 0x35, 0x00, 0x01, 0x00, 0x37, 0x00, 0x37, 0x00, 0x10, 0x00, 0x38,
-    0x00, 0x38, 0x00, 0x13, 0x00, 0x39, 0x00, 0x39, 0x00, 0x08, 0x00, 0x3a, 0x00, 0x3a, 0x00, 0x19,
-    0x00, 0x3b, 0x00, 0x3b, 0x00, 0x11, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x1d, 0x00, 0x3d, 0x00, 0x3d,
-    0x00, 0x0e, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x14, 0x00, 0x45, 0x00, 0x45, 0x00, 0x04, 0x00, 0x47,
-    0x00, 0x49, 0x00, 0x02, 0x00, 0x4b, 0x00, 0x4b, 0x00, 0x02, 0x00, 0x51, 0x00, 0x52, 0x00, 0x09,
-    0x00, 0x53, 0x00, 0x53, 0x00, 0x07, 0x00, 0x54, 0x00, 0x54, 0x00, 0x09, 0x00, 0x55, 0x00, 0x55,
-    0x00, 0x02, 0x00, 0x57, 0x00, 0x57, 0x00, 0x0f, 0x00, 0x59, 0x00, 0x59, 0x00, 0x06, 0x00, 0x5a,
-    0x00, 0x5a, 0x00, 0x0c, 0x00, 0x5c, 0x00, 0x5c, 0x00, 0x21, 0x00, 0x5d, 0x00, 0x5d, 0x00, 0x0c,
-    0x00, 0x5e, 0x00, 0x5e, 0x00, 0x17, 0x00, 0x83, 0x00, 0x83, 0x00, 0x01, 0x00, 0x93, 0x00, 0x93,
-    0x00, 0x01, 0x00, 0x94, 0x00, 0x94, 0x00, 0x02, 0x00, 0x98, 0x00, 0x98, 0x00, 0x01, 0x00, 0x99,
-    0x00, 0x99, 0x00, 0x02, 0x00, 0x9b, 0x00, 0x9b, 0x00, 0x06, 0x00, 0xb2, 0x00, 0xb2, 0x00, 0x20,
-    0x01, 0x81, 0x01, 0x82, 0x00, 0x15, 0x01, 0x84, 0x01, 0x85, 0x00, 0x0d, 0x01, 0x86, 0x01, 0x86,
-    0x00, 0x12, 0x01, 0x87, 0x01, 0x89, 0x00, 0x0d, 0x01, 0x8a, 0x01, 0x8a, 0x00, 0x12, 0x01, 0x8e,
-    0x01, 0x8f, 0x00, 0x12, 0x01, 0xdb, 0x01, 0xdb, 0x00, 0x0f, 0x01, 0xed, 0x01, 0xed, 0x00, 0x18,
-    0x01, 0xee, 0x01, 0xee, 0x00, 0x1e, 0x01, 0xef, 0x01, 0xef, 0x00, 0x1b, 0x01, 0xf1, 0x01, 0xf1,
-    0x00, 0x0a, 0x01, 0xf2, 0x01, 0xf2, 0x00, 0x1c, 0x01, 0xf3, 0x01, 0xf3, 0x00, 0x16, 0x01, 0xf5,
-    0x01, 0xf5, 0x00, 0x05, 0x01, 0xf7, 0x01, 0xf7, 0x00, 0x05, 0x01, 0xff, 0x01, 0xff, 0x00, 0x05,
-    0x02, 0x05, 0x02, 0x05, 0x00, 0x1f, 0x02, 0x4b, 0x02, 0x4b, 0x00, 0x05, 0x02, 0x4d, 0x02, 0x4d,
-    0x00, 0x0b, 0x02, 0x5f, 0x02, 0x60, 0x00, 0x01, 0x02, 0x62, 0x02, 0x63, 0x00, 0x01, 0x02, 0x94,
-    0x02, 0x94, 0x00, 0x15, 0x02, 0x9a, 0x02, 0xa0, 0x00, 0x03, 0x02, 0xa1, 0x02, 0xa1, 0x00, 0x01,
-    0x02, 0xab, 0x02, 0xaf, 0x00, 0x01, 0x02, 0xb0, 0x02, 0xb3, 0x00, 0x08, 0x02, 0xb4, 0x02, 0xb4,
-    0x00, 0x0e, 0x02, 0xb5, 0x02, 0xbb, 0x00, 0x04, 0x02, 0xbc, 0x02, 0xc0, 0x00, 0x02, 0x02, 0xc5,
-    0x02, 0xc5, 0x00, 0x09, 0x02, 0xc6, 0x02, 0xca, 0x00, 0x07, 0x02, 0xcb, 0x02, 0xce, 0x00, 0x06,
-    0x02, 0xcf, 0x02, 0xd0, 0x00, 0x0c, 0x02, 0xd1, 0x02, 0xd1, 0x00, 0x03, 0x02, 0xd2, 0x02, 0xd2,
-    0x00, 0x04, 0x02, 0xd3, 0x02, 0xd3, 0x00, 0x03, 0x02, 0xd4, 0x02, 0xd4, 0x00, 0x04, 0x02, 0xd5,
-    0x02, 0xd5, 0x00, 0x03, 0x02, 0xd6, 0x02, 0xd6, 0x00, 0x04, 0x02, 0xd7, 0x02, 0xd7, 0x00, 0x01,
-    0x02, 0xd8, 0x02, 0xd8, 0x00, 0x02, 0x02, 0xd9, 0x02, 0xd9, 0x00, 0x01, 0x02, 0xda, 0x02, 0xda,
-    0x00, 0x02, 0x02, 0xdb, 0x02, 0xdb, 0x00, 0x01, 0x02, 0xdc, 0x02, 0xdc, 0x00, 0x02, 0x02, 0xdd,
-    0x02, 0xdd, 0x00, 0x01, 0x02, 0xde, 0x02, 0xde, 0x00, 0x02, 0x02, 0xe0, 0x02, 0xe0, 0x00, 0x02,
-    0x02, 0xe2, 0x02, 0xe2, 0x00, 0x02, 0x02, 0xe4, 0x02, 0xe4, 0x00, 0x02, 0x02, 0xe6, 0x02, 0xe6,
-    0x00, 0x02, 0x02, 0xe8, 0x02, 0xe8, 0x00, 0x02, 0x02, 0xea, 0x02, 0xea, 0x00, 0x02, 0x02, 0xeb,
-    0x02, 0xeb, 0x00, 0x01, 0x02, 0xec, 0x02, 0xec, 0x00, 0x02, 0x02, 0xed, 0x02, 0xed, 0x00, 0x01,
-    0x02, 0xee, 0x02, 0xee, 0x00, 0x02, 0x02, 0xef, 0x02, 0xef, 0x00, 0x01, 0x02, 0xf0, 0x02, 0xf0,
-    0x00, 0x02, 0x02, 0xf1, 0x02, 0xf1, 0x00, 0x01, 0x02, 0xf2, 0x02, 0xf2, 0x00, 0x02, 0x03, 0x00,
-    0x03, 0x00, 0x00, 0x1a, 0x03, 0x0d, 0x03, 0x0d, 0x00, 0x09, 0x03, 0x0f, 0x03, 0x0f, 0x00, 0x09,
-    0x03, 0x11, 0x03, 0x12, 0x00, 0x09, 0x03, 0x13, 0x03, 0x13, 0x00, 0x01, 0x03, 0x14, 0x03, 0x14,
-    0x00, 0x07, 0x03, 0x15, 0x03, 0x15, 0x00, 0x01, 0x03, 0x16, 0x03, 0x16, 0x00, 0x07, 0x03, 0x17,
-    0x03, 0x17, 0x00, 0x01, 0x03, 0x18, 0x03, 0x18, 0x00, 0x07, 0x03, 0x1f, 0x03, 0x1f, 0x00, 0x10,
-    0x03, 0x20, 0x03, 0x20, 0x00, 0x0f, 0x03, 0x21, 0x03, 0x21, 0x00, 0x10, 0x03, 0x22, 0x03, 0x22,
-    0x00, 0x0f, 0x03, 0x23, 0x03, 0x23, 0x00, 0x10, 0x03, 0x24, 0x03, 0x24, 0x00, 0x0f, 0x03, 0x25,
-    0x03, 0x25, 0x00, 0x10, 0x03, 0x26, 0x03, 0x26, 0x00, 0x0f, 0x03, 0x27, 0x03, 0x27, 0x00, 0x10,
-    0x03, 0x28, 0x03, 0x28, 0x00, 0x0f, 0x03, 0x29, 0x03, 0x29, 0x00, 0x13, 0x03, 0x2b, 0x03, 0x2b,
-    0x00, 0x13, 0x03, 0x2d, 0x03, 0x2d, 0x00, 0x13, 0x03, 0x2f, 0x03, 0x2f, 0x00, 0x08, 0x03, 0x30,
-    0x03, 0x30, 0x00, 0x06, 0x03, 0x31, 0x03, 0x31, 0x00, 0x08, 0x03, 0x32, 0x03, 0x32, 0x00, 0x06,
-    0x03, 0x33, 0x03, 0x33, 0x00, 0x08, 0x03, 0x34, 0x03, 0x34, 0x00, 0x06, 0x03, 0x35, 0x03, 0x35,
-    0x00, 0x08, 0x03, 0x36, 0x03, 0x36, 0x00, 0x06, 0x03, 0x37, 0x03, 0x37, 0x00, 0x08, 0x03, 0x38,
-    0x03, 0x38, 0x00, 0x06, 0x03, 0x39, 0x03, 0x39, 0x00, 0x08, 0x03, 0x3a, 0x03, 0x3a, 0x00, 0x06,
-    0x03, 0x3b, 0x03, 0x3b, 0x00, 0x11, 0x03, 0x3d, 0x03, 0x3d, 0x00, 0x0e, 0x03, 0x3e, 0x03, 0x3e,
-    0x00, 0x0c, 0x03, 0x3f, 0x03, 0x3f, 0x00, 0x0e, 0x03, 0x40, 0x03, 0x40, 0x00, 0x14, 0x03, 0x41,
-    0x03, 0x41, 0x00, 0x17, 0x03, 0x42, 0x03, 0x42, 0x00, 0x14, 0x03, 0x43, 0x03, 0x43, 0x00, 0x17,
-    0x03, 0x44, 0x03, 0x44, 0x00, 0x14, 0x03, 0x45, 0x03, 0x45, 0x00, 0x17, 0x03, 0x48, 0x03, 0x48,
-    0x00, 0x01, 0x03, 0x4d, 0x03, 0x53, 0x00, 0x0b, 0x03, 0x54, 0x03, 0x54, 0x00, 0x05, 0x03, 0x5e,
-    0x03, 0x62, 0x00, 0x05, 0x03, 0x63, 0x03, 0x66, 0x00, 0x0a, 0x03, 0x67, 0x03, 0x67, 0x00, 0x18,
-    0x03, 0x68, 0x03, 0x6a, 0x00, 0x0b, 0x03, 0x6b, 0x03, 0x6e, 0x00, 0x05, 0x03, 0x75, 0x03, 0x78,
-    0x00, 0x05, 0x03, 0x88, 0x03, 0x8a, 0x00, 0x05, 0x03, 0x8e, 0x03, 0x91, 0x00, 0x16, 0x03, 0x93,
-    0x03, 0x93, 0x00, 0x1c, 0x03, 0x95, 0x03, 0x9a, 0x00, 0x0a, 0x03, 0x9b, 0x03, 0x9b, 0x00, 0x1b,
-    0x03, 0x9c, 0x03, 0x9d, 0x00, 0x18, 0x03, 0xee, 0x03, 0xee, 0x00, 0x11, 0x03, 0xf0, 0x03, 0xf0,
-    0x00, 0x11, 0x03, 0xf2, 0x03, 0xf2, 0x00, 0x11, 0x03, 0xf4, 0x03, 0xf4, 0x00, 0x0e, 0x03, 0xf5,
-    0x03, 0xf5, 0x00, 0x0c, 0x03, 0xf6, 0x03, 0xf7, 0x00, 0x0d, 0x03, 0xfa, 0x03, 0xfa, 0x00, 0x0d,
-    0x03, 0xfc, 0x03, 0xfc, 0x00, 0x09, 0x03, 0xfd, 0x03, 0xfd, 0x00, 0x03, 0x03, 0xfe, 0x03, 0xfe,
-    0x00, 0x04, 0x04, 0x39, 0x04, 0x39, 0x00, 0x03, 0x04, 0x3a, 0x04, 0x3a, 0x00, 0x04, 0x04, 0x3b,
-    0x04, 0x3b, 0x00, 0x03, 0x04, 0x3c, 0x04, 0x3c, 0x00, 0x04, 0x04, 0x3d, 0x04, 0x3d, 0x00, 0x03,
-    0x04, 0x3e, 0x04, 0x3e, 0x00, 0x04, 0x04, 0x3f, 0x04, 0x3f, 0x00, 0x03, 0x04, 0x40, 0x04, 0x40,
-    0x00, 0x04, 0x04, 0x41, 0x04, 0x41, 0x00, 0x03, 0x04, 0x42, 0x04, 0x42, 0x00, 0x04, 0x04, 0x43,
-    0x04, 0x43, 0x00, 0x03, 0x04, 0x44, 0x04, 0x44, 0x00, 0x04, 0x04, 0x45, 0x04, 0x45, 0x00, 0x03,
-    0x04, 0x46, 0x04, 0x46, 0x00, 0x04, 0x04, 0x47, 0x04, 0x47, 0x00, 0x03, 0x04, 0x48, 0x04, 0x48,
-    0x00, 0x04, 0x04, 0x49, 0x04, 0x49, 0x00, 0x03, 0x04, 0x4a, 0x04, 0x4a, 0x00, 0x04, 0x04, 0x4b,
-    0x04, 0x4b, 0x00, 0x03, 0x04, 0x4c, 0x04, 0x4c, 0x00, 0x04, 0x04, 0x4d, 0x04, 0x4d, 0x00, 0x03,
-    0x04, 0x4e, 0x04, 0x4e, 0x00, 0x04, 0x04, 0x4f, 0x04, 0x4f, 0x00, 0x03, 0x04, 0x50, 0x04, 0x50,
-    0x00, 0x04, 0x04, 0x52, 0x04, 0x52, 0x00, 0x02, 0x04, 0x54, 0x04, 0x54, 0x00, 0x02, 0x04, 0x56,
-    0x04, 0x56, 0x00, 0x02, 0x04, 0x58, 0x04, 0x58, 0x00, 0x02, 0x04, 0x5a, 0x04, 0x5a, 0x00, 0x02,
-    0x04, 0x5c, 0x04, 0x5c, 0x00, 0x02, 0x04, 0x5e, 0x04, 0x5e, 0x00, 0x02, 0x04, 0x60, 0x04, 0x60,
-    0x00, 0x02, 0x04, 0x65, 0x04, 0x65, 0x00, 0x01, 0x04, 0x66, 0x04, 0x66, 0x00, 0x07, 0x04, 0x67,
-    0x04, 0x67, 0x00, 0x01, 0x04, 0x68, 0x04, 0x68, 0x00, 0x07, 0x04, 0x69, 0x04, 0x69, 0x00, 0x01,
-    0x04, 0x6a, 0x04, 0x6a, 0x00, 0x07, 0x04, 0x6b, 0x04, 0x6b, 0x00, 0x01, 0x04, 0x6c, 0x04, 0x6c,
-    0x00, 0x07, 0x04, 0x6d, 0x04, 0x6d, 0x00, 0x01, 0x04, 0x6e, 0x04, 0x6e, 0x00, 0x07, 0x04, 0x6f,
-    0x04, 0x6f, 0x00, 0x01, 0x04, 0x70, 0x04, 0x70, 0x00, 0x07, 0x04, 0x71, 0x04, 0x71, 0x00, 0x01,
-    0x04, 0x72, 0x04, 0x72, 0x00, 0x07, 0x04, 0x73, 0x04, 0x73, 0x00, 0x01, 0x04, 0x74, 0x04, 0x74,
-    0x00, 0x02, 0x04, 0x75, 0x04, 0x75, 0x00, 0x01, 0x04, 0x76, 0x04, 0x76, 0x00, 0x02, 0x04, 0x77,
-    0x04, 0x77, 0x00, 0x01, 0x04, 0x78, 0x04, 0x78, 0x00, 0x02, 0x04, 0x79, 0x04, 0x79, 0x00, 0x01,
-    0x04, 0x7a, 0x04, 0x7a, 0x00, 0x07, 0x04, 0x7b, 0x04, 0x7b, 0x00, 0x01, 0x04, 0x7c, 0x04, 0x7c,
-    0x00, 0x02, 0x04, 0x7d, 0x04, 0x7d, 0x00, 0x08, 0x04, 0x7e, 0x04, 0x7e, 0x00, 0x06, 0x04, 0x7f,
-    0x04, 0x7f, 0x00, 0x08, 0x04, 0x80, 0x04, 0x80, 0x00, 0x06, 0x04, 0x82, 0x04, 0x82, 0x00, 0x06,
-    0x04, 0x84, 0x04, 0x84, 0x00, 0x06, 0x04, 0x86, 0x04, 0x86, 0x00, 0x06, 0x04, 0x88, 0x04, 0x88,
-    0x00, 0x06, 0x04, 0x8a, 0x04, 0x8a, 0x00, 0x06, 0x04, 0x8b, 0x04, 0x8b, 0x00, 0x0e, 0x04, 0x8c,
-    0x04, 0x8c, 0x00, 0x0c, 0x04, 0x8d, 0x04, 0x8d, 0x00, 0x0e, 0x04, 0x8e, 0x04, 0x8e, 0x00, 0x0c,
-    0x04, 0x8f, 0x04, 0x8f, 0x00, 0x0e, 0x04, 0x90, 0x04, 0x90, 0x00, 0x0c, 0x04, 0xa7, 0x04, 0xa7,
-    0x00, 0x15, 0x04, 0xb3, 0x04, 0xb3, 0x00, 0x09, 0x04, 0xb4, 0x04, 0xb4, 0x00, 0x03, 0x04, 0xb5,
-    0x04, 0xb5, 0x00, 0x04, 0x04, 0xb7, 0x04, 0xb7, 0x00, 0x02, 0x04, 0xba, 0x04, 0xba, 0x00, 0x01,
-    0x04, 0xbb, 0x04, 0xbb, 0x00, 0x07, 0x04, 0xbf, 0x04, 0xbf, 0x00, 0x06, 0x04, 0xc4, 0x04, 0xc4,
-    0x00, 0x02, 0x04, 0xc6, 0x04, 0xc6, 0x00, 0x02, 0x04, 0xd0, 0x04, 0xd0, 0x00, 0x09, 0x04, 0xd2,
-    0x04, 0xd2, 0x00, 0x09, 0x04, 0xd3, 0x04, 0xd3, 0x00, 0x01, 0x04, 0xd8, 0x04, 0xd8, 0x00, 0x10,
-    0x04, 0xd9, 0x04, 0xd9, 0x00, 0x0f, 0x04, 0xda, 0x04, 0xda, 0x00, 0x13, 0x04, 0xdc, 0x04, 0xdc,
-    0x00, 0x08, 0x04, 0xdd, 0x04, 0xdd, 0x00, 0x19, 0x04, 0xde, 0x04, 0xde, 0x00, 0x0c, 0x04, 0xdf,
-    0x04, 0xdf, 0x00, 0x19, 0x04, 0xe0, 0x04, 0xe0, 0x00, 0x0c, 0x04, 0xe1, 0x04, 0xe1, 0x00, 0x11,
-    0x04, 0xe3, 0x04, 0xe3, 0x00, 0x14, 0x04, 0xe4, 0x04, 0xe4, 0x00, 0x17, 0x00, 0x02, 0x00, 0xec,
-    0x00, 0x06, 0x00, 0x06, 0x00, 0x0c, 0x00, 0x0b, 0x00, 0x0b, 0x00, 0x0c, 0x00, 0x25, 0x00, 0x25,
-    0x00, 0x02, 0x00, 0x26, 0x00, 0x26, 0x00, 0x1b, 0x00, 0x27, 0x00, 0x27, 0x00, 0x0e, 0x00, 0x29,
-    0x00, 0x29, 0x00, 0x04, 0x00, 0x2c, 0x00, 0x2d, 0x00, 0x01, 0x00, 0x2e, 0x00, 0x2e, 0x00, 0x07,
-    0x00, 0x2f, 0x00, 0x2f, 0x00, 0x18, 0x00, 0x30, 0x00, 0x30, 0x00, 0x0f, 0x00, 0x31, 0x00, 0x32,
-    0x00, 0x01, 0x00, 0x34, 0x00, 0x34, 0x00, 0x1c, 0x00, 0x38, 0x00, 0x38, 0x00, 0x10, 0x00, 0x39,
-    0x00, 0x39, 0x00, 0x07, 0x00, 0x3a, 0x00, 0x3a, 0x00, 0x19, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x11,
-    0x00, 0x3c, 0x00, 0x3c, 0x00, 0x1e, 0x00, 0x3d, 0x00, 0x3d, 0x00, 0x0d, 0x00, 0x3e, 0x00, 0x3e,
-    0x00, 0x14, 0x00, 0x45, 0x00, 0x45, 0x00, 0x03, 0x00, 0x46, 0x00, 0x46, 0x00, 0x15, 0x00, 0x47,
-    0x00, 0x47, 0x00, 0x12, 0x00, 0x49, 0x00, 0x49, 0x00, 0x05, 0x00, 0x4c, 0x00, 0x4c, 0x00, 0x08,
-    0x00, 0x51, 0x00, 0x52, 0x00, 0x08, 0x00, 0x53, 0x00, 0x53, 0x00, 0x06, 0x00, 0x54, 0x00, 0x54,
-    0x00, 0x15, 0x00, 0x56, 0x00, 0x56, 0x00, 0x13, 0x00, 0x5a, 0x00, 0x5a, 0x00, 0x0b, 0x00, 0x5c,
-    0x00, 0x5c, 0x00, 0x22, 0x00, 0x5d, 0x00, 0x5d, 0x00, 0x0b, 0x00, 0x5e, 0x00, 0x5e, 0x00, 0x17,
-    0x00, 0x8a, 0x00, 0x8a, 0x00, 0x15, 0x00, 0x96, 0x00, 0x96, 0x00, 0x20, 0x00, 0xb2, 0x00, 0xb2,
-    0x00, 0x21, 0x01, 0x84, 0x01, 0x85, 0x00, 0x0c, 0x01, 0x87, 0x01, 0x89, 0x00, 0x0c, 0x01, 0xf2,
-    0x01, 0xf2, 0x00, 0x1a, 0x01, 0xf7, 0x01, 0xf7, 0x00, 0x09, 0x01, 0xfa, 0x01, 0xfa, 0x00, 0x16,
-    0x01, 0xfb, 0x01, 0xfb, 0x00, 0x1d, 0x02, 0x05, 0x02, 0x05, 0x00, 0x1f, 0x02, 0x4a, 0x02, 0x4a,
-    0x00, 0x09, 0x02, 0x4d, 0x02, 0x4d, 0x00, 0x0a, 0x02, 0x5f, 0x02, 0x5f, 0x00, 0x0e, 0x02, 0x98,
-    0x02, 0x98, 0x00, 0x10, 0x02, 0x9a, 0x02, 0xa0, 0x00, 0x02, 0x02, 0xa1, 0x02, 0xa1, 0x00, 0x0e,
-    0x02, 0xa2, 0x02, 0xa5, 0x00, 0x04, 0x02, 0xa6, 0x02, 0xaa, 0x00, 0x01, 0x02, 0xb0, 0x02, 0xb3,
-    0x00, 0x07, 0x02, 0xb4, 0x02, 0xb4, 0x00, 0x0d, 0x02, 0xb5, 0x02, 0xbb, 0x00, 0x03, 0x02, 0xbc,
-    0x02, 0xbc, 0x00, 0x12, 0x02, 0xbd, 0x02, 0xc0, 0x00, 0x05, 0x02, 0xc5, 0x02, 0xc5, 0x00, 0x08,
-    0x02, 0xc6, 0x02, 0xca, 0x00, 0x06, 0x02, 0xcf, 0x02, 0xd0, 0x00, 0x0b, 0x02, 0xd1, 0x02, 0xd1,
-    0x00, 0x02, 0x02, 0xd2, 0x02, 0xd2, 0x00, 0x03, 0x02, 0xd3, 0x02, 0xd3, 0x00, 0x02, 0x02, 0xd4,
-    0x02, 0xd4, 0x00, 0x03, 0x02, 0xd5, 0x02, 0xd5, 0x00, 0x02, 0x02, 0xd6, 0x02, 0xd6, 0x00, 0x03,
-    0x02, 0xd7, 0x02, 0xd7, 0x00, 0x0e, 0x02, 0xd8, 0x02, 0xd8, 0x00, 0x12, 0x02, 0xd9, 0x02, 0xd9,
-    0x00, 0x0e, 0x02, 0xda, 0x02, 0xda, 0x00, 0x12, 0x02, 0xdb, 0x02, 0xdb, 0x00, 0x0e, 0x02, 0xdc,
-    0x02, 0xdc, 0x00, 0x12, 0x02, 0xdd, 0x02, 0xdd, 0x00, 0x0e, 0x02, 0xde, 0x02, 0xde, 0x00, 0x12,
-    0x02, 0xe1, 0x02, 0xe1, 0x00, 0x04, 0x02, 0xe2, 0x02, 0xe2, 0x00, 0x05, 0x02, 0xe3, 0x02, 0xe3,
-    0x00, 0x04, 0x02, 0xe4, 0x02, 0xe4, 0x00, 0x05, 0x02, 0xe5, 0x02, 0xe5, 0x00, 0x04, 0x02, 0xe6,
-    0x02, 0xe6, 0x00, 0x05, 0x02, 0xe7, 0x02, 0xe7, 0x00, 0x04, 0x02, 0xe8, 0x02, 0xe8, 0x00, 0x05,
-    0x02, 0xe9, 0x02, 0xe9, 0x00, 0x04, 0x02, 0xea, 0x02, 0xea, 0x00, 0x05, 0x02, 0xf3, 0x02, 0xf3,
-    0x00, 0x01, 0x02, 0xf4, 0x02, 0xf4, 0x00, 0x08, 0x02, 0xf5, 0x02, 0xf5, 0x00, 0x01, 0x02, 0xf7,
-    0x02, 0xf7, 0x00, 0x01, 0x02, 0xf9, 0x02, 0xf9, 0x00, 0x01, 0x02, 0xfb, 0x02, 0xfb, 0x00, 0x01,
-    0x02, 0xfd, 0x02, 0xfd, 0x00, 0x01, 0x03, 0x00, 0x03, 0x00, 0x00, 0x07, 0x03, 0x02, 0x03, 0x02,
-    0x00, 0x18, 0x03, 0x04, 0x03, 0x04, 0x00, 0x0f, 0x03, 0x06, 0x03, 0x06, 0x00, 0x0f, 0x03, 0x08,
-    0x03, 0x08, 0x00, 0x0f, 0x03, 0x0a, 0x03, 0x0a, 0x00, 0x0f, 0x03, 0x0c, 0x03, 0x0c, 0x00, 0x01,
-    0x03, 0x0d, 0x03, 0x0d, 0x00, 0x08, 0x03, 0x0e, 0x03, 0x0e, 0x00, 0x01, 0x03, 0x0f, 0x03, 0x0f,
-    0x00, 0x08, 0x03, 0x10, 0x03, 0x10, 0x00, 0x01, 0x03, 0x11, 0x03, 0x12, 0x00, 0x08, 0x03, 0x14,
-    0x03, 0x14, 0x00, 0x06, 0x03, 0x16, 0x03, 0x16, 0x00, 0x06, 0x03, 0x18, 0x03, 0x18, 0x00, 0x06,
-    0x03, 0x1a, 0x03, 0x1a, 0x00, 0x13, 0x03, 0x1c, 0x03, 0x1c, 0x00, 0x13, 0x03, 0x1e, 0x03, 0x1e,
-    0x00, 0x13, 0x03, 0x29, 0x03, 0x29, 0x00, 0x10, 0x03, 0x2b, 0x03, 0x2b, 0x00, 0x10, 0x03, 0x2d,
-    0x03, 0x2d, 0x00, 0x10, 0x03, 0x2f, 0x03, 0x2f, 0x00, 0x07, 0x03, 0x31, 0x03, 0x31, 0x00, 0x07,
-    0x03, 0x33, 0x03, 0x33, 0x00, 0x07, 0x03, 0x35, 0x03, 0x35, 0x00, 0x07, 0x03, 0x37, 0x03, 0x37,
-    0x00, 0x07, 0x03, 0x39, 0x03, 0x39, 0x00, 0x07, 0x03, 0x3b, 0x03, 0x3b, 0x00, 0x11, 0x03, 0x3d,
-    0x03, 0x3d, 0x00, 0x0d, 0x03, 0x3e, 0x03, 0x3e, 0x00, 0x0b, 0x03, 0x3f, 0x03, 0x3f, 0x00, 0x0d,
-    0x03, 0x40, 0x03, 0x40, 0x00, 0x14, 0x03, 0x41, 0x03, 0x41, 0x00, 0x17, 0x03, 0x42, 0x03, 0x42,
-    0x00, 0x14, 0x03, 0x43, 0x03, 0x43, 0x00, 0x17, 0x03, 0x44, 0x03, 0x44, 0x00, 0x14, 0x03, 0x45,
-    0x03, 0x45, 0x00, 0x17, 0x03, 0x4a, 0x03, 0x4b, 0x00, 0x09, 0x03, 0x4c, 0x03, 0x4c, 0x00, 0x1a,
-    0x03, 0x4d, 0x03, 0x53, 0x00, 0x0a, 0x03, 0x5e, 0x03, 0x62, 0x00, 0x09, 0x03, 0x68, 0x03, 0x6a,
-    0x00, 0x0a, 0x03, 0x6f, 0x03, 0x6f, 0x00, 0x09, 0x03, 0x80, 0x03, 0x80, 0x00, 0x1d, 0x03, 0x81,
-    0x03, 0x84, 0x00, 0x16, 0x03, 0x88, 0x03, 0x8a, 0x00, 0x09, 0x03, 0x93, 0x03, 0x93, 0x00, 0x1a,
-    0x03, 0xee, 0x03, 0xee, 0x00, 0x11, 0x03, 0xf0, 0x03, 0xf0, 0x00, 0x11, 0x03, 0xf2, 0x03, 0xf2,
-    0x00, 0x11, 0x03, 0xf4, 0x03, 0xf4, 0x00, 0x0d, 0x03, 0xf5, 0x03, 0xf5, 0x00, 0x0b, 0x03, 0xf6,
-    0x03, 0xf7, 0x00, 0x0c, 0x03, 0xfa, 0x03, 0xfa, 0x00, 0x0c, 0x03, 0xfb, 0x03, 0xfb, 0x00, 0x01,
-    0x03, 0xfc, 0x03, 0xfc, 0x00, 0x08, 0x03, 0xfd, 0x03, 0xfd, 0x00, 0x02, 0x03, 0xfe, 0x03, 0xfe,
-    0x00, 0x03, 0x04, 0x39, 0x04, 0x39, 0x00, 0x02, 0x04, 0x3a, 0x04, 0x3a, 0x00, 0x03, 0x04, 0x3b,
-    0x04, 0x3b, 0x00, 0x02, 0x04, 0x3c, 0x04, 0x3c, 0x00, 0x03, 0x04, 0x3d, 0x04, 0x3d, 0x00, 0x02,
-    0x04, 0x3e, 0x04, 0x3e, 0x00, 0x03, 0x04, 0x3f, 0x04, 0x3f, 0x00, 0x02, 0x04, 0x40, 0x04, 0x40,
-    0x00, 0x03, 0x04, 0x41, 0x04, 0x41, 0x00, 0x02, 0x04, 0x42, 0x04, 0x42, 0x00, 0x03, 0x04, 0x43,
-    0x04, 0x43, 0x00, 0x02, 0x04, 0x44, 0x04, 0x44, 0x00, 0x03, 0x04, 0x45, 0x04, 0x45, 0x00, 0x02,
-    0x04, 0x46, 0x04, 0x46, 0x00, 0x03, 0x04, 0x47, 0x04, 0x47, 0x00, 0x02, 0x04, 0x48, 0x04, 0x48,
-    0x00, 0x03, 0x04, 0x49, 0x04, 0x49, 0x00, 0x02, 0x04, 0x4a, 0x04, 0x4a, 0x00, 0x03, 0x04, 0x4b,
-    0x04, 0x4b, 0x00, 0x02, 0x04, 0x4c, 0x04, 0x4c, 0x00, 0x03, 0x04, 0x4d, 0x04, 0x4d, 0x00, 0x02,
-    0x04, 0x4e, 0x04, 0x4e, 0x00, 0x03, 0x04, 0x4f, 0x04, 0x4f, 0x00, 0x02, 0x04, 0x50, 0x04, 0x50,
-    0x00, 0x03, 0x04, 0x51, 0x04, 0x51, 0x00, 0x04, 0x04, 0x52, 0x04, 0x52, 0x00, 0x05, 0x04, 0x53,
-    0x04, 0x53, 0x00, 0x04, 0x04, 0x54, 0x04, 0x54, 0x00, 0x05, 0x04, 0x55, 0x04, 0x55, 0x00, 0x04,
-    0x04, 0x56, 0x04, 0x56, 0x00, 0x05, 0x04, 0x57, 0x04, 0x57, 0x00, 0x04, 0x04, 0x58, 0x04, 0x58,
-    0x00, 0x05, 0x04, 0x59, 0x04, 0x59, 0x00, 0x04, 0x04, 0x5a, 0x04, 0x5a, 0x00, 0x05, 0x04, 0x5b,
-    0x04, 0x5b, 0x00, 0x04, 0x04, 0x5c, 0x04, 0x5c, 0x00, 0x05, 0x04, 0x5d, 0x04, 0x5d, 0x00, 0x04,
-    0x04, 0x5e, 0x04, 0x5e, 0x00, 0x05, 0x04, 0x5f, 0x04, 0x5f, 0x00, 0x04, 0x04, 0x60, 0x04, 0x60,
-    0x00, 0x05, 0x04, 0x61, 0x04, 0x61, 0x00, 0x01, 0x04, 0x63, 0x04, 0x63, 0x00, 0x01, 0x04, 0x66,
-    0x04, 0x66, 0x00, 0x06, 0x04, 0x68, 0x04, 0x68, 0x00, 0x06, 0x04, 0x6a, 0x04, 0x6a, 0x00, 0x06,
-    0x04, 0x6c, 0x04, 0x6c, 0x00, 0x06, 0x04, 0x6e, 0x04, 0x6e, 0x00, 0x06, 0x04, 0x70, 0x04, 0x70,
-    0x00, 0x06, 0x04, 0x72, 0x04, 0x72, 0x00, 0x06, 0x04, 0x7a, 0x04, 0x7a, 0x00, 0x06, 0x04, 0x7d,
-    0x04, 0x7d, 0x00, 0x07, 0x04, 0x7f, 0x04, 0x7f, 0x00, 0x07, 0x04, 0x8b, 0x04, 0x8b, 0x00, 0x0d,
-    0x04, 0x8c, 0x04, 0x8c, 0x00, 0x0b, 0x04, 0x8d, 0x04, 0x8d, 0x00, 0x0d, 0x04, 0x8e, 0x04, 0x8e,
-    0x00, 0x0b, 0x04, 0x8f, 0x04, 0x8f, 0x00, 0x0d, 0x04, 0x90, 0x04, 0x90, 0x00, 0x0b, 0x04, 0xb2,
-    0x04, 0xb2, 0x00, 0x01, 0x04, 0xb3, 0x04, 0xb3, 0x00, 0x08, 0x04, 0xb4, 0x04, 0xb4, 0x00, 0x02,
-    0x04, 0xb5, 0x04, 0xb5, 0x00, 0x03, 0x04, 0xb6, 0x04, 0xb6, 0x00, 0x04, 0x04, 0xb8, 0x04, 0xb8,
-    0x00, 0x01, 0x04, 0xbb, 0x04, 0xbb, 0x00, 0x06, 0x04, 0xbd, 0x04, 0xbd, 0x00, 0x13, 0x04, 0xc1,
-    0x04, 0xc1, 0x00, 0x1b, 0x04, 0xc2, 0x04, 0xc2, 0x00, 0x15, 0x04, 0xc7, 0x04, 0xc7, 0x00, 0x01,
-    0x04, 0xc8, 0x04, 0xc8, 0x00, 0x08, 0x04, 0xc9, 0x04, 0xc9, 0x00, 0x18, 0x04, 0xcb, 0x04, 0xcb,
-    0x00, 0x18, 0x04, 0xcd, 0x04, 0xcd, 0x00, 0x0f, 0x04, 0xcf, 0x04, 0xcf, 0x00, 0x01, 0x04, 0xd0,
-    0x04, 0xd0, 0x00, 0x08, 0x04, 0xd1, 0x04, 0xd1, 0x00, 0x01, 0x04, 0xd2, 0x04, 0xd2, 0x00, 0x08,
-    0x04, 0xd4, 0x04, 0xd4, 0x00, 0x1c, 0x04, 0xd5, 0x04, 0xd5, 0x00, 0x15, 0x04, 0xd7, 0x04, 0xd7,
-    0x00, 0x13, 0x04, 0xda, 0x04, 0xda, 0x00, 0x10, 0x04, 0xdc, 0x04, 0xdc, 0x00, 0x07, 0x04, 0xdd,
-    0x04, 0xdd, 0x00, 0x19, 0x04, 0xde, 0x04, 0xde, 0x00, 0x0b, 0x04, 0xdf, 0x04, 0xdf, 0x00, 0x19,
-    0x04, 0xe0, 0x04, 0xe0, 0x00, 0x0b, 0x04, 0xe1, 0x04, 0xe1, 0x00, 0x11, 0x04, 0xe3, 0x04, 0xe3,
-    0x00, 0x14, 0x04, 0xe4, 0x04, 0xe4, 0x00, 0x17, 0x00, 0x01, 0x01, 0xf2, 0x00, 0x04, 0x00, 0x00,
-    0x00, 0xf4, 0x0d, 0x22, 0x0d, 0x1c, 0x0d, 0x1c, 0x0c, 0xd6, 0x0c, 0xc0, 0x0c, 0xb2, 0x0c, 0xac,
-    0x0c, 0x9e, 0x0a, 0x00, 0x09, 0xf2, 0x09, 0xdc, 0x0c, 0xac, 0x09, 0xd2, 0x09, 0x48, 0x09, 0x06,
-    0x08, 0xe4, 0x08, 0xd2, 0x08, 0xbc, 0x08, 0xb2, 0x08, 0x74, 0x08, 0x66, 0x08, 0x24, 0x16, 0xc4,
-    0x07, 0x4a, 0x16, 0xc4, 0x06, 0xa4, 0x16, 0xc4, 0x16, 0xc4, 0x16, 0xc4, 0x06, 0x96, 0x06, 0x48,
-    0x06, 0x42, 0x06, 0x28, 0x06, 0x42, 0x05, 0xe6, 0x0c, 0xac, 0x05, 0x90, 0x05, 0x7e, 0x0d, 0x1c,
-    0x04, 0x54, 0x0d, 0x1c, 0x0d, 0x1c, 0x0d, 0x1c, 0x04, 0x4e, 0x04, 0x28, 0x04, 0x02, 0x03, 0xfc,
-    0x03, 0xf2, 0x03, 0xec, 0x03, 0xde, 0x03, 0xec, 0x0c, 0xb2, 0x0c, 0xac, 0x0c, 0xac, 0x0c, 0xac,
-    0x0c, 0xac, 0x08, 0xe4, 0x0c, 0xc0, 0x0c, 0xc0, 0x0c, 0xc0, 0x0c, 0xc0, 0x0c, 0xc0, 0x0c, 0xc0,
-    0x0c, 0xc0, 0x0c, 0xb2, 0x0c, 0x9e, 0x0c, 0x9e, 0x0c, 0x9e, 0x0c, 0x9e, 0x0c, 0xac, 0x0c, 0xac,
-    0x0c, 0xac, 0x0c, 0xac, 0x0c, 0xac, 0x08, 0x74, 0x16, 0xc4, 0x16, 0xc4, 0x16, 0xc4, 0x16, 0xc4,
-    0x16, 0xc4, 0x16, 0xc4, 0x16, 0xc4, 0x16, 0xc4, 0x16, 0xc4, 0x16, 0xc4, 0x06, 0x42, 0x06, 0x42,
-    0x0c, 0xc0, 0x0c, 0xc0, 0x0c, 0xc0, 0x0c, 0xb2, 0x0c, 0xb2, 0x0c, 0xb2, 0x0c, 0xb2, 0x0c, 0xac,
-    0x0c, 0x9e, 0x16, 0xc4, 0x0c, 0x9e, 0x16, 0xc4, 0x0c, 0x9e, 0x16, 0xc4, 0x0c, 0x9e, 0x16, 0xc4,
-    0x0c, 0x9e, 0x16, 0xc4, 0x16, 0xc4, 0x09, 0xf2, 0x09, 0xdc, 0x09, 0xdc, 0x09, 0xdc, 0x09, 0xdc,
-    0x16, 0xc4, 0x16, 0xc4, 0x16, 0xc4, 0x16, 0xc4, 0x0c, 0xac, 0x16, 0xc4, 0x0c, 0xac, 0x16, 0xc4,
-    0x0c, 0xac, 0x16, 0xc4, 0x06, 0x96, 0x06, 0x96, 0x06, 0x96, 0x08, 0xe4, 0x08, 0xe4, 0x08, 0xe4,
-    0x08, 0xbc, 0x08, 0x74, 0x06, 0x42, 0x08, 0x74, 0x08, 0x66, 0x08, 0x66, 0x08, 0x66, 0x03, 0xfc,
-    0x03, 0xfc, 0x04, 0x4e, 0x03, 0xec, 0x03, 0xec, 0x03, 0xec, 0x03, 0xec, 0x03, 0xec, 0x03, 0xec,
-    0x03, 0xec, 0x03, 0xfc, 0x03, 0xfc, 0x03, 0xfc, 0x03, 0xfc, 0x03, 0xfc, 0x03, 0xec, 0x03, 0xec,
-    0x03, 0xec, 0x03, 0xfc, 0x03, 0xf2, 0x03, 0xf2, 0x03, 0xf2, 0x03, 0xf2, 0x03, 0xfc, 0x03, 0xfc,
-    0x03, 0xfc, 0x04, 0x4e, 0x08, 0xbc, 0x08, 0xbc, 0x08, 0xbc, 0x08, 0x74, 0x06, 0x42, 0x0d, 0x1c,
-    0x0d, 0x1c, 0x0d, 0x1c, 0x16, 0xc4, 0x0c, 0xc0, 0x0c, 0xc0, 0x0c, 0xc0, 0x0c, 0xc0, 0x0c, 0xc0,
-    0x0c, 0xc0, 0x0c, 0xc0, 0x0c, 0xc0, 0x0c, 0xc0, 0x0c, 0xc0, 0x0c, 0xc0, 0x0c, 0xc0, 0x0c, 0xc0,
-    0x0c, 0x9e, 0x16, 0xc4, 0x0c, 0x9e, 0x16, 0xc4, 0x0c, 0x9e, 0x16, 0xc4, 0x0c, 0x9e, 0x16, 0xc4,
-    0x0c, 0x9e, 0x16, 0xc4, 0x0c, 0x9e, 0x16, 0xc4, 0x0c, 0x9e, 0x16, 0xc4, 0x0c, 0x9e, 0x16, 0xc4,
-    0x0c, 0xac, 0x16, 0xc4, 0x0c, 0xac, 0x16, 0xc4, 0x0c, 0xac, 0x16, 0xc4, 0x0c, 0xac, 0x16, 0xc4,
-    0x0c, 0xac, 0x16, 0xc4, 0x0c, 0xac, 0x16, 0xc4, 0x0c, 0xac, 0x16, 0xc4, 0x16, 0xc4, 0x08, 0x74,
-    0x06, 0x42, 0x08, 0x74, 0x06, 0x42, 0x08, 0x74, 0x06, 0x42, 0x16, 0xc4, 0x0c, 0xc0, 0x0c, 0x9e,
-    0x0c, 0xac, 0x16, 0xc4, 0x06, 0x96, 0x0c, 0xac, 0x0c, 0xac, 0x16, 0xc4, 0x09, 0xf2, 0x09, 0xf2,
-    0x09, 0xdc, 0x16, 0xc4, 0x16, 0xc4, 0x0c, 0xac, 0x09, 0xd2, 0x06, 0x96, 0x08, 0xe4, 0x08, 0xd2,
-    0x06, 0x42, 0x08, 0xd2, 0x06, 0x42, 0x08, 0xbc, 0x08, 0x66, 0x00, 0x01, 0x00, 0xf4, 0x00, 0x04,
-    0x00, 0x06, 0x00, 0x0b, 0x00, 0x0c, 0x00, 0x25, 0x00, 0x27, 0x00, 0x28, 0x00, 0x29, 0x00, 0x2a,
-    0x00, 0x2f, 0x00, 0x30, 0x00, 0x33, 0x00, 0x34, 0x00, 0x35, 0x00, 0x36, 0x00, 0x38, 0x00, 0x3a,
-    0x00, 0x3b, 0x00, 0x3c, 0x00, 0x3d, 0x00, 0x3e, 0x00, 0x3f, 0x00, 0x49, 0x00, 0x4a, 0x00, 0x4c,
-    0x00, 0x4f, 0x00, 0x51, 0x00, 0x52, 0x00, 0x53, 0x00, 0x56, 0x00, 0x58, 0x00, 0x5a, 0x00, 0x5b,
-    0x00, 0x5d, 0x00, 0x5f, 0x00, 0x96, 0x00, 0x9d, 0x00, 0xb2, 0x01, 0x84, 0x01, 0x85, 0x01, 0x87,
-    0x01, 0x88, 0x01, 0x89, 0x01, 0xf2, 0x01, 0xf4, 0x01, 0xf5, 0x01, 0xf7, 0x01, 0xfa, 0x02, 0x05,
-    0x02, 0x4a, 0x02, 0x4d, 0x02, 0x5f, 0x02, 0x61, 0x02, 0x62, 0x02, 0x95, 0x02, 0x96, 0x02, 0x98,
-    0x02, 0x9a, 0x02, 0x9b, 0x02, 0x9c, 0x02, 0x9d, 0x02, 0x9e, 0x02, 0x9f, 0x02, 0xa0, 0x02, 0xa1,
-    0x02, 0xa2, 0x02, 0xa3, 0x02, 0xa4, 0x02, 0xa5, 0x02, 0xab, 0x02, 0xac, 0x02, 0xad, 0x02, 0xae,
-    0x02, 0xaf, 0x02, 0xb4, 0x02, 0xbd, 0x02, 0xbe, 0x02, 0xbf, 0x02, 0xc0, 0x02, 0xc5, 0x02, 0xc6,
-    0x02, 0xc7, 0x02, 0xc8, 0x02, 0xc9, 0x02, 0xca, 0x02, 0xcf, 0x02, 0xd0, 0x02, 0xd1, 0x02, 0xd3,
-    0x02, 0xd5, 0x02, 0xd7, 0x02, 0xd9, 0x02, 0xdb, 0x02, 0xdd, 0x02, 0xdf, 0x02, 0xe1, 0x02, 0xe2,
-    0x02, 0xe3, 0x02, 0xe4, 0x02, 0xe5, 0x02, 0xe6, 0x02, 0xe7, 0x02, 0xe8, 0x02, 0xe9, 0x02, 0xea,
-    0x02, 0xf4, 0x03, 0x02, 0x03, 0x04, 0x03, 0x06, 0x03, 0x08, 0x03, 0x0a, 0x03, 0x0d, 0x03, 0x0f,
-    0x03, 0x11, 0x03, 0x12, 0x03, 0x13, 0x03, 0x14, 0x03, 0x15, 0x03, 0x16, 0x03, 0x17, 0x03, 0x18,
-    0x03, 0x1a, 0x03, 0x1c, 0x03, 0x1e, 0x03, 0x29, 0x03, 0x2b, 0x03, 0x2d, 0x03, 0x3b, 0x03, 0x3d,
-    0x03, 0x3e, 0x03, 0x3f, 0x03, 0x40, 0x03, 0x42, 0x03, 0x44, 0x03, 0x4a, 0x03, 0x4b, 0x03, 0x4c,
-    0x03, 0x4d, 0x03, 0x4e, 0x03, 0x4f, 0x03, 0x50, 0x03, 0x51, 0x03, 0x52, 0x03, 0x53, 0x03, 0x5e,
-    0x03, 0x5f, 0x03, 0x60, 0x03, 0x61, 0x03, 0x62, 0x03, 0x68, 0x03, 0x69, 0x03, 0x6a, 0x03, 0x6f,
-    0x03, 0x81, 0x03, 0x82, 0x03, 0x83, 0x03, 0x84, 0x03, 0x88, 0x03, 0x89, 0x03, 0x8a, 0x03, 0x93,
-    0x03, 0xee, 0x03, 0xf0, 0x03, 0xf2, 0x03, 0xf4, 0x03, 0xf5, 0x03, 0xf6, 0x03, 0xf7, 0x03, 0xfa,
-    0x03, 0xfc, 0x03, 0xfd, 0x04, 0x39, 0x04, 0x3b, 0x04, 0x3d, 0x04, 0x3f, 0x04, 0x41, 0x04, 0x43,
-    0x04, 0x45, 0x04, 0x47, 0x04, 0x49, 0x04, 0x4b, 0x04, 0x4d, 0x04, 0x4f, 0x04, 0x51, 0x04, 0x52,
-    0x04, 0x53, 0x04, 0x54, 0x04, 0x55, 0x04, 0x56, 0x04, 0x57, 0x04, 0x58, 0x04, 0x59, 0x04, 0x5a,
-    0x04, 0x5b, 0x04, 0x5c, 0x04, 0x5d, 0x04, 0x5e, 0x04, 0x5f, 0x04, 0x60, 0x04, 0x65, 0x04, 0x66,
-    0x04, 0x67, 0x04, 0x68, 0x04, 0x69, 0x04, 0x6a, 0x04, 0x6b, 0x04, 0x6c, 0x04, 0x6d, 0x04, 0x6e,
-    0x04, 0x6f, 0x04, 0x70, 0x04, 0x71, 0x04, 0x72, 0x04, 0x7a, 0x04, 0x8b, 0x04, 0x8c, 0x04, 0x8d,
-    0x04, 0x8e, 0x04, 0x8f, 0x04, 0x90, 0x04, 0xb3, 0x04, 0xb4, 0x04, 0xb6, 0x04, 0xba, 0x04, 0xbb,
-    0x04, 0xbd, 0x04, 0xc3, 0x04, 0xc5, 0x04, 0xc8, 0x04, 0xc9, 0x04, 0xcb, 0x04, 0xcd, 0x04, 0xd0,
-    0x04, 0xd2, 0x04, 0xd3, 0x04, 0xd4, 0x04, 0xd7, 0x04, 0xda, 0x04, 0xdd, 0x04, 0xde, 0x04, 0xdf,
-    0x04, 0xe0, 0x04, 0xe1, 0x04, 0xe3, 0x00, 0x03, 0x01, 0xef, 0xff, 0xf5, 0x01, 0xf0, 0xff, 0xee,
-    0x03, 0x9b, 0xff, 0xf5, 0x00, 0x01, 0x01, 0xf0, 0xff, 0xc7, 0x00, 0x02, 0x01, 0xf0, 0xff, 0xb7,
-    0x01, 0xf5, 0xff, 0xf0, 0x00, 0x01, 0x01, 0xf0, 0xff, 0xf1, 0x00, 0x09, 0x01, 0xed, 0xff, 0xe5,
-    0x01, 0xef, 0xff, 0xf1, 0x01, 0xf0, 0xff, 0xeb, 0x01, 0xf2, 0xff, 0xe9, 0x03, 0x67, 0xff, 0xe5,
-    0x03, 0x93, 0xff, 0xe9, 0x03, 0x9b, 0xff, 0xf1, 0x03, 0x9c, 0xff, 0xe5, 0x03, 0x9d, 0xff, 0xe5,
-    0x00, 0x09, 0x01, 0xed, 0xff, 0xee, 0x01, 0xef, 0xff, 0xf5, 0x01, 0xf0, 0xff, 0xf1, 0x01, 0xf2,
-    0xff, 0xf2, 0x03, 0x67, 0xff, 0xee, 0x03, 0x93, 0xff, 0xf2, 0x03, 0x9b, 0xff, 0xf5, 0x03, 0x9c,
-    0xff, 0xee, 0x03, 0x9d, 0xff, 0xee, 0x00, 0x01, 0x01, 0xf0, 0x00, 0x0d, 0x00, 0x4a, 0x00, 0x47,
-    0xff, 0xc5, 0x00, 0x48, 0xff, 0xc5, 0x00, 0x49, 0xff, 0xc5, 0x00, 0x4b, 0xff, 0xc5, 0x00, 0x4c,
-    0x00, 0x20, 0x00, 0x4f, 0x00, 0x20, 0x00, 0x50, 0x00, 0x20, 0x00, 0x53, 0xff, 0x80, 0x00, 0x55,
-    0xff, 0xc5, 0x00, 0x57, 0xff, 0x90, 0x00, 0x5b, 0x00, 0x0b, 0x00, 0x94, 0xff, 0xc5, 0x00, 0x99,
-    0xff, 0xc5, 0x01, 0xdb, 0xff, 0x90, 0x02, 0xbc, 0xff, 0xc5, 0x02, 0xbd, 0xff, 0xc5, 0x02, 0xbe,
-    0xff, 0xc5, 0x02, 0xbf, 0xff, 0xc5, 0x02, 0xc0, 0xff, 0xc5, 0x02, 0xc6, 0xff, 0x80, 0x02, 0xc7,
-    0xff, 0x80, 0x02, 0xc8, 0xff, 0x80, 0x02, 0xc9, 0xff, 0x80, 0x02, 0xca, 0xff, 0x80, 0x02, 0xd8,
-    0xff, 0xc5, 0x02, 0xda, 0xff, 0xc5, 0x02, 0xdc, 0xff, 0xc5, 0x02, 0xde, 0xff, 0xc5, 0x02, 0xe0,
-    0xff, 0xc5, 0x02, 0xe2, 0xff, 0xc5, 0x02, 0xe4, 0xff, 0xc5, 0x02, 0xe6, 0xff, 0xc5, 0x02, 0xe8,
-    0xff, 0xc5, 0x02, 0xea, 0xff, 0xc5, 0x02, 0xec, 0xff, 0xc5, 0x02, 0xee, 0xff, 0xc5, 0x02, 0xf0,
-    0xff, 0xc5, 0x02, 0xf2, 0xff, 0xc5, 0x03, 0x14, 0xff, 0x80, 0x03, 0x16, 0xff, 0x80, 0x03, 0x18,
-    0xff, 0x80, 0x03, 0x20, 0xff, 0x90, 0x03, 0x22, 0xff, 0x90, 0x03, 0x24, 0xff, 0x90, 0x03, 0x26,
-    0xff, 0x90, 0x03, 0x28, 0xff, 0x90, 0x04, 0x52, 0xff, 0xc5, 0x04, 0x54, 0xff, 0xc5, 0x04, 0x56,
-    0xff, 0xc5, 0x04, 0x58, 0xff, 0xc5, 0x04, 0x5a, 0xff, 0xc5, 0x04, 0x5c, 0xff, 0xc5, 0x04, 0x5e,
-    0xff, 0xc5, 0x04, 0x60, 0xff, 0xc5, 0x04, 0x66, 0xff, 0x80, 0x04, 0x68, 0xff, 0x80, 0x04, 0x6a,
-    0xff, 0x80, 0x04, 0x6c, 0xff, 0x80, 0x04, 0x6e, 0xff, 0x80, 0x04, 0x70, 0xff, 0x80, 0x04, 0x72,
-    0xff, 0x80, 0x04, 0x74, 0xff, 0xc5, 0x04, 0x76, 0xff, 0xc5, 0x04, 0x78, 0xff, 0xc5, 0x04, 0x7a,
-    0xff, 0x80, 0x04, 0x7c, 0xff, 0xc5, 0x04, 0xb7, 0xff, 0xc5, 0x04, 0xbb, 0xff, 0x80, 0x04, 0xc4,
-    0xff, 0xc5, 0x04, 0xc6, 0xff, 0xc5, 0x04, 0xc8, 0x00, 0x20, 0x04, 0xca, 0x00, 0x20, 0x04, 0xcc,
-    0x00, 0x20, 0x04, 0xd9, 0xff, 0x90, 0x00, 0x04, 0x00, 0x58, 0xff, 0xef, 0x00, 0x5b, 0xff, 0xdf,
-    0x00, 0x9a, 0xff, 0xee, 0x01, 0xf0, 0xff, 0xcd, 0x00, 0x15, 0x00, 0x06, 0xff, 0xf2, 0x00, 0x0b,
-    0xff, 0xf2, 0x00, 0x5a, 0xff, 0xf3, 0x00, 0x5d, 0xff, 0xf3, 0x01, 0x84, 0xff, 0xf2, 0x01, 0x85,
-    0xff, 0xf2, 0x01, 0x87, 0xff, 0xf2, 0x01, 0x88, 0xff, 0xf2, 0x01, 0x89, 0xff, 0xf2, 0x02, 0xcf,
-    0xff, 0xf3, 0x02, 0xd0, 0xff, 0xf3, 0x03, 0x3e, 0xff, 0xf3, 0x03, 0xf5, 0xff, 0xf3, 0x03, 0xf6,
-    0xff, 0xf2, 0x03, 0xf7, 0xff, 0xf2, 0x03, 0xfa, 0xff, 0xf2, 0x04, 0x8c, 0xff, 0xf3, 0x04, 0x8e,
-    0xff, 0xf3, 0x04, 0x90, 0xff, 0xf3, 0x04, 0xde, 0xff, 0xf3, 0x04, 0xe0, 0xff, 0xf3, 0x00, 0x10,
-    0x00, 0x2e, 0xff, 0xec, 0x00, 0x39, 0xff, 0xec, 0x02, 0xb0, 0xff, 0xec, 0x02, 0xb1, 0xff, 0xec,
-    0x02, 0xb2, 0xff, 0xec, 0x02, 0xb3, 0xff, 0xec, 0x03, 0x00, 0xff, 0xec, 0x03, 0x2f, 0xff, 0xec,
-    0x03, 0x31, 0xff, 0xec, 0x03, 0x33, 0xff, 0xec, 0x03, 0x35, 0xff, 0xec, 0x03, 0x37, 0xff, 0xec,
-    0x03, 0x39, 0xff, 0xec, 0x04, 0x7d, 0xff, 0xec, 0x04, 0x7f, 0xff, 0xec, 0x04, 0xdc, 0xff, 0xec,
-    0x00, 0x06, 0x00, 0x10, 0xff, 0x84, 0x00, 0x12, 0xff, 0x84, 0x01, 0x86, 0xff, 0x84, 0x01, 0x8a,
-    0xff, 0x84, 0x01, 0x8e, 0xff, 0x84, 0x01, 0x8f, 0xff, 0x84, 0x00, 0x01, 0x00, 0x4a, 0x00, 0x0d,
-    0x00, 0x13, 0x00, 0x53, 0xff, 0xec, 0x01, 0x85, 0x00, 0x00, 0x02, 0xc6, 0xff, 0xec, 0x02, 0xc7,
-    0xff, 0xec, 0x02, 0xc8, 0xff, 0xec, 0x02, 0xc9, 0xff, 0xec, 0x02, 0xca, 0xff, 0xec, 0x03, 0x14,
-    0xff, 0xec, 0x03, 0x16, 0xff, 0xec, 0x03, 0x18, 0xff, 0xec, 0x04, 0x66, 0xff, 0xec, 0x04, 0x68,
-    0xff, 0xec, 0x04, 0x6a, 0xff, 0xec, 0x04, 0x6c, 0xff, 0xec, 0x04, 0x6e, 0xff, 0xec, 0x04, 0x70,
-    0xff, 0xec, 0x04, 0x72, 0xff, 0xec, 0x04, 0x7a, 0xff, 0xec, 0x04, 0xbb, 0xff, 0xec, 0x00, 0x03,
-    0x00, 0x4a, 0x00, 0x0f, 0x00, 0x58, 0x00, 0x32, 0x00, 0x5b, 0x00, 0x11, 0x00, 0x29, 0x00, 0x47,
-    0xff, 0xec, 0x00, 0x48, 0xff, 0xec, 0x00, 0x49, 0xff, 0xec, 0x00, 0x4b, 0xff, 0xec, 0x00, 0x55,
-    0xff, 0xec, 0x00, 0x94, 0xff, 0xec, 0x00, 0x99, 0xff, 0xec, 0x02, 0xbc, 0xff, 0xec, 0x02, 0xbd,
-    0xff, 0xec, 0x02, 0xbe, 0xff, 0xec, 0x02, 0xbf, 0xff, 0xec, 0x02, 0xc0, 0xff, 0xec, 0x02, 0xd8,
-    0xff, 0xec, 0x02, 0xda, 0xff, 0xec, 0x02, 0xdc, 0xff, 0xec, 0x02, 0xde, 0xff, 0xec, 0x02, 0xe0,
-    0xff, 0xec, 0x02, 0xe2, 0xff, 0xec, 0x02, 0xe4, 0xff, 0xec, 0x02, 0xe6, 0xff, 0xec, 0x02, 0xe8,
-    0xff, 0xec, 0x02, 0xea, 0xff, 0xec, 0x02, 0xec, 0xff, 0xec, 0x02, 0xee, 0xff, 0xec, 0x02, 0xf0,
-    0xff, 0xec, 0x02, 0xf2, 0xff, 0xec, 0x04, 0x52, 0xff, 0xec, 0x04, 0x54, 0xff, 0xec, 0x04, 0x56,
-    0xff, 0xec, 0x04, 0x58, 0xff, 0xec, 0x04, 0x5a, 0xff, 0xec, 0x04, 0x5c, 0xff, 0xec, 0x04, 0x5e,
-    0xff, 0xec, 0x04, 0x60, 0xff, 0xec, 0x04, 0x74, 0xff, 0xec, 0x04, 0x76, 0xff, 0xec, 0x04, 0x78,
-    0xff, 0xec, 0x04, 0x7c, 0xff, 0xec, 0x04, 0xb7, 0xff, 0xec, 0x04, 0xc4, 0xff, 0xec, 0x04, 0xc6,
-    0xff, 0xec, 0x00, 0x36, 0x00, 0x06, 0x00, 0x10, 0x00, 0x0b, 0x00, 0x10, 0x00, 0x0d, 0x00, 0x14,
-    0x00, 0x41, 0x00, 0x12, 0x00, 0x47, 0xff, 0xe8, 0x00, 0x48, 0xff, 0xe8, 0x00, 0x49, 0xff, 0xe8,
-    0x00, 0x4b, 0xff, 0xe8, 0x00, 0x55, 0xff, 0xe8, 0x00, 0x61, 0x00, 0x13, 0x00, 0x94, 0xff, 0xe8,
-    0x00, 0x99, 0xff, 0xe8, 0x01, 0x84, 0x00, 0x10, 0x01, 0x85, 0x00, 0x10, 0x01, 0x87, 0x00, 0x10,
-    0x01, 0x88, 0x00, 0x10, 0x01, 0x89, 0x00, 0x10, 0x02, 0xbc, 0xff, 0xe8, 0x02, 0xbd, 0xff, 0xe8,
-    0x02, 0xbe, 0xff, 0xe8, 0x02, 0xbf, 0xff, 0xe8, 0x02, 0xc0, 0xff, 0xe8, 0x02, 0xd8, 0xff, 0xe8,
-    0x02, 0xda, 0xff, 0xe8, 0x02, 0xdc, 0xff, 0xe8, 0x02, 0xde, 0xff, 0xe8, 0x02, 0xe0, 0xff, 0xe8,
-    0x02, 0xe2, 0xff, 0xe8, 0x02, 0xe4, 0xff, 0xe8, 0x02, 0xe6, 0xff, 0xe8, 0x02, 0xe8, 0xff, 0xe8,
-    0x02, 0xea, 0xff, 0xe8, 0x02, 0xec, 0xff, 0xe8, 0x02, 0xee, 0xff, 0xe8, 0x02, 0xf0, 0xff, 0xe8,
-    0x02, 0xf2, 0xff, 0xe8, 0x03, 0xf6, 0x00, 0x10, 0x03, 0xf7, 0x00, 0x10, 0x03, 0xfa, 0x00, 0x10,
-    0x04, 0x52, 0xff, 0xe8, 0x04, 0x54, 0xff, 0xe8, 0x04, 0x56, 0xff, 0xe8, 0x04, 0x58, 0xff, 0xe8,
-    0x04, 0x5a, 0xff, 0xe8, 0x04, 0x5c, 0xff, 0xe8, 0x04, 0x5e, 0xff, 0xe8, 0x04, 0x60, 0xff, 0xe8,
-    0x04, 0x74, 0xff, 0xe8, 0x04, 0x76, 0xff, 0xe8, 0x04, 0x78, 0xff, 0xe8, 0x04, 0x7c, 0xff, 0xe8,
-    0x04, 0xb7, 0xff, 0xe8, 0x04, 0xc4, 0xff, 0xe8, 0x04, 0xc6, 0xff, 0xe8, 0x00, 0x10, 0x00, 0x2e,
-    0xff, 0xee, 0x00, 0x39, 0xff, 0xee, 0x02, 0xb0, 0xff, 0xee, 0x02, 0xb1, 0xff, 0xee, 0x02, 0xb2,
-    0xff, 0xee, 0x02, 0xb3, 0xff, 0xee, 0x03, 0x00, 0xff, 0xee, 0x03, 0x2f, 0xff, 0xee, 0x03, 0x31,
-    0xff, 0xee, 0x03, 0x33, 0xff, 0xee, 0x03, 0x35, 0xff, 0xee, 0x03, 0x37, 0xff, 0xee, 0x03, 0x39,
-    0xff, 0xee, 0x04, 0x7d, 0xff, 0xee, 0x04, 0x7f, 0xff, 0xee, 0x04, 0xdc, 0xff, 0xee, 0x00, 0x03,
-    0x00, 0x5b, 0xff, 0xe5, 0x01, 0xff, 0xff, 0xeb, 0x02, 0x4b, 0xff, 0xed, 0x00, 0x0f, 0x00, 0x0a,
-    0xff, 0xe2, 0x00, 0x0d, 0x00, 0x14, 0x00, 0x0e, 0xff, 0xcf, 0x00, 0x41, 0x00, 0x12, 0x00, 0x4a,
-    0xff, 0xea, 0x00, 0x56, 0xff, 0xd8, 0x00, 0x58, 0xff, 0xea, 0x00, 0x61, 0x00, 0x13, 0x00, 0x6d,
-    0xff, 0xae, 0x00, 0x7c, 0xff, 0xcd, 0x00, 0x81, 0xff, 0xa0, 0x00, 0x86, 0xff, 0xc1, 0x00, 0x89,
-    0xff, 0xc0, 0x01, 0x8d, 0xff, 0xd3, 0x02, 0x4b, 0xff, 0xcd, 0x00, 0x02, 0x01, 0xf5, 0xff, 0xe9,
-    0x02, 0x4b, 0xff, 0xe9, 0x00, 0x05, 0x00, 0x0d, 0x00, 0x0f, 0x00, 0x41, 0x00, 0x0c, 0x00, 0x56,
-    0xff, 0xeb, 0x00, 0x61, 0x00, 0x0e, 0x02, 0x4b, 0xff, 0xe9, 0x00, 0x04, 0x00, 0x0d, 0x00, 0x14,
-    0x00, 0x41, 0x00, 0x11, 0x00, 0x56, 0xff, 0xe2, 0x00, 0x61, 0x00, 0x13, 0x00, 0x08, 0x00, 0x04,
-    0xff, 0xd8, 0x00, 0x56, 0xff, 0xb5, 0x00, 0x5b, 0xff, 0xc7, 0x00, 0x6d, 0xfe, 0xb8, 0x00, 0x7c,
-    0xff, 0x28, 0x00, 0x81, 0xff, 0x4d, 0x00, 0x86, 0xff, 0x8e, 0x00, 0x89, 0xff, 0xa1, 0x00, 0x10,
-    0x00, 0x38, 0xff, 0xb0, 0x00, 0x3a, 0xff, 0xed, 0x00, 0x3d, 0xff, 0xd0, 0x02, 0xb4, 0xff, 0xd0,
-    0x03, 0x29, 0xff, 0xb0, 0x03, 0x2b, 0xff, 0xb0, 0x03, 0x2d, 0xff, 0xb0, 0x03, 0x3d, 0xff, 0xd0,
-    0x03, 0x3f, 0xff, 0xd0, 0x03, 0xf4, 0xff, 0xd0, 0x04, 0x8b, 0xff, 0xd0, 0x04, 0x8d, 0xff, 0xd0,
-    0x04, 0x8f, 0xff, 0xd0, 0x04, 0xda, 0xff, 0xb0, 0x04, 0xdd, 0xff, 0xed, 0x04, 0xdf, 0xff, 0xed,
-    0x00, 0x22, 0x00, 0x38, 0xff, 0xd5, 0x00, 0x3a, 0xff, 0xe4, 0x00, 0x3b, 0xff, 0xec, 0x00, 0x3d,
-    0xff, 0xdd, 0x02, 0x05, 0x00, 0x0e, 0x02, 0x4d, 0x00, 0x0e, 0x02, 0xb4, 0xff, 0xdd, 0x03, 0x29,
-    0xff, 0xd5, 0x03, 0x2b, 0xff, 0xd5, 0x03, 0x2d, 0xff, 0xd5, 0x03, 0x3b, 0xff, 0xec, 0x03, 0x3d,
-    0xff, 0xdd, 0x03, 0x3f, 0xff, 0xdd, 0x03, 0x4d, 0x00, 0x0e, 0x03, 0x4e, 0x00, 0x0e, 0x03, 0x4f,
-    0x00, 0x0e, 0x03, 0x50, 0x00, 0x0e, 0x03, 0x51, 0x00, 0x0e, 0x03, 0x52, 0x00, 0x0e, 0x03, 0x53,
-    0x00, 0x0e, 0x03, 0x68, 0x00, 0x0e, 0x03, 0x69, 0x00, 0x0e, 0x03, 0x6a, 0x00, 0x0e, 0x03, 0xee,
-    0xff, 0xec, 0x03, 0xf0, 0xff, 0xec, 0x03, 0xf2, 0xff, 0xec, 0x03, 0xf4, 0xff, 0xdd, 0x04, 0x8b,
-    0xff, 0xdd, 0x04, 0x8d, 0xff, 0xdd, 0x04, 0x8f, 0xff, 0xdd, 0x04, 0xda, 0xff, 0xd5, 0x04, 0xdd,
-    0xff, 0xe4, 0x04, 0xdf, 0xff, 0xe4, 0x04, 0xe1, 0xff, 0xec, 0x00, 0x02, 0x00, 0x58, 0x00, 0x0e,
-    0x00, 0x81, 0xff, 0x9f, 0x00, 0x05, 0x00, 0x5b, 0xff, 0xa4, 0x01, 0xf0, 0xff, 0x54, 0x01, 0xf5,
-    0xff, 0xf1, 0x01, 0xff, 0xff, 0xf1, 0x02, 0x4b, 0xff, 0xf3, 0x00, 0x03, 0x00, 0x5b, 0xff, 0xc1,
-    0x01, 0xff, 0xff, 0xe6, 0x02, 0x4b, 0xff, 0xe8, 0x00, 0xa7, 0x00, 0x10, 0xff, 0x16, 0x00, 0x12,
-    0xff, 0x16, 0x00, 0x25, 0xff, 0x56, 0x00, 0x2e, 0xfe, 0xf8, 0x00, 0x38, 0x00, 0x14, 0x00, 0x45,
-    0xff, 0xde, 0x00, 0x47, 0xff, 0xeb, 0x00, 0x48, 0xff, 0xeb, 0x00, 0x49, 0xff, 0xeb, 0x00, 0x4b,
-    0xff, 0xeb, 0x00, 0x53, 0xff, 0xeb, 0x00, 0x55, 0xff, 0xeb, 0x00, 0x56, 0xff, 0xe6, 0x00, 0x59,
-    0xff, 0xea, 0x00, 0x5a, 0xff, 0xe8, 0x00, 0x5d, 0xff, 0xe8, 0x00, 0x94, 0xff, 0xeb, 0x00, 0x99,
-    0xff, 0xeb, 0x00, 0x9b, 0xff, 0xea, 0x00, 0xb2, 0xff, 0x56, 0x01, 0x86, 0xff, 0x16, 0x01, 0x8a,
-    0xff, 0x16, 0x01, 0x8e, 0xff, 0x16, 0x01, 0x8f, 0xff, 0x16, 0x02, 0x05, 0xff, 0xc0, 0x02, 0x4d,
-    0xff, 0xc0, 0x02, 0x9a, 0xff, 0x56, 0x02, 0x9b, 0xff, 0x56, 0x02, 0x9c, 0xff, 0x56, 0x02, 0x9d,
-    0xff, 0x56, 0x02, 0x9e, 0xff, 0x56, 0x02, 0x9f, 0xff, 0x56, 0x02, 0xa0, 0xff, 0x56, 0x02, 0xb5,
-    0xff, 0xde, 0x02, 0xb6, 0xff, 0xde, 0x02, 0xb7, 0xff, 0xde, 0x02, 0xb8, 0xff, 0xde, 0x02, 0xb9,
-    0xff, 0xde, 0x02, 0xba, 0xff, 0xde, 0x02, 0xbb, 0xff, 0xde, 0x02, 0xbc, 0xff, 0xeb, 0x02, 0xbd,
-    0xff, 0xeb, 0x02, 0xbe, 0xff, 0xeb, 0x02, 0xbf, 0xff, 0xeb, 0x02, 0xc0, 0xff, 0xeb, 0x02, 0xc6,
-    0xff, 0xeb, 0x02, 0xc7, 0xff, 0xeb, 0x02, 0xc8, 0xff, 0xeb, 0x02, 0xc9, 0xff, 0xeb, 0x02, 0xca,
-    0xff, 0xeb, 0x02, 0xcb, 0xff, 0xea, 0x02, 0xcc, 0xff, 0xea, 0x02, 0xcd, 0xff, 0xea, 0x02, 0xce,
-    0xff, 0xea, 0x02, 0xcf, 0xff, 0xe8, 0x02, 0xd0, 0xff, 0xe8, 0x02, 0xd1, 0xff, 0x56, 0x02, 0xd2,
-    0xff, 0xde, 0x02, 0xd3, 0xff, 0x56, 0x02, 0xd4, 0xff, 0xde, 0x02, 0xd5, 0xff, 0x56, 0x02, 0xd6,
-    0xff, 0xde, 0x02, 0xd8, 0xff, 0xeb, 0x02, 0xda, 0xff, 0xeb, 0x02, 0xdc, 0xff, 0xeb, 0x02, 0xde,
-    0xff, 0xeb, 0x02, 0xe0, 0xff, 0xeb, 0x02, 0xe2, 0xff, 0xeb, 0x02, 0xe4, 0xff, 0xeb, 0x02, 0xe6,
-    0xff, 0xeb, 0x02, 0xe8, 0xff, 0xeb, 0x02, 0xea, 0xff, 0xeb, 0x02, 0xec, 0xff, 0xeb, 0x02, 0xee,
-    0xff, 0xeb, 0x02, 0xf0, 0xff, 0xeb, 0x02, 0xf2, 0xff, 0xeb, 0x03, 0x00, 0xfe, 0xf8, 0x03, 0x14,
-    0xff, 0xeb, 0x03, 0x16, 0xff, 0xeb, 0x03, 0x18, 0xff, 0xeb, 0x03, 0x29, 0x00, 0x14, 0x03, 0x2b,
-    0x00, 0x14, 0x03, 0x2d, 0x00, 0x14, 0x03, 0x30, 0xff, 0xea, 0x03, 0x32, 0xff, 0xea, 0x03, 0x34,
-    0xff, 0xea, 0x03, 0x36, 0xff, 0xea, 0x03, 0x38, 0xff, 0xea, 0x03, 0x3a, 0xff, 0xea, 0x03, 0x3e,
-    0xff, 0xe8, 0x03, 0x4d, 0xff, 0xc0, 0x03, 0x4e, 0xff, 0xc0, 0x03, 0x4f, 0xff, 0xc0, 0x03, 0x50,
-    0xff, 0xc0, 0x03, 0x51, 0xff, 0xc0, 0x03, 0x52, 0xff, 0xc0, 0x03, 0x53, 0xff, 0xc0, 0x03, 0x68,
-    0xff, 0xc0, 0x03, 0x69, 0xff, 0xc0, 0x03, 0x6a, 0xff, 0xc0, 0x03, 0xf5, 0xff, 0xe8, 0x03, 0xfd,
-    0xff, 0x56, 0x03, 0xfe, 0xff, 0xde, 0x04, 0x39, 0xff, 0x56, 0x04, 0x3a, 0xff, 0xde, 0x04, 0x3b,
-    0xff, 0x56, 0x04, 0x3c, 0xff, 0xde, 0x04, 0x3d, 0xff, 0x56, 0x04, 0x3e, 0xff, 0xde, 0x04, 0x3f,
-    0xff, 0x56, 0x04, 0x40, 0xff, 0xde, 0x04, 0x41, 0xff, 0x56, 0x04, 0x42, 0xff, 0xde, 0x04, 0x43,
-    0xff, 0x56, 0x04, 0x44, 0xff, 0xde, 0x04, 0x45, 0xff, 0x56, 0x04, 0x46, 0xff, 0xde, 0x04, 0x47,
-    0xff, 0x56, 0x04, 0x48, 0xff, 0xde, 0x04, 0x49, 0xff, 0x56, 0x04, 0x4a, 0xff, 0xde, 0x04, 0x4b,
-    0xff, 0x56, 0x04, 0x4c, 0xff, 0xde, 0x04, 0x4d, 0xff, 0x56, 0x04, 0x4e, 0xff, 0xde, 0x04, 0x4f,
-    0xff, 0x56, 0x04, 0x50, 0xff, 0xde, 0x04, 0x52, 0xff, 0xeb, 0x04, 0x54, 0xff, 0xeb, 0x04, 0x56,
-    0xff, 0xeb, 0x04, 0x58, 0xff, 0xeb, 0x04, 0x5a, 0xff, 0xeb, 0x04, 0x5c, 0xff, 0xeb, 0x04, 0x5e,
-    0xff, 0xeb, 0x04, 0x60, 0xff, 0xeb, 0x04, 0x66, 0xff, 0xeb, 0x04, 0x68, 0xff, 0xeb, 0x04, 0x6a,
-    0xff, 0xeb, 0x04, 0x6c, 0xff, 0xeb, 0x04, 0x6e, 0xff, 0xeb, 0x04, 0x70, 0xff, 0xeb, 0x04, 0x72,
-    0xff, 0xeb, 0x04, 0x74, 0xff, 0xeb, 0x04, 0x76, 0xff, 0xeb, 0x04, 0x78, 0xff, 0xeb, 0x04, 0x7a,
-    0xff, 0xeb, 0x04, 0x7c, 0xff, 0xeb, 0x04, 0x7e, 0xff, 0xea, 0x04, 0x80, 0xff, 0xea, 0x04, 0x82,
-    0xff, 0xea, 0x04, 0x84, 0xff, 0xea, 0x04, 0x86, 0xff, 0xea, 0x04, 0x88, 0xff, 0xea, 0x04, 0x8a,
-    0xff, 0xea, 0x04, 0x8c, 0xff, 0xe8, 0x04, 0x8e, 0xff, 0xe8, 0x04, 0x90, 0xff, 0xe8, 0x04, 0xb4,
-    0xff, 0x56, 0x04, 0xb5, 0xff, 0xde, 0x04, 0xb7, 0xff, 0xeb, 0x04, 0xbb, 0xff, 0xeb, 0x04, 0xbf,
-    0xff, 0xea, 0x04, 0xc4, 0xff, 0xeb, 0x04, 0xc6, 0xff, 0xeb, 0x04, 0xda, 0x00, 0x14, 0x04, 0xde,
-    0xff, 0xe8, 0x04, 0xe0, 0xff, 0xe8, 0x00, 0x03, 0x00, 0x4a, 0xff, 0xee, 0x00, 0x5b, 0xff, 0xea,
-    0x01, 0xf0, 0xff, 0xf0, 0x00, 0x01, 0x00, 0x81, 0xff, 0xdf, 0x00, 0x03, 0x00, 0x0d, 0xff, 0xe6,
-    0x00, 0x41, 0xff, 0xf4, 0x00, 0x61, 0xff, 0xef, 0x00, 0x05, 0x00, 0x23, 0xff, 0xc3, 0x00, 0x58,
-    0xff, 0xef, 0x00, 0x5b, 0xff, 0xdf, 0x00, 0x9a, 0xff, 0xee, 0x01, 0xf0, 0xff, 0xcd, 0x00, 0x11,
-    0x00, 0x3a, 0x00, 0x14, 0x00, 0x3b, 0x00, 0x12, 0x00, 0x3d, 0x00, 0x16, 0x02, 0xb4, 0x00, 0x16,
-    0x03, 0x3b, 0x00, 0x12, 0x03, 0x3d, 0x00, 0x16, 0x03, 0x3f, 0x00, 0x16, 0x03, 0xee, 0x00, 0x12,
-    0x03, 0xf0, 0x00, 0x12, 0x03, 0xf2, 0x00, 0x12, 0x03, 0xf4, 0x00, 0x16, 0x04, 0x8b, 0x00, 0x16,
-    0x04, 0x8d, 0x00, 0x16, 0x04, 0x8f, 0x00, 0x16, 0x04, 0xdd, 0x00, 0x14, 0x04, 0xdf, 0x00, 0x14,
-    0x04, 0xe1, 0x00, 0x12, 0x00, 0x01, 0x00, 0x5b, 0x00, 0x0b, 0x00, 0x05, 0x00, 0x38, 0xff, 0xd8,
-    0x03, 0x29, 0xff, 0xd8, 0x03, 0x2b, 0xff, 0xd8, 0x03, 0x2d, 0xff, 0xd8, 0x04, 0xda, 0xff, 0xd8,
-    0x00, 0x02, 0x00, 0x08, 0x00, 0x02, 0x06, 0x6c, 0x00, 0x0a, 0x00, 0x02, 0x03, 0xd0, 0x00, 0x04,
-    0x00, 0x00, 0x05, 0x6e, 0x04, 0x3e, 0x00, 0x18, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xff, 0xc5, 0x00, 0x00, 0xff, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xff, 0xec, 0x00, 0x00, 0x00, 0x00, 0xff, 0xc3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12,
-    0x00, 0x00, 0xff, 0xe4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0xff, 0x9a,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xeb, 0x00, 0x00, 0xff, 0xd5, 0xff, 0xed, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xea, 0xff, 0xe9, 0xff, 0xed, 0xff, 0xf5,
-    0xff, 0xeb, 0x00, 0x00, 0xff, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf5, 0x00, 0x00,
-    0xff, 0xf5, 0xff, 0xa2, 0x00, 0x00, 0xff, 0xc4, 0x00, 0x00, 0xff, 0xce, 0xff, 0xf5, 0xff, 0xf4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x2d,
-    0xff, 0xcc, 0xff, 0xbf, 0xff, 0xd9, 0xff, 0xa2, 0xff, 0xe3, 0x00, 0x12, 0xff, 0xab, 0x00, 0x00,
-    0xff, 0xd8, 0xff, 0xec, 0xff, 0xcb, 0xff, 0xbf, 0x00, 0x0d, 0x00, 0x00, 0xff, 0xab, 0xff, 0xef,
-    0xff, 0xa2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xbf, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf2, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xff, 0xed, 0xff, 0xef, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf0,
-    0x00, 0x00, 0xff, 0xe6, 0x00, 0x00, 0xff, 0xed, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xff, 0x98, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0x95,
-    0x00, 0x00, 0xff, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xea, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xec, 0x00, 0x00, 0x00, 0x00, 0xff, 0x78, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xff, 0xf1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xff, 0xc9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xff, 0xd2, 0xff, 0xe6, 0xff, 0xeb, 0x00, 0x00, 0xff, 0xe7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xff, 0xe1, 0xff, 0xe7, 0xff, 0xeb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x7a, 0xfe, 0x62, 0xff, 0x44, 0xff, 0x4b, 0xff, 0x3e,
-    0xff, 0xbd, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0xff, 0x33, 0xff, 0x72, 0x00, 0x00, 0xff, 0x44,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xff, 0xc0, 0xff, 0xe6, 0xff, 0xe9, 0x00, 0x00, 0xff, 0xe1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xff, 0xe9, 0xff, 0xd8, 0xff, 0xe7, 0xff, 0xe5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xbc, 0x00, 0x00, 0xff, 0xf3, 0x00, 0x00, 0xff, 0x76,
-    0x00, 0x00, 0x00, 0x00, 0xff, 0xc6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0xff, 0xf3,
-    0xff, 0xe1, 0xff, 0xe6, 0xff, 0xc6, 0x00, 0x00, 0xff, 0x76, 0x00, 0x00, 0x00, 0x00, 0xff, 0x26,
-    0xff, 0x18, 0xff, 0x9d, 0xff, 0xa1, 0xff, 0xb1, 0xff, 0xe4, 0x00, 0x10, 0xff, 0xaf, 0x00, 0x00,
-    0xff, 0x93, 0xff, 0xb8, 0xff, 0xb9, 0xff, 0x9d, 0x00, 0x00, 0x00, 0x00, 0xff, 0xaf, 0xff, 0xed,
-    0xff, 0xb1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xeb, 0xff, 0xed, 0x00, 0x0d,
-    0xff, 0xe6, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe5, 0xff, 0xec, 0xff, 0xeb,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xbf,
-    0x00, 0x00, 0x00, 0x00, 0xff, 0xf2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xeb, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xff, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf5, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf5, 0x00, 0x00,
-    0xff, 0xf5, 0xff, 0xa2, 0x00, 0x00, 0xff, 0xc4, 0x00, 0x00, 0xff, 0xce, 0xff, 0xf5, 0xff, 0xf4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x35, 0x00, 0x06,
-    0x00, 0x0b, 0x00, 0x96, 0x00, 0xb1, 0x00, 0xb2, 0x00, 0xb3, 0x00, 0xb4, 0x00, 0xbd, 0x00, 0xc1,
-    0x00, 0xc7, 0x01, 0x84, 0x01, 0x85, 0x01, 0x87, 0x01, 0x88, 0x01, 0x89, 0x02, 0x05, 0x02, 0x06,
-    0x02, 0x07, 0x03, 0xa1, 0x03, 0xa2, 0x03, 0xa3, 0x03, 0xa4, 0x03, 0xa5, 0x03, 0xa6, 0x03, 0xa9,
-    0x03, 0xaa, 0x03, 0xab, 0x03, 0xac, 0x03, 0xad, 0x03, 0xae, 0x03, 0xaf, 0x03, 0xb0, 0x03, 0xb1,
-    0x03, 0xb2, 0x03, 0xb3, 0x03, 0xb4, 0x03, 0xb5, 0x03, 0xb6, 0x03, 0xb7, 0x03, 0xb8, 0x03, 0xbb,
-    0x03, 0xbf, 0x03, 0xc1, 0x03, 0xc5, 0x03, 0xf6, 0x03, 0xf7, 0x03, 0xfa, 0x04, 0xe5, 0x04, 0xe6,
-    0x04, 0xea, 0x04, 0xed, 0x04, 0xf3, 0x04, 0xf8, 0x00, 0x02, 0x00, 0x32, 0x00, 0x06, 0x00, 0x06,
-    0x00, 0x01, 0x00, 0x0b, 0x00, 0x0b, 0x00, 0x01, 0x00, 0x10, 0x00, 0x10, 0x00, 0x02, 0x00, 0x11,
-    0x00, 0x11, 0x00, 0x03, 0x00, 0x12, 0x00, 0x12, 0x00, 0x02, 0x00, 0xb2, 0x00, 0xb2, 0x00, 0x13,
-    0x00, 0xb3, 0x00, 0xb3, 0x00, 0x07, 0x00, 0xb4, 0x00, 0xb4, 0x00, 0x06, 0x00, 0xbb, 0x00, 0xbb,
-    0x00, 0x04, 0x00, 0xbd, 0x00, 0xbd, 0x00, 0x0c, 0x00, 0xc1, 0x00, 0xc1, 0x00, 0x0b, 0x00, 0xc8,
-    0x00, 0xc9, 0x00, 0x04, 0x00, 0xcb, 0x00, 0xcb, 0x00, 0x05, 0x01, 0x81, 0x01, 0x82, 0x00, 0x03,
-    0x01, 0x84, 0x01, 0x85, 0x00, 0x01, 0x01, 0x86, 0x01, 0x86, 0x00, 0x02, 0x01, 0x87, 0x01, 0x89,
-    0x00, 0x01, 0x01, 0x8a, 0x01, 0x8a, 0x00, 0x02, 0x01, 0x8e, 0x01, 0x8f, 0x00, 0x02, 0x02, 0x05,
-    0x02, 0x05, 0x00, 0x11, 0x02, 0x06, 0x02, 0x06, 0x00, 0x0d, 0x02, 0x07, 0x02, 0x07, 0x00, 0x09,
-    0x02, 0x94, 0x02, 0x94, 0x00, 0x03, 0x03, 0xa1, 0x03, 0xa1, 0x00, 0x06, 0x03, 0xa5, 0x03, 0xa5,
-    0x00, 0x07, 0x03, 0xa6, 0x03, 0xa6, 0x00, 0x08, 0x03, 0xa9, 0x03, 0xa9, 0x00, 0x06, 0x03, 0xac,
-    0x03, 0xac, 0x00, 0x10, 0x03, 0xb2, 0x03, 0xb2, 0x00, 0x07, 0x03, 0xb5, 0x03, 0xb5, 0x00, 0x08,
-    0x03, 0xb6, 0x03, 0xb6, 0x00, 0x0f, 0x03, 0xb8, 0x03, 0xb8, 0x00, 0x08, 0x03, 0xb9, 0x03, 0xb9,
-    0x00, 0x04, 0x03, 0xbb, 0x03, 0xbb, 0x00, 0x0b, 0x03, 0xbd, 0x03, 0xbd, 0x00, 0x05, 0x03, 0xbf,
-    0x03, 0xbf, 0x00, 0x0e, 0x03, 0xc1, 0x03, 0xc1, 0x00, 0x0c, 0x03, 0xc4, 0x03, 0xc4, 0x00, 0x05,
-    0x03, 0xc5, 0x03, 0xc5, 0x00, 0x0e, 0x03, 0xc6, 0x03, 0xc6, 0x00, 0x05, 0x03, 0xf6, 0x03, 0xf7,
-    0x00, 0x01, 0x03, 0xfa, 0x03, 0xfa, 0x00, 0x01, 0x04, 0xa7, 0x04, 0xa7, 0x00, 0x03, 0x04, 0xe6,
-    0x04, 0xe6, 0x00, 0x09, 0x04, 0xea, 0x04, 0xea, 0x00, 0x0d, 0x04, 0xeb, 0x04, 0xeb, 0x00, 0x0a,
-    0x04, 0xed, 0x04, 0xed, 0x00, 0x09, 0x04, 0xf9, 0x04, 0xf9, 0x00, 0x0a, 0x04, 0xfa, 0x04, 0xfa,
-    0x00, 0x12, 0x04, 0xfc, 0x04, 0xfc, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x28, 0x00, 0x96, 0x00, 0x96,
-    0x00, 0x16, 0x00, 0xb1, 0x00, 0xb1, 0x00, 0x0d, 0x00, 0xb2, 0x00, 0xb2, 0x00, 0x17, 0x00, 0xb3,
-    0x00, 0xb3, 0x00, 0x02, 0x00, 0xb4, 0x00, 0xb4, 0x00, 0x03, 0x00, 0xbd, 0x00, 0xbd, 0x00, 0x08,
-    0x00, 0xc1, 0x00, 0xc1, 0x00, 0x07, 0x00, 0xc7, 0x00, 0xc7, 0x00, 0x15, 0x02, 0x05, 0x02, 0x05,
-    0x00, 0x12, 0x02, 0x06, 0x02, 0x06, 0x00, 0x09, 0x02, 0x07, 0x02, 0x07, 0x00, 0x05, 0x03, 0xa1,
-    0x03, 0xa1, 0x00, 0x03, 0x03, 0xa2, 0x03, 0xa2, 0x00, 0x06, 0x03, 0xa3, 0x03, 0xa4, 0x00, 0x01,
-    0x03, 0xa5, 0x03, 0xa5, 0x00, 0x02, 0x03, 0xa6, 0x03, 0xa6, 0x00, 0x04, 0x03, 0xa9, 0x03, 0xa9,
-    0x00, 0x03, 0x03, 0xaa, 0x03, 0xaa, 0x00, 0x0b, 0x03, 0xab, 0x03, 0xab, 0x00, 0x06, 0x03, 0xac,
-    0x03, 0xac, 0x00, 0x11, 0x03, 0xad, 0x03, 0xae, 0x00, 0x01, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0x0e,
-    0x03, 0xb0, 0x03, 0xb1, 0x00, 0x01, 0x03, 0xb2, 0x03, 0xb2, 0x00, 0x02, 0x03, 0xb3, 0x03, 0xb3,
-    0x00, 0x0f, 0x03, 0xb4, 0x03, 0xb4, 0x00, 0x10, 0x03, 0xb5, 0x03, 0xb5, 0x00, 0x04, 0x03, 0xb6,
-    0x03, 0xb6, 0x00, 0x0c, 0x03, 0xb7, 0x03, 0xb7, 0x00, 0x01, 0x03, 0xb8, 0x03, 0xb8, 0x00, 0x04,
-    0x03, 0xbb, 0x03, 0xbb, 0x00, 0x07, 0x03, 0xbf, 0x03, 0xbf, 0x00, 0x0a, 0x03, 0xc1, 0x03, 0xc1,
-    0x00, 0x08, 0x03, 0xc5, 0x03, 0xc5, 0x00, 0x0a, 0x04, 0xe5, 0x04, 0xe5, 0x00, 0x02, 0x04, 0xe6,
-    0x04, 0xe6, 0x00, 0x05, 0x04, 0xea, 0x04, 0xea, 0x00, 0x09, 0x04, 0xed, 0x04, 0xed, 0x00, 0x05,
-    0x04, 0xf3, 0x04, 0xf3, 0x00, 0x13, 0x04, 0xf8, 0x04, 0xf8, 0x00, 0x14, 0x00, 0x01, 0x00, 0x5c,
-    0x00, 0x04, 0x00, 0x00, 0x00, 0x29, 0x04, 0xa6, 0x04, 0x98, 0x04, 0x8e, 0x04, 0x5c, 0x04, 0x46,
-    0x04, 0x38, 0x04, 0x22, 0x04, 0x10, 0x03, 0xfa, 0x03, 0xd4, 0x03, 0xa6, 0x03, 0xa0, 0x03, 0x8e,
-    0x03, 0x88, 0x03, 0x26, 0x03, 0x20, 0x02, 0xba, 0x02, 0x68, 0x02, 0x3a, 0x02, 0x34, 0x02, 0x2e,
-    0x01, 0xb0, 0x01, 0xa6, 0x01, 0x8c, 0x04, 0x22, 0x04, 0x38, 0x01, 0x36, 0x04, 0x22, 0x01, 0x2c,
-    0x01, 0x22, 0x04, 0x38, 0x01, 0x14, 0x00, 0xde, 0x01, 0x36, 0x00, 0xbc, 0x01, 0x36, 0x03, 0x20,
-    0x00, 0xb2, 0x03, 0x8e, 0x00, 0xb2, 0x04, 0x38, 0x00, 0x01, 0x00, 0x29, 0x00, 0x0c, 0x00, 0x96,
-    0x00, 0x9d, 0x00, 0xb1, 0x00, 0xb2, 0x00, 0xb3, 0x00, 0xb4, 0x00, 0xb5, 0x00, 0xb7, 0x00, 0xb8,
-    0x00, 0xb9, 0x00, 0xbb, 0x00, 0xbd, 0x00, 0xbe, 0x00, 0xc0, 0x00, 0xc1, 0x00, 0xc3, 0x00, 0xc4,
-    0x00, 0xc5, 0x00, 0xc7, 0x00, 0xc9, 0x00, 0xca, 0x00, 0xce, 0x01, 0x85, 0x03, 0xa1, 0x03, 0xa5,
-    0x03, 0xa6, 0x03, 0xa9, 0x03, 0xac, 0x03, 0xaf, 0x03, 0xb2, 0x03, 0xb3, 0x03, 0xb4, 0x03, 0xb5,
-    0x03, 0xb6, 0x03, 0xb8, 0x03, 0xbb, 0x03, 0xbf, 0x03, 0xc1, 0x03, 0xc5, 0x04, 0xe5, 0x00, 0x02,
-    0x00, 0xca, 0xff, 0xea, 0x01, 0x85, 0xff, 0xb0, 0x00, 0x08, 0x00, 0xb8, 0xff, 0xd4, 0x00, 0xbe,
-    0xff, 0xf0, 0x00, 0xc2, 0xff, 0xed, 0x00, 0xc4, 0x00, 0x11, 0x00, 0xca, 0xff, 0xe0, 0x00, 0xcc,
-    0xff, 0xe7, 0x00, 0xcd, 0xff, 0xe5, 0x00, 0xce, 0xff, 0xee, 0x00, 0x0d, 0x00, 0x04, 0xff, 0xd8,
-    0x00, 0x6d, 0xfe, 0xb8, 0x00, 0x7c, 0xff, 0x28, 0x00, 0xb8, 0xff, 0xae, 0x00, 0xbe, 0xff, 0xc9,
-    0x00, 0xbf, 0xff, 0x7e, 0x00, 0xc3, 0xff, 0x67, 0x00, 0xc6, 0xff, 0x87, 0x00, 0xc7, 0xff, 0x65,
-    0x00, 0xca, 0xff, 0x9e, 0x00, 0xcc, 0xff, 0x6a, 0x00, 0xcd, 0xff, 0x73, 0x00, 0xce, 0xff, 0x5e,
-    0x00, 0x03, 0x00, 0xbe, 0xff, 0xf5, 0x00, 0xc4, 0xff, 0xde, 0x00, 0xc7, 0xff, 0xe5, 0x00, 0x02,
-    0x00, 0xb8, 0xff, 0xc5, 0x00, 0xca, 0xff, 0xb4, 0x00, 0x02, 0x00, 0xb8, 0xff, 0xcb, 0x00, 0xcd,
-    0xff, 0xe4, 0x00, 0x15, 0x00, 0x0a, 0xff, 0xe2, 0x00, 0x0d, 0x00, 0x14, 0x00, 0x0e, 0xff, 0xcf,
-    0x00, 0x41, 0x00, 0x12, 0x00, 0x61, 0x00, 0x13, 0x00, 0x6d, 0xff, 0xae, 0x00, 0x7c, 0xff, 0xcd,
-    0x00, 0xb8, 0xff, 0xd0, 0x00, 0xbc, 0xff, 0xea, 0x00, 0xbe, 0xff, 0xee, 0x00, 0xbf, 0xff, 0xc6,
-    0x00, 0xc0, 0x00, 0x0d, 0x00, 0xc2, 0xff, 0xe9, 0x00, 0xc3, 0xff, 0xd6, 0x00, 0xc6, 0xff, 0xe8,
-    0x00, 0xc7, 0xff, 0xba, 0x00, 0xca, 0xff, 0xe9, 0x00, 0xcc, 0xff, 0xcb, 0x00, 0xcd, 0xff, 0xda,
-    0x00, 0xce, 0xff, 0xc7, 0x01, 0x8d, 0xff, 0xd3, 0x00, 0x06, 0x00, 0xbb, 0xff, 0xc5, 0x00, 0xc8,
-    0xff, 0xc5, 0x00, 0xc9, 0xff, 0xc5, 0x03, 0xb9, 0xff, 0xc5, 0x03, 0xbf, 0xff, 0x80, 0x03, 0xc5,
-    0xff, 0x80, 0x00, 0x02, 0x00, 0xbd, 0xff, 0xf4, 0x03, 0xc1, 0xff, 0xf4, 0x00, 0x1f, 0x00, 0x06,
-    0x00, 0x0c, 0x00, 0x0b, 0x00, 0x0c, 0x00, 0xbb, 0xff, 0xe8, 0x00, 0xbd, 0x00, 0x0b, 0x00, 0xbe,
-    0xff, 0xed, 0x00, 0xc4, 0x00, 0x00, 0x00, 0xc6, 0x00, 0x0b, 0x00, 0xc8, 0xff, 0xe8, 0x00, 0xc9,
-    0xff, 0xe8, 0x00, 0xca, 0x00, 0x0c, 0x01, 0x84, 0x00, 0x0c, 0x01, 0x85, 0x00, 0x0c, 0x01, 0x87,
-    0x00, 0x0c, 0x01, 0x88, 0x00, 0x0c, 0x01, 0x89, 0x00, 0x0c, 0x02, 0x05, 0xff, 0xbf, 0x02, 0x06,
-    0xff, 0xed, 0x02, 0x07, 0xff, 0xbf, 0x03, 0xb9, 0xff, 0xe8, 0x03, 0xbf, 0xff, 0xea, 0x03, 0xc1,
-    0x00, 0x0b, 0x03, 0xc5, 0xff, 0xea, 0x03, 0xf6, 0x00, 0x0c, 0x03, 0xf7, 0x00, 0x0c, 0x03, 0xfa,
-    0x00, 0x0c, 0x04, 0xe6, 0xff, 0xbf, 0x04, 0xea, 0xff, 0xed, 0x04, 0xeb, 0x00, 0x0d, 0x04, 0xed,
-    0xff, 0xbf, 0x04, 0xf9, 0x00, 0x0d, 0x04, 0xfc, 0x00, 0x0d, 0x00, 0x01, 0x00, 0xca, 0x00, 0x0b,
-    0x00, 0x01, 0x00, 0xca, 0xff, 0xea, 0x00, 0x0b, 0x00, 0x10, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00,
-    0x00, 0xbb, 0xff, 0xe7, 0x00, 0xc4, 0x00, 0x0f, 0x00, 0xc8, 0xff, 0xe7, 0x00, 0xc9, 0xff, 0xe7,
-    0x01, 0x86, 0x00, 0x00, 0x01, 0x8a, 0x00, 0x00, 0x01, 0x8e, 0x00, 0x00, 0x01, 0x8f, 0x00, 0x00,
-    0x03, 0xb9, 0xff, 0xe7, 0x00, 0x14, 0x00, 0x06, 0xff, 0xa0, 0x00, 0x0b, 0xff, 0xa0, 0x00, 0xbd,
-    0xff, 0xc5, 0x00, 0xc2, 0xff, 0xee, 0x00, 0xc4, 0x00, 0x10, 0x00, 0xc6, 0xff, 0xec, 0x00, 0xca,
-    0xff, 0x20, 0x00, 0xcb, 0xff, 0xf1, 0x01, 0x84, 0xff, 0xa0, 0x01, 0x85, 0xff, 0xa0, 0x01, 0x87,
-    0xff, 0xa0, 0x01, 0x88, 0xff, 0xa0, 0x01, 0x89, 0xff, 0xa0, 0x03, 0xbd, 0xff, 0xf1, 0x03, 0xc1,
-    0xff, 0xc5, 0x03, 0xc4, 0xff, 0xf1, 0x03, 0xc6, 0xff, 0xf1, 0x03, 0xf6, 0xff, 0xa0, 0x03, 0xf7,
-    0xff, 0xa0, 0x03, 0xfa, 0xff, 0xa0, 0x00, 0x19, 0x00, 0x06, 0xff, 0xda, 0x00, 0x0b, 0xff, 0xda,
-    0x00, 0xbb, 0xff, 0xf0, 0x00, 0xbd, 0xff, 0xdc, 0x00, 0xc2, 0xff, 0xec, 0x00, 0xc4, 0x00, 0x0f,
-    0x00, 0xc6, 0xff, 0xea, 0x00, 0xc8, 0xff, 0xf0, 0x00, 0xc9, 0xff, 0xf0, 0x00, 0xca, 0xff, 0xc4,
-    0x00, 0xcb, 0xff, 0xef, 0x00, 0xcc, 0xff, 0xe7, 0x01, 0x84, 0xff, 0xda, 0x01, 0x85, 0xff, 0xda,
-    0x01, 0x87, 0xff, 0xda, 0x01, 0x88, 0xff, 0xda, 0x01, 0x89, 0xff, 0xda, 0x03, 0xb9, 0xff, 0xf0,
-    0x03, 0xbd, 0xff, 0xef, 0x03, 0xc1, 0xff, 0xdc, 0x03, 0xc4, 0xff, 0xef, 0x03, 0xc6, 0xff, 0xef,
-    0x03, 0xf6, 0xff, 0xda, 0x03, 0xf7, 0xff, 0xda, 0x03, 0xfa, 0xff, 0xda, 0x00, 0x01, 0x01, 0x85,
-    0xff, 0xb0, 0x00, 0x18, 0x00, 0xbb, 0xff, 0xdc, 0x00, 0xbd, 0xff, 0xe1, 0x00, 0xbe, 0xff, 0xee,
-    0x00, 0xbf, 0xff, 0xe6, 0x00, 0xc1, 0xff, 0xf3, 0x00, 0xc2, 0xff, 0xeb, 0x00, 0xc3, 0xff, 0xe9,
-    0x00, 0xc5, 0xff, 0xf0, 0x00, 0xc6, 0xff, 0xe7, 0x00, 0xc8, 0xff, 0xdc, 0x00, 0xc9, 0xff, 0xdc,
-    0x00, 0xca, 0xff, 0xe3, 0x00, 0xcb, 0xff, 0xdd, 0x00, 0xcc, 0xff, 0xce, 0x00, 0xcd, 0xff, 0xd4,
-    0x00, 0xce, 0xff, 0xdb, 0x03, 0xb9, 0xff, 0xdc, 0x03, 0xbb, 0xff, 0xf3, 0x03, 0xbd, 0xff, 0xdd,
-    0x03, 0xbf, 0xff, 0xd6, 0x03, 0xc1, 0xff, 0xe1, 0x03, 0xc4, 0xff, 0xdd, 0x03, 0xc5, 0xff, 0xd6,
-    0x03, 0xc6, 0xff, 0xdd, 0x00, 0x01, 0x00, 0xca, 0xff, 0xed, 0x00, 0x04, 0x00, 0xbe, 0xff, 0xf5,
-    0x00, 0xc6, 0x00, 0x0b, 0x00, 0xc7, 0xff, 0xea, 0x00, 0xca, 0x00, 0x0c, 0x00, 0x01, 0x00, 0xc4,
-    0x00, 0x0e, 0x00, 0x0b, 0x00, 0x10, 0xff, 0x1e, 0x00, 0x12, 0xff, 0x1e, 0x00, 0xb2, 0xff, 0xcd,
-    0x00, 0xb4, 0xff, 0xcd, 0x00, 0xc7, 0xff, 0xf2, 0x01, 0x86, 0xff, 0x1e, 0x01, 0x8a, 0xff, 0x1e,
-    0x01, 0x8e, 0xff, 0x1e, 0x01, 0x8f, 0xff, 0x1e, 0x03, 0xa1, 0xff, 0xcd, 0x03, 0xa9, 0xff, 0xcd,
-    0x00, 0x09, 0x00, 0xb2, 0xff, 0xe4, 0x00, 0xb4, 0xff, 0xe4, 0x00, 0xc4, 0xff, 0xe2, 0x03, 0xa1,
-    0xff, 0xe4, 0x03, 0xa6, 0xff, 0xd3, 0x03, 0xa9, 0xff, 0xe4, 0x03, 0xb5, 0xff, 0xd3, 0x03, 0xb6,
-    0xff, 0xd2, 0x03, 0xb8, 0xff, 0xd3, 0x00, 0x05, 0x00, 0xb3, 0xff, 0xe6, 0x00, 0xb8, 0xff, 0xc2,
-    0x00, 0xc4, 0x00, 0x10, 0x03, 0xa5, 0xff, 0xe6, 0x03, 0xb2, 0xff, 0xe6, 0x00, 0x04, 0x00, 0xb3,
-    0xff, 0xf3, 0x00, 0xc4, 0x00, 0x0d, 0x03, 0xa5, 0xff, 0xf3, 0x03, 0xb2, 0xff, 0xf3, 0x00, 0x05,
-    0x00, 0x23, 0xff, 0xc3, 0x00, 0xb8, 0xff, 0xe5, 0x00, 0xb9, 0xff, 0xd1, 0x00, 0xc4, 0x00, 0x11,
-    0x00, 0xca, 0xff, 0xc8, 0x00, 0x03, 0x00, 0xb5, 0xff, 0xf3, 0x00, 0xb7, 0xff, 0xf0, 0x00, 0xc4,
-    0xff, 0xea, 0x00, 0x05, 0x00, 0x23, 0x00, 0x00, 0x00, 0xb8, 0xff, 0xe5, 0x00, 0xb9, 0xff, 0xd1,
-    0x00, 0xc4, 0x00, 0x11, 0x00, 0xca, 0xff, 0xc8, 0x00, 0x0c, 0x00, 0x6d, 0xfd, 0xbf, 0x00, 0x7c,
-    0xfe, 0x7d, 0x00, 0xb8, 0xff, 0x61, 0x00, 0xbe, 0xff, 0x8f, 0x00, 0xbf, 0xff, 0x0f, 0x00, 0xc3,
-    0xfe, 0xe8, 0x00, 0xc6, 0xff, 0x1f, 0x00, 0xc7, 0xfe, 0xe5, 0x00, 0xca, 0xff, 0x46, 0x00, 0xcc,
-    0xfe, 0xed, 0x00, 0xcd, 0xfe, 0xfd, 0x00, 0xce, 0xfe, 0xd9, 0x00, 0x02, 0x00, 0xbd, 0x00, 0x00,
-    0x03, 0xc1, 0x00, 0x00, 0x00, 0x03, 0x00, 0xb5, 0x00, 0x00, 0x00, 0xb7, 0x00, 0x00, 0x00, 0xc4,
-    0x00, 0x00, 0x00, 0x03, 0x03, 0xa6, 0x00, 0x16, 0x03, 0xb5, 0x00, 0x16, 0x03, 0xb8, 0x00, 0x16,
-    0x00, 0x02, 0x00, 0x08, 0x00, 0x02, 0x0f, 0x6c, 0x00, 0x0a, 0x00, 0x02, 0x08, 0x08, 0x00, 0x04,
-    0x00, 0x00, 0x0c, 0xdc, 0x09, 0x18, 0x00, 0x22, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe3,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0xff, 0xe4, 0x00, 0x11,
-    0x00, 0x00, 0xff, 0xe5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xec, 0xff, 0xc5, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x88, 0x00, 0x00, 0x00, 0x00, 0xff, 0xc3, 0x00, 0x00,
-    0xff, 0xce, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xff, 0xb0, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf3, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xff, 0x95, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xd7, 0xff, 0xf1, 0x00, 0x00, 0xff, 0xf1, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xff, 0xe6, 0xff, 0xe7, 0x00, 0x00, 0xff, 0xe1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xff, 0xe7, 0x00, 0x00, 0xff, 0xd2, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x11, 0xff, 0xeb, 0xff, 0xd1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xec,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xff, 0xec, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe9, 0xff, 0xe6, 0xff, 0xe1, 0x00, 0x00,
-    0xff, 0xd8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe7, 0x00, 0x00, 0xff, 0xc0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe5, 0xff, 0xa3,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf2, 0xff, 0xf3, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xff, 0xeb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x33, 0xff, 0x44,
-    0xff, 0xbd, 0x00, 0x00, 0xff, 0x72, 0x00, 0x00, 0xff, 0x6a, 0xfe, 0x7a, 0x00, 0x00, 0x00, 0x07,
-    0xfe, 0x62, 0x00, 0x00, 0xff, 0x92, 0x00, 0x00, 0x00, 0x00, 0xff, 0x3e, 0x00, 0x00, 0xff, 0x0f,
-    0xff, 0x44, 0xff, 0x0c, 0xff, 0x2c, 0x00, 0x00, 0x00, 0x07, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00,
-    0xff, 0x3e, 0x00, 0x00, 0xff, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xc0,
-    0x00, 0x00, 0xff, 0xf0, 0xff, 0xc9, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xf5, 0x00, 0x00, 0x00, 0x00,
-    0xff, 0xf5, 0xff, 0xeb, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xff, 0xc8, 0xff, 0xad, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xff, 0x9a, 0xff, 0xbd, 0xff, 0xe9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xfe, 0x6d, 0x00, 0x00, 0x00, 0x12, 0xff, 0x89, 0x00, 0x00, 0xff, 0xca, 0x00, 0x00,
-    0x00, 0x00, 0xff, 0xa5, 0x00, 0x00, 0xff, 0xbb, 0xff, 0xbd, 0xff, 0xe9, 0xff, 0x91, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0xff, 0xa5, 0x00, 0x00, 0xff, 0xd2, 0x00, 0x00,
-    0x00, 0x00, 0xff, 0xec, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xff, 0xd8, 0xff, 0xec, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xff, 0xe3, 0xff, 0xf5, 0x00, 0x00, 0xff, 0xf1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf2,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x79,
-    0xff, 0xdd, 0x00, 0x00, 0xff, 0xf5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xd9,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xed, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe6, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xed, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xff, 0xf5, 0xff, 0x88, 0xff, 0xce, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xff, 0xf5, 0xff, 0x7f, 0x00, 0x00, 0xff, 0xc7, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xff, 0xc9, 0x00, 0x12, 0xff, 0xf4, 0xff, 0x8f, 0x00, 0x00, 0xff, 0xc4, 0xff, 0xa9, 0xff, 0xa2,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xff, 0x78, 0xff, 0xf1, 0x00, 0x00, 0xff, 0xeb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xff, 0xea, 0x00, 0x00, 0xff, 0x9a, 0x00, 0x00, 0xff, 0xe5, 0x00, 0x00, 0x00, 0x00,
-    0xff, 0xe1, 0x00, 0x00, 0xff, 0xf5, 0xff, 0xeb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xff, 0xea, 0xff, 0xd5, 0xff, 0xed, 0xff, 0xed, 0xff, 0xeb, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xbd, 0xff, 0xf1, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xff, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x93, 0xff, 0x9d,
-    0xff, 0xe4, 0x00, 0x00, 0xff, 0xb8, 0x00, 0x00, 0xff, 0xb3, 0xff, 0x26, 0xff, 0xb9, 0x00, 0x10,
-    0xff, 0x18, 0xff, 0xf1, 0xff, 0xcb, 0x00, 0x00, 0xff, 0xed, 0xff, 0xb1, 0x00, 0x00, 0xff, 0x7e,
-    0xff, 0x9d, 0xff, 0x7c, 0xff, 0x8f, 0x00, 0x00, 0x00, 0x10, 0x00, 0x10, 0xff, 0xaf, 0xff, 0xaf,
-    0xff, 0xb1, 0xff, 0x10, 0xff, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf5,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xd4, 0xff, 0xf3, 0x00, 0x00, 0xff, 0xf5, 0x00, 0x00,
-    0x00, 0x00, 0xff, 0x1f, 0xff, 0xd9, 0x00, 0x00, 0xff, 0xdb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xff, 0xb5, 0x00, 0x00, 0x00, 0x00, 0xff, 0xd2, 0x00, 0x00, 0xff, 0xd2, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xff, 0xb4, 0xff, 0xb4, 0xff, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xff, 0xd8, 0xff, 0xbf, 0xff, 0xe3, 0x00, 0x00, 0xff, 0xec, 0x00, 0x0d, 0xff, 0xe9, 0xff, 0x2d,
-    0xff, 0xcb, 0x00, 0x11, 0xff, 0xcc, 0xff, 0xf3, 0x00, 0x00, 0x00, 0x00, 0xff, 0xef, 0xff, 0xa2,
-    0x00, 0x00, 0x00, 0x00, 0xff, 0xbf, 0x00, 0x00, 0xff, 0xb7, 0x00, 0x00, 0x00, 0x12, 0x00, 0x12,
-    0xff, 0xab, 0xff, 0xab, 0xff, 0xa2, 0xff, 0xa0, 0xff, 0xc6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf2, 0x00, 0x00,
-    0x00, 0x00, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf2, 0x00, 0x00, 0x00, 0x00, 0xff, 0xc0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xff, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xee, 0x00, 0x00, 0x00, 0x00,
-    0xff, 0xec, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xea,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf5, 0x00, 0x00,
-    0xff, 0xce, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf5, 0xff, 0x7f, 0x00, 0x00, 0xff, 0xc7,
-    0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xc9, 0x00, 0x12, 0xff, 0xf4, 0xff, 0x8f,
-    0x00, 0x00, 0xff, 0xc4, 0xff, 0xa9, 0xff, 0xa2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xff, 0xea, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xff, 0xeb, 0xff, 0xeb, 0xff, 0xea, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xff, 0xe5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf3, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe8, 0xff, 0xc9,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf3,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xe1, 0x00, 0x00, 0xfe, 0xbc, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xff, 0xc9, 0x00, 0x00, 0x00, 0x00, 0xff, 0x76, 0x00, 0x00, 0xff, 0xd9,
-    0xff, 0xf3, 0x00, 0x00, 0xff, 0xf5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xc6, 0xff, 0xc6,
-    0xff, 0x76, 0xff, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x98,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x86, 0x00, 0x06, 0x00, 0x0b, 0x00, 0x96, 0x00, 0xb2, 0x00, 0xd4,
-    0x00, 0xd5, 0x00, 0xd7, 0x00, 0xda, 0x00, 0xdc, 0x00, 0xdd, 0x00, 0xde, 0x00, 0xe0, 0x00, 0xe1,
-    0x00, 0xe2, 0x00, 0xe3, 0x00, 0xe4, 0x00, 0xe5, 0x00, 0xe6, 0x00, 0xec, 0x00, 0xee, 0x00, 0xf7,
-    0x00, 0xfc, 0x00, 0xfe, 0x00, 0xff, 0x01, 0x04, 0x01, 0x05, 0x01, 0x0a, 0x01, 0x0d, 0x01, 0x18,
-    0x01, 0x19, 0x01, 0x1a, 0x01, 0x2e, 0x01, 0x2f, 0x01, 0x30, 0x01, 0x33, 0x01, 0x34, 0x01, 0x35,
-    0x01, 0x37, 0x01, 0x39, 0x01, 0x3b, 0x01, 0x43, 0x01, 0x44, 0x01, 0x54, 0x01, 0x56, 0x01, 0x58,
-    0x01, 0x5c, 0x01, 0x5d, 0x01, 0x5e, 0x01, 0x84, 0x01, 0x85, 0x01, 0x87, 0x01, 0x88, 0x01, 0x89,
-    0x02, 0x05, 0x02, 0x19, 0x02, 0x28, 0x02, 0x29, 0x02, 0x2a, 0x03, 0xc8, 0x03, 0xc9, 0x03, 0xcb,
-    0x03, 0xcc, 0x03, 0xcd, 0x03, 0xce, 0x03, 0xcf, 0x03, 0xd0, 0x03, 0xd1, 0x03, 0xd2, 0x03, 0xd3,
-    0x03, 0xd4, 0x03, 0xd6, 0x03, 0xd7, 0x03, 0xd8, 0x03, 0xda, 0x03, 0xdb, 0x03, 0xdc, 0x03, 0xdd,
-    0x03, 0xde, 0x03, 0xdf, 0x03, 0xe1, 0x03, 0xe2, 0x03, 0xe3, 0x03, 0xe4, 0x03, 0xe5, 0x03, 0xe6,
-    0x03, 0xe7, 0x03, 0xed, 0x03, 0xf6, 0x03, 0xf7, 0x03, 0xfa, 0x03, 0xff, 0x04, 0x01, 0x04, 0x05,
-    0x04, 0x06, 0x04, 0x0b, 0x04, 0x0c, 0x04, 0x0d, 0x04, 0x0e, 0x04, 0x0f, 0x04, 0x10, 0x04, 0x11,
-    0x04, 0x12, 0x04, 0x13, 0x04, 0x14, 0x04, 0x15, 0x04, 0x16, 0x04, 0x19, 0x04, 0x1a, 0x04, 0x1c,
-    0x04, 0x1d, 0x04, 0x1e, 0x04, 0x1f, 0x04, 0x26, 0x04, 0x27, 0x04, 0x2b, 0x04, 0x2d, 0x04, 0x2e,
-    0x04, 0x2f, 0x04, 0x30, 0x04, 0x31, 0x04, 0x32, 0x04, 0x33, 0x04, 0x92, 0x04, 0x96, 0x04, 0x97,
-    0x04, 0x9a, 0x04, 0x9c, 0x04, 0x9d, 0x04, 0x9f, 0x04, 0xa1, 0x05, 0x03, 0x05, 0x05, 0x05, 0x0c,
-    0x05, 0x10, 0x00, 0x02, 0x00, 0xa0, 0x00, 0x06, 0x00, 0x06, 0x00, 0x04, 0x00, 0x0b, 0x00, 0x0b,
-    0x00, 0x04, 0x00, 0x10, 0x00, 0x10, 0x00, 0x08, 0x00, 0x11, 0x00, 0x11, 0x00, 0x0b, 0x00, 0x12,
-    0x00, 0x12, 0x00, 0x08, 0x00, 0xb2, 0x00, 0xb2, 0x00, 0x1b, 0x00, 0xd2, 0x00, 0xd2, 0x00, 0x0a,
-    0x00, 0xd3, 0x00, 0xd3, 0x00, 0x03, 0x00, 0xd4, 0x00, 0xd4, 0x00, 0x0d, 0x00, 0xd6, 0x00, 0xd6,
-    0x00, 0x0a, 0x00, 0xda, 0x00, 0xda, 0x00, 0x06, 0x00, 0xdd, 0x00, 0xdd, 0x00, 0x0d, 0x00, 0xde,
-    0x00, 0xde, 0x00, 0x0e, 0x00, 0xe1, 0x00, 0xe1, 0x00, 0x11, 0x00, 0xec, 0x00, 0xec, 0x00, 0x01,
-    0x00, 0xee, 0x00, 0xee, 0x00, 0x07, 0x00, 0xf0, 0x00, 0xf1, 0x00, 0x01, 0x00, 0xf2, 0x00, 0xf2,
-    0x00, 0x12, 0x00, 0xf3, 0x00, 0xf5, 0x00, 0x01, 0x00, 0xf7, 0x00, 0xf7, 0x00, 0x02, 0x00, 0xf8,
-    0x00, 0xf8, 0x00, 0x01, 0x00, 0xf9, 0x00, 0xf9, 0x00, 0x14, 0x00, 0xfa, 0x00, 0xfb, 0x00, 0x01,
-    0x00, 0xfe, 0x00, 0xfe, 0x00, 0x01, 0x01, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x03, 0x01, 0x03,
-    0x00, 0x02, 0x01, 0x04, 0x01, 0x04, 0x00, 0x12, 0x01, 0x05, 0x01, 0x05, 0x00, 0x01, 0x01, 0x08,
-    0x01, 0x08, 0x00, 0x03, 0x01, 0x0d, 0x01, 0x0d, 0x00, 0x10, 0x01, 0x17, 0x01, 0x17, 0x00, 0x03,
-    0x01, 0x18, 0x01, 0x18, 0x00, 0x13, 0x01, 0x19, 0x01, 0x19, 0x00, 0x17, 0x01, 0x1a, 0x01, 0x1a,
-    0x00, 0x05, 0x01, 0x1b, 0x01, 0x1b, 0x00, 0x03, 0x01, 0x1d, 0x01, 0x1d, 0x00, 0x03, 0x01, 0x1e,
-    0x01, 0x1e, 0x00, 0x02, 0x01, 0x1f, 0x01, 0x1f, 0x00, 0x03, 0x01, 0x21, 0x01, 0x21, 0x00, 0x03,
-    0x01, 0x22, 0x01, 0x22, 0x00, 0x02, 0x01, 0x2b, 0x01, 0x2b, 0x00, 0x01, 0x01, 0x33, 0x01, 0x33,
-    0x00, 0x06, 0x01, 0x34, 0x01, 0x34, 0x00, 0x07, 0x01, 0x36, 0x01, 0x36, 0x00, 0x01, 0x01, 0x39,
-    0x01, 0x39, 0x00, 0x0a, 0x01, 0x3c, 0x01, 0x3c, 0x00, 0x01, 0x01, 0x3e, 0x01, 0x3e, 0x00, 0x01,
-    0x01, 0x41, 0x01, 0x41, 0x00, 0x03, 0x01, 0x42, 0x01, 0x42, 0x00, 0x02, 0x01, 0x43, 0x01, 0x43,
-    0x00, 0x06, 0x01, 0x44, 0x01, 0x44, 0x00, 0x07, 0x01, 0x45, 0x01, 0x45, 0x00, 0x0a, 0x01, 0x47,
-    0x01, 0x47, 0x00, 0x11, 0x01, 0x48, 0x01, 0x48, 0x00, 0x14, 0x01, 0x50, 0x01, 0x50, 0x00, 0x0d,
-    0x01, 0x51, 0x01, 0x51, 0x00, 0x12, 0x01, 0x53, 0x01, 0x53, 0x00, 0x01, 0x01, 0x55, 0x01, 0x55,
-    0x00, 0x01, 0x01, 0x57, 0x01, 0x57, 0x00, 0x01, 0x01, 0x5c, 0x01, 0x5c, 0x00, 0x01, 0x01, 0x5d,
-    0x01, 0x5d, 0x00, 0x06, 0x01, 0x5e, 0x01, 0x5e, 0x00, 0x07, 0x01, 0x60, 0x01, 0x61, 0x00, 0x02,
-    0x01, 0x66, 0x01, 0x66, 0x00, 0x0d, 0x01, 0x6a, 0x01, 0x6a, 0x00, 0x03, 0x01, 0x6b, 0x01, 0x6b,
-    0x00, 0x02, 0x01, 0x6f, 0x01, 0x6f, 0x00, 0x0d, 0x01, 0x70, 0x01, 0x70, 0x00, 0x12, 0x01, 0x81,
-    0x01, 0x82, 0x00, 0x0b, 0x01, 0x84, 0x01, 0x85, 0x00, 0x04, 0x01, 0x86, 0x01, 0x86, 0x00, 0x08,
-    0x01, 0x87, 0x01, 0x89, 0x00, 0x04, 0x01, 0x8a, 0x01, 0x8a, 0x00, 0x08, 0x01, 0x8e, 0x01, 0x8f,
-    0x00, 0x08, 0x02, 0x05, 0x02, 0x05, 0x00, 0x19, 0x02, 0x0e, 0x02, 0x0e, 0x00, 0x0c, 0x02, 0x0f,
-    0x02, 0x0f, 0x00, 0x09, 0x02, 0x12, 0x02, 0x12, 0x00, 0x0c, 0x02, 0x16, 0x02, 0x16, 0x00, 0x0f,
-    0x02, 0x27, 0x02, 0x27, 0x00, 0x0f, 0x02, 0x2a, 0x02, 0x2a, 0x00, 0x0c, 0x02, 0x2b, 0x02, 0x2b,
-    0x00, 0x09, 0x02, 0x2c, 0x02, 0x2c, 0x00, 0x16, 0x02, 0x2d, 0x02, 0x2d, 0x00, 0x0f, 0x02, 0x2e,
-    0x02, 0x2e, 0x00, 0x0c, 0x02, 0x34, 0x02, 0x34, 0x00, 0x09, 0x02, 0x94, 0x02, 0x94, 0x00, 0x0b,
-    0x03, 0xcd, 0x03, 0xcd, 0x00, 0x1c, 0x03, 0xd0, 0x03, 0xd0, 0x00, 0x0e, 0x03, 0xd1, 0x03, 0xd1,
-    0x00, 0x10, 0x03, 0xd8, 0x03, 0xd8, 0x00, 0x03, 0x03, 0xdb, 0x03, 0xdb, 0x00, 0x03, 0x03, 0xdc,
-    0x03, 0xdc, 0x00, 0x0a, 0x03, 0xdd, 0x03, 0xdd, 0x00, 0x06, 0x03, 0xde, 0x03, 0xde, 0x00, 0x15,
-    0x03, 0xdf, 0x03, 0xdf, 0x00, 0x02, 0x03, 0xe0, 0x03, 0xe0, 0x00, 0x01, 0x03, 0xe1, 0x03, 0xe1,
-    0x00, 0x13, 0x03, 0xe2, 0x03, 0xe2, 0x00, 0x01, 0x03, 0xe3, 0x03, 0xe3, 0x00, 0x02, 0x03, 0xe4,
-    0x03, 0xe4, 0x00, 0x05, 0x03, 0xe5, 0x03, 0xe5, 0x00, 0x07, 0x03, 0xe6, 0x03, 0xe6, 0x00, 0x02,
-    0x03, 0xe7, 0x03, 0xe7, 0x00, 0x01, 0x03, 0xe8, 0x03, 0xe8, 0x00, 0x1d, 0x03, 0xec, 0x03, 0xec,
-    0x00, 0x01, 0x03, 0xed, 0x03, 0xed, 0x00, 0x05, 0x03, 0xf6, 0x03, 0xf7, 0x00, 0x04, 0x03, 0xfa,
-    0x03, 0xfa, 0x00, 0x04, 0x04, 0x01, 0x04, 0x01, 0x00, 0x02, 0x04, 0x02, 0x04, 0x02, 0x00, 0x01,
-    0x04, 0x05, 0x04, 0x05, 0x00, 0x17, 0x04, 0x06, 0x04, 0x06, 0x00, 0x05, 0x04, 0x07, 0x04, 0x07,
-    0x00, 0x02, 0x04, 0x08, 0x04, 0x08, 0x00, 0x03, 0x04, 0x0b, 0x04, 0x0b, 0x00, 0x03, 0x04, 0x0c,
-    0x04, 0x0c, 0x00, 0x02, 0x04, 0x0d, 0x04, 0x0d, 0x00, 0x18, 0x04, 0x0e, 0x04, 0x0e, 0x00, 0x05,
-    0x04, 0x10, 0x04, 0x10, 0x00, 0x06, 0x04, 0x11, 0x04, 0x11, 0x00, 0x07, 0x04, 0x13, 0x04, 0x13,
-    0x00, 0x10, 0x04, 0x14, 0x04, 0x14, 0x00, 0x15, 0x04, 0x15, 0x04, 0x15, 0x00, 0x10, 0x04, 0x16,
-    0x04, 0x16, 0x00, 0x15, 0x04, 0x1a, 0x04, 0x1a, 0x00, 0x02, 0x04, 0x1c, 0x04, 0x1d, 0x00, 0x02,
-    0x04, 0x1e, 0x04, 0x1e, 0x00, 0x06, 0x04, 0x1f, 0x04, 0x1f, 0x00, 0x07, 0x04, 0x23, 0x04, 0x23,
-    0x00, 0x01, 0x04, 0x25, 0x04, 0x25, 0x00, 0x01, 0x04, 0x26, 0x04, 0x26, 0x00, 0x03, 0x04, 0x27,
-    0x04, 0x27, 0x00, 0x13, 0x04, 0x28, 0x04, 0x28, 0x00, 0x03, 0x04, 0x29, 0x04, 0x29, 0x00, 0x02,
-    0x04, 0x2a, 0x04, 0x2a, 0x00, 0x03, 0x04, 0x2b, 0x04, 0x2b, 0x00, 0x13, 0x04, 0x2e, 0x04, 0x2e,
-    0x00, 0x0e, 0x04, 0x2f, 0x04, 0x2f, 0x00, 0x05, 0x04, 0x30, 0x04, 0x30, 0x00, 0x0e, 0x04, 0x31,
-    0x04, 0x31, 0x00, 0x05, 0x04, 0x32, 0x04, 0x32, 0x00, 0x0e, 0x04, 0x33, 0x04, 0x33, 0x00, 0x05,
-    0x04, 0x34, 0x04, 0x34, 0x00, 0x11, 0x04, 0x35, 0x04, 0x35, 0x00, 0x14, 0x04, 0x37, 0x04, 0x37,
-    0x00, 0x01, 0x04, 0x38, 0x04, 0x38, 0x00, 0x02, 0x04, 0x92, 0x04, 0x92, 0x00, 0x0a, 0x04, 0x94,
-    0x04, 0x94, 0x00, 0x11, 0x04, 0x95, 0x04, 0x95, 0x00, 0x14, 0x04, 0x97, 0x04, 0x97, 0x00, 0x01,
-    0x04, 0xa1, 0x04, 0xa1, 0x00, 0x18, 0x04, 0xa7, 0x04, 0xa7, 0x00, 0x0b, 0x05, 0x05, 0x05, 0x05,
-    0x00, 0x1a, 0x05, 0x0c, 0x05, 0x0c, 0x00, 0x09, 0x05, 0x0f, 0x05, 0x0f, 0x00, 0x09, 0x05, 0x10,
-    0x05, 0x10, 0x00, 0x0c, 0x05, 0x11, 0x05, 0x11, 0x00, 0x0f, 0x05, 0x14, 0x05, 0x14, 0x00, 0x09,
-    0x05, 0x15, 0x05, 0x15, 0x00, 0x16, 0x00, 0x02, 0x00, 0x6b, 0x00, 0x06, 0x00, 0x06, 0x00, 0x01,
-    0x00, 0x0b, 0x00, 0x0b, 0x00, 0x01, 0x00, 0x96, 0x00, 0x96, 0x00, 0x1c, 0x00, 0xb2, 0x00, 0xb2,
-    0x00, 0x1d, 0x00, 0xd4, 0x00, 0xd5, 0x00, 0x09, 0x00, 0xda, 0x00, 0xda, 0x00, 0x03, 0x00, 0xde,
-    0x00, 0xde, 0x00, 0x0a, 0x00, 0xe4, 0x00, 0xe4, 0x00, 0x09, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0x09,
-    0x00, 0xec, 0x00, 0xec, 0x00, 0x0b, 0x00, 0xee, 0x00, 0xee, 0x00, 0x04, 0x00, 0xf7, 0x00, 0xf7,
-    0x00, 0x0c, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0x0d, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0x0d, 0x00, 0xff,
-    0x00, 0xff, 0x00, 0x0c, 0x01, 0x04, 0x01, 0x05, 0x00, 0x0d, 0x01, 0x0a, 0x01, 0x0a, 0x00, 0x0d,
-    0x01, 0x0d, 0x01, 0x0d, 0x00, 0x0f, 0x01, 0x18, 0x01, 0x18, 0x00, 0x10, 0x01, 0x19, 0x01, 0x19,
-    0x00, 0x16, 0x01, 0x1a, 0x01, 0x1a, 0x00, 0x02, 0x01, 0x2e, 0x01, 0x2e, 0x00, 0x0c, 0x01, 0x2f,
-    0x01, 0x2f, 0x00, 0x08, 0x01, 0x30, 0x01, 0x30, 0x00, 0x0b, 0x01, 0x33, 0x01, 0x33, 0x00, 0x03,
-    0x01, 0x34, 0x01, 0x34, 0x00, 0x04, 0x01, 0x35, 0x01, 0x35, 0x00, 0x05, 0x01, 0x37, 0x01, 0x37,
-    0x00, 0x05, 0x01, 0x39, 0x01, 0x39, 0x00, 0x05, 0x01, 0x43, 0x01, 0x43, 0x00, 0x03, 0x01, 0x44,
-    0x01, 0x44, 0x00, 0x04, 0x01, 0x58, 0x01, 0x58, 0x00, 0x11, 0x01, 0x5c, 0x01, 0x5c, 0x00, 0x0b,
-    0x01, 0x5d, 0x01, 0x5d, 0x00, 0x03, 0x01, 0x5e, 0x01, 0x5e, 0x00, 0x04, 0x01, 0x84, 0x01, 0x85,
-    0x00, 0x01, 0x01, 0x87, 0x01, 0x89, 0x00, 0x01, 0x02, 0x05, 0x02, 0x05, 0x00, 0x18, 0x02, 0x19,
-    0x02, 0x19, 0x00, 0x07, 0x02, 0x28, 0x02, 0x2a, 0x00, 0x07, 0x03, 0xc8, 0x03, 0xc8, 0x00, 0x0e,
-    0x03, 0xc9, 0x03, 0xc9, 0x00, 0x08, 0x03, 0xcd, 0x03, 0xcd, 0x00, 0x1e, 0x03, 0xce, 0x03, 0xcf,
-    0x00, 0x05, 0x03, 0xd0, 0x03, 0xd0, 0x00, 0x0a, 0x03, 0xd1, 0x03, 0xd1, 0x00, 0x0f, 0x03, 0xd2,
-    0x03, 0xd2, 0x00, 0x1f, 0x03, 0xd3, 0x03, 0xd3, 0x00, 0x08, 0x03, 0xd4, 0x03, 0xd4, 0x00, 0x0e,
-    0x03, 0xd8, 0x03, 0xd8, 0x00, 0x11, 0x03, 0xda, 0x03, 0xda, 0x00, 0x20, 0x03, 0xdb, 0x03, 0xdb,
-    0x00, 0x13, 0x03, 0xdc, 0x03, 0xdc, 0x00, 0x14, 0x03, 0xdd, 0x03, 0xdd, 0x00, 0x03, 0x03, 0xde,
-    0x03, 0xde, 0x00, 0x12, 0x03, 0xdf, 0x03, 0xdf, 0x00, 0x06, 0x03, 0xe1, 0x03, 0xe1, 0x00, 0x10,
-    0x03, 0xe2, 0x03, 0xe2, 0x00, 0x0c, 0x03, 0xe3, 0x03, 0xe3, 0x00, 0x15, 0x03, 0xe4, 0x03, 0xe4,
-    0x00, 0x02, 0x03, 0xe5, 0x03, 0xe5, 0x00, 0x04, 0x03, 0xe6, 0x03, 0xe6, 0x00, 0x06, 0x03, 0xe7,
-    0x03, 0xe7, 0x00, 0x0b, 0x03, 0xed, 0x03, 0xed, 0x00, 0x02, 0x03, 0xf6, 0x03, 0xf7, 0x00, 0x01,
-    0x03, 0xfa, 0x03, 0xfa, 0x00, 0x01, 0x03, 0xff, 0x03, 0xff, 0x00, 0x0e, 0x04, 0x01, 0x04, 0x01,
-    0x00, 0x06, 0x04, 0x05, 0x04, 0x05, 0x00, 0x16, 0x04, 0x06, 0x04, 0x06, 0x00, 0x02, 0x04, 0x0b,
-    0x04, 0x0b, 0x00, 0x13, 0x04, 0x0c, 0x04, 0x0c, 0x00, 0x15, 0x04, 0x0d, 0x04, 0x0d, 0x00, 0x17,
-    0x04, 0x0e, 0x04, 0x0e, 0x00, 0x02, 0x04, 0x10, 0x04, 0x10, 0x00, 0x03, 0x04, 0x11, 0x04, 0x11,
-    0x00, 0x04, 0x04, 0x13, 0x04, 0x13, 0x00, 0x0f, 0x04, 0x14, 0x04, 0x14, 0x00, 0x12, 0x04, 0x15,
-    0x04, 0x15, 0x00, 0x0f, 0x04, 0x16, 0x04, 0x16, 0x00, 0x12, 0x04, 0x19, 0x04, 0x19, 0x00, 0x0e,
-    0x04, 0x1a, 0x04, 0x1a, 0x00, 0x06, 0x04, 0x1c, 0x04, 0x1d, 0x00, 0x06, 0x04, 0x1e, 0x04, 0x1e,
-    0x00, 0x03, 0x04, 0x1f, 0x04, 0x1f, 0x00, 0x04, 0x04, 0x26, 0x04, 0x26, 0x00, 0x11, 0x04, 0x27,
-    0x04, 0x27, 0x00, 0x10, 0x04, 0x2b, 0x04, 0x2b, 0x00, 0x10, 0x04, 0x2d, 0x04, 0x2d, 0x00, 0x0c,
-    0x04, 0x2e, 0x04, 0x2e, 0x00, 0x0a, 0x04, 0x2f, 0x04, 0x2f, 0x00, 0x02, 0x04, 0x30, 0x04, 0x30,
-    0x00, 0x0a, 0x04, 0x31, 0x04, 0x31, 0x00, 0x02, 0x04, 0x32, 0x04, 0x32, 0x00, 0x0a, 0x04, 0x33,
-    0x04, 0x33, 0x00, 0x02, 0x04, 0x92, 0x04, 0x92, 0x00, 0x14, 0x04, 0x96, 0x04, 0x96, 0x00, 0x08,
-    0x04, 0x97, 0x04, 0x97, 0x00, 0x0b, 0x04, 0x9a, 0x04, 0x9a, 0x00, 0x21, 0x04, 0x9c, 0x04, 0x9c,
-    0x00, 0x09, 0x04, 0x9d, 0x04, 0x9d, 0x00, 0x08, 0x04, 0x9f, 0x04, 0x9f, 0x00, 0x05, 0x04, 0xa1,
-    0x04, 0xa1, 0x00, 0x17, 0x05, 0x03, 0x05, 0x03, 0x00, 0x07, 0x05, 0x05, 0x05, 0x05, 0x00, 0x19,
-    0x05, 0x0c, 0x05, 0x0c, 0x00, 0x1a, 0x05, 0x10, 0x05, 0x10, 0x00, 0x1b, 0x00, 0x01, 0x01, 0x14,
-    0x00, 0x04, 0x00, 0x00, 0x00, 0x85, 0x15, 0x94, 0x15, 0x82, 0x15, 0x7c, 0x15, 0x76, 0x15, 0x68,
-    0x15, 0x42, 0x15, 0x0c, 0x13, 0x9e, 0x12, 0x88, 0x11, 0x42, 0x10, 0x74, 0x10, 0x52, 0x0f, 0x38,
-    0x0e, 0x4a, 0x0e, 0x18, 0x0d, 0x96, 0x10, 0x52, 0x10, 0x52, 0x0d, 0x4c, 0x10, 0x52, 0x10, 0x52,
-    0x10, 0x52, 0x0c, 0x62, 0x0b, 0xe4, 0x10, 0x52, 0x0b, 0xba, 0x0b, 0x3c, 0x0a, 0xc6, 0x0a, 0xa4,
-    0x09, 0xfa, 0x09, 0x9c, 0x09, 0x92, 0x08, 0xf4, 0x08, 0xee, 0x08, 0xc4, 0x08, 0x4a, 0x07, 0x38,
-    0x07, 0x22, 0x06, 0xe4, 0x06, 0x5a, 0x06, 0x04, 0x05, 0xde, 0x07, 0x22, 0x05, 0x88, 0x05, 0x5e,
-    0x05, 0x0c, 0x04, 0xd6, 0x05, 0xde, 0x04, 0x9c, 0x04, 0x7a, 0x04, 0x6c, 0x04, 0x62, 0x08, 0xc4,
-    0x07, 0x22, 0x03, 0xd8, 0x09, 0x92, 0x0e, 0x18, 0x08, 0xee, 0x03, 0xa2, 0x03, 0xa2, 0x03, 0xa2,
-    0x10, 0x52, 0x0e, 0x18, 0x08, 0xee, 0x10, 0x52, 0x10, 0x52, 0x03, 0x94, 0x09, 0x92, 0x0e, 0x18,
-    0x08, 0xee, 0x03, 0x32, 0x03, 0xd8, 0x10, 0x52, 0x10, 0x52, 0x03, 0xa2, 0x03, 0xa2, 0x0d, 0x4c,
-    0x04, 0x9c, 0x03, 0x28, 0x03, 0xd8, 0x10, 0x52, 0x10, 0x52, 0x03, 0x94, 0x03, 0x1a, 0x03, 0x08,
-    0x02, 0x7a, 0x0e, 0x18, 0x02, 0x58, 0x02, 0x4e, 0x04, 0x7a, 0x07, 0x22, 0x04, 0x62, 0x08, 0xee,
-    0x02, 0x4e, 0x09, 0x92, 0x04, 0x62, 0x02, 0x4e, 0x04, 0x6c, 0x04, 0x62, 0x03, 0x08, 0x02, 0x2c,
-    0x04, 0x62, 0x10, 0x52, 0x0e, 0x18, 0x08, 0xee, 0x10, 0x52, 0x04, 0x9c, 0x02, 0x58, 0x04, 0x9c,
-    0x02, 0x58, 0x02, 0x4e, 0x02, 0x4e, 0x02, 0x4e, 0x0e, 0x18, 0x08, 0xee, 0x03, 0x94, 0x04, 0x7a,
-    0x04, 0x7a, 0x07, 0x22, 0x0d, 0x4c, 0x04, 0x62, 0x0d, 0x4c, 0x04, 0x62, 0x0d, 0x4c, 0x04, 0x62,
-    0x02, 0x7a, 0x03, 0xd8, 0x09, 0x92, 0x02, 0x22, 0x0b, 0xba, 0x03, 0xd8, 0x03, 0xa2, 0x02, 0x2c,
-    0x00, 0x01, 0x00, 0x85, 0x00, 0x04, 0x00, 0x0c, 0x00, 0x3f, 0x00, 0x5f, 0x00, 0x96, 0x00, 0x9d,
-    0x00, 0xb2, 0x00, 0xd2, 0x00, 0xd4, 0x00, 0xd5, 0x00, 0xd6, 0x00, 0xd7, 0x00, 0xd8, 0x00, 0xd9,
-    0x00, 0xda, 0x00, 0xdb, 0x00, 0xdc, 0x00, 0xdd, 0x00, 0xde, 0x00, 0xe0, 0x00, 0xe1, 0x00, 0xe2,
-    0x00, 0xe3, 0x00, 0xe4, 0x00, 0xe5, 0x00, 0xe6, 0x00, 0xe7, 0x00, 0xe8, 0x00, 0xe9, 0x00, 0xea,
-    0x00, 0xeb, 0x00, 0xec, 0x00, 0xed, 0x00, 0xee, 0x00, 0xef, 0x00, 0xf1, 0x00, 0xf6, 0x00, 0xf7,
-    0x00, 0xf8, 0x00, 0xfb, 0x00, 0xfc, 0x00, 0xfe, 0x00, 0xff, 0x01, 0x00, 0x01, 0x03, 0x01, 0x04,
-    0x01, 0x05, 0x01, 0x0a, 0x01, 0x0d, 0x01, 0x18, 0x01, 0x19, 0x01, 0x1a, 0x01, 0x22, 0x01, 0x2e,
-    0x01, 0x2f, 0x01, 0x30, 0x01, 0x33, 0x01, 0x34, 0x01, 0x35, 0x01, 0x37, 0x01, 0x39, 0x01, 0x3b,
-    0x01, 0x43, 0x01, 0x44, 0x01, 0x54, 0x01, 0x56, 0x01, 0x58, 0x01, 0x5c, 0x01, 0x5d, 0x01, 0x5e,
-    0x01, 0x85, 0x03, 0xc9, 0x03, 0xcb, 0x03, 0xcc, 0x03, 0xce, 0x03, 0xcf, 0x03, 0xd0, 0x03, 0xd1,
-    0x03, 0xd2, 0x03, 0xd3, 0x03, 0xd6, 0x03, 0xd7, 0x03, 0xd8, 0x03, 0xda, 0x03, 0xdb, 0x03, 0xdc,
-    0x03, 0xdd, 0x03, 0xde, 0x03, 0xdf, 0x03, 0xe1, 0x03, 0xe2, 0x03, 0xe4, 0x03, 0xe5, 0x03, 0xe6,
-    0x03, 0xe7, 0x03, 0xed, 0x04, 0x01, 0x04, 0x05, 0x04, 0x06, 0x04, 0x0b, 0x04, 0x0d, 0x04, 0x0e,
-    0x04, 0x0f, 0x04, 0x10, 0x04, 0x11, 0x04, 0x12, 0x04, 0x13, 0x04, 0x14, 0x04, 0x15, 0x04, 0x16,
-    0x04, 0x1a, 0x04, 0x1c, 0x04, 0x1d, 0x04, 0x1e, 0x04, 0x1f, 0x04, 0x26, 0x04, 0x27, 0x04, 0x2b,
-    0x04, 0x2d, 0x04, 0x2e, 0x04, 0x2f, 0x04, 0x30, 0x04, 0x31, 0x04, 0x32, 0x04, 0x33, 0x04, 0x92,
-    0x04, 0x96, 0x04, 0x97, 0x04, 0x9a, 0x04, 0x9c, 0x04, 0x9d, 0x04, 0x9f, 0x04, 0xa1, 0x00, 0x02,
-    0x00, 0xf6, 0xff, 0xc0, 0x01, 0x85, 0xff, 0xb0, 0x00, 0x08, 0x00, 0x0a, 0xff, 0xe2, 0x00, 0x0d,
-    0x00, 0x14, 0x00, 0x0e, 0xff, 0xcf, 0x00, 0x41, 0x00, 0x12, 0x00, 0x61, 0x00, 0x13, 0x00, 0x6d,
-    0xff, 0xae, 0x00, 0x7c, 0xff, 0xcd, 0x01, 0x8d, 0xff, 0xd3, 0x00, 0x02, 0x00, 0xf6, 0xff, 0xf5,
-    0x01, 0x85, 0xff, 0xb0, 0x00, 0x08, 0x00, 0xf6, 0xff, 0xf0, 0x00, 0xfe, 0x00, 0x00, 0x01, 0x09,
-    0xff, 0xf1, 0x01, 0x20, 0xff, 0xf3, 0x01, 0x3a, 0xff, 0xf1, 0x01, 0x63, 0xff, 0xf3, 0x01, 0x65,
-    0xff, 0xe9, 0x01, 0x6d, 0xff, 0xd3, 0x00, 0x23, 0x00, 0x04, 0xff, 0xd8, 0x00, 0x6d, 0xfe, 0xb8,
-    0x00, 0x7c, 0xff, 0x28, 0x00, 0xd9, 0xff, 0xa5, 0x00, 0xe6, 0x00, 0x0f, 0x00, 0xea, 0xff, 0xe4,
-    0x00, 0xeb, 0xff, 0xa0, 0x00, 0xed, 0xff, 0x74, 0x00, 0xef, 0xff, 0x80, 0x00, 0xf6, 0xff, 0xb2,
-    0x00, 0xfd, 0xff, 0x7d, 0x00, 0xfe, 0xff, 0x93, 0x00, 0xff, 0xff, 0x80, 0x01, 0x01, 0xff, 0x79,
-    0x01, 0x02, 0x00, 0x00, 0x01, 0x07, 0xff, 0x7d, 0x01, 0x09, 0xff, 0x7f, 0x01, 0x1c, 0xff, 0x98,
-    0x01, 0x20, 0xff, 0xda, 0x01, 0x2e, 0xff, 0x81, 0x01, 0x30, 0xff, 0x98, 0x01, 0x38, 0xff, 0x7d,
-    0x01, 0x3a, 0xff, 0xb3, 0x01, 0x40, 0xff, 0xa0, 0x01, 0x4a, 0xff, 0x7c, 0x01, 0x4c, 0xff, 0x9a,
-    0x01, 0x4d, 0xff, 0x6c, 0x01, 0x58, 0xff, 0xe6, 0x01, 0x5f, 0xff, 0x6b, 0x01, 0x63, 0xff, 0x92,
-    0x01, 0x65, 0xff, 0xad, 0x01, 0x69, 0xff, 0x7b, 0x01, 0x6c, 0x00, 0x0f, 0x01, 0x6d, 0xff, 0x91,
-    0x01, 0x6e, 0xff, 0xf2, 0x00, 0x04, 0x00, 0x0d, 0xff, 0xe6, 0x00, 0x41, 0xff, 0xf4, 0x00, 0x61,
-    0xff, 0xef, 0x01, 0x4d, 0xff, 0xed, 0x00, 0x03, 0x00, 0xd9, 0xff, 0xa8, 0x00, 0xed, 0xff, 0xca,
-    0x01, 0x5f, 0xff, 0xe3, 0x00, 0x02, 0x01, 0x11, 0x00, 0x0b, 0x01, 0x6c, 0xff, 0xe6, 0x00, 0x18,
-    0x00, 0xf7, 0xff, 0xc5, 0x01, 0x03, 0xff, 0xc5, 0x01, 0x18, 0xff, 0x80, 0x01, 0x1e, 0xff, 0xc5,
-    0x01, 0x22, 0xff, 0xc5, 0x01, 0x42, 0xff, 0xc5, 0x01, 0x60, 0xff, 0xc5, 0x01, 0x61, 0xff, 0xc5,
-    0x01, 0x6b, 0xff, 0xc5, 0x03, 0xdf, 0xff, 0xc5, 0x03, 0xe1, 0xff, 0x80, 0x03, 0xe3, 0xff, 0xc5,
-    0x03, 0xe6, 0xff, 0xc5, 0x03, 0xe8, 0xff, 0x90, 0x04, 0x01, 0xff, 0xc5, 0x04, 0x07, 0xff, 0xc5,
-    0x04, 0x0c, 0xff, 0xc5, 0x04, 0x1a, 0xff, 0xc5, 0x04, 0x1c, 0xff, 0xc5, 0x04, 0x1d, 0xff, 0xc5,
-    0x04, 0x27, 0xff, 0x80, 0x04, 0x29, 0xff, 0xc5, 0x04, 0x2b, 0xff, 0x80, 0x04, 0x38, 0xff, 0xc5,
-    0x00, 0x03, 0x00, 0xd9, 0xff, 0xdf, 0x00, 0xe6, 0xff, 0xe0, 0x01, 0x6c, 0xff, 0xe0, 0x00, 0x0d,
-    0x00, 0xea, 0xff, 0xd7, 0x00, 0xf6, 0xff, 0xb9, 0x00, 0xfe, 0xff, 0xe9, 0x01, 0x09, 0xff, 0xb2,
-    0x01, 0x1c, 0xff, 0xd2, 0x01, 0x20, 0xff, 0xc8, 0x01, 0x3a, 0xff, 0xa0, 0x01, 0x4a, 0xff, 0xc5,
-    0x01, 0x58, 0xff, 0xe4, 0x01, 0x63, 0xff, 0xcc, 0x01, 0x65, 0xff, 0xcc, 0x01, 0x6d, 0xff, 0xcb,
-    0x01, 0x6e, 0xff, 0xef, 0x00, 0x22, 0x00, 0x6d, 0xfd, 0xbf, 0x00, 0x7c, 0xfe, 0x7d, 0x00, 0xd9,
-    0xff, 0x52, 0x00, 0xe6, 0x00, 0x05, 0x00, 0xea, 0xff, 0xbd, 0x00, 0xeb, 0xff, 0x49, 0x00, 0xed,
-    0xfe, 0xfe, 0x00, 0xef, 0xff, 0x13, 0x00, 0xf6, 0xff, 0x68, 0x00, 0xfd, 0xff, 0x0e, 0x00, 0xfe,
-    0xff, 0x33, 0x00, 0xff, 0xff, 0x13, 0x01, 0x01, 0xff, 0x07, 0x01, 0x02, 0x00, 0x00, 0x01, 0x07,
-    0xff, 0x0e, 0x01, 0x09, 0xff, 0x11, 0x01, 0x1c, 0xff, 0x3c, 0x01, 0x20, 0xff, 0xac, 0x01, 0x2e,
-    0xff, 0x15, 0x01, 0x30, 0xff, 0x3c, 0x01, 0x38, 0xff, 0x0e, 0x01, 0x3a, 0xff, 0x6a, 0x01, 0x40,
-    0xff, 0x49, 0x01, 0x4a, 0xff, 0x0c, 0x01, 0x4c, 0xff, 0x3f, 0x01, 0x4d, 0xfe, 0xf1, 0x01, 0x58,
-    0xff, 0xc0, 0x01, 0x5f, 0xfe, 0xef, 0x01, 0x63, 0xff, 0x31, 0x01, 0x65, 0xff, 0x5f, 0x01, 0x69,
-    0xff, 0x0a, 0x01, 0x6c, 0x00, 0x05, 0x01, 0x6d, 0xff, 0x30, 0x01, 0x6e, 0xff, 0xd5, 0x00, 0x02,
-    0x00, 0xed, 0xff, 0xc8, 0x01, 0x1c, 0xff, 0xf1, 0x00, 0x03, 0x00, 0x0d, 0x00, 0x14, 0x00, 0x41,
-    0x00, 0x11, 0x00, 0x61, 0x00, 0x13, 0x00, 0x08, 0x00, 0xed, 0xff, 0xb8, 0x00, 0xf6, 0xff, 0xea,
-    0x01, 0x09, 0xff, 0xf0, 0x01, 0x20, 0xff, 0xf1, 0x01, 0x3a, 0xff, 0xeb, 0x01, 0x63, 0xff, 0xf5,
-    0x01, 0x6d, 0xff, 0xec, 0x01, 0x85, 0xff, 0xb0, 0x00, 0x0e, 0x00, 0x23, 0xff, 0xc3, 0x00, 0xd9,
-    0x00, 0x13, 0x00, 0xe6, 0xff, 0xc5, 0x00, 0xf6, 0xff, 0xca, 0x01, 0x3a, 0xff, 0x9f, 0x01, 0x49,
-    0xff, 0x51, 0x01, 0x4a, 0xff, 0x7b, 0x01, 0x4c, 0xff, 0xca, 0x01, 0x4d, 0xff, 0xdd, 0x01, 0x58,
-    0xff, 0xf2, 0x01, 0x62, 0xff, 0x75, 0x01, 0x64, 0xff, 0xca, 0x01, 0x6c, 0xff, 0x4f, 0x01, 0x6d,
-    0xff, 0x8c, 0x00, 0x0d, 0x00, 0xf6, 0xff, 0xba, 0x00, 0xf9, 0xff, 0xd9, 0x00, 0xfe, 0x00, 0x00,
-    0x01, 0x09, 0xff, 0xcf, 0x01, 0x20, 0xff, 0xdb, 0x01, 0x3a, 0xff, 0x50, 0x01, 0x48, 0xff, 0xd9,
-    0x01, 0x4a, 0xff, 0x9d, 0x01, 0x63, 0xff, 0xf0, 0x01, 0x65, 0xff, 0xf2, 0x01, 0x6d, 0xff, 0x4c,
-    0x04, 0x35, 0xff, 0xd9, 0x04, 0x95, 0xff, 0xd9, 0x00, 0x14, 0x00, 0xee, 0xff, 0xf5, 0x00, 0xf6,
-    0xff, 0xba, 0x00, 0xf9, 0xff, 0xd9, 0x00, 0xfe, 0x00, 0x00, 0x01, 0x09, 0xff, 0xcf, 0x01, 0x20,
-    0xff, 0xdb, 0x01, 0x34, 0xff, 0xf5, 0x01, 0x3a, 0xff, 0x50, 0x01, 0x44, 0xff, 0xf5, 0x01, 0x48,
-    0xff, 0xd9, 0x01, 0x4a, 0xff, 0x9d, 0x01, 0x5e, 0xff, 0xf5, 0x01, 0x63, 0xff, 0xf0, 0x01, 0x65,
-    0xff, 0xf2, 0x01, 0x6d, 0xff, 0x4c, 0x03, 0xe5, 0xff, 0xf5, 0x04, 0x11, 0xff, 0xf5, 0x04, 0x1f,
-    0xff, 0xf5, 0x04, 0x35, 0xff, 0xd9, 0x04, 0x95, 0xff, 0xd9, 0x00, 0x0a, 0x00, 0x06, 0xff, 0xd6,
-    0x00, 0x0b, 0xff, 0xd6, 0x01, 0x84, 0xff, 0xd6, 0x01, 0x85, 0xff, 0xd6, 0x01, 0x87, 0xff, 0xd6,
-    0x01, 0x88, 0xff, 0xd6, 0x01, 0x89, 0xff, 0xd6, 0x03, 0xf6, 0xff, 0xd6, 0x03, 0xf7, 0xff, 0xd6,
-    0x03, 0xfa, 0xff, 0xd6, 0x00, 0x15, 0x00, 0xed, 0xff, 0xef, 0x00, 0xee, 0xff, 0xf0, 0x00, 0xf2,
-    0xff, 0xf3, 0x00, 0xfe, 0x00, 0x00, 0x01, 0x04, 0xff, 0xf3, 0x01, 0x1a, 0xff, 0xf4, 0x01, 0x34,
-    0xff, 0xf0, 0x01, 0x44, 0xff, 0xf0, 0x01, 0x51, 0xff, 0xf3, 0x01, 0x5e, 0xff, 0xf0, 0x01, 0x70,
-    0xff, 0xf3, 0x03, 0xe4, 0xff, 0xf4, 0x03, 0xe5, 0xff, 0xf0, 0x03, 0xed, 0xff, 0xf4, 0x04, 0x06,
-    0xff, 0xf4, 0x04, 0x0e, 0xff, 0xf4, 0x04, 0x11, 0xff, 0xf0, 0x04, 0x1f, 0xff, 0xf0, 0x04, 0x2f,
-    0xff, 0xf4, 0x04, 0x31, 0xff, 0xf4, 0x04, 0x33, 0xff, 0xf4, 0x00, 0x09, 0x00, 0xf6, 0xff, 0xba,
-    0x00, 0xfe, 0x00, 0x00, 0x01, 0x09, 0xff, 0xcf, 0x01, 0x20, 0xff, 0xdb, 0x01, 0x3a, 0xff, 0x50,
-    0x01, 0x4a, 0xff, 0x9d, 0x01, 0x63, 0xff, 0xf0, 0x01, 0x65, 0xff, 0xf2, 0x01, 0x6d, 0xff, 0x4c,
-    0x00, 0x15, 0x00, 0xf6, 0xff, 0xba, 0x00, 0xf9, 0xff, 0xd9, 0x00, 0xfe, 0x00, 0x00, 0x01, 0x09,
-    0xff, 0xcf, 0x01, 0x1a, 0xff, 0xdd, 0x01, 0x20, 0xff, 0xdb, 0x01, 0x3a, 0xff, 0x50, 0x01, 0x48,
-    0xff, 0xd9, 0x01, 0x4a, 0xff, 0x9d, 0x01, 0x63, 0xff, 0xf0, 0x01, 0x65, 0xff, 0xf2, 0x01, 0x6d,
-    0xff, 0x4c, 0x03, 0xe4, 0xff, 0xdd, 0x03, 0xed, 0xff, 0xdd, 0x04, 0x06, 0xff, 0xdd, 0x04, 0x0e,
-    0xff, 0xdd, 0x04, 0x2f, 0xff, 0xdd, 0x04, 0x31, 0xff, 0xdd, 0x04, 0x33, 0xff, 0xdd, 0x04, 0x35,
-    0xff, 0xd9, 0x04, 0x95, 0xff, 0xd9, 0x00, 0x22, 0x00, 0xed, 0x00, 0x3a, 0x00, 0xf2, 0x00, 0x18,
-    0x00, 0xf6, 0xff, 0xe3, 0x00, 0xf7, 0x00, 0x0c, 0x00, 0xf9, 0xff, 0xf7, 0x00, 0xfc, 0x00, 0x00,
-    0x00, 0xfe, 0x00, 0x00, 0x01, 0x03, 0x00, 0x0c, 0x01, 0x04, 0x00, 0x18, 0x01, 0x1e, 0x00, 0x0c,
-    0x01, 0x22, 0x00, 0x0c, 0x01, 0x3a, 0xff, 0xe2, 0x01, 0x42, 0x00, 0x0c, 0x01, 0x48, 0xff, 0xf7,
-    0x01, 0x4a, 0xff, 0xe3, 0x01, 0x51, 0x00, 0x18, 0x01, 0x60, 0x00, 0x0c, 0x01, 0x61, 0x00, 0x0c,
-    0x01, 0x6b, 0x00, 0x0c, 0x01, 0x6d, 0xff, 0xe3, 0x01, 0x70, 0x00, 0x18, 0x03, 0xdf, 0x00, 0x0c,
-    0x03, 0xe3, 0x00, 0x0c, 0x03, 0xe6, 0x00, 0x0c, 0x04, 0x01, 0x00, 0x0c, 0x04, 0x07, 0x00, 0x0c,
-    0x04, 0x0c, 0x00, 0x0c, 0x04, 0x1a, 0x00, 0x0c, 0x04, 0x1c, 0x00, 0x0c, 0x04, 0x1d, 0x00, 0x0c,
-    0x04, 0x29, 0x00, 0x0c, 0x04, 0x35, 0xff, 0xf7, 0x04, 0x38, 0x00, 0x0c, 0x04, 0x95, 0xff, 0xf7,
-    0x00, 0x0f, 0x00, 0xed, 0x00, 0x14, 0x00, 0xf2, 0x00, 0x10, 0x00, 0xf6, 0xff, 0xf0, 0x00, 0xf9,
-    0xff, 0xf0, 0x00, 0xfe, 0x00, 0x00, 0x01, 0x01, 0x00, 0x0c, 0x01, 0x04, 0x00, 0x10, 0x01, 0x3a,
-    0xff, 0xf0, 0x01, 0x48, 0xff, 0xf0, 0x01, 0x4a, 0xff, 0xe6, 0x01, 0x51, 0x00, 0x10, 0x01, 0x6d,
-    0xff, 0xf0, 0x01, 0x70, 0x00, 0x10, 0x04, 0x35, 0xff, 0xf0, 0x04, 0x95, 0xff, 0xf0, 0x00, 0x05,
-    0x00, 0xed, 0xff, 0xee, 0x00, 0xf6, 0xff, 0xb0, 0x00, 0xfe, 0x00, 0x00, 0x01, 0x3a, 0xff, 0xec,
-    0x01, 0x6d, 0xff, 0xec, 0x00, 0x44, 0x00, 0x06, 0x00, 0x0d, 0x00, 0x0b, 0x00, 0x0d, 0x00, 0xed,
-    0xff, 0xaa, 0x00, 0xf2, 0xff, 0xaf, 0x00, 0xf7, 0xff, 0xb0, 0x01, 0x03, 0xff, 0xb0, 0x01, 0x04,
-    0xff, 0xaf, 0x01, 0x18, 0xff, 0xd6, 0x01, 0x1a, 0x00, 0x0b, 0x01, 0x1c, 0xff, 0xe2, 0x01, 0x1e,
-    0xff, 0xb0, 0x01, 0x20, 0x00, 0x0c, 0x01, 0x22, 0xff, 0xb0, 0x01, 0x42, 0xff, 0xb0, 0x01, 0x51,
-    0xff, 0xaf, 0x01, 0x60, 0xff, 0xb0, 0x01, 0x61, 0xff, 0xb0, 0x01, 0x63, 0x00, 0x0b, 0x01, 0x65,
-    0x00, 0x0b, 0x01, 0x6b, 0xff, 0xb0, 0x01, 0x70, 0xff, 0xaf, 0x01, 0x84, 0x00, 0x0d, 0x01, 0x85,
-    0x00, 0x0d, 0x01, 0x87, 0x00, 0x0d, 0x01, 0x88, 0x00, 0x0d, 0x01, 0x89, 0x00, 0x0d, 0x02, 0x05,
-    0xff, 0xbf, 0x02, 0x0e, 0x00, 0x0e, 0x02, 0x0f, 0xff, 0xed, 0x02, 0x12, 0x00, 0x0e, 0x02, 0x2a,
-    0x00, 0x0e, 0x02, 0x2b, 0xff, 0xed, 0x02, 0x2c, 0x00, 0x0d, 0x02, 0x2e, 0x00, 0x0e, 0x02, 0x34,
-    0xff, 0xed, 0x03, 0xde, 0xff, 0xf0, 0x03, 0xdf, 0xff, 0xb0, 0x03, 0xe1, 0xff, 0xd6, 0x03, 0xe3,
-    0xff, 0xb0, 0x03, 0xe4, 0x00, 0x0b, 0x03, 0xe6, 0xff, 0xb0, 0x03, 0xed, 0x00, 0x0b, 0x03, 0xf6,
-    0x00, 0x0d, 0x03, 0xf7, 0x00, 0x0d, 0x03, 0xfa, 0x00, 0x0d, 0x04, 0x01, 0xff, 0xb0, 0x04, 0x06,
-    0x00, 0x0b, 0x04, 0x07, 0xff, 0xb0, 0x04, 0x0c, 0xff, 0xb0, 0x04, 0x0e, 0x00, 0x0b, 0x04, 0x14,
-    0xff, 0xf0, 0x04, 0x16, 0xff, 0xf0, 0x04, 0x1a, 0xff, 0xb0, 0x04, 0x1c, 0xff, 0xb0, 0x04, 0x1d,
-    0xff, 0xb0, 0x04, 0x27, 0xff, 0xd6, 0x04, 0x29, 0xff, 0xb0, 0x04, 0x2b, 0xff, 0xd6, 0x04, 0x2f,
-    0x00, 0x0b, 0x04, 0x31, 0x00, 0x0b, 0x04, 0x33, 0x00, 0x0b, 0x04, 0x38, 0xff, 0xb0, 0x05, 0x05,
-    0xff, 0xbf, 0x05, 0x0c, 0xff, 0xed, 0x05, 0x0f, 0xff, 0xed, 0x05, 0x10, 0x00, 0x0e, 0x05, 0x14,
-    0xff, 0xed, 0x05, 0x15, 0x00, 0x0d, 0x00, 0x1e, 0x00, 0xf7, 0xff, 0xf0, 0x01, 0x03, 0xff, 0xf0,
-    0x01, 0x18, 0xff, 0xeb, 0x01, 0x1c, 0xff, 0xeb, 0x01, 0x1e, 0xff, 0xf0, 0x01, 0x22, 0xff, 0xf0,
-    0x01, 0x42, 0xff, 0xf0, 0x01, 0x60, 0xff, 0xf0, 0x01, 0x61, 0xff, 0xf0, 0x01, 0x6b, 0xff, 0xf0,
-    0x02, 0x0f, 0xff, 0xeb, 0x02, 0x2b, 0xff, 0xeb, 0x02, 0x34, 0xff, 0xeb, 0x03, 0xdf, 0xff, 0xf0,
-    0x03, 0xe1, 0xff, 0xeb, 0x03, 0xe3, 0xff, 0xf0, 0x03, 0xe6, 0xff, 0xf0, 0x04, 0x01, 0xff, 0xf0,
-    0x04, 0x07, 0xff, 0xf0, 0x04, 0x0c, 0xff, 0xf0, 0x04, 0x1a, 0xff, 0xf0, 0x04, 0x1c, 0xff, 0xf0,
-    0x04, 0x1d, 0xff, 0xf0, 0x04, 0x27, 0xff, 0xeb, 0x04, 0x29, 0xff, 0xf0, 0x04, 0x2b, 0xff, 0xeb,
-    0x04, 0x38, 0xff, 0xf0, 0x05, 0x0c, 0xff, 0xeb, 0x05, 0x0f, 0xff, 0xeb, 0x05, 0x14, 0xff, 0xeb,
-    0x00, 0x0a, 0x00, 0x06, 0xff, 0xf5, 0x00, 0x0b, 0xff, 0xf5, 0x01, 0x84, 0xff, 0xf5, 0x01, 0x85,
-    0xff, 0xf5, 0x01, 0x87, 0xff, 0xf5, 0x01, 0x88, 0xff, 0xf5, 0x01, 0x89, 0xff, 0xf5, 0x03, 0xf6,
-    0xff, 0xf5, 0x03, 0xf7, 0xff, 0xf5, 0x03, 0xfa, 0xff, 0xf5, 0x00, 0x01, 0x01, 0x1c, 0xff, 0xf1,
-    0x00, 0x27, 0x00, 0xec, 0x00, 0x00, 0x00, 0xed, 0x00, 0x14, 0x00, 0xf0, 0x00, 0x00, 0x00, 0xf1,
-    0x00, 0x00, 0x00, 0xf3, 0x00, 0x00, 0x00, 0xf4, 0x00, 0x00, 0x00, 0xf5, 0x00, 0x00, 0x00, 0xf6,
-    0xff, 0xed, 0x00, 0xf8, 0x00, 0x00, 0x00, 0xf9, 0xff, 0xed, 0x00, 0xfa, 0x00, 0x00, 0x00, 0xfb,
-    0x00, 0x00, 0x00, 0xfc, 0xff, 0xe2, 0x00, 0xfe, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x05,
-    0x00, 0x00, 0x01, 0x2b, 0x00, 0x00, 0x01, 0x36, 0x00, 0x00, 0x01, 0x3a, 0xff, 0xed, 0x01, 0x3c,
-    0x00, 0x00, 0x01, 0x3e, 0x00, 0x00, 0x01, 0x48, 0xff, 0xed, 0x01, 0x4a, 0xff, 0xed, 0x01, 0x53,
-    0x00, 0x00, 0x01, 0x55, 0x00, 0x00, 0x01, 0x57, 0x00, 0x00, 0x01, 0x5c, 0x00, 0x00, 0x01, 0x6d,
-    0xff, 0xed, 0x03, 0xe0, 0x00, 0x00, 0x03, 0xe2, 0x00, 0x00, 0x03, 0xe7, 0x00, 0x00, 0x03, 0xec,
-    0x00, 0x00, 0x04, 0x02, 0x00, 0x00, 0x04, 0x23, 0x00, 0x00, 0x04, 0x25, 0x00, 0x00, 0x04, 0x35,
-    0xff, 0xed, 0x04, 0x37, 0x00, 0x00, 0x04, 0x95, 0xff, 0xed, 0x04, 0x97, 0x00, 0x00, 0x00, 0x02,
-    0x00, 0xed, 0xff, 0xc9, 0x01, 0x1c, 0xff, 0xee, 0x00, 0x17, 0x00, 0x06, 0xff, 0xf2, 0x00, 0x0b,
-    0xff, 0xf2, 0x00, 0xf6, 0xff, 0xf4, 0x00, 0xfe, 0x00, 0x00, 0x01, 0x09, 0xff, 0xf5, 0x01, 0x1a,
-    0xff, 0xf5, 0x01, 0x3a, 0xff, 0xf5, 0x01, 0x6d, 0xff, 0xf5, 0x01, 0x84, 0xff, 0xf2, 0x01, 0x85,
-    0xff, 0xf2, 0x01, 0x87, 0xff, 0xf2, 0x01, 0x88, 0xff, 0xf2, 0x01, 0x89, 0xff, 0xf2, 0x03, 0xe4,
-    0xff, 0xf5, 0x03, 0xed, 0xff, 0xf5, 0x03, 0xf6, 0xff, 0xf2, 0x03, 0xf7, 0xff, 0xf2, 0x03, 0xfa,
-    0xff, 0xf2, 0x04, 0x06, 0xff, 0xf5, 0x04, 0x0e, 0xff, 0xf5, 0x04, 0x2f, 0xff, 0xf5, 0x04, 0x31,
-    0xff, 0xf5, 0x04, 0x33, 0xff, 0xf5, 0x00, 0x2a, 0x00, 0xec, 0xff, 0xef, 0x00, 0xed, 0xff, 0xee,
-    0x00, 0xee, 0xff, 0xf0, 0x00, 0xf0, 0xff, 0xef, 0x00, 0xf1, 0xff, 0xef, 0x00, 0xf3, 0xff, 0xef,
-    0x00, 0xf4, 0xff, 0xef, 0x00, 0xf5, 0xff, 0xef, 0x00, 0xf6, 0xff, 0xee, 0x00, 0xf8, 0xff, 0xef,
-    0x00, 0xfa, 0xff, 0xef, 0x00, 0xfb, 0xff, 0xef, 0x00, 0xfe, 0xff, 0xef, 0x01, 0x00, 0xff, 0xef,
-    0x01, 0x05, 0xff, 0xef, 0x01, 0x09, 0xff, 0xf4, 0x01, 0x20, 0xff, 0xf1, 0x01, 0x2b, 0xff, 0xef,
-    0x01, 0x34, 0xff, 0xf0, 0x01, 0x36, 0xff, 0xef, 0x01, 0x3a, 0xff, 0xef, 0x01, 0x3c, 0xff, 0xef,
-    0x01, 0x3e, 0xff, 0xef, 0x01, 0x44, 0xff, 0xf0, 0x01, 0x53, 0xff, 0xef, 0x01, 0x55, 0xff, 0xef,
-    0x01, 0x57, 0xff, 0xef, 0x01, 0x5c, 0xff, 0xef, 0x01, 0x5e, 0xff, 0xf0, 0x01, 0x6d, 0xff, 0xef,
-    0x03, 0xe0, 0xff, 0xef, 0x03, 0xe2, 0xff, 0xef, 0x03, 0xe5, 0xff, 0xf0, 0x03, 0xe7, 0xff, 0xef,
-    0x03, 0xec, 0xff, 0xef, 0x04, 0x02, 0xff, 0xef, 0x04, 0x11, 0xff, 0xf0, 0x04, 0x1f, 0xff, 0xf0,
-    0x04, 0x23, 0xff, 0xef, 0x04, 0x25, 0xff, 0xef, 0x04, 0x37, 0xff, 0xef, 0x04, 0x97, 0xff, 0xef,
-    0x00, 0x08, 0x00, 0xd2, 0xff, 0xeb, 0x00, 0xd6, 0xff, 0xeb, 0x01, 0x39, 0xff, 0xeb, 0x01, 0x45,
-    0xff, 0xeb, 0x03, 0xdc, 0xff, 0xeb, 0x04, 0x0d, 0xff, 0xf3, 0x04, 0x92, 0xff, 0xeb, 0x04, 0xa1,
-    0xff, 0xf3, 0x00, 0x1d, 0x00, 0xd2, 0xff, 0xe2, 0x00, 0xd4, 0xff, 0xe4, 0x00, 0xd6, 0xff, 0xe2,
-    0x00, 0xd9, 0xff, 0xe1, 0x00, 0xda, 0xff, 0xe4, 0x00, 0xdd, 0xff, 0xe4, 0x00, 0xde, 0xff, 0xe9,
-    0x00, 0xed, 0xff, 0xe4, 0x00, 0xf2, 0xff, 0xeb, 0x01, 0x04, 0xff, 0xeb, 0x01, 0x33, 0xff, 0xe4,
-    0x01, 0x39, 0xff, 0xe2, 0x01, 0x43, 0xff, 0xe4, 0x01, 0x45, 0xff, 0xe2, 0x01, 0x50, 0xff, 0xe4,
-    0x01, 0x51, 0xff, 0xeb, 0x01, 0x5d, 0xff, 0xe4, 0x01, 0x66, 0xff, 0xe4, 0x01, 0x6f, 0xff, 0xe4,
-    0x01, 0x70, 0xff, 0xeb, 0x03, 0xd0, 0xff, 0xe9, 0x03, 0xdc, 0xff, 0xe2, 0x03, 0xdd, 0xff, 0xe4,
-    0x04, 0x10, 0xff, 0xe4, 0x04, 0x1e, 0xff, 0xe4, 0x04, 0x2e, 0xff, 0xe9, 0x04, 0x30, 0xff, 0xe9,
-    0x04, 0x32, 0xff, 0xe9, 0x04, 0x92, 0xff, 0xe2, 0x00, 0x1f, 0x00, 0xd2, 0xff, 0xe3, 0x00, 0xd4,
-    0xff, 0xe5, 0x00, 0xd6, 0xff, 0xe3, 0x00, 0xd9, 0xff, 0xe2, 0x00, 0xda, 0xff, 0xe5, 0x00, 0xdd,
-    0xff, 0xe5, 0x00, 0xde, 0xff, 0xe9, 0x00, 0xf2, 0xff, 0xea, 0x01, 0x04, 0xff, 0xea, 0x01, 0x33,
-    0xff, 0xe5, 0x01, 0x39, 0xff, 0xe3, 0x01, 0x43, 0xff, 0xe5, 0x01, 0x45, 0xff, 0xe3, 0x01, 0x50,
-    0xff, 0xe5, 0x01, 0x51, 0xff, 0xea, 0x01, 0x5d, 0xff, 0xe5, 0x01, 0x66, 0xff, 0xe5, 0x01, 0x6c,
-    0xff, 0xe4, 0x01, 0x6f, 0xff, 0xe5, 0x01, 0x70, 0xff, 0xea, 0x03, 0xd0, 0xff, 0xe9, 0x03, 0xdc,
-    0xff, 0xe3, 0x03, 0xdd, 0xff, 0xe5, 0x04, 0x0d, 0xff, 0xe4, 0x04, 0x10, 0xff, 0xe5, 0x04, 0x1e,
-    0xff, 0xe5, 0x04, 0x2e, 0xff, 0xe9, 0x04, 0x30, 0xff, 0xe9, 0x04, 0x32, 0xff, 0xe9, 0x04, 0x92,
-    0xff, 0xe3, 0x04, 0xa1, 0xff, 0xe4, 0x00, 0x0a, 0x00, 0xe6, 0xff, 0xc3, 0x00, 0xf6, 0xff, 0xcf,
-    0x00, 0xfe, 0x00, 0x00, 0x01, 0x3a, 0xff, 0xce, 0x01, 0x49, 0xff, 0xe7, 0x01, 0x4c, 0xff, 0xdf,
-    0x01, 0x62, 0xff, 0xd1, 0x01, 0x64, 0xff, 0xec, 0x01, 0x6c, 0xff, 0xa0, 0x01, 0x6d, 0xff, 0xd1,
-    0x00, 0x1f, 0x00, 0x06, 0xff, 0xc0, 0x00, 0x0b, 0xff, 0xc0, 0x00, 0xde, 0xff, 0xeb, 0x00, 0xe1,
-    0xff, 0xe7, 0x00, 0xe6, 0xff, 0xc3, 0x00, 0xf6, 0xff, 0xcf, 0x00, 0xfe, 0x00, 0x00, 0x01, 0x19,
-    0xff, 0xc8, 0x01, 0x3a, 0xff, 0xce, 0x01, 0x47, 0xff, 0xe7, 0x01, 0x49, 0xff, 0xe7, 0x01, 0x4c,
-    0xff, 0xdf, 0x01, 0x62, 0xff, 0xd1, 0x01, 0x64, 0xff, 0xec, 0x01, 0x6c, 0xff, 0xa0, 0x01, 0x6d,
-    0xff, 0xd1, 0x01, 0x84, 0xff, 0xc0, 0x01, 0x85, 0xff, 0xc0, 0x01, 0x87, 0xff, 0xc0, 0x01, 0x88,
-    0xff, 0xc0, 0x01, 0x89, 0xff, 0xc0, 0x03, 0xd0, 0xff, 0xeb, 0x03, 0xf6, 0xff, 0xc0, 0x03, 0xf7,
-    0xff, 0xc0, 0x03, 0xfa, 0xff, 0xc0, 0x04, 0x05, 0xff, 0xc8, 0x04, 0x2e, 0xff, 0xeb, 0x04, 0x30,
-    0xff, 0xeb, 0x04, 0x32, 0xff, 0xeb, 0x04, 0x34, 0xff, 0xe7, 0x04, 0x94, 0xff, 0xe7, 0x00, 0x3a,
-    0x00, 0xb2, 0x00, 0x0f, 0x00, 0xd2, 0xff, 0xe6, 0x00, 0xd4, 0x00, 0x0e, 0x00, 0xd6, 0xff, 0xe6,
-    0x00, 0xd9, 0x00, 0x13, 0x00, 0xda, 0x00, 0x0e, 0x00, 0xdd, 0x00, 0x0e, 0x00, 0xde, 0x00, 0x0b,
-    0x00, 0xe1, 0xff, 0xe5, 0x00, 0xe6, 0xff, 0xe6, 0x00, 0xe7, 0xff, 0xf4, 0x00, 0xed, 0x00, 0x12,
-    0x00, 0xf2, 0x00, 0x0f, 0x00, 0xf6, 0xff, 0xe7, 0x00, 0xf9, 0xff, 0xe8, 0x00, 0xfe, 0x00, 0x00,
-    0x01, 0x04, 0x00, 0x0f, 0x01, 0x0d, 0x00, 0x0f, 0x01, 0x19, 0xff, 0xe6, 0x01, 0x33, 0x00, 0x0e,
-    0x01, 0x39, 0xff, 0xe6, 0x01, 0x3a, 0xff, 0xe7, 0x01, 0x43, 0x00, 0x0e, 0x01, 0x45, 0xff, 0xe6,
-    0x01, 0x47, 0xff, 0xe5, 0x01, 0x48, 0xff, 0xe8, 0x01, 0x49, 0xff, 0xe5, 0x01, 0x4a, 0xff, 0xe8,
-    0x01, 0x4c, 0xff, 0xe4, 0x01, 0x50, 0x00, 0x0e, 0x01, 0x51, 0x00, 0x0f, 0x01, 0x5d, 0x00, 0x0e,
-    0x01, 0x62, 0xff, 0xe6, 0x01, 0x64, 0xff, 0xe6, 0x01, 0x66, 0x00, 0x0e, 0x01, 0x6c, 0xff, 0xe6,
-    0x01, 0x6d, 0xff, 0xe7, 0x01, 0x6f, 0x00, 0x0e, 0x01, 0x70, 0x00, 0x0f, 0x03, 0xd0, 0x00, 0x0b,
-    0x03, 0xd1, 0x00, 0x0f, 0x03, 0xdc, 0xff, 0xe6, 0x03, 0xdd, 0x00, 0x0e, 0x04, 0x05, 0xff, 0xe6,
-    0x04, 0x0d, 0xff, 0xe6, 0x04, 0x10, 0x00, 0x0e, 0x04, 0x13, 0x00, 0x0f, 0x04, 0x15, 0x00, 0x0f,
-    0x04, 0x1e, 0x00, 0x0e, 0x04, 0x2e, 0x00, 0x0b, 0x04, 0x30, 0x00, 0x0b, 0x04, 0x32, 0x00, 0x0b,
-    0x04, 0x34, 0xff, 0xe5, 0x04, 0x35, 0xff, 0xe8, 0x04, 0x92, 0xff, 0xe6, 0x04, 0x94, 0xff, 0xe5,
-    0x04, 0x95, 0xff, 0xe8, 0x04, 0xa1, 0xff, 0xe6, 0x00, 0x12, 0x00, 0xd9, 0xff, 0xae, 0x00, 0xe6,
-    0x00, 0x12, 0x00, 0xeb, 0xff, 0xe0, 0x00, 0xed, 0xff, 0xad, 0x00, 0xef, 0xff, 0xd6, 0x00, 0xfd,
-    0xff, 0xdf, 0x01, 0x01, 0xff, 0xd2, 0x01, 0x07, 0xff, 0xe0, 0x01, 0x1c, 0xff, 0xce, 0x01, 0x2e,
-    0xff, 0xdd, 0x01, 0x30, 0xff, 0xe2, 0x01, 0x38, 0xff, 0xe0, 0x01, 0x40, 0xff, 0xe0, 0x01, 0x4a,
-    0xff, 0xe9, 0x01, 0x4d, 0xff, 0xda, 0x01, 0x5f, 0xff, 0xbd, 0x01, 0x69, 0xff, 0xdf, 0x01, 0x6c,
-    0x00, 0x11, 0x00, 0x20, 0x00, 0x1b, 0xff, 0xf2, 0x00, 0xd2, 0xff, 0xf1, 0x00, 0xd4, 0xff, 0xf5,
-    0x00, 0xd6, 0xff, 0xf1, 0x00, 0xda, 0xff, 0xf4, 0x00, 0xdd, 0xff, 0xf5, 0x00, 0xde, 0xff, 0xf3,
-    0x00, 0xe6, 0xff, 0xf1, 0x01, 0x19, 0xff, 0xf4, 0x01, 0x33, 0xff, 0xf4, 0x01, 0x39, 0xff, 0xf1,
-    0x01, 0x43, 0xff, 0xf4, 0x01, 0x45, 0xff, 0xf1, 0x01, 0x50, 0xff, 0xf5, 0x01, 0x5d, 0xff, 0xf4,
-    0x01, 0x62, 0xff, 0xf2, 0x01, 0x64, 0xff, 0xf2, 0x01, 0x66, 0xff, 0xf5, 0x01, 0x6c, 0xff, 0xf2,
-    0x01, 0x6f, 0xff, 0xf5, 0x03, 0xd0, 0xff, 0xf3, 0x03, 0xdc, 0xff, 0xf1, 0x03, 0xdd, 0xff, 0xf4,
-    0x04, 0x05, 0xff, 0xf4, 0x04, 0x0d, 0xff, 0xf0, 0x04, 0x10, 0xff, 0xf4, 0x04, 0x1e, 0xff, 0xf4,
-    0x04, 0x2e, 0xff, 0xf3, 0x04, 0x30, 0xff, 0xf3, 0x04, 0x32, 0xff, 0xf3, 0x04, 0x92, 0xff, 0xf1,
-    0x04, 0xa1, 0xff, 0xf0, 0x00, 0x0c, 0x00, 0xd9, 0x00, 0x12, 0x00, 0xea, 0xff, 0xe9, 0x00, 0xf6,
-    0xff, 0xd7, 0x01, 0x3a, 0xff, 0xd7, 0x01, 0x4a, 0xff, 0xd3, 0x01, 0x4c, 0xff, 0xd6, 0x01, 0x4d,
-    0xff, 0xc5, 0x01, 0x58, 0xff, 0xe7, 0x01, 0x62, 0x00, 0x0d, 0x01, 0x64, 0x00, 0x0c, 0x01, 0x6d,
-    0xff, 0xd6, 0x01, 0x6e, 0xff, 0xf2, 0x00, 0x3b, 0x00, 0xb2, 0x00, 0x10, 0x00, 0xd2, 0xff, 0xe0,
-    0x00, 0xd3, 0xff, 0xe8, 0x00, 0xd4, 0x00, 0x10, 0x00, 0xd6, 0xff, 0xe0, 0x00, 0xd9, 0x00, 0x14,
-    0x00, 0xdd, 0x00, 0x10, 0x00, 0xe1, 0xff, 0xe1, 0x00, 0xe6, 0xff, 0xe0, 0x00, 0xed, 0x00, 0x13,
-    0x00, 0xf2, 0x00, 0x10, 0x00, 0xf9, 0xff, 0xe0, 0x01, 0x04, 0x00, 0x10, 0x01, 0x08, 0xff, 0xe8,
-    0x01, 0x0d, 0x00, 0x10, 0x01, 0x17, 0xff, 0xe8, 0x01, 0x19, 0xff, 0xe0, 0x01, 0x1b, 0xff, 0xe8,
-    0x01, 0x1d, 0xff, 0xe8, 0x01, 0x1f, 0xff, 0xe8, 0x01, 0x21, 0xff, 0xe8, 0x01, 0x39, 0xff, 0xe0,
-    0x01, 0x41, 0xff, 0xe8, 0x01, 0x45, 0xff, 0xe0, 0x01, 0x47, 0xff, 0xe1, 0x01, 0x48, 0xff, 0xe0,
-    0x01, 0x49, 0xff, 0xe1, 0x01, 0x4a, 0xff, 0xe0, 0x01, 0x4d, 0xff, 0xe1, 0x01, 0x50, 0x00, 0x10,
-    0x01, 0x51, 0x00, 0x10, 0x01, 0x58, 0xff, 0xe9, 0x01, 0x62, 0xff, 0xdf, 0x01, 0x64, 0xff, 0xde,
-    0x01, 0x66, 0x00, 0x10, 0x01, 0x6a, 0xff, 0xe8, 0x01, 0x6c, 0xff, 0xdf, 0x01, 0x6e, 0xff, 0xf2,
-    0x01, 0x6f, 0x00, 0x10, 0x01, 0x70, 0x00, 0x10, 0x03, 0xd1, 0x00, 0x10, 0x03, 0xd8, 0xff, 0xe8,
-    0x03, 0xdb, 0xff, 0xe8, 0x03, 0xdc, 0xff, 0xe0, 0x04, 0x05, 0xff, 0xe0, 0x04, 0x08, 0xff, 0xe8,
-    0x04, 0x0b, 0xff, 0xe8, 0x04, 0x0d, 0xff, 0xdf, 0x04, 0x13, 0x00, 0x10, 0x04, 0x15, 0x00, 0x10,
-    0x04, 0x26, 0xff, 0xe8, 0x04, 0x28, 0xff, 0xe8, 0x04, 0x2a, 0xff, 0xe8, 0x04, 0x34, 0xff, 0xe1,
-    0x04, 0x35, 0xff, 0xe0, 0x04, 0x92, 0xff, 0xe0, 0x04, 0x94, 0xff, 0xe1, 0x04, 0x95, 0xff, 0xe0,
-    0x04, 0xa1, 0xff, 0xdf, 0x00, 0x46, 0x00, 0xd2, 0xff, 0xe6, 0x00, 0xd6, 0xff, 0xe6, 0x00, 0xda,
-    0xff, 0xf2, 0x00, 0xde, 0xff, 0xee, 0x00, 0xe1, 0xff, 0xe8, 0x00, 0xe6, 0xff, 0xe6, 0x00, 0xec,
-    0x00, 0x00, 0x00, 0xee, 0xff, 0xf1, 0x00, 0xf0, 0x00, 0x00, 0x00, 0xf1, 0x00, 0x00, 0x00, 0xf3,
-    0x00, 0x00, 0x00, 0xf4, 0x00, 0x00, 0x00, 0xf5, 0x00, 0x00, 0x00, 0xf6, 0xff, 0xd0, 0x00, 0xf8,
-    0x00, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0xfb, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x01, 0x00,
-    0x00, 0x00, 0x01, 0x05, 0x00, 0x00, 0x01, 0x19, 0xff, 0xe7, 0x01, 0x2b, 0x00, 0x00, 0x01, 0x33,
-    0xff, 0xf2, 0x01, 0x34, 0xff, 0xf1, 0x01, 0x36, 0x00, 0x00, 0x01, 0x39, 0xff, 0xe6, 0x01, 0x3a,
-    0xff, 0xce, 0x01, 0x3c, 0x00, 0x00, 0x01, 0x3e, 0x00, 0x00, 0x01, 0x43, 0xff, 0xf2, 0x01, 0x44,
-    0xff, 0xf1, 0x01, 0x45, 0xff, 0xe6, 0x01, 0x47, 0xff, 0xe8, 0x01, 0x49, 0xff, 0xe8, 0x01, 0x53,
-    0x00, 0x00, 0x01, 0x55, 0x00, 0x00, 0x01, 0x57, 0x00, 0x00, 0x01, 0x5c, 0x00, 0x00, 0x01, 0x5d,
-    0xff, 0xf2, 0x01, 0x5e, 0xff, 0xf1, 0x01, 0x62, 0xff, 0xe7, 0x01, 0x64, 0xff, 0xed, 0x01, 0x6c,
-    0xff, 0xe6, 0x01, 0x6d, 0xff, 0xd0, 0x03, 0xd0, 0xff, 0xee, 0x03, 0xdc, 0xff, 0xe6, 0x03, 0xdd,
-    0xff, 0xf2, 0x03, 0xe0, 0x00, 0x00, 0x03, 0xe2, 0x00, 0x00, 0x03, 0xe5, 0xff, 0xf1, 0x03, 0xe7,
-    0x00, 0x00, 0x03, 0xec, 0x00, 0x00, 0x04, 0x02, 0x00, 0x00, 0x04, 0x05, 0xff, 0xe7, 0x04, 0x0d,
-    0xff, 0xe7, 0x04, 0x10, 0xff, 0xf2, 0x04, 0x11, 0xff, 0xf1, 0x04, 0x1e, 0xff, 0xf2, 0x04, 0x1f,
-    0xff, 0xf1, 0x04, 0x23, 0x00, 0x00, 0x04, 0x25, 0x00, 0x00, 0x04, 0x2e, 0xff, 0xee, 0x04, 0x30,
-    0xff, 0xee, 0x04, 0x32, 0xff, 0xee, 0x04, 0x34, 0xff, 0xe8, 0x04, 0x37, 0x00, 0x00, 0x04, 0x92,
-    0xff, 0xe6, 0x04, 0x94, 0xff, 0xe8, 0x04, 0x97, 0x00, 0x00, 0x04, 0xa1, 0xff, 0xe7, 0x00, 0x08,
-    0x00, 0xd9, 0x00, 0x15, 0x00, 0xed, 0x00, 0x15, 0x01, 0x49, 0xff, 0xe4, 0x01, 0x4a, 0xff, 0xe5,
-    0x01, 0x4c, 0xff, 0xe4, 0x01, 0x62, 0xff, 0xe3, 0x01, 0x64, 0xff, 0xe2, 0x01, 0x6c, 0xff, 0xe4,
-    0x00, 0x33, 0x00, 0xd2, 0xff, 0xbe, 0x00, 0xd6, 0xff, 0xbe, 0x00, 0xe6, 0xff, 0xc9, 0x00, 0xec,
-    0x00, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0xf1, 0x00, 0x00, 0x00, 0xf3, 0x00, 0x00, 0x00, 0xf4,
-    0x00, 0x00, 0x00, 0xf5, 0x00, 0x00, 0x00, 0xf6, 0xff, 0xdf, 0x00, 0xf8, 0x00, 0x00, 0x00, 0xfa,
-    0x00, 0x00, 0x00, 0xfb, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x05,
-    0x00, 0x00, 0x01, 0x09, 0xff, 0xed, 0x01, 0x1a, 0xff, 0xef, 0x01, 0x20, 0xff, 0xeb, 0x01, 0x2b,
-    0x00, 0x00, 0x01, 0x36, 0x00, 0x00, 0x01, 0x39, 0xff, 0xbe, 0x01, 0x3a, 0xff, 0xdf, 0x01, 0x3c,
-    0x00, 0x00, 0x01, 0x3e, 0x00, 0x00, 0x01, 0x45, 0xff, 0xbe, 0x01, 0x4c, 0xff, 0xe9, 0x01, 0x53,
-    0x00, 0x00, 0x01, 0x55, 0x00, 0x00, 0x01, 0x57, 0x00, 0x00, 0x01, 0x5c, 0x00, 0x00, 0x01, 0x63,
-    0xff, 0xf5, 0x01, 0x6d, 0xff, 0xe0, 0x03, 0xdc, 0xff, 0xbe, 0x03, 0xe0, 0x00, 0x00, 0x03, 0xe2,
-    0x00, 0x00, 0x03, 0xe4, 0xff, 0xef, 0x03, 0xe7, 0x00, 0x00, 0x03, 0xec, 0x00, 0x00, 0x03, 0xed,
-    0xff, 0xef, 0x04, 0x02, 0x00, 0x00, 0x04, 0x06, 0xff, 0xef, 0x04, 0x0e, 0xff, 0xef, 0x04, 0x23,
-    0x00, 0x00, 0x04, 0x25, 0x00, 0x00, 0x04, 0x2f, 0xff, 0xef, 0x04, 0x31, 0xff, 0xef, 0x04, 0x33,
-    0xff, 0xef, 0x04, 0x37, 0x00, 0x00, 0x04, 0x92, 0xff, 0xbe, 0x04, 0x97, 0x00, 0x00, 0x00, 0x51,
-    0x00, 0x06, 0xff, 0xc0, 0x00, 0x0b, 0xff, 0xc0, 0x00, 0xd2, 0xfe, 0xf5, 0x00, 0xd6, 0xfe, 0xf5,
-    0x00, 0xda, 0xff, 0xf0, 0x00, 0xde, 0xff, 0xeb, 0x00, 0xe1, 0xff, 0xe7, 0x00, 0xe6, 0xff, 0xc3,
-    0x00, 0xec, 0x00, 0x00, 0x00, 0xee, 0xff, 0xc9, 0x00, 0xf0, 0x00, 0x00, 0x00, 0xf1, 0x00, 0x00,
-    0x00, 0xf3, 0x00, 0x00, 0x00, 0xf4, 0x00, 0x00, 0x00, 0xf5, 0x00, 0x00, 0x00, 0xf6, 0xff, 0xcf,
-    0x00, 0xf8, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0xfb, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00,
-    0x01, 0x00, 0x00, 0x00, 0x01, 0x05, 0x00, 0x00, 0x01, 0x19, 0xff, 0xc8, 0x01, 0x2b, 0x00, 0x00,
-    0x01, 0x33, 0xff, 0xf0, 0x01, 0x34, 0xff, 0xc9, 0x01, 0x36, 0x00, 0x00, 0x01, 0x39, 0xfe, 0xf5,
-    0x01, 0x3a, 0xff, 0xce, 0x01, 0x3c, 0x00, 0x00, 0x01, 0x3e, 0x00, 0x00, 0x01, 0x43, 0xff, 0xf0,
-    0x01, 0x44, 0xff, 0xc9, 0x01, 0x45, 0xfe, 0xf5, 0x01, 0x47, 0xff, 0xe7, 0x01, 0x49, 0xff, 0xe7,
-    0x01, 0x4c, 0xff, 0xdf, 0x01, 0x53, 0x00, 0x00, 0x01, 0x55, 0x00, 0x00, 0x01, 0x57, 0x00, 0x00,
-    0x01, 0x5c, 0x00, 0x00, 0x01, 0x5d, 0xff, 0xf0, 0x01, 0x5e, 0xff, 0xc9, 0x01, 0x62, 0xff, 0xd1,
-    0x01, 0x64, 0xff, 0xec, 0x01, 0x6c, 0xff, 0xa0, 0x01, 0x6d, 0xff, 0xd1, 0x01, 0x84, 0xff, 0xc0,
-    0x01, 0x85, 0xff, 0xc0, 0x01, 0x87, 0xff, 0xc0, 0x01, 0x88, 0xff, 0xc0, 0x01, 0x89, 0xff, 0xc0,
-    0x03, 0xd0, 0xff, 0xeb, 0x03, 0xdc, 0xfe, 0xf5, 0x03, 0xdd, 0xff, 0xf0, 0x03, 0xe0, 0x00, 0x00,
-    0x03, 0xe2, 0x00, 0x00, 0x03, 0xe5, 0xff, 0xc9, 0x03, 0xe7, 0x00, 0x00, 0x03, 0xec, 0x00, 0x00,
-    0x03, 0xf6, 0xff, 0xc0, 0x03, 0xf7, 0xff, 0xc0, 0x03, 0xfa, 0xff, 0xc0, 0x04, 0x02, 0x00, 0x00,
-    0x04, 0x05, 0xff, 0xc8, 0x04, 0x0d, 0xff, 0xad, 0x04, 0x10, 0xff, 0xf0, 0x04, 0x11, 0xff, 0xc9,
-    0x04, 0x1e, 0xff, 0xf0, 0x04, 0x1f, 0xff, 0xc9, 0x04, 0x23, 0x00, 0x00, 0x04, 0x25, 0x00, 0x00,
-    0x04, 0x2e, 0xff, 0xeb, 0x04, 0x30, 0xff, 0xeb, 0x04, 0x32, 0xff, 0xeb, 0x04, 0x34, 0xff, 0xe7,
-    0x04, 0x37, 0x00, 0x00, 0x04, 0x92, 0xfe, 0xf5, 0x04, 0x94, 0xff, 0xe7, 0x04, 0x97, 0x00, 0x00,
-    0x04, 0xa1, 0xff, 0xad, 0x00, 0x45, 0x00, 0xd2, 0xfe, 0xf5, 0x00, 0xd4, 0xff, 0xf5, 0x00, 0xd6,
-    0xfe, 0xf5, 0x00, 0xda, 0xff, 0xf0, 0x00, 0xdd, 0xff, 0xf5, 0x00, 0xde, 0xff, 0xeb, 0x00, 0xe1,
-    0xff, 0xe7, 0x00, 0xe6, 0xff, 0xc3, 0x00, 0xec, 0x00, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0xf1,
-    0x00, 0x00, 0x00, 0xf3, 0x00, 0x00, 0x00, 0xf4, 0x00, 0x00, 0x00, 0xf5, 0x00, 0x00, 0x00, 0xf6,
-    0xff, 0xcf, 0x00, 0xf8, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0xfb, 0x00, 0x00, 0x00, 0xfe,
-    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x05, 0x00, 0x00, 0x01, 0x19, 0xff, 0xc8, 0x01, 0x2b,
-    0x00, 0x00, 0x01, 0x33, 0xff, 0xf0, 0x01, 0x36, 0x00, 0x00, 0x01, 0x39, 0xfe, 0xf5, 0x01, 0x3a,
-    0xff, 0xce, 0x01, 0x3c, 0x00, 0x00, 0x01, 0x3e, 0x00, 0x00, 0x01, 0x43, 0xff, 0xf0, 0x01, 0x45,
-    0xfe, 0xf5, 0x01, 0x47, 0xff, 0xe7, 0x01, 0x49, 0xff, 0xe7, 0x01, 0x4c, 0xff, 0xdf, 0x01, 0x50,
-    0xff, 0xf5, 0x01, 0x53, 0x00, 0x00, 0x01, 0x55, 0x00, 0x00, 0x01, 0x57, 0x00, 0x00, 0x01, 0x5c,
-    0x00, 0x00, 0x01, 0x5d, 0xff, 0xf0, 0x01, 0x62, 0xff, 0xd1, 0x01, 0x64, 0xff, 0xec, 0x01, 0x66,
-    0xff, 0xf5, 0x01, 0x6c, 0xff, 0xa0, 0x01, 0x6d, 0xff, 0xd1, 0x01, 0x6f, 0xff, 0xf5, 0x03, 0xd0,
-    0xff, 0xeb, 0x03, 0xdc, 0xfe, 0xf5, 0x03, 0xdd, 0xff, 0xf0, 0x03, 0xe0, 0x00, 0x00, 0x03, 0xe2,
-    0x00, 0x00, 0x03, 0xe7, 0x00, 0x00, 0x03, 0xec, 0x00, 0x00, 0x04, 0x02, 0x00, 0x00, 0x04, 0x05,
-    0xff, 0xc8, 0x04, 0x0d, 0xff, 0xad, 0x04, 0x10, 0xff, 0xf0, 0x04, 0x1e, 0xff, 0xf0, 0x04, 0x23,
-    0x00, 0x00, 0x04, 0x25, 0x00, 0x00, 0x04, 0x2e, 0xff, 0xeb, 0x04, 0x30, 0xff, 0xeb, 0x04, 0x32,
-    0xff, 0xeb, 0x04, 0x34, 0xff, 0xe7, 0x04, 0x37, 0x00, 0x00, 0x04, 0x92, 0xfe, 0xf5, 0x04, 0x94,
-    0xff, 0xe7, 0x04, 0x97, 0x00, 0x00, 0x04, 0xa1, 0xff, 0xad, 0x00, 0x5b, 0x00, 0x06, 0xff, 0xca,
-    0x00, 0x0b, 0xff, 0xca, 0x00, 0xd2, 0xff, 0xd2, 0x00, 0xd6, 0xff, 0xd2, 0x00, 0xda, 0xff, 0xf4,
-    0x00, 0xde, 0xff, 0xed, 0x00, 0xe1, 0xff, 0xe1, 0x00, 0xe6, 0xff, 0xd4, 0x00, 0xec, 0xff, 0xd1,
-    0x00, 0xee, 0xff, 0xef, 0x00, 0xf0, 0xff, 0xd1, 0x00, 0xf1, 0xff, 0xd1, 0x00, 0xf3, 0xff, 0xd1,
-    0x00, 0xf4, 0xff, 0xd1, 0x00, 0xf5, 0xff, 0xd1, 0x00, 0xf6, 0xff, 0xc9, 0x00, 0xf8, 0xff, 0xd1,
-    0x00, 0xfa, 0xff, 0xd1, 0x00, 0xfb, 0xff, 0xd1, 0x00, 0xfe, 0xff, 0xd1, 0x01, 0x00, 0xff, 0xd1,
-    0x01, 0x05, 0xff, 0xd1, 0x01, 0x09, 0xff, 0xe5, 0x01, 0x19, 0xff, 0xd4, 0x01, 0x1a, 0xff, 0xe6,
-    0x01, 0x20, 0xff, 0xe3, 0x01, 0x2b, 0xff, 0xd1, 0x01, 0x33, 0xff, 0xf4, 0x01, 0x34, 0xff, 0xef,
-    0x01, 0x36, 0xff, 0xd1, 0x01, 0x39, 0xff, 0xd2, 0x01, 0x3a, 0xff, 0xc4, 0x01, 0x3c, 0xff, 0xd1,
-    0x01, 0x3e, 0xff, 0xd1, 0x01, 0x43, 0xff, 0xf4, 0x01, 0x44, 0xff, 0xef, 0x01, 0x45, 0xff, 0xd2,
-    0x01, 0x47, 0xff, 0xe1, 0x01, 0x49, 0xff, 0xe1, 0x01, 0x53, 0xff, 0xd1, 0x01, 0x55, 0xff, 0xd1,
-    0x01, 0x57, 0xff, 0xd1, 0x01, 0x5c, 0xff, 0xd1, 0x01, 0x5d, 0xff, 0xf4, 0x01, 0x5e, 0xff, 0xef,
-    0x01, 0x62, 0xff, 0xd4, 0x01, 0x63, 0xff, 0xf5, 0x01, 0x64, 0xff, 0xe7, 0x01, 0x6c, 0xff, 0xd2,
-    0x01, 0x6d, 0xff, 0xc9, 0x01, 0x84, 0xff, 0xca, 0x01, 0x85, 0xff, 0xca, 0x01, 0x87, 0xff, 0xca,
-    0x01, 0x88, 0xff, 0xca, 0x01, 0x89, 0xff, 0xca, 0x03, 0xd0, 0xff, 0xed, 0x03, 0xdc, 0xff, 0xd2,
-    0x03, 0xdd, 0xff, 0xf4, 0x03, 0xe0, 0xff, 0xd1, 0x03, 0xe2, 0xff, 0xd1, 0x03, 0xe4, 0xff, 0xe6,
-    0x03, 0xe5, 0xff, 0xef, 0x03, 0xe7, 0xff, 0xd1, 0x03, 0xec, 0xff, 0xd1, 0x03, 0xed, 0xff, 0xe6,
-    0x03, 0xf6, 0xff, 0xca, 0x03, 0xf7, 0xff, 0xca, 0x03, 0xfa, 0xff, 0xca, 0x04, 0x02, 0xff, 0xd1,
-    0x04, 0x05, 0xff, 0xd4, 0x04, 0x06, 0xff, 0xe6, 0x04, 0x0d, 0xff, 0xd3, 0x04, 0x0e, 0xff, 0xe6,
-    0x04, 0x10, 0xff, 0xf4, 0x04, 0x11, 0xff, 0xef, 0x04, 0x1e, 0xff, 0xf4, 0x04, 0x1f, 0xff, 0xef,
-    0x04, 0x23, 0xff, 0xd1, 0x04, 0x25, 0xff, 0xd1, 0x04, 0x2e, 0xff, 0xed, 0x04, 0x2f, 0xff, 0xe6,
-    0x04, 0x30, 0xff, 0xed, 0x04, 0x31, 0xff, 0xe6, 0x04, 0x32, 0xff, 0xed, 0x04, 0x33, 0xff, 0xe6,
-    0x04, 0x34, 0xff, 0xe1, 0x04, 0x37, 0xff, 0xd1, 0x04, 0x92, 0xff, 0xd2, 0x04, 0x94, 0xff, 0xe1,
-    0x04, 0x97, 0xff, 0xd1, 0x04, 0xa1, 0xff, 0xd3, 0x00, 0x0d, 0x00, 0xd9, 0x00, 0x13, 0x00, 0xe6,
-    0xff, 0xc5, 0x00, 0xf6, 0xff, 0xca, 0x01, 0x3a, 0xff, 0x9f, 0x01, 0x49, 0xff, 0x51, 0x01, 0x4a,
-    0xff, 0x7b, 0x01, 0x4c, 0xff, 0xca, 0x01, 0x4d, 0xff, 0xdd, 0x01, 0x58, 0xff, 0xf2, 0x01, 0x62,
-    0xff, 0x75, 0x01, 0x64, 0xff, 0xca, 0x01, 0x6c, 0xff, 0x4f, 0x01, 0x6d, 0xff, 0x8c, 0x00, 0x09,
-    0x00, 0xf6, 0x00, 0x00, 0x01, 0x1a, 0x00, 0x00, 0x03, 0xe4, 0x00, 0x00, 0x03, 0xed, 0x00, 0x00,
-    0x04, 0x06, 0x00, 0x00, 0x04, 0x0e, 0x00, 0x00, 0x04, 0x2f, 0x00, 0x00, 0x04, 0x31, 0x00, 0x00,
-    0x04, 0x33, 0x00, 0x00, 0x00, 0x03, 0x00, 0xd9, 0x00, 0x00, 0x00, 0xe6, 0x00, 0x00, 0x01, 0x6c,
-    0x00, 0x00, 0x00, 0x01, 0x03, 0xcd, 0xff, 0xec, 0x00, 0x01, 0x03, 0xcd, 0xff, 0xee, 0x00, 0x04,
-    0x01, 0x19, 0x00, 0x14, 0x04, 0x05, 0x00, 0x14, 0x04, 0x0d, 0x00, 0x16, 0x04, 0xa1, 0x00, 0x16,
-    0x00, 0x06, 0x00, 0xd2, 0xff, 0xd8, 0x00, 0xd6, 0xff, 0xd8, 0x01, 0x39, 0xff, 0xd8, 0x01, 0x45,
-    0xff, 0xd8, 0x03, 0xdc, 0xff, 0xd8, 0x04, 0x92, 0xff, 0xd8, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x08, 0x00, 0x01, 0x00, 0x0a, 0x00, 0x05, 0x00, 0x24, 0x00, 0x48, 0x00, 0x01, 0x00, 0xfa,
-    0x00, 0x08, 0x00, 0x0a, 0x00, 0x14, 0x00, 0x15, 0x00, 0x16, 0x00, 0x17, 0x00, 0x18, 0x00, 0x19,
-    0x00, 0x1a, 0x00, 0x1b, 0x00, 0x1c, 0x00, 0x1d, 0x00, 0x25, 0x00, 0x26, 0x00, 0x27, 0x00, 0x28,
-    0x00, 0x29, 0x00, 0x2a, 0x00, 0x2b, 0x00, 0x2c, 0x00, 0x2d, 0x00, 0x2e, 0x00, 0x2f, 0x00, 0x30,
-    0x00, 0x31, 0x00, 0x32, 0x00, 0x33, 0x00, 0x34, 0x00, 0x35, 0x00, 0x36, 0x00, 0x37, 0x00, 0x38,
-    0x00, 0x39, 0x00, 0x3a, 0x00, 0x3b, 0x00, 0x3c, 0x00, 0x3d, 0x00, 0x3e, 0x00, 0x65, 0x00, 0x67,
-    0x00, 0x81, 0x00, 0x83, 0x00, 0x84, 0x00, 0x8c, 0x00, 0x8f, 0x00, 0x91, 0x00, 0x93, 0x00, 0xb1,
-    0x00, 0xb2, 0x00, 0xb3, 0x00, 0xb4, 0x00, 0xb5, 0x00, 0xb6, 0x00, 0xb7, 0x00, 0xb8, 0x00, 0xb9,
-    0x00, 0xba, 0x00, 0xd2, 0x00, 0xd3, 0x00, 0xd4, 0x00, 0xd5, 0x00, 0xd6, 0x00, 0xd7, 0x00, 0xd8,
-    0x00, 0xd9, 0x00, 0xda, 0x00, 0xdb, 0x00, 0xdc, 0x00, 0xdd, 0x00, 0xde, 0x00, 0xdf, 0x00, 0xe0,
-    0x00, 0xe1, 0x00, 0xe2, 0x00, 0xe3, 0x00, 0xe4, 0x00, 0xe5, 0x00, 0xe6, 0x00, 0xe7, 0x00, 0xe8,
-    0x00, 0xe9, 0x01, 0x2f, 0x01, 0x33, 0x01, 0x35, 0x01, 0x37, 0x01, 0x39, 0x01, 0x3b, 0x01, 0x41,
-    0x01, 0x43, 0x01, 0x45, 0x01, 0x49, 0x01, 0x4b, 0x01, 0x4c, 0x01, 0x58, 0x01, 0x59, 0x01, 0xb1,
-    0x01, 0xb7, 0x01, 0xbc, 0x01, 0xbf, 0x02, 0x95, 0x02, 0x96, 0x02, 0x98, 0x02, 0x9a, 0x02, 0x9b,
-    0x02, 0x9c, 0x02, 0x9d, 0x02, 0x9e, 0x02, 0x9f, 0x02, 0xa0, 0x02, 0xa1, 0x02, 0xa2, 0x02, 0xa3,
-    0x02, 0xa4, 0x02, 0xa5, 0x02, 0xa6, 0x02, 0xa7, 0x02, 0xa8, 0x02, 0xa9, 0x02, 0xaa, 0x02, 0xab,
-    0x02, 0xac, 0x02, 0xad, 0x02, 0xae, 0x02, 0xaf, 0x02, 0xb0, 0x02, 0xb1, 0x02, 0xb2, 0x02, 0xb3,
-    0x02, 0xb4, 0x02, 0xd1, 0x02, 0xd3, 0x02, 0xd5, 0x02, 0xd7, 0x02, 0xd9, 0x02, 0xdb, 0x02, 0xdd,
-    0x02, 0xdf, 0x02, 0xe1, 0x02, 0xe3, 0x02, 0xe5, 0x02, 0xe7, 0x02, 0xe9, 0x02, 0xeb, 0x02, 0xed,
-    0x02, 0xef, 0x02, 0xf1, 0x02, 0xf3, 0x02, 0xf5, 0x02, 0xf7, 0x02, 0xf9, 0x02, 0xfb, 0x02, 0xfd,
-    0x02, 0xfe, 0x03, 0x00, 0x03, 0x02, 0x03, 0x04, 0x03, 0x06, 0x03, 0x08, 0x03, 0x0a, 0x03, 0x0c,
-    0x03, 0x0e, 0x03, 0x10, 0x03, 0x13, 0x03, 0x15, 0x03, 0x17, 0x03, 0x19, 0x03, 0x1b, 0x03, 0x1d,
-    0x03, 0x1f, 0x03, 0x21, 0x03, 0x23, 0x03, 0x25, 0x03, 0x27, 0x03, 0x29, 0x03, 0x2b, 0x03, 0x2d,
-    0x03, 0x2f, 0x03, 0x31, 0x03, 0x33, 0x03, 0x35, 0x03, 0x37, 0x03, 0x39, 0x03, 0x3b, 0x03, 0x3d,
-    0x03, 0x3f, 0x03, 0x40, 0x03, 0x42, 0x03, 0x44, 0x03, 0x46, 0x03, 0x48, 0x03, 0xa1, 0x03, 0xa2,
-    0x03, 0xa3, 0x03, 0xa4, 0x03, 0xa5, 0x03, 0xa6, 0x03, 0xa7, 0x03, 0xa9, 0x03, 0xaa, 0x03, 0xab,
-    0x03, 0xac, 0x03, 0xad, 0x03, 0xae, 0x03, 0xaf, 0x03, 0xb0, 0x03, 0xb1, 0x03, 0xb2, 0x03, 0xb3,
-    0x03, 0xb4, 0x03, 0xb5, 0x03, 0xb6, 0x03, 0xb7, 0x03, 0xb8, 0x03, 0xc8, 0x03, 0xc9, 0x03, 0xca,
-    0x03, 0xcb, 0x03, 0xcc, 0x03, 0xcd, 0x03, 0xce, 0x03, 0xcf, 0x03, 0xd0, 0x03, 0xd1, 0x03, 0xd2,
-    0x03, 0xd3, 0x03, 0xd4, 0x03, 0xd5, 0x03, 0xd6, 0x03, 0xd7, 0x03, 0xd8, 0x03, 0xd9, 0x03, 0xda,
-    0x03, 0xdb, 0x03, 0xdc, 0x03, 0xdd, 0x03, 0xee, 0x03, 0xf0, 0x03, 0xf2, 0x03, 0xf4, 0x04, 0x09,
-    0x04, 0x0b, 0x04, 0x0d, 0x04, 0x22, 0x04, 0x28, 0x04, 0x2e, 0x04, 0x98, 0x04, 0x9d, 0x04, 0xa1,
-    0x05, 0x22, 0x05, 0x24, 0x00, 0x06, 0x00, 0x64, 0x00, 0x00, 0x03, 0x28, 0x05, 0xb0, 0x00, 0x03,
-    0x00, 0x07, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x17, 0x00, 0x00, 0x41, 0x15, 0x21, 0x35,
-    0x33, 0x11, 0x23, 0x11, 0x21, 0x11, 0x23, 0x11, 0x13, 0x15, 0x21, 0x35, 0x01, 0x01, 0x23, 0x01,
-    0x11, 0x01, 0x33, 0x01, 0x03, 0x09, 0xfd, 0x76, 0x1b, 0x36, 0x02, 0xc4, 0x36, 0x17, 0xfd, 0x76,
-    0x02, 0x8a, 0xfd, 0xaf, 0x3a, 0x02, 0x51, 0xfd, 0xaf, 0x3a, 0x02, 0x51, 0x05, 0xb0, 0x36, 0x36,
-    0xfa, 0x50, 0x05, 0xb0, 0xfa, 0x50, 0x05, 0xb0, 0xfa, 0x86, 0x36, 0x36, 0x05, 0x5c, 0xfa, 0x8c,
-    0x05, 0x74, 0xfa, 0x8c, 0x05, 0x74, 0xfa, 0x8c, 0x00, 0x02, 0x00, 0x9a, 0xff, 0xf7, 0x01, 0x3f,
-    0x05, 0xb0, 0x00, 0x03, 0x00, 0x0f, 0x00, 0x13, 0x40, 0x09, 0x02, 0x02, 0x07, 0x0d, 0x0b, 0x72,
-    0x00, 0x02, 0x72, 0x00, 0x2b, 0x2b, 0xdd, 0xce, 0x2f, 0x30, 0x31, 0x41, 0x03, 0x23, 0x03, 0x03,
-    0x34, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14, 0x06, 0x23, 0x22, 0x26, 0x01, 0x23, 0x06, 0x6f, 0x07,
-    0x0d, 0x2c, 0x26, 0x26, 0x2d, 0x2d, 0x26, 0x26, 0x2c, 0x05, 0xb0, 0xfb, 0xe6, 0x04, 0x1a, 0xfa,
-    0x97, 0x22, 0x30, 0x30, 0x22, 0x21, 0x2f, 0x2f, 0x00, 0x02, 0x00, 0x90, 0x04, 0x3b, 0x01, 0xe0,
-    0x06, 0x00, 0x00, 0x05, 0x00, 0x0b, 0x00, 0x0c, 0xb3, 0x09, 0x03, 0x0b, 0x05, 0x00, 0x2f, 0x33,
-    0xcd, 0x32, 0x30, 0x31, 0x53, 0x15, 0x03, 0x23, 0x13, 0x35, 0x21, 0x15, 0x03, 0x23, 0x13, 0x35,
-    0xf4, 0x14, 0x50, 0x02, 0x01, 0x4e, 0x14, 0x51, 0x03, 0x06, 0x00, 0x8b, 0xfe, 0xc6, 0x01, 0x34,
-    0x91, 0x8b, 0xfe, 0xc6, 0x01, 0x37, 0x8e, 0x00, 0x00, 0x04, 0x00, 0x55, 0x00, 0x00, 0x04, 0xb1,
-    0x05, 0xb0, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x23, 0x40, 0x11, 0x04, 0x00,
-    0x05, 0x0d, 0x0e, 0x0e, 0x00, 0x0a, 0x09, 0x09, 0x00, 0x02, 0x02, 0x72, 0x00, 0x12, 0x72, 0x00,
-    0x2b, 0x2b, 0x11, 0x39, 0x2f, 0x33, 0x11, 0x39, 0x2f, 0x33, 0x32, 0x11, 0x33, 0x30, 0x31, 0x61,
-    0x01, 0x33, 0x01, 0x21, 0x01, 0x33, 0x01, 0x01, 0x21, 0x35, 0x21, 0x03, 0x21, 0x35, 0x21, 0x01,
-    0x08, 0x01, 0x11, 0x64, 0xfe, 0xee, 0x01, 0x3a, 0x01, 0x13, 0x63, 0xfe, 0xed, 0x01, 0xa9, 0xfb,
-    0xf0, 0x04, 0x10, 0x4b, 0xfb, 0xef, 0x04, 0x11, 0x05, 0xb0, 0xfa, 0x50, 0x05, 0xb0, 0xfa, 0x50,
-    0x03, 0xb0, 0x60, 0xfd, 0x8a, 0x5f, 0x00, 0x03, 0x00, 0x74, 0xff, 0x30, 0x03, 0xfe, 0x06, 0x8e,
-    0x00, 0x03, 0x00, 0x07, 0x00, 0x3d, 0x00, 0x36, 0x40, 0x1c, 0x04, 0x07, 0x3a, 0x3a, 0x08, 0x2b,
-    0x10, 0x23, 0x04, 0x14, 0x2f, 0x35, 0x35, 0x06, 0x2f, 0x0d, 0x72, 0x01, 0x02, 0x1f, 0x1f, 0x14,
-    0x1a, 0x1a, 0x03, 0x14, 0x05, 0x72, 0x00, 0x2b, 0xcd, 0x33, 0x2f, 0x11, 0x33, 0x12, 0x39, 0x39,
-    0x2b, 0xcd, 0x33, 0x2f, 0x11, 0x12, 0x17, 0x39, 0x33, 0x12, 0x39, 0x39, 0x30, 0x31, 0x41, 0x11,
-    0x23, 0x11, 0x13, 0x15, 0x23, 0x35, 0x01, 0x34, 0x26, 0x26, 0x27, 0x2e, 0x02, 0x35, 0x34, 0x36,
-    0x36, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x23, 0x34, 0x2e, 0x02, 0x23, 0x22, 0x06, 0x06, 0x15, 0x14,
-    0x16, 0x16, 0x17, 0x1e, 0x02, 0x15, 0x14, 0x06, 0x06, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x33, 0x14,
-    0x1e, 0x02, 0x33, 0x32, 0x36, 0x36, 0x02, 0x82, 0x67, 0x63, 0x66, 0x01, 0x6e, 0x3d, 0x8f, 0x7b,
-    0x7e, 0xb7, 0x63, 0x68, 0xbd, 0x80, 0x64, 0x9c, 0x6d, 0x3a, 0x77, 0x27, 0x4e, 0x71, 0x4a, 0x67,
-    0x86, 0x40, 0x36, 0x8f, 0x84, 0x7e, 0xb6, 0x62, 0x6e, 0xc7, 0x84, 0x55, 0xa6, 0x86, 0x50, 0x78,
-    0x3d, 0x66, 0x7a, 0x3c, 0x66, 0x8f, 0x4c, 0x06, 0x8e, 0xfe, 0xf6, 0x01, 0x0a, 0xf9, 0x99, 0xf7,
-    0xf7, 0x01, 0x41, 0x49, 0x6d, 0x59, 0x2b, 0x29, 0x68, 0x9d, 0x77, 0x75, 0xac, 0x5d, 0x3a, 0x73,
-    0xa7, 0x6d, 0x4a, 0x7c, 0x5d, 0x33, 0x4a, 0x7c, 0x4a, 0x49, 0x6d, 0x5a, 0x2c, 0x2a, 0x68, 0x9b,
-    0x77, 0x79, 0xab, 0x5b, 0x2d, 0x67, 0xa9, 0x7b, 0x60, 0x81, 0x4b, 0x20, 0x49, 0x7c, 0x00, 0x05,
-    0x00, 0x6e, 0xff, 0xeb, 0x05, 0x84, 0x05, 0xc5, 0x00, 0x11, 0x00, 0x23, 0x00, 0x35, 0x00, 0x47,
-    0x00, 0x4b, 0x00, 0x23, 0x40, 0x11, 0x49, 0x32, 0x4b, 0x05, 0x3b, 0x44, 0x29, 0x32, 0x17, 0x0e,
-    0x20, 0x05, 0x05, 0x72, 0x32, 0x0d, 0x72, 0x00, 0x2b, 0x2b, 0x32, 0xc4, 0x32, 0x10, 0xc4, 0x32,
-    0x33, 0x11, 0x33, 0x11, 0x33, 0x30, 0x31, 0x53, 0x35, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x16,
-    0x15, 0x15, 0x14, 0x06, 0x06, 0x23, 0x22, 0x26, 0x26, 0x37, 0x15, 0x14, 0x16, 0x16, 0x33, 0x32,
-    0x36, 0x36, 0x35, 0x35, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x01, 0x35, 0x34, 0x36, 0x36,
-    0x33, 0x32, 0x16, 0x16, 0x15, 0x15, 0x14, 0x06, 0x06, 0x23, 0x22, 0x26, 0x26, 0x37, 0x15, 0x14,
-    0x16, 0x16, 0x33, 0x32, 0x36, 0x36, 0x35, 0x35, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x13,
-    0x01, 0x27, 0x01, 0x6e, 0x46, 0x80, 0x57, 0x57, 0x80, 0x46, 0x45, 0x7f, 0x57, 0x58, 0x81, 0x46,
-    0x61, 0x29, 0x55, 0x40, 0x3f, 0x52, 0x29, 0x29, 0x54, 0x3f, 0x3f, 0x54, 0x29, 0x02, 0x7b, 0x46,
-    0x80, 0x57, 0x58, 0x7f, 0x46, 0x45, 0x7f, 0x57, 0x58, 0x80, 0x47, 0x61, 0x29, 0x55, 0x40, 0x3f,
-    0x53, 0x29, 0x29, 0x54, 0x40, 0x3e, 0x54, 0x2a, 0xcf, 0xfd, 0x39, 0x4b, 0x02, 0xc7, 0x04, 0x4b,
-    0x4d, 0x53, 0x88, 0x52, 0x52, 0x88, 0x53, 0x4d, 0x51, 0x88, 0x52, 0x52, 0x88, 0x9e, 0x4d, 0x35,
-    0x61, 0x3d, 0x3d, 0x61, 0x35, 0x4d, 0x37, 0x61, 0x3e, 0x3e, 0x61, 0xfc, 0x48, 0x4e, 0x52, 0x88,
-    0x52, 0x52, 0x88, 0x52, 0x4e, 0x52, 0x88, 0x52, 0x52, 0x88, 0xa0, 0x4e, 0x35, 0x62, 0x3d, 0x3d,
-    0x61, 0x36, 0x4e, 0x39, 0x61, 0x3b, 0x3b, 0x61, 0x03, 0x4d, 0xfb, 0x8e, 0x31, 0x04, 0x72, 0x00,
-    0x00, 0x01, 0x00, 0x6d, 0xff, 0xec, 0x04, 0xd0, 0x05, 0xc5, 0x00, 0x42, 0x00, 0x24, 0x40, 0x14,
-    0x23, 0x12, 0x00, 0x0f, 0x22, 0x01, 0x06, 0x1a, 0x30, 0x30, 0x2b, 0x11, 0x11, 0x3b, 0x13, 0x72,
-    0x07, 0x1a, 0x03, 0x72, 0x00, 0x2b, 0x32, 0x2b, 0x32, 0x2f, 0x32, 0x32, 0x2f, 0x11, 0x17, 0x39,
-    0x30, 0x31, 0x41, 0x37, 0x36, 0x36, 0x35, 0x34, 0x26, 0x23, 0x22, 0x06, 0x06, 0x15, 0x14, 0x16,
-    0x16, 0x17, 0x01, 0x23, 0x01, 0x2e, 0x02, 0x35, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x16, 0x15,
-    0x14, 0x06, 0x06, 0x07, 0x05, 0x0e, 0x02, 0x15, 0x14, 0x16, 0x16, 0x33, 0x32, 0x3e, 0x02, 0x35,
-    0x33, 0x14, 0x06, 0x06, 0x07, 0x06, 0x06, 0x07, 0x06, 0x06, 0x23, 0x22, 0x26, 0x26, 0x35, 0x34,
-    0x36, 0x36, 0x01, 0x87, 0xea, 0x3f, 0x53, 0x66, 0x60, 0x45, 0x60, 0x31, 0x27, 0x4a, 0x34, 0x02,
-    0xc4, 0x91, 0xfd, 0xa5, 0x4a, 0x6f, 0x3c, 0x52, 0x97, 0x66, 0x62, 0x8b, 0x4a, 0x3a, 0x59, 0x30,
-    0xfe, 0xf5, 0x55, 0x53, 0x1b, 0x48, 0x94, 0x71, 0x5e, 0xaf, 0x8b, 0x51, 0x6f, 0x25, 0x48, 0x35,
-    0x08, 0x06, 0x08, 0x50, 0xd7, 0x79, 0x8c, 0xcb, 0x6d, 0x4a, 0x80, 0x03, 0x11, 0xb1, 0x2e, 0x6d,
-    0x4a, 0x47, 0x70, 0x3d, 0x67, 0x3d, 0x30, 0x67, 0x6f, 0x3d, 0xfc, 0xc6, 0x02, 0xbd, 0x56, 0x92,
-    0x8a, 0x4a, 0x67, 0x94, 0x51, 0x4f, 0x81, 0x4e, 0x41, 0x70, 0x5b, 0x26, 0xcd, 0x45, 0x74, 0x5a,
-    0x21, 0x4c, 0x84, 0x51, 0x52, 0x96, 0xd2, 0x7f, 0x5f, 0xa5, 0x8d, 0x3b, 0x0a, 0x0c, 0x08, 0x54,
-    0x62, 0x63, 0xb0, 0x75, 0x58, 0x8d, 0x7c, 0x00, 0x00, 0x01, 0x00, 0x78, 0x04, 0x42, 0x00, 0xe3,
-    0x06, 0x00, 0x00, 0x05, 0x00, 0x08, 0xb1, 0x03, 0x05, 0x00, 0x2f, 0xc6, 0x30, 0x31, 0x53, 0x15,
-    0x03, 0x23, 0x13, 0x35, 0xe3, 0x11, 0x5a, 0x05, 0x06, 0x00, 0x8b, 0xfe, 0xcd, 0x01, 0x29, 0x95,
-    0x00, 0x01, 0x00, 0x8d, 0xfe, 0x2a, 0x02, 0x6e, 0x06, 0x61, 0x00, 0x17, 0x00, 0x08, 0xb1, 0x06,
-    0x13, 0x00, 0x2f, 0x2f, 0x30, 0x31, 0x53, 0x35, 0x34, 0x12, 0x12, 0x36, 0x37, 0x17, 0x0e, 0x02,
-    0x02, 0x15, 0x15, 0x14, 0x12, 0x16, 0x16, 0x17, 0x07, 0x26, 0x26, 0x02, 0x02, 0x8d, 0x52, 0x86,
-    0x9e, 0x4e, 0x1d, 0x43, 0x80, 0x68, 0x3e, 0x3e, 0x68, 0x80, 0x43, 0x1d, 0x4e, 0x9e, 0x86, 0x52,
-    0x02, 0x3e, 0x0f, 0xc4, 0x01, 0x53, 0x01, 0x11, 0xbe, 0x2e, 0x52, 0x2f, 0xb2, 0xfa, 0xfe, 0xcc,
-    0xb0, 0x14, 0xb0, 0xfe, 0xcc, 0xfb, 0xb5, 0x30, 0x4e, 0x2e, 0xbb, 0x01, 0x0d, 0x01, 0x56, 0x00,
-    0x00, 0x01, 0x00, 0x22, 0xfe, 0x2a, 0x02, 0x02, 0x06, 0x61, 0x00, 0x17, 0x00, 0x08, 0xb1, 0x13,
-    0x06, 0x00, 0x2f, 0x2f, 0x30, 0x31, 0x41, 0x15, 0x14, 0x02, 0x02, 0x06, 0x07, 0x27, 0x3e, 0x02,
-    0x12, 0x35, 0x35, 0x34, 0x02, 0x26, 0x26, 0x27, 0x37, 0x16, 0x16, 0x12, 0x12, 0x02, 0x02, 0x52,
-    0x85, 0x9f, 0x4d, 0x1d, 0x42, 0x80, 0x69, 0x3e, 0x40, 0x6a, 0x80, 0x3f, 0x1d, 0x4d, 0x9f, 0x85,
-    0x52, 0x02, 0x4d, 0x0f, 0xc8, 0xfe, 0xaa, 0xfe, 0xf3, 0xbb, 0x2e, 0x4e, 0x2f, 0xb4, 0xfc, 0x01,
-    0x35, 0xb0, 0x14, 0xb0, 0x01, 0x36, 0xfb, 0xb4, 0x2e, 0x4e, 0x2e, 0xbe, 0xfe, 0xef, 0xfe, 0xad,
-    0x00, 0x01, 0x00, 0x1d, 0x02, 0x7d, 0x03, 0x4b, 0x05, 0xb1, 0x00, 0x0e, 0x00, 0x14, 0x40, 0x0a,
-    0x0d, 0x01, 0x07, 0x04, 0x04, 0x0e, 0x0c, 0x06, 0x02, 0x72, 0x00, 0x2b, 0xc4, 0x32, 0x17, 0x39,
-    0x30, 0x31, 0x53, 0x13, 0x25, 0x37, 0x05, 0x03, 0x33, 0x03, 0x25, 0x17, 0x05, 0x13, 0x07, 0x03,
-    0x03, 0x90, 0xda, 0xfe, 0xb3, 0x21, 0x01, 0x4c, 0x04, 0x68, 0x09, 0x01, 0x45, 0x21, 0xfe, 0xb3,
-    0xdf, 0x56, 0xd5, 0xcd, 0x02, 0xbd, 0x01, 0x2c, 0x6b, 0x66, 0x7a, 0x01, 0x71, 0xfe, 0x8b, 0x7f,
-    0x67, 0x72, 0xfe, 0xda, 0x3f, 0x01, 0x31, 0xfe, 0xd1, 0x00, 0x00, 0x02, 0x00, 0x4c, 0x00, 0x92,
-    0x04, 0x32, 0x04, 0xb6, 0x00, 0x03, 0x00, 0x07, 0x00, 0x10, 0xb5, 0x07, 0x07, 0x03, 0x03, 0x06,
-    0x02, 0x00, 0x2f, 0xc6, 0x33, 0x10, 0xc6, 0x2f, 0x30, 0x31, 0x41, 0x15, 0x21, 0x35, 0x01, 0x11,
-    0x23, 0x11, 0x04, 0x32, 0xfc, 0x1a, 0x02, 0x2a, 0x78, 0x02, 0xe6, 0x72, 0x72, 0x01, 0xd0, 0xfb,
-    0xdc, 0x04, 0x24, 0x00, 0x00, 0x01, 0x00, 0x3d, 0xfe, 0xef, 0x01, 0x10, 0x00, 0xbe, 0x00, 0x0a,
-    0x00, 0x08, 0xb1, 0x04, 0x00, 0x00, 0x2f, 0xcd, 0x30, 0x31, 0x65, 0x15, 0x14, 0x06, 0x07, 0x27,
-    0x3e, 0x02, 0x35, 0x35, 0x01, 0x10, 0x4b, 0x41, 0x47, 0x1f, 0x2a, 0x15, 0xbe, 0x8d, 0x5b, 0xac,
-    0x3b, 0x35, 0x29, 0x53, 0x5a, 0x35, 0x8f, 0x00, 0x00, 0x01, 0x00, 0x32, 0x02, 0x4f, 0x02, 0x11,
-    0x02, 0xb6, 0x00, 0x03, 0x00, 0x08, 0xb1, 0x03, 0x02, 0x00, 0x2f, 0x33, 0x30, 0x31, 0x41, 0x15,
-    0x21, 0x35, 0x02, 0x11, 0xfe, 0x21, 0x02, 0xb6, 0x67, 0x67, 0x00, 0x01, 0x00, 0x92, 0xff, 0xf7,
-    0x01, 0x3c, 0x00, 0x9e, 0x00, 0x0b, 0x00, 0x0a, 0xb3, 0x03, 0x09, 0x0b, 0x72, 0x00, 0x2b, 0x32,
-    0x30, 0x31, 0x77, 0x34, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14, 0x06, 0x23, 0x22, 0x26, 0x92, 0x2d,
-    0x28, 0x27, 0x2e, 0x2e, 0x27, 0x28, 0x2d, 0x4a, 0x23, 0x31, 0x31, 0x23, 0x23, 0x30, 0x30, 0x00,
-    0x00, 0x01, 0x00, 0x1f, 0xff, 0x83, 0x02, 0xeb, 0x05, 0xb0, 0x00, 0x03, 0x00, 0x09, 0xb2, 0x00,
-    0x02, 0x01, 0x00, 0x2f, 0x3f, 0x30, 0x31, 0x41, 0x01, 0x23, 0x01, 0x02, 0xeb, 0xfd, 0xa1, 0x6d,
-    0x02, 0x60, 0x05, 0xb0, 0xf9, 0xd3, 0x06, 0x2d, 0x00, 0x02, 0x00, 0x78, 0xff, 0xec, 0x03, 0xf8,
-    0x05, 0xc5, 0x00, 0x17, 0x00, 0x2f, 0x00, 0x13, 0x40, 0x09, 0x2b, 0x06, 0x1f, 0x12, 0x05, 0x72,
-    0x06, 0x0d, 0x72, 0x00, 0x2b, 0x2b, 0x32, 0x11, 0x33, 0x30, 0x31, 0x41, 0x15, 0x14, 0x0e, 0x02,
-    0x23, 0x22, 0x2e, 0x03, 0x35, 0x35, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x1e, 0x03, 0x03, 0x11, 0x34,
-    0x2e, 0x03, 0x23, 0x22, 0x0e, 0x02, 0x15, 0x11, 0x14, 0x1e, 0x03, 0x33, 0x32, 0x3e, 0x02, 0x03,
-    0xf8, 0x3c, 0x73, 0xa6, 0x6a, 0x54, 0x8b, 0x6e, 0x4c, 0x28, 0x3d, 0x74, 0xa5, 0x69, 0x55, 0x8c,
-    0x6d, 0x4b, 0x28, 0x78, 0x1b, 0x34, 0x4f, 0x69, 0x42, 0x51, 0x7b, 0x51, 0x2a, 0x1b, 0x35, 0x4f,
-    0x69, 0x41, 0x53, 0x7a, 0x52, 0x28, 0x03, 0x55, 0xf5, 0xa0, 0xed, 0x9b, 0x4c, 0x30, 0x63, 0x96,
-    0xcb, 0x80, 0xf5, 0xa1, 0xeb, 0x99, 0x4b, 0x30, 0x61, 0x95, 0xc9, 0xfe, 0x7c, 0x01, 0x13, 0x63,
-    0xa1, 0x7a, 0x52, 0x29, 0x41, 0x7f, 0xbd, 0x7c, 0xfe, 0xed, 0x62, 0xa1, 0x7c, 0x54, 0x2c, 0x44,
-    0x82, 0xbf, 0x00, 0x01, 0x00, 0xb3, 0x00, 0x00, 0x02, 0xb6, 0x05, 0xb6, 0x00, 0x06, 0x00, 0x0c,
-    0xb5, 0x06, 0x04, 0x72, 0x01, 0x0c, 0x72, 0x00, 0x2b, 0x2b, 0x30, 0x31, 0x41, 0x11, 0x23, 0x11,
-    0x05, 0x35, 0x25, 0x02, 0xb6, 0x77, 0xfe, 0x74, 0x01, 0xef, 0x05, 0xb6, 0xfa, 0x4a, 0x05, 0x1f,
-    0x93, 0x71, 0xb9, 0x00, 0x00, 0x01, 0x00, 0x6a, 0x00, 0x00, 0x04, 0x1a, 0x05, 0xc4, 0x00, 0x1f,
-    0x00, 0x19, 0x40, 0x0c, 0x10, 0x10, 0x0c, 0x15, 0x05, 0x72, 0x03, 0x1f, 0x1f, 0x02, 0x0c, 0x72,
-    0x00, 0x2b, 0x32, 0x11, 0x33, 0x2b, 0x32, 0x32, 0x2f, 0x30, 0x31, 0x65, 0x15, 0x21, 0x35, 0x01,
-    0x3e, 0x02, 0x35, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x15, 0x23, 0x34, 0x36, 0x36, 0x33,
-    0x32, 0x16, 0x16, 0x15, 0x14, 0x0e, 0x02, 0x07, 0x01, 0x04, 0x1a, 0xfc, 0x70, 0x01, 0xdd, 0x59,
-    0x6a, 0x2f, 0x45, 0x88, 0x63, 0x65, 0x93, 0x50, 0x77, 0x6b, 0xc8, 0x8c, 0x83, 0xbe, 0x67, 0x2f,
-    0x51, 0x66, 0x38, 0xfe, 0x6a, 0x67, 0x67, 0x5e, 0x02, 0x1c, 0x66, 0x99, 0x7e, 0x3c, 0x58, 0x86,
-    0x4c, 0x56, 0x99, 0x61, 0x78, 0xc8, 0x77, 0x5d, 0xae, 0x7b, 0x41, 0x86, 0x85, 0x82, 0x3f, 0xfe,
-    0x36, 0x00, 0x00, 0x02, 0x00, 0x63, 0xff, 0xec, 0x03, 0xf5, 0x05, 0xc4, 0x00, 0x1c, 0x00, 0x3b,
-    0x00, 0x2a, 0x40, 0x16, 0x1b, 0x1c, 0x1e, 0x1f, 0x04, 0x00, 0x00, 0x1d, 0x1d, 0x12, 0x33, 0x2f,
-    0x2f, 0x29, 0x0d, 0x72, 0x0d, 0x0d, 0x09, 0x12, 0x05, 0x72, 0x00, 0x2b, 0x32, 0x32, 0x2f, 0x2b,
-    0x32, 0x2f, 0x32, 0x11, 0x39, 0x2f, 0x33, 0x12, 0x17, 0x39, 0x30, 0x31, 0x41, 0x33, 0x32, 0x36,
-    0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x15, 0x23, 0x34, 0x36, 0x36, 0x33, 0x32,
-    0x16, 0x16, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x23, 0x15, 0x35, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x14,
-    0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x33, 0x14, 0x16, 0x16, 0x33, 0x32, 0x36, 0x36, 0x35,
-    0x34, 0x26, 0x26, 0x23, 0x01, 0x94, 0x7a, 0x70, 0x97, 0x4d, 0x42, 0x87, 0x69, 0x5b, 0x91, 0x54,
-    0x77, 0x72, 0xc8, 0x7d, 0x81, 0xbf, 0x6a, 0x39, 0x70, 0xa7, 0x6d, 0x89, 0x89, 0x7c, 0xb3, 0x72,
-    0x37, 0x43, 0x79, 0xa3, 0x61, 0x58, 0xa7, 0x85, 0x4e, 0x78, 0x58, 0x9d, 0x65, 0x67, 0x93, 0x4e,
-    0x5d, 0xa5, 0x6d, 0x03, 0x1b, 0x4c, 0x80, 0x4e, 0x58, 0x85, 0x4b, 0x48, 0x86, 0x5c, 0x76, 0xb5,
-    0x66, 0x5e, 0xb4, 0x81, 0x41, 0x80, 0x68, 0x3e, 0x17, 0x50, 0x3a, 0x67, 0x88, 0x4e, 0x63, 0x9b,
-    0x6b, 0x37, 0x34, 0x68, 0x9c, 0x67, 0x5c, 0x8c, 0x50, 0x48, 0x8a, 0x63, 0x69, 0x84, 0x3e, 0x00,
-    0x00, 0x02, 0x00, 0x44, 0x00, 0x00, 0x04, 0x4c, 0x05, 0xb0, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x1d,
-    0x40, 0x0e, 0x03, 0x07, 0x07, 0x06, 0x02, 0x02, 0x05, 0x09, 0x0c, 0x72, 0x0b, 0x05, 0x04, 0x72,
-    0x00, 0x2b, 0x32, 0x2b, 0x12, 0x39, 0x2f, 0x39, 0x33, 0x12, 0x39, 0x30, 0x31, 0x41, 0x15, 0x21,
-    0x35, 0x01, 0x33, 0x07, 0x01, 0x01, 0x11, 0x23, 0x11, 0x04, 0x4c, 0xfb, 0xf8, 0x02, 0xa1, 0x65,
-    0x8f, 0xfe, 0x1c, 0x02, 0x91, 0x77, 0x01, 0xd7, 0x67, 0x45, 0x03, 0xfb, 0xf7, 0xfd, 0x1e, 0x03,
-    0xd9, 0xfa, 0x50, 0x05, 0xb0, 0x00, 0x00, 0x01, 0x00, 0xa8, 0xff, 0xec, 0x04, 0x17, 0x05, 0xb0,
-    0x00, 0x29, 0x00, 0x1d, 0x40, 0x0e, 0x27, 0x09, 0x09, 0x02, 0x1d, 0x19, 0x19, 0x13, 0x0d, 0x72,
-    0x05, 0x02, 0x04, 0x72, 0x00, 0x2b, 0x32, 0x2b, 0x32, 0x2f, 0x32, 0x11, 0x39, 0x2f, 0x33, 0x30,
-    0x31, 0x41, 0x27, 0x13, 0x21, 0x15, 0x21, 0x03, 0x36, 0x36, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x14,
-    0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x27, 0x33, 0x1e, 0x02, 0x33, 0x32, 0x3e, 0x02, 0x35, 0x34,
-    0x2e, 0x02, 0x23, 0x22, 0x06, 0x01, 0x3a, 0x5f, 0x47, 0x02, 0xd8, 0xfd, 0x8f, 0x34, 0x26, 0x91,
-    0x5b, 0x62, 0x9e, 0x73, 0x3d, 0x33, 0x6a, 0xa5, 0x71, 0x57, 0x99, 0x78, 0x4b, 0x09, 0x74, 0x0b,
-    0x53, 0x8b, 0x5f, 0x4e, 0x75, 0x4f, 0x29, 0x2c, 0x55, 0x7c, 0x50, 0x68, 0x7b, 0x02, 0xd0, 0x1b,
-    0x02, 0xc5, 0x70, 0xfe, 0x16, 0x1b, 0x35, 0x41, 0x7a, 0xae, 0x6d, 0x69, 0xb0, 0x83, 0x48, 0x31,
-    0x65, 0x97, 0x66, 0x61, 0x86, 0x45, 0x33, 0x61, 0x8d, 0x5a, 0x4e, 0x83, 0x63, 0x36, 0x38, 0x00,
-    0x00, 0x01, 0x00, 0x83, 0xff, 0xec, 0x04, 0x09, 0x05, 0xbb, 0x00, 0x36, 0x00, 0x1b, 0x40, 0x0d,
-    0x0e, 0x2c, 0x18, 0x22, 0x22, 0x2c, 0x03, 0x00, 0x04, 0x72, 0x2c, 0x0d, 0x72, 0x00, 0x2b, 0x2b,
-    0x32, 0x11, 0x39, 0x2f, 0x33, 0x11, 0x33, 0x30, 0x31, 0x41, 0x33, 0x15, 0x23, 0x22, 0x0e, 0x02,
-    0x15, 0x15, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x3e, 0x02, 0x35, 0x34, 0x2e, 0x02, 0x23, 0x22, 0x06,
-    0x06, 0x07, 0x27, 0x3e, 0x03, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e,
-    0x02, 0x35, 0x35, 0x34, 0x12, 0x36, 0x24, 0x03, 0x3a, 0x12, 0x12, 0x8a, 0xd7, 0x92, 0x4c, 0x36,
-    0x60, 0x7f, 0x4a, 0x49, 0x74, 0x51, 0x2b, 0x27, 0x50, 0x78, 0x51, 0x5b, 0xa0, 0x66, 0x03, 0x44,
-    0x07, 0x48, 0x77, 0x9b, 0x5a, 0x69, 0x9d, 0x69, 0x34, 0x3b, 0x70, 0x9f, 0x65, 0x6e, 0xae, 0x7b,
-    0x40, 0x55, 0xad, 0x01, 0x05, 0x05, 0xbb, 0x69, 0x5a, 0xa9, 0xf0, 0x95, 0xc9, 0x64, 0xa0, 0x6f,
-    0x3b, 0x3d, 0x6b, 0x8e, 0x50, 0x4d, 0x89, 0x6a, 0x3c, 0x54, 0x8c, 0x53, 0x01, 0x5f, 0x96, 0x6c,
-    0x38, 0x4c, 0x85, 0xad, 0x60, 0x69, 0xb5, 0x88, 0x4c, 0x54, 0x94, 0xc2, 0x6e, 0x7f, 0xba, 0x01,
-    0x2f, 0xda, 0x75, 0x00, 0x00, 0x01, 0x00, 0x4e, 0x00, 0x00, 0x04, 0x0b, 0x05, 0xb0, 0x00, 0x06,
-    0x00, 0x13, 0x40, 0x09, 0x01, 0x05, 0x05, 0x06, 0x04, 0x72, 0x03, 0x0c, 0x72, 0x00, 0x2b, 0x2b,
-    0x32, 0x11, 0x33, 0x30, 0x31, 0x41, 0x15, 0x01, 0x23, 0x01, 0x21, 0x35, 0x04, 0x0b, 0xfd, 0x92,
-    0x7d, 0x02, 0x6a, 0xfc, 0xc4, 0x05, 0xb0, 0x45, 0xfa, 0x95, 0x05, 0x49, 0x67, 0x00, 0x00, 0x04,
-    0x00, 0x6b, 0xff, 0xec, 0x04, 0x0a, 0x05, 0xc4, 0x00, 0x10, 0x00, 0x20, 0x00, 0x30, 0x00, 0x40,
-    0x00, 0x21, 0x40, 0x10, 0x0d, 0x3d, 0x3d, 0x25, 0x2d, 0x15, 0x15, 0x04, 0x35, 0x2d, 0x05, 0x72,
-    0x1d, 0x04, 0x0d, 0x72, 0x00, 0x2b, 0x32, 0x2b, 0x32, 0x12, 0x39, 0x2f, 0x12, 0x39, 0x33, 0x12,
-    0x39, 0x30, 0x31, 0x41, 0x14, 0x06, 0x06, 0x23, 0x22, 0x26, 0x26, 0x35, 0x34, 0x3e, 0x02, 0x33,
-    0x32, 0x16, 0x16, 0x07, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x15, 0x14, 0x16, 0x16, 0x33,
-    0x32, 0x36, 0x36, 0x13, 0x14, 0x06, 0x06, 0x23, 0x22, 0x26, 0x26, 0x35, 0x34, 0x36, 0x36, 0x33,
-    0x32, 0x16, 0x16, 0x07, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x15, 0x14, 0x16, 0x16, 0x33,
-    0x32, 0x36, 0x36, 0x04, 0x0a, 0x7c, 0xd1, 0x82, 0x83, 0xd3, 0x7a, 0x45, 0x7c, 0xa9, 0x64, 0x83,
-    0xd3, 0x7b, 0x79, 0x5a, 0x9c, 0x62, 0x64, 0x9b, 0x58, 0x58, 0x9c, 0x65, 0x64, 0x9a, 0x58, 0x53,
-    0x71, 0xc1, 0x78, 0x7b, 0xc1, 0x6e, 0x6f, 0xc0, 0x79, 0x7a, 0xc1, 0x71, 0x78, 0x51, 0x8b, 0x58,
-    0x58, 0x8a, 0x4e, 0x4e, 0x8b, 0x59, 0x58, 0x8a, 0x50, 0x01, 0x83, 0x85, 0xb5, 0x5d, 0x5d, 0xb5,
-    0x85, 0x56, 0x90, 0x69, 0x39, 0x64, 0xb1, 0x74, 0x5d, 0x8c, 0x4d, 0x4d, 0x8c, 0x5d, 0x61, 0x87,
-    0x47, 0x47, 0x87, 0x03, 0x19, 0x6b, 0xa7, 0x5f, 0x5f, 0xa7, 0x6b, 0x7f, 0xaf, 0x5c, 0x5c, 0xaf,
-    0x7e, 0x55, 0x82, 0x4b, 0x46, 0x82, 0x5a, 0x57, 0x80, 0x45, 0x45, 0x80, 0x00, 0x01, 0x00, 0x66,
-    0xff, 0xf5, 0x03, 0xed, 0x05, 0xc4, 0x00, 0x38, 0x00, 0x1b, 0x40, 0x0d, 0x00, 0x38, 0x16, 0x21,
-    0x21, 0x38, 0x0c, 0x2b, 0x05, 0x72, 0x38, 0x0c, 0x72, 0x00, 0x2b, 0x2b, 0x32, 0x11, 0x39, 0x2f,
-    0x33, 0x11, 0x33, 0x30, 0x31, 0x65, 0x33, 0x32, 0x3e, 0x02, 0x35, 0x35, 0x34, 0x2e, 0x02, 0x23,
-    0x22, 0x0e, 0x02, 0x15, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x3e, 0x02, 0x37, 0x37, 0x14, 0x0e, 0x02,
-    0x23, 0x22, 0x2e, 0x02, 0x35, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x15, 0x14, 0x0e,
-    0x03, 0x23, 0x23, 0x01, 0x2f, 0x19, 0x9f, 0xd6, 0x81, 0x38, 0x32, 0x5c, 0x7d, 0x4b, 0x4c, 0x78,
-    0x54, 0x2c, 0x28, 0x51, 0x75, 0x4d, 0x56, 0x87, 0x5f, 0x33, 0x02, 0x3c, 0x43, 0x79, 0xa2, 0x5e,
-    0x66, 0x9d, 0x69, 0x36, 0x3b, 0x72, 0xa3, 0x68, 0x75, 0xae, 0x73, 0x39, 0x29, 0x5c, 0x9c, 0xe6,
-    0x9e, 0x1a, 0x5f, 0x5c, 0xa5, 0xde, 0x82, 0xcb, 0x73, 0xae, 0x75, 0x3c, 0x40, 0x71, 0x90, 0x51,
-    0x4b, 0x8b, 0x6f, 0x40, 0x41, 0x6a, 0x7b, 0x3a, 0x01, 0x5c, 0xa4, 0x80, 0x49, 0x51, 0x8a, 0xaf,
-    0x5e, 0x69, 0xb8, 0x8d, 0x50, 0x55, 0x9c, 0xd4, 0x80, 0x73, 0x81, 0xec, 0xc6, 0x93, 0x51, 0x00,
-    0xff, 0xff, 0x00, 0x7e, 0xff, 0xf7, 0x01, 0x2c, 0x04, 0x38, 0x04, 0x26, 0x00, 0x12, 0xed, 0x00,
-    0x00, 0x07, 0x00, 0x12, 0xff, 0xf0, 0x03, 0x9b, 0xff, 0xff, 0x00, 0x3d, 0xfe, 0xef, 0x01, 0x20,
-    0x04, 0x38, 0x04, 0x27, 0x00, 0x12, 0xff, 0xe4, 0x03, 0x9b, 0x00, 0x06, 0x00, 0x10, 0x00, 0x00,
-    0x00, 0x02, 0x00, 0x4d, 0x00, 0xe5, 0x03, 0x89, 0x04, 0x3c, 0x00, 0x04, 0x00, 0x09, 0x00, 0x16,
-    0x40, 0x0c, 0x01, 0x03, 0x07, 0x06, 0x00, 0x04, 0x08, 0x05, 0x08, 0x02, 0x09, 0x02, 0x00, 0x2f,
-    0x2f, 0x12, 0x17, 0x39, 0x30, 0x31, 0x53, 0x01, 0x15, 0x01, 0x35, 0x01, 0x01, 0x07, 0x35, 0x01,
-    0x9e, 0x02, 0xeb, 0xfc, 0xc4, 0x03, 0x3c, 0xfd, 0x16, 0x52, 0x03, 0x3c, 0x02, 0xa6, 0xfe, 0xbf,
-    0x80, 0x01, 0x7b, 0x4f, 0x01, 0x0e, 0xfe, 0xbd, 0x07, 0x4f, 0x01, 0x7a, 0x00, 0x02, 0x00, 0x96,
-    0x01, 0xa2, 0x03, 0xd8, 0x03, 0xa8, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0e, 0xb5, 0x06, 0x07, 0x12,
-    0x03, 0x02, 0x10, 0x00, 0x3f, 0x33, 0x3f, 0x33, 0x30, 0x31, 0x41, 0x15, 0x21, 0x35, 0x01, 0x15,
-    0x21, 0x35, 0x03, 0xd8, 0xfc, 0xbe, 0x03, 0x42, 0xfc, 0xbe, 0x03, 0xa8, 0x6b, 0x6b, 0xfe, 0x65,
-    0x6b, 0x6b, 0x00, 0x02, 0x00, 0x7d, 0x00, 0xe7, 0x03, 0xca, 0x04, 0x3e, 0x00, 0x04, 0x00, 0x09,
-    0x00, 0x15, 0x40, 0x0b, 0x05, 0x08, 0x04, 0x00, 0x06, 0x03, 0x01, 0x07, 0x02, 0x09, 0x02, 0x00,
-    0x2f, 0x2f, 0x12, 0x17, 0x39, 0x30, 0x31, 0x41, 0x01, 0x35, 0x01, 0x15, 0x01, 0x01, 0x37, 0x15,
-    0x01, 0x03, 0x70, 0xfd, 0x0d, 0x03, 0x4d, 0xfc, 0xb3, 0x02, 0xf5, 0x58, 0xfc, 0xb3, 0x02, 0x81,
-    0x01, 0x40, 0x7d, 0xfe, 0x86, 0x50, 0xfe, 0xf0, 0x01, 0x44, 0x0a, 0x50, 0xfe, 0x85, 0x00, 0x02,
-    0x00, 0x54, 0xff, 0xf7, 0x03, 0x4c, 0x05, 0xc4, 0x00, 0x20, 0x00, 0x2c, 0x00, 0x1b, 0x40, 0x0d,
-    0x01, 0x01, 0x24, 0x24, 0x2a, 0x0b, 0x72, 0x11, 0x11, 0x0d, 0x16, 0x03, 0x72, 0x00, 0x2b, 0x32,
-    0x32, 0x2f, 0x2b, 0x32, 0x11, 0x33, 0x2f, 0x30, 0x31, 0x41, 0x23, 0x3e, 0x02, 0x37, 0x3e, 0x02,
-    0x35, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x07, 0x23, 0x3e, 0x02, 0x33, 0x32, 0x16, 0x16,
-    0x15, 0x14, 0x06, 0x06, 0x07, 0x06, 0x06, 0x03, 0x34, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14, 0x06,
-    0x23, 0x22, 0x26, 0x01, 0xf0, 0x78, 0x01, 0x20, 0x48, 0x3d, 0x35, 0x52, 0x2f, 0x38, 0x70, 0x53,
-    0x4d, 0x79, 0x46, 0x01, 0x78, 0x02, 0x69, 0xaf, 0x6b, 0x77, 0xa6, 0x56, 0x3c, 0x6a, 0x45, 0x41,
-    0x30, 0x88, 0x2c, 0x26, 0x27, 0x2c, 0x2c, 0x27, 0x26, 0x2c, 0x01, 0x95, 0x55, 0x76, 0x65, 0x3b,
-    0x35, 0x5c, 0x6d, 0x50, 0x4f, 0x78, 0x44, 0x3c, 0x71, 0x50, 0x72, 0xa1, 0x55, 0x5e, 0xa8, 0x6f,
-    0x59, 0x8f, 0x7e, 0x40, 0x37, 0x8d, 0xfe, 0x62, 0x22, 0x30, 0x30, 0x22, 0x21, 0x2f, 0x2f, 0x00,
-    0x00, 0x02, 0x00, 0x74, 0xfe, 0x3b, 0x06, 0xdf, 0x05, 0x8d, 0x00, 0x41, 0x00, 0x68, 0x00, 0x27,
-    0x40, 0x12, 0x12, 0x05, 0x05, 0x47, 0x52, 0x13, 0x72, 0x61, 0x64, 0x64, 0x0b, 0x5d, 0x5d, 0x1d,
-    0x1d, 0x3c, 0x29, 0x30, 0x00, 0x2f, 0x33, 0x2f, 0x33, 0x11, 0x33, 0x2f, 0x33, 0x33, 0x11, 0x33,
-    0x2b, 0x32, 0x32, 0x11, 0x33, 0x30, 0x31, 0x41, 0x0e, 0x03, 0x23, 0x22, 0x2e, 0x02, 0x37, 0x13,
-    0x33, 0x03, 0x06, 0x1e, 0x02, 0x33, 0x32, 0x3e, 0x02, 0x37, 0x36, 0x2e, 0x03, 0x23, 0x22, 0x0e,
-    0x02, 0x02, 0x07, 0x06, 0x12, 0x1e, 0x02, 0x33, 0x32, 0x36, 0x37, 0x17, 0x06, 0x06, 0x23, 0x22,
-    0x2e, 0x02, 0x02, 0x37, 0x36, 0x12, 0x36, 0x36, 0x24, 0x33, 0x32, 0x1e, 0x02, 0x12, 0x05, 0x06,
-    0x1e, 0x02, 0x33, 0x32, 0x3e, 0x02, 0x37, 0x17, 0x0e, 0x03, 0x23, 0x22, 0x2e, 0x02, 0x37, 0x3e,
-    0x04, 0x33, 0x32, 0x16, 0x17, 0x07, 0x26, 0x26, 0x23, 0x22, 0x0e, 0x02, 0x06, 0xd8, 0x04, 0x2f,
-    0x5d, 0x91, 0x65, 0x40, 0x61, 0x40, 0x1a, 0x06, 0x32, 0x65, 0x32, 0x06, 0x1b, 0x34, 0x3b, 0x18,
-    0x43, 0x66, 0x48, 0x28, 0x04, 0x07, 0x29, 0x66, 0xa4, 0xe5, 0x95, 0x81, 0xe1, 0xb7, 0x87, 0x4f,
-    0x07, 0x07, 0x31, 0x6e, 0xa9, 0xdf, 0x89, 0x58, 0xb5, 0x3d, 0x1f, 0x43, 0xd0, 0x5a, 0x98, 0xfb,
-    0xc1, 0x80, 0x3c, 0x07, 0x07, 0x57, 0x96, 0xd0, 0x01, 0x03, 0x97, 0xa0, 0xfd, 0xbb, 0x78, 0x36,
-    0xfb, 0xc0, 0x08, 0x0e, 0x2c, 0x4a, 0x33, 0x27, 0x51, 0x4d, 0x44, 0x18, 0x31, 0x18, 0x49, 0x5d,
-    0x6d, 0x3d, 0x46, 0x6a, 0x43, 0x1a, 0x09, 0x09, 0x37, 0x51, 0x69, 0x78, 0x41, 0x65, 0x74, 0x34,
-    0x44, 0x1e, 0x61, 0x43, 0x3d, 0x6e, 0x5a, 0x3e, 0x02, 0x01, 0x5e, 0xbc, 0x9d, 0x5e, 0x2e, 0x57,
-    0x7b, 0x4c, 0x02, 0x39, 0xfd, 0xc7, 0x50, 0x62, 0x32, 0x11, 0x44, 0x79, 0xa3, 0x5e, 0x97, 0xfe,
-    0xc7, 0x8a, 0x48, 0x4d, 0x93, 0xd0, 0xfe, 0xf9, 0x9a, 0x95, 0xfe, 0xfe, 0xcf, 0x94, 0x4f, 0x2b,
-    0x24, 0x50, 0x2c, 0x2d, 0x53, 0x9f, 0xe3, 0x01, 0x22, 0xac, 0xa8, 0x01, 0x22, 0xe8, 0xa5, 0x58,
-    0x52, 0x9b, 0xde, 0xfe, 0xe6, 0xfd, 0x4d, 0x7f, 0x5e, 0x32, 0x1c, 0x45, 0x77, 0x5a, 0x3d, 0x55,
-    0x80, 0x57, 0x2c, 0x40, 0x76, 0xa4, 0x65, 0x67, 0xaf, 0x89, 0x61, 0x32, 0x41, 0x2b, 0x42, 0x22,
-    0x30, 0x39, 0x75, 0xb0, 0x00, 0x03, 0x00, 0x1f, 0x00, 0x00, 0x04, 0xe2, 0x05, 0xb0, 0x00, 0x04,
-    0x00, 0x09, 0x00, 0x0d, 0x00, 0x29, 0x40, 0x14, 0x04, 0x07, 0x07, 0x0a, 0x0d, 0x0d, 0x06, 0x00,
-    0x0b, 0x0c, 0x0c, 0x02, 0x08, 0x03, 0x02, 0x72, 0x05, 0x02, 0x08, 0x72, 0x00, 0x2b, 0x32, 0x2b,
-    0x32, 0x11, 0x39, 0x2f, 0x33, 0x39, 0x39, 0x33, 0x11, 0x33, 0x32, 0x11, 0x33, 0x30, 0x31, 0x41,
-    0x01, 0x23, 0x01, 0x33, 0x01, 0x01, 0x27, 0x33, 0x01, 0x03, 0x15, 0x21, 0x35, 0x02, 0x97, 0xfe,
-    0x08, 0x80, 0x02, 0x26, 0x5a, 0x01, 0xc2, 0xfe, 0x08, 0x07, 0x59, 0x02, 0x27, 0xda, 0xfc, 0xfa,
-    0x05, 0x59, 0xfa, 0xa7, 0x05, 0xb0, 0xfa, 0x50, 0x05, 0x59, 0x57, 0xfa, 0x50, 0x02, 0x02, 0x6a,
-    0x6a, 0x00, 0x00, 0x02, 0x00, 0xb9, 0x00, 0x00, 0x04, 0x77, 0x05, 0xb0, 0x00, 0x19, 0x00, 0x30,
-    0x00, 0x29, 0x40, 0x14, 0x19, 0x29, 0x26, 0x02, 0x27, 0x27, 0x01, 0x26, 0x26, 0x0e, 0x0c, 0x0f,
-    0x02, 0x72, 0x1c, 0x1b, 0x1b, 0x0e, 0x08, 0x72, 0x00, 0x2b, 0x32, 0x11, 0x33, 0x2b, 0x32, 0x11,
-    0x39, 0x2f, 0x33, 0x33, 0x11, 0x33, 0x12, 0x39, 0x39, 0x30, 0x31, 0x41, 0x21, 0x27, 0x21, 0x32,
-    0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x21, 0x11, 0x23, 0x11, 0x21, 0x32, 0x1e, 0x02, 0x15,
-    0x14, 0x06, 0x06, 0x07, 0x03, 0x21, 0x37, 0x21, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23,
-    0x21, 0x37, 0x21, 0x17, 0x1e, 0x02, 0x15, 0x14, 0x06, 0x06, 0x02, 0xaf, 0xfe, 0x65, 0x02, 0x01,
-    0x62, 0x6b, 0x98, 0x4f, 0x4e, 0x9c, 0x75, 0xfe, 0xcd, 0x7b, 0x01, 0xae, 0x6f, 0xb0, 0x7b, 0x41,
-    0x4f, 0x92, 0x65, 0x57, 0xfe, 0x48, 0x3f, 0x01, 0x79, 0x6c, 0x99, 0x52, 0x48, 0x94, 0x71, 0xff,
-    0x00, 0x02, 0x01, 0x69, 0x16, 0x63, 0x92, 0x52, 0x75, 0xd1, 0x02, 0xbc, 0x69, 0x3e, 0x7a, 0x5a,
-    0x5c, 0x79, 0x3a, 0xfa, 0xba, 0x05, 0xb0, 0x2c, 0x5e, 0x8f, 0x63, 0x5a, 0x91, 0x5b, 0x0b, 0xfd,
-    0x1d, 0x6a, 0x49, 0x88, 0x5e, 0x52, 0x84, 0x4d, 0x69, 0x26, 0x0a, 0x64, 0x9b, 0x5b, 0x85, 0xb7,
-    0x5f, 0x00, 0x00, 0x01, 0x00, 0x84, 0xff, 0xec, 0x04, 0xbf, 0x05, 0xc4, 0x00, 0x27, 0x00, 0x15,
-    0x40, 0x0a, 0x19, 0x15, 0x10, 0x03, 0x72, 0x24, 0x00, 0x05, 0x09, 0x72, 0x00, 0x2b, 0xcc, 0x33,
-    0x2b, 0xcc, 0x33, 0x30, 0x31, 0x41, 0x33, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x35, 0x34,
-    0x3e, 0x02, 0x33, 0x32, 0x16, 0x16, 0x17, 0x23, 0x2e, 0x02, 0x23, 0x22, 0x0e, 0x02, 0x15, 0x15,
-    0x14, 0x1e, 0x02, 0x33, 0x32, 0x36, 0x36, 0x04, 0x44, 0x7b, 0x0f, 0x83, 0xe5, 0xa0, 0x7c, 0xca,
-    0x90, 0x4e, 0x4e, 0x92, 0xcd, 0x7f, 0x9c, 0xe1, 0x83, 0x0f, 0x7b, 0x0e, 0x60, 0xa8, 0x7e, 0x65,
-    0xa1, 0x70, 0x3b, 0x39, 0x6c, 0x9e, 0x66, 0x81, 0xac, 0x60, 0x01, 0xc7, 0x94, 0xd4, 0x73, 0x5e,
-    0xae, 0xf2, 0x93, 0xb6, 0x94, 0xf1, 0xae, 0x5e, 0x71, 0xd4, 0x96, 0x76, 0xa4, 0x57, 0x4e, 0x91,
-    0xca, 0x7c, 0xb8, 0x77, 0xca, 0x94, 0x52, 0x52, 0xa5, 0x00, 0x00, 0x02, 0x00, 0xb9, 0x00, 0x00,
-    0x04, 0xbe, 0x05, 0xb0, 0x00, 0x1a, 0x00, 0x1e, 0x00, 0x1b, 0x40, 0x0d, 0x02, 0x01, 0x01, 0x1d,
-    0x0e, 0x0f, 0x0f, 0x1e, 0x02, 0x72, 0x1d, 0x08, 0x72, 0x00, 0x2b, 0x2b, 0x32, 0x11, 0x33, 0x11,
-    0x33, 0x11, 0x33, 0x30, 0x31, 0x61, 0x21, 0x37, 0x21, 0x32, 0x36, 0x36, 0x35, 0x35, 0x34, 0x2e,
-    0x02, 0x23, 0x21, 0x35, 0x21, 0x32, 0x1e, 0x02, 0x15, 0x15, 0x14, 0x0e, 0x02, 0x01, 0x11, 0x23,
-    0x11, 0x02, 0x47, 0xfe, 0xb7, 0x02, 0x01, 0x47, 0x9d, 0xe3, 0x7c, 0x47, 0x84, 0xb7, 0x71, 0xfe,
-    0xa8, 0x01, 0x58, 0x88, 0xe4, 0xa7, 0x5b, 0x5b, 0xa8, 0xe7, 0xfe, 0x60, 0x7b, 0x6a, 0x8c, 0xfb,
-    0xa5, 0x87, 0x7e, 0xcc, 0x91, 0x4e, 0x6a, 0x5d, 0xaf, 0xf4, 0x96, 0x84, 0x96, 0xf4, 0xae, 0x5e,
-    0x05, 0xb0, 0xfa, 0x50, 0x05, 0xb0, 0x00, 0x04, 0x00, 0xb9, 0x00, 0x00, 0x04, 0x42, 0x05, 0xb0,
-    0x00, 0x03, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x1d, 0x40, 0x0e, 0x0b, 0x0a, 0x0a, 0x06,
-    0x0f, 0x0e, 0x07, 0x02, 0x72, 0x03, 0x02, 0x06, 0x08, 0x72, 0x00, 0x2b, 0x32, 0x32, 0x2b, 0x32,
-    0x32, 0x11, 0x39, 0x2f, 0x33, 0x30, 0x31, 0x65, 0x15, 0x21, 0x35, 0x13, 0x11, 0x23, 0x11, 0x01,
-    0x15, 0x21, 0x35, 0x01, 0x15, 0x21, 0x35, 0x04, 0x42, 0xfc, 0xcd, 0x25, 0x7b, 0x03, 0x23, 0xfd,
-    0x33, 0x03, 0x2e, 0xfc, 0xd2, 0x6a, 0x6a, 0x6a, 0x05, 0x46, 0xfa, 0x50, 0x05, 0xb0, 0xfd, 0x73,
-    0x69, 0x69, 0x02, 0x8d, 0x6a, 0x6a, 0x00, 0x03, 0x00, 0xb9, 0x00, 0x00, 0x04, 0x3f, 0x05, 0xb0,
-    0x00, 0x03, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x1b, 0x40, 0x0d, 0x07, 0x06, 0x06, 0x02, 0x0a, 0x0b,
-    0x0b, 0x03, 0x02, 0x72, 0x02, 0x08, 0x72, 0x00, 0x2b, 0x2b, 0x32, 0x11, 0x33, 0x11, 0x39, 0x2f,
-    0x33, 0x30, 0x31, 0x41, 0x11, 0x23, 0x11, 0x01, 0x15, 0x21, 0x35, 0x01, 0x15, 0x21, 0x35, 0x01,
-    0x34, 0x7b, 0x03, 0x21, 0xfd, 0x32, 0x03, 0x33, 0xfc, 0xcd, 0x05, 0xb0, 0xfa, 0x50, 0x05, 0xb0,
-    0xfd, 0x63, 0x6b, 0x6b, 0x02, 0x9d, 0x6a, 0x6a, 0x00, 0x01, 0x00, 0x91, 0xff, 0xec, 0x04, 0xd4,
-    0x05, 0xc4, 0x00, 0x2b, 0x00, 0x1b, 0x40, 0x0d, 0x2b, 0x2a, 0x2a, 0x05, 0x19, 0x15, 0x10, 0x03,
-    0x72, 0x24, 0x05, 0x09, 0x72, 0x00, 0x2b, 0x32, 0x2b, 0xcc, 0x33, 0x12, 0x39, 0x2f, 0x33, 0x30,
-    0x31, 0x41, 0x11, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x35, 0x34, 0x3e, 0x02, 0x33, 0x32,
-    0x16, 0x16, 0x17, 0x23, 0x2e, 0x02, 0x23, 0x22, 0x0e, 0x02, 0x15, 0x15, 0x14, 0x1e, 0x02, 0x33,
-    0x32, 0x36, 0x36, 0x37, 0x11, 0x21, 0x35, 0x04, 0xd4, 0x19, 0x7b, 0xce, 0x98, 0x81, 0xd6, 0x9d,
-    0x55, 0x4e, 0x94, 0xd1, 0x82, 0xa3, 0xdd, 0x7d, 0x10, 0x7c, 0x0e, 0x58, 0xa7, 0x84, 0x6a, 0xa4,
-    0x71, 0x3a, 0x41, 0x7a, 0xaa, 0x68, 0x6f, 0x9c, 0x5f, 0x15, 0xfe, 0x79, 0x02, 0xb5, 0xfd, 0xf9,
-    0x24, 0x5b, 0x43, 0x5d, 0xaf, 0xf6, 0x98, 0xb0, 0x96, 0xf1, 0xac, 0x5b, 0x70, 0xc3, 0x7b, 0x57,
-    0x93, 0x5a, 0x4e, 0x90, 0xc9, 0x7b, 0xb2, 0x7f, 0xce, 0x94, 0x4f, 0x2a, 0x3b, 0x19, 0x01, 0x77,
-    0x6a, 0x00, 0x00, 0x03, 0x00, 0xb9, 0x00, 0x00, 0x04, 0xef, 0x05, 0xb0, 0x00, 0x03, 0x00, 0x07,
-    0x00, 0x0b, 0x00, 0x1b, 0x40, 0x0d, 0x09, 0x06, 0x08, 0x03, 0x02, 0x02, 0x06, 0x07, 0x02, 0x72,
-    0x06, 0x08, 0x72, 0x00, 0x2b, 0x2b, 0x11, 0x39, 0x2f, 0x33, 0x32, 0x11, 0x33, 0x30, 0x31, 0x41,
-    0x15, 0x21, 0x35, 0x13, 0x11, 0x23, 0x11, 0x21, 0x11, 0x23, 0x11, 0x04, 0x8c, 0xfc, 0x8c, 0x1c,
-    0x7b, 0x04, 0x36, 0x7b, 0x03, 0x23, 0x69, 0x69, 0x02, 0x8d, 0xfa, 0x50, 0x05, 0xb0, 0xfa, 0x50,
-    0x05, 0xb0, 0x00, 0x01, 0x00, 0xd4, 0x00, 0x00, 0x01, 0x4f, 0x05, 0xb0, 0x00, 0x03, 0x00, 0x0c,
-    0xb5, 0x00, 0x02, 0x72, 0x01, 0x08, 0x72, 0x00, 0x2b, 0x2b, 0x30, 0x31, 0x41, 0x11, 0x23, 0x11,
-    0x01, 0x4f, 0x7b, 0x05, 0xb0, 0xfa, 0x50, 0x05, 0xb0, 0x00, 0x00, 0x01, 0x00, 0x48, 0xff, 0xec,
-    0x03, 0xb7, 0x05, 0xb0, 0x00, 0x13, 0x00, 0x13, 0x40, 0x09, 0x10, 0x0c, 0x0c, 0x07, 0x09, 0x72,
-    0x02, 0x02, 0x72, 0x00, 0x2b, 0x2b, 0x32, 0x2f, 0x32, 0x30, 0x31, 0x41, 0x11, 0x33, 0x11, 0x14,
-    0x06, 0x06, 0x23, 0x22, 0x26, 0x26, 0x35, 0x33, 0x14, 0x16, 0x16, 0x33, 0x32, 0x36, 0x36, 0x03,
-    0x3c, 0x7b, 0x72, 0xc7, 0x7e, 0x83, 0xc7, 0x6e, 0x7b, 0x4b, 0x8e, 0x64, 0x58, 0x8f, 0x55, 0x01,
-    0xb2, 0x03, 0xfe, 0xfc, 0x02, 0x93, 0xca, 0x69, 0x5c, 0xbc, 0x8e, 0x69, 0x8d, 0x46, 0x4e, 0x9c,
-    0x00, 0x03, 0x00, 0xb9, 0x00, 0x00, 0x04, 0xe8, 0x05, 0xb0, 0x00, 0x03, 0x00, 0x09, 0x00, 0x0d,
-    0x00, 0x1c, 0x40, 0x10, 0x06, 0x07, 0x0b, 0x05, 0x0c, 0x08, 0x06, 0x02, 0x04, 0x03, 0x02, 0x72,
-    0x0a, 0x02, 0x08, 0x72, 0x00, 0x2b, 0x32, 0x2b, 0x32, 0x12, 0x17, 0x39, 0x30, 0x31, 0x41, 0x11,
-    0x23, 0x11, 0x21, 0x01, 0x01, 0x27, 0x13, 0x01, 0x13, 0x01, 0x37, 0x01, 0x01, 0x34, 0x7b, 0x04,
-    0x00, 0xfd, 0x8c, 0xfe, 0xc3, 0x0c, 0xfe, 0x02, 0x24, 0x34, 0xfd, 0x9b, 0x4a, 0x02, 0xb1, 0x05,
-    0xb0, 0xfa, 0x50, 0x05, 0xb0, 0xfd, 0x65, 0xfe, 0xc9, 0x8a, 0x01, 0x08, 0x02, 0x40, 0xfa, 0x50,
-    0x02, 0xec, 0x64, 0xfc, 0xb0, 0x00, 0x00, 0x02, 0x00, 0xb9, 0x00, 0x00, 0x04, 0x03, 0x05, 0xb0,
-    0x00, 0x03, 0x00, 0x07, 0x00, 0x15, 0x40, 0x0a, 0x03, 0x02, 0x02, 0x06, 0x07, 0x02, 0x72, 0x06,
-    0x08, 0x72, 0x00, 0x2b, 0x2b, 0x11, 0x33, 0x11, 0x33, 0x30, 0x31, 0x65, 0x15, 0x21, 0x35, 0x13,
-    0x11, 0x23, 0x11, 0x04, 0x03, 0xfd, 0x0d, 0x25, 0x7c, 0x6a, 0x6a, 0x6a, 0x05, 0x46, 0xfa, 0x50,
-    0x05, 0xb0, 0x00, 0x03, 0x00, 0xb9, 0x00, 0x00, 0x06, 0x33, 0x05, 0xb0, 0x00, 0x06, 0x00, 0x0b,
-    0x00, 0x10, 0x00, 0x1b, 0x40, 0x0d, 0x02, 0x07, 0x0e, 0x05, 0x0b, 0x08, 0x72, 0x0c, 0x04, 0x00,
-    0x07, 0x02, 0x72, 0x00, 0x2b, 0x32, 0x32, 0x32, 0x2b, 0x32, 0x32, 0x11, 0x39, 0x30, 0x31, 0x53,
-    0x33, 0x01, 0x01, 0x33, 0x01, 0x23, 0x01, 0x33, 0x13, 0x11, 0x23, 0x01, 0x33, 0x11, 0x23, 0x11,
-    0xdf, 0x7c, 0x02, 0x1a, 0x02, 0x1b, 0x7c, 0xfd, 0x98, 0x5e, 0xfd, 0x73, 0x6d, 0x0e, 0x7b, 0x05,
-    0x0d, 0x6d, 0x7b, 0x05, 0xb0, 0xfa, 0xfe, 0x05, 0x02, 0xfa, 0x50, 0x05, 0xb0, 0xfc, 0xcc, 0xfd,
-    0x84, 0x05, 0xb0, 0xfa, 0x50, 0x02, 0x7c, 0x00, 0x00, 0x01, 0x00, 0xb9, 0x00, 0x00, 0x04, 0xf5,
-    0x05, 0xb0, 0x00, 0x09, 0x00, 0x17, 0x40, 0x0b, 0x03, 0x08, 0x05, 0x09, 0x07, 0x02, 0x72, 0x02,
-    0x05, 0x08, 0x72, 0x00, 0x2b, 0x32, 0x2b, 0x32, 0x12, 0x39, 0x39, 0x30, 0x31, 0x41, 0x11, 0x23,
-    0x01, 0x11, 0x23, 0x11, 0x33, 0x01, 0x11, 0x04, 0xf5, 0x7c, 0xfc, 0xbc, 0x7c, 0x7c, 0x03, 0x46,
-    0x05, 0xb0, 0xfa, 0x50, 0x04, 0xdc, 0xfb, 0x24, 0x05, 0xb0, 0xfb, 0x25, 0x04, 0xdb, 0x00, 0x02,
-    0x00, 0x7e, 0xff, 0xec, 0x04, 0xed, 0x05, 0xc4, 0x00, 0x15, 0x00, 0x2b, 0x00, 0x13, 0x40, 0x09,
-    0x27, 0x06, 0x1c, 0x11, 0x03, 0x72, 0x06, 0x09, 0x72, 0x00, 0x2b, 0x2b, 0x32, 0x11, 0x33, 0x30,
-    0x31, 0x41, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x35, 0x34, 0x3e, 0x02, 0x33,
-    0x32, 0x1e, 0x02, 0x03, 0x35, 0x34, 0x2e, 0x02, 0x23, 0x22, 0x0e, 0x02, 0x15, 0x15, 0x14, 0x1e,
-    0x02, 0x33, 0x32, 0x3e, 0x02, 0x04, 0xed, 0x50, 0x94, 0xd1, 0x81, 0x7f, 0xd1, 0x97, 0x52, 0x51,
-    0x96, 0xd1, 0x7f, 0x81, 0xd1, 0x96, 0x50, 0x7b, 0x3b, 0x73, 0xa6, 0x69, 0x68, 0xa4, 0x73, 0x3d,
-    0x3e, 0x74, 0xa4, 0x68, 0x6a, 0xa4, 0x72, 0x3b, 0x03, 0x26, 0x9b, 0x99, 0xf8, 0xb0, 0x5e, 0x5e,
-    0xb0, 0xf8, 0x99, 0x9b, 0x99, 0xf7, 0xb0, 0x5e, 0x5e, 0xb0, 0xf7, 0xfe, 0xcc, 0x9d, 0x81, 0xce,
-    0x92, 0x4e, 0x4e, 0x92, 0xce, 0x81, 0x9d, 0x82, 0xd0, 0x92, 0x4e, 0x4e, 0x92, 0xd0, 0x00, 0x01,
-    0x00, 0xb9, 0x00, 0x00, 0x04, 0x93, 0x05, 0xb0, 0x00, 0x17, 0x00, 0x17, 0x40, 0x0b, 0x02, 0x01,
-    0x01, 0x0e, 0x0c, 0x0f, 0x02, 0x72, 0x0e, 0x08, 0x72, 0x00, 0x2b, 0x2b, 0x32, 0x11, 0x39, 0x2f,
-    0x33, 0x30, 0x31, 0x41, 0x21, 0x35, 0x21, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x21,
-    0x11, 0x23, 0x11, 0x21, 0x32, 0x16, 0x16, 0x15, 0x14, 0x06, 0x06, 0x02, 0xa9, 0xfe, 0x60, 0x01,
-    0xa0, 0x82, 0xa2, 0x4b, 0x4b, 0xa2, 0x82, 0xfe, 0x8b, 0x7b, 0x01, 0xf0, 0xa0, 0xda, 0x70, 0x6f,
-    0xdb, 0x02, 0x51, 0x6a, 0x54, 0x92, 0x5b, 0x59, 0x96, 0x5b, 0xfa, 0xba, 0x05, 0xb0, 0x6e, 0xc4,
-    0x80, 0x86, 0xc1, 0x66, 0x00, 0x03, 0x00, 0x7a, 0xff, 0x02, 0x04, 0xe8, 0x05, 0xc4, 0x00, 0x03,
-    0x00, 0x19, 0x00, 0x2f, 0x00, 0x19, 0x40, 0x0c, 0x20, 0x15, 0x03, 0x72, 0x00, 0x2b, 0x2b, 0x03,
-    0x0a, 0x09, 0x72, 0x02, 0x00, 0x2f, 0x2b, 0x32, 0x32, 0x11, 0x33, 0x2b, 0x32, 0x30, 0x31, 0x65,
-    0x01, 0x07, 0x01, 0x01, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x35, 0x34, 0x3e,
-    0x02, 0x33, 0x32, 0x1e, 0x02, 0x03, 0x35, 0x34, 0x2e, 0x02, 0x23, 0x22, 0x0e, 0x02, 0x15, 0x15,
-    0x14, 0x1e, 0x02, 0x33, 0x32, 0x3e, 0x02, 0x03, 0x89, 0x01, 0x4e, 0x55, 0xfe, 0xb5, 0x01, 0xb1,
-    0x4f, 0x95, 0xd0, 0x82, 0x7f, 0xd1, 0x97, 0x51, 0x51, 0x96, 0xd0, 0x7f, 0x82, 0xd1, 0x95, 0x50,
-    0x7a, 0x3c, 0x73, 0xa5, 0x6a, 0x67, 0xa4, 0x73, 0x3d, 0x3d, 0x74, 0xa5, 0x67, 0x6a, 0xa5, 0x72,
-    0x3b, 0x73, 0xfe, 0xdc, 0x4d, 0x01, 0x20, 0x03, 0x04, 0x9b, 0x99, 0xf8, 0xb0, 0x5e, 0x5e, 0xb0,
-    0xf8, 0x99, 0x9b, 0x99, 0xf7, 0xb0, 0x5e, 0x5e, 0xb0, 0xf7, 0xfe, 0xcc, 0x9d, 0x81, 0xce, 0x92,
-    0x4e, 0x4e, 0x92, 0xce, 0x81, 0x9d, 0x82, 0xd0, 0x92, 0x4e, 0x4e, 0x92, 0xd0, 0x00, 0x00, 0x02,
-    0x00, 0xb6, 0x00, 0x00, 0x04, 0xbc, 0x05, 0xb0, 0x00, 0x18, 0x00, 0x1d, 0x00, 0x23, 0x40, 0x12,
-    0x1b, 0x1a, 0x09, 0x03, 0x0c, 0x0c, 0x0b, 0x0b, 0x00, 0x1c, 0x19, 0x18, 0x08, 0x72, 0x16, 0x00,
-    0x02, 0x72, 0x00, 0x2b, 0x32, 0x2b, 0x32, 0x32, 0x12, 0x39, 0x2f, 0x33, 0x12, 0x17, 0x39, 0x30,
-    0x31, 0x53, 0x21, 0x32, 0x16, 0x16, 0x15, 0x14, 0x06, 0x06, 0x07, 0x07, 0x21, 0x27, 0x21, 0x32,
-    0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x21, 0x11, 0x23, 0x21, 0x01, 0x37, 0x01, 0x15, 0xb6,
-    0x01, 0xd9, 0x98, 0xdd, 0x79, 0x56, 0x99, 0x64, 0x2a, 0xfe, 0x07, 0x02, 0x01, 0xa6, 0x72, 0x98,
-    0x4d, 0x55, 0xa6, 0x78, 0xfe, 0xa3, 0x7c, 0x03, 0x83, 0xfe, 0x87, 0x84, 0x01, 0x78, 0x05, 0xb0,
-    0x62, 0xbf, 0x8b, 0x67, 0xa8, 0x71, 0x15, 0x10, 0x69, 0x59, 0x90, 0x53, 0x63, 0x91, 0x4e, 0xfa,
-    0xba, 0x02, 0x8b, 0x02, 0xfd, 0x80, 0x0d, 0x00, 0x00, 0x01, 0x00, 0x59, 0xff, 0xec, 0x04, 0x6d,
-    0x05, 0xc4, 0x00, 0x39, 0x00, 0x1f, 0x40, 0x0f, 0x0a, 0x26, 0x0f, 0x36, 0x31, 0x31, 0x2b, 0x09,
-    0x72, 0x18, 0x14, 0x14, 0x0f, 0x03, 0x72, 0x00, 0x2b, 0x32, 0x2f, 0x32, 0x2b, 0x32, 0x2f, 0x32,
-    0x11, 0x39, 0x39, 0x30, 0x31, 0x41, 0x34, 0x2e, 0x02, 0x27, 0x2e, 0x03, 0x35, 0x34, 0x3e, 0x02,
-    0x33, 0x32, 0x16, 0x16, 0x15, 0x23, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x15, 0x14, 0x1e,
-    0x02, 0x17, 0x1e, 0x03, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x33, 0x14, 0x1e,
-    0x02, 0x33, 0x32, 0x36, 0x36, 0x03, 0xf1, 0x28, 0x5b, 0x99, 0x72, 0x6d, 0xb0, 0x7d, 0x42, 0x48,
-    0x83, 0xb3, 0x6b, 0x99, 0xe0, 0x7a, 0x7b, 0x59, 0xa7, 0x78, 0x78, 0xa3, 0x52, 0x28, 0x5a, 0x97,
-    0x6e, 0x74, 0xb3, 0x7c, 0x40, 0x4a, 0x87, 0xb7, 0x6d, 0x61, 0xc0, 0x9f, 0x5f, 0x7b, 0x4a, 0x7b,
-    0x95, 0x4a, 0x73, 0xa9, 0x5d, 0x01, 0x67, 0x3c, 0x5d, 0x4b, 0x41, 0x20, 0x1f, 0x4a, 0x60, 0x81,
-    0x56, 0x54, 0x8a, 0x64, 0x36, 0x74, 0xc5, 0x7a, 0x5f, 0x95, 0x55, 0x49, 0x79, 0x4a, 0x34, 0x57,
-    0x4b, 0x40, 0x1e, 0x1f, 0x4e, 0x66, 0x86, 0x58, 0x59, 0x8d, 0x63, 0x34, 0x32, 0x6a, 0xa5, 0x74,
-    0x5c, 0x7f, 0x4d, 0x23, 0x44, 0x7b, 0x00, 0x02, 0x00, 0x35, 0x00, 0x00, 0x04, 0x94, 0x05, 0xb0,
-    0x00, 0x03, 0x00, 0x07, 0x00, 0x15, 0x40, 0x0a, 0x00, 0x03, 0x03, 0x06, 0x07, 0x02, 0x72, 0x01,
-    0x08, 0x72, 0x00, 0x2b, 0x2b, 0x32, 0x32, 0x11, 0x33, 0x30, 0x31, 0x41, 0x11, 0x23, 0x11, 0x21,
-    0x15, 0x21, 0x35, 0x02, 0xa1, 0x7a, 0x02, 0x6d, 0xfb, 0xa1, 0x05, 0xb0, 0xfa, 0x50, 0x05, 0xb0,
-    0x6a, 0x6a, 0x00, 0x01, 0x00, 0xa3, 0xff, 0xec, 0x04, 0xa3, 0x05, 0xb0, 0x00, 0x15, 0x00, 0x13,
-    0x40, 0x09, 0x01, 0x11, 0x06, 0x0b, 0x02, 0x72, 0x06, 0x09, 0x72, 0x00, 0x2b, 0x2b, 0x11, 0x33,
-    0x32, 0x30, 0x31, 0x41, 0x33, 0x11, 0x14, 0x06, 0x06, 0x23, 0x22, 0x26, 0x26, 0x35, 0x11, 0x33,
-    0x11, 0x14, 0x16, 0x16, 0x33, 0x32, 0x36, 0x36, 0x35, 0x04, 0x28, 0x7b, 0x8a, 0xe9, 0x8d, 0x91,
-    0xe8, 0x87, 0x7a, 0x65, 0xb0, 0x71, 0x71, 0xb0, 0x64, 0x05, 0xb0, 0xfc, 0x26, 0xa3, 0xda, 0x6d,
-    0x6d, 0xda, 0xa3, 0x03, 0xda, 0xfc, 0x26, 0x7f, 0xab, 0x56, 0x56, 0xab, 0x7f, 0x00, 0x00, 0x02,
-    0x00, 0x20, 0x00, 0x00, 0x04, 0xd1, 0x05, 0xb0, 0x00, 0x04, 0x00, 0x09, 0x00, 0x17, 0x40, 0x0b,
-    0x00, 0x06, 0x08, 0x01, 0x09, 0x02, 0x72, 0x03, 0x08, 0x08, 0x72, 0x00, 0x2b, 0x32, 0x2b, 0x32,
-    0x12, 0x39, 0x39, 0x30, 0x31, 0x65, 0x01, 0x33, 0x01, 0x23, 0x01, 0x01, 0x17, 0x23, 0x01, 0x02,
-    0x80, 0x01, 0xcb, 0x86, 0xfd, 0xe3, 0x64, 0xfe, 0x56, 0x01, 0xc9, 0x32, 0x64, 0xfd, 0xe3, 0xb6,
-    0x04, 0xfa, 0xfa, 0x50, 0x05, 0xb0, 0xfb, 0x06, 0xb6, 0x05, 0xb0, 0x00, 0x00, 0x04, 0x00, 0x3d,
-    0x00, 0x00, 0x06, 0xf7, 0x05, 0xb0, 0x00, 0x05, 0x00, 0x0a, 0x00, 0x0f, 0x00, 0x15, 0x00, 0x1b,
-    0x40, 0x0d, 0x10, 0x0c, 0x01, 0x0a, 0x02, 0x72, 0x13, 0x12, 0x0e, 0x04, 0x09, 0x08, 0x72, 0x00,
-    0x2b, 0x32, 0x32, 0x32, 0x32, 0x2b, 0x32, 0x32, 0x32, 0x30, 0x31, 0x41, 0x01, 0x33, 0x03, 0x01,
-    0x23, 0x01, 0x01, 0x13, 0x23, 0x09, 0x02, 0x33, 0x01, 0x23, 0x01, 0x01, 0x13, 0x23, 0x01, 0x03,
-    0x02, 0x2a, 0x01, 0x3c, 0x63, 0x4f, 0xfe, 0xae, 0x5f, 0xfe, 0xf2, 0x01, 0x0a, 0x50, 0x63, 0xfe,
-    0x8b, 0x05, 0x36, 0x01, 0x06, 0x7e, 0xfe, 0x8c, 0x63, 0xfe, 0xb5, 0x01, 0x37, 0x60, 0x5f, 0xfe,
-    0xb6, 0x51, 0x01, 0x81, 0x04, 0x2f, 0xfe, 0xc2, 0xfb, 0x8e, 0x05, 0xb0, 0xfb, 0xdb, 0xfe, 0x75,
-    0x05, 0xb0, 0xfb, 0xdc, 0x04, 0x24, 0xfa, 0x50, 0x05, 0xb0, 0xfb, 0xd1, 0xfe, 0x7f, 0x04, 0x72,
-    0x01, 0x3e, 0x00, 0x01, 0x00, 0x38, 0x00, 0x00, 0x04, 0xaf, 0x05, 0xb0, 0x00, 0x0b, 0x00, 0x1a,
-    0x40, 0x0e, 0x07, 0x04, 0x0a, 0x01, 0x04, 0x09, 0x03, 0x0b, 0x02, 0x72, 0x06, 0x09, 0x08, 0x72,
-    0x00, 0x2b, 0x32, 0x2b, 0x32, 0x12, 0x17, 0x39, 0x30, 0x31, 0x53, 0x01, 0x01, 0x33, 0x01, 0x01,
-    0x23, 0x01, 0x01, 0x23, 0x01, 0x01, 0xda, 0x01, 0x9a, 0x01, 0x9a, 0x92, 0xfe, 0x1e, 0x01, 0xf1,
-    0x93, 0xfe, 0x58, 0xfe, 0x56, 0x92, 0x01, 0xf1, 0xfe, 0x1e, 0x05, 0xb0, 0xfd, 0x9a, 0x02, 0x66,
-    0xfd, 0x33, 0xfd, 0x1d, 0x02, 0x7b, 0xfd, 0x85, 0x02, 0xe3, 0x02, 0xcd, 0x00, 0x01, 0x00, 0x18,
-    0x00, 0x00, 0x04, 0xaf, 0x05, 0xb0, 0x00, 0x08, 0x00, 0x17, 0x40, 0x0c, 0x04, 0x07, 0x01, 0x03,
-    0x06, 0x03, 0x08, 0x02, 0x72, 0x06, 0x08, 0x72, 0x00, 0x2b, 0x2b, 0x32, 0x12, 0x17, 0x39, 0x30,
-    0x31, 0x53, 0x01, 0x01, 0x33, 0x01, 0x11, 0x23, 0x11, 0x01, 0xab, 0x01, 0xb9, 0x01, 0xbc, 0x8f,
-    0xfd, 0xf2, 0x7b, 0xfd, 0xf2, 0x05, 0xb0, 0xfc, 0xe8, 0x03, 0x18, 0xfc, 0x75, 0xfd, 0xdb, 0x02,
-    0x25, 0x03, 0x8b, 0x00, 0x00, 0x03, 0x00, 0x5b, 0x00, 0x00, 0x04, 0x72, 0x05, 0xb0, 0x00, 0x03,
-    0x00, 0x09, 0x00, 0x0d, 0x00, 0x1f, 0x40, 0x0f, 0x04, 0x0c, 0x0c, 0x09, 0x0d, 0x02, 0x72, 0x07,
-    0x03, 0x03, 0x02, 0x02, 0x06, 0x08, 0x72, 0x00, 0x2b, 0x32, 0x11, 0x33, 0x11, 0x33, 0x2b, 0x32,
-    0x32, 0x11, 0x33, 0x30, 0x31, 0x65, 0x15, 0x21, 0x35, 0x01, 0x01, 0x23, 0x35, 0x01, 0x33, 0x23,
-    0x15, 0x21, 0x35, 0x04, 0x72, 0xfc, 0x16, 0x03, 0xca, 0xfc, 0x57, 0x4e, 0x03, 0xa8, 0x4f, 0x36,
-    0xfc, 0x59, 0x6a, 0x6a, 0x6a, 0x04, 0xed, 0xfa, 0xa9, 0x5e, 0x05, 0x52, 0x69, 0x69, 0x00, 0x01,
-    0x00, 0xa4, 0xfe, 0xc8, 0x01, 0xee, 0x06, 0x80, 0x00, 0x07, 0x00, 0x0e, 0xb4, 0x03, 0x06, 0x02,
-    0x07, 0x06, 0x00, 0x2f, 0x2f, 0x33, 0x11, 0x33, 0x30, 0x31, 0x41, 0x15, 0x23, 0x11, 0x33, 0x15,
-    0x21, 0x11, 0x01, 0xee, 0xd2, 0xd2, 0xfe, 0xb6, 0x06, 0x80, 0x67, 0xf9, 0x16, 0x67, 0x07, 0xb8,
-    0x00, 0x01, 0x00, 0x31, 0xff, 0x83, 0x03, 0x06, 0x05, 0xb0, 0x00, 0x03, 0x00, 0x09, 0xb2, 0x01,
-    0x02, 0x00, 0x00, 0x2f, 0x3f, 0x30, 0x31, 0x45, 0x01, 0x33, 0x01, 0x02, 0x91, 0xfd, 0xa0, 0x75,
-    0x02, 0x60, 0x7d, 0x06, 0x2d, 0xf9, 0xd3, 0x00, 0x00, 0x01, 0x00, 0x01, 0xfe, 0xc8, 0x01, 0x4c,
-    0x06, 0x80, 0x00, 0x07, 0x00, 0x0e, 0xb4, 0x05, 0x04, 0x00, 0x01, 0x04, 0x00, 0x2f, 0x2f, 0x33,
-    0x11, 0x33, 0x30, 0x31, 0x53, 0x35, 0x21, 0x11, 0x21, 0x35, 0x33, 0x11, 0x01, 0x01, 0x4b, 0xfe,
-    0xb5, 0xd2, 0x06, 0x19, 0x67, 0xf8, 0x48, 0x67, 0x06, 0xea, 0x00, 0x02, 0x00, 0x4e, 0x02, 0xd9,
-    0x02, 0xfd, 0x05, 0xb0, 0x00, 0x04, 0x00, 0x09, 0x00, 0x16, 0x40, 0x09, 0x08, 0x07, 0x07, 0x06,
-    0x00, 0x05, 0x02, 0x03, 0x02, 0x00, 0x3f, 0xcd, 0x32, 0x39, 0x39, 0x33, 0x11, 0x33, 0x30, 0x31,
-    0x41, 0x03, 0x23, 0x01, 0x33, 0x13, 0x03, 0x27, 0x33, 0x01, 0x01, 0xb3, 0xf2, 0x73, 0x01, 0x2b,
-    0x50, 0xc0, 0xf0, 0x17, 0x51, 0x01, 0x2a, 0x05, 0x32, 0xfd, 0xa7, 0x02, 0xd7, 0xfd, 0x29, 0x02,
-    0x59, 0x7e, 0xfd, 0x29, 0x00, 0x01, 0x00, 0x02, 0xff, 0x99, 0x03, 0x73, 0x00, 0x00, 0x00, 0x03,
-    0x00, 0x08, 0xb1, 0x02, 0x03, 0x00, 0x2f, 0x33, 0x30, 0x31, 0x61, 0x15, 0x21, 0x35, 0x03, 0x73,
-    0xfc, 0x8f, 0x67, 0x67, 0x00, 0x01, 0x00, 0x67, 0x04, 0xe8, 0x01, 0xb7, 0x06, 0x00, 0x00, 0x03,
-    0x00, 0x0a, 0xb2, 0x03, 0x80, 0x02, 0x00, 0x2f, 0x1a, 0xcd, 0x30, 0x31, 0x53, 0x13, 0x23, 0x03,
-    0xf8, 0xbf, 0x6d, 0xe3, 0x06, 0x00, 0xfe, 0xe8, 0x01, 0x18, 0x00, 0x02, 0x00, 0x65, 0xff, 0xec,
-    0x03, 0xc8, 0x04, 0x4e, 0x00, 0x1b, 0x00, 0x3a, 0x00, 0x29, 0x40, 0x15, 0x2b, 0x2c, 0x1e, 0x27,
-    0x1e, 0x3a, 0x3a, 0x0f, 0x27, 0x31, 0x0b, 0x72, 0x18, 0x19, 0x0a, 0x72, 0x09, 0x05, 0x0f, 0x07,
-    0x72, 0x00, 0x2b, 0x32, 0x32, 0x2b, 0x32, 0x2b, 0x32, 0x12, 0x39, 0x2f, 0x33, 0x11, 0x12, 0x39,
-    0x39, 0x30, 0x31, 0x65, 0x11, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x15, 0x27, 0x34, 0x3e,
-    0x02, 0x33, 0x32, 0x16, 0x16, 0x15, 0x11, 0x14, 0x16, 0x17, 0x15, 0x23, 0x26, 0x26, 0x13, 0x17,
-    0x23, 0x22, 0x0e, 0x02, 0x15, 0x14, 0x16, 0x16, 0x33, 0x32, 0x36, 0x36, 0x37, 0x17, 0x0e, 0x03,
-    0x23, 0x22, 0x26, 0x26, 0x35, 0x34, 0x3e, 0x02, 0x33, 0x03, 0x2f, 0x40, 0x7c, 0x5b, 0x54, 0x83,
-    0x4b, 0x77, 0x3b, 0x6e, 0x99, 0x5d, 0x73, 0xb1, 0x65, 0x11, 0x10, 0x80, 0x0c, 0x0d, 0x1c, 0x02,
-    0xea, 0x5c, 0x91, 0x64, 0x35, 0x3a, 0x6e, 0x4b, 0x63, 0x99, 0x64, 0x11, 0x34, 0x0d, 0x45, 0x6d,
-    0x95, 0x5f, 0x69, 0x9e, 0x56, 0x44, 0x80, 0xb7, 0x72, 0xc2, 0x02, 0x2e, 0x4d, 0x70, 0x3c, 0x3b,
-    0x63, 0x3c, 0x01, 0x3d, 0x72, 0x5a, 0x35, 0x4e, 0x9c, 0x76, 0xfd, 0xf5, 0x38, 0x78, 0x26, 0x0d,
-    0x24, 0x6d, 0x01, 0xe5, 0x5c, 0x21, 0x3e, 0x59, 0x38, 0x3a, 0x60, 0x38, 0x49, 0x78, 0x47, 0x45,
-    0x31, 0x6a, 0x5b, 0x39, 0x51, 0x8b, 0x58, 0x4f, 0x7f, 0x59, 0x2f, 0x00, 0x00, 0x03, 0x00, 0x9b,
-    0xff, 0xec, 0x04, 0x04, 0x06, 0x00, 0x00, 0x04, 0x00, 0x1a, 0x00, 0x2f, 0x00, 0x19, 0x40, 0x0e,
-    0x21, 0x16, 0x07, 0x72, 0x2b, 0x0b, 0x0b, 0x72, 0x04, 0x0a, 0x72, 0x00, 0x00, 0x72, 0x00, 0x2b,
-    0x2b, 0x2b, 0x32, 0x2b, 0x32, 0x30, 0x31, 0x53, 0x33, 0x11, 0x07, 0x23, 0x01, 0x15, 0x14, 0x0e,
-    0x02, 0x23, 0x22, 0x2e, 0x02, 0x27, 0x11, 0x3e, 0x03, 0x33, 0x32, 0x1e, 0x02, 0x07, 0x35, 0x34,
-    0x2e, 0x02, 0x23, 0x22, 0x0e, 0x02, 0x07, 0x11, 0x1e, 0x02, 0x33, 0x32, 0x3e, 0x02, 0x9b, 0x78,
-    0x08, 0x70, 0x03, 0x69, 0x37, 0x6a, 0x9a, 0x62, 0x61, 0x96, 0x6a, 0x41, 0x0c, 0x0f, 0x42, 0x69,
-    0x93, 0x5f, 0x63, 0x9b, 0x6a, 0x37, 0x79, 0x24, 0x4d, 0x78, 0x54, 0x56, 0x78, 0x4f, 0x2e, 0x0b,
-    0x11, 0x54, 0x8d, 0x66, 0x52, 0x77, 0x4d, 0x25, 0x06, 0x00, 0xfa, 0xd2, 0xd2, 0x02, 0x27, 0x15,
-    0x79, 0xc9, 0x93, 0x51, 0x3e, 0x70, 0x9a, 0x5b, 0x01, 0x0b, 0x62, 0xa0, 0x74, 0x3e, 0x4d, 0x91,
-    0xcb, 0x93, 0x15, 0x5f, 0xa2, 0x79, 0x44, 0x39, 0x5d, 0x6e, 0x35, 0xfe, 0xca, 0x4c, 0x83, 0x51,
-    0x43, 0x79, 0xa2, 0x00, 0x00, 0x01, 0x00, 0x5f, 0xff, 0xec, 0x03, 0xcd, 0x04, 0x4e, 0x00, 0x27,
-    0x00, 0x19, 0x40, 0x0c, 0x1d, 0x19, 0x19, 0x14, 0x07, 0x72, 0x04, 0x04, 0x00, 0x09, 0x0b, 0x72,
-    0x00, 0x2b, 0x32, 0x32, 0x2f, 0x2b, 0x32, 0x2f, 0x32, 0x30, 0x31, 0x65, 0x32, 0x36, 0x36, 0x37,
-    0x33, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x35, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x16, 0x16,
-    0x17, 0x23, 0x2e, 0x02, 0x23, 0x22, 0x0e, 0x02, 0x15, 0x15, 0x14, 0x1e, 0x02, 0x02, 0x2d, 0x4b,
-    0x85, 0x57, 0x06, 0x73, 0x05, 0x74, 0xb9, 0x6e, 0x72, 0xad, 0x74, 0x3b, 0x3b, 0x74, 0xac, 0x72,
-    0x74, 0xb8, 0x70, 0x05, 0x73, 0x05, 0x52, 0x86, 0x51, 0x5c, 0x83, 0x51, 0x25, 0x25, 0x51, 0x83,
-    0x53, 0x3a, 0x70, 0x52, 0x67, 0xa0, 0x5c, 0x53, 0x93, 0xc4, 0x72, 0x2a, 0x72, 0xc5, 0x93, 0x52,
-    0x5e, 0xac, 0x76, 0x57, 0x7e, 0x44, 0x47, 0x7b, 0x9d, 0x56, 0x2a, 0x56, 0x9d, 0x7b, 0x47, 0x00,
-    0x00, 0x03, 0x00, 0x6d, 0xff, 0xec, 0x03, 0xd4, 0x06, 0x00, 0x00, 0x04, 0x00, 0x1a, 0x00, 0x2f,
-    0x00, 0x19, 0x40, 0x0d, 0x21, 0x04, 0x04, 0x16, 0x0b, 0x72, 0x2b, 0x0b, 0x07, 0x72, 0x01, 0x00,
-    0x72, 0x00, 0x2b, 0x2b, 0x32, 0x2b, 0x32, 0x2f, 0x32, 0x30, 0x31, 0x65, 0x11, 0x33, 0x11, 0x23,
-    0x01, 0x35, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x1e, 0x02, 0x17, 0x11, 0x0e, 0x03, 0x23, 0x22, 0x2e,
-    0x02, 0x37, 0x15, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x36, 0x36, 0x37, 0x11, 0x2e, 0x03, 0x23, 0x22,
-    0x0e, 0x02, 0x03, 0x5c, 0x78, 0x70, 0xfd, 0x09, 0x3a, 0x6d, 0x9a, 0x61, 0x5f, 0x92, 0x69, 0x41,
-    0x0f, 0x0c, 0x40, 0x6a, 0x95, 0x61, 0x60, 0x9a, 0x6c, 0x3a, 0x79, 0x26, 0x4e, 0x78, 0x51, 0x67,
-    0x8c, 0x54, 0x13, 0x0c, 0x2e, 0x4f, 0x79, 0x56, 0x52, 0x79, 0x4e, 0x26, 0xd2, 0x05, 0x2e, 0xfa,
-    0x00, 0x02, 0x12, 0x15, 0x7e, 0xcb, 0x91, 0x4d, 0x3e, 0x74, 0xa0, 0x62, 0xfe, 0xf5, 0x5b, 0x9a,
-    0x70, 0x3e, 0x51, 0x93, 0xc9, 0x8e, 0x15, 0x5e, 0xa2, 0x79, 0x43, 0x4f, 0x83, 0x4e, 0x01, 0x36,
-    0x35, 0x6e, 0x5d, 0x39, 0x44, 0x79, 0xa2, 0x00, 0x00, 0x01, 0x00, 0x5a, 0xff, 0xec, 0x03, 0xd6,
-    0x04, 0x4e, 0x00, 0x2b, 0x00, 0x1f, 0x40, 0x10, 0x67, 0x13, 0x01, 0x06, 0x13, 0x12, 0x12, 0x00,
-    0x19, 0x0b, 0x07, 0x72, 0x24, 0x00, 0x0b, 0x72, 0x00, 0x2b, 0x32, 0x2b, 0x32, 0x11, 0x39, 0x2f,
-    0x33, 0x5f, 0x5d, 0x30, 0x31, 0x45, 0x22, 0x2e, 0x02, 0x35, 0x35, 0x34, 0x3e, 0x02, 0x33, 0x32,
-    0x1e, 0x02, 0x15, 0x15, 0x21, 0x35, 0x21, 0x35, 0x2e, 0x02, 0x23, 0x22, 0x0e, 0x02, 0x15, 0x15,
-    0x14, 0x1e, 0x02, 0x33, 0x32, 0x36, 0x37, 0x17, 0x0e, 0x02, 0x02, 0x40, 0x6a, 0xb2, 0x82, 0x48,
-    0x4b, 0x81, 0xa7, 0x5d, 0x67, 0x9f, 0x6e, 0x38, 0xfc, 0xcd, 0x02, 0xbb, 0x02, 0x45, 0x87, 0x66,
-    0x4d, 0x7e, 0x5b, 0x32, 0x36, 0x62, 0x88, 0x53, 0x5f, 0x95, 0x3b, 0x4b, 0x24, 0x68, 0x92, 0x14,
-    0x4e, 0x8e, 0xc3, 0x74, 0x2b, 0x7d, 0xca, 0x91, 0x4c, 0x49, 0x85, 0xb5, 0x6d, 0x49, 0x67, 0x0d,
-    0x5b, 0x9f, 0x64, 0x40, 0x77, 0xa3, 0x63, 0x2b, 0x59, 0x9c, 0x75, 0x43, 0x47, 0x4d, 0x3a, 0x34,
-    0x57, 0x35, 0x00, 0x02, 0x00, 0x40, 0x00, 0x00, 0x02, 0xb2, 0x06, 0x15, 0x00, 0x11, 0x00, 0x15,
-    0x00, 0x15, 0x40, 0x0b, 0x14, 0x15, 0x06, 0x72, 0x0d, 0x06, 0x01, 0x72, 0x01, 0x0a, 0x72, 0x00,
-    0x2b, 0x2b, 0x32, 0x2b, 0x32, 0x30, 0x31, 0x61, 0x23, 0x11, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16,
-    0x17, 0x07, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x15, 0x05, 0x15, 0x21, 0x35, 0x01, 0x6b, 0x78,
-    0x4d, 0x8f, 0x63, 0x20, 0x41, 0x1f, 0x09, 0x18, 0x34, 0x21, 0x41, 0x5e, 0x32, 0x01, 0x02, 0xfd,
-    0xd3, 0x04, 0xc0, 0x6f, 0x98, 0x4e, 0x07, 0x09, 0x66, 0x07, 0x05, 0x37, 0x68, 0x4c, 0x86, 0x62,
-    0x62, 0x00, 0x00, 0x03, 0x00, 0x6d, 0xfe, 0x51, 0x03, 0xd4, 0x04, 0x4e, 0x00, 0x13, 0x00, 0x29,
-    0x00, 0x3e, 0x00, 0x1b, 0x40, 0x0f, 0x30, 0x25, 0x0b, 0x72, 0x3a, 0x1a, 0x07, 0x72, 0x0e, 0x06,
-    0x0f, 0x72, 0x00, 0x06, 0x72, 0x00, 0x2b, 0x2b, 0x32, 0x2b, 0x32, 0x2b, 0x32, 0x30, 0x31, 0x41,
-    0x33, 0x11, 0x14, 0x06, 0x06, 0x23, 0x22, 0x26, 0x26, 0x27, 0x37, 0x16, 0x16, 0x33, 0x32, 0x36,
-    0x36, 0x35, 0x11, 0x01, 0x35, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x1e, 0x02, 0x17, 0x11, 0x0e, 0x03,
-    0x23, 0x22, 0x2e, 0x02, 0x37, 0x15, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x36, 0x36, 0x37, 0x11, 0x2e,
-    0x03, 0x23, 0x22, 0x0e, 0x02, 0x03, 0x65, 0x6f, 0x6b, 0xc3, 0x83, 0x44, 0x8d, 0x7d, 0x2c, 0x44,
-    0x41, 0x96, 0x57, 0x67, 0x8f, 0x4b, 0xfd, 0x11, 0x39, 0x6c, 0x9b, 0x62, 0x5f, 0x92, 0x69, 0x41,
-    0x0f, 0x0c, 0x40, 0x6a, 0x95, 0x61, 0x61, 0x9a, 0x6c, 0x39, 0x78, 0x26, 0x4e, 0x78, 0x52, 0x67,
-    0x8b, 0x52, 0x13, 0x0b, 0x2d, 0x4f, 0x78, 0x56, 0x53, 0x79, 0x4e, 0x26, 0x04, 0x3a, 0xfb, 0xd9,
-    0x8c, 0xcb, 0x6b, 0x28, 0x53, 0x3e, 0x49, 0x51, 0x4b, 0x52, 0x9a, 0x6c, 0x03, 0x3d, 0xfe, 0xc6,
-    0x15, 0x7e, 0xcb, 0x91, 0x4d, 0x3e, 0x74, 0xa0, 0x62, 0xfe, 0xf5, 0x5b, 0x9a, 0x70, 0x3e, 0x51,
-    0x93, 0xc9, 0x8e, 0x15, 0x5e, 0xa2, 0x79, 0x43, 0x4f, 0x83, 0x4e, 0x01, 0x36, 0x35, 0x6e, 0x5d,
-    0x39, 0x44, 0x79, 0xa2, 0x00, 0x02, 0x00, 0x9d, 0x00, 0x00, 0x03, 0xcd, 0x06, 0x00, 0x00, 0x03,
-    0x00, 0x1a, 0x00, 0x17, 0x40, 0x0c, 0x11, 0x02, 0x16, 0x0a, 0x07, 0x72, 0x03, 0x00, 0x72, 0x02,
-    0x0a, 0x72, 0x00, 0x2b, 0x2b, 0x2b, 0x32, 0x11, 0x33, 0x30, 0x31, 0x41, 0x11, 0x23, 0x11, 0x13,
-    0x27, 0x3e, 0x03, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x11, 0x23, 0x11, 0x34, 0x26, 0x26, 0x23, 0x22,
-    0x0e, 0x02, 0x01, 0x14, 0x77, 0x5d, 0x35, 0x05, 0x42, 0x71, 0x9a, 0x5d, 0x51, 0x80, 0x59, 0x2f,
-    0x78, 0x3e, 0x72, 0x4e, 0x56, 0x81, 0x57, 0x2e, 0x06, 0x00, 0xfa, 0x00, 0x06, 0x00, 0xfc, 0x60,
-    0x1e, 0x60, 0xa8, 0x80, 0x48, 0x2c, 0x5f, 0x97, 0x6b, 0xfd, 0x3f, 0x02, 0xc2, 0x6f, 0x7f, 0x36,
-    0x4b, 0x77, 0x87, 0x00, 0x00, 0x02, 0x00, 0x96, 0x00, 0x00, 0x01, 0x3b, 0x05, 0xc4, 0x00, 0x03,
-    0x00, 0x0f, 0x00, 0x10, 0xb7, 0x07, 0x0d, 0x03, 0x06, 0x72, 0x02, 0x0a, 0x72, 0x00, 0x2b, 0x2b,
-    0xce, 0x32, 0x30, 0x31, 0x41, 0x11, 0x23, 0x11, 0x03, 0x34, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14,
-    0x06, 0x23, 0x22, 0x26, 0x01, 0x23, 0x78, 0x15, 0x2b, 0x27, 0x26, 0x2d, 0x2d, 0x26, 0x27, 0x2b,
-    0x04, 0x3a, 0xfb, 0xc6, 0x04, 0x3a, 0x01, 0x39, 0x22, 0x2f, 0x2f, 0x22, 0x21, 0x2f, 0x2f, 0x00,
-    0x00, 0x02, 0xff, 0x98, 0xfe, 0x4b, 0x01, 0x36, 0x05, 0xc4, 0x00, 0x11, 0x00, 0x1d, 0x00, 0x13,
-    0x40, 0x09, 0x0d, 0x06, 0x0f, 0x72, 0x15, 0x1b, 0x00, 0x06, 0x72, 0x00, 0x2b, 0xce, 0x32, 0x2b,
-    0x32, 0x30, 0x31, 0x53, 0x33, 0x11, 0x14, 0x06, 0x06, 0x23, 0x22, 0x26, 0x27, 0x37, 0x16, 0x16,
-    0x33, 0x32, 0x36, 0x36, 0x35, 0x03, 0x34, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14, 0x06, 0x23, 0x22,
-    0x26, 0xa6, 0x78, 0x41, 0x7e, 0x5d, 0x19, 0x3a, 0x17, 0x02, 0x11, 0x32, 0x17, 0x39, 0x50, 0x29,
-    0x15, 0x2c, 0x26, 0x27, 0x2c, 0x2c, 0x27, 0x26, 0x2c, 0x04, 0x3a, 0xfb, 0x45, 0x63, 0x8a, 0x47,
-    0x0a, 0x09, 0x64, 0x05, 0x08, 0x2d, 0x5a, 0x43, 0x05, 0xf4, 0x22, 0x2f, 0x2f, 0x22, 0x21, 0x2f,
-    0x2f, 0x00, 0x00, 0x03, 0x00, 0x9d, 0x00, 0x00, 0x03, 0xe3, 0x06, 0x00, 0x00, 0x03, 0x00, 0x09,
-    0x00, 0x0d, 0x00, 0x1d, 0x40, 0x11, 0x06, 0x07, 0x0b, 0x05, 0x0c, 0x08, 0x06, 0x02, 0x09, 0x06,
-    0x03, 0x00, 0x72, 0x0a, 0x02, 0x0a, 0x72, 0x00, 0x2b, 0x32, 0x2b, 0x3f, 0x12, 0x17, 0x39, 0x30,
-    0x31, 0x41, 0x11, 0x23, 0x11, 0x01, 0x01, 0x07, 0x27, 0x37, 0x01, 0x13, 0x01, 0x37, 0x01, 0x01,
-    0x15, 0x78, 0x03, 0x1e, 0xfe, 0x07, 0xd8, 0x11, 0xad, 0x01, 0x9e, 0x2f, 0xfe, 0x3d, 0x41, 0x02,
-    0x12, 0x06, 0x00, 0xfa, 0x00, 0x06, 0x00, 0xfe, 0x3a, 0xfe, 0x0a, 0xd0, 0x76, 0xbb, 0x01, 0x95,
-    0xfb, 0xc6, 0x02, 0x32, 0x68, 0xfd, 0x66, 0x00, 0x00, 0x01, 0x00, 0xab, 0x00, 0x00, 0x01, 0x23,
-    0x06, 0x00, 0x00, 0x03, 0x00, 0x0c, 0xb5, 0x03, 0x00, 0x72, 0x02, 0x0a, 0x72, 0x00, 0x2b, 0x2b,
-    0x30, 0x31, 0x41, 0x11, 0x23, 0x11, 0x01, 0x23, 0x78, 0x06, 0x00, 0xfa, 0x00, 0x06, 0x00, 0x00,
-    0x00, 0x03, 0x00, 0x96, 0x00, 0x00, 0x06, 0x85, 0x04, 0x4e, 0x00, 0x04, 0x00, 0x1b, 0x00, 0x32,
-    0x00, 0x21, 0x40, 0x11, 0x29, 0x12, 0x02, 0x2e, 0x22, 0x22, 0x17, 0x0b, 0x03, 0x06, 0x72, 0x0b,
-    0x07, 0x72, 0x02, 0x0a, 0x72, 0x00, 0x2b, 0x2b, 0x2b, 0x11, 0x33, 0x33, 0x11, 0x33, 0x11, 0x33,
-    0x33, 0x30, 0x31, 0x41, 0x11, 0x23, 0x11, 0x33, 0x03, 0x27, 0x3e, 0x03, 0x33, 0x32, 0x1e, 0x02,
-    0x15, 0x11, 0x23, 0x11, 0x34, 0x26, 0x26, 0x23, 0x22, 0x0e, 0x02, 0x25, 0x07, 0x3e, 0x03, 0x33,
-    0x32, 0x1e, 0x02, 0x15, 0x11, 0x23, 0x11, 0x34, 0x26, 0x26, 0x23, 0x0e, 0x03, 0x01, 0x0f, 0x79,
-    0x74, 0x12, 0x39, 0x05, 0x3e, 0x6d, 0x9b, 0x62, 0x4f, 0x80, 0x5c, 0x31, 0x77, 0x43, 0x77, 0x4e,
-    0x5c, 0x7f, 0x4f, 0x25, 0x02, 0xcd, 0x50, 0x05, 0x3f, 0x6e, 0x99, 0x60, 0x54, 0x84, 0x5b, 0x30,
-    0x78, 0x43, 0x76, 0x4f, 0x4e, 0x76, 0x4f, 0x29, 0x03, 0x5b, 0xfc, 0xa5, 0x04, 0x3a, 0xfe, 0x26,
-    0x1e, 0x60, 0xa8, 0x80, 0x48, 0x2b, 0x5b, 0x91, 0x66, 0xfd, 0x2f, 0x02, 0xcc, 0x6c, 0x7a, 0x34,
-    0x4b, 0x77, 0x87, 0x21, 0x02, 0x4f, 0x90, 0x71, 0x42, 0x2d, 0x60, 0x96, 0x69, 0xfd, 0x3e, 0x02,
-    0xc3, 0x72, 0x7f, 0x32, 0x01, 0x37, 0x59, 0x66, 0x00, 0x02, 0x00, 0x9d, 0x00, 0x00, 0x03, 0xcd,
-    0x04, 0x4e, 0x00, 0x04, 0x00, 0x1b, 0x00, 0x19, 0x40, 0x0d, 0x12, 0x02, 0x17, 0x0b, 0x03, 0x06,
-    0x72, 0x0b, 0x07, 0x72, 0x02, 0x0a, 0x72, 0x00, 0x2b, 0x2b, 0x2b, 0x11, 0x33, 0x11, 0x33, 0x30,
-    0x31, 0x41, 0x11, 0x23, 0x11, 0x33, 0x03, 0x27, 0x3e, 0x03, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x11,
-    0x23, 0x11, 0x34, 0x26, 0x26, 0x23, 0x22, 0x0e, 0x02, 0x01, 0x14, 0x77, 0x72, 0x15, 0x35, 0x05,
-    0x42, 0x71, 0x9a, 0x5d, 0x51, 0x80, 0x59, 0x2f, 0x78, 0x3e, 0x72, 0x4e, 0x56, 0x81, 0x57, 0x2e,
-    0x03, 0x53, 0xfc, 0xad, 0x04, 0x3a, 0xfe, 0x26, 0x1e, 0x60, 0xa8, 0x80, 0x48, 0x2c, 0x5f, 0x97,
-    0x6b, 0xfd, 0x3f, 0x02, 0xc2, 0x6f, 0x7f, 0x36, 0x4b, 0x77, 0x87, 0x00, 0x00, 0x02, 0x00, 0x5b,
-    0xff, 0xec, 0x04, 0x21, 0x04, 0x4e, 0x00, 0x15, 0x00, 0x2b, 0x00, 0x10, 0xb7, 0x1c, 0x11, 0x0b,
-    0x72, 0x27, 0x06, 0x07, 0x72, 0x00, 0x2b, 0x32, 0x2b, 0x32, 0x30, 0x31, 0x53, 0x35, 0x34, 0x3e,
-    0x02, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x37, 0x15,
-    0x14, 0x1e, 0x02, 0x33, 0x32, 0x3e, 0x02, 0x35, 0x35, 0x34, 0x2e, 0x02, 0x23, 0x22, 0x0e, 0x02,
-    0x5b, 0x45, 0x7e, 0xb2, 0x6d, 0x6e, 0xb3, 0x7f, 0x44, 0x44, 0x7f, 0xb1, 0x6e, 0x6e, 0xb2, 0x7f,
-    0x45, 0x78, 0x2f, 0x5d, 0x88, 0x58, 0x58, 0x87, 0x5c, 0x2f, 0x2f, 0x5d, 0x88, 0x58, 0x57, 0x87,
-    0x5d, 0x2f, 0x02, 0x0d, 0x20, 0x76, 0xc8, 0x92, 0x51, 0x51, 0x92, 0xc8, 0x76, 0x20, 0x76, 0xc7,
-    0x93, 0x51, 0x51, 0x93, 0xc7, 0x96, 0x20, 0x59, 0x9f, 0x7b, 0x47, 0x47, 0x7b, 0x9f, 0x59, 0x20,
-    0x58, 0x9e, 0x7c, 0x48, 0x48, 0x7c, 0x9e, 0x00, 0x00, 0x03, 0x00, 0x9b, 0xfe, 0x60, 0x04, 0x03,
-    0x04, 0x4e, 0x00, 0x04, 0x00, 0x1a, 0x00, 0x2f, 0x00, 0x19, 0x40, 0x0e, 0x21, 0x16, 0x07, 0x72,
-    0x2b, 0x0b, 0x0b, 0x72, 0x03, 0x06, 0x72, 0x02, 0x0e, 0x72, 0x00, 0x2b, 0x2b, 0x2b, 0x32, 0x2b,
-    0x32, 0x30, 0x31, 0x41, 0x11, 0x23, 0x11, 0x33, 0x01, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e,
-    0x02, 0x27, 0x11, 0x3e, 0x03, 0x33, 0x32, 0x1e, 0x02, 0x07, 0x35, 0x34, 0x2e, 0x02, 0x23, 0x22,
-    0x0e, 0x02, 0x07, 0x11, 0x1e, 0x02, 0x33, 0x32, 0x3e, 0x02, 0x01, 0x13, 0x78, 0x70, 0x02, 0xf8,
-    0x37, 0x6a, 0x99, 0x63, 0x61, 0x98, 0x6c, 0x42, 0x0c, 0x0f, 0x44, 0x6a, 0x95, 0x5f, 0x63, 0x9b,
-    0x6a, 0x37, 0x78, 0x27, 0x4f, 0x79, 0x53, 0x56, 0x79, 0x4f, 0x2e, 0x0b, 0x13, 0x54, 0x8c, 0x66,
-    0x52, 0x78, 0x4f, 0x27, 0x03, 0x6a, 0xfa, 0xf6, 0x05, 0xda, 0xfd, 0xed, 0x15, 0x79, 0xc9, 0x93,
-    0x51, 0x3c, 0x6f, 0x96, 0x59, 0x01, 0x14, 0x62, 0xa0, 0x74, 0x3e, 0x4d, 0x91, 0xcb, 0x93, 0x15,
-    0x5f, 0xa2, 0x79, 0x44, 0x39, 0x5d, 0x6e, 0x35, 0xfe, 0xc1, 0x4c, 0x80, 0x4e, 0x45, 0x79, 0xa3,
-    0x00, 0x03, 0x00, 0x6d, 0xfe, 0x60, 0x03, 0xd4, 0x04, 0x4e, 0x00, 0x04, 0x00, 0x1a, 0x00, 0x2f,
-    0x00, 0x19, 0x40, 0x0e, 0x21, 0x16, 0x0b, 0x72, 0x2b, 0x0b, 0x07, 0x72, 0x04, 0x0e, 0x72, 0x03,
-    0x06, 0x72, 0x00, 0x2b, 0x2b, 0x2b, 0x32, 0x2b, 0x32, 0x30, 0x31, 0x41, 0x11, 0x37, 0x33, 0x11,
-    0x01, 0x35, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x1e, 0x02, 0x17, 0x11, 0x0e, 0x03, 0x23, 0x22, 0x2e,
-    0x02, 0x37, 0x15, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x36, 0x36, 0x37, 0x11, 0x2e, 0x03, 0x23, 0x22,
-    0x0e, 0x02, 0x03, 0x5c, 0x08, 0x70, 0xfc, 0x99, 0x38, 0x6d, 0x9b, 0x63, 0x60, 0x93, 0x6b, 0x43,
-    0x0f, 0x0c, 0x41, 0x6c, 0x97, 0x62, 0x62, 0x9b, 0x6b, 0x39, 0x79, 0x26, 0x4f, 0x78, 0x52, 0x67,
-    0x8d, 0x55, 0x13, 0x0a, 0x30, 0x51, 0x7a, 0x55, 0x53, 0x79, 0x4f, 0x26, 0xfe, 0x60, 0x05, 0x0a,
-    0xd0, 0xfa, 0x26, 0x03, 0xb2, 0x15, 0x7e, 0xcb, 0x91, 0x4d, 0x3e, 0x74, 0xa0, 0x62, 0xfe, 0xf5,
-    0x5b, 0x9a, 0x70, 0x3e, 0x51, 0x93, 0xc9, 0x8e, 0x15, 0x5e, 0xa3, 0x79, 0x45, 0x50, 0x85, 0x4e,
-    0x01, 0x36, 0x33, 0x6e, 0x5f, 0x3b, 0x45, 0x7a, 0xa2, 0x00, 0x00, 0x02, 0x00, 0x9d, 0x00, 0x00,
-    0x02, 0x94, 0x04, 0x4e, 0x00, 0x04, 0x00, 0x16, 0x00, 0x19, 0x40, 0x0d, 0x06, 0x09, 0x09, 0x05,
-    0x14, 0x07, 0x72, 0x03, 0x06, 0x72, 0x02, 0x0a, 0x72, 0x00, 0x2b, 0x2b, 0x2b, 0x32, 0x32, 0x11,
-    0x33, 0x30, 0x31, 0x41, 0x11, 0x23, 0x11, 0x33, 0x25, 0x07, 0x26, 0x26, 0x23, 0x22, 0x0e, 0x02,
-    0x07, 0x07, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x16, 0x01, 0x14, 0x77, 0x75, 0x01, 0x82, 0x04, 0x13,
-    0x26, 0x17, 0x4d, 0x76, 0x4f, 0x2a, 0x03, 0x2c, 0x2c, 0x5a, 0x8b, 0x5f, 0x16, 0x2d, 0x03, 0x87,
-    0xfc, 0x79, 0x04, 0x3a, 0x08, 0x6e, 0x03, 0x04, 0x39, 0x65, 0x86, 0x4e, 0x10, 0x6a, 0xb6, 0x89,
-    0x4c, 0x07, 0x00, 0x01, 0x00, 0x66, 0xff, 0xec, 0x03, 0x9d, 0x04, 0x4e, 0x00, 0x35, 0x00, 0x17,
-    0x40, 0x0b, 0x1b, 0x00, 0x0e, 0x32, 0x29, 0x0b, 0x72, 0x17, 0x0e, 0x07, 0x72, 0x00, 0x2b, 0x32,
-    0x2b, 0x32, 0x11, 0x39, 0x39, 0x30, 0x31, 0x41, 0x34, 0x26, 0x26, 0x27, 0x2e, 0x03, 0x35, 0x34,
-    0x3e, 0x02, 0x33, 0x32, 0x16, 0x16, 0x15, 0x23, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x15,
-    0x14, 0x1e, 0x02, 0x17, 0x1e, 0x02, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x26, 0x26, 0x35, 0x33,
-    0x1e, 0x02, 0x33, 0x32, 0x36, 0x36, 0x03, 0x25, 0x2c, 0x7d, 0x78, 0x5b, 0x8d, 0x60, 0x32, 0x35,
-    0x63, 0x8d, 0x58, 0x7e, 0xb2, 0x60, 0x78, 0x41, 0x7d, 0x5a, 0x5d, 0x73, 0x35, 0x16, 0x3e, 0x72,
-    0x5a, 0x83, 0xa7, 0x51, 0x38, 0x69, 0x93, 0x5b, 0x89, 0xbe, 0x61, 0x78, 0x05, 0x5f, 0x88, 0x44,
-    0x5b, 0x7c, 0x40, 0x01, 0x14, 0x2d, 0x55, 0x48, 0x19, 0x14, 0x32, 0x46, 0x62, 0x43, 0x3c, 0x6b,
-    0x51, 0x2e, 0x55, 0x92, 0x5c, 0x38, 0x64, 0x40, 0x38, 0x56, 0x2e, 0x24, 0x3b, 0x32, 0x2c, 0x14,
-    0x1e, 0x53, 0x78, 0x56, 0x43, 0x6f, 0x51, 0x2c, 0x5c, 0x94, 0x55, 0x55, 0x61, 0x28, 0x36, 0x59,
-    0x00, 0x02, 0x00, 0x18, 0xff, 0xec, 0x02, 0x4a, 0x05, 0x50, 0x00, 0x03, 0x00, 0x15, 0x00, 0x13,
-    0x40, 0x09, 0x0a, 0x11, 0x0b, 0x72, 0x04, 0x02, 0x03, 0x06, 0x72, 0x00, 0x2b, 0x32, 0x2f, 0x2b,
-    0x32, 0x30, 0x31, 0x41, 0x15, 0x21, 0x35, 0x13, 0x33, 0x11, 0x14, 0x16, 0x16, 0x33, 0x32, 0x36,
-    0x37, 0x17, 0x06, 0x06, 0x23, 0x22, 0x26, 0x26, 0x35, 0x02, 0x37, 0xfd, 0xe1, 0xc7, 0x78, 0x27,
-    0x41, 0x25, 0x1b, 0x31, 0x15, 0x05, 0x16, 0x47, 0x23, 0x45, 0x6a, 0x3c, 0x04, 0x3a, 0x62, 0x62,
-    0x01, 0x16, 0xfb, 0xb8, 0x4b, 0x4d, 0x19, 0x07, 0x03, 0x65, 0x07, 0x09, 0x34, 0x7c, 0x6c, 0x00,
-    0x00, 0x02, 0x00, 0x99, 0xff, 0xec, 0x03, 0xcb, 0x04, 0x3a, 0x00, 0x04, 0x00, 0x1b, 0x00, 0x15,
-    0x40, 0x0a, 0x01, 0x11, 0x06, 0x72, 0x18, 0x03, 0x03, 0x0b, 0x0b, 0x72, 0x00, 0x2b, 0x32, 0x2f,
-    0x32, 0x2b, 0x32, 0x30, 0x31, 0x65, 0x11, 0x33, 0x11, 0x23, 0x13, 0x37, 0x14, 0x0e, 0x02, 0x23,
-    0x22, 0x2e, 0x02, 0x35, 0x11, 0x33, 0x11, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x36, 0x36, 0x03, 0x52,
-    0x79, 0x74, 0x11, 0x3e, 0x30, 0x66, 0xa2, 0x72, 0x4f, 0x83, 0x5e, 0x33, 0x77, 0x27, 0x45, 0x5a,
-    0x34, 0x84, 0x99, 0x41, 0xfa, 0x03, 0x40, 0xfb, 0xc6, 0x01, 0xc3, 0x02, 0x66, 0xad, 0x7f, 0x47,
-    0x2e, 0x61, 0x9c, 0x6f, 0x02, 0xb4, 0xfd, 0x4a, 0x56, 0x75, 0x45, 0x1e, 0x65, 0xa7, 0x00, 0x02,
-    0x00, 0x26, 0x00, 0x00, 0x03, 0xb2, 0x04, 0x3a, 0x00, 0x04, 0x00, 0x09, 0x00, 0x17, 0x40, 0x0b,
-    0x00, 0x06, 0x08, 0x01, 0x09, 0x06, 0x72, 0x03, 0x08, 0x0a, 0x72, 0x00, 0x2b, 0x32, 0x2b, 0x32,
-    0x12, 0x39, 0x39, 0x30, 0x31, 0x65, 0x01, 0x33, 0x01, 0x23, 0x01, 0x01, 0x17, 0x23, 0x01, 0x01,
-    0xdc, 0x01, 0x5b, 0x7b, 0xfe, 0x6b, 0x57, 0xfe, 0xdc, 0x01, 0x60, 0x12, 0x58, 0xfe, 0x6a, 0x74,
-    0x03, 0xc6, 0xfb, 0xc6, 0x04, 0x3a, 0xfc, 0x37, 0x71, 0x04, 0x3a, 0x00, 0x00, 0x04, 0x00, 0x3f,
-    0x00, 0x00, 0x05, 0xc2, 0x04, 0x3a, 0x00, 0x05, 0x00, 0x0a, 0x00, 0x0f, 0x00, 0x15, 0x00, 0x24,
-    0x40, 0x14, 0x07, 0x0b, 0x00, 0x11, 0x03, 0x14, 0x06, 0x09, 0x10, 0x0c, 0x01, 0x0a, 0x06, 0x72,
-    0x12, 0x0e, 0x04, 0x09, 0x0a, 0x72, 0x00, 0x2b, 0x32, 0x32, 0x32, 0x2b, 0x32, 0x32, 0x32, 0x12,
-    0x17, 0x39, 0x30, 0x31, 0x65, 0x01, 0x33, 0x07, 0x01, 0x23, 0x03, 0x13, 0x17, 0x23, 0x01, 0x01,
-    0x13, 0x33, 0x01, 0x23, 0x03, 0x01, 0x13, 0x23, 0x01, 0x27, 0x01, 0xc9, 0x01, 0x05, 0x55, 0x32,
-    0xfe, 0xef, 0x55, 0xd0, 0xe5, 0x30, 0x57, 0xfe, 0xc6, 0x04, 0x28, 0xdf, 0x7c, 0xfe, 0xc5, 0x56,
-    0xfd, 0x01, 0x01, 0x41, 0x55, 0xfe, 0xe9, 0x2f, 0xfd, 0x03, 0x3d, 0xdf, 0xfc, 0xa5, 0x04, 0x3a,
-    0xfc, 0xbe, 0xf8, 0x04, 0x3a, 0xfc, 0xc1, 0x03, 0x3f, 0xfb, 0xc6, 0x04, 0x3a, 0xfc, 0xca, 0xfe,
-    0xfc, 0x03, 0x5c, 0xde, 0x00, 0x01, 0x00, 0x31, 0x00, 0x00, 0x03, 0xb3, 0x04, 0x3a, 0x00, 0x0b,
-    0x00, 0x1a, 0x40, 0x0e, 0x07, 0x04, 0x0a, 0x01, 0x04, 0x09, 0x03, 0x0b, 0x06, 0x72, 0x06, 0x09,
-    0x0a, 0x72, 0x00, 0x2b, 0x32, 0x2b, 0x32, 0x12, 0x17, 0x39, 0x30, 0x31, 0x53, 0x01, 0x01, 0x33,
-    0x01, 0x01, 0x23, 0x01, 0x01, 0x23, 0x01, 0x01, 0xcd, 0x01, 0x23, 0x01, 0x25, 0x8e, 0xfe, 0x91,
-    0x01, 0x7f, 0x8d, 0xfe, 0xcc, 0xfe, 0xcc, 0x8d, 0x01, 0x7e, 0xfe, 0x91, 0x04, 0x3a, 0xfe, 0x4b,
-    0x01, 0xb5, 0xfd, 0xee, 0xfd, 0xd8, 0x01, 0xc9, 0xfe, 0x37, 0x02, 0x28, 0x02, 0x12, 0x00, 0x02,
-    0x00, 0x21, 0xfe, 0x4b, 0x03, 0xb0, 0x04, 0x3a, 0x00, 0x13, 0x00, 0x18, 0x00, 0x19, 0x40, 0x0d,
-    0x17, 0x16, 0x15, 0x03, 0x08, 0x02, 0x18, 0x06, 0x72, 0x0f, 0x08, 0x0f, 0x72, 0x00, 0x2b, 0x32,
-    0x2b, 0x32, 0x12, 0x17, 0x39, 0x30, 0x31, 0x65, 0x01, 0x33, 0x01, 0x0e, 0x03, 0x23, 0x22, 0x26,
-    0x27, 0x27, 0x16, 0x16, 0x33, 0x32, 0x36, 0x36, 0x37, 0x03, 0x01, 0x17, 0x07, 0x01, 0x01, 0xde,
-    0x01, 0x51, 0x81, 0xfe, 0x37, 0x0e, 0x2b, 0x45, 0x67, 0x4a, 0x13, 0x3c, 0x0d, 0x01, 0x0b, 0x2a,
-    0x08, 0x41, 0x59, 0x3c, 0x17, 0xe2, 0x01, 0x59, 0x21, 0x58, 0xfe, 0x5c, 0x6c, 0x03, 0xce, 0xfb,
-    0x19, 0x25, 0x5b, 0x53, 0x35, 0x09, 0x05, 0x64, 0x02, 0x04, 0x2c, 0x57, 0x40, 0x04, 0xc0, 0xfc,
-    0x5f, 0x7c, 0x32, 0x04, 0x4f, 0x00, 0x00, 0x03, 0x00, 0x58, 0x00, 0x00, 0x03, 0xab, 0x04, 0x3a,
-    0x00, 0x03, 0x00, 0x09, 0x00, 0x0d, 0x00, 0x1c, 0x40, 0x0d, 0x04, 0x0c, 0x0c, 0x09, 0x0d, 0x06,
-    0x72, 0x07, 0x03, 0x03, 0x06, 0x02, 0x12, 0x00, 0x3f, 0x33, 0x33, 0x11, 0x33, 0x2b, 0x32, 0x32,
-    0x11, 0x33, 0x30, 0x31, 0x65, 0x15, 0x21, 0x35, 0x01, 0x01, 0x23, 0x35, 0x01, 0x33, 0x23, 0x15,
-    0x21, 0x35, 0x03, 0xab, 0xfc, 0xd8, 0x02, 0xfc, 0xfd, 0x23, 0x4a, 0x02, 0xdb, 0x4c, 0x36, 0xfd,
-    0x23, 0x67, 0x67, 0x67, 0x03, 0x7a, 0xfc, 0x1f, 0x5a, 0x03, 0xe0, 0x68, 0x68, 0x00, 0x00, 0x02,
-    0x00, 0x45, 0xfe, 0x6d, 0x02, 0x9b, 0x06, 0x3d, 0x00, 0x11, 0x00, 0x25, 0x00, 0x19, 0x40, 0x0a,
-    0x1d, 0x09, 0x0a, 0x0a, 0x1c, 0x1c, 0x12, 0x13, 0x01, 0x00, 0x00, 0x2f, 0x32, 0x2f, 0x33, 0x39,
-    0x2f, 0x33, 0x12, 0x39, 0x39, 0x30, 0x31, 0x41, 0x17, 0x06, 0x06, 0x15, 0x15, 0x14, 0x06, 0x06,
-    0x23, 0x35, 0x32, 0x36, 0x35, 0x35, 0x34, 0x36, 0x36, 0x13, 0x07, 0x2e, 0x02, 0x35, 0x35, 0x34,
-    0x26, 0x26, 0x23, 0x35, 0x32, 0x16, 0x16, 0x15, 0x15, 0x14, 0x16, 0x16, 0x02, 0x7d, 0x1b, 0x85,
-    0x6f, 0x47, 0x9b, 0x7d, 0x7b, 0x6c, 0x3d, 0x93, 0x9f, 0x1e, 0x81, 0x93, 0x3d, 0x30, 0x65, 0x52,
-    0x7d, 0x9b, 0x47, 0x32, 0x6c, 0x06, 0x3d, 0x4f, 0x2a, 0xd0, 0x88, 0xe3, 0x5e, 0x9a, 0x5b, 0x53,
-    0x8b, 0x75, 0xe3, 0x69, 0xb7, 0x8b, 0xf8, 0xa6, 0x50, 0x27, 0x89, 0xb6, 0x69, 0xe1, 0x4f, 0x73,
-    0x40, 0x53, 0x5b, 0x9a, 0x60, 0xe1, 0x5b, 0x98, 0x6f, 0x00, 0x00, 0x01, 0x00, 0xb3, 0xfe, 0xf2,
-    0x01, 0x18, 0x05, 0xb0, 0x00, 0x03, 0x00, 0x09, 0xb2, 0x00, 0x02, 0x01, 0x00, 0x2f, 0x3f, 0x30,
-    0x31, 0x41, 0x11, 0x23, 0x11, 0x01, 0x18, 0x65, 0x05, 0xb0, 0xf9, 0x42, 0x06, 0xbe, 0x00, 0x02,
-    0x00, 0x0a, 0xfe, 0x6d, 0x02, 0x60, 0x06, 0x3d, 0x00, 0x13, 0x00, 0x26, 0x00, 0x1b, 0x40, 0x0b,
-    0x1e, 0x0b, 0x0a, 0x0a, 0x1f, 0x1f, 0x01, 0x15, 0x14, 0x00, 0x01, 0x00, 0x2f, 0x33, 0x2f, 0x33,
-    0x12, 0x39, 0x2f, 0x33, 0x12, 0x39, 0x39, 0x30, 0x31, 0x53, 0x37, 0x1e, 0x02, 0x15, 0x15, 0x14,
-    0x16, 0x16, 0x33, 0x15, 0x22, 0x26, 0x26, 0x35, 0x35, 0x34, 0x26, 0x26, 0x03, 0x27, 0x3e, 0x02,
-    0x35, 0x35, 0x34, 0x36, 0x36, 0x33, 0x15, 0x22, 0x06, 0x15, 0x15, 0x14, 0x06, 0x06, 0x0d, 0x1a,
-    0x82, 0x93, 0x3d, 0x30, 0x65, 0x52, 0x7d, 0x9b, 0x47, 0x30, 0x6b, 0x3f, 0x1d, 0x59, 0x6c, 0x32,
-    0x47, 0x9b, 0x7d, 0x7a, 0x6d, 0x3d, 0x93, 0x05, 0xee, 0x4f, 0x26, 0x8b, 0xb7, 0x69, 0xe3, 0x4e,
-    0x73, 0x3f, 0x4e, 0x58, 0x98, 0x5e, 0xe3, 0x5b, 0x9a, 0x71, 0xf8, 0x9b, 0x50, 0x1d, 0x6f, 0x98,
-    0x5b, 0xe1, 0x60, 0x97, 0x59, 0x4e, 0x8c, 0x76, 0xe1, 0x69, 0xb6, 0x89, 0x00, 0x01, 0x00, 0x92,
-    0x01, 0xa7, 0x04, 0xe7, 0x03, 0x15, 0x00, 0x1f, 0x00, 0x1b, 0x40, 0x0b, 0x0c, 0x00, 0x00, 0x16,
-    0x06, 0x80, 0x1c, 0x06, 0x10, 0x10, 0x06, 0x00, 0x2f, 0x33, 0x2f, 0x11, 0x33, 0x1a, 0x10, 0xcd,
-    0x32, 0x2f, 0x32, 0x30, 0x31, 0x41, 0x33, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x26, 0x27, 0x26, 0x26,
-    0x23, 0x22, 0x06, 0x06, 0x15, 0x07, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x16, 0x17, 0x16, 0x16, 0x33,
-    0x32, 0x36, 0x36, 0x04, 0x7f, 0x68, 0x28, 0x4d, 0x6e, 0x46, 0x58, 0x82, 0x50, 0x3e, 0x60, 0x3d,
-    0x3a, 0x54, 0x2d, 0x6c, 0x27, 0x4c, 0x6e, 0x46, 0x5a, 0x85, 0x4c, 0x42, 0x5f, 0x39, 0x3d, 0x56,
-    0x2e, 0x02, 0xfd, 0x45, 0x7b, 0x5f, 0x37, 0x4a, 0x46, 0x39, 0x38, 0x35, 0x67, 0x4a, 0x01, 0x47,
-    0x7b, 0x5e, 0x34, 0x4d, 0x44, 0x3c, 0x35, 0x3a, 0x6a, 0x00, 0x00, 0x02, 0x00, 0x8d, 0xfe, 0x98,
-    0x01, 0x32, 0x04, 0x4e, 0x00, 0x03, 0x00, 0x0f, 0x00, 0x0c, 0xb3, 0x01, 0x07, 0x0d, 0x00, 0x00,
-    0x2f, 0x2f, 0xdd, 0xce, 0x30, 0x31, 0x53, 0x13, 0x33, 0x13, 0x13, 0x14, 0x06, 0x23, 0x22, 0x26,
-    0x35, 0x34, 0x36, 0x33, 0x32, 0x16, 0xa8, 0x07, 0x6f, 0x07, 0x0d, 0x2c, 0x26, 0x26, 0x2d, 0x2d,
-    0x26, 0x26, 0x2c, 0xfe, 0x98, 0x04, 0x1a, 0xfb, 0xe6, 0x05, 0x66, 0x21, 0x30, 0x30, 0x21, 0x22,
-    0x2e, 0x2e, 0x00, 0x03, 0x00, 0x78, 0xff, 0x0b, 0x03, 0xe6, 0x05, 0x26, 0x00, 0x03, 0x00, 0x07,
-    0x00, 0x2f, 0x00, 0x25, 0x40, 0x12, 0x02, 0x01, 0x25, 0x25, 0x21, 0x03, 0x1c, 0x07, 0x72, 0x07,
-    0x04, 0x08, 0x08, 0x0c, 0x06, 0x11, 0x0d, 0x72, 0x00, 0x2b, 0xcd, 0xcc, 0x33, 0x12, 0x39, 0x39,
-    0x2b, 0xcd, 0xcc, 0x33, 0x12, 0x39, 0x39, 0x30, 0x31, 0x41, 0x11, 0x23, 0x11, 0x13, 0x11, 0x23,
-    0x11, 0x37, 0x32, 0x36, 0x36, 0x37, 0x33, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x35, 0x34,
-    0x3e, 0x02, 0x33, 0x32, 0x16, 0x16, 0x17, 0x23, 0x2e, 0x02, 0x23, 0x22, 0x0e, 0x02, 0x15, 0x15,
-    0x14, 0x1e, 0x02, 0x02, 0x7d, 0x78, 0x78, 0x78, 0x41, 0x4b, 0x85, 0x57, 0x06, 0x73, 0x05, 0x74,
-    0xb9, 0x6e, 0x72, 0xad, 0x74, 0x3b, 0x3b, 0x74, 0xac, 0x72, 0x74, 0xb8, 0x70, 0x05, 0x73, 0x05,
-    0x52, 0x86, 0x51, 0x5c, 0x83, 0x51, 0x25, 0x25, 0x51, 0x83, 0x05, 0x26, 0xfe, 0xf4, 0x01, 0x0c,
-    0xfa, 0xf0, 0xfe, 0xf5, 0x01, 0x0b, 0x3d, 0x3a, 0x70, 0x52, 0x67, 0xa0, 0x5c, 0x53, 0x93, 0xc4,
-    0x72, 0x2a, 0x72, 0xc5, 0x93, 0x52, 0x5e, 0xac, 0x76, 0x57, 0x7e, 0x44, 0x47, 0x7b, 0x9d, 0x56,
-    0x2a, 0x56, 0x9d, 0x7b, 0x47, 0x00, 0x00, 0x03, 0x00, 0x5d, 0x00, 0x00, 0x04, 0x47, 0x05, 0xc4,
-    0x00, 0x03, 0x00, 0x07, 0x00, 0x22, 0x00, 0x21, 0x40, 0x10, 0x06, 0x05, 0x05, 0x01, 0x1f, 0x16,
-    0x05, 0x72, 0x0c, 0x0d, 0x0d, 0x02, 0x02, 0x01, 0x0c, 0x72, 0x00, 0x2b, 0x32, 0x11, 0x33, 0x11,
-    0x33, 0x2b, 0x32, 0x11, 0x39, 0x2f, 0x33, 0x30, 0x31, 0x61, 0x21, 0x35, 0x21, 0x01, 0x21, 0x35,
-    0x21, 0x01, 0x13, 0x16, 0x06, 0x07, 0x27, 0x3e, 0x02, 0x27, 0x03, 0x34, 0x36, 0x36, 0x33, 0x32,
-    0x16, 0x16, 0x15, 0x23, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x04, 0x47, 0xfc, 0x1a, 0x03,
-    0xe5, 0xfe, 0xa4, 0xfd, 0x73, 0x02, 0x8d, 0xfe, 0x9e, 0x16, 0x02, 0x33, 0x34, 0x75, 0x23, 0x2b,
-    0x12, 0x01, 0x16, 0x68, 0xb6, 0x77, 0x7e, 0xaf, 0x5d, 0x7b, 0x4d, 0x7f, 0x4b, 0x51, 0x7b, 0x46,
-    0x6a, 0x02, 0x1b, 0x6a, 0x01, 0x20, 0xfd, 0x62, 0x67, 0x9e, 0x29, 0x27, 0x0a, 0x56, 0x73, 0x34,
-    0x02, 0x9e, 0x8a, 0xc3, 0x68, 0x62, 0xaf, 0x73, 0x65, 0x7d, 0x39, 0x4d, 0x94, 0x00, 0x00, 0x06,
-    0x00, 0x6e, 0xff, 0xe5, 0x05, 0x60, 0x04, 0xf1, 0x00, 0x13, 0x00, 0x27, 0x00, 0x2b, 0x00, 0x2f,
-    0x00, 0x33, 0x00, 0x37, 0x00, 0x0e, 0xb5, 0x0f, 0x19, 0x05, 0x23, 0x0d, 0x72, 0x00, 0x2b, 0x32,
-    0x2f, 0x33, 0x30, 0x31, 0x41, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x3e, 0x02, 0x35, 0x34, 0x2e, 0x02,
-    0x23, 0x22, 0x0e, 0x02, 0x07, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x14, 0x0e, 0x02,
-    0x23, 0x22, 0x2e, 0x02, 0x01, 0x07, 0x27, 0x37, 0x01, 0x07, 0x27, 0x37, 0x01, 0x27, 0x37, 0x17,
-    0x01, 0x27, 0x37, 0x17, 0x01, 0x02, 0x4c, 0x84, 0xaf, 0x63, 0x64, 0xae, 0x84, 0x4b, 0x4b, 0x84,
-    0xae, 0x64, 0x63, 0xaf, 0x84, 0x4c, 0x71, 0x5d, 0xa3, 0xd8, 0x7b, 0x7b, 0xd8, 0xa4, 0x5c, 0x5c,
-    0xa4, 0xd8, 0x7b, 0x7b, 0xd8, 0xa3, 0x5d, 0x04, 0xcf, 0xca, 0x57, 0xca, 0xfc, 0x84, 0xca, 0x55,
-    0xca, 0x03, 0xd1, 0xca, 0x57, 0xca, 0xfb, 0xd8, 0xca, 0x55, 0xca, 0x02, 0x60, 0x6a, 0xbc, 0x8d,
-    0x50, 0x50, 0x8d, 0xbc, 0x6a, 0x6b, 0xba, 0x8d, 0x50, 0x50, 0x8d, 0xba, 0x6b, 0x85, 0xe4, 0xaa,
-    0x5f, 0x5f, 0xaa, 0xe4, 0x85, 0x85, 0xe4, 0xab, 0x60, 0x60, 0xab, 0xe4, 0x02, 0xbe, 0xce, 0x58,
-    0xce, 0xfb, 0xc3, 0xce, 0x58, 0xcd, 0xfe, 0xda, 0xce, 0x58, 0xcd, 0x03, 0x8d, 0xce, 0x57, 0xce,
-    0x00, 0x05, 0x00, 0x18, 0x00, 0x00, 0x04, 0x06, 0x05, 0xb0, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0c,
-    0x00, 0x11, 0x00, 0x15, 0x00, 0x2d, 0x40, 0x16, 0x0b, 0x10, 0x10, 0x06, 0x07, 0x12, 0x15, 0x15,
-    0x08, 0x0e, 0x03, 0x03, 0x02, 0x02, 0x11, 0x14, 0x0c, 0x72, 0x09, 0x11, 0x04, 0x72, 0x00, 0x2b,
-    0x32, 0x2b, 0x12, 0x39, 0x2f, 0x33, 0x12, 0x39, 0x39, 0x32, 0x11, 0x33, 0xce, 0x32, 0x33, 0x11,
-    0x33, 0x30, 0x31, 0x41, 0x15, 0x21, 0x35, 0x01, 0x15, 0x21, 0x35, 0x01, 0x01, 0x33, 0x01, 0x23,
-    0x01, 0x01, 0x17, 0x23, 0x01, 0x01, 0x11, 0x23, 0x11, 0x03, 0xb1, 0xfc, 0xbd, 0x03, 0x43, 0xfc,
-    0xbd, 0x01, 0x94, 0x01, 0x7b, 0x89, 0xfe, 0x43, 0x57, 0xfe, 0xb2, 0x01, 0x7c, 0x0d, 0x57, 0xfe,
-    0x42, 0x02, 0x33, 0x7b, 0x02, 0xc3, 0x5a, 0x5a, 0xfe, 0xdb, 0x5a, 0x5a, 0x01, 0x20, 0x02, 0xf2,
-    0xfc, 0xb9, 0x03, 0x47, 0xfd, 0x0b, 0x52, 0x03, 0x47, 0xfd, 0x2b, 0xfd, 0x25, 0x02, 0xdb, 0x00,
-    0x00, 0x02, 0x00, 0xa0, 0xfe, 0xf2, 0x01, 0x18, 0x05, 0xb0, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0d,
-    0xb4, 0x01, 0x02, 0x06, 0x07, 0x02, 0x00, 0x3f, 0xdd, 0xde, 0xcd, 0x30, 0x31, 0x41, 0x23, 0x11,
-    0x33, 0x11, 0x11, 0x23, 0x11, 0x01, 0x18, 0x78, 0x78, 0x78, 0xfe, 0xf2, 0x03, 0x04, 0x03, 0xba,
-    0xfd, 0x0a, 0x02, 0xf6, 0x00, 0x02, 0x00, 0x67, 0xfe, 0x11, 0x04, 0x60, 0x05, 0xc5, 0x00, 0x2f,
-    0x00, 0x61, 0x00, 0x1e, 0x40, 0x13, 0x53, 0x3f, 0x00, 0x01, 0x05, 0x2b, 0x5d, 0x35, 0x31, 0x30,
-    0x0f, 0x21, 0x0c, 0x4f, 0x44, 0x1d, 0x14, 0x11, 0x72, 0x00, 0x2b, 0x32, 0x2f, 0x33, 0x17, 0x39,
-    0x30, 0x31, 0x65, 0x35, 0x32, 0x36, 0x36, 0x35, 0x34, 0x2e, 0x02, 0x27, 0x2e, 0x03, 0x35, 0x34,
-    0x3e, 0x02, 0x33, 0x32, 0x16, 0x16, 0x15, 0x23, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x15,
-    0x14, 0x1e, 0x02, 0x17, 0x1e, 0x03, 0x15, 0x14, 0x0e, 0x02, 0x01, 0x15, 0x22, 0x06, 0x06, 0x15,
-    0x14, 0x1e, 0x02, 0x17, 0x1e, 0x03, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x37,
-    0x14, 0x1e, 0x02, 0x33, 0x32, 0x36, 0x36, 0x35, 0x34, 0x2e, 0x02, 0x27, 0x2e, 0x03, 0x35, 0x34,
-    0x3e, 0x02, 0x02, 0xb4, 0x63, 0x89, 0x48, 0x27, 0x5d, 0x9c, 0x73, 0x69, 0xa4, 0x72, 0x3c, 0x42,
-    0x7c, 0xad, 0x6c, 0x93, 0xd4, 0x71, 0x77, 0x52, 0x9d, 0x72, 0x79, 0x9c, 0x4a, 0x21, 0x51, 0x92,
-    0x70, 0x70, 0xb0, 0x7a, 0x40, 0x3d, 0x70, 0x9e, 0xfe, 0xf2, 0x64, 0x80, 0x3e, 0x23, 0x59, 0x9d,
-    0x79, 0x6a, 0xa5, 0x72, 0x3b, 0x42, 0x7b, 0xad, 0x6a, 0x5d, 0xb3, 0x92, 0x56, 0x78, 0x44, 0x71,
-    0x88, 0x43, 0x6f, 0x9c, 0x51, 0x22, 0x52, 0x90, 0x6d, 0x6d, 0xb1, 0x7c, 0x43, 0x3a, 0x6b, 0x97,
-    0x85, 0x4e, 0x3a, 0x63, 0x3c, 0x37, 0x53, 0x44, 0x3d, 0x22, 0x1b, 0x41, 0x59, 0x7c, 0x56, 0x51,
-    0x84, 0x5d, 0x33, 0x64, 0xc0, 0x8b, 0x5a, 0x95, 0x59, 0x44, 0x72, 0x45, 0x38, 0x52, 0x41, 0x3a,
-    0x20, 0x1e, 0x42, 0x58, 0x7e, 0x59, 0x44, 0x6f, 0x4e, 0x29, 0x02, 0xcf, 0x4d, 0x3a, 0x65, 0x3f,
-    0x39, 0x54, 0x42, 0x3b, 0x22, 0x1d, 0x42, 0x57, 0x7b, 0x57, 0x54, 0x84, 0x5c, 0x30, 0x2c, 0x64,
-    0xa6, 0x79, 0x02, 0x5e, 0x7f, 0x4c, 0x21, 0x42, 0x71, 0x48, 0x34, 0x50, 0x42, 0x3b, 0x1e, 0x1c,
-    0x44, 0x5c, 0x80, 0x59, 0x46, 0x6f, 0x4e, 0x2a, 0x00, 0x02, 0x00, 0x8a, 0x05, 0x24, 0x02, 0xe5,
-    0x05, 0xc6, 0x00, 0x0b, 0x00, 0x17, 0x00, 0x0e, 0xb4, 0x03, 0x09, 0x09, 0x0f, 0x15, 0x00, 0x2f,
-    0x33, 0x33, 0x2f, 0x33, 0x30, 0x31, 0x53, 0x34, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14, 0x06, 0x23,
-    0x22, 0x26, 0x25, 0x34, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14, 0x06, 0x23, 0x22, 0x26, 0x8a, 0x2c,
-    0x26, 0x26, 0x2d, 0x2d, 0x26, 0x26, 0x2c, 0x01, 0xb6, 0x2b, 0x27, 0x26, 0x2d, 0x2d, 0x26, 0x27,
-    0x2b, 0x05, 0x74, 0x22, 0x30, 0x30, 0x22, 0x21, 0x2e, 0x2e, 0x20, 0x22, 0x30, 0x30, 0x22, 0x21,
-    0x2e, 0x2e, 0x00, 0x03, 0x00, 0x6c, 0xff, 0xeb, 0x05, 0xf7, 0x05, 0xc4, 0x00, 0x1f, 0x00, 0x33,
-    0x00, 0x47, 0x00, 0x1f, 0x40, 0x0e, 0x1d, 0x04, 0x04, 0x25, 0x25, 0x43, 0x14, 0x0d, 0x0d, 0x2f,
-    0x2f, 0x39, 0x03, 0x72, 0x00, 0x2b, 0x32, 0x11, 0x33, 0x11, 0x33, 0x2f, 0x33, 0x11, 0x33, 0x11,
-    0x33, 0x30, 0x31, 0x41, 0x33, 0x14, 0x06, 0x23, 0x22, 0x26, 0x26, 0x35, 0x35, 0x34, 0x36, 0x36,
-    0x33, 0x32, 0x16, 0x15, 0x23, 0x34, 0x26, 0x23, 0x22, 0x06, 0x06, 0x15, 0x15, 0x14, 0x16, 0x16,
-    0x33, 0x32, 0x36, 0x25, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x3e, 0x02, 0x35, 0x34, 0x2e, 0x02, 0x23,
-    0x22, 0x0e, 0x02, 0x07, 0x34, 0x12, 0x36, 0x24, 0x33, 0x32, 0x04, 0x16, 0x12, 0x15, 0x14, 0x02,
-    0x06, 0x04, 0x23, 0x22, 0x24, 0x26, 0x02, 0x03, 0xff, 0x63, 0xaa, 0x91, 0x64, 0x96, 0x53, 0x53,
-    0x96, 0x64, 0x91, 0xab, 0x63, 0x6f, 0x6a, 0x4b, 0x68, 0x36, 0x36, 0x68, 0x4b, 0x6a, 0x6e, 0xfc,
-    0xc2, 0x61, 0xad, 0xe2, 0x81, 0x80, 0xe2, 0xac, 0x61, 0x61, 0xac, 0xe2, 0x80, 0x81, 0xe2, 0xad,
-    0x61, 0x55, 0x6e, 0xc4, 0x01, 0x01, 0x93, 0x93, 0x01, 0x01, 0xc3, 0x6e, 0x6e, 0xc3, 0xfe, 0xff,
-    0x93, 0x93, 0xfe, 0xff, 0xc4, 0x6e, 0x02, 0x5f, 0x9d, 0x9d, 0x62, 0xae, 0x73, 0x61, 0x73, 0xae,
-    0x62, 0x9c, 0x9d, 0x73, 0x6c, 0x4e, 0x86, 0x54, 0x62, 0x54, 0x86, 0x4d, 0x69, 0xef, 0x8b, 0xf1,
-    0xb5, 0x66, 0x66, 0xb5, 0xf1, 0x8b, 0x8c, 0xf0, 0xb4, 0x64, 0x64, 0xb4, 0xf0, 0x8c, 0x9f, 0x01,
-    0x10, 0xcb, 0x71, 0x71, 0xcb, 0xfe, 0xf0, 0x9f, 0x9f, 0xfe, 0xf0, 0xcd, 0x72, 0x72, 0xcd, 0x01,
-    0x10, 0x00, 0x00, 0x02, 0x00, 0x9e, 0x02, 0xb4, 0x02, 0xf9, 0x05, 0xc5, 0x00, 0x17, 0x00, 0x31,
-    0x00, 0x1a, 0xb5, 0x31, 0x1a, 0x1a, 0x0d, 0x16, 0x2a, 0xb8, 0x01, 0x00, 0xb2, 0x08, 0x0d, 0x03,
-    0x00, 0x3f, 0x33, 0x1a, 0xdc, 0xc4, 0x12, 0x39, 0x2f, 0x33, 0x30, 0x31, 0x41, 0x11, 0x34, 0x26,
-    0x26, 0x23, 0x22, 0x06, 0x15, 0x27, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x16, 0x15, 0x11, 0x14,
-    0x16, 0x17, 0x23, 0x26, 0x13, 0x17, 0x23, 0x22, 0x06, 0x06, 0x15, 0x14, 0x16, 0x33, 0x32, 0x36,
-    0x36, 0x35, 0x17, 0x0e, 0x02, 0x23, 0x22, 0x26, 0x35, 0x34, 0x36, 0x36, 0x33, 0x02, 0x72, 0x23,
-    0x48, 0x36, 0x59, 0x68, 0x6b, 0x4b, 0x87, 0x5a, 0x50, 0x7a, 0x44, 0x0d, 0x0d, 0x6f, 0x18, 0x1d,
-    0x01, 0xa8, 0x48, 0x63, 0x33, 0x4c, 0x55, 0x33, 0x63, 0x42, 0x14, 0x0e, 0x45, 0x69, 0x44, 0x79,
-    0x80, 0x4b, 0x93, 0x6b, 0x03, 0x5e, 0x01, 0x54, 0x38, 0x4f, 0x2a, 0x46, 0x48, 0x07, 0x44, 0x69,
-    0x3c, 0x3e, 0x7a, 0x5c, 0xfe, 0xc6, 0x31, 0x58, 0x2c, 0x49, 0x01, 0x6a, 0x53, 0x22, 0x41, 0x2e,
-    0x38, 0x45, 0x31, 0x46, 0x20, 0x52, 0x25, 0x4d, 0x33, 0x77, 0x62, 0x4a, 0x67, 0x37, 0xff, 0xff,
-    0x00, 0x7b, 0x00, 0x94, 0x03, 0x41, 0x03, 0x9d, 0x04, 0x26, 0x01, 0x92, 0x0f, 0xed, 0x00, 0x07,
-    0x01, 0x92, 0x01, 0x44, 0xff, 0xed, 0x00, 0x02, 0x00, 0x7d, 0x01, 0x82, 0x03, 0xa9, 0x03, 0x09,
-    0x00, 0x03, 0x00, 0x07, 0x00, 0x12, 0xb6, 0x06, 0x07, 0x03, 0x06, 0x02, 0x02, 0x03, 0x00, 0x2f,
-    0x33, 0x11, 0x33, 0x12, 0x39, 0x2f, 0x30, 0x31, 0x41, 0x15, 0x21, 0x35, 0x05, 0x11, 0x23, 0x11,
-    0x03, 0xa9, 0xfc, 0xd4, 0x03, 0x2c, 0x78, 0x03, 0x09, 0x6b, 0x6b, 0x3d, 0xfe, 0xb6, 0x01, 0x4a,
-    0x00, 0x04, 0x00, 0x67, 0xff, 0xeb, 0x05, 0xf3, 0x05, 0xc4, 0x00, 0x1e, 0x00, 0x2f, 0x00, 0x43,
-    0x00, 0x57, 0x00, 0x35, 0x40, 0x1b, 0x1f, 0x1b, 0x18, 0x20, 0x04, 0x02, 0x02, 0x01, 0x01, 0x0f,
-    0x29, 0x0d, 0x0d, 0x35, 0x35, 0x53, 0x0c, 0x0f, 0x0f, 0x49, 0x53, 0x13, 0x72, 0x3f, 0x49, 0x03,
-    0x72, 0x00, 0x2b, 0x32, 0x2b, 0x12, 0x39, 0x2f, 0x33, 0x11, 0x33, 0x11, 0x33, 0x2f, 0x33, 0x12,
-    0x39, 0x7d, 0x2f, 0x33, 0x12, 0x17, 0x39, 0x30, 0x31, 0x41, 0x23, 0x27, 0x33, 0x32, 0x36, 0x36,
-    0x35, 0x34, 0x26, 0x26, 0x23, 0x23, 0x11, 0x23, 0x11, 0x21, 0x32, 0x16, 0x16, 0x15, 0x14, 0x06,
-    0x06, 0x07, 0x06, 0x06, 0x23, 0x0e, 0x02, 0x23, 0x37, 0x32, 0x16, 0x15, 0x15, 0x14, 0x16, 0x17,
-    0x15, 0x23, 0x26, 0x26, 0x35, 0x35, 0x34, 0x26, 0x25, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x3e, 0x02,
-    0x35, 0x34, 0x2e, 0x02, 0x23, 0x22, 0x0e, 0x02, 0x07, 0x34, 0x12, 0x36, 0x24, 0x33, 0x32, 0x04,
-    0x16, 0x12, 0x15, 0x14, 0x02, 0x06, 0x04, 0x23, 0x22, 0x24, 0x26, 0x02, 0x03, 0x51, 0xed, 0x02,
-    0xde, 0x32, 0x55, 0x33, 0x26, 0x5b, 0x4e, 0xa0, 0x62, 0x01, 0x02, 0x61, 0x89, 0x47, 0x2f, 0x59,
-    0x3f, 0x03, 0x07, 0x03, 0x11, 0x09, 0x09, 0x1e, 0x0f, 0x90, 0x69, 0x08, 0x09, 0x66, 0x0a, 0x04,
-    0x4b, 0xfd, 0x1b, 0x62, 0xac, 0xe2, 0x81, 0x81, 0xe2, 0xac, 0x61, 0x61, 0xac, 0xe2, 0x81, 0x81,
-    0xe2, 0xac, 0x62, 0x55, 0x6e, 0xc4, 0x01, 0x01, 0x93, 0x93, 0x01, 0x01, 0xc4, 0x6e, 0x6e, 0xc4,
-    0xfe, 0xff, 0x93, 0x93, 0xfe, 0xff, 0xc4, 0x6e, 0x02, 0x9b, 0x5c, 0x23, 0x43, 0x32, 0x38, 0x46,
-    0x21, 0xfd, 0x14, 0x03, 0x47, 0x37, 0x6e, 0x53, 0x36, 0x55, 0x3d, 0x12, 0x01, 0x06, 0x0a, 0x09,
-    0x02, 0x43, 0x82, 0x5e, 0x2d, 0x25, 0x43, 0x17, 0x10, 0x1a, 0x60, 0x16, 0x2b, 0x53, 0x4b, 0x3e,
-    0x8b, 0xf1, 0xb5, 0x66, 0x66, 0xb5, 0xf1, 0x8b, 0x8c, 0xf0, 0xb4, 0x64, 0x64, 0xb4, 0xf0, 0x8c,
-    0x9f, 0x01, 0x10, 0xcb, 0x71, 0x71, 0xcb, 0xfe, 0xf0, 0x9f, 0x9f, 0xfe, 0xf0, 0xcd, 0x72, 0x72,
-    0xcd, 0x01, 0x10, 0x00, 0x00, 0x01, 0x00, 0x8a, 0x05, 0x3f, 0x02, 0xf5, 0x05, 0xa1, 0x00, 0x03,
-    0x00, 0x08, 0xb1, 0x03, 0x02, 0x00, 0x2f, 0x33, 0x30, 0x31, 0x41, 0x15, 0x21, 0x35, 0x02, 0xf5,
-    0xfd, 0x95, 0x05, 0xa1, 0x62, 0x62, 0x00, 0x02, 0x00, 0x90, 0x03, 0xd4, 0x02, 0x77, 0x05, 0xc5,
-    0x00, 0x0f, 0x00, 0x1b, 0x00, 0x0f, 0xb5, 0x13, 0x0c, 0xc0, 0x19, 0x04, 0x03, 0x00, 0x3f, 0x33,
-    0x1a, 0xcc, 0x32, 0x30, 0x31, 0x53, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x16, 0x15, 0x14, 0x06,
-    0x06, 0x23, 0x22, 0x26, 0x26, 0x37, 0x14, 0x16, 0x33, 0x32, 0x36, 0x35, 0x34, 0x26, 0x23, 0x22,
-    0x06, 0x90, 0x43, 0x6f, 0x43, 0x43, 0x6d, 0x42, 0x42, 0x6d, 0x43, 0x43, 0x6f, 0x43, 0x59, 0x5b,
-    0x41, 0x42, 0x56, 0x56, 0x42, 0x41, 0x5b, 0x04, 0xcb, 0x44, 0x72, 0x44, 0x44, 0x72, 0x44, 0x45,
-    0x70, 0x42, 0x42, 0x70, 0x45, 0x43, 0x58, 0x58, 0x43, 0x44, 0x5a, 0x5a, 0x00, 0x03, 0x00, 0x55,
-    0x00, 0x00, 0x03, 0xe9, 0x04, 0xf3, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x12, 0xb7, 0x0b,
-    0x02, 0x03, 0x03, 0x04, 0x0a, 0x12, 0x72, 0x00, 0x2b, 0x2f, 0x39, 0x2f, 0x33, 0x32, 0x30, 0x31,
-    0x41, 0x15, 0x21, 0x35, 0x01, 0x11, 0x23, 0x11, 0x01, 0x15, 0x21, 0x35, 0x03, 0xe9, 0xfc, 0x6c,
-    0x02, 0x0d, 0x6f, 0x01, 0xd1, 0xfc, 0xbd, 0x03, 0x3e, 0x67, 0x67, 0x01, 0xb5, 0xfc, 0x2e, 0x03,
-    0xd2, 0xfb, 0x74, 0x67, 0x67, 0x00, 0x00, 0x01, 0x00, 0x4c, 0x02, 0x9a, 0x02, 0x9b, 0x05, 0xba,
-    0x00, 0x1c, 0x00, 0x13, 0xb1, 0x1c, 0x02, 0xb8, 0x01, 0x00, 0xb3, 0x0b, 0x13, 0x03, 0x72, 0x00,
-    0x2b, 0x32, 0x1a, 0xcc, 0x32, 0x30, 0x31, 0x41, 0x15, 0x21, 0x35, 0x01, 0x3e, 0x02, 0x35, 0x34,
-    0x26, 0x23, 0x22, 0x06, 0x15, 0x23, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x16, 0x15, 0x14, 0x06,
-    0x06, 0x07, 0x07, 0x02, 0x9b, 0xfd, 0xc6, 0x01, 0x21, 0x32, 0x3b, 0x1b, 0x51, 0x4e, 0x5a, 0x5b,
-    0x6a, 0x45, 0x7f, 0x59, 0x53, 0x78, 0x41, 0x32, 0x53, 0x35, 0xd5, 0x02, 0xf2, 0x58, 0x4c, 0x01,
-    0x1b, 0x30, 0x4c, 0x3e, 0x1b, 0x3f, 0x4c, 0x5b, 0x46, 0x45, 0x71, 0x44, 0x37, 0x65, 0x46, 0x33,
-    0x5e, 0x5e, 0x32, 0xc5, 0x00, 0x02, 0x00, 0x48, 0x02, 0x8f, 0x02, 0x8c, 0x05, 0xba, 0x00, 0x19,
-    0x00, 0x33, 0x00, 0x2c, 0x40, 0x0c, 0x1c, 0x18, 0x00, 0x00, 0x1a, 0x1a, 0x10, 0x2c, 0x29, 0x29,
-    0x24, 0x10, 0xb8, 0x01, 0x00, 0xb5, 0x0b, 0x0b, 0x08, 0x10, 0x03, 0x72, 0x00, 0x2b, 0x32, 0x32,
-    0x2f, 0x1a, 0x10, 0xcc, 0x32, 0x2f, 0x32, 0x11, 0x39, 0x2f, 0x33, 0x12, 0x39, 0x39, 0x30, 0x31,
-    0x41, 0x33, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x23, 0x22, 0x06, 0x15, 0x23, 0x34, 0x36, 0x36,
-    0x33, 0x32, 0x16, 0x16, 0x15, 0x14, 0x06, 0x06, 0x23, 0x23, 0x15, 0x35, 0x33, 0x32, 0x16, 0x16,
-    0x15, 0x14, 0x06, 0x06, 0x23, 0x22, 0x26, 0x26, 0x35, 0x33, 0x14, 0x16, 0x33, 0x32, 0x36, 0x35,
-    0x34, 0x26, 0x26, 0x23, 0x01, 0x0c, 0x4e, 0x3d, 0x51, 0x2a, 0x50, 0x57, 0x49, 0x63, 0x69, 0x49,
-    0x7e, 0x4c, 0x53, 0x7b, 0x45, 0x41, 0x7a, 0x56, 0x5f, 0x5f, 0x61, 0x80, 0x40, 0x4b, 0x82, 0x53,
-    0x48, 0x86, 0x56, 0x69, 0x6b, 0x53, 0x56, 0x5d, 0x32, 0x5a, 0x3c, 0x04, 0x54, 0x24, 0x3d, 0x25,
-    0x39, 0x4e, 0x46, 0x3d, 0x43, 0x63, 0x36, 0x34, 0x62, 0x47, 0x34, 0x59, 0x36, 0x18, 0x3b, 0x32,
-    0x5b, 0x3f, 0x47, 0x66, 0x35, 0x31, 0x66, 0x50, 0x3e, 0x51, 0x4d, 0x41, 0x33, 0x3e, 0x1c, 0x00,
-    0x00, 0x01, 0x00, 0x7d, 0x04, 0xe8, 0x01, 0xcd, 0x06, 0x00, 0x00, 0x03, 0x00, 0x0a, 0xb2, 0x01,
-    0x80, 0x00, 0x00, 0x2f, 0x1a, 0xcd, 0x30, 0x31, 0x53, 0x13, 0x33, 0x03, 0x7d, 0xbf, 0x91, 0xe8,
-    0x04, 0xe8, 0x01, 0x18, 0xfe, 0xe8, 0x00, 0x03, 0x00, 0xa3, 0xfe, 0x60, 0x03, 0xd4, 0x04, 0x3a,
-    0x00, 0x04, 0x00, 0x1a, 0x00, 0x1e, 0x00, 0x19, 0x40, 0x0c, 0x1d, 0x05, 0x00, 0x16, 0x0b, 0x13,
-    0x72, 0x03, 0x12, 0x72, 0x1c, 0x00, 0x00, 0x2f, 0x32, 0x2b, 0x2b, 0x32, 0x11, 0x39, 0x2f, 0x30,
-    0x31, 0x41, 0x33, 0x11, 0x23, 0x27, 0x37, 0x37, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x26, 0x26, 0x27,
-    0x27, 0x33, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x3e, 0x02, 0x01, 0x33, 0x11, 0x23, 0x03, 0x5c, 0x78,
-    0x6d, 0x0b, 0x12, 0x3c, 0x2b, 0x5d, 0x92, 0x67, 0x50, 0x8a, 0x61, 0x15, 0x0d, 0x4d, 0x2b, 0x4a,
-    0x5e, 0x35, 0x66, 0x83, 0x48, 0x1c, 0xfd, 0x35, 0x76, 0x76, 0x04, 0x3a, 0xfb, 0xc6, 0xfa, 0xfd,
-    0x02, 0x72, 0xbf, 0x8e, 0x4e, 0x36, 0x80, 0x6e, 0xb2, 0x70, 0x90, 0x50, 0x1f, 0x3f, 0x73, 0x99,
-    0x02, 0x9c, 0xfa, 0x26, 0x00, 0x01, 0x00, 0x54, 0x00, 0x00, 0x03, 0x22, 0x05, 0xb0, 0x00, 0x0c,
-    0x00, 0x0e, 0xb6, 0x03, 0x0b, 0x02, 0x72, 0x00, 0x12, 0x72, 0x00, 0x2b, 0x2b, 0xcd, 0x30, 0x31,
-    0x61, 0x23, 0x11, 0x23, 0x22, 0x26, 0x26, 0x35, 0x34, 0x36, 0x36, 0x33, 0x33, 0x03, 0x22, 0x78,
-    0x6a, 0x9f, 0xdc, 0x71, 0x71, 0xdc, 0x9f, 0xe2, 0x02, 0x08, 0x79, 0xd4, 0x87, 0x86, 0xd4, 0x7a,
-    0x00, 0x01, 0x00, 0xa4, 0x02, 0x7c, 0x01, 0x4e, 0x03, 0x22, 0x00, 0x0b, 0x00, 0x08, 0xb1, 0x03,
-    0x09, 0x00, 0x2f, 0x33, 0x30, 0x31, 0x53, 0x34, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14, 0x06, 0x23,
-    0x22, 0x26, 0xa4, 0x2d, 0x27, 0x28, 0x2e, 0x2e, 0x28, 0x27, 0x2d, 0x02, 0xce, 0x23, 0x31, 0x31,
-    0x23, 0x23, 0x2f, 0x2f, 0x00, 0x01, 0x00, 0x63, 0xfe, 0x4d, 0x01, 0x90, 0x00, 0x00, 0x00, 0x13,
-    0x00, 0x11, 0xb6, 0x0b, 0x0a, 0x80, 0x13, 0x02, 0x00, 0x12, 0x00, 0x3f, 0x32, 0x32, 0x1a, 0xcc,
-    0x32, 0x30, 0x31, 0x73, 0x33, 0x07, 0x16, 0x16, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x27, 0x32, 0x36,
-    0x36, 0x35, 0x34, 0x26, 0x26, 0x27, 0x99, 0x5d, 0x0b, 0x3e, 0x67, 0x27, 0x4c, 0x6d, 0x46, 0x07,
-    0x32, 0x5c, 0x3b, 0x26, 0x4e, 0x3b, 0x40, 0x09, 0x49, 0x59, 0x2d, 0x4a, 0x34, 0x1d, 0x4e, 0x19,
-    0x35, 0x2a, 0x27, 0x2b, 0x16, 0x05, 0x00, 0x01, 0x00, 0x7f, 0x02, 0x9a, 0x01, 0xd0, 0x05, 0xb0,
-    0x00, 0x06, 0x00, 0x0a, 0xb3, 0x06, 0x02, 0x72, 0x01, 0x00, 0x2f, 0x2b, 0x30, 0x31, 0x41, 0x11,
-    0x23, 0x11, 0x07, 0x35, 0x25, 0x01, 0xd0, 0x69, 0xe8, 0x01, 0x44, 0x05, 0xb0, 0xfc, 0xea, 0x02,
-    0x95, 0x45, 0x5b, 0x6b, 0x00, 0x02, 0x00, 0x88, 0x02, 0xb3, 0x03, 0x0e, 0x05, 0xc5, 0x00, 0x11,
-    0x00, 0x23, 0x00, 0x10, 0xb6, 0x17, 0x0e, 0x20, 0x05, 0x03, 0x72, 0x0e, 0x00, 0x2f, 0x2b, 0x32,
-    0x11, 0x33, 0x30, 0x31, 0x53, 0x35, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x16, 0x15, 0x15, 0x14,
-    0x06, 0x06, 0x23, 0x22, 0x26, 0x26, 0x37, 0x15, 0x14, 0x16, 0x16, 0x33, 0x32, 0x36, 0x36, 0x35,
-    0x35, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x88, 0x4f, 0x90, 0x64, 0x64, 0x91, 0x4e, 0x4e,
-    0x90, 0x63, 0x65, 0x91, 0x4f, 0x6c, 0x2e, 0x60, 0x4b, 0x48, 0x5f, 0x2f, 0x30, 0x5f, 0x49, 0x48,
-    0x60, 0x2f, 0x04, 0x0a, 0x63, 0x64, 0x9b, 0x59, 0x59, 0x9b, 0x64, 0x63, 0x64, 0x9b, 0x58, 0x58,
-    0x9b, 0xc7, 0x63, 0x45, 0x70, 0x42, 0x42, 0x70, 0x45, 0x63, 0x44, 0x70, 0x42, 0x42, 0x70, 0x00,
-    0xff, 0xff, 0x00, 0x74, 0x00, 0xa2, 0x03, 0x44, 0x03, 0xb1, 0x04, 0x26, 0x01, 0x93, 0x12, 0x00,
-    0x00, 0x07, 0x01, 0x93, 0x01, 0x51, 0x00, 0x00, 0xff, 0xff, 0x00, 0x73, 0x00, 0x00, 0x05, 0x77,
-    0x05, 0xae, 0x04, 0x27, 0x01, 0xe0, 0xff, 0xf4, 0x02, 0x98, 0x00, 0x27, 0x01, 0x94, 0x01, 0x16,
-    0x00, 0x08, 0x00, 0x07, 0x02, 0x3a, 0x02, 0xc1, 0x00, 0x00, 0xff, 0xff, 0x00, 0x65, 0x00, 0x00,
-    0x05, 0x9d, 0x05, 0xae, 0x04, 0x27, 0x01, 0x94, 0x00, 0xeb, 0x00, 0x08, 0x00, 0x27, 0x01, 0xe0,
-    0xff, 0xe6, 0x02, 0x98, 0x00, 0x07, 0x01, 0xdf, 0x03, 0x02, 0x00, 0x00, 0xff, 0xff, 0x00, 0x76,
-    0x00, 0x00, 0x05, 0xeb, 0x05, 0xba, 0x04, 0x27, 0x01, 0x94, 0x01, 0xa7, 0x00, 0x08, 0x00, 0x27,
-    0x02, 0x3a, 0x03, 0x35, 0x00, 0x00, 0x00, 0x07, 0x02, 0x39, 0x00, 0x2f, 0x02, 0x9a, 0x00, 0x02,
-    0x00, 0x58, 0xfe, 0x81, 0x03, 0x55, 0x04, 0x4e, 0x00, 0x21, 0x00, 0x2d, 0x00, 0x18, 0x40, 0x0a,
-    0x00, 0x00, 0x25, 0x25, 0x2b, 0x10, 0x11, 0x11, 0x0d, 0x16, 0x00, 0x2f, 0x33, 0x33, 0x2f, 0x3f,
-    0x33, 0x2f, 0x33, 0x2f, 0x30, 0x31, 0x41, 0x33, 0x0e, 0x02, 0x07, 0x0e, 0x02, 0x15, 0x14, 0x16,
-    0x16, 0x33, 0x32, 0x36, 0x36, 0x37, 0x33, 0x0e, 0x02, 0x23, 0x22, 0x26, 0x26, 0x35, 0x34, 0x36,
-    0x36, 0x37, 0x3e, 0x02, 0x13, 0x14, 0x06, 0x23, 0x22, 0x26, 0x35, 0x34, 0x36, 0x33, 0x32, 0x16,
-    0x01, 0xb0, 0x78, 0x01, 0x17, 0x3f, 0x3c, 0x34, 0x59, 0x38, 0x3d, 0x75, 0x54, 0x4e, 0x75, 0x43,
-    0x01, 0x78, 0x01, 0x67, 0xac, 0x6b, 0x79, 0xaa, 0x5b, 0x45, 0x71, 0x43, 0x2b, 0x28, 0x0c, 0x88,
-    0x2c, 0x26, 0x27, 0x2c, 0x2c, 0x27, 0x26, 0x2c, 0x02, 0xb0, 0x55, 0x68, 0x58, 0x3c, 0x34, 0x62,
-    0x7a, 0x57, 0x55, 0x78, 0x3f, 0x3e, 0x72, 0x50, 0x75, 0xa3, 0x53, 0x5b, 0xa8, 0x72, 0x60, 0x9c,
-    0x86, 0x3e, 0x25, 0x4a, 0x56, 0x01, 0x83, 0x22, 0x2f, 0x2f, 0x22, 0x21, 0x2f, 0x2f, 0x00, 0x06,
-    0x00, 0x12, 0x00, 0x00, 0x07, 0x20, 0x05, 0xb0, 0x00, 0x04, 0x00, 0x08, 0x00, 0x0c, 0x00, 0x10,
-    0x00, 0x14, 0x00, 0x18, 0x00, 0x31, 0x40, 0x18, 0x00, 0x17, 0x17, 0x08, 0x07, 0x14, 0x13, 0x07,
-    0x13, 0x07, 0x13, 0x02, 0x0d, 0x03, 0x18, 0x02, 0x72, 0x0c, 0x0b, 0x0b, 0x0e, 0x02, 0x08, 0x72,
-    0x00, 0x2b, 0x32, 0x32, 0x11, 0x33, 0x2b, 0x32, 0x32, 0x11, 0x39, 0x39, 0x2f, 0x2f, 0x11, 0x33,
-    0x11, 0x33, 0x32, 0x11, 0x33, 0x30, 0x31, 0x41, 0x01, 0x23, 0x01, 0x33, 0x13, 0x15, 0x21, 0x35,
-    0x01, 0x15, 0x21, 0x35, 0x03, 0x13, 0x23, 0x03, 0x01, 0x15, 0x21, 0x35, 0x01, 0x15, 0x21, 0x35,
-    0x03, 0xc7, 0xfc, 0xdd, 0x92, 0x03, 0x71, 0x54, 0x4c, 0xfd, 0x48, 0x05, 0xb5, 0xfd, 0x23, 0x1a,
-    0x3d, 0x78, 0x3d, 0x02, 0xe0, 0xfd, 0x8a, 0x02, 0xc8, 0xfd, 0x23, 0x05, 0x4e, 0xfa, 0xb2, 0x05,
-    0xb0, 0xfc, 0x47, 0x72, 0x72, 0xfe, 0x70, 0x67, 0x67, 0x05, 0x49, 0xfa, 0x50, 0x05, 0xb0, 0xfd,
-    0x7a, 0x67, 0x67, 0x02, 0x86, 0x67, 0x67, 0x00, 0x00, 0x02, 0x00, 0x5e, 0x00, 0x67, 0x03, 0xc7,
-    0x03, 0xd2, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0c, 0xb3, 0x04, 0x06, 0x02, 0x00, 0x00, 0x2f, 0x2f,
-    0x33, 0x32, 0x30, 0x31, 0x77, 0x27, 0x01, 0x17, 0x03, 0x01, 0x37, 0x01, 0xad, 0x4f, 0x03, 0x0b,
-    0x4f, 0x40, 0xfc, 0xf5, 0x4f, 0x03, 0x0b, 0x67, 0x50, 0x03, 0x1b, 0x51, 0xfc, 0xe6, 0x03, 0x1a,
-    0x51, 0xfc, 0xe5, 0x00, 0x00, 0x03, 0x00, 0x7e, 0xff, 0xac, 0x04, 0xfb, 0x05, 0xe2, 0x00, 0x03,
-    0x00, 0x1b, 0x00, 0x33, 0x00, 0x17, 0x40, 0x0b, 0x01, 0x00, 0x2f, 0x0a, 0x23, 0x16, 0x03, 0x72,
-    0x0a, 0x09, 0x72, 0x00, 0x2b, 0x2b, 0x32, 0x11, 0x33, 0x32, 0x33, 0x30, 0x31, 0x41, 0x01, 0x23,
-    0x01, 0x13, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x03, 0x35, 0x35, 0x34, 0x3e, 0x02, 0x33,
-    0x32, 0x1e, 0x03, 0x03, 0x35, 0x34, 0x2e, 0x03, 0x23, 0x22, 0x0e, 0x02, 0x15, 0x15, 0x14, 0x1e,
-    0x03, 0x33, 0x32, 0x3e, 0x02, 0x04, 0xfb, 0xfc, 0x18, 0x68, 0x03, 0xe9, 0x59, 0x50, 0x94, 0xd1,
-    0x81, 0x66, 0xaf, 0x8c, 0x63, 0x35, 0x51, 0x96, 0xd1, 0x7f, 0x67, 0xb0, 0x8b, 0x62, 0x34, 0x7b,
-    0x26, 0x4b, 0x6c, 0x8c, 0x54, 0x68, 0xa4, 0x73, 0x3d, 0x28, 0x4c, 0x6c, 0x8b, 0x53, 0x6a, 0xa4,
-    0x72, 0x3b, 0x05, 0xe2, 0xf9, 0xca, 0x06, 0x36, 0xfd, 0x44, 0x9b, 0x99, 0xf8, 0xb0, 0x5e, 0x3d,
-    0x73, 0xa5, 0xcf, 0x7b, 0x9b, 0x99, 0xf7, 0xb0, 0x5e, 0x3d, 0x73, 0xa4, 0xd0, 0xfe, 0xeb, 0x9d,
-    0x67, 0xad, 0x89, 0x60, 0x32, 0x4e, 0x92, 0xce, 0x81, 0x9d, 0x68, 0xaf, 0x89, 0x60, 0x32, 0x4e,
-    0x92, 0xd0, 0x00, 0x02, 0x00, 0xb8, 0x00, 0x00, 0x04, 0x48, 0x05, 0xb0, 0x00, 0x03, 0x00, 0x19,
-    0x00, 0x1d, 0x40, 0x0e, 0x0f, 0x0e, 0x0e, 0x03, 0x19, 0x04, 0x04, 0x03, 0x00, 0x02, 0x72, 0x03,
-    0x08, 0x72, 0x00, 0x2b, 0x2b, 0x11, 0x39, 0x2f, 0x33, 0x11, 0x39, 0x2f, 0x33, 0x30, 0x31, 0x53,
-    0x33, 0x11, 0x23, 0x13, 0x21, 0x32, 0x16, 0x16, 0x15, 0x14, 0x06, 0x06, 0x23, 0x21, 0x35, 0x21,
-    0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x21, 0xb8, 0x77, 0x77, 0x37, 0x01, 0x85, 0x98,
-    0xd0, 0x6c, 0x6c, 0xd0, 0x98, 0xfe, 0x92, 0x01, 0x6e, 0x7c, 0x9a, 0x47, 0x47, 0x9a, 0x7c, 0xfe,
-    0xaf, 0x05, 0xb0, 0xfa, 0x50, 0x04, 0x81, 0x6c, 0xbb, 0x78, 0x77, 0xbb, 0x6c, 0x67, 0x5c, 0x8e,
-    0x4b, 0x4f, 0x90, 0x5c, 0x00, 0x01, 0x00, 0x98, 0xff, 0xec, 0x04, 0x48, 0x06, 0x09, 0x00, 0x39,
-    0x00, 0x19, 0x40, 0x0d, 0x23, 0x1b, 0x36, 0x08, 0x02, 0x0a, 0x72, 0x08, 0x01, 0x72, 0x1b, 0x0b,
-    0x72, 0x00, 0x2b, 0x2b, 0x2b, 0x11, 0x33, 0x11, 0x33, 0x30, 0x31, 0x41, 0x11, 0x23, 0x11, 0x34,
-    0x3e, 0x02, 0x33, 0x32, 0x16, 0x16, 0x15, 0x14, 0x0e, 0x02, 0x15, 0x14, 0x1e, 0x03, 0x15, 0x14,
-    0x06, 0x06, 0x23, 0x22, 0x26, 0x26, 0x27, 0x37, 0x16, 0x16, 0x33, 0x32, 0x36, 0x36, 0x35, 0x34,
-    0x2e, 0x03, 0x35, 0x34, 0x3e, 0x02, 0x35, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x01, 0x0f,
-    0x77, 0x32, 0x5e, 0x86, 0x53, 0x5e, 0x9c, 0x5e, 0x26, 0x30, 0x26, 0x49, 0x6d, 0x6c, 0x49, 0x6b,
-    0xac, 0x61, 0x38, 0x7a, 0x65, 0x1a, 0x21, 0x26, 0x92, 0x4b, 0x56, 0x79, 0x3f, 0x49, 0x6c, 0x6d,
-    0x49, 0x26, 0x31, 0x26, 0x3c, 0x62, 0x3a, 0x4d, 0x71, 0x3e, 0x04, 0x68, 0xfb, 0x98, 0x04, 0x68,
-    0x66, 0x9c, 0x69, 0x36, 0x47, 0x89, 0x64, 0x4b, 0x65, 0x52, 0x5a, 0x40, 0x3b, 0x5b, 0x52, 0x5b,
-    0x73, 0x50, 0x6b, 0x92, 0x4a, 0x16, 0x25, 0x15, 0x66, 0x1a, 0x36, 0x3e, 0x66, 0x3d, 0x3f, 0x5f,
-    0x53, 0x59, 0x70, 0x4e, 0x44, 0x62, 0x53, 0x5c, 0x3e, 0x41, 0x5f, 0x34, 0x40, 0x8b, 0x00, 0x03,
-    0x00, 0x56, 0xff, 0xec, 0x06, 0x7b, 0x04, 0x4f, 0x00, 0x14, 0x00, 0x32, 0x00, 0x5e, 0x00, 0x37,
-    0x40, 0x1c, 0x57, 0x33, 0x33, 0x32, 0x17, 0x46, 0x45, 0x14, 0x25, 0x00, 0x03, 0x29, 0x17, 0x45,
-    0x17, 0x45, 0x0f, 0x1f, 0x29, 0x0b, 0x72, 0x4c, 0x3e, 0x3e, 0x05, 0x0f, 0x07, 0x72, 0x00, 0x2b,
-    0x32, 0x32, 0x11, 0x33, 0x2b, 0x32, 0x12, 0x39, 0x39, 0x2f, 0x2f, 0x12, 0x17, 0x39, 0x11, 0x33,
-    0x11, 0x33, 0x32, 0x11, 0x33, 0x30, 0x31, 0x65, 0x11, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06,
-    0x15, 0x27, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x16, 0x16, 0x15, 0x11, 0x03, 0x15, 0x21, 0x22, 0x06,
-    0x06, 0x15, 0x14, 0x16, 0x16, 0x33, 0x32, 0x3e, 0x02, 0x37, 0x17, 0x0e, 0x02, 0x23, 0x22, 0x26,
-    0x26, 0x35, 0x34, 0x3e, 0x02, 0x33, 0x01, 0x22, 0x2e, 0x02, 0x35, 0x35, 0x34, 0x3e, 0x02, 0x17,
-    0x32, 0x1e, 0x02, 0x15, 0x15, 0x21, 0x35, 0x21, 0x35, 0x34, 0x26, 0x26, 0x23, 0x22, 0x0e, 0x02,
-    0x15, 0x15, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x36, 0x37, 0x17, 0x0e, 0x02, 0x03, 0x0d, 0x38, 0x71,
-    0x54, 0x5c, 0x85, 0x46, 0x77, 0x3b, 0x6d, 0x98, 0x5e, 0x70, 0xa6, 0x5d, 0x55, 0xfe, 0xe1, 0x6c,
-    0x8e, 0x47, 0x39, 0x71, 0x53, 0x3f, 0x78, 0x61, 0x3c, 0x04, 0x4c, 0x1a, 0x71, 0xb1, 0x7a, 0x72,
-    0x9e, 0x53, 0x38, 0x6f, 0xa4, 0x6c, 0x02, 0xe5, 0x74, 0xb3, 0x7a, 0x3e, 0x43, 0x7a, 0xa4, 0x60,
-    0x66, 0x9d, 0x6c, 0x38, 0xfc, 0xdb, 0x02, 0xad, 0x40, 0x86, 0x69, 0x4f, 0x7c, 0x56, 0x2d, 0x2a,
-    0x58, 0x8a, 0x60, 0x71, 0x9c, 0x36, 0x30, 0x1d, 0x60, 0x91, 0xb7, 0x02, 0x19, 0x58, 0x7d, 0x42,
-    0x3e, 0x6a, 0x41, 0x0c, 0x46, 0x76, 0x58, 0x30, 0x56, 0xaa, 0x80, 0xfe, 0x0c, 0x01, 0x9f, 0x61,
-    0x45, 0x6f, 0x42, 0x3e, 0x5e, 0x35, 0x29, 0x40, 0x45, 0x1d, 0x4d, 0x33, 0x6a, 0x46, 0x4d, 0x8e,
-    0x5f, 0x4e, 0x7d, 0x59, 0x2f, 0xfd, 0x73, 0x4e, 0x8f, 0xc2, 0x73, 0x36, 0x77, 0xc5, 0x90, 0x4f,
-    0x01, 0x40, 0x79, 0xab, 0x6c, 0x64, 0x62, 0x20, 0x5c, 0x96, 0x59, 0x43, 0x78, 0x9d, 0x5b, 0x36,
-    0x59, 0x9b, 0x75, 0x42, 0x48, 0x2e, 0x59, 0x1a, 0x3e, 0x2c, 0x00, 0x02, 0x00, 0x96, 0xff, 0xec,
-    0x04, 0x20, 0x06, 0x2b, 0x00, 0x34, 0x00, 0x38, 0x00, 0x19, 0x40, 0x0b, 0x36, 0x20, 0x16, 0x16,
-    0x01, 0x2a, 0x0c, 0x0b, 0x72, 0x38, 0x01, 0x00, 0x2f, 0x33, 0x2b, 0x32, 0x12, 0x39, 0x2f, 0x33,
-    0x33, 0x30, 0x31, 0x41, 0x37, 0x16, 0x04, 0x16, 0x12, 0x15, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x22,
-    0x2e, 0x02, 0x35, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x16, 0x16, 0x15, 0x07, 0x34, 0x2e, 0x02, 0x23,
-    0x22, 0x0e, 0x02, 0x15, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x3e, 0x02, 0x35, 0x35, 0x34, 0x02, 0x26,
-    0x26, 0x05, 0x01, 0x27, 0x01, 0x01, 0x29, 0x26, 0xab, 0x01, 0x0b, 0xba, 0x61, 0x41, 0x76, 0xa1,
-    0x60, 0x67, 0xab, 0x7c, 0x44, 0x3e, 0x74, 0xa1, 0x63, 0x70, 0xbf, 0x74, 0x32, 0x2a, 0x56, 0x83,
-    0x58, 0x56, 0x80, 0x54, 0x2a, 0x2e, 0x59, 0x82, 0x55, 0x49, 0x74, 0x53, 0x2c, 0x63, 0xb0, 0xe7,
-    0x02, 0x30, 0xfe, 0x06, 0x32, 0x01, 0xf9, 0x05, 0xc2, 0x69, 0x32, 0xa9, 0xed, 0xfe, 0xcc, 0xbf,
-    0x59, 0x7b, 0xcc, 0x94, 0x50, 0x4b, 0x85, 0xb1, 0x66, 0x74, 0xb8, 0x82, 0x45, 0x61, 0xa6, 0x69,
-    0x04, 0x28, 0x5d, 0x52, 0x34, 0x3a, 0x6a, 0x90, 0x56, 0x47, 0x88, 0x6e, 0x41, 0x43, 0x7a, 0xa4,
-    0x61, 0x5b, 0xbf, 0x01, 0x1a, 0xc8, 0x85, 0x11, 0xfe, 0xc5, 0x4a, 0x01, 0x3b, 0x00, 0x00, 0x03,
-    0x00, 0x48, 0x00, 0xd1, 0x04, 0x2e, 0x04, 0x95, 0x00, 0x03, 0x00, 0x0f, 0x00, 0x1b, 0x00, 0x13,
-    0xb7, 0x19, 0x13, 0x02, 0x07, 0x0d, 0x03, 0x02, 0x12, 0x00, 0x3f, 0xdd, 0xc6, 0x32, 0x10, 0xc6,
-    0x32, 0x30, 0x31, 0x41, 0x15, 0x21, 0x35, 0x01, 0x34, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14, 0x06,
-    0x23, 0x22, 0x26, 0x11, 0x34, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14, 0x06, 0x23, 0x22, 0x26, 0x04,
-    0x2e, 0xfc, 0x1a, 0x01, 0xa8, 0x2d, 0x27, 0x28, 0x2e, 0x2e, 0x28, 0x27, 0x2d, 0x2d, 0x27, 0x28,
-    0x2e, 0x2e, 0x28, 0x27, 0x2d, 0x02, 0xf9, 0x76, 0x76, 0x01, 0x48, 0x23, 0x31, 0x31, 0x23, 0x23,
-    0x2f, 0x2f, 0xfd, 0x06, 0x23, 0x31, 0x31, 0x23, 0x23, 0x30, 0x30, 0x00, 0x00, 0x03, 0x00, 0x5a,
-    0xff, 0x74, 0x04, 0x1f, 0x04, 0xbe, 0x00, 0x03, 0x00, 0x19, 0x00, 0x2f, 0x00, 0x19, 0x40, 0x0c,
-    0x20, 0x01, 0x01, 0x15, 0x0b, 0x72, 0x2b, 0x00, 0x00, 0x0a, 0x07, 0x72, 0x00, 0x2b, 0x32, 0x2f,
-    0x32, 0x2b, 0x32, 0x2f, 0x32, 0x30, 0x31, 0x41, 0x01, 0x23, 0x01, 0x01, 0x35, 0x34, 0x3e, 0x02,
-    0x33, 0x32, 0x1e, 0x02, 0x15, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x37, 0x15, 0x14,
-    0x1e, 0x02, 0x33, 0x32, 0x3e, 0x02, 0x35, 0x35, 0x34, 0x2e, 0x02, 0x23, 0x22, 0x0e, 0x02, 0x03,
-    0xbd, 0xfd, 0x69, 0x5d, 0x02, 0x97, 0xfc, 0xfa, 0x44, 0x7f, 0xb2, 0x6d, 0x6e, 0xb2, 0x7f, 0x44,
-    0x44, 0x7e, 0xb2, 0x6d, 0x6e, 0xb2, 0x80, 0x44, 0x77, 0x30, 0x5c, 0x88, 0x59, 0x57, 0x87, 0x5c,
-    0x30, 0x30, 0x5d, 0x87, 0x58, 0x58, 0x87, 0x5d, 0x2f, 0x04, 0xbe, 0xfa, 0xb6, 0x05, 0x4a, 0xfd,
-    0x4f, 0x20, 0x76, 0xc8, 0x92, 0x51, 0x51, 0x92, 0xc8, 0x76, 0x20, 0x76, 0xc7, 0x93, 0x51, 0x51,
-    0x93, 0xc7, 0x96, 0x20, 0x59, 0x9f, 0x7b, 0x47, 0x47, 0x7b, 0x9f, 0x59, 0x20, 0x58, 0x9e, 0x7c,
-    0x48, 0x48, 0x7c, 0x9e, 0x00, 0x03, 0x00, 0xa0, 0xfe, 0x60, 0x04, 0x08, 0x06, 0x00, 0x00, 0x03,
-    0x00, 0x19, 0x00, 0x2f, 0x00, 0x1b, 0x40, 0x0f, 0x2b, 0x0a, 0x20, 0x15, 0x07, 0x72, 0x0a, 0x0b,
-    0x72, 0x03, 0x00, 0x72, 0x02, 0x0e, 0x72, 0x00, 0x2b, 0x2b, 0x2b, 0x2b, 0x32, 0x11, 0x33, 0x30,
-    0x31, 0x41, 0x11, 0x23, 0x11, 0x01, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x27, 0x11,
-    0x3e, 0x03, 0x33, 0x32, 0x1e, 0x02, 0x07, 0x35, 0x34, 0x2e, 0x02, 0x23, 0x22, 0x0e, 0x02, 0x07,
-    0x11, 0x1e, 0x03, 0x33, 0x32, 0x3e, 0x02, 0x01, 0x18, 0x78, 0x03, 0x68, 0x38, 0x69, 0x9a, 0x62,
-    0x61, 0x98, 0x6d, 0x41, 0x0d, 0x0f, 0x44, 0x6b, 0x94, 0x5f, 0x63, 0x9b, 0x6b, 0x37, 0x79, 0x26,
-    0x4f, 0x7a, 0x52, 0x56, 0x79, 0x50, 0x2e, 0x0b, 0x0f, 0x35, 0x54, 0x75, 0x4d, 0x52, 0x78, 0x4f,
-    0x26, 0x06, 0x00, 0xf8, 0x60, 0x07, 0xa0, 0xfc, 0x27, 0x15, 0x79, 0xc9, 0x93, 0x51, 0x3c, 0x6f,
-    0x96, 0x59, 0x01, 0x14, 0x62, 0xa0, 0x74, 0x3e, 0x4d, 0x91, 0xcb, 0x93, 0x15, 0x5f, 0xa2, 0x79,
-    0x44, 0x39, 0x5d, 0x6e, 0x35, 0xfe, 0xc1, 0x39, 0x66, 0x4e, 0x2d, 0x45, 0x79, 0xa3, 0x00, 0x04,
-    0x00, 0x6d, 0xff, 0xec, 0x04, 0x82, 0x06, 0x00, 0x00, 0x04, 0x00, 0x1a, 0x00, 0x2f, 0x00, 0x33,
-    0x00, 0x1d, 0x40, 0x0f, 0x21, 0x04, 0x04, 0x16, 0x0b, 0x72, 0x33, 0x32, 0x2b, 0x0b, 0x07, 0x72,
-    0x01, 0x00, 0x72, 0x00, 0x2b, 0x2b, 0x32, 0xce, 0x32, 0x2b, 0x32, 0x2f, 0x32, 0x30, 0x31, 0x65,
-    0x11, 0x33, 0x11, 0x23, 0x01, 0x35, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x1e, 0x02, 0x17, 0x11, 0x0e,
-    0x03, 0x23, 0x22, 0x2e, 0x02, 0x37, 0x15, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x36, 0x36, 0x37, 0x11,
-    0x2e, 0x03, 0x23, 0x22, 0x0e, 0x02, 0x01, 0x15, 0x21, 0x35, 0x03, 0x5c, 0x78, 0x70, 0xfd, 0x09,
-    0x3a, 0x6d, 0x9a, 0x61, 0x5f, 0x92, 0x69, 0x41, 0x0f, 0x0c, 0x40, 0x6a, 0x95, 0x61, 0x60, 0x9a,
-    0x6c, 0x3a, 0x79, 0x26, 0x4e, 0x78, 0x51, 0x67, 0x8c, 0x54, 0x13, 0x0c, 0x2e, 0x4f, 0x79, 0x56,
-    0x52, 0x79, 0x4e, 0x26, 0x03, 0x9c, 0xfd, 0x9c, 0xd2, 0x05, 0x2e, 0xfa, 0x00, 0x02, 0x12, 0x15,
-    0x7e, 0xcb, 0x91, 0x4d, 0x3e, 0x74, 0xa0, 0x62, 0xfe, 0xf5, 0x5b, 0x9a, 0x70, 0x3e, 0x51, 0x93,
-    0xc9, 0x8e, 0x15, 0x5e, 0xa2, 0x79, 0x43, 0x4f, 0x83, 0x4e, 0x01, 0x36, 0x35, 0x6e, 0x5d, 0x39,
-    0x44, 0x79, 0xa2, 0x02, 0xca, 0x67, 0x67, 0x00, 0x00, 0x04, 0x00, 0x19, 0x00, 0x00, 0x05, 0x69,
-    0x05, 0xb0, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x1f, 0x40, 0x0f, 0x03, 0x02,
-    0x80, 0x07, 0x06, 0x06, 0x0a, 0x0c, 0x0b, 0x02, 0x72, 0x0d, 0x0a, 0x08, 0x72, 0x00, 0x2b, 0x32,
-    0x2b, 0x32, 0x11, 0x39, 0x2f, 0x33, 0x1a, 0xcc, 0x32, 0x30, 0x31, 0x41, 0x15, 0x21, 0x35, 0x01,
-    0x15, 0x21, 0x35, 0x13, 0x11, 0x23, 0x11, 0x21, 0x11, 0x23, 0x11, 0x05, 0x69, 0xfa, 0xb0, 0x04,
-    0x5b, 0xfc, 0x8c, 0x1d, 0x7b, 0x04, 0x36, 0x7b, 0x04, 0x64, 0x62, 0x62, 0xfe, 0xbf, 0x69, 0x69,
-    0x02, 0x8d, 0xfa, 0x50, 0x05, 0xb0, 0xfa, 0x50, 0x05, 0xb0, 0x00, 0x01, 0x00, 0xa9, 0x00, 0x00,
-    0x01, 0x20, 0x04, 0x3a, 0x00, 0x03, 0x00, 0x0c, 0xb5, 0x03, 0x06, 0x72, 0x02, 0x0a, 0x72, 0x00,
-    0x2b, 0x2b, 0x30, 0x31, 0x41, 0x11, 0x23, 0x11, 0x01, 0x20, 0x77, 0x04, 0x3a, 0xfb, 0xc6, 0x04,
-    0x3a, 0x00, 0x00, 0x03, 0x00, 0xa3, 0x00, 0x00, 0x04, 0x21, 0x04, 0x3a, 0x00, 0x03, 0x00, 0x09,
-    0x00, 0x0d, 0x00, 0x1f, 0x40, 0x0f, 0x0c, 0x07, 0x07, 0x0b, 0x06, 0x06, 0x02, 0x09, 0x03, 0x06,
-    0x72, 0x0a, 0x02, 0x0a, 0x72, 0x00, 0x2b, 0x32, 0x2b, 0x32, 0x11, 0x39, 0x2f, 0x33, 0x33, 0x11,
-    0x33, 0x30, 0x31, 0x41, 0x11, 0x23, 0x11, 0x21, 0x01, 0x23, 0x27, 0x33, 0x01, 0x13, 0x01, 0x37,
-    0x01, 0x01, 0x1b, 0x78, 0x03, 0x4c, 0xfd, 0xeb, 0xe9, 0x0c, 0xbd, 0x01, 0xbb, 0x2b, 0xfe, 0x0f,
-    0x4b, 0x02, 0x3f, 0x04, 0x3a, 0xfb, 0xc6, 0x04, 0x3a, 0xfd, 0xb6, 0x6b, 0x01, 0xdf, 0xfb, 0xc6,
-    0x02, 0x00, 0x5c, 0xfd, 0xa4, 0x00, 0x00, 0x03, 0x00, 0x16, 0x00, 0x00, 0x03, 0xff, 0x05, 0xb0,
-    0x00, 0x03, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x1b, 0x40, 0x0d, 0x02, 0x0a, 0x00, 0x07, 0x06, 0x06,
-    0x0a, 0x0b, 0x02, 0x72, 0x0a, 0x08, 0x72, 0x00, 0x2b, 0x2b, 0x11, 0x33, 0x11, 0x33, 0x32, 0x11,
-    0x33, 0x30, 0x31, 0x41, 0x15, 0x05, 0x35, 0x01, 0x15, 0x21, 0x35, 0x13, 0x11, 0x23, 0x11, 0x02,
-    0x63, 0xfd, 0xb3, 0x03, 0xe9, 0xfd, 0x0d, 0x24, 0x7b, 0x03, 0x93, 0x5b, 0xbb, 0x5b, 0xfd, 0x92,
-    0x6a, 0x6a, 0x05, 0x46, 0xfa, 0x50, 0x05, 0xb0, 0x00, 0x02, 0x00, 0x1a, 0x00, 0x00, 0x01, 0xf9,
-    0x06, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x13, 0x40, 0x09, 0x02, 0x06, 0x00, 0x07, 0x00, 0x72,
-    0x06, 0x0a, 0x72, 0x00, 0x2b, 0x2b, 0x32, 0x11, 0x33, 0x30, 0x31, 0x41, 0x15, 0x05, 0x35, 0x01,
-    0x11, 0x23, 0x11, 0x01, 0xf9, 0xfe, 0x21, 0x01, 0x2b, 0x77, 0x03, 0xa2, 0x5a, 0xbb, 0x5a, 0x03,
-    0x19, 0xfa, 0x00, 0x06, 0x00, 0x00, 0x00, 0x03, 0x00, 0xb5, 0xfe, 0x4b, 0x04, 0xea, 0x05, 0xb0,
-    0x00, 0x03, 0x00, 0x07, 0x00, 0x19, 0x00, 0x1d, 0x40, 0x0e, 0x15, 0x0e, 0x06, 0x07, 0x07, 0x03,
-    0x08, 0x72, 0x09, 0x05, 0x04, 0x00, 0x02, 0x72, 0x00, 0x2b, 0x32, 0x32, 0x32, 0x2b, 0x32, 0x11,
-    0x33, 0x2f, 0x33, 0x30, 0x31, 0x53, 0x33, 0x11, 0x23, 0x13, 0x37, 0x01, 0x07, 0x11, 0x33, 0x11,
-    0x14, 0x06, 0x06, 0x23, 0x22, 0x26, 0x27, 0x37, 0x16, 0x16, 0x33, 0x32, 0x36, 0x36, 0x35, 0xb5,
-    0x7c, 0x7c, 0x24, 0x58, 0x03, 0x95, 0x58, 0x7c, 0x4a, 0x89, 0x5f, 0x1f, 0x35, 0x1e, 0x0e, 0x10,
-    0x3d, 0x15, 0x3b, 0x52, 0x2b, 0x05, 0xb0, 0xfa, 0x50, 0x05, 0x66, 0x4a, 0xfa, 0x9a, 0x4a, 0x05,
-    0xb0, 0xf9, 0xfa, 0x71, 0x9d, 0x51, 0x09, 0x0a, 0x67, 0x06, 0x0a, 0x3a, 0x6d, 0x4e, 0x00, 0x02,
-    0x00, 0x9e, 0xfe, 0x4b, 0x03, 0xd6, 0x04, 0x4e, 0x00, 0x04, 0x00, 0x2a, 0x00, 0x19, 0x40, 0x0e,
-    0x1c, 0x15, 0x0f, 0x72, 0x26, 0x0b, 0x07, 0x72, 0x03, 0x06, 0x72, 0x02, 0x0a, 0x72, 0x00, 0x2b,
-    0x2b, 0x2b, 0x32, 0x2b, 0x32, 0x30, 0x31, 0x41, 0x11, 0x23, 0x11, 0x33, 0x03, 0x07, 0x34, 0x3e,
-    0x02, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x11, 0x14, 0x06, 0x06, 0x23, 0x22, 0x26, 0x27, 0x37, 0x16,
-    0x16, 0x33, 0x32, 0x36, 0x36, 0x35, 0x11, 0x34, 0x2e, 0x02, 0x23, 0x22, 0x0e, 0x02, 0x01, 0x16,
-    0x78, 0x6b, 0x14, 0x2c, 0x36, 0x6a, 0x9d, 0x68, 0x55, 0x86, 0x5d, 0x30, 0x49, 0x88, 0x5f, 0x22,
-    0x3a, 0x20, 0x0e, 0x11, 0x45, 0x18, 0x3b, 0x52, 0x2b, 0x26, 0x48, 0x61, 0x3c, 0x63, 0x86, 0x51,
-    0x24, 0x03, 0x53, 0xfc, 0xad, 0x04, 0x3a, 0xfd, 0xfb, 0x01, 0x76, 0xc5, 0x90, 0x4f, 0x32, 0x6b,
-    0xa8, 0x75, 0xfd, 0x13, 0x70, 0x9c, 0x50, 0x09, 0x0a, 0x68, 0x06, 0x09, 0x37, 0x6c, 0x4d, 0x02,
-    0xec, 0x62, 0x83, 0x4c, 0x21, 0x49, 0x7b, 0x9a, 0x00, 0x05, 0x00, 0x6d, 0xff, 0xeb, 0x07, 0x09,
-    0x05, 0xc5, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2b, 0x00, 0x2f, 0x00, 0x33, 0x00, 0x33, 0x40, 0x1a,
-    0x2f, 0x2e, 0x2e, 0x26, 0x32, 0x28, 0x33, 0x02, 0x72, 0x29, 0x27, 0x26, 0x08, 0x72, 0x15, 0x12,
-    0x12, 0x16, 0x19, 0x09, 0x04, 0x07, 0x07, 0x03, 0x00, 0x03, 0x00, 0x3f, 0x32, 0x32, 0x11, 0x33,
-    0x3f, 0x33, 0x33, 0x11, 0x33, 0x2b, 0x32, 0x32, 0x2b, 0x32, 0x32, 0x11, 0x39, 0x2f, 0x33, 0x30,
-    0x31, 0x41, 0x32, 0x16, 0x17, 0x15, 0x26, 0x26, 0x23, 0x22, 0x0e, 0x02, 0x15, 0x11, 0x14, 0x1e,
-    0x02, 0x33, 0x32, 0x36, 0x37, 0x15, 0x06, 0x06, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x11, 0x34, 0x3e,
-    0x02, 0x01, 0x15, 0x21, 0x35, 0x13, 0x11, 0x23, 0x11, 0x01, 0x15, 0x21, 0x35, 0x01, 0x15, 0x21,
-    0x35, 0x02, 0x85, 0x52, 0x9f, 0x48, 0x46, 0x9f, 0x54, 0x60, 0x99, 0x6e, 0x3a, 0x3b, 0x6e, 0x9a,
-    0x60, 0x51, 0xa3, 0x43, 0x48, 0x9d, 0x52, 0x78, 0xc5, 0x90, 0x4d, 0x4d, 0x8e, 0xc5, 0x04, 0xfc,
-    0xfc, 0xcd, 0x25, 0x7b, 0x03, 0x23, 0xfd, 0x33, 0x03, 0x2e, 0xfc, 0xd2, 0x05, 0xc5, 0x0d, 0x08,
-    0x69, 0x0c, 0x0b, 0x43, 0x80, 0xb6, 0x73, 0xfe, 0xce, 0x71, 0xb7, 0x81, 0x45, 0x0c, 0x0c, 0x6a,
-    0x07, 0x0e, 0x57, 0x9f, 0xdb, 0x84, 0x01, 0x30, 0x84, 0xdb, 0x9f, 0x57, 0xfa, 0xa5, 0x6a, 0x6a,
-    0x05, 0x46, 0xfa, 0x50, 0x05, 0xb0, 0xfd, 0x73, 0x69, 0x69, 0x02, 0x8d, 0x6a, 0x6a, 0x00, 0x03,
-    0x00, 0x5f, 0xff, 0xec, 0x07, 0x20, 0x04, 0x4f, 0x00, 0x2a, 0x00, 0x40, 0x00, 0x56, 0x00, 0x27,
-    0x40, 0x13, 0x24, 0x00, 0x00, 0x47, 0x3c, 0x13, 0x12, 0x12, 0x3c, 0x52, 0x19, 0x0b, 0x0b, 0x31,
-    0x07, 0x72, 0x3c, 0x0b, 0x72, 0x00, 0x2b, 0x2b, 0x32, 0x11, 0x33, 0x32, 0x11, 0x39, 0x2f, 0x33,
-    0x11, 0x33, 0x33, 0x11, 0x33, 0x30, 0x31, 0x45, 0x22, 0x2e, 0x02, 0x35, 0x35, 0x34, 0x3e, 0x02,
-    0x17, 0x32, 0x1e, 0x02, 0x15, 0x15, 0x21, 0x35, 0x21, 0x35, 0x34, 0x26, 0x26, 0x23, 0x22, 0x0e,
-    0x02, 0x15, 0x15, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x36, 0x37, 0x17, 0x06, 0x06, 0x01, 0x35, 0x34,
-    0x3e, 0x02, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x37,
-    0x15, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x3e, 0x02, 0x35, 0x35, 0x34, 0x2e, 0x02, 0x23, 0x22, 0x0e,
-    0x02, 0x05, 0x84, 0x65, 0xac, 0x80, 0x47, 0x48, 0x7f, 0xa5, 0x5c, 0x65, 0x9f, 0x6e, 0x3a, 0xfc,
-    0xd4, 0x02, 0xb4, 0x48, 0x89, 0x63, 0x4b, 0x7c, 0x59, 0x30, 0x31, 0x5d, 0x82, 0x50, 0x76, 0x9b,
-    0x34, 0x33, 0x37, 0xb8, 0xfa, 0x52, 0x43, 0x7d, 0xb0, 0x6d, 0x6f, 0xb1, 0x7d, 0x43, 0x43, 0x7d,
-    0xb0, 0x6e, 0x6e, 0xb0, 0x7e, 0x43, 0x78, 0x2e, 0x5b, 0x86, 0x58, 0x58, 0x86, 0x5a, 0x2e, 0x2e,
-    0x5b, 0x87, 0x58, 0x57, 0x86, 0x5b, 0x2d, 0x14, 0x4e, 0x8f, 0xc2, 0x73, 0x36, 0x77, 0xc5, 0x90,
-    0x4f, 0x01, 0x41, 0x7a, 0xaa, 0x69, 0x66, 0x66, 0x1e, 0x5b, 0x95, 0x59, 0x43, 0x78, 0x9d, 0x5b,
-    0x36, 0x59, 0x9b, 0x75, 0x42, 0x41, 0x36, 0x54, 0x3a, 0x50, 0x02, 0x21, 0x20, 0x76, 0xc8, 0x92,
-    0x51, 0x51, 0x92, 0xc8, 0x76, 0x20, 0x76, 0xc8, 0x92, 0x51, 0x51, 0x92, 0xc8, 0x96, 0x20, 0x59,
-    0x9f, 0x7c, 0x46, 0x46, 0x7c, 0x9f, 0x59, 0x20, 0x58, 0x9e, 0x7c, 0x48, 0x48, 0x7c, 0x9e, 0x00,
-    0x00, 0x01, 0x00, 0xa8, 0x00, 0x00, 0x02, 0x66, 0x06, 0x15, 0x00, 0x11, 0x00, 0x0e, 0xb6, 0x0d,
-    0x06, 0x01, 0x72, 0x01, 0x0a, 0x72, 0x00, 0x2b, 0x2b, 0x32, 0x30, 0x31, 0x61, 0x23, 0x11, 0x34,
-    0x36, 0x36, 0x33, 0x32, 0x16, 0x17, 0x07, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x15, 0x01, 0x1f,
-    0x77, 0x4b, 0x8a, 0x61, 0x22, 0x44, 0x22, 0x10, 0x17, 0x2f, 0x23, 0x41, 0x5c, 0x31, 0x04, 0xc0,
-    0x6f, 0x98, 0x4e, 0x09, 0x0a, 0x61, 0x07, 0x06, 0x38, 0x6a, 0x4c, 0x00, 0x00, 0x01, 0x00, 0x7d,
-    0xff, 0xec, 0x05, 0x21, 0x05, 0xc4, 0x00, 0x2c, 0x00, 0x1b, 0x40, 0x0d, 0x0f, 0x00, 0x06, 0x09,
-    0x09, 0x00, 0x1a, 0x22, 0x03, 0x72, 0x00, 0x09, 0x72, 0x00, 0x2b, 0x2b, 0x32, 0x11, 0x39, 0x2f,
-    0x33, 0x11, 0x33, 0x30, 0x31, 0x45, 0x22, 0x2e, 0x02, 0x35, 0x35, 0x21, 0x15, 0x21, 0x15, 0x14,
-    0x1e, 0x02, 0x33, 0x32, 0x3e, 0x02, 0x35, 0x35, 0x34, 0x2e, 0x02, 0x23, 0x22, 0x06, 0x07, 0x27,
-    0x3e, 0x02, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x15, 0x14, 0x0e, 0x02, 0x02, 0xd6, 0x8e, 0xdf, 0x9b,
-    0x51, 0x04, 0x57, 0xfc, 0x25, 0x39, 0x76, 0xb3, 0x7b, 0x6e, 0xac, 0x78, 0x3e, 0x3a, 0x7a, 0xc0,
-    0x85, 0x8b, 0xc9, 0x46, 0x27, 0x24, 0x75, 0xae, 0x7a, 0x98, 0xea, 0xa0, 0x52, 0x59, 0xa0, 0xd6,
-    0x14, 0x58, 0xa7, 0xeb, 0x92, 0x7b, 0x66, 0x35, 0x68, 0xb5, 0x87, 0x4d, 0x5b, 0xa0, 0xd5, 0x79,
-    0x85, 0x75, 0xcd, 0x9b, 0x57, 0x47, 0x30, 0x5d, 0x1d, 0x3e, 0x2a, 0x62, 0xb3, 0xf6, 0x94, 0x85,
-    0x99, 0xfe, 0xb9, 0x64, 0x00, 0x01, 0xff, 0xc5, 0xfe, 0x4b, 0x02, 0xab, 0x06, 0x15, 0x00, 0x27,
-    0x00, 0x29, 0x40, 0x15, 0x14, 0x02, 0x02, 0x15, 0x27, 0x06, 0x72, 0x1f, 0x22, 0x22, 0x1e, 0x1b,
-    0x01, 0x72, 0x0b, 0x0e, 0x0e, 0x0a, 0x07, 0x0f, 0x72, 0x00, 0x2b, 0x32, 0x32, 0x11, 0x33, 0x2b,
-    0x32, 0x32, 0x11, 0x33, 0x2b, 0x32, 0x32, 0x11, 0x33, 0x30, 0x31, 0x41, 0x15, 0x23, 0x11, 0x14,
-    0x06, 0x06, 0x23, 0x22, 0x26, 0x27, 0x37, 0x16, 0x16, 0x33, 0x32, 0x36, 0x36, 0x35, 0x11, 0x23,
-    0x35, 0x33, 0x35, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x17, 0x07, 0x26, 0x26, 0x23, 0x22, 0x06,
-    0x06, 0x15, 0x15, 0x02, 0x59, 0xf5, 0x48, 0x88, 0x5f, 0x1f, 0x34, 0x1d, 0x0d, 0x10, 0x3e, 0x15,
-    0x3a, 0x52, 0x2c, 0xb4, 0xb4, 0x4a, 0x8c, 0x60, 0x22, 0x44, 0x22, 0x0f, 0x18, 0x32, 0x23, 0x41,
-    0x5b, 0x2f, 0x04, 0x3a, 0x62, 0xfb, 0xcf, 0x70, 0x9c, 0x50, 0x09, 0x0a, 0x64, 0x06, 0x0a, 0x3a,
-    0x6e, 0x4d, 0x04, 0x31, 0x62, 0x86, 0x6f, 0x98, 0x4e, 0x09, 0x0a, 0x63, 0x07, 0x06, 0x37, 0x69,
-    0x4c, 0x86, 0x00, 0x03, 0x00, 0x85, 0xff, 0xec, 0x05, 0xa8, 0x06, 0x1f, 0x00, 0x09, 0x00, 0x21,
-    0x00, 0x39, 0x00, 0x1d, 0x40, 0x0e, 0x05, 0x06, 0x06, 0x29, 0x29, 0x00, 0x00, 0x1c, 0x03, 0x72,
-    0x35, 0x10, 0x09, 0x72, 0x00, 0x2b, 0x32, 0x2b, 0x32, 0x2f, 0x32, 0x11, 0x39, 0x11, 0x33, 0x30,
-    0x31, 0x41, 0x33, 0x14, 0x06, 0x06, 0x23, 0x35, 0x32, 0x36, 0x36, 0x03, 0x15, 0x14, 0x0e, 0x02,
-    0x23, 0x22, 0x2e, 0x03, 0x35, 0x35, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x1e, 0x03, 0x03, 0x35, 0x34,
-    0x2e, 0x03, 0x23, 0x22, 0x0e, 0x02, 0x15, 0x15, 0x14, 0x1e, 0x03, 0x33, 0x32, 0x3e, 0x02, 0x05,
-    0x3a, 0x6e, 0x48, 0x99, 0x79, 0x5c, 0x66, 0x2a, 0x46, 0x50, 0x94, 0xd1, 0x81, 0x66, 0xaf, 0x8c,
-    0x63, 0x35, 0x51, 0x96, 0xd1, 0x7f, 0x67, 0xb0, 0x8b, 0x62, 0x34, 0x7b, 0x26, 0x4b, 0x6c, 0x8c,
-    0x54, 0x67, 0xa4, 0x74, 0x3d, 0x28, 0x4c, 0x6c, 0x8b, 0x53, 0x6a, 0xa4, 0x72, 0x3b, 0x06, 0x1f,
-    0x7b, 0xaa, 0x59, 0x5f, 0x43, 0x81, 0xfd, 0x62, 0x9b, 0x99, 0xf8, 0xb0, 0x5e, 0x3d, 0x73, 0xa5,
-    0xcf, 0x7b, 0x9b, 0x99, 0xf7, 0xb0, 0x5e, 0x3d, 0x73, 0xa4, 0xd0, 0xfe, 0xeb, 0x9d, 0x67, 0xad,
-    0x89, 0x60, 0x32, 0x4e, 0x92, 0xce, 0x81, 0x9d, 0x68, 0xaf, 0x89, 0x60, 0x32, 0x4e, 0x92, 0xd0,
-    0x00, 0x03, 0x00, 0x5a, 0xff, 0xec, 0x04, 0xa0, 0x04, 0xaf, 0x00, 0x09, 0x00, 0x1f, 0x00, 0x35,
-    0x00, 0x15, 0x40, 0x0a, 0x26, 0x1b, 0x0b, 0x72, 0x31, 0x00, 0x00, 0x10, 0x07, 0x72, 0x00, 0x2b,
-    0x32, 0x2f, 0x32, 0x2b, 0x32, 0x30, 0x31, 0x41, 0x33, 0x14, 0x06, 0x06, 0x23, 0x35, 0x32, 0x36,
-    0x36, 0x01, 0x35, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x15, 0x14, 0x0e, 0x02, 0x23,
-    0x22, 0x2e, 0x02, 0x37, 0x15, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x3e, 0x02, 0x35, 0x35, 0x34, 0x2e,
-    0x02, 0x23, 0x22, 0x0e, 0x02, 0x04, 0x3a, 0x66, 0x37, 0x81, 0x70, 0x53, 0x54, 0x1b, 0xfc, 0x20,
-    0x44, 0x7f, 0xb2, 0x6d, 0x6e, 0xb2, 0x7f, 0x44, 0x44, 0x7e, 0xb2, 0x6d, 0x6e, 0xb2, 0x80, 0x44,
-    0x77, 0x30, 0x5c, 0x88, 0x59, 0x57, 0x87, 0x5c, 0x30, 0x30, 0x5d, 0x87, 0x58, 0x58, 0x87, 0x5d,
-    0x2f, 0x04, 0xaf, 0x67, 0x92, 0x4d, 0x55, 0x3a, 0x6d, 0xfd, 0xa8, 0x20, 0x76, 0xc8, 0x92, 0x51,
-    0x51, 0x92, 0xc8, 0x76, 0x20, 0x76, 0xc7, 0x93, 0x51, 0x51, 0x93, 0xc7, 0x96, 0x20, 0x59, 0x9f,
-    0x7b, 0x47, 0x47, 0x7b, 0x9f, 0x59, 0x20, 0x58, 0x9e, 0x7c, 0x48, 0x48, 0x7c, 0x9e, 0x00, 0x02,
-    0x00, 0xa3, 0xff, 0xec, 0x05, 0xed, 0x06, 0x09, 0x00, 0x09, 0x00, 0x1f, 0x00, 0x19, 0x40, 0x0c,
-    0x05, 0x0a, 0x0a, 0x00, 0x00, 0x15, 0x02, 0x72, 0x1b, 0x10, 0x09, 0x72, 0x00, 0x2b, 0x32, 0x2b,
-    0x32, 0x2f, 0x32, 0x11, 0x33, 0x30, 0x31, 0x41, 0x33, 0x14, 0x06, 0x06, 0x23, 0x35, 0x32, 0x36,
-    0x36, 0x25, 0x33, 0x11, 0x14, 0x06, 0x06, 0x23, 0x22, 0x26, 0x26, 0x35, 0x11, 0x33, 0x11, 0x14,
-    0x16, 0x16, 0x33, 0x32, 0x36, 0x36, 0x35, 0x05, 0x83, 0x6a, 0x48, 0xa0, 0x86, 0x68, 0x70, 0x2c,
-    0xfe, 0xa5, 0x7b, 0x8a, 0xe9, 0x8d, 0x91, 0xe8, 0x87, 0x7a, 0x65, 0xb0, 0x71, 0x71, 0xb0, 0x64,
-    0x06, 0x09, 0x81, 0xaf, 0x5a, 0x5e, 0x45, 0x86, 0x08, 0xfc, 0x26, 0xa3, 0xda, 0x6d, 0x6d, 0xda,
-    0xa3, 0x03, 0xda, 0xfc, 0x26, 0x7f, 0xab, 0x56, 0x56, 0xab, 0x7f, 0x00, 0x00, 0x03, 0x00, 0x99,
-    0xff, 0xec, 0x04, 0xda, 0x04, 0x9c, 0x00, 0x09, 0x00, 0x0e, 0x00, 0x25, 0x00, 0x1d, 0x40, 0x0e,
-    0x05, 0x0b, 0x0b, 0x00, 0x00, 0x1b, 0x06, 0x72, 0x22, 0x0e, 0x0e, 0x15, 0x0b, 0x72, 0x00, 0x2b,
-    0x32, 0x2f, 0x32, 0x2b, 0x32, 0x2f, 0x32, 0x11, 0x33, 0x30, 0x31, 0x41, 0x33, 0x14, 0x06, 0x06,
-    0x23, 0x35, 0x32, 0x36, 0x36, 0x01, 0x11, 0x33, 0x11, 0x23, 0x13, 0x37, 0x14, 0x0e, 0x02, 0x23,
-    0x22, 0x2e, 0x02, 0x35, 0x11, 0x33, 0x11, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x36, 0x36, 0x04, 0x77,
-    0x63, 0x36, 0x83, 0x74, 0x5b, 0x56, 0x19, 0xfe, 0xdb, 0x79, 0x74, 0x11, 0x3e, 0x30, 0x66, 0xa2,
-    0x72, 0x4f, 0x83, 0x5e, 0x33, 0x77, 0x27, 0x45, 0x5a, 0x34, 0x84, 0x99, 0x41, 0x04, 0x9c, 0x67,
-    0x8c, 0x48, 0x54, 0x33, 0x67, 0xfc, 0xab, 0x03, 0x40, 0xfb, 0xc6, 0x01, 0xc3, 0x02, 0x66, 0xad,
-    0x7f, 0x47, 0x2e, 0x61, 0x9c, 0x6f, 0x02, 0xb4, 0xfd, 0x4a, 0x56, 0x75, 0x45, 0x1e, 0x65, 0xa7,
-    0x00, 0x01, 0xff, 0x8c, 0xfe, 0x4b, 0x01, 0x2b, 0x04, 0x3a, 0x00, 0x11, 0x00, 0x0e, 0xb6, 0x0d,
-    0x06, 0x0f, 0x72, 0x01, 0x06, 0x72, 0x00, 0x2b, 0x2b, 0x32, 0x30, 0x31, 0x53, 0x33, 0x11, 0x14,
-    0x06, 0x06, 0x23, 0x22, 0x26, 0x27, 0x37, 0x16, 0x16, 0x33, 0x32, 0x36, 0x36, 0x35, 0xb4, 0x77,
-    0x48, 0x88, 0x5f, 0x1f, 0x34, 0x1d, 0x0d, 0x10, 0x3e, 0x15, 0x3a, 0x52, 0x2c, 0x04, 0x3a, 0xfb,
-    0x6d, 0x70, 0x9c, 0x50, 0x09, 0x0a, 0x64, 0x06, 0x0a, 0x3a, 0x6e, 0x4d, 0x00, 0x01, 0x00, 0x5d,
-    0xff, 0xec, 0x03, 0xd1, 0x04, 0x4f, 0x00, 0x2a, 0x00, 0x19, 0x40, 0x0c, 0x11, 0x14, 0x14, 0x00,
-    0x19, 0x0b, 0x0b, 0x72, 0x24, 0x00, 0x07, 0x72, 0x00, 0x2b, 0x32, 0x2b, 0x32, 0x12, 0x39, 0x2f,
-    0x33, 0x30, 0x31, 0x41, 0x32, 0x1e, 0x02, 0x15, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02,
-    0x35, 0x35, 0x21, 0x15, 0x21, 0x15, 0x14, 0x16, 0x16, 0x33, 0x32, 0x3e, 0x02, 0x35, 0x35, 0x34,
-    0x2e, 0x02, 0x23, 0x22, 0x06, 0x07, 0x27, 0x36, 0x36, 0x01, 0xf9, 0x65, 0xac, 0x80, 0x47, 0x48,
-    0x7f, 0xa5, 0x5c, 0x65, 0x9f, 0x6e, 0x3a, 0x03, 0x2c, 0xfd, 0x4c, 0x48, 0x8a, 0x62, 0x4b, 0x7b,
-    0x5a, 0x30, 0x32, 0x5c, 0x82, 0x50, 0x75, 0x9c, 0x34, 0x33, 0x38, 0xb7, 0x04, 0x4f, 0x4e, 0x8f,
-    0xc2, 0x74, 0x36, 0x76, 0xc6, 0x8f, 0x4f, 0x42, 0x7a, 0xaa, 0x68, 0x67, 0x67, 0x1d, 0x5a, 0x96,
-    0x5a, 0x43, 0x78, 0x9e, 0x5a, 0x36, 0x59, 0x9b, 0x76, 0x42, 0x42, 0x36, 0x54, 0x3a, 0x51, 0x00,
-    0x00, 0x01, 0x00, 0xa1, 0x04, 0xeb, 0x02, 0xcc, 0x05, 0xf7, 0x00, 0x08, 0x00, 0x14, 0xb7, 0x07,
-    0x05, 0x05, 0x04, 0x01, 0x03, 0x80, 0x08, 0x00, 0x2f, 0x1a, 0xcd, 0x32, 0x39, 0x32, 0x11, 0x33,
-    0x30, 0x31, 0x41, 0x13, 0x15, 0x23, 0x27, 0x07, 0x23, 0x35, 0x13, 0x01, 0xdb, 0xf1, 0x6f, 0xa9,
-    0xa7, 0x6c, 0xee, 0x05, 0xf7, 0xfe, 0xfe, 0x0a, 0xb6, 0xb6, 0x0c, 0x01, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x90, 0x04, 0xdf, 0x02, 0xbe, 0x05, 0xf1, 0x00, 0x08, 0x00, 0x12, 0xb6, 0x01, 0x06, 0x80,
-    0x07, 0x04, 0x02, 0x00, 0x00, 0x2f, 0x32, 0x32, 0x32, 0x1a, 0xcd, 0x39, 0x30, 0x31, 0x53, 0x17,
-    0x37, 0x33, 0x15, 0x03, 0x23, 0x03, 0x35, 0xfb, 0xac, 0xac, 0x6b, 0xec, 0x57, 0xeb, 0x05, 0xf1,
-    0xc2, 0xc2, 0x0c, 0xfe, 0xfa, 0x01, 0x07, 0x0b, 0xff, 0xff, 0x00, 0x8a, 0x05, 0x3f, 0x02, 0xf5,
-    0x05, 0xa1, 0x06, 0x06, 0x00, 0x70, 0x00, 0x00, 0x00, 0x01, 0x00, 0x8b, 0x04, 0xd1, 0x02, 0xcc,
-    0x05, 0xd3, 0x00, 0x0e, 0x00, 0x10, 0xb5, 0x01, 0x01, 0x09, 0x80, 0x0c, 0x05, 0x00, 0x2f, 0x33,
-    0x1a, 0xcc, 0x32, 0x2f, 0x30, 0x31, 0x41, 0x33, 0x14, 0x06, 0x06, 0x23, 0x22, 0x26, 0x35, 0x33,
-    0x14, 0x16, 0x33, 0x32, 0x36, 0x02, 0x66, 0x66, 0x45, 0x81, 0x5a, 0x86, 0x9b, 0x66, 0x54, 0x67,
-    0x64, 0x56, 0x05, 0xd3, 0x4c, 0x74, 0x42, 0x90, 0x72, 0x45, 0x66, 0x67, 0x00, 0x01, 0x00, 0x95,
-    0x05, 0x17, 0x01, 0x3a, 0x05, 0xb8, 0x00, 0x0b, 0x00, 0x09, 0xb2, 0x03, 0x09, 0x10, 0x00, 0x3f,
-    0x33, 0x30, 0x31, 0x53, 0x34, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14, 0x06, 0x23, 0x22, 0x26, 0x95,
-    0x2c, 0x26, 0x26, 0x2d, 0x2d, 0x26, 0x26, 0x2c, 0x05, 0x67, 0x21, 0x30, 0x30, 0x21, 0x22, 0x2e,
-    0x2e, 0x00, 0x00, 0x02, 0x00, 0x76, 0x04, 0xb9, 0x01, 0xf8, 0x06, 0x33, 0x00, 0x0d, 0x00, 0x19,
-    0x00, 0x0e, 0xb4, 0x17, 0x04, 0x80, 0x11, 0x0b, 0x00, 0x2f, 0x33, 0x1a, 0xcc, 0x32, 0x30, 0x31,
-    0x53, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14, 0x06, 0x06, 0x23, 0x22, 0x26, 0x37, 0x14,
-    0x16, 0x33, 0x32, 0x36, 0x35, 0x34, 0x26, 0x23, 0x22, 0x06, 0x76, 0x33, 0x57, 0x37, 0x51, 0x70,
-    0x34, 0x57, 0x36, 0x52, 0x6f, 0x4c, 0x42, 0x33, 0x33, 0x41, 0x41, 0x33, 0x33, 0x42, 0x05, 0x74,
-    0x35, 0x57, 0x33, 0x6f, 0x50, 0x36, 0x55, 0x30, 0x6a, 0x51, 0x30, 0x44, 0x43, 0x31, 0x32, 0x45,
-    0x45, 0x00, 0x00, 0x01, 0x00, 0x3d, 0xfe, 0x62, 0x01, 0x76, 0x00, 0x27, 0x00, 0x15, 0x00, 0x0e,
-    0xb4, 0x08, 0x0f, 0x80, 0x01, 0x00, 0x00, 0x2f, 0x32, 0x1a, 0xcc, 0x32, 0x30, 0x31, 0x65, 0x17,
-    0x0e, 0x02, 0x15, 0x14, 0x16, 0x33, 0x32, 0x36, 0x37, 0x17, 0x06, 0x06, 0x23, 0x22, 0x26, 0x35,
-    0x34, 0x36, 0x36, 0x01, 0x21, 0x3b, 0x2d, 0x53, 0x34, 0x25, 0x31, 0x24, 0x34, 0x11, 0x0f, 0x16,
-    0x45, 0x35, 0x4a, 0x5f, 0x38, 0x67, 0x27, 0x27, 0x22, 0x49, 0x51, 0x2e, 0x23, 0x31, 0x16, 0x0b,
-    0x55, 0x0f, 0x1d, 0x55, 0x55, 0x32, 0x65, 0x5d, 0x00, 0x01, 0x00, 0x6b, 0x04, 0xf0, 0x03, 0x0c,
-    0x05, 0xd4, 0x00, 0x19, 0x00, 0x27, 0x40, 0x13, 0x00, 0x00, 0x01, 0x01, 0x0a, 0x12, 0x40, 0x0f,
-    0x1a, 0x48, 0x12, 0x05, 0x80, 0x0d, 0x0d, 0x0e, 0x0e, 0x17, 0x05, 0x00, 0x2f, 0x33, 0x33, 0x2f,
-    0x33, 0x2f, 0x1a, 0x10, 0xcd, 0x2b, 0x32, 0x32, 0x2f, 0x33, 0x2f, 0x30, 0x31, 0x41, 0x17, 0x14,
-    0x06, 0x06, 0x23, 0x22, 0x2e, 0x02, 0x23, 0x22, 0x06, 0x15, 0x27, 0x34, 0x36, 0x36, 0x33, 0x32,
-    0x1e, 0x02, 0x33, 0x32, 0x36, 0x02, 0xb2, 0x5a, 0x34, 0x59, 0x37, 0x34, 0x45, 0x36, 0x3b, 0x2b,
-    0x2e, 0x40, 0x5a, 0x34, 0x59, 0x36, 0x30, 0x44, 0x3b, 0x3e, 0x29, 0x2e, 0x40, 0x05, 0xd4, 0x05,
-    0x40, 0x61, 0x36, 0x22, 0x2b, 0x21, 0x3f, 0x37, 0x03, 0x40, 0x60, 0x35, 0x21, 0x2b, 0x21, 0x42,
-    0x00, 0x02, 0x00, 0x79, 0x04, 0xd0, 0x03, 0x09, 0x06, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0e,
-    0xb4, 0x01, 0x05, 0x80, 0x00, 0x04, 0x00, 0x2f, 0x33, 0x1a, 0xcd, 0x32, 0x30, 0x31, 0x41, 0x01,
-    0x33, 0x01, 0x21, 0x13, 0x33, 0x03, 0x01, 0x7a, 0x01, 0x00, 0x8f, 0xfe, 0xea, 0xfe, 0x86, 0xcb,
-    0x89, 0xe7, 0x04, 0xd0, 0x01, 0x30, 0xfe, 0xd0, 0x01, 0x30, 0xfe, 0xd0, 0x00, 0x02, 0x00, 0x9e,
-    0xfe, 0x8e, 0x01, 0xcf, 0xff, 0xa9, 0x00, 0x0b, 0x00, 0x17, 0x00, 0x0e, 0xb4, 0x0f, 0x09, 0x80,
-    0x15, 0x03, 0x00, 0x2f, 0x33, 0x1a, 0xcc, 0x32, 0x30, 0x31, 0x57, 0x34, 0x36, 0x33, 0x32, 0x16,
-    0x15, 0x14, 0x06, 0x23, 0x22, 0x26, 0x37, 0x14, 0x16, 0x33, 0x32, 0x36, 0x35, 0x34, 0x26, 0x23,
-    0x22, 0x06, 0x9e, 0x5b, 0x3f, 0x3e, 0x59, 0x59, 0x3e, 0x3f, 0x5b, 0x49, 0x2f, 0x22, 0x21, 0x2f,
-    0x2f, 0x21, 0x22, 0x2f, 0xe7, 0x3d, 0x53, 0x53, 0x3d, 0x3d, 0x4e, 0x4e, 0x3d, 0x1e, 0x29, 0x29,
-    0x1e, 0x20, 0x2b, 0x2b, 0x00, 0x01, 0xfc, 0xe0, 0x04, 0xe8, 0xfe, 0x2f, 0x06, 0x00, 0x00, 0x03,
-    0x00, 0x0a, 0xb2, 0x03, 0x80, 0x02, 0x00, 0x2f, 0x1a, 0xcd, 0x30, 0x31, 0x41, 0x13, 0x23, 0x03,
-    0xfd, 0x70, 0xbf, 0x6d, 0xe2, 0x06, 0x00, 0xfe, 0xe8, 0x01, 0x18, 0x00, 0x00, 0x01, 0xfd, 0x98,
-    0x04, 0xe8, 0xfe, 0xe8, 0x06, 0x00, 0x00, 0x03, 0x00, 0x0a, 0xb2, 0x01, 0x80, 0x00, 0x00, 0x2f,
-    0x1a, 0xcd, 0x30, 0x31, 0x41, 0x13, 0x33, 0x03, 0xfd, 0x98, 0xc0, 0x90, 0xe7, 0x04, 0xe8, 0x01,
-    0x18, 0xfe, 0xe8, 0x00, 0xff, 0xff, 0xfc, 0xaa, 0x04, 0xf0, 0xff, 0x4b, 0x05, 0xd4, 0x04, 0x07,
-    0x00, 0xa5, 0xfc, 0x3f, 0x00, 0x00, 0x00, 0x01, 0xfd, 0x6c, 0x04, 0xd3, 0xfe, 0x99, 0x06, 0x5a,
-    0x00, 0x14, 0x00, 0x10, 0xb5, 0x14, 0x02, 0x00, 0x80, 0x0b, 0x0c, 0x00, 0x2f, 0x33, 0x1a, 0xcc,
-    0x32, 0x32, 0x30, 0x31, 0x41, 0x23, 0x27, 0x3e, 0x02, 0x35, 0x34, 0x2e, 0x02, 0x23, 0x37, 0x32,
-    0x1e, 0x02, 0x15, 0x14, 0x06, 0x07, 0xfd, 0xe9, 0x5a, 0x01, 0x3b, 0x49, 0x23, 0x22, 0x3a, 0x48,
-    0x25, 0x07, 0x44, 0x6d, 0x4d, 0x28, 0x69, 0x46, 0x04, 0xd3, 0x7d, 0x05, 0x14, 0x26, 0x20, 0x1a,
-    0x24, 0x16, 0x09, 0x4e, 0x18, 0x2e, 0x3f, 0x28, 0x4e, 0x47, 0x07, 0x00, 0x00, 0x02, 0xfc, 0x2f,
-    0x04, 0xe4, 0xfe, 0xc9, 0x05, 0xee, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0e, 0xb4, 0x07, 0x03, 0x80,
-    0x04, 0x00, 0x00, 0x2f, 0x32, 0x1a, 0xcd, 0x32, 0x30, 0x31, 0x41, 0x23, 0x01, 0x33, 0x01, 0x23,
-    0x03, 0x33, 0xfd, 0xd6, 0x79, 0xfe, 0xd2, 0x99, 0x02, 0x01, 0x6e, 0xf9, 0x8d, 0x04, 0xe4, 0x01,
-    0x0a, 0xfe, 0xf6, 0x01, 0x0a, 0x00, 0x00, 0x01, 0xfd, 0x60, 0xfe, 0xc9, 0xfe, 0x05, 0xff, 0x6a,
-    0x00, 0x0b, 0x00, 0x08, 0xb1, 0x03, 0x09, 0x00, 0x2f, 0x33, 0x30, 0x31, 0x45, 0x34, 0x36, 0x33,
-    0x32, 0x16, 0x15, 0x14, 0x06, 0x23, 0x22, 0x26, 0xfd, 0x60, 0x2c, 0x26, 0x26, 0x2d, 0x2d, 0x26,
-    0x26, 0x2c, 0xe8, 0x22, 0x30, 0x30, 0x22, 0x21, 0x2e, 0x2e, 0x00, 0x01, 0x00, 0xc8, 0x05, 0x04,
-    0x01, 0x88, 0x06, 0x35, 0x00, 0x03, 0x00, 0x0a, 0xb2, 0x00, 0x80, 0x01, 0x00, 0x2f, 0x1a, 0xcd,
-    0x30, 0x31, 0x53, 0x13, 0x33, 0x03, 0xc8, 0x4a, 0x76, 0x6d, 0x05, 0x04, 0x01, 0x31, 0xfe, 0xcf,
-    0x00, 0x03, 0x00, 0x9a, 0x05, 0x24, 0x03, 0x39, 0x06, 0x81, 0x00, 0x03, 0x00, 0x0f, 0x00, 0x1b,
-    0x00, 0x19, 0x40, 0x0a, 0x13, 0x19, 0x19, 0x0d, 0x01, 0x80, 0x00, 0x00, 0x07, 0x0d, 0x00, 0x2f,
-    0x33, 0x33, 0x2f, 0x1a, 0xcd, 0x11, 0x33, 0x11, 0x33, 0x30, 0x31, 0x41, 0x37, 0x33, 0x07, 0x05,
-    0x34, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14, 0x06, 0x23, 0x22, 0x26, 0x25, 0x34, 0x36, 0x33, 0x32,
-    0x16, 0x15, 0x14, 0x06, 0x23, 0x22, 0x26, 0x01, 0xb6, 0x24, 0x85, 0x47, 0xfe, 0x82, 0x2c, 0x26,
-    0x26, 0x2d, 0x2d, 0x26, 0x26, 0x2c, 0x01, 0xfa, 0x2c, 0x26, 0x26, 0x2d, 0x2d, 0x26, 0x26, 0x2c,
-    0x05, 0x85, 0xfc, 0xfc, 0x11, 0x22, 0x30, 0x30, 0x22, 0x21, 0x2e, 0x2e, 0x20, 0x22, 0x30, 0x30,
-    0x22, 0x21, 0x2e, 0x2e, 0xff, 0xff, 0x00, 0xa4, 0x02, 0x7c, 0x01, 0x4e, 0x03, 0x22, 0x06, 0x06,
-    0x00, 0x78, 0x00, 0x00, 0x00, 0x01, 0x00, 0xba, 0x00, 0x00, 0x04, 0x28, 0x05, 0xb0, 0x00, 0x05,
-    0x00, 0x0e, 0xb6, 0x02, 0x05, 0x02, 0x72, 0x04, 0x08, 0x72, 0x00, 0x2b, 0x2b, 0x32, 0x30, 0x31,
-    0x41, 0x15, 0x21, 0x11, 0x23, 0x11, 0x04, 0x28, 0xfd, 0x0d, 0x7b, 0x05, 0xb0, 0x6a, 0xfa, 0xba,
-    0x05, 0xb0, 0x00, 0x03, 0x00, 0x2d, 0x00, 0x00, 0x05, 0x60, 0x05, 0xb0, 0x00, 0x04, 0x00, 0x09,
-    0x00, 0x0d, 0x00, 0x1b, 0x40, 0x0d, 0x06, 0x02, 0x07, 0x03, 0x02, 0x72, 0x0d, 0x0c, 0x0c, 0x05,
-    0x02, 0x12, 0x72, 0x00, 0x2b, 0x32, 0x32, 0x11, 0x33, 0x2b, 0x32, 0x12, 0x39, 0x30, 0x31, 0x41,
-    0x01, 0x23, 0x01, 0x33, 0x01, 0x01, 0x27, 0x33, 0x01, 0x27, 0x15, 0x21, 0x35, 0x02, 0xd3, 0xfd,
-    0xdb, 0x81, 0x02, 0x67, 0x56, 0x01, 0xf5, 0xfd, 0xe9, 0x15, 0x57, 0x02, 0x56, 0x66, 0xfb, 0x91,
-    0x05, 0x2b, 0xfa, 0xd5, 0x05, 0xb0, 0xfa, 0x50, 0x05, 0x2f, 0x81, 0xfa, 0x50, 0x6a, 0x6a, 0x6a,
-    0x00, 0x03, 0x00, 0x76, 0xff, 0xec, 0x04, 0xe5, 0x05, 0xc4, 0x00, 0x03, 0x00, 0x1b, 0x00, 0x33,
-    0x00, 0x1b, 0x40, 0x0d, 0x2f, 0x0a, 0x03, 0x02, 0x02, 0x0a, 0x23, 0x16, 0x03, 0x72, 0x0a, 0x09,
-    0x72, 0x00, 0x2b, 0x2b, 0x32, 0x11, 0x39, 0x2f, 0x33, 0x11, 0x33, 0x30, 0x31, 0x41, 0x15, 0x21,
-    0x35, 0x25, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x03, 0x35, 0x35, 0x34, 0x3e, 0x02, 0x33,
-    0x32, 0x1e, 0x03, 0x03, 0x35, 0x34, 0x2e, 0x03, 0x23, 0x22, 0x0e, 0x02, 0x15, 0x15, 0x14, 0x1e,
-    0x03, 0x33, 0x32, 0x3e, 0x02, 0x03, 0xc6, 0xfd, 0xd6, 0x03, 0x49, 0x50, 0x94, 0xd1, 0x81, 0x66,
-    0xaf, 0x8c, 0x63, 0x35, 0x51, 0x96, 0xd1, 0x7f, 0x67, 0xb0, 0x8b, 0x62, 0x34, 0x7b, 0x26, 0x4b,
-    0x6c, 0x8c, 0x54, 0x67, 0xa4, 0x74, 0x3d, 0x28, 0x4c, 0x6c, 0x8b, 0x53, 0x6a, 0xa4, 0x72, 0x3b,
-    0x03, 0x0a, 0x66, 0x66, 0x1c, 0x9b, 0x99, 0xf8, 0xb0, 0x5e, 0x3d, 0x73, 0xa5, 0xcf, 0x7b, 0x9b,
-    0x99, 0xf7, 0xb0, 0x5e, 0x3d, 0x73, 0xa4, 0xd0, 0xfe, 0xeb, 0x9d, 0x67, 0xad, 0x89, 0x60, 0x32,
-    0x4e, 0x92, 0xce, 0x81, 0x9d, 0x68, 0xaf, 0x89, 0x60, 0x32, 0x4e, 0x92, 0xd0, 0x00, 0x00, 0x02,
-    0x00, 0x45, 0x00, 0x00, 0x04, 0xe4, 0x05, 0xb0, 0x00, 0x04, 0x00, 0x09, 0x00, 0x17, 0x40, 0x0b,
-    0x06, 0x00, 0x02, 0x07, 0x03, 0x02, 0x72, 0x05, 0x02, 0x08, 0x72, 0x00, 0x2b, 0x32, 0x2b, 0x32,
-    0x12, 0x39, 0x39, 0x30, 0x31, 0x41, 0x01, 0x23, 0x01, 0x33, 0x01, 0x01, 0x35, 0x33, 0x01, 0x02,
-    0xb1, 0xfe, 0x19, 0x85, 0x02, 0x14, 0x59, 0x01, 0xae, 0xfe, 0x16, 0x5a, 0x02, 0x14, 0x05, 0x4b,
-    0xfa, 0xb5, 0x05, 0xb0, 0xfa, 0x50, 0x05, 0x4e, 0x62, 0xfa, 0x50, 0x00, 0x00, 0x03, 0x00, 0x74,
-    0x00, 0x00, 0x04, 0x0e, 0x05, 0xb0, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x1b, 0x40, 0x0d,
-    0x01, 0x00, 0x05, 0x04, 0x04, 0x00, 0x08, 0x09, 0x02, 0x72, 0x00, 0x08, 0x72, 0x00, 0x2b, 0x2b,
-    0x32, 0x11, 0x39, 0x2f, 0x33, 0x11, 0x33, 0x30, 0x31, 0x73, 0x35, 0x21, 0x15, 0x01, 0x35, 0x21,
-    0x15, 0x01, 0x35, 0x21, 0x15, 0x74, 0x03, 0x9a, 0xfc, 0xc8, 0x02, 0xcd, 0xfc, 0xde, 0x03, 0x71,
-    0x6a, 0x6a, 0x02, 0xa9, 0x69, 0x69, 0x02, 0x9e, 0x69, 0x69, 0x00, 0x01, 0x00, 0xbd, 0x00, 0x00,
-    0x04, 0xec, 0x05, 0xb0, 0x00, 0x07, 0x00, 0x13, 0x40, 0x09, 0x02, 0x06, 0x04, 0x07, 0x02, 0x72,
-    0x06, 0x08, 0x72, 0x00, 0x2b, 0x2b, 0x32, 0x11, 0x33, 0x30, 0x31, 0x41, 0x11, 0x23, 0x11, 0x21,
-    0x11, 0x23, 0x11, 0x04, 0xec, 0x7b, 0xfc, 0xc8, 0x7c, 0x05, 0xb0, 0xfa, 0x50, 0x05, 0x46, 0xfa,
-    0xba, 0x05, 0xb0, 0x00, 0x00, 0x03, 0x00, 0x40, 0x00, 0x00, 0x04, 0x2f, 0x05, 0xb0, 0x00, 0x03,
-    0x00, 0x07, 0x00, 0x10, 0x00, 0x21, 0x40, 0x10, 0x0e, 0x06, 0x06, 0x07, 0x07, 0x0f, 0x02, 0x72,
-    0x0c, 0x03, 0x03, 0x02, 0x02, 0x0b, 0x08, 0x72, 0x00, 0x2b, 0x32, 0x11, 0x33, 0x11, 0x33, 0x2b,
-    0x32, 0x11, 0x33, 0x11, 0x33, 0x30, 0x31, 0x65, 0x15, 0x21, 0x35, 0x01, 0x15, 0x21, 0x35, 0x01,
-    0x15, 0x01, 0x23, 0x35, 0x01, 0x01, 0x35, 0x33, 0x04, 0x2f, 0xfc, 0x3e, 0x03, 0x8c, 0xfc, 0x71,
-    0x02, 0x58, 0xfd, 0xca, 0x4c, 0x02, 0x02, 0xfd, 0xfe, 0x4c, 0x6a, 0x6a, 0x6a, 0x05, 0x46, 0x69,
-    0x69, 0xfd, 0x5b, 0x24, 0xfd, 0x19, 0x5e, 0x02, 0x99, 0x02, 0x5c, 0x5d, 0x00, 0x03, 0x00, 0x59,
-    0x00, 0x00, 0x05, 0x63, 0x05, 0xb0, 0x00, 0x13, 0x00, 0x27, 0x00, 0x2b, 0x00, 0x21, 0x40, 0x10,
-    0x14, 0x15, 0x15, 0x01, 0x00, 0x29, 0x08, 0x72, 0x1f, 0x1e, 0x1e, 0x0a, 0x0b, 0x28, 0x02, 0x72,
-    0x00, 0x2b, 0xcd, 0x32, 0x32, 0x11, 0x33, 0x2b, 0xcd, 0x32, 0x32, 0x11, 0x33, 0x30, 0x31, 0x65,
-    0x23, 0x22, 0x2e, 0x02, 0x35, 0x34, 0x36, 0x24, 0x33, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x14, 0x06,
-    0x04, 0x25, 0x33, 0x32, 0x36, 0x36, 0x35, 0x34, 0x2e, 0x02, 0x23, 0x23, 0x22, 0x06, 0x06, 0x15,
-    0x14, 0x1e, 0x02, 0x13, 0x11, 0x23, 0x11, 0x03, 0x0e, 0x60, 0x8a, 0xdc, 0x9c, 0x53, 0x92, 0x01,
-    0x0b, 0xb6, 0x64, 0x88, 0xdc, 0x9c, 0x53, 0x91, 0xfe, 0xf4, 0xfe, 0xe8, 0x62, 0x9a, 0xd2, 0x6c,
-    0x3d, 0x78, 0xaf, 0x72, 0x66, 0x98, 0xd3, 0x6d, 0x3d, 0x78, 0xb2, 0xe1, 0x7c, 0xc1, 0x50, 0x91,
-    0xc5, 0x73, 0x9a, 0xf4, 0x8d, 0x50, 0x92, 0xc4, 0x73, 0x9a, 0xf4, 0x8d, 0x6a, 0x6f, 0xc3, 0x7f,
-    0x5e, 0x9e, 0x73, 0x40, 0x70, 0xc3, 0x7e, 0x5f, 0x9e, 0x73, 0x3f, 0x04, 0x85, 0xfa, 0x50, 0x05,
-    0xb0, 0x00, 0x00, 0x02, 0x00, 0x7b, 0x00, 0x00, 0x05, 0x0e, 0x05, 0xb0, 0x00, 0x19, 0x00, 0x1d,
-    0x00, 0x19, 0x40, 0x0c, 0x14, 0x07, 0x07, 0x0d, 0x1c, 0x08, 0x72, 0x1d, 0x01, 0x0d, 0x02, 0x72,
-    0x00, 0x2b, 0x32, 0x32, 0x2b, 0x11, 0x39, 0x11, 0x33, 0x30, 0x31, 0x41, 0x33, 0x11, 0x14, 0x06,
-    0x04, 0x23, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x11, 0x33, 0x11, 0x14, 0x1e, 0x02, 0x33, 0x33, 0x32,
-    0x36, 0x36, 0x35, 0x01, 0x11, 0x23, 0x11, 0x04, 0x92, 0x7c, 0x95, 0xfe, 0xfc, 0xa7, 0x19, 0x7b,
-    0xd1, 0x99, 0x55, 0x7c, 0x42, 0x78, 0xa3, 0x62, 0x18, 0x85, 0xcc, 0x73, 0xfe, 0x6c, 0x7c, 0x05,
-    0xb0, 0xfd, 0xfa, 0xb0, 0xf6, 0x80, 0x48, 0x8d, 0xcd, 0x84, 0x02, 0x06, 0xfd, 0xfa, 0x68, 0xa5,
-    0x73, 0x3c, 0x6a, 0xc7, 0x8b, 0x02, 0x06, 0xfa, 0x50, 0x05, 0xb0, 0x00, 0x00, 0x03, 0x00, 0x78,
-    0x00, 0x00, 0x04, 0xb8, 0x05, 0xc4, 0x00, 0x2d, 0x00, 0x31, 0x00, 0x35, 0x00, 0x25, 0x40, 0x12,
-    0x28, 0x12, 0x12, 0x2f, 0x29, 0x29, 0x34, 0x11, 0x11, 0x33, 0x2e, 0x32, 0x12, 0x72, 0x06, 0x1d,
-    0x03, 0x72, 0x00, 0x2b, 0x32, 0x2b, 0x32, 0x32, 0x32, 0x11, 0x33, 0x33, 0x11, 0x33, 0x32, 0x11,
-    0x33, 0x30, 0x31, 0x41, 0x35, 0x34, 0x2e, 0x02, 0x23, 0x22, 0x0e, 0x02, 0x15, 0x15, 0x14, 0x1e,
-    0x02, 0x17, 0x15, 0x2e, 0x03, 0x35, 0x35, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x15,
-    0x14, 0x0e, 0x02, 0x07, 0x35, 0x3e, 0x03, 0x01, 0x35, 0x21, 0x15, 0x21, 0x35, 0x21, 0x15, 0x04,
-    0x35, 0x3a, 0x6d, 0x98, 0x60, 0x5e, 0x98, 0x6c, 0x39, 0x37, 0x5e, 0x78, 0x40, 0x5a, 0xa4, 0x81,
-    0x4b, 0x4d, 0x8f, 0xc5, 0x77, 0x78, 0xc6, 0x8f, 0x4e, 0x4a, 0x7f, 0xa2, 0x58, 0x40, 0x75, 0x5c,
-    0x36, 0xfe, 0xb9, 0x01, 0xca, 0xfb, 0xc0, 0x01, 0xd0, 0x02, 0xd9, 0x76, 0x76, 0xc1, 0x8b, 0x4a,
-    0x4a, 0x8b, 0xc1, 0x76, 0x76, 0x8b, 0xd1, 0x93, 0x5b, 0x16, 0x64, 0x16, 0x77, 0xb8, 0xf0, 0x8f,
-    0x74, 0x8e, 0xe8, 0xa7, 0x5a, 0x5a, 0xa7, 0xe8, 0x8e, 0x74, 0x8f, 0xef, 0xb8, 0x77, 0x17, 0x64,
-    0x16, 0x5c, 0x93, 0xd1, 0xfd, 0xb1, 0x6a, 0x6a, 0x6a, 0x6a, 0x00, 0x03, 0x00, 0x6f, 0xff, 0xeb,
-    0x04, 0x7b, 0x04, 0x4e, 0x00, 0x16, 0x00, 0x2c, 0x00, 0x41, 0x00, 0x1a, 0x40, 0x0d, 0x2e, 0x06,
-    0x34, 0x3b, 0x3b, 0x1d, 0x12, 0x0b, 0x72, 0x28, 0x06, 0x07, 0x72, 0x00, 0x2b, 0x32, 0x2b, 0x32,
-    0x32, 0x11, 0x33, 0x3f, 0x30, 0x31, 0x53, 0x35, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x1e, 0x03, 0x17,
-    0x15, 0x0e, 0x03, 0x23, 0x22, 0x2e, 0x02, 0x37, 0x15, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x3e, 0x02,
-    0x37, 0x35, 0x2e, 0x03, 0x23, 0x22, 0x0e, 0x02, 0x01, 0x33, 0x11, 0x14, 0x1e, 0x02, 0x33, 0x32,
-    0x36, 0x37, 0x17, 0x06, 0x06, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x11, 0x6f, 0x38, 0x6a, 0x9b, 0x63,
-    0x4a, 0x79, 0x5e, 0x45, 0x2d, 0x0c, 0x0c, 0x3e, 0x67, 0x91, 0x5f, 0x62, 0x9a, 0x6a, 0x38, 0x79,
-    0x26, 0x4c, 0x78, 0x51, 0x4f, 0x75, 0x52, 0x35, 0x0e, 0x0b, 0x31, 0x51, 0x77, 0x53, 0x52, 0x78,
-    0x4d, 0x26, 0x02, 0x84, 0x67, 0x0f, 0x1c, 0x25, 0x15, 0x0f, 0x17, 0x0c, 0x11, 0x19, 0x30, 0x19,
-    0x2f, 0x46, 0x31, 0x18, 0x01, 0xff, 0x15, 0x80, 0xd1, 0x97, 0x52, 0x2b, 0x52, 0x74, 0x90, 0x54,
-    0xca, 0x62, 0xa5, 0x7a, 0x43, 0x4d, 0x8d, 0xc3, 0x8c, 0x15, 0x5c, 0x9d, 0x74, 0x40, 0x3a, 0x65,
-    0x82, 0x48, 0xa3, 0x42, 0x8a, 0x75, 0x48, 0x48, 0x80, 0xa9, 0x01, 0xc4, 0xfc, 0xd9, 0x37, 0x48,
-    0x2a, 0x11, 0x05, 0x03, 0x5e, 0x0f, 0x09, 0x21, 0x46, 0x71, 0x50, 0x02, 0x40, 0x00, 0x00, 0x02,
-    0x00, 0xb2, 0xfe, 0x72, 0x04, 0x43, 0x05, 0xc4, 0x00, 0x1c, 0x00, 0x3a, 0x00, 0x1e, 0x40, 0x0e,
-    0x35, 0x00, 0x26, 0x27, 0x27, 0x1c, 0x1c, 0x30, 0x1d, 0x03, 0x13, 0x09, 0x0b, 0x72, 0x00, 0x2b,
-    0x32, 0x3f, 0x33, 0x39, 0x2f, 0x33, 0x12, 0x39, 0x39, 0x2f, 0x30, 0x31, 0x41, 0x33, 0x32, 0x16,
-    0x16, 0x15, 0x14, 0x06, 0x06, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x37, 0x14, 0x16, 0x16, 0x33, 0x32,
-    0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x23, 0x13, 0x32, 0x16, 0x16, 0x15, 0x14, 0x06, 0x06,
-    0x23, 0x23, 0x35, 0x33, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x15,
-    0x11, 0x23, 0x11, 0x34, 0x36, 0x36, 0x01, 0xf1, 0x93, 0x93, 0xc6, 0x66, 0x73, 0xcb, 0x84, 0x4a,
-    0x99, 0x82, 0x4f, 0x37, 0x63, 0xa9, 0x68, 0x6e, 0x97, 0x4d, 0x4c, 0x93, 0x6b, 0x8f, 0x62, 0x7c,
-    0xb8, 0x65, 0x62, 0xb7, 0x80, 0x62, 0x5e, 0x68, 0x81, 0x3c, 0x3e, 0x80, 0x63, 0x53, 0x87, 0x4f,
-    0x78, 0x72, 0xbd, 0x03, 0x24, 0x6a, 0xb4, 0x71, 0x87, 0xbe, 0x64, 0x2a, 0x58, 0x87, 0x5d, 0x1f,
-    0x51, 0x82, 0x4c, 0x50, 0x8f, 0x60, 0x5a, 0x91, 0x55, 0x02, 0xf3, 0x62, 0xad, 0x70, 0x61, 0xa1,
-    0x61, 0x57, 0x44, 0x7b, 0x52, 0x45, 0x7e, 0x50, 0x50, 0x8c, 0x5a, 0xfa, 0x4b, 0x05, 0xb5, 0x76,
-    0xbb, 0x6c, 0x00, 0x03, 0x00, 0x2d, 0xfe, 0x60, 0x03, 0xc4, 0x04, 0x3a, 0x00, 0x03, 0x00, 0x08,
-    0x00, 0x0d, 0x00, 0x19, 0x40, 0x0e, 0x08, 0x0c, 0x03, 0x04, 0x0a, 0x05, 0x01, 0x05, 0x0d, 0x06,
-    0x72, 0x01, 0x0e, 0x72, 0x00, 0x2b, 0x2b, 0x32, 0x12, 0x17, 0x39, 0x30, 0x31, 0x65, 0x11, 0x23,
-    0x11, 0x37, 0x01, 0x33, 0x01, 0x23, 0x01, 0x01, 0x17, 0x23, 0x01, 0x02, 0x34, 0x77, 0x54, 0x01,
-    0x37, 0x7c, 0xfe, 0x65, 0x57, 0xfe, 0xd7, 0x01, 0x3b, 0x3c, 0x57, 0xfe, 0x64, 0x65, 0xfd, 0xfb,
-    0x02, 0x05, 0x8b, 0x03, 0x4a, 0xfb, 0xc6, 0x04, 0x3a, 0xfc, 0xb6, 0xf0, 0x04, 0x3a, 0x00, 0x02,
-    0x00, 0x5c, 0xff, 0xec, 0x04, 0x19, 0x06, 0x1c, 0x00, 0x2c, 0x00, 0x42, 0x00, 0x19, 0x40, 0x0d,
-    0x14, 0x28, 0x3e, 0x03, 0x04, 0x33, 0x1e, 0x0b, 0x72, 0x0b, 0x04, 0x01, 0x72, 0x00, 0x2b, 0x32,
-    0x2b, 0x32, 0x12, 0x17, 0x39, 0x30, 0x31, 0x53, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x17, 0x07,
-    0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x15, 0x14, 0x1e, 0x02, 0x17, 0x1e, 0x02, 0x15, 0x15, 0x14,
-    0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x35, 0x34, 0x36, 0x36, 0x37, 0x35, 0x2e, 0x02, 0x03,
-    0x15, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x3e, 0x02, 0x35, 0x35, 0x34, 0x2e, 0x02, 0x27, 0x22, 0x0e,
-    0x02, 0xda, 0x5c, 0xa4, 0x6e, 0x4f, 0x8e, 0x45, 0x0a, 0x39, 0x85, 0x5b, 0x45, 0x6e, 0x41, 0x1b,
-    0x3e, 0x6b, 0x51, 0x91, 0xc0, 0x60, 0x42, 0x7d, 0xb1, 0x6d, 0x6e, 0xb1, 0x7e, 0x43, 0x67, 0xa1,
-    0x57, 0x4f, 0x64, 0x2e, 0x06, 0x2f, 0x5a, 0x87, 0x58, 0x58, 0x85, 0x5a, 0x2e, 0x37, 0x61, 0x7c,
-    0x45, 0x5b, 0x8b, 0x5e, 0x30, 0x05, 0x09, 0x51, 0x7c, 0x46, 0x1e, 0x24, 0x68, 0x19, 0x28, 0x27,
-    0x4b, 0x35, 0x20, 0x3d, 0x36, 0x32, 0x15, 0x29, 0x9f, 0xd6, 0x7b, 0x20, 0x72, 0xc0, 0x8d, 0x4e,
-    0x4e, 0x8d, 0xc0, 0x72, 0x20, 0x85, 0xc9, 0x7d, 0x10, 0x08, 0x1f, 0x55, 0x64, 0xfd, 0x45, 0x20,
-    0x55, 0x98, 0x76, 0x43, 0x43, 0x76, 0x98, 0x55, 0x20, 0x4f, 0x8c, 0x70, 0x4a, 0x0c, 0x44, 0x76,
-    0x96, 0x00, 0x00, 0x02, 0x00, 0x6c, 0xff, 0xec, 0x03, 0xe9, 0x04, 0x4e, 0x00, 0x1f, 0x00, 0x3f,
-    0x00, 0x1f, 0x40, 0x0f, 0x00, 0x21, 0x3e, 0x3e, 0x03, 0x03, 0x16, 0x35, 0x2b, 0x07, 0x72, 0x0c,
-    0x16, 0x0b, 0x72, 0x00, 0x2b, 0x32, 0x2b, 0x32, 0x12, 0x39, 0x2f, 0x33, 0x12, 0x39, 0x39, 0x30,
-    0x31, 0x41, 0x33, 0x15, 0x23, 0x22, 0x06, 0x06, 0x15, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x36, 0x36,
-    0x35, 0x33, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x34, 0x3e, 0x02, 0x05, 0x23, 0x22,
-    0x2e, 0x02, 0x35, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x23, 0x34, 0x26, 0x26, 0x23,
-    0x22, 0x06, 0x06, 0x15, 0x14, 0x1e, 0x02, 0x33, 0x33, 0x02, 0x1a, 0xc2, 0xb9, 0x67, 0x8e, 0x4a,
-    0x2b, 0x53, 0x78, 0x4d, 0x64, 0x94, 0x52, 0x78, 0x4e, 0x81, 0xa0, 0x53, 0x60, 0xa2, 0x77, 0x42,
-    0x38, 0x6c, 0xa1, 0x01, 0x2b, 0xc2, 0x60, 0x99, 0x6a, 0x38, 0x3c, 0x70, 0x9c, 0x60, 0x58, 0x9c,
-    0x78, 0x44, 0x77, 0x54, 0x8e, 0x57, 0x69, 0x86, 0x40, 0x22, 0x47, 0x72, 0x50, 0xb9, 0x02, 0x44,
-    0x4e, 0x2b, 0x5b, 0x48, 0x2f, 0x4e, 0x39, 0x1f, 0x3e, 0x67, 0x3f, 0x55, 0x7d, 0x51, 0x28, 0x2b,
-    0x52, 0x76, 0x4b, 0x44, 0x69, 0x48, 0x25, 0x38, 0x2a, 0x4b, 0x62, 0x38, 0x4a, 0x73, 0x4e, 0x28,
-    0x2b, 0x52, 0x73, 0x48, 0x3e, 0x5e, 0x36, 0x38, 0x5c, 0x38, 0x2b, 0x47, 0x33, 0x1c, 0x00, 0x02,
-    0x00, 0x4a, 0xfe, 0x7c, 0x03, 0x9e, 0x05, 0xb0, 0x00, 0x28, 0x00, 0x2c, 0x00, 0x15, 0x40, 0x09,
-    0x15, 0x02, 0x2c, 0x2c, 0x29, 0x29, 0x00, 0x02, 0x72, 0x00, 0x2b, 0x32, 0x2f, 0x33, 0x11, 0x33,
-    0x2f, 0x30, 0x31, 0x41, 0x33, 0x15, 0x01, 0x0e, 0x02, 0x15, 0x14, 0x1e, 0x02, 0x17, 0x17, 0x1e,
-    0x02, 0x15, 0x14, 0x06, 0x06, 0x07, 0x27, 0x3e, 0x02, 0x35, 0x34, 0x26, 0x26, 0x27, 0x27, 0x2e,
-    0x03, 0x35, 0x34, 0x36, 0x36, 0x37, 0x01, 0x21, 0x15, 0x21, 0x03, 0x60, 0x3e, 0xfe, 0x73, 0x52,
-    0x65, 0x2e, 0x1e, 0x3d, 0x60, 0x42, 0x6d, 0x4a, 0x68, 0x38, 0x37, 0x4d, 0x21, 0x44, 0x1d, 0x36,
-    0x23, 0x23, 0x46, 0x35, 0x5a, 0x5f, 0x85, 0x55, 0x27, 0x2f, 0x71, 0x61, 0xfe, 0x94, 0x03, 0x26,
-    0xfc, 0xda, 0x05, 0xb0, 0x4e, 0xfe, 0x09, 0x66, 0xab, 0x9c, 0x52, 0x32, 0x4c, 0x39, 0x2a, 0x12,
-    0x1f, 0x13, 0x2b, 0x4a, 0x42, 0x3a, 0x6f, 0x56, 0x15, 0x3a, 0x18, 0x3f, 0x4b, 0x2a, 0x1f, 0x2a,
-    0x20, 0x0d, 0x18, 0x19, 0x3d, 0x51, 0x6b, 0x47, 0x48, 0xae, 0xcf, 0x78, 0x02, 0x0a, 0x66, 0x00,
-    0x00, 0x02, 0x00, 0x9f, 0xfe, 0x61, 0x03, 0xd6, 0x04, 0x4e, 0x00, 0x04, 0x00, 0x1c, 0x00, 0x17,
-    0x40, 0x0c, 0x18, 0x0b, 0x03, 0x06, 0x72, 0x02, 0x0a, 0x72, 0x0b, 0x07, 0x72, 0x11, 0x00, 0x2f,
-    0x2b, 0x2b, 0x2b, 0x11, 0x33, 0x30, 0x31, 0x41, 0x11, 0x23, 0x11, 0x33, 0x03, 0x07, 0x34, 0x3e,
-    0x02, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x11, 0x23, 0x11, 0x34, 0x2e, 0x02, 0x23, 0x22, 0x0e, 0x02,
-    0x01, 0x17, 0x78, 0x6e, 0x0d, 0x3d, 0x36, 0x6b, 0xa0, 0x6a, 0x55, 0x86, 0x5d, 0x30, 0x78, 0x26,
-    0x48, 0x61, 0x3c, 0x61, 0x82, 0x4e, 0x22, 0x03, 0x53, 0xfc, 0xad, 0x04, 0x3a, 0xfd, 0xfb, 0x01,
-    0x76, 0xc5, 0x90, 0x4f, 0x2c, 0x62, 0x9f, 0x73, 0xfb, 0xb3, 0x04, 0x4c, 0x5c, 0x79, 0x47, 0x1e,
-    0x49, 0x7d, 0x9a, 0x00, 0x00, 0x03, 0x00, 0x8b, 0xff, 0xec, 0x04, 0x0a, 0x05, 0xc5, 0x00, 0x19,
-    0x00, 0x27, 0x00, 0x36, 0x00, 0x1d, 0x40, 0x10, 0x0d, 0x28, 0x6a, 0x30, 0x20, 0x6a, 0x30, 0x30,
-    0x0d, 0x00, 0x1a, 0x6a, 0x00, 0x0d, 0x0b, 0x72, 0x00, 0x2b, 0x2f, 0x2b, 0x12, 0x39, 0x2f, 0x2b,
-    0x2b, 0x30, 0x31, 0x41, 0x32, 0x1e, 0x03, 0x15, 0x15, 0x14, 0x0e, 0x03, 0x23, 0x22, 0x2e, 0x03,
-    0x35, 0x35, 0x34, 0x3e, 0x03, 0x17, 0x22, 0x0e, 0x02, 0x15, 0x15, 0x21, 0x35, 0x34, 0x2e, 0x03,
-    0x03, 0x32, 0x3e, 0x03, 0x35, 0x35, 0x21, 0x15, 0x14, 0x1e, 0x03, 0x02, 0x4a, 0x55, 0x8c, 0x6d,
-    0x4b, 0x27, 0x26, 0x4b, 0x6c, 0x8c, 0x55, 0x54, 0x8b, 0x6e, 0x4c, 0x28, 0x28, 0x4b, 0x6d, 0x8b,
-    0x54, 0x51, 0x7b, 0x52, 0x29, 0x02, 0x90, 0x1b, 0x34, 0x4f, 0x69, 0x40, 0x42, 0x69, 0x4e, 0x34,
-    0x1a, 0xfd, 0x70, 0x1a, 0x36, 0x4f, 0x69, 0x05, 0xc5, 0x34, 0x67, 0x99, 0xc9, 0x7c, 0xe3, 0x7c,
-    0xca, 0x9a, 0x68, 0x35, 0x35, 0x68, 0x9a, 0xca, 0x7c, 0xe3, 0x7c, 0xc9, 0x99, 0x67, 0x34, 0x67,
-    0x47, 0x87, 0xbe, 0x77, 0x54, 0x54, 0x5f, 0xa1, 0x7e, 0x57, 0x2e, 0xfa, 0xf5, 0x30, 0x5a, 0x80,
-    0xa1, 0x5e, 0x45, 0x45, 0x5e, 0xa1, 0x80, 0x5a, 0x30, 0x00, 0x00, 0x01, 0x00, 0xb7, 0xff, 0xf6,
-    0x02, 0x22, 0x04, 0x3a, 0x00, 0x11, 0x00, 0x0e, 0xb6, 0x06, 0x0d, 0x0b, 0x72, 0x00, 0x06, 0x72,
-    0x00, 0x2b, 0x2b, 0x32, 0x30, 0x31, 0x53, 0x33, 0x11, 0x14, 0x16, 0x16, 0x33, 0x32, 0x36, 0x37,
-    0x17, 0x06, 0x06, 0x23, 0x22, 0x26, 0x26, 0x35, 0xb7, 0x78, 0x28, 0x40, 0x25, 0x1b, 0x32, 0x14,
-    0x05, 0x16, 0x46, 0x24, 0x44, 0x6b, 0x3c, 0x04, 0x3a, 0xfc, 0xd8, 0x4b, 0x4d, 0x1a, 0x07, 0x04,
-    0x65, 0x07, 0x09, 0x34, 0x7c, 0x6c, 0x00, 0x02, 0x00, 0x32, 0xff, 0xf5, 0x04, 0x3d, 0x05, 0xee,
-    0x00, 0x04, 0x00, 0x26, 0x00, 0x1e, 0x40, 0x10, 0x00, 0x1b, 0x04, 0x03, 0x04, 0x02, 0x20, 0x05,
-    0x00, 0x72, 0x0f, 0x16, 0x16, 0x02, 0x0a, 0x72, 0x00, 0x2b, 0x32, 0x2f, 0x33, 0x2b, 0x32, 0x12,
-    0x17, 0x39, 0x30, 0x31, 0x41, 0x01, 0x23, 0x01, 0x17, 0x01, 0x32, 0x1e, 0x02, 0x17, 0x01, 0x1e,
-    0x02, 0x33, 0x32, 0x36, 0x37, 0x17, 0x06, 0x06, 0x23, 0x22, 0x26, 0x26, 0x27, 0x01, 0x03, 0x2e,
-    0x02, 0x23, 0x22, 0x06, 0x07, 0x27, 0x36, 0x36, 0x02, 0x17, 0xfe, 0x9f, 0x84, 0x01, 0xb5, 0x57,
-    0xfe, 0xbf, 0x3c, 0x54, 0x38, 0x25, 0x0d, 0x01, 0x91, 0x12, 0x23, 0x2e, 0x20, 0x08, 0x1b, 0x08,
-    0x07, 0x0a, 0x27, 0x12, 0x42, 0x54, 0x38, 0x18, 0xfe, 0xdc, 0x6d, 0x13, 0x27, 0x38, 0x2b, 0x08,
-    0x1f, 0x09, 0x05, 0x0c, 0x30, 0x03, 0x89, 0xfc, 0x77, 0x04, 0x4e, 0x15, 0x01, 0xb5, 0x26, 0x40,
-    0x4c, 0x26, 0xfb, 0xd6, 0x2e, 0x3e, 0x1f, 0x02, 0x02, 0x65, 0x04, 0x07, 0x32, 0x5f, 0x41, 0x03,
-    0x0b, 0x01, 0x19, 0x31, 0x46, 0x25, 0x02, 0x02, 0x60, 0x05, 0x06, 0x00, 0x00, 0x02, 0x00, 0x78,
-    0xfe, 0x82, 0x03, 0x9c, 0x05, 0xc4, 0x00, 0x1e, 0x00, 0x46, 0x00, 0x19, 0x40, 0x0b, 0x1f, 0x11,
-    0x0f, 0x0f, 0x21, 0x21, 0x33, 0x05, 0x1b, 0x03, 0x72, 0x00, 0x2b, 0x32, 0x2f, 0x39, 0x2f, 0x33,
-    0x12, 0x39, 0x39, 0x30, 0x31, 0x41, 0x07, 0x2e, 0x02, 0x23, 0x22, 0x06, 0x06, 0x15, 0x14, 0x1e,
-    0x02, 0x33, 0x33, 0x15, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x16, 0x16,
-    0x03, 0x33, 0x15, 0x23, 0x22, 0x06, 0x06, 0x15, 0x14, 0x16, 0x16, 0x17, 0x17, 0x1e, 0x02, 0x15,
-    0x14, 0x06, 0x06, 0x07, 0x27, 0x3e, 0x02, 0x35, 0x34, 0x26, 0x26, 0x27, 0x27, 0x2e, 0x03, 0x35,
-    0x34, 0x3e, 0x02, 0x03, 0x97, 0x10, 0x27, 0x52, 0x55, 0x2c, 0x76, 0x97, 0x47, 0x2a, 0x57, 0x8b,
-    0x61, 0x83, 0x87, 0x71, 0xb2, 0x7c, 0x42, 0x41, 0x79, 0xa9, 0x69, 0x30, 0x5e, 0x58, 0xd1, 0x87,
-    0x83, 0x7f, 0xc6, 0x71, 0x5d, 0xa2, 0x66, 0x5e, 0x4f, 0x67, 0x33, 0x3a, 0x4d, 0x1d, 0x46, 0x19,
-    0x37, 0x27, 0x1f, 0x45, 0x39, 0x44, 0x64, 0xaa, 0x7d, 0x45, 0x52, 0x94, 0xcb, 0x05, 0x98, 0x63,
-    0x0d, 0x12, 0x0a, 0x3e, 0x69, 0x40, 0x37, 0x58, 0x3e, 0x21, 0x55, 0x32, 0x57, 0x73, 0x43, 0x52,
-    0x7e, 0x55, 0x2c, 0x0a, 0x14, 0xfd, 0xcb, 0x50, 0x4a, 0x9d, 0x7d, 0x69, 0x89, 0x53, 0x1b, 0x18,
-    0x14, 0x2d, 0x47, 0x3a, 0x38, 0x66, 0x4e, 0x15, 0x3b, 0x17, 0x35, 0x43, 0x2c, 0x1b, 0x26, 0x1e,
-    0x0f, 0x11, 0x19, 0x45, 0x66, 0x99, 0x6d, 0x6a, 0xa1, 0x6e, 0x37, 0x00, 0x00, 0x03, 0x00, 0x34,
-    0xff, 0xf6, 0x04, 0xa8, 0x04, 0x3a, 0x00, 0x03, 0x00, 0x07, 0x00, 0x19, 0x00, 0x19, 0x40, 0x0d,
-    0x0e, 0x15, 0x0b, 0x72, 0x06, 0x0a, 0x72, 0x09, 0x07, 0x02, 0x03, 0x06, 0x72, 0x00, 0x2b, 0x32,
-    0x32, 0x32, 0x2b, 0x2b, 0x32, 0x30, 0x31, 0x41, 0x15, 0x21, 0x35, 0x21, 0x11, 0x23, 0x11, 0x21,
-    0x33, 0x11, 0x14, 0x16, 0x16, 0x33, 0x32, 0x36, 0x37, 0x17, 0x06, 0x06, 0x23, 0x22, 0x26, 0x26,
-    0x35, 0x04, 0x6e, 0xfb, 0xc6, 0x01, 0x2e, 0x78, 0x02, 0x52, 0x79, 0x27, 0x41, 0x25, 0x1b, 0x31,
-    0x15, 0x05, 0x16, 0x47, 0x23, 0x45, 0x6a, 0x3d, 0x04, 0x3a, 0x68, 0x68, 0xfb, 0xc6, 0x04, 0x3a,
-    0xfc, 0xd8, 0x4b, 0x4d, 0x1a, 0x07, 0x04, 0x65, 0x07, 0x09, 0x34, 0x7c, 0x6c, 0x00, 0x00, 0x01,
-    0x00, 0x9f, 0xfe, 0x60, 0x04, 0x04, 0x04, 0x4e, 0x00, 0x2f, 0x00, 0x17, 0x40, 0x0c, 0x1e, 0x29,
-    0x06, 0x11, 0x0b, 0x72, 0x06, 0x07, 0x72, 0x00, 0x0e, 0x72, 0x00, 0x2b, 0x2b, 0x2b, 0x11, 0x33,
-    0x32, 0x30, 0x31, 0x53, 0x11, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x15, 0x14, 0x0e,
-    0x02, 0x23, 0x22, 0x2e, 0x02, 0x27, 0x32, 0x16, 0x16, 0x31, 0x1e, 0x02, 0x33, 0x32, 0x3e, 0x02,
-    0x35, 0x35, 0x34, 0x2e, 0x02, 0x23, 0x22, 0x0e, 0x02, 0x15, 0x03, 0x9f, 0x43, 0x78, 0x9d, 0x59,
-    0x6a, 0xa2, 0x6f, 0x39, 0x37, 0x69, 0x99, 0x62, 0x61, 0x97, 0x6b, 0x41, 0x0c, 0x01, 0x1e, 0x1d,
-    0x13, 0x53, 0x8d, 0x66, 0x52, 0x77, 0x4e, 0x26, 0x24, 0x4d, 0x77, 0x53, 0x56, 0x77, 0x49, 0x22,
-    0x01, 0xfe, 0x60, 0x04, 0x00, 0x7a, 0xb8, 0x7d, 0x3f, 0x52, 0x97, 0xd1, 0x80, 0x15, 0x77, 0xc3,
-    0x8d, 0x4c, 0x3a, 0x6c, 0x96, 0x5e, 0x0d, 0x0c, 0x4c, 0x80, 0x4e, 0x40, 0x73, 0x9d, 0x5c, 0x15,
-    0x62, 0xa9, 0x80, 0x48, 0x48, 0x78, 0x8e, 0x45, 0xfc, 0x0c, 0x00, 0x01, 0x00, 0x70, 0xfe, 0x88,
-    0x03, 0xd4, 0x04, 0x4e, 0x00, 0x2d, 0x00, 0x0e, 0xb5, 0x1b, 0x09, 0x05, 0x00, 0x07, 0x72, 0x00,
-    0x2b, 0xcc, 0x33, 0x2f, 0x30, 0x31, 0x41, 0x32, 0x16, 0x16, 0x15, 0x23, 0x34, 0x26, 0x26, 0x23,
-    0x22, 0x0e, 0x02, 0x15, 0x15, 0x14, 0x16, 0x16, 0x17, 0x1e, 0x02, 0x15, 0x14, 0x06, 0x06, 0x07,
-    0x27, 0x3e, 0x02, 0x35, 0x34, 0x26, 0x26, 0x27, 0x2e, 0x02, 0x35, 0x35, 0x34, 0x3e, 0x02, 0x02,
-    0x3e, 0x70, 0xb9, 0x6d, 0x73, 0x4a, 0x84, 0x55, 0x58, 0x80, 0x54, 0x29, 0x5d, 0xb2, 0x7d, 0x53,
-    0x6d, 0x37, 0x35, 0x49, 0x1f, 0x42, 0x1b, 0x31, 0x1f, 0x1f, 0x48, 0x3e, 0x95, 0xd8, 0x76, 0x3e,
-    0x78, 0xab, 0x04, 0x4e, 0x58, 0xac, 0x7f, 0x5a, 0x7f, 0x43, 0x47, 0x7b, 0x9d, 0x56, 0x2a, 0x71,
-    0xa8, 0x72, 0x1f, 0x14, 0x30, 0x50, 0x44, 0x30, 0x67, 0x53, 0x14, 0x3a, 0x17, 0x35, 0x42, 0x2a,
-    0x25, 0x2e, 0x1e, 0x0d, 0x21, 0x86, 0xd4, 0x95, 0x2a, 0x72, 0xc5, 0x93, 0x52, 0x00, 0x00, 0x03,
-    0x00, 0x5c, 0xff, 0xec, 0x04, 0x6d, 0x04, 0x3a, 0x00, 0x18, 0x00, 0x2e, 0x00, 0x32, 0x00, 0x13,
-    0x40, 0x09, 0x2a, 0x06, 0x32, 0x06, 0x72, 0x1f, 0x14, 0x0b, 0x72, 0x00, 0x2b, 0x32, 0x2b, 0x32,
-    0x32, 0x30, 0x31, 0x53, 0x35, 0x34, 0x3e, 0x02, 0x33, 0x1e, 0x02, 0x17, 0x1e, 0x02, 0x15, 0x15,
-    0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x37, 0x15, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x3e, 0x02,
-    0x35, 0x35, 0x34, 0x2e, 0x02, 0x23, 0x22, 0x0e, 0x02, 0x01, 0x15, 0x21, 0x35, 0x5c, 0x43, 0x7d,
-    0xb1, 0x6d, 0x1c, 0x30, 0x35, 0x24, 0x62, 0x8d, 0x4b, 0x42, 0x7d, 0xb1, 0x6d, 0x6e, 0xb1, 0x7e,
-    0x43, 0x78, 0x2e, 0x5b, 0x86, 0x59, 0x58, 0x85, 0x5a, 0x2e, 0x2e, 0x5b, 0x86, 0x58, 0x58, 0x86,
-    0x5a, 0x2e, 0x03, 0x99, 0xfd, 0xcc, 0x02, 0x0d, 0x20, 0x72, 0xbf, 0x8e, 0x4e, 0x01, 0x16, 0x1b,
-    0x0b, 0x26, 0x8b, 0xbe, 0x73, 0x20, 0x6e, 0xbf, 0x90, 0x52, 0x51, 0x93, 0xc7, 0x96, 0x20, 0x59,
-    0x9f, 0x7b, 0x47, 0x47, 0x7b, 0x9f, 0x59, 0x20, 0x53, 0x98, 0x76, 0x44, 0x44, 0x76, 0x98, 0x01,
-    0xba, 0x68, 0x68, 0x00, 0x00, 0x02, 0x00, 0x4d, 0xff, 0xec, 0x03, 0xca, 0x04, 0x3a, 0x00, 0x03,
-    0x00, 0x15, 0x00, 0x15, 0x40, 0x0a, 0x05, 0x0a, 0x11, 0x02, 0x03, 0x06, 0x72, 0x11, 0x0b, 0x72,
-    0x00, 0x2b, 0x2b, 0x32, 0x11, 0x33, 0x32, 0x30, 0x31, 0x41, 0x15, 0x21, 0x35, 0x21, 0x33, 0x11,
-    0x14, 0x16, 0x16, 0x33, 0x32, 0x36, 0x37, 0x17, 0x06, 0x06, 0x23, 0x22, 0x26, 0x26, 0x35, 0x03,
-    0xca, 0xfc, 0x83, 0x01, 0x71, 0x78, 0x26, 0x42, 0x29, 0x1e, 0x30, 0x16, 0x19, 0x24, 0x49, 0x26,
-    0x4f, 0x6c, 0x38, 0x04, 0x3a, 0x66, 0x66, 0xfc, 0xd9, 0x4b, 0x52, 0x21, 0x0b, 0x07, 0x5b, 0x14,
-    0x0c, 0x3c, 0x84, 0x6c, 0x00, 0x01, 0x00, 0x9c, 0xff, 0xec, 0x03, 0xcc, 0x04, 0x3a, 0x00, 0x1e,
-    0x00, 0x13, 0x40, 0x09, 0x10, 0x07, 0x19, 0x00, 0x06, 0x72, 0x19, 0x0b, 0x72, 0x00, 0x2b, 0x2b,
-    0x11, 0x33, 0x32, 0x30, 0x31, 0x53, 0x33, 0x11, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x3e, 0x02, 0x35,
-    0x26, 0x02, 0x27, 0x33, 0x1e, 0x02, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x9c,
-    0x78, 0x24, 0x41, 0x58, 0x34, 0x56, 0x7f, 0x52, 0x29, 0x01, 0x44, 0x31, 0x83, 0x1b, 0x31, 0x1e,
-    0x38, 0x70, 0xa9, 0x71, 0x53, 0x87, 0x60, 0x34, 0x04, 0x3a, 0xfd, 0x5c, 0x58, 0x7b, 0x4d, 0x23,
-    0x4e, 0x84, 0xa3, 0x55, 0x96, 0x01, 0x0f, 0x78, 0x41, 0x9c, 0xc2, 0x7c, 0x74, 0xcd, 0x9b, 0x57,
-    0x31, 0x68, 0xa2, 0x71, 0x00, 0x01, 0x00, 0x72, 0xfe, 0x22, 0x05, 0x0f, 0x04, 0x3b, 0x00, 0x2f,
-    0x00, 0x19, 0x40, 0x0c, 0x2b, 0x05, 0x05, 0x19, 0x18, 0x06, 0x72, 0x22, 0x0f, 0x0b, 0x72, 0x00,
-    0x00, 0x2f, 0x2b, 0x32, 0x2b, 0x32, 0x32, 0x11, 0x33, 0x30, 0x31, 0x41, 0x11, 0x34, 0x36, 0x36,
-    0x33, 0x32, 0x1e, 0x02, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x34, 0x36, 0x36,
-    0x37, 0x17, 0x0e, 0x02, 0x07, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x36, 0x36, 0x35, 0x2e, 0x03, 0x23,
-    0x22, 0x06, 0x15, 0x11, 0x02, 0x7d, 0x3b, 0x61, 0x39, 0x5d, 0xa2, 0x7a, 0x44, 0x46, 0x91, 0xe1,
-    0x9b, 0x9e, 0xdf, 0x8c, 0x41, 0x42, 0x75, 0x4d, 0x3e, 0x40, 0x5a, 0x2f, 0x02, 0x2e, 0x6b, 0xb5,
-    0x86, 0xa7, 0xd1, 0x63, 0x01, 0x2d, 0x55, 0x78, 0x4b, 0x28, 0x35, 0xfe, 0x22, 0x05, 0x48, 0x44,
-    0x5c, 0x30, 0x4f, 0x90, 0xc5, 0x75, 0x6f, 0xcc, 0x9f, 0x5c, 0x5a, 0x9e, 0xd1, 0x77, 0x79, 0xc9,
-    0x9b, 0x33, 0x58, 0x30, 0x8c, 0xa6, 0x57, 0x57, 0xa8, 0x88, 0x51, 0x89, 0xd4, 0x71, 0x55, 0x9c,
-    0x7b, 0x47, 0x39, 0x2c, 0xfa, 0xb4, 0x00, 0x02, 0x00, 0x7a, 0xfe, 0x44, 0x05, 0x0b, 0x04, 0x3a,
-    0x00, 0x1e, 0x00, 0x22, 0x00, 0x15, 0x40, 0x0a, 0x21, 0x07, 0x19, 0x0b, 0x72, 0x20, 0x10, 0x00,
-    0x06, 0x72, 0x00, 0x2b, 0x32, 0x32, 0x2b, 0x32, 0x2f, 0x30, 0x31, 0x53, 0x33, 0x11, 0x14, 0x1e,
-    0x02, 0x33, 0x32, 0x3e, 0x02, 0x35, 0x26, 0x26, 0x27, 0x33, 0x1e, 0x02, 0x15, 0x14, 0x0e, 0x02,
-    0x23, 0x22, 0x2e, 0x02, 0x35, 0x01, 0x33, 0x11, 0x23, 0x7a, 0x78, 0x43, 0x7a, 0xa6, 0x62, 0x89,
-    0xb8, 0x6c, 0x2f, 0x01, 0x50, 0x3a, 0x83, 0x20, 0x3a, 0x26, 0x41, 0x8c, 0xe1, 0xa1, 0x83, 0xd5,
-    0x98, 0x52, 0x01, 0xff, 0x77, 0x77, 0x04, 0x3a, 0xfe, 0x15, 0x89, 0xc2, 0x79, 0x38, 0x54, 0x8f,
-    0xb1, 0x5b, 0x8b, 0xfd, 0x70, 0x3c, 0x92, 0xb6, 0x73, 0x7d, 0xda, 0xa4, 0x5c, 0x47, 0x94, 0xe9,
-    0xa1, 0x01, 0xe9, 0xfa, 0x0a, 0x00, 0x00, 0x02, 0x00, 0x89, 0xff, 0xec, 0x06, 0x10, 0x04, 0x3a,
-    0x00, 0x1e, 0x00, 0x3f, 0x00, 0x19, 0x40, 0x0c, 0x01, 0x17, 0x0a, 0x0a, 0x29, 0x36, 0x1f, 0x06,
-    0x72, 0x36, 0x0b, 0x72, 0x00, 0x2b, 0x2b, 0x11, 0x33, 0x33, 0x11, 0x33, 0x32, 0x30, 0x31, 0x41,
-    0x33, 0x1e, 0x02, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x11, 0x33, 0x11, 0x14,
-    0x1e, 0x02, 0x33, 0x32, 0x3e, 0x02, 0x35, 0x26, 0x02, 0x25, 0x33, 0x06, 0x02, 0x07, 0x14, 0x1e,
-    0x03, 0x33, 0x32, 0x3e, 0x02, 0x35, 0x11, 0x33, 0x11, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x03,
-    0x35, 0x34, 0x36, 0x36, 0x05, 0x04, 0x82, 0x23, 0x3f, 0x28, 0x2e, 0x5d, 0x90, 0x62, 0x53, 0x84,
-    0x5e, 0x32, 0x5d, 0x27, 0x46, 0x5f, 0x38, 0x48, 0x65, 0x40, 0x1e, 0x01, 0x55, 0xfb, 0xd1, 0x82,
-    0x3e, 0x55, 0x01, 0x13, 0x28, 0x3f, 0x57, 0x39, 0x39, 0x5f, 0x46, 0x27, 0x5d, 0x32, 0x5e, 0x84,
-    0x53, 0x4f, 0x7b, 0x5b, 0x3b, 0x1d, 0x28, 0x3f, 0x04, 0x3a, 0x43, 0x9e, 0xc6, 0x7f, 0x72, 0xc9,
-    0x97, 0x56, 0x3d, 0x7c, 0xbc, 0x7f, 0x01, 0x22, 0xfe, 0xdc, 0x6b, 0x96, 0x5f, 0x2b, 0x49, 0x7e,
-    0xa1, 0x58, 0x99, 0x01, 0x14, 0x7a, 0x7a, 0xfe, 0xec, 0x99, 0x47, 0x84, 0x70, 0x56, 0x2f, 0x2b,
-    0x5f, 0x96, 0x6b, 0x01, 0x24, 0xfe, 0xde, 0x7f, 0xbc, 0x7c, 0x3d, 0x37, 0x66, 0x8a, 0xa6, 0x5b,
-    0x7f, 0xc6, 0x9e, 0x00, 0x00, 0x01, 0x00, 0x86, 0xff, 0xec, 0x04, 0x76, 0x05, 0xd0, 0x00, 0x38,
-    0x00, 0x1d, 0x40, 0x0d, 0x1d, 0x1e, 0x17, 0x36, 0x04, 0x04, 0x0d, 0x23, 0x17, 0x0b, 0x72, 0x2d,
-    0x0d, 0x00, 0x2f, 0x33, 0x2b, 0x32, 0x11, 0x39, 0x2f, 0x33, 0x10, 0xcc, 0x32, 0x30, 0x31, 0x41,
-    0x17, 0x06, 0x06, 0x23, 0x22, 0x24, 0x26, 0x35, 0x35, 0x34, 0x36, 0x36, 0x33, 0x32, 0x1e, 0x02,
-    0x15, 0x11, 0x14, 0x06, 0x06, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x11, 0x37, 0x11, 0x14, 0x16, 0x16,
-    0x33, 0x32, 0x36, 0x36, 0x35, 0x11, 0x34, 0x2e, 0x02, 0x23, 0x22, 0x06, 0x06, 0x15, 0x15, 0x14,
-    0x16, 0x16, 0x33, 0x32, 0x36, 0x04, 0x6c, 0x0a, 0x26, 0x6f, 0x35, 0xbf, 0xfe, 0xfa, 0x86, 0x51,
-    0x88, 0x53, 0x4d, 0x78, 0x53, 0x2b, 0x67, 0xbb, 0x7f, 0x5e, 0x9c, 0x71, 0x3e, 0x78, 0x4b, 0x89,
-    0x5d, 0x60, 0x85, 0x45, 0x19, 0x33, 0x4c, 0x34, 0x30, 0x52, 0x32, 0x5f, 0xce, 0xa6, 0x35, 0x66,
-    0x03, 0x07, 0x65, 0x0e, 0x15, 0x84, 0xe1, 0x8c, 0x13, 0x6a, 0x94, 0x4f, 0x35, 0x66, 0x93, 0x5e,
-    0xfd, 0x69, 0x9a, 0xc7, 0x60, 0x3b, 0x72, 0xa7, 0x6d, 0x01, 0x49, 0x02, 0xfe, 0xb5, 0x72, 0x99,
-    0x4c, 0x44, 0x98, 0x7b, 0x02, 0x97, 0x49, 0x6d, 0x48, 0x24, 0x2f, 0x64, 0x50, 0x15, 0x67, 0xb2,
-    0x6c, 0x13, 0x00, 0x03, 0xff, 0xd1, 0x00, 0x00, 0x04, 0x84, 0x05, 0xbc, 0x00, 0x03, 0x00, 0x16,
-    0x00, 0x29, 0x00, 0x1e, 0x40, 0x0e, 0x10, 0x09, 0x09, 0x1f, 0x26, 0x03, 0x72, 0x1a, 0x18, 0x16,
-    0x03, 0x03, 0x02, 0x12, 0x00, 0x3f, 0x33, 0x11, 0x33, 0x33, 0x33, 0x2b, 0x32, 0x32, 0x11, 0x33,
-    0x30, 0x31, 0x41, 0x11, 0x23, 0x11, 0x37, 0x13, 0x3e, 0x02, 0x33, 0x32, 0x16, 0x17, 0x07, 0x26,
-    0x26, 0x23, 0x22, 0x06, 0x06, 0x07, 0x01, 0x27, 0x03, 0x13, 0x17, 0x07, 0x01, 0x2e, 0x02, 0x23,
-    0x22, 0x06, 0x07, 0x27, 0x36, 0x36, 0x33, 0x32, 0x16, 0x16, 0x02, 0x69, 0x7b, 0x55, 0xd6, 0x23,
-    0x48, 0x57, 0x38, 0x21, 0x39, 0x17, 0x1e, 0x07, 0x25, 0x17, 0x1a, 0x35, 0x35, 0x1c, 0xfe, 0xdf,
-    0x59, 0xcb, 0xd6, 0x38, 0x55, 0xfe, 0xdb, 0x1c, 0x35, 0x34, 0x1b, 0x17, 0x26, 0x07, 0x1d, 0x18,
-    0x38, 0x21, 0x37, 0x57, 0x4b, 0x02, 0xa4, 0xfd, 0x5c, 0x02, 0xa4, 0x67, 0x01, 0xe1, 0x4e, 0x5b,
-    0x27, 0x0f, 0x0c, 0x61, 0x05, 0x0b, 0x14, 0x3d, 0x3d, 0xfd, 0x81, 0x0b, 0x02, 0x9f, 0xfe, 0x1a,
-    0xb9, 0x0b, 0x02, 0x7f, 0x3d, 0x3d, 0x14, 0x0b, 0x05, 0x60, 0x0d, 0x0f, 0x26, 0x5a, 0x00, 0x03,
-    0x00, 0x39, 0xff, 0xec, 0x06, 0x26, 0x04, 0x3b, 0x00, 0x03, 0x00, 0x24, 0x00, 0x45, 0x00, 0x21,
-    0x40, 0x10, 0x26, 0x05, 0x03, 0x1c, 0x0f, 0x2f, 0x3c, 0x0b, 0x72, 0x3c, 0x0f, 0x02, 0x03, 0x06,
-    0x72, 0x0f, 0x00, 0x2f, 0x2b, 0x32, 0x11, 0x39, 0x2b, 0x32, 0x11, 0x33, 0x11, 0x33, 0x33, 0x30,
-    0x31, 0x41, 0x15, 0x21, 0x35, 0x05, 0x33, 0x1e, 0x02, 0x15, 0x14, 0x0e, 0x03, 0x23, 0x22, 0x2e,
-    0x02, 0x35, 0x11, 0x33, 0x11, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x3e, 0x03, 0x35, 0x26, 0x02, 0x25,
-    0x33, 0x06, 0x02, 0x07, 0x14, 0x1e, 0x03, 0x33, 0x32, 0x3e, 0x02, 0x35, 0x11, 0x33, 0x11, 0x14,
-    0x0e, 0x02, 0x23, 0x22, 0x2e, 0x03, 0x35, 0x34, 0x36, 0x36, 0x06, 0x26, 0xfa, 0x13, 0x04, 0x93,
-    0x83, 0x23, 0x3e, 0x28, 0x1c, 0x38, 0x56, 0x75, 0x4b, 0x53, 0x85, 0x5d, 0x32, 0x5d, 0x27, 0x46,
-    0x5f, 0x38, 0x35, 0x51, 0x3b, 0x26, 0x12, 0x02, 0x55, 0xfb, 0xf7, 0x82, 0x3d, 0x56, 0x01, 0x12,
-    0x25, 0x3b, 0x51, 0x35, 0x39, 0x5f, 0x46, 0x26, 0x5d, 0x32, 0x5d, 0x85, 0x53, 0x4a, 0x75, 0x57,
-    0x38, 0x1c, 0x28, 0x40, 0x04, 0x3b, 0x68, 0x68, 0x01, 0x43, 0x9e, 0xc6, 0x7f, 0x5b, 0xa6, 0x8a,
-    0x66, 0x37, 0x3d, 0x7c, 0xbc, 0x7f, 0x01, 0x0b, 0xfe, 0xf3, 0x6b, 0x96, 0x5f, 0x2b, 0x2f, 0x55,
-    0x71, 0x84, 0x47, 0x99, 0x01, 0x14, 0x7a, 0x7a, 0xfe, 0xec, 0x99, 0x47, 0x84, 0x70, 0x56, 0x2f,
-    0x2b, 0x5f, 0x96, 0x6b, 0x01, 0x0d, 0xfe, 0xf5, 0x7f, 0xbc, 0x7c, 0x3d, 0x37, 0x66, 0x8a, 0xa6,
-    0x5b, 0x7f, 0xc6, 0x9e, 0x00, 0x03, 0x00, 0x37, 0xff, 0xf5, 0x05, 0xa0, 0x05, 0xb0, 0x00, 0x1b,
-    0x00, 0x1f, 0x00, 0x23, 0x00, 0x21, 0x40, 0x11, 0x1f, 0x23, 0x18, 0x05, 0x05, 0x0e, 0x22, 0x23,
-    0x1e, 0x08, 0x72, 0x23, 0x02, 0x72, 0x0e, 0x09, 0x72, 0x00, 0x2b, 0x2b, 0x2b, 0x11, 0x33, 0x12,
-    0x39, 0x2f, 0x33, 0x11, 0x33, 0x30, 0x31, 0x41, 0x35, 0x3e, 0x02, 0x33, 0x32, 0x16, 0x16, 0x15,
-    0x14, 0x0e, 0x02, 0x23, 0x27, 0x32, 0x3e, 0x02, 0x35, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06,
-    0x03, 0x11, 0x23, 0x11, 0x21, 0x15, 0x21, 0x35, 0x02, 0x33, 0x36, 0x86, 0x86, 0x37, 0x95, 0xe1,
-    0x7e, 0x39, 0x75, 0xb5, 0x7c, 0x01, 0x5d, 0x87, 0x57, 0x29, 0x5d, 0xa9, 0x72, 0x42, 0x7f, 0x7c,
-    0x0d, 0x7b, 0x02, 0xb2, 0xfb, 0x9e, 0x02, 0xb1, 0x6e, 0x19, 0x27, 0x17, 0x62, 0xcc, 0xa0, 0x55,
-    0x9c, 0x7b, 0x47, 0x65, 0x35, 0x5d, 0x79, 0x43, 0x79, 0x9c, 0x4b, 0x15, 0x27, 0x02, 0xe4, 0xfa,
-    0x50, 0x05, 0xb0, 0x6a, 0x6a, 0x00, 0x00, 0x02, 0x00, 0x86, 0xff, 0xec, 0x04, 0xc2, 0x05, 0xc4,
-    0x00, 0x03, 0x00, 0x2c, 0x00, 0x1d, 0x40, 0x0e, 0x03, 0x02, 0x02, 0x09, 0x1d, 0x19, 0x14, 0x03,
-    0x72, 0x29, 0x04, 0x09, 0x09, 0x72, 0x00, 0x2b, 0xcc, 0x33, 0x2b, 0xcc, 0x33, 0x12, 0x39, 0x2f,
-    0x33, 0x30, 0x31, 0x41, 0x15, 0x21, 0x35, 0x01, 0x33, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x35,
-    0x35, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x16, 0x16, 0x17, 0x23, 0x2e, 0x02, 0x23, 0x22, 0x0e, 0x02,
-    0x15, 0x15, 0x14, 0x1e, 0x03, 0x33, 0x32, 0x36, 0x36, 0x03, 0x60, 0xfd, 0x8c, 0x03, 0x5a, 0x7c,
-    0x0f, 0x84, 0xe5, 0xa0, 0x7c, 0xca, 0x91, 0x4d, 0x4d, 0x92, 0xce, 0x80, 0x9b, 0xe1, 0x84, 0x0f,
-    0x7c, 0x0e, 0x60, 0xa8, 0x7d, 0x66, 0xa0, 0x70, 0x3b, 0x24, 0x46, 0x67, 0x86, 0x51, 0x81, 0xac,
-    0x60, 0x03, 0x16, 0x69, 0x69, 0xfe, 0xb1, 0x94, 0xd4, 0x73, 0x5e, 0xae, 0xf2, 0x93, 0xb5, 0x94,
-    0xf2, 0xae, 0x5e, 0x71, 0xd4, 0x96, 0x76, 0xa4, 0x57, 0x4e, 0x92, 0xca, 0x7c, 0xb7, 0x60, 0xa8,
-    0x88, 0x62, 0x35, 0x52, 0xa4, 0x00, 0x00, 0x03, 0x00, 0x34, 0x00, 0x00, 0x08, 0x03, 0x05, 0xb0,
-    0x00, 0x11, 0x00, 0x15, 0x00, 0x2e, 0x00, 0x27, 0x40, 0x13, 0x24, 0x21, 0x21, 0x09, 0x2e, 0x16,
-    0x16, 0x00, 0x0a, 0x09, 0x08, 0x72, 0x14, 0x15, 0x15, 0x23, 0x00, 0x02, 0x72, 0x00, 0x2b, 0x32,
-    0x32, 0x11, 0x33, 0x2b, 0x32, 0x12, 0x39, 0x2f, 0x33, 0x11, 0x33, 0x11, 0x33, 0x30, 0x31, 0x41,
-    0x33, 0x03, 0x06, 0x02, 0x0e, 0x02, 0x23, 0x23, 0x35, 0x37, 0x3e, 0x04, 0x37, 0x01, 0x15, 0x21,
-    0x35, 0x01, 0x21, 0x32, 0x16, 0x16, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x21, 0x11, 0x33, 0x11, 0x21,
-    0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x21, 0x01, 0x98, 0x7b, 0x26, 0x09, 0x20, 0x36,
-    0x56, 0x80, 0x5a, 0x2a, 0x26, 0x3b, 0x56, 0x3d, 0x29, 0x1b, 0x09, 0x02, 0xe1, 0xfd, 0x6e, 0x02,
-    0xc9, 0x01, 0x93, 0x9f, 0xd6, 0x6e, 0x3e, 0x7a, 0xb4, 0x77, 0xfe, 0x1d, 0x7b, 0x01, 0x68, 0x80,
-    0x9e, 0x4a, 0x4a, 0x9e, 0x80, 0xfe, 0x6d, 0x05, 0xb0, 0xfd, 0x5f, 0xa7, 0xff, 0x00, 0xb9, 0x76,
-    0x39, 0x6a, 0x01, 0x02, 0x2a, 0x5e, 0x9d, 0xeb, 0xa1, 0x02, 0x92, 0x6a, 0x6a, 0xfd, 0xa2, 0x6e,
-    0xc1, 0x7a, 0x5c, 0x9a, 0x74, 0x3f, 0x05, 0xb0, 0xfa, 0xba, 0x5b, 0x93, 0x53, 0x50, 0x91, 0x5c,
-    0x00, 0x03, 0x00, 0xbb, 0x00, 0x00, 0x08, 0x34, 0x05, 0xb0, 0x00, 0x03, 0x00, 0x07, 0x00, 0x20,
-    0x00, 0x23, 0x40, 0x11, 0x08, 0x20, 0x20, 0x03, 0x02, 0x02, 0x06, 0x15, 0x07, 0x02, 0x72, 0x16,
-    0x13, 0x13, 0x06, 0x08, 0x72, 0x00, 0x2b, 0x32, 0x11, 0x33, 0x2b, 0x32, 0x11, 0x39, 0x2f, 0x33,
-    0x33, 0x2f, 0x33, 0x30, 0x31, 0x41, 0x15, 0x21, 0x35, 0x13, 0x11, 0x23, 0x11, 0x01, 0x21, 0x32,
-    0x16, 0x16, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x21, 0x11, 0x33, 0x11, 0x21, 0x32, 0x36, 0x36, 0x35,
-    0x34, 0x26, 0x26, 0x23, 0x21, 0x04, 0x87, 0xfc, 0x92, 0x1d, 0x7b, 0x04, 0x03, 0x01, 0x93, 0x9f,
-    0xd6, 0x6e, 0x3e, 0x7a, 0xb4, 0x77, 0xfe, 0x1d, 0x7b, 0x01, 0x68, 0x80, 0x9e, 0x4a, 0x4a, 0x9e,
-    0x80, 0xfe, 0x6d, 0x03, 0x13, 0x6a, 0x6a, 0x02, 0x9d, 0xfa, 0x50, 0x05, 0xb0, 0xfd, 0x8d, 0x6a,
-    0xba, 0x78, 0x5a, 0x98, 0x70, 0x3f, 0x05, 0xb0, 0xfa, 0xbe, 0x57, 0x8d, 0x51, 0x4e, 0x8b, 0x57,
-    0x00, 0x03, 0x00, 0x36, 0x00, 0x00, 0x05, 0xc3, 0x05, 0xb0, 0x00, 0x15, 0x00, 0x19, 0x00, 0x1d,
-    0x00, 0x1d, 0x40, 0x0e, 0x19, 0x01, 0x18, 0x06, 0x11, 0x11, 0x18, 0x1c, 0x1d, 0x02, 0x72, 0x18,
-    0x08, 0x72, 0x00, 0x2b, 0x2b, 0x32, 0x11, 0x39, 0x2f, 0x33, 0x11, 0x33, 0x32, 0x30, 0x31, 0x61,
-    0x23, 0x11, 0x34, 0x26, 0x26, 0x23, 0x22, 0x0e, 0x02, 0x07, 0x35, 0x3e, 0x03, 0x33, 0x32, 0x16,
-    0x16, 0x15, 0x01, 0x11, 0x23, 0x11, 0x21, 0x15, 0x21, 0x35, 0x05, 0xc3, 0x7b, 0x52, 0xa2, 0x77,
-    0x3a, 0x6e, 0x6c, 0x6b, 0x35, 0x32, 0x65, 0x6b, 0x73, 0x3f, 0x9a, 0xd9, 0x73, 0xfc, 0xa6, 0x7c,
-    0x02, 0xab, 0xfb, 0x9e, 0x01, 0x9e, 0x7e, 0x96, 0x42, 0x09, 0x12, 0x1a, 0x10, 0x6a, 0x0f, 0x19,
-    0x13, 0x0a, 0x58, 0xc5, 0xa3, 0x04, 0x12, 0xfa, 0x50, 0x05, 0xb0, 0x6a, 0x6a, 0x00, 0x00, 0x02,
-    0x00, 0xba, 0xfe, 0x9e, 0x04, 0xe9, 0x05, 0xb0, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x17, 0x40, 0x0b,
-    0x09, 0x06, 0x01, 0x02, 0x72, 0x0b, 0x03, 0x03, 0x00, 0x08, 0x72, 0x00, 0x2b, 0x32, 0x12, 0x39,
-    0x2b, 0x32, 0x2f, 0x30, 0x31, 0x73, 0x11, 0x33, 0x11, 0x21, 0x11, 0x33, 0x11, 0x25, 0x11, 0x23,
-    0x11, 0xba, 0x7c, 0x03, 0x37, 0x7c, 0xfe, 0x2b, 0x7b, 0x05, 0xb0, 0xfa, 0xba, 0x05, 0x46, 0xfa,
-    0x50, 0x5f, 0xfe, 0x3f, 0x01, 0xc1, 0x00, 0x02, 0x00, 0xb2, 0x00, 0x00, 0x04, 0x78, 0x05, 0xb0,
-    0x00, 0x05, 0x00, 0x1e, 0x00, 0x21, 0x40, 0x10, 0x06, 0x1e, 0x1e, 0x04, 0x02, 0x13, 0x13, 0x05,
-    0x02, 0x72, 0x14, 0x11, 0x11, 0x04, 0x08, 0x72, 0x00, 0x2b, 0x32, 0x11, 0x33, 0x2b, 0x32, 0x11,
-    0x33, 0x11, 0x39, 0x2f, 0x33, 0x30, 0x31, 0x41, 0x15, 0x21, 0x11, 0x23, 0x11, 0x13, 0x21, 0x32,
-    0x16, 0x16, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x21, 0x11, 0x33, 0x11, 0x21, 0x32, 0x36, 0x36, 0x35,
-    0x34, 0x26, 0x26, 0x23, 0x21, 0x04, 0x20, 0xfd, 0x0d, 0x7b, 0x50, 0x01, 0x94, 0x9e, 0xd7, 0x6d,
-    0x3e, 0x7a, 0xb4, 0x76, 0xfe, 0x1c, 0x7c, 0x01, 0x68, 0x7f, 0x9e, 0x4a, 0x4a, 0x9e, 0x7f, 0xfe,
-    0x6c, 0x05, 0xb0, 0x6a, 0xfa, 0xba, 0x05, 0xb0, 0xfd, 0x8a, 0x68, 0xb9, 0x7a, 0x5c, 0x97, 0x70,
-    0x3c, 0x05, 0xb0, 0xfa, 0xba, 0x56, 0x8e, 0x53, 0x50, 0x8a, 0x55, 0x00, 0x00, 0x06, 0x00, 0x48,
-    0xfe, 0x9f, 0x05, 0x89, 0x05, 0xb0, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x13,
-    0x00, 0x25, 0x00, 0x27, 0x40, 0x13, 0x0b, 0x11, 0x11, 0x20, 0x03, 0x03, 0x07, 0x1e, 0x08, 0x72,
-    0x0e, 0x0f, 0x0f, 0x10, 0x14, 0x02, 0x72, 0x09, 0x05, 0x00, 0x2f, 0x33, 0x2b, 0x32, 0x32, 0x11,
-    0x33, 0x2b, 0x32, 0x32, 0x11, 0x33, 0x32, 0x11, 0x33, 0x30, 0x31, 0x65, 0x15, 0x21, 0x35, 0x33,
-    0x11, 0x23, 0x11, 0x21, 0x03, 0x23, 0x11, 0x03, 0x15, 0x21, 0x35, 0x21, 0x11, 0x23, 0x11, 0x21,
-    0x33, 0x03, 0x0e, 0x05, 0x07, 0x23, 0x35, 0x33, 0x3e, 0x02, 0x12, 0x37, 0x05, 0x20, 0xfb, 0x88,
-    0x1b, 0x7b, 0x05, 0x41, 0x01, 0x7b, 0x82, 0xfd, 0x6a, 0x02, 0xf9, 0x7b, 0xfd, 0x56, 0x7b, 0x19,
-    0x08, 0x29, 0x3b, 0x48, 0x4f, 0x4f, 0x24, 0x4b, 0x3f, 0x19, 0x4d, 0x53, 0x41, 0x0c, 0x6a, 0x6a,
-    0x6a, 0xfe, 0x35, 0x01, 0xcb, 0xfe, 0x35, 0x01, 0xcb, 0x05, 0x46, 0x6a, 0x6a, 0xfa, 0x50, 0x05,
-    0xb0, 0xfd, 0xf3, 0x8d, 0xf0, 0xc8, 0x9d, 0x71, 0x45, 0x0b, 0x6a, 0x18, 0x73, 0xc3, 0x01, 0x23,
-    0xc8, 0x00, 0x00, 0x05, 0x00, 0x17, 0x00, 0x00, 0x06, 0xf5, 0x05, 0xb0, 0x00, 0x05, 0x00, 0x09,
-    0x00, 0x0d, 0x00, 0x13, 0x00, 0x17, 0x00, 0x27, 0x40, 0x13, 0x16, 0x11, 0x09, 0x03, 0x03, 0x00,
-    0x00, 0x0f, 0x0f, 0x14, 0x0c, 0x08, 0x08, 0x72, 0x0e, 0x0a, 0x01, 0x02, 0x72, 0x00, 0x2b, 0x32,
-    0x32, 0x2b, 0x32, 0x32, 0x32, 0x2f, 0x33, 0x11, 0x33, 0x11, 0x33, 0x33, 0x33, 0x30, 0x31, 0x41,
-    0x01, 0x33, 0x01, 0x33, 0x07, 0x27, 0x01, 0x23, 0x01, 0x01, 0x11, 0x23, 0x11, 0x21, 0x01, 0x21,
-    0x27, 0x33, 0x01, 0x13, 0x01, 0x37, 0x01, 0x02, 0x5e, 0xfd, 0xde, 0x95, 0x01, 0xca, 0xed, 0x0d,
-    0xd2, 0xfe, 0x0a, 0x9c, 0x02, 0x44, 0x01, 0x6b, 0x7b, 0x03, 0x85, 0xfd, 0xde, 0xfe, 0xe7, 0x0b,
-    0xe8, 0x01, 0xca, 0x1d, 0xfe, 0x0b, 0x4e, 0x02, 0x43, 0x02, 0xb5, 0x02, 0xfb, 0xfd, 0x70, 0x6b,
-    0x09, 0xfd, 0x42, 0x03, 0x29, 0x02, 0x87, 0xfa, 0x50, 0x05, 0xb0, 0xfd, 0x05, 0x6b, 0x02, 0x90,
-    0xfa, 0x50, 0x02, 0xbe, 0x6b, 0xfc, 0xd7, 0x00, 0x00, 0x02, 0x00, 0x5a, 0xff, 0xec, 0x04, 0x65,
-    0x05, 0xc4, 0x00, 0x1e, 0x00, 0x3e, 0x00, 0x23, 0x40, 0x11, 0x00, 0x20, 0x02, 0x02, 0x3e, 0x3e,
-    0x15, 0x34, 0x30, 0x2a, 0x09, 0x72, 0x0f, 0x0b, 0x15, 0x03, 0x72, 0x00, 0x2b, 0x32, 0xcc, 0x2b,
-    0xcc, 0x33, 0x12, 0x39, 0x2f, 0x33, 0x12, 0x39, 0x39, 0x30, 0x31, 0x41, 0x23, 0x35, 0x33, 0x32,
-    0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x15, 0x23, 0x34, 0x3e, 0x02, 0x33,
-    0x32, 0x1e, 0x02, 0x15, 0x14, 0x0e, 0x02, 0x25, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x14, 0x0e, 0x02,
-    0x23, 0x22, 0x2e, 0x02, 0x35, 0x33, 0x14, 0x16, 0x16, 0x33, 0x32, 0x36, 0x36, 0x35, 0x34, 0x2e,
-    0x02, 0x23, 0x23, 0x02, 0x61, 0xb5, 0xaf, 0x86, 0xa6, 0x4c, 0x50, 0xa8, 0x84, 0x64, 0xa6, 0x62,
-    0x7c, 0x4e, 0x87, 0xb1, 0x62, 0x73, 0xb9, 0x85, 0x47, 0x43, 0x80, 0xb7, 0xfe, 0xd7, 0xb5, 0x7f,
-    0xc2, 0x81, 0x42, 0x4d, 0x8e, 0xc0, 0x73, 0x5c, 0xb5, 0x93, 0x59, 0x7c, 0x62, 0xad, 0x72, 0x81,
-    0xb3, 0x5f, 0x34, 0x65, 0x94, 0x62, 0xaf, 0x02, 0xc5, 0x58, 0x45, 0x7e, 0x55, 0x53, 0x85, 0x4e,
-    0x49, 0x86, 0x5a, 0x5d, 0x95, 0x69, 0x37, 0x33, 0x66, 0x96, 0x64, 0x4b, 0x84, 0x64, 0x39, 0x41,
-    0x32, 0x60, 0x8d, 0x5b, 0x63, 0x9b, 0x6b, 0x37, 0x32, 0x67, 0xa1, 0x6e, 0x5a, 0x91, 0x54, 0x4c,
-    0x8b, 0x5c, 0x4e, 0x71, 0x48, 0x22, 0x00, 0x01, 0x00, 0xbd, 0x00, 0x00, 0x04, 0xf1, 0x05, 0xb0,
-    0x00, 0x09, 0x00, 0x17, 0x40, 0x0b, 0x05, 0x00, 0x06, 0x02, 0x08, 0x02, 0x72, 0x04, 0x06, 0x08,
-    0x72, 0x00, 0x2b, 0x32, 0x2b, 0x32, 0x12, 0x39, 0x39, 0x30, 0x31, 0x65, 0x01, 0x33, 0x11, 0x23,
-    0x11, 0x01, 0x23, 0x11, 0x33, 0x01, 0x38, 0x03, 0x3d, 0x7c, 0x7c, 0xfc, 0xc3, 0x7b, 0x7b, 0xd7,
-    0x04, 0xd9, 0xfa, 0x50, 0x04, 0xdc, 0xfb, 0x24, 0x05, 0xb0, 0x00, 0x03, 0x00, 0x29, 0x00, 0x00,
-    0x04, 0xe4, 0x05, 0xb0, 0x00, 0x03, 0x00, 0x07, 0x00, 0x19, 0x00, 0x19, 0x40, 0x0c, 0x12, 0x05,
-    0x11, 0x08, 0x72, 0x02, 0x03, 0x03, 0x04, 0x08, 0x02, 0x72, 0x00, 0x2b, 0x32, 0x32, 0x11, 0x33,
-    0x2b, 0x32, 0x32, 0x30, 0x31, 0x41, 0x15, 0x21, 0x35, 0x21, 0x11, 0x23, 0x11, 0x21, 0x33, 0x03,
-    0x06, 0x02, 0x0e, 0x02, 0x23, 0x23, 0x35, 0x37, 0x3e, 0x04, 0x37, 0x04, 0x82, 0xfd, 0x37, 0x03,
-    0x2b, 0x7b, 0xfd, 0x24, 0x7b, 0x26, 0x09, 0x20, 0x36, 0x56, 0x80, 0x5a, 0x2a, 0x26, 0x3b, 0x56,
-    0x3d, 0x29, 0x1b, 0x09, 0x05, 0xb0, 0x6a, 0x6a, 0xfa, 0x50, 0x05, 0xb0, 0xfd, 0x5f, 0xa7, 0xff,
-    0x00, 0xb9, 0x76, 0x39, 0x6a, 0x01, 0x02, 0x2a, 0x5e, 0x9d, 0xeb, 0xa1, 0x00, 0x02, 0x00, 0x37,
-    0xff, 0xeb, 0x04, 0xcd, 0x05, 0xb0, 0x00, 0x13, 0x00, 0x18, 0x00, 0x1a, 0x40, 0x0e, 0x17, 0x16,
-    0x00, 0x15, 0x04, 0x08, 0x02, 0x18, 0x02, 0x72, 0x0f, 0x08, 0x09, 0x72, 0x00, 0x2b, 0x32, 0x2b,
-    0x32, 0x12, 0x17, 0x39, 0x30, 0x31, 0x41, 0x01, 0x33, 0x01, 0x0e, 0x03, 0x23, 0x22, 0x26, 0x27,
-    0x37, 0x16, 0x16, 0x33, 0x32, 0x36, 0x36, 0x37, 0x01, 0x01, 0x17, 0x07, 0x01, 0x02, 0x90, 0x01,
-    0xad, 0x90, 0xfd, 0xd3, 0x14, 0x35, 0x50, 0x75, 0x53, 0x16, 0x3c, 0x0c, 0x0b, 0x0c, 0x36, 0x11,
-    0x42, 0x56, 0x3b, 0x18, 0xfe, 0x9b, 0x01, 0xe9, 0x25, 0x69, 0xfd, 0xcd, 0x01, 0xea, 0x03, 0xc6,
-    0xfb, 0x4a, 0x2a, 0x5f, 0x52, 0x34, 0x06, 0x05, 0x66, 0x03, 0x04, 0x37, 0x59, 0x31, 0x04, 0x9a,
-    0xfc, 0x40, 0x6e, 0x15, 0x04, 0x43, 0x00, 0x03, 0x00, 0x4d, 0xff, 0xc4, 0x05, 0xaa, 0x05, 0xed,
-    0x00, 0x15, 0x00, 0x29, 0x00, 0x2d, 0x00, 0x1b, 0x40, 0x0c, 0x1f, 0x0c, 0x0c, 0x2b, 0x16, 0x00,
-    0x00, 0x2b, 0x2a, 0x03, 0x72, 0x2b, 0x00, 0x2f, 0x2b, 0x11, 0x39, 0x2f, 0x33, 0x11, 0x39, 0x2f,
-    0x33, 0x30, 0x31, 0x41, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x23, 0x22, 0x2e,
-    0x02, 0x35, 0x34, 0x3e, 0x02, 0x17, 0x22, 0x06, 0x06, 0x15, 0x14, 0x1e, 0x02, 0x33, 0x33, 0x32,
-    0x36, 0x36, 0x35, 0x34, 0x2e, 0x02, 0x23, 0x03, 0x11, 0x23, 0x11, 0x02, 0xa4, 0xae, 0x86, 0xdc,
-    0x9f, 0x57, 0x57, 0x9f, 0xdc, 0x86, 0xae, 0x86, 0xdb, 0xa0, 0x56, 0x56, 0xa0, 0xdb, 0x86, 0x98,
-    0xd6, 0x72, 0x40, 0x7c, 0xb2, 0x72, 0xb0, 0x97, 0xd6, 0x71, 0x40, 0x7b, 0xb2, 0x71, 0x1d, 0x78,
-    0x05, 0x1d, 0x57, 0x9c, 0xd2, 0x7c, 0x7c, 0xd3, 0x9d, 0x57, 0x57, 0x9c, 0xd2, 0x7c, 0x7c, 0xd2,
-    0x9d, 0x58, 0x67, 0x7b, 0xd7, 0x8a, 0x68, 0xae, 0x7e, 0x46, 0x7a, 0xd8, 0x8a, 0x67, 0xae, 0x7f,
-    0x46, 0x01, 0x37, 0xf9, 0xd7, 0x06, 0x29, 0x00, 0x00, 0x02, 0x00, 0xb4, 0xfe, 0xa1, 0x05, 0x72,
-    0x05, 0xb0, 0x00, 0x05, 0x00, 0x0d, 0x00, 0x19, 0x40, 0x0c, 0x0c, 0x07, 0x02, 0x72, 0x05, 0x04,
-    0x04, 0x09, 0x06, 0x08, 0x72, 0x01, 0x00, 0x2f, 0x2b, 0x32, 0x32, 0x11, 0x33, 0x2b, 0x32, 0x30,
-    0x31, 0x65, 0x03, 0x23, 0x11, 0x23, 0x35, 0x05, 0x11, 0x33, 0x11, 0x21, 0x11, 0x33, 0x11, 0x05,
-    0x72, 0x09, 0x72, 0x8f, 0xfc, 0x4c, 0x7c, 0x03, 0x37, 0x7c, 0x6c, 0xfe, 0x35, 0x01, 0x5f, 0x6c,
-    0x6c, 0x05, 0xb0, 0xfa, 0xba, 0x05, 0x46, 0xfa, 0x50, 0x00, 0x00, 0x02, 0x00, 0xad, 0x00, 0x00,
-    0x04, 0x9a, 0x05, 0xb0, 0x00, 0x15, 0x00, 0x19, 0x00, 0x17, 0x40, 0x0b, 0x17, 0x06, 0x11, 0x11,
-    0x18, 0x00, 0x02, 0x72, 0x18, 0x08, 0x72, 0x00, 0x2b, 0x2b, 0x11, 0x39, 0x2f, 0x33, 0x32, 0x30,
-    0x31, 0x53, 0x33, 0x11, 0x14, 0x16, 0x16, 0x33, 0x32, 0x3e, 0x02, 0x37, 0x15, 0x0e, 0x03, 0x23,
-    0x22, 0x26, 0x26, 0x35, 0x01, 0x33, 0x11, 0x23, 0xad, 0x7c, 0x52, 0xa2, 0x76, 0x3a, 0x6e, 0x6c,
-    0x6b, 0x35, 0x32, 0x65, 0x6b, 0x72, 0x40, 0x99, 0xda, 0x73, 0x03, 0x71, 0x7c, 0x7c, 0x05, 0xb0,
-    0xfe, 0x6d, 0x7e, 0x97, 0x42, 0x0a, 0x12, 0x1a, 0x10, 0x6a, 0x0f, 0x1a, 0x12, 0x0b, 0x59, 0xc5,
-    0xa3, 0x01, 0x93, 0xfa, 0x50, 0x00, 0x00, 0x01, 0x00, 0xb6, 0x00, 0x00, 0x06, 0xb3, 0x05, 0xb0,
-    0x00, 0x0b, 0x00, 0x19, 0x40, 0x0c, 0x05, 0x09, 0x06, 0x02, 0x02, 0x0b, 0x00, 0x02, 0x72, 0x0b,
-    0x08, 0x72, 0x00, 0x2b, 0x2b, 0x11, 0x33, 0x11, 0x33, 0x32, 0x32, 0x30, 0x31, 0x53, 0x33, 0x11,
-    0x21, 0x11, 0x33, 0x11, 0x21, 0x11, 0x33, 0x11, 0x21, 0xb6, 0x7d, 0x02, 0x45, 0x7c, 0x02, 0x44,
-    0x7b, 0xfa, 0x03, 0x05, 0xb0, 0xfa, 0xba, 0x05, 0x46, 0xfa, 0xba, 0x05, 0x46, 0xfa, 0x50, 0x00,
-    0x00, 0x02, 0x00, 0xb6, 0xfe, 0xa1, 0x07, 0x3d, 0x05, 0xb0, 0x00, 0x05, 0x00, 0x11, 0x00, 0x1d,
-    0x40, 0x0e, 0x0c, 0x05, 0x08, 0x08, 0x04, 0x11, 0x08, 0x72, 0x0f, 0x0b, 0x06, 0x02, 0x72, 0x01,
-    0x00, 0x2f, 0x2b, 0x32, 0x32, 0x2b, 0x32, 0x32, 0x11, 0x33, 0x33, 0x30, 0x31, 0x65, 0x03, 0x23,
-    0x11, 0x23, 0x35, 0x01, 0x33, 0x11, 0x21, 0x11, 0x33, 0x11, 0x21, 0x11, 0x33, 0x11, 0x21, 0x07,
-    0x3d, 0x09, 0x6e, 0x80, 0xfa, 0x70, 0x7d, 0x02, 0x45, 0x7c, 0x02, 0x44, 0x7b, 0xfa, 0x03, 0x67,
-    0xfe, 0x3a, 0x01, 0x5f, 0x67, 0x05, 0x49, 0xfa, 0xba, 0x05, 0x46, 0xfa, 0xba, 0x05, 0x46, 0xfa,
-    0x50, 0x00, 0x00, 0x02, 0xff, 0xf6, 0x00, 0x00, 0x05, 0xa5, 0x05, 0xb0, 0x00, 0x03, 0x00, 0x1c,
-    0x00, 0x1d, 0x40, 0x0e, 0x11, 0x12, 0x0f, 0x04, 0x1c, 0x1c, 0x0f, 0x00, 0x01, 0x02, 0x72, 0x0f,
-    0x08, 0x72, 0x00, 0x2b, 0x2b, 0x32, 0x11, 0x39, 0x2f, 0x33, 0x11, 0x33, 0x32, 0x30, 0x31, 0x43,
-    0x35, 0x21, 0x15, 0x13, 0x21, 0x32, 0x16, 0x16, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x21, 0x11, 0x33,
-    0x11, 0x21, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x21, 0x0a, 0x02, 0x11, 0x28, 0x01,
-    0x93, 0x9e, 0xd7, 0x6e, 0x3f, 0x7a, 0xb4, 0x76, 0xfe, 0x1d, 0x7b, 0x01, 0x68, 0x7f, 0x9e, 0x4a,
-    0x4a, 0x9e, 0x7f, 0xfe, 0x6d, 0x05, 0x49, 0x67, 0x67, 0xfd, 0xf1, 0x68, 0xb9, 0x7a, 0x5c, 0x97,
-    0x70, 0x3c, 0x05, 0xb0, 0xfa, 0xba, 0x56, 0x8e, 0x53, 0x50, 0x8a, 0x55, 0x00, 0x02, 0x00, 0xba,
-    0x00, 0x00, 0x05, 0xec, 0x05, 0xb0, 0x00, 0x18, 0x00, 0x1c, 0x00, 0x1d, 0x40, 0x0e, 0x1a, 0x19,
-    0x0e, 0x0b, 0x00, 0x18, 0x18, 0x0b, 0x0c, 0x02, 0x72, 0x0b, 0x08, 0x72, 0x00, 0x2b, 0x2b, 0x11,
-    0x39, 0x2f, 0x33, 0x11, 0x33, 0x32, 0x33, 0x30, 0x31, 0x41, 0x21, 0x32, 0x16, 0x16, 0x15, 0x14,
-    0x0e, 0x02, 0x23, 0x21, 0x11, 0x33, 0x11, 0x21, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23,
-    0x21, 0x01, 0x11, 0x23, 0x11, 0x01, 0x0a, 0x01, 0x93, 0x9e, 0xd7, 0x6e, 0x3e, 0x7a, 0xb4, 0x77,
-    0xfe, 0x1d, 0x7b, 0x01, 0x68, 0x80, 0x9e, 0x49, 0x49, 0x9e, 0x80, 0xfe, 0x6d, 0x04, 0xe2, 0x7b,
-    0x03, 0x3a, 0x68, 0xb9, 0x7a, 0x5c, 0x97, 0x70, 0x3c, 0x05, 0xb0, 0xfa, 0xba, 0x56, 0x8e, 0x53,
-    0x50, 0x8a, 0x55, 0x02, 0xe0, 0xfa, 0x50, 0x05, 0xb0, 0x00, 0x00, 0x01, 0x00, 0xb2, 0x00, 0x00,
-    0x04, 0x78, 0x05, 0xb0, 0x00, 0x18, 0x00, 0x19, 0x40, 0x0c, 0x0e, 0x0b, 0x00, 0x18, 0x18, 0x0b,
-    0x0c, 0x02, 0x72, 0x0b, 0x08, 0x72, 0x00, 0x2b, 0x2b, 0x11, 0x39, 0x2f, 0x33, 0x11, 0x33, 0x30,
-    0x31, 0x41, 0x21, 0x32, 0x16, 0x16, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x21, 0x11, 0x33, 0x11, 0x21,
-    0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x21, 0x01, 0x02, 0x01, 0x94, 0x9e, 0xd7, 0x6d,
-    0x3e, 0x7a, 0xb4, 0x76, 0xfe, 0x1c, 0x7c, 0x01, 0x68, 0x7f, 0x9e, 0x4a, 0x4a, 0x9e, 0x7f, 0xfe,
-    0x6c, 0x03, 0x3a, 0x68, 0xb9, 0x7a, 0x5c, 0x97, 0x70, 0x3c, 0x05, 0xb0, 0xfa, 0xba, 0x56, 0x8e,
-    0x53, 0x50, 0x8a, 0x55, 0x00, 0x02, 0x00, 0x8e, 0xff, 0xec, 0x04, 0xc9, 0x05, 0xc4, 0x00, 0x03,
-    0x00, 0x2c, 0x00, 0x1d, 0x40, 0x0e, 0x03, 0x02, 0x02, 0x1e, 0x09, 0x05, 0x29, 0x09, 0x72, 0x19,
-    0x15, 0x1e, 0x03, 0x72, 0x00, 0x2b, 0x32, 0xcc, 0x2b, 0xcc, 0x33, 0x12, 0x39, 0x2f, 0x33, 0x30,
-    0x31, 0x41, 0x15, 0x21, 0x35, 0x01, 0x33, 0x1e, 0x02, 0x33, 0x32, 0x3e, 0x02, 0x35, 0x35, 0x34,
-    0x2e, 0x03, 0x23, 0x22, 0x06, 0x06, 0x07, 0x23, 0x3e, 0x02, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x15,
-    0x14, 0x0e, 0x02, 0x23, 0x22, 0x26, 0x26, 0x04, 0x5d, 0xfd, 0x91, 0xfe, 0xa0, 0x7b, 0x0f, 0x61,
-    0xab, 0x81, 0x66, 0x9e, 0x6c, 0x39, 0x26, 0x49, 0x6a, 0x87, 0x51, 0x7d, 0xa9, 0x5f, 0x0f, 0x7b,
-    0x0f, 0x83, 0xe1, 0x9c, 0x7f, 0xcd, 0x92, 0x4e, 0x4e, 0x90, 0xca, 0x7c, 0xa0, 0xe5, 0x83, 0x03,
-    0x11, 0x6a, 0x6a, 0xfe, 0xb6, 0x7b, 0xa4, 0x52, 0x52, 0x94, 0xca, 0x77, 0xb7, 0x63, 0xaa, 0x87,
-    0x5f, 0x33, 0x57, 0xa4, 0x76, 0x96, 0xd4, 0x71, 0x5e, 0xae, 0xf2, 0x94, 0xb5, 0x93, 0xf2, 0xae,
-    0x5e, 0x73, 0xd4, 0x00, 0x00, 0x04, 0x00, 0xd2, 0xff, 0xec, 0x06, 0xc7, 0x05, 0xc4, 0x00, 0x03,
-    0x00, 0x07, 0x00, 0x1d, 0x00, 0x33, 0x00, 0x23, 0x40, 0x13, 0x2f, 0x07, 0x06, 0x06, 0x0e, 0x24,
-    0x19, 0x03, 0x02, 0x72, 0x02, 0x08, 0x72, 0x19, 0x03, 0x72, 0x0e, 0x09, 0x72, 0x00, 0x2b, 0x2b,
-    0x2b, 0x2b, 0x11, 0x33, 0x12, 0x39, 0x2f, 0x33, 0x32, 0x30, 0x31, 0x41, 0x11, 0x23, 0x11, 0x01,
-    0x15, 0x21, 0x35, 0x25, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x35, 0x34, 0x3e,
-    0x02, 0x33, 0x32, 0x1e, 0x02, 0x03, 0x35, 0x34, 0x2e, 0x02, 0x23, 0x22, 0x0e, 0x02, 0x15, 0x15,
-    0x14, 0x1e, 0x02, 0x33, 0x32, 0x3e, 0x02, 0x01, 0x4d, 0x7b, 0x01, 0xda, 0xfe, 0x97, 0x05, 0x84,
-    0x4f, 0x95, 0xd0, 0x82, 0x7f, 0xd1, 0x97, 0x51, 0x51, 0x96, 0xd0, 0x7f, 0x82, 0xd0, 0x96, 0x50,
-    0x7a, 0x3c, 0x73, 0xa5, 0x6a, 0x67, 0xa4, 0x73, 0x3d, 0x3d, 0x74, 0xa5, 0x67, 0x6a, 0xa5, 0x72,
-    0x3b, 0x05, 0xb0, 0xfa, 0x50, 0x05, 0xb0, 0xfd, 0x64, 0x67, 0x67, 0x12, 0x9b, 0x99, 0xf8, 0xb0,
-    0x5e, 0x5e, 0xb0, 0xf8, 0x99, 0x9b, 0x99, 0xf7, 0xb0, 0x5e, 0x5e, 0xb0, 0xf7, 0xfe, 0xcc, 0x9d,
-    0x81, 0xce, 0x92, 0x4e, 0x4e, 0x92, 0xce, 0x81, 0x9d, 0x82, 0xd0, 0x92, 0x4e, 0x4e, 0x92, 0xd0,
-    0x00, 0x02, 0x00, 0x5d, 0x00, 0x00, 0x04, 0x3f, 0x05, 0xb0, 0x00, 0x16, 0x00, 0x1a, 0x00, 0x1f,
-    0x40, 0x0f, 0x17, 0x16, 0x16, 0x00, 0x00, 0x09, 0x0c, 0x0c, 0x19, 0x08, 0x72, 0x0e, 0x09, 0x02,
-    0x72, 0x00, 0x2b, 0x32, 0x2b, 0x32, 0x11, 0x12, 0x39, 0x2f, 0x33, 0x12, 0x39, 0x30, 0x31, 0x41,
-    0x21, 0x27, 0x26, 0x26, 0x35, 0x34, 0x36, 0x36, 0x33, 0x21, 0x11, 0x23, 0x11, 0x21, 0x22, 0x06,
-    0x15, 0x14, 0x16, 0x16, 0x33, 0x21, 0x05, 0x01, 0x23, 0x01, 0x03, 0xee, 0xfe, 0x12, 0x39, 0x95,
-    0x9f, 0x78, 0xde, 0x98, 0x01, 0xbe, 0x7c, 0xfe, 0xbe, 0xb8, 0xbb, 0x4f, 0x96, 0x6c, 0x01, 0x90,
-    0xfe, 0x59, 0xfe, 0x9a, 0x85, 0x01, 0x6d, 0x02, 0x51, 0x1d, 0x2e, 0xcc, 0x92, 0x8d, 0xc3, 0x66,
-    0xfa, 0x50, 0x05, 0x46, 0xb1, 0x9a, 0x5d, 0x90, 0x52, 0x20, 0xfd, 0x64, 0x02, 0x9c, 0x00, 0x03,
-    0x00, 0x62, 0xff, 0xec, 0x04, 0x1f, 0x06, 0x11, 0x00, 0x16, 0x00, 0x2f, 0x00, 0x44, 0x00, 0x19,
-    0x40, 0x0c, 0x3a, 0x22, 0x30, 0x17, 0x17, 0x22, 0x00, 0x01, 0x72, 0x22, 0x0b, 0x72, 0x00, 0x2b,
-    0x2b, 0x11, 0x39, 0x2f, 0x33, 0x11, 0x33, 0x30, 0x31, 0x41, 0x33, 0x14, 0x0e, 0x02, 0x07, 0x0e,
-    0x03, 0x17, 0x15, 0x23, 0x35, 0x34, 0x12, 0x36, 0x36, 0x37, 0x3e, 0x02, 0x01, 0x32, 0x1e, 0x02,
-    0x15, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x35, 0x34, 0x36, 0x36, 0x37, 0x3e,
-    0x02, 0x17, 0x22, 0x06, 0x06, 0x15, 0x15, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x3e, 0x02, 0x35, 0x35,
-    0x34, 0x2e, 0x02, 0x03, 0x5b, 0x67, 0x34, 0x60, 0x81, 0x4d, 0x5d, 0x9a, 0x6e, 0x38, 0x06, 0x67,
-    0x45, 0x80, 0xb3, 0x6e, 0x65, 0x79, 0x35, 0xfe, 0xf6, 0x6a, 0xab, 0x79, 0x40, 0x42, 0x7e, 0xb0,
-    0x6e, 0x6d, 0xb1, 0x7e, 0x43, 0x0c, 0x14, 0x0b, 0x23, 0x7f, 0xb3, 0x5d, 0x75, 0x9f, 0x52, 0x2f,
-    0x5a, 0x87, 0x58, 0x58, 0x86, 0x5a, 0x2e, 0x2e, 0x5b, 0x87, 0x06, 0x11, 0x4b, 0x64, 0x3e, 0x23,
-    0x0c, 0x0e, 0x5e, 0xa3, 0xef, 0x9f, 0x5e, 0x5e, 0xb0, 0x01, 0x10, 0xc2, 0x74, 0x12, 0x10, 0x2e,
-    0x43, 0xfe, 0x12, 0x48, 0x82, 0xb2, 0x69, 0x20, 0x6f, 0xbc, 0x8b, 0x4c, 0x4c, 0x8b, 0xbc, 0x6f,
-    0x20, 0x1d, 0x38, 0x37, 0x1b, 0x5b, 0x8f, 0x54, 0x66, 0x6b, 0xaf, 0x65, 0x20, 0x52, 0x95, 0x72,
-    0x42, 0x42, 0x72, 0x95, 0x52, 0x20, 0x4c, 0x8a, 0x6b, 0x3e, 0x00, 0x02, 0x00, 0xaa, 0x00, 0x00,
-    0x04, 0x0c, 0x04, 0x3a, 0x00, 0x1b, 0x00, 0x33, 0x00, 0x2d, 0x40, 0x16, 0x02, 0x01, 0x1b, 0x2b,
-    0x29, 0x29, 0x28, 0x01, 0x28, 0x01, 0x28, 0x0f, 0x0d, 0x10, 0x06, 0x72, 0x1e, 0x1d, 0x1d, 0x0f,
-    0x0a, 0x72, 0x00, 0x2b, 0x32, 0x11, 0x33, 0x2b, 0x32, 0x11, 0x39, 0x39, 0x2f, 0x2f, 0x11, 0x33,
-    0x12, 0x39, 0x39, 0x11, 0x33, 0x30, 0x31, 0x41, 0x21, 0x27, 0x21, 0x32, 0x36, 0x36, 0x35, 0x34,
-    0x2e, 0x02, 0x23, 0x21, 0x11, 0x23, 0x11, 0x21, 0x32, 0x1e, 0x02, 0x15, 0x14, 0x0e, 0x02, 0x07,
-    0x03, 0x21, 0x37, 0x21, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x21, 0x37, 0x21, 0x17,
-    0x1e, 0x02, 0x15, 0x14, 0x0e, 0x02, 0x02, 0x7c, 0xfe, 0x84, 0x02, 0x01, 0x44, 0x61, 0x83, 0x43,
-    0x27, 0x4d, 0x73, 0x4b, 0xfe, 0xea, 0x77, 0x01, 0x8d, 0x62, 0x9e, 0x6f, 0x3b, 0x25, 0x49, 0x6a,
-    0x45, 0x48, 0xfe, 0x5e, 0x2e, 0x01, 0x74, 0x59, 0x7e, 0x41, 0x41, 0x7e, 0x59, 0xfe, 0xeb, 0x02,
-    0x01, 0x64, 0x32, 0x52, 0x79, 0x42, 0x39, 0x69, 0x93, 0x01, 0xf3, 0x65, 0x2b, 0x55, 0x3f, 0x30,
-    0x48, 0x2e, 0x17, 0xfc, 0x2c, 0x04, 0x3a, 0x23, 0x46, 0x6d, 0x4a, 0x32, 0x57, 0x45, 0x2b, 0x05,
-    0xfd, 0xe4, 0x66, 0x2f, 0x5a, 0x40, 0x3b, 0x58, 0x31, 0x65, 0x26, 0x08, 0x4a, 0x71, 0x42, 0x4b,
-    0x70, 0x4c, 0x26, 0x00, 0x00, 0x01, 0x00, 0xa4, 0x00, 0x00, 0x03, 0x3f, 0x04, 0x3a, 0x00, 0x05,
-    0x00, 0x0e, 0xb6, 0x02, 0x05, 0x06, 0x72, 0x04, 0x0a, 0x72, 0x00, 0x2b, 0x2b, 0x32, 0x30, 0x31,
-    0x41, 0x15, 0x21, 0x11, 0x23, 0x11, 0x03, 0x3f, 0xfd, 0xdc, 0x77, 0x04, 0x3a, 0x68, 0xfc, 0x2e,
-    0x04, 0x3a, 0x00, 0x03, 0x00, 0x35, 0xfe, 0xc2, 0x04, 0x4c, 0x04, 0x3a, 0x00, 0x0f, 0x00, 0x15,
-    0x00, 0x1d, 0x00, 0x21, 0x40, 0x10, 0x1d, 0x18, 0x09, 0x16, 0x16, 0x1b, 0x13, 0x08, 0x0a, 0x72,
-    0x15, 0x10, 0x10, 0x00, 0x06, 0x72, 0x00, 0x2b, 0x32, 0x11, 0x33, 0x2b, 0x32, 0x32, 0x32, 0x11,
-    0x33, 0x2f, 0x33, 0x30, 0x31, 0x41, 0x33, 0x03, 0x0e, 0x03, 0x07, 0x23, 0x37, 0x33, 0x3e, 0x03,
-    0x37, 0x13, 0x21, 0x11, 0x23, 0x11, 0x21, 0x01, 0x21, 0x11, 0x23, 0x11, 0x21, 0x11, 0x23, 0x01,
-    0x5d, 0x77, 0x12, 0x07, 0x36, 0x51, 0x5f, 0x30, 0x42, 0x02, 0x1f, 0x1c, 0x3f, 0x3a, 0x2a, 0x07,
-    0x3a, 0x02, 0x58, 0x78, 0xfe, 0x20, 0xfe, 0xb1, 0x04, 0x17, 0x77, 0xfc, 0xd3, 0x73, 0x04, 0x3a,
-    0xfe, 0x7a, 0x9c, 0xe5, 0xa1, 0x6d, 0x25, 0x67, 0x24, 0x58, 0x83, 0xc2, 0x8c, 0x01, 0x86, 0xfb,
-    0xc6, 0x03, 0xca, 0xfc, 0x9d, 0xfe, 0x5b, 0x01, 0x3e, 0xfe, 0xc2, 0x00, 0x00, 0x05, 0x00, 0x19,
-    0x00, 0x00, 0x06, 0x00, 0x04, 0x3a, 0x00, 0x05, 0x00, 0x09, 0x00, 0x0d, 0x00, 0x13, 0x00, 0x17,
-    0x00, 0x30, 0x40, 0x17, 0x15, 0x10, 0x10, 0x00, 0x16, 0x11, 0x11, 0x09, 0x03, 0x03, 0x06, 0x00,
-    0x00, 0x14, 0x07, 0x0c, 0x12, 0x13, 0x0d, 0x0d, 0x02, 0x06, 0x72, 0x00, 0x2b, 0x32, 0x11, 0x33,
-    0x3f, 0x33, 0x33, 0x39, 0x2f, 0x33, 0x33, 0x11, 0x33, 0x33, 0x11, 0x33, 0x11, 0x33, 0x11, 0x33,
-    0x30, 0x31, 0x41, 0x01, 0x33, 0x01, 0x33, 0x07, 0x27, 0x01, 0x23, 0x01, 0x01, 0x11, 0x23, 0x11,
-    0x21, 0x01, 0x23, 0x27, 0x33, 0x01, 0x13, 0x01, 0x37, 0x01, 0x02, 0x02, 0xfe, 0x49, 0x91, 0x01,
-    0x63, 0xc9, 0x0c, 0xb2, 0xfe, 0x67, 0x98, 0x01, 0xe6, 0x01, 0x48, 0x77, 0x02, 0xff, 0xfe, 0x48,
-    0xf9, 0x0d, 0xc9, 0x01, 0x63, 0x2b, 0xfe, 0x66, 0x4c, 0x01, 0xe6, 0x01, 0xf4, 0x02, 0x46, 0xfe,
-    0x26, 0x6c, 0x0c, 0xfe, 0x00, 0x02, 0x5c, 0x01, 0xde, 0xfb, 0xc6, 0x04, 0x3a, 0xfd, 0xba, 0x6c,
-    0x01, 0xda, 0xfb, 0xc6, 0x02, 0x00, 0x5c, 0xfd, 0xa4, 0x00, 0x00, 0x02, 0x00, 0x63, 0xff, 0xed,
-    0x03, 0xa3, 0x04, 0x4e, 0x00, 0x1d, 0x00, 0x3b, 0x00, 0x23, 0x40, 0x11, 0x00, 0x1f, 0x02, 0x02,
-    0x3b, 0x3b, 0x14, 0x32, 0x2e, 0x29, 0x0b, 0x72, 0x0f, 0x0b, 0x14, 0x07, 0x72, 0x00, 0x2b, 0x32,
-    0xcc, 0x2b, 0xcc, 0x33, 0x12, 0x39, 0x2f, 0x33, 0x12, 0x39, 0x39, 0x30, 0x31, 0x41, 0x23, 0x35,
-    0x33, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x15, 0x23, 0x34, 0x36,
-    0x36, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x14, 0x0e, 0x02, 0x25, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x14,
-    0x0e, 0x02, 0x23, 0x22, 0x26, 0x26, 0x35, 0x33, 0x14, 0x16, 0x16, 0x33, 0x32, 0x36, 0x36, 0x35,
-    0x34, 0x26, 0x26, 0x23, 0x23, 0x02, 0x13, 0xae, 0xa5, 0x63, 0x76, 0x34, 0x37, 0x78, 0x63, 0x4b,
-    0x80, 0x4e, 0x78, 0x70, 0xb7, 0x6a, 0x5c, 0x92, 0x66, 0x36, 0x32, 0x61, 0x8e, 0xfe, 0xf7, 0xae,
-    0x65, 0x95, 0x64, 0x32, 0x3c, 0x6e, 0x97, 0x5c, 0x64, 0xc1, 0x7e, 0x78, 0x4d, 0x87, 0x57, 0x60,
-    0x82, 0x42, 0x3f, 0x80, 0x61, 0xa5, 0x02, 0x0c, 0x52, 0x2f, 0x56, 0x39, 0x38, 0x5c, 0x38, 0x36,
-    0x5e, 0x3e, 0x60, 0x8c, 0x4c, 0x28, 0x4e, 0x73, 0x4a, 0x38, 0x62, 0x4b, 0x2a, 0x38, 0x25, 0x48,
-    0x69, 0x44, 0x4b, 0x75, 0x52, 0x2b, 0x46, 0x93, 0x71, 0x3f, 0x68, 0x3d, 0x36, 0x61, 0x3e, 0x48,
-    0x5a, 0x2a, 0x00, 0x01, 0x00, 0xa5, 0x00, 0x00, 0x03, 0xdc, 0x04, 0x3a, 0x00, 0x09, 0x00, 0x17,
-    0x40, 0x0b, 0x05, 0x00, 0x06, 0x02, 0x08, 0x06, 0x72, 0x04, 0x06, 0x0a, 0x72, 0x00, 0x2b, 0x32,
-    0x2b, 0x32, 0x12, 0x39, 0x39, 0x30, 0x31, 0x65, 0x01, 0x33, 0x11, 0x23, 0x11, 0x01, 0x23, 0x11,
-    0x33, 0x01, 0x1c, 0x02, 0x48, 0x78, 0x78, 0xfd, 0xb8, 0x77, 0x77, 0xc3, 0x03, 0x77, 0xfb, 0xc6,
-    0x03, 0x78, 0xfc, 0x88, 0x04, 0x3a, 0x00, 0x03, 0x00, 0xa4, 0x00, 0x00, 0x04, 0x16, 0x04, 0x3a,
-    0x00, 0x03, 0x00, 0x09, 0x00, 0x0d, 0x00, 0x1f, 0x40, 0x0f, 0x0c, 0x07, 0x07, 0x0b, 0x06, 0x06,
-    0x02, 0x09, 0x03, 0x06, 0x72, 0x0a, 0x02, 0x0a, 0x72, 0x00, 0x2b, 0x32, 0x2b, 0x32, 0x11, 0x39,
-    0x2f, 0x33, 0x33, 0x11, 0x33, 0x30, 0x31, 0x41, 0x11, 0x23, 0x11, 0x21, 0x01, 0x21, 0x27, 0x33,
-    0x01, 0x13, 0x01, 0x37, 0x01, 0x01, 0x1c, 0x78, 0x03, 0x41, 0xfe, 0x0f, 0xfe, 0xfe, 0x0c, 0xdb,
-    0x01, 0x8c, 0x2b, 0xfe, 0x3e, 0x4b, 0x02, 0x15, 0x04, 0x3a, 0xfb, 0xc6, 0x04, 0x3a, 0xfd, 0xb6,
-    0x6b, 0x01, 0xdf, 0xfb, 0xc6, 0x02, 0x00, 0x5c, 0xfd, 0xa4, 0x00, 0x03, 0x00, 0x2c, 0x00, 0x00,
-    0x03, 0xdd, 0x04, 0x3a, 0x00, 0x03, 0x00, 0x07, 0x00, 0x19, 0x00, 0x19, 0x40, 0x0c, 0x12, 0x05,
-    0x11, 0x0a, 0x72, 0x02, 0x03, 0x03, 0x04, 0x08, 0x06, 0x72, 0x00, 0x2b, 0x32, 0x32, 0x11, 0x33,
-    0x2b, 0x32, 0x32, 0x30, 0x31, 0x41, 0x15, 0x21, 0x35, 0x21, 0x11, 0x23, 0x11, 0x21, 0x33, 0x03,
-    0x0e, 0x04, 0x23, 0x23, 0x35, 0x37, 0x3e, 0x04, 0x37, 0x03, 0x7b, 0xfd, 0xdc, 0x02, 0x86, 0x78,
-    0xfd, 0xd2, 0x78, 0x18, 0x06, 0x1b, 0x2f, 0x47, 0x64, 0x43, 0x2d, 0x26, 0x2b, 0x40, 0x2f, 0x1f,
-    0x13, 0x05, 0x04, 0x3a, 0x68, 0x68, 0xfb, 0xc6, 0x04, 0x3a, 0xfe, 0x05, 0x7b, 0xbe, 0x87, 0x56,
-    0x29, 0x6c, 0x02, 0x01, 0x21, 0x45, 0x73, 0xa5, 0x70, 0x00, 0x00, 0x03, 0x00, 0xaa, 0x00, 0x00,
-    0x05, 0x36, 0x04, 0x3a, 0x00, 0x06, 0x00, 0x0a, 0x00, 0x0e, 0x00, 0x1b, 0x40, 0x0d, 0x00, 0x09,
-    0x0c, 0x06, 0x01, 0x0a, 0x06, 0x72, 0x0b, 0x03, 0x09, 0x0a, 0x72, 0x00, 0x2b, 0x32, 0x32, 0x2b,
-    0x32, 0x32, 0x32, 0x12, 0x39, 0x30, 0x31, 0x65, 0x01, 0x33, 0x01, 0x23, 0x01, 0x33, 0x23, 0x11,
-    0x23, 0x11, 0x01, 0x11, 0x33, 0x11, 0x02, 0xf3, 0x01, 0xae, 0x78, 0xfe, 0x05, 0x55, 0xfe, 0x07,
-    0x76, 0x25, 0x77, 0x04, 0x13, 0x79, 0xa4, 0x03, 0x96, 0xfb, 0xc6, 0x04, 0x3a, 0xfb, 0xc6, 0x04,
-    0x3a, 0xfb, 0xc6, 0x04, 0x3a, 0xfb, 0xc6, 0x00, 0x00, 0x03, 0x00, 0xa5, 0x00, 0x00, 0x03, 0xdc,
-    0x04, 0x3a, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x1b, 0x40, 0x0d, 0x09, 0x06, 0x08, 0x03,
-    0x02, 0x02, 0x06, 0x07, 0x06, 0x72, 0x06, 0x0a, 0x72, 0x00, 0x2b, 0x2b, 0x11, 0x39, 0x2f, 0x33,
-    0x32, 0x11, 0x33, 0x30, 0x31, 0x41, 0x15, 0x21, 0x35, 0x13, 0x11, 0x23, 0x11, 0x21, 0x11, 0x23,
-    0x11, 0x03, 0x7f, 0xfd, 0x7f, 0x1e, 0x77, 0x03, 0x37, 0x79, 0x02, 0x56, 0x66, 0x66, 0x01, 0xe4,
-    0xfb, 0xc6, 0x04, 0x3a, 0xfb, 0xc6, 0x04, 0x3a, 0x00, 0x03, 0x00, 0xa5, 0x00, 0x00, 0x03, 0xdc,
-    0x04, 0x3a, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x19, 0x40, 0x0c, 0x09, 0x06, 0x08, 0x02,
-    0x03, 0x03, 0x07, 0x06, 0x72, 0x06, 0x0a, 0x72, 0x00, 0x2b, 0x2b, 0x32, 0x11, 0x33, 0x32, 0x11,
-    0x33, 0x30, 0x31, 0x41, 0x15, 0x21, 0x35, 0x33, 0x11, 0x23, 0x11, 0x21, 0x11, 0x23, 0x11, 0x03,
-    0x7a, 0xfd, 0x88, 0x1a, 0x77, 0x03, 0x37, 0x78, 0x04, 0x3a, 0x68, 0x68, 0xfb, 0xc6, 0x04, 0x3a,
-    0xfb, 0xc6, 0x04, 0x3a, 0x00, 0x02, 0x00, 0x28, 0x00, 0x00, 0x03, 0xa6, 0x04, 0x3a, 0x00, 0x03,
-    0x00, 0x07, 0x00, 0x10, 0xb7, 0x03, 0x06, 0x07, 0x06, 0x72, 0x02, 0x0a, 0x72, 0x00, 0x2b, 0x2b,
-    0x32, 0x32, 0x30, 0x31, 0x41, 0x11, 0x23, 0x11, 0x21, 0x15, 0x21, 0x35, 0x02, 0x1c, 0x78, 0x02,
-    0x02, 0xfc, 0x82, 0x04, 0x3a, 0xfb, 0xc6, 0x04, 0x3a, 0x66, 0x66, 0x00, 0x00, 0x05, 0x00, 0x6f,
-    0xfe, 0x60, 0x05, 0x5e, 0x06, 0x00, 0x00, 0x16, 0x00, 0x2b, 0x00, 0x42, 0x00, 0x56, 0x00, 0x5a,
-    0x00, 0x27, 0x40, 0x15, 0x27, 0x06, 0x06, 0x49, 0x1e, 0x11, 0x11, 0x52, 0x33, 0x3e, 0x0b, 0x72,
-    0x33, 0x07, 0x72, 0x58, 0x00, 0x72, 0x57, 0x0e, 0x72, 0x00, 0x2b, 0x2b, 0x2b, 0x2b, 0x11, 0x33,
-    0x33, 0x11, 0x33, 0x32, 0x32, 0x11, 0x33, 0x30, 0x31, 0x41, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x22,
-    0x2e, 0x02, 0x27, 0x11, 0x3e, 0x03, 0x33, 0x32, 0x1e, 0x03, 0x07, 0x35, 0x34, 0x2e, 0x03, 0x23,
-    0x22, 0x06, 0x06, 0x07, 0x11, 0x1e, 0x02, 0x33, 0x32, 0x3e, 0x02, 0x25, 0x35, 0x34, 0x3e, 0x03,
-    0x33, 0x32, 0x1e, 0x02, 0x17, 0x11, 0x0e, 0x03, 0x23, 0x22, 0x2e, 0x02, 0x37, 0x15, 0x14, 0x1e,
-    0x02, 0x33, 0x32, 0x36, 0x36, 0x37, 0x11, 0x2e, 0x02, 0x23, 0x22, 0x0e, 0x02, 0x01, 0x11, 0x33,
-    0x11, 0x05, 0x5e, 0x33, 0x64, 0x90, 0x5e, 0x43, 0x68, 0x49, 0x2b, 0x08, 0x0a, 0x2c, 0x48, 0x64,
-    0x43, 0x4c, 0x7b, 0x5f, 0x40, 0x21, 0x78, 0x16, 0x2e, 0x47, 0x61, 0x3e, 0x45, 0x54, 0x2a, 0x09,
-    0x0b, 0x31, 0x54, 0x3e, 0x4d, 0x70, 0x48, 0x23, 0xfb, 0x89, 0x21, 0x41, 0x5e, 0x7c, 0x4b, 0x42,
-    0x63, 0x47, 0x2c, 0x0b, 0x08, 0x2c, 0x47, 0x66, 0x44, 0x5d, 0x91, 0x63, 0x34, 0x79, 0x22, 0x46,
-    0x6e, 0x4d, 0x3f, 0x53, 0x32, 0x0b, 0x09, 0x2b, 0x53, 0x46, 0x4d, 0x6f, 0x47, 0x22, 0x01, 0xbf,
-    0x78, 0x02, 0x14, 0x15, 0x77, 0xc3, 0x8d, 0x4d, 0x22, 0x3b, 0x4b, 0x29, 0x02, 0xb2, 0x30, 0x51,
-    0x3d, 0x22, 0x35, 0x63, 0x8c, 0xb0, 0x7b, 0x15, 0x4e, 0x8c, 0x75, 0x55, 0x2f, 0x22, 0x30, 0x14,
-    0xfd, 0x23, 0x0f, 0x26, 0x1d, 0x40, 0x74, 0x9d, 0x5c, 0x15, 0x66, 0xb0, 0x8c, 0x63, 0x35, 0x22,
-    0x3d, 0x51, 0x30, 0xfd, 0x57, 0x2b, 0x4e, 0x3e, 0x23, 0x4d, 0x8d, 0xc3, 0x8c, 0x15, 0x5c, 0x9d,
-    0x74, 0x40, 0x1f, 0x2b, 0x10, 0x02, 0xd5, 0x14, 0x30, 0x22, 0x48, 0x80, 0xa9, 0xfb, 0xea, 0x07,
-    0xa0, 0xf8, 0x60, 0x00, 0x00, 0x02, 0x00, 0xa5, 0xfe, 0xbf, 0x04, 0x4a, 0x04, 0x3a, 0x00, 0x07,
-    0x00, 0x0d, 0x00, 0x1b, 0x40, 0x0d, 0x06, 0x01, 0x03, 0x0d, 0x0c, 0x0c, 0x00, 0x0a, 0x72, 0x01,
-    0x06, 0x72, 0x09, 0x00, 0x2f, 0x2b, 0x2b, 0x32, 0x11, 0x33, 0x32, 0x11, 0x33, 0x30, 0x31, 0x73,
-    0x11, 0x33, 0x11, 0x21, 0x11, 0x33, 0x11, 0x37, 0x03, 0x23, 0x11, 0x23, 0x35, 0xa5, 0x77, 0x02,
-    0x48, 0x78, 0x6e, 0x09, 0x6e, 0x80, 0x04, 0x3a, 0xfc, 0x2d, 0x03, 0xd3, 0xfb, 0xc6, 0x67, 0xfe,
-    0x58, 0x01, 0x41, 0x67, 0x00, 0x02, 0x00, 0x6f, 0x00, 0x00, 0x03, 0x9e, 0x04, 0x3b, 0x00, 0x03,
-    0x00, 0x17, 0x00, 0x17, 0x40, 0x0b, 0x0f, 0x14, 0x09, 0x09, 0x01, 0x00, 0x06, 0x72, 0x01, 0x0a,
-    0x72, 0x00, 0x2b, 0x2b, 0x11, 0x39, 0x2f, 0x33, 0x32, 0x30, 0x31, 0x41, 0x11, 0x23, 0x11, 0x13,
-    0x15, 0x0e, 0x02, 0x23, 0x22, 0x26, 0x26, 0x35, 0x11, 0x33, 0x11, 0x14, 0x16, 0x16, 0x33, 0x3e,
-    0x02, 0x03, 0x9e, 0x77, 0x4e, 0x2e, 0x76, 0x83, 0x42, 0x86, 0xb9, 0x5e, 0x77, 0x40, 0x83, 0x63,
-    0x46, 0x87, 0x75, 0x04, 0x3a, 0xfb, 0xc6, 0x04, 0x3a, 0xfe, 0x15, 0x67, 0x16, 0x28, 0x19, 0x4e,
-    0xb3, 0x96, 0x01, 0x13, 0xfe, 0xed, 0x73, 0x84, 0x38, 0x01, 0x1a, 0x26, 0x00, 0x01, 0x00, 0xa5,
-    0x00, 0x00, 0x05, 0xca, 0x04, 0x3a, 0x00, 0x0b, 0x00, 0x19, 0x40, 0x0c, 0x05, 0x09, 0x06, 0x02,
-    0x02, 0x0b, 0x00, 0x06, 0x72, 0x0b, 0x0a, 0x72, 0x00, 0x2b, 0x2b, 0x11, 0x33, 0x11, 0x33, 0x32,
-    0x32, 0x30, 0x31, 0x53, 0x33, 0x11, 0x21, 0x11, 0x33, 0x11, 0x21, 0x11, 0x33, 0x11, 0x21, 0xa5,
-    0x77, 0x01, 0xe2, 0x78, 0x01, 0xdd, 0x77, 0xfa, 0xdb, 0x04, 0x3a, 0xfc, 0x2d, 0x03, 0xd3, 0xfc,
-    0x2d, 0x03, 0xd3, 0xfb, 0xc6, 0x00, 0x00, 0x02, 0x00, 0x9f, 0xfe, 0xbf, 0x06, 0x47, 0x04, 0x3a,
-    0x00, 0x05, 0x00, 0x11, 0x00, 0x1d, 0x40, 0x0e, 0x0c, 0x05, 0x08, 0x08, 0x04, 0x11, 0x0a, 0x72,
-    0x0f, 0x0b, 0x06, 0x06, 0x72, 0x01, 0x00, 0x2f, 0x2b, 0x32, 0x32, 0x2b, 0x32, 0x32, 0x11, 0x33,
-    0x33, 0x30, 0x31, 0x65, 0x03, 0x23, 0x11, 0x23, 0x35, 0x01, 0x33, 0x11, 0x21, 0x11, 0x33, 0x11,
-    0x21, 0x11, 0x33, 0x11, 0x21, 0x06, 0x47, 0x09, 0x6e, 0x80, 0xfb, 0x4f, 0x78, 0x01, 0xe1, 0x79,
-    0x01, 0xdc, 0x78, 0xfa, 0xda, 0x67, 0xfe, 0x58, 0x01, 0x41, 0x67, 0x03, 0xd3, 0xfc, 0x2d, 0x03,
-    0xd3, 0xfc, 0x2d, 0x03, 0xd3, 0xfb, 0xc6, 0x00, 0x00, 0x02, 0x00, 0x23, 0x00, 0x00, 0x04, 0xb6,
-    0x04, 0x3a, 0x00, 0x03, 0x00, 0x1c, 0x00, 0x1d, 0x40, 0x0e, 0x11, 0x12, 0x0f, 0x1c, 0x04, 0x04,
-    0x0f, 0x02, 0x03, 0x06, 0x72, 0x0f, 0x0a, 0x72, 0x00, 0x2b, 0x2b, 0x32, 0x11, 0x39, 0x2f, 0x33,
-    0x11, 0x33, 0x32, 0x30, 0x31, 0x41, 0x15, 0x21, 0x35, 0x01, 0x21, 0x32, 0x16, 0x16, 0x15, 0x14,
-    0x0e, 0x02, 0x23, 0x21, 0x11, 0x33, 0x11, 0x21, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23,
-    0x21, 0x01, 0xda, 0xfe, 0x49, 0x01, 0xa7, 0x01, 0x60, 0x80, 0xb1, 0x5b, 0x33, 0x65, 0x94, 0x60,
-    0xfe, 0x52, 0x78, 0x01, 0x36, 0x63, 0x79, 0x37, 0x37, 0x79, 0x63, 0xfe, 0xa0, 0x04, 0x3a, 0x67,
-    0x67, 0xfe, 0x78, 0x59, 0x9b, 0x63, 0x4a, 0x7e, 0x5e, 0x35, 0x04, 0x3a, 0xfc, 0x2d, 0x45, 0x6f,
-    0x3e, 0x3c, 0x6f, 0x47, 0x00, 0x02, 0x00, 0xaa, 0x00, 0x00, 0x05, 0x51, 0x04, 0x3a, 0x00, 0x18,
-    0x00, 0x1c, 0x00, 0x1d, 0x40, 0x0e, 0x1a, 0x19, 0x0e, 0x0b, 0x18, 0x00, 0x00, 0x0b, 0x0c, 0x06,
-    0x72, 0x0b, 0x0a, 0x72, 0x00, 0x2b, 0x2b, 0x11, 0x39, 0x2f, 0x33, 0x11, 0x33, 0x32, 0x33, 0x30,
-    0x31, 0x53, 0x21, 0x32, 0x16, 0x16, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x21, 0x11, 0x33, 0x11, 0x21,
-    0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x21, 0x01, 0x11, 0x23, 0x11, 0xf7, 0x01, 0x60,
-    0x80, 0xb1, 0x5b, 0x33, 0x65, 0x94, 0x60, 0xfe, 0x53, 0x77, 0x01, 0x36, 0x63, 0x7a, 0x37, 0x37,
-    0x7a, 0x63, 0xfe, 0xa0, 0x04, 0x5a, 0x77, 0x02, 0xb2, 0x59, 0x9b, 0x63, 0x4a, 0x7e, 0x5e, 0x35,
-    0x04, 0x3a, 0xfc, 0x2d, 0x45, 0x6f, 0x3e, 0x3c, 0x6f, 0x47, 0x01, 0xef, 0xfb, 0xc6, 0x04, 0x3a,
-    0x00, 0x01, 0x00, 0xaa, 0x00, 0x00, 0x03, 0xe3, 0x04, 0x3a, 0x00, 0x18, 0x00, 0x19, 0x40, 0x0c,
-    0x0e, 0x0b, 0x18, 0x00, 0x00, 0x0b, 0x0c, 0x06, 0x72, 0x0b, 0x0a, 0x72, 0x00, 0x2b, 0x2b, 0x11,
-    0x39, 0x2f, 0x33, 0x11, 0x33, 0x30, 0x31, 0x53, 0x21, 0x32, 0x16, 0x16, 0x15, 0x14, 0x0e, 0x02,
-    0x23, 0x21, 0x11, 0x33, 0x11, 0x21, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x21, 0xf7,
-    0x01, 0x60, 0x80, 0xb1, 0x5b, 0x33, 0x65, 0x94, 0x60, 0xfe, 0x53, 0x77, 0x01, 0x36, 0x63, 0x7a,
-    0x37, 0x37, 0x7a, 0x63, 0xfe, 0xa0, 0x02, 0xb2, 0x59, 0x9b, 0x63, 0x4a, 0x7e, 0x5e, 0x35, 0x04,
-    0x3a, 0xfc, 0x2d, 0x45, 0x6f, 0x3e, 0x3c, 0x6f, 0x47, 0x00, 0x00, 0x02, 0x00, 0x6f, 0xff, 0xec,
-    0x03, 0xd4, 0x04, 0x4e, 0x00, 0x27, 0x00, 0x2b, 0x00, 0x1d, 0x40, 0x0e, 0x2b, 0x2a, 0x2a, 0x09,
-    0x1d, 0x19, 0x14, 0x0b, 0x72, 0x04, 0x00, 0x09, 0x07, 0x72, 0x00, 0x2b, 0x32, 0xcc, 0x2b, 0xcc,
-    0x33, 0x12, 0x39, 0x2f, 0x33, 0x30, 0x31, 0x41, 0x22, 0x06, 0x06, 0x15, 0x23, 0x34, 0x36, 0x36,
-    0x33, 0x32, 0x1e, 0x02, 0x15, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x26, 0x26, 0x35, 0x33, 0x14,
-    0x16, 0x16, 0x33, 0x32, 0x3e, 0x02, 0x35, 0x35, 0x34, 0x2e, 0x02, 0x01, 0x15, 0x21, 0x35, 0x02,
-    0x05, 0x46, 0x85, 0x56, 0x75, 0x75, 0xba, 0x67, 0x6e, 0xac, 0x77, 0x3e, 0x3f, 0x77, 0xaa, 0x6d,
-    0x71, 0xb9, 0x6e, 0x75, 0x50, 0x84, 0x4f, 0x57, 0x81, 0x54, 0x29, 0x29, 0x54, 0x81, 0x01, 0x34,
-    0xfd, 0xe0, 0x03, 0xe7, 0x38, 0x71, 0x56, 0x6a, 0xa1, 0x5b, 0x52, 0x93, 0xc5, 0x72, 0x2a, 0x72,
-    0xc4, 0x94, 0x52, 0x5e, 0xad, 0x78, 0x5a, 0x7f, 0x43, 0x47, 0x7b, 0x9e, 0x55, 0x2a, 0x57, 0x9d,
-    0x7a, 0x47, 0xfe, 0x70, 0x67, 0x67, 0x00, 0x04, 0x00, 0xaa, 0xff, 0xec, 0x06, 0x1a, 0x04, 0x4e,
-    0x00, 0x03, 0x00, 0x07, 0x00, 0x1d, 0x00, 0x33, 0x00, 0x23, 0x40, 0x13, 0x24, 0x03, 0x02, 0x02,
-    0x19, 0x2f, 0x0e, 0x07, 0x06, 0x72, 0x06, 0x0a, 0x72, 0x0e, 0x07, 0x72, 0x19, 0x0b, 0x72, 0x00,
-    0x2b, 0x2b, 0x2b, 0x2b, 0x11, 0x33, 0x12, 0x39, 0x2f, 0x33, 0x32, 0x30, 0x31, 0x41, 0x15, 0x21,
-    0x35, 0x13, 0x11, 0x23, 0x11, 0x01, 0x35, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x15,
-    0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x37, 0x15, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x3e, 0x02,
-    0x35, 0x35, 0x34, 0x2e, 0x02, 0x23, 0x22, 0x0e, 0x02, 0x02, 0xb5, 0xfe, 0x05, 0x67, 0x77, 0x01,
-    0xaa, 0x45, 0x7f, 0xb1, 0x6d, 0x6f, 0xb2, 0x7f, 0x44, 0x44, 0x7e, 0xb2, 0x6e, 0x6e, 0xb2, 0x7f,
-    0x45, 0x78, 0x30, 0x5c, 0x88, 0x58, 0x58, 0x87, 0x5c, 0x30, 0x30, 0x5d, 0x88, 0x58, 0x57, 0x87,
-    0x5d, 0x2f, 0x02, 0x4e, 0x66, 0x66, 0x01, 0xec, 0xfb, 0xc6, 0x04, 0x3a, 0xfd, 0xd3, 0x20, 0x76,
-    0xc8, 0x92, 0x51, 0x51, 0x92, 0xc8, 0x76, 0x20, 0x76, 0xc7, 0x93, 0x51, 0x51, 0x93, 0xc7, 0x96,
-    0x20, 0x59, 0x9f, 0x7b, 0x47, 0x47, 0x7b, 0x9f, 0x59, 0x20, 0x58, 0x9e, 0x7c, 0x48, 0x48, 0x7c,
-    0x9e, 0x00, 0x00, 0x02, 0x00, 0x5d, 0x00, 0x00, 0x03, 0xb2, 0x04, 0x3a, 0x00, 0x03, 0x00, 0x1d,
-    0x00, 0x1d, 0x40, 0x0e, 0x01, 0x12, 0x12, 0x13, 0x13, 0x03, 0x09, 0x04, 0x06, 0x72, 0x07, 0x03,
-    0x0a, 0x72, 0x00, 0x2b, 0x32, 0x2b, 0x32, 0x12, 0x39, 0x2f, 0x33, 0x12, 0x39, 0x30, 0x31, 0x41,
-    0x33, 0x01, 0x23, 0x01, 0x21, 0x11, 0x23, 0x11, 0x21, 0x22, 0x06, 0x06, 0x15, 0x14, 0x16, 0x16,
-    0x33, 0x21, 0x15, 0x21, 0x22, 0x2e, 0x02, 0x35, 0x34, 0x3e, 0x02, 0x01, 0x89, 0x84, 0xfe, 0xd4,
-    0x84, 0x01, 0xab, 0x01, 0xaa, 0x78, 0xfe, 0xce, 0x5f, 0x77, 0x36, 0x30, 0x69, 0x53, 0x01, 0x7d,
-    0xfe, 0x83, 0x56, 0x84, 0x5b, 0x2f, 0x33, 0x63, 0x91, 0x01, 0xf0, 0xfe, 0x10, 0x04, 0x3a, 0xfb,
-    0xc6, 0x03, 0xd4, 0x3f, 0x66, 0x3a, 0x37, 0x63, 0x40, 0x67, 0x30, 0x57, 0x77, 0x45, 0x46, 0x75,
-    0x58, 0x30, 0x00, 0x04, 0xff, 0xe5, 0xfe, 0x4b, 0x03, 0xcd, 0x06, 0x00, 0x00, 0x11, 0x00, 0x15,
-    0x00, 0x2c, 0x00, 0x30, 0x00, 0x1d, 0x40, 0x10, 0x30, 0x2f, 0x28, 0x1c, 0x07, 0x72, 0x15, 0x00,
-    0x72, 0x14, 0x0a, 0x72, 0x0d, 0x06, 0x0f, 0x72, 0x00, 0x2b, 0x32, 0x2b, 0x2b, 0x2b, 0x32, 0xcc,
-    0x32, 0x30, 0x31, 0x41, 0x33, 0x11, 0x14, 0x06, 0x06, 0x23, 0x22, 0x26, 0x27, 0x37, 0x16, 0x16,
-    0x33, 0x32, 0x36, 0x36, 0x35, 0x01, 0x11, 0x23, 0x11, 0x13, 0x27, 0x3e, 0x03, 0x33, 0x32, 0x1e,
-    0x02, 0x15, 0x11, 0x23, 0x11, 0x34, 0x26, 0x26, 0x23, 0x22, 0x0e, 0x02, 0x01, 0x15, 0x21, 0x35,
-    0x03, 0x55, 0x78, 0x48, 0x88, 0x60, 0x21, 0x3a, 0x20, 0x0e, 0x10, 0x45, 0x18, 0x3b, 0x52, 0x2b,
-    0xfd, 0xbf, 0x77, 0x5d, 0x35, 0x05, 0x42, 0x71, 0x9a, 0x5d, 0x51, 0x80, 0x59, 0x2f, 0x78, 0x3e,
-    0x72, 0x4e, 0x56, 0x81, 0x57, 0x2e, 0x01, 0x4e, 0xfd, 0x9c, 0x01, 0xb2, 0xfd, 0xf5, 0x70, 0x9c,
-    0x50, 0x09, 0x0a, 0x64, 0x06, 0x0a, 0x3a, 0x6e, 0x4d, 0x06, 0x59, 0xfa, 0x00, 0x06, 0x00, 0xfc,
-    0x60, 0x1e, 0x60, 0xa8, 0x80, 0x48, 0x2c, 0x5f, 0x97, 0x6b, 0xfd, 0x3f, 0x02, 0xc2, 0x6f, 0x7f,
-    0x36, 0x4b, 0x77, 0x87, 0x02, 0x9d, 0x67, 0x67, 0x00, 0x02, 0x00, 0x6c, 0xff, 0xec, 0x03, 0xd9,
-    0x04, 0x4e, 0x00, 0x03, 0x00, 0x2b, 0x00, 0x1b, 0x40, 0x0d, 0x04, 0x0d, 0x03, 0x02, 0x02, 0x0d,
-    0x21, 0x18, 0x07, 0x72, 0x0d, 0x0b, 0x72, 0x00, 0x2b, 0x2b, 0x32, 0x11, 0x39, 0x2f, 0x33, 0x11,
-    0x33, 0x30, 0x31, 0x41, 0x15, 0x21, 0x35, 0x01, 0x32, 0x36, 0x36, 0x37, 0x33, 0x0e, 0x02, 0x23,
-    0x22, 0x2e, 0x02, 0x35, 0x35, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x16, 0x16, 0x17, 0x23, 0x2e, 0x02,
-    0x23, 0x22, 0x0e, 0x02, 0x15, 0x15, 0x14, 0x1e, 0x02, 0x02, 0xd1, 0xfd, 0xc4, 0x01, 0xa5, 0x4b,
-    0x85, 0x57, 0x06, 0x72, 0x05, 0x73, 0xb9, 0x6e, 0x72, 0xad, 0x74, 0x3b, 0x3b, 0x74, 0xac, 0x71,
-    0x74, 0xb9, 0x6f, 0x05, 0x72, 0x05, 0x52, 0x86, 0x52, 0x5c, 0x82, 0x51, 0x26, 0x26, 0x51, 0x83,
-    0x02, 0x51, 0x67, 0x67, 0xfe, 0x02, 0x3a, 0x70, 0x52, 0x67, 0xa0, 0x5c, 0x53, 0x93, 0xc4, 0x72,
-    0x2a, 0x72, 0xc5, 0x93, 0x52, 0x5e, 0xac, 0x76, 0x57, 0x7e, 0x44, 0x47, 0x7b, 0x9d, 0x56, 0x2a,
-    0x56, 0x9d, 0x7b, 0x47, 0x00, 0x03, 0x00, 0x25, 0x00, 0x00, 0x06, 0x8c, 0x04, 0x3a, 0x00, 0x11,
-    0x00, 0x15, 0x00, 0x2e, 0x00, 0x25, 0x40, 0x12, 0x16, 0x2e, 0x2e, 0x00, 0x24, 0x21, 0x21, 0x0a,
-    0x09, 0x0a, 0x72, 0x14, 0x15, 0x15, 0x23, 0x00, 0x06, 0x72, 0x00, 0x2b, 0x32, 0x32, 0x11, 0x33,
-    0x2b, 0x32, 0x32, 0x11, 0x33, 0x11, 0x39, 0x2f, 0x33, 0x30, 0x31, 0x41, 0x33, 0x03, 0x0e, 0x04,
-    0x23, 0x23, 0x35, 0x37, 0x3e, 0x04, 0x37, 0x01, 0x15, 0x21, 0x35, 0x01, 0x21, 0x32, 0x16, 0x16,
-    0x15, 0x14, 0x0e, 0x02, 0x23, 0x21, 0x11, 0x33, 0x11, 0x21, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26,
-    0x26, 0x23, 0x21, 0x01, 0x30, 0x77, 0x18, 0x06, 0x1a, 0x2f, 0x47, 0x64, 0x43, 0x2d, 0x26, 0x2a,
-    0x41, 0x2e, 0x20, 0x13, 0x05, 0x02, 0x4d, 0xfd, 0xe4, 0x02, 0x53, 0x01, 0x61, 0x80, 0xb1, 0x5a,
-    0x33, 0x65, 0x93, 0x60, 0xfe, 0x52, 0x78, 0x01, 0x36, 0x63, 0x79, 0x37, 0x37, 0x79, 0x63, 0xfe,
-    0x9f, 0x04, 0x3a, 0xfe, 0x05, 0x7b, 0xbe, 0x87, 0x56, 0x29, 0x6c, 0x02, 0x01, 0x21, 0x45, 0x73,
-    0xa5, 0x70, 0x01, 0xdd, 0x68, 0x68, 0xfe, 0x50, 0x54, 0x92, 0x5d, 0x45, 0x77, 0x59, 0x32, 0x04,
-    0x3a, 0xfc, 0x2c, 0x42, 0x68, 0x39, 0x37, 0x64, 0x40, 0x00, 0x00, 0x03, 0x00, 0xa5, 0x00, 0x00,
-    0x06, 0x9d, 0x04, 0x3a, 0x00, 0x03, 0x00, 0x07, 0x00, 0x20, 0x00, 0x25, 0x40, 0x12, 0x15, 0x16,
-    0x13, 0x13, 0x06, 0x08, 0x03, 0x20, 0x03, 0x02, 0x02, 0x06, 0x07, 0x06, 0x72, 0x06, 0x0a, 0x72,
-    0x00, 0x2b, 0x2b, 0x11, 0x39, 0x2f, 0x33, 0x33, 0x11, 0x33, 0x11, 0x33, 0x11, 0x33, 0x32, 0x30,
-    0x31, 0x41, 0x15, 0x21, 0x35, 0x13, 0x11, 0x23, 0x11, 0x01, 0x21, 0x32, 0x16, 0x16, 0x15, 0x14,
-    0x0e, 0x02, 0x23, 0x21, 0x11, 0x33, 0x11, 0x21, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23,
-    0x21, 0x03, 0x7f, 0xfd, 0x7f, 0x1e, 0x77, 0x03, 0x0c, 0x01, 0x61, 0x80, 0xb0, 0x5b, 0x33, 0x65,
-    0x93, 0x60, 0xfe, 0x51, 0x79, 0x01, 0x36, 0x63, 0x79, 0x37, 0x37, 0x79, 0x63, 0xfe, 0x9f, 0x02,
-    0x8d, 0x66, 0x66, 0x01, 0xad, 0xfb, 0xc6, 0x04, 0x3a, 0xfe, 0x50, 0x54, 0x92, 0x5d, 0x45, 0x77,
-    0x59, 0x32, 0x04, 0x3a, 0xfc, 0x2c, 0x42, 0x68, 0x39, 0x37, 0x64, 0x40, 0x00, 0x03, 0xff, 0xf0,
-    0x00, 0x00, 0x03, 0xcd, 0x06, 0x00, 0x00, 0x03, 0x00, 0x1a, 0x00, 0x1e, 0x00, 0x19, 0x40, 0x0d,
-    0x1e, 0x1d, 0x16, 0x0a, 0x07, 0x72, 0x03, 0x00, 0x72, 0x11, 0x02, 0x0a, 0x72, 0x00, 0x2b, 0x32,
-    0x2b, 0x2b, 0x32, 0xcc, 0x32, 0x30, 0x31, 0x41, 0x11, 0x23, 0x11, 0x13, 0x27, 0x3e, 0x03, 0x33,
-    0x32, 0x1e, 0x02, 0x15, 0x11, 0x23, 0x11, 0x34, 0x26, 0x26, 0x23, 0x22, 0x0e, 0x02, 0x01, 0x15,
-    0x21, 0x35, 0x01, 0x14, 0x77, 0x5d, 0x35, 0x05, 0x42, 0x71, 0x9a, 0x5d, 0x51, 0x80, 0x59, 0x2f,
-    0x78, 0x3e, 0x72, 0x4e, 0x56, 0x81, 0x57, 0x2e, 0x01, 0x59, 0xfd, 0x9c, 0x06, 0x00, 0xfa, 0x00,
-    0x06, 0x00, 0xfc, 0x60, 0x1e, 0x60, 0xa8, 0x80, 0x48, 0x2c, 0x5f, 0x97, 0x6b, 0xfd, 0x3f, 0x02,
-    0xc2, 0x6f, 0x7f, 0x36, 0x4b, 0x77, 0x87, 0x02, 0xa9, 0x67, 0x67, 0x00, 0x00, 0x02, 0x00, 0xa5,
-    0xfe, 0x9f, 0x03, 0xdc, 0x04, 0x3a, 0x00, 0x03, 0x00, 0x0b, 0x00, 0x17, 0x40, 0x0b, 0x00, 0x06,
-    0x06, 0x0b, 0x0a, 0x72, 0x09, 0x04, 0x06, 0x72, 0x02, 0x00, 0x2f, 0x2b, 0x32, 0x2b, 0x32, 0x12,
-    0x39, 0x30, 0x31, 0x65, 0x33, 0x11, 0x23, 0x01, 0x33, 0x11, 0x21, 0x11, 0x33, 0x11, 0x21, 0x02,
-    0x08, 0x78, 0x78, 0xfe, 0x9d, 0x77, 0x02, 0x48, 0x78, 0xfc, 0xc9, 0x67, 0xfe, 0x38, 0x05, 0x9b,
-    0xfc, 0x2d, 0x03, 0xd3, 0xfb, 0xc6, 0x00, 0x02, 0x00, 0xab, 0xff, 0xec, 0x06, 0x70, 0x05, 0xb0,
-    0x00, 0x18, 0x00, 0x30, 0x00, 0x1b, 0x40, 0x0e, 0x2c, 0x1f, 0x09, 0x72, 0x14, 0x07, 0x09, 0x72,
-    0x26, 0x1a, 0x0e, 0x00, 0x02, 0x72, 0x00, 0x2b, 0x32, 0x32, 0x32, 0x2b, 0x32, 0x2b, 0x32, 0x30,
-    0x31, 0x41, 0x33, 0x11, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x11, 0x33, 0x11, 0x14,
-    0x1e, 0x02, 0x33, 0x32, 0x36, 0x36, 0x35, 0x01, 0x33, 0x11, 0x14, 0x06, 0x06, 0x23, 0x22, 0x2e,
-    0x02, 0x35, 0x11, 0x33, 0x11, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x36, 0x36, 0x35, 0x03, 0x4e, 0x69,
-    0x3a, 0x69, 0x8e, 0x54, 0x54, 0x8f, 0x69, 0x3b, 0x7c, 0x27, 0x49, 0x61, 0x3a, 0x52, 0x81, 0x49,
-    0x02, 0xa6, 0x7c, 0x68, 0xb4, 0x73, 0x52, 0x8b, 0x67, 0x39, 0x69, 0x29, 0x4a, 0x65, 0x3c, 0x4f,
-    0x7d, 0x47, 0x05, 0xb0, 0xfb, 0xee, 0x6d, 0xa3, 0x6c, 0x36, 0x36, 0x6c, 0xa3, 0x6d, 0x04, 0x12,
-    0xfb, 0xee, 0x51, 0x7b, 0x53, 0x2a, 0x4b, 0x92, 0x6c, 0x04, 0x12, 0xfb, 0xee, 0x91, 0xc2, 0x5f,
-    0x36, 0x6c, 0xa3, 0x6d, 0x04, 0x12, 0xfb, 0xee, 0x51, 0x7b, 0x53, 0x2a, 0x4b, 0x92, 0x6c, 0x00,
-    0x00, 0x02, 0x00, 0x9d, 0xff, 0xeb, 0x05, 0xe4, 0x04, 0x3a, 0x00, 0x18, 0x00, 0x31, 0x00, 0x1b,
-    0x40, 0x0e, 0x2c, 0x1f, 0x0b, 0x72, 0x14, 0x07, 0x0b, 0x72, 0x26, 0x1a, 0x0e, 0x00, 0x06, 0x72,
-    0x00, 0x2b, 0x32, 0x32, 0x32, 0x2b, 0x32, 0x2b, 0x32, 0x30, 0x31, 0x41, 0x33, 0x11, 0x14, 0x0e,
-    0x02, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x11, 0x33, 0x11, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x36, 0x36,
-    0x35, 0x01, 0x33, 0x11, 0x14, 0x06, 0x06, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x11, 0x33, 0x11, 0x14,
-    0x1e, 0x02, 0x33, 0x32, 0x3e, 0x02, 0x35, 0x03, 0x04, 0x66, 0x35, 0x61, 0x82, 0x4e, 0x4d, 0x83,
-    0x61, 0x36, 0x78, 0x24, 0x40, 0x57, 0x34, 0x4a, 0x73, 0x43, 0x02, 0x68, 0x78, 0x60, 0xa6, 0x69,
-    0x4c, 0x80, 0x5e, 0x34, 0x66, 0x25, 0x43, 0x5a, 0x36, 0x35, 0x5a, 0x43, 0x25, 0x04, 0x3a, 0xfd,
-    0x44, 0x65, 0x97, 0x65, 0x32, 0x32, 0x65, 0x97, 0x65, 0x02, 0xbc, 0xfd, 0x44, 0x4a, 0x70, 0x4b,
-    0x27, 0x44, 0x86, 0x62, 0x02, 0xbc, 0xfd, 0x44, 0x87, 0xb3, 0x59, 0x32, 0x65, 0x97, 0x65, 0x02,
-    0xbc, 0xfd, 0x44, 0x4a, 0x70, 0x4b, 0x27, 0x27, 0x4b, 0x70, 0x4a, 0x00, 0x00, 0x02, 0xff, 0xe2,
-    0x00, 0x00, 0x03, 0xe2, 0x06, 0x0c, 0x00, 0x17, 0x00, 0x1b, 0x00, 0x21, 0x40, 0x10, 0x0d, 0x0a,
-    0x00, 0x17, 0x17, 0x0a, 0x1a, 0x1b, 0x1b, 0x0a, 0x0b, 0x01, 0x72, 0x0a, 0x0a, 0x72, 0x00, 0x2b,
-    0x2b, 0x11, 0x39, 0x2f, 0x33, 0x11, 0x39, 0x2f, 0x33, 0x11, 0x33, 0x30, 0x31, 0x53, 0x21, 0x32,
-    0x16, 0x16, 0x15, 0x14, 0x06, 0x06, 0x23, 0x21, 0x11, 0x33, 0x11, 0x21, 0x32, 0x36, 0x36, 0x35,
-    0x34, 0x26, 0x26, 0x23, 0x21, 0x01, 0x15, 0x21, 0x35, 0xf6, 0x01, 0x60, 0x81, 0xb0, 0x5b, 0x5b,
-    0xb0, 0x81, 0xfe, 0x53, 0x77, 0x01, 0x36, 0x63, 0x7a, 0x37, 0x37, 0x7a, 0x63, 0xfe, 0xa0, 0x01,
-    0x70, 0xfd, 0x7c, 0x02, 0xc4, 0x5b, 0x9f, 0x66, 0x65, 0xa1, 0x5e, 0x06, 0x0c, 0xfa, 0x5b, 0x48,
-    0x72, 0x41, 0x3e, 0x73, 0x4b, 0x02, 0x43, 0x67, 0x67, 0x00, 0x00, 0x03, 0x00, 0xd3, 0xff, 0xed,
-    0x06, 0x8d, 0x05, 0xc5, 0x00, 0x03, 0x00, 0x2c, 0x00, 0x30, 0x00, 0x20, 0x40, 0x11, 0x03, 0x02,
-    0x02, 0x2f, 0x30, 0x02, 0x72, 0x2f, 0x08, 0x1d, 0x14, 0x03, 0x72, 0x29, 0x09, 0x09, 0x72, 0x00,
-    0x2b, 0x32, 0x2b, 0x32, 0x3f, 0x2b, 0x12, 0x39, 0x2f, 0x33, 0x30, 0x31, 0x41, 0x15, 0x21, 0x35,
-    0x01, 0x33, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x35, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x16,
-    0x16, 0x17, 0x23, 0x2e, 0x02, 0x23, 0x22, 0x0e, 0x02, 0x15, 0x15, 0x14, 0x1e, 0x03, 0x33, 0x32,
-    0x36, 0x36, 0x01, 0x11, 0x23, 0x11, 0x04, 0xe0, 0xfc, 0x31, 0x05, 0x01, 0x7b, 0x0f, 0x84, 0xe4,
-    0xa1, 0x7c, 0xc9, 0x91, 0x4d, 0x4d, 0x92, 0xcd, 0x80, 0x9b, 0xe2, 0x83, 0x0f, 0x7b, 0x0f, 0x5f,
-    0xa9, 0x7d, 0x65, 0xa1, 0x70, 0x3b, 0x25, 0x46, 0x66, 0x86, 0x51, 0x81, 0xac, 0x60, 0xfb, 0x4c,
-    0x7b, 0x03, 0x2e, 0x67, 0x67, 0xfe, 0x9a, 0x94, 0xd4, 0x73, 0x5e, 0xae, 0xf2, 0x93, 0xb6, 0x94,
-    0xf1, 0xae, 0x5e, 0x71, 0xd4, 0x96, 0x76, 0xa4, 0x57, 0x4e, 0x91, 0xca, 0x7c, 0xb8, 0x60, 0xa8,
-    0x88, 0x62, 0x35, 0x52, 0xa5, 0x04, 0x62, 0xfa, 0x50, 0x05, 0xb0, 0x00, 0x00, 0x03, 0x00, 0xa7,
-    0xff, 0xec, 0x05, 0x84, 0x04, 0x4e, 0x00, 0x03, 0x00, 0x2b, 0x00, 0x2f, 0x00, 0x24, 0x40, 0x13,
-    0x03, 0x02, 0x02, 0x2e, 0x2f, 0x06, 0x72, 0x2e, 0x0a, 0x21, 0x1d, 0x18, 0x07, 0x72, 0x08, 0x04,
-    0x0d, 0x0b, 0x72, 0x00, 0x2b, 0x32, 0xcc, 0x2b, 0xcc, 0x33, 0x3f, 0x2b, 0x12, 0x39, 0x2f, 0x33,
-    0x30, 0x31, 0x41, 0x15, 0x21, 0x35, 0x01, 0x32, 0x36, 0x36, 0x37, 0x33, 0x0e, 0x02, 0x23, 0x22,
-    0x2e, 0x02, 0x35, 0x35, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x16, 0x16, 0x17, 0x23, 0x2e, 0x02, 0x23,
-    0x22, 0x0e, 0x02, 0x15, 0x15, 0x14, 0x1e, 0x02, 0x01, 0x11, 0x23, 0x11, 0x04, 0x67, 0xfc, 0x86,
-    0x02, 0xf7, 0x4c, 0x85, 0x57, 0x05, 0x73, 0x05, 0x74, 0xb8, 0x6f, 0x71, 0xae, 0x74, 0x3b, 0x3b,
-    0x75, 0xac, 0x71, 0x74, 0xb8, 0x70, 0x05, 0x73, 0x05, 0x52, 0x85, 0x52, 0x5c, 0x82, 0x51, 0x26,
-    0x25, 0x51, 0x83, 0xfd, 0x97, 0x77, 0x02, 0x5a, 0x67, 0x67, 0xfd, 0xf9, 0x3a, 0x70, 0x52, 0x67,
-    0xa0, 0x5c, 0x53, 0x93, 0xc4, 0x72, 0x2a, 0x72, 0xc5, 0x93, 0x52, 0x5e, 0xac, 0x76, 0x57, 0x7e,
-    0x44, 0x47, 0x7b, 0x9d, 0x56, 0x2a, 0x56, 0x9d, 0x7b, 0x47, 0x03, 0xe7, 0xfb, 0xc6, 0x04, 0x3a,
-    0x00, 0x04, 0x00, 0x25, 0x00, 0x00, 0x04, 0xc5, 0x05, 0xb0, 0x00, 0x04, 0x00, 0x09, 0x00, 0x0d,
-    0x00, 0x11, 0x00, 0x24, 0x40, 0x11, 0x11, 0x0d, 0x0c, 0x0c, 0x02, 0x00, 0x06, 0x06, 0x07, 0x03,
-    0x02, 0x72, 0x0f, 0x05, 0x05, 0x02, 0x08, 0x00, 0x3f, 0x33, 0x11, 0x33, 0x2b, 0x32, 0x32, 0x11,
-    0x33, 0x11, 0x39, 0x2f, 0x33, 0x33, 0x30, 0x31, 0x41, 0x01, 0x23, 0x01, 0x33, 0x01, 0x01, 0x27,
-    0x33, 0x01, 0x03, 0x15, 0x21, 0x35, 0x05, 0x11, 0x23, 0x11, 0x02, 0x7c, 0xfe, 0x2a, 0x81, 0x02,
-    0x17, 0x57, 0x01, 0xb2, 0xfe, 0x2d, 0x16, 0x57, 0x02, 0x12, 0xf1, 0xfd, 0x40, 0x01, 0x98, 0x79,
-    0x05, 0x16, 0xfa, 0xea, 0x05, 0xb0, 0xfa, 0x50, 0x05, 0x1a, 0x96, 0xfa, 0x50, 0x02, 0x46, 0x6c,
-    0x6c, 0x24, 0xfd, 0xde, 0x02, 0x22, 0x00, 0x04, 0x00, 0x1a, 0x00, 0x00, 0x04, 0x0c, 0x04, 0x3a,
-    0x00, 0x04, 0x00, 0x09, 0x00, 0x0d, 0x00, 0x11, 0x00, 0x1e, 0x40, 0x0e, 0x11, 0x0d, 0x0c, 0x0c,
-    0x01, 0x07, 0x03, 0x06, 0x72, 0x10, 0x05, 0x05, 0x01, 0x0a, 0x00, 0x3f, 0x33, 0x11, 0x33, 0x2b,
-    0x32, 0x12, 0x39, 0x2f, 0x33, 0x33, 0x30, 0x31, 0x41, 0x01, 0x23, 0x01, 0x33, 0x01, 0x01, 0x03,
-    0x33, 0x01, 0x03, 0x15, 0x21, 0x35, 0x05, 0x11, 0x23, 0x11, 0x01, 0xea, 0xfe, 0xac, 0x7c, 0x01,
-    0xc4, 0x60, 0x01, 0x52, 0xfe, 0xa8, 0x52, 0x61, 0x01, 0xc5, 0xd6, 0xfd, 0xbf, 0x01, 0x5c, 0x77,
-    0x03, 0x29, 0xfc, 0xd7, 0x04, 0x3a, 0xfb, 0xc6, 0x03, 0x29, 0x01, 0x11, 0xfb, 0xc6, 0x01, 0xc1,
-    0x67, 0x67, 0x1e, 0xfe, 0x5d, 0x01, 0xa3, 0x00, 0x00, 0x06, 0x00, 0xe5, 0x00, 0x00, 0x06, 0xd6,
-    0x05, 0xb0, 0x00, 0x03, 0x00, 0x08, 0x00, 0x0d, 0x00, 0x11, 0x00, 0x15, 0x00, 0x19, 0x00, 0x34,
-    0x40, 0x1a, 0x09, 0x14, 0x14, 0x06, 0x06, 0x18, 0x15, 0x11, 0x11, 0x10, 0x10, 0x03, 0x02, 0x02,
-    0x18, 0x08, 0x16, 0x02, 0x72, 0x04, 0x0a, 0x0a, 0x0b, 0x07, 0x02, 0x72, 0x00, 0x2b, 0x32, 0x32,
-    0x11, 0x33, 0x2b, 0x3f, 0x39, 0x2f, 0x33, 0x33, 0x11, 0x33, 0x11, 0x33, 0x11, 0x33, 0x11, 0x33,
-    0x11, 0x33, 0x30, 0x31, 0x41, 0x15, 0x21, 0x35, 0x01, 0x01, 0x23, 0x01, 0x33, 0x01, 0x01, 0x27,
-    0x33, 0x01, 0x03, 0x15, 0x21, 0x35, 0x05, 0x11, 0x23, 0x11, 0x01, 0x11, 0x23, 0x11, 0x03, 0x3c,
-    0xfd, 0xe6, 0x03, 0x6b, 0xfe, 0x2a, 0x81, 0x02, 0x17, 0x57, 0x01, 0xb2, 0xfe, 0x2d, 0x16, 0x57,
-    0x02, 0x12, 0xf1, 0xfd, 0x40, 0x01, 0x98, 0x79, 0xfd, 0x1c, 0x7b, 0x02, 0x46, 0x6b, 0x6b, 0x02,
-    0xd0, 0xfa, 0xea, 0x05, 0xb0, 0xfa, 0x50, 0x05, 0x1a, 0x96, 0xfa, 0x50, 0x02, 0x46, 0x6c, 0x6c,
-    0x24, 0xfd, 0xde, 0x02, 0x22, 0x03, 0x8e, 0xfa, 0x50, 0x05, 0xb0, 0x00, 0x00, 0x06, 0x00, 0xca,
-    0x00, 0x00, 0x05, 0xcb, 0x04, 0x3a, 0x00, 0x03, 0x00, 0x08, 0x00, 0x0d, 0x00, 0x11, 0x00, 0x15,
-    0x00, 0x19, 0x00, 0x2e, 0x40, 0x17, 0x15, 0x11, 0x11, 0x10, 0x10, 0x03, 0x02, 0x02, 0x18, 0x19,
-    0x06, 0x72, 0x09, 0x14, 0x14, 0x06, 0x06, 0x18, 0x0a, 0x0b, 0x07, 0x06, 0x72, 0x00, 0x2b, 0x32,
-    0x3f, 0x33, 0x11, 0x33, 0x11, 0x33, 0x2b, 0x12, 0x39, 0x2f, 0x33, 0x33, 0x11, 0x33, 0x11, 0x33,
-    0x30, 0x31, 0x41, 0x15, 0x21, 0x35, 0x01, 0x01, 0x23, 0x01, 0x33, 0x01, 0x01, 0x03, 0x33, 0x01,
-    0x03, 0x15, 0x21, 0x35, 0x05, 0x11, 0x23, 0x11, 0x01, 0x11, 0x23, 0x11, 0x02, 0xd1, 0xfe, 0x2c,
-    0x02, 0xac, 0xfe, 0xac, 0x7c, 0x01, 0xc4, 0x60, 0x01, 0x52, 0xfe, 0xa8, 0x52, 0x61, 0x01, 0xc5,
-    0xd6, 0xfd, 0xbf, 0x01, 0x5c, 0x77, 0xfd, 0xa8, 0x77, 0x01, 0xc1, 0x67, 0x67, 0x01, 0x68, 0xfc,
-    0xd7, 0x04, 0x3a, 0xfb, 0xc6, 0x03, 0x29, 0x01, 0x11, 0xfb, 0xc6, 0x01, 0xc1, 0x67, 0x67, 0x1e,
-    0xfe, 0x5d, 0x01, 0xa3, 0x02, 0x97, 0xfb, 0xc6, 0x04, 0x3a, 0x00, 0x05, 0x00, 0x9d, 0x00, 0x00,
-    0x05, 0xe9, 0x05, 0xb0, 0x00, 0x16, 0x00, 0x1a, 0x00, 0x1f, 0x00, 0x24, 0x00, 0x28, 0x00, 0x34,
-    0x40, 0x19, 0x19, 0x1a, 0x1a, 0x24, 0x1b, 0x1f, 0x1f, 0x23, 0x23, 0x13, 0x28, 0x06, 0x06, 0x13,
-    0x13, 0x01, 0x1c, 0x24, 0x02, 0x72, 0x0d, 0x27, 0x27, 0x01, 0x08, 0x00, 0x3f, 0x33, 0x11, 0x33,
-    0x2b, 0x32, 0x12, 0x39, 0x2f, 0x33, 0x11, 0x33, 0x11, 0x33, 0x11, 0x33, 0x11, 0x33, 0x11, 0x33,
-    0x11, 0x33, 0x30, 0x31, 0x61, 0x23, 0x11, 0x34, 0x36, 0x36, 0x33, 0x21, 0x32, 0x16, 0x16, 0x15,
-    0x11, 0x23, 0x11, 0x34, 0x26, 0x26, 0x23, 0x21, 0x22, 0x06, 0x15, 0x01, 0x15, 0x21, 0x35, 0x01,
-    0x01, 0x33, 0x01, 0x23, 0x01, 0x01, 0x17, 0x23, 0x01, 0x01, 0x11, 0x23, 0x11, 0x01, 0x19, 0x7c,
-    0x6b, 0xc8, 0x8b, 0x01, 0xd0, 0x8c, 0xc7, 0x6b, 0x7c, 0x46, 0x8e, 0x6e, 0xfe, 0x30, 0xa3, 0x9f,
-    0x03, 0xe5, 0xfc, 0x92, 0x01, 0xa3, 0x01, 0xbc, 0x8e, 0xfe, 0x02, 0x56, 0xfe, 0x74, 0x01, 0xbd,
-    0x09, 0x56, 0xfe, 0x02, 0x02, 0x73, 0x7b, 0x01, 0x7c, 0x91, 0xb0, 0x4f, 0x4f, 0xb0, 0x91, 0xfe,
-    0x84, 0x01, 0x7c, 0x6f, 0x81, 0x36, 0x7f, 0xa7, 0x04, 0x34, 0x6a, 0x6a, 0xfd, 0x30, 0x02, 0xd0,
-    0xfc, 0xdf, 0x03, 0x21, 0xfd, 0x2c, 0x4d, 0x03, 0x21, 0xfd, 0x41, 0xfd, 0x0f, 0x02, 0xf1, 0x00,
-    0x00, 0x05, 0x00, 0x9f, 0x00, 0x00, 0x05, 0x09, 0x04, 0x3b, 0x00, 0x17, 0x00, 0x1b, 0x00, 0x20,
-    0x00, 0x25, 0x00, 0x29, 0x00, 0x30, 0x40, 0x17, 0x1a, 0x1b, 0x1b, 0x25, 0x20, 0x24, 0x24, 0x13,
-    0x29, 0x06, 0x06, 0x13, 0x13, 0x01, 0x1d, 0x25, 0x06, 0x72, 0x0d, 0x28, 0x28, 0x01, 0x0a, 0x00,
-    0x3f, 0x33, 0x11, 0x33, 0x2b, 0x32, 0x12, 0x39, 0x2f, 0x33, 0x11, 0x33, 0x11, 0x33, 0x11, 0x33,
-    0x11, 0x33, 0x11, 0x33, 0x30, 0x31, 0x61, 0x23, 0x35, 0x34, 0x36, 0x36, 0x33, 0x21, 0x32, 0x16,
-    0x16, 0x15, 0x15, 0x23, 0x35, 0x34, 0x26, 0x26, 0x23, 0x21, 0x22, 0x06, 0x06, 0x15, 0x01, 0x15,
-    0x21, 0x35, 0x01, 0x01, 0x33, 0x01, 0x23, 0x01, 0x01, 0x17, 0x23, 0x01, 0x01, 0x11, 0x23, 0x11,
-    0x01, 0x17, 0x78, 0x66, 0xc0, 0x85, 0x01, 0x15, 0x85, 0xbf, 0x66, 0x78, 0x42, 0x88, 0x68, 0xfe,
-    0xeb, 0x68, 0x88, 0x43, 0x03, 0x35, 0xfd, 0x29, 0x01, 0x50, 0x01, 0x58, 0x89, 0xfe, 0x69, 0x50,
-    0xfe, 0xd4, 0x01, 0x5a, 0x04, 0x4f, 0xfe, 0x68, 0x02, 0x08, 0x77, 0xc3, 0x92, 0xaf, 0x4f, 0x4f,
-    0xb0, 0x91, 0xc3, 0xc3, 0x71, 0x81, 0x37, 0x37, 0x81, 0x71, 0x03, 0x78, 0x68, 0x68, 0xfd, 0xea,
-    0x02, 0x15, 0xfd, 0x9d, 0x02, 0x63, 0xfd, 0xe8, 0x4b, 0x02, 0x63, 0xfe, 0x0b, 0xfd, 0xbb, 0x02,
-    0x45, 0x00, 0x00, 0x07, 0x00, 0xd2, 0x00, 0x00, 0x08, 0x08, 0x05, 0xb0, 0x00, 0x03, 0x00, 0x07,
-    0x00, 0x1e, 0x00, 0x22, 0x00, 0x27, 0x00, 0x2c, 0x00, 0x30, 0x00, 0x3c, 0x40, 0x1e, 0x21, 0x22,
-    0x22, 0x24, 0x2c, 0x02, 0x72, 0x27, 0x2b, 0x2b, 0x1b, 0x30, 0x0e, 0x0e, 0x1b, 0x1b, 0x03, 0x02,
-    0x02, 0x05, 0x07, 0x02, 0x72, 0x15, 0x2f, 0x2f, 0x09, 0x09, 0x05, 0x08, 0x00, 0x3f, 0x33, 0x11,
-    0x33, 0x11, 0x33, 0x2b, 0x12, 0x39, 0x2f, 0x33, 0x33, 0x11, 0x33, 0x11, 0x33, 0x11, 0x33, 0x11,
-    0x33, 0x2b, 0x32, 0x32, 0x11, 0x33, 0x30, 0x31, 0x41, 0x15, 0x21, 0x35, 0x13, 0x11, 0x23, 0x11,
-    0x01, 0x23, 0x11, 0x34, 0x36, 0x36, 0x33, 0x21, 0x32, 0x16, 0x16, 0x15, 0x11, 0x23, 0x11, 0x34,
-    0x26, 0x26, 0x23, 0x21, 0x22, 0x06, 0x15, 0x01, 0x15, 0x21, 0x35, 0x01, 0x01, 0x33, 0x01, 0x23,
-    0x01, 0x01, 0x17, 0x23, 0x01, 0x01, 0x11, 0x23, 0x11, 0x04, 0xad, 0xfc, 0x7b, 0x25, 0x7b, 0x02,
-    0x67, 0x7c, 0x6b, 0xc8, 0x8b, 0x01, 0xd0, 0x8c, 0xc7, 0x6a, 0x7b, 0x46, 0x8e, 0x6e, 0xfe, 0x30,
-    0xa3, 0x9f, 0x03, 0xe5, 0xfc, 0x92, 0x01, 0xa3, 0x01, 0xbc, 0x8e, 0xfe, 0x02, 0x56, 0xfe, 0x74,
-    0x01, 0xbd, 0x09, 0x56, 0xfe, 0x02, 0x02, 0x73, 0x7c, 0x03, 0x0d, 0x67, 0x67, 0x02, 0xa3, 0xfa,
-    0x50, 0x05, 0xb0, 0xfa, 0x50, 0x01, 0x7c, 0x91, 0xb0, 0x4f, 0x4f, 0xb0, 0x91, 0xfe, 0x84, 0x01,
-    0x7c, 0x6f, 0x81, 0x36, 0x7f, 0xa7, 0x04, 0x34, 0x6a, 0x6a, 0xfd, 0x30, 0x02, 0xd0, 0xfc, 0xdf,
-    0x03, 0x21, 0xfd, 0x2c, 0x4d, 0x03, 0x21, 0xfd, 0x41, 0xfd, 0x0f, 0x02, 0xf1, 0x00, 0x00, 0x07,
-    0x00, 0xa9, 0x00, 0x00, 0x06, 0xcc, 0x04, 0x3b, 0x00, 0x03, 0x00, 0x07, 0x00, 0x1f, 0x00, 0x23,
-    0x00, 0x28, 0x00, 0x2d, 0x00, 0x31, 0x00, 0x3e, 0x40, 0x1e, 0x25, 0x22, 0x23, 0x23, 0x2d, 0x2d,
-    0x07, 0x28, 0x2c, 0x2c, 0x1b, 0x31, 0x0e, 0x0e, 0x1b, 0x1b, 0x03, 0x02, 0x02, 0x06, 0x07, 0x06,
-    0x72, 0x15, 0x30, 0x30, 0x09, 0x09, 0x06, 0x0a, 0x00, 0x3f, 0x33, 0x11, 0x33, 0x11, 0x33, 0x2b,
-    0x12, 0x39, 0x2f, 0x33, 0x33, 0x11, 0x33, 0x11, 0x33, 0x11, 0x33, 0x11, 0x33, 0x11, 0x33, 0x11,
-    0x33, 0x11, 0x33, 0x33, 0x30, 0x31, 0x41, 0x15, 0x21, 0x35, 0x13, 0x11, 0x23, 0x11, 0x01, 0x23,
-    0x35, 0x34, 0x36, 0x36, 0x33, 0x21, 0x32, 0x16, 0x16, 0x15, 0x15, 0x23, 0x35, 0x34, 0x26, 0x26,
-    0x23, 0x21, 0x22, 0x06, 0x06, 0x15, 0x01, 0x15, 0x21, 0x35, 0x01, 0x01, 0x33, 0x01, 0x23, 0x01,
-    0x01, 0x17, 0x23, 0x01, 0x01, 0x11, 0x23, 0x11, 0x04, 0x56, 0xfc, 0x87, 0x43, 0x77, 0x02, 0x31,
-    0x78, 0x66, 0xc0, 0x85, 0x01, 0x15, 0x85, 0xbf, 0x66, 0x78, 0x42, 0x88, 0x68, 0xfe, 0xeb, 0x68,
-    0x88, 0x43, 0x03, 0x35, 0xfd, 0x29, 0x01, 0x50, 0x01, 0x58, 0x89, 0xfe, 0x69, 0x50, 0xfe, 0xd4,
-    0x01, 0x5a, 0x04, 0x4f, 0xfe, 0x68, 0x02, 0x08, 0x77, 0x02, 0x53, 0x67, 0x67, 0x01, 0xe7, 0xfb,
-    0xc6, 0x04, 0x3a, 0xfb, 0xc6, 0xc3, 0x92, 0xaf, 0x4f, 0x4f, 0xb0, 0x91, 0xc3, 0xc3, 0x71, 0x81,
-    0x37, 0x37, 0x81, 0x71, 0x03, 0x78, 0x68, 0x68, 0xfd, 0xea, 0x02, 0x15, 0xfd, 0x9d, 0x02, 0x63,
-    0xfd, 0xe8, 0x4b, 0x02, 0x63, 0xfe, 0x0b, 0xfd, 0xbb, 0x02, 0x45, 0x00, 0x00, 0x03, 0x00, 0x75,
-    0xfe, 0x66, 0x03, 0xce, 0x07, 0x78, 0x00, 0x17, 0x00, 0x40, 0x00, 0x49, 0x00, 0x2b, 0x40, 0x14,
-    0x18, 0x0d, 0x0c, 0x40, 0x40, 0x00, 0x2b, 0x2c, 0x09, 0x45, 0x43, 0x43, 0x42, 0x48, 0x41, 0x80,
-    0x47, 0x17, 0x00, 0x02, 0x00, 0x3f, 0x32, 0xde, 0x1a, 0xcd, 0x32, 0x39, 0x32, 0x11, 0x33, 0x3f,
-    0x33, 0x12, 0x39, 0x2f, 0x33, 0x33, 0x33, 0x30, 0x31, 0x53, 0x21, 0x32, 0x1e, 0x02, 0x15, 0x14,
-    0x0e, 0x02, 0x23, 0x23, 0x35, 0x33, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x21, 0x13,
-    0x33, 0x32, 0x1e, 0x02, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x23, 0x22, 0x06, 0x15, 0x14, 0x16, 0x16,
-    0x17, 0x07, 0x2e, 0x02, 0x35, 0x34, 0x36, 0x36, 0x33, 0x33, 0x32, 0x3e, 0x02, 0x35, 0x34, 0x2e,
-    0x02, 0x23, 0x23, 0x13, 0x17, 0x37, 0x33, 0x15, 0x03, 0x23, 0x03, 0x35, 0x9b, 0x01, 0x41, 0x6a,
-    0xaf, 0x7e, 0x45, 0x43, 0x80, 0xb7, 0x74, 0x88, 0x84, 0x86, 0xa7, 0x4c, 0x4a, 0x9d, 0x7c, 0xfe,
-    0xbf, 0xa7, 0x88, 0x80, 0xc1, 0x82, 0x41, 0x4d, 0x8a, 0xb7, 0x6a, 0x43, 0x5e, 0x4e, 0x3b, 0x50,
-    0x20, 0x2d, 0x33, 0x6f, 0x4e, 0x41, 0x80, 0x61, 0x3f, 0x58, 0x8e, 0x64, 0x36, 0x34, 0x66, 0x95,
-    0x61, 0x84, 0x51, 0xac, 0xac, 0x6b, 0xec, 0x57, 0xeb, 0x05, 0xb0, 0x32, 0x62, 0x8f, 0x5c, 0x4b,
-    0x82, 0x63, 0x38, 0x54, 0x46, 0x7e, 0x54, 0x4f, 0x7d, 0x48, 0xfd, 0xbd, 0x32, 0x60, 0x8d, 0x5b,
-    0x61, 0x96, 0x68, 0x36, 0x44, 0x3b, 0x31, 0x4b, 0x32, 0x0c, 0x58, 0x13, 0x4e, 0x70, 0x45, 0x47,
-    0x65, 0x35, 0x2b, 0x4f, 0x6e, 0x43, 0x4f, 0x72, 0x4a, 0x23, 0x04, 0xc2, 0xc2, 0xc2, 0x0c, 0xfe,
-    0xfa, 0x01, 0x07, 0x0b, 0x00, 0x03, 0x00, 0x5e, 0xfe, 0x66, 0x03, 0x6d, 0x06, 0x2f, 0x00, 0x18,
-    0x00, 0x41, 0x00, 0x4a, 0x00, 0x26, 0x40, 0x11, 0x0d, 0x19, 0x0c, 0x41, 0x41, 0x00, 0x2d, 0x43,
-    0x49, 0x46, 0x44, 0x42, 0x80, 0x48, 0x18, 0x00, 0x06, 0x00, 0x3f, 0x32, 0xde, 0x1a, 0xcd, 0x32,
-    0x32, 0x32, 0x39, 0x2f, 0x12, 0x39, 0x2f, 0x33, 0x33, 0x33, 0x30, 0x31, 0x53, 0x21, 0x32, 0x1e,
-    0x02, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x23, 0x35, 0x33, 0x32, 0x36, 0x36, 0x35, 0x34, 0x2e, 0x02,
-    0x23, 0x21, 0x13, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x23, 0x22, 0x06, 0x15,
-    0x14, 0x16, 0x16, 0x17, 0x07, 0x2e, 0x02, 0x27, 0x34, 0x36, 0x36, 0x33, 0x33, 0x32, 0x3e, 0x02,
-    0x35, 0x34, 0x2e, 0x02, 0x23, 0x23, 0x13, 0x17, 0x37, 0x33, 0x15, 0x03, 0x23, 0x03, 0x35, 0x8b,
-    0x01, 0x24, 0x5e, 0x9b, 0x71, 0x3e, 0x3c, 0x73, 0xa4, 0x67, 0x88, 0x84, 0x74, 0x8f, 0x42, 0x24,
-    0x4a, 0x73, 0x4e, 0xfe, 0xdc, 0x8a, 0x88, 0x72, 0xae, 0x74, 0x3c, 0x45, 0x7c, 0xa4, 0x5f, 0x2d,
-    0x5e, 0x4d, 0x3a, 0x51, 0x20, 0x2d, 0x33, 0x70, 0x4d, 0x01, 0x41, 0x82, 0x5f, 0x29, 0x4c, 0x7a,
-    0x57, 0x2e, 0x2d, 0x58, 0x81, 0x55, 0x84, 0x05, 0xac, 0xac, 0x6b, 0xec, 0x57, 0xeb, 0x04, 0x3a,
-    0x26, 0x4a, 0x6c, 0x45, 0x3a, 0x64, 0x4c, 0x2a, 0x54, 0x30, 0x59, 0x3b, 0x27, 0x42, 0x31, 0x1b,
-    0xfe, 0x70, 0x24, 0x46, 0x66, 0x42, 0x4a, 0x74, 0x51, 0x2a, 0x44, 0x3b, 0x31, 0x4b, 0x32, 0x0c,
-    0x58, 0x13, 0x4e, 0x70, 0x45, 0x47, 0x65, 0x35, 0x1e, 0x36, 0x4c, 0x2f, 0x34, 0x4b, 0x30, 0x17,
-    0x04, 0x3d, 0xc2, 0xc2, 0x0c, 0xfe, 0xfa, 0x01, 0x07, 0x0b, 0x00, 0x03, 0x00, 0x76, 0xff, 0xec,
-    0x04, 0xe5, 0x05, 0xc4, 0x00, 0x17, 0x00, 0x28, 0x00, 0x39, 0x00, 0x1f, 0x40, 0x12, 0x0c, 0x29,
-    0x6a, 0x32, 0x20, 0x6a, 0x32, 0x32, 0x0c, 0x00, 0x18, 0x6a, 0x00, 0x03, 0x72, 0x0c, 0x09, 0x72,
-    0x00, 0x2b, 0x2b, 0x2b, 0x12, 0x39, 0x2f, 0x2b, 0x2b, 0x30, 0x31, 0x41, 0x32, 0x1e, 0x03, 0x15,
-    0x15, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x03, 0x35, 0x35, 0x34, 0x3e, 0x02, 0x17, 0x22, 0x0e,
-    0x02, 0x07, 0x06, 0x06, 0x15, 0x21, 0x34, 0x34, 0x27, 0x2e, 0x03, 0x03, 0x32, 0x3e, 0x02, 0x37,
-    0x34, 0x36, 0x35, 0x21, 0x14, 0x16, 0x17, 0x1e, 0x03, 0x02, 0xad, 0x67, 0xb0, 0x8b, 0x62, 0x34,
-    0x50, 0x94, 0xd1, 0x81, 0x66, 0xaf, 0x8c, 0x63, 0x35, 0x51, 0x96, 0xd1, 0x7f, 0x63, 0xa0, 0x72,
-    0x41, 0x04, 0x01, 0x01, 0x03, 0x79, 0x01, 0x05, 0x3f, 0x72, 0xa1, 0x63, 0x66, 0xa0, 0x71, 0x3f,
-    0x04, 0x01, 0xfc, 0x88, 0x01, 0x01, 0x05, 0x41, 0x73, 0x9f, 0x05, 0xc4, 0x3d, 0x73, 0xa4, 0xd0,
-    0x7a, 0x9b, 0x99, 0xf8, 0xb0, 0x5e, 0x3d, 0x73, 0xa5, 0xcf, 0x7b, 0x9b, 0x99, 0xf7, 0xb0, 0x5e,
-    0x6d, 0x48, 0x87, 0xbe, 0x76, 0x13, 0x26, 0x14, 0x13, 0x26, 0x13, 0x77, 0xbe, 0x87, 0x48, 0xfb,
-    0x02, 0x48, 0x88, 0xc1, 0x78, 0x0f, 0x20, 0x0f, 0x12, 0x24, 0x11, 0x76, 0xbd, 0x86, 0x47, 0x00,
-    0x00, 0x03, 0x00, 0x5a, 0xff, 0xec, 0x04, 0x1f, 0x04, 0x4e, 0x00, 0x15, 0x00, 0x20, 0x00, 0x2b,
-    0x00, 0x1f, 0x40, 0x12, 0x0b, 0x21, 0x6a, 0x27, 0x1b, 0x6a, 0x27, 0x27, 0x0b, 0x00, 0x16, 0x6a,
-    0x00, 0x07, 0x72, 0x0b, 0x0b, 0x72, 0x00, 0x2b, 0x2b, 0x2b, 0x12, 0x39, 0x2f, 0x2b, 0x2b, 0x30,
-    0x31, 0x41, 0x32, 0x1e, 0x02, 0x15, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x35,
-    0x34, 0x3e, 0x02, 0x17, 0x22, 0x0e, 0x02, 0x07, 0x21, 0x2e, 0x03, 0x03, 0x32, 0x3e, 0x02, 0x37,
-    0x21, 0x1e, 0x03, 0x02, 0x3c, 0x6e, 0xb2, 0x7f, 0x44, 0x44, 0x7e, 0xb2, 0x6d, 0x6e, 0xb2, 0x80,
-    0x44, 0x44, 0x7f, 0xb2, 0x6d, 0x53, 0x83, 0x5b, 0x33, 0x05, 0x02, 0xd3, 0x04, 0x34, 0x5c, 0x83,
-    0x51, 0x53, 0x83, 0x5c, 0x33, 0x03, 0xfd, 0x2d, 0x03, 0x34, 0x5c, 0x83, 0x04, 0x4e, 0x51, 0x92,
-    0xc8, 0x76, 0x20, 0x76, 0xc7, 0x93, 0x51, 0x51, 0x93, 0xc7, 0x76, 0x20, 0x76, 0xc8, 0x92, 0x51,
-    0x67, 0x41, 0x70, 0x92, 0x51, 0x51, 0x92, 0x70, 0x41, 0xfc, 0x6c, 0x41, 0x71, 0x94, 0x53, 0x53,
-    0x94, 0x71, 0x41, 0x00, 0x00, 0x02, 0x00, 0x1d, 0x00, 0x00, 0x04, 0xd1, 0x05, 0xc4, 0x00, 0x0e,
-    0x00, 0x13, 0x00, 0x19, 0x40, 0x0d, 0x0e, 0x12, 0x08, 0x05, 0x13, 0x02, 0x72, 0x05, 0x03, 0x72,
-    0x12, 0x08, 0x72, 0x00, 0x2b, 0x2b, 0x2b, 0x11, 0x33, 0x11, 0x33, 0x30, 0x31, 0x41, 0x01, 0x3e,
-    0x02, 0x33, 0x17, 0x07, 0x23, 0x22, 0x06, 0x06, 0x07, 0x01, 0x23, 0x01, 0x01, 0x13, 0x23, 0x01,
-    0x02, 0x60, 0x01, 0x31, 0x1f, 0x51, 0x6d, 0x47, 0x1c, 0x01, 0x0b, 0x24, 0x46, 0x3f, 0x1b, 0xfe,
-    0x7a, 0x64, 0xfe, 0x8c, 0x01, 0x7e, 0x49, 0x64, 0xfe, 0x17, 0x01, 0x02, 0x03, 0xb4, 0x63, 0x76,
-    0x35, 0x01, 0x6c, 0x19, 0x4e, 0x52, 0xfb, 0x62, 0x05, 0xb0, 0xfb, 0x53, 0xfe, 0xfd, 0x05, 0xb0,
-    0x00, 0x02, 0x00, 0x2d, 0x00, 0x00, 0x04, 0x02, 0x04, 0x4e, 0x00, 0x12, 0x00, 0x17, 0x00, 0x15,
-    0x40, 0x0b, 0x17, 0x06, 0x72, 0x12, 0x16, 0x0a, 0x72, 0x0c, 0x05, 0x07, 0x72, 0x00, 0x2b, 0x32,
-    0x2b, 0x32, 0x2b, 0x30, 0x31, 0x41, 0x13, 0x3e, 0x02, 0x33, 0x32, 0x16, 0x17, 0x07, 0x26, 0x26,
-    0x23, 0x22, 0x06, 0x06, 0x07, 0x01, 0x23, 0x01, 0x01, 0x13, 0x23, 0x01, 0x02, 0x02, 0xc5, 0x19,
-    0x41, 0x52, 0x30, 0x1c, 0x32, 0x11, 0x11, 0x06, 0x20, 0x15, 0x15, 0x2d, 0x29, 0x12, 0xfe, 0xd0,
-    0x57, 0xfe, 0xf7, 0x01, 0x0a, 0x4d, 0x57, 0xfe, 0x84, 0x01, 0x11, 0x02, 0x70, 0x4b, 0x59, 0x29,
-    0x0b, 0x0b, 0x61, 0x04, 0x09, 0x13, 0x33, 0x31, 0xfc, 0x93, 0x04, 0x3a, 0xfc, 0xd7, 0xfe, 0xef,
-    0x04, 0x3a, 0x00, 0x04, 0x00, 0x76, 0xff, 0x72, 0x04, 0xe5, 0x06, 0x3a, 0x00, 0x03, 0x00, 0x07,
-    0x00, 0x1f, 0x00, 0x37, 0x00, 0x24, 0x40, 0x10, 0x02, 0x02, 0x27, 0x27, 0x03, 0x1a, 0x03, 0x72,
-    0x07, 0x07, 0x33, 0x33, 0x06, 0x0e, 0x09, 0x72, 0x00, 0x2b, 0xcd, 0x33, 0x11, 0x33, 0x7c, 0x2f,
-    0x2b, 0x18, 0xcd, 0x33, 0x11, 0x33, 0x7d, 0x2f, 0x30, 0x31, 0x41, 0x11, 0x23, 0x11, 0x13, 0x11,
-    0x23, 0x11, 0x01, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x03, 0x35, 0x35, 0x34, 0x3e, 0x02,
-    0x33, 0x32, 0x1e, 0x03, 0x03, 0x35, 0x34, 0x2e, 0x03, 0x23, 0x22, 0x0e, 0x02, 0x15, 0x15, 0x14,
-    0x1e, 0x03, 0x33, 0x32, 0x3e, 0x02, 0x02, 0xee, 0x78, 0x78, 0x78, 0x02, 0x6f, 0x50, 0x94, 0xd1,
-    0x81, 0x66, 0xaf, 0x8c, 0x63, 0x35, 0x51, 0x96, 0xd1, 0x7f, 0x67, 0xb0, 0x8b, 0x62, 0x34, 0x7b,
-    0x26, 0x4b, 0x6c, 0x8c, 0x54, 0x67, 0xa4, 0x74, 0x3d, 0x28, 0x4c, 0x6c, 0x8b, 0x53, 0x6a, 0xa4,
-    0x72, 0x3b, 0x06, 0x3a, 0xfe, 0xa5, 0x01, 0x5b, 0xfa, 0x97, 0xfe, 0xa1, 0x01, 0x5f, 0x02, 0x55,
-    0x9b, 0x99, 0xf8, 0xb0, 0x5e, 0x3d, 0x73, 0xa5, 0xcf, 0x7b, 0x9b, 0x99, 0xf7, 0xb0, 0x5e, 0x3d,
-    0x73, 0xa4, 0xd0, 0xfe, 0xeb, 0x9d, 0x67, 0xad, 0x89, 0x60, 0x32, 0x4e, 0x92, 0xce, 0x81, 0x9d,
-    0x68, 0xaf, 0x89, 0x60, 0x32, 0x4e, 0x92, 0xd0, 0x00, 0x04, 0x00, 0x5a, 0xff, 0x7c, 0x04, 0x1f,
-    0x04, 0xbc, 0x00, 0x03, 0x00, 0x07, 0x00, 0x1d, 0x00, 0x33, 0x00, 0x24, 0x40, 0x10, 0x07, 0x07,
-    0x24, 0x24, 0x06, 0x19, 0x0b, 0x72, 0x02, 0x02, 0x2f, 0x2f, 0x03, 0x0e, 0x07, 0x72, 0x00, 0x2b,
-    0xcd, 0x33, 0x11, 0x33, 0x7d, 0x2f, 0x2b, 0x18, 0xcd, 0x33, 0x11, 0x33, 0x7c, 0x2f, 0x30, 0x31,
-    0x41, 0x11, 0x23, 0x11, 0x13, 0x11, 0x23, 0x11, 0x01, 0x35, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x1e,
-    0x02, 0x15, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x37, 0x15, 0x14, 0x1e, 0x02, 0x33,
-    0x32, 0x3e, 0x02, 0x35, 0x35, 0x34, 0x2e, 0x02, 0x23, 0x22, 0x0e, 0x02, 0x02, 0x77, 0x78, 0x78,
-    0x78, 0xfe, 0x5b, 0x44, 0x7f, 0xb2, 0x6d, 0x6e, 0xb2, 0x7f, 0x44, 0x44, 0x7e, 0xb2, 0x6d, 0x6e,
-    0xb2, 0x80, 0x44, 0x77, 0x30, 0x5c, 0x88, 0x59, 0x57, 0x87, 0x5c, 0x30, 0x30, 0x5d, 0x87, 0x58,
-    0x58, 0x87, 0x5d, 0x2f, 0x04, 0xbc, 0xfe, 0xae, 0x01, 0x52, 0xfc, 0x11, 0xfe, 0xaf, 0x01, 0x51,
-    0x01, 0x40, 0x20, 0x76, 0xc8, 0x92, 0x51, 0x51, 0x92, 0xc8, 0x76, 0x20, 0x76, 0xc7, 0x93, 0x51,
-    0x51, 0x93, 0xc7, 0x96, 0x20, 0x59, 0x9f, 0x7b, 0x47, 0x47, 0x7b, 0x9f, 0x59, 0x20, 0x58, 0x9e,
-    0x7c, 0x48, 0x48, 0x7c, 0x9e, 0x00, 0x00, 0x04, 0x00, 0xab, 0xff, 0xeb, 0x06, 0x6c, 0x07, 0x34,
-    0x00, 0x15, 0x00, 0x20, 0x00, 0x41, 0x00, 0x65, 0x00, 0x33, 0x40, 0x19, 0x5b, 0x4e, 0x09, 0x72,
-    0x54, 0x31, 0x31, 0x2c, 0x38, 0x09, 0x72, 0x42, 0x43, 0x43, 0x11, 0x08, 0x08, 0x1b, 0x1b, 0x16,
-    0x16, 0x22, 0x21, 0x02, 0x72, 0x00, 0x2b, 0x32, 0x32, 0x7c, 0x2f, 0x33, 0x18, 0x2f, 0x33, 0x11,
-    0x33, 0x32, 0x11, 0x33, 0x2b, 0x32, 0x32, 0x2f, 0x33, 0x2b, 0x32, 0x30, 0x31, 0x41, 0x33, 0x15,
-    0x23, 0x22, 0x2e, 0x02, 0x23, 0x22, 0x06, 0x15, 0x15, 0x23, 0x35, 0x34, 0x36, 0x33, 0x32, 0x1e,
-    0x02, 0x01, 0x27, 0x36, 0x36, 0x35, 0x35, 0x33, 0x15, 0x14, 0x06, 0x06, 0x25, 0x15, 0x22, 0x06,
-    0x06, 0x15, 0x11, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x36, 0x36, 0x35, 0x11, 0x33, 0x11, 0x14, 0x0e,
-    0x02, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x11, 0x34, 0x36, 0x36, 0x05, 0x35, 0x32, 0x1e, 0x02, 0x15,
-    0x11, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x11, 0x33, 0x11, 0x14, 0x1e, 0x02, 0x33,
-    0x32, 0x3e, 0x02, 0x35, 0x11, 0x34, 0x2e, 0x02, 0x05, 0x3b, 0x1b, 0x1e, 0x57, 0x7e, 0x62, 0x5c,
-    0x35, 0x49, 0x4c, 0x5b, 0x7e, 0x6e, 0x40, 0x67, 0x64, 0x75, 0xfe, 0x7f, 0x31, 0x22, 0x24, 0x6a,
-    0x29, 0x3b, 0xfe, 0xac, 0x4d, 0x78, 0x46, 0x27, 0x49, 0x61, 0x3a, 0x52, 0x81, 0x49, 0x69, 0x3a,
-    0x69, 0x8e, 0x54, 0x54, 0x8f, 0x69, 0x3b, 0x66, 0xb1, 0x03, 0x23, 0x54, 0x8f, 0x6a, 0x3a, 0x3a,
-    0x6a, 0x8f, 0x54, 0x53, 0x8e, 0x69, 0x3a, 0x69, 0x2a, 0x4d, 0x67, 0x3d, 0x3a, 0x62, 0x48, 0x28,
-    0x28, 0x48, 0x62, 0x06, 0x93, 0x56, 0x2f, 0x3e, 0x2f, 0x52, 0x3f, 0x12, 0x1f, 0x65, 0x7a, 0x31,
-    0x40, 0x30, 0xfe, 0xa2, 0x2f, 0x20, 0x41, 0x2e, 0x61, 0x66, 0x28, 0x4a, 0x37, 0x6a, 0x6a, 0x4e,
-    0x9a, 0x72, 0xfd, 0xc4, 0x56, 0x81, 0x57, 0x2c, 0x4b, 0x92, 0x6c, 0x01, 0xd5, 0xfe, 0x2b, 0x6d,
-    0xa4, 0x6c, 0x36, 0x38, 0x71, 0xa9, 0x72, 0x02, 0x3c, 0x98, 0xc8, 0x64, 0x6a, 0x6a, 0x38, 0x71,
-    0xa9, 0x72, 0xfd, 0xc4, 0x72, 0xa9, 0x71, 0x38, 0x36, 0x6c, 0xa4, 0x6d, 0x01, 0xd5, 0xfe, 0x2b,
-    0x51, 0x7b, 0x53, 0x2a, 0x2c, 0x57, 0x81, 0x56, 0x02, 0x3c, 0x56, 0x81, 0x57, 0x2c, 0x00, 0x04,
-    0x00, 0x8d, 0xff, 0xeb, 0x05, 0xd3, 0x05, 0xed, 0x00, 0x15, 0x00, 0x20, 0x00, 0x42, 0x00, 0x66,
-    0x00, 0x33, 0x40, 0x19, 0x5c, 0x4f, 0x0b, 0x72, 0x55, 0x32, 0x32, 0x2c, 0x39, 0x0b, 0x72, 0x43,
-    0x44, 0x44, 0x11, 0x08, 0x08, 0x1b, 0x1b, 0x16, 0x16, 0x22, 0x21, 0x06, 0x72, 0x00, 0x2b, 0x32,
-    0x32, 0x7c, 0x2f, 0x33, 0x18, 0x2f, 0x33, 0x11, 0x33, 0x32, 0x11, 0x33, 0x2b, 0x32, 0x32, 0x2f,
-    0x33, 0x2b, 0x32, 0x30, 0x31, 0x41, 0x33, 0x15, 0x23, 0x22, 0x2e, 0x02, 0x23, 0x22, 0x06, 0x15,
-    0x15, 0x23, 0x35, 0x34, 0x36, 0x33, 0x32, 0x1e, 0x02, 0x01, 0x27, 0x36, 0x36, 0x35, 0x35, 0x33,
-    0x15, 0x14, 0x06, 0x06, 0x25, 0x15, 0x22, 0x06, 0x06, 0x15, 0x11, 0x14, 0x1e, 0x02, 0x33, 0x32,
-    0x3e, 0x02, 0x35, 0x35, 0x33, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x11, 0x34,
-    0x36, 0x36, 0x05, 0x35, 0x32, 0x1e, 0x02, 0x15, 0x11, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02,
-    0x35, 0x35, 0x33, 0x15, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x3e, 0x02, 0x35, 0x11, 0x34, 0x2e, 0x02,
-    0x04, 0xe7, 0x1c, 0x1e, 0x57, 0x7e, 0x63, 0x5b, 0x35, 0x49, 0x4c, 0x5c, 0x7e, 0x6f, 0x40, 0x67,
-    0x63, 0x76, 0xfe, 0x74, 0x30, 0x22, 0x24, 0x6a, 0x29, 0x3b, 0xfe, 0xcb, 0x44, 0x6d, 0x3e, 0x24,
-    0x40, 0x57, 0x34, 0x38, 0x5d, 0x45, 0x27, 0x65, 0x35, 0x61, 0x82, 0x4e, 0x4d, 0x83, 0x61, 0x36,
-    0x5d, 0xa3, 0x02, 0xdf, 0x4e, 0x83, 0x61, 0x35, 0x35, 0x61, 0x83, 0x4e, 0x4d, 0x82, 0x61, 0x35,
-    0x65, 0x27, 0x45, 0x5d, 0x37, 0x34, 0x58, 0x40, 0x24, 0x24, 0x40, 0x58, 0x05, 0x4c, 0x55, 0x2f,
-    0x3e, 0x2f, 0x52, 0x40, 0x12, 0x1f, 0x66, 0x79, 0x30, 0x40, 0x31, 0xfe, 0x98, 0x2e, 0x20, 0x42,
-    0x2d, 0x61, 0x66, 0x28, 0x49, 0x38, 0x54, 0x67, 0x48, 0x8d, 0x69, 0xfe, 0xee, 0x4e, 0x77, 0x50,
-    0x29, 0x27, 0x4b, 0x70, 0x4a, 0xf4, 0xf4, 0x65, 0x97, 0x65, 0x32, 0x34, 0x6a, 0x9e, 0x69, 0x01,
-    0x12, 0x8d, 0xbb, 0x5d, 0x67, 0x67, 0x34, 0x69, 0x9e, 0x6a, 0xfe, 0xee, 0x69, 0x9e, 0x6a, 0x34,
-    0x32, 0x65, 0x97, 0x65, 0xf4, 0xf4, 0x4a, 0x70, 0x4b, 0x27, 0x29, 0x50, 0x77, 0x4e, 0x01, 0x12,
-    0x4f, 0x77, 0x50, 0x28, 0x00, 0x03, 0x00, 0xab, 0xff, 0xec, 0x06, 0x70, 0x06, 0xf3, 0x00, 0x07,
-    0x00, 0x20, 0x00, 0x38, 0x00, 0x2b, 0x40, 0x15, 0x34, 0x27, 0x09, 0x72, 0x05, 0x02, 0x01, 0x01,
-    0x07, 0x07, 0x2d, 0x21, 0x08, 0x08, 0x15, 0x02, 0x72, 0x1c, 0x0f, 0x09, 0x72, 0x00, 0x2b, 0x32,
-    0x2b, 0x32, 0x11, 0x33, 0x33, 0x33, 0x7c, 0x2f, 0x33, 0x18, 0x2f, 0x33, 0x33, 0x2b, 0x32, 0x30,
-    0x31, 0x41, 0x21, 0x35, 0x21, 0x17, 0x21, 0x15, 0x23, 0x07, 0x33, 0x11, 0x14, 0x0e, 0x02, 0x23,
-    0x22, 0x2e, 0x02, 0x35, 0x11, 0x33, 0x11, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x36, 0x36, 0x35, 0x01,
-    0x33, 0x11, 0x14, 0x06, 0x06, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x11, 0x33, 0x11, 0x14, 0x1e, 0x02,
-    0x33, 0x32, 0x36, 0x36, 0x35, 0x03, 0x51, 0xfe, 0xc6, 0x02, 0xf3, 0x01, 0xfe, 0xb5, 0x6f, 0x03,
-    0x69, 0x3a, 0x69, 0x8e, 0x54, 0x54, 0x8f, 0x69, 0x3b, 0x7c, 0x27, 0x49, 0x61, 0x3a, 0x52, 0x81,
-    0x49, 0x02, 0xa6, 0x7c, 0x68, 0xb4, 0x73, 0x52, 0x8b, 0x67, 0x39, 0x69, 0x29, 0x4a, 0x65, 0x3c,
-    0x4f, 0x7d, 0x47, 0x06, 0xa1, 0x52, 0x52, 0x72, 0x7f, 0xfb, 0xee, 0x6d, 0xa3, 0x6c, 0x36, 0x36,
-    0x6c, 0xa3, 0x6d, 0x04, 0x12, 0xfb, 0xee, 0x51, 0x7b, 0x53, 0x2a, 0x4b, 0x92, 0x6c, 0x04, 0x12,
-    0xfb, 0xee, 0x91, 0xc2, 0x5f, 0x36, 0x6c, 0xa3, 0x6d, 0x04, 0x12, 0xfb, 0xee, 0x51, 0x7b, 0x53,
-    0x2a, 0x4b, 0x92, 0x6c, 0x00, 0x03, 0x00, 0x9d, 0xff, 0xeb, 0x05, 0xe4, 0x05, 0xb1, 0x00, 0x07,
-    0x00, 0x20, 0x00, 0x39, 0x00, 0x2b, 0x40, 0x15, 0x34, 0x27, 0x0b, 0x72, 0x05, 0x02, 0x01, 0x01,
-    0x07, 0x07, 0x2d, 0x21, 0x08, 0x08, 0x15, 0x06, 0x72, 0x1c, 0x0f, 0x0b, 0x72, 0x00, 0x2b, 0x32,
-    0x2b, 0x32, 0x11, 0x33, 0x33, 0x33, 0x7c, 0x2f, 0x33, 0x18, 0x2f, 0x33, 0x33, 0x2b, 0x32, 0x30,
-    0x31, 0x41, 0x21, 0x37, 0x21, 0x17, 0x21, 0x15, 0x23, 0x15, 0x33, 0x11, 0x14, 0x0e, 0x02, 0x23,
-    0x22, 0x2e, 0x02, 0x35, 0x11, 0x33, 0x11, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x36, 0x36, 0x35, 0x01,
-    0x33, 0x11, 0x14, 0x06, 0x06, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x11, 0x33, 0x11, 0x14, 0x1e, 0x02,
-    0x33, 0x32, 0x3e, 0x02, 0x35, 0x03, 0x04, 0xfe, 0xc5, 0x02, 0x02, 0xf3, 0x02, 0xfe, 0xb3, 0x6f,
-    0x66, 0x35, 0x61, 0x82, 0x4e, 0x4d, 0x83, 0x61, 0x36, 0x78, 0x24, 0x40, 0x57, 0x34, 0x4a, 0x73,
-    0x43, 0x02, 0x68, 0x78, 0x60, 0xa6, 0x69, 0x4c, 0x80, 0x5e, 0x34, 0x66, 0x25, 0x43, 0x5a, 0x36,
-    0x35, 0x5a, 0x43, 0x25, 0x05, 0x5f, 0x52, 0x52, 0x82, 0xa3, 0xfd, 0x44, 0x65, 0x97, 0x65, 0x32,
-    0x32, 0x65, 0x97, 0x65, 0x02, 0xbc, 0xfd, 0x44, 0x4a, 0x70, 0x4b, 0x27, 0x44, 0x86, 0x62, 0x02,
-    0xbc, 0xfd, 0x44, 0x87, 0xb3, 0x59, 0x32, 0x65, 0x97, 0x65, 0x02, 0xbc, 0xfd, 0x44, 0x4a, 0x70,
-    0x4b, 0x27, 0x27, 0x4b, 0x70, 0x4a, 0x00, 0x02, 0x00, 0x83, 0xfe, 0x93, 0x04, 0xac, 0x05, 0xc5,
-    0x00, 0x21, 0x00, 0x25, 0x00, 0x19, 0x40, 0x0c, 0x16, 0x12, 0x0d, 0x03, 0x72, 0x25, 0x00, 0x00,
-    0x24, 0x01, 0x09, 0x72, 0x00, 0x2b, 0xcd, 0x33, 0x11, 0x33, 0x2b, 0xcc, 0x33, 0x30, 0x31, 0x65,
-    0x15, 0x22, 0x2e, 0x03, 0x35, 0x35, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x16, 0x16, 0x17, 0x23, 0x2e,
-    0x02, 0x23, 0x22, 0x0e, 0x02, 0x15, 0x15, 0x14, 0x1e, 0x03, 0x33, 0x11, 0x23, 0x11, 0x02, 0xa1,
-    0x62, 0xa7, 0x85, 0x5e, 0x32, 0x4f, 0x92, 0xcc, 0x7c, 0x98, 0xe2, 0x81, 0x05, 0x7b, 0x08, 0x5c,
-    0xa8, 0x79, 0x62, 0x9f, 0x70, 0x3c, 0x26, 0x47, 0x66, 0x82, 0x9d, 0x7b, 0x55, 0x6a, 0x40, 0x77,
-    0xa5, 0xce, 0x76, 0xa4, 0x92, 0xf2, 0xb1, 0x61, 0x6e, 0xd5, 0x99, 0x76, 0xa5, 0x57, 0x52, 0x94,
-    0xcb, 0x79, 0xa6, 0x63, 0xad, 0x8c, 0x64, 0x36, 0xfe, 0x3e, 0x01, 0xc2, 0x00, 0x02, 0x00, 0x6f,
-    0xfe, 0x92, 0x03, 0xd4, 0x04, 0x4e, 0x00, 0x1f, 0x00, 0x23, 0x00, 0x19, 0x40, 0x0c, 0x15, 0x11,
-    0x0c, 0x07, 0x72, 0x20, 0x00, 0x00, 0x22, 0x01, 0x0b, 0x72, 0x00, 0x2b, 0xcd, 0x33, 0x11, 0x33,
-    0x2b, 0xcc, 0x33, 0x30, 0x31, 0x65, 0x15, 0x22, 0x2e, 0x02, 0x35, 0x35, 0x34, 0x3e, 0x02, 0x33,
-    0x32, 0x16, 0x16, 0x15, 0x23, 0x34, 0x26, 0x26, 0x23, 0x22, 0x0e, 0x02, 0x15, 0x15, 0x14, 0x1e,
-    0x02, 0x33, 0x11, 0x23, 0x11, 0x02, 0x3e, 0x6d, 0xab, 0x78, 0x3f, 0x3f, 0x77, 0xac, 0x6c, 0x71,
-    0xb8, 0x6e, 0x73, 0x50, 0x84, 0x50, 0x57, 0x81, 0x54, 0x29, 0x29, 0x54, 0x81, 0xa2, 0x77, 0x52,
-    0x67, 0x53, 0x94, 0xc4, 0x72, 0x2a, 0x72, 0xc5, 0x93, 0x52, 0x5d, 0xad, 0x79, 0x5a, 0x7f, 0x43,
-    0x47, 0x7b, 0x9d, 0x56, 0x2a, 0x56, 0x9e, 0x7b, 0x47, 0xfe, 0x40, 0x01, 0xc0, 0x00, 0x00, 0x01,
-    0x00, 0x88, 0x00, 0x00, 0x04, 0x7a, 0x05, 0x3e, 0x00, 0x13, 0x00, 0x08, 0xb1, 0x0f, 0x05, 0x00,
-    0x2f, 0x2f, 0x30, 0x31, 0x41, 0x03, 0x05, 0x07, 0x25, 0x03, 0x23, 0x13, 0x25, 0x37, 0x05, 0x13,
-    0x25, 0x37, 0x05, 0x13, 0x33, 0x03, 0x05, 0x07, 0x03, 0x20, 0xde, 0x01, 0x21, 0x36, 0xfe, 0xdd,
-    0xbb, 0x87, 0xe1, 0xfe, 0xdf, 0x35, 0x01, 0x25, 0xdc, 0xfe, 0xde, 0x37, 0x01, 0x23, 0xcb, 0x84,
-    0xf0, 0x01, 0x25, 0x3a, 0x03, 0x39, 0xfe, 0x78, 0xac, 0x60, 0xaa, 0xfe, 0xb1, 0x01, 0x8e, 0xab,
-    0x60, 0xab, 0x01, 0x88, 0xab, 0x62, 0xab, 0x01, 0x66, 0xfe, 0x5b, 0xab, 0x5f, 0x00, 0x00, 0x01,
-    0xfc, 0xa2, 0x04, 0xc0, 0xff, 0x0f, 0x05, 0xf7, 0x00, 0x07, 0x00, 0x15, 0xb7, 0x06, 0x06, 0x04,
-    0x04, 0x01, 0x02, 0x02, 0x01, 0x00, 0x2f, 0x33, 0x2f, 0x11, 0x33, 0x11, 0x33, 0x7c, 0x2f, 0x30,
-    0x31, 0x43, 0x21, 0x15, 0x23, 0x37, 0x21, 0x35, 0x33, 0xf1, 0xfe, 0x03, 0x70, 0x01, 0x01, 0xfe,
-    0x6e, 0x05, 0x3b, 0x7b, 0xcb, 0x6c, 0x00, 0x01, 0xfc, 0x7f, 0x05, 0x17, 0xff, 0x56, 0x06, 0x15,
-    0x00, 0x15, 0x00, 0x12, 0xb6, 0x01, 0x14, 0x14, 0x0f, 0x06, 0x80, 0x0b, 0x00, 0x2f, 0x1a, 0xcc,
-    0x32, 0x33, 0x11, 0x33, 0x30, 0x31, 0x41, 0x33, 0x32, 0x3e, 0x02, 0x33, 0x32, 0x16, 0x15, 0x15,
-    0x23, 0x35, 0x34, 0x26, 0x23, 0x22, 0x0e, 0x02, 0x23, 0x23, 0xfc, 0x7f, 0x1c, 0x4f, 0x75, 0x63,
-    0x67, 0x40, 0x6f, 0x7e, 0x5c, 0x4b, 0x4a, 0x35, 0x5b, 0x63, 0x7e, 0x57, 0x1e, 0x05, 0x74, 0x31,
-    0x40, 0x30, 0x79, 0x66, 0x1f, 0x12, 0x40, 0x52, 0x2f, 0x3e, 0x2f, 0x00, 0x00, 0x01, 0xfd, 0x74,
-    0x05, 0x2e, 0xfe, 0x3c, 0x06, 0x61, 0x00, 0x05, 0x00, 0x0a, 0xb2, 0x00, 0x80, 0x02, 0x00, 0x2f,
-    0x1a, 0xcd, 0x30, 0x31, 0x41, 0x27, 0x35, 0x33, 0x15, 0x17, 0xfe, 0x03, 0x8f, 0x8a, 0x3e, 0x05,
-    0x2e, 0xae, 0x85, 0x8b, 0x79, 0x00, 0x00, 0x01, 0xfd, 0xa7, 0x05, 0x2e, 0xfe, 0x6f, 0x06, 0x61,
-    0x00, 0x05, 0x00, 0x0a, 0xb2, 0x01, 0x80, 0x04, 0x00, 0x2f, 0x1a, 0xcd, 0x30, 0x31, 0x41, 0x07,
-    0x27, 0x37, 0x35, 0x33, 0xfe, 0x6f, 0x90, 0x38, 0x3d, 0x8b, 0x05, 0xdc, 0xae, 0x2f, 0x79, 0x8b,
-    0x00, 0x08, 0xfa, 0x1f, 0xfe, 0xc4, 0x01, 0xbb, 0x05, 0xaf, 0x00, 0x0d, 0x00, 0x1b, 0x00, 0x29,
-    0x00, 0x37, 0x00, 0x45, 0x00, 0x53, 0x00, 0x61, 0x00, 0x6f, 0x00, 0x00, 0x41, 0x23, 0x34, 0x36,
-    0x33, 0x32, 0x16, 0x15, 0x23, 0x34, 0x26, 0x23, 0x22, 0x06, 0x01, 0x23, 0x34, 0x36, 0x33, 0x32,
-    0x16, 0x15, 0x23, 0x34, 0x26, 0x23, 0x22, 0x06, 0x13, 0x23, 0x34, 0x36, 0x33, 0x32, 0x16, 0x15,
-    0x23, 0x34, 0x26, 0x23, 0x22, 0x06, 0x03, 0x23, 0x34, 0x36, 0x33, 0x32, 0x16, 0x15, 0x23, 0x34,
-    0x26, 0x23, 0x22, 0x06, 0x01, 0x23, 0x34, 0x36, 0x33, 0x32, 0x16, 0x15, 0x23, 0x34, 0x26, 0x23,
-    0x22, 0x06, 0x01, 0x23, 0x34, 0x36, 0x33, 0x32, 0x16, 0x15, 0x23, 0x34, 0x26, 0x23, 0x22, 0x06,
-    0x03, 0x23, 0x34, 0x36, 0x33, 0x32, 0x16, 0x15, 0x23, 0x34, 0x26, 0x23, 0x22, 0x06, 0x13, 0x23,
-    0x34, 0x36, 0x33, 0x32, 0x16, 0x15, 0x23, 0x34, 0x26, 0x23, 0x22, 0x06, 0xfd, 0x7d, 0x71, 0x71,
-    0x61, 0x62, 0x71, 0x70, 0x2d, 0x36, 0x35, 0x2c, 0x02, 0x50, 0x72, 0x71, 0x61, 0x62, 0x72, 0x71,
-    0x2c, 0x37, 0x34, 0x2c, 0xba, 0x71, 0x71, 0x61, 0x62, 0x71, 0x70, 0x2c, 0x37, 0x34, 0x2d, 0xc5,
-    0x71, 0x71, 0x61, 0x62, 0x71, 0x70, 0x2c, 0x37, 0x34, 0x2d, 0xfd, 0xc0, 0x71, 0x71, 0x61, 0x62,
-    0x71, 0x70, 0x2d, 0x36, 0x34, 0x2d, 0xfd, 0xbf, 0x72, 0x72, 0x61, 0x62, 0x71, 0x70, 0x2d, 0x36,
-    0x35, 0x2c, 0xb1, 0x71, 0x71, 0x61, 0x62, 0x71, 0x70, 0x2c, 0x37, 0x34, 0x2d, 0xa7, 0x72, 0x71,
-    0x61, 0x62, 0x72, 0x71, 0x2c, 0x37, 0x34, 0x2c, 0x04, 0xf3, 0x53, 0x69, 0x69, 0x53, 0x28, 0x3d,
-    0x3d, 0xfe, 0xc3, 0x53, 0x69, 0x69, 0x53, 0x28, 0x3d, 0x3d, 0xfd, 0xe1, 0x53, 0x69, 0x69, 0x53,
-    0x28, 0x3d, 0x3d, 0xfd, 0xd1, 0x53, 0x69, 0x69, 0x53, 0x28, 0x3d, 0x3d, 0xfe, 0xbc, 0x53, 0x69,
-    0x69, 0x53, 0x28, 0x3d, 0x3d, 0x04, 0xf2, 0x53, 0x69, 0x69, 0x53, 0x28, 0x3d, 0x3d, 0xfd, 0xe1,
-    0x53, 0x69, 0x69, 0x53, 0x28, 0x3d, 0x3d, 0xfd, 0xd1, 0x53, 0x69, 0x69, 0x53, 0x28, 0x3d, 0x3d,
-    0x00, 0x08, 0xfa, 0x28, 0xfe, 0x63, 0x01, 0x68, 0x05, 0xc6, 0x00, 0x04, 0x00, 0x09, 0x00, 0x0e,
-    0x00, 0x13, 0x00, 0x18, 0x00, 0x1d, 0x00, 0x22, 0x00, 0x27, 0x00, 0x00, 0x45, 0x33, 0x17, 0x03,
-    0x23, 0x13, 0x23, 0x27, 0x13, 0x33, 0x01, 0x35, 0x37, 0x05, 0x15, 0x25, 0x15, 0x07, 0x25, 0x35,
-    0x01, 0x27, 0x37, 0x25, 0x17, 0x01, 0x17, 0x07, 0x05, 0x27, 0x01, 0x07, 0x27, 0x03, 0x37, 0x01,
-    0x37, 0x17, 0x13, 0x07, 0xfd, 0xa2, 0x89, 0x0b, 0x7a, 0x60, 0x94, 0x88, 0x0c, 0x7a, 0x60, 0x01,
-    0xd8, 0x0d, 0x01, 0x4d, 0xfa, 0x1a, 0x0d, 0xfe, 0xb3, 0x05, 0x57, 0x61, 0x02, 0x01, 0x41, 0x44,
-    0xfb, 0x6c, 0x61, 0x02, 0xfe, 0xc0, 0x45, 0x01, 0x5d, 0x62, 0x11, 0x94, 0x41, 0x03, 0xc5, 0x61,
-    0x11, 0x95, 0x42, 0x3c, 0x0e, 0xfe, 0xad, 0x06, 0x03, 0x0e, 0x01, 0x52, 0xfc, 0x26, 0x8b, 0x0c,
-    0x7c, 0x62, 0x97, 0x8b, 0x0c, 0x7c, 0x62, 0x01, 0x04, 0x63, 0x10, 0x99, 0x44, 0xfc, 0x29, 0x63,
-    0x11, 0x99, 0x45, 0x04, 0x0e, 0x62, 0x02, 0x01, 0x46, 0x45, 0xfb, 0x55, 0x63, 0x02, 0xfe, 0xbb,
-    0x47, 0x00, 0xff, 0xff, 0x00, 0xbd, 0xfe, 0xc1, 0x05, 0x65, 0x07, 0x16, 0x04, 0x26, 0x00, 0xdc,
-    0x00, 0x00, 0x00, 0x27, 0x00, 0xa1, 0x01, 0x33, 0x01, 0x43, 0x01, 0x07, 0x00, 0x10, 0x04, 0x55,
-    0xff, 0xd2, 0x00, 0x15, 0x40, 0x0e, 0x02, 0x23, 0x04, 0x00, 0x00, 0x98, 0x56, 0x01, 0x0f, 0x01,
-    0x01, 0x01, 0x5e, 0x56, 0x00, 0x2b, 0x34, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0xa5, 0xfe, 0xc1,
-    0x04, 0x51, 0x05, 0xbf, 0x04, 0x26, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x27, 0x00, 0xa1, 0x00, 0x91,
-    0xff, 0xec, 0x01, 0x07, 0x00, 0x10, 0x03, 0x41, 0xff, 0xd2, 0x00, 0x15, 0x40, 0x0e, 0x02, 0x23,
-    0x04, 0x01, 0x00, 0x98, 0x56, 0x01, 0x0f, 0x01, 0x01, 0x01, 0x7d, 0x56, 0x00, 0x2b, 0x34, 0x2b,
-    0x34, 0x00, 0x00, 0x02, 0xff, 0xe2, 0x00, 0x00, 0x03, 0xe2, 0x06, 0x64, 0x00, 0x17, 0x00, 0x1b,
-    0x00, 0x1a, 0x40, 0x0c, 0x1a, 0x0b, 0x1b, 0x02, 0x72, 0x00, 0x17, 0x17, 0x0d, 0x0d, 0x0a, 0x12,
-    0x00, 0x3f, 0x33, 0x11, 0x33, 0x2f, 0x33, 0x2b, 0xce, 0x33, 0x30, 0x31, 0x53, 0x21, 0x32, 0x16,
-    0x16, 0x15, 0x14, 0x06, 0x06, 0x23, 0x21, 0x11, 0x33, 0x11, 0x21, 0x32, 0x36, 0x36, 0x35, 0x34,
-    0x26, 0x26, 0x23, 0x21, 0x01, 0x15, 0x21, 0x35, 0xf6, 0x01, 0x60, 0x81, 0xb0, 0x5b, 0x5b, 0xb0,
-    0x81, 0xfe, 0x53, 0x77, 0x01, 0x36, 0x63, 0x7a, 0x37, 0x37, 0x7a, 0x63, 0xfe, 0xa0, 0x01, 0x70,
-    0xfd, 0x7c, 0x02, 0xc4, 0x5b, 0x9f, 0x66, 0x65, 0xa1, 0x5e, 0x06, 0x64, 0xfa, 0x03, 0x48, 0x72,
-    0x41, 0x3e, 0x73, 0x4b, 0x03, 0x52, 0x67, 0x67, 0x00, 0x02, 0x00, 0xb5, 0x00, 0x00, 0x04, 0x8f,
-    0x05, 0xb0, 0x00, 0x03, 0x00, 0x1b, 0x00, 0x23, 0x40, 0x11, 0x01, 0x02, 0x05, 0x00, 0x03, 0x06,
-    0x06, 0x05, 0x05, 0x12, 0x10, 0x13, 0x02, 0x72, 0x12, 0x08, 0x72, 0x00, 0x2b, 0x2b, 0x32, 0x11,
-    0x39, 0x2f, 0x33, 0x11, 0x33, 0x33, 0x11, 0x33, 0x33, 0x30, 0x31, 0x41, 0x01, 0x07, 0x01, 0x03,
-    0x21, 0x35, 0x21, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x21, 0x11, 0x23, 0x11, 0x21,
-    0x32, 0x16, 0x16, 0x15, 0x14, 0x06, 0x06, 0x03, 0x3c, 0x01, 0x4f, 0x4c, 0xfe, 0xb2, 0x4c, 0xfe,
-    0x61, 0x01, 0x9f, 0x82, 0xa2, 0x4b, 0x4b, 0xa2, 0x82, 0xfe, 0x8b, 0x7b, 0x01, 0xf0, 0xa0, 0xda,
-    0x70, 0x6f, 0xda, 0x03, 0xa9, 0xfe, 0x85, 0x44, 0x01, 0x7a, 0xfe, 0xed, 0x6a, 0x54, 0x92, 0x5b,
-    0x59, 0x96, 0x5b, 0xfa, 0xba, 0x05, 0xb0, 0x6e, 0xc4, 0x80, 0x86, 0xc1, 0x66, 0x00, 0x00, 0x04,
-    0x00, 0x9b, 0xfe, 0x60, 0x04, 0x03, 0x04, 0x4e, 0x00, 0x03, 0x00, 0x08, 0x00, 0x1e, 0x00, 0x34,
-    0x00, 0x25, 0x40, 0x14, 0x00, 0x03, 0x30, 0x01, 0x02, 0x30, 0x25, 0x1a, 0x0f, 0x0b, 0x72, 0x07,
-    0x06, 0x72, 0x1a, 0x07, 0x72, 0x06, 0x0e, 0x72, 0x00, 0x2b, 0x2b, 0x2b, 0x2b, 0x11, 0x33, 0x32,
-    0x32, 0x32, 0x11, 0x33, 0x33, 0x30, 0x31, 0x41, 0x01, 0x07, 0x01, 0x01, 0x11, 0x23, 0x11, 0x33,
-    0x01, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x27, 0x11, 0x3e, 0x03, 0x33, 0x32, 0x1e,
-    0x02, 0x07, 0x35, 0x34, 0x2e, 0x02, 0x23, 0x22, 0x0e, 0x02, 0x07, 0x11, 0x1e, 0x03, 0x33, 0x32,
-    0x3e, 0x02, 0x02, 0xd1, 0x01, 0x22, 0x4d, 0xfe, 0xde, 0xfe, 0x8f, 0x78, 0x70, 0x02, 0xf8, 0x37,
-    0x6a, 0x99, 0x63, 0x61, 0x98, 0x6c, 0x42, 0x0c, 0x0f, 0x44, 0x6a, 0x95, 0x5f, 0x63, 0x9b, 0x6a,
-    0x37, 0x78, 0x27, 0x4f, 0x79, 0x53, 0x56, 0x79, 0x4f, 0x2e, 0x0b, 0x0e, 0x36, 0x53, 0x75, 0x4d,
-    0x52, 0x78, 0x4f, 0x27, 0x01, 0x50, 0xfe, 0x98, 0x44, 0x01, 0x68, 0x02, 0x5e, 0xfa, 0xf6, 0x05,
-    0xda, 0xfd, 0xed, 0x15, 0x79, 0xc9, 0x93, 0x51, 0x3c, 0x6f, 0x96, 0x59, 0x01, 0x14, 0x62, 0xa0,
-    0x74, 0x3e, 0x4d, 0x91, 0xcb, 0x93, 0x15, 0x5f, 0xa2, 0x79, 0x44, 0x39, 0x5d, 0x6e, 0x35, 0xfe,
-    0xc1, 0x39, 0x66, 0x4e, 0x2d, 0x45, 0x79, 0xa3, 0x00, 0x02, 0x00, 0xb2, 0x00, 0x00, 0x04, 0x22,
-    0x07, 0x12, 0x00, 0x03, 0x00, 0x09, 0x00, 0x15, 0x40, 0x0a, 0x02, 0x06, 0x06, 0x03, 0x09, 0x02,
-    0x72, 0x08, 0x08, 0x72, 0x00, 0x2b, 0x2b, 0xce, 0x33, 0x11, 0x33, 0x30, 0x31, 0x41, 0x11, 0x23,
-    0x11, 0x13, 0x15, 0x21, 0x11, 0x23, 0x11, 0x04, 0x22, 0x78, 0x76, 0xfd, 0x0d, 0x7b, 0x07, 0x12,
-    0xfe, 0x37, 0x01, 0xc9, 0xfe, 0x9e, 0x6a, 0xfa, 0xba, 0x05, 0xb0, 0x00, 0x00, 0x02, 0x00, 0x9f,
-    0x00, 0x00, 0x03, 0x3e, 0x05, 0x93, 0x00, 0x03, 0x00, 0x09, 0x00, 0x15, 0x40, 0x0a, 0x02, 0x06,
-    0x06, 0x03, 0x09, 0x06, 0x72, 0x08, 0x0a, 0x72, 0x00, 0x2b, 0x2b, 0xce, 0x33, 0x11, 0x33, 0x30,
-    0x31, 0x41, 0x11, 0x23, 0x11, 0x13, 0x15, 0x21, 0x11, 0x23, 0x11, 0x03, 0x3e, 0x78, 0x75, 0xfd,
-    0xdc, 0x78, 0x05, 0x93, 0xfe, 0x3f, 0x01, 0xc1, 0xfe, 0xa7, 0x68, 0xfc, 0x2e, 0x04, 0x3a, 0x00,
-    0x00, 0x02, 0x00, 0xba, 0xfe, 0xe4, 0x04, 0x49, 0x05, 0xb0, 0x00, 0x05, 0x00, 0x1d, 0x00, 0x19,
-    0x40, 0x0c, 0x06, 0x07, 0x07, 0x13, 0x12, 0x02, 0x05, 0x02, 0x72, 0x04, 0x08, 0x72, 0x00, 0x2b,
-    0x2b, 0x32, 0x2f, 0x33, 0x39, 0x2f, 0x33, 0x30, 0x31, 0x41, 0x15, 0x21, 0x11, 0x23, 0x11, 0x13,
-    0x35, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x27, 0x32, 0x3e, 0x02, 0x35, 0x34,
-    0x2e, 0x02, 0x23, 0x04, 0x28, 0xfd, 0x0d, 0x7b, 0x65, 0xe7, 0x82, 0xd4, 0x9a, 0x53, 0x37, 0x70,
-    0xac, 0x76, 0x01, 0x59, 0x80, 0x52, 0x27, 0x41, 0x78, 0xa9, 0x69, 0x05, 0xb0, 0x6a, 0xfa, 0xba,
-    0x05, 0xb0, 0xfd, 0x21, 0x6b, 0x45, 0x8c, 0xd7, 0x93, 0x69, 0xc3, 0x98, 0x59, 0x63, 0x47, 0x7b,
-    0xa0, 0x58, 0x77, 0xaf, 0x73, 0x37, 0x00, 0x02, 0x00, 0x9f, 0xfe, 0xf3, 0x03, 0xab, 0x04, 0x3a,
-    0x00, 0x14, 0x00, 0x1a, 0x00, 0x1b, 0x40, 0x0d, 0x00, 0x01, 0x01, 0x0b, 0x17, 0x1a, 0x06, 0x72,
-    0x19, 0x0a, 0x72, 0x0c, 0x0b, 0x00, 0x2f, 0x33, 0x2b, 0x2b, 0x32, 0x11, 0x39, 0x2f, 0x33, 0x30,
-    0x31, 0x53, 0x35, 0x33, 0x32, 0x16, 0x16, 0x15, 0x14, 0x0e, 0x02, 0x07, 0x27, 0x3e, 0x02, 0x37,
-    0x36, 0x26, 0x26, 0x23, 0x01, 0x15, 0x21, 0x11, 0x23, 0x11, 0xba, 0xed, 0x93, 0xea, 0x87, 0x25,
-    0x56, 0x90, 0x6c, 0x20, 0x6f, 0x7c, 0x33, 0x01, 0x02, 0x68, 0xb5, 0x71, 0x01, 0x94, 0xfd, 0xdc,
-    0x78, 0x02, 0x07, 0x6b, 0x63, 0xcc, 0x9d, 0x34, 0x85, 0x82, 0x64, 0x14, 0x5e, 0x19, 0x6d, 0x8b,
-    0x44, 0x79, 0x9c, 0x4c, 0x02, 0x33, 0x68, 0xfc, 0x2e, 0x04, 0x3a, 0x00, 0xff, 0xff, 0x00, 0x17,
-    0xfe, 0x9d, 0x07, 0x21, 0x05, 0xb0, 0x04, 0x26, 0x00, 0xda, 0x00, 0x00, 0x01, 0x07, 0x02, 0x6b,
-    0x06, 0x1b, 0x00, 0x00, 0x00, 0x0b, 0xb6, 0x05, 0x1b, 0x0c, 0x00, 0x00, 0x9a, 0x56, 0x00, 0x2b,
-    0x34, 0x00, 0xff, 0xff, 0x00, 0x19, 0xfe, 0x9d, 0x06, 0x1c, 0x04, 0x3a, 0x04, 0x26, 0x00, 0xee,
-    0x00, 0x00, 0x01, 0x07, 0x02, 0x6b, 0x05, 0x15, 0x00, 0x00, 0x00, 0x0b, 0xb6, 0x05, 0x1b, 0x0c,
-    0x00, 0x00, 0x9a, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0xbd, 0xfe, 0x8a, 0x05, 0x0b,
-    0x05, 0xb0, 0x04, 0x26, 0x02, 0x46, 0x00, 0x00, 0x00, 0x07, 0x02, 0x6b, 0x04, 0x05, 0xff, 0xed,
-    0xff, 0xff, 0x00, 0xa4, 0xfe, 0x9d, 0x04, 0x35, 0x04, 0x3a, 0x04, 0x26, 0x00, 0xf1, 0x00, 0x00,
-    0x01, 0x07, 0x02, 0x6b, 0x03, 0x2f, 0x00, 0x00, 0x00, 0x0b, 0xb6, 0x03, 0x11, 0x02, 0x01, 0x00,
-    0x9a, 0x56, 0x00, 0x2b, 0x34, 0x00, 0x00, 0x04, 0x00, 0xb4, 0x00, 0x00, 0x04, 0xd4, 0x05, 0xb0,
-    0x00, 0x03, 0x00, 0x07, 0x00, 0x0d, 0x00, 0x11, 0x00, 0x2f, 0x40, 0x17, 0x0f, 0x0e, 0x0e, 0x0b,
-    0x0c, 0x04, 0x04, 0x0c, 0x0c, 0x0b, 0x07, 0x07, 0x0b, 0x0b, 0x00, 0x10, 0x03, 0x08, 0x72, 0x08,
-    0x00, 0x02, 0x72, 0x00, 0x2b, 0x32, 0x2b, 0x32, 0x12, 0x39, 0x2f, 0x33, 0x2f, 0x11, 0x33, 0x11,
-    0x33, 0x2f, 0x11, 0x12, 0x39, 0x11, 0x33, 0x30, 0x31, 0x53, 0x33, 0x11, 0x23, 0x01, 0x33, 0x11,
-    0x23, 0x01, 0x33, 0x01, 0x21, 0x27, 0x21, 0x07, 0x37, 0x01, 0x23, 0xb4, 0x7b, 0x7b, 0x01, 0x0c,
-    0x66, 0x66, 0x02, 0x43, 0x95, 0xfe, 0x27, 0xfe, 0x3f, 0x0b, 0x01, 0x94, 0x0e, 0x4a, 0x02, 0x11,
-    0x9c, 0x05, 0xb0, 0xfa, 0x50, 0x04, 0x35, 0xfd, 0x5f, 0x04, 0x1c, 0xfd, 0x00, 0x6b, 0x5d, 0x6b,
-    0xfc, 0xd7, 0x00, 0x04, 0x00, 0xa3, 0x00, 0x00, 0x04, 0x40, 0x04, 0x3a, 0x00, 0x03, 0x00, 0x07,
-    0x00, 0x0d, 0x00, 0x11, 0x00, 0x2d, 0x40, 0x16, 0x0f, 0x0e, 0x0e, 0x0b, 0x04, 0x04, 0x0c, 0x0c,
-    0x0b, 0x07, 0x07, 0x0b, 0x0b, 0x00, 0x10, 0x03, 0x0a, 0x72, 0x09, 0x00, 0x06, 0x72, 0x00, 0x2b,
-    0x32, 0x2b, 0x32, 0x12, 0x39, 0x2f, 0x33, 0x2f, 0x11, 0x33, 0x11, 0x33, 0x2f, 0x11, 0x33, 0x11,
-    0x33, 0x30, 0x31, 0x53, 0x33, 0x11, 0x23, 0x01, 0x33, 0x11, 0x23, 0x01, 0x33, 0x01, 0x21, 0x27,
-    0x21, 0x07, 0x37, 0x01, 0x23, 0xa3, 0x78, 0x78, 0x01, 0x01, 0x66, 0x66, 0x01, 0xd3, 0x97, 0xfe,
-    0x7b, 0xfe, 0x68, 0x0c, 0x01, 0x71, 0x0b, 0x4b, 0x01, 0xaa, 0x9e, 0x04, 0x3a, 0xfb, 0xc6, 0x03,
-    0x4c, 0xfd, 0xb7, 0x03, 0x37, 0xfd, 0xb6, 0x6b, 0x5b, 0x5c, 0xfd, 0xa4, 0x00, 0x04, 0x00, 0x52,
-    0x00, 0x00, 0x06, 0x71, 0x05, 0xb0, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0d, 0x00, 0x11, 0x00, 0x23,
-    0x40, 0x11, 0x10, 0x0f, 0x0f, 0x0b, 0x0a, 0x0a, 0x03, 0x0e, 0x06, 0x08, 0x72, 0x0d, 0x07, 0x02,
-    0x03, 0x02, 0x72, 0x00, 0x2b, 0x32, 0x32, 0x32, 0x2b, 0x32, 0x12, 0x39, 0x2f, 0x33, 0x33, 0x11,
-    0x33, 0x30, 0x31, 0x41, 0x15, 0x21, 0x35, 0x21, 0x11, 0x23, 0x11, 0x21, 0x01, 0x21, 0x27, 0x33,
-    0x01, 0x13, 0x01, 0x37, 0x01, 0x02, 0x6f, 0xfd, 0xe3, 0x02, 0x63, 0x7b, 0x04, 0x0b, 0xfd, 0x79,
-    0xfe, 0xc5, 0x0a, 0xfe, 0x02, 0x33, 0x2d, 0xfd, 0x9a, 0x47, 0x02, 0xb9, 0x05, 0xb0, 0x67, 0x67,
-    0xfa, 0x50, 0x05, 0xb0, 0xfc, 0xfb, 0x6b, 0x02, 0x9a, 0xfa, 0x50, 0x02, 0xb9, 0x6c, 0xfc, 0xdb,
-    0x00, 0x04, 0x00, 0x34, 0x00, 0x00, 0x05, 0x36, 0x04, 0x3a, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0d,
-    0x00, 0x11, 0x00, 0x23, 0x40, 0x11, 0x10, 0x0f, 0x0f, 0x0b, 0x0a, 0x0a, 0x03, 0x0e, 0x06, 0x0a,
-    0x72, 0x0d, 0x07, 0x02, 0x03, 0x06, 0x72, 0x00, 0x2b, 0x32, 0x32, 0x32, 0x2b, 0x32, 0x12, 0x39,
-    0x2f, 0x33, 0x33, 0x11, 0x33, 0x30, 0x31, 0x41, 0x15, 0x21, 0x35, 0x21, 0x11, 0x23, 0x11, 0x21,
-    0x01, 0x21, 0x27, 0x33, 0x01, 0x13, 0x01, 0x37, 0x01, 0x01, 0xfa, 0xfe, 0x3a, 0x02, 0x08, 0x78,
-    0x03, 0x40, 0xfe, 0x10, 0xfe, 0xfe, 0x0d, 0xdc, 0x01, 0x8c, 0x2b, 0xfe, 0x3e, 0x4b, 0x02, 0x15,
-    0x04, 0x3a, 0x67, 0x67, 0xfb, 0xc6, 0x04, 0x3a, 0xfd, 0xb6, 0x6b, 0x01, 0xdf, 0xfb, 0xc6, 0x02,
-    0x00, 0x5c, 0xfd, 0xa4, 0xff, 0xff, 0x00, 0xb9, 0xfe, 0x9d, 0x05, 0x5b, 0x05, 0xb0, 0x04, 0x26,
-    0x00, 0x2c, 0x00, 0x00, 0x01, 0x07, 0x02, 0x6b, 0x04, 0x54, 0x00, 0x00, 0x00, 0x0b, 0xb6, 0x03,
-    0x0f, 0x0a, 0x00, 0x00, 0x9a, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0xa5, 0xfe, 0x9d,
-    0x04, 0x46, 0x04, 0x3a, 0x04, 0x26, 0x00, 0xf4, 0x00, 0x00, 0x01, 0x07, 0x02, 0x6b, 0x03, 0x40,
-    0x00, 0x00, 0x00, 0x0b, 0xb6, 0x03, 0x0f, 0x0a, 0x00, 0x00, 0x9a, 0x56, 0x00, 0x2b, 0x34, 0x00,
-    0x00, 0x04, 0x00, 0xb6, 0x00, 0x00, 0x07, 0xc0, 0x05, 0xb0, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0b,
-    0x00, 0x0f, 0x00, 0x1f, 0x40, 0x0f, 0x07, 0x06, 0x06, 0x0a, 0x02, 0x03, 0x03, 0x0c, 0x0b, 0x02,
-    0x72, 0x0d, 0x0a, 0x08, 0x72, 0x00, 0x2b, 0x32, 0x2b, 0x32, 0x32, 0x11, 0x33, 0x11, 0x39, 0x2f,
-    0x33, 0x30, 0x31, 0x41, 0x15, 0x21, 0x27, 0x03, 0x15, 0x21, 0x35, 0x13, 0x11, 0x23, 0x11, 0x21,
-    0x11, 0x23, 0x11, 0x07, 0xc0, 0xfd, 0x26, 0x4c, 0x11, 0xfc, 0x8c, 0x1d, 0x7c, 0x04, 0x37, 0x7c,
-    0x05, 0xb0, 0x67, 0x67, 0xfd, 0x73, 0x69, 0x69, 0x02, 0x8d, 0xfa, 0x50, 0x05, 0xb0, 0xfa, 0x50,
-    0x05, 0xb0, 0x00, 0x04, 0x00, 0x9f, 0x00, 0x00, 0x05, 0x83, 0x04, 0x3a, 0x00, 0x03, 0x00, 0x07,
-    0x00, 0x0b, 0x00, 0x0f, 0x00, 0x1f, 0x40, 0x0f, 0x07, 0x06, 0x06, 0x0a, 0x02, 0x03, 0x03, 0x0c,
-    0x0b, 0x06, 0x72, 0x0d, 0x0a, 0x0a, 0x72, 0x00, 0x2b, 0x32, 0x2b, 0x32, 0x32, 0x11, 0x33, 0x11,
-    0x39, 0x2f, 0x33, 0x30, 0x31, 0x41, 0x15, 0x21, 0x37, 0x03, 0x15, 0x21, 0x35, 0x13, 0x11, 0x23,
-    0x11, 0x21, 0x11, 0x23, 0x11, 0x05, 0x83, 0xfe, 0x1a, 0x01, 0x24, 0xfd, 0x7e, 0x1f, 0x78, 0x03,
-    0x37, 0x78, 0x04, 0x3a, 0x68, 0x68, 0xfe, 0x1c, 0x66, 0x66, 0x01, 0xe4, 0xfb, 0xc6, 0x04, 0x3a,
-    0xfb, 0xc6, 0x04, 0x3a, 0x00, 0x02, 0x00, 0xb2, 0xfe, 0xec, 0x07, 0xca, 0x05, 0xb0, 0x00, 0x07,
-    0x00, 0x1f, 0x00, 0x19, 0x40, 0x0c, 0x08, 0x09, 0x09, 0x14, 0x04, 0x07, 0x02, 0x72, 0x06, 0x08,
-    0x72, 0x02, 0x00, 0x2f, 0x2b, 0x2b, 0x32, 0x2f, 0x39, 0x2f, 0x33, 0x30, 0x31, 0x41, 0x11, 0x23,
-    0x11, 0x21, 0x11, 0x23, 0x11, 0x01, 0x35, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x14, 0x0e, 0x02, 0x23,
-    0x27, 0x32, 0x3e, 0x02, 0x35, 0x2e, 0x03, 0x23, 0x04, 0xe0, 0x7b, 0xfc, 0xc8, 0x7b, 0x03, 0xee,
-    0xe8, 0x82, 0xd4, 0x9a, 0x52, 0x36, 0x70, 0xac, 0x76, 0x01, 0x58, 0x80, 0x52, 0x28, 0x01, 0x40,
-    0x79, 0xa8, 0x69, 0x05, 0xb0, 0xfa, 0x50, 0x05, 0x46, 0xfa, 0xba, 0x05, 0xb0, 0xfd, 0x29, 0x6b,
-    0x45, 0x8d, 0xd7, 0x92, 0x6a, 0xc2, 0x99, 0x58, 0x63, 0x47, 0x7b, 0x9f, 0x59, 0x77, 0xaf, 0x72,
-    0x38, 0x00, 0x00, 0x04, 0x00, 0x9f, 0xfe, 0xf3, 0x06, 0x8a, 0x04, 0x3a, 0x00, 0x14, 0x00, 0x18,
-    0x00, 0x1c, 0x00, 0x20, 0x00, 0x23, 0x40, 0x11, 0x1e, 0x17, 0x18, 0x18, 0x00, 0x01, 0x01, 0x0b,
-    0x1d, 0x1c, 0x06, 0x72, 0x1b, 0x0a, 0x72, 0x0c, 0x0b, 0x00, 0x2f, 0x33, 0x2b, 0x2b, 0x32, 0x11,
-    0x39, 0x2f, 0x33, 0x32, 0x11, 0x33, 0x2f, 0x30, 0x31, 0x41, 0x35, 0x33, 0x32, 0x16, 0x16, 0x15,
-    0x16, 0x0e, 0x02, 0x07, 0x27, 0x3e, 0x02, 0x37, 0x36, 0x26, 0x26, 0x23, 0x01, 0x15, 0x21, 0x35,
-    0x33, 0x11, 0x23, 0x11, 0x21, 0x11, 0x23, 0x11, 0x03, 0x8b, 0xf1, 0x96, 0xed, 0x8a, 0x01, 0x25,
-    0x56, 0x91, 0x6b, 0x21, 0x70, 0x7b, 0x33, 0x01, 0x03, 0x6b, 0xb9, 0x74, 0xfe, 0xf8, 0xfd, 0x88,
-    0x1b, 0x78, 0x03, 0x38, 0x79, 0x02, 0x07, 0x6b, 0x63, 0xcc, 0x9d, 0x34, 0x85, 0x82, 0x64, 0x14,
-    0x5e, 0x19, 0x6d, 0x8b, 0x44, 0x79, 0x9c, 0x4c, 0x02, 0x33, 0x68, 0x68, 0xfb, 0xc6, 0x04, 0x3a,
-    0xfb, 0xc6, 0x04, 0x3a, 0x00, 0x01, 0x00, 0x7b, 0xff, 0xe7, 0x05, 0x9a, 0x05, 0xc5, 0x00, 0x43,
-    0x00, 0x1d, 0x40, 0x0e, 0x39, 0x0c, 0x0c, 0x23, 0x22, 0x03, 0x72, 0x00, 0x01, 0x01, 0x2e, 0x17,
-    0x09, 0x72, 0x00, 0x2b, 0x32, 0x32, 0x11, 0x33, 0x2b, 0x32, 0x32, 0x11, 0x33, 0x30, 0x31, 0x65,
-    0x15, 0x22, 0x24, 0x26, 0x02, 0x35, 0x35, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x11,
-    0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x35, 0x34, 0x3e, 0x02, 0x33, 0x17, 0x22, 0x0e,
-    0x02, 0x15, 0x15, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x3e, 0x02, 0x35, 0x11, 0x34, 0x2e, 0x02, 0x23,
-    0x22, 0x0e, 0x02, 0x15, 0x11, 0x14, 0x16, 0x16, 0x04, 0x05, 0x9a, 0xb6, 0xfe, 0xd6, 0xd6, 0x73,
-    0x38, 0x68, 0x91, 0x5a, 0x5a, 0x93, 0x6b, 0x39, 0x60, 0xb4, 0xfa, 0x9a, 0x90, 0xe5, 0xa0, 0x55,
-    0x42, 0x79, 0xa8, 0x66, 0x02, 0x4d, 0x7c, 0x57, 0x2e, 0x44, 0x81, 0xb6, 0x72, 0x85, 0xd0, 0x8e,
-    0x4a, 0x26, 0x47, 0x67, 0x42, 0x40, 0x65, 0x46, 0x24, 0x58, 0xae, 0x01, 0x00, 0x52, 0x6b, 0x69,
-    0xbe, 0x01, 0x01, 0x97, 0xff, 0x74, 0xc3, 0x91, 0x50, 0x4f, 0x90, 0xc5, 0x76, 0xfe, 0xf8, 0x97,
-    0xfc, 0xb8, 0x65, 0x6a, 0xbf, 0xfd, 0x93, 0xcf, 0x7f, 0xd8, 0xa1, 0x5a, 0x6d, 0x4c, 0x85, 0xaf,
-    0x63, 0xd1, 0x7d, 0xd6, 0xa0, 0x59, 0x59, 0x9e, 0xd2, 0x7a, 0x01, 0x0b, 0x5c, 0x9c, 0x73, 0x3f,
-    0x41, 0x74, 0x9a, 0x5a, 0xfe, 0xfd, 0x7e, 0xd9, 0xa1, 0x5a, 0x00, 0x01, 0x00, 0x77, 0xff, 0xeb,
-    0x04, 0x81, 0x04, 0x4f, 0x00, 0x43, 0x00, 0x1d, 0x40, 0x0e, 0x39, 0x0c, 0x0c, 0x23, 0x22, 0x07,
-    0x72, 0x00, 0x01, 0x01, 0x2e, 0x17, 0x0b, 0x72, 0x00, 0x2b, 0x32, 0x32, 0x2f, 0x33, 0x2b, 0x32,
-    0x32, 0x11, 0x33, 0x30, 0x31, 0x65, 0x15, 0x22, 0x2e, 0x02, 0x35, 0x35, 0x34, 0x3e, 0x02, 0x33,
-    0x32, 0x1e, 0x02, 0x15, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x35, 0x34, 0x3e,
-    0x02, 0x33, 0x15, 0x22, 0x0e, 0x02, 0x15, 0x15, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x3e, 0x02, 0x35,
-    0x35, 0x34, 0x2e, 0x02, 0x23, 0x22, 0x0e, 0x02, 0x15, 0x15, 0x14, 0x1e, 0x02, 0x04, 0x81, 0x93,
-    0xee, 0xaa, 0x5b, 0x2b, 0x4f, 0x70, 0x45, 0x45, 0x70, 0x50, 0x2b, 0x4a, 0x88, 0xbc, 0x73, 0x6c,
-    0xb2, 0x7f, 0x45, 0x31, 0x5a, 0x7e, 0x4d, 0x2f, 0x50, 0x3d, 0x23, 0x31, 0x5e, 0x86, 0x56, 0x5c,
-    0x92, 0x66, 0x35, 0x1a, 0x30, 0x44, 0x2a, 0x2d, 0x44, 0x2f, 0x17, 0x48, 0x89, 0xc3, 0x5e, 0x6a,
-    0x55, 0x9a, 0xd1, 0x7c, 0x6a, 0x60, 0xa0, 0x75, 0x40, 0x46, 0x7c, 0xa7, 0x61, 0x68, 0x77, 0xcd,
-    0x99, 0x55, 0x57, 0x9c, 0xd0, 0x7a, 0x4b, 0x66, 0xad, 0x80, 0x48, 0x69, 0x37, 0x63, 0x87, 0x4f,
-    0x4d, 0x63, 0xaa, 0x7f, 0x47, 0x46, 0x7c, 0xa6, 0x60, 0x6b, 0x48, 0x7f, 0x60, 0x36, 0x31, 0x59,
-    0x79, 0x46, 0x6e, 0x67, 0xab, 0x7b, 0x43, 0x00, 0xff, 0xff, 0x00, 0x38, 0xfe, 0x9d, 0x04, 0xc7,
-    0x05, 0xb0, 0x04, 0x26, 0x00, 0x3c, 0x00, 0x00, 0x01, 0x07, 0x02, 0x6b, 0x03, 0xc1, 0x00, 0x00,
-    0x00, 0x0b, 0xb6, 0x01, 0x0f, 0x06, 0x00, 0x00, 0x9a, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff,
-    0x00, 0x31, 0xfe, 0x9d, 0x03, 0xdb, 0x04, 0x3a, 0x04, 0x26, 0x00, 0x5c, 0x00, 0x00, 0x01, 0x07,
-    0x02, 0x6b, 0x02, 0xd5, 0x00, 0x00, 0x00, 0x0b, 0xb6, 0x01, 0x0f, 0x06, 0x00, 0x00, 0x9a, 0x56,
-    0x00, 0x2b, 0x34, 0x00, 0x00, 0x03, 0x00, 0x23, 0xfe, 0xa1, 0x06, 0x70, 0x05, 0xb0, 0x00, 0x03,
-    0x00, 0x09, 0x00, 0x11, 0x00, 0x1d, 0x40, 0x0e, 0x09, 0x0d, 0x0d, 0x08, 0x0a, 0x08, 0x72, 0x05,
-    0x10, 0x0c, 0x02, 0x03, 0x02, 0x72, 0x00, 0x2b, 0x32, 0x32, 0x32, 0x2f, 0x2b, 0x32, 0x32, 0x11,
-    0x33, 0x30, 0x31, 0x41, 0x15, 0x21, 0x35, 0x01, 0x03, 0x23, 0x11, 0x23, 0x35, 0x05, 0x11, 0x33,
-    0x11, 0x21, 0x11, 0x33, 0x11, 0x03, 0xd8, 0xfc, 0x4b, 0x06, 0x4d, 0x09, 0x72, 0x8f, 0xfc, 0x4c,
-    0x7c, 0x03, 0x38, 0x7b, 0x05, 0xb0, 0x67, 0x67, 0xfa, 0xbc, 0xfe, 0x35, 0x01, 0x5f, 0x6c, 0x6c,
-    0x05, 0xb0, 0xfa, 0xba, 0x05, 0x46, 0xfa, 0x50, 0x00, 0x03, 0x00, 0x1d, 0xfe, 0xbf, 0x04, 0xef,
-    0x04, 0x3b, 0x00, 0x03, 0x00, 0x0b, 0x00, 0x11, 0x00, 0x1f, 0x40, 0x0f, 0x02, 0x03, 0x03, 0x0d,
-    0x0a, 0x05, 0x06, 0x72, 0x08, 0x07, 0x07, 0x10, 0x04, 0x0a, 0x72, 0x00, 0x2b, 0x32, 0x32, 0x11,
-    0x33, 0x2b, 0x32, 0x2f, 0x39, 0x2f, 0x33, 0x30, 0x31, 0x41, 0x15, 0x21, 0x35, 0x01, 0x11, 0x33,
-    0x11, 0x21, 0x11, 0x33, 0x11, 0x37, 0x03, 0x23, 0x11, 0x23, 0x35, 0x02, 0xe1, 0xfd, 0x3c, 0x01,
-    0x2c, 0x78, 0x02, 0x48, 0x78, 0x6e, 0x09, 0x6e, 0x80, 0x04, 0x3b, 0x67, 0x67, 0xfb, 0xc5, 0x04,
-    0x3a, 0xfc, 0x2d, 0x03, 0xd3, 0xfb, 0xc6, 0x67, 0xfe, 0x58, 0x01, 0x41, 0x67, 0x00, 0xff, 0xff,
-    0x00, 0xad, 0xfe, 0x9d, 0x05, 0x03, 0x05, 0xb0, 0x04, 0x26, 0x00, 0xe1, 0x00, 0x00, 0x01, 0x07,
-    0x02, 0x6b, 0x03, 0xfd, 0x00, 0x00, 0x00, 0x0b, 0xb6, 0x02, 0x1d, 0x19, 0x00, 0x00, 0x9a, 0x56,
-    0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x6f, 0xfe, 0x9d, 0x04, 0x0a, 0x04, 0x3b, 0x04, 0x26,
-    0x00, 0xf9, 0x00, 0x00, 0x01, 0x07, 0x02, 0x6b, 0x03, 0x03, 0x00, 0x00, 0x00, 0x0b, 0xb6, 0x02,
-    0x1b, 0x02, 0x00, 0x00, 0x9a, 0x56, 0x00, 0x2b, 0x34, 0x00, 0x00, 0x03, 0x00, 0xad, 0x00, 0x00,
-    0x04, 0x9a, 0x05, 0xb0, 0x00, 0x03, 0x00, 0x19, 0x00, 0x1d, 0x00, 0x23, 0x40, 0x11, 0x03, 0x03,
-    0x0a, 0x0a, 0x15, 0x02, 0x02, 0x15, 0x15, 0x04, 0x1c, 0x08, 0x72, 0x1b, 0x04, 0x02, 0x72, 0x00,
-    0x2b, 0x32, 0x2b, 0x11, 0x39, 0x2f, 0x33, 0x2f, 0x11, 0x33, 0x11, 0x33, 0x2f, 0x30, 0x31, 0x41,
-    0x11, 0x23, 0x11, 0x01, 0x33, 0x11, 0x14, 0x16, 0x16, 0x33, 0x32, 0x3e, 0x02, 0x37, 0x15, 0x0e,
-    0x03, 0x23, 0x22, 0x26, 0x26, 0x35, 0x01, 0x33, 0x11, 0x23, 0x02, 0xef, 0x66, 0xfe, 0x24, 0x7c,
-    0x52, 0xa2, 0x76, 0x3a, 0x6e, 0x6c, 0x6b, 0x35, 0x32, 0x65, 0x6b, 0x72, 0x40, 0x99, 0xda, 0x73,
-    0x03, 0x71, 0x7c, 0x7c, 0x04, 0x1b, 0xfd, 0x4d, 0x02, 0xb3, 0x01, 0x95, 0xfe, 0x6d, 0x7e, 0x97,
-    0x42, 0x0a, 0x12, 0x1a, 0x10, 0x6a, 0x0f, 0x1a, 0x12, 0x0b, 0x59, 0xc5, 0xa3, 0x01, 0x93, 0xfa,
-    0x50, 0x00, 0x00, 0x03, 0x00, 0x98, 0x00, 0x00, 0x03, 0xc8, 0x04, 0x3b, 0x00, 0x03, 0x00, 0x07,
-    0x00, 0x1b, 0x00, 0x23, 0x40, 0x10, 0x00, 0x00, 0x18, 0x18, 0x0d, 0x01, 0x01, 0x0d, 0x0d, 0x05,
-    0x0a, 0x72, 0x12, 0x04, 0x06, 0x72, 0x00, 0x2b, 0x32, 0x2b, 0x32, 0x2f, 0x33, 0x7d, 0x2f, 0x11,
-    0x33, 0x11, 0x33, 0x18, 0x2f, 0x30, 0x31, 0x41, 0x11, 0x23, 0x11, 0x01, 0x11, 0x23, 0x11, 0x13,
-    0x15, 0x0e, 0x02, 0x23, 0x22, 0x26, 0x26, 0x35, 0x11, 0x33, 0x11, 0x14, 0x16, 0x16, 0x33, 0x3e,
-    0x02, 0x02, 0x84, 0x67, 0x01, 0xab, 0x78, 0x4f, 0x2e, 0x77, 0x83, 0x41, 0x86, 0xb9, 0x5f, 0x78,
-    0x40, 0x82, 0x64, 0x45, 0x88, 0x74, 0x03, 0x1d, 0xfd, 0xcf, 0x02, 0x31, 0x01, 0x1d, 0xfb, 0xc6,
-    0x04, 0x3a, 0xfe, 0x15, 0x67, 0x16, 0x28, 0x19, 0x4e, 0xb3, 0x96, 0x01, 0x13, 0xfe, 0xed, 0x73,
-    0x84, 0x38, 0x01, 0x1a, 0x26, 0x00, 0x00, 0x02, 0x00, 0xa6, 0x00, 0x00, 0x04, 0x93, 0x05, 0xb0,
-    0x00, 0x15, 0x00, 0x19, 0x00, 0x19, 0x40, 0x0c, 0x01, 0x17, 0x06, 0x11, 0x11, 0x17, 0x18, 0x02,
-    0x72, 0x17, 0x08, 0x72, 0x00, 0x2b, 0x2b, 0x11, 0x39, 0x2f, 0x33, 0x11, 0x33, 0x30, 0x31, 0x61,
-    0x23, 0x11, 0x34, 0x26, 0x26, 0x23, 0x22, 0x0e, 0x02, 0x07, 0x35, 0x3e, 0x03, 0x33, 0x32, 0x16,
-    0x16, 0x15, 0x01, 0x23, 0x11, 0x33, 0x04, 0x93, 0x7c, 0x52, 0xa1, 0x77, 0x3a, 0x6e, 0x6c, 0x6b,
-    0x35, 0x32, 0x65, 0x6b, 0x73, 0x3f, 0x9a, 0xd9, 0x73, 0xfc, 0x8f, 0x7c, 0x7c, 0x01, 0x93, 0x7f,
-    0x96, 0x42, 0x09, 0x12, 0x1a, 0x10, 0x6a, 0x0e, 0x1a, 0x13, 0x0a, 0x58, 0xc5, 0xa4, 0xfe, 0x6d,
-    0x05, 0xb0, 0x00, 0x02, 0x00, 0x25, 0xff, 0xeb, 0x05, 0x91, 0x05, 0xc4, 0x00, 0x09, 0x00, 0x36,
-    0x00, 0x25, 0x40, 0x12, 0x05, 0x1d, 0x01, 0x01, 0x1d, 0x1d, 0x06, 0x1c, 0x1c, 0x0a, 0x24, 0x15,
-    0x03, 0x72, 0x2f, 0x0a, 0x09, 0x72, 0x00, 0x2b, 0x32, 0x2b, 0x32, 0x11, 0x39, 0x2f, 0x33, 0x33,
-    0x11, 0x33, 0x2f, 0x11, 0x33, 0x30, 0x31, 0x53, 0x33, 0x14, 0x16, 0x16, 0x33, 0x15, 0x22, 0x26,
-    0x26, 0x01, 0x22, 0x2e, 0x02, 0x35, 0x11, 0x34, 0x3e, 0x02, 0x17, 0x32, 0x1e, 0x02, 0x15, 0x15,
-    0x21, 0x35, 0x21, 0x35, 0x34, 0x2e, 0x02, 0x23, 0x22, 0x0e, 0x02, 0x15, 0x11, 0x14, 0x1e, 0x02,
-    0x33, 0x32, 0x36, 0x37, 0x17, 0x0e, 0x02, 0x25, 0x67, 0x3b, 0x77, 0x5a, 0x77, 0xa6, 0x56, 0x03,
-    0x8b, 0x91, 0xde, 0x99, 0x4e, 0x52, 0x92, 0xc4, 0x72, 0x80, 0xc9, 0x8b, 0x49, 0xfc, 0x16, 0x03,
-    0x6e, 0x32, 0x67, 0x9d, 0x6b, 0x62, 0x9a, 0x6b, 0x38, 0x37, 0x73, 0xb3, 0x7e, 0x84, 0xc0, 0x42,
-    0x27, 0x22, 0x70, 0xa6, 0x04, 0x36, 0x4d, 0x71, 0x3d, 0x61, 0x53, 0x9c, 0xfc, 0x22, 0x58, 0xa1,
-    0xdd, 0x84, 0x01, 0x19, 0x87, 0xe1, 0xa4, 0x5a, 0x01, 0x59, 0xa6, 0xec, 0x92, 0x6c, 0x61, 0x2a,
-    0x69, 0xb5, 0x88, 0x4d, 0x4f, 0x8b, 0xb7, 0x69, 0xfe, 0xe7, 0x67, 0xb4, 0x88, 0x4d, 0x46, 0x30,
-    0x5d, 0x1d, 0x3c, 0x2a, 0x00, 0x02, 0xff, 0xf6, 0xff, 0xec, 0x04, 0x54, 0x04, 0x4e, 0x00, 0x08,
-    0x00, 0x35, 0x00, 0x25, 0x40, 0x12, 0x04, 0x1c, 0x01, 0x01, 0x1c, 0x1c, 0x05, 0x1b, 0x1b, 0x09,
-    0x23, 0x14, 0x07, 0x72, 0x2e, 0x09, 0x0b, 0x72, 0x00, 0x2b, 0x32, 0x2b, 0x32, 0x12, 0x39, 0x2f,
-    0x33, 0x33, 0x11, 0x33, 0x2f, 0x11, 0x33, 0x30, 0x31, 0x43, 0x33, 0x14, 0x16, 0x33, 0x15, 0x22,
-    0x26, 0x26, 0x01, 0x22, 0x2e, 0x02, 0x35, 0x35, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x1e, 0x02, 0x15,
-    0x15, 0x21, 0x35, 0x21, 0x35, 0x2e, 0x03, 0x23, 0x22, 0x0e, 0x02, 0x15, 0x15, 0x14, 0x1e, 0x02,
-    0x33, 0x32, 0x36, 0x37, 0x17, 0x0e, 0x02, 0x0a, 0x66, 0x6b, 0x6e, 0x66, 0x8f, 0x4a, 0x02, 0xc8,
-    0x6a, 0xb2, 0x82, 0x48, 0x4b, 0x81, 0xa7, 0x5d, 0x67, 0x9f, 0x6e, 0x38, 0xfc, 0xcd, 0x02, 0xbb,
-    0x01, 0x28, 0x4d, 0x72, 0x4c, 0x4d, 0x7e, 0x5b, 0x32, 0x36, 0x62, 0x88, 0x53, 0x5f, 0x95, 0x3b,
-    0x4b, 0x23, 0x69, 0x92, 0x03, 0x57, 0x65, 0x74, 0x5e, 0x49, 0x8c, 0xfc, 0xf7, 0x4e, 0x8e, 0xc3,
-    0x74, 0x2b, 0x7d, 0xca, 0x91, 0x4c, 0x49, 0x85, 0xb5, 0x6d, 0x49, 0x67, 0x0d, 0x44, 0x7d, 0x64,
-    0x39, 0x40, 0x77, 0xa3, 0x63, 0x2b, 0x59, 0x9c, 0x75, 0x43, 0x47, 0x4d, 0x3a, 0x34, 0x57, 0x35,
-    0x00, 0x03, 0x00, 0xb4, 0xfe, 0xc8, 0x04, 0xab, 0x05, 0xb0, 0x00, 0x03, 0x00, 0x09, 0x00, 0x21,
-    0x00, 0x21, 0x40, 0x10, 0x0a, 0x06, 0x06, 0x0b, 0x08, 0x07, 0x07, 0x17, 0x16, 0x09, 0x03, 0x02,
-    0x72, 0x02, 0x08, 0x72, 0x00, 0x2b, 0x2b, 0x32, 0x2f, 0x33, 0x39, 0x2f, 0x33, 0x33, 0x33, 0x11,
-    0x33, 0x30, 0x31, 0x41, 0x11, 0x23, 0x11, 0x21, 0x01, 0x21, 0x27, 0x33, 0x01, 0x01, 0x35, 0x33,
-    0x32, 0x1e, 0x02, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x27, 0x32, 0x3e, 0x02, 0x35, 0x34, 0x2e, 0x02,
-    0x23, 0x01, 0x2f, 0x7b, 0x03, 0xe1, 0xfd, 0x82, 0xfe, 0xe7, 0x0b, 0xec, 0x02, 0x22, 0xfd, 0x7d,
-    0xeb, 0x81, 0xd5, 0x99, 0x53, 0x36, 0x71, 0xad, 0x77, 0x01, 0x59, 0x7f, 0x52, 0x27, 0x40, 0x79,
-    0xa7, 0x67, 0x05, 0xb0, 0xfa, 0x50, 0x05, 0xb0, 0xfd, 0x03, 0x70, 0x02, 0x8d, 0xfd, 0x03, 0x6e,
-    0x44, 0x8d, 0xd7, 0x93, 0x68, 0xc3, 0x9a, 0x59, 0x65, 0x48, 0x7b, 0x9e, 0x57, 0x77, 0xae, 0x72,
-    0x37, 0x00, 0x00, 0x03, 0x00, 0xa3, 0xfe, 0xf3, 0x03, 0xe7, 0x04, 0x3a, 0x00, 0x03, 0x00, 0x09,
-    0x00, 0x1e, 0x00, 0x21, 0x40, 0x10, 0x16, 0x15, 0x09, 0x06, 0x72, 0x06, 0x0a, 0x0a, 0x07, 0x0b,
-    0x0b, 0x01, 0x03, 0x06, 0x72, 0x01, 0x00, 0x2f, 0x2b, 0x12, 0x39, 0x2f, 0x33, 0x33, 0x11, 0x33,
-    0x2b, 0x2f, 0x33, 0x30, 0x31, 0x41, 0x11, 0x23, 0x11, 0x21, 0x01, 0x23, 0x27, 0x33, 0x01, 0x01,
-    0x35, 0x21, 0x32, 0x16, 0x16, 0x15, 0x14, 0x0e, 0x02, 0x07, 0x27, 0x3e, 0x02, 0x35, 0x36, 0x26,
-    0x26, 0x23, 0x01, 0x1b, 0x78, 0x03, 0x41, 0xfd, 0xf2, 0xe5, 0x0c, 0xbd, 0x01, 0xaa, 0xfd, 0x87,
-    0x01, 0x07, 0x96, 0xed, 0x8a, 0x25, 0x55, 0x91, 0x6b, 0x21, 0x6f, 0x7c, 0x34, 0x03, 0x6b, 0xb9,
-    0x74, 0x04, 0x3a, 0xfb, 0xc6, 0x04, 0x3a, 0xfd, 0xb6, 0x6b, 0x01, 0xdf, 0xfd, 0xb6, 0x6c, 0x5d,
-    0xc5, 0x9e, 0x33, 0x81, 0x7f, 0x62, 0x14, 0x5e, 0x18, 0x6a, 0x87, 0x42, 0x7a, 0x96, 0x44, 0x00,
-    0xff, 0xff, 0x00, 0x29, 0xfe, 0xc1, 0x05, 0x58, 0x05, 0xb0, 0x04, 0x26, 0x00, 0xdd, 0x00, 0x00,
-    0x01, 0x07, 0x00, 0x10, 0x04, 0x48, 0xff, 0xd2, 0x00, 0x0b, 0xb6, 0x03, 0x24, 0x06, 0x00, 0x00,
-    0x98, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x2c, 0xfe, 0xc1, 0x04, 0x51, 0x04, 0x3a,
-    0x04, 0x26, 0x00, 0xf2, 0x00, 0x00, 0x01, 0x07, 0x00, 0x10, 0x03, 0x41, 0xff, 0xd2, 0x00, 0x0b,
-    0xb6, 0x03, 0x24, 0x06, 0x01, 0x00, 0x98, 0x56, 0x00, 0x2b, 0x34, 0x00, 0x00, 0x01, 0x00, 0xbb,
-    0xfe, 0x4b, 0x04, 0xe8, 0x05, 0xb0, 0x00, 0x19, 0x00, 0x19, 0x40, 0x0c, 0x19, 0x08, 0x72, 0x17,
-    0x02, 0x02, 0x11, 0x0a, 0x05, 0x00, 0x02, 0x72, 0x00, 0x2b, 0x32, 0x2f, 0x33, 0x39, 0x2f, 0x33,
-    0x2b, 0x30, 0x31, 0x53, 0x33, 0x11, 0x21, 0x11, 0x33, 0x11, 0x14, 0x06, 0x06, 0x23, 0x22, 0x26,
-    0x27, 0x37, 0x16, 0x16, 0x33, 0x32, 0x36, 0x36, 0x35, 0x11, 0x21, 0x11, 0x23, 0xbb, 0x7b, 0x03,
-    0x37, 0x7b, 0x49, 0x89, 0x5f, 0x1f, 0x35, 0x1e, 0x0e, 0x10, 0x3d, 0x16, 0x3a, 0x52, 0x2b, 0xfc,
-    0xc9, 0x7b, 0x05, 0xb0, 0xfd, 0x56, 0x02, 0xaa, 0xf9, 0xfa, 0x71, 0x9d, 0x51, 0x09, 0x0a, 0x67,
-    0x06, 0x0a, 0x3a, 0x6d, 0x4e, 0x02, 0xf3, 0xfd, 0x63, 0x00, 0x00, 0x01, 0x00, 0x9f, 0xfe, 0x4b,
-    0x03, 0xd6, 0x04, 0x3a, 0x00, 0x19, 0x00, 0x1d, 0x40, 0x0f, 0x19, 0x0a, 0x72, 0x17, 0x02, 0x02,
-    0x00, 0x11, 0x0a, 0x0f, 0x72, 0x05, 0x00, 0x06, 0x72, 0x00, 0x2b, 0x32, 0x2b, 0x32, 0x12, 0x39,
-    0x2f, 0x33, 0x2b, 0x30, 0x31, 0x53, 0x33, 0x11, 0x21, 0x11, 0x33, 0x11, 0x14, 0x06, 0x06, 0x23,
-    0x22, 0x26, 0x27, 0x37, 0x16, 0x16, 0x33, 0x32, 0x36, 0x36, 0x35, 0x11, 0x21, 0x11, 0x23, 0x9f,
-    0x78, 0x02, 0x47, 0x78, 0x48, 0x89, 0x5f, 0x1f, 0x34, 0x1d, 0x0e, 0x0f, 0x3e, 0x15, 0x3b, 0x52,
-    0x2b, 0xfd, 0xb9, 0x78, 0x04, 0x3a, 0xfe, 0x1c, 0x01, 0xe4, 0xfb, 0x6d, 0x70, 0x9c, 0x50, 0x09,
-    0x0a, 0x64, 0x06, 0x0a, 0x3a, 0x6e, 0x4d, 0x02, 0x49, 0xfe, 0x10, 0x00, 0xff, 0xff, 0x00, 0xb9,
-    0xfe, 0xc1, 0x05, 0x64, 0x05, 0xb0, 0x04, 0x26, 0x00, 0x2c, 0x00, 0x00, 0x01, 0x07, 0x00, 0x10,
-    0x04, 0x54, 0xff, 0xd2, 0x00, 0x0b, 0xb6, 0x03, 0x16, 0x0a, 0x01, 0x00, 0x98, 0x56, 0x00, 0x2b,
-    0x34, 0x00, 0xff, 0xff, 0x00, 0xa5, 0xfe, 0xc1, 0x04, 0x50, 0x04, 0x3a, 0x04, 0x26, 0x00, 0xf4,
-    0x00, 0x00, 0x01, 0x07, 0x00, 0x10, 0x03, 0x40, 0xff, 0xd2, 0x00, 0x0b, 0xb6, 0x03, 0x16, 0x0a,
-    0x01, 0x00, 0x98, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0xb9, 0xfe, 0xc1, 0x06, 0xa2,
-    0x05, 0xb0, 0x04, 0x26, 0x00, 0x31, 0x00, 0x00, 0x01, 0x07, 0x00, 0x10, 0x05, 0x92, 0xff, 0xd2,
-    0x00, 0x0b, 0xb6, 0x03, 0x1b, 0x0f, 0x00, 0x00, 0x98, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff,
-    0x00, 0xaa, 0xfe, 0xc1, 0x05, 0xab, 0x04, 0x3a, 0x04, 0x26, 0x00, 0xf3, 0x00, 0x00, 0x01, 0x07,
-    0x00, 0x10, 0x04, 0x9b, 0xff, 0xd2, 0x00, 0x0b, 0xb6, 0x03, 0x19, 0x0b, 0x01, 0x00, 0x98, 0x56,
-    0x00, 0x2b, 0x34, 0x00, 0x00, 0x01, 0x00, 0x7d, 0xff, 0xec, 0x05, 0x21, 0x05, 0xc4, 0x00, 0x2c,
-    0x00, 0x1b, 0x40, 0x0d, 0x1a, 0x0b, 0x11, 0x14, 0x14, 0x0b, 0x25, 0x00, 0x03, 0x72, 0x0b, 0x09,
-    0x72, 0x00, 0x2b, 0x2b, 0x32, 0x11, 0x39, 0x2f, 0x33, 0x11, 0x33, 0x30, 0x31, 0x41, 0x32, 0x1e,
-    0x02, 0x15, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x35, 0x21, 0x15, 0x21, 0x15,
-    0x14, 0x1e, 0x02, 0x33, 0x32, 0x3e, 0x02, 0x35, 0x35, 0x34, 0x2e, 0x02, 0x23, 0x22, 0x06, 0x07,
-    0x27, 0x3e, 0x02, 0x02, 0xad, 0x98, 0xea, 0xa0, 0x52, 0x59, 0xa0, 0xd6, 0x7c, 0x8e, 0xdf, 0x9b,
-    0x51, 0x04, 0x57, 0xfc, 0x25, 0x39, 0x76, 0xb3, 0x7b, 0x6e, 0xac, 0x78, 0x3e, 0x3a, 0x7a, 0xc0,
-    0x85, 0x8b, 0xc9, 0x46, 0x27, 0x24, 0x75, 0xae, 0x05, 0xc4, 0x62, 0xb3, 0xf6, 0x94, 0x85, 0x99,
-    0xff, 0xb8, 0x64, 0x58, 0xa7, 0xeb, 0x92, 0x7b, 0x66, 0x35, 0x68, 0xb5, 0x87, 0x4d, 0x5b, 0xa0,
-    0xd5, 0x79, 0x85, 0x75, 0xcd, 0x9b, 0x57, 0x47, 0x30, 0x5d, 0x1d, 0x3e, 0x2a, 0x00, 0x00, 0x02,
-    0x00, 0x71, 0xff, 0xeb, 0x04, 0x0e, 0x05, 0xb0, 0x00, 0x07, 0x00, 0x25, 0x00, 0x1f, 0x40, 0x0f,
-    0x05, 0x08, 0x08, 0x04, 0x25, 0x25, 0x00, 0x1c, 0x12, 0x09, 0x72, 0x07, 0x00, 0x02, 0x72, 0x00,
-    0x2b, 0x32, 0x2b, 0x32, 0x11, 0x39, 0x11, 0x33, 0x33, 0x11, 0x33, 0x30, 0x31, 0x53, 0x21, 0x17,
-    0x01, 0x23, 0x35, 0x01, 0x21, 0x01, 0x37, 0x32, 0x16, 0x16, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x22,
-    0x2e, 0x02, 0x35, 0x33, 0x14, 0x16, 0x16, 0x33, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23,
-    0x23, 0x92, 0x03, 0x68, 0x02, 0xfe, 0x11, 0x56, 0x01, 0xb5, 0xfd, 0x26, 0x01, 0x25, 0x80, 0x9a,
-    0xd1, 0x6c, 0x45, 0x7d, 0xa9, 0x64, 0x55, 0xa4, 0x85, 0x50, 0x7d, 0x54, 0x98, 0x65, 0x6c, 0x98,
-    0x50, 0x51, 0x9e, 0x73, 0x7a, 0x05, 0xb0, 0x60, 0xfd, 0xb9, 0x42, 0x01, 0xfb, 0xfe, 0x01, 0x01,
-    0x67, 0xc6, 0x8f, 0x63, 0x9b, 0x6b, 0x38, 0x32, 0x68, 0xa1, 0x6e, 0x5a, 0x91, 0x54, 0x4c, 0x8b,
-    0x5c, 0x7b, 0x9a, 0x48, 0x00, 0x02, 0x00, 0x72, 0xfe, 0x75, 0x04, 0x0c, 0x04, 0x3a, 0x00, 0x07,
-    0x00, 0x25, 0x00, 0x1f, 0x40, 0x0e, 0x08, 0x05, 0x05, 0x04, 0x25, 0x25, 0x00, 0x1c, 0x18, 0x12,
-    0x07, 0x00, 0x06, 0x72, 0x00, 0x2b, 0x32, 0x2f, 0xcc, 0x33, 0x12, 0x39, 0x2f, 0x33, 0x33, 0x11,
-    0x33, 0x30, 0x31, 0x53, 0x21, 0x17, 0x01, 0x23, 0x35, 0x01, 0x21, 0x01, 0x33, 0x32, 0x16, 0x16,
-    0x15, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x33, 0x14, 0x16, 0x16, 0x33, 0x32, 0x36,
-    0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x23, 0x92, 0x03, 0x65, 0x02, 0xfe, 0x19, 0x5b, 0x01, 0xad,
-    0xfd, 0x2e, 0x01, 0x25, 0x6e, 0x99, 0xdb, 0x73, 0x45, 0x7c, 0xa8, 0x65, 0x54, 0xa4, 0x84, 0x50,
-    0x79, 0x55, 0x99, 0x65, 0x6d, 0x99, 0x50, 0x5a, 0xa6, 0x73, 0x6a, 0x04, 0x3a, 0x5d, 0xfd, 0xb5,
-    0x43, 0x01, 0xfd, 0xfd, 0xfc, 0x66, 0xc5, 0x8e, 0x63, 0x9a, 0x6b, 0x38, 0x32, 0x68, 0xa0, 0x6e,
-    0x5a, 0x92, 0x55, 0x4d, 0x8b, 0x5d, 0x7c, 0x99, 0x47, 0x00, 0xff, 0xff, 0x00, 0x19, 0xfe, 0x4b,
-    0x04, 0x4a, 0x05, 0xb0, 0x04, 0x26, 0x00, 0xb1, 0x22, 0x00, 0x00, 0x26, 0x02, 0x40, 0x9b, 0x44,
-    0x00, 0x07, 0x02, 0x6e, 0x00, 0x90, 0x00, 0x00, 0xff, 0xff, 0x00, 0x11, 0xfe, 0x4b, 0x03, 0x67,
-    0x04, 0x3a, 0x04, 0x26, 0x00, 0xec, 0x28, 0x00, 0x00, 0x26, 0x02, 0x40, 0xa0, 0x84, 0x00, 0x07,
-    0x02, 0x6e, 0x00, 0x84, 0x00, 0x00, 0xff, 0xff, 0x00, 0x38, 0xfe, 0x4b, 0x04, 0xd3, 0x05, 0xb0,
-    0x04, 0x26, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x07, 0x02, 0x6e, 0x03, 0xa7, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x31, 0xfe, 0x4b, 0x03, 0xe7, 0x04, 0x3a, 0x04, 0x26, 0x00, 0x5c, 0x00, 0x00, 0x00, 0x07,
-    0x02, 0x6e, 0x02, 0xbb, 0x00, 0x00, 0x00, 0x01, 0x00, 0x4b, 0x00, 0x00, 0x04, 0x12, 0x05, 0xb0,
-    0x00, 0x18, 0x00, 0x12, 0xb7, 0x03, 0x00, 0x00, 0x0b, 0x10, 0x0d, 0x02, 0x72, 0x00, 0x2b, 0x2f,
-    0x33, 0x39, 0x2f, 0x33, 0x30, 0x31, 0x41, 0x21, 0x15, 0x21, 0x22, 0x06, 0x06, 0x15, 0x14, 0x16,
-    0x16, 0x33, 0x21, 0x11, 0x33, 0x11, 0x21, 0x22, 0x26, 0x26, 0x35, 0x34, 0x3e, 0x02, 0x02, 0x2e,
-    0x01, 0x93, 0xfe, 0x6d, 0x7f, 0x9f, 0x49, 0x49, 0x9f, 0x7f, 0x01, 0x68, 0x7c, 0xfe, 0x1c, 0x9d,
-    0xd8, 0x6e, 0x3e, 0x7a, 0xb4, 0x03, 0x4e, 0x6a, 0x5a, 0x8f, 0x50, 0x53, 0x93, 0x5b, 0x05, 0x46,
-    0xfa, 0x50, 0x6f, 0xc0, 0x7a, 0x5c, 0x99, 0x72, 0x3e, 0x00, 0x00, 0x02, 0x00, 0x4d, 0x00, 0x00,
-    0x06, 0x0d, 0x05, 0xb0, 0x00, 0x18, 0x00, 0x2d, 0x00, 0x1f, 0x40, 0x0e, 0x1b, 0x0b, 0x0b, 0x10,
-    0x25, 0x25, 0x03, 0x00, 0x00, 0x1a, 0x10, 0x0d, 0x02, 0x72, 0x00, 0x2b, 0x2f, 0x33, 0x39, 0x2f,
-    0x33, 0x33, 0x2f, 0x11, 0x33, 0x11, 0x33, 0x30, 0x31, 0x41, 0x21, 0x15, 0x21, 0x22, 0x06, 0x06,
-    0x15, 0x14, 0x16, 0x16, 0x33, 0x21, 0x11, 0x33, 0x11, 0x21, 0x22, 0x26, 0x26, 0x35, 0x34, 0x3e,
-    0x02, 0x01, 0x23, 0x35, 0x37, 0x3e, 0x02, 0x37, 0x36, 0x2e, 0x02, 0x27, 0x33, 0x1e, 0x02, 0x07,
-    0x0e, 0x02, 0x02, 0x2f, 0x01, 0x94, 0xfe, 0x6c, 0x7f, 0x9e, 0x49, 0x49, 0x9e, 0x7f, 0x01, 0x69,
-    0x7b, 0xfe, 0x1c, 0x9d, 0xd7, 0x6e, 0x3d, 0x7b, 0xb4, 0x02, 0xd6, 0x9b, 0x9b, 0x53, 0x70, 0x3c,
-    0x02, 0x01, 0x08, 0x10, 0x17, 0x0f, 0x76, 0x12, 0x1f, 0x13, 0x02, 0x02, 0x6a, 0xac, 0x03, 0x4e,
-    0x6a, 0x5a, 0x8f, 0x50, 0x53, 0x93, 0x5b, 0x05, 0x46, 0xfa, 0x50, 0x6f, 0xc0, 0x7a, 0x5c, 0x99,
-    0x72, 0x3e, 0xfc, 0xb2, 0x68, 0x01, 0x01, 0x4a, 0x86, 0x5b, 0x29, 0x57, 0x59, 0x58, 0x29, 0x37,
-    0x74, 0x76, 0x39, 0x88, 0xb3, 0x5a, 0x00, 0x03, 0x00, 0x6f, 0xff, 0xe9, 0x06, 0x4e, 0x06, 0x18,
-    0x00, 0x16, 0x00, 0x2b, 0x00, 0x47, 0x00, 0x1d, 0x40, 0x10, 0x33, 0x44, 0x0b, 0x72, 0x3b, 0x2d,
-    0x01, 0x72, 0x1d, 0x12, 0x0b, 0x72, 0x27, 0x06, 0x07, 0x72, 0x00, 0x2b, 0x32, 0x2b, 0x32, 0x2b,
-    0x2f, 0x2b, 0x32, 0x30, 0x31, 0x53, 0x35, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x1e, 0x03, 0x17, 0x11,
-    0x0e, 0x03, 0x23, 0x22, 0x2e, 0x02, 0x37, 0x15, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x36, 0x36, 0x37,
-    0x11, 0x2e, 0x03, 0x23, 0x22, 0x0e, 0x02, 0x01, 0x11, 0x33, 0x11, 0x14, 0x16, 0x16, 0x33, 0x3e,
-    0x03, 0x37, 0x36, 0x26, 0x27, 0x33, 0x16, 0x16, 0x07, 0x0e, 0x03, 0x23, 0x06, 0x26, 0x26, 0x6f,
-    0x38, 0x6a, 0x9b, 0x63, 0x4a, 0x79, 0x5f, 0x46, 0x2e, 0x0b, 0x0c, 0x3e, 0x68, 0x92, 0x5f, 0x62,
-    0x9a, 0x6a, 0x38, 0x79, 0x26, 0x4c, 0x78, 0x51, 0x67, 0x8b, 0x53, 0x13, 0x0c, 0x2d, 0x4f, 0x78,
-    0x56, 0x52, 0x78, 0x4d, 0x26, 0x02, 0x6d, 0x78, 0x30, 0x5a, 0x3d, 0x4d, 0x76, 0x51, 0x2b, 0x01,
-    0x02, 0x25, 0x1e, 0x76, 0x1b, 0x2a, 0x02, 0x02, 0x45, 0x78, 0x9e, 0x5b, 0x5f, 0x8c, 0x4f, 0x01,
-    0xff, 0x15, 0x80, 0xd1, 0x97, 0x52, 0x28, 0x4c, 0x6c, 0x86, 0x4e, 0xfe, 0xf5, 0x5b, 0x9a, 0x71,
-    0x3e, 0x4d, 0x8d, 0xc3, 0x8c, 0x15, 0x5c, 0x9c, 0x73, 0x3f, 0x4f, 0x84, 0x4e, 0x01, 0x36, 0x35,
-    0x6e, 0x5d, 0x39, 0x47, 0x80, 0xa8, 0xfe, 0xe3, 0x04, 0xbf, 0xfb, 0x41, 0x56, 0x75, 0x3c, 0x01,
-    0x3f, 0x75, 0xa4, 0x66, 0x64, 0xcb, 0x64, 0x61, 0xcb, 0x67, 0x8b, 0xcf, 0x88, 0x44, 0x02, 0x4a,
-    0xa3, 0x00, 0x00, 0x02, 0x00, 0x34, 0xff, 0xe9, 0x05, 0xc7, 0x05, 0xb0, 0x00, 0x20, 0x00, 0x46,
-    0x00, 0x21, 0x40, 0x10, 0x28, 0x27, 0x27, 0x02, 0x01, 0x01, 0x0e, 0x32, 0x43, 0x09, 0x72, 0x3a,
-    0x0d, 0x0e, 0x02, 0x72, 0x00, 0x2b, 0x32, 0x2f, 0x2b, 0x32, 0x11, 0x39, 0x2f, 0x33, 0x33, 0x11,
-    0x33, 0x30, 0x31, 0x41, 0x23, 0x35, 0x33, 0x32, 0x36, 0x36, 0x35, 0x34, 0x2e, 0x02, 0x23, 0x21,
-    0x35, 0x21, 0x32, 0x1e, 0x02, 0x15, 0x14, 0x0e, 0x03, 0x07, 0x22, 0x06, 0x06, 0x07, 0x06, 0x06,
-    0x01, 0x35, 0x35, 0x34, 0x26, 0x26, 0x23, 0x37, 0x32, 0x1e, 0x02, 0x15, 0x15, 0x14, 0x16, 0x16,
-    0x33, 0x3e, 0x03, 0x37, 0x36, 0x26, 0x27, 0x33, 0x16, 0x16, 0x07, 0x0e, 0x03, 0x23, 0x06, 0x26,
-    0x26, 0x01, 0xc0, 0xc1, 0xaa, 0x79, 0x9e, 0x4d, 0x2a, 0x59, 0x8c, 0x63, 0xfe, 0x99, 0x01, 0x67,
-    0x77, 0xb9, 0x7d, 0x40, 0x1d, 0x3a, 0x55, 0x70, 0x44, 0x03, 0x09, 0x0a, 0x03, 0x28, 0x13, 0x01,
-    0x07, 0x3f, 0x7e, 0x5e, 0x12, 0x70, 0x96, 0x58, 0x26, 0x2e, 0x55, 0x39, 0x4b, 0x73, 0x4f, 0x2a,
-    0x01, 0x02, 0x26, 0x1e, 0x7a, 0x1a, 0x2b, 0x02, 0x02, 0x43, 0x76, 0x9d, 0x5c, 0x5c, 0x89, 0x4c,
-    0x02, 0xa2, 0x6b, 0x42, 0x84, 0x62, 0x3e, 0x65, 0x48, 0x26, 0x6a, 0x31, 0x60, 0x8e, 0x5e, 0x3a,
-    0x66, 0x58, 0x43, 0x2f, 0x0b, 0x04, 0x04, 0x01, 0x08, 0x04, 0xfe, 0x88, 0x02, 0x4b, 0x57, 0x83,
-    0x4a, 0x46, 0x35, 0x61, 0x84, 0x4e, 0x4f, 0x41, 0x63, 0x38, 0x01, 0x46, 0x7c, 0xa0, 0x59, 0x64,
-    0xcb, 0x64, 0x61, 0xcb, 0x67, 0x80, 0xcb, 0x8f, 0x4c, 0x02, 0x42, 0x91, 0x00, 0x02, 0x00, 0x2f,
-    0xff, 0xe7, 0x04, 0xdd, 0x04, 0x3a, 0x00, 0x1d, 0x00, 0x42, 0x00, 0x25, 0x40, 0x12, 0x3e, 0x3d,
-    0x3d, 0x1b, 0x02, 0x01, 0x01, 0x0d, 0x2a, 0x2a, 0x22, 0x33, 0x0b, 0x72, 0x0c, 0x0d, 0x06, 0x72,
-    0x00, 0x2b, 0x32, 0x2b, 0x32, 0x32, 0x2f, 0x11, 0x39, 0x2f, 0x33, 0x33, 0x33, 0x11, 0x33, 0x30,
-    0x31, 0x41, 0x23, 0x27, 0x33, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x21, 0x27, 0x21,
-    0x32, 0x16, 0x16, 0x15, 0x14, 0x0e, 0x02, 0x07, 0x0e, 0x02, 0x07, 0x06, 0x06, 0x01, 0x35, 0x06,
-    0x16, 0x33, 0x3e, 0x03, 0x37, 0x36, 0x26, 0x27, 0x33, 0x16, 0x16, 0x07, 0x0e, 0x03, 0x23, 0x06,
-    0x2e, 0x02, 0x27, 0x35, 0x34, 0x26, 0x26, 0x23, 0x37, 0x32, 0x16, 0x16, 0x15, 0x01, 0x72, 0xec,
-    0x02, 0xce, 0x59, 0x75, 0x3b, 0x41, 0x80, 0x5f, 0xfe, 0xfa, 0x06, 0x01, 0x0c, 0x82, 0xb7, 0x60,
-    0x23, 0x43, 0x64, 0x40, 0x02, 0x05, 0x05, 0x03, 0x22, 0x10, 0x01, 0x3f, 0x01, 0x3b, 0x53, 0x41,
-    0x63, 0x45, 0x24, 0x01, 0x02, 0x24, 0x24, 0x7a, 0x1a, 0x2c, 0x02, 0x02, 0x40, 0x6d, 0x8a, 0x4d,
-    0x3e, 0x60, 0x41, 0x23, 0x02, 0x39, 0x6e, 0x51, 0x11, 0x87, 0x98, 0x3f, 0x01, 0xdd, 0x65, 0x32,
-    0x57, 0x37, 0x3b, 0x61, 0x39, 0x63, 0x4b, 0x8a, 0x60, 0x31, 0x53, 0x44, 0x30, 0x0e, 0x01, 0x0d,
-    0x0d, 0x02, 0x02, 0x01, 0xfe, 0xf6, 0x01, 0x3d, 0x4a, 0x01, 0x2f, 0x58, 0x7d, 0x4f, 0x4d, 0xa5,
-    0x4d, 0x4d, 0xa2, 0x50, 0x70, 0xa7, 0x6e, 0x36, 0x01, 0x19, 0x39, 0x5c, 0x41, 0x51, 0x3a, 0x51,
-    0x2b, 0x4b, 0x42, 0x73, 0x4b, 0x00, 0x00, 0x03, 0x00, 0x63, 0xfe, 0xcd, 0x03, 0xda, 0x05, 0xb0,
-    0x00, 0x1f, 0x00, 0x34, 0x00, 0x3f, 0x00, 0x1f, 0x40, 0x0e, 0x3a, 0x39, 0x3f, 0x2c, 0x0c, 0x0d,
-    0x02, 0x72, 0x21, 0x20, 0x20, 0x01, 0x01, 0x02, 0x00, 0x2f, 0x33, 0x11, 0x33, 0x11, 0x33, 0x2b,
-    0x32, 0x2f, 0x33, 0x2f, 0x33, 0x30, 0x31, 0x41, 0x23, 0x35, 0x33, 0x32, 0x36, 0x36, 0x35, 0x34,
-    0x26, 0x26, 0x23, 0x21, 0x35, 0x21, 0x32, 0x16, 0x16, 0x15, 0x14, 0x0e, 0x03, 0x07, 0x22, 0x06,
-    0x06, 0x23, 0x0e, 0x02, 0x07, 0x37, 0x32, 0x16, 0x16, 0x15, 0x15, 0x14, 0x16, 0x16, 0x17, 0x15,
-    0x23, 0x2e, 0x02, 0x35, 0x35, 0x34, 0x26, 0x26, 0x01, 0x15, 0x14, 0x06, 0x07, 0x27, 0x3e, 0x02,
-    0x35, 0x35, 0x01, 0xa7, 0xdd, 0xa4, 0x8c, 0xa5, 0x4a, 0x4e, 0xa1, 0x7d, 0xfe, 0xe6, 0x01, 0x1a,
-    0x9c, 0xd7, 0x70, 0x1d, 0x39, 0x54, 0x6e, 0x44, 0x04, 0x0c, 0x0b, 0x04, 0x17, 0x11, 0x0a, 0x13,
-    0x0e, 0xa6, 0xbc, 0x4e, 0x0e, 0x1f, 0x19, 0x79, 0x1b, 0x1e, 0x0b, 0x4d, 0x92, 0x01, 0xd2, 0x4c,
-    0x41, 0x47, 0x1f, 0x2a, 0x15, 0x02, 0x92, 0x67, 0x4e, 0x85, 0x53, 0x5e, 0x85, 0x47, 0x67, 0x5b,
-    0xb3, 0x84, 0x36, 0x62, 0x55, 0x45, 0x2f, 0x0b, 0x07, 0x06, 0x08, 0x03, 0x01, 0x07, 0x4a, 0x5d,
-    0xa3, 0x69, 0x88, 0x29, 0x4e, 0x42, 0x19, 0x19, 0x1c, 0x52, 0x59, 0x26, 0x84, 0x59, 0x82, 0x46,
-    0xfe, 0x09, 0x8c, 0x5c, 0xab, 0x3b, 0x34, 0x2a, 0x53, 0x5a, 0x34, 0x8f, 0x00, 0x03, 0x00, 0x71,
-    0xfe, 0xd4, 0x03, 0xa0, 0x04, 0x3a, 0x00, 0x1e, 0x00, 0x33, 0x00, 0x3e, 0x00, 0x1e, 0x40, 0x0e,
-    0x38, 0x20, 0x1f, 0x1f, 0x02, 0x01, 0x01, 0x3e, 0x2b, 0x0a, 0x0c, 0x0d, 0x06, 0x72, 0x00, 0x2b,
-    0x32, 0x3f, 0x33, 0x39, 0x2f, 0x33, 0x33, 0x11, 0x33, 0x2f, 0x30, 0x31, 0x41, 0x21, 0x27, 0x33,
-    0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x21, 0x37, 0x21, 0x32, 0x1e, 0x02, 0x15, 0x14,
-    0x0e, 0x02, 0x07, 0x06, 0x06, 0x07, 0x0e, 0x02, 0x07, 0x37, 0x32, 0x16, 0x16, 0x15, 0x15, 0x14,
-    0x16, 0x16, 0x17, 0x15, 0x23, 0x2e, 0x02, 0x35, 0x35, 0x34, 0x26, 0x26, 0x01, 0x15, 0x14, 0x06,
-    0x07, 0x27, 0x3e, 0x02, 0x35, 0x35, 0x01, 0xd9, 0xfe, 0xee, 0x01, 0xe0, 0x67, 0x7d, 0x39, 0x39,
-    0x7d, 0x67, 0xfe, 0xcb, 0x02, 0x01, 0x33, 0x61, 0x97, 0x68, 0x35, 0x22, 0x43, 0x68, 0x47, 0x04,
-    0x0f, 0x05, 0x14, 0x0e, 0x08, 0x1f, 0x18, 0x85, 0x98, 0x3e, 0x07, 0x11, 0x10, 0x7d, 0x11, 0x0f,
-    0x03, 0x39, 0x70, 0x01, 0x88, 0x4b, 0x41, 0x48, 0x1f, 0x2a, 0x15, 0x01, 0xd4, 0x66, 0x2f, 0x5b,
-    0x3f, 0x40, 0x5e, 0x33, 0x66, 0x28, 0x4f, 0x73, 0x4b, 0x34, 0x57, 0x46, 0x31, 0x0c, 0x01, 0x12,
-    0x01, 0x06, 0x03, 0x01, 0x05, 0x49, 0x46, 0x7a, 0x4f, 0x62, 0x1b, 0x3a, 0x32, 0x11, 0x14, 0x13,
-    0x46, 0x44, 0x10, 0x60, 0x3e, 0x59, 0x30, 0xfe, 0xce, 0x8c, 0x5c, 0xab, 0x3b, 0x34, 0x2a, 0x53,
-    0x5a, 0x34, 0x8f, 0x00, 0x00, 0x03, 0x00, 0x43, 0xff, 0xeb, 0x07, 0x50, 0x05, 0xb0, 0x00, 0x11,
-    0x00, 0x15, 0x00, 0x32, 0x00, 0x1d, 0x40, 0x0e, 0x26, 0x26, 0x1e, 0x2f, 0x09, 0x72, 0x17, 0x14,
-    0x00, 0x15, 0x02, 0x72, 0x0b, 0x08, 0x00, 0x2f, 0x33, 0x2b, 0x32, 0x32, 0x32, 0x2b, 0x32, 0x32,
-    0x2f, 0x30, 0x31, 0x41, 0x33, 0x03, 0x06, 0x02, 0x0e, 0x02, 0x23, 0x23, 0x35, 0x37, 0x3e, 0x04,
-    0x37, 0x01, 0x15, 0x21, 0x35, 0x01, 0x11, 0x33, 0x11, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x3e, 0x02,
-    0x37, 0x36, 0x26, 0x27, 0x33, 0x16, 0x16, 0x07, 0x0e, 0x03, 0x23, 0x22, 0x26, 0x26, 0x01, 0xa6,
-    0x7b, 0x25, 0x0a, 0x1f, 0x36, 0x57, 0x7f, 0x5a, 0x2a, 0x25, 0x3b, 0x57, 0x3d, 0x29, 0x1a, 0x09,
-    0x02, 0xee, 0xfd, 0x5c, 0x02, 0x88, 0x7b, 0x1b, 0x34, 0x49, 0x2e, 0x4c, 0x74, 0x50, 0x2b, 0x01,
-    0x02, 0x25, 0x1d, 0x79, 0x1b, 0x2a, 0x02, 0x02, 0x45, 0x78, 0x9e, 0x5b, 0x61, 0x90, 0x50, 0x05,
-    0xb0, 0xfd, 0x5f, 0xa7, 0xff, 0x00, 0xb9, 0x76, 0x39, 0x6a, 0x01, 0x02, 0x2a, 0x5e, 0x9d, 0xeb,
-    0xa1, 0x02, 0x92, 0x6a, 0x6a, 0xfb, 0xaa, 0x04, 0x56, 0xfb, 0xaa, 0x40, 0x62, 0x42, 0x21, 0x3f,
-    0x74, 0xa4, 0x65, 0x64, 0xcb, 0x64, 0x61, 0xcb, 0x67, 0x8b, 0xcf, 0x88, 0x44, 0x4a, 0xa2, 0x00,
-    0x00, 0x03, 0x00, 0x33, 0xff, 0xeb, 0x06, 0x11, 0x04, 0x3a, 0x00, 0x11, 0x00, 0x15, 0x00, 0x33,
-    0x00, 0x1f, 0x40, 0x10, 0x27, 0x27, 0x1e, 0x2f, 0x0b, 0x72, 0x17, 0x14, 0x00, 0x15, 0x06, 0x72,
-    0x0b, 0x08, 0x0a, 0x72, 0x00, 0x2b, 0x32, 0x2b, 0x32, 0x32, 0x32, 0x2b, 0x32, 0x32, 0x2f, 0x30,
-    0x31, 0x41, 0x33, 0x03, 0x0e, 0x04, 0x23, 0x23, 0x35, 0x37, 0x3e, 0x04, 0x37, 0x01, 0x15, 0x21,
-    0x35, 0x01, 0x11, 0x33, 0x11, 0x14, 0x1e, 0x02, 0x33, 0x3e, 0x03, 0x37, 0x36, 0x26, 0x27, 0x37,
-    0x16, 0x16, 0x07, 0x0e, 0x03, 0x23, 0x22, 0x2e, 0x02, 0x01, 0x3e, 0x78, 0x18, 0x06, 0x1b, 0x2f,
-    0x47, 0x64, 0x43, 0x2d, 0x26, 0x2b, 0x40, 0x2f, 0x1f, 0x14, 0x04, 0x02, 0x3c, 0xfe, 0x01, 0x01,
-    0xe2, 0x78, 0x1a, 0x32, 0x45, 0x2b, 0x44, 0x67, 0x47, 0x26, 0x01, 0x02, 0x25, 0x1d, 0x75, 0x1a,
-    0x2c, 0x02, 0x02, 0x40, 0x6d, 0x90, 0x53, 0x45, 0x71, 0x52, 0x2c, 0x04, 0x3a, 0xfe, 0x05, 0x7b,
-    0xbe, 0x87, 0x56, 0x29, 0x6c, 0x02, 0x01, 0x21, 0x45, 0x73, 0xa5, 0x70, 0x01, 0xdd, 0x68, 0x68,
-    0xfd, 0x1f, 0x02, 0xe1, 0xfd, 0x1f, 0x40, 0x63, 0x42, 0x22, 0x01, 0x35, 0x64, 0x8d, 0x57, 0x5f,
-    0xc0, 0x5e, 0x01, 0x5d, 0xc0, 0x61, 0x7a, 0xb7, 0x78, 0x3c, 0x29, 0x58, 0x8b, 0x00, 0x00, 0x03,
-    0x00, 0xbe, 0xff, 0xe9, 0x07, 0x26, 0x05, 0xb0, 0x00, 0x03, 0x00, 0x07, 0x00, 0x23, 0x00, 0x20,
-    0x40, 0x11, 0x16, 0x16, 0x0e, 0x1f, 0x09, 0x72, 0x08, 0x02, 0x72, 0x00, 0x03, 0x03, 0x06, 0x08,
-    0x04, 0x02, 0x72, 0x00, 0x2b, 0x3f, 0x39, 0x2f, 0x33, 0x2b, 0x2b, 0x32, 0x32, 0x2f, 0x30, 0x31,
-    0x41, 0x21, 0x15, 0x21, 0x03, 0x33, 0x11, 0x23, 0x01, 0x33, 0x11, 0x14, 0x16, 0x16, 0x33, 0x3e,
-    0x03, 0x37, 0x36, 0x26, 0x27, 0x33, 0x16, 0x16, 0x07, 0x0e, 0x03, 0x23, 0x06, 0x26, 0x26, 0x27,
-    0x01, 0x1e, 0x03, 0x27, 0xfc, 0xd9, 0x60, 0x7b, 0x7b, 0x03, 0x6d, 0x7b, 0x30, 0x5a, 0x3c, 0x4c,
-    0x75, 0x50, 0x2b, 0x01, 0x02, 0x26, 0x1d, 0x79, 0x1a, 0x2b, 0x02, 0x02, 0x45, 0x78, 0x9e, 0x5b,
-    0x60, 0x8d, 0x4f, 0x05, 0x03, 0x05, 0x6a, 0x03, 0x15, 0xfa, 0x50, 0x05, 0xb0, 0xfb, 0xaa, 0x55,
-    0x75, 0x3b, 0x01, 0x3e, 0x75, 0xa3, 0x65, 0x64, 0xcb, 0x64, 0x61, 0xcb, 0x67, 0x8b, 0xcf, 0x88,
-    0x44, 0x02, 0x4a, 0xa4, 0x83, 0x00, 0x00, 0x03, 0x00, 0x97, 0xff, 0xea, 0x06, 0x1a, 0x04, 0x3a,
-    0x00, 0x03, 0x00, 0x07, 0x00, 0x25, 0x00, 0x22, 0x40, 0x12, 0x19, 0x19, 0x10, 0x21, 0x0b, 0x72,
-    0x09, 0x06, 0x72, 0x03, 0x02, 0x02, 0x05, 0x07, 0x06, 0x72, 0x05, 0x0a, 0x00, 0x3f, 0x2b, 0x12,
-    0x39, 0x2f, 0x33, 0x2b, 0x2b, 0x32, 0x32, 0x2f, 0x30, 0x31, 0x41, 0x15, 0x21, 0x35, 0x13, 0x11,
-    0x23, 0x11, 0x01, 0x11, 0x33, 0x11, 0x14, 0x1e, 0x02, 0x33, 0x3e, 0x03, 0x37, 0x36, 0x26, 0x27,
-    0x37, 0x16, 0x16, 0x07, 0x0e, 0x03, 0x23, 0x06, 0x2e, 0x02, 0x03, 0x68, 0xfd, 0x84, 0x23, 0x78,
-    0x02, 0xbb, 0x78, 0x1a, 0x31, 0x46, 0x2b, 0x44, 0x68, 0x47, 0x26, 0x01, 0x02, 0x26, 0x1d, 0x75,
-    0x1a, 0x2c, 0x02, 0x02, 0x3f, 0x6e, 0x90, 0x53, 0x45, 0x6f, 0x4f, 0x2d, 0x02, 0x50, 0x65, 0x65,
-    0x01, 0xea, 0xfb, 0xc6, 0x04, 0x3a, 0xfd, 0x1f, 0x02, 0xe1, 0xfd, 0x1f, 0x40, 0x62, 0x43, 0x22,
-    0x01, 0x36, 0x63, 0x8d, 0x57, 0x5f, 0xc0, 0x5e, 0x01, 0x5d, 0xc0, 0x61, 0x7a, 0xb7, 0x78, 0x3c,
-    0x01, 0x28, 0x58, 0x8d, 0x00, 0x01, 0x00, 0x88, 0xff, 0xeb, 0x04, 0x94, 0x05, 0xc5, 0x00, 0x2b,
-    0x00, 0x15, 0x40, 0x0a, 0x12, 0x0b, 0x03, 0x72, 0x25, 0x25, 0x1d, 0x00, 0x09, 0x72, 0x00, 0x2b,
-    0x32, 0x32, 0x2f, 0x2b, 0x32, 0x30, 0x31, 0x45, 0x22, 0x2e, 0x02, 0x35, 0x11, 0x34, 0x3e, 0x02,
-    0x33, 0x32, 0x16, 0x17, 0x07, 0x26, 0x26, 0x23, 0x22, 0x0e, 0x02, 0x15, 0x11, 0x14, 0x1e, 0x02,
-    0x33, 0x3e, 0x02, 0x37, 0x36, 0x26, 0x27, 0x33, 0x16, 0x16, 0x07, 0x0e, 0x02, 0x02, 0xb7, 0x7d,
-    0xcd, 0x95, 0x50, 0x50, 0x95, 0xcd, 0x7d, 0x6c, 0xa5, 0x3f, 0x28, 0x40, 0x91, 0x57, 0x67, 0xa1,
-    0x71, 0x3a, 0x3a, 0x71, 0xa1, 0x67, 0x71, 0x9b, 0x52, 0x02, 0x02, 0x1e, 0x16, 0x7a, 0x13, 0x22,
-    0x02, 0x02, 0x85, 0xd7, 0x15, 0x5d, 0xa7, 0xe1, 0x85, 0x01, 0x06, 0x85, 0xe1, 0xa7, 0x5d, 0x26,
-    0x26, 0x62, 0x21, 0x23, 0x50, 0x8c, 0xb9, 0x69, 0xfe, 0xf8, 0x6a, 0xb9, 0x8d, 0x50, 0x01, 0x53,
-    0x98, 0x69, 0x59, 0xb7, 0x58, 0x58, 0xb5, 0x5b, 0x97, 0xc6, 0x62, 0x00, 0x00, 0x01, 0x00, 0x76,
-    0xff, 0xeb, 0x03, 0xc5, 0x04, 0x4e, 0x00, 0x2b, 0x00, 0x15, 0x40, 0x0a, 0x21, 0x1a, 0x07, 0x72,
-    0x07, 0x07, 0x00, 0x0f, 0x0b, 0x72, 0x00, 0x2b, 0x32, 0x32, 0x2f, 0x2b, 0x32, 0x30, 0x31, 0x65,
-    0x3e, 0x02, 0x37, 0x34, 0x26, 0x27, 0x33, 0x16, 0x16, 0x07, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02,
-    0x35, 0x35, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x16, 0x17, 0x07, 0x26, 0x26, 0x23, 0x22, 0x0e, 0x02,
-    0x15, 0x15, 0x14, 0x1e, 0x02, 0x02, 0x4f, 0x5f, 0x6e, 0x2f, 0x01, 0x0b, 0x0d, 0x75, 0x0b, 0x11,
-    0x01, 0x02, 0x62, 0xa7, 0x6a, 0x72, 0xb0, 0x79, 0x3e, 0x3c, 0x73, 0xa8, 0x6d, 0x5c, 0x89, 0x2a,
-    0x22, 0x2e, 0x79, 0x46, 0x58, 0x7e, 0x51, 0x25, 0x2a, 0x56, 0x86, 0x52, 0x02, 0x3a, 0x62, 0x3d,
-    0x38, 0x7b, 0x39, 0x3a, 0x77, 0x3b, 0x6d, 0x8f, 0x46, 0x57, 0x97, 0xc3, 0x6c, 0x2a, 0x6c, 0xc3,
-    0x96, 0x57, 0x1e, 0x20, 0x60, 0x1b, 0x1c, 0x4c, 0x7f, 0x9b, 0x4f, 0x2a, 0x4f, 0x9c, 0x7f, 0x4c,
-    0x00, 0x02, 0x00, 0x22, 0xff, 0xe9, 0x05, 0x1f, 0x05, 0xb0, 0x00, 0x03, 0x00, 0x20, 0x00, 0x17,
-    0x40, 0x0b, 0x14, 0x14, 0x0c, 0x1d, 0x09, 0x72, 0x05, 0x02, 0x03, 0x02, 0x72, 0x00, 0x2b, 0x32,
-    0x32, 0x2b, 0x32, 0x32, 0x2f, 0x30, 0x31, 0x41, 0x15, 0x21, 0x35, 0x01, 0x11, 0x33, 0x11, 0x14,
-    0x1e, 0x02, 0x33, 0x3e, 0x03, 0x37, 0x36, 0x26, 0x27, 0x33, 0x16, 0x16, 0x07, 0x0e, 0x03, 0x23,
-    0x06, 0x26, 0x26, 0x04, 0xa2, 0xfb, 0x80, 0x02, 0x01, 0x7c, 0x1a, 0x34, 0x4a, 0x2d, 0x4d, 0x74,
-    0x50, 0x2b, 0x01, 0x02, 0x26, 0x1d, 0x79, 0x1b, 0x2b, 0x03, 0x02, 0x45, 0x78, 0x9e, 0x5b, 0x60,
-    0x8c, 0x50, 0x05, 0xb0, 0x6a, 0x6a, 0xfb, 0xaa, 0x04, 0x56, 0xfb, 0xaa, 0x40, 0x61, 0x42, 0x22,
-    0x01, 0x3e, 0x75, 0xa3, 0x65, 0x64, 0xcb, 0x64, 0x61, 0xcb, 0x67, 0x8b, 0xcf, 0x88, 0x44, 0x02,
-    0x4a, 0xa4, 0x00, 0x02, 0x00, 0x44, 0xff, 0xea, 0x04, 0x9b, 0x04, 0x3a, 0x00, 0x03, 0x00, 0x20,
-    0x00, 0x17, 0x40, 0x0b, 0x13, 0x13, 0x0b, 0x1c, 0x0b, 0x72, 0x05, 0x02, 0x03, 0x06, 0x72, 0x00,
-    0x2b, 0x32, 0x32, 0x2b, 0x32, 0x32, 0x2f, 0x30, 0x31, 0x41, 0x15, 0x21, 0x35, 0x01, 0x11, 0x33,
-    0x11, 0x14, 0x16, 0x16, 0x33, 0x3e, 0x03, 0x37, 0x36, 0x26, 0x27, 0x37, 0x16, 0x16, 0x07, 0x0e,
-    0x03, 0x23, 0x06, 0x2e, 0x02, 0x03, 0xcf, 0xfc, 0x75, 0x01, 0x83, 0x78, 0x30, 0x5b, 0x3d, 0x44,
-    0x67, 0x48, 0x26, 0x01, 0x01, 0x25, 0x1d, 0x75, 0x1a, 0x2c, 0x03, 0x02, 0x3f, 0x6d, 0x90, 0x53,
-    0x47, 0x73, 0x53, 0x2f, 0x04, 0x3a, 0x65, 0x65, 0xfd, 0x1f, 0x02, 0xe1, 0xfd, 0x1f, 0x56, 0x75,
-    0x3c, 0x01, 0x32, 0x5c, 0x83, 0x51, 0x57, 0xb4, 0x57, 0x01, 0x57, 0xb2, 0x5a, 0x73, 0xad, 0x72,
-    0x38, 0x01, 0x28, 0x58, 0x8d, 0x00, 0x00, 0x02, 0x00, 0x91, 0xff, 0xec, 0x04, 0xe5, 0x05, 0xc5,
-    0x00, 0x20, 0x00, 0x3f, 0x00, 0x23, 0x40, 0x11, 0x00, 0x22, 0x3f, 0x3f, 0x02, 0x02, 0x17, 0x35,
-    0x31, 0x2c, 0x03, 0x72, 0x11, 0x0d, 0x17, 0x09, 0x72, 0x00, 0x2b, 0x32, 0xcc, 0x2b, 0xcc, 0x33,
-    0x12, 0x39, 0x2f, 0x33, 0x12, 0x39, 0x39, 0x30, 0x31, 0x41, 0x33, 0x15, 0x23, 0x22, 0x0e, 0x02,
-    0x15, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x36, 0x36, 0x35, 0x33, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e,
-    0x02, 0x35, 0x34, 0x3e, 0x02, 0x05, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x34, 0x3e, 0x02, 0x33, 0x32,
-    0x16, 0x16, 0x15, 0x23, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x15, 0x14, 0x1e, 0x02, 0x33,
-    0x33, 0x02, 0xbd, 0xbd, 0xb8, 0x6b, 0xa3, 0x6f, 0x39, 0x3b, 0x71, 0xa5, 0x6a, 0x7e, 0xbc, 0x69,
-    0x7b, 0x5d, 0x9c, 0xc1, 0x64, 0x7c, 0xcf, 0x98, 0x53, 0x46, 0x8c, 0xd0, 0x01, 0x47, 0xbd, 0x7d,
-    0xc6, 0x8b, 0x48, 0x4c, 0x8f, 0xc9, 0x7c, 0x8e, 0xed, 0x8f, 0x7b, 0x6b, 0xb5, 0x6f, 0x92, 0xba,
-    0x59, 0x2f, 0x65, 0x9e, 0x6e, 0xb8, 0x03, 0x06, 0x55, 0x22, 0x48, 0x71, 0x4e, 0x45, 0x71, 0x51,
-    0x2c, 0x54, 0x91, 0x5a, 0x6e, 0xa1, 0x67, 0x32, 0x37, 0x6b, 0x9b, 0x63, 0x5b, 0x8d, 0x60, 0x32,
-    0x41, 0x39, 0x64, 0x84, 0x4b, 0x64, 0x96, 0x67, 0x33, 0x62, 0xb4, 0x7d, 0x5a, 0x86, 0x49, 0x4e,
-    0x85, 0x53, 0x40, 0x66, 0x4b, 0x27, 0xff, 0xff, 0x00, 0x29, 0xfe, 0x4b, 0x05, 0x5a, 0x05, 0xb0,
-    0x04, 0x26, 0x00, 0xdd, 0x00, 0x00, 0x00, 0x07, 0x02, 0x6e, 0x04, 0x2e, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x2c, 0xfe, 0x4b, 0x04, 0x54, 0x04, 0x3a, 0x04, 0x26, 0x00, 0xf2, 0x00, 0x00, 0x00, 0x07,
-    0x02, 0x6e, 0x03, 0x28, 0x00, 0x00, 0x00, 0x02, 0x00, 0x60, 0x04, 0x7a, 0x02, 0x63, 0x05, 0xd1,
-    0x00, 0x05, 0x00, 0x0f, 0x00, 0x12, 0xb6, 0x05, 0x05, 0x0d, 0x07, 0x02, 0x02, 0x07, 0x00, 0x2f,
-    0x33, 0x2f, 0x10, 0xcd, 0x32, 0x2f, 0x30, 0x31, 0x41, 0x35, 0x13, 0x33, 0x15, 0x03, 0x25, 0x35,
-    0x33, 0x15, 0x14, 0x16, 0x17, 0x07, 0x26, 0x26, 0x01, 0x5e, 0x86, 0x7f, 0xbf, 0xfe, 0xbc, 0x71,
-    0x2e, 0x30, 0x31, 0x4b, 0x53, 0x04, 0x86, 0x0d, 0x01, 0x3e, 0x15, 0xfe, 0xca, 0xec, 0x5f, 0x59,
-    0x44, 0x62, 0x27, 0x31, 0x24, 0x85, 0xff, 0xff, 0x00, 0x32, 0x02, 0x4f, 0x02, 0x11, 0x02, 0xb6,
-    0x04, 0x06, 0x00, 0x11, 0x00, 0x00, 0xff, 0xff, 0x00, 0x32, 0x02, 0x4f, 0x02, 0x11, 0x02, 0xb6,
-    0x04, 0x06, 0x00, 0x11, 0x00, 0x00, 0x00, 0x01, 0x00, 0x9f, 0x02, 0xae, 0x04, 0x89, 0x03, 0x15,
-    0x00, 0x03, 0x00, 0x08, 0xb1, 0x03, 0x02, 0x00, 0x2f, 0x33, 0x30, 0x31, 0x41, 0x15, 0x21, 0x35,
-    0x04, 0x89, 0xfc, 0x16, 0x03, 0x15, 0x67, 0x67, 0x00, 0x01, 0x00, 0x7f, 0x02, 0xae, 0x05, 0xb7,
-    0x03, 0x15, 0x00, 0x03, 0x00, 0x08, 0xb1, 0x03, 0x02, 0x00, 0x2f, 0x33, 0x30, 0x31, 0x41, 0x15,
-    0x21, 0x35, 0x05, 0xb7, 0xfa, 0xc8, 0x03, 0x15, 0x67, 0x67, 0x00, 0x02, 0x00, 0x2d, 0xfe, 0xa5,
-    0x03, 0x9e, 0x00, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0e, 0xb4, 0x02, 0x03, 0x80, 0x06, 0x07,
-    0x00, 0x2f, 0x33, 0x1a, 0xce, 0x32, 0x30, 0x31, 0x45, 0x15, 0x21, 0x35, 0x25, 0x15, 0x21, 0x35,
-    0x03, 0x9e, 0xfc, 0x8f, 0x03, 0x71, 0xfc, 0x8f, 0xf4, 0x67, 0x67, 0xf4, 0x67, 0x67, 0x00, 0x01,
-    0x00, 0x63, 0x04, 0x61, 0x01, 0x36, 0x06, 0x13, 0x00, 0x0a, 0x00, 0x08, 0xb1, 0x05, 0x00, 0x00,
-    0x2f, 0xcd, 0x30, 0x31, 0x53, 0x35, 0x34, 0x36, 0x36, 0x37, 0x17, 0x06, 0x06, 0x15, 0x15, 0x63,
-    0x22, 0x3f, 0x2b, 0x47, 0x2d, 0x2f, 0x04, 0x61, 0x70, 0x3e, 0x75, 0x68, 0x27, 0x34, 0x3e, 0x7e,
-    0x4f, 0x73, 0x00, 0x01, 0x00, 0x3f, 0x04, 0x4b, 0x01, 0x12, 0x06, 0x00, 0x00, 0x0a, 0x00, 0x08,
-    0xb1, 0x05, 0x00, 0x00, 0x2f, 0xcd, 0x30, 0x31, 0x41, 0x15, 0x14, 0x06, 0x06, 0x07, 0x27, 0x36,
-    0x36, 0x35, 0x35, 0x01, 0x12, 0x22, 0x3e, 0x2c, 0x47, 0x2e, 0x2e, 0x06, 0x00, 0x73, 0x3d, 0x76,
-    0x67, 0x28, 0x34, 0x3f, 0x7d, 0x4f, 0x76, 0x00, 0x00, 0x01, 0x00, 0x2a, 0xff, 0x18, 0x00, 0xfd,
-    0x00, 0xcd, 0x00, 0x0a, 0x00, 0x08, 0xb1, 0x05, 0x00, 0x00, 0x2f, 0xcd, 0x30, 0x31, 0x77, 0x15,
-    0x14, 0x06, 0x06, 0x07, 0x27, 0x36, 0x36, 0x35, 0x35, 0xfd, 0x22, 0x3e, 0x2c, 0x47, 0x2e, 0x2e,
-    0xcd, 0x73, 0x3d, 0x76, 0x67, 0x28, 0x34, 0x3e, 0x7e, 0x4f, 0x76, 0x00, 0x00, 0x01, 0x00, 0x5a,
-    0x04, 0x4b, 0x01, 0x2d, 0x06, 0x00, 0x00, 0x0a, 0x00, 0x08, 0xb1, 0x06, 0x00, 0x00, 0x2f, 0xcd,
-    0x30, 0x31, 0x53, 0x33, 0x15, 0x14, 0x16, 0x17, 0x07, 0x2e, 0x02, 0x35, 0x5a, 0x77, 0x2e, 0x2e,
-    0x47, 0x2b, 0x3f, 0x22, 0x06, 0x00, 0x76, 0x4f, 0x7d, 0x3f, 0x34, 0x28, 0x67, 0x76, 0x3d, 0x00,
-    0xff, 0xff, 0x00, 0x64, 0x04, 0x61, 0x02, 0x32, 0x06, 0x13, 0x04, 0x26, 0x01, 0x84, 0x01, 0x00,
-    0x00, 0x07, 0x01, 0x84, 0x00, 0xfc, 0x00, 0x00, 0xff, 0xff, 0x00, 0x45, 0x04, 0x4b, 0x02, 0x0d,
-    0x06, 0x00, 0x04, 0x26, 0x01, 0x85, 0x06, 0x00, 0x00, 0x07, 0x01, 0x85, 0x00, 0xfb, 0x00, 0x00,
-    0x00, 0x02, 0x00, 0x2a, 0xff, 0x0e, 0x01, 0xe7, 0x00, 0xed, 0x00, 0x0a, 0x00, 0x15, 0x00, 0x0c,
-    0xb3, 0x10, 0x05, 0x0b, 0x00, 0x00, 0x2f, 0x32, 0xcd, 0x32, 0x30, 0x31, 0x77, 0x15, 0x14, 0x06,
-    0x06, 0x07, 0x27, 0x36, 0x36, 0x35, 0x35, 0x21, 0x15, 0x14, 0x06, 0x06, 0x07, 0x27, 0x36, 0x36,
-    0x35, 0x35, 0xfd, 0x22, 0x3e, 0x2c, 0x47, 0x2e, 0x2e, 0x01, 0x61, 0x22, 0x3f, 0x2b, 0x48, 0x2e,
-    0x2e, 0xed, 0x93, 0x3f, 0x79, 0x6b, 0x29, 0x35, 0x41, 0x82, 0x51, 0x96, 0x93, 0x3f, 0x79, 0x6b,
-    0x29, 0x35, 0x41, 0x82, 0x51, 0x96, 0x00, 0x02, 0x00, 0x44, 0x00, 0x00, 0x04, 0x22, 0x05, 0xb0,
-    0x00, 0x03, 0x00, 0x07, 0x00, 0x15, 0x40, 0x0a, 0x06, 0x07, 0x07, 0x02, 0x03, 0x02, 0x72, 0x02,
-    0x12, 0x72, 0x00, 0x2b, 0x2b, 0x11, 0x39, 0x2f, 0x33, 0x30, 0x31, 0x41, 0x11, 0x23, 0x11, 0x01,
-    0x15, 0x21, 0x35, 0x02, 0x71, 0x77, 0x02, 0x28, 0xfc, 0x22, 0x05, 0xb0, 0xfa, 0x50, 0x05, 0xb0,
-    0xfe, 0x8a, 0x69, 0x69, 0x00, 0x03, 0x00, 0x55, 0xfe, 0x60, 0x04, 0x32, 0x05, 0xb0, 0x00, 0x03,
-    0x00, 0x07, 0x00, 0x0b, 0x00, 0x1d, 0x40, 0x0e, 0x0b, 0x0a, 0x06, 0x07, 0x07, 0x01, 0x03, 0x0a,
-    0x12, 0x72, 0x03, 0x02, 0x72, 0x01, 0x00, 0x2f, 0x2b, 0x2b, 0x11, 0x12, 0x39, 0x2f, 0x33, 0x11,
-    0x33, 0x30, 0x31, 0x41, 0x11, 0x23, 0x11, 0x01, 0x15, 0x21, 0x35, 0x01, 0x15, 0x21, 0x35, 0x02,
-    0x76, 0x78, 0x02, 0x34, 0xfc, 0x23, 0x03, 0xdd, 0xfc, 0x23, 0x05, 0xb0, 0xf8, 0xb0, 0x07, 0x50,
-    0xfe, 0x8a, 0x68, 0x68, 0xfc, 0x2d, 0x67, 0x67, 0x00, 0x01, 0x00, 0x93, 0x02, 0x1d, 0x02, 0x06,
-    0x03, 0xa4, 0x00, 0x0d, 0x00, 0x08, 0xb1, 0x04, 0x0b, 0x00, 0x2f, 0xcd, 0x30, 0x31, 0x53, 0x35,
-    0x34, 0x36, 0x33, 0x32, 0x16, 0x15, 0x15, 0x14, 0x06, 0x23, 0x22, 0x26, 0x93, 0x64, 0x55, 0x56,
-    0x64, 0x63, 0x56, 0x56, 0x64, 0x02, 0xce, 0x23, 0x4e, 0x65, 0x66, 0x4d, 0x23, 0x4d, 0x64, 0x64,
-    0xff, 0xff, 0x00, 0xa7, 0xff, 0xf7, 0x02, 0xec, 0x00, 0x9e, 0x04, 0x26, 0x00, 0x12, 0x15, 0x00,
-    0x00, 0x07, 0x00, 0x12, 0x01, 0xb0, 0x00, 0x00, 0xff, 0xff, 0x00, 0xa7, 0xff, 0xf7, 0x04, 0x74,
-    0x00, 0x9e, 0x04, 0x26, 0x00, 0x12, 0x15, 0x00, 0x00, 0x27, 0x00, 0x12, 0x01, 0xb0, 0x00, 0x00,
-    0x00, 0x07, 0x00, 0x12, 0x03, 0x38, 0x00, 0x00, 0x00, 0x01, 0x00, 0x5b, 0x02, 0x33, 0x01, 0x00,
-    0x02, 0xd4, 0x00, 0x0b, 0x00, 0x08, 0xb1, 0x03, 0x09, 0x00, 0x2f, 0xcd, 0x30, 0x31, 0x53, 0x34,
-    0x36, 0x33, 0x32, 0x16, 0x15, 0x14, 0x06, 0x23, 0x22, 0x26, 0x5b, 0x2c, 0x26, 0x27, 0x2c, 0x2c,
-    0x27, 0x26, 0x2c, 0x02, 0x83, 0x22, 0x2f, 0x2f, 0x22, 0x22, 0x2e, 0x2e, 0x00, 0x07, 0x00, 0x5c,
-    0xff, 0xeb, 0x07, 0x67, 0x05, 0xc5, 0x00, 0x11, 0x00, 0x23, 0x00, 0x35, 0x00, 0x47, 0x00, 0x59,
-    0x00, 0x6b, 0x00, 0x6f, 0x00, 0x29, 0x40, 0x13, 0x5f, 0x56, 0x56, 0x32, 0x68, 0x4d, 0x4d, 0x44,
-    0x29, 0x29, 0x3b, 0x32, 0x0d, 0x17, 0x0e, 0x0e, 0x20, 0x05, 0x05, 0x00, 0x3f, 0x33, 0x33, 0x2f,
-    0x33, 0x3f, 0x33, 0x33, 0x2f, 0x33, 0x33, 0x2f, 0x33, 0x11, 0x33, 0x2f, 0x33, 0x30, 0x31, 0x53,
-    0x35, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x16, 0x15, 0x15, 0x14, 0x06, 0x06, 0x23, 0x22, 0x26,
-    0x26, 0x37, 0x15, 0x14, 0x16, 0x16, 0x33, 0x32, 0x36, 0x36, 0x35, 0x35, 0x34, 0x26, 0x26, 0x23,
-    0x22, 0x06, 0x06, 0x01, 0x35, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x16, 0x15, 0x15, 0x14, 0x06,
-    0x06, 0x23, 0x22, 0x26, 0x26, 0x37, 0x15, 0x14, 0x16, 0x16, 0x33, 0x32, 0x36, 0x36, 0x35, 0x35,
-    0x34, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x05, 0x35, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x16,
-    0x15, 0x15, 0x14, 0x06, 0x06, 0x23, 0x22, 0x26, 0x26, 0x37, 0x15, 0x14, 0x16, 0x16, 0x33, 0x32,
-    0x36, 0x36, 0x35, 0x35, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x01, 0x01, 0x27, 0x01, 0x5c,
-    0x46, 0x80, 0x56, 0x58, 0x80, 0x46, 0x45, 0x80, 0x57, 0x57, 0x81, 0x46, 0x61, 0x29, 0x54, 0x40,
-    0x40, 0x53, 0x28, 0x29, 0x53, 0x41, 0x3e, 0x54, 0x29, 0x02, 0x92, 0x46, 0x80, 0x56, 0x55, 0x7a,
-    0x42, 0x42, 0x79, 0x54, 0x57, 0x81, 0x46, 0x61, 0x29, 0x54, 0x40, 0x40, 0x53, 0x28, 0x29, 0x54,
-    0x40, 0x3e, 0x54, 0x29, 0x01, 0x83, 0x46, 0x7d, 0x53, 0x58, 0x80, 0x46, 0x45, 0x80, 0x57, 0x54,
-    0x7e, 0x46, 0x56, 0x29, 0x54, 0x40, 0x40, 0x52, 0x28, 0x28, 0x54, 0x40, 0x3f, 0x53, 0x29, 0xfe,
-    0xe6, 0xfd, 0x39, 0x4b, 0x02, 0xc7, 0x04, 0x4b, 0x4d, 0x53, 0x88, 0x52, 0x52, 0x88, 0x53, 0x4d,
-    0x51, 0x88, 0x52, 0x52, 0x88, 0x9e, 0x4d, 0x35, 0x61, 0x3d, 0x3d, 0x61, 0x35, 0x4d, 0x37, 0x61,
-    0x3e, 0x3e, 0x61, 0xfc, 0x48, 0x4e, 0x52, 0x88, 0x52, 0x52, 0x88, 0x52, 0x4e, 0x52, 0x88, 0x52,
-    0x52, 0x88, 0xa0, 0x4e, 0x35, 0x62, 0x3d, 0x3d, 0x61, 0x36, 0x4e, 0x39, 0x61, 0x3b, 0x3b, 0x61,
-    0x87, 0x4e, 0x52, 0x88, 0x52, 0x52, 0x88, 0x52, 0x4e, 0x52, 0x88, 0x52, 0x52, 0x88, 0xa0, 0x4e,
-    0x35, 0x62, 0x3d, 0x3d, 0x61, 0x36, 0x4e, 0x39, 0x61, 0x3b, 0x3b, 0x61, 0x03, 0x4d, 0xfb, 0x8e,
-    0x31, 0x04, 0x72, 0x00, 0x00, 0x02, 0x00, 0x6c, 0x00, 0xa7, 0x01, 0xfd, 0x03, 0xb1, 0x00, 0x04,
-    0x00, 0x09, 0x00, 0x12, 0x40, 0x09, 0x01, 0x05, 0x03, 0x09, 0x02, 0x08, 0x06, 0x06, 0x00, 0x00,
-    0x2f, 0x2f, 0x17, 0x39, 0x30, 0x31, 0x41, 0x01, 0x27, 0x35, 0x01, 0x03, 0x01, 0x23, 0x01, 0x35,
-    0x01, 0xfd, 0xfe, 0xe9, 0x7a, 0x01, 0x27, 0xad, 0x01, 0x17, 0x6a, 0xfe, 0xd9, 0x03, 0xb1, 0xfe,
-    0x77, 0x01, 0x0d, 0x01, 0x7b, 0xfe, 0x80, 0xfe, 0x76, 0x01, 0x7c, 0x0d, 0x00, 0x02, 0x00, 0x62,
-    0x00, 0xa2, 0x01, 0xf3, 0x03, 0xb1, 0x00, 0x04, 0x00, 0x09, 0x00, 0x0e, 0xb4, 0x02, 0x08, 0x08,
-    0x05, 0x00, 0x00, 0x2f, 0x2f, 0x39, 0x2f, 0x33, 0x30, 0x31, 0x77, 0x01, 0x17, 0x15, 0x01, 0x03,
-    0x33, 0x01, 0x15, 0x07, 0x62, 0x01, 0x17, 0x7a, 0xfe, 0xd9, 0x6a, 0x6a, 0x01, 0x27, 0x7a, 0xa2,
-    0x01, 0x89, 0x01, 0x0d, 0xfe, 0x85, 0x03, 0x0f, 0xfe, 0x7f, 0x0d, 0x01, 0x00, 0x01, 0x00, 0x3f,
-    0x00, 0x79, 0x03, 0x50, 0x05, 0x1c, 0x00, 0x03, 0x00, 0x0e, 0xb3, 0x00, 0x03, 0x02, 0x01, 0x00,
-    0x7c, 0x2f, 0x33, 0x18, 0x2f, 0x33, 0x30, 0x31, 0x41, 0x01, 0x27, 0x01, 0x03, 0x50, 0xfd, 0x39,
-    0x4a, 0x02, 0xc7, 0x04, 0xeb, 0xfb, 0x8e, 0x31, 0x04, 0x72, 0xff, 0xff, 0x00, 0x58, 0x02, 0x8f,
-    0x02, 0x8b, 0x05, 0xba, 0x06, 0x07, 0x01, 0xe1, 0x00, 0x00, 0x02, 0x9a, 0xff, 0xff, 0x00, 0x3c,
-    0x02, 0x9a, 0x02, 0xb7, 0x05, 0xaf, 0x06, 0x07, 0x02, 0x3a, 0x00, 0x00, 0x02, 0x9a, 0xff, 0xff,
-    0x00, 0x6d, 0x02, 0x8f, 0x02, 0x99, 0x05, 0xaf, 0x06, 0x07, 0x02, 0x3b, 0x00, 0x00, 0x02, 0x9a,
-    0xff, 0xff, 0x00, 0x61, 0x02, 0x8f, 0x02, 0x98, 0x05, 0xb8, 0x06, 0x07, 0x02, 0x3c, 0x00, 0x00,
-    0x02, 0x9a, 0xff, 0xff, 0x00, 0x3f, 0x02, 0x9a, 0x02, 0x94, 0x05, 0xaf, 0x06, 0x07, 0x02, 0x3d,
-    0x00, 0x00, 0x02, 0x9a, 0xff, 0xff, 0x00, 0x50, 0x02, 0x8f, 0x02, 0x93, 0x05, 0xba, 0x06, 0x07,
-    0x02, 0x3e, 0x00, 0x00, 0x02, 0x9a, 0xff, 0xff, 0x00, 0x4c, 0x02, 0x92, 0x02, 0x81, 0x05, 0xba,
-    0x06, 0x07, 0x02, 0x3f, 0x00, 0x00, 0x02, 0x9a, 0x00, 0x02, 0x00, 0x50, 0x02, 0x93, 0x02, 0xd6,
-    0x05, 0x41, 0x00, 0x03, 0x00, 0x07, 0x00, 0x15, 0xb7, 0x06, 0x06, 0x02, 0x02, 0x03, 0x07, 0x07,
-    0x03, 0x00, 0x2f, 0x33, 0x2f, 0x11, 0x33, 0x11, 0x33, 0x7d, 0x2f, 0x30, 0x31, 0x41, 0x15, 0x21,
-    0x35, 0x01, 0x11, 0x23, 0x11, 0x02, 0xd6, 0xfd, 0x7a, 0x01, 0x72, 0x5d, 0x04, 0x18, 0x5c, 0x5c,
-    0x01, 0x29, 0xfd, 0x52, 0x02, 0xae, 0x00, 0x01, 0x00, 0x50, 0x03, 0xd8, 0x02, 0x84, 0x04, 0x34,
-    0x00, 0x03, 0x00, 0x08, 0xb1, 0x03, 0x02, 0x00, 0x2f, 0x33, 0x30, 0x31, 0x41, 0x15, 0x21, 0x35,
-    0x02, 0x84, 0xfd, 0xcc, 0x04, 0x34, 0x5c, 0x5c, 0x00, 0x02, 0x00, 0x50, 0x03, 0x36, 0x02, 0x83,
-    0x04, 0x89, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0c, 0xb3, 0x02, 0x03, 0x07, 0x06, 0x00, 0x2f, 0x33,
-    0xce, 0x32, 0x30, 0x31, 0x41, 0x15, 0x21, 0x35, 0x25, 0x15, 0x21, 0x35, 0x02, 0x83, 0xfd, 0xcd,
-    0x02, 0x33, 0xfd, 0xcd, 0x03, 0x92, 0x5c, 0x5c, 0xf7, 0x5c, 0x5c, 0x00, 0x00, 0x01, 0x00, 0x66,
-    0x01, 0x75, 0x01, 0x9f, 0x06, 0x68, 0x00, 0x15, 0x00, 0x0c, 0xb3, 0x10, 0x11, 0x06, 0x05, 0x00,
-    0x2f, 0x33, 0x2f, 0x33, 0x30, 0x31, 0x53, 0x35, 0x34, 0x36, 0x36, 0x37, 0x17, 0x0e, 0x02, 0x15,
-    0x15, 0x14, 0x1e, 0x02, 0x17, 0x07, 0x2e, 0x03, 0x66, 0x52, 0x7d, 0x41, 0x29, 0x38, 0x5d, 0x38,
-    0x21, 0x3a, 0x4a, 0x28, 0x29, 0x32, 0x60, 0x4e, 0x30, 0x03, 0xe7, 0x0e, 0x9d, 0xfd, 0xb1, 0x28,
-    0x4d, 0x29, 0x9a, 0xd9, 0x88, 0x12, 0x6a, 0xae, 0x89, 0x65, 0x20, 0x4a, 0x1e, 0x71, 0xa0, 0xcb,
-    0x00, 0x01, 0x00, 0x50, 0x01, 0x75, 0x01, 0x89, 0x06, 0x68, 0x00, 0x15, 0x00, 0x0c, 0xb3, 0x10,
-    0x11, 0x06, 0x05, 0x00, 0x2f, 0x33, 0x2f, 0x33, 0x30, 0x31, 0x41, 0x15, 0x14, 0x06, 0x06, 0x07,
-    0x27, 0x3e, 0x02, 0x35, 0x35, 0x34, 0x2e, 0x02, 0x27, 0x37, 0x1e, 0x03, 0x01, 0x89, 0x51, 0x7d,
-    0x41, 0x2a, 0x37, 0x5d, 0x39, 0x20, 0x38, 0x4b, 0x2a, 0x2a, 0x31, 0x60, 0x4f, 0x2f, 0x03, 0xf5,
-    0x0e, 0xa0, 0xfd, 0xac, 0x29, 0x4a, 0x2b, 0x96, 0xd8, 0x8d, 0x12, 0x66, 0xae, 0x8b, 0x66, 0x1f,
-    0x4d, 0x1e, 0x74, 0xa2, 0xca, 0x00, 0x00, 0x02, 0x00, 0x7b, 0x02, 0x8b, 0x02, 0xee, 0x05, 0xba,
-    0x00, 0x04, 0x00, 0x19, 0x00, 0x13, 0xb7, 0x16, 0x0b, 0x04, 0x04, 0x0b, 0x02, 0x11, 0x02, 0x00,
-    0x2f, 0x33, 0x3f, 0x33, 0x2f, 0x11, 0x33, 0x30, 0x31, 0x53, 0x11, 0x23, 0x11, 0x33, 0x13, 0x07,
-    0x34, 0x3e, 0x02, 0x33, 0x32, 0x16, 0x16, 0x15, 0x11, 0x23, 0x11, 0x34, 0x26, 0x26, 0x23, 0x22,
-    0x06, 0x06, 0xec, 0x71, 0x57, 0x07, 0x2a, 0x2a, 0x4e, 0x6f, 0x44, 0x55, 0x7c, 0x43, 0x6f, 0x30,
-    0x56, 0x3a, 0x4c, 0x67, 0x33, 0x05, 0x00, 0xfd, 0x8b, 0x03, 0x23, 0xfe, 0x88, 0x01, 0x54, 0x8e,
-    0x69, 0x3a, 0x3f, 0x88, 0x6c, 0xfe, 0x04, 0x01, 0xef, 0x54, 0x61, 0x2b, 0x4e, 0x83, 0xff, 0xff,
-    0x00, 0x58, 0xfe, 0x82, 0x02, 0x8b, 0x01, 0xad, 0x06, 0x07, 0x01, 0xe1, 0x00, 0x00, 0xfe, 0x8d,
-    0xff, 0xff, 0x00, 0x7f, 0xfe, 0x94, 0x01, 0xd0, 0x01, 0xaa, 0x06, 0x07, 0x01, 0xe0, 0x00, 0x00,
-    0xfe, 0x94, 0xff, 0xff, 0x00, 0x4c, 0xfe, 0x94, 0x02, 0x9b, 0x01, 0xb4, 0x06, 0x07, 0x01, 0xdf,
-    0x00, 0x00, 0xfe, 0x94, 0xff, 0xff, 0x00, 0x48, 0xfe, 0x89, 0x02, 0x8c, 0x01, 0xb4, 0x06, 0x07,
-    0x02, 0x39, 0x00, 0x00, 0xfe, 0x94, 0xff, 0xff, 0x00, 0x3c, 0xfe, 0x94, 0x02, 0xb7, 0x01, 0xa9,
-    0x06, 0x07, 0x02, 0x3a, 0x00, 0x00, 0xfe, 0x94, 0xff, 0xff, 0x00, 0x6d, 0xfe, 0x89, 0x02, 0x99,
-    0x01, 0xa9, 0x06, 0x07, 0x02, 0x3b, 0x00, 0x00, 0xfe, 0x94, 0xff, 0xff, 0x00, 0x61, 0xfe, 0x89,
-    0x02, 0x98, 0x01, 0xb2, 0x06, 0x07, 0x02, 0x3c, 0x00, 0x00, 0xfe, 0x94, 0xff, 0xff, 0x00, 0x3f,
-    0xfe, 0x94, 0x02, 0x94, 0x01, 0xa9, 0x06, 0x07, 0x02, 0x3d, 0x00, 0x00, 0xfe, 0x94, 0xff, 0xff,
-    0x00, 0x50, 0xfe, 0x89, 0x02, 0x93, 0x01, 0xb4, 0x06, 0x07, 0x02, 0x3e, 0x00, 0x00, 0xfe, 0x94,
-    0xff, 0xff, 0x00, 0x4c, 0xfe, 0x8c, 0x02, 0x81, 0x01, 0xb4, 0x06, 0x07, 0x02, 0x3f, 0x00, 0x00,
-    0xfe, 0x94, 0xff, 0xff, 0x00, 0x50, 0xfe, 0xb6, 0x02, 0xd6, 0x01, 0x64, 0x06, 0x07, 0x01, 0x9c,
-    0x00, 0x00, 0xfc, 0x23, 0xff, 0xff, 0x00, 0x50, 0xff, 0xfb, 0x02, 0x84, 0x00, 0x57, 0x06, 0x07,
-    0x01, 0x9d, 0x00, 0x00, 0xfc, 0x23, 0xff, 0xff, 0x00, 0x50, 0xff, 0x59, 0x02, 0x83, 0x00, 0xac,
-    0x06, 0x07, 0x01, 0x9e, 0x00, 0x00, 0xfc, 0x23, 0x00, 0x01, 0x00, 0x66, 0xfd, 0xde, 0x01, 0x9f,
-    0x02, 0x8a, 0x00, 0x14, 0x00, 0x08, 0xb1, 0x05, 0x10, 0x00, 0x2f, 0x2f, 0x30, 0x31, 0x77, 0x35,
-    0x34, 0x36, 0x36, 0x37, 0x17, 0x0e, 0x02, 0x15, 0x15, 0x14, 0x16, 0x16, 0x17, 0x07, 0x2e, 0x03,
-    0x66, 0x52, 0x7d, 0x41, 0x29, 0x38, 0x5d, 0x38, 0x3a, 0x5e, 0x35, 0x29, 0x32, 0x60, 0x4e, 0x30,
-    0x31, 0x0f, 0x93, 0xed, 0xa5, 0x25, 0x4c, 0x27, 0x8d, 0xc9, 0x80, 0x11, 0x85, 0xcc, 0x8e, 0x29,
-    0x4a, 0x1d, 0x6b, 0x98, 0xc1, 0x00, 0x00, 0x01, 0x00, 0x50, 0xfd, 0xe9, 0x01, 0x89, 0x02, 0x8a,
-    0x00, 0x14, 0x00, 0x08, 0xb1, 0x10, 0x05, 0x00, 0x2f, 0x2f, 0x30, 0x31, 0x65, 0x15, 0x14, 0x06,
-    0x06, 0x07, 0x27, 0x3e, 0x02, 0x35, 0x35, 0x34, 0x26, 0x26, 0x27, 0x37, 0x1e, 0x03, 0x01, 0x89,
-    0x51, 0x7d, 0x41, 0x29, 0x36, 0x5d, 0x39, 0x37, 0x5d, 0x39, 0x2a, 0x33, 0x61, 0x4d, 0x2e, 0x4f,
-    0x0e, 0x9a, 0xf2, 0xa6, 0x26, 0x4a, 0x29, 0x8f, 0xce, 0x86, 0x12, 0x7c, 0xc2, 0x8a, 0x25, 0x4c,
-    0x1b, 0x68, 0x94, 0xb8, 0x00, 0x04, 0x00, 0x61, 0x00, 0x00, 0x04, 0x47, 0x05, 0xc4, 0x00, 0x03,
-    0x00, 0x1e, 0x00, 0x22, 0x00, 0x26, 0x00, 0x22, 0x40, 0x10, 0x22, 0x21, 0x25, 0x26, 0x26, 0x01,
-    0x1b, 0x17, 0x12, 0x05, 0x72, 0x09, 0x02, 0x02, 0x01, 0x0c, 0x00, 0x3f, 0x33, 0x11, 0x33, 0x2b,
-    0xcc, 0x33, 0x12, 0x39, 0x2f, 0x33, 0xce, 0x32, 0x30, 0x31, 0x61, 0x21, 0x35, 0x21, 0x01, 0x13,
-    0x16, 0x06, 0x07, 0x27, 0x3e, 0x02, 0x27, 0x03, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x16, 0x15,
-    0x23, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x01, 0x15, 0x21, 0x35, 0x01, 0x15, 0x21, 0x35,
-    0x04, 0x47, 0xfc, 0x1a, 0x03, 0xe5, 0xfd, 0x42, 0x16, 0x02, 0x33, 0x34, 0x75, 0x23, 0x2b, 0x12,
-    0x01, 0x16, 0x68, 0xb6, 0x77, 0x7e, 0xaf, 0x5d, 0x7b, 0x4d, 0x7f, 0x4b, 0x51, 0x7b, 0x46, 0x01,
-    0x6e, 0xfd, 0x6b, 0x02, 0x95, 0xfd, 0x6b, 0x6a, 0x03, 0xa5, 0xfd, 0x62, 0x67, 0x9e, 0x29, 0x27,
-    0x0a, 0x56, 0x73, 0x34, 0x02, 0x9e, 0x8a, 0xc3, 0x68, 0x62, 0xaf, 0x73, 0x65, 0x7d, 0x39, 0x4d,
-    0x94, 0xfe, 0xc1, 0x5b, 0x5b, 0xfe, 0xfc, 0x5a, 0x5a, 0x00, 0x00, 0x03, 0x00, 0x24, 0x00, 0x00,
-    0x06, 0x04, 0x05, 0xb0, 0x00, 0x03, 0x00, 0x07, 0x00, 0x11, 0x00, 0x22, 0x40, 0x10, 0x03, 0x02,
-    0x06, 0x0b, 0x0e, 0x10, 0x07, 0x07, 0x0d, 0x11, 0x0e, 0x04, 0x72, 0x0a, 0x0d, 0x0c, 0x00, 0x3f,
-    0x33, 0x2b, 0x32, 0x12, 0x39, 0x2f, 0x39, 0x12, 0x39, 0x33, 0xce, 0x32, 0x30, 0x31, 0x41, 0x15,
-    0x21, 0x35, 0x01, 0x15, 0x21, 0x35, 0x01, 0x11, 0x23, 0x01, 0x11, 0x23, 0x11, 0x33, 0x01, 0x11,
-    0x06, 0x04, 0xfa, 0x20, 0x05, 0xe0, 0xfa, 0x20, 0x05, 0x0c, 0x7b, 0xfc, 0xbb, 0x7c, 0x7c, 0x03,
-    0x46, 0x03, 0x93, 0x67, 0x67, 0xfe, 0xd4, 0x67, 0x67, 0x03, 0x49, 0xfa, 0x50, 0x04, 0xdc, 0xfb,
-    0x24, 0x05, 0xb0, 0xfb, 0x25, 0x04, 0xdb, 0x00, 0x00, 0x03, 0x00, 0xb9, 0xff, 0xec, 0x05, 0xf3,
-    0x05, 0xb0, 0x00, 0x17, 0x00, 0x1b, 0x00, 0x2d, 0x00, 0x23, 0x40, 0x12, 0x22, 0x29, 0x0d, 0x1c,
-    0x19, 0x18, 0x06, 0x72, 0x02, 0x01, 0x01, 0x0e, 0x0c, 0x0f, 0x04, 0x72, 0x0e, 0x0c, 0x00, 0x3f,
-    0x2b, 0x32, 0x12, 0x39, 0x2f, 0x33, 0x2b, 0x32, 0xcc, 0x3f, 0x33, 0x30, 0x31, 0x41, 0x21, 0x35,
-    0x21, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x23, 0x11, 0x23, 0x11, 0x21, 0x32, 0x16,
-    0x16, 0x15, 0x14, 0x06, 0x06, 0x01, 0x15, 0x21, 0x35, 0x13, 0x33, 0x11, 0x14, 0x16, 0x16, 0x33,
-    0x32, 0x36, 0x37, 0x17, 0x06, 0x06, 0x23, 0x22, 0x26, 0x26, 0x35, 0x02, 0x13, 0xfe, 0xf5, 0x01,
-    0x0b, 0x84, 0x97, 0x3f, 0x3f, 0x97, 0x84, 0xe2, 0x78, 0x01, 0x5a, 0xa0, 0xcf, 0x64, 0x64, 0xcf,
-    0x03, 0x2d, 0xfd, 0xe1, 0xc7, 0x78, 0x27, 0x41, 0x25, 0x1b, 0x31, 0x15, 0x05, 0x16, 0x47, 0x23,
-    0x44, 0x6b, 0x3c, 0x02, 0x49, 0x67, 0x60, 0x97, 0x54, 0x57, 0x98, 0x5f, 0xfa, 0xb7, 0x05, 0xb0,
-    0x71, 0xc5, 0x7d, 0x7d, 0xc5, 0x72, 0x01, 0xf1, 0x62, 0x62, 0x01, 0x16, 0xfb, 0xb8, 0x4b, 0x4d,
-    0x19, 0x07, 0x03, 0x65, 0x07, 0x09, 0x34, 0x7c, 0x6c, 0x00, 0xff, 0xff, 0x00, 0xb6, 0xff, 0xec,
-    0x07, 0xed, 0x05, 0xb0, 0x04, 0x26, 0x00, 0x36, 0x00, 0x00, 0x00, 0x07, 0x00, 0x57, 0x04, 0x51,
-    0x00, 0x00, 0x00, 0x06, 0x00, 0x24, 0x00, 0x00, 0x05, 0xf0, 0x05, 0xb0, 0x00, 0x03, 0x00, 0x07,
-    0x00, 0x0d, 0x00, 0x12, 0x00, 0x17, 0x00, 0x1d, 0x00, 0x2a, 0x40, 0x14, 0x1d, 0x15, 0x0a, 0x0a,
-    0x12, 0x06, 0x07, 0x03, 0x02, 0x02, 0x11, 0x12, 0x04, 0x72, 0x13, 0x1b, 0x1b, 0x08, 0x11, 0x0c,
-    0x00, 0x3f, 0x33, 0x33, 0x11, 0x33, 0x2b, 0x12, 0x39, 0x2f, 0x33, 0xce, 0x32, 0x11, 0x33, 0x11,
-    0x33, 0x33, 0x30, 0x31, 0x41, 0x15, 0x21, 0x35, 0x01, 0x15, 0x21, 0x35, 0x01, 0x13, 0x13, 0x33,
-    0x03, 0x03, 0x01, 0x13, 0x13, 0x23, 0x01, 0x01, 0x13, 0x13, 0x33, 0x01, 0x01, 0x13, 0x13, 0x23,
-    0x03, 0x03, 0x05, 0xf0, 0xfa, 0x34, 0x05, 0xcc, 0xfa, 0x34, 0x01, 0x85, 0x4b, 0xdc, 0x5e, 0x4b,
-    0xdb, 0xfe, 0xc7, 0xd8, 0x42, 0x5c, 0xfe, 0xc4, 0x03, 0xdb, 0x43, 0xd3, 0x7e, 0xfe, 0xc4, 0xfe,
-    0xc4, 0xd8, 0x4b, 0x61, 0xd8, 0x49, 0x03, 0xc5, 0x67, 0x67, 0xfe, 0xbd, 0x67, 0x67, 0xfd, 0x7e,
-    0x01, 0x9c, 0x04, 0x14, 0xfe, 0x63, 0xfb, 0xed, 0x05, 0xb0, 0xfb, 0xee, 0xfe, 0x62, 0x05, 0xb0,
-    0xfa, 0x50, 0x01, 0xa7, 0x04, 0x09, 0xfa, 0x50, 0x05, 0xb0, 0xfb, 0xf5, 0xfe, 0x5b, 0x04, 0x15,
-    0x01, 0x9b, 0x00, 0x02, 0x00, 0x9b, 0x00, 0x00, 0x05, 0x7f, 0x04, 0x3a, 0x00, 0x11, 0x00, 0x22,
-    0x00, 0x20, 0x40, 0x0f, 0x16, 0x13, 0x13, 0x11, 0x14, 0x08, 0x14, 0x08, 0x11, 0x0a, 0x1c, 0x0f,
-    0x00, 0x06, 0x72, 0x00, 0x2b, 0x32, 0x32, 0x3f, 0x39, 0x39, 0x2f, 0x2f, 0x11, 0x33, 0x11, 0x33,
-    0x30, 0x31, 0x53, 0x21, 0x32, 0x1e, 0x02, 0x15, 0x11, 0x23, 0x11, 0x34, 0x2e, 0x02, 0x23, 0x21,
-    0x11, 0x23, 0x21, 0x21, 0x11, 0x33, 0x11, 0x21, 0x32, 0x36, 0x36, 0x35, 0x11, 0x33, 0x11, 0x14,
-    0x0e, 0x02, 0x9b, 0x01, 0xf3, 0x51, 0x80, 0x59, 0x2f, 0x78, 0x23, 0x43, 0x5d, 0x3b, 0xfe, 0xa2,
-    0x78, 0x03, 0x8b, 0xfe, 0x0e, 0x77, 0x01, 0x5e, 0x4e, 0x72, 0x3f, 0x77, 0x2f, 0x59, 0x80, 0x04,
-    0x3a, 0x2b, 0x60, 0x9f, 0x73, 0xfe, 0xbc, 0x01, 0x45, 0x5c, 0x79, 0x45, 0x1c, 0xfc, 0x2c, 0x02,
-    0xe2, 0xfd, 0x85, 0x34, 0x87, 0x7a, 0x02, 0x9e, 0xfd, 0x63, 0x73, 0x9e, 0x60, 0x2c, 0x00, 0x03,
-    0x00, 0x54, 0xff, 0xec, 0x04, 0x13, 0x05, 0xc4, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2b, 0x00, 0x1d,
-    0x40, 0x0e, 0x2a, 0x2b, 0x27, 0x26, 0x26, 0x07, 0x19, 0x12, 0x05, 0x72, 0x00, 0x07, 0x0d, 0x72,
-    0x00, 0x2b, 0x32, 0x2b, 0x32, 0x12, 0x39, 0x2f, 0x33, 0xce, 0x32, 0x30, 0x31, 0x65, 0x32, 0x36,
-    0x37, 0x17, 0x06, 0x06, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x11, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x16,
-    0x17, 0x07, 0x26, 0x26, 0x23, 0x22, 0x0e, 0x02, 0x15, 0x11, 0x14, 0x1e, 0x02, 0x13, 0x15, 0x21,
-    0x35, 0x05, 0x15, 0x21, 0x35, 0x03, 0x2e, 0x3a, 0x6f, 0x32, 0x0a, 0x36, 0x75, 0x3b, 0x77, 0xc5,
-    0x8f, 0x4f, 0x4e, 0x8f, 0xc4, 0x77, 0x3d, 0x70, 0x3b, 0x0a, 0x32, 0x70, 0x3b, 0x5e, 0x99, 0x6d,
-    0x39, 0x3a, 0x6d, 0x9a, 0x62, 0xfd, 0x22, 0x02, 0xde, 0xfd, 0x22, 0x55, 0x12, 0x10, 0x6d, 0x0e,
-    0x10, 0x48, 0x8e, 0xd4, 0x8d, 0x01, 0x69, 0x8d, 0xd5, 0x8f, 0x47, 0x11, 0x0e, 0x6d, 0x10, 0x13,
-    0x39, 0x72, 0xae, 0x74, 0xfe, 0x95, 0x73, 0xae, 0x73, 0x3a, 0x03, 0x36, 0x5b, 0x5b, 0xfe, 0x5a,
-    0x5a, 0x00, 0x00, 0x03, 0x00, 0x24, 0x00, 0x00, 0x05, 0x60, 0x05, 0xb0, 0x00, 0x03, 0x00, 0x07,
-    0x00, 0x1f, 0x00, 0x29, 0x40, 0x13, 0x06, 0x07, 0x03, 0x02, 0x02, 0x14, 0x0a, 0x14, 0x17, 0x09,
-    0x0a, 0x0a, 0x16, 0x17, 0x04, 0x72, 0x16, 0x0c, 0x72, 0x00, 0x2b, 0x2b, 0x12, 0x39, 0x7d, 0x2f,
-    0x33, 0x11, 0x33, 0x11, 0x12, 0x39, 0x18, 0x2f, 0x33, 0xce, 0x32, 0x30, 0x31, 0x41, 0x15, 0x21,
-    0x35, 0x01, 0x15, 0x21, 0x35, 0x01, 0x21, 0x35, 0x21, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26,
-    0x23, 0x21, 0x11, 0x23, 0x11, 0x21, 0x32, 0x16, 0x16, 0x15, 0x14, 0x06, 0x06, 0x05, 0x60, 0xfa,
-    0xc4, 0x05, 0x3c, 0xfa, 0xc4, 0x02, 0xb7, 0xfe, 0x60, 0x01, 0xa0, 0x82, 0xa2, 0x4b, 0x4b, 0xa2,
-    0x82, 0xfe, 0x8b, 0x7b, 0x01, 0xf0, 0xa0, 0xda, 0x70, 0x6f, 0xdb, 0x04, 0xbb, 0x67, 0x67, 0xfe,
-    0xf0, 0x67, 0x67, 0xfe, 0xa6, 0x6a, 0x54, 0x92, 0x5b, 0x59, 0x96, 0x5b, 0xfa, 0xba, 0x05, 0xb0,
-    0x6e, 0xc4, 0x80, 0x86, 0xc1, 0x66, 0x00, 0x03, 0x00, 0x34, 0x00, 0x00, 0x03, 0xb6, 0x05, 0xb0,
-    0x00, 0x03, 0x00, 0x1c, 0x00, 0x20, 0x00, 0x2d, 0x40, 0x15, 0x1f, 0x20, 0x20, 0x11, 0x03, 0x02,
-    0x05, 0x06, 0x06, 0x1a, 0x02, 0x1a, 0x02, 0x1a, 0x04, 0x10, 0x11, 0x04, 0x72, 0x04, 0x0c, 0x00,
-    0x3f, 0x2b, 0x32, 0x12, 0x39, 0x39, 0x7d, 0x2f, 0x2f, 0x11, 0x33, 0x11, 0x33, 0x11, 0x33, 0x11,
-    0x33, 0x11, 0x33, 0x30, 0x31, 0x41, 0x07, 0x21, 0x37, 0x01, 0x01, 0x27, 0x33, 0x32, 0x36, 0x36,
-    0x35, 0x34, 0x26, 0x26, 0x23, 0x23, 0x37, 0x33, 0x32, 0x16, 0x16, 0x15, 0x14, 0x06, 0x06, 0x23,
-    0x01, 0x15, 0x13, 0x07, 0x21, 0x37, 0x03, 0xb6, 0x21, 0xfc, 0x9f, 0x21, 0x02, 0x36, 0xfd, 0xfb,
-    0x01, 0x9f, 0x73, 0x99, 0x4d, 0x55, 0xa6, 0x7a, 0xc5, 0x22, 0xa3, 0x9d, 0xdd, 0x76, 0x5d, 0xca,
-    0xa3, 0x01, 0xeb, 0x9d, 0x21, 0xfc, 0xf9, 0x21, 0x04, 0x35, 0x6a, 0x6a, 0xfb, 0xcb, 0x02, 0x68,
-    0x59, 0x57, 0x90, 0x53, 0x64, 0x94, 0x53, 0x6a, 0x67, 0xc4, 0x8b, 0x71, 0xbf, 0x73, 0xfd, 0xb6,
-    0x0d, 0x05, 0xb0, 0x6a, 0x6a, 0x00, 0x00, 0x04, 0x00, 0x2d, 0xff, 0xf6, 0x03, 0xb3, 0x05, 0xb0,
-    0x00, 0x03, 0x00, 0x14, 0x00, 0x18, 0x00, 0x1c, 0x00, 0x15, 0x40, 0x09, 0x04, 0x04, 0x03, 0x0f,
-    0x01, 0x0b, 0x0d, 0x03, 0x04, 0x00, 0x3f, 0x3f, 0x33, 0x33, 0x12, 0x39, 0x2f, 0x30, 0x31, 0x41,
-    0x11, 0x23, 0x11, 0x01, 0x33, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x26, 0x27, 0x37, 0x32, 0x3e,
-    0x02, 0x35, 0x03, 0x15, 0x05, 0x35, 0x05, 0x15, 0x05, 0x35, 0x01, 0x7e, 0x7b, 0x02, 0x35, 0x7b,
-    0x50, 0x95, 0xd1, 0x81, 0x1f, 0x3b, 0x1f, 0x79, 0x6b, 0xa5, 0x71, 0x3b, 0xc8, 0xfd, 0xbd, 0x02,
-    0x43, 0xfd, 0xbd, 0x05, 0xb0, 0xfa, 0x50, 0x05, 0xb0, 0xfd, 0x56, 0x71, 0x99, 0xf7, 0xb1, 0x5e,
-    0x06, 0x04, 0x63, 0x4d, 0x93, 0xcf, 0x83, 0x02, 0x41, 0x77, 0xfa, 0x76, 0x1e, 0x76, 0xfb, 0x76,
-    0x00, 0x02, 0x00, 0x6b, 0x00, 0x00, 0x04, 0xd7, 0x04, 0x3a, 0x00, 0x1b, 0x00, 0x1f, 0x00, 0x18,
-    0x40, 0x0b, 0x08, 0x15, 0x15, 0x1e, 0x1f, 0x06, 0x72, 0x0e, 0x01, 0x1e, 0x0a, 0x00, 0x3f, 0x33,
-    0x33, 0x2b, 0x12, 0x39, 0x2f, 0x33, 0x30, 0x31, 0x61, 0x23, 0x35, 0x34, 0x2e, 0x03, 0x23, 0x22,
-    0x0e, 0x02, 0x15, 0x15, 0x23, 0x35, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x1e, 0x03, 0x15, 0x01, 0x11,
-    0x23, 0x11, 0x04, 0xd7, 0x78, 0x26, 0x4b, 0x6d, 0x8c, 0x55, 0x68, 0xa4, 0x74, 0x3d, 0x78, 0x51,
-    0x95, 0xd0, 0x7f, 0x67, 0xb0, 0x8b, 0x61, 0x34, 0xfe, 0x04, 0x78, 0xd6, 0x68, 0xae, 0x89, 0x60,
-    0x31, 0x4d, 0x92, 0xcf, 0x82, 0xd6, 0xd4, 0x9a, 0xf7, 0xb0, 0x5e, 0x3d, 0x73, 0xa5, 0xcf, 0x7b,
-    0x03, 0x66, 0xfb, 0xc6, 0x04, 0x3a, 0x00, 0x02, 0x00, 0x24, 0x00, 0x00, 0x04, 0xc9, 0x05, 0xb0,
-    0x00, 0x17, 0x00, 0x1b, 0x00, 0x1a, 0x40, 0x0c, 0x19, 0x18, 0x03, 0x00, 0x00, 0x0e, 0x0c, 0x0f,
-    0x04, 0x72, 0x0e, 0x0c, 0x00, 0x3f, 0x2b, 0x32, 0x12, 0x39, 0x2f, 0x33, 0xce, 0x32, 0x30, 0x31,
-    0x41, 0x21, 0x35, 0x21, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x21, 0x11, 0x23, 0x11,
-    0x21, 0x32, 0x16, 0x16, 0x15, 0x14, 0x06, 0x06, 0x07, 0x15, 0x21, 0x35, 0x02, 0xe0, 0xfd, 0x44,
-    0x02, 0xbc, 0x80, 0xa2, 0x4c, 0x4a, 0xa2, 0x82, 0xfe, 0x8a, 0x7b, 0x01, 0xf1, 0xa0, 0xd9, 0x70,
-    0x6f, 0xda, 0xa7, 0xfd, 0x4b, 0x02, 0x51, 0x6a, 0x53, 0x92, 0x5d, 0x57, 0x96, 0x5c, 0xfa, 0xba,
-    0x05, 0xb0, 0x6d, 0xc3, 0x81, 0x86, 0xc1, 0x67, 0x94, 0x6a, 0x6a, 0x00, 0x00, 0x04, 0x00, 0x77,
-    0xff, 0xeb, 0x05, 0x84, 0x05, 0xc5, 0x00, 0x21, 0x00, 0x33, 0x00, 0x45, 0x00, 0x49, 0x00, 0x25,
-    0x40, 0x12, 0x42, 0x27, 0x30, 0x47, 0x47, 0x39, 0x30, 0x0d, 0x72, 0x1f, 0x05, 0x0e, 0x49, 0x49,
-    0x16, 0x0e, 0x05, 0x72, 0x00, 0x2b, 0x32, 0x32, 0x2f, 0x10, 0xcc, 0x32, 0x2b, 0x32, 0x32, 0x2f,
-    0x10, 0xcc, 0x32, 0x30, 0x31, 0x41, 0x33, 0x14, 0x06, 0x06, 0x23, 0x22, 0x26, 0x26, 0x35, 0x35,
-    0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x16, 0x15, 0x23, 0x34, 0x26, 0x23, 0x22, 0x06, 0x06, 0x15,
-    0x15, 0x14, 0x16, 0x16, 0x33, 0x32, 0x36, 0x01, 0x35, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x16,
-    0x15, 0x15, 0x14, 0x06, 0x06, 0x23, 0x22, 0x26, 0x26, 0x37, 0x15, 0x14, 0x16, 0x16, 0x33, 0x32,
-    0x36, 0x36, 0x35, 0x35, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x13, 0x01, 0x27, 0x01, 0x02,
-    0x32, 0x61, 0x40, 0x75, 0x51, 0x52, 0x7d, 0x47, 0x47, 0x7c, 0x51, 0x51, 0x76, 0x41, 0x61, 0x52,
-    0x55, 0x38, 0x51, 0x2a, 0x2a, 0x52, 0x39, 0x54, 0x51, 0x01, 0x18, 0x46, 0x80, 0x57, 0x58, 0x7f,
-    0x46, 0x45, 0x7f, 0x57, 0x58, 0x80, 0x47, 0x61, 0x29, 0x55, 0x40, 0x3f, 0x53, 0x29, 0x29, 0x54,
-    0x40, 0x3e, 0x54, 0x2a, 0xcd, 0xfd, 0x39, 0x4a, 0x02, 0xc7, 0x04, 0x0a, 0x3f, 0x6b, 0x40, 0x52,
-    0x88, 0x51, 0x4d, 0x53, 0x88, 0x52, 0x40, 0x6b, 0x41, 0x39, 0x5c, 0x3e, 0x61, 0x37, 0x4d, 0x35,
-    0x61, 0x3d, 0x5f, 0xfd, 0x40, 0x4e, 0x52, 0x88, 0x52, 0x52, 0x88, 0x52, 0x4e, 0x52, 0x88, 0x52,
-    0x52, 0x88, 0xa0, 0x4e, 0x35, 0x62, 0x3d, 0x3d, 0x61, 0x36, 0x4e, 0x39, 0x61, 0x3b, 0x3b, 0x61,
-    0x03, 0x4d, 0xfb, 0x8e, 0x31, 0x04, 0x72, 0x00, 0x00, 0x01, 0x00, 0x5b, 0xff, 0xeb, 0x03, 0x39,
-    0x06, 0x0a, 0x00, 0x2e, 0x00, 0x14, 0xb7, 0x19, 0x18, 0x18, 0x01, 0x24, 0x0c, 0x00, 0x01, 0x00,
-    0x2f, 0x33, 0x2f, 0x33, 0x12, 0x39, 0x2f, 0x33, 0x30, 0x31, 0x65, 0x15, 0x22, 0x2e, 0x02, 0x35,
-    0x11, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x15, 0x14, 0x0e, 0x03, 0x23, 0x35, 0x32,
-    0x3e, 0x02, 0x35, 0x35, 0x34, 0x2e, 0x02, 0x23, 0x22, 0x0e, 0x02, 0x15, 0x11, 0x14, 0x1e, 0x02,
-    0x02, 0xbf, 0x5c, 0x8a, 0x5b, 0x2d, 0x22, 0x42, 0x5e, 0x3c, 0x33, 0x55, 0x3f, 0x23, 0x3f, 0x7a,
-    0xb2, 0xe6, 0x8d, 0xa2, 0xe8, 0x95, 0x47, 0x11, 0x1e, 0x2a, 0x19, 0x22, 0x31, 0x22, 0x11, 0x19,
-    0x38, 0x5f, 0x55, 0x6a, 0x40, 0x77, 0xa7, 0x66, 0x02, 0xe0, 0x59, 0x8c, 0x62, 0x34, 0x2b, 0x53,
-    0x74, 0x4a, 0x24, 0x69, 0xd8, 0xc4, 0x9b, 0x5a, 0x73, 0x7c, 0xc6, 0xe0, 0x63, 0x26, 0x36, 0x4f,
-    0x34, 0x19, 0x22, 0x45, 0x66, 0x44, 0xfd, 0x20, 0x48, 0x7d, 0x5f, 0x36, 0x00, 0x04, 0x00, 0xb1,
-    0x00, 0x00, 0x07, 0xa4, 0x05, 0xc0, 0x00, 0x03, 0x00, 0x15, 0x00, 0x27, 0x00, 0x31, 0x00, 0x25,
-    0x40, 0x11, 0x2b, 0x30, 0x2e, 0x2a, 0x02, 0x03, 0x1b, 0x12, 0x24, 0x09, 0x09, 0x31, 0x2e, 0x04,
-    0x2a, 0x2d, 0x0c, 0x00, 0x3f, 0x33, 0x3f, 0x33, 0x33, 0x2f, 0x33, 0xdc, 0x32, 0xce, 0x32, 0x11,
-    0x12, 0x39, 0x39, 0x30, 0x31, 0x41, 0x15, 0x21, 0x35, 0x03, 0x35, 0x34, 0x36, 0x36, 0x33, 0x32,
-    0x16, 0x16, 0x15, 0x15, 0x14, 0x06, 0x06, 0x23, 0x22, 0x26, 0x26, 0x37, 0x15, 0x14, 0x16, 0x16,
-    0x33, 0x32, 0x36, 0x36, 0x35, 0x35, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x25, 0x11, 0x23,
-    0x01, 0x11, 0x23, 0x11, 0x33, 0x01, 0x11, 0x07, 0x93, 0xfd, 0xaa, 0x1f, 0x4f, 0x90, 0x64, 0x64,
-    0x91, 0x4e, 0x4d, 0x91, 0x63, 0x65, 0x91, 0x4f, 0x6c, 0x2e, 0x60, 0x4b, 0x48, 0x5f, 0x2f, 0x30,
-    0x5f, 0x49, 0x48, 0x60, 0x2f, 0xfe, 0xd4, 0x81, 0xfd, 0x4d, 0x79, 0x82, 0x02, 0xb4, 0x02, 0x13,
-    0x62, 0x62, 0x01, 0xee, 0x6c, 0x64, 0x99, 0x56, 0x56, 0x99, 0x64, 0x6c, 0x64, 0x99, 0x56, 0x56,
-    0x99, 0xd0, 0x6c, 0x45, 0x6e, 0x3f, 0x3f, 0x6e, 0x45, 0x6c, 0x44, 0x6e, 0x40, 0x40, 0x6e, 0xff,
-    0xfa, 0x50, 0x04, 0xdc, 0xfb, 0x24, 0x05, 0xb0, 0xfb, 0x24, 0x04, 0xdc, 0x00, 0x02, 0x00, 0x6c,
-    0x03, 0x97, 0x04, 0x3a, 0x05, 0xb0, 0x00, 0x0c, 0x00, 0x14, 0x00, 0x24, 0x40, 0x11, 0x09, 0x04,
-    0x01, 0x03, 0x06, 0x0a, 0x07, 0x07, 0x13, 0x14, 0x02, 0x00, 0x03, 0x03, 0x06, 0x06, 0x11, 0x00,
-    0x2f, 0x33, 0x11, 0x33, 0x11, 0x33, 0x3f, 0x33, 0x33, 0x11, 0x33, 0x12, 0x17, 0x39, 0x30, 0x31,
-    0x41, 0x11, 0x03, 0x23, 0x03, 0x11, 0x23, 0x11, 0x33, 0x13, 0x13, 0x33, 0x11, 0x01, 0x15, 0x23,
-    0x11, 0x23, 0x11, 0x23, 0x35, 0x03, 0xf1, 0x97, 0x34, 0x98, 0x49, 0x5b, 0xa0, 0x9f, 0x5b, 0xfd,
-    0xb9, 0x9f, 0x4a, 0x9e, 0x03, 0x97, 0x01, 0xa0, 0xfe, 0x60, 0x01, 0xa7, 0xfe, 0x59, 0x02, 0x19,
-    0xfe, 0x54, 0x01, 0xac, 0xfd, 0xe7, 0x02, 0x19, 0x45, 0xfe, 0x2c, 0x01, 0xd4, 0x45, 0x00, 0x02,
-    0x00, 0x96, 0xff, 0xec, 0x04, 0x91, 0x04, 0x4e, 0x00, 0x1d, 0x00, 0x26, 0x00, 0x17, 0x40, 0x0a,
-    0x22, 0x17, 0x17, 0x04, 0x1e, 0x0e, 0x07, 0x1b, 0x04, 0x0b, 0x00, 0x3f, 0x33, 0x3f, 0x33, 0x12,
-    0x39, 0x2f, 0x33, 0x30, 0x31, 0x65, 0x17, 0x06, 0x06, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x34, 0x3e,
-    0x02, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x14, 0x14, 0x15, 0x21, 0x11, 0x16, 0x16, 0x33, 0x32, 0x36,
-    0x01, 0x22, 0x06, 0x07, 0x11, 0x21, 0x11, 0x26, 0x26, 0x04, 0x12, 0x02, 0x54, 0xbc, 0x62, 0x6d,
-    0xbe, 0x90, 0x51, 0x59, 0x96, 0xbb, 0x62, 0x67, 0xb3, 0x88, 0x4d, 0xfd, 0x00, 0x37, 0x8c, 0x4e,
-    0x5d, 0xbb, 0xfe, 0xe8, 0x4b, 0x8d, 0x39, 0x02, 0x1c, 0x34, 0x8a, 0xc6, 0x68, 0x34, 0x3e, 0x58,
-    0x9a, 0xcc, 0x73, 0x74, 0xcb, 0x9a, 0x58, 0x51, 0x92, 0xc5, 0x75, 0x03, 0x12, 0x1a, 0xfe, 0xb8,
-    0x33, 0x3b, 0x3b, 0x03, 0x69, 0x42, 0x38, 0xfe, 0xeb, 0x01, 0x1e, 0x34, 0x3d, 0x00, 0xff, 0xff,
-    0x00, 0x63, 0xff, 0xf5, 0x05, 0xa0, 0x05, 0x9c, 0x04, 0x27, 0x01, 0xe0, 0xff, 0xe4, 0x02, 0x86,
-    0x00, 0x27, 0x01, 0x94, 0x00, 0xed, 0x00, 0x00, 0x01, 0x07, 0x02, 0x3e, 0x03, 0x0d, 0x00, 0x00,
-    0x00, 0x07, 0xb1, 0x06, 0x04, 0x00, 0x3f, 0x30, 0x31, 0x00, 0xff, 0xff, 0x00, 0x81, 0xff, 0xf5,
-    0x06, 0x47, 0x05, 0xb4, 0x04, 0x27, 0x02, 0x39, 0x00, 0x39, 0x02, 0x94, 0x00, 0x27, 0x01, 0x94,
-    0x01, 0xa5, 0x00, 0x00, 0x00, 0x07, 0x02, 0x3e, 0x03, 0xb4, 0x00, 0x00, 0xff, 0xff, 0x00, 0x79,
-    0xff, 0xf5, 0x06, 0x2f, 0x05, 0xab, 0x04, 0x27, 0x02, 0x3b, 0x00, 0x0c, 0x02, 0x96, 0x00, 0x27,
-    0x01, 0x94, 0x01, 0x85, 0x00, 0x00, 0x01, 0x07, 0x02, 0x3e, 0x03, 0x9c, 0x00, 0x00, 0x00, 0x07,
-    0xb1, 0x02, 0x04, 0x00, 0x3f, 0x30, 0x31, 0x00, 0xff, 0xff, 0x00, 0x6c, 0xff, 0xf5, 0x05, 0xe3,
-    0x05, 0xac, 0x04, 0x27, 0x02, 0x3d, 0x00, 0x2d, 0x02, 0x97, 0x00, 0x27, 0x01, 0x94, 0x01, 0x20,
-    0x00, 0x00, 0x01, 0x07, 0x02, 0x3e, 0x03, 0x50, 0x00, 0x00, 0x00, 0x07, 0xb1, 0x06, 0x04, 0x00,
-    0x3f, 0x30, 0x31, 0x00, 0x00, 0x02, 0x00, 0x6a, 0xff, 0xeb, 0x04, 0x33, 0x05, 0xf3, 0x00, 0x29,
-    0x00, 0x3f, 0x00, 0x19, 0x40, 0x0c, 0x2a, 0x00, 0x00, 0x12, 0x35, 0x1f, 0x0b, 0x72, 0x09, 0x12,
-    0x00, 0x72, 0x00, 0x2b, 0x32, 0x2b, 0x32, 0x11, 0x39, 0x2f, 0x33, 0x30, 0x31, 0x41, 0x32, 0x16,
-    0x17, 0x2e, 0x04, 0x23, 0x22, 0x06, 0x06, 0x07, 0x27, 0x3e, 0x02, 0x33, 0x32, 0x1e, 0x02, 0x12,
-    0x15, 0x15, 0x14, 0x0e, 0x03, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x35, 0x34, 0x3e, 0x02, 0x17, 0x22,
-    0x0e, 0x02, 0x15, 0x15, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x3e, 0x02, 0x35, 0x35, 0x2e, 0x03, 0x02,
-    0x41, 0x7b, 0xc0, 0x3e, 0x07, 0x2f, 0x4b, 0x63, 0x79, 0x46, 0x3c, 0x62, 0x58, 0x2d, 0x16, 0x1d,
-    0x56, 0x7b, 0x56, 0x62, 0xa4, 0x82, 0x5a, 0x2f, 0x2c, 0x55, 0x78, 0x98, 0x5a, 0x6d, 0xb1, 0x7d,
-    0x43, 0x42, 0x7b, 0xae, 0x75, 0x58, 0x86, 0x5b, 0x2e, 0x2e, 0x5a, 0x86, 0x57, 0x5c, 0x8a, 0x5e,
-    0x2f, 0x08, 0x33, 0x58, 0x83, 0x03, 0xfe, 0x6a, 0x54, 0x70, 0xb9, 0x8d, 0x60, 0x32, 0x15, 0x28,
-    0x1d, 0x5f, 0x14, 0x30, 0x22, 0x43, 0x86, 0xc7, 0xfe, 0xf8, 0xa3, 0x42, 0x70, 0xc5, 0xa2, 0x74,
-    0x40, 0x4d, 0x8b, 0xbc, 0x6f, 0x20, 0x6c, 0xb5, 0x86, 0x49, 0x67, 0x3f, 0x6e, 0x8d, 0x4f, 0x20,
-    0x52, 0x95, 0x73, 0x42, 0x54, 0x93, 0xbf, 0x6c, 0x3a, 0x1f, 0x54, 0x51, 0x35, 0x00, 0x00, 0x01,
-    0x00, 0xaf, 0xff, 0x0e, 0x04, 0x94, 0x05, 0xb0, 0x00, 0x07, 0x00, 0x0e, 0xb5, 0x04, 0x07, 0x02,
-    0x72, 0x02, 0x06, 0x00, 0x2f, 0x33, 0x2b, 0x32, 0x30, 0x31, 0x41, 0x11, 0x23, 0x11, 0x21, 0x11,
-    0x23, 0x11, 0x04, 0x94, 0x78, 0xfd, 0x0b, 0x78, 0x05, 0xb0, 0xf9, 0x5e, 0x06, 0x3b, 0xf9, 0xc5,
-    0x06, 0xa2, 0x00, 0x03, 0x00, 0x40, 0xfe, 0xf3, 0x04, 0x9c, 0x05, 0xb0, 0x00, 0x03, 0x00, 0x07,
-    0x00, 0x10, 0x00, 0x1f, 0x40, 0x0e, 0x0e, 0x06, 0x06, 0x07, 0x07, 0x0f, 0x02, 0x72, 0x0c, 0x03,
-    0x03, 0x0a, 0x02, 0x0b, 0x00, 0x2f, 0x33, 0x33, 0x33, 0x11, 0x33, 0x2b, 0x32, 0x11, 0x33, 0x11,
-    0x33, 0x30, 0x31, 0x45, 0x15, 0x21, 0x35, 0x01, 0x15, 0x21, 0x35, 0x01, 0x15, 0x01, 0x23, 0x35,
-    0x01, 0x01, 0x35, 0x33, 0x04, 0x9c, 0xfb, 0xd0, 0x03, 0xed, 0xfc, 0x0e, 0x02, 0xb5, 0xfd, 0x67,
-    0x43, 0x02, 0x5a, 0xfd, 0xa6, 0x43, 0xa7, 0x66, 0x66, 0x06, 0x57, 0x66, 0x66, 0xfc, 0xab, 0x18,
-    0xfc, 0xb0, 0x5c, 0x03, 0x00, 0x03, 0x04, 0x5d, 0x00, 0x01, 0x00, 0xa6, 0x02, 0xae, 0x03, 0xe9,
-    0x03, 0x15, 0x00, 0x03, 0x00, 0x08, 0xb1, 0x03, 0x02, 0x00, 0x2f, 0x33, 0x30, 0x31, 0x41, 0x15,
-    0x21, 0x35, 0x03, 0xe9, 0xfc, 0xbd, 0x03, 0x15, 0x67, 0x67, 0x00, 0x03, 0x00, 0x40, 0x00, 0x00,
-    0x04, 0x22, 0x05, 0xb0, 0x00, 0x04, 0x00, 0x09, 0x00, 0x0d, 0x00, 0x16, 0x40, 0x0a, 0x09, 0x0b,
-    0x0b, 0x0a, 0x04, 0x08, 0x08, 0x01, 0x02, 0x72, 0x00, 0x2b, 0x3f, 0x33, 0x2f, 0x33, 0x11, 0x33,
-    0x30, 0x31, 0x65, 0x01, 0x33, 0x01, 0x23, 0x03, 0x13, 0x17, 0x23, 0x01, 0x07, 0x35, 0x33, 0x15,
-    0x02, 0x0d, 0x01, 0x99, 0x7c, 0xfe, 0x0b, 0x57, 0xa7, 0xb8, 0x3d, 0x57, 0xfe, 0xe6, 0x73, 0xe5,
-    0xf3, 0x04, 0xbd, 0xfa, 0x50, 0x02, 0xe8, 0xfe, 0x0b, 0xf3, 0x02, 0xe8, 0x68, 0x68, 0x68, 0x00,
-    0x00, 0x04, 0x00, 0x78, 0xff, 0xeb, 0x07, 0xf0, 0x04, 0x4e, 0x00, 0x17, 0x00, 0x2f, 0x00, 0x47,
-    0x00, 0x5f, 0x00, 0x1d, 0x40, 0x0e, 0x5b, 0x36, 0x36, 0x1e, 0x13, 0x0b, 0x72, 0x4e, 0x43, 0x43,
-    0x2b, 0x06, 0x07, 0x72, 0x00, 0x2b, 0x32, 0x32, 0x11, 0x33, 0x2b, 0x32, 0x32, 0x11, 0x33, 0x30,
-    0x31, 0x53, 0x35, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x1e, 0x03, 0x17, 0x15, 0x0e, 0x04, 0x23, 0x22,
-    0x2e, 0x02, 0x37, 0x15, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x3e, 0x03, 0x37, 0x35, 0x2e, 0x04, 0x23,
-    0x22, 0x0e, 0x02, 0x05, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x03, 0x27, 0x35, 0x3e, 0x04,
-    0x33, 0x32, 0x1e, 0x02, 0x07, 0x35, 0x34, 0x2e, 0x02, 0x23, 0x22, 0x0e, 0x03, 0x07, 0x15, 0x1e,
-    0x04, 0x33, 0x32, 0x3e, 0x02, 0x78, 0x41, 0x7c, 0xac, 0x6b, 0x6b, 0xa3, 0x78, 0x51, 0x31, 0x0b,
-    0x0b, 0x30, 0x51, 0x77, 0xa3, 0x6b, 0x6c, 0xad, 0x7b, 0x42, 0x77, 0x2d, 0x58, 0x84, 0x56, 0x58,
-    0x86, 0x61, 0x40, 0x21, 0x03, 0x03, 0x21, 0x40, 0x62, 0x87, 0x58, 0x56, 0x82, 0x58, 0x2d, 0x07,
-    0x01, 0x43, 0x7b, 0xad, 0x6b, 0x6b, 0xa4, 0x77, 0x51, 0x31, 0x0a, 0x0b, 0x31, 0x51, 0x78, 0xa4,
-    0x6b, 0x6a, 0xad, 0x7b, 0x42, 0x78, 0x2d, 0x57, 0x83, 0x55, 0x59, 0x87, 0x62, 0x40, 0x21, 0x03,
-    0x03, 0x21, 0x40, 0x61, 0x87, 0x58, 0x56, 0x83, 0x58, 0x2d, 0x02, 0x0a, 0x26, 0x6c, 0xc4, 0x98,
-    0x56, 0x56, 0x88, 0x96, 0x83, 0x25, 0x2a, 0x23, 0x83, 0x97, 0x88, 0x58, 0x57, 0x98, 0xc4, 0x92,
-    0x26, 0x54, 0x9e, 0x7d, 0x49, 0x51, 0x7a, 0x7f, 0x60, 0x0c, 0x2a, 0x0c, 0x5f, 0x7f, 0x7a, 0x51,
-    0x4a, 0x7d, 0x9d, 0x53, 0x26, 0x6c, 0xc4, 0x98, 0x57, 0x58, 0x88, 0x97, 0x83, 0x23, 0x2a, 0x25,
-    0x83, 0x96, 0x88, 0x56, 0x56, 0x98, 0xc4, 0x92, 0x26, 0x53, 0x9d, 0x7d, 0x4a, 0x51, 0x7a, 0x7f,
-    0x5f, 0x0c, 0x2a, 0x0c, 0x60, 0x7f, 0x7a, 0x51, 0x49, 0x7d, 0x9e, 0x00, 0x00, 0x01, 0xff, 0x88,
-    0xfe, 0x4b, 0x02, 0x70, 0x06, 0x15, 0x00, 0x1f, 0x00, 0x10, 0xb7, 0x1b, 0x14, 0x01, 0x72, 0x0b,
-    0x04, 0x0f, 0x72, 0x00, 0x2b, 0x32, 0x2b, 0x32, 0x30, 0x31, 0x45, 0x14, 0x06, 0x06, 0x23, 0x22,
-    0x26, 0x27, 0x37, 0x16, 0x16, 0x33, 0x32, 0x36, 0x36, 0x35, 0x11, 0x34, 0x36, 0x36, 0x33, 0x32,
-    0x16, 0x17, 0x07, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x15, 0x01, 0x2a, 0x48, 0x88, 0x5f, 0x1f,
-    0x37, 0x1d, 0x10, 0x0f, 0x35, 0x16, 0x3d, 0x56, 0x2d, 0x4b, 0x8b, 0x61, 0x22, 0x44, 0x21, 0x0f,
-    0x17, 0x2f, 0x23, 0x41, 0x5d, 0x30, 0x62, 0x70, 0x97, 0x4c, 0x0a, 0x0a, 0x63, 0x05, 0x0b, 0x36,
-    0x69, 0x4d, 0x05, 0x23, 0x6f, 0x97, 0x4e, 0x09, 0x0a, 0x61, 0x07, 0x06, 0x38, 0x69, 0x4c, 0x00,
-    0x00, 0x02, 0x00, 0x65, 0x01, 0x4e, 0x04, 0x0f, 0x03, 0xe7, 0x00, 0x19, 0x00, 0x33, 0x00, 0x1b,
-    0x40, 0x0b, 0x17, 0x04, 0x80, 0x0a, 0x11, 0x40, 0x31, 0x1e, 0x80, 0x24, 0x2b, 0x00, 0x2f, 0x33,
-    0x1a, 0xdd, 0x32, 0x1a, 0xde, 0x32, 0x1a, 0xcd, 0x32, 0x30, 0x31, 0x53, 0x27, 0x36, 0x36, 0x33,
-    0x36, 0x16, 0x17, 0x16, 0x16, 0x33, 0x32, 0x36, 0x37, 0x17, 0x06, 0x06, 0x23, 0x22, 0x26, 0x27,
-    0x26, 0x26, 0x07, 0x22, 0x06, 0x03, 0x27, 0x36, 0x36, 0x33, 0x36, 0x16, 0x17, 0x16, 0x16, 0x33,
-    0x32, 0x36, 0x37, 0x17, 0x06, 0x06, 0x23, 0x22, 0x26, 0x27, 0x26, 0x26, 0x07, 0x22, 0x06, 0x6f,
-    0x04, 0x2f, 0x80, 0x41, 0x50, 0x5b, 0x3f, 0x3b, 0x57, 0x4a, 0x41, 0x7a, 0x2f, 0x04, 0x2f, 0x7c,
-    0x41, 0x4a, 0x55, 0x3b, 0x3f, 0x5d, 0x50, 0x41, 0x7e, 0x35, 0x04, 0x2f, 0x81, 0x41, 0x50, 0x5b,
-    0x3f, 0x3b, 0x57, 0x4a, 0x41, 0x7a, 0x2f, 0x03, 0x2f, 0x7c, 0x41, 0x4a, 0x55, 0x3b, 0x3f, 0x5d,
-    0x50, 0x41, 0x7e, 0x02, 0xe6, 0x7f, 0x3c, 0x44, 0x02, 0x2b, 0x20, 0x1e, 0x29, 0x4b, 0x40, 0x80,
-    0x3b, 0x44, 0x27, 0x1e, 0x20, 0x2d, 0x02, 0x4b, 0xfe, 0x2d, 0x7f, 0x3b, 0x44, 0x02, 0x2b, 0x20,
-    0x1e, 0x29, 0x4b, 0x40, 0x7f, 0x3b, 0x44, 0x27, 0x1e, 0x20, 0x2d, 0x02, 0x4b, 0x00, 0x00, 0x03,
-    0x00, 0x96, 0x00, 0x9a, 0x03, 0xd8, 0x04, 0xb9, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x1f,
-    0x40, 0x0d, 0x02, 0x01, 0x01, 0x0a, 0x0a, 0x0b, 0x00, 0x03, 0x03, 0x07, 0x07, 0x06, 0x0b, 0x00,
-    0x2f, 0xce, 0x32, 0x11, 0x33, 0x11, 0x33, 0x11, 0x33, 0x11, 0x33, 0x11, 0x33, 0x30, 0x31, 0x41,
-    0x01, 0x27, 0x01, 0x13, 0x15, 0x21, 0x35, 0x01, 0x15, 0x21, 0x35, 0x03, 0x76, 0xfd, 0xb9, 0x47,
-    0x02, 0x47, 0xa9, 0xfc, 0xbe, 0x03, 0x42, 0xfc, 0xbe, 0x04, 0x8f, 0xfc, 0x0b, 0x2a, 0x03, 0xf5,
-    0xfe, 0xef, 0x6b, 0x6b, 0xfe, 0x65, 0x6b, 0x6b, 0x00, 0x03, 0x00, 0x44, 0x00, 0x01, 0x03, 0x89,
-    0x04, 0x69, 0x00, 0x04, 0x00, 0x09, 0x00, 0x0d, 0x00, 0x22, 0x40, 0x10, 0x03, 0x07, 0x06, 0x00,
-    0x04, 0x08, 0x06, 0x05, 0x09, 0x09, 0x01, 0x02, 0x02, 0x0d, 0x0d, 0x0c, 0x00, 0x2f, 0x33, 0x7c,
-    0x10, 0xce, 0x2f, 0x32, 0x32, 0x18, 0x2f, 0x33, 0x17, 0x39, 0x30, 0x31, 0x53, 0x01, 0x15, 0x01,
-    0x35, 0x01, 0x01, 0x07, 0x35, 0x01, 0x03, 0x15, 0x21, 0x35, 0x9e, 0x02, 0xeb, 0xfc, 0xc4, 0x03,
-    0x3c, 0xfd, 0x16, 0x52, 0x03, 0x3c, 0x02, 0xfc, 0xbd, 0x02, 0xe6, 0xfe, 0xcb, 0x77, 0x01, 0x6b,
-    0x49, 0x01, 0x05, 0xfe, 0xc9, 0x06, 0x4a, 0x01, 0x69, 0xfb, 0xff, 0x67, 0x67, 0x00, 0x00, 0x03,
-    0x00, 0x77, 0x00, 0x01, 0x03, 0xca, 0x04, 0x76, 0x00, 0x04, 0x00, 0x09, 0x00, 0x0d, 0x00, 0x22,
-    0x40, 0x10, 0x03, 0x07, 0x06, 0x00, 0x04, 0x08, 0x06, 0x01, 0x02, 0x02, 0x05, 0x09, 0x09, 0x0d,
-    0x0d, 0x0c, 0x00, 0x2f, 0x33, 0x7c, 0x10, 0xce, 0x2f, 0x32, 0x32, 0x18, 0x2f, 0x33, 0x17, 0x39,
-    0x30, 0x31, 0x41, 0x01, 0x35, 0x01, 0x15, 0x01, 0x01, 0x37, 0x15, 0x01, 0x05, 0x15, 0x21, 0x35,
-    0x03, 0x70, 0xfd, 0x0d, 0x03, 0x4d, 0xfc, 0xb3, 0x02, 0xf5, 0x58, 0xfc, 0xb3, 0x03, 0x3d, 0xfc,
-    0xbd, 0x02, 0xce, 0x01, 0x34, 0x74, 0xfe, 0x97, 0x4b, 0xfe, 0xf9, 0x01, 0x37, 0x0a, 0x4b, 0xfe,
-    0x96, 0xdf, 0x67, 0x67, 0x00, 0x02, 0x00, 0x38, 0x00, 0x00, 0x03, 0xcf, 0x05, 0xb0, 0x00, 0x07,
-    0x00, 0x0f, 0x00, 0x1d, 0x40, 0x0e, 0x05, 0x08, 0x08, 0x0e, 0x07, 0x12, 0x72, 0x03, 0x0a, 0x0a,
-    0x0b, 0x01, 0x02, 0x72, 0x00, 0x2b, 0x32, 0x32, 0x11, 0x33, 0x2b, 0x32, 0x32, 0x11, 0x33, 0x30,
-    0x31, 0x53, 0x01, 0x33, 0x07, 0x01, 0x01, 0x17, 0x23, 0x37, 0x01, 0x01, 0x27, 0x33, 0x01, 0x01,
-    0x23, 0x38, 0x01, 0x9b, 0x57, 0x11, 0xfe, 0xa1, 0x01, 0x62, 0x0f, 0x56, 0x18, 0x01, 0x60, 0xfe,
-    0x9d, 0x0e, 0x57, 0x01, 0x9c, 0xfe, 0x66, 0x57, 0x02, 0xd7, 0x02, 0xd9, 0x5a, 0xfd, 0x81, 0xfd,
-    0x82, 0x59, 0x59, 0x02, 0x7e, 0x02, 0x7f, 0x5a, 0xfd, 0x27, 0xfd, 0x29, 0xff, 0xff, 0x00, 0xa8,
-    0x00, 0xa6, 0x01, 0x55, 0x04, 0xe7, 0x04, 0x27, 0x00, 0x12, 0x00, 0x16, 0x00, 0xaf, 0x00, 0x07,
-    0x00, 0x12, 0x00, 0x19, 0x04, 0x49, 0x00, 0x02, 0x00, 0x76, 0x02, 0x9d, 0x01, 0xe7, 0x04, 0x3a,
-    0x00, 0x03, 0x00, 0x07, 0x00, 0x10, 0xb6, 0x06, 0x02, 0x02, 0x07, 0x03, 0x06, 0x72, 0x00, 0x2b,
-    0x32, 0x32, 0x11, 0x33, 0x30, 0x31, 0x53, 0x11, 0x23, 0x11, 0x21, 0x11, 0x23, 0x11, 0xd8, 0x62,
-    0x01, 0x71, 0x61, 0x04, 0x3a, 0xfe, 0x63, 0x01, 0x9d, 0xfe, 0x63, 0x01, 0x9d, 0x00, 0x00, 0x01,
-    0x00, 0x7a, 0xff, 0x4a, 0x01, 0x35, 0x00, 0xb2, 0x00, 0x09, 0x00, 0x0a, 0xb2, 0x04, 0x80, 0x09,
-    0x00, 0x2f, 0x1a, 0xcd, 0x30, 0x31, 0x65, 0x15, 0x14, 0x06, 0x07, 0x27, 0x36, 0x36, 0x35, 0x35,
-    0x01, 0x35, 0x3c, 0x38, 0x47, 0x24, 0x24, 0xb2, 0x4e, 0x4f, 0x97, 0x34, 0x34, 0x36, 0x6a, 0x44,
-    0x50, 0x00, 0xff, 0xff, 0x00, 0x40, 0x00, 0x00, 0x04, 0xcf, 0x06, 0x15, 0x04, 0x26, 0x00, 0x4a,
-    0x00, 0x00, 0x00, 0x07, 0x00, 0x4a, 0x02, 0x1d, 0x00, 0x00, 0x00, 0x03, 0x00, 0x31, 0x00, 0x00,
-    0x03, 0xa1, 0x06, 0x15, 0x00, 0x10, 0x00, 0x14, 0x00, 0x18, 0x00, 0x1b, 0x40, 0x0f, 0x18, 0x06,
-    0x17, 0x0a, 0x72, 0x13, 0x14, 0x06, 0x72, 0x0d, 0x06, 0x01, 0x72, 0x01, 0x0a, 0x00, 0x3f, 0x2b,
-    0x32, 0x2b, 0x32, 0x2b, 0x3f, 0x30, 0x31, 0x61, 0x23, 0x11, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16,
-    0x17, 0x07, 0x26, 0x26, 0x23, 0x22, 0x06, 0x15, 0x17, 0x15, 0x21, 0x35, 0x21, 0x11, 0x23, 0x11,
-    0x01, 0x5c, 0x77, 0x57, 0xa1, 0x6f, 0x43, 0x8a, 0x47, 0x14, 0x35, 0x74, 0x50, 0x79, 0x7e, 0xfe,
-    0xfd, 0xd7, 0x03, 0x70, 0x78, 0x04, 0xac, 0x75, 0xa1, 0x53, 0x1e, 0x1d, 0x68, 0x17, 0x1e, 0x80,
-    0x7b, 0x72, 0x62, 0x62, 0xfb, 0xc6, 0x04, 0x3a, 0x00, 0x03, 0x00, 0x40, 0x00, 0x00, 0x03, 0xaf,
-    0x06, 0x15, 0x00, 0x12, 0x00, 0x16, 0x00, 0x1a, 0x00, 0x1b, 0x40, 0x0f, 0x19, 0x1a, 0x06, 0x72,
-    0x14, 0x00, 0x72, 0x0e, 0x06, 0x01, 0x72, 0x13, 0x01, 0x0a, 0x72, 0x00, 0x2b, 0x32, 0x2b, 0x32,
-    0x2b, 0x2b, 0x32, 0x30, 0x31, 0x61, 0x23, 0x11, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x16, 0x17,
-    0x07, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x15, 0x01, 0x11, 0x33, 0x11, 0x01, 0x15, 0x21, 0x35,
-    0x01, 0x6b, 0x78, 0x4e, 0x92, 0x67, 0x2e, 0x7d, 0x89, 0x41, 0x3e, 0x56, 0x98, 0x42, 0x44, 0x60,
-    0x32, 0x01, 0xcd, 0x77, 0xfe, 0xbe, 0xfd, 0xd3, 0x04, 0xc0, 0x6f, 0x98, 0x4e, 0x11, 0x1c, 0x10,
-    0x56, 0x11, 0x18, 0x37, 0x68, 0x4c, 0xfb, 0x40, 0x05, 0xd8, 0xfa, 0x28, 0x04, 0x3a, 0x62, 0x62,
-    0x00, 0x05, 0x00, 0x40, 0x00, 0x00, 0x05, 0xf4, 0x06, 0x15, 0x00, 0x11, 0x00, 0x15, 0x00, 0x26,
-    0x00, 0x2a, 0x00, 0x2e, 0x00, 0x25, 0x40, 0x14, 0x23, 0x1c, 0x01, 0x72, 0x2e, 0x2a, 0x14, 0x15,
-    0x06, 0x72, 0x0d, 0x06, 0x01, 0x72, 0x2d, 0x17, 0x17, 0x01, 0x0a, 0x72, 0x00, 0x2b, 0x32, 0x11,
-    0x33, 0x2b, 0x32, 0x2b, 0x32, 0x32, 0x32, 0x2b, 0x32, 0x30, 0x31, 0x61, 0x23, 0x11, 0x34, 0x36,
-    0x36, 0x33, 0x32, 0x16, 0x17, 0x07, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x15, 0x05, 0x15, 0x21,
-    0x35, 0x01, 0x23, 0x11, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x17, 0x07, 0x26, 0x26, 0x23, 0x22,
-    0x06, 0x15, 0x17, 0x15, 0x21, 0x35, 0x21, 0x11, 0x23, 0x11, 0x01, 0x6b, 0x78, 0x4d, 0x8f, 0x63,
-    0x20, 0x41, 0x1f, 0x09, 0x18, 0x34, 0x21, 0x41, 0x5e, 0x32, 0x01, 0x39, 0xfd, 0x9c, 0x03, 0x6f,
-    0x77, 0x56, 0xa2, 0x6f, 0x43, 0x8a, 0x47, 0x14, 0x35, 0x74, 0x50, 0x79, 0x7e, 0xfe, 0xfd, 0xd7,
-    0x03, 0x70, 0x78, 0x04, 0xc0, 0x6f, 0x98, 0x4e, 0x07, 0x09, 0x66, 0x07, 0x05, 0x37, 0x68, 0x4c,
-    0x86, 0x62, 0x62, 0xfb, 0xc6, 0x04, 0xac, 0x75, 0xa1, 0x53, 0x1e, 0x1d, 0x68, 0x17, 0x1e, 0x80,
-    0x7b, 0x72, 0x62, 0x62, 0xfb, 0xc6, 0x04, 0x3a, 0x00, 0x05, 0x00, 0x40, 0x00, 0x00, 0x05, 0xf4,
-    0x06, 0x15, 0x00, 0x11, 0x00, 0x15, 0x00, 0x28, 0x00, 0x2c, 0x00, 0x30, 0x00, 0x29, 0x40, 0x17,
-    0x2b, 0x00, 0x72, 0x24, 0x1c, 0x01, 0x72, 0x2e, 0x14, 0x14, 0x2d, 0x15, 0x06, 0x72, 0x0d, 0x06,
-    0x01, 0x72, 0x29, 0x17, 0x01, 0x0a, 0x72, 0x00, 0x2b, 0x32, 0x32, 0x2b, 0x32, 0x2b, 0x32, 0x32,
-    0x11, 0x33, 0x2b, 0x32, 0x2b, 0x30, 0x31, 0x61, 0x23, 0x11, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16,
-    0x17, 0x07, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x15, 0x05, 0x15, 0x21, 0x35, 0x01, 0x23, 0x11,
-    0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x16, 0x17, 0x07, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x15,
-    0x01, 0x11, 0x33, 0x11, 0x01, 0x15, 0x21, 0x35, 0x01, 0x6b, 0x78, 0x4d, 0x8f, 0x63, 0x20, 0x41,
-    0x1f, 0x09, 0x18, 0x34, 0x21, 0x41, 0x5e, 0x32, 0x01, 0x3e, 0xfd, 0x97, 0x03, 0x6f, 0x77, 0x4d,
-    0x92, 0x67, 0x2e, 0x7d, 0x8a, 0x41, 0x3e, 0x57, 0x98, 0x41, 0x44, 0x60, 0x33, 0x01, 0xcd, 0x78,
-    0xfe, 0xbd, 0xfd, 0xd3, 0x04, 0xc0, 0x6f, 0x98, 0x4e, 0x07, 0x09, 0x66, 0x07, 0x05, 0x37, 0x68,
-    0x4c, 0x86, 0x62, 0x62, 0xfb, 0xc6, 0x04, 0xc0, 0x6f, 0x98, 0x4e, 0x11, 0x1c, 0x10, 0x56, 0x11,
-    0x18, 0x37, 0x68, 0x4c, 0xfb, 0x40, 0x05, 0xd8, 0xfa, 0x28, 0x04, 0x3a, 0x62, 0x62, 0x00, 0x04,
-    0x00, 0x40, 0xff, 0xec, 0x04, 0x6f, 0x06, 0x15, 0x00, 0x03, 0x00, 0x17, 0x00, 0x1b, 0x00, 0x2d,
-    0x00, 0x25, 0x40, 0x14, 0x22, 0x29, 0x0b, 0x72, 0x13, 0x0a, 0x72, 0x09, 0x1c, 0x1c, 0x0d, 0x0d,
-    0x04, 0x01, 0x72, 0x18, 0x02, 0x03, 0x06, 0x72, 0x00, 0x2b, 0x32, 0x32, 0x2b, 0x32, 0x11, 0x33,
-    0x11, 0x33, 0x2b, 0x2b, 0x32, 0x30, 0x31, 0x41, 0x15, 0x21, 0x35, 0x01, 0x32, 0x16, 0x17, 0x15,
-    0x23, 0x35, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x15, 0x11, 0x23, 0x11, 0x34, 0x36, 0x36, 0x01,
-    0x15, 0x21, 0x35, 0x13, 0x33, 0x11, 0x14, 0x16, 0x16, 0x33, 0x32, 0x36, 0x37, 0x17, 0x06, 0x06,
-    0x23, 0x22, 0x26, 0x26, 0x35, 0x01, 0x54, 0xfe, 0xec, 0x01, 0xe9, 0x52, 0xb8, 0x49, 0x78, 0x21,
-    0x79, 0x32, 0x41, 0x5c, 0x30, 0x78, 0x4b, 0x8b, 0x02, 0x93, 0xfd, 0xe1, 0xc7, 0x78, 0x28, 0x40,
-    0x25, 0x1b, 0x32, 0x14, 0x05, 0x16, 0x46, 0x23, 0x45, 0x6a, 0x3d, 0x04, 0x3a, 0x62, 0x62, 0x01,
-    0xdb, 0x2f, 0x25, 0xd1, 0x93, 0x13, 0x18, 0x38, 0x6a, 0x4c, 0xfb, 0x40, 0x04, 0xc0, 0x6f, 0x98,
-    0x4e, 0xfe, 0x25, 0x62, 0x62, 0x01, 0x16, 0xfb, 0xb8, 0x4b, 0x4d, 0x19, 0x07, 0x03, 0x65, 0x07,
-    0x09, 0x34, 0x7c, 0x6c, 0x00, 0x04, 0x00, 0x66, 0xff, 0xec, 0x06, 0x33, 0x05, 0xef, 0x00, 0x1b,
-    0x00, 0x1f, 0x00, 0x31, 0x00, 0x67, 0x00, 0x31, 0x40, 0x1b, 0x3b, 0x32, 0x40, 0x64, 0x60, 0x5b,
-    0x0b, 0x72, 0x01, 0x45, 0x49, 0x40, 0x07, 0x72, 0x26, 0x2d, 0x0b, 0x72, 0x1e, 0x10, 0x1f, 0x06,
-    0x72, 0x14, 0x0a, 0x01, 0x72, 0x00, 0x2b, 0x32, 0x2b, 0x32, 0x32, 0x2b, 0x32, 0x2b, 0x32, 0xcc,
-    0x32, 0x2b, 0xcc, 0x33, 0x12, 0x39, 0x39, 0x30, 0x31, 0x41, 0x23, 0x2e, 0x02, 0x35, 0x34, 0x3e,
-    0x02, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x23, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06, 0x15, 0x14, 0x1e,
-    0x02, 0x25, 0x15, 0x21, 0x35, 0x37, 0x33, 0x11, 0x14, 0x16, 0x16, 0x33, 0x32, 0x36, 0x37, 0x17,
-    0x06, 0x06, 0x23, 0x22, 0x26, 0x26, 0x35, 0x05, 0x34, 0x26, 0x26, 0x27, 0x2e, 0x03, 0x35, 0x34,
-    0x3e, 0x02, 0x33, 0x32, 0x16, 0x16, 0x15, 0x23, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x15,
-    0x14, 0x1e, 0x02, 0x17, 0x1e, 0x02, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x26, 0x26, 0x35, 0x33,
-    0x1e, 0x02, 0x33, 0x32, 0x36, 0x36, 0x03, 0x97, 0x3f, 0x25, 0x4c, 0x33, 0x2e, 0x54, 0x71, 0x42,
-    0x67, 0x85, 0x4c, 0x1e, 0x78, 0x2c, 0x62, 0x51, 0x5a, 0x67, 0x22, 0x2c, 0x22, 0x02, 0x88, 0xfd,
-    0xe6, 0xc2, 0x78, 0x28, 0x41, 0x24, 0x1b, 0x32, 0x15, 0x05, 0x19, 0x41, 0x26, 0x45, 0x6a, 0x3d,
-    0xfe, 0x5e, 0x2c, 0x7d, 0x78, 0x5b, 0x8d, 0x60, 0x32, 0x35, 0x63, 0x8d, 0x58, 0x7e, 0xb2, 0x60,
-    0x78, 0x41, 0x7d, 0x5a, 0x5d, 0x73, 0x35, 0x16, 0x3e, 0x72, 0x5a, 0x83, 0xa7, 0x51, 0x38, 0x69,
-    0x93, 0x5b, 0x89, 0xbe, 0x61, 0x78, 0x05, 0x5f, 0x88, 0x44, 0x5b, 0x7c, 0x40, 0x03, 0x0b, 0x63,
-    0x9c, 0x8b, 0x49, 0x3d, 0x65, 0x48, 0x27, 0x40, 0x69, 0x81, 0x41, 0x4d, 0x75, 0x41, 0x63, 0x52,
-    0x45, 0x69, 0x61, 0x6e, 0xe5, 0x62, 0x62, 0x4b, 0xfc, 0x9b, 0x4e, 0x58, 0x24, 0x07, 0x04, 0x64,
-    0x09, 0x08, 0x3d, 0x88, 0x70, 0x0d, 0x2d, 0x55, 0x48, 0x19, 0x14, 0x32, 0x46, 0x62, 0x43, 0x3c,
-    0x6b, 0x51, 0x2e, 0x55, 0x92, 0x5c, 0x38, 0x64, 0x40, 0x38, 0x56, 0x2e, 0x24, 0x3b, 0x32, 0x2c,
-    0x14, 0x1e, 0x53, 0x78, 0x56, 0x43, 0x6f, 0x51, 0x2c, 0x5c, 0x94, 0x55, 0x55, 0x61, 0x28, 0x36,
-    0x59, 0x00, 0x00, 0x15, 0x00, 0x59, 0xfe, 0x72, 0x07, 0xec, 0x05, 0xae, 0x00, 0x05, 0x00, 0x0b,
-    0x00, 0x11, 0x00, 0x17, 0x00, 0x1b, 0x00, 0x1f, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2b, 0x00, 0x2f,
-    0x00, 0x33, 0x00, 0x37, 0x00, 0x3b, 0x00, 0x3f, 0x00, 0x43, 0x00, 0x47, 0x00, 0x57, 0x00, 0x73,
-    0x00, 0x8c, 0x00, 0x9a, 0x00, 0xa8, 0x00, 0x00, 0x53, 0x23, 0x11, 0x21, 0x15, 0x23, 0x21, 0x23,
-    0x35, 0x21, 0x11, 0x23, 0x01, 0x21, 0x11, 0x33, 0x15, 0x33, 0x05, 0x21, 0x35, 0x33, 0x35, 0x33,
-    0x01, 0x21, 0x35, 0x21, 0x05, 0x21, 0x35, 0x21, 0x11, 0x21, 0x35, 0x21, 0x01, 0x15, 0x23, 0x35,
-    0x13, 0x15, 0x23, 0x35, 0x01, 0x21, 0x35, 0x21, 0x01, 0x15, 0x23, 0x35, 0x01, 0x21, 0x35, 0x21,
-    0x05, 0x21, 0x35, 0x21, 0x01, 0x15, 0x23, 0x35, 0x13, 0x15, 0x23, 0x35, 0x01, 0x15, 0x23, 0x35,
-    0x07, 0x11, 0x33, 0x11, 0x14, 0x06, 0x23, 0x22, 0x26, 0x35, 0x33, 0x14, 0x16, 0x33, 0x32, 0x36,
-    0x25, 0x23, 0x27, 0x33, 0x32, 0x36, 0x35, 0x34, 0x26, 0x23, 0x23, 0x11, 0x23, 0x11, 0x33, 0x32,
-    0x16, 0x16, 0x15, 0x14, 0x06, 0x06, 0x07, 0x22, 0x06, 0x07, 0x06, 0x14, 0x07, 0x23, 0x37, 0x33,
-    0x32, 0x36, 0x35, 0x34, 0x26, 0x23, 0x23, 0x37, 0x33, 0x32, 0x14, 0x17, 0x14, 0x16, 0x31, 0x1e,
-    0x02, 0x15, 0x14, 0x06, 0x01, 0x15, 0x14, 0x06, 0x23, 0x22, 0x26, 0x35, 0x35, 0x34, 0x36, 0x33,
-    0x32, 0x16, 0x07, 0x35, 0x34, 0x26, 0x23, 0x22, 0x06, 0x15, 0x15, 0x14, 0x16, 0x33, 0x32, 0x36,
-    0xca, 0x71, 0x01, 0x35, 0xc4, 0x06, 0xb3, 0xc7, 0x01, 0x36, 0x6f, 0xfa, 0x11, 0xfe, 0xcb, 0x71,
-    0xc4, 0x06, 0x5e, 0xfe, 0xca, 0xc7, 0x6f, 0xfe, 0x51, 0xfe, 0xea, 0x01, 0x16, 0xfc, 0xe0, 0xfe,
-    0xec, 0x01, 0x14, 0xfe, 0xec, 0x01, 0x14, 0x04, 0xcf, 0x6f, 0x6f, 0x6f, 0xfd, 0x30, 0xfe, 0xeb,
-    0x01, 0x15, 0xfc, 0x1d, 0x71, 0x04, 0x54, 0xfe, 0xeb, 0x01, 0x15, 0x01, 0x90, 0xfe, 0xea, 0x01,
-    0x16, 0xfa, 0x8d, 0x71, 0x71, 0x71, 0x07, 0x93, 0x6f, 0xe8, 0x5c, 0x6b, 0x50, 0x58, 0x6d, 0x5d,
-    0x38, 0x30, 0x29, 0x36, 0xfd, 0xc2, 0x96, 0x01, 0x76, 0x3b, 0x3b, 0x3b, 0x3b, 0x5d, 0x5f, 0xbc,
-    0x42, 0x5f, 0x33, 0x22, 0x41, 0x2f, 0x01, 0x04, 0x02, 0x0c, 0x0e, 0xb9, 0x30, 0x89, 0x34, 0x33,
-    0x33, 0x34, 0x77, 0x01, 0x97, 0x0e, 0x0c, 0x07, 0x2b, 0x3a, 0x1e, 0x69, 0xfe, 0x84, 0x7f, 0x66,
-    0x67, 0x81, 0x80, 0x66, 0x67, 0x80, 0x5c, 0x4a, 0x41, 0x40, 0x4a, 0x4b, 0x41, 0x40, 0x49, 0x04,
-    0x91, 0x01, 0x1d, 0x74, 0x74, 0xfe, 0xe3, 0xf9, 0xe1, 0x01, 0x3b, 0xca, 0x71, 0x71, 0xca, 0xfe,
-    0xc5, 0x71, 0x71, 0x71, 0x06, 0x57, 0x74, 0xfb, 0x74, 0xf9, 0xf9, 0x02, 0xf2, 0xfa, 0xfa, 0xfa,
-    0x5e, 0x71, 0x02, 0x3f, 0xf9, 0xf9, 0x04, 0x18, 0x74, 0x74, 0x74, 0xfc, 0xee, 0xfc, 0xfc, 0x01,
-    0x78, 0xfa, 0xfa, 0xfe, 0x88, 0xfc, 0xfc, 0xf3, 0x01, 0x7a, 0xfe, 0x86, 0x4f, 0x5c, 0x51, 0x53,
-    0x2e, 0x2d, 0x37, 0x72, 0x46, 0x29, 0x27, 0x29, 0x1e, 0xfe, 0x2f, 0x02, 0x25, 0x20, 0x42, 0x34,
-    0x22, 0x38, 0x24, 0x04, 0x13, 0x01, 0x04, 0x01, 0xf4, 0x4b, 0x2c, 0x27, 0x27, 0x2f, 0x46, 0x01,
-    0x05, 0x01, 0x13, 0x04, 0x26, 0x39, 0x22, 0x4c, 0x4f, 0x01, 0x48, 0x70, 0x61, 0x7a, 0x7a, 0x61,
-    0x70, 0x61, 0x7a, 0x7a, 0xd1, 0x70, 0x44, 0x4f, 0x4f, 0x44, 0x70, 0x45, 0x4e, 0x4e, 0x00, 0x05,
-    0x00, 0x5c, 0xfd, 0xd5, 0x07, 0xd7, 0x08, 0x73, 0x00, 0x03, 0x00, 0x1e, 0x00, 0x22, 0x00, 0x26,
-    0x00, 0x2a, 0x00, 0x00, 0x53, 0x09, 0x02, 0x03, 0x33, 0x34, 0x36, 0x37, 0x36, 0x36, 0x35, 0x34,
-    0x26, 0x23, 0x22, 0x06, 0x07, 0x33, 0x36, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14, 0x06, 0x07, 0x0e,
-    0x02, 0x13, 0x35, 0x23, 0x15, 0x13, 0x35, 0x33, 0x15, 0x03, 0x35, 0x33, 0x15, 0x5c, 0x03, 0xbc,
-    0x03, 0xbf, 0xfc, 0x41, 0x77, 0xca, 0x19, 0x29, 0x44, 0x62, 0xa7, 0x95, 0x7f, 0xb1, 0x02, 0xcb,
-    0x02, 0x3e, 0x27, 0x38, 0x39, 0x35, 0x28, 0x2f, 0x3d, 0x1d, 0xc9, 0xca, 0x7f, 0x04, 0x06, 0x04,
-    0x02, 0x83, 0x03, 0xcf, 0xfc, 0x31, 0xfc, 0x31, 0x02, 0xde, 0x33, 0x3e, 0x1b, 0x25, 0x81, 0x52,
-    0x80, 0x97, 0x7d, 0x8d, 0x37, 0x30, 0x40, 0x34, 0x34, 0x4d, 0x1a, 0x21, 0x3a, 0x4e, 0xfe, 0xbb,
-    0xaa, 0xaa, 0xfd, 0x48, 0x04, 0x04, 0x0a, 0x9a, 0x04, 0x04, 0x00, 0x01, 0x00, 0x4c, 0x00, 0x00,
-    0x02, 0x9b, 0x03, 0x20, 0x00, 0x1c, 0x00, 0x10, 0xb5, 0x03, 0x1c, 0x1c, 0x0b, 0x13, 0x02, 0x00,
-    0x2f, 0xcc, 0x32, 0x33, 0x11, 0x33, 0x30, 0x31, 0x65, 0x15, 0x21, 0x35, 0x01, 0x3e, 0x02, 0x35,
-    0x34, 0x26, 0x23, 0x22, 0x06, 0x15, 0x23, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x16, 0x15, 0x14,
-    0x06, 0x06, 0x07, 0x07, 0x02, 0x9b, 0xfd, 0xc6, 0x01, 0x21, 0x32, 0x3b, 0x1b, 0x51, 0x4e, 0x5a,
-    0x5b, 0x6a, 0x45, 0x7f, 0x59, 0x53, 0x78, 0x41, 0x32, 0x53, 0x35, 0xd5, 0x59, 0x59, 0x4c, 0x01,
-    0x1b, 0x30, 0x4c, 0x3e, 0x1c, 0x3e, 0x4d, 0x5c, 0x45, 0x44, 0x71, 0x44, 0x36, 0x65, 0x47, 0x33,
-    0x5e, 0x5d, 0x32, 0xc5, 0x00, 0x01, 0x00, 0x7f, 0x00, 0x00, 0x01, 0xd0, 0x03, 0x16, 0x00, 0x06,
-    0x00, 0x23, 0x40, 0x15, 0x04, 0x05, 0x05, 0x03, 0x03, 0x2f, 0x00, 0x7f, 0x00, 0x02, 0x0f, 0x00,
-    0x5f, 0x00, 0xaf, 0x00, 0xff, 0x00, 0x04, 0x00, 0x01, 0x00, 0x2f, 0xcd, 0x5d, 0x71, 0x32, 0x11,
-    0x33, 0x11, 0x33, 0x30, 0x31, 0x41, 0x11, 0x23, 0x11, 0x07, 0x35, 0x25, 0x01, 0xd0, 0x69, 0xe8,
-    0x01, 0x44, 0x03, 0x16, 0xfc, 0xea, 0x02, 0x96, 0x45, 0x5b, 0x6a, 0x00, 0x00, 0x02, 0x00, 0x58,
-    0xff, 0xf5, 0x02, 0x8b, 0x03, 0x20, 0x00, 0x11, 0x00, 0x23, 0x00, 0x0c, 0xb3, 0x17, 0x0e, 0x20,
-    0x05, 0x00, 0x2f, 0x33, 0xc4, 0x32, 0x30, 0x31, 0x41, 0x15, 0x14, 0x06, 0x06, 0x23, 0x22, 0x26,
-    0x26, 0x35, 0x35, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x16, 0x03, 0x35, 0x34, 0x26, 0x26, 0x23,
-    0x22, 0x06, 0x06, 0x15, 0x15, 0x14, 0x16, 0x16, 0x33, 0x32, 0x36, 0x36, 0x02, 0x8b, 0x43, 0x7e,
-    0x57, 0x57, 0x7f, 0x45, 0x44, 0x7f, 0x56, 0x58, 0x7e, 0x44, 0x69, 0x28, 0x4e, 0x3b, 0x3a, 0x4e,
-    0x28, 0x28, 0x50, 0x3a, 0x3a, 0x4e, 0x27, 0x01, 0xcf, 0x89, 0x6f, 0x96, 0x4c, 0x4c, 0x96, 0x6f,
-    0x89, 0x6f, 0x96, 0x4c, 0x4c, 0x96, 0xfe, 0xff, 0x9c, 0x4d, 0x6a, 0x37, 0x37, 0x6a, 0x4d, 0x9c,
-    0x4c, 0x6b, 0x39, 0x39, 0x6b, 0x00, 0x00, 0x01, 0x00, 0x56, 0xff, 0xf6, 0x03, 0x84, 0x04, 0x9d,
-    0x00, 0x32, 0x00, 0x17, 0x40, 0x0a, 0x14, 0x1e, 0x1e, 0x26, 0x01, 0x31, 0x0a, 0x0c, 0x26, 0x7e,
-    0x00, 0x3f, 0x33, 0x3f, 0x33, 0x12, 0x39, 0x2f, 0x33, 0x30, 0x31, 0x65, 0x33, 0x32, 0x3e, 0x02,
-    0x35, 0x35, 0x34, 0x2e, 0x02, 0x23, 0x22, 0x06, 0x06, 0x15, 0x14, 0x16, 0x16, 0x33, 0x32, 0x3e,
-    0x02, 0x37, 0x17, 0x0e, 0x02, 0x23, 0x22, 0x26, 0x26, 0x35, 0x34, 0x36, 0x36, 0x33, 0x32, 0x1e,
-    0x02, 0x15, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x23, 0x01, 0x10, 0x17, 0x84, 0xb9, 0x73, 0x36, 0x2a,
-    0x4e, 0x6a, 0x40, 0x58, 0x7f, 0x44, 0x3f, 0x7c, 0x5a, 0x49, 0x71, 0x50, 0x2b, 0x01, 0x29, 0x03,
-    0x5e, 0xa3, 0x6d, 0x7a, 0xaa, 0x59, 0x62, 0xb5, 0x7d, 0x66, 0x99, 0x68, 0x33, 0x40, 0x8e, 0xe8,
-    0xa7, 0x18, 0x5e, 0x43, 0x7b, 0xa8, 0x66, 0xb1, 0x56, 0x81, 0x57, 0x2c, 0x55, 0x8b, 0x50, 0x4b,
-    0x87, 0x53, 0x30, 0x4f, 0x5c, 0x2b, 0x3a, 0x4e, 0x8c, 0x57, 0x6d, 0xb3, 0x68, 0x71, 0xb9, 0x70,
-    0x42, 0x7c, 0xac, 0x69, 0x5e, 0x87, 0xe6, 0xab, 0x5e, 0x00, 0x00, 0x04, 0x00, 0x5d, 0xff, 0xf0,
-    0x03, 0xa5, 0x04, 0x9d, 0x00, 0x12, 0x00, 0x22, 0x00, 0x34, 0x00, 0x44, 0x00, 0x1d, 0x40, 0x0d,
-    0x28, 0x17, 0x17, 0x41, 0x0e, 0x0e, 0x05, 0x39, 0x31, 0x7e, 0x1f, 0x05, 0x0b, 0x00, 0x3f, 0x33,
-    0x3f, 0x33, 0x12, 0x39, 0x2f, 0x33, 0x33, 0x11, 0x33, 0x30, 0x31, 0x41, 0x14, 0x0e, 0x02, 0x23,
-    0x22, 0x26, 0x26, 0x35, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x1e, 0x02, 0x07, 0x34, 0x26, 0x26, 0x23,
-    0x22, 0x06, 0x06, 0x15, 0x14, 0x16, 0x16, 0x33, 0x32, 0x36, 0x36, 0x13, 0x14, 0x0e, 0x02, 0x23,
-    0x22, 0x2e, 0x02, 0x35, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x16, 0x07, 0x34, 0x26, 0x26, 0x23,
-    0x22, 0x06, 0x06, 0x15, 0x14, 0x16, 0x16, 0x33, 0x32, 0x36, 0x36, 0x03, 0xa5, 0x41, 0x72, 0x98,
-    0x58, 0x77, 0xbf, 0x6f, 0x3f, 0x71, 0x99, 0x5a, 0x59, 0x99, 0x73, 0x40, 0x79, 0x4f, 0x87, 0x56,
-    0x57, 0x88, 0x4d, 0x4d, 0x89, 0x58, 0x56, 0x86, 0x4e, 0x57, 0x3a, 0x69, 0x8c, 0x52, 0x54, 0x8d,
-    0x69, 0x3a, 0x65, 0xaf, 0x6e, 0x6d, 0xb0, 0x66, 0x77, 0x47, 0x79, 0x4c, 0x4e, 0x78, 0x44, 0x45,
-    0x79, 0x4e, 0x4c, 0x78, 0x46, 0x01, 0x37, 0x50, 0x7b, 0x52, 0x2a, 0x4a, 0x92, 0x6b, 0x47, 0x73,
-    0x54, 0x2d, 0x2d, 0x54, 0x73, 0x43, 0x46, 0x67, 0x3a, 0x3a, 0x67, 0x46, 0x49, 0x66, 0x36, 0x36,
-    0x66, 0x02, 0x6d, 0x41, 0x6c, 0x50, 0x2b, 0x2b, 0x50, 0x6c, 0x41, 0x67, 0x8e, 0x49, 0x49, 0x8e,
-    0x69, 0x40, 0x61, 0x38, 0x34, 0x61, 0x44, 0x41, 0x5f, 0x34, 0x34, 0x5f, 0x00, 0x01, 0x00, 0x44,
-    0x00, 0x00, 0x03, 0xa6, 0x04, 0x8d, 0x00, 0x06, 0x00, 0x0e, 0xb5, 0x05, 0x01, 0x06, 0x7d, 0x03,
-    0x0a, 0x00, 0x3f, 0x3f, 0x33, 0x33, 0x30, 0x31, 0x41, 0x15, 0x01, 0x23, 0x01, 0x21, 0x35, 0x03,
-    0xa6, 0xfd, 0xd5, 0x7e, 0x02, 0x29, 0xfd, 0x1e, 0x04, 0x8d, 0x46, 0xfb, 0xb9, 0x04, 0x25, 0x68,
-    0x00, 0x01, 0x00, 0x7b, 0xff, 0xf0, 0x03, 0xa6, 0x04, 0x97, 0x00, 0x31, 0x00, 0x15, 0x40, 0x09,
-    0x16, 0x1f, 0x1f, 0x0e, 0x27, 0x0b, 0x03, 0x00, 0x7e, 0x00, 0x3f, 0x32, 0x3f, 0x33, 0x39, 0x2f,
-    0x33, 0x30, 0x31, 0x41, 0x33, 0x15, 0x23, 0x22, 0x0e, 0x02, 0x15, 0x15, 0x14, 0x1e, 0x02, 0x33,
-    0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x07, 0x27, 0x3e, 0x02, 0x33,
-    0x32, 0x16, 0x16, 0x15, 0x14, 0x06, 0x06, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x35, 0x34, 0x3e, 0x02,
-    0x02, 0xe8, 0x13, 0x11, 0x77, 0xbb, 0x82, 0x43, 0x2d, 0x51, 0x6d, 0x3f, 0x56, 0x7b, 0x42, 0x3e,
-    0x7d, 0x5f, 0x4e, 0x8a, 0x55, 0x03, 0x2b, 0x04, 0x60, 0xa5, 0x6a, 0x7d, 0xa7, 0x54, 0x5f, 0xaf,
-    0x7a, 0x61, 0x9a, 0x6e, 0x3a, 0x4f, 0x9c, 0xe8, 0x04, 0x97, 0x69, 0x42, 0x7e, 0xb7, 0x74, 0xa1,
-    0x4e, 0x7b, 0x55, 0x2d, 0x4f, 0x85, 0x51, 0x4f, 0x81, 0x4d, 0x41, 0x6c, 0x43, 0x3d, 0x44, 0x81,
-    0x55, 0x69, 0xaf, 0x69, 0x70, 0xb5, 0x6a, 0x42, 0x75, 0x9e, 0x5d, 0x69, 0x97, 0xf1, 0xaa, 0x5a,
-    0x00, 0x01, 0x00, 0x92, 0xff, 0xf0, 0x03, 0xb0, 0x04, 0x8d, 0x00, 0x23, 0x00, 0x17, 0x40, 0x0a,
-    0x21, 0x09, 0x09, 0x02, 0x19, 0x11, 0x0b, 0x05, 0x02, 0x7d, 0x00, 0x3f, 0x33, 0x3f, 0x33, 0x12,
-    0x39, 0x2f, 0x33, 0x30, 0x31, 0x41, 0x27, 0x13, 0x21, 0x15, 0x21, 0x03, 0x36, 0x36, 0x33, 0x32,
-    0x16, 0x16, 0x15, 0x14, 0x06, 0x06, 0x23, 0x22, 0x26, 0x26, 0x27, 0x33, 0x16, 0x16, 0x33, 0x32,
-    0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06, 0x01, 0x10, 0x5f, 0x46, 0x02, 0x9a, 0xfd,
-    0xca, 0x2f, 0x21, 0x82, 0x54, 0x76, 0xb2, 0x65, 0x54, 0xb2, 0x8d, 0x60, 0xad, 0x74, 0x0a, 0x74,
-    0x0e, 0x9c, 0x6d, 0x62, 0x7d, 0x3c, 0x45, 0x86, 0x60, 0x63, 0x6b, 0x02, 0x36, 0x1b, 0x02, 0x3c,
-    0x6d, 0xfe, 0x90, 0x14, 0x2a, 0x5c, 0xa8, 0x76, 0x6d, 0xb0, 0x67, 0x48, 0x91, 0x6c, 0x6d, 0x72,
-    0x45, 0x82, 0x59, 0x51, 0x7b, 0x45, 0x2d, 0x00, 0x00, 0x02, 0x00, 0x3d, 0x00, 0x00, 0x03, 0xdf,
-    0x04, 0x8d, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x15, 0x40, 0x09, 0x00, 0x01, 0x01, 0x0a, 0x04, 0x0b,
-    0x7d, 0x0a, 0x12, 0x00, 0x3f, 0x3f, 0x33, 0x12, 0x39, 0x2f, 0x33, 0x30, 0x31, 0x41, 0x15, 0x21,
-    0x27, 0x01, 0x33, 0x07, 0x01, 0x01, 0x11, 0x23, 0x11, 0x03, 0xdf, 0xfc, 0x5f, 0x01, 0x02, 0x59,
-    0x60, 0x88, 0xfe, 0x5a, 0x02, 0x4f, 0x78, 0x01, 0x86, 0x68, 0x4a, 0x03, 0x25, 0xe8, 0xfd, 0xe1,
-    0x03, 0x07, 0xfb, 0x73, 0x04, 0x8d, 0x00, 0x02, 0x00, 0x56, 0xff, 0xf0, 0x03, 0x95, 0x04, 0x9d,
-    0x00, 0x1d, 0x00, 0x3d, 0x00, 0x1d, 0x40, 0x0d, 0x1f, 0x00, 0x00, 0x1d, 0x1e, 0x1e, 0x12, 0x34,
-    0x2a, 0x0b, 0x09, 0x12, 0x7e, 0x00, 0x3f, 0x33, 0x3f, 0x33, 0x12, 0x39, 0x2f, 0x33, 0x33, 0x11,
-    0x33, 0x30, 0x31, 0x41, 0x33, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06,
-    0x15, 0x23, 0x34, 0x36, 0x36, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x23, 0x15,
-    0x35, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x33, 0x14,
-    0x16, 0x16, 0x33, 0x32, 0x36, 0x36, 0x35, 0x34, 0x2e, 0x02, 0x23, 0x01, 0x6b, 0x70, 0x62, 0x84,
-    0x43, 0x39, 0x76, 0x5c, 0x50, 0x7e, 0x4a, 0x78, 0x6a, 0xb4, 0x71, 0x58, 0x8f, 0x66, 0x37, 0x33,
-    0x64, 0x95, 0x61, 0x84, 0x84, 0x6e, 0xa0, 0x67, 0x31, 0x3d, 0x6e, 0x95, 0x58, 0x50, 0x97, 0x79,
-    0x47, 0x77, 0x4e, 0x89, 0x59, 0x5b, 0x81, 0x44, 0x2e, 0x56, 0x76, 0x48, 0x02, 0x85, 0x39, 0x61,
-    0x3b, 0x40, 0x63, 0x39, 0x35, 0x61, 0x43, 0x5f, 0x91, 0x50, 0x2a, 0x54, 0x78, 0x4e, 0x37, 0x67,
-    0x52, 0x30, 0x1a, 0x4b, 0x2c, 0x51, 0x6e, 0x41, 0x50, 0x7c, 0x56, 0x2c, 0x29, 0x53, 0x7e, 0x54,
-    0x44, 0x69, 0x3b, 0x37, 0x67, 0x48, 0x3c, 0x56, 0x37, 0x1a, 0x00, 0x01, 0x00, 0x5b, 0x00, 0x00,
-    0x03, 0xb3, 0x04, 0x9d, 0x00, 0x1e, 0x00, 0x12, 0xb7, 0x0b, 0x14, 0x7e, 0x03, 0x1e, 0x1e, 0x02,
-    0x12, 0x00, 0x3f, 0x33, 0x11, 0x33, 0x3f, 0x33, 0x30, 0x31, 0x65, 0x15, 0x21, 0x35, 0x01, 0x3e,
-    0x02, 0x35, 0x34, 0x26, 0x23, 0x22, 0x06, 0x06, 0x15, 0x23, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16,
-    0x16, 0x15, 0x14, 0x0e, 0x02, 0x07, 0x01, 0x03, 0xb3, 0xfc, 0xc6, 0x01, 0xac, 0x4f, 0x5e, 0x2a,
-    0x85, 0x7e, 0x62, 0x83, 0x41, 0x78, 0x63, 0xb9, 0x82, 0x73, 0xaa, 0x5e, 0x2b, 0x49, 0x5d, 0x34,
-    0xfe, 0x9f, 0x67, 0x67, 0x5b, 0x01, 0xaa, 0x4d, 0x75, 0x62, 0x2d, 0x64, 0x7c, 0x42, 0x73, 0x4b,
-    0x63, 0xa3, 0x61, 0x4e, 0x92, 0x64, 0x37, 0x69, 0x68, 0x68, 0x35, 0xfe, 0xb3, 0x00, 0x00, 0x01,
-    0x00, 0xa0, 0x00, 0x00, 0x02, 0x79, 0x04, 0x90, 0x00, 0x06, 0x00, 0x0a, 0xb3, 0x06, 0x7d, 0x02,
-    0x0a, 0x00, 0x3f, 0x3f, 0x30, 0x31, 0x41, 0x11, 0x23, 0x11, 0x05, 0x35, 0x25, 0x02, 0x79, 0x78,
-    0xfe, 0x9f, 0x01, 0xc7, 0x04, 0x90, 0xfb, 0x70, 0x03, 0xfa, 0x6e, 0x6c, 0x98, 0x00, 0x00, 0x02,
-    0x00, 0x6a, 0xff, 0xf0, 0x03, 0x96, 0x04, 0x9d, 0x00, 0x15, 0x00, 0x2b, 0x00, 0x0e, 0xb5, 0x1c,
-    0x11, 0x7e, 0x27, 0x06, 0x0b, 0x00, 0x3f, 0x33, 0x3f, 0x33, 0x30, 0x31, 0x41, 0x15, 0x14, 0x0e,
-    0x02, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x35, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x1e, 0x02, 0x03, 0x35,
-    0x34, 0x2e, 0x02, 0x23, 0x22, 0x0e, 0x02, 0x15, 0x15, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x3e, 0x02,
-    0x03, 0x96, 0x37, 0x68, 0x96, 0x60, 0x5e, 0x97, 0x6a, 0x38, 0x37, 0x6a, 0x96, 0x5e, 0x60, 0x97,
-    0x69, 0x37, 0x78, 0x24, 0x47, 0x6c, 0x48, 0x46, 0x6c, 0x47, 0x24, 0x24, 0x49, 0x6c, 0x46, 0x48,
-    0x6b, 0x47, 0x23, 0x02, 0xa6, 0xbd, 0x7c, 0xbd, 0x7f, 0x41, 0x41, 0x7f, 0xbd, 0x7c, 0xbd, 0x7c,
-    0xbc, 0x7f, 0x40, 0x40, 0x7f, 0xbc, 0xfe, 0xb9, 0xdb, 0x5b, 0x8f, 0x63, 0x33, 0x33, 0x63, 0x8f,
-    0x5b, 0xdb, 0x5a, 0x90, 0x65, 0x36, 0x36, 0x65, 0x90, 0x00, 0x00, 0x03, 0x00, 0x4c, 0x00, 0x00,
-    0x03, 0xd7, 0x04, 0x8d, 0x00, 0x03, 0x00, 0x09, 0x00, 0x0d, 0x00, 0x1c, 0x40, 0x0c, 0x04, 0x0c,
-    0x0c, 0x0d, 0x0d, 0x08, 0x7d, 0x07, 0x03, 0x03, 0x06, 0x02, 0x00, 0x2f, 0x33, 0x33, 0x11, 0x33,
-    0x3f, 0x33, 0x2f, 0x33, 0x11, 0x33, 0x30, 0x31, 0x65, 0x15, 0x21, 0x35, 0x01, 0x01, 0x23, 0x35,
-    0x01, 0x33, 0x23, 0x15, 0x21, 0x35, 0x03, 0xd7, 0xfc, 0x9e, 0x03, 0x47, 0xfc, 0xde, 0x4e, 0x03,
-    0x22, 0x4e, 0x31, 0xfc, 0xd6, 0x67, 0x67, 0x67, 0x03, 0xd5, 0xfb, 0xc4, 0x55, 0x04, 0x38, 0x67,
-    0x67, 0x00, 0x00, 0x03, 0x00, 0x16, 0x00, 0x00, 0x04, 0x0c, 0x04, 0x8d, 0x00, 0x04, 0x00, 0x09,
-    0x00, 0x0d, 0x00, 0x1b, 0x40, 0x10, 0x08, 0x07, 0x03, 0x04, 0x06, 0x00, 0x0a, 0x0d, 0x08, 0x01,
-    0x0c, 0x0a, 0x72, 0x05, 0x01, 0x7d, 0x00, 0x3f, 0x33, 0x2b, 0x11, 0x17, 0x39, 0x30, 0x31, 0x41,
-    0x01, 0x33, 0x01, 0x23, 0x01, 0x01, 0x17, 0x23, 0x01, 0x01, 0x11, 0x23, 0x11, 0x01, 0xfe, 0x01,
-    0x86, 0x88, 0xfe, 0x3c, 0x51, 0xfe, 0xa8, 0x01, 0x86, 0x04, 0x4e, 0xfe, 0x3b, 0x02, 0x35, 0x77,
-    0x01, 0xf2, 0x02, 0x9b, 0xfd, 0x14, 0x02, 0xec, 0xfd, 0x62, 0x4e, 0x02, 0xec, 0xfd, 0x6f, 0xfe,
-    0x04, 0x01, 0xfc, 0x00, 0x00, 0x01, 0x00, 0x2b, 0x00, 0x00, 0x04, 0x12, 0x04, 0x8d, 0x00, 0x0b,
-    0x00, 0x15, 0x40, 0x0a, 0x07, 0x0a, 0x04, 0x01, 0x04, 0x09, 0x05, 0x03, 0x00, 0x7d, 0x00, 0x3f,
-    0x32, 0x2f, 0x33, 0x17, 0x39, 0x30, 0x31, 0x53, 0x01, 0x01, 0x33, 0x01, 0x01, 0x23, 0x01, 0x01,
-    0x23, 0x01, 0x01, 0xc6, 0x01, 0x55, 0x01, 0x57, 0x90, 0xfe, 0x63, 0x01, 0xad, 0x90, 0xfe, 0x9b,
-    0xfe, 0x9c, 0x8e, 0x01, 0xab, 0xfe, 0x61, 0x04, 0x8d, 0xfe, 0x1f, 0x01, 0xe1, 0xfd, 0xc1, 0xfd,
-    0xb2, 0x01, 0xef, 0xfe, 0x11, 0x02, 0x4e, 0x02, 0x3f, 0x00, 0x00, 0x04, 0x00, 0x33, 0x00, 0x00,
-    0x05, 0xfb, 0x04, 0x8d, 0x00, 0x05, 0x00, 0x0a, 0x00, 0x0f, 0x00, 0x15, 0x00, 0x20, 0x40, 0x0e,
-    0x12, 0x04, 0x10, 0x01, 0x0e, 0x04, 0x0c, 0x01, 0x08, 0x04, 0x06, 0x01, 0x7d, 0x04, 0x00, 0x2f,
-    0x3f, 0x33, 0x11, 0x33, 0x11, 0x33, 0x11, 0x33, 0x11, 0x33, 0x11, 0x33, 0x30, 0x31, 0x41, 0x01,
-    0x33, 0x07, 0x01, 0x23, 0x03, 0x13, 0x13, 0x23, 0x01, 0x01, 0x13, 0x33, 0x01, 0x23, 0x01, 0x01,
-    0x13, 0x23, 0x01, 0x27, 0x01, 0xd3, 0x01, 0x0f, 0x5b, 0x38, 0xfe, 0xde, 0x57, 0xe0, 0xe3, 0x3c,
-    0x5b, 0xfe, 0xc3, 0x04, 0x6e, 0xe1, 0x79, 0xfe, 0xc4, 0x5c, 0xfe, 0xee, 0x01, 0x0b, 0x46, 0x57,
-    0xfe, 0xe4, 0x3a, 0x01, 0x16, 0x03, 0x77, 0xe6, 0xfc, 0x59, 0x04, 0x8d, 0xfc, 0x94, 0xfe, 0xdf,
-    0x04, 0x8d, 0xfc, 0x95, 0x03, 0x6b, 0xfb, 0x73, 0x04, 0x8d, 0xfc, 0x88, 0xfe, 0xeb, 0x03, 0xa7,
-    0xe6, 0x00, 0x00, 0x02, 0x00, 0x19, 0x00, 0x00, 0x04, 0x2c, 0x04, 0x8d, 0x00, 0x04, 0x00, 0x09,
-    0x00, 0x0f, 0xb5, 0x07, 0x03, 0x05, 0x01, 0x7d, 0x03, 0x00, 0x2f, 0x3f, 0x33, 0x11, 0x33, 0x30,
-    0x31, 0x65, 0x01, 0x33, 0x01, 0x23, 0x01, 0x01, 0x17, 0x23, 0x01, 0x02, 0x3c, 0x01, 0x6f, 0x81,
-    0xfe, 0x31, 0x5f, 0xfe, 0x9d, 0x01, 0x6e, 0x3e, 0x60, 0xfe, 0x32, 0xd6, 0x03, 0xb7, 0xfb, 0x73,
-    0x04, 0x8d, 0xfc, 0x4a, 0xd7, 0x04, 0x8d, 0x00, 0x00, 0x01, 0x00, 0x89, 0xff, 0xf0, 0x04, 0x01,
-    0x04, 0x8d, 0x00, 0x15, 0x00, 0x0f, 0xb5, 0x0c, 0x11, 0x06, 0x00, 0x7d, 0x06, 0x00, 0x2f, 0x3f,
-    0x11, 0x33, 0x32, 0x30, 0x31, 0x41, 0x33, 0x11, 0x14, 0x06, 0x06, 0x23, 0x22, 0x26, 0x26, 0x35,
-    0x11, 0x33, 0x11, 0x14, 0x16, 0x16, 0x33, 0x32, 0x36, 0x36, 0x35, 0x03, 0x89, 0x78, 0x77, 0xc9,
-    0x7c, 0x7f, 0xc9, 0x74, 0x76, 0x54, 0x93, 0x5f, 0x5f, 0x92, 0x53, 0x04, 0x8d, 0xfc, 0xef, 0x83,
-    0xb0, 0x59, 0x59, 0xb0, 0x83, 0x03, 0x11, 0xfc, 0xef, 0x61, 0x83, 0x42, 0x42, 0x83, 0x61, 0x00,
-    0x00, 0x02, 0x00, 0x2c, 0x00, 0x00, 0x03, 0xf5, 0x04, 0x8d, 0x00, 0x03, 0x00, 0x07, 0x00, 0x11,
-    0xb6, 0x06, 0x07, 0x07, 0x01, 0x00, 0x7d, 0x01, 0x00, 0x2f, 0x3f, 0x11, 0x39, 0x2f, 0x33, 0x30,
-    0x31, 0x41, 0x11, 0x23, 0x11, 0x21, 0x15, 0x21, 0x35, 0x02, 0x4c, 0x77, 0x02, 0x20, 0xfc, 0x37,
-    0x04, 0x8d, 0xfb, 0x73, 0x04, 0x8d, 0x68, 0x68, 0x00, 0x01, 0x00, 0x4b, 0xff, 0xf0, 0x03, 0xd4,
-    0x04, 0x9d, 0x00, 0x39, 0x00, 0x18, 0x40, 0x0a, 0x0a, 0x26, 0x0f, 0x36, 0x31, 0x2b, 0x18, 0x14,
-    0x0f, 0x7e, 0x00, 0x3f, 0xcc, 0x33, 0x2f, 0xcc, 0x33, 0x12, 0x39, 0x39, 0x30, 0x31, 0x41, 0x34,
-    0x2e, 0x02, 0x27, 0x2e, 0x03, 0x35, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x16, 0x16, 0x15, 0x23, 0x34,
-    0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x15, 0x14, 0x1e, 0x02, 0x17, 0x1e, 0x03, 0x15, 0x14, 0x0e,
-    0x02, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x33, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x36, 0x36, 0x03, 0x5b,
-    0x21, 0x4a, 0x7e, 0x5d, 0x60, 0x9b, 0x6d, 0x3a, 0x3e, 0x72, 0x9b, 0x5e, 0x83, 0xc2, 0x6b, 0x78,
-    0x4a, 0x8b, 0x64, 0x64, 0x88, 0x45, 0x22, 0x4d, 0x81, 0x5f, 0x5f, 0x98, 0x6b, 0x39, 0x41, 0x75,
-    0x9e, 0x5e, 0x54, 0xa7, 0x8a, 0x52, 0x78, 0x3d, 0x66, 0x7d, 0x3f, 0x60, 0x8c, 0x4d, 0x01, 0x22,
-    0x2d, 0x47, 0x3a, 0x31, 0x16, 0x18, 0x3c, 0x4f, 0x6b, 0x47, 0x45, 0x70, 0x51, 0x2b, 0x5c, 0x9f,
-    0x63, 0x47, 0x70, 0x40, 0x36, 0x5b, 0x37, 0x28, 0x42, 0x39, 0x32, 0x17, 0x17, 0x3e, 0x53, 0x6e,
-    0x49, 0x48, 0x72, 0x4f, 0x2a, 0x29, 0x55, 0x87, 0x5e, 0x47, 0x61, 0x3b, 0x1a, 0x33, 0x5c, 0x00,
-    0x00, 0x02, 0x00, 0x98, 0x00, 0x00, 0x04, 0x17, 0x04, 0x8d, 0x00, 0x19, 0x00, 0x1e, 0x00, 0x18,
-    0x40, 0x0a, 0x1b, 0x0d, 0x0d, 0x0c, 0x0c, 0x1a, 0x18, 0x17, 0x00, 0x7d, 0x00, 0x3f, 0x32, 0x2f,
-    0x33, 0x39, 0x2f, 0x33, 0x12, 0x39, 0x30, 0x31, 0x53, 0x21, 0x32, 0x1e, 0x02, 0x15, 0x14, 0x06,
-    0x06, 0x07, 0x07, 0x21, 0x27, 0x21, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x21, 0x11,
-    0x23, 0x21, 0x01, 0x37, 0x01, 0x15, 0x98, 0x01, 0x9d, 0x63, 0x9e, 0x71, 0x3b, 0x49, 0x83, 0x56,
-    0x29, 0xfe, 0x4e, 0x02, 0x01, 0x68, 0x60, 0x7f, 0x40, 0x47, 0x8a, 0x64, 0xfe, 0xdb, 0x78, 0x02,
-    0xff, 0xfe, 0xc0, 0x80, 0x01, 0x40, 0x04, 0x8d, 0x2f, 0x59, 0x83, 0x54, 0x55, 0x86, 0x5a, 0x12,
-    0x13, 0x67, 0x43, 0x6d, 0x3f, 0x4c, 0x71, 0x3e, 0xfb, 0xdb, 0x02, 0x01, 0x02, 0xfe, 0x07, 0x0a,
-    0x00, 0x03, 0x00, 0x66, 0xff, 0x33, 0x04, 0x3e, 0x04, 0x9d, 0x00, 0x03, 0x00, 0x19, 0x00, 0x2f,
-    0x00, 0x1c, 0x40, 0x0c, 0x00, 0x03, 0x03, 0x2b, 0x2b, 0x0a, 0x0a, 0x02, 0x20, 0x15, 0x7e, 0x02,
-    0x00, 0x2f, 0x3f, 0x33, 0x12, 0x39, 0x2f, 0x33, 0x12, 0x39, 0x11, 0x33, 0x30, 0x31, 0x65, 0x05,
-    0x07, 0x25, 0x01, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x35, 0x34, 0x3e, 0x02,
-    0x33, 0x32, 0x1e, 0x02, 0x07, 0x35, 0x34, 0x2e, 0x02, 0x23, 0x22, 0x0e, 0x02, 0x15, 0x15, 0x14,
-    0x1e, 0x02, 0x33, 0x32, 0x3e, 0x02, 0x03, 0x0b, 0x01, 0x24, 0x52, 0xfe, 0xe0, 0x01, 0x81, 0x45,
-    0x81, 0xb5, 0x71, 0x6e, 0xb5, 0x83, 0x46, 0x46, 0x82, 0xb4, 0x6f, 0x70, 0xb5, 0x82, 0x46, 0x77,
-    0x33, 0x60, 0x8b, 0x58, 0x57, 0x8a, 0x60, 0x33, 0x33, 0x62, 0x89, 0x57, 0x59, 0x8a, 0x60, 0x32,
-    0x69, 0xec, 0x4a, 0xeb, 0x02, 0x61, 0x71, 0x7d, 0xc7, 0x8e, 0x4c, 0x4c, 0x8e, 0xc7, 0x7d, 0x71,
-    0x7c, 0xc8, 0x8f, 0x4b, 0x4b, 0x8f, 0xc8, 0xed, 0x73, 0x65, 0xa0, 0x72, 0x3c, 0x3c, 0x72, 0xa0,
-    0x65, 0x73, 0x65, 0xa2, 0x72, 0x3d, 0x3d, 0x72, 0xa2, 0x00, 0x00, 0x01, 0x00, 0x9b, 0x00, 0x00,
-    0x03, 0xf4, 0x04, 0x8d, 0x00, 0x18, 0x00, 0x13, 0xb7, 0x02, 0x01, 0x01, 0x0d, 0x0c, 0x0f, 0x7d,
-    0x0d, 0x00, 0x2f, 0x3f, 0x33, 0x12, 0x39, 0x2f, 0x33, 0x30, 0x31, 0x41, 0x21, 0x35, 0x21, 0x32,
-    0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x21, 0x11, 0x23, 0x11, 0x21, 0x32, 0x16, 0x16, 0x15,
-    0x14, 0x0e, 0x02, 0x02, 0x4a, 0xfe, 0x9d, 0x01, 0x63, 0x6d, 0x86, 0x3f, 0x3f, 0x86, 0x6d, 0xfe,
-    0xc8, 0x77, 0x01, 0xaf, 0x8b, 0xbe, 0x61, 0x37, 0x6c, 0x9f, 0x01, 0xcf, 0x68, 0x40, 0x6d, 0x45,
-    0x44, 0x73, 0x45, 0xfb, 0xdb, 0x04, 0x8d, 0x5a, 0xa0, 0x69, 0x51, 0x80, 0x5b, 0x2f, 0x00, 0x02,
-    0x00, 0x69, 0xff, 0xf0, 0x04, 0x40, 0x04, 0x9d, 0x00, 0x15, 0x00, 0x2b, 0x00, 0x10, 0xb6, 0x27,
-    0x06, 0x1c, 0x11, 0x7e, 0x06, 0x0b, 0x00, 0x3f, 0x3f, 0x33, 0x11, 0x33, 0x30, 0x31, 0x41, 0x15,
-    0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x35, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x1e, 0x02,
-    0x07, 0x35, 0x34, 0x2e, 0x02, 0x23, 0x22, 0x0e, 0x02, 0x15, 0x15, 0x14, 0x1e, 0x02, 0x33, 0x32,
-    0x3e, 0x02, 0x04, 0x40, 0x45, 0x81, 0xb5, 0x6f, 0x6f, 0xb5, 0x82, 0x47, 0x46, 0x82, 0xb5, 0x6e,
-    0x70, 0xb5, 0x82, 0x45, 0x76, 0x32, 0x60, 0x8b, 0x59, 0x56, 0x8a, 0x61, 0x33, 0x34, 0x61, 0x8a,
-    0x57, 0x59, 0x8a, 0x60, 0x31, 0x02, 0x7f, 0x71, 0x7d, 0xc7, 0x8e, 0x4c, 0x4c, 0x8e, 0xc7, 0x7d,
-    0x71, 0x7c, 0xc8, 0x8f, 0x4b, 0x4b, 0x8f, 0xc8, 0xed, 0x73, 0x65, 0xa0, 0x72, 0x3c, 0x3c, 0x72,
-    0xa0, 0x65, 0x73, 0x65, 0xa2, 0x72, 0x3d, 0x3d, 0x72, 0xa2, 0x00, 0x01, 0x00, 0x9b, 0x00, 0x00,
-    0x04, 0x47, 0x04, 0x8d, 0x00, 0x09, 0x00, 0x11, 0xb6, 0x03, 0x08, 0x05, 0x01, 0x07, 0x00, 0x7d,
-    0x00, 0x3f, 0x32, 0x2f, 0x33, 0x39, 0x39, 0x30, 0x31, 0x41, 0x11, 0x23, 0x01, 0x11, 0x23, 0x11,
-    0x33, 0x01, 0x11, 0x04, 0x47, 0x78, 0xfd, 0x43, 0x77, 0x77, 0x02, 0xbd, 0x04, 0x8d, 0xfb, 0x73,
-    0x03, 0xd0, 0xfc, 0x30, 0x04, 0x8d, 0xfc, 0x32, 0x03, 0xce, 0x00, 0x03, 0x00, 0x9b, 0x00, 0x00,
-    0x05, 0x5b, 0x04, 0x8d, 0x00, 0x06, 0x00, 0x0b, 0x00, 0x10, 0x00, 0x16, 0x40, 0x09, 0x02, 0x0e,
-    0x0a, 0x05, 0x0c, 0x07, 0x04, 0x00, 0x7d, 0x00, 0x3f, 0x32, 0x32, 0x32, 0x2f, 0x33, 0x33, 0x39,
-    0x30, 0x31, 0x53, 0x33, 0x01, 0x01, 0x33, 0x01, 0x23, 0x01, 0x33, 0x13, 0x11, 0x23, 0x01, 0x33,
-    0x11, 0x23, 0x11, 0xc3, 0x75, 0x01, 0xc2, 0x01, 0xc2, 0x74, 0xfd, 0xf6, 0x59, 0xfd, 0xce, 0x69,
-    0x0e, 0x77, 0x04, 0x56, 0x6a, 0x78, 0x04, 0x8d, 0xfc, 0x1b, 0x03, 0xe5, 0xfb, 0x73, 0x04, 0x8d,
-    0xfd, 0x4f, 0xfe, 0x24, 0x04, 0x8d, 0xfb, 0x73, 0x01, 0xdc, 0x00, 0x02, 0x00, 0x9b, 0x00, 0x00,
-    0x03, 0x76, 0x04, 0x8d, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0f, 0xb5, 0x06, 0x03, 0x02, 0x04, 0x7d,
-    0x02, 0x00, 0x2f, 0x3f, 0x11, 0x33, 0x33, 0x30, 0x31, 0x65, 0x15, 0x21, 0x35, 0x13, 0x11, 0x23,
-    0x11, 0x03, 0x76, 0xfd, 0x77, 0x25, 0x77, 0x67, 0x67, 0x67, 0x04, 0x26, 0xfb, 0x73, 0x04, 0x8d,
-    0x00, 0x03, 0x00, 0x9b, 0x00, 0x00, 0x04, 0x3e, 0x04, 0x8d, 0x00, 0x03, 0x00, 0x09, 0x00, 0x0d,
-    0x00, 0x17, 0x40, 0x0c, 0x06, 0x07, 0x0b, 0x05, 0x0c, 0x08, 0x06, 0x0a, 0x01, 0x04, 0x00, 0x7d,
-    0x00, 0x3f, 0x32, 0x2f, 0x33, 0x17, 0x39, 0x30, 0x31, 0x41, 0x11, 0x23, 0x11, 0x21, 0x01, 0x05,
-    0x27, 0x37, 0x01, 0x13, 0x01, 0x37, 0x01, 0x01, 0x12, 0x77, 0x03, 0x79, 0xfd, 0xe8, 0xfe, 0xf3,
-    0x10, 0xd8, 0x01, 0xc5, 0x2d, 0xfe, 0x00, 0x4f, 0x02, 0x46, 0x04, 0x8d, 0xfb, 0x73, 0x04, 0x8d,
-    0xfd, 0xe2, 0xfb, 0x81, 0xdb, 0x01, 0xbd, 0xfb, 0x73, 0x02, 0x4c, 0x5b, 0xfd, 0x59, 0x00, 0x01,
-    0x00, 0x3c, 0xff, 0xf0, 0x03, 0x38, 0x04, 0x8d, 0x00, 0x13, 0x00, 0x0d, 0xb4, 0x10, 0x0c, 0x07,
-    0x01, 0x7d, 0x00, 0x3f, 0x2f, 0xcc, 0x33, 0x30, 0x31, 0x41, 0x11, 0x33, 0x11, 0x14, 0x06, 0x06,
-    0x23, 0x22, 0x26, 0x26, 0x35, 0x33, 0x14, 0x16, 0x16, 0x33, 0x32, 0x36, 0x36, 0x02, 0xbf, 0x79,
-    0x61, 0xa7, 0x6b, 0x73, 0xb1, 0x65, 0x78, 0x41, 0x7b, 0x55, 0x48, 0x71, 0x41, 0x01, 0x51, 0x03,
-    0x3c, 0xfc, 0xc4, 0x6e, 0x9e, 0x55, 0x4a, 0x98, 0x74, 0x50, 0x6b, 0x35, 0x3d, 0x70, 0x00, 0x01,
-    0x00, 0xb2, 0x00, 0x00, 0x01, 0x29, 0x04, 0x8d, 0x00, 0x03, 0x00, 0x09, 0xb2, 0x00, 0x7d, 0x01,
-    0x00, 0x2f, 0x3f, 0x30, 0x31, 0x41, 0x11, 0x23, 0x11, 0x01, 0x29, 0x77, 0x04, 0x8d, 0xfb, 0x73,
-    0x04, 0x8d, 0x00, 0x03, 0x00, 0x9b, 0x00, 0x00, 0x04, 0x42, 0x04, 0x8d, 0x00, 0x03, 0x00, 0x07,
-    0x00, 0x0b, 0x00, 0x18, 0x40, 0x0a, 0x02, 0x03, 0x03, 0x04, 0x09, 0x05, 0x08, 0x04, 0x7d, 0x05,
-    0x00, 0x2f, 0x3f, 0x33, 0x11, 0x33, 0x12, 0x39, 0x2f, 0x33, 0x30, 0x31, 0x41, 0x15, 0x21, 0x35,
-    0x13, 0x11, 0x23, 0x11, 0x21, 0x11, 0x23, 0x11, 0x03, 0xe5, 0xfd, 0x0f, 0x1e, 0x77, 0x03, 0xa7,
-    0x77, 0x02, 0x74, 0x68, 0x68, 0x02, 0x19, 0xfb, 0x73, 0x04, 0x8d, 0xfb, 0x73, 0x04, 0x8d, 0x00,
-    0x00, 0x01, 0x00, 0x79, 0xff, 0xf0, 0x04, 0x2b, 0x04, 0x9d, 0x00, 0x2a, 0x00, 0x16, 0x40, 0x09,
-    0x29, 0x2a, 0x2a, 0x05, 0x19, 0x10, 0x7e, 0x24, 0x05, 0x00, 0x2f, 0x33, 0x3f, 0x33, 0x12, 0x39,
-    0x2f, 0x33, 0x30, 0x31, 0x41, 0x11, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x35, 0x34, 0x3e,
-    0x02, 0x33, 0x32, 0x16, 0x16, 0x17, 0x23, 0x2e, 0x02, 0x23, 0x22, 0x0e, 0x02, 0x15, 0x15, 0x14,
-    0x1e, 0x02, 0x33, 0x32, 0x36, 0x37, 0x11, 0x21, 0x35, 0x04, 0x2b, 0x17, 0x6a, 0xb3, 0x84, 0x70,
-    0xb9, 0x87, 0x4a, 0x44, 0x80, 0xb5, 0x70, 0x8e, 0xc0, 0x6c, 0x0d, 0x76, 0x0c, 0x4a, 0x8c, 0x6e,
-    0x59, 0x89, 0x60, 0x30, 0x36, 0x67, 0x8f, 0x58, 0x8a, 0x9a, 0x1a, 0xfe, 0xb7, 0x02, 0x33, 0xfe,
-    0x59, 0x1e, 0x49, 0x35, 0x4b, 0x8c, 0xc6, 0x7d, 0x82, 0x7a, 0xc3, 0x8b, 0x49, 0x5c, 0x9e, 0x65,
-    0x43, 0x71, 0x44, 0x3c, 0x6f, 0x9d, 0x60, 0x84, 0x64, 0xa1, 0x72, 0x3d, 0x43, 0x1c, 0x01, 0x1b,
-    0x63, 0x00, 0x00, 0x03, 0x00, 0x9b, 0x00, 0x00, 0x03, 0xa6, 0x04, 0x8d, 0x00, 0x03, 0x00, 0x07,
-    0x00, 0x0b, 0x00, 0x1a, 0x40, 0x0b, 0x07, 0x06, 0x06, 0x01, 0x0a, 0x0b, 0x0b, 0x01, 0x00, 0x7d,
-    0x01, 0x00, 0x2f, 0x3f, 0x11, 0x39, 0x2f, 0x33, 0x11, 0x39, 0x2f, 0x33, 0x30, 0x31, 0x41, 0x11,
-    0x23, 0x11, 0x01, 0x15, 0x21, 0x35, 0x01, 0x15, 0x21, 0x35, 0x01, 0x12, 0x77, 0x02, 0xb8, 0xfd,
-    0x98, 0x02, 0xbb, 0xfd, 0x45, 0x04, 0x8d, 0xfb, 0x73, 0x04, 0x8d, 0xfd, 0xef, 0x67, 0x67, 0x02,
-    0x11, 0x68, 0x68, 0x00, 0x00, 0x03, 0x00, 0x4b, 0xff, 0x13, 0x03, 0xd4, 0x05, 0x73, 0x00, 0x03,
-    0x00, 0x07, 0x00, 0x41, 0x00, 0x29, 0x40, 0x13, 0x07, 0x3e, 0x3e, 0x24, 0x08, 0x17, 0x33, 0x06,
-    0x06, 0x33, 0x0b, 0x02, 0x20, 0x20, 0x17, 0x00, 0x00, 0x17, 0x7e, 0x00, 0x3f, 0x33, 0x2f, 0x11,
-    0x33, 0x11, 0x33, 0x3f, 0x33, 0x2f, 0x11, 0x12, 0x39, 0x39, 0x33, 0x11, 0x33, 0x30, 0x31, 0x41,
-    0x11, 0x23, 0x11, 0x13, 0x11, 0x23, 0x11, 0x01, 0x34, 0x2e, 0x02, 0x27, 0x2e, 0x03, 0x35, 0x34,
-    0x3e, 0x02, 0x33, 0x32, 0x16, 0x16, 0x15, 0x23, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x15,
-    0x14, 0x1e, 0x02, 0x17, 0x1e, 0x03, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x33,
-    0x14, 0x1e, 0x02, 0x33, 0x32, 0x36, 0x36, 0x02, 0x54, 0x66, 0x66, 0x66, 0x01, 0x6d, 0x21, 0x4a,
-    0x7e, 0x5d, 0x60, 0x9b, 0x6d, 0x3a, 0x3e, 0x72, 0x9b, 0x5e, 0x83, 0xc2, 0x6b, 0x78, 0x4a, 0x8b,
-    0x64, 0x64, 0x88, 0x45, 0x22, 0x4d, 0x81, 0x5f, 0x5f, 0x98, 0x6b, 0x39, 0x41, 0x75, 0x9e, 0x5e,
-    0x54, 0xa7, 0x8a, 0x52, 0x78, 0x3d, 0x66, 0x7d, 0x3f, 0x60, 0x8c, 0x4d, 0x05, 0x73, 0xfe, 0xf7,
-    0x01, 0x09, 0xfa, 0xaa, 0xfe, 0xf6, 0x01, 0x0a, 0x01, 0x05, 0x2d, 0x47, 0x3a, 0x31, 0x16, 0x18,
-    0x3c, 0x4f, 0x6b, 0x47, 0x45, 0x70, 0x51, 0x2b, 0x5c, 0x9f, 0x63, 0x47, 0x70, 0x40, 0x36, 0x5b,
-    0x37, 0x28, 0x42, 0x39, 0x32, 0x17, 0x17, 0x3e, 0x53, 0x6e, 0x49, 0x48, 0x72, 0x4f, 0x2a, 0x29,
-    0x55, 0x87, 0x5e, 0x47, 0x61, 0x3b, 0x1a, 0x33, 0x5c, 0x00, 0x00, 0x03, 0x00, 0x2a, 0x00, 0x00,
-    0x03, 0xc9, 0x04, 0x9d, 0x00, 0x03, 0x00, 0x07, 0x00, 0x26, 0x00, 0x1d, 0x40, 0x0d, 0x04, 0x05,
-    0x05, 0x01, 0x22, 0x19, 0x7e, 0x0e, 0x02, 0x02, 0x0d, 0x01, 0x0a, 0x00, 0x3f, 0x33, 0x33, 0x11,
-    0x33, 0x3f, 0x33, 0x12, 0x39, 0x2f, 0x33, 0x30, 0x31, 0x61, 0x21, 0x35, 0x21, 0x03, 0x15, 0x21,
-    0x35, 0x25, 0x13, 0x16, 0x06, 0x06, 0x07, 0x27, 0x3e, 0x03, 0x27, 0x03, 0x26, 0x3e, 0x02, 0x33,
-    0x32, 0x16, 0x16, 0x15, 0x23, 0x34, 0x26, 0x26, 0x23, 0x22, 0x0e, 0x02, 0x03, 0xc9, 0xfc, 0x98,
-    0x03, 0x68, 0xce, 0xfd, 0x2f, 0x01, 0x2f, 0x09, 0x04, 0x16, 0x3b, 0x36, 0x74, 0x27, 0x33, 0x1d,
-    0x0b, 0x02, 0x0a, 0x04, 0x2e, 0x5c, 0x87, 0x55, 0x7e, 0x9b, 0x48, 0x78, 0x39, 0x68, 0x48, 0x3b,
-    0x5a, 0x3c, 0x1c, 0x67, 0x02, 0x07, 0x58, 0x58, 0x7a, 0xfe, 0xea, 0x54, 0xa0, 0x81, 0x27, 0x31,
-    0x0c, 0x4f, 0x6c, 0x74, 0x30, 0x01, 0x16, 0x67, 0xa2, 0x71, 0x3b, 0x61, 0xae, 0x74, 0x68, 0x7c,
-    0x37, 0x2b, 0x54, 0x7c, 0x00, 0x05, 0x00, 0x16, 0x00, 0x00, 0x03, 0x8b, 0x04, 0x8d, 0x00, 0x03,
-    0x00, 0x07, 0x00, 0x0c, 0x00, 0x11, 0x00, 0x15, 0x00, 0x1b, 0x40, 0x0b, 0x06, 0x07, 0x03, 0x02,
-    0x02, 0x11, 0x14, 0x0a, 0x09, 0x11, 0x7d, 0x00, 0x3f, 0x33, 0x3f, 0x12, 0x39, 0x7c, 0x2f, 0x33,
-    0x18, 0xce, 0x32, 0x30, 0x31, 0x41, 0x15, 0x21, 0x35, 0x05, 0x15, 0x21, 0x35, 0x25, 0x01, 0x33,
-    0x01, 0x23, 0x01, 0x01, 0x17, 0x23, 0x01, 0x01, 0x11, 0x23, 0x11, 0x03, 0x39, 0xfd, 0x2c, 0x02,
-    0xd4, 0xfd, 0x2c, 0x01, 0x5e, 0x01, 0x4a, 0x7e, 0xfe, 0x7d, 0x51, 0xfe, 0xe0, 0x01, 0x4c, 0x06,
-    0x4f, 0xfe, 0x7c, 0x01, 0xf5, 0x78, 0x02, 0x00, 0x58, 0x58, 0xaa, 0x57, 0x57, 0x9d, 0x02, 0x9a,
-    0xfd, 0x14, 0x02, 0xec, 0xfd, 0x63, 0x4f, 0x02, 0xec, 0xfd, 0x6f, 0xfe, 0x04, 0x01, 0xfc, 0x00,
-    0x00, 0x02, 0x00, 0x9b, 0x00, 0x00, 0x03, 0x7e, 0x04, 0x8d, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0e,
-    0xb5, 0x07, 0x06, 0x03, 0x7d, 0x02, 0x0a, 0x00, 0x3f, 0x3f, 0x33, 0x33, 0x30, 0x31, 0x41, 0x11,
-    0x23, 0x11, 0x21, 0x15, 0x21, 0x35, 0x01, 0x12, 0x77, 0x02, 0xe3, 0xfd, 0x6d, 0x04, 0x8d, 0xfb,
-    0x73, 0x04, 0x8d, 0x68, 0x68, 0x00, 0x00, 0x03, 0x00, 0x19, 0x00, 0x00, 0x04, 0x2c, 0x04, 0x8d,
-    0x00, 0x03, 0x00, 0x08, 0x00, 0x0d, 0x00, 0x1b, 0x40, 0x0c, 0x08, 0x0c, 0x7d, 0x00, 0x05, 0x05,
-    0x09, 0x02, 0x03, 0x03, 0x09, 0x0a, 0x00, 0x3f, 0x33, 0x11, 0x33, 0x11, 0x33, 0x11, 0x33, 0x3f,
-    0x33, 0x30, 0x31, 0x61, 0x35, 0x21, 0x15, 0x01, 0x01, 0x33, 0x01, 0x23, 0x01, 0x01, 0x37, 0x23,
-    0x01, 0x03, 0xcb, 0xfc, 0xad, 0x01, 0xc4, 0x01, 0x6f, 0x81, 0xfe, 0x31, 0x5f, 0xfe, 0x9d, 0x01,
-    0x6e, 0x3e, 0x60, 0xfe, 0x32, 0x67, 0x67, 0x03, 0xb7, 0xfc, 0x49, 0x04, 0x8d, 0xfb, 0x73, 0x03,
-    0xb7, 0xd6, 0xfb, 0x73, 0x00, 0x03, 0x00, 0x69, 0xff, 0xf0, 0x04, 0x40, 0x04, 0x9d, 0x00, 0x03,
-    0x00, 0x19, 0x00, 0x2f, 0x00, 0x17, 0x40, 0x0a, 0x03, 0x02, 0x02, 0x0a, 0x20, 0x15, 0x7e, 0x2b,
-    0x0a, 0x0b, 0x00, 0x3f, 0x33, 0x3f, 0x33, 0x12, 0x39, 0x2f, 0x33, 0x30, 0x31, 0x41, 0x15, 0x21,
-    0x35, 0x25, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x35, 0x34, 0x3e, 0x02, 0x33,
-    0x32, 0x1e, 0x02, 0x07, 0x35, 0x34, 0x2e, 0x02, 0x23, 0x22, 0x0e, 0x02, 0x15, 0x15, 0x14, 0x1e,
-    0x02, 0x33, 0x32, 0x3e, 0x02, 0x03, 0x6d, 0xfd, 0xe8, 0x02, 0xeb, 0x45, 0x81, 0xb5, 0x6f, 0x6f,
-    0xb5, 0x82, 0x47, 0x46, 0x82, 0xb5, 0x6e, 0x70, 0xb5, 0x82, 0x45, 0x76, 0x32, 0x60, 0x8b, 0x59,
-    0x56, 0x8a, 0x61, 0x33, 0x34, 0x61, 0x8a, 0x57, 0x59, 0x8a, 0x60, 0x31, 0x02, 0x7c, 0x67, 0x67,
-    0x03, 0x71, 0x7d, 0xc7, 0x8e, 0x4c, 0x4c, 0x8e, 0xc7, 0x7d, 0x71, 0x7c, 0xc8, 0x8f, 0x4b, 0x4b,
-    0x8f, 0xc8, 0xed, 0x73, 0x65, 0xa0, 0x72, 0x3c, 0x3c, 0x72, 0xa0, 0x65, 0x73, 0x65, 0xa2, 0x72,
-    0x3d, 0x3d, 0x72, 0xa2, 0x00, 0x02, 0x00, 0x19, 0x00, 0x00, 0x04, 0x2c, 0x04, 0x8d, 0x00, 0x04,
-    0x00, 0x09, 0x00, 0x0e, 0xb5, 0x01, 0x09, 0x0a, 0x04, 0x08, 0x7d, 0x00, 0x3f, 0x33, 0x3f, 0x33,
-    0x30, 0x31, 0x41, 0x01, 0x33, 0x01, 0x23, 0x01, 0x01, 0x37, 0x23, 0x01, 0x02, 0x3c, 0x01, 0x6f,
-    0x81, 0xfe, 0x31, 0x5f, 0xfe, 0x9d, 0x01, 0x6e, 0x3e, 0x60, 0xfe, 0x32, 0x03, 0xb7, 0xfc, 0x49,
-    0x04, 0x8d, 0xfb, 0x73, 0x03, 0xb7, 0xd6, 0xfb, 0x73, 0x00, 0x00, 0x03, 0x00, 0x47, 0x00, 0x00,
-    0x03, 0x4d, 0x04, 0x8d, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x17, 0x40, 0x0a, 0x07, 0x06,
-    0x06, 0x02, 0x0a, 0x0b, 0x7d, 0x03, 0x02, 0x0a, 0x00, 0x3f, 0x33, 0x3f, 0x33, 0x12, 0x39, 0x2f,
-    0x33, 0x30, 0x31, 0x65, 0x15, 0x21, 0x35, 0x01, 0x15, 0x21, 0x35, 0x01, 0x15, 0x21, 0x35, 0x03,
-    0x4d, 0xfc, 0xfa, 0x02, 0xb9, 0xfd, 0x96, 0x02, 0xb7, 0xfc, 0xfa, 0x67, 0x67, 0x67, 0x02, 0x2c,
-    0x68, 0x68, 0x01, 0xfa, 0x67, 0x67, 0x00, 0x03, 0x00, 0x9b, 0x00, 0x00, 0x04, 0x2b, 0x04, 0x8d,
-    0x00, 0x03, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x13, 0xb7, 0x0a, 0x05, 0x0b, 0x07, 0x02, 0x00, 0x03,
-    0x7d, 0x00, 0x3f, 0x33, 0x33, 0x33, 0x33, 0x2f, 0x33, 0x30, 0x31, 0x41, 0x15, 0x21, 0x35, 0x33,
-    0x11, 0x23, 0x11, 0x21, 0x11, 0x23, 0x11, 0x03, 0xce, 0xfd, 0x25, 0x1f, 0x77, 0x03, 0x90, 0x78,
-    0x04, 0x8d, 0x67, 0x67, 0xfb, 0x73, 0x04, 0x8d, 0xfb, 0x73, 0x04, 0x8d, 0x00, 0x03, 0x00, 0x3c,
-    0x00, 0x01, 0x03, 0xbe, 0x04, 0x8d, 0x00, 0x03, 0x00, 0x07, 0x00, 0x10, 0x00, 0x25, 0x40, 0x12,
-    0x0d, 0x08, 0x09, 0x03, 0x0a, 0x06, 0x10, 0x10, 0x0e, 0x07, 0x7d, 0x0a, 0x02, 0x0c, 0x03, 0x03,
-    0x02, 0x0a, 0x00, 0x3f, 0x33, 0x11, 0x33, 0x11, 0x33, 0x3f, 0x33, 0x33, 0x11, 0x33, 0x12, 0x17,
-    0x39, 0x30, 0x31, 0x65, 0x15, 0x21, 0x35, 0x01, 0x15, 0x21, 0x35, 0x01, 0x15, 0x01, 0x23, 0x35,
-    0x01, 0x01, 0x35, 0x33, 0x03, 0xbe, 0xfc, 0xab, 0x03, 0x1e, 0xfc, 0xdc, 0x01, 0xdb, 0xfe, 0x46,
-    0x48, 0x01, 0x76, 0xfe, 0x8a, 0x48, 0x68, 0x67, 0x67, 0x04, 0x25, 0x67, 0x67, 0xfd, 0xd2, 0x24,
-    0xfd, 0xc6, 0x5d, 0x01, 0xec, 0x01, 0xe6, 0x5d, 0x00, 0x03, 0x00, 0x6a, 0x00, 0x00, 0x04, 0xf6,
-    0x04, 0x8e, 0x00, 0x15, 0x00, 0x27, 0x00, 0x2b, 0x00, 0x15, 0x40, 0x09, 0x16, 0x00, 0x00, 0x2b,
-    0x7d, 0x1e, 0x0c, 0x2a, 0x0a, 0x00, 0x3f, 0xcd, 0x32, 0x3f, 0x33, 0x2f, 0x33, 0x30, 0x31, 0x41,
-    0x33, 0x32, 0x1e, 0x02, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x34, 0x3e,
-    0x02, 0x17, 0x22, 0x06, 0x06, 0x15, 0x14, 0x16, 0x16, 0x33, 0x33, 0x32, 0x36, 0x36, 0x35, 0x34,
-    0x26, 0x26, 0x23, 0x37, 0x11, 0x23, 0x11, 0x02, 0x90, 0x3f, 0x79, 0xcb, 0x92, 0x51, 0x51, 0x92,
-    0xcb, 0x79, 0x3f, 0x7c, 0xca, 0x92, 0x4e, 0x50, 0x92, 0xca, 0x7a, 0x84, 0xc2, 0x69, 0x67, 0xc1,
-    0x87, 0x41, 0x86, 0xc0, 0x68, 0x68, 0xc0, 0x86, 0x1a, 0x78, 0x04, 0x26, 0x3e, 0x79, 0xaf, 0x6f,
-    0x70, 0xb3, 0x7e, 0x43, 0x42, 0x7e, 0xb2, 0x70, 0x6f, 0xaf, 0x7a, 0x3f, 0x68, 0x52, 0xa4, 0x79,
-    0x7b, 0xa8, 0x57, 0x58, 0xa9, 0x7b, 0x7a, 0xa2, 0x51, 0xd0, 0xfb, 0x72, 0x04, 0x8e, 0x00, 0x02,
-    0x00, 0x6a, 0x00, 0x00, 0x04, 0x87, 0x04, 0x8d, 0x00, 0x19, 0x00, 0x1d, 0x00, 0x1f, 0x40, 0x0e,
-    0x15, 0x14, 0x14, 0x06, 0x07, 0x07, 0x0d, 0x1c, 0x0e, 0x00, 0x1d, 0x1d, 0x0d, 0x7d, 0x00, 0x3f,
-    0x33, 0x11, 0x33, 0x3f, 0x12, 0x39, 0x11, 0x33, 0x33, 0x11, 0x33, 0x30, 0x31, 0x41, 0x33, 0x11,
-    0x14, 0x06, 0x06, 0x23, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x11, 0x33, 0x11, 0x14, 0x1e, 0x02, 0x33,
-    0x33, 0x32, 0x36, 0x36, 0x35, 0x01, 0x11, 0x23, 0x11, 0x04, 0x0f, 0x78, 0x79, 0xe8, 0xa7, 0x14,
-    0x7c, 0xbf, 0x83, 0x43, 0x77, 0x32, 0x63, 0x93, 0x62, 0x14, 0x86, 0xb1, 0x59, 0xfe, 0xa5, 0x78,
-    0x04, 0x8d, 0xfe, 0xc5, 0xb0, 0xf5, 0x80, 0x49, 0x8c, 0xcc, 0x84, 0x01, 0x3b, 0xfe, 0xc5, 0x69,
-    0xa5, 0x74, 0x3c, 0x6a, 0xc8, 0x8c, 0x01, 0x3b, 0xfb, 0x73, 0x04, 0x8d, 0x00, 0x03, 0x00, 0x81,
-    0x00, 0x00, 0x04, 0x6a, 0x04, 0x9d, 0x00, 0x2c, 0x00, 0x30, 0x00, 0x34, 0x00, 0x27, 0x40, 0x13,
-    0x2d, 0x34, 0x0a, 0x2e, 0x33, 0x0a, 0x28, 0x12, 0x12, 0x29, 0x11, 0x11, 0x32, 0x32, 0x31, 0x0a,
-    0x06, 0x1d, 0x7e, 0x00, 0x3f, 0x33, 0x3f, 0x33, 0x11, 0x33, 0x11, 0x33, 0x33, 0x11, 0x33, 0x3f,
-    0x33, 0x3f, 0x33, 0x30, 0x31, 0x41, 0x35, 0x34, 0x2e, 0x02, 0x23, 0x22, 0x0e, 0x02, 0x15, 0x15,
-    0x14, 0x1e, 0x02, 0x17, 0x15, 0x2e, 0x03, 0x35, 0x35, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x1e, 0x02,
-    0x15, 0x15, 0x14, 0x0e, 0x02, 0x07, 0x35, 0x3e, 0x02, 0x01, 0x35, 0x21, 0x15, 0x21, 0x35, 0x21,
-    0x15, 0x03, 0xe6, 0x2c, 0x5c, 0x8c, 0x60, 0x60, 0x8c, 0x5b, 0x2c, 0x2c, 0x4f, 0x6a, 0x3e, 0x5a,
-    0x96, 0x6e, 0x3d, 0x41, 0x7e, 0xb7, 0x75, 0x75, 0xb7, 0x7e, 0x42, 0x3c, 0x6c, 0x94, 0x59, 0x57,
-    0x7f, 0x47, 0xfe, 0xe3, 0x01, 0xa1, 0xfc, 0x17, 0x01, 0xa1, 0x02, 0x69, 0x26, 0x55, 0x98, 0x76,
-    0x43, 0x43, 0x76, 0x98, 0x55, 0x26, 0x73, 0xa8, 0x75, 0x4c, 0x17, 0x5b, 0x17, 0x5c, 0x90, 0xc8,
-    0x83, 0x24, 0x6e, 0xbf, 0x91, 0x52, 0x52, 0x91, 0xbf, 0x6e, 0x24, 0x82, 0xc8, 0x90, 0x5c, 0x18,
-    0x5b, 0x20, 0x74, 0xc6, 0xfe, 0x30, 0x67, 0x67, 0x67, 0x67, 0x00, 0x03, 0x00, 0x23, 0xff, 0xec,
-    0x05, 0x0c, 0x04, 0x8d, 0x00, 0x03, 0x00, 0x07, 0x00, 0x23, 0x00, 0x1c, 0x40, 0x0d, 0x17, 0x16,
-    0x0b, 0x20, 0x0d, 0x0d, 0x03, 0x04, 0x0a, 0x05, 0x02, 0x03, 0x7d, 0x00, 0x3f, 0x33, 0x33, 0x3f,
-    0x12, 0x39, 0x2f, 0x33, 0x3f, 0x33, 0x30, 0x31, 0x41, 0x15, 0x21, 0x35, 0x01, 0x11, 0x33, 0x11,
-    0x03, 0x35, 0x3e, 0x02, 0x33, 0x32, 0x16, 0x16, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x35, 0x32, 0x3e,
-    0x02, 0x35, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x03, 0xa0, 0xfc, 0x83, 0x01, 0x7b, 0x78,
-    0x25, 0x2e, 0x70, 0x82, 0x4a, 0x8b, 0xc1, 0x65, 0x3f, 0x70, 0x93, 0x54, 0x35, 0x66, 0x53, 0x30,
-    0x46, 0x8a, 0x69, 0x46, 0x88, 0x73, 0x04, 0x8d, 0x67, 0x67, 0xfb, 0x73, 0x04, 0x8d, 0xfb, 0x73,
-    0x02, 0x1a, 0x6a, 0x16, 0x27, 0x17, 0x54, 0xaa, 0x83, 0x63, 0x8b, 0x56, 0x27, 0x67, 0x16, 0x38,
-    0x67, 0x50, 0x62, 0x7b, 0x3b, 0x19, 0x28, 0x00, 0x00, 0x02, 0x00, 0x6e, 0xff, 0xf0, 0x04, 0x1a,
-    0x04, 0x9d, 0x00, 0x03, 0x00, 0x2b, 0x00, 0x17, 0x40, 0x0a, 0x00, 0x01, 0x01, 0x09, 0x1d, 0x14,
-    0x7e, 0x28, 0x09, 0x0b, 0x00, 0x3f, 0x33, 0x3f, 0x33, 0x12, 0x39, 0x2f, 0x33, 0x30, 0x31, 0x41,
-    0x15, 0x21, 0x35, 0x01, 0x33, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x35, 0x34, 0x3e, 0x02,
-    0x33, 0x32, 0x16, 0x16, 0x17, 0x23, 0x2e, 0x02, 0x23, 0x22, 0x0e, 0x02, 0x15, 0x15, 0x14, 0x1e,
-    0x02, 0x33, 0x32, 0x36, 0x36, 0x02, 0xe5, 0xfd, 0xd5, 0x02, 0xe8, 0x78, 0x0d, 0x72, 0xc7, 0x8b,
-    0x6c, 0xaf, 0x7d, 0x43, 0x43, 0x7e, 0xb2, 0x6e, 0x88, 0xc4, 0x72, 0x0d, 0x78, 0x0c, 0x4f, 0x8e,
-    0x6a, 0x55, 0x86, 0x5e, 0x31, 0x2f, 0x5b, 0x85, 0x55, 0x6c, 0x8f, 0x51, 0x02, 0x7d, 0x68, 0x68,
-    0xfe, 0xf3, 0x77, 0xac, 0x5d, 0x4c, 0x8c, 0xc3, 0x78, 0x87, 0x78, 0xc3, 0x8d, 0x4b, 0x5c, 0xae,
-    0x78, 0x5b, 0x7e, 0x42, 0x3b, 0x71, 0x9d, 0x62, 0x88, 0x60, 0x9d, 0x72, 0x3e, 0x3f, 0x7d, 0x00,
-    0x00, 0x03, 0x00, 0x26, 0x00, 0x00, 0x06, 0xef, 0x04, 0x8d, 0x00, 0x11, 0x00, 0x29, 0x00, 0x2d,
-    0x00, 0x20, 0x40, 0x0f, 0x28, 0x29, 0x29, 0x1c, 0x2c, 0x1d, 0x01, 0x2d, 0x7d, 0x1f, 0x1c, 0x0a,
-    0x0b, 0x08, 0x0a, 0x00, 0x3f, 0x33, 0x3f, 0x33, 0x3f, 0x33, 0x33, 0x33, 0x12, 0x39, 0x2f, 0x33,
-    0x30, 0x31, 0x41, 0x33, 0x03, 0x0e, 0x04, 0x23, 0x23, 0x37, 0x33, 0x3e, 0x04, 0x37, 0x25, 0x32,
-    0x16, 0x16, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x21, 0x11, 0x33, 0x11, 0x21, 0x32, 0x36, 0x35, 0x34,
-    0x26, 0x26, 0x23, 0x21, 0x35, 0x03, 0x15, 0x21, 0x35, 0x01, 0x37, 0x78, 0x13, 0x05, 0x1a, 0x2f,
-    0x4b, 0x6a, 0x48, 0x2b, 0x01, 0x26, 0x2b, 0x42, 0x30, 0x22, 0x14, 0x05, 0x04, 0x32, 0x83, 0xb6,
-    0x5f, 0x35, 0x69, 0x98, 0x62, 0xfe, 0x46, 0x78, 0x01, 0x42, 0x99, 0x88, 0x3c, 0x7f, 0x66, 0xfe,
-    0x93, 0x37, 0xfd, 0xa5, 0x04, 0x8d, 0xfe, 0x01, 0x8b, 0xd7, 0x9a, 0x63, 0x2f, 0x6e, 0x01, 0x21,
-    0x4a, 0x7d, 0xb9, 0x7f, 0x30, 0x57, 0x9d, 0x6a, 0x4f, 0x81, 0x5e, 0x33, 0x04, 0x8d, 0xfb, 0xda,
-    0x96, 0x66, 0x42, 0x6f, 0x43, 0x68, 0x01, 0xce, 0x67, 0x67, 0x00, 0x03, 0x00, 0x9b, 0x00, 0x00,
-    0x06, 0xff, 0x04, 0x8d, 0x00, 0x17, 0x00, 0x1b, 0x00, 0x1f, 0x00, 0x21, 0x40, 0x0f, 0x17, 0x16,
-    0x16, 0x1b, 0x1a, 0x1a, 0x1e, 0x0b, 0x1f, 0x7d, 0x0d, 0x0a, 0x0a, 0x1e, 0x0a, 0x00, 0x3f, 0x33,
-    0x11, 0x33, 0x3f, 0x33, 0x12, 0x39, 0x2f, 0x33, 0x33, 0x2f, 0x33, 0x30, 0x31, 0x41, 0x32, 0x16,
-    0x16, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x21, 0x11, 0x33, 0x11, 0x21, 0x32, 0x36, 0x35, 0x34, 0x26,
-    0x26, 0x23, 0x21, 0x35, 0x07, 0x15, 0x21, 0x35, 0x13, 0x11, 0x23, 0x11, 0x05, 0x66, 0x83, 0xb6,
-    0x60, 0x36, 0x69, 0x98, 0x62, 0xfe, 0x46, 0x78, 0x01, 0x42, 0x99, 0x88, 0x3c, 0x7f, 0x66, 0xfe,
-    0x93, 0x32, 0xfd, 0x2d, 0x1e, 0x77, 0x02, 0xbf, 0x57, 0x9d, 0x6a, 0x4f, 0x81, 0x5e, 0x33, 0x04,
-    0x8d, 0xfb, 0xda, 0x96, 0x66, 0x42, 0x6f, 0x43, 0x68, 0x4b, 0x68, 0x68, 0x02, 0x19, 0xfb, 0x73,
-    0x04, 0x8d, 0x00, 0x03, 0x00, 0x2c, 0x00, 0x00, 0x05, 0x15, 0x04, 0x8d, 0x00, 0x03, 0x00, 0x07,
-    0x00, 0x1b, 0x00, 0x19, 0x40, 0x0b, 0x18, 0x0d, 0x0d, 0x03, 0x13, 0x04, 0x0a, 0x05, 0x02, 0x03,
-    0x7d, 0x00, 0x3f, 0x33, 0x33, 0x3f, 0x33, 0x12, 0x39, 0x2f, 0x33, 0x30, 0x31, 0x41, 0x15, 0x21,
-    0x35, 0x01, 0x11, 0x33, 0x11, 0x03, 0x35, 0x3e, 0x02, 0x33, 0x32, 0x16, 0x16, 0x15, 0x11, 0x23,
-    0x11, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x03, 0xa9, 0xfc, 0x83, 0x01, 0x7b, 0x77, 0x24,
-    0x2e, 0x6f, 0x83, 0x49, 0x8b, 0xc2, 0x65, 0x78, 0x46, 0x8b, 0x69, 0x45, 0x88, 0x73, 0x04, 0x8d,
-    0x68, 0x68, 0xfb, 0x73, 0x04, 0x8d, 0xfb, 0x73, 0x02, 0x1a, 0x6a, 0x16, 0x27, 0x17, 0x4e, 0xb2,
-    0x97, 0xfe, 0xbf, 0x01, 0x41, 0x73, 0x85, 0x37, 0x19, 0x28, 0x00, 0x04, 0x00, 0x9b, 0xfe, 0xa9,
-    0x04, 0x2a, 0x04, 0x8d, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x1b, 0x40, 0x0c,
-    0x0f, 0x0b, 0x7d, 0x03, 0x07, 0x07, 0x0e, 0x0a, 0x02, 0x02, 0x0a, 0x0a, 0x00, 0x3f, 0x33, 0x2f,
-    0x11, 0x33, 0x33, 0x11, 0x33, 0x3f, 0x33, 0x30, 0x31, 0x65, 0x11, 0x23, 0x11, 0x25, 0x15, 0x21,
-    0x35, 0x13, 0x11, 0x23, 0x11, 0x21, 0x11, 0x23, 0x11, 0x02, 0x9f, 0x78, 0x01, 0xa7, 0xfd, 0x25,
-    0x1f, 0x77, 0x03, 0x8f, 0x77, 0x5c, 0xfe, 0x4d, 0x01, 0xb3, 0x0b, 0x67, 0x67, 0x04, 0x26, 0xfb,
-    0x73, 0x04, 0x8d, 0xfb, 0x73, 0x04, 0x8d, 0x00, 0x00, 0x02, 0x00, 0x9b, 0x00, 0x00, 0x03, 0xed,
-    0x04, 0x8d, 0x00, 0x17, 0x00, 0x1b, 0x00, 0x1b, 0x40, 0x0c, 0x02, 0x01, 0x01, 0x0d, 0x0b, 0x0e,
-    0x0a, 0x1b, 0x1a, 0x1a, 0x0d, 0x7d, 0x00, 0x3f, 0x33, 0x11, 0x33, 0x3f, 0x33, 0x12, 0x39, 0x2f,
-    0x33, 0x30, 0x31, 0x41, 0x21, 0x15, 0x21, 0x32, 0x16, 0x16, 0x15, 0x14, 0x06, 0x23, 0x21, 0x11,
-    0x23, 0x11, 0x21, 0x32, 0x3e, 0x02, 0x35, 0x34, 0x26, 0x26, 0x13, 0x35, 0x21, 0x15, 0x02, 0x54,
-    0xfe, 0x94, 0x01, 0x6c, 0x66, 0x7f, 0x3c, 0x88, 0x99, 0xfe, 0xbe, 0x77, 0x01, 0xb9, 0x62, 0x98,
-    0x69, 0x36, 0x60, 0xb6, 0xa5, 0xfd, 0x6f, 0x02, 0xbf, 0x68, 0x43, 0x6f, 0x42, 0x66, 0x96, 0x04,
-    0x26, 0xfb, 0x73, 0x33, 0x5e, 0x81, 0x4f, 0x6a, 0x9d, 0x57, 0x01, 0x68, 0x66, 0x66, 0x00, 0x03,
-    0x00, 0x35, 0xfe, 0xb1, 0x04, 0xb1, 0x04, 0x8d, 0x00, 0x10, 0x00, 0x16, 0x00, 0x1e, 0x00, 0x23,
-    0x40, 0x10, 0x1a, 0x1d, 0x1d, 0x09, 0x17, 0x0a, 0x0a, 0x1c, 0x14, 0x09, 0x0a, 0x16, 0x11, 0x11,
-    0x00, 0x7d, 0x00, 0x3f, 0x32, 0x11, 0x33, 0x3f, 0x33, 0x33, 0x33, 0x11, 0x33, 0x11, 0x33, 0x2f,
-    0x33, 0x30, 0x31, 0x41, 0x33, 0x03, 0x0e, 0x04, 0x07, 0x23, 0x37, 0x33, 0x3e, 0x03, 0x37, 0x13,
-    0x21, 0x11, 0x23, 0x11, 0x21, 0x01, 0x21, 0x11, 0x23, 0x11, 0x21, 0x11, 0x23, 0x01, 0x5e, 0x76,
-    0x12, 0x05, 0x25, 0x39, 0x46, 0x4e, 0x26, 0x42, 0x02, 0x20, 0x1a, 0x40, 0x3c, 0x2b, 0x06, 0x38,
-    0x02, 0xa8, 0x78, 0xfd, 0xd0, 0xfe, 0xb1, 0x04, 0x7c, 0x78, 0xfc, 0x74, 0x78, 0x04, 0x8d, 0xfe,
-    0x40, 0x84, 0xcd, 0x9c, 0x72, 0x51, 0x1d, 0x67, 0x20, 0x59, 0x89, 0xcf, 0x96, 0x01, 0xbf, 0xfb,
-    0x73, 0x04, 0x26, 0xfc, 0x41, 0xfe, 0x4a, 0x01, 0x4f, 0xfe, 0xb8, 0x00, 0x00, 0x05, 0x00, 0x25,
-    0x00, 0x00, 0x05, 0xf5, 0x04, 0x8d, 0x00, 0x03, 0x00, 0x09, 0x00, 0x0d, 0x00, 0x13, 0x00, 0x17,
-    0x00, 0x35, 0x40, 0x19, 0x14, 0x17, 0x17, 0x11, 0x0c, 0x0b, 0x0b, 0x07, 0x07, 0x11, 0x11, 0x06,
-    0x0e, 0x0e, 0x0f, 0x0a, 0x02, 0x02, 0x15, 0x0a, 0x09, 0x03, 0x03, 0x0f, 0x7d, 0x00, 0x3f, 0x33,
-    0x11, 0x33, 0x3f, 0x33, 0x11, 0x33, 0x12, 0x39, 0x2f, 0x33, 0x33, 0x11, 0x33, 0x11, 0x33, 0x11,
-    0x33, 0x11, 0x33, 0x11, 0x33, 0x30, 0x31, 0x41, 0x11, 0x23, 0x11, 0x21, 0x01, 0x23, 0x27, 0x33,
-    0x01, 0x13, 0x01, 0x37, 0x09, 0x02, 0x33, 0x01, 0x33, 0x07, 0x27, 0x01, 0x23, 0x01, 0x03, 0x49,
-    0x78, 0x02, 0xf2, 0xfe, 0x43, 0xf0, 0x0e, 0xbd, 0x01, 0x6b, 0x2a, 0xfe, 0x5f, 0x53, 0x01, 0xe9,
-    0xfc, 0x1a, 0xfe, 0x48, 0x95, 0x01, 0x69, 0xbd, 0x0e, 0xa4, 0xfe, 0x60, 0x9b, 0x01, 0xeb, 0x04,
-    0x8d, 0xfb, 0x73, 0x04, 0x8d, 0xfd, 0x8c, 0x68, 0x02, 0x0c, 0xfb, 0x73, 0x02, 0x29, 0x5c, 0xfd,
-    0x7b, 0x02, 0x19, 0x02, 0x74, 0xfd, 0xf4, 0x68, 0x10, 0xfd, 0xd7, 0x02, 0x84, 0x00, 0x00, 0x02,
-    0x00, 0x4f, 0xff, 0xf0, 0x03, 0xca, 0x04, 0x9d, 0x00, 0x1e, 0x00, 0x3e, 0x00, 0x1d, 0x40, 0x0d,
-    0x1f, 0x02, 0x02, 0x01, 0x3e, 0x3e, 0x15, 0x34, 0x2a, 0x0b, 0x0b, 0x15, 0x7e, 0x00, 0x3f, 0x33,
-    0x3f, 0x33, 0x12, 0x39, 0x2f, 0x33, 0x33, 0x11, 0x33, 0x30, 0x31, 0x41, 0x23, 0x35, 0x33, 0x32,
-    0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x15, 0x23, 0x34, 0x3e, 0x02, 0x33,
-    0x32, 0x1e, 0x02, 0x15, 0x14, 0x0e, 0x02, 0x27, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x14, 0x0e, 0x02,
-    0x23, 0x22, 0x2e, 0x02, 0x35, 0x33, 0x1e, 0x02, 0x33, 0x32, 0x36, 0x36, 0x35, 0x34, 0x2e, 0x02,
-    0x23, 0x23, 0x02, 0x0f, 0x9a, 0x95, 0x6f, 0x88, 0x3e, 0x42, 0x89, 0x6e, 0x50, 0x89, 0x54, 0x78,
-    0x43, 0x74, 0x98, 0x56, 0x60, 0x9e, 0x73, 0x3f, 0x3c, 0x6f, 0x9c, 0xfa, 0x9a, 0x72, 0xa7, 0x6d,
-    0x35, 0x45, 0x7b, 0xa3, 0x60, 0x4b, 0x9a, 0x83, 0x50, 0x78, 0x02, 0x55, 0x8f, 0x5a, 0x6c, 0x94,
-    0x4b, 0x2a, 0x53, 0x7a, 0x51, 0x95, 0x02, 0x32, 0x52, 0x35, 0x60, 0x3f, 0x3f, 0x63, 0x3b, 0x33,
-    0x61, 0x46, 0x4b, 0x77, 0x54, 0x2c, 0x27, 0x4e, 0x78, 0x50, 0x45, 0x6f, 0x4f, 0x2b, 0x36, 0x2a,
-    0x4e, 0x6e, 0x44, 0x53, 0x7d, 0x54, 0x2a, 0x25, 0x50, 0x81, 0x5d, 0x4a, 0x69, 0x38, 0x38, 0x67,
-    0x47, 0x3b, 0x55, 0x36, 0x1a, 0x00, 0x00, 0x03, 0x00, 0x9b, 0x00, 0x00, 0x04, 0x4e, 0x04, 0x8d,
-    0x00, 0x03, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x1b, 0x40, 0x0c, 0x00, 0x03, 0x0a, 0x07, 0x0b, 0x0a,
-    0x01, 0x02, 0x05, 0x05, 0x08, 0x7d, 0x00, 0x3f, 0x33, 0x11, 0x33, 0x33, 0x3f, 0x33, 0x33, 0x33,
-    0x33, 0x30, 0x31, 0x77, 0x01, 0x17, 0x01, 0x01, 0x33, 0x11, 0x23, 0x01, 0x33, 0x11, 0x23, 0xbd,
-    0x03, 0x19, 0x54, 0xfc, 0xe8, 0x02, 0xc4, 0x78, 0x78, 0xfc, 0xc5, 0x77, 0x77, 0x40, 0x04, 0x4d,
-    0x40, 0xfb, 0xb3, 0x04, 0x8d, 0xfb, 0x73, 0x04, 0x8d, 0xfb, 0x73, 0x00, 0x00, 0x03, 0x00, 0xa1,
-    0x00, 0x00, 0x04, 0x1b, 0x04, 0x8d, 0x00, 0x03, 0x00, 0x09, 0x00, 0x0d, 0x00, 0x1f, 0x40, 0x0e,
-    0x0c, 0x0b, 0x0b, 0x07, 0x07, 0x06, 0x06, 0x02, 0x09, 0x03, 0x7d, 0x0a, 0x02, 0x0a, 0x00, 0x3f,
-    0x33, 0x3f, 0x33, 0x12, 0x39, 0x2f, 0x33, 0x11, 0x33, 0x11, 0x33, 0x30, 0x31, 0x41, 0x11, 0x23,
-    0x11, 0x21, 0x01, 0x23, 0x27, 0x33, 0x01, 0x13, 0x01, 0x37, 0x01, 0x01, 0x18, 0x77, 0x03, 0x4d,
-    0xfd, 0xe6, 0xe6, 0x0d, 0xc2, 0x01, 0xb7, 0x24, 0xfe, 0x18, 0x45, 0x02, 0x40, 0x04, 0x8d, 0xfb,
-    0x73, 0x04, 0x8d, 0xfd, 0x8c, 0x68, 0x02, 0x0c, 0xfb, 0x73, 0x02, 0x29, 0x5b, 0xfd, 0x7c, 0x00,
-    0x00, 0x03, 0x00, 0x26, 0x00, 0x00, 0x04, 0x15, 0x04, 0x8d, 0x00, 0x03, 0x00, 0x07, 0x00, 0x19,
-    0x00, 0x18, 0x40, 0x0b, 0x13, 0x10, 0x0a, 0x07, 0x02, 0x03, 0x03, 0x08, 0x7d, 0x06, 0x0a, 0x00,
-    0x3f, 0x3f, 0x33, 0x11, 0x33, 0x33, 0x3f, 0x33, 0x30, 0x31, 0x41, 0x15, 0x21, 0x35, 0x21, 0x11,
-    0x23, 0x11, 0x21, 0x33, 0x03, 0x0e, 0x04, 0x23, 0x23, 0x37, 0x37, 0x3e, 0x04, 0x37, 0x03, 0xb3,
-    0xfd, 0xa5, 0x02, 0xbd, 0x78, 0xfd, 0x9a, 0x78, 0x14, 0x05, 0x1b, 0x30, 0x4a, 0x69, 0x47, 0x2b,
-    0x01, 0x26, 0x2b, 0x42, 0x30, 0x21, 0x14, 0x05, 0x04, 0x8d, 0x67, 0x67, 0xfb, 0x73, 0x04, 0x8d,
-    0xfe, 0x01, 0x8b, 0xd7, 0x9a, 0x63, 0x2f, 0x6e, 0x01, 0x02, 0x21, 0x4a, 0x7c, 0xb8, 0x7f, 0x00,
-    0x00, 0x02, 0x00, 0x21, 0xff, 0xec, 0x04, 0x01, 0x04, 0x8d, 0x00, 0x12, 0x00, 0x17, 0x00, 0x17,
-    0x40, 0x0a, 0x01, 0x17, 0x7d, 0x15, 0x16, 0x16, 0x0e, 0x0e, 0x07, 0x0b, 0x00, 0x3f, 0x33, 0x11,
-    0x33, 0x11, 0x33, 0x3f, 0x33, 0x30, 0x31, 0x41, 0x01, 0x33, 0x01, 0x0e, 0x02, 0x23, 0x22, 0x26,
-    0x27, 0x37, 0x16, 0x16, 0x33, 0x32, 0x36, 0x36, 0x37, 0x01, 0x01, 0x17, 0x07, 0x01, 0x02, 0x55,
-    0x01, 0x20, 0x8c, 0xfe, 0x67, 0x23, 0x4d, 0x79, 0x65, 0x17, 0x3d, 0x0c, 0x0b, 0x0c, 0x36, 0x12,
-    0x3e, 0x4f, 0x36, 0x17, 0xfe, 0xba, 0x01, 0x4e, 0x4e, 0x5c, 0xfe, 0x34, 0x01, 0xd7, 0x02, 0xb6,
-    0xfc, 0x78, 0x4e, 0x80, 0x4b, 0x05, 0x05, 0x63, 0x02, 0x05, 0x33, 0x55, 0x31, 0x03, 0x82, 0xfd,
-    0x2f, 0xc1, 0x38, 0x03, 0xca, 0x00, 0x00, 0x04, 0x00, 0x9b, 0xfe, 0xb1, 0x04, 0xc0, 0x04, 0x8d,
-    0x00, 0x05, 0x00, 0x09, 0x00, 0x0d, 0x00, 0x11, 0x00, 0x1d, 0x40, 0x0d, 0x11, 0x0d, 0x7d, 0x05,
-    0x09, 0x09, 0x10, 0x0b, 0x08, 0x02, 0x02, 0x08, 0x0a, 0x00, 0x3f, 0x33, 0x2f, 0x11, 0x33, 0x33,
-    0x33, 0x11, 0x33, 0x3f, 0x33, 0x30, 0x31, 0x65, 0x03, 0x23, 0x11, 0x23, 0x35, 0x33, 0x15, 0x21,
-    0x35, 0x13, 0x11, 0x23, 0x11, 0x21, 0x11, 0x23, 0x11, 0x04, 0xc0, 0x09, 0x6e, 0x90, 0x15, 0xfd,
-    0x25, 0x1f, 0x77, 0x03, 0x90, 0x78, 0x67, 0xfe, 0x4a, 0x01, 0x4f, 0x67, 0x67, 0x67, 0x04, 0x26,
-    0xfb, 0x73, 0x04, 0x8d, 0xfb, 0x73, 0x04, 0x8d, 0x00, 0x02, 0x00, 0x43, 0x00, 0x00, 0x03, 0xb2,
-    0x04, 0x8d, 0x00, 0x03, 0x00, 0x17, 0x00, 0x13, 0xb7, 0x14, 0x09, 0x09, 0x02, 0x03, 0x0e, 0x7d,
-    0x02, 0x00, 0x2f, 0x3f, 0x33, 0x12, 0x39, 0x2f, 0x33, 0x30, 0x31, 0x41, 0x11, 0x23, 0x11, 0x13,
-    0x15, 0x0e, 0x02, 0x23, 0x22, 0x26, 0x26, 0x35, 0x11, 0x33, 0x11, 0x14, 0x16, 0x16, 0x33, 0x32,
-    0x36, 0x36, 0x03, 0xb2, 0x78, 0x24, 0x2e, 0x6f, 0x82, 0x4a, 0x8a, 0xc3, 0x65, 0x78, 0x46, 0x8c,
-    0x68, 0x46, 0x87, 0x75, 0x04, 0x8d, 0xfb, 0x73, 0x04, 0x8d, 0xfd, 0xe7, 0x6a, 0x16, 0x26, 0x17,
-    0x4e, 0xb2, 0x97, 0x01, 0x3f, 0xfe, 0xc1, 0x74, 0x84, 0x38, 0x1a, 0x27, 0x00, 0x04, 0x00, 0x9b,
-    0x00, 0x00, 0x05, 0x7d, 0x04, 0x8d, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x19,
-    0x40, 0x0b, 0x0b, 0x07, 0x07, 0x0f, 0x10, 0x0a, 0x06, 0x06, 0x03, 0x0e, 0x7d, 0x00, 0x3f, 0x33,
-    0x33, 0x11, 0x33, 0x3f, 0x33, 0x11, 0x33, 0x30, 0x31, 0x65, 0x15, 0x21, 0x35, 0x01, 0x11, 0x23,
-    0x11, 0x21, 0x11, 0x23, 0x11, 0x21, 0x11, 0x23, 0x11, 0x05, 0x20, 0xfb, 0xc2, 0x02, 0x65, 0x77,
-    0x02, 0xad, 0x78, 0xfc, 0x0d, 0x77, 0x67, 0x67, 0x67, 0x04, 0x26, 0xfb, 0x73, 0x04, 0x8d, 0xfb,
-    0x73, 0x04, 0x8d, 0xfb, 0x73, 0x04, 0x8d, 0x00, 0x00, 0x05, 0x00, 0x9b, 0xfe, 0xb1, 0x06, 0x13,
-    0x04, 0x8d, 0x00, 0x05, 0x00, 0x09, 0x00, 0x0d, 0x00, 0x11, 0x00, 0x15, 0x00, 0x27, 0x40, 0x12,
-    0x11, 0x0d, 0x0d, 0x15, 0x7d, 0x04, 0x10, 0x02, 0x02, 0x10, 0x10, 0x0c, 0x0c, 0x13, 0x13, 0x09,
-    0x08, 0x0a, 0x00, 0x3f, 0x33, 0x33, 0x11, 0x33, 0x11, 0x33, 0x11, 0x33, 0x2f, 0x11, 0x33, 0x3f,
-    0x33, 0x11, 0x33, 0x30, 0x31, 0x65, 0x03, 0x23, 0x11, 0x23, 0x35, 0x33, 0x15, 0x21, 0x35, 0x01,
-    0x11, 0x23, 0x11, 0x21, 0x11, 0x23, 0x11, 0x21, 0x11, 0x23, 0x11, 0x06, 0x13, 0x09, 0x6e, 0x90,
-    0x14, 0xfb, 0xc2, 0x02, 0x65, 0x77, 0x02, 0xae, 0x79, 0xfc, 0x0d, 0x77, 0x67, 0xfe, 0x4a, 0x01,
-    0x4f, 0x67, 0x67, 0x67, 0x04, 0x26, 0xfb, 0x73, 0x04, 0x8d, 0xfb, 0x73, 0x04, 0x8d, 0xfb, 0x73,
-    0x04, 0x8d, 0x00, 0x02, 0x00, 0x05, 0x00, 0x00, 0x04, 0xc1, 0x04, 0x8d, 0x00, 0x03, 0x00, 0x1a,
-    0x00, 0x17, 0x40, 0x0a, 0x06, 0x05, 0x05, 0x0f, 0x12, 0x0a, 0x11, 0x01, 0x00, 0x7d, 0x00, 0x3f,
-    0x32, 0x32, 0x3f, 0x33, 0x39, 0x2f, 0x33, 0x30, 0x31, 0x53, 0x15, 0x21, 0x35, 0x01, 0x21, 0x15,
-    0x21, 0x32, 0x16, 0x16, 0x15, 0x14, 0x06, 0x23, 0x21, 0x11, 0x23, 0x11, 0x21, 0x32, 0x36, 0x36,
-    0x35, 0x34, 0x26, 0x26, 0x05, 0x01, 0xa1, 0x01, 0x82, 0xfe, 0x94, 0x01, 0x6c, 0x66, 0x80, 0x3b,
-    0x88, 0x99, 0xfe, 0xbe, 0x77, 0x01, 0xb9, 0x83, 0xb6, 0x60, 0x60, 0xb6, 0x04, 0x8d, 0x67, 0x67,
-    0xfe, 0x32, 0x68, 0x43, 0x6f, 0x42, 0x66, 0x96, 0x04, 0x26, 0xfb, 0x73, 0x59, 0xa0, 0x68, 0x6a,
-    0x9d, 0x57, 0xff, 0xff, 0x00, 0x9b, 0x00, 0x00, 0x04, 0xf6, 0x04, 0x8d, 0x04, 0x26, 0x02, 0x22,
-    0x00, 0x00, 0x00, 0x07, 0x01, 0xfd, 0x03, 0xcd, 0x00, 0x00, 0x00, 0x01, 0x00, 0x9b, 0x00, 0x00,
-    0x03, 0xed, 0x04, 0x8d, 0x00, 0x16, 0x00, 0x15, 0x40, 0x09, 0x15, 0x16, 0x16, 0x0a, 0x0c, 0x09,
-    0x0a, 0x0a, 0x7d, 0x00, 0x3f, 0x3f, 0x33, 0x12, 0x39, 0x2f, 0x33, 0x30, 0x31, 0x41, 0x32, 0x16,
-    0x16, 0x15, 0x14, 0x06, 0x06, 0x23, 0x21, 0x11, 0x33, 0x11, 0x21, 0x32, 0x36, 0x35, 0x34, 0x26,
-    0x26, 0x23, 0x21, 0x35, 0x02, 0x54, 0x83, 0xb6, 0x60, 0x60, 0xb6, 0x83, 0xfe, 0x47, 0x77, 0x01,
-    0x42, 0x99, 0x88, 0x3c, 0x7f, 0x66, 0xfe, 0x94, 0x02, 0xbf, 0x57, 0x9d, 0x6a, 0x68, 0xa0, 0x59,
-    0x04, 0x8d, 0xfb, 0xda, 0x96, 0x66, 0x42, 0x6f, 0x43, 0x68, 0x00, 0x02, 0x00, 0x5f, 0xff, 0xf0,
-    0x04, 0x0b, 0x04, 0x9d, 0x00, 0x03, 0x00, 0x2b, 0x00, 0x17, 0x40, 0x0a, 0x02, 0x01, 0x01, 0x1c,
-    0x08, 0x27, 0x0b, 0x13, 0x1c, 0x7e, 0x00, 0x3f, 0x33, 0x3f, 0x33, 0x12, 0x39, 0x2f, 0x33, 0x30,
-    0x31, 0x41, 0x21, 0x35, 0x21, 0x01, 0x1e, 0x02, 0x33, 0x32, 0x3e, 0x02, 0x35, 0x35, 0x34, 0x2e,
-    0x02, 0x23, 0x22, 0x06, 0x06, 0x07, 0x23, 0x3e, 0x02, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x15, 0x14,
-    0x0e, 0x02, 0x23, 0x22, 0x26, 0x26, 0x27, 0x03, 0xbf, 0xfd, 0xd6, 0x02, 0x2a, 0xfd, 0x18, 0x0d,
-    0x51, 0x90, 0x6b, 0x56, 0x84, 0x5b, 0x2f, 0x31, 0x5e, 0x86, 0x55, 0x69, 0x8f, 0x4f, 0x0c, 0x78,
-    0x0d, 0x72, 0xc5, 0x87, 0x6e, 0xb2, 0x7e, 0x43, 0x43, 0x7c, 0xaf, 0x6d, 0x8b, 0xc6, 0x73, 0x0d,
-    0x02, 0x15, 0x68, 0xfe, 0xf3, 0x5e, 0x7d, 0x3f, 0x3e, 0x72, 0x9d, 0x60, 0x88, 0x62, 0x9d, 0x71,
-    0x3b, 0x42, 0x7e, 0x5b, 0x78, 0xae, 0x5c, 0x4b, 0x8d, 0xc3, 0x78, 0x87, 0x78, 0xc3, 0x8c, 0x4c,
-    0x5d, 0xac, 0x77, 0x00, 0x00, 0x04, 0x00, 0x9b, 0xff, 0xf0, 0x05, 0xdf, 0x04, 0x9d, 0x00, 0x03,
-    0x00, 0x07, 0x00, 0x1d, 0x00, 0x33, 0x00, 0x1d, 0x40, 0x0e, 0x24, 0x19, 0x7e, 0x2f, 0x0e, 0x0b,
-    0x03, 0x02, 0x02, 0x06, 0x07, 0x7d, 0x06, 0x0a, 0x00, 0x3f, 0x3f, 0x12, 0x39, 0x2f, 0x33, 0x3f,
-    0x33, 0x3f, 0x33, 0x30, 0x31, 0x41, 0x15, 0x21, 0x35, 0x13, 0x11, 0x23, 0x11, 0x01, 0x15, 0x14,
-    0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x35, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x1e, 0x02, 0x07,
-    0x35, 0x34, 0x2e, 0x02, 0x23, 0x22, 0x0e, 0x02, 0x15, 0x15, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x3e,
-    0x02, 0x02, 0x40, 0xfe, 0xa8, 0x2a, 0x77, 0x05, 0x44, 0x45, 0x81, 0xb5, 0x6f, 0x6f, 0xb5, 0x82,
-    0x47, 0x46, 0x82, 0xb5, 0x6e, 0x70, 0xb5, 0x82, 0x45, 0x76, 0x33, 0x60, 0x8a, 0x59, 0x57, 0x8a,
-    0x60, 0x33, 0x33, 0x62, 0x8a, 0x57, 0x58, 0x8b, 0x5f, 0x32, 0x02, 0x7e, 0x67, 0x67, 0x02, 0x0f,
-    0xfb, 0x73, 0x04, 0x8d, 0xfd, 0xf2, 0x71, 0x7d, 0xc7, 0x8e, 0x4c, 0x4c, 0x8e, 0xc7, 0x7d, 0x71,
-    0x7c, 0xc8, 0x8f, 0x4b, 0x4b, 0x8f, 0xc8, 0xed, 0x73, 0x65, 0xa0, 0x72, 0x3c, 0x3c, 0x72, 0xa0,
-    0x65, 0x73, 0x65, 0xa2, 0x72, 0x3d, 0x3d, 0x72, 0xa2, 0x00, 0x00, 0x02, 0x00, 0x50, 0x00, 0x00,
-    0x03, 0xd4, 0x04, 0x8d, 0x00, 0x03, 0x00, 0x23, 0x00, 0x19, 0x40, 0x0b, 0x23, 0x00, 0x04, 0x04,
-    0x19, 0x1b, 0x16, 0x7d, 0x19, 0x01, 0x0a, 0x00, 0x3f, 0x33, 0x3f, 0x33, 0x12, 0x39, 0x2f, 0x33,
-    0x33, 0x30, 0x31, 0x41, 0x01, 0x23, 0x01, 0x05, 0x21, 0x2e, 0x02, 0x27, 0x22, 0x26, 0x26, 0x27,
-    0x2e, 0x02, 0x35, 0x34, 0x3e, 0x02, 0x33, 0x21, 0x11, 0x23, 0x11, 0x21, 0x22, 0x06, 0x15, 0x14,
-    0x16, 0x16, 0x33, 0x21, 0x02, 0x0a, 0xfe, 0xc8, 0x82, 0x01, 0x41, 0x01, 0xf6, 0xfe, 0x4c, 0x0c,
-    0x07, 0x06, 0x0b, 0x04, 0x0d, 0x0d, 0x03, 0x5e, 0x76, 0x37, 0x35, 0x68, 0x97, 0x61, 0x01, 0xbc,
-    0x78, 0xfe, 0xbc, 0x9b, 0x82, 0x38, 0x7e, 0x67, 0x01, 0x71, 0x02, 0x48, 0xfd, 0xb8, 0x02, 0x48,
-    0x4c, 0x05, 0x06, 0x04, 0x02, 0x04, 0x03, 0x01, 0x12, 0x56, 0x7d, 0x4a, 0x50, 0x7b, 0x53, 0x2b,
-    0xfb, 0x73, 0x04, 0x26, 0x7a, 0x6b, 0x45, 0x64, 0x35, 0x00, 0x00, 0x03, 0x00, 0x10, 0x00, 0x00,
-    0x03, 0xea, 0x04, 0x8d, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x1b, 0x40, 0x0c, 0x0b, 0x0a,
-    0x0a, 0x03, 0x02, 0x06, 0x07, 0x07, 0x03, 0x7d, 0x02, 0x0a, 0x00, 0x3f, 0x3f, 0x33, 0x11, 0x33,
-    0x11, 0x12, 0x39, 0x2f, 0x33, 0x30, 0x31, 0x41, 0x11, 0x23, 0x11, 0x21, 0x15, 0x21, 0x35, 0x01,
-    0x15, 0x21, 0x35, 0x01, 0x7e, 0x78, 0x02, 0xe4, 0xfd, 0x6d, 0x01, 0x1d, 0xfd, 0x9c, 0x04, 0x8d,
-    0xfb, 0x73, 0x04, 0x8d, 0x68, 0x68, 0xfd, 0xf0, 0x67, 0x67, 0x00, 0x06, 0x00, 0x25, 0xfe, 0xb1,
-    0x06, 0x13, 0x04, 0x8d, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0d, 0x00, 0x11, 0x00, 0x17, 0x00, 0x1b,
-    0x00, 0x3b, 0x40, 0x1c, 0x02, 0x0e, 0x01, 0x01, 0x0e, 0x0e, 0x06, 0x1b, 0x18, 0x18, 0x15, 0x12,
-    0x12, 0x10, 0x0f, 0x0c, 0x09, 0x09, 0x13, 0x06, 0x06, 0x19, 0x0a, 0x0d, 0x07, 0x07, 0x13, 0x7d,
-    0x00, 0x3f, 0x33, 0x11, 0x33, 0x3f, 0x33, 0x11, 0x12, 0x39, 0x2f, 0x33, 0x33, 0x33, 0x33, 0x11,
-    0x33, 0x33, 0x11, 0x33, 0x11, 0x33, 0x11, 0x33, 0x2f, 0x11, 0x33, 0x30, 0x31, 0x41, 0x23, 0x11,
-    0x33, 0x01, 0x11, 0x23, 0x11, 0x21, 0x01, 0x23, 0x27, 0x33, 0x01, 0x13, 0x01, 0x37, 0x09, 0x02,
-    0x33, 0x01, 0x33, 0x07, 0x27, 0x01, 0x23, 0x01, 0x06, 0x13, 0x6f, 0x6f, 0xfd, 0x36, 0x78, 0x02,
-    0xf2, 0xfe, 0x43, 0xf0, 0x0e, 0xbd, 0x01, 0x6b, 0x2a, 0xfe, 0x5f, 0x53, 0x01, 0xe9, 0xfc, 0x1a,
-    0xfe, 0x48, 0x95, 0x01, 0x69, 0xbd, 0x0e, 0xa4, 0xfe, 0x60, 0x9b, 0x01, 0xeb, 0xfe, 0xb1, 0x01,
-    0xb6, 0x04, 0x26, 0xfb, 0x73, 0x04, 0x8d, 0xfd, 0x8c, 0x68, 0x02, 0x0c, 0xfb, 0x73, 0x02, 0x29,
-    0x5c, 0xfd, 0x7b, 0x02, 0x19, 0x02, 0x74, 0xfd, 0xf4, 0x68, 0x10, 0xfd, 0xd7, 0x02, 0x84, 0x00,
-    0x00, 0x04, 0x00, 0xa1, 0xfe, 0xb1, 0x04, 0x2c, 0x04, 0x8d, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0d,
-    0x00, 0x11, 0x00, 0x27, 0x40, 0x12, 0x10, 0x0f, 0x0f, 0x0b, 0x0a, 0x0a, 0x06, 0x0d, 0x07, 0x7d,
-    0x02, 0x0e, 0x01, 0x01, 0x0e, 0x0e, 0x06, 0x0a, 0x00, 0x3f, 0x33, 0x11, 0x33, 0x2f, 0x11, 0x33,
-    0x3f, 0x33, 0x12, 0x39, 0x2f, 0x33, 0x33, 0x11, 0x33, 0x30, 0x31, 0x41, 0x23, 0x11, 0x33, 0x01,
-    0x11, 0x23, 0x11, 0x21, 0x01, 0x23, 0x27, 0x33, 0x01, 0x13, 0x01, 0x37, 0x01, 0x04, 0x2c, 0x6f,
-    0x6f, 0xfc, 0xec, 0x77, 0x03, 0x4d, 0xfd, 0xe6, 0xe6, 0x0d, 0xc2, 0x01, 0xb7, 0x24, 0xfe, 0x18,
-    0x45, 0x02, 0x40, 0xfe, 0xb1, 0x01, 0xb6, 0x04, 0x26, 0xfb, 0x73, 0x04, 0x8d, 0xfd, 0x8c, 0x68,
-    0x02, 0x0c, 0xfb, 0x73, 0x02, 0x29, 0x5b, 0xfd, 0x7c, 0x00, 0x00, 0x04, 0x00, 0xa1, 0x00, 0x00,
-    0x04, 0x88, 0x04, 0x8d, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0d, 0x00, 0x11, 0x00, 0x29, 0x40, 0x13,
-    0x10, 0x0f, 0x0f, 0x0a, 0x00, 0x0b, 0x0b, 0x0a, 0x03, 0x03, 0x0a, 0x0a, 0x06, 0x0d, 0x07, 0x7d,
-    0x0e, 0x06, 0x0a, 0x00, 0x3f, 0x33, 0x3f, 0x33, 0x12, 0x39, 0x2f, 0x33, 0x2f, 0x11, 0x33, 0x11,
-    0x33, 0x11, 0x33, 0x11, 0x33, 0x30, 0x31, 0x41, 0x33, 0x11, 0x23, 0x03, 0x11, 0x23, 0x11, 0x21,
-    0x01, 0x21, 0x27, 0x21, 0x01, 0x13, 0x01, 0x37, 0x01, 0x01, 0x6d, 0x66, 0x66, 0x55, 0x77, 0x03,
-    0xba, 0xfd, 0xe6, 0xfe, 0xad, 0x0d, 0x01, 0x2f, 0x01, 0xb7, 0x24, 0xfe, 0x18, 0x45, 0x02, 0x40,
-    0x03, 0x74, 0xfd, 0xc0, 0x03, 0x59, 0xfb, 0x73, 0x04, 0x8d, 0xfd, 0x8c, 0x68, 0x02, 0x0c, 0xfb,
-    0x73, 0x02, 0x29, 0x5b, 0xfd, 0x7c, 0x00, 0x04, 0x00, 0x12, 0x00, 0x00, 0x04, 0xf7, 0x04, 0x8d,
-    0x00, 0x03, 0x00, 0x07, 0x00, 0x0d, 0x00, 0x11, 0x00, 0x21, 0x40, 0x0f, 0x10, 0x0f, 0x0f, 0x0b,
-    0x0a, 0x0a, 0x0e, 0x06, 0x0a, 0x0d, 0x07, 0x07, 0x03, 0x00, 0x7d, 0x00, 0x3f, 0x32, 0x32, 0x11,
-    0x33, 0x3f, 0x33, 0x39, 0x2f, 0x33, 0x33, 0x11, 0x33, 0x30, 0x31, 0x53, 0x21, 0x15, 0x21, 0x25,
-    0x11, 0x23, 0x11, 0x21, 0x01, 0x23, 0x27, 0x33, 0x01, 0x13, 0x01, 0x37, 0x01, 0x12, 0x01, 0xa2,
-    0xfe, 0x5e, 0x01, 0xe2, 0x77, 0x03, 0x4d, 0xfd, 0xe6, 0xe6, 0x0d, 0xc2, 0x01, 0xb7, 0x24, 0xfe,
-    0x18, 0x45, 0x02, 0x40, 0x04, 0x8d, 0x67, 0x67, 0xfb, 0x73, 0x04, 0x8d, 0xfd, 0x8c, 0x68, 0x02,
-    0x0c, 0xfb, 0x73, 0x02, 0x29, 0x5b, 0xfd, 0x7c, 0x00, 0x01, 0x00, 0x69, 0xff, 0xeb, 0x05, 0x45,
-    0x04, 0xa6, 0x00, 0x44, 0x00, 0x1b, 0x40, 0x0c, 0x00, 0x01, 0x01, 0x2f, 0x18, 0x0b, 0x24, 0x23,
-    0x23, 0x3a, 0x0d, 0x7e, 0x00, 0x3f, 0x33, 0x33, 0x11, 0x33, 0x3f, 0x33, 0x33, 0x2f, 0x33, 0x30,
-    0x31, 0x65, 0x15, 0x22, 0x2e, 0x03, 0x35, 0x35, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x1e, 0x02, 0x15,
-    0x15, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x35, 0x34, 0x3e, 0x02, 0x33, 0x17, 0x22,
-    0x0e, 0x02, 0x15, 0x15, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x3e, 0x02, 0x35, 0x35, 0x34, 0x2e, 0x02,
-    0x23, 0x22, 0x0e, 0x02, 0x15, 0x15, 0x14, 0x1e, 0x02, 0x05, 0x45, 0x92, 0xf3, 0xbc, 0x83, 0x43,
-    0x31, 0x60, 0x8b, 0x5a, 0x5a, 0x8c, 0x62, 0x33, 0x58, 0xa6, 0xec, 0x94, 0x90, 0xda, 0x93, 0x4b,
-    0x41, 0x79, 0xa7, 0x66, 0x02, 0x4e, 0x7d, 0x58, 0x2e, 0x3b, 0x75, 0xae, 0x72, 0x81, 0xc3, 0x81,
-    0x41, 0x1f, 0x40, 0x61, 0x43, 0x41, 0x60, 0x3f, 0x1e, 0x4f, 0xa2, 0xf7, 0x56, 0x6a, 0x39, 0x6e,
-    0x9f, 0xce, 0x7d, 0x32, 0x74, 0xb6, 0x81, 0x43, 0x42, 0x7f, 0xb8, 0x75, 0x3d, 0x8f, 0xec, 0xad,
-    0x5f, 0x5a, 0xa8, 0xed, 0x93, 0x1b, 0x7e, 0xc9, 0x8c, 0x4b, 0x6a, 0x3d, 0x72, 0xa0, 0x63, 0x1d,
-    0x7d, 0xc7, 0x8b, 0x49, 0x52, 0x93, 0xc5, 0x73, 0x3f, 0x5c, 0x90, 0x63, 0x34, 0x36, 0x64, 0x8f,
-    0x5a, 0x36, 0x80, 0xcb, 0x8f, 0x4b, 0xff, 0xff, 0x00, 0x16, 0x00, 0x00, 0x04, 0x0c, 0x04, 0x8d,
-    0x04, 0x26, 0x01, 0xed, 0x00, 0x00, 0x00, 0x07, 0x02, 0x40, 0x00, 0x60, 0xfe, 0xd9, 0x00, 0x02,
-    0x00, 0x2b, 0xfe, 0xb1, 0x04, 0x37, 0x04, 0x8d, 0x00, 0x03, 0x00, 0x0f, 0x00, 0x22, 0x40, 0x11,
-    0x0b, 0x0e, 0x08, 0x05, 0x04, 0x0a, 0x06, 0x0f, 0x7d, 0x02, 0x0a, 0x01, 0x01, 0x0a, 0x0a, 0x0d,
-    0x0a, 0x00, 0x3f, 0x33, 0x11, 0x33, 0x2f, 0x11, 0x33, 0x3f, 0x33, 0x12, 0x17, 0x39, 0x30, 0x31,
-    0x41, 0x23, 0x11, 0x33, 0x09, 0x02, 0x33, 0x01, 0x01, 0x23, 0x01, 0x01, 0x23, 0x01, 0x01, 0x04,
-    0x37, 0x6e, 0x6e, 0xfc, 0x8f, 0x01, 0x55, 0x01, 0x57, 0x90, 0xfe, 0x63, 0x01, 0xad, 0x90, 0xfe,
-    0x9b, 0xfe, 0x9c, 0x8e, 0x01, 0xab, 0xfe, 0x61, 0xfe, 0xb1, 0x01, 0xb6, 0x04, 0x26, 0xfe, 0x1f,
-    0x01, 0xe1, 0xfd, 0xc1, 0xfd, 0xb2, 0x01, 0xef, 0xfe, 0x11, 0x02, 0x4e, 0x02, 0x3f, 0x00, 0x05,
-    0x00, 0x23, 0xfe, 0xb1, 0x05, 0xc4, 0x04, 0x8d, 0x00, 0x05, 0x00, 0x09, 0x00, 0x0d, 0x00, 0x11,
-    0x00, 0x15, 0x00, 0x22, 0x40, 0x10, 0x11, 0x0d, 0x0d, 0x14, 0x15, 0x7d, 0x10, 0x12, 0x0c, 0x09,
-    0x04, 0x08, 0x02, 0x02, 0x08, 0x12, 0x00, 0x3f, 0x33, 0x2f, 0x11, 0x33, 0x33, 0x33, 0x3f, 0x3f,
-    0x33, 0x33, 0x11, 0x33, 0x30, 0x31, 0x65, 0x03, 0x23, 0x11, 0x23, 0x35, 0x33, 0x15, 0x21, 0x35,
-    0x13, 0x11, 0x23, 0x11, 0x21, 0x11, 0x23, 0x11, 0x21, 0x15, 0x21, 0x35, 0x05, 0xc4, 0x09, 0x6e,
-    0x90, 0x15, 0xfd, 0x25, 0x1f, 0x78, 0x03, 0x90, 0x77, 0xfe, 0xe9, 0xfc, 0x83, 0x67, 0xfe, 0x4a,
-    0x01, 0x4f, 0x67, 0x67, 0x67, 0x04, 0x26, 0xfb, 0x73, 0x04, 0x8d, 0xfb, 0x73, 0x04, 0x8d, 0x67,
-    0x67, 0x00, 0x00, 0x03, 0x00, 0x43, 0x00, 0x00, 0x03, 0xb2, 0x04, 0x8d, 0x00, 0x03, 0x00, 0x07,
-    0x00, 0x1b, 0x00, 0x1f, 0x40, 0x0e, 0x00, 0x18, 0x18, 0x0d, 0x03, 0x03, 0x0d, 0x0d, 0x06, 0x07,
-    0x12, 0x7d, 0x06, 0x0a, 0x00, 0x3f, 0x3f, 0x33, 0x12, 0x39, 0x2f, 0x33, 0x2f, 0x11, 0x33, 0x11,
-    0x33, 0x30, 0x31, 0x41, 0x33, 0x11, 0x23, 0x01, 0x11, 0x23, 0x11, 0x13, 0x15, 0x0e, 0x02, 0x23,
-    0x22, 0x26, 0x26, 0x35, 0x11, 0x33, 0x11, 0x14, 0x16, 0x16, 0x33, 0x32, 0x36, 0x36, 0x01, 0xca,
-    0x65, 0x65, 0x01, 0xe8, 0x78, 0x24, 0x2e, 0x6f, 0x82, 0x4a, 0x8a, 0xc3, 0x65, 0x78, 0x46, 0x8c,
-    0x68, 0x46, 0x87, 0x75, 0x03, 0x24, 0xfd, 0xc0, 0x03, 0xa9, 0xfb, 0x73, 0x04, 0x8d, 0xfd, 0xe7,
-    0x6a, 0x16, 0x26, 0x17, 0x4e, 0xb2, 0x97, 0x01, 0x3f, 0xfe, 0xc1, 0x74, 0x84, 0x38, 0x1a, 0x27,
-    0x00, 0x02, 0x00, 0x9b, 0x00, 0x00, 0x04, 0x09, 0x04, 0x8d, 0x00, 0x03, 0x00, 0x17, 0x00, 0x14,
-    0x40, 0x09, 0x0f, 0x12, 0x14, 0x09, 0x09, 0x01, 0x7d, 0x00, 0x12, 0x00, 0x3f, 0x3f, 0x39, 0x2f,
-    0x33, 0x3f, 0x30, 0x31, 0x73, 0x11, 0x33, 0x11, 0x03, 0x35, 0x3e, 0x02, 0x33, 0x32, 0x16, 0x16,
-    0x15, 0x11, 0x23, 0x11, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x9b, 0x78, 0x24, 0x2e, 0x6f,
-    0x82, 0x4a, 0x8b, 0xc1, 0x65, 0x77, 0x46, 0x8b, 0x69, 0x46, 0x88, 0x73, 0x04, 0x8d, 0xfb, 0x73,
-    0x02, 0x1a, 0x6a, 0x16, 0x27, 0x17, 0x4e, 0xb2, 0x97, 0xfe, 0xbf, 0x01, 0x41, 0x73, 0x85, 0x37,
-    0x19, 0x28, 0x00, 0x01, 0x00, 0x0b, 0xff, 0xee, 0x05, 0x44, 0x04, 0x9d, 0x00, 0x34, 0x00, 0x1b,
-    0x40, 0x0c, 0x18, 0x18, 0x1d, 0x1d, 0x11, 0x11, 0x22, 0x0b, 0x7e, 0x2d, 0x00, 0x0b, 0x00, 0x3f,
-    0x32, 0x3f, 0x33, 0x39, 0x2f, 0x33, 0x11, 0x33, 0x2f, 0x30, 0x31, 0x45, 0x22, 0x2e, 0x02, 0x35,
-    0x35, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x15, 0x21, 0x22, 0x2e, 0x02, 0x35, 0x33,
-    0x14, 0x16, 0x16, 0x33, 0x21, 0x35, 0x34, 0x26, 0x26, 0x23, 0x22, 0x0e, 0x02, 0x15, 0x15, 0x14,
-    0x1e, 0x02, 0x33, 0x32, 0x36, 0x37, 0x17, 0x0e, 0x02, 0x03, 0x71, 0x7c, 0xc3, 0x88, 0x48, 0x4b,
-    0x86, 0xb4, 0x69, 0x76, 0xba, 0x81, 0x43, 0xfc, 0x3b, 0x5a, 0x8b, 0x5e, 0x31, 0x68, 0x3b, 0x77,
-    0x5a, 0x03, 0x4d, 0x53, 0xa8, 0x81, 0x56, 0x8a, 0x62, 0x34, 0x2f, 0x62, 0x9b, 0x6b, 0x6f, 0x9f,
-    0x38, 0x2c, 0x20, 0x64, 0x8f, 0x12, 0x4c, 0x8c, 0xc0, 0x73, 0x87, 0x7c, 0xc7, 0x8f, 0x4b, 0x45,
-    0x83, 0xbd, 0x78, 0x75, 0x2f, 0x59, 0x81, 0x51, 0x4c, 0x6d, 0x3a, 0x25, 0x71, 0xac, 0x61, 0x41,
-    0x75, 0xa0, 0x5f, 0x87, 0x54, 0x97, 0x72, 0x42, 0x38, 0x26, 0x5e, 0x18, 0x32, 0x22, 0x00, 0x01,
-    0x00, 0x5f, 0xff, 0xee, 0x04, 0x40, 0x04, 0x9d, 0x00, 0x2b, 0x00, 0x15, 0x40, 0x09, 0x11, 0x14,
-    0x14, 0x19, 0x0b, 0x0b, 0x24, 0x00, 0x7e, 0x00, 0x3f, 0x32, 0x3f, 0x33, 0x39, 0x2f, 0x33, 0x30,
-    0x31, 0x41, 0x32, 0x1e, 0x02, 0x15, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x35,
-    0x21, 0x15, 0x21, 0x15, 0x14, 0x16, 0x16, 0x33, 0x32, 0x3e, 0x02, 0x35, 0x35, 0x34, 0x2e, 0x02,
-    0x23, 0x22, 0x06, 0x07, 0x27, 0x3e, 0x02, 0x02, 0x39, 0x7a, 0xc1, 0x86, 0x46, 0x4a, 0x86, 0xb4,
-    0x69, 0x77, 0xba, 0x80, 0x43, 0x03, 0x8f, 0xfc, 0xe9, 0x52, 0xa9, 0x81, 0x56, 0x8a, 0x61, 0x34,
-    0x2f, 0x62, 0x9a, 0x6c, 0x6f, 0x9e, 0x38, 0x2c, 0x21, 0x65, 0x92, 0x04, 0x9d, 0x4c, 0x8c, 0xc0,
-    0x73, 0x86, 0x7c, 0xc8, 0x8e, 0x4c, 0x45, 0x84, 0xbd, 0x78, 0x74, 0x67, 0x25, 0x70, 0xac, 0x61,
-    0x40, 0x76, 0x9f, 0x60, 0x86, 0x55, 0x96, 0x72, 0x42, 0x37, 0x27, 0x5e, 0x18, 0x32, 0x22, 0x00,
-    0x00, 0x02, 0x00, 0x4f, 0xff, 0xee, 0x03, 0xca, 0x04, 0x8d, 0x00, 0x07, 0x00, 0x26, 0x00, 0x1b,
-    0x40, 0x0c, 0x08, 0x05, 0x05, 0x04, 0x26, 0x26, 0x1d, 0x13, 0x0b, 0x07, 0x00, 0x7d, 0x00, 0x3f,
-    0x32, 0x3f, 0x33, 0x39, 0x2f, 0x33, 0x33, 0x11, 0x33, 0x30, 0x31, 0x53, 0x21, 0x17, 0x01, 0x23,
-    0x35, 0x01, 0x21, 0x01, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02,
-    0x35, 0x33, 0x1e, 0x02, 0x33, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x23, 0x79, 0x03,
-    0x21, 0x02, 0xfe, 0x42, 0x4e, 0x01, 0x74, 0xfd, 0x75, 0x01, 0x17, 0x7f, 0x72, 0xa7, 0x6d, 0x35,
-    0x45, 0x7b, 0xa3, 0x60, 0x4b, 0x9a, 0x83, 0x50, 0x78, 0x02, 0x55, 0x8f, 0x5a, 0x6c, 0x94, 0x4b,
-    0x4b, 0x91, 0x6c, 0x7a, 0x04, 0x8d, 0x5d, 0xfe, 0x35, 0x42, 0x01, 0x7f, 0xfe, 0x7a, 0x35, 0x5d,
-    0x79, 0x45, 0x56, 0x84, 0x5a, 0x2e, 0x25, 0x51, 0x82, 0x5d, 0x4a, 0x6b, 0x39, 0x3e, 0x72, 0x4c,
-    0x4e, 0x68, 0x37, 0x00, 0x00, 0x03, 0x00, 0x69, 0xff, 0xf0, 0x04, 0x40, 0x04, 0x9d, 0x00, 0x15,
-    0x00, 0x24, 0x00, 0x34, 0x00, 0x1b, 0x40, 0x0e, 0x0b, 0x25, 0x6a, 0x2d, 0x1d, 0x6a, 0x2d, 0x2d,
-    0x0b, 0x00, 0x16, 0x6a, 0x00, 0x0b, 0x00, 0x2f, 0x2f, 0x2b, 0x12, 0x39, 0x2f, 0x2b, 0x2b, 0x30,
-    0x31, 0x41, 0x32, 0x1e, 0x02, 0x15, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x35,
-    0x34, 0x3e, 0x02, 0x17, 0x22, 0x06, 0x06, 0x07, 0x14, 0x06, 0x15, 0x21, 0x26, 0x34, 0x27, 0x2e,
-    0x02, 0x03, 0x32, 0x36, 0x36, 0x37, 0x34, 0x34, 0x37, 0x21, 0x14, 0x16, 0x15, 0x1e, 0x03, 0x02,
-    0x54, 0x70, 0xb5, 0x82, 0x45, 0x45, 0x81, 0xb5, 0x6f, 0x6f, 0xb5, 0x82, 0x47, 0x46, 0x82, 0xb5,
-    0x6e, 0x6e, 0xa2, 0x5c, 0x06, 0x01, 0x02, 0xe9, 0x01, 0x01, 0x05, 0x5c, 0xa2, 0x6f, 0x72, 0xa2,
-    0x5a, 0x05, 0x01, 0xfd, 0x17, 0x01, 0x04, 0x37, 0x60, 0x86, 0x04, 0x9d, 0x4b, 0x8f, 0xc8, 0x7c,
-    0x71, 0x7d, 0xc7, 0x8e, 0x4c, 0x4c, 0x8e, 0xc7, 0x7d, 0x71, 0x7c, 0xc8, 0x8f, 0x4b, 0x69, 0x61,
-    0xb2, 0x7b, 0x0a, 0x15, 0x0b, 0x0b, 0x16, 0x0a, 0x7a, 0xb2, 0x61, 0xfc, 0x24, 0x62, 0xb4, 0x7c,
-    0x0b, 0x16, 0x0b, 0x0b, 0x18, 0x0b, 0x5c, 0x94, 0x68, 0x38, 0x00, 0x04, 0x00, 0x2a, 0x00, 0x00,
-    0x03, 0xc9, 0x04, 0x9d, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x2a, 0x00, 0x21, 0x40, 0x0f,
-    0x06, 0x07, 0x03, 0x02, 0x02, 0x09, 0x26, 0x1d, 0x7e, 0x12, 0x0a, 0x0a, 0x11, 0x09, 0x12, 0x00,
-    0x3f, 0x33, 0x33, 0x11, 0x33, 0x3f, 0x33, 0x12, 0x39, 0x2f, 0x33, 0xce, 0x32, 0x30, 0x31, 0x41,
-    0x15, 0x21, 0x35, 0x05, 0x15, 0x21, 0x35, 0x01, 0x21, 0x35, 0x21, 0x01, 0x13, 0x16, 0x06, 0x06,
-    0x07, 0x27, 0x3e, 0x03, 0x27, 0x03, 0x26, 0x3e, 0x02, 0x33, 0x32, 0x16, 0x16, 0x15, 0x23, 0x34,
-    0x26, 0x26, 0x23, 0x22, 0x0e, 0x02, 0x02, 0xfb, 0xfd, 0x2f, 0x02, 0xd1, 0xfd, 0x2f, 0x03, 0x9f,
-    0xfc, 0x98, 0x03, 0x68, 0xfd, 0x90, 0x09, 0x04, 0x16, 0x3b, 0x36, 0x74, 0x27, 0x33, 0x1d, 0x0b,
-    0x02, 0x0a, 0x04, 0x2e, 0x5c, 0x87, 0x55, 0x7e, 0x9b, 0x48, 0x78, 0x39, 0x68, 0x48, 0x3b, 0x5a,
-    0x3c, 0x1c, 0x02, 0xa6, 0x58, 0x58, 0xdc, 0x58, 0x58, 0xfe, 0x36, 0x67, 0x02, 0x81, 0xfe, 0xea,
-    0x54, 0xa0, 0x81, 0x27, 0x31, 0x0c, 0x4f, 0x6c, 0x74, 0x30, 0x01, 0x16, 0x67, 0xa2, 0x71, 0x3b,
-    0x61, 0xae, 0x74, 0x68, 0x7c, 0x37, 0x2b, 0x54, 0x7c, 0x00, 0x00, 0x03, 0x00, 0x36, 0xff, 0xee,
-    0x03, 0x7d, 0x04, 0x9d, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2b, 0x00, 0x1d, 0x40, 0x0d, 0x27, 0x26,
-    0x26, 0x2a, 0x2b, 0x2b, 0x07, 0x19, 0x12, 0x7e, 0x00, 0x07, 0x0b, 0x00, 0x3f, 0x33, 0x3f, 0x33,
-    0x12, 0x39, 0x2f, 0x33, 0x33, 0x2f, 0x33, 0x30, 0x31, 0x65, 0x32, 0x36, 0x37, 0x17, 0x06, 0x06,
-    0x23, 0x22, 0x2e, 0x02, 0x35, 0x35, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x16, 0x17, 0x07, 0x26, 0x26,
-    0x23, 0x22, 0x0e, 0x02, 0x15, 0x15, 0x14, 0x1e, 0x02, 0x13, 0x15, 0x21, 0x35, 0x05, 0x15, 0x21,
-    0x35, 0x02, 0xa2, 0x3a, 0x61, 0x33, 0x0d, 0x35, 0x6b, 0x3b, 0x6d, 0xa9, 0x73, 0x3c, 0x3b, 0x73,
-    0xa8, 0x6d, 0x3c, 0x66, 0x3b, 0x0a, 0x33, 0x65, 0x3b, 0x56, 0x7c, 0x52, 0x27, 0x28, 0x52, 0x7d,
-    0xbb, 0xfd, 0x2f, 0x02, 0xd1, 0xfd, 0x2f, 0x54, 0x11, 0x0f, 0x67, 0x0f, 0x10, 0x45, 0x85, 0xc1,
-    0x7b, 0xa1, 0x7b, 0xc2, 0x85, 0x46, 0x11, 0x0e, 0x67, 0x10, 0x0f, 0x37, 0x6a, 0x9b, 0x63, 0xa3,
-    0x62, 0x9a, 0x6c, 0x38, 0x02, 0x87, 0x57, 0x57, 0xdc, 0x57, 0x57, 0x00, 0x00, 0x04, 0x00, 0x9b,
-    0x00, 0x00, 0x07, 0x75, 0x04, 0x9f, 0x00, 0x03, 0x00, 0x15, 0x00, 0x27, 0x00, 0x31, 0x00, 0x29,
-    0x40, 0x12, 0x2b, 0x30, 0x2e, 0x2d, 0x24, 0x09, 0x09, 0x31, 0x2e, 0x7d, 0x2a, 0x2d, 0x0a, 0x1b,
-    0x12, 0x12, 0x02, 0x03, 0x00, 0x2f, 0x33, 0x33, 0x7c, 0x2f, 0x33, 0x18, 0x3f, 0x33, 0x3f, 0x33,
-    0x33, 0x2f, 0x33, 0x11, 0x12, 0x39, 0x39, 0x30, 0x31, 0x41, 0x15, 0x21, 0x35, 0x03, 0x35, 0x34,
-    0x36, 0x36, 0x33, 0x32, 0x16, 0x16, 0x15, 0x15, 0x14, 0x06, 0x06, 0x23, 0x22, 0x26, 0x26, 0x37,
-    0x15, 0x14, 0x16, 0x16, 0x33, 0x32, 0x36, 0x36, 0x35, 0x35, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06,
-    0x06, 0x25, 0x11, 0x23, 0x01, 0x11, 0x23, 0x11, 0x33, 0x01, 0x11, 0x07, 0x4b, 0xfd, 0xe1, 0x3e,
-    0x4f, 0x91, 0x63, 0x65, 0x91, 0x4e, 0x4e, 0x90, 0x64, 0x64, 0x92, 0x4f, 0x6d, 0x2e, 0x60, 0x4a,
-    0x48, 0x5f, 0x2f, 0x2f, 0x60, 0x49, 0x48, 0x5f, 0x2f, 0xfe, 0xec, 0x78, 0xfd, 0x43, 0x77, 0x77,
-    0x02, 0xbd, 0x01, 0x5f, 0x62, 0x62, 0x01, 0xb0, 0x41, 0x62, 0x97, 0x56, 0x56, 0x97, 0x62, 0x41,
-    0x61, 0x97, 0x56, 0x56, 0x97, 0xa2, 0x41, 0x42, 0x6d, 0x3f, 0x3f, 0x6d, 0x42, 0x41, 0x42, 0x6c,
-    0x40, 0x40, 0x6c, 0xfb, 0xfb, 0x73, 0x03, 0xd0, 0xfc, 0x30, 0x04, 0x8d, 0xfc, 0x32, 0x03, 0xce,
-    0x00, 0x02, 0x00, 0x28, 0x00, 0x00, 0x04, 0x3f, 0x04, 0x8d, 0x00, 0x18, 0x00, 0x1c, 0x00, 0x1b,
-    0x40, 0x0b, 0x1b, 0x1c, 0x02, 0x01, 0x01, 0x0e, 0x0c, 0x0f, 0x7d, 0x0e, 0x0a, 0x00, 0x3f, 0x3f,
-    0x33, 0x12, 0x39, 0x7c, 0x2f, 0x33, 0x18, 0xce, 0x32, 0x30, 0x31, 0x41, 0x21, 0x35, 0x21, 0x32,
-    0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x21, 0x11, 0x23, 0x11, 0x21, 0x32, 0x16, 0x16, 0x15,
-    0x14, 0x0e, 0x02, 0x07, 0x15, 0x21, 0x35, 0x02, 0xa6, 0xfd, 0x82, 0x02, 0x7e, 0x66, 0x7f, 0x3c,
-    0x3c, 0x7f, 0x66, 0xfe, 0xbe, 0x77, 0x01, 0xb9, 0x83, 0xb6, 0x60, 0x36, 0x69, 0x98, 0x7c, 0xfd,
-    0x9c, 0x01, 0xb4, 0x67, 0x4c, 0x77, 0x41, 0x44, 0x78, 0x4b, 0xfb, 0xda, 0x04, 0x8d, 0x5f, 0xa4,
-    0x69, 0x4f, 0x86, 0x62, 0x36, 0x66, 0x66, 0x66, 0x00, 0x02, 0x00, 0x48, 0xff, 0xf5, 0x02, 0x8c,
-    0x03, 0x20, 0x00, 0x19, 0x00, 0x33, 0x00, 0x19, 0x40, 0x0a, 0x1b, 0x00, 0x00, 0x19, 0x1a, 0x1a,
-    0x08, 0x10, 0x2c, 0x24, 0x00, 0x2f, 0x33, 0xcc, 0x32, 0x39, 0x2f, 0x33, 0x33, 0x11, 0x33, 0x30,
-    0x31, 0x41, 0x33, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x23, 0x22, 0x06, 0x15, 0x23, 0x34, 0x36,
-    0x36, 0x33, 0x32, 0x16, 0x16, 0x15, 0x14, 0x06, 0x06, 0x23, 0x23, 0x15, 0x35, 0x33, 0x32, 0x16,
-    0x16, 0x15, 0x14, 0x06, 0x06, 0x23, 0x22, 0x26, 0x26, 0x35, 0x33, 0x14, 0x16, 0x33, 0x32, 0x36,
-    0x35, 0x34, 0x26, 0x26, 0x23, 0x01, 0x0c, 0x4e, 0x3d, 0x51, 0x2a, 0x50, 0x57, 0x49, 0x63, 0x69,
-    0x49, 0x7e, 0x4c, 0x53, 0x7b, 0x45, 0x41, 0x7a, 0x56, 0x5f, 0x5f, 0x61, 0x80, 0x40, 0x4b, 0x82,
-    0x53, 0x48, 0x86, 0x56, 0x69, 0x6b, 0x53, 0x56, 0x5d, 0x32, 0x5a, 0x3c, 0x01, 0xbb, 0x23, 0x3d,
-    0x26, 0x38, 0x4f, 0x47, 0x3c, 0x43, 0x62, 0x36, 0x33, 0x63, 0x47, 0x34, 0x59, 0x36, 0x17, 0x3a,
-    0x31, 0x5b, 0x3f, 0x48, 0x66, 0x35, 0x31, 0x67, 0x4f, 0x3e, 0x51, 0x4d, 0x41, 0x33, 0x3e, 0x1d,
-    0x00, 0x02, 0x00, 0x3c, 0x00, 0x00, 0x02, 0xb7, 0x03, 0x15, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x17,
-    0x40, 0x09, 0x03, 0x07, 0x07, 0x01, 0x01, 0x06, 0x05, 0x08, 0x0a, 0x00, 0x2f, 0xcc, 0x32, 0x32,
-    0x39, 0x2f, 0x33, 0x11, 0x33, 0x30, 0x31, 0x41, 0x15, 0x21, 0x27, 0x01, 0x33, 0x07, 0x01, 0x01,
-    0x11, 0x23, 0x11, 0x02, 0xb7, 0xfd, 0x89, 0x04, 0x01, 0x8d, 0x55, 0x6e, 0xfe, 0xfe, 0x01, 0x89,
-    0x69, 0x01, 0x15, 0x5a, 0x43, 0x02, 0x17, 0xb5, 0xfe, 0xb5, 0x02, 0x00, 0xfc, 0xeb, 0x03, 0x15,
-    0x00, 0x01, 0x00, 0x6d, 0xff, 0xf5, 0x02, 0x99, 0x03, 0x15, 0x00, 0x21, 0x00, 0x12, 0xb6, 0x1f,
-    0x09, 0x09, 0x04, 0x03, 0x19, 0x11, 0x00, 0x2f, 0x33, 0xcc, 0x32, 0x39, 0x2f, 0x33, 0x30, 0x31,
-    0x53, 0x27, 0x13, 0x21, 0x15, 0x21, 0x07, 0x36, 0x36, 0x33, 0x32, 0x16, 0x16, 0x15, 0x14, 0x06,
-    0x06, 0x23, 0x22, 0x26, 0x26, 0x27, 0x33, 0x16, 0x16, 0x33, 0x32, 0x36, 0x35, 0x34, 0x26, 0x23,
-    0x22, 0x06, 0xd4, 0x53, 0x30, 0x01, 0xcf, 0xfe, 0x89, 0x1e, 0x15, 0x55, 0x36, 0x52, 0x79, 0x43,
-    0x3b, 0x7c, 0x61, 0x43, 0x7b, 0x51, 0x05, 0x68, 0x07, 0x61, 0x44, 0x5c, 0x53, 0x61, 0x59, 0x40,
-    0x45, 0x01, 0x77, 0x17, 0x01, 0x87, 0x5b, 0xe3, 0x0c, 0x1a, 0x3d, 0x72, 0x4f, 0x49, 0x79, 0x48,
-    0x33, 0x63, 0x49, 0x43, 0x44, 0x61, 0x52, 0x4c, 0x5f, 0x1f, 0x00, 0x01, 0x00, 0x61, 0xff, 0xf5,
-    0x02, 0x98, 0x03, 0x1e, 0x00, 0x2d, 0x00, 0x13, 0xb6, 0x13, 0x1c, 0x1c, 0x03, 0x00, 0x0c, 0x24,
-    0x00, 0x2f, 0x33, 0xcc, 0x32, 0x39, 0x7d, 0x2f, 0x33, 0x30, 0x31, 0x41, 0x33, 0x15, 0x23, 0x22,
-    0x06, 0x06, 0x15, 0x15, 0x14, 0x16, 0x16, 0x33, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x23, 0x22,
-    0x06, 0x06, 0x07, 0x27, 0x3e, 0x02, 0x33, 0x32, 0x16, 0x16, 0x15, 0x14, 0x06, 0x06, 0x23, 0x22,
-    0x26, 0x26, 0x35, 0x35, 0x34, 0x3e, 0x02, 0x02, 0x0e, 0x12, 0x0c, 0x65, 0x95, 0x50, 0x30, 0x55,
-    0x35, 0x35, 0x4c, 0x2a, 0x58, 0x58, 0x32, 0x56, 0x35, 0x02, 0x21, 0x02, 0x3f, 0x6f, 0x4a, 0x54,
-    0x71, 0x3a, 0x44, 0x7b, 0x53, 0x59, 0x83, 0x49, 0x3a, 0x6f, 0x9f, 0x03, 0x1e, 0x5a, 0x45, 0x8d,
-    0x6a, 0x6f, 0x41, 0x5b, 0x30, 0x32, 0x52, 0x32, 0x4b, 0x63, 0x28, 0x42, 0x27, 0x24, 0x2e, 0x5b,
-    0x3d, 0x46, 0x77, 0x49, 0x4d, 0x7a, 0x48, 0x4b, 0x87, 0x5a, 0x43, 0x6b, 0xa4, 0x71, 0x3a, 0x00,
-    0x00, 0x01, 0x00, 0x3f, 0x00, 0x00, 0x02, 0x94, 0x03, 0x15, 0x00, 0x06, 0x00, 0x0c, 0xb3, 0x05,
-    0x01, 0x06, 0x02, 0x00, 0x2f, 0xcc, 0x32, 0x32, 0x30, 0x31, 0x41, 0x15, 0x01, 0x23, 0x01, 0x21,
-    0x35, 0x02, 0x94, 0xfe, 0x91, 0x6f, 0x01, 0x6e, 0xfe, 0x1b, 0x03, 0x15, 0x3d, 0xfd, 0x28, 0x02,
-    0xbc, 0x59, 0x00, 0x04, 0x00, 0x50, 0xff, 0xf5, 0x02, 0x93, 0x03, 0x20, 0x00, 0x0f, 0x00, 0x1f,
-    0x00, 0x2f, 0x00, 0x3d, 0x00, 0x17, 0x40, 0x0a, 0x0c, 0x24, 0x3b, 0x03, 0x14, 0x14, 0x34, 0x2c,
-    0x1c, 0x04, 0x00, 0x2f, 0x33, 0xcc, 0x32, 0x39, 0x2f, 0x17, 0x33, 0x30, 0x31, 0x65, 0x14, 0x06,
-    0x06, 0x23, 0x22, 0x26, 0x26, 0x35, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x16, 0x07, 0x34, 0x26,
-    0x26, 0x23, 0x22, 0x06, 0x06, 0x15, 0x14, 0x16, 0x16, 0x33, 0x32, 0x36, 0x36, 0x13, 0x14, 0x06,
-    0x06, 0x23, 0x22, 0x26, 0x26, 0x35, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x16, 0x07, 0x34, 0x26,
-    0x26, 0x23, 0x22, 0x06, 0x15, 0x14, 0x16, 0x16, 0x33, 0x32, 0x36, 0x02, 0x93, 0x4c, 0x83, 0x51,
-    0x52, 0x84, 0x4d, 0x4c, 0x83, 0x52, 0x53, 0x83, 0x4c, 0x69, 0x30, 0x54, 0x35, 0x35, 0x53, 0x2f,
-    0x2f, 0x54, 0x36, 0x35, 0x53, 0x2f, 0x54, 0x46, 0x78, 0x4d, 0x4e, 0x79, 0x46, 0x46, 0x79, 0x4c,
-    0x4d, 0x79, 0x47, 0x6a, 0x2a, 0x49, 0x30, 0x47, 0x5b, 0x2a, 0x4a, 0x30, 0x46, 0x5b, 0xd4, 0x49,
-    0x64, 0x32, 0x32, 0x64, 0x49, 0x42, 0x60, 0x36, 0x36, 0x60, 0x3c, 0x2c, 0x3f, 0x22, 0x22, 0x3f,
-    0x2c, 0x2c, 0x3f, 0x22, 0x22, 0x3f, 0x01, 0x99, 0x3c, 0x5b, 0x33, 0x33, 0x5b, 0x3c, 0x46, 0x61,
-    0x32, 0x32, 0x61, 0x4a, 0x27, 0x3c, 0x22, 0x47, 0x3e, 0x28, 0x3a, 0x21, 0x47, 0x00, 0x00, 0x01,
-    0x00, 0x4c, 0xff, 0xf9, 0x02, 0x81, 0x03, 0x20, 0x00, 0x2e, 0x00, 0x13, 0xb6, 0x12, 0x1b, 0x1b,
-    0x0a, 0x23, 0x01, 0x2d, 0x00, 0x2f, 0x33, 0xcc, 0x32, 0x39, 0x7c, 0x2f, 0x33, 0x30, 0x31, 0x77,
-    0x33, 0x32, 0x36, 0x36, 0x35, 0x35, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x15, 0x14, 0x16,
-    0x16, 0x33, 0x32, 0x36, 0x36, 0x35, 0x17, 0x0e, 0x02, 0x23, 0x22, 0x26, 0x26, 0x35, 0x34, 0x36,
-    0x36, 0x33, 0x32, 0x16, 0x16, 0x15, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x23, 0xce, 0x10, 0x6f, 0x8a,
-    0x41, 0x2d, 0x50, 0x36, 0x36, 0x4e, 0x2b, 0x28, 0x4e, 0x37, 0x3d, 0x55, 0x2d, 0x23, 0x01, 0x40,
-    0x6e, 0x47, 0x52, 0x74, 0x3d, 0x45, 0x7e, 0x56, 0x5a, 0x7f, 0x43, 0x31, 0x67, 0x9d, 0x6d, 0x11,
-    0x50, 0x45, 0x83, 0x5c, 0x80, 0x46, 0x5e, 0x2f, 0x36, 0x56, 0x32, 0x30, 0x52, 0x32, 0x31, 0x49,
-    0x21, 0x21, 0x36, 0x5f, 0x3b, 0x47, 0x78, 0x4a, 0x4d, 0x7f, 0x4c, 0x4c, 0x8e, 0x64, 0x3f, 0x63,
-    0x9e, 0x6f, 0x3a, 0x00, 0x00, 0x01, 0x00, 0x7e, 0x02, 0xae, 0x02, 0xe2, 0x03, 0x15, 0x00, 0x03,
-    0x00, 0x08, 0xb1, 0x03, 0x02, 0x00, 0x2f, 0x33, 0x30, 0x31, 0x41, 0x15, 0x21, 0x35, 0x02, 0xe2,
-    0xfd, 0x9c, 0x03, 0x15, 0x67, 0x67, 0x00, 0x03, 0x00, 0xb1, 0x04, 0x6b, 0x02, 0x4f, 0x06, 0x8a,
-    0x00, 0x03, 0x00, 0x0f, 0x00, 0x1b, 0x00, 0x19, 0x40, 0x09, 0x13, 0x0d, 0x0d, 0x07, 0x01, 0x03,
-    0x03, 0x19, 0x07, 0x00, 0x2f, 0x33, 0x33, 0x7c, 0x2f, 0x18, 0xcd, 0x11, 0x33, 0x11, 0x33, 0x30,
-    0x31, 0x41, 0x37, 0x33, 0x07, 0x07, 0x34, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14, 0x06, 0x23, 0x22,
-    0x26, 0x37, 0x14, 0x16, 0x33, 0x32, 0x36, 0x35, 0x34, 0x26, 0x23, 0x22, 0x06, 0x01, 0x2a, 0x9e,
-    0x87, 0xca, 0xd4, 0x5b, 0x40, 0x3e, 0x5a, 0x5a, 0x3e, 0x40, 0x5b, 0x43, 0x34, 0x24, 0x23, 0x32,
-    0x32, 0x23, 0x24, 0x34, 0x05, 0xcf, 0xbb, 0xbb, 0xce, 0x43, 0x58, 0x58, 0x43, 0x41, 0x55, 0x55,
-    0x41, 0x24, 0x32, 0x32, 0x24, 0x27, 0x33, 0x33, 0x00, 0x04, 0x00, 0x9b, 0x00, 0x00, 0x03, 0xab,
-    0x04, 0x8d, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x1b, 0x40, 0x0c, 0x0b, 0x0a,
-    0x0a, 0x06, 0x0f, 0x0e, 0x07, 0x7d, 0x03, 0x02, 0x06, 0x0a, 0x00, 0x3f, 0x33, 0x33, 0x3f, 0x33,
-    0x33, 0x12, 0x39, 0x2f, 0x33, 0x30, 0x31, 0x65, 0x15, 0x21, 0x35, 0x13, 0x11, 0x23, 0x11, 0x01,
-    0x15, 0x21, 0x35, 0x01, 0x15, 0x21, 0x35, 0x03, 0xab, 0xfd, 0x41, 0x26, 0x77, 0x02, 0xb8, 0xfd,
-    0x99, 0x02, 0xbb, 0xfd, 0x45, 0x67, 0x67, 0x67, 0x04, 0x26, 0xfb, 0x73, 0x04, 0x8d, 0xfe, 0x03,
-    0x67, 0x67, 0x01, 0xfd, 0x68, 0x68, 0x00, 0x04, 0x00, 0x3d, 0xfe, 0x4a, 0x03, 0xf3, 0x04, 0x4e,
-    0x00, 0x12, 0x00, 0x24, 0x00, 0x5b, 0x00, 0x5f, 0x00, 0x33, 0x40, 0x1a, 0x5d, 0x5f, 0x06, 0x72,
-    0x25, 0x26, 0x18, 0x18, 0x0f, 0x40, 0x41, 0x41, 0x2e, 0x53, 0x53, 0x0f, 0x0f, 0x05, 0x4a, 0x37,
-    0x0f, 0x72, 0x21, 0x05, 0x07, 0x72, 0x00, 0x2b, 0x32, 0x2b, 0x32, 0x11, 0x39, 0x2f, 0x39, 0x11,
-    0x33, 0x33, 0x11, 0x33, 0x11, 0x33, 0x12, 0x39, 0x39, 0x2b, 0x32, 0x30, 0x31, 0x53, 0x35, 0x34,
-    0x36, 0x36, 0x33, 0x32, 0x16, 0x16, 0x15, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x26, 0x26, 0x37,
-    0x15, 0x14, 0x16, 0x16, 0x33, 0x32, 0x36, 0x36, 0x35, 0x35, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06,
-    0x06, 0x13, 0x17, 0x06, 0x06, 0x15, 0x14, 0x16, 0x16, 0x33, 0x33, 0x32, 0x16, 0x16, 0x15, 0x14,
-    0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x34, 0x36, 0x36, 0x37, 0x17, 0x0e, 0x02, 0x15, 0x14,
-    0x1e, 0x02, 0x33, 0x32, 0x3e, 0x02, 0x35, 0x34, 0x26, 0x26, 0x23, 0x23, 0x22, 0x26, 0x26, 0x35,
-    0x34, 0x36, 0x36, 0x01, 0x17, 0x21, 0x27, 0x78, 0x69, 0xb7, 0x76, 0x78, 0xb7, 0x67, 0x3b, 0x6c,
-    0x94, 0x59, 0x77, 0xb8, 0x69, 0x78, 0x47, 0x81, 0x58, 0x56, 0x80, 0x47, 0x48, 0x81, 0x56, 0x56,
-    0x81, 0x47, 0x71, 0x3a, 0x1b, 0x49, 0x24, 0x3a, 0x21, 0xb5, 0x76, 0xaf, 0x62, 0x44, 0x84, 0xc0,
-    0x7c, 0x6a, 0xa2, 0x6e, 0x37, 0x61, 0x91, 0x47, 0x1c, 0x3b, 0x65, 0x3e, 0x26, 0x4d, 0x76, 0x51,
-    0x60, 0x94, 0x64, 0x34, 0x35, 0x78, 0x62, 0xc7, 0x38, 0x65, 0x3e, 0x34, 0x48, 0x02, 0xac, 0x02,
-    0xfe, 0xa1, 0x0f, 0x02, 0xdb, 0x16, 0x66, 0x9d, 0x5a, 0x5a, 0x9d, 0x66, 0x16, 0x45, 0x7b, 0x5e,
-    0x35, 0x5c, 0x9b, 0x72, 0x16, 0x3a, 0x6d, 0x46, 0x46, 0x6d, 0x3a, 0x16, 0x42, 0x6f, 0x45, 0x45,
-    0x6f, 0xfe, 0xae, 0x32, 0x11, 0x46, 0x3c, 0x26, 0x2a, 0x11, 0x3f, 0x80, 0x62, 0x39, 0x77, 0x63,
-    0x3d, 0x2c, 0x4f, 0x66, 0x39, 0x5b, 0x83, 0x50, 0x0e, 0x41, 0x08, 0x43, 0x64, 0x3a, 0x28, 0x48,
-    0x36, 0x1f, 0x2a, 0x46, 0x52, 0x27, 0x37, 0x54, 0x30, 0x22, 0x4b, 0x3e, 0x3e, 0x57, 0x3a, 0x02,
-    0x6b, 0x64, 0x64, 0x00, 0x00, 0x04, 0x00, 0x6f, 0xff, 0xeb, 0x04, 0x35, 0x04, 0x4e, 0x00, 0x15,
-    0x00, 0x2b, 0x00, 0x2f, 0x00, 0x33, 0x00, 0x17, 0x40, 0x0c, 0x30, 0x0a, 0x2d, 0x06, 0x1c, 0x11,
-    0x0b, 0x72, 0x27, 0x06, 0x07, 0x72, 0x00, 0x2b, 0x32, 0x2b, 0x32, 0x3f, 0x3f, 0x30, 0x31, 0x53,
-    0x35, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x1e, 0x02, 0x17, 0x15, 0x0e, 0x03, 0x23, 0x22, 0x2e, 0x02,
-    0x37, 0x15, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x3e, 0x02, 0x37, 0x35, 0x2e, 0x03, 0x23, 0x22, 0x0e,
-    0x02, 0x05, 0x13, 0x33, 0x0b, 0x02, 0x33, 0x13, 0x6f, 0x38, 0x6a, 0x9b, 0x63, 0x5c, 0x8e, 0x66,
-    0x3f, 0x0e, 0x0b, 0x3e, 0x67, 0x91, 0x5e, 0x62, 0x9a, 0x6a, 0x38, 0x79, 0x26, 0x4c, 0x78, 0x51,
-    0x43, 0x6b, 0x50, 0x35, 0x0e, 0x0b, 0x2d, 0x4c, 0x6f, 0x4c, 0x52, 0x78, 0x4d, 0x26, 0x02, 0x82,
-    0x4e, 0x76, 0x61, 0x0e, 0x55, 0x63, 0x68, 0x01, 0xff, 0x15, 0x80, 0xd1, 0x97, 0x52, 0x49, 0x85,
-    0xb2, 0x6a, 0x94, 0x65, 0xb0, 0x85, 0x4b, 0x4d, 0x8d, 0xc3, 0x8c, 0x15, 0x5c, 0x9d, 0x74, 0x40,
-    0x41, 0x71, 0x96, 0x55, 0x4f, 0x47, 0x95, 0x7f, 0x4e, 0x48, 0x80, 0xa9, 0x5a, 0x02, 0x1e, 0xfd,
-    0xe2, 0xfd, 0xe4, 0x02, 0x1c, 0xfd, 0xe4, 0x00, 0x00, 0x02, 0x00, 0xbb, 0x00, 0x00, 0x04, 0xcb,
-    0x05, 0xb0, 0x00, 0x19, 0x00, 0x2e, 0x00, 0x1f, 0x40, 0x0f, 0x26, 0x08, 0x1b, 0x1a, 0x1a, 0x02,
-    0x01, 0x01, 0x0e, 0x0c, 0x0f, 0x02, 0x72, 0x0e, 0x08, 0x00, 0x3f, 0x2b, 0x32, 0x12, 0x39, 0x2f,
-    0x33, 0x33, 0x11, 0x33, 0x3f, 0x30, 0x31, 0x41, 0x21, 0x27, 0x21, 0x32, 0x36, 0x36, 0x35, 0x34,
-    0x26, 0x26, 0x23, 0x21, 0x11, 0x23, 0x11, 0x21, 0x32, 0x16, 0x16, 0x15, 0x14, 0x06, 0x06, 0x0f,
-    0x02, 0x37, 0x32, 0x16, 0x16, 0x15, 0x15, 0x14, 0x16, 0x16, 0x17, 0x15, 0x23, 0x2e, 0x02, 0x35,
-    0x35, 0x34, 0x26, 0x26, 0x02, 0xd1, 0xfe, 0x3a, 0x02, 0x01, 0x91, 0x8b, 0xa5, 0x49, 0x4e, 0xa0,
-    0x7d, 0xfe, 0x8e, 0x7b, 0x01, 0xee, 0x9d, 0xd8, 0x70, 0x52, 0x9d, 0x71, 0x31, 0x36, 0x11, 0xa6,
-    0xbb, 0x4d, 0x0c, 0x1f, 0x1a, 0x7d, 0x1b, 0x1d, 0x0b, 0x4b, 0x91, 0x02, 0x90, 0x6a, 0x4d, 0x84,
-    0x52, 0x5d, 0x85, 0x47, 0xfa, 0xba, 0x05, 0xb0, 0x5b, 0xb3, 0x85, 0x58, 0x99, 0x68, 0x13, 0x0d,
-    0x14, 0x4b, 0x5d, 0xa3, 0x69, 0x87, 0x28, 0x4f, 0x42, 0x19, 0x19, 0x1b, 0x53, 0x59, 0x26, 0x83,
-    0x59, 0x81, 0x46, 0x00, 0x00, 0x03, 0x00, 0xbd, 0x00, 0x00, 0x04, 0xf5, 0x05, 0xb0, 0x00, 0x03,
-    0x00, 0x09, 0x00, 0x0d, 0x00, 0x20, 0x40, 0x10, 0x0a, 0x08, 0x09, 0x02, 0x0c, 0x0b, 0x0b, 0x07,
-    0x06, 0x06, 0x02, 0x03, 0x02, 0x72, 0x02, 0x08, 0x00, 0x3f, 0x2b, 0x12, 0x39, 0x2f, 0x33, 0x33,
-    0x11, 0x33, 0x3f, 0x3f, 0x30, 0x31, 0x41, 0x11, 0x23, 0x11, 0x21, 0x01, 0x21, 0x27, 0x33, 0x01,
-    0x13, 0x01, 0x37, 0x01, 0x01, 0x39, 0x7c, 0x04, 0x0c, 0xfd, 0x79, 0xfe, 0xc5, 0x0b, 0xff, 0x02,
-    0x33, 0x2d, 0xfd, 0x9a, 0x47, 0x02, 0xb9, 0x05, 0xb0, 0xfa, 0x50, 0x05, 0xb0, 0xfc, 0xfb, 0x6b,
-    0x02, 0x9a, 0xfa, 0x50, 0x02, 0xb9, 0x6c, 0xfc, 0xdb, 0x00, 0x00, 0x03, 0x00, 0xa0, 0x00, 0x00,
-    0x03, 0xe7, 0x06, 0x00, 0x00, 0x03, 0x00, 0x09, 0x00, 0x0d, 0x00, 0x1c, 0x40, 0x0e, 0x0b, 0x07,
-    0x06, 0x06, 0x02, 0x09, 0x06, 0x72, 0x03, 0x00, 0x72, 0x0a, 0x02, 0x0a, 0x00, 0x3f, 0x33, 0x2b,
-    0x2b, 0x12, 0x39, 0x2f, 0x33, 0x33, 0x30, 0x31, 0x41, 0x11, 0x23, 0x11, 0x01, 0x01, 0x23, 0x27,
-    0x33, 0x01, 0x13, 0x01, 0x37, 0x01, 0x01, 0x17, 0x77, 0x03, 0x1b, 0xfe, 0x14, 0xde, 0x16, 0xbb,
-    0x01, 0x93, 0x2d, 0xfe, 0x3c, 0x43, 0x02, 0x12, 0x06, 0x00, 0xfa, 0x00, 0x06, 0x00, 0xfe, 0x3a,
-    0xfd, 0xd5, 0x68, 0x01, 0xc3, 0xfb, 0xc6, 0x02, 0x22, 0x68, 0xfd, 0x76, 0x00, 0x03, 0x00, 0xbd,
-    0x00, 0x00, 0x04, 0xbb, 0x05, 0xb0, 0x00, 0x03, 0x00, 0x09, 0x00, 0x0d, 0x00, 0x1a, 0x40, 0x0e,
-    0x06, 0x0b, 0x07, 0x08, 0x0c, 0x05, 0x02, 0x09, 0x03, 0x02, 0x72, 0x0a, 0x02, 0x08, 0x00, 0x3f,
-    0x33, 0x2b, 0x32, 0x12, 0x17, 0x39, 0x30, 0x31, 0x41, 0x11, 0x23, 0x11, 0x21, 0x01, 0x23, 0x27,
-    0x33, 0x01, 0x13, 0x01, 0x37, 0x01, 0x01, 0x39, 0x7c, 0x03, 0xd3, 0xfd, 0x1b, 0xae, 0x0c, 0x53,
-    0x02, 0xab, 0x2d, 0xfd, 0x09, 0x62, 0x03, 0x34, 0x05, 0xb0, 0xfa, 0x50, 0x05, 0xb0, 0xfd, 0x1b,
-    0x40, 0x02, 0xa5, 0xfa, 0x50, 0x02, 0xd9, 0x49, 0xfc, 0xde, 0x00, 0x03, 0x00, 0xa0, 0x00, 0x00,
-    0x03, 0xae, 0x06, 0x18, 0x00, 0x03, 0x00, 0x09, 0x00, 0x0d, 0x00, 0x20, 0x40, 0x10, 0x0c, 0x0b,
-    0x0b, 0x07, 0x06, 0x06, 0x02, 0x09, 0x06, 0x72, 0x03, 0x01, 0x72, 0x0a, 0x02, 0x0a, 0x00, 0x3f,
-    0x33, 0x2b, 0x2b, 0x12, 0x39, 0x2f, 0x33, 0x33, 0x11, 0x33, 0x30, 0x31, 0x41, 0x11, 0x23, 0x11,
-    0x01, 0x01, 0x23, 0x27, 0x33, 0x01, 0x13, 0x01, 0x37, 0x01, 0x01, 0x17, 0x77, 0x02, 0xeb, 0xfd,
-    0xcd, 0x67, 0x16, 0x47, 0x01, 0xcc, 0x29, 0xfe, 0x00, 0x47, 0x02, 0x50, 0x06, 0x18, 0xf9, 0xe8,
-    0x06, 0x18, 0xfe, 0x22, 0xfd, 0xcb, 0x67, 0x01, 0xce, 0xfb, 0xc6, 0x02, 0x17, 0x5d, 0xfd, 0x8c,
-    0x00, 0x02, 0x00, 0x9b, 0x00, 0x00, 0x04, 0x16, 0x04, 0x8d, 0x00, 0x19, 0x00, 0x1d, 0x00, 0x16,
-    0x40, 0x09, 0x1b, 0x1a, 0x0f, 0x02, 0x01, 0x0e, 0x0f, 0x7d, 0x01, 0x00, 0x2f, 0x3f, 0x33, 0x11,
-    0x33, 0x11, 0x33, 0x32, 0x30, 0x31, 0x61, 0x21, 0x37, 0x21, 0x32, 0x36, 0x36, 0x35, 0x35, 0x34,
-    0x2e, 0x02, 0x23, 0x21, 0x35, 0x21, 0x32, 0x1e, 0x02, 0x15, 0x15, 0x14, 0x06, 0x06, 0x01, 0x11,
-    0x23, 0x11, 0x01, 0xf6, 0xfe, 0xe4, 0x02, 0x01, 0x1a, 0x84, 0xbe, 0x67, 0x3b, 0x6e, 0x9a, 0x60,
-    0xfe, 0xd9, 0x01, 0x27, 0x76, 0xc5, 0x90, 0x4f, 0x8a, 0xf5, 0xfe, 0x7b, 0x77, 0x67, 0x6b, 0xc2,
-    0x81, 0x64, 0x63, 0x9e, 0x70, 0x3b, 0x68, 0x4b, 0x8e, 0xc4, 0x79, 0x62, 0xa0, 0xf0, 0x85, 0x04,
-    0x8d, 0xfb, 0x73, 0x04, 0x8d, 0x00, 0x00, 0x01, 0x00, 0x6e, 0xff, 0xf0, 0x04, 0x1a, 0x04, 0x9d,
-    0x00, 0x27, 0x00, 0x11, 0xb6, 0x19, 0x15, 0x10, 0x7e, 0x24, 0x00, 0x05, 0x00, 0x2f, 0xcc, 0x33,
-    0x3f, 0xcc, 0x33, 0x30, 0x31, 0x41, 0x33, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x35, 0x34,
-    0x3e, 0x02, 0x33, 0x32, 0x16, 0x16, 0x17, 0x23, 0x2e, 0x02, 0x23, 0x22, 0x0e, 0x02, 0x15, 0x15,
-    0x14, 0x1e, 0x02, 0x33, 0x32, 0x36, 0x36, 0x03, 0xa2, 0x78, 0x0d, 0x72, 0xc7, 0x8b, 0x6c, 0xaf,
-    0x7d, 0x43, 0x43, 0x7e, 0xb2, 0x6e, 0x88, 0xc4, 0x72, 0x0d, 0x78, 0x0c, 0x4f, 0x8e, 0x6a, 0x55,
-    0x86, 0x5e, 0x31, 0x2f, 0x5b, 0x85, 0x55, 0x6c, 0x8f, 0x51, 0x01, 0x70, 0x77, 0xac, 0x5d, 0x4c,
-    0x8c, 0xc3, 0x78, 0x87, 0x78, 0xc3, 0x8d, 0x4b, 0x5c, 0xae, 0x78, 0x5b, 0x7e, 0x42, 0x3b, 0x71,
-    0x9d, 0x62, 0x88, 0x60, 0x9d, 0x72, 0x3e, 0x3f, 0x7d, 0x00, 0x00, 0x02, 0x00, 0x9b, 0x00, 0x00,
-    0x03, 0xdd, 0x04, 0x8d, 0x00, 0x19, 0x00, 0x31, 0x00, 0x28, 0x40, 0x13, 0x1c, 0x1b, 0x29, 0x19,
-    0x02, 0x02, 0x01, 0x1b, 0x26, 0x01, 0x01, 0x26, 0x1b, 0x03, 0x0d, 0x0c, 0x0f, 0x7d, 0x0d, 0x00,
-    0x2f, 0x3f, 0x33, 0x12, 0x17, 0x39, 0x2f, 0x2f, 0x2f, 0x11, 0x33, 0x12, 0x39, 0x39, 0x11, 0x33,
-    0x30, 0x31, 0x41, 0x21, 0x27, 0x21, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x23, 0x11,
-    0x23, 0x11, 0x21, 0x32, 0x1e, 0x02, 0x15, 0x14, 0x06, 0x06, 0x07, 0x03, 0x21, 0x37, 0x21, 0x32,
-    0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x23, 0x37, 0x21, 0x17, 0x1e, 0x02, 0x15, 0x14, 0x0e,
-    0x02, 0x02, 0x50, 0xfe, 0xa0, 0x02, 0x01, 0x2e, 0x5b, 0x7f, 0x43, 0x44, 0x86, 0x62, 0xfb, 0x77,
-    0x01, 0x72, 0x61, 0x9a, 0x6e, 0x3a, 0x43, 0x7f, 0x5c, 0x4b, 0xfe, 0x85, 0x39, 0x01, 0x42, 0x5a,
-    0x80, 0x44, 0x3c, 0x7a, 0x5f, 0xde, 0x01, 0x01, 0x36, 0x17, 0x58, 0x7f, 0x46, 0x3a, 0x6c, 0x95,
-    0x02, 0x27, 0x61, 0x2e, 0x5c, 0x43, 0x47, 0x5c, 0x2d, 0xfb, 0xdb, 0x04, 0x8d, 0x25, 0x4c, 0x74,
-    0x50, 0x48, 0x74, 0x48, 0x08, 0xfd, 0xb4, 0x67, 0x36, 0x64, 0x47, 0x3f, 0x65, 0x3b, 0x61, 0x24,
-    0x05, 0x51, 0x7d, 0x49, 0x50, 0x7b, 0x53, 0x2a, 0x00, 0x03, 0x00, 0x18, 0x00, 0x00, 0x04, 0x3b,
-    0x04, 0x8d, 0x00, 0x04, 0x00, 0x09, 0x00, 0x0d, 0x00, 0x1c, 0x40, 0x0c, 0x0d, 0x00, 0x06, 0x03,
-    0x0c, 0x0c, 0x01, 0x07, 0x03, 0x7d, 0x05, 0x01, 0x00, 0x2f, 0x33, 0x3f, 0x33, 0x12, 0x39, 0x2f,
-    0x12, 0x39, 0x39, 0x33, 0x30, 0x31, 0x41, 0x01, 0x23, 0x01, 0x33, 0x01, 0x01, 0x27, 0x33, 0x01,
-    0x03, 0x15, 0x21, 0x35, 0x02, 0x2d, 0xfe, 0x67, 0x7c, 0x01, 0xda, 0x55, 0x01, 0x79, 0xfe, 0x69,
-    0x1a, 0x55, 0x01, 0xd7, 0xc8, 0xfd, 0x6d, 0x04, 0x02, 0xfb, 0xfe, 0x04, 0x8d, 0xfb, 0x73, 0x04,
-    0x04, 0x89, 0xfb, 0x73, 0x01, 0x9e, 0x67, 0x67, 0x00, 0x01, 0x00, 0x97, 0x04, 0xb6, 0x01, 0x46,
-    0x06, 0x2a, 0x00, 0x0a, 0x00, 0x0a, 0xb2, 0x05, 0x80, 0x00, 0x00, 0x2f, 0x1a, 0xcd, 0x30, 0x31,
-    0x53, 0x35, 0x34, 0x36, 0x36, 0x37, 0x17, 0x06, 0x06, 0x15, 0x15, 0x97, 0x1f, 0x2e, 0x17, 0x4b,
-    0x1c, 0x1b, 0x04, 0xb6, 0x80, 0x32, 0x5b, 0x4c, 0x1b, 0x31, 0x35, 0x5b, 0x35, 0x7e, 0x00, 0x02,
-    0x00, 0x8b, 0x04, 0xe0, 0x02, 0xd3, 0x06, 0x78, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x12, 0xb5, 0x12,
-    0x13, 0x0a, 0x00, 0x0d, 0x05, 0x00, 0x2f, 0x33, 0x7c, 0xdc, 0x32, 0xd6, 0x18, 0xcd, 0x30, 0x31,
-    0x41, 0x33, 0x14, 0x06, 0x06, 0x23, 0x22, 0x26, 0x26, 0x35, 0x33, 0x14, 0x16, 0x33, 0x32, 0x36,
-    0x27, 0x27, 0x33, 0x17, 0x02, 0x6b, 0x68, 0x46, 0x83, 0x5a, 0x5b, 0x83, 0x47, 0x67, 0x55, 0x69,
-    0x64, 0x57, 0xca, 0xaa, 0x6d, 0x8b, 0x05, 0xb0, 0x3d, 0x5e, 0x35, 0x35, 0x5e, 0x3d, 0x38, 0x52,
-    0x53, 0x31, 0xce, 0xce, 0x00, 0x02, 0xfc, 0xb6, 0x04, 0xb6, 0xfe, 0xcf, 0x06, 0x7d, 0x00, 0x17,
-    0x00, 0x1b, 0x00, 0x1d, 0x40, 0x0c, 0x00, 0x15, 0x15, 0x05, 0x19, 0x1b, 0x1b, 0x09, 0x11, 0x11,
-    0x0c, 0x05, 0x00, 0x2f, 0x33, 0x33, 0x11, 0x33, 0x33, 0x2f, 0x33, 0x11, 0x33, 0x11, 0x33, 0x30,
-    0x31, 0x41, 0x17, 0x14, 0x06, 0x06, 0x23, 0x22, 0x26, 0x26, 0x23, 0x22, 0x06, 0x15, 0x27, 0x34,
-    0x36, 0x36, 0x33, 0x32, 0x16, 0x16, 0x33, 0x32, 0x36, 0x25, 0x37, 0x33, 0x07, 0xfe, 0x8e, 0x41,
-    0x2a, 0x48, 0x2e, 0x36, 0x3f, 0x38, 0x2b, 0x27, 0x38, 0x42, 0x2a, 0x49, 0x2e, 0x30, 0x41, 0x3d,
-    0x2a, 0x26, 0x39, 0xfe, 0xdf, 0x95, 0x76, 0xb3, 0x05, 0x73, 0x11, 0x2d, 0x4a, 0x2a, 0x29, 0x29,
-    0x33, 0x2a, 0x0f, 0x2d, 0x49, 0x2a, 0x29, 0x2a, 0x37, 0x58, 0xdc, 0xdc, 0x00, 0x02, 0x00, 0x5d,
-    0x04, 0xd4, 0x03, 0xc9, 0x06, 0x63, 0x00, 0x06, 0x00, 0x0a, 0x00, 0x14, 0xb7, 0x08, 0x07, 0x07,
-    0x05, 0x01, 0x80, 0x04, 0x06, 0x00, 0x2f, 0x33, 0x1a, 0xcd, 0x39, 0x33, 0x2f, 0xcd, 0x30, 0x31,
-    0x53, 0x25, 0x33, 0x05, 0x23, 0x27, 0x07, 0x25, 0x37, 0x33, 0x07, 0x5d, 0x01, 0x0e, 0x74, 0x01,
-    0x0d, 0x8c, 0xbb, 0xbb, 0x01, 0xc4, 0x93, 0x88, 0xb6, 0x04, 0xd4, 0xf3, 0xf3, 0xac, 0xac, 0xa8,
-    0xe7, 0xe7, 0x00, 0x02, 0xff, 0x90, 0x04, 0xcb, 0x02, 0xfd, 0x06, 0x5a, 0x00, 0x06, 0x00, 0x0a,
-    0x00, 0x17, 0x40, 0x09, 0x07, 0x40, 0x08, 0x08, 0x03, 0x06, 0x80, 0x02, 0x04, 0x00, 0x2f, 0x33,
-    0x1a, 0xcd, 0x39, 0x33, 0x2f, 0x1a, 0xcd, 0x30, 0x31, 0x41, 0x05, 0x23, 0x27, 0x07, 0x23, 0x25,
-    0x25, 0x17, 0x23, 0x27, 0x01, 0xef, 0x01, 0x0e, 0x8d, 0xbb, 0xbb, 0x8c, 0x01, 0x0d, 0xfe, 0x9e,
-    0x93, 0x66, 0xb6, 0x05, 0xbe, 0xf3, 0xac, 0xac, 0xf3, 0x9c, 0xe7, 0xe7, 0x00, 0x02, 0x00, 0x6e,
-    0x04, 0xe4, 0x03, 0xb6, 0x06, 0xb2, 0x00, 0x06, 0x00, 0x1a, 0x00, 0x1f, 0x40, 0x0d, 0x11, 0x12,
-    0x08, 0x40, 0x1a, 0x09, 0x08, 0x08, 0x03, 0x06, 0x80, 0x02, 0x04, 0x00, 0x2f, 0x33, 0x1a, 0xcd,
-    0x39, 0x33, 0x11, 0x33, 0x33, 0x1a, 0x10, 0xcc, 0x32, 0x30, 0x31, 0x41, 0x05, 0x23, 0x27, 0x07,
-    0x23, 0x25, 0x05, 0x23, 0x35, 0x3e, 0x02, 0x35, 0x34, 0x26, 0x26, 0x23, 0x37, 0x32, 0x1e, 0x02,
-    0x15, 0x14, 0x06, 0x07, 0x01, 0xf8, 0x01, 0x05, 0x80, 0xc9, 0xc7, 0x7f, 0x01, 0x04, 0x01, 0xaf,
-    0x51, 0x32, 0x3c, 0x1a, 0x2f, 0x4a, 0x2a, 0x05, 0x3b, 0x5c, 0x42, 0x23, 0x59, 0x3c, 0x05, 0xd7,
-    0xf3, 0xba, 0xba, 0xf3, 0x74, 0x71, 0x03, 0x0e, 0x1d, 0x19, 0x1e, 0x21, 0x0e, 0x4a, 0x14, 0x28,
-    0x36, 0x22, 0x43, 0x3d, 0x06, 0x00, 0x00, 0x02, 0x00, 0x6e, 0x04, 0xe4, 0x02, 0xfd, 0x06, 0xb1,
-    0x00, 0x06, 0x00, 0x1e, 0x00, 0x25, 0x40, 0x10, 0x08, 0x07, 0x07, 0x10, 0x18, 0x0c, 0x40, 0x14,
-    0x13, 0x13, 0x1c, 0x0c, 0x0c, 0x06, 0x80, 0x04, 0x00, 0x2f, 0x1a, 0xcd, 0x32, 0x11, 0x33, 0x33,
-    0x11, 0x33, 0x1a, 0x10, 0xcd, 0x32, 0x32, 0x11, 0x33, 0x30, 0x31, 0x41, 0x05, 0x23, 0x27, 0x07,
-    0x23, 0x25, 0x37, 0x17, 0x14, 0x06, 0x06, 0x23, 0x22, 0x26, 0x26, 0x23, 0x22, 0x06, 0x15, 0x27,
-    0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x16, 0x33, 0x32, 0x36, 0x01, 0xe5, 0x01, 0x18, 0x80, 0xc9,
-    0xc7, 0x7f, 0x01, 0x17, 0xf4, 0x40, 0x27, 0x41, 0x29, 0x34, 0x3c, 0x36, 0x2b, 0x22, 0x2e, 0x40,
-    0x27, 0x42, 0x27, 0x2f, 0x3f, 0x3b, 0x28, 0x22, 0x2f, 0x05, 0xce, 0xea, 0xac, 0xac, 0xea, 0xe0,
-    0x0f, 0x29, 0x43, 0x28, 0x2c, 0x2c, 0x38, 0x26, 0x0e, 0x29, 0x48, 0x2d, 0x2c, 0x2c, 0x30, 0x00,
-    0x00, 0x03, 0x00, 0x9b, 0x00, 0x00, 0x03, 0x7e, 0x05, 0xc4, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0b,
-    0x00, 0x1b, 0x40, 0x0c, 0x02, 0x0a, 0x0a, 0x0b, 0x0b, 0x07, 0x03, 0x03, 0x07, 0x7d, 0x06, 0x0a,
-    0x00, 0x3f, 0x3f, 0x33, 0x2f, 0x11, 0x33, 0x11, 0x33, 0x11, 0x33, 0x30, 0x31, 0x41, 0x11, 0x23,
-    0x11, 0x01, 0x11, 0x23, 0x11, 0x21, 0x15, 0x21, 0x35, 0x03, 0x7e, 0x77, 0xfe, 0x0b, 0x77, 0x02,
-    0xe3, 0xfd, 0x6d, 0x05, 0xc4, 0xfe, 0x61, 0x01, 0x9f, 0xfe, 0xc9, 0xfb, 0x73, 0x04, 0x8d, 0x68,
-    0x68, 0x00, 0x00, 0x02, 0x00, 0x8b, 0x04, 0xe0, 0x02, 0xd3, 0x06, 0x78, 0x00, 0x0f, 0x00, 0x13,
-    0x00, 0x12, 0xb5, 0x11, 0x13, 0x00, 0x0a, 0x0d, 0x05, 0x00, 0x2f, 0x33, 0x7c, 0xdc, 0x32, 0x18,
-    0xd6, 0xcd, 0x30, 0x31, 0x41, 0x33, 0x14, 0x06, 0x06, 0x23, 0x22, 0x26, 0x26, 0x35, 0x33, 0x14,
-    0x16, 0x33, 0x32, 0x36, 0x27, 0x37, 0x33, 0x07, 0x02, 0x6b, 0x68, 0x46, 0x83, 0x5a, 0x5b, 0x83,
-    0x47, 0x67, 0x55, 0x69, 0x64, 0x57, 0xf9, 0x8c, 0x6d, 0xaa, 0x05, 0xb0, 0x3d, 0x5e, 0x35, 0x35,
-    0x5e, 0x3d, 0x38, 0x52, 0x53, 0x31, 0xce, 0xce, 0x00, 0x02, 0x00, 0x8b, 0x04, 0xe2, 0x02, 0xc1,
-    0x06, 0xf6, 0x00, 0x0f, 0x00, 0x25, 0x00, 0x28, 0x40, 0x11, 0x1b, 0x1c, 0x1c, 0x11, 0x25, 0x12,
-    0x12, 0x11, 0x11, 0x09, 0x0d, 0x05, 0x00, 0x09, 0x09, 0x05, 0x10, 0x00, 0x3f, 0x33, 0x7c, 0x2f,
-    0x33, 0x11, 0x33, 0x11, 0x33, 0x18, 0x2f, 0x33, 0x11, 0x33, 0x11, 0x33, 0x2f, 0x33, 0x30, 0x31,
-    0x41, 0x33, 0x14, 0x06, 0x06, 0x23, 0x22, 0x26, 0x26, 0x35, 0x33, 0x14, 0x16, 0x33, 0x32, 0x36,
-    0x27, 0x23, 0x27, 0x3e, 0x02, 0x35, 0x34, 0x2e, 0x02, 0x23, 0x37, 0x32, 0x1e, 0x02, 0x15, 0x14,
-    0x06, 0x06, 0x07, 0x02, 0x5c, 0x65, 0x45, 0x7e, 0x58, 0x57, 0x80, 0x44, 0x63, 0x54, 0x64, 0x61,
-    0x55, 0x85, 0x57, 0x01, 0x39, 0x46, 0x22, 0x21, 0x38, 0x45, 0x24, 0x07, 0x42, 0x69, 0x4a, 0x27,
-    0x2f, 0x4d, 0x2e, 0x05, 0xb0, 0x3c, 0x5d, 0x35, 0x35, 0x5d, 0x3c, 0x37, 0x51, 0x52, 0x36, 0x6b,
-    0x03, 0x11, 0x20, 0x1b, 0x15, 0x1e, 0x12, 0x08, 0x3f, 0x14, 0x25, 0x34, 0x21, 0x2b, 0x36, 0x1b,
-    0x05, 0x00, 0xff, 0xff, 0x00, 0x58, 0x02, 0x8d, 0x02, 0x8b, 0x05, 0xb8, 0x06, 0x07, 0x01, 0xe1,
-    0x00, 0x00, 0x02, 0x98, 0xff, 0xff, 0x00, 0x3c, 0x02, 0x98, 0x02, 0xb7, 0x05, 0xad, 0x06, 0x07,
-    0x02, 0x3a, 0x00, 0x00, 0x02, 0x98, 0xff, 0xff, 0x00, 0x6d, 0x02, 0x8d, 0x02, 0x99, 0x05, 0xad,
-    0x06, 0x07, 0x02, 0x3b, 0x00, 0x00, 0x02, 0x98, 0xff, 0xff, 0x00, 0x61, 0x02, 0x8d, 0x02, 0x98,
-    0x05, 0xb6, 0x06, 0x07, 0x02, 0x3c, 0x00, 0x00, 0x02, 0x98, 0xff, 0xff, 0x00, 0x3f, 0x02, 0x98,
-    0x02, 0x94, 0x05, 0xad, 0x06, 0x07, 0x02, 0x3d, 0x00, 0x00, 0x02, 0x98, 0xff, 0xff, 0x00, 0x50,
-    0x02, 0x8d, 0x02, 0x93, 0x05, 0xb8, 0x06, 0x07, 0x02, 0x3e, 0x00, 0x00, 0x02, 0x98, 0xff, 0xff,
-    0x00, 0x4c, 0x02, 0x91, 0x02, 0x81, 0x05, 0xb8, 0x06, 0x07, 0x02, 0x3f, 0x00, 0x00, 0x02, 0x98,
-    0x00, 0x01, 0x00, 0x80, 0xff, 0xeb, 0x04, 0xf9, 0x05, 0xc5, 0x00, 0x29, 0x00, 0x15, 0x40, 0x0a,
-    0x1a, 0x16, 0x11, 0x03, 0x72, 0x26, 0x00, 0x05, 0x09, 0x72, 0x00, 0x2b, 0xcc, 0x33, 0x2b, 0xcc,
-    0x33, 0x30, 0x31, 0x41, 0x33, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x03, 0x35, 0x35, 0x34, 0x12, 0x36,
-    0x36, 0x33, 0x32, 0x16, 0x16, 0x17, 0x23, 0x2e, 0x02, 0x23, 0x22, 0x0e, 0x02, 0x15, 0x15, 0x14,
-    0x1e, 0x03, 0x33, 0x32, 0x36, 0x36, 0x04, 0x7d, 0x7c, 0x11, 0x87, 0xe3, 0x9e, 0x6b, 0xba, 0x96,
-    0x6b, 0x3a, 0x57, 0xa0, 0xde, 0x86, 0x9c, 0xe6, 0x8b, 0x11, 0x7c, 0x11, 0x66, 0xad, 0x7e, 0x6d,
-    0xb0, 0x7f, 0x43, 0x2d, 0x55, 0x78, 0x94, 0x56, 0x7e, 0xaa, 0x63, 0x01, 0xc7, 0x91, 0xd5, 0x76,
-    0x45, 0x80, 0xb2, 0xdb, 0x7d, 0x3c, 0x9d, 0x01, 0x06, 0xc2, 0x6a, 0x74, 0xd6, 0x92, 0x72, 0xa6,
-    0x5a, 0x5b, 0xa5, 0xdf, 0x84, 0x3e, 0x6a, 0xbb, 0x98, 0x6d, 0x3b, 0x56, 0xa5, 0x00, 0x00, 0x01,
-    0x00, 0x80, 0xff, 0xeb, 0x05, 0x00, 0x05, 0xc5, 0x00, 0x2d, 0x00, 0x1b, 0x40, 0x0d, 0x2d, 0x2c,
-    0x2c, 0x05, 0x1a, 0x16, 0x11, 0x03, 0x72, 0x26, 0x05, 0x09, 0x72, 0x00, 0x2b, 0x32, 0x2b, 0xcc,
-    0x33, 0x12, 0x39, 0x2f, 0x33, 0x30, 0x31, 0x41, 0x11, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x03, 0x35,
-    0x35, 0x34, 0x12, 0x36, 0x36, 0x33, 0x32, 0x16, 0x16, 0x17, 0x23, 0x2e, 0x02, 0x23, 0x22, 0x0e,
-    0x02, 0x15, 0x15, 0x14, 0x1e, 0x03, 0x33, 0x32, 0x36, 0x36, 0x37, 0x11, 0x21, 0x35, 0x05, 0x00,
-    0x18, 0x7e, 0xce, 0x93, 0x70, 0xc6, 0xa1, 0x73, 0x3f, 0x59, 0xa1, 0xdd, 0x83, 0xab, 0xe8, 0x81,
-    0x11, 0x7c, 0x0f, 0x5d, 0xb0, 0x8d, 0x6b, 0xb0, 0x7e, 0x45, 0x31, 0x5d, 0x81, 0xa1, 0x5d, 0x6a,
-    0x9b, 0x63, 0x14, 0xfe, 0x79, 0x02, 0xb4, 0xfd, 0xfa, 0x24, 0x5c, 0x43, 0x46, 0x81, 0xb6, 0xe2,
-    0x83, 0x21, 0xa1, 0x01, 0x0b, 0xc2, 0x69, 0x71, 0xc3, 0x7b, 0x57, 0x94, 0x5a, 0x5c, 0xa7, 0xe2,
-    0x86, 0x23, 0x6f, 0xc1, 0x9c, 0x70, 0x3c, 0x2a, 0x3c, 0x19, 0x01, 0x77, 0x69, 0x00, 0x00, 0x02,
-    0x00, 0xbd, 0x00, 0x00, 0x04, 0xf7, 0x05, 0xb0, 0x00, 0x1b, 0x00, 0x1f, 0x00, 0x12, 0xb7, 0x1c,
-    0x0f, 0x10, 0x02, 0x72, 0x02, 0x1d, 0x00, 0x00, 0x2f, 0x32, 0x32, 0x2b, 0x32, 0x32, 0x30, 0x31,
-    0x61, 0x21, 0x37, 0x21, 0x32, 0x3e, 0x02, 0x35, 0x35, 0x34, 0x2e, 0x02, 0x23, 0x21, 0x35, 0x21,
-    0x32, 0x16, 0x16, 0x12, 0x15, 0x15, 0x14, 0x02, 0x06, 0x06, 0x01, 0x11, 0x23, 0x11, 0x02, 0x4d,
-    0xfe, 0xb5, 0x02, 0x01, 0x49, 0x7c, 0xcd, 0x95, 0x50, 0x51, 0x93, 0xc9, 0x79, 0xfe, 0xa7, 0x01,
-    0x5a, 0x8f, 0xf5, 0xb7, 0x66, 0x66, 0xb8, 0xf9, 0xfe, 0x59, 0x7c, 0x6a, 0x56, 0x9f, 0xdb, 0x85,
-    0x35, 0x87, 0xdb, 0x9c, 0x54, 0x6a, 0x64, 0xb9, 0xfe, 0xfd, 0x9f, 0x32, 0x9f, 0xfe, 0xfd, 0xb9,
-    0x64, 0x05, 0xb0, 0xfa, 0x50, 0x05, 0xb0, 0x00, 0x00, 0x02, 0x00, 0x80, 0xff, 0xeb, 0x05, 0x34,
-    0x05, 0xc5, 0x00, 0x19, 0x00, 0x31, 0x00, 0x10, 0xb7, 0x21, 0x14, 0x03, 0x72, 0x2d, 0x07, 0x09,
-    0x72, 0x00, 0x2b, 0x32, 0x2b, 0x32, 0x30, 0x31, 0x41, 0x15, 0x14, 0x0e, 0x03, 0x23, 0x22, 0x2e,
-    0x03, 0x35, 0x35, 0x34, 0x3e, 0x03, 0x33, 0x32, 0x1e, 0x03, 0x07, 0x35, 0x34, 0x2e, 0x03, 0x23,
-    0x22, 0x0e, 0x02, 0x15, 0x15, 0x14, 0x1e, 0x03, 0x33, 0x32, 0x3e, 0x02, 0x05, 0x34, 0x3a, 0x6b,
-    0x95, 0xb7, 0x68, 0x66, 0xb5, 0x97, 0x6d, 0x3c, 0x3c, 0x6c, 0x96, 0xb5, 0x66, 0x68, 0xb7, 0x96,
-    0x6b, 0x3b, 0x7a, 0x2e, 0x55, 0x76, 0x93, 0x55, 0x67, 0xaf, 0x81, 0x47, 0x2f, 0x56, 0x77, 0x91,
-    0x53, 0x6b, 0xaf, 0x7f, 0x46, 0x02, 0xf2, 0x33, 0x7f, 0xdd, 0xb2, 0x81, 0x45, 0x45, 0x81, 0xb2,
-    0xdd, 0x7f, 0x33, 0x7e, 0xdd, 0xb3, 0x80, 0x45, 0x45, 0x80, 0xb3, 0xdd, 0xb1, 0x35, 0x6a, 0xbb,
-    0x98, 0x6d, 0x3a, 0x5b, 0xa4, 0xe0, 0x85, 0x35, 0x6b, 0xbc, 0x98, 0x6e, 0x3a, 0x5b, 0xa5, 0xe1,
-    0x00, 0x03, 0x00, 0x80, 0xff, 0x09, 0x05, 0x34, 0x05, 0xc5, 0x00, 0x03, 0x00, 0x1d, 0x00, 0x35,
-    0x00, 0x1b, 0x40, 0x0d, 0x25, 0x18, 0x03, 0x72, 0x00, 0x03, 0x03, 0x31, 0x0b, 0x09, 0x72, 0x01,
-    0x02, 0x00, 0x2f, 0x33, 0x2b, 0x32, 0x32, 0x11, 0x33, 0x2b, 0x32, 0x30, 0x31, 0x65, 0x01, 0x07,
-    0x01, 0x01, 0x15, 0x14, 0x0e, 0x03, 0x23, 0x22, 0x2e, 0x03, 0x35, 0x35, 0x34, 0x3e, 0x03, 0x33,
-    0x32, 0x1e, 0x03, 0x07, 0x35, 0x34, 0x2e, 0x03, 0x23, 0x22, 0x0e, 0x02, 0x15, 0x15, 0x14, 0x1e,
-    0x03, 0x33, 0x32, 0x3e, 0x02, 0x03, 0xac, 0x01, 0x5e, 0x55, 0xfe, 0xa5, 0x01, 0xda, 0x3a, 0x6b,
-    0x95, 0xb7, 0x68, 0x66, 0xb5, 0x97, 0x6d, 0x3c, 0x3c, 0x6c, 0x96, 0xb5, 0x66, 0x68, 0xb7, 0x96,
-    0x6b, 0x3b, 0x7a, 0x2e, 0x55, 0x76, 0x93, 0x55, 0x67, 0xaf, 0x81, 0x47, 0x2f, 0x56, 0x77, 0x91,
-    0x53, 0x6b, 0xaf, 0x7f, 0x46, 0x75, 0xfe, 0xe1, 0x4d, 0x01, 0x1b, 0x02, 0xc8, 0x2d, 0x7f, 0xdd,
-    0xb2, 0x81, 0x45, 0x45, 0x81, 0xb2, 0xdd, 0x7f, 0x2d, 0x7e, 0xde, 0xb5, 0x82, 0x46, 0x46, 0x82,
-    0xb5, 0xde, 0xab, 0x2f, 0x6b, 0xbc, 0x99, 0x6f, 0x3b, 0x5c, 0xa7, 0xe2, 0x85, 0x2f, 0x6c, 0xbb,
-    0x99, 0x6d, 0x3a, 0x5b, 0xa4, 0xe1, 0x00, 0x01, 0x00, 0xa0, 0x00, 0x00, 0x02, 0x88, 0x04, 0x8d,
-    0x00, 0x06, 0x00, 0x15, 0x40, 0x09, 0x03, 0x04, 0x04, 0x05, 0x05, 0x06, 0x7d, 0x02, 0x0a, 0x00,
-    0x3f, 0x3f, 0x33, 0x2f, 0x33, 0x11, 0x33, 0x30, 0x31, 0x41, 0x11, 0x23, 0x11, 0x05, 0x35, 0x25,
-    0x02, 0x88, 0x78, 0xfe, 0x90, 0x01, 0xc9, 0x04, 0x8d, 0xfb, 0x73, 0x03, 0xf7, 0xa2, 0x6e, 0xca,
-    0x00, 0x01, 0x00, 0x83, 0x00, 0x00, 0x04, 0x20, 0x04, 0xa0, 0x00, 0x20, 0x00, 0x17, 0x40, 0x0a,
-    0x10, 0x10, 0x0c, 0x15, 0x7e, 0x03, 0x20, 0x20, 0x02, 0x12, 0x00, 0x3f, 0x33, 0x11, 0x33, 0x3f,
-    0x33, 0x33, 0x2f, 0x30, 0x31, 0x65, 0x15, 0x21, 0x35, 0x01, 0x3e, 0x02, 0x35, 0x34, 0x26, 0x26,
-    0x23, 0x22, 0x06, 0x06, 0x15, 0x23, 0x34, 0x36, 0x36, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x14, 0x0e,
-    0x02, 0x07, 0x01, 0x04, 0x20, 0xfc, 0x8c, 0x02, 0x17, 0x4a, 0x44, 0x13, 0x39, 0x7b, 0x65, 0x60,
-    0x98, 0x58, 0x78, 0x76, 0xce, 0x84, 0x65, 0x96, 0x64, 0x32, 0x1a, 0x34, 0x4a, 0x31, 0xfe, 0x4c,
-    0x67, 0x67, 0x53, 0x01, 0xd7, 0x42, 0x64, 0x52, 0x26, 0x42, 0x6d, 0x42, 0x4b, 0x8a, 0x5f, 0x71,
-    0xba, 0x70, 0x34, 0x5c, 0x7a, 0x46, 0x30, 0x5b, 0x59, 0x57, 0x2c, 0xfe, 0x7e, 0x00, 0x00, 0x01,
-    0x00, 0x0f, 0xfe, 0xa3, 0x03, 0xde, 0x04, 0x8d, 0x00, 0x1f, 0x00, 0x1a, 0x40, 0x0b, 0x06, 0x00,
-    0x1e, 0x1e, 0x03, 0x16, 0x0f, 0x05, 0x02, 0x03, 0x7d, 0x00, 0x3f, 0x33, 0x33, 0x2f, 0x33, 0x12,
-    0x39, 0x2f, 0x33, 0x33, 0x30, 0x31, 0x41, 0x01, 0x21, 0x35, 0x21, 0x15, 0x01, 0x1e, 0x02, 0x15,
-    0x14, 0x0e, 0x02, 0x23, 0x22, 0x26, 0x27, 0x37, 0x16, 0x16, 0x33, 0x32, 0x36, 0x36, 0x35, 0x34,
-    0x26, 0x26, 0x23, 0x23, 0x01, 0x78, 0x01, 0xaf, 0xfd, 0x31, 0x03, 0x61, 0xfe, 0x5d, 0x8a, 0xcd,
-    0x71, 0x54, 0x98, 0xcd, 0x7a, 0x6a, 0xc8, 0x6a, 0x23, 0x50, 0xbc, 0x60, 0x95, 0xcb, 0x69, 0x68,
-    0xbe, 0x84, 0x45, 0x02, 0x63, 0x01, 0xc3, 0x67, 0x58, 0xfe, 0x49, 0x08, 0x73, 0xc5, 0x85, 0x80,
-    0xc7, 0x89, 0x46, 0x33, 0x34, 0x5c, 0x28, 0x32, 0x6e, 0xbd, 0x77, 0x81, 0xa4, 0x4e, 0x00, 0x02,
-    0x00, 0x3e, 0xfe, 0xb6, 0x04, 0xa0, 0x04, 0x8d, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x16, 0x40, 0x09,
-    0x06, 0x04, 0x0b, 0x7d, 0x0a, 0x03, 0x07, 0x07, 0x02, 0x00, 0x2f, 0x33, 0x11, 0x33, 0x2f, 0x3f,
-    0x33, 0x33, 0x30, 0x31, 0x65, 0x15, 0x21, 0x35, 0x01, 0x33, 0x07, 0x01, 0x01, 0x11, 0x23, 0x11,
-    0x04, 0xa0, 0xfb, 0x9e, 0x03, 0x14, 0x64, 0x80, 0xfd, 0x9e, 0x03, 0x07, 0x77, 0x66, 0x67, 0x49,
-    0x04, 0x45, 0xde, 0xfc, 0xb7, 0x04, 0x27, 0xfa, 0x29, 0x05, 0xd7, 0x00, 0x00, 0x01, 0x00, 0x65,
-    0xfe, 0xa0, 0x03, 0xfd, 0x04, 0x8c, 0x00, 0x27, 0x00, 0x16, 0x40, 0x09, 0x24, 0x09, 0x09, 0x02,
-    0x1a, 0x13, 0x05, 0x02, 0x7d, 0x00, 0x3f, 0x33, 0x2f, 0x33, 0x12, 0x39, 0x2f, 0x33, 0x30, 0x31,
-    0x53, 0x27, 0x13, 0x21, 0x15, 0x21, 0x03, 0x36, 0x36, 0x33, 0x36, 0x1e, 0x02, 0x15, 0x14, 0x0e,
-    0x02, 0x23, 0x22, 0x26, 0x27, 0x37, 0x16, 0x16, 0x33, 0x32, 0x3e, 0x02, 0x35, 0x34, 0x2e, 0x02,
-    0x23, 0x22, 0x06, 0x06, 0xf3, 0x64, 0x5d, 0x03, 0x03, 0xfd, 0x5d, 0x41, 0x3a, 0xa1, 0x66, 0x64,
-    0x9f, 0x72, 0x3c, 0x45, 0x86, 0xc1, 0x7d, 0x6a, 0xc9, 0x5c, 0x2a, 0x47, 0xb5, 0x69, 0x5c, 0x93,
-    0x6a, 0x39, 0x2c, 0x57, 0x7e, 0x53, 0x6a, 0x76, 0x42, 0x01, 0x8d, 0x11, 0x02, 0xee, 0x70, 0xfe,
-    0x11, 0x37, 0x33, 0x01, 0x43, 0x7f, 0xb2, 0x6d, 0x70, 0xc2, 0x92, 0x53, 0x37, 0x3b, 0x5c, 0x34,
-    0x33, 0x42, 0x74, 0x9d, 0x5b, 0x4c, 0x87, 0x67, 0x3a, 0x2b, 0x47, 0x00, 0x00, 0x01, 0x00, 0x4a,
-    0xfe, 0xb6, 0x03, 0xf2, 0x04, 0x8d, 0x00, 0x06, 0x00, 0x0f, 0xb5, 0x01, 0x05, 0x05, 0x06, 0x7d,
-    0x03, 0x00, 0x2f, 0x3f, 0x33, 0x11, 0x33, 0x30, 0x31, 0x41, 0x15, 0x01, 0x23, 0x01, 0x21, 0x35,
-    0x03, 0xf2, 0xfd, 0x9a, 0x7d, 0x02, 0x64, 0xfc, 0xd7, 0x04, 0x8d, 0x4f, 0xfa, 0x78, 0x05, 0x70,
-    0x67, 0x00, 0x00, 0x02, 0x00, 0x96, 0x04, 0xd1, 0x02, 0xc3, 0x06, 0xae, 0x00, 0x0f, 0x00, 0x27,
-    0x00, 0x29, 0x40, 0x11, 0x11, 0x10, 0x10, 0x19, 0x21, 0x21, 0x15, 0x1d, 0x1c, 0x1c, 0x25, 0x15,
-    0x15, 0x00, 0x09, 0x0d, 0x05, 0x00, 0x2f, 0x33, 0xcd, 0x32, 0x32, 0x7c, 0x2f, 0x33, 0x33, 0x11,
-    0x33, 0x11, 0x33, 0x18, 0x2f, 0x33, 0x33, 0x11, 0x33, 0x30, 0x31, 0x41, 0x33, 0x14, 0x06, 0x06,
-    0x23, 0x22, 0x26, 0x26, 0x35, 0x33, 0x14, 0x16, 0x33, 0x32, 0x36, 0x13, 0x17, 0x14, 0x06, 0x06,
-    0x23, 0x22, 0x26, 0x26, 0x23, 0x22, 0x06, 0x15, 0x27, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x16,
-    0x33, 0x32, 0x36, 0x02, 0x5c, 0x67, 0x43, 0x7d, 0x57, 0x56, 0x7d, 0x43, 0x65, 0x50, 0x61, 0x5f,
-    0x51, 0x21, 0x42, 0x2a, 0x48, 0x2f, 0x35, 0x3f, 0x38, 0x2c, 0x27, 0x37, 0x42, 0x29, 0x49, 0x2e,
-    0x30, 0x41, 0x3d, 0x2a, 0x27, 0x38, 0x05, 0xa6, 0x3e, 0x61, 0x36, 0x36, 0x61, 0x3e, 0x39, 0x55,
-    0x56, 0x01, 0x40, 0x11, 0x2d, 0x4a, 0x2a, 0x29, 0x29, 0x33, 0x2a, 0x0f, 0x2d, 0x49, 0x2a, 0x29,
-    0x2a, 0x37, 0x00, 0x01, 0x00, 0x8f, 0xfe, 0x9d, 0x01, 0x07, 0x00, 0x7d, 0x00, 0x03, 0x00, 0x08,
-    0xb1, 0x01, 0x00, 0x00, 0x2f, 0xcd, 0x30, 0x31, 0x65, 0x11, 0x23, 0x11, 0x01, 0x07, 0x78, 0x7d,
-    0xfe, 0x20, 0x01, 0xe0, 0x00, 0x05, 0x00, 0x69, 0xff, 0xf0, 0x06, 0x72, 0x04, 0x9d, 0x00, 0x29,
-    0x00, 0x2d, 0x00, 0x31, 0x00, 0x35, 0x00, 0x39, 0x00, 0x31, 0x40, 0x18, 0x38, 0x39, 0x39, 0x31,
-    0x7d, 0x16, 0x2d, 0x2d, 0x17, 0x30, 0x0a, 0x35, 0x34, 0x34, 0x26, 0x1b, 0x01, 0x06, 0x06, 0x26,
-    0x7e, 0x11, 0x1b, 0x0b, 0x00, 0x3f, 0x33, 0x3f, 0x33, 0x11, 0x33, 0x11, 0x12, 0x39, 0x2f, 0x33,
-    0x3f, 0x33, 0x33, 0x11, 0x33, 0x3f, 0x33, 0x11, 0x33, 0x30, 0x31, 0x41, 0x07, 0x22, 0x2e, 0x02,
-    0x23, 0x22, 0x0e, 0x02, 0x15, 0x15, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x3e, 0x02, 0x33, 0x17, 0x22,
-    0x06, 0x06, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x35, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x16, 0x16, 0x01,
-    0x15, 0x21, 0x35, 0x13, 0x11, 0x23, 0x11, 0x01, 0x15, 0x21, 0x35, 0x01, 0x15, 0x21, 0x35, 0x03,
-    0xd9, 0x1f, 0x22, 0x60, 0x69, 0x5d, 0x1e, 0x56, 0x8a, 0x61, 0x33, 0x34, 0x61, 0x8a, 0x57, 0x1e,
-    0x5a, 0x66, 0x60, 0x24, 0x24, 0x49, 0x90, 0x7d, 0x30, 0x6f, 0xb5, 0x82, 0x47, 0x46, 0x82, 0xb5,
-    0x6e, 0x31, 0x83, 0x8f, 0x02, 0xdb, 0xfd, 0x41, 0x26, 0x77, 0x02, 0xb8, 0xfd, 0x99, 0x02, 0xbb,
-    0xfd, 0x45, 0x04, 0x8d, 0x68, 0x05, 0x06, 0x04, 0x3c, 0x72, 0xa0, 0x65, 0x73, 0x65, 0xa2, 0x72,
-    0x3d, 0x04, 0x06, 0x04, 0x66, 0x08, 0x08, 0x4c, 0x8e, 0xc7, 0x7d, 0x71, 0x7c, 0xc8, 0x8f, 0x4b,
-    0x08, 0x08, 0xfb, 0xda, 0x67, 0x67, 0x04, 0x26, 0xfb, 0x73, 0x04, 0x8d, 0xfe, 0x03, 0x67, 0x67,
-    0x01, 0xfd, 0x68, 0x68, 0x00, 0x01, 0x00, 0x71, 0xfe, 0xa6, 0x04, 0x11, 0x04, 0xa2, 0x00, 0x3b,
-    0x00, 0x14, 0xb7, 0x00, 0x15, 0x1f, 0x1f, 0x35, 0x0b, 0x29, 0x35, 0x00, 0x2f, 0x2f, 0x33, 0x12,
-    0x39, 0x2f, 0x33, 0x32, 0x30, 0x31, 0x45, 0x32, 0x3e, 0x02, 0x35, 0x11, 0x34, 0x2e, 0x02, 0x23,
-    0x22, 0x0e, 0x02, 0x15, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x3e, 0x02, 0x35, 0x37, 0x14, 0x06, 0x06,
-    0x23, 0x22, 0x2e, 0x02, 0x35, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x11, 0x14, 0x0e,
-    0x03, 0x23, 0x22, 0x26, 0x27, 0x37, 0x16, 0x16, 0x01, 0xd7, 0x64, 0xa4, 0x78, 0x42, 0x30, 0x5c,
-    0x84, 0x54, 0x49, 0x78, 0x57, 0x30, 0x2c, 0x55, 0x79, 0x4d, 0x60, 0x8c, 0x5b, 0x2d, 0x45, 0x77,
-    0xc9, 0x7d, 0x66, 0xa5, 0x76, 0x3e, 0x43, 0x7a, 0xa3, 0x60, 0x6e, 0xb1, 0x7e, 0x43, 0x37, 0x64,
-    0x8b, 0xaa, 0x61, 0x43, 0x8f, 0x42, 0x1c, 0x38, 0x70, 0xf3, 0x50, 0x99, 0xdd, 0x8d, 0x01, 0x12,
-    0x72, 0xab, 0x73, 0x39, 0x3e, 0x70, 0x97, 0x5a, 0x4d, 0x8e, 0x6e, 0x41, 0x41, 0x68, 0x73, 0x33,
-    0x02, 0x87, 0xc5, 0x6b, 0x4c, 0x87, 0xb4, 0x69, 0x73, 0xbe, 0x8a, 0x4b, 0x47, 0x8d, 0xd6, 0x90,
-    0xfe, 0xfa, 0x86, 0xdc, 0xaa, 0x74, 0x3c, 0x1f, 0x20, 0x60, 0x19, 0x1f, 0x00, 0x01, 0xff, 0x8d,
-    0xfe, 0x4b, 0x01, 0x2c, 0x00, 0x88, 0x00, 0x11, 0x00, 0x0a, 0xb2, 0x0d, 0x06, 0x00, 0x00, 0x2f,
-    0xcc, 0x32, 0x30, 0x31, 0x77, 0x33, 0x15, 0x14, 0x06, 0x06, 0x23, 0x22, 0x26, 0x27, 0x37, 0x16,
-    0x16, 0x33, 0x32, 0x36, 0x36, 0x35, 0xb4, 0x78, 0x48, 0x88, 0x5f, 0x1f, 0x34, 0x1d, 0x0d, 0x10,
-    0x3e, 0x15, 0x3a, 0x52, 0x2b, 0x88, 0xe1, 0x70, 0x9c, 0x50, 0x09, 0x0a, 0x68, 0x06, 0x09, 0x37,
-    0x6c, 0x4d, 0xff, 0xff, 0x00, 0x3c, 0xfe, 0xa3, 0x04, 0x0b, 0x04, 0x8d, 0x04, 0x06, 0x02, 0x66,
-    0x2d, 0x00, 0xff, 0xff, 0x00, 0x6e, 0xfe, 0xa0, 0x04, 0x06, 0x04, 0x8c, 0x04, 0x06, 0x02, 0x68,
-    0x09, 0x00, 0xff, 0xff, 0x00, 0x1b, 0xfe, 0xb6, 0x04, 0x7d, 0x04, 0x8d, 0x04, 0x06, 0x02, 0x67,
-    0xdd, 0x00, 0xff, 0xff, 0x00, 0x72, 0x00, 0x00, 0x04, 0x0f, 0x04, 0xa0, 0x04, 0x06, 0x02, 0x65,
-    0xef, 0x00, 0xff, 0xff, 0x00, 0x6c, 0xfe, 0xb6, 0x04, 0x14, 0x04, 0x8d, 0x04, 0x06, 0x02, 0x69,
-    0x22, 0x00, 0xff, 0xff, 0x00, 0x38, 0xff, 0xeb, 0x04, 0x37, 0x04, 0xa1, 0x04, 0x06, 0x02, 0x7f,
-    0xbb, 0x00, 0xff, 0xff, 0x00, 0x7c, 0xff, 0xec, 0x04, 0x02, 0x05, 0xbb, 0x04, 0x06, 0x00, 0x1a,
-    0xf9, 0x00, 0xff, 0xff, 0x00, 0x63, 0xfe, 0xa6, 0x04, 0x03, 0x04, 0xa2, 0x04, 0x06, 0x02, 0x6d,
-    0xf2, 0x00, 0xff, 0xff, 0x00, 0x69, 0xff, 0xec, 0x04, 0x08, 0x05, 0xc4, 0x06, 0x06, 0x00, 0x1c,
-    0xfe, 0x00, 0xff, 0xff, 0x01, 0x10, 0x00, 0x00, 0x02, 0xf7, 0x04, 0x8d, 0x04, 0x06, 0x02, 0x64,
-    0x70, 0x00, 0xff, 0xff, 0xff, 0x8c, 0xfe, 0x4b, 0x01, 0x2b, 0x04, 0x3a, 0x04, 0x06, 0x00, 0x9c,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0x8c, 0xfe, 0x4b, 0x01, 0x2b, 0x04, 0x3a, 0x06, 0x06, 0x00, 0x9c,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0xa9, 0x00, 0x00, 0x01, 0x20, 0x04, 0x3a, 0x06, 0x06, 0x00, 0x8d,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xfa, 0xfe, 0x6c, 0x01, 0x33, 0x04, 0x3a, 0x06, 0x26, 0x00, 0x8d,
-    0x00, 0x00, 0x01, 0x06, 0x00, 0xa4, 0xbe, 0x0a, 0x00, 0x0b, 0xb6, 0x01, 0x04, 0x02, 0x00, 0x00,
-    0x43, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0xa9, 0x00, 0x00, 0x01, 0x20, 0x04, 0x3a,
-    0x06, 0x06, 0x00, 0x8d, 0x00, 0x00, 0x00, 0x03, 0x00, 0x9b, 0xff, 0xec, 0x03, 0xec, 0x04, 0x9d,
-    0x00, 0x03, 0x00, 0x16, 0x00, 0x31, 0x00, 0x29, 0x40, 0x14, 0x0f, 0x26, 0x26, 0x0d, 0x23, 0x23,
-    0x09, 0x1b, 0x2f, 0x0b, 0x72, 0x04, 0x00, 0x00, 0x02, 0x13, 0x09, 0x7e, 0x02, 0x0a, 0x00, 0x3f,
-    0x3f, 0x33, 0x12, 0x39, 0x2f, 0x33, 0x2b, 0x32, 0x11, 0x39, 0x2f, 0x33, 0x33, 0x11, 0x33, 0x30,
-    0x31, 0x41, 0x11, 0x23, 0x11, 0x17, 0x23, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x17, 0x01, 0x23,
-    0x35, 0x01, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x13, 0x37, 0x16, 0x16, 0x33, 0x32, 0x36, 0x36,
-    0x35, 0x34, 0x26, 0x26, 0x23, 0x23, 0x35, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x14, 0x06, 0x06, 0x23,
-    0x22, 0x26, 0x01, 0x11, 0x76, 0x76, 0x76, 0x4c, 0xa7, 0x88, 0x7c, 0xb5, 0x4b, 0xfe, 0x90, 0x3a,
-    0x01, 0x17, 0x25, 0x76, 0x4e, 0x5e, 0x73, 0x34, 0x6a, 0x27, 0x22, 0x60, 0x3b, 0x55, 0x7c, 0x44,
-    0x43, 0x8e, 0x71, 0x4a, 0x5a, 0x68, 0x9e, 0x6d, 0x37, 0x62, 0xb2, 0x79, 0x3b, 0x74, 0x02, 0xf1,
-    0xfd, 0x0f, 0x02, 0xf1, 0x02, 0x88, 0xc0, 0x66, 0x66, 0x55, 0xfe, 0x68, 0x4f, 0x01, 0x39, 0x2b,
-    0x3c, 0x4e, 0x93, 0xfc, 0xca, 0x65, 0x13, 0x21, 0x3d, 0x75, 0x55, 0x47, 0x64, 0x35, 0x5f, 0x2b,
-    0x53, 0x76, 0x4a, 0x75, 0xa4, 0x56, 0x1a, 0x00, 0x00, 0x02, 0x00, 0x7d, 0xff, 0xeb, 0x04, 0x7c,
-    0x04, 0xa1, 0x00, 0x15, 0x00, 0x2b, 0x00, 0x0e, 0xb5, 0x1c, 0x11, 0x7e, 0x27, 0x06, 0x0b, 0x00,
-    0x3f, 0x33, 0x3f, 0x33, 0x30, 0x31, 0x41, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x35,
-    0x35, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x1e, 0x02, 0x07, 0x35, 0x34, 0x2e, 0x02, 0x23, 0x22, 0x0e,
-    0x02, 0x15, 0x15, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x3e, 0x02, 0x04, 0x7c, 0x4d, 0x8b, 0xba, 0x6c,
-    0x6a, 0xbb, 0x8c, 0x50, 0x4f, 0x8c, 0xba, 0x6a, 0x6c, 0xba, 0x8c, 0x4e, 0x77, 0x3b, 0x6b, 0x8f,
-    0x54, 0x52, 0x8f, 0x6a, 0x3c, 0x3c, 0x6c, 0x8f, 0x52, 0x55, 0x8e, 0x6a, 0x3a, 0x02, 0x59, 0x26,
-    0x8f, 0xdb, 0x93, 0x4b, 0x4b, 0x93, 0xdb, 0x8f, 0x26, 0x90, 0xda, 0x93, 0x4b, 0x4b, 0x93, 0xda,
-    0xc2, 0x40, 0x72, 0xaf, 0x76, 0x3c, 0x3c, 0x76, 0xaf, 0x72, 0x40, 0x72, 0xaf, 0x77, 0x3d, 0x3d,
-    0x77, 0xaf, 0x00, 0x01, 0x00, 0x39, 0x00, 0x01, 0x03, 0xb8, 0x05, 0xb0, 0x00, 0x06, 0x00, 0x13,
-    0x40, 0x09, 0x01, 0x05, 0x05, 0x06, 0x04, 0x72, 0x03, 0x0c, 0x72, 0x00, 0x2b, 0x2b, 0x32, 0x11,
-    0x33, 0x30, 0x31, 0x41, 0x15, 0x01, 0x23, 0x01, 0x21, 0x35, 0x03, 0xb8, 0xfd, 0xa7, 0x79, 0x02,
-    0x54, 0xfc, 0xff, 0x05, 0xb0, 0x45, 0xfa, 0x96, 0x05, 0x48, 0x67, 0x00, 0x00, 0x03, 0x00, 0x9b,
-    0xff, 0xec, 0x04, 0x18, 0x06, 0x00, 0x00, 0x04, 0x00, 0x1a, 0x00, 0x2f, 0x00, 0x19, 0x40, 0x0e,
-    0x21, 0x16, 0x07, 0x72, 0x2b, 0x0b, 0x0b, 0x72, 0x04, 0x0a, 0x72, 0x00, 0x00, 0x72, 0x00, 0x2b,
-    0x2b, 0x2b, 0x32, 0x2b, 0x32, 0x30, 0x31, 0x53, 0x33, 0x11, 0x07, 0x23, 0x01, 0x15, 0x14, 0x0e,
-    0x02, 0x23, 0x22, 0x2e, 0x02, 0x27, 0x11, 0x3e, 0x03, 0x33, 0x32, 0x1e, 0x02, 0x07, 0x35, 0x34,
-    0x2e, 0x02, 0x23, 0x22, 0x0e, 0x02, 0x07, 0x11, 0x1e, 0x02, 0x33, 0x32, 0x3e, 0x02, 0x9b, 0x78,
-    0x11, 0x67, 0x03, 0x7d, 0x3d, 0x72, 0xa0, 0x62, 0x61, 0x96, 0x6a, 0x41, 0x0c, 0x0f, 0x42, 0x69,
-    0x93, 0x5f, 0x63, 0xa1, 0x72, 0x3d, 0x79, 0x2b, 0x56, 0x7d, 0x53, 0x56, 0x78, 0x4f, 0x2e, 0x0b,
-    0x11, 0x54, 0x8d, 0x66, 0x52, 0x7d, 0x55, 0x2b, 0x06, 0x00, 0xfa, 0xd2, 0xd2, 0x02, 0x28, 0x15,
-    0x79, 0xca, 0x94, 0x50, 0x3e, 0x70, 0x9a, 0x5b, 0x01, 0x0b, 0x62, 0xa0, 0x74, 0x3e, 0x4d, 0x91,
-    0xca, 0x93, 0x15, 0x60, 0xa2, 0x78, 0x43, 0x39, 0x5d, 0x6e, 0x35, 0xfe, 0xca, 0x4c, 0x84, 0x51,
-    0x44, 0x79, 0xa2, 0x00, 0x00, 0x01, 0x00, 0x61, 0xff, 0xec, 0x03, 0xd9, 0x04, 0x4e, 0x00, 0x27,
-    0x00, 0x19, 0x40, 0x0c, 0x1d, 0x19, 0x19, 0x14, 0x07, 0x72, 0x04, 0x04, 0x00, 0x09, 0x0b, 0x72,
-    0x00, 0x2b, 0x32, 0x32, 0x2f, 0x2b, 0x32, 0x2f, 0x32, 0x30, 0x31, 0x65, 0x32, 0x36, 0x36, 0x37,
-    0x33, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x35, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x16, 0x16,
-    0x17, 0x23, 0x2e, 0x02, 0x23, 0x22, 0x0e, 0x02, 0x15, 0x15, 0x14, 0x1e, 0x02, 0x02, 0x39, 0x4c,
-    0x85, 0x57, 0x06, 0x72, 0x05, 0x73, 0xb9, 0x6f, 0x71, 0xb1, 0x78, 0x3e, 0x3e, 0x79, 0xaf, 0x71,
-    0x74, 0xb9, 0x6f, 0x05, 0x72, 0x05, 0x52, 0x86, 0x52, 0x5c, 0x85, 0x56, 0x29, 0x29, 0x55, 0x86,
-    0x52, 0x3a, 0x71, 0x52, 0x67, 0xa0, 0x5c, 0x52, 0x94, 0xc4, 0x72, 0x2a, 0x72, 0xc5, 0x93, 0x52,
-    0x5e, 0xac, 0x76, 0x57, 0x7e, 0x44, 0x47, 0x7b, 0x9d, 0x56, 0x2a, 0x56, 0x9e, 0x7b, 0x47, 0x00,
-    0x00, 0x03, 0x00, 0x60, 0xff, 0xec, 0x03, 0xdb, 0x06, 0x00, 0x00, 0x04, 0x00, 0x1a, 0x00, 0x2f,
-    0x00, 0x19, 0x40, 0x0d, 0x21, 0x04, 0x04, 0x16, 0x0b, 0x72, 0x2b, 0x0b, 0x07, 0x72, 0x01, 0x00,
-    0x72, 0x00, 0x2b, 0x2b, 0x32, 0x2b, 0x32, 0x2f, 0x32, 0x30, 0x31, 0x65, 0x11, 0x33, 0x11, 0x23,
-    0x01, 0x35, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x1e, 0x02, 0x17, 0x11, 0x0e, 0x03, 0x23, 0x22, 0x2e,
-    0x02, 0x37, 0x15, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x36, 0x36, 0x37, 0x11, 0x2e, 0x03, 0x23, 0x22,
-    0x0e, 0x02, 0x03, 0x63, 0x78, 0x6a, 0xfc, 0xef, 0x40, 0x75, 0xa0, 0x61, 0x5f, 0x92, 0x69, 0x41,
-    0x0f, 0x0c, 0x40, 0x6a, 0x95, 0x61, 0x60, 0xa0, 0x74, 0x40, 0x79, 0x2c, 0x56, 0x7e, 0x51, 0x67,
-    0x8c, 0x54, 0x13, 0x0c, 0x2e, 0x4f, 0x79, 0x56, 0x52, 0x7f, 0x56, 0x2c, 0xd2, 0x05, 0x2e, 0xfa,
-    0x00, 0x02, 0x12, 0x15, 0x7e, 0xcb, 0x91, 0x4d, 0x3e, 0x74, 0xa0, 0x62, 0xfe, 0xf5, 0x5b, 0x9a,
-    0x70, 0x3e, 0x50, 0x93, 0xca, 0x8e, 0x15, 0x5e, 0xa2, 0x79, 0x44, 0x4f, 0x84, 0x4e, 0x01, 0x36,
-    0x35, 0x6e, 0x5d, 0x39, 0x43, 0x78, 0xa3, 0x00, 0x00, 0x03, 0x00, 0x60, 0xfe, 0x51, 0x03, 0xdb,
-    0x04, 0x4e, 0x00, 0x13, 0x00, 0x29, 0x00, 0x3e, 0x00, 0x1b, 0x40, 0x0f, 0x30, 0x25, 0x0b, 0x72,
-    0x3a, 0x1a, 0x07, 0x72, 0x0e, 0x06, 0x0f, 0x72, 0x00, 0x06, 0x72, 0x00, 0x2b, 0x2b, 0x32, 0x2b,
-    0x32, 0x2b, 0x32, 0x30, 0x31, 0x41, 0x33, 0x11, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x26, 0x27, 0x37,
-    0x16, 0x16, 0x33, 0x32, 0x36, 0x36, 0x35, 0x11, 0x01, 0x35, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x1e,
-    0x02, 0x17, 0x11, 0x0e, 0x03, 0x23, 0x22, 0x2e, 0x02, 0x37, 0x15, 0x14, 0x1e, 0x02, 0x33, 0x32,
-    0x36, 0x36, 0x37, 0x11, 0x2e, 0x03, 0x23, 0x22, 0x0e, 0x02, 0x03, 0x76, 0x65, 0x3b, 0x71, 0xa3,
-    0x69, 0x4d, 0xba, 0x49, 0x24, 0x43, 0x93, 0x54, 0x6d, 0x8e, 0x47, 0xfc, 0xfd, 0x3f, 0x74, 0xa1,
-    0x61, 0x5f, 0x92, 0x6a, 0x41, 0x0f, 0x0c, 0x40, 0x6a, 0x95, 0x62, 0x60, 0xa0, 0x74, 0x3f, 0x78,
-    0x2c, 0x56, 0x7e, 0x52, 0x67, 0x8a, 0x53, 0x13, 0x0b, 0x2e, 0x4e, 0x78, 0x56, 0x53, 0x7f, 0x56,
-    0x2c, 0x04, 0x3a, 0xfb, 0xf5, 0x71, 0xb1, 0x7b, 0x41, 0x2b, 0x2c, 0x5c, 0x24, 0x29, 0x59, 0xa6,
-    0x74, 0x03, 0x22, 0xfe, 0xc6, 0x15, 0x7e, 0xcb, 0x91, 0x4d, 0x3e, 0x74, 0xa0, 0x62, 0xfe, 0xf5,
-    0x5b, 0x9a, 0x70, 0x3e, 0x50, 0x93, 0xca, 0x8e, 0x15, 0x5e, 0xa2, 0x79, 0x44, 0x4f, 0x84, 0x4e,
-    0x01, 0x36, 0x35, 0x6e, 0x5d, 0x39, 0x43, 0x78, 0xa3, 0x00, 0x00, 0x02, 0x00, 0x5a, 0xff, 0xec,
-    0x04, 0x29, 0x04, 0x4e, 0x00, 0x15, 0x00, 0x2b, 0x00, 0x10, 0xb7, 0x1c, 0x11, 0x0b, 0x72, 0x27,
-    0x06, 0x07, 0x72, 0x00, 0x2b, 0x32, 0x2b, 0x32, 0x30, 0x31, 0x53, 0x35, 0x34, 0x3e, 0x02, 0x33,
-    0x32, 0x1e, 0x02, 0x15, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x37, 0x15, 0x14, 0x1e,
-    0x02, 0x33, 0x32, 0x3e, 0x02, 0x35, 0x35, 0x34, 0x2e, 0x02, 0x23, 0x22, 0x0e, 0x02, 0x5a, 0x47,
-    0x83, 0xb2, 0x6b, 0x6c, 0xb3, 0x82, 0x47, 0x47, 0x82, 0xb2, 0x6b, 0x6c, 0xb3, 0x82, 0x48, 0x78,
-    0x33, 0x5f, 0x89, 0x56, 0x55, 0x87, 0x60, 0x32, 0x33, 0x5f, 0x88, 0x56, 0x55, 0x88, 0x5f, 0x33,
-    0x02, 0x0d, 0x20, 0x76, 0xc8, 0x92, 0x51, 0x51, 0x92, 0xc8, 0x76, 0x20, 0x76, 0xc7, 0x93, 0x51,
-    0x51, 0x93, 0xc7, 0x96, 0x20, 0x59, 0xa0, 0x7b, 0x47, 0x47, 0x7b, 0xa0, 0x59, 0x20, 0x58, 0x9e,
-    0x7c, 0x48, 0x48, 0x7c, 0x9e, 0x00, 0x00, 0x03, 0x00, 0x9b, 0xfe, 0x60, 0x04, 0x17, 0x04, 0x4e,
-    0x00, 0x04, 0x00, 0x1a, 0x00, 0x2f, 0x00, 0x19, 0x40, 0x0e, 0x21, 0x16, 0x07, 0x72, 0x2b, 0x0b,
-    0x0b, 0x72, 0x03, 0x06, 0x72, 0x02, 0x0e, 0x72, 0x00, 0x2b, 0x2b, 0x2b, 0x32, 0x2b, 0x32, 0x30,
-    0x31, 0x41, 0x11, 0x23, 0x11, 0x33, 0x01, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x27,
-    0x11, 0x3e, 0x03, 0x33, 0x32, 0x1e, 0x02, 0x07, 0x35, 0x34, 0x2e, 0x02, 0x23, 0x22, 0x0e, 0x02,
-    0x07, 0x11, 0x1e, 0x02, 0x33, 0x32, 0x3e, 0x02, 0x01, 0x13, 0x78, 0x65, 0x03, 0x17, 0x3d, 0x72,
-    0x9f, 0x63, 0x61, 0x98, 0x6c, 0x42, 0x0c, 0x0f, 0x44, 0x6a, 0x95, 0x5f, 0x63, 0xa1, 0x72, 0x3d,
-    0x78, 0x2d, 0x57, 0x7f, 0x53, 0x56, 0x79, 0x4f, 0x2e, 0x0b, 0x13, 0x54, 0x8c, 0x66, 0x52, 0x7e,
-    0x57, 0x2d, 0x03, 0x6a, 0xfa, 0xf6, 0x05, 0xda, 0xfd, 0xed, 0x15, 0x79, 0xca, 0x93, 0x50, 0x3c,
-    0x6f, 0x96, 0x59, 0x01, 0x14, 0x62, 0xa0, 0x74, 0x3e, 0x4d, 0x91, 0xcb, 0x93, 0x15, 0x60, 0xa3,
-    0x78, 0x43, 0x39, 0x5d, 0x6e, 0x35, 0xfe, 0xc1, 0x4c, 0x81, 0x4e, 0x45, 0x7a, 0xa3, 0x00, 0x03,
-    0x00, 0x60, 0xfe, 0x60, 0x03, 0xdb, 0x04, 0x4e, 0x00, 0x04, 0x00, 0x1a, 0x00, 0x2f, 0x00, 0x19,
-    0x40, 0x0e, 0x21, 0x16, 0x0b, 0x72, 0x2b, 0x0b, 0x07, 0x72, 0x04, 0x0e, 0x72, 0x03, 0x06, 0x72,
-    0x00, 0x2b, 0x2b, 0x2b, 0x32, 0x2b, 0x32, 0x30, 0x31, 0x41, 0x11, 0x37, 0x33, 0x11, 0x01, 0x35,
-    0x34, 0x3e, 0x02, 0x33, 0x32, 0x1e, 0x02, 0x17, 0x11, 0x0e, 0x03, 0x23, 0x22, 0x2e, 0x02, 0x37,
-    0x15, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x36, 0x36, 0x37, 0x11, 0x2e, 0x03, 0x23, 0x22, 0x0e, 0x02,
-    0x03, 0x63, 0x0f, 0x69, 0xfc, 0x85, 0x3e, 0x74, 0xa2, 0x63, 0x60, 0x93, 0x6b, 0x43, 0x0f, 0x0c,
-    0x41, 0x6c, 0x97, 0x62, 0x62, 0xa1, 0x73, 0x3f, 0x79, 0x2c, 0x57, 0x7e, 0x52, 0x67, 0x8d, 0x55,
-    0x13, 0x0a, 0x30, 0x51, 0x7a, 0x55, 0x53, 0x7f, 0x57, 0x2c, 0xfe, 0x60, 0x05, 0x0a, 0xd0, 0xfa,
-    0x26, 0x03, 0xad, 0x15, 0x7e, 0xcc, 0x93, 0x4f, 0x3e, 0x74, 0xa0, 0x62, 0xfe, 0xf5, 0x5b, 0x9a,
-    0x70, 0x3e, 0x4f, 0x90, 0xc9, 0x8e, 0x15, 0x5f, 0xa1, 0x78, 0x43, 0x51, 0x85, 0x4e, 0x01, 0x36,
-    0x33, 0x6e, 0x5f, 0x3b, 0x45, 0x7c, 0xa4, 0x00, 0x00, 0x01, 0x00, 0x5a, 0xff, 0xec, 0x03, 0xd6,
-    0x04, 0x4e, 0x00, 0x2a, 0x00, 0x19, 0x40, 0x0c, 0x13, 0x12, 0x12, 0x00, 0x19, 0x0b, 0x07, 0x72,
-    0x24, 0x00, 0x0b, 0x72, 0x00, 0x2b, 0x32, 0x2b, 0x32, 0x11, 0x39, 0x2f, 0x33, 0x30, 0x31, 0x45,
-    0x22, 0x2e, 0x02, 0x35, 0x35, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x15, 0x21, 0x35,
-    0x21, 0x35, 0x34, 0x26, 0x26, 0x23, 0x22, 0x0e, 0x02, 0x15, 0x15, 0x14, 0x1e, 0x02, 0x33, 0x32,
-    0x36, 0x37, 0x17, 0x06, 0x06, 0x02, 0x52, 0x6e, 0xb8, 0x88, 0x4a, 0x4b, 0x81, 0xa7, 0x5d, 0x67,
-    0x9f, 0x6e, 0x38, 0xfc, 0xcd, 0x02, 0xbb, 0x45, 0x89, 0x66, 0x4d, 0x7e, 0x5b, 0x32, 0x38, 0x67,
-    0x8e, 0x57, 0x5d, 0x93, 0x3d, 0x2b, 0x32, 0xa8, 0x14, 0x4e, 0x8e, 0xc3, 0x73, 0x36, 0x7c, 0xc6,
-    0x8d, 0x4b, 0x42, 0x7c, 0xac, 0x69, 0x66, 0x67, 0x1d, 0x5b, 0x97, 0x5c, 0x3f, 0x73, 0xa0, 0x61,
-    0x36, 0x59, 0x9b, 0x76, 0x42, 0x3a, 0x35, 0x54, 0x32, 0x4f, 0x00, 0x03, 0x00, 0x6d, 0xfe, 0x51,
-    0x03, 0xd4, 0x04, 0x4e, 0x00, 0x12, 0x00, 0x28, 0x00, 0x3d, 0x00, 0x1b, 0x40, 0x0f, 0x2f, 0x24,
-    0x0b, 0x72, 0x39, 0x19, 0x07, 0x72, 0x0d, 0x06, 0x0f, 0x72, 0x00, 0x06, 0x72, 0x00, 0x2b, 0x2b,
-    0x32, 0x2b, 0x32, 0x2b, 0x32, 0x30, 0x31, 0x41, 0x33, 0x11, 0x14, 0x06, 0x06, 0x23, 0x22, 0x26,
-    0x27, 0x37, 0x16, 0x16, 0x33, 0x32, 0x36, 0x36, 0x35, 0x11, 0x01, 0x35, 0x34, 0x3e, 0x02, 0x33,
-    0x32, 0x1e, 0x02, 0x17, 0x11, 0x0e, 0x03, 0x23, 0x22, 0x2e, 0x02, 0x37, 0x15, 0x14, 0x1e, 0x02,
-    0x33, 0x32, 0x36, 0x36, 0x37, 0x11, 0x2e, 0x03, 0x23, 0x22, 0x0e, 0x02, 0x03, 0x6f, 0x65, 0x68,
-    0xc4, 0x8b, 0x49, 0xb0, 0x45, 0x24, 0x3f, 0x89, 0x50, 0x6d, 0x8e, 0x46, 0xfd, 0x11, 0x39, 0x6c,
-    0x9b, 0x62, 0x5f, 0x92, 0x69, 0x41, 0x0f, 0x0c, 0x40, 0x6a, 0x95, 0x61, 0x61, 0x9a, 0x6c, 0x39,
-    0x78, 0x26, 0x4e, 0x78, 0x52, 0x67, 0x8b, 0x52, 0x13, 0x0b, 0x2d, 0x4f, 0x78, 0x56, 0x53, 0x79,
-    0x4e, 0x26, 0x04, 0x3a, 0xfb, 0xec, 0x93, 0xd2, 0x70, 0x25, 0x25, 0x60, 0x20, 0x24, 0x56, 0xa3,
-    0x71, 0x03, 0x2b, 0xfe, 0xc1, 0x15, 0x7e, 0xcc, 0x93, 0x4f, 0x3e, 0x74, 0xa0, 0x62, 0xfe, 0xf5,
-    0x5b, 0x9a, 0x70, 0x3e, 0x4f, 0x90, 0xc9, 0x8e, 0x15, 0x5f, 0xa0, 0x77, 0x42, 0x4f, 0x84, 0x4e,
-    0x01, 0x36, 0x35, 0x6e, 0x5d, 0x39, 0x45, 0x7a, 0xa4, 0x00, 0x00, 0x02, 0x00, 0x40, 0xfe, 0x55,
-    0x04, 0x48, 0x04, 0x46, 0x00, 0x03, 0x00, 0x25, 0x00, 0x19, 0x40, 0x0c, 0x0e, 0x15, 0x01, 0x01,
-    0x15, 0x1f, 0x04, 0x07, 0x72, 0x03, 0x06, 0x72, 0x00, 0x2b, 0x2b, 0x32, 0x2f, 0x33, 0x2f, 0x11,
-    0x33, 0x30, 0x31, 0x41, 0x01, 0x23, 0x01, 0x25, 0x32, 0x1e, 0x02, 0x17, 0x01, 0x1e, 0x02, 0x33,
-    0x32, 0x36, 0x37, 0x07, 0x06, 0x06, 0x23, 0x22, 0x2e, 0x02, 0x27, 0x01, 0x2e, 0x02, 0x23, 0x22,
-    0x06, 0x07, 0x27, 0x36, 0x36, 0x03, 0xf5, 0xfc, 0xf7, 0x80, 0x03, 0x0c, 0xfd, 0x23, 0x3f, 0x59,
-    0x3d, 0x2a, 0x11, 0x01, 0xad, 0x18, 0x2d, 0x36, 0x24, 0x0e, 0x35, 0x0e, 0x13, 0x0b, 0x2c, 0x0f,
-    0x30, 0x48, 0x38, 0x34, 0x1e, 0xfe, 0x56, 0x17, 0x2f, 0x41, 0x33, 0x0b, 0x2c, 0x0d, 0x05, 0x0f,
-    0x37, 0x04, 0x3a, 0xfa, 0x27, 0x05, 0xd9, 0x0c, 0x34, 0x50, 0x57, 0x24, 0xfc, 0x3a, 0x31, 0x57,
-    0x36, 0x03, 0x03, 0x68, 0x06, 0x06, 0x21, 0x43, 0x62, 0x41, 0x03, 0xc1, 0x35, 0x56, 0x34, 0x04,
-    0x03, 0x65, 0x05, 0x07, 0xff, 0xff, 0x00, 0x71, 0x00, 0x00, 0x02, 0x74, 0x05, 0xb6, 0x04, 0x06,
-    0x00, 0x15, 0xbe, 0x00, 0x00, 0x01, 0x00, 0x79, 0xff, 0xee, 0x04, 0x89, 0x04, 0x9d, 0x00, 0x41,
-    0x00, 0x17, 0x40, 0x0b, 0x38, 0x38, 0x10, 0x22, 0x7e, 0x19, 0x0a, 0x33, 0x00, 0x0b, 0x72, 0x00,
-    0x2b, 0x32, 0x3f, 0x3f, 0x33, 0x39, 0x2f, 0x30, 0x31, 0x45, 0x22, 0x2e, 0x02, 0x35, 0x34, 0x36,
-    0x36, 0x37, 0x25, 0x36, 0x36, 0x35, 0x34, 0x26, 0x23, 0x22, 0x06, 0x15, 0x14, 0x16, 0x16, 0x17,
-    0x01, 0x23, 0x01, 0x2e, 0x02, 0x35, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x16, 0x15, 0x14, 0x06,
-    0x06, 0x07, 0x05, 0x0e, 0x02, 0x15, 0x14, 0x16, 0x16, 0x33, 0x32, 0x3e, 0x02, 0x35, 0x33, 0x14,
-    0x06, 0x07, 0x06, 0x06, 0x07, 0x06, 0x06, 0x01, 0xf3, 0x58, 0x8c, 0x62, 0x34, 0x2f, 0x55, 0x3a,
-    0x01, 0x06, 0x2f, 0x37, 0x57, 0x52, 0x52, 0x55, 0x27, 0x45, 0x2d, 0x02, 0x9d, 0x8e, 0xfd, 0xb8,
-    0x3f, 0x60, 0x37, 0x47, 0x82, 0x57, 0x5a, 0x7f, 0x44, 0x2c, 0x44, 0x24, 0xfe, 0xf0, 0x3b, 0x3a,
-    0x11, 0x3a, 0x77, 0x5a, 0x67, 0xad, 0x80, 0x47, 0x70, 0x4b, 0x43, 0x08, 0x0d, 0x08, 0x4d, 0xd7,
-    0x12, 0x2b, 0x4e, 0x6c, 0x40, 0x43, 0x67, 0x56, 0x2b, 0xbd, 0x22, 0x57, 0x2e, 0x3c, 0x57, 0x5e,
-    0x3c, 0x26, 0x4b, 0x4f, 0x2f, 0xfd, 0x54, 0x02, 0x53, 0x40, 0x68, 0x68, 0x3e, 0x4b, 0x72, 0x3f,
-    0x43, 0x6f, 0x42, 0x31, 0x5b, 0x4b, 0x1a, 0xc7, 0x2b, 0x49, 0x40, 0x1d, 0x37, 0x5c, 0x37, 0x46,
-    0x7f, 0xb0, 0x6b, 0x6e, 0xc5, 0x4f, 0x08, 0x12, 0x08, 0x4c, 0x58, 0x00, 0x00, 0x03, 0x00, 0x05,
-    0x00, 0x00, 0x03, 0x76, 0x04, 0x8d, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x1d, 0x40, 0x0d,
-    0x08, 0x09, 0x09, 0x0b, 0x0a, 0x0a, 0x06, 0x07, 0x7d, 0x03, 0x02, 0x06, 0x0a, 0x00, 0x3f, 0x33,
-    0x33, 0x3f, 0x12, 0x39, 0x2f, 0x33, 0x33, 0x2f, 0x33, 0x30, 0x31, 0x65, 0x15, 0x21, 0x35, 0x13,
-    0x11, 0x23, 0x11, 0x01, 0x15, 0x05, 0x35, 0x03, 0x76, 0xfd, 0x77, 0x25, 0x77, 0x01, 0xb7, 0xfd,
-    0xb3, 0x67, 0x67, 0x67, 0x04, 0x26, 0xfb, 0x73, 0x04, 0x8d, 0xfe, 0x5a, 0x5b, 0xbb, 0x5b, 0x00,
-    0x00, 0x06, 0x00, 0x0f, 0x00, 0x00, 0x05, 0xe0, 0x04, 0x8d, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0b,
-    0x00, 0x10, 0x00, 0x14, 0x00, 0x18, 0x00, 0x33, 0x40, 0x18, 0x0a, 0x0b, 0x0b, 0x18, 0x18, 0x0f,
-    0x07, 0x06, 0x14, 0x13, 0x06, 0x13, 0x06, 0x13, 0x0d, 0x0f, 0x7d, 0x03, 0x02, 0x02, 0x17, 0x17,
-    0x0d, 0x0a, 0x00, 0x3f, 0x33, 0x11, 0x33, 0x11, 0x33, 0x3f, 0x12, 0x39, 0x39, 0x2f, 0x2f, 0x11,
-    0x33, 0x11, 0x33, 0x11, 0x33, 0x11, 0x33, 0x11, 0x33, 0x30, 0x31, 0x65, 0x15, 0x21, 0x35, 0x01,
-    0x15, 0x21, 0x35, 0x01, 0x15, 0x21, 0x35, 0x07, 0x01, 0x23, 0x01, 0x33, 0x13, 0x15, 0x21, 0x35,
-    0x01, 0x13, 0x23, 0x03, 0x05, 0xe0, 0xfd, 0x7f, 0x02, 0x21, 0xfd, 0xd2, 0x02, 0x79, 0xfd, 0x80,
-    0x46, 0xfd, 0x8e, 0x84, 0x02, 0xb0, 0x52, 0x48, 0xfd, 0xcf, 0x02, 0x3f, 0x14, 0x77, 0x14, 0x66,
-    0x66, 0x66, 0x02, 0x2b, 0x66, 0x66, 0x01, 0xfc, 0x66, 0x66, 0x4c, 0xfb, 0xbf, 0x04, 0x8d, 0xfd,
-    0x1d, 0x66, 0x66, 0x02, 0xe3, 0xfb, 0x73, 0x04, 0x8d, 0x00, 0x00, 0x02, 0x00, 0x9b, 0x00, 0x00,
-    0x03, 0x90, 0x04, 0x8d, 0x00, 0x03, 0x00, 0x19, 0x00, 0x17, 0x40, 0x0a, 0x0f, 0x10, 0x10, 0x01,
-    0x7d, 0x05, 0x04, 0x04, 0x00, 0x0a, 0x00, 0x3f, 0x32, 0x2f, 0x33, 0x3f, 0x33, 0x2f, 0x33, 0x30,
-    0x31, 0x73, 0x11, 0x33, 0x11, 0x27, 0x35, 0x33, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23,
-    0x23, 0x35, 0x33, 0x32, 0x16, 0x16, 0x15, 0x14, 0x06, 0x06, 0x23, 0x9b, 0x77, 0x2b, 0xff, 0x6d,
-    0x86, 0x3f, 0x3f, 0x86, 0x6d, 0xfe, 0xfe, 0x8b, 0xbe, 0x61, 0x61, 0xbe, 0x8b, 0x04, 0x8d, 0xfb,
-    0x73, 0xf8, 0x68, 0x40, 0x6e, 0x44, 0x45, 0x72, 0x46, 0x68, 0x5b, 0x9f, 0x69, 0x6c, 0x9c, 0x54,
-    0x00, 0x03, 0x00, 0x69, 0xff, 0xbe, 0x04, 0x40, 0x04, 0xbb, 0x00, 0x15, 0x00, 0x2b, 0x00, 0x2f,
-    0x00, 0x1b, 0x40, 0x0b, 0x2f, 0x2f, 0x1c, 0x11, 0x7e, 0x2d, 0x2d, 0x27, 0x06, 0x0b, 0x72, 0x00,
-    0x2b, 0x32, 0x32, 0x7c, 0x2f, 0x18, 0x3f, 0x33, 0x33, 0x7c, 0x2f, 0x30, 0x31, 0x41, 0x15, 0x14,
-    0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x35, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x1e, 0x02, 0x07,
-    0x35, 0x34, 0x2e, 0x02, 0x23, 0x22, 0x0e, 0x02, 0x15, 0x15, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x3e,
-    0x02, 0x13, 0x01, 0x23, 0x01, 0x04, 0x40, 0x45, 0x81, 0xb5, 0x6f, 0x6f, 0xb5, 0x82, 0x47, 0x46,
-    0x82, 0xb5, 0x6e, 0x70, 0xb5, 0x82, 0x45, 0x76, 0x32, 0x60, 0x8b, 0x59, 0x56, 0x8a, 0x61, 0x33,
-    0x34, 0x61, 0x8a, 0x57, 0x59, 0x8a, 0x60, 0x31, 0x70, 0xfc, 0xac, 0x67, 0x03, 0x55, 0x02, 0x7f,
-    0x71, 0x7d, 0xc7, 0x8e, 0x4c, 0x4c, 0x8e, 0xc7, 0x7d, 0x71, 0x7c, 0xc8, 0x8f, 0x4b, 0x4b, 0x8f,
-    0xc8, 0xed, 0x73, 0x65, 0xa0, 0x72, 0x3c, 0x3c, 0x72, 0xa0, 0x65, 0x73, 0x65, 0xa2, 0x72, 0x3d,
-    0x3d, 0x72, 0xa2, 0x03, 0x12, 0xfb, 0x03, 0x04, 0xfd, 0x00, 0x00, 0x04, 0x00, 0x3f, 0x00, 0x00,
-    0x04, 0x9d, 0x04, 0x8d, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x1b, 0x40, 0x0c,
-    0x02, 0x03, 0x80, 0x0e, 0x0f, 0x0f, 0x0b, 0x07, 0x7d, 0x0a, 0x06, 0x0a, 0x00, 0x3f, 0x33, 0x3f,
-    0x33, 0x33, 0x2f, 0x33, 0x1a, 0xcc, 0x32, 0x30, 0x31, 0x41, 0x15, 0x21, 0x35, 0x13, 0x11, 0x23,
-    0x11, 0x21, 0x11, 0x23, 0x11, 0x17, 0x15, 0x21, 0x35, 0x03, 0xe5, 0xfd, 0x0f, 0x1e, 0x77, 0x03,
-    0xa7, 0x77, 0xd2, 0xfb, 0xa2, 0x02, 0x74, 0x68, 0x68, 0x02, 0x19, 0xfb, 0x73, 0x04, 0x8d, 0xfb,
-    0x73, 0x04, 0x8d, 0xcb, 0x67, 0x67, 0x00, 0x02, 0x00, 0x9b, 0xfe, 0x4b, 0x04, 0x47, 0x04, 0x8d,
-    0x00, 0x09, 0x00, 0x1b, 0x00, 0x1f, 0x40, 0x0f, 0x17, 0x10, 0x0f, 0x72, 0x09, 0x03, 0x06, 0x7d,
-    0x08, 0x0a, 0x0a, 0x02, 0x02, 0x05, 0x0a, 0x00, 0x3f, 0x33, 0x11, 0x33, 0x11, 0x33, 0x3f, 0x33,
-    0x33, 0x2b, 0x32, 0x30, 0x31, 0x41, 0x11, 0x23, 0x01, 0x11, 0x23, 0x11, 0x33, 0x01, 0x11, 0x11,
-    0x33, 0x15, 0x14, 0x06, 0x06, 0x23, 0x22, 0x26, 0x27, 0x37, 0x16, 0x16, 0x33, 0x32, 0x36, 0x36,
-    0x35, 0x04, 0x47, 0x78, 0xfd, 0x43, 0x77, 0x77, 0x02, 0xbd, 0x78, 0x49, 0x87, 0x60, 0x1f, 0x34,
-    0x1d, 0x0e, 0x0f, 0x3e, 0x15, 0x3b, 0x52, 0x2b, 0x04, 0x8d, 0xfb, 0x73, 0x03, 0xd0, 0xfc, 0x30,
-    0x04, 0x8d, 0xfc, 0x32, 0x03, 0xce, 0xfb, 0x97, 0x7d, 0x70, 0x9c, 0x50, 0x09, 0x0a, 0x68, 0x06,
-    0x09, 0x37, 0x6c, 0x4d, 0xff, 0xff, 0x00, 0x32, 0x02, 0x4f, 0x02, 0x11, 0x02, 0xb6, 0x06, 0x06,
-    0x00, 0x11, 0x00, 0x00, 0x00, 0x03, 0x00, 0x40, 0x00, 0x00, 0x04, 0xdc, 0x05, 0xb0, 0x00, 0x1a,
-    0x00, 0x1e, 0x00, 0x22, 0x00, 0x23, 0x40, 0x11, 0x02, 0x01, 0x01, 0x1d, 0x22, 0x21, 0x21, 0x1d,
-    0x0e, 0x0f, 0x0f, 0x1e, 0x02, 0x72, 0x1d, 0x08, 0x72, 0x00, 0x2b, 0x2b, 0x32, 0x11, 0x33, 0x11,
-    0x39, 0x2f, 0x33, 0x11, 0x33, 0x11, 0x33, 0x30, 0x31, 0x61, 0x21, 0x37, 0x21, 0x32, 0x36, 0x36,
-    0x35, 0x35, 0x34, 0x2e, 0x02, 0x23, 0x21, 0x35, 0x21, 0x32, 0x1e, 0x02, 0x15, 0x15, 0x14, 0x0e,
-    0x02, 0x01, 0x11, 0x23, 0x11, 0x01, 0x15, 0x21, 0x35, 0x02, 0x65, 0xfe, 0xb7, 0x02, 0x01, 0x47,
-    0x9d, 0xe3, 0x7c, 0x47, 0x84, 0xb7, 0x71, 0xfe, 0xa8, 0x01, 0x58, 0x88, 0xe4, 0xa7, 0x5b, 0x5b,
-    0xa8, 0xe7, 0xfe, 0x60, 0x7b, 0x01, 0xcd, 0xfd, 0x9c, 0x6a, 0x8c, 0xfb, 0xa5, 0x87, 0x7e, 0xcc,
-    0x91, 0x4e, 0x6a, 0x5d, 0xaf, 0xf4, 0x96, 0x84, 0x96, 0xf4, 0xae, 0x5e, 0x05, 0xb0, 0xfa, 0x50,
-    0x05, 0xb0, 0xfd, 0x68, 0x67, 0x67, 0x00, 0x03, 0x00, 0x40, 0x00, 0x00, 0x04, 0xdc, 0x05, 0xb0,
-    0x00, 0x1a, 0x00, 0x1e, 0x00, 0x22, 0x00, 0x23, 0x40, 0x11, 0x02, 0x01, 0x01, 0x1d, 0x22, 0x21,
-    0x21, 0x1d, 0x0e, 0x0f, 0x0f, 0x1e, 0x02, 0x72, 0x1d, 0x08, 0x72, 0x00, 0x2b, 0x2b, 0x32, 0x11,
-    0x33, 0x11, 0x39, 0x2f, 0x33, 0x11, 0x33, 0x11, 0x33, 0x30, 0x31, 0x61, 0x21, 0x37, 0x21, 0x32,
-    0x36, 0x36, 0x35, 0x35, 0x34, 0x2e, 0x02, 0x23, 0x21, 0x35, 0x21, 0x32, 0x1e, 0x02, 0x15, 0x15,
-    0x14, 0x0e, 0x02, 0x01, 0x11, 0x23, 0x11, 0x01, 0x15, 0x21, 0x35, 0x02, 0x65, 0xfe, 0xb7, 0x02,
-    0x01, 0x47, 0x9d, 0xe3, 0x7c, 0x47, 0x84, 0xb7, 0x71, 0xfe, 0xa8, 0x01, 0x58, 0x88, 0xe4, 0xa7,
-    0x5b, 0x5b, 0xa8, 0xe7, 0xfe, 0x60, 0x7b, 0x01, 0xcd, 0xfd, 0x9c, 0x6a, 0x8c, 0xfb, 0xa5, 0x87,
-    0x7e, 0xcc, 0x91, 0x4e, 0x6a, 0x5d, 0xaf, 0xf4, 0x96, 0x84, 0x96, 0xf4, 0xae, 0x5e, 0x05, 0xb0,
-    0xfa, 0x50, 0x05, 0xb0, 0xfd, 0x68, 0x67, 0x67, 0x00, 0x03, 0x00, 0x1f, 0x00, 0x00, 0x03, 0xeb,
-    0x06, 0x00, 0x00, 0x03, 0x00, 0x1a, 0x00, 0x1e, 0x00, 0x19, 0x40, 0x0d, 0x1e, 0x1d, 0x16, 0x0a,
-    0x07, 0x72, 0x03, 0x00, 0x72, 0x11, 0x02, 0x0a, 0x72, 0x00, 0x2b, 0x32, 0x2b, 0x2b, 0x32, 0xc4,
-    0x32, 0x30, 0x31, 0x41, 0x11, 0x23, 0x11, 0x13, 0x27, 0x3e, 0x03, 0x33, 0x32, 0x1e, 0x02, 0x15,
-    0x11, 0x23, 0x11, 0x34, 0x26, 0x26, 0x23, 0x22, 0x0e, 0x02, 0x01, 0x15, 0x21, 0x35, 0x01, 0x32,
-    0x77, 0x5d, 0x35, 0x05, 0x42, 0x71, 0x9a, 0x5d, 0x51, 0x80, 0x59, 0x2f, 0x78, 0x3e, 0x72, 0x4e,
-    0x56, 0x81, 0x57, 0x2e, 0x01, 0x6a, 0xfd, 0x9c, 0x06, 0x00, 0xfa, 0x00, 0x06, 0x00, 0xfc, 0x60,
-    0x1e, 0x60, 0xa8, 0x80, 0x48, 0x2c, 0x5f, 0x97, 0x6b, 0xfd, 0x3f, 0x02, 0xc2, 0x6f, 0x7f, 0x36,
-    0x4b, 0x77, 0x87, 0x02, 0xb3, 0x67, 0x67, 0x00, 0x00, 0x03, 0x00, 0x35, 0x00, 0x00, 0x04, 0x94,
-    0x05, 0xb0, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x15, 0x40, 0x0a, 0x03, 0x0a, 0x0b, 0x06,
-    0x07, 0x02, 0x72, 0x01, 0x08, 0x72, 0x00, 0x2b, 0x2b, 0x32, 0x2f, 0x33, 0x32, 0x30, 0x31, 0x41,
-    0x11, 0x23, 0x11, 0x21, 0x15, 0x21, 0x35, 0x01, 0x15, 0x21, 0x35, 0x02, 0xa1, 0x7a, 0x02, 0x6d,
-    0xfb, 0xa1, 0x03, 0x5d, 0xfd, 0x9c, 0x05, 0xb0, 0xfa, 0x50, 0x05, 0xb0, 0x6a, 0x6a, 0xfd, 0xfa,
-    0x67, 0x67, 0x00, 0x03, 0x00, 0x0f, 0xff, 0xec, 0x02, 0x73, 0x05, 0x50, 0x00, 0x03, 0x00, 0x15,
-    0x00, 0x19, 0x00, 0x1d, 0x40, 0x0e, 0x0a, 0x11, 0x0b, 0x72, 0x18, 0x19, 0x19, 0x02, 0x02, 0x04,
-    0x04, 0x03, 0x06, 0x72, 0x00, 0x2b, 0x32, 0x2f, 0x32, 0x11, 0x33, 0x2f, 0x33, 0x2b, 0x32, 0x30,
-    0x31, 0x41, 0x15, 0x21, 0x35, 0x13, 0x33, 0x11, 0x14, 0x16, 0x16, 0x33, 0x32, 0x36, 0x37, 0x17,
-    0x06, 0x06, 0x23, 0x22, 0x26, 0x26, 0x35, 0x01, 0x15, 0x21, 0x35, 0x02, 0x37, 0xfd, 0xe1, 0xc7,
-    0x78, 0x27, 0x41, 0x25, 0x1b, 0x31, 0x15, 0x05, 0x16, 0x47, 0x23, 0x45, 0x6a, 0x3c, 0x01, 0x94,
-    0xfd, 0x9c, 0x04, 0x3a, 0x62, 0x62, 0x01, 0x16, 0xfb, 0xb8, 0x4b, 0x4d, 0x19, 0x07, 0x03, 0x65,
-    0x07, 0x09, 0x34, 0x7c, 0x6c, 0x01, 0xc9, 0x67, 0x67, 0x00, 0xff, 0xff, 0x00, 0x1f, 0x00, 0x00,
-    0x04, 0xe2, 0x07, 0x3b, 0x06, 0x26, 0x00, 0x25, 0x00, 0x00, 0x01, 0x07, 0x00, 0x44, 0x01, 0x16,
-    0x01, 0x3b, 0x00, 0x0b, 0xb6, 0x03, 0x10, 0x07, 0x01, 0x01, 0x61, 0x56, 0x00, 0x2b, 0x34, 0x00,
-    0xff, 0xff, 0x00, 0x1f, 0x00, 0x00, 0x04, 0xe2, 0x07, 0x3b, 0x06, 0x26, 0x00, 0x25, 0x00, 0x00,
-    0x01, 0x07, 0x00, 0x75, 0x01, 0xbf, 0x01, 0x3b, 0x00, 0x0b, 0xb6, 0x03, 0x0e, 0x03, 0x01, 0x01,
-    0x61, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x1f, 0x00, 0x00, 0x04, 0xe2, 0x07, 0x32,
-    0x06, 0x26, 0x00, 0x25, 0x00, 0x00, 0x01, 0x07, 0x00, 0x9e, 0x00, 0xce, 0x01, 0x3b, 0x00, 0x0b,
-    0xb6, 0x03, 0x11, 0x07, 0x01, 0x01, 0x6c, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x1f,
-    0x00, 0x00, 0x04, 0xe2, 0x07, 0x19, 0x06, 0x26, 0x00, 0x25, 0x00, 0x00, 0x01, 0x07, 0x00, 0xa5,
-    0x00, 0xcc, 0x01, 0x45, 0x00, 0x0b, 0xb6, 0x03, 0x1c, 0x03, 0x01, 0x01, 0x6b, 0x56, 0x00, 0x2b,
-    0x34, 0x00, 0xff, 0xff, 0x00, 0x1f, 0x00, 0x00, 0x04, 0xe2, 0x07, 0x01, 0x06, 0x26, 0x00, 0x25,
-    0x00, 0x00, 0x01, 0x07, 0x00, 0x6a, 0x00, 0xce, 0x01, 0x3b, 0x00, 0x0d, 0xb7, 0x04, 0x03, 0x23,
-    0x07, 0x01, 0x01, 0x78, 0x56, 0x00, 0x2b, 0x34, 0x34, 0x00, 0xff, 0xff, 0x00, 0x1f, 0x00, 0x00,
-    0x04, 0xe2, 0x07, 0x73, 0x06, 0x26, 0x00, 0x25, 0x00, 0x00, 0x01, 0x07, 0x00, 0xa3, 0x01, 0x4d,
-    0x01, 0x41, 0x00, 0x0d, 0xb7, 0x04, 0x03, 0x19, 0x07, 0x01, 0x01, 0x47, 0x56, 0x00, 0x2b, 0x34,
-    0x34, 0x00, 0xff, 0xff, 0x00, 0x1f, 0x00, 0x00, 0x04, 0xe2, 0x07, 0x8a, 0x06, 0x26, 0x00, 0x25,
-    0x00, 0x00, 0x01, 0x07, 0x02, 0x41, 0x01, 0x39, 0x01, 0x00, 0x00, 0x12, 0xb6, 0x05, 0x04, 0x03,
-    0x1b, 0x07, 0x01, 0x00, 0xb8, 0xff, 0xb2, 0xb0, 0x56, 0x00, 0x2b, 0x34, 0x34, 0x34, 0xff, 0xff,
-    0x00, 0x84, 0xfe, 0x43, 0x04, 0xbf, 0x05, 0xc4, 0x06, 0x26, 0x00, 0x27, 0x00, 0x00, 0x01, 0x07,
-    0x00, 0x79, 0x01, 0xe3, 0xff, 0xf6, 0x00, 0x0b, 0xb6, 0x01, 0x28, 0x05, 0x00, 0x00, 0x0a, 0x56,
-    0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0xb9, 0x00, 0x00, 0x04, 0x42, 0x07, 0x41, 0x06, 0x26,
-    0x00, 0x29, 0x00, 0x00, 0x01, 0x07, 0x00, 0x44, 0x00, 0xff, 0x01, 0x41, 0x00, 0x0b, 0xb6, 0x04,
-    0x12, 0x07, 0x01, 0x01, 0x6c, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0xb9, 0x00, 0x00,
-    0x04, 0x42, 0x07, 0x41, 0x06, 0x26, 0x00, 0x29, 0x00, 0x00, 0x01, 0x07, 0x00, 0x75, 0x01, 0xa8,
-    0x01, 0x41, 0x00, 0x0b, 0xb6, 0x04, 0x10, 0x07, 0x01, 0x01, 0x6c, 0x56, 0x00, 0x2b, 0x34, 0x00,
-    0xff, 0xff, 0x00, 0xb9, 0x00, 0x00, 0x04, 0x42, 0x07, 0x37, 0x06, 0x26, 0x00, 0x29, 0x00, 0x00,
-    0x01, 0x07, 0x00, 0x9e, 0x00, 0xb7, 0x01, 0x41, 0x00, 0x0b, 0xb6, 0x04, 0x13, 0x07, 0x01, 0x01,
-    0x77, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0xb9, 0x00, 0x00, 0x04, 0x42, 0x07, 0x06,
-    0x06, 0x26, 0x00, 0x29, 0x00, 0x00, 0x01, 0x07, 0x00, 0x6a, 0x00, 0xb7, 0x01, 0x41, 0x00, 0x0d,
-    0xb7, 0x05, 0x04, 0x25, 0x07, 0x01, 0x01, 0x83, 0x56, 0x00, 0x2b, 0x34, 0x34, 0x00, 0xff, 0xff,
-    0x00, 0x0c, 0x00, 0x00, 0x01, 0x5c, 0x07, 0x41, 0x06, 0x26, 0x00, 0x2d, 0x00, 0x00, 0x01, 0x07,
-    0x00, 0x44, 0xff, 0xa5, 0x01, 0x41, 0x00, 0x0b, 0xb6, 0x01, 0x06, 0x03, 0x01, 0x01, 0x6c, 0x56,
-    0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0xcb, 0x00, 0x00, 0x02, 0x1b, 0x07, 0x41, 0x06, 0x26,
-    0x00, 0x2d, 0x00, 0x00, 0x01, 0x07, 0x00, 0x75, 0x00, 0x4e, 0x01, 0x41, 0x00, 0x0b, 0xb6, 0x01,
-    0x04, 0x03, 0x01, 0x01, 0x6c, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x00,
-    0x02, 0x29, 0x07, 0x37, 0x06, 0x26, 0x00, 0x2d, 0x00, 0x00, 0x01, 0x07, 0x00, 0x9e, 0xff, 0x5d,
-    0x01, 0x41, 0x00, 0x0b, 0xb6, 0x01, 0x07, 0x03, 0x01, 0x01, 0x77, 0x56, 0x00, 0x2b, 0x34, 0x00,
-    0xff, 0xff, 0xff, 0xe7, 0x00, 0x00, 0x02, 0x42, 0x07, 0x06, 0x06, 0x26, 0x00, 0x2d, 0x00, 0x00,
-    0x01, 0x07, 0x00, 0x6a, 0xff, 0x5d, 0x01, 0x41, 0x00, 0x0d, 0xb7, 0x02, 0x01, 0x19, 0x03, 0x01,
-    0x01, 0x83, 0x56, 0x00, 0x2b, 0x34, 0x34, 0x00, 0xff, 0xff, 0x00, 0xb9, 0x00, 0x00, 0x04, 0xf5,
-    0x07, 0x19, 0x06, 0x26, 0x00, 0x32, 0x00, 0x00, 0x01, 0x07, 0x00, 0xa5, 0x01, 0x20, 0x01, 0x45,
-    0x00, 0x0b, 0xb6, 0x01, 0x18, 0x06, 0x01, 0x01, 0x6b, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff,
-    0x00, 0x7e, 0xff, 0xec, 0x04, 0xed, 0x07, 0x47, 0x06, 0x26, 0x00, 0x33, 0x00, 0x00, 0x01, 0x07,
-    0x00, 0x44, 0x01, 0x47, 0x01, 0x47, 0x00, 0x0b, 0xb6, 0x02, 0x2e, 0x11, 0x01, 0x01, 0x4f, 0x56,
-    0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x7e, 0xff, 0xec, 0x04, 0xed, 0x07, 0x47, 0x06, 0x26,
-    0x00, 0x33, 0x00, 0x00, 0x01, 0x07, 0x00, 0x75, 0x01, 0xf0, 0x01, 0x47, 0x00, 0x0b, 0xb6, 0x02,
-    0x2c, 0x11, 0x01, 0x01, 0x4f, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x7e, 0xff, 0xec,
-    0x04, 0xed, 0x07, 0x3d, 0x06, 0x26, 0x00, 0x33, 0x00, 0x00, 0x01, 0x07, 0x00, 0x9e, 0x00, 0xff,
-    0x01, 0x47, 0x00, 0x0b, 0xb6, 0x02, 0x2f, 0x11, 0x01, 0x01, 0x5a, 0x56, 0x00, 0x2b, 0x34, 0x00,
-    0xff, 0xff, 0x00, 0x7e, 0xff, 0xec, 0x04, 0xed, 0x07, 0x24, 0x06, 0x26, 0x00, 0x33, 0x00, 0x00,
-    0x01, 0x07, 0x00, 0xa5, 0x00, 0xfd, 0x01, 0x50, 0x00, 0x0b, 0xb6, 0x02, 0x3a, 0x11, 0x01, 0x01,
-    0x59, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x7e, 0xff, 0xec, 0x04, 0xed, 0x07, 0x0c,
-    0x06, 0x26, 0x00, 0x33, 0x00, 0x00, 0x01, 0x07, 0x00, 0x6a, 0x00, 0xff, 0x01, 0x47, 0x00, 0x0d,
-    0xb7, 0x03, 0x02, 0x41, 0x11, 0x01, 0x01, 0x66, 0x56, 0x00, 0x2b, 0x34, 0x34, 0x00, 0xff, 0xff,
-    0x00, 0xa3, 0xff, 0xec, 0x04, 0xa3, 0x07, 0x3b, 0x06, 0x26, 0x00, 0x39, 0x00, 0x00, 0x01, 0x07,
-    0x00, 0x44, 0x01, 0x3e, 0x01, 0x3b, 0x00, 0x0b, 0xb6, 0x01, 0x18, 0x00, 0x01, 0x01, 0x61, 0x56,
-    0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0xa3, 0xff, 0xec, 0x04, 0xa3, 0x07, 0x3b, 0x06, 0x26,
-    0x00, 0x39, 0x00, 0x00, 0x01, 0x07, 0x00, 0x75, 0x01, 0xe7, 0x01, 0x3b, 0x00, 0x0b, 0xb6, 0x01,
-    0x16, 0x0b, 0x01, 0x01, 0x61, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0xa3, 0xff, 0xec,
-    0x04, 0xa3, 0x07, 0x32, 0x06, 0x26, 0x00, 0x39, 0x00, 0x00, 0x01, 0x07, 0x00, 0x9e, 0x00, 0xf6,
-    0x01, 0x3b, 0x00, 0x0b, 0xb6, 0x01, 0x19, 0x00, 0x01, 0x01, 0x6c, 0x56, 0x00, 0x2b, 0x34, 0x00,
-    0xff, 0xff, 0x00, 0xa3, 0xff, 0xec, 0x04, 0xa3, 0x07, 0x01, 0x06, 0x26, 0x00, 0x39, 0x00, 0x00,
-    0x01, 0x07, 0x00, 0x6a, 0x00, 0xf6, 0x01, 0x3b, 0x00, 0x0d, 0xb7, 0x02, 0x01, 0x2b, 0x00, 0x01,
-    0x01, 0x78, 0x56, 0x00, 0x2b, 0x34, 0x34, 0x00, 0xff, 0xff, 0x00, 0x18, 0x00, 0x00, 0x04, 0xaf,
-    0x07, 0x35, 0x06, 0x26, 0x00, 0x3d, 0x00, 0x00, 0x01, 0x07, 0x00, 0x75, 0x01, 0xa2, 0x01, 0x35,
-    0x00, 0x0b, 0xb6, 0x01, 0x09, 0x02, 0x01, 0x01, 0x60, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff,
-    0x00, 0x65, 0xff, 0xec, 0x03, 0xc8, 0x06, 0x00, 0x06, 0x26, 0x00, 0x45, 0x00, 0x00, 0x01, 0x07,
-    0x00, 0x44, 0x00, 0xd7, 0x00, 0x00, 0x00, 0x0b, 0xb6, 0x02, 0x3d, 0x0f, 0x01, 0x01, 0x8c, 0x56,
-    0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x65, 0xff, 0xec, 0x03, 0xc8, 0x06, 0x00, 0x06, 0x26,
-    0x00, 0x45, 0x00, 0x00, 0x01, 0x07, 0x00, 0x75, 0x01, 0x80, 0x00, 0x00, 0x00, 0x0b, 0xb6, 0x02,
-    0x3b, 0x0f, 0x01, 0x01, 0x8c, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x65, 0xff, 0xec,
-    0x03, 0xc8, 0x05, 0xf6, 0x06, 0x26, 0x00, 0x45, 0x00, 0x00, 0x01, 0x07, 0x00, 0x9e, 0x00, 0x8f,
-    0x00, 0x00, 0x00, 0x0b, 0xb6, 0x02, 0x3e, 0x0f, 0x01, 0x01, 0x97, 0x56, 0x00, 0x2b, 0x34, 0x00,
-    0xff, 0xff, 0x00, 0x65, 0xff, 0xec, 0x03, 0xc8, 0x05, 0xdd, 0x06, 0x26, 0x00, 0x45, 0x00, 0x00,
-    0x01, 0x07, 0x00, 0xa5, 0x00, 0x8d, 0x00, 0x09, 0x00, 0x0b, 0xb6, 0x02, 0x49, 0x0f, 0x01, 0x01,
-    0x96, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x65, 0xff, 0xec, 0x03, 0xc8, 0x05, 0xc5,
-    0x06, 0x26, 0x00, 0x45, 0x00, 0x00, 0x01, 0x07, 0x00, 0x6a, 0x00, 0x8f, 0x00, 0x00, 0x00, 0x0d,
-    0xb7, 0x03, 0x02, 0x50, 0x0f, 0x01, 0x01, 0xa3, 0x56, 0x00, 0x2b, 0x34, 0x34, 0x00, 0xff, 0xff,
-    0x00, 0x65, 0xff, 0xec, 0x03, 0xc8, 0x06, 0x38, 0x06, 0x26, 0x00, 0x45, 0x00, 0x00, 0x01, 0x07,
-    0x00, 0xa3, 0x01, 0x0e, 0x00, 0x05, 0x00, 0x0d, 0xb7, 0x03, 0x02, 0x46, 0x0f, 0x01, 0x01, 0x72,
-    0x56, 0x00, 0x2b, 0x34, 0x34, 0x00, 0xff, 0xff, 0x00, 0x65, 0xff, 0xec, 0x03, 0xc8, 0x06, 0x4f,
-    0x06, 0x26, 0x00, 0x45, 0x00, 0x00, 0x01, 0x07, 0x02, 0x41, 0x00, 0xfa, 0xff, 0xc5, 0x00, 0x12,
-    0xb6, 0x04, 0x03, 0x02, 0x48, 0x0f, 0x00, 0x00, 0xb8, 0xff, 0xdd, 0xb0, 0x56, 0x00, 0x2b, 0x34,
-    0x34, 0x34, 0xff, 0xff, 0x00, 0x5f, 0xfe, 0x43, 0x03, 0xcd, 0x04, 0x4e, 0x06, 0x26, 0x00, 0x47,
-    0x00, 0x00, 0x01, 0x07, 0x00, 0x79, 0x01, 0x58, 0xff, 0xf6, 0x00, 0x0b, 0xb6, 0x01, 0x28, 0x09,
-    0x00, 0x00, 0x0a, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x5a, 0xff, 0xec, 0x03, 0xd6,
-    0x05, 0xff, 0x06, 0x26, 0x00, 0x49, 0x00, 0x00, 0x01, 0x07, 0x00, 0x44, 0x00, 0xca, 0xff, 0xff,
-    0x00, 0x0b, 0xb6, 0x01, 0x2e, 0x0b, 0x01, 0x01, 0x8c, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff,
-    0x00, 0x5a, 0xff, 0xec, 0x03, 0xd6, 0x05, 0xff, 0x06, 0x26, 0x00, 0x49, 0x00, 0x00, 0x01, 0x07,
-    0x00, 0x75, 0x01, 0x73, 0xff, 0xff, 0x00, 0x0b, 0xb6, 0x01, 0x2c, 0x0b, 0x01, 0x01, 0x8c, 0x56,
-    0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x5a, 0xff, 0xec, 0x03, 0xd6, 0x05, 0xf6, 0x06, 0x26,
-    0x00, 0x49, 0x00, 0x00, 0x01, 0x07, 0x00, 0x9e, 0x00, 0x82, 0xff, 0xff, 0x00, 0x0b, 0xb6, 0x01,
-    0x2f, 0x0b, 0x01, 0x01, 0x97, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x5a, 0xff, 0xec,
-    0x03, 0xd6, 0x05, 0xc5, 0x06, 0x26, 0x00, 0x49, 0x00, 0x00, 0x01, 0x07, 0x00, 0x6a, 0x00, 0x82,
-    0xff, 0xff, 0x00, 0x0d, 0xb7, 0x02, 0x01, 0x41, 0x0b, 0x01, 0x01, 0xa3, 0x56, 0x00, 0x2b, 0x34,
-    0x34, 0x00, 0xff, 0xff, 0xff, 0xe1, 0x00, 0x00, 0x01, 0x31, 0x05, 0xf3, 0x06, 0x26, 0x00, 0x8d,
-    0x00, 0x00, 0x01, 0x07, 0x00, 0x44, 0xff, 0x7a, 0xff, 0xf3, 0x00, 0x0b, 0xb6, 0x01, 0x06, 0x03,
-    0x01, 0x01, 0x9e, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0xa0, 0x00, 0x00, 0x01, 0xf0,
-    0x05, 0xf3, 0x06, 0x26, 0x00, 0x8d, 0x00, 0x00, 0x01, 0x06, 0x00, 0x75, 0x23, 0xf3, 0x00, 0x0b,
-    0xb6, 0x01, 0x04, 0x03, 0x01, 0x01, 0x9e, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0xff, 0xd3,
-    0x00, 0x00, 0x01, 0xfe, 0x05, 0xea, 0x06, 0x26, 0x00, 0x8d, 0x00, 0x00, 0x01, 0x07, 0x00, 0x9e,
-    0xff, 0x32, 0xff, 0xf3, 0x00, 0x0b, 0xb6, 0x01, 0x07, 0x03, 0x01, 0x01, 0xa9, 0x56, 0x00, 0x2b,
-    0x34, 0x00, 0xff, 0xff, 0xff, 0xbc, 0x00, 0x00, 0x02, 0x17, 0x05, 0xb9, 0x06, 0x26, 0x00, 0x8d,
-    0x00, 0x00, 0x01, 0x07, 0x00, 0x6a, 0xff, 0x32, 0xff, 0xf3, 0x00, 0x0d, 0xb7, 0x02, 0x01, 0x19,
-    0x03, 0x01, 0x01, 0xb5, 0x56, 0x00, 0x2b, 0x34, 0x34, 0x00, 0xff, 0xff, 0x00, 0x9d, 0x00, 0x00,
-    0x03, 0xcd, 0x05, 0xdc, 0x06, 0x26, 0x00, 0x52, 0x00, 0x00, 0x01, 0x07, 0x00, 0xa5, 0x00, 0x89,
-    0x00, 0x08, 0x00, 0x0b, 0xb6, 0x02, 0x2a, 0x03, 0x01, 0x01, 0xaa, 0x56, 0x00, 0x2b, 0x34, 0x00,
-    0xff, 0xff, 0x00, 0x5b, 0xff, 0xec, 0x04, 0x21, 0x05, 0xff, 0x06, 0x26, 0x00, 0x53, 0x00, 0x00,
-    0x01, 0x07, 0x00, 0x44, 0x00, 0xcf, 0xff, 0xff, 0x00, 0x0b, 0xb6, 0x02, 0x2e, 0x06, 0x01, 0x01,
-    0x8c, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x5b, 0xff, 0xec, 0x04, 0x21, 0x05, 0xff,
-    0x06, 0x26, 0x00, 0x53, 0x00, 0x00, 0x01, 0x07, 0x00, 0x75, 0x01, 0x78, 0xff, 0xff, 0x00, 0x0b,
-    0xb6, 0x02, 0x2c, 0x06, 0x01, 0x01, 0x8c, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x5b,
-    0xff, 0xec, 0x04, 0x21, 0x05, 0xf5, 0x06, 0x26, 0x00, 0x53, 0x00, 0x00, 0x01, 0x07, 0x00, 0x9e,
-    0x00, 0x87, 0xff, 0xff, 0x00, 0x0b, 0xb6, 0x02, 0x2f, 0x06, 0x01, 0x01, 0x97, 0x56, 0x00, 0x2b,
-    0x34, 0x00, 0xff, 0xff, 0x00, 0x5b, 0xff, 0xec, 0x04, 0x21, 0x05, 0xdc, 0x06, 0x26, 0x00, 0x53,
-    0x00, 0x00, 0x01, 0x07, 0x00, 0xa5, 0x00, 0x85, 0x00, 0x08, 0x00, 0x0b, 0xb6, 0x02, 0x3a, 0x06,
-    0x01, 0x01, 0x96, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x5b, 0xff, 0xec, 0x04, 0x21,
-    0x05, 0xc4, 0x06, 0x26, 0x00, 0x53, 0x00, 0x00, 0x01, 0x07, 0x00, 0x6a, 0x00, 0x87, 0xff, 0xff,
-    0x00, 0x0d, 0xb7, 0x03, 0x02, 0x41, 0x06, 0x01, 0x01, 0xa3, 0x56, 0x00, 0x2b, 0x34, 0x34, 0x00,
-    0xff, 0xff, 0x00, 0x99, 0xff, 0xec, 0x03, 0xcb, 0x06, 0x00, 0x06, 0x26, 0x00, 0x59, 0x00, 0x00,
-    0x01, 0x07, 0x00, 0x44, 0x00, 0xd1, 0x00, 0x00, 0x00, 0x0b, 0xb6, 0x02, 0x1e, 0x11, 0x01, 0x01,
-    0xa0, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x99, 0xff, 0xec, 0x03, 0xcb, 0x06, 0x00,
-    0x06, 0x26, 0x00, 0x59, 0x00, 0x00, 0x01, 0x07, 0x00, 0x75, 0x01, 0x7a, 0x00, 0x00, 0x00, 0x0b,
-    0xb6, 0x02, 0x1c, 0x11, 0x01, 0x01, 0xa0, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x99,
-    0xff, 0xec, 0x03, 0xcb, 0x05, 0xf7, 0x06, 0x26, 0x00, 0x59, 0x00, 0x00, 0x01, 0x07, 0x00, 0x9e,
-    0x00, 0x89, 0x00, 0x00, 0x00, 0x0b, 0xb6, 0x02, 0x1f, 0x11, 0x01, 0x01, 0xab, 0x56, 0x00, 0x2b,
-    0x34, 0x00, 0xff, 0xff, 0x00, 0x99, 0xff, 0xec, 0x03, 0xcb, 0x05, 0xc6, 0x06, 0x26, 0x00, 0x59,
-    0x00, 0x00, 0x01, 0x07, 0x00, 0x6a, 0x00, 0x89, 0x00, 0x00, 0x00, 0x0d, 0xb7, 0x03, 0x02, 0x31,
-    0x11, 0x01, 0x01, 0xb7, 0x56, 0x00, 0x2b, 0x34, 0x34, 0x00, 0xff, 0xff, 0x00, 0x21, 0xfe, 0x4b,
-    0x03, 0xb0, 0x06, 0x00, 0x06, 0x26, 0x00, 0x5d, 0x00, 0x00, 0x01, 0x07, 0x00, 0x75, 0x01, 0x3e,
-    0x00, 0x00, 0x00, 0x0b, 0xb6, 0x02, 0x19, 0x01, 0x01, 0x01, 0xa0, 0x56, 0x00, 0x2b, 0x34, 0x00,
-    0xff, 0xff, 0x00, 0x21, 0xfe, 0x4b, 0x03, 0xb0, 0x05, 0xc6, 0x06, 0x26, 0x00, 0x5d, 0x00, 0x00,
-    0x01, 0x06, 0x00, 0x6a, 0x4d, 0x00, 0x00, 0x0d, 0xb7, 0x03, 0x02, 0x2e, 0x01, 0x01, 0x01, 0xb7,
-    0x56, 0x00, 0x2b, 0x34, 0x34, 0x00, 0xff, 0xff, 0x00, 0x1f, 0x00, 0x00, 0x04, 0xe2, 0x06, 0xe5,
-    0x06, 0x26, 0x00, 0x25, 0x00, 0x00, 0x01, 0x07, 0x00, 0x70, 0x00, 0xc7, 0x01, 0x45, 0x00, 0x0b,
-    0xb6, 0x03, 0x10, 0x03, 0x01, 0x01, 0xa6, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x65,
-    0xff, 0xec, 0x03, 0xc8, 0x05, 0xaa, 0x06, 0x26, 0x00, 0x45, 0x00, 0x00, 0x01, 0x07, 0x00, 0x70,
-    0x00, 0x89, 0x00, 0x09, 0x00, 0x0b, 0xb6, 0x02, 0x3d, 0x0f, 0x01, 0x01, 0xd1, 0x56, 0x00, 0x2b,
-    0x34, 0x00, 0xff, 0xff, 0x00, 0x1f, 0x00, 0x00, 0x04, 0xe2, 0x07, 0x10, 0x06, 0x26, 0x00, 0x25,
-    0x00, 0x00, 0x01, 0x07, 0x00, 0xa1, 0x00, 0xd6, 0x01, 0x3e, 0x00, 0x0b, 0xb6, 0x03, 0x13, 0x07,
-    0x01, 0x01, 0x53, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x65, 0xff, 0xec, 0x03, 0xc8,
-    0x05, 0xd5, 0x06, 0x26, 0x00, 0x45, 0x00, 0x00, 0x01, 0x07, 0x00, 0xa1, 0x00, 0x98, 0x00, 0x02,
-    0x00, 0x0b, 0xb6, 0x02, 0x40, 0x0f, 0x01, 0x01, 0x7e, 0x56, 0x00, 0x2b, 0x34, 0x00, 0x00, 0x04,
-    0x00, 0x1f, 0xfe, 0x62, 0x04, 0xe9, 0x05, 0xb0, 0x00, 0x04, 0x00, 0x09, 0x00, 0x0d, 0x00, 0x23,
-    0x00, 0x2b, 0x40, 0x15, 0x0d, 0x0c, 0x0c, 0x03, 0x16, 0x1d, 0x06, 0x00, 0x02, 0x07, 0x03, 0x02,
-    0x72, 0x0e, 0x0f, 0x0f, 0x05, 0x05, 0x02, 0x08, 0x72, 0x00, 0x2b, 0x32, 0x11, 0x33, 0x11, 0x33,
-    0x2b, 0x32, 0x12, 0x39, 0x39, 0x2f, 0x33, 0x12, 0x39, 0x2f, 0x33, 0x30, 0x31, 0x41, 0x01, 0x23,
-    0x01, 0x33, 0x01, 0x01, 0x27, 0x33, 0x01, 0x03, 0x15, 0x21, 0x35, 0x01, 0x17, 0x0e, 0x02, 0x15,
-    0x14, 0x16, 0x33, 0x32, 0x36, 0x37, 0x17, 0x06, 0x06, 0x23, 0x22, 0x26, 0x35, 0x34, 0x36, 0x36,
-    0x02, 0x97, 0xfe, 0x08, 0x80, 0x02, 0x26, 0x5a, 0x01, 0xc2, 0xfe, 0x08, 0x07, 0x59, 0x02, 0x27,
-    0xda, 0xfc, 0xfa, 0x03, 0x92, 0x3b, 0x2d, 0x53, 0x34, 0x25, 0x31, 0x24, 0x34, 0x11, 0x0f, 0x16,
-    0x45, 0x35, 0x4a, 0x5f, 0x38, 0x67, 0x05, 0x59, 0xfa, 0xa7, 0x05, 0xb0, 0xfa, 0x50, 0x05, 0x59,
-    0x57, 0xfa, 0x50, 0x02, 0x02, 0x6a, 0x6a, 0xfe, 0x25, 0x27, 0x22, 0x49, 0x51, 0x2e, 0x23, 0x31,
-    0x16, 0x0b, 0x55, 0x0f, 0x1d, 0x55, 0x55, 0x32, 0x65, 0x5d, 0x00, 0x03, 0x00, 0x65, 0xfe, 0x62,
-    0x03, 0xd2, 0x04, 0x4e, 0x00, 0x1b, 0x00, 0x3a, 0x00, 0x50, 0x00, 0x2b, 0x40, 0x17, 0x1e, 0x3a,
-    0x3a, 0x0f, 0x43, 0x4a, 0x0f, 0x72, 0x27, 0x31, 0x0b, 0x72, 0x3b, 0x3c, 0x3c, 0x19, 0x0a, 0x72,
-    0x09, 0x05, 0x0f, 0x07, 0x72, 0x00, 0x2b, 0x32, 0x32, 0x2b, 0x32, 0x11, 0x33, 0x2b, 0x32, 0x2b,
-    0x32, 0x12, 0x39, 0x2f, 0x33, 0x30, 0x31, 0x65, 0x11, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06,
-    0x15, 0x27, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x16, 0x16, 0x15, 0x11, 0x14, 0x16, 0x17, 0x15, 0x23,
-    0x26, 0x26, 0x13, 0x17, 0x23, 0x22, 0x0e, 0x02, 0x15, 0x14, 0x16, 0x16, 0x33, 0x32, 0x36, 0x36,
-    0x37, 0x17, 0x0e, 0x03, 0x23, 0x22, 0x26, 0x26, 0x35, 0x34, 0x3e, 0x02, 0x33, 0x01, 0x17, 0x0e,
-    0x02, 0x15, 0x14, 0x16, 0x33, 0x32, 0x36, 0x37, 0x17, 0x06, 0x06, 0x23, 0x22, 0x26, 0x35, 0x34,
-    0x36, 0x36, 0x03, 0x2f, 0x40, 0x7c, 0x5b, 0x54, 0x83, 0x4b, 0x77, 0x3b, 0x6e, 0x99, 0x5d, 0x73,
-    0xb1, 0x65, 0x11, 0x10, 0x80, 0x0c, 0x0d, 0x1c, 0x02, 0xea, 0x5c, 0x91, 0x64, 0x35, 0x3a, 0x6e,
-    0x4b, 0x63, 0x99, 0x64, 0x11, 0x34, 0x0d, 0x45, 0x6d, 0x95, 0x5f, 0x69, 0x9e, 0x56, 0x44, 0x80,
-    0xb7, 0x72, 0x01, 0x2b, 0x3b, 0x2d, 0x53, 0x34, 0x25, 0x31, 0x24, 0x34, 0x11, 0x0f, 0x16, 0x45,
-    0x35, 0x4a, 0x5f, 0x38, 0x67, 0xc2, 0x02, 0x2e, 0x4d, 0x70, 0x3c, 0x3b, 0x63, 0x3c, 0x01, 0x3d,
-    0x72, 0x5a, 0x35, 0x4e, 0x9c, 0x76, 0xfd, 0xf5, 0x38, 0x78, 0x26, 0x0d, 0x24, 0x6d, 0x01, 0xe5,
-    0x5c, 0x21, 0x3e, 0x59, 0x38, 0x3a, 0x60, 0x38, 0x49, 0x78, 0x47, 0x45, 0x31, 0x6a, 0x5b, 0x39,
-    0x51, 0x8b, 0x58, 0x4f, 0x7f, 0x59, 0x2f, 0xfd, 0xb1, 0x27, 0x22, 0x49, 0x51, 0x2e, 0x23, 0x31,
-    0x16, 0x0b, 0x55, 0x0f, 0x1d, 0x55, 0x55, 0x32, 0x65, 0x5d, 0xff, 0xff, 0x00, 0x84, 0xff, 0xec,
-    0x04, 0xbf, 0x07, 0x56, 0x06, 0x26, 0x00, 0x27, 0x00, 0x00, 0x01, 0x07, 0x00, 0x75, 0x01, 0xe4,
-    0x01, 0x56, 0x00, 0x0b, 0xb6, 0x01, 0x28, 0x10, 0x01, 0x01, 0x6d, 0x56, 0x00, 0x2b, 0x34, 0x00,
-    0xff, 0xff, 0x00, 0x5f, 0xff, 0xec, 0x03, 0xcd, 0x05, 0xff, 0x06, 0x26, 0x00, 0x47, 0x00, 0x00,
-    0x01, 0x07, 0x00, 0x75, 0x01, 0x59, 0xff, 0xff, 0x00, 0x0b, 0xb6, 0x01, 0x28, 0x14, 0x01, 0x01,
-    0x8c, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x84, 0xff, 0xec, 0x04, 0xbf, 0x07, 0x4c,
-    0x06, 0x26, 0x00, 0x27, 0x00, 0x00, 0x01, 0x07, 0x00, 0x9e, 0x00, 0xf3, 0x01, 0x56, 0x00, 0x0b,
-    0xb6, 0x01, 0x2b, 0x10, 0x01, 0x01, 0x78, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x5f,
-    0xff, 0xec, 0x03, 0xcd, 0x05, 0xf5, 0x06, 0x26, 0x00, 0x47, 0x00, 0x00, 0x01, 0x06, 0x00, 0x9e,
-    0x68, 0xff, 0x00, 0x0b, 0xb6, 0x01, 0x2b, 0x14, 0x01, 0x01, 0x97, 0x56, 0x00, 0x2b, 0x34, 0x00,
-    0xff, 0xff, 0x00, 0x84, 0xff, 0xec, 0x04, 0xbf, 0x07, 0x0d, 0x06, 0x26, 0x00, 0x27, 0x00, 0x00,
-    0x01, 0x07, 0x00, 0xa2, 0x01, 0xc0, 0x01, 0x56, 0x00, 0x0b, 0xb6, 0x01, 0x31, 0x10, 0x01, 0x01,
-    0x82, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x5f, 0xff, 0xec, 0x03, 0xcd, 0x05, 0xb6,
-    0x06, 0x26, 0x00, 0x47, 0x00, 0x00, 0x01, 0x07, 0x00, 0xa2, 0x01, 0x35, 0xff, 0xff, 0x00, 0x0b,
-    0xb6, 0x01, 0x31, 0x14, 0x01, 0x01, 0xa1, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x84,
-    0xff, 0xec, 0x04, 0xbf, 0x07, 0x49, 0x06, 0x26, 0x00, 0x27, 0x00, 0x00, 0x01, 0x07, 0x00, 0x9f,
-    0x01, 0x00, 0x01, 0x58, 0x00, 0x0b, 0xb6, 0x01, 0x2e, 0x10, 0x01, 0x01, 0x76, 0x56, 0x00, 0x2b,
-    0x34, 0x00, 0xff, 0xff, 0x00, 0x5f, 0xff, 0xec, 0x03, 0xcd, 0x05, 0xf2, 0x06, 0x26, 0x00, 0x47,
-    0x00, 0x00, 0x01, 0x06, 0x00, 0x9f, 0x75, 0x01, 0x00, 0x0b, 0xb6, 0x01, 0x2e, 0x14, 0x01, 0x01,
-    0x95, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0xb9, 0x00, 0x00, 0x04, 0xbe, 0x07, 0x34,
-    0x06, 0x26, 0x00, 0x28, 0x00, 0x00, 0x01, 0x07, 0x00, 0x9f, 0x00, 0xb0, 0x01, 0x43, 0x00, 0x0b,
-    0xb6, 0x02, 0x25, 0x1e, 0x01, 0x01, 0x75, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x6d,
-    0xff, 0xec, 0x04, 0xed, 0x06, 0x01, 0x04, 0x26, 0x00, 0x48, 0x00, 0x00, 0x01, 0x07, 0x01, 0xd4,
-    0x03, 0xb8, 0x05, 0x50, 0x00, 0x0b, 0xb6, 0x03, 0x39, 0x01, 0x01, 0x00, 0x00, 0x56, 0x00, 0x2b,
-    0x34, 0x00, 0xff, 0xff, 0x00, 0xb9, 0x00, 0x00, 0x04, 0x42, 0x06, 0xeb, 0x06, 0x26, 0x00, 0x29,
-    0x00, 0x00, 0x01, 0x07, 0x00, 0x70, 0x00, 0xb0, 0x01, 0x4a, 0x00, 0x0b, 0xb6, 0x04, 0x12, 0x07,
-    0x01, 0x01, 0xb1, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x5a, 0xff, 0xec, 0x03, 0xd6,
-    0x05, 0xa9, 0x06, 0x26, 0x00, 0x49, 0x00, 0x00, 0x01, 0x06, 0x00, 0x70, 0x7b, 0x09, 0x00, 0x0b,
-    0xb6, 0x01, 0x2e, 0x0b, 0x01, 0x01, 0xd1, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0xb9,
-    0x00, 0x00, 0x04, 0x42, 0x07, 0x16, 0x06, 0x26, 0x00, 0x29, 0x00, 0x00, 0x01, 0x07, 0x00, 0xa1,
-    0x00, 0xbf, 0x01, 0x43, 0x00, 0x0b, 0xb6, 0x04, 0x15, 0x07, 0x01, 0x01, 0x5e, 0x56, 0x00, 0x2b,
-    0x34, 0x00, 0xff, 0xff, 0x00, 0x5a, 0xff, 0xec, 0x03, 0xd6, 0x05, 0xd4, 0x06, 0x26, 0x00, 0x49,
-    0x00, 0x00, 0x01, 0x07, 0x00, 0xa1, 0x00, 0x8a, 0x00, 0x02, 0x00, 0x0b, 0xb6, 0x01, 0x31, 0x0b,
-    0x01, 0x01, 0x7e, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0xb9, 0x00, 0x00, 0x04, 0x42,
-    0x06, 0xf8, 0x06, 0x26, 0x00, 0x29, 0x00, 0x00, 0x01, 0x07, 0x00, 0xa2, 0x01, 0x84, 0x01, 0x41,
-    0x00, 0x0b, 0xb6, 0x04, 0x19, 0x07, 0x01, 0x01, 0x81, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff,
-    0x00, 0x5a, 0xff, 0xec, 0x03, 0xd6, 0x05, 0xb7, 0x06, 0x26, 0x00, 0x49, 0x00, 0x00, 0x01, 0x07,
-    0x00, 0xa2, 0x01, 0x4f, 0xff, 0xff, 0x00, 0x0b, 0xb6, 0x01, 0x35, 0x0b, 0x01, 0x01, 0xa1, 0x56,
-    0x00, 0x2b, 0x34, 0x00, 0x00, 0x05, 0x00, 0xb9, 0xfe, 0x62, 0x04, 0x42, 0x05, 0xb0, 0x00, 0x03,
-    0x00, 0x07, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x25, 0x00, 0x29, 0x40, 0x14, 0x0a, 0x0b, 0x0b, 0x18,
-    0x1f, 0x0e, 0x0f, 0x0f, 0x07, 0x02, 0x72, 0x10, 0x11, 0x11, 0x03, 0x02, 0x02, 0x06, 0x08, 0x72,
-    0x00, 0x2b, 0x32, 0x11, 0x33, 0x32, 0x11, 0x33, 0x2b, 0x32, 0x11, 0x33, 0x2f, 0x33, 0x39, 0x2f,
-    0x33, 0x30, 0x31, 0x65, 0x15, 0x21, 0x35, 0x13, 0x11, 0x23, 0x11, 0x01, 0x15, 0x21, 0x35, 0x01,
-    0x15, 0x21, 0x35, 0x01, 0x17, 0x0e, 0x02, 0x15, 0x14, 0x16, 0x33, 0x32, 0x36, 0x37, 0x17, 0x06,
-    0x06, 0x23, 0x22, 0x26, 0x35, 0x34, 0x36, 0x36, 0x04, 0x42, 0xfc, 0xcd, 0x25, 0x7b, 0x03, 0x23,
-    0xfd, 0x33, 0x03, 0x2e, 0xfc, 0xd2, 0x02, 0xb7, 0x3b, 0x2d, 0x53, 0x34, 0x25, 0x31, 0x24, 0x34,
-    0x11, 0x0f, 0x16, 0x45, 0x35, 0x4a, 0x5f, 0x38, 0x67, 0x6a, 0x6a, 0x6a, 0x05, 0x46, 0xfa, 0x50,
-    0x05, 0xb0, 0xfd, 0x73, 0x69, 0x69, 0x02, 0x8d, 0x6a, 0x6a, 0xfa, 0x77, 0x27, 0x22, 0x49, 0x51,
-    0x2e, 0x23, 0x31, 0x16, 0x0b, 0x55, 0x0f, 0x1d, 0x55, 0x55, 0x32, 0x65, 0x5d, 0x00, 0x00, 0x02,
-    0x00, 0x5a, 0xfe, 0x8c, 0x03, 0xd6, 0x04, 0x4e, 0x00, 0x2b, 0x00, 0x41, 0x00, 0x25, 0x40, 0x13,
-    0x12, 0x13, 0x13, 0x0b, 0x34, 0x3b, 0x0e, 0x72, 0x19, 0x0b, 0x07, 0x72, 0x2c, 0x2d, 0x24, 0x24,
-    0x00, 0x0b, 0x72, 0x00, 0x2b, 0x32, 0x11, 0x39, 0x39, 0x2b, 0x32, 0x2b, 0x32, 0x12, 0x39, 0x2f,
-    0x33, 0x30, 0x31, 0x45, 0x22, 0x2e, 0x02, 0x35, 0x35, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x1e, 0x02,
-    0x15, 0x15, 0x21, 0x35, 0x21, 0x35, 0x2e, 0x02, 0x23, 0x22, 0x0e, 0x02, 0x15, 0x15, 0x14, 0x1e,
-    0x02, 0x33, 0x32, 0x36, 0x37, 0x17, 0x0e, 0x02, 0x37, 0x17, 0x0e, 0x02, 0x15, 0x14, 0x16, 0x33,
-    0x32, 0x36, 0x37, 0x17, 0x06, 0x06, 0x23, 0x22, 0x26, 0x35, 0x34, 0x36, 0x36, 0x02, 0x40, 0x6a,
-    0xb2, 0x82, 0x48, 0x4b, 0x81, 0xa7, 0x5d, 0x67, 0x9f, 0x6e, 0x38, 0xfc, 0xcd, 0x02, 0xbb, 0x02,
-    0x45, 0x87, 0x66, 0x4d, 0x7e, 0x5b, 0x32, 0x36, 0x62, 0x88, 0x53, 0x5f, 0x95, 0x3b, 0x4b, 0x24,
-    0x68, 0x92, 0x5b, 0x3a, 0x2d, 0x52, 0x34, 0x24, 0x31, 0x25, 0x34, 0x10, 0x0f, 0x16, 0x45, 0x34,
-    0x4a, 0x60, 0x38, 0x67, 0x14, 0x4e, 0x8e, 0xc3, 0x74, 0x2b, 0x7d, 0xca, 0x91, 0x4c, 0x49, 0x85,
-    0xb5, 0x6d, 0x49, 0x67, 0x0d, 0x5b, 0x9f, 0x64, 0x40, 0x77, 0xa3, 0x63, 0x2b, 0x59, 0x9c, 0x75,
-    0x43, 0x47, 0x4d, 0x3a, 0x34, 0x57, 0x35, 0x65, 0x27, 0x22, 0x49, 0x51, 0x2e, 0x23, 0x31, 0x16,
-    0x0b, 0x55, 0x0f, 0x1d, 0x55, 0x55, 0x32, 0x65, 0x5d, 0x00, 0xff, 0xff, 0x00, 0xb9, 0x00, 0x00,
-    0x04, 0x42, 0x07, 0x34, 0x06, 0x26, 0x00, 0x29, 0x00, 0x00, 0x01, 0x07, 0x00, 0x9f, 0x00, 0xc4,
-    0x01, 0x43, 0x00, 0x0b, 0xb6, 0x04, 0x16, 0x07, 0x01, 0x01, 0x75, 0x56, 0x00, 0x2b, 0x34, 0x00,
-    0xff, 0xff, 0x00, 0x5a, 0xff, 0xec, 0x03, 0xd6, 0x05, 0xf2, 0x06, 0x26, 0x00, 0x49, 0x00, 0x00,
-    0x01, 0x07, 0x00, 0x9f, 0x00, 0x8f, 0x00, 0x02, 0x00, 0x0b, 0xb6, 0x01, 0x32, 0x0b, 0x01, 0x01,
-    0x95, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x91, 0xff, 0xec, 0x04, 0xd4, 0x07, 0x4c,
-    0x06, 0x26, 0x00, 0x2b, 0x00, 0x00, 0x01, 0x07, 0x00, 0x9e, 0x00, 0xfb, 0x01, 0x56, 0x00, 0x0b,
-    0xb6, 0x01, 0x2f, 0x10, 0x01, 0x01, 0x78, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x6d,
-    0xfe, 0x51, 0x03, 0xd4, 0x05, 0xf5, 0x06, 0x26, 0x00, 0x4b, 0x00, 0x00, 0x01, 0x06, 0x00, 0x9e,
-    0x7d, 0xff, 0x00, 0x0b, 0xb6, 0x03, 0x42, 0x1a, 0x01, 0x01, 0x97, 0x56, 0x00, 0x2b, 0x34, 0x00,
-    0xff, 0xff, 0x00, 0x91, 0xff, 0xec, 0x04, 0xd4, 0x07, 0x2b, 0x06, 0x26, 0x00, 0x2b, 0x00, 0x00,
-    0x01, 0x07, 0x00, 0xa1, 0x01, 0x04, 0x01, 0x58, 0x00, 0x0b, 0xb6, 0x01, 0x31, 0x10, 0x01, 0x01,
-    0x5f, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x6d, 0xfe, 0x51, 0x03, 0xd4, 0x05, 0xd4,
-    0x06, 0x26, 0x00, 0x4b, 0x00, 0x00, 0x01, 0x07, 0x00, 0xa1, 0x00, 0x86, 0x00, 0x01, 0x00, 0x0b,
-    0xb6, 0x03, 0x44, 0x1a, 0x01, 0x01, 0x7e, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x91,
-    0xff, 0xec, 0x04, 0xd4, 0x07, 0x0d, 0x06, 0x26, 0x00, 0x2b, 0x00, 0x00, 0x01, 0x07, 0x00, 0xa2,
-    0x01, 0xc9, 0x01, 0x56, 0x00, 0x0b, 0xb6, 0x01, 0x35, 0x10, 0x01, 0x01, 0x82, 0x56, 0x00, 0x2b,
-    0x34, 0x00, 0xff, 0xff, 0x00, 0x6d, 0xfe, 0x51, 0x03, 0xd4, 0x05, 0xb6, 0x04, 0x26, 0x00, 0x4b,
-    0x00, 0x00, 0x01, 0x07, 0x00, 0xa2, 0x01, 0x4b, 0xff, 0xff, 0x00, 0x0b, 0xb6, 0x03, 0x48, 0x1a,
-    0x01, 0x01, 0xa1, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x91, 0xfe, 0x29, 0x04, 0xd4,
-    0x05, 0xc4, 0x06, 0x26, 0x00, 0x2b, 0x00, 0x00, 0x01, 0x07, 0x01, 0xd4, 0x01, 0xdf, 0xfe, 0xdf,
-    0x00, 0x0e, 0xb4, 0x01, 0x35, 0x05, 0x01, 0x01, 0xb8, 0xff, 0x98, 0xb0, 0x56, 0x00, 0x2b, 0x34,
-    0xff, 0xff, 0x00, 0x6d, 0xfe, 0x51, 0x03, 0xd4, 0x06, 0x65, 0x04, 0x26, 0x00, 0x4b, 0x00, 0x00,
-    0x01, 0x07, 0x02, 0x4e, 0x01, 0x5c, 0x00, 0x3b, 0x00, 0x0b, 0xb6, 0x03, 0x3f, 0x1a, 0x01, 0x01,
-    0x98, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0xb9, 0x00, 0x00, 0x04, 0xef, 0x07, 0x37,
-    0x06, 0x26, 0x00, 0x2c, 0x00, 0x00, 0x01, 0x07, 0x00, 0x9e, 0x01, 0x16, 0x01, 0x41, 0x00, 0x0b,
-    0xb6, 0x03, 0x0f, 0x0b, 0x01, 0x01, 0x77, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x9d,
-    0x00, 0x00, 0x03, 0xcd, 0x07, 0x36, 0x06, 0x26, 0x00, 0x4c, 0x00, 0x00, 0x01, 0x07, 0x00, 0x9e,
-    0x00, 0x33, 0x01, 0x40, 0x00, 0x0b, 0xb6, 0x02, 0x1e, 0x03, 0x01, 0x01, 0x26, 0x56, 0x00, 0x2b,
-    0x34, 0x00, 0xff, 0xff, 0xff, 0xc6, 0x00, 0x00, 0x02, 0x67, 0x07, 0x1e, 0x06, 0x26, 0x00, 0x2d,
-    0x00, 0x00, 0x01, 0x07, 0x00, 0xa5, 0xff, 0x5b, 0x01, 0x4a, 0x00, 0x0b, 0xb6, 0x01, 0x12, 0x03,
-    0x01, 0x01, 0x76, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0xff, 0x9b, 0x00, 0x00, 0x02, 0x3c,
-    0x05, 0xd1, 0x06, 0x26, 0x00, 0x8d, 0x00, 0x00, 0x01, 0x07, 0x00, 0xa5, 0xff, 0x30, 0xff, 0xfd,
-    0x00, 0x0b, 0xb6, 0x01, 0x12, 0x03, 0x01, 0x01, 0xa8, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff,
-    0xff, 0xe0, 0x00, 0x00, 0x02, 0x4b, 0x06, 0xeb, 0x06, 0x26, 0x00, 0x2d, 0x00, 0x00, 0x01, 0x07,
-    0x00, 0x70, 0xff, 0x57, 0x01, 0x4a, 0x00, 0x0b, 0xb6, 0x01, 0x06, 0x03, 0x01, 0x01, 0xb1, 0x56,
-    0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0xff, 0xb5, 0x00, 0x00, 0x02, 0x20, 0x05, 0x9d, 0x06, 0x26,
-    0x00, 0x8d, 0x00, 0x00, 0x01, 0x07, 0x00, 0x70, 0xff, 0x2c, 0xff, 0xfd, 0x00, 0x0b, 0xb6, 0x01,
-    0x06, 0x03, 0x01, 0x01, 0xe3, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x00,
-    0x02, 0x32, 0x07, 0x16, 0x06, 0x26, 0x00, 0x2d, 0x00, 0x00, 0x01, 0x07, 0x00, 0xa1, 0xff, 0x66,
-    0x01, 0x43, 0x00, 0x0b, 0xb6, 0x01, 0x09, 0x03, 0x01, 0x01, 0x5e, 0x56, 0x00, 0x2b, 0x34, 0x00,
-    0xff, 0xff, 0xff, 0xc5, 0x00, 0x00, 0x02, 0x07, 0x05, 0xc8, 0x06, 0x26, 0x00, 0x8d, 0x00, 0x00,
-    0x01, 0x07, 0x00, 0xa1, 0xff, 0x3b, 0xff, 0xf6, 0x00, 0x0b, 0xb6, 0x01, 0x09, 0x03, 0x01, 0x01,
-    0x90, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x26, 0xfe, 0x66, 0x01, 0x5f, 0x05, 0xb0,
-    0x06, 0x26, 0x00, 0x2d, 0x00, 0x00, 0x01, 0x06, 0x00, 0xa4, 0xea, 0x05, 0x00, 0x0b, 0xb6, 0x01,
-    0x05, 0x02, 0x00, 0x00, 0x00, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0xff, 0xfb, 0xfe, 0x62,
-    0x01, 0x3b, 0x05, 0xc4, 0x06, 0x26, 0x00, 0x4d, 0x00, 0x00, 0x01, 0x06, 0x00, 0xa4, 0xbf, 0x00,
-    0x00, 0x0b, 0xb6, 0x02, 0x11, 0x02, 0x00, 0x00, 0x00, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff,
-    0x00, 0xc0, 0x00, 0x00, 0x01, 0x65, 0x06, 0xf8, 0x06, 0x26, 0x00, 0x2d, 0x00, 0x00, 0x01, 0x07,
-    0x00, 0xa2, 0x00, 0x2b, 0x01, 0x41, 0x00, 0x0b, 0xb6, 0x01, 0x0d, 0x03, 0x01, 0x01, 0x81, 0x56,
-    0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0xd4, 0xff, 0xec, 0x05, 0xd9, 0x05, 0xb0, 0x04, 0x26,
-    0x00, 0x2d, 0x00, 0x00, 0x00, 0x07, 0x00, 0x2e, 0x02, 0x22, 0x00, 0x00, 0xff, 0xff, 0x00, 0x96,
-    0xfe, 0x4b, 0x03, 0x02, 0x05, 0xc4, 0x04, 0x26, 0x00, 0x4d, 0x00, 0x00, 0x00, 0x07, 0x00, 0x4e,
-    0x01, 0xcc, 0x00, 0x00, 0xff, 0xff, 0x00, 0x48, 0xff, 0xec, 0x04, 0x84, 0x07, 0x22, 0x06, 0x26,
-    0x00, 0x2e, 0x00, 0x00, 0x01, 0x07, 0x00, 0x9e, 0x01, 0xb9, 0x01, 0x2b, 0x00, 0x0b, 0xb6, 0x01,
-    0x17, 0x01, 0x01, 0x01, 0x6a, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0xff, 0x8c, 0xfe, 0x4b,
-    0x02, 0x05, 0x05, 0xcc, 0x06, 0x26, 0x00, 0x9c, 0x00, 0x00, 0x01, 0x07, 0x00, 0x9e, 0xff, 0x39,
-    0xff, 0xd6, 0x00, 0x0b, 0xb6, 0x01, 0x15, 0x00, 0x01, 0x01, 0x82, 0x56, 0x00, 0x2b, 0x34, 0x00,
-    0xff, 0xff, 0x00, 0xb9, 0xfe, 0x91, 0x04, 0xe8, 0x05, 0xb0, 0x04, 0x26, 0x00, 0x2f, 0x00, 0x00,
-    0x01, 0x07, 0x01, 0xd4, 0x01, 0x87, 0xff, 0x48, 0x00, 0x0e, 0xb4, 0x03, 0x17, 0x02, 0x01, 0x00,
-    0xb8, 0xff, 0xe7, 0xb0, 0x56, 0x00, 0x2b, 0x34, 0xff, 0xff, 0x00, 0x9d, 0xfe, 0x8a, 0x03, 0xe3,
-    0x06, 0x00, 0x06, 0x26, 0x00, 0x4f, 0x00, 0x00, 0x01, 0x07, 0x01, 0xd4, 0x01, 0x11, 0xff, 0x40,
-    0x00, 0x0e, 0xb4, 0x03, 0x17, 0x02, 0x01, 0x01, 0xb8, 0xff, 0xd4, 0xb0, 0x56, 0x00, 0x2b, 0x34,
-    0xff, 0xff, 0x00, 0xb1, 0x00, 0x00, 0x04, 0x03, 0x07, 0x19, 0x06, 0x26, 0x00, 0x30, 0x00, 0x00,
-    0x01, 0x07, 0x00, 0x75, 0x00, 0x35, 0x01, 0x19, 0x00, 0x0b, 0xb6, 0x02, 0x08, 0x07, 0x01, 0x01,
-    0x5c, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0xa1, 0x00, 0x00, 0x01, 0xf1, 0x07, 0x8a,
-    0x06, 0x26, 0x00, 0x50, 0x00, 0x00, 0x01, 0x07, 0x00, 0x75, 0x00, 0x24, 0x01, 0x8a, 0x00, 0x0b,
-    0xb6, 0x01, 0x04, 0x03, 0x01, 0x01, 0x71, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0xb9,
-    0xfe, 0x37, 0x04, 0x03, 0x05, 0xb0, 0x04, 0x26, 0x00, 0x30, 0x00, 0x00, 0x01, 0x07, 0x01, 0xd4,
-    0x01, 0x74, 0xfe, 0xee, 0x00, 0x0e, 0xb4, 0x02, 0x11, 0x02, 0x01, 0x01, 0xb8, 0xff, 0x97, 0xb0,
-    0x56, 0x00, 0x2b, 0x34, 0xff, 0xff, 0x00, 0x67, 0xfe, 0x37, 0x01, 0x23, 0x06, 0x00, 0x04, 0x26,
-    0x00, 0x50, 0x00, 0x00, 0x01, 0x07, 0x01, 0xd4, 0xff, 0xed, 0xfe, 0xee, 0x00, 0x0e, 0xb4, 0x01,
-    0x0d, 0x02, 0x01, 0x01, 0xb8, 0xff, 0x97, 0xb0, 0x56, 0x00, 0x2b, 0x34, 0xff, 0xff, 0x00, 0xb9,
-    0x00, 0x00, 0x04, 0x03, 0x05, 0xb0, 0x06, 0x26, 0x00, 0x30, 0x00, 0x00, 0x01, 0x07, 0x01, 0xd4,
-    0x01, 0xae, 0x04, 0xff, 0x00, 0x0b, 0xb6, 0x02, 0x11, 0x07, 0x00, 0x00, 0x01, 0x56, 0x00, 0x2b,
-    0x34, 0x00, 0xff, 0xff, 0x00, 0xab, 0x00, 0x00, 0x02, 0x57, 0x06, 0x01, 0x04, 0x26, 0x00, 0x50,
-    0x00, 0x00, 0x01, 0x07, 0x01, 0xd4, 0x01, 0x22, 0x05, 0x50, 0x00, 0x0b, 0xb6, 0x01, 0x0d, 0x03,
-    0x00, 0x00, 0x02, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0xb9, 0x00, 0x00, 0x04, 0x03,
-    0x05, 0xb0, 0x06, 0x26, 0x00, 0x30, 0x00, 0x00, 0x00, 0x07, 0x00, 0xa2, 0x01, 0xc0, 0xfd, 0xa2,
-    0xff, 0xff, 0x00, 0xab, 0x00, 0x00, 0x02, 0x52, 0x06, 0x00, 0x04, 0x26, 0x00, 0x50, 0x00, 0x00,
-    0x00, 0x07, 0x00, 0xa2, 0x01, 0x18, 0xfd, 0xae, 0xff, 0xff, 0x00, 0xb9, 0x00, 0x00, 0x04, 0xf5,
-    0x07, 0x3b, 0x06, 0x26, 0x00, 0x32, 0x00, 0x00, 0x01, 0x07, 0x00, 0x75, 0x02, 0x13, 0x01, 0x3b,
-    0x00, 0x0b, 0xb6, 0x01, 0x0a, 0x06, 0x01, 0x01, 0x61, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff,
-    0x00, 0x9d, 0x00, 0x00, 0x03, 0xcd, 0x05, 0xff, 0x06, 0x26, 0x00, 0x52, 0x00, 0x00, 0x01, 0x07,
-    0x00, 0x75, 0x01, 0x7c, 0xff, 0xff, 0x00, 0x0b, 0xb6, 0x02, 0x1c, 0x03, 0x01, 0x01, 0xa0, 0x56,
-    0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0xb9, 0xfe, 0x37, 0x04, 0xf5, 0x05, 0xb0, 0x04, 0x26,
-    0x00, 0x32, 0x00, 0x00, 0x01, 0x07, 0x01, 0xd4, 0x01, 0xd8, 0xfe, 0xee, 0x00, 0x0e, 0xb4, 0x01,
-    0x13, 0x05, 0x01, 0x01, 0xb8, 0xff, 0x97, 0xb0, 0x56, 0x00, 0x2b, 0x34, 0xff, 0xff, 0x00, 0x9d,
-    0xfe, 0x37, 0x03, 0xcd, 0x04, 0x4e, 0x04, 0x26, 0x00, 0x52, 0x00, 0x00, 0x01, 0x07, 0x01, 0xd4,
-    0x01, 0x40, 0xfe, 0xee, 0x00, 0x0e, 0xb4, 0x02, 0x25, 0x02, 0x01, 0x01, 0xb8, 0xff, 0x97, 0xb0,
-    0x56, 0x00, 0x2b, 0x34, 0xff, 0xff, 0x00, 0xb9, 0x00, 0x00, 0x04, 0xf5, 0x07, 0x2e, 0x06, 0x26,
-    0x00, 0x32, 0x00, 0x00, 0x01, 0x07, 0x00, 0x9f, 0x01, 0x2f, 0x01, 0x3e, 0x00, 0x0b, 0xb6, 0x01,
-    0x10, 0x09, 0x01, 0x01, 0x6a, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x9d, 0x00, 0x00,
-    0x03, 0xcd, 0x05, 0xf2, 0x06, 0x26, 0x00, 0x52, 0x00, 0x00, 0x01, 0x07, 0x00, 0x9f, 0x00, 0x98,
-    0x00, 0x01, 0x00, 0x0b, 0xb6, 0x02, 0x22, 0x03, 0x01, 0x01, 0xa9, 0x56, 0x00, 0x2b, 0x34, 0x00,
-    0xff, 0xff, 0xff, 0xd0, 0x00, 0x00, 0x03, 0xcd, 0x06, 0x03, 0x06, 0x26, 0x00, 0x52, 0x00, 0x00,
-    0x01, 0x07, 0x01, 0xd4, 0xff, 0x56, 0x05, 0x51, 0x00, 0x0b, 0xb6, 0x02, 0x20, 0x03, 0x01, 0x01,
-    0x3a, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x7e, 0xff, 0xec, 0x04, 0xed, 0x06, 0xf1,
-    0x06, 0x26, 0x00, 0x33, 0x00, 0x00, 0x01, 0x07, 0x00, 0x70, 0x00, 0xf9, 0x01, 0x50, 0x00, 0x0b,
-    0xb6, 0x02, 0x2e, 0x11, 0x01, 0x01, 0x94, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x5b,
-    0xff, 0xec, 0x04, 0x21, 0x05, 0xa9, 0x06, 0x26, 0x00, 0x53, 0x00, 0x00, 0x01, 0x07, 0x00, 0x70,
-    0x00, 0x80, 0x00, 0x08, 0x00, 0x0b, 0xb6, 0x02, 0x2e, 0x06, 0x01, 0x01, 0xd1, 0x56, 0x00, 0x2b,
-    0x34, 0x00, 0xff, 0xff, 0x00, 0x7e, 0xff, 0xec, 0x04, 0xed, 0x07, 0x1c, 0x06, 0x26, 0x00, 0x33,
-    0x00, 0x00, 0x01, 0x07, 0x00, 0xa1, 0x01, 0x08, 0x01, 0x49, 0x00, 0x0b, 0xb6, 0x02, 0x31, 0x11,
-    0x01, 0x01, 0x41, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x5b, 0xff, 0xec, 0x04, 0x21,
-    0x05, 0xd4, 0x06, 0x26, 0x00, 0x53, 0x00, 0x00, 0x01, 0x07, 0x00, 0xa1, 0x00, 0x8f, 0x00, 0x01,
-    0x00, 0x0b, 0xb6, 0x02, 0x31, 0x06, 0x01, 0x01, 0x7e, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff,
-    0x00, 0x7e, 0xff, 0xec, 0x04, 0xed, 0x07, 0x46, 0x06, 0x26, 0x00, 0x33, 0x00, 0x00, 0x01, 0x07,
-    0x00, 0xa6, 0x01, 0x63, 0x01, 0x47, 0x00, 0x0d, 0xb7, 0x03, 0x02, 0x2c, 0x11, 0x01, 0x01, 0x45,
-    0x56, 0x00, 0x2b, 0x34, 0x34, 0x00, 0xff, 0xff, 0x00, 0x5b, 0xff, 0xec, 0x04, 0x21, 0x05, 0xfe,
-    0x06, 0x26, 0x00, 0x53, 0x00, 0x00, 0x01, 0x07, 0x00, 0xa6, 0x00, 0xea, 0xff, 0xff, 0x00, 0x0d,
-    0xb7, 0x03, 0x02, 0x2c, 0x06, 0x01, 0x01, 0x82, 0x56, 0x00, 0x2b, 0x34, 0x34, 0x00, 0xff, 0xff,
-    0x00, 0xb6, 0x00, 0x00, 0x04, 0xbc, 0x07, 0x3b, 0x06, 0x26, 0x00, 0x36, 0x00, 0x00, 0x01, 0x07,
-    0x00, 0x75, 0x01, 0x9d, 0x01, 0x3b, 0x00, 0x0b, 0xb6, 0x02, 0x1e, 0x00, 0x01, 0x01, 0x61, 0x56,
-    0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x9d, 0x00, 0x00, 0x02, 0xa4, 0x05, 0xff, 0x06, 0x26,
-    0x00, 0x56, 0x00, 0x00, 0x01, 0x07, 0x00, 0x75, 0x00, 0xd7, 0xff, 0xff, 0x00, 0x0b, 0xb6, 0x02,
-    0x17, 0x03, 0x01, 0x01, 0xa0, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0xb6, 0xfe, 0x37,
-    0x04, 0xbc, 0x05, 0xb0, 0x04, 0x26, 0x00, 0x36, 0x00, 0x00, 0x01, 0x07, 0x01, 0xd4, 0x01, 0x66,
-    0xfe, 0xee, 0x00, 0x0e, 0xb4, 0x02, 0x27, 0x18, 0x01, 0x01, 0xb8, 0xff, 0x97, 0xb0, 0x56, 0x00,
-    0x2b, 0x34, 0xff, 0xff, 0x00, 0x5e, 0xfe, 0x3c, 0x02, 0x94, 0x04, 0x4e, 0x04, 0x26, 0x00, 0x56,
-    0x00, 0x00, 0x01, 0x07, 0x01, 0xd4, 0xff, 0xe4, 0xfe, 0xf3, 0x00, 0x0e, 0xb4, 0x02, 0x20, 0x02,
-    0x01, 0x01, 0xb8, 0xff, 0x98, 0xb0, 0x56, 0x00, 0x2b, 0x34, 0xff, 0xff, 0x00, 0xb6, 0x00, 0x00,
-    0x04, 0xbc, 0x07, 0x2e, 0x06, 0x26, 0x00, 0x36, 0x00, 0x00, 0x01, 0x07, 0x00, 0x9f, 0x00, 0xb9,
-    0x01, 0x3e, 0x00, 0x0b, 0xb6, 0x02, 0x24, 0x00, 0x01, 0x01, 0x6a, 0x56, 0x00, 0x2b, 0x34, 0x00,
-    0xff, 0xff, 0x00, 0x83, 0x00, 0x00, 0x02, 0xb1, 0x05, 0xf2, 0x06, 0x26, 0x00, 0x56, 0x00, 0x00,
-    0x01, 0x06, 0x00, 0x9f, 0xf3, 0x01, 0x00, 0x0b, 0xb6, 0x02, 0x1d, 0x03, 0x01, 0x01, 0xa9, 0x56,
-    0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x59, 0xff, 0xec, 0x04, 0x6d, 0x07, 0x47, 0x06, 0x26,
-    0x00, 0x37, 0x00, 0x00, 0x01, 0x07, 0x00, 0x75, 0x01, 0xb0, 0x01, 0x47, 0x00, 0x0b, 0xb6, 0x01,
-    0x3a, 0x0f, 0x01, 0x01, 0x4f, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x66, 0xff, 0xec,
-    0x03, 0x9d, 0x05, 0xff, 0x06, 0x26, 0x00, 0x57, 0x00, 0x00, 0x01, 0x07, 0x00, 0x75, 0x01, 0x56,
-    0xff, 0xff, 0x00, 0x0b, 0xb6, 0x01, 0x36, 0x0e, 0x01, 0x01, 0x8c, 0x56, 0x00, 0x2b, 0x34, 0x00,
-    0xff, 0xff, 0x00, 0x59, 0xff, 0xec, 0x04, 0x6d, 0x07, 0x3d, 0x06, 0x26, 0x00, 0x37, 0x00, 0x00,
-    0x01, 0x07, 0x00, 0x9e, 0x00, 0xbf, 0x01, 0x47, 0x00, 0x0b, 0xb6, 0x01, 0x3d, 0x0f, 0x01, 0x01,
-    0x5a, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x66, 0xff, 0xec, 0x03, 0x9d, 0x05, 0xf5,
-    0x06, 0x26, 0x00, 0x57, 0x00, 0x00, 0x01, 0x06, 0x00, 0x9e, 0x65, 0xff, 0x00, 0x0b, 0xb6, 0x01,
-    0x39, 0x0e, 0x01, 0x01, 0x97, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x59, 0xfe, 0x48,
-    0x04, 0x6d, 0x05, 0xc4, 0x06, 0x26, 0x00, 0x37, 0x00, 0x00, 0x01, 0x07, 0x00, 0x79, 0x01, 0xb2,
-    0xff, 0xfb, 0x00, 0x0b, 0xb6, 0x01, 0x3a, 0x2b, 0x00, 0x00, 0x13, 0x56, 0x00, 0x2b, 0x34, 0x00,
-    0xff, 0xff, 0x00, 0x66, 0xfe, 0x46, 0x03, 0x9d, 0x04, 0x4e, 0x06, 0x26, 0x00, 0x57, 0x00, 0x00,
-    0x01, 0x07, 0x00, 0x79, 0x01, 0x55, 0xff, 0xf9, 0x00, 0x0b, 0xb6, 0x01, 0x36, 0x29, 0x00, 0x00,
-    0x0a, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x59, 0xfe, 0x28, 0x04, 0x6d, 0x05, 0xc4,
-    0x06, 0x26, 0x00, 0x37, 0x00, 0x00, 0x01, 0x07, 0x01, 0xd4, 0x01, 0x7b, 0xfe, 0xde, 0x00, 0x0e,
-    0xb4, 0x01, 0x43, 0x2b, 0x01, 0x01, 0xb8, 0xff, 0xa0, 0xb0, 0x56, 0x00, 0x2b, 0x34, 0xff, 0xff,
-    0x00, 0x66, 0xfe, 0x26, 0x03, 0x9d, 0x04, 0x4e, 0x06, 0x26, 0x00, 0x57, 0x00, 0x00, 0x01, 0x07,
-    0x01, 0xd4, 0x01, 0x1e, 0xfe, 0xdc, 0x00, 0x0e, 0xb4, 0x01, 0x3f, 0x29, 0x01, 0x01, 0xb8, 0xff,
-    0x97, 0xb0, 0x56, 0x00, 0x2b, 0x34, 0xff, 0xff, 0x00, 0x59, 0xff, 0xec, 0x04, 0x6d, 0x07, 0x3a,
-    0x06, 0x26, 0x00, 0x37, 0x00, 0x00, 0x01, 0x07, 0x00, 0x9f, 0x00, 0xcc, 0x01, 0x49, 0x00, 0x0b,
-    0xb6, 0x01, 0x40, 0x0f, 0x01, 0x01, 0x58, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x66,
-    0xff, 0xec, 0x03, 0x9d, 0x05, 0xf2, 0x06, 0x26, 0x00, 0x57, 0x00, 0x00, 0x01, 0x06, 0x00, 0x9f,
-    0x72, 0x01, 0x00, 0x0b, 0xb6, 0x01, 0x3c, 0x0e, 0x01, 0x01, 0x95, 0x56, 0x00, 0x2b, 0x34, 0x00,
-    0xff, 0xff, 0x00, 0x35, 0xfe, 0x2d, 0x04, 0x94, 0x05, 0xb0, 0x06, 0x26, 0x00, 0x38, 0x00, 0x00,
-    0x01, 0x07, 0x01, 0xd4, 0x01, 0x6a, 0xfe, 0xe4, 0x00, 0x0e, 0xb4, 0x02, 0x11, 0x02, 0x01, 0x01,
-    0xb8, 0xff, 0x8d, 0xb0, 0x56, 0x00, 0x2b, 0x34, 0xff, 0xff, 0x00, 0x18, 0xfe, 0x2d, 0x02, 0x4a,
-    0x05, 0x50, 0x06, 0x26, 0x00, 0x58, 0x00, 0x00, 0x01, 0x07, 0x01, 0xd4, 0x00, 0xb6, 0xfe, 0xe4,
-    0x00, 0x0e, 0xb4, 0x02, 0x1f, 0x11, 0x01, 0x01, 0xb8, 0xff, 0xa1, 0xb0, 0x56, 0x00, 0x2b, 0x34,
-    0xff, 0xff, 0x00, 0x35, 0xfe, 0x4d, 0x04, 0x94, 0x05, 0xb0, 0x06, 0x26, 0x00, 0x38, 0x00, 0x00,
-    0x01, 0x07, 0x00, 0x79, 0x01, 0xa1, 0x00, 0x00, 0x00, 0x0b, 0xb6, 0x02, 0x08, 0x02, 0x01, 0x00,
-    0x00, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x18, 0xfe, 0x4d, 0x02, 0x7d, 0x05, 0x50,
-    0x06, 0x26, 0x00, 0x58, 0x00, 0x00, 0x01, 0x07, 0x00, 0x79, 0x00, 0xed, 0x00, 0x00, 0x00, 0x0b,
-    0xb6, 0x02, 0x16, 0x11, 0x00, 0x00, 0x14, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x35,
-    0x00, 0x00, 0x04, 0x94, 0x07, 0x2a, 0x06, 0x26, 0x00, 0x38, 0x00, 0x00, 0x01, 0x07, 0x00, 0x9f,
-    0x00, 0xbb, 0x01, 0x39, 0x00, 0x0b, 0xb6, 0x02, 0x0e, 0x03, 0x01, 0x01, 0x69, 0x56, 0x00, 0x2b,
-    0x34, 0x00, 0xff, 0xff, 0x00, 0x18, 0xff, 0xec, 0x02, 0x95, 0x06, 0x49, 0x04, 0x26, 0x00, 0x58,
-    0x00, 0x00, 0x01, 0x07, 0x01, 0xd4, 0x01, 0x61, 0x05, 0x98, 0x00, 0x0e, 0xb4, 0x02, 0x1a, 0x04,
-    0x01, 0x00, 0xb8, 0xff, 0xa8, 0xb0, 0x56, 0x00, 0x2b, 0x34, 0xff, 0xff, 0x00, 0xa3, 0xff, 0xec,
-    0x04, 0xa3, 0x07, 0x19, 0x06, 0x26, 0x00, 0x39, 0x00, 0x00, 0x01, 0x07, 0x00, 0xa5, 0x00, 0xf4,
-    0x01, 0x45, 0x00, 0x0b, 0xb6, 0x01, 0x24, 0x0b, 0x01, 0x01, 0x6b, 0x56, 0x00, 0x2b, 0x34, 0x00,
-    0xff, 0xff, 0x00, 0x99, 0xff, 0xec, 0x03, 0xcb, 0x05, 0xde, 0x06, 0x26, 0x00, 0x59, 0x00, 0x00,
-    0x01, 0x07, 0x00, 0xa5, 0x00, 0x87, 0x00, 0x0a, 0x00, 0x0b, 0xb6, 0x02, 0x2a, 0x11, 0x01, 0x01,
-    0xaa, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0xa3, 0xff, 0xec, 0x04, 0xa3, 0x06, 0xe5,
-    0x06, 0x26, 0x00, 0x39, 0x00, 0x00, 0x01, 0x07, 0x00, 0x70, 0x00, 0xef, 0x01, 0x45, 0x00, 0x0b,
-    0xb6, 0x01, 0x18, 0x0b, 0x01, 0x01, 0xa6, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x99,
-    0xff, 0xec, 0x03, 0xcb, 0x05, 0xaa, 0x06, 0x26, 0x00, 0x59, 0x00, 0x00, 0x01, 0x07, 0x00, 0x70,
-    0x00, 0x83, 0x00, 0x0a, 0x00, 0x0b, 0xb6, 0x02, 0x1e, 0x11, 0x01, 0x01, 0xe5, 0x56, 0x00, 0x2b,
-    0x34, 0x00, 0xff, 0xff, 0x00, 0xa3, 0xff, 0xec, 0x04, 0xa3, 0x07, 0x10, 0x06, 0x26, 0x00, 0x39,
-    0x00, 0x00, 0x01, 0x07, 0x00, 0xa1, 0x00, 0xfe, 0x01, 0x3e, 0x00, 0x0b, 0xb6, 0x01, 0x1b, 0x00,
-    0x01, 0x01, 0x53, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x99, 0xff, 0xec, 0x03, 0xcb,
-    0x05, 0xd5, 0x06, 0x26, 0x00, 0x59, 0x00, 0x00, 0x01, 0x07, 0x00, 0xa1, 0x00, 0x92, 0x00, 0x03,
-    0x00, 0x0b, 0xb6, 0x02, 0x21, 0x11, 0x01, 0x01, 0x92, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff,
-    0x00, 0xa3, 0xff, 0xec, 0x04, 0xa3, 0x07, 0x73, 0x06, 0x26, 0x00, 0x39, 0x00, 0x00, 0x01, 0x07,
-    0x00, 0xa3, 0x01, 0x75, 0x01, 0x41, 0x00, 0x0d, 0xb7, 0x02, 0x01, 0x21, 0x00, 0x01, 0x01, 0x47,
-    0x56, 0x00, 0x2b, 0x34, 0x34, 0x00, 0xff, 0xff, 0x00, 0x99, 0xff, 0xec, 0x03, 0xcb, 0x06, 0x38,
-    0x06, 0x26, 0x00, 0x59, 0x00, 0x00, 0x01, 0x07, 0x00, 0xa3, 0x01, 0x08, 0x00, 0x06, 0x00, 0x0d,
-    0xb7, 0x03, 0x02, 0x27, 0x11, 0x01, 0x01, 0x86, 0x56, 0x00, 0x2b, 0x34, 0x34, 0x00, 0xff, 0xff,
-    0x00, 0xa3, 0xff, 0xec, 0x04, 0xa3, 0x07, 0x3b, 0x06, 0x26, 0x00, 0x39, 0x00, 0x00, 0x01, 0x07,
-    0x00, 0xa6, 0x01, 0x59, 0x01, 0x3b, 0x00, 0x0d, 0xb7, 0x02, 0x01, 0x16, 0x00, 0x01, 0x01, 0x57,
-    0x56, 0x00, 0x2b, 0x34, 0x34, 0x00, 0xff, 0xff, 0x00, 0x99, 0xff, 0xec, 0x03, 0xf6, 0x06, 0x00,
-    0x06, 0x26, 0x00, 0x59, 0x00, 0x00, 0x01, 0x07, 0x00, 0xa6, 0x00, 0xed, 0x00, 0x00, 0x00, 0x0d,
-    0xb7, 0x03, 0x02, 0x1c, 0x11, 0x01, 0x01, 0x96, 0x56, 0x00, 0x2b, 0x34, 0x34, 0x00, 0x00, 0x02,
-    0x00, 0xa3, 0xfe, 0x88, 0x04, 0xa3, 0x05, 0xb0, 0x00, 0x15, 0x00, 0x2b, 0x00, 0x1b, 0x40, 0x0d,
-    0x1e, 0x25, 0x01, 0x0b, 0x02, 0x72, 0x17, 0x16, 0x11, 0x11, 0x06, 0x09, 0x72, 0x00, 0x2b, 0x32,
-    0x12, 0x39, 0x39, 0x2b, 0x32, 0x2f, 0x33, 0x30, 0x31, 0x41, 0x33, 0x11, 0x14, 0x06, 0x06, 0x23,
-    0x22, 0x26, 0x26, 0x35, 0x11, 0x33, 0x11, 0x14, 0x16, 0x16, 0x33, 0x32, 0x36, 0x36, 0x35, 0x03,
-    0x17, 0x0e, 0x02, 0x15, 0x14, 0x16, 0x33, 0x32, 0x36, 0x37, 0x17, 0x06, 0x06, 0x23, 0x22, 0x26,
-    0x35, 0x34, 0x36, 0x36, 0x04, 0x28, 0x7b, 0x8a, 0xe9, 0x8d, 0x91, 0xe8, 0x87, 0x7a, 0x65, 0xb0,
-    0x71, 0x71, 0xb0, 0x64, 0xb8, 0x3b, 0x2d, 0x53, 0x34, 0x25, 0x31, 0x24, 0x34, 0x11, 0x0f, 0x16,
-    0x45, 0x35, 0x4a, 0x5f, 0x38, 0x67, 0x05, 0xb0, 0xfc, 0x26, 0xa3, 0xda, 0x6d, 0x6d, 0xda, 0xa3,
-    0x03, 0xda, 0xfc, 0x26, 0x7f, 0xab, 0x56, 0x56, 0xab, 0x7f, 0xfe, 0x77, 0x26, 0x23, 0x49, 0x50,
-    0x2e, 0x23, 0x31, 0x16, 0x0a, 0x55, 0x0f, 0x1d, 0x55, 0x55, 0x33, 0x64, 0x5d, 0x00, 0x00, 0x03,
-    0x00, 0x99, 0xfe, 0x62, 0x03, 0xdf, 0x04, 0x3a, 0x00, 0x04, 0x00, 0x1b, 0x00, 0x31, 0x00, 0x21,
-    0x40, 0x11, 0x24, 0x2b, 0x0f, 0x72, 0x01, 0x11, 0x06, 0x72, 0x1c, 0x1d, 0x1d, 0x04, 0x04, 0x18,
-    0x0b, 0x0b, 0x72, 0x00, 0x2b, 0x32, 0x32, 0x11, 0x33, 0x11, 0x33, 0x2b, 0x32, 0x2b, 0x32, 0x30,
-    0x31, 0x65, 0x11, 0x33, 0x11, 0x23, 0x13, 0x37, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x35,
-    0x11, 0x33, 0x11, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x36, 0x36, 0x13, 0x17, 0x0e, 0x02, 0x15, 0x14,
-    0x16, 0x33, 0x32, 0x36, 0x37, 0x17, 0x06, 0x06, 0x23, 0x22, 0x26, 0x35, 0x34, 0x36, 0x36, 0x03,
-    0x52, 0x79, 0x74, 0x11, 0x3e, 0x30, 0x66, 0xa2, 0x72, 0x4f, 0x83, 0x5e, 0x33, 0x77, 0x27, 0x45,
-    0x5a, 0x34, 0x84, 0x99, 0x41, 0x23, 0x3a, 0x2d, 0x52, 0x34, 0x24, 0x31, 0x25, 0x34, 0x10, 0x0f,
-    0x16, 0x45, 0x34, 0x4a, 0x60, 0x38, 0x67, 0xfa, 0x03, 0x40, 0xfb, 0xc6, 0x01, 0xc3, 0x02, 0x66,
-    0xad, 0x7f, 0x47, 0x2e, 0x61, 0x9c, 0x6f, 0x02, 0xb4, 0xfd, 0x4a, 0x56, 0x75, 0x45, 0x1e, 0x65,
-    0xa7, 0xfe, 0xc5, 0x27, 0x22, 0x49, 0x51, 0x2e, 0x23, 0x31, 0x16, 0x0b, 0x55, 0x0f, 0x1d, 0x55,
-    0x55, 0x32, 0x65, 0x5d, 0xff, 0xff, 0x00, 0x3d, 0x00, 0x00, 0x06, 0xf7, 0x07, 0x32, 0x06, 0x26,
-    0x00, 0x3b, 0x00, 0x00, 0x01, 0x07, 0x00, 0x9e, 0x01, 0xe9, 0x01, 0x3b, 0x00, 0x0b, 0xb6, 0x04,
-    0x19, 0x15, 0x01, 0x01, 0x6c, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x3f, 0x00, 0x00,
-    0x05, 0xc2, 0x05, 0xf7, 0x06, 0x26, 0x00, 0x5b, 0x00, 0x00, 0x01, 0x07, 0x00, 0x9e, 0x01, 0x49,
-    0x00, 0x00, 0x00, 0x0b, 0xb6, 0x04, 0x19, 0x15, 0x01, 0x01, 0xab, 0x56, 0x00, 0x2b, 0x34, 0x00,
-    0xff, 0xff, 0x00, 0x18, 0x00, 0x00, 0x04, 0xaf, 0x07, 0x2c, 0x06, 0x26, 0x00, 0x3d, 0x00, 0x00,
-    0x01, 0x07, 0x00, 0x9e, 0x00, 0xb1, 0x01, 0x35, 0x00, 0x0b, 0xb6, 0x01, 0x0c, 0x02, 0x01, 0x01,
-    0x6b, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x21, 0xfe, 0x4b, 0x03, 0xb0, 0x05, 0xf7,
-    0x06, 0x26, 0x00, 0x5d, 0x00, 0x00, 0x01, 0x06, 0x00, 0x9e, 0x4d, 0x00, 0x00, 0x0b, 0xb6, 0x02,
-    0x1c, 0x01, 0x01, 0x01, 0xab, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x18, 0x00, 0x00,
-    0x04, 0xaf, 0x06, 0xfb, 0x06, 0x26, 0x00, 0x3d, 0x00, 0x00, 0x01, 0x07, 0x00, 0x6a, 0x00, 0xb1,
-    0x01, 0x35, 0x00, 0x0d, 0xb7, 0x02, 0x01, 0x1e, 0x02, 0x01, 0x01, 0x77, 0x56, 0x00, 0x2b, 0x34,
-    0x34, 0x00, 0xff, 0xff, 0x00, 0x5b, 0x00, 0x00, 0x04, 0x72, 0x07, 0x3b, 0x06, 0x26, 0x00, 0x3e,
-    0x00, 0x00, 0x01, 0x07, 0x00, 0x75, 0x01, 0xa1, 0x01, 0x3b, 0x00, 0x0b, 0xb6, 0x03, 0x0e, 0x0d,
-    0x01, 0x01, 0x61, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x58, 0x00, 0x00, 0x03, 0xab,
-    0x06, 0x00, 0x06, 0x26, 0x00, 0x5e, 0x00, 0x00, 0x01, 0x07, 0x00, 0x75, 0x01, 0x3d, 0x00, 0x00,
-    0x00, 0x0b, 0xb6, 0x03, 0x0e, 0x0d, 0x01, 0x01, 0xa0, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff,
-    0x00, 0x5b, 0x00, 0x00, 0x04, 0x72, 0x06, 0xf3, 0x06, 0x26, 0x00, 0x3e, 0x00, 0x00, 0x01, 0x07,
-    0x00, 0xa2, 0x01, 0x7e, 0x01, 0x3b, 0x00, 0x0b, 0xb6, 0x03, 0x17, 0x08, 0x01, 0x01, 0x76, 0x56,
-    0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x58, 0x00, 0x00, 0x03, 0xab, 0x05, 0xb8, 0x06, 0x26,
-    0x00, 0x5e, 0x00, 0x00, 0x01, 0x07, 0x00, 0xa2, 0x01, 0x1a, 0x00, 0x00, 0x00, 0x0b, 0xb6, 0x03,
-    0x17, 0x08, 0x01, 0x01, 0xb5, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x5b, 0x00, 0x00,
-    0x04, 0x72, 0x07, 0x2e, 0x06, 0x26, 0x00, 0x3e, 0x00, 0x00, 0x01, 0x07, 0x00, 0x9f, 0x00, 0xbd,
-    0x01, 0x3e, 0x00, 0x0b, 0xb6, 0x03, 0x14, 0x08, 0x01, 0x01, 0x6a, 0x56, 0x00, 0x2b, 0x34, 0x00,
-    0xff, 0xff, 0x00, 0x58, 0x00, 0x00, 0x03, 0xab, 0x05, 0xf3, 0x06, 0x26, 0x00, 0x5e, 0x00, 0x00,
-    0x01, 0x06, 0x00, 0x9f, 0x59, 0x03, 0x00, 0x0b, 0xb6, 0x03, 0x14, 0x08, 0x01, 0x01, 0xa9, 0x56,
-    0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x12, 0x00, 0x00, 0x07, 0x20, 0x07, 0x41, 0x06, 0x26,
-    0x00, 0x81, 0x00, 0x00, 0x01, 0x07, 0x00, 0x75, 0x02, 0xf8, 0x01, 0x41, 0x00, 0x0b, 0xb6, 0x06,
-    0x19, 0x03, 0x01, 0x01, 0x6c, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x56, 0xff, 0xec,
-    0x06, 0x7b, 0x06, 0x00, 0x06, 0x26, 0x00, 0x86, 0x00, 0x00, 0x01, 0x07, 0x00, 0x75, 0x02, 0x98,
-    0x00, 0x00, 0x00, 0x0b, 0xb6, 0x03, 0x5f, 0x0f, 0x01, 0x01, 0x8d, 0x56, 0x00, 0x2b, 0x34, 0x00,
-    0xff, 0xff, 0x00, 0x7e, 0xff, 0xac, 0x04, 0xfb, 0x07, 0x7f, 0x06, 0x26, 0x00, 0x83, 0x00, 0x00,
-    0x01, 0x07, 0x00, 0x75, 0x02, 0x06, 0x01, 0x7f, 0x00, 0x0b, 0xb6, 0x03, 0x34, 0x16, 0x01, 0x01,
-    0x96, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x5a, 0xff, 0x74, 0x04, 0x1f, 0x05, 0xfe,
-    0x06, 0x26, 0x00, 0x89, 0x00, 0x00, 0x01, 0x07, 0x00, 0x75, 0x01, 0x48, 0xff, 0xfe, 0x00, 0x0b,
-    0xb6, 0x03, 0x30, 0x0a, 0x01, 0x01, 0x8b, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0xff, 0xd3,
-    0x00, 0x00, 0x04, 0x16, 0x04, 0x8d, 0x06, 0x26, 0x02, 0x4a, 0x00, 0x00, 0x00, 0x07, 0x02, 0x40,
-    0xff, 0x56, 0xff, 0x6d, 0xff, 0xff, 0xff, 0xd3, 0x00, 0x00, 0x04, 0x16, 0x04, 0x8d, 0x06, 0x26,
-    0x02, 0x4a, 0x00, 0x00, 0x00, 0x07, 0x02, 0x40, 0xff, 0x56, 0xff, 0x6d, 0xff, 0xff, 0x00, 0x2c,
-    0x00, 0x00, 0x03, 0xf5, 0x04, 0x8d, 0x06, 0x26, 0x01, 0xf2, 0x00, 0x00, 0x00, 0x06, 0x02, 0x40,
-    0x5a, 0xd9, 0xff, 0xff, 0x00, 0x18, 0x00, 0x00, 0x04, 0x3b, 0x06, 0x1d, 0x06, 0x26, 0x02, 0x4d,
-    0x00, 0x00, 0x01, 0x07, 0x00, 0x44, 0x00, 0xbf, 0x00, 0x1d, 0x00, 0x0b, 0xb6, 0x03, 0x10, 0x07,
-    0x01, 0x01, 0x6b, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x18, 0x00, 0x00, 0x04, 0x3b,
-    0x06, 0x1d, 0x06, 0x26, 0x02, 0x4d, 0x00, 0x00, 0x01, 0x07, 0x00, 0x75, 0x01, 0x68, 0x00, 0x1d,
-    0x00, 0x0b, 0xb6, 0x03, 0x0e, 0x03, 0x01, 0x01, 0x6b, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff,
-    0x00, 0x18, 0x00, 0x00, 0x04, 0x3b, 0x06, 0x13, 0x06, 0x26, 0x02, 0x4d, 0x00, 0x00, 0x01, 0x06,
-    0x00, 0x9e, 0x77, 0x1d, 0x00, 0x0b, 0xb6, 0x03, 0x13, 0x03, 0x01, 0x01, 0x6b, 0x56, 0x00, 0x2b,
-    0x34, 0x00, 0xff, 0xff, 0x00, 0x18, 0x00, 0x00, 0x04, 0x3b, 0x05, 0xfa, 0x06, 0x26, 0x02, 0x4d,
-    0x00, 0x00, 0x01, 0x06, 0x00, 0xa5, 0x75, 0x26, 0x00, 0x0b, 0xb6, 0x03, 0x1b, 0x03, 0x01, 0x01,
-    0x6b, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x18, 0x00, 0x00, 0x04, 0x3b, 0x05, 0xe2,
-    0x06, 0x26, 0x02, 0x4d, 0x00, 0x00, 0x01, 0x07, 0x00, 0x6a, 0x00, 0x77, 0x00, 0x1d, 0x00, 0x0d,
-    0xb7, 0x04, 0x03, 0x17, 0x03, 0x01, 0x01, 0x6b, 0x56, 0x00, 0x2b, 0x34, 0x34, 0x00, 0xff, 0xff,
-    0x00, 0x18, 0x00, 0x00, 0x04, 0x3b, 0x06, 0x55, 0x06, 0x26, 0x02, 0x4d, 0x00, 0x00, 0x01, 0x07,
-    0x00, 0xa3, 0x00, 0xf6, 0x00, 0x22, 0x00, 0x0d, 0xb7, 0x04, 0x03, 0x19, 0x03, 0x01, 0x01, 0x51,
-    0x56, 0x00, 0x2b, 0x34, 0x34, 0x00, 0xff, 0xff, 0x00, 0x18, 0x00, 0x00, 0x04, 0x3b, 0x06, 0x6c,
-    0x06, 0x26, 0x02, 0x4d, 0x00, 0x00, 0x00, 0x07, 0x02, 0x41, 0x00, 0xe2, 0xff, 0xe2, 0xff, 0xff,
-    0x00, 0x6e, 0xfe, 0x47, 0x04, 0x1a, 0x04, 0x9d, 0x06, 0x26, 0x02, 0x4b, 0x00, 0x00, 0x00, 0x07,
-    0x00, 0x79, 0x01, 0x85, 0xff, 0xfa, 0xff, 0xff, 0x00, 0x9b, 0x00, 0x00, 0x03, 0xab, 0x06, 0x1d,
-    0x06, 0x26, 0x02, 0x42, 0x00, 0x00, 0x01, 0x07, 0x00, 0x44, 0x00, 0xaa, 0x00, 0x1d, 0x00, 0x0b,
-    0xb6, 0x04, 0x12, 0x07, 0x01, 0x01, 0x6c, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x9b,
-    0x00, 0x00, 0x03, 0xab, 0x06, 0x1d, 0x06, 0x26, 0x02, 0x42, 0x00, 0x00, 0x01, 0x07, 0x00, 0x75,
-    0x01, 0x53, 0x00, 0x1d, 0x00, 0x0b, 0xb6, 0x04, 0x10, 0x07, 0x01, 0x01, 0x6c, 0x56, 0x00, 0x2b,
-    0x34, 0x00, 0xff, 0xff, 0x00, 0x9b, 0x00, 0x00, 0x03, 0xab, 0x06, 0x13, 0x06, 0x26, 0x02, 0x42,
-    0x00, 0x00, 0x01, 0x06, 0x00, 0x9e, 0x62, 0x1d, 0x00, 0x0b, 0xb6, 0x04, 0x16, 0x07, 0x01, 0x01,
-    0x6c, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x9b, 0x00, 0x00, 0x03, 0xab, 0x05, 0xe2,
-    0x06, 0x26, 0x02, 0x42, 0x00, 0x00, 0x01, 0x06, 0x00, 0x6a, 0x62, 0x1d, 0x00, 0x0d, 0xb7, 0x05,
-    0x04, 0x19, 0x07, 0x01, 0x01, 0x84, 0x56, 0x00, 0x2b, 0x34, 0x34, 0x00, 0xff, 0xff, 0xff, 0xe8,
-    0x00, 0x00, 0x01, 0x37, 0x06, 0x1d, 0x06, 0x26, 0x01, 0xfd, 0x00, 0x00, 0x01, 0x06, 0x00, 0x44,
-    0x81, 0x1d, 0x00, 0x0b, 0xb6, 0x01, 0x06, 0x03, 0x01, 0x01, 0x6b, 0x56, 0x00, 0x2b, 0x34, 0x00,
-    0xff, 0xff, 0x00, 0xa6, 0x00, 0x00, 0x01, 0xf6, 0x06, 0x1d, 0x06, 0x26, 0x01, 0xfd, 0x00, 0x00,
-    0x01, 0x06, 0x00, 0x75, 0x2a, 0x1d, 0x00, 0x0b, 0xb6, 0x01, 0x04, 0x03, 0x01, 0x01, 0x6b, 0x56,
-    0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0xff, 0xda, 0x00, 0x00, 0x02, 0x04, 0x06, 0x13, 0x06, 0x26,
-    0x01, 0xfd, 0x00, 0x00, 0x01, 0x07, 0x00, 0x9e, 0xff, 0x39, 0x00, 0x1d, 0x00, 0x0b, 0xb6, 0x01,
-    0x09, 0x03, 0x01, 0x01, 0x76, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0xff, 0xc2, 0x00, 0x00,
-    0x02, 0x1d, 0x05, 0xe2, 0x06, 0x26, 0x01, 0xfd, 0x00, 0x00, 0x01, 0x07, 0x00, 0x6a, 0xff, 0x39,
-    0x00, 0x1d, 0x00, 0x0d, 0xb7, 0x02, 0x01, 0x0d, 0x03, 0x01, 0x01, 0x84, 0x56, 0x00, 0x2b, 0x34,
-    0x34, 0x00, 0xff, 0xff, 0x00, 0x9b, 0x00, 0x00, 0x04, 0x47, 0x05, 0xfa, 0x06, 0x26, 0x01, 0xf8,
-    0x00, 0x00, 0x01, 0x07, 0x00, 0xa5, 0x00, 0xba, 0x00, 0x26, 0x00, 0x0b, 0xb6, 0x01, 0x18, 0x06,
-    0x01, 0x01, 0x76, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x69, 0xff, 0xf0, 0x04, 0x40,
-    0x06, 0x1d, 0x06, 0x26, 0x01, 0xf7, 0x00, 0x00, 0x01, 0x07, 0x00, 0x44, 0x00, 0xe6, 0x00, 0x1d,
-    0x00, 0x0b, 0xb6, 0x02, 0x2e, 0x11, 0x01, 0x01, 0x5b, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff,
-    0x00, 0x69, 0xff, 0xf0, 0x04, 0x40, 0x06, 0x1d, 0x06, 0x26, 0x01, 0xf7, 0x00, 0x00, 0x01, 0x07,
-    0x00, 0x75, 0x01, 0x8f, 0x00, 0x1d, 0x00, 0x0b, 0xb6, 0x02, 0x2c, 0x11, 0x01, 0x01, 0x5b, 0x56,
-    0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x69, 0xff, 0xf0, 0x04, 0x40, 0x06, 0x13, 0x06, 0x26,
-    0x01, 0xf7, 0x00, 0x00, 0x01, 0x07, 0x00, 0x9e, 0x00, 0x9e, 0x00, 0x1d, 0x00, 0x0b, 0xb6, 0x02,
-    0x31, 0x11, 0x01, 0x01, 0x5b, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x69, 0xff, 0xf0,
-    0x04, 0x40, 0x05, 0xfa, 0x06, 0x26, 0x01, 0xf7, 0x00, 0x00, 0x01, 0x07, 0x00, 0xa5, 0x00, 0x9c,
-    0x00, 0x26, 0x00, 0x0b, 0xb6, 0x02, 0x31, 0x11, 0x01, 0x01, 0x6f, 0x56, 0x00, 0x2b, 0x34, 0x00,
-    0xff, 0xff, 0x00, 0x69, 0xff, 0xf0, 0x04, 0x40, 0x05, 0xe2, 0x06, 0x26, 0x01, 0xf7, 0x00, 0x00,
-    0x01, 0x07, 0x00, 0x6a, 0x00, 0x9e, 0x00, 0x1d, 0x00, 0x0d, 0xb7, 0x03, 0x02, 0x35, 0x11, 0x01,
-    0x01, 0x74, 0x56, 0x00, 0x2b, 0x34, 0x34, 0x00, 0xff, 0xff, 0x00, 0x89, 0xff, 0xf0, 0x04, 0x01,
-    0x06, 0x1d, 0x06, 0x26, 0x01, 0xf1, 0x00, 0x00, 0x01, 0x07, 0x00, 0x44, 0x00, 0xdf, 0x00, 0x1d,
-    0x00, 0x0b, 0xb6, 0x01, 0x18, 0x0b, 0x01, 0x01, 0x6b, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff,
-    0x00, 0x89, 0xff, 0xf0, 0x04, 0x01, 0x06, 0x1d, 0x06, 0x26, 0x01, 0xf1, 0x00, 0x00, 0x01, 0x07,
-    0x00, 0x75, 0x01, 0x88, 0x00, 0x1d, 0x00, 0x0b, 0xb6, 0x01, 0x16, 0x0b, 0x01, 0x01, 0x6b, 0x56,
-    0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x89, 0xff, 0xf0, 0x04, 0x01, 0x06, 0x13, 0x06, 0x26,
-    0x01, 0xf1, 0x00, 0x00, 0x01, 0x07, 0x00, 0x9e, 0x00, 0x97, 0x00, 0x1d, 0x00, 0x0b, 0xb6, 0x01,
-    0x1b, 0x0b, 0x01, 0x01, 0x6b, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x89, 0xff, 0xf0,
-    0x04, 0x01, 0x05, 0xe2, 0x06, 0x26, 0x01, 0xf1, 0x00, 0x00, 0x01, 0x07, 0x00, 0x6a, 0x00, 0x97,
-    0x00, 0x1d, 0x00, 0x0d, 0xb7, 0x02, 0x01, 0x1f, 0x0b, 0x01, 0x01, 0x84, 0x56, 0x00, 0x2b, 0x34,
-    0x34, 0x00, 0xff, 0xff, 0x00, 0x16, 0x00, 0x00, 0x04, 0x0c, 0x06, 0x1d, 0x06, 0x26, 0x01, 0xed,
-    0x00, 0x00, 0x01, 0x07, 0x00, 0x75, 0x01, 0x4d, 0x00, 0x1d, 0x00, 0x0b, 0xb6, 0x03, 0x0e, 0x09,
-    0x01, 0x01, 0x6b, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x18, 0x00, 0x00, 0x04, 0x3b,
-    0x05, 0xc7, 0x06, 0x26, 0x02, 0x4d, 0x00, 0x00, 0x01, 0x06, 0x00, 0x70, 0x71, 0x26, 0x00, 0x0b,
-    0xb6, 0x03, 0x10, 0x03, 0x01, 0x01, 0xb0, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x18,
-    0x00, 0x00, 0x04, 0x3b, 0x05, 0xf2, 0x06, 0x26, 0x02, 0x4d, 0x00, 0x00, 0x01, 0x07, 0x00, 0xa1,
-    0x00, 0x80, 0x00, 0x1f, 0x00, 0x0b, 0xb6, 0x03, 0x13, 0x03, 0x01, 0x01, 0x5d, 0x56, 0x00, 0x2b,
-    0x34, 0x00, 0x00, 0x04, 0x00, 0x18, 0xfe, 0x62, 0x04, 0x41, 0x04, 0x8d, 0x00, 0x04, 0x00, 0x09,
-    0x00, 0x0d, 0x00, 0x23, 0x00, 0x21, 0x40, 0x0f, 0x0d, 0x0c, 0x0c, 0x03, 0x16, 0x1d, 0x08, 0x03,
-    0x7d, 0x0f, 0x0e, 0x05, 0x05, 0x01, 0x12, 0x00, 0x3f, 0x33, 0x11, 0x33, 0x33, 0x3f, 0x33, 0x2f,
-    0x33, 0x12, 0x39, 0x2f, 0x33, 0x30, 0x31, 0x41, 0x01, 0x23, 0x01, 0x33, 0x01, 0x01, 0x27, 0x33,
-    0x01, 0x03, 0x15, 0x21, 0x35, 0x01, 0x17, 0x0e, 0x02, 0x15, 0x14, 0x16, 0x33, 0x32, 0x36, 0x37,
-    0x17, 0x06, 0x06, 0x23, 0x22, 0x26, 0x35, 0x34, 0x36, 0x36, 0x02, 0x2d, 0xfe, 0x67, 0x7c, 0x01,
-    0xda, 0x55, 0x01, 0x79, 0xfe, 0x69, 0x1a, 0x55, 0x01, 0xd7, 0xc8, 0xfd, 0x6d, 0x03, 0x0c, 0x3b,
-    0x2d, 0x53, 0x34, 0x25, 0x31, 0x24, 0x34, 0x11, 0x0f, 0x16, 0x45, 0x35, 0x4a, 0x5f, 0x38, 0x67,
-    0x04, 0x02, 0xfb, 0xfe, 0x04, 0x8d, 0xfb, 0x73, 0x04, 0x04, 0x89, 0xfb, 0x73, 0x01, 0x9e, 0x67,
-    0x67, 0xfe, 0x89, 0x27, 0x22, 0x49, 0x51, 0x2e, 0x23, 0x31, 0x16, 0x0b, 0x55, 0x0f, 0x1d, 0x55,
-    0x55, 0x32, 0x65, 0x5d, 0xff, 0xff, 0x00, 0x6e, 0xff, 0xf0, 0x04, 0x1a, 0x06, 0x1d, 0x06, 0x26,
-    0x02, 0x4b, 0x00, 0x00, 0x01, 0x07, 0x00, 0x75, 0x01, 0x86, 0x00, 0x1d, 0x00, 0x0b, 0xb6, 0x01,
-    0x28, 0x10, 0x01, 0x01, 0x5b, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x6e, 0xff, 0xf0,
-    0x04, 0x1a, 0x06, 0x13, 0x06, 0x26, 0x02, 0x4b, 0x00, 0x00, 0x01, 0x07, 0x00, 0x9e, 0x00, 0x95,
-    0x00, 0x1d, 0x00, 0x0b, 0xb6, 0x01, 0x2d, 0x10, 0x01, 0x01, 0x5b, 0x56, 0x00, 0x2b, 0x34, 0x00,
-    0xff, 0xff, 0x00, 0x6e, 0xff, 0xf0, 0x04, 0x1a, 0x05, 0xd4, 0x06, 0x26, 0x02, 0x4b, 0x00, 0x00,
-    0x01, 0x07, 0x00, 0xa2, 0x01, 0x62, 0x00, 0x1d, 0x00, 0x0b, 0xb6, 0x01, 0x31, 0x10, 0x01, 0x01,
-    0x70, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x6e, 0xff, 0xf0, 0x04, 0x1a, 0x06, 0x10,
-    0x06, 0x26, 0x02, 0x4b, 0x00, 0x00, 0x01, 0x07, 0x00, 0x9f, 0x00, 0xa2, 0x00, 0x1f, 0x00, 0x0b,
-    0xb6, 0x01, 0x2e, 0x10, 0x01, 0x01, 0x64, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x9b,
-    0x00, 0x00, 0x04, 0x16, 0x06, 0x10, 0x06, 0x26, 0x02, 0x4a, 0x00, 0x00, 0x01, 0x06, 0x00, 0x9f,
-    0x51, 0x1f, 0x00, 0x0b, 0xb6, 0x02, 0x24, 0x1d, 0x01, 0x01, 0x74, 0x56, 0x00, 0x2b, 0x34, 0x00,
-    0xff, 0xff, 0x00, 0x9b, 0x00, 0x00, 0x03, 0xab, 0x05, 0xc7, 0x06, 0x26, 0x02, 0x42, 0x00, 0x00,
-    0x01, 0x06, 0x00, 0x70, 0x5c, 0x26, 0x00, 0x0b, 0xb6, 0x04, 0x12, 0x07, 0x01, 0x01, 0xb0, 0x56,
-    0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x9b, 0x00, 0x00, 0x03, 0xab, 0x05, 0xf2, 0x06, 0x26,
-    0x02, 0x42, 0x00, 0x00, 0x01, 0x06, 0x00, 0xa1, 0x6b, 0x1f, 0x00, 0x0b, 0xb6, 0x04, 0x15, 0x07,
-    0x01, 0x01, 0x5e, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x9b, 0x00, 0x00, 0x03, 0xab,
-    0x05, 0xd4, 0x06, 0x26, 0x02, 0x42, 0x00, 0x00, 0x01, 0x07, 0x00, 0xa2, 0x01, 0x30, 0x00, 0x1d,
-    0x00, 0x0b, 0xb6, 0x04, 0x19, 0x07, 0x01, 0x01, 0x80, 0x56, 0x00, 0x2b, 0x34, 0x00, 0x00, 0x05,
-    0x00, 0x9b, 0xfe, 0x62, 0x03, 0xab, 0x04, 0x8d, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x0f,
-    0x00, 0x25, 0x00, 0x23, 0x40, 0x10, 0x18, 0x1f, 0x0b, 0x0a, 0x0a, 0x06, 0x0f, 0x0e, 0x07, 0x7d,
-    0x11, 0x10, 0x10, 0x05, 0x06, 0x12, 0x00, 0x3f, 0x33, 0x33, 0x11, 0x33, 0x3f, 0x33, 0x33, 0x12,
-    0x39, 0x2f, 0x33, 0x2f, 0x33, 0x30, 0x31, 0x65, 0x15, 0x21, 0x35, 0x13, 0x11, 0x23, 0x11, 0x01,
-    0x15, 0x21, 0x35, 0x01, 0x15, 0x21, 0x35, 0x01, 0x17, 0x0e, 0x02, 0x15, 0x14, 0x16, 0x33, 0x32,
-    0x36, 0x37, 0x17, 0x06, 0x06, 0x23, 0x22, 0x26, 0x35, 0x34, 0x36, 0x36, 0x03, 0xab, 0xfd, 0x41,
-    0x26, 0x77, 0x02, 0xb8, 0xfd, 0x99, 0x02, 0xbb, 0xfd, 0x45, 0x02, 0x4e, 0x3a, 0x2d, 0x52, 0x34,
-    0x24, 0x31, 0x25, 0x34, 0x10, 0x0f, 0x16, 0x45, 0x34, 0x4a, 0x60, 0x38, 0x67, 0x67, 0x67, 0x67,
-    0x04, 0x26, 0xfb, 0x73, 0x04, 0x8d, 0xfe, 0x03, 0x67, 0x67, 0x01, 0xfd, 0x68, 0x68, 0xfb, 0x9a,
-    0x27, 0x22, 0x49, 0x51, 0x2e, 0x23, 0x31, 0x16, 0x0b, 0x55, 0x0f, 0x1d, 0x55, 0x55, 0x32, 0x65,
-    0x5d, 0x00, 0xff, 0xff, 0x00, 0x9b, 0x00, 0x00, 0x03, 0xab, 0x06, 0x10, 0x06, 0x26, 0x02, 0x42,
-    0x00, 0x00, 0x01, 0x06, 0x00, 0x9f, 0x6f, 0x1f, 0x00, 0x0b, 0xb6, 0x04, 0x16, 0x07, 0x01, 0x01,
-    0x74, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x79, 0xff, 0xf0, 0x04, 0x2b, 0x06, 0x13,
-    0x06, 0x26, 0x01, 0xff, 0x00, 0x00, 0x01, 0x07, 0x00, 0x9e, 0x00, 0x9d, 0x00, 0x1d, 0x00, 0x0b,
-    0xb6, 0x01, 0x30, 0x10, 0x01, 0x01, 0x66, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x79,
-    0xff, 0xf0, 0x04, 0x2b, 0x05, 0xf2, 0x06, 0x26, 0x01, 0xff, 0x00, 0x00, 0x01, 0x07, 0x00, 0xa1,
-    0x00, 0xa5, 0x00, 0x1f, 0x00, 0x0b, 0xb6, 0x01, 0x30, 0x10, 0x01, 0x01, 0x4d, 0x56, 0x00, 0x2b,
-    0x34, 0x00, 0xff, 0xff, 0x00, 0x79, 0xff, 0xf0, 0x04, 0x2b, 0x05, 0xd4, 0x06, 0x26, 0x01, 0xff,
-    0x00, 0x00, 0x01, 0x07, 0x00, 0xa2, 0x01, 0x6a, 0x00, 0x1d, 0x00, 0x0b, 0xb6, 0x01, 0x34, 0x10,
-    0x01, 0x01, 0x70, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x79, 0xfe, 0x2b, 0x04, 0x2b,
-    0x04, 0x9d, 0x06, 0x26, 0x01, 0xff, 0x00, 0x00, 0x01, 0x07, 0x01, 0xd4, 0x01, 0x64, 0xfe, 0xe1,
-    0x00, 0x0e, 0xb4, 0x01, 0x34, 0x05, 0x01, 0x01, 0xb8, 0xff, 0x99, 0xb0, 0x56, 0x00, 0x2b, 0x34,
-    0xff, 0xff, 0x00, 0x9b, 0x00, 0x00, 0x04, 0x42, 0x06, 0x13, 0x06, 0x26, 0x01, 0xfe, 0x00, 0x00,
-    0x01, 0x07, 0x00, 0x9e, 0x00, 0xb3, 0x00, 0x1d, 0x00, 0x0b, 0xb6, 0x03, 0x11, 0x07, 0x01, 0x01,
-    0x76, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0xff, 0xa1, 0x00, 0x00, 0x02, 0x43, 0x05, 0xfa,
-    0x06, 0x26, 0x01, 0xfd, 0x00, 0x00, 0x01, 0x07, 0x00, 0xa5, 0xff, 0x37, 0x00, 0x26, 0x00, 0x0b,
-    0xb6, 0x01, 0x09, 0x03, 0x01, 0x01, 0x7f, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0xff, 0xbc,
-    0x00, 0x00, 0x02, 0x27, 0x05, 0xc7, 0x06, 0x26, 0x01, 0xfd, 0x00, 0x00, 0x01, 0x07, 0x00, 0x70,
-    0xff, 0x32, 0x00, 0x26, 0x00, 0x0b, 0xb6, 0x01, 0x06, 0x03, 0x01, 0x01, 0xb0, 0x56, 0x00, 0x2b,
-    0x34, 0x00, 0xff, 0xff, 0xff, 0xcc, 0x00, 0x00, 0x02, 0x0d, 0x05, 0xf2, 0x06, 0x26, 0x01, 0xfd,
-    0x00, 0x00, 0x01, 0x07, 0x00, 0xa1, 0xff, 0x41, 0x00, 0x1f, 0x00, 0x0b, 0xb6, 0x01, 0x09, 0x03,
-    0x01, 0x01, 0x5d, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x0a, 0xfe, 0x62, 0x01, 0x43,
-    0x04, 0x8d, 0x06, 0x26, 0x01, 0xfd, 0x00, 0x00, 0x00, 0x06, 0x00, 0xa4, 0xce, 0x00, 0xff, 0xff,
-    0x00, 0x9b, 0x00, 0x00, 0x01, 0x40, 0x05, 0xd4, 0x06, 0x26, 0x01, 0xfd, 0x00, 0x00, 0x01, 0x06,
-    0x00, 0xa2, 0x06, 0x1d, 0x00, 0x0b, 0xb6, 0x01, 0x0d, 0x03, 0x01, 0x01, 0x80, 0x56, 0x00, 0x2b,
-    0x34, 0x00, 0xff, 0xff, 0x00, 0x3c, 0xff, 0xf0, 0x04, 0x08, 0x06, 0x13, 0x06, 0x26, 0x01, 0xfc,
-    0x00, 0x00, 0x01, 0x07, 0x00, 0x9e, 0x01, 0x3d, 0x00, 0x1d, 0x00, 0x0b, 0xb6, 0x01, 0x19, 0x01,
-    0x01, 0x01, 0x76, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x9b, 0xfe, 0x33, 0x04, 0x3e,
-    0x04, 0x8d, 0x06, 0x26, 0x01, 0xfb, 0x00, 0x00, 0x00, 0x07, 0x01, 0xd4, 0x01, 0x1b, 0xfe, 0xea,
-    0xff, 0xff, 0x00, 0x92, 0x00, 0x00, 0x03, 0x76, 0x06, 0x1d, 0x06, 0x26, 0x01, 0xfa, 0x00, 0x00,
-    0x01, 0x06, 0x00, 0x75, 0x16, 0x1d, 0x00, 0x0b, 0xb6, 0x02, 0x08, 0x07, 0x01, 0x01, 0x6b, 0x56,
-    0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x9b, 0xfe, 0x35, 0x03, 0x76, 0x04, 0x8d, 0x06, 0x26,
-    0x01, 0xfa, 0x00, 0x00, 0x01, 0x07, 0x01, 0xd4, 0x01, 0x19, 0xfe, 0xec, 0x00, 0x0e, 0xb4, 0x02,
-    0x11, 0x06, 0x01, 0x01, 0xb8, 0xff, 0x95, 0xb0, 0x56, 0x00, 0x2b, 0x34, 0xff, 0xff, 0x00, 0x9b,
-    0x00, 0x00, 0x03, 0x76, 0x04, 0x8e, 0x06, 0x26, 0x01, 0xfa, 0x00, 0x00, 0x00, 0x07, 0x01, 0xd4,
-    0x01, 0x5b, 0x03, 0xdc, 0xff, 0xff, 0x00, 0x9b, 0x00, 0x00, 0x03, 0x76, 0x04, 0x8d, 0x06, 0x26,
-    0x01, 0xfa, 0x00, 0x00, 0x00, 0x07, 0x00, 0xa2, 0x01, 0x6a, 0xfd, 0x10, 0xff, 0xff, 0x00, 0x9b,
-    0x00, 0x00, 0x04, 0x47, 0x06, 0x1d, 0x06, 0x26, 0x01, 0xf8, 0x00, 0x00, 0x01, 0x07, 0x00, 0x75,
-    0x01, 0xad, 0x00, 0x1d, 0x00, 0x0b, 0xb6, 0x01, 0x0a, 0x06, 0x01, 0x01, 0x6b, 0x56, 0x00, 0x2b,
-    0x34, 0x00, 0xff, 0xff, 0x00, 0x9b, 0xfe, 0x33, 0x04, 0x47, 0x04, 0x8d, 0x06, 0x26, 0x01, 0xf8,
-    0x00, 0x00, 0x00, 0x07, 0x01, 0xd4, 0x01, 0x72, 0xfe, 0xea, 0xff, 0xff, 0x00, 0x9b, 0x00, 0x00,
-    0x04, 0x47, 0x06, 0x10, 0x06, 0x26, 0x01, 0xf8, 0x00, 0x00, 0x01, 0x07, 0x00, 0x9f, 0x00, 0xc9,
-    0x00, 0x1f, 0x00, 0x0b, 0xb6, 0x01, 0x10, 0x06, 0x01, 0x01, 0x74, 0x56, 0x00, 0x2b, 0x34, 0x00,
-    0xff, 0xff, 0x00, 0x69, 0xff, 0xf0, 0x04, 0x40, 0x05, 0xc7, 0x06, 0x26, 0x01, 0xf7, 0x00, 0x00,
-    0x01, 0x07, 0x00, 0x70, 0x00, 0x98, 0x00, 0x26, 0x00, 0x0b, 0xb6, 0x02, 0x2e, 0x11, 0x01, 0x01,
-    0xa0, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x69, 0xff, 0xf0, 0x04, 0x40, 0x05, 0xf2,
-    0x06, 0x26, 0x01, 0xf7, 0x00, 0x00, 0x01, 0x07, 0x00, 0xa1, 0x00, 0xa7, 0x00, 0x1f, 0x00, 0x0b,
-    0xb6, 0x02, 0x31, 0x11, 0x01, 0x01, 0x4d, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x69,
-    0xff, 0xf0, 0x04, 0x40, 0x06, 0x1c, 0x06, 0x26, 0x01, 0xf7, 0x00, 0x00, 0x01, 0x07, 0x00, 0xa6,
-    0x01, 0x02, 0x00, 0x1d, 0x00, 0x0d, 0xb7, 0x03, 0x02, 0x30, 0x11, 0x01, 0x01, 0x51, 0x56, 0x00,
-    0x2b, 0x34, 0x34, 0x00, 0xff, 0xff, 0x00, 0x98, 0x00, 0x00, 0x04, 0x17, 0x06, 0x1d, 0x06, 0x26,
-    0x01, 0xf4, 0x00, 0x00, 0x01, 0x07, 0x00, 0x75, 0x01, 0x45, 0x00, 0x1d, 0x00, 0x0b, 0xb6, 0x02,
-    0x1f, 0x00, 0x01, 0x01, 0x6b, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x98, 0xfe, 0x35,
-    0x04, 0x17, 0x04, 0x8d, 0x06, 0x26, 0x01, 0xf4, 0x00, 0x00, 0x00, 0x07, 0x01, 0xd4, 0x01, 0x10,
-    0xfe, 0xec, 0xff, 0xff, 0x00, 0x98, 0x00, 0x00, 0x04, 0x17, 0x06, 0x10, 0x06, 0x26, 0x01, 0xf4,
-    0x00, 0x00, 0x01, 0x06, 0x00, 0x9f, 0x61, 0x1f, 0x00, 0x0b, 0xb6, 0x02, 0x25, 0x00, 0x01, 0x01,
-    0x74, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x4b, 0xff, 0xf0, 0x03, 0xd4, 0x06, 0x1d,
-    0x06, 0x26, 0x01, 0xf3, 0x00, 0x00, 0x01, 0x07, 0x00, 0x75, 0x01, 0x5c, 0x00, 0x1d, 0x00, 0x0b,
-    0xb6, 0x01, 0x3a, 0x0f, 0x01, 0x01, 0x5b, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x4b,
-    0xff, 0xf0, 0x03, 0xd4, 0x06, 0x13, 0x06, 0x26, 0x01, 0xf3, 0x00, 0x00, 0x01, 0x06, 0x00, 0x9e,
-    0x6b, 0x1d, 0x00, 0x0b, 0xb6, 0x01, 0x3f, 0x0f, 0x01, 0x01, 0x66, 0x56, 0x00, 0x2b, 0x34, 0x00,
-    0xff, 0xff, 0x00, 0x4b, 0xfe, 0x4a, 0x03, 0xd4, 0x04, 0x9d, 0x06, 0x26, 0x01, 0xf3, 0x00, 0x00,
-    0x00, 0x07, 0x00, 0x79, 0x01, 0x60, 0xff, 0xfd, 0xff, 0xff, 0x00, 0x4b, 0xff, 0xf0, 0x03, 0xd4,
-    0x06, 0x10, 0x06, 0x26, 0x01, 0xf3, 0x00, 0x00, 0x01, 0x06, 0x00, 0x9f, 0x78, 0x1f, 0x00, 0x0b,
-    0xb6, 0x01, 0x40, 0x0f, 0x01, 0x01, 0x66, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x2c,
-    0xfe, 0x2f, 0x03, 0xf5, 0x04, 0x8d, 0x06, 0x26, 0x01, 0xf2, 0x00, 0x00, 0x01, 0x07, 0x01, 0xd4,
-    0x01, 0x16, 0xfe, 0xe5, 0x00, 0x0e, 0xb4, 0x02, 0x11, 0x02, 0x01, 0x01, 0xb8, 0xff, 0x90, 0xb0,
-    0x56, 0x00, 0x2b, 0x34, 0xff, 0xff, 0x00, 0x2c, 0x00, 0x00, 0x03, 0xf5, 0x06, 0x10, 0x06, 0x26,
-    0x01, 0xf2, 0x00, 0x00, 0x01, 0x06, 0x00, 0x9f, 0x68, 0x1f, 0x00, 0x0b, 0xb6, 0x02, 0x0e, 0x07,
-    0x01, 0x01, 0x74, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x2c, 0xfe, 0x4f, 0x03, 0xf5,
-    0x04, 0x8d, 0x06, 0x26, 0x01, 0xf2, 0x00, 0x00, 0x00, 0x07, 0x00, 0x79, 0x01, 0x4d, 0x00, 0x02,
-    0xff, 0xff, 0x00, 0x89, 0xff, 0xf0, 0x04, 0x01, 0x05, 0xfa, 0x06, 0x26, 0x01, 0xf1, 0x00, 0x00,
-    0x01, 0x07, 0x00, 0xa5, 0x00, 0x95, 0x00, 0x26, 0x00, 0x0b, 0xb6, 0x01, 0x1b, 0x0b, 0x01, 0x01,
-    0x7f, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x89, 0xff, 0xf0, 0x04, 0x01, 0x05, 0xc7,
-    0x06, 0x26, 0x01, 0xf1, 0x00, 0x00, 0x01, 0x07, 0x00, 0x70, 0x00, 0x90, 0x00, 0x26, 0x00, 0x0b,
-    0xb6, 0x01, 0x18, 0x0b, 0x01, 0x01, 0xb0, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x89,
-    0xff, 0xf0, 0x04, 0x01, 0x05, 0xf2, 0x06, 0x26, 0x01, 0xf1, 0x00, 0x00, 0x01, 0x07, 0x00, 0xa1,
-    0x00, 0x9f, 0x00, 0x1f, 0x00, 0x0b, 0xb6, 0x01, 0x1b, 0x0b, 0x01, 0x01, 0x5d, 0x56, 0x00, 0x2b,
-    0x34, 0x00, 0xff, 0xff, 0x00, 0x89, 0xff, 0xf0, 0x04, 0x01, 0x06, 0x55, 0x06, 0x26, 0x01, 0xf1,
-    0x00, 0x00, 0x01, 0x07, 0x00, 0xa3, 0x01, 0x16, 0x00, 0x22, 0x00, 0x0d, 0xb7, 0x02, 0x01, 0x21,
-    0x0b, 0x01, 0x01, 0x51, 0x56, 0x00, 0x2b, 0x34, 0x34, 0x00, 0xff, 0xff, 0x00, 0x89, 0xff, 0xf0,
-    0x04, 0x03, 0x06, 0x1c, 0x06, 0x26, 0x01, 0xf1, 0x00, 0x00, 0x01, 0x07, 0x00, 0xa6, 0x00, 0xfa,
-    0x00, 0x1d, 0x00, 0x0d, 0xb7, 0x02, 0x01, 0x1a, 0x0b, 0x01, 0x01, 0x61, 0x56, 0x00, 0x2b, 0x34,
-    0x34, 0x00, 0x00, 0x02, 0x00, 0x89, 0xfe, 0x7e, 0x04, 0x01, 0x04, 0x8d, 0x00, 0x15, 0x00, 0x2b,
-    0x00, 0x1a, 0x40, 0x0c, 0x1e, 0x25, 0x17, 0x16, 0x16, 0x11, 0x06, 0x0b, 0x72, 0x0c, 0x00, 0x7d,
-    0x00, 0x3f, 0x32, 0x2b, 0x32, 0x32, 0x11, 0x33, 0x2f, 0x33, 0x30, 0x31, 0x41, 0x33, 0x11, 0x14,
-    0x06, 0x06, 0x23, 0x22, 0x26, 0x26, 0x35, 0x11, 0x33, 0x11, 0x14, 0x16, 0x16, 0x33, 0x32, 0x36,
-    0x36, 0x35, 0x03, 0x17, 0x0e, 0x02, 0x15, 0x14, 0x16, 0x33, 0x32, 0x36, 0x37, 0x17, 0x06, 0x06,
-    0x23, 0x22, 0x26, 0x35, 0x34, 0x36, 0x36, 0x03, 0x89, 0x78, 0x77, 0xc9, 0x7c, 0x7f, 0xc9, 0x74,
-    0x76, 0x54, 0x93, 0x5f, 0x5f, 0x92, 0x53, 0xa0, 0x3a, 0x2d, 0x52, 0x34, 0x24, 0x31, 0x25, 0x34,
-    0x10, 0x0f, 0x16, 0x45, 0x34, 0x4a, 0x60, 0x38, 0x67, 0x04, 0x8d, 0xfc, 0xef, 0x83, 0xb0, 0x59,
-    0x59, 0xb0, 0x83, 0x03, 0x11, 0xfc, 0xef, 0x61, 0x83, 0x42, 0x42, 0x83, 0x61, 0xfe, 0xc7, 0x26,
-    0x23, 0x49, 0x50, 0x2e, 0x23, 0x31, 0x16, 0x0a, 0x55, 0x0f, 0x1d, 0x55, 0x55, 0x33, 0x64, 0x5d,
-    0xff, 0xff, 0x00, 0x33, 0x00, 0x00, 0x05, 0xfb, 0x06, 0x13, 0x06, 0x26, 0x01, 0xef, 0x00, 0x00,
-    0x01, 0x07, 0x00, 0x9e, 0x01, 0x62, 0x00, 0x1d, 0x00, 0x0b, 0xb6, 0x04, 0x1b, 0x0a, 0x01, 0x01,
-    0x76, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x16, 0x00, 0x00, 0x04, 0x0c, 0x06, 0x13,
-    0x06, 0x26, 0x01, 0xed, 0x00, 0x00, 0x01, 0x06, 0x00, 0x9e, 0x5c, 0x1d, 0x00, 0x0b, 0xb6, 0x03,
-    0x13, 0x09, 0x01, 0x01, 0x76, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x16, 0x00, 0x00,
-    0x04, 0x0c, 0x05, 0xe2, 0x06, 0x26, 0x01, 0xed, 0x00, 0x00, 0x01, 0x06, 0x00, 0x6a, 0x5c, 0x1d,
-    0x00, 0x0d, 0xb7, 0x04, 0x03, 0x17, 0x09, 0x01, 0x01, 0x84, 0x56, 0x00, 0x2b, 0x34, 0x34, 0x00,
-    0xff, 0xff, 0x00, 0x4c, 0x00, 0x00, 0x03, 0xd7, 0x06, 0x1d, 0x06, 0x26, 0x01, 0xec, 0x00, 0x00,
-    0x01, 0x07, 0x00, 0x75, 0x01, 0x4d, 0x00, 0x1d, 0x00, 0x0b, 0xb6, 0x03, 0x0e, 0x0d, 0x01, 0x01,
-    0x6b, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x4c, 0x00, 0x00, 0x03, 0xd7, 0x05, 0xd4,
-    0x06, 0x26, 0x01, 0xec, 0x00, 0x00, 0x01, 0x07, 0x00, 0xa2, 0x01, 0x2a, 0x00, 0x1d, 0x00, 0x0b,
-    0xb6, 0x03, 0x17, 0x0d, 0x01, 0x01, 0x80, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x4c,
-    0x00, 0x00, 0x03, 0xd7, 0x06, 0x10, 0x06, 0x26, 0x01, 0xec, 0x00, 0x00, 0x01, 0x06, 0x00, 0x9f,
-    0x69, 0x1f, 0x00, 0x0b, 0xb6, 0x03, 0x14, 0x0d, 0x01, 0x01, 0x74, 0x56, 0x00, 0x2b, 0x34, 0x00,
-    0xff, 0xff, 0x00, 0x1f, 0x00, 0x00, 0x04, 0xe2, 0x06, 0x33, 0x06, 0x26, 0x00, 0x25, 0x00, 0x00,
-    0x01, 0x06, 0x00, 0xae, 0xef, 0xff, 0x00, 0x0e, 0xb4, 0x03, 0x0e, 0x03, 0x00, 0x00, 0xb8, 0xff,
-    0x3e, 0xb0, 0x56, 0x00, 0x2b, 0x34, 0xff, 0xff, 0xff, 0xa2, 0x00, 0x00, 0x04, 0xa6, 0x06, 0x35,
-    0x04, 0x26, 0x00, 0x29, 0x64, 0x00, 0x01, 0x07, 0x00, 0xae, 0xfe, 0xda, 0x00, 0x01, 0x00, 0x0e,
-    0xb4, 0x04, 0x10, 0x07, 0x00, 0x00, 0xb8, 0xff, 0x3f, 0xb0, 0x56, 0x00, 0x2b, 0x34, 0xff, 0xff,
-    0xff, 0xaf, 0x00, 0x00, 0x05, 0x53, 0x06, 0x36, 0x04, 0x26, 0x00, 0x2c, 0x64, 0x00, 0x00, 0x07,
-    0x00, 0xae, 0xfe, 0xe7, 0x00, 0x02, 0xff, 0xff, 0xff, 0xbf, 0x00, 0x00, 0x01, 0xb3, 0x06, 0x33,
-    0x04, 0x26, 0x00, 0x2d, 0x64, 0x00, 0x01, 0x07, 0x00, 0xae, 0xfe, 0xf7, 0xff, 0xff, 0x00, 0x0e,
-    0xb4, 0x01, 0x04, 0x03, 0x00, 0x00, 0xb8, 0xff, 0x41, 0xb0, 0x56, 0x00, 0x2b, 0x34, 0xff, 0xff,
-    0x00, 0x15, 0xff, 0xec, 0x05, 0x01, 0x06, 0x33, 0x04, 0x26, 0x00, 0x33, 0x14, 0x00, 0x01, 0x07,
-    0x00, 0xae, 0xff, 0x4d, 0xff, 0xff, 0x00, 0x0e, 0xb4, 0x02, 0x2c, 0x11, 0x00, 0x00, 0xb8, 0xff,
-    0x2a, 0xb0, 0x56, 0x00, 0x2b, 0x34, 0xff, 0xff, 0xff, 0x96, 0x00, 0x00, 0x05, 0x13, 0x06, 0x33,
-    0x04, 0x26, 0x00, 0x3d, 0x64, 0x00, 0x01, 0x07, 0x00, 0xae, 0xfe, 0xce, 0xff, 0xff, 0x00, 0x0b,
-    0xb6, 0x01, 0x0a, 0x08, 0x00, 0x00, 0x8e, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x20,
-    0x00, 0x00, 0x04, 0xcc, 0x06, 0x33, 0x04, 0x26, 0x00, 0xba, 0x14, 0x00, 0x01, 0x07, 0x00, 0xae,
-    0xff, 0x58, 0xff, 0xff, 0x00, 0x0e, 0xb4, 0x03, 0x36, 0x1d, 0x00, 0x00, 0xb8, 0xff, 0x2a, 0xb0,
-    0x56, 0x00, 0x2b, 0x34, 0xff, 0xff, 0xff, 0xa3, 0xff, 0xf6, 0x02, 0x41, 0x06, 0x6b, 0x06, 0x26,
-    0x00, 0xc3, 0x00, 0x00, 0x01, 0x07, 0x00, 0xaf, 0xff, 0x09, 0xff, 0xea, 0x00, 0x10, 0x40, 0x09,
-    0x03, 0x02, 0x01, 0x2b, 0x00, 0x01, 0x01, 0xa2, 0x56, 0x00, 0x2b, 0x34, 0x34, 0x34, 0xff, 0xff,
-    0x00, 0x1f, 0x00, 0x00, 0x04, 0xe2, 0x05, 0xb0, 0x06, 0x06, 0x00, 0x25, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0xb9, 0x00, 0x00, 0x04, 0x77, 0x05, 0xb0, 0x06, 0x06, 0x00, 0x26, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0xb9, 0x00, 0x00, 0x04, 0x42, 0x05, 0xb0, 0x06, 0x06, 0x00, 0x29, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x5b, 0x00, 0x00, 0x04, 0x72, 0x05, 0xb0, 0x06, 0x06, 0x00, 0x3e, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0xb9, 0x00, 0x00, 0x04, 0xef, 0x05, 0xb0, 0x06, 0x06, 0x00, 0x2c, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0xd4, 0x00, 0x00, 0x01, 0x4f, 0x05, 0xb0, 0x06, 0x06, 0x00, 0x2d, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0xb9, 0x00, 0x00, 0x04, 0xe8, 0x05, 0xb0, 0x06, 0x06, 0x00, 0x2f, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0xb9, 0x00, 0x00, 0x06, 0x33, 0x05, 0xb0, 0x06, 0x06, 0x00, 0x31, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0xb9, 0x00, 0x00, 0x04, 0xf5, 0x05, 0xb0, 0x06, 0x06, 0x00, 0x32, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x7e, 0xff, 0xec, 0x04, 0xed, 0x05, 0xc4, 0x06, 0x06, 0x00, 0x33, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0xb9, 0x00, 0x00, 0x04, 0x93, 0x05, 0xb0, 0x06, 0x06, 0x00, 0x34, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x35, 0x00, 0x00, 0x04, 0x94, 0x05, 0xb0, 0x06, 0x06, 0x00, 0x38, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x18, 0x00, 0x00, 0x04, 0xaf, 0x05, 0xb0, 0x06, 0x06, 0x00, 0x3d, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x38, 0x00, 0x00, 0x04, 0xaf, 0x05, 0xb0, 0x06, 0x06, 0x00, 0x3c, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xe7, 0x00, 0x00, 0x02, 0x42, 0x07, 0x06, 0x06, 0x26, 0x00, 0x2d, 0x00, 0x00, 0x01, 0x07,
-    0x00, 0x6a, 0xff, 0x5d, 0x01, 0x41, 0x00, 0x0d, 0xb7, 0x02, 0x01, 0x19, 0x03, 0x01, 0x01, 0x83,
-    0x56, 0x00, 0x2b, 0x34, 0x34, 0x00, 0xff, 0xff, 0x00, 0x18, 0x00, 0x00, 0x04, 0xaf, 0x06, 0xfb,
-    0x06, 0x26, 0x00, 0x3d, 0x00, 0x00, 0x01, 0x07, 0x00, 0x6a, 0x00, 0xb1, 0x01, 0x35, 0x00, 0x0d,
-    0xb7, 0x02, 0x01, 0x1e, 0x02, 0x01, 0x01, 0x77, 0x56, 0x00, 0x2b, 0x34, 0x34, 0x00, 0xff, 0xff,
-    0x00, 0x6f, 0xff, 0xeb, 0x04, 0x7b, 0x06, 0x08, 0x06, 0x26, 0x00, 0xbb, 0x00, 0x00, 0x01, 0x07,
-    0x00, 0xae, 0x01, 0x74, 0xff, 0xd3, 0x00, 0x0b, 0xb6, 0x03, 0x42, 0x06, 0x01, 0x01, 0x9a, 0x56,
-    0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x6c, 0xff, 0xec, 0x03, 0xe9, 0x06, 0x07, 0x06, 0x26,
-    0x00, 0xbf, 0x00, 0x00, 0x01, 0x07, 0x00, 0xae, 0x01, 0x2a, 0xff, 0xd2, 0x00, 0x0b, 0xb6, 0x02,
-    0x40, 0x2b, 0x01, 0x01, 0x9a, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x9f, 0xfe, 0x61,
-    0x03, 0xd6, 0x06, 0x08, 0x06, 0x26, 0x00, 0xc1, 0x00, 0x00, 0x01, 0x07, 0x00, 0xae, 0x01, 0x45,
-    0xff, 0xd3, 0x00, 0x0b, 0xb6, 0x02, 0x1d, 0x03, 0x01, 0x01, 0xae, 0x56, 0x00, 0x2b, 0x34, 0x00,
-    0xff, 0xff, 0x00, 0xb7, 0xff, 0xf6, 0x02, 0x22, 0x05, 0xf3, 0x06, 0x26, 0x00, 0xc3, 0x00, 0x00,
-    0x01, 0x06, 0x00, 0xae, 0xf8, 0xbe, 0x00, 0x0b, 0xb6, 0x01, 0x12, 0x00, 0x01, 0x01, 0x99, 0x56,
-    0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x9c, 0xff, 0xec, 0x03, 0xcc, 0x06, 0x6b, 0x06, 0x26,
-    0x00, 0xcb, 0x00, 0x00, 0x01, 0x06, 0x00, 0xaf, 0x25, 0xea, 0x00, 0x10, 0x40, 0x09, 0x03, 0x02,
-    0x01, 0x38, 0x0f, 0x01, 0x01, 0xa2, 0x56, 0x00, 0x2b, 0x34, 0x34, 0x34, 0xff, 0xff, 0x00, 0xa3,
-    0x00, 0x00, 0x04, 0x21, 0x04, 0x3a, 0x06, 0x06, 0x00, 0x8e, 0x00, 0x00, 0xff, 0xff, 0x00, 0x5b,
-    0xff, 0xec, 0x04, 0x21, 0x04, 0x4e, 0x06, 0x06, 0x00, 0x53, 0x00, 0x00, 0xff, 0xff, 0x00, 0xa3,
-    0xfe, 0x60, 0x03, 0xd4, 0x04, 0x3a, 0x06, 0x06, 0x00, 0x76, 0x00, 0x00, 0xff, 0xff, 0x00, 0x26,
-    0x00, 0x00, 0x03, 0xb2, 0x04, 0x3a, 0x06, 0x06, 0x00, 0x5a, 0x00, 0x00, 0xff, 0xff, 0x00, 0x40,
-    0xfe, 0x55, 0x04, 0x48, 0x04, 0x46, 0x06, 0x06, 0x02, 0x8a, 0x00, 0x00, 0xff, 0xff, 0xff, 0xca,
-    0xff, 0xf6, 0x02, 0x25, 0x05, 0xaf, 0x06, 0x26, 0x00, 0xc3, 0x00, 0x00, 0x01, 0x07, 0x00, 0x6a,
-    0xff, 0x41, 0xff, 0xea, 0x00, 0x0d, 0xb7, 0x02, 0x01, 0x27, 0x00, 0x01, 0x01, 0xa2, 0x56, 0x00,
-    0x2b, 0x34, 0x34, 0x00, 0xff, 0xff, 0x00, 0x9c, 0xff, 0xec, 0x03, 0xcc, 0x05, 0xaf, 0x06, 0x26,
-    0x00, 0xcb, 0x00, 0x00, 0x01, 0x06, 0x00, 0x6a, 0x5d, 0xea, 0x00, 0x0d, 0xb7, 0x02, 0x01, 0x34,
-    0x0f, 0x01, 0x01, 0xa2, 0x56, 0x00, 0x2b, 0x34, 0x34, 0x00, 0xff, 0xff, 0x00, 0x5b, 0xff, 0xec,
-    0x04, 0x21, 0x06, 0x08, 0x06, 0x26, 0x00, 0x53, 0x00, 0x00, 0x01, 0x07, 0x00, 0xae, 0x01, 0x3e,
-    0xff, 0xd3, 0x00, 0x0b, 0xb6, 0x02, 0x2c, 0x06, 0x01, 0x01, 0x9a, 0x56, 0x00, 0x2b, 0x34, 0x00,
-    0xff, 0xff, 0x00, 0x9c, 0xff, 0xec, 0x03, 0xcc, 0x05, 0xf3, 0x06, 0x26, 0x00, 0xcb, 0x00, 0x00,
-    0x01, 0x07, 0x00, 0xae, 0x01, 0x14, 0xff, 0xbe, 0x00, 0x0b, 0xb6, 0x01, 0x1f, 0x0f, 0x01, 0x01,
-    0x99, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x89, 0xff, 0xec, 0x06, 0x10, 0x05, 0xf1,
-    0x06, 0x26, 0x00, 0xce, 0x00, 0x00, 0x01, 0x07, 0x00, 0xae, 0x02, 0x5e, 0xff, 0xbd, 0x00, 0x0b,
-    0xb6, 0x02, 0x40, 0x1f, 0x01, 0x01, 0x96, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0xb9,
-    0x00, 0x00, 0x04, 0x42, 0x07, 0x06, 0x06, 0x26, 0x00, 0x29, 0x00, 0x00, 0x01, 0x07, 0x00, 0x6a,
-    0x00, 0xb7, 0x01, 0x41, 0x00, 0x0d, 0xb7, 0x05, 0x04, 0x25, 0x07, 0x01, 0x01, 0x83, 0x56, 0x00,
-    0x2b, 0x34, 0x34, 0x00, 0xff, 0xff, 0x00, 0xba, 0x00, 0x00, 0x04, 0x28, 0x07, 0x41, 0x06, 0x26,
-    0x00, 0xb1, 0x00, 0x00, 0x01, 0x07, 0x00, 0x75, 0x01, 0xa6, 0x01, 0x41, 0x00, 0x0b, 0xb6, 0x01,
-    0x06, 0x05, 0x01, 0x01, 0x6c, 0x56, 0x00, 0x2b, 0x34, 0x00, 0x00, 0x01, 0x00, 0x59, 0xff, 0xec,
-    0x04, 0x6d, 0x05, 0xc4, 0x00, 0x39, 0x00, 0x1b, 0x40, 0x0d, 0x0a, 0x26, 0x0f, 0x36, 0x31, 0x2b,
-    0x09, 0x72, 0x18, 0x14, 0x0f, 0x03, 0x72, 0x00, 0x2b, 0xcc, 0x33, 0x2b, 0xcc, 0x33, 0x12, 0x39,
-    0x39, 0x30, 0x31, 0x41, 0x34, 0x2e, 0x02, 0x27, 0x2e, 0x03, 0x35, 0x34, 0x3e, 0x02, 0x33, 0x32,
-    0x16, 0x16, 0x15, 0x23, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x15, 0x14, 0x1e, 0x02, 0x17,
-    0x1e, 0x03, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x33, 0x14, 0x1e, 0x02, 0x33,
-    0x32, 0x36, 0x36, 0x03, 0xf1, 0x28, 0x5b, 0x99, 0x72, 0x6d, 0xb0, 0x7d, 0x42, 0x48, 0x83, 0xb3,
-    0x6b, 0x99, 0xe0, 0x7a, 0x7b, 0x59, 0xa7, 0x78, 0x78, 0xa3, 0x52, 0x28, 0x5a, 0x97, 0x6e, 0x74,
-    0xb3, 0x7c, 0x40, 0x4a, 0x87, 0xb7, 0x6d, 0x61, 0xc0, 0x9f, 0x5f, 0x7b, 0x4a, 0x7b, 0x95, 0x4a,
-    0x73, 0xa9, 0x5d, 0x01, 0x67, 0x3c, 0x5d, 0x4b, 0x41, 0x20, 0x1f, 0x4a, 0x60, 0x81, 0x56, 0x54,
-    0x8a, 0x64, 0x36, 0x74, 0xc5, 0x7a, 0x5f, 0x95, 0x55, 0x49, 0x79, 0x4a, 0x34, 0x57, 0x4b, 0x40,
-    0x1e, 0x1f, 0x4e, 0x66, 0x86, 0x58, 0x59, 0x8d, 0x63, 0x34, 0x32, 0x6a, 0xa5, 0x74, 0x5c, 0x7f,
-    0x4d, 0x23, 0x44, 0x7b, 0xff, 0xff, 0x00, 0xd4, 0x00, 0x00, 0x01, 0x4f, 0x05, 0xb0, 0x06, 0x06,
-    0x00, 0x2d, 0x00, 0x00, 0xff, 0xff, 0xff, 0xe7, 0x00, 0x00, 0x02, 0x42, 0x07, 0x06, 0x06, 0x26,
-    0x00, 0x2d, 0x00, 0x00, 0x01, 0x07, 0x00, 0x6a, 0xff, 0x5d, 0x01, 0x41, 0x00, 0x0d, 0xb7, 0x02,
-    0x01, 0x19, 0x03, 0x01, 0x01, 0x83, 0x56, 0x00, 0x2b, 0x34, 0x34, 0x00, 0xff, 0xff, 0x00, 0x48,
-    0xff, 0xec, 0x03, 0xb7, 0x05, 0xb0, 0x06, 0x06, 0x00, 0x2e, 0x00, 0x00, 0xff, 0xff, 0x00, 0xbd,
-    0x00, 0x00, 0x04, 0xf5, 0x05, 0xb0, 0x06, 0x06, 0x02, 0x46, 0x00, 0x00, 0xff, 0xff, 0x00, 0xb9,
-    0x00, 0x00, 0x04, 0xe8, 0x07, 0x0c, 0x06, 0x26, 0x00, 0x2f, 0x00, 0x00, 0x01, 0x07, 0x00, 0x75,
-    0x01, 0x98, 0x01, 0x0c, 0x00, 0x0b, 0xb6, 0x03, 0x0e, 0x03, 0x01, 0x01, 0x5b, 0x56, 0x00, 0x2b,
-    0x34, 0x00, 0xff, 0xff, 0x00, 0x37, 0xff, 0xeb, 0x04, 0xcd, 0x07, 0x16, 0x06, 0x26, 0x00, 0xde,
-    0x00, 0x00, 0x01, 0x07, 0x00, 0xa1, 0x00, 0xda, 0x01, 0x43, 0x00, 0x0b, 0xb6, 0x02, 0x1e, 0x01,
-    0x01, 0x01, 0x5e, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x1f, 0x00, 0x00, 0x04, 0xe2,
-    0x05, 0xb0, 0x06, 0x06, 0x00, 0x25, 0x00, 0x00, 0xff, 0xff, 0x00, 0xb9, 0x00, 0x00, 0x04, 0x77,
-    0x05, 0xb0, 0x06, 0x06, 0x00, 0x26, 0x00, 0x00, 0xff, 0xff, 0x00, 0xba, 0x00, 0x00, 0x04, 0x28,
-    0x05, 0xb0, 0x06, 0x06, 0x00, 0xb1, 0x00, 0x00, 0xff, 0xff, 0x00, 0xb9, 0x00, 0x00, 0x04, 0x42,
-    0x05, 0xb0, 0x06, 0x06, 0x00, 0x29, 0x00, 0x00, 0xff, 0xff, 0x00, 0xbd, 0x00, 0x00, 0x04, 0xf1,
-    0x07, 0x16, 0x06, 0x26, 0x00, 0xdc, 0x00, 0x00, 0x01, 0x07, 0x00, 0xa1, 0x01, 0x33, 0x01, 0x43,
-    0x00, 0x0b, 0xb6, 0x01, 0x0f, 0x01, 0x01, 0x01, 0x5e, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff,
-    0x00, 0xb9, 0x00, 0x00, 0x06, 0x33, 0x05, 0xb0, 0x06, 0x06, 0x00, 0x31, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0xb9, 0x00, 0x00, 0x04, 0xef, 0x05, 0xb0, 0x06, 0x06, 0x00, 0x2c, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x7e, 0xff, 0xec, 0x04, 0xed, 0x05, 0xc4, 0x06, 0x06, 0x00, 0x33, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0xbd, 0x00, 0x00, 0x04, 0xec, 0x05, 0xb0, 0x06, 0x06, 0x00, 0xb6, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0xb9, 0x00, 0x00, 0x04, 0x93, 0x05, 0xb0, 0x06, 0x06, 0x00, 0x34, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x84, 0xff, 0xec, 0x04, 0xbf, 0x05, 0xc4, 0x06, 0x06, 0x00, 0x27, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x35, 0x00, 0x00, 0x04, 0x94, 0x05, 0xb0, 0x06, 0x06, 0x00, 0x38, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x38, 0x00, 0x00, 0x04, 0xaf, 0x05, 0xb0, 0x06, 0x06, 0x00, 0x3c, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x65, 0xff, 0xec, 0x03, 0xc8, 0x04, 0x4e, 0x06, 0x06, 0x00, 0x45, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x5a, 0xff, 0xec, 0x03, 0xd6, 0x04, 0x4e, 0x06, 0x06, 0x00, 0x49, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0xa5, 0x00, 0x00, 0x03, 0xdc, 0x05, 0xbf, 0x06, 0x26, 0x00, 0xf0, 0x00, 0x00, 0x01, 0x07,
-    0x00, 0xa1, 0x00, 0x91, 0xff, 0xec, 0x00, 0x0b, 0xb6, 0x01, 0x0f, 0x01, 0x01, 0x01, 0x7d, 0x56,
-    0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x5b, 0xff, 0xec, 0x04, 0x21, 0x04, 0x4e, 0x06, 0x06,
-    0x00, 0x53, 0x00, 0x00, 0xff, 0xff, 0x00, 0x9b, 0xfe, 0x60, 0x04, 0x03, 0x04, 0x4e, 0x06, 0x06,
-    0x00, 0x54, 0x00, 0x00, 0x00, 0x01, 0x00, 0x5f, 0xff, 0xec, 0x03, 0xcd, 0x04, 0x4e, 0x00, 0x27,
-    0x00, 0x13, 0x40, 0x09, 0x00, 0x09, 0x1d, 0x14, 0x07, 0x72, 0x09, 0x0b, 0x72, 0x00, 0x2b, 0x2b,
-    0x32, 0x11, 0x33, 0x30, 0x31, 0x65, 0x32, 0x36, 0x36, 0x37, 0x33, 0x0e, 0x02, 0x23, 0x22, 0x2e,
-    0x02, 0x35, 0x35, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x16, 0x16, 0x17, 0x23, 0x2e, 0x02, 0x23, 0x22,
-    0x0e, 0x02, 0x15, 0x15, 0x14, 0x1e, 0x02, 0x02, 0x2d, 0x4b, 0x85, 0x57, 0x06, 0x73, 0x05, 0x74,
-    0xb9, 0x6e, 0x72, 0xad, 0x74, 0x3b, 0x3b, 0x74, 0xac, 0x72, 0x74, 0xb8, 0x70, 0x05, 0x73, 0x05,
-    0x52, 0x86, 0x51, 0x5c, 0x83, 0x51, 0x25, 0x25, 0x51, 0x83, 0x53, 0x3a, 0x70, 0x52, 0x67, 0xa0,
-    0x5c, 0x53, 0x93, 0xc4, 0x72, 0x2a, 0x72, 0xc5, 0x93, 0x52, 0x5e, 0xac, 0x76, 0x57, 0x7e, 0x44,
-    0x47, 0x7b, 0x9d, 0x56, 0x2a, 0x56, 0x9d, 0x7b, 0x47, 0x00, 0xff, 0xff, 0x00, 0x21, 0xfe, 0x4b,
-    0x03, 0xb0, 0x04, 0x3a, 0x06, 0x06, 0x00, 0x5d, 0x00, 0x00, 0xff, 0xff, 0x00, 0x31, 0x00, 0x00,
-    0x03, 0xb3, 0x04, 0x3a, 0x06, 0x06, 0x00, 0x5c, 0x00, 0x00, 0xff, 0xff, 0x00, 0x5a, 0xff, 0xec,
-    0x03, 0xd6, 0x05, 0xc5, 0x06, 0x26, 0x00, 0x49, 0x00, 0x00, 0x01, 0x07, 0x00, 0x6a, 0x00, 0x82,
-    0xff, 0xff, 0x00, 0x0d, 0xb7, 0x02, 0x01, 0x41, 0x0b, 0x01, 0x01, 0xa3, 0x56, 0x00, 0x2b, 0x34,
-    0x34, 0x00, 0xff, 0xff, 0x00, 0xa4, 0x00, 0x00, 0x03, 0x3f, 0x05, 0xea, 0x06, 0x26, 0x00, 0xec,
-    0x00, 0x00, 0x01, 0x07, 0x00, 0x75, 0x00, 0xe7, 0xff, 0xea, 0x00, 0x0b, 0xb6, 0x01, 0x06, 0x05,
-    0x01, 0x01, 0x8b, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x66, 0xff, 0xec, 0x03, 0x9d,
-    0x04, 0x4e, 0x06, 0x06, 0x00, 0x57, 0x00, 0x00, 0xff, 0xff, 0x00, 0x96, 0x00, 0x00, 0x01, 0x3b,
-    0x05, 0xc4, 0x06, 0x06, 0x00, 0x4d, 0x00, 0x00, 0xff, 0xff, 0xff, 0xbc, 0x00, 0x00, 0x02, 0x17,
-    0x05, 0xb9, 0x06, 0x26, 0x00, 0x8d, 0x00, 0x00, 0x01, 0x07, 0x00, 0x6a, 0xff, 0x32, 0xff, 0xf3,
-    0x00, 0x0d, 0xb7, 0x02, 0x01, 0x19, 0x03, 0x01, 0x01, 0xb5, 0x56, 0x00, 0x2b, 0x34, 0x34, 0x00,
-    0xff, 0xff, 0xff, 0x98, 0xfe, 0x4b, 0x01, 0x36, 0x05, 0xc4, 0x06, 0x06, 0x00, 0x4e, 0x00, 0x00,
-    0xff, 0xff, 0x00, 0xa4, 0x00, 0x00, 0x04, 0x16, 0x05, 0xe9, 0x06, 0x26, 0x00, 0xf1, 0x00, 0x00,
-    0x01, 0x07, 0x00, 0x75, 0x01, 0x59, 0xff, 0xe9, 0x00, 0x0b, 0xb6, 0x03, 0x0e, 0x03, 0x01, 0x01,
-    0x8a, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x21, 0xfe, 0x4b, 0x03, 0xb0, 0x05, 0xd5,
-    0x06, 0x26, 0x00, 0x5d, 0x00, 0x00, 0x01, 0x06, 0x00, 0xa1, 0x56, 0x03, 0x00, 0x0b, 0xb6, 0x02,
-    0x1e, 0x01, 0x01, 0x01, 0x92, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x3d, 0x00, 0x00,
-    0x06, 0xf7, 0x07, 0x3b, 0x06, 0x26, 0x00, 0x3b, 0x00, 0x00, 0x01, 0x07, 0x00, 0x44, 0x02, 0x31,
-    0x01, 0x3b, 0x00, 0x0b, 0xb6, 0x04, 0x18, 0x15, 0x01, 0x01, 0x61, 0x56, 0x00, 0x2b, 0x34, 0x00,
-    0xff, 0xff, 0x00, 0x3f, 0x00, 0x00, 0x05, 0xc2, 0x06, 0x00, 0x06, 0x26, 0x00, 0x5b, 0x00, 0x00,
-    0x01, 0x07, 0x00, 0x44, 0x01, 0x91, 0x00, 0x00, 0x00, 0x0b, 0xb6, 0x04, 0x18, 0x15, 0x01, 0x01,
-    0xa0, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x3d, 0x00, 0x00, 0x06, 0xf7, 0x07, 0x3b,
-    0x06, 0x26, 0x00, 0x3b, 0x00, 0x00, 0x01, 0x07, 0x00, 0x75, 0x02, 0xda, 0x01, 0x3b, 0x00, 0x0b,
-    0xb6, 0x04, 0x16, 0x01, 0x01, 0x01, 0x61, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x3f,
-    0x00, 0x00, 0x05, 0xc2, 0x06, 0x00, 0x06, 0x26, 0x00, 0x5b, 0x00, 0x00, 0x01, 0x07, 0x00, 0x75,
-    0x02, 0x3a, 0x00, 0x00, 0x00, 0x0b, 0xb6, 0x04, 0x16, 0x01, 0x01, 0x01, 0xa0, 0x56, 0x00, 0x2b,
-    0x34, 0x00, 0xff, 0xff, 0x00, 0x3d, 0x00, 0x00, 0x06, 0xf7, 0x07, 0x01, 0x06, 0x26, 0x00, 0x3b,
-    0x00, 0x00, 0x01, 0x07, 0x00, 0x6a, 0x01, 0xe9, 0x01, 0x3b, 0x00, 0x0d, 0xb7, 0x05, 0x04, 0x2b,
-    0x15, 0x01, 0x01, 0x78, 0x56, 0x00, 0x2b, 0x34, 0x34, 0x00, 0xff, 0xff, 0x00, 0x3f, 0x00, 0x00,
-    0x05, 0xc2, 0x05, 0xc6, 0x06, 0x26, 0x00, 0x5b, 0x00, 0x00, 0x01, 0x07, 0x00, 0x6a, 0x01, 0x49,
-    0x00, 0x00, 0x00, 0x0d, 0xb7, 0x05, 0x04, 0x2b, 0x15, 0x01, 0x01, 0xb7, 0x56, 0x00, 0x2b, 0x34,
-    0x34, 0x00, 0xff, 0xff, 0x00, 0x18, 0x00, 0x00, 0x04, 0xaf, 0x07, 0x35, 0x06, 0x26, 0x00, 0x3d,
-    0x00, 0x00, 0x01, 0x07, 0x00, 0x44, 0x00, 0xf9, 0x01, 0x35, 0x00, 0x0b, 0xb6, 0x01, 0x0b, 0x02,
-    0x01, 0x01, 0x60, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x21, 0xfe, 0x4b, 0x03, 0xb0,
-    0x06, 0x00, 0x06, 0x26, 0x00, 0x5d, 0x00, 0x00, 0x01, 0x07, 0x00, 0x44, 0x00, 0x95, 0x00, 0x00,
-    0x00, 0x0b, 0xb6, 0x02, 0x1b, 0x01, 0x01, 0x01, 0xa0, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff,
-    0x00, 0x78, 0x04, 0x42, 0x00, 0xe3, 0x06, 0x00, 0x06, 0x06, 0x00, 0x0b, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x90, 0x04, 0x3b, 0x01, 0xe0, 0x06, 0x00, 0x06, 0x06, 0x00, 0x06, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x9a, 0xff, 0xf7, 0x03, 0x0e, 0x05, 0xb0, 0x04, 0x26, 0x00, 0x05, 0x00, 0x00, 0x00, 0x07,
-    0x00, 0x05, 0x01, 0xcf, 0x00, 0x00, 0xff, 0xff, 0xff, 0x8c, 0xfe, 0x4b, 0x02, 0x04, 0x05, 0xc9,
-    0x06, 0x26, 0x00, 0x9c, 0x00, 0x00, 0x01, 0x07, 0x00, 0x9f, 0xff, 0x46, 0xff, 0xd8, 0x00, 0x0b,
-    0xb6, 0x01, 0x18, 0x00, 0x01, 0x01, 0x80, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x3f,
-    0x04, 0x4b, 0x01, 0x12, 0x06, 0x00, 0x06, 0x06, 0x01, 0x85, 0x00, 0x00, 0xff, 0xff, 0x00, 0xb9,
-    0x00, 0x00, 0x06, 0x33, 0x07, 0x3b, 0x06, 0x26, 0x00, 0x31, 0x00, 0x00, 0x01, 0x07, 0x00, 0x75,
-    0x02, 0xb7, 0x01, 0x3b, 0x00, 0x0b, 0xb6, 0x03, 0x11, 0x00, 0x01, 0x01, 0x61, 0x56, 0x00, 0x2b,
-    0x34, 0x00, 0xff, 0xff, 0x00, 0x96, 0x00, 0x00, 0x06, 0x85, 0x05, 0xff, 0x06, 0x26, 0x00, 0x51,
-    0x00, 0x00, 0x01, 0x07, 0x00, 0x75, 0x02, 0xce, 0xff, 0xff, 0x00, 0x0b, 0xb6, 0x03, 0x33, 0x03,
-    0x01, 0x01, 0xa0, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x1f, 0xfe, 0x92, 0x04, 0xe2,
-    0x05, 0xb0, 0x06, 0x26, 0x00, 0x25, 0x00, 0x00, 0x01, 0x07, 0x00, 0xa7, 0x01, 0x5d, 0x00, 0x04,
-    0x00, 0x10, 0xb5, 0x04, 0x03, 0x11, 0x05, 0x01, 0x01, 0xb8, 0xff, 0xb5, 0xb0, 0x56, 0x00, 0x2b,
-    0x34, 0x34, 0xff, 0xff, 0x00, 0x65, 0xfe, 0x92, 0x03, 0xc8, 0x04, 0x4e, 0x06, 0x26, 0x00, 0x45,
-    0x00, 0x00, 0x01, 0x07, 0x00, 0xa7, 0x00, 0xc0, 0x00, 0x04, 0x00, 0x10, 0xb5, 0x03, 0x02, 0x3e,
-    0x31, 0x01, 0x01, 0xb8, 0xff, 0xc9, 0xb0, 0x56, 0x00, 0x2b, 0x34, 0x34, 0xff, 0xff, 0x00, 0xb9,
-    0x00, 0x00, 0x04, 0x42, 0x07, 0x41, 0x06, 0x26, 0x00, 0x29, 0x00, 0x00, 0x01, 0x07, 0x00, 0x44,
-    0x00, 0xff, 0x01, 0x41, 0x00, 0x0b, 0xb6, 0x04, 0x12, 0x07, 0x01, 0x01, 0x6c, 0x56, 0x00, 0x2b,
-    0x34, 0x00, 0xff, 0xff, 0x00, 0xbd, 0x00, 0x00, 0x04, 0xf1, 0x07, 0x41, 0x06, 0x26, 0x00, 0xdc,
-    0x00, 0x00, 0x01, 0x07, 0x00, 0x44, 0x01, 0x72, 0x01, 0x41, 0x00, 0x0b, 0xb6, 0x01, 0x0c, 0x01,
-    0x01, 0x01, 0x6c, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x5a, 0xff, 0xec, 0x03, 0xd6,
-    0x05, 0xff, 0x06, 0x26, 0x00, 0x49, 0x00, 0x00, 0x01, 0x07, 0x00, 0x44, 0x00, 0xca, 0xff, 0xff,
-    0x00, 0x0b, 0xb6, 0x01, 0x2e, 0x0b, 0x01, 0x01, 0x8c, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff,
-    0x00, 0xa5, 0x00, 0x00, 0x03, 0xdc, 0x05, 0xea, 0x06, 0x26, 0x00, 0xf0, 0x00, 0x00, 0x01, 0x07,
-    0x00, 0x44, 0x00, 0xd0, 0xff, 0xea, 0x00, 0x0b, 0xb6, 0x01, 0x0c, 0x01, 0x01, 0x01, 0x8b, 0x56,
-    0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x7b, 0x00, 0x00, 0x05, 0x0e, 0x05, 0xb0, 0x06, 0x06,
-    0x00, 0xb9, 0x00, 0x00, 0xff, 0xff, 0x00, 0x7a, 0xfe, 0x44, 0x05, 0x0b, 0x04, 0x3a, 0x06, 0x06,
-    0x00, 0xcd, 0x00, 0x00, 0xff, 0xff, 0x00, 0x1d, 0x00, 0x00, 0x04, 0xd1, 0x06, 0xe8, 0x06, 0x26,
-    0x01, 0x19, 0x00, 0x00, 0x01, 0x07, 0x00, 0xac, 0x04, 0x3e, 0x00, 0xfa, 0x00, 0x0d, 0xb7, 0x03,
-    0x02, 0x15, 0x13, 0x01, 0x01, 0x2d, 0x56, 0x00, 0x2b, 0x34, 0x34, 0x00, 0xff, 0xff, 0x00, 0x0a,
-    0x00, 0x00, 0x04, 0x02, 0x05, 0xc0, 0x06, 0x26, 0x01, 0x1a, 0x00, 0x00, 0x01, 0x07, 0x00, 0xac,
-    0x03, 0xdb, 0xff, 0xd2, 0x00, 0x0d, 0xb7, 0x03, 0x02, 0x19, 0x17, 0x01, 0x01, 0x7b, 0x56, 0x00,
-    0x2b, 0x34, 0x34, 0x00, 0xff, 0xff, 0x00, 0x5b, 0xfe, 0x4b, 0x08, 0x2c, 0x04, 0x4e, 0x04, 0x26,
-    0x00, 0x53, 0x00, 0x00, 0x00, 0x07, 0x00, 0x5d, 0x04, 0x7c, 0x00, 0x00, 0xff, 0xff, 0x00, 0x7e,
-    0xfe, 0x4b, 0x09, 0x1b, 0x05, 0xc4, 0x04, 0x26, 0x00, 0x33, 0x00, 0x00, 0x00, 0x07, 0x00, 0x5d,
-    0x05, 0x6b, 0x00, 0x00, 0xff, 0xff, 0x00, 0x5a, 0xfe, 0x50, 0x04, 0x65, 0x05, 0xc4, 0x06, 0x26,
-    0x00, 0xdb, 0x00, 0x00, 0x01, 0x07, 0x02, 0x6b, 0x01, 0x9e, 0xff, 0xb3, 0x00, 0x0b, 0xb6, 0x02,
-    0x42, 0x2a, 0x00, 0x00, 0x64, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x63, 0xfe, 0x51,
-    0x03, 0xa3, 0x04, 0x4e, 0x06, 0x26, 0x00, 0xef, 0x00, 0x00, 0x01, 0x07, 0x02, 0x6b, 0x01, 0x35,
-    0xff, 0xb4, 0x00, 0x0b, 0xb6, 0x02, 0x3f, 0x29, 0x00, 0x00, 0x65, 0x56, 0x00, 0x2b, 0x34, 0x00,
-    0xff, 0xff, 0x00, 0x84, 0xfe, 0x50, 0x04, 0xbf, 0x05, 0xc4, 0x06, 0x26, 0x00, 0x27, 0x00, 0x00,
-    0x01, 0x07, 0x02, 0x6b, 0x01, 0xdd, 0xff, 0xb3, 0x00, 0x0b, 0xb6, 0x01, 0x2b, 0x05, 0x00, 0x00,
-    0x64, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x5f, 0xfe, 0x50, 0x03, 0xcd, 0x04, 0x4e,
-    0x06, 0x26, 0x00, 0x47, 0x00, 0x00, 0x01, 0x07, 0x02, 0x6b, 0x01, 0x52, 0xff, 0xb3, 0x00, 0x0b,
-    0xb6, 0x01, 0x2b, 0x09, 0x00, 0x00, 0x64, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x18,
-    0x00, 0x00, 0x04, 0xaf, 0x05, 0xb0, 0x06, 0x06, 0x00, 0x3d, 0x00, 0x00, 0xff, 0xff, 0x00, 0x2d,
-    0xfe, 0x60, 0x03, 0xc4, 0x04, 0x3a, 0x06, 0x06, 0x00, 0xbd, 0x00, 0x00, 0xff, 0xff, 0x00, 0xd4,
-    0x00, 0x00, 0x01, 0x4f, 0x05, 0xb0, 0x06, 0x06, 0x00, 0x2d, 0x00, 0x00, 0xff, 0xff, 0x00, 0x17,
-    0x00, 0x00, 0x06, 0xf5, 0x07, 0x16, 0x06, 0x26, 0x00, 0xda, 0x00, 0x00, 0x01, 0x07, 0x00, 0xa1,
-    0x01, 0xd8, 0x01, 0x43, 0x00, 0x0b, 0xb6, 0x05, 0x1d, 0x0d, 0x01, 0x01, 0x5e, 0x56, 0x00, 0x2b,
-    0x34, 0x00, 0xff, 0xff, 0x00, 0x19, 0x00, 0x00, 0x06, 0x00, 0x05, 0xbf, 0x06, 0x26, 0x00, 0xee,
-    0x00, 0x00, 0x01, 0x07, 0x00, 0xa1, 0x01, 0x5e, 0xff, 0xec, 0x00, 0x0b, 0xb6, 0x05, 0x1d, 0x0d,
-    0x01, 0x01, 0x7d, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0xd4, 0x00, 0x00, 0x01, 0x4f,
-    0x05, 0xb0, 0x06, 0x06, 0x00, 0x2d, 0x00, 0x00, 0xff, 0xff, 0x00, 0x1f, 0x00, 0x00, 0x04, 0xe2,
-    0x07, 0x10, 0x06, 0x26, 0x00, 0x25, 0x00, 0x00, 0x01, 0x07, 0x00, 0xa1, 0x00, 0xd6, 0x01, 0x3e,
-    0x00, 0x0b, 0xb6, 0x03, 0x13, 0x07, 0x01, 0x01, 0x53, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff,
-    0x00, 0x65, 0xff, 0xec, 0x03, 0xc8, 0x05, 0xd5, 0x06, 0x26, 0x00, 0x45, 0x00, 0x00, 0x01, 0x07,
-    0x00, 0xa1, 0x00, 0x98, 0x00, 0x02, 0x00, 0x0b, 0xb6, 0x02, 0x40, 0x0f, 0x01, 0x01, 0x7e, 0x56,
-    0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x1f, 0x00, 0x00, 0x04, 0xe2, 0x07, 0x01, 0x06, 0x26,
-    0x00, 0x25, 0x00, 0x00, 0x01, 0x07, 0x00, 0x6a, 0x00, 0xce, 0x01, 0x3b, 0x00, 0x0d, 0xb7, 0x04,
-    0x03, 0x23, 0x07, 0x01, 0x01, 0x78, 0x56, 0x00, 0x2b, 0x34, 0x34, 0x00, 0xff, 0xff, 0x00, 0x65,
-    0xff, 0xec, 0x03, 0xc8, 0x05, 0xc5, 0x06, 0x26, 0x00, 0x45, 0x00, 0x00, 0x01, 0x07, 0x00, 0x6a,
-    0x00, 0x8f, 0x00, 0x00, 0x00, 0x0d, 0xb7, 0x03, 0x02, 0x50, 0x0f, 0x01, 0x01, 0xa3, 0x56, 0x00,
-    0x2b, 0x34, 0x34, 0x00, 0xff, 0xff, 0x00, 0x12, 0x00, 0x00, 0x07, 0x20, 0x05, 0xb0, 0x06, 0x06,
-    0x00, 0x81, 0x00, 0x00, 0xff, 0xff, 0x00, 0x56, 0xff, 0xec, 0x06, 0x7b, 0x04, 0x4f, 0x06, 0x06,
-    0x00, 0x86, 0x00, 0x00, 0xff, 0xff, 0x00, 0xb9, 0x00, 0x00, 0x04, 0x42, 0x07, 0x16, 0x06, 0x26,
-    0x00, 0x29, 0x00, 0x00, 0x01, 0x07, 0x00, 0xa1, 0x00, 0xbf, 0x01, 0x43, 0x00, 0x0b, 0xb6, 0x04,
-    0x15, 0x07, 0x01, 0x01, 0x5e, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x5a, 0xff, 0xec,
-    0x03, 0xd6, 0x05, 0xd4, 0x06, 0x26, 0x00, 0x49, 0x00, 0x00, 0x01, 0x07, 0x00, 0xa1, 0x00, 0x8a,
-    0x00, 0x02, 0x00, 0x0b, 0xb6, 0x01, 0x31, 0x0b, 0x01, 0x01, 0x7e, 0x56, 0x00, 0x2b, 0x34, 0x00,
-    0xff, 0xff, 0x00, 0x7d, 0xff, 0xec, 0x05, 0x21, 0x06, 0xd8, 0x06, 0x26, 0x01, 0x58, 0x00, 0x00,
-    0x01, 0x07, 0x00, 0x6a, 0x00, 0xe4, 0x01, 0x13, 0x00, 0x0d, 0xb7, 0x02, 0x01, 0x42, 0x00, 0x01,
-    0x01, 0x41, 0x56, 0x00, 0x2b, 0x34, 0x34, 0x00, 0xff, 0xff, 0x00, 0x5d, 0xff, 0xec, 0x03, 0xd1,
-    0x04, 0x4f, 0x06, 0x06, 0x00, 0x9d, 0x00, 0x00, 0xff, 0xff, 0x00, 0x5d, 0xff, 0xec, 0x03, 0xd1,
-    0x05, 0xc5, 0x06, 0x26, 0x00, 0x9d, 0x00, 0x00, 0x01, 0x07, 0x00, 0x6a, 0x00, 0x7f, 0x00, 0x00,
-    0x00, 0x0d, 0xb7, 0x02, 0x01, 0x40, 0x00, 0x01, 0x01, 0xa2, 0x56, 0x00, 0x2b, 0x34, 0x34, 0x00,
-    0xff, 0xff, 0x00, 0x17, 0x00, 0x00, 0x06, 0xf5, 0x07, 0x06, 0x06, 0x26, 0x00, 0xda, 0x00, 0x00,
-    0x01, 0x07, 0x00, 0x6a, 0x01, 0xd0, 0x01, 0x41, 0x00, 0x0d, 0xb7, 0x06, 0x05, 0x2d, 0x0d, 0x01,
-    0x01, 0x83, 0x56, 0x00, 0x2b, 0x34, 0x34, 0x00, 0xff, 0xff, 0x00, 0x19, 0x00, 0x00, 0x06, 0x00,
-    0x05, 0xaf, 0x06, 0x26, 0x00, 0xee, 0x00, 0x00, 0x01, 0x07, 0x00, 0x6a, 0x01, 0x55, 0xff, 0xea,
-    0x00, 0x0d, 0xb7, 0x06, 0x05, 0x2d, 0x0d, 0x01, 0x01, 0xa2, 0x56, 0x00, 0x2b, 0x34, 0x34, 0x00,
-    0xff, 0xff, 0x00, 0x5a, 0xff, 0xec, 0x04, 0x65, 0x07, 0x1b, 0x06, 0x26, 0x00, 0xdb, 0x00, 0x00,
-    0x01, 0x07, 0x00, 0x6a, 0x00, 0xb4, 0x01, 0x56, 0x00, 0x0d, 0xb7, 0x03, 0x02, 0x54, 0x15, 0x01,
-    0x01, 0x84, 0x56, 0x00, 0x2b, 0x34, 0x34, 0x00, 0xff, 0xff, 0x00, 0x63, 0xff, 0xed, 0x03, 0xa3,
-    0x05, 0xc3, 0x06, 0x26, 0x00, 0xef, 0x00, 0x00, 0x01, 0x06, 0x00, 0x6a, 0x4b, 0xfe, 0x00, 0x0d,
-    0xb7, 0x03, 0x02, 0x51, 0x14, 0x01, 0x01, 0xa3, 0x56, 0x00, 0x2b, 0x34, 0x34, 0x00, 0xff, 0xff,
-    0x00, 0xbd, 0x00, 0x00, 0x04, 0xf1, 0x06, 0xeb, 0x06, 0x26, 0x00, 0xdc, 0x00, 0x00, 0x01, 0x07,
-    0x00, 0x70, 0x01, 0x24, 0x01, 0x4a, 0x00, 0x0b, 0xb6, 0x01, 0x0c, 0x08, 0x01, 0x01, 0xb1, 0x56,
-    0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0xa5, 0x00, 0x00, 0x03, 0xdc, 0x05, 0x94, 0x06, 0x26,
-    0x00, 0xf0, 0x00, 0x00, 0x01, 0x07, 0x00, 0x70, 0x00, 0x82, 0xff, 0xf3, 0x00, 0x0b, 0xb6, 0x01,
-    0x0c, 0x08, 0x01, 0x01, 0xd0, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0xbd, 0x00, 0x00,
-    0x04, 0xf1, 0x07, 0x06, 0x06, 0x26, 0x00, 0xdc, 0x00, 0x00, 0x01, 0x07, 0x00, 0x6a, 0x01, 0x2a,
-    0x01, 0x41, 0x00, 0x0d, 0xb7, 0x02, 0x01, 0x1f, 0x01, 0x01, 0x01, 0x83, 0x56, 0x00, 0x2b, 0x34,
-    0x34, 0x00, 0xff, 0xff, 0x00, 0xa5, 0x00, 0x00, 0x03, 0xdc, 0x05, 0xaf, 0x06, 0x26, 0x00, 0xf0,
-    0x00, 0x00, 0x01, 0x07, 0x00, 0x6a, 0x00, 0x88, 0xff, 0xea, 0x00, 0x0d, 0xb7, 0x02, 0x01, 0x1f,
-    0x01, 0x01, 0x01, 0xa2, 0x56, 0x00, 0x2b, 0x34, 0x34, 0x00, 0xff, 0xff, 0x00, 0x7e, 0xff, 0xec,
-    0x04, 0xed, 0x07, 0x0c, 0x06, 0x26, 0x00, 0x33, 0x00, 0x00, 0x01, 0x07, 0x00, 0x6a, 0x00, 0xff,
-    0x01, 0x47, 0x00, 0x0d, 0xb7, 0x03, 0x02, 0x41, 0x11, 0x01, 0x01, 0x66, 0x56, 0x00, 0x2b, 0x34,
-    0x34, 0x00, 0xff, 0xff, 0x00, 0x5b, 0xff, 0xec, 0x04, 0x21, 0x05, 0xc4, 0x06, 0x26, 0x00, 0x53,
-    0x00, 0x00, 0x01, 0x07, 0x00, 0x6a, 0x00, 0x87, 0xff, 0xff, 0x00, 0x0d, 0xb7, 0x03, 0x02, 0x41,
-    0x06, 0x01, 0x01, 0xa3, 0x56, 0x00, 0x2b, 0x34, 0x34, 0x00, 0xff, 0xff, 0x00, 0x76, 0xff, 0xec,
-    0x04, 0xe5, 0x05, 0xc4, 0x06, 0x06, 0x01, 0x17, 0x00, 0x00, 0xff, 0xff, 0x00, 0x5a, 0xff, 0xec,
-    0x04, 0x1f, 0x04, 0x4e, 0x06, 0x06, 0x01, 0x18, 0x00, 0x00, 0xff, 0xff, 0x00, 0x76, 0xff, 0xec,
-    0x04, 0xe5, 0x07, 0x01, 0x06, 0x26, 0x01, 0x17, 0x00, 0x00, 0x01, 0x07, 0x00, 0x6a, 0x01, 0x16,
-    0x01, 0x3c, 0x00, 0x0d, 0xb7, 0x04, 0x03, 0x4f, 0x00, 0x01, 0x01, 0x6a, 0x56, 0x00, 0x2b, 0x34,
-    0x34, 0x00, 0xff, 0xff, 0x00, 0x5a, 0xff, 0xec, 0x04, 0x1f, 0x05, 0xd3, 0x06, 0x26, 0x01, 0x18,
-    0x00, 0x00, 0x01, 0x07, 0x00, 0x6a, 0x00, 0x7b, 0x00, 0x0e, 0x00, 0x0d, 0xb7, 0x04, 0x03, 0x41,
-    0x00, 0x01, 0x01, 0xa5, 0x56, 0x00, 0x2b, 0x34, 0x34, 0x00, 0xff, 0xff, 0x00, 0x8e, 0xff, 0xec,
-    0x04, 0xc9, 0x07, 0x1c, 0x06, 0x26, 0x00, 0xe7, 0x00, 0x00, 0x01, 0x07, 0x00, 0x6a, 0x01, 0x00,
-    0x01, 0x57, 0x00, 0x0d, 0xb7, 0x03, 0x02, 0x42, 0x1e, 0x01, 0x01, 0x85, 0x56, 0x00, 0x2b, 0x34,
-    0x34, 0x00, 0xff, 0xff, 0x00, 0x6f, 0xff, 0xec, 0x03, 0xd4, 0x05, 0xc4, 0x06, 0x26, 0x00, 0xff,
-    0x00, 0x00, 0x01, 0x06, 0x00, 0x6a, 0x6f, 0xff, 0x00, 0x0d, 0xb7, 0x03, 0x02, 0x41, 0x09, 0x01,
-    0x01, 0xa3, 0x56, 0x00, 0x2b, 0x34, 0x34, 0x00, 0xff, 0xff, 0x00, 0x37, 0xff, 0xeb, 0x04, 0xcd,
-    0x06, 0xeb, 0x06, 0x26, 0x00, 0xde, 0x00, 0x00, 0x01, 0x07, 0x00, 0x70, 0x00, 0xcb, 0x01, 0x4a,
-    0x00, 0x0b, 0xb6, 0x02, 0x1b, 0x18, 0x01, 0x01, 0xb1, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff,
-    0x00, 0x21, 0xfe, 0x4b, 0x03, 0xb0, 0x05, 0xaa, 0x06, 0x26, 0x00, 0x5d, 0x00, 0x00, 0x01, 0x06,
-    0x00, 0x70, 0x47, 0x0a, 0x00, 0x0b, 0xb6, 0x02, 0x1b, 0x18, 0x01, 0x01, 0xe5, 0x56, 0x00, 0x2b,
-    0x34, 0x00, 0xff, 0xff, 0x00, 0x37, 0xff, 0xeb, 0x04, 0xcd, 0x07, 0x06, 0x06, 0x26, 0x00, 0xde,
-    0x00, 0x00, 0x01, 0x07, 0x00, 0x6a, 0x00, 0xd2, 0x01, 0x41, 0x00, 0x0d, 0xb7, 0x03, 0x02, 0x2e,
-    0x01, 0x01, 0x01, 0x83, 0x56, 0x00, 0x2b, 0x34, 0x34, 0x00, 0xff, 0xff, 0x00, 0x21, 0xfe, 0x4b,
-    0x03, 0xb0, 0x05, 0xc6, 0x06, 0x26, 0x00, 0x5d, 0x00, 0x00, 0x01, 0x06, 0x00, 0x6a, 0x4d, 0x00,
-    0x00, 0x0d, 0xb7, 0x03, 0x02, 0x2e, 0x01, 0x01, 0x01, 0xb7, 0x56, 0x00, 0x2b, 0x34, 0x34, 0x00,
-    0xff, 0xff, 0x00, 0x37, 0xff, 0xeb, 0x04, 0xcd, 0x07, 0x40, 0x06, 0x26, 0x00, 0xde, 0x00, 0x00,
-    0x01, 0x07, 0x00, 0xa6, 0x01, 0x35, 0x01, 0x41, 0x00, 0x0d, 0xb7, 0x03, 0x02, 0x19, 0x01, 0x01,
-    0x01, 0x62, 0x56, 0x00, 0x2b, 0x34, 0x34, 0x00, 0xff, 0xff, 0x00, 0x21, 0xfe, 0x4b, 0x03, 0xba,
-    0x06, 0x00, 0x06, 0x26, 0x00, 0x5d, 0x00, 0x00, 0x01, 0x07, 0x00, 0xa6, 0x00, 0xb1, 0x00, 0x00,
-    0x00, 0x0d, 0xb7, 0x03, 0x02, 0x19, 0x01, 0x01, 0x01, 0x96, 0x56, 0x00, 0x2b, 0x34, 0x34, 0x00,
-    0xff, 0xff, 0x00, 0xad, 0x00, 0x00, 0x04, 0x9a, 0x07, 0x06, 0x06, 0x26, 0x00, 0xe1, 0x00, 0x00,
-    0x01, 0x07, 0x00, 0x6a, 0x00, 0xfc, 0x01, 0x41, 0x00, 0x0d, 0xb7, 0x03, 0x02, 0x2f, 0x16, 0x01,
-    0x01, 0x83, 0x56, 0x00, 0x2b, 0x34, 0x34, 0x00, 0xff, 0xff, 0x00, 0x6f, 0x00, 0x00, 0x03, 0x9e,
-    0x05, 0xaf, 0x06, 0x26, 0x00, 0xf9, 0x00, 0x00, 0x01, 0x06, 0x00, 0x6a, 0x4a, 0xea, 0x00, 0x0d,
-    0xb7, 0x03, 0x02, 0x2d, 0x03, 0x01, 0x01, 0xa2, 0x56, 0x00, 0x2b, 0x34, 0x34, 0x00, 0xff, 0xff,
-    0x00, 0xba, 0x00, 0x00, 0x05, 0xec, 0x07, 0x06, 0x06, 0x26, 0x00, 0xe5, 0x00, 0x00, 0x01, 0x07,
-    0x00, 0x6a, 0x01, 0xbe, 0x01, 0x41, 0x00, 0x0d, 0xb7, 0x03, 0x02, 0x32, 0x1c, 0x01, 0x01, 0x83,
-    0x56, 0x00, 0x2b, 0x34, 0x34, 0x00, 0xff, 0xff, 0x00, 0xaa, 0x00, 0x00, 0x05, 0x51, 0x05, 0xaf,
-    0x06, 0x26, 0x00, 0xfd, 0x00, 0x00, 0x01, 0x07, 0x00, 0x6a, 0x01, 0x68, 0xff, 0xea, 0x00, 0x0d,
-    0xb7, 0x03, 0x02, 0x32, 0x1c, 0x01, 0x01, 0xa2, 0x56, 0x00, 0x2b, 0x34, 0x34, 0x00, 0xff, 0xff,
-    0x00, 0x6d, 0xff, 0xec, 0x03, 0xd4, 0x06, 0x00, 0x06, 0x06, 0x00, 0x48, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x1f, 0xfe, 0xc9, 0x04, 0xe2, 0x05, 0xb0, 0x06, 0x26, 0x00, 0x25, 0x00, 0x00, 0x01, 0x07,
-    0x00, 0xad, 0x04, 0xdf, 0x00, 0x00, 0x00, 0x0e, 0xb4, 0x03, 0x11, 0x05, 0x01, 0x01, 0xb8, 0xff,
-    0x75, 0xb0, 0x56, 0x00, 0x2b, 0x34, 0xff, 0xff, 0x00, 0x65, 0xfe, 0xc9, 0x03, 0xc8, 0x04, 0x4e,
-    0x06, 0x26, 0x00, 0x45, 0x00, 0x00, 0x01, 0x07, 0x00, 0xad, 0x04, 0x41, 0x00, 0x00, 0x00, 0x0e,
-    0xb4, 0x02, 0x3e, 0x31, 0x01, 0x01, 0xb8, 0xff, 0x89, 0xb0, 0x56, 0x00, 0x2b, 0x34, 0xff, 0xff,
-    0x00, 0x1f, 0x00, 0x00, 0x04, 0xe2, 0x07, 0xb1, 0x06, 0x26, 0x00, 0x25, 0x00, 0x00, 0x01, 0x07,
-    0x00, 0xab, 0x04, 0xc8, 0x01, 0x58, 0x00, 0x0b, 0xb6, 0x03, 0x0f, 0x07, 0x01, 0x01, 0x71, 0x56,
-    0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x65, 0xff, 0xec, 0x03, 0xc8, 0x06, 0x76, 0x06, 0x26,
-    0x00, 0x45, 0x00, 0x00, 0x01, 0x07, 0x00, 0xab, 0x04, 0x8a, 0x00, 0x1c, 0x00, 0x0b, 0xb6, 0x02,
-    0x3c, 0x0f, 0x01, 0x01, 0x9c, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x1f, 0x00, 0x00,
-    0x04, 0xe2, 0x07, 0x9b, 0x06, 0x26, 0x00, 0x25, 0x00, 0x00, 0x01, 0x07, 0x02, 0x51, 0x00, 0xdc,
-    0x01, 0x38, 0x00, 0x0d, 0xb7, 0x04, 0x03, 0x12, 0x07, 0x01, 0x01, 0x61, 0x56, 0x00, 0x2b, 0x34,
-    0x34, 0x00, 0xff, 0xff, 0x00, 0x65, 0xff, 0xec, 0x04, 0x66, 0x06, 0x5f, 0x06, 0x26, 0x00, 0x45,
-    0x00, 0x00, 0x01, 0x07, 0x02, 0x51, 0x00, 0x9d, 0xff, 0xfd, 0x00, 0x0d, 0xb7, 0x03, 0x02, 0x41,
-    0x0f, 0x01, 0x01, 0x8c, 0x56, 0x00, 0x2b, 0x34, 0x34, 0x00, 0xff, 0xff, 0x00, 0x1f, 0x00, 0x00,
-    0x04, 0xe2, 0x07, 0x99, 0x06, 0x26, 0x00, 0x25, 0x00, 0x00, 0x01, 0x07, 0x02, 0x52, 0x00, 0xc9,
-    0x01, 0x3f, 0x00, 0x0d, 0xb7, 0x04, 0x03, 0x10, 0x07, 0x01, 0x01, 0x5c, 0x56, 0x00, 0x2b, 0x34,
-    0x34, 0x00, 0xff, 0xff, 0x00, 0x1b, 0xff, 0xec, 0x03, 0xc8, 0x06, 0x5d, 0x06, 0x26, 0x00, 0x45,
-    0x00, 0x00, 0x01, 0x07, 0x02, 0x52, 0x00, 0x8b, 0x00, 0x04, 0x00, 0x0d, 0xb7, 0x03, 0x02, 0x3d,
-    0x0f, 0x01, 0x01, 0x87, 0x56, 0x00, 0x2b, 0x34, 0x34, 0x00, 0xff, 0xff, 0x00, 0x1f, 0x00, 0x00,
-    0x04, 0xe2, 0x07, 0xea, 0x06, 0x26, 0x00, 0x25, 0x00, 0x00, 0x01, 0x07, 0x02, 0x53, 0x00, 0xcd,
-    0x01, 0x38, 0x00, 0x0d, 0xb7, 0x04, 0x03, 0x13, 0x03, 0x01, 0x01, 0x50, 0x56, 0x00, 0x2b, 0x34,
-    0x34, 0x00, 0xff, 0xff, 0x00, 0x65, 0xff, 0xec, 0x04, 0x45, 0x06, 0xaf, 0x06, 0x26, 0x00, 0x45,
-    0x00, 0x00, 0x01, 0x07, 0x02, 0x53, 0x00, 0x8f, 0xff, 0xfd, 0x00, 0x0d, 0xb7, 0x03, 0x02, 0x40,
-    0x0f, 0x01, 0x01, 0x7b, 0x56, 0x00, 0x2b, 0x34, 0x34, 0x00, 0xff, 0xff, 0x00, 0x1f, 0x00, 0x00,
-    0x04, 0xe2, 0x07, 0xcf, 0x06, 0x26, 0x00, 0x25, 0x00, 0x00, 0x01, 0x07, 0x02, 0x54, 0x00, 0xcb,
-    0x01, 0x1e, 0x00, 0x0d, 0xb7, 0x04, 0x03, 0x10, 0x07, 0x01, 0x01, 0x3a, 0x56, 0x00, 0x2b, 0x34,
-    0x34, 0x00, 0xff, 0xff, 0x00, 0x65, 0xff, 0xec, 0x03, 0xc8, 0x06, 0x94, 0x06, 0x26, 0x00, 0x45,
-    0x00, 0x00, 0x01, 0x07, 0x02, 0x54, 0x00, 0x8d, 0xff, 0xe3, 0x00, 0x0d, 0xb7, 0x03, 0x02, 0x3d,
-    0x0f, 0x01, 0x01, 0x65, 0x56, 0x00, 0x2b, 0x34, 0x34, 0x00, 0xff, 0xff, 0x00, 0x1f, 0xfe, 0xc9,
-    0x04, 0xe2, 0x07, 0x32, 0x06, 0x26, 0x00, 0x25, 0x00, 0x00, 0x00, 0x27, 0x00, 0x9e, 0x00, 0xce,
-    0x01, 0x3b, 0x01, 0x07, 0x00, 0xad, 0x04, 0xdf, 0x00, 0x00, 0x00, 0x17, 0xb4, 0x04, 0x1a, 0x05,
-    0x01, 0x01, 0xb8, 0xff, 0x75, 0xb7, 0x56, 0x03, 0x11, 0x07, 0x01, 0x01, 0x6c, 0x56, 0x00, 0x2b,
-    0x34, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x65, 0xfe, 0xc9, 0x03, 0xc8, 0x05, 0xf6, 0x06, 0x26,
-    0x00, 0x45, 0x00, 0x00, 0x00, 0x27, 0x00, 0x9e, 0x00, 0x8f, 0x00, 0x00, 0x01, 0x07, 0x00, 0xad,
-    0x04, 0x41, 0x00, 0x00, 0x00, 0x17, 0xb4, 0x03, 0x47, 0x31, 0x01, 0x01, 0xb8, 0xff, 0x89, 0xb7,
-    0x56, 0x02, 0x3e, 0x0f, 0x01, 0x01, 0x97, 0x56, 0x00, 0x2b, 0x34, 0x2b, 0x34, 0x00, 0xff, 0xff,
-    0x00, 0x1f, 0x00, 0x00, 0x04, 0xe2, 0x07, 0xb9, 0x06, 0x26, 0x00, 0x25, 0x00, 0x00, 0x01, 0x07,
-    0x02, 0x56, 0x00, 0xcc, 0x01, 0x41, 0x00, 0x0d, 0xb7, 0x04, 0x03, 0x13, 0x07, 0x01, 0x01, 0x5c,
-    0x56, 0x00, 0x2b, 0x34, 0x34, 0x00, 0xff, 0xff, 0x00, 0x65, 0xff, 0xec, 0x03, 0xc8, 0x06, 0x7d,
-    0x06, 0x26, 0x00, 0x45, 0x00, 0x00, 0x01, 0x07, 0x02, 0x56, 0x00, 0x8e, 0x00, 0x05, 0x00, 0x0d,
-    0xb7, 0x03, 0x02, 0x40, 0x0f, 0x01, 0x01, 0x87, 0x56, 0x00, 0x2b, 0x34, 0x34, 0x00, 0xff, 0xff,
-    0x00, 0x1f, 0x00, 0x00, 0x04, 0xe2, 0x07, 0xb9, 0x06, 0x26, 0x00, 0x25, 0x00, 0x00, 0x01, 0x07,
-    0x02, 0x4f, 0x00, 0xcc, 0x01, 0x41, 0x00, 0x0d, 0xb7, 0x04, 0x03, 0x13, 0x07, 0x01, 0x01, 0x5c,
-    0x56, 0x00, 0x2b, 0x34, 0x34, 0x00, 0xff, 0xff, 0x00, 0x65, 0xff, 0xec, 0x03, 0xc8, 0x06, 0x7d,
-    0x06, 0x26, 0x00, 0x45, 0x00, 0x00, 0x01, 0x07, 0x02, 0x4f, 0x00, 0x8e, 0x00, 0x05, 0x00, 0x0d,
-    0xb7, 0x03, 0x02, 0x40, 0x0f, 0x01, 0x01, 0x87, 0x56, 0x00, 0x2b, 0x34, 0x34, 0x00, 0xff, 0xff,
-    0x00, 0x1f, 0x00, 0x00, 0x04, 0xe2, 0x08, 0x39, 0x06, 0x26, 0x00, 0x25, 0x00, 0x00, 0x01, 0x07,
-    0x02, 0x57, 0x00, 0xd0, 0x01, 0x44, 0x00, 0x0d, 0xb7, 0x04, 0x03, 0x13, 0x07, 0x01, 0x01, 0x6e,
-    0x56, 0x00, 0x2b, 0x34, 0x34, 0x00, 0xff, 0xff, 0x00, 0x65, 0xff, 0xec, 0x03, 0xc8, 0x06, 0xfe,
-    0x06, 0x26, 0x00, 0x45, 0x00, 0x00, 0x01, 0x07, 0x02, 0x57, 0x00, 0x92, 0x00, 0x08, 0x00, 0x0d,
-    0xb7, 0x03, 0x02, 0x40, 0x0f, 0x01, 0x01, 0x99, 0x56, 0x00, 0x2b, 0x34, 0x34, 0x00, 0xff, 0xff,
-    0x00, 0x1f, 0x00, 0x00, 0x04, 0xe2, 0x07, 0xfa, 0x06, 0x26, 0x00, 0x25, 0x00, 0x00, 0x01, 0x07,
-    0x02, 0x6a, 0x00, 0xd0, 0x01, 0x4c, 0x00, 0x0d, 0xb7, 0x04, 0x03, 0x13, 0x07, 0x01, 0x01, 0x6f,
-    0x56, 0x00, 0x2b, 0x34, 0x34, 0x00, 0xff, 0xff, 0x00, 0x65, 0xff, 0xec, 0x03, 0xc8, 0x06, 0xbe,
-    0x06, 0x26, 0x00, 0x45, 0x00, 0x00, 0x01, 0x07, 0x02, 0x6a, 0x00, 0x92, 0x00, 0x10, 0x00, 0x0d,
-    0xb7, 0x03, 0x02, 0x40, 0x0f, 0x01, 0x01, 0x9a, 0x56, 0x00, 0x2b, 0x34, 0x34, 0x00, 0xff, 0xff,
-    0x00, 0x1f, 0xfe, 0xc9, 0x04, 0xe2, 0x07, 0x10, 0x06, 0x26, 0x00, 0x25, 0x00, 0x00, 0x00, 0x27,
-    0x00, 0xa1, 0x00, 0xd6, 0x01, 0x3e, 0x01, 0x07, 0x00, 0xad, 0x04, 0xdf, 0x00, 0x00, 0x00, 0x17,
-    0xb4, 0x04, 0x20, 0x05, 0x01, 0x01, 0xb8, 0xff, 0x75, 0xb7, 0x56, 0x03, 0x13, 0x07, 0x01, 0x01,
-    0x53, 0x56, 0x00, 0x2b, 0x34, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x65, 0xfe, 0xc9, 0x03, 0xc8,
-    0x05, 0xd5, 0x06, 0x26, 0x00, 0x45, 0x00, 0x00, 0x00, 0x27, 0x00, 0xa1, 0x00, 0x98, 0x00, 0x02,
-    0x01, 0x07, 0x00, 0xad, 0x04, 0x41, 0x00, 0x00, 0x00, 0x17, 0xb4, 0x03, 0x4d, 0x31, 0x01, 0x01,
-    0xb8, 0xff, 0x89, 0xb7, 0x56, 0x02, 0x40, 0x0f, 0x01, 0x01, 0x7e, 0x56, 0x00, 0x2b, 0x34, 0x2b,
-    0x34, 0x00, 0xff, 0xff, 0x00, 0xb9, 0xfe, 0xd3, 0x04, 0x42, 0x05, 0xb0, 0x06, 0x26, 0x00, 0x29,
-    0x00, 0x00, 0x01, 0x07, 0x00, 0xad, 0x04, 0xb4, 0x00, 0x0a, 0x00, 0x0e, 0xb4, 0x04, 0x13, 0x02,
-    0x01, 0x01, 0xb8, 0xff, 0x7f, 0xb0, 0x56, 0x00, 0x2b, 0x34, 0xff, 0xff, 0x00, 0x5a, 0xfe, 0xcb,
-    0x03, 0xd6, 0x04, 0x4e, 0x06, 0x26, 0x00, 0x49, 0x00, 0x00, 0x01, 0x07, 0x00, 0xad, 0x04, 0x7f,
-    0x00, 0x02, 0x00, 0x0e, 0xb4, 0x01, 0x2f, 0x00, 0x01, 0x01, 0xb8, 0xff, 0x89, 0xb0, 0x56, 0x00,
-    0x2b, 0x34, 0xff, 0xff, 0x00, 0xb9, 0x00, 0x00, 0x04, 0x42, 0x07, 0xb7, 0x06, 0x26, 0x00, 0x29,
-    0x00, 0x00, 0x01, 0x07, 0x00, 0xab, 0x04, 0xb1, 0x01, 0x5d, 0x00, 0x0b, 0xb6, 0x04, 0x11, 0x07,
-    0x01, 0x01, 0x7c, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x5a, 0xff, 0xec, 0x03, 0xd6,
-    0x06, 0x75, 0x06, 0x26, 0x00, 0x49, 0x00, 0x00, 0x01, 0x07, 0x00, 0xab, 0x04, 0x7c, 0x00, 0x1c,
-    0x00, 0x0b, 0xb6, 0x01, 0x2d, 0x0b, 0x01, 0x01, 0x9c, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff,
-    0x00, 0xb9, 0x00, 0x00, 0x04, 0x42, 0x07, 0x1e, 0x06, 0x26, 0x00, 0x29, 0x00, 0x00, 0x01, 0x07,
-    0x00, 0xa5, 0x00, 0xb5, 0x01, 0x4a, 0x00, 0x0b, 0xb6, 0x04, 0x1e, 0x07, 0x01, 0x01, 0x76, 0x56,
-    0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x5a, 0xff, 0xec, 0x03, 0xd6, 0x05, 0xdd, 0x06, 0x26,
-    0x00, 0x49, 0x00, 0x00, 0x01, 0x07, 0x00, 0xa5, 0x00, 0x80, 0x00, 0x09, 0x00, 0x0b, 0xb6, 0x01,
-    0x3a, 0x0b, 0x01, 0x01, 0x96, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0xb9, 0x00, 0x00,
-    0x04, 0x8e, 0x07, 0xa0, 0x06, 0x26, 0x00, 0x29, 0x00, 0x00, 0x01, 0x07, 0x02, 0x51, 0x00, 0xc5,
-    0x01, 0x3e, 0x00, 0x0d, 0xb7, 0x05, 0x04, 0x14, 0x07, 0x01, 0x01, 0x6c, 0x56, 0x00, 0x2b, 0x34,
-    0x34, 0x00, 0xff, 0xff, 0x00, 0x5a, 0xff, 0xec, 0x04, 0x59, 0x06, 0x5f, 0x06, 0x26, 0x00, 0x49,
-    0x00, 0x00, 0x01, 0x07, 0x02, 0x51, 0x00, 0x90, 0xff, 0xfc, 0x00, 0x0d, 0xb7, 0x02, 0x01, 0x30,
-    0x0b, 0x01, 0x01, 0x8c, 0x56, 0x00, 0x2b, 0x34, 0x34, 0x00, 0xff, 0xff, 0x00, 0x42, 0x00, 0x00,
-    0x04, 0x42, 0x07, 0x9e, 0x06, 0x26, 0x00, 0x29, 0x00, 0x00, 0x01, 0x07, 0x02, 0x52, 0x00, 0xb2,
-    0x01, 0x45, 0x00, 0x0d, 0xb7, 0x05, 0x04, 0x12, 0x07, 0x01, 0x01, 0x67, 0x56, 0x00, 0x2b, 0x34,
-    0x34, 0x00, 0xff, 0xff, 0x00, 0x0d, 0xff, 0xec, 0x03, 0xd6, 0x06, 0x5d, 0x06, 0x26, 0x00, 0x49,
-    0x00, 0x00, 0x01, 0x06, 0x02, 0x52, 0x7d, 0x03, 0x00, 0x0d, 0xb7, 0x02, 0x01, 0x2e, 0x0b, 0x01,
-    0x01, 0x87, 0x56, 0x00, 0x2b, 0x34, 0x34, 0x00, 0xff, 0xff, 0x00, 0xb9, 0x00, 0x00, 0x04, 0x6c,
-    0x07, 0xf0, 0x06, 0x26, 0x00, 0x29, 0x00, 0x00, 0x01, 0x07, 0x02, 0x53, 0x00, 0xb6, 0x01, 0x3e,
-    0x00, 0x0d, 0xb7, 0x05, 0x04, 0x15, 0x07, 0x01, 0x01, 0x5b, 0x56, 0x00, 0x2b, 0x34, 0x34, 0x00,
-    0xff, 0xff, 0x00, 0x5a, 0xff, 0xec, 0x04, 0x37, 0x06, 0xae, 0x06, 0x26, 0x00, 0x49, 0x00, 0x00,
-    0x01, 0x07, 0x02, 0x53, 0x00, 0x81, 0xff, 0xfc, 0x00, 0x0d, 0xb7, 0x02, 0x01, 0x31, 0x0b, 0x01,
-    0x01, 0x7b, 0x56, 0x00, 0x2b, 0x34, 0x34, 0x00, 0xff, 0xff, 0x00, 0xb9, 0x00, 0x00, 0x04, 0x42,
-    0x07, 0xd5, 0x06, 0x26, 0x00, 0x29, 0x00, 0x00, 0x01, 0x07, 0x02, 0x54, 0x00, 0xb4, 0x01, 0x24,
-    0x00, 0x0d, 0xb7, 0x05, 0x04, 0x12, 0x07, 0x01, 0x01, 0x45, 0x56, 0x00, 0x2b, 0x34, 0x34, 0x00,
-    0xff, 0xff, 0x00, 0x5a, 0xff, 0xec, 0x03, 0xd6, 0x06, 0x93, 0x06, 0x26, 0x00, 0x49, 0x00, 0x00,
-    0x01, 0x06, 0x02, 0x54, 0x7f, 0xe2, 0x00, 0x0d, 0xb7, 0x02, 0x01, 0x2e, 0x0b, 0x01, 0x01, 0x65,
-    0x56, 0x00, 0x2b, 0x34, 0x34, 0x00, 0xff, 0xff, 0x00, 0xb9, 0xfe, 0xd3, 0x04, 0x42, 0x07, 0x37,
-    0x06, 0x26, 0x00, 0x29, 0x00, 0x00, 0x00, 0x27, 0x00, 0x9e, 0x00, 0xb7, 0x01, 0x41, 0x01, 0x07,
-    0x00, 0xad, 0x04, 0xb4, 0x00, 0x0a, 0x00, 0x17, 0xb4, 0x05, 0x1c, 0x02, 0x01, 0x01, 0xb8, 0xff,
-    0x7f, 0xb7, 0x56, 0x04, 0x13, 0x07, 0x01, 0x01, 0x77, 0x56, 0x00, 0x2b, 0x34, 0x2b, 0x34, 0x00,
-    0xff, 0xff, 0x00, 0x5a, 0xfe, 0xcb, 0x03, 0xd6, 0x05, 0xf6, 0x06, 0x26, 0x00, 0x49, 0x00, 0x00,
-    0x00, 0x27, 0x00, 0x9e, 0x00, 0x82, 0xff, 0xff, 0x01, 0x07, 0x00, 0xad, 0x04, 0x7f, 0x00, 0x02,
-    0x00, 0x17, 0xb4, 0x02, 0x38, 0x00, 0x01, 0x01, 0xb8, 0xff, 0x89, 0xb7, 0x56, 0x01, 0x2f, 0x0b,
-    0x01, 0x01, 0x97, 0x56, 0x00, 0x2b, 0x34, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0xc4, 0x00, 0x00,
-    0x01, 0xf1, 0x07, 0xb7, 0x06, 0x26, 0x00, 0x2d, 0x00, 0x00, 0x01, 0x07, 0x00, 0xab, 0x03, 0x58,
-    0x01, 0x5d, 0x00, 0x0b, 0xb6, 0x01, 0x05, 0x03, 0x01, 0x01, 0x7c, 0x56, 0x00, 0x2b, 0x34, 0x00,
-    0xff, 0xff, 0x00, 0x99, 0x00, 0x00, 0x01, 0xc6, 0x06, 0x69, 0x06, 0x26, 0x00, 0x8d, 0x00, 0x00,
-    0x01, 0x07, 0x00, 0xab, 0x03, 0x2d, 0x00, 0x10, 0x00, 0x0b, 0xb6, 0x01, 0x05, 0x03, 0x01, 0x01,
-    0xae, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0xba, 0xfe, 0xcd, 0x01, 0x5f, 0x05, 0xb0,
-    0x06, 0x26, 0x00, 0x2d, 0x00, 0x00, 0x01, 0x07, 0x00, 0xad, 0x03, 0x5a, 0x00, 0x05, 0x00, 0x0e,
-    0xb4, 0x01, 0x07, 0x02, 0x01, 0x01, 0xb8, 0xff, 0x7e, 0xb0, 0x56, 0x00, 0x2b, 0x34, 0xff, 0xff,
-    0x00, 0x8e, 0xfe, 0xd3, 0x01, 0x3b, 0x05, 0xc4, 0x06, 0x26, 0x00, 0x4d, 0x00, 0x00, 0x01, 0x07,
-    0x00, 0xad, 0x03, 0x2e, 0x00, 0x0a, 0x00, 0x0e, 0xb4, 0x02, 0x13, 0x02, 0x01, 0x01, 0xb8, 0xff,
-    0x7f, 0xb0, 0x56, 0x00, 0x2b, 0x34, 0xff, 0xff, 0x00, 0x7e, 0xfe, 0xc8, 0x04, 0xed, 0x05, 0xc4,
-    0x06, 0x26, 0x00, 0x33, 0x00, 0x00, 0x01, 0x07, 0x00, 0xad, 0x05, 0x00, 0xff, 0xff, 0x00, 0x0e,
-    0xb4, 0x02, 0x2f, 0x06, 0x01, 0x01, 0xb8, 0xff, 0x89, 0xb0, 0x56, 0x00, 0x2b, 0x34, 0xff, 0xff,
-    0x00, 0x5b, 0xfe, 0xc3, 0x04, 0x21, 0x04, 0x4e, 0x06, 0x26, 0x00, 0x53, 0x00, 0x00, 0x01, 0x07,
-    0x00, 0xad, 0x04, 0x88, 0xff, 0xfb, 0x00, 0x0e, 0xb4, 0x02, 0x2f, 0x11, 0x01, 0x01, 0xb8, 0xff,
-    0x88, 0xb0, 0x56, 0x00, 0x2b, 0x34, 0xff, 0xff, 0x00, 0x7e, 0xff, 0xec, 0x04, 0xed, 0x07, 0xbd,
-    0x06, 0x26, 0x00, 0x33, 0x00, 0x00, 0x01, 0x07, 0x00, 0xab, 0x04, 0xfa, 0x01, 0x63, 0x00, 0x0b,
-    0xb6, 0x02, 0x2d, 0x11, 0x01, 0x01, 0x5f, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x5b,
-    0xff, 0xec, 0x04, 0x21, 0x06, 0x75, 0x06, 0x26, 0x00, 0x53, 0x00, 0x00, 0x01, 0x07, 0x00, 0xab,
-    0x04, 0x81, 0x00, 0x1b, 0x00, 0x0b, 0xb6, 0x02, 0x2d, 0x06, 0x01, 0x01, 0x9c, 0x56, 0x00, 0x2b,
-    0x34, 0x00, 0xff, 0xff, 0x00, 0x7e, 0xff, 0xec, 0x04, 0xed, 0x07, 0xa6, 0x06, 0x26, 0x00, 0x33,
-    0x00, 0x00, 0x01, 0x07, 0x02, 0x51, 0x01, 0x0d, 0x01, 0x44, 0x00, 0x0d, 0xb7, 0x03, 0x02, 0x30,
-    0x11, 0x01, 0x01, 0x4f, 0x56, 0x00, 0x2b, 0x34, 0x34, 0x00, 0xff, 0xff, 0x00, 0x5b, 0xff, 0xec,
-    0x04, 0x5e, 0x06, 0x5e, 0x06, 0x26, 0x00, 0x53, 0x00, 0x00, 0x01, 0x07, 0x02, 0x51, 0x00, 0x95,
-    0xff, 0xfc, 0x00, 0x0d, 0xb7, 0x03, 0x02, 0x30, 0x06, 0x01, 0x01, 0x8c, 0x56, 0x00, 0x2b, 0x34,
-    0x34, 0x00, 0xff, 0xff, 0x00, 0x7e, 0xff, 0xec, 0x04, 0xed, 0x07, 0xa4, 0x06, 0x26, 0x00, 0x33,
-    0x00, 0x00, 0x01, 0x07, 0x02, 0x52, 0x00, 0xfb, 0x01, 0x4b, 0x00, 0x0d, 0xb7, 0x03, 0x02, 0x2e,
-    0x11, 0x01, 0x01, 0x4a, 0x56, 0x00, 0x2b, 0x34, 0x34, 0x00, 0xff, 0xff, 0x00, 0x12, 0xff, 0xec,
-    0x04, 0x21, 0x06, 0x5c, 0x06, 0x26, 0x00, 0x53, 0x00, 0x00, 0x01, 0x07, 0x02, 0x52, 0x00, 0x82,
-    0x00, 0x03, 0x00, 0x0d, 0xb7, 0x03, 0x02, 0x2e, 0x06, 0x01, 0x01, 0x87, 0x56, 0x00, 0x2b, 0x34,
-    0x34, 0x00, 0xff, 0xff, 0x00, 0x7e, 0xff, 0xec, 0x04, 0xed, 0x07, 0xf6, 0x06, 0x26, 0x00, 0x33,
-    0x00, 0x00, 0x01, 0x07, 0x02, 0x53, 0x00, 0xff, 0x01, 0x44, 0x00, 0x0d, 0xb7, 0x03, 0x02, 0x31,
-    0x11, 0x01, 0x01, 0x3e, 0x56, 0x00, 0x2b, 0x34, 0x34, 0x00, 0xff, 0xff, 0x00, 0x5b, 0xff, 0xec,
-    0x04, 0x3c, 0x06, 0xae, 0x06, 0x26, 0x00, 0x53, 0x00, 0x00, 0x01, 0x07, 0x02, 0x53, 0x00, 0x86,
-    0xff, 0xfc, 0x00, 0x0d, 0xb7, 0x03, 0x02, 0x31, 0x06, 0x01, 0x01, 0x7b, 0x56, 0x00, 0x2b, 0x34,
-    0x34, 0x00, 0xff, 0xff, 0x00, 0x7e, 0xff, 0xec, 0x04, 0xed, 0x07, 0xdb, 0x06, 0x26, 0x00, 0x33,
-    0x00, 0x00, 0x01, 0x07, 0x02, 0x54, 0x00, 0xfd, 0x01, 0x2a, 0x00, 0x0d, 0xb7, 0x03, 0x02, 0x2e,
-    0x11, 0x01, 0x01, 0x28, 0x56, 0x00, 0x2b, 0x34, 0x34, 0x00, 0xff, 0xff, 0x00, 0x5b, 0xff, 0xec,
-    0x04, 0x21, 0x06, 0x93, 0x06, 0x26, 0x00, 0x53, 0x00, 0x00, 0x01, 0x07, 0x02, 0x54, 0x00, 0x84,
-    0xff, 0xe2, 0x00, 0x0d, 0xb7, 0x03, 0x02, 0x2e, 0x06, 0x01, 0x01, 0x65, 0x56, 0x00, 0x2b, 0x34,
-    0x34, 0x00, 0xff, 0xff, 0x00, 0x7e, 0xfe, 0xc8, 0x04, 0xed, 0x07, 0x3d, 0x06, 0x26, 0x00, 0x33,
-    0x00, 0x00, 0x00, 0x27, 0x00, 0x9e, 0x00, 0xff, 0x01, 0x47, 0x01, 0x07, 0x00, 0xad, 0x05, 0x00,
-    0xff, 0xff, 0x00, 0x17, 0xb4, 0x03, 0x38, 0x06, 0x01, 0x01, 0xb8, 0xff, 0x89, 0xb7, 0x56, 0x02,
-    0x2f, 0x11, 0x01, 0x01, 0x5a, 0x56, 0x00, 0x2b, 0x34, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x5b,
-    0xfe, 0xc3, 0x04, 0x21, 0x05, 0xf5, 0x06, 0x26, 0x00, 0x53, 0x00, 0x00, 0x00, 0x27, 0x00, 0x9e,
-    0x00, 0x87, 0xff, 0xff, 0x01, 0x07, 0x00, 0xad, 0x04, 0x88, 0xff, 0xfb, 0x00, 0x17, 0xb4, 0x03,
-    0x38, 0x11, 0x01, 0x01, 0xb8, 0xff, 0x88, 0xb7, 0x56, 0x02, 0x2f, 0x06, 0x01, 0x01, 0x97, 0x56,
-    0x00, 0x2b, 0x34, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x85, 0xff, 0xec, 0x05, 0xa8, 0x07, 0x3d,
-    0x06, 0x26, 0x00, 0x98, 0x00, 0x00, 0x01, 0x07, 0x00, 0x75, 0x02, 0x07, 0x01, 0x3d, 0x00, 0x0b,
-    0xb6, 0x03, 0x3a, 0x1c, 0x01, 0x01, 0x47, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x5a,
-    0xff, 0xec, 0x04, 0xa0, 0x05, 0xff, 0x06, 0x26, 0x00, 0x99, 0x00, 0x00, 0x01, 0x07, 0x00, 0x75,
-    0x01, 0x83, 0xff, 0xff, 0x00, 0x0b, 0xb6, 0x03, 0x36, 0x10, 0x01, 0x01, 0x8c, 0x56, 0x00, 0x2b,
-    0x34, 0x00, 0xff, 0xff, 0x00, 0x85, 0xff, 0xec, 0x05, 0xa8, 0x07, 0x3d, 0x06, 0x26, 0x00, 0x98,
-    0x00, 0x00, 0x01, 0x07, 0x00, 0x44, 0x01, 0x5e, 0x01, 0x3d, 0x00, 0x0b, 0xb6, 0x03, 0x3c, 0x1c,
-    0x01, 0x01, 0x47, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x5a, 0xff, 0xec, 0x04, 0xa0,
-    0x05, 0xff, 0x06, 0x26, 0x00, 0x99, 0x00, 0x00, 0x01, 0x07, 0x00, 0x44, 0x00, 0xda, 0xff, 0xff,
-    0x00, 0x0b, 0xb6, 0x03, 0x38, 0x10, 0x01, 0x01, 0x8c, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff,
-    0x00, 0x85, 0xff, 0xec, 0x05, 0xa8, 0x07, 0xb3, 0x06, 0x26, 0x00, 0x98, 0x00, 0x00, 0x01, 0x07,
-    0x00, 0xab, 0x05, 0x11, 0x01, 0x5a, 0x00, 0x0b, 0xb6, 0x03, 0x3b, 0x1c, 0x01, 0x01, 0x57, 0x56,
-    0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x5a, 0xff, 0xec, 0x04, 0xa0, 0x06, 0x75, 0x06, 0x26,
-    0x00, 0x99, 0x00, 0x00, 0x01, 0x07, 0x00, 0xab, 0x04, 0x8c, 0x00, 0x1b, 0x00, 0x0b, 0xb6, 0x03,
-    0x37, 0x10, 0x01, 0x01, 0x9c, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x85, 0xff, 0xec,
-    0x05, 0xa8, 0x07, 0x1b, 0x06, 0x26, 0x00, 0x98, 0x00, 0x00, 0x01, 0x07, 0x00, 0xa5, 0x01, 0x14,
-    0x01, 0x47, 0x00, 0x0b, 0xb6, 0x03, 0x48, 0x1c, 0x01, 0x01, 0x51, 0x56, 0x00, 0x2b, 0x34, 0x00,
-    0xff, 0xff, 0x00, 0x5a, 0xff, 0xec, 0x04, 0xa0, 0x05, 0xdc, 0x06, 0x26, 0x00, 0x99, 0x00, 0x00,
-    0x01, 0x07, 0x00, 0xa5, 0x00, 0x90, 0x00, 0x08, 0x00, 0x0b, 0xb6, 0x03, 0x44, 0x10, 0x01, 0x01,
-    0x96, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x85, 0xfe, 0xc9, 0x05, 0xa8, 0x06, 0x1f,
-    0x06, 0x26, 0x00, 0x98, 0x00, 0x00, 0x01, 0x07, 0x00, 0xad, 0x04, 0xfd, 0x00, 0x00, 0x00, 0x0e,
-    0xb4, 0x03, 0x3d, 0x10, 0x01, 0x01, 0xb8, 0xff, 0x89, 0xb0, 0x56, 0x00, 0x2b, 0x34, 0xff, 0xff,
-    0x00, 0x5a, 0xfe, 0xbf, 0x04, 0xa0, 0x04, 0xaf, 0x06, 0x26, 0x00, 0x99, 0x00, 0x00, 0x01, 0x07,
-    0x00, 0xad, 0x04, 0x8f, 0xff, 0xf6, 0x00, 0x0e, 0xb4, 0x03, 0x39, 0x1b, 0x01, 0x01, 0xb8, 0xff,
-    0x7f, 0xb0, 0x56, 0x00, 0x2b, 0x34, 0xff, 0xff, 0x00, 0xa3, 0xfe, 0xc9, 0x04, 0xa3, 0x05, 0xb0,
-    0x06, 0x26, 0x00, 0x39, 0x00, 0x00, 0x01, 0x07, 0x00, 0xad, 0x04, 0xeb, 0x00, 0x00, 0x00, 0x0e,
-    0xb4, 0x01, 0x19, 0x06, 0x01, 0x01, 0xb8, 0xff, 0x89, 0xb0, 0x56, 0x00, 0x2b, 0x34, 0xff, 0xff,
-    0x00, 0x99, 0xfe, 0xc9, 0x03, 0xcb, 0x04, 0x3a, 0x06, 0x26, 0x00, 0x59, 0x00, 0x00, 0x01, 0x07,
-    0x00, 0xad, 0x04, 0x48, 0x00, 0x00, 0x00, 0x0e, 0xb4, 0x02, 0x1f, 0x0b, 0x01, 0x01, 0xb8, 0xff,
-    0x89, 0xb0, 0x56, 0x00, 0x2b, 0x34, 0xff, 0xff, 0x00, 0xa3, 0xff, 0xec, 0x04, 0xa3, 0x07, 0xb1,
-    0x06, 0x26, 0x00, 0x39, 0x00, 0x00, 0x01, 0x07, 0x00, 0xab, 0x04, 0xf0, 0x01, 0x58, 0x00, 0x0b,
-    0xb6, 0x01, 0x17, 0x00, 0x01, 0x01, 0x71, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x99,
-    0xff, 0xec, 0x03, 0xcb, 0x06, 0x76, 0x06, 0x26, 0x00, 0x59, 0x00, 0x00, 0x01, 0x07, 0x00, 0xab,
-    0x04, 0x84, 0x00, 0x1d, 0x00, 0x0b, 0xb6, 0x02, 0x1d, 0x11, 0x01, 0x01, 0xb0, 0x56, 0x00, 0x2b,
-    0x34, 0x00, 0xff, 0xff, 0x00, 0xa3, 0xff, 0xec, 0x05, 0xed, 0x07, 0x41, 0x06, 0x26, 0x00, 0x9a,
-    0x00, 0x00, 0x01, 0x07, 0x00, 0x75, 0x01, 0xe4, 0x01, 0x41, 0x00, 0x0b, 0xb6, 0x02, 0x20, 0x0a,
-    0x01, 0x01, 0x6c, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x99, 0xff, 0xec, 0x04, 0xda,
-    0x05, 0xea, 0x06, 0x26, 0x00, 0x9b, 0x00, 0x00, 0x01, 0x07, 0x00, 0x75, 0x01, 0x81, 0xff, 0xea,
-    0x00, 0x0b, 0xb6, 0x03, 0x26, 0x1b, 0x01, 0x01, 0x8b, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff,
-    0x00, 0xa3, 0xff, 0xec, 0x05, 0xed, 0x07, 0x41, 0x06, 0x26, 0x00, 0x9a, 0x00, 0x00, 0x01, 0x07,
-    0x00, 0x44, 0x01, 0x3b, 0x01, 0x41, 0x00, 0x0b, 0xb6, 0x02, 0x22, 0x0a, 0x01, 0x01, 0x6c, 0x56,
-    0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x99, 0xff, 0xec, 0x04, 0xda, 0x05, 0xea, 0x06, 0x26,
-    0x00, 0x9b, 0x00, 0x00, 0x01, 0x07, 0x00, 0x44, 0x00, 0xd8, 0xff, 0xea, 0x00, 0x0b, 0xb6, 0x03,
-    0x28, 0x1b, 0x01, 0x01, 0x8b, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0xa3, 0xff, 0xec,
-    0x05, 0xed, 0x07, 0xb7, 0x06, 0x26, 0x00, 0x9a, 0x00, 0x00, 0x01, 0x07, 0x00, 0xab, 0x04, 0xee,
-    0x01, 0x5d, 0x00, 0x0b, 0xb6, 0x02, 0x21, 0x0a, 0x01, 0x01, 0x7c, 0x56, 0x00, 0x2b, 0x34, 0x00,
-    0xff, 0xff, 0x00, 0x99, 0xff, 0xec, 0x04, 0xda, 0x06, 0x60, 0x06, 0x26, 0x00, 0x9b, 0x00, 0x00,
-    0x01, 0x07, 0x00, 0xab, 0x04, 0x8a, 0x00, 0x06, 0x00, 0x0b, 0xb6, 0x03, 0x27, 0x1b, 0x01, 0x01,
-    0x9b, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0xa3, 0xff, 0xec, 0x05, 0xed, 0x07, 0x1e,
-    0x06, 0x26, 0x00, 0x9a, 0x00, 0x00, 0x01, 0x07, 0x00, 0xa5, 0x00, 0xf1, 0x01, 0x4a, 0x00, 0x0b,
-    0xb6, 0x02, 0x2e, 0x15, 0x01, 0x01, 0x76, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x99,
-    0xff, 0xec, 0x04, 0xda, 0x05, 0xc7, 0x06, 0x26, 0x00, 0x9b, 0x00, 0x00, 0x01, 0x07, 0x00, 0xa5,
-    0x00, 0x8e, 0xff, 0xf3, 0x00, 0x0b, 0xb6, 0x03, 0x34, 0x1b, 0x01, 0x01, 0x95, 0x56, 0x00, 0x2b,
-    0x34, 0x00, 0xff, 0xff, 0x00, 0xa3, 0xfe, 0xc4, 0x05, 0xed, 0x06, 0x09, 0x06, 0x26, 0x00, 0x9a,
-    0x00, 0x00, 0x01, 0x07, 0x00, 0xad, 0x04, 0xe8, 0xff, 0xfc, 0x00, 0x0e, 0xb4, 0x02, 0x23, 0x10,
-    0x01, 0x01, 0xb8, 0xff, 0x80, 0xb0, 0x56, 0x00, 0x2b, 0x34, 0xff, 0xff, 0x00, 0x99, 0xfe, 0xc9,
-    0x04, 0xda, 0x04, 0x9c, 0x06, 0x26, 0x00, 0x9b, 0x00, 0x00, 0x01, 0x07, 0x00, 0xad, 0x04, 0x7a,
-    0x00, 0x00, 0x00, 0x0e, 0xb4, 0x03, 0x29, 0x15, 0x01, 0x01, 0xb8, 0xff, 0x89, 0xb0, 0x56, 0x00,
-    0x2b, 0x34, 0xff, 0xff, 0x00, 0x18, 0xfe, 0xce, 0x04, 0xaf, 0x05, 0xb0, 0x06, 0x26, 0x00, 0x3d,
-    0x00, 0x00, 0x01, 0x07, 0x00, 0xad, 0x04, 0xae, 0x00, 0x06, 0x00, 0x0e, 0xb4, 0x01, 0x0c, 0x06,
-    0x01, 0x01, 0xb8, 0xff, 0x76, 0xb0, 0x56, 0x00, 0x2b, 0x34, 0xff, 0xff, 0x00, 0x21, 0xfe, 0x2b,
-    0x03, 0xb0, 0x04, 0x3a, 0x06, 0x26, 0x00, 0x5d, 0x00, 0x00, 0x01, 0x07, 0x00, 0xad, 0x05, 0x13,
-    0xff, 0x62, 0x00, 0x0e, 0xb4, 0x02, 0x22, 0x08, 0x00, 0x00, 0xb8, 0xff, 0xb9, 0xb0, 0x56, 0x00,
-    0x2b, 0x34, 0xff, 0xff, 0x00, 0x18, 0x00, 0x00, 0x04, 0xaf, 0x07, 0xab, 0x06, 0x26, 0x00, 0x3d,
-    0x00, 0x00, 0x01, 0x07, 0x00, 0xab, 0x04, 0xab, 0x01, 0x52, 0x00, 0x0b, 0xb6, 0x01, 0x0a, 0x02,
-    0x01, 0x01, 0x70, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x21, 0xfe, 0x4b, 0x03, 0xb0,
-    0x06, 0x76, 0x06, 0x26, 0x00, 0x5d, 0x00, 0x00, 0x01, 0x07, 0x00, 0xab, 0x04, 0x48, 0x00, 0x1d,
-    0x00, 0x0b, 0xb6, 0x02, 0x1a, 0x01, 0x01, 0x01, 0xb0, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff,
-    0x00, 0x18, 0x00, 0x00, 0x04, 0xaf, 0x07, 0x13, 0x06, 0x26, 0x00, 0x3d, 0x00, 0x00, 0x01, 0x07,
-    0x00, 0xa5, 0x00, 0xaf, 0x01, 0x3f, 0x00, 0x0b, 0xb6, 0x01, 0x17, 0x08, 0x01, 0x01, 0x6a, 0x56,
-    0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x21, 0xfe, 0x4b, 0x03, 0xb0, 0x05, 0xde, 0x06, 0x26,
-    0x00, 0x5d, 0x00, 0x00, 0x01, 0x06, 0x00, 0xa5, 0x4b, 0x0a, 0x00, 0x0b, 0xb6, 0x02, 0x27, 0x18,
-    0x01, 0x01, 0xaa, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x6d, 0xfe, 0xfc, 0x04, 0x82,
-    0x06, 0x00, 0x04, 0x26, 0x00, 0x48, 0x00, 0x00, 0x00, 0x27, 0x02, 0x40, 0x01, 0xa1, 0x02, 0x3b,
-    0x01, 0x07, 0x00, 0x43, 0x00, 0xa9, 0xff, 0x63, 0x00, 0x17, 0xb4, 0x04, 0x37, 0x16, 0x01, 0x01,
-    0xb8, 0xff, 0x77, 0xb7, 0x56, 0x03, 0x32, 0x0b, 0x01, 0x01, 0x83, 0x56, 0x00, 0x2b, 0x34, 0x2b,
-    0x34, 0x00, 0xff, 0xff, 0x00, 0x35, 0xfe, 0x9d, 0x04, 0x94, 0x05, 0xb0, 0x06, 0x26, 0x00, 0x38,
-    0x00, 0x00, 0x01, 0x07, 0x02, 0x6b, 0x02, 0x05, 0x00, 0x00, 0x00, 0x0b, 0xb6, 0x02, 0x0b, 0x02,
-    0x00, 0x00, 0x9a, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x28, 0xfe, 0x9d, 0x03, 0xa6,
-    0x04, 0x3a, 0x06, 0x26, 0x00, 0xf6, 0x00, 0x00, 0x01, 0x07, 0x02, 0x6b, 0x01, 0x82, 0x00, 0x00,
-    0x00, 0x0b, 0xb6, 0x02, 0x0b, 0x02, 0x00, 0x00, 0x9a, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff,
-    0x00, 0xad, 0xfe, 0x9d, 0x04, 0x9a, 0x05, 0xb0, 0x06, 0x26, 0x00, 0xe1, 0x00, 0x00, 0x01, 0x07,
-    0x02, 0x6b, 0x03, 0x23, 0x00, 0x00, 0x00, 0x0b, 0xb6, 0x02, 0x1d, 0x19, 0x01, 0x00, 0x9a, 0x56,
-    0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x6f, 0xfe, 0x9d, 0x03, 0x9e, 0x04, 0x3b, 0x06, 0x26,
-    0x00, 0xf9, 0x00, 0x00, 0x01, 0x07, 0x02, 0x6b, 0x02, 0x2a, 0x00, 0x00, 0x00, 0x0b, 0xb6, 0x02,
-    0x1b, 0x02, 0x01, 0x00, 0x9a, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0xba, 0xfe, 0x9d,
-    0x04, 0x28, 0x05, 0xb0, 0x06, 0x26, 0x00, 0xb1, 0x00, 0x00, 0x01, 0x07, 0x02, 0x6b, 0x00, 0x99,
-    0x00, 0x00, 0x00, 0x0b, 0xb6, 0x01, 0x09, 0x04, 0x00, 0x00, 0x9a, 0x56, 0x00, 0x2b, 0x34, 0x00,
-    0xff, 0xff, 0x00, 0xa4, 0xfe, 0x9d, 0x03, 0x3f, 0x04, 0x3a, 0x06, 0x26, 0x00, 0xec, 0x00, 0x00,
-    0x01, 0x07, 0x02, 0x6b, 0x00, 0x80, 0x00, 0x00, 0x00, 0x0b, 0xb6, 0x01, 0x09, 0x04, 0x00, 0x00,
-    0x9a, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x25, 0xfe, 0x41, 0x05, 0x91, 0x05, 0xc4,
-    0x06, 0x26, 0x01, 0x4c, 0x00, 0x00, 0x01, 0x07, 0x02, 0x6b, 0x02, 0xd6, 0xff, 0xa4, 0x00, 0x0b,
-    0xb6, 0x02, 0x3a, 0x0a, 0x00, 0x00, 0x6b, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0xff, 0xf6,
-    0xfe, 0x58, 0x04, 0x54, 0x04, 0x4e, 0x06, 0x26, 0x01, 0x4d, 0x00, 0x00, 0x01, 0x07, 0x02, 0x6b,
-    0x01, 0xf1, 0xff, 0xbc, 0x00, 0x0b, 0xb6, 0x02, 0x39, 0x09, 0x00, 0x00, 0x6b, 0x56, 0x00, 0x2b,
-    0x34, 0x00, 0xff, 0xff, 0x00, 0x9d, 0x00, 0x00, 0x03, 0xcd, 0x06, 0x00, 0x06, 0x06, 0x00, 0x4c,
-    0x00, 0x00, 0x00, 0x02, 0xff, 0xfd, 0x00, 0x00, 0x04, 0x78, 0x05, 0xb0, 0x00, 0x18, 0x00, 0x1c,
-    0x00, 0x1a, 0x40, 0x0c, 0x1c, 0x1b, 0x18, 0x00, 0x00, 0x0b, 0x0c, 0x02, 0x72, 0x0e, 0x0b, 0x08,
-    0x00, 0x3f, 0x33, 0x2b, 0x12, 0x39, 0x2f, 0x33, 0xcc, 0x32, 0x30, 0x31, 0x41, 0x21, 0x32, 0x16,
-    0x16, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x21, 0x11, 0x33, 0x11, 0x21, 0x32, 0x36, 0x36, 0x35, 0x34,
-    0x26, 0x26, 0x23, 0x21, 0x01, 0x15, 0x21, 0x35, 0x01, 0x02, 0x01, 0x94, 0x9e, 0xd7, 0x6d, 0x3e,
-    0x7a, 0xb4, 0x76, 0xfe, 0x1c, 0x7c, 0x01, 0x68, 0x7f, 0x9e, 0x4a, 0x4a, 0x9e, 0x7f, 0xfe, 0x6c,
-    0x01, 0x5f, 0xfd, 0x9c, 0x03, 0x3a, 0x68, 0xb9, 0x7a, 0x5c, 0x97, 0x70, 0x3c, 0x05, 0xb0, 0xfa,
-    0xba, 0x56, 0x8e, 0x53, 0x50, 0x8a, 0x55, 0x01, 0xfe, 0x67, 0x67, 0x00, 0x00, 0x02, 0xff, 0xfd,
-    0x00, 0x00, 0x04, 0x78, 0x05, 0xb0, 0x00, 0x18, 0x00, 0x1c, 0x00, 0x19, 0x40, 0x0b, 0x1c, 0x1b,
-    0x18, 0x00, 0x00, 0x0b, 0x0c, 0x02, 0x0e, 0x0b, 0x08, 0x00, 0x3f, 0x33, 0x3f, 0x12, 0x39, 0x2f,
-    0x33, 0xcc, 0x32, 0x30, 0x31, 0x41, 0x21, 0x32, 0x16, 0x16, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x21,
-    0x11, 0x33, 0x11, 0x21, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x21, 0x01, 0x15, 0x21,
-    0x35, 0x01, 0x02, 0x01, 0x94, 0x9e, 0xd7, 0x6d, 0x3e, 0x7a, 0xb4, 0x76, 0xfe, 0x1c, 0x7c, 0x01,
-    0x68, 0x7f, 0x9e, 0x4a, 0x4a, 0x9e, 0x7f, 0xfe, 0x6c, 0x01, 0x5f, 0xfd, 0x9c, 0x03, 0x3a, 0x68,
-    0xb9, 0x7a, 0x5c, 0x97, 0x70, 0x3c, 0x05, 0xb0, 0xfa, 0xba, 0x56, 0x8e, 0x53, 0x50, 0x8a, 0x55,
-    0x01, 0xfe, 0x67, 0x67, 0x00, 0x02, 0x00, 0x2b, 0x00, 0x00, 0x04, 0x28, 0x05, 0xb0, 0x00, 0x05,
-    0x00, 0x09, 0x00, 0x16, 0x40, 0x0a, 0x06, 0x07, 0x07, 0x04, 0x02, 0x05, 0x02, 0x72, 0x04, 0x08,
-    0x00, 0x3f, 0x2b, 0x32, 0x12, 0x39, 0x2f, 0x33, 0x30, 0x31, 0x41, 0x15, 0x21, 0x11, 0x23, 0x11,
-    0x01, 0x15, 0x21, 0x35, 0x04, 0x28, 0xfd, 0x0d, 0x7b, 0x01, 0xd5, 0xfd, 0x9c, 0x05, 0xb0, 0x6a,
-    0xfa, 0xba, 0x05, 0xb0, 0xfd, 0x7a, 0x67, 0x67, 0x00, 0x02, 0x00, 0x01, 0x00, 0x00, 0x03, 0x3f,
-    0x04, 0x3a, 0x00, 0x05, 0x00, 0x09, 0x00, 0x16, 0x40, 0x0a, 0x09, 0x08, 0x08, 0x04, 0x02, 0x05,
-    0x06, 0x72, 0x04, 0x0a, 0x00, 0x3f, 0x2b, 0x32, 0x12, 0x39, 0x2f, 0x33, 0x30, 0x31, 0x41, 0x15,
-    0x21, 0x11, 0x23, 0x11, 0x01, 0x15, 0x21, 0x35, 0x03, 0x3f, 0xfd, 0xdc, 0x77, 0x01, 0xc1, 0xfd,
-    0x9c, 0x04, 0x3a, 0x68, 0xfc, 0x2e, 0x04, 0x3a, 0xfe, 0x23, 0x67, 0x67, 0x00, 0x04, 0x00, 0x07,
-    0x00, 0x00, 0x05, 0x09, 0x05, 0xb0, 0x00, 0x03, 0x00, 0x09, 0x00, 0x0d, 0x00, 0x11, 0x00, 0x2b,
-    0x40, 0x15, 0x0c, 0x0b, 0x0b, 0x07, 0x07, 0x06, 0x10, 0x11, 0x06, 0x11, 0x06, 0x11, 0x02, 0x09,
-    0x03, 0x02, 0x72, 0x0a, 0x02, 0x08, 0x72, 0x00, 0x2b, 0x32, 0x2b, 0x32, 0x11, 0x39, 0x39, 0x2f,
-    0x2f, 0x11, 0x33, 0x11, 0x33, 0x12, 0x39, 0x11, 0x33, 0x30, 0x31, 0x41, 0x11, 0x23, 0x11, 0x21,
-    0x01, 0x21, 0x27, 0x33, 0x01, 0x13, 0x01, 0x37, 0x01, 0x01, 0x15, 0x21, 0x35, 0x01, 0x4d, 0x7c,
-    0x04, 0x0c, 0xfd, 0x79, 0xfe, 0xc5, 0x0b, 0xff, 0x02, 0x33, 0x2d, 0xfd, 0x9a, 0x47, 0x02, 0xb9,
-    0xfd, 0x62, 0xfd, 0x9c, 0x05, 0xb0, 0xfa, 0x50, 0x05, 0xb0, 0xfc, 0xfb, 0x6b, 0x02, 0x9a, 0xfa,
-    0x50, 0x02, 0xb9, 0x6c, 0xfc, 0xdb, 0x04, 0xab, 0x67, 0x67, 0x00, 0x04, 0x00, 0x09, 0x00, 0x00,
-    0x03, 0xfb, 0x06, 0x00, 0x00, 0x03, 0x00, 0x09, 0x00, 0x0d, 0x00, 0x11, 0x00, 0x2d, 0x40, 0x17,
-    0x04, 0x06, 0x72, 0x0c, 0x0b, 0x0b, 0x07, 0x07, 0x06, 0x10, 0x11, 0x06, 0x11, 0x06, 0x11, 0x02,
-    0x03, 0x00, 0x72, 0x0a, 0x02, 0x0a, 0x72, 0x00, 0x2b, 0x32, 0x2b, 0x11, 0x39, 0x39, 0x2f, 0x2f,
-    0x11, 0x33, 0x11, 0x33, 0x12, 0x39, 0x11, 0x33, 0x2b, 0x30, 0x31, 0x41, 0x11, 0x23, 0x11, 0x01,
-    0x01, 0x23, 0x27, 0x33, 0x01, 0x13, 0x01, 0x37, 0x01, 0x01, 0x15, 0x21, 0x35, 0x01, 0x2b, 0x77,
-    0x03, 0x1b, 0xfe, 0x14, 0xde, 0x16, 0xbb, 0x01, 0x93, 0x2d, 0xfe, 0x3c, 0x43, 0x02, 0x12, 0xfe,
-    0x72, 0xfd, 0x9c, 0x06, 0x00, 0xfa, 0x00, 0x06, 0x00, 0xfe, 0x3a, 0xfd, 0xd5, 0x68, 0x01, 0xc3,
-    0xfb, 0xc6, 0x02, 0x22, 0x68, 0xfd, 0x76, 0x05, 0x3f, 0x67, 0x67, 0x00, 0x00, 0x02, 0x00, 0x18,
-    0x00, 0x00, 0x04, 0xaf, 0x05, 0xb0, 0x00, 0x08, 0x00, 0x0c, 0x00, 0x1d, 0x40, 0x0f, 0x0c, 0x01,
-    0x04, 0x07, 0x03, 0x0b, 0x0b, 0x06, 0x03, 0x08, 0x02, 0x72, 0x06, 0x08, 0x72, 0x00, 0x2b, 0x2b,
-    0x32, 0x11, 0x39, 0x2f, 0x17, 0x39, 0x33, 0x30, 0x31, 0x53, 0x01, 0x01, 0x33, 0x01, 0x11, 0x23,
-    0x11, 0x01, 0x01, 0x15, 0x21, 0x35, 0xab, 0x01, 0xb9, 0x01, 0xbc, 0x8f, 0xfd, 0xf2, 0x7b, 0xfd,
-    0xf2, 0x03, 0x7d, 0xfd, 0x9c, 0x05, 0xb0, 0xfc, 0xe8, 0x03, 0x18, 0xfc, 0x75, 0xfd, 0xdb, 0x02,
-    0x25, 0x03, 0x8b, 0xfc, 0xd2, 0x67, 0x67, 0x00, 0x00, 0x04, 0x00, 0x2d, 0xfe, 0x60, 0x03, 0xc4,
-    0x04, 0x3a, 0x00, 0x03, 0x00, 0x08, 0x00, 0x0d, 0x00, 0x11, 0x00, 0x17, 0x40, 0x0b, 0x11, 0x10,
-    0x10, 0x02, 0x05, 0x0d, 0x06, 0x72, 0x02, 0x0e, 0x72, 0x00, 0x2b, 0x2b, 0x32, 0x12, 0x39, 0x2f,
-    0x33, 0x30, 0x31, 0x65, 0x11, 0x23, 0x11, 0x37, 0x01, 0x33, 0x01, 0x23, 0x01, 0x01, 0x17, 0x23,
-    0x01, 0x01, 0x15, 0x21, 0x35, 0x02, 0x34, 0x77, 0x54, 0x01, 0x37, 0x7c, 0xfe, 0x65, 0x57, 0xfe,
-    0xd7, 0x01, 0x3b, 0x3c, 0x57, 0xfe, 0x64, 0x02, 0xfe, 0xfd, 0x9c, 0x65, 0xfd, 0xfb, 0x02, 0x05,
-    0x8b, 0x03, 0x4a, 0xfb, 0xc6, 0x04, 0x3a, 0xfc, 0xb6, 0xf0, 0x04, 0x3a, 0xfc, 0x2a, 0x67, 0x67,
-    0x00, 0x02, 0x00, 0x38, 0x00, 0x00, 0x04, 0xaf, 0x05, 0xb0, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x1f,
-    0x40, 0x0f, 0x0f, 0x07, 0x05, 0x01, 0x04, 0x0a, 0x03, 0x0e, 0x0e, 0x09, 0x05, 0x03, 0x00, 0x02,
-    0x72, 0x00, 0x2b, 0x32, 0x2f, 0x33, 0x39, 0x2f, 0x17, 0x39, 0x12, 0x39, 0x33, 0x30, 0x31, 0x53,
-    0x01, 0x01, 0x33, 0x01, 0x01, 0x23, 0x01, 0x01, 0x23, 0x09, 0x02, 0x15, 0x21, 0x35, 0xda, 0x01,
-    0x9a, 0x01, 0x9a, 0x92, 0xfe, 0x1e, 0x01, 0xf1, 0x93, 0xfe, 0x58, 0xfe, 0x56, 0x92, 0x01, 0xf1,
-    0xfe, 0x1e, 0x03, 0x5e, 0xfd, 0x9c, 0x05, 0xb0, 0xfd, 0x9a, 0x02, 0x66, 0xfd, 0x33, 0xfd, 0x1d,
-    0x02, 0x7b, 0xfd, 0x85, 0x02, 0xe3, 0x02, 0xcd, 0xfd, 0x6f, 0x67, 0x67, 0x00, 0x02, 0x00, 0x31,
-    0x00, 0x00, 0x03, 0xb3, 0x04, 0x3a, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x1f, 0x40, 0x0f, 0x0f, 0x07,
-    0x05, 0x01, 0x0a, 0x04, 0x03, 0x0e, 0x0e, 0x09, 0x05, 0x03, 0x00, 0x06, 0x72, 0x00, 0x2b, 0x32,
-    0x2f, 0x33, 0x39, 0x2f, 0x17, 0x39, 0x12, 0x39, 0x33, 0x30, 0x31, 0x53, 0x01, 0x01, 0x33, 0x01,
-    0x01, 0x23, 0x01, 0x01, 0x23, 0x09, 0x02, 0x15, 0x21, 0x35, 0xcd, 0x01, 0x23, 0x01, 0x25, 0x8e,
-    0xfe, 0x91, 0x01, 0x7f, 0x8d, 0xfe, 0xcc, 0xfe, 0xcc, 0x8d, 0x01, 0x7e, 0xfe, 0x91, 0x02, 0xe8,
-    0xfd, 0x9c, 0x04, 0x3a, 0xfe, 0x4b, 0x01, 0xb5, 0xfd, 0xee, 0xfd, 0xd8, 0x01, 0xc9, 0xfe, 0x37,
-    0x02, 0x28, 0x02, 0x12, 0xfe, 0x25, 0x67, 0x67, 0xff, 0xff, 0x00, 0x6c, 0xff, 0xec, 0x03, 0xe9,
-    0x04, 0x4e, 0x06, 0x06, 0x00, 0xbf, 0x00, 0x00, 0xff, 0xff, 0x00, 0x19, 0x00, 0x00, 0x04, 0x3f,
-    0x05, 0xb0, 0x06, 0x26, 0x00, 0x2a, 0x00, 0x00, 0x01, 0x07, 0x02, 0x40, 0xff, 0x9c, 0xfe, 0x72,
-    0x00, 0x0e, 0xb4, 0x03, 0x0e, 0x02, 0x02, 0x00, 0xb8, 0x01, 0x08, 0xb0, 0x56, 0x00, 0x2b, 0x34,
-    0xff, 0xff, 0x00, 0x7f, 0x02, 0xae, 0x05, 0xb7, 0x03, 0x15, 0x06, 0x06, 0x01, 0x82, 0x00, 0x00,
-    0xff, 0xff, 0x00, 0x6a, 0x00, 0x00, 0x04, 0x1a, 0x05, 0xc4, 0x06, 0x06, 0x00, 0x16, 0x00, 0x00,
-    0xff, 0xff, 0x00, 0x63, 0xff, 0xec, 0x03, 0xf5, 0x05, 0xc4, 0x06, 0x06, 0x00, 0x17, 0x00, 0x00,
-    0xff, 0xff, 0x00, 0x44, 0x00, 0x00, 0x04, 0x4c, 0x05, 0xb0, 0x06, 0x06, 0x00, 0x18, 0x00, 0x00,
-    0xff, 0xff, 0x00, 0xa8, 0xff, 0xec, 0x04, 0x17, 0x05, 0xb0, 0x06, 0x06, 0x00, 0x19, 0x00, 0x00,
-    0xff, 0xff, 0x00, 0x97, 0xff, 0xec, 0x04, 0x1d, 0x05, 0xbb, 0x04, 0x06, 0x00, 0x1a, 0x14, 0x00,
-    0xff, 0xff, 0x00, 0x7f, 0xff, 0xec, 0x04, 0x1e, 0x05, 0xc4, 0x04, 0x06, 0x00, 0x1c, 0x14, 0x00,
-    0xff, 0xff, 0x00, 0x66, 0xff, 0xf5, 0x03, 0xed, 0x05, 0xc4, 0x04, 0x06, 0x00, 0x1d, 0x00, 0x00,
-    0xff, 0xff, 0x00, 0x8c, 0xff, 0xec, 0x04, 0x0c, 0x05, 0xc5, 0x04, 0x06, 0x00, 0x14, 0x14, 0x00,
-    0xff, 0xff, 0x00, 0x91, 0xff, 0xec, 0x04, 0xd4, 0x07, 0x56, 0x06, 0x26, 0x00, 0x2b, 0x00, 0x00,
-    0x01, 0x07, 0x00, 0x75, 0x01, 0xec, 0x01, 0x56, 0x00, 0x0b, 0xb6, 0x01, 0x2c, 0x10, 0x01, 0x01,
-    0x6d, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x6d, 0xfe, 0x51, 0x03, 0xd4, 0x05, 0xff,
-    0x06, 0x26, 0x00, 0x4b, 0x00, 0x00, 0x01, 0x07, 0x00, 0x75, 0x01, 0x6e, 0xff, 0xff, 0x00, 0x0b,
-    0xb6, 0x03, 0x3f, 0x1a, 0x01, 0x01, 0x8c, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0xb9,
-    0x00, 0x00, 0x04, 0xf5, 0x07, 0x3b, 0x06, 0x26, 0x00, 0x32, 0x00, 0x00, 0x01, 0x07, 0x00, 0x44,
-    0x01, 0x6a, 0x01, 0x3b, 0x00, 0x0b, 0xb6, 0x01, 0x0c, 0x09, 0x01, 0x01, 0x61, 0x56, 0x00, 0x2b,
-    0x34, 0x00, 0xff, 0xff, 0x00, 0x9d, 0x00, 0x00, 0x03, 0xcd, 0x05, 0xff, 0x06, 0x26, 0x00, 0x52,
-    0x00, 0x00, 0x01, 0x07, 0x00, 0x44, 0x00, 0xd3, 0xff, 0xff, 0x00, 0x0b, 0xb6, 0x02, 0x1e, 0x03,
-    0x01, 0x01, 0xa0, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x1f, 0x00, 0x00, 0x04, 0xe2,
-    0x07, 0x27, 0x06, 0x26, 0x00, 0x25, 0x00, 0x00, 0x01, 0x07, 0x00, 0xac, 0x04, 0x79, 0x01, 0x39,
-    0x00, 0x0d, 0xb7, 0x04, 0x03, 0x0e, 0x03, 0x01, 0x01, 0x66, 0x56, 0x00, 0x2b, 0x34, 0x34, 0x00,
-    0xff, 0xff, 0x00, 0x65, 0xff, 0xec, 0x03, 0xc8, 0x05, 0xeb, 0x06, 0x26, 0x00, 0x45, 0x00, 0x00,
-    0x01, 0x07, 0x00, 0xac, 0x04, 0x3a, 0xff, 0xfd, 0x00, 0x0d, 0xb7, 0x03, 0x02, 0x3c, 0x0f, 0x01,
-    0x01, 0x91, 0x56, 0x00, 0x2b, 0x34, 0x34, 0x00, 0xff, 0xff, 0x00, 0x91, 0x00, 0x00, 0x04, 0x42,
-    0x07, 0x2c, 0x06, 0x26, 0x00, 0x29, 0x00, 0x00, 0x01, 0x07, 0x00, 0xac, 0x04, 0x62, 0x01, 0x3e,
-    0x00, 0x0d, 0xb7, 0x05, 0x04, 0x11, 0x07, 0x01, 0x01, 0x71, 0x56, 0x00, 0x2b, 0x34, 0x34, 0x00,
-    0xff, 0xff, 0x00, 0x5a, 0xff, 0xec, 0x03, 0xd6, 0x05, 0xeb, 0x06, 0x26, 0x00, 0x49, 0x00, 0x00,
-    0x01, 0x07, 0x00, 0xac, 0x04, 0x2d, 0xff, 0xfd, 0x00, 0x0d, 0xb7, 0x02, 0x01, 0x2d, 0x0b, 0x01,
-    0x01, 0x91, 0x56, 0x00, 0x2b, 0x34, 0x34, 0x00, 0xff, 0xff, 0xff, 0x37, 0x00, 0x00, 0x01, 0xd1,
-    0x07, 0x2c, 0x06, 0x26, 0x00, 0x2d, 0x00, 0x00, 0x01, 0x07, 0x00, 0xac, 0x03, 0x08, 0x01, 0x3e,
-    0x00, 0x0d, 0xb7, 0x02, 0x01, 0x05, 0x03, 0x01, 0x01, 0x71, 0x56, 0x00, 0x2b, 0x34, 0x34, 0x00,
-    0xff, 0xff, 0xff, 0x0c, 0x00, 0x00, 0x01, 0xa6, 0x05, 0xdf, 0x06, 0x26, 0x00, 0x8d, 0x00, 0x00,
-    0x01, 0x07, 0x00, 0xac, 0x02, 0xdd, 0xff, 0xf1, 0x00, 0x0d, 0xb7, 0x02, 0x01, 0x05, 0x03, 0x01,
-    0x01, 0xa3, 0x56, 0x00, 0x2b, 0x34, 0x34, 0x00, 0xff, 0xff, 0x00, 0x7e, 0xff, 0xec, 0x04, 0xed,
-    0x07, 0x32, 0x06, 0x26, 0x00, 0x33, 0x00, 0x00, 0x01, 0x07, 0x00, 0xac, 0x04, 0xaa, 0x01, 0x44,
-    0x00, 0x0d, 0xb7, 0x03, 0x02, 0x2d, 0x11, 0x01, 0x01, 0x54, 0x56, 0x00, 0x2b, 0x34, 0x34, 0x00,
-    0xff, 0xff, 0x00, 0x5b, 0xff, 0xec, 0x04, 0x21, 0x05, 0xea, 0x06, 0x26, 0x00, 0x53, 0x00, 0x00,
-    0x01, 0x07, 0x00, 0xac, 0x04, 0x32, 0xff, 0xfc, 0x00, 0x0d, 0xb7, 0x03, 0x02, 0x2d, 0x06, 0x01,
-    0x01, 0x91, 0x56, 0x00, 0x2b, 0x34, 0x34, 0x00, 0xff, 0xff, 0x00, 0x86, 0x00, 0x00, 0x04, 0xbc,
-    0x07, 0x27, 0x06, 0x26, 0x00, 0x36, 0x00, 0x00, 0x01, 0x07, 0x00, 0xac, 0x04, 0x57, 0x01, 0x39,
-    0x00, 0x0d, 0xb7, 0x03, 0x02, 0x1f, 0x00, 0x01, 0x01, 0x66, 0x56, 0x00, 0x2b, 0x34, 0x34, 0x00,
-    0xff, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x02, 0x94, 0x05, 0xea, 0x06, 0x26, 0x00, 0x56, 0x00, 0x00,
-    0x01, 0x07, 0x00, 0xac, 0x03, 0x91, 0xff, 0xfc, 0x00, 0x0d, 0xb7, 0x03, 0x02, 0x18, 0x03, 0x01,
-    0x01, 0xa5, 0x56, 0x00, 0x2b, 0x34, 0x34, 0x00, 0xff, 0xff, 0x00, 0xa3, 0xff, 0xec, 0x04, 0xa3,
-    0x07, 0x27, 0x06, 0x26, 0x00, 0x39, 0x00, 0x00, 0x01, 0x07, 0x00, 0xac, 0x04, 0xa1, 0x01, 0x39,
-    0x00, 0x0d, 0xb7, 0x02, 0x01, 0x17, 0x0b, 0x01, 0x01, 0x66, 0x56, 0x00, 0x2b, 0x34, 0x34, 0x00,
-    0xff, 0xff, 0x00, 0x63, 0xff, 0xec, 0x03, 0xcb, 0x05, 0xec, 0x06, 0x26, 0x00, 0x59, 0x00, 0x00,
-    0x01, 0x07, 0x00, 0xac, 0x04, 0x34, 0xff, 0xfe, 0x00, 0x0d, 0xb7, 0x03, 0x02, 0x1d, 0x11, 0x01,
-    0x01, 0xa5, 0x56, 0x00, 0x2b, 0x34, 0x34, 0x00, 0xff, 0xff, 0xff, 0x4f, 0x00, 0x00, 0x04, 0xe8,
-    0x06, 0x33, 0x04, 0x26, 0x00, 0xd0, 0x64, 0x00, 0x00, 0x07, 0x00, 0xae, 0xfe, 0x87, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0xb9, 0xfe, 0xd3, 0x04, 0x77, 0x05, 0xb0, 0x06, 0x26, 0x00, 0x26, 0x00, 0x00,
-    0x01, 0x07, 0x00, 0xad, 0x04, 0x93, 0x00, 0x0a, 0x00, 0x0e, 0xb4, 0x02, 0x34, 0x1b, 0x01, 0x01,
-    0xb8, 0xff, 0x7f, 0xb0, 0x56, 0x00, 0x2b, 0x34, 0xff, 0xff, 0x00, 0x9b, 0xfe, 0xbf, 0x04, 0x04,
-    0x06, 0x00, 0x06, 0x26, 0x00, 0x46, 0x00, 0x00, 0x01, 0x07, 0x00, 0xad, 0x04, 0x98, 0xff, 0xf6,
-    0x00, 0x0e, 0xb4, 0x03, 0x33, 0x04, 0x01, 0x01, 0xb8, 0xff, 0x6b, 0xb0, 0x56, 0x00, 0x2b, 0x34,
-    0xff, 0xff, 0x00, 0xb9, 0xfe, 0xd3, 0x04, 0xbe, 0x05, 0xb0, 0x06, 0x26, 0x00, 0x28, 0x00, 0x00,
-    0x01, 0x07, 0x00, 0xad, 0x04, 0xa2, 0x00, 0x0a, 0x00, 0x0e, 0xb4, 0x02, 0x22, 0x1d, 0x01, 0x01,
-    0xb8, 0xff, 0x7f, 0xb0, 0x56, 0x00, 0x2b, 0x34, 0xff, 0xff, 0x00, 0x6d, 0xfe, 0xc9, 0x03, 0xd4,
-    0x06, 0x00, 0x06, 0x26, 0x00, 0x48, 0x00, 0x00, 0x01, 0x07, 0x00, 0xad, 0x04, 0xa8, 0x00, 0x00,
-    0x00, 0x0e, 0xb4, 0x03, 0x33, 0x16, 0x01, 0x01, 0xb8, 0xff, 0x89, 0xb0, 0x56, 0x00, 0x2b, 0x34,
-    0xff, 0xff, 0x00, 0xb9, 0xfe, 0x37, 0x04, 0xbe, 0x05, 0xb0, 0x06, 0x26, 0x00, 0x28, 0x00, 0x00,
-    0x01, 0x07, 0x01, 0xd4, 0x01, 0x5f, 0xfe, 0xee, 0x00, 0x0e, 0xb4, 0x02, 0x28, 0x1d, 0x01, 0x01,
-    0xb8, 0xff, 0x97, 0xb0, 0x56, 0x00, 0x2b, 0x34, 0xff, 0xff, 0x00, 0x6d, 0xfe, 0x2d, 0x03, 0xd4,
-    0x06, 0x00, 0x06, 0x26, 0x00, 0x48, 0x00, 0x00, 0x01, 0x07, 0x01, 0xd4, 0x01, 0x64, 0xfe, 0xe4,
-    0x00, 0x0e, 0xb4, 0x03, 0x39, 0x16, 0x01, 0x01, 0xb8, 0xff, 0xa1, 0xb0, 0x56, 0x00, 0x2b, 0x34,
-    0xff, 0xff, 0x00, 0xb9, 0xfe, 0xd3, 0x04, 0xef, 0x05, 0xb0, 0x06, 0x26, 0x00, 0x2c, 0x00, 0x00,
-    0x01, 0x07, 0x00, 0xad, 0x05, 0x14, 0x00, 0x0a, 0x00, 0x0e, 0xb4, 0x03, 0x0f, 0x0a, 0x01, 0x01,
-    0xb8, 0xff, 0x7f, 0xb0, 0x56, 0x00, 0x2b, 0x34, 0xff, 0xff, 0x00, 0x9d, 0xfe, 0xd3, 0x03, 0xcd,
-    0x06, 0x00, 0x06, 0x26, 0x00, 0x4c, 0x00, 0x00, 0x01, 0x07, 0x00, 0xad, 0x04, 0x8d, 0x00, 0x0a,
-    0x00, 0x0e, 0xb4, 0x02, 0x1e, 0x02, 0x01, 0x01, 0xb8, 0xff, 0x7f, 0xb0, 0x56, 0x00, 0x2b, 0x34,
-    0xff, 0xff, 0x00, 0xb9, 0x00, 0x00, 0x04, 0xe8, 0x07, 0x0c, 0x06, 0x26, 0x00, 0x2f, 0x00, 0x00,
-    0x01, 0x07, 0x00, 0x75, 0x01, 0x98, 0x01, 0x0c, 0x00, 0x0b, 0xb6, 0x03, 0x0e, 0x03, 0x01, 0x01,
-    0x5b, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x9d, 0x00, 0x00, 0x03, 0xe3, 0x07, 0x40,
-    0x06, 0x26, 0x00, 0x4f, 0x00, 0x00, 0x01, 0x07, 0x00, 0x75, 0x01, 0x5f, 0x01, 0x40, 0x00, 0x0b,
-    0xb6, 0x03, 0x0e, 0x03, 0x01, 0x00, 0x1b, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0xb9,
-    0xff, 0x2d, 0x04, 0xe8, 0x05, 0xb0, 0x06, 0x26, 0x00, 0x2f, 0x00, 0x00, 0x01, 0x07, 0x00, 0xad,
-    0x04, 0xca, 0x00, 0x64, 0x00, 0x0e, 0xb4, 0x03, 0x11, 0x02, 0x01, 0x01, 0xb8, 0xff, 0xcf, 0xb0,
-    0x56, 0x00, 0x2b, 0x34, 0xff, 0xff, 0x00, 0x9d, 0xff, 0x25, 0x03, 0xe3, 0x06, 0x00, 0x06, 0x26,
-    0x00, 0x4f, 0x00, 0x00, 0x01, 0x07, 0x00, 0xad, 0x04, 0x54, 0x00, 0x5d, 0x00, 0x0e, 0xb4, 0x03,
-    0x11, 0x02, 0x01, 0x01, 0xb8, 0xff, 0xbc, 0xb0, 0x56, 0x00, 0x2b, 0x34, 0xff, 0xff, 0x00, 0xb9,
-    0xfe, 0xd3, 0x04, 0x03, 0x05, 0xb0, 0x06, 0x26, 0x00, 0x30, 0x00, 0x00, 0x01, 0x07, 0x00, 0xad,
-    0x04, 0xb7, 0x00, 0x0a, 0x00, 0x0e, 0xb4, 0x02, 0x0b, 0x02, 0x01, 0x01, 0xb8, 0xff, 0x7f, 0xb0,
-    0x56, 0x00, 0x2b, 0x34, 0xff, 0xff, 0x00, 0x90, 0xfe, 0xd3, 0x01, 0x35, 0x06, 0x00, 0x06, 0x26,
-    0x00, 0x50, 0x00, 0x00, 0x01, 0x07, 0x00, 0xad, 0x03, 0x30, 0x00, 0x0a, 0x00, 0x0e, 0xb4, 0x01,
-    0x07, 0x02, 0x01, 0x01, 0xb8, 0xff, 0x7f, 0xb0, 0x56, 0x00, 0x2b, 0x34, 0xff, 0xff, 0x00, 0xb9,
-    0xfe, 0xd3, 0x06, 0x33, 0x05, 0xb0, 0x06, 0x26, 0x00, 0x31, 0x00, 0x00, 0x01, 0x07, 0x00, 0xad,
-    0x05, 0xbf, 0x00, 0x0a, 0x00, 0x0e, 0xb4, 0x03, 0x14, 0x06, 0x01, 0x01, 0xb8, 0xff, 0x7f, 0xb0,
-    0x56, 0x00, 0x2b, 0x34, 0xff, 0xff, 0x00, 0x96, 0xfe, 0xd3, 0x06, 0x85, 0x04, 0x4e, 0x06, 0x26,
-    0x00, 0x51, 0x00, 0x00, 0x01, 0x07, 0x00, 0xad, 0x05, 0xd4, 0x00, 0x0a, 0x00, 0x0e, 0xb4, 0x03,
-    0x36, 0x02, 0x01, 0x01, 0xb8, 0xff, 0x7f, 0xb0, 0x56, 0x00, 0x2b, 0x34, 0xff, 0xff, 0x00, 0xb9,
-    0xfe, 0xd3, 0x04, 0xf5, 0x05, 0xb0, 0x06, 0x26, 0x00, 0x32, 0x00, 0x00, 0x01, 0x07, 0x00, 0xad,
-    0x05, 0x1c, 0x00, 0x0a, 0x00, 0x0e, 0xb4, 0x01, 0x0d, 0x02, 0x01, 0x01, 0xb8, 0xff, 0x7f, 0xb0,
-    0x56, 0x00, 0x2b, 0x34, 0xff, 0xff, 0x00, 0x9d, 0xfe, 0xd3, 0x03, 0xcd, 0x04, 0x4e, 0x06, 0x26,
-    0x00, 0x52, 0x00, 0x00, 0x01, 0x07, 0x00, 0xad, 0x04, 0x83, 0x00, 0x0a, 0x00, 0x0e, 0xb4, 0x02,
-    0x1f, 0x02, 0x01, 0x01, 0xb8, 0xff, 0x7f, 0xb0, 0x56, 0x00, 0x2b, 0x34, 0xff, 0xff, 0x00, 0x7e,
-    0xff, 0xec, 0x04, 0xed, 0x07, 0xe0, 0x06, 0x26, 0x00, 0x33, 0x00, 0x00, 0x01, 0x07, 0x02, 0x50,
-    0x04, 0xf1, 0x01, 0x63, 0x00, 0x0d, 0xb7, 0x03, 0x02, 0x31, 0x11, 0x01, 0x01, 0x5a, 0x56, 0x00,
-    0x2b, 0x34, 0x34, 0x00, 0xff, 0xff, 0x00, 0xb9, 0x00, 0x00, 0x04, 0x93, 0x07, 0x41, 0x06, 0x26,
-    0x00, 0x34, 0x00, 0x00, 0x01, 0x07, 0x00, 0x75, 0x01, 0x84, 0x01, 0x41, 0x00, 0x0b, 0xb6, 0x01,
-    0x18, 0x0f, 0x01, 0x01, 0x6c, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x9b, 0xfe, 0x60,
-    0x04, 0x03, 0x05, 0xf5, 0x06, 0x26, 0x00, 0x54, 0x00, 0x00, 0x01, 0x07, 0x00, 0x75, 0x01, 0x9b,
-    0xff, 0xf5, 0x00, 0x0b, 0xb6, 0x03, 0x30, 0x03, 0x01, 0x01, 0x96, 0x56, 0x00, 0x2b, 0x34, 0x00,
-    0xff, 0xff, 0x00, 0xb6, 0xfe, 0xd3, 0x04, 0xbc, 0x05, 0xb0, 0x06, 0x26, 0x00, 0x36, 0x00, 0x00,
-    0x01, 0x07, 0x00, 0xad, 0x04, 0xa9, 0x00, 0x0a, 0x00, 0x0e, 0xb4, 0x02, 0x21, 0x18, 0x01, 0x01,
-    0xb8, 0xff, 0x7f, 0xb0, 0x56, 0x00, 0x2b, 0x34, 0xff, 0xff, 0x00, 0x87, 0xfe, 0xd8, 0x02, 0x94,
-    0x04, 0x4e, 0x06, 0x26, 0x00, 0x56, 0x00, 0x00, 0x01, 0x07, 0x00, 0xad, 0x03, 0x27, 0x00, 0x0f,
-    0x00, 0x0e, 0xb4, 0x02, 0x1a, 0x02, 0x01, 0x01, 0xb8, 0xff, 0x80, 0xb0, 0x56, 0x00, 0x2b, 0x34,
-    0xff, 0xff, 0x00, 0x59, 0xfe, 0xc3, 0x04, 0x6d, 0x05, 0xc4, 0x06, 0x26, 0x00, 0x37, 0x00, 0x00,
-    0x01, 0x07, 0x00, 0xad, 0x04, 0xbf, 0xff, 0xfb, 0x00, 0x0e, 0xb4, 0x01, 0x3d, 0x2b, 0x01, 0x01,
-    0xb8, 0xff, 0x88, 0xb0, 0x56, 0x00, 0x2b, 0x34, 0xff, 0xff, 0x00, 0x66, 0xfe, 0xc1, 0x03, 0x9d,
-    0x04, 0x4e, 0x06, 0x26, 0x00, 0x57, 0x00, 0x00, 0x01, 0x07, 0x00, 0xad, 0x04, 0x62, 0xff, 0xf9,
-    0x00, 0x0e, 0xb4, 0x01, 0x39, 0x29, 0x01, 0x01, 0xb8, 0xff, 0x7f, 0xb0, 0x56, 0x00, 0x2b, 0x34,
-    0xff, 0xff, 0x00, 0x35, 0xfe, 0xc9, 0x04, 0x94, 0x05, 0xb0, 0x06, 0x26, 0x00, 0x38, 0x00, 0x00,
-    0x01, 0x07, 0x00, 0xad, 0x04, 0xae, 0x00, 0x00, 0x00, 0x0e, 0xb4, 0x02, 0x0b, 0x02, 0x01, 0x01,
-    0xb8, 0xff, 0x75, 0xb0, 0x56, 0x00, 0x2b, 0x34, 0xff, 0xff, 0x00, 0x18, 0xfe, 0xc9, 0x02, 0x4a,
-    0x05, 0x50, 0x06, 0x26, 0x00, 0x58, 0x00, 0x00, 0x01, 0x07, 0x00, 0xad, 0x03, 0xfa, 0x00, 0x00,
-    0x00, 0x0e, 0xb4, 0x02, 0x19, 0x11, 0x01, 0x01, 0xb8, 0xff, 0x89, 0xb0, 0x56, 0x00, 0x2b, 0x34,
-    0xff, 0xff, 0x00, 0xa3, 0xff, 0xec, 0x04, 0xa3, 0x07, 0xd4, 0x06, 0x26, 0x00, 0x39, 0x00, 0x00,
-    0x01, 0x07, 0x02, 0x50, 0x04, 0xe8, 0x01, 0x58, 0x00, 0x0d, 0xb7, 0x02, 0x01, 0x1b, 0x00, 0x01,
-    0x01, 0x6c, 0x56, 0x00, 0x2b, 0x34, 0x34, 0x00, 0xff, 0xff, 0x00, 0x20, 0x00, 0x00, 0x04, 0xd1,
-    0x07, 0x1e, 0x06, 0x26, 0x00, 0x3a, 0x00, 0x00, 0x01, 0x07, 0x00, 0xa5, 0x00, 0xc3, 0x01, 0x4a,
-    0x00, 0x0b, 0xb6, 0x02, 0x18, 0x09, 0x01, 0x01, 0x76, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff,
-    0x00, 0x26, 0x00, 0x00, 0x03, 0xb2, 0x05, 0xd2, 0x06, 0x26, 0x00, 0x5a, 0x00, 0x00, 0x01, 0x06,
-    0x00, 0xa5, 0x3d, 0xfe, 0x00, 0x0b, 0xb6, 0x02, 0x18, 0x09, 0x01, 0x01, 0xa0, 0x56, 0x00, 0x2b,
-    0x34, 0x00, 0xff, 0xff, 0x00, 0x20, 0xfe, 0xd3, 0x04, 0xd1, 0x05, 0xb0, 0x06, 0x26, 0x00, 0x3a,
-    0x00, 0x00, 0x01, 0x07, 0x00, 0xad, 0x04, 0xc3, 0x00, 0x0a, 0x00, 0x0e, 0xb4, 0x02, 0x0d, 0x04,
-    0x01, 0x01, 0xb8, 0xff, 0x7f, 0xb0, 0x56, 0x00, 0x2b, 0x34, 0xff, 0xff, 0x00, 0x26, 0xfe, 0xd3,
-    0x03, 0xb2, 0x04, 0x3a, 0x06, 0x26, 0x00, 0x5a, 0x00, 0x00, 0x01, 0x07, 0x00, 0xad, 0x04, 0x39,
-    0x00, 0x0a, 0x00, 0x0e, 0xb4, 0x02, 0x0d, 0x04, 0x01, 0x01, 0xb8, 0xff, 0x7f, 0xb0, 0x56, 0x00,
-    0x2b, 0x34, 0xff, 0xff, 0x00, 0x3d, 0xfe, 0xd3, 0x06, 0xf7, 0x05, 0xb0, 0x06, 0x26, 0x00, 0x3b,
-    0x00, 0x00, 0x01, 0x07, 0x00, 0xad, 0x05, 0xe5, 0x00, 0x0a, 0x00, 0x0e, 0xb4, 0x04, 0x19, 0x13,
-    0x01, 0x01, 0xb8, 0xff, 0x7f, 0xb0, 0x56, 0x00, 0x2b, 0x34, 0xff, 0xff, 0x00, 0x3f, 0xfe, 0xd3,
-    0x05, 0xc2, 0x04, 0x3a, 0x06, 0x26, 0x00, 0x5b, 0x00, 0x00, 0x01, 0x07, 0x00, 0xad, 0x05, 0x48,
-    0x00, 0x0a, 0x00, 0x0e, 0xb4, 0x04, 0x19, 0x13, 0x01, 0x01, 0xb8, 0xff, 0x7f, 0xb0, 0x56, 0x00,
-    0x2b, 0x34, 0xff, 0xff, 0x00, 0x5b, 0xfe, 0xd3, 0x04, 0x72, 0x05, 0xb0, 0x06, 0x26, 0x00, 0x3e,
-    0x00, 0x00, 0x01, 0x07, 0x00, 0xad, 0x04, 0xbd, 0x00, 0x0a, 0x00, 0x0e, 0xb4, 0x03, 0x11, 0x02,
-    0x01, 0x01, 0xb8, 0xff, 0x7f, 0xb0, 0x56, 0x00, 0x2b, 0x34, 0xff, 0xff, 0x00, 0x58, 0xfe, 0xd3,
-    0x03, 0xab, 0x04, 0x3a, 0x06, 0x26, 0x00, 0x5e, 0x00, 0x00, 0x01, 0x07, 0x00, 0xad, 0x04, 0x5d,
-    0x00, 0x0a, 0x00, 0x0e, 0xb4, 0x03, 0x11, 0x02, 0x01, 0x01, 0xb8, 0xff, 0x7f, 0xb0, 0x56, 0x00,
-    0x2b, 0x34, 0xff, 0xff, 0xfe, 0xc9, 0xff, 0xec, 0x05, 0x33, 0x05, 0xd0, 0x04, 0x26, 0x00, 0x33,
-    0x46, 0x00, 0x01, 0x07, 0x01, 0x71, 0xfe, 0x69, 0x00, 0x00, 0x00, 0x0d, 0xb7, 0x03, 0x02, 0x2e,
-    0x11, 0x00, 0x00, 0x12, 0x56, 0x00, 0x2b, 0x34, 0x34, 0x00, 0xff, 0xff, 0x00, 0x18, 0x00, 0x00,
-    0x04, 0x3b, 0x05, 0x10, 0x06, 0x26, 0x02, 0x4d, 0x00, 0x00, 0x00, 0x07, 0x00, 0xae, 0xff, 0xcb,
-    0xfe, 0xdc, 0xff, 0xff, 0xff, 0xc7, 0x00, 0x00, 0x03, 0xe7, 0x05, 0x13, 0x04, 0x26, 0x02, 0x42,
-    0x3c, 0x00, 0x00, 0x07, 0x00, 0xae, 0xfe, 0xff, 0xfe, 0xdf, 0xff, 0xff, 0xff, 0xdb, 0x00, 0x00,
-    0x04, 0x7e, 0x05, 0x12, 0x04, 0x26, 0x01, 0xfe, 0x3c, 0x00, 0x00, 0x07, 0x00, 0xae, 0xff, 0x13,
-    0xfe, 0xdd, 0xff, 0xff, 0xff, 0xe8, 0x00, 0x00, 0x01, 0x65, 0x05, 0x11, 0x04, 0x26, 0x01, 0xfd,
-    0x3c, 0x00, 0x00, 0x07, 0x00, 0xae, 0xff, 0x20, 0xfe, 0xdc, 0xff, 0xff, 0x00, 0x07, 0xff, 0xf0,
-    0x04, 0x4a, 0x05, 0x10, 0x04, 0x26, 0x01, 0xf7, 0x0a, 0x00, 0x00, 0x07, 0x00, 0xae, 0xff, 0x3f,
-    0xfe, 0xdc, 0xff, 0xff, 0xff, 0x77, 0x00, 0x00, 0x04, 0x48, 0x05, 0x10, 0x04, 0x26, 0x01, 0xed,
-    0x3c, 0x00, 0x00, 0x07, 0x00, 0xae, 0xfe, 0xaf, 0xfe, 0xdc, 0xff, 0xff, 0x00, 0x31, 0x00, 0x00,
-    0x04, 0x74, 0x05, 0x0f, 0x04, 0x26, 0x02, 0x0d, 0x0a, 0x00, 0x00, 0x07, 0x00, 0xae, 0xff, 0x69,
-    0xfe, 0xdb, 0xff, 0xff, 0x00, 0x18, 0x00, 0x00, 0x04, 0x3b, 0x04, 0x8d, 0x06, 0x06, 0x02, 0x4d,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x9b, 0x00, 0x00, 0x03, 0xdd, 0x04, 0x8d, 0x06, 0x06, 0x02, 0x4c,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x9b, 0x00, 0x00, 0x03, 0xab, 0x04, 0x8d, 0x06, 0x06, 0x02, 0x42,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x4c, 0x00, 0x00, 0x03, 0xd7, 0x04, 0x8d, 0x06, 0x06, 0x01, 0xec,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x9b, 0x00, 0x00, 0x04, 0x42, 0x04, 0x8d, 0x06, 0x06, 0x01, 0xfe,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0xb2, 0x00, 0x00, 0x01, 0x29, 0x04, 0x8d, 0x06, 0x06, 0x01, 0xfd,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x9b, 0x00, 0x00, 0x04, 0x3e, 0x04, 0x8d, 0x06, 0x06, 0x01, 0xfb,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x9b, 0x00, 0x00, 0x05, 0x5b, 0x04, 0x8d, 0x06, 0x06, 0x01, 0xf9,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x9b, 0x00, 0x00, 0x04, 0x47, 0x04, 0x8d, 0x06, 0x06, 0x01, 0xf8,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x69, 0xff, 0xf0, 0x04, 0x40, 0x04, 0x9d, 0x06, 0x06, 0x01, 0xf7,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x9b, 0x00, 0x00, 0x03, 0xf4, 0x04, 0x8d, 0x06, 0x06, 0x01, 0xf6,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x2c, 0x00, 0x00, 0x03, 0xf5, 0x04, 0x8d, 0x06, 0x06, 0x01, 0xf2,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x16, 0x00, 0x00, 0x04, 0x0c, 0x04, 0x8d, 0x06, 0x06, 0x01, 0xed,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x2b, 0x00, 0x00, 0x04, 0x12, 0x04, 0x8d, 0x06, 0x06, 0x01, 0xee,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xc2, 0x00, 0x00, 0x02, 0x1d, 0x05, 0xe2, 0x06, 0x26, 0x01, 0xfd,
-    0x00, 0x00, 0x01, 0x07, 0x00, 0x6a, 0xff, 0x39, 0x00, 0x1d, 0x00, 0x0d, 0xb7, 0x02, 0x01, 0x0d,
-    0x03, 0x01, 0x01, 0x84, 0x56, 0x00, 0x2b, 0x34, 0x34, 0x00, 0xff, 0xff, 0x00, 0x16, 0x00, 0x00,
-    0x04, 0x0c, 0x05, 0xe2, 0x06, 0x26, 0x01, 0xed, 0x00, 0x00, 0x01, 0x06, 0x00, 0x6a, 0x5c, 0x1d,
-    0x00, 0x0d, 0xb7, 0x04, 0x03, 0x17, 0x09, 0x01, 0x01, 0x83, 0x56, 0x00, 0x2b, 0x34, 0x34, 0x00,
-    0xff, 0xff, 0x00, 0x9b, 0x00, 0x00, 0x03, 0xab, 0x05, 0xe2, 0x06, 0x26, 0x02, 0x42, 0x00, 0x00,
-    0x01, 0x06, 0x00, 0x6a, 0x62, 0x1d, 0x00, 0x0d, 0xb7, 0x05, 0x04, 0x19, 0x07, 0x01, 0x01, 0x83,
-    0x56, 0x00, 0x2b, 0x34, 0x34, 0x00, 0xff, 0xff, 0x00, 0x9b, 0x00, 0x00, 0x03, 0x7e, 0x06, 0x1d,
-    0x06, 0x26, 0x02, 0x04, 0x00, 0x00, 0x01, 0x07, 0x00, 0x75, 0x01, 0x45, 0x00, 0x1d, 0x00, 0x0b,
-    0xb6, 0x02, 0x08, 0x03, 0x01, 0x01, 0x83, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x4b,
-    0xff, 0xf0, 0x03, 0xd4, 0x04, 0x9d, 0x06, 0x06, 0x01, 0xf3, 0x00, 0x00, 0xff, 0xff, 0x00, 0xb2,
-    0x00, 0x00, 0x01, 0x29, 0x04, 0x8d, 0x06, 0x06, 0x01, 0xfd, 0x00, 0x00, 0xff, 0xff, 0xff, 0xc2,
-    0x00, 0x00, 0x02, 0x1d, 0x05, 0xe2, 0x06, 0x26, 0x01, 0xfd, 0x00, 0x00, 0x01, 0x07, 0x00, 0x6a,
-    0xff, 0x39, 0x00, 0x1d, 0x00, 0x0d, 0xb7, 0x02, 0x01, 0x0d, 0x03, 0x01, 0x01, 0x84, 0x56, 0x00,
-    0x2b, 0x34, 0x34, 0x00, 0xff, 0xff, 0x00, 0x3c, 0xff, 0xf0, 0x03, 0x38, 0x04, 0x8d, 0x06, 0x06,
-    0x01, 0xfc, 0x00, 0x00, 0xff, 0xff, 0x00, 0x9b, 0x00, 0x00, 0x04, 0x3e, 0x06, 0x1d, 0x06, 0x26,
-    0x01, 0xfb, 0x00, 0x00, 0x01, 0x07, 0x00, 0x75, 0x01, 0x43, 0x00, 0x1d, 0x00, 0x0b, 0xb6, 0x03,
-    0x0e, 0x03, 0x01, 0x01, 0x84, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x21, 0xff, 0xec,
-    0x04, 0x01, 0x05, 0xf2, 0x06, 0x26, 0x02, 0x1b, 0x00, 0x00, 0x01, 0x06, 0x00, 0xa1, 0x6b, 0x1f,
-    0x00, 0x0b, 0xb6, 0x02, 0x1d, 0x17, 0x01, 0x01, 0x84, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff,
-    0x00, 0x18, 0x00, 0x00, 0x04, 0x3b, 0x04, 0x8d, 0x06, 0x06, 0x02, 0x4d, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x9b, 0x00, 0x00, 0x03, 0xdd, 0x04, 0x8d, 0x06, 0x06, 0x02, 0x4c, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x9b, 0x00, 0x00, 0x03, 0x7e, 0x04, 0x8d, 0x06, 0x06, 0x02, 0x04, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x9b, 0x00, 0x00, 0x03, 0xab, 0x04, 0x8d, 0x06, 0x06, 0x02, 0x42, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x9b, 0x00, 0x00, 0x04, 0x4e, 0x05, 0xf2, 0x06, 0x26, 0x02, 0x18, 0x00, 0x00, 0x01, 0x07,
-    0x00, 0xa1, 0x00, 0xc5, 0x00, 0x1f, 0x00, 0x0b, 0xb6, 0x03, 0x11, 0x08, 0x01, 0x01, 0x84, 0x56,
-    0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x9b, 0x00, 0x00, 0x05, 0x5b, 0x04, 0x8d, 0x06, 0x06,
-    0x01, 0xf9, 0x00, 0x00, 0xff, 0xff, 0x00, 0x9b, 0x00, 0x00, 0x04, 0x42, 0x04, 0x8d, 0x06, 0x06,
-    0x01, 0xfe, 0x00, 0x00, 0xff, 0xff, 0x00, 0x69, 0xff, 0xf0, 0x04, 0x40, 0x04, 0x9d, 0x06, 0x06,
-    0x01, 0xf7, 0x00, 0x00, 0xff, 0xff, 0x00, 0x9b, 0x00, 0x00, 0x04, 0x2b, 0x04, 0x8d, 0x06, 0x06,
-    0x02, 0x09, 0x00, 0x00, 0xff, 0xff, 0x00, 0x9b, 0x00, 0x00, 0x03, 0xf4, 0x04, 0x8d, 0x06, 0x06,
-    0x01, 0xf6, 0x00, 0x00, 0xff, 0xff, 0x00, 0x6e, 0xff, 0xf0, 0x04, 0x1a, 0x04, 0x9d, 0x06, 0x06,
-    0x02, 0x4b, 0x00, 0x00, 0xff, 0xff, 0x00, 0x2c, 0x00, 0x00, 0x03, 0xf5, 0x04, 0x8d, 0x06, 0x06,
-    0x01, 0xf2, 0x00, 0x00, 0xff, 0xff, 0x00, 0x2b, 0x00, 0x00, 0x04, 0x12, 0x04, 0x8d, 0x06, 0x06,
-    0x01, 0xee, 0x00, 0x00, 0x00, 0x03, 0x00, 0x4f, 0xfe, 0x50, 0x03, 0xca, 0x04, 0x9d, 0x00, 0x1e,
-    0x00, 0x3e, 0x00, 0x42, 0x00, 0x28, 0x40, 0x13, 0x1f, 0x01, 0x02, 0x02, 0x3e, 0x3e, 0x15, 0x3f,
-    0x34, 0x34, 0x40, 0x30, 0x2a, 0x0b, 0x72, 0x0f, 0x0b, 0x15, 0x7e, 0x00, 0x3f, 0x33, 0xcc, 0x2b,
-    0xcc, 0xcd, 0x33, 0x12, 0x39, 0x12, 0x39, 0x2f, 0x33, 0x12, 0x39, 0x39, 0x30, 0x31, 0x41, 0x23,
-    0x35, 0x33, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x15, 0x23, 0x34,
-    0x3e, 0x02, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x14, 0x0e, 0x02, 0x27, 0x33, 0x32, 0x1e, 0x02, 0x15,
-    0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x33, 0x1e, 0x02, 0x33, 0x32, 0x36, 0x36, 0x35,
-    0x34, 0x2e, 0x02, 0x23, 0x23, 0x13, 0x11, 0x23, 0x11, 0x02, 0x0f, 0x9a, 0x95, 0x6f, 0x88, 0x3e,
-    0x42, 0x89, 0x6e, 0x50, 0x89, 0x54, 0x78, 0x43, 0x74, 0x98, 0x56, 0x60, 0x9e, 0x73, 0x3f, 0x3c,
-    0x6f, 0x9c, 0xfa, 0x9a, 0x72, 0xa7, 0x6d, 0x35, 0x45, 0x7b, 0xa3, 0x60, 0x4b, 0x9a, 0x83, 0x50,
-    0x78, 0x02, 0x55, 0x8f, 0x5a, 0x6c, 0x94, 0x4b, 0x2a, 0x53, 0x7a, 0x51, 0x95, 0xcc, 0x78, 0x02,
-    0x32, 0x52, 0x35, 0x60, 0x3f, 0x3f, 0x63, 0x3b, 0x33, 0x61, 0x46, 0x4b, 0x77, 0x54, 0x2c, 0x27,
-    0x4e, 0x78, 0x50, 0x45, 0x6f, 0x4f, 0x2b, 0x36, 0x2a, 0x4e, 0x6e, 0x44, 0x53, 0x7d, 0x54, 0x2a,
-    0x25, 0x50, 0x81, 0x5d, 0x4a, 0x69, 0x38, 0x38, 0x67, 0x47, 0x3b, 0x55, 0x36, 0x1a, 0xfe, 0x12,
-    0xfe, 0x20, 0x01, 0xe0, 0x00, 0x04, 0x00, 0x9b, 0xfe, 0x9d, 0x04, 0xae, 0x04, 0x8d, 0x00, 0x03,
-    0x00, 0x07, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x1d, 0x40, 0x0d, 0x03, 0x02, 0x02, 0x06, 0x0b, 0x07,
-    0x7d, 0x0f, 0x0e, 0x0a, 0x0a, 0x06, 0x12, 0x00, 0x3f, 0x33, 0x10, 0xce, 0x33, 0x3f, 0x33, 0x12,
-    0x39, 0x2f, 0x33, 0x30, 0x31, 0x41, 0x15, 0x21, 0x35, 0x13, 0x11, 0x23, 0x11, 0x21, 0x11, 0x23,
-    0x11, 0x13, 0x11, 0x23, 0x11, 0x03, 0xe5, 0xfd, 0x0f, 0x1e, 0x77, 0x03, 0xa7, 0x77, 0xe3, 0x77,
-    0x02, 0x74, 0x68, 0x68, 0x02, 0x19, 0xfb, 0x73, 0x04, 0x8d, 0xfb, 0x73, 0x04, 0x8d, 0xfb, 0xf0,
-    0xfe, 0x20, 0x01, 0xe0, 0x00, 0x02, 0x00, 0x6e, 0xfe, 0x54, 0x04, 0x1a, 0x04, 0x9d, 0x00, 0x27,
-    0x00, 0x2b, 0x00, 0x18, 0x40, 0x0b, 0x19, 0x10, 0x7e, 0x28, 0x24, 0x24, 0x2a, 0x2a, 0x05, 0x0b,
-    0x72, 0x00, 0x2b, 0x32, 0x2f, 0x32, 0x11, 0x33, 0x3f, 0x33, 0x30, 0x31, 0x41, 0x33, 0x0e, 0x02,
-    0x23, 0x22, 0x2e, 0x02, 0x35, 0x35, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x16, 0x16, 0x17, 0x23, 0x2e,
-    0x02, 0x23, 0x22, 0x0e, 0x02, 0x15, 0x15, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x36, 0x36, 0x05, 0x11,
-    0x23, 0x11, 0x03, 0xa2, 0x78, 0x0d, 0x72, 0xc7, 0x8b, 0x6c, 0xaf, 0x7d, 0x43, 0x43, 0x7e, 0xb2,
-    0x6e, 0x88, 0xc4, 0x72, 0x0d, 0x78, 0x0c, 0x4f, 0x8e, 0x6a, 0x55, 0x86, 0x5e, 0x31, 0x2f, 0x5b,
-    0x85, 0x55, 0x6c, 0x8f, 0x51, 0xfe, 0xf0, 0x77, 0x01, 0x70, 0x77, 0xac, 0x5d, 0x4c, 0x8c, 0xc3,
-    0x78, 0x87, 0x78, 0xc3, 0x8d, 0x4b, 0x5c, 0xae, 0x78, 0x5b, 0x7e, 0x42, 0x3b, 0x71, 0x9d, 0x62,
-    0x88, 0x60, 0x9d, 0x72, 0x3e, 0x3f, 0x7d, 0xde, 0xfe, 0x20, 0x01, 0xe0, 0xff, 0xff, 0x00, 0x16,
-    0x00, 0x00, 0x04, 0x0c, 0x04, 0x8d, 0x06, 0x06, 0x01, 0xed, 0x00, 0x00, 0xff, 0xff, 0x00, 0x0b,
-    0xfe, 0x50, 0x05, 0x44, 0x04, 0x9d, 0x06, 0x26, 0x02, 0x31, 0x00, 0x00, 0x00, 0x07, 0x02, 0x6b,
-    0x02, 0x9b, 0xff, 0xb3, 0xff, 0xff, 0x00, 0x9b, 0x00, 0x00, 0x04, 0x4e, 0x05, 0xc7, 0x06, 0x26,
-    0x02, 0x18, 0x00, 0x00, 0x01, 0x07, 0x00, 0x70, 0x00, 0xb6, 0x00, 0x26, 0x00, 0x0b, 0xb6, 0x03,
-    0x0e, 0x08, 0x01, 0x01, 0xb0, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x21, 0xff, 0xec,
-    0x04, 0x01, 0x05, 0xc7, 0x06, 0x26, 0x02, 0x1b, 0x00, 0x00, 0x01, 0x06, 0x00, 0x70, 0x5c, 0x26,
-    0x00, 0x0b, 0xb6, 0x02, 0x1a, 0x17, 0x01, 0x01, 0xb0, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff,
-    0x00, 0x6a, 0x00, 0x00, 0x04, 0xf6, 0x04, 0x8e, 0x06, 0x06, 0x02, 0x0b, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0xb2, 0xff, 0xf0, 0x05, 0x12, 0x04, 0x8d, 0x04, 0x26, 0x01, 0xfd, 0x00, 0x00, 0x00, 0x07,
-    0x01, 0xfc, 0x01, 0xdb, 0x00, 0x00, 0xff, 0xff, 0x00, 0x0f, 0x00, 0x00, 0x05, 0xe0, 0x05, 0xff,
-    0x06, 0x26, 0x02, 0x8e, 0x00, 0x00, 0x01, 0x07, 0x00, 0x75, 0x02, 0xae, 0xff, 0xff, 0x00, 0x0b,
-    0xb6, 0x06, 0x19, 0x0f, 0x01, 0x01, 0x4d, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x69,
-    0xff, 0xbe, 0x04, 0x40, 0x06, 0x1d, 0x06, 0x26, 0x02, 0x90, 0x00, 0x00, 0x01, 0x07, 0x00, 0x75,
-    0x01, 0x8f, 0x00, 0x1d, 0x00, 0x0b, 0xb6, 0x03, 0x30, 0x11, 0x01, 0x01, 0x5b, 0x56, 0x00, 0x2b,
-    0x34, 0x00, 0xff, 0xff, 0x00, 0x4b, 0xfe, 0x2a, 0x03, 0xd4, 0x04, 0x9d, 0x06, 0x26, 0x01, 0xf3,
-    0x00, 0x00, 0x00, 0x07, 0x01, 0xd4, 0x01, 0x29, 0xfe, 0xe1, 0xff, 0xff, 0x00, 0x33, 0x00, 0x00,
-    0x05, 0xfb, 0x06, 0x1d, 0x06, 0x26, 0x01, 0xef, 0x00, 0x00, 0x01, 0x07, 0x00, 0x44, 0x01, 0xaa,
-    0x00, 0x1d, 0x00, 0x0b, 0xb6, 0x04, 0x18, 0x0a, 0x01, 0x01, 0x6b, 0x56, 0x00, 0x2b, 0x34, 0x00,
-    0xff, 0xff, 0x00, 0x33, 0x00, 0x00, 0x05, 0xfb, 0x06, 0x1d, 0x06, 0x26, 0x01, 0xef, 0x00, 0x00,
-    0x01, 0x07, 0x00, 0x75, 0x02, 0x53, 0x00, 0x1d, 0x00, 0x0b, 0xb6, 0x04, 0x16, 0x0a, 0x01, 0x01,
-    0x6b, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x33, 0x00, 0x00, 0x05, 0xfb, 0x05, 0xe2,
-    0x06, 0x26, 0x01, 0xef, 0x00, 0x00, 0x01, 0x07, 0x00, 0x6a, 0x01, 0x62, 0x00, 0x1d, 0x00, 0x0d,
-    0xb7, 0x05, 0x04, 0x1f, 0x0a, 0x01, 0x01, 0x84, 0x56, 0x00, 0x2b, 0x34, 0x34, 0x00, 0xff, 0xff,
-    0x00, 0x16, 0x00, 0x00, 0x04, 0x0c, 0x06, 0x1d, 0x06, 0x26, 0x01, 0xed, 0x00, 0x00, 0x00, 0x07,
-    0x00, 0x44, 0x00, 0xa4, 0x00, 0x1d, 0xff, 0xff, 0x00, 0x1f, 0xfe, 0x62, 0x04, 0xe2, 0x05, 0xb0,
-    0x06, 0x26, 0x00, 0x25, 0x00, 0x00, 0x01, 0x07, 0x00, 0xa4, 0x01, 0x6e, 0x00, 0x00, 0x00, 0x0b,
-    0xb6, 0x03, 0x0e, 0x05, 0x01, 0x01, 0x39, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x65,
-    0xfe, 0x62, 0x03, 0xc8, 0x04, 0x4e, 0x06, 0x26, 0x00, 0x45, 0x00, 0x00, 0x01, 0x07, 0x00, 0xa4,
-    0x00, 0xd1, 0x00, 0x00, 0x00, 0x0b, 0xb6, 0x02, 0x3b, 0x31, 0x00, 0x00, 0x4d, 0x56, 0x00, 0x2b,
-    0x34, 0x00, 0xff, 0xff, 0x00, 0xb9, 0xfe, 0x6c, 0x04, 0x42, 0x05, 0xb0, 0x06, 0x26, 0x00, 0x29,
-    0x00, 0x00, 0x01, 0x07, 0x00, 0xa4, 0x01, 0x43, 0x00, 0x0a, 0x00, 0x0b, 0xb6, 0x04, 0x10, 0x02,
-    0x00, 0x00, 0x43, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x5a, 0xfe, 0x64, 0x03, 0xd6,
-    0x04, 0x4e, 0x06, 0x26, 0x00, 0x49, 0x00, 0x00, 0x01, 0x07, 0x00, 0xa4, 0x01, 0x0f, 0x00, 0x02,
-    0x00, 0x0b, 0xb6, 0x01, 0x2c, 0x00, 0x00, 0x00, 0x4d, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff,
-    0x00, 0x18, 0xfe, 0x62, 0x04, 0x3b, 0x04, 0x8d, 0x06, 0x26, 0x02, 0x4d, 0x00, 0x00, 0x00, 0x07,
-    0x00, 0xa4, 0x01, 0x14, 0x00, 0x00, 0xff, 0xff, 0x00, 0x9b, 0xfe, 0x6a, 0x03, 0xab, 0x04, 0x8d,
-    0x06, 0x26, 0x02, 0x42, 0x00, 0x00, 0x00, 0x07, 0x00, 0xa4, 0x00, 0xef, 0x00, 0x08, 0xff, 0xff,
-    0x00, 0x8e, 0xfe, 0xd3, 0x01, 0x33, 0x04, 0x3a, 0x06, 0x26, 0x00, 0x8d, 0x00, 0x00, 0x01, 0x07,
-    0x00, 0xad, 0x03, 0x2e, 0x00, 0x0a, 0x00, 0x0e, 0xb4, 0x01, 0x07, 0x02, 0x01, 0x01, 0xb8, 0xff,
-    0x7f, 0xb0, 0x56, 0x00, 0x2b, 0x34, 0x00, 0x00
+    0x8d, 0x5a, 0x09, 0x40, 0x53, 0x57, 0xd6, 0xbe, 0xf7, 0xbe, 0x97, 0x04, 0x50, 0x84, 0x80, 0x01,
+    0x97, 0xba, 0x20, 0x0a, 0x88, 0x08, 0x18, 0x48, 0x90, 0x9d, 0xc8, 0x0e, 0x59, 0x48, 0xc2, 0x1e,
+    0xb6, 0xb0, 0x85, 0x04, 0xc2, 0xae, 0x04, 0x82, 0xac, 0xee, 0x88, 0x16, 0x51, 0x14, 0x71, 0xad,
+    0x5a, 0xed, 0xa6, 0x54, 0xab, 0x4e, 0xa7, 0x1d, 0xbb, 0xd9, 0xda, 0xcd, 0x8e, 0x76, 0xfc, 0x67,
+    0xda, 0x4e, 0x67, 0x3a, 0x1d, 0xa7, 0x33, 0x9d, 0x2e, 0xd3, 0xce, 0xfc, 0xe3, 0x68, 0x85, 0x3c,
+    0xfe, 0xf3, 0x5e, 0x82, 0xe2, 0x2c, 0xff, 0x34, 0xf0, 0xde, 0xbb, 0xef, 0x2e, 0xe7, 0x9e, 0x73,
+    0xee, 0x39, 0xdf, 0x3d, 0xf7, 0xde, 0x87, 0x30, 0x42, 0xc8, 0x0d, 0xf5, 0x20, 0x0a, 0x35, 0xa6,
+    0x26, 0x25, 0xa7, 0xa0, 0x41, 0xd4, 0x8d, 0xd0, 0xaa, 0x9d, 0x90, 0xfb, 0x58, 0x6a, 0x96, 0x4a,
+    0x9b, 0xb4, 0x41, 0xbe, 0x1e, 0xde, 0xcf, 0xc0, 0xfb, 0xd2, 0x54, 0x6d, 0xce, 0xba, 0x61, 0x51,
+    0x9f, 0x17, 0xbc, 0xbf, 0x0d, 0xef, 0x52, 0x95, 0x36, 0x44, 0xdc, 0xec, 0xdf, 0x07, 0x49, 0x6c,
+    0x81, 0x5b, 0x99, 0x36, 0x5b, 0x96, 0x5d, 0xf2, 0x8f, 0x04, 0x21, 0x42, 0x41, 0xf0, 0x8a, 0x0a,
+    0x2b, 0xcc, 0xfa, 0xc6, 0x84, 0xfb, 0xbf, 0xfb, 0x18, 0x21, 0x6a, 0x13, 0xbc, 0xc7, 0x18, 0xf4,
+    0x2d, 0x8d, 0xc8, 0x09, 0xcd, 0x87, 0xf6, 0x3d, 0xf0, 0x3e, 0xdb, 0x50, 0xd7, 0x5e, 0xed, 0x41,
+    0xbd, 0xe2, 0x86, 0x10, 0xfd, 0x2c, 0x42, 0x7e, 0x4e, 0x35, 0x55, 0xfa, 0xca, 0xd9, 0x7d, 0xa5,
+    0xc7, 0xa1, 0x6c, 0x92, 0xa5, 0x5f, 0x03, 0x19, 0xae, 0x0c, 0xef, 0x3c, 0xd0, 0x0f, 0x87, 0xf7,
+    0xe5, 0x35, 0xe6, 0x56, 0xcb, 0xb6, 0xc3, 0xab, 0xe2, 0xe0, 0xfd, 0x23, 0xb8, 0x9e, 0xae, 0x6b,
+    0xa8, 0xd0, 0x27, 0xb9, 0x44, 0x2f, 0x04, 0xfa, 0xaf, 0x42, 0xf9, 0x57, 0x66, 0xbd, 0xa5, 0x11,
+    0xf5, 0xa2, 0xa7, 0xa0, 0x2c, 0x9f, 0xe5, 0xb7, 0x5e, 0x6f, 0xae, 0x72, 0x3b, 0xb2, 0xfc, 0x79,
+    0x84, 0x02, 0x5f, 0x80, 0xf7, 0xa7, 0x1b, 0x1b, 0x5a, 0x5a, 0xa7, 0xcc, 0xa8, 0x12, 0xfa, 0x2f,
+    0x63, 0xcb, 0x11, 0x2b, 0x3b, 0x45, 0x94, 0x21, 0x1e, 0x85, 0x9b, 0x4a, 0xdd, 0x62, 0xee, 0xa0,
+    0xf9, 0x4e, 0x2c, 0xdf, 0xe8, 0xea, 0xf7, 0xc2, 0x60, 0xf6, 0xf9, 0xf9, 0x2d, 0xd2, 0x30, 0x75,
+    0x80, 0x09, 0xe4, 0xdf, 0xe5, 0xef, 0x82, 0x57, 0x67, 0x44, 0x90, 0xfd, 0x07, 0xed, 0x04, 0x75,
+    0xcc, 0x6c, 0xb8, 0xab, 0xa6, 0x0e, 0x4c, 0xdd, 0xe1, 0xdf, 0xe5, 0x28, 0xcd, 0xfc, 0xe9, 0xb9,
+    0x9c, 0x56, 0x64, 0x44, 0x7c, 0x14, 0x87, 0xe8, 0x7f, 0x2a, 0x27, 0xf0, 0x4e, 0xd3, 0xcd, 0x38,
+    0x08, 0xf1, 0x10, 0xe2, 0x1d, 0xe4, 0x85, 0x01, 0xc9, 0x25, 0xf6, 0x27, 0x75, 0x13, 0x55, 0x13,
+    0xae, 0xca, 0x8c, 0x1f, 0x76, 0x5c, 0xdc, 0x2f, 0x55, 0xa5, 0x4a, 0x45, 0x09, 0x68, 0xe9, 0xd2,
+    0xed, 0x7c, 0xc4, 0x20, 0x54, 0x2d, 0x38, 0x48, 0xa6, 0xeb, 0x20, 0x3a, 0x8a, 0x37, 0xce, 0x49,
+    0x46, 0x51, 0x3b, 0x51, 0x25, 0xfe, 0x5f, 0xc8, 0xfe, 0x39, 0x3a, 0x48, 0x14, 0xe8, 0x71, 0xfa,
+    0x34, 0xca, 0xa1, 0x1b, 0x51, 0x2b, 0xef, 0x2b, 0x54, 0x4f, 0x7f, 0x8b, 0xcc, 0xb8, 0x18, 0x59,
+    0xc8, 0x2e, 0x34, 0x48, 0x0e, 0xa1, 0x65, 0x54, 0x15, 0x5a, 0x44, 0x6f, 0x46, 0x72, 0xbc, 0x1d,
+    0xc5, 0x92, 0x4c, 0x24, 0xc6, 0x5f, 0xa1, 0x3d, 0x54, 0x30, 0x5a, 0x02, 0xf5, 0x2d, 0x70, 0x5d,
+    0x80, 0xcb, 0x04, 0x57, 0x05, 0x5c, 0x49, 0x70, 0x9d, 0x81, 0xab, 0x1f, 0x2e, 0x25, 0x5c, 0xb5,
+    0x70, 0x55, 0xe3, 0xb3, 0xa8, 0x0b, 0xef, 0x46, 0xb1, 0xb4, 0x37, 0x52, 0xd0, 0x66, 0x34, 0x42,
+    0xfb, 0xa1, 0x8d, 0xd4, 0x09, 0x94, 0x2d, 0x50, 0x41, 0x7f, 0x08, 0xe8, 0x7c, 0x89, 0x5e, 0xe4,
+    0x89, 0xd1, 0x26, 0x5e, 0x1c, 0x7a, 0x91, 0x1e, 0x84, 0xab, 0x07, 0xde, 0xdb, 0xd1, 0x10, 0xef,
+    0x69, 0xf4, 0x22, 0x59, 0x86, 0x6e, 0xd1, 0x35, 0x28, 0x8d, 0xe7, 0x0a, 0xf9, 0x6b, 0xd1, 0x8b,
+    0xfc, 0x6f, 0xa0, 0xec, 0x1c, 0x5c, 0xb5, 0xa8, 0x0b, 0xf8, 0x64, 0x9f, 0x1d, 0x3c, 0x11, 0xba,
+    0x44, 0x5f, 0x41, 0x05, 0xf4, 0x35, 0x24, 0xe1, 0x25, 0xa2, 0x13, 0xf4, 0xf7, 0x68, 0xa9, 0x20,
+    0x08, 0xfa, 0xfb, 0x23, 0x5a, 0x4b, 0xbf, 0x87, 0xe6, 0xd1, 0xef, 0x22, 0x1d, 0xfe, 0x1a, 0x9d,
+    0xa4, 0x02, 0xd0, 0x1a, 0x78, 0x62, 0x2a, 0x07, 0x29, 0xa9, 0xf5, 0x88, 0x90, 0x74, 0x64, 0xa0,
+    0x33, 0x50, 0x15, 0xf0, 0x38, 0x46, 0x2f, 0x45, 0xa5, 0x74, 0x33, 0x32, 0xd3, 0xbe, 0xa8, 0x90,
+    0x9c, 0x46, 0x09, 0x74, 0x13, 0xa4, 0xab, 0xd0, 0x61, 0xfc, 0x3e, 0x1a, 0xc1, 0xb7, 0xa6, 0x0e,
+    0x50, 0xdf, 0x70, 0xe9, 0x67, 0x04, 0xf3, 0x80, 0xff, 0x6a, 0x74, 0x98, 0xee, 0x44, 0x3a, 0xae,
+    0x5d, 0x1b, 0x32, 0x93, 0xf3, 0xf0, 0x3e, 0x07, 0xc6, 0x65, 0x18, 0xfa, 0xaa, 0x42, 0xa3, 0xd4,
+    0xc7, 0xc8, 0x8f, 0xef, 0x8c, 0xe2, 0xa9, 0x2f, 0xd0, 0x1a, 0xea, 0x03, 0xe4, 0x03, 0xcf, 0x7c,
+    0x72, 0x0a, 0x25, 0xe3, 0x37, 0xd1, 0x05, 0x78, 0xba, 0xf0, 0xac, 0x68, 0x0f, 0xf9, 0x03, 0xca,
+    0x07, 0x4f, 0x92, 0xa3, 0x34, 0x14, 0x83, 0xcc, 0x60, 0x0f, 0xf1, 0x28, 0x0b, 0xde, 0xe4, 0x90,
+    0x97, 0xff, 0x4f, 0x79, 0xc8, 0x31, 0xdc, 0x14, 0x5c, 0x73, 0xe1, 0x8e, 0xb9, 0x27, 0x8d, 0x02,
+    0xe0, 0xc9, 0xe7, 0x6c, 0x87, 0xa0, 0xae, 0xa5, 0xdb, 0xa7, 0xa6, 0xd8, 0x91, 0x5d, 0xda, 0x33,
+    0x35, 0x35, 0xf5, 0xf9, 0x67, 0xbf, 0x9b, 0x61, 0x51, 0x62, 0xf8, 0x53, 0xa3, 0x5a, 0x34, 0x84,
+    0xbe, 0xc2, 0x05, 0xf8, 0x25, 0xfc, 0x1e, 0xbe, 0x4b, 0x7c, 0x49, 0x0a, 0xd1, 0x91, 0x26, 0xd2,
+    0x45, 0xf6, 0x92, 0x93, 0xe4, 0x4b, 0x32, 0x41, 0xad, 0xa6, 0xba, 0xa9, 0x31, 0xea, 0x63, 0x7a,
+    0x05, 0xbd, 0x96, 0xde, 0x4f, 0xdf, 0xa6, 0xbf, 0xa3, 0x27, 0x78, 0x5e, 0xbc, 0x40, 0x5e, 0x0a,
+    0x6f, 0x3b, 0x7f, 0x29, 0x7f, 0x1d, 0x7f, 0x90, 0xff, 0x16, 0xff, 0xae, 0x60, 0xbe, 0x40, 0x22,
+    0x68, 0x15, 0xec, 0x16, 0x1c, 0x16, 0xbc, 0x22, 0xf8, 0x83, 0xe0, 0x9e, 0xd3, 0x22, 0x27, 0x89,
+    0x53, 0xab, 0xd3, 0x21, 0xa7, 0x3f, 0x38, 0x7b, 0x3b, 0x1b, 0x9c, 0xad, 0xce, 0x47, 0x9d, 0x7f,
+    0xea, 0xfc, 0xbd, 0x8b, 0xbb, 0x4b, 0x80, 0x4b, 0x8a, 0x4b, 0xbe, 0x8b, 0xc1, 0xa5, 0xdd, 0x65,
+    0xd8, 0xe5, 0xa8, 0xcb, 0x73, 0xb3, 0xf0, 0xac, 0xb4, 0x59, 0xbd, 0xb3, 0xde, 0x9e, 0xcd, 0x9f,
+    0xbd, 0x6a, 0xf6, 0xd6, 0xd9, 0x17, 0x66, 0xdf, 0x74, 0x45, 0xae, 0xcb, 0x5d, 0xc5, 0xae, 0x5d,
+    0xae, 0xcf, 0xb8, 0xfe, 0x79, 0xce, 0x9a, 0x39, 0xed, 0x73, 0x8e, 0xcf, 0xf9, 0xd6, 0xcd, 0xd3,
+    0x2d, 0xc1, 0x4d, 0xe7, 0x36, 0xe8, 0xf6, 0x9c, 0xdb, 0xa7, 0x6e, 0xf7, 0xdd, 0xc3, 0xdc, 0x65,
+    0xee, 0x56, 0xf7, 0x67, 0xdd, 0x2f, 0xba, 0x5f, 0x71, 0xbf, 0xe6, 0x7e, 0xc3, 0xfd, 0x63, 0xf7,
+    0xdf, 0xbb, 0x7f, 0xed, 0xfe, 0x77, 0x77, 0x9b, 0x90, 0x2f, 0x0c, 0x13, 0x26, 0x0b, 0x3b, 0x85,
+    0x57, 0x85, 0x9f, 0x7b, 0x88, 0x3c, 0x72, 0x3d, 0x8c, 0x1e, 0x6f, 0x78, 0xd2, 0x9c, 0x36, 0xc0,
+    0x77, 0xa9, 0x00, 0xb0, 0x71, 0x0a, 0x09, 0xd0, 0x2c, 0xc0, 0x2d, 0x4f, 0xe4, 0x8d, 0x90, 0x4c,
+    0xe4, 0x23, 0x09, 0x13, 0xfa, 0x0a, 0x7d, 0xe0, 0xf2, 0x84, 0x34, 0xc6, 0xbe, 0x58, 0x88, 0xc3,
+    0x30, 0xe5, 0x6c, 0xdb, 0xb0, 0x50, 0x4a, 0xae, 0x4a, 0xbd, 0x6d, 0x1b, 0xc8, 0x0e, 0xdb, 0xb9,
+    0x28, 0xa2, 0xe6, 0x6e, 0xbc, 0x71, 0xa9, 0xf4, 0x7e, 0x16, 0x6f, 0x9c, 0xbb, 0xb6, 0x48, 0xa5,
+    0xbc, 0xa2, 0xfb, 0x3b, 0x79, 0xad, 0xf6, 0x0b, 0x74, 0x7d, 0x70, 0xea, 0x2e, 0x8e, 0xe7, 0xfa,
+    0x00, 0x64, 0x92, 0x51, 0xbe, 0x14, 0x15, 0x2e, 0x0d, 0x13, 0x7b, 0x89, 0xe6, 0xf2, 0x7d, 0x97,
+    0xf9, 0x61, 0x5f, 0x7e, 0x83, 0xc0, 0x35, 0xc8, 0xcf, 0x6f, 0xf5, 0x6a, 0x3f, 0xbf, 0x20, 0xde,
+    0xf8, 0xc4, 0x1f, 0xe9, 0x05, 0xf7, 0xf7, 0x2f, 0x0b, 0x0d, 0x5d, 0xe6, 0x13, 0x12, 0xc2, 0x8e,
+    0xe3, 0xe3, 0x74, 0x34, 0xfe, 0x1d, 0x1f, 0xdc, 0x1a, 0xf8, 0x43, 0x5a, 0x11, 0xe5, 0xeb, 0x29,
+    0xf1, 0xe1, 0xee, 0x7f, 0x9f, 0x9b, 0x45, 0xb0, 0x72, 0xae, 0x9a, 0xe2, 0xa3, 0x01, 0xe6, 0x2d,
+    0x1c, 0x3e, 0xc4, 0xde, 0x23, 0x00, 0x58, 0x68, 0x94, 0x03, 0xb7, 0xe7, 0x67, 0x48, 0x85, 0xf4,
+    0xc0, 0xbd, 0x0f, 0x5c, 0xd8, 0x47, 0xe2, 0x43, 0xc1, 0x85, 0x9d, 0xb0, 0xb0, 0x92, 0xf9, 0x0b,
+    0x8e, 0xc2, 0x9e, 0x15, 0xcc, 0xb7, 0xf8, 0xa9, 0x89, 0xef, 0x69, 0xf7, 0xcc, 0x89, 0xef, 0x68,
+    0xa1, 0x43, 0x88, 0x2c, 0x6a, 0xbc, 0xcc, 0xb6, 0xa3, 0x94, 0xb5, 0xa1, 0xd6, 0xa9, 0x50, 0x8a,
+    0x01, 0xbc, 0x62, 0x69, 0xc5, 0x02, 0xff, 0x9c, 0x4e, 0x7c, 0x25, 0x38, 0xdc, 0xcf, 0xcf, 0x3f,
+    0x98, 0x48, 0xc2, 0xa5, 0x20, 0xcb, 0x62, 0x22, 0xf2, 0x0d, 0x0f, 0x26, 0xbe, 0xcb, 0xf8, 0x7c,
+    0xd1, 0x5c, 0x2f, 0x2f, 0x6f, 0x78, 0x9f, 0xcb, 0x07, 0xe9, 0xa0, 0x3c, 0x6c, 0xee, 0x62, 0x12,
+    0x26, 0x96, 0x4a, 0x49, 0x9f, 0xa1, 0xa2, 0x1a, 0xd7, 0xc7, 0xee, 0xb6, 0x76, 0x5d, 0xae, 0xa8,
+    0xf9, 0x59, 0x4f, 0xe5, 0x21, 0x73, 0x54, 0x9b, 0xbf, 0xb2, 0x29, 0xc3, 0xb0, 0x25, 0x41, 0xba,
+    0x7b, 0x53, 0xd7, 0xa5, 0xf2, 0xfa, 0x6b, 0x9b, 0x72, 0x9e, 0xdc, 0x92, 0x65, 0x89, 0xad, 0xee,
+    0x88, 0xa9, 0xde, 0x2d, 0xe7, 0xef, 0x62, 0xfe, 0x81, 0x5d, 0x7e, 0x18, 0xbd, 0x7b, 0x17, 0xcb,
+    0xd2, 0xcd, 0x05, 0xab, 0x56, 0xd6, 0x1c, 0x6e, 0x5b, 0xff, 0x6c, 0x71, 0x54, 0xcb, 0x69, 0x73,
+    0x46, 0x67, 0x71, 0x58, 0x46, 0x67, 0x46, 0xba, 0xb9, 0x30, 0x28, 0xb0, 0x66, 0xac, 0xad, 0xfd,
+    0x19, 0xdd, 0x6a, 0xc3, 0x53, 0xd6, 0xb2, 0xde, 0xcc, 0xa5, 0xe9, 0x9d, 0xa0, 0xa7, 0xfa, 0xa9,
+    0xaf, 0x79, 0x9b, 0x78, 0x6f, 0x22, 0x21, 0xf2, 0x45, 0x12, 0x94, 0x8a, 0x32, 0x41, 0x6f, 0x76,
+    0x3e, 0xbd, 0xbc, 0x44, 0x76, 0xc6, 0xfc, 0xfc, 0x22, 0x58, 0x46, 0x59, 0xc6, 0x24, 0x12, 0x90,
+    0x84, 0xe5, 0x1c, 0xff, 0x88, 0x3a, 0x9e, 0xd8, 0x1f, 0xd7, 0xa7, 0xf4, 0xe4, 0xe5, 0xf5, 0xa4,
+    0x24, 0x77, 0xe7, 0xe5, 0xf7, 0xa6, 0xe8, 0x57, 0xe6, 0x24, 0xc4, 0x6b, 0x56, 0xae, 0xcc, 0x8e,
+    0x8f, 0xcf, 0x5e, 0x49, 0xac, 0x50, 0x94, 0xdf, 0xcd, 0x15, 0xf5, 0xa4, 0x72, 0x45, 0x5a, 0x28,
+    0x4a, 0x88, 0xcb, 0x0e, 0xfc, 0xb9, 0x2d, 0x32, 0x93, 0x5c, 0xa3, 0x33, 0x15, 0xda, 0x6d, 0x1a,
+    0xcd, 0x36, 0xad, 0x42, 0xcd, 0x3e, 0x8e, 0x28, 0x24, 0xfa, 0xd8, 0x58, 0xbd, 0x44, 0x11, 0xa1,
+    0x8f, 0x8b, 0xd3, 0x4f, 0xa6, 0x29, 0x35, 0x6c, 0xae, 0xc6, 0xfe, 0x38, 0xa6, 0x94, 0x94, 0x43,
+    0xa1, 0x54, 0x19, 0xa9, 0x8f, 0x8e, 0xd6, 0x53, 0x8a, 0x89, 0x5d, 0x6b, 0x00, 0x6f, 0x30, 0x32,
+    0x4f, 0x7d, 0x43, 0xdf, 0x00, 0xe9, 0xd6, 0xc1, 0x58, 0x44, 0x00, 0x6b, 0xe1, 0x7e, 0x0f, 0xd4,
+    0x0e, 0x66, 0x3a, 0x3d, 0x22, 0x5e, 0xac, 0x79, 0xf1, 0x05, 0xbc, 0x39, 0xc4, 0x2e, 0x43, 0x1c,
+    0x3b, 0x12, 0x90, 0xc1, 0xfd, 0xb3, 0xb2, 0xb1, 0xd5, 0xf0, 0xd6, 0xaf, 0xe2, 0xb5, 0xd5, 0x65,
+    0xc9, 0x65, 0x6b, 0xfc, 0x33, 0xc2, 0xc9, 0xd5, 0x21, 0xdb, 0xa9, 0x8c, 0x86, 0x18, 0xcd, 0xfe,
+    0xea, 0xf2, 0x81, 0x8c, 0xa8, 0x82, 0x50, 0xe6, 0x4e, 0x8e, 0x76, 0x61, 0xda, 0xde, 0xa6, 0x92,
+    0x73, 0x03, 0xea, 0x86, 0x15, 0x69, 0x12, 0x27, 0xbe, 0x53, 0xd6, 0xaf, 0xda, 0x77, 0xbe, 0x67,
+    0xce, 0xe8, 0xa1, 0x84, 0xcf, 0x07, 0x9b, 0x33, 0x52, 0x1b, 0x63, 0x0d, 0xb1, 0xa1, 0x86, 0x86,
+    0xd8, 0xc9, 0xb7, 0xc8, 0xcf, 0x72, 0xf7, 0xec, 0xc8, 0x30, 0xec, 0x55, 0xab, 0x7a, 0x95, 0xb2,
+    0x46, 0x9d, 0xdf, 0xf5, 0xe4, 0xd6, 0x42, 0x1f, 0xf9, 0x26, 0xb5, 0x66, 0xe4, 0xc3, 0xee, 0xd2,
+    0x53, 0x83, 0xd1, 0x2e, 0xb3, 0x9d, 0xb2, 0xcb, 0x2b, 0xc6, 0xd7, 0xe7, 0x0f, 0x76, 0xb2, 0x33,
+    0x8b, 0x85, 0x5e, 0x87, 0x6e, 0x73, 0x36, 0xed, 0xb0, 0xe8, 0xdb, 0xc2, 0x42, 0x1e, 0x6b, 0xc6,
+    0xd7, 0xf1, 0xca, 0x7d, 0x50, 0x3e, 0xc8, 0x04, 0x92, 0x7a, 0xbe, 0x9e, 0xf5, 0x45, 0x18, 0x39,
+    0x0f, 0x0f, 0x69, 0x84, 0xf7, 0x1c, 0x42, 0x60, 0x5c, 0x3c, 0x40, 0x4a, 0x81, 0x9f, 0x1f, 0x21,
+    0x83, 0x9a, 0x2d, 0x47, 0x94, 0x8b, 0x12, 0x7b, 0x6a, 0xe2, 0xe2, 0x6a, 0x7a, 0x12, 0x17, 0x29,
+    0x8f, 0x6c, 0xd1, 0x90, 0x38, 0xb7, 0xab, 0x58, 0x8b, 0x85, 0x57, 0x82, 0x35, 0x21, 0xe7, 0xef,
+    0x33, 0xef, 0x8f, 0xcf, 0x1d, 0x67, 0xde, 0x9f, 0xb8, 0x18, 0xaa, 0x0c, 0x7e, 0x09, 0xbb, 0xe2,
+    0x5c, 0xb6, 0xdf, 0x65, 0x40, 0x97, 0xd8, 0xe9, 0xca, 0x44, 0x73, 0x21, 0x29, 0xf0, 0x8f, 0x23,
+    0x1e, 0x30, 0xba, 0x04, 0x8c, 0x39, 0xc2, 0xcb, 0xcb, 0xc3, 0x83, 0x10, 0xcd, 0xe6, 0xa3, 0x8a,
+    0x45, 0xeb, 0x7a, 0x8c, 0x71, 0x09, 0xa6, 0x9e, 0xf8, 0x45, 0x8a, 0xa3, 0x9b, 0x35, 0x44, 0xe1,
+    0xf6, 0x36, 0xf3, 0x34, 0xf3, 0xbf, 0x2f, 0x05, 0x2b, 0x43, 0x5e, 0x98, 0xc4, 0x12, 0x20, 0x8c,
+    0xa5, 0x13, 0x2f, 0x04, 0x2b, 0x83, 0xaf, 0x30, 0xdf, 0x31, 0xcf, 0x01, 0xdd, 0x45, 0x64, 0x23,
+    0x95, 0xc9, 0x7b, 0x1e, 0xcd, 0x01, 0x7e, 0x3d, 0x57, 0x44, 0xf0, 0xa8, 0x30, 0x6a, 0x85, 0x37,
+    0xcf, 0x53, 0x40, 0x51, 0x8f, 0x7f, 0xc2, 0x5c, 0xf0, 0xc1, 0x72, 0xba, 0xc6, 0x19, 0x27, 0xfb,
+    0x30, 0x17, 0x3e, 0xcb, 0xfd, 0x9f, 0xeb, 0xe4, 0x67, 0x38, 0xa8, 0xb6, 0xba, 0x03, 0x37, 0x31,
+    0x03, 0xdd, 0x86, 0x66, 0xe6, 0x93, 0x78, 0xbc, 0x86, 0xb9, 0xc9, 0x7a, 0xba, 0x1c, 0xed, 0xa1,
+    0xc5, 0xf4, 0x25, 0xce, 0xd3, 0x38, 0x0c, 0xc2, 0xe0, 0x6b, 0xb4, 0x78, 0x72, 0x01, 0x09, 0xb4,
+    0x90, 0x3f, 0x36, 0x37, 0xe3, 0x1b, 0x13, 0x9f, 0xd2, 0xcb, 0x59, 0x39, 0x62, 0x99, 0xef, 0xb0,
+    0x3b, 0xba, 0x82, 0x5c, 0x10, 0xaa, 0x82, 0x71, 0x66, 0xa5, 0x90, 0x48, 0xb0, 0x7b, 0xa6, 0x2c,
+    0x75, 0x49, 0xa0, 0xe8, 0xca, 0xa0, 0xee, 0xd9, 0x68, 0xc9, 0x4a, 0x6d, 0xa1, 0x64, 0x37, 0x5b,
+    0x57, 0x4c, 0x54, 0x44, 0x48, 0x58, 0xaa, 0x1c, 0x4d, 0x22, 0x64, 0x7c, 0xc8, 0x25, 0x83, 0x01,
+    0x4a, 0xf6, 0x00, 0x2e, 0xc5, 0xa0, 0x23, 0x2c, 0xae, 0xb4, 0xcd, 0x40, 0xa4, 0x3d, 0xab, 0x03,
+    0xfc, 0x83, 0x83, 0xfd, 0x03, 0x56, 0x67, 0xf8, 0xae, 0x59, 0xe3, 0xeb, 0x1b, 0x1a, 0xca, 0x52,
+    0x59, 0x32, 0xd5, 0x4f, 0xbe, 0xe6, 0x10, 0x05, 0xc9, 0xc0, 0xcc, 0xc8, 0xd7, 0xb6, 0xe3, 0x66,
+    0x52, 0xc6, 0x1b, 0xff, 0xe1, 0x17, 0xfc, 0xd5, 0x2c, 0xef, 0x96, 0xa9, 0x6f, 0xa8, 0x7b, 0x60,
+    0x95, 0xde, 0x28, 0x84, 0xd3, 0xed, 0x1c, 0x00, 0x83, 0x60, 0x0a, 0x34, 0x1b, 0x07, 0xde, 0xbf,
+    0x98, 0xa2, 0x84, 0xe1, 0xc1, 0x94, 0xef, 0x32, 0xb0, 0x46, 0xe1, 0xdc, 0xc5, 0x14, 0x6b, 0x8e,
+    0xd4, 0xbd, 0x98, 0x96, 0x27, 0x4d, 0xd9, 0x03, 0xf5, 0xf2, 0x80, 0xd8, 0xd6, 0x53, 0xc6, 0x9c,
+    0x9d, 0xe6, 0xcc, 0x00, 0xcb, 0xc2, 0x70, 0x95, 0x71, 0x9d, 0xda, 0xaa, 0x0e, 0x5c, 0x28, 0x51,
+    0x19, 0x65, 0xda, 0x0e, 0x4d, 0x00, 0x95, 0x73, 0xe7, 0xd8, 0xb7, 0x63, 0xf2, 0xd0, 0x8a, 0x91,
+    0xf7, 0x7a, 0xee, 0x1c, 0xff, 0x7a, 0x34, 0x33, 0x54, 0xbf, 0xef, 0x1d, 0xa6, 0x13, 0x60, 0xeb,
+    0x78, 0x87, 0x66, 0xa5, 0xac, 0xfb, 0x67, 0x9d, 0xcc, 0xb7, 0xe5, 0xc7, 0x3b, 0xb3, 0x83, 0x92,
+    0xfa, 0x5e, 0x61, 0xf9, 0xbc, 0x00, 0xcc, 0x5c, 0xe2, 0x5d, 0x02, 0x64, 0xe7, 0x90, 0x8a, 0x27,
+    0x59, 0x41, 0x2e, 0xb5, 0x31, 0xad, 0xf8, 0x3b, 0xde, 0xa5, 0xfb, 0x19, 0xbc, 0x25, 0xc3, 0x4d,
+    0x2f, 0xb2, 0xb5, 0x4c, 0x80, 0x8f, 0x0b, 0x78, 0x57, 0xd1, 0x12, 0x56, 0x7f, 0xa0, 0x67, 0x50,
+    0x9f, 0xc3, 0xc1, 0x01, 0xc7, 0xa6, 0xdd, 0x67, 0x0e, 0x11, 0x60, 0x7a, 0xc1, 0x64, 0x23, 0xfe,
+    0x4d, 0x81, 0x29, 0x24, 0x79, 0x5b, 0x45, 0xd5, 0x70, 0x56, 0x5b, 0xed, 0xdb, 0x3b, 0xfb, 0xaf,
+    0x18, 0x42, 0xd4, 0xd5, 0x6b, 0x19, 0x93, 0xc1, 0x50, 0x42, 0x1e, 0xab, 0x1e, 0xed, 0x8a, 0xc9,
+    0xdf, 0x22, 0xcf, 0x1d, 0xd5, 0x5b, 0xde, 0x6e, 0x2b, 0x3e, 0x6b, 0x95, 0x6d, 0xd9, 0xdc, 0x17,
+    0xcf, 0x48, 0x41, 0x23, 0x15, 0xa0, 0x91, 0x3b, 0xd0, 0xc7, 0x63, 0x28, 0x1a, 0x78, 0xe1, 0x50,
+    0xe4, 0xdf, 0xf5, 0xe1, 0xeb, 0x2b, 0x92, 0x70, 0x00, 0x6a, 0x57, 0x19, 0xeb, 0xa6, 0x0e, 0xcc,
+    0x61, 0x6b, 0xe3, 0xbd, 0x1d, 0x8d, 0xfb, 0x15, 0xeb, 0xb6, 0x1a, 0x75, 0x43, 0xd9, 0x6d, 0xcd,
+    0x6f, 0x6f, 0xec, 0x7d, 0xc5, 0x14, 0xd9, 0x78, 0xda, 0xbc, 0x7d, 0x7b, 0xe7, 0x85, 0xe6, 0x88,
+    0xc4, 0xf6, 0x13, 0xfa, 0xfc, 0xd3, 0x9b, 0x95, 0x96, 0xfc, 0xc3, 0x55, 0x86, 0x61, 0x65, 0xf1,
+    0x29, 0x33, 0xb5, 0x50, 0xde, 0xa3, 0xcc, 0xdf, 0x9c, 0x99, 0xb6, 0xa5, 0x68, 0xc3, 0xc5, 0xea,
+    0x92, 0x17, 0x7a, 0x65, 0xe0, 0x20, 0xde, 0x59, 0x51, 0x86, 0x6d, 0xca, 0x8a, 0xb1, 0xda, 0x88,
+    0xf0, 0x9a, 0x43, 0x86, 0xa2, 0x9d, 0x59, 0x69, 0x3b, 0x2a, 0x8c, 0x9b, 0xe2, 0xd8, 0x51, 0x4b,
+    0x02, 0x3d, 0xc8, 0x61, 0x54, 0xd9, 0x59, 0xc2, 0x6e, 0x71, 0x61, 0x02, 0xcc, 0x59, 0x9d, 0x7c,
+    0xe2, 0x1e, 0x39, 0x5e, 0xb5, 0x9b, 0x79, 0x8c, 0x0c, 0xb5, 0xe1, 0x5f, 0x19, 0x92, 0xa9, 0x89,
+    0xbb, 0xb6, 0xc5, 0xd4, 0xc7, 0xec, 0xe4, 0x00, 0xfa, 0x3b, 0x03, 0x18, 0xe4, 0x0d, 0xa9, 0x95,
+    0xd0, 0xca, 0xdf, 0xd3, 0x47, 0xe4, 0x43, 0x39, 0x66, 0x01, 0x87, 0x10, 0xfe, 0x61, 0x2c, 0xe8,
+    0xb3, 0x5a, 0xe5, 0x26, 0x05, 0x1c, 0x55, 0x9a, 0x4a, 0x3e, 0xb2, 0xed, 0x0e, 0xf7, 0x1b, 0xd2,
+    0x95, 0x1f, 0x69, 0x89, 0x0d, 0x33, 0x9d, 0x6a, 0xca, 0x1b, 0xb5, 0x64, 0x3a, 0xb7, 0xce, 0xd2,
+    0x0e, 0x94, 0x2a, 0xd7, 0xab, 0x56, 0x06, 0xe5, 0x74, 0x66, 0xd5, 0x58, 0xc9, 0x8d, 0x85, 0xe4,
+    0xcd, 0x46, 0xc6, 0x6b, 0xa1, 0x44, 0xd6, 0x71, 0xd6, 0x6c, 0x1c, 0xef, 0x4f, 0x5b, 0x53, 0xb5,
+    0xbf, 0x5a, 0xbf, 0x25, 0x39, 0x4c, 0x3f, 0x58, 0xa8, 0xec, 0xaf, 0x90, 0xae, 0x85, 0xbe, 0xfb,
+    0xa1, 0x6f, 0x67, 0xde, 0x4b, 0x48, 0xca, 0x6a, 0x55, 0xc4, 0xd9, 0x94, 0x68, 0xee, 0x23, 0xdd,
+    0xb1, 0xfe, 0x40, 0x3d, 0xa2, 0x53, 0xc0, 0x10, 0xe9, 0x72, 0x2a, 0xca, 0xc3, 0x63, 0xc7, 0xaf,
+    0xf6, 0xc8, 0xa5, 0x65, 0xdd, 0x19, 0xe9, 0xad, 0xea, 0x55, 0xfe, 0x59, 0x16, 0xb5, 0xee, 0x58,
+    0x35, 0x95, 0x24, 0x48, 0x6b, 0x1b, 0x2b, 0x34, 0x1e, 0x36, 0x86, 0x47, 0x37, 0x1e, 0xad, 0xaa,
+    0x3f, 0x6b, 0x4d, 0xc8, 0x79, 0x0e, 0xf3, 0x78, 0x2f, 0x19, 0x0b, 0x9f, 0xfa, 0x7e, 0xdf, 0x3b,
+    0x95, 0xc7, 0x1a, 0xa2, 0x63, 0x6b, 0x77, 0x65, 0x29, 0xb6, 0x9b, 0x62, 0xb2, 0x77, 0x6a, 0x71,
+    0xe9, 0x48, 0xdd, 0x5a, 0xf9, 0xe6, 0xe7, 0xca, 0x8c, 0x17, 0xb7, 0xc9, 0xb3, 0xf7, 0xbe, 0x5e,
+    0xdf, 0xfd, 0x53, 0x1c, 0xf2, 0xc9, 0x7a, 0xe0, 0x4b, 0x09, 0xba, 0x9c, 0x05, 0x3a, 0x61, 0x2d,
+    0x4f, 0x04, 0x2e, 0xe2, 0x23, 0xa1, 0x67, 0xd9, 0xf6, 0x6c, 0x24, 0xa6, 0xc9, 0xab, 0xbc, 0xf1,
+    0xe4, 0xfb, 0xfb, 0x78, 0xe9, 0x06, 0x98, 0x99, 0x6b, 0x81, 0x7b, 0x17, 0xb0, 0x0a, 0x77, 0x88,
+    0xa9, 0x43, 0x21, 0xea, 0x46, 0xb2, 0xb9, 0xd3, 0x78, 0xcc, 0x7a, 0x8a, 0x97, 0x97, 0x60, 0xda,
+    0x48, 0x1c, 0x66, 0xe0, 0x39, 0xf7, 0x21, 0x5e, 0xff, 0xbb, 0x72, 0xda, 0xa5, 0xf3, 0x66, 0x5f,
+    0xff, 0x2f, 0x3a, 0x92, 0x3b, 0x9f, 0xaa, 0xec, 0xff, 0x85, 0xb5, 0xbd, 0xf0, 0x50, 0x79, 0xe5,
+    0x58, 0x7e, 0xfe, 0xa1, 0xaa, 0xca, 0x83, 0xf9, 0xda, 0xa6, 0xd7, 0x2c, 0xd6, 0xd7, 0xea, 0x1b,
+    0x5e, 0x6d, 0xef, 0x78, 0xad, 0xc9, 0xa2, 0x1e, 0xc8, 0xcf, 0xdf, 0xa1, 0x54, 0x0e, 0x14, 0xe4,
+    0xef, 0xc8, 0xc2, 0xfd, 0x9b, 0x2f, 0x16, 0x17, 0x5f, 0xdc, 0x9c, 0xfb, 0xb8, 0x31, 0xb2, 0xf2,
+    0xf9, 0xd6, 0xe2, 0x9d, 0x0a, 0xc5, 0xce, 0x62, 0xfd, 0xd6, 0xd4, 0xd4, 0xad, 0xd4, 0xfc, 0xda,
+    0xd3, 0xa5, 0xa5, 0xa7, 0x6b, 0xbb, 0xcf, 0x15, 0x15, 0x9d, 0xeb, 0xca, 0xe9, 0xcb, 0x4c, 0xe9,
+    0x2b, 0xcc, 0xeb, 0x49, 0x4e, 0xee, 0x61, 0xfd, 0xa6, 0x7a, 0xea, 0x0e, 0xf5, 0x2d, 0x70, 0xbf,
+    0x16, 0xfc, 0x86, 0x53, 0xb8, 0x5d, 0xe3, 0xec, 0x24, 0x63, 0x1f, 0x81, 0x88, 0x88, 0x69, 0x95,
+    0xdb, 0x1d, 0x9f, 0x1d, 0x9b, 0x39, 0x94, 0xaf, 0x2f, 0x0e, 0x99, 0x7f, 0xf4, 0x97, 0xbd, 0x6b,
+    0xc5, 0x45, 0x1b, 0x33, 0xe5, 0x96, 0xec, 0xa0, 0x00, 0xf5, 0x7a, 0x45, 0xee, 0xd6, 0xd2, 0x30,
+    0x12, 0x93, 0xd8, 0xfe, 0x44, 0x49, 0xf5, 0x61, 0xa3, 0x34, 0xba, 0xf9, 0x44, 0xcd, 0xfa, 0xb3,
+    0x2d, 0x91, 0x2b, 0x8b, 0x0e, 0xfd, 0xf1, 0xc8, 0x82, 0xd2, 0xa2, 0x53, 0xbf, 0xed, 0x7b, 0xaf,
+    0xe5, 0xec, 0xfa, 0x98, 0x84, 0xa6, 0xc7, 0xd5, 0x99, 0x03, 0x0d, 0x09, 0x32, 0x93, 0x35, 0x0a,
+    0x17, 0x9d, 0xec, 0x49, 0x57, 0xef, 0x38, 0x57, 0x62, 0xfc, 0xc9, 0x60, 0x56, 0xce, 0xa1, 0x5b,
+    0x3d, 0x2d, 0xbd, 0xdf, 0xbc, 0x35, 0xac, 0x86, 0x38, 0xb6, 0x1b, 0x90, 0x2c, 0x88, 0x8e, 0x84,
+    0x75, 0x82, 0xdb, 0xb7, 0xb0, 0x88, 0x42, 0x6e, 0x53, 0xdf, 0x53, 0x63, 0x90, 0xcf, 0xe2, 0xe4,
+    0x52, 0xc8, 0xf7, 0x87, 0x9c, 0x3f, 0x50, 0x63, 0x30, 0x36, 0xae, 0x5c, 0x6c, 0xac, 0x40, 0x5f,
+    0x50, 0xdb, 0xe9, 0x18, 0x18, 0x0f, 0x67, 0x40, 0x6c, 0x2c, 0xc2, 0x10, 0xe2, 0x09, 0x24, 0xf8,
+    0x08, 0xf9, 0x7a, 0xf2, 0x2a, 0x15, 0x63, 0xf3, 0xd2, 0x50, 0x31, 0xe4, 0x49, 0xe6, 0x95, 0x1e,
+    0x6c, 0x55, 0xe1, 0x39, 0xcc, 0xcf, 0x04, 0x2a, 0xdc, 0x01, 0xad, 0x46, 0xf0, 0x13, 0xd4, 0x47,
+    0xd4, 0x99, 0x19, 0xf8, 0x0c, 0x17, 0xf5, 0xd1, 0xe4, 0x15, 0x6a, 0x1d, 0x5c, 0x67, 0x6a, 0x6b,
+    0x99, 0xaa, 0xda, 0x5a, 0xa8, 0xb7, 0x11, 0xfd, 0x89, 0x7a, 0x97, 0x8e, 0xb3, 0x53, 0x97, 0x01,
+    0x6d, 0x11, 0xc6, 0x11, 0x22, 0x4c, 0x35, 0xda, 0x5c, 0x29, 0xc5, 0xe4, 0x05, 0x72, 0x27, 0x1f,
+    0x6e, 0xbd, 0x38, 0x61, 0x23, 0xb3, 0x25, 0x8b, 0xf9, 0x1e, 0x27, 0xb9, 0x64, 0x31, 0x9b, 0x59,
+    0xae, 0xb2, 0xa7, 0xee, 0x52, 0x72, 0xd0, 0xee, 0x52, 0x76, 0xb9, 0x2b, 0xf3, 0x05, 0x6d, 0x3e,
+    0xc4, 0x25, 0x81, 0xaf, 0xdd, 0x3c, 0x44, 0xf6, 0x49, 0xfc, 0x91, 0x08, 0xf2, 0x7b, 0x0b, 0x5e,
+    0x9a, 0x16, 0x2b, 0xd1, 0x84, 0xac, 0x6d, 0xd4, 0x2a, 0xda, 0x53, 0xb0, 0x85, 0x18, 0xcf, 0xd5,
+    0xb6, 0x3d, 0x99, 0x1b, 0x63, 0x4a, 0x96, 0x85, 0x6e, 0x0b, 0xf2, 0xf3, 0x0f, 0x0a, 0xf2, 0xf7,
+    0x0b, 0xc2, 0xfb, 0x72, 0x36, 0x54, 0x45, 0x4b, 0x8a, 0xcc, 0x59, 0x2a, 0x4b, 0x52, 0x4c, 0x53,
+    0x56, 0xf3, 0xf1, 0x9c, 0x92, 0x33, 0x0d, 0x05, 0xbb, 0xbb, 0x12, 0x22, 0x06, 0x99, 0xf2, 0xe9,
+    0x80, 0x93, 0xa0, 0x56, 0x26, 0x9a, 0xff, 0x19, 0x6f, 0x10, 0xc9, 0x50, 0x0d, 0x70, 0x01, 0x83,
+    0x07, 0xa3, 0x19, 0xe1, 0x19, 0x46, 0xf1, 0x1d, 0x23, 0x2c, 0xb5, 0x03, 0x39, 0x11, 0xf0, 0x3d,
+    0xb8, 0xc8, 0x2e, 0xc2, 0xdb, 0x1e, 0xe9, 0x41, 0x89, 0x87, 0x54, 0xba, 0x9c, 0x1d, 0x74, 0x0f,
+    0xde, 0x74, 0x65, 0x6f, 0x47, 0xfb, 0x38, 0x1a, 0xd8, 0x65, 0x67, 0x6e, 0xb6, 0x29, 0xff, 0x23,
+    0x3a, 0xa4, 0x78, 0xa8, 0x2a, 0x41, 0x9f, 0xb0, 0x80, 0x2f, 0xae, 0x12, 0xf3, 0x17, 0x86, 0x47,
+    0xcf, 0x4b, 0xac, 0x4e, 0x0b, 0xa0, 0x05, 0x2b, 0xab, 0x4f, 0x7e, 0xb1, 0xaf, 0xf7, 0xf3, 0xcb,
+    0x5b, 0x55, 0x02, 0xc1, 0x9a, 0xfa, 0xa7, 0x3e, 0xdb, 0x9e, 0x7f, 0x31, 0x76, 0x49, 0xe2, 0x8d,
+    0xc2, 0x03, 0x13, 0xaf, 0xf5, 0xc4, 0x08, 0x04, 0x79, 0x23, 0x37, 0x30, 0xb5, 0xff, 0x98, 0xed,
+    0x25, 0x8b, 0x74, 0xe2, 0x55, 0xa7, 0x39, 0x41, 0x19, 0x61, 0xfe, 0x6a, 0x45, 0xd2, 0xbc, 0x35,
+    0xf3, 0xd2, 0x8b, 0xcd, 0xb1, 0x29, 0xa6, 0xc4, 0x05, 0xce, 0xce, 0x11, 0x6a, 0xa3, 0x45, 0x56,
+    0xd5, 0x1a, 0x9e, 0xb4, 0x58, 0x9f, 0x18, 0x5b, 0x5f, 0x18, 0x47, 0x70, 0xc9, 0xcb, 0x87, 0x4b,
+    0x82, 0xf3, 0xac, 0x72, 0x12, 0x69, 0xbb, 0x96, 0x55, 0x2e, 0x16, 0x26, 0xb5, 0x9f, 0x28, 0xd9,
+    0xcf, 0x5c, 0xdb, 0x91, 0xa6, 0x18, 0xbe, 0xc1, 0xfc, 0x70, 0x70, 0x1f, 0xc3, 0xfc, 0x7c, 0xaf,
+    0x6a, 0xd5, 0xf2, 0xac, 0xa0, 0xd5, 0xda, 0xa3, 0xb7, 0xf1, 0xb2, 0x67, 0xcf, 0xe0, 0x65, 0x5f,
+    0x9e, 0xca, 0xd7, 0x8c, 0xfd, 0x96, 0xf9, 0xa3, 0x4d, 0xd1, 0x5d, 0x22, 0x7e, 0x2c, 0xb9, 0xad,
+    0x30, 0x36, 0xa7, 0x27, 0x2f, 0x28, 0x61, 0xc3, 0xc9, 0x2a, 0xc3, 0xb9, 0xed, 0x7a, 0xb1, 0x6c,
+    0xd5, 0xba, 0x65, 0xa1, 0x91, 0xeb, 0xc7, 0xd9, 0xe8, 0x18, 0x66, 0x10, 0xfa, 0xf7, 0xe0, 0xf5,
+    0xec, 0x58, 0xbb, 0xda, 0xe7, 0x46, 0x88, 0xb2, 0xfd, 0x61, 0xad, 0xc0, 0xce, 0xb5, 0xfb, 0x19,
+    0xa7, 0x1e, 0xe2, 0x57, 0x88, 0x5f, 0x67, 0x9c, 0x04, 0x05, 0xc4, 0xff, 0x93, 0xc9, 0xfb, 0xbc,
+    0x82, 0xfb, 0xa7, 0xb9, 0x18, 0xbb, 0x20, 0xef, 0x7e, 0x16, 0x21, 0x26, 0x13, 0x68, 0x1c, 0xa6,
+    0x24, 0xba, 0x0d, 0x68, 0xcc, 0x07, 0x44, 0x40, 0x32, 0x1f, 0x7f, 0x9f, 0x69, 0xf4, 0x67, 0xd7,
+    0x1f, 0x3e, 0x62, 0x7b, 0x30, 0x2d, 0xa0, 0x7c, 0x22, 0x1e, 0x16, 0x44, 0xf8, 0x38, 0x62, 0x6c,
+    0x72, 0x8e, 0xa9, 0x22, 0xb8, 0xbc, 0xf6, 0x80, 0x4a, 0x79, 0x68, 0x3d, 0x73, 0xdd, 0x8a, 0xcf,
+    0x36, 0x8c, 0x5b, 0x65, 0xaa, 0x3d, 0x55, 0x79, 0x4c, 0x5a, 0x3c, 0x6e, 0xaf, 0x1b, 0xd5, 0x40,
+    0x04, 0x37, 0x85, 0x08, 0x36, 0x7a, 0x55, 0xec, 0xd1, 0xac, 0xbf, 0x49, 0x5e, 0x36, 0xc6, 0x75,
+    0x14, 0x16, 0xb5, 0x47, 0xdd, 0xff, 0x29, 0x6f, 0x3c, 0xa8, 0x64, 0x77, 0x45, 0xe1, 0x90, 0x6e,
+    0x96, 0x6d, 0x91, 0x29, 0x7d, 0x5b, 0x89, 0x66, 0x93, 0xc2, 0xe8, 0xe7, 0x52, 0x39, 0xa6, 0xdb,
+    0x7c, 0xb9, 0x14, 0x7c, 0x7d, 0x13, 0x20, 0xd5, 0x2b, 0x60, 0x8d, 0xfe, 0x2c, 0xce, 0x3e, 0xc0,
+    0x51, 0xbb, 0x15, 0x7a, 0xfb, 0x3a, 0xdc, 0x5e, 0xe4, 0x88, 0xee, 0xe9, 0x24, 0xab, 0x5b, 0xff,
+    0x17, 0xc7, 0x3a, 0xdf, 0x7d, 0x5c, 0xa9, 0xdc, 0x73, 0xbd, 0xfb, 0xd0, 0xe7, 0xfd, 0x6e, 0xd6,
+    0x39, 0x65, 0x67, 0xba, 0xaa, 0x8e, 0x37, 0x46, 0x47, 0xd6, 0x1d, 0xa9, 0xee, 0x7d, 0xb6, 0x0c,
+    0x5f, 0xdb, 0x7b, 0xab, 0xa5, 0xe4, 0xec, 0xdf, 0x86, 0x2f, 0xed, 0xfd, 0xeb, 0xd9, 0x92, 0xa6,
+    0x5b, 0x23, 0x1b, 0x4e, 0xe6, 0x29, 0x87, 0xde, 0xed, 0xfc, 0x49, 0xdb, 0xbb, 0x7b, 0x35, 0x9a,
+    0x53, 0x0e, 0x3d, 0x5c, 0x01, 0x3d, 0x2c, 0x40, 0x8b, 0x61, 0xc5, 0xe2, 0x10, 0x97, 0x43, 0x18,
+    0x58, 0xb1, 0x38, 0xb0, 0x84, 0xb0, 0xb3, 0x13, 0x49, 0x65, 0x2e, 0x13, 0x9c, 0x7a, 0xf8, 0x76,
+    0x67, 0xea, 0xa6, 0xcb, 0x4d, 0xcc, 0x19, 0x9c, 0xbf, 0xed, 0x0f, 0xa7, 0x75, 0xba, 0x33, 0x7f,
+    0x62, 0xca, 0xac, 0xa6, 0x9d, 0x13, 0xa7, 0xb6, 0x76, 0xbd, 0x3f, 0xa4, 0x34, 0x15, 0x9f, 0xfb,
+    0xfb, 0xc8, 0xa6, 0x91, 0xbf, 0x9f, 0x2d, 0xb1, 0xaf, 0x69, 0xd8, 0x75, 0x11, 0xdb, 0xc3, 0xba,
+    0x99, 0xeb, 0x22, 0x76, 0xf6, 0xf7, 0x04, 0x8a, 0xd8, 0xe1, 0xcd, 0xf4, 0xba, 0xc9, 0xeb, 0x2b,
+    0xac, 0x94, 0xaf, 0x2d, 0x8c, 0x0a, 0x9e, 0xfc, 0xd0, 0x64, 0x32, 0xf1, 0x52, 0xd8, 0xb6, 0xb6,
+    0x16, 0xa3, 0x91, 0x0c, 0xc2, 0x60, 0x41, 0x4b, 0x96, 0x46, 0xfc, 0x03, 0x1a, 0x5c, 0x94, 0x31,
+    0xdd, 0x1a, 0x87, 0x5b, 0x29, 0x1f, 0x9b, 0x98, 0x0a, 0x9b, 0xbc, 0x6e, 0xef, 0xd3, 0x56, 0x51,
+    0x5b, 0x4b, 0x0e, 0xb3, 0xed, 0x30, 0x1a, 0x02, 0x7d, 0xde, 0x02, 0x7d, 0xae, 0x62, 0xdb, 0xfc,
+    0x37, 0x7d, 0x46, 0x08, 0x81, 0x97, 0x5b, 0xf3, 0xad, 0x1f, 0x1c, 0xe8, 0xfd, 0xe5, 0xe1, 0x1c,
+    0xe5, 0xde, 0x9b, 0x7d, 0x27, 0x7e, 0xb3, 0xd1, 0xbd, 0x73, 0x4e, 0xfe, 0xe9, 0x4d, 0xa6, 0x93,
+    0x4d, 0x51, 0xb2, 0x8e, 0xa7, 0x6b, 0x1a, 0x0e, 0x95, 0x8a, 0x98, 0x76, 0x72, 0xd1, 0xf6, 0xc3,
+    0x72, 0x5d, 0x62, 0xf1, 0xb9, 0x7f, 0x1c, 0x18, 0x1f, 0xf9, 0xeb, 0xb3, 0xba, 0xc6, 0x37, 0xac,
+    0x79, 0xc3, 0x85, 0xca, 0xc7, 0xdf, 0xb1, 0x9e, 0xef, 0xfe, 0x60, 0xaf, 0x2a, 0x30, 0x7a, 0x3e,
+    0x6e, 0x33, 0x39, 0xb8, 0xfe, 0x6e, 0x06, 0xd7, 0x0e, 0xb9, 0x59, 0x0b, 0xa3, 0x77, 0x4e, 0xee,
+    0x7c, 0xcc, 0x4a, 0x4b, 0x41, 0x6c, 0x56, 0xca, 0xe9, 0x85, 0x2c, 0xcb, 0xf3, 0x2d, 0xb8, 0xa9,
+    0x1c, 0x51, 0x1f, 0x2b, 0xa7, 0xca, 0xfa, 0xb0, 0x2c, 0x0d, 0xe2, 0x9b, 0xcb, 0x90, 0xf4, 0x64,
+    0xcb, 0xc2, 0x84, 0xd3, 0xd3, 0xd4, 0x74, 0xf8, 0x42, 0xc5, 0x58, 0x9b, 0xaf, 0x75, 0xf5, 0x5f,
+    0xab, 0xb7, 0x66, 0xee, 0xaa, 0xcc, 0xdf, 0x9d, 0x83, 0xcf, 0x53, 0xcc, 0x24, 0x19, 0x7e, 0xd7,
+    0x58, 0xf4, 0xf2, 0x2e, 0xe3, 0x60, 0x8a, 0xf2, 0xd0, 0xb4, 0x2e, 0xbf, 0xe4, 0xe8, 0xdb, 0xbd,
+    0x87, 0xe5, 0x08, 0xbc, 0xc7, 0x13, 0x7b, 0xe2, 0x08, 0x0c, 0xda, 0xa4, 0x91, 0x6d, 0x27, 0xf3,
+    0xc6, 0x6c, 0x86, 0x2c, 0x0f, 0xb7, 0x8d, 0x65, 0x90, 0xe7, 0x1d, 0x5a, 0xad, 0x62, 0xde, 0xd9,
+    0x81, 0x9d, 0x48, 0x02, 0x78, 0xd0, 0x37, 0x95, 0x93, 0xe3, 0xc8, 0x61, 0x3b, 0x94, 0x43, 0xbe,
+    0x07, 0xa3, 0x4a, 0x53, 0x36, 0xd7, 0x15, 0x9d, 0x0f, 0x46, 0xd1, 0xd1, 0x23, 0x3f, 0x8c, 0x9b,
+    0xa5, 0x67, 0xc1, 0x1c, 0x8c, 0xb4, 0xe0, 0xac, 0x61, 0xac, 0xcf, 0x42, 0x75, 0xcc, 0x2e, 0xf9,
+    0x3f, 0xeb, 0x24, 0x0b, 0xc8, 0xc2, 0x4e, 0xdb, 0x81, 0x12, 0x5b, 0x8b, 0x79, 0x8e, 0x95, 0xe7,
+    0x6a, 0x66, 0x45, 0x66, 0x78, 0x84, 0x25, 0x30, 0xf9, 0xbe, 0x6d, 0x13, 0xcb, 0x02, 0xe9, 0x04,
+    0xf9, 0xd9, 0x1e, 0xef, 0x00, 0x25, 0x67, 0x8e, 0x6f, 0xd6, 0x2c, 0xc3, 0xb0, 0x90, 0xbe, 0xd3,
+    0x39, 0xf9, 0x72, 0x67, 0x27, 0x95, 0xc2, 0x56, 0xa3, 0x3f, 0x9d, 0x58, 0x0e, 0x0b, 0xfa, 0x15,
+    0xf4, 0xaf, 0x59, 0x0e, 0xbb, 0x60, 0xfc, 0xd9, 0xb9, 0x53, 0xc4, 0x59, 0xc0, 0x8c, 0xd0, 0xc4,
+    0x3e, 0x51, 0x52, 0x0f, 0xa6, 0xd2, 0xe9, 0xb9, 0x94, 0xfe, 0x36, 0x6b, 0xef, 0xcd, 0xde, 0xee,
+    0x9b, 0xfb, 0x35, 0xea, 0x91, 0x9b, 0xdd, 0xbd, 0x37, 0x47, 0xb2, 0xac, 0xd1, 0x2d, 0x4f, 0x1a,
+    0x6b, 0x4e, 0xb6, 0xc4, 0xc6, 0xb5, 0x9e, 0xac, 0x31, 0x9d, 0x6c, 0x8e, 0xa6, 0xfc, 0xc6, 0x46,
+    0xef, 0x8d, 0x97, 0x94, 0x8c, 0xdf, 0x1b, 0x1d, 0x1b, 0xbd, 0xcb, 0x26, 0xee, 0x32, 0xef, 0x1f,
+    0xee, 0xfd, 0x60, 0x0f, 0x78, 0xe1, 0x07, 0xbd, 0x87, 0xfb, 0x6e, 0xb0, 0x89, 0x1b, 0xc8, 0xc1,
+    0xed, 0x30, 0x70, 0xcb, 0xae, 0x7c, 0x58, 0x6f, 0x7a, 0x04, 0x61, 0xec, 0xd3, 0x0a, 0x79, 0x8a,
+    0x29, 0xc3, 0xc7, 0xfa, 0x9e, 0xc8, 0xcc, 0x7c, 0xa2, 0x8f, 0x19, 0xb0, 0xe2, 0xef, 0x8f, 0x7d,
+    0xd2, 0xd8, 0xf0, 0x6b, 0xa2, 0x36, 0x65, 0xef, 0xd1, 0x15, 0x8c, 0xe8, 0x58, 0xc0, 0xa8, 0xbf,
+    0xda, 0xb3, 0xe5, 0xb5, 0x6a, 0x56, 0x8f, 0x1d, 0x53, 0x04, 0x46, 0xee, 0x2a, 0xa4, 0xe6, 0xb3,
+    0x11, 0x7f, 0x15, 0x86, 0xb8, 0xf1, 0x47, 0xc8, 0x44, 0x6d, 0xc7, 0xca, 0x1c, 0xe6, 0x22, 0x7e,
+    0x5e, 0xb5, 0xef, 0x46, 0x1f, 0x88, 0xa6, 0x56, 0x8f, 0xdc, 0xe8, 0xee, 0xbb, 0xb9, 0x2f, 0xab,
+    0x23, 0xa6, 0xe5, 0x94, 0xc9, 0x00, 0xa2, 0xc1, 0x62, 0xc0, 0x60, 0x3a, 0xd5, 0x1c, 0xdd, 0xc2,
+    0x7c, 0xaa, 0xc0, 0x4b, 0x29, 0xfa, 0x47, 0x09, 0x48, 0xd0, 0x25, 0x90, 0xef, 0x65, 0x90, 0x6f,
+    0x1e, 0x5a, 0x04, 0xa3, 0x3a, 0x2d, 0x92, 0x40, 0xf0, 0x28, 0x9a, 0xfa, 0x80, 0x59, 0x89, 0x2e,
+    0xe1, 0x8f, 0x0f, 0xfc, 0xa6, 0x3d, 0x77, 0xb4, 0x32, 0x90, 0x11, 0x10, 0xfc, 0x64, 0xf3, 0x01,
+    0x45, 0xce, 0x93, 0x16, 0xe6, 0x44, 0x27, 0xd5, 0xcf, 0x6c, 0xdd, 0x84, 0x2d, 0xbc, 0xf1, 0xf2,
+    0x57, 0x06, 0x0c, 0x67, 0x9a, 0x44, 0xee, 0xc6, 0x82, 0xc7, 0xb5, 0x15, 0x43, 0xca, 0xfb, 0x3f,
+    0x25, 0x03, 0xc4, 0xd6, 0xe3, 0x0a, 0x5a, 0x2c, 0x80, 0x31, 0x34, 0x83, 0xd4, 0x91, 0xa0, 0x45,
+    0x10, 0xcd, 0x1f, 0x56, 0x38, 0x0e, 0x0f, 0x86, 0x98, 0x7e, 0x3a, 0x2e, 0x5b, 0x4c, 0xbc, 0x17,
+    0x53, 0x33, 0xc2, 0x79, 0xbb, 0x47, 0x53, 0x7f, 0x0d, 0xd0, 0x8d, 0x36, 0x9b, 0xc7, 0x37, 0xae,
+    0x4b, 0xeb, 0xbf, 0x50, 0x3b, 0xfa, 0xbb, 0x0e, 0x6b, 0xc1, 0x69, 0x8b, 0xe5, 0x84, 0x26, 0xa0,
+    0x70, 0x7f, 0x7d, 0xeb, 0x85, 0xce, 0x84, 0x8c, 0xad, 0x97, 0xcd, 0xfa, 0x57, 0x8f, 0x96, 0x5a,
+    0x33, 0xac, 0xfb, 0x32, 0x5a, 0x9e, 0x2a, 0xc6, 0x86, 0x98, 0xe2, 0x4c, 0xd9, 0xd2, 0x25, 0x19,
+    0x65, 0xbd, 0xb9, 0xd9, 0x3b, 0x2a, 0xa5, 0xad, 0x6f, 0x76, 0x94, 0xee, 0xcb, 0x49, 0x6f, 0xcf,
+    0x08, 0xcf, 0xcb, 0x4c, 0x58, 0xbc, 0x44, 0x59, 0xbd, 0x25, 0xbf, 0x60, 0xb0, 0x22, 0x5c, 0x6c,
+    0x3a, 0xd5, 0x5a, 0xd4, 0xad, 0xf0, 0x4d, 0xb2, 0xb2, 0x36, 0x26, 0x01, 0x2d, 0xec, 0x9d, 0xf6,
+    0x02, 0xce, 0x9b, 0xd8, 0x59, 0xe8, 0x78, 0x07, 0x31, 0x4f, 0x1c, 0xb7, 0xfb, 0x8e, 0x1d, 0x8b,
+    0x4e, 0x80, 0x1c, 0x27, 0xa0, 0x9e, 0x88, 0xc5, 0xf6, 0x07, 0xae, 0xcb, 0x7a, 0xb1, 0x63, 0xed,
+    0x41, 0x07, 0x58, 0x77, 0xfc, 0x79, 0x70, 0xe8, 0xcb, 0xad, 0x1d, 0x55, 0xe3, 0x4d, 0x4d, 0xe3,
+    0x95, 0x60, 0xfb, 0x7e, 0x27, 0x3e, 0x31, 0x9b, 0x3f, 0x39, 0x41, 0x7d, 0x32, 0xe9, 0xd7, 0xfd,
+    0x4c, 0x6e, 0xee, 0x33, 0xdd, 0xd0, 0xdf, 0x52, 0xe8, 0xef, 0xa6, 0x63, 0xf6, 0x03, 0x1b, 0x60,
+    0x3d, 0x09, 0x7b, 0xc3, 0xea, 0xb0, 0x07, 0xbf, 0xb7, 0xc5, 0x76, 0xbb, 0x92, 0xc9, 0xc5, 0xef,
+    0x88, 0x2b, 0x6d, 0xb7, 0x2f, 0xd1, 0xf7, 0xd9, 0xbe, 0x27, 0xf8, 0x97, 0xb8, 0xba, 0xb1, 0xe0,
+    0x83, 0x77, 0x21, 0xc5, 0x83, 0xf5, 0xab, 0x1b, 0xc7, 0x03, 0x0e, 0xa3, 0xd8, 0xa6, 0x9e, 0xbe,
+    0xce, 0x24, 0xcc, 0x9e, 0xc0, 0x14, 0x09, 0xc4, 0x31, 0x15, 0x2a, 0xe6, 0x6c, 0x29, 0xf3, 0x37,
+    0xec, 0x92, 0x55, 0xc1, 0x0c, 0xf0, 0xa4, 0x98, 0xdf, 0xc5, 0xec, 0xac, 0x00, 0xf3, 0x89, 0x28,
+    0x2b, 0x65, 0x2e, 0xa9, 0x71, 0x2f, 0x1d, 0xc2, 0xbc, 0x3e, 0xb1, 0x0b, 0x28, 0xff, 0x9a, 0x59,
+    0x0f, 0x77, 0x58, 0x1d, 0x73, 0xfd, 0xdc, 0x64, 0xba, 0xe9, 0x66, 0xcc, 0x6e, 0xeb, 0xb3, 0x91,
+    0x2a, 0x7d, 0x0e, 0xfa, 0x62, 0xf7, 0xce, 0x58, 0x57, 0x67, 0xa9, 0xc3, 0xff, 0x27, 0xf8, 0x20,
+    0x3e, 0xb8, 0x87, 0x59, 0x8c, 0xff, 0x3a, 0xcc, 0xe4, 0x33, 0xb9, 0x7b, 0xf0, 0x5f, 0x99, 0xc5,
+    0x00, 0x2c, 0x07, 0x49, 0xb5, 0x2d, 0xcc, 0xb6, 0x88, 0x58, 0x6d, 0x9b, 0xc9, 0x6d, 0x72, 0x1d,
+    0xda, 0xcf, 0x73, 0xb4, 0x77, 0x72, 0xb4, 0x67, 0x51, 0xf0, 0x19, 0xfc, 0x22, 0x7e, 0x79, 0xb7,
+    0xed, 0x6f, 0x56, 0xdb, 0xdf, 0x40, 0x2f, 0x5f, 0x52, 0xf3, 0x26, 0xd7, 0xdb, 0x7e, 0x4d, 0x56,
+    0x50, 0x03, 0xa0, 0x77, 0x1d, 0xd4, 0x6f, 0x7e, 0x88, 0x68, 0x55, 0xf6, 0xdd, 0x43, 0x58, 0x57,
+    0xf9, 0xb2, 0xb3, 0x4b, 0xf3, 0xa4, 0x17, 0xf5, 0xee, 0x64, 0x9e, 0x92, 0x3a, 0xa3, 0x92, 0x4e,
+    0x16, 0x00, 0x30, 0xd1, 0xdf, 0xde, 0x7f, 0xaa, 0x84, 0xa7, 0x31, 0x1a, 0x59, 0x5e, 0x4f, 0x32,
+    0x6f, 0xe3, 0xbf, 0xf0, 0x7b, 0xec, 0xd1, 0x25, 0xc0, 0x89, 0xc8, 0x47, 0x88, 0xff, 0xf2, 0xe1,
+    0x87, 0xcc, 0x25, 0x7e, 0x8f, 0xe1, 0x07, 0x2f, 0x83, 0xe0, 0x27, 0x50, 0x67, 0xcd, 0x54, 0x3f,
+    0xc5, 0xb7, 0x23, 0x72, 0x32, 0xb0, 0x43, 0x86, 0x6c, 0xc7, 0xd6, 0x93, 0xb2, 0x8d, 0xfc, 0xd5,
+    0x3f, 0xfc, 0x02, 0x4a, 0x31, 0x50, 0x90, 0xdb, 0x29, 0x68, 0x25, 0x3e, 0x42, 0x76, 0x17, 0x13,
+    0xe3, 0x4c, 0xe6, 0xe2, 0x87, 0xfc, 0xf9, 0x86, 0x7b, 0x69, 0x06, 0xfe, 0x57, 0x30, 0x66, 0x4a,
+    0xf2, 0x31, 0xb1, 0x4d, 0x8f, 0x99, 0x8c, 0x62, 0xb1, 0x8f, 0x82, 0x78, 0x05, 0x5f, 0xf8, 0x5b,
+    0x0b, 0x5e, 0x95, 0xf5, 0xea, 0xf7, 0xde, 0x6a, 0x1c, 0xc8, 0x13, 0xdb, 0x4e, 0x93, 0x5f, 0xd9,
+    0x56, 0x92, 0x82, 0x2e, 0xdb, 0x4a, 0x76, 0xbf, 0x78, 0x6a, 0x94, 0x6a, 0xb1, 0xef, 0x28, 0xeb,
+    0xd9, 0x98, 0xb7, 0x65, 0x72, 0x37, 0xb7, 0x83, 0x60, 0xa0, 0xbf, 0xc4, 0x97, 0xf9, 0x5c, 0xbe,
+    0xd6, 0xd3, 0x97, 0xba, 0xf7, 0x8a, 0xf9, 0x36, 0x1f, 0x31, 0x5f, 0xe2, 0x79, 0xd0, 0x4f, 0x15,
+    0xcc, 0x0f, 0x6f, 0xd3, 0x4a, 0xb4, 0x10, 0x45, 0x81, 0x1e, 0x84, 0xd3, 0xee, 0xe1, 0x3f, 0xed,
+    0x30, 0x60, 0x6b, 0xde, 0x22, 0x5f, 0x3f, 0x3f, 0x4f, 0x6f, 0xfb, 0x02, 0xc2, 0x6e, 0x79, 0xf6,
+    0x88, 0xd1, 0xb1, 0x1c, 0xa2, 0x42, 0x12, 0x3a, 0x75, 0xd9, 0xfd, 0x99, 0x6d, 0xd1, 0xf5, 0xa3,
+    0xc5, 0x2d, 0xcf, 0x57, 0x09, 0xdd, 0x7b, 0x66, 0xbb, 0x3e, 0x46, 0xbe, 0x2a, 0x1a, 0xaa, 0x94,
+    0x44, 0xd5, 0x67, 0x56, 0x8c, 0x56, 0x0a, 0xc3, 0x5d, 0x93, 0xcd, 0xfb, 0x4a, 0x8d, 0x47, 0x72,
+    0x93, 0x7a, 0x2e, 0x37, 0xbf, 0x4e, 0x82, 0x15, 0x8d, 0x31, 0xd1, 0x15, 0x31, 0x38, 0xb6, 0xb9,
+    0x50, 0xa2, 0x3c, 0xb4, 0xc1, 0x76, 0x67, 0xad, 0xc5, 0xcf, 0x75, 0xb9, 0x19, 0x7f, 0x51, 0xe4,
+    0x13, 0x57, 0xb0, 0x36, 0xaa, 0x6c, 0x6d, 0xba, 0x25, 0x35, 0x79, 0x8d, 0x49, 0x17, 0x09, 0x8b,
+    0x21, 0x55, 0x77, 0x41, 0x08, 0x70, 0x3e, 0x06, 0xbe, 0x40, 0xf3, 0xd9, 0xe8, 0x60, 0x01, 0x8b,
+    0x64, 0xda, 0x30, 0xa1, 0xc0, 0xf7, 0x01, 0x94, 0xf9, 0x0b, 0xed, 0x2b, 0x49, 0xc1, 0x34, 0x92,
+    0x09, 0x84, 0x76, 0x20, 0x1b, 0xb3, 0x38, 0x35, 0x52, 0xc6, 0x08, 0xd3, 0xc1, 0x72, 0xfd, 0x88,
+    0x49, 0x36, 0xdb, 0x6d, 0x9d, 0x71, 0xb8, 0xb4, 0x62, 0xcc, 0x14, 0xd1, 0xbe, 0x5c, 0x61, 0xc9,
+    0xce, 0xb5, 0xa8, 0x82, 0x67, 0x09, 0xb3, 0x07, 0xab, 0x35, 0x6d, 0x8a, 0x15, 0x7c, 0x74, 0xff,
+    0xc3, 0x0f, 0x89, 0xbf, 0xa8, 0xfd, 0x9d, 0x61, 0x75, 0x5c, 0xe3, 0x41, 0x1d, 0x9e, 0x55, 0x7e,
+    0xac, 0x35, 0x4e, 0x31, 0xf4, 0xde, 0xb0, 0xa8, 0xf4, 0x89, 0xf6, 0xa4, 0xc8, 0xe2, 0x7a, 0x09,
+    0xf3, 0xae, 0xbc, 0x5f, 0x0d, 0x2b, 0x21, 0xd0, 0x68, 0x29, 0x68, 0xed, 0x3a, 0x68, 0x0d, 0xa2,
+    0xae, 0x2a, 0x56, 0x1d, 0xff, 0x6f, 0xe4, 0x45, 0x56, 0x67, 0x6e, 0xce, 0xe3, 0xb7, 0xf0, 0x5a,
+    0x5f, 0xac, 0x6f, 0x7e, 0xae, 0x35, 0x3a, 0xba, 0xf5, 0xd9, 0xe6, 0xd6, 0x9f, 0x34, 0xf2, 0x5a,
+    0x78, 0x9a, 0x2d, 0xea, 0xa2, 0x7e, 0xf5, 0x8a, 0x15, 0xea, 0x7e, 0x6d, 0x54, 0xa3, 0xc6, 0x70,
+    0xac, 0x48, 0x3b, 0x7c, 0xb5, 0x39, 0xb0, 0xf9, 0xcd, 0x61, 0x4d, 0xc9, 0xb3, 0x1b, 0xf2, 0xba,
+    0x92, 0x52, 0xad, 0x87, 0x73, 0x03, 0x73, 0x0f, 0x5b, 0x53, 0x41, 0x7e, 0x33, 0xf4, 0x78, 0xeb,
+    0xa1, 0xfc, 0x55, 0x80, 0x02, 0xbe, 0x78, 0x1a, 0xc1, 0xbd, 0x85, 0x8e, 0x00, 0xfe, 0x61, 0x60,
+    0x62, 0x0f, 0xff, 0xa9, 0x22, 0x4b, 0xa3, 0xcd, 0x39, 0xca, 0x7c, 0x50, 0x5f, 0xba, 0xc7, 0x28,
+    0x73, 0x9b, 0x9d, 0x60, 0xda, 0xa7, 0x2f, 0x3b, 0x58, 0x17, 0xd5, 0xee, 0xa7, 0xb4, 0xa8, 0x0d,
+    0x3b, 0xb3, 0x3d, 0x67, 0x07, 0xab, 0xda, 0x73, 0x35, 0xed, 0x4a, 0xbf, 0x0f, 0x79, 0xc1, 0xf7,
+    0x11, 0xf1, 0x10, 0x75, 0xbd, 0x37, 0xa4, 0x88, 0x6b, 0x3d, 0x56, 0xce, 0xdc, 0xd1, 0x1d, 0x6c,
+    0x8c, 0x53, 0x0f, 0xbf, 0xb3, 0x4b, 0x54, 0xf2, 0x44, 0x7b, 0xa2, 0xaa, 0x5f, 0x89, 0xa5, 0x92,
+    0xfa, 0xe2, 0xc8, 0x24, 0x4e, 0xfe, 0x42, 0xe0, 0xe6, 0x97, 0x20, 0x3f, 0xcc, 0x91, 0xc9, 0x33,
+    0xa7, 0x12, 0x11, 0x98, 0x9d, 0x8f, 0xe4, 0xd1, 0x28, 0x89, 0xdb, 0x14, 0x4c, 0x30, 0x9d, 0xef,
+    0x4b, 0xcb, 0xec, 0x3d, 0x5d, 0x6c, 0x38, 0x5a, 0xbf, 0x76, 0xf2, 0x3a, 0x79, 0x89, 0x24, 0x6f,
+    0xad, 0x56, 0x74, 0xe9, 0xc4, 0xd2, 0xf2, 0x6d, 0xda, 0xd2, 0x7d, 0xd1, 0x99, 0xcb, 0x6b, 0xf6,
+    0xcc, 0x55, 0xee, 0x7a, 0xa3, 0x75, 0xd5, 0xc6, 0x77, 0x87, 0xe4, 0xe9, 0x9b, 0x2f, 0x9a, 0xd3,
+    0x0d, 0xae, 0xba, 0xa3, 0x95, 0x09, 0x6d, 0x27, 0x2a, 0x56, 0x15, 0x1c, 0x5a, 0x9f, 0x98, 0xaa,
+    0x88, 0x0a, 0xcf, 0x93, 0xb0, 0xe8, 0x09, 0xab, 0x71, 0x72, 0x9e, 0x2f, 0x42, 0x42, 0x16, 0x93,
+    0xf4, 0xbe, 0x42, 0xfb, 0x8a, 0xdb, 0xbe, 0x6a, 0x01, 0xcb, 0xe5, 0xb1, 0xbe, 0x5c, 0x6b, 0x51,
+    0xec, 0xae, 0x58, 0x2a, 0x5b, 0xe2, 0x3c, 0x2f, 0xdc, 0x47, 0x56, 0x22, 0xc6, 0xc4, 0xf6, 0x0b,
+    0xfa, 0xd5, 0x86, 0x03, 0x4a, 0x81, 0x73, 0xb5, 0x80, 0x17, 0x51, 0x23, 0xdf, 0x52, 0x5e, 0xce,
+    0xea, 0x94, 0x51, 0x53, 0xb7, 0x40, 0x0a, 0x4f, 0xb4, 0x12, 0xc5, 0xcd, 0xc4, 0x58, 0x76, 0x93,
+    0x91, 0x03, 0x58, 0xe1, 0x8f, 0x50, 0x71, 0x55, 0x43, 0xed, 0x1b, 0xfd, 0x49, 0x83, 0x1b, 0x83,
+    0x92, 0x64, 0x23, 0x79, 0x86, 0xdd, 0x99, 0x36, 0x61, 0x64, 0xdd, 0x58, 0xf9, 0x43, 0x7d, 0xeb,
+    0x0f, 0xd6, 0x45, 0x5a, 0x40, 0xdf, 0x1a, 0xc3, 0x80, 0xc6, 0x73, 0xd6, 0x6a, 0x95, 0x25, 0x57,
+    0x0b, 0xfa, 0xa6, 0xa3, 0x26, 0x3e, 0xde, 0xf9, 0x5e, 0x6d, 0x80, 0x36, 0x2e, 0x5d, 0x9d, 0xa9,
+    0x39, 0x58, 0x47, 0xc5, 0x32, 0x6f, 0xfd, 0x28, 0xe5, 0x83, 0x06, 0x0e, 0x83, 0x2b, 0x5f, 0xe7,
+    0xfc, 0x79, 0x81, 0x63, 0xa7, 0x7f, 0x7a, 0x27, 0x05, 0xd2, 0xe1, 0xf6, 0xd5, 0x1b, 0x9e, 0xdb,
+    0x56, 0x2c, 0xe1, 0xad, 0x6b, 0x3a, 0x58, 0xac, 0xee, 0x29, 0x08, 0xb1, 0xc4, 0x35, 0x2b, 0x73,
+    0x7b, 0xf3, 0x82, 0xc1, 0xca, 0x21, 0xa6, 0x9a, 0x2c, 0x5b, 0x5c, 0x76, 0xa6, 0x27, 0x2d, 0xa8,
+    0x74, 0x7f, 0xad, 0x2d, 0x9e, 0xbc, 0xde, 0xd0, 0x2d, 0xcd, 0x6c, 0xdb, 0xca, 0xae, 0x9c, 0x01,
+    0xde, 0xa2, 0xb9, 0x68, 0xc1, 0xcd, 0x4e, 0xf7, 0xd1, 0x13, 0x10, 0x8b, 0x68, 0x95, 0x3f, 0x7b,
+    0xfe, 0xe1, 0xbf, 0x0a, 0x98, 0x7f, 0x8b, 0x8e, 0xc2, 0x91, 0xcb, 0x42, 0x42, 0x1c, 0xe7, 0x1f,
+    0x53, 0x07, 0x98, 0x4c, 0x2c, 0x85, 0xb6, 0x42, 0x6e, 0x66, 0x9f, 0xd6, 0xe4, 0x03, 0x45, 0xce,
+    0xa4, 0xf4, 0xa4, 0x45, 0xd6, 0x55, 0x3c, 0x3f, 0xca, 0x9b, 0x08, 0xc5, 0xde, 0x91, 0x59, 0x2b,
+    0x45, 0xd3, 0x4b, 0x5f, 0xa0, 0x9a, 0x5c, 0xb1, 0x23, 0xd5, 0xc5, 0xb9, 0x92, 0xe7, 0xb4, 0xba,
+    0x30, 0x91, 0xf7, 0xf7, 0x69, 0xf2, 0x14, 0x27, 0xf1, 0x6d, 0x4e, 0xe2, 0x07, 0x11, 0x28, 0xc6,
+    0x02, 0xff, 0x08, 0x7b, 0x04, 0x2a, 0xb2, 0x50, 0x8b, 0x19, 0xc1, 0x47, 0xc2, 0xe7, 0xf0, 0x91,
+    0x10, 0x26, 0x56, 0x46, 0x3c, 0xec, 0x62, 0x32, 0x51, 0x8c, 0xcb, 0x8d, 0x0d, 0x2f, 0xe1, 0x7d,
+    0x13, 0x6f, 0x11, 0x71, 0x8d, 0xad, 0x1a, 0xec, 0xf6, 0x19, 0x90, 0xd0, 0xd7, 0x8e, 0x84, 0x1c,
+    0x0d, 0x5f, 0x8b, 0xbd, 0x2a, 0x9b, 0x03, 0xd2, 0xf3, 0x37, 0x83, 0x35, 0xd0, 0x80, 0x85, 0x62,
+    0x7b, 0x79, 0x18, 0xf5, 0xaf, 0x8a, 0x5d, 0x21, 0x78, 0x34, 0x6b, 0x0e, 0x85, 0xdd, 0xda, 0x5b,
+    0x3d, 0x22, 0x79, 0x71, 0xe6, 0xb1, 0x72, 0x55, 0x4f, 0xd1, 0x9a, 0xb6, 0xc4, 0x36, 0x65, 0x51,
+    0xb7, 0x6a, 0x05, 0xb9, 0x9e, 0xc5, 0x8b, 0xaf, 0x1f, 0x2d, 0xcb, 0xde, 0xa4, 0x0b, 0xb5, 0x24,
+    0x6e, 0x50, 0x29, 0x37, 0xa8, 0x56, 0x52, 0xba, 0xc9, 0x53, 0x74, 0x14, 0xe3, 0xc7, 0xe9, 0x7f,
+    0x95, 0x6e, 0xa8, 0xda, 0x16, 0x42, 0xde, 0xaf, 0xeb, 0x08, 0x07, 0xfd, 0xfb, 0x10, 0xd5, 0xe3,
+    0x4d, 0xeb, 0x56, 0x97, 0x8d, 0x18, 0x6d, 0x71, 0xe4, 0x8d, 0xe6, 0x6e, 0x31, 0x8e, 0x28, 0xa8,
+    0x7e, 0x30, 0xda, 0x0e, 0xbe, 0xfe, 0x23, 0x57, 0x30, 0xdc, 0xcd, 0xa2, 0x7f, 0x1d, 0x6f, 0x4a,
+    0x3b, 0xf9, 0xdc, 0x83, 0xfe, 0xfe, 0x65, 0xbc, 0x75, 0x80, 0xa9, 0x3e, 0x40, 0x99, 0x8b, 0x75,
+    0xb5, 0x33, 0xf7, 0x82, 0xc8, 0x0c, 0x53, 0x9f, 0xb1, 0x7f, 0xa4, 0x4b, 0xee, 0x3a, 0x6f, 0xae,
+    0xbf, 0xd0, 0x9d, 0x94, 0xd4, 0xfd, 0x7c, 0x7d, 0xfd, 0xf9, 0xee, 0x64, 0x4b, 0x48, 0xf1, 0xb6,
+    0xfc, 0xfc, 0xad, 0x45, 0x21, 0xec, 0x33, 0x6f, 0x6b, 0x71, 0x08, 0x71, 0x5d, 0xba, 0xe1, 0xed,
+    0x3d, 0x6a, 0xf5, 0x9e, 0xb7, 0x37, 0x2c, 0xdd, 0x70, 0x6d, 0x58, 0xad, 0x1e, 0xbe, 0x36, 0xb2,
+    0xb4, 0xe0, 0xa8, 0x35, 0x35, 0xd5, 0x7a, 0xb4, 0x60, 0x69, 0xfe, 0x91, 0xce, 0xb4, 0xb4, 0xce,
+    0x23, 0xac, 0xb6, 0xc7, 0x98, 0x32, 0x9a, 0xe2, 0xa4, 0xe2, 0xf0, 0x8c, 0x93, 0xeb, 0xbf, 0xe3,
+    0x39, 0xf6, 0xb4, 0x34, 0x92, 0x7b, 0x11, 0xa6, 0xd1, 0x0a, 0xfd, 0x81, 0xba, 0x75, 0xb3, 0xdd,
+    0x92, 0x4c, 0xfb, 0x38, 0x3c, 0xb7, 0xf8, 0xab, 0xda, 0xb5, 0xb9, 0xed, 0x80, 0xe7, 0x9e, 0xd9,
+    0x3b, 0xab, 0x35, 0x16, 0x95, 0x3f, 0x65, 0xba, 0xff, 0x0f, 0xde, 0x27, 0xb6, 0x6f, 0x39, 0x40,
+    0x8f, 0x69, 0x18, 0x29, 0xc0, 0x73, 0xff, 0x15, 0xd0, 0x5f, 0x93, 0xf7, 0x28, 0x93, 0xdb, 0x4f,
+    0x20, 0x0e, 0x0b, 0xca, 0x38, 0x2c, 0x78, 0xc0, 0x4f, 0x44, 0xd8, 0x8f, 0x71, 0xfe, 0x22, 0xa7,
+    0xc6, 0xc9, 0xd1, 0xb5, 0xe6, 0xb1, 0x8a, 0xb2, 0xe1, 0xda, 0x44, 0xb7, 0xd9, 0xb2, 0xba, 0xfd,
+    0xe5, 0xe5, 0x63, 0xb5, 0x91, 0xed, 0x7e, 0x2a, 0xf0, 0xf7, 0xc1, 0x1c, 0x4f, 0x97, 0x50, 0x75,
+    0x47, 0x8e, 0xb6, 0x5d, 0xe5, 0xc7, 0x94, 0xf1, 0x5c, 0x6e, 0xdc, 0xf7, 0xa3, 0xce, 0xff, 0x5b,
+    0x27, 0x3f, 0xd1, 0x9e, 0x9c, 0xb5, 0x19, 0x9c, 0x3c, 0xac, 0xbe, 0x34, 0x3a, 0xb9, 0xe3, 0x09,
+    0xfb, 0xa8, 0x93, 0xbd, 0x1c, 0x3f, 0x5e, 0x0e, 0xed, 0xac, 0x70, 0xec, 0xcb, 0x08, 0x04, 0xf6,
+    0x49, 0x06, 0x86, 0x7c, 0x3d, 0xee, 0xa3, 0x3d, 0xfd, 0xbc, 0x15, 0x1b, 0x54, 0x81, 0x54, 0x50,
+    0x50, 0xe1, 0x40, 0xa9, 0xd7, 0x6a, 0x6a, 0xeb, 0x64, 0x3b, 0x1d, 0xe5, 0x54, 0x4f, 0xd1, 0x91,
+    0x55, 0x5b, 0x94, 0xee, 0xa6, 0x4b, 0xdb, 0xe5, 0x02, 0xfb, 0x9e, 0xe0, 0x37, 0xd4, 0x61, 0xa0,
+    0x27, 0x61, 0x63, 0x62, 0xf6, 0x4c, 0xf0, 0x3f, 0xc5, 0xc4, 0x8e, 0xed, 0x58, 0x76, 0x8d, 0xe8,
+    0x08, 0x89, 0x57, 0x04, 0x6d, 0xb4, 0xe8, 0x06, 0xcb, 0xc4, 0x92, 0x8a, 0xc1, 0xfc, 0xae, 0xf3,
+    0x65, 0x16, 0xd9, 0xc6, 0xc2, 0xe2, 0x16, 0x89, 0x57, 0x5c, 0x73, 0x61, 0xff, 0x69, 0xf5, 0x5a,
+    0xe3, 0xb0, 0x6e, 0xfb, 0x15, 0xbd, 0x85, 0x57, 0xba, 0x2d, 0x49, 0xd7, 0x99, 0x80, 0xe7, 0xae,
+    0xce, 0x49, 0x9b, 0x3f, 0x57, 0x9c, 0x52, 0x9e, 0x18, 0x53, 0xab, 0x0e, 0xce, 0xd9, 0x53, 0xb4,
+    0xb6, 0x32, 0x61, 0x6d, 0x6e, 0xf0, 0xf2, 0x68, 0x71, 0xd0, 0xdc, 0xc5, 0x5a, 0x4b, 0x6e, 0x62,
+    0x83, 0x3a, 0xa8, 0x68, 0x6f, 0x4e, 0x8e, 0x3e, 0x40, 0x5a, 0xc0, 0x5a, 0xf7, 0xbc, 0xa9, 0x6f,
+    0x48, 0x06, 0x2f, 0x0b, 0x46, 0x40, 0xe4, 0x58, 0xef, 0x4e, 0x87, 0xb7, 0xf6, 0x1d, 0x2b, 0xe0,
+    0x83, 0x44, 0xd8, 0x3e, 0xbf, 0x66, 0xf1, 0x97, 0xad, 0x58, 0xb8, 0x46, 0xc4, 0xf3, 0x4a, 0xf5,
+    0x4d, 0x36, 0xc5, 0xd0, 0x51, 0xe5, 0xe5, 0xd8, 0x6b, 0xe2, 0x27, 0x99, 0x8a, 0xf9, 0x02, 0xaa,
+    0x4a, 0xe0, 0x1c, 0xde, 0x59, 0x07, 0xb4, 0x46, 0x41, 0xc6, 0xf7, 0xe8, 0x28, 0xbb, 0xa7, 0x70,
+    0x33, 0xa4, 0xe7, 0x83, 0x8d, 0x4e, 0x36, 0x6a, 0x76, 0xc8, 0xa3, 0x69, 0x6f, 0x15, 0xc6, 0x85,
+    0x56, 0x3f, 0xd1, 0xac, 0xea, 0x2f, 0x09, 0x6b, 0xf3, 0x4f, 0x2e, 0x0c, 0xdf, 0x34, 0x2a, 0xbb,
+    0x4f, 0x25, 0x4c, 0xbc, 0x85, 0xdf, 0x20, 0xd5, 0xcf, 0x75, 0xa7, 0x06, 0xeb, 0x0f, 0x35, 0x90,
+    0x17, 0x6c, 0x19, 0xb9, 0xeb, 0x93, 0x17, 0x57, 0x9d, 0x66, 0xb9, 0xf4, 0x03, 0x13, 0x39, 0xcf,
+    0x51, 0x7e, 0x24, 0x82, 0xc6, 0x9f, 0x62, 0x9d, 0x95, 0xa9, 0xcd, 0x63, 0x3e, 0xc5, 0x65, 0x1e,
+    0xf9, 0x8c, 0xa9, 0x95, 0x7a, 0x8b, 0x05, 0xc6, 0xc9, 0x88, 0x26, 0xae, 0x6e, 0x3c, 0x42, 0xbc,
+    0xd7, 0x21, 0xf5, 0x20, 0x82, 0xae, 0x62, 0x37, 0xee, 0x7d, 0x29, 0x4f, 0xb6, 0xa9, 0x27, 0x10,
+    0xa1, 0xd8, 0x10, 0xda, 0x1f, 0xbf, 0x83, 0x79, 0x39, 0x62, 0xe6, 0xbb, 0x9c, 0x1b, 0x5f, 0x84,
+    0xe6, 0x31, 0x6f, 0xd1, 0x01, 0x9f, 0x75, 0x32, 0x6f, 0xe6, 0xda, 0x30, 0x96, 0xe5, 0x30, 0x7f,
+    0x0e, 0xb1, 0x51, 0xb1, 0x9f, 0xb1, 0xa0, 0x31, 0x79, 0xe5, 0x1e, 0xdc, 0x5e, 0xa3, 0xe2, 0xb9,
+    0x1e, 0xde, 0x65, 0x26, 0xa9, 0xa2, 0xdf, 0xb2, 0x91, 0x26, 0x70, 0x76, 0x01, 0xfa, 0xf8, 0xa7,
+    0xc8, 0xf9, 0x3a, 0xdc, 0x56, 0xec, 0x62, 0x86, 0x70, 0xf7, 0x20, 0xf3, 0x3e, 0xf3, 0xfe, 0x20,
+    0xee, 0x62, 0x86, 0x00, 0x08, 0x32, 0xf1, 0x45, 0xdb, 0x5f, 0x6c, 0x1f, 0xe1, 0x77, 0x98, 0x08,
+    0x12, 0x40, 0x3c, 0x40, 0x32, 0x1f, 0x26, 0x93, 0x1a, 0x87, 0xf6, 0x9e, 0x6c, 0x0c, 0xcd, 0x4a,
+    0xc6, 0x05, 0x76, 0xfe, 0xfe, 0x8e, 0x38, 0x8f, 0xc2, 0xde, 0xb0, 0x64, 0xfc, 0x2d, 0x56, 0xf7,
+    0x32, 0x11, 0x73, 0x56, 0x25, 0x1b, 0x32, 0x3c, 0x63, 0x5c, 0xf1, 0xac, 0x40, 0x27, 0x59, 0x41,
+    0x8c, 0xf7, 0xef, 0x71, 0x81, 0x4f, 0x3e, 0x53, 0x54, 0x47, 0x7d, 0x30, 0x31, 0x7f, 0x85, 0x4e,
+    0x2b, 0x71, 0xe6, 0x55, 0x12, 0x3a, 0x28, 0x2f, 0x81, 0x7e, 0x75, 0xb2, 0xb4, 0x53, 0x4c, 0xab,
+    0x60, 0x4c, 0xf3, 0x81, 0xbb, 0x67, 0x80, 0xfa, 0xbf, 0x8d, 0xb3, 0xa9, 0x67, 0x26, 0x3f, 0x22,
+    0x93, 0x36, 0xdf, 0x0c, 0xf2, 0x6b, 0xb9, 0xd4, 0xe6, 0x6b, 0x30, 0x18, 0xa8, 0x8e, 0xc9, 0x25,
+    0x85, 0xd4, 0xef, 0x6a, 0x6a, 0x58, 0x9d, 0x27, 0x33, 0x66, 0x32, 0xc6, 0x8f, 0x85, 0x19, 0x65,
+    0x05, 0x58, 0x06, 0x18, 0x83, 0xfd, 0xc0, 0x57, 0x22, 0x66, 0x77, 0x9b, 0xa4, 0x52, 0x4f, 0x01,
+    0x17, 0x77, 0x80, 0xe9, 0x4a, 0xec, 0x87, 0xc1, 0x5e, 0x5e, 0x64, 0xe3, 0xc2, 0xcd, 0x0d, 0xa9,
+    0x63, 0x1b, 0xad, 0x75, 0xb1, 0xc3, 0x47, 0x17, 0xf7, 0x0e, 0xc7, 0x86, 0x56, 0x69, 0x36, 0x8e,
+    0xa5, 0x8a, 0xeb, 0xf8, 0xb1, 0xaa, 0xc0, 0x1b, 0xdb, 0x6e, 0x97, 0x1c, 0xd4, 0x69, 0x07, 0xd6,
+    0xdf, 0x36, 0x5e, 0x1e, 0xb8, 0xf7, 0x64, 0x96, 0xff, 0xf6, 0x4b, 0xc6, 0xcf, 0x55, 0x2d, 0x09,
+    0x5a, 0xdd, 0xc1, 0xb2, 0xcf, 0x75, 0x07, 0x1a, 0xd8, 0x53, 0x29, 0x58, 0xc3, 0xcc, 0x9b, 0xb1,
+    0x8f, 0x32, 0xaf, 0x8a, 0x37, 0xfe, 0xc3, 0x3a, 0xfe, 0x15, 0x96, 0x1b, 0x17, 0xe0, 0xa6, 0x0c,
+    0xb8, 0xf1, 0x64, 0x6d, 0x41, 0x1b, 0xc1, 0xc1, 0x24, 0xe8, 0x48, 0xc4, 0x1a, 0x28, 0xcb, 0x05,
+    0xc5, 0x1d, 0xee, 0xb1, 0xb1, 0x88, 0x68, 0x99, 0x9d, 0x53, 0xd7, 0x05, 0x7d, 0xd3, 0x1c, 0x84,
+    0xd6, 0xc6, 0x2f, 0x2a, 0xa8, 0x13, 0x03, 0x6b, 0x1d, 0xe6, 0xd8, 0x61, 0xde, 0x5f, 0x54, 0x7e,
+    0x03, 0x97, 0x8d, 0xb7, 0x95, 0x2d, 0xf1, 0xca, 0xfc, 0x03, 0x25, 0xb7, 0x75, 0x07, 0x9b, 0xee,
+    0x8d, 0x65, 0x2d, 0x6a, 0x38, 0xa0, 0xfb, 0xbc, 0x6c, 0x7f, 0x81, 0x72, 0xe7, 0x86, 0xcf, 0x8d,
+    0x97, 0xb6, 0xb3, 0x3e, 0xbb, 0x07, 0x9f, 0xa6, 0xff, 0x44, 0x89, 0xd8, 0xdd, 0x4b, 0x59, 0x98,
+    0xdd, 0x2b, 0xfd, 0x1d, 0xae, 0xea, 0xc0, 0x00, 0x6f, 0xc7, 0xe9, 0x42, 0x77, 0x4d, 0x80, 0xa2,
+    0x3e, 0x25, 0xbf, 0x2f, 0x2b, 0xae, 0x2c, 0x36, 0x2a, 0x7b, 0x75, 0x9d, 0xbf, 0xbc, 0x3e, 0xa5,
+    0x70, 0xb3, 0x7c, 0x5d, 0x69, 0x64, 0x6c, 0x6e, 0x30, 0xb1, 0x25, 0x5b, 0x4b, 0x23, 0x32, 0x52,
+    0x22, 0xd7, 0x4a, 0x0c, 0x19, 0x38, 0xd5, 0x5a, 0x12, 0xae, 0x48, 0x8a, 0x91, 0x44, 0x99, 0xa6,
+    0xa6, 0x50, 0x3e, 0xd3, 0x47, 0x06, 0xf0, 0x73, 0x7c, 0x01, 0xaa, 0x43, 0x88, 0x19, 0x64, 0xf7,
+    0xe8, 0x99, 0xbd, 0xf8, 0x06, 0x7e, 0x1a, 0x72, 0x6a, 0x21, 0x67, 0x2f, 0xe4, 0xc8, 0x99, 0xbd,
+    0x64, 0x0c, 0xbf, 0x00, 0x39, 0x26, 0x47, 0x4e, 0x1a, 0xb3, 0x9d, 0xec, 0xe4, 0x72, 0xcc, 0x8e,
+    0x9c, 0x18, 0xa8, 0x73, 0x19, 0x3f, 0x05, 0x39, 0xf5, 0x8e, 0x1c, 0x33, 0xd4, 0x19, 0xe5, 0x72,
+    0x1a, 0x1c, 0x39, 0x7a, 0xc8, 0x39, 0x80, 0xcf, 0x43, 0x4e, 0xa3, 0x23, 0x27, 0x1e, 0x5a, 0xed,
+    0xe5, 0xea, 0x34, 0x39, 0x72, 0xb2, 0xa0, 0xce, 0x30, 0x47, 0xb9, 0xf9, 0x41, 0xef, 0x83, 0xa4,
+    0x97, 0xcb, 0x69, 0x61, 0x73, 0x40, 0x2b, 0x72, 0x18, 0x8e, 0x31, 0x6a, 0x29, 0x7a, 0x6c, 0xe6,
+    0xa9, 0x20, 0x28, 0x65, 0xc6, 0x79, 0x1d, 0xbb, 0xa5, 0x40, 0xc6, 0x6c, 0x6f, 0x61, 0x1f, 0x71,
+    0xf4, 0x42, 0xb5, 0xb2, 0x50, 0x67, 0x4a, 0xee, 0x2e, 0xd0, 0x5a, 0x64, 0x62, 0xad, 0xe4, 0x7f,
+    0x0a, 0x0a, 0xe4, 0x78, 0x61, 0xa8, 0x3c, 0xee, 0xb1, 0x38, 0x45, 0x51, 0x72, 0x52, 0x53, 0x92,
+    0xb4, 0x2a, 0x35, 0xac, 0xa4, 0x58, 0xfc, 0x26, 0x50, 0xee, 0x06, 0xa5, 0xdf, 0xa0, 0xbc, 0xa6,
+    0x4f, 0x25, 0x05, 0x92, 0x15, 0xf8, 0x86, 0xf1, 0x4b, 0x9c, 0x44, 0x79, 0x4d, 0x7e, 0x45, 0x46,
+    0x92, 0x75, 0xec, 0x2e, 0x70, 0xfe, 0xd4, 0x1d, 0x32, 0x00, 0xbd, 0xb3, 0x5f, 0x2d, 0xb0, 0xfb,
+    0x43, 0x0e, 0x8c, 0x9a, 0x3e, 0xf7, 0xa1, 0x1e, 0x9c, 0x1e, 0x4e, 0x2f, 0x95, 0xc8, 0x40, 0x62,
+    0x57, 0x5e, 0x5e, 0x77, 0x72, 0x52, 0x77, 0x6e, 0x7e, 0x57, 0x92, 0x31, 0x40, 0x19, 0x1d, 0xa5,
+    0x0c, 0x08, 0xc8, 0x8a, 0x8a, 0x52, 0xfa, 0xe3, 0x9f, 0x6f, 0x6f, 0x18, 0x91, 0xcb, 0x47, 0x1a,
+    0xec, 0x0f, 0x66, 0xea, 0x90, 0xc2, 0x14, 0x11, 0x61, 0x52, 0x1c, 0x92, 0xd7, 0x46, 0x46, 0xd6,
+    0xb2, 0x56, 0x97, 0x06, 0xbd, 0xed, 0x84, 0xde, 0xe6, 0xa3, 0xb0, 0x87, 0xa7, 0x93, 0xff, 0x2c,
+    0xab, 0xfd, 0x6c, 0xd2, 0x91, 0x76, 0x6c, 0xee, 0x41, 0x55, 0xfb, 0xc9, 0xe4, 0x6c, 0x65, 0xac,
+    0x3a, 0x30, 0x2b, 0x2f, 0xbd, 0xc2, 0x98, 0xde, 0x25, 0xd7, 0x5a, 0x93, 0x65, 0x1d, 0xb9, 0xa5,
+    0xa5, 0xfa, 0x9e, 0x84, 0xcc, 0x3e, 0x6d, 0xda, 0x96, 0x5c, 0x63, 0xad, 0x36, 0xb7, 0x58, 0x5c,
+    0x18, 0x83, 0x5f, 0xf2, 0x8d, 0xf5, 0x5b, 0xab, 0x4a, 0x8d, 0x49, 0x2c, 0x97, 0x86, 0x55, 0xa4,
+    0x86, 0x17, 0x48, 0xbd, 0xa3, 0xd6, 0xe8, 0xe2, 0xd3, 0xaa, 0x25, 0x6b, 0x0c, 0xaa, 0x38, 0xb5,
+    0x42, 0x16, 0x16, 0xb7, 0x88, 0xe5, 0x27, 0x06, 0x6e, 0x97, 0xc1, 0x22, 0xa7, 0x77, 0x27, 0xfd,
+    0xa7, 0x4f, 0x22, 0xc9, 0x65, 0xdb, 0x76, 0x1a, 0x0f, 0xe6, 0xd4, 0x33, 0x0c, 0xde, 0x6e, 0xc4,
+    0xa2, 0xc2, 0x44, 0xe2, 0x7d, 0x91, 0xb9, 0x48, 0xd0, 0xe4, 0xd7, 0x50, 0x9d, 0xfb, 0x1e, 0xe2,
+    0x0e, 0x19, 0x85, 0xa4, 0x0f, 0x78, 0x0f, 0x77, 0x16, 0x29, 0x98, 0x21, 0x00, 0x1b, 0x72, 0x87,
+    0x79, 0x39, 0x98, 0x06, 0xf1, 0x6e, 0x69, 0x43, 0xf1, 0xcf, 0x99, 0xed, 0x8b, 0x45, 0x39, 0x52,
+    0x4d, 0x7b, 0x62, 0x74, 0xa7, 0x3e, 0xd1, 0xaa, 0xe6, 0xd5, 0x08, 0xf4, 0x49, 0x45, 0x5a, 0x7d,
+    0x41, 0x42, 0x32, 0x6e, 0xf3, 0xc6, 0x5b, 0x75, 0xb7, 0x67, 0x2f, 0x88, 0x6d, 0x56, 0xa5, 0xb7,
+    0xa7, 0x85, 0x55, 0xa4, 0x27, 0x26, 0xe9, 0x35, 0xf2, 0xd2, 0x25, 0xd0, 0x8f, 0x1e, 0xfa, 0x39,
+    0x40, 0x2d, 0x46, 0xab, 0x1d, 0xe7, 0x8e, 0x33, 0x46, 0xc2, 0xf1, 0x0d, 0x06, 0x7b, 0x0c, 0xff,
+    0x88, 0xba, 0xd8, 0x89, 0x90, 0xcc, 0xf1, 0x98, 0x5d, 0xb5, 0x2f, 0x2b, 0x34, 0x47, 0x22, 0x91,
+    0x07, 0xe6, 0xe7, 0x8b, 0x73, 0x25, 0xc4, 0x87, 0xc4, 0x37, 0x64, 0x64, 0x37, 0x45, 0x25, 0x59,
+    0xb5, 0x05, 0xfd, 0xe9, 0x51, 0x0d, 0x47, 0xa9, 0xc5, 0x85, 0xc9, 0x83, 0xa6, 0x06, 0x99, 0x2e,
+    0x54, 0xac, 0x11, 0x67, 0x56, 0x04, 0xac, 0xf3, 0x5f, 0x1e, 0xac, 0x8b, 0x4d, 0x69, 0x4b, 0x57,
+    0x74, 0xa4, 0x65, 0x6e, 0x2d, 0x4c, 0xac, 0x3d, 0xd9, 0x14, 0x05, 0x1c, 0xc4, 0xb3, 0x33, 0x37,
+    0x48, 0xfa, 0xf0, 0x84, 0x91, 0xec, 0x65, 0x86, 0x1a, 0x70, 0x3d, 0xb3, 0x90, 0x12, 0xc5, 0xda,
+    0x02, 0xc8, 0xcb, 0x05, 0x30, 0x37, 0x64, 0x01, 0x9f, 0xc3, 0x30, 0xb2, 0x6e, 0xe0, 0xdd, 0x21,
+    0xec, 0x5e, 0x4b, 0xd5, 0x7f, 0x39, 0x41, 0xfc, 0x0f, 0x27, 0x8c, 0x8e, 0x62, 0x32, 0x0c, 0x6b,
+    0x53, 0xcd, 0x26, 0x85, 0xbc, 0x5f, 0xa3, 0xed, 0x97, 0x1b, 0x43, 0xb3, 0x25, 0x12, 0x6d, 0x48,
+    0x48, 0xb6, 0x14, 0xee, 0xd9, 0x29, 0x16, 0x85, 0xb2, 0x3d, 0x25, 0xa5, 0x5d, 0xae, 0x68, 0x4f,
+    0x35, 0x05, 0xa6, 0x87, 0xa6, 0xea, 0x02, 0x33, 0x42, 0x53, 0x74, 0xb7, 0xd2, 0x2b, 0xc5, 0xe2,
+    0xca, 0xf4, 0x75, 0x65, 0x52, 0x69, 0x59, 0x4c, 0x50, 0xfc, 0xb2, 0x65, 0xf1, 0x41, 0xdc, 0x1d,
+    0x8f, 0xc6, 0xe8, 0xc2, 0xc2, 0x74, 0x31, 0x29, 0x7a, 0xb1, 0x58, 0x9f, 0xe1, 0x1f, 0xb3, 0x2c,
+    0x35, 0x2e, 0x20, 0xca, 0x27, 0x95, 0xf5, 0xbc, 0xa9, 0x1f, 0x48, 0x2f, 0xf0, 0x1c, 0x8c, 0x50,
+    0xdb, 0x23, 0xdf, 0xdb, 0x3c, 0xd0, 0xb0, 0xb7, 0x23, 0x74, 0x78, 0xf8, 0x89, 0x0e, 0x7b, 0x74,
+    0xfe, 0x81, 0x7b, 0xc3, 0x0e, 0xd9, 0xea, 0x2c, 0xa9, 0x54, 0xb9, 0x2a, 0x40, 0x19, 0x11, 0x9b,
+    0xb3, 0xda, 0x17, 0x27, 0xd4, 0xa7, 0x6a, 0x5a, 0x63, 0x93, 0xbb, 0x72, 0x0b, 0xbb, 0x13, 0xd7,
+    0x18, 0x0e, 0x9b, 0x85, 0x59, 0xc9, 0xfd, 0x45, 0x3d, 0x29, 0x25, 0x21, 0xd2, 0x5c, 0x71, 0xa8,
+    0x46, 0xbc, 0x26, 0xdd, 0xc7, 0x47, 0x5a, 0x1a, 0x9d, 0x6a, 0xc9, 0x50, 0x74, 0xcb, 0xe5, 0xbb,
+    0x2a, 0xe3, 0x2b, 0x8e, 0x34, 0x44, 0x21, 0xf6, 0xcc, 0xb0, 0x90, 0xfd, 0x52, 0x8e, 0x66, 0xbf,
+    0xc9, 0x9c, 0xc3, 0x45, 0xed, 0x90, 0xc6, 0x08, 0xcd, 0x86, 0x37, 0x7b, 0x1a, 0xc3, 0x5c, 0xbb,
+    0xc0, 0x91, 0x26, 0x90, 0xbf, 0xdc, 0x91, 0x66, 0xe7, 0xe0, 0x50, 0x47, 0xda, 0x1f, 0xf2, 0xa3,
+    0x1c, 0xe9, 0x00, 0xc8, 0x4f, 0x41, 0x1a, 0x54, 0x85, 0x0c, 0x68, 0x3d, 0xa0, 0xa0, 0x1e, 0x90,
+    0x27, 0x0f, 0xde, 0x8c, 0xf0, 0x5e, 0x83, 0x5a, 0x21, 0x6d, 0x44, 0x95, 0xf0, 0xac, 0x41, 0xe9,
+    0x70, 0xd7, 0x43, 0x0d, 0x23, 0xaa, 0x00, 0x0c, 0x9a, 0x2e, 0x57, 0x02, 0xbe, 0x35, 0x73, 0x5f,
+    0xf5, 0xd5, 0x01, 0x95, 0x06, 0x2e, 0x55, 0xef, 0xf8, 0xaa, 0x0f, 0x7e, 0x53, 0x26, 0xf6, 0xdb,
+    0xb5, 0x7f, 0xf3, 0x63, 0xbf, 0xee, 0x73, 0x42, 0x4e, 0x80, 0x70, 0x6e, 0xdc, 0x37, 0x7d, 0xb3,
+    0x1f, 0x7c, 0x23, 0x4a, 0xd0, 0x32, 0x14, 0x0d, 0x79, 0x32, 0xa4, 0x63, 0xf7, 0x8a, 0x20, 0xcf,
+    0x05, 0xb0, 0x6e, 0x31, 0xc2, 0x49, 0x29, 0xf2, 0x6c, 0x68, 0x43, 0x73, 0x74, 0xa7, 0x66, 0x7c,
+    0x23, 0xea, 0x02, 0xeb, 0x95, 0x70, 0x44, 0x73, 0xe5, 0x0b, 0x2a, 0xda, 0x9b, 0xeb, 0xd0, 0x72,
+    0x43, 0x73, 0x55, 0x2d, 0x5a, 0x5e, 0xa7, 0x6f, 0xad, 0x07, 0x0d, 0x3c, 0xda, 0x62, 0xba, 0x1d,
+    0x06, 0x5a, 0xd3, 0xdf, 0x1e, 0xb2, 0x9f, 0xee, 0x92, 0xb6, 0xca, 0xd6, 0x1a, 0xd0, 0x1f, 0x6a,
+    0x33, 0xd4, 0xb4, 0xc2, 0x03, 0x1b, 0x5b, 0xf5, 0x75, 0x98, 0xe5, 0x87, 0x8f, 0x3c, 0xd8, 0xfe,
+    0x59, 0xee, 0x40, 0x77, 0x95, 0x8e, 0xd6, 0x08, 0xf3, 0x70, 0x10, 0x27, 0x29, 0xd4, 0xc1, 0x01,
+    0x0f, 0xb8, 0x41, 0xff, 0x07
 };
 
 #endif // ROBOTO_LIGHT
@@ -1,9141 +1,539 @@
 #ifndef ROBOTO_MEDIUM_H
 #define ROBOTO_MEDIUM_H
 
+// subset to 105 codepoints, raw DEFLATE, 8488 bytes -> 11372 bytes
 static const unsigned char font_data_medium[] = {
-    0x00, 0x01, 0x00, 0x00, 0x00, 0x12, 0x01, 0x00, 0x00, 0x04, 0x00, 0x20, 0x47, 0x44, 0x45, 0x46,
-    0xa6, 0x43, 0xa4, 0x4c, 0x00, 0x00, 0x03, 0x90, 0x00, 0x00, 0x02, 0x58, 0x47, 0x50, 0x4f, 0x53,
-    0x62, 0x65, 0x69, 0x68, 0x00, 0x00, 0x5d, 0xf8, 0x00, 0x00, 0x58, 0xfc, 0x47, 0x53, 0x55, 0x42,
-    0xfb, 0x94, 0xe5, 0x31, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x15, 0xf6, 0x4f, 0x53, 0x2f, 0x32,
-    0x97, 0xe7, 0xb1, 0x93, 0x00, 0x00, 0x02, 0x30, 0x00, 0x00, 0x00, 0x60, 0x53, 0x54, 0x41, 0x54,
-    0x5e, 0xfc, 0x40, 0xdd, 0x00, 0x00, 0x01, 0xd4, 0x00, 0x00, 0x00, 0x5a, 0x63, 0x6d, 0x61, 0x70,
-    0xc1, 0x25, 0x61, 0xd3, 0x00, 0x00, 0x08, 0xb8, 0x00, 0x00, 0x06, 0x84, 0x63, 0x76, 0x74, 0x20,
-    0x3b, 0xf8, 0x26, 0x7d, 0x00, 0x00, 0x02, 0x90, 0x00, 0x00, 0x00, 0xfe, 0x66, 0x70, 0x67, 0x6d,
-    0xa8, 0x05, 0x84, 0x32, 0x00, 0x00, 0x23, 0xd4, 0x00, 0x00, 0x0f, 0x86, 0x67, 0x61, 0x73, 0x70,
-    0x00, 0x08, 0x00, 0x19, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0x00, 0x0c, 0x67, 0x6c, 0x79, 0x66,
-    0x34, 0x41, 0x88, 0x5e, 0x00, 0x00, 0xb6, 0xf4, 0x00, 0x01, 0x83, 0xe0, 0x68, 0x65, 0x61, 0x64,
-    0x09, 0x7c, 0x61, 0x31, 0x00, 0x00, 0x01, 0x9c, 0x00, 0x00, 0x00, 0x36, 0x68, 0x68, 0x65, 0x61,
-    0x0a, 0xf6, 0x0a, 0xe2, 0x00, 0x00, 0x01, 0x78, 0x00, 0x00, 0x00, 0x24, 0x68, 0x6d, 0x74, 0x78,
-    0x40, 0xdb, 0x58, 0xf4, 0x00, 0x00, 0x33, 0x5c, 0x00, 0x00, 0x14, 0xa4, 0x6c, 0x6f, 0x63, 0x61,
-    0xd2, 0x74, 0x2f, 0x15, 0x00, 0x00, 0x19, 0x80, 0x00, 0x00, 0x0a, 0x54, 0x6d, 0x61, 0x78, 0x70,
-    0x08, 0xd9, 0x10, 0xc6, 0x00, 0x00, 0x01, 0x38, 0x00, 0x00, 0x00, 0x20, 0x6e, 0x61, 0x6d, 0x65,
-    0xb9, 0x40, 0xa7, 0x87, 0x00, 0x00, 0x0f, 0x3c, 0x00, 0x00, 0x0a, 0x42, 0x70, 0x6f, 0x73, 0x74,
-    0xff, 0x6d, 0x00, 0x64, 0x00, 0x00, 0x01, 0x58, 0x00, 0x00, 0x00, 0x20, 0x70, 0x72, 0x65, 0x70,
-    0x79, 0x58, 0xce, 0xd3, 0x00, 0x00, 0x05, 0xe8, 0x00, 0x00, 0x02, 0xce, 0x00, 0x01, 0x00, 0x02,
-    0x00, 0x08, 0x00, 0x08, 0xff, 0xff, 0x00, 0x0f, 0x00, 0x01, 0x00, 0x00, 0x05, 0x29, 0x00, 0xa9,
-    0x00, 0x15, 0x00, 0x76, 0x00, 0x07, 0x00, 0x02, 0x00, 0x10, 0x00, 0x2f, 0x00, 0x9a, 0x00, 0x00,
-    0x02, 0xe6, 0x0f, 0x75, 0x00, 0x03, 0x00, 0x01, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xff, 0x6a, 0x00, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x07, 0x6c, 0xfe, 0x0c,
-    0x00, 0x00, 0x09, 0x6e, 0xfa, 0x26, 0xfe, 0x3e, 0x09, 0x61, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x29, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0x03, 0x02, 0x4e, 0x6c, 0x34, 0xab, 0x2d, 0x5f, 0x0f, 0x3c, 0xf5, 0x00, 0x1b, 0x08, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xc4, 0xf0, 0x11, 0x2e, 0x00, 0x00, 0x00, 0x00, 0xe1, 0xd4, 0x02, 0x6f,
-    0xfa, 0x26, 0xfd, 0xd5, 0x09, 0x61, 0x08, 0x73, 0x00, 0x00, 0x00, 0x09, 0x00, 0x02, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x08, 0x00, 0x03, 0x00, 0x00, 0x00, 0x14,
-    0x00, 0x03, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x02, 0x77, 0x64, 0x74, 0x68, 0x01, 0x01, 0x00, 0x00,
-    0x77, 0x67, 0x68, 0x74, 0x01, 0x00, 0x00, 0x01, 0x69, 0x74, 0x61, 0x6c, 0x01, 0x02, 0x00, 0x02,
-    0x00, 0x22, 0x00, 0x16, 0x00, 0x06, 0x00, 0x03, 0x00, 0x02, 0x00, 0x02, 0x01, 0x28, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x01, 0x07, 0x01, 0xf4,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x01, 0x27, 0x00, 0x64, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x04, 0x04, 0x91, 0x01, 0xf4, 0x00, 0x05, 0x00, 0x00, 0x05, 0x9a, 0x05, 0x33, 0x00, 0x00,
-    0x01, 0x1f, 0x05, 0x9a, 0x05, 0x33, 0x00, 0x00, 0x03, 0xd1, 0x00, 0x66, 0x02, 0x00, 0x00, 0x00,
-    0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x02, 0xff, 0x50, 0x00,
-    0x20, 0x5b, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x47, 0x4f, 0x4f, 0x47, 0x00, 0x40,
-    0x00, 0x00, 0xff, 0xfd, 0x06, 0x00, 0xfe, 0x00, 0x00, 0x66, 0x07, 0x9a, 0x02, 0x00, 0x20, 0x00,
-    0x01, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x04, 0x3a, 0x05, 0xb0, 0x00, 0x00, 0x00, 0x20, 0x00, 0x03,
-    0x06, 0x00, 0x00, 0x15, 0x05, 0xb0, 0x00, 0x14, 0x05, 0xb0, 0x00, 0x14, 0x04, 0x3a, 0x00, 0x14,
-    0x00, 0x00, 0xff, 0xec, 0x00, 0x00, 0xff, 0xec, 0x00, 0x00, 0xff, 0xec, 0xfe, 0x60, 0xff, 0xf5,
-    0x05, 0xb0, 0x00, 0x15, 0x00, 0x00, 0xff, 0xeb, 0x00, 0x00, 0x00, 0xbd, 0x00, 0xc0, 0x00, 0x9d,
-    0x00, 0x9d, 0x00, 0xba, 0x00, 0x97, 0x00, 0x97, 0x00, 0x27, 0x00, 0xc0, 0x00, 0x9d, 0x00, 0x86,
-    0x00, 0xbc, 0x00, 0xab, 0x00, 0xba, 0x00, 0x9a, 0x00, 0xd3, 0x00, 0xb3, 0x00, 0x99, 0x01, 0xe0,
-    0x00, 0x96, 0x00, 0xba, 0x00, 0x9a, 0x00, 0xa9, 0x01, 0x0b, 0x00, 0x82, 0x00, 0xae, 0x00, 0xa0,
-    0x00, 0x8c, 0x00, 0x95, 0x00, 0xb9, 0x00, 0xa9, 0x00, 0x17, 0x00, 0x93, 0x00, 0x9a, 0x00, 0x7b,
-    0x00, 0x8b, 0x00, 0xa1, 0x00, 0xde, 0x00, 0xa0, 0x00, 0x8c, 0x00, 0x9d, 0x00, 0xb6, 0x00, 0x27,
-    0x00, 0xc0, 0x00, 0x9d, 0x00, 0xa4, 0x00, 0x86, 0x00, 0xa2, 0x00, 0xab, 0x00, 0xb6, 0x00, 0xbf,
-    0x00, 0xba, 0x00, 0x82, 0x00, 0x8e, 0x00, 0x9a, 0x00, 0xa2, 0x00, 0xb2, 0x00, 0xd3, 0x00, 0x91,
-    0x00, 0x99, 0x00, 0xad, 0x00, 0xb3, 0x00, 0xbe, 0x01, 0xc9, 0x01, 0xfd, 0x00, 0x96, 0x00, 0xba,
-    0x00, 0x47, 0x00, 0x98, 0x00, 0x9d, 0x00, 0xa9, 0x01, 0x0b, 0x00, 0x82, 0x00, 0x99, 0x00, 0x9f,
-    0x00, 0xa9, 0x00, 0xb0, 0x00, 0x81, 0x00, 0x85, 0x00, 0x8b, 0x00, 0x94, 0x00, 0xa9, 0x00, 0xb5,
-    0x00, 0xba, 0x00, 0x17, 0x00, 0x50, 0x00, 0x63, 0x00, 0x78, 0x00, 0x7d, 0x00, 0x83, 0x00, 0x8b,
-    0x00, 0x90, 0x00, 0x98, 0x00, 0xa2, 0x00, 0xae, 0x00, 0xd4, 0x00, 0xde, 0x01, 0x26, 0x00, 0x7b,
-    0x00, 0x89, 0x00, 0x93, 0x00, 0x9d, 0x00, 0xa5, 0x00, 0xb4, 0x04, 0x8d, 0x00, 0x10, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x02, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x28, 0x00, 0x02,
-    0x00, 0x59, 0x00, 0x25, 0x00, 0x3e, 0x00, 0x01, 0x00, 0x44, 0x00, 0x5e, 0x00, 0x01, 0x00, 0x6a,
-    0x00, 0x6a, 0x00, 0x01, 0x00, 0x70, 0x00, 0x70, 0x00, 0x01, 0x00, 0x75, 0x00, 0x75, 0x00, 0x01,
-    0x00, 0x81, 0x00, 0x81, 0x00, 0x01, 0x00, 0x83, 0x00, 0x83, 0x00, 0x01, 0x00, 0x86, 0x00, 0x86,
-    0x00, 0x01, 0x00, 0x89, 0x00, 0x89, 0x00, 0x01, 0x00, 0x8b, 0x00, 0x96, 0x00, 0x01, 0x00, 0x98,
-    0x00, 0x9f, 0x00, 0x01, 0x00, 0xa1, 0x00, 0xa3, 0x00, 0x01, 0x00, 0xa5, 0x00, 0xa6, 0x00, 0x01,
-    0x00, 0xa8, 0x00, 0xad, 0x00, 0x03, 0x00, 0xb1, 0x00, 0xb1, 0x00, 0x01, 0x00, 0xba, 0x00, 0xbb,
-    0x00, 0x01, 0x00, 0xbf, 0x00, 0xbf, 0x00, 0x01, 0x00, 0xc1, 0x00, 0xc1, 0x00, 0x01, 0x00, 0xc3,
-    0x00, 0xc4, 0x00, 0x01, 0x00, 0xc7, 0x00, 0xc7, 0x00, 0x01, 0x00, 0xcb, 0x00, 0xcb, 0x00, 0x01,
-    0x00, 0xcd, 0x00, 0xce, 0x00, 0x01, 0x00, 0xd0, 0x00, 0xd1, 0x00, 0x01, 0x00, 0xd3, 0x00, 0xd3,
-    0x00, 0x01, 0x00, 0xda, 0x00, 0xde, 0x00, 0x01, 0x00, 0xe1, 0x00, 0xe1, 0x00, 0x01, 0x00, 0xe5,
-    0x00, 0xe5, 0x00, 0x01, 0x00, 0xe7, 0x00, 0xe9, 0x00, 0x01, 0x00, 0xeb, 0x00, 0xfb, 0x00, 0x01,
-    0x00, 0xfd, 0x00, 0xfd, 0x00, 0x01, 0x00, 0xff, 0x01, 0x01, 0x00, 0x01, 0x01, 0x03, 0x01, 0x03,
-    0x00, 0x01, 0x01, 0x08, 0x01, 0x09, 0x00, 0x01, 0x01, 0x16, 0x01, 0x1a, 0x00, 0x01, 0x01, 0x1c,
-    0x01, 0x1c, 0x00, 0x01, 0x01, 0x20, 0x01, 0x22, 0x00, 0x01, 0x01, 0x24, 0x01, 0x27, 0x00, 0x03,
-    0x01, 0x2a, 0x01, 0x2b, 0x00, 0x01, 0x01, 0x33, 0x01, 0x34, 0x00, 0x01, 0x01, 0x36, 0x01, 0x36,
-    0x00, 0x01, 0x01, 0x3b, 0x01, 0x3c, 0x00, 0x01, 0x01, 0x41, 0x01, 0x44, 0x00, 0x01, 0x01, 0x47,
-    0x01, 0x48, 0x00, 0x01, 0x01, 0x4b, 0x01, 0x4d, 0x00, 0x01, 0x01, 0x51, 0x01, 0x51, 0x00, 0x01,
-    0x01, 0x54, 0x01, 0x58, 0x00, 0x01, 0x01, 0x5d, 0x01, 0x5e, 0x00, 0x01, 0x01, 0x62, 0x01, 0x62,
-    0x00, 0x01, 0x01, 0x64, 0x01, 0x64, 0x00, 0x01, 0x01, 0x68, 0x01, 0x68, 0x00, 0x01, 0x01, 0x6a,
-    0x01, 0x6c, 0x00, 0x01, 0x01, 0x6e, 0x01, 0x6e, 0x00, 0x01, 0x01, 0x70, 0x01, 0x70, 0x00, 0x01,
-    0x01, 0xd5, 0x01, 0xdb, 0x00, 0x02, 0x01, 0xec, 0x02, 0x00, 0x00, 0x01, 0x02, 0x04, 0x02, 0x04,
-    0x00, 0x01, 0x02, 0x0d, 0x02, 0x0d, 0x00, 0x01, 0x02, 0x0f, 0x02, 0x0f, 0x00, 0x01, 0x02, 0x16,
-    0x02, 0x18, 0x00, 0x01, 0x02, 0x1a, 0x02, 0x1b, 0x00, 0x01, 0x02, 0x1d, 0x02, 0x1d, 0x00, 0x01,
-    0x02, 0x21, 0x02, 0x21, 0x00, 0x01, 0x02, 0x23, 0x02, 0x25, 0x00, 0x01, 0x02, 0x2b, 0x02, 0x2b,
-    0x00, 0x01, 0x02, 0x30, 0x02, 0x32, 0x00, 0x01, 0x02, 0x34, 0x02, 0x34, 0x00, 0x01, 0x02, 0x42,
-    0x02, 0x42, 0x00, 0x01, 0x02, 0x45, 0x02, 0x45, 0x00, 0x01, 0x02, 0x47, 0x02, 0x47, 0x00, 0x01,
-    0x02, 0x4a, 0x02, 0x4d, 0x00, 0x01, 0x02, 0x79, 0x02, 0x7d, 0x00, 0x01, 0x02, 0x8d, 0x02, 0x92,
-    0x00, 0x01, 0x02, 0x95, 0x02, 0xfd, 0x00, 0x01, 0x03, 0x00, 0x03, 0xbf, 0x00, 0x01, 0x03, 0xc1,
-    0x03, 0xc1, 0x00, 0x01, 0x03, 0xc3, 0x03, 0xcd, 0x00, 0x01, 0x03, 0xcf, 0x03, 0xd8, 0x00, 0x01,
-    0x03, 0xda, 0x03, 0xf5, 0x00, 0x01, 0x03, 0xf9, 0x03, 0xf9, 0x00, 0x01, 0x03, 0xfb, 0x04, 0x02,
-    0x00, 0x01, 0x04, 0x04, 0x04, 0x06, 0x00, 0x01, 0x04, 0x09, 0x04, 0x0d, 0x00, 0x01, 0x04, 0x0f,
-    0x04, 0x9a, 0x00, 0x01, 0x04, 0x9d, 0x04, 0x9e, 0x00, 0x01, 0x04, 0xa0, 0x04, 0xa1, 0x00, 0x01,
-    0x04, 0xa3, 0x04, 0xa6, 0x00, 0x01, 0x04, 0xb0, 0x05, 0x0c, 0x00, 0x01, 0x05, 0x0e, 0x05, 0x18,
-    0x00, 0x01, 0x05, 0x1b, 0x05, 0x28, 0x00, 0x01, 0x00, 0x01, 0x00, 0x03, 0x00, 0x00, 0x00, 0x2a,
-    0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x10, 0x00, 0x02, 0x00, 0x02, 0x00, 0xa8, 0x00, 0xac,
-    0x00, 0x00, 0x01, 0x24, 0x01, 0x27, 0x00, 0x05, 0x00, 0x02, 0x00, 0x01, 0x00, 0xa8, 0x00, 0xac,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0xad, 0x40, 0xff, 0x7e, 0x34, 0x7d, 0x55, 0x7c, 0x3e,
-    0xff, 0x1f, 0x7b, 0x3b, 0xff, 0x1f, 0x7a, 0x3d, 0xff, 0x1f, 0x79, 0x3b, 0x40, 0x1f, 0x78, 0x3c,
-    0xff, 0x1f, 0x77, 0x3c, 0x3d, 0x1f, 0x76, 0x35, 0x07, 0x1f, 0x75, 0x3a, 0xff, 0x1f, 0x74, 0x3a,
-    0x67, 0x1f, 0x73, 0x39, 0x4f, 0x1f, 0x72, 0x39, 0xff, 0x1f, 0x71, 0x36, 0xff, 0x1f, 0x70, 0x38,
-    0xcd, 0x1f, 0x6f, 0x38, 0xff, 0x1f, 0x6e, 0x37, 0x5e, 0x1f, 0x6d, 0x37, 0xcd, 0x1f, 0x6c, 0x37,
-    0xff, 0x1f, 0x6b, 0x37, 0x2d, 0x1f, 0x6a, 0x37, 0x18, 0x1f, 0x69, 0x34, 0xff, 0x1f, 0x68, 0x32,
-    0xff, 0x1f, 0x67, 0x32, 0xcd, 0x1f, 0x66, 0x33, 0xff, 0x1f, 0x65, 0x31, 0xff, 0x1f, 0x64, 0x30,
-    0xff, 0x1f, 0x63, 0x30, 0xab, 0x1f, 0x62, 0x30, 0x67, 0x1f, 0x61, 0x2e, 0xff, 0x1f, 0x60, 0x2e,
-    0x80, 0x1f, 0x5f, 0x2f, 0xff, 0x1f, 0x5e, 0x2f, 0x93, 0x1f, 0x5d, 0x2d, 0xff, 0x1f, 0x5c, 0x2c,
-    0xff, 0x1f, 0x5b, 0x2b, 0xff, 0x1f, 0x5a, 0x2a, 0xcd, 0x1f, 0x59, 0x2a, 0xff, 0x1f, 0x58, 0x2a,
-    0x0d, 0x1f, 0x57, 0x29, 0xff, 0x1f, 0x56, 0x28, 0xff, 0x1f, 0x55, 0x27, 0x24, 0x1f, 0x54, 0x27,
-    0x2d, 0x1f, 0x53, 0x25, 0x5e, 0x1f, 0x52, 0x25, 0xff, 0x1f, 0x51, 0x25, 0xab, 0x1f, 0x50, 0x26,
-    0xff, 0x1f, 0x4f, 0x26, 0x80, 0x1f, 0x4e, 0x24, 0xff, 0x1f, 0x4d, 0x23, 0x2b, 0x1f, 0x4c, 0x23,
-    0xab, 0x1f, 0x4b, 0x23, 0xff, 0x1f, 0x4a, 0x23, 0x56, 0x1f, 0x49, 0x23, 0x2b, 0x1f, 0x48, 0x22,
-    0xff, 0x1f, 0x47, 0x20, 0xff, 0x1f, 0x46, 0x20, 0x72, 0x1f, 0x45, 0x21, 0xff, 0x1f, 0x44, 0x21,
-    0x72, 0x1f, 0x43, 0x1f, 0xff, 0x1f, 0x42, 0x1e, 0x93, 0x1f, 0x41, 0x1e, 0xff, 0x1f, 0x40, 0x1d,
-    0xff, 0x1f, 0x3f, 0x1c, 0xff, 0x1f, 0x3d, 0x3b, 0x93, 0x40, 0xea, 0x1f, 0x3c, 0x3b, 0x34, 0x1f,
-    0x3a, 0x35, 0x0e, 0x1f, 0x39, 0x36, 0x72, 0x1f, 0x38, 0x36, 0x4f, 0x1f, 0x37, 0x36, 0x22, 0x1f,
-    0x36, 0x35, 0x93, 0x1f, 0x33, 0x32, 0x40, 0x1f, 0x31, 0x30, 0x72, 0x1f, 0x2f, 0x2e, 0x4a, 0x1f,
-    0x2b, 0x2a, 0x40, 0x1f, 0x27, 0x19, 0x04, 0x1f, 0x26, 0x25, 0x28, 0x1f, 0x25, 0x33, 0x1b, 0x19,
-    0x5c, 0x24, 0x1a, 0x12, 0x1f, 0x23, 0x05, 0x1a, 0x19, 0x5c, 0x22, 0x19, 0xff, 0x1f, 0x21, 0x20,
-    0x3d, 0x1f, 0x20, 0x38, 0x18, 0x16, 0x5c, 0x1f, 0x18, 0x2d, 0x1f, 0x1e, 0x17, 0xff, 0x1f, 0x1d,
-    0x16, 0xff, 0x1f, 0x1c, 0x16, 0x07, 0x1f, 0x1b, 0x33, 0x19, 0x1c, 0x5b, 0x18, 0x34, 0x16, 0x1c,
-    0x5b, 0x1a, 0x33, 0x19, 0x1c, 0x5b, 0x17, 0x34, 0x16, 0x1c, 0x5b, 0x15, 0x19, 0x3e, 0x16, 0xa6,
-    0x5a, 0x13, 0x31, 0x12, 0x55, 0x11, 0x31, 0x10, 0x55, 0x12, 0x59, 0x10, 0x59, 0x0d, 0x34, 0x0c,
-    0x55, 0x05, 0x34, 0x04, 0x55, 0x0c, 0x59, 0x04, 0x59, 0x1f, 0x04, 0x5f, 0x04, 0x02, 0x0f, 0x04,
-    0x7f, 0x04, 0xef, 0x04, 0x03, 0x0f, 0x5e, 0x0e, 0x55, 0x0b, 0x34, 0x0a, 0x55, 0x07, 0x34, 0x06,
-    0x55, 0x01, 0x31, 0x00, 0x55, 0x0e, 0x59, 0x0a, 0x59, 0x06, 0x59, 0x7f, 0x06, 0x01, 0x2f, 0x06,
-    0x4f, 0x06, 0x6f, 0x06, 0x03, 0x3f, 0x06, 0x5f, 0x06, 0x7f, 0x06, 0x03, 0x00, 0x59, 0x2f, 0x00,
-    0x01, 0x2f, 0x00, 0x6f, 0x00, 0xef, 0x00, 0x03, 0x09, 0x34, 0x08, 0x55, 0x03, 0x34, 0x02, 0x55,
-    0x08, 0x59, 0x02, 0x59, 0x1f, 0x02, 0x5f, 0x02, 0x02, 0x0f, 0x02, 0x7f, 0x02, 0xef, 0x02, 0x03,
-    0x03, 0x40, 0x40, 0x05, 0x01, 0xb8, 0x01, 0x90, 0xb0, 0x54, 0x2b, 0x4b, 0xb8, 0x07, 0xff, 0x52,
-    0x4b, 0xb0, 0x09, 0x50, 0x5b, 0xb0, 0x01, 0x88, 0xb0, 0x25, 0x53, 0xb0, 0x01, 0x88, 0xb0, 0x40,
-    0x51, 0x5a, 0xb0, 0x06, 0x88, 0xb0, 0x00, 0x55, 0x5a, 0x5b, 0x58, 0xb1, 0x01, 0x01, 0x8e, 0x59,
-    0x85, 0x8d, 0x8d, 0x00, 0x1d, 0x42, 0x4b, 0xb0, 0x90, 0x53, 0x58, 0xb2, 0x03, 0x00, 0x00, 0x1d,
-    0x42, 0x59, 0xb1, 0x02, 0x02, 0x43, 0x51, 0x58, 0xb1, 0x04, 0x03, 0x8e, 0x59, 0x73, 0x74, 0x00,
-    0x2b, 0x00, 0x2b, 0x2b, 0x2b, 0x73, 0x74, 0x00, 0x2b, 0x73, 0x74, 0x75, 0x00, 0x2b, 0x00, 0x2b,
-    0x00, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x73, 0x74, 0x00, 0x2b, 0x00, 0x2b, 0x2b, 0x2b, 0x00, 0x2b,
-    0x00, 0x2b, 0x2b, 0x2b, 0x01, 0x2b, 0x01, 0x2b, 0x01, 0x2b, 0x01, 0x2b, 0x01, 0x2b, 0x01, 0x2b,
-    0x2b, 0x00, 0x2b, 0x2b, 0x01, 0x2b, 0x2b, 0x01, 0x2b, 0x00, 0x2b, 0x00, 0x2b, 0x01, 0x2b, 0x2b,
-    0x2b, 0x2b, 0x2b, 0x01, 0x2b, 0x2b, 0x00, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x01, 0x2b,
-    0x2b, 0x00, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x01, 0x2b, 0x00, 0x2b, 0x2b, 0x2b, 0x2b,
-    0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x01, 0x2b, 0x2b, 0x00, 0x2b, 0x2b, 0x2b,
-    0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x01, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x00,
-    0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b,
-    0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x03,
-    0x00, 0x00, 0x00, 0x14, 0x00, 0x03, 0x00, 0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x04, 0x06, 0x70,
-    0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x0d,
-    0x00, 0x7e, 0x00, 0xa0, 0x00, 0xac, 0x00, 0xad, 0x00, 0xbf, 0x00, 0xc6, 0x00, 0xcf, 0x00, 0xe6,
-    0x00, 0xef, 0x00, 0xfe, 0x01, 0x0f, 0x01, 0x11, 0x01, 0x25, 0x01, 0x27, 0x01, 0x30, 0x01, 0x38,
-    0x01, 0x40, 0x01, 0x53, 0x01, 0x5f, 0x01, 0x67, 0x01, 0x7e, 0x01, 0x7f, 0x01, 0x8f, 0x01, 0x92,
-    0x01, 0xa1, 0x01, 0xb0, 0x01, 0xf0, 0x01, 0xfb, 0x01, 0xff, 0x02, 0x1b, 0x02, 0x37, 0x02, 0x59,
-    0x02, 0xbc, 0x02, 0xc7, 0x02, 0xc9, 0x02, 0xdd, 0x02, 0xf3, 0x03, 0x01, 0x03, 0x03, 0x03, 0x09,
-    0x03, 0x0f, 0x03, 0x23, 0x03, 0x8a, 0x03, 0x8c, 0x03, 0x92, 0x03, 0xa1, 0x03, 0xb0, 0x03, 0xb9,
-    0x03, 0xc9, 0x03, 0xce, 0x03, 0xd2, 0x03, 0xd6, 0x04, 0x25, 0x04, 0x2f, 0x04, 0x45, 0x04, 0x4f,
-    0x04, 0x62, 0x04, 0x6f, 0x04, 0x79, 0x04, 0x86, 0x04, 0x8b, 0x04, 0x9f, 0x04, 0xa9, 0x04, 0xb1,
-    0x04, 0xba, 0x04, 0xc2, 0x04, 0xca, 0x04, 0xce, 0x04, 0xd7, 0x04, 0xe1, 0x04, 0xf5, 0x05, 0x01,
-    0x05, 0x10, 0x05, 0x13, 0x1e, 0x01, 0x1e, 0x3f, 0x1e, 0x85, 0x1e, 0xf1, 0x1e, 0xf3, 0x1e, 0xf9,
-    0x1f, 0x4d, 0x20, 0x09, 0x20, 0x0b, 0x20, 0x11, 0x20, 0x15, 0x20, 0x1e, 0x20, 0x22, 0x20, 0x27,
-    0x20, 0x30, 0x20, 0x33, 0x20, 0x3a, 0x20, 0x3c, 0x20, 0x44, 0x20, 0x70, 0x20, 0x8e, 0x20, 0xa4,
-    0x20, 0xaa, 0x20, 0xac, 0x20, 0xb1, 0x20, 0xba, 0x20, 0xbd, 0x21, 0x05, 0x21, 0x13, 0x21, 0x16,
-    0x21, 0x22, 0x21, 0x26, 0x21, 0x2e, 0x21, 0x5e, 0x22, 0x02, 0x22, 0x06, 0x22, 0x0f, 0x22, 0x12,
-    0x22, 0x1a, 0x22, 0x1e, 0x22, 0x2b, 0x22, 0x48, 0x22, 0x60, 0x22, 0x65, 0x25, 0xca, 0xee, 0x02,
-    0xf6, 0xc3, 0xfb, 0x04, 0xfe, 0xff, 0xff, 0xfd, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0x00, 0x0d, 0x00, 0x20, 0x00, 0xa0, 0x00, 0xa1, 0x00, 0xad, 0x00, 0xae, 0x00, 0xc0, 0x00, 0xc7,
-    0x00, 0xd0, 0x00, 0xe7, 0x00, 0xf0, 0x00, 0xff, 0x01, 0x10, 0x01, 0x12, 0x01, 0x26, 0x01, 0x28,
-    0x01, 0x31, 0x01, 0x39, 0x01, 0x41, 0x01, 0x54, 0x01, 0x60, 0x01, 0x68, 0x01, 0x7f, 0x01, 0x8f,
-    0x01, 0x92, 0x01, 0xa0, 0x01, 0xaf, 0x01, 0xf0, 0x01, 0xfa, 0x01, 0xfc, 0x02, 0x18, 0x02, 0x37,
-    0x02, 0x59, 0x02, 0xbc, 0x02, 0xc6, 0x02, 0xc9, 0x02, 0xd8, 0x02, 0xf3, 0x03, 0x00, 0x03, 0x03,
-    0x03, 0x09, 0x03, 0x0f, 0x03, 0x23, 0x03, 0x84, 0x03, 0x8c, 0x03, 0x8e, 0x03, 0x93, 0x03, 0xa3,
-    0x03, 0xb1, 0x03, 0xba, 0x03, 0xca, 0x03, 0xd1, 0x03, 0xd6, 0x04, 0x00, 0x04, 0x26, 0x04, 0x30,
-    0x04, 0x46, 0x04, 0x50, 0x04, 0x63, 0x04, 0x70, 0x04, 0x7a, 0x04, 0x88, 0x04, 0x8c, 0x04, 0xa0,
-    0x04, 0xaa, 0x04, 0xb2, 0x04, 0xbb, 0x04, 0xc3, 0x04, 0xcb, 0x04, 0xcf, 0x04, 0xd8, 0x04, 0xe2,
-    0x04, 0xf6, 0x05, 0x02, 0x05, 0x11, 0x1e, 0x00, 0x1e, 0x3e, 0x1e, 0x80, 0x1e, 0xa0, 0x1e, 0xf2,
-    0x1e, 0xf4, 0x1f, 0x4d, 0x20, 0x00, 0x20, 0x0a, 0x20, 0x10, 0x20, 0x13, 0x20, 0x17, 0x20, 0x20,
-    0x20, 0x25, 0x20, 0x30, 0x20, 0x32, 0x20, 0x39, 0x20, 0x3c, 0x20, 0x44, 0x20, 0x70, 0x20, 0x74,
-    0x20, 0xa3, 0x20, 0xa6, 0x20, 0xab, 0x20, 0xb1, 0x20, 0xb9, 0x20, 0xbc, 0x21, 0x05, 0x21, 0x13,
-    0x21, 0x16, 0x21, 0x22, 0x21, 0x26, 0x21, 0x2e, 0x21, 0x5b, 0x22, 0x02, 0x22, 0x06, 0x22, 0x0f,
-    0x22, 0x11, 0x22, 0x1a, 0x22, 0x1e, 0x22, 0x2b, 0x22, 0x48, 0x22, 0x60, 0x22, 0x64, 0x25, 0xca,
-    0xee, 0x01, 0xf6, 0xc3, 0xfb, 0x01, 0xfe, 0xff, 0xff, 0xfc, 0xff, 0xff, 0x00, 0x01, 0x00, 0x00,
-    0xff, 0xf6, 0xff, 0xe4, 0x01, 0xf3, 0xff, 0xc2, 0x01, 0xe7, 0xff, 0xc1, 0x00, 0x00, 0x01, 0xda,
-    0x00, 0x00, 0x01, 0xd5, 0x00, 0x00, 0x01, 0xd1, 0x00, 0x00, 0x01, 0xcf, 0x00, 0x00, 0x01, 0xcd,
-    0x00, 0x00, 0x01, 0xcb, 0x00, 0x00, 0x01, 0xc5, 0x00, 0x00, 0x01, 0xc7, 0xff, 0x16, 0xff, 0x07,
-    0xff, 0x05, 0xfe, 0xf8, 0xfe, 0xeb, 0x02, 0x09, 0x00, 0x00, 0x01, 0x4a, 0x00, 0x00, 0xfe, 0x65,
-    0xfe, 0x44, 0x01, 0x3e, 0xfd, 0xd8, 0xfd, 0xd7, 0xfd, 0xc9, 0xfd, 0xb4, 0xfd, 0xa8, 0xfd, 0xa7,
-    0xfd, 0xa2, 0xfd, 0x9d, 0xfd, 0x8a, 0x00, 0x00, 0x00, 0x19, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00,
-    0xfd, 0x0a, 0x00, 0x00, 0xff, 0xf9, 0xfc, 0xfe, 0xfc, 0xfb, 0x00, 0x00, 0xfc, 0xba, 0x00, 0x00,
-    0xfc, 0xb2, 0x00, 0x00, 0xfc, 0xa7, 0x00, 0x00, 0xfc, 0xa1, 0xfc, 0xa0, 0x00, 0x00, 0xfc, 0x99,
-    0x00, 0x00, 0xfc, 0x91, 0x00, 0x00, 0xfc, 0x8b, 0x00, 0x00, 0xff, 0x43, 0x00, 0x00, 0xff, 0x40,
-    0x00, 0x00, 0xfc, 0x5e, 0x00, 0x00, 0xe5, 0xfd, 0xe5, 0xbd, 0xe5, 0x6e, 0xe5, 0x99, 0xe5, 0x02,
-    0xe5, 0x97, 0xe5, 0x98, 0xe1, 0x72, 0xe1, 0x73, 0xe1, 0x6f, 0x00, 0x00, 0xe1, 0x6c, 0xe1, 0x6b,
-    0xe1, 0x69, 0xe1, 0x61, 0xe3, 0xc4, 0xe1, 0x59, 0xe3, 0xbc, 0xe1, 0x50, 0xe1, 0x25, 0xe1, 0x22,
-    0x00, 0x00, 0xe1, 0x0c, 0x00, 0x00, 0xe1, 0x07, 0xe1, 0x00, 0xe0, 0xff, 0xe0, 0xb8, 0xe0, 0xab,
-    0xe0, 0xa9, 0xe0, 0x9e, 0xdf, 0x94, 0xe0, 0x93, 0xe0, 0x67, 0xdf, 0xc4, 0xde, 0xac, 0xdf, 0xb8,
-    0xdf, 0xb7, 0xdf, 0xb0, 0xdf, 0xad, 0xdf, 0xa1, 0xdf, 0x85, 0xdf, 0x6e, 0xdf, 0x6b, 0xdc, 0x07,
-    0x13, 0xd1, 0x0b, 0x11, 0x06, 0xd5, 0x02, 0xdd, 0x01, 0xe1, 0x00, 0x01, 0x00, 0x00, 0x00, 0xfe,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf2, 0x00, 0x00,
-    0x00, 0xfc, 0x00, 0x00, 0x01, 0x26, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00,
-    0x01, 0x40, 0x00, 0x00, 0x01, 0x4c, 0x00, 0x00, 0x01, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x6e, 0x00, 0x00, 0x01, 0x6e, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x5c, 0x00, 0x00, 0x00, 0x00, 0x01, 0x64, 0x01, 0x80,
-    0x00, 0x00, 0x01, 0x98, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xb0, 0x00, 0x00, 0x01, 0xf8,
-    0x00, 0x00, 0x02, 0x20, 0x00, 0x00, 0x02, 0x42, 0x00, 0x00, 0x00, 0x00, 0x02, 0x50, 0x00, 0x00,
-    0x02, 0x74, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0x02, 0x8c, 0x00, 0x00, 0x02, 0x90, 0x00, 0x00,
-    0x02, 0xa0, 0x00, 0x00, 0x02, 0xb4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xa4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0x94, 0x00, 0x00, 0x02, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x9a,
-    0x02, 0x9b, 0x02, 0x9c, 0x02, 0x9d, 0x02, 0x9e, 0x02, 0x9f, 0x00, 0x81, 0x02, 0x96, 0x02, 0xaa,
-    0x02, 0xab, 0x02, 0xac, 0x02, 0xad, 0x02, 0xae, 0x02, 0xaf, 0x00, 0x82, 0x00, 0x83, 0x02, 0xb0,
-    0x02, 0xb1, 0x02, 0xb2, 0x02, 0xb3, 0x02, 0xb4, 0x00, 0x84, 0x00, 0x85, 0x02, 0xb5, 0x02, 0xb6,
-    0x02, 0xb7, 0x02, 0xb8, 0x02, 0xb9, 0x02, 0xba, 0x00, 0x86, 0x00, 0x87, 0x02, 0xc5, 0x02, 0xc6,
-    0x02, 0xc7, 0x02, 0xc8, 0x02, 0xc9, 0x02, 0xca, 0x00, 0x88, 0x00, 0x89, 0x02, 0xcb, 0x02, 0xcc,
-    0x02, 0xcd, 0x02, 0xce, 0x02, 0xcf, 0x00, 0x8a, 0x02, 0x95, 0x00, 0x8b, 0x00, 0x8c, 0x02, 0x97,
-    0x00, 0x8d, 0x02, 0xfe, 0x02, 0xff, 0x03, 0x00, 0x03, 0x01, 0x03, 0x02, 0x03, 0x03, 0x00, 0x8e,
-    0x00, 0x8f, 0x00, 0x90, 0x03, 0x0c, 0x03, 0x0d, 0x03, 0x0e, 0x03, 0x0f, 0x03, 0x10, 0x03, 0x11,
-    0x03, 0x12, 0x00, 0x91, 0x00, 0x92, 0x03, 0x13, 0x03, 0x14, 0x03, 0x15, 0x03, 0x16, 0x03, 0x17,
-    0x03, 0x18, 0x00, 0x93, 0x00, 0x94, 0x03, 0x27, 0x03, 0x28, 0x03, 0x2b, 0x03, 0x2c, 0x03, 0x2d,
-    0x03, 0x2e, 0x02, 0x98, 0x02, 0x99, 0x02, 0xa0, 0x02, 0xbb, 0x03, 0x25, 0x03, 0x26, 0x03, 0x29,
-    0x03, 0x2a, 0x00, 0xae, 0x00, 0xaf, 0x03, 0xa1, 0x00, 0xb0, 0x03, 0xa2, 0x03, 0xa3, 0x03, 0xa4,
-    0x00, 0xb1, 0x00, 0xb2, 0x03, 0xab, 0x03, 0xac, 0x03, 0xad, 0x00, 0xb3, 0x03, 0xae, 0x03, 0xaf,
-    0x00, 0xb4, 0x03, 0xb0, 0x03, 0xb1, 0x00, 0xb5, 0x03, 0xb2, 0x00, 0xb6, 0x03, 0xb3, 0x00, 0xb7,
-    0x03, 0xb4, 0x03, 0xb5, 0x00, 0xb8, 0x03, 0xb6, 0x00, 0xb9, 0x00, 0xba, 0x03, 0xb7, 0x03, 0xb8,
-    0x03, 0xb9, 0x03, 0xba, 0x03, 0xbb, 0x03, 0xbc, 0x03, 0xbd, 0x03, 0xbe, 0x00, 0xc4, 0x03, 0xc0,
-    0x03, 0xc1, 0x00, 0xc5, 0x03, 0xbf, 0x00, 0xc6, 0x00, 0xc7, 0x00, 0xc8, 0x00, 0xc9, 0x00, 0xca,
-    0x00, 0xcb, 0x00, 0xcc, 0x03, 0xc2, 0x00, 0xcd, 0x00, 0xce, 0x03, 0xff, 0x03, 0xc8, 0x00, 0xd2,
-    0x03, 0xc9, 0x00, 0xd3, 0x03, 0xca, 0x03, 0xcb, 0x03, 0xcc, 0x03, 0xcd, 0x00, 0xd4, 0x00, 0xd5,
-    0x00, 0xd6, 0x03, 0xcf, 0x04, 0x00, 0x03, 0xd0, 0x00, 0xd7, 0x03, 0xd1, 0x00, 0xd8, 0x03, 0xd2,
-    0x03, 0xd3, 0x00, 0xd9, 0x03, 0xd4, 0x00, 0xda, 0x00, 0xdb, 0x00, 0xdc, 0x03, 0xd5, 0x03, 0xce,
-    0x00, 0xdd, 0x03, 0xd6, 0x03, 0xd7, 0x03, 0xd8, 0x03, 0xd9, 0x03, 0xda, 0x03, 0xdb, 0x03, 0xdc,
-    0x00, 0xde, 0x00, 0xdf, 0x03, 0xdd, 0x03, 0xde, 0x00, 0xea, 0x00, 0xeb, 0x00, 0xec, 0x00, 0xed,
-    0x03, 0xdf, 0x00, 0xee, 0x00, 0xef, 0x00, 0xf0, 0x03, 0xe0, 0x00, 0xf1, 0x00, 0xf2, 0x00, 0xf3,
-    0x00, 0xf4, 0x03, 0xe1, 0x00, 0xf5, 0x03, 0xe2, 0x03, 0xe3, 0x00, 0xf6, 0x03, 0xe4, 0x00, 0xf7,
-    0x03, 0xe5, 0x04, 0x01, 0x03, 0xe6, 0x01, 0x02, 0x03, 0xe7, 0x01, 0x03, 0x03, 0xe8, 0x03, 0xe9,
-    0x03, 0xea, 0x03, 0xeb, 0x01, 0x04, 0x01, 0x05, 0x01, 0x06, 0x03, 0xec, 0x04, 0x02, 0x03, 0xed,
-    0x01, 0x07, 0x01, 0x08, 0x01, 0x09, 0x04, 0x9c, 0x04, 0x03, 0x04, 0x04, 0x01, 0x17, 0x01, 0x18,
-    0x01, 0x19, 0x01, 0x1a, 0x04, 0x05, 0x04, 0x06, 0x04, 0x08, 0x04, 0x07, 0x04, 0x9b, 0x01, 0x2c,
-    0x01, 0x2d, 0x01, 0x2e, 0x01, 0x2f, 0x01, 0x30, 0x04, 0x9d, 0x04, 0x9e, 0x01, 0x31, 0x01, 0x32,
-    0x01, 0x33, 0x01, 0x34, 0x04, 0x09, 0x04, 0x0a, 0x01, 0x35, 0x01, 0x36, 0x01, 0x37, 0x01, 0x38,
-    0x04, 0x9f, 0x04, 0xa0, 0x04, 0x0b, 0x04, 0x0c, 0x04, 0x92, 0x04, 0x93, 0x04, 0x0d, 0x04, 0x0e,
-    0x04, 0xa1, 0x04, 0xa2, 0x04, 0x9a, 0x01, 0x4c, 0x01, 0x4d, 0x04, 0x98, 0x04, 0x99, 0x04, 0x0f,
-    0x04, 0x10, 0x04, 0x11, 0x04, 0x94, 0x04, 0x95, 0x01, 0x56, 0x01, 0x57, 0x01, 0x58, 0x04, 0x1c,
-    0x04, 0x1b, 0x04, 0x1d, 0x04, 0x1e, 0x04, 0x1f, 0x04, 0x20, 0x04, 0x21, 0x01, 0x59, 0x01, 0x5a,
-    0x04, 0x96, 0x04, 0x97, 0x04, 0x36, 0x04, 0x37, 0x01, 0x5b, 0x01, 0x5c, 0x01, 0x5d, 0x01, 0x5e,
-    0x04, 0xa3, 0x04, 0xa4, 0x01, 0x5f, 0x04, 0x38, 0x04, 0xa5, 0x01, 0x6f, 0x01, 0x70, 0x01, 0x81,
-    0x01, 0x82, 0x04, 0xa7, 0x04, 0xa6, 0x01, 0xb1, 0x04, 0x91, 0x01, 0xb7, 0x00, 0x00, 0x00, 0x3b,
-    0x02, 0xca, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x00, 0x00, 0xb2, 0x06, 0xc6, 0x00, 0x03,
-    0x00, 0x01, 0x04, 0x09, 0x00, 0x01, 0x00, 0x1a, 0x06, 0xac, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
-    0x00, 0x02, 0x00, 0x0e, 0x06, 0x9e, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x03, 0x00, 0x30,
-    0x06, 0x6e, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x04, 0x00, 0x1a, 0x06, 0xac, 0x00, 0x03,
-    0x00, 0x01, 0x04, 0x09, 0x00, 0x05, 0x00, 0x26, 0x06, 0x48, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
-    0x00, 0x06, 0x00, 0x1a, 0x06, 0x2e, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x07, 0x00, 0x40,
-    0x05, 0xee, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x08, 0x00, 0x0c, 0x05, 0xe2, 0x00, 0x03,
-    0x00, 0x01, 0x04, 0x09, 0x00, 0x09, 0x00, 0x26, 0x05, 0xbc, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
-    0x00, 0x0b, 0x00, 0x14, 0x05, 0xa8, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x0c, 0x00, 0x14,
-    0x05, 0xa8, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x0d, 0x01, 0x22, 0x04, 0x86, 0x00, 0x03,
-    0x00, 0x01, 0x04, 0x09, 0x00, 0x0e, 0x00, 0x36, 0x04, 0x50, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
-    0x00, 0x10, 0x00, 0x0c, 0x04, 0x44, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x11, 0x00, 0x0c,
-    0x04, 0x38, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x19, 0x00, 0x0c, 0x04, 0x44, 0x00, 0x03,
-    0x00, 0x01, 0x04, 0x09, 0x01, 0x00, 0x00, 0x0c, 0x04, 0x2c, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
-    0x01, 0x01, 0x00, 0x0a, 0x04, 0x22, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x01, 0x02, 0x00, 0x0c,
-    0x04, 0x16, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x01, 0x03, 0x00, 0x08, 0x04, 0x0e, 0x00, 0x03,
-    0x00, 0x01, 0x04, 0x09, 0x01, 0x04, 0x00, 0x14, 0x03, 0xfa, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
-    0x01, 0x05, 0x00, 0x0a, 0x03, 0xf0, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x01, 0x06, 0x00, 0x0e,
-    0x06, 0x9e, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x01, 0x07, 0x00, 0x0c, 0x04, 0x38, 0x00, 0x03,
-    0x00, 0x01, 0x04, 0x09, 0x01, 0x08, 0x00, 0x10, 0x03, 0xe0, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
-    0x01, 0x09, 0x00, 0x08, 0x03, 0xd8, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x01, 0x0a, 0x00, 0x12,
-    0x03, 0xc6, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x01, 0x0b, 0x00, 0x0a, 0x03, 0xbc, 0x00, 0x03,
-    0x00, 0x01, 0x04, 0x09, 0x01, 0x14, 0x00, 0x1c, 0x03, 0xa0, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
-    0x01, 0x15, 0x00, 0x28, 0x03, 0x78, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x01, 0x16, 0x00, 0x1e,
-    0x03, 0x5a, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x01, 0x17, 0x00, 0x22, 0x03, 0x38, 0x00, 0x03,
-    0x00, 0x01, 0x04, 0x09, 0x01, 0x18, 0x00, 0x20, 0x03, 0x18, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
-    0x01, 0x19, 0x00, 0x24, 0x02, 0xf4, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x01, 0x1a, 0x00, 0x1c,
-    0x02, 0xd8, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x01, 0x1b, 0x00, 0x26, 0x02, 0xb2, 0x00, 0x03,
-    0x00, 0x01, 0x04, 0x09, 0x01, 0x1c, 0x00, 0x1e, 0x02, 0x94, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
-    0x01, 0x26, 0x00, 0x12, 0x02, 0x82, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x01, 0x27, 0x00, 0x0c,
-    0x02, 0x76, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x01, 0x28, 0x00, 0x0a, 0x02, 0x6c, 0x00, 0x03,
-    0x00, 0x01, 0x04, 0x09, 0x01, 0x29, 0x00, 0x16, 0x02, 0x56, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
-    0x01, 0x2a, 0x00, 0x22, 0x02, 0x34, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x01, 0x2b, 0x00, 0x18,
-    0x02, 0x1c, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x01, 0x2c, 0x00, 0x1c, 0x02, 0x00, 0x00, 0x03,
-    0x00, 0x01, 0x04, 0x09, 0x01, 0x2d, 0x00, 0x1a, 0x06, 0x2e, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
-    0x01, 0x2e, 0x00, 0x1e, 0x01, 0xe2, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x01, 0x2f, 0x00, 0x16,
-    0x01, 0xcc, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x01, 0x30, 0x00, 0x20, 0x01, 0xac, 0x00, 0x03,
-    0x00, 0x01, 0x04, 0x09, 0x01, 0x31, 0x00, 0x18, 0x01, 0x94, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
-    0x01, 0x3b, 0x00, 0x28, 0x01, 0x6c, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x01, 0x3c, 0x00, 0x34,
-    0x01, 0x38, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x01, 0x3d, 0x00, 0x2a, 0x01, 0x0e, 0x00, 0x03,
-    0x00, 0x01, 0x04, 0x09, 0x01, 0x3e, 0x00, 0x2e, 0x00, 0xe0, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
-    0x01, 0x3f, 0x00, 0x2c, 0x00, 0xb4, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x01, 0x40, 0x00, 0x30,
-    0x00, 0x84, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x01, 0x41, 0x00, 0x28, 0x00, 0x5c, 0x00, 0x03,
-    0x00, 0x01, 0x04, 0x09, 0x01, 0x42, 0x00, 0x32, 0x00, 0x2a, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
-    0x01, 0x43, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x52, 0x00, 0x6f, 0x00, 0x62, 0x00, 0x6f, 0x00, 0x74,
-    0x00, 0x6f, 0x00, 0x2d, 0x00, 0x43, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x64, 0x00, 0x65, 0x00, 0x6e,
-    0x00, 0x73, 0x00, 0x65, 0x00, 0x64, 0x00, 0x42, 0x00, 0x6c, 0x00, 0x61, 0x00, 0x63, 0x00, 0x6b,
-    0x00, 0x52, 0x00, 0x6f, 0x00, 0x62, 0x00, 0x6f, 0x00, 0x74, 0x00, 0x6f, 0x00, 0x2d, 0x00, 0x43,
-    0x00, 0x6f, 0x00, 0x6e, 0x00, 0x64, 0x00, 0x65, 0x00, 0x6e, 0x00, 0x73, 0x00, 0x65, 0x00, 0x64,
-    0x00, 0x45, 0x00, 0x78, 0x00, 0x74, 0x00, 0x72, 0x00, 0x61, 0x00, 0x42, 0x00, 0x6f, 0x00, 0x6c,
-    0x00, 0x64, 0x00, 0x52, 0x00, 0x6f, 0x00, 0x62, 0x00, 0x6f, 0x00, 0x74, 0x00, 0x6f, 0x00, 0x2d,
-    0x00, 0x43, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x64, 0x00, 0x65, 0x00, 0x6e, 0x00, 0x73, 0x00, 0x65,
-    0x00, 0x64, 0x00, 0x42, 0x00, 0x6f, 0x00, 0x6c, 0x00, 0x64, 0x00, 0x52, 0x00, 0x6f, 0x00, 0x62,
-    0x00, 0x6f, 0x00, 0x74, 0x00, 0x6f, 0x00, 0x2d, 0x00, 0x43, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x64,
-    0x00, 0x65, 0x00, 0x6e, 0x00, 0x73, 0x00, 0x65, 0x00, 0x64, 0x00, 0x53, 0x00, 0x65, 0x00, 0x6d,
-    0x00, 0x69, 0x00, 0x42, 0x00, 0x6f, 0x00, 0x6c, 0x00, 0x64, 0x00, 0x52, 0x00, 0x6f, 0x00, 0x62,
-    0x00, 0x6f, 0x00, 0x74, 0x00, 0x6f, 0x00, 0x2d, 0x00, 0x43, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x64,
-    0x00, 0x65, 0x00, 0x6e, 0x00, 0x73, 0x00, 0x65, 0x00, 0x64, 0x00, 0x4d, 0x00, 0x65, 0x00, 0x64,
-    0x00, 0x69, 0x00, 0x75, 0x00, 0x6d, 0x00, 0x52, 0x00, 0x6f, 0x00, 0x62, 0x00, 0x6f, 0x00, 0x74,
-    0x00, 0x6f, 0x00, 0x2d, 0x00, 0x43, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x64, 0x00, 0x65, 0x00, 0x6e,
-    0x00, 0x73, 0x00, 0x65, 0x00, 0x64, 0x00, 0x52, 0x00, 0x65, 0x00, 0x67, 0x00, 0x75, 0x00, 0x6c,
-    0x00, 0x61, 0x00, 0x72, 0x00, 0x52, 0x00, 0x6f, 0x00, 0x62, 0x00, 0x6f, 0x00, 0x74, 0x00, 0x6f,
-    0x00, 0x2d, 0x00, 0x43, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x64, 0x00, 0x65, 0x00, 0x6e, 0x00, 0x73,
-    0x00, 0x65, 0x00, 0x64, 0x00, 0x4c, 0x00, 0x69, 0x00, 0x67, 0x00, 0x68, 0x00, 0x74, 0x00, 0x52,
-    0x00, 0x6f, 0x00, 0x62, 0x00, 0x6f, 0x00, 0x74, 0x00, 0x6f, 0x00, 0x2d, 0x00, 0x43, 0x00, 0x6f,
-    0x00, 0x6e, 0x00, 0x64, 0x00, 0x65, 0x00, 0x6e, 0x00, 0x73, 0x00, 0x65, 0x00, 0x64, 0x00, 0x45,
-    0x00, 0x78, 0x00, 0x74, 0x00, 0x72, 0x00, 0x61, 0x00, 0x4c, 0x00, 0x69, 0x00, 0x67, 0x00, 0x68,
-    0x00, 0x74, 0x00, 0x52, 0x00, 0x6f, 0x00, 0x62, 0x00, 0x6f, 0x00, 0x74, 0x00, 0x6f, 0x00, 0x2d,
-    0x00, 0x43, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x64, 0x00, 0x65, 0x00, 0x6e, 0x00, 0x73, 0x00, 0x65,
-    0x00, 0x64, 0x00, 0x54, 0x00, 0x68, 0x00, 0x69, 0x00, 0x6e, 0x00, 0x52, 0x00, 0x6f, 0x00, 0x62,
-    0x00, 0x6f, 0x00, 0x74, 0x00, 0x6f, 0x00, 0x2d, 0x00, 0x42, 0x00, 0x6c, 0x00, 0x61, 0x00, 0x63,
-    0x00, 0x6b, 0x00, 0x52, 0x00, 0x6f, 0x00, 0x62, 0x00, 0x6f, 0x00, 0x74, 0x00, 0x6f, 0x00, 0x2d,
-    0x00, 0x45, 0x00, 0x78, 0x00, 0x74, 0x00, 0x72, 0x00, 0x61, 0x00, 0x42, 0x00, 0x6f, 0x00, 0x6c,
-    0x00, 0x64, 0x00, 0x52, 0x00, 0x6f, 0x00, 0x62, 0x00, 0x6f, 0x00, 0x74, 0x00, 0x6f, 0x00, 0x2d,
-    0x00, 0x42, 0x00, 0x6f, 0x00, 0x6c, 0x00, 0x64, 0x00, 0x52, 0x00, 0x6f, 0x00, 0x62, 0x00, 0x6f,
-    0x00, 0x74, 0x00, 0x6f, 0x00, 0x2d, 0x00, 0x53, 0x00, 0x65, 0x00, 0x6d, 0x00, 0x69, 0x00, 0x42,
-    0x00, 0x6f, 0x00, 0x6c, 0x00, 0x64, 0x00, 0x52, 0x00, 0x6f, 0x00, 0x62, 0x00, 0x6f, 0x00, 0x74,
-    0x00, 0x6f, 0x00, 0x2d, 0x00, 0x52, 0x00, 0x65, 0x00, 0x67, 0x00, 0x75, 0x00, 0x6c, 0x00, 0x61,
-    0x00, 0x72, 0x00, 0x52, 0x00, 0x6f, 0x00, 0x62, 0x00, 0x6f, 0x00, 0x74, 0x00, 0x6f, 0x00, 0x2d,
-    0x00, 0x4c, 0x00, 0x69, 0x00, 0x67, 0x00, 0x68, 0x00, 0x74, 0x00, 0x52, 0x00, 0x6f, 0x00, 0x62,
-    0x00, 0x6f, 0x00, 0x74, 0x00, 0x6f, 0x00, 0x2d, 0x00, 0x45, 0x00, 0x78, 0x00, 0x74, 0x00, 0x72,
-    0x00, 0x61, 0x00, 0x4c, 0x00, 0x69, 0x00, 0x67, 0x00, 0x68, 0x00, 0x74, 0x00, 0x52, 0x00, 0x6f,
-    0x00, 0x62, 0x00, 0x6f, 0x00, 0x74, 0x00, 0x6f, 0x00, 0x2d, 0x00, 0x54, 0x00, 0x68, 0x00, 0x69,
-    0x00, 0x6e, 0x00, 0x52, 0x00, 0x6f, 0x00, 0x6d, 0x00, 0x61, 0x00, 0x6e, 0x00, 0x4e, 0x00, 0x6f,
-    0x00, 0x72, 0x00, 0x6d, 0x00, 0x61, 0x00, 0x6c, 0x00, 0x43, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x64,
-    0x00, 0x65, 0x00, 0x6e, 0x00, 0x73, 0x00, 0x65, 0x00, 0x64, 0x00, 0x43, 0x00, 0x6f, 0x00, 0x6e,
-    0x00, 0x64, 0x00, 0x65, 0x00, 0x6e, 0x00, 0x73, 0x00, 0x65, 0x00, 0x64, 0x00, 0x20, 0x00, 0x42,
-    0x00, 0x6c, 0x00, 0x61, 0x00, 0x63, 0x00, 0x6b, 0x00, 0x43, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x64,
-    0x00, 0x65, 0x00, 0x6e, 0x00, 0x73, 0x00, 0x65, 0x00, 0x64, 0x00, 0x20, 0x00, 0x45, 0x00, 0x78,
-    0x00, 0x74, 0x00, 0x72, 0x00, 0x61, 0x00, 0x42, 0x00, 0x6f, 0x00, 0x6c, 0x00, 0x64, 0x00, 0x43,
-    0x00, 0x6f, 0x00, 0x6e, 0x00, 0x64, 0x00, 0x65, 0x00, 0x6e, 0x00, 0x73, 0x00, 0x65, 0x00, 0x64,
-    0x00, 0x20, 0x00, 0x42, 0x00, 0x6f, 0x00, 0x6c, 0x00, 0x64, 0x00, 0x43, 0x00, 0x6f, 0x00, 0x6e,
-    0x00, 0x64, 0x00, 0x65, 0x00, 0x6e, 0x00, 0x73, 0x00, 0x65, 0x00, 0x64, 0x00, 0x20, 0x00, 0x53,
-    0x00, 0x65, 0x00, 0x6d, 0x00, 0x69, 0x00, 0x42, 0x00, 0x6f, 0x00, 0x6c, 0x00, 0x64, 0x00, 0x43,
-    0x00, 0x6f, 0x00, 0x6e, 0x00, 0x64, 0x00, 0x65, 0x00, 0x6e, 0x00, 0x73, 0x00, 0x65, 0x00, 0x64,
-    0x00, 0x20, 0x00, 0x4d, 0x00, 0x65, 0x00, 0x64, 0x00, 0x69, 0x00, 0x75, 0x00, 0x6d, 0x00, 0x43,
-    0x00, 0x6f, 0x00, 0x6e, 0x00, 0x64, 0x00, 0x65, 0x00, 0x6e, 0x00, 0x73, 0x00, 0x65, 0x00, 0x64,
-    0x00, 0x20, 0x00, 0x52, 0x00, 0x65, 0x00, 0x67, 0x00, 0x75, 0x00, 0x6c, 0x00, 0x61, 0x00, 0x72,
-    0x00, 0x43, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x64, 0x00, 0x65, 0x00, 0x6e, 0x00, 0x73, 0x00, 0x65,
-    0x00, 0x64, 0x00, 0x20, 0x00, 0x4c, 0x00, 0x69, 0x00, 0x67, 0x00, 0x68, 0x00, 0x74, 0x00, 0x43,
-    0x00, 0x6f, 0x00, 0x6e, 0x00, 0x64, 0x00, 0x65, 0x00, 0x6e, 0x00, 0x73, 0x00, 0x65, 0x00, 0x64,
-    0x00, 0x20, 0x00, 0x45, 0x00, 0x78, 0x00, 0x74, 0x00, 0x72, 0x00, 0x61, 0x00, 0x4c, 0x00, 0x69,
-    0x00, 0x67, 0x00, 0x68, 0x00, 0x74, 0x00, 0x43, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x64, 0x00, 0x65,
-    0x00, 0x6e, 0x00, 0x73, 0x00, 0x65, 0x00, 0x64, 0x00, 0x20, 0x00, 0x54, 0x00, 0x68, 0x00, 0x69,
-    0x00, 0x6e, 0x00, 0x42, 0x00, 0x6c, 0x00, 0x61, 0x00, 0x63, 0x00, 0x6b, 0x00, 0x45, 0x00, 0x78,
-    0x00, 0x74, 0x00, 0x72, 0x00, 0x61, 0x00, 0x42, 0x00, 0x6f, 0x00, 0x6c, 0x00, 0x64, 0x00, 0x42,
-    0x00, 0x6f, 0x00, 0x6c, 0x00, 0x64, 0x00, 0x53, 0x00, 0x65, 0x00, 0x6d, 0x00, 0x69, 0x00, 0x42,
-    0x00, 0x6f, 0x00, 0x6c, 0x00, 0x64, 0x00, 0x4c, 0x00, 0x69, 0x00, 0x67, 0x00, 0x68, 0x00, 0x74,
-    0x00, 0x45, 0x00, 0x78, 0x00, 0x74, 0x00, 0x72, 0x00, 0x61, 0x00, 0x4c, 0x00, 0x69, 0x00, 0x67,
-    0x00, 0x68, 0x00, 0x74, 0x00, 0x54, 0x00, 0x68, 0x00, 0x69, 0x00, 0x6e, 0x00, 0x49, 0x00, 0x74,
-    0x00, 0x61, 0x00, 0x6c, 0x00, 0x69, 0x00, 0x63, 0x00, 0x57, 0x00, 0x69, 0x00, 0x64, 0x00, 0x74,
-    0x00, 0x68, 0x00, 0x57, 0x00, 0x65, 0x00, 0x69, 0x00, 0x67, 0x00, 0x68, 0x00, 0x74, 0x00, 0x4d,
-    0x00, 0x65, 0x00, 0x64, 0x00, 0x69, 0x00, 0x75, 0x00, 0x6d, 0x00, 0x52, 0x00, 0x6f, 0x00, 0x62,
-    0x00, 0x6f, 0x00, 0x74, 0x00, 0x6f, 0x00, 0x68, 0x00, 0x74, 0x00, 0x74, 0x00, 0x70, 0x00, 0x73,
-    0x00, 0x3a, 0x00, 0x2f, 0x00, 0x2f, 0x00, 0x6f, 0x00, 0x70, 0x00, 0x65, 0x00, 0x6e, 0x00, 0x66,
-    0x00, 0x6f, 0x00, 0x6e, 0x00, 0x74, 0x00, 0x6c, 0x00, 0x69, 0x00, 0x63, 0x00, 0x65, 0x00, 0x6e,
-    0x00, 0x73, 0x00, 0x65, 0x00, 0x2e, 0x00, 0x6f, 0x00, 0x72, 0x00, 0x67, 0x00, 0x54, 0x00, 0x68,
-    0x00, 0x69, 0x00, 0x73, 0x00, 0x20, 0x00, 0x46, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x74, 0x00, 0x20,
-    0x00, 0x53, 0x00, 0x6f, 0x00, 0x66, 0x00, 0x74, 0x00, 0x77, 0x00, 0x61, 0x00, 0x72, 0x00, 0x65,
-    0x00, 0x20, 0x00, 0x69, 0x00, 0x73, 0x00, 0x20, 0x00, 0x6c, 0x00, 0x69, 0x00, 0x63, 0x00, 0x65,
-    0x00, 0x6e, 0x00, 0x73, 0x00, 0x65, 0x00, 0x64, 0x00, 0x20, 0x00, 0x75, 0x00, 0x6e, 0x00, 0x64,
-    0x00, 0x65, 0x00, 0x72, 0x00, 0x20, 0x00, 0x74, 0x00, 0x68, 0x00, 0x65, 0x00, 0x20, 0x00, 0x53,
-    0x00, 0x49, 0x00, 0x4c, 0x00, 0x20, 0x00, 0x4f, 0x00, 0x70, 0x00, 0x65, 0x00, 0x6e, 0x00, 0x20,
-    0x00, 0x46, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x74, 0x00, 0x20, 0x00, 0x4c, 0x00, 0x69, 0x00, 0x63,
-    0x00, 0x65, 0x00, 0x6e, 0x00, 0x73, 0x00, 0x65, 0x00, 0x2c, 0x00, 0x20, 0x00, 0x56, 0x00, 0x65,
-    0x00, 0x72, 0x00, 0x73, 0x00, 0x69, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x20, 0x00, 0x31, 0x00, 0x2e,
-    0x00, 0x31, 0x00, 0x2e, 0x00, 0x20, 0x00, 0x54, 0x00, 0x68, 0x00, 0x69, 0x00, 0x73, 0x00, 0x20,
-    0x00, 0x6c, 0x00, 0x69, 0x00, 0x63, 0x00, 0x65, 0x00, 0x6e, 0x00, 0x73, 0x00, 0x65, 0x00, 0x20,
-    0x00, 0x69, 0x00, 0x73, 0x00, 0x20, 0x00, 0x61, 0x00, 0x76, 0x00, 0x61, 0x00, 0x69, 0x00, 0x6c,
-    0x00, 0x61, 0x00, 0x62, 0x00, 0x6c, 0x00, 0x65, 0x00, 0x20, 0x00, 0x77, 0x00, 0x69, 0x00, 0x74,
-    0x00, 0x68, 0x00, 0x20, 0x00, 0x61, 0x00, 0x20, 0x00, 0x46, 0x00, 0x41, 0x00, 0x51, 0x00, 0x20,
-    0x00, 0x61, 0x00, 0x74, 0x00, 0x3a, 0x00, 0x20, 0x00, 0x68, 0x00, 0x74, 0x00, 0x74, 0x00, 0x70,
-    0x00, 0x73, 0x00, 0x3a, 0x00, 0x2f, 0x00, 0x2f, 0x00, 0x6f, 0x00, 0x70, 0x00, 0x65, 0x00, 0x6e,
-    0x00, 0x66, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x74, 0x00, 0x6c, 0x00, 0x69, 0x00, 0x63, 0x00, 0x65,
-    0x00, 0x6e, 0x00, 0x73, 0x00, 0x65, 0x00, 0x2e, 0x00, 0x6f, 0x00, 0x72, 0x00, 0x67, 0x00, 0x47,
-    0x00, 0x6f, 0x00, 0x6f, 0x00, 0x67, 0x00, 0x6c, 0x00, 0x65, 0x00, 0x2e, 0x00, 0x63, 0x00, 0x6f,
-    0x00, 0x6d, 0x00, 0x43, 0x00, 0x68, 0x00, 0x72, 0x00, 0x69, 0x00, 0x73, 0x00, 0x74, 0x00, 0x69,
-    0x00, 0x61, 0x00, 0x6e, 0x00, 0x20, 0x00, 0x52, 0x00, 0x6f, 0x00, 0x62, 0x00, 0x65, 0x00, 0x72,
-    0x00, 0x74, 0x00, 0x73, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x47, 0x00, 0x6f, 0x00, 0x6f, 0x00, 0x67,
-    0x00, 0x6c, 0x00, 0x65, 0x00, 0x52, 0x00, 0x6f, 0x00, 0x62, 0x00, 0x6f, 0x00, 0x74, 0x00, 0x6f,
-    0x00, 0x20, 0x00, 0x69, 0x00, 0x73, 0x00, 0x20, 0x00, 0x61, 0x00, 0x20, 0x00, 0x74, 0x00, 0x72,
-    0x00, 0x61, 0x00, 0x64, 0x00, 0x65, 0x00, 0x6d, 0x00, 0x61, 0x00, 0x72, 0x00, 0x6b, 0x00, 0x20,
-    0x00, 0x6f, 0x00, 0x66, 0x00, 0x20, 0x00, 0x47, 0x00, 0x6f, 0x00, 0x6f, 0x00, 0x67, 0x00, 0x6c,
-    0x00, 0x65, 0x00, 0x2e, 0x00, 0x52, 0x00, 0x6f, 0x00, 0x62, 0x00, 0x6f, 0x00, 0x74, 0x00, 0x6f,
-    0x00, 0x2d, 0x00, 0x4d, 0x00, 0x65, 0x00, 0x64, 0x00, 0x69, 0x00, 0x75, 0x00, 0x6d, 0x00, 0x56,
-    0x00, 0x65, 0x00, 0x72, 0x00, 0x73, 0x00, 0x69, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x20, 0x00, 0x33,
-    0x00, 0x2e, 0x00, 0x30, 0x00, 0x30, 0x00, 0x39, 0x00, 0x3b, 0x00, 0x20, 0x00, 0x32, 0x00, 0x30,
-    0x00, 0x32, 0x00, 0x34, 0x00, 0x33, 0x00, 0x2e, 0x00, 0x30, 0x00, 0x30, 0x00, 0x39, 0x00, 0x3b,
-    0x00, 0x47, 0x00, 0x4f, 0x00, 0x4f, 0x00, 0x47, 0x00, 0x3b, 0x00, 0x52, 0x00, 0x6f, 0x00, 0x62,
-    0x00, 0x6f, 0x00, 0x74, 0x00, 0x6f, 0x00, 0x2d, 0x00, 0x4d, 0x00, 0x65, 0x00, 0x64, 0x00, 0x69,
-    0x00, 0x75, 0x00, 0x6d, 0x00, 0x52, 0x00, 0x65, 0x00, 0x67, 0x00, 0x75, 0x00, 0x6c, 0x00, 0x61,
-    0x00, 0x72, 0x00, 0x52, 0x00, 0x6f, 0x00, 0x62, 0x00, 0x6f, 0x00, 0x74, 0x00, 0x6f, 0x00, 0x20,
-    0x00, 0x4d, 0x00, 0x65, 0x00, 0x64, 0x00, 0x69, 0x00, 0x75, 0x00, 0x6d, 0x00, 0x43, 0x00, 0x6f,
-    0x00, 0x70, 0x00, 0x79, 0x00, 0x72, 0x00, 0x69, 0x00, 0x67, 0x00, 0x68, 0x00, 0x74, 0x00, 0x20,
-    0x00, 0x32, 0x00, 0x30, 0x00, 0x31, 0x00, 0x31, 0x00, 0x20, 0x00, 0x54, 0x00, 0x68, 0x00, 0x65,
-    0x00, 0x20, 0x00, 0x52, 0x00, 0x6f, 0x00, 0x62, 0x00, 0x6f, 0x00, 0x74, 0x00, 0x6f, 0x00, 0x20,
-    0x00, 0x50, 0x00, 0x72, 0x00, 0x6f, 0x00, 0x6a, 0x00, 0x65, 0x00, 0x63, 0x00, 0x74, 0x00, 0x20,
-    0x00, 0x41, 0x00, 0x75, 0x00, 0x74, 0x00, 0x68, 0x00, 0x6f, 0x00, 0x72, 0x00, 0x73, 0x00, 0x20,
-    0x00, 0x28, 0x00, 0x68, 0x00, 0x74, 0x00, 0x74, 0x00, 0x70, 0x00, 0x73, 0x00, 0x3a, 0x00, 0x2f,
-    0x00, 0x2f, 0x00, 0x67, 0x00, 0x69, 0x00, 0x74, 0x00, 0x68, 0x00, 0x75, 0x00, 0x62, 0x00, 0x2e,
-    0x00, 0x63, 0x00, 0x6f, 0x00, 0x6d, 0x00, 0x2f, 0x00, 0x67, 0x00, 0x6f, 0x00, 0x6f, 0x00, 0x67,
-    0x00, 0x6c, 0x00, 0x65, 0x00, 0x66, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x74, 0x00, 0x73, 0x00, 0x2f,
-    0x00, 0x72, 0x00, 0x6f, 0x00, 0x62, 0x00, 0x6f, 0x00, 0x74, 0x00, 0x6f, 0x00, 0x2d, 0x00, 0x63,
-    0x00, 0x6c, 0x00, 0x61, 0x00, 0x73, 0x00, 0x73, 0x00, 0x69, 0x00, 0x63, 0x00, 0x29, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x32, 0x00, 0x32, 0x00, 0x32, 0x00, 0x32, 0x00, 0x32, 0x00, 0x5a, 0x00, 0x79,
-    0x00, 0xaf, 0x01, 0x24, 0x01, 0xa5, 0x02, 0x19, 0x02, 0x2e, 0x02, 0x5e, 0x02, 0x8e, 0x02, 0xbb,
-    0x02, 0xd8, 0x02, 0xf2, 0x03, 0x03, 0x03, 0x1e, 0x03, 0x32, 0x03, 0x7f, 0x03, 0x98, 0x03, 0xd7,
-    0x04, 0x3e, 0x04, 0x6a, 0x04, 0xb7, 0x05, 0x11, 0x05, 0x2e, 0x05, 0x9d, 0x05, 0xf7, 0x06, 0x03,
-    0x06, 0x0f, 0x06, 0x34, 0x06, 0x4f, 0x06, 0x74, 0x06, 0xc5, 0x07, 0x6f, 0x07, 0xa7, 0x08, 0x06,
-    0x08, 0x4a, 0x08, 0x88, 0x08, 0xb8, 0x08, 0xe1, 0x09, 0x30, 0x09, 0x58, 0x09, 0x6c, 0x09, 0x97,
-    0x09, 0xca, 0x09, 0xe8, 0x0a, 0x1b, 0x0a, 0x3e, 0x0a, 0x8a, 0x0a, 0xbd, 0x0b, 0x15, 0x0b, 0x5a,
-    0x0b, 0xb9, 0x0b, 0xd7, 0x0c, 0x05, 0x0c, 0x2d, 0x0c, 0x6f, 0x0c, 0x9e, 0x0c, 0xc2, 0x0c, 0xef,
-    0x0d, 0x08, 0x0d, 0x1c, 0x0d, 0x35, 0x0d, 0x5a, 0x0d, 0x6a, 0x0d, 0x7e, 0x0d, 0xe6, 0x0e, 0x39,
-    0x0e, 0x7f, 0x0e, 0xd2, 0x0f, 0x1f, 0x0f, 0x4e, 0x0f, 0xb6, 0x0f, 0xee, 0x10, 0x14, 0x10, 0x4d,
-    0x10, 0x80, 0x10, 0x94, 0x10, 0xf0, 0x11, 0x2a, 0x11, 0x70, 0x11, 0xc3, 0x12, 0x17, 0x12, 0x4b,
-    0x12, 0xa2, 0x12, 0xd2, 0x13, 0x09, 0x13, 0x2f, 0x13, 0x71, 0x13, 0x9e, 0x13, 0xda, 0x14, 0x06,
-    0x14, 0x4c, 0x14, 0x5e, 0x14, 0xa5, 0x14, 0xe4, 0x15, 0x08, 0x15, 0x62, 0x15, 0xad, 0x16, 0x0e,
-    0x16, 0x55, 0x16, 0x6f, 0x17, 0x01, 0x17, 0x2e, 0x17, 0xa6, 0x17, 0xfc, 0x18, 0x08, 0x18, 0x25,
-    0x18, 0xbe, 0x18, 0xcf, 0x19, 0x02, 0x19, 0x27, 0x19, 0x5e, 0x19, 0xbc, 0x19, 0xd0, 0x1a, 0x10,
-    0x1a, 0x2f, 0x1a, 0x49, 0x1a, 0x73, 0x1a, 0x8a, 0x1a, 0xc8, 0x1a, 0xd4, 0x1a, 0xe5, 0x1a, 0xf6,
-    0x1b, 0x07, 0x1b, 0x57, 0x1b, 0xa4, 0x1b, 0xc2, 0x1c, 0x1b, 0x1c, 0x54, 0x1c, 0xb1, 0x1d, 0x4f,
-    0x1d, 0xb0, 0x1d, 0xe7, 0x1e, 0x3b, 0x1e, 0x8f, 0x1e, 0xeb, 0x1f, 0x1c, 0x1f, 0x30, 0x1f, 0x62,
-    0x1f, 0x8b, 0x1f, 0xaa, 0x1f, 0xe6, 0x20, 0x33, 0x20, 0x9e, 0x21, 0x27, 0x21, 0x4d, 0x21, 0x99,
-    0x21, 0xe8, 0x22, 0x49, 0x22, 0xa0, 0x22, 0xdf, 0x23, 0x2a, 0x23, 0x50, 0x23, 0x9a, 0x23, 0xba,
-    0x23, 0xd9, 0x23, 0xe1, 0x24, 0x03, 0x24, 0x1e, 0x24, 0x4e, 0x24, 0x79, 0x24, 0xb5, 0x24, 0xd3,
-    0x24, 0xff, 0x25, 0x13, 0x25, 0x28, 0x25, 0x31, 0x25, 0x5c, 0x25, 0x79, 0x25, 0x93, 0x25, 0xa6,
-    0x25, 0xe1, 0x25, 0xe9, 0x26, 0x00, 0x26, 0x30, 0x26, 0x88, 0x26, 0xb0, 0x26, 0xd7, 0x26, 0xf4,
-    0x27, 0x28, 0x27, 0x7b, 0x27, 0xb8, 0x28, 0x17, 0x28, 0x81, 0x28, 0xe3, 0x29, 0x10, 0x29, 0x7a,
-    0x29, 0xe0, 0x2a, 0x31, 0x2a, 0x6b, 0x2a, 0xc6, 0x2a, 0xec, 0x2b, 0x3f, 0x2b, 0xaf, 0x2b, 0xe8,
-    0x2c, 0x36, 0x2c, 0x81, 0x2c, 0xd4, 0x2d, 0x04, 0x2d, 0x3c, 0x2d, 0x8f, 0x2d, 0xd0, 0x2e, 0x37,
-    0x2e, 0x96, 0x2e, 0xec, 0x2f, 0x5d, 0x2f, 0xa6, 0x2f, 0xf6, 0x30, 0x52, 0x30, 0x9a, 0x30, 0xd9,
-    0x30, 0xfd, 0x31, 0x40, 0x31, 0x92, 0x31, 0xdf, 0x32, 0x46, 0x32, 0x69, 0x32, 0xa1, 0x32, 0xdf,
-    0x33, 0x31, 0x33, 0x5a, 0x33, 0x90, 0x33, 0xb5, 0x33, 0xe6, 0x34, 0x23, 0x34, 0x62, 0x34, 0x97,
-    0x34, 0xe7, 0x35, 0x49, 0x35, 0x88, 0x35, 0xf7, 0x36, 0x5b, 0x36, 0x72, 0x36, 0xb7, 0x37, 0x06,
-    0x37, 0x6a, 0x37, 0x8d, 0x37, 0xbf, 0x37, 0xf7, 0x38, 0x26, 0x38, 0x4e, 0x38, 0x74, 0x38, 0x90,
-    0x39, 0x24, 0x39, 0x4c, 0x39, 0x80, 0x39, 0xa5, 0x39, 0xd6, 0x3a, 0x14, 0x3a, 0x52, 0x3a, 0x87,
-    0x3a, 0xd5, 0x3b, 0x33, 0x3b, 0x73, 0x3b, 0xce, 0x3c, 0x1c, 0x3c, 0x77, 0x3c, 0xc0, 0x3d, 0x00,
-    0x3d, 0x25, 0x3d, 0x7a, 0x3d, 0xd0, 0x3e, 0x0f, 0x3e, 0x68, 0x3e, 0xc2, 0x3e, 0xfe, 0x3f, 0x36,
-    0x3f, 0x89, 0x3f, 0xd8, 0x40, 0x3b, 0x40, 0x9c, 0x41, 0x12, 0x41, 0x89, 0x42, 0x07, 0x42, 0x83,
-    0x42, 0xea, 0x43, 0x3c, 0x43, 0x72, 0x43, 0xaa, 0x44, 0x0f, 0x44, 0x6d, 0x45, 0x11, 0x45, 0xb2,
-    0x46, 0x1a, 0x46, 0x83, 0x46, 0xc7, 0x47, 0x08, 0x47, 0x38, 0x47, 0x56, 0x47, 0x81, 0x47, 0x96,
-    0x47, 0xac, 0x48, 0x44, 0x48, 0x95, 0x48, 0xb1, 0x48, 0xcd, 0x49, 0x08, 0x49, 0x4b, 0x49, 0xaf,
-    0x49, 0xd1, 0x49, 0xf3, 0x4a, 0x2e, 0x4a, 0x69, 0x4a, 0x7c, 0x4a, 0x8f, 0x4a, 0x9b, 0x4a, 0xae,
-    0x4a, 0xed, 0x4b, 0x2b, 0x4b, 0x65, 0x4b, 0x9f, 0x4b, 0xb2, 0x4b, 0xc5, 0x4b, 0xf6, 0x4c, 0x27,
-    0x4c, 0x66, 0x4c, 0xaf, 0x4d, 0x19, 0x4d, 0x81, 0x4d, 0x94, 0x4d, 0xa7, 0x4d, 0xd9, 0x4e, 0x0b,
-    0x4e, 0x1e, 0x4e, 0x31, 0x4e, 0x75, 0x4e, 0xb7, 0x4e, 0xed, 0x4f, 0x4d, 0x4f, 0xab, 0x4f, 0xf4,
-    0x50, 0x3a, 0x50, 0x4d, 0x50, 0x60, 0x50, 0x97, 0x50, 0xd0, 0x50, 0xe3, 0x50, 0xf6, 0x51, 0x09,
-    0x51, 0x1c, 0x51, 0x6a, 0x51, 0xb5, 0x52, 0x00, 0x52, 0x0f, 0x52, 0x1f, 0x52, 0x2b, 0x52, 0x37,
-    0x52, 0x69, 0x52, 0xbf, 0x53, 0x34, 0x53, 0xa9, 0x54, 0x1e, 0x54, 0x8b, 0x54, 0xf6, 0x55, 0x52,
-    0x55, 0xb1, 0x55, 0xfd, 0x56, 0x4c, 0x56, 0x98, 0x56, 0xe2, 0x57, 0x23, 0x57, 0x64, 0x57, 0xcc,
-    0x57, 0xd8, 0x57, 0xe4, 0x58, 0x0c, 0x58, 0x0c, 0x58, 0x0c, 0x58, 0x0c, 0x58, 0x0c, 0x58, 0x0c,
-    0x58, 0x0c, 0x58, 0x0c, 0x58, 0x0c, 0x58, 0x0c, 0x58, 0x0c, 0x58, 0x0c, 0x58, 0x0c, 0x58, 0x0c,
-    0x58, 0x14, 0x58, 0x1c, 0x58, 0x2d, 0x58, 0x3e, 0x58, 0x59, 0x58, 0x73, 0x58, 0x8e, 0x58, 0xa9,
-    0x58, 0xc3, 0x58, 0xcf, 0x58, 0xdb, 0x59, 0x08, 0x59, 0x27, 0x59, 0x51, 0x59, 0x6d, 0x59, 0x79,
-    0x59, 0x89, 0x59, 0xa3, 0x5a, 0x57, 0x5a, 0x7a, 0x5a, 0x9a, 0x5a, 0xb1, 0x5a, 0xba, 0x5a, 0xc3,
-    0x5a, 0xcc, 0x5a, 0xd5, 0x5a, 0xde, 0x5a, 0xe7, 0x5a, 0xf0, 0x5b, 0x0f, 0x5b, 0x20, 0x5b, 0x3a,
-    0x5b, 0x64, 0x5b, 0x8f, 0x5b, 0xc4, 0x5b, 0xcd, 0x5b, 0xd6, 0x5b, 0xdf, 0x5b, 0xe8, 0x5b, 0xf1,
-    0x5b, 0xfa, 0x5c, 0x03, 0x5c, 0x0c, 0x5c, 0x15, 0x5c, 0x1e, 0x5c, 0x27, 0x5c, 0x30, 0x5c, 0x39,
-    0x5c, 0x60, 0x5c, 0x87, 0x5c, 0xd9, 0x5d, 0x10, 0x5d, 0x68, 0x5d, 0x74, 0x5d, 0xcc, 0x5e, 0x12,
-    0x5e, 0x64, 0x5e, 0xae, 0x5e, 0xff, 0x5f, 0x3e, 0x5f, 0x7a, 0x5f, 0xb5, 0x60, 0x33, 0x60, 0x7e,
-    0x60, 0xe0, 0x61, 0x19, 0x61, 0x61, 0x61, 0x77, 0x61, 0x88, 0x61, 0x9e, 0x61, 0xb4, 0x62, 0x19,
-    0x62, 0x33, 0x62, 0x66, 0x62, 0x77, 0x62, 0xa2, 0x63, 0x30, 0x63, 0x6a, 0x63, 0xc8, 0x63, 0xf5,
-    0x64, 0x26, 0x64, 0x58, 0x64, 0x8c, 0x64, 0x99, 0x64, 0xb5, 0x64, 0xcf, 0x64, 0xdb, 0x65, 0x12,
-    0x65, 0x4e, 0x65, 0xaa, 0x66, 0x0d, 0x66, 0x68, 0x67, 0x0e, 0x67, 0x0e, 0x68, 0x04, 0x68, 0x4a,
-    0x68, 0x7f, 0x68, 0xa3, 0x68, 0xe0, 0x69, 0x32, 0x69, 0xa3, 0x69, 0xbd, 0x6a, 0x0d, 0x6a, 0x50,
-    0x6a, 0x78, 0x6a, 0xda, 0x6b, 0x13, 0x6b, 0x2b, 0x6b, 0x71, 0x6b, 0x9d, 0x6b, 0xce, 0x6b, 0xf9,
-    0x6c, 0x39, 0x6c, 0x5c, 0x6c, 0x88, 0x6c, 0xa4, 0x6d, 0x00, 0x6d, 0x40, 0x6d, 0x95, 0x6d, 0xc7,
-    0x6e, 0x0d, 0x6e, 0x2d, 0x6e, 0x5d, 0x6e, 0x78, 0x6e, 0xa8, 0x6e, 0xd0, 0x6e, 0xe2, 0x6f, 0x09,
-    0x6f, 0x51, 0x6f, 0x7a, 0x6f, 0xec, 0x70, 0x39, 0x70, 0x76, 0x70, 0x91, 0x70, 0xc0, 0x71, 0x10,
-    0x71, 0x33, 0x71, 0x59, 0x71, 0x7c, 0x71, 0xb2, 0x71, 0xfe, 0x72, 0x3e, 0x72, 0x9d, 0x72, 0xe4,
-    0x73, 0x30, 0x73, 0x85, 0x73, 0xc9, 0x74, 0x05, 0x74, 0x34, 0x74, 0x6e, 0x74, 0xb4, 0x75, 0x05,
-    0x75, 0x69, 0x75, 0x94, 0x75, 0xc6, 0x75, 0xfd, 0x76, 0x38, 0x76, 0x69, 0x76, 0x9b, 0x76, 0xc9,
-    0x77, 0x06, 0x77, 0x3e, 0x77, 0x4a, 0x77, 0x7a, 0x77, 0xc7, 0x78, 0x22, 0x78, 0x6a, 0x78, 0x92,
-    0x78, 0xed, 0x79, 0x2a, 0x79, 0x68, 0x79, 0xa2, 0x7a, 0x0a, 0x7a, 0x16, 0x7a, 0x4f, 0x7a, 0x88,
-    0x7a, 0xc7, 0x7a, 0xf8, 0x7b, 0x4e, 0x7b, 0x97, 0x7b, 0xe1, 0x7c, 0x40, 0x7c, 0x97, 0x7c, 0xe8,
-    0x7d, 0x4b, 0x7d, 0x87, 0x7d, 0xdb, 0x7e, 0x02, 0x7e, 0x3f, 0x7e, 0x8a, 0x7e, 0xa3, 0x7f, 0x09,
-    0x7f, 0x54, 0x7f, 0x65, 0x7f, 0x9f, 0x7f, 0xce, 0x80, 0x6d, 0x80, 0xc7, 0x81, 0x1d, 0x81, 0x50,
-    0x81, 0x82, 0x81, 0xb2, 0x81, 0xe6, 0x82, 0x21, 0x82, 0x63, 0x82, 0xc3, 0x82, 0xf4, 0x83, 0x10,
-    0x83, 0x3b, 0x83, 0x77, 0x83, 0x9b, 0x83, 0xc1, 0x83, 0xfe, 0x84, 0x43, 0x84, 0x6c, 0x84, 0x97,
-    0x84, 0xe4, 0x84, 0xed, 0x84, 0xf6, 0x84, 0xff, 0x85, 0x08, 0x85, 0x11, 0x85, 0x1a, 0x85, 0x23,
-    0x85, 0x6a, 0x85, 0xba, 0x85, 0xf8, 0x86, 0x44, 0x86, 0x9f, 0x86, 0xbc, 0x86, 0xfa, 0x87, 0x3b,
-    0x87, 0x63, 0x87, 0xac, 0x87, 0xc7, 0x88, 0x17, 0x88, 0x28, 0x88, 0x98, 0x88, 0xf3, 0x89, 0x17,
-    0x89, 0x1f, 0x89, 0x27, 0x89, 0x2f, 0x89, 0x37, 0x89, 0x3f, 0x89, 0x47, 0x89, 0x4f, 0x89, 0x57,
-    0x89, 0x5f, 0x89, 0x67, 0x89, 0x6f, 0x89, 0x77, 0x89, 0x7f, 0x89, 0x91, 0x89, 0x99, 0x89, 0xfa,
-    0x8a, 0x3f, 0x8a, 0x5c, 0x8a, 0xaf, 0x8a, 0xf5, 0x8b, 0x48, 0x8b, 0xb0, 0x8b, 0xf6, 0x8c, 0x49,
-    0x8c, 0x9d, 0x8c, 0xe6, 0x8d, 0x4d, 0x8d, 0x9c, 0x8d, 0xa4, 0x8e, 0x10, 0x8e, 0x3a, 0x8e, 0x87,
-    0x8e, 0xba, 0x8f, 0x0f, 0x8f, 0x3e, 0x8f, 0x7d, 0x8f, 0x7d, 0x8f, 0x85, 0x8f, 0xce, 0x90, 0x17,
-    0x90, 0x57, 0x90, 0x7c, 0x90, 0xb8, 0x90, 0xcb, 0x90, 0xde, 0x90, 0xf1, 0x91, 0x04, 0x91, 0x18,
-    0x91, 0x2c, 0x91, 0x42, 0x91, 0x55, 0x91, 0x68, 0x91, 0x7b, 0x91, 0x8e, 0x91, 0xa2, 0x91, 0xb5,
-    0x91, 0xc8, 0x91, 0xdb, 0x91, 0xef, 0x92, 0x02, 0x92, 0x15, 0x92, 0x28, 0x92, 0x3b, 0x92, 0x4e,
-    0x92, 0x62, 0x92, 0x75, 0x92, 0x88, 0x92, 0x9b, 0x92, 0xaf, 0x92, 0xc2, 0x92, 0xd5, 0x92, 0xe8,
-    0x92, 0xfa, 0x93, 0x0c, 0x93, 0x20, 0x93, 0x34, 0x93, 0x4a, 0x93, 0x5d, 0x93, 0x70, 0x93, 0x83,
-    0x93, 0x95, 0x93, 0xa9, 0x93, 0xbc, 0x93, 0xce, 0x93, 0xe1, 0x93, 0xf5, 0x94, 0x07, 0x94, 0x1a,
-    0x94, 0x2d, 0x94, 0x3f, 0x94, 0x51, 0x94, 0x65, 0x94, 0x78, 0x94, 0x8b, 0x94, 0x9d, 0x94, 0xb1,
-    0x94, 0xc4, 0x94, 0xd7, 0x94, 0xea, 0x94, 0xfc, 0x95, 0x0f, 0x95, 0x22, 0x95, 0x79, 0x96, 0x01,
-    0x96, 0x14, 0x96, 0x27, 0x96, 0x3a, 0x96, 0x4c, 0x96, 0x5f, 0x96, 0x72, 0x96, 0x85, 0x96, 0x97,
-    0x96, 0xaa, 0x96, 0xbd, 0x96, 0xd0, 0x96, 0xe2, 0x96, 0xf5, 0x97, 0x08, 0x97, 0x1b, 0x97, 0x2e,
-    0x97, 0x83, 0x97, 0xf1, 0x98, 0x04, 0x98, 0x16, 0x98, 0x29, 0x98, 0x3b, 0x98, 0x4e, 0x98, 0x60,
-    0x98, 0x73, 0x98, 0x86, 0x98, 0x9a, 0x98, 0xad, 0x98, 0xc0, 0x98, 0xd3, 0x98, 0xe6, 0x98, 0xf9,
-    0x99, 0x0c, 0x99, 0x1f, 0x99, 0x32, 0x99, 0x45, 0x99, 0x57, 0x99, 0x69, 0x99, 0x7c, 0x99, 0x88,
-    0x99, 0x94, 0x99, 0xa7, 0x99, 0xba, 0x99, 0xce, 0x99, 0xe2, 0x99, 0xf5, 0x9a, 0x08, 0x9a, 0x1c,
-    0x9a, 0x30, 0x9a, 0x43, 0x9a, 0x56, 0x9a, 0x62, 0x9a, 0x6e, 0x9a, 0x81, 0x9a, 0x94, 0x9a, 0xa8,
-    0x9a, 0xbc, 0x9a, 0xcf, 0x9a, 0xe1, 0x9a, 0xf4, 0x9b, 0x07, 0x9b, 0x19, 0x9b, 0x2c, 0x9b, 0x3f,
-    0x9b, 0x53, 0x9b, 0x67, 0x9b, 0x7a, 0x9b, 0x8d, 0x9b, 0xa1, 0x9b, 0xb5, 0x9b, 0xc8, 0x9b, 0xda,
-    0x9b, 0xed, 0x9c, 0x00, 0x9c, 0x13, 0x9c, 0x25, 0x9c, 0x38, 0x9c, 0x4b, 0x9c, 0x5f, 0x9c, 0x73,
-    0x9c, 0x86, 0x9c, 0x98, 0x9c, 0xac, 0x9c, 0xc0, 0x9c, 0xd3, 0x9c, 0xe6, 0x9c, 0xf9, 0x9d, 0x0d,
-    0x9d, 0x20, 0x9d, 0x32, 0x9d, 0x45, 0x9d, 0x57, 0x9d, 0x6a, 0x9d, 0x7d, 0x9d, 0x91, 0x9d, 0xa5,
-    0x9d, 0xb9, 0x9d, 0xcd, 0x9e, 0x1d, 0x9e, 0x78, 0x9e, 0x8b, 0x9e, 0x9e, 0x9e, 0xb1, 0x9e, 0xc3,
-    0x9e, 0xd7, 0x9e, 0xea, 0x9e, 0xfd, 0x9f, 0x10, 0x9f, 0x23, 0x9f, 0x36, 0x9f, 0x48, 0x9f, 0x5b,
-    0x9f, 0x6e, 0x9f, 0x81, 0x9f, 0x94, 0x9f, 0xa0, 0x9f, 0xac, 0x9f, 0xb7, 0x9f, 0xca, 0x9f, 0xdd,
-    0x9f, 0xef, 0xa0, 0x01, 0xa0, 0x15, 0xa0, 0x29, 0xa0, 0x35, 0xa0, 0x41, 0xa0, 0x54, 0xa0, 0x67,
-    0xa0, 0x79, 0xa0, 0x8c, 0xa0, 0x9f, 0xa0, 0xb1, 0xa0, 0xc4, 0xa0, 0xd8, 0xa0, 0xeb, 0xa0, 0xfe,
-    0xa1, 0x11, 0xa1, 0x24, 0xa1, 0x37, 0xa1, 0x4b, 0xa1, 0x5e, 0xa1, 0x71, 0xa1, 0x83, 0xa1, 0x97,
-    0xa1, 0xaa, 0xa1, 0xbc, 0xa1, 0xcf, 0xa2, 0x21, 0xa2, 0x34, 0xa2, 0x46, 0xa2, 0x59, 0xa2, 0x6c,
-    0xa2, 0x7e, 0xa2, 0x90, 0xa2, 0xa2, 0xa2, 0xb5, 0xa3, 0x07, 0xa3, 0x19, 0xa3, 0x2b, 0xa3, 0x3e,
-    0xa3, 0x51, 0xa3, 0x65, 0xa3, 0x78, 0xa3, 0x8b, 0xa3, 0x9e, 0xa3, 0xb1, 0xa3, 0xbc, 0xa3, 0xce,
-    0xa3, 0xe1, 0xa3, 0xed, 0xa3, 0xff, 0xa4, 0x13, 0xa4, 0x1f, 0xa4, 0x2b, 0xa4, 0x3e, 0xa4, 0x4a,
-    0xa4, 0x5d, 0xa4, 0x70, 0xa4, 0x83, 0xa4, 0x97, 0xa4, 0xaa, 0xa4, 0xb6, 0xa4, 0xc8, 0xa4, 0xdb,
-    0xa4, 0xed, 0xa4, 0xf9, 0xa5, 0x0b, 0xa5, 0x1f, 0xa5, 0x31, 0xa5, 0x3d, 0xa5, 0x4f, 0xa5, 0x61,
-    0xa5, 0x74, 0xa5, 0x88, 0xa5, 0x9c, 0xa5, 0xeb, 0xa5, 0xfe, 0xa6, 0x10, 0xa6, 0x23, 0xa6, 0x36,
-    0xa6, 0x49, 0xa6, 0x5b, 0xa6, 0x6e, 0xa6, 0x82, 0xa6, 0x8e, 0xa6, 0xa2, 0xa6, 0xb6, 0xa6, 0xc9,
-    0xa6, 0xdd, 0xa6, 0xf2, 0xa6, 0xfa, 0xa7, 0x02, 0xa7, 0x0a, 0xa7, 0x12, 0xa7, 0x1a, 0xa7, 0x22,
-    0xa7, 0x2a, 0xa7, 0x32, 0xa7, 0x3a, 0xa7, 0x42, 0xa7, 0x4a, 0xa7, 0x52, 0xa7, 0x5a, 0xa7, 0x62,
-    0xa7, 0x76, 0xa7, 0x8a, 0xa7, 0x9d, 0xa7, 0xb0, 0xa7, 0xc3, 0xa7, 0xd5, 0xa7, 0xe9, 0xa7, 0xf1,
-    0xa7, 0xf9, 0xa8, 0x01, 0xa8, 0x09, 0xa8, 0x11, 0xa8, 0x25, 0xa8, 0x38, 0xa8, 0x4b, 0xa8, 0x5e,
-    0xa8, 0x71, 0xa8, 0x85, 0xa8, 0x98, 0xa8, 0xf5, 0xa8, 0xfd, 0xa9, 0x11, 0xa9, 0x19, 0xa9, 0x21,
-    0xa9, 0x34, 0xa9, 0x47, 0xa9, 0x4f, 0xa9, 0x57, 0xa9, 0x5f, 0xa9, 0x67, 0xa9, 0x7a, 0xa9, 0x82,
-    0xa9, 0x8a, 0xa9, 0x92, 0xa9, 0x9a, 0xa9, 0xa2, 0xa9, 0xaa, 0xa9, 0xb2, 0xa9, 0xba, 0xa9, 0xc2,
-    0xa9, 0xca, 0xa9, 0xdd, 0xa9, 0xe5, 0xa9, 0xed, 0xaa, 0x30, 0xaa, 0x38, 0xaa, 0x40, 0xaa, 0x54,
-    0xaa, 0x67, 0xaa, 0x6f, 0xaa, 0x77, 0xaa, 0x8b, 0xaa, 0x93, 0xaa, 0xa6, 0xaa, 0xb8, 0xaa, 0xcb,
-    0xaa, 0xde, 0xaa, 0xf1, 0xab, 0x04, 0xab, 0x18, 0xab, 0x2c, 0xab, 0x3f, 0xab, 0x52, 0xab, 0x5a,
-    0xab, 0x62, 0xab, 0x6e, 0xab, 0x81, 0xab, 0x89, 0xab, 0x9c, 0xab, 0xaf, 0xab, 0xc4, 0xab, 0xd9,
-    0xab, 0xec, 0xab, 0xff, 0xac, 0x12, 0xac, 0x25, 0xac, 0x2d, 0xac, 0x35, 0xac, 0x49, 0xac, 0x5d,
-    0xac, 0x69, 0xac, 0x75, 0xac, 0x88, 0xac, 0x9b, 0xac, 0xae, 0xac, 0xc1, 0xac, 0xc9, 0xac, 0xd1,
-    0xac, 0xd9, 0xac, 0xec, 0xac, 0xff, 0xad, 0x07, 0xad, 0x1a, 0xad, 0x2d, 0xad, 0x41, 0xad, 0x55,
-    0xad, 0x5d, 0xad, 0x65, 0xad, 0x78, 0xad, 0x8b, 0xad, 0x9f, 0xad, 0xa7, 0xad, 0xbb, 0xad, 0xcf,
-    0xad, 0xe3, 0xad, 0xf7, 0xae, 0x0a, 0xae, 0x1d, 0xae, 0x2f, 0xae, 0x43, 0xae, 0x57, 0xae, 0x6b,
-    0xae, 0x7f, 0xae, 0x87, 0xae, 0x8f, 0xae, 0xa3, 0xae, 0xb7, 0xae, 0xcb, 0xae, 0xde, 0xae, 0xf1,
-    0xaf, 0x03, 0xaf, 0x17, 0xaf, 0x2a, 0xaf, 0x3e, 0xaf, 0x52, 0xaf, 0x66, 0xaf, 0x79, 0xaf, 0x8d,
-    0xaf, 0xa1, 0xaf, 0xa9, 0xaf, 0xbd, 0xaf, 0xd1, 0xaf, 0xe4, 0xaf, 0xf7, 0xb0, 0x0b, 0xb0, 0x1e,
-    0xb0, 0x32, 0xb0, 0x45, 0xb0, 0x59, 0xb0, 0x6c, 0xb0, 0x80, 0xb0, 0x93, 0xb0, 0xb0, 0xb0, 0xcc,
-    0xb0, 0xe0, 0xb0, 0xf4, 0xb1, 0x08, 0xb1, 0x1c, 0xb1, 0x30, 0xb1, 0x44, 0xb1, 0x58, 0xb1, 0x6c,
-    0xb1, 0x89, 0xb1, 0xa6, 0xb1, 0xba, 0xb1, 0xce, 0xb1, 0xe1, 0xb1, 0xf4, 0xb2, 0x07, 0xb2, 0x19,
-    0xb2, 0x2d, 0xb2, 0x40, 0xb2, 0x54, 0xb2, 0x67, 0xb2, 0x7b, 0xb2, 0x8e, 0xb2, 0xa2, 0xb2, 0xb5,
-    0xb2, 0xd2, 0xb2, 0xee, 0xb3, 0x01, 0xb3, 0x14, 0xb3, 0x28, 0xb3, 0x3c, 0xb3, 0x50, 0xb3, 0x64,
-    0xb3, 0x77, 0xb3, 0x8a, 0xb3, 0x9e, 0xb3, 0xb1, 0xb3, 0xc5, 0xb3, 0xd8, 0xb3, 0xec, 0xb3, 0xff,
-    0xb4, 0x13, 0xb4, 0x26, 0xb4, 0x43, 0xb4, 0x5f, 0xb4, 0x72, 0xb4, 0x85, 0xb4, 0x98, 0xb4, 0xab,
-    0xb4, 0xbe, 0xb4, 0xd1, 0xb4, 0xe4, 0xb4, 0xf6, 0xb5, 0x0a, 0xb5, 0x1e, 0xb5, 0x32, 0xb5, 0x46,
-    0xb5, 0x59, 0xb5, 0x6c, 0xb5, 0x7f, 0xb5, 0x92, 0xb5, 0xa5, 0xb5, 0xb8, 0xb5, 0xcb, 0xb5, 0xde,
-    0xb5, 0xf1, 0xb6, 0x03, 0xb6, 0x17, 0xb6, 0x2b, 0xb6, 0x3f, 0xb6, 0x53, 0xb6, 0x66, 0xb6, 0x79,
-    0xb6, 0x8c, 0xb6, 0x9e, 0xb6, 0xbb, 0xb6, 0xce, 0xb6, 0xe1, 0xb6, 0xf4, 0xb7, 0x07, 0xb7, 0x1a,
-    0xb7, 0x2d, 0xb7, 0x40, 0xb7, 0x53, 0xb7, 0x5b, 0xb7, 0x98, 0xb7, 0xd4, 0xb7, 0xf6, 0xb8, 0x18,
-    0xb8, 0x57, 0xb8, 0x98, 0xb8, 0xc6, 0xb8, 0xf9, 0xb9, 0x31, 0xb9, 0x67, 0xb9, 0x6f, 0xb9, 0x83,
-    0xb9, 0x8b, 0xb9, 0x93, 0xb9, 0x9b, 0xb9, 0xa3, 0xb9, 0xab, 0xb9, 0xb3, 0xb9, 0xbb, 0xb9, 0xc3,
-    0xb9, 0xcb, 0xb9, 0xde, 0xb9, 0xf1, 0xba, 0x04, 0xba, 0x17, 0xba, 0x2b, 0xba, 0x3f, 0xba, 0x53,
-    0xba, 0x67, 0xba, 0x7b, 0xba, 0x8f, 0xba, 0xa3, 0xba, 0xb7, 0xba, 0xcb, 0xba, 0xdf, 0xba, 0xf3,
-    0xbb, 0x07, 0xbb, 0x13, 0xbb, 0x27, 0xbb, 0x3b, 0xbb, 0x4f, 0xbb, 0x63, 0xbb, 0x77, 0xbb, 0x8b,
-    0xbb, 0x9f, 0xbb, 0xb3, 0xbb, 0xc6, 0xbb, 0xd9, 0xbb, 0xed, 0xbc, 0x01, 0xbc, 0x15, 0xbc, 0x29,
-    0xbc, 0x3d, 0xbc, 0x51, 0xbc, 0x65, 0xbc, 0x79, 0xbc, 0x8d, 0xbc, 0xa0, 0xbc, 0xb3, 0xbc, 0xc7,
-    0xbc, 0xdb, 0xbc, 0xef, 0xbd, 0x03, 0xbd, 0x17, 0xbd, 0x2b, 0xbd, 0x3f, 0xbd, 0x52, 0xbd, 0x64,
-    0xbd, 0x78, 0xbd, 0x8c, 0xbd, 0xa0, 0xbd, 0xb4, 0xbd, 0xc8, 0xbd, 0xdc, 0xbd, 0xf0, 0xbd, 0xfc,
-    0xbe, 0x08, 0xbe, 0x14, 0xbe, 0x20, 0xbe, 0x2c, 0xbe, 0x38, 0xbe, 0x44, 0xbe, 0x4c, 0xbe, 0x54,
-    0xbe, 0x5c, 0xbe, 0x64, 0xbe, 0x6c, 0xbe, 0x74, 0xbe, 0x7c, 0xbe, 0x84, 0xbe, 0x8c, 0xbe, 0x94,
-    0xbe, 0x9c, 0xbe, 0xa4, 0xbe, 0xac, 0xbe, 0xb4, 0xbe, 0xc8, 0xbe, 0xdb, 0xbe, 0xee, 0xbf, 0x01,
-    0xbf, 0x09, 0xbf, 0x11, 0xbf, 0x25, 0xbf, 0x2d, 0xbf, 0x40, 0xbf, 0x52, 0xbf, 0x5a, 0xbf, 0x62,
-    0xbf, 0x6a, 0xbf, 0x72, 0xbf, 0x85, 0xbf, 0x8d, 0xbf, 0x95, 0xbf, 0x9d, 0xbf, 0xa5, 0xbf, 0xad,
-    0xbf, 0xb5, 0xbf, 0xbd, 0xbf, 0xc5, 0xc0, 0x36, 0xc0, 0x67, 0xc0, 0xb3, 0xc0, 0xbb, 0xc0, 0xc7,
-    0xc0, 0xda, 0xc0, 0xec, 0xc0, 0xf4, 0xc1, 0x00, 0xc1, 0x13, 0xc1, 0x26, 0xc1, 0x32, 0xc1, 0x45,
-    0xc1, 0x58, 0xc1, 0x6c, 0xc1, 0x78, 0xc1, 0x8b, 0xc1, 0x9e, 0xc1, 0xb1, 0xc1, 0xc4, 0xc1, 0xd0,
-    0xc1, 0xdc, 0xc1, 0xf0, 0x40, 0x4a, 0x99, 0x98, 0x97, 0x96, 0x87, 0x86, 0x85, 0x84, 0x83, 0x82,
-    0x81, 0x80, 0x7f, 0x7e, 0x7d, 0x7c, 0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x74, 0x73, 0x72,
-    0x71, 0x70, 0x6f, 0x6e, 0x6d, 0x6c, 0x6b, 0x6a, 0x69, 0x68, 0x67, 0x66, 0x65, 0x64, 0x63, 0x62,
-    0x61, 0x60, 0x5f, 0x5e, 0x5d, 0x5c, 0x5b, 0x5a, 0x59, 0x58, 0x57, 0x56, 0x55, 0x54, 0x53, 0x51,
-    0x50, 0x4f, 0x4e, 0x4d, 0x4c, 0x4b, 0x4a, 0x49, 0x48, 0x47, 0x46, 0x28, 0x1f, 0x10, 0x0a, 0x09,
-    0x2c, 0x01, 0xb1, 0x0b, 0x0a, 0x43, 0x23, 0x43, 0x65, 0x0a, 0x2d, 0x2c, 0x00, 0xb1, 0x0a, 0x0b,
-    0x43, 0x23, 0x43, 0x0b, 0x2d, 0x2c, 0x01, 0xb0, 0x06, 0x43, 0xb0, 0x07, 0x43, 0x65, 0x0a, 0x2d,
-    0x2c, 0xb0, 0x4f, 0x2b, 0x20, 0xb0, 0x40, 0x51, 0x58, 0x21, 0x4b, 0x52, 0x58, 0x45, 0x44, 0x1b,
-    0x21, 0x21, 0x59, 0x1b, 0x23, 0x21, 0xb0, 0x40, 0xb0, 0x04, 0x25, 0x45, 0xb0, 0x04, 0x25, 0x45,
-    0x61, 0x64, 0x8a, 0x63, 0x52, 0x58, 0x45, 0x44, 0x1b, 0x21, 0x21, 0x59, 0x59, 0x2d, 0x2c, 0x00,
-    0xb0, 0x07, 0x43, 0xb0, 0x06, 0x43, 0x0b, 0x2d, 0x2c, 0x4b, 0x53, 0x23, 0x4b, 0x51, 0x5a, 0x58,
-    0x20, 0x45, 0x8a, 0x60, 0x44, 0x1b, 0x21, 0x21, 0x59, 0x2d, 0x2c, 0x4b, 0x54, 0x58, 0x20, 0x45,
-    0x8a, 0x60, 0x44, 0x1b, 0x21, 0x21, 0x59, 0x2d, 0x2c, 0x4b, 0x53, 0x23, 0x4b, 0x51, 0x5a, 0x58,
-    0x38, 0x1b, 0x21, 0x21, 0x59, 0x2d, 0x2c, 0x4b, 0x54, 0x58, 0x38, 0x1b, 0x21, 0x21, 0x59, 0x2d,
-    0x2c, 0xb0, 0x02, 0x43, 0x54, 0x58, 0xb0, 0x46, 0x2b, 0x1b, 0x21, 0x21, 0x21, 0x21, 0x59, 0x2d,
-    0x2c, 0xb0, 0x02, 0x43, 0x54, 0x58, 0xb0, 0x47, 0x2b, 0x1b, 0x21, 0x21, 0x21, 0x59, 0x2d, 0x2c,
-    0xb0, 0x02, 0x43, 0x54, 0x58, 0xb0, 0x48, 0x2b, 0x1b, 0x21, 0x21, 0x21, 0x21, 0x59, 0x2d, 0x2c,
-    0xb0, 0x02, 0x43, 0x54, 0x58, 0xb0, 0x49, 0x2b, 0x1b, 0x21, 0x21, 0x21, 0x59, 0x2d, 0x2c, 0x23,
-    0x20, 0xb0, 0x00, 0x50, 0x8a, 0x8a, 0x64, 0xb1, 0x00, 0x03, 0x25, 0x54, 0x58, 0xb0, 0x40, 0x1b,
-    0xb1, 0x01, 0x03, 0x25, 0x54, 0x58, 0xb0, 0x05, 0x43, 0x8b, 0x59, 0xb0, 0x4f, 0x2b, 0x59, 0x23,
-    0xb0, 0x62, 0x2b, 0x23, 0x21, 0x23, 0x58, 0x65, 0x59, 0x2d, 0x2c, 0xb1, 0x08, 0x00, 0x0c, 0x21,
-    0x54, 0x60, 0x43, 0x2d, 0x2c, 0xb1, 0x0c, 0x00, 0x0c, 0x21, 0x54, 0x60, 0x43, 0x2d, 0x2c, 0x01,
-    0x20, 0x47, 0xb0, 0x02, 0x43, 0x20, 0xb8, 0x10, 0x00, 0x62, 0xb8, 0x10, 0x00, 0x63, 0x57, 0x23,
-    0xb8, 0x01, 0x00, 0x62, 0xb8, 0x10, 0x00, 0x63, 0x57, 0x5a, 0x58, 0xb0, 0x20, 0x60, 0x66, 0x59,
-    0x48, 0x2d, 0x2c, 0xb1, 0x00, 0x02, 0x25, 0xb0, 0x02, 0x25, 0xb0, 0x02, 0x25, 0x53, 0xb8, 0x00,
-    0x35, 0x23, 0x78, 0xb0, 0x02, 0x25, 0xb0, 0x02, 0x25, 0x60, 0xb0, 0x20, 0x63, 0x20, 0x20, 0xb0,
-    0x06, 0x25, 0x23, 0x62, 0x50, 0x58, 0x8a, 0x21, 0xb0, 0x01, 0x60, 0x23, 0x1b, 0x20, 0x20, 0xb0,
-    0x06, 0x25, 0x23, 0x62, 0x52, 0x58, 0x23, 0x21, 0xb0, 0x01, 0x61, 0x1b, 0x8a, 0x21, 0x23, 0x21,
-    0x20, 0x59, 0x59, 0xb8, 0xff, 0xc1, 0x1c, 0x60, 0xb0, 0x20, 0x63, 0x23, 0x21, 0x2d, 0x2c, 0xb1,
-    0x02, 0x00, 0x42, 0xb1, 0x23, 0x01, 0x88, 0x51, 0xb1, 0x40, 0x01, 0x88, 0x53, 0x5a, 0x58, 0xb8,
-    0x10, 0x00, 0xb0, 0x20, 0x88, 0x54, 0x58, 0xb2, 0x02, 0x01, 0x02, 0x43, 0x60, 0x42, 0x59, 0xb1,
-    0x24, 0x01, 0x88, 0x51, 0x58, 0xb8, 0x20, 0x00, 0xb0, 0x40, 0x88, 0x54, 0x58, 0xb2, 0x02, 0x02,
-    0x02, 0x43, 0x60, 0x42, 0xb1, 0x24, 0x01, 0x88, 0x54, 0x58, 0xb2, 0x02, 0x20, 0x02, 0x43, 0x60,
-    0x42, 0x00, 0x4b, 0x01, 0x4b, 0x52, 0x58, 0xb2, 0x02, 0x08, 0x02, 0x43, 0x60, 0x42, 0x59, 0x1b,
-    0xb8, 0x40, 0x00, 0xb0, 0x80, 0x88, 0x54, 0x58, 0xb2, 0x02, 0x04, 0x02, 0x43, 0x60, 0x42, 0x59,
-    0xb8, 0x40, 0x00, 0xb0, 0x80, 0x63, 0xb8, 0x01, 0x00, 0x88, 0x54, 0x58, 0xb2, 0x02, 0x08, 0x02,
-    0x43, 0x60, 0x42, 0x59, 0xb9, 0x40, 0x00, 0x01, 0x00, 0x63, 0xb8, 0x02, 0x00, 0x88, 0x54, 0x58,
-    0xb2, 0x02, 0x10, 0x02, 0x43, 0x60, 0x42, 0x59, 0xb1, 0x26, 0x01, 0x88, 0x51, 0x58, 0xb9, 0x40,
-    0x00, 0x02, 0x00, 0x63, 0xb8, 0x04, 0x00, 0x88, 0x54, 0x58, 0xb2, 0x02, 0x40, 0x02, 0x43, 0x60,
-    0x42, 0x59, 0xb9, 0x40, 0x00, 0x04, 0x00, 0x63, 0xb8, 0x08, 0x00, 0x88, 0x54, 0x58, 0xb2, 0x02,
-    0x80, 0x02, 0x43, 0x60, 0x42, 0x59, 0xb1, 0x28, 0x01, 0x88, 0x51, 0x58, 0xb9, 0x40, 0x00, 0x08,
-    0x00, 0x63, 0xb8, 0x10, 0x00, 0x88, 0x54, 0x58, 0xb9, 0x00, 0x02, 0x01, 0x00, 0xb0, 0x02, 0x43,
-    0x60, 0x42, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0xb1, 0x00, 0x02, 0x43, 0x54, 0x58, 0x40,
-    0x0a, 0x05, 0x40, 0x08, 0x40, 0x09, 0x40, 0x0c, 0x02, 0x0d, 0x02, 0x1b, 0xb1, 0x01, 0x02, 0x43,
-    0x54, 0x58, 0xb2, 0x05, 0x40, 0x08, 0xba, 0x01, 0x00, 0x00, 0x09, 0x01, 0x00, 0xb3, 0x0c, 0x01,
-    0x0d, 0x01, 0x1b, 0xb1, 0x80, 0x02, 0x43, 0x52, 0x58, 0xb2, 0x05, 0x40, 0x08, 0xb8, 0x01, 0x80,
-    0xb1, 0x09, 0x40, 0x1b, 0xb8, 0x01, 0x00, 0xb0, 0x02, 0x43, 0x52, 0x58, 0xb2, 0x05, 0x40, 0x08,
-    0xba, 0x01, 0x80, 0x00, 0x09, 0x01, 0x40, 0x1b, 0xb8, 0x01, 0x80, 0xb0, 0x02, 0x43, 0x52, 0x58,
-    0xb2, 0x05, 0x40, 0x08, 0xb8, 0x02, 0x00, 0xb1, 0x09, 0x40, 0x1b, 0xb2, 0x05, 0x40, 0x08, 0xba,
-    0x01, 0x00, 0x00, 0x09, 0x01, 0x00, 0x59, 0x59, 0x59, 0xb8, 0x40, 0x00, 0xb0, 0x80, 0x88, 0x55,
-    0xb9, 0x40, 0x00, 0x02, 0x00, 0x63, 0xb8, 0x04, 0x00, 0x88, 0x55, 0x5a, 0x58, 0xb3, 0x0c, 0x00,
-    0x0d, 0x01, 0x1b, 0xb3, 0x0c, 0x00, 0x0d, 0x01, 0x59, 0x59, 0x59, 0x42, 0x42, 0x42, 0x42, 0x42,
-    0x2d, 0x2c, 0x45, 0xb1, 0x02, 0x4e, 0x2b, 0x23, 0xb0, 0x4f, 0x2b, 0x20, 0xb0, 0x40, 0x51, 0x58,
-    0x21, 0x4b, 0x51, 0x58, 0xb0, 0x02, 0x25, 0x45, 0xb1, 0x01, 0x4e, 0x2b, 0x60, 0x59, 0x1b, 0x23,
-    0x4b, 0x51, 0x58, 0xb0, 0x03, 0x25, 0x45, 0x20, 0x64, 0x8a, 0x63, 0xb0, 0x40, 0x53, 0x58, 0xb1,
-    0x02, 0x4e, 0x2b, 0x60, 0x1b, 0x21, 0x59, 0x1b, 0x21, 0x59, 0x59, 0x44, 0x2d, 0x2c, 0x20, 0xb0,
-    0x00, 0x50, 0x20, 0x58, 0x23, 0x65, 0x1b, 0x23, 0x59, 0xb1, 0x14, 0x14, 0x8a, 0x70, 0x45, 0xb0,
-    0x4f, 0x2b, 0x23, 0xb1, 0x61, 0x06, 0x26, 0x60, 0x2b, 0x8a, 0x58, 0xb0, 0x05, 0x43, 0x8b, 0x59,
-    0x23, 0x58, 0x65, 0x59, 0x23, 0x10, 0x3a, 0x2d, 0x2c, 0xb0, 0x03, 0x25, 0x49, 0x63, 0x23, 0x46,
-    0x60, 0xb0, 0x4f, 0x2b, 0x23, 0xb0, 0x04, 0x25, 0xb0, 0x04, 0x25, 0x49, 0xb0, 0x03, 0x25, 0x63,
-    0x56, 0x20, 0x60, 0xb0, 0x62, 0x60, 0x2b, 0xb0, 0x03, 0x25, 0x20, 0x10, 0x46, 0x8a, 0x46, 0x60,
-    0xb0, 0x20, 0x63, 0x61, 0x3a, 0x2d, 0x2c, 0xb0, 0x00, 0x16, 0xb1, 0x02, 0x03, 0x25, 0xb1, 0x01,
-    0x04, 0x25, 0x01, 0x3e, 0x00, 0x3e, 0xb1, 0x01, 0x02, 0x06, 0x0c, 0xb0, 0x0a, 0x23, 0x65, 0x42,
-    0xb0, 0x0b, 0x23, 0x42, 0xb1, 0x02, 0x03, 0x25, 0xb1, 0x01, 0x04, 0x25, 0x01, 0x3f, 0x00, 0x3f,
-    0xb1, 0x01, 0x02, 0x06, 0x0c, 0xb0, 0x06, 0x23, 0x65, 0x42, 0xb0, 0x07, 0x23, 0x42, 0xb0, 0x01,
-    0x16, 0xb1, 0x00, 0x02, 0x43, 0x54, 0x58, 0x45, 0x23, 0x45, 0x20, 0x18, 0x69, 0x8a, 0x63, 0x23,
-    0x62, 0x20, 0x20, 0xb0, 0x40, 0x50, 0x58, 0x67, 0x1b, 0x66, 0x59, 0x61, 0xb0, 0x20, 0x63, 0xb0,
-    0x40, 0x23, 0x61, 0xb0, 0x04, 0x23, 0x42, 0x1b, 0xb1, 0x04, 0x00, 0x42, 0x21, 0x21, 0x59, 0x18,
-    0x01, 0x2d, 0x2c, 0x20, 0x45, 0xb1, 0x00, 0x4e, 0x2b, 0x44, 0x2d, 0x2c, 0x4b, 0x51, 0xb1, 0x40,
-    0x4f, 0x2b, 0x50, 0x5b, 0x58, 0x20, 0x45, 0xb1, 0x01, 0x4e, 0x2b, 0x20, 0x8a, 0x8a, 0x44, 0x20,
-    0xb1, 0x40, 0x04, 0x26, 0x61, 0x63, 0x61, 0xb1, 0x01, 0x4e, 0x2b, 0x44, 0x21, 0x1b, 0x23, 0x21,
-    0x8a, 0x45, 0xb1, 0x01, 0x4e, 0x2b, 0x20, 0x8a, 0x23, 0x44, 0x44, 0x59, 0x2d, 0x2c, 0x4b, 0x51,
-    0xb1, 0x40, 0x4f, 0x2b, 0x50, 0x5b, 0x58, 0x45, 0x20, 0x8a, 0xb0, 0x40, 0x61, 0x63, 0x60, 0x1b,
-    0x23, 0x21, 0x45, 0x59, 0xb1, 0x01, 0x4e, 0x2b, 0x44, 0x2d, 0x2c, 0x23, 0x45, 0x20, 0x8a, 0x45,
-    0x23, 0x61, 0x20, 0x64, 0xb0, 0x40, 0x51, 0xb0, 0x04, 0x25, 0x20, 0xb0, 0x00, 0x53, 0x23, 0xb0,
-    0x40, 0x51, 0x5a, 0x5a, 0xb1, 0x40, 0x4f, 0x2b, 0x54, 0x5a, 0x58, 0x8a, 0x0c, 0x64, 0x23, 0x64,
-    0x23, 0x53, 0x58, 0xb1, 0x40, 0x40, 0x8a, 0x61, 0x20, 0x63, 0x61, 0x1b, 0x20, 0x63, 0x59, 0x1b,
-    0x8a, 0x59, 0x63, 0xb1, 0x02, 0x4e, 0x2b, 0x60, 0x44, 0x2d, 0x2c, 0x01, 0x2d, 0x2c, 0x00, 0x2d,
-    0x2c, 0x05, 0xb1, 0x0b, 0x0a, 0x43, 0x23, 0x43, 0x65, 0x0a, 0x2d, 0x2c, 0xb1, 0x0a, 0x0b, 0x43,
-    0x23, 0x43, 0x0b, 0x02, 0x2d, 0x2c, 0xb0, 0x02, 0x25, 0x63, 0x66, 0xb0, 0x02, 0x25, 0xb8, 0x20,
-    0x00, 0x62, 0x60, 0x23, 0x62, 0x2d, 0x2c, 0xb0, 0x02, 0x25, 0x63, 0xb0, 0x20, 0x60, 0x66, 0xb0,
-    0x02, 0x25, 0xb8, 0x20, 0x00, 0x62, 0x60, 0x23, 0x62, 0x2d, 0x2c, 0xb0, 0x02, 0x25, 0x63, 0x67,
-    0xb0, 0x02, 0x25, 0xb8, 0x20, 0x00, 0x62, 0x60, 0x23, 0x62, 0x2d, 0x2c, 0xb0, 0x02, 0x25, 0x63,
-    0x66, 0xb0, 0x20, 0x60, 0xb0, 0x02, 0x25, 0xb8, 0x20, 0x00, 0x62, 0x60, 0x23, 0x62, 0x2d, 0x2c,
-    0x23, 0x4a, 0xb1, 0x02, 0x4e, 0x2b, 0x2d, 0x2c, 0x23, 0x4a, 0xb1, 0x01, 0x4e, 0x2b, 0x2d, 0x2c,
-    0x23, 0x8a, 0x4a, 0x23, 0x45, 0x64, 0xb0, 0x02, 0x25, 0x64, 0xb0, 0x02, 0x25, 0x61, 0x64, 0xb0,
-    0x03, 0x43, 0x52, 0x58, 0x21, 0x20, 0x64, 0x59, 0xb1, 0x02, 0x4e, 0x2b, 0x23, 0xb0, 0x00, 0x50,
-    0x58, 0x65, 0x59, 0x2d, 0x2c, 0x23, 0x8a, 0x4a, 0x23, 0x45, 0x64, 0xb0, 0x02, 0x25, 0x64, 0xb0,
-    0x02, 0x25, 0x61, 0x64, 0xb0, 0x03, 0x43, 0x52, 0x58, 0x21, 0x20, 0x64, 0x59, 0xb1, 0x01, 0x4e,
-    0x2b, 0x23, 0xb0, 0x00, 0x50, 0x58, 0x65, 0x59, 0x2d, 0x2c, 0x20, 0xb0, 0x03, 0x25, 0x4a, 0xb1,
-    0x02, 0x4e, 0x2b, 0x8a, 0x10, 0x3b, 0x2d, 0x2c, 0x20, 0xb0, 0x03, 0x25, 0x4a, 0xb1, 0x01, 0x4e,
-    0x2b, 0x8a, 0x10, 0x3b, 0x2d, 0x2c, 0xb0, 0x03, 0x25, 0xb0, 0x03, 0x25, 0x8a, 0xb0, 0x67, 0x2b,
-    0x8a, 0x10, 0x3b, 0x2d, 0x2c, 0xb0, 0x03, 0x25, 0xb0, 0x03, 0x25, 0x8a, 0xb0, 0x68, 0x2b, 0x8a,
-    0x10, 0x3b, 0x2d, 0x2c, 0xb0, 0x03, 0x25, 0x46, 0xb0, 0x03, 0x25, 0x46, 0x60, 0xb0, 0x04, 0x25,
-    0x2e, 0xb0, 0x04, 0x25, 0xb0, 0x04, 0x25, 0xb0, 0x04, 0x26, 0x20, 0xb0, 0x00, 0x50, 0x58, 0x21,
-    0xb0, 0x6a, 0x1b, 0xb0, 0x6c, 0x59, 0x2b, 0xb0, 0x03, 0x25, 0x46, 0xb0, 0x03, 0x25, 0x46, 0x60,
-    0x61, 0xb0, 0x80, 0x62, 0x20, 0x8a, 0x20, 0x10, 0x23, 0x3a, 0x23, 0x20, 0x10, 0x23, 0x3a, 0x2d,
-    0x2c, 0xb0, 0x03, 0x25, 0x47, 0xb0, 0x03, 0x25, 0x47, 0x60, 0xb0, 0x05, 0x25, 0x47, 0xb0, 0x80,
-    0x63, 0x61, 0xb0, 0x02, 0x25, 0xb0, 0x06, 0x25, 0x49, 0x63, 0x23, 0xb0, 0x05, 0x25, 0x4a, 0xb0,
-    0x80, 0x63, 0x20, 0x58, 0x62, 0x1b, 0x21, 0x59, 0xb0, 0x04, 0x26, 0x46, 0x60, 0x8a, 0x46, 0x8a,
-    0x46, 0x60, 0xb0, 0x20, 0x63, 0x61, 0x2d, 0x2c, 0xb0, 0x04, 0x26, 0xb0, 0x04, 0x25, 0xb0, 0x04,
-    0x25, 0xb0, 0x04, 0x26, 0xb0, 0x6e, 0x2b, 0x20, 0x8a, 0x20, 0x10, 0x23, 0x3a, 0x23, 0x20, 0x10,
-    0x23, 0x3a, 0x2d, 0x2c, 0x23, 0x20, 0xb0, 0x01, 0x54, 0x58, 0x21, 0xb0, 0x02, 0x25, 0xb1, 0x02,
-    0x4e, 0x2b, 0xb0, 0x80, 0x50, 0x20, 0x60, 0x59, 0x20, 0x60, 0x60, 0x20, 0xb0, 0x01, 0x51, 0x58,
-    0x21, 0x21, 0x1b, 0x20, 0xb0, 0x05, 0x51, 0x58, 0x21, 0x20, 0x66, 0x61, 0xb0, 0x40, 0x23, 0x61,
-    0xb1, 0x00, 0x03, 0x25, 0x50, 0xb0, 0x03, 0x25, 0xb0, 0x03, 0x25, 0x50, 0x5a, 0x58, 0x20, 0xb0,
-    0x03, 0x25, 0x61, 0x8a, 0x53, 0x58, 0x21, 0xb0, 0x00, 0x59, 0x1b, 0x21, 0x59, 0x1b, 0xb0, 0x07,
-    0x54, 0x58, 0x20, 0x66, 0x61, 0x65, 0x23, 0x21, 0x1b, 0x21, 0x21, 0xb0, 0x00, 0x59, 0x59, 0x59,
-    0xb1, 0x02, 0x4e, 0x2b, 0x2d, 0x2c, 0xb0, 0x02, 0x25, 0xb0, 0x04, 0x25, 0x4a, 0xb0, 0x00, 0x53,
-    0x58, 0xb0, 0x00, 0x1b, 0x8a, 0x8a, 0x23, 0x8a, 0xb0, 0x01, 0x59, 0xb0, 0x04, 0x25, 0x46, 0x20,
-    0x66, 0x61, 0x20, 0xb0, 0x05, 0x26, 0xb0, 0x06, 0x26, 0x49, 0xb0, 0x05, 0x26, 0xb0, 0x05, 0x26,
-    0xb0, 0x70, 0x2b, 0x23, 0x61, 0x65, 0xb0, 0x20, 0x60, 0x20, 0x66, 0x61, 0xb0, 0x20, 0x61, 0x65,
-    0x2d, 0x2c, 0xb0, 0x02, 0x25, 0x46, 0x20, 0x8a, 0x20, 0xb0, 0x00, 0x50, 0x58, 0x21, 0xb1, 0x02,
-    0x4e, 0x2b, 0x1b, 0x45, 0x23, 0x21, 0x59, 0x61, 0x65, 0xb0, 0x02, 0x25, 0x10, 0x3b, 0x2d, 0x2c,
-    0xb0, 0x04, 0x26, 0x20, 0xb8, 0x02, 0x00, 0x62, 0x20, 0xb8, 0x02, 0x00, 0x63, 0x8a, 0x23, 0x61,
-    0x20, 0xb0, 0x5d, 0x60, 0x2b, 0xb0, 0x05, 0x25, 0x11, 0x8a, 0x12, 0x8a, 0x20, 0x39, 0x8a, 0x58,
-    0xb9, 0x00, 0x5d, 0x10, 0x00, 0xb0, 0x04, 0x26, 0x63, 0x56, 0x60, 0x2b, 0x23, 0x21, 0x20, 0x10,
-    0x20, 0x46, 0x20, 0xb1, 0x02, 0x4e, 0x2b, 0x23, 0x61, 0x1b, 0x23, 0x21, 0x20, 0x8a, 0x20, 0x10,
-    0x49, 0xb1, 0x02, 0x4e, 0x2b, 0x59, 0x3b, 0x2d, 0x2c, 0xb9, 0x00, 0x5d, 0x10, 0x00, 0xb0, 0x09,
-    0x25, 0x63, 0x56, 0x60, 0x2b, 0xb0, 0x05, 0x25, 0xb0, 0x05, 0x25, 0xb0, 0x05, 0x26, 0xb0, 0x6d,
-    0x2b, 0xb1, 0x5d, 0x07, 0x25, 0x60, 0x2b, 0xb0, 0x05, 0x25, 0xb0, 0x05, 0x25, 0xb0, 0x05, 0x25,
-    0xb0, 0x05, 0x25, 0xb0, 0x6f, 0x2b, 0xb9, 0x00, 0x5d, 0x10, 0x00, 0xb0, 0x08, 0x26, 0x63, 0x56,
-    0x60, 0x2b, 0x20, 0xb0, 0x00, 0x52, 0x58, 0xb0, 0x50, 0x2b, 0xb0, 0x05, 0x25, 0xb0, 0x05, 0x25,
-    0xb0, 0x07, 0x25, 0xb0, 0x07, 0x25, 0xb0, 0x05, 0x25, 0xb0, 0x71, 0x2b, 0xb0, 0x02, 0x17, 0x38,
-    0xb0, 0x00, 0x52, 0xb0, 0x02, 0x25, 0xb0, 0x01, 0x52, 0x5a, 0x58, 0xb0, 0x04, 0x25, 0xb0, 0x06,
-    0x25, 0x49, 0xb0, 0x03, 0x25, 0xb0, 0x05, 0x25, 0x49, 0x60, 0x20, 0xb0, 0x40, 0x52, 0x58, 0x21,
-    0x1b, 0xb0, 0x00, 0x52, 0x58, 0x20, 0xb0, 0x02, 0x54, 0x58, 0xb0, 0x04, 0x25, 0xb0, 0x04, 0x25,
-    0xb0, 0x07, 0x25, 0xb0, 0x07, 0x25, 0x49, 0xb0, 0x02, 0x17, 0x38, 0x1b, 0xb0, 0x04, 0x25, 0xb0,
-    0x04, 0x25, 0xb0, 0x04, 0x25, 0xb0, 0x06, 0x25, 0x49, 0xb0, 0x02, 0x17, 0x38, 0x59, 0x59, 0x59,
-    0x59, 0x59, 0x21, 0x21, 0x21, 0x21, 0x21, 0x2d, 0x2c, 0xb9, 0x00, 0x5d, 0x10, 0x00, 0xb0, 0x0b,
-    0x25, 0x63, 0x56, 0x60, 0x2b, 0xb0, 0x07, 0x25, 0xb0, 0x07, 0x25, 0xb0, 0x06, 0x25, 0xb0, 0x06,
-    0x25, 0xb0, 0x0c, 0x25, 0xb0, 0x0c, 0x25, 0xb0, 0x09, 0x25, 0xb0, 0x08, 0x25, 0xb0, 0x6e, 0x2b,
-    0xb0, 0x04, 0x17, 0x38, 0xb0, 0x07, 0x25, 0xb0, 0x07, 0x25, 0xb0, 0x07, 0x26, 0xb0, 0x6d, 0x2b,
-    0xb0, 0x04, 0x25, 0xb0, 0x04, 0x25, 0xb0, 0x04, 0x26, 0xb0, 0x6d, 0x2b, 0xb0, 0x50, 0x2b, 0xb0,
-    0x06, 0x25, 0xb0, 0x06, 0x25, 0xb0, 0x03, 0x25, 0xb0, 0x71, 0x2b, 0xb0, 0x05, 0x25, 0xb0, 0x05,
-    0x25, 0xb0, 0x03, 0x25, 0xb0, 0x02, 0x17, 0x38, 0x20, 0xb0, 0x06, 0x25, 0xb0, 0x06, 0x25, 0xb0,
-    0x05, 0x25, 0xb0, 0x71, 0x2b, 0x60, 0xb0, 0x06, 0x25, 0xb0, 0x06, 0x25, 0xb0, 0x04, 0x25, 0x65,
-    0xb0, 0x02, 0x17, 0x38, 0xb0, 0x02, 0x25, 0xb0, 0x02, 0x25, 0x60, 0x20, 0xb0, 0x40, 0x53, 0x58,
-    0x21, 0xb0, 0x40, 0x61, 0x23, 0xb0, 0x40, 0x61, 0x23, 0x1b, 0xb8, 0xff, 0xc0, 0x50, 0x58, 0xb0,
-    0x40, 0x60, 0x23, 0xb0, 0x40, 0x60, 0x23, 0x59, 0x59, 0xb0, 0x08, 0x25, 0xb0, 0x08, 0x25, 0xb0,
-    0x04, 0x26, 0xb0, 0x02, 0x17, 0x38, 0xb0, 0x05, 0x25, 0xb0, 0x05, 0x25, 0x8a, 0xb0, 0x02, 0x17,
-    0x38, 0x20, 0xb0, 0x00, 0x52, 0x58, 0xb0, 0x06, 0x25, 0xb0, 0x08, 0x25, 0x49, 0xb0, 0x03, 0x25,
-    0xb0, 0x05, 0x25, 0x49, 0x60, 0x20, 0xb0, 0x40, 0x52, 0x58, 0x21, 0x1b, 0xb0, 0x00, 0x52, 0x58,
-    0xb0, 0x06, 0x25, 0xb0, 0x06, 0x25, 0xb0, 0x06, 0x25, 0xb0, 0x06, 0x25, 0xb0, 0x0b, 0x25, 0xb0,
-    0x0b, 0x25, 0x49, 0xb0, 0x04, 0x17, 0x38, 0xb0, 0x06, 0x25, 0xb0, 0x06, 0x25, 0xb0, 0x06, 0x25,
-    0xb0, 0x06, 0x25, 0xb0, 0x0a, 0x25, 0xb0, 0x0a, 0x25, 0xb0, 0x07, 0x25, 0xb0, 0x71, 0x2b, 0xb0,
-    0x04, 0x17, 0x38, 0xb0, 0x04, 0x25, 0xb0, 0x04, 0x25, 0xb0, 0x05, 0x25, 0xb0, 0x07, 0x25, 0xb0,
-    0x05, 0x25, 0xb0, 0x71, 0x2b, 0xb0, 0x02, 0x17, 0x38, 0x1b, 0xb0, 0x04, 0x25, 0xb0, 0x04, 0x25,
-    0xb8, 0xff, 0xc0, 0xb0, 0x02, 0x17, 0x38, 0x59, 0x59, 0x59, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21,
-    0x21, 0x21, 0x2d, 0x2c, 0xb0, 0x04, 0x25, 0xb0, 0x03, 0x25, 0x87, 0xb0, 0x03, 0x25, 0xb0, 0x03,
-    0x25, 0x8a, 0x20, 0xb0, 0x00, 0x50, 0x58, 0x21, 0xb0, 0x65, 0x1b, 0xb0, 0x68, 0x59, 0x2b, 0x64,
-    0xb0, 0x04, 0x25, 0xb0, 0x04, 0x25, 0x06, 0xb0, 0x04, 0x25, 0xb0, 0x04, 0x25, 0x49, 0x20, 0x20,
-    0x63, 0xb0, 0x03, 0x25, 0x20, 0x63, 0x51, 0xb1, 0x00, 0x03, 0x25, 0x54, 0x5b, 0x58, 0x21, 0x21,
-    0x23, 0x21, 0x07, 0x1b, 0x20, 0x63, 0xb0, 0x02, 0x25, 0x20, 0x63, 0x61, 0x20, 0xb0, 0x53, 0x2b,
-    0x8a, 0x63, 0xb0, 0x05, 0x25, 0xb0, 0x05, 0x25, 0x87, 0xb0, 0x04, 0x25, 0xb0, 0x04, 0x26, 0x4a,
-    0xb0, 0x00, 0x50, 0x58, 0x65, 0x59, 0xb0, 0x04, 0x26, 0x20, 0x01, 0x46, 0x23, 0x00, 0x46, 0xb0,
-    0x05, 0x26, 0x20, 0x01, 0x46, 0x23, 0x00, 0x46, 0xb0, 0x00, 0x16, 0x00, 0xb0, 0x00, 0x23, 0x48,
-    0x01, 0xb0, 0x00, 0x23, 0x48, 0x00, 0x20, 0xb0, 0x01, 0x23, 0x48, 0xb0, 0x02, 0x23, 0x48, 0x01,
-    0x20, 0xb0, 0x01, 0x23, 0x48, 0xb0, 0x02, 0x23, 0x48, 0x23, 0xb2, 0x02, 0x00, 0x01, 0x08, 0x23,
-    0x38, 0xb2, 0x02, 0x00, 0x01, 0x09, 0x23, 0x38, 0xb1, 0x02, 0x01, 0x07, 0xb0, 0x01, 0x16, 0x59,
-    0x2d, 0x2c, 0x23, 0x10, 0x0d, 0x0c, 0x8a, 0x63, 0x23, 0x8a, 0x63, 0x60, 0x64, 0xb9, 0x40, 0x00,
-    0x04, 0x00, 0x63, 0x50, 0x58, 0xb0, 0x00, 0x38, 0x1b, 0x3c, 0x59, 0x2d, 0x2c, 0xb0, 0x06, 0x25,
-    0xb0, 0x09, 0x25, 0xb0, 0x09, 0x25, 0xb0, 0x07, 0x26, 0xb0, 0x76, 0x2b, 0x23, 0xb0, 0x00, 0x54,
-    0x58, 0x05, 0x1b, 0x04, 0x59, 0xb0, 0x04, 0x25, 0xb0, 0x06, 0x26, 0xb0, 0x77, 0x2b, 0xb0, 0x05,
-    0x25, 0xb0, 0x05, 0x26, 0xb0, 0x05, 0x25, 0xb0, 0x05, 0x26, 0xb0, 0x76, 0x2b, 0xb0, 0x00, 0x54,
-    0x58, 0x05, 0x1b, 0x04, 0x59, 0xb0, 0x77, 0x2b, 0x2d, 0x2c, 0xb0, 0x07, 0x25, 0xb0, 0x0a, 0x25,
-    0xb0, 0x0a, 0x25, 0xb0, 0x08, 0x26, 0xb0, 0x76, 0x2b, 0x8a, 0xb0, 0x00, 0x54, 0x58, 0x05, 0x1b,
-    0x04, 0x59, 0xb0, 0x05, 0x25, 0xb0, 0x07, 0x26, 0xb0, 0x77, 0x2b, 0xb0, 0x06, 0x25, 0xb0, 0x06,
-    0x26, 0xb0, 0x06, 0x25, 0xb0, 0x06, 0x26, 0xb0, 0x76, 0x2b, 0x08, 0xb0, 0x77, 0x2b, 0x2d, 0x2c,
-    0xb0, 0x07, 0x25, 0xb0, 0x0a, 0x25, 0xb0, 0x0a, 0x25, 0xb0, 0x08, 0x26, 0xb0, 0x76, 0x2b, 0x8a,
-    0x8a, 0x08, 0xb0, 0x04, 0x25, 0xb0, 0x06, 0x26, 0xb0, 0x77, 0x2b, 0xb0, 0x05, 0x25, 0xb0, 0x05,
-    0x26, 0xb0, 0x05, 0x25, 0xb0, 0x05, 0x26, 0xb0, 0x76, 0x2b, 0xb0, 0x00, 0x54, 0x58, 0x05, 0x1b,
-    0x04, 0x59, 0xb0, 0x77, 0x2b, 0x2d, 0x2c, 0xb0, 0x08, 0x25, 0xb0, 0x0b, 0x25, 0xb0, 0x0b, 0x25,
-    0xb0, 0x09, 0x26, 0xb0, 0x76, 0x2b, 0xb0, 0x04, 0x26, 0xb0, 0x04, 0x26, 0x08, 0xb0, 0x05, 0x25,
-    0xb0, 0x07, 0x26, 0xb0, 0x77, 0x2b, 0xb0, 0x06, 0x25, 0xb0, 0x06, 0x26, 0xb0, 0x06, 0x25, 0xb0,
-    0x06, 0x26, 0xb0, 0x76, 0x2b, 0x08, 0xb0, 0x77, 0x2b, 0x2d, 0x2c, 0x03, 0xb0, 0x03, 0x25, 0xb0,
-    0x03, 0x25, 0x4a, 0xb0, 0x04, 0x25, 0xb0, 0x03, 0x25, 0x4a, 0x02, 0xb0, 0x05, 0x25, 0xb0, 0x05,
-    0x26, 0x4a, 0xb0, 0x05, 0x26, 0xb0, 0x05, 0x26, 0x4a, 0xb0, 0x04, 0x26, 0x63, 0x8a, 0x8a, 0x63,
-    0x61, 0x2d, 0x2c, 0xb1, 0x5d, 0x0e, 0x25, 0x60, 0x2b, 0xb0, 0x0c, 0x26, 0x11, 0xb0, 0x05, 0x26,
-    0x12, 0xb0, 0x0a, 0x25, 0x39, 0xb0, 0x07, 0x25, 0x39, 0xb0, 0x0a, 0x25, 0xb0, 0x0a, 0x25, 0xb0,
-    0x09, 0x25, 0xb0, 0x7c, 0x2b, 0xb0, 0x00, 0x50, 0xb0, 0x0b, 0x25, 0xb0, 0x08, 0x25, 0xb0, 0x0a,
-    0x25, 0xb0, 0x7c, 0x2b, 0xb0, 0x00, 0x50, 0x54, 0x58, 0xb0, 0x07, 0x25, 0xb0, 0x0b, 0x25, 0x87,
-    0xb0, 0x04, 0x25, 0xb0, 0x04, 0x25, 0x0b, 0xb0, 0x0a, 0x25, 0x10, 0xb0, 0x09, 0x25, 0xc1, 0xb0,
-    0x02, 0x25, 0xb0, 0x02, 0x25, 0x0b, 0xb0, 0x07, 0x25, 0x10, 0xb0, 0x06, 0x25, 0xc1, 0x1b, 0xb0,
-    0x07, 0x25, 0xb0, 0x0b, 0x25, 0xb0, 0x0b, 0x25, 0xb8, 0xff, 0xff, 0xb0, 0x76, 0x2b, 0xb0, 0x04,
-    0x25, 0xb0, 0x04, 0x25, 0x0b, 0xb0, 0x07, 0x25, 0xb0, 0x0a, 0x25, 0xb0, 0x77, 0x2b, 0xb0, 0x0a,
-    0x25, 0xb0, 0x08, 0x25, 0xb0, 0x08, 0x25, 0xb8, 0xff, 0xff, 0xb0, 0x76, 0x2b, 0xb0, 0x02, 0x25,
-    0xb0, 0x02, 0x25, 0x0b, 0xb0, 0x0a, 0x25, 0xb0, 0x07, 0x25, 0xb0, 0x77, 0x2b, 0x59, 0xb0, 0x0a,
-    0x25, 0x46, 0xb0, 0x0a, 0x25, 0x46, 0x60, 0xb0, 0x08, 0x25, 0x46, 0xb0, 0x08, 0x25, 0x46, 0x60,
-    0xb0, 0x06, 0x25, 0xb0, 0x06, 0x25, 0x0b, 0xb0, 0x0c, 0x25, 0xb0, 0x0c, 0x25, 0xb0, 0x0c, 0x26,
-    0x20, 0xb0, 0x00, 0x50, 0x58, 0x21, 0xb0, 0x6a, 0x1b, 0xb0, 0x6c, 0x59, 0x2b, 0xb0, 0x04, 0x25,
-    0xb0, 0x04, 0x25, 0x0b, 0xb0, 0x09, 0x25, 0xb0, 0x09, 0x25, 0xb0, 0x09, 0x26, 0x20, 0xb0, 0x00,
-    0x50, 0x58, 0x21, 0xb0, 0x6a, 0x1b, 0xb0, 0x6c, 0x59, 0x2b, 0x23, 0xb0, 0x0a, 0x25, 0x46, 0xb0,
-    0x0a, 0x25, 0x46, 0x60, 0x61, 0xb0, 0x20, 0x63, 0x23, 0xb0, 0x08, 0x25, 0x46, 0xb0, 0x08, 0x25,
-    0x46, 0x60, 0x61, 0xb0, 0x20, 0x63, 0xb1, 0x01, 0x0c, 0x25, 0x54, 0x58, 0x04, 0x1b, 0x05, 0x59,
-    0xb0, 0x0a, 0x26, 0x20, 0x10, 0xb0, 0x03, 0x25, 0x3a, 0xb0, 0x06, 0x26, 0xb0, 0x06, 0x26, 0x0b,
-    0xb0, 0x07, 0x26, 0x20, 0x10, 0x8a, 0x3a, 0xb1, 0x01, 0x07, 0x26, 0x54, 0x58, 0x04, 0x1b, 0x05,
-    0x59, 0xb0, 0x05, 0x26, 0x20, 0x10, 0xb0, 0x02, 0x25, 0x3a, 0x8a, 0x8a, 0x0b, 0x23, 0x20, 0x10,
-    0x23, 0x3a, 0x2d, 0x2c, 0x23, 0xb0, 0x01, 0x54, 0x58, 0xb9, 0x00, 0x00, 0x40, 0x00, 0x1b, 0xb8,
-    0x40, 0x00, 0xb0, 0x00, 0x59, 0x8a, 0xb0, 0x01, 0x54, 0x58, 0xb9, 0x00, 0x00, 0x40, 0x00, 0x1b,
-    0xb8, 0x40, 0x00, 0xb0, 0x00, 0x59, 0xb0, 0x7d, 0x2b, 0x2d, 0x2c, 0x8a, 0x8a, 0x08, 0x0d, 0x8a,
-    0xb0, 0x01, 0x54, 0x58, 0xb9, 0x00, 0x00, 0x40, 0x00, 0x1b, 0xb8, 0x40, 0x00, 0xb0, 0x00, 0x59,
-    0xb0, 0x7d, 0x2b, 0x2d, 0x2c, 0x08, 0xb0, 0x01, 0x54, 0x58, 0xb9, 0x00, 0x00, 0x40, 0x00, 0x1b,
-    0xb8, 0x40, 0x00, 0xb0, 0x00, 0x59, 0x0d, 0xb0, 0x7d, 0x2b, 0x2d, 0x2c, 0xb0, 0x04, 0x26, 0xb0,
-    0x04, 0x26, 0x08, 0x0d, 0xb0, 0x04, 0x26, 0xb0, 0x04, 0x26, 0x08, 0x0d, 0xb0, 0x7d, 0x2b, 0x2d,
-    0x2c, 0x20, 0x01, 0x46, 0x23, 0x00, 0x46, 0xb0, 0x0a, 0x43, 0xb0, 0x0b, 0x43, 0x8a, 0x63, 0x23,
-    0x62, 0x61, 0x2d, 0x2c, 0xb0, 0x09, 0x2b, 0xb0, 0x06, 0x25, 0x2e, 0xb0, 0x05, 0x25, 0x7d, 0xc5,
-    0xb0, 0x06, 0x25, 0xb0, 0x05, 0x25, 0xb0, 0x04, 0x25, 0x20, 0xb0, 0x00, 0x50, 0x58, 0x21, 0xb0,
-    0x6a, 0x1b, 0xb0, 0x6c, 0x59, 0x2b, 0xb0, 0x05, 0x25, 0xb0, 0x04, 0x25, 0xb0, 0x03, 0x25, 0x20,
-    0xb0, 0x00, 0x50, 0x58, 0x21, 0xb0, 0x6a, 0x1b, 0xb0, 0x6c, 0x59, 0x2b, 0x18, 0xb0, 0x08, 0x25,
-    0xb0, 0x07, 0x25, 0xb0, 0x06, 0x25, 0xb0, 0x0a, 0x25, 0xb0, 0x6f, 0x2b, 0xb0, 0x06, 0x25, 0xb0,
-    0x05, 0x25, 0xb0, 0x04, 0x26, 0x20, 0xb0, 0x00, 0x50, 0x58, 0x21, 0xb0, 0x66, 0x1b, 0xb0, 0x68,
-    0x59, 0x2b, 0xb0, 0x05, 0x25, 0xb0, 0x04, 0x25, 0xb0, 0x04, 0x26, 0x20, 0xb0, 0x00, 0x50, 0x58,
-    0x21, 0xb0, 0x66, 0x1b, 0xb0, 0x68, 0x59, 0x2b, 0x54, 0x58, 0x7d, 0xb0, 0x04, 0x25, 0x10, 0xb0,
-    0x03, 0x25, 0xc5, 0xb0, 0x02, 0x25, 0x10, 0xb0, 0x01, 0x25, 0xc5, 0xb0, 0x05, 0x26, 0x21, 0xb0,
-    0x05, 0x26, 0x21, 0x1b, 0xb0, 0x06, 0x26, 0xb0, 0x04, 0x25, 0xb0, 0x03, 0x25, 0xb0, 0x08, 0x26,
-    0xb0, 0x6f, 0x2b, 0x59, 0xb1, 0x00, 0x02, 0x43, 0x54, 0x58, 0x7d, 0xb0, 0x02, 0x25, 0xb0, 0x82,
-    0x2b, 0xb0, 0x05, 0x25, 0xb0, 0x82, 0x2b, 0x20, 0x20, 0x69, 0x61, 0xb0, 0x04, 0x43, 0x01, 0x23,
-    0x61, 0xb0, 0x60, 0x60, 0x20, 0x69, 0x61, 0xb0, 0x20, 0x61, 0x20, 0xb0, 0x08, 0x26, 0xb0, 0x08,
-    0x26, 0x8a, 0xb0, 0x02, 0x17, 0x38, 0x8a, 0x8a, 0x61, 0x20, 0x69, 0x61, 0x61, 0xb0, 0x02, 0x17,
-    0x38, 0x1b, 0x21, 0x21, 0x21, 0x21, 0x59, 0x18, 0x2d, 0x2c, 0x4b, 0x52, 0xb1, 0x01, 0x02, 0x43,
-    0x53, 0x5a, 0x58, 0x23, 0x10, 0x20, 0x01, 0x3c, 0x00, 0x3c, 0x1b, 0x21, 0x21, 0x59, 0x2d, 0x2c,
-    0x23, 0xb0, 0x02, 0x25, 0xb0, 0x02, 0x25, 0x53, 0x58, 0x20, 0xb0, 0x04, 0x25, 0x58, 0x3c, 0x1b,
-    0x39, 0x59, 0xb0, 0x01, 0x60, 0xb8, 0xff, 0xe9, 0x1c, 0x59, 0x21, 0x21, 0x21, 0x2d, 0x2c, 0xb0,
-    0x02, 0x25, 0x47, 0xb0, 0x02, 0x25, 0x47, 0x54, 0x8a, 0x20, 0x20, 0x10, 0x11, 0xb0, 0x01, 0x60,
-    0x8a, 0x20, 0x12, 0xb0, 0x01, 0x61, 0xb0, 0x85, 0x2b, 0x2d, 0x2c, 0xb0, 0x04, 0x25, 0x47, 0xb0,
-    0x02, 0x25, 0x47, 0x54, 0x23, 0x20, 0x12, 0xb0, 0x01, 0x61, 0x23, 0x20, 0xb0, 0x06, 0x26, 0x20,
-    0x20, 0x10, 0x11, 0xb0, 0x01, 0x60, 0xb0, 0x06, 0x26, 0xb0, 0x85, 0x2b, 0x8a, 0x8a, 0xb0, 0x85,
-    0x2b, 0x2d, 0x2c, 0xb0, 0x02, 0x43, 0x54, 0x58, 0x0c, 0x02, 0x8a, 0x4b, 0x53, 0xb0, 0x04, 0x26,
-    0x4b, 0x51, 0x5a, 0x58, 0x0a, 0x38, 0x1b, 0x0a, 0x21, 0x21, 0x59, 0x1b, 0x21, 0x21, 0x21, 0x21,
-    0x59, 0x2d, 0x2c, 0xb0, 0x98, 0x2b, 0x58, 0x0c, 0x02, 0x8a, 0x4b, 0x53, 0xb0, 0x04, 0x26, 0x4b,
-    0x51, 0x5a, 0x58, 0x0a, 0x38, 0x1b, 0x0a, 0x21, 0x21, 0x59, 0x1b, 0x21, 0x21, 0x21, 0x21, 0x59,
-    0x2d, 0x2c, 0x20, 0xb0, 0x02, 0x43, 0x54, 0xb0, 0x01, 0x23, 0xb8, 0x00, 0x68, 0x23, 0x78, 0x21,
-    0xb1, 0x00, 0x02, 0x43, 0xb8, 0x00, 0x5e, 0x23, 0x79, 0x21, 0xb0, 0x02, 0x43, 0x23, 0xb0, 0x20,
-    0x20, 0x5c, 0x58, 0x21, 0x21, 0x21, 0xb0, 0x00, 0xb8, 0x00, 0x4d, 0x1c, 0x59, 0x8a, 0x8a, 0x20,
-    0x8a, 0x20, 0x8a, 0x23, 0xb8, 0x10, 0x00, 0x63, 0x56, 0x58, 0xb8, 0x10, 0x00, 0x63, 0x56, 0x58,
-    0x21, 0x21, 0x21, 0xb0, 0x01, 0xb8, 0x00, 0x30, 0x1c, 0x59, 0x1b, 0x21, 0x59, 0xb0, 0x80, 0x62,
-    0x20, 0x5c, 0x58, 0x21, 0x21, 0x21, 0xb0, 0x00, 0xb8, 0x00, 0x1d, 0x1c, 0x59, 0x23, 0xb0, 0x80,
-    0x62, 0x20, 0x5c, 0x58, 0x21, 0x21, 0x21, 0xb0, 0x00, 0xb8, 0x00, 0x0c, 0x1c, 0x59, 0x8a, 0xb0,
-    0x01, 0x61, 0xb8, 0xff, 0xab, 0x1c, 0x23, 0x21, 0x2d, 0x2c, 0x20, 0xb0, 0x02, 0x43, 0x54, 0xb0,
-    0x01, 0x23, 0xb8, 0x00, 0x81, 0x23, 0x78, 0x21, 0xb1, 0x00, 0x02, 0x43, 0xb8, 0x00, 0x77, 0x23,
-    0x79, 0x21, 0xb1, 0x00, 0x02, 0x43, 0x8a, 0xb0, 0x20, 0x20, 0x5c, 0x58, 0x21, 0x21, 0x21, 0xb8,
-    0x00, 0x67, 0x1c, 0x59, 0x8a, 0x8a, 0x20, 0x8a, 0x20, 0x8a, 0x23, 0xb8, 0x10, 0x00, 0x63, 0x56,
-    0x58, 0xb8, 0x10, 0x00, 0x63, 0x56, 0x58, 0xb0, 0x04, 0x26, 0xb0, 0x01, 0x5b, 0xb0, 0x04, 0x26,
-    0xb0, 0x04, 0x26, 0xb0, 0x04, 0x26, 0x1b, 0x21, 0x21, 0x21, 0x21, 0xb8, 0x00, 0x38, 0xb0, 0x00,
-    0x23, 0x1c, 0x59, 0x1b, 0x21, 0x59, 0xb0, 0x04, 0x26, 0x23, 0xb0, 0x80, 0x62, 0x20, 0x5c, 0x58,
-    0x8a, 0x5c, 0x8a, 0x5a, 0x23, 0x21, 0x23, 0x21, 0xb8, 0x00, 0x1e, 0x1c, 0x59, 0x8a, 0xb0, 0x80,
-    0x62, 0x20, 0x5c, 0x58, 0x21, 0x21, 0x23, 0x21, 0xb8, 0x00, 0x0e, 0x1c, 0x59, 0xb0, 0x04, 0x26,
-    0xb0, 0x01, 0x61, 0xb8, 0xff, 0x93, 0x1c, 0x23, 0x21, 0x2d, 0x00, 0x00, 0x03, 0x8c, 0x00, 0x64,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xfd, 0x00, 0x00, 0x01, 0xfd, 0x00, 0x00,
-    0x02, 0x1e, 0x00, 0x8c, 0x02, 0x8e, 0x00, 0x60, 0x04, 0xd3, 0x00, 0x56, 0x04, 0x8c, 0x00, 0x64,
-    0x05, 0xe4, 0x00, 0x64, 0x05, 0x21, 0x00, 0x55, 0x01, 0x57, 0x00, 0x52, 0x02, 0xc5, 0x00, 0x81,
-    0x02, 0xcc, 0x00, 0x27, 0x03, 0x8c, 0x00, 0x1c, 0x04, 0x71, 0x00, 0x42, 0x01, 0xca, 0x00, 0x22,
-    0x02, 0xb8, 0x00, 0x50, 0x02, 0x39, 0x00, 0x86, 0x03, 0x1f, 0x00, 0x01, 0x04, 0x8c, 0x00, 0x68,
-    0x04, 0x8c, 0x00, 0xaa, 0x04, 0x8c, 0x00, 0x52, 0x04, 0x8c, 0x00, 0x4e, 0x04, 0x8c, 0x00, 0x37,
-    0x04, 0x8c, 0x00, 0x7f, 0x04, 0x8c, 0x00, 0x73, 0x04, 0x8c, 0x00, 0x44, 0x04, 0x8c, 0x00, 0x67,
-    0x04, 0x8c, 0x00, 0x5d, 0x02, 0x1c, 0x00, 0x7f, 0x01, 0xeb, 0x00, 0x33, 0x04, 0x12, 0x00, 0x3e,
-    0x04, 0x80, 0x00, 0x8f, 0x04, 0x28, 0x00, 0x7e, 0x03, 0xe4, 0x00, 0x3b, 0x07, 0x2d, 0x00, 0x5b,
-    0x05, 0x4e, 0x00, 0x11, 0x05, 0x0d, 0x00, 0x94, 0x05, 0x39, 0x00, 0x66, 0x05, 0x39, 0x00, 0x94,
-    0x04, 0x85, 0x00, 0x94, 0x04, 0x68, 0x00, 0x94, 0x05, 0x73, 0x00, 0x6b, 0x05, 0xad, 0x00, 0x94,
-    0x02, 0x44, 0x00, 0xa5, 0x04, 0x72, 0x00, 0x2f, 0x05, 0x0e, 0x00, 0x94, 0x04, 0x52, 0x00, 0x94,
-    0x06, 0xff, 0x00, 0x94, 0x05, 0xad, 0x00, 0x94, 0x05, 0x83, 0x00, 0x65, 0x05, 0x1b, 0x00, 0x94,
-    0x05, 0x83, 0x00, 0x60, 0x05, 0x09, 0x00, 0x94, 0x04, 0xd8, 0x00, 0x4b, 0x04, 0xe0, 0x00, 0x2d,
-    0x05, 0x3c, 0x00, 0x80, 0x05, 0x2a, 0x00, 0x11, 0x07, 0x0b, 0x00, 0x2f, 0x05, 0x0d, 0x00, 0x26,
-    0x04, 0xe3, 0x00, 0x08, 0x04, 0xd3, 0x00, 0x50, 0x02, 0x2c, 0x00, 0x85, 0x03, 0x55, 0x00, 0x12,
-    0x02, 0x2c, 0x00, 0x0b, 0x03, 0x6e, 0x00, 0x36, 0x03, 0x95, 0x00, 0x02, 0x02, 0x90, 0x00, 0x38,
-    0x04, 0x50, 0x00, 0x56, 0x04, 0x7f, 0x00, 0x7d, 0x04, 0x2d, 0x00, 0x4e, 0x04, 0x82, 0x00, 0x50,
-    0x04, 0x49, 0x00, 0x51, 0x02, 0xd3, 0x00, 0x2b, 0x04, 0x89, 0x00, 0x52, 0x04, 0x72, 0x00, 0x7a,
-    0x02, 0x0a, 0x00, 0x7c, 0x02, 0x02, 0xff, 0xab, 0x04, 0x2c, 0x00, 0x7d, 0x02, 0x0a, 0x00, 0x8c,
-    0x06, 0xf8, 0x00, 0x7c, 0x04, 0x74, 0x00, 0x7a, 0x04, 0x8a, 0x00, 0x4e, 0x04, 0x7f, 0x00, 0x7d,
-    0x04, 0x87, 0x00, 0x50, 0x02, 0xd4, 0x00, 0x7d, 0x04, 0x1e, 0x00, 0x49, 0x02, 0xaa, 0x00, 0x0a,
-    0x04, 0x73, 0x00, 0x77, 0x03, 0xf8, 0x00, 0x16, 0x05, 0xf0, 0x00, 0x23, 0x04, 0x06, 0x00, 0x1f,
-    0x03, 0xeb, 0x00, 0x0c, 0x04, 0x06, 0x00, 0x51, 0x02, 0xab, 0x00, 0x38, 0x01, 0xfd, 0x00, 0xaf,
-    0x02, 0xab, 0x00, 0x1c, 0x05, 0x4d, 0x00, 0x75, 0x02, 0x1f, 0x00, 0x85, 0x04, 0x82, 0x00, 0x67,
-    0x04, 0xb5, 0x00, 0x5f, 0x05, 0x9e, 0x00, 0x5c, 0x04, 0x40, 0x00, 0x0d, 0x01, 0xf8, 0x00, 0x89,
-    0x04, 0xf9, 0x00, 0x5c, 0x03, 0x92, 0x00, 0x63, 0x06, 0x49, 0x00, 0x5a, 0x03, 0x90, 0x00, 0x8e,
-    0x03, 0xe3, 0x00, 0x57, 0x04, 0x6b, 0x00, 0x7f, 0x06, 0x4a, 0x00, 0x59, 0x03, 0xda, 0x00, 0x9d,
-    0x03, 0x0f, 0x00, 0x81, 0x04, 0x4a, 0x00, 0x5c, 0x02, 0xf5, 0x00, 0x3d, 0x02, 0xf5, 0x00, 0x37,
-    0x02, 0x94, 0x00, 0x6f, 0x04, 0xc1, 0x00, 0x93, 0x03, 0xea, 0x00, 0x49, 0x02, 0x44, 0x00, 0x90,
-    0x02, 0x13, 0x00, 0x6c, 0x02, 0xf5, 0x00, 0x82, 0x03, 0xa7, 0x00, 0x79, 0x03, 0xe3, 0x00, 0x5e,
-    0x05, 0xca, 0x00, 0x5f, 0x06, 0x22, 0x00, 0x53, 0x06, 0x5c, 0x00, 0x66, 0x03, 0xe5, 0x00, 0x46,
-    0x07, 0x7e, 0xff, 0xfc, 0x04, 0x42, 0x00, 0x4c, 0x05, 0x81, 0x00, 0x69, 0x04, 0xcf, 0x00, 0x95,
-    0x04, 0xeb, 0x00, 0x8a, 0x06, 0xc2, 0x00, 0x48, 0x04, 0xa4, 0x00, 0x68, 0x04, 0x91, 0x00, 0x43,
-    0x04, 0x86, 0x00, 0x4e, 0x04, 0x91, 0x00, 0x81, 0x04, 0xec, 0x00, 0x50, 0x05, 0xb0, 0x00, 0x1f,
-    0x02, 0x17, 0x00, 0x90, 0x04, 0x9a, 0x00, 0x8d, 0x04, 0x64, 0x00, 0x20, 0x02, 0x52, 0x00, 0x20,
-    0x05, 0x97, 0x00, 0x90, 0x04, 0x86, 0x00, 0x7d, 0x07, 0xb0, 0x00, 0x65, 0x07, 0x3e, 0x00, 0x59,
-    0x02, 0x07, 0x00, 0x89, 0x05, 0x8d, 0x00, 0x55, 0x02, 0xd0, 0xff, 0xde, 0x05, 0x91, 0x00, 0x5b,
-    0x04, 0x9d, 0x00, 0x4d, 0x05, 0xa3, 0x00, 0x80, 0x04, 0xe6, 0x00, 0x77, 0x02, 0x25, 0xff, 0xae,
-    0x04, 0x39, 0x00, 0x57, 0x03, 0xde, 0x00, 0x90, 0x03, 0xaa, 0x00, 0x6e, 0x03, 0xda, 0x00, 0x9d,
-    0x03, 0x7e, 0x00, 0x75, 0x02, 0x0a, 0x00, 0x81, 0x02, 0xaa, 0x00, 0x78, 0x02, 0x4c, 0x00, 0x29,
-    0x03, 0xce, 0x00, 0x77, 0x03, 0x28, 0x00, 0x4b, 0x02, 0x73, 0x00, 0x89, 0x00, 0x00, 0xfc, 0x93,
-    0x00, 0x00, 0xfd, 0x62, 0x00, 0x00, 0xfc, 0x74, 0x00, 0x00, 0xfd, 0x3a, 0x00, 0x00, 0xfc, 0x08,
-    0x00, 0x00, 0xfd, 0x1e, 0x02, 0x6b, 0x00, 0xcd, 0x04, 0x3b, 0x00, 0x6e, 0x02, 0x44, 0x00, 0x90,
-    0x04, 0x74, 0x00, 0x99, 0x05, 0xc2, 0x00, 0x1a, 0x05, 0x7a, 0x00, 0x5c, 0x05, 0x35, 0x00, 0x20,
-    0x04, 0x8c, 0x00, 0x6a, 0x05, 0xae, 0x00, 0x99, 0x04, 0x8c, 0x00, 0x47, 0x05, 0xf9, 0x00, 0x4c,
-    0x05, 0xb1, 0x00, 0x46, 0x05, 0x59, 0x00, 0x6c, 0x04, 0x84, 0x00, 0x56, 0x04, 0xc8, 0x00, 0x97,
-    0x04, 0x0d, 0x00, 0x1e, 0x04, 0x86, 0x00, 0x51, 0x04, 0x65, 0x00, 0x62, 0x04, 0x0f, 0x00, 0x59,
-    0x04, 0x86, 0x00, 0x7d, 0x04, 0xa7, 0x00, 0x76, 0x02, 0xa5, 0x00, 0xa3, 0x04, 0x68, 0x00, 0x15,
-    0x04, 0x1a, 0x00, 0x67, 0x04, 0xfc, 0x00, 0x30, 0x04, 0x86, 0x00, 0x80, 0x04, 0x33, 0x00, 0x50,
-    0x04, 0x8e, 0x00, 0x50, 0x04, 0x2a, 0x00, 0x3c, 0x04, 0x5d, 0x00, 0x7f, 0x05, 0xd1, 0x00, 0x46,
-    0x05, 0xcc, 0x00, 0x52, 0x06, 0x94, 0x00, 0x65, 0x04, 0xb4, 0x00, 0x78, 0x04, 0x87, 0xff, 0xe1,
-    0x06, 0x79, 0x00, 0x2b, 0x05, 0xfd, 0x00, 0x24, 0x05, 0x53, 0x00, 0x67, 0x08, 0x81, 0x00, 0x2d,
-    0x08, 0x8c, 0x00, 0x99, 0x06, 0x51, 0x00, 0x2d, 0x05, 0xa5, 0x00, 0x8f, 0x05, 0x07, 0x00, 0x90,
-    0x05, 0xfd, 0x00, 0x26, 0x07, 0xa9, 0x00, 0x15, 0x04, 0xdb, 0x00, 0x49, 0x05, 0xa6, 0x00, 0x92,
-    0x05, 0xa8, 0x00, 0x2c, 0x05, 0x0b, 0x00, 0x32, 0x06, 0x5f, 0x00, 0x4e, 0x05, 0xf8, 0x00, 0x8e,
-    0x05, 0x85, 0x00, 0x91, 0x07, 0x9a, 0x00, 0x95, 0x07, 0xfa, 0x00, 0x95, 0x06, 0x21, 0x00, 0x15,
-    0x06, 0xf0, 0x00, 0x99, 0x05, 0x02, 0x00, 0x90, 0x05, 0x48, 0x00, 0x63, 0x07, 0x62, 0x00, 0xa1,
-    0x04, 0xe8, 0x00, 0x17, 0x04, 0x80, 0x00, 0x5a, 0x04, 0x8b, 0x00, 0x8f, 0x03, 0x5b, 0x00, 0x83,
-    0x04, 0xf2, 0x00, 0x27, 0x06, 0x87, 0x00, 0x20, 0x04, 0x17, 0x00, 0x4e, 0x04, 0x92, 0x00, 0x84,
-    0x04, 0x6c, 0x00, 0x8f, 0x04, 0x94, 0x00, 0x20, 0x06, 0x02, 0x00, 0x8f, 0x04, 0x91, 0x00, 0x84,
-    0x04, 0x92, 0x00, 0x84, 0x03, 0xfa, 0x00, 0x23, 0x05, 0xd4, 0x00, 0x53, 0x04, 0xcf, 0x00, 0x84,
-    0x04, 0x65, 0x00, 0x60, 0x06, 0x8d, 0x00, 0x84, 0x06, 0xf1, 0x00, 0x7d, 0x05, 0x21, 0x00, 0x20,
-    0x06, 0x6f, 0x00, 0x8f, 0x04, 0x69, 0x00, 0x8f, 0x04, 0x39, 0x00, 0x50, 0x06, 0x82, 0x00, 0x92,
-    0x04, 0x70, 0x00, 0x2e, 0x04, 0x72, 0xff, 0xd7, 0x04, 0x39, 0x00, 0x52, 0x06, 0xd6, 0x00, 0x1d,
-    0x06, 0xe4, 0x00, 0x84, 0x04, 0x86, 0xff, 0xe8, 0x04, 0x92, 0x00, 0x84, 0x07, 0x58, 0x00, 0x88,
-    0x06, 0x6a, 0x00, 0x72, 0x04, 0x68, 0xff, 0xe1, 0x07, 0x28, 0x00, 0x98, 0x06, 0x02, 0x00, 0x86,
-    0x05, 0x16, 0x00, 0x1a, 0x04, 0x63, 0x00, 0x0b, 0x07, 0x4b, 0x00, 0xac, 0x06, 0x3d, 0x00, 0x9a,
-    0x06, 0xe5, 0x00, 0x7e, 0x05, 0xdd, 0x00, 0x81, 0x09, 0x2a, 0x00, 0xa5, 0x07, 0xee, 0x00, 0x90,
-    0x04, 0x20, 0x00, 0x28, 0x03, 0xf5, 0x00, 0x32, 0x05, 0x7a, 0x00, 0x60, 0x04, 0x88, 0x00, 0x4d,
-    0x05, 0x18, 0x00, 0x10, 0x04, 0x0d, 0x00, 0x1e, 0x05, 0x7a, 0x00, 0x60, 0x04, 0x86, 0x00, 0x4e,
-    0x07, 0x54, 0x00, 0x88, 0x06, 0x56, 0x00, 0x75, 0x07, 0x58, 0x00, 0x88, 0x06, 0x6a, 0x00, 0x72,
-    0x05, 0x10, 0x00, 0x67, 0x04, 0x47, 0x00, 0x5d, 0x04, 0xfb, 0x00, 0x70, 0x00, 0x00, 0xfc, 0x70,
-    0x00, 0x00, 0xfc, 0x75, 0x00, 0x00, 0xfd, 0x81, 0x00, 0x00, 0xfd, 0xa6, 0x00, 0x00, 0xfa, 0x26,
-    0x00, 0x00, 0xfa, 0x51, 0x06, 0x20, 0x00, 0x92, 0x05, 0x13, 0x00, 0x84, 0x04, 0x68, 0xff, 0xe1,
-    0x05, 0x10, 0x00, 0x94, 0x04, 0x86, 0x00, 0x7d, 0x04, 0x6b, 0x00, 0x8f, 0x03, 0xa3, 0x00, 0x7d,
-    0x04, 0xea, 0x00, 0x99, 0x04, 0x24, 0x00, 0x7d, 0x08, 0x23, 0x00, 0x15, 0x06, 0xe0, 0x00, 0x20,
-    0x05, 0xc9, 0x00, 0x99, 0x04, 0xfb, 0x00, 0x8f, 0x05, 0x2e, 0x00, 0x91, 0x04, 0xac, 0x00, 0x8d,
-    0x06, 0x94, 0x00, 0x34, 0x05, 0xa0, 0x00, 0x3c, 0x06, 0x20, 0x00, 0x94, 0x05, 0x07, 0x00, 0x84,
-    0x07, 0xdd, 0x00, 0x94, 0x05, 0xad, 0x00, 0x7d, 0x08, 0x49, 0x00, 0x97, 0x06, 0xef, 0x00, 0x7d,
-    0x06, 0x37, 0x00, 0x67, 0x05, 0x04, 0x00, 0x60, 0x05, 0x39, 0x00, 0x26, 0x04, 0x41, 0x00, 0x1f,
-    0x07, 0x28, 0x00, 0x29, 0x05, 0x6f, 0x00, 0x27, 0x05, 0xf2, 0x00, 0x91, 0x04, 0xdc, 0x00, 0x60,
-    0x05, 0x70, 0x00, 0x81, 0x04, 0x74, 0x00, 0x75, 0x05, 0x85, 0x00, 0x89, 0x06, 0x1b, 0x00, 0x0a,
-    0x04, 0xc4, 0xff, 0xcb, 0x05, 0x20, 0x00, 0x91, 0x04, 0x78, 0x00, 0x8d, 0x06, 0x1f, 0x00, 0x2c,
-    0x05, 0x14, 0x00, 0x20, 0x05, 0xad, 0x00, 0x99, 0x04, 0x86, 0x00, 0x7d, 0x06, 0x2a, 0x00, 0x94,
-    0x05, 0x11, 0x00, 0x84, 0x07, 0x75, 0x00, 0x94, 0x06, 0x74, 0x00, 0x8f, 0x05, 0x8d, 0x00, 0x55,
-    0x04, 0xa3, 0x00, 0x5b, 0x04, 0xa4, 0x00, 0x5d, 0x04, 0xc3, 0x00, 0x2c, 0x03, 0xaa, 0x00, 0x24,
-    0x05, 0x69, 0x00, 0x26, 0x04, 0x71, 0x00, 0x1f, 0x04, 0xf9, 0x00, 0x4f, 0x06, 0xf3, 0x00, 0x68,
-    0x06, 0xdb, 0x00, 0x5f, 0x06, 0x51, 0x00, 0x3d, 0x05, 0x28, 0x00, 0x2f, 0x04, 0x83, 0x00, 0x4a,
-    0x04, 0x48, 0x00, 0x73, 0x07, 0xbc, 0x00, 0x42, 0x06, 0xa4, 0x00, 0x3f, 0x07, 0xf5, 0x00, 0x94,
-    0x06, 0x9e, 0x00, 0x74, 0x05, 0x06, 0x00, 0x5c, 0x04, 0x2f, 0x00, 0x55, 0x05, 0xa8, 0x00, 0x21,
-    0x05, 0x1d, 0x00, 0x44, 0x05, 0x4e, 0x00, 0x7d, 0x06, 0x46, 0x00, 0x2c, 0x05, 0x3b, 0x00, 0x20,
-    0x03, 0x1b, 0x00, 0x64, 0x04, 0x14, 0x00, 0x00, 0x08, 0x29, 0x00, 0x00, 0x04, 0x14, 0x00, 0x00,
-    0x08, 0x29, 0x00, 0x00, 0x02, 0xb9, 0x00, 0x00, 0x02, 0x0a, 0x00, 0x00, 0x01, 0x5c, 0x00, 0x00,
-    0x04, 0x7f, 0x00, 0x00, 0x02, 0x30, 0x00, 0x00, 0x01, 0xa2, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-    0x00, 0xd1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xb7, 0x00, 0x50, 0x02, 0xb7, 0x00, 0x50,
-    0x05, 0x23, 0x00, 0x9c, 0x06, 0x2a, 0x00, 0x7b, 0x03, 0x9a, 0x00, 0x08, 0x01, 0xbf, 0x00, 0x65,
-    0x01, 0xba, 0x00, 0x37, 0x01, 0xce, 0x00, 0x35, 0x01, 0xa3, 0x00, 0x4b, 0x03, 0x0b, 0x00, 0x6d,
-    0x03, 0x13, 0x00, 0x43, 0x03, 0x00, 0x00, 0x35, 0x04, 0x5b, 0x00, 0x3f, 0x04, 0x9a, 0x00, 0x5d,
-    0x02, 0xcc, 0x00, 0x8a, 0x03, 0xfd, 0x00, 0x8d, 0x05, 0xaa, 0x00, 0x8d, 0x01, 0xcf, 0x00, 0x5e,
-    0x07, 0xae, 0x00, 0x50, 0x02, 0x74, 0x00, 0x6c, 0x02, 0x69, 0x00, 0x55, 0x03, 0x99, 0x00, 0x2b,
-    0x02, 0xf5, 0x00, 0x4c, 0x02, 0xf5, 0x00, 0x36, 0x02, 0xf5, 0x00, 0x50, 0x02, 0xf5, 0x00, 0x4e,
-    0x02, 0xf5, 0x00, 0x37, 0x02, 0xf5, 0x00, 0x4b, 0x02, 0xf5, 0x00, 0x47, 0x03, 0x39, 0x00, 0x50,
-    0x02, 0xf3, 0x00, 0x50, 0x02, 0xf3, 0x00, 0x50, 0x02, 0x03, 0x00, 0x53, 0x02, 0x03, 0x00, 0x50,
-    0x03, 0x5c, 0x00, 0x67, 0x02, 0xf5, 0x00, 0x4c, 0x02, 0xf5, 0x00, 0x82, 0x02, 0xf5, 0x00, 0x3d,
-    0x02, 0xf5, 0x00, 0x37, 0x02, 0xf5, 0x00, 0x36, 0x02, 0xf5, 0x00, 0x50, 0x02, 0xf5, 0x00, 0x4e,
-    0x02, 0xf5, 0x00, 0x37, 0x02, 0xf5, 0x00, 0x4b, 0x02, 0xf5, 0x00, 0x47, 0x03, 0x39, 0x00, 0x50,
-    0x02, 0xf3, 0x00, 0x50, 0x02, 0xf3, 0x00, 0x50, 0x02, 0x03, 0x00, 0x53, 0x02, 0x03, 0x00, 0x50,
-    0x04, 0xb5, 0x00, 0x62, 0x06, 0x6e, 0x00, 0x23, 0x06, 0xbf, 0x00, 0x99, 0x08, 0x95, 0x00, 0x94,
-    0x06, 0x3b, 0x00, 0x23, 0x06, 0x9b, 0x00, 0x7d, 0x04, 0x8c, 0x00, 0x5c, 0x05, 0xea, 0x00, 0x23,
-    0x04, 0x2d, 0x00, 0x2a, 0x04, 0x9b, 0x00, 0x24, 0x05, 0x62, 0x00, 0x4f, 0x05, 0x7e, 0x00, 0x2b,
-    0x05, 0xe4, 0x00, 0x6e, 0x03, 0xe3, 0x00, 0x45, 0x08, 0x29, 0x00, 0x90, 0x05, 0x08, 0x00, 0x6f,
-    0x05, 0x14, 0x00, 0x96, 0x06, 0x37, 0x00, 0x5c, 0x06, 0xde, 0x00, 0x56, 0x06, 0xd0, 0x00, 0x5e,
-    0x06, 0xac, 0x00, 0x5c, 0x04, 0x93, 0x00, 0x61, 0x05, 0x8a, 0x00, 0xa6, 0x04, 0xde, 0x00, 0x3f,
-    0x04, 0x80, 0x00, 0x9c, 0x04, 0x9d, 0x00, 0x3b, 0x08, 0x52, 0x00, 0x61, 0x02, 0x32, 0xff, 0xa7,
-    0x04, 0x91, 0x00, 0x65, 0x04, 0x80, 0x00, 0x8f, 0x04, 0x12, 0x00, 0x3d, 0x04, 0x28, 0x00, 0x7d,
-    0x04, 0x0e, 0x00, 0x25, 0x02, 0x51, 0x00, 0x9c, 0x02, 0x8e, 0x00, 0x64, 0x01, 0xe9, 0x00, 0x47,
-    0x05, 0x19, 0x00, 0x2b, 0x04, 0xad, 0x00, 0x1a, 0x04, 0xbd, 0x00, 0x2b, 0x07, 0x28, 0x00, 0x2b,
-    0x07, 0x28, 0x00, 0x2b, 0x05, 0x0f, 0x00, 0x2b, 0x06, 0xb7, 0x00, 0x49, 0x00, 0x00, 0x00, 0x00,
-    0x08, 0x30, 0x00, 0x59, 0x08, 0x35, 0x00, 0x5c, 0x02, 0xf5, 0x00, 0x3d, 0x02, 0xf5, 0x00, 0x82,
-    0x02, 0xf5, 0x00, 0x4c, 0x04, 0x1d, 0x00, 0x4f, 0x04, 0x1d, 0x00, 0x57, 0x04, 0x1d, 0x00, 0x38,
-    0x04, 0x1d, 0x00, 0x5f, 0x04, 0x1d, 0x00, 0x66, 0x04, 0x1d, 0x00, 0x33, 0x04, 0x1d, 0x00, 0x3d,
-    0x04, 0x1d, 0x00, 0x43, 0x04, 0x1d, 0x00, 0x98, 0x04, 0x1d, 0x00, 0x58, 0x04, 0x2b, 0x00, 0x41,
-    0x04, 0x3e, 0x00, 0x06, 0x04, 0x5c, 0x00, 0x13, 0x06, 0x09, 0x00, 0x27, 0x04, 0x79, 0x00, 0x08,
-    0x04, 0x88, 0x00, 0x69, 0x04, 0x3f, 0x00, 0x25, 0x04, 0x37, 0x00, 0x3f, 0x04, 0x64, 0x00, 0x75,
-    0x04, 0xbd, 0x00, 0x4d, 0x04, 0x6b, 0x00, 0x76, 0x04, 0xbd, 0x00, 0x4e, 0x04, 0xdc, 0x00, 0x76,
-    0x06, 0x05, 0x00, 0x76, 0x03, 0xb7, 0x00, 0x76, 0x04, 0x5e, 0x00, 0x76, 0x03, 0xd6, 0x00, 0x26,
-    0x01, 0xfe, 0x00, 0x86, 0x04, 0xdd, 0x00, 0x76, 0x04, 0xa7, 0x00, 0x56, 0x03, 0xc8, 0x00, 0x76,
-    0x04, 0x37, 0x00, 0x3f, 0x04, 0x68, 0x00, 0x3a, 0x03, 0xa5, 0x00, 0x0a, 0x03, 0xbc, 0x00, 0x76,
-    0x04, 0x79, 0x00, 0x08, 0x04, 0xbd, 0x00, 0x4e, 0x04, 0x79, 0x00, 0x08, 0x03, 0x9d, 0x00, 0x46,
-    0x04, 0xd9, 0x00, 0x76, 0x04, 0x1e, 0x00, 0x44, 0x05, 0xa6, 0x00, 0x4f, 0x05, 0x58, 0x00, 0x4f,
-    0x04, 0xe0, 0x00, 0x5e, 0x05, 0x92, 0x00, 0x23, 0x04, 0x80, 0x00, 0x4f, 0x07, 0x56, 0x00, 0x24,
-    0x07, 0x58, 0x00, 0x76, 0x05, 0x99, 0x00, 0x25, 0x04, 0xd8, 0x00, 0x76, 0x04, 0x72, 0x00, 0x76,
-    0x05, 0x5e, 0x00, 0x27, 0x06, 0x45, 0x00, 0x1b, 0x04, 0x46, 0x00, 0x43, 0x04, 0xe2, 0x00, 0x76,
-    0x04, 0x5d, 0x00, 0x76, 0x04, 0xcb, 0x00, 0x24, 0x04, 0x4c, 0x00, 0x1f, 0x05, 0x62, 0x00, 0x76,
-    0x04, 0x8d, 0x00, 0x43, 0x06, 0x84, 0x00, 0x76, 0x07, 0x0e, 0x00, 0x76, 0x05, 0x61, 0x00, 0x09,
-    0x06, 0x16, 0x00, 0x76, 0x04, 0x67, 0x00, 0x76, 0x04, 0x80, 0x00, 0x3d, 0x06, 0x8f, 0x00, 0x76,
-    0x04, 0x84, 0x00, 0x42, 0x04, 0x28, 0x00, 0x0b, 0x06, 0xa3, 0x00, 0x1b, 0x04, 0xa0, 0x00, 0x76,
-    0x05, 0x0d, 0x00, 0x76, 0x05, 0x74, 0x00, 0x21, 0x05, 0xf8, 0x00, 0x4e, 0x04, 0x56, 0x00, 0x06,
-    0x04, 0xc4, 0x00, 0x13, 0x06, 0x97, 0x00, 0x23, 0x04, 0x8d, 0x00, 0x43, 0x04, 0x8d, 0x00, 0x76,
-    0x06, 0x00, 0x00, 0x0e, 0x04, 0xce, 0x00, 0x4d, 0x04, 0x47, 0x00, 0x43, 0x04, 0xbd, 0x00, 0x4e,
-    0x04, 0x68, 0x00, 0x3a, 0x03, 0xf4, 0x00, 0x45, 0x08, 0x2d, 0x00, 0x76, 0x04, 0xf4, 0x00, 0x28,
-    0x02, 0xf5, 0x00, 0x37, 0x02, 0xf5, 0x00, 0x36, 0x02, 0xf5, 0x00, 0x50, 0x02, 0xf5, 0x00, 0x4e,
-    0x02, 0xf5, 0x00, 0x37, 0x02, 0xf5, 0x00, 0x4b, 0x02, 0xf5, 0x00, 0x47, 0x03, 0xb6, 0x00, 0x8d,
-    0x02, 0xae, 0x00, 0x98, 0x03, 0xe0, 0x00, 0x76, 0x04, 0x3a, 0x00, 0x0c, 0x04, 0xb6, 0x00, 0x56,
-    0x05, 0x41, 0x00, 0x99, 0x05, 0x28, 0x00, 0x99, 0x04, 0x30, 0x00, 0x81, 0x05, 0x35, 0x00, 0x99,
-    0x04, 0x28, 0x00, 0x81, 0x04, 0x7a, 0x00, 0x76, 0x04, 0x80, 0x00, 0x4f, 0x04, 0x60, 0x00, 0x76,
-    0x04, 0x9a, 0x00, 0x08, 0x01, 0xfe, 0x00, 0x90, 0x03, 0xa1, 0x00, 0x75, 0x00, 0x00, 0xfc, 0x9e,
-    0x03, 0xf7, 0x00, 0x7a, 0x03, 0xfa, 0xff, 0x51, 0x04, 0x0b, 0x00, 0x79, 0x03, 0xfa, 0x00, 0x79,
-    0x03, 0xbc, 0x00, 0x76, 0x03, 0x9d, 0x00, 0x75, 0x03, 0x9d, 0x00, 0x75, 0x02, 0xf5, 0x00, 0x4c,
-    0x02, 0xf5, 0x00, 0x36, 0x02, 0xf5, 0x00, 0x50, 0x02, 0xf5, 0x00, 0x4e, 0x02, 0xf5, 0x00, 0x37,
-    0x02, 0xf5, 0x00, 0x4b, 0x02, 0xf5, 0x00, 0x47, 0x05, 0x73, 0x00, 0x69, 0x05, 0x9e, 0x00, 0x69,
-    0x05, 0x7f, 0x00, 0x99, 0x05, 0xd9, 0x00, 0x69, 0x05, 0xda, 0x00, 0x69, 0x04, 0x28, 0x00, 0x96,
-    0x04, 0x82, 0x00, 0x6b, 0x04, 0x58, 0x00, 0x0f, 0x04, 0xbb, 0x00, 0x34, 0x04, 0x6b, 0x00, 0x67,
-    0x04, 0x2e, 0x00, 0x42, 0x03, 0xa1, 0x00, 0x76, 0x01, 0xba, 0x00, 0x62, 0x06, 0x98, 0x00, 0x4e,
-    0x04, 0xaf, 0x00, 0x6e, 0x02, 0x0c, 0xff, 0xa7, 0x04, 0x8c, 0x00, 0x38, 0x04, 0x8c, 0x00, 0x68,
-    0x04, 0x8c, 0x00, 0x2c, 0x04, 0x8c, 0x00, 0x62, 0x04, 0x8c, 0x00, 0x5f, 0x04, 0x8c, 0x00, 0x34,
-    0x04, 0x8c, 0x00, 0x6c, 0x04, 0x8c, 0x00, 0x59, 0x04, 0x8c, 0x00, 0x67, 0x04, 0x8c, 0x00, 0xe6,
-    0x02, 0x26, 0xff, 0xae, 0x02, 0x25, 0xff, 0xae, 0x02, 0x17, 0x00, 0x90, 0x02, 0x17, 0xff, 0xfa,
-    0x02, 0x17, 0x00, 0x90, 0x04, 0x60, 0x00, 0x76, 0x04, 0xe6, 0x00, 0x60, 0x04, 0x30, 0x00, 0x39,
-    0x04, 0x88, 0x00, 0x7d, 0x04, 0x3e, 0x00, 0x4f, 0x04, 0x95, 0x00, 0x4e, 0x04, 0x91, 0x00, 0x4e,
-    0x04, 0x9d, 0x00, 0x49, 0x04, 0x92, 0x00, 0x7d, 0x04, 0x9a, 0x00, 0x4e, 0x04, 0x49, 0x00, 0x51,
-    0x04, 0x89, 0x00, 0x50, 0x04, 0x59, 0x00, 0x34, 0x03, 0xad, 0x00, 0x61, 0x05, 0x0c, 0x00, 0x5f,
-    0x03, 0xc4, 0x00, 0x05, 0x06, 0x46, 0xff, 0xec, 0x04, 0x07, 0x00, 0x76, 0x04, 0xbd, 0x00, 0x4e,
-    0x05, 0x0e, 0x00, 0x34, 0x04, 0xdc, 0x00, 0x76, 0x01, 0xfd, 0x00, 0x00, 0x02, 0xb8, 0x00, 0x50,
-    0x05, 0x57, 0x00, 0x17, 0x05, 0x57, 0x00, 0x17, 0x04, 0x90, 0xff, 0xf5, 0x04, 0xe0, 0x00, 0x2d,
-    0x02, 0xaa, 0xff, 0xeb, 0x05, 0x4e, 0x00, 0x11, 0x05, 0x4e, 0x00, 0x11, 0x05, 0x4e, 0x00, 0x11,
-    0x05, 0x4e, 0x00, 0x11, 0x05, 0x4e, 0x00, 0x11, 0x05, 0x4e, 0x00, 0x11, 0x05, 0x4e, 0x00, 0x11,
-    0x05, 0x39, 0x00, 0x66, 0x04, 0x85, 0x00, 0x94, 0x04, 0x85, 0x00, 0x94, 0x04, 0x85, 0x00, 0x94,
-    0x04, 0x85, 0x00, 0x94, 0x02, 0x44, 0xff, 0xcb, 0x02, 0x44, 0x00, 0xa5, 0x02, 0x44, 0xff, 0xca,
-    0x02, 0x44, 0xff, 0xbe, 0x05, 0xad, 0x00, 0x94, 0x05, 0x83, 0x00, 0x65, 0x05, 0x83, 0x00, 0x65,
-    0x05, 0x83, 0x00, 0x65, 0x05, 0x83, 0x00, 0x65, 0x05, 0x83, 0x00, 0x65, 0x05, 0x3c, 0x00, 0x80,
-    0x05, 0x3c, 0x00, 0x80, 0x05, 0x3c, 0x00, 0x80, 0x05, 0x3c, 0x00, 0x80, 0x04, 0xe3, 0x00, 0x08,
-    0x04, 0x50, 0x00, 0x56, 0x04, 0x50, 0x00, 0x56, 0x04, 0x50, 0x00, 0x56, 0x04, 0x50, 0x00, 0x56,
-    0x04, 0x50, 0x00, 0x56, 0x04, 0x50, 0x00, 0x56, 0x04, 0x50, 0x00, 0x56, 0x04, 0x2d, 0x00, 0x4e,
-    0x04, 0x49, 0x00, 0x51, 0x04, 0x49, 0x00, 0x51, 0x04, 0x49, 0x00, 0x51, 0x04, 0x49, 0x00, 0x51,
-    0x02, 0x17, 0xff, 0xb5, 0x02, 0x17, 0x00, 0x90, 0x02, 0x17, 0xff, 0xb3, 0x02, 0x17, 0xff, 0xa8,
-    0x04, 0x74, 0x00, 0x7a, 0x04, 0x8a, 0x00, 0x4e, 0x04, 0x8a, 0x00, 0x4e, 0x04, 0x8a, 0x00, 0x4e,
-    0x04, 0x8a, 0x00, 0x4e, 0x04, 0x8a, 0x00, 0x4e, 0x04, 0x73, 0x00, 0x77, 0x04, 0x73, 0x00, 0x77,
-    0x04, 0x73, 0x00, 0x77, 0x04, 0x73, 0x00, 0x77, 0x03, 0xeb, 0x00, 0x0c, 0x03, 0xeb, 0x00, 0x0c,
-    0x05, 0x4e, 0x00, 0x11, 0x04, 0x50, 0x00, 0x56, 0x05, 0x4e, 0x00, 0x11, 0x04, 0x50, 0x00, 0x56,
-    0x05, 0x4e, 0x00, 0x11, 0x04, 0x50, 0x00, 0x56, 0x05, 0x39, 0x00, 0x66, 0x04, 0x2d, 0x00, 0x4e,
-    0x05, 0x39, 0x00, 0x66, 0x04, 0x2d, 0x00, 0x4e, 0x05, 0x39, 0x00, 0x66, 0x04, 0x2d, 0x00, 0x4e,
-    0x05, 0x39, 0x00, 0x66, 0x04, 0x2d, 0x00, 0x4e, 0x05, 0x39, 0x00, 0x94, 0x05, 0x18, 0x00, 0x50,
-    0x04, 0x85, 0x00, 0x94, 0x04, 0x49, 0x00, 0x51, 0x04, 0x85, 0x00, 0x94, 0x04, 0x49, 0x00, 0x51,
-    0x04, 0x85, 0x00, 0x94, 0x04, 0x49, 0x00, 0x51, 0x04, 0x85, 0x00, 0x94, 0x04, 0x49, 0x00, 0x51,
-    0x04, 0x85, 0x00, 0x94, 0x04, 0x49, 0x00, 0x51, 0x05, 0x73, 0x00, 0x6b, 0x04, 0x89, 0x00, 0x52,
-    0x05, 0x73, 0x00, 0x6b, 0x04, 0x89, 0x00, 0x52, 0x05, 0x73, 0x00, 0x6b, 0x04, 0x89, 0x00, 0x52,
-    0x05, 0x73, 0x00, 0x6b, 0x04, 0x89, 0x00, 0x52, 0x05, 0xad, 0x00, 0x94, 0x04, 0x72, 0x00, 0x7a,
-    0x02, 0x44, 0xff, 0xb4, 0x02, 0x17, 0xff, 0x9d, 0x02, 0x44, 0xff, 0xd1, 0x02, 0x17, 0xff, 0xbb,
-    0x02, 0x44, 0xff, 0xdd, 0x02, 0x17, 0xff, 0xc6, 0x02, 0x44, 0x00, 0x18, 0x02, 0x0a, 0xff, 0xff,
-    0x02, 0x44, 0x00, 0x9f, 0x06, 0xb5, 0x00, 0xa5, 0x04, 0x0b, 0x00, 0x7c, 0x04, 0x72, 0x00, 0x2f,
-    0x02, 0x25, 0xff, 0xae, 0x05, 0x0e, 0x00, 0x94, 0x04, 0x2c, 0x00, 0x7d, 0x04, 0x52, 0x00, 0x94,
-    0x02, 0x0a, 0x00, 0x8c, 0x04, 0x52, 0x00, 0x94, 0x02, 0x0a, 0x00, 0x59, 0x04, 0x52, 0x00, 0x94,
-    0x02, 0xa0, 0x00, 0x8c, 0x04, 0x52, 0x00, 0x94, 0x02, 0xe6, 0x00, 0x8c, 0x05, 0xad, 0x00, 0x94,
-    0x04, 0x74, 0x00, 0x7a, 0x05, 0xad, 0x00, 0x94, 0x04, 0x74, 0x00, 0x7a, 0x05, 0xad, 0x00, 0x94,
-    0x04, 0x74, 0x00, 0x7a, 0x04, 0x74, 0xff, 0xa3, 0x05, 0x83, 0x00, 0x65, 0x04, 0x8a, 0x00, 0x4e,
-    0x05, 0x83, 0x00, 0x65, 0x04, 0x8a, 0x00, 0x4e, 0x05, 0x83, 0x00, 0x65, 0x04, 0x8a, 0x00, 0x4e,
-    0x05, 0x09, 0x00, 0x94, 0x02, 0xd4, 0x00, 0x7d, 0x05, 0x09, 0x00, 0x94, 0x02, 0xd4, 0x00, 0x52,
-    0x05, 0x09, 0x00, 0x94, 0x02, 0xd4, 0x00, 0x37, 0x04, 0xd8, 0x00, 0x4b, 0x04, 0x1e, 0x00, 0x49,
-    0x04, 0xd8, 0x00, 0x4b, 0x04, 0x1e, 0x00, 0x49, 0x04, 0xd8, 0x00, 0x4b, 0x04, 0x1e, 0x00, 0x49,
-    0x04, 0xd8, 0x00, 0x4b, 0x04, 0x1e, 0x00, 0x49, 0x04, 0xd8, 0x00, 0x4b, 0x04, 0x1e, 0x00, 0x49,
-    0x04, 0xe0, 0x00, 0x2d, 0x02, 0xaa, 0x00, 0x0a, 0x04, 0xe0, 0x00, 0x2d, 0x02, 0xaa, 0x00, 0x0a,
-    0x04, 0xe0, 0x00, 0x2d, 0x02, 0xd2, 0x00, 0x0a, 0x05, 0x3c, 0x00, 0x80, 0x04, 0x73, 0x00, 0x77,
-    0x05, 0x3c, 0x00, 0x80, 0x04, 0x73, 0x00, 0x77, 0x05, 0x3c, 0x00, 0x80, 0x04, 0x73, 0x00, 0x77,
-    0x05, 0x3c, 0x00, 0x80, 0x04, 0x73, 0x00, 0x77, 0x05, 0x3c, 0x00, 0x80, 0x04, 0x73, 0x00, 0x77,
-    0x05, 0x3c, 0x00, 0x80, 0x04, 0x73, 0x00, 0x77, 0x07, 0x0b, 0x00, 0x2f, 0x05, 0xf0, 0x00, 0x23,
-    0x04, 0xe3, 0x00, 0x08, 0x03, 0xeb, 0x00, 0x0c, 0x04, 0xe3, 0x00, 0x08, 0x04, 0xd3, 0x00, 0x50,
-    0x04, 0x06, 0x00, 0x51, 0x04, 0xd3, 0x00, 0x50, 0x04, 0x06, 0x00, 0x51, 0x04, 0xd3, 0x00, 0x50,
-    0x04, 0x06, 0x00, 0x51, 0x07, 0x7e, 0xff, 0xfc, 0x06, 0xc2, 0x00, 0x48, 0x05, 0x81, 0x00, 0x69,
-    0x04, 0x86, 0x00, 0x4e, 0x04, 0x7a, 0xff, 0xa5, 0x04, 0x7a, 0xff, 0xa5, 0x04, 0x3f, 0x00, 0x25,
-    0x04, 0x9a, 0x00, 0x08, 0x04, 0x9a, 0x00, 0x08, 0x04, 0x9a, 0x00, 0x08, 0x04, 0x9a, 0x00, 0x08,
-    0x04, 0x9a, 0x00, 0x08, 0x04, 0x9a, 0x00, 0x08, 0x04, 0x9a, 0x00, 0x08, 0x04, 0x80, 0x00, 0x4f,
-    0x03, 0xe0, 0x00, 0x76, 0x03, 0xe0, 0x00, 0x76, 0x03, 0xe0, 0x00, 0x76, 0x03, 0xe0, 0x00, 0x76,
-    0x01, 0xfe, 0xff, 0xa9, 0x01, 0xfe, 0x00, 0x86, 0x01, 0xfe, 0xff, 0xa7, 0x01, 0xfe, 0xff, 0x9c,
-    0x04, 0xdc, 0x00, 0x76, 0x04, 0xbd, 0x00, 0x4e, 0x04, 0xbd, 0x00, 0x4e, 0x04, 0xbd, 0x00, 0x4e,
-    0x04, 0xbd, 0x00, 0x4e, 0x04, 0xbd, 0x00, 0x4e, 0x04, 0x88, 0x00, 0x69, 0x04, 0x88, 0x00, 0x69,
-    0x04, 0x88, 0x00, 0x69, 0x04, 0x88, 0x00, 0x69, 0x04, 0x3e, 0x00, 0x06, 0x04, 0x9a, 0x00, 0x08,
-    0x04, 0x9a, 0x00, 0x08, 0x04, 0x9a, 0x00, 0x08, 0x04, 0x80, 0x00, 0x4f, 0x04, 0x80, 0x00, 0x4f,
-    0x04, 0x80, 0x00, 0x4f, 0x04, 0x80, 0x00, 0x4f, 0x04, 0x7a, 0x00, 0x61, 0x03, 0xe0, 0x00, 0x76,
-    0x03, 0xe0, 0x00, 0x76, 0x03, 0xe0, 0x00, 0x76, 0x03, 0xe0, 0x00, 0x76, 0x03, 0xe0, 0x00, 0x76,
-    0x04, 0xa7, 0x00, 0x56, 0x04, 0xa7, 0x00, 0x56, 0x04, 0xa7, 0x00, 0x56, 0x04, 0xa7, 0x00, 0x56,
-    0x04, 0xdd, 0x00, 0x76, 0x01, 0xfe, 0xff, 0x91, 0x01, 0xfe, 0xff, 0xaf, 0x01, 0xfe, 0xff, 0xba,
-    0x01, 0xfe, 0x00, 0x17, 0x01, 0xfe, 0x00, 0x7d, 0x03, 0xd6, 0x00, 0x26, 0x04, 0x5e, 0x00, 0x76,
-    0x03, 0xb7, 0x00, 0x76, 0x03, 0xb7, 0x00, 0x76, 0x03, 0xb7, 0x00, 0x76, 0x03, 0xb7, 0x00, 0x76,
-    0x04, 0xdc, 0x00, 0x76, 0x04, 0xdc, 0x00, 0x76, 0x04, 0xdc, 0x00, 0x76, 0x04, 0xbd, 0x00, 0x4e,
-    0x04, 0xbd, 0x00, 0x4e, 0x04, 0xbd, 0x00, 0x4e, 0x04, 0x64, 0x00, 0x75, 0x04, 0x64, 0x00, 0x75,
-    0x04, 0x64, 0x00, 0x75, 0x04, 0x37, 0x00, 0x3f, 0x04, 0x37, 0x00, 0x3f, 0x04, 0x37, 0x00, 0x3f,
-    0x04, 0x37, 0x00, 0x3f, 0x04, 0x3f, 0x00, 0x25, 0x04, 0x3f, 0x00, 0x25, 0x04, 0x3f, 0x00, 0x25,
-    0x04, 0x88, 0x00, 0x69, 0x04, 0x88, 0x00, 0x69, 0x04, 0x88, 0x00, 0x69, 0x04, 0x88, 0x00, 0x69,
-    0x04, 0x88, 0x00, 0x69, 0x04, 0x88, 0x00, 0x69, 0x06, 0x09, 0x00, 0x27, 0x04, 0x3e, 0x00, 0x06,
-    0x04, 0x3e, 0x00, 0x06, 0x04, 0x2b, 0x00, 0x41, 0x04, 0x2b, 0x00, 0x41, 0x04, 0x2b, 0x00, 0x41,
-    0x05, 0x4e, 0x00, 0x11, 0x04, 0xe9, 0xff, 0x42, 0x06, 0x11, 0xff, 0x4a, 0x02, 0xa8, 0xff, 0x4e,
-    0x05, 0x97, 0xff, 0xb4, 0x05, 0x47, 0xff, 0x41, 0x05, 0x6d, 0xff, 0xc2, 0x02, 0xa5, 0xff, 0x85,
-    0x05, 0x4e, 0x00, 0x11, 0x05, 0x0d, 0x00, 0x94, 0x04, 0x85, 0x00, 0x94, 0x04, 0xd3, 0x00, 0x50,
-    0x05, 0xad, 0x00, 0x94, 0x02, 0x44, 0x00, 0xa5, 0x05, 0x0e, 0x00, 0x94, 0x06, 0xff, 0x00, 0x94,
-    0x05, 0xad, 0x00, 0x94, 0x05, 0x83, 0x00, 0x65, 0x05, 0x1b, 0x00, 0x94, 0x04, 0xe0, 0x00, 0x2d,
-    0x04, 0xe3, 0x00, 0x08, 0x05, 0x0d, 0x00, 0x26, 0x02, 0x44, 0xff, 0xbe, 0x04, 0xe3, 0x00, 0x08,
-    0x04, 0x84, 0x00, 0x56, 0x04, 0x65, 0x00, 0x62, 0x04, 0x86, 0x00, 0x7d, 0x02, 0xa5, 0x00, 0xa3,
-    0x04, 0x5d, 0x00, 0x7f, 0x04, 0x9a, 0x00, 0x8d, 0x04, 0x8a, 0x00, 0x4e, 0x04, 0xc1, 0x00, 0x93,
-    0x03, 0xf8, 0x00, 0x16, 0x04, 0x59, 0x00, 0x34, 0x02, 0xa5, 0xff, 0xc3, 0x04, 0x5d, 0x00, 0x7f,
-    0x04, 0x8a, 0x00, 0x4e, 0x04, 0x5d, 0x00, 0x7f, 0x06, 0x94, 0x00, 0x65, 0x04, 0x85, 0x00, 0x94,
-    0x04, 0x74, 0x00, 0x99, 0x04, 0xd8, 0x00, 0x4b, 0x02, 0x44, 0x00, 0xa5, 0x02, 0x44, 0xff, 0xbe,
-    0x04, 0x72, 0x00, 0x2f, 0x05, 0x28, 0x00, 0x99, 0x05, 0x0e, 0x00, 0x94, 0x05, 0x0b, 0x00, 0x32,
-    0x05, 0x4e, 0x00, 0x11, 0x05, 0x0d, 0x00, 0x94, 0x04, 0x74, 0x00, 0x99, 0x04, 0x85, 0x00, 0x94,
-    0x05, 0xa6, 0x00, 0x92, 0x06, 0xff, 0x00, 0x94, 0x05, 0xad, 0x00, 0x94, 0x05, 0x83, 0x00, 0x65,
-    0x05, 0xae, 0x00, 0x99, 0x05, 0x1b, 0x00, 0x94, 0x05, 0x39, 0x00, 0x66, 0x04, 0xe0, 0x00, 0x2d,
-    0x05, 0x0d, 0x00, 0x26, 0x04, 0x50, 0x00, 0x56, 0x04, 0x49, 0x00, 0x51, 0x04, 0x92, 0x00, 0x84,
-    0x04, 0x8a, 0x00, 0x4e, 0x04, 0x7f, 0x00, 0x7d, 0x04, 0x2d, 0x00, 0x4e, 0x03, 0xeb, 0x00, 0x0c,
-    0x04, 0x06, 0x00, 0x1f, 0x04, 0x49, 0x00, 0x51, 0x03, 0x5b, 0x00, 0x83, 0x04, 0x1e, 0x00, 0x49,
-    0x02, 0x0a, 0x00, 0x7c, 0x02, 0x17, 0xff, 0xa8, 0x02, 0x02, 0xff, 0xab, 0x04, 0x6c, 0x00, 0x8f,
-    0x03, 0xeb, 0x00, 0x0c, 0x07, 0x0b, 0x00, 0x2f, 0x05, 0xf0, 0x00, 0x23, 0x07, 0x0b, 0x00, 0x2f,
-    0x05, 0xf0, 0x00, 0x23, 0x07, 0x0b, 0x00, 0x2f, 0x05, 0xf0, 0x00, 0x23, 0x04, 0xe3, 0x00, 0x08,
-    0x03, 0xeb, 0x00, 0x0c, 0x01, 0x57, 0x00, 0x52, 0x02, 0x8e, 0x00, 0x60, 0x04, 0x3c, 0x00, 0x8c,
-    0x02, 0x25, 0xff, 0xaa, 0x01, 0xba, 0x00, 0x37, 0x06, 0xff, 0x00, 0x94, 0x06, 0xf8, 0x00, 0x7c,
-    0x05, 0x4e, 0x00, 0x11, 0x04, 0x50, 0x00, 0x56, 0x04, 0x85, 0x00, 0x94, 0x05, 0xa6, 0x00, 0x92,
-    0x04, 0x49, 0x00, 0x51, 0x04, 0x92, 0x00, 0x84, 0x05, 0xb1, 0x00, 0x46, 0x05, 0xcc, 0x00, 0x52,
-    0x05, 0x18, 0x00, 0x10, 0x04, 0x0d, 0xff, 0xf3, 0x08, 0x75, 0x00, 0x4e, 0x09, 0x6e, 0x00, 0x65,
-    0x04, 0xdb, 0x00, 0x49, 0x04, 0x17, 0x00, 0x4e, 0x05, 0x39, 0x00, 0x66, 0x04, 0x2d, 0x00, 0x4e,
-    0x04, 0xe3, 0x00, 0x08, 0x04, 0x0d, 0x00, 0x1e, 0x02, 0x44, 0x00, 0xa5, 0x07, 0xa9, 0x00, 0x15,
-    0x06, 0x87, 0x00, 0x20, 0x02, 0x44, 0x00, 0xa5, 0x05, 0x4e, 0x00, 0x11, 0x04, 0x50, 0x00, 0x56,
-    0x05, 0x4e, 0x00, 0x11, 0x04, 0x50, 0x00, 0x56, 0x07, 0x7e, 0xff, 0xfc, 0x06, 0xc2, 0x00, 0x48,
-    0x04, 0x85, 0x00, 0x94, 0x04, 0x49, 0x00, 0x51, 0x05, 0x8d, 0x00, 0x55, 0x04, 0x39, 0x00, 0x57,
-    0x04, 0x39, 0x00, 0x57, 0x07, 0xa9, 0x00, 0x15, 0x06, 0x87, 0x00, 0x20, 0x04, 0xdb, 0x00, 0x49,
-    0x04, 0x17, 0x00, 0x4e, 0x05, 0xa6, 0x00, 0x92, 0x04, 0x92, 0x00, 0x84, 0x05, 0xa6, 0x00, 0x92,
-    0x04, 0x92, 0x00, 0x84, 0x05, 0x83, 0x00, 0x65, 0x04, 0x8a, 0x00, 0x4e, 0x05, 0x7a, 0x00, 0x60,
-    0x04, 0x88, 0x00, 0x4d, 0x05, 0x7a, 0x00, 0x60, 0x04, 0x88, 0x00, 0x4d, 0x05, 0x48, 0x00, 0x63,
-    0x04, 0x39, 0x00, 0x50, 0x05, 0x0b, 0x00, 0x32, 0x03, 0xeb, 0x00, 0x0c, 0x05, 0x0b, 0x00, 0x32,
-    0x03, 0xeb, 0x00, 0x0c, 0x05, 0x0b, 0x00, 0x32, 0x03, 0xeb, 0x00, 0x0c, 0x05, 0x85, 0x00, 0x91,
-    0x04, 0x65, 0x00, 0x60, 0x06, 0xf0, 0x00, 0x99, 0x06, 0x6f, 0x00, 0x8f, 0x04, 0x82, 0x00, 0x50,
-    0x05, 0x4e, 0x00, 0x11, 0x04, 0x50, 0x00, 0x56, 0x05, 0x4e, 0x00, 0x11, 0x04, 0x50, 0x00, 0x56,
-    0x05, 0x4e, 0x00, 0x11, 0x04, 0x50, 0x00, 0x56, 0x05, 0x4e, 0x00, 0x11, 0x04, 0x50, 0xff, 0x9f,
-    0x05, 0x4e, 0x00, 0x11, 0x04, 0x50, 0x00, 0x56, 0x05, 0x4e, 0x00, 0x11, 0x04, 0x50, 0x00, 0x56,
-    0x05, 0x4e, 0x00, 0x11, 0x04, 0x50, 0x00, 0x56, 0x05, 0x4e, 0x00, 0x11, 0x04, 0x50, 0x00, 0x56,
-    0x05, 0x4e, 0x00, 0x11, 0x04, 0x50, 0x00, 0x56, 0x05, 0x4e, 0x00, 0x11, 0x04, 0x50, 0x00, 0x56,
-    0x05, 0x4e, 0x00, 0x11, 0x04, 0x50, 0x00, 0x56, 0x05, 0x4e, 0x00, 0x11, 0x04, 0x50, 0x00, 0x56,
-    0x04, 0x85, 0x00, 0x94, 0x04, 0x49, 0x00, 0x51, 0x04, 0x85, 0x00, 0x94, 0x04, 0x49, 0x00, 0x51,
-    0x04, 0x85, 0x00, 0x94, 0x04, 0x49, 0x00, 0x51, 0x04, 0x85, 0x00, 0x94, 0x04, 0x49, 0x00, 0x51,
-    0x04, 0x85, 0xff, 0xdf, 0x04, 0x49, 0xff, 0x94, 0x04, 0x85, 0x00, 0x94, 0x04, 0x49, 0x00, 0x51,
-    0x04, 0x85, 0x00, 0x94, 0x04, 0x49, 0x00, 0x51, 0x04, 0x85, 0x00, 0x94, 0x04, 0x49, 0x00, 0x51,
-    0x02, 0x44, 0x00, 0xa5, 0x02, 0x17, 0x00, 0x90, 0x02, 0x44, 0x00, 0x95, 0x02, 0x0a, 0x00, 0x78,
-    0x05, 0x83, 0x00, 0x65, 0x04, 0x8a, 0x00, 0x4e, 0x05, 0x83, 0x00, 0x65, 0x04, 0x8a, 0x00, 0x4e,
-    0x05, 0x83, 0x00, 0x65, 0x04, 0x8a, 0x00, 0x4e, 0x05, 0x83, 0x00, 0x2c, 0x04, 0x8a, 0xff, 0xaa,
-    0x05, 0x83, 0x00, 0x65, 0x04, 0x8a, 0x00, 0x4e, 0x05, 0x83, 0x00, 0x65, 0x04, 0x8a, 0x00, 0x4e,
-    0x05, 0x83, 0x00, 0x65, 0x04, 0x8a, 0x00, 0x4e, 0x05, 0x91, 0x00, 0x5b, 0x04, 0x9d, 0x00, 0x4d,
-    0x05, 0x91, 0x00, 0x5b, 0x04, 0x9d, 0x00, 0x4d, 0x05, 0x91, 0x00, 0x5b, 0x04, 0x9d, 0x00, 0x4d,
-    0x05, 0x91, 0x00, 0x5b, 0x04, 0x9d, 0x00, 0x4d, 0x05, 0x91, 0x00, 0x5b, 0x04, 0x9d, 0x00, 0x4d,
-    0x05, 0x3c, 0x00, 0x80, 0x04, 0x73, 0x00, 0x77, 0x05, 0x3c, 0x00, 0x80, 0x04, 0x73, 0x00, 0x77,
-    0x05, 0xa3, 0x00, 0x80, 0x04, 0xe6, 0x00, 0x77, 0x05, 0xa3, 0x00, 0x80, 0x04, 0xe6, 0x00, 0x77,
-    0x05, 0xa3, 0x00, 0x80, 0x04, 0xe6, 0x00, 0x77, 0x05, 0xa3, 0x00, 0x80, 0x04, 0xe6, 0x00, 0x77,
-    0x05, 0xa3, 0x00, 0x80, 0x04, 0xe6, 0x00, 0x77, 0x04, 0xe3, 0x00, 0x08, 0x03, 0xeb, 0x00, 0x0c,
-    0x04, 0xe3, 0x00, 0x08, 0x03, 0xeb, 0x00, 0x0c, 0x04, 0xe3, 0x00, 0x08, 0x03, 0xeb, 0x00, 0x0c,
-    0x04, 0xa0, 0x00, 0x50, 0x04, 0xe0, 0x00, 0x2d, 0x03, 0xfa, 0x00, 0x23, 0x05, 0x85, 0x00, 0x91,
-    0x04, 0x65, 0x00, 0x60, 0x04, 0x74, 0x00, 0x99, 0x03, 0x5b, 0x00, 0x83, 0x06, 0x1b, 0x00, 0x0a,
-    0x04, 0xc4, 0xff, 0xcb, 0x04, 0x72, 0x00, 0x7a, 0x05, 0x02, 0xff, 0xd7, 0x05, 0x02, 0xff, 0xd7,
-    0x04, 0x74, 0xff, 0xf4, 0x03, 0x5b, 0xff, 0xdf, 0x05, 0x3c, 0xff, 0xf3, 0x04, 0x44, 0xff, 0xc9,
-    0x04, 0xe3, 0x00, 0x08, 0x04, 0x0d, 0x00, 0x1e, 0x05, 0x0d, 0x00, 0x26, 0x04, 0x06, 0x00, 0x1f,
-    0x04, 0x65, 0x00, 0x62, 0x04, 0x68, 0x00, 0x01, 0x06, 0x2a, 0x00, 0x7b, 0x04, 0x8c, 0x00, 0x52,
-    0x04, 0x8c, 0x00, 0x4e, 0x04, 0x8c, 0x00, 0x37, 0x04, 0x8c, 0x00, 0x7f, 0x04, 0xa0, 0x00, 0x87,
-    0x04, 0xb4, 0x00, 0x7b, 0x04, 0xa0, 0x00, 0x5d, 0x04, 0xb4, 0x00, 0x7c, 0x05, 0x73, 0x00, 0x6b,
-    0x04, 0x89, 0x00, 0x52, 0x05, 0xad, 0x00, 0x94, 0x04, 0x74, 0x00, 0x7a, 0x05, 0x4e, 0x00, 0x11,
-    0x04, 0x50, 0x00, 0x0e, 0x04, 0x85, 0x00, 0x4e, 0x04, 0x49, 0x00, 0x03, 0x02, 0x44, 0xfe, 0xfb,
-    0x02, 0x17, 0xfe, 0xe5, 0x05, 0x83, 0x00, 0x65, 0x04, 0x8a, 0x00, 0x19, 0x05, 0x09, 0x00, 0x35,
-    0x02, 0xd4, 0xff, 0x73, 0x05, 0x3c, 0x00, 0x77, 0x04, 0x73, 0x00, 0x14, 0x04, 0xeb, 0xff, 0x0b,
-    0x05, 0x0d, 0x00, 0x94, 0x04, 0x7f, 0x00, 0x7d, 0x05, 0x39, 0x00, 0x94, 0x04, 0x82, 0x00, 0x50,
-    0x05, 0x39, 0x00, 0x94, 0x04, 0x82, 0x00, 0x50, 0x05, 0xad, 0x00, 0x94, 0x04, 0x72, 0x00, 0x7a,
-    0x05, 0x0e, 0x00, 0x94, 0x04, 0x2c, 0x00, 0x7d, 0x05, 0x0e, 0x00, 0x94, 0x04, 0x2c, 0x00, 0x7d,
-    0x04, 0x52, 0x00, 0x94, 0x02, 0x0a, 0x00, 0x78, 0x06, 0xff, 0x00, 0x94, 0x06, 0xf8, 0x00, 0x7c,
-    0x05, 0xad, 0x00, 0x94, 0x04, 0x74, 0x00, 0x7a, 0x05, 0x83, 0x00, 0x65, 0x05, 0x1b, 0x00, 0x94,
-    0x04, 0x7f, 0x00, 0x7d, 0x05, 0x09, 0x00, 0x94, 0x02, 0xd4, 0x00, 0x71, 0x04, 0xd8, 0x00, 0x4b,
-    0x04, 0x1e, 0x00, 0x49, 0x04, 0xe0, 0x00, 0x2d, 0x02, 0xaa, 0x00, 0x0a, 0x05, 0x3c, 0x00, 0x80,
-    0x05, 0x2a, 0x00, 0x11, 0x03, 0xf8, 0x00, 0x16, 0x05, 0x2a, 0x00, 0x11, 0x03, 0xf8, 0x00, 0x16,
-    0x07, 0x0b, 0x00, 0x2f, 0x05, 0xf0, 0x00, 0x23, 0x04, 0xd3, 0x00, 0x50, 0x04, 0x06, 0x00, 0x51,
-    0x05, 0xc9, 0xfe, 0x6c, 0x04, 0x9a, 0x00, 0x08, 0x04, 0x1c, 0xff, 0x62, 0x05, 0x19, 0xff, 0x6b,
-    0x02, 0x3a, 0xff, 0x6e, 0x04, 0xc7, 0xff, 0x98, 0x04, 0x7a, 0xff, 0x20, 0x04, 0xea, 0xff, 0xab,
-    0x04, 0x9a, 0x00, 0x08, 0x04, 0x60, 0x00, 0x76, 0x03, 0xe0, 0x00, 0x76, 0x04, 0x2b, 0x00, 0x41,
-    0x04, 0xdd, 0x00, 0x76, 0x01, 0xfe, 0x00, 0x86, 0x04, 0x5e, 0x00, 0x76, 0x06, 0x05, 0x00, 0x76,
-    0x04, 0xdc, 0x00, 0x76, 0x04, 0xbd, 0x00, 0x4e, 0x04, 0x6b, 0x00, 0x76, 0x04, 0x3f, 0x00, 0x25,
-    0x04, 0x3e, 0x00, 0x06, 0x04, 0x5c, 0x00, 0x13, 0x01, 0xfe, 0xff, 0x9c, 0x04, 0x3e, 0x00, 0x06,
-    0x03, 0xe0, 0x00, 0x76, 0x03, 0xbc, 0x00, 0x76, 0x04, 0x37, 0x00, 0x3f, 0x01, 0xfe, 0x00, 0x86,
-    0x01, 0xfe, 0xff, 0x9c, 0x03, 0xd6, 0x00, 0x26, 0x04, 0x5e, 0x00, 0x76, 0x04, 0x4c, 0x00, 0x1f,
-    0x04, 0x9a, 0x00, 0x08, 0x04, 0x60, 0x00, 0x76, 0x03, 0xbc, 0x00, 0x76, 0x03, 0xe0, 0x00, 0x76,
-    0x04, 0xe2, 0x00, 0x76, 0x06, 0x05, 0x00, 0x76, 0x04, 0xdd, 0x00, 0x76, 0x04, 0xbd, 0x00, 0x4e,
-    0x04, 0xd9, 0x00, 0x76, 0x04, 0x6b, 0x00, 0x76, 0x04, 0x80, 0x00, 0x4f, 0x04, 0x3f, 0x00, 0x25,
-    0x04, 0x5c, 0x00, 0x13, 0x04, 0x46, 0x00, 0x43, 0x04, 0xdd, 0x00, 0x76, 0x04, 0x80, 0x00, 0x4f,
-    0x04, 0x3e, 0x00, 0x06, 0x06, 0x00, 0x00, 0x0e, 0x04, 0xe2, 0x00, 0x76, 0x04, 0x4c, 0x00, 0x1f,
-    0x05, 0xa6, 0x00, 0x4f, 0x05, 0xd4, 0x00, 0x86, 0x06, 0x46, 0xff, 0xec, 0x04, 0xbd, 0x00, 0x4e,
-    0x04, 0x37, 0x00, 0x3f, 0x06, 0x09, 0x00, 0x27, 0x06, 0x09, 0x00, 0x27, 0x06, 0x09, 0x00, 0x27,
-    0x04, 0x3e, 0x00, 0x06, 0x05, 0x4e, 0x00, 0x11, 0x04, 0x50, 0x00, 0x56, 0x04, 0x85, 0x00, 0x94,
-    0x04, 0x49, 0x00, 0x51, 0x04, 0x9a, 0x00, 0x08, 0x03, 0xe0, 0x00, 0x76, 0x02, 0x17, 0x00, 0x78,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0x0a, 0x01, 0xac, 0x03, 0x00, 0x00, 0x04, 0x44, 0x46, 0x4c, 0x54,
-    0x01, 0x70, 0x63, 0x79, 0x72, 0x6c, 0x01, 0x70, 0x67, 0x72, 0x65, 0x6b, 0x01, 0x70, 0x6c, 0x61,
-    0x74, 0x6e, 0x00, 0x1a, 0x01, 0x26, 0x00, 0x07, 0x41, 0x5a, 0x45, 0x20, 0x00, 0xf6, 0x43, 0x52,
-    0x54, 0x20, 0x00, 0xf6, 0x46, 0x52, 0x41, 0x20, 0x00, 0xc4, 0x4d, 0x4f, 0x4c, 0x20, 0x00, 0x92,
-    0x4e, 0x41, 0x56, 0x20, 0x00, 0x60, 0x52, 0x4f, 0x4d, 0x20, 0x00, 0x2e, 0x54, 0x52, 0x4b, 0x20,
-    0x00, 0xf6, 0x00, 0x00, 0xff, 0xff, 0x00, 0x16, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x03,
-    0x00, 0x04, 0x00, 0x06, 0x00, 0x08, 0x00, 0x0c, 0x00, 0x0d, 0x00, 0x0e, 0x00, 0x0f, 0x00, 0x10,
-    0x00, 0x11, 0x00, 0x12, 0x00, 0x13, 0x00, 0x14, 0x00, 0x15, 0x00, 0x16, 0x00, 0x17, 0x00, 0x18,
-    0x00, 0x19, 0x00, 0x1a, 0x00, 0x00, 0xff, 0xff, 0x00, 0x16, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02,
-    0x00, 0x03, 0x00, 0x04, 0x00, 0x06, 0x00, 0x08, 0x00, 0x0b, 0x00, 0x0d, 0x00, 0x0e, 0x00, 0x0f,
-    0x00, 0x10, 0x00, 0x11, 0x00, 0x12, 0x00, 0x13, 0x00, 0x14, 0x00, 0x15, 0x00, 0x16, 0x00, 0x17,
-    0x00, 0x18, 0x00, 0x19, 0x00, 0x1a, 0x00, 0x00, 0xff, 0xff, 0x00, 0x16, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x02, 0x00, 0x03, 0x00, 0x04, 0x00, 0x06, 0x00, 0x08, 0x00, 0x0a, 0x00, 0x0d, 0x00, 0x0e,
-    0x00, 0x0f, 0x00, 0x10, 0x00, 0x11, 0x00, 0x12, 0x00, 0x13, 0x00, 0x14, 0x00, 0x15, 0x00, 0x16,
-    0x00, 0x17, 0x00, 0x18, 0x00, 0x19, 0x00, 0x1a, 0x00, 0x00, 0xff, 0xff, 0x00, 0x16, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x02, 0x00, 0x03, 0x00, 0x04, 0x00, 0x06, 0x00, 0x08, 0x00, 0x09, 0x00, 0x0d,
-    0x00, 0x0e, 0x00, 0x0f, 0x00, 0x10, 0x00, 0x11, 0x00, 0x12, 0x00, 0x13, 0x00, 0x14, 0x00, 0x15,
-    0x00, 0x16, 0x00, 0x17, 0x00, 0x18, 0x00, 0x19, 0x00, 0x1a, 0x00, 0x00, 0xff, 0xff, 0x00, 0x15,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x03, 0x00, 0x04, 0x00, 0x05, 0x00, 0x08, 0x00, 0x0d,
-    0x00, 0x0e, 0x00, 0x0f, 0x00, 0x10, 0x00, 0x11, 0x00, 0x12, 0x00, 0x13, 0x00, 0x14, 0x00, 0x15,
-    0x00, 0x16, 0x00, 0x17, 0x00, 0x18, 0x00, 0x19, 0x00, 0x1a, 0x00, 0x00, 0xff, 0xff, 0x00, 0x15,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x03, 0x00, 0x04, 0x00, 0x07, 0x00, 0x08, 0x00, 0x0d,
-    0x00, 0x0e, 0x00, 0x0f, 0x00, 0x10, 0x00, 0x11, 0x00, 0x12, 0x00, 0x13, 0x00, 0x14, 0x00, 0x15,
-    0x00, 0x16, 0x00, 0x17, 0x00, 0x18, 0x00, 0x19, 0x00, 0x1a, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00,
-    0xff, 0xff, 0x00, 0x14, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x03, 0x00, 0x04, 0x00, 0x08,
-    0x00, 0x0d, 0x00, 0x0e, 0x00, 0x0f, 0x00, 0x10, 0x00, 0x11, 0x00, 0x12, 0x00, 0x13, 0x00, 0x14,
-    0x00, 0x15, 0x00, 0x16, 0x00, 0x17, 0x00, 0x18, 0x00, 0x19, 0x00, 0x1a, 0x00, 0x1b, 0x63, 0x32,
-    0x73, 0x63, 0x01, 0x4e, 0x63, 0x63, 0x6d, 0x70, 0x01, 0x46, 0x64, 0x6c, 0x69, 0x67, 0x01, 0x40,
-    0x64, 0x6e, 0x6f, 0x6d, 0x01, 0x3a, 0x66, 0x72, 0x61, 0x63, 0x01, 0x30, 0x6c, 0x69, 0x67, 0x61,
-    0x01, 0x2a, 0x6c, 0x69, 0x67, 0x61, 0x01, 0x1e, 0x6c, 0x69, 0x67, 0x61, 0x01, 0x16, 0x6c, 0x6e,
-    0x75, 0x6d, 0x01, 0x10, 0x6c, 0x6f, 0x63, 0x6c, 0x01, 0x0a, 0x6c, 0x6f, 0x63, 0x6c, 0x01, 0x04,
-    0x6c, 0x6f, 0x63, 0x6c, 0x00, 0xfe, 0x6c, 0x6f, 0x63, 0x6c, 0x00, 0xf8, 0x6e, 0x75, 0x6d, 0x72,
-    0x00, 0xf2, 0x6f, 0x6e, 0x75, 0x6d, 0x00, 0xec, 0x70, 0x6e, 0x75, 0x6d, 0x00, 0xe6, 0x73, 0x6d,
-    0x63, 0x70, 0x00, 0xe0, 0x73, 0x73, 0x30, 0x31, 0x00, 0xda, 0x73, 0x73, 0x30, 0x32, 0x00, 0xd4,
-    0x73, 0x73, 0x30, 0x33, 0x00, 0xce, 0x73, 0x73, 0x30, 0x34, 0x00, 0xc8, 0x73, 0x73, 0x30, 0x35,
-    0x00, 0xc2, 0x73, 0x73, 0x30, 0x36, 0x00, 0xbc, 0x73, 0x73, 0x30, 0x37, 0x00, 0xb6, 0x73, 0x75,
-    0x62, 0x73, 0x00, 0xb0, 0x73, 0x75, 0x70, 0x73, 0x00, 0xaa, 0x74, 0x6e, 0x75, 0x6d, 0x00, 0xa4,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x15, 0x00, 0x00, 0x00, 0x01, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x1e, 0x00, 0x00, 0x00, 0x01, 0x00, 0x12, 0x00, 0x00, 0x00, 0x01, 0x00, 0x11, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0e,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x14, 0x00, 0x00, 0x00, 0x01, 0x00, 0x13, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x06, 0x00, 0x00, 0x00, 0x01, 0x00, 0x07,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x05, 0x00, 0x00, 0x00, 0x01, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x16, 0x00, 0x00, 0x00, 0x02, 0x00, 0x09, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x04, 0x00, 0x09,
-    0x00, 0x0a, 0x00, 0x09, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x03,
-    0x00, 0x17, 0x00, 0x18, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x01, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x0b, 0x00, 0x00, 0x00, 0x02, 0x00, 0x02, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0x1f, 0x0e, 0xfc, 0x0b, 0x3e, 0x0a, 0xbe, 0x0a, 0xa4, 0x04, 0x00, 0x03, 0xea, 0x03, 0xea,
-    0x03, 0xc0, 0x03, 0xac, 0x03, 0x82, 0x03, 0x5e, 0x03, 0x22, 0x03, 0x0e, 0x02, 0xfa, 0x02, 0xe6,
-    0x02, 0xcc, 0x02, 0xba, 0x02, 0x78, 0x02, 0x5a, 0x02, 0x08, 0x01, 0xc2, 0x01, 0x60, 0x01, 0x02,
-    0x00, 0xee, 0x00, 0xb4, 0x00, 0x92, 0x00, 0x70, 0x00, 0x92, 0x00, 0x70, 0x00, 0x4e, 0x00, 0x40,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x08, 0x00, 0x01, 0x00, 0x86, 0x01, 0x8e, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x08, 0x00, 0x02, 0x00, 0x78, 0x00, 0x0a, 0x01, 0x95, 0x00, 0x7a,
-    0x00, 0x73, 0x00, 0x74, 0x01, 0x96, 0x01, 0x97, 0x01, 0x98, 0x01, 0x99, 0x01, 0x9a, 0x01, 0x9b,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x08, 0x00, 0x02, 0x00, 0x56, 0x00, 0x0a, 0x02, 0x58,
-    0x00, 0x7a, 0x00, 0x73, 0x00, 0x74, 0x02, 0x59, 0x02, 0x5a, 0x02, 0x5b, 0x02, 0x5c, 0x02, 0x5d,
-    0x02, 0x5e, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x08, 0x00, 0x02, 0x00, 0x34, 0x00, 0x0a,
-    0x01, 0xe1, 0x01, 0xe0, 0x01, 0xdf, 0x02, 0x39, 0x02, 0x3a, 0x02, 0x3b, 0x02, 0x3c, 0x02, 0x3d,
-    0x02, 0x3e, 0x02, 0x3f, 0x00, 0x06, 0x00, 0x00, 0x00, 0x01, 0x00, 0x08, 0x00, 0x03, 0x00, 0x01,
-    0x00, 0x1c, 0x00, 0x01, 0x00, 0x12, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x19, 0x00, 0x02,
-    0x00, 0x01, 0x00, 0x14, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x02, 0x00, 0x03, 0x01, 0x94, 0x01, 0x94,
-    0x00, 0x00, 0x01, 0xdf, 0x01, 0xe1, 0x00, 0x01, 0x02, 0x39, 0x02, 0x3f, 0x00, 0x04, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x08, 0x00, 0x01, 0x00, 0x06, 0x01, 0x81, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x13, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x08, 0x00, 0x02, 0x00, 0x2e, 0x00, 0x14,
-    0x04, 0xac, 0x04, 0xad, 0x02, 0x8b, 0x04, 0xa8, 0x04, 0xa9, 0x04, 0xaa, 0x04, 0xab, 0x02, 0x80,
-    0x04, 0xae, 0x00, 0x17, 0x00, 0x19, 0x00, 0x18, 0x00, 0x16, 0x00, 0x1b, 0x00, 0x14, 0x00, 0x1a,
-    0x00, 0x1d, 0x00, 0x1c, 0x00, 0x15, 0x04, 0xaf, 0x00, 0x02, 0x00, 0x06, 0x00, 0x1a, 0x00, 0x1a,
-    0x00, 0x00, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x01, 0x02, 0x64, 0x02, 0x69, 0x00, 0x02, 0x02, 0x6d,
-    0x02, 0x6d, 0x00, 0x08, 0x02, 0x6f, 0x02, 0x78, 0x00, 0x09, 0x02, 0x7f, 0x02, 0x7f, 0x00, 0x13,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x08, 0x00, 0x02, 0x00, 0x2e, 0x00, 0x14, 0x02, 0x75,
-    0x02, 0x77, 0x02, 0x78, 0x02, 0x72, 0x02, 0x6f, 0x02, 0x71, 0x02, 0x70, 0x02, 0x73, 0x02, 0x76,
-    0x02, 0x74, 0x00, 0x1b, 0x00, 0x15, 0x00, 0x16, 0x00, 0x17, 0x00, 0x18, 0x00, 0x19, 0x00, 0x1a,
-    0x00, 0x1c, 0x00, 0x1d, 0x00, 0x14, 0x00, 0x01, 0x00, 0x14, 0x00, 0x1a, 0x00, 0x1c, 0x02, 0x64,
-    0x02, 0x65, 0x02, 0x66, 0x02, 0x67, 0x02, 0x68, 0x02, 0x69, 0x02, 0x6d, 0x02, 0x7f, 0x02, 0x80,
-    0x02, 0x8b, 0x04, 0xa8, 0x04, 0xa9, 0x04, 0xaa, 0x04, 0xab, 0x04, 0xac, 0x04, 0xad, 0x04, 0xae,
-    0x04, 0xaf, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x08, 0x00, 0x02, 0x00, 0x2e, 0x00, 0x14,
-    0x04, 0xaf, 0x02, 0x8b, 0x04, 0xa8, 0x04, 0xa9, 0x04, 0xaa, 0x04, 0xab, 0x04, 0xac, 0x02, 0x80,
-    0x04, 0xad, 0x04, 0xae, 0x02, 0x66, 0x02, 0x68, 0x02, 0x67, 0x02, 0x65, 0x02, 0x69, 0x02, 0x7f,
-    0x00, 0x1a, 0x02, 0x6d, 0x00, 0x1c, 0x02, 0x64, 0x00, 0x02, 0x00, 0x02, 0x00, 0x14, 0x00, 0x1d,
-    0x00, 0x00, 0x02, 0x6f, 0x02, 0x78, 0x00, 0x0a, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x08,
-    0x00, 0x02, 0x00, 0x2e, 0x00, 0x14, 0x02, 0x74, 0x02, 0x78, 0x02, 0x72, 0x02, 0x6f, 0x02, 0x71,
-    0x02, 0x70, 0x02, 0x75, 0x02, 0x73, 0x02, 0x77, 0x02, 0x76, 0x02, 0x69, 0x02, 0x64, 0x02, 0x65,
-    0x02, 0x66, 0x02, 0x67, 0x02, 0x68, 0x00, 0x1a, 0x00, 0x1c, 0x02, 0x6d, 0x02, 0x7f, 0x00, 0x02,
-    0x00, 0x04, 0x00, 0x14, 0x00, 0x1d, 0x00, 0x00, 0x02, 0x80, 0x02, 0x80, 0x00, 0x0a, 0x02, 0x8b,
-    0x02, 0x8b, 0x00, 0x0b, 0x04, 0xa8, 0x04, 0xaf, 0x00, 0x0c, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x08, 0x00, 0x02, 0x00, 0x0c, 0x00, 0x03, 0x02, 0x88, 0x02, 0x89, 0x02, 0x89, 0x00, 0x01,
-    0x00, 0x03, 0x00, 0x49, 0x00, 0x4b, 0x02, 0x84, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x08,
-    0x00, 0x02, 0x00, 0x1e, 0x00, 0x0c, 0x02, 0x5f, 0x02, 0x61, 0x02, 0x60, 0x02, 0x62, 0x02, 0x63,
-    0x02, 0x81, 0x02, 0x82, 0x02, 0x83, 0x02, 0x84, 0x02, 0x85, 0x02, 0x86, 0x02, 0x87, 0x00, 0x01,
-    0x00, 0x0c, 0x00, 0x27, 0x00, 0x28, 0x00, 0x2b, 0x00, 0x33, 0x00, 0x35, 0x00, 0x46, 0x00, 0x47,
-    0x00, 0x48, 0x00, 0x4b, 0x00, 0x53, 0x00, 0x54, 0x00, 0x55, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x08, 0x00, 0x02, 0x00, 0x1c, 0x00, 0x02, 0x02, 0x48, 0x02, 0x49, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x08, 0x00, 0x02, 0x00, 0x0a, 0x00, 0x02, 0x02, 0x46, 0x02, 0x47, 0x00, 0x01,
-    0x00, 0x02, 0x00, 0x2f, 0x00, 0x4f, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x08, 0x00, 0x01,
-    0x00, 0x06, 0x02, 0x0f, 0x00, 0x01, 0x00, 0x01, 0x00, 0x36, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x08, 0x00, 0x01, 0x00, 0x06, 0x01, 0x89, 0x00, 0x01, 0x00, 0x01, 0x00, 0xbb, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x08, 0x00, 0x01, 0x00, 0x06, 0x01, 0xf8, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x4b, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x08, 0x00, 0x01, 0x00, 0x2a, 0x00, 0x03,
-    0x00, 0x20, 0x00, 0x16, 0x00, 0x0c, 0x00, 0x01, 0x00, 0x04, 0x01, 0xda, 0x00, 0x02, 0x00, 0x58,
-    0x00, 0x01, 0x00, 0x04, 0x01, 0xdb, 0x00, 0x02, 0x00, 0x58, 0x00, 0x01, 0x00, 0x04, 0x01, 0xd5,
-    0x00, 0x02, 0x00, 0x4a, 0x00, 0x01, 0x00, 0x03, 0x00, 0x4a, 0x00, 0x57, 0x00, 0x95, 0x00, 0x04,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x08, 0x00, 0x01, 0x00, 0x40, 0x00, 0x01, 0x00, 0x08, 0x00, 0x02,
-    0x00, 0x0c, 0x00, 0x06, 0x01, 0xd7, 0x00, 0x02, 0x00, 0x50, 0x01, 0xd9, 0x00, 0x03, 0x00, 0x4a,
-    0x00, 0x50, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x08, 0x00, 0x01, 0x00, 0x1c, 0x00, 0x01,
-    0x00, 0x08, 0x00, 0x02, 0x00, 0x0c, 0x00, 0x06, 0x01, 0xd6, 0x00, 0x02, 0x00, 0x4d, 0x01, 0xd8,
-    0x00, 0x03, 0x00, 0x4a, 0x00, 0x4d, 0x00, 0x01, 0x00, 0x01, 0x00, 0x4a, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x08, 0x00, 0x01, 0x00, 0x06, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x01, 0x7b,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x08, 0x00, 0x02, 0x00, 0x12, 0x00, 0x06, 0x05, 0x22,
-    0x05, 0x23, 0x05, 0x24, 0x05, 0x25, 0x05, 0x26, 0x05, 0x27, 0x00, 0x01, 0x00, 0x06, 0x02, 0xd5,
-    0x02, 0xd6, 0x02, 0xe7, 0x02, 0xe8, 0x03, 0x6a, 0x03, 0x73, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x08, 0x00, 0x01, 0x00, 0x06, 0x00, 0x02, 0x00, 0x01, 0x00, 0x02, 0x03, 0x23, 0x03, 0x24,
-    0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x08, 0x00, 0x01, 0x06, 0x32, 0x00, 0x36, 0x06, 0x00,
-    0x05, 0xf6, 0x05, 0xec, 0x05, 0xda, 0x05, 0xa8, 0x05, 0x96, 0x05, 0x8c, 0x05, 0x5a, 0x05, 0x40,
-    0x05, 0x26, 0x05, 0x14, 0x04, 0xea, 0x04, 0xae, 0x04, 0xa4, 0x04, 0x82, 0x04, 0x68, 0x04, 0x56,
-    0x04, 0x1a, 0x04, 0x08, 0x03, 0xee, 0x03, 0xc4, 0x03, 0xb2, 0x03, 0x80, 0x03, 0x76, 0x03, 0x6c,
-    0x03, 0x5a, 0x03, 0x28, 0x03, 0x1e, 0x03, 0x14, 0x03, 0x0a, 0x02, 0xf0, 0x02, 0xd6, 0x02, 0xc4,
-    0x02, 0x9a, 0x02, 0x68, 0x02, 0x5e, 0x02, 0x3c, 0x02, 0x22, 0x02, 0x10, 0x01, 0xde, 0x01, 0xcc,
-    0x01, 0xb2, 0x01, 0x88, 0x01, 0x76, 0x01, 0x6c, 0x01, 0x62, 0x01, 0x58, 0x01, 0x4e, 0x01, 0x24,
-    0x00, 0xfa, 0x00, 0xd0, 0x00, 0xa6, 0x00, 0x7c, 0x00, 0x72, 0x00, 0x01, 0x00, 0x04, 0x04, 0xc0,
-    0x00, 0x02, 0x00, 0xa9, 0x00, 0x05, 0x00, 0x24, 0x00, 0x1e, 0x00, 0x18, 0x00, 0x12, 0x00, 0x0c,
-    0x04, 0x88, 0x00, 0x02, 0x00, 0xaa, 0x04, 0x86, 0x00, 0x02, 0x00, 0xab, 0x04, 0x84, 0x00, 0x02,
-    0x00, 0xa8, 0x04, 0x8a, 0x00, 0x02, 0x00, 0xad, 0x04, 0x82, 0x00, 0x02, 0x00, 0xa9, 0x00, 0x05,
-    0x00, 0x24, 0x00, 0x1e, 0x00, 0x18, 0x00, 0x12, 0x00, 0x0c, 0x04, 0x87, 0x00, 0x02, 0x00, 0xaa,
-    0x04, 0x85, 0x00, 0x02, 0x00, 0xab, 0x04, 0x83, 0x00, 0x02, 0x00, 0xa8, 0x04, 0x89, 0x00, 0x02,
-    0x00, 0xad, 0x04, 0x81, 0x00, 0x02, 0x00, 0xa9, 0x00, 0x05, 0x00, 0x24, 0x00, 0x1e, 0x00, 0x18,
-    0x00, 0x12, 0x00, 0x0c, 0x04, 0x7a, 0x00, 0x02, 0x00, 0xaa, 0x04, 0x78, 0x00, 0x02, 0x00, 0xab,
-    0x04, 0x76, 0x00, 0x02, 0x00, 0xa8, 0x04, 0x7c, 0x00, 0x02, 0x00, 0xad, 0x04, 0x74, 0x00, 0x02,
-    0x00, 0xa9, 0x00, 0x05, 0x00, 0x24, 0x00, 0x1e, 0x00, 0x18, 0x00, 0x12, 0x00, 0x0c, 0x04, 0x79,
-    0x00, 0x02, 0x00, 0xaa, 0x04, 0x77, 0x00, 0x02, 0x00, 0xab, 0x04, 0x75, 0x00, 0x02, 0x00, 0xa8,
-    0x04, 0x7b, 0x00, 0x02, 0x00, 0xad, 0x04, 0x73, 0x00, 0x02, 0x00, 0xa9, 0x00, 0x05, 0x00, 0x24,
-    0x00, 0x1e, 0x00, 0x18, 0x00, 0x12, 0x00, 0x0c, 0x04, 0xb9, 0x00, 0x02, 0x00, 0xac, 0x02, 0xf6,
-    0x00, 0x02, 0x00, 0xaa, 0x04, 0x62, 0x00, 0x02, 0x00, 0xab, 0x02, 0xc1, 0x00, 0x02, 0x00, 0xa8,
-    0x02, 0xc2, 0x00, 0x02, 0x00, 0xa9, 0x00, 0x01, 0x00, 0x04, 0x03, 0x49, 0x00, 0x02, 0x00, 0xa9,
-    0x00, 0x01, 0x00, 0x04, 0x03, 0x47, 0x00, 0x02, 0x00, 0xa9, 0x00, 0x01, 0x00, 0x04, 0x03, 0x48,
-    0x00, 0x02, 0x00, 0xa9, 0x00, 0x01, 0x00, 0x04, 0x03, 0x46, 0x00, 0x02, 0x00, 0xa9, 0x00, 0x02,
-    0x00, 0x0c, 0x00, 0x06, 0x04, 0xe4, 0x00, 0x02, 0x00, 0xad, 0x03, 0x41, 0x00, 0x02, 0x00, 0xa9,
-    0x00, 0x05, 0x00, 0x24, 0x00, 0x1e, 0x00, 0x18, 0x00, 0x12, 0x00, 0x0c, 0x04, 0x90, 0x00, 0x02,
-    0x00, 0xaa, 0x04, 0x8e, 0x00, 0x02, 0x00, 0xab, 0x03, 0xf5, 0x00, 0x02, 0x00, 0xa8, 0x04, 0x8c,
-    0x00, 0x02, 0x00, 0xad, 0x02, 0xcf, 0x00, 0x02, 0x00, 0xa9, 0x00, 0x03, 0x00, 0x14, 0x00, 0x0e,
-    0x00, 0x08, 0x03, 0xef, 0x00, 0x02, 0x00, 0xa8, 0x04, 0xe2, 0x00, 0x02, 0x00, 0xad, 0x03, 0xf1,
-    0x00, 0x02, 0x00, 0xa9, 0x00, 0x02, 0x00, 0x0c, 0x00, 0x06, 0x04, 0xde, 0x00, 0x02, 0x00, 0xaa,
-    0x04, 0xe0, 0x00, 0x02, 0x00, 0xad, 0x00, 0x06, 0x00, 0x2c, 0x00, 0x26, 0x00, 0x20, 0x00, 0x1a,
-    0x00, 0x14, 0x00, 0x0e, 0x04, 0xbf, 0x00, 0x02, 0x00, 0xac, 0x03, 0x30, 0x00, 0x02, 0x00, 0xaa,
-    0x04, 0x80, 0x00, 0x02, 0x00, 0xab, 0x02, 0xcb, 0x00, 0x02, 0x00, 0xa8, 0x04, 0x7e, 0x00, 0x02,
-    0x00, 0xad, 0x02, 0xcc, 0x00, 0x02, 0x00, 0xa9, 0x00, 0x02, 0x00, 0x0c, 0x00, 0x06, 0x04, 0xdb,
-    0x00, 0x02, 0x00, 0xad, 0x03, 0x2a, 0x00, 0x02, 0x01, 0xd4, 0x00, 0x03, 0x00, 0x14, 0x00, 0x0e,
-    0x00, 0x08, 0x04, 0xd9, 0x00, 0x02, 0x00, 0xad, 0x03, 0x26, 0x00, 0x02, 0x01, 0xd4, 0x03, 0x20,
-    0x00, 0x02, 0x00, 0xa9, 0x00, 0x04, 0x00, 0x1c, 0x00, 0x16, 0x00, 0x10, 0x00, 0x0a, 0x04, 0xbd,
-    0x00, 0x02, 0x00, 0xac, 0x04, 0xd7, 0x00, 0x02, 0x00, 0xad, 0x03, 0x1c, 0x00, 0x02, 0x01, 0xd4,
-    0x03, 0x1a, 0x00, 0x02, 0x00, 0xa9, 0x00, 0x01, 0x00, 0x04, 0x04, 0xd5, 0x00, 0x02, 0x00, 0xa9,
-    0x00, 0x06, 0x00, 0x2c, 0x00, 0x26, 0x00, 0x20, 0x00, 0x1a, 0x00, 0x14, 0x00, 0x0e, 0x04, 0xbb,
-    0x00, 0x02, 0x00, 0xac, 0x02, 0xc9, 0x00, 0x02, 0x00, 0xaa, 0x04, 0x68, 0x00, 0x02, 0x00, 0xab,
-    0x02, 0xc6, 0x00, 0x02, 0x00, 0xa8, 0x04, 0x66, 0x00, 0x02, 0x00, 0xad, 0x02, 0xc7, 0x00, 0x02,
-    0x00, 0xa9, 0x00, 0x05, 0x00, 0x24, 0x00, 0x1e, 0x00, 0x18, 0x00, 0x12, 0x00, 0x0c, 0x02, 0xc5,
-    0x00, 0x02, 0x00, 0xaa, 0x04, 0xb3, 0x00, 0x02, 0x00, 0xa8, 0x04, 0xd2, 0x00, 0x02, 0x00, 0xad,
-    0x03, 0x0f, 0x00, 0x02, 0x01, 0xd4, 0x03, 0x0d, 0x00, 0x02, 0x00, 0xa9, 0x00, 0x02, 0x00, 0x0c,
-    0x00, 0x06, 0x04, 0xd0, 0x00, 0x02, 0x00, 0xad, 0x03, 0xfc, 0x00, 0x02, 0x00, 0xa9, 0x00, 0x03,
-    0x00, 0x14, 0x00, 0x0e, 0x00, 0x08, 0x04, 0xce, 0x00, 0x02, 0x00, 0xad, 0x03, 0x07, 0x00, 0x02,
-    0x01, 0xd4, 0x03, 0x05, 0x00, 0x02, 0x00, 0xa9, 0x00, 0x03, 0x00, 0x14, 0x00, 0x0e, 0x00, 0x08,
-    0x04, 0xcc, 0x00, 0x02, 0x00, 0xad, 0x03, 0x03, 0x00, 0x02, 0x01, 0xd4, 0x04, 0xca, 0x00, 0x02,
-    0x00, 0xa9, 0x00, 0x01, 0x00, 0x04, 0x04, 0x64, 0x00, 0x02, 0x00, 0xad, 0x00, 0x01, 0x00, 0x04,
-    0x04, 0xc8, 0x00, 0x02, 0x00, 0xad, 0x00, 0x01, 0x00, 0x04, 0x04, 0xb1, 0x00, 0x02, 0x00, 0xa9,
-    0x00, 0x06, 0x00, 0x2c, 0x00, 0x26, 0x00, 0x20, 0x00, 0x1a, 0x00, 0x14, 0x00, 0x0e, 0x04, 0xb7,
-    0x00, 0x02, 0x00, 0xac, 0x04, 0x56, 0x00, 0x02, 0x00, 0xaa, 0x04, 0x54, 0x00, 0x02, 0x00, 0xab,
-    0x02, 0xbd, 0x00, 0x02, 0x00, 0xa8, 0x04, 0x52, 0x00, 0x02, 0x00, 0xad, 0x02, 0xbe, 0x00, 0x02,
-    0x00, 0xa9, 0x00, 0x02, 0x00, 0x0c, 0x00, 0x06, 0x04, 0xc4, 0x00, 0x02, 0x00, 0xad, 0x04, 0xc6,
-    0x00, 0x02, 0x01, 0xd4, 0x00, 0x01, 0x00, 0x04, 0x02, 0xd8, 0x00, 0x02, 0x00, 0xa9, 0x00, 0x01,
-    0x00, 0x04, 0x04, 0xc2, 0x00, 0x02, 0x00, 0xad, 0x00, 0x06, 0x00, 0x2c, 0x00, 0x26, 0x00, 0x20,
-    0x00, 0x1a, 0x00, 0x14, 0x00, 0x0e, 0x04, 0xb5, 0x00, 0x02, 0x00, 0xac, 0x02, 0xb8, 0x00, 0x02,
-    0x00, 0xaa, 0x04, 0x3c, 0x00, 0x02, 0x00, 0xab, 0x02, 0xb5, 0x00, 0x02, 0x00, 0xa8, 0x04, 0x3a,
-    0x00, 0x02, 0x00, 0xad, 0x02, 0xb6, 0x00, 0x02, 0x00, 0xa9, 0x00, 0x02, 0x00, 0x0c, 0x00, 0x06,
-    0x04, 0xe3, 0x00, 0x02, 0x00, 0xad, 0x03, 0x40, 0x00, 0x02, 0x00, 0xa9, 0x00, 0x05, 0x00, 0x24,
-    0x00, 0x1e, 0x00, 0x18, 0x00, 0x12, 0x00, 0x0c, 0x04, 0x8f, 0x00, 0x02, 0x00, 0xaa, 0x04, 0x8d,
-    0x00, 0x02, 0x00, 0xab, 0x03, 0xf4, 0x00, 0x02, 0x00, 0xa8, 0x04, 0x8b, 0x00, 0x02, 0x00, 0xad,
-    0x02, 0xb4, 0x00, 0x02, 0x00, 0xa9, 0x00, 0x03, 0x00, 0x14, 0x00, 0x0e, 0x00, 0x08, 0x03, 0xee,
-    0x00, 0x02, 0x00, 0xa8, 0x04, 0xe1, 0x00, 0x02, 0x00, 0xad, 0x03, 0xf0, 0x00, 0x02, 0x00, 0xa9,
-    0x00, 0x02, 0x00, 0x0c, 0x00, 0x06, 0x04, 0xdd, 0x00, 0x02, 0x00, 0xaa, 0x04, 0xdf, 0x00, 0x02,
-    0x00, 0xad, 0x00, 0x07, 0x00, 0x34, 0x00, 0x2e, 0x00, 0x28, 0x00, 0x22, 0x00, 0x1c, 0x00, 0x16,
-    0x00, 0x10, 0x04, 0xbe, 0x00, 0x02, 0x00, 0xac, 0x03, 0x2f, 0x00, 0x02, 0x00, 0xaa, 0x04, 0x7f,
-    0x00, 0x02, 0x00, 0xab, 0x02, 0xb0, 0x00, 0x02, 0x00, 0xa8, 0x04, 0x7d, 0x00, 0x02, 0x00, 0xad,
-    0x02, 0xb1, 0x00, 0x02, 0x00, 0xa9, 0x04, 0xdc, 0x00, 0x03, 0x00, 0xaa, 0x00, 0xa9, 0x00, 0x02,
-    0x00, 0x0c, 0x00, 0x06, 0x04, 0xda, 0x00, 0x02, 0x00, 0xad, 0x03, 0x29, 0x00, 0x02, 0x01, 0xd4,
-    0x00, 0x03, 0x00, 0x14, 0x00, 0x0e, 0x00, 0x08, 0x04, 0xd8, 0x00, 0x02, 0x00, 0xad, 0x03, 0x25,
-    0x00, 0x02, 0x01, 0xd4, 0x03, 0x1f, 0x00, 0x02, 0x00, 0xa9, 0x00, 0x04, 0x00, 0x1c, 0x00, 0x16,
-    0x00, 0x10, 0x00, 0x0a, 0x04, 0xbc, 0x00, 0x02, 0x00, 0xac, 0x04, 0xd6, 0x00, 0x02, 0x00, 0xad,
-    0x03, 0x1b, 0x00, 0x02, 0x01, 0xd4, 0x03, 0x19, 0x00, 0x02, 0x00, 0xa9, 0x00, 0x01, 0x00, 0x04,
-    0x04, 0xd4, 0x00, 0x02, 0x00, 0xa9, 0x00, 0x07, 0x00, 0x34, 0x00, 0x2e, 0x00, 0x28, 0x00, 0x22,
-    0x00, 0x1c, 0x00, 0x16, 0x00, 0x10, 0x04, 0xba, 0x00, 0x02, 0x00, 0xac, 0x02, 0xae, 0x00, 0x02,
-    0x00, 0xaa, 0x04, 0x67, 0x00, 0x02, 0x00, 0xab, 0x02, 0xab, 0x00, 0x02, 0x00, 0xa8, 0x04, 0x65,
-    0x00, 0x02, 0x00, 0xad, 0x02, 0xac, 0x00, 0x02, 0x00, 0xa9, 0x04, 0xd3, 0x00, 0x03, 0x00, 0xaa,
-    0x00, 0xa9, 0x00, 0x05, 0x00, 0x24, 0x00, 0x1e, 0x00, 0x18, 0x00, 0x12, 0x00, 0x0c, 0x02, 0xaa,
-    0x00, 0x02, 0x00, 0xaa, 0x04, 0xb2, 0x00, 0x02, 0x00, 0xa8, 0x04, 0xd1, 0x00, 0x02, 0x00, 0xad,
-    0x03, 0x0e, 0x00, 0x02, 0x01, 0xd4, 0x03, 0x0c, 0x00, 0x02, 0x00, 0xa9, 0x00, 0x02, 0x00, 0x0c,
-    0x00, 0x06, 0x04, 0xcf, 0x00, 0x02, 0x00, 0xad, 0x03, 0xfb, 0x00, 0x02, 0x00, 0xa9, 0x00, 0x03,
-    0x00, 0x14, 0x00, 0x0e, 0x00, 0x08, 0x04, 0xcd, 0x00, 0x02, 0x00, 0xad, 0x03, 0x06, 0x00, 0x02,
-    0x01, 0xd4, 0x03, 0x04, 0x00, 0x02, 0x00, 0xa9, 0x00, 0x03, 0x00, 0x14, 0x00, 0x0e, 0x00, 0x08,
-    0x04, 0xcb, 0x00, 0x02, 0x00, 0xad, 0x03, 0x02, 0x00, 0x02, 0x01, 0xd4, 0x04, 0xc9, 0x00, 0x02,
-    0x00, 0xa9, 0x00, 0x06, 0x00, 0x2c, 0x00, 0x26, 0x00, 0x20, 0x00, 0x1a, 0x00, 0x14, 0x00, 0x0e,
-    0x04, 0xb8, 0x00, 0x02, 0x00, 0xac, 0x02, 0xf5, 0x00, 0x02, 0x00, 0xaa, 0x04, 0x61, 0x00, 0x02,
-    0x00, 0xab, 0x02, 0xa6, 0x00, 0x02, 0x00, 0xa8, 0x04, 0x63, 0x00, 0x02, 0x00, 0xad, 0x02, 0xa7,
-    0x00, 0x02, 0x00, 0xa9, 0x00, 0x01, 0x00, 0x04, 0x04, 0xc7, 0x00, 0x02, 0x00, 0xad, 0x00, 0x02,
-    0x00, 0x0c, 0x00, 0x06, 0x02, 0xf1, 0x00, 0x02, 0x01, 0xd4, 0x04, 0xb0, 0x00, 0x02, 0x00, 0xa9,
-    0x00, 0x06, 0x00, 0x2c, 0x00, 0x26, 0x00, 0x20, 0x00, 0x1a, 0x00, 0x14, 0x00, 0x0e, 0x04, 0xb6,
-    0x00, 0x02, 0x00, 0xac, 0x04, 0x55, 0x00, 0x02, 0x00, 0xaa, 0x04, 0x53, 0x00, 0x02, 0x00, 0xab,
-    0x02, 0xa2, 0x00, 0x02, 0x00, 0xa8, 0x04, 0x51, 0x00, 0x02, 0x00, 0xad, 0x02, 0xa3, 0x00, 0x02,
-    0x00, 0xa9, 0x00, 0x02, 0x00, 0x0c, 0x00, 0x06, 0x04, 0xc3, 0x00, 0x02, 0x00, 0xad, 0x04, 0xc5,
-    0x00, 0x02, 0x01, 0xd4, 0x00, 0x01, 0x00, 0x04, 0x02, 0xd7, 0x00, 0x02, 0x00, 0xa9, 0x00, 0x01,
-    0x00, 0x04, 0x04, 0xc1, 0x00, 0x02, 0x00, 0xad, 0x00, 0x06, 0x00, 0x2c, 0x00, 0x26, 0x00, 0x20,
-    0x00, 0x1a, 0x00, 0x14, 0x00, 0x0e, 0x04, 0xb4, 0x00, 0x02, 0x00, 0xac, 0x02, 0x9d, 0x00, 0x02,
-    0x00, 0xaa, 0x04, 0x3b, 0x00, 0x02, 0x00, 0xab, 0x02, 0x9a, 0x00, 0x02, 0x00, 0xa8, 0x04, 0x39,
-    0x00, 0x02, 0x00, 0xad, 0x02, 0x9b, 0x00, 0x02, 0x00, 0xa9, 0x00, 0x02, 0x00, 0x11, 0x00, 0x25,
-    0x00, 0x29, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x2d, 0x00, 0x05, 0x00, 0x2f, 0x00, 0x34, 0x00, 0x08,
-    0x00, 0x36, 0x00, 0x3b, 0x00, 0x0e, 0x00, 0x3d, 0x00, 0x3e, 0x00, 0x14, 0x00, 0x45, 0x00, 0x49,
-    0x00, 0x16, 0x00, 0x4b, 0x00, 0x4d, 0x00, 0x1b, 0x00, 0x4f, 0x00, 0x54, 0x00, 0x1e, 0x00, 0x56,
-    0x00, 0x5b, 0x00, 0x24, 0x00, 0x5d, 0x00, 0x5e, 0x00, 0x2a, 0x00, 0x81, 0x00, 0x81, 0x00, 0x2c,
-    0x00, 0x83, 0x00, 0x83, 0x00, 0x2d, 0x00, 0x86, 0x00, 0x86, 0x00, 0x2e, 0x00, 0x89, 0x00, 0x89,
-    0x00, 0x2f, 0x00, 0x8d, 0x00, 0x8d, 0x00, 0x30, 0x00, 0x98, 0x00, 0x9b, 0x00, 0x31, 0x00, 0xd0,
-    0x00, 0xd0, 0x00, 0x35, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x08, 0x00, 0x02, 0x00, 0x82,
-    0x00, 0x06, 0x02, 0x7b, 0x02, 0x79, 0x02, 0x7c, 0x02, 0x7d, 0x02, 0x7a, 0x05, 0x28, 0x00, 0x06,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x08, 0x00, 0x02, 0x00, 0x68, 0x00, 0x64, 0x00, 0x3c, 0x00, 0x2c,
-    0x00, 0x07, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x1a, 0x00, 0x1a, 0x00, 0x1a, 0x00, 0x1a, 0x00, 0x1a,
-    0x00, 0x01, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0x03, 0x00, 0x02, 0x00, 0x02, 0x00, 0xa8, 0x00, 0xac, 0x00, 0x01, 0x01, 0x24, 0x01, 0x27,
-    0x00, 0x01, 0x00, 0x02, 0x00, 0x06, 0x00, 0x4d, 0x00, 0x4d, 0x00, 0x06, 0x00, 0x4e, 0x00, 0x4e,
-    0x00, 0x04, 0x02, 0xfc, 0x02, 0xfc, 0x00, 0x05, 0x03, 0xe9, 0x03, 0xe9, 0x00, 0x03, 0x03, 0xeb,
-    0x03, 0xeb, 0x00, 0x02, 0x04, 0x64, 0x04, 0x64, 0x00, 0x01, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x06, 0x00, 0x4d, 0x00, 0x4e, 0x02, 0xfc, 0x03, 0xe9, 0x03, 0xeb, 0x04, 0x64, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x08, 0x00, 0x02, 0x01, 0xdc, 0x00, 0xeb, 0x02, 0x8c, 0x02, 0x4d,
-    0x02, 0x4c, 0x02, 0x4b, 0x02, 0x4a, 0x02, 0x42, 0x02, 0x00, 0x01, 0xff, 0x01, 0xfe, 0x01, 0xfd,
-    0x01, 0xfc, 0x01, 0xfb, 0x01, 0xfa, 0x01, 0xf9, 0x01, 0xf8, 0x01, 0xf7, 0x01, 0xf6, 0x01, 0xf5,
-    0x01, 0xf4, 0x01, 0xf3, 0x01, 0xf2, 0x01, 0xf1, 0x01, 0xf0, 0x01, 0xef, 0x01, 0xee, 0x01, 0xed,
-    0x01, 0xec, 0x02, 0x7e, 0x02, 0x8e, 0x03, 0x4b, 0x02, 0x90, 0x02, 0x8f, 0x03, 0x4a, 0x01, 0xfd,
-    0x02, 0x8d, 0x02, 0x92, 0x02, 0x6c, 0x04, 0xed, 0x04, 0xee, 0x02, 0x04, 0x02, 0x05, 0x04, 0xef,
-    0x04, 0xf0, 0x04, 0xf1, 0x02, 0x06, 0x04, 0xf2, 0x02, 0x07, 0x02, 0x08, 0x02, 0x09, 0x04, 0xf7,
-    0x02, 0x0a, 0x02, 0x0a, 0x04, 0xf8, 0x04, 0xf9, 0x02, 0x0b, 0x02, 0x0c, 0x02, 0x0d, 0x02, 0x14,
-    0x05, 0x06, 0x05, 0x07, 0x02, 0x15, 0x02, 0x16, 0x02, 0x17, 0x02, 0x18, 0x02, 0x19, 0x02, 0x1a,
-    0x05, 0x0a, 0x05, 0x0b, 0x05, 0x0d, 0x05, 0x10, 0x05, 0x19, 0x02, 0x1c, 0x02, 0x1d, 0x02, 0x1e,
-    0x02, 0x1f, 0x02, 0x20, 0x02, 0x21, 0x02, 0x22, 0x02, 0x23, 0x02, 0x24, 0x02, 0x25, 0x02, 0x0e,
-    0x02, 0x0f, 0x02, 0x10, 0x02, 0x11, 0x02, 0x12, 0x02, 0x13, 0x02, 0x55, 0x02, 0x27, 0x02, 0x28,
-    0x02, 0x29, 0x02, 0x2a, 0x05, 0x13, 0x02, 0x2b, 0x02, 0x2d, 0x02, 0x2e, 0x02, 0x2f, 0x02, 0x31,
-    0x02, 0x33, 0x02, 0x91, 0x03, 0x4c, 0x03, 0x4d, 0x03, 0x4e, 0x03, 0x4f, 0x03, 0x50, 0x03, 0x51,
-    0x03, 0x52, 0x03, 0x53, 0x03, 0x54, 0x03, 0x55, 0x03, 0x56, 0x03, 0x57, 0x03, 0x58, 0x03, 0x59,
-    0x03, 0x5a, 0x03, 0x5b, 0x03, 0x5c, 0x03, 0x5d, 0x03, 0x5e, 0x03, 0x5f, 0x03, 0x60, 0x03, 0x61,
-    0x03, 0x62, 0x03, 0x63, 0x03, 0x64, 0x03, 0x65, 0x03, 0x66, 0x03, 0x67, 0x03, 0x9d, 0x03, 0x68,
-    0x03, 0x69, 0x03, 0x6a, 0x03, 0x6b, 0x03, 0x6c, 0x03, 0x6d, 0x03, 0x6e, 0x03, 0x6f, 0x03, 0x70,
-    0x03, 0x71, 0x03, 0x72, 0x03, 0x73, 0x03, 0x74, 0x03, 0x75, 0x03, 0x76, 0x03, 0x77, 0x03, 0x78,
-    0x03, 0x79, 0x03, 0x7a, 0x03, 0x7b, 0x03, 0x7c, 0x03, 0x7d, 0x05, 0x1a, 0x03, 0x7f, 0x03, 0x80,
-    0x03, 0x81, 0x03, 0x82, 0x03, 0x83, 0x03, 0x84, 0x03, 0x85, 0x03, 0x86, 0x03, 0x87, 0x03, 0x88,
-    0x03, 0x89, 0x03, 0x8a, 0x03, 0x8b, 0x03, 0x8c, 0x03, 0x8d, 0x03, 0x8e, 0x03, 0x8f, 0x03, 0x90,
-    0x05, 0x1d, 0x03, 0x91, 0x03, 0x92, 0x03, 0x94, 0x03, 0x93, 0x03, 0x95, 0x03, 0x96, 0x03, 0x97,
-    0x03, 0x98, 0x03, 0x99, 0x03, 0x9a, 0x03, 0x9b, 0x03, 0x9c, 0x03, 0x9e, 0x03, 0x9f, 0x03, 0xa0,
-    0x05, 0x1b, 0x05, 0x1c, 0x04, 0xe6, 0x04, 0xe7, 0x04, 0xe8, 0x04, 0xe9, 0x04, 0xf3, 0x04, 0xf6,
-    0x04, 0xf4, 0x04, 0xf5, 0x04, 0xfa, 0x04, 0xfb, 0x04, 0xfc, 0x04, 0xea, 0x04, 0xeb, 0x04, 0xec,
-    0x05, 0x05, 0x05, 0x08, 0x05, 0x09, 0x05, 0x0c, 0x05, 0x0e, 0x05, 0x0f, 0x02, 0x1b, 0x05, 0x11,
-    0x04, 0xfd, 0x04, 0xfe, 0x04, 0xff, 0x05, 0x00, 0x05, 0x01, 0x05, 0x02, 0x05, 0x03, 0x05, 0x04,
-    0x05, 0x1e, 0x05, 0x1f, 0x05, 0x20, 0x05, 0x21, 0x05, 0x12, 0x05, 0x14, 0x05, 0x15, 0x02, 0x32,
-    0x05, 0x17, 0x02, 0x34, 0x05, 0x18, 0x05, 0x16, 0x02, 0x30, 0x02, 0x26, 0x02, 0x2c, 0x05, 0x26,
-    0x05, 0x27, 0x00, 0x01, 0x00, 0xeb, 0x00, 0x0a, 0x00, 0x45, 0x00, 0x46, 0x00, 0x47, 0x00, 0x48,
-    0x00, 0x49, 0x00, 0x4a, 0x00, 0x4b, 0x00, 0x4c, 0x00, 0x4d, 0x00, 0x4e, 0x00, 0x4f, 0x00, 0x50,
-    0x00, 0x51, 0x00, 0x52, 0x00, 0x53, 0x00, 0x54, 0x00, 0x55, 0x00, 0x56, 0x00, 0x57, 0x00, 0x58,
-    0x00, 0x59, 0x00, 0x5a, 0x00, 0x5b, 0x00, 0x5c, 0x00, 0x5d, 0x00, 0x5e, 0x00, 0x85, 0x00, 0x86,
-    0x00, 0x87, 0x00, 0x89, 0x00, 0x8a, 0x00, 0x8b, 0x00, 0x8d, 0x00, 0x90, 0x00, 0x92, 0x00, 0x94,
-    0x00, 0xbb, 0x00, 0xbc, 0x00, 0xbd, 0x00, 0xbe, 0x00, 0xbf, 0x00, 0xc0, 0x00, 0xc1, 0x00, 0xc2,
-    0x00, 0xc3, 0x00, 0xc4, 0x00, 0xc5, 0x00, 0xc6, 0x00, 0xc7, 0x00, 0xc8, 0x00, 0xc9, 0x00, 0xca,
-    0x00, 0xcb, 0x00, 0xcc, 0x00, 0xcd, 0x00, 0xce, 0x00, 0xea, 0x00, 0xeb, 0x00, 0xec, 0x00, 0xed,
-    0x00, 0xee, 0x00, 0xef, 0x00, 0xf0, 0x00, 0xf1, 0x00, 0xf2, 0x00, 0xf3, 0x00, 0xf4, 0x00, 0xf5,
-    0x00, 0xf6, 0x00, 0xf7, 0x00, 0xf8, 0x00, 0xf9, 0x00, 0xfa, 0x00, 0xfb, 0x00, 0xfc, 0x00, 0xfd,
-    0x00, 0xfe, 0x00, 0xff, 0x01, 0x00, 0x01, 0x01, 0x01, 0x02, 0x01, 0x03, 0x01, 0x04, 0x01, 0x05,
-    0x01, 0x06, 0x01, 0x07, 0x01, 0x30, 0x01, 0x34, 0x01, 0x36, 0x01, 0x38, 0x01, 0x3a, 0x01, 0x3c,
-    0x01, 0x42, 0x01, 0x44, 0x01, 0x46, 0x01, 0x4a, 0x01, 0x4d, 0x01, 0x5a, 0x02, 0x97, 0x02, 0x99,
-    0x02, 0xb5, 0x02, 0xb6, 0x02, 0xb7, 0x02, 0xb8, 0x02, 0xb9, 0x02, 0xba, 0x02, 0xbb, 0x02, 0xbc,
-    0x02, 0xbd, 0x02, 0xbe, 0x02, 0xbf, 0x02, 0xc0, 0x02, 0xc1, 0x02, 0xc2, 0x02, 0xc3, 0x02, 0xc4,
-    0x02, 0xc5, 0x02, 0xc6, 0x02, 0xc7, 0x02, 0xc8, 0x02, 0xc9, 0x02, 0xca, 0x02, 0xcb, 0x02, 0xcc,
-    0x02, 0xcd, 0x02, 0xce, 0x02, 0xcf, 0x02, 0xd0, 0x02, 0xd2, 0x02, 0xd4, 0x02, 0xd6, 0x02, 0xd8,
-    0x02, 0xda, 0x02, 0xdc, 0x02, 0xde, 0x02, 0xe0, 0x02, 0xe2, 0x02, 0xe4, 0x02, 0xe6, 0x02, 0xe8,
-    0x02, 0xea, 0x02, 0xec, 0x02, 0xee, 0x02, 0xf0, 0x02, 0xf2, 0x02, 0xf4, 0x02, 0xf6, 0x02, 0xf8,
-    0x02, 0xfa, 0x02, 0xfc, 0x02, 0xff, 0x03, 0x01, 0x03, 0x03, 0x03, 0x05, 0x03, 0x07, 0x03, 0x09,
-    0x03, 0x0b, 0x03, 0x0d, 0x03, 0x0f, 0x03, 0x11, 0x03, 0x14, 0x03, 0x16, 0x03, 0x18, 0x03, 0x1a,
-    0x03, 0x1c, 0x03, 0x1e, 0x03, 0x20, 0x03, 0x22, 0x03, 0x24, 0x03, 0x26, 0x03, 0x28, 0x03, 0x2a,
-    0x03, 0x2c, 0x03, 0x2e, 0x03, 0x30, 0x03, 0x32, 0x03, 0x34, 0x03, 0x36, 0x03, 0x38, 0x03, 0x3a,
-    0x03, 0x3c, 0x03, 0x3e, 0x03, 0x41, 0x03, 0x43, 0x03, 0x45, 0x03, 0x47, 0x03, 0x49, 0x03, 0xb9,
-    0x03, 0xba, 0x03, 0xbb, 0x03, 0xbc, 0x03, 0xbe, 0x03, 0xbf, 0x03, 0xc0, 0x03, 0xc1, 0x03, 0xc2,
-    0x03, 0xc3, 0x03, 0xc4, 0x03, 0xc5, 0x03, 0xc6, 0x03, 0xc7, 0x03, 0xde, 0x03, 0xdf, 0x03, 0xe0,
-    0x03, 0xe1, 0x03, 0xe2, 0x03, 0xe3, 0x03, 0xe4, 0x03, 0xe5, 0x03, 0xe6, 0x03, 0xe7, 0x03, 0xe8,
-    0x03, 0xe9, 0x03, 0xea, 0x03, 0xeb, 0x03, 0xec, 0x03, 0xed, 0x03, 0xef, 0x03, 0xf1, 0x03, 0xf3,
-    0x03, 0xf5, 0x04, 0x0a, 0x04, 0x0c, 0x04, 0x0e, 0x04, 0x1c, 0x04, 0x23, 0x04, 0x29, 0x04, 0x2f,
-    0x04, 0x99, 0x04, 0x9a, 0x04, 0x9e, 0x04, 0xa2, 0x05, 0x23, 0x05, 0x25, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x08, 0x00, 0x02, 0x01, 0xfa, 0x00, 0xfa, 0x02, 0x01, 0x02, 0x8c, 0x01, 0xeb,
-    0x01, 0xea, 0x01, 0xe9, 0x01, 0xe8, 0x01, 0xe7, 0x01, 0xe6, 0x01, 0xe5, 0x01, 0xe4, 0x01, 0xe3,
-    0x01, 0xe2, 0x02, 0x4d, 0x02, 0x4c, 0x02, 0x4b, 0x02, 0x4a, 0x02, 0x42, 0x02, 0x00, 0x01, 0xff,
-    0x01, 0xfe, 0x01, 0xfd, 0x01, 0xfc, 0x01, 0xfb, 0x01, 0xfa, 0x01, 0xf9, 0x01, 0xf8, 0x01, 0xf7,
-    0x01, 0xf6, 0x01, 0xf5, 0x01, 0xf4, 0x01, 0xf3, 0x01, 0xf2, 0x01, 0xf1, 0x01, 0xf0, 0x01, 0xef,
-    0x01, 0xee, 0x01, 0xed, 0x01, 0xec, 0x02, 0x02, 0x02, 0x03, 0x02, 0x8e, 0x02, 0x90, 0x02, 0x8f,
-    0x02, 0x91, 0x02, 0x8d, 0x02, 0x92, 0x02, 0x6c, 0x02, 0x04, 0x02, 0x05, 0x02, 0x06, 0x02, 0x07,
-    0x02, 0x08, 0x02, 0x09, 0x02, 0x0a, 0x02, 0x0b, 0x02, 0x0c, 0x02, 0x0d, 0x02, 0x0e, 0x02, 0x0f,
-    0x02, 0x10, 0x02, 0x11, 0x02, 0x12, 0x02, 0x13, 0x02, 0x14, 0x02, 0x15, 0x02, 0x16, 0x02, 0x17,
-    0x02, 0x18, 0x02, 0x1a, 0x02, 0x1b, 0x05, 0x19, 0x02, 0x1c, 0x02, 0x1d, 0x02, 0x1e, 0x02, 0x1f,
-    0x02, 0x20, 0x02, 0x21, 0x02, 0x22, 0x02, 0x23, 0x02, 0x24, 0x02, 0x25, 0x02, 0x55, 0x02, 0x27,
-    0x02, 0x28, 0x02, 0x29, 0x02, 0x2a, 0x05, 0x13, 0x02, 0x2b, 0x02, 0x2d, 0x02, 0x2e, 0x02, 0x2f,
-    0x02, 0x30, 0x02, 0x31, 0x02, 0x32, 0x02, 0x33, 0x02, 0x35, 0x02, 0x36, 0x02, 0x38, 0x02, 0x37,
-    0x03, 0x4a, 0x03, 0x4b, 0x03, 0x4c, 0x03, 0x4d, 0x03, 0x4e, 0x03, 0x4f, 0x03, 0x50, 0x03, 0x51,
-    0x03, 0x52, 0x03, 0x53, 0x03, 0x54, 0x03, 0x55, 0x03, 0x56, 0x03, 0x57, 0x03, 0x58, 0x03, 0x59,
-    0x03, 0x5a, 0x03, 0x5b, 0x03, 0x5c, 0x03, 0x5d, 0x03, 0x5e, 0x03, 0x5f, 0x03, 0x60, 0x03, 0x61,
-    0x03, 0x62, 0x03, 0x63, 0x03, 0x64, 0x03, 0x65, 0x03, 0x66, 0x03, 0x67, 0x03, 0x68, 0x03, 0x69,
-    0x03, 0x6a, 0x03, 0x6b, 0x03, 0x6c, 0x03, 0x6d, 0x03, 0x6e, 0x03, 0x6f, 0x03, 0x70, 0x03, 0x71,
-    0x03, 0x72, 0x03, 0x73, 0x03, 0x74, 0x03, 0x75, 0x03, 0x76, 0x03, 0x77, 0x03, 0x78, 0x03, 0x79,
-    0x03, 0x7a, 0x03, 0x7b, 0x03, 0x7c, 0x03, 0x7d, 0x03, 0x7e, 0x05, 0x1a, 0x03, 0x7f, 0x03, 0x80,
-    0x03, 0x81, 0x03, 0x82, 0x03, 0x83, 0x03, 0x84, 0x03, 0x85, 0x03, 0x86, 0x03, 0x87, 0x03, 0x88,
-    0x03, 0x89, 0x03, 0x8a, 0x03, 0x8b, 0x03, 0x8c, 0x03, 0x8d, 0x03, 0x8e, 0x03, 0x8f, 0x03, 0x90,
-    0x05, 0x1d, 0x03, 0x91, 0x03, 0x92, 0x03, 0x94, 0x03, 0x93, 0x03, 0x95, 0x03, 0x96, 0x03, 0x97,
-    0x03, 0x98, 0x03, 0x99, 0x03, 0x9a, 0x03, 0x9b, 0x03, 0x9c, 0x03, 0x9d, 0x03, 0x9e, 0x03, 0x9f,
-    0x03, 0xa0, 0x05, 0x1b, 0x05, 0x1c, 0x04, 0xe6, 0x04, 0xe7, 0x04, 0xe8, 0x04, 0xe9, 0x04, 0xea,
-    0x04, 0xeb, 0x04, 0xec, 0x04, 0xed, 0x04, 0xee, 0x04, 0xef, 0x04, 0xf0, 0x04, 0xf1, 0x04, 0xf2,
-    0x04, 0xf3, 0x04, 0xf4, 0x04, 0xf5, 0x04, 0xf6, 0x04, 0xf7, 0x04, 0xf8, 0x04, 0xf9, 0x04, 0xfa,
-    0x04, 0xfb, 0x04, 0xfc, 0x04, 0xfd, 0x04, 0xfe, 0x04, 0xff, 0x05, 0x00, 0x05, 0x01, 0x05, 0x02,
-    0x02, 0x19, 0x05, 0x03, 0x05, 0x04, 0x05, 0x05, 0x05, 0x06, 0x05, 0x07, 0x05, 0x08, 0x05, 0x09,
-    0x05, 0x0a, 0x05, 0x0b, 0x05, 0x0c, 0x05, 0x0d, 0x05, 0x0e, 0x05, 0x0f, 0x05, 0x10, 0x05, 0x11,
-    0x05, 0x1e, 0x05, 0x1f, 0x05, 0x20, 0x05, 0x21, 0x05, 0x12, 0x05, 0x14, 0x05, 0x15, 0x05, 0x17,
-    0x02, 0x34, 0x05, 0x18, 0x05, 0x16, 0x02, 0x26, 0x02, 0x2c, 0x05, 0x26, 0x05, 0x27, 0x00, 0x01,
-    0x00, 0xfa, 0x00, 0x08, 0x00, 0x0a, 0x00, 0x14, 0x00, 0x15, 0x00, 0x16, 0x00, 0x17, 0x00, 0x18,
-    0x00, 0x19, 0x00, 0x1a, 0x00, 0x1b, 0x00, 0x1c, 0x00, 0x1d, 0x00, 0x25, 0x00, 0x26, 0x00, 0x27,
-    0x00, 0x28, 0x00, 0x29, 0x00, 0x2a, 0x00, 0x2b, 0x00, 0x2c, 0x00, 0x2d, 0x00, 0x2e, 0x00, 0x2f,
-    0x00, 0x30, 0x00, 0x31, 0x00, 0x32, 0x00, 0x33, 0x00, 0x34, 0x00, 0x35, 0x00, 0x36, 0x00, 0x37,
-    0x00, 0x38, 0x00, 0x39, 0x00, 0x3a, 0x00, 0x3b, 0x00, 0x3c, 0x00, 0x3d, 0x00, 0x3e, 0x00, 0x65,
-    0x00, 0x67, 0x00, 0x81, 0x00, 0x83, 0x00, 0x84, 0x00, 0x8c, 0x00, 0x8f, 0x00, 0x91, 0x00, 0x93,
-    0x00, 0xb1, 0x00, 0xb2, 0x00, 0xb3, 0x00, 0xb4, 0x00, 0xb5, 0x00, 0xb6, 0x00, 0xb7, 0x00, 0xb8,
-    0x00, 0xb9, 0x00, 0xba, 0x00, 0xd2, 0x00, 0xd3, 0x00, 0xd4, 0x00, 0xd5, 0x00, 0xd6, 0x00, 0xd7,
-    0x00, 0xd8, 0x00, 0xd9, 0x00, 0xda, 0x00, 0xdb, 0x00, 0xdc, 0x00, 0xdd, 0x00, 0xde, 0x00, 0xdf,
-    0x00, 0xe0, 0x00, 0xe1, 0x00, 0xe2, 0x00, 0xe3, 0x00, 0xe4, 0x00, 0xe5, 0x00, 0xe6, 0x00, 0xe7,
-    0x00, 0xe8, 0x00, 0xe9, 0x01, 0x2f, 0x01, 0x33, 0x01, 0x35, 0x01, 0x37, 0x01, 0x39, 0x01, 0x3b,
-    0x01, 0x41, 0x01, 0x43, 0x01, 0x45, 0x01, 0x49, 0x01, 0x4b, 0x01, 0x4c, 0x01, 0x58, 0x01, 0x59,
-    0x01, 0xb1, 0x01, 0xb7, 0x01, 0xbc, 0x01, 0xbf, 0x02, 0x95, 0x02, 0x96, 0x02, 0x98, 0x02, 0x9a,
-    0x02, 0x9b, 0x02, 0x9c, 0x02, 0x9d, 0x02, 0x9e, 0x02, 0x9f, 0x02, 0xa0, 0x02, 0xa1, 0x02, 0xa2,
-    0x02, 0xa3, 0x02, 0xa4, 0x02, 0xa5, 0x02, 0xa6, 0x02, 0xa7, 0x02, 0xa8, 0x02, 0xa9, 0x02, 0xaa,
-    0x02, 0xab, 0x02, 0xac, 0x02, 0xad, 0x02, 0xae, 0x02, 0xaf, 0x02, 0xb0, 0x02, 0xb1, 0x02, 0xb2,
-    0x02, 0xb3, 0x02, 0xb4, 0x02, 0xd1, 0x02, 0xd3, 0x02, 0xd5, 0x02, 0xd7, 0x02, 0xd9, 0x02, 0xdb,
-    0x02, 0xdd, 0x02, 0xdf, 0x02, 0xe1, 0x02, 0xe3, 0x02, 0xe5, 0x02, 0xe7, 0x02, 0xe9, 0x02, 0xeb,
-    0x02, 0xed, 0x02, 0xef, 0x02, 0xf1, 0x02, 0xf3, 0x02, 0xf5, 0x02, 0xf7, 0x02, 0xf9, 0x02, 0xfb,
-    0x02, 0xfd, 0x02, 0xfe, 0x03, 0x00, 0x03, 0x02, 0x03, 0x04, 0x03, 0x06, 0x03, 0x08, 0x03, 0x0a,
-    0x03, 0x0c, 0x03, 0x0e, 0x03, 0x10, 0x03, 0x13, 0x03, 0x15, 0x03, 0x17, 0x03, 0x19, 0x03, 0x1b,
-    0x03, 0x1d, 0x03, 0x1f, 0x03, 0x21, 0x03, 0x23, 0x03, 0x25, 0x03, 0x27, 0x03, 0x29, 0x03, 0x2b,
-    0x03, 0x2d, 0x03, 0x2f, 0x03, 0x31, 0x03, 0x33, 0x03, 0x35, 0x03, 0x37, 0x03, 0x39, 0x03, 0x3b,
-    0x03, 0x3d, 0x03, 0x3f, 0x03, 0x40, 0x03, 0x42, 0x03, 0x44, 0x03, 0x46, 0x03, 0x48, 0x03, 0xa1,
-    0x03, 0xa2, 0x03, 0xa3, 0x03, 0xa4, 0x03, 0xa5, 0x03, 0xa6, 0x03, 0xa7, 0x03, 0xa9, 0x03, 0xaa,
-    0x03, 0xab, 0x03, 0xac, 0x03, 0xad, 0x03, 0xae, 0x03, 0xaf, 0x03, 0xb0, 0x03, 0xb1, 0x03, 0xb2,
-    0x03, 0xb3, 0x03, 0xb4, 0x03, 0xb5, 0x03, 0xb6, 0x03, 0xb7, 0x03, 0xb8, 0x03, 0xc8, 0x03, 0xc9,
-    0x03, 0xca, 0x03, 0xcb, 0x03, 0xcc, 0x03, 0xcd, 0x03, 0xce, 0x03, 0xcf, 0x03, 0xd0, 0x03, 0xd1,
-    0x03, 0xd2, 0x03, 0xd3, 0x03, 0xd4, 0x03, 0xd5, 0x03, 0xd6, 0x03, 0xd7, 0x03, 0xd8, 0x03, 0xd9,
-    0x03, 0xda, 0x03, 0xdb, 0x03, 0xdc, 0x03, 0xdd, 0x03, 0xee, 0x03, 0xf0, 0x03, 0xf2, 0x03, 0xf4,
-    0x04, 0x09, 0x04, 0x0b, 0x04, 0x0d, 0x04, 0x22, 0x04, 0x28, 0x04, 0x2e, 0x04, 0x98, 0x04, 0x9d,
-    0x04, 0xa1, 0x05, 0x22, 0x05, 0x24, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x5c,
-    0x00, 0xa0, 0x00, 0x04, 0x44, 0x46, 0x4c, 0x54, 0x00, 0x44, 0x63, 0x79, 0x72, 0x6c, 0x00, 0x36,
-    0x67, 0x72, 0x65, 0x6b, 0x00, 0x28, 0x6c, 0x61, 0x74, 0x6e, 0x00, 0x1a, 0x00, 0x04, 0x00, 0x00,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00,
-    0xff, 0xff, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x02, 0x00, 0x00, 0x00, 0x03, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x02,
-    0x00, 0x00, 0x00, 0x02, 0x00, 0x05, 0x63, 0x70, 0x73, 0x70, 0x00, 0x3e, 0x6b, 0x65, 0x72, 0x6e,
-    0x00, 0x36, 0x6b, 0x65, 0x72, 0x6e, 0x00, 0x30, 0x6b, 0x65, 0x72, 0x6e, 0x00, 0x28, 0x6b, 0x65,
-    0x72, 0x6e, 0x00, 0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x04, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02,
-    0x00, 0x04, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x04,
-    0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x56, 0x52, 0x31, 0x0e, 0x25, 0xee,
-    0x01, 0x58, 0x00, 0x0c, 0x00, 0x02, 0x00, 0x08, 0x00, 0x02, 0x00, 0xfc, 0x00, 0x0a, 0x00, 0x02,
-    0x00, 0x38, 0x00, 0x04, 0x00, 0x00, 0x00, 0xc4, 0x00, 0x60, 0x00, 0x04, 0x00, 0x05, 0x00, 0x00,
-    0xff, 0xaf, 0x00, 0x00, 0x00, 0x00, 0xff, 0x88, 0x00, 0x00, 0xff, 0x2c, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x88,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x12, 0x00, 0x06, 0x00, 0x0b, 0x00, 0x10,
-    0x00, 0x12, 0x00, 0x96, 0x00, 0xb2, 0x01, 0x84, 0x01, 0x85, 0x01, 0x86, 0x01, 0x87, 0x01, 0x88,
-    0x01, 0x89, 0x01, 0x8a, 0x01, 0x8e, 0x01, 0x8f, 0x03, 0xf6, 0x03, 0xf7, 0x03, 0xfa, 0x00, 0x02,
-    0x00, 0x10, 0x00, 0x06, 0x00, 0x06, 0x00, 0x01, 0x00, 0x0b, 0x00, 0x0b, 0x00, 0x01, 0x00, 0x10,
-    0x00, 0x10, 0x00, 0x02, 0x00, 0x11, 0x00, 0x11, 0x00, 0x03, 0x00, 0x12, 0x00, 0x12, 0x00, 0x02,
-    0x00, 0xb2, 0x00, 0xb2, 0x00, 0x04, 0x01, 0x81, 0x01, 0x82, 0x00, 0x03, 0x01, 0x84, 0x01, 0x85,
-    0x00, 0x01, 0x01, 0x86, 0x01, 0x86, 0x00, 0x02, 0x01, 0x87, 0x01, 0x89, 0x00, 0x01, 0x01, 0x8a,
-    0x01, 0x8a, 0x00, 0x02, 0x01, 0x8e, 0x01, 0x8f, 0x00, 0x02, 0x02, 0x94, 0x02, 0x94, 0x00, 0x03,
-    0x03, 0xf6, 0x03, 0xf7, 0x00, 0x01, 0x03, 0xfa, 0x03, 0xfa, 0x00, 0x01, 0x04, 0xa7, 0x04, 0xa7,
-    0x00, 0x03, 0x00, 0x02, 0x00, 0x07, 0x00, 0x10, 0x00, 0x10, 0x00, 0x01, 0x00, 0x12, 0x00, 0x12,
-    0x00, 0x01, 0x00, 0x96, 0x00, 0x96, 0x00, 0x02, 0x00, 0xb2, 0x00, 0xb2, 0x00, 0x03, 0x01, 0x86,
-    0x01, 0x86, 0x00, 0x01, 0x01, 0x8a, 0x01, 0x8a, 0x00, 0x01, 0x01, 0x8e, 0x01, 0x8f, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x10, 0x00, 0x04, 0x00, 0x00, 0x00, 0x03, 0x00, 0x4a, 0x00, 0x20, 0x00, 0x1a,
-    0x00, 0x01, 0x00, 0x03, 0x00, 0x13, 0x00, 0x9d, 0x00, 0xb2, 0x00, 0x01, 0x00, 0x23, 0xff, 0xbc,
-    0x00, 0x0a, 0x00, 0x06, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x01, 0x84, 0x00, 0x00, 0x01, 0x85,
-    0x00, 0x00, 0x01, 0x87, 0x00, 0x00, 0x01, 0x88, 0x00, 0x00, 0x01, 0x89, 0x00, 0x00, 0x03, 0xf6,
-    0x00, 0x00, 0x03, 0xf7, 0x00, 0x00, 0x03, 0xfa, 0x00, 0x00, 0x00, 0x01, 0x00, 0x13, 0xff, 0x17,
-    0x00, 0x02, 0x00, 0x08, 0x00, 0x02, 0x17, 0x4c, 0x00, 0x0a, 0x00, 0x02, 0x09, 0x5c, 0x00, 0x04,
-    0x00, 0x00, 0x11, 0xb6, 0x0b, 0x7c, 0x00, 0x23, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xff, 0xeb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xff, 0xed, 0x00, 0x00, 0x00, 0x00, 0xff, 0xd5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x93,
-    0xff, 0xd0, 0xff, 0xe9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xea, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xff, 0xea, 0xff, 0xf5, 0xff, 0xed, 0xff, 0xeb, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xff, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12,
-    0x00, 0x00, 0x00, 0x00, 0xff, 0xf1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf5, 0xff, 0xf5,
-    0xff, 0xf4, 0xff, 0xef, 0xff, 0xee, 0xff, 0xf1, 0x00, 0x00, 0xff, 0xce, 0xff, 0x88, 0xff, 0x8d,
-    0x00, 0x00, 0x00, 0x00, 0xff, 0xc6, 0x00, 0x00, 0xff, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0c, 0xff, 0xc4, 0xff, 0xad, 0x00, 0x00, 0xff, 0xdd, 0xff, 0xc7, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf1,
-    0xff, 0xcf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xed,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xef, 0xff, 0xed, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xff, 0xe6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x00,
-    0xff, 0xed, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf3, 0xff, 0xf2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf1, 0xff, 0x8a, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xff, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xff, 0xeb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xea, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xeb, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xff, 0xeb, 0xff, 0xea, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xff, 0xa1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xea,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xee, 0x00, 0x00, 0xff, 0xec, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf2, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xec, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xff, 0xbf, 0x00, 0x00, 0x00, 0x00, 0xff, 0xd8, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf3, 0x00, 0x00, 0xff, 0xf1,
-    0x00, 0x00, 0x00, 0x00, 0xff, 0xf1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x7f, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xc5,
-    0xff, 0x88, 0xff, 0xce, 0x00, 0x00, 0x00, 0x00, 0xff, 0xb8, 0x00, 0x00, 0xff, 0xec, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xac, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xff, 0xe3, 0xff, 0xbf, 0xff, 0x8d, 0xff, 0xbb, 0xff, 0xcb, 0xff, 0xd9, 0xff, 0xbf, 0xff, 0xa0,
-    0xff, 0xd8, 0x00, 0x00, 0xff, 0xab, 0xff, 0xec, 0x00, 0x00, 0x00, 0x12, 0xff, 0xc6, 0xff, 0xf0,
-    0x00, 0x11, 0xff, 0x26, 0x00, 0x11, 0x00, 0x00, 0xff, 0xa7, 0x00, 0x00, 0xff, 0xe2, 0x00, 0x00,
-    0x00, 0x12, 0xff, 0xa0, 0xff, 0xf3, 0xff, 0xf3, 0x00, 0x0d, 0xff, 0xef, 0xff, 0xab, 0xff, 0x8d,
-    0xff, 0xe9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xbf, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00,
-    0xff, 0xf2, 0xff, 0xdf, 0x00, 0x00, 0xff, 0xd5, 0x00, 0x00, 0xff, 0xe1, 0x00, 0x13, 0xff, 0x7f,
-    0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0xff, 0x83, 0x00, 0x00, 0xff, 0x07, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x6b, 0xff, 0x46, 0x00, 0x00, 0xff, 0xab, 0xff, 0x6b,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x13, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe4, 0xff, 0xa1,
-    0xff, 0xa2, 0xff, 0x7b, 0xff, 0xb9, 0xff, 0xac, 0xff, 0x75, 0x00, 0x00, 0xff, 0x9a, 0x00, 0x00,
-    0xff, 0xaf, 0xff, 0xb4, 0x00, 0x00, 0x00, 0x10, 0xff, 0x9b, 0xff, 0xf0, 0x00, 0x0f, 0xff, 0x17,
-    0x00, 0x10, 0x00, 0x00, 0xff, 0x09, 0xff, 0xbc, 0xff, 0xc4, 0x00, 0x00, 0x00, 0x10, 0xff, 0x19,
-    0xff, 0xf1, 0xff, 0xf1, 0x00, 0x00, 0xff, 0xed, 0xff, 0xaf, 0xff, 0xa2, 0xff, 0xb3, 0x00, 0x00,
-    0x00, 0x00, 0xff, 0xe1, 0xff, 0xd5, 0xff, 0xdf, 0xff, 0xe7, 0xff, 0xed, 0xff, 0xe1, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xff, 0xcb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xff, 0x7e, 0x00, 0x0e, 0x00, 0x00, 0xff, 0xc4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xcb, 0xff, 0xd5,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf5, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xed, 0x00, 0x00, 0xff, 0xdc,
-    0x00, 0x00, 0x00, 0x00, 0xff, 0xe6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12,
-    0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x73, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe6, 0xff, 0xeb,
-    0x00, 0x0d, 0x00, 0x00, 0xff, 0xec, 0xff, 0xed, 0xff, 0xeb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0d, 0xff, 0xe5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf5, 0xff, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf1, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xff, 0xf1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xef, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xec, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xff, 0xb4, 0x00, 0x00, 0x00, 0x00, 0xff, 0xd5, 0xff, 0xbb, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe1, 0xff, 0xe6,
-    0x00, 0x00, 0x00, 0x00, 0xff, 0xe7, 0xff, 0xe9, 0xff, 0xe5, 0x00, 0x00, 0xff, 0xf1, 0x00, 0x00,
-    0x00, 0x00, 0xff, 0xd8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xff, 0x9b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xff, 0xf3, 0xff, 0xd4, 0xff, 0xb5, 0xff, 0xd2, 0xff, 0xd9, 0xff, 0xe4, 0xff, 0xd2, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xff, 0xb4, 0xff, 0xf5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xff, 0x23, 0x00, 0x00, 0x00, 0x00, 0xff, 0xaf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xb4, 0xff, 0xb5,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xff, 0xc9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe5, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf3,
-    0xff, 0x67, 0xff, 0xf5, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xff, 0xac, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x9f,
-    0x00, 0x00, 0xff, 0xe2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x3e,
-    0x00, 0x00, 0x00, 0x00, 0xff, 0xda, 0x00, 0x00, 0xff, 0xac, 0xff, 0x67, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xeb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xff, 0xe7, 0xff, 0xe6, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe7, 0xff, 0xeb,
-    0xff, 0xeb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe1, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xaa, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xff, 0xf2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xec, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xbf, 0x00, 0x00, 0x00, 0x00, 0xff, 0xd8, 0xff, 0xc0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xff, 0xeb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xff, 0xed, 0x00, 0x00, 0x00, 0x00, 0xff, 0xd5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x93,
-    0xff, 0xd0, 0xff, 0xe9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xea, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xff, 0xea, 0xff, 0xf5, 0xff, 0xed, 0xff, 0xeb, 0x00, 0x00, 0x00, 0x00,
-    0xff, 0xf1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf4, 0xff, 0xef,
-    0xff, 0xee, 0xff, 0xf1, 0x00, 0x00, 0xff, 0xce, 0x00, 0x00, 0xff, 0x8d, 0x00, 0x00, 0x00, 0x00,
-    0xff, 0xc6, 0x00, 0x00, 0xff, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0xff, 0xc4,
-    0xff, 0xad, 0x00, 0x00, 0xff, 0xdd, 0xff, 0xc7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xec, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xff, 0xe5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x5a, 0x00, 0x06, 0x00, 0x06, 0x00, 0x00,
-    0x00, 0x0b, 0x00, 0x0b, 0x00, 0x01, 0x00, 0x25, 0x00, 0x29, 0x00, 0x02, 0x00, 0x2c, 0x00, 0x34,
-    0x00, 0x07, 0x00, 0x38, 0x00, 0x3e, 0x00, 0x10, 0x00, 0x45, 0x00, 0x47, 0x00, 0x17, 0x00, 0x49,
-    0x00, 0x49, 0x00, 0x1a, 0x00, 0x4c, 0x00, 0x4c, 0x00, 0x1b, 0x00, 0x51, 0x00, 0x54, 0x00, 0x1c,
-    0x00, 0x56, 0x00, 0x56, 0x00, 0x20, 0x00, 0x5a, 0x00, 0x5a, 0x00, 0x21, 0x00, 0x5c, 0x00, 0x5e,
-    0x00, 0x22, 0x00, 0x8a, 0x00, 0x8a, 0x00, 0x25, 0x00, 0x96, 0x00, 0x96, 0x00, 0x26, 0x00, 0xb2,
-    0x00, 0xb2, 0x00, 0x27, 0x01, 0x84, 0x01, 0x85, 0x00, 0x28, 0x01, 0x87, 0x01, 0x89, 0x00, 0x2a,
-    0x01, 0xf2, 0x01, 0xf2, 0x00, 0x2d, 0x01, 0xf7, 0x01, 0xf7, 0x00, 0x2e, 0x01, 0xfa, 0x01, 0xfb,
-    0x00, 0x2f, 0x02, 0x05, 0x02, 0x05, 0x00, 0x31, 0x02, 0x4a, 0x02, 0x4a, 0x00, 0x32, 0x02, 0x4d,
-    0x02, 0x4d, 0x00, 0x33, 0x02, 0x5f, 0x02, 0x5f, 0x00, 0x34, 0x02, 0x61, 0x02, 0x62, 0x00, 0x35,
-    0x02, 0x95, 0x02, 0x96, 0x00, 0x37, 0x02, 0x98, 0x02, 0x98, 0x00, 0x39, 0x02, 0x9a, 0x02, 0xc0,
-    0x00, 0x3a, 0x02, 0xc5, 0x02, 0xca, 0x00, 0x61, 0x02, 0xcf, 0x02, 0xdf, 0x00, 0x67, 0x02, 0xe1,
-    0x02, 0xea, 0x00, 0x78, 0x02, 0xf3, 0x02, 0xf5, 0x00, 0x82, 0x02, 0xf7, 0x02, 0xf7, 0x00, 0x85,
-    0x02, 0xf9, 0x02, 0xf9, 0x00, 0x86, 0x02, 0xfb, 0x02, 0xfb, 0x00, 0x87, 0x02, 0xfd, 0x02, 0xfd,
-    0x00, 0x88, 0x03, 0x00, 0x03, 0x00, 0x00, 0x89, 0x03, 0x02, 0x03, 0x02, 0x00, 0x8a, 0x03, 0x04,
-    0x03, 0x04, 0x00, 0x8b, 0x03, 0x06, 0x03, 0x06, 0x00, 0x8c, 0x03, 0x08, 0x03, 0x08, 0x00, 0x8d,
-    0x03, 0x0a, 0x03, 0x0a, 0x00, 0x8e, 0x03, 0x0c, 0x03, 0x18, 0x00, 0x8f, 0x03, 0x1a, 0x03, 0x1a,
-    0x00, 0x9c, 0x03, 0x1c, 0x03, 0x1c, 0x00, 0x9d, 0x03, 0x1e, 0x03, 0x1e, 0x00, 0x9e, 0x03, 0x29,
-    0x03, 0x29, 0x00, 0x9f, 0x03, 0x2b, 0x03, 0x2b, 0x00, 0xa0, 0x03, 0x2d, 0x03, 0x2d, 0x00, 0xa1,
-    0x03, 0x2f, 0x03, 0x2f, 0x00, 0xa2, 0x03, 0x31, 0x03, 0x31, 0x00, 0xa3, 0x03, 0x33, 0x03, 0x33,
-    0x00, 0xa4, 0x03, 0x35, 0x03, 0x35, 0x00, 0xa5, 0x03, 0x37, 0x03, 0x37, 0x00, 0xa6, 0x03, 0x39,
-    0x03, 0x39, 0x00, 0xa7, 0x03, 0x3b, 0x03, 0x3b, 0x00, 0xa8, 0x03, 0x3d, 0x03, 0x45, 0x00, 0xa9,
-    0x03, 0x4a, 0x03, 0x53, 0x00, 0xb2, 0x03, 0x5e, 0x03, 0x62, 0x00, 0xbc, 0x03, 0x68, 0x03, 0x6a,
-    0x00, 0xc1, 0x03, 0x6f, 0x03, 0x6f, 0x00, 0xc4, 0x03, 0x80, 0x03, 0x84, 0x00, 0xc5, 0x03, 0x88,
-    0x03, 0x8a, 0x00, 0xca, 0x03, 0x93, 0x03, 0x93, 0x00, 0xcd, 0x03, 0xee, 0x03, 0xee, 0x00, 0xce,
-    0x03, 0xf0, 0x03, 0xf0, 0x00, 0xcf, 0x03, 0xf2, 0x03, 0xf2, 0x00, 0xd0, 0x03, 0xf4, 0x03, 0xf7,
-    0x00, 0xd1, 0x03, 0xfa, 0x03, 0xfe, 0x00, 0xd5, 0x04, 0x39, 0x04, 0x61, 0x00, 0xda, 0x04, 0x63,
-    0x04, 0x63, 0x01, 0x03, 0x04, 0x65, 0x04, 0x72, 0x01, 0x04, 0x04, 0x7a, 0x04, 0x7a, 0x01, 0x12,
-    0x04, 0x7d, 0x04, 0x7d, 0x01, 0x13, 0x04, 0x7f, 0x04, 0x7f, 0x01, 0x14, 0x04, 0x8b, 0x04, 0x90,
-    0x01, 0x15, 0x04, 0xb2, 0x04, 0xb6, 0x01, 0x1b, 0x04, 0xb8, 0x04, 0xb8, 0x01, 0x20, 0x04, 0xba,
-    0x04, 0xbb, 0x01, 0x21, 0x04, 0xbd, 0x04, 0xbd, 0x01, 0x23, 0x04, 0xc1, 0x04, 0xc3, 0x01, 0x24,
-    0x04, 0xc5, 0x04, 0xc5, 0x01, 0x27, 0x04, 0xc7, 0x04, 0xc9, 0x01, 0x28, 0x04, 0xcb, 0x04, 0xcb,
-    0x01, 0x2b, 0x04, 0xcd, 0x04, 0xcd, 0x01, 0x2c, 0x04, 0xcf, 0x04, 0xd5, 0x01, 0x2d, 0x04, 0xd7,
-    0x04, 0xd7, 0x01, 0x34, 0x04, 0xda, 0x04, 0xda, 0x01, 0x35, 0x04, 0xdc, 0x04, 0xe1, 0x01, 0x36,
-    0x04, 0xe3, 0x04, 0xe4, 0x01, 0x3c, 0x00, 0x02, 0x01, 0x09, 0x00, 0x06, 0x00, 0x06, 0x00, 0x0d,
-    0x00, 0x0b, 0x00, 0x0b, 0x00, 0x0d, 0x00, 0x10, 0x00, 0x10, 0x00, 0x12, 0x00, 0x11, 0x00, 0x11,
-    0x00, 0x15, 0x00, 0x12, 0x00, 0x12, 0x00, 0x12, 0x00, 0x25, 0x00, 0x25, 0x00, 0x03, 0x00, 0x27,
-    0x00, 0x27, 0x00, 0x01, 0x00, 0x2b, 0x00, 0x2b, 0x00, 0x01, 0x00, 0x2e, 0x00, 0x2e, 0x00, 0x1a,
-    0x00, 0x33, 0x00, 0x33, 0x00, 0x01, 0x00, 0x35, 0x00, 0x35, 0x00, 0x01, 0x00, 0x37, 0x00, 0x37,
-    0x00, 0x10, 0x00, 0x38, 0x00, 0x38, 0x00, 0x13, 0x00, 0x39, 0x00, 0x39, 0x00, 0x08, 0x00, 0x3a,
-    0x00, 0x3a, 0x00, 0x19, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x11, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x1d,
-    0x00, 0x3d, 0x00, 0x3d, 0x00, 0x0e, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x14, 0x00, 0x45, 0x00, 0x45,
-    0x00, 0x04, 0x00, 0x47, 0x00, 0x49, 0x00, 0x02, 0x00, 0x4b, 0x00, 0x4b, 0x00, 0x02, 0x00, 0x51,
-    0x00, 0x52, 0x00, 0x09, 0x00, 0x53, 0x00, 0x53, 0x00, 0x07, 0x00, 0x54, 0x00, 0x54, 0x00, 0x09,
-    0x00, 0x55, 0x00, 0x55, 0x00, 0x02, 0x00, 0x57, 0x00, 0x57, 0x00, 0x0f, 0x00, 0x59, 0x00, 0x59,
-    0x00, 0x06, 0x00, 0x5a, 0x00, 0x5a, 0x00, 0x0c, 0x00, 0x5c, 0x00, 0x5c, 0x00, 0x21, 0x00, 0x5d,
-    0x00, 0x5d, 0x00, 0x0c, 0x00, 0x5e, 0x00, 0x5e, 0x00, 0x17, 0x00, 0x83, 0x00, 0x83, 0x00, 0x01,
-    0x00, 0x93, 0x00, 0x93, 0x00, 0x01, 0x00, 0x94, 0x00, 0x94, 0x00, 0x02, 0x00, 0x98, 0x00, 0x98,
-    0x00, 0x01, 0x00, 0x99, 0x00, 0x99, 0x00, 0x02, 0x00, 0x9b, 0x00, 0x9b, 0x00, 0x06, 0x00, 0xb2,
-    0x00, 0xb2, 0x00, 0x20, 0x01, 0x81, 0x01, 0x82, 0x00, 0x15, 0x01, 0x84, 0x01, 0x85, 0x00, 0x0d,
-    0x01, 0x86, 0x01, 0x86, 0x00, 0x12, 0x01, 0x87, 0x01, 0x89, 0x00, 0x0d, 0x01, 0x8a, 0x01, 0x8a,
-    0x00, 0x12, 0x01, 0x8e, 0x01, 0x8f, 0x00, 0x12, 0x01, 0xdb, 0x01, 0xdb, 0x00, 0x0f, 0x01, 0xed,
-    0x01, 0xed, 0x00, 0x18, 0x01, 0xee, 0x01, 0xee, 0x00, 0x1e, 0x01, 0xef, 0x01, 0xef, 0x00, 0x1b,
-    0x01, 0xf1, 0x01, 0xf1, 0x00, 0x0a, 0x01, 0xf2, 0x01, 0xf2, 0x00, 0x1c, 0x01, 0xf3, 0x01, 0xf3,
-    0x00, 0x16, 0x01, 0xf5, 0x01, 0xf5, 0x00, 0x05, 0x01, 0xf7, 0x01, 0xf7, 0x00, 0x05, 0x01, 0xff,
-    0x01, 0xff, 0x00, 0x05, 0x02, 0x05, 0x02, 0x05, 0x00, 0x1f, 0x02, 0x4b, 0x02, 0x4b, 0x00, 0x05,
-    0x02, 0x4d, 0x02, 0x4d, 0x00, 0x0b, 0x02, 0x5f, 0x02, 0x60, 0x00, 0x01, 0x02, 0x62, 0x02, 0x63,
-    0x00, 0x01, 0x02, 0x94, 0x02, 0x94, 0x00, 0x15, 0x02, 0x9a, 0x02, 0xa0, 0x00, 0x03, 0x02, 0xa1,
-    0x02, 0xa1, 0x00, 0x01, 0x02, 0xab, 0x02, 0xaf, 0x00, 0x01, 0x02, 0xb0, 0x02, 0xb3, 0x00, 0x08,
-    0x02, 0xb4, 0x02, 0xb4, 0x00, 0x0e, 0x02, 0xb5, 0x02, 0xbb, 0x00, 0x04, 0x02, 0xbc, 0x02, 0xc0,
-    0x00, 0x02, 0x02, 0xc5, 0x02, 0xc5, 0x00, 0x09, 0x02, 0xc6, 0x02, 0xca, 0x00, 0x07, 0x02, 0xcb,
-    0x02, 0xce, 0x00, 0x06, 0x02, 0xcf, 0x02, 0xd0, 0x00, 0x0c, 0x02, 0xd1, 0x02, 0xd1, 0x00, 0x03,
-    0x02, 0xd2, 0x02, 0xd2, 0x00, 0x04, 0x02, 0xd3, 0x02, 0xd3, 0x00, 0x03, 0x02, 0xd4, 0x02, 0xd4,
-    0x00, 0x04, 0x02, 0xd5, 0x02, 0xd5, 0x00, 0x03, 0x02, 0xd6, 0x02, 0xd6, 0x00, 0x04, 0x02, 0xd7,
-    0x02, 0xd7, 0x00, 0x01, 0x02, 0xd8, 0x02, 0xd8, 0x00, 0x02, 0x02, 0xd9, 0x02, 0xd9, 0x00, 0x01,
-    0x02, 0xda, 0x02, 0xda, 0x00, 0x02, 0x02, 0xdb, 0x02, 0xdb, 0x00, 0x01, 0x02, 0xdc, 0x02, 0xdc,
-    0x00, 0x02, 0x02, 0xdd, 0x02, 0xdd, 0x00, 0x01, 0x02, 0xde, 0x02, 0xde, 0x00, 0x02, 0x02, 0xe0,
-    0x02, 0xe0, 0x00, 0x02, 0x02, 0xe2, 0x02, 0xe2, 0x00, 0x02, 0x02, 0xe4, 0x02, 0xe4, 0x00, 0x02,
-    0x02, 0xe6, 0x02, 0xe6, 0x00, 0x02, 0x02, 0xe8, 0x02, 0xe8, 0x00, 0x02, 0x02, 0xea, 0x02, 0xea,
-    0x00, 0x02, 0x02, 0xeb, 0x02, 0xeb, 0x00, 0x01, 0x02, 0xec, 0x02, 0xec, 0x00, 0x02, 0x02, 0xed,
-    0x02, 0xed, 0x00, 0x01, 0x02, 0xee, 0x02, 0xee, 0x00, 0x02, 0x02, 0xef, 0x02, 0xef, 0x00, 0x01,
-    0x02, 0xf0, 0x02, 0xf0, 0x00, 0x02, 0x02, 0xf1, 0x02, 0xf1, 0x00, 0x01, 0x02, 0xf2, 0x02, 0xf2,
-    0x00, 0x02, 0x03, 0x00, 0x03, 0x00, 0x00, 0x1a, 0x03, 0x0d, 0x03, 0x0d, 0x00, 0x09, 0x03, 0x0f,
-    0x03, 0x0f, 0x00, 0x09, 0x03, 0x11, 0x03, 0x12, 0x00, 0x09, 0x03, 0x13, 0x03, 0x13, 0x00, 0x01,
-    0x03, 0x14, 0x03, 0x14, 0x00, 0x07, 0x03, 0x15, 0x03, 0x15, 0x00, 0x01, 0x03, 0x16, 0x03, 0x16,
-    0x00, 0x07, 0x03, 0x17, 0x03, 0x17, 0x00, 0x01, 0x03, 0x18, 0x03, 0x18, 0x00, 0x07, 0x03, 0x1f,
-    0x03, 0x1f, 0x00, 0x10, 0x03, 0x20, 0x03, 0x20, 0x00, 0x0f, 0x03, 0x21, 0x03, 0x21, 0x00, 0x10,
-    0x03, 0x22, 0x03, 0x22, 0x00, 0x0f, 0x03, 0x23, 0x03, 0x23, 0x00, 0x10, 0x03, 0x24, 0x03, 0x24,
-    0x00, 0x0f, 0x03, 0x25, 0x03, 0x25, 0x00, 0x10, 0x03, 0x26, 0x03, 0x26, 0x00, 0x0f, 0x03, 0x27,
-    0x03, 0x27, 0x00, 0x10, 0x03, 0x28, 0x03, 0x28, 0x00, 0x0f, 0x03, 0x29, 0x03, 0x29, 0x00, 0x13,
-    0x03, 0x2b, 0x03, 0x2b, 0x00, 0x13, 0x03, 0x2d, 0x03, 0x2d, 0x00, 0x13, 0x03, 0x2f, 0x03, 0x2f,
-    0x00, 0x08, 0x03, 0x30, 0x03, 0x30, 0x00, 0x06, 0x03, 0x31, 0x03, 0x31, 0x00, 0x08, 0x03, 0x32,
-    0x03, 0x32, 0x00, 0x06, 0x03, 0x33, 0x03, 0x33, 0x00, 0x08, 0x03, 0x34, 0x03, 0x34, 0x00, 0x06,
-    0x03, 0x35, 0x03, 0x35, 0x00, 0x08, 0x03, 0x36, 0x03, 0x36, 0x00, 0x06, 0x03, 0x37, 0x03, 0x37,
-    0x00, 0x08, 0x03, 0x38, 0x03, 0x38, 0x00, 0x06, 0x03, 0x39, 0x03, 0x39, 0x00, 0x08, 0x03, 0x3a,
-    0x03, 0x3a, 0x00, 0x06, 0x03, 0x3b, 0x03, 0x3b, 0x00, 0x11, 0x03, 0x3d, 0x03, 0x3d, 0x00, 0x0e,
-    0x03, 0x3e, 0x03, 0x3e, 0x00, 0x0c, 0x03, 0x3f, 0x03, 0x3f, 0x00, 0x0e, 0x03, 0x40, 0x03, 0x40,
-    0x00, 0x14, 0x03, 0x41, 0x03, 0x41, 0x00, 0x17, 0x03, 0x42, 0x03, 0x42, 0x00, 0x14, 0x03, 0x43,
-    0x03, 0x43, 0x00, 0x17, 0x03, 0x44, 0x03, 0x44, 0x00, 0x14, 0x03, 0x45, 0x03, 0x45, 0x00, 0x17,
-    0x03, 0x48, 0x03, 0x48, 0x00, 0x01, 0x03, 0x4d, 0x03, 0x53, 0x00, 0x0b, 0x03, 0x54, 0x03, 0x54,
-    0x00, 0x05, 0x03, 0x5e, 0x03, 0x62, 0x00, 0x05, 0x03, 0x63, 0x03, 0x66, 0x00, 0x0a, 0x03, 0x67,
-    0x03, 0x67, 0x00, 0x18, 0x03, 0x68, 0x03, 0x6a, 0x00, 0x0b, 0x03, 0x6b, 0x03, 0x6e, 0x00, 0x05,
-    0x03, 0x75, 0x03, 0x78, 0x00, 0x05, 0x03, 0x88, 0x03, 0x8a, 0x00, 0x05, 0x03, 0x8e, 0x03, 0x91,
-    0x00, 0x16, 0x03, 0x93, 0x03, 0x93, 0x00, 0x1c, 0x03, 0x95, 0x03, 0x9a, 0x00, 0x0a, 0x03, 0x9b,
-    0x03, 0x9b, 0x00, 0x1b, 0x03, 0x9c, 0x03, 0x9d, 0x00, 0x18, 0x03, 0xee, 0x03, 0xee, 0x00, 0x11,
-    0x03, 0xf0, 0x03, 0xf0, 0x00, 0x11, 0x03, 0xf2, 0x03, 0xf2, 0x00, 0x11, 0x03, 0xf4, 0x03, 0xf4,
-    0x00, 0x0e, 0x03, 0xf5, 0x03, 0xf5, 0x00, 0x0c, 0x03, 0xf6, 0x03, 0xf7, 0x00, 0x0d, 0x03, 0xfa,
-    0x03, 0xfa, 0x00, 0x0d, 0x03, 0xfc, 0x03, 0xfc, 0x00, 0x09, 0x03, 0xfd, 0x03, 0xfd, 0x00, 0x03,
-    0x03, 0xfe, 0x03, 0xfe, 0x00, 0x04, 0x04, 0x39, 0x04, 0x39, 0x00, 0x03, 0x04, 0x3a, 0x04, 0x3a,
-    0x00, 0x04, 0x04, 0x3b, 0x04, 0x3b, 0x00, 0x03, 0x04, 0x3c, 0x04, 0x3c, 0x00, 0x04, 0x04, 0x3d,
-    0x04, 0x3d, 0x00, 0x03, 0x04, 0x3e, 0x04, 0x3e, 0x00, 0x04, 0x04, 0x3f, 0x04, 0x3f, 0x00, 0x03,
-    0x04, 0x40, 0x04, 0x40, 0x00, 0x04, 0x04, 0x41, 0x04, 0x41, 0x00, 0x03, 0x04, 0x42, 0x04, 0x42,
-    0x00, 0x04, 0x04, 0x43, 0x04, 0x43, 0x00, 0x03, 0x04, 0x44, 0x04, 0x44, 0x00, 0x04, 0x04, 0x45,
-    0x04, 0x45, 0x00, 0x03, 0x04, 0x46, 0x04, 0x46, 0x00, 0x04, 0x04, 0x47, 0x04, 0x47, 0x00, 0x03,
-    0x04, 0x48, 0x04, 0x48, 0x00, 0x04, 0x04, 0x49, 0x04, 0x49, 0x00, 0x03, 0x04, 0x4a, 0x04, 0x4a,
-    0x00, 0x04, 0x04, 0x4b, 0x04, 0x4b, 0x00, 0x03, 0x04, 0x4c, 0x04, 0x4c, 0x00, 0x04, 0x04, 0x4d,
-    0x04, 0x4d, 0x00, 0x03, 0x04, 0x4e, 0x04, 0x4e, 0x00, 0x04, 0x04, 0x4f, 0x04, 0x4f, 0x00, 0x03,
-    0x04, 0x50, 0x04, 0x50, 0x00, 0x04, 0x04, 0x52, 0x04, 0x52, 0x00, 0x02, 0x04, 0x54, 0x04, 0x54,
-    0x00, 0x02, 0x04, 0x56, 0x04, 0x56, 0x00, 0x02, 0x04, 0x58, 0x04, 0x58, 0x00, 0x02, 0x04, 0x5a,
-    0x04, 0x5a, 0x00, 0x02, 0x04, 0x5c, 0x04, 0x5c, 0x00, 0x02, 0x04, 0x5e, 0x04, 0x5e, 0x00, 0x02,
-    0x04, 0x60, 0x04, 0x60, 0x00, 0x02, 0x04, 0x65, 0x04, 0x65, 0x00, 0x01, 0x04, 0x66, 0x04, 0x66,
-    0x00, 0x07, 0x04, 0x67, 0x04, 0x67, 0x00, 0x01, 0x04, 0x68, 0x04, 0x68, 0x00, 0x07, 0x04, 0x69,
-    0x04, 0x69, 0x00, 0x01, 0x04, 0x6a, 0x04, 0x6a, 0x00, 0x07, 0x04, 0x6b, 0x04, 0x6b, 0x00, 0x01,
-    0x04, 0x6c, 0x04, 0x6c, 0x00, 0x07, 0x04, 0x6d, 0x04, 0x6d, 0x00, 0x01, 0x04, 0x6e, 0x04, 0x6e,
-    0x00, 0x07, 0x04, 0x6f, 0x04, 0x6f, 0x00, 0x01, 0x04, 0x70, 0x04, 0x70, 0x00, 0x07, 0x04, 0x71,
-    0x04, 0x71, 0x00, 0x01, 0x04, 0x72, 0x04, 0x72, 0x00, 0x07, 0x04, 0x73, 0x04, 0x73, 0x00, 0x01,
-    0x04, 0x74, 0x04, 0x74, 0x00, 0x02, 0x04, 0x75, 0x04, 0x75, 0x00, 0x01, 0x04, 0x76, 0x04, 0x76,
-    0x00, 0x02, 0x04, 0x77, 0x04, 0x77, 0x00, 0x01, 0x04, 0x78, 0x04, 0x78, 0x00, 0x02, 0x04, 0x79,
-    0x04, 0x79, 0x00, 0x01, 0x04, 0x7a, 0x04, 0x7a, 0x00, 0x07, 0x04, 0x7b, 0x04, 0x7b, 0x00, 0x01,
-    0x04, 0x7c, 0x04, 0x7c, 0x00, 0x02, 0x04, 0x7d, 0x04, 0x7d, 0x00, 0x08, 0x04, 0x7e, 0x04, 0x7e,
-    0x00, 0x06, 0x04, 0x7f, 0x04, 0x7f, 0x00, 0x08, 0x04, 0x80, 0x04, 0x80, 0x00, 0x06, 0x04, 0x82,
-    0x04, 0x82, 0x00, 0x06, 0x04, 0x84, 0x04, 0x84, 0x00, 0x06, 0x04, 0x86, 0x04, 0x86, 0x00, 0x06,
-    0x04, 0x88, 0x04, 0x88, 0x00, 0x06, 0x04, 0x8a, 0x04, 0x8a, 0x00, 0x06, 0x04, 0x8b, 0x04, 0x8b,
-    0x00, 0x0e, 0x04, 0x8c, 0x04, 0x8c, 0x00, 0x0c, 0x04, 0x8d, 0x04, 0x8d, 0x00, 0x0e, 0x04, 0x8e,
-    0x04, 0x8e, 0x00, 0x0c, 0x04, 0x8f, 0x04, 0x8f, 0x00, 0x0e, 0x04, 0x90, 0x04, 0x90, 0x00, 0x0c,
-    0x04, 0xa7, 0x04, 0xa7, 0x00, 0x15, 0x04, 0xb3, 0x04, 0xb3, 0x00, 0x09, 0x04, 0xb4, 0x04, 0xb4,
-    0x00, 0x03, 0x04, 0xb5, 0x04, 0xb5, 0x00, 0x04, 0x04, 0xb7, 0x04, 0xb7, 0x00, 0x02, 0x04, 0xba,
-    0x04, 0xba, 0x00, 0x01, 0x04, 0xbb, 0x04, 0xbb, 0x00, 0x07, 0x04, 0xbf, 0x04, 0xbf, 0x00, 0x06,
-    0x04, 0xc4, 0x04, 0xc4, 0x00, 0x02, 0x04, 0xc6, 0x04, 0xc6, 0x00, 0x02, 0x04, 0xd0, 0x04, 0xd0,
-    0x00, 0x09, 0x04, 0xd2, 0x04, 0xd2, 0x00, 0x09, 0x04, 0xd3, 0x04, 0xd3, 0x00, 0x01, 0x04, 0xd8,
-    0x04, 0xd8, 0x00, 0x10, 0x04, 0xd9, 0x04, 0xd9, 0x00, 0x0f, 0x04, 0xda, 0x04, 0xda, 0x00, 0x13,
-    0x04, 0xdc, 0x04, 0xdc, 0x00, 0x08, 0x04, 0xdd, 0x04, 0xdd, 0x00, 0x19, 0x04, 0xde, 0x04, 0xde,
-    0x00, 0x0c, 0x04, 0xdf, 0x04, 0xdf, 0x00, 0x19, 0x04, 0xe0, 0x04, 0xe0, 0x00, 0x0c, 0x04, 0xe1,
-    0x04, 0xe1, 0x00, 0x11, 0x04, 0xe3, 0x04, 0xe3, 0x00, 0x14, 0x04, 0xe4, 0x04, 0xe4, 0x00, 0x17,
-    0x00, 0x02, 0x00, 0xec, 0x00, 0x06, 0x00, 0x06, 0x00, 0x0c, 0x00, 0x0b, 0x00, 0x0b, 0x00, 0x0c,
-    0x00, 0x25, 0x00, 0x25, 0x00, 0x02, 0x00, 0x26, 0x00, 0x26, 0x00, 0x1b, 0x00, 0x27, 0x00, 0x27,
-    0x00, 0x0e, 0x00, 0x29, 0x00, 0x29, 0x00, 0x04, 0x00, 0x2c, 0x00, 0x2d, 0x00, 0x01, 0x00, 0x2e,
-    0x00, 0x2e, 0x00, 0x07, 0x00, 0x2f, 0x00, 0x2f, 0x00, 0x18, 0x00, 0x30, 0x00, 0x30, 0x00, 0x0f,
-    0x00, 0x31, 0x00, 0x32, 0x00, 0x01, 0x00, 0x34, 0x00, 0x34, 0x00, 0x1c, 0x00, 0x38, 0x00, 0x38,
-    0x00, 0x10, 0x00, 0x39, 0x00, 0x39, 0x00, 0x07, 0x00, 0x3a, 0x00, 0x3a, 0x00, 0x19, 0x00, 0x3b,
-    0x00, 0x3b, 0x00, 0x11, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x1e, 0x00, 0x3d, 0x00, 0x3d, 0x00, 0x0d,
-    0x00, 0x3e, 0x00, 0x3e, 0x00, 0x14, 0x00, 0x45, 0x00, 0x45, 0x00, 0x03, 0x00, 0x46, 0x00, 0x46,
-    0x00, 0x15, 0x00, 0x47, 0x00, 0x47, 0x00, 0x12, 0x00, 0x49, 0x00, 0x49, 0x00, 0x05, 0x00, 0x4c,
-    0x00, 0x4c, 0x00, 0x08, 0x00, 0x51, 0x00, 0x52, 0x00, 0x08, 0x00, 0x53, 0x00, 0x53, 0x00, 0x06,
-    0x00, 0x54, 0x00, 0x54, 0x00, 0x15, 0x00, 0x56, 0x00, 0x56, 0x00, 0x13, 0x00, 0x5a, 0x00, 0x5a,
-    0x00, 0x0b, 0x00, 0x5c, 0x00, 0x5c, 0x00, 0x22, 0x00, 0x5d, 0x00, 0x5d, 0x00, 0x0b, 0x00, 0x5e,
-    0x00, 0x5e, 0x00, 0x17, 0x00, 0x8a, 0x00, 0x8a, 0x00, 0x15, 0x00, 0x96, 0x00, 0x96, 0x00, 0x20,
-    0x00, 0xb2, 0x00, 0xb2, 0x00, 0x21, 0x01, 0x84, 0x01, 0x85, 0x00, 0x0c, 0x01, 0x87, 0x01, 0x89,
-    0x00, 0x0c, 0x01, 0xf2, 0x01, 0xf2, 0x00, 0x1a, 0x01, 0xf7, 0x01, 0xf7, 0x00, 0x09, 0x01, 0xfa,
-    0x01, 0xfa, 0x00, 0x16, 0x01, 0xfb, 0x01, 0xfb, 0x00, 0x1d, 0x02, 0x05, 0x02, 0x05, 0x00, 0x1f,
-    0x02, 0x4a, 0x02, 0x4a, 0x00, 0x09, 0x02, 0x4d, 0x02, 0x4d, 0x00, 0x0a, 0x02, 0x5f, 0x02, 0x5f,
-    0x00, 0x0e, 0x02, 0x98, 0x02, 0x98, 0x00, 0x10, 0x02, 0x9a, 0x02, 0xa0, 0x00, 0x02, 0x02, 0xa1,
-    0x02, 0xa1, 0x00, 0x0e, 0x02, 0xa2, 0x02, 0xa5, 0x00, 0x04, 0x02, 0xa6, 0x02, 0xaa, 0x00, 0x01,
-    0x02, 0xb0, 0x02, 0xb3, 0x00, 0x07, 0x02, 0xb4, 0x02, 0xb4, 0x00, 0x0d, 0x02, 0xb5, 0x02, 0xbb,
-    0x00, 0x03, 0x02, 0xbc, 0x02, 0xbc, 0x00, 0x12, 0x02, 0xbd, 0x02, 0xc0, 0x00, 0x05, 0x02, 0xc5,
-    0x02, 0xc5, 0x00, 0x08, 0x02, 0xc6, 0x02, 0xca, 0x00, 0x06, 0x02, 0xcf, 0x02, 0xd0, 0x00, 0x0b,
-    0x02, 0xd1, 0x02, 0xd1, 0x00, 0x02, 0x02, 0xd2, 0x02, 0xd2, 0x00, 0x03, 0x02, 0xd3, 0x02, 0xd3,
-    0x00, 0x02, 0x02, 0xd4, 0x02, 0xd4, 0x00, 0x03, 0x02, 0xd5, 0x02, 0xd5, 0x00, 0x02, 0x02, 0xd6,
-    0x02, 0xd6, 0x00, 0x03, 0x02, 0xd7, 0x02, 0xd7, 0x00, 0x0e, 0x02, 0xd8, 0x02, 0xd8, 0x00, 0x12,
-    0x02, 0xd9, 0x02, 0xd9, 0x00, 0x0e, 0x02, 0xda, 0x02, 0xda, 0x00, 0x12, 0x02, 0xdb, 0x02, 0xdb,
-    0x00, 0x0e, 0x02, 0xdc, 0x02, 0xdc, 0x00, 0x12, 0x02, 0xdd, 0x02, 0xdd, 0x00, 0x0e, 0x02, 0xde,
-    0x02, 0xde, 0x00, 0x12, 0x02, 0xe1, 0x02, 0xe1, 0x00, 0x04, 0x02, 0xe2, 0x02, 0xe2, 0x00, 0x05,
-    0x02, 0xe3, 0x02, 0xe3, 0x00, 0x04, 0x02, 0xe4, 0x02, 0xe4, 0x00, 0x05, 0x02, 0xe5, 0x02, 0xe5,
-    0x00, 0x04, 0x02, 0xe6, 0x02, 0xe6, 0x00, 0x05, 0x02, 0xe7, 0x02, 0xe7, 0x00, 0x04, 0x02, 0xe8,
-    0x02, 0xe8, 0x00, 0x05, 0x02, 0xe9, 0x02, 0xe9, 0x00, 0x04, 0x02, 0xea, 0x02, 0xea, 0x00, 0x05,
-    0x02, 0xf3, 0x02, 0xf3, 0x00, 0x01, 0x02, 0xf4, 0x02, 0xf4, 0x00, 0x08, 0x02, 0xf5, 0x02, 0xf5,
-    0x00, 0x01, 0x02, 0xf7, 0x02, 0xf7, 0x00, 0x01, 0x02, 0xf9, 0x02, 0xf9, 0x00, 0x01, 0x02, 0xfb,
-    0x02, 0xfb, 0x00, 0x01, 0x02, 0xfd, 0x02, 0xfd, 0x00, 0x01, 0x03, 0x00, 0x03, 0x00, 0x00, 0x07,
-    0x03, 0x02, 0x03, 0x02, 0x00, 0x18, 0x03, 0x04, 0x03, 0x04, 0x00, 0x0f, 0x03, 0x06, 0x03, 0x06,
-    0x00, 0x0f, 0x03, 0x08, 0x03, 0x08, 0x00, 0x0f, 0x03, 0x0a, 0x03, 0x0a, 0x00, 0x0f, 0x03, 0x0c,
-    0x03, 0x0c, 0x00, 0x01, 0x03, 0x0d, 0x03, 0x0d, 0x00, 0x08, 0x03, 0x0e, 0x03, 0x0e, 0x00, 0x01,
-    0x03, 0x0f, 0x03, 0x0f, 0x00, 0x08, 0x03, 0x10, 0x03, 0x10, 0x00, 0x01, 0x03, 0x11, 0x03, 0x12,
-    0x00, 0x08, 0x03, 0x14, 0x03, 0x14, 0x00, 0x06, 0x03, 0x16, 0x03, 0x16, 0x00, 0x06, 0x03, 0x18,
-    0x03, 0x18, 0x00, 0x06, 0x03, 0x1a, 0x03, 0x1a, 0x00, 0x13, 0x03, 0x1c, 0x03, 0x1c, 0x00, 0x13,
-    0x03, 0x1e, 0x03, 0x1e, 0x00, 0x13, 0x03, 0x29, 0x03, 0x29, 0x00, 0x10, 0x03, 0x2b, 0x03, 0x2b,
-    0x00, 0x10, 0x03, 0x2d, 0x03, 0x2d, 0x00, 0x10, 0x03, 0x2f, 0x03, 0x2f, 0x00, 0x07, 0x03, 0x31,
-    0x03, 0x31, 0x00, 0x07, 0x03, 0x33, 0x03, 0x33, 0x00, 0x07, 0x03, 0x35, 0x03, 0x35, 0x00, 0x07,
-    0x03, 0x37, 0x03, 0x37, 0x00, 0x07, 0x03, 0x39, 0x03, 0x39, 0x00, 0x07, 0x03, 0x3b, 0x03, 0x3b,
-    0x00, 0x11, 0x03, 0x3d, 0x03, 0x3d, 0x00, 0x0d, 0x03, 0x3e, 0x03, 0x3e, 0x00, 0x0b, 0x03, 0x3f,
-    0x03, 0x3f, 0x00, 0x0d, 0x03, 0x40, 0x03, 0x40, 0x00, 0x14, 0x03, 0x41, 0x03, 0x41, 0x00, 0x17,
-    0x03, 0x42, 0x03, 0x42, 0x00, 0x14, 0x03, 0x43, 0x03, 0x43, 0x00, 0x17, 0x03, 0x44, 0x03, 0x44,
-    0x00, 0x14, 0x03, 0x45, 0x03, 0x45, 0x00, 0x17, 0x03, 0x4a, 0x03, 0x4b, 0x00, 0x09, 0x03, 0x4c,
-    0x03, 0x4c, 0x00, 0x1a, 0x03, 0x4d, 0x03, 0x53, 0x00, 0x0a, 0x03, 0x5e, 0x03, 0x62, 0x00, 0x09,
-    0x03, 0x68, 0x03, 0x6a, 0x00, 0x0a, 0x03, 0x6f, 0x03, 0x6f, 0x00, 0x09, 0x03, 0x80, 0x03, 0x80,
-    0x00, 0x1d, 0x03, 0x81, 0x03, 0x84, 0x00, 0x16, 0x03, 0x88, 0x03, 0x8a, 0x00, 0x09, 0x03, 0x93,
-    0x03, 0x93, 0x00, 0x1a, 0x03, 0xee, 0x03, 0xee, 0x00, 0x11, 0x03, 0xf0, 0x03, 0xf0, 0x00, 0x11,
-    0x03, 0xf2, 0x03, 0xf2, 0x00, 0x11, 0x03, 0xf4, 0x03, 0xf4, 0x00, 0x0d, 0x03, 0xf5, 0x03, 0xf5,
-    0x00, 0x0b, 0x03, 0xf6, 0x03, 0xf7, 0x00, 0x0c, 0x03, 0xfa, 0x03, 0xfa, 0x00, 0x0c, 0x03, 0xfb,
-    0x03, 0xfb, 0x00, 0x01, 0x03, 0xfc, 0x03, 0xfc, 0x00, 0x08, 0x03, 0xfd, 0x03, 0xfd, 0x00, 0x02,
-    0x03, 0xfe, 0x03, 0xfe, 0x00, 0x03, 0x04, 0x39, 0x04, 0x39, 0x00, 0x02, 0x04, 0x3a, 0x04, 0x3a,
-    0x00, 0x03, 0x04, 0x3b, 0x04, 0x3b, 0x00, 0x02, 0x04, 0x3c, 0x04, 0x3c, 0x00, 0x03, 0x04, 0x3d,
-    0x04, 0x3d, 0x00, 0x02, 0x04, 0x3e, 0x04, 0x3e, 0x00, 0x03, 0x04, 0x3f, 0x04, 0x3f, 0x00, 0x02,
-    0x04, 0x40, 0x04, 0x40, 0x00, 0x03, 0x04, 0x41, 0x04, 0x41, 0x00, 0x02, 0x04, 0x42, 0x04, 0x42,
-    0x00, 0x03, 0x04, 0x43, 0x04, 0x43, 0x00, 0x02, 0x04, 0x44, 0x04, 0x44, 0x00, 0x03, 0x04, 0x45,
-    0x04, 0x45, 0x00, 0x02, 0x04, 0x46, 0x04, 0x46, 0x00, 0x03, 0x04, 0x47, 0x04, 0x47, 0x00, 0x02,
-    0x04, 0x48, 0x04, 0x48, 0x00, 0x03, 0x04, 0x49, 0x04, 0x49, 0x00, 0x02, 0x04, 0x4a, 0x04, 0x4a,
-    0x00, 0x03, 0x04, 0x4b, 0x04, 0x4b, 0x00, 0x02, 0x04, 0x4c, 0x04, 0x4c, 0x00, 0x03, 0x04, 0x4d,
-    0x04, 0x4d, 0x00, 0x02, 0x04, 0x4e, 0x04, 0x4e, 0x00, 0x03, 0x04, 0x4f, 0x04, 0x4f, 0x00, 0x02,
-    0x04, 0x50, 0x04, 0x50, 0x00, 0x03, 0x04, 0x51, 0x04, 0x51, 0x00, 0x04, 0x04, 0x52, 0x04, 0x52,
-    0x00, 0x05, 0x04, 0x53, 0x04, 0x53, 0x00, 0x04, 0x04, 0x54, 0x04, 0x54, 0x00, 0x05, 0x04, 0x55,
-    0x04, 0x55, 0x00, 0x04, 0x04, 0x56, 0x04, 0x56, 0x00, 0x05, 0x04, 0x57, 0x04, 0x57, 0x00, 0x04,
-    0x04, 0x58, 0x04, 0x58, 0x00, 0x05, 0x04, 0x59, 0x04, 0x59, 0x00, 0x04, 0x04, 0x5a, 0x04, 0x5a,
-    0x00, 0x05, 0x04, 0x5b, 0x04, 0x5b, 0x00, 0x04, 0x04, 0x5c, 0x04, 0x5c, 0x00, 0x05, 0x04, 0x5d,
-    0x04, 0x5d, 0x00, 0x04, 0x04, 0x5e, 0x04, 0x5e, 0x00, 0x05, 0x04, 0x5f, 0x04, 0x5f, 0x00, 0x04,
-    0x04, 0x60, 0x04, 0x60, 0x00, 0x05, 0x04, 0x61, 0x04, 0x61, 0x00, 0x01, 0x04, 0x63, 0x04, 0x63,
-    0x00, 0x01, 0x04, 0x66, 0x04, 0x66, 0x00, 0x06, 0x04, 0x68, 0x04, 0x68, 0x00, 0x06, 0x04, 0x6a,
-    0x04, 0x6a, 0x00, 0x06, 0x04, 0x6c, 0x04, 0x6c, 0x00, 0x06, 0x04, 0x6e, 0x04, 0x6e, 0x00, 0x06,
-    0x04, 0x70, 0x04, 0x70, 0x00, 0x06, 0x04, 0x72, 0x04, 0x72, 0x00, 0x06, 0x04, 0x7a, 0x04, 0x7a,
-    0x00, 0x06, 0x04, 0x7d, 0x04, 0x7d, 0x00, 0x07, 0x04, 0x7f, 0x04, 0x7f, 0x00, 0x07, 0x04, 0x8b,
-    0x04, 0x8b, 0x00, 0x0d, 0x04, 0x8c, 0x04, 0x8c, 0x00, 0x0b, 0x04, 0x8d, 0x04, 0x8d, 0x00, 0x0d,
-    0x04, 0x8e, 0x04, 0x8e, 0x00, 0x0b, 0x04, 0x8f, 0x04, 0x8f, 0x00, 0x0d, 0x04, 0x90, 0x04, 0x90,
-    0x00, 0x0b, 0x04, 0xb2, 0x04, 0xb2, 0x00, 0x01, 0x04, 0xb3, 0x04, 0xb3, 0x00, 0x08, 0x04, 0xb4,
-    0x04, 0xb4, 0x00, 0x02, 0x04, 0xb5, 0x04, 0xb5, 0x00, 0x03, 0x04, 0xb6, 0x04, 0xb6, 0x00, 0x04,
-    0x04, 0xb8, 0x04, 0xb8, 0x00, 0x01, 0x04, 0xbb, 0x04, 0xbb, 0x00, 0x06, 0x04, 0xbd, 0x04, 0xbd,
-    0x00, 0x13, 0x04, 0xc1, 0x04, 0xc1, 0x00, 0x1b, 0x04, 0xc2, 0x04, 0xc2, 0x00, 0x15, 0x04, 0xc7,
-    0x04, 0xc7, 0x00, 0x01, 0x04, 0xc8, 0x04, 0xc8, 0x00, 0x08, 0x04, 0xc9, 0x04, 0xc9, 0x00, 0x18,
-    0x04, 0xcb, 0x04, 0xcb, 0x00, 0x18, 0x04, 0xcd, 0x04, 0xcd, 0x00, 0x0f, 0x04, 0xcf, 0x04, 0xcf,
-    0x00, 0x01, 0x04, 0xd0, 0x04, 0xd0, 0x00, 0x08, 0x04, 0xd1, 0x04, 0xd1, 0x00, 0x01, 0x04, 0xd2,
-    0x04, 0xd2, 0x00, 0x08, 0x04, 0xd4, 0x04, 0xd4, 0x00, 0x1c, 0x04, 0xd5, 0x04, 0xd5, 0x00, 0x15,
-    0x04, 0xd7, 0x04, 0xd7, 0x00, 0x13, 0x04, 0xda, 0x04, 0xda, 0x00, 0x10, 0x04, 0xdc, 0x04, 0xdc,
-    0x00, 0x07, 0x04, 0xdd, 0x04, 0xdd, 0x00, 0x19, 0x04, 0xde, 0x04, 0xde, 0x00, 0x0b, 0x04, 0xdf,
-    0x04, 0xdf, 0x00, 0x19, 0x04, 0xe0, 0x04, 0xe0, 0x00, 0x0b, 0x04, 0xe1, 0x04, 0xe1, 0x00, 0x11,
-    0x04, 0xe3, 0x04, 0xe3, 0x00, 0x14, 0x04, 0xe4, 0x04, 0xe4, 0x00, 0x17, 0x00, 0x01, 0x01, 0xf2,
-    0x00, 0x04, 0x00, 0x00, 0x00, 0xf4, 0x0d, 0x34, 0x0d, 0x2e, 0x0d, 0x2e, 0x0c, 0xe8, 0x0c, 0xd2,
-    0x0c, 0xc4, 0x0c, 0xbe, 0x0c, 0xb0, 0x0a, 0x12, 0x0a, 0x04, 0x09, 0xee, 0x0c, 0xbe, 0x09, 0xe4,
-    0x09, 0x5a, 0x09, 0x18, 0x08, 0xf6, 0x08, 0xe4, 0x08, 0xce, 0x08, 0xc4, 0x08, 0x86, 0x08, 0x78,
-    0x08, 0x36, 0x08, 0x30, 0x07, 0x56, 0x07, 0x50, 0x06, 0xaa, 0x16, 0xd6, 0x16, 0xd6, 0x06, 0xa4,
-    0x06, 0x96, 0x06, 0x48, 0x06, 0x42, 0x06, 0x28, 0x06, 0x42, 0x05, 0xe6, 0x0c, 0xbe, 0x05, 0x90,
-    0x05, 0x7e, 0x0d, 0x2e, 0x04, 0x54, 0x0d, 0x2e, 0x0d, 0x2e, 0x0d, 0x2e, 0x04, 0x4e, 0x04, 0x28,
-    0x04, 0x02, 0x03, 0xfc, 0x03, 0xf2, 0x03, 0xec, 0x03, 0xde, 0x03, 0xec, 0x0c, 0xc4, 0x0c, 0xbe,
-    0x0c, 0xbe, 0x0c, 0xbe, 0x0c, 0xbe, 0x08, 0xf6, 0x0c, 0xd2, 0x0c, 0xd2, 0x0c, 0xd2, 0x0c, 0xd2,
-    0x0c, 0xd2, 0x0c, 0xd2, 0x0c, 0xd2, 0x0c, 0xc4, 0x0c, 0xb0, 0x0c, 0xb0, 0x0c, 0xb0, 0x0c, 0xb0,
-    0x0c, 0xbe, 0x0c, 0xbe, 0x0c, 0xbe, 0x0c, 0xbe, 0x0c, 0xbe, 0x08, 0x86, 0x08, 0x30, 0x08, 0x30,
-    0x08, 0x30, 0x08, 0x30, 0x16, 0xd6, 0x06, 0xa4, 0x06, 0xa4, 0x06, 0xa4, 0x06, 0xa4, 0x06, 0xa4,
-    0x06, 0x42, 0x06, 0x42, 0x0c, 0xd2, 0x0c, 0xd2, 0x0c, 0xd2, 0x0c, 0xc4, 0x0c, 0xc4, 0x0c, 0xc4,
-    0x0c, 0xc4, 0x0c, 0xbe, 0x0c, 0xb0, 0x08, 0x30, 0x0c, 0xb0, 0x08, 0x30, 0x0c, 0xb0, 0x08, 0x30,
-    0x0c, 0xb0, 0x08, 0x30, 0x0c, 0xb0, 0x08, 0x30, 0x16, 0xd6, 0x0a, 0x04, 0x09, 0xee, 0x09, 0xee,
-    0x09, 0xee, 0x09, 0xee, 0x16, 0xd6, 0x16, 0xd6, 0x16, 0xd6, 0x16, 0xd6, 0x0c, 0xbe, 0x06, 0xa4,
-    0x0c, 0xbe, 0x06, 0xa4, 0x0c, 0xbe, 0x06, 0xa4, 0x06, 0x96, 0x06, 0x96, 0x06, 0x96, 0x08, 0xf6,
-    0x08, 0xf6, 0x08, 0xf6, 0x08, 0xce, 0x08, 0x86, 0x06, 0x42, 0x08, 0x86, 0x08, 0x78, 0x08, 0x78,
-    0x08, 0x78, 0x03, 0xfc, 0x03, 0xfc, 0x04, 0x4e, 0x03, 0xec, 0x03, 0xec, 0x03, 0xec, 0x03, 0xec,
-    0x03, 0xec, 0x03, 0xec, 0x03, 0xec, 0x03, 0xfc, 0x03, 0xfc, 0x03, 0xfc, 0x03, 0xfc, 0x03, 0xfc,
-    0x03, 0xec, 0x03, 0xec, 0x03, 0xec, 0x03, 0xfc, 0x03, 0xf2, 0x03, 0xf2, 0x03, 0xf2, 0x03, 0xf2,
-    0x03, 0xfc, 0x03, 0xfc, 0x03, 0xfc, 0x04, 0x4e, 0x08, 0xce, 0x08, 0xce, 0x08, 0xce, 0x08, 0x86,
-    0x06, 0x42, 0x0d, 0x2e, 0x0d, 0x2e, 0x0d, 0x2e, 0x16, 0xd6, 0x0c, 0xd2, 0x0c, 0xd2, 0x0c, 0xd2,
-    0x0c, 0xd2, 0x0c, 0xd2, 0x0c, 0xd2, 0x0c, 0xd2, 0x0c, 0xd2, 0x0c, 0xd2, 0x0c, 0xd2, 0x0c, 0xd2,
-    0x0c, 0xd2, 0x0c, 0xd2, 0x0c, 0xb0, 0x08, 0x30, 0x0c, 0xb0, 0x08, 0x30, 0x0c, 0xb0, 0x08, 0x30,
-    0x0c, 0xb0, 0x08, 0x30, 0x0c, 0xb0, 0x08, 0x30, 0x0c, 0xb0, 0x08, 0x30, 0x0c, 0xb0, 0x08, 0x30,
-    0x0c, 0xb0, 0x08, 0x30, 0x0c, 0xbe, 0x06, 0xa4, 0x0c, 0xbe, 0x06, 0xa4, 0x0c, 0xbe, 0x06, 0xa4,
-    0x0c, 0xbe, 0x06, 0xa4, 0x0c, 0xbe, 0x06, 0xa4, 0x0c, 0xbe, 0x06, 0xa4, 0x0c, 0xbe, 0x06, 0xa4,
-    0x06, 0xa4, 0x08, 0x86, 0x06, 0x42, 0x08, 0x86, 0x06, 0x42, 0x08, 0x86, 0x06, 0x42, 0x16, 0xd6,
-    0x0c, 0xd2, 0x0c, 0xb0, 0x0c, 0xbe, 0x06, 0xa4, 0x06, 0x96, 0x0c, 0xbe, 0x0c, 0xbe, 0x16, 0xd6,
-    0x0a, 0x04, 0x0a, 0x04, 0x09, 0xee, 0x16, 0xd6, 0x16, 0xd6, 0x0c, 0xbe, 0x09, 0xe4, 0x06, 0x96,
-    0x08, 0xf6, 0x08, 0xe4, 0x06, 0x42, 0x08, 0xe4, 0x06, 0x42, 0x08, 0xce, 0x08, 0x78, 0x00, 0x01,
-    0x00, 0xf4, 0x00, 0x04, 0x00, 0x06, 0x00, 0x0b, 0x00, 0x0c, 0x00, 0x25, 0x00, 0x27, 0x00, 0x28,
-    0x00, 0x29, 0x00, 0x2a, 0x00, 0x2f, 0x00, 0x30, 0x00, 0x33, 0x00, 0x34, 0x00, 0x35, 0x00, 0x36,
-    0x00, 0x38, 0x00, 0x3a, 0x00, 0x3b, 0x00, 0x3c, 0x00, 0x3d, 0x00, 0x3e, 0x00, 0x3f, 0x00, 0x49,
-    0x00, 0x4a, 0x00, 0x4c, 0x00, 0x4f, 0x00, 0x51, 0x00, 0x52, 0x00, 0x53, 0x00, 0x56, 0x00, 0x58,
-    0x00, 0x5a, 0x00, 0x5b, 0x00, 0x5d, 0x00, 0x5f, 0x00, 0x96, 0x00, 0x9d, 0x00, 0xb2, 0x01, 0x84,
-    0x01, 0x85, 0x01, 0x87, 0x01, 0x88, 0x01, 0x89, 0x01, 0xf2, 0x01, 0xf4, 0x01, 0xf5, 0x01, 0xf7,
-    0x01, 0xfa, 0x02, 0x05, 0x02, 0x4a, 0x02, 0x4d, 0x02, 0x5f, 0x02, 0x61, 0x02, 0x62, 0x02, 0x95,
-    0x02, 0x96, 0x02, 0x98, 0x02, 0x9a, 0x02, 0x9b, 0x02, 0x9c, 0x02, 0x9d, 0x02, 0x9e, 0x02, 0x9f,
-    0x02, 0xa0, 0x02, 0xa1, 0x02, 0xa2, 0x02, 0xa3, 0x02, 0xa4, 0x02, 0xa5, 0x02, 0xab, 0x02, 0xac,
-    0x02, 0xad, 0x02, 0xae, 0x02, 0xaf, 0x02, 0xb4, 0x02, 0xbd, 0x02, 0xbe, 0x02, 0xbf, 0x02, 0xc0,
-    0x02, 0xc5, 0x02, 0xc6, 0x02, 0xc7, 0x02, 0xc8, 0x02, 0xc9, 0x02, 0xca, 0x02, 0xcf, 0x02, 0xd0,
-    0x02, 0xd1, 0x02, 0xd3, 0x02, 0xd5, 0x02, 0xd7, 0x02, 0xd9, 0x02, 0xdb, 0x02, 0xdd, 0x02, 0xdf,
-    0x02, 0xe1, 0x02, 0xe2, 0x02, 0xe3, 0x02, 0xe4, 0x02, 0xe5, 0x02, 0xe6, 0x02, 0xe7, 0x02, 0xe8,
-    0x02, 0xe9, 0x02, 0xea, 0x02, 0xf4, 0x03, 0x02, 0x03, 0x04, 0x03, 0x06, 0x03, 0x08, 0x03, 0x0a,
-    0x03, 0x0d, 0x03, 0x0f, 0x03, 0x11, 0x03, 0x12, 0x03, 0x13, 0x03, 0x14, 0x03, 0x15, 0x03, 0x16,
-    0x03, 0x17, 0x03, 0x18, 0x03, 0x1a, 0x03, 0x1c, 0x03, 0x1e, 0x03, 0x29, 0x03, 0x2b, 0x03, 0x2d,
-    0x03, 0x3b, 0x03, 0x3d, 0x03, 0x3e, 0x03, 0x3f, 0x03, 0x40, 0x03, 0x42, 0x03, 0x44, 0x03, 0x4a,
-    0x03, 0x4b, 0x03, 0x4c, 0x03, 0x4d, 0x03, 0x4e, 0x03, 0x4f, 0x03, 0x50, 0x03, 0x51, 0x03, 0x52,
-    0x03, 0x53, 0x03, 0x5e, 0x03, 0x5f, 0x03, 0x60, 0x03, 0x61, 0x03, 0x62, 0x03, 0x68, 0x03, 0x69,
-    0x03, 0x6a, 0x03, 0x6f, 0x03, 0x81, 0x03, 0x82, 0x03, 0x83, 0x03, 0x84, 0x03, 0x88, 0x03, 0x89,
-    0x03, 0x8a, 0x03, 0x93, 0x03, 0xee, 0x03, 0xf0, 0x03, 0xf2, 0x03, 0xf4, 0x03, 0xf5, 0x03, 0xf6,
-    0x03, 0xf7, 0x03, 0xfa, 0x03, 0xfc, 0x03, 0xfd, 0x04, 0x39, 0x04, 0x3b, 0x04, 0x3d, 0x04, 0x3f,
-    0x04, 0x41, 0x04, 0x43, 0x04, 0x45, 0x04, 0x47, 0x04, 0x49, 0x04, 0x4b, 0x04, 0x4d, 0x04, 0x4f,
-    0x04, 0x51, 0x04, 0x52, 0x04, 0x53, 0x04, 0x54, 0x04, 0x55, 0x04, 0x56, 0x04, 0x57, 0x04, 0x58,
-    0x04, 0x59, 0x04, 0x5a, 0x04, 0x5b, 0x04, 0x5c, 0x04, 0x5d, 0x04, 0x5e, 0x04, 0x5f, 0x04, 0x60,
-    0x04, 0x65, 0x04, 0x66, 0x04, 0x67, 0x04, 0x68, 0x04, 0x69, 0x04, 0x6a, 0x04, 0x6b, 0x04, 0x6c,
-    0x04, 0x6d, 0x04, 0x6e, 0x04, 0x6f, 0x04, 0x70, 0x04, 0x71, 0x04, 0x72, 0x04, 0x7a, 0x04, 0x8b,
-    0x04, 0x8c, 0x04, 0x8d, 0x04, 0x8e, 0x04, 0x8f, 0x04, 0x90, 0x04, 0xb3, 0x04, 0xb4, 0x04, 0xb6,
-    0x04, 0xba, 0x04, 0xbb, 0x04, 0xbd, 0x04, 0xc3, 0x04, 0xc5, 0x04, 0xc8, 0x04, 0xc9, 0x04, 0xcb,
-    0x04, 0xcd, 0x04, 0xd0, 0x04, 0xd2, 0x04, 0xd3, 0x04, 0xd4, 0x04, 0xd7, 0x04, 0xda, 0x04, 0xdd,
-    0x04, 0xde, 0x04, 0xdf, 0x04, 0xe0, 0x04, 0xe1, 0x04, 0xe3, 0x00, 0x03, 0x01, 0xef, 0xff, 0xf5,
-    0x01, 0xf0, 0xff, 0xee, 0x03, 0x9b, 0xff, 0xf5, 0x00, 0x01, 0x01, 0xf0, 0xff, 0xc7, 0x00, 0x02,
-    0x01, 0xf0, 0xff, 0xb7, 0x01, 0xf5, 0xff, 0xf0, 0x00, 0x01, 0x01, 0xf0, 0xff, 0xf1, 0x00, 0x09,
-    0x01, 0xed, 0xff, 0xe5, 0x01, 0xef, 0xff, 0xf1, 0x01, 0xf0, 0xff, 0xeb, 0x01, 0xf2, 0xff, 0xe9,
-    0x03, 0x67, 0xff, 0xe5, 0x03, 0x93, 0xff, 0xe9, 0x03, 0x9b, 0xff, 0xf1, 0x03, 0x9c, 0xff, 0xe5,
-    0x03, 0x9d, 0xff, 0xe5, 0x00, 0x09, 0x01, 0xed, 0xff, 0xee, 0x01, 0xef, 0xff, 0xf5, 0x01, 0xf0,
-    0xff, 0xf1, 0x01, 0xf2, 0xff, 0xf2, 0x03, 0x67, 0xff, 0xee, 0x03, 0x93, 0xff, 0xf2, 0x03, 0x9b,
-    0xff, 0xf5, 0x03, 0x9c, 0xff, 0xee, 0x03, 0x9d, 0xff, 0xee, 0x00, 0x01, 0x01, 0xf0, 0x00, 0x0d,
-    0x00, 0x4a, 0x00, 0x47, 0xff, 0xb4, 0x00, 0x48, 0xff, 0xb4, 0x00, 0x49, 0xff, 0xb4, 0x00, 0x4b,
-    0xff, 0xb4, 0x00, 0x4c, 0x00, 0x14, 0x00, 0x4f, 0x00, 0x14, 0x00, 0x50, 0x00, 0x14, 0x00, 0x53,
-    0xff, 0x7a, 0x00, 0x55, 0xff, 0xb4, 0x00, 0x57, 0xff, 0x64, 0x00, 0x5b, 0x00, 0x0b, 0x00, 0x94,
-    0xff, 0xb4, 0x00, 0x99, 0xff, 0xb4, 0x01, 0xdb, 0xff, 0x64, 0x02, 0xbc, 0xff, 0xb4, 0x02, 0xbd,
-    0xff, 0xb4, 0x02, 0xbe, 0xff, 0xb4, 0x02, 0xbf, 0xff, 0xb4, 0x02, 0xc0, 0xff, 0xb4, 0x02, 0xc6,
-    0xff, 0x7a, 0x02, 0xc7, 0xff, 0x7a, 0x02, 0xc8, 0xff, 0x7a, 0x02, 0xc9, 0xff, 0x7a, 0x02, 0xca,
-    0xff, 0x7a, 0x02, 0xd8, 0xff, 0xb4, 0x02, 0xda, 0xff, 0xb4, 0x02, 0xdc, 0xff, 0xb4, 0x02, 0xde,
-    0xff, 0xb4, 0x02, 0xe0, 0xff, 0xb4, 0x02, 0xe2, 0xff, 0xb4, 0x02, 0xe4, 0xff, 0xb4, 0x02, 0xe6,
-    0xff, 0xb4, 0x02, 0xe8, 0xff, 0xb4, 0x02, 0xea, 0xff, 0xb4, 0x02, 0xec, 0xff, 0xb4, 0x02, 0xee,
-    0xff, 0xb4, 0x02, 0xf0, 0xff, 0xb4, 0x02, 0xf2, 0xff, 0xb4, 0x03, 0x14, 0xff, 0x7a, 0x03, 0x16,
-    0xff, 0x7a, 0x03, 0x18, 0xff, 0x7a, 0x03, 0x20, 0xff, 0x64, 0x03, 0x22, 0xff, 0x64, 0x03, 0x24,
-    0xff, 0x64, 0x03, 0x26, 0xff, 0x64, 0x03, 0x28, 0xff, 0x64, 0x04, 0x52, 0xff, 0xb4, 0x04, 0x54,
-    0xff, 0xb4, 0x04, 0x56, 0xff, 0xb4, 0x04, 0x58, 0xff, 0xb4, 0x04, 0x5a, 0xff, 0xb4, 0x04, 0x5c,
-    0xff, 0xb4, 0x04, 0x5e, 0xff, 0xb4, 0x04, 0x60, 0xff, 0xb4, 0x04, 0x66, 0xff, 0x7a, 0x04, 0x68,
-    0xff, 0x7a, 0x04, 0x6a, 0xff, 0x7a, 0x04, 0x6c, 0xff, 0x7a, 0x04, 0x6e, 0xff, 0x7a, 0x04, 0x70,
-    0xff, 0x7a, 0x04, 0x72, 0xff, 0x7a, 0x04, 0x74, 0xff, 0xb4, 0x04, 0x76, 0xff, 0xb4, 0x04, 0x78,
-    0xff, 0xb4, 0x04, 0x7a, 0xff, 0x7a, 0x04, 0x7c, 0xff, 0xb4, 0x04, 0xb7, 0xff, 0xb4, 0x04, 0xbb,
-    0xff, 0x7a, 0x04, 0xc4, 0xff, 0xb4, 0x04, 0xc6, 0xff, 0xb4, 0x04, 0xc8, 0x00, 0x14, 0x04, 0xca,
-    0x00, 0x14, 0x04, 0xcc, 0x00, 0x14, 0x04, 0xd9, 0xff, 0x64, 0x00, 0x04, 0x00, 0x58, 0xff, 0xef,
-    0x00, 0x5b, 0xff, 0xdf, 0x00, 0x9a, 0xff, 0xee, 0x01, 0xf0, 0xff, 0xcd, 0x00, 0x15, 0x00, 0x06,
-    0xff, 0xf2, 0x00, 0x0b, 0xff, 0xf2, 0x00, 0x5a, 0xff, 0xf3, 0x00, 0x5d, 0xff, 0xf3, 0x01, 0x84,
-    0xff, 0xf2, 0x01, 0x85, 0xff, 0xf2, 0x01, 0x87, 0xff, 0xf2, 0x01, 0x88, 0xff, 0xf2, 0x01, 0x89,
-    0xff, 0xf2, 0x02, 0xcf, 0xff, 0xf3, 0x02, 0xd0, 0xff, 0xf3, 0x03, 0x3e, 0xff, 0xf3, 0x03, 0xf5,
-    0xff, 0xf3, 0x03, 0xf6, 0xff, 0xf2, 0x03, 0xf7, 0xff, 0xf2, 0x03, 0xfa, 0xff, 0xf2, 0x04, 0x8c,
-    0xff, 0xf3, 0x04, 0x8e, 0xff, 0xf3, 0x04, 0x90, 0xff, 0xf3, 0x04, 0xde, 0xff, 0xf3, 0x04, 0xe0,
-    0xff, 0xf3, 0x00, 0x10, 0x00, 0x2e, 0xff, 0xec, 0x00, 0x39, 0xff, 0xec, 0x02, 0xb0, 0xff, 0xec,
-    0x02, 0xb1, 0xff, 0xec, 0x02, 0xb2, 0xff, 0xec, 0x02, 0xb3, 0xff, 0xec, 0x03, 0x00, 0xff, 0xec,
-    0x03, 0x2f, 0xff, 0xec, 0x03, 0x31, 0xff, 0xec, 0x03, 0x33, 0xff, 0xec, 0x03, 0x35, 0xff, 0xec,
-    0x03, 0x37, 0xff, 0xec, 0x03, 0x39, 0xff, 0xec, 0x04, 0x7d, 0xff, 0xec, 0x04, 0x7f, 0xff, 0xec,
-    0x04, 0xdc, 0xff, 0xec, 0x00, 0x06, 0x00, 0x10, 0xff, 0x84, 0x00, 0x12, 0xff, 0x84, 0x01, 0x86,
-    0xff, 0x84, 0x01, 0x8a, 0xff, 0x84, 0x01, 0x8e, 0xff, 0x84, 0x01, 0x8f, 0xff, 0x84, 0x00, 0x01,
-    0x00, 0x4a, 0x00, 0x0d, 0x00, 0x13, 0x00, 0x53, 0xff, 0xe8, 0x01, 0x85, 0x00, 0x09, 0x02, 0xc6,
-    0xff, 0xe8, 0x02, 0xc7, 0xff, 0xe8, 0x02, 0xc8, 0xff, 0xe8, 0x02, 0xc9, 0xff, 0xe8, 0x02, 0xca,
-    0xff, 0xe8, 0x03, 0x14, 0xff, 0xe8, 0x03, 0x16, 0xff, 0xe8, 0x03, 0x18, 0xff, 0xe8, 0x04, 0x66,
-    0xff, 0xe8, 0x04, 0x68, 0xff, 0xe8, 0x04, 0x6a, 0xff, 0xe8, 0x04, 0x6c, 0xff, 0xe8, 0x04, 0x6e,
-    0xff, 0xe8, 0x04, 0x70, 0xff, 0xe8, 0x04, 0x72, 0xff, 0xe8, 0x04, 0x7a, 0xff, 0xe8, 0x04, 0xbb,
-    0xff, 0xe8, 0x00, 0x03, 0x00, 0x4a, 0x00, 0x11, 0x00, 0x58, 0x00, 0x32, 0x00, 0x5b, 0x00, 0x11,
-    0x00, 0x01, 0x01, 0x85, 0xff, 0xa4, 0x00, 0x29, 0x00, 0x47, 0xff, 0xec, 0x00, 0x48, 0xff, 0xec,
-    0x00, 0x49, 0xff, 0xec, 0x00, 0x4b, 0xff, 0xec, 0x00, 0x55, 0xff, 0xec, 0x00, 0x94, 0xff, 0xec,
-    0x00, 0x99, 0xff, 0xec, 0x02, 0xbc, 0xff, 0xec, 0x02, 0xbd, 0xff, 0xec, 0x02, 0xbe, 0xff, 0xec,
-    0x02, 0xbf, 0xff, 0xec, 0x02, 0xc0, 0xff, 0xec, 0x02, 0xd8, 0xff, 0xec, 0x02, 0xda, 0xff, 0xec,
-    0x02, 0xdc, 0xff, 0xec, 0x02, 0xde, 0xff, 0xec, 0x02, 0xe0, 0xff, 0xec, 0x02, 0xe2, 0xff, 0xec,
-    0x02, 0xe4, 0xff, 0xec, 0x02, 0xe6, 0xff, 0xec, 0x02, 0xe8, 0xff, 0xec, 0x02, 0xea, 0xff, 0xec,
-    0x02, 0xec, 0xff, 0xec, 0x02, 0xee, 0xff, 0xec, 0x02, 0xf0, 0xff, 0xec, 0x02, 0xf2, 0xff, 0xec,
-    0x04, 0x52, 0xff, 0xec, 0x04, 0x54, 0xff, 0xec, 0x04, 0x56, 0xff, 0xec, 0x04, 0x58, 0xff, 0xec,
-    0x04, 0x5a, 0xff, 0xec, 0x04, 0x5c, 0xff, 0xec, 0x04, 0x5e, 0xff, 0xec, 0x04, 0x60, 0xff, 0xec,
-    0x04, 0x74, 0xff, 0xec, 0x04, 0x76, 0xff, 0xec, 0x04, 0x78, 0xff, 0xec, 0x04, 0x7c, 0xff, 0xec,
-    0x04, 0xb7, 0xff, 0xec, 0x04, 0xc4, 0xff, 0xec, 0x04, 0xc6, 0xff, 0xec, 0x00, 0x01, 0x01, 0x85,
-    0xff, 0xa7, 0x00, 0x36, 0x00, 0x06, 0x00, 0x10, 0x00, 0x0b, 0x00, 0x10, 0x00, 0x0d, 0x00, 0x14,
-    0x00, 0x41, 0x00, 0x12, 0x00, 0x47, 0xff, 0xe8, 0x00, 0x48, 0xff, 0xe8, 0x00, 0x49, 0xff, 0xe8,
-    0x00, 0x4b, 0xff, 0xe8, 0x00, 0x55, 0xff, 0xe8, 0x00, 0x61, 0x00, 0x13, 0x00, 0x94, 0xff, 0xe8,
-    0x00, 0x99, 0xff, 0xe8, 0x01, 0x84, 0x00, 0x10, 0x01, 0x85, 0x00, 0x10, 0x01, 0x87, 0x00, 0x10,
-    0x01, 0x88, 0x00, 0x10, 0x01, 0x89, 0x00, 0x10, 0x02, 0xbc, 0xff, 0xe8, 0x02, 0xbd, 0xff, 0xe8,
-    0x02, 0xbe, 0xff, 0xe8, 0x02, 0xbf, 0xff, 0xe8, 0x02, 0xc0, 0xff, 0xe8, 0x02, 0xd8, 0xff, 0xe8,
-    0x02, 0xda, 0xff, 0xe8, 0x02, 0xdc, 0xff, 0xe8, 0x02, 0xde, 0xff, 0xe8, 0x02, 0xe0, 0xff, 0xe8,
-    0x02, 0xe2, 0xff, 0xe8, 0x02, 0xe4, 0xff, 0xe8, 0x02, 0xe6, 0xff, 0xe8, 0x02, 0xe8, 0xff, 0xe8,
-    0x02, 0xea, 0xff, 0xe8, 0x02, 0xec, 0xff, 0xe8, 0x02, 0xee, 0xff, 0xe8, 0x02, 0xf0, 0xff, 0xe8,
-    0x02, 0xf2, 0xff, 0xe8, 0x03, 0xf6, 0x00, 0x10, 0x03, 0xf7, 0x00, 0x10, 0x03, 0xfa, 0x00, 0x10,
-    0x04, 0x52, 0xff, 0xe8, 0x04, 0x54, 0xff, 0xe8, 0x04, 0x56, 0xff, 0xe8, 0x04, 0x58, 0xff, 0xe8,
-    0x04, 0x5a, 0xff, 0xe8, 0x04, 0x5c, 0xff, 0xe8, 0x04, 0x5e, 0xff, 0xe8, 0x04, 0x60, 0xff, 0xe8,
-    0x04, 0x74, 0xff, 0xe8, 0x04, 0x76, 0xff, 0xe8, 0x04, 0x78, 0xff, 0xe8, 0x04, 0x7c, 0xff, 0xe8,
-    0x04, 0xb7, 0xff, 0xe8, 0x04, 0xc4, 0xff, 0xe8, 0x04, 0xc6, 0xff, 0xe8, 0x00, 0x01, 0x01, 0x85,
-    0xff, 0xb6, 0x00, 0x10, 0x00, 0x2e, 0xff, 0xee, 0x00, 0x39, 0xff, 0xee, 0x02, 0xb0, 0xff, 0xee,
-    0x02, 0xb1, 0xff, 0xee, 0x02, 0xb2, 0xff, 0xee, 0x02, 0xb3, 0xff, 0xee, 0x03, 0x00, 0xff, 0xee,
-    0x03, 0x2f, 0xff, 0xee, 0x03, 0x31, 0xff, 0xee, 0x03, 0x33, 0xff, 0xee, 0x03, 0x35, 0xff, 0xee,
-    0x03, 0x37, 0xff, 0xee, 0x03, 0x39, 0xff, 0xee, 0x04, 0x7d, 0xff, 0xee, 0x04, 0x7f, 0xff, 0xee,
-    0x04, 0xdc, 0xff, 0xee, 0x00, 0x03, 0x00, 0x5b, 0xff, 0xe5, 0x01, 0xff, 0xff, 0xeb, 0x02, 0x4b,
-    0xff, 0xed, 0x00, 0x0f, 0x00, 0x0a, 0xff, 0xe2, 0x00, 0x0d, 0x00, 0x14, 0x00, 0x0e, 0xff, 0xcf,
-    0x00, 0x41, 0x00, 0x12, 0x00, 0x4a, 0xff, 0xea, 0x00, 0x56, 0xff, 0xd8, 0x00, 0x58, 0xff, 0xea,
-    0x00, 0x61, 0x00, 0x13, 0x00, 0x6d, 0xff, 0xae, 0x00, 0x7c, 0xff, 0xcd, 0x00, 0x81, 0xff, 0xa0,
-    0x00, 0x86, 0xff, 0xc1, 0x00, 0x89, 0xff, 0xc0, 0x01, 0x8d, 0xff, 0xd3, 0x02, 0x4b, 0xff, 0xcd,
-    0x00, 0x02, 0x01, 0xf5, 0xff, 0xe9, 0x02, 0x4b, 0xff, 0xe9, 0x00, 0x05, 0x00, 0x0d, 0x00, 0x0f,
-    0x00, 0x41, 0x00, 0x0c, 0x00, 0x56, 0xff, 0xeb, 0x00, 0x61, 0x00, 0x0e, 0x02, 0x4b, 0xff, 0xe9,
-    0x00, 0x04, 0x00, 0x0d, 0x00, 0x14, 0x00, 0x41, 0x00, 0x11, 0x00, 0x56, 0xff, 0xe2, 0x00, 0x61,
-    0x00, 0x13, 0x00, 0x08, 0x00, 0x04, 0xff, 0xd1, 0x00, 0x56, 0xff, 0xb9, 0x00, 0x5b, 0xff, 0xcb,
-    0x00, 0x6d, 0xfe, 0xfa, 0x00, 0x7c, 0xff, 0x42, 0x00, 0x81, 0xff, 0x49, 0x00, 0x86, 0xff, 0x99,
-    0x00, 0x89, 0xff, 0xa1, 0x00, 0x10, 0x00, 0x38, 0xff, 0xbb, 0x00, 0x3a, 0xff, 0xed, 0x00, 0x3d,
-    0xff, 0xd0, 0x02, 0xb4, 0xff, 0xd0, 0x03, 0x29, 0xff, 0xbb, 0x03, 0x2b, 0xff, 0xbb, 0x03, 0x2d,
-    0xff, 0xbb, 0x03, 0x3d, 0xff, 0xd0, 0x03, 0x3f, 0xff, 0xd0, 0x03, 0xf4, 0xff, 0xd0, 0x04, 0x8b,
-    0xff, 0xd0, 0x04, 0x8d, 0xff, 0xd0, 0x04, 0x8f, 0xff, 0xd0, 0x04, 0xda, 0xff, 0xbb, 0x04, 0xdd,
-    0xff, 0xed, 0x04, 0xdf, 0xff, 0xed, 0x00, 0x22, 0x00, 0x38, 0xff, 0xd9, 0x00, 0x3a, 0xff, 0xe4,
-    0x00, 0x3b, 0xff, 0xec, 0x00, 0x3d, 0xff, 0xdd, 0x02, 0x05, 0x00, 0x0e, 0x02, 0x4d, 0x00, 0x0e,
-    0x02, 0xb4, 0xff, 0xdd, 0x03, 0x29, 0xff, 0xd9, 0x03, 0x2b, 0xff, 0xd9, 0x03, 0x2d, 0xff, 0xd9,
-    0x03, 0x3b, 0xff, 0xec, 0x03, 0x3d, 0xff, 0xdd, 0x03, 0x3f, 0xff, 0xdd, 0x03, 0x4d, 0x00, 0x0e,
-    0x03, 0x4e, 0x00, 0x0e, 0x03, 0x4f, 0x00, 0x0e, 0x03, 0x50, 0x00, 0x0e, 0x03, 0x51, 0x00, 0x0e,
-    0x03, 0x52, 0x00, 0x0e, 0x03, 0x53, 0x00, 0x0e, 0x03, 0x68, 0x00, 0x0e, 0x03, 0x69, 0x00, 0x0e,
-    0x03, 0x6a, 0x00, 0x0e, 0x03, 0xee, 0xff, 0xec, 0x03, 0xf0, 0xff, 0xec, 0x03, 0xf2, 0xff, 0xec,
-    0x03, 0xf4, 0xff, 0xdd, 0x04, 0x8b, 0xff, 0xdd, 0x04, 0x8d, 0xff, 0xdd, 0x04, 0x8f, 0xff, 0xdd,
-    0x04, 0xda, 0xff, 0xd9, 0x04, 0xdd, 0xff, 0xe4, 0x04, 0xdf, 0xff, 0xe4, 0x04, 0xe1, 0xff, 0xec,
-    0x00, 0x02, 0x00, 0x58, 0x00, 0x0e, 0x00, 0x81, 0xff, 0x56, 0x00, 0x05, 0x00, 0x5b, 0xff, 0xb3,
-    0x01, 0xf0, 0xff, 0x79, 0x01, 0xf5, 0xff, 0xf1, 0x01, 0xff, 0xff, 0xf1, 0x02, 0x4b, 0xff, 0xf3,
-    0x00, 0x03, 0x00, 0x5b, 0xff, 0xc1, 0x01, 0xff, 0xff, 0xe6, 0x02, 0x4b, 0xff, 0xe8, 0x00, 0xa7,
-    0x00, 0x10, 0xff, 0x07, 0x00, 0x12, 0xff, 0x07, 0x00, 0x25, 0xff, 0x4e, 0x00, 0x2e, 0xff, 0x0d,
-    0x00, 0x38, 0x00, 0x14, 0x00, 0x45, 0xff, 0xde, 0x00, 0x47, 0xff, 0xeb, 0x00, 0x48, 0xff, 0xeb,
-    0x00, 0x49, 0xff, 0xeb, 0x00, 0x4b, 0xff, 0xeb, 0x00, 0x53, 0xff, 0xeb, 0x00, 0x55, 0xff, 0xeb,
-    0x00, 0x56, 0xff, 0xe6, 0x00, 0x59, 0xff, 0xea, 0x00, 0x5a, 0xff, 0xe8, 0x00, 0x5d, 0xff, 0xe8,
-    0x00, 0x94, 0xff, 0xeb, 0x00, 0x99, 0xff, 0xeb, 0x00, 0x9b, 0xff, 0xea, 0x00, 0xb2, 0xff, 0x4e,
-    0x01, 0x86, 0xff, 0x07, 0x01, 0x8a, 0xff, 0x07, 0x01, 0x8e, 0xff, 0x07, 0x01, 0x8f, 0xff, 0x07,
-    0x02, 0x05, 0xff, 0xc0, 0x02, 0x4d, 0xff, 0xc0, 0x02, 0x9a, 0xff, 0x4e, 0x02, 0x9b, 0xff, 0x4e,
-    0x02, 0x9c, 0xff, 0x4e, 0x02, 0x9d, 0xff, 0x4e, 0x02, 0x9e, 0xff, 0x4e, 0x02, 0x9f, 0xff, 0x4e,
-    0x02, 0xa0, 0xff, 0x4e, 0x02, 0xb5, 0xff, 0xde, 0x02, 0xb6, 0xff, 0xde, 0x02, 0xb7, 0xff, 0xde,
-    0x02, 0xb8, 0xff, 0xde, 0x02, 0xb9, 0xff, 0xde, 0x02, 0xba, 0xff, 0xde, 0x02, 0xbb, 0xff, 0xde,
-    0x02, 0xbc, 0xff, 0xeb, 0x02, 0xbd, 0xff, 0xeb, 0x02, 0xbe, 0xff, 0xeb, 0x02, 0xbf, 0xff, 0xeb,
-    0x02, 0xc0, 0xff, 0xeb, 0x02, 0xc6, 0xff, 0xeb, 0x02, 0xc7, 0xff, 0xeb, 0x02, 0xc8, 0xff, 0xeb,
-    0x02, 0xc9, 0xff, 0xeb, 0x02, 0xca, 0xff, 0xeb, 0x02, 0xcb, 0xff, 0xea, 0x02, 0xcc, 0xff, 0xea,
-    0x02, 0xcd, 0xff, 0xea, 0x02, 0xce, 0xff, 0xea, 0x02, 0xcf, 0xff, 0xe8, 0x02, 0xd0, 0xff, 0xe8,
-    0x02, 0xd1, 0xff, 0x4e, 0x02, 0xd2, 0xff, 0xde, 0x02, 0xd3, 0xff, 0x4e, 0x02, 0xd4, 0xff, 0xde,
-    0x02, 0xd5, 0xff, 0x4e, 0x02, 0xd6, 0xff, 0xde, 0x02, 0xd8, 0xff, 0xeb, 0x02, 0xda, 0xff, 0xeb,
-    0x02, 0xdc, 0xff, 0xeb, 0x02, 0xde, 0xff, 0xeb, 0x02, 0xe0, 0xff, 0xeb, 0x02, 0xe2, 0xff, 0xeb,
-    0x02, 0xe4, 0xff, 0xeb, 0x02, 0xe6, 0xff, 0xeb, 0x02, 0xe8, 0xff, 0xeb, 0x02, 0xea, 0xff, 0xeb,
-    0x02, 0xec, 0xff, 0xeb, 0x02, 0xee, 0xff, 0xeb, 0x02, 0xf0, 0xff, 0xeb, 0x02, 0xf2, 0xff, 0xeb,
-    0x03, 0x00, 0xff, 0x0d, 0x03, 0x14, 0xff, 0xeb, 0x03, 0x16, 0xff, 0xeb, 0x03, 0x18, 0xff, 0xeb,
-    0x03, 0x29, 0x00, 0x14, 0x03, 0x2b, 0x00, 0x14, 0x03, 0x2d, 0x00, 0x14, 0x03, 0x30, 0xff, 0xea,
-    0x03, 0x32, 0xff, 0xea, 0x03, 0x34, 0xff, 0xea, 0x03, 0x36, 0xff, 0xea, 0x03, 0x38, 0xff, 0xea,
-    0x03, 0x3a, 0xff, 0xea, 0x03, 0x3e, 0xff, 0xe8, 0x03, 0x4d, 0xff, 0xc0, 0x03, 0x4e, 0xff, 0xc0,
-    0x03, 0x4f, 0xff, 0xc0, 0x03, 0x50, 0xff, 0xc0, 0x03, 0x51, 0xff, 0xc0, 0x03, 0x52, 0xff, 0xc0,
-    0x03, 0x53, 0xff, 0xc0, 0x03, 0x68, 0xff, 0xc0, 0x03, 0x69, 0xff, 0xc0, 0x03, 0x6a, 0xff, 0xc0,
-    0x03, 0xf5, 0xff, 0xe8, 0x03, 0xfd, 0xff, 0x4e, 0x03, 0xfe, 0xff, 0xde, 0x04, 0x39, 0xff, 0x4e,
-    0x04, 0x3a, 0xff, 0xde, 0x04, 0x3b, 0xff, 0x4e, 0x04, 0x3c, 0xff, 0xde, 0x04, 0x3d, 0xff, 0x4e,
-    0x04, 0x3e, 0xff, 0xde, 0x04, 0x3f, 0xff, 0x4e, 0x04, 0x40, 0xff, 0xde, 0x04, 0x41, 0xff, 0x4e,
-    0x04, 0x42, 0xff, 0xde, 0x04, 0x43, 0xff, 0x4e, 0x04, 0x44, 0xff, 0xde, 0x04, 0x45, 0xff, 0x4e,
-    0x04, 0x46, 0xff, 0xde, 0x04, 0x47, 0xff, 0x4e, 0x04, 0x48, 0xff, 0xde, 0x04, 0x49, 0xff, 0x4e,
-    0x04, 0x4a, 0xff, 0xde, 0x04, 0x4b, 0xff, 0x4e, 0x04, 0x4c, 0xff, 0xde, 0x04, 0x4d, 0xff, 0x4e,
-    0x04, 0x4e, 0xff, 0xde, 0x04, 0x4f, 0xff, 0x4e, 0x04, 0x50, 0xff, 0xde, 0x04, 0x52, 0xff, 0xeb,
-    0x04, 0x54, 0xff, 0xeb, 0x04, 0x56, 0xff, 0xeb, 0x04, 0x58, 0xff, 0xeb, 0x04, 0x5a, 0xff, 0xeb,
-    0x04, 0x5c, 0xff, 0xeb, 0x04, 0x5e, 0xff, 0xeb, 0x04, 0x60, 0xff, 0xeb, 0x04, 0x66, 0xff, 0xeb,
-    0x04, 0x68, 0xff, 0xeb, 0x04, 0x6a, 0xff, 0xeb, 0x04, 0x6c, 0xff, 0xeb, 0x04, 0x6e, 0xff, 0xeb,
-    0x04, 0x70, 0xff, 0xeb, 0x04, 0x72, 0xff, 0xeb, 0x04, 0x74, 0xff, 0xeb, 0x04, 0x76, 0xff, 0xeb,
-    0x04, 0x78, 0xff, 0xeb, 0x04, 0x7a, 0xff, 0xeb, 0x04, 0x7c, 0xff, 0xeb, 0x04, 0x7e, 0xff, 0xea,
-    0x04, 0x80, 0xff, 0xea, 0x04, 0x82, 0xff, 0xea, 0x04, 0x84, 0xff, 0xea, 0x04, 0x86, 0xff, 0xea,
-    0x04, 0x88, 0xff, 0xea, 0x04, 0x8a, 0xff, 0xea, 0x04, 0x8c, 0xff, 0xe8, 0x04, 0x8e, 0xff, 0xe8,
-    0x04, 0x90, 0xff, 0xe8, 0x04, 0xb4, 0xff, 0x4e, 0x04, 0xb5, 0xff, 0xde, 0x04, 0xb7, 0xff, 0xeb,
-    0x04, 0xbb, 0xff, 0xeb, 0x04, 0xbf, 0xff, 0xea, 0x04, 0xc4, 0xff, 0xeb, 0x04, 0xc6, 0xff, 0xeb,
-    0x04, 0xda, 0x00, 0x14, 0x04, 0xde, 0xff, 0xe8, 0x04, 0xe0, 0xff, 0xe8, 0x00, 0x03, 0x00, 0x4a,
-    0xff, 0xee, 0x00, 0x5b, 0xff, 0xea, 0x01, 0xf0, 0xff, 0xf0, 0x00, 0x01, 0x00, 0x81, 0xff, 0xdf,
-    0x00, 0x03, 0x00, 0x0d, 0xff, 0xe6, 0x00, 0x41, 0xff, 0xf4, 0x00, 0x61, 0xff, 0xef, 0x00, 0x05,
-    0x00, 0x23, 0xff, 0xbc, 0x00, 0x58, 0xff, 0xef, 0x00, 0x5b, 0xff, 0xdf, 0x00, 0x9a, 0xff, 0xee,
-    0x01, 0xf0, 0xff, 0xcd, 0x00, 0x11, 0x00, 0x3a, 0x00, 0x14, 0x00, 0x3b, 0x00, 0x19, 0x00, 0x3d,
-    0x00, 0x16, 0x02, 0xb4, 0x00, 0x16, 0x03, 0x3b, 0x00, 0x19, 0x03, 0x3d, 0x00, 0x16, 0x03, 0x3f,
-    0x00, 0x16, 0x03, 0xee, 0x00, 0x19, 0x03, 0xf0, 0x00, 0x19, 0x03, 0xf2, 0x00, 0x19, 0x03, 0xf4,
-    0x00, 0x16, 0x04, 0x8b, 0x00, 0x16, 0x04, 0x8d, 0x00, 0x16, 0x04, 0x8f, 0x00, 0x16, 0x04, 0xdd,
-    0x00, 0x14, 0x04, 0xdf, 0x00, 0x14, 0x04, 0xe1, 0x00, 0x19, 0x00, 0x01, 0x00, 0x5b, 0x00, 0x0b,
-    0x00, 0x05, 0x00, 0x38, 0xff, 0xd1, 0x03, 0x29, 0xff, 0xd1, 0x03, 0x2b, 0xff, 0xd1, 0x03, 0x2d,
-    0xff, 0xd1, 0x04, 0xda, 0xff, 0xd1, 0x00, 0x02, 0x00, 0x08, 0x00, 0x02, 0x06, 0x6c, 0x00, 0x0a,
-    0x00, 0x02, 0x03, 0xd0, 0x00, 0x04, 0x00, 0x00, 0x05, 0x6e, 0x04, 0x3e, 0x00, 0x18, 0x00, 0x14,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xc5, 0x00, 0x00, 0xff, 0x88, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xec, 0x00, 0x00, 0x00, 0x00, 0xff, 0xb8, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0xff, 0xe4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12,
-    0x00, 0x00, 0x00, 0x00, 0xff, 0x93, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xeb, 0x00, 0x00,
-    0xff, 0xd5, 0xff, 0xed, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xea,
-    0xff, 0xe9, 0xff, 0xed, 0xff, 0xf5, 0xff, 0xeb, 0x00, 0x00, 0xff, 0x88, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xff, 0xf5, 0x00, 0x00, 0xff, 0xf1, 0xff, 0x8d, 0x00, 0x00, 0xff, 0xc4, 0xff, 0xee,
-    0xff, 0xce, 0xff, 0xf5, 0xff, 0xf4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xff, 0x26, 0xff, 0xa7, 0xff, 0xbf, 0xff, 0xd9, 0xff, 0x8d, 0xff, 0xe3,
-    0x00, 0x12, 0xff, 0xab, 0x00, 0x00, 0xff, 0xd8, 0xff, 0xec, 0xff, 0xcb, 0xff, 0xbf, 0x00, 0x0d,
-    0x00, 0x00, 0xff, 0xab, 0xff, 0xef, 0xff, 0x8d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xbf, 0x00, 0x00,
-    0x00, 0x00, 0xff, 0xf2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xed, 0xff, 0xef, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xff, 0xf0, 0x00, 0x00, 0xff, 0xe6, 0x00, 0x00, 0xff, 0xed, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xa1, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0f, 0xff, 0x7f, 0x00, 0x00, 0xff, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf1, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xea, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xec, 0x00, 0x00,
-    0x00, 0x00, 0xff, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xc9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xaa, 0xff, 0xe6, 0xff, 0xeb, 0x00, 0x00, 0xff, 0xe7,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe1, 0xff, 0xe7, 0xff, 0xeb, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x61, 0xfe, 0x49,
-    0xff, 0x4a, 0xff, 0x5e, 0xff, 0x3a, 0xff, 0xbd, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0xff, 0x3f,
-    0xff, 0x6c, 0x00, 0x00, 0xff, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x3a,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x9b, 0xff, 0xe6, 0xff, 0xe9, 0x00, 0x00, 0xff, 0xe1,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf1, 0xff, 0xd8, 0xff, 0xe7, 0xff, 0xe5, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x9f, 0x00, 0x00,
-    0xff, 0xf3, 0x00, 0x00, 0xff, 0x67, 0x00, 0x00, 0x00, 0x00, 0xff, 0xac, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0f, 0x00, 0x00, 0xff, 0xf3, 0xff, 0xda, 0xff, 0xe2, 0xff, 0xac, 0x00, 0x00, 0xff, 0x67,
-    0x00, 0x00, 0x00, 0x00, 0xff, 0x17, 0xff, 0x09, 0xff, 0xa1, 0xff, 0xac, 0xff, 0xa2, 0xff, 0xe4,
-    0x00, 0x10, 0xff, 0xaf, 0x00, 0x00, 0xff, 0x9a, 0xff, 0xb4, 0xff, 0xb9, 0xff, 0x75, 0x00, 0x00,
-    0x00, 0x00, 0xff, 0xaf, 0xff, 0xed, 0xff, 0xa2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xff, 0xeb, 0xff, 0xed, 0x00, 0x0d, 0xff, 0xe6, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x00,
-    0xff, 0xe5, 0xff, 0xec, 0xff, 0xeb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x0d,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xff, 0xbf, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf2, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xff, 0xeb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe3, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xff, 0xf5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xff, 0xf5, 0x00, 0x00, 0xff, 0xf1, 0xff, 0x8d, 0x00, 0x00, 0xff, 0xc4, 0xff, 0xee,
-    0xff, 0xce, 0xff, 0xf5, 0xff, 0xf4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x35, 0x00, 0x06, 0x00, 0x0b, 0x00, 0x96, 0x00, 0xb1, 0x00, 0xb2, 0x00, 0xb3,
-    0x00, 0xb4, 0x00, 0xbd, 0x00, 0xc1, 0x00, 0xc7, 0x01, 0x84, 0x01, 0x85, 0x01, 0x87, 0x01, 0x88,
-    0x01, 0x89, 0x02, 0x05, 0x02, 0x06, 0x02, 0x07, 0x03, 0xa1, 0x03, 0xa2, 0x03, 0xa3, 0x03, 0xa4,
-    0x03, 0xa5, 0x03, 0xa6, 0x03, 0xa9, 0x03, 0xaa, 0x03, 0xab, 0x03, 0xac, 0x03, 0xad, 0x03, 0xae,
-    0x03, 0xaf, 0x03, 0xb0, 0x03, 0xb1, 0x03, 0xb2, 0x03, 0xb3, 0x03, 0xb4, 0x03, 0xb5, 0x03, 0xb6,
-    0x03, 0xb7, 0x03, 0xb8, 0x03, 0xbb, 0x03, 0xbf, 0x03, 0xc1, 0x03, 0xc5, 0x03, 0xf6, 0x03, 0xf7,
-    0x03, 0xfa, 0x04, 0xe5, 0x04, 0xe6, 0x04, 0xea, 0x04, 0xed, 0x04, 0xf3, 0x04, 0xf8, 0x00, 0x02,
-    0x00, 0x32, 0x00, 0x06, 0x00, 0x06, 0x00, 0x01, 0x00, 0x0b, 0x00, 0x0b, 0x00, 0x01, 0x00, 0x10,
-    0x00, 0x10, 0x00, 0x02, 0x00, 0x11, 0x00, 0x11, 0x00, 0x03, 0x00, 0x12, 0x00, 0x12, 0x00, 0x02,
-    0x00, 0xb2, 0x00, 0xb2, 0x00, 0x13, 0x00, 0xb3, 0x00, 0xb3, 0x00, 0x07, 0x00, 0xb4, 0x00, 0xb4,
-    0x00, 0x06, 0x00, 0xbb, 0x00, 0xbb, 0x00, 0x04, 0x00, 0xbd, 0x00, 0xbd, 0x00, 0x0c, 0x00, 0xc1,
-    0x00, 0xc1, 0x00, 0x0b, 0x00, 0xc8, 0x00, 0xc9, 0x00, 0x04, 0x00, 0xcb, 0x00, 0xcb, 0x00, 0x05,
-    0x01, 0x81, 0x01, 0x82, 0x00, 0x03, 0x01, 0x84, 0x01, 0x85, 0x00, 0x01, 0x01, 0x86, 0x01, 0x86,
-    0x00, 0x02, 0x01, 0x87, 0x01, 0x89, 0x00, 0x01, 0x01, 0x8a, 0x01, 0x8a, 0x00, 0x02, 0x01, 0x8e,
-    0x01, 0x8f, 0x00, 0x02, 0x02, 0x05, 0x02, 0x05, 0x00, 0x11, 0x02, 0x06, 0x02, 0x06, 0x00, 0x0d,
-    0x02, 0x07, 0x02, 0x07, 0x00, 0x09, 0x02, 0x94, 0x02, 0x94, 0x00, 0x03, 0x03, 0xa1, 0x03, 0xa1,
-    0x00, 0x06, 0x03, 0xa5, 0x03, 0xa5, 0x00, 0x07, 0x03, 0xa6, 0x03, 0xa6, 0x00, 0x08, 0x03, 0xa9,
-    0x03, 0xa9, 0x00, 0x06, 0x03, 0xac, 0x03, 0xac, 0x00, 0x10, 0x03, 0xb2, 0x03, 0xb2, 0x00, 0x07,
-    0x03, 0xb5, 0x03, 0xb5, 0x00, 0x08, 0x03, 0xb6, 0x03, 0xb6, 0x00, 0x0f, 0x03, 0xb8, 0x03, 0xb8,
-    0x00, 0x08, 0x03, 0xb9, 0x03, 0xb9, 0x00, 0x04, 0x03, 0xbb, 0x03, 0xbb, 0x00, 0x0b, 0x03, 0xbd,
-    0x03, 0xbd, 0x00, 0x05, 0x03, 0xbf, 0x03, 0xbf, 0x00, 0x0e, 0x03, 0xc1, 0x03, 0xc1, 0x00, 0x0c,
-    0x03, 0xc4, 0x03, 0xc4, 0x00, 0x05, 0x03, 0xc5, 0x03, 0xc5, 0x00, 0x0e, 0x03, 0xc6, 0x03, 0xc6,
-    0x00, 0x05, 0x03, 0xf6, 0x03, 0xf7, 0x00, 0x01, 0x03, 0xfa, 0x03, 0xfa, 0x00, 0x01, 0x04, 0xa7,
-    0x04, 0xa7, 0x00, 0x03, 0x04, 0xe6, 0x04, 0xe6, 0x00, 0x09, 0x04, 0xea, 0x04, 0xea, 0x00, 0x0d,
-    0x04, 0xeb, 0x04, 0xeb, 0x00, 0x0a, 0x04, 0xed, 0x04, 0xed, 0x00, 0x09, 0x04, 0xf9, 0x04, 0xf9,
-    0x00, 0x0a, 0x04, 0xfa, 0x04, 0xfa, 0x00, 0x12, 0x04, 0xfc, 0x04, 0xfc, 0x00, 0x0a, 0x00, 0x02,
-    0x00, 0x28, 0x00, 0x96, 0x00, 0x96, 0x00, 0x16, 0x00, 0xb1, 0x00, 0xb1, 0x00, 0x0d, 0x00, 0xb2,
-    0x00, 0xb2, 0x00, 0x17, 0x00, 0xb3, 0x00, 0xb3, 0x00, 0x02, 0x00, 0xb4, 0x00, 0xb4, 0x00, 0x03,
-    0x00, 0xbd, 0x00, 0xbd, 0x00, 0x08, 0x00, 0xc1, 0x00, 0xc1, 0x00, 0x07, 0x00, 0xc7, 0x00, 0xc7,
-    0x00, 0x15, 0x02, 0x05, 0x02, 0x05, 0x00, 0x12, 0x02, 0x06, 0x02, 0x06, 0x00, 0x09, 0x02, 0x07,
-    0x02, 0x07, 0x00, 0x05, 0x03, 0xa1, 0x03, 0xa1, 0x00, 0x03, 0x03, 0xa2, 0x03, 0xa2, 0x00, 0x06,
-    0x03, 0xa3, 0x03, 0xa4, 0x00, 0x01, 0x03, 0xa5, 0x03, 0xa5, 0x00, 0x02, 0x03, 0xa6, 0x03, 0xa6,
-    0x00, 0x04, 0x03, 0xa9, 0x03, 0xa9, 0x00, 0x03, 0x03, 0xaa, 0x03, 0xaa, 0x00, 0x0b, 0x03, 0xab,
-    0x03, 0xab, 0x00, 0x06, 0x03, 0xac, 0x03, 0xac, 0x00, 0x11, 0x03, 0xad, 0x03, 0xae, 0x00, 0x01,
-    0x03, 0xaf, 0x03, 0xaf, 0x00, 0x0e, 0x03, 0xb0, 0x03, 0xb1, 0x00, 0x01, 0x03, 0xb2, 0x03, 0xb2,
-    0x00, 0x02, 0x03, 0xb3, 0x03, 0xb3, 0x00, 0x0f, 0x03, 0xb4, 0x03, 0xb4, 0x00, 0x10, 0x03, 0xb5,
-    0x03, 0xb5, 0x00, 0x04, 0x03, 0xb6, 0x03, 0xb6, 0x00, 0x0c, 0x03, 0xb7, 0x03, 0xb7, 0x00, 0x01,
-    0x03, 0xb8, 0x03, 0xb8, 0x00, 0x04, 0x03, 0xbb, 0x03, 0xbb, 0x00, 0x07, 0x03, 0xbf, 0x03, 0xbf,
-    0x00, 0x0a, 0x03, 0xc1, 0x03, 0xc1, 0x00, 0x08, 0x03, 0xc5, 0x03, 0xc5, 0x00, 0x0a, 0x04, 0xe5,
-    0x04, 0xe5, 0x00, 0x02, 0x04, 0xe6, 0x04, 0xe6, 0x00, 0x05, 0x04, 0xea, 0x04, 0xea, 0x00, 0x09,
-    0x04, 0xed, 0x04, 0xed, 0x00, 0x05, 0x04, 0xf3, 0x04, 0xf3, 0x00, 0x13, 0x04, 0xf8, 0x04, 0xf8,
-    0x00, 0x14, 0x00, 0x01, 0x00, 0x5c, 0x00, 0x04, 0x00, 0x00, 0x00, 0x29, 0x04, 0xa6, 0x04, 0x98,
-    0x04, 0x8e, 0x04, 0x5c, 0x04, 0x46, 0x04, 0x38, 0x04, 0x22, 0x04, 0x10, 0x03, 0xfa, 0x03, 0xd4,
-    0x03, 0xa6, 0x03, 0xa0, 0x03, 0x8e, 0x03, 0x88, 0x03, 0x26, 0x03, 0x20, 0x02, 0xba, 0x02, 0x68,
-    0x02, 0x3a, 0x02, 0x34, 0x02, 0x2e, 0x01, 0xb0, 0x01, 0xa6, 0x01, 0x8c, 0x04, 0x22, 0x04, 0x38,
-    0x01, 0x36, 0x04, 0x22, 0x01, 0x2c, 0x01, 0x22, 0x04, 0x38, 0x01, 0x14, 0x00, 0xde, 0x01, 0x36,
-    0x00, 0xbc, 0x01, 0x36, 0x03, 0x20, 0x00, 0xb2, 0x03, 0x8e, 0x00, 0xb2, 0x04, 0x38, 0x00, 0x01,
-    0x00, 0x29, 0x00, 0x0c, 0x00, 0x96, 0x00, 0x9d, 0x00, 0xb1, 0x00, 0xb2, 0x00, 0xb3, 0x00, 0xb4,
-    0x00, 0xb5, 0x00, 0xb7, 0x00, 0xb8, 0x00, 0xb9, 0x00, 0xbb, 0x00, 0xbd, 0x00, 0xbe, 0x00, 0xc0,
-    0x00, 0xc1, 0x00, 0xc3, 0x00, 0xc4, 0x00, 0xc5, 0x00, 0xc7, 0x00, 0xc9, 0x00, 0xca, 0x00, 0xce,
-    0x01, 0x85, 0x03, 0xa1, 0x03, 0xa5, 0x03, 0xa6, 0x03, 0xa9, 0x03, 0xac, 0x03, 0xaf, 0x03, 0xb2,
-    0x03, 0xb3, 0x03, 0xb4, 0x03, 0xb5, 0x03, 0xb6, 0x03, 0xb8, 0x03, 0xbb, 0x03, 0xbf, 0x03, 0xc1,
-    0x03, 0xc5, 0x04, 0xe5, 0x00, 0x02, 0x00, 0xca, 0xff, 0xea, 0x01, 0x85, 0xff, 0xa4, 0x00, 0x08,
-    0x00, 0xb8, 0xff, 0xd4, 0x00, 0xbe, 0xff, 0xf6, 0x00, 0xc2, 0xff, 0xed, 0x00, 0xc4, 0x00, 0x11,
-    0x00, 0xca, 0xff, 0xe0, 0x00, 0xcc, 0xff, 0xe7, 0x00, 0xcd, 0xff, 0xe5, 0x00, 0xce, 0xff, 0xee,
-    0x00, 0x0d, 0x00, 0x04, 0xff, 0xd1, 0x00, 0x6d, 0xfe, 0xfa, 0x00, 0x7c, 0xff, 0x42, 0x00, 0xb8,
-    0xff, 0xb2, 0x00, 0xbe, 0xff, 0xdd, 0x00, 0xbf, 0xff, 0x7e, 0x00, 0xc3, 0xff, 0x6e, 0x00, 0xc6,
-    0xff, 0x8e, 0x00, 0xc7, 0xff, 0x6c, 0x00, 0xca, 0xff, 0xa5, 0x00, 0xcc, 0xff, 0x71, 0x00, 0xcd,
-    0xff, 0x77, 0x00, 0xce, 0xff, 0x69, 0x00, 0x03, 0x00, 0xbe, 0xff, 0xf9, 0x00, 0xc4, 0xff, 0xc4,
-    0x00, 0xc7, 0xff, 0xda, 0x00, 0x02, 0x00, 0xb8, 0xff, 0xc5, 0x00, 0xca, 0xff, 0xb4, 0x00, 0x02,
-    0x00, 0xb8, 0xff, 0xcb, 0x00, 0xcd, 0xff, 0xe4, 0x00, 0x15, 0x00, 0x0a, 0xff, 0xe2, 0x00, 0x0d,
-    0x00, 0x14, 0x00, 0x0e, 0xff, 0xcf, 0x00, 0x41, 0x00, 0x12, 0x00, 0x61, 0x00, 0x13, 0x00, 0x6d,
-    0xff, 0xae, 0x00, 0x7c, 0xff, 0xcd, 0x00, 0xb8, 0xff, 0xd0, 0x00, 0xbc, 0xff, 0xea, 0x00, 0xbe,
-    0xff, 0xf5, 0x00, 0xbf, 0xff, 0xc6, 0x00, 0xc0, 0x00, 0x0d, 0x00, 0xc2, 0xff, 0xe9, 0x00, 0xc3,
-    0xff, 0xd6, 0x00, 0xc6, 0xff, 0xe8, 0x00, 0xc7, 0xff, 0xba, 0x00, 0xca, 0xff, 0xe9, 0x00, 0xcc,
-    0xff, 0xcb, 0x00, 0xcd, 0xff, 0xda, 0x00, 0xce, 0xff, 0xc7, 0x01, 0x8d, 0xff, 0xd3, 0x00, 0x06,
-    0x00, 0xbb, 0xff, 0xb4, 0x00, 0xc8, 0xff, 0xb4, 0x00, 0xc9, 0xff, 0xb4, 0x03, 0xb9, 0xff, 0xb4,
-    0x03, 0xbf, 0xff, 0x7a, 0x03, 0xc5, 0xff, 0x7a, 0x00, 0x02, 0x00, 0xbd, 0xff, 0xf4, 0x03, 0xc1,
-    0xff, 0xf4, 0x00, 0x1f, 0x00, 0x06, 0x00, 0x0c, 0x00, 0x0b, 0x00, 0x0c, 0x00, 0xbb, 0xff, 0xe8,
-    0x00, 0xbd, 0x00, 0x0b, 0x00, 0xbe, 0xff, 0xf4, 0x00, 0xc4, 0xff, 0xd7, 0x00, 0xc6, 0x00, 0x0b,
-    0x00, 0xc8, 0xff, 0xe8, 0x00, 0xc9, 0xff, 0xe8, 0x00, 0xca, 0x00, 0x0c, 0x01, 0x84, 0x00, 0x0c,
-    0x01, 0x85, 0x00, 0x0c, 0x01, 0x87, 0x00, 0x0c, 0x01, 0x88, 0x00, 0x0c, 0x01, 0x89, 0x00, 0x0c,
-    0x02, 0x05, 0xff, 0xbf, 0x02, 0x06, 0xff, 0xed, 0x02, 0x07, 0xff, 0xbf, 0x03, 0xb9, 0xff, 0xe8,
-    0x03, 0xbf, 0xff, 0xea, 0x03, 0xc1, 0x00, 0x0b, 0x03, 0xc5, 0xff, 0xea, 0x03, 0xf6, 0x00, 0x0c,
-    0x03, 0xf7, 0x00, 0x0c, 0x03, 0xfa, 0x00, 0x0c, 0x04, 0xe6, 0xff, 0xbf, 0x04, 0xea, 0xff, 0xed,
-    0x04, 0xeb, 0x00, 0x0d, 0x04, 0xed, 0xff, 0xbf, 0x04, 0xf9, 0x00, 0x0d, 0x04, 0xfc, 0x00, 0x0d,
-    0x00, 0x01, 0x00, 0xca, 0x00, 0x13, 0x00, 0x01, 0x00, 0xca, 0xff, 0xea, 0x00, 0x0b, 0x00, 0x10,
-    0x00, 0x04, 0x00, 0x12, 0x00, 0x04, 0x00, 0xbb, 0xff, 0xe7, 0x00, 0xc4, 0x00, 0x0f, 0x00, 0xc8,
-    0xff, 0xe7, 0x00, 0xc9, 0xff, 0xe7, 0x01, 0x86, 0x00, 0x04, 0x01, 0x8a, 0x00, 0x04, 0x01, 0x8e,
-    0x00, 0x04, 0x01, 0x8f, 0x00, 0x04, 0x03, 0xb9, 0xff, 0xe7, 0x00, 0x14, 0x00, 0x06, 0xff, 0xc3,
-    0x00, 0x0b, 0xff, 0xc3, 0x00, 0xbd, 0xff, 0xdb, 0x00, 0xc2, 0xff, 0xf5, 0x00, 0xc4, 0x00, 0x0a,
-    0x00, 0xc6, 0xff, 0xf3, 0x00, 0xca, 0xff, 0x72, 0x00, 0xcb, 0xff, 0xf7, 0x01, 0x84, 0xff, 0xc3,
-    0x01, 0x85, 0xff, 0xc3, 0x01, 0x87, 0xff, 0xc3, 0x01, 0x88, 0xff, 0xc3, 0x01, 0x89, 0xff, 0xc3,
-    0x03, 0xbd, 0xff, 0xf7, 0x03, 0xc1, 0xff, 0xdb, 0x03, 0xc4, 0xff, 0xf7, 0x03, 0xc6, 0xff, 0xf7,
-    0x03, 0xf6, 0xff, 0xc3, 0x03, 0xf7, 0xff, 0xc3, 0x03, 0xfa, 0xff, 0xc3, 0x00, 0x19, 0x00, 0x06,
-    0xff, 0xda, 0x00, 0x0b, 0xff, 0xda, 0x00, 0xbb, 0xff, 0xf0, 0x00, 0xbd, 0xff, 0xdc, 0x00, 0xc2,
-    0xff, 0xec, 0x00, 0xc4, 0x00, 0x0f, 0x00, 0xc6, 0xff, 0xea, 0x00, 0xc8, 0xff, 0xf0, 0x00, 0xc9,
-    0xff, 0xf0, 0x00, 0xca, 0xff, 0xc8, 0x00, 0xcb, 0xff, 0xef, 0x00, 0xcc, 0xff, 0xe7, 0x01, 0x84,
-    0xff, 0xda, 0x01, 0x85, 0xff, 0xda, 0x01, 0x87, 0xff, 0xda, 0x01, 0x88, 0xff, 0xda, 0x01, 0x89,
-    0xff, 0xda, 0x03, 0xb9, 0xff, 0xf0, 0x03, 0xbd, 0xff, 0xef, 0x03, 0xc1, 0xff, 0xdc, 0x03, 0xc4,
-    0xff, 0xef, 0x03, 0xc6, 0xff, 0xef, 0x03, 0xf6, 0xff, 0xda, 0x03, 0xf7, 0xff, 0xda, 0x03, 0xfa,
-    0xff, 0xda, 0x00, 0x01, 0x01, 0x85, 0xff, 0xa1, 0x00, 0x18, 0x00, 0xbb, 0xff, 0xdc, 0x00, 0xbd,
-    0xff, 0xe1, 0x00, 0xbe, 0xff, 0xf5, 0x00, 0xbf, 0xff, 0xe6, 0x00, 0xc1, 0xff, 0xe1, 0x00, 0xc2,
-    0xff, 0xeb, 0x00, 0xc3, 0xff, 0xe9, 0x00, 0xc5, 0xff, 0xf0, 0x00, 0xc6, 0xff, 0xe7, 0x00, 0xc8,
-    0xff, 0xdc, 0x00, 0xc9, 0xff, 0xdc, 0x00, 0xca, 0xff, 0xe3, 0x00, 0xcb, 0xff, 0xdd, 0x00, 0xcc,
-    0xff, 0xce, 0x00, 0xcd, 0xff, 0xd4, 0x00, 0xce, 0xff, 0xdb, 0x03, 0xb9, 0xff, 0xdc, 0x03, 0xbb,
-    0xff, 0xe1, 0x03, 0xbd, 0xff, 0xdd, 0x03, 0xbf, 0xff, 0xd6, 0x03, 0xc1, 0xff, 0xe1, 0x03, 0xc4,
-    0xff, 0xdd, 0x03, 0xc5, 0xff, 0xd6, 0x03, 0xc6, 0xff, 0xdd, 0x00, 0x01, 0x00, 0xca, 0xff, 0xf4,
-    0x00, 0x04, 0x00, 0xbe, 0xff, 0xf9, 0x00, 0xc6, 0x00, 0x0b, 0x00, 0xc7, 0xff, 0xea, 0x00, 0xca,
-    0x00, 0x0c, 0x00, 0x01, 0x00, 0xc4, 0x00, 0x0e, 0x00, 0x0b, 0x00, 0x10, 0xff, 0x2d, 0x00, 0x12,
-    0xff, 0x2d, 0x00, 0xb2, 0xff, 0xcd, 0x00, 0xb4, 0xff, 0xcd, 0x00, 0xc7, 0xff, 0xf2, 0x01, 0x86,
-    0xff, 0x2d, 0x01, 0x8a, 0xff, 0x2d, 0x01, 0x8e, 0xff, 0x2d, 0x01, 0x8f, 0xff, 0x2d, 0x03, 0xa1,
-    0xff, 0xcd, 0x03, 0xa9, 0xff, 0xcd, 0x00, 0x09, 0x00, 0xb2, 0xff, 0xe4, 0x00, 0xb4, 0xff, 0xe4,
-    0x00, 0xc4, 0xff, 0xe2, 0x03, 0xa1, 0xff, 0xe4, 0x03, 0xa6, 0xff, 0xd3, 0x03, 0xa9, 0xff, 0xe4,
-    0x03, 0xb5, 0xff, 0xd3, 0x03, 0xb6, 0xff, 0xd2, 0x03, 0xb8, 0xff, 0xd3, 0x00, 0x05, 0x00, 0xb3,
-    0xff, 0xe6, 0x00, 0xb8, 0xff, 0xc2, 0x00, 0xc4, 0x00, 0x10, 0x03, 0xa5, 0xff, 0xe6, 0x03, 0xb2,
-    0xff, 0xe6, 0x00, 0x04, 0x00, 0xb3, 0xff, 0xf3, 0x00, 0xc4, 0x00, 0x0d, 0x03, 0xa5, 0xff, 0xf3,
-    0x03, 0xb2, 0xff, 0xf3, 0x00, 0x05, 0x00, 0x23, 0xff, 0xbc, 0x00, 0xb8, 0xff, 0xe5, 0x00, 0xb9,
-    0xff, 0xd1, 0x00, 0xc4, 0x00, 0x11, 0x00, 0xca, 0xff, 0xc8, 0x00, 0x03, 0x00, 0xb5, 0xff, 0xf3,
-    0x00, 0xb7, 0xff, 0xf0, 0x00, 0xc4, 0xff, 0xea, 0x00, 0x05, 0x00, 0x23, 0x00, 0x00, 0x00, 0xb8,
-    0xff, 0xe5, 0x00, 0xb9, 0xff, 0xd1, 0x00, 0xc4, 0x00, 0x11, 0x00, 0xca, 0xff, 0xc8, 0x00, 0x0c,
-    0x00, 0x6d, 0xfe, 0x2f, 0x00, 0x7c, 0xfe, 0xa9, 0x00, 0xb8, 0xff, 0x67, 0x00, 0xbe, 0xff, 0xb9,
-    0x00, 0xbf, 0xff, 0x0f, 0x00, 0xc3, 0xfe, 0xf4, 0x00, 0xc6, 0xff, 0x2b, 0x00, 0xc7, 0xfe, 0xf1,
-    0x00, 0xca, 0xff, 0x52, 0x00, 0xcc, 0xfe, 0xf9, 0x00, 0xcd, 0xff, 0x03, 0x00, 0xce, 0xfe, 0xec,
-    0x00, 0x02, 0x00, 0xbd, 0x00, 0x00, 0x03, 0xc1, 0x00, 0x00, 0x00, 0x03, 0x00, 0xb5, 0x00, 0x00,
-    0x00, 0xb7, 0x00, 0x00, 0x00, 0xc4, 0x00, 0x00, 0x00, 0x03, 0x03, 0xa6, 0x00, 0x16, 0x03, 0xb5,
-    0x00, 0x16, 0x03, 0xb8, 0x00, 0x16, 0x00, 0x02, 0x00, 0x08, 0x00, 0x02, 0x0f, 0x6c, 0x00, 0x0a,
-    0x00, 0x02, 0x08, 0x08, 0x00, 0x04, 0x00, 0x00, 0x0c, 0xdc, 0x09, 0x18, 0x00, 0x22, 0x00, 0x1e,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xff, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x12, 0xff, 0xe4, 0x00, 0x11, 0x00, 0x00, 0xff, 0xe5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xff, 0xe4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xec,
-    0xff, 0xc5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x88, 0x00, 0x00,
-    0x00, 0x00, 0xff, 0xb8, 0x00, 0x00, 0xff, 0xce, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xac, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf3, 0x00, 0x00,
-    0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xd7, 0xff, 0xf1,
-    0x00, 0x00, 0xff, 0xf1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe6, 0xff, 0xe7, 0x00, 0x00, 0xff, 0xe1,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe7, 0x00, 0x00, 0xff, 0xaa, 0x00, 0x00, 0x00, 0x11,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0xff, 0xeb, 0xff, 0xd1, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xff, 0xec, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf1,
-    0xff, 0xe6, 0xff, 0xe1, 0x00, 0x00, 0xff, 0xd8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe7,
-    0x00, 0x00, 0xff, 0x9b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xff, 0xe5, 0xff, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xff, 0xf2, 0xff, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xeb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xff, 0x3f, 0xff, 0x4a, 0xff, 0xbd, 0x00, 0x00, 0xff, 0x6c, 0x00, 0x00, 0xff, 0x6a,
-    0xfe, 0x61, 0x00, 0x00, 0x00, 0x07, 0xfe, 0x49, 0x00, 0x00, 0xff, 0x92, 0x00, 0x00, 0x00, 0x00,
-    0xff, 0x3a, 0x00, 0x00, 0xff, 0x0f, 0xff, 0x50, 0xff, 0x0c, 0xff, 0x3f, 0x00, 0x00, 0x00, 0x07,
-    0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0xff, 0x3a, 0x00, 0x00, 0xff, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xff, 0xc0, 0x00, 0x00, 0xff, 0xf6, 0xff, 0xc9, 0x00, 0x00, 0x00, 0x00,
-    0xff, 0x33, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf9, 0xff, 0xeb, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe7,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xc8, 0xff, 0xad, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xa1, 0xff, 0xbd, 0xff, 0xe9,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x71, 0x00, 0x00, 0x00, 0x12, 0xff, 0x6c,
-    0x00, 0x00, 0xff, 0xca, 0x00, 0x00, 0x00, 0x00, 0xff, 0xa5, 0x00, 0x00, 0xff, 0xbb, 0xff, 0xbd,
-    0xff, 0xe9, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0xff, 0xa5,
-    0x00, 0x00, 0xff, 0xd2, 0x00, 0x00, 0x00, 0x00, 0xff, 0xec, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xd8, 0xff, 0xec, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe3, 0xff, 0xf5, 0x00, 0x00, 0xff, 0xf1,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xff, 0xf2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xff, 0x79, 0xff, 0xce, 0x00, 0x00, 0xff, 0xf1, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xff, 0xdd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xed, 0x00, 0x00,
-    0x00, 0x00, 0xff, 0xe6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xed,
-    0x00, 0x00, 0x00, 0x00, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xee, 0x00, 0x00, 0xff, 0xf1, 0xff, 0x88, 0xff, 0xce,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf5, 0xff, 0x82, 0x00, 0x00, 0xff, 0xc7, 0x00, 0x11,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xc9, 0x00, 0x12, 0xff, 0xf4, 0xff, 0xac, 0x00, 0x00,
-    0xff, 0xc4, 0xff, 0xad, 0xff, 0x8d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x8a, 0xff, 0xf1, 0x00, 0x00, 0xff, 0xeb,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xea, 0x00, 0x00, 0xff, 0x93, 0x00, 0x00,
-    0xff, 0xd0, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe1, 0x00, 0x00, 0xff, 0xf5, 0xff, 0xeb, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xea, 0xff, 0xd5, 0xff, 0xed,
-    0xff, 0xed, 0xff, 0xeb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xff, 0xcf, 0xff, 0xf1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xff, 0x9a, 0xff, 0xa1, 0xff, 0xe4, 0x00, 0x00, 0xff, 0xb4, 0x00, 0x00, 0xff, 0xb3,
-    0xff, 0x17, 0xff, 0xb9, 0x00, 0x10, 0xff, 0x09, 0xff, 0xf1, 0xff, 0xcb, 0x00, 0x00, 0xff, 0xed,
-    0xff, 0xa2, 0x00, 0x00, 0xff, 0x7e, 0xff, 0x75, 0xff, 0x7c, 0xff, 0x7b, 0x00, 0x00, 0x00, 0x10,
-    0x00, 0x10, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xa2, 0xff, 0x19, 0xff, 0x9b, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xff, 0xf5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xd4, 0xff, 0xf3,
-    0x00, 0x00, 0xff, 0xf5, 0x00, 0x00, 0x00, 0x00, 0xff, 0x23, 0xff, 0xd9, 0x00, 0x00, 0xff, 0xaf,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xb5, 0x00, 0x00, 0x00, 0x00, 0xff, 0xd2,
-    0x00, 0x00, 0xff, 0xd2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xb4, 0xff, 0xb4, 0xff, 0xb5,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xd8, 0xff, 0xbf, 0xff, 0xe3, 0x00, 0x00, 0xff, 0xec,
-    0x00, 0x0d, 0xff, 0xe9, 0xff, 0x26, 0xff, 0xcb, 0x00, 0x11, 0xff, 0xa7, 0xff, 0xf3, 0x00, 0x00,
-    0x00, 0x00, 0xff, 0xef, 0xff, 0x8d, 0x00, 0x00, 0x00, 0x00, 0xff, 0xbf, 0x00, 0x00, 0xff, 0xbb,
-    0x00, 0x00, 0x00, 0x12, 0x00, 0x12, 0xff, 0xab, 0xff, 0xab, 0xff, 0x8d, 0xff, 0xa0, 0xff, 0xc6,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xff, 0xf2, 0x00, 0x00, 0x00, 0x00, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xbf, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf2,
-    0x00, 0x00, 0x00, 0x00, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xff, 0xee, 0x00, 0x00, 0x00, 0x00, 0xff, 0xec, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xff, 0xea, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xee,
-    0x00, 0x00, 0xff, 0xf1, 0x00, 0x00, 0xff, 0xce, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf5,
-    0xff, 0x82, 0x00, 0x00, 0xff, 0xc7, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xc9,
-    0x00, 0x12, 0xff, 0xf4, 0xff, 0xac, 0x00, 0x00, 0xff, 0xc4, 0xff, 0xad, 0xff, 0x8d, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xea, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xeb, 0xff, 0xeb, 0xff, 0xea,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xff, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xff, 0xe8, 0xff, 0xc9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xff, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xda, 0x00, 0x00,
-    0xfe, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xa8, 0x00, 0x00, 0x00, 0x00,
-    0xff, 0x67, 0x00, 0x00, 0xff, 0xc7, 0xff, 0xf3, 0x00, 0x00, 0xff, 0xf5, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xff, 0xac, 0xff, 0xac, 0xff, 0x67, 0xff, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xff, 0xa1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x86, 0x00, 0x06, 0x00, 0x0b,
-    0x00, 0x96, 0x00, 0xb2, 0x00, 0xd4, 0x00, 0xd5, 0x00, 0xd7, 0x00, 0xda, 0x00, 0xdc, 0x00, 0xdd,
-    0x00, 0xde, 0x00, 0xe0, 0x00, 0xe1, 0x00, 0xe2, 0x00, 0xe3, 0x00, 0xe4, 0x00, 0xe5, 0x00, 0xe6,
-    0x00, 0xec, 0x00, 0xee, 0x00, 0xf7, 0x00, 0xfc, 0x00, 0xfe, 0x00, 0xff, 0x01, 0x04, 0x01, 0x05,
-    0x01, 0x0a, 0x01, 0x0d, 0x01, 0x18, 0x01, 0x19, 0x01, 0x1a, 0x01, 0x2e, 0x01, 0x2f, 0x01, 0x30,
-    0x01, 0x33, 0x01, 0x34, 0x01, 0x35, 0x01, 0x37, 0x01, 0x39, 0x01, 0x3b, 0x01, 0x43, 0x01, 0x44,
-    0x01, 0x54, 0x01, 0x56, 0x01, 0x58, 0x01, 0x5c, 0x01, 0x5d, 0x01, 0x5e, 0x01, 0x84, 0x01, 0x85,
-    0x01, 0x87, 0x01, 0x88, 0x01, 0x89, 0x02, 0x05, 0x02, 0x19, 0x02, 0x28, 0x02, 0x29, 0x02, 0x2a,
-    0x03, 0xc8, 0x03, 0xc9, 0x03, 0xcb, 0x03, 0xcc, 0x03, 0xcd, 0x03, 0xce, 0x03, 0xcf, 0x03, 0xd0,
-    0x03, 0xd1, 0x03, 0xd2, 0x03, 0xd3, 0x03, 0xd4, 0x03, 0xd6, 0x03, 0xd7, 0x03, 0xd8, 0x03, 0xda,
-    0x03, 0xdb, 0x03, 0xdc, 0x03, 0xdd, 0x03, 0xde, 0x03, 0xdf, 0x03, 0xe1, 0x03, 0xe2, 0x03, 0xe3,
-    0x03, 0xe4, 0x03, 0xe5, 0x03, 0xe6, 0x03, 0xe7, 0x03, 0xed, 0x03, 0xf6, 0x03, 0xf7, 0x03, 0xfa,
-    0x03, 0xff, 0x04, 0x01, 0x04, 0x05, 0x04, 0x06, 0x04, 0x0b, 0x04, 0x0c, 0x04, 0x0d, 0x04, 0x0e,
-    0x04, 0x0f, 0x04, 0x10, 0x04, 0x11, 0x04, 0x12, 0x04, 0x13, 0x04, 0x14, 0x04, 0x15, 0x04, 0x16,
-    0x04, 0x19, 0x04, 0x1a, 0x04, 0x1c, 0x04, 0x1d, 0x04, 0x1e, 0x04, 0x1f, 0x04, 0x26, 0x04, 0x27,
-    0x04, 0x2b, 0x04, 0x2d, 0x04, 0x2e, 0x04, 0x2f, 0x04, 0x30, 0x04, 0x31, 0x04, 0x32, 0x04, 0x33,
-    0x04, 0x92, 0x04, 0x96, 0x04, 0x97, 0x04, 0x9a, 0x04, 0x9c, 0x04, 0x9d, 0x04, 0x9f, 0x04, 0xa1,
-    0x05, 0x03, 0x05, 0x05, 0x05, 0x0c, 0x05, 0x10, 0x00, 0x02, 0x00, 0xa0, 0x00, 0x06, 0x00, 0x06,
-    0x00, 0x04, 0x00, 0x0b, 0x00, 0x0b, 0x00, 0x04, 0x00, 0x10, 0x00, 0x10, 0x00, 0x08, 0x00, 0x11,
-    0x00, 0x11, 0x00, 0x0b, 0x00, 0x12, 0x00, 0x12, 0x00, 0x08, 0x00, 0xb2, 0x00, 0xb2, 0x00, 0x1b,
-    0x00, 0xd2, 0x00, 0xd2, 0x00, 0x0a, 0x00, 0xd3, 0x00, 0xd3, 0x00, 0x03, 0x00, 0xd4, 0x00, 0xd4,
-    0x00, 0x0d, 0x00, 0xd6, 0x00, 0xd6, 0x00, 0x0a, 0x00, 0xda, 0x00, 0xda, 0x00, 0x06, 0x00, 0xdd,
-    0x00, 0xdd, 0x00, 0x0d, 0x00, 0xde, 0x00, 0xde, 0x00, 0x0e, 0x00, 0xe1, 0x00, 0xe1, 0x00, 0x11,
-    0x00, 0xec, 0x00, 0xec, 0x00, 0x01, 0x00, 0xee, 0x00, 0xee, 0x00, 0x07, 0x00, 0xf0, 0x00, 0xf1,
-    0x00, 0x01, 0x00, 0xf2, 0x00, 0xf2, 0x00, 0x12, 0x00, 0xf3, 0x00, 0xf5, 0x00, 0x01, 0x00, 0xf7,
-    0x00, 0xf7, 0x00, 0x02, 0x00, 0xf8, 0x00, 0xf8, 0x00, 0x01, 0x00, 0xf9, 0x00, 0xf9, 0x00, 0x14,
-    0x00, 0xfa, 0x00, 0xfb, 0x00, 0x01, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0x01, 0x01, 0x00, 0x01, 0x00,
-    0x00, 0x01, 0x01, 0x03, 0x01, 0x03, 0x00, 0x02, 0x01, 0x04, 0x01, 0x04, 0x00, 0x12, 0x01, 0x05,
-    0x01, 0x05, 0x00, 0x01, 0x01, 0x08, 0x01, 0x08, 0x00, 0x03, 0x01, 0x0d, 0x01, 0x0d, 0x00, 0x10,
-    0x01, 0x17, 0x01, 0x17, 0x00, 0x03, 0x01, 0x18, 0x01, 0x18, 0x00, 0x13, 0x01, 0x19, 0x01, 0x19,
-    0x00, 0x17, 0x01, 0x1a, 0x01, 0x1a, 0x00, 0x05, 0x01, 0x1b, 0x01, 0x1b, 0x00, 0x03, 0x01, 0x1d,
-    0x01, 0x1d, 0x00, 0x03, 0x01, 0x1e, 0x01, 0x1e, 0x00, 0x02, 0x01, 0x1f, 0x01, 0x1f, 0x00, 0x03,
-    0x01, 0x21, 0x01, 0x21, 0x00, 0x03, 0x01, 0x22, 0x01, 0x22, 0x00, 0x02, 0x01, 0x2b, 0x01, 0x2b,
-    0x00, 0x01, 0x01, 0x33, 0x01, 0x33, 0x00, 0x06, 0x01, 0x34, 0x01, 0x34, 0x00, 0x07, 0x01, 0x36,
-    0x01, 0x36, 0x00, 0x01, 0x01, 0x39, 0x01, 0x39, 0x00, 0x0a, 0x01, 0x3c, 0x01, 0x3c, 0x00, 0x01,
-    0x01, 0x3e, 0x01, 0x3e, 0x00, 0x01, 0x01, 0x41, 0x01, 0x41, 0x00, 0x03, 0x01, 0x42, 0x01, 0x42,
-    0x00, 0x02, 0x01, 0x43, 0x01, 0x43, 0x00, 0x06, 0x01, 0x44, 0x01, 0x44, 0x00, 0x07, 0x01, 0x45,
-    0x01, 0x45, 0x00, 0x0a, 0x01, 0x47, 0x01, 0x47, 0x00, 0x11, 0x01, 0x48, 0x01, 0x48, 0x00, 0x14,
-    0x01, 0x50, 0x01, 0x50, 0x00, 0x0d, 0x01, 0x51, 0x01, 0x51, 0x00, 0x12, 0x01, 0x53, 0x01, 0x53,
-    0x00, 0x01, 0x01, 0x55, 0x01, 0x55, 0x00, 0x01, 0x01, 0x57, 0x01, 0x57, 0x00, 0x01, 0x01, 0x5c,
-    0x01, 0x5c, 0x00, 0x01, 0x01, 0x5d, 0x01, 0x5d, 0x00, 0x06, 0x01, 0x5e, 0x01, 0x5e, 0x00, 0x07,
-    0x01, 0x60, 0x01, 0x61, 0x00, 0x02, 0x01, 0x66, 0x01, 0x66, 0x00, 0x0d, 0x01, 0x6a, 0x01, 0x6a,
-    0x00, 0x03, 0x01, 0x6b, 0x01, 0x6b, 0x00, 0x02, 0x01, 0x6f, 0x01, 0x6f, 0x00, 0x0d, 0x01, 0x70,
-    0x01, 0x70, 0x00, 0x12, 0x01, 0x81, 0x01, 0x82, 0x00, 0x0b, 0x01, 0x84, 0x01, 0x85, 0x00, 0x04,
-    0x01, 0x86, 0x01, 0x86, 0x00, 0x08, 0x01, 0x87, 0x01, 0x89, 0x00, 0x04, 0x01, 0x8a, 0x01, 0x8a,
-    0x00, 0x08, 0x01, 0x8e, 0x01, 0x8f, 0x00, 0x08, 0x02, 0x05, 0x02, 0x05, 0x00, 0x19, 0x02, 0x0e,
-    0x02, 0x0e, 0x00, 0x0c, 0x02, 0x0f, 0x02, 0x0f, 0x00, 0x09, 0x02, 0x12, 0x02, 0x12, 0x00, 0x0c,
-    0x02, 0x16, 0x02, 0x16, 0x00, 0x0f, 0x02, 0x27, 0x02, 0x27, 0x00, 0x0f, 0x02, 0x2a, 0x02, 0x2a,
-    0x00, 0x0c, 0x02, 0x2b, 0x02, 0x2b, 0x00, 0x09, 0x02, 0x2c, 0x02, 0x2c, 0x00, 0x16, 0x02, 0x2d,
-    0x02, 0x2d, 0x00, 0x0f, 0x02, 0x2e, 0x02, 0x2e, 0x00, 0x0c, 0x02, 0x34, 0x02, 0x34, 0x00, 0x09,
-    0x02, 0x94, 0x02, 0x94, 0x00, 0x0b, 0x03, 0xcd, 0x03, 0xcd, 0x00, 0x1c, 0x03, 0xd0, 0x03, 0xd0,
-    0x00, 0x0e, 0x03, 0xd1, 0x03, 0xd1, 0x00, 0x10, 0x03, 0xd8, 0x03, 0xd8, 0x00, 0x03, 0x03, 0xdb,
-    0x03, 0xdb, 0x00, 0x03, 0x03, 0xdc, 0x03, 0xdc, 0x00, 0x0a, 0x03, 0xdd, 0x03, 0xdd, 0x00, 0x06,
-    0x03, 0xde, 0x03, 0xde, 0x00, 0x15, 0x03, 0xdf, 0x03, 0xdf, 0x00, 0x02, 0x03, 0xe0, 0x03, 0xe0,
-    0x00, 0x01, 0x03, 0xe1, 0x03, 0xe1, 0x00, 0x13, 0x03, 0xe2, 0x03, 0xe2, 0x00, 0x01, 0x03, 0xe3,
-    0x03, 0xe3, 0x00, 0x02, 0x03, 0xe4, 0x03, 0xe4, 0x00, 0x05, 0x03, 0xe5, 0x03, 0xe5, 0x00, 0x07,
-    0x03, 0xe6, 0x03, 0xe6, 0x00, 0x02, 0x03, 0xe7, 0x03, 0xe7, 0x00, 0x01, 0x03, 0xe8, 0x03, 0xe8,
-    0x00, 0x1d, 0x03, 0xec, 0x03, 0xec, 0x00, 0x01, 0x03, 0xed, 0x03, 0xed, 0x00, 0x05, 0x03, 0xf6,
-    0x03, 0xf7, 0x00, 0x04, 0x03, 0xfa, 0x03, 0xfa, 0x00, 0x04, 0x04, 0x01, 0x04, 0x01, 0x00, 0x02,
-    0x04, 0x02, 0x04, 0x02, 0x00, 0x01, 0x04, 0x05, 0x04, 0x05, 0x00, 0x17, 0x04, 0x06, 0x04, 0x06,
-    0x00, 0x05, 0x04, 0x07, 0x04, 0x07, 0x00, 0x02, 0x04, 0x08, 0x04, 0x08, 0x00, 0x03, 0x04, 0x0b,
-    0x04, 0x0b, 0x00, 0x03, 0x04, 0x0c, 0x04, 0x0c, 0x00, 0x02, 0x04, 0x0d, 0x04, 0x0d, 0x00, 0x18,
-    0x04, 0x0e, 0x04, 0x0e, 0x00, 0x05, 0x04, 0x10, 0x04, 0x10, 0x00, 0x06, 0x04, 0x11, 0x04, 0x11,
-    0x00, 0x07, 0x04, 0x13, 0x04, 0x13, 0x00, 0x10, 0x04, 0x14, 0x04, 0x14, 0x00, 0x15, 0x04, 0x15,
-    0x04, 0x15, 0x00, 0x10, 0x04, 0x16, 0x04, 0x16, 0x00, 0x15, 0x04, 0x1a, 0x04, 0x1a, 0x00, 0x02,
-    0x04, 0x1c, 0x04, 0x1d, 0x00, 0x02, 0x04, 0x1e, 0x04, 0x1e, 0x00, 0x06, 0x04, 0x1f, 0x04, 0x1f,
-    0x00, 0x07, 0x04, 0x23, 0x04, 0x23, 0x00, 0x01, 0x04, 0x25, 0x04, 0x25, 0x00, 0x01, 0x04, 0x26,
-    0x04, 0x26, 0x00, 0x03, 0x04, 0x27, 0x04, 0x27, 0x00, 0x13, 0x04, 0x28, 0x04, 0x28, 0x00, 0x03,
-    0x04, 0x29, 0x04, 0x29, 0x00, 0x02, 0x04, 0x2a, 0x04, 0x2a, 0x00, 0x03, 0x04, 0x2b, 0x04, 0x2b,
-    0x00, 0x13, 0x04, 0x2e, 0x04, 0x2e, 0x00, 0x0e, 0x04, 0x2f, 0x04, 0x2f, 0x00, 0x05, 0x04, 0x30,
-    0x04, 0x30, 0x00, 0x0e, 0x04, 0x31, 0x04, 0x31, 0x00, 0x05, 0x04, 0x32, 0x04, 0x32, 0x00, 0x0e,
-    0x04, 0x33, 0x04, 0x33, 0x00, 0x05, 0x04, 0x34, 0x04, 0x34, 0x00, 0x11, 0x04, 0x35, 0x04, 0x35,
-    0x00, 0x14, 0x04, 0x37, 0x04, 0x37, 0x00, 0x01, 0x04, 0x38, 0x04, 0x38, 0x00, 0x02, 0x04, 0x92,
-    0x04, 0x92, 0x00, 0x0a, 0x04, 0x94, 0x04, 0x94, 0x00, 0x11, 0x04, 0x95, 0x04, 0x95, 0x00, 0x14,
-    0x04, 0x97, 0x04, 0x97, 0x00, 0x01, 0x04, 0xa1, 0x04, 0xa1, 0x00, 0x18, 0x04, 0xa7, 0x04, 0xa7,
-    0x00, 0x0b, 0x05, 0x05, 0x05, 0x05, 0x00, 0x1a, 0x05, 0x0c, 0x05, 0x0c, 0x00, 0x09, 0x05, 0x0f,
-    0x05, 0x0f, 0x00, 0x09, 0x05, 0x10, 0x05, 0x10, 0x00, 0x0c, 0x05, 0x11, 0x05, 0x11, 0x00, 0x0f,
-    0x05, 0x14, 0x05, 0x14, 0x00, 0x09, 0x05, 0x15, 0x05, 0x15, 0x00, 0x16, 0x00, 0x02, 0x00, 0x6b,
-    0x00, 0x06, 0x00, 0x06, 0x00, 0x01, 0x00, 0x0b, 0x00, 0x0b, 0x00, 0x01, 0x00, 0x96, 0x00, 0x96,
-    0x00, 0x1c, 0x00, 0xb2, 0x00, 0xb2, 0x00, 0x1d, 0x00, 0xd4, 0x00, 0xd5, 0x00, 0x09, 0x00, 0xda,
-    0x00, 0xda, 0x00, 0x03, 0x00, 0xde, 0x00, 0xde, 0x00, 0x0a, 0x00, 0xe4, 0x00, 0xe4, 0x00, 0x09,
-    0x00, 0xe6, 0x00, 0xe6, 0x00, 0x09, 0x00, 0xec, 0x00, 0xec, 0x00, 0x0b, 0x00, 0xee, 0x00, 0xee,
-    0x00, 0x04, 0x00, 0xf7, 0x00, 0xf7, 0x00, 0x0c, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0x0d, 0x00, 0xfe,
-    0x00, 0xfe, 0x00, 0x0d, 0x00, 0xff, 0x00, 0xff, 0x00, 0x0c, 0x01, 0x04, 0x01, 0x05, 0x00, 0x0d,
-    0x01, 0x0a, 0x01, 0x0a, 0x00, 0x0d, 0x01, 0x0d, 0x01, 0x0d, 0x00, 0x0f, 0x01, 0x18, 0x01, 0x18,
-    0x00, 0x10, 0x01, 0x19, 0x01, 0x19, 0x00, 0x16, 0x01, 0x1a, 0x01, 0x1a, 0x00, 0x02, 0x01, 0x2e,
-    0x01, 0x2e, 0x00, 0x0c, 0x01, 0x2f, 0x01, 0x2f, 0x00, 0x08, 0x01, 0x30, 0x01, 0x30, 0x00, 0x0b,
-    0x01, 0x33, 0x01, 0x33, 0x00, 0x03, 0x01, 0x34, 0x01, 0x34, 0x00, 0x04, 0x01, 0x35, 0x01, 0x35,
-    0x00, 0x05, 0x01, 0x37, 0x01, 0x37, 0x00, 0x05, 0x01, 0x39, 0x01, 0x39, 0x00, 0x05, 0x01, 0x43,
-    0x01, 0x43, 0x00, 0x03, 0x01, 0x44, 0x01, 0x44, 0x00, 0x04, 0x01, 0x58, 0x01, 0x58, 0x00, 0x11,
-    0x01, 0x5c, 0x01, 0x5c, 0x00, 0x0b, 0x01, 0x5d, 0x01, 0x5d, 0x00, 0x03, 0x01, 0x5e, 0x01, 0x5e,
-    0x00, 0x04, 0x01, 0x84, 0x01, 0x85, 0x00, 0x01, 0x01, 0x87, 0x01, 0x89, 0x00, 0x01, 0x02, 0x05,
-    0x02, 0x05, 0x00, 0x18, 0x02, 0x19, 0x02, 0x19, 0x00, 0x07, 0x02, 0x28, 0x02, 0x2a, 0x00, 0x07,
-    0x03, 0xc8, 0x03, 0xc8, 0x00, 0x0e, 0x03, 0xc9, 0x03, 0xc9, 0x00, 0x08, 0x03, 0xcd, 0x03, 0xcd,
-    0x00, 0x1e, 0x03, 0xce, 0x03, 0xcf, 0x00, 0x05, 0x03, 0xd0, 0x03, 0xd0, 0x00, 0x0a, 0x03, 0xd1,
-    0x03, 0xd1, 0x00, 0x0f, 0x03, 0xd2, 0x03, 0xd2, 0x00, 0x1f, 0x03, 0xd3, 0x03, 0xd3, 0x00, 0x08,
-    0x03, 0xd4, 0x03, 0xd4, 0x00, 0x0e, 0x03, 0xd8, 0x03, 0xd8, 0x00, 0x11, 0x03, 0xda, 0x03, 0xda,
-    0x00, 0x20, 0x03, 0xdb, 0x03, 0xdb, 0x00, 0x13, 0x03, 0xdc, 0x03, 0xdc, 0x00, 0x14, 0x03, 0xdd,
-    0x03, 0xdd, 0x00, 0x03, 0x03, 0xde, 0x03, 0xde, 0x00, 0x12, 0x03, 0xdf, 0x03, 0xdf, 0x00, 0x06,
-    0x03, 0xe1, 0x03, 0xe1, 0x00, 0x10, 0x03, 0xe2, 0x03, 0xe2, 0x00, 0x0c, 0x03, 0xe3, 0x03, 0xe3,
-    0x00, 0x15, 0x03, 0xe4, 0x03, 0xe4, 0x00, 0x02, 0x03, 0xe5, 0x03, 0xe5, 0x00, 0x04, 0x03, 0xe6,
-    0x03, 0xe6, 0x00, 0x06, 0x03, 0xe7, 0x03, 0xe7, 0x00, 0x0b, 0x03, 0xed, 0x03, 0xed, 0x00, 0x02,
-    0x03, 0xf6, 0x03, 0xf7, 0x00, 0x01, 0x03, 0xfa, 0x03, 0xfa, 0x00, 0x01, 0x03, 0xff, 0x03, 0xff,
-    0x00, 0x0e, 0x04, 0x01, 0x04, 0x01, 0x00, 0x06, 0x04, 0x05, 0x04, 0x05, 0x00, 0x16, 0x04, 0x06,
-    0x04, 0x06, 0x00, 0x02, 0x04, 0x0b, 0x04, 0x0b, 0x00, 0x13, 0x04, 0x0c, 0x04, 0x0c, 0x00, 0x15,
-    0x04, 0x0d, 0x04, 0x0d, 0x00, 0x17, 0x04, 0x0e, 0x04, 0x0e, 0x00, 0x02, 0x04, 0x10, 0x04, 0x10,
-    0x00, 0x03, 0x04, 0x11, 0x04, 0x11, 0x00, 0x04, 0x04, 0x13, 0x04, 0x13, 0x00, 0x0f, 0x04, 0x14,
-    0x04, 0x14, 0x00, 0x12, 0x04, 0x15, 0x04, 0x15, 0x00, 0x0f, 0x04, 0x16, 0x04, 0x16, 0x00, 0x12,
-    0x04, 0x19, 0x04, 0x19, 0x00, 0x0e, 0x04, 0x1a, 0x04, 0x1a, 0x00, 0x06, 0x04, 0x1c, 0x04, 0x1d,
-    0x00, 0x06, 0x04, 0x1e, 0x04, 0x1e, 0x00, 0x03, 0x04, 0x1f, 0x04, 0x1f, 0x00, 0x04, 0x04, 0x26,
-    0x04, 0x26, 0x00, 0x11, 0x04, 0x27, 0x04, 0x27, 0x00, 0x10, 0x04, 0x2b, 0x04, 0x2b, 0x00, 0x10,
-    0x04, 0x2d, 0x04, 0x2d, 0x00, 0x0c, 0x04, 0x2e, 0x04, 0x2e, 0x00, 0x0a, 0x04, 0x2f, 0x04, 0x2f,
-    0x00, 0x02, 0x04, 0x30, 0x04, 0x30, 0x00, 0x0a, 0x04, 0x31, 0x04, 0x31, 0x00, 0x02, 0x04, 0x32,
-    0x04, 0x32, 0x00, 0x0a, 0x04, 0x33, 0x04, 0x33, 0x00, 0x02, 0x04, 0x92, 0x04, 0x92, 0x00, 0x14,
-    0x04, 0x96, 0x04, 0x96, 0x00, 0x08, 0x04, 0x97, 0x04, 0x97, 0x00, 0x0b, 0x04, 0x9a, 0x04, 0x9a,
-    0x00, 0x21, 0x04, 0x9c, 0x04, 0x9c, 0x00, 0x09, 0x04, 0x9d, 0x04, 0x9d, 0x00, 0x08, 0x04, 0x9f,
-    0x04, 0x9f, 0x00, 0x05, 0x04, 0xa1, 0x04, 0xa1, 0x00, 0x17, 0x05, 0x03, 0x05, 0x03, 0x00, 0x07,
-    0x05, 0x05, 0x05, 0x05, 0x00, 0x19, 0x05, 0x0c, 0x05, 0x0c, 0x00, 0x1a, 0x05, 0x10, 0x05, 0x10,
-    0x00, 0x1b, 0x00, 0x01, 0x01, 0x14, 0x00, 0x04, 0x00, 0x00, 0x00, 0x85, 0x15, 0xbe, 0x15, 0xac,
-    0x15, 0xa6, 0x15, 0xa0, 0x15, 0x92, 0x15, 0x6c, 0x15, 0x36, 0x13, 0xc8, 0x12, 0xb2, 0x11, 0x6c,
-    0x10, 0x9e, 0x10, 0x7c, 0x0f, 0x62, 0x0e, 0x74, 0x0e, 0x42, 0x0d, 0xc0, 0x10, 0x7c, 0x10, 0x7c,
-    0x0d, 0x76, 0x10, 0x7c, 0x10, 0x7c, 0x10, 0x7c, 0x0c, 0x8c, 0x0c, 0x0e, 0x10, 0x7c, 0x0b, 0xe4,
-    0x0b, 0x66, 0x0a, 0xf0, 0x0a, 0xce, 0x0a, 0x24, 0x09, 0xc6, 0x09, 0xbc, 0x09, 0x1e, 0x09, 0x18,
-    0x08, 0xee, 0x08, 0x74, 0x07, 0x62, 0x07, 0x4c, 0x07, 0x0e, 0x06, 0x84, 0x06, 0x2e, 0x06, 0x08,
-    0x07, 0x4c, 0x05, 0xb2, 0x05, 0x88, 0x05, 0x36, 0x05, 0x00, 0x06, 0x08, 0x04, 0xc6, 0x04, 0xa4,
-    0x04, 0x96, 0x04, 0x8c, 0x04, 0x62, 0x07, 0x4c, 0x03, 0xd8, 0x09, 0xbc, 0x0e, 0x42, 0x09, 0x18,
-    0x03, 0xa2, 0x03, 0xa2, 0x03, 0xa2, 0x10, 0x7c, 0x0e, 0x42, 0x09, 0x18, 0x10, 0x7c, 0x10, 0x7c,
-    0x03, 0x94, 0x09, 0xbc, 0x0e, 0x42, 0x09, 0x18, 0x03, 0x32, 0x03, 0xd8, 0x10, 0x7c, 0x10, 0x7c,
-    0x03, 0xa2, 0x03, 0xa2, 0x0d, 0x76, 0x04, 0xc6, 0x03, 0x28, 0x03, 0xd8, 0x10, 0x7c, 0x10, 0x7c,
-    0x03, 0x94, 0x03, 0x1a, 0x03, 0x08, 0x02, 0x7a, 0x0e, 0x42, 0x02, 0x58, 0x02, 0x4e, 0x04, 0xa4,
-    0x07, 0x4c, 0x04, 0x8c, 0x09, 0x18, 0x02, 0x4e, 0x09, 0xbc, 0x04, 0x8c, 0x02, 0x4e, 0x04, 0x96,
-    0x04, 0x8c, 0x03, 0x08, 0x02, 0x2c, 0x04, 0x8c, 0x10, 0x7c, 0x0e, 0x42, 0x09, 0x18, 0x10, 0x7c,
-    0x04, 0xc6, 0x02, 0x58, 0x04, 0xc6, 0x02, 0x58, 0x02, 0x4e, 0x02, 0x4e, 0x02, 0x4e, 0x0e, 0x42,
-    0x09, 0x18, 0x03, 0x94, 0x04, 0xa4, 0x04, 0xa4, 0x07, 0x4c, 0x0d, 0x76, 0x04, 0x8c, 0x0d, 0x76,
-    0x04, 0x8c, 0x0d, 0x76, 0x04, 0x8c, 0x02, 0x7a, 0x03, 0xd8, 0x09, 0xbc, 0x02, 0x22, 0x0b, 0xe4,
-    0x03, 0xd8, 0x03, 0xa2, 0x02, 0x2c, 0x00, 0x01, 0x00, 0x85, 0x00, 0x04, 0x00, 0x0c, 0x00, 0x3f,
-    0x00, 0x5f, 0x00, 0x96, 0x00, 0x9d, 0x00, 0xb2, 0x00, 0xd2, 0x00, 0xd4, 0x00, 0xd5, 0x00, 0xd6,
-    0x00, 0xd7, 0x00, 0xd8, 0x00, 0xd9, 0x00, 0xda, 0x00, 0xdb, 0x00, 0xdc, 0x00, 0xdd, 0x00, 0xde,
-    0x00, 0xe0, 0x00, 0xe1, 0x00, 0xe2, 0x00, 0xe3, 0x00, 0xe4, 0x00, 0xe5, 0x00, 0xe6, 0x00, 0xe7,
-    0x00, 0xe8, 0x00, 0xe9, 0x00, 0xea, 0x00, 0xeb, 0x00, 0xec, 0x00, 0xed, 0x00, 0xee, 0x00, 0xef,
-    0x00, 0xf1, 0x00, 0xf6, 0x00, 0xf7, 0x00, 0xf8, 0x00, 0xfb, 0x00, 0xfc, 0x00, 0xfe, 0x00, 0xff,
-    0x01, 0x00, 0x01, 0x03, 0x01, 0x04, 0x01, 0x05, 0x01, 0x0a, 0x01, 0x0d, 0x01, 0x18, 0x01, 0x19,
-    0x01, 0x1a, 0x01, 0x22, 0x01, 0x2e, 0x01, 0x2f, 0x01, 0x30, 0x01, 0x33, 0x01, 0x34, 0x01, 0x35,
-    0x01, 0x37, 0x01, 0x39, 0x01, 0x3b, 0x01, 0x43, 0x01, 0x44, 0x01, 0x54, 0x01, 0x56, 0x01, 0x58,
-    0x01, 0x5c, 0x01, 0x5d, 0x01, 0x5e, 0x01, 0x85, 0x03, 0xc9, 0x03, 0xcb, 0x03, 0xcc, 0x03, 0xce,
-    0x03, 0xcf, 0x03, 0xd0, 0x03, 0xd1, 0x03, 0xd2, 0x03, 0xd3, 0x03, 0xd6, 0x03, 0xd7, 0x03, 0xd8,
-    0x03, 0xda, 0x03, 0xdb, 0x03, 0xdc, 0x03, 0xdd, 0x03, 0xde, 0x03, 0xdf, 0x03, 0xe1, 0x03, 0xe2,
-    0x03, 0xe4, 0x03, 0xe5, 0x03, 0xe6, 0x03, 0xe7, 0x03, 0xed, 0x04, 0x01, 0x04, 0x05, 0x04, 0x06,
-    0x04, 0x0b, 0x04, 0x0d, 0x04, 0x0e, 0x04, 0x0f, 0x04, 0x10, 0x04, 0x11, 0x04, 0x12, 0x04, 0x13,
-    0x04, 0x14, 0x04, 0x15, 0x04, 0x16, 0x04, 0x1a, 0x04, 0x1c, 0x04, 0x1d, 0x04, 0x1e, 0x04, 0x1f,
-    0x04, 0x26, 0x04, 0x27, 0x04, 0x2b, 0x04, 0x2d, 0x04, 0x2e, 0x04, 0x2f, 0x04, 0x30, 0x04, 0x31,
-    0x04, 0x32, 0x04, 0x33, 0x04, 0x92, 0x04, 0x96, 0x04, 0x97, 0x04, 0x9a, 0x04, 0x9c, 0x04, 0x9d,
-    0x04, 0x9f, 0x04, 0xa1, 0x00, 0x02, 0x00, 0xf6, 0xff, 0xc8, 0x01, 0x85, 0xff, 0xa1, 0x00, 0x08,
-    0x00, 0x0a, 0xff, 0xe2, 0x00, 0x0d, 0x00, 0x14, 0x00, 0x0e, 0xff, 0xcf, 0x00, 0x41, 0x00, 0x12,
-    0x00, 0x61, 0x00, 0x13, 0x00, 0x6d, 0xff, 0xae, 0x00, 0x7c, 0xff, 0xcd, 0x01, 0x8d, 0xff, 0xd3,
-    0x00, 0x02, 0x00, 0xf6, 0xff, 0xf5, 0x01, 0x85, 0xff, 0xb6, 0x00, 0x08, 0x00, 0xf6, 0xff, 0xf0,
-    0x00, 0xfe, 0xff, 0xfa, 0x01, 0x09, 0xff, 0xf1, 0x01, 0x20, 0xff, 0xf3, 0x01, 0x3a, 0xff, 0xf1,
-    0x01, 0x63, 0xff, 0xf3, 0x01, 0x65, 0xff, 0xed, 0x01, 0x6d, 0xff, 0xde, 0x00, 0x23, 0x00, 0x04,
-    0xff, 0xd1, 0x00, 0x6d, 0xfe, 0xfa, 0x00, 0x7c, 0xff, 0x42, 0x00, 0xd9, 0xff, 0xa9, 0x00, 0xe6,
-    0x00, 0x0f, 0x00, 0xea, 0xff, 0xe4, 0x00, 0xeb, 0xff, 0xa0, 0x00, 0xed, 0xff, 0x74, 0x00, 0xef,
-    0xff, 0x80, 0x00, 0xf6, 0xff, 0xb2, 0x00, 0xfd, 0xff, 0x7d, 0x00, 0xfe, 0xff, 0x9e, 0x00, 0xff,
-    0xff, 0x80, 0x01, 0x01, 0xff, 0x79, 0x01, 0x02, 0x00, 0x0f, 0x01, 0x07, 0xff, 0x7d, 0x01, 0x09,
-    0xff, 0x7f, 0x01, 0x1c, 0xff, 0x86, 0x01, 0x20, 0xff, 0xda, 0x01, 0x2e, 0xff, 0x81, 0x01, 0x30,
-    0xff, 0x98, 0x01, 0x38, 0xff, 0x7d, 0x01, 0x3a, 0xff, 0xb3, 0x01, 0x40, 0xff, 0xa0, 0x01, 0x4a,
-    0xff, 0x7c, 0x01, 0x4c, 0xff, 0x9a, 0x01, 0x4d, 0xff, 0x6c, 0x01, 0x58, 0xff, 0xe6, 0x01, 0x5f,
-    0xff, 0x6b, 0x01, 0x63, 0xff, 0x92, 0x01, 0x65, 0xff, 0xad, 0x01, 0x69, 0xff, 0x7b, 0x01, 0x6c,
-    0x00, 0x0f, 0x01, 0x6d, 0xff, 0x91, 0x01, 0x6e, 0xff, 0xf2, 0x00, 0x04, 0x00, 0x0d, 0xff, 0xe6,
-    0x00, 0x41, 0xff, 0xf4, 0x00, 0x61, 0xff, 0xef, 0x01, 0x4d, 0xff, 0xed, 0x00, 0x03, 0x00, 0xd9,
-    0xff, 0x71, 0x00, 0xed, 0xff, 0x9e, 0x01, 0x5f, 0xff, 0xdc, 0x00, 0x02, 0x01, 0x11, 0x00, 0x0b,
-    0x01, 0x6c, 0xff, 0xe6, 0x00, 0x18, 0x00, 0xf7, 0xff, 0xb4, 0x01, 0x03, 0xff, 0xb4, 0x01, 0x18,
-    0xff, 0x7a, 0x01, 0x1e, 0xff, 0xb4, 0x01, 0x22, 0xff, 0xb4, 0x01, 0x42, 0xff, 0xb4, 0x01, 0x60,
-    0xff, 0xb4, 0x01, 0x61, 0xff, 0xb4, 0x01, 0x6b, 0xff, 0xb4, 0x03, 0xdf, 0xff, 0xb4, 0x03, 0xe1,
-    0xff, 0x7a, 0x03, 0xe3, 0xff, 0xb4, 0x03, 0xe6, 0xff, 0xb4, 0x03, 0xe8, 0xff, 0x64, 0x04, 0x01,
-    0xff, 0xb4, 0x04, 0x07, 0xff, 0xb4, 0x04, 0x0c, 0xff, 0xb4, 0x04, 0x1a, 0xff, 0xb4, 0x04, 0x1c,
-    0xff, 0xb4, 0x04, 0x1d, 0xff, 0xb4, 0x04, 0x27, 0xff, 0x7a, 0x04, 0x29, 0xff, 0xb4, 0x04, 0x2b,
-    0xff, 0x7a, 0x04, 0x38, 0xff, 0xb4, 0x00, 0x03, 0x00, 0xd9, 0xff, 0xdf, 0x00, 0xe6, 0xff, 0xe0,
-    0x01, 0x6c, 0xff, 0xe0, 0x00, 0x0d, 0x00, 0xea, 0xff, 0xd7, 0x00, 0xf6, 0xff, 0xb9, 0x00, 0xfe,
-    0xff, 0xe9, 0x01, 0x09, 0xff, 0xb2, 0x01, 0x1c, 0xff, 0xd2, 0x01, 0x20, 0xff, 0xc8, 0x01, 0x3a,
-    0xff, 0xa0, 0x01, 0x4a, 0xff, 0xc5, 0x01, 0x58, 0xff, 0xe4, 0x01, 0x63, 0xff, 0xcc, 0x01, 0x65,
-    0xff, 0xcc, 0x01, 0x6d, 0xff, 0xcb, 0x01, 0x6e, 0xff, 0xef, 0x00, 0x22, 0x00, 0x6d, 0xfe, 0x2f,
-    0x00, 0x7c, 0xfe, 0xa9, 0x00, 0xd9, 0xff, 0x58, 0x00, 0xe6, 0x00, 0x05, 0x00, 0xea, 0xff, 0xbd,
-    0x00, 0xeb, 0xff, 0x49, 0x00, 0xed, 0xfe, 0xfe, 0x00, 0xef, 0xff, 0x13, 0x00, 0xf6, 0xff, 0x68,
-    0x00, 0xfd, 0xff, 0x0e, 0x00, 0xfe, 0xff, 0x46, 0x00, 0xff, 0xff, 0x13, 0x01, 0x01, 0xff, 0x07,
-    0x01, 0x02, 0x00, 0x12, 0x01, 0x07, 0xff, 0x0e, 0x01, 0x09, 0xff, 0x11, 0x01, 0x1c, 0xff, 0x1d,
-    0x01, 0x20, 0xff, 0xac, 0x01, 0x2e, 0xff, 0x15, 0x01, 0x30, 0xff, 0x3c, 0x01, 0x38, 0xff, 0x0e,
-    0x01, 0x3a, 0xff, 0x6a, 0x01, 0x40, 0xff, 0x49, 0x01, 0x4a, 0xff, 0x0c, 0x01, 0x4c, 0xff, 0x3f,
-    0x01, 0x4d, 0xfe, 0xf1, 0x01, 0x58, 0xff, 0xc0, 0x01, 0x5f, 0xfe, 0xef, 0x01, 0x63, 0xff, 0x31,
-    0x01, 0x65, 0xff, 0x5f, 0x01, 0x69, 0xff, 0x0a, 0x01, 0x6c, 0x00, 0x05, 0x01, 0x6d, 0xff, 0x30,
-    0x01, 0x6e, 0xff, 0xd5, 0x00, 0x0a, 0x00, 0x06, 0xff, 0xea, 0x00, 0x0b, 0xff, 0xea, 0x01, 0x84,
-    0xff, 0xea, 0x01, 0x85, 0xff, 0xea, 0x01, 0x87, 0xff, 0xea, 0x01, 0x88, 0xff, 0xea, 0x01, 0x89,
-    0xff, 0xea, 0x03, 0xf6, 0xff, 0xea, 0x03, 0xf7, 0xff, 0xea, 0x03, 0xfa, 0xff, 0xea, 0x00, 0x02,
-    0x00, 0xed, 0xff, 0xc8, 0x01, 0x1c, 0xff, 0xf1, 0x00, 0x03, 0x00, 0x0d, 0x00, 0x14, 0x00, 0x41,
-    0x00, 0x11, 0x00, 0x61, 0x00, 0x13, 0x00, 0x08, 0x00, 0xed, 0xff, 0xb8, 0x00, 0xf6, 0xff, 0xe7,
-    0x01, 0x09, 0xff, 0xf0, 0x01, 0x20, 0xff, 0xf1, 0x01, 0x3a, 0xff, 0xeb, 0x01, 0x63, 0xff, 0xf5,
-    0x01, 0x6d, 0xff, 0xec, 0x01, 0x85, 0xff, 0xa4, 0x00, 0x0e, 0x00, 0x23, 0xff, 0xbc, 0x00, 0xd9,
-    0x00, 0x13, 0x00, 0xe6, 0xff, 0xc5, 0x00, 0xf6, 0xff, 0xca, 0x01, 0x3a, 0xff, 0x94, 0x01, 0x49,
-    0xff, 0x58, 0x01, 0x4a, 0xff, 0x7f, 0x01, 0x4c, 0xff, 0xa5, 0x01, 0x4d, 0xff, 0xdd, 0x01, 0x58,
-    0xff, 0xf2, 0x01, 0x62, 0xff, 0x8b, 0x01, 0x64, 0xff, 0xca, 0x01, 0x6c, 0xff, 0x70, 0x01, 0x6d,
-    0xff, 0xa2, 0x00, 0x0d, 0x00, 0xf6, 0xff, 0x9a, 0x00, 0xf9, 0xff, 0xd6, 0x00, 0xfe, 0xff, 0xf2,
-    0x01, 0x09, 0xff, 0xd3, 0x01, 0x20, 0xff, 0xdb, 0x01, 0x3a, 0xff, 0x3e, 0x01, 0x48, 0xff, 0xd6,
-    0x01, 0x4a, 0xff, 0xba, 0x01, 0x63, 0xff, 0xf0, 0x01, 0x65, 0xff, 0xf2, 0x01, 0x6d, 0xff, 0x50,
-    0x04, 0x35, 0xff, 0xd6, 0x04, 0x95, 0xff, 0xd6, 0x00, 0x14, 0x00, 0xee, 0xff, 0xed, 0x00, 0xf6,
-    0xff, 0xa1, 0x00, 0xf9, 0xff, 0xd1, 0x00, 0xfe, 0xff, 0xef, 0x01, 0x09, 0xff, 0xd3, 0x01, 0x20,
-    0xff, 0xdb, 0x01, 0x34, 0xff, 0xed, 0x01, 0x3a, 0xff, 0x3e, 0x01, 0x44, 0xff, 0xed, 0x01, 0x48,
-    0xff, 0xd1, 0x01, 0x4a, 0xff, 0xba, 0x01, 0x5e, 0xff, 0xed, 0x01, 0x63, 0xff, 0xf0, 0x01, 0x65,
-    0xff, 0xf2, 0x01, 0x6d, 0xff, 0x50, 0x03, 0xe5, 0xff, 0xed, 0x04, 0x11, 0xff, 0xed, 0x04, 0x1f,
-    0xff, 0xed, 0x04, 0x35, 0xff, 0xd1, 0x04, 0x95, 0xff, 0xd1, 0x00, 0x0a, 0x00, 0x06, 0xff, 0xd6,
-    0x00, 0x0b, 0xff, 0xd6, 0x01, 0x84, 0xff, 0xd6, 0x01, 0x85, 0xff, 0xd6, 0x01, 0x87, 0xff, 0xd6,
-    0x01, 0x88, 0xff, 0xd6, 0x01, 0x89, 0xff, 0xd6, 0x03, 0xf6, 0xff, 0xd6, 0x03, 0xf7, 0xff, 0xd6,
-    0x03, 0xfa, 0xff, 0xd6, 0x00, 0x15, 0x00, 0xed, 0xff, 0xef, 0x00, 0xee, 0xff, 0xf0, 0x00, 0xf2,
-    0xff, 0xf3, 0x00, 0xfe, 0xff, 0xf9, 0x01, 0x04, 0xff, 0xf3, 0x01, 0x1a, 0xff, 0xf4, 0x01, 0x34,
-    0xff, 0xf0, 0x01, 0x44, 0xff, 0xf0, 0x01, 0x51, 0xff, 0xf3, 0x01, 0x5e, 0xff, 0xf0, 0x01, 0x70,
-    0xff, 0xf3, 0x03, 0xe4, 0xff, 0xf4, 0x03, 0xe5, 0xff, 0xf0, 0x03, 0xed, 0xff, 0xf4, 0x04, 0x06,
-    0xff, 0xf4, 0x04, 0x0e, 0xff, 0xf4, 0x04, 0x11, 0xff, 0xf0, 0x04, 0x1f, 0xff, 0xf0, 0x04, 0x2f,
-    0xff, 0xf4, 0x04, 0x31, 0xff, 0xf4, 0x04, 0x33, 0xff, 0xf4, 0x00, 0x09, 0x00, 0xf6, 0xff, 0x9d,
-    0x00, 0xfe, 0xff, 0xeb, 0x01, 0x09, 0xff, 0xd3, 0x01, 0x20, 0xff, 0xdb, 0x01, 0x3a, 0xff, 0x3e,
-    0x01, 0x4a, 0xff, 0xba, 0x01, 0x63, 0xff, 0xf0, 0x01, 0x65, 0xff, 0xf2, 0x01, 0x6d, 0xff, 0x50,
-    0x00, 0x15, 0x00, 0xf6, 0xff, 0xa5, 0x00, 0xf9, 0xff, 0xe1, 0x00, 0xfe, 0xff, 0xfa, 0x01, 0x09,
-    0xff, 0xd3, 0x01, 0x1a, 0xff, 0xd2, 0x01, 0x20, 0xff, 0xdb, 0x01, 0x3a, 0xff, 0x4d, 0x01, 0x48,
-    0xff, 0xe1, 0x01, 0x4a, 0xff, 0xbb, 0x01, 0x63, 0xff, 0xf8, 0x01, 0x65, 0xff, 0xf3, 0x01, 0x6d,
-    0xff, 0x5f, 0x03, 0xe4, 0xff, 0xd2, 0x03, 0xed, 0xff, 0xd2, 0x04, 0x06, 0xff, 0xd2, 0x04, 0x0e,
-    0xff, 0xd2, 0x04, 0x2f, 0xff, 0xd2, 0x04, 0x31, 0xff, 0xd2, 0x04, 0x33, 0xff, 0xd2, 0x04, 0x35,
-    0xff, 0xe1, 0x04, 0x95, 0xff, 0xe1, 0x00, 0x22, 0x00, 0xed, 0x00, 0x2b, 0x00, 0xf2, 0x00, 0x14,
-    0x00, 0xf6, 0xff, 0xe3, 0x00, 0xf7, 0x00, 0x01, 0x00, 0xf9, 0xff, 0xf0, 0x00, 0xfc, 0xff, 0xe6,
-    0x00, 0xfe, 0xff, 0xf5, 0x01, 0x03, 0x00, 0x01, 0x01, 0x04, 0x00, 0x14, 0x01, 0x1e, 0x00, 0x01,
-    0x01, 0x22, 0x00, 0x01, 0x01, 0x3a, 0xff, 0xd3, 0x01, 0x42, 0x00, 0x01, 0x01, 0x48, 0xff, 0xf0,
-    0x01, 0x4a, 0xff, 0xdf, 0x01, 0x51, 0x00, 0x14, 0x01, 0x60, 0x00, 0x01, 0x01, 0x61, 0x00, 0x01,
-    0x01, 0x6b, 0x00, 0x01, 0x01, 0x6d, 0xff, 0xe3, 0x01, 0x70, 0x00, 0x14, 0x03, 0xdf, 0x00, 0x01,
-    0x03, 0xe3, 0x00, 0x01, 0x03, 0xe6, 0x00, 0x01, 0x04, 0x01, 0x00, 0x01, 0x04, 0x07, 0x00, 0x01,
-    0x04, 0x0c, 0x00, 0x01, 0x04, 0x1a, 0x00, 0x01, 0x04, 0x1c, 0x00, 0x01, 0x04, 0x1d, 0x00, 0x01,
-    0x04, 0x29, 0x00, 0x01, 0x04, 0x35, 0xff, 0xf0, 0x04, 0x38, 0x00, 0x01, 0x04, 0x95, 0xff, 0xf0,
-    0x00, 0x0f, 0x00, 0xed, 0x00, 0x14, 0x00, 0xf2, 0x00, 0x10, 0x00, 0xf6, 0xff, 0xf0, 0x00, 0xf9,
-    0xff, 0xf0, 0x00, 0xfe, 0xff, 0xfa, 0x01, 0x01, 0x00, 0x10, 0x01, 0x04, 0x00, 0x10, 0x01, 0x3a,
-    0xff, 0xec, 0x01, 0x48, 0xff, 0xf0, 0x01, 0x4a, 0xff, 0xe2, 0x01, 0x51, 0x00, 0x10, 0x01, 0x6d,
-    0xff, 0xf0, 0x01, 0x70, 0x00, 0x10, 0x04, 0x35, 0xff, 0xf0, 0x04, 0x95, 0xff, 0xf0, 0x00, 0x05,
-    0x00, 0xed, 0xff, 0xee, 0x00, 0xf6, 0xff, 0xbe, 0x00, 0xfe, 0xff, 0xf9, 0x01, 0x3a, 0xff, 0xec,
-    0x01, 0x6d, 0xff, 0xec, 0x00, 0x44, 0x00, 0x06, 0x00, 0x0d, 0x00, 0x0b, 0x00, 0x0d, 0x00, 0xed,
-    0xff, 0xb5, 0x00, 0xf2, 0xff, 0xbe, 0x00, 0xf7, 0xff, 0xb6, 0x01, 0x03, 0xff, 0xb6, 0x01, 0x04,
-    0xff, 0xbe, 0x01, 0x18, 0xff, 0xda, 0x01, 0x1a, 0x00, 0x0b, 0x01, 0x1c, 0xff, 0xe6, 0x01, 0x1e,
-    0xff, 0xb6, 0x01, 0x20, 0x00, 0x0c, 0x01, 0x22, 0xff, 0xb6, 0x01, 0x42, 0xff, 0xb6, 0x01, 0x51,
-    0xff, 0xbe, 0x01, 0x60, 0xff, 0xb6, 0x01, 0x61, 0xff, 0xb6, 0x01, 0x63, 0x00, 0x0b, 0x01, 0x65,
-    0x00, 0x0b, 0x01, 0x6b, 0xff, 0xb6, 0x01, 0x70, 0xff, 0xbe, 0x01, 0x84, 0x00, 0x0d, 0x01, 0x85,
-    0x00, 0x0d, 0x01, 0x87, 0x00, 0x0d, 0x01, 0x88, 0x00, 0x0d, 0x01, 0x89, 0x00, 0x0d, 0x02, 0x05,
-    0xff, 0xbf, 0x02, 0x0e, 0x00, 0x0e, 0x02, 0x0f, 0xff, 0xed, 0x02, 0x12, 0x00, 0x0e, 0x02, 0x2a,
-    0x00, 0x0e, 0x02, 0x2b, 0xff, 0xed, 0x02, 0x2c, 0x00, 0x0d, 0x02, 0x2e, 0x00, 0x0e, 0x02, 0x34,
-    0xff, 0xed, 0x03, 0xde, 0xff, 0xf0, 0x03, 0xdf, 0xff, 0xb6, 0x03, 0xe1, 0xff, 0xda, 0x03, 0xe3,
-    0xff, 0xb6, 0x03, 0xe4, 0x00, 0x0b, 0x03, 0xe6, 0xff, 0xb6, 0x03, 0xed, 0x00, 0x0b, 0x03, 0xf6,
-    0x00, 0x0d, 0x03, 0xf7, 0x00, 0x0d, 0x03, 0xfa, 0x00, 0x0d, 0x04, 0x01, 0xff, 0xb6, 0x04, 0x06,
-    0x00, 0x0b, 0x04, 0x07, 0xff, 0xb6, 0x04, 0x0c, 0xff, 0xb6, 0x04, 0x0e, 0x00, 0x0b, 0x04, 0x14,
-    0xff, 0xf0, 0x04, 0x16, 0xff, 0xf0, 0x04, 0x1a, 0xff, 0xb6, 0x04, 0x1c, 0xff, 0xb6, 0x04, 0x1d,
-    0xff, 0xb6, 0x04, 0x27, 0xff, 0xda, 0x04, 0x29, 0xff, 0xb6, 0x04, 0x2b, 0xff, 0xda, 0x04, 0x2f,
-    0x00, 0x0b, 0x04, 0x31, 0x00, 0x0b, 0x04, 0x33, 0x00, 0x0b, 0x04, 0x38, 0xff, 0xb6, 0x05, 0x05,
-    0xff, 0xbf, 0x05, 0x0c, 0xff, 0xed, 0x05, 0x0f, 0xff, 0xed, 0x05, 0x10, 0x00, 0x0e, 0x05, 0x14,
-    0xff, 0xed, 0x05, 0x15, 0x00, 0x0d, 0x00, 0x1e, 0x00, 0xf7, 0xff, 0xf0, 0x01, 0x03, 0xff, 0xf0,
-    0x01, 0x18, 0xff, 0xde, 0x01, 0x1c, 0xff, 0xeb, 0x01, 0x1e, 0xff, 0xf0, 0x01, 0x22, 0xff, 0xf0,
-    0x01, 0x42, 0xff, 0xf0, 0x01, 0x60, 0xff, 0xf0, 0x01, 0x61, 0xff, 0xf0, 0x01, 0x6b, 0xff, 0xf0,
-    0x02, 0x0f, 0xff, 0xeb, 0x02, 0x2b, 0xff, 0xeb, 0x02, 0x34, 0xff, 0xeb, 0x03, 0xdf, 0xff, 0xf0,
-    0x03, 0xe1, 0xff, 0xde, 0x03, 0xe3, 0xff, 0xf0, 0x03, 0xe6, 0xff, 0xf0, 0x04, 0x01, 0xff, 0xf0,
-    0x04, 0x07, 0xff, 0xf0, 0x04, 0x0c, 0xff, 0xf0, 0x04, 0x1a, 0xff, 0xf0, 0x04, 0x1c, 0xff, 0xf0,
-    0x04, 0x1d, 0xff, 0xf0, 0x04, 0x27, 0xff, 0xde, 0x04, 0x29, 0xff, 0xf0, 0x04, 0x2b, 0xff, 0xde,
-    0x04, 0x38, 0xff, 0xf0, 0x05, 0x0c, 0xff, 0xeb, 0x05, 0x0f, 0xff, 0xeb, 0x05, 0x14, 0xff, 0xeb,
-    0x00, 0x0a, 0x00, 0x06, 0xff, 0xf5, 0x00, 0x0b, 0xff, 0xf5, 0x01, 0x84, 0xff, 0xf5, 0x01, 0x85,
-    0xff, 0xf5, 0x01, 0x87, 0xff, 0xf5, 0x01, 0x88, 0xff, 0xf5, 0x01, 0x89, 0xff, 0xf5, 0x03, 0xf6,
-    0xff, 0xf5, 0x03, 0xf7, 0xff, 0xf5, 0x03, 0xfa, 0xff, 0xf5, 0x00, 0x01, 0x01, 0x1c, 0xff, 0xf1,
-    0x00, 0x27, 0x00, 0xec, 0xff, 0xf9, 0x00, 0xed, 0x00, 0x14, 0x00, 0xf0, 0xff, 0xf9, 0x00, 0xf1,
-    0xff, 0xf9, 0x00, 0xf3, 0xff, 0xf9, 0x00, 0xf4, 0xff, 0xf9, 0x00, 0xf5, 0xff, 0xf9, 0x00, 0xf6,
-    0xff, 0xed, 0x00, 0xf8, 0xff, 0xf9, 0x00, 0xf9, 0xff, 0xed, 0x00, 0xfa, 0xff, 0xf9, 0x00, 0xfb,
-    0xff, 0xf9, 0x00, 0xfc, 0xff, 0xdb, 0x00, 0xfe, 0xff, 0xf9, 0x01, 0x00, 0xff, 0xf9, 0x01, 0x05,
-    0xff, 0xf9, 0x01, 0x2b, 0xff, 0xf9, 0x01, 0x36, 0xff, 0xf9, 0x01, 0x3a, 0xff, 0xed, 0x01, 0x3c,
-    0xff, 0xf9, 0x01, 0x3e, 0xff, 0xf9, 0x01, 0x48, 0xff, 0xed, 0x01, 0x4a, 0xff, 0xed, 0x01, 0x53,
-    0xff, 0xf9, 0x01, 0x55, 0xff, 0xf9, 0x01, 0x57, 0xff, 0xf9, 0x01, 0x5c, 0xff, 0xf9, 0x01, 0x6d,
-    0xff, 0xed, 0x03, 0xe0, 0xff, 0xf9, 0x03, 0xe2, 0xff, 0xf9, 0x03, 0xe7, 0xff, 0xf9, 0x03, 0xec,
-    0xff, 0xf9, 0x04, 0x02, 0xff, 0xf9, 0x04, 0x23, 0xff, 0xf9, 0x04, 0x25, 0xff, 0xf9, 0x04, 0x35,
-    0xff, 0xed, 0x04, 0x37, 0xff, 0xf9, 0x04, 0x95, 0xff, 0xed, 0x04, 0x97, 0xff, 0xf9, 0x00, 0x02,
-    0x00, 0xed, 0xff, 0xa5, 0x01, 0x1c, 0xff, 0xee, 0x00, 0x17, 0x00, 0x06, 0xff, 0xf2, 0x00, 0x0b,
-    0xff, 0xf2, 0x00, 0xf6, 0xff, 0xf4, 0x00, 0xfe, 0xff, 0xfc, 0x01, 0x09, 0xff, 0xf5, 0x01, 0x1a,
-    0xff, 0xf5, 0x01, 0x3a, 0xff, 0xf5, 0x01, 0x6d, 0xff, 0xf5, 0x01, 0x84, 0xff, 0xf2, 0x01, 0x85,
-    0xff, 0xf2, 0x01, 0x87, 0xff, 0xf2, 0x01, 0x88, 0xff, 0xf2, 0x01, 0x89, 0xff, 0xf2, 0x03, 0xe4,
-    0xff, 0xf5, 0x03, 0xed, 0xff, 0xf5, 0x03, 0xf6, 0xff, 0xf2, 0x03, 0xf7, 0xff, 0xf2, 0x03, 0xfa,
-    0xff, 0xf2, 0x04, 0x06, 0xff, 0xf5, 0x04, 0x0e, 0xff, 0xf5, 0x04, 0x2f, 0xff, 0xf5, 0x04, 0x31,
-    0xff, 0xf5, 0x04, 0x33, 0xff, 0xf5, 0x00, 0x2a, 0x00, 0xec, 0xff, 0xef, 0x00, 0xed, 0xff, 0xee,
-    0x00, 0xee, 0xff, 0xf0, 0x00, 0xf0, 0xff, 0xef, 0x00, 0xf1, 0xff, 0xef, 0x00, 0xf3, 0xff, 0xef,
-    0x00, 0xf4, 0xff, 0xef, 0x00, 0xf5, 0xff, 0xef, 0x00, 0xf6, 0xff, 0xee, 0x00, 0xf8, 0xff, 0xef,
-    0x00, 0xfa, 0xff, 0xef, 0x00, 0xfb, 0xff, 0xef, 0x00, 0xfe, 0xff, 0xef, 0x01, 0x00, 0xff, 0xef,
-    0x01, 0x05, 0xff, 0xef, 0x01, 0x09, 0xff, 0xf4, 0x01, 0x20, 0xff, 0xf1, 0x01, 0x2b, 0xff, 0xef,
-    0x01, 0x34, 0xff, 0xf0, 0x01, 0x36, 0xff, 0xef, 0x01, 0x3a, 0xff, 0xef, 0x01, 0x3c, 0xff, 0xef,
-    0x01, 0x3e, 0xff, 0xef, 0x01, 0x44, 0xff, 0xf0, 0x01, 0x53, 0xff, 0xef, 0x01, 0x55, 0xff, 0xef,
-    0x01, 0x57, 0xff, 0xef, 0x01, 0x5c, 0xff, 0xef, 0x01, 0x5e, 0xff, 0xf0, 0x01, 0x6d, 0xff, 0xef,
-    0x03, 0xe0, 0xff, 0xef, 0x03, 0xe2, 0xff, 0xef, 0x03, 0xe5, 0xff, 0xf0, 0x03, 0xe7, 0xff, 0xef,
-    0x03, 0xec, 0xff, 0xef, 0x04, 0x02, 0xff, 0xef, 0x04, 0x11, 0xff, 0xf0, 0x04, 0x1f, 0xff, 0xf0,
-    0x04, 0x23, 0xff, 0xef, 0x04, 0x25, 0xff, 0xef, 0x04, 0x37, 0xff, 0xef, 0x04, 0x97, 0xff, 0xef,
-    0x00, 0x08, 0x00, 0xd2, 0xff, 0xeb, 0x00, 0xd6, 0xff, 0xeb, 0x01, 0x39, 0xff, 0xeb, 0x01, 0x45,
-    0xff, 0xeb, 0x03, 0xdc, 0xff, 0xeb, 0x04, 0x0d, 0xff, 0xf3, 0x04, 0x92, 0xff, 0xeb, 0x04, 0xa1,
-    0xff, 0xf3, 0x00, 0x1d, 0x00, 0xd2, 0xff, 0xe2, 0x00, 0xd4, 0xff, 0xe4, 0x00, 0xd6, 0xff, 0xe2,
-    0x00, 0xd9, 0xff, 0xe1, 0x00, 0xda, 0xff, 0xe4, 0x00, 0xdd, 0xff, 0xe4, 0x00, 0xde, 0xff, 0xe9,
-    0x00, 0xed, 0xff, 0xe4, 0x00, 0xf2, 0xff, 0xeb, 0x01, 0x04, 0xff, 0xeb, 0x01, 0x33, 0xff, 0xe4,
-    0x01, 0x39, 0xff, 0xe2, 0x01, 0x43, 0xff, 0xe4, 0x01, 0x45, 0xff, 0xe2, 0x01, 0x50, 0xff, 0xe4,
-    0x01, 0x51, 0xff, 0xeb, 0x01, 0x5d, 0xff, 0xe4, 0x01, 0x66, 0xff, 0xe4, 0x01, 0x6f, 0xff, 0xe4,
-    0x01, 0x70, 0xff, 0xeb, 0x03, 0xd0, 0xff, 0xe9, 0x03, 0xdc, 0xff, 0xe2, 0x03, 0xdd, 0xff, 0xe4,
-    0x04, 0x10, 0xff, 0xe4, 0x04, 0x1e, 0xff, 0xe4, 0x04, 0x2e, 0xff, 0xe9, 0x04, 0x30, 0xff, 0xe9,
-    0x04, 0x32, 0xff, 0xe9, 0x04, 0x92, 0xff, 0xe2, 0x00, 0x1f, 0x00, 0xd2, 0xff, 0xe3, 0x00, 0xd4,
-    0xff, 0xe5, 0x00, 0xd6, 0xff, 0xe3, 0x00, 0xd9, 0xff, 0xe2, 0x00, 0xda, 0xff, 0xe5, 0x00, 0xdd,
-    0xff, 0xe5, 0x00, 0xde, 0xff, 0xe9, 0x00, 0xf2, 0xff, 0xea, 0x01, 0x04, 0xff, 0xea, 0x01, 0x33,
-    0xff, 0xe5, 0x01, 0x39, 0xff, 0xe3, 0x01, 0x43, 0xff, 0xe5, 0x01, 0x45, 0xff, 0xe3, 0x01, 0x50,
-    0xff, 0xe5, 0x01, 0x51, 0xff, 0xea, 0x01, 0x5d, 0xff, 0xe5, 0x01, 0x66, 0xff, 0xe5, 0x01, 0x6c,
-    0xff, 0xe4, 0x01, 0x6f, 0xff, 0xe5, 0x01, 0x70, 0xff, 0xea, 0x03, 0xd0, 0xff, 0xe9, 0x03, 0xdc,
-    0xff, 0xe3, 0x03, 0xdd, 0xff, 0xe5, 0x04, 0x0d, 0xff, 0xe4, 0x04, 0x10, 0xff, 0xe5, 0x04, 0x1e,
-    0xff, 0xe5, 0x04, 0x2e, 0xff, 0xe9, 0x04, 0x30, 0xff, 0xe9, 0x04, 0x32, 0xff, 0xe9, 0x04, 0x92,
-    0xff, 0xe3, 0x04, 0xa1, 0xff, 0xe4, 0x00, 0x0a, 0x00, 0xe6, 0xff, 0xc3, 0x00, 0xf6, 0xff, 0xcf,
-    0x00, 0xfe, 0xff, 0xf0, 0x01, 0x3a, 0xff, 0xce, 0x01, 0x49, 0xff, 0xe7, 0x01, 0x4c, 0xff, 0xdf,
-    0x01, 0x62, 0xff, 0xd1, 0x01, 0x64, 0xff, 0xec, 0x01, 0x6c, 0xff, 0xa0, 0x01, 0x6d, 0xff, 0xd1,
-    0x00, 0x1f, 0x00, 0x06, 0xff, 0xc0, 0x00, 0x0b, 0xff, 0xc0, 0x00, 0xde, 0xff, 0xeb, 0x00, 0xe1,
-    0xff, 0xe7, 0x00, 0xe6, 0xff, 0xc3, 0x00, 0xf6, 0xff, 0xce, 0x00, 0xfe, 0xff, 0xf0, 0x01, 0x19,
-    0xff, 0xc8, 0x01, 0x3a, 0xff, 0xcd, 0x01, 0x47, 0xff, 0xe7, 0x01, 0x49, 0xff, 0xe7, 0x01, 0x4c,
-    0xff, 0xdf, 0x01, 0x62, 0xff, 0xd1, 0x01, 0x64, 0xff, 0xec, 0x01, 0x6c, 0xff, 0xa0, 0x01, 0x6d,
-    0xff, 0xd0, 0x01, 0x84, 0xff, 0xc0, 0x01, 0x85, 0xff, 0xc0, 0x01, 0x87, 0xff, 0xc0, 0x01, 0x88,
-    0xff, 0xc0, 0x01, 0x89, 0xff, 0xc0, 0x03, 0xd0, 0xff, 0xeb, 0x03, 0xf6, 0xff, 0xc0, 0x03, 0xf7,
-    0xff, 0xc0, 0x03, 0xfa, 0xff, 0xc0, 0x04, 0x05, 0xff, 0xc8, 0x04, 0x2e, 0xff, 0xeb, 0x04, 0x30,
-    0xff, 0xeb, 0x04, 0x32, 0xff, 0xeb, 0x04, 0x34, 0xff, 0xe7, 0x04, 0x94, 0xff, 0xe7, 0x00, 0x3a,
-    0x00, 0xb2, 0x00, 0x0f, 0x00, 0xd2, 0xff, 0xe6, 0x00, 0xd4, 0x00, 0x0e, 0x00, 0xd6, 0xff, 0xe6,
-    0x00, 0xd9, 0x00, 0x13, 0x00, 0xda, 0x00, 0x0e, 0x00, 0xdd, 0x00, 0x0e, 0x00, 0xde, 0x00, 0x0b,
-    0x00, 0xe1, 0xff, 0xe5, 0x00, 0xe6, 0xff, 0xe6, 0x00, 0xe7, 0xff, 0xf4, 0x00, 0xed, 0x00, 0x12,
-    0x00, 0xf2, 0x00, 0x0f, 0x00, 0xf6, 0xff, 0xe7, 0x00, 0xf9, 0xff, 0xe8, 0x00, 0xfe, 0xff, 0xf7,
-    0x01, 0x04, 0x00, 0x0f, 0x01, 0x0d, 0x00, 0x0f, 0x01, 0x19, 0xff, 0xe6, 0x01, 0x33, 0x00, 0x0e,
-    0x01, 0x39, 0xff, 0xe6, 0x01, 0x3a, 0xff, 0xe7, 0x01, 0x43, 0x00, 0x0e, 0x01, 0x45, 0xff, 0xe6,
-    0x01, 0x47, 0xff, 0xe5, 0x01, 0x48, 0xff, 0xe8, 0x01, 0x49, 0xff, 0xe5, 0x01, 0x4a, 0xff, 0xe8,
-    0x01, 0x4c, 0xff, 0xe4, 0x01, 0x50, 0x00, 0x0e, 0x01, 0x51, 0x00, 0x0f, 0x01, 0x5d, 0x00, 0x0e,
-    0x01, 0x62, 0xff, 0xe6, 0x01, 0x64, 0xff, 0xe6, 0x01, 0x66, 0x00, 0x0e, 0x01, 0x6c, 0xff, 0xe6,
-    0x01, 0x6d, 0xff, 0xe7, 0x01, 0x6f, 0x00, 0x0e, 0x01, 0x70, 0x00, 0x0f, 0x03, 0xd0, 0x00, 0x0b,
-    0x03, 0xd1, 0x00, 0x0f, 0x03, 0xdc, 0xff, 0xe6, 0x03, 0xdd, 0x00, 0x0e, 0x04, 0x05, 0xff, 0xe6,
-    0x04, 0x0d, 0xff, 0xe6, 0x04, 0x10, 0x00, 0x0e, 0x04, 0x13, 0x00, 0x0f, 0x04, 0x15, 0x00, 0x0f,
-    0x04, 0x1e, 0x00, 0x0e, 0x04, 0x2e, 0x00, 0x0b, 0x04, 0x30, 0x00, 0x0b, 0x04, 0x32, 0x00, 0x0b,
-    0x04, 0x34, 0xff, 0xe5, 0x04, 0x35, 0xff, 0xe8, 0x04, 0x92, 0xff, 0xe6, 0x04, 0x94, 0xff, 0xe5,
-    0x04, 0x95, 0xff, 0xe8, 0x04, 0xa1, 0xff, 0xe6, 0x00, 0x12, 0x00, 0xd9, 0xff, 0xae, 0x00, 0xe6,
-    0x00, 0x12, 0x00, 0xeb, 0xff, 0xe0, 0x00, 0xed, 0xff, 0xad, 0x00, 0xef, 0xff, 0xd6, 0x00, 0xfd,
-    0xff, 0xdf, 0x01, 0x01, 0xff, 0xd2, 0x01, 0x07, 0xff, 0xe0, 0x01, 0x1c, 0xff, 0xce, 0x01, 0x2e,
-    0xff, 0xdd, 0x01, 0x30, 0xff, 0xe2, 0x01, 0x38, 0xff, 0xe0, 0x01, 0x40, 0xff, 0xe0, 0x01, 0x4a,
-    0xff, 0xe9, 0x01, 0x4d, 0xff, 0xda, 0x01, 0x5f, 0xff, 0xbd, 0x01, 0x69, 0xff, 0xdf, 0x01, 0x6c,
-    0x00, 0x11, 0x00, 0x20, 0x00, 0x1b, 0xff, 0xf2, 0x00, 0xd2, 0xff, 0xf1, 0x00, 0xd4, 0xff, 0xf5,
-    0x00, 0xd6, 0xff, 0xf1, 0x00, 0xda, 0xff, 0xf4, 0x00, 0xdd, 0xff, 0xf5, 0x00, 0xde, 0xff, 0xf3,
-    0x00, 0xe6, 0xff, 0xf1, 0x01, 0x19, 0xff, 0xf4, 0x01, 0x33, 0xff, 0xf4, 0x01, 0x39, 0xff, 0xf1,
-    0x01, 0x43, 0xff, 0xf4, 0x01, 0x45, 0xff, 0xf1, 0x01, 0x50, 0xff, 0xf5, 0x01, 0x5d, 0xff, 0xf4,
-    0x01, 0x62, 0xff, 0xf2, 0x01, 0x64, 0xff, 0xf2, 0x01, 0x66, 0xff, 0xf5, 0x01, 0x6c, 0xff, 0xf2,
-    0x01, 0x6f, 0xff, 0xf5, 0x03, 0xd0, 0xff, 0xf3, 0x03, 0xdc, 0xff, 0xf1, 0x03, 0xdd, 0xff, 0xf4,
-    0x04, 0x05, 0xff, 0xf4, 0x04, 0x0d, 0xff, 0xf0, 0x04, 0x10, 0xff, 0xf4, 0x04, 0x1e, 0xff, 0xf4,
-    0x04, 0x2e, 0xff, 0xf3, 0x04, 0x30, 0xff, 0xf3, 0x04, 0x32, 0xff, 0xf3, 0x04, 0x92, 0xff, 0xf1,
-    0x04, 0xa1, 0xff, 0xf0, 0x00, 0x0c, 0x00, 0xd9, 0x00, 0x12, 0x00, 0xea, 0xff, 0xe9, 0x00, 0xf6,
-    0xff, 0xd7, 0x01, 0x3a, 0xff, 0xd7, 0x01, 0x4a, 0xff, 0xd3, 0x01, 0x4c, 0xff, 0xd6, 0x01, 0x4d,
-    0xff, 0xc5, 0x01, 0x58, 0xff, 0xe7, 0x01, 0x62, 0x00, 0x0d, 0x01, 0x64, 0x00, 0x0c, 0x01, 0x6d,
-    0xff, 0xd6, 0x01, 0x6e, 0xff, 0xf2, 0x00, 0x3b, 0x00, 0xb2, 0x00, 0x10, 0x00, 0xd2, 0xff, 0xe0,
-    0x00, 0xd3, 0xff, 0xe8, 0x00, 0xd4, 0x00, 0x10, 0x00, 0xd6, 0xff, 0xe0, 0x00, 0xd9, 0x00, 0x14,
-    0x00, 0xdd, 0x00, 0x10, 0x00, 0xe1, 0xff, 0xe1, 0x00, 0xe6, 0xff, 0xe0, 0x00, 0xed, 0x00, 0x13,
-    0x00, 0xf2, 0x00, 0x10, 0x00, 0xf9, 0xff, 0xe0, 0x01, 0x04, 0x00, 0x10, 0x01, 0x08, 0xff, 0xe8,
-    0x01, 0x0d, 0x00, 0x10, 0x01, 0x17, 0xff, 0xe8, 0x01, 0x19, 0xff, 0xe0, 0x01, 0x1b, 0xff, 0xe8,
-    0x01, 0x1d, 0xff, 0xe8, 0x01, 0x1f, 0xff, 0xe8, 0x01, 0x21, 0xff, 0xe8, 0x01, 0x39, 0xff, 0xe0,
-    0x01, 0x41, 0xff, 0xe8, 0x01, 0x45, 0xff, 0xe0, 0x01, 0x47, 0xff, 0xe1, 0x01, 0x48, 0xff, 0xe0,
-    0x01, 0x49, 0xff, 0xe1, 0x01, 0x4a, 0xff, 0xe0, 0x01, 0x4d, 0xff, 0xe1, 0x01, 0x50, 0x00, 0x10,
-    0x01, 0x51, 0x00, 0x10, 0x01, 0x58, 0xff, 0xe9, 0x01, 0x62, 0xff, 0xdf, 0x01, 0x64, 0xff, 0xde,
-    0x01, 0x66, 0x00, 0x10, 0x01, 0x6a, 0xff, 0xe8, 0x01, 0x6c, 0xff, 0xdf, 0x01, 0x6e, 0xff, 0xf2,
-    0x01, 0x6f, 0x00, 0x10, 0x01, 0x70, 0x00, 0x10, 0x03, 0xd1, 0x00, 0x10, 0x03, 0xd8, 0xff, 0xe8,
-    0x03, 0xdb, 0xff, 0xe8, 0x03, 0xdc, 0xff, 0xe0, 0x04, 0x05, 0xff, 0xe0, 0x04, 0x08, 0xff, 0xe8,
-    0x04, 0x0b, 0xff, 0xe8, 0x04, 0x0d, 0xff, 0xdf, 0x04, 0x13, 0x00, 0x10, 0x04, 0x15, 0x00, 0x10,
-    0x04, 0x26, 0xff, 0xe8, 0x04, 0x28, 0xff, 0xe8, 0x04, 0x2a, 0xff, 0xe8, 0x04, 0x34, 0xff, 0xe1,
-    0x04, 0x35, 0xff, 0xe0, 0x04, 0x92, 0xff, 0xe0, 0x04, 0x94, 0xff, 0xe1, 0x04, 0x95, 0xff, 0xe0,
-    0x04, 0xa1, 0xff, 0xdf, 0x00, 0x46, 0x00, 0xd2, 0xff, 0xe6, 0x00, 0xd6, 0xff, 0xe6, 0x00, 0xda,
-    0xff, 0xf2, 0x00, 0xde, 0xff, 0xee, 0x00, 0xe1, 0xff, 0xe8, 0x00, 0xe6, 0xff, 0xe6, 0x00, 0xec,
-    0xff, 0xf1, 0x00, 0xee, 0xff, 0xf1, 0x00, 0xf0, 0xff, 0xf1, 0x00, 0xf1, 0xff, 0xf1, 0x00, 0xf3,
-    0xff, 0xf1, 0x00, 0xf4, 0xff, 0xf1, 0x00, 0xf5, 0xff, 0xf1, 0x00, 0xf6, 0xff, 0xd0, 0x00, 0xf8,
-    0xff, 0xf1, 0x00, 0xfa, 0xff, 0xf1, 0x00, 0xfb, 0xff, 0xf1, 0x00, 0xfe, 0xff, 0xf1, 0x01, 0x00,
-    0xff, 0xf1, 0x01, 0x05, 0xff, 0xf1, 0x01, 0x19, 0xff, 0xe7, 0x01, 0x2b, 0xff, 0xf1, 0x01, 0x33,
-    0xff, 0xf2, 0x01, 0x34, 0xff, 0xf1, 0x01, 0x36, 0xff, 0xf1, 0x01, 0x39, 0xff, 0xe6, 0x01, 0x3a,
-    0xff, 0xce, 0x01, 0x3c, 0xff, 0xf1, 0x01, 0x3e, 0xff, 0xf1, 0x01, 0x43, 0xff, 0xf2, 0x01, 0x44,
-    0xff, 0xf1, 0x01, 0x45, 0xff, 0xe6, 0x01, 0x47, 0xff, 0xe8, 0x01, 0x49, 0xff, 0xe8, 0x01, 0x53,
-    0xff, 0xf1, 0x01, 0x55, 0xff, 0xf1, 0x01, 0x57, 0xff, 0xf1, 0x01, 0x5c, 0xff, 0xf1, 0x01, 0x5d,
-    0xff, 0xf2, 0x01, 0x5e, 0xff, 0xf1, 0x01, 0x62, 0xff, 0xe7, 0x01, 0x64, 0xff, 0xed, 0x01, 0x6c,
-    0xff, 0xe6, 0x01, 0x6d, 0xff, 0xd0, 0x03, 0xd0, 0xff, 0xee, 0x03, 0xdc, 0xff, 0xe6, 0x03, 0xdd,
-    0xff, 0xf2, 0x03, 0xe0, 0xff, 0xf1, 0x03, 0xe2, 0xff, 0xf1, 0x03, 0xe5, 0xff, 0xf1, 0x03, 0xe7,
-    0xff, 0xf1, 0x03, 0xec, 0xff, 0xf1, 0x04, 0x02, 0xff, 0xf1, 0x04, 0x05, 0xff, 0xe7, 0x04, 0x0d,
-    0xff, 0xe7, 0x04, 0x10, 0xff, 0xf2, 0x04, 0x11, 0xff, 0xf1, 0x04, 0x1e, 0xff, 0xf2, 0x04, 0x1f,
-    0xff, 0xf1, 0x04, 0x23, 0xff, 0xf1, 0x04, 0x25, 0xff, 0xf1, 0x04, 0x2e, 0xff, 0xee, 0x04, 0x30,
-    0xff, 0xee, 0x04, 0x32, 0xff, 0xee, 0x04, 0x34, 0xff, 0xe8, 0x04, 0x37, 0xff, 0xf1, 0x04, 0x92,
-    0xff, 0xe6, 0x04, 0x94, 0xff, 0xe8, 0x04, 0x97, 0xff, 0xf1, 0x04, 0xa1, 0xff, 0xe7, 0x00, 0x08,
-    0x00, 0xd9, 0x00, 0x15, 0x00, 0xed, 0x00, 0x15, 0x01, 0x49, 0xff, 0xe4, 0x01, 0x4a, 0xff, 0xe5,
-    0x01, 0x4c, 0xff, 0xe4, 0x01, 0x62, 0xff, 0xe3, 0x01, 0x64, 0xff, 0xe2, 0x01, 0x6c, 0xff, 0xe4,
-    0x00, 0x33, 0x00, 0xd2, 0xff, 0xbe, 0x00, 0xd6, 0xff, 0xbe, 0x00, 0xe6, 0xff, 0xc9, 0x00, 0xec,
-    0xff, 0xf5, 0x00, 0xf0, 0xff, 0xf5, 0x00, 0xf1, 0xff, 0xf5, 0x00, 0xf3, 0xff, 0xf5, 0x00, 0xf4,
-    0xff, 0xf5, 0x00, 0xf5, 0xff, 0xf5, 0x00, 0xf6, 0xff, 0xdf, 0x00, 0xf8, 0xff, 0xf5, 0x00, 0xfa,
-    0xff, 0xf5, 0x00, 0xfb, 0xff, 0xf5, 0x00, 0xfe, 0xff, 0xf5, 0x01, 0x00, 0xff, 0xf5, 0x01, 0x05,
-    0xff, 0xf5, 0x01, 0x09, 0xff, 0xed, 0x01, 0x1a, 0xff, 0xef, 0x01, 0x20, 0xff, 0xeb, 0x01, 0x2b,
-    0xff, 0xf5, 0x01, 0x36, 0xff, 0xf5, 0x01, 0x39, 0xff, 0xbe, 0x01, 0x3a, 0xff, 0xdf, 0x01, 0x3c,
-    0xff, 0xf5, 0x01, 0x3e, 0xff, 0xf5, 0x01, 0x45, 0xff, 0xbe, 0x01, 0x4c, 0xff, 0xe9, 0x01, 0x53,
-    0xff, 0xf5, 0x01, 0x55, 0xff, 0xf5, 0x01, 0x57, 0xff, 0xf5, 0x01, 0x5c, 0xff, 0xf5, 0x01, 0x63,
-    0xff, 0xf5, 0x01, 0x6d, 0xff, 0xe0, 0x03, 0xdc, 0xff, 0xbe, 0x03, 0xe0, 0xff, 0xf5, 0x03, 0xe2,
-    0xff, 0xf5, 0x03, 0xe4, 0xff, 0xef, 0x03, 0xe7, 0xff, 0xf5, 0x03, 0xec, 0xff, 0xf5, 0x03, 0xed,
-    0xff, 0xef, 0x04, 0x02, 0xff, 0xf5, 0x04, 0x06, 0xff, 0xef, 0x04, 0x0e, 0xff, 0xef, 0x04, 0x23,
-    0xff, 0xf5, 0x04, 0x25, 0xff, 0xf5, 0x04, 0x2f, 0xff, 0xef, 0x04, 0x31, 0xff, 0xef, 0x04, 0x33,
-    0xff, 0xef, 0x04, 0x37, 0xff, 0xf5, 0x04, 0x92, 0xff, 0xbe, 0x04, 0x97, 0xff, 0xf5, 0x00, 0x51,
-    0x00, 0x06, 0xff, 0xba, 0x00, 0x0b, 0xff, 0xba, 0x00, 0xd2, 0xff, 0x33, 0x00, 0xd6, 0xff, 0x33,
-    0x00, 0xda, 0xff, 0xf1, 0x00, 0xde, 0xff, 0xeb, 0x00, 0xe1, 0xff, 0xe5, 0x00, 0xe6, 0xff, 0xc3,
-    0x00, 0xec, 0xff, 0xee, 0x00, 0xee, 0xff, 0xd7, 0x00, 0xf0, 0xff, 0xee, 0x00, 0xf1, 0xff, 0xee,
-    0x00, 0xf3, 0xff, 0xee, 0x00, 0xf4, 0xff, 0xee, 0x00, 0xf5, 0xff, 0xee, 0x00, 0xf6, 0xff, 0xcc,
-    0x00, 0xf8, 0xff, 0xee, 0x00, 0xfa, 0xff, 0xee, 0x00, 0xfb, 0xff, 0xee, 0x00, 0xfe, 0xff, 0xee,
-    0x01, 0x00, 0xff, 0xee, 0x01, 0x05, 0xff, 0xee, 0x01, 0x19, 0xff, 0xc7, 0x01, 0x2b, 0xff, 0xee,
-    0x01, 0x33, 0xff, 0xf1, 0x01, 0x34, 0xff, 0xd7, 0x01, 0x36, 0xff, 0xee, 0x01, 0x39, 0xff, 0x33,
-    0x01, 0x3a, 0xff, 0xc9, 0x01, 0x3c, 0xff, 0xee, 0x01, 0x3e, 0xff, 0xee, 0x01, 0x43, 0xff, 0xf1,
-    0x01, 0x44, 0xff, 0xd7, 0x01, 0x45, 0xff, 0x33, 0x01, 0x47, 0xff, 0xe5, 0x01, 0x49, 0xff, 0xe5,
-    0x01, 0x4c, 0xff, 0xdf, 0x01, 0x53, 0xff, 0xee, 0x01, 0x55, 0xff, 0xee, 0x01, 0x57, 0xff, 0xee,
-    0x01, 0x5c, 0xff, 0xee, 0x01, 0x5d, 0xff, 0xf1, 0x01, 0x5e, 0xff, 0xd7, 0x01, 0x62, 0xff, 0xd0,
-    0x01, 0x64, 0xff, 0xeb, 0x01, 0x6c, 0xff, 0xa0, 0x01, 0x6d, 0xff, 0xcd, 0x01, 0x84, 0xff, 0xba,
-    0x01, 0x85, 0xff, 0xba, 0x01, 0x87, 0xff, 0xba, 0x01, 0x88, 0xff, 0xba, 0x01, 0x89, 0xff, 0xba,
-    0x03, 0xd0, 0xff, 0xeb, 0x03, 0xdc, 0xff, 0x33, 0x03, 0xdd, 0xff, 0xf1, 0x03, 0xe0, 0xff, 0xee,
-    0x03, 0xe2, 0xff, 0xee, 0x03, 0xe5, 0xff, 0xd7, 0x03, 0xe7, 0xff, 0xee, 0x03, 0xec, 0xff, 0xee,
-    0x03, 0xf6, 0xff, 0xba, 0x03, 0xf7, 0xff, 0xba, 0x03, 0xfa, 0xff, 0xba, 0x04, 0x02, 0xff, 0xee,
-    0x04, 0x05, 0xff, 0xc7, 0x04, 0x0d, 0xff, 0xab, 0x04, 0x10, 0xff, 0xf1, 0x04, 0x11, 0xff, 0xd7,
-    0x04, 0x1e, 0xff, 0xf1, 0x04, 0x1f, 0xff, 0xd7, 0x04, 0x23, 0xff, 0xee, 0x04, 0x25, 0xff, 0xee,
-    0x04, 0x2e, 0xff, 0xeb, 0x04, 0x30, 0xff, 0xeb, 0x04, 0x32, 0xff, 0xeb, 0x04, 0x34, 0xff, 0xe5,
-    0x04, 0x37, 0xff, 0xee, 0x04, 0x92, 0xff, 0x33, 0x04, 0x94, 0xff, 0xe5, 0x04, 0x97, 0xff, 0xee,
-    0x04, 0xa1, 0xff, 0xab, 0x00, 0x45, 0x00, 0xd2, 0xff, 0x33, 0x00, 0xd4, 0xff, 0xf5, 0x00, 0xd6,
-    0xff, 0x33, 0x00, 0xda, 0xff, 0xf0, 0x00, 0xdd, 0xff, 0xf5, 0x00, 0xde, 0xff, 0xeb, 0x00, 0xe1,
-    0xff, 0xe6, 0x00, 0xe6, 0xff, 0xc2, 0x00, 0xec, 0xff, 0xef, 0x00, 0xf0, 0xff, 0xef, 0x00, 0xf1,
-    0xff, 0xef, 0x00, 0xf3, 0xff, 0xef, 0x00, 0xf4, 0xff, 0xef, 0x00, 0xf5, 0xff, 0xef, 0x00, 0xf6,
-    0xff, 0xce, 0x00, 0xf8, 0xff, 0xef, 0x00, 0xfa, 0xff, 0xef, 0x00, 0xfb, 0xff, 0xef, 0x00, 0xfe,
-    0xff, 0xef, 0x01, 0x00, 0xff, 0xef, 0x01, 0x05, 0xff, 0xef, 0x01, 0x19, 0xff, 0xc8, 0x01, 0x2b,
-    0xff, 0xef, 0x01, 0x33, 0xff, 0xf0, 0x01, 0x36, 0xff, 0xef, 0x01, 0x39, 0xff, 0x33, 0x01, 0x3a,
-    0xff, 0xcd, 0x01, 0x3c, 0xff, 0xef, 0x01, 0x3e, 0xff, 0xef, 0x01, 0x43, 0xff, 0xf0, 0x01, 0x45,
-    0xff, 0x33, 0x01, 0x47, 0xff, 0xe6, 0x01, 0x49, 0xff, 0xe6, 0x01, 0x4c, 0xff, 0xdf, 0x01, 0x50,
-    0xff, 0xf5, 0x01, 0x53, 0xff, 0xef, 0x01, 0x55, 0xff, 0xef, 0x01, 0x57, 0xff, 0xef, 0x01, 0x5c,
-    0xff, 0xef, 0x01, 0x5d, 0xff, 0xf0, 0x01, 0x62, 0xff, 0xd0, 0x01, 0x64, 0xff, 0xeb, 0x01, 0x66,
-    0xff, 0xf5, 0x01, 0x6c, 0xff, 0x9f, 0x01, 0x6d, 0xff, 0xd0, 0x01, 0x6f, 0xff, 0xf5, 0x03, 0xd0,
-    0xff, 0xeb, 0x03, 0xdc, 0xff, 0x33, 0x03, 0xdd, 0xff, 0xf0, 0x03, 0xe0, 0xff, 0xef, 0x03, 0xe2,
-    0xff, 0xef, 0x03, 0xe7, 0xff, 0xef, 0x03, 0xec, 0xff, 0xef, 0x04, 0x02, 0xff, 0xef, 0x04, 0x05,
-    0xff, 0xc8, 0x04, 0x0d, 0xff, 0xac, 0x04, 0x10, 0xff, 0xf0, 0x04, 0x1e, 0xff, 0xf0, 0x04, 0x23,
-    0xff, 0xef, 0x04, 0x25, 0xff, 0xef, 0x04, 0x2e, 0xff, 0xeb, 0x04, 0x30, 0xff, 0xeb, 0x04, 0x32,
-    0xff, 0xeb, 0x04, 0x34, 0xff, 0xe6, 0x04, 0x37, 0xff, 0xef, 0x04, 0x92, 0xff, 0x33, 0x04, 0x94,
-    0xff, 0xe6, 0x04, 0x97, 0xff, 0xef, 0x04, 0xa1, 0xff, 0xac, 0x00, 0x5b, 0x00, 0x06, 0xff, 0xca,
-    0x00, 0x0b, 0xff, 0xca, 0x00, 0xd2, 0xff, 0xd2, 0x00, 0xd6, 0xff, 0xd2, 0x00, 0xda, 0xff, 0xf4,
-    0x00, 0xde, 0xff, 0xed, 0x00, 0xe1, 0xff, 0xe1, 0x00, 0xe6, 0xff, 0xd4, 0x00, 0xec, 0xff, 0xe2,
-    0x00, 0xee, 0xff, 0xef, 0x00, 0xf0, 0xff, 0xe2, 0x00, 0xf1, 0xff, 0xe2, 0x00, 0xf3, 0xff, 0xe2,
-    0x00, 0xf4, 0xff, 0xe2, 0x00, 0xf5, 0xff, 0xe2, 0x00, 0xf6, 0xff, 0xc9, 0x00, 0xf8, 0xff, 0xe2,
-    0x00, 0xfa, 0xff, 0xe2, 0x00, 0xfb, 0xff, 0xe2, 0x00, 0xfe, 0xff, 0xd1, 0x01, 0x00, 0xff, 0xe2,
-    0x01, 0x05, 0xff, 0xe2, 0x01, 0x09, 0xff, 0xe5, 0x01, 0x19, 0xff, 0xd4, 0x01, 0x1a, 0xff, 0xe6,
-    0x01, 0x20, 0xff, 0xe3, 0x01, 0x2b, 0xff, 0xe2, 0x01, 0x33, 0xff, 0xf4, 0x01, 0x34, 0xff, 0xef,
-    0x01, 0x36, 0xff, 0xe2, 0x01, 0x39, 0xff, 0xd2, 0x01, 0x3a, 0xff, 0xc4, 0x01, 0x3c, 0xff, 0xe2,
-    0x01, 0x3e, 0xff, 0xe2, 0x01, 0x43, 0xff, 0xf4, 0x01, 0x44, 0xff, 0xef, 0x01, 0x45, 0xff, 0xd2,
-    0x01, 0x47, 0xff, 0xe1, 0x01, 0x49, 0xff, 0xe1, 0x01, 0x53, 0xff, 0xe2, 0x01, 0x55, 0xff, 0xe2,
-    0x01, 0x57, 0xff, 0xe2, 0x01, 0x5c, 0xff, 0xe2, 0x01, 0x5d, 0xff, 0xf4, 0x01, 0x5e, 0xff, 0xef,
-    0x01, 0x62, 0xff, 0xd4, 0x01, 0x63, 0xff, 0xf5, 0x01, 0x64, 0xff, 0xe7, 0x01, 0x6c, 0xff, 0xaa,
-    0x01, 0x6d, 0xff, 0xc9, 0x01, 0x84, 0xff, 0xca, 0x01, 0x85, 0xff, 0xca, 0x01, 0x87, 0xff, 0xca,
-    0x01, 0x88, 0xff, 0xca, 0x01, 0x89, 0xff, 0xca, 0x03, 0xd0, 0xff, 0xed, 0x03, 0xdc, 0xff, 0xd2,
-    0x03, 0xdd, 0xff, 0xf4, 0x03, 0xe0, 0xff, 0xe2, 0x03, 0xe2, 0xff, 0xe2, 0x03, 0xe4, 0xff, 0xe6,
-    0x03, 0xe5, 0xff, 0xef, 0x03, 0xe7, 0xff, 0xe2, 0x03, 0xec, 0xff, 0xe2, 0x03, 0xed, 0xff, 0xe6,
-    0x03, 0xf6, 0xff, 0xca, 0x03, 0xf7, 0xff, 0xca, 0x03, 0xfa, 0xff, 0xca, 0x04, 0x02, 0xff, 0xe2,
-    0x04, 0x05, 0xff, 0xd4, 0x04, 0x06, 0xff, 0xe6, 0x04, 0x0d, 0xff, 0xd3, 0x04, 0x0e, 0xff, 0xe6,
-    0x04, 0x10, 0xff, 0xf4, 0x04, 0x11, 0xff, 0xef, 0x04, 0x1e, 0xff, 0xf4, 0x04, 0x1f, 0xff, 0xef,
-    0x04, 0x23, 0xff, 0xe2, 0x04, 0x25, 0xff, 0xe2, 0x04, 0x2e, 0xff, 0xed, 0x04, 0x2f, 0xff, 0xe6,
-    0x04, 0x30, 0xff, 0xed, 0x04, 0x31, 0xff, 0xe6, 0x04, 0x32, 0xff, 0xed, 0x04, 0x33, 0xff, 0xe6,
-    0x04, 0x34, 0xff, 0xe1, 0x04, 0x37, 0xff, 0xe2, 0x04, 0x92, 0xff, 0xd2, 0x04, 0x94, 0xff, 0xe1,
-    0x04, 0x97, 0xff, 0xe2, 0x04, 0xa1, 0xff, 0xd3, 0x00, 0x0d, 0x00, 0xd9, 0x00, 0x13, 0x00, 0xe6,
-    0xff, 0xc5, 0x00, 0xf6, 0xff, 0xca, 0x01, 0x3a, 0xff, 0x94, 0x01, 0x49, 0xff, 0x58, 0x01, 0x4a,
-    0xff, 0x7f, 0x01, 0x4c, 0xff, 0xa5, 0x01, 0x4d, 0xff, 0xdd, 0x01, 0x58, 0xff, 0xf2, 0x01, 0x62,
-    0xff, 0x8b, 0x01, 0x64, 0xff, 0xca, 0x01, 0x6c, 0xff, 0x70, 0x01, 0x6d, 0xff, 0xa2, 0x00, 0x09,
-    0x00, 0xf6, 0x00, 0x00, 0x01, 0x1a, 0x00, 0x00, 0x03, 0xe4, 0x00, 0x00, 0x03, 0xed, 0x00, 0x00,
-    0x04, 0x06, 0x00, 0x00, 0x04, 0x0e, 0x00, 0x00, 0x04, 0x2f, 0x00, 0x00, 0x04, 0x31, 0x00, 0x00,
-    0x04, 0x33, 0x00, 0x00, 0x00, 0x03, 0x00, 0xd9, 0x00, 0x00, 0x00, 0xe6, 0x00, 0x00, 0x01, 0x6c,
-    0x00, 0x00, 0x00, 0x01, 0x03, 0xcd, 0xff, 0xec, 0x00, 0x01, 0x03, 0xcd, 0xff, 0xee, 0x00, 0x04,
-    0x01, 0x19, 0x00, 0x14, 0x04, 0x05, 0x00, 0x14, 0x04, 0x0d, 0x00, 0x16, 0x04, 0xa1, 0x00, 0x16,
-    0x00, 0x06, 0x00, 0xd2, 0xff, 0xd1, 0x00, 0xd6, 0xff, 0xd1, 0x01, 0x39, 0xff, 0xd1, 0x01, 0x45,
-    0xff, 0xd1, 0x03, 0xdc, 0xff, 0xd1, 0x04, 0x92, 0xff, 0xd1, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x08, 0x00, 0x01, 0x00, 0x0a, 0x00, 0x05, 0x00, 0x24, 0x00, 0x48, 0x00, 0x01, 0x00, 0xfa,
-    0x00, 0x08, 0x00, 0x0a, 0x00, 0x14, 0x00, 0x15, 0x00, 0x16, 0x00, 0x17, 0x00, 0x18, 0x00, 0x19,
-    0x00, 0x1a, 0x00, 0x1b, 0x00, 0x1c, 0x00, 0x1d, 0x00, 0x25, 0x00, 0x26, 0x00, 0x27, 0x00, 0x28,
-    0x00, 0x29, 0x00, 0x2a, 0x00, 0x2b, 0x00, 0x2c, 0x00, 0x2d, 0x00, 0x2e, 0x00, 0x2f, 0x00, 0x30,
-    0x00, 0x31, 0x00, 0x32, 0x00, 0x33, 0x00, 0x34, 0x00, 0x35, 0x00, 0x36, 0x00, 0x37, 0x00, 0x38,
-    0x00, 0x39, 0x00, 0x3a, 0x00, 0x3b, 0x00, 0x3c, 0x00, 0x3d, 0x00, 0x3e, 0x00, 0x65, 0x00, 0x67,
-    0x00, 0x81, 0x00, 0x83, 0x00, 0x84, 0x00, 0x8c, 0x00, 0x8f, 0x00, 0x91, 0x00, 0x93, 0x00, 0xb1,
-    0x00, 0xb2, 0x00, 0xb3, 0x00, 0xb4, 0x00, 0xb5, 0x00, 0xb6, 0x00, 0xb7, 0x00, 0xb8, 0x00, 0xb9,
-    0x00, 0xba, 0x00, 0xd2, 0x00, 0xd3, 0x00, 0xd4, 0x00, 0xd5, 0x00, 0xd6, 0x00, 0xd7, 0x00, 0xd8,
-    0x00, 0xd9, 0x00, 0xda, 0x00, 0xdb, 0x00, 0xdc, 0x00, 0xdd, 0x00, 0xde, 0x00, 0xdf, 0x00, 0xe0,
-    0x00, 0xe1, 0x00, 0xe2, 0x00, 0xe3, 0x00, 0xe4, 0x00, 0xe5, 0x00, 0xe6, 0x00, 0xe7, 0x00, 0xe8,
-    0x00, 0xe9, 0x01, 0x2f, 0x01, 0x33, 0x01, 0x35, 0x01, 0x37, 0x01, 0x39, 0x01, 0x3b, 0x01, 0x41,
-    0x01, 0x43, 0x01, 0x45, 0x01, 0x49, 0x01, 0x4b, 0x01, 0x4c, 0x01, 0x58, 0x01, 0x59, 0x01, 0xb1,
-    0x01, 0xb7, 0x01, 0xbc, 0x01, 0xbf, 0x02, 0x95, 0x02, 0x96, 0x02, 0x98, 0x02, 0x9a, 0x02, 0x9b,
-    0x02, 0x9c, 0x02, 0x9d, 0x02, 0x9e, 0x02, 0x9f, 0x02, 0xa0, 0x02, 0xa1, 0x02, 0xa2, 0x02, 0xa3,
-    0x02, 0xa4, 0x02, 0xa5, 0x02, 0xa6, 0x02, 0xa7, 0x02, 0xa8, 0x02, 0xa9, 0x02, 0xaa, 0x02, 0xab,
-    0x02, 0xac, 0x02, 0xad, 0x02, 0xae, 0x02, 0xaf, 0x02, 0xb0, 0x02, 0xb1, 0x02, 0xb2, 0x02, 0xb3,
-    0x02, 0xb4, 0x02, 0xd1, 0x02, 0xd3, 0x02, 0xd5, 0x02, 0xd7, 0x02, 0xd9, 0x02, 0xdb, 0x02, 0xdd,
-    0x02, 0xdf, 0x02, 0xe1, 0x02, 0xe3, 0x02, 0xe5, 0x02, 0xe7, 0x02, 0xe9, 0x02, 0xeb, 0x02, 0xed,
-    0x02, 0xef, 0x02, 0xf1, 0x02, 0xf3, 0x02, 0xf5, 0x02, 0xf7, 0x02, 0xf9, 0x02, 0xfb, 0x02, 0xfd,
-    0x02, 0xfe, 0x03, 0x00, 0x03, 0x02, 0x03, 0x04, 0x03, 0x06, 0x03, 0x08, 0x03, 0x0a, 0x03, 0x0c,
-    0x03, 0x0e, 0x03, 0x10, 0x03, 0x13, 0x03, 0x15, 0x03, 0x17, 0x03, 0x19, 0x03, 0x1b, 0x03, 0x1d,
-    0x03, 0x1f, 0x03, 0x21, 0x03, 0x23, 0x03, 0x25, 0x03, 0x27, 0x03, 0x29, 0x03, 0x2b, 0x03, 0x2d,
-    0x03, 0x2f, 0x03, 0x31, 0x03, 0x33, 0x03, 0x35, 0x03, 0x37, 0x03, 0x39, 0x03, 0x3b, 0x03, 0x3d,
-    0x03, 0x3f, 0x03, 0x40, 0x03, 0x42, 0x03, 0x44, 0x03, 0x46, 0x03, 0x48, 0x03, 0xa1, 0x03, 0xa2,
-    0x03, 0xa3, 0x03, 0xa4, 0x03, 0xa5, 0x03, 0xa6, 0x03, 0xa7, 0x03, 0xa9, 0x03, 0xaa, 0x03, 0xab,
-    0x03, 0xac, 0x03, 0xad, 0x03, 0xae, 0x03, 0xaf, 0x03, 0xb0, 0x03, 0xb1, 0x03, 0xb2, 0x03, 0xb3,
-    0x03, 0xb4, 0x03, 0xb5, 0x03, 0xb6, 0x03, 0xb7, 0x03, 0xb8, 0x03, 0xc8, 0x03, 0xc9, 0x03, 0xca,
-    0x03, 0xcb, 0x03, 0xcc, 0x03, 0xcd, 0x03, 0xce, 0x03, 0xcf, 0x03, 0xd0, 0x03, 0xd1, 0x03, 0xd2,
-    0x03, 0xd3, 0x03, 0xd4, 0x03, 0xd5, 0x03, 0xd6, 0x03, 0xd7, 0x03, 0xd8, 0x03, 0xd9, 0x03, 0xda,
-    0x03, 0xdb, 0x03, 0xdc, 0x03, 0xdd, 0x03, 0xee, 0x03, 0xf0, 0x03, 0xf2, 0x03, 0xf4, 0x04, 0x09,
-    0x04, 0x0b, 0x04, 0x0d, 0x04, 0x22, 0x04, 0x28, 0x04, 0x2e, 0x04, 0x98, 0x04, 0x9d, 0x04, 0xa1,
-    0x05, 0x22, 0x05, 0x24, 0x00, 0x06, 0x00, 0x64, 0x00, 0x00, 0x03, 0x28, 0x05, 0xb0, 0x00, 0x03,
-    0x00, 0x07, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x17, 0x00, 0x00, 0x41, 0x15, 0x21, 0x35,
-    0x33, 0x11, 0x23, 0x11, 0x21, 0x11, 0x23, 0x11, 0x13, 0x15, 0x21, 0x35, 0x01, 0x01, 0x23, 0x01,
-    0x11, 0x01, 0x33, 0x01, 0x03, 0x09, 0xfd, 0x76, 0x1b, 0x36, 0x02, 0xc4, 0x36, 0x17, 0xfd, 0x76,
-    0x02, 0x8a, 0xfd, 0xaf, 0x3a, 0x02, 0x51, 0xfd, 0xaf, 0x3a, 0x02, 0x51, 0x05, 0xb0, 0x36, 0x36,
-    0xfa, 0x50, 0x05, 0xb0, 0xfa, 0x50, 0x05, 0xb0, 0xfa, 0x86, 0x36, 0x36, 0x05, 0x5c, 0xfa, 0x8c,
-    0x05, 0x74, 0xfa, 0x8c, 0x05, 0x74, 0xfa, 0x8c, 0x00, 0x02, 0x00, 0x8c, 0xff, 0xf2, 0x01, 0xa0,
-    0x05, 0xb0, 0x00, 0x03, 0x00, 0x0f, 0x00, 0x13, 0x40, 0x09, 0x02, 0x02, 0x07, 0x0d, 0x0b, 0x72,
-    0x00, 0x02, 0x72, 0x00, 0x2b, 0x2b, 0xdd, 0xce, 0x2f, 0x30, 0x31, 0x41, 0x03, 0x23, 0x03, 0x03,
-    0x34, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14, 0x06, 0x23, 0x22, 0x26, 0x01, 0x92, 0x18, 0xce, 0x19,
-    0x07, 0x49, 0x41, 0x40, 0x4a, 0x4a, 0x40, 0x41, 0x49, 0x05, 0xb0, 0xfb, 0xfd, 0x04, 0x03, 0xfa,
-    0xc2, 0x37, 0x4b, 0x4b, 0x37, 0x35, 0x4b, 0x4b, 0x00, 0x02, 0x00, 0x60, 0x03, 0xf8, 0x02, 0x3a,
-    0x06, 0x00, 0x00, 0x05, 0x00, 0x0b, 0x00, 0x0c, 0xb3, 0x09, 0x03, 0x0b, 0x05, 0x00, 0x2f, 0x33,
-    0xcd, 0x32, 0x30, 0x31, 0x41, 0x15, 0x03, 0x23, 0x11, 0x35, 0x21, 0x15, 0x03, 0x23, 0x11, 0x35,
-    0x01, 0x0e, 0x23, 0x8b, 0x01, 0xda, 0x23, 0x8b, 0x06, 0x00, 0x89, 0xfe, 0x81, 0x01, 0x74, 0x94,
-    0x89, 0xfe, 0x81, 0x01, 0x7c, 0x8c, 0x00, 0x04, 0x00, 0x56, 0x00, 0x00, 0x04, 0xb2, 0x05, 0xb0,
-    0x00, 0x03, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x23, 0x40, 0x11, 0x04, 0x00, 0x05, 0x0d,
-    0x0e, 0x0e, 0x00, 0x0a, 0x09, 0x09, 0x00, 0x02, 0x02, 0x72, 0x00, 0x12, 0x72, 0x00, 0x2b, 0x2b,
-    0x11, 0x39, 0x2f, 0x33, 0x11, 0x39, 0x2f, 0x33, 0x32, 0x11, 0x33, 0x30, 0x31, 0x73, 0x01, 0x33,
-    0x01, 0x33, 0x01, 0x33, 0x01, 0x01, 0x21, 0x35, 0x21, 0x03, 0x21, 0x35, 0x21, 0xf4, 0x01, 0x0c,
-    0xa4, 0xfe, 0xf4, 0xe2, 0x01, 0x0c, 0xa4, 0xfe, 0xf4, 0x01, 0x94, 0xfb, 0xf0, 0x04, 0x10, 0x4b,
-    0xfb, 0xef, 0x04, 0x11, 0x05, 0xb0, 0xfa, 0x50, 0x05, 0xb0, 0xfa, 0x50, 0x03, 0x75, 0x9b, 0xfd,
-    0x8a, 0x9b, 0x00, 0x03, 0x00, 0x64, 0xff, 0x2c, 0x04, 0x27, 0x06, 0x99, 0x00, 0x03, 0x00, 0x07,
-    0x00, 0x3d, 0x00, 0x36, 0x40, 0x1c, 0x04, 0x07, 0x3a, 0x3a, 0x08, 0x2b, 0x10, 0x23, 0x04, 0x14,
-    0x2f, 0x35, 0x35, 0x06, 0x2f, 0x0d, 0x72, 0x01, 0x02, 0x1f, 0x1f, 0x14, 0x1a, 0x1a, 0x03, 0x14,
-    0x05, 0x72, 0x00, 0x2b, 0xcd, 0x33, 0x2f, 0x11, 0x33, 0x12, 0x39, 0x39, 0x2b, 0xcd, 0x33, 0x2f,
-    0x11, 0x12, 0x17, 0x39, 0x33, 0x12, 0x39, 0x39, 0x30, 0x31, 0x41, 0x11, 0x23, 0x11, 0x13, 0x11,
-    0x23, 0x11, 0x01, 0x34, 0x26, 0x26, 0x27, 0x2e, 0x02, 0x35, 0x34, 0x36, 0x36, 0x33, 0x32, 0x1e,
-    0x02, 0x15, 0x23, 0x34, 0x2e, 0x02, 0x23, 0x22, 0x06, 0x06, 0x15, 0x14, 0x16, 0x16, 0x17, 0x1e,
-    0x02, 0x15, 0x14, 0x06, 0x06, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x33, 0x14, 0x1e, 0x02, 0x33, 0x32,
-    0x36, 0x36, 0x02, 0xb1, 0x9a, 0x87, 0x99, 0x01, 0x30, 0x2f, 0x6a, 0x59, 0x80, 0xbf, 0x69, 0x71,
-    0xca, 0x87, 0x68, 0xa7, 0x76, 0x3f, 0xf0, 0x1d, 0x38, 0x4f, 0x32, 0x47, 0x5c, 0x2b, 0x2c, 0x6b,
-    0x5e, 0x81, 0xbd, 0x67, 0x77, 0xd5, 0x8d, 0x59, 0xaf, 0x8e, 0x54, 0xf2, 0x2a, 0x48, 0x59, 0x2d,
-    0x4b, 0x67, 0x35, 0x06, 0x99, 0xfe, 0xd5, 0x01, 0x2b, 0xf9, 0x9f, 0xfe, 0xf4, 0x01, 0x0c, 0x01,
-    0x43, 0x3a, 0x57, 0x47, 0x1f, 0x2d, 0x71, 0xa7, 0x7d, 0x7b, 0xb4, 0x62, 0x3e, 0x78, 0xaf, 0x71,
-    0x40, 0x65, 0x47, 0x26, 0x35, 0x5c, 0x3b, 0x39, 0x56, 0x45, 0x23, 0x2e, 0x71, 0xa5, 0x7d, 0x81,
-    0xb4, 0x5d, 0x2f, 0x6c, 0xb3, 0x82, 0x4e, 0x68, 0x3c, 0x1a, 0x33, 0x5d, 0x00, 0x05, 0x00, 0x64,
-    0xff, 0xeb, 0x05, 0x8a, 0x05, 0xc5, 0x00, 0x11, 0x00, 0x23, 0x00, 0x35, 0x00, 0x47, 0x00, 0x4b,
-    0x00, 0x23, 0x40, 0x11, 0x49, 0x32, 0x4b, 0x05, 0x3b, 0x44, 0x29, 0x32, 0x17, 0x0e, 0x20, 0x05,
-    0x05, 0x72, 0x32, 0x0d, 0x72, 0x00, 0x2b, 0x2b, 0x32, 0xc4, 0x32, 0x10, 0xc4, 0x32, 0x33, 0x11,
-    0x33, 0x11, 0x33, 0x30, 0x31, 0x53, 0x35, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x16, 0x15, 0x15,
-    0x14, 0x06, 0x06, 0x23, 0x22, 0x26, 0x26, 0x37, 0x15, 0x14, 0x16, 0x16, 0x33, 0x32, 0x36, 0x36,
-    0x35, 0x35, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x01, 0x35, 0x34, 0x36, 0x36, 0x33, 0x32,
-    0x16, 0x16, 0x15, 0x15, 0x14, 0x06, 0x06, 0x23, 0x22, 0x26, 0x26, 0x37, 0x15, 0x14, 0x16, 0x16,
-    0x33, 0x32, 0x36, 0x36, 0x35, 0x35, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x13, 0x01, 0x27,
-    0x01, 0x64, 0x48, 0x8a, 0x61, 0x64, 0x89, 0x48, 0x47, 0x89, 0x63, 0x62, 0x8b, 0x48, 0xa7, 0x1f,
-    0x40, 0x2f, 0x30, 0x3d, 0x1e, 0x1f, 0x3e, 0x30, 0x2e, 0x3f, 0x1f, 0x02, 0x17, 0x49, 0x8a, 0x61,
-    0x64, 0x89, 0x47, 0x47, 0x88, 0x63, 0x62, 0x8b, 0x49, 0xa8, 0x21, 0x40, 0x2d, 0x33, 0x3e, 0x1b,
-    0x1f, 0x3f, 0x30, 0x2f, 0x3e, 0x1f, 0xc8, 0xfd, 0x39, 0x7b, 0x02, 0xc7, 0x04, 0x4b, 0x4d, 0x53,
-    0x88, 0x52, 0x52, 0x88, 0x53, 0x4d, 0x51, 0x88, 0x52, 0x52, 0x88, 0x9e, 0x4d, 0x28, 0x48, 0x2c,
-    0x2c, 0x48, 0x28, 0x4d, 0x29, 0x49, 0x2c, 0x2c, 0x49, 0xfc, 0x56, 0x4e, 0x52, 0x88, 0x52, 0x52,
-    0x88, 0x52, 0x4e, 0x52, 0x88, 0x52, 0x52, 0x88, 0xa0, 0x4e, 0x28, 0x48, 0x2d, 0x2d, 0x47, 0x29,
-    0x4e, 0x29, 0x48, 0x2c, 0x2c, 0x48, 0x03, 0x52, 0xfb, 0x8e, 0x47, 0x04, 0x72, 0x00, 0x00, 0x01,
-    0x00, 0x55, 0xff, 0xec, 0x05, 0x10, 0x05, 0xc4, 0x00, 0x42, 0x00, 0x24, 0x40, 0x14, 0x23, 0x12,
-    0x00, 0x0f, 0x22, 0x01, 0x06, 0x1a, 0x30, 0x30, 0x2b, 0x11, 0x11, 0x3b, 0x13, 0x72, 0x07, 0x1a,
-    0x03, 0x72, 0x00, 0x2b, 0x32, 0x2b, 0x32, 0x2f, 0x32, 0x32, 0x2f, 0x11, 0x17, 0x39, 0x30, 0x31,
-    0x41, 0x37, 0x36, 0x36, 0x35, 0x34, 0x26, 0x23, 0x22, 0x06, 0x06, 0x15, 0x14, 0x16, 0x16, 0x17,
-    0x01, 0x21, 0x01, 0x2e, 0x02, 0x35, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x16, 0x15, 0x14, 0x06,
-    0x06, 0x07, 0x05, 0x0e, 0x02, 0x15, 0x14, 0x16, 0x16, 0x33, 0x32, 0x3e, 0x02, 0x35, 0x33, 0x14,
-    0x06, 0x06, 0x07, 0x06, 0x06, 0x07, 0x06, 0x06, 0x23, 0x22, 0x26, 0x26, 0x35, 0x34, 0x36, 0x36,
-    0x01, 0x75, 0xfb, 0x3f, 0x36, 0x50, 0x49, 0x33, 0x46, 0x23, 0x2e, 0x50, 0x32, 0x02, 0xb0, 0xfe,
-    0xe9, 0xfd, 0xce, 0x49, 0x70, 0x3e, 0x5e, 0xac, 0x73, 0x6f, 0xa1, 0x57, 0x32, 0x58, 0x3a, 0xfe,
-    0xcf, 0x35, 0x33, 0x10, 0x37, 0x6b, 0x4d, 0x53, 0x9c, 0x7c, 0x49, 0xd0, 0x29, 0x59, 0x48, 0x07,
-    0x11, 0x08, 0x56, 0xd5, 0x78, 0x91, 0xd4, 0x73, 0x4a, 0x81, 0x03, 0x18, 0xa9, 0x2a, 0x51, 0x3d,
-    0x34, 0x58, 0x2f, 0x4d, 0x2f, 0x2d, 0x5f, 0x67, 0x3b, 0xfc, 0xd4, 0x02, 0x95, 0x58, 0x93, 0x8b,
-    0x4a, 0x72, 0xa4, 0x59, 0x59, 0x92, 0x57, 0x45, 0x72, 0x5e, 0x2a, 0xde, 0x2b, 0x4f, 0x42, 0x19,
-    0x40, 0x68, 0x3d, 0x4b, 0x8a, 0xc0, 0x75, 0x6a, 0xbe, 0xa2, 0x40, 0x07, 0x15, 0x07, 0x4f, 0x4d,
-    0x6a, 0xba, 0x78, 0x59, 0x87, 0x75, 0x00, 0x01, 0x00, 0x52, 0x03, 0xfe, 0x01, 0x09, 0x06, 0x00,
-    0x00, 0x05, 0x00, 0x08, 0xb1, 0x03, 0x05, 0x00, 0x2f, 0xc6, 0x30, 0x31, 0x41, 0x15, 0x03, 0x23,
-    0x13, 0x35, 0x01, 0x09, 0x1a, 0x9d, 0x01, 0x06, 0x00, 0x81, 0xfe, 0x7f, 0x01, 0x71, 0x91, 0x00,
-    0x00, 0x01, 0x00, 0x81, 0xfe, 0x31, 0x02, 0x9e, 0x06, 0x5d, 0x00, 0x17, 0x00, 0x08, 0xb1, 0x06,
-    0x13, 0x00, 0x2f, 0x2f, 0x30, 0x31, 0x53, 0x35, 0x34, 0x12, 0x12, 0x36, 0x37, 0x17, 0x0e, 0x02,
-    0x02, 0x15, 0x15, 0x14, 0x12, 0x16, 0x16, 0x17, 0x07, 0x26, 0x26, 0x02, 0x02, 0x81, 0x5d, 0x96,
-    0xab, 0x4f, 0x30, 0x3a, 0x73, 0x5f, 0x39, 0x39, 0x5f, 0x73, 0x3a, 0x30, 0x4f, 0xab, 0x96, 0x5d,
-    0x02, 0x3f, 0x11, 0xd6, 0x01, 0x5d, 0x01, 0x07, 0xad, 0x26, 0x8a, 0x2b, 0x98, 0xdd, 0xfe, 0xd9,
-    0xba, 0x15, 0xba, 0xfe, 0xd9, 0xde, 0x9b, 0x2e, 0x84, 0x27, 0xad, 0x01, 0x07, 0x01, 0x5d, 0x00,
-    0x00, 0x01, 0x00, 0x27, 0xfe, 0x31, 0x02, 0x4d, 0x06, 0x5d, 0x00, 0x17, 0x00, 0x08, 0xb1, 0x13,
-    0x06, 0x00, 0x2f, 0x2f, 0x30, 0x31, 0x41, 0x15, 0x14, 0x02, 0x02, 0x06, 0x07, 0x27, 0x3e, 0x02,
-    0x12, 0x35, 0x35, 0x34, 0x02, 0x26, 0x26, 0x27, 0x37, 0x16, 0x16, 0x12, 0x12, 0x02, 0x4d, 0x5f,
-    0x97, 0xaf, 0x50, 0x31, 0x3a, 0x73, 0x5f, 0x39, 0x3b, 0x62, 0x72, 0x36, 0x31, 0x50, 0xaf, 0x97,
-    0x5f, 0x02, 0x50, 0x11, 0xd3, 0xfe, 0xa4, 0xfe, 0xf8, 0xb0, 0x27, 0x84, 0x2c, 0x99, 0xe1, 0x01,
-    0x28, 0xba, 0x15, 0xba, 0x01, 0x29, 0xdf, 0x9a, 0x2b, 0x84, 0x26, 0xb0, 0xfe, 0xf7, 0xfe, 0xa4,
-    0x00, 0x01, 0x00, 0x1c, 0x02, 0x50, 0x03, 0x79, 0x05, 0xb1, 0x00, 0x0e, 0x00, 0x14, 0x40, 0x0a,
-    0x0d, 0x01, 0x07, 0x04, 0x04, 0x0e, 0x0c, 0x06, 0x02, 0x72, 0x00, 0x2b, 0xc4, 0x32, 0x17, 0x39,
-    0x30, 0x31, 0x53, 0x13, 0x25, 0x37, 0x05, 0x03, 0x33, 0x03, 0x25, 0x17, 0x05, 0x13, 0x07, 0x03,
-    0x03, 0x80, 0xd2, 0xfe, 0xca, 0x35, 0x01, 0x34, 0x0e, 0xae, 0x10, 0x01, 0x2f, 0x35, 0xfe, 0xc4,
-    0xcd, 0x8d, 0xb9, 0xb6, 0x02, 0xbb, 0x01, 0x13, 0x5a, 0xa4, 0x76, 0x01, 0x5b, 0xfe, 0x9e, 0x76,
-    0xa7, 0x5b, 0xfe, 0xf3, 0x66, 0x01, 0x22, 0xfe, 0xe6, 0x00, 0x00, 0x02, 0x00, 0x42, 0x00, 0x92,
-    0x04, 0x28, 0x04, 0xb6, 0x00, 0x03, 0x00, 0x07, 0x00, 0x10, 0xb5, 0x07, 0x07, 0x03, 0x03, 0x06,
-    0x02, 0x00, 0x2f, 0xc6, 0x33, 0x10, 0xc6, 0x2f, 0x30, 0x31, 0x41, 0x15, 0x21, 0x35, 0x01, 0x11,
-    0x23, 0x11, 0x04, 0x28, 0xfc, 0x1a, 0x02, 0x68, 0xe9, 0x03, 0x1e, 0xd9, 0xd9, 0x01, 0x98, 0xfb,
-    0xdc, 0x04, 0x24, 0x00, 0x00, 0x01, 0x00, 0x22, 0xfe, 0xb8, 0x01, 0x5e, 0x00, 0xe8, 0x00, 0x0a,
-    0x00, 0x08, 0xb1, 0x04, 0x00, 0x00, 0x2f, 0xcd, 0x30, 0x31, 0x65, 0x07, 0x14, 0x06, 0x07, 0x27,
-    0x3e, 0x02, 0x35, 0x35, 0x01, 0x5e, 0x01, 0x66, 0x54, 0x81, 0x1c, 0x2e, 0x1c, 0xe8, 0xac, 0x66,
-    0xd8, 0x46, 0x4b, 0x2d, 0x5c, 0x68, 0x3f, 0xb5, 0x00, 0x01, 0x00, 0x50, 0x02, 0x0e, 0x02, 0x61,
-    0x02, 0xce, 0x00, 0x03, 0x00, 0x08, 0xb1, 0x03, 0x02, 0x00, 0x2f, 0x33, 0x30, 0x31, 0x41, 0x15,
-    0x21, 0x35, 0x02, 0x61, 0xfd, 0xef, 0x02, 0xce, 0xc0, 0xc0, 0x00, 0x01, 0x00, 0x86, 0xff, 0xf4,
-    0x01, 0xa0, 0x00, 0xfd, 0x00, 0x0b, 0x00, 0x0a, 0xb3, 0x03, 0x09, 0x0b, 0x72, 0x00, 0x2b, 0x32,
-    0x30, 0x31, 0x77, 0x34, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14, 0x06, 0x23, 0x22, 0x26, 0x86, 0x4c,
-    0x41, 0x42, 0x4b, 0x4b, 0x42, 0x41, 0x4c, 0x78, 0x38, 0x4d, 0x4d, 0x38, 0x38, 0x4c, 0x4c, 0x00,
-    0x00, 0x01, 0x00, 0x01, 0xff, 0x83, 0x02, 0xf5, 0x05, 0xb0, 0x00, 0x03, 0x00, 0x09, 0xb2, 0x00,
-    0x02, 0x01, 0x00, 0x2f, 0x3f, 0x30, 0x31, 0x41, 0x01, 0x23, 0x01, 0x02, 0xf5, 0xfd, 0xc9, 0xbd,
-    0x02, 0x38, 0x05, 0xb0, 0xf9, 0xd3, 0x06, 0x2d, 0x00, 0x02, 0x00, 0x68, 0xff, 0xec, 0x04, 0x23,
-    0x05, 0xc4, 0x00, 0x17, 0x00, 0x2f, 0x00, 0x13, 0x40, 0x09, 0x2b, 0x06, 0x1f, 0x12, 0x05, 0x72,
-    0x06, 0x0d, 0x72, 0x00, 0x2b, 0x2b, 0x32, 0x11, 0x33, 0x30, 0x31, 0x41, 0x15, 0x14, 0x0e, 0x02,
-    0x23, 0x22, 0x2e, 0x03, 0x35, 0x35, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x1e, 0x03, 0x03, 0x11, 0x34,
-    0x2e, 0x03, 0x23, 0x22, 0x0e, 0x02, 0x15, 0x11, 0x14, 0x1e, 0x03, 0x33, 0x32, 0x3e, 0x02, 0x04,
-    0x23, 0x43, 0x7e, 0xaf, 0x6c, 0x56, 0x93, 0x76, 0x53, 0x2d, 0x44, 0x7e, 0xaf, 0x6c, 0x57, 0x93,
-    0x75, 0x53, 0x2c, 0xf1, 0x14, 0x27, 0x3a, 0x4a, 0x2e, 0x38, 0x58, 0x3c, 0x1f, 0x14, 0x28, 0x39,
-    0x4b, 0x2d, 0x39, 0x58, 0x3c, 0x1e, 0x03, 0x52, 0xee, 0xab, 0xf1, 0x96, 0x46, 0x2c, 0x5e, 0x95,
-    0xd0, 0x89, 0xee, 0xac, 0xed, 0x95, 0x44, 0x2b, 0x5c, 0x93, 0xcf, 0xfe, 0x67, 0x01, 0x34, 0x57,
-    0x85, 0x5d, 0x3b, 0x1b, 0x2b, 0x5e, 0x99, 0x6d, 0xfe, 0xcc, 0x58, 0x86, 0x5f, 0x3d, 0x1c, 0x2c,
-    0x61, 0x9c, 0x00, 0x01, 0x00, 0xaa, 0x00, 0x00, 0x03, 0x00, 0x05, 0xb5, 0x00, 0x06, 0x00, 0x0c,
-    0xb5, 0x06, 0x04, 0x72, 0x01, 0x0c, 0x72, 0x00, 0x2b, 0x2b, 0x30, 0x31, 0x41, 0x11, 0x23, 0x11,
-    0x05, 0x35, 0x25, 0x03, 0x00, 0xf1, 0xfe, 0x9b, 0x02, 0x39, 0x05, 0xb5, 0xfa, 0x4b, 0x04, 0x97,
-    0x79, 0xc7, 0xd0, 0x00, 0x00, 0x01, 0x00, 0x52, 0x00, 0x00, 0x04, 0x3e, 0x05, 0xc4, 0x00, 0x1f,
-    0x00, 0x19, 0x40, 0x0c, 0x10, 0x10, 0x0c, 0x15, 0x05, 0x72, 0x03, 0x1f, 0x1f, 0x02, 0x0c, 0x72,
-    0x00, 0x2b, 0x32, 0x11, 0x33, 0x2b, 0x32, 0x32, 0x2f, 0x30, 0x31, 0x65, 0x15, 0x21, 0x35, 0x01,
-    0x3e, 0x02, 0x35, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x15, 0x23, 0x34, 0x36, 0x36, 0x33,
-    0x32, 0x16, 0x16, 0x15, 0x14, 0x0e, 0x02, 0x07, 0x01, 0x04, 0x3e, 0xfc, 0x30, 0x01, 0xda, 0x4e,
-    0x5a, 0x25, 0x33, 0x62, 0x46, 0x51, 0x6e, 0x38, 0xf1, 0x74, 0xdc, 0x9b, 0x92, 0xcc, 0x6b, 0x2c,
-    0x51, 0x6e, 0x42, 0xfe, 0xc5, 0xc0, 0xc0, 0xa5, 0x02, 0x05, 0x58, 0x80, 0x67, 0x31, 0x45, 0x69,
-    0x3d, 0x46, 0x7b, 0x4f, 0x7f, 0xd3, 0x7d, 0x62, 0xb4, 0x7b, 0x44, 0x86, 0x85, 0x85, 0x44, 0xfe,
-    0xa5, 0x00, 0x00, 0x02, 0x00, 0x4e, 0xff, 0xec, 0x04, 0x1a, 0x05, 0xc4, 0x00, 0x1c, 0x00, 0x3b,
-    0x00, 0x2a, 0x40, 0x16, 0x1b, 0x1c, 0x1e, 0x1f, 0x04, 0x00, 0x00, 0x1d, 0x1d, 0x12, 0x33, 0x2f,
-    0x2f, 0x29, 0x0d, 0x72, 0x0d, 0x0d, 0x09, 0x12, 0x05, 0x72, 0x00, 0x2b, 0x32, 0x32, 0x2f, 0x2b,
-    0x32, 0x2f, 0x32, 0x11, 0x39, 0x2f, 0x33, 0x12, 0x17, 0x39, 0x30, 0x31, 0x41, 0x33, 0x32, 0x36,
-    0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x15, 0x23, 0x34, 0x36, 0x36, 0x33, 0x32,
-    0x16, 0x16, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x23, 0x15, 0x35, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x14,
-    0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x33, 0x14, 0x16, 0x16, 0x33, 0x32, 0x36, 0x36, 0x35,
-    0x34, 0x26, 0x26, 0x23, 0x01, 0x89, 0x90, 0x54, 0x6f, 0x36, 0x31, 0x63, 0x4c, 0x40, 0x67, 0x3c,
-    0xf2, 0x7a, 0xd3, 0x84, 0x8d, 0xd3, 0x76, 0x3a, 0x72, 0xaa, 0x70, 0xb5, 0xb5, 0x80, 0xb5, 0x72,
-    0x35, 0x49, 0x86, 0xb3, 0x69, 0x5e, 0xac, 0x88, 0x4f, 0xf1, 0x3d, 0x6f, 0x48, 0x4c, 0x6e, 0x3b,
-    0x42, 0x7a, 0x53, 0x03, 0x45, 0x3a, 0x66, 0x42, 0x45, 0x63, 0x36, 0x33, 0x5d, 0x40, 0x74, 0xb4,
-    0x67, 0x5d, 0xb8, 0x88, 0x3e, 0x80, 0x69, 0x41, 0x36, 0x84, 0x3c, 0x69, 0x86, 0x4b, 0x66, 0x9f,
-    0x6e, 0x38, 0x34, 0x67, 0x9b, 0x66, 0x41, 0x63, 0x38, 0x36, 0x6a, 0x4b, 0x55, 0x6a, 0x33, 0x00,
-    0x00, 0x02, 0x00, 0x37, 0x00, 0x00, 0x04, 0x59, 0x05, 0xb0, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x1d,
-    0x40, 0x0e, 0x03, 0x07, 0x07, 0x06, 0x02, 0x02, 0x05, 0x09, 0x0c, 0x72, 0x0b, 0x05, 0x04, 0x72,
-    0x00, 0x2b, 0x32, 0x2b, 0x12, 0x39, 0x2f, 0x39, 0x33, 0x12, 0x39, 0x30, 0x31, 0x41, 0x15, 0x21,
-    0x27, 0x01, 0x33, 0x03, 0x01, 0x01, 0x11, 0x23, 0x11, 0x04, 0x59, 0xfb, 0xe6, 0x08, 0x02, 0x74,
-    0xc1, 0xd1, 0xfe, 0x97, 0x02, 0x71, 0xf1, 0x02, 0x07, 0xc0, 0x91, 0x03, 0xd8, 0xfe, 0x9a, 0xfd,
-    0xbd, 0x03, 0xa9, 0xfa, 0x50, 0x05, 0xb0, 0x00, 0x00, 0x01, 0x00, 0x7f, 0xff, 0xec, 0x04, 0x39,
-    0x05, 0xb0, 0x00, 0x29, 0x00, 0x1d, 0x40, 0x0e, 0x27, 0x09, 0x09, 0x02, 0x1d, 0x19, 0x19, 0x13,
-    0x0d, 0x72, 0x05, 0x02, 0x04, 0x72, 0x00, 0x2b, 0x32, 0x2b, 0x32, 0x2f, 0x32, 0x11, 0x39, 0x2f,
-    0x33, 0x30, 0x31, 0x41, 0x27, 0x13, 0x21, 0x15, 0x21, 0x03, 0x36, 0x36, 0x33, 0x32, 0x1e, 0x02,
-    0x15, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x27, 0x33, 0x1e, 0x02, 0x33, 0x32, 0x3e, 0x02,
-    0x35, 0x34, 0x2e, 0x02, 0x23, 0x22, 0x06, 0x01, 0x6b, 0xc0, 0x4f, 0x03, 0x11, 0xfd, 0xb7, 0x28,
-    0x22, 0x78, 0x4d, 0x67, 0xa3, 0x72, 0x3c, 0x3b, 0x76, 0xb3, 0x7a, 0x5b, 0xa7, 0x84, 0x50, 0x06,
-    0xec, 0x09, 0x3d, 0x66, 0x43, 0x3d, 0x58, 0x3b, 0x1d, 0x21, 0x41, 0x62, 0x40, 0x56, 0x5b, 0x02,
-    0xa5, 0x2f, 0x02, 0xdc, 0xcc, 0xfe, 0x9b, 0x14, 0x27, 0x43, 0x7f, 0xb5, 0x71, 0x65, 0xb0, 0x86,
-    0x4b, 0x35, 0x69, 0x9b, 0x65, 0x47, 0x63, 0x34, 0x2b, 0x51, 0x6e, 0x43, 0x40, 0x6a, 0x4e, 0x2b,
-    0x32, 0x00, 0x00, 0x01, 0x00, 0x73, 0xff, 0xec, 0x04, 0x39, 0x05, 0xb9, 0x00, 0x36, 0x00, 0x1b,
-    0x40, 0x0d, 0x0e, 0x2c, 0x18, 0x22, 0x22, 0x2c, 0x03, 0x00, 0x04, 0x72, 0x2c, 0x0d, 0x72, 0x00,
-    0x2b, 0x2b, 0x32, 0x11, 0x39, 0x2f, 0x33, 0x11, 0x33, 0x30, 0x31, 0x41, 0x33, 0x15, 0x23, 0x22,
-    0x0e, 0x02, 0x15, 0x15, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x3e, 0x02, 0x35, 0x34, 0x2e, 0x02, 0x23,
-    0x22, 0x06, 0x06, 0x07, 0x27, 0x3e, 0x03, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x14, 0x0e, 0x02, 0x23,
-    0x22, 0x2e, 0x02, 0x35, 0x35, 0x34, 0x12, 0x36, 0x24, 0x03, 0x46, 0x1e, 0x11, 0x81, 0xbb, 0x78,
-    0x3b, 0x26, 0x45, 0x5a, 0x34, 0x36, 0x58, 0x3e, 0x20, 0x1f, 0x3c, 0x59, 0x3a, 0x48, 0x75, 0x47,
-    0x03, 0x5c, 0x08, 0x43, 0x6e, 0x91, 0x57, 0x6a, 0x9c, 0x67, 0x33, 0x40, 0x7b, 0xaf, 0x6f, 0x75,
-    0xb7, 0x7f, 0x42, 0x54, 0xaf, 0x01, 0x12, 0x05, 0xb9, 0xc5, 0x50, 0x8c, 0xbb, 0x69, 0xe5, 0x57,
-    0x85, 0x59, 0x2e, 0x2d, 0x50, 0x6e, 0x41, 0x3e, 0x6d, 0x53, 0x2f, 0x44, 0x6d, 0x3d, 0x1e, 0x5d,
-    0x94, 0x68, 0x37, 0x50, 0x89, 0xaf, 0x5f, 0x69, 0xb5, 0x88, 0x4c, 0x5a, 0x9e, 0xce, 0x73, 0x64,
-    0xa6, 0x01, 0x27, 0xe2, 0x81, 0x00, 0x00, 0x01, 0x00, 0x44, 0x00, 0x00, 0x04, 0x35, 0x05, 0xb0,
-    0x00, 0x06, 0x00, 0x13, 0x40, 0x09, 0x01, 0x05, 0x05, 0x06, 0x04, 0x72, 0x03, 0x0c, 0x72, 0x00,
-    0x2b, 0x2b, 0x32, 0x11, 0x33, 0x30, 0x31, 0x41, 0x15, 0x01, 0x23, 0x01, 0x21, 0x35, 0x04, 0x35,
-    0xfd, 0xba, 0xfe, 0x02, 0x45, 0xfd, 0x0e, 0x05, 0xb0, 0x84, 0xfa, 0xd4, 0x04, 0xf0, 0xc0, 0x00,
-    0x00, 0x04, 0x00, 0x67, 0xff, 0xec, 0x04, 0x26, 0x05, 0xc4, 0x00, 0x10, 0x00, 0x20, 0x00, 0x30,
-    0x00, 0x40, 0x00, 0x21, 0x40, 0x10, 0x0d, 0x3d, 0x3d, 0x25, 0x2d, 0x15, 0x15, 0x04, 0x35, 0x2d,
-    0x05, 0x72, 0x1d, 0x04, 0x0d, 0x72, 0x00, 0x2b, 0x32, 0x2b, 0x32, 0x12, 0x39, 0x2f, 0x12, 0x39,
-    0x33, 0x12, 0x39, 0x30, 0x31, 0x41, 0x14, 0x06, 0x06, 0x23, 0x22, 0x26, 0x26, 0x35, 0x34, 0x3e,
-    0x02, 0x33, 0x32, 0x16, 0x16, 0x07, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x15, 0x14, 0x16,
-    0x16, 0x33, 0x32, 0x36, 0x36, 0x13, 0x14, 0x06, 0x06, 0x23, 0x22, 0x26, 0x26, 0x35, 0x34, 0x36,
-    0x36, 0x33, 0x32, 0x16, 0x16, 0x07, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x15, 0x14, 0x16,
-    0x16, 0x33, 0x32, 0x36, 0x36, 0x04, 0x26, 0x7e, 0xd9, 0x88, 0x88, 0xda, 0x7e, 0x46, 0x81, 0xaf,
-    0x68, 0x8a, 0xda, 0x7d, 0xf2, 0x3c, 0x6c, 0x47, 0x48, 0x6a, 0x3b, 0x3a, 0x6c, 0x49, 0x49, 0x6a,
-    0x3a, 0xd1, 0x73, 0xca, 0x81, 0x82, 0xcb, 0x73, 0x73, 0xca, 0x82, 0x82, 0xca, 0x73, 0xf1, 0x33,
-    0x5c, 0x3f, 0x3f, 0x5c, 0x32, 0x32, 0x5d, 0x3f, 0x3f, 0x5c, 0x32, 0x01, 0x8d, 0x88, 0xba, 0x5f,
-    0x5f, 0xba, 0x88, 0x5a, 0x93, 0x6b, 0x3a, 0x66, 0xb4, 0x6c, 0x49, 0x6e, 0x3c, 0x3c, 0x6e, 0x49,
-    0x4a, 0x6b, 0x38, 0x38, 0x6b, 0x02, 0xe2, 0x6d, 0xaa, 0x61, 0x61, 0xaa, 0x6d, 0x82, 0xb3, 0x5e,
-    0x5e, 0xb3, 0x8a, 0x41, 0x63, 0x38, 0x36, 0x62, 0x44, 0x43, 0x63, 0x38, 0x38, 0x63, 0x00, 0x01,
-    0x00, 0x5d, 0xff, 0xf7, 0x04, 0x15, 0x05, 0xc4, 0x00, 0x38, 0x00, 0x1b, 0x40, 0x0d, 0x00, 0x38,
-    0x16, 0x21, 0x21, 0x38, 0x0c, 0x2b, 0x05, 0x72, 0x38, 0x0c, 0x72, 0x00, 0x2b, 0x2b, 0x32, 0x11,
-    0x39, 0x2f, 0x33, 0x11, 0x33, 0x30, 0x31, 0x65, 0x33, 0x32, 0x3e, 0x02, 0x35, 0x35, 0x34, 0x2e,
-    0x02, 0x23, 0x22, 0x0e, 0x02, 0x15, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x3e, 0x02, 0x37, 0x17, 0x14,
-    0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x15,
-    0x14, 0x0e, 0x03, 0x23, 0x23, 0x01, 0x30, 0x14, 0x8a, 0xb9, 0x6e, 0x30, 0x25, 0x43, 0x57, 0x32,
-    0x37, 0x57, 0x3b, 0x1f, 0x1d, 0x3a, 0x58, 0x3b, 0x38, 0x5e, 0x46, 0x28, 0x02, 0x5c, 0x3f, 0x6f,
-    0x93, 0x56, 0x68, 0x9f, 0x69, 0x34, 0x40, 0x7a, 0xaf, 0x6f, 0x76, 0xb2, 0x7a, 0x3e, 0x2e, 0x67,
-    0xa7, 0xf1, 0xa2, 0x16, 0xbe, 0x49, 0x82, 0xb0, 0x67, 0xfb, 0x59, 0x87, 0x5b, 0x2e, 0x31, 0x55,
-    0x71, 0x40, 0x3c, 0x6f, 0x56, 0x32, 0x2b, 0x4a, 0x5c, 0x30, 0x1c, 0x4c, 0x93, 0x79, 0x48, 0x4f,
-    0x88, 0xb0, 0x61, 0x69, 0xb8, 0x8d, 0x4f, 0x5c, 0xa2, 0xd6, 0x7b, 0x55, 0x81, 0xef, 0xcb, 0x99,
-    0x55, 0x00, 0xff, 0xff, 0x00, 0x7f, 0xff, 0xf4, 0x01, 0x9a, 0x04, 0x51, 0x04, 0x26, 0x00, 0x12,
-    0xf9, 0x00, 0x00, 0x07, 0x00, 0x12, 0xff, 0xfa, 0x03, 0x54, 0xff, 0xff, 0x00, 0x33, 0xfe, 0xb8,
-    0x01, 0x87, 0x04, 0x51, 0x04, 0x27, 0x00, 0x12, 0xff, 0xe7, 0x03, 0x54, 0x00, 0x06, 0x00, 0x10,
-    0x11, 0x00, 0x00, 0x02, 0x00, 0x3e, 0x00, 0xa7, 0x03, 0x89, 0x04, 0x4c, 0x00, 0x04, 0x00, 0x09,
-    0x00, 0x16, 0x40, 0x0c, 0x01, 0x03, 0x07, 0x06, 0x00, 0x04, 0x08, 0x05, 0x08, 0x02, 0x09, 0x02,
-    0x00, 0x2f, 0x2f, 0x12, 0x17, 0x39, 0x30, 0x31, 0x53, 0x05, 0x15, 0x01, 0x35, 0x25, 0x01, 0x07,
-    0x35, 0x01, 0xf4, 0x02, 0x95, 0xfc, 0xb5, 0x03, 0x4b, 0xfd, 0x6b, 0xb6, 0x03, 0x4b, 0x02, 0x91,
-    0xfd, 0xed, 0x01, 0x74, 0x9d, 0xa8, 0xfe, 0xff, 0x23, 0x9d, 0x01, 0x73, 0x00, 0x02, 0x00, 0x8f,
-    0x01, 0x64, 0x03, 0xf3, 0x03, 0xd2, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0e, 0xb5, 0x06, 0x07, 0x12,
-    0x03, 0x02, 0x10, 0x00, 0x3f, 0x33, 0x3f, 0x33, 0x30, 0x31, 0x41, 0x15, 0x21, 0x35, 0x01, 0x15,
-    0x21, 0x35, 0x03, 0xf3, 0xfc, 0x9c, 0x03, 0x64, 0xfc, 0x9c, 0x03, 0xd2, 0xc6, 0xc6, 0xfe, 0x58,
-    0xc6, 0xc6, 0x00, 0x02, 0x00, 0x7e, 0x00, 0xa8, 0x03, 0xde, 0x04, 0x4d, 0x00, 0x04, 0x00, 0x09,
-    0x00, 0x15, 0x40, 0x0b, 0x05, 0x08, 0x04, 0x00, 0x06, 0x03, 0x01, 0x07, 0x02, 0x09, 0x02, 0x00,
-    0x2f, 0x2f, 0x12, 0x17, 0x39, 0x30, 0x31, 0x41, 0x25, 0x35, 0x01, 0x15, 0x05, 0x01, 0x37, 0x15,
-    0x01, 0x03, 0x1f, 0xfd, 0x5f, 0x03, 0x60, 0xfc, 0xa0, 0x02, 0xa3, 0xbd, 0xfc, 0xa0, 0x02, 0x69,
-    0xfb, 0xe9, 0xfe, 0x8d, 0x9e, 0xab, 0x01, 0x00, 0x28, 0x9d, 0xfe, 0x8c, 0x00, 0x02, 0x00, 0x3b,
-    0xff, 0xf4, 0x03, 0x97, 0x05, 0xc4, 0x00, 0x20, 0x00, 0x2c, 0x00, 0x1b, 0x40, 0x0d, 0x01, 0x01,
-    0x24, 0x24, 0x2a, 0x0b, 0x72, 0x11, 0x11, 0x0d, 0x16, 0x03, 0x72, 0x00, 0x2b, 0x32, 0x32, 0x2f,
-    0x2b, 0x32, 0x11, 0x33, 0x2f, 0x30, 0x31, 0x41, 0x23, 0x3e, 0x02, 0x37, 0x3e, 0x02, 0x35, 0x34,
-    0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x07, 0x23, 0x3e, 0x02, 0x33, 0x32, 0x16, 0x16, 0x15, 0x14,
-    0x06, 0x06, 0x07, 0x06, 0x06, 0x03, 0x34, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14, 0x06, 0x23, 0x22,
-    0x26, 0x02, 0x3f, 0xdf, 0x01, 0x1e, 0x47, 0x3b, 0x2e, 0x4a, 0x2c, 0x2a, 0x51, 0x3c, 0x32, 0x58,
-    0x36, 0x02, 0xf1, 0x02, 0x74, 0xc4, 0x79, 0x86, 0xbe, 0x65, 0x46, 0x70, 0x41, 0x38, 0x28, 0xf4,
-    0x4a, 0x40, 0x40, 0x4a, 0x4a, 0x40, 0x40, 0x4a, 0x01, 0xad, 0x5d, 0x7f, 0x68, 0x3a, 0x2c, 0x4f,
-    0x59, 0x3a, 0x3f, 0x58, 0x2e, 0x27, 0x51, 0x42, 0x7e, 0xac, 0x56, 0x5b, 0xad, 0x7a, 0x58, 0x8f,
-    0x7b, 0x3d, 0x33, 0x77, 0xfe, 0x7c, 0x36, 0x4b, 0x4b, 0x36, 0x36, 0x4b, 0x4b, 0x00, 0x00, 0x02,
-    0x00, 0x5b, 0xfe, 0x3b, 0x06, 0xd6, 0x05, 0x8f, 0x00, 0x41, 0x00, 0x68, 0x00, 0x27, 0x40, 0x12,
-    0x12, 0x05, 0x05, 0x47, 0x52, 0x13, 0x72, 0x61, 0x64, 0x64, 0x0b, 0x5d, 0x5d, 0x1d, 0x1d, 0x3c,
-    0x29, 0x30, 0x00, 0x2f, 0x33, 0x2f, 0x33, 0x11, 0x33, 0x2f, 0x33, 0x33, 0x11, 0x33, 0x2b, 0x32,
-    0x32, 0x11, 0x33, 0x30, 0x31, 0x41, 0x0e, 0x03, 0x23, 0x22, 0x2e, 0x02, 0x37, 0x13, 0x33, 0x03,
-    0x06, 0x1e, 0x02, 0x33, 0x32, 0x3e, 0x02, 0x37, 0x36, 0x2e, 0x03, 0x23, 0x22, 0x0e, 0x03, 0x07,
-    0x06, 0x1e, 0x03, 0x33, 0x32, 0x36, 0x37, 0x17, 0x06, 0x06, 0x23, 0x22, 0x24, 0x26, 0x26, 0x02,
-    0x37, 0x36, 0x12, 0x36, 0x36, 0x24, 0x33, 0x32, 0x1e, 0x02, 0x12, 0x01, 0x06, 0x1e, 0x02, 0x33,
-    0x32, 0x3e, 0x02, 0x37, 0x17, 0x0e, 0x03, 0x23, 0x22, 0x2e, 0x02, 0x37, 0x3e, 0x04, 0x33, 0x32,
-    0x16, 0x17, 0x07, 0x26, 0x26, 0x23, 0x22, 0x0e, 0x02, 0x06, 0xcf, 0x04, 0x32, 0x65, 0x9e, 0x6f,
-    0x43, 0x68, 0x45, 0x1e, 0x07, 0x33, 0xaf, 0x32, 0x06, 0x11, 0x24, 0x2e, 0x17, 0x36, 0x56, 0x3d,
-    0x23, 0x03, 0x07, 0x28, 0x5f, 0x97, 0xd2, 0x87, 0x7c, 0xd2, 0xa6, 0x77, 0x43, 0x06, 0x07, 0x2d,
-    0x66, 0x9b, 0xcd, 0x7d, 0x58, 0xb5, 0x3e, 0x26, 0x46, 0xd2, 0x5d, 0x9b, 0xfe, 0xff, 0xc5, 0x82,
-    0x3e, 0x07, 0x07, 0x56, 0x97, 0xd1, 0x01, 0x06, 0x9a, 0x9c, 0xfc, 0xbf, 0x7e, 0x3a, 0xfc, 0x00,
-    0x07, 0x0d, 0x25, 0x3c, 0x28, 0x19, 0x39, 0x38, 0x32, 0x11, 0x4c, 0x17, 0x46, 0x58, 0x66, 0x37,
-    0x49, 0x71, 0x48, 0x1e, 0x09, 0x0a, 0x39, 0x55, 0x6c, 0x7d, 0x42, 0x71, 0x80, 0x39, 0x5e, 0x1d,
-    0x5d, 0x40, 0x39, 0x5d, 0x46, 0x2f, 0x02, 0x08, 0x61, 0xc0, 0x9e, 0x5e, 0x2f, 0x58, 0x7d, 0x4d,
-    0x02, 0x37, 0xfd, 0xc9, 0x3d, 0x4e, 0x2a, 0x10, 0x3d, 0x6d, 0x90, 0x54, 0x8c, 0xed, 0xba, 0x81,
-    0x44, 0x4c, 0x8f, 0xc7, 0xf7, 0x8d, 0x94, 0xf4, 0xbc, 0x81, 0x42, 0x28, 0x21, 0x85, 0x2d, 0x2c,
-    0x50, 0x9b, 0xe0, 0x01, 0x22, 0xaf, 0xa4, 0x01, 0x21, 0xec, 0xab, 0x5c, 0x52, 0x9c, 0xde, 0xfe,
-    0xe9, 0xfe, 0xfd, 0x44, 0x6a, 0x48, 0x26, 0x19, 0x38, 0x5d, 0x45, 0x57, 0x4e, 0x77, 0x4f, 0x29,
-    0x40, 0x75, 0xa3, 0x65, 0x67, 0xb0, 0x8a, 0x61, 0x33, 0x40, 0x2b, 0x78, 0x1b, 0x30, 0x34, 0x69,
-    0x9a, 0x00, 0x00, 0x03, 0x00, 0x11, 0x00, 0x00, 0x05, 0x3f, 0x05, 0xb0, 0x00, 0x04, 0x00, 0x09,
-    0x00, 0x0d, 0x00, 0x29, 0x40, 0x14, 0x04, 0x07, 0x07, 0x0a, 0x0d, 0x0d, 0x06, 0x00, 0x0b, 0x0c,
-    0x0c, 0x02, 0x08, 0x03, 0x02, 0x72, 0x05, 0x02, 0x08, 0x72, 0x00, 0x2b, 0x32, 0x2b, 0x32, 0x11,
-    0x39, 0x2f, 0x33, 0x39, 0x39, 0x33, 0x11, 0x33, 0x32, 0x11, 0x33, 0x30, 0x31, 0x41, 0x01, 0x21,
-    0x01, 0x33, 0x01, 0x01, 0x27, 0x33, 0x01, 0x01, 0x15, 0x21, 0x35, 0x02, 0xcb, 0xfe, 0x4d, 0xfe,
-    0xf9, 0x02, 0x24, 0xa8, 0x01, 0x5a, 0xfe, 0x4c, 0x13, 0xa9, 0x02, 0x26, 0xfe, 0xe3, 0xfc, 0xe8,
-    0x04, 0xee, 0xfb, 0x12, 0x05, 0xb0, 0xfa, 0x50, 0x04, 0xee, 0xc2, 0xfa, 0x50, 0x02, 0x1c, 0xc7,
-    0xc7, 0x00, 0x00, 0x02, 0x00, 0x94, 0x00, 0x00, 0x04, 0xa5, 0x05, 0xb0, 0x00, 0x19, 0x00, 0x30,
-    0x00, 0x29, 0x40, 0x14, 0x19, 0x29, 0x26, 0x02, 0x27, 0x27, 0x01, 0x26, 0x26, 0x0e, 0x0c, 0x0f,
-    0x02, 0x72, 0x1c, 0x1b, 0x1b, 0x0e, 0x08, 0x72, 0x00, 0x2b, 0x32, 0x11, 0x33, 0x2b, 0x32, 0x11,
-    0x39, 0x2f, 0x33, 0x33, 0x11, 0x33, 0x12, 0x39, 0x39, 0x30, 0x31, 0x41, 0x21, 0x27, 0x21, 0x32,
-    0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x23, 0x11, 0x23, 0x11, 0x21, 0x32, 0x1e, 0x02, 0x15,
-    0x14, 0x06, 0x06, 0x07, 0x03, 0x21, 0x37, 0x21, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23,
-    0x21, 0x37, 0x21, 0x17, 0x1e, 0x02, 0x15, 0x14, 0x06, 0x06, 0x02, 0xb6, 0xfe, 0x8d, 0x02, 0x01,
-    0x44, 0x52, 0x73, 0x3c, 0x38, 0x73, 0x59, 0xf3, 0xfb, 0x01, 0xee, 0x78, 0xbd, 0x85, 0x45, 0x56,
-    0xa8, 0x7d, 0x5b, 0xfe, 0x49, 0x71, 0x01, 0x46, 0x55, 0x72, 0x39, 0x32, 0x6c, 0x57, 0xfe, 0xe6,
-    0x02, 0x01, 0x6f, 0x39, 0x78, 0x9b, 0x4c, 0x79, 0xe2, 0x02, 0x92, 0xb7, 0x31, 0x5d, 0x42, 0x49,
-    0x5c, 0x2a, 0xfb, 0x18, 0x05, 0xb0, 0x2e, 0x61, 0x94, 0x66, 0x5a, 0x95, 0x5e, 0x09, 0xfd, 0x2f,
-    0xc7, 0x39, 0x65, 0x44, 0x47, 0x69, 0x39, 0xb7, 0x45, 0x04, 0x62, 0x9c, 0x5a, 0x8b, 0xbc, 0x61,
-    0x00, 0x01, 0x00, 0x66, 0xff, 0xec, 0x04, 0xeb, 0x05, 0xc4, 0x00, 0x27, 0x00, 0x15, 0x40, 0x0a,
-    0x19, 0x15, 0x10, 0x03, 0x72, 0x24, 0x00, 0x05, 0x09, 0x72, 0x00, 0x2b, 0xcc, 0x33, 0x2b, 0xcc,
-    0x33, 0x30, 0x31, 0x41, 0x33, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x35, 0x34, 0x3e, 0x02,
-    0x33, 0x32, 0x16, 0x16, 0x17, 0x23, 0x2e, 0x02, 0x23, 0x22, 0x0e, 0x02, 0x15, 0x15, 0x14, 0x1e,
-    0x02, 0x33, 0x32, 0x36, 0x36, 0x03, 0xf0, 0xfa, 0x0c, 0x88, 0xf6, 0xb0, 0x87, 0xd8, 0x9a, 0x51,
-    0x53, 0x9c, 0xdb, 0x89, 0xae, 0xf0, 0x85, 0x0f, 0xfa, 0x0a, 0x43, 0x82, 0x69, 0x56, 0x80, 0x56,
-    0x2b, 0x27, 0x51, 0x7e, 0x58, 0x6b, 0x85, 0x45, 0x01, 0xda, 0x8f, 0xdf, 0x80, 0x61, 0xb3, 0xfe,
-    0x9d, 0x79, 0x9d, 0xfe, 0xb5, 0x60, 0x80, 0xe2, 0x92, 0x5e, 0x86, 0x47, 0x40, 0x7c, 0xb5, 0x74,
-    0x7b, 0x6e, 0xb3, 0x80, 0x46, 0x44, 0x83, 0x00, 0x00, 0x02, 0x00, 0x94, 0x00, 0x00, 0x04, 0xd2,
-    0x05, 0xb0, 0x00, 0x1a, 0x00, 0x1e, 0x00, 0x1b, 0x40, 0x0d, 0x02, 0x01, 0x01, 0x1d, 0x0e, 0x0f,
-    0x0f, 0x1e, 0x02, 0x72, 0x1d, 0x08, 0x72, 0x00, 0x2b, 0x2b, 0x32, 0x11, 0x33, 0x11, 0x33, 0x11,
-    0x33, 0x30, 0x31, 0x61, 0x21, 0x37, 0x21, 0x32, 0x36, 0x36, 0x35, 0x35, 0x34, 0x2e, 0x02, 0x23,
-    0x21, 0x35, 0x21, 0x32, 0x1e, 0x02, 0x15, 0x15, 0x14, 0x0e, 0x02, 0x01, 0x11, 0x23, 0x11, 0x02,
-    0x3b, 0xfe, 0xc9, 0x02, 0x01, 0x35, 0x87, 0xb7, 0x5d, 0x35, 0x67, 0x95, 0x61, 0xfe, 0xba, 0x01,
-    0x46, 0x91, 0xf0, 0xaf, 0x5e, 0x5e, 0xb0, 0xf3, 0xfe, 0xbe, 0xfb, 0xc7, 0x76, 0xdc, 0x98, 0x4f,
-    0x76, 0xb6, 0x7c, 0x40, 0xc8, 0x61, 0xb6, 0xfe, 0x9d, 0x4d, 0x9d, 0xfe, 0xb5, 0x61, 0x05, 0xb0,
-    0xfa, 0x50, 0x05, 0xb0, 0x00, 0x04, 0x00, 0x94, 0x00, 0x00, 0x04, 0x4d, 0x05, 0xb0, 0x00, 0x03,
-    0x00, 0x07, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x1d, 0x40, 0x0e, 0x0b, 0x0a, 0x0a, 0x06, 0x0f, 0x0e,
-    0x07, 0x02, 0x72, 0x03, 0x02, 0x06, 0x08, 0x72, 0x00, 0x2b, 0x32, 0x32, 0x2b, 0x32, 0x32, 0x11,
-    0x39, 0x2f, 0x33, 0x30, 0x31, 0x65, 0x15, 0x21, 0x35, 0x13, 0x11, 0x23, 0x11, 0x01, 0x15, 0x21,
-    0x35, 0x01, 0x15, 0x21, 0x35, 0x04, 0x4d, 0xfc, 0xfb, 0x47, 0xfb, 0x03, 0x54, 0xfd, 0x60, 0x03,
-    0x00, 0xfd, 0x00, 0xc7, 0xc7, 0xc7, 0x04, 0xe9, 0xfa, 0x50, 0x05, 0xb0, 0xfd, 0xa0, 0xc4, 0xc4,
-    0x02, 0x60, 0xc8, 0xc8, 0x00, 0x03, 0x00, 0x94, 0x00, 0x00, 0x04, 0x34, 0x05, 0xb0, 0x00, 0x03,
-    0x00, 0x07, 0x00, 0x0b, 0x00, 0x1b, 0x40, 0x0d, 0x07, 0x06, 0x06, 0x02, 0x0a, 0x0b, 0x0b, 0x03,
-    0x02, 0x72, 0x02, 0x08, 0x72, 0x00, 0x2b, 0x2b, 0x32, 0x11, 0x33, 0x11, 0x39, 0x2f, 0x33, 0x30,
-    0x31, 0x41, 0x11, 0x23, 0x11, 0x01, 0x15, 0x21, 0x35, 0x01, 0x15, 0x21, 0x35, 0x01, 0x8f, 0xfb,
-    0x03, 0x4d, 0xfd, 0x6e, 0x02, 0xe5, 0xfd, 0x1b, 0x05, 0xb0, 0xfa, 0x50, 0x05, 0xb0, 0xfd, 0x83,
-    0xc7, 0xc7, 0x02, 0x7d, 0xc8, 0xc8, 0x00, 0x01, 0x00, 0x6b, 0xff, 0xec, 0x04, 0xf2, 0x05, 0xc4,
-    0x00, 0x2b, 0x00, 0x1b, 0x40, 0x0d, 0x2b, 0x2a, 0x2a, 0x05, 0x19, 0x15, 0x10, 0x03, 0x72, 0x24,
-    0x05, 0x09, 0x72, 0x00, 0x2b, 0x32, 0x2b, 0xcc, 0x33, 0x12, 0x39, 0x2f, 0x33, 0x30, 0x31, 0x41,
-    0x11, 0x0e, 0x02, 0x23, 0x22, 0x26, 0x26, 0x02, 0x35, 0x35, 0x34, 0x12, 0x36, 0x36, 0x33, 0x32,
-    0x16, 0x16, 0x17, 0x23, 0x2e, 0x02, 0x23, 0x22, 0x0e, 0x02, 0x15, 0x15, 0x14, 0x1e, 0x02, 0x33,
-    0x32, 0x36, 0x36, 0x37, 0x11, 0x21, 0x35, 0x04, 0xf2, 0x1f, 0x83, 0xd8, 0xa1, 0x89, 0xe4, 0xa5,
-    0x5a, 0x53, 0x9c, 0xdd, 0x8c, 0xb3, 0xeb, 0x80, 0x11, 0xf6, 0x0c, 0x45, 0x7f, 0x65, 0x57, 0x84,
-    0x57, 0x2c, 0x33, 0x61, 0x8c, 0x58, 0x56, 0x6e, 0x41, 0x12, 0xfe, 0xd1, 0x02, 0xe8, 0xfd, 0xd4,
-    0x29, 0x61, 0x46, 0x5d, 0xb4, 0x01, 0x03, 0xa6, 0x65, 0xa5, 0x01, 0x03, 0xb4, 0x5d, 0x77, 0xd2,
-    0x87, 0x4c, 0x78, 0x45, 0x42, 0x80, 0xb8, 0x76, 0x67, 0x78, 0xba, 0x80, 0x41, 0x1d, 0x29, 0x13,
-    0x01, 0x21, 0xbb, 0x00, 0x00, 0x03, 0x00, 0x94, 0x00, 0x00, 0x05, 0x17, 0x05, 0xb0, 0x00, 0x03,
-    0x00, 0x07, 0x00, 0x0b, 0x00, 0x1b, 0x40, 0x0d, 0x09, 0x06, 0x08, 0x03, 0x02, 0x02, 0x06, 0x07,
-    0x02, 0x72, 0x06, 0x08, 0x72, 0x00, 0x2b, 0x2b, 0x11, 0x39, 0x2f, 0x33, 0x32, 0x11, 0x33, 0x30,
-    0x31, 0x41, 0x15, 0x21, 0x35, 0x13, 0x11, 0x23, 0x11, 0x21, 0x11, 0x23, 0x11, 0x04, 0x56, 0xfc,
-    0xfb, 0x3e, 0xfb, 0x04, 0x83, 0xfa, 0x03, 0x50, 0xc7, 0xc7, 0x02, 0x60, 0xfa, 0x50, 0x05, 0xb0,
-    0xfa, 0x50, 0x05, 0xb0, 0x00, 0x01, 0x00, 0xa5, 0x00, 0x00, 0x01, 0xa0, 0x05, 0xb0, 0x00, 0x03,
-    0x00, 0x0c, 0xb5, 0x00, 0x02, 0x72, 0x01, 0x08, 0x72, 0x00, 0x2b, 0x2b, 0x30, 0x31, 0x41, 0x11,
-    0x23, 0x11, 0x01, 0xa0, 0xfb, 0x05, 0xb0, 0xfa, 0x50, 0x05, 0xb0, 0x00, 0x00, 0x01, 0x00, 0x2f,
-    0xff, 0xec, 0x03, 0xe5, 0x05, 0xb0, 0x00, 0x13, 0x00, 0x13, 0x40, 0x09, 0x10, 0x0c, 0x0c, 0x07,
-    0x09, 0x72, 0x02, 0x02, 0x72, 0x00, 0x2b, 0x2b, 0x32, 0x2f, 0x32, 0x30, 0x31, 0x41, 0x11, 0x33,
-    0x11, 0x14, 0x06, 0x06, 0x23, 0x22, 0x26, 0x26, 0x35, 0x33, 0x14, 0x16, 0x16, 0x33, 0x32, 0x36,
-    0x36, 0x02, 0xeb, 0xfa, 0x7c, 0xd6, 0x88, 0x8b, 0xd7, 0x7a, 0xfc, 0x37, 0x65, 0x44, 0x41, 0x65,
-    0x3a, 0x01, 0xb5, 0x03, 0xfb, 0xfc, 0x05, 0x91, 0xcc, 0x6c, 0x5e, 0xc2, 0x95, 0x56, 0x69, 0x2f,
-    0x3b, 0x73, 0x00, 0x03, 0x00, 0x94, 0x00, 0x00, 0x05, 0x16, 0x05, 0xb0, 0x00, 0x03, 0x00, 0x09,
-    0x00, 0x0d, 0x00, 0x1c, 0x40, 0x10, 0x06, 0x07, 0x0b, 0x05, 0x0c, 0x08, 0x06, 0x02, 0x04, 0x03,
-    0x02, 0x72, 0x0a, 0x02, 0x08, 0x72, 0x00, 0x2b, 0x32, 0x2b, 0x32, 0x12, 0x17, 0x39, 0x30, 0x31,
-    0x41, 0x11, 0x23, 0x11, 0x21, 0x01, 0x01, 0x27, 0x13, 0x01, 0x13, 0x01, 0x37, 0x01, 0x01, 0x8f,
-    0xfb, 0x04, 0x66, 0xfd, 0xb2, 0xfe, 0xb0, 0x2c, 0xf0, 0x01, 0xa8, 0x24, 0xfe, 0x21, 0xad, 0x02,
-    0x5c, 0x05, 0xb0, 0xfa, 0x50, 0x05, 0xb0, 0xfd, 0x43, 0xfe, 0x9c, 0xf9, 0x01, 0x28, 0x02, 0x00,
-    0xfa, 0x50, 0x02, 0xb2, 0xab, 0xfc, 0xa3, 0x00, 0x00, 0x02, 0x00, 0x94, 0x00, 0x00, 0x04, 0x24,
-    0x05, 0xb0, 0x00, 0x03, 0x00, 0x07, 0x00, 0x15, 0x40, 0x0a, 0x03, 0x02, 0x02, 0x06, 0x07, 0x02,
-    0x72, 0x06, 0x08, 0x72, 0x00, 0x2b, 0x2b, 0x11, 0x33, 0x11, 0x33, 0x30, 0x31, 0x65, 0x15, 0x21,
-    0x35, 0x13, 0x11, 0x23, 0x11, 0x04, 0x24, 0xfd, 0x25, 0x46, 0xfb, 0xc7, 0xc7, 0xc7, 0x04, 0xe9,
-    0xfa, 0x50, 0x05, 0xb0, 0x00, 0x03, 0x00, 0x94, 0x00, 0x00, 0x06, 0x6a, 0x05, 0xb0, 0x00, 0x06,
-    0x00, 0x0b, 0x00, 0x10, 0x00, 0x1b, 0x40, 0x0d, 0x02, 0x07, 0x0e, 0x05, 0x0b, 0x08, 0x72, 0x0c,
-    0x04, 0x00, 0x07, 0x02, 0x72, 0x00, 0x2b, 0x32, 0x32, 0x32, 0x2b, 0x32, 0x32, 0x11, 0x39, 0x30,
-    0x31, 0x53, 0x33, 0x01, 0x01, 0x33, 0x01, 0x23, 0x01, 0x33, 0x13, 0x11, 0x23, 0x01, 0x33, 0x11,
-    0x23, 0x11, 0xfa, 0xe0, 0x01, 0xa5, 0x01, 0xa4, 0xe0, 0xfd, 0xd4, 0xb2, 0xfd, 0x6f, 0xd5, 0x25,
-    0xfa, 0x05, 0x00, 0xd6, 0xfb, 0x05, 0xb0, 0xfb, 0x9d, 0x04, 0x63, 0xfa, 0x50, 0x05, 0xb0, 0xfc,
-    0x34, 0xfe, 0x1c, 0x05, 0xb0, 0xfa, 0x50, 0x01, 0xe4, 0x00, 0x00, 0x01, 0x00, 0x94, 0x00, 0x00,
-    0x05, 0x17, 0x05, 0xb0, 0x00, 0x09, 0x00, 0x17, 0x40, 0x0b, 0x03, 0x08, 0x05, 0x09, 0x07, 0x02,
-    0x72, 0x02, 0x05, 0x08, 0x72, 0x00, 0x2b, 0x32, 0x2b, 0x32, 0x12, 0x39, 0x39, 0x30, 0x31, 0x41,
-    0x11, 0x23, 0x01, 0x11, 0x23, 0x11, 0x33, 0x01, 0x11, 0x05, 0x17, 0xfb, 0xfd, 0x73, 0xfb, 0xfb,
-    0x02, 0x8f, 0x05, 0xb0, 0xfa, 0x50, 0x04, 0x13, 0xfb, 0xed, 0x05, 0xb0, 0xfb, 0xeb, 0x04, 0x15,
-    0x00, 0x02, 0x00, 0x65, 0xff, 0xec, 0x05, 0x1d, 0x05, 0xc4, 0x00, 0x15, 0x00, 0x2b, 0x00, 0x13,
-    0x40, 0x09, 0x27, 0x06, 0x1c, 0x11, 0x03, 0x72, 0x06, 0x09, 0x72, 0x00, 0x2b, 0x2b, 0x32, 0x11,
-    0x33, 0x30, 0x31, 0x41, 0x15, 0x14, 0x02, 0x06, 0x06, 0x23, 0x22, 0x26, 0x26, 0x02, 0x35, 0x35,
-    0x34, 0x12, 0x36, 0x36, 0x33, 0x32, 0x16, 0x16, 0x12, 0x07, 0x35, 0x34, 0x2e, 0x02, 0x23, 0x22,
-    0x0e, 0x02, 0x15, 0x15, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x3e, 0x02, 0x05, 0x1d, 0x56, 0x9f, 0xde,
-    0x87, 0x86, 0xdd, 0xa2, 0x59, 0x58, 0xa1, 0xdd, 0x86, 0x87, 0xde, 0xa0, 0x57, 0xfb, 0x2f, 0x5b,
-    0x84, 0x53, 0x53, 0x82, 0x5b, 0x30, 0x30, 0x5d, 0x82, 0x53, 0x54, 0x82, 0x5a, 0x2f, 0x03, 0x00,
-    0x50, 0xa5, 0xfe, 0xfa, 0xb8, 0x61, 0x61, 0xb8, 0x01, 0x06, 0xa5, 0x50, 0xa5, 0x01, 0x05, 0xb9,
-    0x61, 0x61, 0xb9, 0xfe, 0xfb, 0xf5, 0x52, 0x7a, 0xbb, 0x7f, 0x41, 0x41, 0x7f, 0xbb, 0x7a, 0x52,
-    0x7a, 0xbc, 0x81, 0x41, 0x41, 0x81, 0xbc, 0x00, 0x00, 0x01, 0x00, 0x94, 0x00, 0x00, 0x04, 0xcf,
-    0x05, 0xb0, 0x00, 0x17, 0x00, 0x17, 0x40, 0x0b, 0x02, 0x01, 0x01, 0x0e, 0x0c, 0x0f, 0x02, 0x72,
-    0x0e, 0x08, 0x72, 0x00, 0x2b, 0x2b, 0x32, 0x11, 0x39, 0x2f, 0x33, 0x30, 0x31, 0x41, 0x21, 0x35,
-    0x21, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x21, 0x11, 0x23, 0x11, 0x21, 0x32, 0x16,
-    0x16, 0x15, 0x14, 0x06, 0x06, 0x02, 0xbd, 0xfe, 0x85, 0x01, 0x7b, 0x63, 0x7a, 0x39, 0x39, 0x7a,
-    0x63, 0xfe, 0xd2, 0xfb, 0x02, 0x29, 0xa9, 0xed, 0x7c, 0x7c, 0xed, 0x02, 0x1f, 0xc7, 0x40, 0x71,
-    0x49, 0x45, 0x79, 0x4a, 0xfb, 0x18, 0x05, 0xb0, 0x77, 0xd1, 0x86, 0x8d, 0xca, 0x6c, 0x00, 0x03,
-    0x00, 0x60, 0xff, 0x03, 0x05, 0x19, 0x05, 0xc4, 0x00, 0x03, 0x00, 0x19, 0x00, 0x2f, 0x00, 0x19,
-    0x40, 0x0c, 0x20, 0x15, 0x03, 0x72, 0x00, 0x2b, 0x2b, 0x03, 0x0a, 0x09, 0x72, 0x02, 0x00, 0x2f,
-    0x2b, 0x32, 0x32, 0x11, 0x33, 0x2b, 0x32, 0x30, 0x31, 0x65, 0x01, 0x07, 0x01, 0x01, 0x15, 0x14,
-    0x02, 0x06, 0x06, 0x23, 0x22, 0x26, 0x26, 0x02, 0x35, 0x35, 0x34, 0x12, 0x36, 0x36, 0x33, 0x32,
-    0x16, 0x16, 0x12, 0x07, 0x35, 0x34, 0x2e, 0x02, 0x23, 0x22, 0x0e, 0x02, 0x15, 0x15, 0x14, 0x1e,
-    0x02, 0x33, 0x32, 0x3e, 0x02, 0x03, 0x97, 0x01, 0x7f, 0xa3, 0xfe, 0x88, 0x02, 0x1e, 0x56, 0xa0,
-    0xde, 0x87, 0x86, 0xdd, 0xa2, 0x59, 0x58, 0xa1, 0xdd, 0x86, 0x87, 0xdf, 0xa0, 0x57, 0xfc, 0x2f,
-    0x5b, 0x83, 0x54, 0x52, 0x82, 0x5c, 0x30, 0x30, 0x5d, 0x83, 0x52, 0x54, 0x82, 0x5a, 0x2f, 0xc2,
-    0xfe, 0xd0, 0x8f, 0x01, 0x2d, 0x02, 0xd0, 0x50, 0xa5, 0xfe, 0xfa, 0xb8, 0x61, 0x61, 0xb8, 0x01,
-    0x06, 0xa5, 0x50, 0xa5, 0x01, 0x05, 0xb9, 0x61, 0x61, 0xb9, 0xfe, 0xfb, 0xf5, 0x52, 0x7a, 0xbb,
-    0x7f, 0x41, 0x41, 0x7f, 0xbb, 0x7a, 0x52, 0x7a, 0xbc, 0x81, 0x41, 0x41, 0x81, 0xbc, 0x00, 0x02,
-    0x00, 0x94, 0x00, 0x00, 0x04, 0xdf, 0x05, 0xb0, 0x00, 0x18, 0x00, 0x1d, 0x00, 0x23, 0x40, 0x12,
-    0x1b, 0x1a, 0x09, 0x03, 0x0c, 0x0c, 0x0b, 0x0b, 0x00, 0x1c, 0x19, 0x18, 0x08, 0x72, 0x16, 0x00,
-    0x02, 0x72, 0x00, 0x2b, 0x32, 0x2b, 0x32, 0x32, 0x12, 0x39, 0x2f, 0x33, 0x12, 0x17, 0x39, 0x30,
-    0x31, 0x53, 0x21, 0x32, 0x16, 0x16, 0x15, 0x14, 0x06, 0x06, 0x07, 0x07, 0x21, 0x27, 0x21, 0x32,
-    0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x21, 0x11, 0x23, 0x21, 0x01, 0x25, 0x01, 0x15, 0x94,
-    0x02, 0x03, 0xa6, 0xea, 0x7d, 0x50, 0x92, 0x65, 0x4c, 0xfe, 0x31, 0x02, 0x01, 0x5b, 0x5a, 0x78,
-    0x3d, 0x3b, 0x7a, 0x5e, 0xfe, 0xf8, 0xfb, 0x03, 0x3f, 0xfe, 0xaa, 0x01, 0x07, 0x01, 0x5b, 0x05,
-    0xb0, 0x64, 0xc3, 0x8f, 0x6d, 0xa6, 0x71, 0x1f, 0x25, 0xc7, 0x40, 0x6f, 0x46, 0x4c, 0x71, 0x3d,
-    0xfb, 0x18, 0x02, 0x8e, 0x01, 0xfd, 0x7e, 0x0d, 0x00, 0x01, 0x00, 0x4b, 0xff, 0xec, 0x04, 0x8e,
-    0x05, 0xc4, 0x00, 0x39, 0x00, 0x1f, 0x40, 0x0f, 0x0a, 0x26, 0x0f, 0x36, 0x31, 0x31, 0x2b, 0x09,
-    0x72, 0x18, 0x14, 0x14, 0x0f, 0x03, 0x72, 0x00, 0x2b, 0x32, 0x2f, 0x32, 0x2b, 0x32, 0x2f, 0x32,
-    0x11, 0x39, 0x39, 0x30, 0x31, 0x41, 0x34, 0x2e, 0x02, 0x27, 0x2e, 0x03, 0x35, 0x34, 0x3e, 0x02,
-    0x33, 0x32, 0x16, 0x16, 0x15, 0x23, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x15, 0x14, 0x1e,
-    0x02, 0x17, 0x1e, 0x03, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x33, 0x14, 0x1e,
-    0x02, 0x33, 0x32, 0x36, 0x36, 0x03, 0x92, 0x1b, 0x44, 0x7b, 0x5f, 0x68, 0xaf, 0x82, 0x48, 0x4b,
-    0x8b, 0xbe, 0x73, 0xa2, 0xeb, 0x7f, 0xf9, 0x3d, 0x7b, 0x5e, 0x59, 0x76, 0x3a, 0x26, 0x4e, 0x76,
-    0x50, 0x79, 0xb4, 0x78, 0x3c, 0x4a, 0x89, 0xbf, 0x75, 0x69, 0xcb, 0xa6, 0x62, 0xfb, 0x31, 0x58,
-    0x75, 0x43, 0x58, 0x77, 0x3c, 0x01, 0x77, 0x2d, 0x46, 0x3a, 0x37, 0x1d, 0x20, 0x4f, 0x69, 0x89,
-    0x5a, 0x59, 0x92, 0x6b, 0x3b, 0x78, 0xca, 0x7a, 0x48, 0x6f, 0x40, 0x36, 0x5c, 0x3a, 0x29, 0x43,
-    0x39, 0x32, 0x17, 0x24, 0x57, 0x6e, 0x8b, 0x58, 0x5c, 0x93, 0x67, 0x37, 0x38, 0x73, 0xad, 0x74,
-    0x47, 0x64, 0x3f, 0x1e, 0x32, 0x5a, 0x00, 0x02, 0x00, 0x2d, 0x00, 0x00, 0x04, 0xb4, 0x05, 0xb0,
-    0x00, 0x03, 0x00, 0x07, 0x00, 0x15, 0x40, 0x0a, 0x00, 0x03, 0x03, 0x06, 0x07, 0x02, 0x72, 0x01,
-    0x08, 0x72, 0x00, 0x2b, 0x2b, 0x32, 0x32, 0x11, 0x33, 0x30, 0x31, 0x41, 0x11, 0x23, 0x11, 0x21,
-    0x15, 0x21, 0x35, 0x02, 0xeb, 0xf9, 0x02, 0xc2, 0xfb, 0x79, 0x05, 0xb0, 0xfa, 0x50, 0x05, 0xb0,
-    0xc8, 0xc8, 0x00, 0x01, 0x00, 0x80, 0xff, 0xec, 0x04, 0xbf, 0x05, 0xb0, 0x00, 0x15, 0x00, 0x13,
-    0x40, 0x09, 0x01, 0x11, 0x06, 0x0b, 0x02, 0x72, 0x06, 0x09, 0x72, 0x00, 0x2b, 0x2b, 0x11, 0x33,
-    0x32, 0x30, 0x31, 0x41, 0x33, 0x11, 0x14, 0x06, 0x06, 0x23, 0x22, 0x26, 0x26, 0x35, 0x11, 0x33,
-    0x11, 0x14, 0x16, 0x16, 0x33, 0x32, 0x36, 0x36, 0x35, 0x03, 0xc5, 0xfa, 0x90, 0xf7, 0x98, 0x9d,
-    0xf6, 0x8d, 0xfa, 0x48, 0x84, 0x5a, 0x5a, 0x83, 0x48, 0x05, 0xb0, 0xfc, 0x33, 0xa6, 0xe0, 0x71,
-    0x71, 0xe0, 0xa6, 0x03, 0xcd, 0xfc, 0x33, 0x69, 0x87, 0x40, 0x40, 0x87, 0x69, 0x00, 0x00, 0x02,
-    0x00, 0x11, 0x00, 0x00, 0x05, 0x1b, 0x05, 0xb0, 0x00, 0x04, 0x00, 0x09, 0x00, 0x17, 0x40, 0x0b,
-    0x00, 0x06, 0x08, 0x01, 0x09, 0x02, 0x72, 0x03, 0x08, 0x08, 0x72, 0x00, 0x2b, 0x32, 0x2b, 0x32,
-    0x12, 0x39, 0x39, 0x30, 0x31, 0x41, 0x01, 0x21, 0x01, 0x23, 0x01, 0x01, 0x13, 0x23, 0x01, 0x02,
-    0x87, 0x01, 0x7f, 0x01, 0x15, 0xfd, 0xf6, 0xbb, 0xfe, 0xcf, 0x01, 0x7c, 0x34, 0xbc, 0xfd, 0xf8,
-    0x01, 0x0a, 0x04, 0xa6, 0xfa, 0x50, 0x05, 0xb0, 0xfb, 0x5a, 0xfe, 0xf6, 0x05, 0xb0, 0x00, 0x04,
-    0x00, 0x2f, 0x00, 0x00, 0x06, 0xe6, 0x05, 0xb0, 0x00, 0x05, 0x00, 0x0a, 0x00, 0x0f, 0x00, 0x15,
-    0x00, 0x1b, 0x40, 0x0d, 0x10, 0x0c, 0x01, 0x0a, 0x02, 0x72, 0x13, 0x12, 0x0e, 0x04, 0x09, 0x08,
-    0x72, 0x00, 0x2b, 0x32, 0x32, 0x32, 0x32, 0x2b, 0x32, 0x32, 0x32, 0x30, 0x31, 0x41, 0x01, 0x33,
-    0x03, 0x01, 0x23, 0x03, 0x13, 0x13, 0x23, 0x01, 0x01, 0x13, 0x33, 0x01, 0x23, 0x03, 0x01, 0x13,
-    0x23, 0x01, 0x03, 0x02, 0x01, 0x01, 0x22, 0x98, 0x11, 0xfe, 0xca, 0x9e, 0xae, 0xeb, 0x15, 0xa8,
-    0xfe, 0xaf, 0x04, 0xd5, 0xe8, 0xfa, 0xfe, 0xaf, 0xa8, 0xf7, 0x01, 0x1f, 0x2a, 0x9e, 0xfe, 0xcf,
-    0x10, 0x01, 0x47, 0x04, 0x69, 0xfe, 0xdd, 0xfb, 0x73, 0x05, 0xb0, 0xfb, 0xa0, 0xfe, 0xb0, 0x05,
-    0xb0, 0xfb, 0xa3, 0x04, 0x5d, 0xfa, 0x50, 0x05, 0xb0, 0xfb, 0x94, 0xfe, 0xbc, 0x04, 0x8d, 0x01,
-    0x23, 0x00, 0x00, 0x01, 0x00, 0x26, 0x00, 0x00, 0x04, 0xe9, 0x05, 0xb0, 0x00, 0x0b, 0x00, 0x1a,
-    0x40, 0x0e, 0x07, 0x04, 0x0a, 0x01, 0x04, 0x09, 0x03, 0x0b, 0x02, 0x72, 0x06, 0x09, 0x08, 0x72,
-    0x00, 0x2b, 0x32, 0x2b, 0x32, 0x12, 0x17, 0x39, 0x30, 0x31, 0x49, 0x02, 0x21, 0x01, 0x01, 0x21,
-    0x01, 0x01, 0x21, 0x01, 0x01, 0x01, 0x53, 0x01, 0x35, 0x01, 0x35, 0x01, 0x21, 0xfe, 0x48, 0x01,
-    0xc3, 0xfe, 0xdc, 0xfe, 0xc3, 0xfe, 0xc3, 0xfe, 0xdb, 0x01, 0xc4, 0xfe, 0x47, 0x05, 0xb0, 0xfd,
-    0xed, 0x02, 0x13, 0xfd, 0x2f, 0xfd, 0x21, 0x02, 0x1d, 0xfd, 0xe3, 0x02, 0xdf, 0x02, 0xd1, 0x00,
-    0x00, 0x01, 0x00, 0x08, 0x00, 0x00, 0x04, 0xd9, 0x05, 0xb0, 0x00, 0x08, 0x00, 0x17, 0x40, 0x0c,
-    0x04, 0x07, 0x01, 0x03, 0x06, 0x03, 0x08, 0x02, 0x72, 0x06, 0x08, 0x72, 0x00, 0x2b, 0x2b, 0x32,
-    0x12, 0x17, 0x39, 0x30, 0x31, 0x49, 0x02, 0x21, 0x01, 0x11, 0x23, 0x11, 0x01, 0x01, 0x1f, 0x01,
-    0x52, 0x01, 0x52, 0x01, 0x16, 0xfe, 0x16, 0xfd, 0xfe, 0x16, 0x05, 0xb0, 0xfd, 0x49, 0x02, 0xb7,
-    0xfc, 0x68, 0xfd, 0xe8, 0x02, 0x18, 0x03, 0x98, 0x00, 0x03, 0x00, 0x50, 0x00, 0x00, 0x04, 0x8e,
-    0x05, 0xb0, 0x00, 0x03, 0x00, 0x09, 0x00, 0x0d, 0x00, 0x1f, 0x40, 0x0f, 0x04, 0x0c, 0x0c, 0x09,
-    0x0d, 0x02, 0x72, 0x07, 0x03, 0x03, 0x02, 0x02, 0x06, 0x08, 0x72, 0x00, 0x2b, 0x32, 0x11, 0x33,
-    0x11, 0x33, 0x2b, 0x32, 0x32, 0x11, 0x33, 0x30, 0x31, 0x65, 0x15, 0x21, 0x35, 0x01, 0x01, 0x23,
-    0x35, 0x01, 0x33, 0x23, 0x15, 0x21, 0x35, 0x04, 0x8e, 0xfc, 0x0d, 0x03, 0xdc, 0xfc, 0x81, 0xa8,
-    0x03, 0x82, 0xa5, 0x5d, 0xfc, 0x3c, 0xc7, 0xc7, 0xc7, 0x04, 0x4e, 0xfa, 0xeb, 0x9f, 0x05, 0x11,
-    0xc8, 0xc8, 0x00, 0x01, 0x00, 0x85, 0xfe, 0xba, 0x02, 0x1a, 0x06, 0x8f, 0x00, 0x07, 0x00, 0x0e,
-    0xb4, 0x03, 0x06, 0x02, 0x07, 0x06, 0x00, 0x2f, 0x2f, 0x33, 0x11, 0x33, 0x30, 0x31, 0x41, 0x15,
-    0x23, 0x11, 0x33, 0x15, 0x21, 0x11, 0x02, 0x1a, 0xa4, 0xa4, 0xfe, 0x6b, 0x06, 0x8f, 0xba, 0xf9,
-    0xa0, 0xbb, 0x07, 0xd5, 0x00, 0x01, 0x00, 0x12, 0xff, 0x83, 0x03, 0x63, 0x05, 0xb0, 0x00, 0x03,
-    0x00, 0x09, 0xb2, 0x01, 0x02, 0x00, 0x00, 0x2f, 0x3f, 0x30, 0x31, 0x45, 0x01, 0x33, 0x01, 0x02,
-    0x72, 0xfd, 0xa0, 0xf1, 0x02, 0x60, 0x7d, 0x06, 0x2d, 0xf9, 0xd3, 0x00, 0x00, 0x01, 0x00, 0x0b,
-    0xfe, 0xba, 0x01, 0xa2, 0x06, 0x8f, 0x00, 0x07, 0x00, 0x0e, 0xb4, 0x05, 0x04, 0x00, 0x01, 0x04,
-    0x00, 0x2f, 0x2f, 0x33, 0x11, 0x33, 0x30, 0x31, 0x53, 0x35, 0x21, 0x11, 0x21, 0x35, 0x33, 0x11,
-    0x0b, 0x01, 0x97, 0xfe, 0x69, 0xa6, 0x05, 0xd5, 0xba, 0xf8, 0x2b, 0xbb, 0x06, 0x60, 0x00, 0x02,
-    0x00, 0x36, 0x02, 0xd9, 0x03, 0x38, 0x05, 0xb0, 0x00, 0x04, 0x00, 0x09, 0x00, 0x16, 0x40, 0x09,
-    0x08, 0x07, 0x07, 0x06, 0x00, 0x05, 0x02, 0x03, 0x02, 0x00, 0x3f, 0xcd, 0x32, 0x39, 0x39, 0x33,
-    0x11, 0x33, 0x30, 0x31, 0x41, 0x03, 0x23, 0x01, 0x33, 0x13, 0x03, 0x27, 0x33, 0x01, 0x01, 0xc1,
-    0xc1, 0xca, 0x01, 0x2b, 0x8c, 0x81, 0xc1, 0x2c, 0x8d, 0x01, 0x2a, 0x04, 0xcb, 0xfe, 0x0e, 0x02,
-    0xd7, 0xfd, 0x29, 0x01, 0xf2, 0xe5, 0xfd, 0x29, 0x00, 0x01, 0x00, 0x02, 0xff, 0x44, 0x03, 0x92,
-    0x00, 0x00, 0x00, 0x03, 0x00, 0x08, 0xb1, 0x02, 0x03, 0x00, 0x2f, 0x33, 0x30, 0x31, 0x61, 0x15,
-    0x21, 0x35, 0x03, 0x92, 0xfc, 0x70, 0xbc, 0xbc, 0x00, 0x01, 0x00, 0x38, 0x04, 0xd3, 0x02, 0x0c,
-    0x06, 0x00, 0x00, 0x03, 0x00, 0x0a, 0xb2, 0x03, 0x80, 0x02, 0x00, 0x2f, 0x1a, 0xcd, 0x30, 0x31,
-    0x41, 0x13, 0x23, 0x01, 0x01, 0x49, 0xc3, 0xc9, 0xfe, 0xf5, 0x06, 0x00, 0xfe, 0xd3, 0x01, 0x2d,
-    0x00, 0x02, 0x00, 0x56, 0xff, 0xec, 0x03, 0xf9, 0x04, 0x4e, 0x00, 0x1b, 0x00, 0x3a, 0x00, 0x29,
-    0x40, 0x15, 0x2b, 0x2c, 0x1e, 0x27, 0x1e, 0x3a, 0x3a, 0x0f, 0x27, 0x31, 0x0b, 0x72, 0x18, 0x19,
-    0x0a, 0x72, 0x09, 0x05, 0x0f, 0x07, 0x72, 0x00, 0x2b, 0x32, 0x32, 0x2b, 0x32, 0x2b, 0x32, 0x12,
-    0x39, 0x2f, 0x33, 0x11, 0x12, 0x39, 0x39, 0x30, 0x31, 0x65, 0x11, 0x34, 0x26, 0x26, 0x23, 0x22,
-    0x06, 0x06, 0x15, 0x23, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x16, 0x16, 0x15, 0x11, 0x14, 0x16, 0x17,
-    0x15, 0x23, 0x26, 0x26, 0x13, 0x17, 0x23, 0x22, 0x0e, 0x02, 0x15, 0x14, 0x16, 0x16, 0x33, 0x32,
-    0x36, 0x36, 0x37, 0x17, 0x0e, 0x03, 0x23, 0x22, 0x26, 0x26, 0x35, 0x34, 0x3e, 0x02, 0x33, 0x02,
-    0xde, 0x2a, 0x55, 0x40, 0x3b, 0x56, 0x30, 0xf0, 0x3e, 0x76, 0xa4, 0x66, 0x7a, 0xbd, 0x6d, 0x15,
-    0x14, 0xf7, 0x11, 0x13, 0x23, 0x02, 0xad, 0x43, 0x66, 0x44, 0x22, 0x28, 0x4d, 0x37, 0x4a, 0x6f,
-    0x40, 0x02, 0x4e, 0x0c, 0x3a, 0x5d, 0x81, 0x54, 0x6a, 0xa6, 0x5e, 0x41, 0x7f, 0xb8, 0x76, 0xd9,
-    0x02, 0x04, 0x3a, 0x54, 0x2e, 0x28, 0x44, 0x2b, 0x40, 0x78, 0x5e, 0x36, 0x52, 0xa5, 0x7c, 0xfe,
-    0x1f, 0x4a, 0x75, 0x2b, 0x10, 0x27, 0x79, 0x01, 0xf2, 0x95, 0x19, 0x30, 0x44, 0x2b, 0x2b, 0x47,
-    0x28, 0x3d, 0x59, 0x28, 0x6b, 0x29, 0x5e, 0x55, 0x36, 0x55, 0x91, 0x5c, 0x56, 0x85, 0x5a, 0x2f,
-    0x00, 0x03, 0x00, 0x7d, 0xff, 0xec, 0x04, 0x30, 0x06, 0x00, 0x00, 0x04, 0x00, 0x1a, 0x00, 0x2f,
-    0x00, 0x19, 0x40, 0x0e, 0x21, 0x16, 0x07, 0x72, 0x2b, 0x0b, 0x0b, 0x72, 0x04, 0x0a, 0x72, 0x00,
-    0x00, 0x72, 0x00, 0x2b, 0x2b, 0x2b, 0x32, 0x2b, 0x32, 0x30, 0x31, 0x53, 0x33, 0x11, 0x07, 0x23,
-    0x01, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x27, 0x35, 0x3e, 0x03, 0x33, 0x32, 0x1e,
-    0x02, 0x07, 0x35, 0x34, 0x2e, 0x02, 0x23, 0x22, 0x0e, 0x02, 0x07, 0x15, 0x1e, 0x02, 0x33, 0x32,
-    0x3e, 0x02, 0x7d, 0xf1, 0x17, 0xda, 0x03, 0xb3, 0x35, 0x6b, 0x9d, 0x67, 0x65, 0x96, 0x65, 0x3e,
-    0x0d, 0x0d, 0x3e, 0x65, 0x95, 0x64, 0x68, 0x9f, 0x6a, 0x35, 0xf1, 0x18, 0x37, 0x5d, 0x45, 0x40,
-    0x5c, 0x3e, 0x23, 0x06, 0x09, 0x3b, 0x6c, 0x55, 0x43, 0x5c, 0x37, 0x19, 0x06, 0x00, 0xfa, 0xe7,
-    0xe7, 0x02, 0x27, 0x15, 0x78, 0xc9, 0x94, 0x51, 0x4c, 0x8c, 0xc2, 0x75, 0x43, 0x76, 0xc1, 0x8d,
-    0x4c, 0x50, 0x93, 0xca, 0x8f, 0x15, 0x49, 0x81, 0x62, 0x39, 0x2c, 0x4c, 0x64, 0x3a, 0xb5, 0x4b,
-    0x7d, 0x4b, 0x36, 0x61, 0x82, 0x00, 0x00, 0x01, 0x00, 0x4e, 0xff, 0xec, 0x03, 0xf1, 0x04, 0x4e,
-    0x00, 0x27, 0x00, 0x19, 0x40, 0x0c, 0x1d, 0x19, 0x19, 0x14, 0x07, 0x72, 0x04, 0x04, 0x00, 0x09,
-    0x0b, 0x72, 0x00, 0x2b, 0x32, 0x32, 0x2f, 0x2b, 0x32, 0x2f, 0x32, 0x30, 0x31, 0x65, 0x32, 0x36,
-    0x36, 0x37, 0x33, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x35, 0x34, 0x3e, 0x02, 0x33, 0x32,
-    0x16, 0x16, 0x17, 0x23, 0x2e, 0x02, 0x23, 0x22, 0x0e, 0x02, 0x15, 0x15, 0x14, 0x1e, 0x02, 0x02,
-    0x36, 0x3b, 0x5f, 0x3b, 0x03, 0xe3, 0x02, 0x78, 0xc6, 0x78, 0x7c, 0xb8, 0x7a, 0x3d, 0x3d, 0x7a,
-    0xb8, 0x7b, 0x82, 0xc4, 0x71, 0x02, 0xe3, 0x03, 0x35, 0x5f, 0x42, 0x49, 0x60, 0x36, 0x17, 0x16,
-    0x37, 0x60, 0xac, 0x2f, 0x54, 0x37, 0x69, 0xac, 0x65, 0x55, 0x96, 0xc4, 0x70, 0x23, 0x70, 0xc5,
-    0x96, 0x55, 0x67, 0xb7, 0x79, 0x3c, 0x61, 0x3a, 0x3b, 0x65, 0x7d, 0x43, 0x23, 0x43, 0x7e, 0x63,
-    0x3b, 0x00, 0x00, 0x03, 0x00, 0x50, 0xff, 0xec, 0x04, 0x02, 0x06, 0x00, 0x00, 0x04, 0x00, 0x1a,
-    0x00, 0x2f, 0x00, 0x19, 0x40, 0x0d, 0x21, 0x04, 0x04, 0x16, 0x0b, 0x72, 0x2b, 0x0b, 0x07, 0x72,
-    0x01, 0x00, 0x72, 0x00, 0x2b, 0x2b, 0x32, 0x2b, 0x32, 0x2f, 0x32, 0x30, 0x31, 0x65, 0x11, 0x33,
-    0x11, 0x23, 0x01, 0x35, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x1e, 0x02, 0x17, 0x15, 0x0e, 0x03, 0x23,
-    0x22, 0x2e, 0x02, 0x37, 0x15, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x36, 0x36, 0x37, 0x35, 0x2e, 0x03,
-    0x23, 0x22, 0x0e, 0x02, 0x03, 0x10, 0xf2, 0xdb, 0xfd, 0x29, 0x3a, 0x6e, 0x9e, 0x63, 0x62, 0x94,
-    0x68, 0x3e, 0x0d, 0x0d, 0x3e, 0x68, 0x95, 0x63, 0x62, 0x9d, 0x6e, 0x3a, 0xf1, 0x1b, 0x3a, 0x5d,
-    0x41, 0x52, 0x6a, 0x3d, 0x0b, 0x06, 0x25, 0x3e, 0x5b, 0x3e, 0x42, 0x5c, 0x3b, 0x1c, 0xe0, 0x05,
-    0x20, 0xfa, 0x00, 0x02, 0x11, 0x15, 0x7b, 0xcb, 0x93, 0x4f, 0x4c, 0x8d, 0xc3, 0x77, 0x43, 0x74,
-    0xc0, 0x8c, 0x4c, 0x52, 0x94, 0xc9, 0x8b, 0x15, 0x4a, 0x80, 0x61, 0x37, 0x48, 0x7b, 0x4c, 0xb5,
-    0x3b, 0x66, 0x4d, 0x2b, 0x38, 0x62, 0x82, 0x00, 0x00, 0x01, 0x00, 0x51, 0xff, 0xec, 0x04, 0x0a,
-    0x04, 0x4e, 0x00, 0x2b, 0x00, 0x1f, 0x40, 0x10, 0x67, 0x13, 0x01, 0x06, 0x13, 0x12, 0x12, 0x00,
-    0x19, 0x0b, 0x07, 0x72, 0x24, 0x00, 0x0b, 0x72, 0x00, 0x2b, 0x32, 0x2b, 0x32, 0x11, 0x39, 0x2f,
-    0x33, 0x5f, 0x5d, 0x30, 0x31, 0x45, 0x22, 0x2e, 0x02, 0x35, 0x35, 0x34, 0x3e, 0x02, 0x33, 0x32,
-    0x1e, 0x02, 0x15, 0x15, 0x21, 0x35, 0x21, 0x35, 0x2e, 0x02, 0x23, 0x22, 0x0e, 0x02, 0x15, 0x15,
-    0x14, 0x1e, 0x02, 0x33, 0x32, 0x36, 0x37, 0x17, 0x0e, 0x02, 0x02, 0x59, 0x78, 0xc1, 0x87, 0x48,
-    0x4a, 0x84, 0xb4, 0x69, 0x74, 0xae, 0x73, 0x39, 0xfc, 0xbc, 0x02, 0x56, 0x02, 0x2f, 0x60, 0x50,
-    0x3c, 0x5d, 0x3e, 0x21, 0x27, 0x4c, 0x6c, 0x45, 0x57, 0x88, 0x32, 0x7f, 0x23, 0x70, 0xa1, 0x14,
-    0x4f, 0x8e, 0xc0, 0x6f, 0x28, 0x7f, 0xce, 0x93, 0x4e, 0x4e, 0x8d, 0xc2, 0x75, 0x67, 0xad, 0x13,
-    0x41, 0x72, 0x46, 0x33, 0x60, 0x87, 0x54, 0x28, 0x47, 0x79, 0x5a, 0x33, 0x46, 0x40, 0x7b, 0x33,
-    0x5d, 0x3a, 0x00, 0x02, 0x00, 0x2b, 0x00, 0x00, 0x02, 0xd5, 0x06, 0x15, 0x00, 0x11, 0x00, 0x15,
-    0x00, 0x15, 0x40, 0x0b, 0x14, 0x15, 0x06, 0x72, 0x0d, 0x06, 0x01, 0x72, 0x01, 0x0a, 0x72, 0x00,
-    0x2b, 0x2b, 0x32, 0x2b, 0x32, 0x30, 0x31, 0x61, 0x23, 0x11, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16,
-    0x17, 0x07, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x15, 0x17, 0x15, 0x21, 0x35, 0x01, 0xc2, 0xf1,
-    0x5b, 0xaa, 0x74, 0x24, 0x46, 0x21, 0x06, 0x14, 0x2f, 0x1b, 0x37, 0x4f, 0x29, 0xdf, 0xfd, 0x8a,
-    0x04, 0xa2, 0x79, 0xa5, 0x55, 0x09, 0x09, 0xba, 0x05, 0x04, 0x29, 0x4e, 0x39, 0x68, 0xb0, 0xb0,
-    0x00, 0x03, 0x00, 0x52, 0xfe, 0x55, 0x04, 0x0c, 0x04, 0x4e, 0x00, 0x13, 0x00, 0x29, 0x00, 0x3e,
-    0x00, 0x1b, 0x40, 0x0f, 0x30, 0x25, 0x0b, 0x72, 0x3a, 0x1a, 0x07, 0x72, 0x0e, 0x06, 0x0f, 0x72,
-    0x00, 0x06, 0x72, 0x00, 0x2b, 0x2b, 0x32, 0x2b, 0x32, 0x2b, 0x32, 0x30, 0x31, 0x41, 0x33, 0x11,
-    0x14, 0x06, 0x06, 0x23, 0x22, 0x26, 0x26, 0x27, 0x37, 0x16, 0x16, 0x33, 0x32, 0x36, 0x36, 0x35,
-    0x11, 0x01, 0x35, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x1e, 0x02, 0x17, 0x15, 0x0e, 0x03, 0x23, 0x22,
-    0x2e, 0x02, 0x37, 0x15, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x36, 0x36, 0x37, 0x35, 0x2e, 0x03, 0x23,
-    0x22, 0x0e, 0x02, 0x03, 0x31, 0xdb, 0x7c, 0xde, 0x92, 0x3e, 0x97, 0x8d, 0x2f, 0x71, 0x3a, 0x8c,
-    0x4d, 0x53, 0x75, 0x40, 0xfd, 0x37, 0x3c, 0x70, 0xa0, 0x65, 0x69, 0x95, 0x64, 0x39, 0x0e, 0x0d,
-    0x3e, 0x66, 0x95, 0x65, 0x63, 0x9f, 0x71, 0x3c, 0xf1, 0x1d, 0x3d, 0x5f, 0x41, 0x55, 0x6d, 0x3b,
-    0x0c, 0x06, 0x25, 0x3e, 0x5e, 0x40, 0x41, 0x60, 0x3d, 0x1e, 0x04, 0x3a, 0xfb, 0xe4, 0x92, 0xcc,
-    0x6b, 0x24, 0x4f, 0x40, 0x8e, 0x45, 0x40, 0x3d, 0x76, 0x55, 0x03, 0x2c, 0xfe, 0xcc, 0x15, 0x7b,
-    0xcb, 0x93, 0x4f, 0x4c, 0x8d, 0xc3, 0x77, 0x43, 0x74, 0xc0, 0x8c, 0x4c, 0x52, 0x94, 0xc9, 0x8b,
-    0x15, 0x4a, 0x80, 0x61, 0x37, 0x48, 0x7b, 0x4c, 0xb5, 0x3b, 0x66, 0x4d, 0x2b, 0x38, 0x62, 0x82,
-    0x00, 0x02, 0x00, 0x7a, 0x00, 0x00, 0x03, 0xfa, 0x06, 0x00, 0x00, 0x03, 0x00, 0x1a, 0x00, 0x17,
-    0x40, 0x0c, 0x11, 0x02, 0x16, 0x0a, 0x07, 0x72, 0x03, 0x00, 0x72, 0x02, 0x0a, 0x72, 0x00, 0x2b,
-    0x2b, 0x2b, 0x32, 0x11, 0x33, 0x30, 0x31, 0x41, 0x11, 0x23, 0x11, 0x13, 0x27, 0x3e, 0x03, 0x33,
-    0x32, 0x1e, 0x02, 0x15, 0x11, 0x23, 0x11, 0x34, 0x26, 0x26, 0x23, 0x22, 0x0e, 0x02, 0x01, 0x6a,
-    0xf0, 0xc6, 0x4e, 0x01, 0x3d, 0x6f, 0x9c, 0x5f, 0x50, 0x81, 0x5e, 0x31, 0xf2, 0x2d, 0x56, 0x3e,
-    0x41, 0x63, 0x42, 0x21, 0x06, 0x00, 0xfa, 0x00, 0x06, 0x00, 0xfc, 0x45, 0x01, 0x70, 0xbe, 0x8d,
-    0x4d, 0x2c, 0x61, 0x9b, 0x6f, 0xfd, 0x49, 0x02, 0xb9, 0x4e, 0x5c, 0x29, 0x34, 0x5a, 0x76, 0x00,
-    0x00, 0x02, 0x00, 0x7c, 0x00, 0x00, 0x01, 0x90, 0x05, 0xd6, 0x00, 0x03, 0x00, 0x0f, 0x00, 0x10,
-    0xb7, 0x07, 0x0d, 0x03, 0x06, 0x72, 0x02, 0x0a, 0x72, 0x00, 0x2b, 0x2b, 0xce, 0x32, 0x30, 0x31,
-    0x41, 0x11, 0x23, 0x11, 0x03, 0x34, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14, 0x06, 0x23, 0x22, 0x26,
-    0x01, 0x7e, 0xf2, 0x10, 0x49, 0x41, 0x40, 0x4a, 0x4a, 0x40, 0x41, 0x49, 0x04, 0x3a, 0xfb, 0xc6,
-    0x04, 0x3a, 0x01, 0x1c, 0x37, 0x49, 0x49, 0x37, 0x36, 0x48, 0x48, 0x00, 0x00, 0x02, 0xff, 0xab,
-    0xfe, 0x4b, 0x01, 0x87, 0x05, 0xd6, 0x00, 0x11, 0x00, 0x1d, 0x00, 0x13, 0x40, 0x09, 0x0d, 0x06,
-    0x0f, 0x72, 0x15, 0x1b, 0x00, 0x06, 0x72, 0x00, 0x2b, 0xce, 0x32, 0x2b, 0x32, 0x30, 0x31, 0x53,
-    0x33, 0x11, 0x14, 0x06, 0x06, 0x23, 0x22, 0x26, 0x27, 0x37, 0x16, 0x16, 0x33, 0x32, 0x36, 0x36,
-    0x35, 0x03, 0x34, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14, 0x06, 0x23, 0x22, 0x26, 0x88, 0xf2, 0x4c,
-    0x94, 0x6b, 0x20, 0x45, 0x1f, 0x01, 0x15, 0x2f, 0x15, 0x2b, 0x3a, 0x1e, 0x15, 0x4a, 0x40, 0x41,
-    0x49, 0x49, 0x41, 0x40, 0x4a, 0x04, 0x3a, 0xfb, 0x68, 0x6f, 0x99, 0x4f, 0x09, 0x08, 0xbc, 0x04,
-    0x05, 0x1e, 0x40, 0x35, 0x05, 0xb4, 0x37, 0x49, 0x49, 0x37, 0x36, 0x48, 0x48, 0x00, 0x00, 0x03,
-    0x00, 0x7d, 0x00, 0x00, 0x04, 0x37, 0x06, 0x00, 0x00, 0x03, 0x00, 0x09, 0x00, 0x0d, 0x00, 0x1d,
-    0x40, 0x11, 0x06, 0x07, 0x0b, 0x05, 0x0c, 0x08, 0x06, 0x02, 0x09, 0x06, 0x03, 0x00, 0x72, 0x0a,
-    0x02, 0x0a, 0x72, 0x00, 0x2b, 0x32, 0x2b, 0x3f, 0x12, 0x17, 0x39, 0x30, 0x31, 0x41, 0x11, 0x23,
-    0x11, 0x09, 0x02, 0x27, 0x37, 0x01, 0x13, 0x01, 0x37, 0x01, 0x01, 0x6f, 0xf2, 0x03, 0x92, 0xfe,
-    0x29, 0xfe, 0xfe, 0x3f, 0xc3, 0x01, 0x32, 0x34, 0xfe, 0xa1, 0x98, 0x01, 0xde, 0x06, 0x00, 0xfa,
-    0x00, 0x06, 0x00, 0xfe, 0x3a, 0xfd, 0xf6, 0xfe, 0xf8, 0xcc, 0xf1, 0x01, 0x55, 0xfb, 0xc6, 0x01,
-    0xfc, 0xa9, 0xfd, 0x5b, 0x00, 0x01, 0x00, 0x8c, 0x00, 0x00, 0x01, 0x7e, 0x06, 0x00, 0x00, 0x03,
-    0x00, 0x0c, 0xb5, 0x03, 0x00, 0x72, 0x02, 0x0a, 0x72, 0x00, 0x2b, 0x2b, 0x30, 0x31, 0x41, 0x11,
-    0x23, 0x11, 0x01, 0x7e, 0xf2, 0x06, 0x00, 0xfa, 0x00, 0x06, 0x00, 0x00, 0x00, 0x03, 0x00, 0x7c,
-    0x00, 0x00, 0x06, 0x7c, 0x04, 0x4e, 0x00, 0x04, 0x00, 0x1b, 0x00, 0x32, 0x00, 0x21, 0x40, 0x11,
-    0x29, 0x12, 0x02, 0x2e, 0x22, 0x22, 0x17, 0x0b, 0x03, 0x06, 0x72, 0x0b, 0x07, 0x72, 0x02, 0x0a,
-    0x72, 0x00, 0x2b, 0x2b, 0x2b, 0x11, 0x33, 0x33, 0x11, 0x33, 0x11, 0x33, 0x33, 0x30, 0x31, 0x41,
-    0x11, 0x23, 0x11, 0x33, 0x03, 0x27, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x11, 0x23,
-    0x11, 0x34, 0x26, 0x26, 0x23, 0x22, 0x0e, 0x02, 0x05, 0x07, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x1e,
-    0x02, 0x15, 0x11, 0x23, 0x11, 0x34, 0x26, 0x26, 0x23, 0x22, 0x0e, 0x02, 0x01, 0x6d, 0xf1, 0xe3,
-    0x19, 0x52, 0x38, 0x6c, 0xa1, 0x6a, 0x4a, 0x7b, 0x5b, 0x31, 0xf1, 0x2f, 0x57, 0x3c, 0x44, 0x5f,
-    0x3c, 0x1c, 0x02, 0x9f, 0x71, 0x37, 0x6b, 0x9e, 0x66, 0x53, 0x83, 0x5c, 0x30, 0xf2, 0x2f, 0x56,
-    0x3c, 0x38, 0x55, 0x3a, 0x1d, 0x03, 0x5e, 0xfc, 0xa2, 0x04, 0x3a, 0xfe, 0x0b, 0x01, 0x70, 0xbe,
-    0x8d, 0x4d, 0x2b, 0x5c, 0x90, 0x66, 0xfd, 0x2f, 0x02, 0xbc, 0x4f, 0x5a, 0x27, 0x34, 0x5a, 0x76,
-    0x03, 0x19, 0x62, 0xaf, 0x85, 0x4c, 0x2d, 0x60, 0x99, 0x6c, 0xfd, 0x44, 0x02, 0xbd, 0x52, 0x5a,
-    0x23, 0x29, 0x49, 0x5e, 0x00, 0x02, 0x00, 0x7a, 0x00, 0x00, 0x03, 0xfa, 0x04, 0x4e, 0x00, 0x04,
-    0x00, 0x1b, 0x00, 0x19, 0x40, 0x0d, 0x12, 0x02, 0x17, 0x0b, 0x03, 0x06, 0x72, 0x0b, 0x07, 0x72,
-    0x02, 0x0a, 0x72, 0x00, 0x2b, 0x2b, 0x2b, 0x11, 0x33, 0x11, 0x33, 0x30, 0x31, 0x41, 0x11, 0x23,
-    0x11, 0x33, 0x03, 0x27, 0x3e, 0x03, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x11, 0x23, 0x11, 0x34, 0x26,
-    0x26, 0x23, 0x22, 0x0e, 0x02, 0x01, 0x6b, 0xf1, 0xe3, 0x1d, 0x4e, 0x01, 0x3f, 0x71, 0x9e, 0x61,
-    0x4e, 0x7f, 0x5b, 0x30, 0xf2, 0x2d, 0x55, 0x3f, 0x3e, 0x62, 0x43, 0x24, 0x03, 0x53, 0xfc, 0xad,
-    0x04, 0x3a, 0xfe, 0x0b, 0x01, 0x73, 0xc0, 0x8a, 0x4b, 0x2b, 0x60, 0x99, 0x6f, 0xfd, 0x45, 0x02,
-    0xbc, 0x4e, 0x5b, 0x27, 0x34, 0x5a, 0x76, 0x00, 0x00, 0x02, 0x00, 0x4e, 0xff, 0xec, 0x04, 0x3c,
-    0x04, 0x4e, 0x00, 0x15, 0x00, 0x2b, 0x00, 0x10, 0xb7, 0x1c, 0x11, 0x0b, 0x72, 0x27, 0x06, 0x07,
-    0x72, 0x00, 0x2b, 0x32, 0x2b, 0x32, 0x30, 0x31, 0x53, 0x35, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x1e,
-    0x02, 0x15, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x37, 0x15, 0x14, 0x1e, 0x02, 0x33,
-    0x32, 0x3e, 0x02, 0x35, 0x35, 0x34, 0x2e, 0x02, 0x23, 0x22, 0x0e, 0x02, 0x4e, 0x44, 0x81, 0xbb,
-    0x76, 0x77, 0xbb, 0x82, 0x44, 0x44, 0x82, 0xba, 0x76, 0x77, 0xbb, 0x82, 0x44, 0xf1, 0x1e, 0x40,
-    0x64, 0x45, 0x43, 0x63, 0x40, 0x1f, 0x1f, 0x41, 0x63, 0x44, 0x44, 0x63, 0x40, 0x1e, 0x02, 0x11,
-    0x17, 0x75, 0xc9, 0x95, 0x53, 0x53, 0x95, 0xc9, 0x75, 0x17, 0x75, 0xc8, 0x95, 0x53, 0x53, 0x95,
-    0xc8, 0x8c, 0x17, 0x49, 0x82, 0x62, 0x38, 0x38, 0x62, 0x82, 0x49, 0x17, 0x48, 0x81, 0x64, 0x39,
-    0x39, 0x64, 0x81, 0x00, 0x00, 0x03, 0x00, 0x7d, 0xfe, 0x60, 0x04, 0x2f, 0x04, 0x4e, 0x00, 0x04,
-    0x00, 0x1a, 0x00, 0x2f, 0x00, 0x19, 0x40, 0x0e, 0x21, 0x16, 0x07, 0x72, 0x2b, 0x0b, 0x0b, 0x72,
-    0x03, 0x06, 0x72, 0x02, 0x0e, 0x72, 0x00, 0x2b, 0x2b, 0x2b, 0x32, 0x2b, 0x32, 0x30, 0x31, 0x41,
-    0x11, 0x23, 0x11, 0x33, 0x01, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x27, 0x35, 0x3e,
-    0x03, 0x33, 0x32, 0x1e, 0x02, 0x07, 0x35, 0x34, 0x2e, 0x02, 0x23, 0x22, 0x0e, 0x02, 0x07, 0x15,
-    0x1e, 0x02, 0x33, 0x32, 0x3e, 0x02, 0x01, 0x6e, 0xf1, 0xde, 0x02, 0xd4, 0x37, 0x6b, 0x9c, 0x66,
-    0x65, 0x97, 0x68, 0x3f, 0x0d, 0x0d, 0x3f, 0x68, 0x96, 0x64, 0x66, 0x9e, 0x6c, 0x36, 0xf1, 0x1c,
-    0x3c, 0x5d, 0x41, 0x40, 0x5c, 0x3e, 0x22, 0x07, 0x0c, 0x3a, 0x6b, 0x54, 0x41, 0x5c, 0x3b, 0x1c,
-    0x03, 0x6a, 0xfa, 0xf6, 0x05, 0xda, 0xfd, 0xed, 0x15, 0x76, 0xc9, 0x95, 0x52, 0x4b, 0x8a, 0xbb,
-    0x70, 0x51, 0x77, 0xc2, 0x8c, 0x4c, 0x4f, 0x91, 0xcb, 0x91, 0x15, 0x4b, 0x81, 0x62, 0x37, 0x2b,
-    0x4c, 0x65, 0x3b, 0xc2, 0x48, 0x78, 0x47, 0x38, 0x63, 0x82, 0x00, 0x03, 0x00, 0x50, 0xfe, 0x60,
-    0x04, 0x02, 0x04, 0x4e, 0x00, 0x04, 0x00, 0x1a, 0x00, 0x2f, 0x00, 0x19, 0x40, 0x0e, 0x21, 0x16,
-    0x0b, 0x72, 0x2b, 0x0b, 0x07, 0x72, 0x04, 0x0e, 0x72, 0x03, 0x06, 0x72, 0x00, 0x2b, 0x2b, 0x2b,
-    0x32, 0x2b, 0x32, 0x30, 0x31, 0x41, 0x11, 0x37, 0x33, 0x11, 0x01, 0x35, 0x34, 0x3e, 0x02, 0x33,
-    0x32, 0x1e, 0x02, 0x17, 0x15, 0x0e, 0x03, 0x23, 0x22, 0x2e, 0x02, 0x37, 0x15, 0x14, 0x1e, 0x02,
-    0x33, 0x32, 0x36, 0x36, 0x37, 0x35, 0x2e, 0x03, 0x23, 0x22, 0x0e, 0x02, 0x03, 0x0f, 0x1c, 0xd7,
-    0xfc, 0x4e, 0x38, 0x6e, 0x9e, 0x67, 0x64, 0x95, 0x67, 0x3e, 0x0e, 0x0d, 0x3e, 0x68, 0x96, 0x65,
-    0x65, 0x9e, 0x6d, 0x39, 0xf1, 0x1b, 0x3c, 0x5c, 0x41, 0x55, 0x6d, 0x3b, 0x0c, 0x07, 0x24, 0x3f,
-    0x5d, 0x40, 0x41, 0x5e, 0x3b, 0x1c, 0xfe, 0x60, 0x05, 0x03, 0xd7, 0xfa, 0x26, 0x03, 0xb2, 0x15,
-    0x7b, 0xcb, 0x92, 0x4f, 0x4c, 0x8d, 0xc2, 0x77, 0x43, 0x74, 0xc0, 0x8c, 0x4d, 0x52, 0x95, 0xc9,
-    0x8b, 0x15, 0x4a, 0x81, 0x63, 0x38, 0x4a, 0x7d, 0x4c, 0xb5, 0x3b, 0x67, 0x4d, 0x2b, 0x38, 0x63,
-    0x82, 0x00, 0x00, 0x02, 0x00, 0x7d, 0x00, 0x00, 0x02, 0xb9, 0x04, 0x4e, 0x00, 0x04, 0x00, 0x16,
-    0x00, 0x19, 0x40, 0x0d, 0x06, 0x09, 0x09, 0x05, 0x14, 0x07, 0x72, 0x03, 0x06, 0x72, 0x02, 0x0a,
-    0x72, 0x00, 0x2b, 0x2b, 0x2b, 0x32, 0x32, 0x11, 0x33, 0x30, 0x31, 0x41, 0x11, 0x23, 0x11, 0x33,
-    0x25, 0x07, 0x26, 0x26, 0x23, 0x22, 0x0e, 0x02, 0x07, 0x07, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x16,
-    0x01, 0x6e, 0xf1, 0xe6, 0x01, 0x56, 0x02, 0x16, 0x33, 0x19, 0x3e, 0x5e, 0x3f, 0x22, 0x03, 0x37,
-    0x28, 0x51, 0x7b, 0x51, 0x16, 0x33, 0x03, 0x6c, 0xfc, 0x94, 0x04, 0x3a, 0x07, 0xe0, 0x04, 0x04,
-    0x23, 0x41, 0x5c, 0x39, 0x04, 0x66, 0xae, 0x84, 0x4a, 0x08, 0x00, 0x01, 0x00, 0x49, 0xff, 0xec,
-    0x03, 0xc7, 0x04, 0x4e, 0x00, 0x35, 0x00, 0x17, 0x40, 0x0b, 0x1b, 0x00, 0x0e, 0x32, 0x29, 0x0b,
-    0x72, 0x17, 0x0e, 0x07, 0x72, 0x00, 0x2b, 0x32, 0x2b, 0x32, 0x11, 0x39, 0x39, 0x30, 0x31, 0x41,
-    0x34, 0x26, 0x26, 0x27, 0x2e, 0x03, 0x35, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x16, 0x16, 0x15, 0x23,
-    0x34, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x15, 0x14, 0x1e, 0x02, 0x17, 0x1e, 0x02, 0x15, 0x14,
-    0x0e, 0x02, 0x23, 0x22, 0x26, 0x26, 0x35, 0x33, 0x1e, 0x02, 0x33, 0x32, 0x36, 0x36, 0x02, 0xdb,
-    0x24, 0x65, 0x62, 0x56, 0x8f, 0x66, 0x38, 0x3a, 0x6c, 0x9b, 0x60, 0x88, 0xc3, 0x68, 0xf1, 0x2b,
-    0x56, 0x41, 0x3e, 0x51, 0x27, 0x15, 0x32, 0x57, 0x42, 0x7c, 0xb3, 0x60, 0x3d, 0x74, 0xa1, 0x64,
-    0x93, 0xcc, 0x69, 0xe9, 0x04, 0x43, 0x65, 0x36, 0x41, 0x58, 0x2e, 0x01, 0x25, 0x24, 0x3b, 0x30,
-    0x14, 0x13, 0x35, 0x4c, 0x68, 0x44, 0x42, 0x76, 0x5a, 0x34, 0x5b, 0x9b, 0x61, 0x2b, 0x4b, 0x2f,
-    0x27, 0x3e, 0x25, 0x1b, 0x2b, 0x23, 0x1e, 0x0e, 0x1a, 0x51, 0x7f, 0x61, 0x48, 0x77, 0x57, 0x30,
-    0x69, 0xa5, 0x59, 0x43, 0x4f, 0x23, 0x23, 0x3d, 0x00, 0x02, 0x00, 0x0a, 0xff, 0xec, 0x02, 0x75,
-    0x05, 0x43, 0x00, 0x03, 0x00, 0x15, 0x00, 0x13, 0x40, 0x09, 0x0a, 0x11, 0x0b, 0x72, 0x04, 0x02,
-    0x03, 0x06, 0x72, 0x00, 0x2b, 0x32, 0x2f, 0x2b, 0x32, 0x30, 0x31, 0x41, 0x15, 0x21, 0x35, 0x13,
-    0x33, 0x11, 0x14, 0x16, 0x16, 0x33, 0x32, 0x36, 0x37, 0x17, 0x06, 0x06, 0x23, 0x22, 0x26, 0x26,
-    0x35, 0x02, 0x6c, 0xfd, 0x9e, 0xb0, 0xf1, 0x1d, 0x34, 0x23, 0x19, 0x2e, 0x0e, 0x01, 0x1e, 0x4f,
-    0x33, 0x53, 0x80, 0x48, 0x04, 0x3a, 0xb0, 0xb0, 0x01, 0x09, 0xfb, 0xe8, 0x32, 0x35, 0x12, 0x06,
-    0x03, 0xb8, 0x09, 0x0e, 0x3b, 0x86, 0x6f, 0x00, 0x00, 0x02, 0x00, 0x77, 0xff, 0xec, 0x03, 0xf9,
-    0x04, 0x3a, 0x00, 0x04, 0x00, 0x1b, 0x00, 0x15, 0x40, 0x0a, 0x01, 0x11, 0x06, 0x72, 0x18, 0x03,
-    0x03, 0x0b, 0x0b, 0x72, 0x00, 0x2b, 0x32, 0x2f, 0x32, 0x2b, 0x32, 0x30, 0x31, 0x65, 0x11, 0x33,
-    0x11, 0x23, 0x13, 0x37, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x11, 0x33, 0x11, 0x14,
-    0x1e, 0x02, 0x33, 0x32, 0x36, 0x36, 0x03, 0x07, 0xf2, 0xe4, 0x14, 0x51, 0x30, 0x64, 0x9c, 0x6d,
-    0x4f, 0x84, 0x5f, 0x34, 0xf1, 0x1c, 0x30, 0x40, 0x24, 0x67, 0x77, 0x33, 0xff, 0x03, 0x3b, 0xfb,
-    0xc6, 0x01, 0xe0, 0x02, 0x6d, 0xb7, 0x87, 0x4b, 0x2e, 0x60, 0x9a, 0x6b, 0x02, 0xbb, 0xfd, 0x43,
-    0x3b, 0x4f, 0x30, 0x14, 0x51, 0x8a, 0x00, 0x02, 0x00, 0x16, 0x00, 0x00, 0x03, 0xdf, 0x04, 0x3a,
-    0x00, 0x04, 0x00, 0x09, 0x00, 0x17, 0x40, 0x0b, 0x00, 0x06, 0x08, 0x01, 0x09, 0x06, 0x72, 0x03,
-    0x08, 0x0a, 0x72, 0x00, 0x2b, 0x32, 0x2b, 0x32, 0x12, 0x39, 0x39, 0x30, 0x31, 0x65, 0x01, 0x33,
-    0x01, 0x23, 0x03, 0x01, 0x17, 0x23, 0x01, 0x01, 0xdc, 0x01, 0x09, 0xfa, 0xfe, 0x88, 0x9c, 0xba,
-    0x01, 0x0e, 0x0d, 0x9c, 0xfe, 0x86, 0xbf, 0x03, 0x7b, 0xfb, 0xc6, 0x04, 0x3a, 0xfc, 0x81, 0xbb,
-    0x04, 0x3a, 0x00, 0x04, 0x00, 0x23, 0x00, 0x00, 0x05, 0xc8, 0x04, 0x3a, 0x00, 0x05, 0x00, 0x0a,
-    0x00, 0x0f, 0x00, 0x15, 0x00, 0x24, 0x40, 0x14, 0x07, 0x0b, 0x00, 0x11, 0x03, 0x14, 0x06, 0x09,
-    0x10, 0x0c, 0x01, 0x0a, 0x06, 0x72, 0x12, 0x0e, 0x04, 0x09, 0x0a, 0x72, 0x00, 0x2b, 0x32, 0x32,
-    0x32, 0x2b, 0x32, 0x32, 0x32, 0x12, 0x17, 0x39, 0x30, 0x31, 0x65, 0x13, 0x33, 0x07, 0x03, 0x23,
-    0x03, 0x13, 0x17, 0x23, 0x01, 0x01, 0x13, 0x33, 0x01, 0x23, 0x03, 0x13, 0x17, 0x23, 0x03, 0x27,
-    0x01, 0xa2, 0xfa, 0x9a, 0x2a, 0xfc, 0x8a, 0x77, 0xc3, 0x10, 0x9a, 0xfe, 0xdb, 0x03, 0xfd, 0xbd,
-    0xeb, 0xfe, 0xdc, 0x9a, 0xba, 0xf7, 0x1f, 0x8a, 0xff, 0x2a, 0xf0, 0x03, 0x4a, 0xfc, 0xfc, 0xc2,
-    0x04, 0x3a, 0xfc, 0xb2, 0xec, 0x04, 0x3a, 0xfc, 0xbc, 0x03, 0x44, 0xfb, 0xc6, 0x04, 0x3a, 0xfc,
-    0xc0, 0xfa, 0x03, 0x3f, 0xfb, 0x00, 0x00, 0x01, 0x00, 0x1f, 0x00, 0x00, 0x03, 0xea, 0x04, 0x3a,
-    0x00, 0x0b, 0x00, 0x1a, 0x40, 0x0e, 0x07, 0x04, 0x0a, 0x01, 0x04, 0x09, 0x03, 0x0b, 0x06, 0x72,
-    0x06, 0x09, 0x0a, 0x72, 0x00, 0x2b, 0x32, 0x2b, 0x32, 0x12, 0x17, 0x39, 0x30, 0x31, 0x41, 0x13,
-    0x13, 0x21, 0x01, 0x01, 0x21, 0x03, 0x03, 0x21, 0x01, 0x01, 0x01, 0x34, 0xce, 0xd2, 0x01, 0x09,
-    0xfe, 0xb8, 0x01, 0x55, 0xfe, 0xf7, 0xdc, 0xdc, 0xfe, 0xf6, 0x01, 0x54, 0xfe, 0xb9, 0x04, 0x3a,
-    0xfe, 0x99, 0x01, 0x67, 0xfd, 0xed, 0xfd, 0xd9, 0x01, 0x76, 0xfe, 0x8a, 0x02, 0x27, 0x02, 0x13,
-    0x00, 0x02, 0x00, 0x0c, 0xfe, 0x4b, 0x03, 0xde, 0x04, 0x3a, 0x00, 0x13, 0x00, 0x18, 0x00, 0x19,
-    0x40, 0x0d, 0x17, 0x16, 0x15, 0x03, 0x08, 0x02, 0x18, 0x06, 0x72, 0x0f, 0x08, 0x0f, 0x72, 0x00,
-    0x2b, 0x32, 0x2b, 0x32, 0x12, 0x17, 0x39, 0x30, 0x31, 0x65, 0x01, 0x21, 0x01, 0x0e, 0x03, 0x23,
-    0x22, 0x26, 0x27, 0x27, 0x16, 0x16, 0x33, 0x32, 0x36, 0x36, 0x37, 0x03, 0x01, 0x17, 0x07, 0x01,
-    0x01, 0xb6, 0x01, 0x26, 0x01, 0x02, 0xfe, 0x4e, 0x0f, 0x30, 0x4d, 0x72, 0x51, 0x20, 0x3b, 0x1a,
-    0x01, 0x0a, 0x1d, 0x09, 0x3c, 0x50, 0x33, 0x12, 0x58, 0x01, 0x01, 0x2b, 0xa7, 0xfe, 0x77, 0x76,
-    0x03, 0xc4, 0xfb, 0x21, 0x28, 0x5e, 0x55, 0x35, 0x0b, 0x06, 0xb8, 0x01, 0x02, 0x1d, 0x40, 0x36,
-    0x04, 0x96, 0xfc, 0xd6, 0xfe, 0x2b, 0x04, 0x53, 0x00, 0x03, 0x00, 0x51, 0x00, 0x00, 0x03, 0xc1,
-    0x04, 0x3a, 0x00, 0x03, 0x00, 0x09, 0x00, 0x0d, 0x00, 0x1c, 0x40, 0x0d, 0x04, 0x0c, 0x0c, 0x09,
-    0x0d, 0x06, 0x72, 0x07, 0x03, 0x03, 0x06, 0x02, 0x12, 0x00, 0x3f, 0x33, 0x33, 0x11, 0x33, 0x2b,
-    0x32, 0x32, 0x11, 0x33, 0x30, 0x31, 0x65, 0x15, 0x21, 0x35, 0x01, 0x01, 0x23, 0x35, 0x01, 0x33,
-    0x23, 0x15, 0x21, 0x35, 0x03, 0xc1, 0xfc, 0xda, 0x03, 0x10, 0xfd, 0x42, 0x9c, 0x02, 0xba, 0xa0,
-    0x5d, 0xfd, 0x0f, 0xc0, 0xc0, 0xc0, 0x02, 0xe4, 0xfc, 0x5c, 0x9b, 0x03, 0x9f, 0xc0, 0xc0, 0x00,
-    0x00, 0x02, 0x00, 0x38, 0xfe, 0x94, 0x02, 0x8e, 0x06, 0x3d, 0x00, 0x11, 0x00, 0x25, 0x00, 0x19,
-    0x40, 0x0a, 0x1d, 0x09, 0x0a, 0x0a, 0x1c, 0x1c, 0x12, 0x13, 0x01, 0x00, 0x00, 0x2f, 0x32, 0x2f,
-    0x33, 0x39, 0x2f, 0x33, 0x12, 0x39, 0x39, 0x30, 0x31, 0x41, 0x17, 0x06, 0x06, 0x15, 0x15, 0x14,
-    0x06, 0x06, 0x23, 0x35, 0x32, 0x36, 0x35, 0x35, 0x34, 0x36, 0x36, 0x13, 0x07, 0x2e, 0x02, 0x35,
-    0x35, 0x34, 0x26, 0x26, 0x23, 0x35, 0x32, 0x16, 0x16, 0x15, 0x15, 0x14, 0x16, 0x16, 0x02, 0x5e,
-    0x30, 0x67, 0x4d, 0x55, 0xb8, 0x95, 0x67, 0x5a, 0x41, 0x9c, 0xb8, 0x30, 0x88, 0x9c, 0x41, 0x28,
-    0x55, 0x44, 0x95, 0xb8, 0x55, 0x21, 0x4f, 0x06, 0x3d, 0x89, 0x23, 0xb2, 0x73, 0xce, 0x64, 0xa4,
-    0x60, 0x8a, 0x78, 0x66, 0xce, 0x69, 0xb7, 0x8b, 0xf9, 0x07, 0x8a, 0x27, 0x8b, 0xb7, 0x69, 0xcc,
-    0x45, 0x63, 0x37, 0x8b, 0x61, 0xa3, 0x66, 0xcc, 0x4d, 0x83, 0x60, 0x00, 0x00, 0x01, 0x00, 0xaf,
-    0xfe, 0xf2, 0x01, 0x50, 0x05, 0xb0, 0x00, 0x03, 0x00, 0x09, 0xb2, 0x00, 0x02, 0x01, 0x00, 0x2f,
-    0x3f, 0x30, 0x31, 0x41, 0x11, 0x23, 0x11, 0x01, 0x50, 0xa1, 0x05, 0xb0, 0xf9, 0x42, 0x06, 0xbe,
-    0x00, 0x02, 0x00, 0x1c, 0xfe, 0x94, 0x02, 0x73, 0x06, 0x3d, 0x00, 0x13, 0x00, 0x26, 0x00, 0x1b,
-    0x40, 0x0b, 0x1e, 0x0b, 0x0a, 0x0a, 0x1f, 0x1f, 0x01, 0x15, 0x14, 0x00, 0x01, 0x00, 0x2f, 0x33,
-    0x2f, 0x33, 0x12, 0x39, 0x2f, 0x33, 0x12, 0x39, 0x39, 0x30, 0x31, 0x53, 0x37, 0x1e, 0x02, 0x15,
-    0x15, 0x14, 0x16, 0x16, 0x33, 0x15, 0x22, 0x26, 0x26, 0x35, 0x35, 0x34, 0x26, 0x26, 0x03, 0x27,
-    0x3e, 0x02, 0x35, 0x35, 0x34, 0x36, 0x36, 0x33, 0x15, 0x22, 0x06, 0x15, 0x15, 0x14, 0x06, 0x06,
-    0x1c, 0x30, 0x89, 0x9c, 0x40, 0x28, 0x56, 0x44, 0x94, 0xba, 0x55, 0x20, 0x4f, 0x15, 0x30, 0x45,
-    0x4e, 0x21, 0x55, 0xba, 0x94, 0x66, 0x5c, 0x40, 0x9c, 0x05, 0xb4, 0x89, 0x26, 0x8b, 0xb7, 0x69,
-    0xce, 0x43, 0x64, 0x37, 0x84, 0x5d, 0xa1, 0x64, 0xce, 0x4d, 0x84, 0x60, 0xf8, 0xf7, 0x8a, 0x18,
-    0x60, 0x83, 0x4d, 0xcc, 0x66, 0xa0, 0x5d, 0x84, 0x79, 0x66, 0xcc, 0x69, 0xb7, 0x8b, 0x00, 0x01,
-    0x00, 0x75, 0x01, 0x86, 0x04, 0xd7, 0x03, 0x2f, 0x00, 0x1f, 0x00, 0x1b, 0x40, 0x0b, 0x0c, 0x00,
-    0x00, 0x16, 0x06, 0x80, 0x1c, 0x06, 0x10, 0x10, 0x06, 0x00, 0x2f, 0x33, 0x2f, 0x11, 0x33, 0x1a,
-    0x10, 0xcd, 0x32, 0x2f, 0x32, 0x30, 0x31, 0x41, 0x37, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x26, 0x27,
-    0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x15, 0x23, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x16, 0x17, 0x16,
-    0x16, 0x33, 0x32, 0x36, 0x36, 0x04, 0x1e, 0xb9, 0x30, 0x57, 0x79, 0x48, 0x54, 0x81, 0x4a, 0x2e,
-    0x50, 0x2e, 0x2d, 0x40, 0x24, 0xbe, 0x30, 0x57, 0x78, 0x48, 0x54, 0x87, 0x46, 0x30, 0x4e, 0x2c,
-    0x2d, 0x44, 0x26, 0x03, 0x11, 0x01, 0x56, 0x91, 0x6a, 0x3b, 0x43, 0x44, 0x2c, 0x2f, 0x2f, 0x56,
-    0x39, 0x57, 0x8f, 0x67, 0x38, 0x46, 0x41, 0x2e, 0x2e, 0x33, 0x5a, 0x00, 0x00, 0x02, 0x00, 0x85,
-    0xfe, 0x93, 0x01, 0x99, 0x04, 0x4d, 0x00, 0x03, 0x00, 0x0f, 0x00, 0x0c, 0xb3, 0x01, 0x07, 0x0d,
-    0x00, 0x00, 0x2f, 0x2f, 0xdd, 0xce, 0x30, 0x31, 0x53, 0x13, 0x33, 0x13, 0x13, 0x14, 0x06, 0x23,
-    0x22, 0x26, 0x35, 0x34, 0x36, 0x33, 0x32, 0x16, 0x92, 0x19, 0xce, 0x19, 0x07, 0x49, 0x41, 0x40,
-    0x4a, 0x4a, 0x40, 0x41, 0x49, 0xfe, 0x93, 0x04, 0x03, 0xfb, 0xfd, 0x05, 0x3a, 0x36, 0x4b, 0x4b,
-    0x36, 0x36, 0x4a, 0x4a, 0x00, 0x03, 0x00, 0x67, 0xff, 0x0b, 0x04, 0x0b, 0x05, 0x26, 0x00, 0x03,
-    0x00, 0x07, 0x00, 0x2f, 0x00, 0x25, 0x40, 0x12, 0x02, 0x01, 0x25, 0x25, 0x21, 0x03, 0x1c, 0x07,
-    0x72, 0x07, 0x04, 0x08, 0x08, 0x0c, 0x06, 0x11, 0x0d, 0x72, 0x00, 0x2b, 0xcd, 0xcc, 0x33, 0x12,
-    0x39, 0x39, 0x2b, 0xcd, 0xcc, 0x33, 0x12, 0x39, 0x39, 0x30, 0x31, 0x41, 0x11, 0x23, 0x11, 0x13,
-    0x11, 0x23, 0x11, 0x37, 0x32, 0x36, 0x36, 0x37, 0x33, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x35,
-    0x35, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x16, 0x16, 0x17, 0x23, 0x2e, 0x02, 0x23, 0x22, 0x0e, 0x02,
-    0x15, 0x15, 0x14, 0x1e, 0x02, 0x02, 0xad, 0xbf, 0xbf, 0xbf, 0x61, 0x3b, 0x60, 0x3a, 0x03, 0xe4,
-    0x03, 0x79, 0xc5, 0x78, 0x7c, 0xb9, 0x7a, 0x3c, 0x3c, 0x7b, 0xb8, 0x7b, 0x82, 0xc4, 0x71, 0x03,
-    0xe4, 0x03, 0x35, 0x5f, 0x42, 0x49, 0x60, 0x36, 0x17, 0x16, 0x37, 0x60, 0x05, 0x26, 0xfe, 0xdf,
-    0x01, 0x21, 0xfb, 0x05, 0xfe, 0xe0, 0x01, 0x20, 0x81, 0x2f, 0x54, 0x37, 0x69, 0xac, 0x65, 0x55,
-    0x96, 0xc4, 0x70, 0x23, 0x70, 0xc5, 0x96, 0x55, 0x67, 0xb7, 0x79, 0x3c, 0x61, 0x3a, 0x3b, 0x65,
-    0x7d, 0x43, 0x23, 0x43, 0x7e, 0x63, 0x3b, 0x00, 0x00, 0x03, 0x00, 0x5f, 0x00, 0x00, 0x04, 0x7a,
-    0x05, 0xc4, 0x00, 0x03, 0x00, 0x07, 0x00, 0x22, 0x00, 0x21, 0x40, 0x10, 0x06, 0x05, 0x05, 0x01,
-    0x1f, 0x16, 0x05, 0x72, 0x0c, 0x0d, 0x0d, 0x02, 0x02, 0x01, 0x0c, 0x72, 0x00, 0x2b, 0x32, 0x11,
-    0x33, 0x11, 0x33, 0x2b, 0x32, 0x11, 0x39, 0x2f, 0x33, 0x30, 0x31, 0x61, 0x21, 0x35, 0x21, 0x01,
-    0x21, 0x35, 0x21, 0x25, 0x13, 0x16, 0x06, 0x07, 0x27, 0x3e, 0x02, 0x35, 0x03, 0x34, 0x36, 0x36,
-    0x33, 0x32, 0x16, 0x16, 0x15, 0x23, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x04, 0x7a, 0xfb,
-    0xe9, 0x04, 0x16, 0xfe, 0xbb, 0xfd, 0x2b, 0x02, 0xd5, 0xfe, 0xbc, 0x17, 0x01, 0x47, 0x51, 0xb6,
-    0x21, 0x23, 0x0d, 0x15, 0x73, 0xca, 0x83, 0x8b, 0xc2, 0x66, 0xf2, 0x38, 0x5b, 0x35, 0x36, 0x57,
-    0x32, 0xc7, 0x01, 0x91, 0xc3, 0xf4, 0xfd, 0x94, 0x60, 0x97, 0x2b, 0x46, 0x08, 0x45, 0x5d, 0x29,
-    0x02, 0x75, 0x8a, 0xc3, 0x68, 0x66, 0xb5, 0x78, 0x4b, 0x59, 0x28, 0x36, 0x6a, 0x00, 0x00, 0x06,
-    0x00, 0x5c, 0xff, 0xe5, 0x05, 0x4e, 0x04, 0xf1, 0x00, 0x13, 0x00, 0x27, 0x00, 0x2b, 0x00, 0x2f,
-    0x00, 0x33, 0x00, 0x37, 0x00, 0x0e, 0xb5, 0x0f, 0x19, 0x05, 0x23, 0x0d, 0x72, 0x00, 0x2b, 0x32,
-    0x2f, 0x33, 0x30, 0x31, 0x41, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x3e, 0x02, 0x35, 0x34, 0x2e, 0x02,
-    0x23, 0x22, 0x0e, 0x02, 0x07, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x14, 0x0e, 0x02,
-    0x23, 0x22, 0x2e, 0x02, 0x01, 0x07, 0x27, 0x37, 0x01, 0x07, 0x27, 0x37, 0x01, 0x27, 0x37, 0x17,
-    0x01, 0x27, 0x37, 0x17, 0x01, 0x30, 0x41, 0x73, 0x97, 0x57, 0x57, 0x97, 0x73, 0x40, 0x40, 0x73,
-    0x97, 0x57, 0x57, 0x97, 0x73, 0x41, 0xb1, 0x5d, 0xa3, 0xd8, 0x7b, 0x7b, 0xd8, 0xa4, 0x5c, 0x5c,
-    0xa4, 0xd8, 0x7b, 0x7b, 0xd8, 0xa3, 0x5d, 0x04, 0xcf, 0xca, 0x88, 0xca, 0xfc, 0xe6, 0xca, 0x86,
-    0xca, 0x03, 0xa0, 0xca, 0x88, 0xca, 0xfb, 0xd8, 0xca, 0x86, 0xca, 0x02, 0x60, 0x5d, 0xa4, 0x7a,
-    0x45, 0x45, 0x7a, 0xa4, 0x5d, 0x5e, 0xa2, 0x7a, 0x45, 0x45, 0x7a, 0xa2, 0x5e, 0x85, 0xe4, 0xaa,
-    0x5f, 0x5f, 0xaa, 0xe4, 0x85, 0x85, 0xe4, 0xab, 0x60, 0x60, 0xab, 0xe4, 0x02, 0x8a, 0xce, 0x8c,
-    0xce, 0xfb, 0xc3, 0xce, 0x8b, 0xcd, 0xfe, 0xa7, 0xce, 0x8b, 0xcd, 0x03, 0x26, 0xce, 0x8b, 0xce,
-    0x00, 0x05, 0x00, 0x0d, 0x00, 0x00, 0x04, 0x32, 0x05, 0xb0, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0c,
-    0x00, 0x11, 0x00, 0x15, 0x00, 0x2d, 0x40, 0x16, 0x0b, 0x10, 0x10, 0x06, 0x07, 0x12, 0x15, 0x15,
-    0x08, 0x0e, 0x03, 0x03, 0x02, 0x02, 0x11, 0x14, 0x0c, 0x72, 0x09, 0x11, 0x04, 0x72, 0x00, 0x2b,
-    0x32, 0x2b, 0x12, 0x39, 0x2f, 0x33, 0x12, 0x39, 0x39, 0x32, 0x11, 0x33, 0xce, 0x32, 0x33, 0x11,
-    0x33, 0x30, 0x31, 0x41, 0x15, 0x21, 0x35, 0x01, 0x15, 0x21, 0x35, 0x25, 0x01, 0x21, 0x01, 0x23,
-    0x03, 0x01, 0x07, 0x23, 0x01, 0x01, 0x11, 0x23, 0x11, 0x03, 0xcb, 0xfc, 0x9c, 0x03, 0x64, 0xfc,
-    0x9c, 0x01, 0x79, 0x01, 0x48, 0x01, 0x0a, 0xfe, 0x5e, 0x92, 0xe4, 0x01, 0x4b, 0x22, 0x92, 0xfe,
-    0x5c, 0x02, 0x8c, 0xfa, 0x02, 0xe3, 0x95, 0x95, 0xfe, 0xdd, 0x94, 0x94, 0xf1, 0x02, 0xff, 0xfc,
-    0x94, 0x03, 0x6c, 0xfc, 0xf9, 0x65, 0x03, 0x6c, 0xfd, 0x4e, 0xfd, 0x02, 0x02, 0xfe, 0x00, 0x02,
-    0x00, 0x89, 0xfe, 0xf2, 0x01, 0x6a, 0x05, 0xb0, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0d, 0xb4, 0x01,
-    0x02, 0x06, 0x07, 0x02, 0x00, 0x3f, 0xdd, 0xde, 0xcd, 0x30, 0x31, 0x41, 0x23, 0x11, 0x33, 0x11,
-    0x11, 0x23, 0x11, 0x01, 0x6a, 0xe1, 0xe1, 0xe1, 0xfe, 0xf2, 0x03, 0x19, 0x03, 0xa5, 0xfd, 0x0a,
-    0x02, 0xf6, 0x00, 0x02, 0x00, 0x5c, 0xfe, 0x26, 0x04, 0x8c, 0x05, 0xc5, 0x00, 0x2f, 0x00, 0x61,
-    0x00, 0x1e, 0x40, 0x13, 0x53, 0x3f, 0x00, 0x01, 0x05, 0x2b, 0x5d, 0x35, 0x31, 0x30, 0x0f, 0x21,
-    0x0c, 0x4f, 0x44, 0x1d, 0x14, 0x11, 0x72, 0x00, 0x2b, 0x32, 0x2f, 0x33, 0x17, 0x39, 0x30, 0x31,
-    0x65, 0x35, 0x32, 0x36, 0x36, 0x35, 0x34, 0x2e, 0x02, 0x27, 0x2e, 0x03, 0x35, 0x34, 0x3e, 0x02,
-    0x33, 0x32, 0x16, 0x16, 0x15, 0x23, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x15, 0x14, 0x1e,
-    0x02, 0x17, 0x1e, 0x03, 0x15, 0x14, 0x0e, 0x02, 0x03, 0x15, 0x22, 0x06, 0x06, 0x15, 0x14, 0x1e,
-    0x02, 0x17, 0x1e, 0x03, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x37, 0x14, 0x1e,
-    0x02, 0x33, 0x32, 0x36, 0x36, 0x35, 0x34, 0x2e, 0x02, 0x27, 0x2e, 0x03, 0x35, 0x34, 0x3e, 0x02,
-    0x02, 0xaf, 0x4c, 0x6a, 0x38, 0x20, 0x4a, 0x7d, 0x5d, 0x6f, 0xae, 0x7a, 0x3f, 0x47, 0x85, 0xb9,
-    0x74, 0x9d, 0xe3, 0x7a, 0xf1, 0x3d, 0x75, 0x57, 0x5c, 0x74, 0x38, 0x1c, 0x44, 0x7c, 0x60, 0x72,
-    0xb0, 0x7a, 0x40, 0x44, 0x7d, 0xb0, 0xf0, 0x4b, 0x61, 0x2e, 0x1b, 0x46, 0x7e, 0x61, 0x71, 0xb0,
-    0x78, 0x3f, 0x47, 0x85, 0xb8, 0x73, 0x63, 0xbe, 0x9a, 0x5b, 0xf1, 0x34, 0x55, 0x68, 0x34, 0x54,
-    0x75, 0x3d, 0x1f, 0x48, 0x7b, 0x5c, 0x6f, 0xb0, 0x7a, 0x41, 0x41, 0x78, 0xaa, 0x7c, 0x82, 0x30,
-    0x55, 0x35, 0x2a, 0x3f, 0x35, 0x32, 0x1d, 0x1e, 0x47, 0x60, 0x87, 0x5e, 0x55, 0x8a, 0x62, 0x35,
-    0x64, 0xbf, 0x8a, 0x42, 0x6b, 0x40, 0x31, 0x51, 0x32, 0x2b, 0x3f, 0x31, 0x2d, 0x1a, 0x1e, 0x48,
-    0x5f, 0x86, 0x5c, 0x50, 0x7c, 0x54, 0x2c, 0x02, 0xef, 0x84, 0x30, 0x53, 0x35, 0x2d, 0x41, 0x34,
-    0x2f, 0x1c, 0x1f, 0x47, 0x5f, 0x87, 0x5e, 0x58, 0x8a, 0x5f, 0x31, 0x2b, 0x61, 0xa4, 0x78, 0x02,
-    0x44, 0x5b, 0x34, 0x17, 0x2e, 0x4f, 0x33, 0x28, 0x3c, 0x33, 0x30, 0x1b, 0x1e, 0x47, 0x60, 0x86,
-    0x5c, 0x4e, 0x7b, 0x55, 0x2e, 0x00, 0x00, 0x02, 0x00, 0x63, 0x04, 0xe5, 0x03, 0x2c, 0x05, 0xcd,
-    0x00, 0x0b, 0x00, 0x17, 0x00, 0x0e, 0xb4, 0x03, 0x09, 0x09, 0x0f, 0x15, 0x00, 0x2f, 0x33, 0x33,
-    0x2f, 0x33, 0x30, 0x31, 0x53, 0x34, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14, 0x06, 0x23, 0x22, 0x26,
-    0x25, 0x34, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14, 0x06, 0x23, 0x22, 0x26, 0x63, 0x44, 0x38, 0x39,
-    0x44, 0x44, 0x39, 0x38, 0x44, 0x01, 0xcf, 0x44, 0x39, 0x38, 0x45, 0x45, 0x38, 0x39, 0x44, 0x05,
-    0x59, 0x31, 0x43, 0x43, 0x31, 0x30, 0x43, 0x43, 0x2f, 0x31, 0x43, 0x43, 0x31, 0x30, 0x43, 0x43,
-    0x00, 0x03, 0x00, 0x5a, 0xff, 0xeb, 0x05, 0xe5, 0x05, 0xc4, 0x00, 0x1f, 0x00, 0x33, 0x00, 0x47,
-    0x00, 0x1f, 0x40, 0x0e, 0x1d, 0x04, 0x04, 0x25, 0x25, 0x43, 0x14, 0x0d, 0x0d, 0x2f, 0x2f, 0x39,
-    0x03, 0x72, 0x00, 0x2b, 0x32, 0x11, 0x33, 0x11, 0x33, 0x2f, 0x33, 0x11, 0x33, 0x11, 0x33, 0x30,
-    0x31, 0x41, 0x33, 0x14, 0x06, 0x23, 0x22, 0x26, 0x26, 0x35, 0x35, 0x34, 0x36, 0x36, 0x33, 0x32,
-    0x16, 0x15, 0x23, 0x34, 0x26, 0x23, 0x22, 0x06, 0x06, 0x15, 0x15, 0x14, 0x16, 0x16, 0x33, 0x32,
-    0x36, 0x25, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x3e, 0x02, 0x35, 0x34, 0x2e, 0x02, 0x23, 0x22, 0x0e,
-    0x02, 0x07, 0x34, 0x12, 0x36, 0x24, 0x33, 0x32, 0x04, 0x16, 0x12, 0x15, 0x14, 0x02, 0x06, 0x04,
-    0x23, 0x22, 0x24, 0x26, 0x02, 0x03, 0xc9, 0x96, 0xb3, 0x9a, 0x6b, 0x9b, 0x55, 0x55, 0x9b, 0x6b,
-    0x9a, 0xb4, 0x96, 0x5d, 0x5b, 0x41, 0x59, 0x2d, 0x2d, 0x59, 0x41, 0x5b, 0x5c, 0xfd, 0x06, 0x5c,
-    0xa3, 0xd7, 0x7b, 0x7a, 0xd6, 0xa3, 0x5c, 0x5c, 0xa3, 0xd6, 0x7a, 0x7b, 0xd7, 0xa3, 0x5c, 0x75,
-    0x6e, 0xc4, 0x01, 0x01, 0x93, 0x93, 0x01, 0x01, 0xc3, 0x6e, 0x6e, 0xc3, 0xfe, 0xff, 0x93, 0x93,
-    0xfe, 0xff, 0xc4, 0x6e, 0x02, 0x55, 0x9d, 0x9d, 0x62, 0xae, 0x73, 0x75, 0x73, 0xae, 0x62, 0x9d,
-    0x9d, 0x62, 0x55, 0x41, 0x74, 0x4a, 0x76, 0x4b, 0x74, 0x41, 0x54, 0xe7, 0x85, 0xe5, 0xab, 0x5f,
-    0x5f, 0xab, 0xe5, 0x85, 0x85, 0xe4, 0xaa, 0x5f, 0x5f, 0xaa, 0xe4, 0x85, 0x9f, 0x01, 0x10, 0xcb,
-    0x71, 0x71, 0xcb, 0xfe, 0xf0, 0x9f, 0x9f, 0xfe, 0xf0, 0xcd, 0x72, 0x72, 0xcd, 0x01, 0x10, 0x00,
-    0x00, 0x02, 0x00, 0x8e, 0x02, 0xb4, 0x03, 0x0e, 0x05, 0xc5, 0x00, 0x17, 0x00, 0x31, 0x00, 0x1a,
-    0xb5, 0x31, 0x1a, 0x1a, 0x0d, 0x16, 0x2a, 0xb8, 0x01, 0x00, 0xb2, 0x08, 0x0d, 0x03, 0x00, 0x3f,
-    0x33, 0x1a, 0xdc, 0xc4, 0x12, 0x39, 0x2f, 0x33, 0x30, 0x31, 0x41, 0x11, 0x34, 0x26, 0x26, 0x23,
-    0x22, 0x06, 0x15, 0x27, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x16, 0x15, 0x11, 0x14, 0x16, 0x17,
-    0x23, 0x26, 0x13, 0x17, 0x23, 0x22, 0x06, 0x06, 0x15, 0x14, 0x16, 0x33, 0x32, 0x36, 0x36, 0x35,
-    0x17, 0x0e, 0x02, 0x23, 0x22, 0x26, 0x35, 0x34, 0x36, 0x36, 0x33, 0x02, 0x4c, 0x1a, 0x36, 0x29,
-    0x43, 0x4d, 0xa5, 0x4d, 0x8b, 0x5d, 0x57, 0x81, 0x49, 0x0c, 0x0e, 0xaa, 0x18, 0x29, 0x01, 0x93,
-    0x3b, 0x4d, 0x25, 0x3b, 0x3f, 0x2a, 0x55, 0x3a, 0x12, 0x0f, 0x3f, 0x62, 0x44, 0x78, 0x81, 0x4b,
-    0x97, 0x72, 0x03, 0x5e, 0x01, 0x54, 0x2a, 0x3b, 0x1e, 0x34, 0x33, 0x0e, 0x44, 0x69, 0x3c, 0x3e,
-    0x7a, 0x5c, 0xfe, 0xc6, 0x31, 0x58, 0x2c, 0x49, 0x01, 0x72, 0x71, 0x1f, 0x34, 0x1f, 0x2a, 0x31,
-    0x26, 0x38, 0x18, 0x71, 0x20, 0x44, 0x2c, 0x7b, 0x67, 0x4a, 0x67, 0x36, 0xff, 0xff, 0x00, 0x57,
-    0x00, 0x8a, 0x03, 0x85, 0x03, 0xa7, 0x04, 0x26, 0x01, 0x92, 0xeb, 0xfe, 0x00, 0x07, 0x01, 0x92,
-    0x01, 0x55, 0xff, 0xfe, 0x00, 0x02, 0x00, 0x7f, 0x01, 0x77, 0x03, 0xbf, 0x03, 0x22, 0x00, 0x03,
-    0x00, 0x07, 0x00, 0x12, 0xb6, 0x06, 0x07, 0x03, 0x06, 0x02, 0x02, 0x03, 0x00, 0x2f, 0x33, 0x11,
-    0x33, 0x12, 0x39, 0x2f, 0x30, 0x31, 0x41, 0x15, 0x21, 0x35, 0x05, 0x11, 0x23, 0x11, 0x03, 0xbf,
-    0xfc, 0xc0, 0x03, 0x40, 0xbe, 0x03, 0x22, 0xa5, 0xa5, 0x4b, 0xfe, 0xa0, 0x01, 0x60, 0x00, 0x04,
-    0x00, 0x59, 0xff, 0xeb, 0x05, 0xe5, 0x05, 0xc4, 0x00, 0x1e, 0x00, 0x2f, 0x00, 0x43, 0x00, 0x57,
-    0x00, 0x35, 0x40, 0x1b, 0x1f, 0x1b, 0x18, 0x20, 0x04, 0x02, 0x02, 0x01, 0x01, 0x0f, 0x29, 0x0d,
-    0x0d, 0x35, 0x35, 0x53, 0x0c, 0x0f, 0x0f, 0x49, 0x53, 0x13, 0x72, 0x3f, 0x49, 0x03, 0x72, 0x00,
-    0x2b, 0x32, 0x2b, 0x12, 0x39, 0x2f, 0x33, 0x11, 0x33, 0x11, 0x33, 0x2f, 0x33, 0x12, 0x39, 0x7d,
-    0x2f, 0x33, 0x12, 0x17, 0x39, 0x30, 0x31, 0x41, 0x23, 0x27, 0x33, 0x3e, 0x02, 0x35, 0x34, 0x26,
-    0x26, 0x23, 0x23, 0x11, 0x23, 0x11, 0x21, 0x32, 0x16, 0x16, 0x15, 0x14, 0x06, 0x06, 0x07, 0x22,
-    0x06, 0x23, 0x0e, 0x02, 0x23, 0x37, 0x32, 0x16, 0x15, 0x15, 0x14, 0x16, 0x17, 0x15, 0x23, 0x26,
-    0x26, 0x35, 0x35, 0x34, 0x26, 0x25, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x3e, 0x02, 0x35, 0x34, 0x2e,
-    0x02, 0x23, 0x22, 0x0e, 0x02, 0x07, 0x34, 0x12, 0x36, 0x24, 0x33, 0x32, 0x04, 0x16, 0x12, 0x15,
-    0x14, 0x02, 0x06, 0x04, 0x23, 0x22, 0x24, 0x26, 0x02, 0x03, 0x38, 0xd8, 0x02, 0xc1, 0x2c, 0x4c,
-    0x2e, 0x21, 0x4f, 0x43, 0x85, 0x91, 0x01, 0x16, 0x63, 0x91, 0x4f, 0x32, 0x61, 0x46, 0x03, 0x07,
-    0x03, 0x11, 0x09, 0x09, 0x1e, 0x15, 0x9c, 0x72, 0x07, 0x0a, 0x95, 0x0a, 0x03, 0x42, 0xfd, 0x51,
-    0x5b, 0xa4, 0xd7, 0x7a, 0x7b, 0xd6, 0xa2, 0x5c, 0x5c, 0xa2, 0xd6, 0x7b, 0x7a, 0xd7, 0xa4, 0x5b,
-    0x76, 0x6e, 0xc4, 0x01, 0x01, 0x93, 0x93, 0x01, 0x01, 0xc3, 0x6f, 0x6f, 0xc3, 0xfe, 0xff, 0x93,
-    0x93, 0xfe, 0xff, 0xc4, 0x6e, 0x02, 0x8e, 0x82, 0x01, 0x1b, 0x35, 0x27, 0x31, 0x3a, 0x19, 0xfd,
-    0x31, 0x03, 0x50, 0x39, 0x73, 0x56, 0x36, 0x54, 0x3d, 0x13, 0x0e, 0x0a, 0x09, 0x02, 0x63, 0x87,
-    0x68, 0x36, 0x25, 0x43, 0x17, 0x10, 0x1a, 0x60, 0x16, 0x34, 0x49, 0x44, 0x4b, 0x85, 0xe5, 0xab,
-    0x5f, 0x5f, 0xab, 0xe5, 0x85, 0x85, 0xe4, 0xaa, 0x5f, 0x5f, 0xaa, 0xe4, 0x85, 0x9f, 0x01, 0x10,
-    0xcb, 0x71, 0x71, 0xcb, 0xfe, 0xf0, 0x9f, 0x9f, 0xfe, 0xf0, 0xcd, 0x72, 0x72, 0xcd, 0x01, 0x10,
-    0x00, 0x01, 0x00, 0x9d, 0x05, 0x10, 0x03, 0x44, 0x05, 0xaa, 0x00, 0x03, 0x00, 0x08, 0xb1, 0x03,
-    0x02, 0x00, 0x2f, 0x33, 0x30, 0x31, 0x41, 0x15, 0x21, 0x35, 0x03, 0x44, 0xfd, 0x59, 0x05, 0xaa,
-    0x9a, 0x9a, 0x00, 0x02, 0x00, 0x81, 0x03, 0xb1, 0x02, 0x8e, 0x05, 0xc5, 0x00, 0x0f, 0x00, 0x1b,
-    0x00, 0x0f, 0xb5, 0x13, 0x0c, 0xc0, 0x19, 0x04, 0x03, 0x00, 0x3f, 0x33, 0x1a, 0xcc, 0x32, 0x30,
-    0x31, 0x53, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x16, 0x15, 0x14, 0x06, 0x06, 0x23, 0x22, 0x26,
-    0x26, 0x37, 0x14, 0x16, 0x33, 0x32, 0x36, 0x35, 0x34, 0x26, 0x23, 0x22, 0x06, 0x81, 0x48, 0x79,
-    0x47, 0x48, 0x76, 0x47, 0x47, 0x76, 0x48, 0x47, 0x79, 0x48, 0x87, 0x4c, 0x35, 0x35, 0x48, 0x48,
-    0x35, 0x35, 0x4c, 0x04, 0xb9, 0x49, 0x7a, 0x49, 0x49, 0x7a, 0x49, 0x49, 0x79, 0x46, 0x46, 0x79,
-    0x49, 0x36, 0x49, 0x48, 0x37, 0x38, 0x4a, 0x4a, 0x00, 0x03, 0x00, 0x5c, 0x00, 0x01, 0x03, 0xf0,
-    0x04, 0xfd, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x12, 0xb7, 0x0b, 0x02, 0x03, 0x03, 0x04,
-    0x0a, 0x12, 0x72, 0x00, 0x2b, 0x2f, 0x39, 0x2f, 0x33, 0x32, 0x30, 0x31, 0x41, 0x15, 0x21, 0x35,
-    0x01, 0x11, 0x23, 0x11, 0x01, 0x15, 0x21, 0x35, 0x03, 0xf0, 0xfc, 0x6c, 0x02, 0x3c, 0xd5, 0x02,
-    0x0b, 0xfc, 0xad, 0x03, 0x83, 0xc4, 0xc4, 0x01, 0x7a, 0xfc, 0x3c, 0x03, 0xc4, 0xfb, 0xc5, 0xc1,
-    0xc1, 0x00, 0x00, 0x01, 0x00, 0x3d, 0x02, 0x9b, 0x02, 0xb0, 0x05, 0xbb, 0x00, 0x1c, 0x00, 0x13,
-    0xb1, 0x1c, 0x02, 0xb8, 0x01, 0x00, 0xb3, 0x0b, 0x13, 0x03, 0x72, 0x00, 0x2b, 0x32, 0x1a, 0xcc,
-    0x32, 0x30, 0x31, 0x41, 0x15, 0x21, 0x35, 0x01, 0x3e, 0x02, 0x35, 0x34, 0x26, 0x23, 0x22, 0x06,
-    0x15, 0x23, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x16, 0x15, 0x14, 0x06, 0x06, 0x07, 0x07, 0x02,
-    0xb0, 0xfd, 0x9f, 0x01, 0x1f, 0x29, 0x31, 0x17, 0x38, 0x35, 0x40, 0x3f, 0xb6, 0x49, 0x87, 0x5e,
-    0x5f, 0x85, 0x47, 0x30, 0x5b, 0x43, 0x8d, 0x03, 0x2c, 0x91, 0x7a, 0x01, 0x09, 0x25, 0x3f, 0x34,
-    0x12, 0x2b, 0x37, 0x47, 0x33, 0x49, 0x7a, 0x48, 0x3a, 0x6c, 0x4c, 0x37, 0x5d, 0x5c, 0x37, 0x76,
-    0x00, 0x02, 0x00, 0x37, 0x02, 0x90, 0x02, 0xa9, 0x05, 0xbb, 0x00, 0x19, 0x00, 0x33, 0x00, 0x2c,
-    0x40, 0x0c, 0x1c, 0x18, 0x00, 0x00, 0x1a, 0x1a, 0x10, 0x2c, 0x29, 0x29, 0x24, 0x10, 0xb8, 0x01,
-    0x00, 0xb5, 0x0b, 0x0b, 0x08, 0x10, 0x03, 0x72, 0x00, 0x2b, 0x32, 0x32, 0x2f, 0x1a, 0x10, 0xcc,
-    0x32, 0x2f, 0x32, 0x11, 0x39, 0x2f, 0x33, 0x12, 0x39, 0x39, 0x30, 0x31, 0x41, 0x33, 0x32, 0x36,
-    0x36, 0x35, 0x34, 0x26, 0x23, 0x22, 0x06, 0x15, 0x23, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x16,
-    0x15, 0x14, 0x06, 0x06, 0x23, 0x23, 0x15, 0x35, 0x33, 0x32, 0x16, 0x16, 0x15, 0x14, 0x06, 0x06,
-    0x23, 0x22, 0x26, 0x26, 0x35, 0x33, 0x14, 0x16, 0x33, 0x32, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23,
-    0x01, 0x0e, 0x57, 0x2b, 0x38, 0x1d, 0x37, 0x40, 0x31, 0x43, 0xb6, 0x50, 0x86, 0x4f, 0x5b, 0x8a,
-    0x4d, 0x47, 0x7d, 0x54, 0x75, 0x75, 0x5d, 0x84, 0x45, 0x54, 0x91, 0x5a, 0x4b, 0x8d, 0x5b, 0xb7,
-    0x48, 0x3d, 0x41, 0x3f, 0x23, 0x40, 0x2b, 0x04, 0x6c, 0x19, 0x2c, 0x1e, 0x24, 0x37, 0x29, 0x25,
-    0x47, 0x64, 0x34, 0x33, 0x64, 0x4a, 0x39, 0x58, 0x31, 0x29, 0x52, 0x2b, 0x58, 0x46, 0x4a, 0x68,
-    0x36, 0x31, 0x6a, 0x56, 0x27, 0x38, 0x39, 0x2b, 0x26, 0x2e, 0x15, 0x00, 0x00, 0x01, 0x00, 0x6f,
-    0x04, 0xd3, 0x02, 0x42, 0x06, 0x00, 0x00, 0x03, 0x00, 0x0a, 0xb2, 0x01, 0x80, 0x00, 0x00, 0x2f,
-    0x1a, 0xcd, 0x30, 0x31, 0x53, 0x13, 0x21, 0x01, 0x6f, 0xc3, 0x01, 0x10, 0xfe, 0xf0, 0x04, 0xd3,
-    0x01, 0x2d, 0xfe, 0xd3, 0x00, 0x03, 0x00, 0x93, 0xfe, 0x60, 0x04, 0x24, 0x04, 0x3a, 0x00, 0x04,
-    0x00, 0x1a, 0x00, 0x1e, 0x00, 0x19, 0x40, 0x0c, 0x1d, 0x05, 0x00, 0x16, 0x0b, 0x13, 0x72, 0x03,
-    0x12, 0x72, 0x1c, 0x00, 0x00, 0x2f, 0x32, 0x2b, 0x2b, 0x32, 0x11, 0x39, 0x2f, 0x30, 0x31, 0x41,
-    0x33, 0x11, 0x23, 0x27, 0x37, 0x37, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x26, 0x26, 0x27, 0x03, 0x33,
-    0x14, 0x1e, 0x02, 0x33, 0x32, 0x3e, 0x02, 0x01, 0x33, 0x11, 0x23, 0x03, 0x32, 0xf2, 0xdf, 0x13,
-    0x23, 0x5f, 0x2b, 0x59, 0x88, 0x5d, 0x4a, 0x76, 0x56, 0x1c, 0x1f, 0x89, 0x1e, 0x36, 0x49, 0x2b,
-    0x4f, 0x67, 0x3b, 0x19, 0xfd, 0x3e, 0xf0, 0xf0, 0x04, 0x3a, 0xfb, 0xc6, 0xfa, 0xfd, 0x02, 0x72,
-    0xc0, 0x8e, 0x4e, 0x2b, 0x5c, 0x4a, 0x01, 0x11, 0x5a, 0x72, 0x3d, 0x18, 0x31, 0x59, 0x79, 0x02,
-    0x8b, 0xfa, 0x26, 0x00, 0x00, 0x01, 0x00, 0x49, 0x00, 0x00, 0x03, 0x54, 0x05, 0xb0, 0x00, 0x0c,
-    0x00, 0x0e, 0xb6, 0x03, 0x0b, 0x02, 0x72, 0x00, 0x12, 0x72, 0x00, 0x2b, 0x2b, 0xcd, 0x30, 0x31,
-    0x61, 0x23, 0x11, 0x23, 0x22, 0x26, 0x26, 0x35, 0x34, 0x36, 0x36, 0x33, 0x21, 0x03, 0x54, 0xc9,
-    0x56, 0x9f, 0xdb, 0x72, 0x72, 0xdb, 0x9f, 0x01, 0x1f, 0x02, 0x08, 0x79, 0xd4, 0x87, 0x86, 0xd4,
-    0x7a, 0x00, 0x00, 0x01, 0x00, 0x90, 0x02, 0x46, 0x01, 0xaa, 0x03, 0x4e, 0x00, 0x0b, 0x00, 0x08,
-    0xb1, 0x03, 0x09, 0x00, 0x2f, 0x33, 0x30, 0x31, 0x53, 0x34, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14,
-    0x06, 0x23, 0x22, 0x26, 0x90, 0x4b, 0x42, 0x42, 0x4b, 0x4b, 0x42, 0x42, 0x4b, 0x02, 0xc9, 0x38,
-    0x4d, 0x4d, 0x38, 0x38, 0x4b, 0x4b, 0x00, 0x01, 0x00, 0x6c, 0xfe, 0x3f, 0x01, 0xca, 0x00, 0x04,
-    0x00, 0x13, 0x00, 0x11, 0xb6, 0x0b, 0x0a, 0x80, 0x13, 0x02, 0x00, 0x12, 0x00, 0x3f, 0x32, 0x32,
-    0x1a, 0xcc, 0x32, 0x30, 0x31, 0x77, 0x33, 0x07, 0x16, 0x16, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x27,
-    0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x27, 0x8b, 0xb3, 0x0c, 0x39, 0x5f, 0x2a, 0x53, 0x7b,
-    0x51, 0x07, 0x27, 0x3e, 0x25, 0x20, 0x43, 0x35, 0x04, 0x38, 0x0a, 0x4d, 0x56, 0x33, 0x52, 0x3b,
-    0x20, 0x88, 0x13, 0x28, 0x20, 0x1f, 0x22, 0x12, 0x04, 0x00, 0x00, 0x01, 0x00, 0x82, 0x02, 0x9b,
-    0x02, 0x01, 0x05, 0xaf, 0x00, 0x06, 0x00, 0x0a, 0xb3, 0x06, 0x02, 0x72, 0x01, 0x00, 0x2f, 0x2b,
-    0x30, 0x31, 0x41, 0x11, 0x23, 0x11, 0x07, 0x35, 0x25, 0x02, 0x01, 0xb5, 0xca, 0x01, 0x6c, 0x05,
-    0xaf, 0xfc, 0xec, 0x02, 0x40, 0x31, 0x8f, 0x76, 0x00, 0x02, 0x00, 0x79, 0x02, 0xb3, 0x03, 0x28,
-    0x05, 0xc5, 0x00, 0x11, 0x00, 0x23, 0x00, 0x10, 0xb6, 0x17, 0x0e, 0x20, 0x05, 0x03, 0x72, 0x0e,
-    0x00, 0x2f, 0x2b, 0x32, 0x11, 0x33, 0x30, 0x31, 0x53, 0x35, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16,
-    0x16, 0x15, 0x15, 0x14, 0x06, 0x06, 0x23, 0x22, 0x26, 0x26, 0x37, 0x15, 0x14, 0x16, 0x16, 0x33,
-    0x32, 0x36, 0x36, 0x35, 0x35, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x79, 0x55, 0x99, 0x6a,
-    0x6a, 0x9a, 0x53, 0x53, 0x99, 0x69, 0x6b, 0x9a, 0x55, 0xa8, 0x26, 0x50, 0x3c, 0x3b, 0x4d, 0x27,
-    0x28, 0x4d, 0x3c, 0x3b, 0x4f, 0x26, 0x04, 0x13, 0x50, 0x67, 0xa0, 0x5b, 0x5b, 0xa0, 0x67, 0x50,
-    0x67, 0x9f, 0x5a, 0x5a, 0x9f, 0xb7, 0x50, 0x3c, 0x60, 0x37, 0x37, 0x60, 0x3c, 0x50, 0x3c, 0x5e,
-    0x38, 0x38, 0x5e, 0x00, 0xff, 0xff, 0x00, 0x5e, 0x00, 0x8b, 0x03, 0x97, 0x03, 0xa8, 0x04, 0x26,
-    0x01, 0x93, 0x09, 0x00, 0x00, 0x07, 0x01, 0x93, 0x01, 0x7d, 0x00, 0x00, 0xff, 0xff, 0x00, 0x5f,
-    0x00, 0x00, 0x05, 0x7d, 0x05, 0xac, 0x04, 0x27, 0x01, 0xe0, 0xff, 0xdd, 0x02, 0x98, 0x00, 0x27,
-    0x01, 0x94, 0x01, 0x1c, 0x00, 0x08, 0x00, 0x07, 0x02, 0x3a, 0x02, 0xbe, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x53, 0x00, 0x00, 0x05, 0xc5, 0x05, 0xaf, 0x04, 0x27, 0x01, 0x94, 0x00, 0xf1, 0x00, 0x08,
-    0x00, 0x27, 0x01, 0xe0, 0xff, 0xd1, 0x02, 0x9b, 0x00, 0x07, 0x01, 0xdf, 0x03, 0x15, 0x00, 0x00,
-    0xff, 0xff, 0x00, 0x66, 0x00, 0x00, 0x06, 0x00, 0x05, 0xbb, 0x04, 0x27, 0x01, 0x94, 0x01, 0xaf,
-    0x00, 0x08, 0x00, 0x27, 0x02, 0x3a, 0x03, 0x41, 0x00, 0x00, 0x00, 0x07, 0x02, 0x39, 0x00, 0x2f,
-    0x02, 0x9b, 0x00, 0x02, 0x00, 0x46, 0xfe, 0x7e, 0x03, 0xa7, 0x04, 0x4e, 0x00, 0x21, 0x00, 0x2d,
-    0x00, 0x18, 0x40, 0x0a, 0x00, 0x00, 0x25, 0x25, 0x2b, 0x10, 0x11, 0x11, 0x0d, 0x16, 0x00, 0x2f,
-    0x33, 0x33, 0x2f, 0x3f, 0x33, 0x2f, 0x33, 0x2f, 0x30, 0x31, 0x41, 0x33, 0x14, 0x06, 0x06, 0x07,
-    0x0e, 0x02, 0x15, 0x14, 0x16, 0x16, 0x33, 0x32, 0x36, 0x36, 0x37, 0x33, 0x0e, 0x02, 0x23, 0x22,
-    0x26, 0x26, 0x35, 0x34, 0x36, 0x36, 0x37, 0x3e, 0x02, 0x13, 0x14, 0x06, 0x23, 0x22, 0x26, 0x35,
-    0x34, 0x36, 0x33, 0x32, 0x16, 0x01, 0x98, 0xdf, 0x1d, 0x43, 0x3c, 0x2c, 0x4a, 0x2d, 0x2c, 0x53,
-    0x3b, 0x34, 0x58, 0x37, 0x01, 0xf1, 0x01, 0x74, 0xc3, 0x7a, 0x88, 0xc1, 0x66, 0x48, 0x71, 0x3f,
-    0x25, 0x27, 0x0e, 0xf7, 0x49, 0x40, 0x41, 0x4a, 0x4a, 0x41, 0x40, 0x49, 0x02, 0x96, 0x5d, 0x7d,
-    0x65, 0x3c, 0x2c, 0x50, 0x5d, 0x3e, 0x3f, 0x56, 0x2b, 0x29, 0x54, 0x40, 0x7e, 0xad, 0x58, 0x5b,
-    0xac, 0x7b, 0x5a, 0x92, 0x7e, 0x3b, 0x23, 0x48, 0x54, 0x01, 0x6a, 0x36, 0x4b, 0x4b, 0x36, 0x36,
-    0x4a, 0x4a, 0x00, 0x06, 0xff, 0xfc, 0x00, 0x00, 0x07, 0x4e, 0x05, 0xb0, 0x00, 0x04, 0x00, 0x08,
-    0x00, 0x0c, 0x00, 0x10, 0x00, 0x14, 0x00, 0x18, 0x00, 0x31, 0x40, 0x18, 0x00, 0x17, 0x17, 0x08,
-    0x07, 0x14, 0x13, 0x07, 0x13, 0x07, 0x13, 0x02, 0x0d, 0x03, 0x18, 0x02, 0x72, 0x0c, 0x0b, 0x0b,
-    0x0e, 0x02, 0x08, 0x72, 0x00, 0x2b, 0x32, 0x32, 0x11, 0x33, 0x2b, 0x32, 0x32, 0x11, 0x39, 0x39,
-    0x2f, 0x2f, 0x11, 0x33, 0x11, 0x33, 0x32, 0x11, 0x33, 0x30, 0x31, 0x41, 0x01, 0x21, 0x01, 0x33,
-    0x13, 0x15, 0x21, 0x35, 0x01, 0x15, 0x21, 0x35, 0x13, 0x13, 0x23, 0x03, 0x01, 0x15, 0x21, 0x35,
-    0x01, 0x15, 0x21, 0x35, 0x03, 0xd8, 0xfd, 0x43, 0xfe, 0xe1, 0x03, 0x3c, 0x99, 0x80, 0xfd, 0x15,
-    0x05, 0xe8, 0xfd, 0x23, 0x18, 0x3d, 0xf1, 0x3d, 0x03, 0x27, 0xfd, 0x8a, 0x02, 0xc7, 0xfd, 0x24,
-    0x05, 0x18, 0xfa, 0xe8, 0x05, 0xb0, 0xfc, 0x7a, 0xd2, 0xd2, 0xfe, 0x97, 0xc1, 0xc1, 0x04, 0xef,
-    0xfa, 0x50, 0x05, 0xb0, 0xfd, 0xa1, 0xc1, 0xc1, 0x02, 0x5f, 0xc1, 0xc1, 0x00, 0x02, 0x00, 0x4c,
-    0x00, 0xcb, 0x03, 0xeb, 0x04, 0x77, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0c, 0xb3, 0x04, 0x06, 0x02,
-    0x00, 0x00, 0x2f, 0x2f, 0x33, 0x32, 0x30, 0x31, 0x77, 0x27, 0x01, 0x17, 0x03, 0x01, 0x37, 0x01,
-    0xde, 0x92, 0x03, 0x0b, 0x92, 0x90, 0xfc, 0xf5, 0x92, 0x03, 0x0b, 0xcb, 0x91, 0x03, 0x1b, 0x92,
-    0xfc, 0xe6, 0x03, 0x1a, 0x92, 0xfc, 0xe5, 0x00, 0x00, 0x03, 0x00, 0x69, 0xff, 0xa2, 0x05, 0x22,
-    0x05, 0xed, 0x00, 0x03, 0x00, 0x1b, 0x00, 0x33, 0x00, 0x17, 0x40, 0x0b, 0x01, 0x00, 0x2f, 0x0a,
-    0x23, 0x16, 0x03, 0x72, 0x0a, 0x09, 0x72, 0x00, 0x2b, 0x2b, 0x32, 0x11, 0x33, 0x32, 0x33, 0x30,
-    0x31, 0x41, 0x01, 0x23, 0x01, 0x13, 0x15, 0x14, 0x02, 0x06, 0x06, 0x23, 0x22, 0x2e, 0x03, 0x35,
-    0x35, 0x34, 0x12, 0x36, 0x36, 0x33, 0x32, 0x1e, 0x03, 0x07, 0x35, 0x34, 0x2e, 0x03, 0x23, 0x22,
-    0x0e, 0x02, 0x15, 0x15, 0x14, 0x1e, 0x03, 0x33, 0x32, 0x3e, 0x02, 0x05, 0x10, 0xfc, 0x32, 0xa7,
-    0x03, 0xd0, 0xb7, 0x56, 0xa0, 0xde, 0x87, 0x6b, 0xb9, 0x96, 0x6b, 0x39, 0x58, 0xa1, 0xdd, 0x86,
-    0x6c, 0xba, 0x95, 0x69, 0x39, 0xfc, 0x1e, 0x3b, 0x56, 0x6f, 0x43, 0x53, 0x82, 0x5b, 0x30, 0x1f,
-    0x3c, 0x57, 0x6e, 0x42, 0x54, 0x82, 0x5a, 0x2f, 0x05, 0xed, 0xf9, 0xb5, 0x06, 0x4b, 0xfd, 0x13,
-    0x50, 0xa5, 0xfe, 0xfa, 0xb8, 0x61, 0x3f, 0x77, 0xad, 0xdd, 0x84, 0x50, 0xa5, 0x01, 0x05, 0xb9,
-    0x61, 0x3f, 0x78, 0xac, 0xdd, 0xd4, 0x52, 0x61, 0x9f, 0x79, 0x52, 0x2a, 0x41, 0x7f, 0xbb, 0x7a,
-    0x52, 0x62, 0x9f, 0x7a, 0x53, 0x2a, 0x41, 0x81, 0xbc, 0x00, 0x00, 0x02, 0x00, 0x95, 0x00, 0x00,
-    0x04, 0x81, 0x05, 0xb0, 0x00, 0x03, 0x00, 0x19, 0x00, 0x1d, 0x40, 0x0e, 0x0f, 0x0e, 0x0e, 0x03,
-    0x19, 0x04, 0x04, 0x03, 0x00, 0x02, 0x72, 0x03, 0x08, 0x72, 0x00, 0x2b, 0x2b, 0x11, 0x39, 0x2f,
-    0x33, 0x11, 0x39, 0x2f, 0x33, 0x30, 0x31, 0x53, 0x33, 0x11, 0x23, 0x13, 0x21, 0x32, 0x16, 0x16,
-    0x15, 0x14, 0x06, 0x06, 0x23, 0x21, 0x35, 0x21, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23,
-    0x23, 0x95, 0xf1, 0xf1, 0x60, 0x01, 0x8a, 0xa7, 0xe4, 0x77, 0x77, 0xe4, 0xa7, 0xfe, 0xde, 0x01,
-    0x22, 0x62, 0x77, 0x37, 0x37, 0x77, 0x62, 0xfa, 0x05, 0xb0, 0xfa, 0x50, 0x04, 0x98, 0x71, 0xc6,
-    0x7f, 0x7e, 0xc6, 0x71, 0xbf, 0x46, 0x70, 0x3e, 0x40, 0x71, 0x48, 0x00, 0x00, 0x01, 0x00, 0x8a,
-    0xff, 0xec, 0x04, 0x9e, 0x06, 0x15, 0x00, 0x39, 0x00, 0x19, 0x40, 0x0d, 0x23, 0x1b, 0x36, 0x08,
-    0x02, 0x0a, 0x72, 0x08, 0x01, 0x72, 0x1b, 0x0b, 0x72, 0x00, 0x2b, 0x2b, 0x2b, 0x11, 0x33, 0x11,
-    0x33, 0x30, 0x31, 0x41, 0x11, 0x23, 0x11, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x16, 0x16, 0x15, 0x14,
-    0x0e, 0x02, 0x15, 0x14, 0x1e, 0x03, 0x15, 0x14, 0x06, 0x06, 0x23, 0x22, 0x26, 0x26, 0x27, 0x37,
-    0x16, 0x16, 0x33, 0x32, 0x36, 0x36, 0x35, 0x34, 0x2e, 0x03, 0x35, 0x34, 0x3e, 0x02, 0x35, 0x34,
-    0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x01, 0x7a, 0xf0, 0x3e, 0x73, 0xa0, 0x64, 0x71, 0xb5, 0x6b,
-    0x23, 0x2e, 0x23, 0x41, 0x60, 0x60, 0x41, 0x66, 0xbc, 0x81, 0x34, 0x72, 0x5f, 0x1b, 0x31, 0x21,
-    0x7c, 0x47, 0x40, 0x54, 0x2a, 0x41, 0x60, 0x61, 0x41, 0x25, 0x30, 0x25, 0x2d, 0x4e, 0x32, 0x3b,
-    0x55, 0x2e, 0x04, 0x51, 0xfb, 0xaf, 0x04, 0x53, 0x70, 0xa8, 0x70, 0x3a, 0x4e, 0x9c, 0x77, 0x4d,
-    0x62, 0x49, 0x4b, 0x37, 0x30, 0x51, 0x4f, 0x5b, 0x73, 0x4c, 0x74, 0x9f, 0x51, 0x12, 0x1d, 0x11,
-    0xbf, 0x14, 0x2c, 0x29, 0x47, 0x2e, 0x35, 0x52, 0x4c, 0x57, 0x72, 0x4f, 0x40, 0x59, 0x4b, 0x53,
-    0x3a, 0x38, 0x4f, 0x2a, 0x35, 0x73, 0x00, 0x03, 0x00, 0x48, 0xff, 0xeb, 0x06, 0x86, 0x04, 0x4f,
-    0x00, 0x14, 0x00, 0x32, 0x00, 0x5e, 0x00, 0x37, 0x40, 0x1c, 0x57, 0x33, 0x33, 0x32, 0x17, 0x46,
-    0x45, 0x14, 0x25, 0x00, 0x03, 0x29, 0x17, 0x45, 0x17, 0x45, 0x0f, 0x1f, 0x29, 0x0b, 0x72, 0x4c,
-    0x3e, 0x3e, 0x05, 0x0f, 0x07, 0x72, 0x00, 0x2b, 0x32, 0x32, 0x11, 0x33, 0x2b, 0x32, 0x12, 0x39,
-    0x39, 0x2f, 0x2f, 0x12, 0x17, 0x39, 0x11, 0x33, 0x11, 0x33, 0x32, 0x11, 0x33, 0x30, 0x31, 0x65,
-    0x11, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x15, 0x27, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x16,
-    0x16, 0x15, 0x11, 0x03, 0x17, 0x23, 0x22, 0x06, 0x06, 0x15, 0x14, 0x16, 0x16, 0x33, 0x32, 0x3e,
-    0x02, 0x37, 0x17, 0x0e, 0x02, 0x23, 0x22, 0x26, 0x26, 0x35, 0x34, 0x3e, 0x02, 0x33, 0x01, 0x22,
-    0x2e, 0x02, 0x35, 0x35, 0x34, 0x3e, 0x02, 0x17, 0x32, 0x1e, 0x02, 0x15, 0x15, 0x21, 0x35, 0x21,
-    0x35, 0x34, 0x26, 0x26, 0x23, 0x22, 0x0e, 0x02, 0x15, 0x15, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x36,
-    0x37, 0x17, 0x0e, 0x02, 0x02, 0xe1, 0x2a, 0x53, 0x3b, 0x40, 0x5e, 0x32, 0xf1, 0x41, 0x76, 0xa6,
-    0x66, 0x7e, 0xba, 0x68, 0xc0, 0x01, 0xe7, 0x4d, 0x69, 0x35, 0x28, 0x52, 0x3f, 0x30, 0x63, 0x54,
-    0x33, 0x01, 0x75, 0x1a, 0x73, 0xb4, 0x7d, 0x7b, 0xaa, 0x58, 0x3d, 0x78, 0xb1, 0x75, 0x02, 0xc3,
-    0x7c, 0xbe, 0x83, 0x42, 0x42, 0x7e, 0xb1, 0x6e, 0x6b, 0xa7, 0x73, 0x3b, 0xfc, 0xcf, 0x02, 0x42,
-    0x2a, 0x5c, 0x4b, 0x40, 0x5d, 0x3d, 0x1e, 0x22, 0x47, 0x71, 0x4f, 0x6f, 0x8a, 0x37, 0x47, 0x1d,
-    0x6d, 0x9b, 0xb7, 0x02, 0x12, 0x3e, 0x58, 0x2f, 0x2a, 0x48, 0x2b, 0x12, 0x48, 0x78, 0x5a, 0x31,
-    0x57, 0xae, 0x82, 0xfe, 0x13, 0x01, 0xa9, 0xa4, 0x30, 0x4e, 0x2e, 0x2a, 0x43, 0x26, 0x24, 0x38,
-    0x3f, 0x1c, 0x95, 0x30, 0x64, 0x43, 0x52, 0x96, 0x64, 0x4f, 0x7b, 0x55, 0x2d, 0xfd, 0x68, 0x4e,
-    0x8e, 0xc1, 0x73, 0x39, 0x77, 0xc5, 0x90, 0x4f, 0x01, 0x43, 0x80, 0xb4, 0x70, 0x8c, 0xa7, 0x1d,
-    0x44, 0x6c, 0x3f, 0x35, 0x5e, 0x7e, 0x49, 0x39, 0x47, 0x79, 0x5c, 0x34, 0x3d, 0x1f, 0xa1, 0x17,
-    0x39, 0x2b, 0x00, 0x02, 0x00, 0x68, 0xff, 0xec, 0x04, 0x42, 0x06, 0x2c, 0x00, 0x34, 0x00, 0x38,
-    0x00, 0x19, 0x40, 0x0b, 0x36, 0x20, 0x16, 0x16, 0x01, 0x2a, 0x0c, 0x0b, 0x72, 0x38, 0x01, 0x00,
-    0x2f, 0x33, 0x2b, 0x32, 0x12, 0x39, 0x2f, 0x33, 0x33, 0x30, 0x31, 0x53, 0x37, 0x16, 0x04, 0x16,
-    0x12, 0x15, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x34, 0x3e, 0x02, 0x33, 0x32,
-    0x16, 0x16, 0x17, 0x27, 0x34, 0x2e, 0x02, 0x23, 0x22, 0x0e, 0x02, 0x15, 0x14, 0x1e, 0x02, 0x33,
-    0x32, 0x3e, 0x02, 0x35, 0x35, 0x34, 0x2e, 0x02, 0x25, 0x01, 0x27, 0x01, 0xf5, 0x4b, 0xab, 0x01,
-    0x1a, 0xce, 0x6f, 0x4a, 0x85, 0xb5, 0x6c, 0x6d, 0xb4, 0x83, 0x46, 0x3f, 0x77, 0xa5, 0x66, 0x71,
-    0xb6, 0x6d, 0x04, 0x57, 0x21, 0x42, 0x64, 0x43, 0x40, 0x62, 0x43, 0x22, 0x22, 0x41, 0x5e, 0x3c,
-    0x3c, 0x5d, 0x40, 0x21, 0x62, 0xa9, 0xd8, 0x02, 0x6f, 0xfd, 0xd9, 0x4b, 0x02, 0x28, 0x05, 0x6d,
-    0xbf, 0x25, 0xa2, 0xf1, 0xfe, 0xc9, 0xbc, 0x55, 0x7f, 0xd4, 0x9a, 0x53, 0x4b, 0x86, 0xb1, 0x66,
-    0x72, 0xb9, 0x85, 0x48, 0x67, 0xa9, 0x64, 0x02, 0x1d, 0x41, 0x38, 0x23, 0x2c, 0x53, 0x76, 0x4a,
-    0x39, 0x6a, 0x54, 0x31, 0x38, 0x64, 0x87, 0x4f, 0x65, 0xa7, 0xfb, 0xb4, 0x75, 0x30, 0xfe, 0x95,
-    0x6b, 0x01, 0x6a, 0x00, 0x00, 0x03, 0x00, 0x43, 0x00, 0x96, 0x04, 0x3a, 0x04, 0xc9, 0x00, 0x03,
-    0x00, 0x0f, 0x00, 0x1b, 0x00, 0x13, 0xb7, 0x19, 0x13, 0x02, 0x07, 0x0d, 0x03, 0x02, 0x12, 0x00,
-    0x3f, 0xdd, 0xc6, 0x32, 0x10, 0xc6, 0x32, 0x30, 0x31, 0x41, 0x15, 0x21, 0x35, 0x01, 0x34, 0x36,
-    0x33, 0x32, 0x16, 0x15, 0x14, 0x06, 0x23, 0x22, 0x26, 0x11, 0x34, 0x36, 0x33, 0x32, 0x16, 0x15,
-    0x14, 0x06, 0x23, 0x22, 0x26, 0x04, 0x3a, 0xfc, 0x09, 0x01, 0x72, 0x4b, 0x42, 0x42, 0x4b, 0x4b,
-    0x42, 0x42, 0x4b, 0x4b, 0x42, 0x42, 0x4b, 0x4b, 0x42, 0x42, 0x4b, 0x03, 0x18, 0xce, 0xce, 0x01,
-    0x2e, 0x38, 0x4b, 0x4b, 0x38, 0x38, 0x4a, 0x4a, 0xfd, 0x0a, 0x38, 0x4b, 0x4b, 0x38, 0x37, 0x4b,
-    0x4b, 0x00, 0x00, 0x03, 0x00, 0x4e, 0xff, 0x75, 0x04, 0x3c, 0x04, 0xbd, 0x00, 0x03, 0x00, 0x19,
-    0x00, 0x2f, 0x00, 0x19, 0x40, 0x0c, 0x20, 0x01, 0x01, 0x15, 0x0b, 0x72, 0x2b, 0x00, 0x00, 0x0a,
-    0x07, 0x72, 0x00, 0x2b, 0x32, 0x2f, 0x32, 0x2b, 0x32, 0x2f, 0x32, 0x30, 0x31, 0x41, 0x01, 0x23,
-    0x01, 0x01, 0x35, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x15, 0x14, 0x0e, 0x02, 0x23,
-    0x22, 0x2e, 0x02, 0x37, 0x15, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x3e, 0x02, 0x35, 0x35, 0x34, 0x2e,
-    0x02, 0x23, 0x22, 0x0e, 0x02, 0x03, 0xdc, 0xfd, 0x69, 0x8f, 0x02, 0x97, 0xfd, 0x01, 0x44, 0x81,
-    0xbb, 0x76, 0x77, 0xbb, 0x82, 0x44, 0x44, 0x82, 0xba, 0x76, 0x77, 0xbb, 0x82, 0x44, 0xf1, 0x1e,
-    0x40, 0x64, 0x45, 0x43, 0x63, 0x40, 0x1f, 0x1f, 0x41, 0x63, 0x44, 0x44, 0x63, 0x40, 0x1e, 0x04,
-    0xbd, 0xfa, 0xb8, 0x05, 0x48, 0xfd, 0x54, 0x17, 0x75, 0xc9, 0x95, 0x53, 0x53, 0x95, 0xc9, 0x75,
-    0x17, 0x75, 0xc8, 0x95, 0x53, 0x53, 0x95, 0xc8, 0x8c, 0x17, 0x49, 0x82, 0x62, 0x38, 0x38, 0x62,
-    0x82, 0x49, 0x17, 0x48, 0x81, 0x64, 0x39, 0x39, 0x64, 0x81, 0x00, 0x03, 0x00, 0x81, 0xfe, 0x60,
-    0x04, 0x34, 0x06, 0x00, 0x00, 0x03, 0x00, 0x19, 0x00, 0x2f, 0x00, 0x1b, 0x40, 0x0f, 0x2b, 0x0a,
-    0x20, 0x15, 0x07, 0x72, 0x0a, 0x0b, 0x72, 0x03, 0x00, 0x72, 0x02, 0x0e, 0x72, 0x00, 0x2b, 0x2b,
-    0x2b, 0x2b, 0x32, 0x11, 0x33, 0x30, 0x31, 0x41, 0x11, 0x23, 0x11, 0x01, 0x15, 0x14, 0x0e, 0x02,
-    0x23, 0x22, 0x2e, 0x02, 0x27, 0x35, 0x3e, 0x03, 0x33, 0x32, 0x1e, 0x02, 0x07, 0x35, 0x34, 0x2e,
-    0x02, 0x23, 0x22, 0x0e, 0x02, 0x07, 0x15, 0x1e, 0x03, 0x33, 0x32, 0x3e, 0x02, 0x01, 0x73, 0xf2,
-    0x03, 0xb3, 0x37, 0x6b, 0x9c, 0x66, 0x65, 0x97, 0x68, 0x3f, 0x0d, 0x0d, 0x3f, 0x68, 0x95, 0x64,
-    0x67, 0x9e, 0x6b, 0x37, 0xf1, 0x1c, 0x3c, 0x5d, 0x41, 0x40, 0x5c, 0x3e, 0x23, 0x06, 0x08, 0x25,
-    0x3d, 0x5b, 0x40, 0x41, 0x5c, 0x3b, 0x1c, 0x06, 0x00, 0xf8, 0x60, 0x07, 0xa0, 0xfc, 0x27, 0x15,
-    0x76, 0xc9, 0x95, 0x52, 0x4b, 0x8a, 0xbb, 0x70, 0x51, 0x77, 0xc2, 0x8c, 0x4c, 0x4f, 0x91, 0xcb,
-    0x91, 0x15, 0x4b, 0x81, 0x62, 0x37, 0x2b, 0x4c, 0x65, 0x3b, 0xc2, 0x37, 0x5f, 0x48, 0x29, 0x38,
-    0x63, 0x82, 0x00, 0x04, 0x00, 0x50, 0xff, 0xec, 0x04, 0xad, 0x06, 0x00, 0x00, 0x04, 0x00, 0x1a,
-    0x00, 0x2f, 0x00, 0x33, 0x00, 0x1d, 0x40, 0x0f, 0x21, 0x04, 0x04, 0x16, 0x0b, 0x72, 0x33, 0x32,
-    0x2b, 0x0b, 0x07, 0x72, 0x01, 0x00, 0x72, 0x00, 0x2b, 0x2b, 0x32, 0xce, 0x32, 0x2b, 0x32, 0x2f,
-    0x32, 0x30, 0x31, 0x65, 0x11, 0x33, 0x11, 0x23, 0x01, 0x35, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x1e,
-    0x02, 0x17, 0x15, 0x0e, 0x03, 0x23, 0x22, 0x2e, 0x02, 0x37, 0x15, 0x14, 0x1e, 0x02, 0x33, 0x32,
-    0x36, 0x36, 0x37, 0x35, 0x2e, 0x03, 0x23, 0x22, 0x0e, 0x02, 0x01, 0x15, 0x21, 0x35, 0x03, 0x10,
-    0xf2, 0xdb, 0xfd, 0x29, 0x3a, 0x6e, 0x9e, 0x63, 0x62, 0x94, 0x68, 0x3e, 0x0d, 0x0d, 0x3e, 0x68,
-    0x95, 0x63, 0x62, 0x9d, 0x6e, 0x3a, 0xf1, 0x1b, 0x3a, 0x5d, 0x41, 0x52, 0x6a, 0x3d, 0x0b, 0x06,
-    0x25, 0x3e, 0x5b, 0x3e, 0x42, 0x5c, 0x3b, 0x1c, 0x03, 0x6c, 0xfd, 0x60, 0xe0, 0x05, 0x20, 0xfa,
-    0x00, 0x02, 0x11, 0x15, 0x7b, 0xcb, 0x93, 0x4f, 0x4c, 0x8d, 0xc3, 0x77, 0x43, 0x74, 0xc0, 0x8c,
-    0x4c, 0x52, 0x94, 0xc9, 0x8b, 0x15, 0x4a, 0x80, 0x61, 0x37, 0x48, 0x7b, 0x4c, 0xb5, 0x3b, 0x66,
-    0x4d, 0x2b, 0x38, 0x62, 0x82, 0x03, 0x01, 0xa7, 0xa7, 0x00, 0x00, 0x04, 0x00, 0x1f, 0x00, 0x00,
-    0x05, 0x9c, 0x05, 0xb0, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x1f, 0x40, 0x0f,
-    0x03, 0x02, 0x80, 0x07, 0x06, 0x06, 0x0a, 0x0c, 0x0b, 0x02, 0x72, 0x0d, 0x0a, 0x08, 0x72, 0x00,
-    0x2b, 0x32, 0x2b, 0x32, 0x11, 0x39, 0x2f, 0x33, 0x1a, 0xcc, 0x32, 0x30, 0x31, 0x41, 0x15, 0x21,
-    0x35, 0x01, 0x15, 0x21, 0x35, 0x13, 0x11, 0x23, 0x11, 0x21, 0x11, 0x23, 0x11, 0x05, 0x9c, 0xfa,
-    0x83, 0x04, 0x3c, 0xfc, 0xfb, 0x3e, 0xfa, 0x04, 0x83, 0xfb, 0x04, 0xab, 0x9e, 0x9e, 0xfe, 0xa5,
-    0xc7, 0xc7, 0x02, 0x60, 0xfa, 0x50, 0x05, 0xb0, 0xfa, 0x50, 0x05, 0xb0, 0x00, 0x01, 0x00, 0x90,
-    0x00, 0x00, 0x01, 0x81, 0x04, 0x3a, 0x00, 0x03, 0x00, 0x0c, 0xb5, 0x03, 0x06, 0x72, 0x02, 0x0a,
-    0x72, 0x00, 0x2b, 0x2b, 0x30, 0x31, 0x41, 0x11, 0x23, 0x11, 0x01, 0x81, 0xf1, 0x04, 0x3a, 0xfb,
-    0xc6, 0x04, 0x3a, 0x00, 0x00, 0x03, 0x00, 0x8d, 0x00, 0x00, 0x04, 0x6d, 0x04, 0x3a, 0x00, 0x03,
-    0x00, 0x09, 0x00, 0x0d, 0x00, 0x1f, 0x40, 0x0f, 0x0c, 0x07, 0x07, 0x0b, 0x06, 0x06, 0x02, 0x09,
-    0x03, 0x06, 0x72, 0x0a, 0x02, 0x0a, 0x72, 0x00, 0x2b, 0x32, 0x2b, 0x32, 0x11, 0x39, 0x2f, 0x33,
-    0x33, 0x11, 0x33, 0x30, 0x31, 0x41, 0x11, 0x23, 0x11, 0x21, 0x01, 0x21, 0x27, 0x33, 0x01, 0x13,
-    0x01, 0x37, 0x01, 0x01, 0x7e, 0xf1, 0x03, 0xc6, 0xfd, 0xff, 0xfe, 0xf4, 0x1f, 0xb3, 0x01, 0x4d,
-    0x13, 0xfe, 0x99, 0xbf, 0x01, 0xdb, 0x04, 0x3a, 0xfb, 0xc6, 0x04, 0x3a, 0xfd, 0x75, 0xda, 0x01,
-    0xb1, 0xfb, 0xc6, 0x01, 0xd8, 0x89, 0xfd, 0x9f, 0x00, 0x03, 0x00, 0x20, 0x00, 0x00, 0x04, 0x36,
-    0x05, 0xb0, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x1b, 0x40, 0x0d, 0x02, 0x0a, 0x00, 0x07,
-    0x06, 0x06, 0x0a, 0x0b, 0x02, 0x72, 0x0a, 0x08, 0x72, 0x00, 0x2b, 0x2b, 0x11, 0x33, 0x11, 0x33,
-    0x32, 0x11, 0x33, 0x30, 0x31, 0x41, 0x15, 0x05, 0x35, 0x01, 0x15, 0x21, 0x35, 0x13, 0x11, 0x23,
-    0x11, 0x02, 0x8e, 0xfd, 0x92, 0x04, 0x16, 0xfd, 0x25, 0x45, 0xfa, 0x03, 0xae, 0x90, 0xbb, 0x90,
-    0xfd, 0xd4, 0xc7, 0xc7, 0x04, 0xe9, 0xfa, 0x50, 0x05, 0xb0, 0x00, 0x02, 0x00, 0x20, 0x00, 0x00,
-    0x02, 0x32, 0x06, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x13, 0x40, 0x09, 0x02, 0x06, 0x00, 0x07,
-    0x00, 0x72, 0x06, 0x0a, 0x72, 0x00, 0x2b, 0x2b, 0x32, 0x11, 0x33, 0x30, 0x31, 0x41, 0x15, 0x05,
-    0x35, 0x01, 0x11, 0x23, 0x11, 0x02, 0x32, 0xfd, 0xee, 0x01, 0x7c, 0xf1, 0x03, 0xb0, 0x90, 0xbb,
-    0x90, 0x03, 0x0b, 0xfa, 0x00, 0x06, 0x00, 0x00, 0x00, 0x03, 0x00, 0x90, 0xfe, 0x4b, 0x05, 0x0c,
-    0x05, 0xb0, 0x00, 0x03, 0x00, 0x07, 0x00, 0x19, 0x00, 0x1d, 0x40, 0x0e, 0x15, 0x0e, 0x06, 0x07,
-    0x07, 0x03, 0x08, 0x72, 0x09, 0x05, 0x04, 0x00, 0x02, 0x72, 0x00, 0x2b, 0x32, 0x32, 0x32, 0x2b,
-    0x32, 0x11, 0x33, 0x2f, 0x33, 0x30, 0x31, 0x53, 0x33, 0x11, 0x23, 0x13, 0x37, 0x01, 0x07, 0x11,
-    0x33, 0x11, 0x14, 0x06, 0x06, 0x23, 0x22, 0x26, 0x27, 0x37, 0x16, 0x16, 0x33, 0x32, 0x36, 0x36,
-    0x35, 0x90, 0xfb, 0xfb, 0x4b, 0xb0, 0x03, 0x37, 0xb1, 0xfb, 0x57, 0xa1, 0x71, 0x23, 0x3e, 0x24,
-    0x0e, 0x15, 0x37, 0x17, 0x2a, 0x3a, 0x1e, 0x05, 0xb0, 0xfa, 0x50, 0x05, 0x3b, 0x75, 0xfa, 0xc5,
-    0x75, 0x05, 0xb0, 0xfa, 0x18, 0x7b, 0xaa, 0x58, 0x07, 0x0a, 0xc3, 0x06, 0x06, 0x2a, 0x51, 0x3a,
-    0x00, 0x02, 0x00, 0x7d, 0xfe, 0x4b, 0x04, 0x06, 0x04, 0x4e, 0x00, 0x04, 0x00, 0x2a, 0x00, 0x19,
-    0x40, 0x0e, 0x1c, 0x15, 0x0f, 0x72, 0x26, 0x0b, 0x07, 0x72, 0x03, 0x06, 0x72, 0x02, 0x0a, 0x72,
-    0x00, 0x2b, 0x2b, 0x2b, 0x32, 0x2b, 0x32, 0x30, 0x31, 0x41, 0x11, 0x23, 0x11, 0x33, 0x03, 0x07,
-    0x34, 0x3e, 0x02, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x11, 0x14, 0x06, 0x06, 0x23, 0x22, 0x26, 0x27,
-    0x37, 0x16, 0x16, 0x33, 0x32, 0x36, 0x36, 0x35, 0x11, 0x34, 0x2e, 0x02, 0x23, 0x22, 0x0e, 0x02,
-    0x01, 0x6e, 0xf1, 0xde, 0x27, 0x29, 0x39, 0x6a, 0x96, 0x5e, 0x51, 0x83, 0x5d, 0x33, 0x56, 0x9e,
-    0x6f, 0x23, 0x3e, 0x22, 0x0e, 0x13, 0x3b, 0x16, 0x2a, 0x39, 0x1f, 0x1a, 0x33, 0x49, 0x2f, 0x49,
-    0x6b, 0x45, 0x22, 0x03, 0x53, 0xfc, 0xad, 0x04, 0x3a, 0xfe, 0x07, 0x02, 0x72, 0xc1, 0x8e, 0x4e,
-    0x30, 0x67, 0xa5, 0x73, 0xfd, 0x23, 0x79, 0xa8, 0x56, 0x07, 0x0a, 0xc1, 0x06, 0x06, 0x28, 0x4f,
-    0x3a, 0x02, 0xdb, 0x43, 0x5d, 0x36, 0x19, 0x34, 0x5a, 0x78, 0x00, 0x05, 0x00, 0x65, 0xff, 0xeb,
-    0x07, 0x34, 0x05, 0xc5, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2b, 0x00, 0x2f, 0x00, 0x33, 0x00, 0x33,
-    0x40, 0x1a, 0x2f, 0x2e, 0x2e, 0x26, 0x32, 0x28, 0x33, 0x02, 0x72, 0x29, 0x27, 0x26, 0x08, 0x72,
-    0x15, 0x12, 0x12, 0x16, 0x19, 0x09, 0x04, 0x07, 0x07, 0x03, 0x00, 0x03, 0x00, 0x3f, 0x32, 0x32,
-    0x11, 0x33, 0x3f, 0x33, 0x33, 0x11, 0x33, 0x2b, 0x32, 0x32, 0x2b, 0x32, 0x32, 0x11, 0x39, 0x2f,
-    0x33, 0x30, 0x31, 0x41, 0x32, 0x16, 0x17, 0x15, 0x26, 0x26, 0x23, 0x22, 0x0e, 0x02, 0x15, 0x11,
-    0x14, 0x1e, 0x02, 0x33, 0x32, 0x36, 0x37, 0x15, 0x06, 0x06, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x11,
-    0x34, 0x3e, 0x02, 0x01, 0x15, 0x21, 0x35, 0x13, 0x11, 0x23, 0x11, 0x01, 0x15, 0x21, 0x35, 0x01,
-    0x15, 0x21, 0x35, 0x02, 0xaa, 0x4d, 0x95, 0x43, 0x42, 0x94, 0x4f, 0x4e, 0x7e, 0x5a, 0x2f, 0x30,
-    0x5a, 0x7f, 0x4e, 0x4e, 0x94, 0x41, 0x43, 0x93, 0x4d, 0x82, 0xd6, 0x9b, 0x54, 0x53, 0x9b, 0xd5,
-    0x05, 0x0c, 0xfc, 0xfb, 0x47, 0xfb, 0x03, 0x54, 0xfd, 0x60, 0x03, 0x00, 0xfd, 0x00, 0x05, 0xc5,
-    0x0d, 0x08, 0xc6, 0x0c, 0x0f, 0x33, 0x66, 0x96, 0x64, 0xfe, 0xce, 0x64, 0x97, 0x66, 0x34, 0x0f,
-    0x0c, 0xc6, 0x07, 0x0e, 0x57, 0x9f, 0xdb, 0x84, 0x01, 0x30, 0x84, 0xdb, 0x9f, 0x57, 0xfb, 0x02,
-    0xc7, 0xc7, 0x04, 0xe9, 0xfa, 0x50, 0x05, 0xb0, 0xfd, 0xa0, 0xc4, 0xc4, 0x02, 0x60, 0xc8, 0xc8,
-    0x00, 0x03, 0x00, 0x59, 0xff, 0xeb, 0x06, 0xf6, 0x04, 0x4f, 0x00, 0x2a, 0x00, 0x40, 0x00, 0x56,
-    0x00, 0x27, 0x40, 0x13, 0x24, 0x00, 0x00, 0x47, 0x3c, 0x13, 0x12, 0x12, 0x3c, 0x52, 0x19, 0x0b,
-    0x0b, 0x31, 0x07, 0x72, 0x3c, 0x0b, 0x72, 0x00, 0x2b, 0x2b, 0x32, 0x11, 0x33, 0x32, 0x11, 0x39,
-    0x2f, 0x33, 0x11, 0x33, 0x33, 0x11, 0x33, 0x30, 0x31, 0x45, 0x22, 0x2e, 0x02, 0x35, 0x35, 0x34,
-    0x3e, 0x02, 0x17, 0x32, 0x1e, 0x02, 0x15, 0x15, 0x21, 0x35, 0x21, 0x35, 0x34, 0x26, 0x26, 0x23,
-    0x22, 0x0e, 0x02, 0x15, 0x15, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x36, 0x37, 0x17, 0x06, 0x06, 0x01,
-    0x35, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e,
-    0x02, 0x37, 0x15, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x3e, 0x02, 0x35, 0x35, 0x34, 0x2e, 0x02, 0x23,
-    0x22, 0x0e, 0x02, 0x05, 0x4d, 0x74, 0xb9, 0x83, 0x47, 0x47, 0x80, 0xae, 0x67, 0x70, 0xa9, 0x71,
-    0x3a, 0xfc, 0xd5, 0x02, 0x3d, 0x2d, 0x5e, 0x4b, 0x38, 0x58, 0x3c, 0x1e, 0x22, 0x46, 0x68, 0x46,
-    0x6d, 0x8c, 0x38, 0x4c, 0x37, 0xc7, 0xfa, 0x7c, 0x43, 0x80, 0xb8, 0x76, 0x78, 0xb9, 0x80, 0x42,
-    0x42, 0x7f, 0xb9, 0x77, 0x77, 0xb9, 0x80, 0x43, 0xf2, 0x1d, 0x3e, 0x61, 0x45, 0x44, 0x61, 0x3e,
-    0x1d, 0x1d, 0x3e, 0x62, 0x45, 0x44, 0x61, 0x3d, 0x1d, 0x15, 0x51, 0x90, 0xc3, 0x73, 0x2a, 0x77,
-    0xc7, 0x94, 0x51, 0x01, 0x46, 0x81, 0xb1, 0x6d, 0x8e, 0xad, 0x1a, 0x42, 0x6b, 0x3f, 0x37, 0x62,
-    0x80, 0x49, 0x2a, 0x46, 0x7c, 0x5f, 0x36, 0x36, 0x27, 0x9b, 0x30, 0x52, 0x02, 0x26, 0x17, 0x75,
-    0xc9, 0x95, 0x53, 0x53, 0x95, 0xc9, 0x75, 0x17, 0x75, 0xc9, 0x95, 0x53, 0x53, 0x95, 0xc9, 0x8c,
-    0x17, 0x49, 0x82, 0x63, 0x38, 0x38, 0x63, 0x82, 0x49, 0x17, 0x48, 0x81, 0x64, 0x39, 0x39, 0x64,
-    0x81, 0x00, 0x00, 0x01, 0x00, 0x89, 0x00, 0x00, 0x02, 0x94, 0x06, 0x15, 0x00, 0x11, 0x00, 0x0e,
-    0xb6, 0x0d, 0x06, 0x01, 0x72, 0x01, 0x0a, 0x72, 0x00, 0x2b, 0x2b, 0x32, 0x30, 0x31, 0x61, 0x23,
-    0x11, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x17, 0x07, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x15,
-    0x01, 0x7a, 0xf1, 0x59, 0xa6, 0x73, 0x28, 0x4a, 0x27, 0x18, 0x13, 0x2d, 0x1f, 0x35, 0x48, 0x26,
-    0x04, 0xa2, 0x79, 0xa5, 0x55, 0x0c, 0x09, 0xb5, 0x05, 0x05, 0x2a, 0x50, 0x39, 0x00, 0x00, 0x01,
-    0x00, 0x55, 0xff, 0xec, 0x05, 0x23, 0x05, 0xc4, 0x00, 0x2c, 0x00, 0x1b, 0x40, 0x0d, 0x0f, 0x00,
-    0x06, 0x09, 0x09, 0x00, 0x1a, 0x22, 0x03, 0x72, 0x00, 0x09, 0x72, 0x00, 0x2b, 0x2b, 0x32, 0x11,
-    0x39, 0x2f, 0x33, 0x11, 0x33, 0x30, 0x31, 0x45, 0x22, 0x2e, 0x02, 0x35, 0x35, 0x21, 0x15, 0x21,
-    0x15, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x3e, 0x02, 0x35, 0x35, 0x34, 0x2e, 0x02, 0x23, 0x22, 0x06,
-    0x07, 0x27, 0x3e, 0x02, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x15, 0x14, 0x0e, 0x02, 0x02, 0xbd, 0x97,
-    0xe7, 0x9b, 0x4f, 0x04, 0x20, 0xfc, 0xda, 0x27, 0x56, 0x8c, 0x65, 0x58, 0x88, 0x5d, 0x2f, 0x30,
-    0x66, 0xa5, 0x77, 0x84, 0xbc, 0x3b, 0x30, 0x18, 0x79, 0xb4, 0x6f, 0xa4, 0xfc, 0xab, 0x58, 0x5f,
-    0xa7, 0xdf, 0x14, 0x5d, 0xb1, 0xf9, 0x9a, 0x8f, 0xc3, 0x21, 0x4f, 0x8a, 0x67, 0x3b, 0x4a, 0x83,
-    0xad, 0x62, 0x7b, 0x63, 0xad, 0x83, 0x4b, 0x32, 0x18, 0xc2, 0x0d, 0x2c, 0x21, 0x65, 0xb7, 0xfd,
-    0x97, 0x7b, 0x97, 0xfc, 0xb7, 0x63, 0x00, 0x01, 0xff, 0xde, 0xfe, 0x4b, 0x02, 0xd4, 0x06, 0x15,
-    0x00, 0x27, 0x00, 0x29, 0x40, 0x15, 0x14, 0x02, 0x02, 0x15, 0x27, 0x06, 0x72, 0x1f, 0x22, 0x22,
-    0x1e, 0x1b, 0x01, 0x72, 0x0b, 0x0e, 0x0e, 0x0a, 0x07, 0x0f, 0x72, 0x00, 0x2b, 0x32, 0x32, 0x11,
-    0x33, 0x2b, 0x32, 0x32, 0x11, 0x33, 0x2b, 0x32, 0x32, 0x11, 0x33, 0x30, 0x31, 0x41, 0x15, 0x23,
-    0x11, 0x14, 0x06, 0x06, 0x23, 0x22, 0x26, 0x27, 0x37, 0x16, 0x16, 0x33, 0x32, 0x36, 0x36, 0x35,
-    0x11, 0x23, 0x35, 0x33, 0x35, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x17, 0x07, 0x26, 0x26, 0x23,
-    0x22, 0x06, 0x06, 0x15, 0x15, 0x02, 0x89, 0xcf, 0x53, 0x9b, 0x6c, 0x24, 0x3c, 0x22, 0x0f, 0x0f,
-    0x3f, 0x10, 0x2b, 0x38, 0x1b, 0xa6, 0xa6, 0x59, 0xa6, 0x74, 0x27, 0x4b, 0x26, 0x17, 0x14, 0x31,
-    0x1f, 0x34, 0x47, 0x24, 0x04, 0x3a, 0xb0, 0xfc, 0x31, 0x77, 0xa4, 0x55, 0x07, 0x0a, 0xbb, 0x05,
-    0x07, 0x29, 0x4f, 0x38, 0x03, 0xcf, 0xb0, 0x68, 0x79, 0xa5, 0x55, 0x0c, 0x09, 0xb8, 0x05, 0x05,
-    0x28, 0x4f, 0x39, 0x68, 0x00, 0x03, 0x00, 0x5b, 0xff, 0xec, 0x05, 0xaf, 0x06, 0x2b, 0x00, 0x09,
-    0x00, 0x21, 0x00, 0x39, 0x00, 0x1d, 0x40, 0x0e, 0x05, 0x06, 0x06, 0x29, 0x29, 0x00, 0x00, 0x1c,
-    0x03, 0x72, 0x35, 0x10, 0x09, 0x72, 0x00, 0x2b, 0x32, 0x2b, 0x32, 0x2f, 0x32, 0x11, 0x39, 0x11,
-    0x33, 0x30, 0x31, 0x41, 0x33, 0x14, 0x06, 0x06, 0x23, 0x35, 0x32, 0x36, 0x36, 0x13, 0x15, 0x14,
-    0x02, 0x06, 0x06, 0x23, 0x22, 0x2e, 0x03, 0x35, 0x35, 0x34, 0x12, 0x36, 0x36, 0x33, 0x32, 0x1e,
-    0x03, 0x07, 0x35, 0x34, 0x2e, 0x03, 0x23, 0x22, 0x0e, 0x02, 0x15, 0x15, 0x14, 0x1e, 0x03, 0x33,
-    0x32, 0x3e, 0x02, 0x04, 0xfa, 0xb5, 0x51, 0xa7, 0x80, 0x4b, 0x55, 0x23, 0x1a, 0x56, 0xa0, 0xde,
-    0x87, 0x6a, 0xba, 0x96, 0x6b, 0x39, 0x58, 0xa1, 0xde, 0x85, 0x6c, 0xbb, 0x94, 0x6a, 0x38, 0xfc,
-    0x1e, 0x3b, 0x56, 0x6f, 0x43, 0x52, 0x82, 0x5c, 0x30, 0x1f, 0x3c, 0x57, 0x6f, 0x41, 0x54, 0x83,
-    0x5a, 0x2e, 0x06, 0x2b, 0x87, 0xbe, 0x63, 0x91, 0x43, 0x7d, 0xfd, 0x2c, 0x50, 0xa5, 0xfe, 0xfa,
-    0xb8, 0x61, 0x3f, 0x77, 0xad, 0xdd, 0x84, 0x50, 0xa5, 0x01, 0x05, 0xb9, 0x61, 0x3f, 0x78, 0xac,
-    0xdd, 0xd4, 0x52, 0x61, 0x9f, 0x79, 0x52, 0x2a, 0x41, 0x7f, 0xbb, 0x7a, 0x52, 0x62, 0x9f, 0x7a,
-    0x53, 0x2a, 0x41, 0x81, 0xbc, 0x00, 0x00, 0x03, 0x00, 0x4d, 0xff, 0xec, 0x04, 0xb7, 0x04, 0xa8,
-    0x00, 0x09, 0x00, 0x1f, 0x00, 0x35, 0x00, 0x15, 0x40, 0x0a, 0x26, 0x1b, 0x0b, 0x72, 0x31, 0x00,
-    0x00, 0x10, 0x07, 0x72, 0x00, 0x2b, 0x32, 0x2f, 0x32, 0x2b, 0x32, 0x30, 0x31, 0x41, 0x33, 0x14,
-    0x06, 0x06, 0x23, 0x35, 0x32, 0x36, 0x36, 0x01, 0x35, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x1e, 0x02,
-    0x15, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x37, 0x15, 0x14, 0x1e, 0x02, 0x33, 0x32,
-    0x3e, 0x02, 0x35, 0x35, 0x34, 0x2e, 0x02, 0x23, 0x22, 0x0e, 0x02, 0x04, 0x16, 0xa1, 0x43, 0x95,
-    0x7b, 0x4b, 0x4c, 0x1b, 0xfc, 0x37, 0x44, 0x81, 0xbb, 0x76, 0x77, 0xbc, 0x81, 0x44, 0x44, 0x81,
-    0xba, 0x77, 0x77, 0xbb, 0x82, 0x44, 0xf1, 0x1e, 0x41, 0x63, 0x45, 0x44, 0x62, 0x3f, 0x20, 0x1f,
-    0x40, 0x63, 0x45, 0x44, 0x62, 0x41, 0x1e, 0x04, 0xa8, 0x73, 0xa6, 0x58, 0x77, 0x3e, 0x70, 0xfd,
-    0xb5, 0x17, 0x75, 0xc9, 0x95, 0x53, 0x53, 0x95, 0xc9, 0x75, 0x17, 0x75, 0xc8, 0x95, 0x53, 0x53,
-    0x95, 0xc8, 0x8c, 0x17, 0x49, 0x82, 0x62, 0x38, 0x38, 0x62, 0x82, 0x49, 0x17, 0x48, 0x81, 0x64,
-    0x39, 0x39, 0x64, 0x81, 0x00, 0x02, 0x00, 0x80, 0xff, 0xec, 0x06, 0x3a, 0x06, 0x02, 0x00, 0x09,
-    0x00, 0x1f, 0x00, 0x19, 0x40, 0x0c, 0x05, 0x0a, 0x0a, 0x00, 0x00, 0x15, 0x02, 0x72, 0x1b, 0x10,
-    0x09, 0x72, 0x00, 0x2b, 0x32, 0x2b, 0x32, 0x2f, 0x32, 0x11, 0x33, 0x30, 0x31, 0x41, 0x33, 0x14,
-    0x06, 0x06, 0x23, 0x35, 0x32, 0x36, 0x36, 0x25, 0x33, 0x11, 0x14, 0x06, 0x06, 0x23, 0x22, 0x26,
-    0x26, 0x35, 0x11, 0x33, 0x11, 0x14, 0x16, 0x16, 0x33, 0x32, 0x36, 0x36, 0x35, 0x05, 0x8b, 0xaf,
-    0x4f, 0xb8, 0x9e, 0x69, 0x6a, 0x23, 0xfe, 0x3a, 0xfa, 0x90, 0xf7, 0x98, 0x9d, 0xf6, 0x8d, 0xfa,
-    0x48, 0x84, 0x5a, 0x5a, 0x83, 0x48, 0x06, 0x02, 0x91, 0xc8, 0x68, 0x92, 0x46, 0x88, 0x0f, 0xfc,
-    0x33, 0xa6, 0xe0, 0x71, 0x71, 0xe0, 0xa6, 0x03, 0xcd, 0xfc, 0x33, 0x69, 0x87, 0x40, 0x40, 0x87,
-    0x69, 0x00, 0x00, 0x03, 0x00, 0x77, 0xff, 0xec, 0x05, 0x24, 0x04, 0x95, 0x00, 0x09, 0x00, 0x0e,
-    0x00, 0x25, 0x00, 0x1d, 0x40, 0x0e, 0x05, 0x0b, 0x0b, 0x00, 0x00, 0x1b, 0x06, 0x72, 0x22, 0x0e,
-    0x0e, 0x15, 0x0b, 0x72, 0x00, 0x2b, 0x32, 0x2f, 0x32, 0x2b, 0x32, 0x2f, 0x32, 0x11, 0x33, 0x30,
-    0x31, 0x41, 0x33, 0x14, 0x06, 0x06, 0x23, 0x37, 0x32, 0x36, 0x36, 0x01, 0x11, 0x33, 0x11, 0x23,
-    0x13, 0x37, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x11, 0x33, 0x11, 0x14, 0x1e, 0x02,
-    0x33, 0x32, 0x36, 0x36, 0x04, 0x86, 0x9e, 0x41, 0x9d, 0x8b, 0x01, 0x5e, 0x55, 0x17, 0xfe, 0x81,
-    0xf2, 0xe4, 0x14, 0x51, 0x30, 0x64, 0x9c, 0x6d, 0x4f, 0x84, 0x5f, 0x34, 0xf1, 0x1c, 0x30, 0x40,
-    0x24, 0x67, 0x77, 0x33, 0x04, 0x95, 0x74, 0x9e, 0x50, 0x7d, 0x31, 0x65, 0xfc, 0xb9, 0x03, 0x3b,
-    0xfb, 0xc6, 0x01, 0xe0, 0x02, 0x6d, 0xb7, 0x87, 0x4b, 0x2e, 0x60, 0x9a, 0x6b, 0x02, 0xbb, 0xfd,
-    0x43, 0x3b, 0x4f, 0x30, 0x14, 0x51, 0x8a, 0x00, 0x00, 0x01, 0xff, 0xae, 0xfe, 0x4b, 0x01, 0x92,
-    0x04, 0x3a, 0x00, 0x11, 0x00, 0x0e, 0xb6, 0x0d, 0x06, 0x0f, 0x72, 0x01, 0x06, 0x72, 0x00, 0x2b,
-    0x2b, 0x32, 0x30, 0x31, 0x53, 0x33, 0x11, 0x14, 0x06, 0x06, 0x23, 0x22, 0x26, 0x27, 0x37, 0x16,
-    0x16, 0x33, 0x32, 0x36, 0x36, 0x35, 0xa1, 0xf1, 0x55, 0x9f, 0x6e, 0x24, 0x3c, 0x22, 0x0e, 0x13,
-    0x3a, 0x15, 0x2a, 0x3a, 0x1f, 0x04, 0x3a, 0xfb, 0x88, 0x79, 0xa8, 0x56, 0x07, 0x0a, 0xbb, 0x06,
-    0x06, 0x2b, 0x52, 0x3a, 0x00, 0x01, 0x00, 0x57, 0xff, 0xec, 0x03, 0xf6, 0x04, 0x50, 0x00, 0x2a,
-    0x00, 0x19, 0x40, 0x0c, 0x11, 0x14, 0x14, 0x00, 0x19, 0x0b, 0x0b, 0x72, 0x24, 0x00, 0x07, 0x72,
-    0x00, 0x2b, 0x32, 0x2b, 0x32, 0x12, 0x39, 0x2f, 0x33, 0x30, 0x31, 0x41, 0x32, 0x1e, 0x02, 0x15,
-    0x15, 0x14, 0x0e, 0x02, 0x27, 0x22, 0x2e, 0x02, 0x35, 0x35, 0x21, 0x15, 0x21, 0x15, 0x14, 0x16,
-    0x16, 0x33, 0x32, 0x3e, 0x02, 0x35, 0x35, 0x34, 0x2e, 0x02, 0x23, 0x22, 0x06, 0x07, 0x27, 0x36,
-    0x36, 0x02, 0x00, 0x74, 0xb9, 0x83, 0x46, 0x46, 0x80, 0xae, 0x67, 0x70, 0xa9, 0x71, 0x3a, 0x03,
-    0x2b, 0xfd, 0xc3, 0x2d, 0x5f, 0x4a, 0x38, 0x57, 0x3c, 0x1f, 0x23, 0x45, 0x68, 0x46, 0x6c, 0x8c,
-    0x39, 0x4c, 0x38, 0xc7, 0x04, 0x50, 0x51, 0x90, 0xc3, 0x73, 0x2a, 0x76, 0xc8, 0x94, 0x51, 0x01,
-    0x46, 0x81, 0xb1, 0x6d, 0x8e, 0xae, 0x19, 0x41, 0x6c, 0x40, 0x38, 0x61, 0x81, 0x49, 0x2a, 0x46,
-    0x7c, 0x5f, 0x36, 0x36, 0x27, 0x9b, 0x30, 0x52, 0x00, 0x01, 0x00, 0x90, 0x04, 0xe1, 0x03, 0x44,
-    0x06, 0x00, 0x00, 0x08, 0x00, 0x14, 0xb7, 0x07, 0x05, 0x05, 0x04, 0x01, 0x03, 0x80, 0x08, 0x00,
-    0x2f, 0x1a, 0xcd, 0x32, 0x39, 0x32, 0x11, 0x33, 0x30, 0x31, 0x41, 0x01, 0x15, 0x23, 0x27, 0x07,
-    0x23, 0x35, 0x01, 0x02, 0x2f, 0x01, 0x15, 0xc3, 0x99, 0x99, 0xbf, 0x01, 0x11, 0x06, 0x00, 0xfe,
-    0xec, 0x0b, 0x9d, 0x9d, 0x0d, 0x01, 0x12, 0x00, 0x00, 0x01, 0x00, 0x6e, 0x04, 0xe0, 0x03, 0x35,
-    0x06, 0x00, 0x00, 0x08, 0x00, 0x12, 0xb6, 0x01, 0x06, 0x80, 0x07, 0x04, 0x02, 0x00, 0x00, 0x2f,
-    0x32, 0x32, 0x32, 0x1a, 0xcd, 0x39, 0x30, 0x31, 0x41, 0x17, 0x37, 0x33, 0x15, 0x01, 0x23, 0x01,
-    0x35, 0x01, 0x3b, 0x96, 0x95, 0xcf, 0xfe, 0xe8, 0x98, 0xfe, 0xe9, 0x06, 0x00, 0x9d, 0x9d, 0x0b,
-    0xfe, 0xeb, 0x01, 0x16, 0x0a, 0x00, 0xff, 0xff, 0x00, 0x9d, 0x05, 0x10, 0x03, 0x44, 0x05, 0xaa,
-    0x06, 0x06, 0x00, 0x70, 0x00, 0x00, 0x00, 0x01, 0x00, 0x75, 0x04, 0xcd, 0x02, 0xff, 0x05, 0xe7,
-    0x00, 0x0e, 0x00, 0x10, 0xb5, 0x01, 0x01, 0x09, 0x80, 0x0c, 0x05, 0x00, 0x2f, 0x33, 0x1a, 0xcc,
-    0x32, 0x2f, 0x30, 0x31, 0x41, 0x33, 0x14, 0x06, 0x06, 0x23, 0x22, 0x26, 0x35, 0x33, 0x14, 0x16,
-    0x33, 0x32, 0x36, 0x02, 0x4c, 0xb3, 0x4f, 0x91, 0x64, 0x97, 0xaf, 0xb3, 0x43, 0x50, 0x4f, 0x42,
-    0x05, 0xe7, 0x53, 0x7f, 0x48, 0x9d, 0x7d, 0x38, 0x55, 0x55, 0x00, 0x01, 0x00, 0x81, 0x04, 0xe4,
-    0x01, 0x86, 0x05, 0xd5, 0x00, 0x0b, 0x00, 0x09, 0xb2, 0x03, 0x09, 0x10, 0x00, 0x3f, 0x33, 0x30,
-    0x31, 0x53, 0x34, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14, 0x06, 0x23, 0x22, 0x26, 0x81, 0x45, 0x3d,
-    0x3d, 0x46, 0x46, 0x3d, 0x3d, 0x45, 0x05, 0x5c, 0x33, 0x46, 0x46, 0x33, 0x34, 0x44, 0x44, 0x00,
-    0x00, 0x02, 0x00, 0x78, 0x04, 0x8d, 0x02, 0x2d, 0x06, 0x25, 0x00, 0x0d, 0x00, 0x19, 0x00, 0x0e,
-    0xb4, 0x17, 0x04, 0x80, 0x11, 0x0b, 0x00, 0x2f, 0x33, 0x1a, 0xcc, 0x32, 0x30, 0x31, 0x53, 0x34,
-    0x36, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14, 0x06, 0x06, 0x23, 0x22, 0x26, 0x37, 0x14, 0x16, 0x33,
-    0x32, 0x36, 0x35, 0x34, 0x26, 0x23, 0x22, 0x06, 0x78, 0x3a, 0x62, 0x3f, 0x5d, 0x7d, 0x39, 0x63,
-    0x3e, 0x5e, 0x7d, 0x6b, 0x3e, 0x32, 0x32, 0x3d, 0x3d, 0x32, 0x32, 0x3e, 0x05, 0x57, 0x39, 0x5d,
-    0x38, 0x79, 0x55, 0x39, 0x5c, 0x35, 0x74, 0x56, 0x2c, 0x43, 0x42, 0x2d, 0x2e, 0x43, 0x43, 0x00,
-    0x00, 0x01, 0x00, 0x29, 0xfe, 0x54, 0x01, 0x9f, 0x00, 0x3a, 0x00, 0x15, 0x00, 0x0e, 0xb4, 0x08,
-    0x0f, 0x80, 0x01, 0x00, 0x00, 0x2f, 0x32, 0x1a, 0xcc, 0x32, 0x30, 0x31, 0x65, 0x17, 0x0e, 0x02,
-    0x15, 0x14, 0x16, 0x33, 0x32, 0x36, 0x37, 0x17, 0x06, 0x06, 0x23, 0x22, 0x26, 0x35, 0x34, 0x36,
-    0x36, 0x01, 0x16, 0x73, 0x2e, 0x4a, 0x29, 0x20, 0x27, 0x1e, 0x2c, 0x0f, 0x17, 0x19, 0x4e, 0x3c,
-    0x58, 0x7b, 0x2e, 0x68, 0x3a, 0x3a, 0x1e, 0x3d, 0x45, 0x28, 0x1e, 0x27, 0x11, 0x07, 0x8b, 0x0f,
-    0x1d, 0x66, 0x62, 0x34, 0x65, 0x5d, 0x00, 0x01, 0x00, 0x77, 0x04, 0xde, 0x03, 0x53, 0x05, 0xf3,
-    0x00, 0x19, 0x00, 0x27, 0x40, 0x13, 0x00, 0x00, 0x01, 0x01, 0x0a, 0x12, 0x40, 0x0f, 0x1a, 0x48,
-    0x12, 0x05, 0x80, 0x0d, 0x0d, 0x0e, 0x0e, 0x17, 0x05, 0x00, 0x2f, 0x33, 0x33, 0x2f, 0x33, 0x2f,
-    0x1a, 0x10, 0xcd, 0x2b, 0x32, 0x32, 0x2f, 0x33, 0x2f, 0x30, 0x31, 0x41, 0x17, 0x14, 0x06, 0x06,
-    0x23, 0x22, 0x2e, 0x02, 0x23, 0x22, 0x06, 0x15, 0x27, 0x34, 0x36, 0x36, 0x33, 0x32, 0x1e, 0x02,
-    0x33, 0x32, 0x36, 0x02, 0xc0, 0x93, 0x3a, 0x64, 0x3f, 0x31, 0x44, 0x38, 0x3b, 0x28, 0x26, 0x35,
-    0x94, 0x3a, 0x64, 0x3f, 0x29, 0x43, 0x3d, 0x40, 0x27, 0x26, 0x36, 0x05, 0xf3, 0x0b, 0x49, 0x73,
-    0x42, 0x1c, 0x24, 0x1b, 0x38, 0x2f, 0x08, 0x48, 0x74, 0x44, 0x1b, 0x24, 0x1c, 0x3a, 0x00, 0x02,
-    0x00, 0x4b, 0x04, 0xd1, 0x03, 0x58, 0x05, 0xff, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0e, 0xb4, 0x01,
-    0x05, 0x80, 0x00, 0x04, 0x00, 0x2f, 0x33, 0x1a, 0xcd, 0x32, 0x30, 0x31, 0x41, 0x13, 0x33, 0x01,
-    0x21, 0x13, 0x33, 0x03, 0x01, 0x8b, 0xe4, 0xe9, 0xfe, 0xf5, 0xfd, 0xfe, 0xb4, 0xe4, 0xe1, 0x04,
-    0xd1, 0x01, 0x2e, 0xfe, 0xd2, 0x01, 0x2e, 0xfe, 0xd2, 0x00, 0x00, 0x02, 0x00, 0x89, 0xfe, 0x6e,
-    0x01, 0xf0, 0xff, 0xbd, 0x00, 0x0b, 0x00, 0x17, 0x00, 0x0e, 0xb4, 0x0f, 0x09, 0x80, 0x15, 0x03,
-    0x00, 0x2f, 0x33, 0x1a, 0xcc, 0x32, 0x30, 0x31, 0x57, 0x34, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14,
-    0x06, 0x23, 0x22, 0x26, 0x37, 0x14, 0x16, 0x33, 0x32, 0x36, 0x35, 0x34, 0x26, 0x23, 0x22, 0x06,
-    0x89, 0x6b, 0x4b, 0x49, 0x68, 0x68, 0x49, 0x4b, 0x6b, 0x65, 0x2f, 0x22, 0x20, 0x2c, 0x2c, 0x20,
-    0x22, 0x2f, 0xec, 0x49, 0x60, 0x60, 0x49, 0x4a, 0x5c, 0x5d, 0x49, 0x21, 0x2e, 0x2d, 0x22, 0x23,
-    0x2e, 0x2e, 0x00, 0x01, 0xfc, 0x93, 0x04, 0xd3, 0xfe, 0x67, 0x06, 0x00, 0x00, 0x03, 0x00, 0x0a,
-    0xb2, 0x03, 0x80, 0x02, 0x00, 0x2f, 0x1a, 0xcd, 0x30, 0x31, 0x41, 0x13, 0x23, 0x01, 0xfd, 0xa3,
-    0xc4, 0xc9, 0xfe, 0xf5, 0x06, 0x00, 0xfe, 0xd3, 0x01, 0x2d, 0x00, 0x01, 0xfd, 0x62, 0x04, 0xd3,
-    0xff, 0x35, 0x06, 0x00, 0x00, 0x03, 0x00, 0x0a, 0xb2, 0x01, 0x80, 0x00, 0x00, 0x2f, 0x1a, 0xcd,
-    0x30, 0x31, 0x41, 0x13, 0x21, 0x01, 0xfd, 0x62, 0xc3, 0x01, 0x10, 0xfe, 0xf0, 0x04, 0xd3, 0x01,
-    0x2d, 0xfe, 0xd3, 0x00, 0xff, 0xff, 0xfc, 0x74, 0x04, 0xde, 0xff, 0x50, 0x05, 0xf3, 0x04, 0x07,
-    0x00, 0xa5, 0xfb, 0xfd, 0x00, 0x00, 0x00, 0x01, 0xfd, 0x3a, 0x04, 0xe6, 0xfe, 0x9b, 0x06, 0x7d,
-    0x00, 0x14, 0x00, 0x10, 0xb5, 0x14, 0x02, 0x00, 0x80, 0x0b, 0x0c, 0x00, 0x2f, 0x33, 0x1a, 0xcc,
-    0x32, 0x32, 0x30, 0x31, 0x41, 0x23, 0x27, 0x3e, 0x02, 0x35, 0x34, 0x2e, 0x02, 0x23, 0x37, 0x32,
-    0x1e, 0x02, 0x15, 0x14, 0x06, 0x07, 0xfe, 0x02, 0xb3, 0x09, 0x33, 0x3e, 0x1d, 0x17, 0x2a, 0x38,
-    0x21, 0x07, 0x55, 0x81, 0x57, 0x2d, 0x60, 0x39, 0x04, 0xe6, 0x8f, 0x03, 0x0f, 0x1d, 0x18, 0x14,
-    0x1c, 0x11, 0x07, 0x79, 0x1b, 0x32, 0x46, 0x2c, 0x48, 0x44, 0x08, 0x00, 0x00, 0x02, 0xfc, 0x08,
-    0x04, 0xe4, 0xff, 0x30, 0x05, 0xee, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0e, 0xb4, 0x07, 0x03, 0x80,
-    0x04, 0x00, 0x00, 0x2f, 0x32, 0x1a, 0xcd, 0x32, 0x30, 0x31, 0x41, 0x23, 0x01, 0x21, 0x01, 0x23,
-    0x03, 0x33, 0xfe, 0x00, 0xcf, 0xfe, 0xd7, 0x01, 0x00, 0x02, 0x28, 0xc3, 0xf6, 0xf6, 0x04, 0xe4,
-    0x01, 0x0a, 0xfe, 0xf6, 0x01, 0x0a, 0x00, 0x01, 0xfd, 0x1e, 0xfe, 0x97, 0xfe, 0x31, 0xff, 0x8a,
-    0x00, 0x0b, 0x00, 0x08, 0xb1, 0x03, 0x09, 0x00, 0x2f, 0x33, 0x30, 0x31, 0x45, 0x34, 0x36, 0x33,
-    0x32, 0x16, 0x15, 0x14, 0x06, 0x23, 0x22, 0x26, 0xfd, 0x1e, 0x49, 0x40, 0x40, 0x4a, 0x4a, 0x40,
-    0x40, 0x49, 0xf0, 0x34, 0x46, 0x46, 0x34, 0x33, 0x46, 0x46, 0x00, 0x01, 0x00, 0xcd, 0x04, 0xec,
-    0x01, 0xec, 0x06, 0x40, 0x00, 0x03, 0x00, 0x0a, 0xb2, 0x00, 0x80, 0x01, 0x00, 0x2f, 0x1a, 0xcd,
-    0x30, 0x31, 0x53, 0x13, 0x33, 0x03, 0xcd, 0x41, 0xde, 0x8f, 0x04, 0xec, 0x01, 0x54, 0xfe, 0xac,
-    0x00, 0x03, 0x00, 0x6e, 0x04, 0xe5, 0x03, 0xb7, 0x06, 0xb0, 0x00, 0x03, 0x00, 0x0f, 0x00, 0x1b,
-    0x00, 0x19, 0x40, 0x0a, 0x13, 0x19, 0x19, 0x0d, 0x01, 0x80, 0x00, 0x00, 0x07, 0x0d, 0x00, 0x2f,
-    0x33, 0x33, 0x2f, 0x1a, 0xcd, 0x11, 0x33, 0x11, 0x33, 0x30, 0x31, 0x41, 0x13, 0x33, 0x03, 0x05,
-    0x34, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14, 0x06, 0x23, 0x22, 0x26, 0x25, 0x34, 0x36, 0x33, 0x32,
-    0x16, 0x15, 0x14, 0x06, 0x23, 0x22, 0x26, 0x01, 0xc3, 0x2c, 0xe3, 0x82, 0xfe, 0x1e, 0x43, 0x39,
-    0x38, 0x45, 0x45, 0x38, 0x39, 0x43, 0x02, 0x4f, 0x44, 0x39, 0x39, 0x44, 0x44, 0x39, 0x39, 0x44,
-    0x05, 0x87, 0x01, 0x29, 0xfe, 0xd7, 0x2e, 0x31, 0x43, 0x43, 0x31, 0x30, 0x43, 0x43, 0x2f, 0x31,
-    0x43, 0x43, 0x31, 0x30, 0x43, 0x43, 0xff, 0xff, 0x00, 0x90, 0x02, 0x46, 0x01, 0xaa, 0x03, 0x4e,
-    0x06, 0x06, 0x00, 0x78, 0x00, 0x00, 0x00, 0x01, 0x00, 0x99, 0x00, 0x00, 0x04, 0x37, 0x05, 0xb0,
-    0x00, 0x05, 0x00, 0x0e, 0xb6, 0x02, 0x05, 0x02, 0x72, 0x04, 0x08, 0x72, 0x00, 0x2b, 0x2b, 0x32,
-    0x30, 0x31, 0x41, 0x15, 0x21, 0x11, 0x23, 0x11, 0x04, 0x37, 0xfd, 0x5c, 0xfa, 0x05, 0xb0, 0xc8,
-    0xfb, 0x18, 0x05, 0xb0, 0x00, 0x03, 0x00, 0x1a, 0x00, 0x00, 0x05, 0xa6, 0x05, 0xb0, 0x00, 0x04,
-    0x00, 0x09, 0x00, 0x0d, 0x00, 0x1b, 0x40, 0x0d, 0x06, 0x02, 0x07, 0x03, 0x02, 0x72, 0x0d, 0x0c,
-    0x0c, 0x05, 0x02, 0x12, 0x72, 0x00, 0x2b, 0x32, 0x32, 0x11, 0x33, 0x2b, 0x32, 0x12, 0x39, 0x30,
-    0x31, 0x41, 0x01, 0x21, 0x01, 0x33, 0x01, 0x01, 0x37, 0x33, 0x01, 0x27, 0x15, 0x21, 0x35, 0x03,
-    0x28, 0xfd, 0xf8, 0xfe, 0xfa, 0x02, 0x53, 0x91, 0x01, 0xa2, 0xfe, 0x07, 0x2c, 0x92, 0x02, 0x41,
-    0xdf, 0xfc, 0x1a, 0x05, 0x2f, 0xfa, 0xd1, 0x05, 0xb0, 0xfa, 0x50, 0x05, 0x37, 0x79, 0xfa, 0x50,
-    0xc7, 0xc7, 0xc7, 0x00, 0x00, 0x03, 0x00, 0x5c, 0xff, 0xec, 0x05, 0x15, 0x05, 0xc4, 0x00, 0x03,
-    0x00, 0x1b, 0x00, 0x33, 0x00, 0x1b, 0x40, 0x0d, 0x2f, 0x0a, 0x03, 0x02, 0x02, 0x0a, 0x23, 0x16,
-    0x03, 0x72, 0x0a, 0x09, 0x72, 0x00, 0x2b, 0x2b, 0x32, 0x11, 0x39, 0x2f, 0x33, 0x11, 0x33, 0x30,
-    0x31, 0x41, 0x15, 0x21, 0x35, 0x05, 0x15, 0x14, 0x02, 0x06, 0x06, 0x23, 0x22, 0x2e, 0x03, 0x35,
-    0x35, 0x34, 0x12, 0x36, 0x36, 0x33, 0x32, 0x1e, 0x03, 0x07, 0x35, 0x34, 0x2e, 0x03, 0x23, 0x22,
-    0x0e, 0x02, 0x15, 0x15, 0x14, 0x1e, 0x03, 0x33, 0x32, 0x3e, 0x02, 0x03, 0x9f, 0xfe, 0x46, 0x03,
-    0x30, 0x56, 0xa0, 0xde, 0x87, 0x6b, 0xb9, 0x96, 0x6b, 0x39, 0x58, 0xa1, 0xdd, 0x86, 0x6c, 0xba,
-    0x95, 0x6a, 0x38, 0xfc, 0x1e, 0x3c, 0x55, 0x6f, 0x43, 0x52, 0x82, 0x5c, 0x30, 0x1f, 0x3c, 0x57,
-    0x6e, 0x42, 0x54, 0x82, 0x5a, 0x2f, 0x03, 0x39, 0xbf, 0xbf, 0x39, 0x50, 0xa5, 0xfe, 0xfa, 0xb8,
-    0x61, 0x3f, 0x77, 0xad, 0xdd, 0x84, 0x50, 0xa5, 0x01, 0x05, 0xb9, 0x61, 0x3f, 0x78, 0xac, 0xdd,
-    0xd4, 0x52, 0x61, 0x9f, 0x79, 0x52, 0x2a, 0x41, 0x7f, 0xbb, 0x7a, 0x52, 0x62, 0x9f, 0x7a, 0x53,
-    0x2a, 0x41, 0x81, 0xbc, 0x00, 0x02, 0x00, 0x20, 0x00, 0x00, 0x05, 0x0f, 0x05, 0xb0, 0x00, 0x04,
-    0x00, 0x09, 0x00, 0x17, 0x40, 0x0b, 0x06, 0x00, 0x02, 0x07, 0x03, 0x02, 0x72, 0x05, 0x02, 0x08,
-    0x72, 0x00, 0x2b, 0x32, 0x2b, 0x32, 0x12, 0x39, 0x39, 0x30, 0x31, 0x41, 0x01, 0x21, 0x01, 0x33,
-    0x01, 0x01, 0x27, 0x33, 0x01, 0x02, 0xc0, 0xfe, 0x6e, 0xfe, 0xf2, 0x01, 0xfb, 0xb0, 0x01, 0x37,
-    0xfe, 0x6c, 0x0a, 0xb0, 0x01, 0xfb, 0x04, 0xcf, 0xfb, 0x31, 0x05, 0xb0, 0xfa, 0x50, 0x04, 0xd3,
-    0xdd, 0xfa, 0x50, 0x00, 0x00, 0x03, 0x00, 0x6a, 0x00, 0x00, 0x04, 0x2e, 0x05, 0xb0, 0x00, 0x03,
-    0x00, 0x07, 0x00, 0x0b, 0x00, 0x1b, 0x40, 0x0d, 0x01, 0x00, 0x05, 0x04, 0x04, 0x00, 0x08, 0x09,
-    0x02, 0x72, 0x00, 0x08, 0x72, 0x00, 0x2b, 0x2b, 0x32, 0x11, 0x39, 0x2f, 0x33, 0x11, 0x33, 0x30,
-    0x31, 0x73, 0x35, 0x21, 0x15, 0x01, 0x35, 0x21, 0x15, 0x01, 0x35, 0x21, 0x15, 0x6a, 0x03, 0xc4,
-    0xfc, 0xa3, 0x02, 0xf1, 0xfc, 0xb7, 0x03, 0x94, 0xc7, 0xc7, 0x02, 0x87, 0xc2, 0xc2, 0x02, 0x61,
-    0xc8, 0xc8, 0x00, 0x01, 0x00, 0x99, 0x00, 0x00, 0x05, 0x14, 0x05, 0xb0, 0x00, 0x07, 0x00, 0x13,
-    0x40, 0x09, 0x02, 0x06, 0x04, 0x07, 0x02, 0x72, 0x06, 0x08, 0x72, 0x00, 0x2b, 0x2b, 0x32, 0x11,
-    0x33, 0x30, 0x31, 0x41, 0x11, 0x23, 0x11, 0x21, 0x11, 0x23, 0x11, 0x05, 0x14, 0xfa, 0xfd, 0x79,
-    0xfa, 0x05, 0xb0, 0xfa, 0x50, 0x04, 0xe8, 0xfb, 0x18, 0x05, 0xb0, 0x00, 0x00, 0x03, 0x00, 0x47,
-    0x00, 0x00, 0x04, 0x4b, 0x05, 0xb0, 0x00, 0x03, 0x00, 0x07, 0x00, 0x10, 0x00, 0x21, 0x40, 0x10,
-    0x0e, 0x06, 0x06, 0x07, 0x07, 0x0f, 0x02, 0x72, 0x0c, 0x03, 0x03, 0x02, 0x02, 0x0b, 0x08, 0x72,
-    0x00, 0x2b, 0x32, 0x11, 0x33, 0x11, 0x33, 0x2b, 0x32, 0x11, 0x33, 0x11, 0x33, 0x30, 0x31, 0x65,
-    0x15, 0x21, 0x35, 0x01, 0x15, 0x21, 0x35, 0x01, 0x15, 0x01, 0x23, 0x35, 0x01, 0x01, 0x35, 0x33,
-    0x04, 0x4b, 0xfc, 0x5c, 0x03, 0x81, 0xfc, 0x82, 0x02, 0x71, 0xfd, 0xe1, 0xb5, 0x01, 0xcb, 0xfe,
-    0x35, 0xb5, 0xc7, 0xc7, 0xc7, 0x04, 0xe9, 0xc8, 0xc8, 0xfd, 0x37, 0x14, 0xfd, 0x2d, 0x92, 0x02,
-    0x4b, 0x02, 0x41, 0x92, 0x00, 0x03, 0x00, 0x4c, 0x00, 0x00, 0x05, 0xb6, 0x05, 0xb0, 0x00, 0x13,
-    0x00, 0x27, 0x00, 0x2b, 0x00, 0x21, 0x40, 0x10, 0x14, 0x15, 0x15, 0x01, 0x00, 0x29, 0x08, 0x72,
-    0x1f, 0x1e, 0x1e, 0x0a, 0x0b, 0x28, 0x02, 0x72, 0x00, 0x2b, 0xcd, 0x32, 0x32, 0x11, 0x33, 0x2b,
-    0xcd, 0x32, 0x32, 0x11, 0x33, 0x30, 0x31, 0x65, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x34, 0x36, 0x24,
-    0x33, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x14, 0x06, 0x04, 0x25, 0x33, 0x32, 0x36, 0x36, 0x35, 0x34,
-    0x2e, 0x02, 0x23, 0x23, 0x22, 0x06, 0x06, 0x15, 0x14, 0x1e, 0x02, 0x01, 0x11, 0x23, 0x11, 0x03,
-    0x66, 0xca, 0x85, 0xd9, 0x9d, 0x55, 0x95, 0x01, 0x09, 0xaf, 0xcf, 0x83, 0xd9, 0x9d, 0x55, 0x94,
-    0xfe, 0xf6, 0xfe, 0x84, 0xcc, 0x70, 0x98, 0x4f, 0x2d, 0x57, 0x7f, 0x52, 0xd1, 0x6d, 0x99, 0x51,
-    0x2d, 0x58, 0x82, 0x01, 0x37, 0xfb, 0xab, 0x4e, 0x91, 0xcb, 0x7b, 0xa7, 0xfd, 0x8c, 0x4f, 0x95,
-    0xcc, 0x7e, 0xa5, 0xf8, 0x8a, 0xd1, 0x51, 0x99, 0x6c, 0x53, 0x81, 0x5a, 0x2f, 0x53, 0x9d, 0x6f,
-    0x50, 0x7f, 0x58, 0x2d, 0x04, 0x34, 0xfa, 0x50, 0x05, 0xb0, 0x00, 0x02, 0x00, 0x46, 0x00, 0x00,
-    0x05, 0x64, 0x05, 0xb0, 0x00, 0x19, 0x00, 0x1d, 0x00, 0x19, 0x40, 0x0c, 0x14, 0x07, 0x07, 0x0d,
-    0x1c, 0x08, 0x72, 0x1d, 0x01, 0x0d, 0x02, 0x72, 0x00, 0x2b, 0x32, 0x32, 0x2b, 0x11, 0x39, 0x11,
-    0x33, 0x30, 0x31, 0x41, 0x33, 0x11, 0x14, 0x02, 0x04, 0x23, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x11,
-    0x33, 0x11, 0x14, 0x1e, 0x02, 0x33, 0x33, 0x32, 0x36, 0x36, 0x35, 0x01, 0x11, 0x23, 0x11, 0x04,
-    0x68, 0xfc, 0x9c, 0xfe, 0xe9, 0xb6, 0x56, 0x86, 0xdf, 0xa1, 0x59, 0xfb, 0x33, 0x60, 0x86, 0x53,
-    0x55, 0x72, 0xa0, 0x54, 0xfe, 0xea, 0xfa, 0x05, 0xb0, 0xfe, 0x12, 0xbd, 0xfe, 0xf9, 0x89, 0x4e,
-    0x96, 0xdc, 0x8d, 0x01, 0xee, 0xfe, 0x12, 0x60, 0x92, 0x62, 0x32, 0x59, 0xad, 0x80, 0x01, 0xee,
-    0xfa, 0x50, 0x05, 0xb0, 0x00, 0x03, 0x00, 0x6c, 0x00, 0x00, 0x04, 0xdb, 0x05, 0xc4, 0x00, 0x2d,
-    0x00, 0x31, 0x00, 0x35, 0x00, 0x25, 0x40, 0x12, 0x28, 0x12, 0x12, 0x2f, 0x29, 0x29, 0x34, 0x11,
-    0x11, 0x33, 0x2e, 0x32, 0x12, 0x72, 0x06, 0x1d, 0x03, 0x72, 0x00, 0x2b, 0x32, 0x2b, 0x32, 0x32,
-    0x32, 0x11, 0x33, 0x33, 0x11, 0x33, 0x32, 0x11, 0x33, 0x30, 0x31, 0x41, 0x35, 0x34, 0x2e, 0x02,
-    0x23, 0x22, 0x0e, 0x02, 0x15, 0x15, 0x14, 0x1e, 0x02, 0x17, 0x15, 0x2e, 0x03, 0x35, 0x35, 0x34,
-    0x3e, 0x02, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x15, 0x14, 0x0e, 0x02, 0x07, 0x35, 0x3e, 0x03, 0x03,
-    0x35, 0x21, 0x15, 0x21, 0x35, 0x21, 0x15, 0x03, 0xcd, 0x29, 0x4e, 0x6f, 0x45, 0x44, 0x6d, 0x4d,
-    0x29, 0x23, 0x40, 0x5a, 0x35, 0x66, 0xb8, 0x8f, 0x54, 0x52, 0x97, 0xcf, 0x7e, 0x7f, 0xd1, 0x97,
-    0x52, 0x52, 0x8e, 0xb6, 0x64, 0x34, 0x57, 0x3e, 0x23, 0xec, 0x01, 0xee, 0xfb, 0xa8, 0x01, 0xf6,
-    0x02, 0xef, 0x66, 0x68, 0x9e, 0x6b, 0x36, 0x36, 0x6b, 0x9e, 0x68, 0x66, 0x7e, 0xbe, 0x86, 0x51,
-    0x0f, 0x8f, 0x0d, 0x77, 0xbd, 0xed, 0x83, 0x64, 0x8a, 0xe5, 0xa7, 0x5b, 0x5b, 0xa7, 0xe5, 0x8a,
-    0x64, 0x82, 0xed, 0xbd, 0x77, 0x0e, 0x8f, 0x10, 0x51, 0x86, 0xbe, 0xfd, 0x8e, 0xc8, 0xc8, 0xc8,
-    0xc8, 0x00, 0x00, 0x03, 0x00, 0x56, 0xff, 0xeb, 0x04, 0x7b, 0x04, 0x4e, 0x00, 0x16, 0x00, 0x2c,
-    0x00, 0x41, 0x00, 0x1a, 0x40, 0x0d, 0x2e, 0x06, 0x34, 0x3b, 0x3b, 0x1d, 0x12, 0x0b, 0x72, 0x28,
-    0x06, 0x07, 0x72, 0x00, 0x2b, 0x32, 0x2b, 0x32, 0x32, 0x11, 0x33, 0x3f, 0x30, 0x31, 0x53, 0x35,
-    0x34, 0x3e, 0x02, 0x33, 0x32, 0x1e, 0x03, 0x17, 0x15, 0x0e, 0x03, 0x23, 0x22, 0x2e, 0x02, 0x37,
-    0x15, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x3e, 0x02, 0x37, 0x35, 0x2e, 0x03, 0x23, 0x22, 0x0e, 0x02,
-    0x01, 0x33, 0x11, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x36, 0x37, 0x17, 0x06, 0x06, 0x23, 0x22, 0x2e,
-    0x02, 0x27, 0x11, 0x56, 0x37, 0x6b, 0x9e, 0x67, 0x4a, 0x77, 0x5a, 0x3f, 0x29, 0x0a, 0x0c, 0x39,
-    0x60, 0x8c, 0x5e, 0x65, 0x9d, 0x6c, 0x37, 0xf2, 0x1a, 0x38, 0x5c, 0x41, 0x40, 0x5a, 0x3d, 0x26,
-    0x0b, 0x09, 0x24, 0x3e, 0x5c, 0x3f, 0x41, 0x5c, 0x3a, 0x1a, 0x01, 0xe4, 0xcf, 0x0b, 0x15, 0x1c,
-    0x11, 0x08, 0x0e, 0x05, 0x18, 0x20, 0x3b, 0x21, 0x35, 0x57, 0x3f, 0x25, 0x05, 0x01, 0xfb, 0x15,
-    0x7e, 0xd2, 0x9a, 0x54, 0x32, 0x5f, 0x84, 0xa5, 0x60, 0x3e, 0x74, 0xbf, 0x8c, 0x4c, 0x4e, 0x8e,
-    0xc1, 0x88, 0x15, 0x47, 0x7a, 0x5c, 0x33, 0x32, 0x58, 0x75, 0x42, 0x47, 0x46, 0x7e, 0x60, 0x37,
-    0x3c, 0x69, 0x8b, 0x01, 0xdc, 0xfd, 0x09, 0x2b, 0x36, 0x21, 0x0d, 0x04, 0x01, 0xb1, 0x12, 0x0b,
-    0x23, 0x4b, 0x76, 0x52, 0x02, 0x30, 0x00, 0x02, 0x00, 0x97, 0xfe, 0x75, 0x04, 0x6e, 0x05, 0xc4,
-    0x00, 0x1c, 0x00, 0x3a, 0x00, 0x1e, 0x40, 0x0e, 0x35, 0x00, 0x26, 0x27, 0x27, 0x1c, 0x1c, 0x30,
-    0x1d, 0x03, 0x13, 0x09, 0x0b, 0x72, 0x00, 0x2b, 0x32, 0x3f, 0x33, 0x39, 0x2f, 0x33, 0x12, 0x39,
-    0x39, 0x2f, 0x30, 0x31, 0x41, 0x33, 0x32, 0x16, 0x16, 0x15, 0x14, 0x06, 0x06, 0x23, 0x22, 0x2e,
-    0x02, 0x35, 0x37, 0x14, 0x16, 0x16, 0x33, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x23,
-    0x13, 0x32, 0x16, 0x16, 0x15, 0x14, 0x06, 0x06, 0x23, 0x23, 0x35, 0x33, 0x32, 0x36, 0x36, 0x35,
-    0x34, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x15, 0x11, 0x23, 0x11, 0x34, 0x36, 0x36, 0x02, 0x1b,
-    0x8d, 0x90, 0xca, 0x6c, 0x70, 0xca, 0x88, 0x4e, 0x9f, 0x85, 0x50, 0x5b, 0x4f, 0x8e, 0x5e, 0x50,
-    0x71, 0x3b, 0x36, 0x69, 0x4d, 0x75, 0x4e, 0x89, 0xca, 0x6f, 0x6b, 0xc1, 0x81, 0x63, 0x4a, 0x4d,
-    0x5d, 0x2b, 0x2e, 0x5c, 0x47, 0x3f, 0x67, 0x3b, 0xf1, 0x80, 0xd3, 0x03, 0x2d, 0x64, 0xb1, 0x75,
-    0x8c, 0xc4, 0x67, 0x2e, 0x5f, 0x96, 0x68, 0x1a, 0x3f, 0x69, 0x3e, 0x41, 0x70, 0x47, 0x48, 0x74,
-    0x46, 0x03, 0x1f, 0x60, 0xb0, 0x79, 0x63, 0xa2, 0x60, 0x84, 0x35, 0x62, 0x41, 0x37, 0x5f, 0x3c,
-    0x3a, 0x69, 0x44, 0xfa, 0x58, 0x05, 0xa8, 0x7b, 0xbf, 0x6d, 0x00, 0x03, 0x00, 0x1e, 0xfe, 0x5f,
-    0x03, 0xf5, 0x04, 0x3a, 0x00, 0x03, 0x00, 0x08, 0x00, 0x0d, 0x00, 0x19, 0x40, 0x0e, 0x08, 0x0c,
-    0x03, 0x04, 0x0a, 0x05, 0x01, 0x05, 0x0d, 0x06, 0x72, 0x01, 0x0e, 0x72, 0x00, 0x2b, 0x2b, 0x32,
-    0x12, 0x17, 0x39, 0x30, 0x31, 0x65, 0x11, 0x23, 0x11, 0x37, 0x13, 0x33, 0x01, 0x23, 0x03, 0x01,
-    0x17, 0x23, 0x01, 0x02, 0x81, 0xf1, 0x6f, 0xfb, 0xfb, 0xfe, 0x81, 0xa2, 0xbc, 0x01, 0x04, 0x24,
-    0xa2, 0xfe, 0x80, 0x6d, 0xfd, 0xf2, 0x02, 0x0e, 0x95, 0x03, 0x38, 0xfb, 0xc6, 0x04, 0x3a, 0xfc,
-    0xc4, 0xfe, 0x04, 0x3a, 0x00, 0x02, 0x00, 0x51, 0xff, 0xec, 0x04, 0x3a, 0x06, 0x21, 0x00, 0x2c,
-    0x00, 0x42, 0x00, 0x19, 0x40, 0x0d, 0x14, 0x28, 0x3e, 0x03, 0x04, 0x33, 0x1e, 0x0b, 0x72, 0x0b,
-    0x04, 0x01, 0x72, 0x00, 0x2b, 0x32, 0x2b, 0x32, 0x12, 0x17, 0x39, 0x30, 0x31, 0x53, 0x34, 0x36,
-    0x36, 0x33, 0x32, 0x16, 0x17, 0x07, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x15, 0x14, 0x1e, 0x02,
-    0x17, 0x1e, 0x02, 0x15, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x35, 0x34, 0x36,
-    0x36, 0x37, 0x27, 0x2e, 0x02, 0x13, 0x15, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x3e, 0x02, 0x35, 0x35,
-    0x34, 0x2e, 0x02, 0x27, 0x22, 0x0e, 0x02, 0xcd, 0x60, 0xb1, 0x7b, 0x4f, 0x76, 0x46, 0x01, 0x2a,
-    0x87, 0x4c, 0x36, 0x4e, 0x2b, 0x10, 0x29, 0x4b, 0x3c, 0x96, 0xc8, 0x65, 0x44, 0x81, 0xb9, 0x75,
-    0x77, 0xbb, 0x81, 0x43, 0x59, 0x94, 0x55, 0x02, 0x3c, 0x59, 0x2f, 0x75, 0x1f, 0x40, 0x62, 0x44,
-    0x42, 0x61, 0x3f, 0x1f, 0x24, 0x44, 0x5e, 0x3a, 0x42, 0x63, 0x41, 0x20, 0x04, 0xec, 0x60, 0x8a,
-    0x4b, 0x19, 0x1a, 0xbd, 0x0e, 0x27, 0x1c, 0x35, 0x23, 0x12, 0x28, 0x29, 0x2b, 0x14, 0x34, 0x9f,
-    0xd9, 0x8a, 0x15, 0x73, 0xc3, 0x92, 0x51, 0x50, 0x8f, 0xc1, 0x71, 0x16, 0x74, 0xbe, 0x80, 0x15,
-    0x05, 0x1c, 0x4f, 0x66, 0xfd, 0x71, 0x16, 0x48, 0x7f, 0x61, 0x38, 0x38, 0x61, 0x7f, 0x48, 0x16,
-    0x3a, 0x71, 0x62, 0x43, 0x0c, 0x38, 0x61, 0x7e, 0x00, 0x02, 0x00, 0x62, 0xff, 0xec, 0x04, 0x12,
-    0x04, 0x4d, 0x00, 0x1f, 0x00, 0x3f, 0x00, 0x1f, 0x40, 0x0f, 0x00, 0x21, 0x3e, 0x3e, 0x03, 0x03,
-    0x16, 0x35, 0x2b, 0x07, 0x72, 0x0c, 0x16, 0x0b, 0x72, 0x00, 0x2b, 0x32, 0x2b, 0x32, 0x12, 0x39,
-    0x2f, 0x33, 0x12, 0x39, 0x39, 0x30, 0x31, 0x41, 0x33, 0x15, 0x23, 0x22, 0x06, 0x06, 0x15, 0x14,
-    0x1e, 0x02, 0x33, 0x32, 0x36, 0x36, 0x35, 0x33, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x35,
-    0x34, 0x3e, 0x02, 0x05, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x1e, 0x02,
-    0x15, 0x23, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x15, 0x14, 0x1e, 0x02, 0x33, 0x33, 0x02,
-    0x0d, 0xea, 0xc2, 0x47, 0x66, 0x35, 0x1d, 0x3b, 0x56, 0x38, 0x49, 0x68, 0x38, 0xf0, 0x50, 0x86,
-    0xa5, 0x55, 0x67, 0xaf, 0x82, 0x48, 0x3a, 0x6e, 0x9e, 0x01, 0x4f, 0xea, 0x5b, 0x97, 0x6c, 0x3a,
-    0x42, 0x7a, 0xaa, 0x67, 0x5b, 0xa1, 0x7c, 0x47, 0xf1, 0x39, 0x61, 0x3d, 0x49, 0x5e, 0x2c, 0x19,
-    0x32, 0x4f, 0x35, 0xc2, 0x02, 0x4b, 0x77, 0x1f, 0x43, 0x36, 0x1e, 0x37, 0x2b, 0x19, 0x2c, 0x48,
-    0x29, 0x58, 0x81, 0x53, 0x28, 0x2c, 0x54, 0x79, 0x4c, 0x44, 0x69, 0x48, 0x25, 0x46, 0x2a, 0x4b,
-    0x62, 0x37, 0x4d, 0x75, 0x4f, 0x29, 0x2c, 0x55, 0x78, 0x4c, 0x2a, 0x40, 0x24, 0x2a, 0x41, 0x24,
-    0x1e, 0x33, 0x25, 0x14, 0x00, 0x02, 0x00, 0x59, 0xfe, 0x7d, 0x03, 0xc5, 0x05, 0xb0, 0x00, 0x28,
-    0x00, 0x2c, 0x00, 0x15, 0x40, 0x09, 0x15, 0x02, 0x2c, 0x2c, 0x29, 0x29, 0x00, 0x02, 0x72, 0x00,
-    0x2b, 0x32, 0x2f, 0x33, 0x11, 0x33, 0x2f, 0x30, 0x31, 0x41, 0x33, 0x15, 0x01, 0x0e, 0x02, 0x15,
-    0x14, 0x1e, 0x02, 0x17, 0x17, 0x1e, 0x02, 0x15, 0x14, 0x06, 0x06, 0x07, 0x27, 0x3e, 0x02, 0x35,
-    0x34, 0x26, 0x26, 0x27, 0x27, 0x2e, 0x03, 0x35, 0x34, 0x36, 0x36, 0x37, 0x01, 0x21, 0x15, 0x21,
-    0x03, 0x3d, 0x88, 0xfe, 0x9a, 0x47, 0x61, 0x32, 0x15, 0x28, 0x3e, 0x29, 0x65, 0x51, 0x7c, 0x46,
-    0x42, 0x5e, 0x2f, 0x7c, 0x20, 0x2a, 0x15, 0x19, 0x3a, 0x30, 0x51, 0x59, 0x7e, 0x50, 0x25, 0x3b,
-    0x7a, 0x5d, 0xfe, 0xb2, 0x03, 0x0b, 0xfc, 0xf5, 0x05, 0xb0, 0x8d, 0xfe, 0x52, 0x54, 0x93, 0x9a,
-    0x5e, 0x2f, 0x43, 0x30, 0x1f, 0x0c, 0x1f, 0x16, 0x31, 0x57, 0x52, 0x37, 0x7a, 0x6b, 0x21, 0x62,
-    0x22, 0x3d, 0x37, 0x19, 0x17, 0x26, 0x1e, 0x0c, 0x16, 0x17, 0x41, 0x58, 0x76, 0x4c, 0x5d, 0xc1,
-    0xce, 0x6f, 0x01, 0xd8, 0xbe, 0x00, 0x00, 0x02, 0x00, 0x7d, 0xfe, 0x61, 0x04, 0x06, 0x04, 0x4e,
-    0x00, 0x04, 0x00, 0x1c, 0x00, 0x17, 0x40, 0x0c, 0x18, 0x0b, 0x03, 0x06, 0x72, 0x02, 0x0a, 0x72,
-    0x0b, 0x07, 0x72, 0x11, 0x00, 0x2f, 0x2b, 0x2b, 0x2b, 0x11, 0x33, 0x30, 0x31, 0x41, 0x11, 0x23,
-    0x11, 0x33, 0x03, 0x07, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x11, 0x23, 0x11, 0x34,
-    0x2e, 0x02, 0x23, 0x22, 0x0e, 0x02, 0x01, 0x6e, 0xf1, 0xde, 0x1c, 0x46, 0x3b, 0x6f, 0x9d, 0x62,
-    0x51, 0x83, 0x5d, 0x33, 0xf2, 0x1a, 0x33, 0x49, 0x2f, 0x46, 0x67, 0x43, 0x20, 0x03, 0x53, 0xfc,
-    0xad, 0x04, 0x3a, 0xfe, 0x07, 0x02, 0x72, 0xc1, 0x8e, 0x4e, 0x2a, 0x5f, 0x9d, 0x73, 0xfb, 0xac,
-    0x04, 0x52, 0x3d, 0x54, 0x33, 0x17, 0x34, 0x5c, 0x78, 0x00, 0x00, 0x03, 0x00, 0x76, 0xff, 0xec,
-    0x04, 0x30, 0x05, 0xc4, 0x00, 0x19, 0x00, 0x27, 0x00, 0x36, 0x00, 0x1d, 0x40, 0x10, 0x0d, 0x28,
-    0x6a, 0x30, 0x20, 0x6a, 0x30, 0x30, 0x0d, 0x00, 0x1a, 0x6a, 0x00, 0x0d, 0x0b, 0x72, 0x00, 0x2b,
-    0x2f, 0x2b, 0x12, 0x39, 0x2f, 0x2b, 0x2b, 0x30, 0x31, 0x41, 0x32, 0x1e, 0x03, 0x15, 0x15, 0x14,
-    0x0e, 0x03, 0x23, 0x22, 0x2e, 0x03, 0x35, 0x35, 0x34, 0x3e, 0x03, 0x17, 0x22, 0x0e, 0x02, 0x15,
-    0x15, 0x21, 0x35, 0x34, 0x2e, 0x03, 0x03, 0x32, 0x3e, 0x03, 0x35, 0x35, 0x21, 0x15, 0x14, 0x1e,
-    0x03, 0x02, 0x52, 0x57, 0x93, 0x76, 0x53, 0x2b, 0x2b, 0x52, 0x75, 0x93, 0x57, 0x56, 0x93, 0x75,
-    0x54, 0x2c, 0x2c, 0x53, 0x74, 0x93, 0x56, 0x38, 0x58, 0x3c, 0x1f, 0x01, 0xd8, 0x14, 0x26, 0x3a,
-    0x4b, 0x2c, 0x2e, 0x4b, 0x38, 0x27, 0x13, 0xfe, 0x28, 0x14, 0x28, 0x39, 0x4b, 0x05, 0xc4, 0x30,
-    0x64, 0x97, 0xcf, 0x84, 0xd7, 0x83, 0xcf, 0x9a, 0x65, 0x32, 0x32, 0x65, 0x9a, 0xcf, 0x83, 0xd7,
-    0x84, 0xcf, 0x97, 0x64, 0x30, 0xbf, 0x33, 0x67, 0x9a, 0x67, 0x34, 0x34, 0x52, 0x84, 0x63, 0x41,
-    0x21, 0xfb, 0xa7, 0x22, 0x43, 0x65, 0x85, 0x53, 0x2e, 0x2e, 0x53, 0x85, 0x65, 0x43, 0x22, 0x00,
-    0x00, 0x01, 0x00, 0xa3, 0xff, 0xf4, 0x02, 0x5e, 0x04, 0x3a, 0x00, 0x11, 0x00, 0x0e, 0xb6, 0x06,
-    0x0d, 0x0b, 0x72, 0x00, 0x06, 0x72, 0x00, 0x2b, 0x2b, 0x32, 0x30, 0x31, 0x53, 0x33, 0x03, 0x14,
-    0x16, 0x16, 0x33, 0x32, 0x36, 0x37, 0x15, 0x06, 0x06, 0x23, 0x22, 0x26, 0x26, 0x35, 0xa3, 0xf2,
-    0x01, 0x1d, 0x34, 0x23, 0x19, 0x2e, 0x0f, 0x1e, 0x4f, 0x33, 0x53, 0x80, 0x48, 0x04, 0x3a, 0xfc,
-    0xfa, 0x33, 0x35, 0x13, 0x07, 0x03, 0xb7, 0x0a, 0x0e, 0x3c, 0x85, 0x70, 0x00, 0x02, 0x00, 0x15,
-    0xff, 0xee, 0x04, 0x4d, 0x05, 0xfc, 0x00, 0x04, 0x00, 0x26, 0x00, 0x1e, 0x40, 0x10, 0x00, 0x1b,
-    0x04, 0x03, 0x04, 0x02, 0x20, 0x05, 0x00, 0x72, 0x0f, 0x16, 0x16, 0x02, 0x0a, 0x72, 0x00, 0x2b,
-    0x32, 0x2f, 0x33, 0x2b, 0x32, 0x12, 0x17, 0x39, 0x30, 0x31, 0x41, 0x01, 0x21, 0x01, 0x17, 0x01,
-    0x32, 0x1e, 0x02, 0x17, 0x01, 0x1e, 0x02, 0x33, 0x32, 0x36, 0x33, 0x17, 0x06, 0x06, 0x23, 0x22,
-    0x26, 0x26, 0x27, 0x01, 0x03, 0x2e, 0x02, 0x23, 0x22, 0x06, 0x07, 0x27, 0x36, 0x36, 0x02, 0x21,
-    0xfe, 0xfb, 0xfe, 0xf9, 0x01, 0x9c, 0xa6, 0xfe, 0xbd, 0x37, 0x55, 0x3f, 0x2c, 0x0f, 0x01, 0xa4,
-    0x0d, 0x1d, 0x25, 0x19, 0x09, 0x13, 0x08, 0x03, 0x11, 0x30, 0x1d, 0x49, 0x67, 0x47, 0x1d, 0xfe,
-    0xe0, 0x73, 0x0e, 0x23, 0x2f, 0x1f, 0x0b, 0x1d, 0x0e, 0x04, 0x19, 0x4f, 0x02, 0xf0, 0xfd, 0x10,
-    0x04, 0x52, 0x08, 0x01, 0xb2, 0x18, 0x2d, 0x41, 0x28, 0xfb, 0xca, 0x1f, 0x2d, 0x18, 0x01, 0xbd,
-    0x04, 0x06, 0x29, 0x5e, 0x4f, 0x03, 0x06, 0x01, 0x11, 0x24, 0x2a, 0x13, 0x01, 0x01, 0xb2, 0x07,
-    0x09, 0x00, 0x00, 0x02, 0x00, 0x67, 0xfe, 0x76, 0x03, 0xda, 0x05, 0xc4, 0x00, 0x1e, 0x00, 0x46,
-    0x00, 0x19, 0x40, 0x0b, 0x1f, 0x11, 0x0f, 0x0f, 0x21, 0x21, 0x33, 0x05, 0x1b, 0x03, 0x72, 0x00,
-    0x2b, 0x32, 0x2f, 0x39, 0x2f, 0x33, 0x12, 0x39, 0x39, 0x30, 0x31, 0x41, 0x07, 0x2e, 0x02, 0x23,
-    0x22, 0x06, 0x06, 0x15, 0x14, 0x1e, 0x02, 0x33, 0x33, 0x15, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x34,
-    0x3e, 0x02, 0x33, 0x32, 0x16, 0x16, 0x03, 0x33, 0x15, 0x23, 0x22, 0x06, 0x06, 0x15, 0x14, 0x16,
-    0x16, 0x17, 0x17, 0x1e, 0x02, 0x07, 0x14, 0x06, 0x06, 0x07, 0x27, 0x3e, 0x02, 0x35, 0x34, 0x26,
-    0x26, 0x27, 0x27, 0x2e, 0x03, 0x35, 0x34, 0x3e, 0x02, 0x03, 0xae, 0x23, 0x2e, 0x49, 0x46, 0x28,
-    0x59, 0x72, 0x36, 0x1f, 0x41, 0x68, 0x49, 0x92, 0x96, 0x73, 0xbb, 0x87, 0x49, 0x43, 0x7f, 0xb0,
-    0x6e, 0x3a, 0x62, 0x57, 0xd1, 0x92, 0x8e, 0x71, 0x9e, 0x53, 0x49, 0x77, 0x47, 0x66, 0x57, 0x7b,
-    0x43, 0x01, 0x42, 0x5f, 0x2d, 0x82, 0x1f, 0x2d, 0x18, 0x1b, 0x39, 0x2f, 0x3d, 0x68, 0xa8, 0x76,
-    0x40, 0x54, 0x9b, 0xd9, 0x05, 0x97, 0xb9, 0x0b, 0x11, 0x08, 0x2c, 0x4b, 0x2e, 0x28, 0x44, 0x31,
-    0x1b, 0x8c, 0x2d, 0x54, 0x75, 0x4a, 0x56, 0x86, 0x5e, 0x31, 0x0b, 0x14, 0xfd, 0xc5, 0x88, 0x3f,
-    0x7f, 0x61, 0x4f, 0x6b, 0x40, 0x11, 0x19, 0x15, 0x34, 0x59, 0x4b, 0x38, 0x79, 0x6a, 0x21, 0x63,
-    0x21, 0x39, 0x38, 0x1f, 0x18, 0x23, 0x1c, 0x0c, 0x11, 0x1b, 0x42, 0x60, 0x95, 0x70, 0x68, 0x9f,
-    0x6c, 0x37, 0x00, 0x03, 0x00, 0x30, 0xff, 0xf4, 0x04, 0xd8, 0x04, 0x3a, 0x00, 0x03, 0x00, 0x07,
-    0x00, 0x19, 0x00, 0x19, 0x40, 0x0d, 0x0e, 0x15, 0x0b, 0x72, 0x06, 0x0a, 0x72, 0x09, 0x07, 0x02,
-    0x03, 0x06, 0x72, 0x00, 0x2b, 0x32, 0x32, 0x32, 0x2b, 0x2b, 0x32, 0x30, 0x31, 0x41, 0x15, 0x21,
-    0x35, 0x21, 0x11, 0x23, 0x11, 0x21, 0x33, 0x11, 0x14, 0x16, 0x16, 0x33, 0x32, 0x36, 0x37, 0x17,
-    0x06, 0x06, 0x23, 0x22, 0x26, 0x26, 0x35, 0x04, 0xb3, 0xfb, 0x7d, 0x01, 0x9f, 0xf1, 0x02, 0x3e,
-    0xf2, 0x1d, 0x34, 0x23, 0x19, 0x2e, 0x0e, 0x01, 0x1e, 0x4f, 0x33, 0x53, 0x80, 0x49, 0x04, 0x3a,
-    0xba, 0xba, 0xfb, 0xc6, 0x04, 0x3a, 0xfc, 0xfa, 0x33, 0x35, 0x13, 0x07, 0x03, 0xb7, 0x0a, 0x0e,
-    0x3c, 0x85, 0x70, 0x00, 0x00, 0x01, 0x00, 0x80, 0xfe, 0x60, 0x04, 0x30, 0x04, 0x4e, 0x00, 0x2f,
-    0x00, 0x17, 0x40, 0x0c, 0x1e, 0x29, 0x06, 0x11, 0x0b, 0x72, 0x06, 0x07, 0x72, 0x00, 0x0e, 0x72,
-    0x00, 0x2b, 0x2b, 0x2b, 0x11, 0x33, 0x32, 0x30, 0x31, 0x53, 0x11, 0x34, 0x3e, 0x02, 0x33, 0x32,
-    0x1e, 0x02, 0x15, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x27, 0x1e, 0x02, 0x33, 0x1e,
-    0x02, 0x33, 0x32, 0x3e, 0x02, 0x35, 0x35, 0x34, 0x2e, 0x02, 0x23, 0x22, 0x0e, 0x02, 0x15, 0x11,
-    0x80, 0x45, 0x7e, 0xad, 0x68, 0x75, 0xb0, 0x77, 0x3c, 0x36, 0x6b, 0x9b, 0x65, 0x64, 0x94, 0x66,
-    0x3e, 0x0d, 0x04, 0x2d, 0x2d, 0x01, 0x0b, 0x3c, 0x6d, 0x54, 0x41, 0x5c, 0x3a, 0x1a, 0x19, 0x39,
-    0x5b, 0x41, 0x3c, 0x54, 0x36, 0x19, 0xfe, 0x60, 0x03, 0xe3, 0x7a, 0xc1, 0x88, 0x48, 0x54, 0x9a,
-    0xd2, 0x7e, 0x15, 0x73, 0xc1, 0x8e, 0x4d, 0x49, 0x87, 0xba, 0x70, 0x01, 0x1c, 0x1c, 0x48, 0x75,
-    0x45, 0x33, 0x5c, 0x7a, 0x47, 0x15, 0x4e, 0x8b, 0x69, 0x3c, 0x3b, 0x64, 0x7c, 0x3e, 0xfc, 0x2b,
-    0x00, 0x01, 0x00, 0x50, 0xfe, 0x8a, 0x03, 0xe9, 0x04, 0x4e, 0x00, 0x2d, 0x00, 0x0e, 0xb5, 0x1b,
-    0x09, 0x05, 0x00, 0x07, 0x72, 0x00, 0x2b, 0xcc, 0x33, 0x2f, 0x30, 0x31, 0x41, 0x32, 0x16, 0x16,
-    0x15, 0x23, 0x34, 0x26, 0x26, 0x23, 0x22, 0x0e, 0x02, 0x15, 0x15, 0x14, 0x16, 0x16, 0x17, 0x1e,
-    0x02, 0x17, 0x14, 0x06, 0x06, 0x07, 0x27, 0x3e, 0x02, 0x27, 0x34, 0x26, 0x26, 0x27, 0x2e, 0x02,
-    0x35, 0x35, 0x34, 0x3e, 0x02, 0x02, 0x38, 0x7e, 0xc4, 0x6f, 0xe4, 0x2d, 0x5b, 0x45, 0x44, 0x5e,
-    0x3a, 0x1a, 0x42, 0x86, 0x64, 0x59, 0x81, 0x47, 0x02, 0x40, 0x5e, 0x2e, 0x7f, 0x20, 0x2a, 0x15,
-    0x01, 0x1b, 0x38, 0x2c, 0x99, 0xd1, 0x6b, 0x40, 0x7c, 0xb6, 0x04, 0x4e, 0x60, 0xb6, 0x81, 0x3c,
-    0x62, 0x39, 0x3b, 0x65, 0x7d, 0x43, 0x23, 0x5a, 0x81, 0x57, 0x1d, 0x18, 0x33, 0x59, 0x53, 0x37,
-    0x7a, 0x69, 0x21, 0x62, 0x22, 0x39, 0x36, 0x1f, 0x1c, 0x26, 0x1a, 0x0a, 0x26, 0x86, 0xce, 0x8f,
-    0x23, 0x70, 0xc5, 0x96, 0x55, 0x00, 0x00, 0x03, 0x00, 0x50, 0xff, 0xec, 0x04, 0x7d, 0x04, 0x3a,
-    0x00, 0x18, 0x00, 0x2e, 0x00, 0x32, 0x00, 0x13, 0x40, 0x09, 0x2a, 0x06, 0x32, 0x06, 0x72, 0x1f,
-    0x14, 0x0b, 0x72, 0x00, 0x2b, 0x32, 0x2b, 0x32, 0x32, 0x30, 0x31, 0x53, 0x35, 0x34, 0x3e, 0x02,
-    0x33, 0x1e, 0x02, 0x17, 0x1e, 0x02, 0x15, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x37,
-    0x15, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x3e, 0x02, 0x35, 0x35, 0x34, 0x2e, 0x02, 0x23, 0x22, 0x0e,
-    0x02, 0x01, 0x15, 0x21, 0x35, 0x50, 0x42, 0x80, 0xb8, 0x76, 0x1a, 0x2f, 0x41, 0x37, 0x55, 0x87,
-    0x4f, 0x41, 0x7e, 0xb6, 0x75, 0x76, 0xba, 0x80, 0x42, 0xf1, 0x1d, 0x3e, 0x62, 0x44, 0x42, 0x5e,
-    0x3c, 0x1c, 0x1c, 0x3c, 0x5f, 0x42, 0x44, 0x62, 0x3d, 0x1d, 0x03, 0x3c, 0xfd, 0xc3, 0x02, 0x11,
-    0x17, 0x71, 0xc1, 0x90, 0x50, 0x07, 0x32, 0x37, 0x10, 0x24, 0x84, 0xac, 0x65, 0x16, 0x68, 0xb9,
-    0x8d, 0x51, 0x53, 0x94, 0xc9, 0x8c, 0x17, 0x49, 0x82, 0x62, 0x39, 0x39, 0x62, 0x82, 0x49, 0x17,
-    0x43, 0x7a, 0x5f, 0x36, 0x36, 0x5f, 0x7a, 0x01, 0xcf, 0xc0, 0xc0, 0x00, 0x00, 0x02, 0x00, 0x3c,
-    0xff, 0xec, 0x03, 0xee, 0x04, 0x3a, 0x00, 0x03, 0x00, 0x15, 0x00, 0x15, 0x40, 0x0a, 0x05, 0x0a,
-    0x11, 0x02, 0x03, 0x06, 0x72, 0x11, 0x0b, 0x72, 0x00, 0x2b, 0x2b, 0x32, 0x11, 0x33, 0x32, 0x30,
-    0x31, 0x41, 0x15, 0x21, 0x35, 0x21, 0x33, 0x11, 0x14, 0x16, 0x16, 0x33, 0x32, 0x36, 0x37, 0x17,
-    0x06, 0x06, 0x23, 0x22, 0x26, 0x26, 0x35, 0x03, 0xee, 0xfc, 0x4e, 0x01, 0x54, 0xf1, 0x19, 0x2d,
-    0x1d, 0x1f, 0x2c, 0x15, 0x22, 0x2f, 0x56, 0x32, 0x5a, 0x80, 0x45, 0x04, 0x3a, 0xbe, 0xbe, 0xfc,
-    0xf2, 0x31, 0x37, 0x15, 0x0d, 0x08, 0xae, 0x1a, 0x10, 0x44, 0x90, 0x72, 0x00, 0x01, 0x00, 0x7f,
-    0xff, 0xeb, 0x04, 0x04, 0x04, 0x3a, 0x00, 0x1e, 0x00, 0x13, 0x40, 0x09, 0x10, 0x07, 0x19, 0x00,
-    0x06, 0x72, 0x19, 0x0b, 0x72, 0x00, 0x2b, 0x2b, 0x11, 0x33, 0x32, 0x30, 0x31, 0x53, 0x33, 0x11,
-    0x14, 0x1e, 0x02, 0x33, 0x32, 0x3e, 0x02, 0x35, 0x26, 0x02, 0x27, 0x33, 0x1e, 0x02, 0x15, 0x14,
-    0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x7f, 0xf2, 0x18, 0x2c, 0x3b, 0x22, 0x3f, 0x60, 0x41,
-    0x21, 0x02, 0x3e, 0x2f, 0xee, 0x1e, 0x34, 0x20, 0x3a, 0x78, 0xb8, 0x7f, 0x5e, 0x98, 0x6c, 0x3a,
-    0x04, 0x3a, 0xfd, 0x6a, 0x44, 0x61, 0x3a, 0x1a, 0x44, 0x72, 0x8c, 0x46, 0x87, 0x01, 0x05, 0x7b,
-    0x3e, 0x9c, 0xbd, 0x6f, 0x77, 0xd4, 0xa2, 0x5c, 0x34, 0x6c, 0xa8, 0x73, 0x00, 0x01, 0x00, 0x46,
-    0xfe, 0x22, 0x05, 0x85, 0x04, 0x42, 0x00, 0x2f, 0x00, 0x19, 0x40, 0x0c, 0x2b, 0x05, 0x05, 0x19,
-    0x18, 0x06, 0x72, 0x22, 0x0f, 0x0b, 0x72, 0x00, 0x00, 0x2f, 0x2b, 0x32, 0x2b, 0x32, 0x32, 0x11,
-    0x33, 0x30, 0x31, 0x41, 0x11, 0x34, 0x36, 0x36, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x14, 0x06, 0x06,
-    0x04, 0x23, 0x22, 0x24, 0x26, 0x26, 0x35, 0x34, 0x36, 0x36, 0x37, 0x17, 0x0e, 0x02, 0x07, 0x14,
-    0x1e, 0x02, 0x33, 0x32, 0x36, 0x36, 0x35, 0x34, 0x2e, 0x02, 0x23, 0x22, 0x06, 0x15, 0x11, 0x02,
-    0x68, 0x4a, 0x7e, 0x50, 0x79, 0xbf, 0x86, 0x47, 0x48, 0x9d, 0xfe, 0xff, 0xbb, 0xba, 0xfe, 0xff,
-    0x9c, 0x47, 0x3a, 0x6c, 0x49, 0x99, 0x32, 0x42, 0x21, 0x02, 0x2b, 0x63, 0xa5, 0x7a, 0xa3, 0xbb,
-    0x51, 0x23, 0x40, 0x5f, 0x3e, 0x21, 0x19, 0xfe, 0x22, 0x05, 0x1c, 0x4e, 0x74, 0x42, 0x57, 0x97,
-    0xc2, 0x6a, 0x6f, 0xcd, 0xa3, 0x5e, 0x62, 0xa9, 0xd8, 0x76, 0x6e, 0xbe, 0x9b, 0x36, 0x8e, 0x31,
-    0x7a, 0x84, 0x40, 0x50, 0x93, 0x73, 0x43, 0x6e, 0xaf, 0x60, 0x46, 0x7d, 0x60, 0x37, 0x27, 0x16,
-    0xfa, 0xdd, 0x00, 0x02, 0x00, 0x52, 0xfe, 0x25, 0x05, 0x7f, 0x04, 0x3a, 0x00, 0x1e, 0x00, 0x22,
-    0x00, 0x15, 0x40, 0x0a, 0x21, 0x07, 0x19, 0x0b, 0x72, 0x20, 0x10, 0x00, 0x06, 0x72, 0x00, 0x2b,
-    0x32, 0x32, 0x2b, 0x32, 0x2f, 0x30, 0x31, 0x53, 0x33, 0x11, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x3e,
-    0x02, 0x35, 0x26, 0x26, 0x27, 0x33, 0x1e, 0x02, 0x15, 0x14, 0x06, 0x06, 0x04, 0x23, 0x22, 0x2e,
-    0x02, 0x35, 0x01, 0x33, 0x11, 0x23, 0x52, 0xf1, 0x3f, 0x6f, 0x94, 0x56, 0x7a, 0xa8, 0x64, 0x2d,
-    0x02, 0x42, 0x31, 0xea, 0x21, 0x38, 0x23, 0x45, 0x9b, 0xff, 0x00, 0xbb, 0x95, 0xf3, 0xae, 0x5c,
-    0x02, 0x11, 0xf0, 0xf0, 0x04, 0x3a, 0xfe, 0x14, 0x75, 0xa2, 0x61, 0x2b, 0x43, 0x74, 0x94, 0x50,
-    0x82, 0xfb, 0x77, 0x3b, 0x97, 0xb6, 0x6c, 0x77, 0xd9, 0xa9, 0x62, 0x47, 0x95, 0xe9, 0xa1, 0x01,
-    0xe9, 0xf9, 0xeb, 0x00, 0x00, 0x02, 0x00, 0x65, 0xff, 0xeb, 0x06, 0x30, 0x04, 0x3a, 0x00, 0x1e,
-    0x00, 0x3f, 0x00, 0x19, 0x40, 0x0c, 0x01, 0x17, 0x0a, 0x0a, 0x29, 0x36, 0x1f, 0x06, 0x72, 0x36,
-    0x0b, 0x72, 0x00, 0x2b, 0x2b, 0x11, 0x33, 0x33, 0x11, 0x33, 0x32, 0x30, 0x31, 0x41, 0x33, 0x1e,
-    0x02, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x11, 0x33, 0x11, 0x14, 0x1e, 0x02,
-    0x33, 0x32, 0x3e, 0x02, 0x35, 0x26, 0x02, 0x25, 0x33, 0x06, 0x02, 0x07, 0x14, 0x1e, 0x03, 0x33,
-    0x32, 0x3e, 0x02, 0x35, 0x11, 0x33, 0x11, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x03, 0x35, 0x34,
-    0x36, 0x36, 0x04, 0xb3, 0xed, 0x27, 0x41, 0x28, 0x2c, 0x61, 0xa1, 0x74, 0x57, 0x8a, 0x62, 0x33,
-    0xb0, 0x1c, 0x34, 0x44, 0x28, 0x34, 0x47, 0x2c, 0x14, 0x04, 0x4c, 0xfc, 0x05, 0xee, 0x3b, 0x4d,
-    0x03, 0x0c, 0x1a, 0x2c, 0x3e, 0x29, 0x29, 0x45, 0x33, 0x1c, 0xb0, 0x33, 0x62, 0x8a, 0x57, 0x5d,
-    0x8b, 0x62, 0x3c, 0x1c, 0x28, 0x42, 0x04, 0x3a, 0x3e, 0x9d, 0xbc, 0x70, 0x77, 0xd3, 0xa2, 0x5c,
-    0x44, 0x84, 0xc0, 0x7d, 0x01, 0x37, 0xfe, 0xbb, 0x56, 0x76, 0x4a, 0x21, 0x40, 0x6d, 0x8d, 0x4e,
-    0x87, 0x01, 0x04, 0x7c, 0x7c, 0xfe, 0xfc, 0x87, 0x3e, 0x74, 0x62, 0x4b, 0x29, 0x21, 0x4a, 0x76,
-    0x56, 0x01, 0x45, 0xfe, 0xc9, 0x7d, 0xc0, 0x84, 0x44, 0x3c, 0x6c, 0x93, 0xae, 0x5f, 0x70, 0xbc,
-    0x9d, 0x00, 0x00, 0x01, 0x00, 0x78, 0xff, 0xeb, 0x04, 0x9e, 0x05, 0xc6, 0x00, 0x38, 0x00, 0x1d,
-    0x40, 0x0d, 0x1d, 0x1e, 0x17, 0x36, 0x04, 0x04, 0x0d, 0x23, 0x17, 0x0b, 0x72, 0x2d, 0x0d, 0x00,
-    0x2f, 0x33, 0x2b, 0x32, 0x11, 0x39, 0x2f, 0x33, 0x10, 0xcc, 0x32, 0x30, 0x31, 0x41, 0x17, 0x06,
-    0x06, 0x23, 0x22, 0x24, 0x26, 0x35, 0x35, 0x34, 0x36, 0x36, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x11,
-    0x14, 0x06, 0x06, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x11, 0x37, 0x11, 0x14, 0x16, 0x16, 0x33, 0x32,
-    0x36, 0x36, 0x35, 0x11, 0x34, 0x2e, 0x02, 0x23, 0x22, 0x06, 0x06, 0x15, 0x15, 0x14, 0x16, 0x16,
-    0x33, 0x32, 0x36, 0x04, 0x94, 0x0a, 0x31, 0x80, 0x3c, 0xb2, 0xfe, 0xee, 0x9b, 0x5d, 0xa3, 0x69,
-    0x52, 0x83, 0x5d, 0x31, 0x74, 0xd1, 0x8c, 0x6a, 0xac, 0x7c, 0x43, 0xe9, 0x3b, 0x6d, 0x4c, 0x42,
-    0x5d, 0x32, 0x0f, 0x1d, 0x2b, 0x1d, 0x22, 0x36, 0x1f, 0x55, 0xa6, 0x7b, 0x3c, 0x76, 0x03, 0x1f,
-    0xc3, 0x10, 0x19, 0x87, 0xed, 0x96, 0x13, 0x76, 0xa7, 0x59, 0x35, 0x66, 0x94, 0x5e, 0xfd, 0x86,
-    0x92, 0xd2, 0x70, 0x44, 0x7d, 0xab, 0x68, 0x01, 0x21, 0x01, 0xfe, 0xde, 0x51, 0x79, 0x42, 0x3c,
-    0x78, 0x58, 0x02, 0x89, 0x2d, 0x42, 0x2c, 0x14, 0x20, 0x46, 0x39, 0x16, 0x58, 0x92, 0x57, 0x13,
-    0x00, 0x03, 0xff, 0xe1, 0x00, 0x00, 0x04, 0xab, 0x05, 0xc4, 0x00, 0x03, 0x00, 0x16, 0x00, 0x29,
-    0x00, 0x1e, 0x40, 0x0e, 0x10, 0x09, 0x09, 0x1f, 0x26, 0x03, 0x72, 0x1a, 0x18, 0x16, 0x03, 0x03,
-    0x02, 0x12, 0x00, 0x3f, 0x33, 0x11, 0x33, 0x33, 0x33, 0x2b, 0x32, 0x32, 0x11, 0x33, 0x30, 0x31,
-    0x41, 0x11, 0x23, 0x11, 0x37, 0x13, 0x3e, 0x02, 0x33, 0x32, 0x16, 0x17, 0x07, 0x26, 0x26, 0x23,
-    0x22, 0x06, 0x06, 0x07, 0x01, 0x27, 0x03, 0x13, 0x17, 0x07, 0x01, 0x2e, 0x02, 0x23, 0x22, 0x06,
-    0x07, 0x27, 0x36, 0x36, 0x33, 0x32, 0x16, 0x16, 0x02, 0xc2, 0xfb, 0x72, 0xd6, 0x21, 0x50, 0x63,
-    0x3f, 0x27, 0x43, 0x1f, 0x25, 0x04, 0x26, 0x0e, 0x17, 0x26, 0x1f, 0x0c, 0xfe, 0xcf, 0xa4, 0x93,
-    0xd8, 0x23, 0xa6, 0xfe, 0xd2, 0x0c, 0x21, 0x26, 0x16, 0x0e, 0x26, 0x04, 0x23, 0x1e, 0x42, 0x27,
-    0x3c, 0x64, 0x54, 0x02, 0xb7, 0xfd, 0x49, 0x02, 0xb7, 0x2a, 0x02, 0x0a, 0x51, 0x5e, 0x2a, 0x0e,
-    0x0c, 0xbe, 0x02, 0x04, 0x0f, 0x22, 0x1b, 0xfd, 0x50, 0x01, 0x02, 0xf9, 0xfd, 0xea, 0xe3, 0x01,
-    0x02, 0xb0, 0x1c, 0x21, 0x0f, 0x04, 0x02, 0xbd, 0x0d, 0x0e, 0x24, 0x5c, 0x00, 0x03, 0x00, 0x2b,
-    0xff, 0xeb, 0x06, 0x60, 0x04, 0x3a, 0x00, 0x03, 0x00, 0x24, 0x00, 0x45, 0x00, 0x21, 0x40, 0x10,
-    0x26, 0x05, 0x03, 0x1c, 0x0f, 0x2f, 0x3c, 0x0b, 0x72, 0x3c, 0x0f, 0x02, 0x03, 0x06, 0x72, 0x0f,
-    0x00, 0x2f, 0x2b, 0x32, 0x11, 0x39, 0x2b, 0x32, 0x11, 0x33, 0x11, 0x33, 0x33, 0x30, 0x31, 0x41,
-    0x15, 0x21, 0x35, 0x21, 0x33, 0x1e, 0x02, 0x15, 0x14, 0x0e, 0x03, 0x23, 0x22, 0x2e, 0x02, 0x35,
-    0x35, 0x33, 0x15, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x3e, 0x03, 0x35, 0x26, 0x02, 0x25, 0x33, 0x06,
-    0x02, 0x07, 0x14, 0x1e, 0x03, 0x33, 0x32, 0x3e, 0x02, 0x35, 0x35, 0x33, 0x15, 0x14, 0x0e, 0x02,
-    0x23, 0x22, 0x2e, 0x03, 0x35, 0x34, 0x36, 0x36, 0x06, 0x60, 0xf9, 0xcb, 0x04, 0x6f, 0xee, 0x26,
-    0x41, 0x28, 0x1b, 0x39, 0x5c, 0x84, 0x59, 0x58, 0x8d, 0x63, 0x35, 0xaf, 0x1e, 0x36, 0x47, 0x2a,
-    0x25, 0x37, 0x26, 0x18, 0x0b, 0x04, 0x4c, 0xfc, 0x21, 0xee, 0x3b, 0x4e, 0x03, 0x0b, 0x18, 0x26,
-    0x37, 0x24, 0x2a, 0x48, 0x35, 0x1e, 0xb0, 0x35, 0x63, 0x8e, 0x59, 0x58, 0x83, 0x5d, 0x39, 0x1b,
-    0x28, 0x42, 0x04, 0x3a, 0xb2, 0xb2, 0x3e, 0x9d, 0xbc, 0x70, 0x5f, 0xae, 0x93, 0x6c, 0x3c, 0x44,
-    0x84, 0xc0, 0x7d, 0xd4, 0xe2, 0x56, 0x76, 0x4a, 0x21, 0x29, 0x4a, 0x63, 0x74, 0x3e, 0x87, 0x01,
-    0x04, 0x7c, 0x7c, 0xfe, 0xfc, 0x87, 0x3e, 0x74, 0x62, 0x4b, 0x29, 0x21, 0x4a, 0x76, 0x56, 0xe2,
-    0xd4, 0x7d, 0xc0, 0x84, 0x44, 0x3c, 0x6c, 0x93, 0xae, 0x5f, 0x70, 0xbc, 0x9d, 0x00, 0x00, 0x03,
-    0x00, 0x24, 0xff, 0xf1, 0x05, 0xbb, 0x05, 0xb0, 0x00, 0x1b, 0x00, 0x1f, 0x00, 0x23, 0x00, 0x21,
-    0x40, 0x11, 0x1f, 0x23, 0x18, 0x05, 0x05, 0x0e, 0x22, 0x23, 0x1e, 0x08, 0x72, 0x23, 0x02, 0x72,
-    0x0e, 0x09, 0x72, 0x00, 0x2b, 0x2b, 0x2b, 0x11, 0x33, 0x12, 0x39, 0x2f, 0x33, 0x11, 0x33, 0x30,
-    0x31, 0x41, 0x35, 0x3e, 0x02, 0x33, 0x32, 0x16, 0x16, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x27, 0x32,
-    0x3e, 0x02, 0x37, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x13, 0x11, 0x23, 0x11, 0x21, 0x15,
-    0x21, 0x35, 0x02, 0x38, 0x36, 0x80, 0x83, 0x38, 0xa1, 0xee, 0x83, 0x3c, 0x7e, 0xc9, 0x8f, 0x01,
-    0x56, 0x6e, 0x3d, 0x17, 0x01, 0x43, 0x80, 0x5e, 0x43, 0x78, 0x72, 0x2d, 0xfa, 0x02, 0xeb, 0xfb,
-    0x93, 0x02, 0x6e, 0xca, 0x13, 0x1f, 0x13, 0x66, 0xcb, 0x96, 0x5e, 0xa4, 0x7c, 0x47, 0xbd, 0x2a,
-    0x48, 0x5c, 0x31, 0x52, 0x74, 0x3e, 0x0f, 0x1e, 0x03, 0x2c, 0xfa, 0x50, 0x05, 0xb0, 0xc8, 0xc8,
-    0x00, 0x02, 0x00, 0x67, 0xff, 0xec, 0x04, 0xee, 0x05, 0xc4, 0x00, 0x03, 0x00, 0x2c, 0x00, 0x1d,
-    0x40, 0x0e, 0x03, 0x02, 0x02, 0x09, 0x1d, 0x19, 0x14, 0x03, 0x72, 0x29, 0x04, 0x09, 0x09, 0x72,
-    0x00, 0x2b, 0xcc, 0x33, 0x2b, 0xcc, 0x33, 0x12, 0x39, 0x2f, 0x33, 0x30, 0x31, 0x41, 0x15, 0x21,
-    0x35, 0x01, 0x33, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x35, 0x34, 0x3e, 0x02, 0x33, 0x32,
-    0x16, 0x16, 0x17, 0x23, 0x2e, 0x02, 0x23, 0x22, 0x0e, 0x02, 0x15, 0x15, 0x14, 0x1e, 0x03, 0x33,
-    0x32, 0x36, 0x36, 0x03, 0x59, 0xfd, 0xae, 0x02, 0xea, 0xfc, 0x0c, 0x89, 0xf6, 0xb0, 0x87, 0xd9,
-    0x99, 0x52, 0x53, 0x9c, 0xdc, 0x89, 0xaf, 0xef, 0x86, 0x0f, 0xfb, 0x0a, 0x43, 0x81, 0x6a, 0x55,
-    0x81, 0x57, 0x2c, 0x1a, 0x33, 0x50, 0x6d, 0x46, 0x6b, 0x85, 0x45, 0x03, 0x40, 0xc7, 0xc7, 0xfe,
-    0x9a, 0x8f, 0xe0, 0x7f, 0x60, 0xb4, 0xfe, 0x9d, 0x78, 0x9d, 0xfe, 0xb5, 0x61, 0x80, 0xe2, 0x93,
-    0x5f, 0x87, 0x47, 0x41, 0x7d, 0xb5, 0x74, 0x7a, 0x59, 0x96, 0x79, 0x55, 0x2c, 0x44, 0x84, 0x00,
-    0x00, 0x03, 0x00, 0x2d, 0x00, 0x00, 0x08, 0x38, 0x05, 0xb0, 0x00, 0x11, 0x00, 0x15, 0x00, 0x2e,
-    0x00, 0x27, 0x40, 0x13, 0x24, 0x21, 0x21, 0x09, 0x2e, 0x16, 0x16, 0x00, 0x0a, 0x09, 0x08, 0x72,
-    0x14, 0x15, 0x15, 0x23, 0x00, 0x02, 0x72, 0x00, 0x2b, 0x32, 0x32, 0x11, 0x33, 0x2b, 0x32, 0x12,
-    0x39, 0x2f, 0x33, 0x11, 0x33, 0x11, 0x33, 0x30, 0x31, 0x41, 0x33, 0x03, 0x0e, 0x04, 0x23, 0x23,
-    0x35, 0x37, 0x3e, 0x04, 0x37, 0x01, 0x15, 0x21, 0x35, 0x01, 0x21, 0x32, 0x16, 0x16, 0x15, 0x14,
-    0x0e, 0x02, 0x23, 0x21, 0x11, 0x33, 0x11, 0x21, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23,
-    0x21, 0x01, 0x64, 0xfa, 0x23, 0x08, 0x27, 0x45, 0x68, 0x91, 0x61, 0x40, 0x27, 0x35, 0x4d, 0x37,
-    0x23, 0x15, 0x05, 0x03, 0x00, 0xfd, 0x4c, 0x03, 0x26, 0x01, 0x6e, 0xa6, 0xeb, 0x7d, 0x47, 0x87,
-    0xc3, 0x7d, 0xfd, 0xe5, 0xfb, 0x01, 0x20, 0x5f, 0x7b, 0x3a, 0x3a, 0x7b, 0x5f, 0xfe, 0x92, 0x05,
-    0xb0, 0xfd, 0x2d, 0x9f, 0xf2, 0xac, 0x6d, 0x33, 0xc7, 0x03, 0x04, 0x2b, 0x55, 0x88, 0xc4, 0x83,
-    0x02, 0x93, 0xc8, 0xc8, 0xfd, 0xee, 0x78, 0xd2, 0x85, 0x64, 0xa9, 0x7d, 0x45, 0x05, 0xb0, 0xfb,
-    0x17, 0x4c, 0x79, 0x45, 0x43, 0x78, 0x4b, 0x00, 0x00, 0x03, 0x00, 0x99, 0x00, 0x00, 0x08, 0x42,
-    0x05, 0xb0, 0x00, 0x03, 0x00, 0x07, 0x00, 0x20, 0x00, 0x23, 0x40, 0x11, 0x08, 0x20, 0x20, 0x03,
-    0x02, 0x02, 0x06, 0x15, 0x07, 0x02, 0x72, 0x16, 0x13, 0x13, 0x06, 0x08, 0x72, 0x00, 0x2b, 0x32,
-    0x11, 0x33, 0x2b, 0x32, 0x11, 0x39, 0x2f, 0x33, 0x33, 0x2f, 0x33, 0x30, 0x31, 0x41, 0x15, 0x21,
-    0x35, 0x13, 0x11, 0x23, 0x11, 0x01, 0x21, 0x32, 0x16, 0x16, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x21,
-    0x11, 0x33, 0x11, 0x21, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x21, 0x04, 0x54, 0xfd,
-    0x01, 0x3e, 0xfa, 0x04, 0x2e, 0x01, 0x6d, 0xa6, 0xeb, 0x7d, 0x47, 0x88, 0xc2, 0x7d, 0xfd, 0xe5,
-    0xfa, 0x01, 0x21, 0x5f, 0x7b, 0x3a, 0x3a, 0x7b, 0x5f, 0xfe, 0x93, 0x03, 0x41, 0xc6, 0xc6, 0x02,
-    0x6f, 0xfa, 0x50, 0x05, 0xb0, 0xfd, 0xd4, 0x74, 0xc8, 0x83, 0x63, 0xa5, 0x7a, 0x43, 0x05, 0xb0,
-    0xfb, 0x1b, 0x47, 0x73, 0x42, 0x41, 0x70, 0x45, 0x00, 0x03, 0x00, 0x2d, 0x00, 0x00, 0x05, 0xc3,
-    0x05, 0xb0, 0x00, 0x15, 0x00, 0x19, 0x00, 0x1d, 0x00, 0x1d, 0x40, 0x0e, 0x19, 0x01, 0x18, 0x06,
-    0x11, 0x11, 0x18, 0x1c, 0x1d, 0x02, 0x72, 0x18, 0x08, 0x72, 0x00, 0x2b, 0x2b, 0x32, 0x11, 0x39,
-    0x2f, 0x33, 0x11, 0x33, 0x32, 0x30, 0x31, 0x61, 0x23, 0x11, 0x34, 0x26, 0x26, 0x23, 0x22, 0x0e,
-    0x02, 0x07, 0x35, 0x3e, 0x03, 0x33, 0x32, 0x16, 0x16, 0x15, 0x01, 0x11, 0x23, 0x11, 0x21, 0x15,
-    0x21, 0x35, 0x05, 0xc3, 0xfa, 0x3f, 0x7f, 0x5f, 0x2e, 0x66, 0x68, 0x60, 0x28, 0x28, 0x5c, 0x65,
-    0x68, 0x33, 0xa5, 0xf0, 0x82, 0xfc, 0xdb, 0xfb, 0x02, 0xea, 0xfb, 0xa0, 0x01, 0xc4, 0x67, 0x74,
-    0x30, 0x08, 0x0f, 0x15, 0x0d, 0xc8, 0x0c, 0x15, 0x0f, 0x08, 0x5f, 0xcd, 0xa6, 0x03, 0xec, 0xfa,
-    0x50, 0x05, 0xb0, 0xc8, 0xc8, 0x00, 0x00, 0x02, 0x00, 0x8f, 0xfe, 0x99, 0x05, 0x0b, 0x05, 0xb0,
-    0x00, 0x07, 0x00, 0x0b, 0x00, 0x17, 0x40, 0x0b, 0x09, 0x06, 0x01, 0x02, 0x72, 0x0b, 0x03, 0x03,
-    0x00, 0x08, 0x72, 0x00, 0x2b, 0x32, 0x12, 0x39, 0x2b, 0x32, 0x2f, 0x30, 0x31, 0x73, 0x11, 0x33,
-    0x11, 0x21, 0x11, 0x33, 0x11, 0x25, 0x11, 0x23, 0x11, 0x8f, 0xfb, 0x02, 0x86, 0xfb, 0xfe, 0x4a,
-    0xfb, 0x05, 0xb0, 0xfb, 0x17, 0x04, 0xe9, 0xfa, 0x50, 0xbb, 0xfd, 0xde, 0x02, 0x22, 0x00, 0x02,
-    0x00, 0x90, 0x00, 0x00, 0x04, 0xba, 0x05, 0xb0, 0x00, 0x05, 0x00, 0x1e, 0x00, 0x21, 0x40, 0x10,
-    0x06, 0x1e, 0x1e, 0x04, 0x02, 0x13, 0x13, 0x05, 0x02, 0x72, 0x14, 0x11, 0x11, 0x04, 0x08, 0x72,
-    0x00, 0x2b, 0x32, 0x11, 0x33, 0x2b, 0x32, 0x11, 0x33, 0x11, 0x39, 0x2f, 0x33, 0x30, 0x31, 0x41,
-    0x15, 0x21, 0x11, 0x23, 0x11, 0x13, 0x21, 0x32, 0x16, 0x16, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x21,
-    0x11, 0x33, 0x11, 0x21, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x21, 0x04, 0x2f, 0xfd,
-    0x5b, 0xfa, 0xae, 0x01, 0x6e, 0xa6, 0xec, 0x7c, 0x46, 0x88, 0xc3, 0x7d, 0xfd, 0xe4, 0xfc, 0x01,
-    0x20, 0x5f, 0x7a, 0x3b, 0x3b, 0x7a, 0x5f, 0xfe, 0x92, 0x05, 0xb0, 0xc8, 0xfb, 0x18, 0x05, 0xb0,
-    0xfd, 0xd1, 0x6f, 0xc8, 0x85, 0x64, 0xa6, 0x79, 0x42, 0x05, 0xb0, 0xfb, 0x17, 0x47, 0x74, 0x45,
-    0x43, 0x6e, 0x42, 0x00, 0x00, 0x06, 0x00, 0x26, 0xfe, 0x9a, 0x05, 0xd4, 0x05, 0xb0, 0x00, 0x03,
-    0x00, 0x07, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x25, 0x00, 0x27, 0x40, 0x13, 0x0b, 0x11,
-    0x11, 0x20, 0x03, 0x03, 0x07, 0x1e, 0x08, 0x72, 0x0e, 0x0f, 0x0f, 0x10, 0x14, 0x02, 0x72, 0x09,
-    0x05, 0x00, 0x2f, 0x33, 0x2b, 0x32, 0x32, 0x11, 0x33, 0x2b, 0x32, 0x32, 0x11, 0x33, 0x32, 0x11,
-    0x33, 0x30, 0x31, 0x65, 0x15, 0x21, 0x35, 0x33, 0x11, 0x23, 0x03, 0x21, 0x03, 0x23, 0x11, 0x03,
-    0x15, 0x21, 0x35, 0x21, 0x11, 0x23, 0x11, 0x21, 0x33, 0x03, 0x0e, 0x05, 0x07, 0x23, 0x35, 0x33,
-    0x3e, 0x03, 0x37, 0x05, 0x12, 0xfb, 0xcf, 0x3e, 0xf0, 0x09, 0x05, 0xae, 0x0f, 0xec, 0x77, 0xfd,
-    0x60, 0x03, 0x60, 0xfa, 0xfd, 0x68, 0xfb, 0x23, 0x08, 0x2a, 0x3b, 0x4a, 0x54, 0x57, 0x2a, 0x86,
-    0x41, 0x1b, 0x42, 0x3f, 0x30, 0x09, 0xc7, 0xc7, 0xc7, 0xfd, 0xd3, 0x02, 0x2d, 0xfd, 0xd4, 0x02,
-    0x2c, 0x04, 0xe9, 0xc8, 0xc8, 0xfa, 0x50, 0x05, 0xb0, 0xfd, 0xb2, 0x8c, 0xe0, 0xb1, 0x87, 0x62,
-    0x45, 0x17, 0xc7, 0x19, 0x5f, 0x9b, 0xe6, 0xa2, 0x00, 0x05, 0x00, 0x15, 0x00, 0x00, 0x07, 0xa2,
-    0x05, 0xb0, 0x00, 0x05, 0x00, 0x09, 0x00, 0x0d, 0x00, 0x13, 0x00, 0x17, 0x00, 0x27, 0x40, 0x13,
-    0x16, 0x11, 0x09, 0x03, 0x03, 0x00, 0x00, 0x0f, 0x0f, 0x14, 0x0c, 0x08, 0x08, 0x72, 0x0e, 0x0a,
-    0x01, 0x02, 0x72, 0x00, 0x2b, 0x32, 0x32, 0x2b, 0x32, 0x32, 0x32, 0x2f, 0x33, 0x11, 0x33, 0x11,
-    0x33, 0x33, 0x33, 0x30, 0x31, 0x41, 0x01, 0x21, 0x01, 0x21, 0x07, 0x27, 0x01, 0x21, 0x01, 0x01,
-    0x11, 0x23, 0x11, 0x21, 0x01, 0x21, 0x27, 0x21, 0x01, 0x13, 0x01, 0x37, 0x01, 0x02, 0x4e, 0xfd,
-    0xe5, 0x01, 0x31, 0x01, 0x63, 0x01, 0x06, 0x23, 0xdf, 0xfe, 0x82, 0xfe, 0xc8, 0x01, 0xfb, 0x02,
-    0x4e, 0xfa, 0x04, 0x21, 0xfd, 0xe9, 0xfe, 0xa9, 0x23, 0x01, 0x01, 0x01, 0x5e, 0x17, 0xfe, 0x88,
-    0xbc, 0x01, 0xf4, 0x02, 0x76, 0x03, 0x3a, 0xfd, 0x9f, 0xd9, 0x20, 0xfd, 0x6a, 0x03, 0x40, 0x02,
-    0x70, 0xfa, 0x50, 0x05, 0xb0, 0xfc, 0xc6, 0xd9, 0x02, 0x61, 0xfa, 0x50, 0x02, 0x96, 0xaa, 0xfc,
-    0xc0, 0x00, 0x00, 0x02, 0x00, 0x49, 0xff, 0xec, 0x04, 0x82, 0x05, 0xc4, 0x00, 0x1e, 0x00, 0x3e,
-    0x00, 0x23, 0x40, 0x11, 0x00, 0x20, 0x02, 0x02, 0x3e, 0x3e, 0x15, 0x34, 0x30, 0x2a, 0x09, 0x72,
-    0x0f, 0x0b, 0x15, 0x03, 0x72, 0x00, 0x2b, 0x32, 0xcc, 0x2b, 0xcc, 0x33, 0x12, 0x39, 0x2f, 0x33,
-    0x12, 0x39, 0x39, 0x30, 0x31, 0x41, 0x23, 0x35, 0x33, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26,
-    0x23, 0x22, 0x06, 0x06, 0x15, 0x23, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x14, 0x0e,
-    0x02, 0x25, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x33,
-    0x14, 0x16, 0x16, 0x33, 0x32, 0x36, 0x36, 0x35, 0x34, 0x2e, 0x02, 0x23, 0x23, 0x02, 0x87, 0xca,
-    0xae, 0x5d, 0x74, 0x35, 0x3b, 0x7a, 0x60, 0x48, 0x76, 0x45, 0xfb, 0x51, 0x8d, 0xb9, 0x67, 0x78,
-    0xc2, 0x8c, 0x4a, 0x45, 0x80, 0xb3, 0xfe, 0xc9, 0xca, 0x79, 0xbc, 0x82, 0x44, 0x51, 0x94, 0xc9,
-    0x78, 0x61, 0xbd, 0x99, 0x5c, 0xfc, 0x47, 0x7d, 0x53, 0x5f, 0x85, 0x47, 0x25, 0x48, 0x6a, 0x45,
-    0xae, 0x02, 0xba, 0x8f, 0x37, 0x63, 0x42, 0x3b, 0x62, 0x3b, 0x34, 0x5e, 0x40, 0x5f, 0x97, 0x6a,
-    0x39, 0x35, 0x68, 0x9b, 0x66, 0x4b, 0x84, 0x64, 0x39, 0x57, 0x32, 0x60, 0x8d, 0x5b, 0x66, 0x9f,
-    0x6e, 0x38, 0x31, 0x67, 0xa0, 0x70, 0x3e, 0x67, 0x3d, 0x3c, 0x68, 0x41, 0x3e, 0x5b, 0x39, 0x1c,
-    0x00, 0x01, 0x00, 0x92, 0x00, 0x00, 0x05, 0x0d, 0x05, 0xb0, 0x00, 0x09, 0x00, 0x17, 0x40, 0x0b,
-    0x05, 0x00, 0x06, 0x02, 0x08, 0x02, 0x72, 0x04, 0x06, 0x08, 0x72, 0x00, 0x2b, 0x32, 0x2b, 0x32,
-    0x12, 0x39, 0x39, 0x30, 0x31, 0x41, 0x01, 0x33, 0x11, 0x23, 0x11, 0x01, 0x23, 0x11, 0x33, 0x01,
-    0x8c, 0x02, 0x86, 0xfb, 0xfb, 0xfd, 0x7a, 0xfa, 0xfa, 0x01, 0x99, 0x04, 0x17, 0xfa, 0x50, 0x04,
-    0x18, 0xfb, 0xe8, 0x05, 0xb0, 0x00, 0x00, 0x03, 0x00, 0x2c, 0x00, 0x00, 0x05, 0x0f, 0x05, 0xb0,
-    0x00, 0x03, 0x00, 0x07, 0x00, 0x19, 0x00, 0x19, 0x40, 0x0c, 0x12, 0x05, 0x11, 0x08, 0x72, 0x02,
-    0x03, 0x03, 0x04, 0x08, 0x02, 0x72, 0x00, 0x2b, 0x32, 0x32, 0x11, 0x33, 0x2b, 0x32, 0x32, 0x30,
-    0x31, 0x41, 0x15, 0x21, 0x35, 0x21, 0x11, 0x23, 0x11, 0x21, 0x33, 0x03, 0x0e, 0x04, 0x23, 0x23,
-    0x35, 0x37, 0x3e, 0x04, 0x37, 0x04, 0x4f, 0xfd, 0x46, 0x03, 0x7a, 0xfb, 0xfd, 0x4f, 0xf9, 0x23,
-    0x07, 0x28, 0x44, 0x68, 0x91, 0x61, 0x40, 0x27, 0x35, 0x4d, 0x36, 0x24, 0x15, 0x05, 0x05, 0xb0,
-    0xc8, 0xc8, 0xfa, 0x50, 0x05, 0xb0, 0xfd, 0x2d, 0x9f, 0xf2, 0xac, 0x6d, 0x33, 0xc7, 0x03, 0x04,
-    0x2b, 0x55, 0x88, 0xc4, 0x83, 0x00, 0x00, 0x02, 0x00, 0x32, 0xff, 0xeb, 0x04, 0xe1, 0x05, 0xb0,
-    0x00, 0x13, 0x00, 0x18, 0x00, 0x1a, 0x40, 0x0e, 0x17, 0x16, 0x00, 0x15, 0x04, 0x08, 0x02, 0x18,
-    0x02, 0x72, 0x0f, 0x08, 0x09, 0x72, 0x00, 0x2b, 0x32, 0x2b, 0x32, 0x12, 0x17, 0x39, 0x30, 0x31,
-    0x41, 0x01, 0x21, 0x01, 0x0e, 0x03, 0x23, 0x22, 0x26, 0x27, 0x37, 0x16, 0x16, 0x33, 0x32, 0x36,
-    0x36, 0x37, 0x03, 0x01, 0x13, 0x07, 0x01, 0x02, 0x5a, 0x01, 0x72, 0x01, 0x15, 0xfe, 0x06, 0x18,
-    0x3d, 0x56, 0x7a, 0x57, 0x17, 0x41, 0x0f, 0x02, 0x0c, 0x39, 0x0d, 0x3a, 0x44, 0x29, 0x10, 0xcb,
-    0x01, 0x6e, 0x48, 0xc3, 0xfd, 0xfb, 0x01, 0xfb, 0x03, 0xb5, 0xfb, 0x58, 0x37, 0x67, 0x50, 0x2f,
-    0x04, 0x02, 0xc5, 0x02, 0x02, 0x27, 0x43, 0x28, 0x04, 0x6c, 0xfc, 0xda, 0xfe, 0xfa, 0x07, 0x04,
-    0x33, 0x00, 0x00, 0x03, 0x00, 0x4e, 0xff, 0xc4, 0x06, 0x18, 0x05, 0xec, 0x00, 0x15, 0x00, 0x29,
-    0x00, 0x2d, 0x00, 0x1b, 0x40, 0x0c, 0x1f, 0x0c, 0x0c, 0x2b, 0x16, 0x00, 0x00, 0x2b, 0x2a, 0x03,
-    0x72, 0x2b, 0x00, 0x2f, 0x2b, 0x11, 0x39, 0x2f, 0x33, 0x11, 0x39, 0x2f, 0x33, 0x30, 0x31, 0x41,
-    0x21, 0x32, 0x1e, 0x02, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x21, 0x22, 0x2e, 0x02, 0x35, 0x34, 0x3e,
-    0x02, 0x17, 0x22, 0x06, 0x06, 0x15, 0x14, 0x1e, 0x02, 0x33, 0x21, 0x32, 0x36, 0x36, 0x35, 0x34,
-    0x2e, 0x02, 0x23, 0x03, 0x11, 0x23, 0x11, 0x02, 0xa4, 0x01, 0x1e, 0x81, 0xd9, 0xa2, 0x5a, 0x5a,
-    0xa2, 0xd9, 0x81, 0xfe, 0xe2, 0x80, 0xda, 0xa3, 0x59, 0x59, 0xa3, 0xda, 0x80, 0x70, 0xa2, 0x57,
-    0x32, 0x5e, 0x86, 0x53, 0x01, 0x20, 0x6f, 0xa0, 0x57, 0x31, 0x5d, 0x84, 0x54, 0x18, 0xf1, 0x05,
-    0x27, 0x56, 0x9d, 0xdb, 0x86, 0x84, 0xda, 0x9d, 0x54, 0x54, 0x9c, 0xd9, 0x84, 0x86, 0xdb, 0x9f,
-    0x56, 0xc8, 0x5f, 0xb2, 0x7d, 0x5c, 0x90, 0x64, 0x36, 0x5f, 0xb0, 0x79, 0x5d, 0x93, 0x66, 0x36,
-    0x01, 0x8d, 0xf9, 0xd8, 0x06, 0x28, 0x00, 0x02, 0x00, 0x8e, 0xfe, 0xa1, 0x05, 0xbd, 0x05, 0xb0,
-    0x00, 0x05, 0x00, 0x0d, 0x00, 0x19, 0x40, 0x0c, 0x0c, 0x07, 0x02, 0x72, 0x05, 0x04, 0x04, 0x09,
-    0x06, 0x08, 0x72, 0x01, 0x00, 0x2f, 0x2b, 0x32, 0x32, 0x11, 0x33, 0x2b, 0x32, 0x30, 0x31, 0x65,
-    0x03, 0x23, 0x11, 0x23, 0x35, 0x05, 0x11, 0x33, 0x11, 0x21, 0x11, 0x33, 0x11, 0x05, 0xbd, 0x13,
-    0xe7, 0x82, 0xfc, 0x4d, 0xfc, 0x02, 0x85, 0xfc, 0xc9, 0xfd, 0xd8, 0x01, 0x5f, 0xc9, 0xc9, 0x05,
-    0xb0, 0xfb, 0x17, 0x04, 0xe9, 0xfa, 0x50, 0x00, 0x00, 0x02, 0x00, 0x91, 0x00, 0x00, 0x04, 0xed,
-    0x05, 0xb0, 0x00, 0x15, 0x00, 0x19, 0x00, 0x17, 0x40, 0x0b, 0x17, 0x06, 0x11, 0x11, 0x18, 0x00,
-    0x02, 0x72, 0x18, 0x08, 0x72, 0x00, 0x2b, 0x2b, 0x11, 0x39, 0x2f, 0x33, 0x32, 0x30, 0x31, 0x53,
-    0x33, 0x11, 0x14, 0x16, 0x16, 0x33, 0x32, 0x3e, 0x02, 0x37, 0x15, 0x0e, 0x03, 0x23, 0x22, 0x26,
-    0x26, 0x35, 0x01, 0x33, 0x11, 0x23, 0x91, 0xfb, 0x3e, 0x7f, 0x5f, 0x2e, 0x66, 0x67, 0x60, 0x28,
-    0x27, 0x5d, 0x64, 0x68, 0x33, 0xa5, 0xf0, 0x82, 0x03, 0x61, 0xfb, 0xfb, 0x05, 0xb0, 0xfe, 0x3d,
-    0x67, 0x75, 0x30, 0x08, 0x0f, 0x15, 0x0d, 0xc7, 0x0c, 0x16, 0x0f, 0x08, 0x5f, 0xce, 0xa6, 0x01,
-    0xc3, 0xfa, 0x50, 0x00, 0x00, 0x01, 0x00, 0x95, 0x00, 0x00, 0x07, 0x05, 0x05, 0xb0, 0x00, 0x0b,
-    0x00, 0x19, 0x40, 0x0c, 0x05, 0x09, 0x06, 0x02, 0x02, 0x0b, 0x00, 0x02, 0x72, 0x0b, 0x08, 0x72,
-    0x00, 0x2b, 0x2b, 0x11, 0x33, 0x11, 0x33, 0x32, 0x32, 0x30, 0x31, 0x53, 0x33, 0x11, 0x21, 0x11,
-    0x33, 0x11, 0x21, 0x11, 0x33, 0x11, 0x21, 0x95, 0xfc, 0x01, 0xc2, 0xfa, 0x01, 0xbe, 0xfa, 0xf9,
-    0x90, 0x05, 0xb0, 0xfb, 0x17, 0x04, 0xe9, 0xfb, 0x17, 0x04, 0xe9, 0xfa, 0x50, 0x00, 0x00, 0x02,
-    0x00, 0x95, 0xfe, 0xa1, 0x07, 0xb1, 0x05, 0xb0, 0x00, 0x05, 0x00, 0x11, 0x00, 0x1d, 0x40, 0x0e,
-    0x0c, 0x05, 0x08, 0x08, 0x04, 0x11, 0x08, 0x72, 0x0f, 0x0b, 0x06, 0x02, 0x72, 0x01, 0x00, 0x2f,
-    0x2b, 0x32, 0x32, 0x2b, 0x32, 0x32, 0x11, 0x33, 0x33, 0x30, 0x31, 0x65, 0x03, 0x23, 0x11, 0x23,
-    0x35, 0x01, 0x33, 0x11, 0x21, 0x11, 0x33, 0x11, 0x21, 0x11, 0x33, 0x11, 0x21, 0x07, 0xb1, 0x13,
-    0xdd, 0x82, 0xfa, 0x56, 0xfc, 0x01, 0xc2, 0xfa, 0x01, 0xbe, 0xfa, 0xf9, 0x90, 0xbf, 0xfd, 0xe2,
-    0x01, 0x5f, 0xbf, 0x04, 0xf1, 0xfb, 0x17, 0x04, 0xe9, 0xfb, 0x17, 0x04, 0xe9, 0xfa, 0x50, 0x00,
-    0x00, 0x02, 0x00, 0x15, 0x00, 0x00, 0x05, 0xd6, 0x05, 0xb0, 0x00, 0x03, 0x00, 0x1c, 0x00, 0x1d,
-    0x40, 0x0e, 0x11, 0x12, 0x0f, 0x04, 0x1c, 0x1c, 0x0f, 0x00, 0x01, 0x02, 0x72, 0x0f, 0x08, 0x72,
-    0x00, 0x2b, 0x2b, 0x32, 0x11, 0x39, 0x2f, 0x33, 0x11, 0x33, 0x32, 0x30, 0x31, 0x53, 0x35, 0x21,
-    0x15, 0x13, 0x21, 0x32, 0x16, 0x16, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x21, 0x11, 0x33, 0x11, 0x21,
-    0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x21, 0x15, 0x01, 0xec, 0x58, 0x01, 0x6e, 0xa6,
-    0xeb, 0x7e, 0x48, 0x88, 0xc3, 0x7c, 0xfd, 0xe5, 0xfb, 0x01, 0x20, 0x5f, 0x7a, 0x3b, 0x3b, 0x7a,
-    0x5f, 0xfe, 0x92, 0x04, 0xf0, 0xc0, 0xc0, 0xfe, 0x91, 0x6f, 0xc8, 0x85, 0x64, 0xa6, 0x79, 0x42,
-    0x05, 0xb0, 0xfb, 0x17, 0x47, 0x74, 0x45, 0x43, 0x6e, 0x42, 0x00, 0x02, 0x00, 0x99, 0x00, 0x00,
-    0x06, 0x54, 0x05, 0xb0, 0x00, 0x18, 0x00, 0x1c, 0x00, 0x1d, 0x40, 0x0e, 0x1a, 0x19, 0x0e, 0x0b,
-    0x00, 0x18, 0x18, 0x0b, 0x0c, 0x02, 0x72, 0x0b, 0x08, 0x72, 0x00, 0x2b, 0x2b, 0x11, 0x39, 0x2f,
-    0x33, 0x11, 0x33, 0x32, 0x33, 0x30, 0x31, 0x41, 0x21, 0x32, 0x16, 0x16, 0x15, 0x14, 0x0e, 0x02,
-    0x23, 0x21, 0x11, 0x33, 0x11, 0x21, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x21, 0x01,
-    0x11, 0x23, 0x11, 0x01, 0x46, 0x01, 0x6f, 0xa6, 0xeb, 0x7d, 0x47, 0x88, 0xc3, 0x7c, 0xfd, 0xe4,
-    0xfb, 0x01, 0x21, 0x5f, 0x7a, 0x3b, 0x3b, 0x7a, 0x5f, 0xfe, 0x91, 0x05, 0x0e, 0xfb, 0x03, 0x81,
-    0x6f, 0xc8, 0x85, 0x64, 0xa6, 0x79, 0x42, 0x05, 0xb0, 0xfb, 0x17, 0x47, 0x74, 0x45, 0x43, 0x6e,
-    0x42, 0x02, 0xf6, 0xfa, 0x50, 0x05, 0xb0, 0x00, 0x00, 0x01, 0x00, 0x90, 0x00, 0x00, 0x04, 0xba,
-    0x05, 0xb0, 0x00, 0x18, 0x00, 0x19, 0x40, 0x0c, 0x0e, 0x0b, 0x00, 0x18, 0x18, 0x0b, 0x0c, 0x02,
-    0x72, 0x0b, 0x08, 0x72, 0x00, 0x2b, 0x2b, 0x11, 0x39, 0x2f, 0x33, 0x11, 0x33, 0x30, 0x31, 0x41,
-    0x21, 0x32, 0x16, 0x16, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x21, 0x11, 0x33, 0x11, 0x21, 0x32, 0x36,
-    0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x21, 0x01, 0x3e, 0x01, 0x6e, 0xa6, 0xec, 0x7c, 0x46, 0x88,
-    0xc3, 0x7d, 0xfd, 0xe4, 0xfc, 0x01, 0x20, 0x5f, 0x7a, 0x3b, 0x3b, 0x7a, 0x5f, 0xfe, 0x92, 0x03,
-    0x81, 0x6f, 0xc8, 0x85, 0x64, 0xa6, 0x79, 0x42, 0x05, 0xb0, 0xfb, 0x17, 0x47, 0x74, 0x45, 0x43,
-    0x6e, 0x42, 0x00, 0x02, 0x00, 0x63, 0xff, 0xec, 0x04, 0xe8, 0x05, 0xc4, 0x00, 0x03, 0x00, 0x2c,
-    0x00, 0x1d, 0x40, 0x0e, 0x03, 0x02, 0x02, 0x1e, 0x09, 0x05, 0x29, 0x09, 0x72, 0x19, 0x15, 0x1e,
-    0x03, 0x72, 0x00, 0x2b, 0x32, 0xcc, 0x2b, 0xcc, 0x33, 0x12, 0x39, 0x2f, 0x33, 0x30, 0x31, 0x41,
-    0x15, 0x21, 0x35, 0x01, 0x33, 0x1e, 0x02, 0x33, 0x32, 0x3e, 0x02, 0x35, 0x35, 0x34, 0x2e, 0x03,
-    0x23, 0x22, 0x06, 0x06, 0x07, 0x23, 0x3e, 0x02, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x15, 0x14, 0x0e,
-    0x02, 0x23, 0x22, 0x26, 0x26, 0x04, 0x50, 0xfd, 0x9f, 0xfe, 0x75, 0xfa, 0x0b, 0x45, 0x85, 0x6c,
-    0x57, 0x7f, 0x52, 0x28, 0x1c, 0x39, 0x53, 0x6e, 0x44, 0x69, 0x82, 0x42, 0x0b, 0xfa, 0x0f, 0x86,
-    0xef, 0xae, 0x89, 0xdb, 0x9c, 0x53, 0x51, 0x9a, 0xd8, 0x86, 0xb1, 0xf5, 0x88, 0x03, 0x3b, 0xc8,
-    0xc8, 0xfe, 0x9f, 0x60, 0x84, 0x44, 0x46, 0x81, 0xb3, 0x6f, 0x7a, 0x5d, 0x99, 0x76, 0x51, 0x2a,
-    0x47, 0x87, 0x5f, 0x93, 0xe2, 0x80, 0x61, 0xb5, 0xfe, 0x9d, 0x78, 0x9d, 0xfe, 0xb4, 0x60, 0x7f,
-    0xe0, 0x00, 0x00, 0x04, 0x00, 0xa1, 0xff, 0xec, 0x07, 0x0c, 0x05, 0xc4, 0x00, 0x03, 0x00, 0x07,
-    0x00, 0x1d, 0x00, 0x33, 0x00, 0x23, 0x40, 0x13, 0x2f, 0x07, 0x06, 0x06, 0x0e, 0x24, 0x19, 0x03,
-    0x02, 0x72, 0x02, 0x08, 0x72, 0x19, 0x03, 0x72, 0x0e, 0x09, 0x72, 0x00, 0x2b, 0x2b, 0x2b, 0x2b,
-    0x11, 0x33, 0x12, 0x39, 0x2f, 0x33, 0x32, 0x30, 0x31, 0x41, 0x11, 0x23, 0x11, 0x01, 0x15, 0x21,
-    0x35, 0x05, 0x15, 0x14, 0x02, 0x06, 0x06, 0x23, 0x22, 0x26, 0x26, 0x02, 0x35, 0x35, 0x34, 0x12,
-    0x36, 0x36, 0x33, 0x32, 0x16, 0x16, 0x12, 0x07, 0x35, 0x34, 0x2e, 0x02, 0x23, 0x22, 0x0e, 0x02,
-    0x15, 0x15, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x3e, 0x02, 0x01, 0x9c, 0xfb, 0x02, 0x2b, 0xfe, 0x8a,
-    0x05, 0xb6, 0x56, 0xa0, 0xdd, 0x88, 0x85, 0xde, 0xa2, 0x58, 0x58, 0xa0, 0xde, 0x85, 0x88, 0xde,
-    0xa0, 0x57, 0xfb, 0x30, 0x5a, 0x84, 0x54, 0x52, 0x82, 0x5b, 0x30, 0x30, 0x5d, 0x82, 0x52, 0x55,
-    0x82, 0x5a, 0x2f, 0x05, 0xb0, 0xfa, 0x50, 0x05, 0xb0, 0xfd, 0x71, 0xc0, 0xc0, 0x21, 0x50, 0xa5,
-    0xfe, 0xfa, 0xb8, 0x61, 0x61, 0xb8, 0x01, 0x06, 0xa5, 0x50, 0xa5, 0x01, 0x05, 0xb9, 0x61, 0x61,
-    0xb9, 0xfe, 0xfb, 0xf5, 0x52, 0x7a, 0xbb, 0x7f, 0x41, 0x41, 0x7f, 0xbb, 0x7a, 0x52, 0x7a, 0xbc,
-    0x81, 0x41, 0x41, 0x81, 0xbc, 0x00, 0x00, 0x02, 0x00, 0x17, 0x00, 0x00, 0x04, 0x58, 0x05, 0xb0,
-    0x00, 0x16, 0x00, 0x1a, 0x00, 0x1f, 0x40, 0x0f, 0x17, 0x16, 0x16, 0x00, 0x00, 0x09, 0x0c, 0x0c,
-    0x19, 0x08, 0x72, 0x0e, 0x09, 0x02, 0x72, 0x00, 0x2b, 0x32, 0x2b, 0x32, 0x11, 0x12, 0x39, 0x2f,
-    0x33, 0x12, 0x39, 0x30, 0x31, 0x41, 0x21, 0x27, 0x26, 0x26, 0x35, 0x34, 0x36, 0x36, 0x33, 0x21,
-    0x11, 0x23, 0x11, 0x23, 0x22, 0x06, 0x15, 0x14, 0x16, 0x16, 0x33, 0x21, 0x05, 0x01, 0x21, 0x01,
-    0x03, 0xa9, 0xfe, 0x6f, 0x63, 0xa5, 0xb0, 0x80, 0xed, 0xa2, 0x01, 0xe9, 0xfc, 0xed, 0x8c, 0x88,
-    0x3d, 0x79, 0x5a, 0x01, 0x3e, 0xfe, 0xce, 0xfe, 0xae, 0xfe, 0xf2, 0x01, 0x56, 0x02, 0x22, 0x29,
-    0x34, 0xd4, 0xa1, 0x90, 0xc6, 0x66, 0xfa, 0x50, 0x04, 0xe8, 0x88, 0x78, 0x52, 0x75, 0x3f, 0x50,
-    0xfd, 0x6e, 0x02, 0x92, 0x00, 0x03, 0x00, 0x5a, 0xff, 0xeb, 0x04, 0x3f, 0x06, 0x14, 0x00, 0x16,
-    0x00, 0x2f, 0x00, 0x44, 0x00, 0x19, 0x40, 0x0c, 0x3a, 0x22, 0x30, 0x17, 0x17, 0x22, 0x00, 0x01,
-    0x72, 0x22, 0x0b, 0x72, 0x00, 0x2b, 0x2b, 0x11, 0x39, 0x2f, 0x33, 0x11, 0x33, 0x30, 0x31, 0x41,
-    0x33, 0x14, 0x0e, 0x02, 0x07, 0x0e, 0x03, 0x17, 0x15, 0x07, 0x35, 0x34, 0x12, 0x36, 0x36, 0x37,
-    0x3e, 0x02, 0x03, 0x32, 0x1e, 0x02, 0x15, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x35,
-    0x35, 0x26, 0x36, 0x36, 0x37, 0x3e, 0x02, 0x17, 0x22, 0x06, 0x06, 0x15, 0x15, 0x14, 0x1e, 0x02,
-    0x33, 0x32, 0x3e, 0x02, 0x35, 0x35, 0x34, 0x2e, 0x02, 0x03, 0x23, 0xc3, 0x31, 0x5f, 0x8b, 0x5b,
-    0x54, 0x87, 0x5b, 0x28, 0x08, 0xbf, 0x46, 0x81, 0xb3, 0x6e, 0x4b, 0x64, 0x31, 0xa9, 0x6c, 0xa8,
-    0x74, 0x3d, 0x42, 0x80, 0xb9, 0x77, 0x76, 0xba, 0x80, 0x42, 0x01, 0x19, 0x24, 0x0e, 0x32, 0x88,
-    0xaf, 0x3d, 0x5a, 0x71, 0x35, 0x1e, 0x3d, 0x63, 0x44, 0x45, 0x61, 0x3d, 0x1d, 0x1d, 0x3e, 0x62,
-    0x06, 0x14, 0x59, 0x73, 0x49, 0x2c, 0x12, 0x12, 0x4d, 0x89, 0xd6, 0x9a, 0x44, 0x11, 0x44, 0xbf,
-    0x01, 0x1c, 0xc3, 0x74, 0x16, 0x10, 0x21, 0x35, 0xfe, 0x17, 0x4b, 0x86, 0xb6, 0x6b, 0x16, 0x70,
-    0xbe, 0x8d, 0x4f, 0x52, 0x93, 0xc6, 0x75, 0x16, 0x15, 0x28, 0x2e, 0x1e, 0x65, 0x98, 0x56, 0xbf,
-    0x55, 0x8c, 0x52, 0x16, 0x43, 0x78, 0x5b, 0x34, 0x34, 0x5b, 0x78, 0x43, 0x16, 0x3e, 0x6e, 0x55,
-    0x32, 0x00, 0x00, 0x02, 0x00, 0x8f, 0x00, 0x00, 0x04, 0x38, 0x04, 0x3a, 0x00, 0x1b, 0x00, 0x33,
-    0x00, 0x2d, 0x40, 0x16, 0x02, 0x01, 0x1b, 0x2b, 0x29, 0x29, 0x28, 0x01, 0x28, 0x01, 0x28, 0x0f,
-    0x0d, 0x10, 0x06, 0x72, 0x1e, 0x1d, 0x1d, 0x0f, 0x0a, 0x72, 0x00, 0x2b, 0x32, 0x11, 0x33, 0x2b,
-    0x32, 0x11, 0x39, 0x39, 0x2f, 0x2f, 0x11, 0x33, 0x12, 0x39, 0x39, 0x11, 0x33, 0x30, 0x31, 0x41,
-    0x21, 0x27, 0x21, 0x32, 0x36, 0x36, 0x35, 0x34, 0x2e, 0x02, 0x23, 0x23, 0x11, 0x23, 0x11, 0x21,
-    0x32, 0x1e, 0x02, 0x15, 0x14, 0x0e, 0x02, 0x07, 0x03, 0x21, 0x37, 0x21, 0x32, 0x36, 0x36, 0x35,
-    0x34, 0x26, 0x26, 0x23, 0x21, 0x37, 0x21, 0x17, 0x1e, 0x02, 0x15, 0x14, 0x0e, 0x02, 0x02, 0x8a,
-    0xfe, 0xa6, 0x02, 0x01, 0x1c, 0x46, 0x5b, 0x2c, 0x1a, 0x35, 0x4f, 0x34, 0xc5, 0xf1, 0x01, 0xb6,
-    0x68, 0xa7, 0x76, 0x3f, 0x2b, 0x54, 0x7a, 0x4f, 0x37, 0xfe, 0x60, 0x60, 0x01, 0x40, 0x40, 0x54,
-    0x29, 0x28, 0x53, 0x42, 0xfe, 0xed, 0x02, 0x01, 0x47, 0x45, 0x67, 0x88, 0x44, 0x39, 0x6f, 0xa0,
-    0x01, 0xcf, 0xaa, 0x1c, 0x39, 0x29, 0x22, 0x33, 0x21, 0x0f, 0xfc, 0x84, 0x04, 0x3a, 0x24, 0x4a,
-    0x71, 0x4c, 0x32, 0x58, 0x44, 0x2b, 0x05, 0xfd, 0xef, 0xbe, 0x20, 0x3d, 0x2a, 0x2b, 0x3e, 0x21,
-    0xaa, 0x42, 0x07, 0x4a, 0x70, 0x42, 0x4c, 0x74, 0x4d, 0x27, 0x00, 0x01, 0x00, 0x83, 0x00, 0x00,
-    0x03, 0x4c, 0x04, 0x3a, 0x00, 0x05, 0x00, 0x0e, 0xb6, 0x02, 0x05, 0x06, 0x72, 0x04, 0x0a, 0x72,
-    0x00, 0x2b, 0x2b, 0x32, 0x30, 0x31, 0x41, 0x15, 0x21, 0x11, 0x23, 0x11, 0x03, 0x4c, 0xfe, 0x28,
-    0xf1, 0x04, 0x3a, 0xc0, 0xfc, 0x86, 0x04, 0x3a, 0x00, 0x03, 0x00, 0x27, 0xfe, 0xbe, 0x04, 0xc2,
-    0x04, 0x3a, 0x00, 0x0f, 0x00, 0x15, 0x00, 0x1d, 0x00, 0x21, 0x40, 0x10, 0x1d, 0x18, 0x09, 0x16,
-    0x16, 0x1b, 0x13, 0x08, 0x0a, 0x72, 0x15, 0x10, 0x10, 0x00, 0x06, 0x72, 0x00, 0x2b, 0x32, 0x11,
-    0x33, 0x2b, 0x32, 0x32, 0x32, 0x11, 0x33, 0x2f, 0x33, 0x30, 0x31, 0x41, 0x33, 0x03, 0x0e, 0x03,
-    0x07, 0x23, 0x35, 0x37, 0x3e, 0x03, 0x37, 0x13, 0x21, 0x11, 0x23, 0x11, 0x21, 0x01, 0x21, 0x11,
-    0x23, 0x11, 0x21, 0x11, 0x23, 0x01, 0x40, 0xf1, 0x0c, 0x05, 0x42, 0x6a, 0x85, 0x49, 0x47, 0x22,
-    0x2b, 0x3f, 0x2c, 0x19, 0x04, 0x4c, 0x02, 0xae, 0xf0, 0xfe, 0x42, 0xfe, 0xa8, 0x04, 0x9a, 0xf1,
-    0xfd, 0x4b, 0xf5, 0x04, 0x3a, 0xfe, 0x83, 0xa6, 0xee, 0xa3, 0x68, 0x1e, 0xbe, 0x02, 0x2e, 0x5d,
-    0x71, 0x98, 0x69, 0x01, 0x7d, 0xfb, 0xc6, 0x03, 0x6e, 0xfd, 0x52, 0xfd, 0xfe, 0x01, 0x42, 0xfe,
-    0xbe, 0x00, 0x00, 0x05, 0x00, 0x20, 0x00, 0x00, 0x06, 0x6b, 0x04, 0x3a, 0x00, 0x05, 0x00, 0x09,
-    0x00, 0x0d, 0x00, 0x13, 0x00, 0x17, 0x00, 0x30, 0x40, 0x17, 0x15, 0x10, 0x10, 0x00, 0x16, 0x11,
-    0x11, 0x09, 0x03, 0x03, 0x06, 0x00, 0x00, 0x14, 0x07, 0x0c, 0x12, 0x13, 0x0d, 0x0d, 0x02, 0x06,
-    0x72, 0x00, 0x2b, 0x32, 0x11, 0x33, 0x3f, 0x33, 0x33, 0x39, 0x2f, 0x33, 0x33, 0x11, 0x33, 0x33,
-    0x11, 0x33, 0x11, 0x33, 0x11, 0x33, 0x30, 0x31, 0x41, 0x01, 0x21, 0x13, 0x33, 0x07, 0x27, 0x01,
-    0x21, 0x01, 0x01, 0x11, 0x23, 0x11, 0x21, 0x01, 0x21, 0x27, 0x33, 0x13, 0x13, 0x01, 0x37, 0x01,
-    0x01, 0xe3, 0xfe, 0x50, 0x01, 0x28, 0xfc, 0xd3, 0x1f, 0xae, 0xfe, 0xeb, 0xfe, 0xd8, 0x01, 0x88,
-    0x02, 0x13, 0xf0, 0x03, 0x8b, 0xfe, 0x50, 0xfe, 0xd7, 0x20, 0xd4, 0xfc, 0x13, 0xfe, 0xea, 0xbb,
-    0x01, 0x86, 0x01, 0xb5, 0x02, 0x85, 0xfe, 0x56, 0xdb, 0x23, 0xfe, 0x28, 0x02, 0x61, 0x01, 0xd9,
-    0xfb, 0xc6, 0x04, 0x3a, 0xfd, 0x7b, 0xdb, 0x01, 0xaa, 0xfb, 0xc6, 0x01, 0xd8, 0x89, 0xfd, 0x9f,
-    0x00, 0x02, 0x00, 0x4e, 0xff, 0xec, 0x03, 0xc7, 0x04, 0x4d, 0x00, 0x1d, 0x00, 0x3b, 0x00, 0x23,
-    0x40, 0x11, 0x00, 0x1f, 0x02, 0x02, 0x3b, 0x3b, 0x14, 0x32, 0x2e, 0x29, 0x0b, 0x72, 0x0f, 0x0b,
-    0x14, 0x07, 0x72, 0x00, 0x2b, 0x32, 0xcc, 0x2b, 0xcc, 0x33, 0x12, 0x39, 0x2f, 0x33, 0x12, 0x39,
-    0x39, 0x30, 0x31, 0x41, 0x23, 0x35, 0x33, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x22,
-    0x06, 0x06, 0x15, 0x23, 0x34, 0x36, 0x36, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x14, 0x0e, 0x02, 0x25,
-    0x33, 0x32, 0x1e, 0x02, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x26, 0x26, 0x35, 0x33, 0x14, 0x16,
-    0x16, 0x33, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x23, 0x02, 0x3c, 0xd0, 0xa8, 0x40,
-    0x4d, 0x21, 0x21, 0x4e, 0x43, 0x37, 0x57, 0x32, 0xf1, 0x73, 0xc2, 0x74, 0x63, 0x9e, 0x6f, 0x3b,
-    0x34, 0x62, 0x8b, 0xfe, 0xda, 0xd0, 0x60, 0x94, 0x64, 0x33, 0x41, 0x77, 0xa4, 0x63, 0x6c, 0xcb,
-    0x83, 0xf1, 0x32, 0x5e, 0x42, 0x44, 0x56, 0x2a, 0x2a, 0x56, 0x41, 0xa8, 0x02, 0x05, 0x7a, 0x22,
-    0x3d, 0x29, 0x24, 0x41, 0x2a, 0x24, 0x40, 0x2a, 0x65, 0x92, 0x4e, 0x29, 0x4f, 0x75, 0x4d, 0x37,
-    0x62, 0x4b, 0x2a, 0x46, 0x25, 0x48, 0x69, 0x44, 0x4c, 0x79, 0x54, 0x2c, 0x48, 0x97, 0x75, 0x29,
-    0x48, 0x2d, 0x2b, 0x47, 0x28, 0x36, 0x42, 0x1f, 0x00, 0x01, 0x00, 0x84, 0x00, 0x00, 0x04, 0x0f,
-    0x04, 0x3a, 0x00, 0x09, 0x00, 0x17, 0x40, 0x0b, 0x05, 0x00, 0x06, 0x02, 0x08, 0x06, 0x72, 0x04,
-    0x06, 0x0a, 0x72, 0x00, 0x2b, 0x32, 0x2b, 0x32, 0x12, 0x39, 0x39, 0x30, 0x31, 0x41, 0x01, 0x33,
-    0x11, 0x23, 0x11, 0x01, 0x23, 0x11, 0x33, 0x01, 0x75, 0x01, 0xa9, 0xf1, 0xf1, 0xfe, 0x57, 0xf1,
-    0xf1, 0x01, 0x60, 0x02, 0xda, 0xfb, 0xc6, 0x02, 0xdb, 0xfd, 0x25, 0x04, 0x3a, 0x00, 0x00, 0x03,
-    0x00, 0x8f, 0x00, 0x00, 0x04, 0x65, 0x04, 0x3a, 0x00, 0x03, 0x00, 0x09, 0x00, 0x0d, 0x00, 0x1f,
-    0x40, 0x0f, 0x0c, 0x07, 0x07, 0x0b, 0x06, 0x06, 0x02, 0x09, 0x03, 0x06, 0x72, 0x0a, 0x02, 0x0a,
-    0x72, 0x00, 0x2b, 0x32, 0x2b, 0x32, 0x11, 0x39, 0x2f, 0x33, 0x33, 0x11, 0x33, 0x30, 0x31, 0x41,
-    0x11, 0x23, 0x11, 0x21, 0x01, 0x21, 0x27, 0x33, 0x01, 0x13, 0x01, 0x37, 0x01, 0x01, 0x80, 0xf1,
-    0x03, 0xb3, 0xfe, 0x19, 0xfe, 0xed, 0x20, 0xc9, 0x01, 0x24, 0x13, 0xfe, 0xba, 0xbe, 0x01, 0xc5,
-    0x04, 0x3a, 0xfb, 0xc6, 0x04, 0x3a, 0xfd, 0x75, 0xda, 0x01, 0xb1, 0xfb, 0xc6, 0x01, 0xd8, 0x89,
-    0xfd, 0x9f, 0x00, 0x03, 0x00, 0x20, 0x00, 0x00, 0x04, 0x10, 0x04, 0x3a, 0x00, 0x03, 0x00, 0x07,
-    0x00, 0x19, 0x00, 0x19, 0x40, 0x0c, 0x12, 0x05, 0x11, 0x0a, 0x72, 0x02, 0x03, 0x03, 0x04, 0x08,
-    0x06, 0x72, 0x00, 0x2b, 0x32, 0x32, 0x11, 0x33, 0x2b, 0x32, 0x32, 0x30, 0x31, 0x41, 0x15, 0x21,
-    0x35, 0x21, 0x11, 0x23, 0x11, 0x21, 0x33, 0x03, 0x0e, 0x04, 0x23, 0x23, 0x27, 0x37, 0x3e, 0x04,
-    0x37, 0x03, 0x53, 0xfd, 0xf0, 0x02, 0xcd, 0xf1, 0xfd, 0xe9, 0xee, 0x1d, 0x06, 0x23, 0x3a, 0x54,
-    0x70, 0x46, 0x4b, 0x01, 0x26, 0x25, 0x36, 0x27, 0x19, 0x0f, 0x04, 0x04, 0x3a, 0xc0, 0xc0, 0xfb,
-    0xc6, 0x04, 0x3a, 0xfd, 0xe9, 0x77, 0xb5, 0x81, 0x50, 0x26, 0xc6, 0x03, 0x03, 0x21, 0x3e, 0x62,
-    0x86, 0x59, 0x00, 0x03, 0x00, 0x8f, 0x00, 0x00, 0x05, 0x70, 0x04, 0x3a, 0x00, 0x06, 0x00, 0x0a,
-    0x00, 0x0e, 0x00, 0x1b, 0x40, 0x0d, 0x00, 0x09, 0x0c, 0x06, 0x01, 0x0a, 0x06, 0x72, 0x0b, 0x03,
-    0x09, 0x0a, 0x72, 0x00, 0x2b, 0x32, 0x32, 0x2b, 0x32, 0x32, 0x32, 0x12, 0x39, 0x30, 0x31, 0x41,
-    0x01, 0x33, 0x01, 0x23, 0x01, 0x33, 0x23, 0x11, 0x23, 0x11, 0x01, 0x11, 0x33, 0x11, 0x02, 0xff,
-    0x01, 0x42, 0xd1, 0xfe, 0x3f, 0xa4, 0xfe, 0x40, 0xd1, 0x3e, 0xf1, 0x03, 0xef, 0xf2, 0x01, 0x24,
-    0x03, 0x16, 0xfb, 0xc6, 0x04, 0x3a, 0xfb, 0xc6, 0x04, 0x3a, 0xfb, 0xc6, 0x04, 0x3a, 0xfb, 0xc6,
-    0x00, 0x03, 0x00, 0x84, 0x00, 0x00, 0x04, 0x0d, 0x04, 0x3a, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0b,
-    0x00, 0x1b, 0x40, 0x0d, 0x09, 0x06, 0x08, 0x03, 0x02, 0x02, 0x06, 0x07, 0x06, 0x72, 0x06, 0x0a,
-    0x72, 0x00, 0x2b, 0x2b, 0x11, 0x39, 0x2f, 0x33, 0x32, 0x11, 0x33, 0x30, 0x31, 0x41, 0x15, 0x21,
-    0x35, 0x13, 0x11, 0x23, 0x11, 0x21, 0x11, 0x23, 0x11, 0x03, 0x5f, 0xfd, 0xd0, 0x46, 0xf1, 0x03,
-    0x89, 0xf1, 0x02, 0x76, 0xbe, 0xbe, 0x01, 0xc4, 0xfb, 0xc6, 0x04, 0x3a, 0xfb, 0xc6, 0x04, 0x3a,
-    0x00, 0x03, 0x00, 0x84, 0x00, 0x00, 0x04, 0x0f, 0x04, 0x3a, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0b,
-    0x00, 0x19, 0x40, 0x0c, 0x09, 0x06, 0x08, 0x02, 0x03, 0x03, 0x07, 0x06, 0x72, 0x06, 0x0a, 0x72,
-    0x00, 0x2b, 0x2b, 0x32, 0x11, 0x33, 0x32, 0x11, 0x33, 0x30, 0x31, 0x41, 0x15, 0x21, 0x35, 0x33,
-    0x11, 0x23, 0x11, 0x21, 0x11, 0x23, 0x11, 0x03, 0x52, 0xfd, 0xea, 0x39, 0xf1, 0x03, 0x8b, 0xf2,
-    0x04, 0x3a, 0xc0, 0xc0, 0xfb, 0xc6, 0x04, 0x3a, 0xfb, 0xc6, 0x04, 0x3a, 0x00, 0x02, 0x00, 0x23,
-    0x00, 0x00, 0x03, 0xd5, 0x04, 0x3a, 0x00, 0x03, 0x00, 0x07, 0x00, 0x10, 0xb7, 0x03, 0x06, 0x07,
-    0x06, 0x72, 0x02, 0x0a, 0x72, 0x00, 0x2b, 0x2b, 0x32, 0x32, 0x30, 0x31, 0x41, 0x11, 0x23, 0x11,
-    0x21, 0x15, 0x21, 0x35, 0x02, 0x72, 0xf2, 0x02, 0x55, 0xfc, 0x4e, 0x04, 0x3a, 0xfb, 0xc6, 0x04,
-    0x3a, 0xbe, 0xbe, 0x00, 0x00, 0x05, 0x00, 0x53, 0xfe, 0x60, 0x05, 0x81, 0x06, 0x00, 0x00, 0x16,
-    0x00, 0x2b, 0x00, 0x42, 0x00, 0x56, 0x00, 0x5a, 0x00, 0x27, 0x40, 0x15, 0x27, 0x06, 0x06, 0x49,
-    0x1e, 0x11, 0x11, 0x52, 0x33, 0x3e, 0x0b, 0x72, 0x33, 0x07, 0x72, 0x58, 0x00, 0x72, 0x57, 0x0e,
-    0x72, 0x00, 0x2b, 0x2b, 0x2b, 0x2b, 0x11, 0x33, 0x33, 0x11, 0x33, 0x32, 0x32, 0x11, 0x33, 0x30,
-    0x31, 0x41, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x27, 0x11, 0x3e, 0x03, 0x33, 0x32,
-    0x1e, 0x03, 0x07, 0x35, 0x34, 0x2e, 0x03, 0x23, 0x22, 0x06, 0x06, 0x07, 0x11, 0x1e, 0x02, 0x33,
-    0x32, 0x3e, 0x02, 0x25, 0x35, 0x34, 0x3e, 0x03, 0x33, 0x32, 0x1e, 0x02, 0x17, 0x11, 0x0e, 0x03,
-    0x23, 0x22, 0x2e, 0x02, 0x37, 0x15, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x36, 0x36, 0x37, 0x11, 0x2e,
-    0x02, 0x23, 0x22, 0x0e, 0x02, 0x01, 0x11, 0x33, 0x11, 0x05, 0x81, 0x33, 0x64, 0x93, 0x61, 0x55,
-    0x7e, 0x56, 0x34, 0x0c, 0x0c, 0x33, 0x57, 0x7c, 0x55, 0x4e, 0x7e, 0x60, 0x40, 0x21, 0xf1, 0x10,
-    0x21, 0x34, 0x49, 0x30, 0x41, 0x55, 0x2b, 0x06, 0x07, 0x2d, 0x54, 0x41, 0x3c, 0x53, 0x35, 0x18,
-    0xfb, 0xc3, 0x20, 0x41, 0x60, 0x7e, 0x4e, 0x54, 0x7a, 0x55, 0x33, 0x0c, 0x0b, 0x34, 0x54, 0x7c,
-    0x55, 0x60, 0x94, 0x64, 0x33, 0xf1, 0x17, 0x32, 0x52, 0x3c, 0x42, 0x54, 0x2d, 0x07, 0x06, 0x2c,
-    0x54, 0x42, 0x3c, 0x53, 0x33, 0x17, 0x01, 0x28, 0xf2, 0x02, 0x10, 0x15, 0x73, 0xc1, 0x8e, 0x4e,
-    0x3a, 0x69, 0x8f, 0x56, 0x01, 0x39, 0x5c, 0x99, 0x70, 0x3d, 0x37, 0x65, 0x8d, 0xb0, 0x7a, 0x15,
-    0x3f, 0x72, 0x5f, 0x47, 0x27, 0x2b, 0x4d, 0x32, 0xfe, 0x56, 0x2a, 0x40, 0x25, 0x33, 0x5c, 0x7a,
-    0x47, 0x15, 0x65, 0xb0, 0x8d, 0x65, 0x37, 0x3d, 0x70, 0x99, 0x5c, 0xfe, 0xd3, 0x58, 0x94, 0x6c,
-    0x3c, 0x4e, 0x8e, 0xc1, 0x88, 0x15, 0x47, 0x7a, 0x5b, 0x34, 0x28, 0x46, 0x2d, 0x01, 0x9e, 0x32,
-    0x4d, 0x2b, 0x3c, 0x69, 0x8b, 0xfc, 0x02, 0x07, 0xa0, 0xf8, 0x60, 0x00, 0x00, 0x02, 0x00, 0x84,
-    0xfe, 0xbf, 0x04, 0xa2, 0x04, 0x3a, 0x00, 0x07, 0x00, 0x0d, 0x00, 0x1b, 0x40, 0x0d, 0x06, 0x01,
-    0x03, 0x0d, 0x0c, 0x0c, 0x00, 0x0a, 0x72, 0x01, 0x06, 0x72, 0x09, 0x00, 0x2f, 0x2b, 0x2b, 0x32,
-    0x11, 0x33, 0x32, 0x11, 0x33, 0x30, 0x31, 0x73, 0x11, 0x33, 0x11, 0x21, 0x11, 0x33, 0x11, 0x37,
-    0x03, 0x23, 0x11, 0x23, 0x35, 0x84, 0xf1, 0x01, 0xa8, 0xf2, 0x93, 0x13, 0xdd, 0x82, 0x04, 0x3a,
-    0xfc, 0x86, 0x03, 0x7a, 0xfb, 0xc6, 0xbf, 0xfe, 0x00, 0x01, 0x41, 0xbf, 0x00, 0x02, 0x00, 0x60,
-    0x00, 0x00, 0x03, 0xe1, 0x04, 0x3b, 0x00, 0x03, 0x00, 0x17, 0x00, 0x17, 0x40, 0x0b, 0x0f, 0x14,
-    0x09, 0x09, 0x01, 0x00, 0x06, 0x72, 0x01, 0x0a, 0x72, 0x00, 0x2b, 0x2b, 0x11, 0x39, 0x2f, 0x33,
-    0x32, 0x30, 0x31, 0x41, 0x11, 0x23, 0x11, 0x13, 0x15, 0x0e, 0x02, 0x23, 0x22, 0x26, 0x26, 0x35,
-    0x11, 0x33, 0x11, 0x14, 0x16, 0x16, 0x33, 0x32, 0x36, 0x36, 0x03, 0xe1, 0xf1, 0x8b, 0x2c, 0x6d,
-    0x78, 0x3d, 0x8f, 0xcf, 0x6f, 0xf0, 0x31, 0x62, 0x4a, 0x3e, 0x6e, 0x6c, 0x04, 0x3a, 0xfb, 0xc6,
-    0x04, 0x3a, 0xfe, 0x21, 0xbf, 0x13, 0x1f, 0x13, 0x58, 0xb7, 0x8d, 0x01, 0x48, 0xfe, 0xb8, 0x51,
-    0x60, 0x2a, 0x11, 0x1e, 0x00, 0x01, 0x00, 0x84, 0x00, 0x00, 0x06, 0x06, 0x04, 0x3a, 0x00, 0x0b,
-    0x00, 0x19, 0x40, 0x0c, 0x05, 0x09, 0x06, 0x02, 0x02, 0x0b, 0x00, 0x06, 0x72, 0x0b, 0x0a, 0x72,
-    0x00, 0x2b, 0x2b, 0x11, 0x33, 0x11, 0x33, 0x32, 0x32, 0x30, 0x31, 0x53, 0x33, 0x11, 0x21, 0x11,
-    0x33, 0x11, 0x21, 0x11, 0x33, 0x11, 0x21, 0x84, 0xf1, 0x01, 0x57, 0xf3, 0x01, 0x56, 0xf1, 0xfa,
-    0x7e, 0x04, 0x3a, 0xfc, 0x86, 0x03, 0x7a, 0xfc, 0x86, 0x03, 0x7a, 0xfb, 0xc6, 0x00, 0x00, 0x02,
-    0x00, 0x7d, 0xfe, 0xbf, 0x06, 0xbb, 0x04, 0x3a, 0x00, 0x05, 0x00, 0x11, 0x00, 0x1d, 0x40, 0x0e,
-    0x0c, 0x05, 0x08, 0x08, 0x04, 0x11, 0x0a, 0x72, 0x0f, 0x0b, 0x06, 0x06, 0x72, 0x01, 0x00, 0x2f,
-    0x2b, 0x32, 0x32, 0x2b, 0x32, 0x32, 0x11, 0x33, 0x33, 0x30, 0x31, 0x65, 0x03, 0x23, 0x11, 0x23,
-    0x35, 0x01, 0x33, 0x11, 0x21, 0x11, 0x33, 0x11, 0x21, 0x11, 0x33, 0x11, 0x21, 0x06, 0xbb, 0x13,
-    0xdd, 0x82, 0xfb, 0x34, 0xf1, 0x01, 0x58, 0xf2, 0x01, 0x57, 0xf1, 0xfa, 0x7d, 0xbf, 0xfe, 0x00,
-    0x01, 0x41, 0xbf, 0x03, 0x7b, 0xfc, 0x86, 0x03, 0x7a, 0xfc, 0x86, 0x03, 0x7a, 0xfb, 0xc6, 0x00,
-    0x00, 0x02, 0x00, 0x20, 0x00, 0x00, 0x04, 0xf1, 0x04, 0x3a, 0x00, 0x03, 0x00, 0x1c, 0x00, 0x1d,
-    0x40, 0x0e, 0x11, 0x12, 0x0f, 0x1c, 0x04, 0x04, 0x0f, 0x02, 0x03, 0x06, 0x72, 0x0f, 0x0a, 0x72,
-    0x00, 0x2b, 0x2b, 0x32, 0x11, 0x39, 0x2f, 0x33, 0x11, 0x33, 0x32, 0x30, 0x31, 0x41, 0x15, 0x21,
-    0x35, 0x01, 0x21, 0x32, 0x16, 0x16, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x21, 0x11, 0x33, 0x11, 0x33,
-    0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x21, 0x02, 0x2a, 0xfd, 0xf6, 0x01, 0xdc, 0x01,
-    0x3e, 0x8d, 0xc3, 0x67, 0x3a, 0x70, 0xa4, 0x69, 0xfe, 0x21, 0xf2, 0xed, 0x48, 0x56, 0x27, 0x27,
-    0x56, 0x48, 0xfe, 0xc2, 0x04, 0x3a, 0xc0, 0xc0, 0xfe, 0xa8, 0x5e, 0xa7, 0x6b, 0x4f, 0x87, 0x64,
-    0x38, 0x04, 0x3a, 0xfc, 0x85, 0x32, 0x50, 0x2d, 0x2e, 0x52, 0x34, 0x00, 0x00, 0x02, 0x00, 0x8f,
-    0x00, 0x00, 0x05, 0xcf, 0x04, 0x3a, 0x00, 0x18, 0x00, 0x1c, 0x00, 0x1d, 0x40, 0x0e, 0x1a, 0x19,
-    0x0e, 0x0b, 0x18, 0x00, 0x00, 0x0b, 0x0c, 0x06, 0x72, 0x0b, 0x0a, 0x72, 0x00, 0x2b, 0x2b, 0x11,
-    0x39, 0x2f, 0x33, 0x11, 0x33, 0x32, 0x33, 0x30, 0x31, 0x41, 0x21, 0x32, 0x16, 0x16, 0x15, 0x14,
-    0x0e, 0x02, 0x23, 0x21, 0x11, 0x33, 0x11, 0x33, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23,
-    0x21, 0x01, 0x11, 0x23, 0x11, 0x01, 0x2f, 0x01, 0x3f, 0x8c, 0xc4, 0x67, 0x3a, 0x71, 0xa3, 0x69,
-    0xfe, 0x21, 0xf2, 0xed, 0x48, 0x56, 0x27, 0x27, 0x56, 0x48, 0xfe, 0xc1, 0x04, 0xa0, 0xf1, 0x02,
-    0xe2, 0x5e, 0xa7, 0x6b, 0x4f, 0x87, 0x64, 0x38, 0x04, 0x3a, 0xfc, 0x85, 0x32, 0x50, 0x2d, 0x2e,
-    0x52, 0x34, 0x02, 0x18, 0xfb, 0xc6, 0x04, 0x3a, 0x00, 0x01, 0x00, 0x8f, 0x00, 0x00, 0x04, 0x25,
-    0x04, 0x3a, 0x00, 0x18, 0x00, 0x19, 0x40, 0x0c, 0x0e, 0x0b, 0x18, 0x00, 0x00, 0x0b, 0x0c, 0x06,
-    0x72, 0x0b, 0x0a, 0x72, 0x00, 0x2b, 0x2b, 0x11, 0x39, 0x2f, 0x33, 0x11, 0x33, 0x30, 0x31, 0x41,
-    0x21, 0x32, 0x16, 0x16, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x21, 0x11, 0x33, 0x11, 0x33, 0x32, 0x36,
-    0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x21, 0x01, 0x2f, 0x01, 0x3f, 0x8c, 0xc4, 0x67, 0x3a, 0x71,
-    0xa3, 0x69, 0xfe, 0x21, 0xf2, 0xed, 0x48, 0x56, 0x27, 0x27, 0x56, 0x48, 0xfe, 0xc1, 0x02, 0xe2,
-    0x5e, 0xa7, 0x6b, 0x4f, 0x87, 0x64, 0x38, 0x04, 0x3a, 0xfc, 0x85, 0x32, 0x50, 0x2d, 0x2e, 0x52,
-    0x34, 0x00, 0x00, 0x02, 0x00, 0x50, 0xff, 0xeb, 0x03, 0xe8, 0x04, 0x4e, 0x00, 0x27, 0x00, 0x2b,
-    0x00, 0x1d, 0x40, 0x0e, 0x2b, 0x2a, 0x2a, 0x09, 0x1d, 0x19, 0x14, 0x0b, 0x72, 0x04, 0x00, 0x09,
-    0x07, 0x72, 0x00, 0x2b, 0x32, 0xcc, 0x2b, 0xcc, 0x33, 0x12, 0x39, 0x2f, 0x33, 0x30, 0x31, 0x41,
-    0x22, 0x06, 0x06, 0x15, 0x23, 0x34, 0x36, 0x36, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x15, 0x14, 0x0e,
-    0x02, 0x23, 0x22, 0x26, 0x26, 0x35, 0x33, 0x14, 0x16, 0x16, 0x33, 0x32, 0x3e, 0x02, 0x35, 0x35,
-    0x34, 0x2e, 0x02, 0x01, 0x15, 0x21, 0x35, 0x02, 0x00, 0x38, 0x5d, 0x37, 0xe4, 0x77, 0xc4, 0x75,
-    0x77, 0xb6, 0x7c, 0x3f, 0x40, 0x7c, 0xb5, 0x76, 0x7e, 0xc4, 0x6f, 0xe4, 0x34, 0x5c, 0x3d, 0x43,
-    0x5e, 0x3a, 0x1a, 0x1a, 0x39, 0x5f, 0x01, 0x0e, 0xfe, 0x49, 0x03, 0x8e, 0x2f, 0x53, 0x38, 0x6a,
-    0xab, 0x65, 0x55, 0x96, 0xc5, 0x70, 0x23, 0x70, 0xc4, 0x97, 0x55, 0x68, 0xb7, 0x79, 0x3d, 0x62,
-    0x39, 0x3c, 0x64, 0x7f, 0x41, 0x23, 0x43, 0x7e, 0x64, 0x3b, 0xfe, 0xe8, 0xa3, 0xa3, 0x00, 0x04,
-    0x00, 0x92, 0xff, 0xec, 0x06, 0x36, 0x04, 0x4e, 0x00, 0x03, 0x00, 0x07, 0x00, 0x1d, 0x00, 0x33,
-    0x00, 0x23, 0x40, 0x13, 0x24, 0x03, 0x02, 0x02, 0x19, 0x2f, 0x0e, 0x07, 0x06, 0x72, 0x06, 0x0a,
-    0x72, 0x0e, 0x07, 0x72, 0x19, 0x0b, 0x72, 0x00, 0x2b, 0x2b, 0x2b, 0x2b, 0x11, 0x33, 0x12, 0x39,
-    0x2f, 0x33, 0x32, 0x30, 0x31, 0x41, 0x15, 0x21, 0x35, 0x13, 0x11, 0x23, 0x11, 0x01, 0x35, 0x34,
-    0x3e, 0x02, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x37,
-    0x15, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x3e, 0x02, 0x35, 0x35, 0x34, 0x2e, 0x02, 0x23, 0x22, 0x0e,
-    0x02, 0x02, 0xf9, 0xfd, 0xbc, 0xce, 0xf1, 0x01, 0xb5, 0x44, 0x82, 0xba, 0x76, 0x78, 0xbb, 0x82,
-    0x44, 0x44, 0x81, 0xbb, 0x77, 0x77, 0xba, 0x83, 0x44, 0xf2, 0x1e, 0x40, 0x64, 0x44, 0x44, 0x63,
-    0x40, 0x1f, 0x1f, 0x40, 0x64, 0x45, 0x43, 0x63, 0x40, 0x1e, 0x02, 0x85, 0xc0, 0xc0, 0x01, 0xb5,
-    0xfb, 0xc6, 0x04, 0x3a, 0xfd, 0xd7, 0x17, 0x75, 0xc9, 0x95, 0x53, 0x53, 0x95, 0xc9, 0x75, 0x17,
-    0x75, 0xc8, 0x95, 0x53, 0x53, 0x95, 0xc8, 0x8c, 0x17, 0x49, 0x82, 0x62, 0x38, 0x38, 0x62, 0x82,
-    0x49, 0x17, 0x48, 0x81, 0x64, 0x39, 0x39, 0x64, 0x81, 0x00, 0x00, 0x02, 0x00, 0x2e, 0x00, 0x00,
-    0x03, 0xe0, 0x04, 0x3a, 0x00, 0x03, 0x00, 0x1d, 0x00, 0x1d, 0x40, 0x0e, 0x01, 0x12, 0x12, 0x13,
-    0x13, 0x03, 0x09, 0x04, 0x06, 0x72, 0x07, 0x03, 0x0a, 0x72, 0x00, 0x2b, 0x32, 0x2b, 0x32, 0x12,
-    0x39, 0x2f, 0x33, 0x12, 0x39, 0x30, 0x31, 0x41, 0x33, 0x01, 0x23, 0x01, 0x21, 0x11, 0x23, 0x11,
-    0x23, 0x22, 0x06, 0x06, 0x15, 0x14, 0x16, 0x16, 0x33, 0x21, 0x15, 0x21, 0x22, 0x2e, 0x02, 0x35,
-    0x34, 0x3e, 0x02, 0x01, 0x60, 0xfa, 0xfe, 0xcd, 0xf9, 0x01, 0xe2, 0x01, 0xd0, 0xf0, 0xe0, 0x44,
-    0x58, 0x2a, 0x27, 0x53, 0x3f, 0x01, 0x3e, 0xfe, 0xc2, 0x64, 0x9e, 0x6e, 0x3a, 0x3c, 0x71, 0xa3,
-    0x02, 0x11, 0xfd, 0xef, 0x04, 0x3a, 0xfb, 0xc6, 0x03, 0x7c, 0x2f, 0x4b, 0x27, 0x27, 0x48, 0x2e,
-    0xb0, 0x33, 0x5b, 0x7b, 0x49, 0x4b, 0x7e, 0x5e, 0x33, 0x00, 0x00, 0x04, 0xff, 0xd7, 0xfe, 0x4b,
-    0x03, 0xfa, 0x06, 0x00, 0x00, 0x11, 0x00, 0x15, 0x00, 0x2c, 0x00, 0x30, 0x00, 0x1d, 0x40, 0x10,
-    0x30, 0x2f, 0x28, 0x1c, 0x07, 0x72, 0x15, 0x00, 0x72, 0x14, 0x0a, 0x72, 0x0d, 0x06, 0x0f, 0x72,
-    0x00, 0x2b, 0x32, 0x2b, 0x2b, 0x2b, 0x32, 0xcc, 0x32, 0x30, 0x31, 0x41, 0x33, 0x11, 0x14, 0x06,
-    0x06, 0x23, 0x22, 0x26, 0x27, 0x37, 0x16, 0x16, 0x33, 0x32, 0x36, 0x36, 0x35, 0x01, 0x11, 0x23,
-    0x11, 0x13, 0x27, 0x3e, 0x03, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x11, 0x23, 0x11, 0x34, 0x26, 0x26,
-    0x23, 0x22, 0x0e, 0x02, 0x01, 0x15, 0x21, 0x35, 0x03, 0x08, 0xf2, 0x55, 0x9e, 0x6f, 0x23, 0x3e,
-    0x22, 0x0e, 0x13, 0x3b, 0x16, 0x29, 0x3a, 0x1e, 0xfe, 0x62, 0xf0, 0xc6, 0x4e, 0x01, 0x3d, 0x6f,
-    0x9c, 0x5f, 0x50, 0x81, 0x5e, 0x31, 0xf2, 0x2d, 0x56, 0x3e, 0x41, 0x63, 0x42, 0x21, 0x01, 0x37,
-    0xfd, 0x60, 0x01, 0xce, 0xfd, 0xf4, 0x79, 0xa8, 0x56, 0x07, 0x0a, 0xbb, 0x06, 0x06, 0x2b, 0x52,
-    0x3a, 0x06, 0x3e, 0xfa, 0x00, 0x06, 0x00, 0xfc, 0x45, 0x01, 0x70, 0xbe, 0x8d, 0x4d, 0x2c, 0x61,
-    0x9b, 0x6f, 0xfd, 0x49, 0x02, 0xb9, 0x4e, 0x5c, 0x29, 0x34, 0x5a, 0x76, 0x02, 0xce, 0xa6, 0xa6,
-    0x00, 0x02, 0x00, 0x52, 0xff, 0xec, 0x03, 0xf5, 0x04, 0x4e, 0x00, 0x03, 0x00, 0x2b, 0x00, 0x1b,
-    0x40, 0x0d, 0x04, 0x0d, 0x03, 0x02, 0x02, 0x0d, 0x21, 0x18, 0x07, 0x72, 0x0d, 0x0b, 0x72, 0x00,
-    0x2b, 0x2b, 0x32, 0x11, 0x39, 0x2f, 0x33, 0x11, 0x33, 0x30, 0x31, 0x41, 0x15, 0x21, 0x35, 0x01,
-    0x32, 0x36, 0x36, 0x37, 0x33, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x35, 0x34, 0x3e, 0x02,
-    0x33, 0x32, 0x16, 0x16, 0x17, 0x23, 0x2e, 0x02, 0x23, 0x22, 0x0e, 0x02, 0x15, 0x15, 0x14, 0x1e,
-    0x02, 0x02, 0xa5, 0xfe, 0x28, 0x01, 0x6d, 0x3b, 0x5f, 0x3b, 0x03, 0xe3, 0x03, 0x78, 0xc5, 0x78,
-    0x7c, 0xb9, 0x7a, 0x3c, 0x3c, 0x7b, 0xb8, 0x7b, 0x81, 0xc5, 0x70, 0x03, 0xe3, 0x03, 0x35, 0x5f,
-    0x42, 0x49, 0x61, 0x36, 0x16, 0x16, 0x37, 0x60, 0x02, 0x68, 0xa3, 0xa3, 0xfe, 0x44, 0x2f, 0x54,
-    0x37, 0x69, 0xac, 0x65, 0x55, 0x96, 0xc4, 0x70, 0x23, 0x70, 0xc5, 0x96, 0x55, 0x67, 0xb7, 0x79,
-    0x3c, 0x61, 0x3a, 0x3b, 0x65, 0x7d, 0x43, 0x23, 0x43, 0x7e, 0x63, 0x3b, 0x00, 0x03, 0x00, 0x1d,
-    0x00, 0x00, 0x06, 0x9f, 0x04, 0x3a, 0x00, 0x11, 0x00, 0x15, 0x00, 0x2e, 0x00, 0x25, 0x40, 0x12,
-    0x16, 0x2e, 0x2e, 0x00, 0x24, 0x21, 0x21, 0x0a, 0x09, 0x0a, 0x72, 0x14, 0x15, 0x15, 0x23, 0x00,
-    0x06, 0x72, 0x00, 0x2b, 0x32, 0x32, 0x11, 0x33, 0x2b, 0x32, 0x32, 0x11, 0x33, 0x11, 0x39, 0x2f,
-    0x33, 0x30, 0x31, 0x41, 0x33, 0x03, 0x0e, 0x04, 0x23, 0x23, 0x27, 0x37, 0x3e, 0x04, 0x37, 0x01,
-    0x15, 0x21, 0x35, 0x01, 0x21, 0x32, 0x16, 0x16, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x21, 0x11, 0x33,
-    0x11, 0x33, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x21, 0x01, 0x05, 0xee, 0x1d, 0x06,
-    0x22, 0x3b, 0x54, 0x6f, 0x47, 0x4b, 0x01, 0x27, 0x24, 0x36, 0x26, 0x1a, 0x10, 0x03, 0x02, 0x4d,
-    0xfd, 0xff, 0x02, 0x6d, 0x01, 0x3e, 0x8d, 0xc4, 0x66, 0x3a, 0x70, 0xa3, 0x6a, 0xfe, 0x22, 0xf1,
-    0xed, 0x49, 0x56, 0x27, 0x27, 0x56, 0x49, 0xfe, 0xc2, 0x04, 0x3a, 0xfd, 0xe9, 0x77, 0xb5, 0x81,
-    0x50, 0x26, 0xc6, 0x03, 0x03, 0x21, 0x3e, 0x62, 0x86, 0x59, 0x01, 0xce, 0xc0, 0xc0, 0xfe, 0x87,
-    0x5a, 0x9e, 0x66, 0x4c, 0x82, 0x60, 0x35, 0x04, 0x3a, 0xfc, 0x84, 0x31, 0x4c, 0x2a, 0x29, 0x48,
-    0x2c, 0x00, 0x00, 0x03, 0x00, 0x84, 0x00, 0x00, 0x06, 0xb2, 0x04, 0x3a, 0x00, 0x03, 0x00, 0x07,
-    0x00, 0x20, 0x00, 0x25, 0x40, 0x12, 0x15, 0x16, 0x13, 0x13, 0x06, 0x08, 0x03, 0x20, 0x03, 0x02,
-    0x02, 0x06, 0x07, 0x06, 0x72, 0x06, 0x0a, 0x72, 0x00, 0x2b, 0x2b, 0x11, 0x39, 0x2f, 0x33, 0x33,
-    0x11, 0x33, 0x11, 0x33, 0x11, 0x33, 0x32, 0x30, 0x31, 0x41, 0x15, 0x21, 0x35, 0x13, 0x11, 0x23,
-    0x11, 0x01, 0x21, 0x32, 0x16, 0x16, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x21, 0x11, 0x33, 0x11, 0x33,
-    0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x21, 0x03, 0x5f, 0xfd, 0xd0, 0x46, 0xf1, 0x03,
-    0x37, 0x01, 0x3f, 0x8d, 0xc4, 0x67, 0x3a, 0x71, 0xa4, 0x69, 0xfe, 0x22, 0xf1, 0xed, 0x48, 0x57,
-    0x27, 0x27, 0x57, 0x48, 0xfe, 0xc1, 0x02, 0x9c, 0xbe, 0xbe, 0x01, 0x9e, 0xfb, 0xc6, 0x04, 0x3a,
-    0xfe, 0x87, 0x5a, 0x9e, 0x66, 0x4c, 0x82, 0x60, 0x35, 0x04, 0x3a, 0xfc, 0x84, 0x31, 0x4c, 0x2a,
-    0x29, 0x48, 0x2c, 0x00, 0x00, 0x03, 0xff, 0xe8, 0x00, 0x00, 0x03, 0xfa, 0x06, 0x00, 0x00, 0x03,
-    0x00, 0x1a, 0x00, 0x1e, 0x00, 0x19, 0x40, 0x0d, 0x1e, 0x1d, 0x16, 0x0a, 0x07, 0x72, 0x03, 0x00,
-    0x72, 0x11, 0x02, 0x0a, 0x72, 0x00, 0x2b, 0x32, 0x2b, 0x2b, 0x32, 0xcc, 0x32, 0x30, 0x31, 0x41,
-    0x11, 0x23, 0x11, 0x13, 0x27, 0x3e, 0x03, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x11, 0x23, 0x11, 0x34,
-    0x26, 0x26, 0x23, 0x22, 0x0e, 0x02, 0x01, 0x15, 0x21, 0x35, 0x01, 0x6a, 0xf0, 0xc6, 0x4e, 0x01,
-    0x3d, 0x6f, 0x9c, 0x5f, 0x50, 0x81, 0x5e, 0x31, 0xf2, 0x2d, 0x56, 0x3e, 0x41, 0x63, 0x42, 0x21,
-    0x01, 0x48, 0xfd, 0x60, 0x06, 0x00, 0xfa, 0x00, 0x06, 0x00, 0xfc, 0x45, 0x01, 0x70, 0xbe, 0x8d,
-    0x4d, 0x2c, 0x61, 0x9b, 0x6f, 0xfd, 0x49, 0x02, 0xb9, 0x4e, 0x5c, 0x29, 0x34, 0x5a, 0x76, 0x02,
-    0xd7, 0xa7, 0xa7, 0x00, 0x00, 0x02, 0x00, 0x84, 0xfe, 0x9b, 0x04, 0x0f, 0x04, 0x3a, 0x00, 0x03,
-    0x00, 0x0b, 0x00, 0x17, 0x40, 0x0b, 0x00, 0x06, 0x06, 0x0b, 0x0a, 0x72, 0x09, 0x04, 0x06, 0x72,
-    0x02, 0x00, 0x2f, 0x2b, 0x32, 0x2b, 0x32, 0x12, 0x39, 0x30, 0x31, 0x65, 0x33, 0x11, 0x23, 0x01,
-    0x33, 0x11, 0x21, 0x11, 0x33, 0x11, 0x21, 0x01, 0xd2, 0xf2, 0xf2, 0xfe, 0xb2, 0xf1, 0x01, 0xa8,
-    0xf2, 0xfc, 0x75, 0xc0, 0xfd, 0xdb, 0x05, 0x9f, 0xfc, 0x86, 0x03, 0x7a, 0xfb, 0xc6, 0x00, 0x02,
-    0x00, 0x88, 0xff, 0xeb, 0x06, 0xcf, 0x05, 0xb0, 0x00, 0x18, 0x00, 0x30, 0x00, 0x1b, 0x40, 0x0e,
-    0x2c, 0x1f, 0x09, 0x72, 0x14, 0x07, 0x09, 0x72, 0x26, 0x1a, 0x0e, 0x00, 0x02, 0x72, 0x00, 0x2b,
-    0x32, 0x32, 0x32, 0x2b, 0x32, 0x2b, 0x32, 0x30, 0x31, 0x41, 0x33, 0x11, 0x14, 0x0e, 0x02, 0x23,
-    0x22, 0x2e, 0x02, 0x35, 0x11, 0x33, 0x11, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x36, 0x36, 0x35, 0x01,
-    0x33, 0x11, 0x14, 0x06, 0x06, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x11, 0x33, 0x11, 0x14, 0x1e, 0x02,
-    0x33, 0x32, 0x36, 0x36, 0x35, 0x03, 0x2d, 0xcb, 0x3f, 0x73, 0x9a, 0x5d, 0x62, 0xa6, 0x7b, 0x44,
-    0xfb, 0x1e, 0x36, 0x4b, 0x2d, 0x43, 0x63, 0x38, 0x02, 0xa7, 0xfb, 0x79, 0xd0, 0x86, 0x59, 0x99,
-    0x70, 0x3f, 0xcc, 0x1f, 0x39, 0x4e, 0x2f, 0x3f, 0x60, 0x35, 0x05, 0xb0, 0xfc, 0x00, 0x70, 0xaa,
-    0x72, 0x39, 0x39, 0x72, 0xaa, 0x70, 0x04, 0x00, 0xfc, 0x00, 0x41, 0x60, 0x3f, 0x1e, 0x37, 0x70,
-    0x57, 0x04, 0x00, 0xfc, 0x00, 0x95, 0xca, 0x66, 0x39, 0x72, 0xaa, 0x70, 0x04, 0x00, 0xfc, 0x00,
-    0x41, 0x60, 0x3f, 0x1e, 0x37, 0x70, 0x57, 0x00, 0x00, 0x02, 0x00, 0x72, 0xff, 0xeb, 0x06, 0x03,
-    0x04, 0x3a, 0x00, 0x18, 0x00, 0x31, 0x00, 0x1b, 0x40, 0x0e, 0x2c, 0x1f, 0x0b, 0x72, 0x14, 0x07,
-    0x0b, 0x72, 0x26, 0x1a, 0x0e, 0x00, 0x06, 0x72, 0x00, 0x2b, 0x32, 0x32, 0x32, 0x2b, 0x32, 0x2b,
-    0x32, 0x30, 0x31, 0x41, 0x33, 0x11, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x11, 0x33,
-    0x11, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x36, 0x36, 0x35, 0x01, 0x33, 0x11, 0x14, 0x06, 0x06, 0x23,
-    0x22, 0x2e, 0x02, 0x35, 0x11, 0x33, 0x11, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x3e, 0x02, 0x35, 0x02,
-    0xc4, 0xc4, 0x39, 0x67, 0x8e, 0x54, 0x58, 0x94, 0x6c, 0x3c, 0xf2, 0x17, 0x2b, 0x3b, 0x25, 0x39,
-    0x55, 0x30, 0x02, 0x4e, 0xf1, 0x6a, 0xbb, 0x77, 0x53, 0x89, 0x63, 0x36, 0xc4, 0x18, 0x2e, 0x42,
-    0x29, 0x26, 0x40, 0x2d, 0x18, 0x04, 0x3a, 0xfd, 0x57, 0x69, 0x9e, 0x6a, 0x35, 0x35, 0x6a, 0x9e,
-    0x69, 0x02, 0xa9, 0xfd, 0x57, 0x3b, 0x57, 0x38, 0x1c, 0x31, 0x66, 0x4f, 0x02, 0xa9, 0xfd, 0x57,
-    0x8c, 0xbb, 0x5f, 0x35, 0x6a, 0x9e, 0x69, 0x02, 0xa9, 0xfd, 0x57, 0x3b, 0x57, 0x38, 0x1c, 0x1c,
-    0x38, 0x57, 0x3b, 0x00, 0x00, 0x02, 0xff, 0xe1, 0x00, 0x00, 0x04, 0x23, 0x06, 0x17, 0x00, 0x17,
-    0x00, 0x1b, 0x00, 0x21, 0x40, 0x10, 0x0d, 0x0a, 0x00, 0x17, 0x17, 0x0a, 0x1a, 0x1b, 0x1b, 0x0a,
-    0x0b, 0x01, 0x72, 0x0a, 0x0a, 0x72, 0x00, 0x2b, 0x2b, 0x11, 0x39, 0x2f, 0x33, 0x11, 0x39, 0x2f,
-    0x33, 0x11, 0x33, 0x30, 0x31, 0x41, 0x21, 0x32, 0x16, 0x16, 0x15, 0x14, 0x06, 0x06, 0x23, 0x21,
-    0x11, 0x33, 0x11, 0x33, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x21, 0x01, 0x15, 0x21,
-    0x35, 0x01, 0x2e, 0x01, 0x3e, 0x8d, 0xc4, 0x66, 0x66, 0xc4, 0x8d, 0xfe, 0x22, 0xf2, 0xec, 0x48,
-    0x57, 0x27, 0x27, 0x57, 0x48, 0xfe, 0xc2, 0x01, 0x6f, 0xfd, 0x44, 0x03, 0x00, 0x63, 0xab, 0x6f,
-    0x6f, 0xaf, 0x65, 0x06, 0x17, 0xfa, 0xa8, 0x36, 0x58, 0x32, 0x30, 0x59, 0x39, 0x02, 0xa0, 0xa7,
-    0xa7, 0x00, 0x00, 0x03, 0x00, 0x98, 0xff, 0xed, 0x06, 0xd3, 0x05, 0xc5, 0x00, 0x03, 0x00, 0x2c,
-    0x00, 0x30, 0x00, 0x20, 0x40, 0x11, 0x03, 0x02, 0x02, 0x2f, 0x30, 0x02, 0x72, 0x2f, 0x08, 0x1d,
-    0x14, 0x03, 0x72, 0x29, 0x09, 0x09, 0x72, 0x00, 0x2b, 0x32, 0x2b, 0x32, 0x3f, 0x2b, 0x12, 0x39,
-    0x2f, 0x33, 0x30, 0x31, 0x41, 0x15, 0x21, 0x35, 0x01, 0x33, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02,
-    0x35, 0x35, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x16, 0x16, 0x17, 0x23, 0x2e, 0x02, 0x23, 0x22, 0x0e,
-    0x02, 0x15, 0x15, 0x14, 0x1e, 0x03, 0x33, 0x32, 0x36, 0x36, 0x01, 0x11, 0x23, 0x11, 0x05, 0x28,
-    0xfc, 0x13, 0x04, 0x9d, 0xfa, 0x0c, 0x89, 0xf5, 0xb1, 0x87, 0xd8, 0x99, 0x52, 0x53, 0x9c, 0xdc,
-    0x88, 0xae, 0xf1, 0x86, 0x0e, 0xfb, 0x09, 0x43, 0x82, 0x6a, 0x54, 0x81, 0x56, 0x2b, 0x19, 0x33,
-    0x4e, 0x6d, 0x46, 0x6b, 0x85, 0x46, 0xfb, 0xc6, 0xfb, 0x03, 0x4e, 0xc0, 0xc0, 0xfe, 0x8d, 0x8f,
-    0xdf, 0x80, 0x61, 0xb3, 0xfe, 0x9d, 0x79, 0x9d, 0xfe, 0xb5, 0x60, 0x80, 0xe2, 0x92, 0x5e, 0x86,
-    0x47, 0x40, 0x7c, 0xb5, 0x74, 0x7b, 0x58, 0x97, 0x77, 0x54, 0x2d, 0x44, 0x83, 0x04, 0x34, 0xfa,
-    0x50, 0x05, 0xb0, 0x00, 0x00, 0x03, 0x00, 0x86, 0xff, 0xec, 0x05, 0xba, 0x04, 0x4e, 0x00, 0x03,
-    0x00, 0x2b, 0x00, 0x2f, 0x00, 0x24, 0x40, 0x13, 0x03, 0x02, 0x02, 0x2e, 0x2f, 0x06, 0x72, 0x2e,
-    0x0a, 0x21, 0x1d, 0x18, 0x07, 0x72, 0x08, 0x04, 0x0d, 0x0b, 0x72, 0x00, 0x2b, 0x32, 0xcc, 0x2b,
-    0xcc, 0x33, 0x3f, 0x2b, 0x12, 0x39, 0x2f, 0x33, 0x30, 0x31, 0x41, 0x15, 0x21, 0x35, 0x01, 0x32,
-    0x36, 0x36, 0x37, 0x33, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x35, 0x34, 0x3e, 0x02, 0x33,
-    0x32, 0x16, 0x16, 0x17, 0x23, 0x2e, 0x02, 0x23, 0x22, 0x0e, 0x02, 0x15, 0x15, 0x14, 0x1e, 0x02,
-    0x01, 0x11, 0x23, 0x11, 0x04, 0x82, 0xfc, 0x96, 0x02, 0xe7, 0x3b, 0x60, 0x3a, 0x03, 0xe3, 0x03,
-    0x78, 0xc5, 0x78, 0x7c, 0xb9, 0x7a, 0x3c, 0x3c, 0x7b, 0xb7, 0x7c, 0x82, 0xc4, 0x70, 0x03, 0xe3,
-    0x03, 0x35, 0x5f, 0x42, 0x49, 0x60, 0x36, 0x17, 0x16, 0x37, 0x60, 0xfd, 0xc2, 0xf1, 0x02, 0x71,
-    0xa7, 0xa7, 0xfe, 0x3b, 0x2f, 0x54, 0x37, 0x69, 0xac, 0x65, 0x55, 0x96, 0xc4, 0x70, 0x23, 0x70,
-    0xc5, 0x96, 0x55, 0x67, 0xb7, 0x79, 0x3c, 0x61, 0x3a, 0x3b, 0x65, 0x7d, 0x43, 0x23, 0x43, 0x7e,
-    0x63, 0x3b, 0x03, 0x8e, 0xfb, 0xc6, 0x04, 0x3a, 0x00, 0x04, 0x00, 0x1a, 0x00, 0x00, 0x05, 0x1b,
-    0x05, 0xb0, 0x00, 0x04, 0x00, 0x09, 0x00, 0x0d, 0x00, 0x11, 0x00, 0x24, 0x40, 0x11, 0x11, 0x0d,
-    0x0c, 0x0c, 0x02, 0x00, 0x06, 0x06, 0x07, 0x03, 0x02, 0x72, 0x0f, 0x05, 0x05, 0x02, 0x08, 0x00,
-    0x3f, 0x33, 0x11, 0x33, 0x2b, 0x32, 0x32, 0x11, 0x33, 0x11, 0x39, 0x2f, 0x33, 0x33, 0x30, 0x31,
-    0x41, 0x01, 0x21, 0x01, 0x33, 0x01, 0x01, 0x37, 0x33, 0x01, 0x01, 0x15, 0x21, 0x35, 0x05, 0x11,
-    0x23, 0x11, 0x02, 0xdb, 0xfe, 0x44, 0xfe, 0xfb, 0x02, 0x06, 0x93, 0x01, 0x63, 0xfe, 0x46, 0x2c,
-    0x92, 0x02, 0x01, 0xfe, 0xe9, 0xfd, 0x16, 0x01, 0xea, 0xdd, 0x05, 0x23, 0xfa, 0xdd, 0x05, 0xb0,
-    0xfa, 0x50, 0x05, 0x2b, 0x85, 0xfa, 0x50, 0x02, 0x66, 0xb8, 0xb8, 0x4a, 0xfd, 0xe4, 0x02, 0x1c,
-    0x00, 0x04, 0x00, 0x0b, 0x00, 0x00, 0x04, 0x47, 0x04, 0x3a, 0x00, 0x04, 0x00, 0x09, 0x00, 0x0d,
-    0x00, 0x11, 0x00, 0x1e, 0x40, 0x0e, 0x11, 0x0d, 0x0c, 0x0c, 0x01, 0x07, 0x03, 0x06, 0x72, 0x10,
-    0x05, 0x05, 0x01, 0x0a, 0x00, 0x3f, 0x33, 0x11, 0x33, 0x2b, 0x32, 0x12, 0x39, 0x2f, 0x33, 0x33,
-    0x30, 0x31, 0x41, 0x01, 0x23, 0x01, 0x33, 0x13, 0x01, 0x03, 0x33, 0x01, 0x03, 0x15, 0x21, 0x35,
-    0x05, 0x11, 0x23, 0x11, 0x02, 0x0b, 0xfe, 0xf7, 0xf7, 0x01, 0xa9, 0xb5, 0xe8, 0xfe, 0xf2, 0x5b,
-    0xb6, 0x01, 0xa9, 0xcc, 0xfd, 0x64, 0x01, 0xa5, 0xb9, 0x02, 0xcd, 0xfd, 0x33, 0x04, 0x3a, 0xfb,
-    0xc6, 0x02, 0xcd, 0x01, 0x6d, 0xfb, 0xc6, 0x01, 0xc5, 0xa9, 0xa9, 0x40, 0xfe, 0x7b, 0x01, 0x85,
-    0x00, 0x06, 0x00, 0xac, 0x00, 0x00, 0x07, 0x35, 0x05, 0xb0, 0x00, 0x03, 0x00, 0x08, 0x00, 0x0d,
-    0x00, 0x11, 0x00, 0x15, 0x00, 0x19, 0x00, 0x34, 0x40, 0x1a, 0x09, 0x14, 0x14, 0x06, 0x06, 0x18,
-    0x15, 0x11, 0x11, 0x10, 0x10, 0x03, 0x02, 0x02, 0x18, 0x08, 0x16, 0x02, 0x72, 0x04, 0x0a, 0x0a,
-    0x0b, 0x07, 0x02, 0x72, 0x00, 0x2b, 0x32, 0x32, 0x11, 0x33, 0x2b, 0x3f, 0x39, 0x2f, 0x33, 0x33,
-    0x11, 0x33, 0x11, 0x33, 0x11, 0x33, 0x11, 0x33, 0x11, 0x33, 0x30, 0x31, 0x41, 0x15, 0x21, 0x35,
-    0x01, 0x01, 0x21, 0x01, 0x33, 0x01, 0x01, 0x37, 0x33, 0x01, 0x01, 0x15, 0x21, 0x35, 0x05, 0x11,
-    0x23, 0x11, 0x01, 0x11, 0x23, 0x11, 0x03, 0x87, 0xfd, 0xbf, 0x03, 0xaf, 0xfe, 0x44, 0xfe, 0xfb,
-    0x02, 0x07, 0x92, 0x01, 0x63, 0xfe, 0x46, 0x2c, 0x92, 0x02, 0x01, 0xfe, 0xe9, 0xfd, 0x16, 0x01,
-    0xe9, 0xdc, 0xfd, 0x66, 0xfb, 0x02, 0x66, 0xb7, 0xb7, 0x02, 0xbd, 0xfa, 0xdd, 0x05, 0xb0, 0xfa,
-    0x50, 0x05, 0x2b, 0x85, 0xfa, 0x50, 0x02, 0x66, 0xb8, 0xb8, 0x4a, 0xfd, 0xe4, 0x02, 0x1c, 0x03,
-    0x94, 0xfa, 0x50, 0x05, 0xb0, 0x00, 0x00, 0x06, 0x00, 0x9a, 0x00, 0x00, 0x06, 0x1d, 0x04, 0x3a,
-    0x00, 0x03, 0x00, 0x08, 0x00, 0x0d, 0x00, 0x11, 0x00, 0x15, 0x00, 0x19, 0x00, 0x2e, 0x40, 0x17,
-    0x15, 0x11, 0x11, 0x10, 0x10, 0x03, 0x02, 0x02, 0x18, 0x19, 0x06, 0x72, 0x09, 0x14, 0x14, 0x06,
-    0x06, 0x18, 0x0a, 0x0b, 0x07, 0x06, 0x72, 0x00, 0x2b, 0x32, 0x3f, 0x33, 0x11, 0x33, 0x11, 0x33,
-    0x2b, 0x12, 0x39, 0x2f, 0x33, 0x33, 0x11, 0x33, 0x11, 0x33, 0x30, 0x31, 0x41, 0x15, 0x21, 0x35,
-    0x01, 0x01, 0x23, 0x01, 0x33, 0x13, 0x01, 0x03, 0x33, 0x01, 0x03, 0x15, 0x21, 0x35, 0x05, 0x11,
-    0x23, 0x11, 0x01, 0x11, 0x23, 0x11, 0x03, 0x24, 0xfd, 0xc3, 0x02, 0xfa, 0xfe, 0xf7, 0xf7, 0x01,
-    0xa9, 0xb5, 0xe8, 0xfe, 0xf2, 0x5a, 0xb5, 0x01, 0xa9, 0xcb, 0xfd, 0x63, 0x01, 0xa5, 0xb9, 0xfd,
-    0xeb, 0xf2, 0x01, 0xc5, 0xa8, 0xa8, 0x01, 0x08, 0xfd, 0x33, 0x04, 0x3a, 0xfb, 0xc6, 0x02, 0xcd,
-    0x01, 0x6d, 0xfb, 0xc6, 0x01, 0xc5, 0xa9, 0xa9, 0x40, 0xfe, 0x7b, 0x01, 0x85, 0x02, 0xb5, 0xfb,
-    0xc6, 0x04, 0x3a, 0x00, 0x00, 0x05, 0x00, 0x7e, 0x00, 0x00, 0x06, 0x67, 0x05, 0xb0, 0x00, 0x16,
-    0x00, 0x1a, 0x00, 0x1f, 0x00, 0x24, 0x00, 0x28, 0x00, 0x34, 0x40, 0x19, 0x19, 0x1a, 0x1a, 0x24,
-    0x1b, 0x1f, 0x1f, 0x23, 0x23, 0x13, 0x28, 0x06, 0x06, 0x13, 0x13, 0x01, 0x1c, 0x24, 0x02, 0x72,
-    0x0d, 0x27, 0x27, 0x01, 0x08, 0x00, 0x3f, 0x33, 0x11, 0x33, 0x2b, 0x32, 0x12, 0x39, 0x2f, 0x33,
-    0x11, 0x33, 0x11, 0x33, 0x11, 0x33, 0x11, 0x33, 0x11, 0x33, 0x11, 0x33, 0x30, 0x31, 0x61, 0x23,
-    0x11, 0x34, 0x36, 0x36, 0x33, 0x21, 0x32, 0x16, 0x16, 0x15, 0x11, 0x23, 0x11, 0x34, 0x26, 0x26,
-    0x23, 0x21, 0x22, 0x06, 0x15, 0x01, 0x15, 0x21, 0x35, 0x01, 0x01, 0x21, 0x01, 0x23, 0x01, 0x01,
-    0x07, 0x23, 0x01, 0x01, 0x11, 0x23, 0x11, 0x01, 0x79, 0xfb, 0x7b, 0xe6, 0xa2, 0x01, 0xe3, 0xa2,
-    0xe7, 0x7a, 0xfa, 0x3a, 0x75, 0x5a, 0xfe, 0x1d, 0x85, 0x83, 0x03, 0x93, 0xfc, 0xef, 0x01, 0x42,
-    0x01, 0x9d, 0x01, 0x16, 0xfe, 0x00, 0x93, 0xfe, 0xc9, 0x01, 0xa0, 0x24, 0x92, 0xfd, 0xff, 0x02,
-    0xea, 0xfa, 0x01, 0x61, 0xa6, 0xc6, 0x58, 0x58, 0xc6, 0xa6, 0xfe, 0x9f, 0x01, 0x61, 0x62, 0x6d,
-    0x2d, 0x69, 0x93, 0x04, 0x4f, 0xc9, 0xc9, 0xfd, 0x0a, 0x02, 0xf6, 0xfc, 0x97, 0x03, 0x69, 0xfd,
-    0x03, 0x6c, 0x03, 0x69, 0xfd, 0x51, 0xfc, 0xff, 0x03, 0x01, 0x00, 0x05, 0x00, 0x81, 0x00, 0x00,
-    0x05, 0x5d, 0x04, 0x3b, 0x00, 0x17, 0x00, 0x1b, 0x00, 0x20, 0x00, 0x25, 0x00, 0x29, 0x00, 0x30,
-    0x40, 0x17, 0x1a, 0x1b, 0x1b, 0x25, 0x20, 0x24, 0x24, 0x13, 0x29, 0x06, 0x06, 0x13, 0x13, 0x01,
-    0x1d, 0x25, 0x06, 0x72, 0x0d, 0x28, 0x28, 0x01, 0x0a, 0x00, 0x3f, 0x33, 0x11, 0x33, 0x2b, 0x32,
-    0x12, 0x39, 0x2f, 0x33, 0x11, 0x33, 0x11, 0x33, 0x11, 0x33, 0x11, 0x33, 0x11, 0x33, 0x30, 0x31,
-    0x61, 0x23, 0x35, 0x34, 0x36, 0x36, 0x33, 0x21, 0x32, 0x16, 0x16, 0x15, 0x15, 0x23, 0x35, 0x34,
-    0x26, 0x26, 0x23, 0x21, 0x22, 0x06, 0x06, 0x15, 0x01, 0x15, 0x21, 0x35, 0x01, 0x01, 0x21, 0x01,
-    0x23, 0x03, 0x01, 0x07, 0x23, 0x01, 0x01, 0x11, 0x23, 0x11, 0x01, 0x72, 0xf1, 0x6e, 0xd0, 0x91,
-    0x01, 0x3e, 0x90, 0xcf, 0x70, 0xf2, 0x30, 0x62, 0x4b, 0xfe, 0xc2, 0x4b, 0x63, 0x30, 0x02, 0xfc,
-    0xfd, 0x2f, 0x01, 0x20, 0x01, 0x2c, 0x01, 0x08, 0xfe, 0x6f, 0x87, 0xd7, 0x01, 0x30, 0x1f, 0x87,
-    0xfe, 0x6e, 0x02, 0x71, 0xf1, 0xae, 0x9f, 0xbf, 0x55, 0x55, 0xbf, 0x9f, 0xae, 0xae, 0x61, 0x6d,
-    0x2c, 0x2c, 0x6d, 0x61, 0x03, 0x8d, 0xab, 0xab, 0xfd, 0xba, 0x02, 0x45, 0xfd, 0x5a, 0x02, 0xa6,
-    0xfd, 0xb5, 0x5b, 0x02, 0xa6, 0xfd, 0xec, 0xfd, 0xda, 0x02, 0x26, 0x00, 0x00, 0x07, 0x00, 0xa5,
-    0x00, 0x00, 0x08, 0xac, 0x05, 0xb0, 0x00, 0x03, 0x00, 0x07, 0x00, 0x1e, 0x00, 0x22, 0x00, 0x27,
-    0x00, 0x2c, 0x00, 0x30, 0x00, 0x3c, 0x40, 0x1e, 0x21, 0x22, 0x22, 0x24, 0x2c, 0x02, 0x72, 0x27,
-    0x2b, 0x2b, 0x1b, 0x30, 0x0e, 0x0e, 0x1b, 0x1b, 0x03, 0x02, 0x02, 0x05, 0x07, 0x02, 0x72, 0x15,
-    0x2f, 0x2f, 0x09, 0x09, 0x05, 0x08, 0x00, 0x3f, 0x33, 0x11, 0x33, 0x11, 0x33, 0x2b, 0x12, 0x39,
-    0x2f, 0x33, 0x33, 0x11, 0x33, 0x11, 0x33, 0x11, 0x33, 0x11, 0x33, 0x2b, 0x32, 0x32, 0x11, 0x33,
-    0x30, 0x31, 0x41, 0x15, 0x21, 0x35, 0x13, 0x11, 0x23, 0x11, 0x01, 0x23, 0x11, 0x34, 0x36, 0x36,
-    0x33, 0x21, 0x32, 0x16, 0x16, 0x15, 0x11, 0x23, 0x11, 0x34, 0x26, 0x26, 0x23, 0x21, 0x22, 0x06,
-    0x15, 0x01, 0x15, 0x21, 0x35, 0x01, 0x01, 0x21, 0x01, 0x23, 0x01, 0x01, 0x07, 0x23, 0x01, 0x01,
-    0x11, 0x23, 0x11, 0x05, 0x02, 0xfc, 0x51, 0x4d, 0xfb, 0x03, 0x19, 0xfa, 0x7a, 0xe7, 0xa1, 0x01,
-    0xe4, 0xa2, 0xe6, 0x7a, 0xfa, 0x3a, 0x75, 0x59, 0xfe, 0x1c, 0x85, 0x83, 0x03, 0x94, 0xfc, 0xee,
-    0x01, 0x42, 0x01, 0x9e, 0x01, 0x16, 0xfd, 0xfe, 0x91, 0xfe, 0xc8, 0x01, 0xa1, 0x25, 0x91, 0xfd,
-    0xff, 0x02, 0xe9, 0xfa, 0x03, 0x27, 0xc0, 0xc0, 0x02, 0x89, 0xfa, 0x50, 0x05, 0xb0, 0xfa, 0x50,
-    0x01, 0x61, 0xa6, 0xc6, 0x58, 0x58, 0xc6, 0xa6, 0xfe, 0x9f, 0x01, 0x61, 0x62, 0x6d, 0x2d, 0x69,
-    0x93, 0x04, 0x4f, 0xc9, 0xc9, 0xfd, 0x0a, 0x02, 0xf6, 0xfc, 0x97, 0x03, 0x69, 0xfd, 0x03, 0x6c,
-    0x03, 0x69, 0xfd, 0x51, 0xfc, 0xff, 0x03, 0x01, 0x00, 0x07, 0x00, 0x90, 0x00, 0x00, 0x07, 0x6e,
-    0x04, 0x3b, 0x00, 0x03, 0x00, 0x07, 0x00, 0x1f, 0x00, 0x23, 0x00, 0x28, 0x00, 0x2d, 0x00, 0x31,
-    0x00, 0x3e, 0x40, 0x1e, 0x25, 0x22, 0x23, 0x23, 0x2d, 0x2d, 0x07, 0x28, 0x2c, 0x2c, 0x1b, 0x31,
-    0x0e, 0x0e, 0x1b, 0x1b, 0x03, 0x02, 0x02, 0x06, 0x07, 0x06, 0x72, 0x15, 0x30, 0x30, 0x09, 0x09,
-    0x06, 0x0a, 0x00, 0x3f, 0x33, 0x11, 0x33, 0x11, 0x33, 0x2b, 0x12, 0x39, 0x2f, 0x33, 0x33, 0x11,
-    0x33, 0x11, 0x33, 0x11, 0x33, 0x11, 0x33, 0x11, 0x33, 0x11, 0x33, 0x11, 0x33, 0x33, 0x30, 0x31,
-    0x41, 0x15, 0x21, 0x35, 0x13, 0x11, 0x23, 0x11, 0x01, 0x23, 0x35, 0x34, 0x36, 0x36, 0x33, 0x21,
-    0x32, 0x16, 0x16, 0x15, 0x15, 0x23, 0x35, 0x34, 0x26, 0x26, 0x23, 0x21, 0x22, 0x06, 0x06, 0x15,
-    0x01, 0x15, 0x21, 0x35, 0x01, 0x01, 0x21, 0x01, 0x23, 0x03, 0x01, 0x07, 0x23, 0x01, 0x01, 0x11,
-    0x23, 0x11, 0x04, 0xcf, 0xfc, 0x21, 0x91, 0xf1, 0x02, 0xf3, 0xf1, 0x6e, 0xd0, 0x91, 0x01, 0x3e,
-    0x90, 0xcf, 0x70, 0xf2, 0x30, 0x62, 0x4b, 0xfe, 0xc2, 0x4b, 0x63, 0x30, 0x02, 0xfc, 0xfd, 0x2f,
-    0x01, 0x20, 0x01, 0x2c, 0x01, 0x08, 0xfe, 0x6f, 0x87, 0xd6, 0x01, 0x30, 0x20, 0x87, 0xfe, 0x6e,
-    0x02, 0x71, 0xf1, 0x02, 0x61, 0xb5, 0xb5, 0x01, 0xd9, 0xfb, 0xc6, 0x04, 0x3a, 0xfb, 0xc6, 0xae,
-    0x9f, 0xbf, 0x55, 0x55, 0xbf, 0x9f, 0xae, 0xae, 0x61, 0x6d, 0x2c, 0x2c, 0x6d, 0x61, 0x03, 0x8d,
-    0xab, 0xab, 0xfd, 0xba, 0x02, 0x45, 0xfd, 0x5a, 0x02, 0xa6, 0xfd, 0xb5, 0x5b, 0x02, 0xa6, 0xfd,
-    0xec, 0xfd, 0xda, 0x02, 0x26, 0x00, 0x00, 0x03, 0x00, 0x28, 0xfe, 0x44, 0x03, 0xb1, 0x07, 0x87,
-    0x00, 0x17, 0x00, 0x40, 0x00, 0x49, 0x00, 0x2b, 0x40, 0x14, 0x18, 0x0d, 0x0c, 0x40, 0x40, 0x00,
-    0x2b, 0x2c, 0x09, 0x45, 0x43, 0x43, 0x42, 0x48, 0x41, 0x80, 0x47, 0x17, 0x00, 0x02, 0x00, 0x3f,
-    0x32, 0xde, 0x1a, 0xcd, 0x32, 0x39, 0x32, 0x11, 0x33, 0x3f, 0x33, 0x12, 0x39, 0x2f, 0x33, 0x33,
-    0x33, 0x30, 0x31, 0x53, 0x21, 0x32, 0x1e, 0x02, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x23, 0x35, 0x33,
-    0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x21, 0x13, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x14,
-    0x0e, 0x02, 0x23, 0x23, 0x22, 0x06, 0x15, 0x14, 0x16, 0x16, 0x17, 0x07, 0x2e, 0x02, 0x27, 0x34,
-    0x36, 0x36, 0x33, 0x33, 0x32, 0x3e, 0x02, 0x35, 0x34, 0x2e, 0x02, 0x23, 0x23, 0x13, 0x17, 0x37,
-    0x33, 0x15, 0x01, 0x23, 0x01, 0x35, 0x7f, 0x01, 0x19, 0x70, 0xb8, 0x85, 0x49, 0x48, 0x84, 0xb9,
-    0x71, 0x97, 0x92, 0x5f, 0x74, 0x36, 0x37, 0x73, 0x5a, 0xfe, 0xe7, 0x82, 0x92, 0x81, 0xc9, 0x8c,
-    0x48, 0x49, 0x84, 0xb5, 0x6d, 0x39, 0x45, 0x3d, 0x35, 0x48, 0x1c, 0x4e, 0x56, 0x85, 0x4e, 0x01,
-    0x55, 0x9a, 0x6a, 0x38, 0x3d, 0x62, 0x44, 0x23, 0x28, 0x4c, 0x72, 0x4a, 0x8e, 0x6d, 0x95, 0x96,
-    0xcf, 0xfe, 0xe7, 0x97, 0xfe, 0xe8, 0x05, 0xb0, 0x31, 0x61, 0x91, 0x5f, 0x55, 0x87, 0x5f, 0x33,
-    0x8c, 0x37, 0x61, 0x3e, 0x3a, 0x5c, 0x35, 0xfe, 0x24, 0x32, 0x60, 0x8d, 0x5b, 0x66, 0x9f, 0x6d,
-    0x39, 0x3a, 0x2e, 0x31, 0x43, 0x2a, 0x0d, 0x95, 0x18, 0x60, 0x8a, 0x57, 0x5e, 0x79, 0x3b, 0x22,
-    0x3d, 0x54, 0x31, 0x3d, 0x5c, 0x3e, 0x1f, 0x04, 0xfe, 0x9d, 0x9d, 0x0b, 0xfe, 0xeb, 0x01, 0x16,
-    0x0a, 0x00, 0x00, 0x03, 0x00, 0x32, 0xfe, 0x4c, 0x03, 0x89, 0x06, 0x1b, 0x00, 0x18, 0x00, 0x41,
-    0x00, 0x4a, 0x00, 0x26, 0x40, 0x11, 0x0d, 0x19, 0x0c, 0x41, 0x41, 0x00, 0x2d, 0x43, 0x49, 0x46,
-    0x44, 0x42, 0x80, 0x48, 0x18, 0x00, 0x06, 0x00, 0x3f, 0x32, 0xde, 0x1a, 0xcd, 0x32, 0x32, 0x32,
-    0x39, 0x2f, 0x12, 0x39, 0x2f, 0x33, 0x33, 0x33, 0x30, 0x31, 0x53, 0x21, 0x32, 0x1e, 0x02, 0x15,
-    0x14, 0x0e, 0x02, 0x23, 0x23, 0x35, 0x33, 0x32, 0x36, 0x36, 0x35, 0x34, 0x2e, 0x02, 0x23, 0x21,
-    0x13, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x23, 0x22, 0x06, 0x15, 0x14, 0x16,
-    0x16, 0x17, 0x07, 0x2e, 0x02, 0x27, 0x34, 0x36, 0x36, 0x33, 0x33, 0x32, 0x3e, 0x02, 0x35, 0x34,
-    0x2e, 0x02, 0x23, 0x23, 0x13, 0x17, 0x37, 0x33, 0x15, 0x01, 0x23, 0x01, 0x35, 0x7d, 0x01, 0x16,
-    0x68, 0xab, 0x7d, 0x44, 0x42, 0x79, 0xa9, 0x68, 0x9f, 0x9b, 0x50, 0x62, 0x2c, 0x1b, 0x37, 0x56,
-    0x3a, 0xfe, 0xea, 0x7f, 0x9b, 0x77, 0xb9, 0x80, 0x42, 0x41, 0x79, 0xa7, 0x63, 0x31, 0x4c, 0x3f,
-    0x32, 0x44, 0x1a, 0x4d, 0x49, 0x7f, 0x51, 0x01, 0x51, 0x93, 0x64, 0x32, 0x37, 0x58, 0x3d, 0x20,
-    0x22, 0x43, 0x61, 0x3f, 0x97, 0x42, 0x95, 0x96, 0xcf, 0xfe, 0xe8, 0x98, 0xfe, 0xe8, 0x04, 0x3a,
-    0x26, 0x4d, 0x72, 0x4a, 0x41, 0x68, 0x4a, 0x27, 0x7d, 0x25, 0x42, 0x2b, 0x1d, 0x31, 0x23, 0x14,
-    0xfe, 0xbd, 0x24, 0x46, 0x66, 0x42, 0x4c, 0x78, 0x54, 0x2c, 0x3a, 0x2e, 0x31, 0x43, 0x2a, 0x0d,
-    0x8d, 0x1a, 0x5e, 0x86, 0x53, 0x59, 0x72, 0x38, 0x16, 0x27, 0x36, 0x20, 0x26, 0x38, 0x26, 0x13,
-    0x04, 0x51, 0x9d, 0x9d, 0x0b, 0xfe, 0xeb, 0x01, 0x16, 0x0a, 0x00, 0x03, 0x00, 0x60, 0xff, 0xec,
-    0x05, 0x19, 0x05, 0xc4, 0x00, 0x17, 0x00, 0x28, 0x00, 0x39, 0x00, 0x1f, 0x40, 0x12, 0x0c, 0x29,
-    0x6a, 0x32, 0x20, 0x6a, 0x32, 0x32, 0x0c, 0x00, 0x18, 0x6a, 0x00, 0x03, 0x72, 0x0c, 0x09, 0x72,
-    0x00, 0x2b, 0x2b, 0x2b, 0x12, 0x39, 0x2f, 0x2b, 0x2b, 0x30, 0x31, 0x41, 0x32, 0x1e, 0x03, 0x15,
-    0x15, 0x14, 0x02, 0x06, 0x06, 0x23, 0x22, 0x2e, 0x03, 0x35, 0x35, 0x34, 0x12, 0x36, 0x36, 0x17,
-    0x22, 0x0e, 0x02, 0x07, 0x06, 0x06, 0x15, 0x21, 0x26, 0x26, 0x27, 0x2e, 0x03, 0x03, 0x32, 0x3e,
-    0x02, 0x37, 0x36, 0x36, 0x35, 0x21, 0x16, 0x16, 0x17, 0x1e, 0x03, 0x02, 0xbc, 0x6c, 0xbb, 0x94,
-    0x6a, 0x38, 0x56, 0xa0, 0xdd, 0x88, 0x6a, 0xba, 0x95, 0x6c, 0x39, 0x58, 0xa1, 0xde, 0x85, 0x48,
-    0x79, 0x59, 0x39, 0x09, 0x01, 0x02, 0x02, 0xc0, 0x01, 0x01, 0x02, 0x09, 0x37, 0x59, 0x79, 0x49,
-    0x4c, 0x7a, 0x58, 0x36, 0x08, 0x01, 0x01, 0xfd, 0x41, 0x01, 0x02, 0x01, 0x0a, 0x38, 0x5a, 0x79,
-    0x05, 0xc4, 0x3f, 0x78, 0xac, 0xdd, 0x84, 0x50, 0xa5, 0xfe, 0xfa, 0xb8, 0x61, 0x3f, 0x77, 0xad,
-    0xdd, 0x84, 0x50, 0xa5, 0x01, 0x05, 0xb9, 0x61, 0xcd, 0x34, 0x65, 0x96, 0x62, 0x0e, 0x1f, 0x10,
-    0x0f, 0x1f, 0x0e, 0x63, 0x95, 0x66, 0x34, 0xfb, 0xc1, 0x35, 0x6a, 0x9a, 0x64, 0x0b, 0x17, 0x0b,
-    0x0f, 0x1c, 0x0d, 0x62, 0x96, 0x66, 0x34, 0x00, 0x00, 0x03, 0x00, 0x4d, 0xff, 0xec, 0x04, 0x3b,
-    0x04, 0x4e, 0x00, 0x15, 0x00, 0x20, 0x00, 0x2b, 0x00, 0x1f, 0x40, 0x12, 0x0b, 0x21, 0x6a, 0x27,
-    0x1b, 0x6a, 0x27, 0x27, 0x0b, 0x00, 0x16, 0x6a, 0x00, 0x07, 0x72, 0x0b, 0x0b, 0x72, 0x00, 0x2b,
-    0x2b, 0x2b, 0x12, 0x39, 0x2f, 0x2b, 0x2b, 0x30, 0x31, 0x41, 0x32, 0x1e, 0x02, 0x15, 0x15, 0x14,
-    0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x35, 0x34, 0x3e, 0x02, 0x17, 0x22, 0x0e, 0x02, 0x07,
-    0x21, 0x2e, 0x03, 0x03, 0x32, 0x3e, 0x02, 0x37, 0x21, 0x1e, 0x03, 0x02, 0x43, 0x77, 0xbc, 0x81,
-    0x44, 0x44, 0x81, 0xba, 0x77, 0x77, 0xbb, 0x82, 0x44, 0x44, 0x81, 0xbb, 0x76, 0x3b, 0x5b, 0x3f,
-    0x25, 0x07, 0x02, 0x04, 0x06, 0x26, 0x40, 0x5b, 0x3a, 0x3b, 0x5b, 0x3f, 0x26, 0x06, 0xfd, 0xfc,
-    0x06, 0x25, 0x40, 0x5c, 0x04, 0x4e, 0x53, 0x95, 0xc9, 0x75, 0x17, 0x75, 0xc8, 0x95, 0x53, 0x53,
-    0x95, 0xc8, 0x75, 0x17, 0x75, 0xc9, 0x95, 0x53, 0xc0, 0x2c, 0x4e, 0x68, 0x3b, 0x3b, 0x68, 0x4e,
-    0x2c, 0xfd, 0x1e, 0x2b, 0x4f, 0x68, 0x3d, 0x3d, 0x68, 0x4f, 0x2b, 0x00, 0x00, 0x02, 0x00, 0x10,
-    0x00, 0x00, 0x04, 0xf5, 0x05, 0xc3, 0x00, 0x0e, 0x00, 0x13, 0x00, 0x19, 0x40, 0x0d, 0x0e, 0x12,
-    0x08, 0x05, 0x13, 0x02, 0x72, 0x05, 0x03, 0x72, 0x12, 0x08, 0x72, 0x00, 0x2b, 0x2b, 0x2b, 0x11,
-    0x33, 0x11, 0x33, 0x30, 0x31, 0x41, 0x13, 0x3e, 0x02, 0x33, 0x17, 0x07, 0x23, 0x22, 0x06, 0x06,
-    0x07, 0x01, 0x23, 0x01, 0x01, 0x13, 0x23, 0x01, 0x02, 0x93, 0xe7, 0x22, 0x5a, 0x7e, 0x58, 0x29,
-    0x01, 0x16, 0x1f, 0x31, 0x26, 0x0e, 0xfe, 0x9c, 0xbc, 0xfe, 0xe2, 0x01, 0x44, 0x5a, 0xbc, 0xfe,
-    0x12, 0x01, 0x7c, 0x03, 0x05, 0x6c, 0x8f, 0x47, 0x01, 0xd2, 0x1d, 0x39, 0x2c, 0xfb, 0x92, 0x05,
-    0xb0, 0xfb, 0xce, 0xfe, 0x82, 0x05, 0xb0, 0x00, 0x00, 0x02, 0x00, 0x1e, 0x00, 0x00, 0x04, 0x1a,
-    0x04, 0x4e, 0x00, 0x12, 0x00, 0x17, 0x00, 0x15, 0x40, 0x0b, 0x17, 0x06, 0x72, 0x12, 0x16, 0x0a,
-    0x72, 0x0c, 0x05, 0x07, 0x72, 0x00, 0x2b, 0x32, 0x2b, 0x32, 0x2b, 0x30, 0x31, 0x41, 0x13, 0x3e,
-    0x02, 0x33, 0x32, 0x16, 0x17, 0x07, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x07, 0x01, 0x23, 0x03,
-    0x13, 0x13, 0x23, 0x01, 0x02, 0x0a, 0x7b, 0x1e, 0x56, 0x72, 0x46, 0x1d, 0x34, 0x18, 0x17, 0x04,
-    0x1e, 0x0e, 0x17, 0x2b, 0x21, 0x0a, 0xfe, 0xfa, 0xa2, 0xa6, 0xc6, 0x4c, 0xa2, 0xfe, 0x96, 0x01,
-    0x6c, 0x01, 0xc2, 0x62, 0x7f, 0x3f, 0x07, 0x0e, 0xbc, 0x02, 0x04, 0x19, 0x2c, 0x1d, 0xfc, 0xdf,
-    0x04, 0x3a, 0xfd, 0x32, 0xfe, 0x94, 0x04, 0x3a, 0x00, 0x04, 0x00, 0x60, 0xff, 0x76, 0x05, 0x19,
-    0x06, 0x2e, 0x00, 0x03, 0x00, 0x07, 0x00, 0x1f, 0x00, 0x37, 0x00, 0x24, 0x40, 0x10, 0x02, 0x02,
-    0x27, 0x27, 0x03, 0x1a, 0x03, 0x72, 0x07, 0x07, 0x33, 0x33, 0x06, 0x0e, 0x09, 0x72, 0x00, 0x2b,
-    0xcd, 0x33, 0x11, 0x33, 0x7c, 0x2f, 0x2b, 0x18, 0xcd, 0x33, 0x11, 0x33, 0x7d, 0x2f, 0x30, 0x31,
-    0x41, 0x11, 0x23, 0x11, 0x13, 0x11, 0x23, 0x11, 0x01, 0x15, 0x14, 0x02, 0x06, 0x06, 0x23, 0x22,
-    0x2e, 0x03, 0x35, 0x35, 0x34, 0x12, 0x36, 0x36, 0x33, 0x32, 0x1e, 0x03, 0x07, 0x35, 0x34, 0x2e,
-    0x03, 0x23, 0x22, 0x0e, 0x02, 0x15, 0x15, 0x14, 0x1e, 0x03, 0x33, 0x32, 0x3e, 0x02, 0x03, 0x1b,
-    0xbc, 0xbd, 0xbc, 0x02, 0xb9, 0x56, 0xa0, 0xdd, 0x88, 0x6a, 0xba, 0x95, 0x6c, 0x39, 0x58, 0xa1,
-    0xde, 0x85, 0x6c, 0xbb, 0x94, 0x6a, 0x38, 0xfc, 0x1e, 0x3b, 0x55, 0x6f, 0x44, 0x52, 0x82, 0x5b,
-    0x31, 0x20, 0x3c, 0x56, 0x6f, 0x41, 0x55, 0x82, 0x5a, 0x2e, 0x06, 0x2e, 0xfe, 0x59, 0x01, 0xa7,
-    0xfa, 0xf8, 0xfe, 0x50, 0x01, 0xb0, 0x01, 0xda, 0x50, 0xa5, 0xfe, 0xfa, 0xb8, 0x61, 0x3f, 0x77,
-    0xad, 0xdd, 0x84, 0x50, 0xa5, 0x01, 0x05, 0xb9, 0x61, 0x3f, 0x78, 0xac, 0xdd, 0xd4, 0x52, 0x61,
-    0x9f, 0x79, 0x52, 0x2a, 0x41, 0x7f, 0xbb, 0x7a, 0x52, 0x62, 0x9f, 0x7a, 0x53, 0x2a, 0x41, 0x81,
-    0xbc, 0x00, 0x00, 0x04, 0x00, 0x4e, 0xff, 0x86, 0x04, 0x3c, 0x04, 0xb5, 0x00, 0x03, 0x00, 0x07,
-    0x00, 0x1d, 0x00, 0x33, 0x00, 0x24, 0x40, 0x10, 0x07, 0x07, 0x24, 0x24, 0x06, 0x19, 0x0b, 0x72,
-    0x02, 0x02, 0x2f, 0x2f, 0x03, 0x0e, 0x07, 0x72, 0x00, 0x2b, 0xcd, 0x33, 0x11, 0x33, 0x7d, 0x2f,
-    0x2b, 0x18, 0xcd, 0x33, 0x11, 0x33, 0x7c, 0x2f, 0x30, 0x31, 0x41, 0x11, 0x23, 0x11, 0x13, 0x11,
-    0x23, 0x11, 0x25, 0x35, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x15, 0x14, 0x0e, 0x02,
-    0x23, 0x22, 0x2e, 0x02, 0x37, 0x15, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x3e, 0x02, 0x35, 0x35, 0x34,
-    0x2e, 0x02, 0x23, 0x22, 0x0e, 0x02, 0x02, 0x9b, 0xac, 0xa9, 0xac, 0xfe, 0x62, 0x44, 0x81, 0xbb,
-    0x76, 0x77, 0xbb, 0x82, 0x44, 0x44, 0x82, 0xba, 0x76, 0x77, 0xbb, 0x82, 0x44, 0xf1, 0x1e, 0x40,
-    0x64, 0x45, 0x43, 0x63, 0x40, 0x1f, 0x1f, 0x41, 0x63, 0x44, 0x44, 0x63, 0x40, 0x1e, 0x04, 0xb5,
-    0xfe, 0x68, 0x01, 0x98, 0xfc, 0x70, 0xfe, 0x61, 0x01, 0x9f, 0xec, 0x17, 0x75, 0xc9, 0x95, 0x53,
-    0x53, 0x95, 0xc9, 0x75, 0x17, 0x75, 0xc8, 0x95, 0x53, 0x53, 0x95, 0xc8, 0x8c, 0x17, 0x49, 0x82,
-    0x62, 0x38, 0x38, 0x62, 0x82, 0x49, 0x17, 0x48, 0x81, 0x64, 0x39, 0x39, 0x64, 0x81, 0x00, 0x04,
-    0x00, 0x88, 0xff, 0xeb, 0x06, 0xc2, 0x07, 0x3b, 0x00, 0x15, 0x00, 0x20, 0x00, 0x41, 0x00, 0x65,
-    0x00, 0x33, 0x40, 0x19, 0x5b, 0x4e, 0x09, 0x72, 0x54, 0x31, 0x31, 0x2c, 0x38, 0x09, 0x72, 0x42,
-    0x43, 0x43, 0x11, 0x08, 0x08, 0x1b, 0x1b, 0x16, 0x16, 0x22, 0x21, 0x02, 0x72, 0x00, 0x2b, 0x32,
-    0x32, 0x7c, 0x2f, 0x33, 0x18, 0x2f, 0x33, 0x11, 0x33, 0x32, 0x11, 0x33, 0x2b, 0x32, 0x32, 0x2f,
-    0x33, 0x2b, 0x32, 0x30, 0x31, 0x41, 0x33, 0x15, 0x23, 0x22, 0x2e, 0x02, 0x23, 0x22, 0x06, 0x15,
-    0x15, 0x23, 0x35, 0x34, 0x36, 0x33, 0x32, 0x1e, 0x02, 0x01, 0x27, 0x36, 0x36, 0x35, 0x35, 0x33,
-    0x15, 0x14, 0x06, 0x06, 0x25, 0x15, 0x22, 0x06, 0x06, 0x15, 0x11, 0x14, 0x1e, 0x02, 0x33, 0x32,
-    0x36, 0x36, 0x35, 0x11, 0x33, 0x11, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x11, 0x34,
-    0x36, 0x36, 0x05, 0x35, 0x32, 0x1e, 0x02, 0x15, 0x11, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02,
-    0x35, 0x11, 0x33, 0x11, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x3e, 0x02, 0x35, 0x11, 0x34, 0x2e, 0x02,
-    0x05, 0x4b, 0x1c, 0x1d, 0x56, 0x8b, 0x72, 0x60, 0x2c, 0x31, 0x3c, 0x81, 0x7d, 0x6e, 0x3a, 0x6d,
-    0x6f, 0x7f, 0xfe, 0x80, 0x4e, 0x21, 0x23, 0xa2, 0x31, 0x46, 0xfe, 0xb1, 0x3c, 0x5b, 0x35, 0x1e,
-    0x36, 0x4b, 0x2d, 0x43, 0x63, 0x38, 0xcb, 0x3f, 0x73, 0x9a, 0x5d, 0x62, 0xa6, 0x7b, 0x44, 0x77,
-    0xce, 0x03, 0x2e, 0x62, 0xa7, 0x7a, 0x44, 0x44, 0x7a, 0xa7, 0x62, 0x5b, 0x9b, 0x73, 0x3f, 0xcb,
-    0x20, 0x3a, 0x52, 0x31, 0x2d, 0x4b, 0x36, 0x1f, 0x1f, 0x36, 0x4b, 0x06, 0xbf, 0x82, 0x26, 0x30,
-    0x26, 0x34, 0x36, 0x12, 0x24, 0x6f, 0x6b, 0x25, 0x32, 0x25, 0xfe, 0x57, 0x38, 0x28, 0x48, 0x26,
-    0x5f, 0x66, 0x26, 0x4f, 0x40, 0x88, 0xc8, 0x3b, 0x79, 0x5e, 0xfd, 0xee, 0x46, 0x68, 0x43, 0x21,
-    0x37, 0x70, 0x57, 0x01, 0x86, 0xfe, 0x7a, 0x70, 0xaa, 0x72, 0x39, 0x3c, 0x77, 0xb1, 0x75, 0x02,
-    0x12, 0x9d, 0xd2, 0x6b, 0xc8, 0xc8, 0x3c, 0x77, 0xb2, 0x75, 0xfd, 0xee, 0x75, 0xb1, 0x77, 0x3c,
-    0x39, 0x72, 0xaa, 0x70, 0x01, 0x86, 0xfe, 0x7a, 0x41, 0x60, 0x3f, 0x1e, 0x21, 0x43, 0x68, 0x46,
-    0x02, 0x12, 0x46, 0x68, 0x43, 0x21, 0x00, 0x04, 0x00, 0x75, 0xff, 0xeb, 0x05, 0xe0, 0x05, 0xe2,
-    0x00, 0x15, 0x00, 0x20, 0x00, 0x42, 0x00, 0x66, 0x00, 0x33, 0x40, 0x19, 0x5c, 0x4f, 0x0b, 0x72,
-    0x55, 0x32, 0x32, 0x2c, 0x39, 0x0b, 0x72, 0x43, 0x44, 0x44, 0x11, 0x08, 0x08, 0x1b, 0x1b, 0x16,
-    0x16, 0x22, 0x21, 0x06, 0x72, 0x00, 0x2b, 0x32, 0x32, 0x7c, 0x2f, 0x33, 0x18, 0x2f, 0x33, 0x11,
-    0x33, 0x32, 0x11, 0x33, 0x2b, 0x32, 0x32, 0x2f, 0x33, 0x2b, 0x32, 0x30, 0x31, 0x41, 0x33, 0x15,
-    0x23, 0x22, 0x2e, 0x02, 0x23, 0x22, 0x06, 0x15, 0x15, 0x23, 0x35, 0x34, 0x36, 0x33, 0x32, 0x1e,
-    0x02, 0x01, 0x27, 0x36, 0x36, 0x35, 0x35, 0x33, 0x15, 0x14, 0x06, 0x06, 0x25, 0x15, 0x22, 0x06,
-    0x06, 0x15, 0x15, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x3e, 0x02, 0x35, 0x35, 0x33, 0x15, 0x14, 0x0e,
-    0x02, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x35, 0x34, 0x36, 0x36, 0x05, 0x35, 0x32, 0x1e, 0x02, 0x15,
-    0x15, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x35, 0x33, 0x15, 0x14, 0x1e, 0x02, 0x33,
-    0x32, 0x3e, 0x02, 0x35, 0x35, 0x34, 0x2e, 0x02, 0x04, 0xdf, 0x1e, 0x20, 0x56, 0x8b, 0x71, 0x60,
-    0x2c, 0x30, 0x3d, 0x81, 0x7d, 0x6e, 0x3b, 0x6b, 0x6f, 0x7f, 0xfe, 0x84, 0x4d, 0x21, 0x23, 0xa1,
-    0x31, 0x45, 0xfe, 0xdf, 0x33, 0x4f, 0x2c, 0x17, 0x2a, 0x39, 0x23, 0x28, 0x41, 0x2f, 0x1a, 0xbb,
-    0x36, 0x62, 0x85, 0x50, 0x56, 0x92, 0x6b, 0x3c, 0x6c, 0xbc, 0x02, 0xa3, 0x5a, 0x98, 0x70, 0x3e,
-    0x3b, 0x6c, 0x92, 0x57, 0x4e, 0x85, 0x63, 0x36, 0xbb, 0x1a, 0x2f, 0x41, 0x27, 0x23, 0x3b, 0x2a,
-    0x17, 0x19, 0x2f, 0x40, 0x05, 0x66, 0x81, 0x25, 0x31, 0x25, 0x33, 0x37, 0x12, 0x24, 0x6f, 0x6b,
-    0x25, 0x32, 0x25, 0xfe, 0x55, 0x38, 0x28, 0x49, 0x25, 0x5f, 0x66, 0x26, 0x4e, 0x41, 0x7b, 0xbf,
-    0x35, 0x6d, 0x55, 0xf1, 0x3f, 0x5d, 0x3d, 0x1d, 0x1c, 0x38, 0x57, 0x3b, 0xc5, 0xc5, 0x69, 0x9e,
-    0x6a, 0x35, 0x37, 0x6e, 0xa5, 0x6c, 0xf1, 0x91, 0xc3, 0x62, 0xbf, 0xbf, 0x37, 0x6e, 0xa4, 0x6d,
-    0xf1, 0x6c, 0xa5, 0x6e, 0x37, 0x35, 0x6a, 0x9e, 0x69, 0xc5, 0xc5, 0x3b, 0x57, 0x38, 0x1c, 0x1d,
-    0x3d, 0x5d, 0x3f, 0xf1, 0x40, 0x5d, 0x3c, 0x1e, 0x00, 0x03, 0x00, 0x88, 0xff, 0xeb, 0x06, 0xcf,
-    0x07, 0x10, 0x00, 0x07, 0x00, 0x20, 0x00, 0x38, 0x00, 0x2b, 0x40, 0x15, 0x34, 0x27, 0x09, 0x72,
-    0x05, 0x02, 0x01, 0x01, 0x07, 0x07, 0x2d, 0x21, 0x08, 0x08, 0x15, 0x02, 0x72, 0x1c, 0x0f, 0x09,
-    0x72, 0x00, 0x2b, 0x32, 0x2b, 0x32, 0x11, 0x33, 0x33, 0x33, 0x7c, 0x2f, 0x33, 0x18, 0x2f, 0x33,
-    0x33, 0x2b, 0x32, 0x30, 0x31, 0x41, 0x21, 0x35, 0x21, 0x17, 0x21, 0x15, 0x23, 0x07, 0x33, 0x11,
-    0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x11, 0x33, 0x11, 0x14, 0x1e, 0x02, 0x33, 0x32,
-    0x36, 0x36, 0x35, 0x01, 0x33, 0x11, 0x14, 0x06, 0x06, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x11, 0x33,
-    0x11, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x36, 0x36, 0x35, 0x03, 0x4f, 0xfe, 0xb7, 0x03, 0x51, 0x02,
-    0xfe, 0xa3, 0xad, 0x22, 0xcb, 0x3f, 0x73, 0x9a, 0x5d, 0x62, 0xa6, 0x7b, 0x44, 0xfb, 0x1e, 0x36,
-    0x4b, 0x2d, 0x43, 0x63, 0x38, 0x02, 0xa7, 0xfb, 0x79, 0xd0, 0x86, 0x59, 0x99, 0x70, 0x3f, 0xcc,
-    0x1f, 0x39, 0x4e, 0x2f, 0x3f, 0x60, 0x35, 0x06, 0x98, 0x78, 0x78, 0x7e, 0x6a, 0xfc, 0x00, 0x70,
-    0xaa, 0x72, 0x39, 0x39, 0x72, 0xaa, 0x70, 0x04, 0x00, 0xfc, 0x00, 0x41, 0x60, 0x3f, 0x1e, 0x37,
-    0x70, 0x57, 0x04, 0x00, 0xfc, 0x00, 0x95, 0xca, 0x66, 0x39, 0x72, 0xaa, 0x70, 0x04, 0x00, 0xfc,
-    0x00, 0x41, 0x60, 0x3f, 0x1e, 0x37, 0x70, 0x57, 0x00, 0x03, 0x00, 0x72, 0xff, 0xeb, 0x06, 0x03,
-    0x05, 0xb1, 0x00, 0x07, 0x00, 0x20, 0x00, 0x39, 0x00, 0x2b, 0x40, 0x15, 0x34, 0x27, 0x0b, 0x72,
-    0x05, 0x02, 0x01, 0x01, 0x07, 0x07, 0x2d, 0x21, 0x08, 0x08, 0x15, 0x06, 0x72, 0x1c, 0x0f, 0x0b,
-    0x72, 0x00, 0x2b, 0x32, 0x2b, 0x32, 0x11, 0x33, 0x33, 0x33, 0x7c, 0x2f, 0x33, 0x18, 0x2f, 0x33,
-    0x33, 0x2b, 0x32, 0x30, 0x31, 0x41, 0x21, 0x35, 0x21, 0x17, 0x21, 0x15, 0x23, 0x07, 0x33, 0x11,
-    0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x11, 0x33, 0x11, 0x14, 0x1e, 0x02, 0x33, 0x32,
-    0x36, 0x36, 0x35, 0x01, 0x33, 0x11, 0x14, 0x06, 0x06, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x11, 0x33,
-    0x11, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x3e, 0x02, 0x35, 0x02, 0xdf, 0xfe, 0xc7, 0x03, 0x30, 0x05,
-    0xfe, 0xb1, 0xad, 0x1b, 0xc4, 0x39, 0x67, 0x8e, 0x54, 0x58, 0x94, 0x6c, 0x3c, 0xf2, 0x17, 0x2b,
-    0x3b, 0x25, 0x39, 0x55, 0x30, 0x02, 0x4e, 0xf1, 0x6a, 0xbb, 0x77, 0x53, 0x89, 0x63, 0x36, 0xc4,
-    0x18, 0x2e, 0x42, 0x29, 0x26, 0x40, 0x2d, 0x18, 0x05, 0x39, 0x78, 0x78, 0x7f, 0x80, 0xfd, 0x57,
-    0x69, 0x9e, 0x6a, 0x35, 0x35, 0x6a, 0x9e, 0x69, 0x02, 0xa9, 0xfd, 0x57, 0x3b, 0x57, 0x38, 0x1c,
-    0x31, 0x66, 0x4f, 0x02, 0xa9, 0xfd, 0x57, 0x8c, 0xbb, 0x5f, 0x35, 0x6a, 0x9e, 0x69, 0x02, 0xa9,
-    0xfd, 0x57, 0x3b, 0x57, 0x38, 0x1c, 0x1c, 0x38, 0x57, 0x3b, 0x00, 0x02, 0x00, 0x67, 0xfe, 0x8e,
-    0x04, 0xb2, 0x05, 0xc5, 0x00, 0x21, 0x00, 0x25, 0x00, 0x19, 0x40, 0x0c, 0x16, 0x12, 0x0d, 0x03,
-    0x72, 0x25, 0x00, 0x00, 0x24, 0x01, 0x09, 0x72, 0x00, 0x2b, 0xcd, 0x33, 0x11, 0x33, 0x2b, 0xcc,
-    0x33, 0x30, 0x31, 0x65, 0x15, 0x22, 0x2e, 0x03, 0x35, 0x11, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x16,
-    0x16, 0x17, 0x23, 0x2e, 0x02, 0x23, 0x22, 0x0e, 0x02, 0x15, 0x11, 0x14, 0x1e, 0x03, 0x33, 0x11,
-    0x23, 0x11, 0x02, 0x95, 0x65, 0xad, 0x89, 0x60, 0x33, 0x4f, 0x94, 0xce, 0x7e, 0xa8, 0xf1, 0x82,
-    0x01, 0xfa, 0x01, 0x3f, 0x7f, 0x63, 0x4a, 0x74, 0x4e, 0x29, 0x1a, 0x33, 0x4a, 0x62, 0xda, 0xfa,
-    0xb2, 0xc7, 0x3a, 0x6d, 0x98, 0xbb, 0x6b, 0x01, 0x10, 0x86, 0xe0, 0xa5, 0x5a, 0x74, 0xde, 0x9f,
-    0x62, 0x84, 0x43, 0x3e, 0x70, 0x96, 0x57, 0xfe, 0xee, 0x46, 0x7e, 0x67, 0x4b, 0x28, 0xfd, 0xdc,
-    0x02, 0x24, 0x00, 0x02, 0x00, 0x5d, 0xfe, 0x8b, 0x03, 0xf4, 0x04, 0x4e, 0x00, 0x1f, 0x00, 0x23,
-    0x00, 0x19, 0x40, 0x0c, 0x15, 0x11, 0x0c, 0x07, 0x72, 0x20, 0x00, 0x00, 0x22, 0x01, 0x0b, 0x72,
-    0x00, 0x2b, 0xcd, 0x33, 0x11, 0x33, 0x2b, 0xcc, 0x33, 0x30, 0x31, 0x65, 0x15, 0x22, 0x2e, 0x02,
-    0x35, 0x35, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x16, 0x16, 0x15, 0x23, 0x34, 0x26, 0x26, 0x23, 0x22,
-    0x0e, 0x02, 0x15, 0x15, 0x14, 0x1e, 0x02, 0x33, 0x11, 0x23, 0x11, 0x02, 0x45, 0x77, 0xb6, 0x7c,
-    0x3f, 0x3f, 0x7c, 0xb6, 0x76, 0x7e, 0xc4, 0x6e, 0xe3, 0x33, 0x5c, 0x3e, 0x44, 0x5e, 0x39, 0x1b,
-    0x1b, 0x38, 0x60, 0xd9, 0xf1, 0xab, 0xc0, 0x55, 0x96, 0xc5, 0x70, 0x23, 0x70, 0xc5, 0x96, 0x55,
-    0x67, 0xb7, 0x79, 0x3c, 0x62, 0x39, 0x3b, 0x65, 0x7d, 0x43, 0x23, 0x43, 0x7e, 0x64, 0x3b, 0xfd,
-    0xe0, 0x02, 0x20, 0x00, 0x00, 0x01, 0x00, 0x70, 0x00, 0x00, 0x04, 0x90, 0x05, 0x3e, 0x00, 0x13,
-    0x00, 0x08, 0xb1, 0x0f, 0x05, 0x00, 0x2f, 0x2f, 0x30, 0x31, 0x41, 0x03, 0x05, 0x07, 0x25, 0x03,
-    0x23, 0x13, 0x25, 0x37, 0x05, 0x13, 0x25, 0x37, 0x05, 0x13, 0x33, 0x03, 0x05, 0x07, 0x03, 0x26,
-    0xce, 0x01, 0x21, 0x46, 0xfe, 0xdd, 0xb5, 0xab, 0xe1, 0xfe, 0xdf, 0x45, 0x01, 0x25, 0xcc, 0xfe,
-    0xde, 0x47, 0x01, 0x23, 0xbb, 0xa8, 0xe6, 0x01, 0x25, 0x4a, 0x03, 0x2a, 0xfe, 0x96, 0xac, 0x7e,
-    0xaa, 0xfe, 0xc0, 0x01, 0x8e, 0xab, 0x7d, 0xab, 0x01, 0x6b, 0xab, 0x7f, 0xab, 0x01, 0x49, 0xfe,
-    0x6a, 0xab, 0x7d, 0x00, 0x00, 0x01, 0xfc, 0x70, 0x04, 0xa5, 0xff, 0x37, 0x05, 0xfc, 0x00, 0x07,
-    0x00, 0x15, 0xb7, 0x06, 0x06, 0x04, 0x04, 0x01, 0x02, 0x02, 0x01, 0x00, 0x2f, 0x33, 0x2f, 0x11,
-    0x33, 0x11, 0x33, 0x7c, 0x2f, 0x30, 0x31, 0x43, 0x21, 0x15, 0x27, 0x37, 0x21, 0x27, 0x17, 0xc9,
-    0xfd, 0xe3, 0xaa, 0x01, 0x02, 0x1e, 0x01, 0xa9, 0x05, 0x23, 0x7e, 0x01, 0xea, 0x6c, 0x01, 0x00,
-    0x00, 0x01, 0xfc, 0x75, 0x05, 0x17, 0xff, 0x6b, 0x06, 0x15, 0x00, 0x15, 0x00, 0x12, 0xb6, 0x01,
-    0x14, 0x14, 0x0f, 0x06, 0x80, 0x0b, 0x00, 0x2f, 0x1a, 0xcc, 0x32, 0x33, 0x11, 0x33, 0x30, 0x31,
-    0x41, 0x33, 0x32, 0x3e, 0x02, 0x33, 0x32, 0x16, 0x15, 0x15, 0x23, 0x35, 0x34, 0x26, 0x23, 0x22,
-    0x0e, 0x02, 0x23, 0x23, 0xfc, 0x75, 0x1e, 0x50, 0x81, 0x71, 0x6d, 0x3b, 0x6f, 0x7f, 0x83, 0x3c,
-    0x33, 0x2c, 0x61, 0x73, 0x8d, 0x57, 0x20, 0x05, 0x99, 0x25, 0x32, 0x25, 0x6b, 0x6f, 0x24, 0x12,
-    0x37, 0x33, 0x25, 0x31, 0x25, 0x00, 0x00, 0x01, 0xfd, 0x81, 0x05, 0x19, 0xfe, 0x73, 0x06, 0x62,
-    0x00, 0x05, 0x00, 0x0a, 0xb2, 0x00, 0x80, 0x02, 0x00, 0x2f, 0x1a, 0xcd, 0x30, 0x31, 0x41, 0x27,
-    0x35, 0x33, 0x07, 0x17, 0xfe, 0x24, 0xa3, 0xb8, 0x01, 0x3b, 0x05, 0x19, 0xc3, 0x86, 0x97, 0x70,
-    0x00, 0x01, 0xfd, 0xa6, 0x05, 0x19, 0xfe, 0x97, 0x06, 0x62, 0x00, 0x05, 0x00, 0x0a, 0xb2, 0x01,
-    0x80, 0x04, 0x00, 0x2f, 0x1a, 0xcd, 0x30, 0x31, 0x41, 0x07, 0x27, 0x37, 0x27, 0x33, 0xfe, 0x97,
-    0xa3, 0x4e, 0x3a, 0x01, 0xb8, 0x05, 0xdc, 0xc3, 0x42, 0x70, 0x97, 0x00, 0x00, 0x08, 0xfa, 0x26,
-    0xfe, 0xc4, 0x01, 0xc2, 0x05, 0xaf, 0x00, 0x0d, 0x00, 0x1b, 0x00, 0x29, 0x00, 0x37, 0x00, 0x45,
-    0x00, 0x53, 0x00, 0x61, 0x00, 0x6f, 0x00, 0x00, 0x41, 0x23, 0x34, 0x36, 0x33, 0x32, 0x16, 0x15,
-    0x23, 0x34, 0x26, 0x23, 0x22, 0x06, 0x01, 0x23, 0x34, 0x36, 0x33, 0x32, 0x16, 0x15, 0x23, 0x34,
-    0x26, 0x23, 0x22, 0x06, 0x13, 0x23, 0x34, 0x36, 0x33, 0x32, 0x16, 0x15, 0x23, 0x34, 0x26, 0x23,
-    0x22, 0x06, 0x03, 0x23, 0x34, 0x36, 0x33, 0x32, 0x16, 0x15, 0x23, 0x34, 0x26, 0x23, 0x22, 0x06,
-    0x01, 0x23, 0x34, 0x36, 0x33, 0x32, 0x16, 0x15, 0x23, 0x34, 0x26, 0x23, 0x22, 0x06, 0x01, 0x23,
-    0x34, 0x36, 0x33, 0x32, 0x16, 0x15, 0x23, 0x34, 0x26, 0x23, 0x22, 0x06, 0x03, 0x23, 0x34, 0x36,
-    0x33, 0x32, 0x16, 0x15, 0x23, 0x34, 0x26, 0x23, 0x22, 0x06, 0x13, 0x23, 0x34, 0x36, 0x33, 0x32,
-    0x16, 0x15, 0x23, 0x34, 0x26, 0x23, 0x22, 0x06, 0xfd, 0x84, 0x71, 0x71, 0x61, 0x62, 0x71, 0x70,
-    0x2d, 0x36, 0x35, 0x2c, 0x02, 0x50, 0x72, 0x71, 0x61, 0x62, 0x72, 0x71, 0x2c, 0x37, 0x34, 0x2c,
-    0xba, 0x71, 0x71, 0x61, 0x62, 0x71, 0x70, 0x2c, 0x37, 0x34, 0x2d, 0xc5, 0x71, 0x71, 0x61, 0x62,
-    0x71, 0x70, 0x2c, 0x37, 0x34, 0x2d, 0xfd, 0xc0, 0x71, 0x71, 0x61, 0x62, 0x71, 0x70, 0x2d, 0x36,
-    0x34, 0x2d, 0xfd, 0xbf, 0x72, 0x72, 0x61, 0x62, 0x71, 0x70, 0x2d, 0x36, 0x35, 0x2c, 0xb1, 0x71,
-    0x71, 0x61, 0x62, 0x71, 0x70, 0x2c, 0x37, 0x34, 0x2d, 0xa7, 0x72, 0x71, 0x61, 0x62, 0x72, 0x71,
-    0x2c, 0x37, 0x34, 0x2c, 0x04, 0xf3, 0x53, 0x69, 0x69, 0x53, 0x28, 0x3d, 0x3d, 0xfe, 0xc3, 0x53,
-    0x69, 0x69, 0x53, 0x28, 0x3d, 0x3d, 0xfd, 0xe1, 0x53, 0x69, 0x69, 0x53, 0x28, 0x3d, 0x3d, 0xfd,
-    0xd1, 0x53, 0x69, 0x69, 0x53, 0x28, 0x3d, 0x3d, 0xfe, 0xbc, 0x53, 0x69, 0x69, 0x53, 0x28, 0x3d,
-    0x3d, 0x04, 0xf2, 0x53, 0x69, 0x69, 0x53, 0x28, 0x3d, 0x3d, 0xfd, 0xe1, 0x53, 0x69, 0x69, 0x53,
-    0x28, 0x3d, 0x3d, 0xfd, 0xd1, 0x53, 0x69, 0x69, 0x53, 0x28, 0x3d, 0x3d, 0x00, 0x08, 0xfa, 0x51,
-    0xfe, 0x63, 0x01, 0x92, 0x05, 0xc6, 0x00, 0x04, 0x00, 0x09, 0x00, 0x0e, 0x00, 0x13, 0x00, 0x18,
-    0x00, 0x1d, 0x00, 0x22, 0x00, 0x27, 0x00, 0x00, 0x45, 0x33, 0x17, 0x03, 0x23, 0x13, 0x23, 0x27,
-    0x13, 0x33, 0x01, 0x35, 0x37, 0x05, 0x15, 0x25, 0x15, 0x07, 0x25, 0x35, 0x01, 0x27, 0x37, 0x25,
-    0x17, 0x01, 0x17, 0x07, 0x05, 0x27, 0x01, 0x07, 0x27, 0x03, 0x37, 0x01, 0x37, 0x17, 0x13, 0x07,
-    0xfd, 0xcb, 0x89, 0x0b, 0x7a, 0x60, 0x94, 0x88, 0x0c, 0x7a, 0x60, 0x01, 0xd9, 0x0d, 0x01, 0x4d,
-    0xfa, 0x19, 0x0d, 0xfe, 0xb3, 0x05, 0x57, 0x61, 0x02, 0x01, 0x42, 0x44, 0xfb, 0x6b, 0x61, 0x02,
-    0xfe, 0xc0, 0x45, 0x01, 0x5d, 0x62, 0x11, 0x94, 0x41, 0x03, 0xc5, 0x62, 0x11, 0x95, 0x42, 0x3c,
-    0x0e, 0xfe, 0xad, 0x06, 0x03, 0x0e, 0x01, 0x52, 0xfc, 0x26, 0x8b, 0x0c, 0x7c, 0x62, 0x97, 0x8b,
-    0x0c, 0x7c, 0x62, 0x01, 0x04, 0x63, 0x10, 0x99, 0x44, 0xfc, 0x29, 0x63, 0x11, 0x99, 0x45, 0x04,
-    0x0e, 0x62, 0x02, 0x01, 0x46, 0x45, 0xfb, 0x55, 0x63, 0x02, 0xfe, 0xbb, 0x47, 0x00, 0xff, 0xff,
-    0x00, 0x92, 0xfe, 0x80, 0x05, 0xd7, 0x07, 0x24, 0x04, 0x26, 0x00, 0xdc, 0x00, 0x00, 0x00, 0x27,
-    0x00, 0xa1, 0x01, 0x19, 0x01, 0x3e, 0x01, 0x07, 0x00, 0x10, 0x04, 0x79, 0xff, 0xc8, 0x00, 0x15,
-    0x40, 0x0e, 0x02, 0x23, 0x04, 0x00, 0x00, 0x98, 0x56, 0x01, 0x0f, 0x01, 0x01, 0x01, 0x5e, 0x56,
-    0x00, 0x2b, 0x34, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x84, 0xfe, 0x80, 0x04, 0xdb, 0x05, 0xda,
-    0x04, 0x26, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x27, 0x00, 0xa1, 0x00, 0x92, 0xff, 0xf3, 0x01, 0x07,
-    0x00, 0x10, 0x03, 0x7c, 0xff, 0xc8, 0x00, 0x15, 0x40, 0x0e, 0x02, 0x23, 0x04, 0x01, 0x00, 0x98,
-    0x56, 0x01, 0x0f, 0x01, 0x01, 0x01, 0x7d, 0x56, 0x00, 0x2b, 0x34, 0x2b, 0x34, 0x00, 0x00, 0x02,
-    0xff, 0xe1, 0x00, 0x00, 0x04, 0x23, 0x06, 0x60, 0x00, 0x17, 0x00, 0x1b, 0x00, 0x1a, 0x40, 0x0c,
-    0x1a, 0x0b, 0x1b, 0x02, 0x72, 0x00, 0x17, 0x17, 0x0d, 0x0d, 0x0a, 0x12, 0x00, 0x3f, 0x33, 0x11,
-    0x33, 0x2f, 0x33, 0x2b, 0xce, 0x33, 0x30, 0x31, 0x41, 0x21, 0x32, 0x16, 0x16, 0x15, 0x14, 0x06,
-    0x06, 0x23, 0x21, 0x11, 0x33, 0x11, 0x33, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x21,
-    0x01, 0x15, 0x21, 0x35, 0x01, 0x2e, 0x01, 0x3e, 0x8d, 0xc4, 0x66, 0x66, 0xc4, 0x8d, 0xfe, 0x22,
-    0xf2, 0xec, 0x48, 0x57, 0x27, 0x27, 0x57, 0x48, 0xfe, 0xc2, 0x01, 0x6f, 0xfd, 0x44, 0x03, 0x00,
-    0x63, 0xab, 0x6f, 0x6f, 0xaf, 0x65, 0x06, 0x60, 0xfa, 0x5f, 0x36, 0x58, 0x32, 0x30, 0x59, 0x39,
-    0x03, 0x6f, 0xa6, 0xa6, 0x00, 0x02, 0x00, 0x94, 0x00, 0x00, 0x04, 0xcf, 0x05, 0xb0, 0x00, 0x03,
-    0x00, 0x1b, 0x00, 0x23, 0x40, 0x11, 0x01, 0x02, 0x05, 0x00, 0x03, 0x06, 0x06, 0x05, 0x05, 0x12,
-    0x10, 0x13, 0x02, 0x72, 0x12, 0x08, 0x72, 0x00, 0x2b, 0x2b, 0x32, 0x11, 0x39, 0x2f, 0x33, 0x11,
-    0x33, 0x33, 0x11, 0x33, 0x33, 0x30, 0x31, 0x41, 0x01, 0x07, 0x01, 0x03, 0x21, 0x35, 0x21, 0x32,
-    0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x21, 0x11, 0x23, 0x11, 0x21, 0x32, 0x16, 0x16, 0x15,
-    0x14, 0x06, 0x06, 0x03, 0x37, 0x01, 0x96, 0x69, 0xfe, 0x6c, 0x13, 0xfe, 0x85, 0x01, 0x7b, 0x63,
-    0x7a, 0x39, 0x39, 0x7a, 0x63, 0xfe, 0xd1, 0xfa, 0x02, 0x29, 0xa9, 0xec, 0x7d, 0x7c, 0xed, 0x03,
-    0xde, 0xfe, 0x41, 0x5f, 0x01, 0xbe, 0xfe, 0xa1, 0xc7, 0x40, 0x71, 0x49, 0x45, 0x79, 0x4a, 0xfb,
-    0x18, 0x05, 0xb0, 0x77, 0xd1, 0x86, 0x8d, 0xca, 0x6c, 0x00, 0x00, 0x04, 0x00, 0x7d, 0xfe, 0x60,
-    0x04, 0x2f, 0x04, 0x4e, 0x00, 0x03, 0x00, 0x08, 0x00, 0x1e, 0x00, 0x34, 0x00, 0x25, 0x40, 0x14,
-    0x00, 0x03, 0x30, 0x01, 0x02, 0x30, 0x25, 0x1a, 0x0f, 0x0b, 0x72, 0x07, 0x06, 0x72, 0x1a, 0x07,
-    0x72, 0x06, 0x0e, 0x72, 0x00, 0x2b, 0x2b, 0x2b, 0x2b, 0x11, 0x33, 0x32, 0x32, 0x32, 0x11, 0x33,
-    0x33, 0x30, 0x31, 0x41, 0x01, 0x07, 0x01, 0x03, 0x11, 0x23, 0x11, 0x33, 0x01, 0x15, 0x14, 0x0e,
-    0x02, 0x23, 0x22, 0x2e, 0x02, 0x27, 0x35, 0x3e, 0x03, 0x33, 0x32, 0x1e, 0x02, 0x07, 0x35, 0x34,
-    0x2e, 0x02, 0x23, 0x22, 0x0e, 0x02, 0x07, 0x15, 0x1e, 0x03, 0x33, 0x32, 0x3e, 0x02, 0x02, 0xbf,
-    0x01, 0x67, 0x69, 0xfe, 0x98, 0xe7, 0xf1, 0xde, 0x02, 0xd4, 0x37, 0x6b, 0x9c, 0x66, 0x65, 0x97,
-    0x68, 0x3f, 0x0d, 0x0d, 0x3f, 0x68, 0x96, 0x64, 0x66, 0x9e, 0x6c, 0x36, 0xf1, 0x1c, 0x3c, 0x5d,
-    0x41, 0x40, 0x5c, 0x3e, 0x22, 0x07, 0x09, 0x24, 0x3d, 0x5b, 0x40, 0x41, 0x5c, 0x3b, 0x1c, 0x01,
-    0xaa, 0xfe, 0x5e, 0x5f, 0x01, 0xa2, 0x02, 0x1f, 0xfa, 0xf6, 0x05, 0xda, 0xfd, 0xed, 0x15, 0x76,
-    0xc9, 0x95, 0x52, 0x4b, 0x8a, 0xbb, 0x70, 0x51, 0x77, 0xc2, 0x8c, 0x4c, 0x4f, 0x91, 0xcb, 0x91,
-    0x15, 0x4b, 0x81, 0x62, 0x37, 0x2b, 0x4c, 0x65, 0x3b, 0xc2, 0x37, 0x5f, 0x48, 0x29, 0x38, 0x63,
-    0x82, 0x00, 0x00, 0x02, 0x00, 0x8f, 0x00, 0x00, 0x04, 0x37, 0x07, 0x13, 0x00, 0x03, 0x00, 0x09,
-    0x00, 0x15, 0x40, 0x0a, 0x02, 0x06, 0x06, 0x03, 0x09, 0x02, 0x72, 0x08, 0x08, 0x72, 0x00, 0x2b,
-    0x2b, 0xce, 0x33, 0x11, 0x33, 0x30, 0x31, 0x41, 0x11, 0x23, 0x11, 0x13, 0x15, 0x21, 0x11, 0x23,
-    0x11, 0x04, 0x37, 0xf1, 0xe9, 0xfd, 0x5b, 0xfb, 0x07, 0x13, 0xfd, 0xde, 0x02, 0x22, 0xfe, 0x9d,
-    0xc8, 0xfb, 0x18, 0x05, 0xb0, 0x00, 0x00, 0x02, 0x00, 0x7d, 0x00, 0x00, 0x03, 0x60, 0x05, 0x77,
-    0x00, 0x03, 0x00, 0x09, 0x00, 0x15, 0x40, 0x0a, 0x02, 0x06, 0x06, 0x03, 0x09, 0x06, 0x72, 0x08,
-    0x0a, 0x72, 0x00, 0x2b, 0x2b, 0xce, 0x33, 0x11, 0x33, 0x30, 0x31, 0x41, 0x11, 0x23, 0x11, 0x13,
-    0x15, 0x21, 0x11, 0x23, 0x11, 0x03, 0x60, 0xf2, 0xd9, 0xfe, 0x27, 0xf1, 0x05, 0x77, 0xfe, 0x03,
-    0x01, 0xfd, 0xfe, 0xc3, 0xc0, 0xfc, 0x86, 0x04, 0x3a, 0x00, 0x00, 0x02, 0x00, 0x99, 0xfe, 0xc5,
-    0x04, 0x9a, 0x05, 0xb0, 0x00, 0x05, 0x00, 0x1d, 0x00, 0x19, 0x40, 0x0c, 0x06, 0x07, 0x07, 0x13,
-    0x12, 0x02, 0x05, 0x02, 0x72, 0x04, 0x08, 0x72, 0x00, 0x2b, 0x2b, 0x32, 0x2f, 0x33, 0x39, 0x2f,
-    0x33, 0x30, 0x31, 0x41, 0x15, 0x21, 0x11, 0x23, 0x11, 0x13, 0x35, 0x33, 0x32, 0x1e, 0x02, 0x15,
-    0x14, 0x0e, 0x02, 0x23, 0x35, 0x32, 0x3e, 0x02, 0x35, 0x2e, 0x03, 0x23, 0x04, 0x37, 0xfd, 0x5c,
-    0xfa, 0xab, 0xfe, 0x8a, 0xdd, 0x9d, 0x54, 0x3a, 0x7b, 0xc3, 0x89, 0x53, 0x6a, 0x3b, 0x18, 0x01,
-    0x2e, 0x5a, 0x86, 0x58, 0x05, 0xb0, 0xc8, 0xfb, 0x18, 0x05, 0xb0, 0xfc, 0xcd, 0xc6, 0x4b, 0x94,
-    0xd9, 0x8e, 0x77, 0xce, 0x9c, 0x57, 0xb7, 0x3f, 0x6c, 0x87, 0x47, 0x62, 0x92, 0x63, 0x31, 0x00,
-    0x00, 0x02, 0x00, 0x7d, 0xfe, 0xe3, 0x03, 0xdd, 0x04, 0x3a, 0x00, 0x14, 0x00, 0x1a, 0x00, 0x1b,
-    0x40, 0x0d, 0x00, 0x01, 0x01, 0x0b, 0x17, 0x1a, 0x06, 0x72, 0x19, 0x0a, 0x72, 0x0c, 0x0b, 0x00,
-    0x2f, 0x33, 0x2b, 0x2b, 0x32, 0x11, 0x39, 0x2f, 0x33, 0x30, 0x31, 0x53, 0x35, 0x33, 0x32, 0x16,
-    0x16, 0x15, 0x14, 0x0e, 0x02, 0x07, 0x27, 0x3e, 0x02, 0x27, 0x36, 0x26, 0x26, 0x23, 0x01, 0x15,
-    0x21, 0x11, 0x23, 0x11, 0xcd, 0xf2, 0x9e, 0xf5, 0x8b, 0x29, 0x5b, 0x8f, 0x66, 0x59, 0x4f, 0x63,
-    0x2f, 0x01, 0x01, 0x4c, 0x86, 0x5b, 0x01, 0x88, 0xfe, 0x27, 0xf1, 0x01, 0xca, 0xc6, 0x6f, 0xd5,
-    0x9e, 0x39, 0x89, 0x85, 0x69, 0x1b, 0xa9, 0x1b, 0x53, 0x70, 0x44, 0x5e, 0x7e, 0x40, 0x02, 0x70,
-    0xc0, 0xfc, 0x86, 0x04, 0x3a, 0x00, 0xff, 0xff, 0x00, 0x15, 0xfe, 0x9a, 0x08, 0x0c, 0x05, 0xb0,
-    0x04, 0x26, 0x00, 0xda, 0x00, 0x00, 0x01, 0x07, 0x02, 0x6b, 0x06, 0xb9, 0x00, 0x00, 0x00, 0x0b,
-    0xb6, 0x05, 0x1b, 0x0c, 0x00, 0x00, 0x9a, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x20,
-    0xfe, 0x9a, 0x06, 0xc5, 0x04, 0x3a, 0x04, 0x26, 0x00, 0xee, 0x00, 0x00, 0x01, 0x07, 0x02, 0x6b,
-    0x05, 0x71, 0x00, 0x00, 0x00, 0x0b, 0xb6, 0x05, 0x1b, 0x0c, 0x00, 0x00, 0x9a, 0x56, 0x00, 0x2b,
-    0x34, 0x00, 0xff, 0xff, 0x00, 0x99, 0xfe, 0x98, 0x05, 0x80, 0x05, 0xb0, 0x04, 0x26, 0x02, 0x46,
-    0x00, 0x00, 0x00, 0x07, 0x02, 0x6b, 0x04, 0x2c, 0xff, 0xfe, 0xff, 0xff, 0x00, 0x8f, 0xfe, 0x9a,
-    0x04, 0xc1, 0x04, 0x3a, 0x04, 0x26, 0x00, 0xf1, 0x00, 0x00, 0x01, 0x07, 0x02, 0x6b, 0x03, 0x6e,
-    0x00, 0x00, 0x00, 0x0b, 0xb6, 0x03, 0x11, 0x02, 0x01, 0x00, 0x9a, 0x56, 0x00, 0x2b, 0x34, 0x00,
-    0x00, 0x04, 0x00, 0x91, 0x00, 0x00, 0x05, 0x38, 0x05, 0xb0, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0d,
-    0x00, 0x11, 0x00, 0x2f, 0x40, 0x17, 0x0f, 0x0e, 0x0e, 0x0b, 0x0c, 0x04, 0x04, 0x0c, 0x0c, 0x0b,
-    0x07, 0x07, 0x0b, 0x0b, 0x00, 0x10, 0x03, 0x08, 0x72, 0x08, 0x00, 0x02, 0x72, 0x00, 0x2b, 0x32,
-    0x2b, 0x32, 0x12, 0x39, 0x2f, 0x33, 0x2f, 0x11, 0x33, 0x11, 0x33, 0x2f, 0x11, 0x12, 0x39, 0x11,
-    0x33, 0x30, 0x31, 0x53, 0x33, 0x11, 0x23, 0x01, 0x33, 0x11, 0x23, 0x01, 0x21, 0x01, 0x21, 0x27,
-    0x21, 0x07, 0x37, 0x01, 0x21, 0x91, 0xfb, 0xfb, 0x01, 0x57, 0x9e, 0x9e, 0x01, 0xf3, 0x01, 0x33,
-    0xfe, 0x1e, 0xfe, 0x18, 0x22, 0x01, 0x9b, 0x08, 0xb7, 0x01, 0xcc, 0xfe, 0xc2, 0x05, 0xb0, 0xfa,
-    0x50, 0x04, 0x4b, 0xfd, 0x38, 0x04, 0x2d, 0xfc, 0xc0, 0xd9, 0xb3, 0xaa, 0xfc, 0xc0, 0x00, 0x04,
-    0x00, 0x8d, 0x00, 0x00, 0x04, 0xac, 0x04, 0x3a, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0d, 0x00, 0x11,
-    0x00, 0x2d, 0x40, 0x16, 0x0f, 0x0e, 0x0e, 0x0b, 0x04, 0x04, 0x0c, 0x0c, 0x0b, 0x07, 0x07, 0x0b,
-    0x0b, 0x00, 0x10, 0x03, 0x0a, 0x72, 0x09, 0x00, 0x06, 0x72, 0x00, 0x2b, 0x32, 0x2b, 0x32, 0x12,
-    0x39, 0x2f, 0x33, 0x2f, 0x11, 0x33, 0x11, 0x33, 0x2f, 0x11, 0x33, 0x11, 0x33, 0x30, 0x31, 0x53,
-    0x33, 0x11, 0x23, 0x01, 0x33, 0x11, 0x23, 0x01, 0x21, 0x01, 0x21, 0x27, 0x21, 0x07, 0x37, 0x01,
-    0x21, 0x8d, 0xf1, 0xf1, 0x01, 0x4c, 0x94, 0x94, 0x01, 0x8c, 0x01, 0x2c, 0xfe, 0x73, 0xfe, 0x42,
-    0x1f, 0x01, 0x74, 0x10, 0xb6, 0x01, 0x6b, 0xfe, 0xcb, 0x04, 0x3a, 0xfb, 0xc6, 0x03, 0x53, 0xfd,
-    0xa5, 0x03, 0x42, 0xfd, 0x75, 0xda, 0xb1, 0x89, 0xfd, 0x9f, 0x00, 0x04, 0x00, 0x34, 0x00, 0x00,
-    0x06, 0xa2, 0x05, 0xb0, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0d, 0x00, 0x11, 0x00, 0x23, 0x40, 0x11,
-    0x10, 0x0f, 0x0f, 0x0b, 0x0a, 0x0a, 0x03, 0x0e, 0x06, 0x08, 0x72, 0x0d, 0x07, 0x02, 0x03, 0x02,
-    0x72, 0x00, 0x2b, 0x32, 0x32, 0x32, 0x2b, 0x32, 0x12, 0x39, 0x2f, 0x33, 0x33, 0x11, 0x33, 0x30,
-    0x31, 0x41, 0x15, 0x21, 0x35, 0x21, 0x11, 0x23, 0x11, 0x21, 0x01, 0x21, 0x27, 0x33, 0x01, 0x13,
-    0x01, 0x37, 0x01, 0x02, 0x60, 0xfd, 0xd4, 0x02, 0xd5, 0xfa, 0x04, 0x67, 0xfd, 0xaf, 0xfe, 0x9d,
-    0x22, 0xfa, 0x01, 0xa8, 0x33, 0xfe, 0x28, 0xa2, 0x02, 0x63, 0x05, 0xb0, 0xc0, 0xc0, 0xfa, 0x50,
-    0x05, 0xb0, 0xfc, 0xc2, 0xda, 0x02, 0x64, 0xfa, 0x50, 0x02, 0x98, 0xc1, 0xfc, 0xa7, 0x00, 0x04,
-    0x00, 0x3c, 0x00, 0x00, 0x05, 0xa4, 0x04, 0x3a, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0d, 0x00, 0x11,
-    0x00, 0x23, 0x40, 0x11, 0x10, 0x0f, 0x0f, 0x0b, 0x0a, 0x0a, 0x03, 0x0e, 0x06, 0x0a, 0x72, 0x0d,
-    0x07, 0x02, 0x03, 0x06, 0x72, 0x00, 0x2b, 0x32, 0x32, 0x32, 0x2b, 0x32, 0x12, 0x39, 0x2f, 0x33,
-    0x33, 0x11, 0x33, 0x30, 0x31, 0x41, 0x15, 0x21, 0x35, 0x21, 0x11, 0x23, 0x11, 0x21, 0x01, 0x21,
-    0x27, 0x33, 0x01, 0x13, 0x01, 0x37, 0x01, 0x02, 0x50, 0xfd, 0xec, 0x02, 0x83, 0xf1, 0x03, 0xb3,
-    0xfe, 0x19, 0xfe, 0xed, 0x20, 0xc9, 0x01, 0x24, 0x13, 0xfe, 0xbb, 0xbd, 0x01, 0xc5, 0x04, 0x3a,
-    0xc0, 0xc0, 0xfb, 0xc6, 0x04, 0x3a, 0xfd, 0x75, 0xda, 0x01, 0xb1, 0xfb, 0xc6, 0x01, 0xd8, 0x89,
-    0xfd, 0x9f, 0xff, 0xff, 0x00, 0x94, 0xfe, 0x9a, 0x05, 0xd6, 0x05, 0xb0, 0x04, 0x26, 0x00, 0x2c,
-    0x00, 0x00, 0x01, 0x07, 0x02, 0x6b, 0x04, 0x83, 0x00, 0x00, 0x00, 0x0b, 0xb6, 0x03, 0x0f, 0x0a,
-    0x00, 0x00, 0x9a, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x84, 0xfe, 0x9a, 0x04, 0xce,
-    0x04, 0x3a, 0x04, 0x26, 0x00, 0xf4, 0x00, 0x00, 0x01, 0x07, 0x02, 0x6b, 0x03, 0x7a, 0x00, 0x00,
-    0x00, 0x0b, 0xb6, 0x03, 0x0f, 0x0a, 0x00, 0x00, 0x9a, 0x56, 0x00, 0x2b, 0x34, 0x00, 0x00, 0x04,
-    0x00, 0x94, 0x00, 0x00, 0x07, 0x8f, 0x05, 0xb0, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x0f,
-    0x00, 0x1f, 0x40, 0x0f, 0x07, 0x06, 0x06, 0x0a, 0x02, 0x03, 0x03, 0x0c, 0x0b, 0x02, 0x72, 0x0d,
-    0x0a, 0x08, 0x72, 0x00, 0x2b, 0x32, 0x2b, 0x32, 0x32, 0x11, 0x33, 0x11, 0x39, 0x2f, 0x33, 0x30,
-    0x31, 0x41, 0x15, 0x21, 0x27, 0x11, 0x15, 0x21, 0x35, 0x13, 0x11, 0x23, 0x11, 0x21, 0x11, 0x23,
-    0x11, 0x07, 0x8f, 0xfd, 0x80, 0xba, 0xfc, 0xfc, 0x3e, 0xfb, 0x04, 0x83, 0xfb, 0x05, 0xb0, 0xc0,
-    0xc0, 0xfd, 0xa0, 0xc7, 0xc7, 0x02, 0x60, 0xfa, 0x50, 0x05, 0xb0, 0xfa, 0x50, 0x05, 0xb0, 0x00,
-    0x00, 0x04, 0x00, 0x7d, 0x00, 0x00, 0x05, 0x6b, 0x04, 0x3a, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0b,
-    0x00, 0x0f, 0x00, 0x1f, 0x40, 0x0f, 0x07, 0x06, 0x06, 0x0a, 0x02, 0x03, 0x03, 0x0c, 0x0b, 0x06,
-    0x72, 0x0d, 0x0a, 0x0a, 0x72, 0x00, 0x2b, 0x32, 0x2b, 0x32, 0x32, 0x11, 0x33, 0x11, 0x39, 0x2f,
-    0x33, 0x30, 0x31, 0x41, 0x15, 0x21, 0x37, 0x03, 0x15, 0x21, 0x35, 0x13, 0x11, 0x23, 0x11, 0x21,
-    0x11, 0x23, 0x11, 0x05, 0x6b, 0xfe, 0x43, 0x02, 0x57, 0xfd, 0xcf, 0x46, 0xf1, 0x03, 0x8a, 0xf2,
-    0x04, 0x3a, 0xc0, 0xc0, 0xfe, 0x3c, 0xbe, 0xbe, 0x01, 0xc4, 0xfb, 0xc6, 0x04, 0x3a, 0xfb, 0xc6,
-    0x04, 0x3a, 0x00, 0x02, 0x00, 0x97, 0xfe, 0xc4, 0x07, 0xf5, 0x05, 0xb0, 0x00, 0x07, 0x00, 0x1f,
-    0x00, 0x19, 0x40, 0x0c, 0x08, 0x09, 0x09, 0x14, 0x04, 0x07, 0x02, 0x72, 0x06, 0x08, 0x72, 0x02,
-    0x00, 0x2f, 0x2b, 0x2b, 0x32, 0x2f, 0x39, 0x2f, 0x33, 0x30, 0x31, 0x41, 0x11, 0x23, 0x11, 0x21,
-    0x11, 0x23, 0x11, 0x01, 0x35, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x27, 0x32,
-    0x3e, 0x02, 0x35, 0x34, 0x2e, 0x02, 0x23, 0x05, 0x13, 0xfb, 0xfd, 0x7a, 0xfb, 0x04, 0x08, 0xfe,
-    0x8a, 0xdd, 0x9e, 0x53, 0x3a, 0x7b, 0xc3, 0x88, 0x01, 0x53, 0x6a, 0x3b, 0x18, 0x2f, 0x5a, 0x86,
-    0x58, 0x05, 0xb0, 0xfa, 0x50, 0x04, 0xe8, 0xfb, 0x18, 0x05, 0xb0, 0xfc, 0xcc, 0xc6, 0x4b, 0x94,
-    0xd9, 0x8e, 0x77, 0xce, 0x9c, 0x57, 0xb7, 0x3f, 0x6c, 0x87, 0x47, 0x62, 0x92, 0x63, 0x31, 0x00,
-    0x00, 0x04, 0x00, 0x7d, 0xfe, 0xe7, 0x06, 0xb6, 0x04, 0x3a, 0x00, 0x14, 0x00, 0x18, 0x00, 0x1c,
-    0x00, 0x20, 0x00, 0x23, 0x40, 0x11, 0x1e, 0x17, 0x18, 0x18, 0x00, 0x01, 0x01, 0x0b, 0x1d, 0x1c,
-    0x06, 0x72, 0x1b, 0x0a, 0x72, 0x0c, 0x0b, 0x00, 0x2f, 0x33, 0x2b, 0x2b, 0x32, 0x11, 0x39, 0x2f,
-    0x33, 0x32, 0x11, 0x33, 0x2f, 0x30, 0x31, 0x41, 0x35, 0x21, 0x32, 0x16, 0x16, 0x15, 0x14, 0x0e,
-    0x02, 0x07, 0x27, 0x3e, 0x02, 0x35, 0x36, 0x26, 0x26, 0x23, 0x01, 0x15, 0x21, 0x35, 0x33, 0x11,
-    0x23, 0x11, 0x21, 0x11, 0x23, 0x11, 0x03, 0x65, 0x01, 0x20, 0xa4, 0xfd, 0x90, 0x29, 0x5a, 0x91,
-    0x65, 0x59, 0x4f, 0x62, 0x2f, 0x01, 0x51, 0x8f, 0x60, 0xfe, 0xc7, 0xfd, 0xe9, 0x39, 0xf1, 0x03,
-    0x8c, 0xf2, 0x01, 0xcd, 0xc6, 0x6e, 0xd6, 0x9d, 0x39, 0x8a, 0x84, 0x69, 0x1b, 0xa8, 0x1b, 0x54,
-    0x70, 0x44, 0x5d, 0x7e, 0x40, 0x02, 0x6d, 0xc0, 0xc0, 0xfb, 0xc6, 0x04, 0x3a, 0xfb, 0xc6, 0x04,
-    0x3a, 0x00, 0x00, 0x01, 0x00, 0x67, 0xff, 0xeb, 0x05, 0xe0, 0x05, 0xc5, 0x00, 0x43, 0x00, 0x1d,
-    0x40, 0x0e, 0x39, 0x0c, 0x0c, 0x23, 0x22, 0x03, 0x72, 0x00, 0x01, 0x01, 0x2e, 0x17, 0x09, 0x72,
-    0x00, 0x2b, 0x32, 0x32, 0x11, 0x33, 0x2b, 0x32, 0x32, 0x11, 0x33, 0x30, 0x31, 0x65, 0x15, 0x22,
-    0x24, 0x26, 0x02, 0x35, 0x35, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x15, 0x14, 0x02,
-    0x06, 0x04, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x35, 0x34, 0x3e, 0x02, 0x33, 0x15, 0x22, 0x0e, 0x02,
-    0x15, 0x15, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x3e, 0x02, 0x35, 0x35, 0x34, 0x2e, 0x02, 0x23, 0x22,
-    0x0e, 0x02, 0x15, 0x15, 0x14, 0x1e, 0x02, 0x05, 0xe0, 0xc4, 0xfe, 0xc0, 0xe7, 0x7c, 0x3c, 0x6e,
-    0x9b, 0x5e, 0x63, 0xa1, 0x75, 0x3f, 0x67, 0xc0, 0xfe, 0xf6, 0xa2, 0x96, 0xf6, 0xaf, 0x5f, 0x47,
-    0x83, 0xb7, 0x6e, 0x36, 0x57, 0x3c, 0x20, 0x37, 0x69, 0x95, 0x5f, 0x6f, 0xaf, 0x7a, 0x40, 0x19,
-    0x31, 0x46, 0x2d, 0x2a, 0x42, 0x2e, 0x19, 0x53, 0xa1, 0xeb, 0xaf, 0xc4, 0x6b, 0xc5, 0x01, 0x0e,
-    0xa3, 0xd3, 0x75, 0xc7, 0x95, 0x53, 0x54, 0x9a, 0xd3, 0x7e, 0xce, 0x98, 0xfe, 0xfc, 0xc2, 0x6d,
-    0x69, 0xbc, 0xfa, 0x91, 0xc1, 0x83, 0xe1, 0xa7, 0x5e, 0xcf, 0x3e, 0x6e, 0x95, 0x57, 0xc3, 0x67,
-    0xb0, 0x82, 0x49, 0x4e, 0x8a, 0xb9, 0x6c, 0xe2, 0x58, 0x82, 0x58, 0x2b, 0x2d, 0x57, 0x7e, 0x52,
-    0xd7, 0x76, 0xc5, 0x91, 0x4f, 0x00, 0x00, 0x01, 0x00, 0x60, 0xff, 0xeb, 0x04, 0xcc, 0x04, 0x4f,
-    0x00, 0x43, 0x00, 0x1d, 0x40, 0x0e, 0x39, 0x0c, 0x0c, 0x23, 0x22, 0x07, 0x72, 0x00, 0x01, 0x01,
-    0x2e, 0x17, 0x0b, 0x72, 0x00, 0x2b, 0x32, 0x32, 0x2f, 0x33, 0x2b, 0x32, 0x32, 0x11, 0x33, 0x30,
-    0x31, 0x65, 0x15, 0x22, 0x24, 0x26, 0x26, 0x35, 0x35, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x1e, 0x02,
-    0x15, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x35, 0x34, 0x3e, 0x02, 0x33, 0x15,
-    0x0e, 0x03, 0x15, 0x15, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x3e, 0x02, 0x35, 0x35, 0x34, 0x2e, 0x02,
-    0x23, 0x22, 0x0e, 0x02, 0x15, 0x15, 0x14, 0x1e, 0x02, 0x04, 0xcc, 0xaa, 0xfe, 0xfa, 0xb2, 0x5c,
-    0x2f, 0x56, 0x7b, 0x4b, 0x4d, 0x7e, 0x59, 0x2f, 0x51, 0x96, 0xcf, 0x7f, 0x78, 0xc4, 0x8e, 0x4d,
-    0x39, 0x69, 0x90, 0x59, 0x21, 0x35, 0x26, 0x15, 0x27, 0x4a, 0x6a, 0x42, 0x4b, 0x78, 0x54, 0x2c,
-    0x0f, 0x1e, 0x2a, 0x1b, 0x1c, 0x2b, 0x1d, 0x0f, 0x43, 0x81, 0xbb, 0x8d, 0xa0, 0x56, 0x9c, 0xd0,
-    0x79, 0x81, 0x5b, 0x9a, 0x72, 0x3f, 0x45, 0x7c, 0xa6, 0x60, 0x7f, 0x73, 0xc5, 0x94, 0x52, 0x57,
-    0x9b, 0xcf, 0x79, 0x4e, 0x66, 0xad, 0x80, 0x48, 0xc6, 0x02, 0x29, 0x49, 0x64, 0x3b, 0x50, 0x4f,
-    0x87, 0x65, 0x37, 0x35, 0x5e, 0x80, 0x4b, 0x81, 0x34, 0x59, 0x44, 0x26, 0x22, 0x3d, 0x54, 0x31,
-    0x85, 0x57, 0x94, 0x6c, 0x3c, 0x00, 0xff, 0xff, 0x00, 0x26, 0xfe, 0x9a, 0x05, 0x22, 0x05, 0xb0,
-    0x04, 0x26, 0x00, 0x3c, 0x00, 0x00, 0x01, 0x07, 0x02, 0x6b, 0x03, 0xcf, 0x00, 0x00, 0x00, 0x0b,
-    0xb6, 0x01, 0x0f, 0x06, 0x00, 0x00, 0x9a, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x1f,
-    0xfe, 0x9a, 0x04, 0x26, 0x04, 0x3a, 0x04, 0x26, 0x00, 0x5c, 0x00, 0x00, 0x01, 0x07, 0x02, 0x6b,
-    0x02, 0xd2, 0x00, 0x00, 0x00, 0x0b, 0xb6, 0x01, 0x0f, 0x06, 0x00, 0x00, 0x9a, 0x56, 0x00, 0x2b,
-    0x34, 0x00, 0x00, 0x03, 0x00, 0x29, 0xfe, 0xa1, 0x06, 0xb8, 0x05, 0xb0, 0x00, 0x03, 0x00, 0x09,
-    0x00, 0x11, 0x00, 0x1d, 0x40, 0x0e, 0x09, 0x0d, 0x0d, 0x08, 0x0a, 0x08, 0x72, 0x05, 0x10, 0x0c,
-    0x02, 0x03, 0x02, 0x72, 0x00, 0x2b, 0x32, 0x32, 0x32, 0x2f, 0x2b, 0x32, 0x32, 0x11, 0x33, 0x30,
-    0x31, 0x41, 0x15, 0x21, 0x35, 0x01, 0x03, 0x23, 0x11, 0x23, 0x35, 0x05, 0x11, 0x33, 0x11, 0x21,
-    0x11, 0x33, 0x11, 0x03, 0xe7, 0xfc, 0x42, 0x06, 0x8f, 0x13, 0xe7, 0x82, 0xfc, 0x4d, 0xfc, 0x02,
-    0x86, 0xfb, 0x05, 0xb0, 0xc0, 0xc0, 0xfb, 0x19, 0xfd, 0xd8, 0x01, 0x5f, 0xc9, 0xc9, 0x05, 0xb0,
-    0xfb, 0x17, 0x04, 0xe9, 0xfa, 0x50, 0x00, 0x03, 0x00, 0x27, 0xfe, 0xbf, 0x05, 0x3a, 0x04, 0x3b,
-    0x00, 0x03, 0x00, 0x0b, 0x00, 0x11, 0x00, 0x1f, 0x40, 0x0f, 0x02, 0x03, 0x03, 0x0d, 0x0a, 0x05,
-    0x06, 0x72, 0x08, 0x07, 0x07, 0x10, 0x04, 0x0a, 0x72, 0x00, 0x2b, 0x32, 0x32, 0x11, 0x33, 0x2b,
-    0x32, 0x2f, 0x39, 0x2f, 0x33, 0x30, 0x31, 0x41, 0x15, 0x21, 0x35, 0x13, 0x11, 0x33, 0x11, 0x21,
-    0x11, 0x33, 0x11, 0x37, 0x03, 0x23, 0x11, 0x23, 0x35, 0x02, 0xea, 0xfd, 0x3d, 0xf5, 0xf1, 0x01,
-    0xa9, 0xf1, 0x93, 0x12, 0xde, 0x82, 0x04, 0x3b, 0xc0, 0xc0, 0xfb, 0xc5, 0x04, 0x3a, 0xfc, 0x86,
-    0x03, 0x7a, 0xfb, 0xc6, 0xbf, 0xfe, 0x00, 0x01, 0x41, 0xbf, 0xff, 0xff, 0x00, 0x91, 0xfe, 0x9a,
-    0x05, 0xa9, 0x05, 0xb0, 0x04, 0x26, 0x00, 0xe1, 0x00, 0x00, 0x01, 0x07, 0x02, 0x6b, 0x04, 0x56,
-    0x00, 0x00, 0x00, 0x0b, 0xb6, 0x02, 0x1d, 0x19, 0x00, 0x00, 0x9a, 0x56, 0x00, 0x2b, 0x34, 0x00,
-    0xff, 0xff, 0x00, 0x60, 0xfe, 0x9a, 0x04, 0xa3, 0x04, 0x3b, 0x04, 0x26, 0x00, 0xf9, 0x00, 0x00,
-    0x01, 0x07, 0x02, 0x6b, 0x03, 0x4f, 0x00, 0x00, 0x00, 0x0b, 0xb6, 0x02, 0x1b, 0x02, 0x00, 0x00,
-    0x9a, 0x56, 0x00, 0x2b, 0x34, 0x00, 0x00, 0x03, 0x00, 0x81, 0x00, 0x00, 0x04, 0xde, 0x05, 0xb0,
-    0x00, 0x03, 0x00, 0x19, 0x00, 0x1d, 0x00, 0x23, 0x40, 0x11, 0x03, 0x03, 0x0a, 0x0a, 0x15, 0x02,
-    0x02, 0x15, 0x15, 0x04, 0x1c, 0x08, 0x72, 0x1b, 0x04, 0x02, 0x72, 0x00, 0x2b, 0x32, 0x2b, 0x11,
-    0x39, 0x2f, 0x33, 0x2f, 0x11, 0x33, 0x11, 0x33, 0x2f, 0x30, 0x31, 0x41, 0x11, 0x23, 0x11, 0x01,
-    0x33, 0x11, 0x14, 0x16, 0x16, 0x33, 0x32, 0x3e, 0x02, 0x37, 0x15, 0x0e, 0x03, 0x23, 0x22, 0x26,
-    0x26, 0x35, 0x01, 0x33, 0x11, 0x23, 0x03, 0x0d, 0x9d, 0xfe, 0x11, 0xfb, 0x3f, 0x7e, 0x5f, 0x2e,
-    0x66, 0x67, 0x60, 0x28, 0x27, 0x5c, 0x65, 0x68, 0x33, 0xa5, 0xf0, 0x82, 0x03, 0x62, 0xfb, 0xfb,
-    0x04, 0x10, 0xfd, 0x24, 0x02, 0xdc, 0x01, 0xa0, 0xfe, 0x3d, 0x67, 0x75, 0x30, 0x08, 0x0f, 0x15,
-    0x0d, 0xc7, 0x0c, 0x16, 0x0f, 0x08, 0x5f, 0xce, 0xa6, 0x01, 0xc3, 0xfa, 0x50, 0x00, 0x00, 0x03,
-    0x00, 0x75, 0x00, 0x00, 0x03, 0xf7, 0x04, 0x3b, 0x00, 0x03, 0x00, 0x07, 0x00, 0x1b, 0x00, 0x23,
-    0x40, 0x10, 0x00, 0x00, 0x18, 0x18, 0x0d, 0x01, 0x01, 0x0d, 0x0d, 0x05, 0x0a, 0x72, 0x12, 0x04,
-    0x06, 0x72, 0x00, 0x2b, 0x32, 0x2b, 0x32, 0x2f, 0x33, 0x7d, 0x2f, 0x11, 0x33, 0x11, 0x33, 0x18,
-    0x2f, 0x30, 0x31, 0x41, 0x11, 0x23, 0x11, 0x01, 0x11, 0x23, 0x11, 0x13, 0x15, 0x0e, 0x02, 0x23,
-    0x22, 0x26, 0x26, 0x35, 0x11, 0x33, 0x11, 0x14, 0x16, 0x16, 0x33, 0x32, 0x36, 0x36, 0x02, 0x8d,
-    0x9d, 0x02, 0x07, 0xf1, 0x8a, 0x2b, 0x6d, 0x78, 0x3d, 0x8f, 0xcf, 0x70, 0xf1, 0x30, 0x62, 0x4b,
-    0x3d, 0x70, 0x6a, 0x03, 0x2c, 0xfd, 0xa0, 0x02, 0x60, 0x01, 0x0e, 0xfb, 0xc6, 0x04, 0x3a, 0xfe,
-    0x21, 0xbf, 0x13, 0x1f, 0x13, 0x58, 0xb7, 0x8d, 0x01, 0x48, 0xfe, 0xb8, 0x51, 0x60, 0x2a, 0x11,
-    0x1e, 0x00, 0x00, 0x02, 0x00, 0x89, 0x00, 0x00, 0x04, 0xe6, 0x05, 0xb0, 0x00, 0x15, 0x00, 0x19,
-    0x00, 0x19, 0x40, 0x0c, 0x01, 0x17, 0x06, 0x11, 0x11, 0x17, 0x18, 0x02, 0x72, 0x17, 0x08, 0x72,
-    0x00, 0x2b, 0x2b, 0x11, 0x39, 0x2f, 0x33, 0x11, 0x33, 0x30, 0x31, 0x61, 0x23, 0x11, 0x34, 0x26,
-    0x26, 0x23, 0x22, 0x0e, 0x02, 0x07, 0x35, 0x3e, 0x03, 0x33, 0x32, 0x16, 0x16, 0x15, 0x01, 0x23,
-    0x11, 0x33, 0x04, 0xe6, 0xfb, 0x3f, 0x7e, 0x60, 0x2d, 0x66, 0x67, 0x61, 0x27, 0x26, 0x5d, 0x65,
-    0x68, 0x32, 0xa6, 0xef, 0x83, 0xfc, 0x9e, 0xfb, 0xfb, 0x01, 0xc3, 0x68, 0x74, 0x30, 0x08, 0x0f,
-    0x15, 0x0d, 0xc7, 0x0c, 0x16, 0x0f, 0x08, 0x5f, 0xce, 0xa6, 0xfe, 0x3d, 0x05, 0xb0, 0x00, 0x02,
-    0x00, 0x0a, 0xff, 0xe9, 0x05, 0xb4, 0x05, 0xc4, 0x00, 0x09, 0x00, 0x36, 0x00, 0x25, 0x40, 0x12,
-    0x05, 0x1d, 0x01, 0x01, 0x1d, 0x1d, 0x06, 0x1c, 0x1c, 0x0a, 0x24, 0x15, 0x03, 0x72, 0x2f, 0x0a,
-    0x09, 0x72, 0x00, 0x2b, 0x32, 0x2b, 0x32, 0x11, 0x39, 0x2f, 0x33, 0x33, 0x11, 0x33, 0x2f, 0x11,
-    0x33, 0x30, 0x31, 0x53, 0x33, 0x14, 0x16, 0x16, 0x33, 0x15, 0x22, 0x26, 0x26, 0x01, 0x22, 0x2e,
-    0x02, 0x35, 0x35, 0x34, 0x3e, 0x02, 0x17, 0x32, 0x1e, 0x02, 0x15, 0x15, 0x21, 0x35, 0x21, 0x35,
-    0x34, 0x2e, 0x02, 0x23, 0x22, 0x0e, 0x02, 0x15, 0x15, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x36, 0x37,
-    0x17, 0x0e, 0x02, 0x0a, 0xb2, 0x31, 0x64, 0x4e, 0x83, 0xb5, 0x5d, 0x03, 0xc5, 0x9e, 0xf1, 0xa3,
-    0x52, 0x58, 0x9c, 0xd0, 0x79, 0x89, 0xd0, 0x8d, 0x46, 0xfc, 0x43, 0x02, 0xc3, 0x21, 0x48, 0x75,
-    0x54, 0x4e, 0x79, 0x52, 0x2a, 0x2b, 0x5d, 0x97, 0x6b, 0x7e, 0xb2, 0x37, 0x30, 0x17, 0x6a, 0xa5,
-    0x04, 0x39, 0x47, 0x69, 0x3a, 0xaf, 0x64, 0xb9, 0xfc, 0x2c, 0x5c, 0xa8, 0xe6, 0x89, 0xff, 0x88,
-    0xe2, 0xa5, 0x5a, 0x01, 0x5e, 0xb1, 0xfa, 0x9a, 0x89, 0xbe, 0x20, 0x4f, 0x8a, 0x68, 0x3a, 0x3f,
-    0x70, 0x92, 0x54, 0xff, 0x56, 0x98, 0x72, 0x41, 0x31, 0x19, 0xc2, 0x0e, 0x2a, 0x22, 0x00, 0x02,
-    0xff, 0xcb, 0xff, 0xec, 0x04, 0x90, 0x04, 0x4e, 0x00, 0x08, 0x00, 0x35, 0x00, 0x25, 0x40, 0x12,
-    0x04, 0x1c, 0x01, 0x01, 0x1c, 0x1c, 0x05, 0x1b, 0x1b, 0x09, 0x23, 0x14, 0x07, 0x72, 0x2e, 0x09,
-    0x0b, 0x72, 0x00, 0x2b, 0x32, 0x2b, 0x32, 0x12, 0x39, 0x2f, 0x33, 0x33, 0x11, 0x33, 0x2f, 0x11,
-    0x33, 0x30, 0x31, 0x43, 0x33, 0x14, 0x16, 0x33, 0x15, 0x22, 0x26, 0x26, 0x01, 0x22, 0x2e, 0x02,
-    0x35, 0x35, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x15, 0x21, 0x35, 0x21, 0x35, 0x2e,
-    0x03, 0x23, 0x22, 0x0e, 0x02, 0x15, 0x15, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x36, 0x37, 0x17, 0x0e,
-    0x02, 0x35, 0xa6, 0x68, 0x6d, 0x7a, 0xa9, 0x58, 0x03, 0x13, 0x78, 0xc0, 0x88, 0x47, 0x49, 0x85,
-    0xb3, 0x69, 0x75, 0xad, 0x74, 0x39, 0xfc, 0xbb, 0x02, 0x57, 0x02, 0x1b, 0x35, 0x54, 0x3c, 0x3c,
-    0x5d, 0x3f, 0x20, 0x27, 0x4c, 0x6c, 0x45, 0x58, 0x87, 0x32, 0x80, 0x23, 0x71, 0xa1, 0x03, 0x5c,
-    0x64, 0x76, 0xa1, 0x5c, 0xaa, 0xfd, 0x05, 0x4f, 0x8e, 0xc0, 0x6f, 0x28, 0x7f, 0xce, 0x93, 0x4e,
-    0x4e, 0x8d, 0xc2, 0x75, 0x67, 0xad, 0x13, 0x30, 0x5a, 0x47, 0x28, 0x33, 0x60, 0x87, 0x54, 0x28,
-    0x47, 0x79, 0x5a, 0x33, 0x46, 0x40, 0x7b, 0x33, 0x5d, 0x3a, 0x00, 0x03, 0x00, 0x91, 0xfe, 0xbc,
-    0x04, 0xef, 0x05, 0xb0, 0x00, 0x03, 0x00, 0x09, 0x00, 0x21, 0x00, 0x21, 0x40, 0x10, 0x0a, 0x06,
-    0x06, 0x0b, 0x08, 0x07, 0x07, 0x17, 0x16, 0x09, 0x03, 0x02, 0x72, 0x02, 0x08, 0x72, 0x00, 0x2b,
-    0x2b, 0x32, 0x2f, 0x33, 0x39, 0x2f, 0x33, 0x33, 0x33, 0x11, 0x33, 0x30, 0x31, 0x41, 0x11, 0x23,
-    0x11, 0x21, 0x01, 0x21, 0x27, 0x33, 0x01, 0x01, 0x35, 0x21, 0x32, 0x1e, 0x02, 0x15, 0x14, 0x0e,
-    0x02, 0x23, 0x27, 0x32, 0x3e, 0x02, 0x35, 0x34, 0x2e, 0x02, 0x23, 0x01, 0x8c, 0xfb, 0x04, 0x4b,
-    0xfd, 0x92, 0xfe, 0xd6, 0x22, 0xde, 0x01, 0xaa, 0xfd, 0xe7, 0x01, 0x06, 0x88, 0xde, 0x9e, 0x54,
-    0x3a, 0x7c, 0xc6, 0x8b, 0x01, 0x53, 0x6a, 0x3a, 0x16, 0x2d, 0x59, 0x83, 0x54, 0x05, 0xb0, 0xfa,
-    0x50, 0x05, 0xb0, 0xfc, 0xc3, 0xdf, 0x02, 0x5e, 0xfc, 0xc2, 0xcd, 0x4a, 0x94, 0xda, 0x90, 0x73,
-    0xce, 0x9f, 0x5b, 0xbe, 0x41, 0x6c, 0x84, 0x43, 0x61, 0x91, 0x62, 0x30, 0x00, 0x03, 0x00, 0x8d,
-    0xfe, 0xe7, 0x04, 0x41, 0x04, 0x3a, 0x00, 0x03, 0x00, 0x09, 0x00, 0x1e, 0x00, 0x21, 0x40, 0x10,
-    0x16, 0x15, 0x09, 0x06, 0x72, 0x06, 0x0a, 0x0a, 0x07, 0x0b, 0x0b, 0x01, 0x03, 0x06, 0x72, 0x01,
-    0x00, 0x2f, 0x2b, 0x12, 0x39, 0x2f, 0x33, 0x33, 0x11, 0x33, 0x2b, 0x2f, 0x33, 0x30, 0x31, 0x41,
-    0x11, 0x23, 0x11, 0x21, 0x01, 0x23, 0x27, 0x33, 0x01, 0x01, 0x35, 0x21, 0x32, 0x16, 0x16, 0x15,
-    0x14, 0x0e, 0x02, 0x07, 0x27, 0x3e, 0x02, 0x35, 0x34, 0x26, 0x26, 0x23, 0x01, 0x7e, 0xf1, 0x03,
-    0xb4, 0xfe, 0x03, 0xfe, 0x1f, 0xb3, 0x01, 0x3a, 0xfd, 0xd2, 0x01, 0x23, 0xa3, 0xfd, 0x90, 0x2a,
-    0x59, 0x90, 0x66, 0x59, 0x4f, 0x62, 0x30, 0x50, 0x8f, 0x60, 0x04, 0x3a, 0xfb, 0xc6, 0x04, 0x3a,
-    0xfd, 0x75, 0xda, 0x01, 0xb1, 0xfd, 0x76, 0xc5, 0x65, 0xcd, 0x9d, 0x39, 0x85, 0x80, 0x67, 0x1a,
-    0xa8, 0x1a, 0x51, 0x6a, 0x42, 0x5d, 0x75, 0x38, 0xff, 0xff, 0x00, 0x2c, 0xfe, 0x80, 0x05, 0xd6,
-    0x05, 0xb0, 0x04, 0x26, 0x00, 0xdd, 0x00, 0x00, 0x01, 0x07, 0x00, 0x10, 0x04, 0x78, 0xff, 0xc8,
-    0x00, 0x0b, 0xb6, 0x03, 0x24, 0x06, 0x00, 0x00, 0x98, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff,
-    0x00, 0x20, 0xfe, 0x80, 0x04, 0xdb, 0x04, 0x3a, 0x04, 0x26, 0x00, 0xf2, 0x00, 0x00, 0x01, 0x07,
-    0x00, 0x10, 0x03, 0x7d, 0xff, 0xc8, 0x00, 0x0b, 0xb6, 0x03, 0x24, 0x06, 0x01, 0x00, 0x98, 0x56,
-    0x00, 0x2b, 0x34, 0x00, 0x00, 0x01, 0x00, 0x99, 0xfe, 0x4b, 0x05, 0x13, 0x05, 0xb0, 0x00, 0x19,
-    0x00, 0x19, 0x40, 0x0c, 0x19, 0x08, 0x72, 0x17, 0x02, 0x02, 0x11, 0x0a, 0x05, 0x00, 0x02, 0x72,
-    0x00, 0x2b, 0x32, 0x2f, 0x33, 0x39, 0x2f, 0x33, 0x2b, 0x30, 0x31, 0x53, 0x33, 0x11, 0x21, 0x11,
-    0x33, 0x11, 0x14, 0x06, 0x06, 0x23, 0x22, 0x26, 0x27, 0x37, 0x16, 0x16, 0x33, 0x32, 0x36, 0x36,
-    0x35, 0x11, 0x21, 0x11, 0x23, 0x99, 0xfa, 0x02, 0x85, 0xfb, 0x57, 0xa1, 0x70, 0x24, 0x3d, 0x24,
-    0x0e, 0x14, 0x38, 0x17, 0x29, 0x3a, 0x1e, 0xfd, 0x7b, 0xfa, 0x05, 0xb0, 0xfd, 0x82, 0x02, 0x7e,
-    0xfa, 0x18, 0x7b, 0xaa, 0x58, 0x07, 0x0a, 0xc3, 0x06, 0x06, 0x2a, 0x51, 0x3a, 0x02, 0xa3, 0xfd,
-    0x95, 0x00, 0x00, 0x01, 0x00, 0x7d, 0xfe, 0x4b, 0x04, 0x07, 0x04, 0x3a, 0x00, 0x19, 0x00, 0x1d,
-    0x40, 0x0f, 0x19, 0x0a, 0x72, 0x17, 0x02, 0x02, 0x00, 0x11, 0x0a, 0x0f, 0x72, 0x05, 0x00, 0x06,
-    0x72, 0x00, 0x2b, 0x32, 0x2b, 0x32, 0x12, 0x39, 0x2f, 0x33, 0x2b, 0x30, 0x31, 0x53, 0x33, 0x11,
-    0x21, 0x11, 0x33, 0x11, 0x14, 0x06, 0x06, 0x23, 0x22, 0x26, 0x27, 0x37, 0x16, 0x16, 0x33, 0x32,
-    0x36, 0x36, 0x35, 0x11, 0x21, 0x11, 0x23, 0x7d, 0xf1, 0x01, 0xa7, 0xf2, 0x55, 0x9f, 0x6f, 0x22,
-    0x3d, 0x22, 0x0e, 0x13, 0x3b, 0x14, 0x2a, 0x3a, 0x1e, 0xfe, 0x59, 0xf1, 0x04, 0x3a, 0xfe, 0x3c,
-    0x01, 0xc4, 0xfb, 0x88, 0x79, 0xa8, 0x56, 0x07, 0x0a, 0xbb, 0x06, 0x06, 0x2b, 0x52, 0x3a, 0x01,
-    0xf6, 0xfe, 0x48, 0x00, 0xff, 0xff, 0x00, 0x94, 0xfe, 0x80, 0x05, 0xe1, 0x05, 0xb0, 0x04, 0x26,
-    0x00, 0x2c, 0x00, 0x00, 0x01, 0x07, 0x00, 0x10, 0x04, 0x83, 0xff, 0xc8, 0x00, 0x0b, 0xb6, 0x03,
-    0x16, 0x0a, 0x01, 0x00, 0x98, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x84, 0xfe, 0x80,
-    0x04, 0xd9, 0x04, 0x3a, 0x04, 0x26, 0x00, 0xf4, 0x00, 0x00, 0x01, 0x07, 0x00, 0x10, 0x03, 0x7b,
-    0xff, 0xc8, 0x00, 0x0b, 0xb6, 0x03, 0x16, 0x0a, 0x01, 0x00, 0x98, 0x56, 0x00, 0x2b, 0x34, 0x00,
-    0xff, 0xff, 0x00, 0x94, 0xfe, 0x80, 0x07, 0x2c, 0x05, 0xb0, 0x04, 0x26, 0x00, 0x31, 0x00, 0x00,
-    0x01, 0x07, 0x00, 0x10, 0x05, 0xce, 0xff, 0xc8, 0x00, 0x0b, 0xb6, 0x03, 0x1b, 0x0f, 0x00, 0x00,
-    0x98, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x8f, 0xfe, 0x80, 0x06, 0x3b, 0x04, 0x3a,
-    0x04, 0x26, 0x00, 0xf3, 0x00, 0x00, 0x01, 0x07, 0x00, 0x10, 0x04, 0xdd, 0xff, 0xc8, 0x00, 0x0b,
-    0xb6, 0x03, 0x19, 0x0b, 0x01, 0x00, 0x98, 0x56, 0x00, 0x2b, 0x34, 0x00, 0x00, 0x01, 0x00, 0x55,
-    0xff, 0xeb, 0x05, 0x23, 0x05, 0xc4, 0x00, 0x2c, 0x00, 0x1b, 0x40, 0x0d, 0x1a, 0x0b, 0x11, 0x14,
-    0x14, 0x0b, 0x25, 0x00, 0x03, 0x72, 0x0b, 0x09, 0x72, 0x00, 0x2b, 0x2b, 0x32, 0x11, 0x39, 0x2f,
-    0x33, 0x11, 0x33, 0x30, 0x31, 0x41, 0x32, 0x04, 0x16, 0x16, 0x15, 0x15, 0x14, 0x0e, 0x02, 0x27,
-    0x22, 0x2e, 0x02, 0x35, 0x35, 0x21, 0x15, 0x21, 0x15, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x3e, 0x02,
-    0x35, 0x35, 0x34, 0x2e, 0x02, 0x23, 0x22, 0x06, 0x07, 0x27, 0x3e, 0x02, 0x02, 0x77, 0xa8, 0x01,
-    0x00, 0xac, 0x58, 0x5f, 0xa7, 0xdf, 0x81, 0x97, 0xe7, 0x9b, 0x4f, 0x04, 0x20, 0xfc, 0xda, 0x27,
-    0x56, 0x8c, 0x65, 0x58, 0x88, 0x5d, 0x2f, 0x30, 0x66, 0xa5, 0x77, 0x84, 0xbc, 0x3b, 0x30, 0x18,
-    0x70, 0xae, 0x05, 0xc4, 0x65, 0xb7, 0xfd, 0x97, 0x7b, 0x97, 0xfd, 0xb7, 0x63, 0x01, 0x5d, 0xb1,
-    0xf9, 0x9a, 0x8f, 0xc3, 0x21, 0x4f, 0x8a, 0x67, 0x3b, 0x4a, 0x83, 0xad, 0x62, 0x7b, 0x63, 0xad,
-    0x83, 0x4b, 0x32, 0x18, 0xc2, 0x0d, 0x2c, 0x21, 0x00, 0x02, 0x00, 0x5b, 0xff, 0xeb, 0x04, 0x4b,
-    0x05, 0xb0, 0x00, 0x07, 0x00, 0x25, 0x00, 0x1f, 0x40, 0x0f, 0x05, 0x08, 0x08, 0x04, 0x25, 0x25,
-    0x00, 0x1c, 0x12, 0x09, 0x72, 0x07, 0x00, 0x02, 0x72, 0x00, 0x2b, 0x32, 0x2b, 0x32, 0x11, 0x39,
-    0x11, 0x33, 0x33, 0x11, 0x33, 0x30, 0x31, 0x53, 0x21, 0x17, 0x01, 0x23, 0x35, 0x01, 0x21, 0x01,
-    0x37, 0x32, 0x16, 0x16, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x33, 0x14, 0x16,
-    0x16, 0x33, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x23, 0x91, 0x03, 0x97, 0x01, 0xfe,
-    0x1c, 0xa7, 0x01, 0x69, 0xfd, 0x8a, 0x01, 0x0d, 0xa5, 0xa5, 0xe8, 0x7b, 0x4c, 0x8b, 0xbc, 0x70,
-    0x5b, 0xaf, 0x8f, 0x54, 0xfb, 0x3c, 0x6c, 0x4a, 0x54, 0x76, 0x3f, 0x44, 0x86, 0x60, 0x89, 0x05,
-    0xb0, 0xa1, 0xfd, 0xd7, 0x77, 0x01, 0x8b, 0xfe, 0x72, 0x09, 0x6b, 0xcd, 0x94, 0x66, 0xa0, 0x6d,
-    0x39, 0x31, 0x67, 0xa1, 0x70, 0x3e, 0x67, 0x3d, 0x3c, 0x68, 0x41, 0x65, 0x7e, 0x3b, 0x00, 0x02,
-    0x00, 0x5d, 0xfe, 0x75, 0x04, 0x47, 0x04, 0x3a, 0x00, 0x07, 0x00, 0x25, 0x00, 0x1f, 0x40, 0x0e,
-    0x08, 0x05, 0x05, 0x04, 0x25, 0x25, 0x00, 0x1c, 0x18, 0x12, 0x07, 0x00, 0x06, 0x72, 0x00, 0x2b,
-    0x32, 0x2f, 0xcc, 0x33, 0x12, 0x39, 0x2f, 0x33, 0x33, 0x11, 0x33, 0x30, 0x31, 0x53, 0x21, 0x17,
-    0x01, 0x23, 0x35, 0x01, 0x21, 0x01, 0x37, 0x32, 0x16, 0x16, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x22,
-    0x2e, 0x02, 0x35, 0x33, 0x14, 0x16, 0x16, 0x33, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23,
-    0x23, 0x8e, 0x03, 0x93, 0x02, 0xfe, 0x23, 0xa9, 0x01, 0x62, 0xfd, 0x8f, 0x01, 0x0f, 0xa1, 0xa5,
-    0xe9, 0x7b, 0x4c, 0x89, 0xbc, 0x6f, 0x5a, 0xaf, 0x8d, 0x54, 0xf2, 0x3d, 0x70, 0x4b, 0x56, 0x78,
-    0x40, 0x45, 0x88, 0x62, 0x89, 0x04, 0x3a, 0x9a, 0xfd, 0xce, 0x77, 0x01, 0x95, 0xfe, 0x66, 0x08,
-    0x6a, 0xcb, 0x93, 0x66, 0x9f, 0x6d, 0x39, 0x31, 0x67, 0xa1, 0x6f, 0x40, 0x69, 0x3f, 0x3d, 0x6b,
-    0x43, 0x66, 0x7f, 0x3a, 0xff, 0xff, 0x00, 0x2c, 0xfe, 0x4b, 0x04, 0x85, 0x05, 0xb0, 0x04, 0x26,
-    0x00, 0xb1, 0x4e, 0x00, 0x00, 0x26, 0x02, 0x40, 0x9f, 0x28, 0x00, 0x07, 0x02, 0x6e, 0x01, 0x30,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x24, 0xfe, 0x47, 0x03, 0x9b, 0x04, 0x3a, 0x04, 0x26, 0x00, 0xec,
-    0x4e, 0x00, 0x00, 0x27, 0x02, 0x40, 0xff, 0x96, 0xff, 0x76, 0x00, 0x07, 0x02, 0x6e, 0x01, 0x02,
-    0xff, 0xfc, 0xff, 0xff, 0x00, 0x26, 0xfe, 0x4b, 0x05, 0x52, 0x05, 0xb0, 0x04, 0x26, 0x00, 0x3c,
-    0x00, 0x00, 0x00, 0x07, 0x02, 0x6e, 0x03, 0xc8, 0x00, 0x00, 0xff, 0xff, 0x00, 0x1f, 0xfe, 0x4b,
-    0x04, 0x56, 0x04, 0x3a, 0x04, 0x26, 0x00, 0x5c, 0x00, 0x00, 0x00, 0x07, 0x02, 0x6e, 0x02, 0xcb,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x4f, 0x00, 0x00, 0x04, 0x79, 0x05, 0xb0, 0x00, 0x18, 0x00, 0x12,
-    0xb7, 0x03, 0x00, 0x00, 0x0b, 0x10, 0x0d, 0x02, 0x72, 0x00, 0x2b, 0x2f, 0x33, 0x39, 0x2f, 0x33,
-    0x30, 0x31, 0x41, 0x21, 0x15, 0x21, 0x22, 0x06, 0x06, 0x15, 0x14, 0x16, 0x16, 0x33, 0x21, 0x11,
-    0x33, 0x11, 0x21, 0x22, 0x26, 0x26, 0x35, 0x34, 0x3e, 0x02, 0x02, 0x5e, 0x01, 0x6d, 0xfe, 0x93,
-    0x60, 0x7a, 0x3a, 0x3a, 0x7a, 0x60, 0x01, 0x20, 0xfb, 0xfd, 0xe5, 0xa6, 0xec, 0x7d, 0x47, 0x88,
-    0xc3, 0x03, 0x99, 0xc7, 0x49, 0x75, 0x43, 0x45, 0x79, 0x4c, 0x04, 0xe9, 0xfa, 0x50, 0x78, 0xd1,
-    0x86, 0x64, 0xa7, 0x7c, 0x43, 0x00, 0x00, 0x02, 0x00, 0x68, 0x00, 0x00, 0x06, 0xad, 0x05, 0xb0,
-    0x00, 0x18, 0x00, 0x2d, 0x00, 0x1f, 0x40, 0x0e, 0x1b, 0x0b, 0x0b, 0x10, 0x25, 0x25, 0x03, 0x00,
-    0x00, 0x1a, 0x10, 0x0d, 0x02, 0x72, 0x00, 0x2b, 0x2f, 0x33, 0x39, 0x2f, 0x33, 0x33, 0x2f, 0x11,
-    0x33, 0x11, 0x33, 0x30, 0x31, 0x41, 0x21, 0x15, 0x21, 0x22, 0x06, 0x06, 0x15, 0x14, 0x16, 0x16,
-    0x33, 0x21, 0x11, 0x33, 0x11, 0x21, 0x22, 0x26, 0x26, 0x35, 0x34, 0x3e, 0x02, 0x01, 0x23, 0x35,
-    0x37, 0x3e, 0x02, 0x37, 0x36, 0x2e, 0x02, 0x27, 0x33, 0x1e, 0x02, 0x07, 0x0e, 0x02, 0x02, 0x77,
-    0x01, 0x6d, 0xfe, 0x93, 0x60, 0x79, 0x3a, 0x3a, 0x79, 0x60, 0x01, 0x21, 0xfa, 0xfd, 0xe5, 0xa6,
-    0xec, 0x7d, 0x47, 0x88, 0xc3, 0x02, 0xe7, 0x8c, 0x8c, 0x49, 0x5a, 0x2a, 0x02, 0x01, 0x08, 0x0f,
-    0x17, 0x0f, 0xf4, 0x12, 0x1f, 0x14, 0x02, 0x02, 0x70, 0xcc, 0x03, 0x99, 0xc7, 0x49, 0x75, 0x43,
-    0x45, 0x79, 0x4c, 0x04, 0xe9, 0xfa, 0x50, 0x78, 0xd1, 0x86, 0x64, 0xa7, 0x7c, 0x43, 0xfc, 0x67,
-    0xc6, 0x01, 0x01, 0x4c, 0x7a, 0x45, 0x27, 0x5f, 0x66, 0x5f, 0x27, 0x33, 0x84, 0x85, 0x36, 0x8f,
-    0xd2, 0x72, 0x00, 0x03, 0x00, 0x5f, 0xff, 0xe9, 0x06, 0x7b, 0x06, 0x18, 0x00, 0x16, 0x00, 0x2b,
-    0x00, 0x47, 0x00, 0x1d, 0x40, 0x10, 0x33, 0x44, 0x0b, 0x72, 0x3b, 0x2d, 0x01, 0x72, 0x1d, 0x12,
-    0x0b, 0x72, 0x27, 0x06, 0x07, 0x72, 0x00, 0x2b, 0x32, 0x2b, 0x32, 0x2b, 0x2f, 0x2b, 0x32, 0x30,
-    0x31, 0x53, 0x35, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x1e, 0x03, 0x17, 0x15, 0x0e, 0x03, 0x23, 0x22,
-    0x2e, 0x02, 0x37, 0x15, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x36, 0x36, 0x37, 0x35, 0x2e, 0x03, 0x23,
-    0x22, 0x0e, 0x02, 0x05, 0x11, 0x33, 0x11, 0x06, 0x16, 0x16, 0x33, 0x3e, 0x03, 0x37, 0x36, 0x26,
-    0x27, 0x33, 0x16, 0x16, 0x07, 0x0e, 0x03, 0x23, 0x06, 0x26, 0x26, 0x5f, 0x37, 0x6b, 0x9e, 0x67,
-    0x4b, 0x78, 0x5c, 0x43, 0x2a, 0x0a, 0x0c, 0x3c, 0x63, 0x8e, 0x5f, 0x65, 0x9d, 0x6c, 0x37, 0xf2,
-    0x1a, 0x39, 0x5b, 0x41, 0x52, 0x6d, 0x3f, 0x0b, 0x07, 0x26, 0x3f, 0x5d, 0x3e, 0x41, 0x5c, 0x39,
-    0x1b, 0x01, 0xbe, 0xf2, 0x01, 0x23, 0x41, 0x2c, 0x3c, 0x5a, 0x3f, 0x21, 0x02, 0x02, 0x21, 0x1e,
-    0xeb, 0x1b, 0x2a, 0x02, 0x02, 0x4f, 0x88, 0xae, 0x62, 0x73, 0xa8, 0x5f, 0x01, 0xfb, 0x15, 0x7e,
-    0xd2, 0x9a, 0x54, 0x32, 0x5e, 0x84, 0xa3, 0x60, 0x43, 0x74, 0xbf, 0x8b, 0x4b, 0x4e, 0x8e, 0xc1,
-    0x88, 0x15, 0x47, 0x79, 0x5b, 0x32, 0x47, 0x79, 0x4c, 0xb5, 0x3b, 0x68, 0x4d, 0x2d, 0x3b, 0x69,
-    0x8a, 0xf6, 0x04, 0xb0, 0xfb, 0x50, 0x37, 0x55, 0x30, 0x01, 0x32, 0x5d, 0x83, 0x52, 0x64, 0xcb,
-    0x64, 0x61, 0xcb, 0x67, 0x8b, 0xcf, 0x88, 0x44, 0x02, 0x4d, 0xaa, 0x00, 0x00, 0x02, 0x00, 0x3d,
-    0xff, 0xe9, 0x05, 0xe4, 0x05, 0xb0, 0x00, 0x20, 0x00, 0x46, 0x00, 0x21, 0x40, 0x10, 0x28, 0x27,
-    0x27, 0x02, 0x01, 0x01, 0x0e, 0x32, 0x43, 0x09, 0x72, 0x3a, 0x0d, 0x0e, 0x02, 0x72, 0x00, 0x2b,
-    0x32, 0x2f, 0x2b, 0x32, 0x11, 0x39, 0x2f, 0x33, 0x33, 0x11, 0x33, 0x30, 0x31, 0x41, 0x23, 0x35,
-    0x33, 0x32, 0x36, 0x36, 0x35, 0x34, 0x2e, 0x02, 0x23, 0x21, 0x35, 0x21, 0x32, 0x1e, 0x02, 0x15,
-    0x14, 0x0e, 0x03, 0x07, 0x22, 0x06, 0x06, 0x07, 0x06, 0x06, 0x13, 0x35, 0x35, 0x34, 0x26, 0x26,
-    0x23, 0x37, 0x32, 0x1e, 0x02, 0x15, 0x15, 0x14, 0x16, 0x16, 0x33, 0x3e, 0x03, 0x37, 0x36, 0x26,
-    0x27, 0x33, 0x16, 0x16, 0x07, 0x0e, 0x03, 0x23, 0x06, 0x26, 0x26, 0x01, 0xbf, 0xdd, 0xa8, 0x68,
-    0x7e, 0x3a, 0x1e, 0x41, 0x68, 0x49, 0xfe, 0xa3, 0x01, 0x5d, 0x7f, 0xc3, 0x84, 0x44, 0x20, 0x3e,
-    0x5c, 0x78, 0x4b, 0x03, 0x06, 0x07, 0x03, 0x28, 0x19, 0xcd, 0x36, 0x65, 0x46, 0x12, 0x84, 0xb0,
-    0x69, 0x2d, 0x1a, 0x32, 0x22, 0x35, 0x52, 0x38, 0x1f, 0x01, 0x02, 0x22, 0x1e, 0xf5, 0x1a, 0x2b,
-    0x02, 0x02, 0x4f, 0x86, 0xac, 0x60, 0x69, 0x9a, 0x56, 0x02, 0x67, 0xc9, 0x33, 0x66, 0x4c, 0x30,
-    0x4d, 0x38, 0x1d, 0xc9, 0x35, 0x69, 0x99, 0x66, 0x38, 0x61, 0x53, 0x41, 0x31, 0x10, 0x16, 0x15,
-    0x01, 0x09, 0x04, 0xfe, 0xcd, 0x02, 0x40, 0x47, 0x69, 0x3c, 0x77, 0x34, 0x5f, 0x81, 0x4d, 0x44,
-    0x27, 0x3c, 0x23, 0x01, 0x31, 0x5d, 0x80, 0x4f, 0x64, 0xcb, 0x64, 0x61, 0xcb, 0x67, 0x8a, 0xcf,
-    0x89, 0x44, 0x02, 0x43, 0x95, 0x00, 0x00, 0x02, 0x00, 0x2f, 0xff, 0xe4, 0x05, 0x01, 0x04, 0x3a,
-    0x00, 0x1d, 0x00, 0x42, 0x00, 0x25, 0x40, 0x12, 0x3e, 0x3d, 0x3d, 0x1b, 0x02, 0x01, 0x01, 0x0d,
-    0x2a, 0x2a, 0x22, 0x33, 0x0b, 0x72, 0x0c, 0x0d, 0x06, 0x72, 0x00, 0x2b, 0x32, 0x2b, 0x32, 0x32,
-    0x2f, 0x11, 0x39, 0x2f, 0x33, 0x33, 0x33, 0x11, 0x33, 0x30, 0x31, 0x41, 0x21, 0x27, 0x33, 0x32,
-    0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x21, 0x27, 0x21, 0x32, 0x16, 0x16, 0x15, 0x14, 0x0e,
-    0x02, 0x07, 0x0e, 0x02, 0x07, 0x06, 0x06, 0x05, 0x35, 0x06, 0x16, 0x33, 0x3e, 0x03, 0x37, 0x36,
-    0x26, 0x27, 0x33, 0x16, 0x16, 0x07, 0x0e, 0x03, 0x23, 0x06, 0x2e, 0x02, 0x27, 0x35, 0x34, 0x26,
-    0x26, 0x23, 0x37, 0x32, 0x16, 0x16, 0x15, 0x01, 0x8b, 0xfe, 0xfb, 0x02, 0xba, 0x45, 0x54, 0x28,
-    0x28, 0x57, 0x45, 0xfe, 0xfa, 0x06, 0x01, 0x0c, 0x8c, 0xc4, 0x66, 0x23, 0x45, 0x65, 0x41, 0x02,
-    0x05, 0x05, 0x03, 0x22, 0x0f, 0x01, 0x5d, 0x01, 0x23, 0x30, 0x2c, 0x45, 0x30, 0x1a, 0x01, 0x02,
-    0x21, 0x1f, 0xeb, 0x1a, 0x2c, 0x02, 0x02, 0x45, 0x75, 0x96, 0x53, 0x50, 0x78, 0x52, 0x2d, 0x04,
-    0x24, 0x45, 0x34, 0x25, 0x8b, 0x9d, 0x41, 0x01, 0xa1, 0xb8, 0x22, 0x3e, 0x29, 0x2c, 0x45, 0x28,
-    0xbf, 0x4c, 0x90, 0x66, 0x32, 0x52, 0x40, 0x30, 0x11, 0x01, 0x1f, 0x20, 0x02, 0x08, 0x03, 0xba,
-    0x01, 0x28, 0x36, 0x01, 0x27, 0x47, 0x65, 0x40, 0x4d, 0xa5, 0x4d, 0x4d, 0xa2, 0x50, 0x70, 0xa8,
-    0x6f, 0x37, 0x01, 0x1a, 0x3a, 0x5d, 0x41, 0x4c, 0x28, 0x39, 0x1e, 0x84, 0x41, 0x71, 0x49, 0x00,
-    0x00, 0x03, 0x00, 0x4a, 0xfe, 0xb6, 0x04, 0x3e, 0x05, 0xb0, 0x00, 0x1f, 0x00, 0x34, 0x00, 0x3f,
-    0x00, 0x1f, 0x40, 0x0e, 0x3a, 0x39, 0x3f, 0x2c, 0x0c, 0x0d, 0x02, 0x72, 0x21, 0x20, 0x20, 0x01,
-    0x01, 0x02, 0x00, 0x2f, 0x33, 0x11, 0x33, 0x11, 0x33, 0x2b, 0x32, 0x2f, 0x33, 0x2f, 0x33, 0x30,
-    0x31, 0x41, 0x21, 0x35, 0x33, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x21, 0x27, 0x21,
-    0x32, 0x16, 0x16, 0x15, 0x14, 0x0e, 0x03, 0x07, 0x0e, 0x02, 0x07, 0x0e, 0x02, 0x07, 0x37, 0x32,
-    0x16, 0x16, 0x15, 0x15, 0x14, 0x16, 0x16, 0x17, 0x15, 0x23, 0x2e, 0x02, 0x35, 0x35, 0x34, 0x26,
-    0x26, 0x01, 0x15, 0x14, 0x06, 0x07, 0x27, 0x3e, 0x02, 0x35, 0x35, 0x01, 0xa9, 0xfe, 0xee, 0xce,
-    0x65, 0x7b, 0x3a, 0x38, 0x78, 0x5e, 0xfe, 0xdc, 0x03, 0x01, 0x27, 0xa2, 0xe5, 0x78, 0x1d, 0x39,
-    0x56, 0x70, 0x45, 0x02, 0x08, 0x06, 0x03, 0x1a, 0x15, 0x10, 0x31, 0x2c, 0xaa, 0xc2, 0x50, 0x0d,
-    0x1e, 0x1c, 0xf8, 0x1e, 0x1c, 0x06, 0x3a, 0x6e, 0x02, 0x63, 0x66, 0x54, 0x81, 0x1c, 0x2e, 0x1c,
-    0x02, 0x5d, 0xc0, 0x36, 0x67, 0x49, 0x48, 0x6a, 0x3b, 0xc0, 0x62, 0xbc, 0x88, 0x39, 0x60, 0x52,
-    0x42, 0x31, 0x11, 0x01, 0x13, 0x12, 0x01, 0x06, 0x09, 0x05, 0x03, 0x81, 0x60, 0xa8, 0x6c, 0x78,
-    0x22, 0x54, 0x4c, 0x19, 0x17, 0x1b, 0x61, 0x60, 0x18, 0x74, 0x4c, 0x6e, 0x3b, 0xfe, 0x8a, 0xad,
-    0x66, 0xd7, 0x47, 0x4c, 0x2d, 0x5b, 0x68, 0x3f, 0xb6, 0x00, 0x00, 0x03, 0x00, 0x73, 0xfe, 0xa8,
-    0x04, 0x1c, 0x04, 0x3a, 0x00, 0x1e, 0x00, 0x33, 0x00, 0x3e, 0x00, 0x1e, 0x40, 0x0e, 0x38, 0x20,
-    0x1f, 0x1f, 0x02, 0x01, 0x01, 0x3e, 0x2b, 0x0a, 0x0c, 0x0d, 0x06, 0x72, 0x00, 0x2b, 0x32, 0x3f,
-    0x33, 0x39, 0x2f, 0x33, 0x33, 0x11, 0x33, 0x2f, 0x30, 0x31, 0x41, 0x21, 0x35, 0x33, 0x32, 0x36,
-    0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x21, 0x27, 0x21, 0x32, 0x1e, 0x02, 0x15, 0x14, 0x0e, 0x02,
-    0x07, 0x06, 0x06, 0x07, 0x0e, 0x02, 0x07, 0x37, 0x32, 0x16, 0x16, 0x15, 0x15, 0x14, 0x16, 0x16,
-    0x17, 0x15, 0x23, 0x2e, 0x02, 0x35, 0x35, 0x34, 0x26, 0x26, 0x05, 0x15, 0x14, 0x06, 0x07, 0x27,
-    0x3e, 0x02, 0x35, 0x35, 0x01, 0xdc, 0xfe, 0xd5, 0xeb, 0x47, 0x5b, 0x2c, 0x2c, 0x5b, 0x47, 0xfe,
-    0xdb, 0x04, 0x01, 0x29, 0x69, 0xa6, 0x75, 0x3d, 0x26, 0x4c, 0x6f, 0x49, 0x04, 0x08, 0x04, 0x17,
-    0x0e, 0x0c, 0x45, 0x3a, 0x93, 0xa5, 0x45, 0x08, 0x14, 0x12, 0xf9, 0x13, 0x10, 0x03, 0x2d, 0x58,
-    0x02, 0x2e, 0x66, 0x54, 0x81, 0x1c, 0x2e, 0x1c, 0x01, 0x9d, 0xaf, 0x24, 0x42, 0x2c, 0x2d, 0x48,
-    0x29, 0xbe, 0x2e, 0x57, 0x7b, 0x4e, 0x36, 0x57, 0x46, 0x34, 0x11, 0x01, 0x20, 0x02, 0x04, 0x08,
-    0x07, 0x01, 0x7b, 0x4a, 0x81, 0x53, 0x56, 0x11, 0x3b, 0x38, 0x10, 0x10, 0x10, 0x44, 0x43, 0x0e,
-    0x54, 0x34, 0x4a, 0x26, 0xc4, 0xad, 0x66, 0xd7, 0x47, 0x4c, 0x2d, 0x5b, 0x68, 0x3f, 0xb6, 0x00,
-    0x00, 0x03, 0x00, 0x42, 0xff, 0xeb, 0x07, 0x7d, 0x05, 0xb0, 0x00, 0x11, 0x00, 0x15, 0x00, 0x32,
-    0x00, 0x1d, 0x40, 0x0e, 0x26, 0x26, 0x1e, 0x2f, 0x09, 0x72, 0x17, 0x14, 0x00, 0x15, 0x02, 0x72,
-    0x0b, 0x08, 0x00, 0x2f, 0x33, 0x2b, 0x32, 0x32, 0x32, 0x2b, 0x32, 0x32, 0x2f, 0x30, 0x31, 0x41,
-    0x33, 0x03, 0x0e, 0x04, 0x23, 0x23, 0x35, 0x37, 0x3e, 0x04, 0x37, 0x01, 0x15, 0x21, 0x35, 0x01,
-    0x11, 0x33, 0x11, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x3e, 0x02, 0x37, 0x36, 0x26, 0x27, 0x33, 0x16,
-    0x16, 0x07, 0x0e, 0x03, 0x23, 0x22, 0x26, 0x26, 0x01, 0x79, 0xfa, 0x23, 0x07, 0x28, 0x44, 0x69,
-    0x90, 0x61, 0x41, 0x28, 0x34, 0x4d, 0x37, 0x23, 0x15, 0x05, 0x02, 0xe8, 0xfd, 0x85, 0x02, 0x3e,
-    0xfb, 0x13, 0x25, 0x33, 0x21, 0x39, 0x57, 0x3d, 0x21, 0x01, 0x02, 0x21, 0x1e, 0xf5, 0x1a, 0x2b,
-    0x02, 0x02, 0x50, 0x88, 0xaf, 0x61, 0x76, 0xaf, 0x62, 0x05, 0xb0, 0xfd, 0x2d, 0x9f, 0xf2, 0xac,
-    0x6d, 0x33, 0xc7, 0x03, 0x04, 0x2b, 0x55, 0x88, 0xc4, 0x83, 0x02, 0x93, 0xc9, 0xc9, 0xfb, 0xbb,
-    0x04, 0x45, 0xfb, 0xbb, 0x29, 0x44, 0x31, 0x1a, 0x32, 0x5b, 0x81, 0x50, 0x64, 0xcb, 0x64, 0x61,
-    0xcb, 0x67, 0x8b, 0xcf, 0x88, 0x44, 0x4d, 0xaa, 0x00, 0x03, 0x00, 0x3f, 0xff, 0xeb, 0x06, 0x58,
-    0x04, 0x3a, 0x00, 0x11, 0x00, 0x15, 0x00, 0x33, 0x00, 0x1f, 0x40, 0x10, 0x27, 0x27, 0x1e, 0x2f,
-    0x0b, 0x72, 0x17, 0x14, 0x00, 0x15, 0x06, 0x72, 0x0b, 0x08, 0x0a, 0x72, 0x00, 0x2b, 0x32, 0x2b,
-    0x32, 0x32, 0x32, 0x2b, 0x32, 0x32, 0x2f, 0x30, 0x31, 0x41, 0x33, 0x03, 0x0e, 0x04, 0x23, 0x23,
-    0x27, 0x37, 0x3e, 0x04, 0x37, 0x01, 0x15, 0x21, 0x35, 0x01, 0x11, 0x33, 0x11, 0x14, 0x1e, 0x02,
-    0x33, 0x32, 0x3e, 0x02, 0x37, 0x36, 0x26, 0x27, 0x37, 0x16, 0x16, 0x07, 0x0e, 0x03, 0x23, 0x22,
-    0x2e, 0x02, 0x01, 0x27, 0xee, 0x1d, 0x06, 0x22, 0x3b, 0x54, 0x70, 0x46, 0x4b, 0x01, 0x26, 0x25,
-    0x36, 0x26, 0x1a, 0x0f, 0x04, 0x02, 0x46, 0xfe, 0x15, 0x01, 0xa9, 0xf1, 0x15, 0x28, 0x37, 0x23,
-    0x2f, 0x48, 0x32, 0x1b, 0x01, 0x02, 0x21, 0x1d, 0xea, 0x1a, 0x2c, 0x02, 0x02, 0x48, 0x79, 0x9d,
-    0x57, 0x58, 0x90, 0x68, 0x38, 0x04, 0x3a, 0xfd, 0xe9, 0x77, 0xb5, 0x81, 0x50, 0x26, 0xc6, 0x03,
-    0x03, 0x21, 0x3e, 0x62, 0x86, 0x59, 0x01, 0xce, 0xc2, 0xc2, 0xfd, 0x2e, 0x02, 0xd2, 0xfd, 0x2e,
-    0x29, 0x46, 0x32, 0x1b, 0x2c, 0x52, 0x73, 0x48, 0x5f, 0xc0, 0x5e, 0x01, 0x5d, 0xc0, 0x61, 0x7f,
-    0xbf, 0x7e, 0x3e, 0x2b, 0x5c, 0x90, 0x00, 0x03, 0x00, 0x94, 0xff, 0xe9, 0x07, 0x7c, 0x05, 0xb0,
-    0x00, 0x03, 0x00, 0x07, 0x00, 0x23, 0x00, 0x20, 0x40, 0x11, 0x16, 0x16, 0x0e, 0x1f, 0x09, 0x72,
-    0x08, 0x02, 0x72, 0x00, 0x03, 0x03, 0x06, 0x08, 0x04, 0x02, 0x72, 0x00, 0x2b, 0x3f, 0x39, 0x2f,
-    0x33, 0x2b, 0x2b, 0x32, 0x32, 0x2f, 0x30, 0x31, 0x41, 0x21, 0x15, 0x21, 0x03, 0x33, 0x11, 0x23,
-    0x01, 0x33, 0x11, 0x14, 0x16, 0x16, 0x33, 0x3e, 0x03, 0x37, 0x36, 0x26, 0x27, 0x33, 0x16, 0x16,
-    0x07, 0x0e, 0x03, 0x23, 0x06, 0x26, 0x26, 0x27, 0x01, 0x51, 0x02, 0xf6, 0xfd, 0x0a, 0xbd, 0xfb,
-    0xfb, 0x03, 0x76, 0xfb, 0x21, 0x3e, 0x2c, 0x39, 0x57, 0x3d, 0x21, 0x02, 0x02, 0x22, 0x1e, 0xf4,
-    0x1b, 0x2b, 0x02, 0x02, 0x50, 0x88, 0xaf, 0x61, 0x75, 0xaa, 0x60, 0x07, 0x03, 0x32, 0xc7, 0x03,
-    0x45, 0xfa, 0x50, 0x05, 0xb0, 0xfb, 0xbb, 0x36, 0x53, 0x2f, 0x01, 0x31, 0x5b, 0x81, 0x50, 0x64,
-    0xcb, 0x64, 0x61, 0xcb, 0x67, 0x8b, 0xcf, 0x88, 0x44, 0x02, 0x4e, 0xab, 0x89, 0x00, 0x00, 0x03,
-    0x00, 0x74, 0xff, 0xea, 0x06, 0x57, 0x04, 0x3a, 0x00, 0x03, 0x00, 0x07, 0x00, 0x25, 0x00, 0x22,
-    0x40, 0x12, 0x19, 0x19, 0x10, 0x21, 0x0b, 0x72, 0x09, 0x06, 0x72, 0x03, 0x02, 0x02, 0x05, 0x07,
-    0x06, 0x72, 0x05, 0x0a, 0x00, 0x3f, 0x2b, 0x12, 0x39, 0x2f, 0x33, 0x2b, 0x2b, 0x32, 0x32, 0x2f,
-    0x30, 0x31, 0x41, 0x15, 0x21, 0x35, 0x13, 0x11, 0x23, 0x11, 0x01, 0x11, 0x33, 0x11, 0x14, 0x1e,
-    0x02, 0x33, 0x3e, 0x03, 0x37, 0x36, 0x26, 0x27, 0x37, 0x16, 0x16, 0x07, 0x0e, 0x03, 0x23, 0x06,
-    0x2e, 0x02, 0x03, 0x41, 0xfd, 0xe3, 0x42, 0xf2, 0x02, 0xa1, 0xf2, 0x14, 0x28, 0x38, 0x23, 0x2f,
-    0x48, 0x32, 0x1b, 0x01, 0x02, 0x21, 0x1d, 0xea, 0x1a, 0x2c, 0x02, 0x02, 0x47, 0x7a, 0x9d, 0x57,
-    0x59, 0x8c, 0x65, 0x39, 0x02, 0x7c, 0xbf, 0xbf, 0x01, 0xbe, 0xfb, 0xc6, 0x04, 0x3a, 0xfd, 0x2e,
-    0x02, 0xd2, 0xfd, 0x2e, 0x29, 0x46, 0x32, 0x1b, 0x01, 0x2c, 0x51, 0x73, 0x48, 0x5f, 0xc0, 0x5e,
-    0x01, 0x5d, 0xc0, 0x61, 0x7f, 0xbf, 0x7e, 0x3e, 0x01, 0x2a, 0x5c, 0x92, 0x00, 0x01, 0x00, 0x5c,
-    0xff, 0xeb, 0x04, 0xbf, 0x05, 0xc5, 0x00, 0x2b, 0x00, 0x15, 0x40, 0x0a, 0x12, 0x0b, 0x03, 0x72,
-    0x25, 0x25, 0x1d, 0x00, 0x09, 0x72, 0x00, 0x2b, 0x32, 0x32, 0x2f, 0x2b, 0x32, 0x30, 0x31, 0x45,
-    0x22, 0x2e, 0x02, 0x35, 0x11, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x16, 0x17, 0x07, 0x26, 0x26, 0x23,
-    0x22, 0x0e, 0x02, 0x15, 0x11, 0x14, 0x1e, 0x02, 0x33, 0x3e, 0x02, 0x37, 0x36, 0x26, 0x27, 0x33,
-    0x16, 0x16, 0x07, 0x0e, 0x02, 0x02, 0xbb, 0x87, 0xdf, 0xa2, 0x57, 0x57, 0xa2, 0xdf, 0x87, 0x74,
-    0xae, 0x43, 0x3c, 0x41, 0x91, 0x57, 0x53, 0x84, 0x5d, 0x30, 0x30, 0x5d, 0x84, 0x53, 0x54, 0x74,
-    0x3d, 0x02, 0x02, 0x1d, 0x17, 0xf4, 0x14, 0x27, 0x02, 0x02, 0x90, 0xe8, 0x15, 0x5d, 0xa7, 0xe1,
-    0x85, 0x01, 0x06, 0x85, 0xe1, 0xa7, 0x5d, 0x2c, 0x2c, 0xb5, 0x21, 0x23, 0x41, 0x72, 0x97, 0x55,
-    0xfe, 0xf8, 0x56, 0x98, 0x73, 0x41, 0x01, 0x3e, 0x72, 0x4e, 0x57, 0xb3, 0x56, 0x56, 0xb1, 0x59,
-    0x9a, 0xca, 0x63, 0x00, 0x00, 0x01, 0x00, 0x55, 0xff, 0xeb, 0x03, 0xeb, 0x04, 0x4e, 0x00, 0x2b,
-    0x00, 0x15, 0x40, 0x0a, 0x21, 0x1a, 0x07, 0x72, 0x07, 0x07, 0x00, 0x0f, 0x0b, 0x72, 0x00, 0x2b,
-    0x32, 0x32, 0x2f, 0x2b, 0x32, 0x30, 0x31, 0x65, 0x3e, 0x02, 0x37, 0x34, 0x26, 0x27, 0x33, 0x16,
-    0x16, 0x07, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x35, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x16,
-    0x17, 0x07, 0x26, 0x26, 0x23, 0x22, 0x0e, 0x02, 0x15, 0x15, 0x14, 0x1e, 0x02, 0x02, 0x5b, 0x3c,
-    0x43, 0x1d, 0x01, 0x09, 0x0a, 0xea, 0x0b, 0x11, 0x01, 0x02, 0x69, 0xb3, 0x71, 0x7c, 0xc2, 0x84,
-    0x44, 0x42, 0x7f, 0xb9, 0x78, 0x60, 0x8d, 0x2c, 0x2d, 0x2e, 0x78, 0x46, 0x45, 0x61, 0x3e, 0x1c,
-    0x1f, 0x42, 0x6a, 0xac, 0x01, 0x24, 0x3f, 0x2c, 0x35, 0x73, 0x35, 0x36, 0x70, 0x37, 0x72, 0x96,
-    0x49, 0x57, 0x97, 0xc3, 0x6c, 0x2a, 0x6c, 0xc3, 0x96, 0x57, 0x22, 0x1f, 0xba, 0x1c, 0x1e, 0x3d,
-    0x65, 0x7b, 0x3e, 0x2a, 0x3e, 0x7c, 0x65, 0x3d, 0x00, 0x02, 0x00, 0x21, 0xff, 0xe9, 0x05, 0x57,
-    0x05, 0xb0, 0x00, 0x03, 0x00, 0x20, 0x00, 0x17, 0x40, 0x0b, 0x14, 0x14, 0x0c, 0x1d, 0x09, 0x72,
-    0x05, 0x02, 0x03, 0x02, 0x72, 0x00, 0x2b, 0x32, 0x32, 0x2b, 0x32, 0x32, 0x2f, 0x30, 0x31, 0x41,
-    0x15, 0x21, 0x35, 0x01, 0x11, 0x33, 0x11, 0x14, 0x1e, 0x02, 0x33, 0x3e, 0x03, 0x37, 0x36, 0x26,
-    0x27, 0x33, 0x16, 0x16, 0x07, 0x0e, 0x03, 0x23, 0x06, 0x26, 0x26, 0x04, 0xa1, 0xfb, 0x80, 0x01,
-    0xc4, 0xfa, 0x13, 0x24, 0x34, 0x20, 0x3a, 0x57, 0x3d, 0x20, 0x02, 0x02, 0x22, 0x1d, 0xf4, 0x1b,
-    0x2b, 0x03, 0x02, 0x4f, 0x88, 0xaf, 0x62, 0x75, 0xaa, 0x60, 0x05, 0xb0, 0xc9, 0xc9, 0xfb, 0xbb,
-    0x04, 0x45, 0xfb, 0xbb, 0x29, 0x43, 0x31, 0x1b, 0x01, 0x31, 0x5b, 0x81, 0x50, 0x64, 0xcb, 0x64,
-    0x61, 0xcb, 0x67, 0x8b, 0xcf, 0x88, 0x44, 0x02, 0x4e, 0xab, 0x00, 0x02, 0x00, 0x44, 0xff, 0xea,
-    0x04, 0xcb, 0x04, 0x3a, 0x00, 0x03, 0x00, 0x20, 0x00, 0x17, 0x40, 0x0b, 0x13, 0x13, 0x0b, 0x1c,
-    0x0b, 0x72, 0x05, 0x02, 0x03, 0x06, 0x72, 0x00, 0x2b, 0x32, 0x32, 0x2b, 0x32, 0x32, 0x2f, 0x30,
-    0x31, 0x41, 0x15, 0x21, 0x35, 0x01, 0x11, 0x33, 0x11, 0x14, 0x16, 0x16, 0x33, 0x3e, 0x03, 0x37,
-    0x36, 0x26, 0x27, 0x33, 0x16, 0x16, 0x07, 0x0e, 0x03, 0x23, 0x06, 0x2e, 0x02, 0x03, 0xcf, 0xfc,
-    0x75, 0x01, 0x45, 0xf0, 0x25, 0x45, 0x2f, 0x2f, 0x48, 0x33, 0x1b, 0x01, 0x02, 0x21, 0x1e, 0xea,
-    0x1a, 0x2c, 0x02, 0x02, 0x48, 0x79, 0x9d, 0x57, 0x58, 0x8d, 0x65, 0x3a, 0x04, 0x3a, 0xbf, 0xbf,
-    0xfd, 0x2e, 0x02, 0xd2, 0xfd, 0x2e, 0x37, 0x55, 0x30, 0x01, 0x23, 0x42, 0x5d, 0x3b, 0x4b, 0x9e,
-    0x4b, 0x4b, 0x9b, 0x4e, 0x70, 0xa9, 0x6f, 0x37, 0x01, 0x2a, 0x5c, 0x92, 0x00, 0x02, 0x00, 0x7d,
-    0xff, 0xeb, 0x04, 0xfb, 0x05, 0xc5, 0x00, 0x20, 0x00, 0x3f, 0x00, 0x23, 0x40, 0x11, 0x00, 0x22,
-    0x3f, 0x3f, 0x02, 0x02, 0x17, 0x35, 0x31, 0x2c, 0x03, 0x72, 0x11, 0x0d, 0x17, 0x09, 0x72, 0x00,
-    0x2b, 0x32, 0xcc, 0x2b, 0xcc, 0x33, 0x12, 0x39, 0x2f, 0x33, 0x12, 0x39, 0x39, 0x30, 0x31, 0x41,
-    0x33, 0x15, 0x23, 0x22, 0x0e, 0x02, 0x15, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x36, 0x36, 0x35, 0x33,
-    0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x34, 0x3e, 0x02, 0x05, 0x23, 0x22, 0x2e, 0x02,
-    0x35, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x16, 0x16, 0x15, 0x23, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06,
-    0x06, 0x15, 0x14, 0x1e, 0x02, 0x33, 0x33, 0x02, 0xa0, 0xdc, 0xc0, 0x4f, 0x79, 0x52, 0x2a, 0x2d,
-    0x57, 0x7e, 0x51, 0x5c, 0x8c, 0x4e, 0xfa, 0x61, 0xa1, 0xc7, 0x67, 0x81, 0xd7, 0x9f, 0x57, 0x49,
-    0x8c, 0xcc, 0x01, 0x5e, 0xdc, 0x76, 0xc1, 0x8b, 0x4b, 0x50, 0x96, 0xd1, 0x81, 0x92, 0xf6, 0x94,
-    0xfb, 0x4d, 0x83, 0x51, 0x6d, 0x8c, 0x43, 0x22, 0x49, 0x72, 0x50, 0xc0, 0x03, 0x11, 0x8c, 0x1c,
-    0x39, 0x5b, 0x3e, 0x31, 0x53, 0x3f, 0x22, 0x3d, 0x67, 0x3e, 0x70, 0xa1, 0x67, 0x31, 0x39, 0x6d,
-    0xa0, 0x66, 0x5b, 0x8d, 0x60, 0x32, 0x57, 0x39, 0x64, 0x84, 0x4b, 0x66, 0x9b, 0x69, 0x35, 0x63,
-    0xb7, 0x80, 0x40, 0x5e, 0x34, 0x3b, 0x62, 0x3b, 0x32, 0x50, 0x3b, 0x1f, 0xff, 0xff, 0x00, 0x2c,
-    0xfe, 0x4b, 0x05, 0xfc, 0x05, 0xb0, 0x04, 0x26, 0x00, 0xdd, 0x00, 0x00, 0x00, 0x07, 0x02, 0x6e,
-    0x04, 0x72, 0x00, 0x00, 0xff, 0xff, 0x00, 0x20, 0xfe, 0x4b, 0x05, 0x01, 0x04, 0x3a, 0x04, 0x26,
-    0x00, 0xf2, 0x00, 0x00, 0x00, 0x07, 0x02, 0x6e, 0x03, 0x77, 0x00, 0x00, 0x00, 0x02, 0x00, 0x64,
-    0x04, 0x70, 0x02, 0xc6, 0x05, 0xd7, 0x00, 0x05, 0x00, 0x0f, 0x00, 0x12, 0xb6, 0x05, 0x05, 0x0d,
-    0x07, 0x02, 0x02, 0x07, 0x00, 0x2f, 0x33, 0x2f, 0x10, 0xcd, 0x32, 0x2f, 0x30, 0x31, 0x41, 0x35,
-    0x13, 0x33, 0x15, 0x03, 0x25, 0x35, 0x33, 0x15, 0x14, 0x16, 0x17, 0x07, 0x26, 0x26, 0x01, 0x8b,
-    0x72, 0xc9, 0xe2, 0xfe, 0x80, 0xa8, 0x26, 0x2a, 0x4d, 0x4f, 0x5c, 0x04, 0x84, 0x14, 0x01, 0x3f,
-    0x15, 0xfe, 0xc2, 0xf9, 0x5a, 0x54, 0x42, 0x62, 0x27, 0x48, 0x28, 0x8d, 0xff, 0xff, 0x00, 0x50,
-    0x02, 0x0e, 0x02, 0x61, 0x02, 0xce, 0x04, 0x06, 0x00, 0x11, 0x00, 0x00, 0xff, 0xff, 0x00, 0x50,
-    0x02, 0x0e, 0x02, 0x61, 0x02, 0xce, 0x04, 0x06, 0x00, 0x11, 0x00, 0x00, 0x00, 0x01, 0x00, 0x9c,
-    0x02, 0x70, 0x04, 0x9a, 0x03, 0x31, 0x00, 0x03, 0x00, 0x08, 0xb1, 0x03, 0x02, 0x00, 0x2f, 0x33,
-    0x30, 0x31, 0x41, 0x15, 0x21, 0x35, 0x04, 0x9a, 0xfc, 0x02, 0x03, 0x31, 0xc1, 0xc1, 0x00, 0x01,
-    0x00, 0x7b, 0x02, 0x70, 0x05, 0xcc, 0x03, 0x31, 0x00, 0x03, 0x00, 0x08, 0xb1, 0x03, 0x02, 0x00,
-    0x2f, 0x33, 0x30, 0x31, 0x41, 0x15, 0x21, 0x35, 0x05, 0xcc, 0xfa, 0xaf, 0x03, 0x31, 0xc1, 0xc1,
-    0x00, 0x02, 0x00, 0x08, 0xfe, 0x66, 0x03, 0x97, 0x00, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0e,
-    0xb4, 0x02, 0x03, 0x80, 0x06, 0x07, 0x00, 0x2f, 0x33, 0x1a, 0xce, 0x32, 0x30, 0x31, 0x41, 0x15,
-    0x21, 0x35, 0x01, 0x15, 0x21, 0x35, 0x03, 0x97, 0xfc, 0x71, 0x03, 0x8f, 0xfc, 0x71, 0xfe, 0xfe,
-    0x98, 0x98, 0x01, 0x02, 0x98, 0x98, 0x00, 0x01, 0x00, 0x65, 0x04, 0x26, 0x01, 0x8f, 0x06, 0x1b,
-    0x00, 0x0a, 0x00, 0x08, 0xb1, 0x05, 0x00, 0x00, 0x2f, 0xcd, 0x30, 0x31, 0x53, 0x35, 0x34, 0x36,
-    0x36, 0x37, 0x17, 0x06, 0x06, 0x15, 0x15, 0x65, 0x2d, 0x51, 0x34, 0x78, 0x28, 0x33, 0x04, 0x26,
-    0x88, 0x3f, 0x87, 0x7b, 0x2c, 0x4b, 0x3f, 0x8b, 0x57, 0x89, 0x00, 0x01, 0x00, 0x37, 0x04, 0x05,
-    0x01, 0x61, 0x06, 0x00, 0x00, 0x0a, 0x00, 0x08, 0xb1, 0x05, 0x00, 0x00, 0x2f, 0xcd, 0x30, 0x31,
-    0x41, 0x15, 0x14, 0x06, 0x06, 0x07, 0x27, 0x36, 0x36, 0x35, 0x35, 0x01, 0x61, 0x2d, 0x50, 0x34,
-    0x79, 0x29, 0x33, 0x06, 0x00, 0x8d, 0x3f, 0x87, 0x7b, 0x2d, 0x4c, 0x3e, 0x8b, 0x57, 0x8f, 0x00,
-    0x00, 0x01, 0x00, 0x35, 0xfe, 0xdb, 0x01, 0x61, 0x00, 0xcf, 0x00, 0x0a, 0x00, 0x08, 0xb1, 0x05,
-    0x00, 0x00, 0x2f, 0xcd, 0x30, 0x31, 0x65, 0x07, 0x14, 0x06, 0x06, 0x07, 0x27, 0x36, 0x36, 0x35,
-    0x35, 0x01, 0x61, 0x01, 0x2d, 0x50, 0x34, 0x7a, 0x2a, 0x2e, 0xcf, 0x86, 0x3f, 0x87, 0x7b, 0x2d,
-    0x4b, 0x3f, 0x8b, 0x57, 0x88, 0x00, 0x00, 0x01, 0x00, 0x4b, 0x04, 0x05, 0x01, 0x76, 0x06, 0x00,
-    0x00, 0x0a, 0x00, 0x08, 0xb1, 0x06, 0x00, 0x00, 0x2f, 0xcd, 0x30, 0x31, 0x53, 0x33, 0x15, 0x14,
-    0x16, 0x17, 0x07, 0x2e, 0x02, 0x35, 0x4b, 0xcf, 0x33, 0x29, 0x79, 0x33, 0x51, 0x2e, 0x06, 0x00,
-    0x8f, 0x57, 0x8b, 0x3e, 0x4c, 0x2d, 0x7b, 0x87, 0x3f, 0x00, 0xff, 0xff, 0x00, 0x6d, 0x04, 0x26,
-    0x02, 0xdf, 0x06, 0x1b, 0x04, 0x26, 0x01, 0x84, 0x08, 0x00, 0x00, 0x07, 0x01, 0x84, 0x01, 0x50,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x43, 0x04, 0x05, 0x02, 0xb5, 0x06, 0x00, 0x04, 0x26, 0x01, 0x85,
-    0x0d, 0x00, 0x00, 0x07, 0x01, 0x85, 0x01, 0x54, 0x00, 0x00, 0x00, 0x02, 0x00, 0x35, 0xfe, 0xc8,
-    0x02, 0xa1, 0x00, 0xfe, 0x00, 0x0a, 0x00, 0x15, 0x00, 0x0c, 0xb3, 0x10, 0x05, 0x0b, 0x00, 0x00,
-    0x2f, 0x32, 0xcd, 0x32, 0x30, 0x31, 0x65, 0x07, 0x14, 0x06, 0x06, 0x07, 0x27, 0x36, 0x36, 0x35,
-    0x35, 0x21, 0x07, 0x14, 0x06, 0x06, 0x07, 0x27, 0x36, 0x36, 0x35, 0x35, 0x01, 0x61, 0x01, 0x2b,
-    0x4e, 0x34, 0x7e, 0x2a, 0x2e, 0x02, 0x14, 0x01, 0x2d, 0x50, 0x34, 0x7e, 0x2a, 0x32, 0xfe, 0xb5,
-    0x42, 0x8f, 0x82, 0x2e, 0x4b, 0x44, 0x94, 0x5c, 0xb7, 0xb5, 0x42, 0x8f, 0x82, 0x2e, 0x4b, 0x44,
-    0x94, 0x5c, 0xb7, 0x00, 0x00, 0x02, 0x00, 0x3f, 0x00, 0x00, 0x04, 0x1d, 0x05, 0xb0, 0x00, 0x03,
-    0x00, 0x07, 0x00, 0x15, 0x40, 0x0a, 0x06, 0x07, 0x07, 0x02, 0x03, 0x02, 0x72, 0x02, 0x12, 0x72,
-    0x00, 0x2b, 0x2b, 0x11, 0x39, 0x2f, 0x33, 0x30, 0x31, 0x41, 0x11, 0x23, 0x11, 0x01, 0x15, 0x21,
-    0x35, 0x02, 0xa4, 0xf1, 0x02, 0x6a, 0xfc, 0x22, 0x05, 0xb0, 0xfa, 0x50, 0x05, 0xb0, 0xfe, 0x8a,
-    0xc4, 0xc4, 0x00, 0x03, 0x00, 0x5d, 0xfe, 0x60, 0x04, 0x3a, 0x05, 0xb0, 0x00, 0x03, 0x00, 0x07,
-    0x00, 0x0b, 0x00, 0x1d, 0x40, 0x0e, 0x0b, 0x0a, 0x06, 0x07, 0x07, 0x01, 0x03, 0x0a, 0x12, 0x72,
-    0x03, 0x02, 0x72, 0x01, 0x00, 0x2f, 0x2b, 0x2b, 0x11, 0x12, 0x39, 0x2f, 0x33, 0x11, 0x33, 0x30,
-    0x31, 0x41, 0x11, 0x23, 0x11, 0x01, 0x15, 0x21, 0x35, 0x01, 0x15, 0x21, 0x35, 0x02, 0xc1, 0xf2,
-    0x02, 0x6b, 0xfc, 0x23, 0x03, 0xdd, 0xfc, 0x23, 0x05, 0xb0, 0xf8, 0xb0, 0x07, 0x50, 0xfe, 0x8a,
-    0xc0, 0xc0, 0xfc, 0x86, 0xc0, 0xc0, 0x00, 0x01, 0x00, 0x8a, 0x02, 0x06, 0x02, 0x46, 0x03, 0xd7,
-    0x00, 0x0d, 0x00, 0x08, 0xb1, 0x04, 0x0b, 0x00, 0x2f, 0xcd, 0x30, 0x31, 0x53, 0x35, 0x34, 0x36,
-    0x33, 0x32, 0x16, 0x15, 0x15, 0x14, 0x06, 0x23, 0x22, 0x26, 0x8a, 0x77, 0x66, 0x67, 0x78, 0x77,
-    0x67, 0x66, 0x78, 0x02, 0xda, 0x27, 0x5e, 0x78, 0x78, 0x5e, 0x27, 0x5d, 0x77, 0x77, 0xff, 0xff,
-    0x00, 0x8d, 0xff, 0xf4, 0x03, 0x6f, 0x00, 0xfd, 0x04, 0x26, 0x00, 0x12, 0x07, 0x00, 0x00, 0x07,
-    0x00, 0x12, 0x01, 0xcf, 0x00, 0x00, 0xff, 0xff, 0x00, 0x8d, 0xff, 0xf4, 0x05, 0x29, 0x00, 0xfd,
-    0x04, 0x26, 0x00, 0x12, 0x07, 0x00, 0x00, 0x27, 0x00, 0x12, 0x01, 0xcf, 0x00, 0x00, 0x00, 0x07,
-    0x00, 0x12, 0x03, 0x88, 0x00, 0x00, 0x00, 0x01, 0x00, 0x5e, 0x01, 0xf0, 0x01, 0x72, 0x02, 0xef,
-    0x00, 0x0b, 0x00, 0x08, 0xb1, 0x03, 0x09, 0x00, 0x2f, 0xcd, 0x30, 0x31, 0x53, 0x34, 0x36, 0x33,
-    0x32, 0x16, 0x15, 0x14, 0x06, 0x23, 0x22, 0x26, 0x5e, 0x49, 0x40, 0x41, 0x4a, 0x4a, 0x41, 0x40,
-    0x49, 0x02, 0x6f, 0x37, 0x49, 0x49, 0x37, 0x37, 0x48, 0x48, 0x00, 0x07, 0x00, 0x50, 0xff, 0xeb,
-    0x07, 0x63, 0x05, 0xc5, 0x00, 0x11, 0x00, 0x23, 0x00, 0x35, 0x00, 0x47, 0x00, 0x59, 0x00, 0x6b,
-    0x00, 0x6f, 0x00, 0x29, 0x40, 0x13, 0x5f, 0x56, 0x56, 0x32, 0x68, 0x4d, 0x4d, 0x44, 0x29, 0x29,
-    0x3b, 0x32, 0x0d, 0x17, 0x0e, 0x0e, 0x20, 0x05, 0x05, 0x00, 0x3f, 0x33, 0x33, 0x2f, 0x33, 0x3f,
-    0x33, 0x33, 0x2f, 0x33, 0x33, 0x2f, 0x33, 0x11, 0x33, 0x2f, 0x33, 0x30, 0x31, 0x53, 0x35, 0x34,
-    0x36, 0x36, 0x33, 0x32, 0x16, 0x16, 0x15, 0x15, 0x14, 0x06, 0x06, 0x23, 0x22, 0x26, 0x26, 0x37,
-    0x15, 0x14, 0x16, 0x16, 0x33, 0x32, 0x36, 0x36, 0x35, 0x35, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06,
-    0x06, 0x01, 0x35, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x16, 0x15, 0x15, 0x14, 0x06, 0x06, 0x23,
-    0x22, 0x26, 0x26, 0x37, 0x15, 0x14, 0x16, 0x16, 0x33, 0x32, 0x36, 0x36, 0x35, 0x35, 0x34, 0x26,
-    0x26, 0x23, 0x22, 0x06, 0x06, 0x05, 0x35, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x16, 0x15, 0x15,
-    0x14, 0x06, 0x06, 0x23, 0x22, 0x26, 0x26, 0x37, 0x15, 0x14, 0x16, 0x16, 0x33, 0x32, 0x36, 0x36,
-    0x35, 0x35, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x01, 0x01, 0x27, 0x01, 0x50, 0x48, 0x87,
-    0x5c, 0x62, 0x8a, 0x49, 0x49, 0x89, 0x61, 0x5d, 0x87, 0x49, 0x9f, 0x1f, 0x3f, 0x30, 0x30, 0x3e,
-    0x1e, 0x1f, 0x3f, 0x30, 0x2f, 0x3e, 0x1f, 0x02, 0x43, 0x4a, 0x8b, 0x5f, 0x5b, 0x7f, 0x43, 0x43,
-    0x7f, 0x59, 0x60, 0x8b, 0x4b, 0xa8, 0x21, 0x40, 0x2d, 0x33, 0x3d, 0x1b, 0x1f, 0x3e, 0x30, 0x2f,
-    0x3f, 0x1e, 0x01, 0x39, 0x44, 0x7f, 0x59, 0x61, 0x8a, 0x49, 0x49, 0x89, 0x60, 0x5a, 0x80, 0x44,
-    0x90, 0x21, 0x3f, 0x2e, 0x33, 0x3d, 0x1b, 0x1f, 0x3e, 0x30, 0x2f, 0x3f, 0x1e, 0xfe, 0xe9, 0xfd,
-    0x39, 0x7c, 0x02, 0xc7, 0x04, 0x4b, 0x4d, 0x53, 0x88, 0x52, 0x52, 0x88, 0x53, 0x4d, 0x51, 0x88,
-    0x52, 0x52, 0x88, 0x9e, 0x4d, 0x28, 0x48, 0x2c, 0x2c, 0x48, 0x28, 0x4d, 0x29, 0x48, 0x2d, 0x2d,
-    0x48, 0xfc, 0x56, 0x4e, 0x52, 0x88, 0x52, 0x52, 0x88, 0x52, 0x4e, 0x52, 0x88, 0x52, 0x52, 0x88,
-    0xa0, 0x4e, 0x28, 0x48, 0x2d, 0x2d, 0x47, 0x29, 0x4e, 0x29, 0x48, 0x2c, 0x2c, 0x48, 0x77, 0x4e,
-    0x52, 0x88, 0x52, 0x52, 0x88, 0x52, 0x4e, 0x52, 0x88, 0x52, 0x52, 0x88, 0xa0, 0x4e, 0x28, 0x48,
-    0x2d, 0x2d, 0x47, 0x29, 0x4e, 0x29, 0x48, 0x2c, 0x2c, 0x48, 0x03, 0x52, 0xfb, 0x8e, 0x47, 0x04,
-    0x72, 0x00, 0x00, 0x02, 0x00, 0x6c, 0x00, 0x8b, 0x02, 0x30, 0x03, 0xa9, 0x00, 0x04, 0x00, 0x09,
-    0x00, 0x12, 0x40, 0x09, 0x01, 0x05, 0x03, 0x09, 0x02, 0x08, 0x06, 0x06, 0x00, 0x00, 0x2f, 0x2f,
-    0x17, 0x39, 0x30, 0x31, 0x41, 0x03, 0x27, 0x35, 0x01, 0x03, 0x13, 0x23, 0x01, 0x35, 0x02, 0x30,
-    0xfb, 0xc9, 0x01, 0x1f, 0x56, 0xfb, 0xa5, 0xfe, 0xe1, 0x03, 0xa9, 0xfe, 0x6d, 0x01, 0x0d, 0x01,
-    0x85, 0xfe, 0x76, 0xfe, 0x6c, 0x01, 0x86, 0x0d, 0x00, 0x02, 0x00, 0x55, 0x00, 0x8b, 0x02, 0x1a,
-    0x03, 0xa8, 0x00, 0x04, 0x00, 0x09, 0x00, 0x0e, 0xb4, 0x02, 0x08, 0x08, 0x05, 0x00, 0x00, 0x2f,
-    0x2f, 0x39, 0x2f, 0x33, 0x30, 0x31, 0x77, 0x13, 0x17, 0x15, 0x01, 0x03, 0x33, 0x01, 0x15, 0x07,
-    0x55, 0xfb, 0xca, 0xfe, 0xe1, 0xa6, 0xa6, 0x01, 0x1f, 0xca, 0x8b, 0x01, 0x93, 0x01, 0x0d, 0xfe,
-    0x7b, 0x03, 0x1d, 0xfe, 0x7b, 0x0d, 0x01, 0x00, 0x00, 0x01, 0x00, 0x2b, 0x00, 0x6e, 0x03, 0x6e,
-    0x05, 0x27, 0x00, 0x03, 0x00, 0x0e, 0xb3, 0x00, 0x03, 0x02, 0x01, 0x00, 0x7c, 0x2f, 0x33, 0x18,
-    0x2f, 0x33, 0x30, 0x31, 0x41, 0x01, 0x27, 0x01, 0x03, 0x6e, 0xfd, 0x39, 0x7c, 0x02, 0xc7, 0x04,
-    0xe0, 0xfb, 0x8e, 0x47, 0x04, 0x72, 0xff, 0xff, 0x00, 0x4c, 0x02, 0x90, 0x02, 0xa9, 0x05, 0xbb,
-    0x06, 0x07, 0x01, 0xe1, 0x00, 0x00, 0x02, 0x9b, 0xff, 0xff, 0x00, 0x36, 0x02, 0x9b, 0x02, 0xbf,
-    0x05, 0xb0, 0x06, 0x07, 0x02, 0x3a, 0x00, 0x00, 0x02, 0x9b, 0xff, 0xff, 0x00, 0x50, 0x02, 0x90,
-    0x02, 0xad, 0x05, 0xb0, 0x06, 0x07, 0x02, 0x3b, 0x00, 0x00, 0x02, 0x9b, 0xff, 0xff, 0x00, 0x4e,
-    0x02, 0x90, 0x02, 0xb8, 0x05, 0xbd, 0x06, 0x07, 0x02, 0x3c, 0x00, 0x00, 0x02, 0x9b, 0xff, 0xff,
-    0x00, 0x37, 0x02, 0x9b, 0x02, 0xad, 0x05, 0xb0, 0x06, 0x07, 0x02, 0x3d, 0x00, 0x00, 0x02, 0x9b,
-    0xff, 0xff, 0x00, 0x4b, 0x02, 0x90, 0x02, 0xaa, 0x05, 0xbb, 0x06, 0x07, 0x02, 0x3e, 0x00, 0x00,
-    0x02, 0x9b, 0xff, 0xff, 0x00, 0x47, 0x02, 0x91, 0x02, 0xa3, 0x05, 0xbb, 0x06, 0x07, 0x02, 0x3f,
-    0x00, 0x00, 0x02, 0x9b, 0x00, 0x02, 0x00, 0x50, 0x02, 0x8f, 0x02, 0xe9, 0x05, 0x51, 0x00, 0x03,
-    0x00, 0x07, 0x00, 0x15, 0xb7, 0x06, 0x06, 0x02, 0x02, 0x03, 0x07, 0x07, 0x03, 0x00, 0x2f, 0x33,
-    0x2f, 0x11, 0x33, 0x11, 0x33, 0x7d, 0x2f, 0x30, 0x31, 0x41, 0x15, 0x21, 0x35, 0x01, 0x11, 0x23,
-    0x11, 0x02, 0xe9, 0xfd, 0x67, 0x01, 0x9d, 0xa0, 0x04, 0x3b, 0x97, 0x97, 0x01, 0x16, 0xfd, 0x3e,
-    0x02, 0xc2, 0x00, 0x01, 0x00, 0x50, 0x03, 0xa6, 0x02, 0xa3, 0x04, 0x3e, 0x00, 0x03, 0x00, 0x08,
-    0xb1, 0x03, 0x02, 0x00, 0x2f, 0x33, 0x30, 0x31, 0x41, 0x15, 0x21, 0x35, 0x02, 0xa3, 0xfd, 0xad,
-    0x04, 0x3e, 0x98, 0x98, 0x00, 0x02, 0x00, 0x50, 0x03, 0x1d, 0x02, 0xa3, 0x04, 0xc0, 0x00, 0x03,
-    0x00, 0x07, 0x00, 0x0c, 0xb3, 0x02, 0x03, 0x07, 0x06, 0x00, 0x2f, 0x33, 0xce, 0x32, 0x30, 0x31,
-    0x41, 0x15, 0x21, 0x35, 0x01, 0x15, 0x21, 0x35, 0x02, 0xa3, 0xfd, 0xad, 0x02, 0x53, 0xfd, 0xad,
-    0x03, 0xb5, 0x98, 0x98, 0x01, 0x0b, 0x97, 0x97, 0x00, 0x01, 0x00, 0x53, 0x01, 0x84, 0x01, 0xb3,
-    0x06, 0x33, 0x00, 0x15, 0x00, 0x0c, 0xb3, 0x10, 0x11, 0x06, 0x05, 0x00, 0x2f, 0x33, 0x2f, 0x33,
-    0x30, 0x31, 0x53, 0x35, 0x34, 0x36, 0x36, 0x37, 0x17, 0x0e, 0x02, 0x15, 0x15, 0x14, 0x1e, 0x02,
-    0x17, 0x07, 0x2e, 0x03, 0x53, 0x5a, 0x84, 0x3d, 0x45, 0x27, 0x4a, 0x2f, 0x1b, 0x2f, 0x39, 0x1d,
-    0x45, 0x2e, 0x63, 0x55, 0x35, 0x03, 0xd3, 0x11, 0xa3, 0xf3, 0x9b, 0x1e, 0x7b, 0x27, 0x77, 0xb3,
-    0x82, 0x13, 0x66, 0x97, 0x6e, 0x4f, 0x1c, 0x78, 0x17, 0x62, 0x95, 0xc7, 0x00, 0x01, 0x00, 0x50,
-    0x01, 0x84, 0x01, 0xb0, 0x06, 0x33, 0x00, 0x15, 0x00, 0x0c, 0xb3, 0x10, 0x11, 0x06, 0x05, 0x00,
-    0x2f, 0x33, 0x2f, 0x33, 0x30, 0x31, 0x41, 0x15, 0x14, 0x06, 0x06, 0x07, 0x27, 0x3e, 0x02, 0x35,
-    0x35, 0x34, 0x2e, 0x02, 0x27, 0x37, 0x1e, 0x03, 0x01, 0xb0, 0x5b, 0x83, 0x3d, 0x45, 0x27, 0x49,
-    0x30, 0x1b, 0x2e, 0x3a, 0x1d, 0x45, 0x2d, 0x63, 0x56, 0x35, 0x03, 0xe4, 0x11, 0xa3, 0xf4, 0x99,
-    0x1f, 0x78, 0x26, 0x74, 0xb5, 0x87, 0x13, 0x61, 0x95, 0x6f, 0x51, 0x1d, 0x7b, 0x16, 0x64, 0x95,
-    0xc6, 0x00, 0x00, 0x02, 0x00, 0x67, 0x02, 0x8c, 0x03, 0x00, 0x05, 0xba, 0x00, 0x04, 0x00, 0x19,
-    0x00, 0x13, 0xb7, 0x16, 0x0b, 0x04, 0x04, 0x0b, 0x02, 0x11, 0x02, 0x00, 0x2f, 0x33, 0x3f, 0x33,
-    0x2f, 0x11, 0x33, 0x30, 0x31, 0x41, 0x11, 0x23, 0x11, 0x33, 0x13, 0x07, 0x34, 0x3e, 0x02, 0x33,
-    0x32, 0x16, 0x16, 0x15, 0x11, 0x23, 0x11, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x01, 0x26,
-    0xbf, 0x95, 0x13, 0x2f, 0x26, 0x49, 0x68, 0x42, 0x51, 0x76, 0x40, 0xc0, 0x21, 0x3d, 0x2b, 0x3c,
-    0x4a, 0x22, 0x05, 0x01, 0xfd, 0x8b, 0x03, 0x21, 0xfe, 0x89, 0x01, 0x54, 0x8e, 0x69, 0x3a, 0x3f,
-    0x88, 0x6c, 0xfe, 0x05, 0x01, 0xcb, 0x48, 0x54, 0x25, 0x3d, 0x65, 0x00, 0xff, 0xff, 0x00, 0x4c,
-    0xfe, 0x88, 0x02, 0xa9, 0x01, 0xb3, 0x06, 0x07, 0x01, 0xe1, 0x00, 0x00, 0xfe, 0x93, 0xff, 0xff,
-    0x00, 0x82, 0xfe, 0x94, 0x02, 0x01, 0x01, 0xa7, 0x06, 0x07, 0x01, 0xe0, 0x00, 0x00, 0xfe, 0x94,
-    0xff, 0xff, 0x00, 0x3d, 0xfe, 0x94, 0x02, 0xb0, 0x01, 0xb4, 0x06, 0x07, 0x01, 0xdf, 0x00, 0x00,
-    0xfe, 0x94, 0xff, 0xff, 0x00, 0x37, 0xfe, 0x89, 0x02, 0xa9, 0x01, 0xb4, 0x06, 0x07, 0x02, 0x39,
-    0x00, 0x00, 0xfe, 0x94, 0xff, 0xff, 0x00, 0x36, 0xfe, 0x94, 0x02, 0xbf, 0x01, 0xa9, 0x06, 0x07,
-    0x02, 0x3a, 0x00, 0x00, 0xfe, 0x94, 0xff, 0xff, 0x00, 0x50, 0xfe, 0x89, 0x02, 0xad, 0x01, 0xa9,
-    0x06, 0x07, 0x02, 0x3b, 0x00, 0x00, 0xfe, 0x94, 0xff, 0xff, 0x00, 0x4e, 0xfe, 0x89, 0x02, 0xb8,
-    0x01, 0xb6, 0x06, 0x07, 0x02, 0x3c, 0x00, 0x00, 0xfe, 0x94, 0xff, 0xff, 0x00, 0x37, 0xfe, 0x94,
-    0x02, 0xad, 0x01, 0xa9, 0x06, 0x07, 0x02, 0x3d, 0x00, 0x00, 0xfe, 0x94, 0xff, 0xff, 0x00, 0x4b,
-    0xfe, 0x89, 0x02, 0xaa, 0x01, 0xb4, 0x06, 0x07, 0x02, 0x3e, 0x00, 0x00, 0xfe, 0x94, 0xff, 0xff,
-    0x00, 0x47, 0xfe, 0x8a, 0x02, 0xa3, 0x01, 0xb4, 0x06, 0x07, 0x02, 0x3f, 0x00, 0x00, 0xfe, 0x94,
-    0xff, 0xff, 0x00, 0x50, 0xfe, 0xa8, 0x02, 0xe9, 0x01, 0x6a, 0x06, 0x07, 0x01, 0x9c, 0x00, 0x00,
-    0xfc, 0x19, 0xff, 0xff, 0x00, 0x50, 0xff, 0xc0, 0x02, 0xa3, 0x00, 0x57, 0x06, 0x07, 0x01, 0x9d,
-    0x00, 0x00, 0xfc, 0x19, 0xff, 0xff, 0x00, 0x50, 0xff, 0x36, 0x02, 0xa3, 0x00, 0xd9, 0x06, 0x07,
-    0x01, 0x9e, 0x00, 0x00, 0xfc, 0x19, 0x00, 0x01, 0x00, 0x53, 0xfd, 0xea, 0x01, 0xb3, 0x02, 0x57,
-    0x00, 0x14, 0x00, 0x08, 0xb1, 0x05, 0x10, 0x00, 0x2f, 0x2f, 0x30, 0x31, 0x77, 0x35, 0x34, 0x36,
-    0x36, 0x37, 0x17, 0x0e, 0x02, 0x15, 0x15, 0x14, 0x16, 0x16, 0x17, 0x07, 0x2e, 0x03, 0x53, 0x5a,
-    0x84, 0x3d, 0x45, 0x27, 0x4a, 0x2f, 0x30, 0x4a, 0x26, 0x45, 0x2e, 0x63, 0x55, 0x35, 0x16, 0x11,
-    0x9b, 0xe6, 0x92, 0x1d, 0x7b, 0x24, 0x6f, 0xa8, 0x79, 0x13, 0x7e, 0xa6, 0x6b, 0x25, 0x77, 0x15,
-    0x5c, 0x8d, 0xba, 0x00, 0x00, 0x01, 0x00, 0x50, 0xfd, 0xeb, 0x01, 0xb0, 0x02, 0x57, 0x00, 0x14,
-    0x00, 0x08, 0xb1, 0x10, 0x05, 0x00, 0x2f, 0x2f, 0x30, 0x31, 0x65, 0x15, 0x14, 0x06, 0x06, 0x07,
-    0x27, 0x3e, 0x02, 0x35, 0x35, 0x34, 0x26, 0x26, 0x27, 0x37, 0x1e, 0x03, 0x01, 0xb0, 0x5b, 0x83,
-    0x3d, 0x45, 0x27, 0x49, 0x30, 0x2f, 0x49, 0x28, 0x45, 0x2e, 0x63, 0x55, 0x35, 0x31, 0x10, 0x9d,
-    0xe9, 0x94, 0x1c, 0x78, 0x24, 0x6d, 0xab, 0x81, 0x12, 0x77, 0xa4, 0x6c, 0x23, 0x7b, 0x15, 0x5b,
-    0x8b, 0xb9, 0x00, 0x04, 0x00, 0x62, 0x00, 0x00, 0x04, 0x7a, 0x05, 0xc4, 0x00, 0x03, 0x00, 0x1e,
-    0x00, 0x22, 0x00, 0x26, 0x00, 0x22, 0x40, 0x10, 0x22, 0x21, 0x25, 0x26, 0x26, 0x01, 0x1b, 0x17,
-    0x12, 0x05, 0x72, 0x09, 0x02, 0x02, 0x01, 0x0c, 0x00, 0x3f, 0x33, 0x11, 0x33, 0x2b, 0xcc, 0x33,
-    0x12, 0x39, 0x2f, 0x33, 0xce, 0x32, 0x30, 0x31, 0x61, 0x21, 0x35, 0x21, 0x01, 0x13, 0x16, 0x06,
-    0x07, 0x27, 0x3e, 0x02, 0x35, 0x03, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x16, 0x15, 0x23, 0x34,
-    0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x05, 0x15, 0x21, 0x35, 0x01, 0x15, 0x21, 0x35, 0x04, 0x7a,
-    0xfb, 0xe9, 0x04, 0x16, 0xfd, 0x77, 0x17, 0x01, 0x47, 0x51, 0xb6, 0x21, 0x23, 0x0d, 0x15, 0x73,
-    0xca, 0x83, 0x8b, 0xc2, 0x66, 0xf2, 0x38, 0x5b, 0x35, 0x36, 0x57, 0x32, 0x01, 0x42, 0xfd, 0x30,
-    0x02, 0xd0, 0xfd, 0x30, 0xc7, 0x03, 0x48, 0xfd, 0x94, 0x60, 0x97, 0x2b, 0x46, 0x08, 0x45, 0x5d,
-    0x29, 0x02, 0x75, 0x8a, 0xc3, 0x68, 0x66, 0xb5, 0x78, 0x4b, 0x59, 0x28, 0x36, 0x6a, 0xf1, 0x8d,
-    0x8d, 0xfe, 0xf7, 0x8e, 0x8e, 0x00, 0x00, 0x03, 0x00, 0x23, 0x00, 0x00, 0x06, 0x4b, 0x05, 0xb0,
-    0x00, 0x03, 0x00, 0x07, 0x00, 0x11, 0x00, 0x22, 0x40, 0x10, 0x03, 0x02, 0x06, 0x0b, 0x0e, 0x10,
-    0x07, 0x07, 0x0d, 0x11, 0x0e, 0x04, 0x72, 0x0a, 0x0d, 0x0c, 0x00, 0x3f, 0x33, 0x2b, 0x32, 0x12,
-    0x39, 0x2f, 0x39, 0x12, 0x39, 0x33, 0xce, 0x32, 0x30, 0x31, 0x41, 0x15, 0x21, 0x35, 0x01, 0x15,
-    0x21, 0x35, 0x01, 0x11, 0x23, 0x01, 0x11, 0x23, 0x11, 0x33, 0x01, 0x11, 0x06, 0x4b, 0xf9, 0xd8,
-    0x06, 0x28, 0xf9, 0xd8, 0x05, 0x52, 0xfa, 0xfd, 0x73, 0xfb, 0xfb, 0x02, 0x8f, 0x03, 0xc4, 0x9b,
-    0x9b, 0xfe, 0xc9, 0x9b, 0x9b, 0x03, 0x23, 0xfa, 0x50, 0x04, 0x13, 0xfb, 0xed, 0x05, 0xb0, 0xfb,
-    0xeb, 0x04, 0x15, 0x00, 0x00, 0x03, 0x00, 0x99, 0xff, 0xec, 0x06, 0x41, 0x05, 0xb0, 0x00, 0x17,
-    0x00, 0x1b, 0x00, 0x2d, 0x00, 0x23, 0x40, 0x12, 0x22, 0x29, 0x0d, 0x1c, 0x19, 0x18, 0x06, 0x72,
-    0x02, 0x01, 0x01, 0x0e, 0x0c, 0x0f, 0x04, 0x72, 0x0e, 0x0c, 0x00, 0x3f, 0x2b, 0x32, 0x12, 0x39,
-    0x2f, 0x33, 0x2b, 0x32, 0xcc, 0x3f, 0x33, 0x30, 0x31, 0x41, 0x23, 0x35, 0x33, 0x32, 0x36, 0x36,
-    0x35, 0x34, 0x26, 0x26, 0x23, 0x23, 0x11, 0x23, 0x11, 0x21, 0x32, 0x16, 0x16, 0x15, 0x14, 0x06,
-    0x06, 0x01, 0x15, 0x21, 0x35, 0x13, 0x33, 0x11, 0x14, 0x16, 0x16, 0x33, 0x32, 0x36, 0x37, 0x17,
-    0x06, 0x06, 0x23, 0x22, 0x26, 0x26, 0x35, 0x02, 0x23, 0xdb, 0xdb, 0x63, 0x6d, 0x2a, 0x2a, 0x6d,
-    0x63, 0x90, 0xfa, 0x01, 0x8a, 0xab, 0xdd, 0x6c, 0x6c, 0xdd, 0x03, 0x6a, 0xfd, 0x9f, 0xaf, 0xf1,
-    0x1d, 0x34, 0x22, 0x19, 0x2f, 0x0e, 0x01, 0x1e, 0x4f, 0x33, 0x53, 0x80, 0x48, 0x02, 0x1d, 0xc9,
-    0x4a, 0x77, 0x42, 0x41, 0x74, 0x49, 0xfb, 0x19, 0x05, 0xb0, 0x76, 0xcd, 0x82, 0x85, 0xd1, 0x78,
-    0x02, 0x1d, 0xb0, 0xb0, 0x01, 0x09, 0xfb, 0xe8, 0x32, 0x35, 0x12, 0x06, 0x03, 0xb8, 0x09, 0x0e,
-    0x3b, 0x86, 0x6f, 0x00, 0xff, 0xff, 0x00, 0x94, 0xff, 0xec, 0x08, 0x3e, 0x05, 0xb0, 0x04, 0x26,
-    0x00, 0x36, 0x00, 0x00, 0x00, 0x07, 0x00, 0x57, 0x04, 0x76, 0x00, 0x00, 0x00, 0x06, 0x00, 0x23,
-    0x00, 0x00, 0x06, 0x18, 0x05, 0xb0, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0d, 0x00, 0x12, 0x00, 0x17,
-    0x00, 0x1d, 0x00, 0x2a, 0x40, 0x14, 0x1d, 0x15, 0x0a, 0x0a, 0x12, 0x06, 0x07, 0x03, 0x02, 0x02,
-    0x11, 0x12, 0x04, 0x72, 0x13, 0x1b, 0x1b, 0x08, 0x11, 0x0c, 0x00, 0x3f, 0x33, 0x33, 0x11, 0x33,
-    0x2b, 0x12, 0x39, 0x2f, 0x33, 0xce, 0x32, 0x11, 0x33, 0x11, 0x33, 0x33, 0x30, 0x31, 0x41, 0x15,
-    0x21, 0x35, 0x01, 0x15, 0x21, 0x35, 0x01, 0x13, 0x13, 0x33, 0x03, 0x03, 0x01, 0x13, 0x13, 0x23,
-    0x01, 0x01, 0x13, 0x13, 0x33, 0x01, 0x01, 0x13, 0x13, 0x23, 0x03, 0x03, 0x06, 0x18, 0xfa, 0x0b,
-    0x05, 0xf5, 0xfa, 0x0b, 0x01, 0xc1, 0x18, 0xb2, 0x93, 0x09, 0xbc, 0xfe, 0xda, 0xb5, 0x17, 0x9f,
-    0xfe, 0xd9, 0x03, 0xbb, 0x18, 0xb1, 0xfa, 0xfe, 0xd9, 0xfe, 0xd9, 0xb4, 0x15, 0x9b, 0xbb, 0x04,
-    0x04, 0x2d, 0x9a, 0x9a, 0xfe, 0xc2, 0x9a, 0x9a, 0xfd, 0x11, 0x01, 0x5b, 0x04, 0x55, 0xfe, 0xab,
-    0xfb, 0xa5, 0x05, 0xb0, 0xfb, 0xaa, 0xfe, 0xa6, 0x05, 0xb0, 0xfa, 0x50, 0x01, 0x5d, 0x04, 0x53,
-    0xfa, 0x50, 0x05, 0xb0, 0xfb, 0xaa, 0xfe, 0xa6, 0x04, 0x5f, 0x01, 0x51, 0x00, 0x02, 0x00, 0x7d,
-    0x00, 0x00, 0x06, 0x1f, 0x04, 0x3a, 0x00, 0x11, 0x00, 0x22, 0x00, 0x20, 0x40, 0x0f, 0x16, 0x13,
-    0x13, 0x11, 0x14, 0x08, 0x14, 0x08, 0x11, 0x0a, 0x1c, 0x0f, 0x00, 0x06, 0x72, 0x00, 0x2b, 0x32,
-    0x32, 0x3f, 0x39, 0x39, 0x2f, 0x2f, 0x11, 0x33, 0x11, 0x33, 0x30, 0x31, 0x53, 0x21, 0x32, 0x1e,
-    0x02, 0x15, 0x11, 0x23, 0x11, 0x34, 0x2e, 0x02, 0x23, 0x21, 0x11, 0x23, 0x21, 0x21, 0x11, 0x33,
-    0x11, 0x21, 0x32, 0x36, 0x36, 0x35, 0x11, 0x33, 0x11, 0x14, 0x0e, 0x02, 0x7d, 0x02, 0x97, 0x5d,
-    0x8a, 0x5a, 0x2c, 0xf2, 0x1b, 0x34, 0x4a, 0x2f, 0xfe, 0xa7, 0xf1, 0x03, 0xca, 0xfd, 0xd4, 0xf1,
-    0x01, 0x5a, 0x3e, 0x59, 0x31, 0xf1, 0x4c, 0x84, 0xaa, 0x04, 0x3a, 0x2e, 0x62, 0x9a, 0x6d, 0xfe,
-    0xc2, 0x01, 0x3f, 0x3f, 0x54, 0x30, 0x13, 0xfc, 0x86, 0x02, 0xd7, 0xfd, 0xe9, 0x24, 0x5d, 0x55,
-    0x02, 0xa4, 0xfd, 0x5d, 0x6c, 0x9b, 0x62, 0x2e, 0x00, 0x03, 0x00, 0x5c, 0xff, 0xec, 0x04, 0x33,
-    0x05, 0xc4, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2b, 0x00, 0x1d, 0x40, 0x0e, 0x2a, 0x2b, 0x27, 0x26,
-    0x26, 0x07, 0x19, 0x12, 0x05, 0x72, 0x00, 0x07, 0x0d, 0x72, 0x00, 0x2b, 0x32, 0x2b, 0x32, 0x12,
-    0x39, 0x2f, 0x33, 0xce, 0x32, 0x30, 0x31, 0x65, 0x32, 0x36, 0x37, 0x17, 0x06, 0x06, 0x23, 0x22,
-    0x2e, 0x02, 0x35, 0x11, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x16, 0x17, 0x07, 0x26, 0x26, 0x23, 0x22,
-    0x0e, 0x02, 0x15, 0x11, 0x14, 0x1e, 0x02, 0x13, 0x15, 0x21, 0x35, 0x01, 0x15, 0x21, 0x35, 0x03,
-    0x4c, 0x36, 0x66, 0x2e, 0x1d, 0x3a, 0x7e, 0x41, 0x7b, 0xcd, 0x96, 0x53, 0x53, 0x99, 0xd1, 0x7f,
-    0x3e, 0x75, 0x3b, 0x1d, 0x2c, 0x67, 0x34, 0x4d, 0x7b, 0x56, 0x2d, 0x2f, 0x56, 0x79, 0x68, 0xfc,
-    0xf2, 0x03, 0x0e, 0xfc, 0xf2, 0xb2, 0x10, 0x10, 0xc8, 0x0e, 0x10, 0x48, 0x8f, 0xd5, 0x8e, 0x01,
-    0x53, 0x92, 0xdb, 0x94, 0x4a, 0x11, 0x0e, 0xc9, 0x0f, 0x12, 0x2e, 0x5d, 0x92, 0x65, 0xfe, 0xab,
-    0x64, 0x8d, 0x59, 0x2a, 0x02, 0xf5, 0x89, 0x89, 0xfe, 0xf4, 0x89, 0x89, 0x00, 0x03, 0x00, 0x23,
-    0x00, 0x00, 0x05, 0xc8, 0x05, 0xb0, 0x00, 0x03, 0x00, 0x07, 0x00, 0x1f, 0x00, 0x29, 0x40, 0x13,
-    0x06, 0x07, 0x03, 0x02, 0x02, 0x14, 0x0a, 0x14, 0x17, 0x09, 0x0a, 0x0a, 0x16, 0x17, 0x04, 0x72,
-    0x16, 0x0c, 0x72, 0x00, 0x2b, 0x2b, 0x12, 0x39, 0x7d, 0x2f, 0x33, 0x11, 0x33, 0x11, 0x12, 0x39,
-    0x18, 0x2f, 0x33, 0xce, 0x32, 0x30, 0x31, 0x41, 0x15, 0x21, 0x35, 0x05, 0x15, 0x21, 0x35, 0x01,
-    0x21, 0x35, 0x21, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x21, 0x11, 0x23, 0x11, 0x21,
-    0x32, 0x16, 0x16, 0x15, 0x14, 0x06, 0x06, 0x05, 0xc8, 0xfa, 0x5b, 0x05, 0xa5, 0xfa, 0x5b, 0x02,
-    0xdf, 0xfe, 0x85, 0x01, 0x7b, 0x62, 0x7b, 0x39, 0x39, 0x7b, 0x62, 0xfe, 0xd2, 0xfb, 0x02, 0x29,
-    0xa8, 0xee, 0x7d, 0x7d, 0xee, 0x04, 0xa6, 0x9b, 0x9b, 0xea, 0x9b, 0x9b, 0xfe, 0x63, 0xc7, 0x40,
-    0x71, 0x49, 0x45, 0x79, 0x4a, 0xfb, 0x18, 0x05, 0xb0, 0x77, 0xd1, 0x86, 0x8d, 0xca, 0x6c, 0x00,
-    0x00, 0x03, 0x00, 0x2a, 0x00, 0x00, 0x04, 0x04, 0x05, 0xb0, 0x00, 0x03, 0x00, 0x1c, 0x00, 0x20,
-    0x00, 0x2d, 0x40, 0x15, 0x1f, 0x20, 0x20, 0x11, 0x03, 0x02, 0x05, 0x06, 0x06, 0x1a, 0x02, 0x1a,
-    0x02, 0x1a, 0x04, 0x10, 0x11, 0x04, 0x72, 0x04, 0x0c, 0x00, 0x3f, 0x2b, 0x32, 0x12, 0x39, 0x39,
-    0x7d, 0x2f, 0x2f, 0x11, 0x33, 0x11, 0x33, 0x11, 0x33, 0x11, 0x33, 0x11, 0x33, 0x30, 0x31, 0x41,
-    0x07, 0x21, 0x37, 0x01, 0x01, 0x27, 0x33, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x21,
-    0x37, 0x33, 0x32, 0x16, 0x16, 0x15, 0x14, 0x06, 0x06, 0x07, 0x01, 0x15, 0x13, 0x07, 0x21, 0x37,
-    0x04, 0x03, 0x31, 0xfc, 0x58, 0x31, 0x01, 0xe3, 0xfe, 0x09, 0x01, 0xef, 0x5d, 0x79, 0x3c, 0x38,
-    0x7a, 0x64, 0xfe, 0xfa, 0x36, 0xd0, 0xb1, 0xea, 0x75, 0x56, 0xc0, 0x9f, 0x01, 0xcc, 0xac, 0x32,
-    0xfd, 0x03, 0x31, 0x04, 0x47, 0xb1, 0xb1, 0xfb, 0xb9, 0x02, 0x51, 0x95, 0x43, 0x73, 0x47, 0x4d,
-    0x76, 0x42, 0xc8, 0x6a, 0xca, 0x8f, 0x7d, 0xbf, 0x75, 0x0e, 0xfd, 0xdf, 0x0d, 0x05, 0xb0, 0xb1,
-    0xb1, 0x00, 0x00, 0x04, 0x00, 0x24, 0xff, 0xed, 0x04, 0x49, 0x05, 0xb0, 0x00, 0x03, 0x00, 0x14,
-    0x00, 0x18, 0x00, 0x1c, 0x00, 0x15, 0x40, 0x09, 0x04, 0x04, 0x03, 0x0f, 0x01, 0x0b, 0x0d, 0x03,
-    0x04, 0x00, 0x3f, 0x3f, 0x33, 0x33, 0x12, 0x39, 0x2f, 0x30, 0x31, 0x41, 0x11, 0x23, 0x11, 0x01,
-    0x33, 0x15, 0x14, 0x02, 0x06, 0x06, 0x23, 0x22, 0x26, 0x27, 0x37, 0x32, 0x3e, 0x02, 0x35, 0x03,
-    0x15, 0x01, 0x35, 0x05, 0x15, 0x01, 0x35, 0x01, 0xf0, 0xfa, 0x02, 0x58, 0xfb, 0x57, 0xa1, 0xde,
-    0x88, 0x45, 0x7a, 0x36, 0xf5, 0x57, 0x84, 0x5a, 0x2e, 0x83, 0xfd, 0x59, 0x02, 0xa7, 0xfd, 0x59,
-    0x05, 0xb0, 0xfa, 0x50, 0x05, 0xb0, 0xfd, 0x4f, 0x4f, 0xa4, 0xfe, 0xfa, 0xb8, 0x61, 0x0b, 0x08,
-    0xb9, 0x41, 0x7e, 0xbd, 0x7b, 0x02, 0x7b, 0xc2, 0xfe, 0xf5, 0xc2, 0x40, 0xc2, 0xfe, 0xf5, 0xc1,
-    0x00, 0x02, 0x00, 0x4f, 0x00, 0x00, 0x05, 0x12, 0x04, 0x3a, 0x00, 0x1b, 0x00, 0x1f, 0x00, 0x18,
-    0x40, 0x0b, 0x08, 0x15, 0x15, 0x1e, 0x1f, 0x06, 0x72, 0x0e, 0x01, 0x1e, 0x0a, 0x00, 0x3f, 0x33,
-    0x33, 0x2b, 0x12, 0x39, 0x2f, 0x33, 0x30, 0x31, 0x61, 0x23, 0x35, 0x34, 0x2e, 0x03, 0x23, 0x22,
-    0x0e, 0x02, 0x15, 0x15, 0x23, 0x35, 0x34, 0x12, 0x36, 0x36, 0x33, 0x32, 0x1e, 0x03, 0x15, 0x01,
-    0x11, 0x23, 0x11, 0x05, 0x12, 0xf1, 0x20, 0x40, 0x5a, 0x72, 0x45, 0x53, 0x87, 0x61, 0x34, 0xf2,
-    0x5b, 0xa3, 0xde, 0x85, 0x6c, 0xbb, 0x96, 0x6c, 0x39, 0xfe, 0x17, 0xf2, 0xb3, 0x63, 0xa1, 0x7a,
-    0x53, 0x2a, 0x42, 0x80, 0xbd, 0x7c, 0xb3, 0xb1, 0xa5, 0x01, 0x06, 0xb8, 0x61, 0x3f, 0x78, 0xac,
-    0xdd, 0x84, 0x03, 0x89, 0xfb, 0xc6, 0x04, 0x3a, 0x00, 0x02, 0x00, 0x2b, 0x00, 0x00, 0x05, 0x32,
-    0x05, 0xb0, 0x00, 0x17, 0x00, 0x1b, 0x00, 0x1a, 0x40, 0x0c, 0x19, 0x18, 0x03, 0x00, 0x00, 0x0e,
-    0x0c, 0x0f, 0x04, 0x72, 0x0e, 0x0c, 0x00, 0x3f, 0x2b, 0x32, 0x12, 0x39, 0x2f, 0x33, 0xce, 0x32,
-    0x30, 0x31, 0x41, 0x21, 0x35, 0x21, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x21, 0x11,
-    0x23, 0x11, 0x21, 0x32, 0x16, 0x16, 0x15, 0x14, 0x06, 0x06, 0x07, 0x15, 0x21, 0x35, 0x03, 0x20,
-    0xfd, 0x0b, 0x02, 0xf0, 0x65, 0x7c, 0x3a, 0x3a, 0x7a, 0x62, 0xfe, 0xd2, 0xfb, 0x02, 0x29, 0xa8,
-    0xec, 0x7e, 0x7f, 0xed, 0x8e, 0xfc, 0xf3, 0x02, 0x1f, 0xc7, 0x3f, 0x72, 0x4c, 0x44, 0x76, 0x4b,
-    0xfb, 0x18, 0x05, 0xb0, 0x76, 0xcf, 0x86, 0x8f, 0xcb, 0x6c, 0x6b, 0xc7, 0xc7, 0x00, 0x00, 0x04,
-    0x00, 0x6e, 0xff, 0xeb, 0x05, 0x8a, 0x05, 0xc5, 0x00, 0x21, 0x00, 0x33, 0x00, 0x45, 0x00, 0x49,
-    0x00, 0x25, 0x40, 0x12, 0x42, 0x27, 0x30, 0x47, 0x47, 0x39, 0x30, 0x0d, 0x72, 0x1f, 0x05, 0x0e,
-    0x49, 0x49, 0x16, 0x0e, 0x05, 0x72, 0x00, 0x2b, 0x32, 0x32, 0x2f, 0x10, 0xcc, 0x32, 0x2b, 0x32,
-    0x32, 0x2f, 0x10, 0xcc, 0x32, 0x30, 0x31, 0x41, 0x33, 0x14, 0x06, 0x06, 0x23, 0x22, 0x26, 0x26,
-    0x35, 0x35, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x16, 0x15, 0x23, 0x34, 0x26, 0x23, 0x22, 0x06,
-    0x06, 0x15, 0x15, 0x14, 0x16, 0x16, 0x33, 0x32, 0x36, 0x01, 0x35, 0x34, 0x36, 0x36, 0x33, 0x32,
-    0x16, 0x16, 0x15, 0x15, 0x14, 0x06, 0x06, 0x23, 0x22, 0x26, 0x26, 0x37, 0x15, 0x14, 0x16, 0x16,
-    0x33, 0x32, 0x36, 0x36, 0x35, 0x35, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x13, 0x01, 0x27,
-    0x01, 0x02, 0x07, 0xa8, 0x42, 0x80, 0x5c, 0x5c, 0x82, 0x45, 0x44, 0x82, 0x5b, 0x5d, 0x80, 0x43,
-    0xa8, 0x3b, 0x3d, 0x29, 0x36, 0x1a, 0x1b, 0x37, 0x29, 0x3d, 0x39, 0x01, 0x1b, 0x49, 0x8a, 0x61,
-    0x64, 0x89, 0x47, 0x47, 0x88, 0x63, 0x62, 0x8b, 0x49, 0xa8, 0x21, 0x40, 0x2d, 0x33, 0x3e, 0x1b,
-    0x1f, 0x3f, 0x30, 0x2f, 0x3e, 0x1f, 0xc0, 0xfd, 0x39, 0x7c, 0x02, 0xc7, 0x04, 0x23, 0x45, 0x76,
-    0x48, 0x52, 0x88, 0x51, 0x4d, 0x53, 0x88, 0x52, 0x48, 0x77, 0x46, 0x2d, 0x49, 0x2c, 0x49, 0x29,
-    0x4d, 0x28, 0x48, 0x2c, 0x4c, 0xfd, 0x1c, 0x4e, 0x52, 0x88, 0x52, 0x52, 0x88, 0x52, 0x4e, 0x52,
-    0x88, 0x52, 0x52, 0x88, 0xa0, 0x4e, 0x28, 0x48, 0x2d, 0x2d, 0x47, 0x29, 0x4e, 0x29, 0x48, 0x2c,
-    0x2c, 0x48, 0x03, 0x52, 0xfb, 0x8e, 0x47, 0x04, 0x72, 0x00, 0x00, 0x01, 0x00, 0x45, 0xff, 0xeb,
-    0x03, 0x8f, 0x05, 0xf6, 0x00, 0x2e, 0x00, 0x14, 0xb7, 0x19, 0x18, 0x18, 0x01, 0x24, 0x0c, 0x00,
-    0x01, 0x00, 0x2f, 0x33, 0x2f, 0x33, 0x12, 0x39, 0x2f, 0x33, 0x30, 0x31, 0x65, 0x15, 0x22, 0x2e,
-    0x02, 0x35, 0x11, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x15, 0x14, 0x0e, 0x02, 0x04,
-    0x23, 0x35, 0x32, 0x3e, 0x02, 0x35, 0x35, 0x34, 0x2e, 0x02, 0x23, 0x22, 0x0e, 0x02, 0x15, 0x11,
-    0x14, 0x1e, 0x02, 0x02, 0xdb, 0x76, 0xaf, 0x73, 0x39, 0x2e, 0x58, 0x7d, 0x4e, 0x43, 0x70, 0x53,
-    0x2e, 0x48, 0x8c, 0xcc, 0xfe, 0xf7, 0xa1, 0xa2, 0xea, 0x95, 0x47, 0x0b, 0x16, 0x1c, 0x11, 0x16,
-    0x22, 0x17, 0x0c, 0x15, 0x32, 0x53, 0xc2, 0xd7, 0x40, 0x77, 0xa7, 0x66, 0x02, 0xa6, 0x62, 0x9b,
-    0x6c, 0x38, 0x2d, 0x57, 0x7a, 0x4d, 0x29, 0x5e, 0xca, 0xbd, 0x99, 0x59, 0xb4, 0x67, 0xa6, 0xbe,
-    0x56, 0x2b, 0x20, 0x32, 0x21, 0x11, 0x18, 0x31, 0x48, 0x32, 0xfd, 0x61, 0x3f, 0x62, 0x46, 0x24,
-    0x00, 0x04, 0x00, 0x90, 0x00, 0x00, 0x07, 0xbc, 0x05, 0xc0, 0x00, 0x03, 0x00, 0x15, 0x00, 0x27,
-    0x00, 0x31, 0x00, 0x25, 0x40, 0x11, 0x2b, 0x30, 0x2e, 0x2a, 0x02, 0x03, 0x1b, 0x12, 0x24, 0x09,
-    0x09, 0x31, 0x2e, 0x04, 0x2a, 0x2d, 0x0c, 0x00, 0x3f, 0x33, 0x3f, 0x33, 0x33, 0x2f, 0x33, 0xdc,
-    0x32, 0xce, 0x32, 0x11, 0x12, 0x39, 0x39, 0x30, 0x31, 0x41, 0x15, 0x21, 0x35, 0x03, 0x35, 0x34,
-    0x36, 0x36, 0x33, 0x32, 0x16, 0x16, 0x15, 0x15, 0x14, 0x06, 0x06, 0x23, 0x22, 0x26, 0x26, 0x37,
-    0x15, 0x14, 0x16, 0x16, 0x33, 0x32, 0x36, 0x36, 0x35, 0x35, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06,
-    0x06, 0x01, 0x11, 0x21, 0x01, 0x11, 0x23, 0x11, 0x21, 0x01, 0x11, 0x07, 0x92, 0xfd, 0xa3, 0x29,
-    0x55, 0x9a, 0x69, 0x6b, 0x99, 0x54, 0x53, 0x99, 0x6a, 0x6a, 0x9b, 0x55, 0xa8, 0x26, 0x50, 0x3c,
-    0x3b, 0x4e, 0x26, 0x27, 0x4e, 0x3c, 0x3b, 0x4f, 0x26, 0xfe, 0xcc, 0xfe, 0xf7, 0xfe, 0x0b, 0xf2,
-    0x01, 0x09, 0x01, 0xf6, 0x02, 0x2f, 0x8f, 0x8f, 0x01, 0xde, 0x53, 0x67, 0x9f, 0x5a, 0x5a, 0x9f,
-    0x67, 0x53, 0x67, 0x9e, 0x5a, 0x5a, 0x9e, 0xba, 0x53, 0x3d, 0x5e, 0x36, 0x36, 0x5e, 0x3d, 0x53,
-    0x3c, 0x5e, 0x37, 0x37, 0x5e, 0x01, 0x14, 0xfa, 0x50, 0x04, 0x13, 0xfb, 0xed, 0x05, 0xb0, 0xfb,
-    0xeb, 0x04, 0x15, 0x00, 0x00, 0x02, 0x00, 0x6f, 0x03, 0x95, 0x04, 0x5d, 0x05, 0xb0, 0x00, 0x0c,
-    0x00, 0x14, 0x00, 0x24, 0x40, 0x11, 0x09, 0x04, 0x01, 0x03, 0x06, 0x0a, 0x07, 0x07, 0x13, 0x14,
-    0x02, 0x00, 0x03, 0x03, 0x06, 0x06, 0x11, 0x00, 0x2f, 0x33, 0x11, 0x33, 0x11, 0x33, 0x3f, 0x33,
-    0x33, 0x11, 0x33, 0x12, 0x17, 0x39, 0x30, 0x31, 0x41, 0x11, 0x03, 0x23, 0x03, 0x11, 0x23, 0x11,
-    0x33, 0x13, 0x13, 0x33, 0x11, 0x01, 0x15, 0x23, 0x11, 0x23, 0x11, 0x23, 0x35, 0x03, 0xee, 0x7b,
-    0x40, 0x7c, 0x6f, 0x89, 0x82, 0x86, 0x84, 0xfd, 0xa0, 0x89, 0x78, 0x8d, 0x03, 0x95, 0x01, 0x75,
-    0xfe, 0x8b, 0x01, 0x76, 0xfe, 0x8a, 0x02, 0x1b, 0xfe, 0x81, 0x01, 0x7f, 0xfd, 0xe5, 0x02, 0x1b,
-    0x5e, 0xfe, 0x44, 0x01, 0xbc, 0x5e, 0x00, 0x02, 0x00, 0x96, 0xff, 0xec, 0x04, 0x91, 0x04, 0x4e,
-    0x00, 0x1d, 0x00, 0x26, 0x00, 0x17, 0x40, 0x0a, 0x22, 0x17, 0x17, 0x04, 0x1e, 0x0e, 0x07, 0x1b,
-    0x04, 0x0b, 0x00, 0x3f, 0x33, 0x3f, 0x33, 0x12, 0x39, 0x2f, 0x33, 0x30, 0x31, 0x65, 0x17, 0x06,
-    0x06, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x14, 0x14,
-    0x15, 0x21, 0x11, 0x16, 0x16, 0x33, 0x32, 0x36, 0x01, 0x22, 0x06, 0x07, 0x11, 0x21, 0x11, 0x26,
-    0x26, 0x04, 0x12, 0x02, 0x54, 0xbc, 0x62, 0x6d, 0xbe, 0x90, 0x51, 0x59, 0x96, 0xbb, 0x62, 0x67,
-    0xb3, 0x88, 0x4d, 0xfd, 0x00, 0x37, 0x8c, 0x4e, 0x5d, 0xbb, 0xfe, 0xe8, 0x4b, 0x8d, 0x39, 0x02,
-    0x1c, 0x34, 0x8a, 0xc6, 0x68, 0x34, 0x3e, 0x58, 0x9a, 0xcc, 0x73, 0x74, 0xcb, 0x9a, 0x58, 0x51,
-    0x92, 0xc5, 0x75, 0x03, 0x12, 0x1a, 0xfe, 0xb8, 0x33, 0x3b, 0x3b, 0x03, 0x69, 0x42, 0x38, 0xfe,
-    0xeb, 0x01, 0x1e, 0x34, 0x3d, 0x00, 0xff, 0xff, 0x00, 0x5c, 0xff, 0xf5, 0x05, 0xcc, 0x05, 0x9a,
-    0x04, 0x27, 0x01, 0xe0, 0xff, 0xd9, 0x02, 0x86, 0x00, 0x27, 0x01, 0x94, 0x00, 0xff, 0x00, 0x00,
-    0x01, 0x07, 0x02, 0x3e, 0x03, 0x22, 0x00, 0x00, 0x00, 0x07, 0xb1, 0x06, 0x04, 0x00, 0x3f, 0x30,
-    0x31, 0x00, 0xff, 0xff, 0x00, 0x56, 0xff, 0xf5, 0x06, 0x6a, 0x05, 0xb4, 0x04, 0x27, 0x02, 0x39,
-    0x00, 0x1f, 0x02, 0x94, 0x00, 0x27, 0x01, 0x94, 0x01, 0xa8, 0x00, 0x00, 0x00, 0x07, 0x02, 0x3e,
-    0x03, 0xc0, 0x00, 0x00, 0xff, 0xff, 0x00, 0x5e, 0xff, 0xf5, 0x06, 0x5a, 0x05, 0xa8, 0x04, 0x27,
-    0x02, 0x3b, 0x00, 0x0e, 0x02, 0x93, 0x00, 0x27, 0x01, 0x94, 0x01, 0x8e, 0x00, 0x00, 0x01, 0x07,
-    0x02, 0x3e, 0x03, 0xb1, 0x00, 0x00, 0x00, 0x07, 0xb1, 0x02, 0x04, 0x00, 0x3f, 0x30, 0x31, 0x00,
-    0xff, 0xff, 0x00, 0x5c, 0xff, 0xf5, 0x06, 0x1a, 0x05, 0xa4, 0x04, 0x27, 0x02, 0x3d, 0x00, 0x25,
-    0x02, 0x8f, 0x00, 0x27, 0x01, 0x94, 0x01, 0x37, 0x00, 0x00, 0x01, 0x07, 0x02, 0x3e, 0x03, 0x71,
-    0x00, 0x00, 0x00, 0x07, 0xb1, 0x06, 0x04, 0x00, 0x3f, 0x30, 0x31, 0x00, 0x00, 0x02, 0x00, 0x61,
-    0xff, 0xeb, 0x04, 0x46, 0x05, 0xf7, 0x00, 0x29, 0x00, 0x3f, 0x00, 0x19, 0x40, 0x0c, 0x2a, 0x00,
-    0x00, 0x12, 0x35, 0x1f, 0x0b, 0x72, 0x09, 0x12, 0x00, 0x72, 0x00, 0x2b, 0x32, 0x2b, 0x32, 0x11,
-    0x39, 0x2f, 0x33, 0x30, 0x31, 0x41, 0x32, 0x16, 0x17, 0x2e, 0x04, 0x23, 0x22, 0x06, 0x06, 0x07,
-    0x27, 0x3e, 0x02, 0x33, 0x32, 0x1e, 0x02, 0x12, 0x15, 0x15, 0x14, 0x0e, 0x03, 0x23, 0x22, 0x2e,
-    0x02, 0x35, 0x35, 0x34, 0x3e, 0x02, 0x17, 0x22, 0x0e, 0x02, 0x15, 0x15, 0x14, 0x1e, 0x02, 0x33,
-    0x32, 0x3e, 0x02, 0x35, 0x35, 0x2e, 0x03, 0x02, 0x39, 0x56, 0x99, 0x3b, 0x0a, 0x2d, 0x41, 0x53,
-    0x62, 0x37, 0x35, 0x53, 0x4f, 0x2e, 0x20, 0x24, 0x57, 0x72, 0x4d, 0x6c, 0xb2, 0x88, 0x5c, 0x30,
-    0x2a, 0x54, 0x79, 0x9d, 0x5f, 0x77, 0xb9, 0x80, 0x42, 0x3e, 0x7a, 0xaf, 0x8d, 0x45, 0x62, 0x3e,
-    0x1d, 0x1d, 0x3d, 0x62, 0x44, 0x45, 0x62, 0x3e, 0x1e, 0x09, 0x26, 0x3d, 0x59, 0x04, 0x05, 0x42,
-    0x40, 0x4f, 0x87, 0x6a, 0x4a, 0x26, 0x0c, 0x19, 0x12, 0xb2, 0x11, 0x22, 0x16, 0x48, 0x8b, 0xca,
-    0xfe, 0xfe, 0x9c, 0x3b, 0x70, 0xc8, 0xa4, 0x79, 0x41, 0x50, 0x8f, 0xc1, 0x72, 0x15, 0x6b, 0xb7,
-    0x87, 0x4a, 0xbf, 0x33, 0x58, 0x71, 0x3f, 0x16, 0x43, 0x78, 0x5b, 0x34, 0x3f, 0x6e, 0x93, 0x54,
-    0x5a, 0x18, 0x3c, 0x35, 0x24, 0x00, 0x00, 0x01, 0x00, 0xa6, 0xff, 0x16, 0x04, 0xe8, 0x05, 0xb0,
-    0x00, 0x07, 0x00, 0x0e, 0xb5, 0x04, 0x07, 0x02, 0x72, 0x02, 0x06, 0x00, 0x2f, 0x33, 0x2b, 0x32,
-    0x30, 0x31, 0x41, 0x11, 0x23, 0x11, 0x21, 0x11, 0x23, 0x11, 0x04, 0xe8, 0xf2, 0xfd, 0xa3, 0xf3,
-    0x05, 0xb0, 0xf9, 0x66, 0x05, 0xdd, 0xfa, 0x23, 0x06, 0x9a, 0x00, 0x03, 0x00, 0x3f, 0xfe, 0xf3,
-    0x04, 0xc3, 0x05, 0xb0, 0x00, 0x03, 0x00, 0x07, 0x00, 0x10, 0x00, 0x1f, 0x40, 0x0e, 0x0e, 0x06,
-    0x06, 0x07, 0x07, 0x0f, 0x02, 0x72, 0x0c, 0x03, 0x03, 0x0a, 0x02, 0x0b, 0x00, 0x2f, 0x33, 0x33,
-    0x33, 0x11, 0x33, 0x2b, 0x32, 0x11, 0x33, 0x11, 0x33, 0x30, 0x31, 0x45, 0x15, 0x21, 0x35, 0x01,
-    0x15, 0x21, 0x35, 0x01, 0x15, 0x01, 0x23, 0x35, 0x01, 0x01, 0x35, 0x33, 0x04, 0xc3, 0xfb, 0xd8,
-    0x03, 0xf3, 0xfc, 0x0a, 0x02, 0xf0, 0xfd, 0x5b, 0xa4, 0x02, 0x4a, 0xfd, 0xb6, 0xa4, 0x4e, 0xbf,
-    0xbf, 0x05, 0xfe, 0xbf, 0xbf, 0xfc, 0xb1, 0x1d, 0xfc, 0xaf, 0x91, 0x02, 0xcf, 0x02, 0xcb, 0x92,
-    0x00, 0x01, 0x00, 0x9c, 0x02, 0x70, 0x03, 0xef, 0x03, 0x31, 0x00, 0x03, 0x00, 0x08, 0xb1, 0x03,
-    0x02, 0x00, 0x2f, 0x33, 0x30, 0x31, 0x41, 0x15, 0x21, 0x35, 0x03, 0xef, 0xfc, 0xad, 0x03, 0x31,
-    0xc1, 0xc1, 0x00, 0x03, 0x00, 0x3b, 0xff, 0xff, 0x04, 0x7c, 0x05, 0xb0, 0x00, 0x04, 0x00, 0x09,
-    0x00, 0x0d, 0x00, 0x16, 0x40, 0x0a, 0x09, 0x0b, 0x0b, 0x0a, 0x04, 0x08, 0x08, 0x01, 0x02, 0x72,
-    0x00, 0x2b, 0x3f, 0x33, 0x2f, 0x33, 0x11, 0x33, 0x30, 0x31, 0x65, 0x01, 0x33, 0x01, 0x23, 0x03,
-    0x13, 0x17, 0x23, 0x01, 0x07, 0x35, 0x21, 0x15, 0x02, 0x2b, 0x01, 0x7f, 0xd2, 0xfe, 0x28, 0x9d,
-    0x6b, 0xb3, 0x20, 0x92, 0xfe, 0xe4, 0x86, 0x01, 0x53, 0xe9, 0x04, 0xc7, 0xfa, 0x4f, 0x03, 0x03,
-    0xfd, 0xe1, 0xe4, 0x03, 0x03, 0xc2, 0xc2, 0xc2, 0x00, 0x04, 0x00, 0x61, 0xff, 0xeb, 0x07, 0xea,
-    0x04, 0x4e, 0x00, 0x17, 0x00, 0x2f, 0x00, 0x47, 0x00, 0x5f, 0x00, 0x1d, 0x40, 0x0e, 0x5b, 0x36,
-    0x36, 0x1e, 0x13, 0x0b, 0x72, 0x4e, 0x43, 0x43, 0x2b, 0x06, 0x07, 0x72, 0x00, 0x2b, 0x32, 0x32,
-    0x11, 0x33, 0x2b, 0x32, 0x32, 0x11, 0x33, 0x30, 0x31, 0x53, 0x35, 0x34, 0x3e, 0x02, 0x33, 0x32,
-    0x1e, 0x03, 0x17, 0x15, 0x0e, 0x04, 0x23, 0x22, 0x2e, 0x02, 0x37, 0x15, 0x14, 0x1e, 0x02, 0x33,
-    0x32, 0x3e, 0x03, 0x37, 0x35, 0x2e, 0x04, 0x23, 0x22, 0x0e, 0x02, 0x05, 0x15, 0x14, 0x0e, 0x02,
-    0x23, 0x22, 0x2e, 0x03, 0x27, 0x35, 0x3e, 0x04, 0x33, 0x32, 0x1e, 0x02, 0x07, 0x35, 0x34, 0x2e,
-    0x02, 0x23, 0x22, 0x0e, 0x03, 0x07, 0x15, 0x1e, 0x04, 0x33, 0x32, 0x3e, 0x02, 0x61, 0x47, 0x83,
-    0xb8, 0x72, 0x6a, 0xa5, 0x7a, 0x54, 0x36, 0x0e, 0x0e, 0x36, 0x54, 0x7a, 0xa4, 0x69, 0x73, 0xb9,
-    0x83, 0x47, 0xed, 0x23, 0x46, 0x66, 0x42, 0x41, 0x66, 0x4d, 0x34, 0x1e, 0x04, 0x04, 0x1e, 0x33,
-    0x4d, 0x68, 0x42, 0x41, 0x66, 0x45, 0x23, 0x06, 0x9c, 0x47, 0x84, 0xb9, 0x72, 0x6a, 0xa4, 0x7a,
-    0x54, 0x36, 0x0e, 0x0e, 0x36, 0x55, 0x7a, 0xa4, 0x6b, 0x71, 0xb9, 0x84, 0x46, 0xed, 0x24, 0x45,
-    0x65, 0x41, 0x43, 0x67, 0x4d, 0x34, 0x1e, 0x04, 0x04, 0x1e, 0x34, 0x4d, 0x66, 0x42, 0x41, 0x66,
-    0x46, 0x24, 0x02, 0x11, 0x17, 0x70, 0xc7, 0x99, 0x56, 0x4f, 0x7e, 0x92, 0x8b, 0x32, 0x23, 0x32,
-    0x8c, 0x95, 0x81, 0x50, 0x57, 0x98, 0xc7, 0x87, 0x17, 0x4a, 0x80, 0x62, 0x36, 0x3a, 0x5b, 0x62,
-    0x54, 0x15, 0x23, 0x14, 0x52, 0x60, 0x5a, 0x39, 0x38, 0x62, 0x81, 0x48, 0x17, 0x70, 0xc7, 0x98,
-    0x57, 0x50, 0x81, 0x95, 0x8c, 0x32, 0x23, 0x32, 0x8b, 0x92, 0x7e, 0x4f, 0x56, 0x99, 0xc7, 0x87,
-    0x17, 0x48, 0x81, 0x62, 0x38, 0x39, 0x5a, 0x60, 0x52, 0x14, 0x23, 0x15, 0x54, 0x62, 0x5b, 0x3a,
-    0x36, 0x62, 0x80, 0x00, 0x00, 0x01, 0xff, 0xa7, 0xfe, 0x4b, 0x02, 0xa8, 0x06, 0x15, 0x00, 0x1f,
-    0x00, 0x10, 0xb7, 0x1b, 0x14, 0x01, 0x72, 0x0b, 0x04, 0x0f, 0x72, 0x00, 0x2b, 0x32, 0x2b, 0x32,
-    0x30, 0x31, 0x45, 0x14, 0x06, 0x06, 0x23, 0x22, 0x26, 0x27, 0x37, 0x16, 0x16, 0x33, 0x32, 0x36,
-    0x36, 0x35, 0x11, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x17, 0x07, 0x26, 0x26, 0x23, 0x22, 0x06,
-    0x06, 0x15, 0x01, 0x8e, 0x55, 0x9e, 0x6f, 0x23, 0x40, 0x22, 0x11, 0x12, 0x2c, 0x16, 0x2f, 0x40,
-    0x21, 0x5a, 0xa6, 0x74, 0x26, 0x4b, 0x27, 0x18, 0x13, 0x2c, 0x1f, 0x35, 0x4a, 0x25, 0x4d, 0x79,
-    0xa0, 0x4f, 0x08, 0x0a, 0xba, 0x04, 0x08, 0x23, 0x4b, 0x3a, 0x04, 0xf1, 0x78, 0xa5, 0x54, 0x0c,
-    0x09, 0xb5, 0x05, 0x06, 0x2a, 0x4f, 0x39, 0x00, 0x00, 0x02, 0x00, 0x65, 0x01, 0x06, 0x04, 0x18,
-    0x03, 0xf9, 0x00, 0x19, 0x00, 0x33, 0x00, 0x1b, 0x40, 0x0b, 0x17, 0x04, 0x80, 0x0a, 0x11, 0x40,
-    0x31, 0x1e, 0x80, 0x24, 0x2b, 0x00, 0x2f, 0x33, 0x1a, 0xdd, 0x32, 0x1a, 0xde, 0x32, 0x1a, 0xcd,
-    0x32, 0x30, 0x31, 0x53, 0x35, 0x36, 0x36, 0x33, 0x36, 0x16, 0x17, 0x16, 0x16, 0x33, 0x32, 0x36,
-    0x37, 0x17, 0x06, 0x06, 0x23, 0x22, 0x26, 0x27, 0x26, 0x26, 0x07, 0x22, 0x06, 0x03, 0x27, 0x36,
-    0x36, 0x33, 0x36, 0x16, 0x17, 0x16, 0x16, 0x33, 0x32, 0x36, 0x37, 0x15, 0x06, 0x06, 0x23, 0x22,
-    0x26, 0x27, 0x26, 0x26, 0x07, 0x22, 0x06, 0x66, 0x2f, 0x85, 0x41, 0x50, 0x63, 0x3f, 0x3b, 0x5e,
-    0x4a, 0x41, 0x77, 0x2f, 0x01, 0x2f, 0x74, 0x41, 0x4a, 0x5d, 0x3b, 0x3f, 0x64, 0x50, 0x41, 0x89,
-    0x2f, 0x01, 0x2f, 0x81, 0x41, 0x50, 0x63, 0x3f, 0x3b, 0x5e, 0x4a, 0x41, 0x7c, 0x2f, 0x2f, 0x77,
-    0x41, 0x4a, 0x5e, 0x3b, 0x3f, 0x64, 0x50, 0x41, 0x84, 0x02, 0xb7, 0xd4, 0x33, 0x39, 0x02, 0x2b,
-    0x20, 0x1e, 0x27, 0x43, 0x3c, 0xd3, 0x33, 0x39, 0x27, 0x1e, 0x20, 0x2b, 0x02, 0x44, 0xfe, 0x22,
-    0xd4, 0x32, 0x3a, 0x02, 0x2b, 0x20, 0x1e, 0x27, 0x43, 0x3c, 0xd4, 0x32, 0x3a, 0x27, 0x1e, 0x20,
-    0x2c, 0x02, 0x44, 0x00, 0x00, 0x03, 0x00, 0x8f, 0x00, 0x7f, 0x03, 0xf3, 0x04, 0xbf, 0x00, 0x03,
-    0x00, 0x07, 0x00, 0x0b, 0x00, 0x1f, 0x40, 0x0d, 0x02, 0x01, 0x01, 0x0a, 0x0a, 0x0b, 0x00, 0x03,
-    0x03, 0x07, 0x07, 0x06, 0x0b, 0x00, 0x2f, 0xce, 0x32, 0x11, 0x33, 0x11, 0x33, 0x11, 0x33, 0x11,
-    0x33, 0x11, 0x33, 0x30, 0x31, 0x41, 0x01, 0x27, 0x01, 0x17, 0x15, 0x21, 0x35, 0x01, 0x15, 0x21,
-    0x35, 0x03, 0x92, 0xfd, 0xc2, 0x6c, 0x02, 0x3e, 0xcd, 0xfc, 0x9c, 0x03, 0x64, 0xfc, 0x9c, 0x04,
-    0x83, 0xfb, 0xfc, 0x3c, 0x04, 0x04, 0xed, 0xc6, 0xc6, 0xfe, 0x58, 0xc6, 0xc6, 0x00, 0x00, 0x03,
-    0x00, 0x3d, 0x00, 0x01, 0x03, 0x90, 0x04, 0x4b, 0x00, 0x04, 0x00, 0x09, 0x00, 0x0d, 0x00, 0x22,
-    0x40, 0x10, 0x03, 0x07, 0x06, 0x00, 0x04, 0x08, 0x06, 0x05, 0x09, 0x09, 0x01, 0x02, 0x02, 0x0d,
-    0x0d, 0x0c, 0x00, 0x2f, 0x33, 0x7c, 0x10, 0xce, 0x2f, 0x32, 0x32, 0x18, 0x2f, 0x33, 0x17, 0x39,
-    0x30, 0x31, 0x53, 0x05, 0x15, 0x01, 0x35, 0x25, 0x05, 0x07, 0x35, 0x01, 0x13, 0x15, 0x21, 0x35,
-    0xf4, 0x02, 0x95, 0xfc, 0xb5, 0x03, 0x4b, 0xfd, 0x6b, 0xb6, 0x03, 0x4b, 0x07, 0xfc, 0xad, 0x02,
-    0xca, 0xde, 0xcc, 0x01, 0x44, 0x87, 0x94, 0xe1, 0x1d, 0x86, 0x01, 0x44, 0xfc, 0x6e, 0xb8, 0xb8,
-    0x00, 0x03, 0x00, 0x7d, 0x00, 0x00, 0x03, 0xde, 0x04, 0x58, 0x00, 0x04, 0x00, 0x09, 0x00, 0x0d,
-    0x00, 0x22, 0x40, 0x10, 0x03, 0x07, 0x06, 0x00, 0x04, 0x08, 0x06, 0x01, 0x02, 0x02, 0x05, 0x09,
-    0x09, 0x0d, 0x0d, 0x0c, 0x00, 0x2f, 0x33, 0x7c, 0x10, 0xce, 0x2f, 0x32, 0x32, 0x18, 0x2f, 0x33,
-    0x17, 0x39, 0x30, 0x31, 0x41, 0x25, 0x35, 0x01, 0x15, 0x05, 0x25, 0x37, 0x15, 0x01, 0x05, 0x15,
-    0x21, 0x35, 0x03, 0x1f, 0xfd, 0x5f, 0x03, 0x60, 0xfc, 0xa0, 0x02, 0xa3, 0xbd, 0xfc, 0xa0, 0x03,
-    0x52, 0xfc, 0xad, 0x02, 0xb3, 0xdd, 0xc8, 0xfe, 0xbc, 0x87, 0x98, 0xe1, 0x22, 0x87, 0xfe, 0xbb,
-    0x73, 0xb9, 0xb9, 0x00, 0x00, 0x02, 0x00, 0x25, 0x00, 0x00, 0x03, 0xeb, 0x05, 0xb0, 0x00, 0x07,
-    0x00, 0x0f, 0x00, 0x1d, 0x40, 0x0e, 0x05, 0x08, 0x08, 0x0e, 0x07, 0x12, 0x72, 0x03, 0x0a, 0x0a,
-    0x0b, 0x01, 0x02, 0x72, 0x00, 0x2b, 0x32, 0x32, 0x11, 0x33, 0x2b, 0x32, 0x32, 0x11, 0x33, 0x30,
-    0x31, 0x53, 0x01, 0x33, 0x07, 0x01, 0x01, 0x17, 0x23, 0x37, 0x01, 0x01, 0x27, 0x33, 0x01, 0x01,
-    0x23, 0x25, 0x01, 0x7f, 0xae, 0x28, 0xfe, 0xee, 0x01, 0x17, 0x1d, 0xa6, 0x3f, 0x01, 0x13, 0xfe,
-    0xeb, 0x1e, 0xa6, 0x01, 0x80, 0xfe, 0x82, 0xa6, 0x02, 0xd7, 0x02, 0xd9, 0xb5, 0xfd, 0xdc, 0xfd,
-    0xdb, 0xb2, 0xb1, 0x02, 0x26, 0x02, 0x24, 0xb5, 0xfd, 0x27, 0xfd, 0x29, 0xff, 0xff, 0x00, 0x9c,
-    0x00, 0xaa, 0x01, 0xb6, 0x05, 0x06, 0x04, 0x27, 0x00, 0x12, 0x00, 0x16, 0x00, 0xb6, 0x00, 0x07,
-    0x00, 0x12, 0x00, 0x16, 0x04, 0x09, 0x00, 0x02, 0x00, 0x64, 0x02, 0x84, 0x02, 0x32, 0x04, 0x3a,
-    0x00, 0x03, 0x00, 0x07, 0x00, 0x10, 0xb6, 0x06, 0x02, 0x02, 0x07, 0x03, 0x06, 0x72, 0x00, 0x2b,
-    0x32, 0x32, 0x11, 0x33, 0x30, 0x31, 0x53, 0x11, 0x23, 0x11, 0x21, 0x11, 0x23, 0x11, 0xfb, 0x97,
-    0x01, 0xce, 0x97, 0x04, 0x3a, 0xfe, 0x4a, 0x01, 0xb6, 0xfe, 0x4a, 0x01, 0xb6, 0x00, 0x00, 0x01,
-    0x00, 0x47, 0xff, 0x64, 0x01, 0x54, 0x01, 0x00, 0x00, 0x09, 0x00, 0x0a, 0xb2, 0x04, 0x80, 0x09,
-    0x00, 0x2f, 0x1a, 0xcd, 0x30, 0x31, 0x41, 0x15, 0x14, 0x06, 0x07, 0x27, 0x36, 0x36, 0x35, 0x35,
-    0x01, 0x54, 0x4d, 0x43, 0x7d, 0x24, 0x27, 0x01, 0x00, 0x4b, 0x57, 0xbc, 0x3e, 0x4b, 0x38, 0x78,
-    0x4d, 0x54, 0xff, 0xff, 0x00, 0x2b, 0x00, 0x00, 0x05, 0x1c, 0x06, 0x15, 0x04, 0x26, 0x00, 0x4a,
-    0x00, 0x00, 0x00, 0x07, 0x00, 0x4a, 0x02, 0x46, 0x00, 0x00, 0x00, 0x03, 0x00, 0x1a, 0x00, 0x00,
-    0x04, 0x1d, 0x06, 0x15, 0x00, 0x10, 0x00, 0x14, 0x00, 0x18, 0x00, 0x1b, 0x40, 0x0f, 0x18, 0x06,
-    0x17, 0x0a, 0x72, 0x13, 0x14, 0x06, 0x72, 0x0d, 0x06, 0x01, 0x72, 0x01, 0x0a, 0x00, 0x3f, 0x2b,
-    0x32, 0x2b, 0x32, 0x2b, 0x3f, 0x30, 0x31, 0x61, 0x23, 0x11, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16,
-    0x17, 0x07, 0x26, 0x26, 0x23, 0x22, 0x06, 0x15, 0x17, 0x15, 0x21, 0x35, 0x21, 0x11, 0x23, 0x11,
-    0x01, 0xb2, 0xf2, 0x69, 0xc5, 0x88, 0x50, 0x95, 0x50, 0x25, 0x33, 0x7c, 0x51, 0x6d, 0x67, 0xd9,
-    0xfd, 0x8f, 0x04, 0x03, 0xf1, 0x04, 0x80, 0x83, 0xb4, 0x5e, 0x22, 0x1a, 0xc4, 0x11, 0x1f, 0x63,
-    0x62, 0x46, 0xb0, 0xb0, 0xfb, 0xc6, 0x04, 0x3a, 0x00, 0x03, 0x00, 0x2b, 0x00, 0x00, 0x04, 0x2e,
-    0x06, 0x15, 0x00, 0x12, 0x00, 0x16, 0x00, 0x1a, 0x00, 0x1b, 0x40, 0x0f, 0x19, 0x1a, 0x06, 0x72,
-    0x14, 0x00, 0x72, 0x0e, 0x06, 0x01, 0x72, 0x13, 0x01, 0x0a, 0x72, 0x00, 0x2b, 0x32, 0x2b, 0x32,
-    0x2b, 0x2b, 0x32, 0x30, 0x31, 0x61, 0x23, 0x11, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x16, 0x17,
-    0x07, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x15, 0x01, 0x11, 0x33, 0x11, 0x01, 0x15, 0x21, 0x35,
-    0x01, 0xc2, 0xf1, 0x61, 0xb8, 0x82, 0x34, 0x9d, 0xaa, 0x47, 0x68, 0x5d, 0xa0, 0x41, 0x40, 0x58,
-    0x2e, 0x01, 0x7b, 0xf1, 0xfe, 0x73, 0xfd, 0x8a, 0x04, 0x9b, 0x7b, 0xa8, 0x57, 0x0e, 0x15, 0x0b,
-    0xb9, 0x11, 0x13, 0x2b, 0x51, 0x3b, 0xfb, 0x65, 0x05, 0xe7, 0xfa, 0x19, 0x04, 0x3a, 0xb0, 0xb0,
-    0x00, 0x05, 0x00, 0x2b, 0x00, 0x00, 0x06, 0x9a, 0x06, 0x15, 0x00, 0x11, 0x00, 0x15, 0x00, 0x26,
-    0x00, 0x2a, 0x00, 0x2e, 0x00, 0x25, 0x40, 0x14, 0x23, 0x1c, 0x01, 0x72, 0x2e, 0x2a, 0x14, 0x15,
-    0x06, 0x72, 0x0d, 0x06, 0x01, 0x72, 0x2d, 0x17, 0x17, 0x01, 0x0a, 0x72, 0x00, 0x2b, 0x32, 0x11,
-    0x33, 0x2b, 0x32, 0x2b, 0x32, 0x32, 0x32, 0x2b, 0x32, 0x30, 0x31, 0x61, 0x23, 0x11, 0x34, 0x36,
-    0x36, 0x33, 0x32, 0x16, 0x17, 0x07, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x15, 0x17, 0x15, 0x21,
-    0x35, 0x01, 0x23, 0x11, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x17, 0x07, 0x26, 0x26, 0x23, 0x22,
-    0x06, 0x15, 0x17, 0x15, 0x21, 0x35, 0x21, 0x11, 0x23, 0x11, 0x01, 0xc2, 0xf1, 0x5b, 0xaa, 0x74,
-    0x24, 0x46, 0x21, 0x06, 0x14, 0x2f, 0x1b, 0x37, 0x4f, 0x29, 0xe5, 0xfd, 0x84, 0x04, 0x03, 0xf1,
-    0x68, 0xc5, 0x88, 0x50, 0x96, 0x4f, 0x25, 0x32, 0x7d, 0x50, 0x6d, 0x68, 0xda, 0xfd, 0x8f, 0x04,
-    0x03, 0xf2, 0x04, 0xa2, 0x79, 0xa5, 0x55, 0x09, 0x09, 0xba, 0x05, 0x04, 0x29, 0x4e, 0x39, 0x68,
-    0xb0, 0xb0, 0xfb, 0xc6, 0x04, 0x80, 0x83, 0xb4, 0x5e, 0x22, 0x1a, 0xc4, 0x11, 0x1f, 0x63, 0x62,
-    0x46, 0xb0, 0xb0, 0xfb, 0xc6, 0x04, 0x3a, 0x00, 0x00, 0x05, 0x00, 0x2b, 0x00, 0x00, 0x06, 0x9a,
-    0x06, 0x15, 0x00, 0x11, 0x00, 0x15, 0x00, 0x28, 0x00, 0x2c, 0x00, 0x30, 0x00, 0x29, 0x40, 0x17,
-    0x2b, 0x00, 0x72, 0x24, 0x1c, 0x01, 0x72, 0x2e, 0x14, 0x14, 0x2d, 0x15, 0x06, 0x72, 0x0d, 0x06,
-    0x01, 0x72, 0x29, 0x17, 0x01, 0x0a, 0x72, 0x00, 0x2b, 0x32, 0x32, 0x2b, 0x32, 0x2b, 0x32, 0x32,
-    0x11, 0x33, 0x2b, 0x32, 0x2b, 0x30, 0x31, 0x61, 0x23, 0x11, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16,
-    0x17, 0x07, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x15, 0x17, 0x15, 0x21, 0x35, 0x01, 0x23, 0x11,
-    0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x16, 0x17, 0x07, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x15,
-    0x01, 0x11, 0x33, 0x11, 0x01, 0x15, 0x21, 0x35, 0x01, 0xc2, 0xf1, 0x5b, 0xaa, 0x74, 0x24, 0x46,
-    0x21, 0x06, 0x14, 0x2f, 0x1b, 0x37, 0x4f, 0x29, 0xe6, 0xfd, 0x83, 0x04, 0x03, 0xf1, 0x61, 0xb7,
-    0x83, 0x34, 0x9d, 0xaa, 0x47, 0x69, 0x5c, 0xa0, 0x41, 0x40, 0x59, 0x2d, 0x01, 0x7a, 0xf2, 0xfe,
-    0x73, 0xfd, 0x8a, 0x04, 0xa2, 0x79, 0xa5, 0x55, 0x09, 0x09, 0xba, 0x05, 0x04, 0x29, 0x4e, 0x39,
-    0x68, 0xb0, 0xb0, 0xfb, 0xc6, 0x04, 0x9b, 0x7b, 0xa8, 0x57, 0x0e, 0x15, 0x0b, 0xb9, 0x11, 0x13,
-    0x2b, 0x51, 0x3b, 0xfb, 0x65, 0x05, 0xe7, 0xfa, 0x19, 0x04, 0x3a, 0xb0, 0xb0, 0x00, 0x00, 0x04,
-    0x00, 0x2b, 0xff, 0xec, 0x04, 0xd3, 0x06, 0x15, 0x00, 0x03, 0x00, 0x17, 0x00, 0x1b, 0x00, 0x2d,
-    0x00, 0x25, 0x40, 0x14, 0x22, 0x29, 0x0b, 0x72, 0x13, 0x0a, 0x72, 0x09, 0x1c, 0x1c, 0x0d, 0x0d,
-    0x04, 0x01, 0x72, 0x18, 0x02, 0x03, 0x06, 0x72, 0x00, 0x2b, 0x32, 0x32, 0x2b, 0x32, 0x11, 0x33,
-    0x11, 0x33, 0x2b, 0x2b, 0x32, 0x30, 0x31, 0x41, 0x15, 0x21, 0x35, 0x01, 0x32, 0x16, 0x17, 0x15,
-    0x23, 0x35, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x15, 0x11, 0x23, 0x11, 0x34, 0x36, 0x36, 0x01,
-    0x15, 0x21, 0x35, 0x13, 0x33, 0x11, 0x14, 0x16, 0x16, 0x33, 0x32, 0x36, 0x37, 0x15, 0x06, 0x06,
-    0x23, 0x22, 0x26, 0x26, 0x35, 0x01, 0x8c, 0xfe, 0x9f, 0x02, 0x19, 0x76, 0xf0, 0x5f, 0xf1, 0x19,
-    0x66, 0x33, 0x35, 0x49, 0x26, 0xf1, 0x59, 0xa6, 0x02, 0xfa, 0xfd, 0x9f, 0xaf, 0xf1, 0x1d, 0x34,
-    0x23, 0x19, 0x2e, 0x0f, 0x1e, 0x4f, 0x32, 0x54, 0x7f, 0x49, 0x04, 0x3a, 0xb0, 0xb0, 0x01, 0xdb,
-    0x3d, 0x2a, 0xd0, 0x57, 0x0d, 0x13, 0x2a, 0x50, 0x39, 0xfb, 0x5e, 0x04, 0xa2, 0x79, 0xa5, 0x55,
-    0xfe, 0x25, 0xb0, 0xb0, 0x01, 0x09, 0xfb, 0xe8, 0x32, 0x35, 0x12, 0x06, 0x03, 0xb8, 0x09, 0x0e,
-    0x3b, 0x86, 0x6f, 0x00, 0x00, 0x04, 0x00, 0x49, 0xff, 0xec, 0x06, 0x82, 0x06, 0x14, 0x00, 0x1b,
-    0x00, 0x1f, 0x00, 0x31, 0x00, 0x67, 0x00, 0x31, 0x40, 0x1b, 0x3b, 0x32, 0x40, 0x64, 0x60, 0x5b,
-    0x0b, 0x72, 0x01, 0x45, 0x49, 0x40, 0x07, 0x72, 0x26, 0x2d, 0x0b, 0x72, 0x1e, 0x10, 0x1f, 0x06,
-    0x72, 0x14, 0x0a, 0x01, 0x72, 0x00, 0x2b, 0x32, 0x2b, 0x32, 0x32, 0x2b, 0x32, 0x2b, 0x32, 0xcc,
-    0x32, 0x2b, 0xcc, 0x33, 0x12, 0x39, 0x39, 0x30, 0x31, 0x41, 0x23, 0x2e, 0x02, 0x35, 0x34, 0x3e,
-    0x02, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x23, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06, 0x15, 0x14, 0x1e,
-    0x02, 0x25, 0x15, 0x21, 0x35, 0x37, 0x33, 0x11, 0x14, 0x16, 0x16, 0x33, 0x32, 0x36, 0x37, 0x15,
-    0x06, 0x06, 0x23, 0x22, 0x26, 0x26, 0x35, 0x05, 0x34, 0x26, 0x26, 0x27, 0x2e, 0x03, 0x35, 0x34,
-    0x3e, 0x02, 0x33, 0x32, 0x16, 0x16, 0x15, 0x23, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x15,
-    0x14, 0x1e, 0x02, 0x17, 0x1e, 0x02, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x26, 0x26, 0x35, 0x33,
-    0x1e, 0x02, 0x33, 0x32, 0x36, 0x36, 0x03, 0xc1, 0x78, 0x26, 0x58, 0x3e, 0x34, 0x65, 0x90, 0x5c,
-    0x7b, 0xa4, 0x5f, 0x28, 0xf2, 0x2c, 0x52, 0x3a, 0x57, 0x50, 0x1c, 0x23, 0x1b, 0x02, 0xb8, 0xfd,
-    0xa4, 0xa9, 0xf2, 0x1d, 0x34, 0x22, 0x19, 0x2f, 0x0f, 0x1e, 0x4f, 0x33, 0x53, 0x80, 0x49, 0xfe,
-    0x15, 0x24, 0x65, 0x62, 0x56, 0x8f, 0x66, 0x38, 0x3a, 0x6c, 0x9b, 0x60, 0x88, 0xc3, 0x68, 0xf1,
-    0x2b, 0x56, 0x41, 0x3e, 0x51, 0x27, 0x15, 0x32, 0x57, 0x42, 0x7c, 0xb3, 0x60, 0x3d, 0x74, 0xa1,
-    0x64, 0x93, 0xcc, 0x69, 0xe9, 0x04, 0x43, 0x65, 0x36, 0x41, 0x58, 0x2e, 0x02, 0xf7, 0x6b, 0xaa,
-    0x97, 0x4d, 0x3d, 0x6a, 0x50, 0x2d, 0x44, 0x71, 0x89, 0x45, 0x43, 0x5b, 0x2f, 0x5c, 0x3f, 0x3c,
-    0x66, 0x66, 0x77, 0xf6, 0xb0, 0xb0, 0x59, 0xfc, 0xab, 0x37, 0x3d, 0x18, 0x06, 0x03, 0xb8, 0x09,
-    0x0e, 0x44, 0x94, 0x79, 0x18, 0x24, 0x3b, 0x30, 0x14, 0x13, 0x35, 0x4c, 0x68, 0x44, 0x42, 0x76,
-    0x5a, 0x34, 0x5b, 0x9b, 0x61, 0x2b, 0x4b, 0x2f, 0x27, 0x3e, 0x25, 0x1b, 0x2b, 0x23, 0x1e, 0x0e,
-    0x1a, 0x51, 0x7f, 0x61, 0x48, 0x77, 0x57, 0x30, 0x69, 0xa5, 0x59, 0x43, 0x4f, 0x23, 0x23, 0x3d,
-    0x00, 0x15, 0x00, 0x59, 0xfe, 0x72, 0x07, 0xec, 0x05, 0xae, 0x00, 0x05, 0x00, 0x0b, 0x00, 0x11,
-    0x00, 0x17, 0x00, 0x1b, 0x00, 0x1f, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2b, 0x00, 0x2f, 0x00, 0x33,
-    0x00, 0x37, 0x00, 0x3b, 0x00, 0x3f, 0x00, 0x43, 0x00, 0x47, 0x00, 0x57, 0x00, 0x73, 0x00, 0x8c,
-    0x00, 0x9a, 0x00, 0xa8, 0x00, 0x00, 0x53, 0x23, 0x11, 0x21, 0x15, 0x23, 0x21, 0x23, 0x35, 0x21,
-    0x11, 0x23, 0x01, 0x21, 0x11, 0x33, 0x15, 0x33, 0x05, 0x21, 0x35, 0x33, 0x35, 0x33, 0x01, 0x21,
-    0x35, 0x21, 0x05, 0x21, 0x35, 0x21, 0x11, 0x21, 0x35, 0x21, 0x01, 0x15, 0x23, 0x35, 0x13, 0x15,
-    0x23, 0x35, 0x01, 0x21, 0x35, 0x21, 0x01, 0x15, 0x23, 0x35, 0x01, 0x21, 0x35, 0x21, 0x05, 0x21,
-    0x35, 0x21, 0x01, 0x15, 0x23, 0x35, 0x13, 0x15, 0x23, 0x35, 0x01, 0x15, 0x23, 0x35, 0x07, 0x11,
-    0x33, 0x11, 0x14, 0x06, 0x23, 0x22, 0x26, 0x35, 0x33, 0x14, 0x16, 0x33, 0x32, 0x36, 0x25, 0x23,
-    0x27, 0x33, 0x32, 0x36, 0x35, 0x34, 0x26, 0x23, 0x23, 0x11, 0x23, 0x11, 0x33, 0x32, 0x16, 0x16,
-    0x15, 0x14, 0x06, 0x06, 0x07, 0x22, 0x06, 0x07, 0x06, 0x14, 0x07, 0x23, 0x37, 0x33, 0x32, 0x36,
-    0x35, 0x34, 0x26, 0x23, 0x23, 0x37, 0x33, 0x32, 0x14, 0x17, 0x14, 0x16, 0x31, 0x1e, 0x02, 0x15,
-    0x14, 0x06, 0x01, 0x15, 0x14, 0x06, 0x23, 0x22, 0x26, 0x35, 0x35, 0x34, 0x36, 0x33, 0x32, 0x16,
-    0x07, 0x35, 0x34, 0x26, 0x23, 0x22, 0x06, 0x15, 0x15, 0x14, 0x16, 0x33, 0x32, 0x36, 0xca, 0x71,
-    0x01, 0x35, 0xc4, 0x06, 0xb3, 0xc7, 0x01, 0x36, 0x6f, 0xfa, 0x11, 0xfe, 0xcb, 0x71, 0xc4, 0x06,
-    0x5e, 0xfe, 0xca, 0xc7, 0x6f, 0xfe, 0x51, 0xfe, 0xea, 0x01, 0x16, 0xfc, 0xe0, 0xfe, 0xec, 0x01,
-    0x14, 0xfe, 0xec, 0x01, 0x14, 0x04, 0xcf, 0x6f, 0x6f, 0x6f, 0xfd, 0x30, 0xfe, 0xeb, 0x01, 0x15,
-    0xfc, 0x1d, 0x71, 0x04, 0x54, 0xfe, 0xeb, 0x01, 0x15, 0x01, 0x90, 0xfe, 0xea, 0x01, 0x16, 0xfa,
-    0x8d, 0x71, 0x71, 0x71, 0x07, 0x93, 0x6f, 0xe8, 0x5c, 0x6b, 0x50, 0x58, 0x6d, 0x5d, 0x38, 0x30,
-    0x29, 0x36, 0xfd, 0xc2, 0x96, 0x01, 0x76, 0x3b, 0x3b, 0x3b, 0x3b, 0x5d, 0x5f, 0xbc, 0x42, 0x5f,
-    0x33, 0x22, 0x41, 0x2f, 0x01, 0x04, 0x02, 0x0c, 0x0e, 0xb9, 0x30, 0x89, 0x34, 0x33, 0x33, 0x34,
-    0x77, 0x01, 0x97, 0x0e, 0x0c, 0x07, 0x2b, 0x3a, 0x1e, 0x69, 0xfe, 0x84, 0x7f, 0x66, 0x67, 0x81,
-    0x80, 0x66, 0x67, 0x80, 0x5c, 0x4a, 0x41, 0x40, 0x4a, 0x4b, 0x41, 0x40, 0x49, 0x04, 0x91, 0x01,
-    0x1d, 0x74, 0x74, 0xfe, 0xe3, 0xf9, 0xe1, 0x01, 0x3b, 0xca, 0x71, 0x71, 0xca, 0xfe, 0xc5, 0x71,
-    0x71, 0x71, 0x06, 0x57, 0x74, 0xfb, 0x74, 0xf9, 0xf9, 0x02, 0xf2, 0xfa, 0xfa, 0xfa, 0x5e, 0x71,
-    0x02, 0x3f, 0xf9, 0xf9, 0x04, 0x18, 0x74, 0x74, 0x74, 0xfc, 0xee, 0xfc, 0xfc, 0x01, 0x78, 0xfa,
-    0xfa, 0xfe, 0x88, 0xfc, 0xfc, 0xf3, 0x01, 0x7a, 0xfe, 0x86, 0x4f, 0x5c, 0x51, 0x53, 0x2e, 0x2d,
-    0x37, 0x72, 0x46, 0x29, 0x27, 0x29, 0x1e, 0xfe, 0x2f, 0x02, 0x25, 0x20, 0x42, 0x34, 0x22, 0x38,
-    0x24, 0x04, 0x13, 0x01, 0x04, 0x01, 0xf4, 0x4b, 0x2c, 0x27, 0x27, 0x2f, 0x46, 0x01, 0x05, 0x01,
-    0x13, 0x04, 0x26, 0x39, 0x22, 0x4c, 0x4f, 0x01, 0x48, 0x70, 0x61, 0x7a, 0x7a, 0x61, 0x70, 0x61,
-    0x7a, 0x7a, 0xd1, 0x70, 0x44, 0x4f, 0x4f, 0x44, 0x70, 0x45, 0x4e, 0x4e, 0x00, 0x05, 0x00, 0x5c,
-    0xfd, 0xd5, 0x07, 0xd7, 0x08, 0x73, 0x00, 0x03, 0x00, 0x1e, 0x00, 0x22, 0x00, 0x26, 0x00, 0x2a,
-    0x00, 0x00, 0x53, 0x09, 0x02, 0x03, 0x33, 0x34, 0x36, 0x37, 0x36, 0x36, 0x35, 0x34, 0x26, 0x23,
-    0x22, 0x06, 0x07, 0x33, 0x36, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14, 0x06, 0x07, 0x0e, 0x02, 0x13,
-    0x35, 0x23, 0x15, 0x13, 0x35, 0x33, 0x15, 0x03, 0x35, 0x33, 0x15, 0x5c, 0x03, 0xbc, 0x03, 0xbf,
-    0xfc, 0x41, 0x77, 0xca, 0x19, 0x29, 0x44, 0x62, 0xa7, 0x95, 0x7f, 0xb1, 0x02, 0xcb, 0x02, 0x3e,
-    0x27, 0x38, 0x39, 0x35, 0x28, 0x2f, 0x3d, 0x1d, 0xc9, 0xca, 0x7f, 0x04, 0x06, 0x04, 0x02, 0x83,
-    0x03, 0xcf, 0xfc, 0x31, 0xfc, 0x31, 0x02, 0xde, 0x33, 0x3e, 0x1b, 0x25, 0x81, 0x52, 0x80, 0x97,
-    0x7d, 0x8d, 0x37, 0x30, 0x40, 0x34, 0x34, 0x4d, 0x1a, 0x21, 0x3a, 0x4e, 0xfe, 0xbb, 0xaa, 0xaa,
-    0xfd, 0x48, 0x04, 0x04, 0x0a, 0x9a, 0x04, 0x04, 0x00, 0x01, 0x00, 0x3d, 0x00, 0x00, 0x02, 0xb0,
-    0x03, 0x20, 0x00, 0x1c, 0x00, 0x10, 0xb5, 0x03, 0x1c, 0x1c, 0x0b, 0x13, 0x02, 0x00, 0x2f, 0xcc,
-    0x32, 0x33, 0x11, 0x33, 0x30, 0x31, 0x65, 0x15, 0x21, 0x35, 0x01, 0x3e, 0x02, 0x35, 0x34, 0x26,
-    0x23, 0x22, 0x06, 0x15, 0x23, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x16, 0x15, 0x14, 0x06, 0x06,
-    0x07, 0x07, 0x02, 0xb0, 0xfd, 0x9f, 0x01, 0x1f, 0x29, 0x31, 0x17, 0x38, 0x35, 0x40, 0x3f, 0xb6,
-    0x49, 0x87, 0x5e, 0x5f, 0x85, 0x47, 0x30, 0x5b, 0x43, 0x8d, 0x91, 0x91, 0x7a, 0x01, 0x09, 0x25,
-    0x3f, 0x34, 0x12, 0x2b, 0x37, 0x47, 0x33, 0x49, 0x7a, 0x48, 0x3a, 0x6c, 0x4c, 0x37, 0x5d, 0x5c,
-    0x37, 0x76, 0x00, 0x01, 0x00, 0x82, 0x00, 0x00, 0x02, 0x01, 0x03, 0x14, 0x00, 0x06, 0x00, 0x23,
-    0x40, 0x15, 0x04, 0x05, 0x05, 0x03, 0x03, 0x2f, 0x00, 0x7f, 0x00, 0x02, 0x0f, 0x00, 0x5f, 0x00,
-    0xaf, 0x00, 0xff, 0x00, 0x04, 0x00, 0x01, 0x00, 0x2f, 0xcd, 0x5d, 0x71, 0x32, 0x11, 0x33, 0x11,
-    0x33, 0x30, 0x31, 0x41, 0x11, 0x23, 0x11, 0x07, 0x35, 0x25, 0x02, 0x01, 0xb5, 0xca, 0x01, 0x6c,
-    0x03, 0x14, 0xfc, 0xec, 0x02, 0x40, 0x31, 0x8f, 0x76, 0x00, 0x00, 0x02, 0x00, 0x4c, 0xff, 0xf5,
-    0x02, 0xa9, 0x03, 0x20, 0x00, 0x11, 0x00, 0x23, 0x00, 0x0c, 0xb3, 0x17, 0x0e, 0x20, 0x05, 0x00,
-    0x2f, 0x33, 0xc4, 0x32, 0x30, 0x31, 0x41, 0x15, 0x14, 0x06, 0x06, 0x23, 0x22, 0x26, 0x26, 0x35,
-    0x35, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x16, 0x03, 0x35, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06,
-    0x06, 0x15, 0x15, 0x14, 0x16, 0x16, 0x33, 0x32, 0x36, 0x36, 0x02, 0xa9, 0x4c, 0x88, 0x59, 0x5b,
-    0x88, 0x4d, 0x4c, 0x88, 0x5a, 0x5a, 0x88, 0x4d, 0xb6, 0x1d, 0x36, 0x26, 0x26, 0x35, 0x1d, 0x1d,
-    0x37, 0x26, 0x26, 0x35, 0x1c, 0x01, 0xd6, 0x98, 0x70, 0x92, 0x47, 0x47, 0x92, 0x70, 0x98, 0x70,
-    0x92, 0x48, 0x48, 0x92, 0xfe, 0xee, 0xad, 0x3d, 0x4c, 0x24, 0x24, 0x4c, 0x3d, 0xad, 0x3e, 0x4c,
-    0x23, 0x23, 0x4c, 0x00, 0x00, 0x01, 0x00, 0x4f, 0xff, 0xf4, 0x03, 0xb8, 0x04, 0x9d, 0x00, 0x32,
-    0x00, 0x17, 0x40, 0x0a, 0x14, 0x1e, 0x1e, 0x26, 0x01, 0x31, 0x0a, 0x0c, 0x26, 0x7e, 0x00, 0x3f,
-    0x33, 0x3f, 0x33, 0x12, 0x39, 0x2f, 0x33, 0x30, 0x31, 0x65, 0x33, 0x32, 0x3e, 0x02, 0x35, 0x35,
-    0x34, 0x2e, 0x02, 0x23, 0x22, 0x06, 0x06, 0x15, 0x14, 0x16, 0x16, 0x33, 0x32, 0x3e, 0x02, 0x37,
-    0x17, 0x0e, 0x02, 0x23, 0x22, 0x26, 0x26, 0x35, 0x34, 0x36, 0x36, 0x33, 0x32, 0x1e, 0x02, 0x15,
-    0x15, 0x14, 0x0e, 0x02, 0x23, 0x23, 0x01, 0x19, 0x13, 0x6c, 0x9b, 0x64, 0x31, 0x1e, 0x36, 0x48,
-    0x2a, 0x3d, 0x58, 0x2e, 0x2c, 0x58, 0x43, 0x30, 0x4d, 0x37, 0x1f, 0x01, 0x47, 0x02, 0x58, 0x97,
-    0x63, 0x7c, 0xaa, 0x58, 0x6a, 0xc4, 0x85, 0x66, 0xa1, 0x73, 0x3c, 0x50, 0xa1, 0xf4, 0xa5, 0x15,
-    0xb4, 0x2b, 0x58, 0x85, 0x5a, 0xd8, 0x3d, 0x59, 0x3c, 0x1d, 0x3c, 0x65, 0x3d, 0x3a, 0x60, 0x38,
-    0x1e, 0x31, 0x3a, 0x1d, 0x44, 0x43, 0x80, 0x53, 0x63, 0xb0, 0x73, 0x72, 0xbb, 0x71, 0x41, 0x7b,
-    0xb0, 0x70, 0x49, 0x9b, 0xef, 0xa5, 0x55, 0x00, 0x00, 0x04, 0x00, 0x57, 0xff, 0xf0, 0x03, 0xc6,
-    0x04, 0x9d, 0x00, 0x12, 0x00, 0x22, 0x00, 0x34, 0x00, 0x44, 0x00, 0x1d, 0x40, 0x0d, 0x28, 0x17,
-    0x17, 0x41, 0x0e, 0x0e, 0x05, 0x39, 0x31, 0x7e, 0x1f, 0x05, 0x0b, 0x00, 0x3f, 0x33, 0x3f, 0x33,
-    0x12, 0x39, 0x2f, 0x33, 0x33, 0x11, 0x33, 0x30, 0x31, 0x41, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x26,
-    0x26, 0x35, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x1e, 0x02, 0x07, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06,
-    0x06, 0x15, 0x14, 0x16, 0x16, 0x33, 0x32, 0x36, 0x36, 0x13, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e,
-    0x02, 0x35, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x16, 0x07, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06,
-    0x06, 0x15, 0x14, 0x16, 0x16, 0x33, 0x32, 0x36, 0x36, 0x03, 0xc6, 0x43, 0x76, 0xa0, 0x5e, 0x7d,
-    0xc7, 0x74, 0x41, 0x77, 0x9f, 0x5f, 0x5f, 0xa1, 0x77, 0x42, 0xf2, 0x32, 0x5a, 0x3b, 0x3b, 0x59,
-    0x31, 0x31, 0x5a, 0x3c, 0x3b, 0x59, 0x31, 0xd5, 0x3d, 0x6e, 0x95, 0x5a, 0x5a, 0x96, 0x6e, 0x3d,
-    0x69, 0xba, 0x76, 0x78, 0xb9, 0x6b, 0xf1, 0x2a, 0x4c, 0x35, 0x34, 0x4b, 0x29, 0x29, 0x4d, 0x34,
-    0x35, 0x4b, 0x29, 0x01, 0x3f, 0x53, 0x7d, 0x54, 0x2b, 0x4b, 0x96, 0x6e, 0x4c, 0x77, 0x55, 0x2d,
-    0x2d, 0x55, 0x77, 0x39, 0x33, 0x48, 0x27, 0x27, 0x48, 0x33, 0x33, 0x49, 0x27, 0x27, 0x49, 0x02,
-    0x38, 0x44, 0x6f, 0x51, 0x2b, 0x2b, 0x51, 0x6f, 0x44, 0x6a, 0x91, 0x4b, 0x4b, 0x91, 0x76, 0x2c,
-    0x43, 0x24, 0x24, 0x41, 0x2e, 0x2d, 0x44, 0x26, 0x26, 0x44, 0x00, 0x01, 0x00, 0x38, 0x00, 0x00,
-    0x03, 0xce, 0x04, 0x8d, 0x00, 0x06, 0x00, 0x0e, 0xb5, 0x05, 0x01, 0x06, 0x7d, 0x03, 0x0a, 0x00,
-    0x3f, 0x3f, 0x33, 0x33, 0x30, 0x31, 0x41, 0x15, 0x01, 0x23, 0x01, 0x21, 0x35, 0x03, 0xce, 0xfd,
-    0xff, 0xfe, 0x02, 0x01, 0xfd, 0x68, 0x04, 0x8d, 0x85, 0xfb, 0xf8, 0x03, 0xcd, 0xc0, 0x00, 0x01,
-    0x00, 0x5f, 0xff, 0xf0, 0x03, 0xd8, 0x04, 0x9b, 0x00, 0x31, 0x00, 0x15, 0x40, 0x09, 0x16, 0x1f,
-    0x1f, 0x0e, 0x27, 0x0b, 0x03, 0x00, 0x7e, 0x00, 0x3f, 0x32, 0x3f, 0x33, 0x39, 0x2f, 0x33, 0x30,
-    0x31, 0x41, 0x33, 0x15, 0x23, 0x22, 0x0e, 0x02, 0x15, 0x15, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x36,
-    0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x07, 0x27, 0x3e, 0x02, 0x33, 0x32, 0x16,
-    0x16, 0x15, 0x14, 0x06, 0x06, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x35, 0x34, 0x3e, 0x02, 0x02, 0xf4,
-    0x22, 0x10, 0x6b, 0xa3, 0x6f, 0x39, 0x1f, 0x38, 0x4d, 0x2d, 0x3d, 0x5a, 0x31, 0x2f, 0x59, 0x40,
-    0x40, 0x65, 0x3b, 0x02, 0x41, 0x03, 0x58, 0x9e, 0x6c, 0x7d, 0xa5, 0x53, 0x6a, 0xc2, 0x86, 0x68,
-    0xa8, 0x77, 0x40, 0x57, 0xa9, 0xf6, 0x04, 0x9b, 0xc4, 0x2f, 0x60, 0x92, 0x62, 0xab, 0x3e, 0x5e,
-    0x3f, 0x1f, 0x37, 0x5f, 0x3a, 0x3c, 0x5a, 0x33, 0x31, 0x4c, 0x2a, 0x47, 0x40, 0x83, 0x5b, 0x68,
-    0xb1, 0x6c, 0x72, 0xb5, 0x6a, 0x41, 0x79, 0xab, 0x6b, 0x50, 0x99, 0xf1, 0xa9, 0x58, 0x00, 0x01,
-    0x00, 0x66, 0xff, 0xf0, 0x03, 0xd0, 0x04, 0x8d, 0x00, 0x23, 0x00, 0x17, 0x40, 0x0a, 0x21, 0x09,
-    0x09, 0x02, 0x19, 0x11, 0x0b, 0x05, 0x02, 0x7d, 0x00, 0x3f, 0x33, 0x3f, 0x33, 0x12, 0x39, 0x2f,
-    0x33, 0x30, 0x31, 0x41, 0x27, 0x13, 0x21, 0x15, 0x21, 0x07, 0x36, 0x36, 0x33, 0x32, 0x16, 0x16,
-    0x15, 0x14, 0x06, 0x06, 0x23, 0x22, 0x26, 0x26, 0x27, 0x33, 0x16, 0x16, 0x33, 0x32, 0x36, 0x36,
-    0x35, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06, 0x01, 0x45, 0xc0, 0x4a, 0x02, 0xc6, 0xfe, 0x02, 0x23,
-    0x1b, 0x6f, 0x44, 0x7d, 0xb2, 0x5f, 0x5e, 0xc1, 0x95, 0x6f, 0xc4, 0x7d, 0x06, 0xee, 0x08, 0x6c,
-    0x54, 0x46, 0x56, 0x27, 0x32, 0x62, 0x46, 0x50, 0x51, 0x02, 0x0e, 0x2e, 0x02, 0x51, 0xc3, 0xfa,
-    0x0c, 0x20, 0x5b, 0xab, 0x79, 0x69, 0xb5, 0x6f, 0x4e, 0x96, 0x6c, 0x4b, 0x46, 0x37, 0x5f, 0x3c,
-    0x3c, 0x5d, 0x34, 0x29, 0x00, 0x02, 0x00, 0x33, 0x00, 0x00, 0x03, 0xed, 0x04, 0x8d, 0x00, 0x07,
-    0x00, 0x0b, 0x00, 0x15, 0x40, 0x09, 0x00, 0x01, 0x01, 0x0a, 0x04, 0x0b, 0x7d, 0x0a, 0x12, 0x00,
-    0x3f, 0x3f, 0x33, 0x12, 0x39, 0x2f, 0x33, 0x30, 0x31, 0x41, 0x15, 0x21, 0x27, 0x01, 0x33, 0x03,
-    0x01, 0x01, 0x11, 0x23, 0x11, 0x03, 0xed, 0xfc, 0x50, 0x0a, 0x02, 0x2a, 0xbd, 0xd0, 0xfe, 0xdb,
-    0x02, 0x2d, 0xf1, 0x01, 0xbb, 0xc0, 0x97, 0x02, 0xfb, 0xfe, 0xad, 0xfe, 0x81, 0x02, 0xd2, 0xfb,
-    0x73, 0x04, 0x8d, 0x00, 0x00, 0x02, 0x00, 0x3d, 0xff, 0xf0, 0x03, 0xc0, 0x04, 0x9d, 0x00, 0x1d,
-    0x00, 0x3d, 0x00, 0x1d, 0x40, 0x0d, 0x1f, 0x00, 0x00, 0x1d, 0x1e, 0x1e, 0x12, 0x34, 0x2a, 0x0b,
-    0x09, 0x12, 0x7e, 0x00, 0x3f, 0x33, 0x3f, 0x33, 0x12, 0x39, 0x2f, 0x33, 0x33, 0x11, 0x33, 0x30,
-    0x31, 0x41, 0x33, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x15, 0x23,
-    0x34, 0x36, 0x36, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x23, 0x15, 0x35, 0x33,
-    0x32, 0x1e, 0x02, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x33, 0x14, 0x16, 0x16,
-    0x33, 0x32, 0x36, 0x36, 0x35, 0x34, 0x2e, 0x02, 0x23, 0x01, 0x6b, 0x7e, 0x47, 0x5c, 0x2d, 0x27,
-    0x53, 0x43, 0x36, 0x55, 0x32, 0xf2, 0x73, 0xc1, 0x76, 0x61, 0xa0, 0x75, 0x3e, 0x36, 0x6a, 0x98,
-    0x60, 0xa8, 0xa8, 0x6d, 0xa2, 0x6a, 0x34, 0x44, 0x7d, 0xa6, 0x61, 0x54, 0x9d, 0x7f, 0x4b, 0xf2,
-    0x34, 0x5e, 0x40, 0x43, 0x5c, 0x2e, 0x20, 0x3b, 0x55, 0x35, 0x02, 0xa7, 0x29, 0x48, 0x2f, 0x2b,
-    0x44, 0x28, 0x20, 0x3c, 0x2a, 0x65, 0x91, 0x4f, 0x2a, 0x54, 0x7c, 0x51, 0x3b, 0x67, 0x50, 0x2d,
-    0x37, 0x73, 0x28, 0x4c, 0x6f, 0x46, 0x52, 0x7f, 0x58, 0x2d, 0x28, 0x55, 0x82, 0x5a, 0x2c, 0x46,
-    0x28, 0x29, 0x49, 0x31, 0x2d, 0x41, 0x29, 0x13, 0x00, 0x01, 0x00, 0x43, 0x00, 0x00, 0x03, 0xd6,
-    0x04, 0x9d, 0x00, 0x1e, 0x00, 0x12, 0xb7, 0x0b, 0x14, 0x7e, 0x03, 0x1e, 0x1e, 0x02, 0x12, 0x00,
-    0x3f, 0x33, 0x11, 0x33, 0x3f, 0x33, 0x30, 0x31, 0x65, 0x15, 0x21, 0x35, 0x01, 0x3e, 0x02, 0x35,
-    0x34, 0x26, 0x23, 0x22, 0x06, 0x06, 0x15, 0x23, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x16, 0x15,
-    0x14, 0x0e, 0x02, 0x07, 0x07, 0x03, 0xd6, 0xfc, 0x87, 0x01, 0xa9, 0x42, 0x4d, 0x22, 0x5c, 0x56,
-    0x47, 0x5d, 0x2c, 0xf2, 0x6a, 0xc7, 0x8b, 0x86, 0xbf, 0x64, 0x27, 0x4a, 0x6a, 0x43, 0xf8, 0xbf,
-    0xbf, 0xa3, 0x01, 0x8e, 0x3d, 0x61, 0x4f, 0x20, 0x46, 0x5a, 0x33, 0x58, 0x38, 0x6a, 0xb0, 0x68,
-    0x54, 0x9d, 0x6b, 0x3b, 0x6a, 0x64, 0x68, 0x3b, 0xd6, 0x00, 0x00, 0x01, 0x00, 0x98, 0x00, 0x00,
-    0x02, 0xc5, 0x04, 0x8d, 0x00, 0x06, 0x00, 0x0a, 0xb3, 0x06, 0x7d, 0x02, 0x0a, 0x00, 0x3f, 0x3f,
-    0x30, 0x31, 0x41, 0x11, 0x23, 0x11, 0x05, 0x35, 0x25, 0x02, 0xc5, 0xf1, 0xfe, 0xc4, 0x02, 0x12,
-    0x04, 0x8d, 0xfb, 0x73, 0x03, 0x75, 0x53, 0xbe, 0xad, 0x00, 0x00, 0x02, 0x00, 0x58, 0xff, 0xf0,
-    0x03, 0xc4, 0x04, 0x9d, 0x00, 0x15, 0x00, 0x2b, 0x00, 0x0e, 0xb5, 0x1c, 0x11, 0x7e, 0x27, 0x06,
-    0x0b, 0x00, 0x3f, 0x33, 0x3f, 0x33, 0x30, 0x31, 0x41, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e,
-    0x02, 0x35, 0x35, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x1e, 0x02, 0x03, 0x35, 0x34, 0x2e, 0x02, 0x23,
-    0x22, 0x0e, 0x02, 0x15, 0x15, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x3e, 0x02, 0x03, 0xc4, 0x3f, 0x73,
-    0xa1, 0x62, 0x62, 0xa1, 0x74, 0x40, 0x3f, 0x74, 0xa0, 0x62, 0x62, 0xa2, 0x74, 0x3f, 0xf2, 0x1a,
-    0x32, 0x49, 0x30, 0x2e, 0x49, 0x32, 0x1a, 0x1a, 0x33, 0x4a, 0x2e, 0x2f, 0x49, 0x32, 0x19, 0x02,
-    0xad, 0xcd, 0x7f, 0xbb, 0x7a, 0x3c, 0x3c, 0x7a, 0xbb, 0x7f, 0xcd, 0x7f, 0xba, 0x7b, 0x3c, 0x3c,
-    0x7b, 0xba, 0xfe, 0xa1, 0xf5, 0x49, 0x6b, 0x46, 0x21, 0x21, 0x46, 0x6b, 0x49, 0xf5, 0x4a, 0x6c,
-    0x46, 0x22, 0x22, 0x46, 0x6c, 0x00, 0x00, 0x03, 0x00, 0x41, 0x00, 0x00, 0x03, 0xf5, 0x04, 0x8d,
-    0x00, 0x03, 0x00, 0x09, 0x00, 0x0d, 0x00, 0x1c, 0x40, 0x0c, 0x04, 0x0c, 0x0c, 0x0d, 0x0d, 0x08,
-    0x7d, 0x07, 0x03, 0x03, 0x06, 0x02, 0x00, 0x2f, 0x33, 0x33, 0x11, 0x33, 0x3f, 0x33, 0x2f, 0x33,
-    0x11, 0x33, 0x30, 0x31, 0x65, 0x15, 0x21, 0x35, 0x01, 0x01, 0x23, 0x35, 0x01, 0x33, 0x23, 0x15,
-    0x21, 0x35, 0x03, 0xf5, 0xfc, 0x8d, 0x03, 0x63, 0xfd, 0x04, 0xa8, 0x03, 0x02, 0xa2, 0x54, 0xfc,
-    0xb2, 0xbf, 0xbf, 0xbf, 0x03, 0x48, 0xfb, 0xf9, 0x8a, 0x04, 0x03, 0xc0, 0xc0, 0x00, 0x00, 0x03,
-    0x00, 0x06, 0x00, 0x00, 0x04, 0x38, 0x04, 0x8d, 0x00, 0x04, 0x00, 0x09, 0x00, 0x0d, 0x00, 0x1b,
-    0x40, 0x10, 0x08, 0x07, 0x03, 0x04, 0x06, 0x00, 0x0a, 0x0d, 0x08, 0x01, 0x0c, 0x0a, 0x72, 0x05,
-    0x01, 0x7d, 0x00, 0x3f, 0x33, 0x2b, 0x11, 0x17, 0x39, 0x30, 0x31, 0x41, 0x01, 0x21, 0x01, 0x23,
-    0x03, 0x01, 0x07, 0x23, 0x01, 0x01, 0x11, 0x23, 0x11, 0x01, 0xe4, 0x01, 0x4c, 0x01, 0x08, 0xfe,
-    0x51, 0x88, 0xf3, 0x01, 0x4e, 0x21, 0x86, 0xfe, 0x51, 0x02, 0x8e, 0xf1, 0x02, 0x01, 0x02, 0x8c,
-    0xfc, 0xf7, 0x03, 0x09, 0xfd, 0x6e, 0x77, 0x03, 0x09, 0xfd, 0x95, 0xfd, 0xde, 0x02, 0x22, 0x00,
-    0x00, 0x01, 0x00, 0x13, 0x00, 0x00, 0x04, 0x49, 0x04, 0x8d, 0x00, 0x0b, 0x00, 0x15, 0x40, 0x0a,
-    0x07, 0x0a, 0x04, 0x01, 0x04, 0x09, 0x05, 0x03, 0x00, 0x7d, 0x00, 0x3f, 0x32, 0x2f, 0x33, 0x17,
-    0x39, 0x30, 0x31, 0x41, 0x13, 0x13, 0x21, 0x01, 0x01, 0x21, 0x01, 0x03, 0x21, 0x01, 0x01, 0x01,
-    0x34, 0xf1, 0xf4, 0x01, 0x1a, 0xfe, 0x89, 0x01, 0x8d, 0xfe, 0xe1, 0xfe, 0xff, 0xfc, 0xfe, 0xe6,
-    0x01, 0x82, 0xfe, 0x88, 0x04, 0x8d, 0xfe, 0x6a, 0x01, 0x96, 0xfd, 0xbe, 0xfd, 0xb5, 0x01, 0x9e,
-    0xfe, 0x62, 0x02, 0x4b, 0x02, 0x42, 0x00, 0x04, 0x00, 0x27, 0x00, 0x00, 0x05, 0xe5, 0x04, 0x8d,
-    0x00, 0x05, 0x00, 0x0a, 0x00, 0x0f, 0x00, 0x15, 0x00, 0x20, 0x40, 0x0e, 0x12, 0x04, 0x10, 0x01,
-    0x0e, 0x04, 0x0c, 0x01, 0x08, 0x04, 0x06, 0x01, 0x7d, 0x04, 0x00, 0x2f, 0x3f, 0x33, 0x11, 0x33,
-    0x11, 0x33, 0x11, 0x33, 0x11, 0x33, 0x11, 0x33, 0x30, 0x31, 0x65, 0x13, 0x33, 0x17, 0x03, 0x23,
-    0x03, 0x13, 0x17, 0x23, 0x01, 0x01, 0x13, 0x33, 0x01, 0x23, 0x03, 0x13, 0x17, 0x23, 0x03, 0x37,
-    0x01, 0xab, 0xf2, 0x8b, 0x04, 0xfe, 0x90, 0x8c, 0xc5, 0x03, 0x98, 0xfe, 0xe5, 0x04, 0x10, 0xc4,
-    0xea, 0xfe, 0xe6, 0x97, 0xc2, 0xf2, 0x0b, 0x8f, 0xfe, 0x05, 0xc8, 0x03, 0xc5, 0xc4, 0xfc, 0x37,
-    0x04, 0x8d, 0xfc, 0x46, 0xd3, 0x04, 0x8d, 0xfc, 0x47, 0x03, 0xb9, 0xfb, 0x73, 0x04, 0x8d, 0xfc,
-    0x39, 0xc6, 0x03, 0xc9, 0xc4, 0x00, 0x00, 0x02, 0x00, 0x08, 0x00, 0x00, 0x04, 0x71, 0x04, 0x8d,
-    0x00, 0x04, 0x00, 0x09, 0x00, 0x0f, 0xb5, 0x07, 0x03, 0x05, 0x01, 0x7d, 0x03, 0x00, 0x2f, 0x3f,
-    0x33, 0x11, 0x33, 0x30, 0x31, 0x41, 0x01, 0x33, 0x01, 0x23, 0x03, 0x01, 0x13, 0x23, 0x01, 0x02,
-    0x4d, 0x01, 0x25, 0xff, 0xfe, 0x48, 0xb3, 0xfe, 0x01, 0x22, 0x49, 0xb4, 0xfe, 0x49, 0x01, 0x2e,
-    0x03, 0x5f, 0xfb, 0x73, 0x04, 0x8d, 0xfc, 0xa3, 0xfe, 0xd0, 0x04, 0x8d, 0x00, 0x01, 0x00, 0x69,
-    0xff, 0xf0, 0x04, 0x20, 0x04, 0x8d, 0x00, 0x15, 0x00, 0x0f, 0xb5, 0x0c, 0x11, 0x06, 0x00, 0x7d,
-    0x06, 0x00, 0x2f, 0x3f, 0x11, 0x33, 0x32, 0x30, 0x31, 0x41, 0x33, 0x11, 0x14, 0x06, 0x06, 0x23,
-    0x22, 0x26, 0x26, 0x35, 0x11, 0x33, 0x11, 0x14, 0x16, 0x16, 0x33, 0x32, 0x36, 0x36, 0x35, 0x03,
-    0x2e, 0xf2, 0x7c, 0xd6, 0x89, 0x8b, 0xd7, 0x7a, 0xf0, 0x39, 0x6a, 0x49, 0x49, 0x68, 0x38, 0x04,
-    0x8d, 0xfd, 0x00, 0x86, 0xb9, 0x5e, 0x5e, 0xb9, 0x86, 0x03, 0x00, 0xfd, 0x00, 0x4d, 0x63, 0x2e,
-    0x2e, 0x63, 0x4d, 0x00, 0x00, 0x02, 0x00, 0x25, 0x00, 0x00, 0x04, 0x19, 0x04, 0x8d, 0x00, 0x03,
-    0x00, 0x07, 0x00, 0x11, 0xb6, 0x06, 0x07, 0x07, 0x01, 0x00, 0x7d, 0x01, 0x00, 0x2f, 0x3f, 0x11,
-    0x39, 0x2f, 0x33, 0x30, 0x31, 0x41, 0x11, 0x23, 0x11, 0x21, 0x15, 0x21, 0x35, 0x02, 0x95, 0xf1,
-    0x02, 0x75, 0xfc, 0x0c, 0x04, 0x8d, 0xfb, 0x73, 0x04, 0x8d, 0xc0, 0xc0, 0x00, 0x01, 0x00, 0x3f,
-    0xff, 0xf0, 0x03, 0xf0, 0x04, 0x9d, 0x00, 0x39, 0x00, 0x18, 0x40, 0x0a, 0x0a, 0x26, 0x0f, 0x36,
-    0x31, 0x2b, 0x18, 0x14, 0x0f, 0x7e, 0x00, 0x3f, 0xcc, 0x33, 0x2f, 0xcc, 0x33, 0x12, 0x39, 0x39,
-    0x30, 0x31, 0x41, 0x34, 0x2e, 0x02, 0x27, 0x2e, 0x03, 0x35, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x16,
-    0x16, 0x15, 0x23, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x15, 0x14, 0x1e, 0x02, 0x17, 0x1e,
-    0x03, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x33, 0x14, 0x1e, 0x02, 0x33, 0x32,
-    0x36, 0x36, 0x03, 0x06, 0x17, 0x37, 0x5f, 0x48, 0x68, 0x9f, 0x6c, 0x37, 0x40, 0x76, 0xa2, 0x61,
-    0x8d, 0xd0, 0x73, 0xf1, 0x33, 0x62, 0x4a, 0x47, 0x5c, 0x2d, 0x1b, 0x3c, 0x60, 0x45, 0x67, 0x9e,
-    0x6a, 0x35, 0x40, 0x77, 0xa6, 0x66, 0x5a, 0xb1, 0x8e, 0x55, 0xf2, 0x25, 0x45, 0x60, 0x3a, 0x49,
-    0x5d, 0x2b, 0x01, 0x31, 0x21, 0x34, 0x2b, 0x26, 0x11, 0x19, 0x3f, 0x54, 0x72, 0x4c, 0x49, 0x79,
-    0x59, 0x30, 0x5c, 0xa1, 0x6a, 0x32, 0x50, 0x30, 0x29, 0x41, 0x26, 0x1e, 0x30, 0x28, 0x24, 0x11,
-    0x18, 0x42, 0x59, 0x77, 0x4c, 0x4d, 0x79, 0x54, 0x2d, 0x2c, 0x5c, 0x8f, 0x61, 0x34, 0x4b, 0x2f,
-    0x16, 0x27, 0x40, 0x00, 0x00, 0x02, 0x00, 0x75, 0x00, 0x00, 0x04, 0x3b, 0x04, 0x8d, 0x00, 0x19,
-    0x00, 0x1e, 0x00, 0x18, 0x40, 0x0a, 0x1b, 0x0d, 0x0d, 0x0c, 0x0c, 0x1a, 0x18, 0x17, 0x00, 0x7d,
-    0x00, 0x3f, 0x32, 0x2f, 0x33, 0x39, 0x2f, 0x33, 0x12, 0x39, 0x30, 0x31, 0x53, 0x21, 0x32, 0x1e,
-    0x02, 0x15, 0x14, 0x06, 0x06, 0x07, 0x07, 0x21, 0x27, 0x21, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26,
-    0x26, 0x23, 0x23, 0x11, 0x23, 0x21, 0x01, 0x37, 0x01, 0x15, 0x75, 0x01, 0xcb, 0x6b, 0xaa, 0x77,
-    0x3f, 0x44, 0x7c, 0x54, 0x4d, 0xfe, 0x6b, 0x02, 0x01, 0x30, 0x48, 0x5e, 0x30, 0x2f, 0x61, 0x49,
-    0xd9, 0xf2, 0x02, 0xc2, 0xfe, 0xe0, 0xff, 0x01, 0x25, 0x04, 0x8d, 0x2e, 0x59, 0x83, 0x56, 0x5f,
-    0x87, 0x58, 0x1b, 0x2a, 0xc0, 0x2c, 0x4f, 0x34, 0x37, 0x51, 0x2c, 0xfc, 0x33, 0x02, 0x04, 0x02,
-    0xfe, 0x05, 0x0b, 0x00, 0x00, 0x03, 0x00, 0x4d, 0xff, 0x2f, 0x04, 0x6c, 0x04, 0x9d, 0x00, 0x03,
-    0x00, 0x19, 0x00, 0x2f, 0x00, 0x1c, 0x40, 0x0c, 0x00, 0x03, 0x03, 0x2b, 0x2b, 0x0a, 0x0a, 0x02,
-    0x20, 0x15, 0x7e, 0x02, 0x00, 0x2f, 0x3f, 0x33, 0x12, 0x39, 0x2f, 0x33, 0x12, 0x39, 0x11, 0x33,
-    0x30, 0x31, 0x65, 0x05, 0x07, 0x25, 0x01, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x35,
-    0x35, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x1e, 0x02, 0x07, 0x35, 0x34, 0x2e, 0x02, 0x23, 0x22, 0x0e,
-    0x02, 0x15, 0x15, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x3e, 0x02, 0x03, 0x17, 0x01, 0x4f, 0x9b, 0xfe,
-    0xb8, 0x01, 0xe9, 0x4b, 0x8c, 0xc1, 0x77, 0x74, 0xc2, 0x8e, 0x4c, 0x4c, 0x8c, 0xc2, 0x75, 0x76,
-    0xc1, 0x8d, 0x4c, 0xf0, 0x27, 0x4a, 0x6b, 0x44, 0x44, 0x6a, 0x4a, 0x27, 0x27, 0x4b, 0x6b, 0x43,
-    0x44, 0x6b, 0x4a, 0x26, 0xaf, 0xfc, 0x84, 0xfb, 0x02, 0x38, 0x38, 0x85, 0xd2, 0x95, 0x4e, 0x4e,
-    0x95, 0xd2, 0x85, 0x38, 0x85, 0xd2, 0x96, 0x4e, 0x4e, 0x96, 0xd2, 0xbd, 0x3a, 0x5b, 0x8c, 0x60,
-    0x32, 0x32, 0x60, 0x8c, 0x5b, 0x3a, 0x5a, 0x8d, 0x61, 0x33, 0x33, 0x61, 0x8d, 0x00, 0x00, 0x01,
-    0x00, 0x76, 0x00, 0x00, 0x04, 0x28, 0x04, 0x8d, 0x00, 0x18, 0x00, 0x13, 0xb7, 0x02, 0x01, 0x01,
-    0x0d, 0x0c, 0x0f, 0x7d, 0x0d, 0x00, 0x2f, 0x3f, 0x33, 0x12, 0x39, 0x2f, 0x33, 0x30, 0x31, 0x41,
-    0x21, 0x35, 0x21, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x23, 0x11, 0x23, 0x11, 0x21,
-    0x32, 0x16, 0x16, 0x15, 0x14, 0x0e, 0x02, 0x02, 0x58, 0xfe, 0xbe, 0x01, 0x42, 0x4e, 0x63, 0x2f,
-    0x2f, 0x63, 0x4e, 0xf1, 0xf1, 0x01, 0xe2, 0x93, 0xd0, 0x6d, 0x3e, 0x78, 0xac, 0x01, 0x9b, 0xc0,
-    0x2e, 0x4f, 0x32, 0x34, 0x58, 0x37, 0xfc, 0x33, 0x04, 0x8d, 0x64, 0xad, 0x70, 0x54, 0x88, 0x61,
-    0x34, 0x00, 0x00, 0x02, 0x00, 0x4e, 0xff, 0xf0, 0x04, 0x6e, 0x04, 0x9d, 0x00, 0x15, 0x00, 0x2b,
-    0x00, 0x10, 0xb6, 0x27, 0x06, 0x1c, 0x11, 0x7e, 0x06, 0x0b, 0x00, 0x3f, 0x3f, 0x33, 0x11, 0x33,
-    0x30, 0x31, 0x41, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x35, 0x34, 0x3e, 0x02,
-    0x33, 0x32, 0x1e, 0x02, 0x07, 0x35, 0x34, 0x2e, 0x02, 0x23, 0x22, 0x0e, 0x02, 0x15, 0x15, 0x14,
-    0x1e, 0x02, 0x33, 0x32, 0x3e, 0x02, 0x04, 0x6e, 0x4c, 0x8b, 0xc2, 0x75, 0x75, 0xc2, 0x8e, 0x4d,
-    0x4d, 0x8c, 0xc2, 0x75, 0x76, 0xc1, 0x8d, 0x4c, 0xf1, 0x26, 0x4b, 0x6a, 0x44, 0x43, 0x6b, 0x49,
-    0x27, 0x27, 0x4b, 0x6b, 0x43, 0x44, 0x69, 0x4a, 0x26, 0x02, 0x62, 0x38, 0x85, 0xd2, 0x95, 0x4e,
-    0x4e, 0x95, 0xd2, 0x85, 0x38, 0x85, 0xd2, 0x96, 0x4e, 0x4e, 0x96, 0xd2, 0xbd, 0x3a, 0x5b, 0x8c,
-    0x60, 0x32, 0x32, 0x60, 0x8c, 0x5b, 0x3a, 0x5a, 0x8d, 0x61, 0x33, 0x33, 0x61, 0x8d, 0x00, 0x01,
-    0x00, 0x76, 0x00, 0x00, 0x04, 0x67, 0x04, 0x8d, 0x00, 0x09, 0x00, 0x11, 0xb6, 0x03, 0x08, 0x05,
-    0x01, 0x07, 0x00, 0x7d, 0x00, 0x3f, 0x32, 0x2f, 0x33, 0x39, 0x39, 0x30, 0x31, 0x41, 0x11, 0x23,
-    0x01, 0x11, 0x23, 0x11, 0x33, 0x01, 0x11, 0x04, 0x67, 0xf2, 0xfd, 0xf2, 0xf1, 0xf1, 0x02, 0x0e,
-    0x04, 0x8d, 0xfb, 0x73, 0x03, 0x23, 0xfc, 0xdd, 0x04, 0x8d, 0xfc, 0xdd, 0x03, 0x23, 0x00, 0x03,
-    0x00, 0x76, 0x00, 0x00, 0x05, 0x8f, 0x04, 0x8d, 0x00, 0x06, 0x00, 0x0b, 0x00, 0x10, 0x00, 0x16,
-    0x40, 0x09, 0x02, 0x0e, 0x0a, 0x05, 0x0c, 0x07, 0x04, 0x00, 0x7d, 0x00, 0x3f, 0x32, 0x32, 0x32,
-    0x2f, 0x33, 0x33, 0x39, 0x30, 0x31, 0x53, 0x33, 0x01, 0x01, 0x33, 0x01, 0x23, 0x01, 0x33, 0x13,
-    0x11, 0x23, 0x01, 0x33, 0x11, 0x23, 0x11, 0xe1, 0xd0, 0x01, 0x51, 0x01, 0x50, 0xd0, 0xfe, 0x32,
-    0xa5, 0xfd, 0xc7, 0xcc, 0x25, 0xf1, 0x04, 0x4c, 0xcd, 0xf1, 0x04, 0x8d, 0xfc, 0xaf, 0x03, 0x51,
-    0xfb, 0x73, 0x04, 0x8d, 0xfc, 0xb3, 0xfe, 0xc0, 0x04, 0x8d, 0xfb, 0x73, 0x01, 0x40, 0x00, 0x02,
-    0x00, 0x76, 0x00, 0x00, 0x03, 0x92, 0x04, 0x8d, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0f, 0xb5, 0x06,
-    0x03, 0x02, 0x04, 0x7d, 0x02, 0x00, 0x2f, 0x3f, 0x11, 0x33, 0x33, 0x30, 0x31, 0x65, 0x15, 0x21,
-    0x35, 0x13, 0x11, 0x23, 0x11, 0x03, 0x92, 0xfd, 0x89, 0x4c, 0xf1, 0xbf, 0xbf, 0xbf, 0x03, 0xce,
-    0xfb, 0x73, 0x04, 0x8d, 0x00, 0x03, 0x00, 0x76, 0x00, 0x00, 0x04, 0x67, 0x04, 0x8d, 0x00, 0x03,
-    0x00, 0x09, 0x00, 0x0d, 0x00, 0x17, 0x40, 0x0c, 0x06, 0x07, 0x0b, 0x05, 0x0c, 0x08, 0x06, 0x0a,
-    0x01, 0x04, 0x00, 0x7d, 0x00, 0x3f, 0x32, 0x2f, 0x33, 0x17, 0x39, 0x30, 0x31, 0x41, 0x11, 0x23,
-    0x11, 0x21, 0x01, 0x01, 0x27, 0x37, 0x01, 0x13, 0x01, 0x37, 0x01, 0x01, 0x67, 0xf1, 0x03, 0xdc,
-    0xfe, 0x10, 0xfe, 0xe8, 0x38, 0xc6, 0x01, 0x4e, 0x21, 0xfe, 0x7f, 0xb0, 0x01, 0xf1, 0x04, 0x8d,
-    0xfb, 0x73, 0x04, 0x8d, 0xfd, 0xbe, 0xfe, 0xef, 0xe2, 0xf2, 0x01, 0x7f, 0xfb, 0x73, 0x02, 0x19,
-    0x95, 0xfd, 0x52, 0x00, 0x00, 0x01, 0x00, 0x26, 0xff, 0xf0, 0x03, 0x65, 0x04, 0x8d, 0x00, 0x13,
-    0x00, 0x0d, 0xb4, 0x10, 0x0c, 0x07, 0x01, 0x7d, 0x00, 0x3f, 0x2f, 0xcc, 0x33, 0x30, 0x31, 0x41,
-    0x11, 0x33, 0x11, 0x14, 0x06, 0x06, 0x23, 0x22, 0x26, 0x26, 0x35, 0x33, 0x14, 0x16, 0x16, 0x33,
-    0x32, 0x36, 0x36, 0x02, 0x73, 0xf2, 0x6c, 0xb7, 0x72, 0x7d, 0xc0, 0x6d, 0xf2, 0x2c, 0x53, 0x39,
-    0x33, 0x49, 0x27, 0x01, 0x6f, 0x03, 0x1e, 0xfc, 0xe2, 0x79, 0xab, 0x5b, 0x4f, 0xa3, 0x7e, 0x3e,
-    0x4f, 0x24, 0x2c, 0x55, 0x00, 0x01, 0x00, 0x86, 0x00, 0x00, 0x01, 0x78, 0x04, 0x8d, 0x00, 0x03,
-    0x00, 0x09, 0xb2, 0x00, 0x7d, 0x01, 0x00, 0x2f, 0x3f, 0x30, 0x31, 0x41, 0x11, 0x23, 0x11, 0x01,
-    0x78, 0xf2, 0x04, 0x8d, 0xfb, 0x73, 0x04, 0x8d, 0x00, 0x03, 0x00, 0x76, 0x00, 0x00, 0x04, 0x67,
-    0x04, 0x8d, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x18, 0x40, 0x0a, 0x02, 0x03, 0x03, 0x04,
-    0x09, 0x05, 0x08, 0x04, 0x7d, 0x05, 0x00, 0x2f, 0x3f, 0x33, 0x11, 0x33, 0x12, 0x39, 0x2f, 0x33,
-    0x30, 0x31, 0x41, 0x15, 0x21, 0x35, 0x13, 0x11, 0x23, 0x11, 0x21, 0x11, 0x23, 0x11, 0x03, 0xb7,
-    0xfd, 0x6c, 0x44, 0xf1, 0x03, 0xf1, 0xf1, 0x02, 0x9d, 0xc0, 0xc0, 0x01, 0xf0, 0xfb, 0x73, 0x04,
-    0x8d, 0xfb, 0x73, 0x04, 0x8d, 0x00, 0x00, 0x01, 0x00, 0x56, 0xff, 0xf0, 0x04, 0x4b, 0x04, 0x9d,
-    0x00, 0x2a, 0x00, 0x16, 0x40, 0x09, 0x29, 0x2a, 0x2a, 0x05, 0x19, 0x10, 0x7e, 0x24, 0x05, 0x00,
-    0x2f, 0x33, 0x3f, 0x33, 0x12, 0x39, 0x2f, 0x33, 0x30, 0x31, 0x41, 0x11, 0x0e, 0x02, 0x23, 0x22,
-    0x2e, 0x02, 0x35, 0x35, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x16, 0x16, 0x17, 0x23, 0x2e, 0x02, 0x23,
-    0x22, 0x0e, 0x02, 0x15, 0x15, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x36, 0x37, 0x35, 0x23, 0x35, 0x04,
-    0x4b, 0x1d, 0x76, 0xbe, 0x8a, 0x78, 0xc5, 0x90, 0x4d, 0x4a, 0x89, 0xc0, 0x76, 0xa0, 0xcf, 0x6e,
-    0x0e, 0xeb, 0x0a, 0x38, 0x67, 0x51, 0x44, 0x6b, 0x49, 0x25, 0x29, 0x4f, 0x73, 0x4a, 0x63, 0x64,
-    0x15, 0xfc, 0x02, 0x62, 0xfe, 0x30, 0x21, 0x4c, 0x35, 0x4b, 0x90, 0xd1, 0x86, 0x49, 0x86, 0xd1,
-    0x90, 0x4b, 0x63, 0xae, 0x71, 0x3c, 0x57, 0x30, 0x2f, 0x5e, 0x89, 0x5b, 0x4b, 0x5b, 0x8b, 0x5e,
-    0x2f, 0x29, 0x12, 0xcb, 0xad, 0x00, 0x00, 0x03, 0x00, 0x76, 0x00, 0x00, 0x03, 0xa1, 0x04, 0x8d,
-    0x00, 0x03, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x1a, 0x40, 0x0b, 0x07, 0x06, 0x06, 0x01, 0x0a, 0x0b,
-    0x0b, 0x01, 0x00, 0x7d, 0x01, 0x00, 0x2f, 0x3f, 0x11, 0x39, 0x2f, 0x33, 0x11, 0x39, 0x2f, 0x33,
-    0x30, 0x31, 0x41, 0x11, 0x23, 0x11, 0x01, 0x15, 0x21, 0x35, 0x01, 0x15, 0x21, 0x35, 0x01, 0x67,
-    0xf1, 0x02, 0xea, 0xfd, 0xc6, 0x02, 0x7b, 0xfd, 0x85, 0x04, 0x8d, 0xfb, 0x73, 0x04, 0x8d, 0xfe,
-    0x11, 0xc0, 0xc0, 0x01, 0xef, 0xc0, 0xc0, 0x00, 0x00, 0x03, 0x00, 0x3f, 0xff, 0x13, 0x03, 0xf0,
-    0x05, 0x73, 0x00, 0x03, 0x00, 0x07, 0x00, 0x41, 0x00, 0x29, 0x40, 0x13, 0x07, 0x3e, 0x3e, 0x24,
-    0x08, 0x17, 0x33, 0x06, 0x06, 0x33, 0x0b, 0x02, 0x20, 0x20, 0x17, 0x00, 0x00, 0x17, 0x7e, 0x00,
-    0x3f, 0x33, 0x2f, 0x11, 0x33, 0x11, 0x33, 0x3f, 0x33, 0x2f, 0x11, 0x12, 0x39, 0x39, 0x33, 0x11,
-    0x33, 0x30, 0x31, 0x41, 0x11, 0x23, 0x11, 0x13, 0x11, 0x23, 0x11, 0x25, 0x34, 0x2e, 0x02, 0x27,
-    0x2e, 0x03, 0x35, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x16, 0x16, 0x15, 0x23, 0x34, 0x26, 0x26, 0x23,
-    0x22, 0x06, 0x06, 0x15, 0x14, 0x1e, 0x02, 0x17, 0x1e, 0x03, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x22,
-    0x2e, 0x02, 0x35, 0x33, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x36, 0x36, 0x02, 0x7b, 0x99, 0x99, 0x99,
-    0x01, 0x24, 0x17, 0x37, 0x5f, 0x48, 0x68, 0x9f, 0x6c, 0x37, 0x40, 0x76, 0xa2, 0x61, 0x8d, 0xd0,
-    0x73, 0xf1, 0x33, 0x62, 0x4a, 0x47, 0x5c, 0x2d, 0x1b, 0x3c, 0x60, 0x45, 0x67, 0x9e, 0x6a, 0x35,
-    0x40, 0x77, 0xa6, 0x66, 0x5a, 0xb1, 0x8e, 0x55, 0xf2, 0x25, 0x45, 0x60, 0x3a, 0x49, 0x5d, 0x2b,
-    0x05, 0x73, 0xfe, 0xcc, 0x01, 0x34, 0xfa, 0xd4, 0xfe, 0xcc, 0x01, 0x34, 0xea, 0x21, 0x34, 0x2b,
-    0x26, 0x11, 0x19, 0x3f, 0x54, 0x72, 0x4c, 0x49, 0x79, 0x59, 0x30, 0x5c, 0xa1, 0x6a, 0x32, 0x50,
-    0x30, 0x29, 0x41, 0x26, 0x1e, 0x30, 0x28, 0x24, 0x11, 0x18, 0x42, 0x59, 0x77, 0x4c, 0x4d, 0x79,
-    0x54, 0x2d, 0x2c, 0x5c, 0x8f, 0x61, 0x34, 0x4b, 0x2f, 0x16, 0x27, 0x40, 0x00, 0x03, 0x00, 0x3a,
-    0x00, 0x00, 0x04, 0x1b, 0x04, 0x9d, 0x00, 0x03, 0x00, 0x07, 0x00, 0x26, 0x00, 0x1d, 0x40, 0x0d,
-    0x04, 0x05, 0x05, 0x01, 0x22, 0x19, 0x7e, 0x0e, 0x02, 0x02, 0x0d, 0x01, 0x0a, 0x00, 0x3f, 0x33,
-    0x33, 0x11, 0x33, 0x3f, 0x33, 0x12, 0x39, 0x2f, 0x33, 0x30, 0x31, 0x61, 0x21, 0x35, 0x21, 0x03,
-    0x15, 0x21, 0x35, 0x25, 0x17, 0x16, 0x06, 0x06, 0x07, 0x27, 0x3e, 0x03, 0x27, 0x03, 0x26, 0x3e,
-    0x02, 0x33, 0x32, 0x16, 0x16, 0x15, 0x23, 0x34, 0x26, 0x26, 0x23, 0x22, 0x0e, 0x02, 0x04, 0x1b,
-    0xfc, 0x62, 0x03, 0x9e, 0xd2, 0xfc, 0xf1, 0x01, 0x8c, 0x0a, 0x04, 0x26, 0x55, 0x42, 0x90, 0x1c,
-    0x23, 0x13, 0x06, 0x01, 0x09, 0x03, 0x35, 0x6a, 0x97, 0x5d, 0x8a, 0xb6, 0x5a, 0xf1, 0x2c, 0x4c,
-    0x2f, 0x28, 0x3e, 0x29, 0x14, 0xc0, 0x01, 0xb9, 0x90, 0x90, 0x68, 0xfa, 0x53, 0x93, 0x73, 0x24,
-    0x56, 0x07, 0x3c, 0x55, 0x5e, 0x2a, 0x01, 0x01, 0x6a, 0xa4, 0x72, 0x3c, 0x64, 0xb5, 0x78, 0x4d,
-    0x5b, 0x29, 0x21, 0x40, 0x5d, 0x00, 0x00, 0x05, 0x00, 0x0a, 0x00, 0x00, 0x03, 0x9a, 0x04, 0x8d,
-    0x00, 0x03, 0x00, 0x07, 0x00, 0x0c, 0x00, 0x11, 0x00, 0x15, 0x00, 0x1b, 0x40, 0x0b, 0x06, 0x07,
-    0x03, 0x02, 0x02, 0x11, 0x14, 0x0a, 0x09, 0x11, 0x7d, 0x00, 0x3f, 0x33, 0x3f, 0x12, 0x39, 0x7c,
-    0x2f, 0x33, 0x18, 0xce, 0x32, 0x30, 0x31, 0x41, 0x15, 0x21, 0x35, 0x05, 0x15, 0x21, 0x35, 0x25,
-    0x13, 0x33, 0x01, 0x23, 0x03, 0x01, 0x07, 0x23, 0x01, 0x01, 0x11, 0x23, 0x11, 0x03, 0x56, 0xfc,
-    0xf1, 0x03, 0x0f, 0xfc, 0xf1, 0x01, 0x57, 0xff, 0xfd, 0xfe, 0xa3, 0x89, 0xab, 0x01, 0x01, 0x1b,
-    0x87, 0xfe, 0xa2, 0x02, 0x3d, 0xf0, 0x02, 0x44, 0x91, 0x91, 0xd8, 0x8f, 0x8f, 0x95, 0x02, 0x8c,
-    0xfc, 0xf7, 0x03, 0x09, 0xfd, 0x6e, 0x77, 0x03, 0x09, 0xfd, 0x95, 0xfd, 0xde, 0x02, 0x22, 0x00,
-    0x00, 0x02, 0x00, 0x76, 0x00, 0x00, 0x03, 0x99, 0x04, 0x8d, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0e,
-    0xb5, 0x07, 0x06, 0x03, 0x7d, 0x02, 0x0a, 0x00, 0x3f, 0x3f, 0x33, 0x33, 0x30, 0x31, 0x41, 0x11,
-    0x23, 0x11, 0x21, 0x15, 0x21, 0x35, 0x01, 0x67, 0xf1, 0x03, 0x23, 0xfd, 0x8a, 0x04, 0x8d, 0xfb,
-    0x73, 0x04, 0x8d, 0xc0, 0xc0, 0x00, 0x00, 0x03, 0x00, 0x08, 0x00, 0x00, 0x04, 0x71, 0x04, 0x8d,
-    0x00, 0x03, 0x00, 0x08, 0x00, 0x0d, 0x00, 0x1b, 0x40, 0x0c, 0x08, 0x0c, 0x7d, 0x00, 0x05, 0x05,
-    0x09, 0x02, 0x03, 0x03, 0x09, 0x0a, 0x00, 0x3f, 0x33, 0x11, 0x33, 0x11, 0x33, 0x11, 0x33, 0x3f,
-    0x33, 0x30, 0x31, 0x61, 0x35, 0x21, 0x15, 0x01, 0x01, 0x33, 0x01, 0x23, 0x03, 0x01, 0x13, 0x23,
-    0x01, 0x03, 0xb0, 0xfd, 0x1b, 0x01, 0x82, 0x01, 0x25, 0xff, 0xfe, 0x48, 0xb3, 0xfe, 0x01, 0x22,
-    0x49, 0xb4, 0xfe, 0x49, 0xc0, 0xc0, 0x03, 0x5f, 0xfc, 0xa1, 0x04, 0x8d, 0xfb, 0x73, 0x03, 0x5d,
-    0x01, 0x30, 0xfb, 0x73, 0x00, 0x03, 0x00, 0x4e, 0xff, 0xf0, 0x04, 0x6e, 0x04, 0x9d, 0x00, 0x03,
-    0x00, 0x19, 0x00, 0x2f, 0x00, 0x17, 0x40, 0x0a, 0x03, 0x02, 0x02, 0x0a, 0x20, 0x15, 0x7e, 0x2b,
-    0x0a, 0x0b, 0x00, 0x3f, 0x33, 0x3f, 0x33, 0x12, 0x39, 0x2f, 0x33, 0x30, 0x31, 0x41, 0x15, 0x21,
-    0x35, 0x05, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x35, 0x34, 0x3e, 0x02, 0x33,
-    0x32, 0x1e, 0x02, 0x07, 0x35, 0x34, 0x2e, 0x02, 0x23, 0x22, 0x0e, 0x02, 0x15, 0x15, 0x14, 0x1e,
-    0x02, 0x33, 0x32, 0x3e, 0x02, 0x03, 0x37, 0xfe, 0x5b, 0x02, 0xdc, 0x4c, 0x8b, 0xc2, 0x75, 0x75,
-    0xc2, 0x8e, 0x4d, 0x4d, 0x8c, 0xc2, 0x75, 0x76, 0xc1, 0x8d, 0x4c, 0xf1, 0x26, 0x4b, 0x6a, 0x44,
-    0x43, 0x6b, 0x49, 0x27, 0x27, 0x4b, 0x6b, 0x43, 0x44, 0x69, 0x4a, 0x26, 0x02, 0xa1, 0xc0, 0xc0,
-    0x3f, 0x38, 0x85, 0xd2, 0x95, 0x4e, 0x4e, 0x95, 0xd2, 0x85, 0x38, 0x85, 0xd2, 0x96, 0x4e, 0x4e,
-    0x96, 0xd2, 0xbd, 0x3a, 0x5b, 0x8c, 0x60, 0x32, 0x32, 0x60, 0x8c, 0x5b, 0x3a, 0x5a, 0x8d, 0x61,
-    0x33, 0x33, 0x61, 0x8d, 0x00, 0x02, 0x00, 0x08, 0x00, 0x00, 0x04, 0x71, 0x04, 0x8d, 0x00, 0x04,
-    0x00, 0x09, 0x00, 0x0e, 0xb5, 0x01, 0x09, 0x0a, 0x04, 0x08, 0x7d, 0x00, 0x3f, 0x33, 0x3f, 0x33,
-    0x30, 0x31, 0x41, 0x01, 0x33, 0x01, 0x23, 0x03, 0x01, 0x13, 0x23, 0x01, 0x02, 0x4d, 0x01, 0x25,
-    0xff, 0xfe, 0x48, 0xb3, 0xfe, 0x01, 0x22, 0x49, 0xb4, 0xfe, 0x49, 0x03, 0x5f, 0xfc, 0xa1, 0x04,
-    0x8d, 0xfb, 0x73, 0x03, 0x5d, 0x01, 0x30, 0xfb, 0x73, 0x00, 0x00, 0x03, 0x00, 0x46, 0x00, 0x00,
-    0x03, 0x57, 0x04, 0x8d, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x17, 0x40, 0x0a, 0x07, 0x06,
-    0x06, 0x02, 0x0a, 0x0b, 0x7d, 0x03, 0x02, 0x0a, 0x00, 0x3f, 0x33, 0x3f, 0x33, 0x12, 0x39, 0x2f,
-    0x33, 0x30, 0x31, 0x65, 0x15, 0x21, 0x35, 0x01, 0x15, 0x21, 0x35, 0x01, 0x15, 0x21, 0x35, 0x03,
-    0x57, 0xfc, 0xef, 0x02, 0xc6, 0xfd, 0x84, 0x02, 0xc7, 0xfc, 0xef, 0xc0, 0xc0, 0xc0, 0x01, 0xfe,
-    0xc1, 0xc1, 0x01, 0xcf, 0xc0, 0xc0, 0x00, 0x03, 0x00, 0x76, 0x00, 0x00, 0x04, 0x63, 0x04, 0x8d,
-    0x00, 0x03, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x13, 0xb7, 0x0a, 0x05, 0x0b, 0x07, 0x02, 0x00, 0x03,
-    0x7d, 0x00, 0x3f, 0x33, 0x33, 0x33, 0x33, 0x2f, 0x33, 0x30, 0x31, 0x41, 0x15, 0x21, 0x35, 0x33,
-    0x11, 0x23, 0x11, 0x21, 0x11, 0x23, 0x11, 0x03, 0xb4, 0xfd, 0x6d, 0x46, 0xf1, 0x03, 0xed, 0xf2,
-    0x04, 0x8d, 0xc0, 0xc0, 0xfb, 0x73, 0x04, 0x8d, 0xfb, 0x73, 0x04, 0x8d, 0x00, 0x03, 0x00, 0x44,
-    0x00, 0x01, 0x03, 0xea, 0x04, 0x8d, 0x00, 0x03, 0x00, 0x07, 0x00, 0x10, 0x00, 0x25, 0x40, 0x12,
-    0x0d, 0x08, 0x09, 0x03, 0x0a, 0x06, 0x10, 0x10, 0x0e, 0x07, 0x7d, 0x0a, 0x02, 0x0c, 0x03, 0x03,
-    0x02, 0x0a, 0x00, 0x3f, 0x33, 0x11, 0x33, 0x11, 0x33, 0x3f, 0x33, 0x33, 0x11, 0x33, 0x12, 0x17,
-    0x39, 0x30, 0x31, 0x65, 0x15, 0x21, 0x35, 0x01, 0x15, 0x21, 0x35, 0x01, 0x15, 0x01, 0x23, 0x35,
-    0x01, 0x01, 0x35, 0x33, 0x03, 0xea, 0xfc, 0xb8, 0x03, 0x23, 0xfc, 0xd9, 0x01, 0xf0, 0xfe, 0x5d,
-    0xa7, 0x01, 0x42, 0xfe, 0xbe, 0xa7, 0xc0, 0xbf, 0xbf, 0x03, 0xcd, 0xc0, 0xc0, 0xfd, 0xce, 0x15,
-    0xfd, 0xbb, 0x92, 0x01, 0xbd, 0x01, 0xab, 0x92, 0x00, 0x03, 0x00, 0x4f, 0x00, 0x00, 0x05, 0x57,
-    0x04, 0x8d, 0x00, 0x15, 0x00, 0x27, 0x00, 0x2b, 0x00, 0x15, 0x40, 0x09, 0x16, 0x00, 0x00, 0x2b,
-    0x7d, 0x1e, 0x0c, 0x2a, 0x0a, 0x00, 0x3f, 0xcd, 0x32, 0x3f, 0x33, 0x2f, 0x33, 0x30, 0x31, 0x41,
-    0x33, 0x32, 0x1e, 0x02, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x34, 0x3e,
-    0x02, 0x17, 0x22, 0x06, 0x06, 0x07, 0x14, 0x16, 0x16, 0x33, 0x33, 0x32, 0x36, 0x36, 0x35, 0x34,
-    0x26, 0x26, 0x23, 0x13, 0x11, 0x23, 0x11, 0x02, 0x94, 0x7d, 0x7c, 0xd5, 0x9d, 0x58, 0x58, 0x9d,
-    0xd5, 0x7c, 0x7d, 0x7c, 0xd4, 0x9d, 0x58, 0x58, 0x9d, 0xd4, 0x74, 0x67, 0x94, 0x50, 0x01, 0x4f,
-    0x96, 0x67, 0x8f, 0x67, 0x95, 0x50, 0x50, 0x95, 0x67, 0x32, 0xf2, 0x04, 0x19, 0x3a, 0x75, 0xae,
-    0x74, 0x76, 0xb3, 0x77, 0x3d, 0x3c, 0x77, 0xb2, 0x76, 0x74, 0xb0, 0x74, 0x3b, 0xbb, 0x39, 0x7c,
-    0x63, 0x66, 0x7f, 0x3b, 0x3c, 0x80, 0x66, 0x63, 0x7a, 0x39, 0x01, 0x2f, 0xfb, 0x73, 0x04, 0x8d,
-    0x00, 0x02, 0x00, 0x4f, 0x00, 0x00, 0x05, 0x09, 0x04, 0x8d, 0x00, 0x19, 0x00, 0x1d, 0x00, 0x1f,
-    0x40, 0x0e, 0x15, 0x14, 0x14, 0x06, 0x07, 0x07, 0x0d, 0x1c, 0x0e, 0x00, 0x1d, 0x1d, 0x0d, 0x7d,
-    0x00, 0x3f, 0x33, 0x11, 0x33, 0x3f, 0x12, 0x39, 0x11, 0x33, 0x33, 0x11, 0x33, 0x30, 0x31, 0x41,
-    0x33, 0x11, 0x14, 0x02, 0x04, 0x23, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x11, 0x33, 0x11, 0x14, 0x1e,
-    0x02, 0x33, 0x33, 0x32, 0x36, 0x36, 0x35, 0x03, 0x11, 0x23, 0x11, 0x04, 0x18, 0xf1, 0x87, 0xff,
-    0x00, 0xb5, 0x4c, 0x86, 0xd0, 0x90, 0x4c, 0xf2, 0x25, 0x4f, 0x7b, 0x57, 0x4c, 0x77, 0x8e, 0x40,
-    0xf3, 0xf1, 0x04, 0x8d, 0xfe, 0xd2, 0xbc, 0xfe, 0xfa, 0x88, 0x4d, 0x96, 0xda, 0x8d, 0x01, 0x2e,
-    0xfe, 0xd2, 0x61, 0x93, 0x64, 0x33, 0x5a, 0xb0, 0x81, 0x01, 0x2e, 0xfb, 0x73, 0x04, 0x8d, 0x00,
-    0x00, 0x03, 0x00, 0x5e, 0x00, 0x00, 0x04, 0x81, 0x04, 0x9d, 0x00, 0x2c, 0x00, 0x30, 0x00, 0x34,
-    0x00, 0x27, 0x40, 0x13, 0x2d, 0x34, 0x0a, 0x2e, 0x33, 0x0a, 0x28, 0x12, 0x12, 0x29, 0x11, 0x11,
-    0x32, 0x32, 0x31, 0x0a, 0x06, 0x1d, 0x7e, 0x00, 0x3f, 0x33, 0x3f, 0x33, 0x11, 0x33, 0x11, 0x33,
-    0x33, 0x11, 0x33, 0x3f, 0x33, 0x3f, 0x33, 0x30, 0x31, 0x41, 0x35, 0x34, 0x2e, 0x02, 0x23, 0x22,
-    0x0e, 0x02, 0x15, 0x15, 0x14, 0x1e, 0x02, 0x17, 0x15, 0x2e, 0x03, 0x35, 0x35, 0x34, 0x3e, 0x02,
-    0x33, 0x32, 0x1e, 0x02, 0x15, 0x15, 0x14, 0x0e, 0x02, 0x07, 0x35, 0x3e, 0x02, 0x03, 0x35, 0x21,
-    0x15, 0x21, 0x35, 0x21, 0x15, 0x03, 0x8f, 0x21, 0x47, 0x6c, 0x4d, 0x4b, 0x6c, 0x46, 0x21, 0x1d,
-    0x3c, 0x56, 0x38, 0x67, 0xad, 0x7f, 0x46, 0x47, 0x87, 0xc5, 0x7d, 0x7e, 0xc5, 0x89, 0x47, 0x46,
-    0x7d, 0xab, 0x66, 0x4e, 0x64, 0x30, 0xe2, 0x01, 0xcd, 0xfb, 0xf2, 0x01, 0xcb, 0x02, 0x64, 0x2a,
-    0x4a, 0x7a, 0x5a, 0x31, 0x31, 0x5a, 0x7a, 0x4a, 0x2a, 0x59, 0x8a, 0x66, 0x43, 0x12, 0x75, 0x0c,
-    0x58, 0x91, 0xc1, 0x74, 0x22, 0x69, 0xb9, 0x8d, 0x51, 0x51, 0x8d, 0xb8, 0x69, 0x23, 0x74, 0xc0,
-    0x91, 0x58, 0x0d, 0x75, 0x19, 0x67, 0xa7, 0xfe, 0x13, 0xc1, 0xc1, 0xc1, 0xc1, 0x00, 0x00, 0x03,
-    0x00, 0x23, 0xff, 0xec, 0x05, 0x54, 0x04, 0x8d, 0x00, 0x03, 0x00, 0x07, 0x00, 0x23, 0x00, 0x1c,
-    0x40, 0x0d, 0x17, 0x16, 0x0b, 0x20, 0x0d, 0x0d, 0x03, 0x04, 0x0a, 0x05, 0x02, 0x03, 0x7d, 0x00,
-    0x3f, 0x33, 0x33, 0x3f, 0x12, 0x39, 0x2f, 0x33, 0x3f, 0x33, 0x30, 0x31, 0x41, 0x15, 0x21, 0x35,
-    0x01, 0x11, 0x33, 0x11, 0x03, 0x35, 0x3e, 0x02, 0x33, 0x32, 0x16, 0x16, 0x15, 0x14, 0x0e, 0x02,
-    0x23, 0x35, 0x32, 0x3e, 0x02, 0x35, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x03, 0xd5, 0xfc,
-    0x4e, 0x01, 0x5c, 0xf3, 0x5a, 0x2c, 0x74, 0x87, 0x47, 0x8b, 0xcf, 0x74, 0x41, 0x7c, 0xad, 0x6d,
-    0x36, 0x55, 0x3b, 0x1f, 0x35, 0x6a, 0x51, 0x3d, 0x76, 0x71, 0x04, 0x8d, 0xc0, 0xc0, 0xfb, 0x73,
-    0x04, 0x8d, 0xfb, 0x73, 0x01, 0xfb, 0xbe, 0x13, 0x20, 0x13, 0x59, 0xb4, 0x8b, 0x64, 0x90, 0x5c,
-    0x2b, 0xb9, 0x14, 0x2c, 0x4a, 0x35, 0x4d, 0x60, 0x2e, 0x11, 0x1f, 0x00, 0x00, 0x02, 0x00, 0x4f,
-    0xff, 0xf0, 0x04, 0x43, 0x04, 0x9d, 0x00, 0x03, 0x00, 0x2b, 0x00, 0x17, 0x40, 0x0a, 0x00, 0x01,
-    0x01, 0x09, 0x1d, 0x14, 0x7e, 0x28, 0x09, 0x0b, 0x00, 0x3f, 0x33, 0x3f, 0x33, 0x12, 0x39, 0x2f,
-    0x33, 0x30, 0x31, 0x41, 0x15, 0x21, 0x35, 0x01, 0x33, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x35,
-    0x35, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x16, 0x16, 0x17, 0x23, 0x2e, 0x02, 0x23, 0x22, 0x0e, 0x02,
-    0x15, 0x15, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x36, 0x36, 0x02, 0xc3, 0xfe, 0x37, 0x02, 0x56, 0xf2,
-    0x09, 0x79, 0xd8, 0x99, 0x77, 0xbd, 0x85, 0x47, 0x48, 0x88, 0xbd, 0x76, 0x9b, 0xd4, 0x76, 0x0c,
-    0xf1, 0x06, 0x36, 0x6c, 0x58, 0x44, 0x66, 0x45, 0x23, 0x1f, 0x42, 0x67, 0x47, 0x55, 0x6c, 0x3a,
-    0x02, 0xa7, 0xc0, 0xc0, 0xfe, 0xdd, 0x77, 0xb6, 0x67, 0x4e, 0x91, 0xcf, 0x81, 0x4e, 0x81, 0xcf,
-    0x93, 0x4d, 0x69, 0xba, 0x78, 0x41, 0x63, 0x38, 0x2f, 0x5e, 0x89, 0x5a, 0x4f, 0x58, 0x89, 0x5e,
-    0x31, 0x2f, 0x60, 0x00, 0x00, 0x03, 0x00, 0x24, 0x00, 0x00, 0x07, 0x17, 0x04, 0x8d, 0x00, 0x11,
-    0x00, 0x29, 0x00, 0x2d, 0x00, 0x20, 0x40, 0x0f, 0x28, 0x29, 0x29, 0x1c, 0x2c, 0x1d, 0x01, 0x2d,
-    0x7d, 0x1f, 0x1c, 0x0a, 0x0b, 0x08, 0x0a, 0x00, 0x3f, 0x33, 0x3f, 0x33, 0x3f, 0x33, 0x33, 0x33,
-    0x12, 0x39, 0x2f, 0x33, 0x30, 0x31, 0x41, 0x33, 0x03, 0x0e, 0x04, 0x23, 0x23, 0x35, 0x37, 0x3e,
-    0x04, 0x37, 0x25, 0x32, 0x16, 0x16, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x21, 0x11, 0x33, 0x11, 0x33,
-    0x32, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x21, 0x35, 0x03, 0x15, 0x21, 0x35, 0x01, 0x1b, 0xf2,
-    0x14, 0x05, 0x1f, 0x3b, 0x5f, 0x88, 0x5d, 0x32, 0x26, 0x2a, 0x3d, 0x2a, 0x1a, 0x10, 0x04, 0x04,
-    0x3f, 0x90, 0xd0, 0x6f, 0x3f, 0x78, 0xac, 0x6c, 0xfe, 0x1c, 0xf2, 0xf2, 0x71, 0x6d, 0x30, 0x62,
-    0x4c, 0xfe, 0xbc, 0x6c, 0xfd, 0xc3, 0x04, 0x8d, 0xfd, 0xf7, 0x87, 0xd1, 0x9a, 0x62, 0x30, 0xc8,
-    0x03, 0x03, 0x20, 0x41, 0x68, 0x99, 0x68, 0x60, 0x5f, 0xa9, 0x71, 0x54, 0x8c, 0x67, 0x38, 0x04,
-    0x8d, 0xfc, 0x33, 0x75, 0x4c, 0x32, 0x52, 0x33, 0xc0, 0x01, 0x95, 0xc0, 0xc0, 0x00, 0x00, 0x03,
-    0x00, 0x76, 0x00, 0x00, 0x07, 0x1a, 0x04, 0x8d, 0x00, 0x17, 0x00, 0x1b, 0x00, 0x1f, 0x00, 0x21,
-    0x40, 0x0f, 0x17, 0x16, 0x16, 0x1b, 0x1a, 0x1a, 0x1e, 0x0b, 0x1f, 0x7d, 0x0d, 0x0a, 0x0a, 0x1e,
-    0x0a, 0x00, 0x3f, 0x33, 0x11, 0x33, 0x3f, 0x33, 0x12, 0x39, 0x2f, 0x33, 0x33, 0x2f, 0x33, 0x30,
-    0x31, 0x41, 0x32, 0x16, 0x16, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x21, 0x11, 0x33, 0x11, 0x33, 0x32,
-    0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x21, 0x35, 0x07, 0x15, 0x21, 0x35, 0x13, 0x11, 0x23, 0x11,
-    0x05, 0x4b, 0x90, 0xcf, 0x70, 0x40, 0x78, 0xab, 0x6c, 0xfe, 0x1b, 0xf2, 0xf3, 0x71, 0x6c, 0x30,
-    0x61, 0x4c, 0xfe, 0xbb, 0x5f, 0xfd, 0x7c, 0x44, 0xf1, 0x02, 0xf8, 0x5f, 0xa9, 0x71, 0x54, 0x8c,
-    0x67, 0x38, 0x04, 0x8d, 0xfc, 0x33, 0x75, 0x4c, 0x32, 0x52, 0x33, 0xc0, 0x5b, 0xc0, 0xc0, 0x01,
-    0xf0, 0xfb, 0x73, 0x04, 0x8d, 0x00, 0x00, 0x03, 0x00, 0x25, 0x00, 0x00, 0x05, 0x55, 0x04, 0x8d,
-    0x00, 0x03, 0x00, 0x07, 0x00, 0x1b, 0x00, 0x19, 0x40, 0x0b, 0x18, 0x0d, 0x0d, 0x03, 0x13, 0x04,
-    0x0a, 0x05, 0x02, 0x03, 0x7d, 0x00, 0x3f, 0x33, 0x33, 0x3f, 0x33, 0x12, 0x39, 0x2f, 0x33, 0x30,
-    0x31, 0x41, 0x15, 0x21, 0x35, 0x01, 0x11, 0x33, 0x11, 0x03, 0x35, 0x3e, 0x02, 0x33, 0x32, 0x16,
-    0x16, 0x15, 0x11, 0x23, 0x11, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x03, 0xd6, 0xfc, 0x4f,
-    0x01, 0x5c, 0xf1, 0x59, 0x2c, 0x73, 0x87, 0x45, 0x8c, 0xd1, 0x74, 0xf2, 0x35, 0x6b, 0x50, 0x3d,
-    0x76, 0x70, 0x04, 0x8d, 0xc0, 0xc0, 0xfb, 0x73, 0x04, 0x8d, 0xfb, 0x73, 0x01, 0xfb, 0xbe, 0x13,
-    0x20, 0x13, 0x55, 0xbb, 0x99, 0xfe, 0xaa, 0x01, 0x56, 0x56, 0x66, 0x2d, 0x11, 0x1f, 0x00, 0x04,
-    0x00, 0x76, 0xfe, 0xa1, 0x04, 0x62, 0x04, 0x8d, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x0f,
-    0x00, 0x1b, 0x40, 0x0c, 0x0f, 0x0b, 0x7d, 0x03, 0x07, 0x07, 0x0e, 0x0a, 0x02, 0x02, 0x0a, 0x0a,
-    0x00, 0x3f, 0x33, 0x2f, 0x11, 0x33, 0x33, 0x11, 0x33, 0x3f, 0x33, 0x30, 0x31, 0x65, 0x11, 0x23,
-    0x11, 0x25, 0x15, 0x21, 0x35, 0x13, 0x11, 0x23, 0x11, 0x21, 0x11, 0x23, 0x11, 0x02, 0xec, 0xf2,
-    0x01, 0xba, 0xfd, 0x6d, 0x46, 0xf1, 0x03, 0xec, 0xf1, 0xb3, 0xfd, 0xee, 0x02, 0x12, 0x0d, 0xc0,
-    0xc0, 0x03, 0xcd, 0xfb, 0x73, 0x04, 0x8d, 0xfb, 0x73, 0x04, 0x8d, 0x00, 0x00, 0x02, 0x00, 0x76,
-    0x00, 0x00, 0x04, 0x29, 0x04, 0x8d, 0x00, 0x17, 0x00, 0x1b, 0x00, 0x1b, 0x40, 0x0c, 0x02, 0x01,
-    0x01, 0x0d, 0x0b, 0x0e, 0x0a, 0x1b, 0x1a, 0x1a, 0x0d, 0x7d, 0x00, 0x3f, 0x33, 0x11, 0x33, 0x3f,
-    0x33, 0x12, 0x39, 0x2f, 0x33, 0x30, 0x31, 0x41, 0x21, 0x15, 0x21, 0x32, 0x16, 0x16, 0x15, 0x14,
-    0x06, 0x23, 0x23, 0x11, 0x23, 0x11, 0x21, 0x32, 0x3e, 0x02, 0x35, 0x34, 0x26, 0x26, 0x37, 0x35,
-    0x21, 0x15, 0x02, 0x5a, 0xfe, 0xbc, 0x01, 0x44, 0x4c, 0x62, 0x30, 0x6d, 0x71, 0xf3, 0xf1, 0x01,
-    0xe4, 0x6c, 0xab, 0x78, 0x40, 0x70, 0xcf, 0xc9, 0xfd, 0x71, 0x02, 0xe9, 0xc0, 0x2e, 0x4e, 0x33,
-    0x50, 0x6a, 0x03, 0xcd, 0xfb, 0x73, 0x35, 0x63, 0x8a, 0x56, 0x73, 0xa5, 0x59, 0xe6, 0xbe, 0xbe,
-    0x00, 0x03, 0x00, 0x27, 0xfe, 0xaf, 0x05, 0x14, 0x04, 0x8d, 0x00, 0x10, 0x00, 0x16, 0x00, 0x1e,
-    0x00, 0x23, 0x40, 0x10, 0x1a, 0x1d, 0x1d, 0x09, 0x17, 0x0a, 0x0a, 0x1c, 0x14, 0x09, 0x0a, 0x16,
-    0x11, 0x11, 0x00, 0x7d, 0x00, 0x3f, 0x32, 0x11, 0x33, 0x3f, 0x33, 0x33, 0x33, 0x11, 0x33, 0x11,
-    0x33, 0x2f, 0x33, 0x30, 0x31, 0x41, 0x33, 0x03, 0x0e, 0x04, 0x07, 0x23, 0x35, 0x33, 0x3e, 0x03,
-    0x37, 0x13, 0x21, 0x11, 0x23, 0x11, 0x21, 0x01, 0x21, 0x11, 0x23, 0x11, 0x21, 0x11, 0x23, 0x01,
-    0x42, 0xef, 0x0a, 0x04, 0x2b, 0x4a, 0x60, 0x6e, 0x3a, 0x47, 0x23, 0x2a, 0x41, 0x2e, 0x19, 0x03,
-    0x49, 0x02, 0xfe, 0xf1, 0xfd, 0xf3, 0xfe, 0xa8, 0x04, 0xec, 0xf1, 0xfc, 0xf6, 0xf2, 0x04, 0x8d,
-    0xfe, 0x62, 0x93, 0xe0, 0xa5, 0x73, 0x4c, 0x18, 0xbf, 0x2e, 0x60, 0x7a, 0xae, 0x7e, 0x01, 0x9a,
-    0xfb, 0x73, 0x03, 0xcd, 0xfc, 0xf3, 0xfd, 0xef, 0x01, 0x51, 0xfe, 0xb0, 0x00, 0x05, 0x00, 0x1b,
-    0x00, 0x00, 0x06, 0x2a, 0x04, 0x8d, 0x00, 0x03, 0x00, 0x09, 0x00, 0x0d, 0x00, 0x13, 0x00, 0x17,
-    0x00, 0x35, 0x40, 0x19, 0x14, 0x17, 0x17, 0x11, 0x0c, 0x0b, 0x0b, 0x07, 0x07, 0x11, 0x11, 0x06,
-    0x0e, 0x0e, 0x0f, 0x0a, 0x02, 0x02, 0x15, 0x0a, 0x09, 0x03, 0x03, 0x0f, 0x7d, 0x00, 0x3f, 0x33,
-    0x11, 0x33, 0x3f, 0x33, 0x11, 0x33, 0x12, 0x39, 0x2f, 0x33, 0x33, 0x11, 0x33, 0x11, 0x33, 0x11,
-    0x33, 0x11, 0x33, 0x11, 0x33, 0x30, 0x31, 0x41, 0x11, 0x23, 0x11, 0x21, 0x01, 0x21, 0x27, 0x33,
-    0x13, 0x13, 0x01, 0x37, 0x09, 0x02, 0x21, 0x13, 0x33, 0x07, 0x27, 0x01, 0x21, 0x01, 0x03, 0x9b,
-    0xf1, 0x03, 0x5f, 0xfe, 0x75, 0xfe, 0xd4, 0x11, 0xb4, 0xf8, 0x13, 0xfe, 0xe8, 0xc0, 0x01, 0x82,
-    0xfb, 0x97, 0xfe, 0x7b, 0x01, 0x1d, 0xf7, 0xb4, 0x11, 0x96, 0xfe, 0xe9, 0xfe, 0xd5, 0x01, 0x86,
-    0x04, 0x8d, 0xfb, 0x73, 0x04, 0x8d, 0xfd, 0x4b, 0xd5, 0x01, 0xe0, 0xfb, 0x73, 0x02, 0x01, 0x98,
-    0xfd, 0x67, 0x01, 0xd8, 0x02, 0xb5, 0xfe, 0x20, 0xd5, 0x29, 0xfd, 0xff, 0x02, 0x99, 0x00, 0x02,
-    0x00, 0x43, 0xff, 0xf0, 0x03, 0xea, 0x04, 0x9d, 0x00, 0x1e, 0x00, 0x3e, 0x00, 0x1d, 0x40, 0x0d,
-    0x1f, 0x02, 0x02, 0x01, 0x3e, 0x3e, 0x15, 0x34, 0x2a, 0x0b, 0x0b, 0x15, 0x7e, 0x00, 0x3f, 0x33,
-    0x3f, 0x33, 0x12, 0x39, 0x2f, 0x33, 0x33, 0x11, 0x33, 0x30, 0x31, 0x41, 0x23, 0x35, 0x33, 0x32,
-    0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x15, 0x23, 0x34, 0x3e, 0x02, 0x33,
-    0x32, 0x1e, 0x02, 0x15, 0x14, 0x0e, 0x02, 0x25, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x14, 0x0e, 0x02,
-    0x23, 0x22, 0x2e, 0x02, 0x35, 0x33, 0x1e, 0x02, 0x33, 0x32, 0x36, 0x36, 0x35, 0x34, 0x2e, 0x02,
-    0x23, 0x23, 0x02, 0x39, 0xb9, 0x91, 0x4d, 0x5e, 0x2a, 0x2d, 0x60, 0x4f, 0x35, 0x59, 0x37, 0xf1,
-    0x43, 0x78, 0x9f, 0x5d, 0x69, 0xa9, 0x78, 0x42, 0x3f, 0x70, 0x97, 0xfe, 0xef, 0xb9, 0x6c, 0xa2,
-    0x6d, 0x36, 0x47, 0x82, 0xae, 0x68, 0x51, 0xa1, 0x85, 0x51, 0xf1, 0x04, 0x3a, 0x60, 0x3b, 0x51,
-    0x68, 0x32, 0x1e, 0x3b, 0x58, 0x3a, 0x8d, 0x02, 0x2c, 0x7d, 0x27, 0x45, 0x2f, 0x2a, 0x45, 0x2a,
-    0x1d, 0x3c, 0x2e, 0x4e, 0x79, 0x54, 0x2c, 0x28, 0x4f, 0x77, 0x4f, 0x43, 0x71, 0x53, 0x2d, 0x46,
-    0x2d, 0x52, 0x6f, 0x41, 0x54, 0x7f, 0x55, 0x2b, 0x24, 0x50, 0x84, 0x5f, 0x35, 0x43, 0x20, 0x2a,
-    0x49, 0x30, 0x2c, 0x41, 0x2a, 0x15, 0x00, 0x03, 0x00, 0x76, 0x00, 0x00, 0x04, 0x6d, 0x04, 0x8d,
-    0x00, 0x03, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x1b, 0x40, 0x0c, 0x00, 0x03, 0x0a, 0x07, 0x0b, 0x0a,
-    0x01, 0x02, 0x05, 0x05, 0x08, 0x7d, 0x00, 0x3f, 0x33, 0x11, 0x33, 0x33, 0x3f, 0x33, 0x33, 0x33,
-    0x33, 0x30, 0x31, 0x77, 0x01, 0x17, 0x01, 0x01, 0x33, 0x11, 0x23, 0x01, 0x33, 0x11, 0x23, 0xb6,
-    0x02, 0xc5, 0xb0, 0xfd, 0x3c, 0x02, 0x14, 0xf2, 0xf2, 0xfc, 0xfb, 0xf1, 0xf1, 0x5e, 0x04, 0x2f,
-    0x5e, 0xfb, 0xd1, 0x04, 0x8d, 0xfb, 0x73, 0x04, 0x8d, 0xfb, 0x73, 0x00, 0x00, 0x03, 0x00, 0x76,
-    0x00, 0x00, 0x04, 0x41, 0x04, 0x8d, 0x00, 0x03, 0x00, 0x09, 0x00, 0x0d, 0x00, 0x1f, 0x40, 0x0e,
-    0x0c, 0x0b, 0x0b, 0x07, 0x07, 0x06, 0x06, 0x02, 0x09, 0x03, 0x7d, 0x0a, 0x02, 0x0a, 0x00, 0x3f,
-    0x33, 0x3f, 0x33, 0x12, 0x39, 0x2f, 0x33, 0x11, 0x33, 0x11, 0x33, 0x30, 0x31, 0x41, 0x11, 0x23,
-    0x11, 0x21, 0x01, 0x21, 0x27, 0x33, 0x01, 0x13, 0x01, 0x37, 0x01, 0x01, 0x68, 0xf2, 0x03, 0xa9,
-    0xfe, 0x24, 0xfe, 0xed, 0x20, 0xc2, 0x01, 0x33, 0x10, 0xfe, 0xa7, 0xaa, 0x01, 0xdb, 0x04, 0x8d,
-    0xfb, 0x73, 0x04, 0x8d, 0xfd, 0x4b, 0xd5, 0x01, 0xe0, 0xfb, 0x73, 0x02, 0x01, 0x99, 0xfd, 0x66,
-    0x00, 0x03, 0x00, 0x24, 0x00, 0x00, 0x04, 0x56, 0x04, 0x8d, 0x00, 0x03, 0x00, 0x07, 0x00, 0x19,
-    0x00, 0x18, 0x40, 0x0b, 0x13, 0x10, 0x0a, 0x07, 0x02, 0x03, 0x03, 0x08, 0x7d, 0x06, 0x0a, 0x00,
-    0x3f, 0x3f, 0x33, 0x11, 0x33, 0x33, 0x3f, 0x33, 0x30, 0x31, 0x41, 0x15, 0x21, 0x35, 0x21, 0x11,
-    0x23, 0x11, 0x21, 0x33, 0x03, 0x0e, 0x04, 0x23, 0x23, 0x35, 0x37, 0x3e, 0x04, 0x37, 0x03, 0x98,
-    0xfd, 0xc3, 0x02, 0xfb, 0xf2, 0xfd, 0xb7, 0xf2, 0x15, 0x06, 0x1f, 0x3c, 0x5e, 0x88, 0x5b, 0x32,
-    0x26, 0x2a, 0x3c, 0x2a, 0x1a, 0x10, 0x04, 0x04, 0x8d, 0xc0, 0xc0, 0xfb, 0x73, 0x04, 0x8d, 0xfd,
-    0xf7, 0x87, 0xd1, 0x9a, 0x62, 0x30, 0xc8, 0x04, 0x05, 0x20, 0x40, 0x68, 0x97, 0x68, 0x00, 0x02,
-    0x00, 0x1f, 0xff, 0xec, 0x04, 0x41, 0x04, 0x8d, 0x00, 0x12, 0x00, 0x17, 0x00, 0x17, 0x40, 0x0a,
-    0x01, 0x17, 0x7d, 0x15, 0x16, 0x16, 0x0e, 0x0e, 0x07, 0x0b, 0x00, 0x3f, 0x33, 0x11, 0x33, 0x11,
-    0x33, 0x3f, 0x33, 0x30, 0x31, 0x41, 0x01, 0x21, 0x01, 0x0e, 0x02, 0x23, 0x22, 0x26, 0x27, 0x37,
-    0x16, 0x16, 0x33, 0x32, 0x36, 0x36, 0x37, 0x03, 0x01, 0x13, 0x07, 0x01, 0x02, 0x2c, 0x01, 0x0e,
-    0x01, 0x07, 0xfe, 0x6a, 0x23, 0x54, 0x84, 0x6d, 0x18, 0x41, 0x0d, 0x02, 0x0b, 0x3b, 0x0e, 0x34,
-    0x3f, 0x29, 0x12, 0xb7, 0x01, 0x09, 0x5c, 0xad, 0xfe, 0x3d, 0x01, 0xd8, 0x02, 0xb5, 0xfc, 0x79,
-    0x4d, 0x81, 0x4c, 0x03, 0x02, 0xbe, 0x02, 0x02, 0x28, 0x42, 0x27, 0x03, 0x51, 0xfd, 0xb2, 0xfe,
-    0xee, 0x48, 0x03, 0xa8, 0x00, 0x04, 0x00, 0x76, 0xfe, 0xaf, 0x05, 0x25, 0x04, 0x8d, 0x00, 0x05,
-    0x00, 0x09, 0x00, 0x0d, 0x00, 0x11, 0x00, 0x1d, 0x40, 0x0d, 0x11, 0x0d, 0x7d, 0x05, 0x09, 0x09,
-    0x10, 0x0b, 0x08, 0x02, 0x02, 0x08, 0x0a, 0x00, 0x3f, 0x33, 0x2f, 0x11, 0x33, 0x33, 0x33, 0x11,
-    0x33, 0x3f, 0x33, 0x30, 0x31, 0x65, 0x03, 0x23, 0x11, 0x23, 0x35, 0x33, 0x15, 0x21, 0x35, 0x13,
-    0x11, 0x23, 0x11, 0x21, 0x11, 0x23, 0x11, 0x05, 0x25, 0x13, 0xde, 0x84, 0x04, 0xfd, 0x6d, 0x46,
-    0xf1, 0x03, 0xed, 0xf2, 0xc0, 0xfd, 0xef, 0x01, 0x51, 0xc0, 0xc0, 0xc0, 0x03, 0xcd, 0xfb, 0x73,
-    0x04, 0x8d, 0xfb, 0x73, 0x04, 0x8d, 0x00, 0x02, 0x00, 0x43, 0x00, 0x00, 0x04, 0x18, 0x04, 0x8d,
-    0x00, 0x03, 0x00, 0x17, 0x00, 0x13, 0xb7, 0x14, 0x09, 0x09, 0x02, 0x03, 0x0e, 0x7d, 0x02, 0x00,
-    0x2f, 0x3f, 0x33, 0x12, 0x39, 0x2f, 0x33, 0x30, 0x31, 0x41, 0x11, 0x23, 0x11, 0x13, 0x15, 0x0e,
-    0x02, 0x23, 0x22, 0x26, 0x26, 0x35, 0x11, 0x33, 0x11, 0x14, 0x16, 0x16, 0x33, 0x32, 0x36, 0x36,
-    0x04, 0x18, 0xf2, 0x59, 0x2b, 0x73, 0x7f, 0x3d, 0x94, 0xd9, 0x75, 0xf2, 0x35, 0x6b, 0x50, 0x3e,
-    0x75, 0x71, 0x04, 0x8d, 0xfb, 0x73, 0x04, 0x8d, 0xfd, 0xff, 0xbe, 0x13, 0x1f, 0x14, 0x55, 0xbc,
-    0x98, 0x01, 0x5c, 0xfe, 0xa4, 0x56, 0x65, 0x2e, 0x12, 0x1e, 0x00, 0x04, 0x00, 0x76, 0x00, 0x00,
-    0x06, 0x0f, 0x04, 0x8d, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x19, 0x40, 0x0b,
-    0x0b, 0x07, 0x07, 0x0f, 0x10, 0x0a, 0x06, 0x06, 0x03, 0x0e, 0x7d, 0x00, 0x3f, 0x33, 0x33, 0x11,
-    0x33, 0x3f, 0x33, 0x11, 0x33, 0x30, 0x31, 0x65, 0x15, 0x21, 0x35, 0x01, 0x11, 0x23, 0x11, 0x21,
-    0x11, 0x23, 0x11, 0x21, 0x11, 0x23, 0x11, 0x05, 0x60, 0xfb, 0xa5, 0x02, 0xb6, 0xf2, 0x03, 0x46,
-    0xf2, 0xfc, 0x4a, 0xf1, 0xc0, 0xc0, 0xc0, 0x03, 0xcd, 0xfb, 0x73, 0x04, 0x8d, 0xfb, 0x73, 0x04,
-    0x8d, 0xfb, 0x73, 0x04, 0x8d, 0x00, 0x00, 0x05, 0x00, 0x76, 0xfe, 0xaf, 0x06, 0xd0, 0x04, 0x8d,
-    0x00, 0x05, 0x00, 0x09, 0x00, 0x0d, 0x00, 0x11, 0x00, 0x15, 0x00, 0x27, 0x40, 0x12, 0x11, 0x0d,
-    0x0d, 0x15, 0x7d, 0x04, 0x10, 0x02, 0x02, 0x10, 0x10, 0x0c, 0x0c, 0x13, 0x13, 0x09, 0x08, 0x0a,
-    0x00, 0x3f, 0x33, 0x33, 0x11, 0x33, 0x11, 0x33, 0x11, 0x33, 0x2f, 0x11, 0x33, 0x3f, 0x33, 0x11,
-    0x33, 0x30, 0x31, 0x65, 0x03, 0x23, 0x11, 0x23, 0x35, 0x33, 0x15, 0x21, 0x35, 0x01, 0x11, 0x23,
-    0x11, 0x21, 0x11, 0x23, 0x11, 0x21, 0x11, 0x23, 0x11, 0x06, 0xd0, 0x12, 0xdd, 0x84, 0x03, 0xfb,
-    0xa5, 0x02, 0xb6, 0xf2, 0x03, 0x46, 0xf2, 0xfc, 0x4a, 0xf1, 0xc0, 0xfd, 0xef, 0x01, 0x51, 0xc0,
-    0xc0, 0xc0, 0x03, 0xcd, 0xfb, 0x73, 0x04, 0x8d, 0xfb, 0x73, 0x04, 0x8d, 0xfb, 0x73, 0x04, 0x8d,
-    0x00, 0x02, 0x00, 0x09, 0x00, 0x00, 0x05, 0x24, 0x04, 0x8d, 0x00, 0x03, 0x00, 0x1a, 0x00, 0x17,
-    0x40, 0x0a, 0x06, 0x05, 0x05, 0x0f, 0x12, 0x0a, 0x11, 0x01, 0x00, 0x7d, 0x00, 0x3f, 0x32, 0x32,
-    0x3f, 0x33, 0x39, 0x2f, 0x33, 0x30, 0x31, 0x53, 0x15, 0x21, 0x35, 0x01, 0x21, 0x15, 0x21, 0x32,
-    0x16, 0x16, 0x15, 0x14, 0x06, 0x23, 0x23, 0x11, 0x23, 0x11, 0x21, 0x32, 0x36, 0x36, 0x35, 0x34,
-    0x26, 0x26, 0x09, 0x01, 0xcb, 0x01, 0x80, 0xfe, 0xbc, 0x01, 0x44, 0x4c, 0x63, 0x30, 0x6d, 0x72,
-    0xf3, 0xf1, 0x01, 0xe4, 0x90, 0xd0, 0x70, 0x70, 0xd0, 0x04, 0x8d, 0xc0, 0xc0, 0xfe, 0x6b, 0xc0,
-    0x33, 0x52, 0x32, 0x4c, 0x75, 0x03, 0xcd, 0xfb, 0x73, 0x62, 0xad, 0x70, 0x71, 0xa9, 0x5f, 0x00,
-    0xff, 0xff, 0x00, 0x76, 0x00, 0x00, 0x05, 0xa1, 0x04, 0x8d, 0x04, 0x26, 0x02, 0x22, 0x00, 0x00,
-    0x00, 0x07, 0x01, 0xfd, 0x04, 0x2a, 0x00, 0x00, 0x00, 0x01, 0x00, 0x76, 0x00, 0x00, 0x04, 0x29,
-    0x04, 0x8d, 0x00, 0x16, 0x00, 0x15, 0x40, 0x09, 0x15, 0x16, 0x16, 0x0a, 0x0c, 0x09, 0x0a, 0x0a,
-    0x7d, 0x00, 0x3f, 0x3f, 0x33, 0x12, 0x39, 0x2f, 0x33, 0x30, 0x31, 0x41, 0x32, 0x16, 0x16, 0x15,
-    0x14, 0x06, 0x06, 0x23, 0x21, 0x11, 0x33, 0x11, 0x33, 0x32, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23,
-    0x21, 0x35, 0x02, 0x5a, 0x90, 0xcf, 0x70, 0x70, 0xcf, 0x90, 0xfe, 0x1c, 0xf1, 0xf3, 0x71, 0x6d,
-    0x30, 0x62, 0x4c, 0xfe, 0xbc, 0x02, 0xf8, 0x5f, 0xa9, 0x71, 0x70, 0xad, 0x62, 0x04, 0x8d, 0xfc,
-    0x33, 0x75, 0x4c, 0x32, 0x52, 0x33, 0xc0, 0x00, 0x00, 0x02, 0x00, 0x3d, 0xff, 0xf0, 0x04, 0x31,
-    0x04, 0x9d, 0x00, 0x03, 0x00, 0x2b, 0x00, 0x17, 0x40, 0x0a, 0x02, 0x01, 0x01, 0x1c, 0x08, 0x27,
-    0x0b, 0x13, 0x1c, 0x7e, 0x00, 0x3f, 0x33, 0x3f, 0x33, 0x12, 0x39, 0x2f, 0x33, 0x30, 0x31, 0x41,
-    0x21, 0x35, 0x21, 0x01, 0x1e, 0x02, 0x33, 0x32, 0x3e, 0x02, 0x35, 0x35, 0x34, 0x2e, 0x02, 0x23,
-    0x22, 0x06, 0x06, 0x07, 0x23, 0x3e, 0x02, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x15, 0x14, 0x0e, 0x02,
-    0x23, 0x22, 0x26, 0x26, 0x27, 0x03, 0x86, 0xfe, 0x38, 0x01, 0xc8, 0xfd, 0xaa, 0x07, 0x39, 0x6d,
-    0x55, 0x47, 0x66, 0x42, 0x1f, 0x23, 0x45, 0x66, 0x44, 0x57, 0x6c, 0x36, 0x06, 0xf2, 0x0d, 0x75,
-    0xd5, 0x9a, 0x76, 0xbe, 0x87, 0x48, 0x47, 0x84, 0xbd, 0x77, 0x99, 0xd8, 0x79, 0x0a, 0x01, 0xe7,
-    0xc0, 0xfe, 0xdd, 0x46, 0x60, 0x2f, 0x31, 0x5e, 0x89, 0x58, 0x4f, 0x5a, 0x89, 0x5e, 0x2f, 0x38,
-    0x63, 0x41, 0x78, 0xba, 0x69, 0x4d, 0x93, 0xcf, 0x81, 0x4e, 0x81, 0xcf, 0x91, 0x4e, 0x67, 0xb6,
-    0x77, 0x00, 0x00, 0x04, 0x00, 0x76, 0xff, 0xf0, 0x06, 0x40, 0x04, 0x9d, 0x00, 0x03, 0x00, 0x07,
-    0x00, 0x1d, 0x00, 0x33, 0x00, 0x1d, 0x40, 0x0e, 0x24, 0x19, 0x7e, 0x2f, 0x0e, 0x0b, 0x03, 0x02,
-    0x02, 0x06, 0x07, 0x7d, 0x06, 0x0a, 0x00, 0x3f, 0x3f, 0x12, 0x39, 0x2f, 0x33, 0x3f, 0x33, 0x3f,
-    0x33, 0x30, 0x31, 0x41, 0x15, 0x21, 0x35, 0x13, 0x11, 0x23, 0x11, 0x01, 0x15, 0x14, 0x0e, 0x02,
-    0x23, 0x22, 0x2e, 0x02, 0x35, 0x35, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x1e, 0x02, 0x07, 0x35, 0x34,
-    0x2e, 0x02, 0x23, 0x22, 0x0e, 0x02, 0x15, 0x15, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x3e, 0x02, 0x02,
-    0x9a, 0xfe, 0x8a, 0x43, 0xf1, 0x05, 0xca, 0x4c, 0x8c, 0xc1, 0x76, 0x75, 0xc2, 0x8d, 0x4d, 0x4c,
-    0x8c, 0xc2, 0x75, 0x76, 0xc2, 0x8c, 0x4d, 0xf1, 0x27, 0x4a, 0x6b, 0x44, 0x44, 0x6a, 0x4a, 0x27,
-    0x27, 0x4c, 0x6a, 0x44, 0x44, 0x6a, 0x49, 0x27, 0x02, 0xa4, 0xc0, 0xc0, 0x01, 0xe9, 0xfb, 0x73,
-    0x04, 0x8d, 0xfd, 0xd5, 0x38, 0x85, 0xd2, 0x95, 0x4e, 0x4e, 0x95, 0xd2, 0x85, 0x38, 0x85, 0xd2,
-    0x96, 0x4e, 0x4e, 0x96, 0xd2, 0xbd, 0x3a, 0x5b, 0x8c, 0x60, 0x32, 0x32, 0x60, 0x8c, 0x5b, 0x3a,
-    0x5a, 0x8d, 0x61, 0x33, 0x33, 0x61, 0x8d, 0x00, 0x00, 0x02, 0x00, 0x42, 0x00, 0x00, 0x04, 0x0f,
-    0x04, 0x8d, 0x00, 0x03, 0x00, 0x23, 0x00, 0x19, 0x40, 0x0b, 0x23, 0x00, 0x04, 0x04, 0x19, 0x1b,
-    0x16, 0x7d, 0x19, 0x01, 0x0a, 0x00, 0x3f, 0x33, 0x3f, 0x33, 0x12, 0x39, 0x2f, 0x33, 0x33, 0x30,
-    0x31, 0x41, 0x01, 0x21, 0x01, 0x05, 0x21, 0x2e, 0x02, 0x27, 0x2e, 0x02, 0x27, 0x2e, 0x02, 0x35,
-    0x34, 0x3e, 0x02, 0x33, 0x21, 0x11, 0x23, 0x11, 0x23, 0x22, 0x06, 0x15, 0x14, 0x16, 0x16, 0x33,
-    0x21, 0x02, 0x75, 0xfe, 0xd0, 0xfe, 0xfd, 0x01, 0x35, 0x01, 0xf8, 0xfe, 0x91, 0x16, 0x0d, 0x0c,
-    0x16, 0x03, 0x0a, 0x0a, 0x03, 0x61, 0x7f, 0x3f, 0x3d, 0x75, 0xa5, 0x69, 0x01, 0xcd, 0xf2, 0xdc,
-    0x6b, 0x63, 0x2b, 0x5c, 0x47, 0x01, 0x30, 0x02, 0x4b, 0xfd, 0xb5, 0x02, 0x4b, 0x8d, 0x01, 0x07,
-    0x0a, 0x04, 0x01, 0x10, 0x10, 0x01, 0x18, 0x5b, 0x7d, 0x4c, 0x51, 0x81, 0x5a, 0x2f, 0xfb, 0x73,
-    0x03, 0xcd, 0x60, 0x4a, 0x32, 0x4b, 0x29, 0x00, 0x00, 0x03, 0x00, 0x0b, 0x00, 0x00, 0x04, 0x05,
-    0x04, 0x8d, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x1b, 0x40, 0x0c, 0x0b, 0x0a, 0x0a, 0x03,
-    0x02, 0x06, 0x07, 0x07, 0x03, 0x7d, 0x02, 0x0a, 0x00, 0x3f, 0x3f, 0x33, 0x11, 0x33, 0x11, 0x12,
-    0x39, 0x2f, 0x33, 0x30, 0x31, 0x41, 0x11, 0x23, 0x11, 0x21, 0x15, 0x21, 0x35, 0x01, 0x15, 0x21,
-    0x35, 0x01, 0xd3, 0xf2, 0x03, 0x24, 0xfd, 0x8a, 0x01, 0x1b, 0xfd, 0x61, 0x04, 0x8d, 0xfb, 0x73,
-    0x04, 0x8d, 0xc0, 0xc0, 0xfe, 0x01, 0xa6, 0xa6, 0x00, 0x06, 0x00, 0x1b, 0xfe, 0xaf, 0x06, 0x78,
-    0x04, 0x8d, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0d, 0x00, 0x11, 0x00, 0x17, 0x00, 0x1b, 0x00, 0x3b,
-    0x40, 0x1c, 0x02, 0x0e, 0x01, 0x01, 0x0e, 0x0e, 0x06, 0x1b, 0x18, 0x18, 0x15, 0x12, 0x12, 0x10,
-    0x0f, 0x0c, 0x09, 0x09, 0x13, 0x06, 0x06, 0x19, 0x0a, 0x0d, 0x07, 0x07, 0x13, 0x7d, 0x00, 0x3f,
-    0x33, 0x11, 0x33, 0x3f, 0x33, 0x11, 0x12, 0x39, 0x2f, 0x33, 0x33, 0x33, 0x33, 0x11, 0x33, 0x33,
-    0x11, 0x33, 0x11, 0x33, 0x11, 0x33, 0x2f, 0x11, 0x33, 0x30, 0x31, 0x41, 0x23, 0x11, 0x33, 0x01,
-    0x11, 0x23, 0x11, 0x21, 0x01, 0x21, 0x27, 0x33, 0x13, 0x13, 0x01, 0x37, 0x09, 0x02, 0x21, 0x13,
-    0x33, 0x07, 0x27, 0x01, 0x21, 0x01, 0x06, 0x78, 0xce, 0xce, 0xfd, 0x23, 0xf1, 0x03, 0x5f, 0xfe,
-    0x75, 0xfe, 0xd4, 0x11, 0xb4, 0xf8, 0x13, 0xfe, 0xe8, 0xc0, 0x01, 0x82, 0xfb, 0x97, 0xfe, 0x7b,
-    0x01, 0x1d, 0xf7, 0xb4, 0x11, 0x96, 0xfe, 0xe9, 0xfe, 0xd5, 0x01, 0x86, 0xfe, 0xaf, 0x02, 0x10,
-    0x03, 0xce, 0xfb, 0x73, 0x04, 0x8d, 0xfd, 0x4b, 0xd5, 0x01, 0xe0, 0xfb, 0x73, 0x02, 0x01, 0x98,
-    0xfd, 0x67, 0x01, 0xd8, 0x02, 0xb5, 0xfe, 0x20, 0xd5, 0x29, 0xfd, 0xff, 0x02, 0x99, 0x00, 0x04,
-    0x00, 0x76, 0xfe, 0xaf, 0x04, 0x7e, 0x04, 0x8d, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0d, 0x00, 0x11,
-    0x00, 0x27, 0x40, 0x12, 0x10, 0x0f, 0x0f, 0x0b, 0x0a, 0x0a, 0x06, 0x0d, 0x07, 0x7d, 0x02, 0x0e,
-    0x01, 0x01, 0x0e, 0x0e, 0x06, 0x0a, 0x00, 0x3f, 0x33, 0x11, 0x33, 0x2f, 0x11, 0x33, 0x3f, 0x33,
-    0x12, 0x39, 0x2f, 0x33, 0x33, 0x11, 0x33, 0x30, 0x31, 0x41, 0x23, 0x11, 0x33, 0x01, 0x11, 0x23,
-    0x11, 0x21, 0x01, 0x21, 0x27, 0x33, 0x01, 0x13, 0x01, 0x37, 0x01, 0x04, 0x7e, 0xcc, 0xcc, 0xfc,
-    0xea, 0xf2, 0x03, 0xa9, 0xfe, 0x24, 0xfe, 0xed, 0x20, 0xc2, 0x01, 0x33, 0x10, 0xfe, 0xa7, 0xaa,
-    0x01, 0xdb, 0xfe, 0xaf, 0x02, 0x10, 0x03, 0xce, 0xfb, 0x73, 0x04, 0x8d, 0xfd, 0x4b, 0xd5, 0x01,
-    0xe0, 0xfb, 0x73, 0x02, 0x01, 0x99, 0xfd, 0x66, 0x00, 0x04, 0x00, 0x76, 0x00, 0x00, 0x04, 0xf1,
-    0x04, 0x8d, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0d, 0x00, 0x11, 0x00, 0x29, 0x40, 0x13, 0x10, 0x0f,
-    0x0f, 0x0a, 0x00, 0x0b, 0x0b, 0x0a, 0x03, 0x03, 0x0a, 0x0a, 0x06, 0x0d, 0x07, 0x7d, 0x0e, 0x06,
-    0x0a, 0x00, 0x3f, 0x33, 0x3f, 0x33, 0x12, 0x39, 0x2f, 0x33, 0x2f, 0x11, 0x33, 0x11, 0x33, 0x11,
-    0x33, 0x11, 0x33, 0x30, 0x31, 0x41, 0x33, 0x11, 0x23, 0x03, 0x11, 0x23, 0x11, 0x21, 0x01, 0x21,
-    0x27, 0x21, 0x01, 0x13, 0x01, 0x37, 0x01, 0x01, 0xae, 0x9e, 0x9e, 0x46, 0xf2, 0x04, 0x59, 0xfe,
-    0x24, 0xfe, 0x3d, 0x20, 0x01, 0x72, 0x01, 0x34, 0x0f, 0xfe, 0xa7, 0xaa, 0x01, 0xdb, 0x03, 0x8d,
-    0xfd, 0x7e, 0x03, 0x82, 0xfb, 0x73, 0x04, 0x8d, 0xfd, 0x4b, 0xd5, 0x01, 0xe0, 0xfb, 0x73, 0x02,
-    0x01, 0x99, 0xfd, 0x66, 0x00, 0x04, 0x00, 0x21, 0x00, 0x00, 0x05, 0x53, 0x04, 0x8d, 0x00, 0x03,
-    0x00, 0x07, 0x00, 0x0d, 0x00, 0x11, 0x00, 0x21, 0x40, 0x0f, 0x10, 0x0f, 0x0f, 0x0b, 0x0a, 0x0a,
-    0x0e, 0x06, 0x0a, 0x0d, 0x07, 0x07, 0x03, 0x00, 0x7d, 0x00, 0x3f, 0x32, 0x32, 0x11, 0x33, 0x3f,
-    0x33, 0x39, 0x2f, 0x33, 0x33, 0x11, 0x33, 0x30, 0x31, 0x53, 0x21, 0x15, 0x21, 0x25, 0x11, 0x23,
-    0x11, 0x21, 0x01, 0x21, 0x27, 0x33, 0x01, 0x13, 0x01, 0x37, 0x01, 0x21, 0x01, 0xcb, 0xfe, 0x35,
-    0x02, 0x59, 0xf1, 0x03, 0xa9, 0xfe, 0x24, 0xfe, 0xec, 0x1f, 0xc2, 0x01, 0x33, 0x10, 0xfe, 0xa8,
-    0xa9, 0x01, 0xda, 0x04, 0x8d, 0xc0, 0xc0, 0xfb, 0x73, 0x04, 0x8d, 0xfd, 0x4b, 0xd5, 0x01, 0xe0,
-    0xfb, 0x73, 0x02, 0x01, 0x99, 0xfd, 0x66, 0x00, 0x00, 0x01, 0x00, 0x4e, 0xff, 0xeb, 0x05, 0xa0,
-    0x04, 0xa6, 0x00, 0x44, 0x00, 0x1b, 0x40, 0x0c, 0x00, 0x01, 0x01, 0x2f, 0x18, 0x0b, 0x24, 0x23,
-    0x23, 0x3a, 0x0d, 0x7e, 0x00, 0x3f, 0x33, 0x33, 0x11, 0x33, 0x3f, 0x33, 0x33, 0x2f, 0x33, 0x30,
-    0x31, 0x65, 0x15, 0x22, 0x24, 0x2e, 0x02, 0x35, 0x35, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x1e, 0x02,
-    0x15, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x35, 0x34, 0x3e, 0x02, 0x33, 0x15,
-    0x22, 0x0e, 0x02, 0x15, 0x15, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x3e, 0x02, 0x35, 0x35, 0x34, 0x2e,
-    0x02, 0x23, 0x22, 0x0e, 0x02, 0x15, 0x15, 0x14, 0x1e, 0x02, 0x05, 0xa0, 0x9b, 0xfe, 0xf6, 0xd3,
-    0x94, 0x4f, 0x3a, 0x6d, 0x99, 0x5e, 0x62, 0x9c, 0x6f, 0x3a, 0x67, 0xbb, 0xfe, 0x98, 0x94, 0xee,
-    0xa8, 0x5a, 0x46, 0x82, 0xb3, 0x6e, 0x3a, 0x5c, 0x40, 0x21, 0x35, 0x66, 0x97, 0x60, 0x64, 0xa5,
-    0x7a, 0x43, 0x16, 0x2c, 0x43, 0x2d, 0x2c, 0x45, 0x2f, 0x18, 0x52, 0x9e, 0xe9, 0xae, 0xbf, 0x36,
-    0x6c, 0x9f, 0xd3, 0x82, 0x28, 0x77, 0xba, 0x82, 0x44, 0x41, 0x80, 0xba, 0x78, 0x46, 0x8d, 0xea,
-    0xab, 0x5e, 0x51, 0x9d, 0xe3, 0x92, 0x2e, 0x80, 0xcd, 0x91, 0x4c, 0xc7, 0x2f, 0x5c, 0x86, 0x58,
-    0x25, 0x65, 0x9b, 0x6a, 0x34, 0x3a, 0x72, 0xa8, 0x6e, 0x34, 0x52, 0x75, 0x4a, 0x24, 0x26, 0x4d,
-    0x70, 0x4b, 0x2d, 0x7e, 0xb3, 0x6f, 0x35, 0x00, 0xff, 0xff, 0x00, 0x06, 0x00, 0x00, 0x04, 0x38,
-    0x04, 0x8d, 0x04, 0x26, 0x01, 0xed, 0x00, 0x00, 0x00, 0x07, 0x02, 0x40, 0x00, 0x3e, 0xfe, 0xd3,
-    0x00, 0x02, 0x00, 0x13, 0xfe, 0xaf, 0x04, 0x86, 0x04, 0x8d, 0x00, 0x03, 0x00, 0x0f, 0x00, 0x22,
-    0x40, 0x11, 0x0b, 0x0e, 0x08, 0x05, 0x04, 0x0a, 0x06, 0x0f, 0x7d, 0x02, 0x0a, 0x01, 0x01, 0x0a,
-    0x0a, 0x0d, 0x0a, 0x00, 0x3f, 0x33, 0x11, 0x33, 0x2f, 0x11, 0x33, 0x3f, 0x33, 0x12, 0x17, 0x39,
-    0x30, 0x31, 0x41, 0x23, 0x11, 0x33, 0x01, 0x13, 0x13, 0x21, 0x01, 0x01, 0x21, 0x01, 0x03, 0x21,
-    0x01, 0x01, 0x04, 0x86, 0xcd, 0xcd, 0xfc, 0xae, 0xf1, 0xf4, 0x01, 0x1a, 0xfe, 0x89, 0x01, 0x8d,
-    0xfe, 0xe1, 0xfe, 0xff, 0xfc, 0xfe, 0xe6, 0x01, 0x82, 0xfe, 0x88, 0xfe, 0xaf, 0x02, 0x10, 0x03,
-    0xce, 0xfe, 0x6a, 0x01, 0x96, 0xfd, 0xbe, 0xfd, 0xb5, 0x01, 0x9e, 0xfe, 0x62, 0x02, 0x4b, 0x02,
-    0x42, 0x00, 0x00, 0x05, 0x00, 0x23, 0xfe, 0xaf, 0x06, 0x31, 0x04, 0x8d, 0x00, 0x05, 0x00, 0x09,
-    0x00, 0x0d, 0x00, 0x11, 0x00, 0x15, 0x00, 0x22, 0x40, 0x10, 0x11, 0x0d, 0x0d, 0x14, 0x15, 0x7d,
-    0x10, 0x12, 0x0c, 0x09, 0x04, 0x08, 0x02, 0x02, 0x08, 0x12, 0x00, 0x3f, 0x33, 0x2f, 0x11, 0x33,
-    0x33, 0x33, 0x3f, 0x3f, 0x33, 0x33, 0x11, 0x33, 0x30, 0x31, 0x65, 0x03, 0x23, 0x11, 0x23, 0x35,
-    0x33, 0x15, 0x21, 0x35, 0x13, 0x11, 0x23, 0x11, 0x21, 0x11, 0x23, 0x11, 0x23, 0x15, 0x21, 0x35,
-    0x06, 0x31, 0x13, 0xdd, 0x84, 0x03, 0xfd, 0x6c, 0x47, 0xf2, 0x03, 0xed, 0xf1, 0xb4, 0xfc, 0x5a,
-    0xc0, 0xfd, 0xef, 0x01, 0x51, 0xc0, 0xc0, 0xc0, 0x03, 0xcd, 0xfb, 0x73, 0x04, 0x8d, 0xfb, 0x73,
-    0x04, 0x8d, 0xc0, 0xc0, 0x00, 0x03, 0x00, 0x43, 0x00, 0x00, 0x04, 0x18, 0x04, 0x8d, 0x00, 0x03,
-    0x00, 0x07, 0x00, 0x1b, 0x00, 0x1f, 0x40, 0x0e, 0x00, 0x18, 0x18, 0x0d, 0x03, 0x03, 0x0d, 0x0d,
-    0x06, 0x07, 0x12, 0x7d, 0x06, 0x0a, 0x00, 0x3f, 0x3f, 0x33, 0x12, 0x39, 0x2f, 0x33, 0x2f, 0x11,
-    0x33, 0x11, 0x33, 0x30, 0x31, 0x41, 0x33, 0x11, 0x23, 0x01, 0x11, 0x23, 0x11, 0x13, 0x15, 0x0e,
-    0x02, 0x23, 0x22, 0x26, 0x26, 0x35, 0x11, 0x33, 0x11, 0x14, 0x16, 0x16, 0x33, 0x32, 0x36, 0x36,
-    0x01, 0xe3, 0x9d, 0x9d, 0x02, 0x35, 0xf2, 0x59, 0x2b, 0x73, 0x7f, 0x3d, 0x94, 0xd9, 0x75, 0xf2,
-    0x35, 0x6b, 0x50, 0x3e, 0x75, 0x71, 0x03, 0x42, 0xfd, 0x7e, 0x03, 0xcd, 0xfb, 0x73, 0x04, 0x8d,
-    0xfd, 0xff, 0xbe, 0x13, 0x1f, 0x14, 0x55, 0xbc, 0x98, 0x01, 0x5c, 0xfe, 0xa4, 0x56, 0x65, 0x2e,
-    0x12, 0x1e, 0x00, 0x02, 0x00, 0x76, 0x00, 0x00, 0x04, 0x4a, 0x04, 0x8d, 0x00, 0x03, 0x00, 0x17,
-    0x00, 0x14, 0x40, 0x09, 0x0f, 0x12, 0x14, 0x09, 0x09, 0x01, 0x7d, 0x00, 0x12, 0x00, 0x3f, 0x3f,
-    0x39, 0x2f, 0x33, 0x3f, 0x30, 0x31, 0x73, 0x11, 0x33, 0x11, 0x03, 0x35, 0x3e, 0x02, 0x33, 0x32,
-    0x16, 0x16, 0x15, 0x11, 0x23, 0x11, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x76, 0xf1, 0x59,
-    0x2c, 0x72, 0x7f, 0x3d, 0x95, 0xd8, 0x75, 0xf1, 0x36, 0x6a, 0x51, 0x3d, 0x76, 0x70, 0x04, 0x8d,
-    0xfb, 0x73, 0x02, 0x02, 0xbe, 0x13, 0x20, 0x13, 0x55, 0xba, 0x99, 0xfe, 0xa2, 0x01, 0x5d, 0x56,
-    0x66, 0x2d, 0x11, 0x1e, 0x00, 0x01, 0x00, 0x0e, 0xff, 0xf0, 0x05, 0xac, 0x04, 0xa4, 0x00, 0x34,
-    0x00, 0x1b, 0x40, 0x0c, 0x18, 0x18, 0x1d, 0x1d, 0x11, 0x11, 0x22, 0x0b, 0x7e, 0x2d, 0x00, 0x0b,
-    0x00, 0x3f, 0x32, 0x3f, 0x33, 0x39, 0x2f, 0x33, 0x11, 0x33, 0x2f, 0x30, 0x31, 0x45, 0x22, 0x2e,
-    0x02, 0x35, 0x35, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x15, 0x21, 0x22, 0x2e, 0x02,
-    0x35, 0x33, 0x14, 0x16, 0x16, 0x33, 0x21, 0x35, 0x34, 0x26, 0x26, 0x23, 0x22, 0x0e, 0x02, 0x15,
-    0x15, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x36, 0x37, 0x17, 0x0e, 0x02, 0x03, 0xce, 0x89, 0xdc, 0x9c,
-    0x53, 0x54, 0x94, 0xc3, 0x71, 0x7e, 0xc7, 0x89, 0x48, 0xfb, 0xf6, 0x67, 0x98, 0x64, 0x31, 0xbf,
-    0x2f, 0x5e, 0x48, 0x03, 0x19, 0x44, 0x81, 0x5f, 0x46, 0x6f, 0x4e, 0x28, 0x27, 0x53, 0x87, 0x61,
-    0x6a, 0x95, 0x31, 0x40, 0x17, 0x65, 0x96, 0x10, 0x4c, 0x8f, 0xc9, 0x7e, 0x74, 0x7c, 0xc7, 0x8f,
-    0x4c, 0x47, 0x8a, 0xca, 0x83, 0x98, 0x3c, 0x6f, 0x9a, 0x5d, 0x45, 0x66, 0x38, 0x17, 0x5a, 0x80,
-    0x45, 0x31, 0x5b, 0x7e, 0x4e, 0x84, 0x4b, 0x7b, 0x5a, 0x31, 0x2b, 0x14, 0xb6, 0x0d, 0x25, 0x1d,
-    0x00, 0x01, 0x00, 0x4d, 0xff, 0xf0, 0x04, 0x7f, 0x04, 0xa4, 0x00, 0x2b, 0x00, 0x15, 0x40, 0x09,
-    0x11, 0x14, 0x14, 0x19, 0x0b, 0x0b, 0x24, 0x00, 0x7e, 0x00, 0x3f, 0x32, 0x3f, 0x33, 0x39, 0x2f,
-    0x33, 0x30, 0x31, 0x41, 0x32, 0x1e, 0x02, 0x15, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02,
-    0x35, 0x35, 0x21, 0x15, 0x21, 0x15, 0x14, 0x16, 0x16, 0x33, 0x32, 0x3e, 0x02, 0x35, 0x35, 0x34,
-    0x2e, 0x02, 0x23, 0x22, 0x06, 0x07, 0x27, 0x3e, 0x02, 0x02, 0x35, 0x86, 0xd9, 0x99, 0x52, 0x53,
-    0x95, 0xc4, 0x70, 0x7f, 0xc6, 0x89, 0x48, 0x03, 0x7e, 0xfd, 0x74, 0x42, 0x83, 0x5e, 0x46, 0x6f,
-    0x4d, 0x29, 0x27, 0x54, 0x87, 0x60, 0x6a, 0x95, 0x30, 0x40, 0x17, 0x67, 0x99, 0x04, 0xa4, 0x4c,
-    0x8f, 0xc9, 0x7e, 0x74, 0x7b, 0xc8, 0x8f, 0x4c, 0x48, 0x8a, 0xca, 0x82, 0x99, 0xc0, 0x17, 0x59,
-    0x81, 0x44, 0x30, 0x5b, 0x7f, 0x4e, 0x82, 0x4b, 0x7c, 0x5a, 0x31, 0x2a, 0x15, 0xb6, 0x0d, 0x26,
-    0x1c, 0x00, 0x00, 0x02, 0x00, 0x43, 0xff, 0xec, 0x03, 0xea, 0x04, 0x8d, 0x00, 0x07, 0x00, 0x26,
-    0x00, 0x1b, 0x40, 0x0c, 0x08, 0x05, 0x05, 0x04, 0x26, 0x26, 0x1d, 0x13, 0x0b, 0x07, 0x00, 0x7d,
-    0x00, 0x3f, 0x32, 0x3f, 0x33, 0x39, 0x2f, 0x33, 0x33, 0x11, 0x33, 0x30, 0x31, 0x53, 0x21, 0x17,
-    0x01, 0x23, 0x35, 0x01, 0x21, 0x01, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x22,
-    0x2e, 0x02, 0x35, 0x33, 0x1e, 0x02, 0x33, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x23,
-    0x6c, 0x03, 0x54, 0x01, 0xfe, 0x64, 0x9d, 0x01, 0x0e, 0xfd, 0xd6, 0x01, 0x1c, 0xb1, 0x6c, 0xa3,
-    0x6c, 0x36, 0x47, 0x82, 0xae, 0x68, 0x51, 0xa1, 0x85, 0x51, 0xf1, 0x03, 0x3a, 0x62, 0x40, 0x4d,
-    0x66, 0x32, 0x35, 0x69, 0x4d, 0x85, 0x04, 0x8d, 0x9a, 0xfe, 0x5c, 0x74, 0x01, 0x0a, 0xfe, 0xe8,
-    0x39, 0x64, 0x7e, 0x46, 0x5a, 0x87, 0x5a, 0x2d, 0x25, 0x51, 0x85, 0x60, 0x35, 0x46, 0x22, 0x2b,
-    0x4f, 0x37, 0x39, 0x4f, 0x2a, 0x00, 0x00, 0x03, 0x00, 0x4e, 0xff, 0xf0, 0x04, 0x6e, 0x04, 0x9d,
-    0x00, 0x15, 0x00, 0x24, 0x00, 0x34, 0x00, 0x1b, 0x40, 0x0e, 0x0b, 0x25, 0x6a, 0x2d, 0x1d, 0x6a,
-    0x2d, 0x2d, 0x0b, 0x00, 0x16, 0x6a, 0x00, 0x0b, 0x00, 0x2f, 0x2f, 0x2b, 0x12, 0x39, 0x2f, 0x2b,
-    0x2b, 0x30, 0x31, 0x41, 0x32, 0x1e, 0x02, 0x15, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02,
-    0x35, 0x35, 0x34, 0x3e, 0x02, 0x17, 0x22, 0x06, 0x06, 0x07, 0x06, 0x06, 0x07, 0x21, 0x26, 0x26,
-    0x27, 0x2e, 0x02, 0x03, 0x32, 0x36, 0x36, 0x37, 0x36, 0x36, 0x37, 0x21, 0x16, 0x16, 0x17, 0x1e,
-    0x03, 0x02, 0x5e, 0x76, 0xc1, 0x8d, 0x4c, 0x4c, 0x8b, 0xc2, 0x75, 0x75, 0xc2, 0x8e, 0x4d, 0x4d,
-    0x8c, 0xc2, 0x75, 0x4d, 0x74, 0x4a, 0x0c, 0x01, 0x01, 0x02, 0x02, 0x36, 0x01, 0x02, 0x01, 0x0c,
-    0x4a, 0x73, 0x4c, 0x4e, 0x73, 0x48, 0x0c, 0x02, 0x01, 0x01, 0xfd, 0xcb, 0x01, 0x02, 0x01, 0x09,
-    0x2f, 0x48, 0x5e, 0x04, 0x9d, 0x4e, 0x96, 0xd2, 0x85, 0x38, 0x85, 0xd2, 0x95, 0x4e, 0x4e, 0x95,
-    0xd2, 0x85, 0x38, 0x85, 0xd2, 0x96, 0x4e, 0xc0, 0x41, 0x7d, 0x5a, 0x08, 0x0f, 0x09, 0x09, 0x12,
-    0x08, 0x59, 0x7b, 0x41, 0xfc, 0xd2, 0x41, 0x7e, 0x59, 0x08, 0x0f, 0x08, 0x08, 0x11, 0x08, 0x42,
-    0x69, 0x46, 0x25, 0x00, 0x00, 0x04, 0x00, 0x3a, 0x00, 0x00, 0x04, 0x1b, 0x04, 0x9d, 0x00, 0x03,
-    0x00, 0x07, 0x00, 0x0b, 0x00, 0x2a, 0x00, 0x21, 0x40, 0x0f, 0x06, 0x07, 0x03, 0x02, 0x02, 0x09,
-    0x26, 0x1d, 0x7e, 0x12, 0x0a, 0x0a, 0x11, 0x09, 0x12, 0x00, 0x3f, 0x33, 0x33, 0x11, 0x33, 0x3f,
-    0x33, 0x12, 0x39, 0x2f, 0x33, 0xce, 0x32, 0x30, 0x31, 0x41, 0x15, 0x21, 0x35, 0x05, 0x15, 0x21,
-    0x35, 0x01, 0x21, 0x35, 0x21, 0x01, 0x17, 0x16, 0x06, 0x06, 0x07, 0x27, 0x3e, 0x03, 0x27, 0x03,
-    0x26, 0x3e, 0x02, 0x33, 0x32, 0x16, 0x16, 0x15, 0x23, 0x34, 0x26, 0x26, 0x23, 0x22, 0x0e, 0x02,
-    0x03, 0x49, 0xfc, 0xf1, 0x03, 0x0f, 0xfc, 0xf1, 0x03, 0xe1, 0xfc, 0x62, 0x03, 0x9e, 0xfd, 0xab,
-    0x0a, 0x04, 0x26, 0x55, 0x42, 0x90, 0x1c, 0x23, 0x13, 0x06, 0x01, 0x09, 0x03, 0x35, 0x6a, 0x97,
-    0x5d, 0x8a, 0xb6, 0x5a, 0xf1, 0x2c, 0x4c, 0x2f, 0x28, 0x3e, 0x29, 0x14, 0x02, 0xbc, 0x91, 0x91,
-    0xeb, 0x8f, 0x8f, 0xfe, 0x2f, 0xc0, 0x02, 0x21, 0xfa, 0x53, 0x93, 0x73, 0x24, 0x56, 0x07, 0x3c,
-    0x55, 0x5e, 0x2a, 0x01, 0x01, 0x6a, 0xa4, 0x72, 0x3c, 0x62, 0xaf, 0x75, 0x49, 0x57, 0x26, 0x21,
-    0x40, 0x5d, 0x00, 0x03, 0x00, 0x45, 0xff, 0xf0, 0x03, 0xae, 0x04, 0x9e, 0x00, 0x23, 0x00, 0x27,
-    0x00, 0x2b, 0x00, 0x1d, 0x40, 0x0d, 0x27, 0x26, 0x26, 0x2a, 0x2b, 0x2b, 0x07, 0x19, 0x12, 0x7e,
-    0x00, 0x07, 0x0b, 0x00, 0x3f, 0x33, 0x3f, 0x33, 0x12, 0x39, 0x2f, 0x33, 0x33, 0x2f, 0x33, 0x30,
-    0x31, 0x65, 0x32, 0x36, 0x37, 0x17, 0x06, 0x06, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x35, 0x34, 0x3e,
-    0x02, 0x33, 0x32, 0x16, 0x17, 0x07, 0x26, 0x26, 0x23, 0x22, 0x0e, 0x02, 0x15, 0x15, 0x14, 0x1e,
-    0x02, 0x13, 0x15, 0x21, 0x35, 0x05, 0x15, 0x21, 0x35, 0x02, 0xcc, 0x3b, 0x5b, 0x33, 0x19, 0x38,
-    0x6c, 0x3e, 0x75, 0xb9, 0x81, 0x44, 0x43, 0x80, 0xb9, 0x75, 0x3f, 0x69, 0x3c, 0x15, 0x34, 0x60,
-    0x3b, 0x43, 0x60, 0x3f, 0x1e, 0x1f, 0x3f, 0x61, 0xc4, 0xfc, 0xf8, 0x03, 0x08, 0xfc, 0xf8, 0xaf,
-    0x0f, 0x0d, 0xbc, 0x0f, 0x10, 0x42, 0x7f, 0xb9, 0x77, 0xc0, 0x79, 0xbe, 0x83, 0x43, 0x10, 0x10,
-    0xbb, 0x10, 0x0c, 0x29, 0x50, 0x76, 0x4d, 0xc2, 0x4c, 0x72, 0x4d, 0x27, 0x02, 0x54, 0x91, 0x91,
-    0xee, 0x90, 0x90, 0x00, 0x00, 0x04, 0x00, 0x76, 0x00, 0x00, 0x07, 0xc2, 0x04, 0x9e, 0x00, 0x03,
-    0x00, 0x15, 0x00, 0x27, 0x00, 0x31, 0x00, 0x29, 0x40, 0x12, 0x2b, 0x30, 0x2e, 0x2d, 0x24, 0x09,
-    0x09, 0x31, 0x2e, 0x7d, 0x2a, 0x2d, 0x0a, 0x1b, 0x12, 0x12, 0x02, 0x03, 0x00, 0x2f, 0x33, 0x33,
-    0x7c, 0x2f, 0x33, 0x18, 0x3f, 0x33, 0x3f, 0x33, 0x33, 0x2f, 0x33, 0x11, 0x12, 0x39, 0x39, 0x30,
-    0x31, 0x41, 0x15, 0x21, 0x35, 0x03, 0x35, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x16, 0x15, 0x15,
-    0x14, 0x06, 0x06, 0x23, 0x22, 0x26, 0x26, 0x37, 0x15, 0x14, 0x16, 0x16, 0x33, 0x32, 0x36, 0x36,
-    0x35, 0x35, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x01, 0x11, 0x23, 0x01, 0x11, 0x23, 0x11,
-    0x33, 0x01, 0x11, 0x07, 0x86, 0xfd, 0xc6, 0x3a, 0x55, 0x99, 0x6a, 0x6a, 0x9a, 0x54, 0x53, 0x9a,
-    0x69, 0x6b, 0x9a, 0x55, 0xa8, 0x26, 0x50, 0x3c, 0x3b, 0x4e, 0x26, 0x27, 0x4e, 0x3c, 0x3b, 0x4f,
-    0x26, 0xfe, 0xad, 0xf2, 0xfd, 0xf2, 0xf1, 0xf1, 0x02, 0x0e, 0x01, 0x61, 0x90, 0x90, 0x01, 0xa5,
-    0x49, 0x62, 0x97, 0x56, 0x56, 0x97, 0x62, 0x49, 0x61, 0x97, 0x56, 0x56, 0x97, 0xaa, 0x49, 0x37,
-    0x58, 0x32, 0x32, 0x58, 0x37, 0x49, 0x37, 0x57, 0x33, 0x33, 0x57, 0x01, 0x07, 0xfb, 0x73, 0x03,
-    0x23, 0xfc, 0xdd, 0x04, 0x8d, 0xfc, 0xdd, 0x03, 0x23, 0x00, 0x00, 0x02, 0x00, 0x28, 0x00, 0x00,
-    0x04, 0xaf, 0x04, 0x8d, 0x00, 0x18, 0x00, 0x1c, 0x00, 0x1b, 0x40, 0x0b, 0x1b, 0x1c, 0x02, 0x01,
-    0x01, 0x0e, 0x0c, 0x0f, 0x7d, 0x0e, 0x0a, 0x00, 0x3f, 0x3f, 0x33, 0x12, 0x39, 0x7c, 0x2f, 0x33,
-    0x18, 0xce, 0x32, 0x30, 0x31, 0x41, 0x21, 0x35, 0x21, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26,
-    0x23, 0x23, 0x11, 0x23, 0x11, 0x21, 0x32, 0x16, 0x16, 0x15, 0x14, 0x0e, 0x02, 0x07, 0x15, 0x21,
-    0x35, 0x02, 0xe8, 0xfd, 0x40, 0x02, 0xc0, 0x49, 0x5f, 0x2e, 0x2e, 0x5f, 0x49, 0xfb, 0xf1, 0x01,
-    0xec, 0x8e, 0xcc, 0x6d, 0x3e, 0x76, 0xa9, 0x51, 0xfd, 0x27, 0x01, 0x9e, 0xb2, 0x37, 0x57, 0x31,
-    0x33, 0x56, 0x35, 0xfc, 0x33, 0x04, 0x8d, 0x61, 0xaa, 0x6d, 0x54, 0x89, 0x64, 0x36, 0x4e, 0xb2,
-    0xb2, 0x00, 0x00, 0x02, 0x00, 0x37, 0xff, 0xf5, 0x02, 0xa9, 0x03, 0x20, 0x00, 0x19, 0x00, 0x33,
-    0x00, 0x19, 0x40, 0x0a, 0x1b, 0x00, 0x00, 0x19, 0x1a, 0x1a, 0x08, 0x10, 0x2c, 0x24, 0x00, 0x2f,
-    0x33, 0xcc, 0x32, 0x39, 0x2f, 0x33, 0x33, 0x11, 0x33, 0x30, 0x31, 0x41, 0x33, 0x32, 0x36, 0x36,
-    0x35, 0x34, 0x26, 0x23, 0x22, 0x06, 0x15, 0x23, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x16, 0x15,
-    0x14, 0x06, 0x06, 0x23, 0x23, 0x15, 0x35, 0x33, 0x32, 0x16, 0x16, 0x15, 0x14, 0x06, 0x06, 0x23,
-    0x22, 0x26, 0x26, 0x35, 0x33, 0x14, 0x16, 0x33, 0x32, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x01,
-    0x0e, 0x57, 0x2b, 0x38, 0x1d, 0x37, 0x40, 0x31, 0x43, 0xb6, 0x50, 0x86, 0x4f, 0x5b, 0x8a, 0x4d,
-    0x47, 0x7d, 0x54, 0x75, 0x75, 0x5d, 0x84, 0x45, 0x54, 0x91, 0x5a, 0x4b, 0x8d, 0x5b, 0xb7, 0x48,
-    0x3d, 0x41, 0x3f, 0x23, 0x40, 0x2b, 0x01, 0xd1, 0x19, 0x2c, 0x1e, 0x24, 0x37, 0x29, 0x25, 0x47,
-    0x64, 0x34, 0x33, 0x64, 0x4a, 0x39, 0x58, 0x31, 0x29, 0x52, 0x2b, 0x58, 0x46, 0x4a, 0x68, 0x36,
-    0x31, 0x6a, 0x56, 0x27, 0x38, 0x39, 0x2b, 0x26, 0x2e, 0x15, 0x00, 0x02, 0x00, 0x36, 0x00, 0x00,
-    0x02, 0xbf, 0x03, 0x15, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x17, 0x40, 0x09, 0x03, 0x07, 0x07, 0x01,
-    0x01, 0x06, 0x05, 0x08, 0x0a, 0x00, 0x2f, 0xcc, 0x32, 0x32, 0x39, 0x2f, 0x33, 0x11, 0x33, 0x30,
-    0x31, 0x41, 0x15, 0x21, 0x27, 0x01, 0x33, 0x07, 0x07, 0x01, 0x11, 0x23, 0x11, 0x02, 0xbf, 0xfd,
-    0x81, 0x0a, 0x01, 0x6f, 0x8f, 0x9d, 0xb0, 0x01, 0x76, 0xb6, 0x01, 0x39, 0x94, 0x76, 0x01, 0xfa,
-    0xfa, 0xe2, 0x01, 0xdc, 0xfc, 0xeb, 0x03, 0x15, 0x00, 0x01, 0x00, 0x50, 0xff, 0xf5, 0x02, 0xad,
-    0x03, 0x15, 0x00, 0x21, 0x00, 0x12, 0xb6, 0x1f, 0x09, 0x09, 0x04, 0x03, 0x19, 0x11, 0x00, 0x2f,
-    0x33, 0xcc, 0x32, 0x39, 0x2f, 0x33, 0x30, 0x31, 0x53, 0x27, 0x13, 0x21, 0x15, 0x21, 0x07, 0x36,
-    0x36, 0x33, 0x32, 0x16, 0x16, 0x15, 0x14, 0x06, 0x06, 0x23, 0x22, 0x26, 0x26, 0x27, 0x33, 0x16,
-    0x16, 0x33, 0x32, 0x36, 0x35, 0x34, 0x26, 0x23, 0x22, 0x06, 0xf4, 0x91, 0x34, 0x01, 0xec, 0xfe,
-    0xa9, 0x16, 0x11, 0x4b, 0x2c, 0x57, 0x78, 0x40, 0x42, 0x85, 0x67, 0x4c, 0x89, 0x57, 0x03, 0xb6,
-    0x02, 0x43, 0x34, 0x44, 0x34, 0x45, 0x42, 0x35, 0x36, 0x01, 0x5d, 0x24, 0x01, 0x94, 0x91, 0x9a,
-    0x06, 0x16, 0x3d, 0x72, 0x51, 0x47, 0x7c, 0x4e, 0x37, 0x68, 0x48, 0x2d, 0x28, 0x4b, 0x35, 0x39,
-    0x46, 0x1c, 0x00, 0x01, 0x00, 0x4e, 0xff, 0xf5, 0x02, 0xb8, 0x03, 0x22, 0x00, 0x2d, 0x00, 0x13,
-    0xb6, 0x13, 0x1c, 0x1c, 0x03, 0x00, 0x0c, 0x24, 0x00, 0x2f, 0x33, 0xcc, 0x32, 0x39, 0x7d, 0x2f,
-    0x33, 0x30, 0x31, 0x41, 0x33, 0x15, 0x23, 0x22, 0x06, 0x06, 0x15, 0x15, 0x14, 0x16, 0x16, 0x33,
-    0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x23, 0x22, 0x06, 0x06, 0x07, 0x27, 0x3e, 0x02, 0x33, 0x32,
-    0x16, 0x16, 0x15, 0x14, 0x06, 0x06, 0x23, 0x22, 0x26, 0x26, 0x35, 0x35, 0x34, 0x3e, 0x02, 0x02,
-    0x16, 0x1d, 0x0b, 0x58, 0x84, 0x48, 0x20, 0x3b, 0x28, 0x25, 0x37, 0x20, 0x42, 0x3c, 0x29, 0x3f,
-    0x24, 0x01, 0x30, 0x01, 0x39, 0x6e, 0x4c, 0x53, 0x70, 0x39, 0x4b, 0x87, 0x5b, 0x5d, 0x8f, 0x51,
-    0x43, 0x7b, 0xa6, 0x03, 0x22, 0x94, 0x2f, 0x6f, 0x61, 0x76, 0x31, 0x42, 0x20, 0x23, 0x39, 0x24,
-    0x39, 0x3e, 0x1e, 0x2c, 0x16, 0x23, 0x2d, 0x5f, 0x41, 0x44, 0x77, 0x4d, 0x4d, 0x7c, 0x47, 0x49,
-    0x8d, 0x68, 0x35, 0x70, 0xa6, 0x6e, 0x36, 0x00, 0x00, 0x01, 0x00, 0x37, 0x00, 0x00, 0x02, 0xad,
-    0x03, 0x15, 0x00, 0x06, 0x00, 0x0c, 0xb3, 0x05, 0x01, 0x06, 0x02, 0x00, 0x2f, 0xcc, 0x32, 0x32,
-    0x30, 0x31, 0x41, 0x15, 0x01, 0x23, 0x01, 0x21, 0x35, 0x02, 0xad, 0xfe, 0xab, 0xc0, 0x01, 0x55,
-    0xfe, 0x4a, 0x03, 0x15, 0x66, 0xfd, 0x51, 0x02, 0x83, 0x92, 0x00, 0x04, 0x00, 0x4b, 0xff, 0xf5,
-    0x02, 0xaa, 0x03, 0x20, 0x00, 0x0f, 0x00, 0x1f, 0x00, 0x2f, 0x00, 0x3d, 0x00, 0x17, 0x40, 0x0a,
-    0x0c, 0x24, 0x3b, 0x03, 0x14, 0x14, 0x34, 0x2c, 0x1c, 0x04, 0x00, 0x2f, 0x33, 0xcc, 0x32, 0x39,
-    0x2f, 0x17, 0x33, 0x30, 0x31, 0x65, 0x14, 0x06, 0x06, 0x23, 0x22, 0x26, 0x26, 0x35, 0x34, 0x36,
-    0x36, 0x33, 0x32, 0x16, 0x16, 0x07, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x15, 0x14, 0x16,
-    0x16, 0x33, 0x32, 0x36, 0x36, 0x13, 0x14, 0x06, 0x06, 0x23, 0x22, 0x26, 0x26, 0x35, 0x34, 0x36,
-    0x36, 0x33, 0x32, 0x16, 0x16, 0x07, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06, 0x15, 0x14, 0x16, 0x16,
-    0x33, 0x32, 0x36, 0x02, 0xaa, 0x4f, 0x89, 0x57, 0x56, 0x8a, 0x50, 0x50, 0x89, 0x56, 0x57, 0x89,
-    0x50, 0xb5, 0x20, 0x37, 0x24, 0x24, 0x36, 0x1e, 0x1e, 0x37, 0x24, 0x24, 0x37, 0x1f, 0xa2, 0x49,
-    0x7f, 0x54, 0x53, 0x81, 0x49, 0x49, 0x81, 0x52, 0x53, 0x81, 0x49, 0xb7, 0x17, 0x2e, 0x21, 0x30,
-    0x36, 0x18, 0x2f, 0x20, 0x31, 0x34, 0xd9, 0x4c, 0x65, 0x33, 0x33, 0x65, 0x4c, 0x46, 0x62, 0x36,
-    0x36, 0x62, 0x36, 0x1f, 0x2b, 0x17, 0x17, 0x2b, 0x1f, 0x1e, 0x2d, 0x17, 0x17, 0x2d, 0x01, 0x77,
-    0x3f, 0x5d, 0x33, 0x33, 0x5d, 0x3f, 0x49, 0x62, 0x33, 0x33, 0x62, 0x55, 0x1c, 0x27, 0x16, 0x2f,
-    0x2a, 0x1a, 0x29, 0x17, 0x32, 0x00, 0x00, 0x01, 0x00, 0x47, 0xff, 0xf6, 0x02, 0xa3, 0x03, 0x20,
-    0x00, 0x2e, 0x00, 0x13, 0xb6, 0x12, 0x1b, 0x1b, 0x0a, 0x23, 0x01, 0x2d, 0x00, 0x2f, 0x33, 0xcc,
-    0x32, 0x39, 0x7c, 0x2f, 0x33, 0x30, 0x31, 0x77, 0x33, 0x32, 0x36, 0x36, 0x35, 0x35, 0x34, 0x26,
-    0x26, 0x23, 0x22, 0x06, 0x06, 0x15, 0x14, 0x16, 0x16, 0x33, 0x32, 0x36, 0x36, 0x35, 0x17, 0x14,
-    0x06, 0x06, 0x23, 0x22, 0x26, 0x26, 0x35, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x16, 0x15, 0x15,
-    0x14, 0x0e, 0x02, 0x23, 0x23, 0xd5, 0x0d, 0x59, 0x76, 0x3c, 0x1f, 0x35, 0x25, 0x25, 0x36, 0x1d,
-    0x1c, 0x39, 0x29, 0x29, 0x39, 0x1e, 0x37, 0x3e, 0x68, 0x3f, 0x52, 0x76, 0x3d, 0x4b, 0x88, 0x5a,
-    0x59, 0x88, 0x4e, 0x3e, 0x74, 0xa5, 0x68, 0x0f, 0x87, 0x29, 0x63, 0x56, 0x98, 0x31, 0x3e, 0x1e,
-    0x26, 0x3f, 0x26, 0x25, 0x39, 0x20, 0x1e, 0x2b, 0x13, 0x1f, 0x32, 0x5a, 0x39, 0x3f, 0x76, 0x52,
-    0x4e, 0x81, 0x4d, 0x47, 0x90, 0x6c, 0x35, 0x73, 0xa4, 0x69, 0x32, 0x00, 0x00, 0x01, 0x00, 0x8d,
-    0x02, 0x8b, 0x03, 0x2d, 0x03, 0x31, 0x00, 0x03, 0x00, 0x08, 0xb1, 0x03, 0x02, 0x00, 0x2f, 0x33,
-    0x30, 0x31, 0x41, 0x15, 0x21, 0x35, 0x03, 0x2d, 0xfd, 0x60, 0x03, 0x31, 0xa6, 0xa6, 0x00, 0x03,
-    0x00, 0x98, 0x04, 0x4d, 0x02, 0xa6, 0x06, 0x9a, 0x00, 0x03, 0x00, 0x0f, 0x00, 0x1b, 0x00, 0x19,
-    0x40, 0x09, 0x13, 0x0d, 0x0d, 0x07, 0x01, 0x03, 0x03, 0x19, 0x07, 0x00, 0x2f, 0x33, 0x33, 0x7c,
-    0x2f, 0x18, 0xcd, 0x11, 0x33, 0x11, 0x33, 0x30, 0x31, 0x41, 0x37, 0x33, 0x07, 0x05, 0x34, 0x36,
-    0x33, 0x32, 0x16, 0x15, 0x14, 0x06, 0x23, 0x22, 0x26, 0x37, 0x14, 0x16, 0x33, 0x32, 0x36, 0x35,
-    0x34, 0x26, 0x23, 0x22, 0x06, 0x01, 0x19, 0xaa, 0xe3, 0xf7, 0xfe, 0xe9, 0x6e, 0x4e, 0x4d, 0x6b,
-    0x6b, 0x4d, 0x4e, 0x6e, 0x63, 0x34, 0x25, 0x24, 0x31, 0x31, 0x24, 0x25, 0x34, 0x05, 0xd7, 0xc3,
-    0xc3, 0xdd, 0x4d, 0x64, 0x64, 0x4d, 0x4c, 0x61, 0x61, 0x4c, 0x25, 0x31, 0x31, 0x25, 0x27, 0x33,
-    0x33, 0x00, 0x00, 0x04, 0x00, 0x76, 0x00, 0x00, 0x03, 0xb6, 0x04, 0x8d, 0x00, 0x03, 0x00, 0x07,
-    0x00, 0x0b, 0x00, 0x0f, 0x00, 0x1b, 0x40, 0x0c, 0x0b, 0x0a, 0x0a, 0x06, 0x0f, 0x0e, 0x07, 0x7d,
-    0x03, 0x02, 0x06, 0x0a, 0x00, 0x3f, 0x33, 0x33, 0x3f, 0x33, 0x33, 0x12, 0x39, 0x2f, 0x33, 0x30,
-    0x31, 0x65, 0x15, 0x21, 0x35, 0x13, 0x11, 0x23, 0x11, 0x01, 0x15, 0x21, 0x35, 0x01, 0x15, 0x21,
-    0x35, 0x03, 0xb6, 0xfd, 0x65, 0x4c, 0xf1, 0x02, 0xea, 0xfd, 0xbb, 0x02, 0x99, 0xfd, 0x67, 0xbf,
-    0xbf, 0xbf, 0x03, 0xce, 0xfb, 0x73, 0x04, 0x8d, 0xfe, 0x2d, 0xbf, 0xbf, 0x01, 0xd3, 0xc0, 0xc0,
-    0x00, 0x04, 0x00, 0x0c, 0xfe, 0x4a, 0x04, 0x18, 0x04, 0x4e, 0x00, 0x12, 0x00, 0x24, 0x00, 0x5b,
-    0x00, 0x5f, 0x00, 0x33, 0x40, 0x1a, 0x5d, 0x5f, 0x06, 0x72, 0x25, 0x26, 0x18, 0x18, 0x0f, 0x40,
-    0x41, 0x41, 0x2e, 0x53, 0x53, 0x0f, 0x0f, 0x05, 0x4a, 0x37, 0x0f, 0x72, 0x21, 0x05, 0x07, 0x72,
-    0x00, 0x2b, 0x32, 0x2b, 0x32, 0x11, 0x39, 0x2f, 0x39, 0x11, 0x33, 0x33, 0x11, 0x33, 0x11, 0x33,
-    0x12, 0x39, 0x39, 0x2b, 0x32, 0x30, 0x31, 0x53, 0x35, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x16,
-    0x15, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x26, 0x26, 0x37, 0x15, 0x14, 0x16, 0x16, 0x33, 0x32,
-    0x36, 0x36, 0x35, 0x35, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x13, 0x17, 0x06, 0x06, 0x15,
-    0x14, 0x16, 0x16, 0x33, 0x33, 0x32, 0x16, 0x16, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02,
-    0x35, 0x34, 0x36, 0x36, 0x37, 0x17, 0x0e, 0x02, 0x15, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x3e, 0x02,
-    0x35, 0x34, 0x26, 0x26, 0x23, 0x23, 0x22, 0x26, 0x26, 0x35, 0x34, 0x36, 0x36, 0x01, 0x17, 0x21,
-    0x27, 0x46, 0x72, 0xcb, 0x86, 0x88, 0xcb, 0x70, 0x40, 0x77, 0xa5, 0x65, 0x87, 0xcc, 0x72, 0xf0,
-    0x34, 0x5f, 0x42, 0x40, 0x5e, 0x33, 0x34, 0x5f, 0x40, 0x40, 0x5f, 0x34, 0x1c, 0x5a, 0x1b, 0x40,
-    0x22, 0x3a, 0x23, 0xb3, 0x7e, 0xb1, 0x5e, 0x48, 0x8d, 0xca, 0x83, 0x75, 0xb4, 0x7b, 0x3e, 0x5f,
-    0x8c, 0x45, 0x39, 0x22, 0x3b, 0x24, 0x1e, 0x3e, 0x5d, 0x41, 0x4d, 0x73, 0x4c, 0x26, 0x21, 0x4f,
-    0x45, 0xc8, 0x49, 0x7a, 0x4b, 0x3f, 0x58, 0x02, 0xea, 0x02, 0xfe, 0x80, 0x0b, 0x02, 0xce, 0x16,
-    0x6a, 0xa4, 0x5c, 0x5c, 0xa4, 0x6a, 0x16, 0x4b, 0x84, 0x64, 0x38, 0x62, 0xa4, 0x7b, 0x16, 0x2e,
-    0x52, 0x33, 0x33, 0x52, 0x2e, 0x16, 0x31, 0x50, 0x31, 0x31, 0x50, 0xfe, 0xb4, 0x32, 0x0e, 0x36,
-    0x31, 0x1f, 0x22, 0x0e, 0x42, 0x85, 0x63, 0x3b, 0x7c, 0x68, 0x40, 0x2c, 0x4e, 0x64, 0x37, 0x56,
-    0x7a, 0x49, 0x0d, 0x56, 0x05, 0x2c, 0x42, 0x29, 0x1d, 0x35, 0x28, 0x18, 0x1e, 0x30, 0x38, 0x1b,
-    0x23, 0x37, 0x20, 0x27, 0x54, 0x43, 0x43, 0x5c, 0x3d, 0x02, 0x84, 0x95, 0x95, 0x00, 0x00, 0x04,
-    0x00, 0x56, 0xff, 0xeb, 0x04, 0x5a, 0x04, 0x4e, 0x00, 0x15, 0x00, 0x2b, 0x00, 0x2f, 0x00, 0x33,
-    0x00, 0x17, 0x40, 0x0c, 0x30, 0x0a, 0x2d, 0x06, 0x1c, 0x11, 0x0b, 0x72, 0x27, 0x06, 0x07, 0x72,
-    0x00, 0x2b, 0x32, 0x2b, 0x32, 0x3f, 0x3f, 0x30, 0x31, 0x53, 0x35, 0x34, 0x3e, 0x02, 0x33, 0x32,
-    0x1e, 0x02, 0x17, 0x15, 0x0e, 0x03, 0x23, 0x22, 0x2e, 0x02, 0x37, 0x15, 0x14, 0x1e, 0x02, 0x33,
-    0x32, 0x3e, 0x02, 0x37, 0x35, 0x2e, 0x03, 0x23, 0x22, 0x0e, 0x02, 0x05, 0x13, 0x33, 0x0b, 0x02,
-    0x33, 0x13, 0x56, 0x38, 0x6d, 0xa1, 0x69, 0x66, 0x95, 0x67, 0x3e, 0x0d, 0x0d, 0x3d, 0x68, 0x96,
-    0x67, 0x67, 0xa0, 0x6e, 0x38, 0xf2, 0x1a, 0x38, 0x5c, 0x41, 0x3a, 0x54, 0x3a, 0x22, 0x08, 0x06,
-    0x21, 0x3a, 0x55, 0x3a, 0x41, 0x5c, 0x3a, 0x1a, 0x01, 0xe3, 0x4d, 0xdb, 0x6b, 0x69, 0x54, 0xbd,
-    0x72, 0x01, 0xfb, 0x15, 0x7e, 0xd2, 0x9a, 0x54, 0x4f, 0x8f, 0xc6, 0x78, 0x38, 0x75, 0xc0, 0x8d,
-    0x4d, 0x4e, 0x8e, 0xc1, 0x88, 0x15, 0x47, 0x7a, 0x5c, 0x33, 0x37, 0x5f, 0x78, 0x42, 0x34, 0x44,
-    0x7d, 0x64, 0x3a, 0x3c, 0x69, 0x8b, 0x42, 0x02, 0x1e, 0xfd, 0xe2, 0xfd, 0xe4, 0x02, 0x1c, 0xfd,
-    0xe4, 0x00, 0x00, 0x02, 0x00, 0x99, 0x00, 0x00, 0x04, 0xf0, 0x05, 0xb0, 0x00, 0x19, 0x00, 0x2e,
-    0x00, 0x1f, 0x40, 0x0f, 0x26, 0x08, 0x1b, 0x1a, 0x1a, 0x02, 0x01, 0x01, 0x0e, 0x0c, 0x0f, 0x02,
-    0x72, 0x0e, 0x08, 0x00, 0x3f, 0x2b, 0x32, 0x12, 0x39, 0x2f, 0x33, 0x33, 0x11, 0x33, 0x3f, 0x30,
-    0x31, 0x41, 0x21, 0x27, 0x21, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x21, 0x11, 0x23,
-    0x11, 0x21, 0x32, 0x16, 0x16, 0x15, 0x14, 0x06, 0x06, 0x0f, 0x02, 0x37, 0x1e, 0x02, 0x15, 0x15,
-    0x14, 0x16, 0x16, 0x17, 0x15, 0x21, 0x2e, 0x02, 0x35, 0x35, 0x34, 0x26, 0x26, 0x02, 0xe2, 0xfe,
-    0x64, 0x01, 0x01, 0x63, 0x61, 0x79, 0x39, 0x36, 0x73, 0x5c, 0xfe, 0xdd, 0xfa, 0x02, 0x28, 0xa3,
-    0xe0, 0x72, 0x58, 0xa4, 0x71, 0x16, 0x73, 0x31, 0xab, 0xbf, 0x4e, 0x0c, 0x1f, 0x1c, 0xfe, 0xff,
-    0x1e, 0x1b, 0x07, 0x36, 0x6b, 0x02, 0x58, 0xc6, 0x35, 0x64, 0x48, 0x46, 0x6a, 0x39, 0xfb, 0x18,
-    0x05, 0xb0, 0x62, 0xbb, 0x88, 0x61, 0x90, 0x60, 0x1c, 0x2f, 0x17, 0x85, 0x01, 0x61, 0xa7, 0x6d,
-    0x74, 0x21, 0x53, 0x4c, 0x18, 0x1b, 0x1a, 0x62, 0x61, 0x18, 0x70, 0x4c, 0x6d, 0x3a, 0x00, 0x03,
-    0x00, 0x99, 0x00, 0x00, 0x05, 0x2c, 0x05, 0xb0, 0x00, 0x03, 0x00, 0x09, 0x00, 0x0d, 0x00, 0x20,
-    0x40, 0x10, 0x0a, 0x08, 0x09, 0x02, 0x0c, 0x0b, 0x0b, 0x07, 0x06, 0x06, 0x02, 0x03, 0x02, 0x72,
-    0x02, 0x08, 0x00, 0x3f, 0x2b, 0x12, 0x39, 0x2f, 0x33, 0x33, 0x11, 0x33, 0x3f, 0x3f, 0x30, 0x31,
-    0x41, 0x11, 0x23, 0x11, 0x21, 0x01, 0x21, 0x27, 0x33, 0x01, 0x13, 0x01, 0x37, 0x01, 0x01, 0x93,
-    0xfa, 0x04, 0x66, 0xfd, 0xb0, 0xfe, 0x9d, 0x22, 0xfa, 0x01, 0xa8, 0x33, 0xfe, 0x29, 0xa2, 0x02,
-    0x62, 0x05, 0xb0, 0xfa, 0x50, 0x05, 0xb0, 0xfc, 0xc2, 0xda, 0x02, 0x64, 0xfa, 0x50, 0x02, 0x98,
-    0xc1, 0xfc, 0xa7, 0x00, 0x00, 0x03, 0x00, 0x81, 0x00, 0x00, 0x04, 0x33, 0x06, 0x00, 0x00, 0x03,
-    0x00, 0x09, 0x00, 0x0d, 0x00, 0x1c, 0x40, 0x0e, 0x0b, 0x07, 0x06, 0x06, 0x02, 0x09, 0x06, 0x72,
-    0x03, 0x00, 0x72, 0x0a, 0x02, 0x0a, 0x00, 0x3f, 0x33, 0x2b, 0x2b, 0x12, 0x39, 0x2f, 0x33, 0x33,
-    0x30, 0x31, 0x41, 0x11, 0x23, 0x11, 0x01, 0x01, 0x21, 0x27, 0x33, 0x01, 0x13, 0x01, 0x37, 0x01,
-    0x01, 0x71, 0xf0, 0x03, 0x87, 0xfe, 0x46, 0xfe, 0xdc, 0x45, 0xf1, 0x01, 0x18, 0x2d, 0xfe, 0xae,
-    0x9d, 0x01, 0xcd, 0x06, 0x00, 0xfa, 0x00, 0x06, 0x00, 0xfe, 0x3a, 0xfd, 0xa1, 0xbf, 0x01, 0xa0,
-    0xfb, 0xc6, 0x01, 0xfa, 0xaa, 0xfd, 0x5c, 0x00, 0x00, 0x03, 0x00, 0x99, 0x00, 0x00, 0x05, 0x0b,
-    0x05, 0xb0, 0x00, 0x03, 0x00, 0x09, 0x00, 0x0d, 0x00, 0x1a, 0x40, 0x0e, 0x06, 0x0b, 0x07, 0x08,
-    0x0c, 0x05, 0x02, 0x09, 0x03, 0x02, 0x72, 0x0a, 0x02, 0x08, 0x00, 0x3f, 0x33, 0x2b, 0x32, 0x12,
-    0x17, 0x39, 0x30, 0x31, 0x41, 0x11, 0x23, 0x11, 0x21, 0x01, 0x21, 0x27, 0x33, 0x01, 0x13, 0x01,
-    0x37, 0x01, 0x01, 0x93, 0xfa, 0x04, 0x4f, 0xfd, 0x7d, 0xfe, 0xce, 0x0a, 0x6f, 0x02, 0x18, 0x23,
-    0xfd, 0x8e, 0xe2, 0x02, 0xc8, 0x05, 0xb0, 0xfa, 0x50, 0x05, 0xb0, 0xfd, 0x06, 0x76, 0x02, 0x84,
-    0xfa, 0x50, 0x02, 0xd8, 0x66, 0xfc, 0xc2, 0x00, 0x00, 0x03, 0x00, 0x81, 0x00, 0x00, 0x04, 0x1f,
-    0x06, 0x18, 0x00, 0x03, 0x00, 0x09, 0x00, 0x0d, 0x00, 0x20, 0x40, 0x10, 0x0c, 0x0b, 0x0b, 0x07,
-    0x06, 0x06, 0x02, 0x09, 0x06, 0x72, 0x03, 0x01, 0x72, 0x0a, 0x02, 0x0a, 0x00, 0x3f, 0x33, 0x2b,
-    0x2b, 0x12, 0x39, 0x2f, 0x33, 0x33, 0x11, 0x33, 0x30, 0x31, 0x41, 0x11, 0x23, 0x11, 0x01, 0x01,
-    0x21, 0x27, 0x33, 0x01, 0x13, 0x01, 0x37, 0x01, 0x01, 0x71, 0xf0, 0x03, 0x73, 0xfe, 0x12, 0xfe,
-    0xfb, 0x1c, 0x8d, 0x01, 0x5d, 0x2d, 0xfe, 0x51, 0xb6, 0x02, 0x1c, 0x06, 0x18, 0xf9, 0xe8, 0x06,
-    0x18, 0xfe, 0x22, 0xfd, 0xc1, 0x9e, 0x01, 0xa1, 0xfb, 0xc6, 0x02, 0x17, 0x80, 0xfd, 0x69, 0x00,
-    0x00, 0x02, 0x00, 0x76, 0x00, 0x00, 0x04, 0x2b, 0x04, 0x8d, 0x00, 0x19, 0x00, 0x1d, 0x00, 0x16,
-    0x40, 0x09, 0x1b, 0x1a, 0x0f, 0x02, 0x01, 0x0e, 0x0f, 0x7d, 0x01, 0x00, 0x2f, 0x3f, 0x33, 0x11,
-    0x33, 0x11, 0x33, 0x32, 0x30, 0x31, 0x61, 0x21, 0x37, 0x21, 0x32, 0x36, 0x36, 0x35, 0x35, 0x34,
-    0x2e, 0x02, 0x23, 0x21, 0x35, 0x21, 0x32, 0x1e, 0x02, 0x15, 0x15, 0x14, 0x06, 0x04, 0x01, 0x11,
-    0x23, 0x11, 0x01, 0xef, 0xfe, 0xf0, 0x02, 0x01, 0x0e, 0x73, 0x92, 0x45, 0x27, 0x50, 0x7b, 0x54,
-    0xfe, 0xe7, 0x01, 0x19, 0x7d, 0xd1, 0x97, 0x53, 0x91, 0xfe, 0xff, 0xfe, 0xce, 0xf1, 0xbf, 0x55,
-    0xa2, 0x74, 0x3a, 0x57, 0x87, 0x5c, 0x2f, 0xc0, 0x50, 0x93, 0xcc, 0x7c, 0x38, 0xa5, 0xfa, 0x8b,
-    0x04, 0x8d, 0xfb, 0x73, 0x04, 0x8d, 0x00, 0x01, 0x00, 0x4f, 0xff, 0xf0, 0x04, 0x43, 0x04, 0x9d,
-    0x00, 0x27, 0x00, 0x11, 0xb6, 0x19, 0x15, 0x10, 0x7e, 0x24, 0x00, 0x05, 0x00, 0x2f, 0xcc, 0x33,
-    0x3f, 0xcc, 0x33, 0x30, 0x31, 0x41, 0x33, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x35, 0x34,
-    0x3e, 0x02, 0x33, 0x32, 0x16, 0x16, 0x17, 0x23, 0x2e, 0x02, 0x23, 0x22, 0x0e, 0x02, 0x15, 0x15,
-    0x14, 0x1e, 0x02, 0x33, 0x32, 0x36, 0x36, 0x03, 0x50, 0xf2, 0x09, 0x79, 0xd8, 0x99, 0x77, 0xbd,
-    0x85, 0x47, 0x48, 0x88, 0xbd, 0x76, 0x9b, 0xd4, 0x76, 0x0c, 0xf1, 0x06, 0x36, 0x6c, 0x58, 0x44,
-    0x66, 0x45, 0x23, 0x1f, 0x42, 0x67, 0x47, 0x55, 0x6c, 0x3a, 0x01, 0x84, 0x77, 0xb6, 0x67, 0x4e,
-    0x91, 0xcf, 0x81, 0x4e, 0x81, 0xcf, 0x93, 0x4d, 0x69, 0xba, 0x78, 0x41, 0x63, 0x38, 0x2f, 0x5e,
-    0x89, 0x5a, 0x4f, 0x58, 0x89, 0x5e, 0x31, 0x2f, 0x60, 0x00, 0x00, 0x02, 0x00, 0x76, 0x00, 0x00,
-    0x04, 0x0c, 0x04, 0x8d, 0x00, 0x19, 0x00, 0x31, 0x00, 0x28, 0x40, 0x13, 0x1c, 0x1b, 0x29, 0x19,
-    0x02, 0x02, 0x01, 0x1b, 0x26, 0x01, 0x01, 0x26, 0x1b, 0x03, 0x0d, 0x0c, 0x0f, 0x7d, 0x0d, 0x00,
-    0x2f, 0x3f, 0x33, 0x12, 0x17, 0x39, 0x2f, 0x2f, 0x2f, 0x11, 0x33, 0x12, 0x39, 0x39, 0x11, 0x33,
-    0x30, 0x31, 0x41, 0x21, 0x27, 0x21, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x23, 0x11,
-    0x23, 0x11, 0x21, 0x32, 0x1e, 0x02, 0x15, 0x14, 0x06, 0x06, 0x07, 0x03, 0x21, 0x37, 0x21, 0x32,
-    0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x23, 0x37, 0x21, 0x17, 0x36, 0x16, 0x16, 0x15, 0x14,
-    0x0e, 0x02, 0x02, 0x58, 0xfe, 0xbe, 0x02, 0x01, 0x1f, 0x41, 0x5a, 0x2f, 0x2e, 0x5c, 0x44, 0xc8,
-    0xf1, 0x01, 0xac, 0x6c, 0xa9, 0x78, 0x3f, 0x47, 0x92, 0x74, 0x54, 0xfe, 0x85, 0x62, 0x01, 0x19,
-    0x46, 0x5b, 0x2c, 0x27, 0x56, 0x45, 0xf6, 0x01, 0x01, 0x38, 0x37, 0x6f, 0x8a, 0x41, 0x3c, 0x72,
-    0xa6, 0x01, 0xfd, 0xa6, 0x22, 0x41, 0x2f, 0x35, 0x44, 0x1f, 0xfc, 0x33, 0x04, 0x8d, 0x27, 0x4e,
-    0x79, 0x52, 0x47, 0x7a, 0x4c, 0x04, 0xfd, 0xc4, 0xbf, 0x28, 0x45, 0x2d, 0x32, 0x49, 0x29, 0xa6,
-    0x41, 0x02, 0x51, 0x80, 0x45, 0x55, 0x7d, 0x53, 0x29, 0x00, 0x00, 0x03, 0x00, 0x08, 0x00, 0x00,
-    0x04, 0x91, 0x04, 0x8d, 0x00, 0x04, 0x00, 0x09, 0x00, 0x0d, 0x00, 0x1c, 0x40, 0x0c, 0x0d, 0x00,
-    0x06, 0x03, 0x0c, 0x0c, 0x01, 0x07, 0x03, 0x7d, 0x05, 0x01, 0x00, 0x2f, 0x33, 0x3f, 0x33, 0x12,
-    0x39, 0x2f, 0x12, 0x39, 0x39, 0x33, 0x30, 0x31, 0x41, 0x01, 0x23, 0x01, 0x33, 0x01, 0x01, 0x27,
-    0x33, 0x01, 0x01, 0x15, 0x21, 0x35, 0x02, 0x5a, 0xfe, 0xa2, 0xf4, 0x01, 0xd5, 0xa2, 0x01, 0x1e,
-    0xfe, 0xa0, 0x25, 0xa5, 0x01, 0xd4, 0xfe, 0xfd, 0xfd, 0x66, 0x03, 0x9e, 0xfc, 0x62, 0x04, 0x8d,
-    0xfb, 0x73, 0x03, 0xa0, 0xed, 0xfb, 0x73, 0x01, 0xb0, 0xb5, 0xb5, 0x00, 0x00, 0x01, 0x00, 0x90,
-    0x04, 0x6d, 0x01, 0x9e, 0x06, 0x29, 0x00, 0x0a, 0x00, 0x0a, 0xb2, 0x05, 0x80, 0x00, 0x00, 0x2f,
-    0x1a, 0xcd, 0x30, 0x31, 0x53, 0x35, 0x34, 0x36, 0x36, 0x37, 0x17, 0x06, 0x06, 0x15, 0x07, 0x90,
-    0x28, 0x41, 0x24, 0x81, 0x1c, 0x24, 0x01, 0x04, 0x6d, 0x85, 0x40, 0x79, 0x62, 0x1c, 0x50, 0x35,
-    0x75, 0x48, 0x7a, 0x00, 0x00, 0x02, 0x00, 0x75, 0x04, 0xd4, 0x03, 0x03, 0x06, 0x7c, 0x00, 0x0f,
-    0x00, 0x13, 0x00, 0x12, 0xb5, 0x12, 0x13, 0x0a, 0x00, 0x0d, 0x05, 0x00, 0x2f, 0x33, 0x7c, 0xdc,
-    0x32, 0xd6, 0x18, 0xcd, 0x30, 0x31, 0x41, 0x33, 0x14, 0x06, 0x06, 0x23, 0x22, 0x26, 0x26, 0x35,
-    0x33, 0x14, 0x16, 0x33, 0x32, 0x36, 0x27, 0x27, 0x33, 0x17, 0x02, 0x56, 0xad, 0x4f, 0x93, 0x64,
-    0x65, 0x93, 0x50, 0xac, 0x46, 0x56, 0x53, 0x46, 0xc9, 0xaa, 0xb3, 0x77, 0x05, 0xb1, 0x41, 0x63,
-    0x39, 0x39, 0x63, 0x41, 0x2d, 0x45, 0x45, 0x37, 0xc1, 0xc1, 0x00, 0x02, 0xfc, 0x9e, 0x04, 0xbc,
-    0xfe, 0xd8, 0x06, 0x89, 0x00, 0x17, 0x00, 0x1b, 0x00, 0x1d, 0x40, 0x0c, 0x00, 0x15, 0x15, 0x05,
-    0x19, 0x1b, 0x1b, 0x09, 0x11, 0x11, 0x0c, 0x05, 0x00, 0x2f, 0x33, 0x33, 0x11, 0x33, 0x33, 0x2f,
-    0x33, 0x11, 0x33, 0x11, 0x33, 0x30, 0x31, 0x41, 0x17, 0x14, 0x06, 0x06, 0x23, 0x22, 0x26, 0x26,
-    0x23, 0x22, 0x06, 0x15, 0x27, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x16, 0x33, 0x32, 0x36, 0x25,
-    0x37, 0x33, 0x07, 0xfe, 0x71, 0x67, 0x2a, 0x4a, 0x30, 0x36, 0x45, 0x3e, 0x2b, 0x1f, 0x2b, 0x68,
-    0x2a, 0x4a, 0x30, 0x2d, 0x48, 0x46, 0x29, 0x1e, 0x2d, 0xfe, 0xf7, 0x81, 0xbe, 0xb4, 0x05, 0x9d,
-    0x1d, 0x30, 0x52, 0x32, 0x24, 0x24, 0x32, 0x26, 0x1c, 0x30, 0x52, 0x33, 0x24, 0x23, 0x32, 0x3f,
-    0xd2, 0xd2, 0x00, 0x02, 0x00, 0x7a, 0x04, 0xe7, 0x04, 0x7b, 0x06, 0x8a, 0x00, 0x06, 0x00, 0x0a,
-    0x00, 0x14, 0xb7, 0x08, 0x07, 0x07, 0x05, 0x01, 0x80, 0x04, 0x06, 0x00, 0x2f, 0x33, 0x1a, 0xcd,
-    0x39, 0x33, 0x2f, 0xcd, 0x30, 0x31, 0x53, 0x25, 0x33, 0x05, 0x23, 0x27, 0x07, 0x25, 0x13, 0x33,
-    0x03, 0x7a, 0x01, 0x1e, 0x9d, 0x01, 0x1f, 0xcd, 0xa1, 0xa0, 0x01, 0xc4, 0x9a, 0xd7, 0xd7, 0x04,
-    0xe7, 0xf6, 0xf6, 0x8e, 0x8e, 0x9b, 0x01, 0x08, 0xfe, 0xf8, 0x00, 0x02, 0xff, 0x51, 0x04, 0xdb,
-    0x03, 0x53, 0x06, 0x7f, 0x00, 0x06, 0x00, 0x0a, 0x00, 0x17, 0x40, 0x09, 0x07, 0x40, 0x08, 0x08,
-    0x03, 0x06, 0x80, 0x02, 0x04, 0x00, 0x2f, 0x33, 0x1a, 0xcd, 0x39, 0x33, 0x2f, 0x1a, 0xcd, 0x30,
-    0x31, 0x41, 0x05, 0x23, 0x27, 0x07, 0x23, 0x25, 0x25, 0x13, 0x23, 0x03, 0x02, 0x34, 0x01, 0x1f,
-    0xcd, 0xa0, 0xa0, 0xcd, 0x01, 0x1e, 0xfe, 0x91, 0x9a, 0x99, 0xd8, 0x05, 0xd1, 0xf6, 0x8f, 0x8f,
-    0xf6, 0xae, 0xfe, 0xf8, 0x01, 0x08, 0x00, 0x02, 0x00, 0x79, 0x04, 0xe8, 0x04, 0x06, 0x06, 0xc8,
-    0x00, 0x06, 0x00, 0x1a, 0x00, 0x1f, 0x40, 0x0d, 0x11, 0x12, 0x08, 0x40, 0x1a, 0x09, 0x08, 0x08,
-    0x03, 0x06, 0x80, 0x02, 0x04, 0x00, 0x2f, 0x33, 0x1a, 0xcd, 0x39, 0x33, 0x11, 0x33, 0x33, 0x1a,
-    0x10, 0xcc, 0x32, 0x30, 0x31, 0x41, 0x05, 0x23, 0x27, 0x07, 0x23, 0x25, 0x05, 0x23, 0x27, 0x3e,
-    0x02, 0x35, 0x34, 0x26, 0x26, 0x23, 0x37, 0x32, 0x1e, 0x02, 0x15, 0x14, 0x06, 0x07, 0x02, 0x3e,
-    0x01, 0x15, 0xbe, 0xaf, 0xb0, 0xbd, 0x01, 0x14, 0x01, 0xf6, 0x88, 0x08, 0x2b, 0x35, 0x19, 0x23,
-    0x3b, 0x25, 0x07, 0x44, 0x67, 0x47, 0x24, 0x52, 0x31, 0x05, 0xdf, 0xf7, 0xa0, 0xa0, 0xf7, 0x72,
-    0x7a, 0x03, 0x0c, 0x18, 0x13, 0x19, 0x1b, 0x0c, 0x67, 0x17, 0x2b, 0x3b, 0x26, 0x3e, 0x3a, 0x07,
-    0x00, 0x02, 0x00, 0x79, 0x04, 0xe8, 0x03, 0x53, 0x06, 0xcd, 0x00, 0x06, 0x00, 0x1e, 0x00, 0x25,
-    0x40, 0x10, 0x08, 0x07, 0x07, 0x10, 0x18, 0x0c, 0x40, 0x14, 0x13, 0x13, 0x1c, 0x0c, 0x0c, 0x06,
-    0x80, 0x04, 0x00, 0x2f, 0x1a, 0xcd, 0x32, 0x11, 0x33, 0x33, 0x11, 0x33, 0x1a, 0x10, 0xcd, 0x32,
-    0x32, 0x11, 0x33, 0x30, 0x31, 0x41, 0x05, 0x23, 0x27, 0x07, 0x23, 0x25, 0x37, 0x17, 0x14, 0x06,
-    0x06, 0x23, 0x22, 0x26, 0x26, 0x23, 0x22, 0x06, 0x15, 0x27, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16,
-    0x16, 0x33, 0x32, 0x36, 0x02, 0x2e, 0x01, 0x25, 0xbe, 0xaf, 0xb0, 0xbd, 0x01, 0x25, 0xf1, 0x5a,
-    0x25, 0x42, 0x2a, 0x30, 0x40, 0x3a, 0x27, 0x1b, 0x27, 0x5a, 0x25, 0x42, 0x2a, 0x28, 0x42, 0x42,
-    0x25, 0x1a, 0x28, 0x05, 0xd2, 0xea, 0x8f, 0x8f, 0xea, 0xfb, 0x1e, 0x27, 0x48, 0x2d, 0x22, 0x22,
-    0x2c, 0x1d, 0x18, 0x28, 0x48, 0x2f, 0x22, 0x21, 0x2e, 0x00, 0x00, 0x03, 0x00, 0x76, 0x00, 0x00,
-    0x03, 0x99, 0x05, 0xc4, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x1b, 0x40, 0x0c, 0x02, 0x0a,
-    0x0a, 0x0b, 0x0b, 0x07, 0x03, 0x03, 0x07, 0x7d, 0x06, 0x0a, 0x00, 0x3f, 0x3f, 0x33, 0x2f, 0x11,
-    0x33, 0x11, 0x33, 0x11, 0x33, 0x30, 0x31, 0x41, 0x11, 0x23, 0x11, 0x01, 0x11, 0x23, 0x11, 0x21,
-    0x15, 0x21, 0x35, 0x03, 0x99, 0xf1, 0xfe, 0xbf, 0xf1, 0x03, 0x23, 0xfd, 0x8a, 0x05, 0xc4, 0xfe,
-    0x09, 0x01, 0xf7, 0xfe, 0xc9, 0xfb, 0x73, 0x04, 0x8d, 0xc0, 0xc0, 0x00, 0x00, 0x02, 0x00, 0x75,
-    0x04, 0xd3, 0x03, 0x03, 0x06, 0x7c, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x12, 0xb5, 0x11, 0x13, 0x00,
-    0x0a, 0x0d, 0x05, 0x00, 0x2f, 0x33, 0x7c, 0xdc, 0x32, 0x18, 0xd6, 0xcd, 0x30, 0x31, 0x41, 0x33,
-    0x14, 0x06, 0x06, 0x23, 0x22, 0x26, 0x26, 0x35, 0x33, 0x14, 0x16, 0x33, 0x32, 0x36, 0x27, 0x37,
-    0x33, 0x07, 0x02, 0x56, 0xad, 0x4f, 0x93, 0x64, 0x65, 0x93, 0x50, 0xac, 0x46, 0x56, 0x53, 0x46,
-    0xe0, 0x78, 0xb3, 0xaa, 0x05, 0xb0, 0x41, 0x64, 0x38, 0x38, 0x64, 0x41, 0x2d, 0x45, 0x45, 0x38,
-    0xc1, 0xc1, 0x00, 0x02, 0x00, 0x75, 0x04, 0xd5, 0x02, 0xfd, 0x07, 0x07, 0x00, 0x0f, 0x00, 0x25,
-    0x00, 0x28, 0x40, 0x11, 0x1b, 0x1c, 0x1c, 0x11, 0x25, 0x12, 0x12, 0x11, 0x11, 0x09, 0x0d, 0x05,
-    0x00, 0x09, 0x09, 0x05, 0x10, 0x00, 0x3f, 0x33, 0x7c, 0x2f, 0x33, 0x11, 0x33, 0x11, 0x33, 0x18,
-    0x2f, 0x33, 0x11, 0x33, 0x11, 0x33, 0x2f, 0x33, 0x30, 0x31, 0x41, 0x33, 0x14, 0x06, 0x06, 0x23,
-    0x22, 0x26, 0x26, 0x35, 0x33, 0x14, 0x16, 0x33, 0x32, 0x36, 0x27, 0x23, 0x27, 0x3e, 0x02, 0x35,
-    0x34, 0x2e, 0x02, 0x23, 0x37, 0x32, 0x1e, 0x02, 0x15, 0x14, 0x06, 0x06, 0x07, 0x02, 0x52, 0xab,
-    0x4f, 0x90, 0x65, 0x63, 0x93, 0x4e, 0xaa, 0x47, 0x53, 0x52, 0x47, 0x4a, 0x9c, 0x09, 0x31, 0x3c,
-    0x1d, 0x17, 0x29, 0x37, 0x20, 0x07, 0x4f, 0x78, 0x50, 0x29, 0x2b, 0x43, 0x26, 0x05, 0xb0, 0x41,
-    0x63, 0x37, 0x37, 0x63, 0x41, 0x2d, 0x42, 0x42, 0x45, 0x73, 0x02, 0x0c, 0x16, 0x12, 0x10, 0x16,
-    0x0d, 0x05, 0x5e, 0x15, 0x26, 0x37, 0x22, 0x25, 0x30, 0x18, 0x05, 0x00, 0xff, 0xff, 0x00, 0x4c,
-    0x02, 0x8d, 0x02, 0xa9, 0x05, 0xb8, 0x06, 0x07, 0x01, 0xe1, 0x00, 0x00, 0x02, 0x98, 0xff, 0xff,
-    0x00, 0x36, 0x02, 0x98, 0x02, 0xbf, 0x05, 0xad, 0x06, 0x07, 0x02, 0x3a, 0x00, 0x00, 0x02, 0x98,
-    0xff, 0xff, 0x00, 0x50, 0x02, 0x8d, 0x02, 0xad, 0x05, 0xad, 0x06, 0x07, 0x02, 0x3b, 0x00, 0x00,
-    0x02, 0x98, 0xff, 0xff, 0x00, 0x4e, 0x02, 0x8d, 0x02, 0xb8, 0x05, 0xba, 0x06, 0x07, 0x02, 0x3c,
-    0x00, 0x00, 0x02, 0x98, 0xff, 0xff, 0x00, 0x37, 0x02, 0x98, 0x02, 0xad, 0x05, 0xad, 0x06, 0x07,
-    0x02, 0x3d, 0x00, 0x00, 0x02, 0x98, 0xff, 0xff, 0x00, 0x4b, 0x02, 0x8d, 0x02, 0xaa, 0x05, 0xb8,
-    0x06, 0x07, 0x02, 0x3e, 0x00, 0x00, 0x02, 0x98, 0xff, 0xff, 0x00, 0x47, 0x02, 0x8e, 0x02, 0xa3,
-    0x05, 0xb8, 0x06, 0x07, 0x02, 0x3f, 0x00, 0x00, 0x02, 0x98, 0x00, 0x01, 0x00, 0x69, 0xff, 0xeb,
-    0x05, 0x21, 0x05, 0xc5, 0x00, 0x29, 0x00, 0x15, 0x40, 0x0a, 0x1a, 0x16, 0x11, 0x03, 0x72, 0x26,
-    0x00, 0x05, 0x09, 0x72, 0x00, 0x2b, 0xcc, 0x33, 0x2b, 0xcc, 0x33, 0x30, 0x31, 0x41, 0x33, 0x0e,
-    0x02, 0x23, 0x22, 0x2e, 0x03, 0x35, 0x35, 0x34, 0x12, 0x36, 0x36, 0x33, 0x32, 0x16, 0x16, 0x17,
-    0x23, 0x2e, 0x02, 0x23, 0x22, 0x0e, 0x02, 0x15, 0x15, 0x14, 0x1e, 0x03, 0x33, 0x32, 0x36, 0x36,
-    0x04, 0x25, 0xfb, 0x0f, 0x8c, 0xf5, 0xaf, 0x6f, 0xc1, 0x9c, 0x70, 0x3c, 0x5c, 0xa8, 0xe6, 0x89,
-    0xaf, 0xf8, 0x8f, 0x0f, 0xfb, 0x0e, 0x4a, 0x88, 0x6a, 0x56, 0x8a, 0x64, 0x35, 0x23, 0x42, 0x5e,
-    0x75, 0x46, 0x68, 0x85, 0x4a, 0x01, 0xda, 0x95, 0xde, 0x7c, 0x41, 0x7d, 0xb0, 0xe0, 0x83, 0x37,
-    0xa4, 0x01, 0x0a, 0xbf, 0x65, 0x7d, 0xe2, 0x96, 0x5e, 0x87, 0x48, 0x49, 0x89, 0xbf, 0x77, 0x39,
-    0x5f, 0xa2, 0x80, 0x5a, 0x2f, 0x46, 0x86, 0x00, 0x00, 0x01, 0x00, 0x69, 0xff, 0xeb, 0x05, 0x22,
-    0x05, 0xc5, 0x00, 0x2d, 0x00, 0x1b, 0x40, 0x0d, 0x2d, 0x2c, 0x2c, 0x05, 0x1a, 0x16, 0x11, 0x03,
-    0x72, 0x26, 0x05, 0x09, 0x72, 0x00, 0x2b, 0x32, 0x2b, 0xcc, 0x33, 0x12, 0x39, 0x2f, 0x33, 0x30,
-    0x31, 0x41, 0x11, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x03, 0x35, 0x35, 0x34, 0x12, 0x36, 0x36, 0x33,
-    0x32, 0x16, 0x16, 0x17, 0x23, 0x2e, 0x02, 0x23, 0x22, 0x0e, 0x02, 0x15, 0x15, 0x14, 0x1e, 0x03,
-    0x33, 0x32, 0x36, 0x36, 0x37, 0x11, 0x21, 0x35, 0x05, 0x22, 0x1d, 0x88, 0xd9, 0x98, 0x74, 0xcd,
-    0xa7, 0x7a, 0x41, 0x5d, 0xaa, 0xe7, 0x89, 0xb7, 0xf3, 0x86, 0x12, 0xf7, 0x0c, 0x4b, 0x87, 0x68,
-    0x56, 0x8d, 0x67, 0x38, 0x28, 0x4b, 0x68, 0x83, 0x4b, 0x50, 0x73, 0x48, 0x10, 0xfe, 0xdc, 0x02,
-    0xe1, 0xfd, 0xda, 0x28, 0x62, 0x46, 0x42, 0x7c, 0xb2, 0xe2, 0x85, 0x27, 0xa8, 0x01, 0x0f, 0xc0,
-    0x65, 0x78, 0xd2, 0x87, 0x4c, 0x78, 0x45, 0x4a, 0x8c, 0xc4, 0x78, 0x29, 0x61, 0xa3, 0x82, 0x5b,
-    0x2f, 0x1b, 0x28, 0x12, 0x01, 0x1f, 0xbb, 0x00, 0x00, 0x02, 0x00, 0x99, 0x00, 0x00, 0x05, 0x14,
-    0x05, 0xb0, 0x00, 0x1b, 0x00, 0x1f, 0x00, 0x12, 0xb7, 0x1c, 0x0f, 0x10, 0x02, 0x72, 0x02, 0x1d,
-    0x00, 0x00, 0x2f, 0x32, 0x32, 0x2b, 0x32, 0x32, 0x30, 0x31, 0x61, 0x21, 0x37, 0x21, 0x32, 0x3e,
-    0x02, 0x35, 0x35, 0x34, 0x2e, 0x02, 0x23, 0x21, 0x35, 0x21, 0x32, 0x04, 0x16, 0x12, 0x15, 0x15,
-    0x14, 0x02, 0x06, 0x04, 0x01, 0x11, 0x23, 0x11, 0x02, 0x4c, 0xfe, 0xbc, 0x02, 0x01, 0x38, 0x75,
-    0xb0, 0x76, 0x3c, 0x3c, 0x75, 0xad, 0x70, 0xfe, 0xb7, 0x01, 0x53, 0x9a, 0x01, 0x01, 0xbd, 0x67,
-    0x67, 0xbd, 0xfe, 0xfa, 0xfe, 0xa9, 0xfa, 0xc7, 0x4a, 0x89, 0xb9, 0x6f, 0x2d, 0x72, 0xba, 0x85,
-    0x48, 0xc8, 0x66, 0xbc, 0xfe, 0xfc, 0x9d, 0x2b, 0x9d, 0xfe, 0xfc, 0xbb, 0x66, 0x05, 0xb0, 0xfa,
-    0x50, 0x05, 0xb0, 0x00, 0x00, 0x02, 0x00, 0x69, 0xff, 0xeb, 0x05, 0x6e, 0x05, 0xc5, 0x00, 0x19,
-    0x00, 0x31, 0x00, 0x10, 0xb7, 0x21, 0x14, 0x03, 0x72, 0x2d, 0x07, 0x09, 0x72, 0x00, 0x2b, 0x32,
-    0x2b, 0x32, 0x30, 0x31, 0x41, 0x15, 0x14, 0x0e, 0x03, 0x23, 0x22, 0x2e, 0x03, 0x35, 0x35, 0x34,
-    0x3e, 0x03, 0x33, 0x32, 0x1e, 0x03, 0x07, 0x35, 0x34, 0x2e, 0x03, 0x23, 0x22, 0x0e, 0x02, 0x15,
-    0x15, 0x14, 0x1e, 0x03, 0x33, 0x32, 0x3e, 0x02, 0x05, 0x6e, 0x3e, 0x71, 0x9f, 0xc4, 0x70, 0x6e,
-    0xc3, 0xa0, 0x74, 0x3e, 0x3e, 0x73, 0xa0, 0xc2, 0x6e, 0x70, 0xc5, 0x9f, 0x72, 0x3e, 0xf9, 0x25,
-    0x44, 0x61, 0x7a, 0x47, 0x56, 0x90, 0x68, 0x3a, 0x26, 0x45, 0x62, 0x78, 0x45, 0x5a, 0x90, 0x67,
-    0x38, 0x02, 0xee, 0x2c, 0x7d, 0xde, 0xb4, 0x82, 0x46, 0x46, 0x82, 0xb4, 0xde, 0x7d, 0x2c, 0x7d,
-    0xdd, 0xb5, 0x82, 0x46, 0x46, 0x82, 0xb5, 0xdd, 0xa9, 0x2e, 0x5a, 0x9f, 0x82, 0x5d, 0x32, 0x4e,
-    0x8d, 0xbe, 0x71, 0x2e, 0x5b, 0xa0, 0x82, 0x5e, 0x32, 0x4e, 0x8d, 0xc0, 0x00, 0x03, 0x00, 0x69,
-    0xff, 0x04, 0x05, 0x6e, 0x05, 0xc5, 0x00, 0x03, 0x00, 0x1d, 0x00, 0x35, 0x00, 0x1b, 0x40, 0x0d,
-    0x25, 0x18, 0x03, 0x72, 0x00, 0x03, 0x03, 0x31, 0x0b, 0x09, 0x72, 0x01, 0x02, 0x00, 0x2f, 0x33,
-    0x2b, 0x32, 0x32, 0x11, 0x33, 0x2b, 0x32, 0x30, 0x31, 0x65, 0x01, 0x07, 0x01, 0x01, 0x15, 0x14,
-    0x0e, 0x03, 0x23, 0x22, 0x2e, 0x03, 0x35, 0x35, 0x34, 0x3e, 0x03, 0x33, 0x32, 0x1e, 0x03, 0x07,
-    0x35, 0x34, 0x2e, 0x03, 0x23, 0x22, 0x0e, 0x02, 0x15, 0x15, 0x14, 0x1e, 0x03, 0x33, 0x32, 0x3e,
-    0x02, 0x03, 0xd1, 0x01, 0x74, 0xa3, 0xfe, 0x94, 0x02, 0x38, 0x3e, 0x71, 0x9f, 0xc4, 0x70, 0x6e,
-    0xc3, 0xa0, 0x74, 0x3e, 0x3e, 0x73, 0xa0, 0xc2, 0x6e, 0x70, 0xc5, 0x9f, 0x72, 0x3e, 0xf9, 0x25,
-    0x44, 0x61, 0x7a, 0x47, 0x56, 0x90, 0x68, 0x3a, 0x26, 0x45, 0x62, 0x78, 0x45, 0x5a, 0x90, 0x67,
-    0x38, 0xc2, 0xfe, 0xd1, 0x8f, 0x01, 0x2d, 0x02, 0xb7, 0x22, 0x80, 0xe0, 0xb5, 0x81, 0x45, 0x45,
-    0x81, 0xb5, 0xe0, 0x80, 0x22, 0x81, 0xe0, 0xb5, 0x82, 0x45, 0x45, 0x82, 0xb5, 0xe0, 0xa3, 0x24,
-    0x5e, 0xa2, 0x83, 0x5c, 0x31, 0x4c, 0x8c, 0xc2, 0x76, 0x24, 0x5e, 0xa2, 0x83, 0x5d, 0x31, 0x4d,
-    0x8c, 0xc3, 0x00, 0x01, 0x00, 0x96, 0x00, 0x00, 0x02, 0xea, 0x04, 0x8d, 0x00, 0x06, 0x00, 0x15,
-    0x40, 0x09, 0x03, 0x04, 0x04, 0x05, 0x05, 0x06, 0x7d, 0x02, 0x0a, 0x00, 0x3f, 0x3f, 0x33, 0x2f,
-    0x33, 0x11, 0x33, 0x30, 0x31, 0x41, 0x11, 0x23, 0x11, 0x05, 0x35, 0x25, 0x02, 0xea, 0xf1, 0xfe,
-    0x9d, 0x02, 0x35, 0x04, 0x8d, 0xfb, 0x73, 0x03, 0x70, 0x7c, 0xc8, 0xd1, 0x00, 0x01, 0x00, 0x6b,
-    0x00, 0x00, 0x04, 0x2f, 0x04, 0x9f, 0x00, 0x20, 0x00, 0x17, 0x40, 0x0a, 0x10, 0x10, 0x0c, 0x15,
-    0x7e, 0x03, 0x20, 0x20, 0x02, 0x12, 0x00, 0x3f, 0x33, 0x11, 0x33, 0x3f, 0x33, 0x33, 0x2f, 0x30,
-    0x31, 0x65, 0x15, 0x21, 0x35, 0x01, 0x3e, 0x02, 0x35, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06,
-    0x15, 0x23, 0x34, 0x36, 0x36, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x14, 0x0e, 0x02, 0x07, 0x05, 0x04,
-    0x2f, 0xfc, 0x5a, 0x01, 0xea, 0x3d, 0x41, 0x18, 0x27, 0x57, 0x49, 0x44, 0x67, 0x3b, 0xf1, 0x78,
-    0xd4, 0x8b, 0x6c, 0xa4, 0x6f, 0x38, 0x23, 0x43, 0x60, 0x3f, 0xfe, 0xed, 0xbf, 0xbf, 0x9c, 0x01,
-    0xa8, 0x35, 0x51, 0x4a, 0x27, 0x2a, 0x4b, 0x30, 0x35, 0x62, 0x44, 0x74, 0xb9, 0x6d, 0x32, 0x5b,
-    0x7c, 0x4a, 0x39, 0x66, 0x5f, 0x60, 0x34, 0xfb, 0x00, 0x01, 0x00, 0x0f, 0xfe, 0xa3, 0x03, 0xf7,
-    0x04, 0x8d, 0x00, 0x1f, 0x00, 0x1a, 0x40, 0x0b, 0x06, 0x00, 0x1e, 0x1e, 0x03, 0x16, 0x0f, 0x05,
-    0x02, 0x03, 0x7d, 0x00, 0x3f, 0x33, 0x33, 0x2f, 0x33, 0x12, 0x39, 0x2f, 0x33, 0x33, 0x30, 0x31,
-    0x41, 0x01, 0x21, 0x35, 0x21, 0x17, 0x01, 0x1e, 0x02, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x26,
-    0x27, 0x37, 0x16, 0x16, 0x33, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x23, 0x01, 0x4d,
-    0x01, 0x50, 0xfd, 0xbb, 0x03, 0x74, 0x01, 0xfe, 0x9b, 0x6e, 0xb5, 0x6c, 0x59, 0xa0, 0xda, 0x81,
-    0x68, 0xc4, 0x68, 0x36, 0x4a, 0xaa, 0x59, 0x72, 0xa3, 0x57, 0x4d, 0x9e, 0x7a, 0x4c, 0x02, 0x54,
-    0x01, 0x79, 0xc0, 0x8d, 0xfe, 0x7d, 0x0f, 0x75, 0xbe, 0x80, 0x81, 0xc8, 0x89, 0x46, 0x33, 0x34,
-    0xb3, 0x28, 0x30, 0x56, 0x98, 0x60, 0x65, 0x84, 0x40, 0x00, 0x00, 0x02, 0x00, 0x34, 0xfe, 0xc4,
-    0x04, 0x88, 0x04, 0x8d, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x16, 0x40, 0x09, 0x06, 0x04, 0x0b, 0x7d,
-    0x0a, 0x03, 0x07, 0x07, 0x02, 0x00, 0x2f, 0x33, 0x11, 0x33, 0x2f, 0x3f, 0x33, 0x33, 0x30, 0x31,
-    0x65, 0x15, 0x21, 0x27, 0x01, 0x33, 0x03, 0x01, 0x01, 0x11, 0x23, 0x11, 0x04, 0x88, 0xfb, 0xb3,
-    0x07, 0x02, 0xa8, 0xbd, 0xcf, 0xfe, 0x6a, 0x02, 0xa1, 0xf1, 0xbf, 0xc0, 0x92, 0x03, 0xfc, 0xfe,
-    0x92, 0xfd, 0xa0, 0x03, 0xce, 0xfa, 0x37, 0x05, 0xc9, 0x00, 0x00, 0x01, 0x00, 0x67, 0xfe, 0xa0,
-    0x04, 0x21, 0x04, 0x8c, 0x00, 0x27, 0x00, 0x16, 0x40, 0x09, 0x24, 0x09, 0x09, 0x02, 0x1a, 0x13,
-    0x05, 0x02, 0x7d, 0x00, 0x3f, 0x33, 0x2f, 0x33, 0x12, 0x39, 0x2f, 0x33, 0x30, 0x31, 0x41, 0x27,
-    0x13, 0x21, 0x15, 0x21, 0x03, 0x36, 0x36, 0x37, 0x36, 0x1e, 0x02, 0x15, 0x14, 0x0e, 0x02, 0x23,
-    0x22, 0x26, 0x27, 0x37, 0x16, 0x16, 0x33, 0x32, 0x3e, 0x02, 0x35, 0x34, 0x2e, 0x02, 0x23, 0x22,
-    0x06, 0x06, 0x01, 0x52, 0xc8, 0x56, 0x03, 0x29, 0xfd, 0x9a, 0x2e, 0x29, 0x77, 0x52, 0x68, 0xa4,
-    0x73, 0x3b, 0x44, 0x87, 0xcc, 0x88, 0x6e, 0xd0, 0x5d, 0x4a, 0x3a, 0xa4, 0x62, 0x4f, 0x78, 0x50,
-    0x28, 0x22, 0x42, 0x62, 0x41, 0x3e, 0x52, 0x34, 0x01, 0x69, 0x11, 0x03, 0x12, 0xcc, 0xfe, 0xa0,
-    0x18, 0x1f, 0x01, 0x01, 0x43, 0x80, 0xb6, 0x71, 0x6b, 0xbe, 0x93, 0x53, 0x3a, 0x3b, 0xae, 0x2d,
-    0x36, 0x34, 0x5c, 0x78, 0x45, 0x40, 0x6d, 0x52, 0x2d, 0x1b, 0x33, 0x00, 0x00, 0x01, 0x00, 0x42,
-    0xfe, 0xc4, 0x04, 0x16, 0x04, 0x8d, 0x00, 0x06, 0x00, 0x0f, 0xb5, 0x01, 0x05, 0x05, 0x06, 0x7d,
-    0x03, 0x00, 0x2f, 0x3f, 0x33, 0x11, 0x33, 0x30, 0x31, 0x41, 0x15, 0x01, 0x23, 0x01, 0x21, 0x35,
-    0x04, 0x16, 0xfd, 0xb9, 0xf3, 0x02, 0x3c, 0xfd, 0x2a, 0x04, 0x8d, 0x85, 0xfa, 0xbc, 0x05, 0x09,
-    0xc0, 0x00, 0x00, 0x02, 0x00, 0x76, 0x04, 0xce, 0x02, 0xfc, 0x06, 0xda, 0x00, 0x0f, 0x00, 0x27,
-    0x00, 0x29, 0x40, 0x11, 0x11, 0x10, 0x10, 0x19, 0x21, 0x21, 0x15, 0x1d, 0x1c, 0x1c, 0x25, 0x15,
-    0x15, 0x00, 0x09, 0x0d, 0x05, 0x00, 0x2f, 0x33, 0xcd, 0x32, 0x32, 0x7c, 0x2f, 0x33, 0x33, 0x11,
-    0x33, 0x11, 0x33, 0x18, 0x2f, 0x33, 0x33, 0x11, 0x33, 0x30, 0x31, 0x41, 0x33, 0x14, 0x06, 0x06,
-    0x23, 0x22, 0x26, 0x26, 0x35, 0x33, 0x14, 0x16, 0x33, 0x32, 0x36, 0x13, 0x17, 0x14, 0x06, 0x06,
-    0x23, 0x22, 0x26, 0x26, 0x23, 0x22, 0x06, 0x15, 0x27, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x16,
-    0x33, 0x32, 0x36, 0x02, 0x50, 0xac, 0x4f, 0x90, 0x64, 0x63, 0x91, 0x4f, 0xab, 0x44, 0x54, 0x53,
-    0x44, 0x22, 0x68, 0x2b, 0x49, 0x31, 0x35, 0x45, 0x3e, 0x2c, 0x1f, 0x2b, 0x67, 0x29, 0x4a, 0x31,
-    0x2c, 0x48, 0x45, 0x2b, 0x1e, 0x2c, 0x05, 0xaf, 0x42, 0x66, 0x39, 0x39, 0x66, 0x42, 0x2d, 0x44,
-    0x44, 0x01, 0x58, 0x1e, 0x30, 0x52, 0x32, 0x24, 0x24, 0x32, 0x25, 0x1b, 0x30, 0x53, 0x33, 0x24,
-    0x23, 0x32, 0x00, 0x01, 0x00, 0x62, 0xfe, 0x9a, 0x01, 0x53, 0x00, 0xb3, 0x00, 0x03, 0x00, 0x08,
-    0xb1, 0x01, 0x00, 0x00, 0x2f, 0xcd, 0x30, 0x31, 0x65, 0x11, 0x23, 0x11, 0x01, 0x53, 0xf1, 0xb3,
-    0xfd, 0xe7, 0x02, 0x19, 0x00, 0x05, 0x00, 0x4e, 0xff, 0xf0, 0x06, 0x6e, 0x04, 0x9d, 0x00, 0x29,
-    0x00, 0x2d, 0x00, 0x31, 0x00, 0x35, 0x00, 0x39, 0x00, 0x31, 0x40, 0x18, 0x38, 0x39, 0x39, 0x31,
-    0x7d, 0x16, 0x2d, 0x2d, 0x17, 0x30, 0x0a, 0x35, 0x34, 0x34, 0x26, 0x1b, 0x01, 0x06, 0x06, 0x26,
-    0x7e, 0x11, 0x1b, 0x0b, 0x00, 0x3f, 0x33, 0x3f, 0x33, 0x11, 0x33, 0x11, 0x12, 0x39, 0x2f, 0x33,
-    0x3f, 0x33, 0x33, 0x11, 0x33, 0x3f, 0x33, 0x11, 0x33, 0x30, 0x31, 0x41, 0x07, 0x22, 0x2e, 0x02,
-    0x23, 0x22, 0x0e, 0x02, 0x15, 0x15, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x3e, 0x02, 0x33, 0x17, 0x22,
-    0x06, 0x06, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x35, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x16, 0x16, 0x01,
-    0x15, 0x21, 0x35, 0x13, 0x11, 0x23, 0x11, 0x01, 0x15, 0x21, 0x35, 0x01, 0x15, 0x21, 0x35, 0x03,
-    0xe7, 0x19, 0x20, 0x6a, 0x72, 0x5f, 0x15, 0x43, 0x6b, 0x49, 0x27, 0x27, 0x4b, 0x6b, 0x43, 0x17,
-    0x60, 0x74, 0x67, 0x1d, 0x1a, 0x4e, 0x94, 0x7d, 0x2a, 0x75, 0xc2, 0x8e, 0x4d, 0x4d, 0x8c, 0xc2,
-    0x75, 0x2a, 0x7f, 0x95, 0x02, 0xd2, 0xfd, 0x66, 0x4b, 0xf1, 0x02, 0xea, 0xfd, 0xbc, 0x02, 0x99,
-    0xfd, 0x67, 0x04, 0x8d, 0xc0, 0x04, 0x07, 0x05, 0x32, 0x60, 0x8c, 0x5b, 0x3a, 0x5a, 0x8d, 0x61,
-    0x33, 0x05, 0x05, 0x05, 0xbe, 0x08, 0x08, 0x4e, 0x95, 0xd2, 0x85, 0x38, 0x85, 0xd2, 0x96, 0x4e,
-    0x08, 0x08, 0xfc, 0x32, 0xbf, 0xbf, 0x03, 0xce, 0xfb, 0x73, 0x04, 0x8d, 0xfe, 0x2d, 0xbf, 0xbf,
-    0x01, 0xd3, 0xc0, 0xc0, 0x00, 0x01, 0x00, 0x6e, 0xfe, 0xb4, 0x04, 0x50, 0x04, 0xa1, 0x00, 0x3b,
-    0x00, 0x14, 0xb7, 0x00, 0x15, 0x1f, 0x1f, 0x35, 0x0b, 0x29, 0x35, 0x00, 0x2f, 0x2f, 0x33, 0x12,
-    0x39, 0x2f, 0x33, 0x32, 0x30, 0x31, 0x45, 0x32, 0x3e, 0x02, 0x35, 0x35, 0x34, 0x2e, 0x02, 0x23,
-    0x22, 0x0e, 0x02, 0x15, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x3e, 0x02, 0x35, 0x37, 0x14, 0x06, 0x06,
-    0x23, 0x22, 0x2e, 0x02, 0x35, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x15, 0x14, 0x0e,
-    0x03, 0x23, 0x22, 0x26, 0x27, 0x37, 0x16, 0x16, 0x01, 0xea, 0x55, 0x89, 0x62, 0x34, 0x25, 0x45,
-    0x61, 0x3d, 0x36, 0x5a, 0x42, 0x24, 0x20, 0x41, 0x5c, 0x3c, 0x4b, 0x70, 0x4a, 0x25, 0x65, 0x77,
-    0xc8, 0x79, 0x69, 0xa6, 0x75, 0x3e, 0x48, 0x81, 0xad, 0x67, 0x71, 0xbc, 0x8b, 0x4d, 0x3a, 0x6a,
-    0x92, 0xb1, 0x65, 0x48, 0x96, 0x46, 0x2f, 0x31, 0x69, 0x8d, 0x42, 0x86, 0xcb, 0x89, 0xf5, 0x57,
-    0x83, 0x58, 0x2c, 0x2e, 0x56, 0x79, 0x4a, 0x41, 0x73, 0x58, 0x32, 0x2b, 0x47, 0x53, 0x27, 0x0a,
-    0x8c, 0xc0, 0x62, 0x48, 0x85, 0xb9, 0x70, 0x76, 0xbe, 0x88, 0x4a, 0x48, 0x8f, 0xd5, 0x8d, 0xcf,
-    0x94, 0xed, 0xb2, 0x77, 0x3b, 0x1e, 0x1e, 0xb2, 0x12, 0x1d, 0x00, 0x01, 0xff, 0xa7, 0xfe, 0x4b,
-    0x01, 0x8b, 0x00, 0xce, 0x00, 0x11, 0x00, 0x0a, 0xb2, 0x0d, 0x06, 0x00, 0x00, 0x2f, 0xcc, 0x32,
-    0x30, 0x31, 0x77, 0x33, 0x11, 0x14, 0x06, 0x06, 0x23, 0x22, 0x26, 0x27, 0x37, 0x16, 0x16, 0x33,
-    0x32, 0x36, 0x36, 0x35, 0x99, 0xf2, 0x56, 0x9e, 0x6e, 0x24, 0x3c, 0x22, 0x0e, 0x13, 0x3a, 0x16,
-    0x29, 0x3a, 0x1e, 0xce, 0xfe, 0xf4, 0x79, 0xa8, 0x56, 0x07, 0x0a, 0xc1, 0x06, 0x06, 0x28, 0x4f,
-    0x3a, 0x00, 0xff, 0xff, 0x00, 0x38, 0xfe, 0xa3, 0x04, 0x20, 0x04, 0x8d, 0x04, 0x06, 0x02, 0x66,
-    0x29, 0x00, 0xff, 0xff, 0x00, 0x68, 0xfe, 0xa0, 0x04, 0x22, 0x04, 0x8c, 0x04, 0x06, 0x02, 0x68,
-    0x01, 0x00, 0xff, 0xff, 0x00, 0x2c, 0xfe, 0xc4, 0x04, 0x80, 0x04, 0x8d, 0x04, 0x06, 0x02, 0x67,
-    0xf8, 0x00, 0xff, 0xff, 0x00, 0x62, 0x00, 0x00, 0x04, 0x26, 0x04, 0x9f, 0x04, 0x06, 0x02, 0x65,
-    0xf7, 0x00, 0xff, 0xff, 0x00, 0x5f, 0xfe, 0xc4, 0x04, 0x33, 0x04, 0x8d, 0x04, 0x06, 0x02, 0x69,
-    0x1d, 0x00, 0xff, 0xff, 0x00, 0x34, 0xff, 0xeb, 0x04, 0x57, 0x04, 0xa0, 0x04, 0x06, 0x02, 0x7f,
-    0xd4, 0x00, 0xff, 0xff, 0x00, 0x6c, 0xff, 0xec, 0x04, 0x32, 0x05, 0xb9, 0x04, 0x06, 0x00, 0x1a,
-    0xf9, 0x00, 0xff, 0xff, 0x00, 0x59, 0xfe, 0xb4, 0x04, 0x3b, 0x04, 0xa1, 0x04, 0x06, 0x02, 0x6d,
-    0xeb, 0x00, 0xff, 0xff, 0x00, 0x67, 0xff, 0xec, 0x04, 0x26, 0x05, 0xc4, 0x06, 0x06, 0x00, 0x1c,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0xe6, 0x00, 0x00, 0x03, 0x39, 0x04, 0x8d, 0x04, 0x06, 0x02, 0x64,
-    0x4f, 0x00, 0xff, 0xff, 0xff, 0xae, 0xfe, 0x4b, 0x01, 0x92, 0x04, 0x3a, 0x04, 0x06, 0x00, 0x9c,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xae, 0xfe, 0x4b, 0x01, 0x92, 0x04, 0x3a, 0x06, 0x06, 0x00, 0x9c,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x90, 0x00, 0x00, 0x01, 0x81, 0x04, 0x3a, 0x06, 0x06, 0x00, 0x8d,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xfa, 0xfe, 0x5e, 0x01, 0x81, 0x04, 0x3a, 0x06, 0x26, 0x00, 0x8d,
-    0x00, 0x00, 0x01, 0x06, 0x00, 0xa4, 0xd1, 0x0a, 0x00, 0x0b, 0xb6, 0x01, 0x04, 0x02, 0x00, 0x00,
-    0x43, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x90, 0x00, 0x00, 0x01, 0x81, 0x04, 0x3a,
-    0x06, 0x06, 0x00, 0x8d, 0x00, 0x00, 0x00, 0x03, 0x00, 0x76, 0xff, 0xeb, 0x04, 0x19, 0x04, 0x9d,
-    0x00, 0x03, 0x00, 0x16, 0x00, 0x31, 0x00, 0x29, 0x40, 0x14, 0x0f, 0x26, 0x26, 0x0d, 0x23, 0x23,
-    0x09, 0x1b, 0x2f, 0x0b, 0x72, 0x04, 0x00, 0x00, 0x02, 0x13, 0x09, 0x7e, 0x02, 0x0a, 0x00, 0x3f,
-    0x3f, 0x33, 0x12, 0x39, 0x2f, 0x33, 0x2b, 0x32, 0x11, 0x39, 0x2f, 0x33, 0x33, 0x11, 0x33, 0x30,
-    0x31, 0x41, 0x11, 0x23, 0x11, 0x17, 0x23, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x17, 0x01, 0x27,
-    0x35, 0x13, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x13, 0x37, 0x16, 0x16, 0x33, 0x32, 0x36, 0x36,
-    0x35, 0x34, 0x26, 0x26, 0x23, 0x23, 0x35, 0x37, 0x32, 0x1e, 0x02, 0x15, 0x14, 0x06, 0x06, 0x23,
-    0x22, 0x26, 0x01, 0x62, 0xec, 0xec, 0xec, 0x5d, 0xb9, 0x8b, 0x89, 0xce, 0x56, 0xfe, 0xa8, 0x86,
-    0xcc, 0x1d, 0x4c, 0x35, 0x3e, 0x4f, 0x25, 0x46, 0x45, 0x19, 0x4a, 0x2f, 0x36, 0x4d, 0x29, 0x36,
-    0x6d, 0x50, 0x52, 0x6f, 0x69, 0xa7, 0x76, 0x3e, 0x67, 0xb2, 0x6f, 0x43, 0x74, 0x02, 0xed, 0xfd,
-    0x13, 0x02, 0xed, 0x02, 0x90, 0xc1, 0x61, 0x74, 0x5f, 0xfe, 0x64, 0x03, 0x71, 0x01, 0x02, 0x18,
-    0x25, 0x3e, 0x6f, 0xfc, 0xee, 0xb6, 0x11, 0x20, 0x2f, 0x54, 0x37, 0x3b, 0x47, 0x21, 0x9d, 0x07,
-    0x2a, 0x52, 0x7a, 0x4f, 0x7a, 0xa8, 0x56, 0x1d, 0x00, 0x02, 0x00, 0x60, 0xff, 0xeb, 0x04, 0x83,
-    0x04, 0xa0, 0x00, 0x15, 0x00, 0x2b, 0x00, 0x0e, 0xb5, 0x1c, 0x11, 0x7e, 0x27, 0x06, 0x0b, 0x00,
-    0x3f, 0x33, 0x3f, 0x33, 0x30, 0x31, 0x41, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x35,
-    0x35, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x1e, 0x02, 0x07, 0x35, 0x34, 0x2e, 0x02, 0x23, 0x22, 0x0e,
-    0x02, 0x15, 0x15, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x3e, 0x02, 0x04, 0x83, 0x50, 0x8f, 0xc1, 0x70,
-    0x70, 0xc2, 0x90, 0x51, 0x50, 0x90, 0xc1, 0x70, 0x70, 0xc1, 0x90, 0x51, 0xf1, 0x2c, 0x4e, 0x6a,
-    0x3d, 0x3e, 0x68, 0x4f, 0x2b, 0x2c, 0x4f, 0x69, 0x3e, 0x3e, 0x69, 0x4d, 0x2b, 0x02, 0x4e, 0x11,
-    0x94, 0xdf, 0x94, 0x4b, 0x4b, 0x94, 0xdf, 0x94, 0x11, 0x94, 0xdf, 0x95, 0x4a, 0x4a, 0x95, 0xdf,
-    0xb4, 0x31, 0x63, 0x91, 0x5f, 0x2f, 0x2f, 0x5f, 0x91, 0x63, 0x31, 0x63, 0x92, 0x60, 0x2e, 0x2e,
-    0x60, 0x92, 0x00, 0x01, 0x00, 0x39, 0x00, 0x00, 0x03, 0xea, 0x05, 0xb0, 0x00, 0x06, 0x00, 0x13,
-    0x40, 0x09, 0x01, 0x05, 0x05, 0x06, 0x04, 0x72, 0x03, 0x0c, 0x72, 0x00, 0x2b, 0x2b, 0x32, 0x11,
-    0x33, 0x30, 0x31, 0x41, 0x15, 0x01, 0x23, 0x01, 0x21, 0x35, 0x03, 0xea, 0xfd, 0xd3, 0xf2, 0x02,
-    0x2d, 0xfd, 0x41, 0x05, 0xb0, 0x84, 0xfa, 0xd4, 0x04, 0xf0, 0xc0, 0x00, 0x00, 0x03, 0x00, 0x7d,
-    0xff, 0xec, 0x04, 0x44, 0x06, 0x00, 0x00, 0x04, 0x00, 0x1a, 0x00, 0x2f, 0x00, 0x19, 0x40, 0x0e,
-    0x21, 0x16, 0x07, 0x72, 0x2b, 0x0b, 0x0b, 0x72, 0x04, 0x0a, 0x72, 0x00, 0x00, 0x72, 0x00, 0x2b,
-    0x2b, 0x2b, 0x32, 0x2b, 0x32, 0x30, 0x31, 0x53, 0x33, 0x11, 0x07, 0x23, 0x01, 0x15, 0x14, 0x0e,
-    0x02, 0x23, 0x22, 0x2e, 0x02, 0x27, 0x35, 0x3e, 0x03, 0x33, 0x32, 0x1e, 0x02, 0x07, 0x35, 0x34,
-    0x2e, 0x02, 0x23, 0x22, 0x0e, 0x02, 0x07, 0x15, 0x1e, 0x02, 0x33, 0x32, 0x3e, 0x02, 0x7d, 0xf1,
-    0x20, 0xd1, 0x03, 0xc7, 0x3b, 0x73, 0xa3, 0x67, 0x65, 0x96, 0x65, 0x3e, 0x0d, 0x0d, 0x3e, 0x65,
-    0x95, 0x64, 0x68, 0xa5, 0x72, 0x3b, 0xf1, 0x1f, 0x40, 0x62, 0x44, 0x40, 0x5e, 0x3f, 0x24, 0x06,
-    0x09, 0x3d, 0x6e, 0x55, 0x43, 0x62, 0x3f, 0x1f, 0x06, 0x00, 0xfa, 0xe7, 0xe7, 0x02, 0x27, 0x15,
-    0x76, 0xc9, 0x95, 0x52, 0x4d, 0x8b, 0xc0, 0x74, 0x43, 0x77, 0xc3, 0x8d, 0x4c, 0x4f, 0x92, 0xcb,
-    0x90, 0x15, 0x4c, 0x82, 0x61, 0x36, 0x2b, 0x4c, 0x67, 0x3b, 0xb5, 0x49, 0x7c, 0x4b, 0x38, 0x62,
-    0x80, 0x00, 0x00, 0x01, 0x00, 0x4f, 0xff, 0xec, 0x04, 0x00, 0x04, 0x4e, 0x00, 0x27, 0x00, 0x19,
-    0x40, 0x0c, 0x1d, 0x19, 0x19, 0x14, 0x07, 0x72, 0x04, 0x04, 0x00, 0x09, 0x0b, 0x72, 0x00, 0x2b,
-    0x32, 0x32, 0x2f, 0x2b, 0x32, 0x2f, 0x32, 0x30, 0x31, 0x65, 0x32, 0x36, 0x36, 0x37, 0x33, 0x0e,
-    0x02, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x35, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x16, 0x16, 0x17, 0x23,
-    0x2e, 0x02, 0x23, 0x22, 0x0e, 0x02, 0x15, 0x15, 0x14, 0x1e, 0x02, 0x02, 0x41, 0x3b, 0x61, 0x3d,
-    0x03, 0xe3, 0x04, 0x7a, 0xc6, 0x78, 0x7c, 0xbc, 0x7e, 0x3f, 0x40, 0x7e, 0xba, 0x7c, 0x82, 0xc5,
-    0x72, 0x04, 0xe3, 0x03, 0x37, 0x60, 0x43, 0x49, 0x63, 0x3b, 0x19, 0x19, 0x3b, 0x63, 0xab, 0x30,
-    0x54, 0x37, 0x69, 0xac, 0x65, 0x55, 0x96, 0xc4, 0x70, 0x23, 0x70, 0xc5, 0x96, 0x55, 0x67, 0xb7,
-    0x79, 0x3c, 0x61, 0x3a, 0x3b, 0x65, 0x7d, 0x43, 0x23, 0x43, 0x7e, 0x64, 0x3b, 0x00, 0x00, 0x03,
-    0x00, 0x4e, 0xff, 0xec, 0x04, 0x15, 0x06, 0x00, 0x00, 0x04, 0x00, 0x1a, 0x00, 0x2f, 0x00, 0x19,
-    0x40, 0x0d, 0x21, 0x04, 0x04, 0x16, 0x0b, 0x72, 0x2b, 0x0b, 0x07, 0x72, 0x01, 0x00, 0x72, 0x00,
-    0x2b, 0x2b, 0x32, 0x2b, 0x32, 0x2f, 0x32, 0x30, 0x31, 0x65, 0x11, 0x33, 0x11, 0x23, 0x01, 0x35,
-    0x34, 0x3e, 0x02, 0x33, 0x32, 0x1e, 0x02, 0x17, 0x15, 0x0e, 0x03, 0x23, 0x22, 0x2e, 0x02, 0x37,
-    0x15, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x36, 0x36, 0x37, 0x35, 0x2e, 0x03, 0x23, 0x22, 0x0e, 0x02,
-    0x03, 0x23, 0xf2, 0xd2, 0xfd, 0x0b, 0x41, 0x76, 0xa3, 0x64, 0x62, 0x94, 0x67, 0x3e, 0x0e, 0x0d,
-    0x3f, 0x68, 0x94, 0x63, 0x62, 0xa3, 0x76, 0x41, 0xf2, 0x21, 0x42, 0x62, 0x41, 0x52, 0x6d, 0x3f,
-    0x0b, 0x06, 0x26, 0x40, 0x5d, 0x3e, 0x41, 0x63, 0x43, 0x21, 0xe0, 0x05, 0x20, 0xfa, 0x00, 0x02,
-    0x11, 0x15, 0x7c, 0xcb, 0x92, 0x4f, 0x4c, 0x8d, 0xc2, 0x77, 0x44, 0x73, 0xc1, 0x8b, 0x4d, 0x52,
-    0x94, 0xc9, 0x8b, 0x15, 0x49, 0x81, 0x61, 0x37, 0x48, 0x7c, 0x4b, 0xb6, 0x3b, 0x66, 0x4c, 0x2b,
-    0x36, 0x61, 0x82, 0x00, 0x00, 0x03, 0x00, 0x4e, 0xfe, 0x55, 0x04, 0x15, 0x04, 0x4e, 0x00, 0x13,
-    0x00, 0x29, 0x00, 0x3e, 0x00, 0x1b, 0x40, 0x0f, 0x30, 0x25, 0x0b, 0x72, 0x3a, 0x1a, 0x07, 0x72,
-    0x0e, 0x06, 0x0f, 0x72, 0x00, 0x06, 0x72, 0x00, 0x2b, 0x2b, 0x32, 0x2b, 0x32, 0x2b, 0x32, 0x30,
-    0x31, 0x41, 0x33, 0x11, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x26, 0x27, 0x37, 0x16, 0x16, 0x33, 0x32,
-    0x36, 0x36, 0x35, 0x11, 0x01, 0x35, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x1e, 0x02, 0x17, 0x15, 0x0e,
-    0x03, 0x23, 0x22, 0x2e, 0x02, 0x37, 0x15, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x36, 0x36, 0x37, 0x35,
-    0x2e, 0x03, 0x23, 0x22, 0x0e, 0x02, 0x03, 0x45, 0xd0, 0x43, 0x81, 0xba, 0x76, 0x4b, 0xb9, 0x4c,
-    0x31, 0x3c, 0x87, 0x4a, 0x5f, 0x7a, 0x3b, 0xfd, 0x2b, 0x3f, 0x76, 0xa3, 0x65, 0x69, 0x96, 0x63,
-    0x3a, 0x0e, 0x0e, 0x3d, 0x66, 0x96, 0x65, 0x63, 0xa3, 0x76, 0x3f, 0xf2, 0x21, 0x42, 0x62, 0x41,
-    0x55, 0x6c, 0x3c, 0x0c, 0x07, 0x25, 0x3e, 0x5d, 0x40, 0x42, 0x63, 0x42, 0x21, 0x04, 0x3a, 0xfc,
-    0x15, 0x79, 0xbc, 0x82, 0x43, 0x2b, 0x2f, 0xab, 0x21, 0x28, 0x47, 0x8b, 0x68, 0x02, 0xfa, 0xfe,
-    0xcd, 0x15, 0x7b, 0xcb, 0x92, 0x4f, 0x4c, 0x8d, 0xc2, 0x77, 0x43, 0x74, 0xc0, 0x8c, 0x4d, 0x52,
-    0x95, 0xc9, 0x8b, 0x15, 0x4a, 0x80, 0x62, 0x37, 0x49, 0x7b, 0x4c, 0xb5, 0x3b, 0x66, 0x4c, 0x2b,
-    0x36, 0x61, 0x82, 0x00, 0x00, 0x02, 0x00, 0x49, 0xff, 0xec, 0x04, 0x53, 0x04, 0x4e, 0x00, 0x15,
-    0x00, 0x2b, 0x00, 0x10, 0xb7, 0x1c, 0x11, 0x0b, 0x72, 0x27, 0x06, 0x07, 0x72, 0x00, 0x2b, 0x32,
-    0x2b, 0x32, 0x30, 0x31, 0x53, 0x35, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x15, 0x14,
-    0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x37, 0x15, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x3e, 0x02, 0x35,
-    0x35, 0x34, 0x2e, 0x02, 0x23, 0x22, 0x0e, 0x02, 0x49, 0x49, 0x88, 0xbe, 0x75, 0x77, 0xbf, 0x88,
-    0x48, 0x48, 0x87, 0xbf, 0x76, 0x76, 0xbf, 0x88, 0x49, 0xf1, 0x24, 0x45, 0x68, 0x44, 0x43, 0x67,
-    0x46, 0x22, 0x23, 0x45, 0x68, 0x44, 0x44, 0x66, 0x45, 0x24, 0x02, 0x11, 0x17, 0x75, 0xc9, 0x95,
-    0x53, 0x53, 0x95, 0xc9, 0x75, 0x17, 0x75, 0xc8, 0x95, 0x53, 0x53, 0x95, 0xc8, 0x8c, 0x17, 0x49,
-    0x82, 0x63, 0x38, 0x38, 0x63, 0x82, 0x49, 0x17, 0x48, 0x81, 0x64, 0x39, 0x39, 0x64, 0x81, 0x00,
-    0x00, 0x03, 0x00, 0x7d, 0xfe, 0x60, 0x04, 0x43, 0x04, 0x4e, 0x00, 0x04, 0x00, 0x1a, 0x00, 0x2f,
-    0x00, 0x19, 0x40, 0x0e, 0x21, 0x16, 0x07, 0x72, 0x2b, 0x0b, 0x0b, 0x72, 0x03, 0x06, 0x72, 0x02,
-    0x0e, 0x72, 0x00, 0x2b, 0x2b, 0x2b, 0x32, 0x2b, 0x32, 0x30, 0x31, 0x41, 0x11, 0x23, 0x11, 0x33,
-    0x01, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x27, 0x35, 0x3e, 0x03, 0x33, 0x32, 0x1e,
-    0x02, 0x07, 0x35, 0x34, 0x2e, 0x02, 0x23, 0x22, 0x0e, 0x02, 0x07, 0x15, 0x1e, 0x02, 0x33, 0x32,
-    0x3e, 0x02, 0x01, 0x6e, 0xf1, 0xd8, 0x02, 0xee, 0x3d, 0x73, 0xa2, 0x66, 0x65, 0x97, 0x68, 0x3f,
-    0x0d, 0x0d, 0x3f, 0x68, 0x96, 0x64, 0x66, 0xa4, 0x74, 0x3c, 0xf1, 0x22, 0x44, 0x63, 0x41, 0x40,
-    0x5d, 0x40, 0x24, 0x06, 0x0c, 0x3c, 0x6d, 0x54, 0x41, 0x62, 0x43, 0x22, 0x03, 0x6a, 0xfa, 0xf6,
-    0x05, 0xda, 0xfd, 0xed, 0x15, 0x76, 0xc9, 0x95, 0x52, 0x4b, 0x89, 0xbb, 0x70, 0x51, 0x77, 0xc2,
-    0x8d, 0x4c, 0x4f, 0x92, 0xcb, 0x90, 0x15, 0x4c, 0x82, 0x61, 0x36, 0x2b, 0x4c, 0x66, 0x3b, 0xc2,
-    0x48, 0x78, 0x47, 0x38, 0x64, 0x81, 0x00, 0x03, 0x00, 0x4e, 0xfe, 0x60, 0x04, 0x14, 0x04, 0x4e,
-    0x00, 0x04, 0x00, 0x1a, 0x00, 0x2f, 0x00, 0x19, 0x40, 0x0e, 0x21, 0x16, 0x0b, 0x72, 0x2b, 0x0b,
-    0x07, 0x72, 0x04, 0x0e, 0x72, 0x03, 0x06, 0x72, 0x00, 0x2b, 0x2b, 0x2b, 0x32, 0x2b, 0x32, 0x30,
-    0x31, 0x41, 0x11, 0x37, 0x33, 0x11, 0x01, 0x35, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x1e, 0x02, 0x17,
-    0x15, 0x0e, 0x03, 0x23, 0x22, 0x2e, 0x02, 0x37, 0x15, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x36, 0x36,
-    0x37, 0x35, 0x2e, 0x03, 0x23, 0x22, 0x0e, 0x02, 0x03, 0x22, 0x21, 0xd1, 0xfc, 0x3a, 0x3f, 0x75,
-    0xa5, 0x66, 0x65, 0x95, 0x67, 0x3e, 0x0e, 0x0d, 0x3e, 0x68, 0x96, 0x66, 0x64, 0xa5, 0x75, 0x3f,
-    0xf2, 0x21, 0x43, 0x63, 0x41, 0x55, 0x6f, 0x3d, 0x0b, 0x06, 0x25, 0x40, 0x5f, 0x40, 0x41, 0x64,
-    0x43, 0x22, 0xfe, 0x60, 0x05, 0x03, 0xd7, 0xfa, 0x26, 0x03, 0xb1, 0x15, 0x7b, 0xcb, 0x93, 0x4f,
-    0x4c, 0x8d, 0xc2, 0x77, 0x44, 0x73, 0xc1, 0x8b, 0x4d, 0x52, 0x94, 0xc9, 0x8b, 0x15, 0x4a, 0x81,
-    0x63, 0x38, 0x4a, 0x7e, 0x4b, 0xb6, 0x3b, 0x66, 0x4e, 0x2b, 0x37, 0x62, 0x83, 0x00, 0x00, 0x01,
-    0x00, 0x51, 0xff, 0xec, 0x04, 0x0a, 0x04, 0x4e, 0x00, 0x2a, 0x00, 0x19, 0x40, 0x0c, 0x13, 0x12,
-    0x12, 0x00, 0x19, 0x0b, 0x07, 0x72, 0x24, 0x00, 0x0b, 0x72, 0x00, 0x2b, 0x32, 0x2b, 0x32, 0x11,
-    0x39, 0x2f, 0x33, 0x30, 0x31, 0x45, 0x22, 0x2e, 0x02, 0x35, 0x35, 0x34, 0x3e, 0x02, 0x33, 0x32,
-    0x1e, 0x02, 0x15, 0x15, 0x21, 0x35, 0x21, 0x35, 0x34, 0x26, 0x26, 0x23, 0x22, 0x0e, 0x02, 0x15,
-    0x15, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x36, 0x37, 0x17, 0x06, 0x06, 0x02, 0x72, 0x7d, 0xc8, 0x90,
-    0x4c, 0x4a, 0x84, 0xb4, 0x69, 0x74, 0xae, 0x73, 0x39, 0xfc, 0xbc, 0x02, 0x56, 0x2d, 0x62, 0x51,
-    0x3c, 0x5d, 0x3f, 0x21, 0x2a, 0x52, 0x7b, 0x52, 0x53, 0x95, 0x34, 0x37, 0x32, 0xb7, 0x14, 0x50,
-    0x90, 0xc3, 0x73, 0x2a, 0x7d, 0xc9, 0x8f, 0x4d, 0x49, 0x87, 0xba, 0x70, 0x7f, 0xad, 0x1a, 0x42,
-    0x6e, 0x42, 0x32, 0x5c, 0x83, 0x51, 0x2a, 0x49, 0x7d, 0x5d, 0x34, 0x30, 0x21, 0xa3, 0x26, 0x47,
-    0x00, 0x03, 0x00, 0x50, 0xfe, 0x55, 0x04, 0x03, 0x04, 0x4e, 0x00, 0x12, 0x00, 0x28, 0x00, 0x3d,
-    0x00, 0x1b, 0x40, 0x0f, 0x2f, 0x24, 0x0b, 0x72, 0x39, 0x19, 0x07, 0x72, 0x0d, 0x06, 0x0f, 0x72,
-    0x00, 0x06, 0x72, 0x00, 0x2b, 0x2b, 0x32, 0x2b, 0x32, 0x2b, 0x32, 0x30, 0x31, 0x41, 0x33, 0x11,
-    0x14, 0x06, 0x06, 0x23, 0x22, 0x26, 0x27, 0x37, 0x16, 0x16, 0x33, 0x32, 0x36, 0x36, 0x35, 0x11,
-    0x01, 0x35, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x1e, 0x02, 0x17, 0x15, 0x0e, 0x03, 0x23, 0x22, 0x2e,
-    0x02, 0x37, 0x15, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x36, 0x36, 0x37, 0x35, 0x2e, 0x03, 0x23, 0x22,
-    0x0e, 0x02, 0x03, 0x33, 0xd0, 0x77, 0xdf, 0x9d, 0x46, 0xaf, 0x47, 0x32, 0x37, 0x7b, 0x45, 0x60,
-    0x79, 0x3b, 0xfd, 0x3f, 0x3a, 0x6d, 0x9e, 0x65, 0x69, 0x95, 0x64, 0x39, 0x0e, 0x0e, 0x3d, 0x66,
-    0x95, 0x65, 0x64, 0x9d, 0x6d, 0x3a, 0xf2, 0x1a, 0x3a, 0x5c, 0x41, 0x55, 0x6b, 0x3a, 0x0b, 0x06,
-    0x23, 0x3d, 0x5d, 0x40, 0x41, 0x5d, 0x3a, 0x1b, 0x04, 0x3a, 0xfc, 0x0a, 0x9e, 0xdd, 0x74, 0x25,
-    0x29, 0xac, 0x1d, 0x21, 0x44, 0x87, 0x63, 0x03, 0x06, 0xfe, 0xcc, 0x15, 0x7c, 0xcb, 0x92, 0x4f,
-    0x4c, 0x8d, 0xc2, 0x77, 0x43, 0x74, 0xc0, 0x8c, 0x4d, 0x52, 0x94, 0xc9, 0x8b, 0x15, 0x4a, 0x7f,
-    0x62, 0x37, 0x49, 0x7b, 0x4c, 0xb5, 0x3b, 0x66, 0x4c, 0x2b, 0x37, 0x61, 0x82, 0x00, 0x00, 0x02,
-    0x00, 0x34, 0xfe, 0x4d, 0x04, 0x5b, 0x04, 0x4a, 0x00, 0x03, 0x00, 0x25, 0x00, 0x19, 0x40, 0x0c,
-    0x0e, 0x15, 0x01, 0x01, 0x15, 0x1f, 0x04, 0x07, 0x72, 0x03, 0x06, 0x72, 0x00, 0x2b, 0x2b, 0x32,
-    0x2f, 0x33, 0x2f, 0x11, 0x33, 0x30, 0x31, 0x41, 0x01, 0x23, 0x01, 0x25, 0x32, 0x1e, 0x02, 0x17,
-    0x01, 0x1e, 0x02, 0x17, 0x16, 0x36, 0x37, 0x07, 0x06, 0x06, 0x27, 0x2e, 0x03, 0x27, 0x01, 0x2e,
-    0x02, 0x23, 0x22, 0x06, 0x07, 0x27, 0x36, 0x36, 0x04, 0x2c, 0xfd, 0x22, 0xf5, 0x02, 0xdf, 0xfd,
-    0x82, 0x50, 0x69, 0x45, 0x2c, 0x12, 0x01, 0x96, 0x10, 0x26, 0x2f, 0x1d, 0x0e, 0x31, 0x0e, 0x22,
-    0x14, 0x3b, 0x19, 0x3c, 0x5a, 0x42, 0x34, 0x17, 0xfe, 0x7d, 0x10, 0x33, 0x42, 0x2b, 0x0c, 0x2a,
-    0x0d, 0x04, 0x1d, 0x45, 0x04, 0x3a, 0xfa, 0x26, 0x05, 0xda, 0x10, 0x36, 0x54, 0x5d, 0x27, 0xfc,
-    0x67, 0x26, 0x3b, 0x26, 0x03, 0x01, 0x01, 0x01, 0xc0, 0x07, 0x06, 0x02, 0x03, 0x34, 0x54, 0x69,
-    0x38, 0x03, 0x76, 0x2b, 0x43, 0x27, 0x04, 0x01, 0xb6, 0x08, 0x0b, 0x00, 0xff, 0xff, 0x00, 0x61,
-    0x00, 0x00, 0x02, 0xb7, 0x05, 0xb5, 0x04, 0x06, 0x00, 0x15, 0xb7, 0x00, 0x00, 0x01, 0x00, 0x5f,
-    0xff, 0xee, 0x04, 0xbd, 0x04, 0x9d, 0x00, 0x41, 0x00, 0x17, 0x40, 0x0b, 0x38, 0x38, 0x10, 0x22,
-    0x7e, 0x19, 0x0a, 0x33, 0x00, 0x0b, 0x72, 0x00, 0x2b, 0x32, 0x3f, 0x3f, 0x33, 0x39, 0x2f, 0x30,
-    0x31, 0x45, 0x22, 0x2e, 0x02, 0x35, 0x34, 0x36, 0x36, 0x37, 0x25, 0x36, 0x36, 0x35, 0x34, 0x26,
-    0x23, 0x22, 0x06, 0x15, 0x14, 0x16, 0x16, 0x17, 0x01, 0x21, 0x01, 0x2e, 0x02, 0x35, 0x34, 0x36,
-    0x36, 0x33, 0x32, 0x16, 0x16, 0x15, 0x14, 0x06, 0x06, 0x07, 0x05, 0x0e, 0x02, 0x15, 0x14, 0x16,
-    0x16, 0x33, 0x32, 0x3e, 0x02, 0x35, 0x33, 0x14, 0x06, 0x07, 0x06, 0x06, 0x07, 0x06, 0x06, 0x02,
-    0x01, 0x61, 0x9b, 0x6c, 0x3a, 0x30, 0x59, 0x3d, 0x01, 0x07, 0x33, 0x27, 0x41, 0x3b, 0x3b, 0x3c,
-    0x25, 0x3f, 0x26, 0x02, 0xa0, 0xfe, 0xf6, 0xfd, 0xcb, 0x39, 0x58, 0x33, 0x52, 0x98, 0x68, 0x69,
-    0x98, 0x54, 0x2b, 0x49, 0x2d, 0xfe, 0xe0, 0x21, 0x24, 0x0c, 0x2b, 0x53, 0x3d, 0x61, 0x97, 0x6a,
-    0x37, 0xd2, 0x58, 0x4b, 0x0e, 0x18, 0x11, 0x50, 0xd1, 0x12, 0x2e, 0x52, 0x70, 0x40, 0x44, 0x67,
-    0x55, 0x29, 0xb3, 0x22, 0x3e, 0x21, 0x2a, 0x3e, 0x43, 0x2a, 0x20, 0x3e, 0x40, 0x27, 0xfd, 0x4f,
-    0x02, 0x44, 0x3a, 0x62, 0x68, 0x43, 0x4d, 0x7c, 0x49, 0x4a, 0x7f, 0x50, 0x35, 0x5d, 0x4e, 0x1f,
-    0xc6, 0x18, 0x2e, 0x2b, 0x14, 0x29, 0x40, 0x23, 0x3c, 0x6d, 0x95, 0x5a, 0x82, 0xce, 0x4e, 0x0e,
-    0x1b, 0x0c, 0x3f, 0x46, 0x00, 0x03, 0x00, 0x05, 0x00, 0x00, 0x03, 0x9e, 0x04, 0x8d, 0x00, 0x03,
-    0x00, 0x07, 0x00, 0x0b, 0x00, 0x1d, 0x40, 0x0d, 0x08, 0x09, 0x09, 0x0b, 0x0a, 0x0a, 0x06, 0x07,
-    0x7d, 0x03, 0x02, 0x06, 0x0a, 0x00, 0x3f, 0x33, 0x33, 0x3f, 0x12, 0x39, 0x2f, 0x33, 0x33, 0x2f,
-    0x33, 0x30, 0x31, 0x65, 0x15, 0x21, 0x35, 0x13, 0x11, 0x23, 0x11, 0x01, 0x15, 0x05, 0x35, 0x03,
-    0x9e, 0xfd, 0x8a, 0x4b, 0xf1, 0x01, 0xf2, 0xfd, 0x91, 0xbf, 0xbf, 0xbf, 0x03, 0xce, 0xfb, 0x73,
-    0x04, 0x8d, 0xfe, 0xa1, 0x91, 0xbb, 0x91, 0x00, 0x00, 0x06, 0xff, 0xec, 0x00, 0x00, 0x06, 0x04,
-    0x04, 0x8d, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x10, 0x00, 0x14, 0x00, 0x18, 0x00, 0x33,
-    0x40, 0x18, 0x0a, 0x0b, 0x0b, 0x18, 0x18, 0x0f, 0x07, 0x06, 0x14, 0x13, 0x06, 0x13, 0x06, 0x13,
-    0x0d, 0x0f, 0x7d, 0x03, 0x02, 0x02, 0x17, 0x17, 0x0d, 0x0a, 0x00, 0x3f, 0x33, 0x11, 0x33, 0x11,
-    0x33, 0x3f, 0x12, 0x39, 0x39, 0x2f, 0x2f, 0x11, 0x33, 0x11, 0x33, 0x11, 0x33, 0x11, 0x33, 0x11,
-    0x33, 0x30, 0x31, 0x65, 0x15, 0x21, 0x35, 0x01, 0x15, 0x21, 0x35, 0x01, 0x15, 0x21, 0x35, 0x07,
-    0x01, 0x21, 0x01, 0x33, 0x13, 0x15, 0x21, 0x35, 0x01, 0x13, 0x23, 0x03, 0x06, 0x04, 0xfd, 0x84,
-    0x02, 0x12, 0xfd, 0xd1, 0x02, 0x6e, 0xfd, 0x84, 0x5f, 0xfd, 0xf3, 0xfe, 0xfb, 0x02, 0x6d, 0xa0,
-    0xae, 0xfd, 0x87, 0x02, 0x90, 0x2a, 0xef, 0x2b, 0xbe, 0xbe, 0xbe, 0x02, 0x00, 0xbe, 0xbe, 0x01,
-    0xcf, 0xbe, 0xbe, 0x72, 0xfb, 0xe5, 0x04, 0x8d, 0xfd, 0x37, 0xbc, 0xbc, 0x02, 0xc9, 0xfb, 0x73,
-    0x04, 0x8d, 0x00, 0x02, 0x00, 0x76, 0x00, 0x00, 0x03, 0xd1, 0x04, 0x8d, 0x00, 0x03, 0x00, 0x19,
-    0x00, 0x17, 0x40, 0x0a, 0x0f, 0x10, 0x10, 0x01, 0x7d, 0x05, 0x04, 0x04, 0x00, 0x0a, 0x00, 0x3f,
-    0x32, 0x2f, 0x33, 0x3f, 0x33, 0x2f, 0x33, 0x30, 0x31, 0x73, 0x11, 0x33, 0x11, 0x27, 0x35, 0x33,
-    0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x23, 0x35, 0x33, 0x32, 0x16, 0x16, 0x15, 0x14,
-    0x06, 0x06, 0x23, 0x76, 0xf1, 0x51, 0xeb, 0x4e, 0x62, 0x2f, 0x2f, 0x62, 0x4e, 0xea, 0xea, 0x92,
-    0xd0, 0x6e, 0x6e, 0xd0, 0x92, 0x04, 0x8d, 0xfb, 0x73, 0xe4, 0xc1, 0x2e, 0x53, 0x34, 0x32, 0x55,
-    0x35, 0xc0, 0x62, 0xaa, 0x6e, 0x72, 0xa9, 0x5d, 0x00, 0x03, 0x00, 0x4e, 0xff, 0xc7, 0x04, 0x6e,
-    0x04, 0xbb, 0x00, 0x15, 0x00, 0x2b, 0x00, 0x2f, 0x00, 0x1b, 0x40, 0x0b, 0x2f, 0x2f, 0x1c, 0x11,
-    0x7e, 0x2d, 0x2d, 0x27, 0x06, 0x0b, 0x72, 0x00, 0x2b, 0x32, 0x32, 0x7c, 0x2f, 0x18, 0x3f, 0x33,
-    0x33, 0x7c, 0x2f, 0x30, 0x31, 0x41, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x35,
-    0x34, 0x3e, 0x02, 0x33, 0x32, 0x1e, 0x02, 0x07, 0x35, 0x34, 0x2e, 0x02, 0x23, 0x22, 0x0e, 0x02,
-    0x15, 0x15, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x3e, 0x02, 0x13, 0x01, 0x23, 0x01, 0x04, 0x6e, 0x4c,
-    0x8b, 0xc2, 0x75, 0x75, 0xc2, 0x8e, 0x4d, 0x4d, 0x8c, 0xc2, 0x75, 0x76, 0xc1, 0x8d, 0x4c, 0xf1,
-    0x26, 0x4b, 0x6a, 0x44, 0x43, 0x6b, 0x49, 0x27, 0x27, 0x4b, 0x6b, 0x43, 0x44, 0x69, 0x4a, 0x26,
-    0xec, 0xfc, 0x8e, 0x9f, 0x03, 0x74, 0x02, 0x62, 0x38, 0x85, 0xd2, 0x95, 0x4e, 0x4e, 0x95, 0xd2,
-    0x85, 0x38, 0x85, 0xd2, 0x96, 0x4e, 0x4e, 0x96, 0xd2, 0xbd, 0x3a, 0x5b, 0x8c, 0x60, 0x32, 0x32,
-    0x60, 0x8c, 0x5b, 0x3a, 0x5a, 0x8d, 0x61, 0x33, 0x33, 0x61, 0x8d, 0x02, 0xeb, 0xfb, 0x0c, 0x04,
-    0xf4, 0x00, 0x00, 0x04, 0x00, 0x34, 0x00, 0x00, 0x04, 0xda, 0x04, 0x8d, 0x00, 0x03, 0x00, 0x07,
-    0x00, 0x0b, 0x00, 0x0f, 0x00, 0x1b, 0x40, 0x0c, 0x02, 0x03, 0x80, 0x0e, 0x0f, 0x0f, 0x0b, 0x07,
-    0x7d, 0x0a, 0x06, 0x0a, 0x00, 0x3f, 0x33, 0x3f, 0x33, 0x33, 0x2f, 0x33, 0x1a, 0xcc, 0x32, 0x30,
-    0x31, 0x41, 0x15, 0x21, 0x35, 0x13, 0x11, 0x23, 0x11, 0x21, 0x11, 0x23, 0x11, 0x05, 0x15, 0x21,
-    0x35, 0x03, 0xd0, 0xfd, 0x6c, 0x44, 0xf1, 0x03, 0xf1, 0xf1, 0x01, 0x4b, 0xfb, 0x5a, 0x02, 0x9d,
-    0xc0, 0xc0, 0x01, 0xf0, 0xfb, 0x73, 0x04, 0x8d, 0xfb, 0x73, 0x04, 0x8d, 0x96, 0xa7, 0xa7, 0x00,
-    0x00, 0x02, 0x00, 0x76, 0xfe, 0x4b, 0x04, 0x67, 0x04, 0x8d, 0x00, 0x09, 0x00, 0x1b, 0x00, 0x1f,
-    0x40, 0x0f, 0x17, 0x10, 0x0f, 0x72, 0x09, 0x03, 0x06, 0x7d, 0x08, 0x0a, 0x0a, 0x02, 0x02, 0x05,
-    0x0a, 0x00, 0x3f, 0x33, 0x11, 0x33, 0x11, 0x33, 0x3f, 0x33, 0x33, 0x2b, 0x32, 0x30, 0x31, 0x41,
-    0x11, 0x23, 0x01, 0x11, 0x23, 0x11, 0x33, 0x01, 0x11, 0x11, 0x33, 0x15, 0x14, 0x06, 0x06, 0x23,
-    0x22, 0x26, 0x27, 0x37, 0x16, 0x16, 0x33, 0x32, 0x36, 0x36, 0x35, 0x04, 0x67, 0xf2, 0xfd, 0xf2,
-    0xf1, 0xf1, 0x02, 0x0e, 0xf2, 0x55, 0x9f, 0x6f, 0x23, 0x3c, 0x22, 0x0e, 0x13, 0x3a, 0x15, 0x2a,
-    0x39, 0x1f, 0x04, 0x8d, 0xfb, 0x73, 0x03, 0x23, 0xfc, 0xdd, 0x04, 0x8d, 0xfc, 0xdd, 0x03, 0x23,
-    0xfb, 0xb8, 0x83, 0x79, 0xa8, 0x56, 0x07, 0x0a, 0xc1, 0x06, 0x06, 0x28, 0x4f, 0x3a, 0xff, 0xff,
-    0x00, 0x50, 0x02, 0x0e, 0x02, 0x61, 0x02, 0xce, 0x06, 0x06, 0x00, 0x11, 0x00, 0x00, 0x00, 0x03,
-    0x00, 0x17, 0x00, 0x00, 0x04, 0xf0, 0x05, 0xb0, 0x00, 0x1a, 0x00, 0x1e, 0x00, 0x22, 0x00, 0x23,
-    0x40, 0x11, 0x02, 0x01, 0x01, 0x1d, 0x22, 0x21, 0x21, 0x1d, 0x0e, 0x0f, 0x0f, 0x1e, 0x02, 0x72,
-    0x1d, 0x08, 0x72, 0x00, 0x2b, 0x2b, 0x32, 0x11, 0x33, 0x11, 0x39, 0x2f, 0x33, 0x11, 0x33, 0x11,
-    0x33, 0x30, 0x31, 0x61, 0x21, 0x37, 0x21, 0x32, 0x36, 0x36, 0x35, 0x35, 0x34, 0x2e, 0x02, 0x23,
-    0x21, 0x35, 0x21, 0x32, 0x1e, 0x02, 0x15, 0x15, 0x14, 0x0e, 0x02, 0x01, 0x11, 0x23, 0x11, 0x01,
-    0x15, 0x21, 0x35, 0x02, 0x59, 0xfe, 0xc9, 0x02, 0x01, 0x35, 0x87, 0xb7, 0x5d, 0x35, 0x67, 0x95,
-    0x61, 0xfe, 0xba, 0x01, 0x46, 0x91, 0xf0, 0xaf, 0x5e, 0x5e, 0xb0, 0xf3, 0xfe, 0xbe, 0xfb, 0x02,
-    0x05, 0xfd, 0x60, 0xc7, 0x76, 0xdc, 0x98, 0x4f, 0x76, 0xb6, 0x7c, 0x40, 0xc8, 0x61, 0xb6, 0xfe,
-    0x9d, 0x4d, 0x9d, 0xfe, 0xb5, 0x61, 0x05, 0xb0, 0xfa, 0x50, 0x05, 0xb0, 0xfd, 0x84, 0xa6, 0xa6,
-    0x00, 0x03, 0x00, 0x17, 0x00, 0x00, 0x04, 0xf0, 0x05, 0xb0, 0x00, 0x1a, 0x00, 0x1e, 0x00, 0x22,
-    0x00, 0x23, 0x40, 0x11, 0x02, 0x01, 0x01, 0x1d, 0x22, 0x21, 0x21, 0x1d, 0x0e, 0x0f, 0x0f, 0x1e,
-    0x02, 0x72, 0x1d, 0x08, 0x72, 0x00, 0x2b, 0x2b, 0x32, 0x11, 0x33, 0x11, 0x39, 0x2f, 0x33, 0x11,
-    0x33, 0x11, 0x33, 0x30, 0x31, 0x61, 0x21, 0x37, 0x21, 0x32, 0x36, 0x36, 0x35, 0x35, 0x34, 0x2e,
-    0x02, 0x23, 0x21, 0x35, 0x21, 0x32, 0x1e, 0x02, 0x15, 0x15, 0x14, 0x0e, 0x02, 0x01, 0x11, 0x23,
-    0x11, 0x01, 0x15, 0x21, 0x35, 0x02, 0x59, 0xfe, 0xc9, 0x02, 0x01, 0x35, 0x87, 0xb7, 0x5d, 0x35,
-    0x67, 0x95, 0x61, 0xfe, 0xba, 0x01, 0x46, 0x91, 0xf0, 0xaf, 0x5e, 0x5e, 0xb0, 0xf3, 0xfe, 0xbe,
-    0xfb, 0x02, 0x05, 0xfd, 0x60, 0xc7, 0x76, 0xdc, 0x98, 0x4f, 0x76, 0xb6, 0x7c, 0x40, 0xc8, 0x61,
-    0xb6, 0xfe, 0x9d, 0x4d, 0x9d, 0xfe, 0xb5, 0x61, 0x05, 0xb0, 0xfa, 0x50, 0x05, 0xb0, 0xfd, 0x84,
-    0xa6, 0xa6, 0x00, 0x03, 0xff, 0xf5, 0x00, 0x00, 0x04, 0x18, 0x06, 0x00, 0x00, 0x03, 0x00, 0x1a,
-    0x00, 0x1e, 0x00, 0x19, 0x40, 0x0d, 0x1e, 0x1d, 0x16, 0x0a, 0x07, 0x72, 0x03, 0x00, 0x72, 0x11,
-    0x02, 0x0a, 0x72, 0x00, 0x2b, 0x32, 0x2b, 0x2b, 0x32, 0xc4, 0x32, 0x30, 0x31, 0x41, 0x11, 0x23,
-    0x11, 0x13, 0x27, 0x3e, 0x03, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x11, 0x23, 0x11, 0x34, 0x26, 0x26,
-    0x23, 0x22, 0x0e, 0x02, 0x01, 0x15, 0x21, 0x35, 0x01, 0x88, 0xf0, 0xc6, 0x4e, 0x01, 0x3d, 0x6f,
-    0x9c, 0x5f, 0x50, 0x81, 0x5e, 0x31, 0xf2, 0x2d, 0x56, 0x3e, 0x41, 0x63, 0x42, 0x21, 0x01, 0x37,
-    0xfd, 0x60, 0x06, 0x00, 0xfa, 0x00, 0x06, 0x00, 0xfc, 0x45, 0x01, 0x70, 0xbe, 0x8d, 0x4d, 0x2c,
-    0x61, 0x9b, 0x6f, 0xfd, 0x49, 0x02, 0xb9, 0x4e, 0x5c, 0x29, 0x34, 0x5a, 0x76, 0x02, 0xe7, 0xa6,
-    0xa6, 0x00, 0x00, 0x03, 0x00, 0x2d, 0x00, 0x00, 0x04, 0xb4, 0x05, 0xb0, 0x00, 0x03, 0x00, 0x07,
-    0x00, 0x0b, 0x00, 0x15, 0x40, 0x0a, 0x03, 0x0a, 0x0b, 0x06, 0x07, 0x02, 0x72, 0x01, 0x08, 0x72,
-    0x00, 0x2b, 0x2b, 0x32, 0x2f, 0x33, 0x32, 0x30, 0x31, 0x41, 0x11, 0x23, 0x11, 0x21, 0x15, 0x21,
-    0x35, 0x01, 0x15, 0x21, 0x35, 0x02, 0xeb, 0xf9, 0x02, 0xc2, 0xfb, 0x79, 0x03, 0x8c, 0xfd, 0x60,
-    0x05, 0xb0, 0xfa, 0x50, 0x05, 0xb0, 0xc8, 0xc8, 0xfe, 0x08, 0xa6, 0xa6, 0x00, 0x03, 0xff, 0xeb,
-    0xff, 0xec, 0x02, 0x8b, 0x05, 0x43, 0x00, 0x03, 0x00, 0x15, 0x00, 0x19, 0x00, 0x1d, 0x40, 0x0e,
-    0x0a, 0x11, 0x0b, 0x72, 0x18, 0x19, 0x19, 0x02, 0x02, 0x04, 0x04, 0x03, 0x06, 0x72, 0x00, 0x2b,
-    0x32, 0x2f, 0x32, 0x11, 0x33, 0x2f, 0x33, 0x2b, 0x32, 0x30, 0x31, 0x41, 0x15, 0x21, 0x35, 0x13,
-    0x33, 0x11, 0x14, 0x16, 0x16, 0x33, 0x32, 0x36, 0x37, 0x17, 0x06, 0x06, 0x23, 0x22, 0x26, 0x26,
-    0x35, 0x01, 0x15, 0x21, 0x35, 0x02, 0x6c, 0xfd, 0x9e, 0xb0, 0xf1, 0x1d, 0x34, 0x23, 0x19, 0x2e,
-    0x0e, 0x01, 0x1e, 0x4f, 0x33, 0x53, 0x80, 0x48, 0x01, 0xd1, 0xfd, 0x60, 0x04, 0x3a, 0xb0, 0xb0,
-    0x01, 0x09, 0xfb, 0xe8, 0x32, 0x35, 0x12, 0x06, 0x03, 0xb8, 0x09, 0x0e, 0x3b, 0x86, 0x6f, 0x01,
-    0xc1, 0xa6, 0xa6, 0x00, 0xff, 0xff, 0x00, 0x11, 0x00, 0x00, 0x05, 0x3f, 0x07, 0x37, 0x06, 0x26,
-    0x00, 0x25, 0x00, 0x00, 0x01, 0x07, 0x00, 0x44, 0x01, 0x1b, 0x01, 0x37, 0x00, 0x0b, 0xb6, 0x03,
-    0x10, 0x07, 0x01, 0x01, 0x61, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x11, 0x00, 0x00,
-    0x05, 0x3f, 0x07, 0x37, 0x06, 0x26, 0x00, 0x25, 0x00, 0x00, 0x01, 0x07, 0x00, 0x75, 0x01, 0xc2,
-    0x01, 0x37, 0x00, 0x0b, 0xb6, 0x03, 0x0e, 0x03, 0x01, 0x01, 0x61, 0x56, 0x00, 0x2b, 0x34, 0x00,
-    0xff, 0xff, 0x00, 0x11, 0x00, 0x00, 0x05, 0x3f, 0x07, 0x37, 0x06, 0x26, 0x00, 0x25, 0x00, 0x00,
-    0x01, 0x07, 0x00, 0x9e, 0x00, 0xc2, 0x01, 0x37, 0x00, 0x0b, 0xb6, 0x03, 0x11, 0x07, 0x01, 0x01,
-    0x6c, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x11, 0x00, 0x00, 0x05, 0x3f, 0x07, 0x2b,
-    0x06, 0x26, 0x00, 0x25, 0x00, 0x00, 0x01, 0x07, 0x00, 0xa5, 0x00, 0xc5, 0x01, 0x37, 0x00, 0x0b,
-    0xb6, 0x03, 0x1c, 0x03, 0x01, 0x01, 0x6b, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x11,
-    0x00, 0x00, 0x05, 0x3f, 0x07, 0x04, 0x06, 0x26, 0x00, 0x25, 0x00, 0x00, 0x01, 0x07, 0x00, 0x6a,
-    0x00, 0xe4, 0x01, 0x37, 0x00, 0x0d, 0xb7, 0x04, 0x03, 0x23, 0x07, 0x01, 0x01, 0x78, 0x56, 0x00,
-    0x2b, 0x34, 0x34, 0x00, 0xff, 0xff, 0x00, 0x11, 0x00, 0x00, 0x05, 0x3f, 0x07, 0x90, 0x06, 0x26,
-    0x00, 0x25, 0x00, 0x00, 0x01, 0x07, 0x00, 0xa3, 0x01, 0x58, 0x01, 0x6c, 0x00, 0x0d, 0xb7, 0x04,
-    0x03, 0x19, 0x07, 0x01, 0x01, 0x47, 0x56, 0x00, 0x2b, 0x34, 0x34, 0x00, 0xff, 0xff, 0x00, 0x11,
-    0x00, 0x00, 0x05, 0x3f, 0x07, 0xb1, 0x06, 0x26, 0x00, 0x25, 0x00, 0x00, 0x01, 0x07, 0x02, 0x41,
-    0x01, 0x58, 0x01, 0x17, 0x00, 0x12, 0xb6, 0x05, 0x04, 0x03, 0x1b, 0x07, 0x01, 0x00, 0xb8, 0xff,
-    0xb2, 0xb0, 0x56, 0x00, 0x2b, 0x34, 0x34, 0x34, 0xff, 0xff, 0x00, 0x66, 0xfe, 0x39, 0x04, 0xeb,
-    0x05, 0xc4, 0x06, 0x26, 0x00, 0x27, 0x00, 0x00, 0x01, 0x07, 0x00, 0x79, 0x01, 0xcb, 0xff, 0xfa,
-    0x00, 0x0b, 0xb6, 0x01, 0x28, 0x05, 0x00, 0x00, 0x0a, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff,
-    0x00, 0x94, 0x00, 0x00, 0x04, 0x4d, 0x07, 0x3e, 0x06, 0x26, 0x00, 0x29, 0x00, 0x00, 0x01, 0x07,
-    0x00, 0x44, 0x00, 0xe5, 0x01, 0x3e, 0x00, 0x0b, 0xb6, 0x04, 0x12, 0x07, 0x01, 0x01, 0x6c, 0x56,
-    0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x94, 0x00, 0x00, 0x04, 0x4d, 0x07, 0x3e, 0x06, 0x26,
-    0x00, 0x29, 0x00, 0x00, 0x01, 0x07, 0x00, 0x75, 0x01, 0x8c, 0x01, 0x3e, 0x00, 0x0b, 0xb6, 0x04,
-    0x10, 0x07, 0x01, 0x01, 0x6c, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x94, 0x00, 0x00,
-    0x04, 0x4d, 0x07, 0x3e, 0x06, 0x26, 0x00, 0x29, 0x00, 0x00, 0x01, 0x07, 0x00, 0x9e, 0x00, 0x8d,
-    0x01, 0x3e, 0x00, 0x0b, 0xb6, 0x04, 0x13, 0x07, 0x01, 0x01, 0x77, 0x56, 0x00, 0x2b, 0x34, 0x00,
-    0xff, 0xff, 0x00, 0x94, 0x00, 0x00, 0x04, 0x4d, 0x07, 0x0b, 0x06, 0x26, 0x00, 0x29, 0x00, 0x00,
-    0x01, 0x07, 0x00, 0x6a, 0x00, 0xae, 0x01, 0x3e, 0x00, 0x0d, 0xb7, 0x05, 0x04, 0x25, 0x07, 0x01,
-    0x01, 0x83, 0x56, 0x00, 0x2b, 0x34, 0x34, 0x00, 0xff, 0xff, 0xff, 0xcb, 0x00, 0x00, 0x01, 0xa0,
-    0x07, 0x3e, 0x06, 0x26, 0x00, 0x2d, 0x00, 0x00, 0x01, 0x07, 0x00, 0x44, 0xff, 0x93, 0x01, 0x3e,
-    0x00, 0x0b, 0xb6, 0x01, 0x06, 0x03, 0x01, 0x01, 0x6c, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff,
-    0x00, 0xa5, 0x00, 0x00, 0x02, 0x7c, 0x07, 0x3e, 0x06, 0x26, 0x00, 0x2d, 0x00, 0x00, 0x01, 0x07,
-    0x00, 0x75, 0x00, 0x3a, 0x01, 0x3e, 0x00, 0x0b, 0xb6, 0x01, 0x04, 0x03, 0x01, 0x01, 0x6c, 0x56,
-    0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0xff, 0xca, 0x00, 0x00, 0x02, 0x7e, 0x07, 0x3e, 0x06, 0x26,
-    0x00, 0x2d, 0x00, 0x00, 0x01, 0x07, 0x00, 0x9e, 0xff, 0x3a, 0x01, 0x3e, 0x00, 0x0b, 0xb6, 0x01,
-    0x07, 0x03, 0x01, 0x01, 0x77, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0xff, 0xbe, 0x00, 0x00,
-    0x02, 0x87, 0x07, 0x0b, 0x06, 0x26, 0x00, 0x2d, 0x00, 0x00, 0x01, 0x07, 0x00, 0x6a, 0xff, 0x5b,
-    0x01, 0x3e, 0x00, 0x0d, 0xb7, 0x02, 0x01, 0x19, 0x03, 0x01, 0x01, 0x83, 0x56, 0x00, 0x2b, 0x34,
-    0x34, 0x00, 0xff, 0xff, 0x00, 0x94, 0x00, 0x00, 0x05, 0x17, 0x07, 0x2b, 0x06, 0x26, 0x00, 0x32,
-    0x00, 0x00, 0x01, 0x07, 0x00, 0xa5, 0x00, 0xf1, 0x01, 0x37, 0x00, 0x0b, 0xb6, 0x01, 0x18, 0x06,
-    0x01, 0x01, 0x6b, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x65, 0xff, 0xec, 0x05, 0x1d,
-    0x07, 0x38, 0x06, 0x26, 0x00, 0x33, 0x00, 0x00, 0x01, 0x07, 0x00, 0x44, 0x01, 0x33, 0x01, 0x38,
-    0x00, 0x0b, 0xb6, 0x02, 0x2e, 0x11, 0x01, 0x01, 0x4f, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff,
-    0x00, 0x65, 0xff, 0xec, 0x05, 0x1d, 0x07, 0x38, 0x06, 0x26, 0x00, 0x33, 0x00, 0x00, 0x01, 0x07,
-    0x00, 0x75, 0x01, 0xda, 0x01, 0x38, 0x00, 0x0b, 0xb6, 0x02, 0x2c, 0x11, 0x01, 0x01, 0x4f, 0x56,
-    0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x65, 0xff, 0xec, 0x05, 0x1d, 0x07, 0x38, 0x06, 0x26,
-    0x00, 0x33, 0x00, 0x00, 0x01, 0x07, 0x00, 0x9e, 0x00, 0xda, 0x01, 0x38, 0x00, 0x0b, 0xb6, 0x02,
-    0x2f, 0x11, 0x01, 0x01, 0x5a, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x65, 0xff, 0xec,
-    0x05, 0x1d, 0x07, 0x2c, 0x06, 0x26, 0x00, 0x33, 0x00, 0x00, 0x01, 0x07, 0x00, 0xa5, 0x00, 0xdd,
-    0x01, 0x39, 0x00, 0x0b, 0xb6, 0x02, 0x3a, 0x11, 0x01, 0x01, 0x59, 0x56, 0x00, 0x2b, 0x34, 0x00,
-    0xff, 0xff, 0x00, 0x65, 0xff, 0xec, 0x05, 0x1d, 0x07, 0x05, 0x06, 0x26, 0x00, 0x33, 0x00, 0x00,
-    0x01, 0x07, 0x00, 0x6a, 0x00, 0xfc, 0x01, 0x38, 0x00, 0x0d, 0xb7, 0x03, 0x02, 0x41, 0x11, 0x01,
-    0x01, 0x66, 0x56, 0x00, 0x2b, 0x34, 0x34, 0x00, 0xff, 0xff, 0x00, 0x80, 0xff, 0xec, 0x04, 0xbf,
-    0x07, 0x37, 0x06, 0x26, 0x00, 0x39, 0x00, 0x00, 0x01, 0x07, 0x00, 0x44, 0x01, 0x0f, 0x01, 0x37,
-    0x00, 0x0b, 0xb6, 0x01, 0x18, 0x00, 0x01, 0x01, 0x61, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff,
-    0x00, 0x80, 0xff, 0xec, 0x04, 0xbf, 0x07, 0x37, 0x06, 0x26, 0x00, 0x39, 0x00, 0x00, 0x01, 0x07,
-    0x00, 0x75, 0x01, 0xb6, 0x01, 0x37, 0x00, 0x0b, 0xb6, 0x01, 0x16, 0x0b, 0x01, 0x01, 0x61, 0x56,
-    0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x80, 0xff, 0xec, 0x04, 0xbf, 0x07, 0x37, 0x06, 0x26,
-    0x00, 0x39, 0x00, 0x00, 0x01, 0x07, 0x00, 0x9e, 0x00, 0xb6, 0x01, 0x37, 0x00, 0x0b, 0xb6, 0x01,
-    0x19, 0x00, 0x01, 0x01, 0x6c, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x80, 0xff, 0xec,
-    0x04, 0xbf, 0x07, 0x04, 0x06, 0x26, 0x00, 0x39, 0x00, 0x00, 0x01, 0x07, 0x00, 0x6a, 0x00, 0xd7,
-    0x01, 0x37, 0x00, 0x0d, 0xb7, 0x02, 0x01, 0x2b, 0x00, 0x01, 0x01, 0x78, 0x56, 0x00, 0x2b, 0x34,
-    0x34, 0x00, 0xff, 0xff, 0x00, 0x08, 0x00, 0x00, 0x04, 0xd9, 0x07, 0x36, 0x06, 0x26, 0x00, 0x3d,
-    0x00, 0x00, 0x01, 0x07, 0x00, 0x75, 0x01, 0x8c, 0x01, 0x36, 0x00, 0x0b, 0xb6, 0x01, 0x09, 0x02,
-    0x01, 0x01, 0x60, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x56, 0xff, 0xec, 0x03, 0xf9,
-    0x06, 0x00, 0x06, 0x26, 0x00, 0x45, 0x00, 0x00, 0x01, 0x07, 0x00, 0x44, 0x00, 0xa6, 0x00, 0x00,
-    0x00, 0x0b, 0xb6, 0x02, 0x3d, 0x0f, 0x01, 0x01, 0x8c, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff,
-    0x00, 0x56, 0xff, 0xec, 0x03, 0xf9, 0x06, 0x00, 0x06, 0x26, 0x00, 0x45, 0x00, 0x00, 0x01, 0x07,
-    0x00, 0x75, 0x01, 0x4d, 0x00, 0x00, 0x00, 0x0b, 0xb6, 0x02, 0x3b, 0x0f, 0x01, 0x01, 0x8c, 0x56,
-    0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x56, 0xff, 0xec, 0x03, 0xf9, 0x06, 0x00, 0x06, 0x26,
-    0x00, 0x45, 0x00, 0x00, 0x01, 0x06, 0x00, 0x9e, 0x4d, 0x00, 0x00, 0x0b, 0xb6, 0x02, 0x3e, 0x0f,
-    0x01, 0x01, 0x97, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x56, 0xff, 0xec, 0x03, 0xf9,
-    0x05, 0xf4, 0x06, 0x26, 0x00, 0x45, 0x00, 0x00, 0x01, 0x06, 0x00, 0xa5, 0x50, 0x01, 0x00, 0x0b,
-    0xb6, 0x02, 0x49, 0x0f, 0x01, 0x01, 0x96, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x56,
-    0xff, 0xec, 0x03, 0xf9, 0x05, 0xcd, 0x06, 0x26, 0x00, 0x45, 0x00, 0x00, 0x01, 0x07, 0x00, 0x6a,
-    0x00, 0x6f, 0x00, 0x00, 0x00, 0x0d, 0xb7, 0x03, 0x02, 0x50, 0x0f, 0x01, 0x01, 0xa3, 0x56, 0x00,
-    0x2b, 0x34, 0x34, 0x00, 0xff, 0xff, 0x00, 0x56, 0xff, 0xec, 0x03, 0xf9, 0x06, 0x5a, 0x06, 0x26,
-    0x00, 0x45, 0x00, 0x00, 0x01, 0x07, 0x00, 0xa3, 0x00, 0xe3, 0x00, 0x35, 0x00, 0x0d, 0xb7, 0x03,
-    0x02, 0x46, 0x0f, 0x01, 0x01, 0x72, 0x56, 0x00, 0x2b, 0x34, 0x34, 0x00, 0xff, 0xff, 0x00, 0x56,
-    0xff, 0xec, 0x03, 0xf9, 0x06, 0x7a, 0x06, 0x26, 0x00, 0x45, 0x00, 0x00, 0x01, 0x07, 0x02, 0x41,
-    0x00, 0xe2, 0xff, 0xe0, 0x00, 0x12, 0xb6, 0x04, 0x03, 0x02, 0x48, 0x0f, 0x00, 0x00, 0xb8, 0xff,
-    0xdd, 0xb0, 0x56, 0x00, 0x2b, 0x34, 0x34, 0x34, 0xff, 0xff, 0x00, 0x4e, 0xfe, 0x39, 0x03, 0xf1,
-    0x04, 0x4e, 0x06, 0x26, 0x00, 0x47, 0x00, 0x00, 0x01, 0x07, 0x00, 0x79, 0x01, 0x41, 0xff, 0xfa,
-    0x00, 0x0b, 0xb6, 0x01, 0x28, 0x09, 0x00, 0x00, 0x0a, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff,
-    0x00, 0x51, 0xff, 0xec, 0x04, 0x0a, 0x06, 0x00, 0x06, 0x26, 0x00, 0x49, 0x00, 0x00, 0x01, 0x07,
-    0x00, 0x44, 0x00, 0x9b, 0x00, 0x00, 0x00, 0x0b, 0xb6, 0x01, 0x2e, 0x0b, 0x01, 0x01, 0x8c, 0x56,
-    0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x51, 0xff, 0xec, 0x04, 0x0a, 0x06, 0x00, 0x06, 0x26,
-    0x00, 0x49, 0x00, 0x00, 0x01, 0x07, 0x00, 0x75, 0x01, 0x42, 0x00, 0x00, 0x00, 0x0b, 0xb6, 0x01,
-    0x2c, 0x0b, 0x01, 0x01, 0x8c, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x51, 0xff, 0xec,
-    0x04, 0x0a, 0x06, 0x00, 0x06, 0x26, 0x00, 0x49, 0x00, 0x00, 0x01, 0x06, 0x00, 0x9e, 0x42, 0x00,
-    0x00, 0x0b, 0xb6, 0x01, 0x2f, 0x0b, 0x01, 0x01, 0x97, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff,
-    0x00, 0x51, 0xff, 0xec, 0x04, 0x0a, 0x05, 0xce, 0x06, 0x26, 0x00, 0x49, 0x00, 0x00, 0x01, 0x07,
-    0x00, 0x6a, 0x00, 0x63, 0x00, 0x00, 0x00, 0x0d, 0xb7, 0x02, 0x01, 0x41, 0x0b, 0x01, 0x01, 0xa3,
-    0x56, 0x00, 0x2b, 0x34, 0x34, 0x00, 0xff, 0xff, 0xff, 0xb5, 0x00, 0x00, 0x01, 0x88, 0x05, 0xf7,
-    0x06, 0x26, 0x00, 0x8d, 0x00, 0x00, 0x01, 0x07, 0x00, 0x44, 0xff, 0x7c, 0xff, 0xf7, 0x00, 0x0b,
-    0xb6, 0x01, 0x06, 0x03, 0x01, 0x01, 0x9e, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x90,
-    0x00, 0x00, 0x02, 0x65, 0x05, 0xf7, 0x06, 0x26, 0x00, 0x8d, 0x00, 0x00, 0x01, 0x06, 0x00, 0x75,
-    0x23, 0xf7, 0x00, 0x0b, 0xb6, 0x01, 0x04, 0x03, 0x01, 0x01, 0x9e, 0x56, 0x00, 0x2b, 0x34, 0x00,
-    0xff, 0xff, 0xff, 0xb3, 0x00, 0x00, 0x02, 0x68, 0x05, 0xf7, 0x06, 0x26, 0x00, 0x8d, 0x00, 0x00,
-    0x01, 0x07, 0x00, 0x9e, 0xff, 0x24, 0xff, 0xf7, 0x00, 0x0b, 0xb6, 0x01, 0x07, 0x03, 0x01, 0x01,
-    0xa9, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0xff, 0xa8, 0x00, 0x00, 0x02, 0x70, 0x05, 0xc4,
-    0x06, 0x26, 0x00, 0x8d, 0x00, 0x00, 0x01, 0x07, 0x00, 0x6a, 0xff, 0x45, 0xff, 0xf7, 0x00, 0x0d,
-    0xb7, 0x02, 0x01, 0x19, 0x03, 0x01, 0x01, 0xb5, 0x56, 0x00, 0x2b, 0x34, 0x34, 0x00, 0xff, 0xff,
-    0x00, 0x7a, 0x00, 0x00, 0x03, 0xfa, 0x05, 0xf4, 0x06, 0x26, 0x00, 0x52, 0x00, 0x00, 0x01, 0x06,
-    0x00, 0xa5, 0x5a, 0x01, 0x00, 0x0b, 0xb6, 0x02, 0x2a, 0x03, 0x01, 0x01, 0xaa, 0x56, 0x00, 0x2b,
-    0x34, 0x00, 0xff, 0xff, 0x00, 0x4e, 0xff, 0xec, 0x04, 0x3c, 0x06, 0x00, 0x06, 0x26, 0x00, 0x53,
-    0x00, 0x00, 0x01, 0x07, 0x00, 0x44, 0x00, 0xb1, 0x00, 0x00, 0x00, 0x0b, 0xb6, 0x02, 0x2e, 0x06,
-    0x01, 0x01, 0x8c, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x4e, 0xff, 0xec, 0x04, 0x3c,
-    0x06, 0x00, 0x06, 0x26, 0x00, 0x53, 0x00, 0x00, 0x01, 0x07, 0x00, 0x75, 0x01, 0x57, 0x00, 0x00,
-    0x00, 0x0b, 0xb6, 0x02, 0x2c, 0x06, 0x01, 0x01, 0x8c, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff,
-    0x00, 0x4e, 0xff, 0xec, 0x04, 0x3c, 0x06, 0x00, 0x06, 0x26, 0x00, 0x53, 0x00, 0x00, 0x01, 0x06,
-    0x00, 0x9e, 0x58, 0x00, 0x00, 0x0b, 0xb6, 0x02, 0x2f, 0x06, 0x01, 0x01, 0x97, 0x56, 0x00, 0x2b,
-    0x34, 0x00, 0xff, 0xff, 0x00, 0x4e, 0xff, 0xec, 0x04, 0x3c, 0x05, 0xf4, 0x06, 0x26, 0x00, 0x53,
-    0x00, 0x00, 0x01, 0x06, 0x00, 0xa5, 0x5b, 0x01, 0x00, 0x0b, 0xb6, 0x02, 0x3a, 0x06, 0x01, 0x01,
-    0x96, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x4e, 0xff, 0xec, 0x04, 0x3c, 0x05, 0xcd,
-    0x06, 0x26, 0x00, 0x53, 0x00, 0x00, 0x01, 0x07, 0x00, 0x6a, 0x00, 0x79, 0x00, 0x00, 0x00, 0x0d,
-    0xb7, 0x03, 0x02, 0x41, 0x06, 0x01, 0x01, 0xa3, 0x56, 0x00, 0x2b, 0x34, 0x34, 0x00, 0xff, 0xff,
-    0x00, 0x77, 0xff, 0xec, 0x03, 0xf9, 0x06, 0x00, 0x06, 0x26, 0x00, 0x59, 0x00, 0x00, 0x01, 0x07,
-    0x00, 0x44, 0x00, 0xac, 0x00, 0x00, 0x00, 0x0b, 0xb6, 0x02, 0x1e, 0x11, 0x01, 0x01, 0xa0, 0x56,
-    0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x77, 0xff, 0xec, 0x03, 0xf9, 0x06, 0x00, 0x06, 0x26,
-    0x00, 0x59, 0x00, 0x00, 0x01, 0x07, 0x00, 0x75, 0x01, 0x52, 0x00, 0x00, 0x00, 0x0b, 0xb6, 0x02,
-    0x1c, 0x11, 0x01, 0x01, 0xa0, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x77, 0xff, 0xec,
-    0x03, 0xf9, 0x06, 0x00, 0x06, 0x26, 0x00, 0x59, 0x00, 0x00, 0x01, 0x06, 0x00, 0x9e, 0x53, 0x00,
-    0x00, 0x0b, 0xb6, 0x02, 0x1f, 0x11, 0x01, 0x01, 0xab, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff,
-    0x00, 0x77, 0xff, 0xec, 0x03, 0xf9, 0x05, 0xcd, 0x06, 0x26, 0x00, 0x59, 0x00, 0x00, 0x01, 0x07,
-    0x00, 0x6a, 0x00, 0x74, 0x00, 0x00, 0x00, 0x0d, 0xb7, 0x03, 0x02, 0x31, 0x11, 0x01, 0x01, 0xb7,
-    0x56, 0x00, 0x2b, 0x34, 0x34, 0x00, 0xff, 0xff, 0x00, 0x0c, 0xfe, 0x4b, 0x03, 0xde, 0x06, 0x00,
-    0x06, 0x26, 0x00, 0x5d, 0x00, 0x00, 0x01, 0x07, 0x00, 0x75, 0x01, 0x1b, 0x00, 0x00, 0x00, 0x0b,
-    0xb6, 0x02, 0x19, 0x01, 0x01, 0x01, 0xa0, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x0c,
-    0xfe, 0x4b, 0x03, 0xde, 0x05, 0xcd, 0x06, 0x26, 0x00, 0x5d, 0x00, 0x00, 0x01, 0x06, 0x00, 0x6a,
-    0x3d, 0x00, 0x00, 0x0d, 0xb7, 0x03, 0x02, 0x2e, 0x01, 0x01, 0x01, 0xb7, 0x56, 0x00, 0x2b, 0x34,
-    0x34, 0x00, 0xff, 0xff, 0x00, 0x11, 0x00, 0x00, 0x05, 0x3f, 0x06, 0xe3, 0x06, 0x26, 0x00, 0x25,
-    0x00, 0x00, 0x01, 0x07, 0x00, 0x70, 0x00, 0xbd, 0x01, 0x39, 0x00, 0x0b, 0xb6, 0x03, 0x10, 0x03,
-    0x01, 0x01, 0xa6, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x56, 0xff, 0xec, 0x03, 0xf9,
-    0x05, 0xad, 0x06, 0x26, 0x00, 0x45, 0x00, 0x00, 0x01, 0x06, 0x00, 0x70, 0x48, 0x03, 0x00, 0x0b,
-    0xb6, 0x02, 0x3d, 0x0f, 0x01, 0x01, 0xd1, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x11,
-    0x00, 0x00, 0x05, 0x3f, 0x07, 0x1d, 0x06, 0x26, 0x00, 0x25, 0x00, 0x00, 0x01, 0x07, 0x00, 0xa1,
-    0x00, 0xf0, 0x01, 0x37, 0x00, 0x0b, 0xb6, 0x03, 0x13, 0x07, 0x01, 0x01, 0x53, 0x56, 0x00, 0x2b,
-    0x34, 0x00, 0xff, 0xff, 0x00, 0x56, 0xff, 0xec, 0x03, 0xf9, 0x05, 0xe7, 0x06, 0x26, 0x00, 0x45,
-    0x00, 0x00, 0x01, 0x07, 0x00, 0xa1, 0x00, 0x7b, 0x00, 0x00, 0x00, 0x0b, 0xb6, 0x02, 0x40, 0x0f,
-    0x01, 0x01, 0x7e, 0x56, 0x00, 0x2b, 0x34, 0x00, 0x00, 0x04, 0x00, 0x11, 0xfe, 0x54, 0x05, 0x3f,
-    0x05, 0xb0, 0x00, 0x04, 0x00, 0x09, 0x00, 0x0d, 0x00, 0x23, 0x00, 0x2b, 0x40, 0x15, 0x0d, 0x0c,
-    0x0c, 0x03, 0x16, 0x1d, 0x06, 0x00, 0x02, 0x07, 0x03, 0x02, 0x72, 0x0e, 0x0f, 0x0f, 0x05, 0x05,
-    0x02, 0x08, 0x72, 0x00, 0x2b, 0x32, 0x11, 0x33, 0x11, 0x33, 0x2b, 0x32, 0x12, 0x39, 0x39, 0x2f,
-    0x33, 0x12, 0x39, 0x2f, 0x33, 0x30, 0x31, 0x41, 0x01, 0x21, 0x01, 0x33, 0x01, 0x01, 0x27, 0x33,
-    0x01, 0x01, 0x15, 0x21, 0x35, 0x01, 0x17, 0x0e, 0x02, 0x15, 0x14, 0x16, 0x33, 0x32, 0x36, 0x37,
-    0x17, 0x06, 0x06, 0x23, 0x22, 0x26, 0x35, 0x34, 0x36, 0x36, 0x02, 0xcb, 0xfe, 0x4d, 0xfe, 0xf9,
-    0x02, 0x24, 0xa8, 0x01, 0x5a, 0xfe, 0x4c, 0x13, 0xa9, 0x02, 0x26, 0xfe, 0xe3, 0xfc, 0xe8, 0x03,
-    0x82, 0x73, 0x2e, 0x4a, 0x29, 0x20, 0x27, 0x1e, 0x2c, 0x0f, 0x17, 0x19, 0x4e, 0x3c, 0x58, 0x7b,
-    0x2e, 0x68, 0x04, 0xee, 0xfb, 0x12, 0x05, 0xb0, 0xfa, 0x50, 0x04, 0xee, 0xc2, 0xfa, 0x50, 0x02,
-    0x1c, 0xc7, 0xc7, 0xfe, 0x1e, 0x3a, 0x1e, 0x3d, 0x45, 0x28, 0x1e, 0x27, 0x11, 0x07, 0x8b, 0x0f,
-    0x1d, 0x66, 0x62, 0x34, 0x65, 0x5d, 0x00, 0x03, 0x00, 0x56, 0xfe, 0x54, 0x03, 0xf9, 0x04, 0x4e,
-    0x00, 0x1b, 0x00, 0x3a, 0x00, 0x50, 0x00, 0x2b, 0x40, 0x17, 0x1e, 0x3a, 0x3a, 0x0f, 0x43, 0x4a,
-    0x0f, 0x72, 0x27, 0x31, 0x0b, 0x72, 0x3b, 0x3c, 0x3c, 0x19, 0x0a, 0x72, 0x09, 0x05, 0x0f, 0x07,
-    0x72, 0x00, 0x2b, 0x32, 0x32, 0x2b, 0x32, 0x11, 0x33, 0x2b, 0x32, 0x2b, 0x32, 0x12, 0x39, 0x2f,
-    0x33, 0x30, 0x31, 0x65, 0x11, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x15, 0x23, 0x34, 0x3e,
-    0x02, 0x33, 0x32, 0x16, 0x16, 0x15, 0x11, 0x14, 0x16, 0x17, 0x15, 0x23, 0x26, 0x26, 0x13, 0x17,
-    0x23, 0x22, 0x0e, 0x02, 0x15, 0x14, 0x16, 0x16, 0x33, 0x32, 0x36, 0x36, 0x37, 0x17, 0x0e, 0x03,
-    0x23, 0x22, 0x26, 0x26, 0x35, 0x34, 0x3e, 0x02, 0x33, 0x01, 0x17, 0x0e, 0x02, 0x15, 0x14, 0x16,
-    0x33, 0x32, 0x36, 0x37, 0x17, 0x06, 0x06, 0x23, 0x22, 0x26, 0x35, 0x34, 0x36, 0x36, 0x02, 0xde,
-    0x2a, 0x55, 0x40, 0x3b, 0x56, 0x30, 0xf0, 0x3e, 0x76, 0xa4, 0x66, 0x7a, 0xbd, 0x6d, 0x15, 0x14,
-    0xf7, 0x11, 0x13, 0x23, 0x02, 0xad, 0x43, 0x66, 0x44, 0x22, 0x28, 0x4d, 0x37, 0x4a, 0x6f, 0x40,
-    0x02, 0x4e, 0x0c, 0x3a, 0x5d, 0x81, 0x54, 0x6a, 0xa6, 0x5e, 0x41, 0x7f, 0xb8, 0x76, 0x01, 0x19,
-    0x73, 0x2f, 0x49, 0x2a, 0x20, 0x27, 0x1f, 0x2c, 0x0e, 0x17, 0x19, 0x4e, 0x3c, 0x58, 0x7a, 0x2e,
-    0x68, 0xd9, 0x02, 0x04, 0x3a, 0x54, 0x2e, 0x28, 0x44, 0x2b, 0x40, 0x78, 0x5e, 0x36, 0x52, 0xa5,
-    0x7c, 0xfe, 0x1f, 0x4a, 0x75, 0x2b, 0x10, 0x27, 0x79, 0x01, 0xf2, 0x95, 0x19, 0x30, 0x44, 0x2b,
-    0x2b, 0x47, 0x28, 0x3d, 0x59, 0x28, 0x6b, 0x29, 0x5e, 0x55, 0x36, 0x55, 0x91, 0x5c, 0x56, 0x85,
-    0x5a, 0x2f, 0xfd, 0xa8, 0x3a, 0x1e, 0x3d, 0x45, 0x28, 0x1e, 0x27, 0x11, 0x07, 0x8b, 0x0f, 0x1d,
-    0x66, 0x62, 0x34, 0x65, 0x5d, 0x00, 0xff, 0xff, 0x00, 0x66, 0xff, 0xec, 0x04, 0xeb, 0x07, 0x4b,
-    0x06, 0x26, 0x00, 0x27, 0x00, 0x00, 0x01, 0x07, 0x00, 0x75, 0x01, 0xc4, 0x01, 0x4b, 0x00, 0x0b,
-    0xb6, 0x01, 0x28, 0x10, 0x01, 0x01, 0x6d, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x4e,
-    0xff, 0xec, 0x03, 0xf1, 0x06, 0x00, 0x06, 0x26, 0x00, 0x47, 0x00, 0x00, 0x01, 0x07, 0x00, 0x75,
-    0x01, 0x2e, 0x00, 0x00, 0x00, 0x0b, 0xb6, 0x01, 0x28, 0x14, 0x01, 0x01, 0x8c, 0x56, 0x00, 0x2b,
-    0x34, 0x00, 0xff, 0xff, 0x00, 0x66, 0xff, 0xec, 0x04, 0xeb, 0x07, 0x4b, 0x06, 0x26, 0x00, 0x27,
-    0x00, 0x00, 0x01, 0x07, 0x00, 0x9e, 0x00, 0xc5, 0x01, 0x4b, 0x00, 0x0b, 0xb6, 0x01, 0x2b, 0x10,
-    0x01, 0x01, 0x78, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x4e, 0xff, 0xec, 0x03, 0xf1,
-    0x06, 0x00, 0x06, 0x26, 0x00, 0x47, 0x00, 0x00, 0x01, 0x06, 0x00, 0x9e, 0x2f, 0x00, 0x00, 0x0b,
-    0xb6, 0x01, 0x2b, 0x14, 0x01, 0x01, 0x97, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x66,
-    0xff, 0xec, 0x04, 0xeb, 0x07, 0x28, 0x06, 0x26, 0x00, 0x27, 0x00, 0x00, 0x01, 0x07, 0x00, 0xa2,
-    0x01, 0xa9, 0x01, 0x53, 0x00, 0x0b, 0xb6, 0x01, 0x31, 0x10, 0x01, 0x01, 0x82, 0x56, 0x00, 0x2b,
-    0x34, 0x00, 0xff, 0xff, 0x00, 0x4e, 0xff, 0xec, 0x03, 0xf1, 0x05, 0xdd, 0x06, 0x26, 0x00, 0x47,
-    0x00, 0x00, 0x01, 0x07, 0x00, 0xa2, 0x01, 0x13, 0x00, 0x08, 0x00, 0x0b, 0xb6, 0x01, 0x31, 0x14,
-    0x01, 0x01, 0xa1, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x66, 0xff, 0xec, 0x04, 0xeb,
-    0x07, 0x4b, 0x06, 0x26, 0x00, 0x27, 0x00, 0x00, 0x01, 0x07, 0x00, 0x9f, 0x00, 0xdb, 0x01, 0x4b,
-    0x00, 0x0b, 0xb6, 0x01, 0x2e, 0x10, 0x01, 0x01, 0x76, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff,
-    0x00, 0x4e, 0xff, 0xec, 0x03, 0xf1, 0x06, 0x00, 0x06, 0x26, 0x00, 0x47, 0x00, 0x00, 0x01, 0x06,
-    0x00, 0x9f, 0x45, 0x00, 0x00, 0x0b, 0xb6, 0x01, 0x2e, 0x14, 0x01, 0x01, 0x95, 0x56, 0x00, 0x2b,
-    0x34, 0x00, 0xff, 0xff, 0x00, 0x94, 0x00, 0x00, 0x04, 0xd2, 0x07, 0x3d, 0x06, 0x26, 0x00, 0x28,
-    0x00, 0x00, 0x01, 0x07, 0x00, 0x9f, 0x00, 0x61, 0x01, 0x3e, 0x00, 0x0b, 0xb6, 0x02, 0x25, 0x1e,
-    0x01, 0x01, 0x75, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x50, 0xff, 0xec, 0x05, 0x58,
-    0x06, 0x02, 0x04, 0x26, 0x00, 0x48, 0x00, 0x00, 0x01, 0x07, 0x01, 0xd4, 0x04, 0x04, 0x05, 0x02,
-    0x00, 0x0b, 0xb6, 0x03, 0x39, 0x01, 0x01, 0x00, 0x00, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff,
-    0x00, 0x94, 0x00, 0x00, 0x04, 0x4d, 0x06, 0xea, 0x06, 0x26, 0x00, 0x29, 0x00, 0x00, 0x01, 0x07,
-    0x00, 0x70, 0x00, 0x87, 0x01, 0x40, 0x00, 0x0b, 0xb6, 0x04, 0x12, 0x07, 0x01, 0x01, 0xb1, 0x56,
-    0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x51, 0xff, 0xec, 0x04, 0x0a, 0x05, 0xad, 0x06, 0x26,
-    0x00, 0x49, 0x00, 0x00, 0x01, 0x06, 0x00, 0x70, 0x3c, 0x03, 0x00, 0x0b, 0xb6, 0x01, 0x2e, 0x0b,
-    0x01, 0x01, 0xd1, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x94, 0x00, 0x00, 0x04, 0x4d,
-    0x07, 0x24, 0x06, 0x26, 0x00, 0x29, 0x00, 0x00, 0x01, 0x07, 0x00, 0xa1, 0x00, 0xba, 0x01, 0x3e,
-    0x00, 0x0b, 0xb6, 0x04, 0x15, 0x07, 0x01, 0x01, 0x5e, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff,
-    0x00, 0x51, 0xff, 0xec, 0x04, 0x0a, 0x05, 0xe7, 0x06, 0x26, 0x00, 0x49, 0x00, 0x00, 0x01, 0x07,
-    0x00, 0xa1, 0x00, 0x70, 0x00, 0x00, 0x00, 0x0b, 0xb6, 0x01, 0x31, 0x0b, 0x01, 0x01, 0x7e, 0x56,
-    0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x94, 0x00, 0x00, 0x04, 0x4d, 0x07, 0x1b, 0x06, 0x26,
-    0x00, 0x29, 0x00, 0x00, 0x01, 0x07, 0x00, 0xa2, 0x01, 0x71, 0x01, 0x46, 0x00, 0x0b, 0xb6, 0x04,
-    0x19, 0x07, 0x01, 0x01, 0x81, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x51, 0xff, 0xec,
-    0x04, 0x0a, 0x05, 0xde, 0x06, 0x26, 0x00, 0x49, 0x00, 0x00, 0x01, 0x07, 0x00, 0xa2, 0x01, 0x26,
-    0x00, 0x09, 0x00, 0x0b, 0xb6, 0x01, 0x35, 0x0b, 0x01, 0x01, 0xa1, 0x56, 0x00, 0x2b, 0x34, 0x00,
-    0x00, 0x05, 0x00, 0x94, 0xfe, 0x54, 0x04, 0x4d, 0x05, 0xb0, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0b,
-    0x00, 0x0f, 0x00, 0x25, 0x00, 0x29, 0x40, 0x14, 0x0a, 0x0b, 0x0b, 0x18, 0x1f, 0x0e, 0x0f, 0x0f,
-    0x07, 0x02, 0x72, 0x10, 0x11, 0x11, 0x03, 0x02, 0x02, 0x06, 0x08, 0x72, 0x00, 0x2b, 0x32, 0x11,
-    0x33, 0x32, 0x11, 0x33, 0x2b, 0x32, 0x11, 0x33, 0x2f, 0x33, 0x39, 0x2f, 0x33, 0x30, 0x31, 0x65,
-    0x15, 0x21, 0x35, 0x13, 0x11, 0x23, 0x11, 0x01, 0x15, 0x21, 0x35, 0x01, 0x15, 0x21, 0x35, 0x01,
-    0x17, 0x0e, 0x02, 0x15, 0x14, 0x16, 0x33, 0x32, 0x36, 0x37, 0x17, 0x06, 0x06, 0x23, 0x22, 0x26,
-    0x35, 0x34, 0x36, 0x36, 0x04, 0x4d, 0xfc, 0xfb, 0x47, 0xfb, 0x03, 0x54, 0xfd, 0x60, 0x03, 0x00,
-    0xfd, 0x00, 0x02, 0x1d, 0x73, 0x2f, 0x49, 0x2a, 0x20, 0x28, 0x1e, 0x2c, 0x0e, 0x18, 0x19, 0x4f,
-    0x3b, 0x59, 0x7a, 0x2e, 0x68, 0xc7, 0xc7, 0xc7, 0x04, 0xe9, 0xfa, 0x50, 0x05, 0xb0, 0xfd, 0xa0,
-    0xc4, 0xc4, 0x02, 0x60, 0xc8, 0xc8, 0xfa, 0x8a, 0x3a, 0x1e, 0x3d, 0x45, 0x28, 0x1e, 0x27, 0x11,
-    0x07, 0x8b, 0x0f, 0x1d, 0x66, 0x62, 0x34, 0x65, 0x5d, 0x00, 0x00, 0x02, 0x00, 0x51, 0xfe, 0x72,
-    0x04, 0x0a, 0x04, 0x4e, 0x00, 0x2b, 0x00, 0x41, 0x00, 0x25, 0x40, 0x13, 0x12, 0x13, 0x13, 0x0b,
-    0x34, 0x3b, 0x0e, 0x72, 0x19, 0x0b, 0x07, 0x72, 0x2c, 0x2d, 0x24, 0x24, 0x00, 0x0b, 0x72, 0x00,
-    0x2b, 0x32, 0x11, 0x39, 0x39, 0x2b, 0x32, 0x2b, 0x32, 0x12, 0x39, 0x2f, 0x33, 0x30, 0x31, 0x45,
-    0x22, 0x2e, 0x02, 0x35, 0x35, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x15, 0x21, 0x35,
-    0x21, 0x35, 0x2e, 0x02, 0x23, 0x22, 0x0e, 0x02, 0x15, 0x15, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x36,
-    0x37, 0x17, 0x0e, 0x02, 0x37, 0x17, 0x0e, 0x02, 0x15, 0x14, 0x16, 0x33, 0x32, 0x36, 0x37, 0x17,
-    0x06, 0x06, 0x23, 0x22, 0x26, 0x35, 0x34, 0x36, 0x36, 0x02, 0x59, 0x78, 0xc1, 0x87, 0x48, 0x4a,
-    0x84, 0xb4, 0x69, 0x74, 0xae, 0x73, 0x39, 0xfc, 0xbc, 0x02, 0x56, 0x02, 0x2f, 0x60, 0x50, 0x3c,
-    0x5d, 0x3e, 0x21, 0x27, 0x4c, 0x6c, 0x45, 0x57, 0x88, 0x32, 0x7f, 0x23, 0x70, 0xa1, 0x0f, 0x73,
-    0x2e, 0x4a, 0x29, 0x20, 0x27, 0x1e, 0x2c, 0x0f, 0x17, 0x19, 0x4e, 0x3c, 0x58, 0x7b, 0x2e, 0x68,
-    0x14, 0x4f, 0x8e, 0xc0, 0x6f, 0x28, 0x7f, 0xce, 0x93, 0x4e, 0x4e, 0x8d, 0xc2, 0x75, 0x67, 0xad,
-    0x13, 0x41, 0x72, 0x46, 0x33, 0x60, 0x87, 0x54, 0x28, 0x47, 0x79, 0x5a, 0x33, 0x46, 0x40, 0x7b,
-    0x33, 0x5d, 0x3a, 0x6b, 0x3a, 0x1e, 0x3e, 0x43, 0x28, 0x1f, 0x26, 0x10, 0x07, 0x8a, 0x0f, 0x1d,
-    0x65, 0x62, 0x34, 0x65, 0x5e, 0x00, 0xff, 0xff, 0x00, 0x94, 0x00, 0x00, 0x04, 0x4d, 0x07, 0x3d,
-    0x06, 0x26, 0x00, 0x29, 0x00, 0x00, 0x01, 0x07, 0x00, 0x9f, 0x00, 0xa3, 0x01, 0x3e, 0x00, 0x0b,
-    0xb6, 0x04, 0x16, 0x07, 0x01, 0x01, 0x75, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x51,
-    0xff, 0xec, 0x04, 0x0a, 0x06, 0x00, 0x06, 0x26, 0x00, 0x49, 0x00, 0x00, 0x01, 0x06, 0x00, 0x9f,
-    0x58, 0x00, 0x00, 0x0b, 0xb6, 0x01, 0x32, 0x0b, 0x01, 0x01, 0x95, 0x56, 0x00, 0x2b, 0x34, 0x00,
-    0xff, 0xff, 0x00, 0x6b, 0xff, 0xec, 0x04, 0xf2, 0x07, 0x4b, 0x06, 0x26, 0x00, 0x2b, 0x00, 0x00,
-    0x01, 0x07, 0x00, 0x9e, 0x00, 0xc6, 0x01, 0x4b, 0x00, 0x0b, 0xb6, 0x01, 0x2f, 0x10, 0x01, 0x01,
-    0x78, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x52, 0xfe, 0x55, 0x04, 0x0c, 0x06, 0x00,
-    0x06, 0x26, 0x00, 0x4b, 0x00, 0x00, 0x01, 0x06, 0x00, 0x9e, 0x44, 0x00, 0x00, 0x0b, 0xb6, 0x03,
-    0x42, 0x1a, 0x01, 0x01, 0x97, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x6b, 0xff, 0xec,
-    0x04, 0xf2, 0x07, 0x32, 0x06, 0x26, 0x00, 0x2b, 0x00, 0x00, 0x01, 0x07, 0x00, 0xa1, 0x00, 0xf4,
-    0x01, 0x4b, 0x00, 0x0b, 0xb6, 0x01, 0x31, 0x10, 0x01, 0x01, 0x5f, 0x56, 0x00, 0x2b, 0x34, 0x00,
-    0xff, 0xff, 0x00, 0x52, 0xfe, 0x55, 0x04, 0x0c, 0x05, 0xe7, 0x06, 0x26, 0x00, 0x4b, 0x00, 0x00,
-    0x01, 0x06, 0x00, 0xa1, 0x71, 0x00, 0x00, 0x0b, 0xb6, 0x03, 0x44, 0x1a, 0x01, 0x01, 0x7e, 0x56,
-    0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x6b, 0xff, 0xec, 0x04, 0xf2, 0x07, 0x28, 0x06, 0x26,
-    0x00, 0x2b, 0x00, 0x00, 0x01, 0x07, 0x00, 0xa2, 0x01, 0xab, 0x01, 0x53, 0x00, 0x0b, 0xb6, 0x01,
-    0x35, 0x10, 0x01, 0x01, 0x82, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x52, 0xfe, 0x55,
-    0x04, 0x0c, 0x05, 0xdd, 0x04, 0x26, 0x00, 0x4b, 0x00, 0x00, 0x01, 0x07, 0x00, 0xa2, 0x01, 0x28,
-    0x00, 0x08, 0x00, 0x0b, 0xb6, 0x03, 0x48, 0x1a, 0x01, 0x01, 0xa1, 0x56, 0x00, 0x2b, 0x34, 0x00,
-    0xff, 0xff, 0x00, 0x6b, 0xfd, 0xf6, 0x04, 0xf2, 0x05, 0xc4, 0x06, 0x26, 0x00, 0x2b, 0x00, 0x00,
-    0x01, 0x07, 0x01, 0xd4, 0x01, 0xe6, 0xfe, 0x92, 0x00, 0x0e, 0xb4, 0x01, 0x35, 0x05, 0x01, 0x01,
-    0xb8, 0xff, 0x98, 0xb0, 0x56, 0x00, 0x2b, 0x34, 0xff, 0xff, 0x00, 0x52, 0xfe, 0x55, 0x04, 0x0c,
-    0x06, 0xa4, 0x04, 0x26, 0x00, 0x4b, 0x00, 0x00, 0x01, 0x07, 0x02, 0x4e, 0x01, 0x30, 0x00, 0x7c,
-    0x00, 0x0b, 0xb6, 0x03, 0x3f, 0x1a, 0x01, 0x01, 0x98, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff,
-    0x00, 0x94, 0x00, 0x00, 0x05, 0x17, 0x07, 0x3e, 0x06, 0x26, 0x00, 0x2c, 0x00, 0x00, 0x01, 0x07,
-    0x00, 0x9e, 0x00, 0xe6, 0x01, 0x3e, 0x00, 0x0b, 0xb6, 0x03, 0x0f, 0x0b, 0x01, 0x01, 0x77, 0x56,
-    0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x7a, 0x00, 0x00, 0x03, 0xfa, 0x07, 0x5f, 0x06, 0x26,
-    0x00, 0x4c, 0x00, 0x00, 0x01, 0x07, 0x00, 0x9e, 0x00, 0x1a, 0x01, 0x5f, 0x00, 0x0b, 0xb6, 0x02,
-    0x1e, 0x03, 0x01, 0x01, 0x26, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0xff, 0xb4, 0x00, 0x00,
-    0x02, 0x90, 0x07, 0x32, 0x06, 0x26, 0x00, 0x2d, 0x00, 0x00, 0x01, 0x07, 0x00, 0xa5, 0xff, 0x3d,
-    0x01, 0x3e, 0x00, 0x0b, 0xb6, 0x01, 0x12, 0x03, 0x01, 0x01, 0x76, 0x56, 0x00, 0x2b, 0x34, 0x00,
-    0xff, 0xff, 0xff, 0x9d, 0x00, 0x00, 0x02, 0x79, 0x05, 0xeb, 0x06, 0x26, 0x00, 0x8d, 0x00, 0x00,
-    0x01, 0x07, 0x00, 0xa5, 0xff, 0x26, 0xff, 0xf8, 0x00, 0x0b, 0xb6, 0x01, 0x12, 0x03, 0x01, 0x01,
-    0xa8, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0xff, 0xd1, 0x00, 0x00, 0x02, 0x79, 0x06, 0xea,
-    0x06, 0x26, 0x00, 0x2d, 0x00, 0x00, 0x01, 0x07, 0x00, 0x70, 0xff, 0x34, 0x01, 0x40, 0x00, 0x0b,
-    0xb6, 0x01, 0x06, 0x03, 0x01, 0x01, 0xb1, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0xff, 0xbb,
-    0x00, 0x00, 0x02, 0x62, 0x05, 0xa4, 0x06, 0x26, 0x00, 0x8d, 0x00, 0x00, 0x01, 0x07, 0x00, 0x70,
-    0xff, 0x1e, 0xff, 0xfa, 0x00, 0x0b, 0xb6, 0x01, 0x06, 0x03, 0x01, 0x01, 0xe3, 0x56, 0x00, 0x2b,
-    0x34, 0x00, 0xff, 0xff, 0xff, 0xdd, 0x00, 0x00, 0x02, 0x67, 0x07, 0x24, 0x06, 0x26, 0x00, 0x2d,
-    0x00, 0x00, 0x01, 0x07, 0x00, 0xa1, 0xff, 0x68, 0x01, 0x3e, 0x00, 0x0b, 0xb6, 0x01, 0x09, 0x03,
-    0x01, 0x01, 0x5e, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0xff, 0xc6, 0x00, 0x00, 0x02, 0x51,
-    0x05, 0xde, 0x06, 0x26, 0x00, 0x8d, 0x00, 0x00, 0x01, 0x07, 0x00, 0xa1, 0xff, 0x51, 0xff, 0xf7,
-    0x00, 0x0b, 0xb6, 0x01, 0x09, 0x03, 0x01, 0x01, 0x90, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff,
-    0x00, 0x18, 0xfe, 0x5a, 0x01, 0xa0, 0x05, 0xb0, 0x06, 0x26, 0x00, 0x2d, 0x00, 0x00, 0x01, 0x06,
-    0x00, 0xa4, 0xef, 0x06, 0x00, 0x0b, 0xb6, 0x01, 0x05, 0x02, 0x00, 0x00, 0x00, 0x56, 0x00, 0x2b,
-    0x34, 0x00, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x54, 0x01, 0x90, 0x05, 0xd6, 0x06, 0x26, 0x00, 0x4d,
-    0x00, 0x00, 0x01, 0x06, 0x00, 0xa4, 0xd6, 0x00, 0x00, 0x0b, 0xb6, 0x02, 0x11, 0x02, 0x00, 0x00,
-    0x00, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x9f, 0x00, 0x00, 0x01, 0xa4, 0x07, 0x1b,
-    0x06, 0x26, 0x00, 0x2d, 0x00, 0x00, 0x01, 0x07, 0x00, 0xa2, 0x00, 0x1e, 0x01, 0x46, 0x00, 0x0b,
-    0xb6, 0x01, 0x0d, 0x03, 0x01, 0x01, 0x81, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0xa5,
-    0xff, 0xec, 0x06, 0x29, 0x05, 0xb0, 0x04, 0x26, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x07, 0x00, 0x2e,
-    0x02, 0x44, 0x00, 0x00, 0xff, 0xff, 0x00, 0x7c, 0xfe, 0x4b, 0x03, 0x91, 0x05, 0xd6, 0x04, 0x26,
-    0x00, 0x4d, 0x00, 0x00, 0x00, 0x07, 0x00, 0x4e, 0x02, 0x0a, 0x00, 0x00, 0xff, 0xff, 0x00, 0x2f,
-    0xff, 0xec, 0x04, 0xb3, 0x07, 0x35, 0x06, 0x26, 0x00, 0x2e, 0x00, 0x00, 0x01, 0x07, 0x00, 0x9e,
-    0x01, 0x6f, 0x01, 0x35, 0x00, 0x0b, 0xb6, 0x01, 0x17, 0x01, 0x01, 0x01, 0x6a, 0x56, 0x00, 0x2b,
-    0x34, 0x00, 0xff, 0xff, 0xff, 0xae, 0xfe, 0x4b, 0x02, 0x6a, 0x05, 0xde, 0x06, 0x26, 0x00, 0x9c,
-    0x00, 0x00, 0x01, 0x07, 0x00, 0x9e, 0xff, 0x26, 0xff, 0xde, 0x00, 0x0b, 0xb6, 0x01, 0x15, 0x00,
-    0x01, 0x01, 0x82, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x94, 0xfe, 0x48, 0x05, 0x16,
-    0x05, 0xb0, 0x04, 0x26, 0x00, 0x2f, 0x00, 0x00, 0x01, 0x07, 0x01, 0xd4, 0x01, 0x9c, 0xfe, 0xe5,
-    0x00, 0x0e, 0xb4, 0x03, 0x17, 0x02, 0x01, 0x00, 0xb8, 0xff, 0xe7, 0xb0, 0x56, 0x00, 0x2b, 0x34,
-    0xff, 0xff, 0x00, 0x7d, 0xfe, 0x34, 0x04, 0x37, 0x06, 0x00, 0x06, 0x26, 0x00, 0x4f, 0x00, 0x00,
-    0x01, 0x07, 0x01, 0xd4, 0x01, 0x32, 0xfe, 0xd0, 0x00, 0x0e, 0xb4, 0x03, 0x17, 0x02, 0x01, 0x01,
-    0xb8, 0xff, 0xd4, 0xb0, 0x56, 0x00, 0x2b, 0x34, 0xff, 0xff, 0x00, 0x94, 0x00, 0x00, 0x04, 0x24,
-    0x07, 0x33, 0x06, 0x26, 0x00, 0x30, 0x00, 0x00, 0x01, 0x07, 0x00, 0x75, 0x00, 0x2c, 0x01, 0x33,
-    0x00, 0x0b, 0xb6, 0x02, 0x08, 0x07, 0x01, 0x01, 0x5c, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff,
-    0x00, 0x8c, 0x00, 0x00, 0x02, 0x5f, 0x07, 0x90, 0x06, 0x26, 0x00, 0x50, 0x00, 0x00, 0x01, 0x07,
-    0x00, 0x75, 0x00, 0x1d, 0x01, 0x90, 0x00, 0x0b, 0xb6, 0x01, 0x04, 0x03, 0x01, 0x01, 0x71, 0x56,
-    0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x94, 0xfe, 0x06, 0x04, 0x24, 0x05, 0xb0, 0x04, 0x26,
-    0x00, 0x30, 0x00, 0x00, 0x01, 0x07, 0x01, 0xd4, 0x01, 0x6f, 0xfe, 0xa2, 0x00, 0x0e, 0xb4, 0x02,
-    0x11, 0x02, 0x01, 0x01, 0xb8, 0xff, 0x97, 0xb0, 0x56, 0x00, 0x2b, 0x34, 0xff, 0xff, 0x00, 0x59,
-    0xfe, 0x06, 0x01, 0x7e, 0x06, 0x00, 0x04, 0x26, 0x00, 0x50, 0x00, 0x00, 0x01, 0x07, 0x01, 0xd4,
-    0x00, 0x12, 0xfe, 0xa2, 0x00, 0x0e, 0xb4, 0x01, 0x0d, 0x02, 0x01, 0x01, 0xb8, 0xff, 0x97, 0xb0,
-    0x56, 0x00, 0x2b, 0x34, 0xff, 0xff, 0x00, 0x94, 0x00, 0x00, 0x04, 0x24, 0x05, 0xb1, 0x06, 0x26,
-    0x00, 0x30, 0x00, 0x00, 0x01, 0x07, 0x01, 0xd4, 0x02, 0x0b, 0x04, 0xb1, 0x00, 0x0b, 0xb6, 0x02,
-    0x11, 0x07, 0x00, 0x00, 0x01, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x8c, 0x00, 0x00,
-    0x02, 0xe0, 0x06, 0x02, 0x04, 0x26, 0x00, 0x50, 0x00, 0x00, 0x01, 0x07, 0x01, 0xd4, 0x01, 0x8c,
-    0x05, 0x02, 0x00, 0x0b, 0xb6, 0x01, 0x0d, 0x03, 0x00, 0x00, 0x02, 0x56, 0x00, 0x2b, 0x34, 0x00,
-    0xff, 0xff, 0x00, 0x94, 0x00, 0x00, 0x04, 0x24, 0x05, 0xb0, 0x06, 0x26, 0x00, 0x30, 0x00, 0x00,
-    0x00, 0x07, 0x00, 0xa2, 0x01, 0xcd, 0xfd, 0xd0, 0xff, 0xff, 0x00, 0x8c, 0x00, 0x00, 0x02, 0xeb,
-    0x06, 0x00, 0x04, 0x26, 0x00, 0x50, 0x00, 0x00, 0x00, 0x07, 0x00, 0xa2, 0x01, 0x65, 0xfd, 0xad,
-    0xff, 0xff, 0x00, 0x94, 0x00, 0x00, 0x05, 0x17, 0x07, 0x37, 0x06, 0x26, 0x00, 0x32, 0x00, 0x00,
-    0x01, 0x07, 0x00, 0x75, 0x01, 0xee, 0x01, 0x37, 0x00, 0x0b, 0xb6, 0x01, 0x0a, 0x06, 0x01, 0x01,
-    0x61, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x7a, 0x00, 0x00, 0x03, 0xfa, 0x06, 0x00,
-    0x06, 0x26, 0x00, 0x52, 0x00, 0x00, 0x01, 0x07, 0x00, 0x75, 0x01, 0x57, 0x00, 0x00, 0x00, 0x0b,
-    0xb6, 0x02, 0x1c, 0x03, 0x01, 0x01, 0xa0, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x94,
-    0xfe, 0x02, 0x05, 0x17, 0x05, 0xb0, 0x04, 0x26, 0x00, 0x32, 0x00, 0x00, 0x01, 0x07, 0x01, 0xd4,
-    0x01, 0xe0, 0xfe, 0x9e, 0x00, 0x0e, 0xb4, 0x01, 0x13, 0x05, 0x01, 0x01, 0xb8, 0xff, 0x97, 0xb0,
-    0x56, 0x00, 0x2b, 0x34, 0xff, 0xff, 0x00, 0x7a, 0xfe, 0x06, 0x03, 0xfa, 0x04, 0x4e, 0x04, 0x26,
-    0x00, 0x52, 0x00, 0x00, 0x01, 0x07, 0x01, 0xd4, 0x01, 0x46, 0xfe, 0xa2, 0x00, 0x0e, 0xb4, 0x02,
-    0x25, 0x02, 0x01, 0x01, 0xb8, 0xff, 0x97, 0xb0, 0x56, 0x00, 0x2b, 0x34, 0xff, 0xff, 0x00, 0x94,
-    0x00, 0x00, 0x05, 0x17, 0x07, 0x36, 0x06, 0x26, 0x00, 0x32, 0x00, 0x00, 0x01, 0x07, 0x00, 0x9f,
-    0x01, 0x05, 0x01, 0x37, 0x00, 0x0b, 0xb6, 0x01, 0x10, 0x09, 0x01, 0x01, 0x6a, 0x56, 0x00, 0x2b,
-    0x34, 0x00, 0xff, 0xff, 0x00, 0x7a, 0x00, 0x00, 0x03, 0xfa, 0x06, 0x00, 0x06, 0x26, 0x00, 0x52,
-    0x00, 0x00, 0x01, 0x06, 0x00, 0x9f, 0x6d, 0x00, 0x00, 0x0b, 0xb6, 0x02, 0x22, 0x03, 0x01, 0x01,
-    0xa9, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0xff, 0xa3, 0x00, 0x00, 0x03, 0xfa, 0x06, 0x03,
-    0x06, 0x26, 0x00, 0x52, 0x00, 0x00, 0x01, 0x07, 0x01, 0xd4, 0xff, 0x5c, 0x05, 0x03, 0x00, 0x0b,
-    0xb6, 0x02, 0x20, 0x03, 0x01, 0x01, 0x3a, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x65,
-    0xff, 0xec, 0x05, 0x1d, 0x06, 0xe5, 0x06, 0x26, 0x00, 0x33, 0x00, 0x00, 0x01, 0x07, 0x00, 0x70,
-    0x00, 0xd5, 0x01, 0x3b, 0x00, 0x0b, 0xb6, 0x02, 0x2e, 0x11, 0x01, 0x01, 0x94, 0x56, 0x00, 0x2b,
-    0x34, 0x00, 0xff, 0xff, 0x00, 0x4e, 0xff, 0xec, 0x04, 0x3c, 0x05, 0xad, 0x06, 0x26, 0x00, 0x53,
-    0x00, 0x00, 0x01, 0x06, 0x00, 0x70, 0x52, 0x03, 0x00, 0x0b, 0xb6, 0x02, 0x2e, 0x06, 0x01, 0x01,
-    0xd1, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x65, 0xff, 0xec, 0x05, 0x1d, 0x07, 0x1f,
-    0x06, 0x26, 0x00, 0x33, 0x00, 0x00, 0x01, 0x07, 0x00, 0xa1, 0x01, 0x08, 0x01, 0x38, 0x00, 0x0b,
-    0xb6, 0x02, 0x31, 0x11, 0x01, 0x01, 0x41, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x4e,
-    0xff, 0xec, 0x04, 0x3c, 0x05, 0xe7, 0x06, 0x26, 0x00, 0x53, 0x00, 0x00, 0x01, 0x07, 0x00, 0xa1,
-    0x00, 0x86, 0x00, 0x00, 0x00, 0x0b, 0xb6, 0x02, 0x31, 0x06, 0x01, 0x01, 0x7e, 0x56, 0x00, 0x2b,
-    0x34, 0x00, 0xff, 0xff, 0x00, 0x65, 0xff, 0xec, 0x05, 0x1d, 0x07, 0x37, 0x06, 0x26, 0x00, 0x33,
-    0x00, 0x00, 0x01, 0x07, 0x00, 0xa6, 0x01, 0x60, 0x01, 0x38, 0x00, 0x0d, 0xb7, 0x03, 0x02, 0x2c,
-    0x11, 0x01, 0x01, 0x45, 0x56, 0x00, 0x2b, 0x34, 0x34, 0x00, 0xff, 0xff, 0x00, 0x4e, 0xff, 0xec,
-    0x04, 0x3c, 0x05, 0xff, 0x06, 0x26, 0x00, 0x53, 0x00, 0x00, 0x01, 0x07, 0x00, 0xa6, 0x00, 0xdd,
-    0x00, 0x00, 0x00, 0x0d, 0xb7, 0x03, 0x02, 0x2c, 0x06, 0x01, 0x01, 0x82, 0x56, 0x00, 0x2b, 0x34,
-    0x34, 0x00, 0xff, 0xff, 0x00, 0x94, 0x00, 0x00, 0x04, 0xdf, 0x07, 0x37, 0x06, 0x26, 0x00, 0x36,
-    0x00, 0x00, 0x01, 0x07, 0x00, 0x75, 0x01, 0x73, 0x01, 0x37, 0x00, 0x0b, 0xb6, 0x02, 0x1e, 0x00,
-    0x01, 0x01, 0x61, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x7d, 0x00, 0x00, 0x02, 0xf4,
-    0x06, 0x00, 0x06, 0x26, 0x00, 0x56, 0x00, 0x00, 0x01, 0x07, 0x00, 0x75, 0x00, 0xb2, 0x00, 0x00,
-    0x00, 0x0b, 0xb6, 0x02, 0x17, 0x03, 0x01, 0x01, 0xa0, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff,
-    0x00, 0x94, 0xfe, 0x06, 0x04, 0xdf, 0x05, 0xb0, 0x04, 0x26, 0x00, 0x36, 0x00, 0x00, 0x01, 0x07,
-    0x01, 0xd4, 0x01, 0x71, 0xfe, 0xa2, 0x00, 0x0e, 0xb4, 0x02, 0x27, 0x18, 0x01, 0x01, 0xb8, 0xff,
-    0x97, 0xb0, 0x56, 0x00, 0x2b, 0x34, 0xff, 0xff, 0x00, 0x52, 0xfe, 0x07, 0x02, 0xb9, 0x04, 0x4e,
-    0x04, 0x26, 0x00, 0x56, 0x00, 0x00, 0x01, 0x07, 0x01, 0xd4, 0x00, 0x0b, 0xfe, 0xa3, 0x00, 0x0e,
-    0xb4, 0x02, 0x20, 0x02, 0x01, 0x01, 0xb8, 0xff, 0x98, 0xb0, 0x56, 0x00, 0x2b, 0x34, 0xff, 0xff,
-    0x00, 0x94, 0x00, 0x00, 0x04, 0xdf, 0x07, 0x36, 0x06, 0x26, 0x00, 0x36, 0x00, 0x00, 0x01, 0x07,
-    0x00, 0x9f, 0x00, 0x8a, 0x01, 0x37, 0x00, 0x0b, 0xb6, 0x02, 0x24, 0x00, 0x01, 0x01, 0x6a, 0x56,
-    0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x37, 0x00, 0x00, 0x02, 0xfd, 0x06, 0x00, 0x06, 0x26,
-    0x00, 0x56, 0x00, 0x00, 0x01, 0x06, 0x00, 0x9f, 0xc8, 0x00, 0x00, 0x0b, 0xb6, 0x02, 0x1d, 0x03,
-    0x01, 0x01, 0xa9, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x4b, 0xff, 0xec, 0x04, 0x8e,
-    0x07, 0x38, 0x06, 0x26, 0x00, 0x37, 0x00, 0x00, 0x01, 0x07, 0x00, 0x75, 0x01, 0x95, 0x01, 0x38,
-    0x00, 0x0b, 0xb6, 0x01, 0x3a, 0x0f, 0x01, 0x01, 0x4f, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff,
-    0x00, 0x49, 0xff, 0xec, 0x03, 0xc7, 0x06, 0x00, 0x06, 0x26, 0x00, 0x57, 0x00, 0x00, 0x01, 0x07,
-    0x00, 0x75, 0x01, 0x36, 0x00, 0x00, 0x00, 0x0b, 0xb6, 0x01, 0x36, 0x0e, 0x01, 0x01, 0x8c, 0x56,
-    0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x4b, 0xff, 0xec, 0x04, 0x8e, 0x07, 0x38, 0x06, 0x26,
-    0x00, 0x37, 0x00, 0x00, 0x01, 0x07, 0x00, 0x9e, 0x00, 0x96, 0x01, 0x38, 0x00, 0x0b, 0xb6, 0x01,
-    0x3d, 0x0f, 0x01, 0x01, 0x5a, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x49, 0xff, 0xec,
-    0x03, 0xc7, 0x06, 0x00, 0x06, 0x26, 0x00, 0x57, 0x00, 0x00, 0x01, 0x06, 0x00, 0x9e, 0x37, 0x00,
-    0x00, 0x0b, 0xb6, 0x01, 0x39, 0x0e, 0x01, 0x01, 0x97, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff,
-    0x00, 0x4b, 0xfe, 0x3f, 0x04, 0x8e, 0x05, 0xc4, 0x06, 0x26, 0x00, 0x37, 0x00, 0x00, 0x01, 0x07,
-    0x00, 0x79, 0x01, 0xa0, 0xff, 0xff, 0x00, 0x0b, 0xb6, 0x01, 0x3a, 0x2b, 0x00, 0x00, 0x13, 0x56,
-    0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x49, 0xfe, 0x35, 0x03, 0xc7, 0x04, 0x4e, 0x06, 0x26,
-    0x00, 0x57, 0x00, 0x00, 0x01, 0x07, 0x00, 0x79, 0x01, 0x3e, 0xff, 0xf6, 0x00, 0x0b, 0xb6, 0x01,
-    0x36, 0x29, 0x00, 0x00, 0x0a, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x4b, 0xfd, 0xfb,
-    0x04, 0x8e, 0x05, 0xc4, 0x06, 0x26, 0x00, 0x37, 0x00, 0x00, 0x01, 0x07, 0x01, 0xd4, 0x01, 0x8e,
-    0xfe, 0x97, 0x00, 0x0e, 0xb4, 0x01, 0x43, 0x2b, 0x01, 0x01, 0xb8, 0xff, 0xa0, 0xb0, 0x56, 0x00,
-    0x2b, 0x34, 0xff, 0xff, 0x00, 0x49, 0xfd, 0xf2, 0x03, 0xc7, 0x04, 0x4e, 0x06, 0x26, 0x00, 0x57,
-    0x00, 0x00, 0x01, 0x07, 0x01, 0xd4, 0x01, 0x2b, 0xfe, 0x8e, 0x00, 0x0e, 0xb4, 0x01, 0x3f, 0x29,
-    0x01, 0x01, 0xb8, 0xff, 0x97, 0xb0, 0x56, 0x00, 0x2b, 0x34, 0xff, 0xff, 0x00, 0x4b, 0xff, 0xec,
-    0x04, 0x8e, 0x07, 0x38, 0x06, 0x26, 0x00, 0x37, 0x00, 0x00, 0x01, 0x07, 0x00, 0x9f, 0x00, 0xac,
-    0x01, 0x38, 0x00, 0x0b, 0xb6, 0x01, 0x40, 0x0f, 0x01, 0x01, 0x58, 0x56, 0x00, 0x2b, 0x34, 0x00,
-    0xff, 0xff, 0x00, 0x49, 0xff, 0xec, 0x03, 0xc7, 0x06, 0x00, 0x06, 0x26, 0x00, 0x57, 0x00, 0x00,
-    0x01, 0x06, 0x00, 0x9f, 0x4d, 0x00, 0x00, 0x0b, 0xb6, 0x01, 0x3c, 0x0e, 0x01, 0x01, 0x95, 0x56,
-    0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x2d, 0xfe, 0x00, 0x04, 0xb4, 0x05, 0xb0, 0x06, 0x26,
-    0x00, 0x38, 0x00, 0x00, 0x01, 0x07, 0x01, 0xd4, 0x01, 0x7c, 0xfe, 0x9c, 0x00, 0x0e, 0xb4, 0x02,
-    0x11, 0x02, 0x01, 0x01, 0xb8, 0xff, 0x8d, 0xb0, 0x56, 0x00, 0x2b, 0x34, 0xff, 0xff, 0x00, 0x0a,
-    0xfd, 0xfc, 0x02, 0x75, 0x05, 0x43, 0x06, 0x26, 0x00, 0x58, 0x00, 0x00, 0x01, 0x07, 0x01, 0xd4,
-    0x00, 0xc6, 0xfe, 0x98, 0x00, 0x0e, 0xb4, 0x02, 0x1f, 0x11, 0x01, 0x01, 0xb8, 0xff, 0xa1, 0xb0,
-    0x56, 0x00, 0x2b, 0x34, 0xff, 0xff, 0x00, 0x2d, 0xfe, 0x43, 0x04, 0xb4, 0x05, 0xb0, 0x06, 0x26,
-    0x00, 0x38, 0x00, 0x00, 0x01, 0x07, 0x00, 0x79, 0x01, 0x8e, 0x00, 0x04, 0x00, 0x0b, 0xb6, 0x02,
-    0x08, 0x02, 0x01, 0x00, 0x00, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x0a, 0xfe, 0x3f,
-    0x02, 0xa3, 0x05, 0x43, 0x06, 0x26, 0x00, 0x58, 0x00, 0x00, 0x01, 0x07, 0x00, 0x79, 0x00, 0xd9,
-    0x00, 0x00, 0x00, 0x0b, 0xb6, 0x02, 0x16, 0x11, 0x00, 0x00, 0x14, 0x56, 0x00, 0x2b, 0x34, 0x00,
-    0xff, 0xff, 0x00, 0x2d, 0x00, 0x00, 0x04, 0xb4, 0x07, 0x36, 0x06, 0x26, 0x00, 0x38, 0x00, 0x00,
-    0x01, 0x07, 0x00, 0x9f, 0x00, 0x9c, 0x01, 0x36, 0x00, 0x0b, 0xb6, 0x02, 0x0e, 0x03, 0x01, 0x01,
-    0x69, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x0a, 0xff, 0xec, 0x03, 0x22, 0x06, 0x7e,
-    0x04, 0x26, 0x00, 0x58, 0x00, 0x00, 0x01, 0x07, 0x01, 0xd4, 0x01, 0xce, 0x05, 0x7e, 0x00, 0x0e,
-    0xb4, 0x02, 0x1a, 0x04, 0x01, 0x00, 0xb8, 0xff, 0xa8, 0xb0, 0x56, 0x00, 0x2b, 0x34, 0xff, 0xff,
-    0x00, 0x80, 0xff, 0xec, 0x04, 0xbf, 0x07, 0x2b, 0x06, 0x26, 0x00, 0x39, 0x00, 0x00, 0x01, 0x07,
-    0x00, 0xa5, 0x00, 0xb9, 0x01, 0x37, 0x00, 0x0b, 0xb6, 0x01, 0x24, 0x0b, 0x01, 0x01, 0x6b, 0x56,
-    0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x77, 0xff, 0xec, 0x03, 0xf9, 0x05, 0xf4, 0x06, 0x26,
-    0x00, 0x59, 0x00, 0x00, 0x01, 0x06, 0x00, 0xa5, 0x55, 0x01, 0x00, 0x0b, 0xb6, 0x02, 0x2a, 0x11,
-    0x01, 0x01, 0xaa, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x80, 0xff, 0xec, 0x04, 0xbf,
-    0x06, 0xe3, 0x06, 0x26, 0x00, 0x39, 0x00, 0x00, 0x01, 0x07, 0x00, 0x70, 0x00, 0xb0, 0x01, 0x39,
-    0x00, 0x0b, 0xb6, 0x01, 0x18, 0x0b, 0x01, 0x01, 0xa6, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff,
-    0x00, 0x77, 0xff, 0xec, 0x03, 0xf9, 0x05, 0xad, 0x06, 0x26, 0x00, 0x59, 0x00, 0x00, 0x01, 0x06,
-    0x00, 0x70, 0x4d, 0x03, 0x00, 0x0b, 0xb6, 0x02, 0x1e, 0x11, 0x01, 0x01, 0xe5, 0x56, 0x00, 0x2b,
-    0x34, 0x00, 0xff, 0xff, 0x00, 0x80, 0xff, 0xec, 0x04, 0xbf, 0x07, 0x1d, 0x06, 0x26, 0x00, 0x39,
-    0x00, 0x00, 0x01, 0x07, 0x00, 0xa1, 0x00, 0xe4, 0x01, 0x37, 0x00, 0x0b, 0xb6, 0x01, 0x1b, 0x00,
-    0x01, 0x01, 0x53, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x77, 0xff, 0xec, 0x03, 0xf9,
-    0x05, 0xe7, 0x06, 0x26, 0x00, 0x59, 0x00, 0x00, 0x01, 0x07, 0x00, 0xa1, 0x00, 0x80, 0x00, 0x00,
-    0x00, 0x0b, 0xb6, 0x02, 0x21, 0x11, 0x01, 0x01, 0x92, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff,
-    0x00, 0x80, 0xff, 0xec, 0x04, 0xbf, 0x07, 0x90, 0x06, 0x26, 0x00, 0x39, 0x00, 0x00, 0x01, 0x07,
-    0x00, 0xa3, 0x01, 0x4c, 0x01, 0x6c, 0x00, 0x0d, 0xb7, 0x02, 0x01, 0x21, 0x00, 0x01, 0x01, 0x47,
-    0x56, 0x00, 0x2b, 0x34, 0x34, 0x00, 0xff, 0xff, 0x00, 0x77, 0xff, 0xec, 0x03, 0xf9, 0x06, 0x5a,
-    0x06, 0x26, 0x00, 0x59, 0x00, 0x00, 0x01, 0x07, 0x00, 0xa3, 0x00, 0xe8, 0x00, 0x35, 0x00, 0x0d,
-    0xb7, 0x03, 0x02, 0x27, 0x11, 0x01, 0x01, 0x86, 0x56, 0x00, 0x2b, 0x34, 0x34, 0x00, 0xff, 0xff,
-    0x00, 0x80, 0xff, 0xec, 0x04, 0xbf, 0x07, 0x36, 0x06, 0x26, 0x00, 0x39, 0x00, 0x00, 0x01, 0x07,
-    0x00, 0xa6, 0x01, 0x3b, 0x01, 0x37, 0x00, 0x0d, 0xb7, 0x02, 0x01, 0x16, 0x00, 0x01, 0x01, 0x57,
-    0x56, 0x00, 0x2b, 0x34, 0x34, 0x00, 0xff, 0xff, 0x00, 0x77, 0xff, 0xec, 0x04, 0x30, 0x05, 0xff,
-    0x06, 0x26, 0x00, 0x59, 0x00, 0x00, 0x01, 0x07, 0x00, 0xa6, 0x00, 0xd8, 0x00, 0x00, 0x00, 0x0d,
-    0xb7, 0x03, 0x02, 0x1c, 0x11, 0x01, 0x01, 0x96, 0x56, 0x00, 0x2b, 0x34, 0x34, 0x00, 0x00, 0x02,
-    0x00, 0x80, 0xfe, 0x8c, 0x04, 0xbf, 0x05, 0xb0, 0x00, 0x15, 0x00, 0x2b, 0x00, 0x1b, 0x40, 0x0d,
-    0x1e, 0x25, 0x01, 0x0b, 0x02, 0x72, 0x17, 0x16, 0x11, 0x11, 0x06, 0x09, 0x72, 0x00, 0x2b, 0x32,
-    0x12, 0x39, 0x39, 0x2b, 0x32, 0x2f, 0x33, 0x30, 0x31, 0x41, 0x33, 0x11, 0x14, 0x06, 0x06, 0x23,
-    0x22, 0x26, 0x26, 0x35, 0x11, 0x33, 0x11, 0x14, 0x16, 0x16, 0x33, 0x32, 0x36, 0x36, 0x35, 0x03,
-    0x17, 0x0e, 0x02, 0x15, 0x14, 0x16, 0x33, 0x32, 0x36, 0x37, 0x17, 0x06, 0x06, 0x23, 0x22, 0x26,
-    0x35, 0x34, 0x36, 0x36, 0x03, 0xc5, 0xfa, 0x90, 0xf7, 0x98, 0x9d, 0xf6, 0x8d, 0xfa, 0x48, 0x84,
-    0x5a, 0x5a, 0x83, 0x48, 0x63, 0x73, 0x2e, 0x49, 0x2a, 0x20, 0x27, 0x1e, 0x2c, 0x0f, 0x17, 0x19,
-    0x4e, 0x3c, 0x58, 0x7b, 0x2e, 0x68, 0x05, 0xb0, 0xfc, 0x33, 0xa6, 0xe0, 0x71, 0x71, 0xe0, 0xa6,
-    0x03, 0xcd, 0xfc, 0x33, 0x69, 0x87, 0x40, 0x40, 0x87, 0x69, 0xfe, 0x8f, 0x3a, 0x1e, 0x3e, 0x44,
-    0x28, 0x1e, 0x27, 0x11, 0x07, 0x8b, 0x0f, 0x1d, 0x65, 0x62, 0x35, 0x65, 0x5d, 0x00, 0x00, 0x03,
-    0x00, 0x77, 0xfe, 0x54, 0x03, 0xf9, 0x04, 0x3a, 0x00, 0x04, 0x00, 0x1b, 0x00, 0x31, 0x00, 0x21,
-    0x40, 0x11, 0x24, 0x2b, 0x0f, 0x72, 0x01, 0x11, 0x06, 0x72, 0x1c, 0x1d, 0x1d, 0x04, 0x04, 0x18,
-    0x0b, 0x0b, 0x72, 0x00, 0x2b, 0x32, 0x32, 0x11, 0x33, 0x11, 0x33, 0x2b, 0x32, 0x2b, 0x32, 0x30,
-    0x31, 0x65, 0x11, 0x33, 0x11, 0x23, 0x13, 0x37, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x35,
-    0x11, 0x33, 0x11, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x36, 0x36, 0x13, 0x17, 0x0e, 0x02, 0x15, 0x14,
-    0x16, 0x33, 0x32, 0x36, 0x37, 0x17, 0x06, 0x06, 0x23, 0x22, 0x26, 0x35, 0x34, 0x36, 0x36, 0x03,
-    0x07, 0xf2, 0xe4, 0x14, 0x51, 0x30, 0x64, 0x9c, 0x6d, 0x4f, 0x84, 0x5f, 0x34, 0xf1, 0x1c, 0x30,
-    0x40, 0x24, 0x67, 0x77, 0x33, 0x47, 0x73, 0x2f, 0x49, 0x2a, 0x20, 0x28, 0x1e, 0x2c, 0x0e, 0x18,
-    0x19, 0x4f, 0x3b, 0x59, 0x7a, 0x2e, 0x68, 0xff, 0x03, 0x3b, 0xfb, 0xc6, 0x01, 0xe0, 0x02, 0x6d,
-    0xb7, 0x87, 0x4b, 0x2e, 0x60, 0x9a, 0x6b, 0x02, 0xbb, 0xfd, 0x43, 0x3b, 0x4f, 0x30, 0x14, 0x51,
-    0x8a, 0xfe, 0xb0, 0x3a, 0x1e, 0x3d, 0x45, 0x28, 0x1e, 0x27, 0x11, 0x07, 0x8b, 0x0f, 0x1d, 0x66,
-    0x62, 0x34, 0x65, 0x5d, 0xff, 0xff, 0x00, 0x2f, 0x00, 0x00, 0x06, 0xe6, 0x07, 0x37, 0x06, 0x26,
-    0x00, 0x3b, 0x00, 0x00, 0x01, 0x07, 0x00, 0x9e, 0x01, 0xa9, 0x01, 0x37, 0x00, 0x0b, 0xb6, 0x04,
-    0x19, 0x15, 0x01, 0x01, 0x6c, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x23, 0x00, 0x00,
-    0x05, 0xc8, 0x06, 0x00, 0x06, 0x26, 0x00, 0x5b, 0x00, 0x00, 0x01, 0x07, 0x00, 0x9e, 0x01, 0x0c,
-    0x00, 0x00, 0x00, 0x0b, 0xb6, 0x04, 0x19, 0x15, 0x01, 0x01, 0xab, 0x56, 0x00, 0x2b, 0x34, 0x00,
-    0xff, 0xff, 0x00, 0x08, 0x00, 0x00, 0x04, 0xd9, 0x07, 0x36, 0x06, 0x26, 0x00, 0x3d, 0x00, 0x00,
-    0x01, 0x07, 0x00, 0x9e, 0x00, 0x8c, 0x01, 0x36, 0x00, 0x0b, 0xb6, 0x01, 0x0c, 0x02, 0x01, 0x01,
-    0x6b, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x0c, 0xfe, 0x4b, 0x03, 0xde, 0x06, 0x00,
-    0x06, 0x26, 0x00, 0x5d, 0x00, 0x00, 0x01, 0x06, 0x00, 0x9e, 0x1c, 0x00, 0x00, 0x0b, 0xb6, 0x02,
-    0x1c, 0x01, 0x01, 0x01, 0xab, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x08, 0x00, 0x00,
-    0x04, 0xd9, 0x07, 0x03, 0x06, 0x26, 0x00, 0x3d, 0x00, 0x00, 0x01, 0x07, 0x00, 0x6a, 0x00, 0xad,
-    0x01, 0x36, 0x00, 0x0d, 0xb7, 0x02, 0x01, 0x1e, 0x02, 0x01, 0x01, 0x77, 0x56, 0x00, 0x2b, 0x34,
-    0x34, 0x00, 0xff, 0xff, 0x00, 0x50, 0x00, 0x00, 0x04, 0x8e, 0x07, 0x37, 0x06, 0x26, 0x00, 0x3e,
-    0x00, 0x00, 0x01, 0x07, 0x00, 0x75, 0x01, 0x87, 0x01, 0x37, 0x00, 0x0b, 0xb6, 0x03, 0x0e, 0x0d,
-    0x01, 0x01, 0x61, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x51, 0x00, 0x00, 0x03, 0xc1,
-    0x06, 0x00, 0x06, 0x26, 0x00, 0x5e, 0x00, 0x00, 0x01, 0x07, 0x00, 0x75, 0x01, 0x1f, 0x00, 0x00,
-    0x00, 0x0b, 0xb6, 0x03, 0x0e, 0x0d, 0x01, 0x01, 0xa0, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff,
-    0x00, 0x50, 0x00, 0x00, 0x04, 0x8e, 0x07, 0x14, 0x06, 0x26, 0x00, 0x3e, 0x00, 0x00, 0x01, 0x07,
-    0x00, 0xa2, 0x01, 0x6c, 0x01, 0x3f, 0x00, 0x0b, 0xb6, 0x03, 0x17, 0x08, 0x01, 0x01, 0x76, 0x56,
-    0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x51, 0x00, 0x00, 0x03, 0xc1, 0x05, 0xdd, 0x06, 0x26,
-    0x00, 0x5e, 0x00, 0x00, 0x01, 0x07, 0x00, 0xa2, 0x01, 0x04, 0x00, 0x08, 0x00, 0x0b, 0xb6, 0x03,
-    0x17, 0x08, 0x01, 0x01, 0xb5, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x50, 0x00, 0x00,
-    0x04, 0x8e, 0x07, 0x36, 0x06, 0x26, 0x00, 0x3e, 0x00, 0x00, 0x01, 0x07, 0x00, 0x9f, 0x00, 0x9e,
-    0x01, 0x37, 0x00, 0x0b, 0xb6, 0x03, 0x14, 0x08, 0x01, 0x01, 0x6a, 0x56, 0x00, 0x2b, 0x34, 0x00,
-    0xff, 0xff, 0x00, 0x51, 0x00, 0x00, 0x03, 0xc1, 0x06, 0x00, 0x06, 0x26, 0x00, 0x5e, 0x00, 0x00,
-    0x01, 0x06, 0x00, 0x9f, 0x36, 0x00, 0x00, 0x0b, 0xb6, 0x03, 0x14, 0x08, 0x01, 0x01, 0xa9, 0x56,
-    0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x07, 0x4e, 0x07, 0x42, 0x06, 0x26,
-    0x00, 0x81, 0x00, 0x00, 0x01, 0x07, 0x00, 0x75, 0x02, 0xc1, 0x01, 0x42, 0x00, 0x0b, 0xb6, 0x06,
-    0x19, 0x03, 0x01, 0x01, 0x6c, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x48, 0xff, 0xeb,
-    0x06, 0x86, 0x06, 0x01, 0x06, 0x26, 0x00, 0x86, 0x00, 0x00, 0x01, 0x07, 0x00, 0x75, 0x02, 0x75,
-    0x00, 0x01, 0x00, 0x0b, 0xb6, 0x03, 0x5f, 0x0f, 0x01, 0x01, 0x8d, 0x56, 0x00, 0x2b, 0x34, 0x00,
-    0xff, 0xff, 0x00, 0x69, 0xff, 0xa2, 0x05, 0x22, 0x07, 0x80, 0x06, 0x26, 0x00, 0x83, 0x00, 0x00,
-    0x01, 0x07, 0x00, 0x75, 0x01, 0xe3, 0x01, 0x80, 0x00, 0x0b, 0xb6, 0x03, 0x34, 0x16, 0x01, 0x01,
-    0x96, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x4e, 0xff, 0x75, 0x04, 0x3c, 0x05, 0xfd,
-    0x06, 0x26, 0x00, 0x89, 0x00, 0x00, 0x01, 0x07, 0x00, 0x75, 0x01, 0x32, 0xff, 0xfd, 0x00, 0x0b,
-    0xb6, 0x03, 0x30, 0x0a, 0x01, 0x01, 0x8b, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0xff, 0xa5,
-    0x00, 0x00, 0x04, 0x2b, 0x04, 0x8d, 0x06, 0x26, 0x02, 0x4a, 0x00, 0x00, 0x00, 0x07, 0x02, 0x40,
-    0xff, 0x18, 0xff, 0x6b, 0xff, 0xff, 0xff, 0xa5, 0x00, 0x00, 0x04, 0x2b, 0x04, 0x8d, 0x06, 0x26,
-    0x02, 0x4a, 0x00, 0x00, 0x00, 0x07, 0x02, 0x40, 0xff, 0x18, 0xff, 0x6b, 0xff, 0xff, 0x00, 0x25,
-    0x00, 0x00, 0x04, 0x19, 0x04, 0x8d, 0x06, 0x26, 0x01, 0xf2, 0x00, 0x00, 0x00, 0x06, 0x02, 0x40,
-    0x33, 0xba, 0xff, 0xff, 0x00, 0x08, 0x00, 0x00, 0x04, 0x91, 0x06, 0x1e, 0x06, 0x26, 0x02, 0x4d,
-    0x00, 0x00, 0x01, 0x07, 0x00, 0x44, 0x00, 0xc0, 0x00, 0x1e, 0x00, 0x0b, 0xb6, 0x03, 0x10, 0x07,
-    0x01, 0x01, 0x6b, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x08, 0x00, 0x00, 0x04, 0x91,
-    0x06, 0x1e, 0x06, 0x26, 0x02, 0x4d, 0x00, 0x00, 0x01, 0x07, 0x00, 0x75, 0x01, 0x67, 0x00, 0x1e,
-    0x00, 0x0b, 0xb6, 0x03, 0x0e, 0x03, 0x01, 0x01, 0x6b, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff,
-    0x00, 0x08, 0x00, 0x00, 0x04, 0x91, 0x06, 0x1e, 0x06, 0x26, 0x02, 0x4d, 0x00, 0x00, 0x01, 0x06,
-    0x00, 0x9e, 0x67, 0x1e, 0x00, 0x0b, 0xb6, 0x03, 0x13, 0x03, 0x01, 0x01, 0x6b, 0x56, 0x00, 0x2b,
-    0x34, 0x00, 0xff, 0xff, 0x00, 0x08, 0x00, 0x00, 0x04, 0x91, 0x06, 0x12, 0x06, 0x26, 0x02, 0x4d,
-    0x00, 0x00, 0x01, 0x06, 0x00, 0xa5, 0x6a, 0x1f, 0x00, 0x0b, 0xb6, 0x03, 0x1b, 0x03, 0x01, 0x01,
-    0x6b, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x08, 0x00, 0x00, 0x04, 0x91, 0x05, 0xeb,
-    0x06, 0x26, 0x02, 0x4d, 0x00, 0x00, 0x01, 0x07, 0x00, 0x6a, 0x00, 0x88, 0x00, 0x1e, 0x00, 0x0d,
-    0xb7, 0x04, 0x03, 0x17, 0x03, 0x01, 0x01, 0x6b, 0x56, 0x00, 0x2b, 0x34, 0x34, 0x00, 0xff, 0xff,
-    0x00, 0x08, 0x00, 0x00, 0x04, 0x91, 0x06, 0x78, 0x06, 0x26, 0x02, 0x4d, 0x00, 0x00, 0x01, 0x07,
-    0x00, 0xa3, 0x00, 0xfd, 0x00, 0x53, 0x00, 0x0d, 0xb7, 0x04, 0x03, 0x19, 0x03, 0x01, 0x01, 0x51,
-    0x56, 0x00, 0x2b, 0x34, 0x34, 0x00, 0xff, 0xff, 0x00, 0x08, 0x00, 0x00, 0x04, 0x91, 0x06, 0x98,
-    0x06, 0x26, 0x02, 0x4d, 0x00, 0x00, 0x00, 0x07, 0x02, 0x41, 0x00, 0xfc, 0xff, 0xfe, 0xff, 0xff,
-    0x00, 0x4f, 0xfe, 0x3f, 0x04, 0x43, 0x04, 0x9d, 0x06, 0x26, 0x02, 0x4b, 0x00, 0x00, 0x00, 0x07,
-    0x00, 0x79, 0x01, 0x6d, 0xff, 0xff, 0xff, 0xff, 0x00, 0x76, 0x00, 0x00, 0x03, 0xb6, 0x06, 0x1e,
-    0x06, 0x26, 0x02, 0x42, 0x00, 0x00, 0x01, 0x07, 0x00, 0x44, 0x00, 0x93, 0x00, 0x1e, 0x00, 0x0b,
-    0xb6, 0x04, 0x12, 0x07, 0x01, 0x01, 0x6c, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x76,
-    0x00, 0x00, 0x03, 0xb6, 0x06, 0x1e, 0x06, 0x26, 0x02, 0x42, 0x00, 0x00, 0x01, 0x07, 0x00, 0x75,
-    0x01, 0x3a, 0x00, 0x1e, 0x00, 0x0b, 0xb6, 0x04, 0x10, 0x07, 0x01, 0x01, 0x6c, 0x56, 0x00, 0x2b,
-    0x34, 0x00, 0xff, 0xff, 0x00, 0x76, 0x00, 0x00, 0x03, 0xb6, 0x06, 0x1e, 0x06, 0x26, 0x02, 0x42,
-    0x00, 0x00, 0x01, 0x06, 0x00, 0x9e, 0x3b, 0x1e, 0x00, 0x0b, 0xb6, 0x04, 0x16, 0x07, 0x01, 0x01,
-    0x6c, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x76, 0x00, 0x00, 0x03, 0xb6, 0x05, 0xeb,
-    0x06, 0x26, 0x02, 0x42, 0x00, 0x00, 0x01, 0x06, 0x00, 0x6a, 0x5c, 0x1e, 0x00, 0x0d, 0xb7, 0x05,
-    0x04, 0x19, 0x07, 0x01, 0x01, 0x84, 0x56, 0x00, 0x2b, 0x34, 0x34, 0x00, 0xff, 0xff, 0xff, 0xa9,
-    0x00, 0x00, 0x01, 0x7c, 0x06, 0x1e, 0x06, 0x26, 0x01, 0xfd, 0x00, 0x00, 0x01, 0x07, 0x00, 0x44,
-    0xff, 0x70, 0x00, 0x1e, 0x00, 0x0b, 0xb6, 0x01, 0x06, 0x03, 0x01, 0x01, 0x6b, 0x56, 0x00, 0x2b,
-    0x34, 0x00, 0xff, 0xff, 0x00, 0x86, 0x00, 0x00, 0x02, 0x59, 0x06, 0x1e, 0x06, 0x26, 0x01, 0xfd,
-    0x00, 0x00, 0x01, 0x06, 0x00, 0x75, 0x17, 0x1e, 0x00, 0x0b, 0xb6, 0x01, 0x04, 0x03, 0x01, 0x01,
-    0x6b, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0xff, 0xa7, 0x00, 0x00, 0x02, 0x5b, 0x06, 0x1e,
-    0x06, 0x26, 0x01, 0xfd, 0x00, 0x00, 0x01, 0x07, 0x00, 0x9e, 0xff, 0x17, 0x00, 0x1e, 0x00, 0x0b,
-    0xb6, 0x01, 0x09, 0x03, 0x01, 0x01, 0x76, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0xff, 0x9c,
-    0x00, 0x00, 0x02, 0x64, 0x05, 0xeb, 0x06, 0x26, 0x01, 0xfd, 0x00, 0x00, 0x01, 0x07, 0x00, 0x6a,
-    0xff, 0x39, 0x00, 0x1e, 0x00, 0x0d, 0xb7, 0x02, 0x01, 0x0d, 0x03, 0x01, 0x01, 0x84, 0x56, 0x00,
-    0x2b, 0x34, 0x34, 0x00, 0xff, 0xff, 0x00, 0x76, 0x00, 0x00, 0x04, 0x67, 0x06, 0x12, 0x06, 0x26,
-    0x01, 0xf8, 0x00, 0x00, 0x01, 0x07, 0x00, 0xa5, 0x00, 0x8b, 0x00, 0x1f, 0x00, 0x0b, 0xb6, 0x01,
-    0x18, 0x06, 0x01, 0x01, 0x76, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x4e, 0xff, 0xf0,
-    0x04, 0x6e, 0x06, 0x1e, 0x06, 0x26, 0x01, 0xf7, 0x00, 0x00, 0x01, 0x07, 0x00, 0x44, 0x00, 0xce,
-    0x00, 0x1e, 0x00, 0x0b, 0xb6, 0x02, 0x2e, 0x11, 0x01, 0x01, 0x5b, 0x56, 0x00, 0x2b, 0x34, 0x00,
-    0xff, 0xff, 0x00, 0x4e, 0xff, 0xf0, 0x04, 0x6e, 0x06, 0x1e, 0x06, 0x26, 0x01, 0xf7, 0x00, 0x00,
-    0x01, 0x07, 0x00, 0x75, 0x01, 0x75, 0x00, 0x1e, 0x00, 0x0b, 0xb6, 0x02, 0x2c, 0x11, 0x01, 0x01,
-    0x5b, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x4e, 0xff, 0xf0, 0x04, 0x6e, 0x06, 0x1e,
-    0x06, 0x26, 0x01, 0xf7, 0x00, 0x00, 0x01, 0x07, 0x00, 0x9e, 0x00, 0x75, 0x00, 0x1e, 0x00, 0x0b,
-    0xb6, 0x02, 0x31, 0x11, 0x01, 0x01, 0x5b, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x4e,
-    0xff, 0xf0, 0x04, 0x6e, 0x06, 0x12, 0x06, 0x26, 0x01, 0xf7, 0x00, 0x00, 0x01, 0x07, 0x00, 0xa5,
-    0x00, 0x78, 0x00, 0x1f, 0x00, 0x0b, 0xb6, 0x02, 0x31, 0x11, 0x01, 0x01, 0x6f, 0x56, 0x00, 0x2b,
-    0x34, 0x00, 0xff, 0xff, 0x00, 0x4e, 0xff, 0xf0, 0x04, 0x6e, 0x05, 0xeb, 0x06, 0x26, 0x01, 0xf7,
-    0x00, 0x00, 0x01, 0x07, 0x00, 0x6a, 0x00, 0x97, 0x00, 0x1e, 0x00, 0x0d, 0xb7, 0x03, 0x02, 0x35,
-    0x11, 0x01, 0x01, 0x74, 0x56, 0x00, 0x2b, 0x34, 0x34, 0x00, 0xff, 0xff, 0x00, 0x69, 0xff, 0xf0,
-    0x04, 0x20, 0x06, 0x1e, 0x06, 0x26, 0x01, 0xf1, 0x00, 0x00, 0x01, 0x07, 0x00, 0x44, 0x00, 0xb3,
-    0x00, 0x1e, 0x00, 0x0b, 0xb6, 0x01, 0x18, 0x0b, 0x01, 0x01, 0x6b, 0x56, 0x00, 0x2b, 0x34, 0x00,
-    0xff, 0xff, 0x00, 0x69, 0xff, 0xf0, 0x04, 0x20, 0x06, 0x1e, 0x06, 0x26, 0x01, 0xf1, 0x00, 0x00,
-    0x01, 0x07, 0x00, 0x75, 0x01, 0x5a, 0x00, 0x1e, 0x00, 0x0b, 0xb6, 0x01, 0x16, 0x0b, 0x01, 0x01,
-    0x6b, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x69, 0xff, 0xf0, 0x04, 0x20, 0x06, 0x1e,
-    0x06, 0x26, 0x01, 0xf1, 0x00, 0x00, 0x01, 0x06, 0x00, 0x9e, 0x5b, 0x1e, 0x00, 0x0b, 0xb6, 0x01,
-    0x1b, 0x0b, 0x01, 0x01, 0x6b, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x69, 0xff, 0xf0,
-    0x04, 0x20, 0x05, 0xeb, 0x06, 0x26, 0x01, 0xf1, 0x00, 0x00, 0x01, 0x07, 0x00, 0x6a, 0x00, 0x7c,
-    0x00, 0x1e, 0x00, 0x0d, 0xb7, 0x02, 0x01, 0x1f, 0x0b, 0x01, 0x01, 0x84, 0x56, 0x00, 0x2b, 0x34,
-    0x34, 0x00, 0xff, 0xff, 0x00, 0x06, 0x00, 0x00, 0x04, 0x38, 0x06, 0x1e, 0x06, 0x26, 0x01, 0xed,
-    0x00, 0x00, 0x01, 0x07, 0x00, 0x75, 0x01, 0x31, 0x00, 0x1e, 0x00, 0x0b, 0xb6, 0x03, 0x0e, 0x09,
-    0x01, 0x01, 0x6b, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x08, 0x00, 0x00, 0x04, 0x91,
-    0x05, 0xcb, 0x06, 0x26, 0x02, 0x4d, 0x00, 0x00, 0x01, 0x06, 0x00, 0x70, 0x61, 0x21, 0x00, 0x0b,
-    0xb6, 0x03, 0x10, 0x03, 0x01, 0x01, 0xb0, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x08,
-    0x00, 0x00, 0x04, 0x91, 0x06, 0x05, 0x06, 0x26, 0x02, 0x4d, 0x00, 0x00, 0x01, 0x07, 0x00, 0xa1,
-    0x00, 0x95, 0x00, 0x1e, 0x00, 0x0b, 0xb6, 0x03, 0x13, 0x03, 0x01, 0x01, 0x5d, 0x56, 0x00, 0x2b,
-    0x34, 0x00, 0x00, 0x04, 0x00, 0x08, 0xfe, 0x54, 0x04, 0x91, 0x04, 0x8d, 0x00, 0x04, 0x00, 0x09,
-    0x00, 0x0d, 0x00, 0x23, 0x00, 0x21, 0x40, 0x0f, 0x0d, 0x0c, 0x0c, 0x03, 0x16, 0x1d, 0x08, 0x03,
-    0x7d, 0x0f, 0x0e, 0x05, 0x05, 0x01, 0x12, 0x00, 0x3f, 0x33, 0x11, 0x33, 0x33, 0x3f, 0x33, 0x2f,
-    0x33, 0x12, 0x39, 0x2f, 0x33, 0x30, 0x31, 0x41, 0x01, 0x23, 0x01, 0x33, 0x01, 0x01, 0x27, 0x33,
-    0x01, 0x01, 0x15, 0x21, 0x35, 0x01, 0x17, 0x0e, 0x02, 0x15, 0x14, 0x16, 0x33, 0x32, 0x36, 0x37,
-    0x17, 0x06, 0x06, 0x23, 0x22, 0x26, 0x35, 0x34, 0x36, 0x36, 0x02, 0x5a, 0xfe, 0xa2, 0xf4, 0x01,
-    0xd5, 0xa2, 0x01, 0x1e, 0xfe, 0xa0, 0x25, 0xa5, 0x01, 0xd4, 0xfe, 0xfd, 0xfd, 0x66, 0x02, 0xf5,
-    0x73, 0x2e, 0x4a, 0x29, 0x20, 0x27, 0x1e, 0x2c, 0x0f, 0x17, 0x19, 0x4e, 0x3c, 0x58, 0x7b, 0x2e,
-    0x68, 0x03, 0x9e, 0xfc, 0x62, 0x04, 0x8d, 0xfb, 0x73, 0x03, 0xa0, 0xed, 0xfb, 0x73, 0x01, 0xb0,
-    0xb5, 0xb5, 0xfe, 0x8a, 0x3a, 0x1e, 0x3d, 0x45, 0x28, 0x1e, 0x27, 0x11, 0x07, 0x8b, 0x0f, 0x1d,
-    0x66, 0x62, 0x34, 0x65, 0x5d, 0x00, 0xff, 0xff, 0x00, 0x4f, 0xff, 0xf0, 0x04, 0x43, 0x06, 0x1e,
-    0x06, 0x26, 0x02, 0x4b, 0x00, 0x00, 0x01, 0x07, 0x00, 0x75, 0x01, 0x67, 0x00, 0x1e, 0x00, 0x0b,
-    0xb6, 0x01, 0x28, 0x10, 0x01, 0x01, 0x5b, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x4f,
-    0xff, 0xf0, 0x04, 0x43, 0x06, 0x1e, 0x06, 0x26, 0x02, 0x4b, 0x00, 0x00, 0x01, 0x06, 0x00, 0x9e,
-    0x68, 0x1e, 0x00, 0x0b, 0xb6, 0x01, 0x2d, 0x10, 0x01, 0x01, 0x5b, 0x56, 0x00, 0x2b, 0x34, 0x00,
-    0xff, 0xff, 0x00, 0x4f, 0xff, 0xf0, 0x04, 0x43, 0x05, 0xfb, 0x06, 0x26, 0x02, 0x4b, 0x00, 0x00,
-    0x01, 0x07, 0x00, 0xa2, 0x01, 0x4c, 0x00, 0x26, 0x00, 0x0b, 0xb6, 0x01, 0x31, 0x10, 0x01, 0x01,
-    0x70, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x4f, 0xff, 0xf0, 0x04, 0x43, 0x06, 0x1e,
-    0x06, 0x26, 0x02, 0x4b, 0x00, 0x00, 0x01, 0x07, 0x00, 0x9f, 0x00, 0x7e, 0x00, 0x1e, 0x00, 0x0b,
-    0xb6, 0x01, 0x2e, 0x10, 0x01, 0x01, 0x64, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x61,
-    0x00, 0x00, 0x04, 0x2b, 0x06, 0x1e, 0x06, 0x26, 0x02, 0x4a, 0x00, 0x00, 0x01, 0x06, 0x00, 0x9f,
-    0xf3, 0x1e, 0x00, 0x0b, 0xb6, 0x02, 0x24, 0x1d, 0x01, 0x01, 0x74, 0x56, 0x00, 0x2b, 0x34, 0x00,
-    0xff, 0xff, 0x00, 0x76, 0x00, 0x00, 0x03, 0xb6, 0x05, 0xcb, 0x06, 0x26, 0x02, 0x42, 0x00, 0x00,
-    0x01, 0x06, 0x00, 0x70, 0x35, 0x21, 0x00, 0x0b, 0xb6, 0x04, 0x12, 0x07, 0x01, 0x01, 0xb0, 0x56,
-    0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x76, 0x00, 0x00, 0x03, 0xb6, 0x06, 0x05, 0x06, 0x26,
-    0x02, 0x42, 0x00, 0x00, 0x01, 0x06, 0x00, 0xa1, 0x68, 0x1e, 0x00, 0x0b, 0xb6, 0x04, 0x15, 0x07,
-    0x01, 0x01, 0x5e, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x76, 0x00, 0x00, 0x03, 0xb6,
-    0x05, 0xfb, 0x06, 0x26, 0x02, 0x42, 0x00, 0x00, 0x01, 0x07, 0x00, 0xa2, 0x01, 0x1f, 0x00, 0x26,
-    0x00, 0x0b, 0xb6, 0x04, 0x19, 0x07, 0x01, 0x01, 0x80, 0x56, 0x00, 0x2b, 0x34, 0x00, 0x00, 0x05,
-    0x00, 0x76, 0xfe, 0x54, 0x03, 0xb6, 0x04, 0x8d, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x0f,
-    0x00, 0x25, 0x00, 0x23, 0x40, 0x10, 0x18, 0x1f, 0x0b, 0x0a, 0x0a, 0x06, 0x0f, 0x0e, 0x07, 0x7d,
-    0x11, 0x10, 0x10, 0x05, 0x06, 0x12, 0x00, 0x3f, 0x33, 0x33, 0x11, 0x33, 0x3f, 0x33, 0x33, 0x12,
-    0x39, 0x2f, 0x33, 0x2f, 0x33, 0x30, 0x31, 0x65, 0x15, 0x21, 0x35, 0x13, 0x11, 0x23, 0x11, 0x01,
-    0x15, 0x21, 0x35, 0x01, 0x15, 0x21, 0x35, 0x01, 0x17, 0x0e, 0x02, 0x15, 0x14, 0x16, 0x33, 0x32,
-    0x36, 0x37, 0x17, 0x06, 0x06, 0x23, 0x22, 0x26, 0x35, 0x34, 0x36, 0x36, 0x03, 0xb6, 0xfd, 0x65,
-    0x4c, 0xf1, 0x02, 0xea, 0xfd, 0xbb, 0x02, 0x99, 0xfd, 0x67, 0x01, 0xc5, 0x73, 0x2f, 0x49, 0x2a,
-    0x20, 0x28, 0x1e, 0x2c, 0x0e, 0x18, 0x19, 0x4f, 0x3b, 0x59, 0x7a, 0x2e, 0x68, 0xbf, 0xbf, 0xbf,
-    0x03, 0xce, 0xfb, 0x73, 0x04, 0x8d, 0xfe, 0x2d, 0xbf, 0xbf, 0x01, 0xd3, 0xc0, 0xc0, 0xfb, 0xad,
-    0x3a, 0x1e, 0x3d, 0x45, 0x28, 0x1e, 0x27, 0x11, 0x07, 0x8b, 0x0f, 0x1d, 0x66, 0x62, 0x34, 0x65,
-    0x5d, 0x00, 0xff, 0xff, 0x00, 0x76, 0x00, 0x00, 0x03, 0xb6, 0x06, 0x1e, 0x06, 0x26, 0x02, 0x42,
-    0x00, 0x00, 0x01, 0x06, 0x00, 0x9f, 0x51, 0x1e, 0x00, 0x0b, 0xb6, 0x04, 0x16, 0x07, 0x01, 0x01,
-    0x74, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x56, 0xff, 0xf0, 0x04, 0x4b, 0x06, 0x1e,
-    0x06, 0x26, 0x01, 0xff, 0x00, 0x00, 0x01, 0x06, 0x00, 0x9e, 0x6f, 0x1e, 0x00, 0x0b, 0xb6, 0x01,
-    0x30, 0x10, 0x01, 0x01, 0x66, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x56, 0xff, 0xf0,
-    0x04, 0x4b, 0x06, 0x05, 0x06, 0x26, 0x01, 0xff, 0x00, 0x00, 0x01, 0x07, 0x00, 0xa1, 0x00, 0x9d,
-    0x00, 0x1e, 0x00, 0x0b, 0xb6, 0x01, 0x30, 0x10, 0x01, 0x01, 0x4d, 0x56, 0x00, 0x2b, 0x34, 0x00,
-    0xff, 0xff, 0x00, 0x56, 0xff, 0xf0, 0x04, 0x4b, 0x05, 0xfb, 0x06, 0x26, 0x01, 0xff, 0x00, 0x00,
-    0x01, 0x07, 0x00, 0xa2, 0x01, 0x53, 0x00, 0x26, 0x00, 0x0b, 0xb6, 0x01, 0x34, 0x10, 0x01, 0x01,
-    0x70, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x56, 0xfd, 0xfb, 0x04, 0x4b, 0x04, 0x9d,
-    0x06, 0x26, 0x01, 0xff, 0x00, 0x00, 0x01, 0x07, 0x01, 0xd4, 0x01, 0x73, 0xfe, 0x97, 0x00, 0x0e,
-    0xb4, 0x01, 0x34, 0x05, 0x01, 0x01, 0xb8, 0xff, 0x99, 0xb0, 0x56, 0x00, 0x2b, 0x34, 0xff, 0xff,
-    0x00, 0x76, 0x00, 0x00, 0x04, 0x67, 0x06, 0x1e, 0x06, 0x26, 0x01, 0xfe, 0x00, 0x00, 0x01, 0x07,
-    0x00, 0x9e, 0x00, 0x7d, 0x00, 0x1e, 0x00, 0x0b, 0xb6, 0x03, 0x11, 0x07, 0x01, 0x01, 0x76, 0x56,
-    0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0xff, 0x91, 0x00, 0x00, 0x02, 0x6d, 0x06, 0x12, 0x06, 0x26,
-    0x01, 0xfd, 0x00, 0x00, 0x01, 0x07, 0x00, 0xa5, 0xff, 0x1a, 0x00, 0x1f, 0x00, 0x0b, 0xb6, 0x01,
-    0x09, 0x03, 0x01, 0x01, 0x7f, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0xff, 0xaf, 0x00, 0x00,
-    0x02, 0x56, 0x05, 0xcb, 0x06, 0x26, 0x01, 0xfd, 0x00, 0x00, 0x01, 0x07, 0x00, 0x70, 0xff, 0x12,
-    0x00, 0x21, 0x00, 0x0b, 0xb6, 0x01, 0x06, 0x03, 0x01, 0x01, 0xb0, 0x56, 0x00, 0x2b, 0x34, 0x00,
-    0xff, 0xff, 0xff, 0xba, 0x00, 0x00, 0x02, 0x44, 0x06, 0x05, 0x06, 0x26, 0x01, 0xfd, 0x00, 0x00,
-    0x01, 0x07, 0x00, 0xa1, 0xff, 0x45, 0x00, 0x1e, 0x00, 0x0b, 0xb6, 0x01, 0x09, 0x03, 0x01, 0x01,
-    0x5d, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x17, 0xfe, 0x54, 0x01, 0x8d, 0x04, 0x8d,
-    0x06, 0x26, 0x01, 0xfd, 0x00, 0x00, 0x00, 0x06, 0x00, 0xa4, 0xee, 0x00, 0xff, 0xff, 0x00, 0x7d,
-    0x00, 0x00, 0x01, 0x81, 0x05, 0xfb, 0x06, 0x26, 0x01, 0xfd, 0x00, 0x00, 0x01, 0x06, 0x00, 0xa2,
-    0xfc, 0x26, 0x00, 0x0b, 0xb6, 0x01, 0x0d, 0x03, 0x01, 0x01, 0x80, 0x56, 0x00, 0x2b, 0x34, 0x00,
-    0xff, 0xff, 0x00, 0x26, 0xff, 0xf0, 0x04, 0x3e, 0x06, 0x1e, 0x06, 0x26, 0x01, 0xfc, 0x00, 0x00,
-    0x01, 0x07, 0x00, 0x9e, 0x00, 0xfa, 0x00, 0x1e, 0x00, 0x0b, 0xb6, 0x01, 0x19, 0x01, 0x01, 0x01,
-    0x76, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x76, 0xfe, 0x03, 0x04, 0x67, 0x04, 0x8d,
-    0x06, 0x26, 0x01, 0xfb, 0x00, 0x00, 0x00, 0x07, 0x01, 0xd4, 0x01, 0x14, 0xfe, 0x9f, 0xff, 0xff,
-    0x00, 0x76, 0x00, 0x00, 0x03, 0x92, 0x06, 0x1e, 0x06, 0x26, 0x01, 0xfa, 0x00, 0x00, 0x01, 0x06,
-    0x00, 0x75, 0x0d, 0x1e, 0x00, 0x0b, 0xb6, 0x02, 0x08, 0x07, 0x01, 0x01, 0x6b, 0x56, 0x00, 0x2b,
-    0x34, 0x00, 0xff, 0xff, 0x00, 0x76, 0xfe, 0x04, 0x03, 0x92, 0x04, 0x8d, 0x06, 0x26, 0x01, 0xfa,
-    0x00, 0x00, 0x01, 0x07, 0x01, 0xd4, 0x01, 0x12, 0xfe, 0xa0, 0x00, 0x0e, 0xb4, 0x02, 0x11, 0x06,
-    0x01, 0x01, 0xb8, 0xff, 0x95, 0xb0, 0x56, 0x00, 0x2b, 0x34, 0xff, 0xff, 0x00, 0x76, 0x00, 0x00,
-    0x03, 0x92, 0x04, 0x90, 0x06, 0x26, 0x01, 0xfa, 0x00, 0x00, 0x00, 0x07, 0x01, 0xd4, 0x01, 0x92,
-    0x03, 0x90, 0xff, 0xff, 0x00, 0x76, 0x00, 0x00, 0x03, 0x92, 0x04, 0x8d, 0x06, 0x26, 0x01, 0xfa,
-    0x00, 0x00, 0x00, 0x07, 0x00, 0xa2, 0x01, 0x75, 0xfd, 0x41, 0xff, 0xff, 0x00, 0x76, 0x00, 0x00,
-    0x04, 0x67, 0x06, 0x1e, 0x06, 0x26, 0x01, 0xf8, 0x00, 0x00, 0x01, 0x07, 0x00, 0x75, 0x01, 0x88,
-    0x00, 0x1e, 0x00, 0x0b, 0xb6, 0x01, 0x0a, 0x06, 0x01, 0x01, 0x6b, 0x56, 0x00, 0x2b, 0x34, 0x00,
-    0xff, 0xff, 0x00, 0x76, 0xfd, 0xfd, 0x04, 0x67, 0x04, 0x8d, 0x06, 0x26, 0x01, 0xf8, 0x00, 0x00,
-    0x00, 0x07, 0x01, 0xd4, 0x01, 0x7c, 0xfe, 0x99, 0xff, 0xff, 0x00, 0x76, 0x00, 0x00, 0x04, 0x67,
-    0x06, 0x1e, 0x06, 0x26, 0x01, 0xf8, 0x00, 0x00, 0x01, 0x07, 0x00, 0x9f, 0x00, 0x9f, 0x00, 0x1e,
-    0x00, 0x0b, 0xb6, 0x01, 0x10, 0x06, 0x01, 0x01, 0x74, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff,
-    0x00, 0x4e, 0xff, 0xf0, 0x04, 0x6e, 0x05, 0xcb, 0x06, 0x26, 0x01, 0xf7, 0x00, 0x00, 0x01, 0x07,
-    0x00, 0x70, 0x00, 0x70, 0x00, 0x21, 0x00, 0x0b, 0xb6, 0x02, 0x2e, 0x11, 0x01, 0x01, 0xa0, 0x56,
-    0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x4e, 0xff, 0xf0, 0x04, 0x6e, 0x06, 0x05, 0x06, 0x26,
-    0x01, 0xf7, 0x00, 0x00, 0x01, 0x07, 0x00, 0xa1, 0x00, 0xa3, 0x00, 0x1e, 0x00, 0x0b, 0xb6, 0x02,
-    0x31, 0x11, 0x01, 0x01, 0x4d, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x4e, 0xff, 0xf0,
-    0x04, 0x6e, 0x06, 0x1d, 0x06, 0x26, 0x01, 0xf7, 0x00, 0x00, 0x01, 0x07, 0x00, 0xa6, 0x00, 0xfb,
-    0x00, 0x1e, 0x00, 0x0d, 0xb7, 0x03, 0x02, 0x30, 0x11, 0x01, 0x01, 0x51, 0x56, 0x00, 0x2b, 0x34,
-    0x34, 0x00, 0xff, 0xff, 0x00, 0x75, 0x00, 0x00, 0x04, 0x3b, 0x06, 0x1e, 0x06, 0x26, 0x01, 0xf4,
-    0x00, 0x00, 0x01, 0x07, 0x00, 0x75, 0x01, 0x1a, 0x00, 0x1e, 0x00, 0x0b, 0xb6, 0x02, 0x1f, 0x00,
-    0x01, 0x01, 0x6b, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x75, 0xfe, 0x04, 0x04, 0x3b,
-    0x04, 0x8d, 0x06, 0x26, 0x01, 0xf4, 0x00, 0x00, 0x00, 0x07, 0x01, 0xd4, 0x01, 0x1b, 0xfe, 0xa0,
-    0xff, 0xff, 0x00, 0x75, 0x00, 0x00, 0x04, 0x3b, 0x06, 0x1e, 0x06, 0x26, 0x01, 0xf4, 0x00, 0x00,
-    0x01, 0x06, 0x00, 0x9f, 0x30, 0x1e, 0x00, 0x0b, 0xb6, 0x02, 0x25, 0x00, 0x01, 0x01, 0x74, 0x56,
-    0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x3f, 0xff, 0xf0, 0x03, 0xf0, 0x06, 0x1e, 0x06, 0x26,
-    0x01, 0xf3, 0x00, 0x00, 0x01, 0x07, 0x00, 0x75, 0x01, 0x47, 0x00, 0x1e, 0x00, 0x0b, 0xb6, 0x01,
-    0x3a, 0x0f, 0x01, 0x01, 0x5b, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x3f, 0xff, 0xf0,
-    0x03, 0xf0, 0x06, 0x1e, 0x06, 0x26, 0x01, 0xf3, 0x00, 0x00, 0x01, 0x06, 0x00, 0x9e, 0x47, 0x1e,
-    0x00, 0x0b, 0xb6, 0x01, 0x3f, 0x0f, 0x01, 0x01, 0x66, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff,
-    0x00, 0x3f, 0xfe, 0x3f, 0x03, 0xf0, 0x04, 0x9d, 0x06, 0x26, 0x01, 0xf3, 0x00, 0x00, 0x00, 0x07,
-    0x00, 0x79, 0x01, 0x52, 0x00, 0x00, 0xff, 0xff, 0x00, 0x3f, 0xff, 0xf0, 0x03, 0xf0, 0x06, 0x1e,
-    0x06, 0x26, 0x01, 0xf3, 0x00, 0x00, 0x01, 0x06, 0x00, 0x9f, 0x5d, 0x1e, 0x00, 0x0b, 0xb6, 0x01,
-    0x40, 0x0f, 0x01, 0x01, 0x66, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x25, 0xfe, 0x03,
-    0x04, 0x19, 0x04, 0x8d, 0x06, 0x26, 0x01, 0xf2, 0x00, 0x00, 0x01, 0x07, 0x01, 0xd4, 0x01, 0x29,
-    0xfe, 0x9f, 0x00, 0x0e, 0xb4, 0x02, 0x11, 0x02, 0x01, 0x01, 0xb8, 0xff, 0x90, 0xb0, 0x56, 0x00,
-    0x2b, 0x34, 0xff, 0xff, 0x00, 0x25, 0x00, 0x00, 0x04, 0x19, 0x06, 0x1e, 0x06, 0x26, 0x01, 0xf2,
-    0x00, 0x00, 0x01, 0x06, 0x00, 0x9f, 0x4a, 0x1e, 0x00, 0x0b, 0xb6, 0x02, 0x0e, 0x07, 0x01, 0x01,
-    0x74, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x25, 0xfe, 0x46, 0x04, 0x19, 0x04, 0x8d,
-    0x06, 0x26, 0x01, 0xf2, 0x00, 0x00, 0x00, 0x07, 0x00, 0x79, 0x01, 0x3c, 0x00, 0x07, 0xff, 0xff,
-    0x00, 0x69, 0xff, 0xf0, 0x04, 0x20, 0x06, 0x12, 0x06, 0x26, 0x01, 0xf1, 0x00, 0x00, 0x01, 0x06,
-    0x00, 0xa5, 0x5d, 0x1f, 0x00, 0x0b, 0xb6, 0x01, 0x1b, 0x0b, 0x01, 0x01, 0x7f, 0x56, 0x00, 0x2b,
-    0x34, 0x00, 0xff, 0xff, 0x00, 0x69, 0xff, 0xf0, 0x04, 0x20, 0x05, 0xcb, 0x06, 0x26, 0x01, 0xf1,
-    0x00, 0x00, 0x01, 0x06, 0x00, 0x70, 0x55, 0x21, 0x00, 0x0b, 0xb6, 0x01, 0x18, 0x0b, 0x01, 0x01,
-    0xb0, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x69, 0xff, 0xf0, 0x04, 0x20, 0x06, 0x05,
-    0x06, 0x26, 0x01, 0xf1, 0x00, 0x00, 0x01, 0x07, 0x00, 0xa1, 0x00, 0x88, 0x00, 0x1e, 0x00, 0x0b,
-    0xb6, 0x01, 0x1b, 0x0b, 0x01, 0x01, 0x5d, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x69,
-    0xff, 0xf0, 0x04, 0x20, 0x06, 0x78, 0x06, 0x26, 0x01, 0xf1, 0x00, 0x00, 0x01, 0x07, 0x00, 0xa3,
-    0x00, 0xf0, 0x00, 0x53, 0x00, 0x0d, 0xb7, 0x02, 0x01, 0x21, 0x0b, 0x01, 0x01, 0x51, 0x56, 0x00,
-    0x2b, 0x34, 0x34, 0x00, 0xff, 0xff, 0x00, 0x69, 0xff, 0xf0, 0x04, 0x38, 0x06, 0x1d, 0x06, 0x26,
-    0x01, 0xf1, 0x00, 0x00, 0x01, 0x07, 0x00, 0xa6, 0x00, 0xe0, 0x00, 0x1e, 0x00, 0x0d, 0xb7, 0x02,
-    0x01, 0x1a, 0x0b, 0x01, 0x01, 0x61, 0x56, 0x00, 0x2b, 0x34, 0x34, 0x00, 0x00, 0x02, 0x00, 0x69,
-    0xfe, 0x84, 0x04, 0x20, 0x04, 0x8d, 0x00, 0x15, 0x00, 0x2b, 0x00, 0x1a, 0x40, 0x0c, 0x1e, 0x25,
-    0x17, 0x16, 0x16, 0x11, 0x06, 0x0b, 0x72, 0x0c, 0x00, 0x7d, 0x00, 0x3f, 0x32, 0x2b, 0x32, 0x32,
-    0x11, 0x33, 0x2f, 0x33, 0x30, 0x31, 0x41, 0x33, 0x11, 0x14, 0x06, 0x06, 0x23, 0x22, 0x26, 0x26,
-    0x35, 0x11, 0x33, 0x11, 0x14, 0x16, 0x16, 0x33, 0x32, 0x36, 0x36, 0x35, 0x03, 0x17, 0x0e, 0x02,
-    0x15, 0x14, 0x16, 0x33, 0x32, 0x36, 0x37, 0x17, 0x06, 0x06, 0x23, 0x22, 0x26, 0x35, 0x34, 0x36,
-    0x36, 0x03, 0x2e, 0xf2, 0x7c, 0xd6, 0x89, 0x8b, 0xd7, 0x7a, 0xf0, 0x39, 0x6a, 0x49, 0x49, 0x68,
-    0x38, 0x53, 0x73, 0x2f, 0x49, 0x2a, 0x20, 0x27, 0x1f, 0x2c, 0x0e, 0x17, 0x19, 0x4e, 0x3c, 0x58,
-    0x7a, 0x2e, 0x68, 0x04, 0x8d, 0xfd, 0x00, 0x86, 0xb9, 0x5e, 0x5e, 0xb9, 0x86, 0x03, 0x00, 0xfd,
-    0x00, 0x4d, 0x63, 0x2e, 0x2e, 0x63, 0x4d, 0xfe, 0xdd, 0x3a, 0x1e, 0x3d, 0x45, 0x28, 0x1e, 0x27,
-    0x11, 0x07, 0x8b, 0x0f, 0x1d, 0x66, 0x62, 0x34, 0x65, 0x5d, 0xff, 0xff, 0x00, 0x27, 0x00, 0x00,
-    0x05, 0xe5, 0x06, 0x1e, 0x06, 0x26, 0x01, 0xef, 0x00, 0x00, 0x01, 0x07, 0x00, 0x9e, 0x01, 0x1a,
-    0x00, 0x1e, 0x00, 0x0b, 0xb6, 0x04, 0x1b, 0x0a, 0x01, 0x01, 0x76, 0x56, 0x00, 0x2b, 0x34, 0x00,
-    0xff, 0xff, 0x00, 0x06, 0x00, 0x00, 0x04, 0x38, 0x06, 0x1e, 0x06, 0x26, 0x01, 0xed, 0x00, 0x00,
-    0x01, 0x06, 0x00, 0x9e, 0x31, 0x1e, 0x00, 0x0b, 0xb6, 0x03, 0x13, 0x09, 0x01, 0x01, 0x76, 0x56,
-    0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x06, 0x00, 0x00, 0x04, 0x38, 0x05, 0xeb, 0x06, 0x26,
-    0x01, 0xed, 0x00, 0x00, 0x01, 0x06, 0x00, 0x6a, 0x52, 0x1e, 0x00, 0x0d, 0xb7, 0x04, 0x03, 0x17,
-    0x09, 0x01, 0x01, 0x84, 0x56, 0x00, 0x2b, 0x34, 0x34, 0x00, 0xff, 0xff, 0x00, 0x41, 0x00, 0x00,
-    0x03, 0xf5, 0x06, 0x1e, 0x06, 0x26, 0x01, 0xec, 0x00, 0x00, 0x01, 0x07, 0x00, 0x75, 0x01, 0x34,
-    0x00, 0x1e, 0x00, 0x0b, 0xb6, 0x03, 0x0e, 0x0d, 0x01, 0x01, 0x6b, 0x56, 0x00, 0x2b, 0x34, 0x00,
-    0xff, 0xff, 0x00, 0x41, 0x00, 0x00, 0x03, 0xf5, 0x05, 0xfb, 0x06, 0x26, 0x01, 0xec, 0x00, 0x00,
-    0x01, 0x07, 0x00, 0xa2, 0x01, 0x19, 0x00, 0x26, 0x00, 0x0b, 0xb6, 0x03, 0x17, 0x0d, 0x01, 0x01,
-    0x80, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x41, 0x00, 0x00, 0x03, 0xf5, 0x06, 0x1e,
-    0x06, 0x26, 0x01, 0xec, 0x00, 0x00, 0x01, 0x06, 0x00, 0x9f, 0x4b, 0x1e, 0x00, 0x0b, 0xb6, 0x03,
-    0x14, 0x0d, 0x01, 0x01, 0x74, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x11, 0x00, 0x00,
-    0x05, 0x3f, 0x06, 0x3f, 0x06, 0x26, 0x00, 0x25, 0x00, 0x00, 0x01, 0x06, 0x00, 0xae, 0xad, 0xff,
-    0x00, 0x0e, 0xb4, 0x03, 0x0e, 0x03, 0x00, 0x00, 0xb8, 0xff, 0x3e, 0xb0, 0x56, 0x00, 0x2b, 0x34,
-    0xff, 0xff, 0xff, 0x42, 0x00, 0x00, 0x04, 0xb1, 0x06, 0x41, 0x04, 0x26, 0x00, 0x29, 0x64, 0x00,
-    0x01, 0x07, 0x00, 0xae, 0xfe, 0x75, 0x00, 0x01, 0x00, 0x0e, 0xb4, 0x04, 0x10, 0x07, 0x00, 0x00,
-    0xb8, 0xff, 0x3f, 0xb0, 0x56, 0x00, 0x2b, 0x34, 0xff, 0xff, 0xff, 0x4a, 0x00, 0x00, 0x05, 0x7b,
-    0x06, 0x40, 0x04, 0x26, 0x00, 0x2c, 0x64, 0x00, 0x00, 0x07, 0x00, 0xae, 0xfe, 0x7e, 0x00, 0x00,
-    0xff, 0xff, 0xff, 0x4e, 0x00, 0x00, 0x02, 0x04, 0x06, 0x42, 0x04, 0x26, 0x00, 0x2d, 0x64, 0x00,
-    0x01, 0x07, 0x00, 0xae, 0xfe, 0x81, 0x00, 0x02, 0x00, 0x0e, 0xb4, 0x01, 0x04, 0x03, 0x00, 0x00,
-    0xb8, 0xff, 0x41, 0xb0, 0x56, 0x00, 0x2b, 0x34, 0xff, 0xff, 0xff, 0xb4, 0xff, 0xec, 0x05, 0x31,
-    0x06, 0x3f, 0x04, 0x26, 0x00, 0x33, 0x14, 0x00, 0x01, 0x07, 0x00, 0xae, 0xfe, 0xe8, 0xff, 0xff,
-    0x00, 0x0e, 0xb4, 0x02, 0x2c, 0x11, 0x00, 0x00, 0xb8, 0xff, 0x2a, 0xb0, 0x56, 0x00, 0x2b, 0x34,
-    0xff, 0xff, 0xff, 0x41, 0x00, 0x00, 0x05, 0x3d, 0x06, 0x3f, 0x04, 0x26, 0x00, 0x3d, 0x64, 0x00,
-    0x01, 0x07, 0x00, 0xae, 0xfe, 0x74, 0xff, 0xff, 0x00, 0x0b, 0xb6, 0x01, 0x0a, 0x08, 0x00, 0x00,
-    0x8e, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0xff, 0xc2, 0x00, 0x00, 0x04, 0xef, 0x06, 0x3f,
-    0x04, 0x26, 0x00, 0xba, 0x14, 0x00, 0x01, 0x07, 0x00, 0xae, 0xfe, 0xf5, 0xff, 0xff, 0x00, 0x0e,
-    0xb4, 0x03, 0x36, 0x1d, 0x00, 0x00, 0xb8, 0xff, 0x2a, 0xb0, 0x56, 0x00, 0x2b, 0x34, 0xff, 0xff,
-    0xff, 0x85, 0xff, 0xf4, 0x02, 0xce, 0x06, 0x9b, 0x06, 0x26, 0x00, 0xc3, 0x00, 0x00, 0x01, 0x07,
-    0x00, 0xaf, 0xff, 0x17, 0xff, 0xeb, 0x00, 0x10, 0x40, 0x09, 0x03, 0x02, 0x01, 0x2b, 0x00, 0x01,
-    0x01, 0xa2, 0x56, 0x00, 0x2b, 0x34, 0x34, 0x34, 0xff, 0xff, 0x00, 0x11, 0x00, 0x00, 0x05, 0x3f,
-    0x05, 0xb0, 0x06, 0x06, 0x00, 0x25, 0x00, 0x00, 0xff, 0xff, 0x00, 0x94, 0x00, 0x00, 0x04, 0xa5,
-    0x05, 0xb0, 0x06, 0x06, 0x00, 0x26, 0x00, 0x00, 0xff, 0xff, 0x00, 0x94, 0x00, 0x00, 0x04, 0x4d,
-    0x05, 0xb0, 0x06, 0x06, 0x00, 0x29, 0x00, 0x00, 0xff, 0xff, 0x00, 0x50, 0x00, 0x00, 0x04, 0x8e,
-    0x05, 0xb0, 0x06, 0x06, 0x00, 0x3e, 0x00, 0x00, 0xff, 0xff, 0x00, 0x94, 0x00, 0x00, 0x05, 0x17,
-    0x05, 0xb0, 0x06, 0x06, 0x00, 0x2c, 0x00, 0x00, 0xff, 0xff, 0x00, 0xa5, 0x00, 0x00, 0x01, 0xa0,
-    0x05, 0xb0, 0x06, 0x06, 0x00, 0x2d, 0x00, 0x00, 0xff, 0xff, 0x00, 0x94, 0x00, 0x00, 0x05, 0x16,
-    0x05, 0xb0, 0x06, 0x06, 0x00, 0x2f, 0x00, 0x00, 0xff, 0xff, 0x00, 0x94, 0x00, 0x00, 0x06, 0x6a,
-    0x05, 0xb0, 0x06, 0x06, 0x00, 0x31, 0x00, 0x00, 0xff, 0xff, 0x00, 0x94, 0x00, 0x00, 0x05, 0x17,
-    0x05, 0xb0, 0x06, 0x06, 0x00, 0x32, 0x00, 0x00, 0xff, 0xff, 0x00, 0x65, 0xff, 0xec, 0x05, 0x1d,
-    0x05, 0xc4, 0x06, 0x06, 0x00, 0x33, 0x00, 0x00, 0xff, 0xff, 0x00, 0x94, 0x00, 0x00, 0x04, 0xcf,
-    0x05, 0xb0, 0x06, 0x06, 0x00, 0x34, 0x00, 0x00, 0xff, 0xff, 0x00, 0x2d, 0x00, 0x00, 0x04, 0xb4,
-    0x05, 0xb0, 0x06, 0x06, 0x00, 0x38, 0x00, 0x00, 0xff, 0xff, 0x00, 0x08, 0x00, 0x00, 0x04, 0xd9,
-    0x05, 0xb0, 0x06, 0x06, 0x00, 0x3d, 0x00, 0x00, 0xff, 0xff, 0x00, 0x26, 0x00, 0x00, 0x04, 0xe9,
-    0x05, 0xb0, 0x06, 0x06, 0x00, 0x3c, 0x00, 0x00, 0xff, 0xff, 0xff, 0xbe, 0x00, 0x00, 0x02, 0x87,
-    0x07, 0x0b, 0x06, 0x26, 0x00, 0x2d, 0x00, 0x00, 0x01, 0x07, 0x00, 0x6a, 0xff, 0x5b, 0x01, 0x3e,
-    0x00, 0x0d, 0xb7, 0x02, 0x01, 0x19, 0x03, 0x01, 0x01, 0x83, 0x56, 0x00, 0x2b, 0x34, 0x34, 0x00,
-    0xff, 0xff, 0x00, 0x08, 0x00, 0x00, 0x04, 0xd9, 0x07, 0x03, 0x06, 0x26, 0x00, 0x3d, 0x00, 0x00,
-    0x01, 0x07, 0x00, 0x6a, 0x00, 0xad, 0x01, 0x36, 0x00, 0x0d, 0xb7, 0x02, 0x01, 0x1e, 0x02, 0x01,
-    0x01, 0x77, 0x56, 0x00, 0x2b, 0x34, 0x34, 0x00, 0xff, 0xff, 0x00, 0x56, 0xff, 0xeb, 0x04, 0x7b,
-    0x06, 0x3c, 0x06, 0x26, 0x00, 0xbb, 0x00, 0x00, 0x01, 0x07, 0x00, 0xae, 0x01, 0x49, 0xff, 0xfc,
-    0x00, 0x0b, 0xb6, 0x03, 0x42, 0x06, 0x01, 0x01, 0x9a, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff,
-    0x00, 0x62, 0xff, 0xec, 0x04, 0x12, 0x06, 0x3b, 0x06, 0x26, 0x00, 0xbf, 0x00, 0x00, 0x01, 0x07,
-    0x00, 0xae, 0x01, 0x15, 0xff, 0xfb, 0x00, 0x0b, 0xb6, 0x02, 0x40, 0x2b, 0x01, 0x01, 0x9a, 0x56,
-    0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x7d, 0xfe, 0x61, 0x04, 0x06, 0x06, 0x3c, 0x06, 0x26,
-    0x00, 0xc1, 0x00, 0x00, 0x01, 0x07, 0x00, 0xae, 0x01, 0x1d, 0xff, 0xfc, 0x00, 0x0b, 0xb6, 0x02,
-    0x1d, 0x03, 0x01, 0x01, 0xae, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0xa3, 0xff, 0xf4,
-    0x02, 0x5e, 0x06, 0x26, 0x06, 0x26, 0x00, 0xc3, 0x00, 0x00, 0x01, 0x06, 0x00, 0xae, 0x01, 0xe6,
-    0x00, 0x0b, 0xb6, 0x01, 0x12, 0x00, 0x01, 0x01, 0x99, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff,
-    0x00, 0x7f, 0xff, 0xeb, 0x04, 0x04, 0x06, 0xa3, 0x06, 0x26, 0x00, 0xcb, 0x00, 0x00, 0x01, 0x06,
-    0x00, 0xaf, 0x1c, 0xf3, 0x00, 0x10, 0x40, 0x09, 0x03, 0x02, 0x01, 0x38, 0x0f, 0x01, 0x01, 0xa2,
-    0x56, 0x00, 0x2b, 0x34, 0x34, 0x34, 0xff, 0xff, 0x00, 0x8d, 0x00, 0x00, 0x04, 0x6d, 0x04, 0x3a,
-    0x06, 0x06, 0x00, 0x8e, 0x00, 0x00, 0xff, 0xff, 0x00, 0x4e, 0xff, 0xec, 0x04, 0x3c, 0x04, 0x4e,
-    0x06, 0x06, 0x00, 0x53, 0x00, 0x00, 0xff, 0xff, 0x00, 0x93, 0xfe, 0x60, 0x04, 0x24, 0x04, 0x3a,
-    0x06, 0x06, 0x00, 0x76, 0x00, 0x00, 0xff, 0xff, 0x00, 0x16, 0x00, 0x00, 0x03, 0xdf, 0x04, 0x3a,
-    0x06, 0x06, 0x00, 0x5a, 0x00, 0x00, 0xff, 0xff, 0x00, 0x34, 0xfe, 0x4d, 0x04, 0x5b, 0x04, 0x4a,
-    0x06, 0x06, 0x02, 0x8a, 0x00, 0x00, 0xff, 0xff, 0xff, 0xc3, 0xff, 0xf4, 0x02, 0x8b, 0x05, 0xb8,
-    0x06, 0x26, 0x00, 0xc3, 0x00, 0x00, 0x01, 0x07, 0x00, 0x6a, 0xff, 0x60, 0xff, 0xeb, 0x00, 0x0d,
-    0xb7, 0x02, 0x01, 0x27, 0x00, 0x01, 0x01, 0xa2, 0x56, 0x00, 0x2b, 0x34, 0x34, 0x00, 0xff, 0xff,
-    0x00, 0x7f, 0xff, 0xeb, 0x04, 0x04, 0x05, 0xc0, 0x06, 0x26, 0x00, 0xcb, 0x00, 0x00, 0x01, 0x06,
-    0x00, 0x6a, 0x65, 0xf3, 0x00, 0x0d, 0xb7, 0x02, 0x01, 0x34, 0x0f, 0x01, 0x01, 0xa2, 0x56, 0x00,
-    0x2b, 0x34, 0x34, 0x00, 0xff, 0xff, 0x00, 0x4e, 0xff, 0xec, 0x04, 0x3c, 0x06, 0x3c, 0x06, 0x26,
-    0x00, 0x53, 0x00, 0x00, 0x01, 0x07, 0x00, 0xae, 0x01, 0x1b, 0xff, 0xfc, 0x00, 0x0b, 0xb6, 0x02,
-    0x2c, 0x06, 0x01, 0x01, 0x9a, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x7f, 0xff, 0xeb,
-    0x04, 0x04, 0x06, 0x2e, 0x06, 0x26, 0x00, 0xcb, 0x00, 0x00, 0x01, 0x07, 0x00, 0xae, 0x01, 0x06,
-    0xff, 0xee, 0x00, 0x0b, 0xb6, 0x01, 0x1f, 0x0f, 0x01, 0x01, 0x99, 0x56, 0x00, 0x2b, 0x34, 0x00,
-    0xff, 0xff, 0x00, 0x65, 0xff, 0xeb, 0x06, 0x30, 0x06, 0x2c, 0x06, 0x26, 0x00, 0xce, 0x00, 0x00,
-    0x01, 0x07, 0x00, 0xae, 0x02, 0x27, 0xff, 0xec, 0x00, 0x0b, 0xb6, 0x02, 0x40, 0x1f, 0x01, 0x01,
-    0x96, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x94, 0x00, 0x00, 0x04, 0x4d, 0x07, 0x0b,
-    0x06, 0x26, 0x00, 0x29, 0x00, 0x00, 0x01, 0x07, 0x00, 0x6a, 0x00, 0xae, 0x01, 0x3e, 0x00, 0x0d,
-    0xb7, 0x05, 0x04, 0x25, 0x07, 0x01, 0x01, 0x83, 0x56, 0x00, 0x2b, 0x34, 0x34, 0x00, 0xff, 0xff,
-    0x00, 0x99, 0x00, 0x00, 0x04, 0x37, 0x07, 0x3e, 0x06, 0x26, 0x00, 0xb1, 0x00, 0x00, 0x01, 0x07,
-    0x00, 0x75, 0x01, 0x84, 0x01, 0x3e, 0x00, 0x0b, 0xb6, 0x01, 0x06, 0x05, 0x01, 0x01, 0x6c, 0x56,
-    0x00, 0x2b, 0x34, 0x00, 0x00, 0x01, 0x00, 0x4b, 0xff, 0xec, 0x04, 0x8e, 0x05, 0xc4, 0x00, 0x39,
-    0x00, 0x1b, 0x40, 0x0d, 0x0a, 0x26, 0x0f, 0x36, 0x31, 0x2b, 0x09, 0x72, 0x18, 0x14, 0x0f, 0x03,
-    0x72, 0x00, 0x2b, 0xcc, 0x33, 0x2b, 0xcc, 0x33, 0x12, 0x39, 0x39, 0x30, 0x31, 0x41, 0x34, 0x2e,
-    0x02, 0x27, 0x2e, 0x03, 0x35, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x16, 0x16, 0x15, 0x23, 0x34, 0x26,
-    0x26, 0x23, 0x22, 0x06, 0x06, 0x15, 0x14, 0x1e, 0x02, 0x17, 0x1e, 0x03, 0x15, 0x14, 0x0e, 0x02,
-    0x23, 0x22, 0x2e, 0x02, 0x35, 0x33, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x36, 0x36, 0x03, 0x92, 0x1b,
-    0x44, 0x7b, 0x5f, 0x68, 0xaf, 0x82, 0x48, 0x4b, 0x8b, 0xbe, 0x73, 0xa2, 0xeb, 0x7f, 0xf9, 0x3d,
-    0x7b, 0x5e, 0x59, 0x76, 0x3a, 0x26, 0x4e, 0x76, 0x50, 0x79, 0xb4, 0x78, 0x3c, 0x4a, 0x89, 0xbf,
-    0x75, 0x69, 0xcb, 0xa6, 0x62, 0xfb, 0x31, 0x58, 0x75, 0x43, 0x58, 0x77, 0x3c, 0x01, 0x77, 0x2d,
-    0x46, 0x3a, 0x37, 0x1d, 0x20, 0x4f, 0x69, 0x89, 0x5a, 0x59, 0x92, 0x6b, 0x3b, 0x78, 0xca, 0x7a,
-    0x48, 0x6f, 0x40, 0x36, 0x5c, 0x3a, 0x29, 0x43, 0x39, 0x32, 0x17, 0x24, 0x57, 0x6e, 0x8b, 0x58,
-    0x5c, 0x93, 0x67, 0x37, 0x38, 0x73, 0xad, 0x74, 0x47, 0x64, 0x3f, 0x1e, 0x32, 0x5a, 0xff, 0xff,
-    0x00, 0xa5, 0x00, 0x00, 0x01, 0xa0, 0x05, 0xb0, 0x06, 0x06, 0x00, 0x2d, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xbe, 0x00, 0x00, 0x02, 0x87, 0x07, 0x0b, 0x06, 0x26, 0x00, 0x2d, 0x00, 0x00, 0x01, 0x07,
-    0x00, 0x6a, 0xff, 0x5b, 0x01, 0x3e, 0x00, 0x0d, 0xb7, 0x02, 0x01, 0x19, 0x03, 0x01, 0x01, 0x83,
-    0x56, 0x00, 0x2b, 0x34, 0x34, 0x00, 0xff, 0xff, 0x00, 0x2f, 0xff, 0xec, 0x03, 0xe5, 0x05, 0xb0,
-    0x06, 0x06, 0x00, 0x2e, 0x00, 0x00, 0xff, 0xff, 0x00, 0x99, 0x00, 0x00, 0x05, 0x2c, 0x05, 0xb0,
-    0x06, 0x06, 0x02, 0x46, 0x00, 0x00, 0xff, 0xff, 0x00, 0x94, 0x00, 0x00, 0x05, 0x16, 0x07, 0x33,
-    0x06, 0x26, 0x00, 0x2f, 0x00, 0x00, 0x01, 0x07, 0x00, 0x75, 0x01, 0x71, 0x01, 0x33, 0x00, 0x0b,
-    0xb6, 0x03, 0x0e, 0x03, 0x01, 0x01, 0x5b, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x32,
-    0xff, 0xeb, 0x04, 0xe1, 0x07, 0x24, 0x06, 0x26, 0x00, 0xde, 0x00, 0x00, 0x01, 0x07, 0x00, 0xa1,
-    0x00, 0xd9, 0x01, 0x3e, 0x00, 0x0b, 0xb6, 0x02, 0x1e, 0x01, 0x01, 0x01, 0x5e, 0x56, 0x00, 0x2b,
-    0x34, 0x00, 0xff, 0xff, 0x00, 0x11, 0x00, 0x00, 0x05, 0x3f, 0x05, 0xb0, 0x06, 0x06, 0x00, 0x25,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x94, 0x00, 0x00, 0x04, 0xa5, 0x05, 0xb0, 0x06, 0x06, 0x00, 0x26,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x99, 0x00, 0x00, 0x04, 0x37, 0x05, 0xb0, 0x06, 0x06, 0x00, 0xb1,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x94, 0x00, 0x00, 0x04, 0x4d, 0x05, 0xb0, 0x06, 0x06, 0x00, 0x29,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x92, 0x00, 0x00, 0x05, 0x0d, 0x07, 0x24, 0x06, 0x26, 0x00, 0xdc,
-    0x00, 0x00, 0x01, 0x07, 0x00, 0xa1, 0x01, 0x19, 0x01, 0x3e, 0x00, 0x0b, 0xb6, 0x01, 0x0f, 0x01,
-    0x01, 0x01, 0x5e, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x94, 0x00, 0x00, 0x06, 0x6a,
-    0x05, 0xb0, 0x06, 0x06, 0x00, 0x31, 0x00, 0x00, 0xff, 0xff, 0x00, 0x94, 0x00, 0x00, 0x05, 0x17,
-    0x05, 0xb0, 0x06, 0x06, 0x00, 0x2c, 0x00, 0x00, 0xff, 0xff, 0x00, 0x65, 0xff, 0xec, 0x05, 0x1d,
-    0x05, 0xc4, 0x06, 0x06, 0x00, 0x33, 0x00, 0x00, 0xff, 0xff, 0x00, 0x99, 0x00, 0x00, 0x05, 0x14,
-    0x05, 0xb0, 0x06, 0x06, 0x00, 0xb6, 0x00, 0x00, 0xff, 0xff, 0x00, 0x94, 0x00, 0x00, 0x04, 0xcf,
-    0x05, 0xb0, 0x06, 0x06, 0x00, 0x34, 0x00, 0x00, 0xff, 0xff, 0x00, 0x66, 0xff, 0xec, 0x04, 0xeb,
-    0x05, 0xc4, 0x06, 0x06, 0x00, 0x27, 0x00, 0x00, 0xff, 0xff, 0x00, 0x2d, 0x00, 0x00, 0x04, 0xb4,
-    0x05, 0xb0, 0x06, 0x06, 0x00, 0x38, 0x00, 0x00, 0xff, 0xff, 0x00, 0x26, 0x00, 0x00, 0x04, 0xe9,
-    0x05, 0xb0, 0x06, 0x06, 0x00, 0x3c, 0x00, 0x00, 0xff, 0xff, 0x00, 0x56, 0xff, 0xec, 0x03, 0xf9,
-    0x04, 0x4e, 0x06, 0x06, 0x00, 0x45, 0x00, 0x00, 0xff, 0xff, 0x00, 0x51, 0xff, 0xec, 0x04, 0x0a,
-    0x04, 0x4e, 0x06, 0x06, 0x00, 0x49, 0x00, 0x00, 0xff, 0xff, 0x00, 0x84, 0x00, 0x00, 0x04, 0x0f,
-    0x05, 0xda, 0x06, 0x26, 0x00, 0xf0, 0x00, 0x00, 0x01, 0x07, 0x00, 0xa1, 0x00, 0x92, 0xff, 0xf3,
-    0x00, 0x0b, 0xb6, 0x01, 0x0f, 0x01, 0x01, 0x01, 0x7d, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff,
-    0x00, 0x4e, 0xff, 0xec, 0x04, 0x3c, 0x04, 0x4e, 0x06, 0x06, 0x00, 0x53, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x7d, 0xfe, 0x60, 0x04, 0x2f, 0x04, 0x4e, 0x06, 0x06, 0x00, 0x54, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x4e, 0xff, 0xec, 0x03, 0xf1, 0x04, 0x4e, 0x00, 0x27, 0x00, 0x13, 0x40, 0x09, 0x00, 0x09,
-    0x1d, 0x14, 0x07, 0x72, 0x09, 0x0b, 0x72, 0x00, 0x2b, 0x2b, 0x32, 0x11, 0x33, 0x30, 0x31, 0x65,
-    0x32, 0x36, 0x36, 0x37, 0x33, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x35, 0x34, 0x3e, 0x02,
-    0x33, 0x32, 0x16, 0x16, 0x17, 0x23, 0x2e, 0x02, 0x23, 0x22, 0x0e, 0x02, 0x15, 0x15, 0x14, 0x1e,
-    0x02, 0x02, 0x36, 0x3b, 0x5f, 0x3b, 0x03, 0xe3, 0x02, 0x78, 0xc6, 0x78, 0x7c, 0xb8, 0x7a, 0x3d,
-    0x3d, 0x7a, 0xb8, 0x7b, 0x82, 0xc4, 0x71, 0x02, 0xe3, 0x03, 0x35, 0x5f, 0x42, 0x49, 0x60, 0x36,
-    0x17, 0x16, 0x37, 0x60, 0xac, 0x2f, 0x54, 0x37, 0x69, 0xac, 0x65, 0x55, 0x96, 0xc4, 0x70, 0x23,
-    0x70, 0xc5, 0x96, 0x55, 0x67, 0xb7, 0x79, 0x3c, 0x61, 0x3a, 0x3b, 0x65, 0x7d, 0x43, 0x23, 0x43,
-    0x7e, 0x63, 0x3b, 0x00, 0xff, 0xff, 0x00, 0x0c, 0xfe, 0x4b, 0x03, 0xde, 0x04, 0x3a, 0x06, 0x06,
-    0x00, 0x5d, 0x00, 0x00, 0xff, 0xff, 0x00, 0x1f, 0x00, 0x00, 0x03, 0xea, 0x04, 0x3a, 0x06, 0x06,
-    0x00, 0x5c, 0x00, 0x00, 0xff, 0xff, 0x00, 0x51, 0xff, 0xec, 0x04, 0x0a, 0x05, 0xce, 0x06, 0x26,
-    0x00, 0x49, 0x00, 0x00, 0x01, 0x07, 0x00, 0x6a, 0x00, 0x63, 0x00, 0x00, 0x00, 0x0d, 0xb7, 0x02,
-    0x01, 0x41, 0x0b, 0x01, 0x01, 0xa3, 0x56, 0x00, 0x2b, 0x34, 0x34, 0x00, 0xff, 0xff, 0x00, 0x83,
-    0x00, 0x00, 0x03, 0x4c, 0x05, 0xf3, 0x06, 0x26, 0x00, 0xec, 0x00, 0x00, 0x01, 0x07, 0x00, 0x75,
-    0x00, 0xc4, 0xff, 0xf3, 0x00, 0x0b, 0xb6, 0x01, 0x06, 0x05, 0x01, 0x01, 0x8b, 0x56, 0x00, 0x2b,
-    0x34, 0x00, 0xff, 0xff, 0x00, 0x49, 0xff, 0xec, 0x03, 0xc7, 0x04, 0x4e, 0x06, 0x06, 0x00, 0x57,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x7c, 0x00, 0x00, 0x01, 0x90, 0x05, 0xd6, 0x06, 0x06, 0x00, 0x4d,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xa8, 0x00, 0x00, 0x02, 0x70, 0x05, 0xc4, 0x06, 0x26, 0x00, 0x8d,
-    0x00, 0x00, 0x01, 0x07, 0x00, 0x6a, 0xff, 0x45, 0xff, 0xf7, 0x00, 0x0d, 0xb7, 0x02, 0x01, 0x19,
-    0x03, 0x01, 0x01, 0xb5, 0x56, 0x00, 0x2b, 0x34, 0x34, 0x00, 0xff, 0xff, 0xff, 0xab, 0xfe, 0x4b,
-    0x01, 0x87, 0x05, 0xd6, 0x06, 0x06, 0x00, 0x4e, 0x00, 0x00, 0xff, 0xff, 0x00, 0x8f, 0x00, 0x00,
-    0x04, 0x65, 0x05, 0xf2, 0x06, 0x26, 0x00, 0xf1, 0x00, 0x00, 0x01, 0x07, 0x00, 0x75, 0x01, 0x4b,
-    0xff, 0xf2, 0x00, 0x0b, 0xb6, 0x03, 0x0e, 0x03, 0x01, 0x01, 0x8a, 0x56, 0x00, 0x2b, 0x34, 0x00,
-    0xff, 0xff, 0x00, 0x0c, 0xfe, 0x4b, 0x03, 0xde, 0x05, 0xe7, 0x06, 0x26, 0x00, 0x5d, 0x00, 0x00,
-    0x01, 0x06, 0x00, 0xa1, 0x49, 0x00, 0x00, 0x0b, 0xb6, 0x02, 0x1e, 0x01, 0x01, 0x01, 0x92, 0x56,
-    0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x2f, 0x00, 0x00, 0x06, 0xe6, 0x07, 0x37, 0x06, 0x26,
-    0x00, 0x3b, 0x00, 0x00, 0x01, 0x07, 0x00, 0x44, 0x02, 0x02, 0x01, 0x37, 0x00, 0x0b, 0xb6, 0x04,
-    0x18, 0x15, 0x01, 0x01, 0x61, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x23, 0x00, 0x00,
-    0x05, 0xc8, 0x06, 0x00, 0x06, 0x26, 0x00, 0x5b, 0x00, 0x00, 0x01, 0x07, 0x00, 0x44, 0x01, 0x65,
-    0x00, 0x00, 0x00, 0x0b, 0xb6, 0x04, 0x18, 0x15, 0x01, 0x01, 0xa0, 0x56, 0x00, 0x2b, 0x34, 0x00,
-    0xff, 0xff, 0x00, 0x2f, 0x00, 0x00, 0x06, 0xe6, 0x07, 0x37, 0x06, 0x26, 0x00, 0x3b, 0x00, 0x00,
-    0x01, 0x07, 0x00, 0x75, 0x02, 0xa9, 0x01, 0x37, 0x00, 0x0b, 0xb6, 0x04, 0x16, 0x01, 0x01, 0x01,
-    0x61, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x23, 0x00, 0x00, 0x05, 0xc8, 0x06, 0x00,
-    0x06, 0x26, 0x00, 0x5b, 0x00, 0x00, 0x01, 0x07, 0x00, 0x75, 0x02, 0x0c, 0x00, 0x00, 0x00, 0x0b,
-    0xb6, 0x04, 0x16, 0x01, 0x01, 0x01, 0xa0, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x2f,
-    0x00, 0x00, 0x06, 0xe6, 0x07, 0x04, 0x06, 0x26, 0x00, 0x3b, 0x00, 0x00, 0x01, 0x07, 0x00, 0x6a,
-    0x01, 0xca, 0x01, 0x37, 0x00, 0x0d, 0xb7, 0x05, 0x04, 0x2b, 0x15, 0x01, 0x01, 0x78, 0x56, 0x00,
-    0x2b, 0x34, 0x34, 0x00, 0xff, 0xff, 0x00, 0x23, 0x00, 0x00, 0x05, 0xc8, 0x05, 0xcd, 0x06, 0x26,
-    0x00, 0x5b, 0x00, 0x00, 0x01, 0x07, 0x00, 0x6a, 0x01, 0x2d, 0x00, 0x00, 0x00, 0x0d, 0xb7, 0x05,
-    0x04, 0x2b, 0x15, 0x01, 0x01, 0xb7, 0x56, 0x00, 0x2b, 0x34, 0x34, 0x00, 0xff, 0xff, 0x00, 0x08,
-    0x00, 0x00, 0x04, 0xd9, 0x07, 0x36, 0x06, 0x26, 0x00, 0x3d, 0x00, 0x00, 0x01, 0x07, 0x00, 0x44,
-    0x00, 0xe5, 0x01, 0x36, 0x00, 0x0b, 0xb6, 0x01, 0x0b, 0x02, 0x01, 0x01, 0x60, 0x56, 0x00, 0x2b,
-    0x34, 0x00, 0xff, 0xff, 0x00, 0x0c, 0xfe, 0x4b, 0x03, 0xde, 0x06, 0x00, 0x06, 0x26, 0x00, 0x5d,
-    0x00, 0x00, 0x01, 0x07, 0x00, 0x44, 0x00, 0x75, 0x00, 0x00, 0x00, 0x0b, 0xb6, 0x02, 0x1b, 0x01,
-    0x01, 0x01, 0xa0, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x52, 0x03, 0xfe, 0x01, 0x09,
-    0x06, 0x00, 0x06, 0x06, 0x00, 0x0b, 0x00, 0x00, 0xff, 0xff, 0x00, 0x60, 0x03, 0xf8, 0x02, 0x3a,
-    0x06, 0x00, 0x06, 0x06, 0x00, 0x06, 0x00, 0x00, 0xff, 0xff, 0x00, 0x8c, 0xff, 0xf2, 0x03, 0xbe,
-    0x05, 0xb0, 0x04, 0x26, 0x00, 0x05, 0x00, 0x00, 0x00, 0x07, 0x00, 0x05, 0x02, 0x1e, 0x00, 0x00,
-    0xff, 0xff, 0xff, 0xaa, 0xfe, 0x4b, 0x02, 0x71, 0x05, 0xde, 0x06, 0x26, 0x00, 0x9c, 0x00, 0x00,
-    0x01, 0x07, 0x00, 0x9f, 0xff, 0x3c, 0xff, 0xde, 0x00, 0x0b, 0xb6, 0x01, 0x18, 0x00, 0x01, 0x01,
-    0x80, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x37, 0x04, 0x05, 0x01, 0x61, 0x06, 0x00,
-    0x06, 0x06, 0x01, 0x85, 0x00, 0x00, 0xff, 0xff, 0x00, 0x94, 0x00, 0x00, 0x06, 0x6a, 0x07, 0x37,
-    0x06, 0x26, 0x00, 0x31, 0x00, 0x00, 0x01, 0x07, 0x00, 0x75, 0x02, 0x93, 0x01, 0x37, 0x00, 0x0b,
-    0xb6, 0x03, 0x11, 0x00, 0x01, 0x01, 0x61, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x7c,
-    0x00, 0x00, 0x06, 0x7c, 0x06, 0x00, 0x06, 0x26, 0x00, 0x51, 0x00, 0x00, 0x01, 0x07, 0x00, 0x75,
-    0x02, 0xa4, 0x00, 0x00, 0x00, 0x0b, 0xb6, 0x03, 0x33, 0x03, 0x01, 0x01, 0xa0, 0x56, 0x00, 0x2b,
-    0x34, 0x00, 0xff, 0xff, 0x00, 0x11, 0xfe, 0x72, 0x05, 0x3f, 0x05, 0xb0, 0x06, 0x26, 0x00, 0x25,
-    0x00, 0x00, 0x01, 0x07, 0x00, 0xa7, 0x01, 0x74, 0x00, 0x04, 0x00, 0x10, 0xb5, 0x04, 0x03, 0x11,
-    0x05, 0x01, 0x01, 0xb8, 0xff, 0xb5, 0xb0, 0x56, 0x00, 0x2b, 0x34, 0x34, 0xff, 0xff, 0x00, 0x56,
-    0xfe, 0x77, 0x03, 0xf9, 0x04, 0x4e, 0x06, 0x26, 0x00, 0x45, 0x00, 0x00, 0x01, 0x07, 0x00, 0xa7,
-    0x00, 0xa7, 0x00, 0x09, 0x00, 0x10, 0xb5, 0x03, 0x02, 0x3e, 0x31, 0x01, 0x01, 0xb8, 0xff, 0xc9,
-    0xb0, 0x56, 0x00, 0x2b, 0x34, 0x34, 0xff, 0xff, 0x00, 0x94, 0x00, 0x00, 0x04, 0x4d, 0x07, 0x3e,
-    0x06, 0x26, 0x00, 0x29, 0x00, 0x00, 0x01, 0x07, 0x00, 0x44, 0x00, 0xe5, 0x01, 0x3e, 0x00, 0x0b,
-    0xb6, 0x04, 0x12, 0x07, 0x01, 0x01, 0x6c, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x92,
-    0x00, 0x00, 0x05, 0x0d, 0x07, 0x3e, 0x06, 0x26, 0x00, 0xdc, 0x00, 0x00, 0x01, 0x07, 0x00, 0x44,
-    0x01, 0x44, 0x01, 0x3e, 0x00, 0x0b, 0xb6, 0x01, 0x0c, 0x01, 0x01, 0x01, 0x6c, 0x56, 0x00, 0x2b,
-    0x34, 0x00, 0xff, 0xff, 0x00, 0x51, 0xff, 0xec, 0x04, 0x0a, 0x06, 0x00, 0x06, 0x26, 0x00, 0x49,
-    0x00, 0x00, 0x01, 0x07, 0x00, 0x44, 0x00, 0x9b, 0x00, 0x00, 0x00, 0x0b, 0xb6, 0x01, 0x2e, 0x0b,
-    0x01, 0x01, 0x8c, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x84, 0x00, 0x00, 0x04, 0x0f,
-    0x05, 0xf3, 0x06, 0x26, 0x00, 0xf0, 0x00, 0x00, 0x01, 0x07, 0x00, 0x44, 0x00, 0xbd, 0xff, 0xf3,
-    0x00, 0x0b, 0xb6, 0x01, 0x0c, 0x01, 0x01, 0x01, 0x8b, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff,
-    0x00, 0x46, 0x00, 0x00, 0x05, 0x64, 0x05, 0xb0, 0x06, 0x06, 0x00, 0xb9, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x52, 0xfe, 0x25, 0x05, 0x7f, 0x04, 0x3a, 0x06, 0x06, 0x00, 0xcd, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x10, 0x00, 0x00, 0x04, 0xf5, 0x06, 0xfd, 0x06, 0x26, 0x01, 0x19, 0x00, 0x00, 0x01, 0x07,
-    0x00, 0xac, 0x04, 0x4e, 0x01, 0x0f, 0x00, 0x0d, 0xb7, 0x03, 0x02, 0x15, 0x13, 0x01, 0x01, 0x2d,
-    0x56, 0x00, 0x2b, 0x34, 0x34, 0x00, 0xff, 0xff, 0xff, 0xf3, 0x00, 0x00, 0x04, 0x1a, 0x05, 0xd0,
-    0x06, 0x26, 0x01, 0x1a, 0x00, 0x00, 0x01, 0x07, 0x00, 0xac, 0x03, 0xea, 0xff, 0xe2, 0x00, 0x0d,
-    0xb7, 0x03, 0x02, 0x19, 0x17, 0x01, 0x01, 0x7b, 0x56, 0x00, 0x2b, 0x34, 0x34, 0x00, 0xff, 0xff,
-    0x00, 0x4e, 0xfe, 0x4b, 0x08, 0x68, 0x04, 0x4e, 0x04, 0x26, 0x00, 0x53, 0x00, 0x00, 0x00, 0x07,
-    0x00, 0x5d, 0x04, 0x8a, 0x00, 0x00, 0xff, 0xff, 0x00, 0x65, 0xfe, 0x4b, 0x09, 0x61, 0x05, 0xc4,
-    0x04, 0x26, 0x00, 0x33, 0x00, 0x00, 0x00, 0x07, 0x00, 0x5d, 0x05, 0x83, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x49, 0xfe, 0x37, 0x04, 0x82, 0x05, 0xc4, 0x06, 0x26, 0x00, 0xdb, 0x00, 0x00, 0x01, 0x07,
-    0x02, 0x6b, 0x01, 0x90, 0xff, 0x9d, 0x00, 0x0b, 0xb6, 0x02, 0x42, 0x2a, 0x00, 0x00, 0x64, 0x56,
-    0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x4e, 0xfe, 0x38, 0x03, 0xc7, 0x04, 0x4d, 0x06, 0x26,
-    0x00, 0xef, 0x00, 0x00, 0x01, 0x07, 0x02, 0x6b, 0x01, 0x34, 0xff, 0x9e, 0x00, 0x0b, 0xb6, 0x02,
-    0x3f, 0x29, 0x00, 0x00, 0x65, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x66, 0xfe, 0x3a,
-    0x04, 0xeb, 0x05, 0xc4, 0x06, 0x26, 0x00, 0x27, 0x00, 0x00, 0x01, 0x07, 0x02, 0x6b, 0x01, 0xd1,
-    0xff, 0xa0, 0x00, 0x0b, 0xb6, 0x01, 0x2b, 0x05, 0x00, 0x00, 0x64, 0x56, 0x00, 0x2b, 0x34, 0x00,
-    0xff, 0xff, 0x00, 0x4e, 0xfe, 0x3a, 0x03, 0xf1, 0x04, 0x4e, 0x06, 0x26, 0x00, 0x47, 0x00, 0x00,
-    0x01, 0x07, 0x02, 0x6b, 0x01, 0x48, 0xff, 0xa0, 0x00, 0x0b, 0xb6, 0x01, 0x2b, 0x09, 0x00, 0x00,
-    0x64, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x08, 0x00, 0x00, 0x04, 0xd9, 0x05, 0xb0,
-    0x06, 0x06, 0x00, 0x3d, 0x00, 0x00, 0xff, 0xff, 0x00, 0x1e, 0xfe, 0x5f, 0x03, 0xf5, 0x04, 0x3a,
-    0x06, 0x06, 0x00, 0xbd, 0x00, 0x00, 0xff, 0xff, 0x00, 0xa5, 0x00, 0x00, 0x01, 0xa0, 0x05, 0xb0,
-    0x06, 0x06, 0x00, 0x2d, 0x00, 0x00, 0xff, 0xff, 0x00, 0x15, 0x00, 0x00, 0x07, 0xa2, 0x07, 0x24,
-    0x06, 0x26, 0x00, 0xda, 0x00, 0x00, 0x01, 0x07, 0x00, 0xa1, 0x02, 0x1e, 0x01, 0x3e, 0x00, 0x0b,
-    0xb6, 0x05, 0x1d, 0x0d, 0x01, 0x01, 0x5e, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x20,
-    0x00, 0x00, 0x06, 0x6b, 0x05, 0xda, 0x06, 0x26, 0x00, 0xee, 0x00, 0x00, 0x01, 0x07, 0x00, 0xa1,
-    0x01, 0x8e, 0xff, 0xf3, 0x00, 0x0b, 0xb6, 0x05, 0x1d, 0x0d, 0x01, 0x01, 0x7d, 0x56, 0x00, 0x2b,
-    0x34, 0x00, 0xff, 0xff, 0x00, 0xa5, 0x00, 0x00, 0x01, 0xa0, 0x05, 0xb0, 0x06, 0x06, 0x00, 0x2d,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x11, 0x00, 0x00, 0x05, 0x3f, 0x07, 0x1d, 0x06, 0x26, 0x00, 0x25,
-    0x00, 0x00, 0x01, 0x07, 0x00, 0xa1, 0x00, 0xf0, 0x01, 0x37, 0x00, 0x0b, 0xb6, 0x03, 0x13, 0x07,
-    0x01, 0x01, 0x53, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x56, 0xff, 0xec, 0x03, 0xf9,
-    0x05, 0xe7, 0x06, 0x26, 0x00, 0x45, 0x00, 0x00, 0x01, 0x07, 0x00, 0xa1, 0x00, 0x7b, 0x00, 0x00,
-    0x00, 0x0b, 0xb6, 0x02, 0x40, 0x0f, 0x01, 0x01, 0x7e, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff,
-    0x00, 0x11, 0x00, 0x00, 0x05, 0x3f, 0x07, 0x04, 0x06, 0x26, 0x00, 0x25, 0x00, 0x00, 0x01, 0x07,
-    0x00, 0x6a, 0x00, 0xe4, 0x01, 0x37, 0x00, 0x0d, 0xb7, 0x04, 0x03, 0x23, 0x07, 0x01, 0x01, 0x78,
-    0x56, 0x00, 0x2b, 0x34, 0x34, 0x00, 0xff, 0xff, 0x00, 0x56, 0xff, 0xec, 0x03, 0xf9, 0x05, 0xcd,
-    0x06, 0x26, 0x00, 0x45, 0x00, 0x00, 0x01, 0x07, 0x00, 0x6a, 0x00, 0x6f, 0x00, 0x00, 0x00, 0x0d,
-    0xb7, 0x03, 0x02, 0x50, 0x0f, 0x01, 0x01, 0xa3, 0x56, 0x00, 0x2b, 0x34, 0x34, 0x00, 0xff, 0xff,
-    0xff, 0xfc, 0x00, 0x00, 0x07, 0x4e, 0x05, 0xb0, 0x06, 0x06, 0x00, 0x81, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x48, 0xff, 0xeb, 0x06, 0x86, 0x04, 0x4f, 0x06, 0x06, 0x00, 0x86, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x94, 0x00, 0x00, 0x04, 0x4d, 0x07, 0x24, 0x06, 0x26, 0x00, 0x29, 0x00, 0x00, 0x01, 0x07,
-    0x00, 0xa1, 0x00, 0xba, 0x01, 0x3e, 0x00, 0x0b, 0xb6, 0x04, 0x15, 0x07, 0x01, 0x01, 0x5e, 0x56,
-    0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x51, 0xff, 0xec, 0x04, 0x0a, 0x05, 0xe7, 0x06, 0x26,
-    0x00, 0x49, 0x00, 0x00, 0x01, 0x07, 0x00, 0xa1, 0x00, 0x70, 0x00, 0x00, 0x00, 0x0b, 0xb6, 0x01,
-    0x31, 0x0b, 0x01, 0x01, 0x7e, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x55, 0xff, 0xeb,
-    0x05, 0x23, 0x06, 0xdd, 0x06, 0x26, 0x01, 0x58, 0x00, 0x00, 0x01, 0x07, 0x00, 0x6a, 0x00, 0xc2,
-    0x01, 0x0f, 0x00, 0x0d, 0xb7, 0x02, 0x01, 0x42, 0x00, 0x01, 0x01, 0x41, 0x56, 0x00, 0x2b, 0x34,
-    0x34, 0x00, 0xff, 0xff, 0x00, 0x57, 0xff, 0xec, 0x03, 0xf6, 0x04, 0x50, 0x06, 0x06, 0x00, 0x9d,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x57, 0xff, 0xec, 0x03, 0xf6, 0x05, 0xce, 0x06, 0x26, 0x00, 0x9d,
-    0x00, 0x00, 0x01, 0x07, 0x00, 0x6a, 0x00, 0x62, 0x00, 0x01, 0x00, 0x0d, 0xb7, 0x02, 0x01, 0x40,
-    0x00, 0x01, 0x01, 0xa2, 0x56, 0x00, 0x2b, 0x34, 0x34, 0x00, 0xff, 0xff, 0x00, 0x15, 0x00, 0x00,
-    0x07, 0xa2, 0x07, 0x0b, 0x06, 0x26, 0x00, 0xda, 0x00, 0x00, 0x01, 0x07, 0x00, 0x6a, 0x02, 0x11,
-    0x01, 0x3e, 0x00, 0x0d, 0xb7, 0x06, 0x05, 0x2d, 0x0d, 0x01, 0x01, 0x83, 0x56, 0x00, 0x2b, 0x34,
-    0x34, 0x00, 0xff, 0xff, 0x00, 0x20, 0x00, 0x00, 0x06, 0x6b, 0x05, 0xc0, 0x06, 0x26, 0x00, 0xee,
-    0x00, 0x00, 0x01, 0x07, 0x00, 0x6a, 0x01, 0x81, 0xff, 0xf3, 0x00, 0x0d, 0xb7, 0x06, 0x05, 0x2d,
-    0x0d, 0x01, 0x01, 0xa2, 0x56, 0x00, 0x2b, 0x34, 0x34, 0x00, 0xff, 0xff, 0x00, 0x49, 0xff, 0xec,
-    0x04, 0x82, 0x07, 0x18, 0x06, 0x26, 0x00, 0xdb, 0x00, 0x00, 0x01, 0x07, 0x00, 0x6a, 0x00, 0x9f,
-    0x01, 0x4b, 0x00, 0x0d, 0xb7, 0x03, 0x02, 0x54, 0x15, 0x01, 0x01, 0x84, 0x56, 0x00, 0x2b, 0x34,
-    0x34, 0x00, 0xff, 0xff, 0x00, 0x4e, 0xff, 0xec, 0x03, 0xc7, 0x05, 0xcc, 0x06, 0x26, 0x00, 0xef,
-    0x00, 0x00, 0x01, 0x06, 0x00, 0x6a, 0x48, 0xff, 0x00, 0x0d, 0xb7, 0x03, 0x02, 0x51, 0x14, 0x01,
-    0x01, 0xa3, 0x56, 0x00, 0x2b, 0x34, 0x34, 0x00, 0xff, 0xff, 0x00, 0x92, 0x00, 0x00, 0x05, 0x0d,
-    0x06, 0xea, 0x06, 0x26, 0x00, 0xdc, 0x00, 0x00, 0x01, 0x07, 0x00, 0x70, 0x00, 0xe6, 0x01, 0x40,
-    0x00, 0x0b, 0xb6, 0x01, 0x0c, 0x08, 0x01, 0x01, 0xb1, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff,
-    0x00, 0x84, 0x00, 0x00, 0x04, 0x0f, 0x05, 0x9f, 0x06, 0x26, 0x00, 0xf0, 0x00, 0x00, 0x01, 0x06,
-    0x00, 0x70, 0x5e, 0xf6, 0x00, 0x0b, 0xb6, 0x01, 0x0c, 0x08, 0x01, 0x01, 0xd0, 0x56, 0x00, 0x2b,
-    0x34, 0x00, 0xff, 0xff, 0x00, 0x92, 0x00, 0x00, 0x05, 0x0d, 0x07, 0x0b, 0x06, 0x26, 0x00, 0xdc,
-    0x00, 0x00, 0x01, 0x07, 0x00, 0x6a, 0x01, 0x0c, 0x01, 0x3e, 0x00, 0x0d, 0xb7, 0x02, 0x01, 0x1f,
-    0x01, 0x01, 0x01, 0x83, 0x56, 0x00, 0x2b, 0x34, 0x34, 0x00, 0xff, 0xff, 0x00, 0x84, 0x00, 0x00,
-    0x04, 0x0f, 0x05, 0xc0, 0x06, 0x26, 0x00, 0xf0, 0x00, 0x00, 0x01, 0x07, 0x00, 0x6a, 0x00, 0x85,
-    0xff, 0xf3, 0x00, 0x0d, 0xb7, 0x02, 0x01, 0x1f, 0x01, 0x01, 0x01, 0xa2, 0x56, 0x00, 0x2b, 0x34,
-    0x34, 0x00, 0xff, 0xff, 0x00, 0x65, 0xff, 0xec, 0x05, 0x1d, 0x07, 0x05, 0x06, 0x26, 0x00, 0x33,
-    0x00, 0x00, 0x01, 0x07, 0x00, 0x6a, 0x00, 0xfc, 0x01, 0x38, 0x00, 0x0d, 0xb7, 0x03, 0x02, 0x41,
-    0x11, 0x01, 0x01, 0x66, 0x56, 0x00, 0x2b, 0x34, 0x34, 0x00, 0xff, 0xff, 0x00, 0x4e, 0xff, 0xec,
-    0x04, 0x3c, 0x05, 0xcd, 0x06, 0x26, 0x00, 0x53, 0x00, 0x00, 0x01, 0x07, 0x00, 0x6a, 0x00, 0x79,
-    0x00, 0x00, 0x00, 0x0d, 0xb7, 0x03, 0x02, 0x41, 0x06, 0x01, 0x01, 0xa3, 0x56, 0x00, 0x2b, 0x34,
-    0x34, 0x00, 0xff, 0xff, 0x00, 0x60, 0xff, 0xec, 0x05, 0x19, 0x05, 0xc4, 0x06, 0x06, 0x01, 0x17,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x4d, 0xff, 0xec, 0x04, 0x3b, 0x04, 0x4e, 0x06, 0x06, 0x01, 0x18,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x60, 0xff, 0xec, 0x05, 0x19, 0x07, 0x08, 0x06, 0x26, 0x01, 0x17,
-    0x00, 0x00, 0x01, 0x07, 0x00, 0x6a, 0x01, 0x0c, 0x01, 0x3a, 0x00, 0x0d, 0xb7, 0x04, 0x03, 0x4f,
-    0x00, 0x01, 0x01, 0x6a, 0x56, 0x00, 0x2b, 0x34, 0x34, 0x00, 0xff, 0xff, 0x00, 0x4d, 0xff, 0xec,
-    0x04, 0x3b, 0x05, 0xcf, 0x06, 0x26, 0x01, 0x18, 0x00, 0x00, 0x01, 0x07, 0x00, 0x6a, 0x00, 0x6d,
-    0x00, 0x01, 0x00, 0x0d, 0xb7, 0x04, 0x03, 0x41, 0x00, 0x01, 0x01, 0xa5, 0x56, 0x00, 0x2b, 0x34,
-    0x34, 0x00, 0xff, 0xff, 0x00, 0x63, 0xff, 0xec, 0x04, 0xe8, 0x07, 0x19, 0x06, 0x26, 0x00, 0xe7,
-    0x00, 0x00, 0x01, 0x07, 0x00, 0x6a, 0x00, 0xd9, 0x01, 0x4c, 0x00, 0x0d, 0xb7, 0x03, 0x02, 0x42,
-    0x1e, 0x01, 0x01, 0x85, 0x56, 0x00, 0x2b, 0x34, 0x34, 0x00, 0xff, 0xff, 0x00, 0x50, 0xff, 0xeb,
-    0x03, 0xe8, 0x05, 0xcd, 0x06, 0x26, 0x00, 0xff, 0x00, 0x00, 0x01, 0x06, 0x00, 0x6a, 0x50, 0x00,
-    0x00, 0x0d, 0xb7, 0x03, 0x02, 0x41, 0x09, 0x01, 0x01, 0xa3, 0x56, 0x00, 0x2b, 0x34, 0x34, 0x00,
-    0xff, 0xff, 0x00, 0x32, 0xff, 0xeb, 0x04, 0xe1, 0x06, 0xea, 0x06, 0x26, 0x00, 0xde, 0x00, 0x00,
-    0x01, 0x07, 0x00, 0x70, 0x00, 0xa6, 0x01, 0x40, 0x00, 0x0b, 0xb6, 0x02, 0x1b, 0x18, 0x01, 0x01,
-    0xb1, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x0c, 0xfe, 0x4b, 0x03, 0xde, 0x05, 0xad,
-    0x06, 0x26, 0x00, 0x5d, 0x00, 0x00, 0x01, 0x06, 0x00, 0x70, 0x16, 0x03, 0x00, 0x0b, 0xb6, 0x02,
-    0x1b, 0x18, 0x01, 0x01, 0xe5, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x32, 0xff, 0xeb,
-    0x04, 0xe1, 0x07, 0x0b, 0x06, 0x26, 0x00, 0xde, 0x00, 0x00, 0x01, 0x07, 0x00, 0x6a, 0x00, 0xcd,
-    0x01, 0x3e, 0x00, 0x0d, 0xb7, 0x03, 0x02, 0x2e, 0x01, 0x01, 0x01, 0x83, 0x56, 0x00, 0x2b, 0x34,
-    0x34, 0x00, 0xff, 0xff, 0x00, 0x0c, 0xfe, 0x4b, 0x03, 0xde, 0x05, 0xcd, 0x06, 0x26, 0x00, 0x5d,
-    0x00, 0x00, 0x01, 0x06, 0x00, 0x6a, 0x3d, 0x00, 0x00, 0x0d, 0xb7, 0x03, 0x02, 0x2e, 0x01, 0x01,
-    0x01, 0xb7, 0x56, 0x00, 0x2b, 0x34, 0x34, 0x00, 0xff, 0xff, 0x00, 0x32, 0xff, 0xeb, 0x04, 0xe1,
-    0x07, 0x3d, 0x06, 0x26, 0x00, 0xde, 0x00, 0x00, 0x01, 0x07, 0x00, 0xa6, 0x01, 0x31, 0x01, 0x3e,
-    0x00, 0x0d, 0xb7, 0x03, 0x02, 0x19, 0x01, 0x01, 0x01, 0x62, 0x56, 0x00, 0x2b, 0x34, 0x34, 0x00,
-    0xff, 0xff, 0x00, 0x0c, 0xfe, 0x4b, 0x03, 0xfa, 0x05, 0xff, 0x06, 0x26, 0x00, 0x5d, 0x00, 0x00,
-    0x01, 0x07, 0x00, 0xa6, 0x00, 0xa1, 0x00, 0x00, 0x00, 0x0d, 0xb7, 0x03, 0x02, 0x19, 0x01, 0x01,
-    0x01, 0x96, 0x56, 0x00, 0x2b, 0x34, 0x34, 0x00, 0xff, 0xff, 0x00, 0x91, 0x00, 0x00, 0x04, 0xed,
-    0x07, 0x0b, 0x06, 0x26, 0x00, 0xe1, 0x00, 0x00, 0x01, 0x07, 0x00, 0x6a, 0x01, 0x0e, 0x01, 0x3e,
-    0x00, 0x0d, 0xb7, 0x03, 0x02, 0x2f, 0x16, 0x01, 0x01, 0x83, 0x56, 0x00, 0x2b, 0x34, 0x34, 0x00,
-    0xff, 0xff, 0x00, 0x60, 0x00, 0x00, 0x03, 0xe1, 0x05, 0xc0, 0x06, 0x26, 0x00, 0xf9, 0x00, 0x00,
-    0x01, 0x06, 0x00, 0x6a, 0x62, 0xf3, 0x00, 0x0d, 0xb7, 0x03, 0x02, 0x2d, 0x03, 0x01, 0x01, 0xa2,
-    0x56, 0x00, 0x2b, 0x34, 0x34, 0x00, 0xff, 0xff, 0x00, 0x99, 0x00, 0x00, 0x06, 0x54, 0x07, 0x0b,
-    0x06, 0x26, 0x00, 0xe5, 0x00, 0x00, 0x01, 0x07, 0x00, 0x6a, 0x01, 0xba, 0x01, 0x3e, 0x00, 0x0d,
-    0xb7, 0x03, 0x02, 0x32, 0x1c, 0x01, 0x01, 0x83, 0x56, 0x00, 0x2b, 0x34, 0x34, 0x00, 0xff, 0xff,
-    0x00, 0x8f, 0x00, 0x00, 0x05, 0xcf, 0x05, 0xc0, 0x06, 0x26, 0x00, 0xfd, 0x00, 0x00, 0x01, 0x07,
-    0x00, 0x6a, 0x01, 0x74, 0xff, 0xf3, 0x00, 0x0d, 0xb7, 0x03, 0x02, 0x32, 0x1c, 0x01, 0x01, 0xa2,
-    0x56, 0x00, 0x2b, 0x34, 0x34, 0x00, 0xff, 0xff, 0x00, 0x50, 0xff, 0xec, 0x04, 0x02, 0x06, 0x00,
-    0x06, 0x06, 0x00, 0x48, 0x00, 0x00, 0xff, 0xff, 0x00, 0x11, 0xfe, 0x9b, 0x05, 0x3f, 0x05, 0xb0,
-    0x06, 0x26, 0x00, 0x25, 0x00, 0x00, 0x01, 0x07, 0x00, 0xad, 0x05, 0x0a, 0x00, 0x03, 0x00, 0x0e,
-    0xb4, 0x03, 0x11, 0x05, 0x01, 0x01, 0xb8, 0xff, 0x75, 0xb0, 0x56, 0x00, 0x2b, 0x34, 0xff, 0xff,
-    0x00, 0x56, 0xfe, 0x9f, 0x03, 0xf9, 0x04, 0x4e, 0x06, 0x26, 0x00, 0x45, 0x00, 0x00, 0x01, 0x07,
-    0x00, 0xad, 0x04, 0x3d, 0x00, 0x08, 0x00, 0x0e, 0xb4, 0x02, 0x3e, 0x31, 0x01, 0x01, 0xb8, 0xff,
-    0x89, 0xb0, 0x56, 0x00, 0x2b, 0x34, 0xff, 0xff, 0x00, 0x11, 0x00, 0x00, 0x05, 0x3f, 0x07, 0xba,
-    0x06, 0x26, 0x00, 0x25, 0x00, 0x00, 0x01, 0x07, 0x00, 0xab, 0x05, 0x03, 0x01, 0x3d, 0x00, 0x0b,
-    0xb6, 0x03, 0x0f, 0x07, 0x01, 0x01, 0x71, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x56,
-    0xff, 0xec, 0x03, 0xf9, 0x06, 0x84, 0x06, 0x26, 0x00, 0x45, 0x00, 0x00, 0x01, 0x07, 0x00, 0xab,
-    0x04, 0x8d, 0x00, 0x07, 0x00, 0x0b, 0xb6, 0x02, 0x3c, 0x0f, 0x01, 0x01, 0x9c, 0x56, 0x00, 0x2b,
-    0x34, 0x00, 0xff, 0xff, 0x00, 0x11, 0x00, 0x00, 0x05, 0x3f, 0x07, 0xab, 0x06, 0x26, 0x00, 0x25,
-    0x00, 0x00, 0x01, 0x07, 0x02, 0x51, 0x00, 0xc2, 0x01, 0x21, 0x00, 0x0d, 0xb7, 0x04, 0x03, 0x12,
-    0x07, 0x01, 0x01, 0x61, 0x56, 0x00, 0x2b, 0x34, 0x34, 0x00, 0xff, 0xff, 0x00, 0x56, 0xff, 0xec,
-    0x04, 0xc8, 0x06, 0x75, 0x06, 0x26, 0x00, 0x45, 0x00, 0x00, 0x01, 0x06, 0x02, 0x51, 0x4d, 0xea,
-    0x00, 0x0d, 0xb7, 0x03, 0x02, 0x41, 0x0f, 0x01, 0x01, 0x8c, 0x56, 0x00, 0x2b, 0x34, 0x34, 0x00,
-    0xff, 0xff, 0x00, 0x11, 0x00, 0x00, 0x05, 0x3f, 0x07, 0xa9, 0x06, 0x26, 0x00, 0x25, 0x00, 0x00,
-    0x01, 0x07, 0x02, 0x52, 0x00, 0xc3, 0x01, 0x2a, 0x00, 0x0d, 0xb7, 0x04, 0x03, 0x10, 0x07, 0x01,
-    0x01, 0x5c, 0x56, 0x00, 0x2b, 0x34, 0x34, 0x00, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xec, 0x03, 0xf9,
-    0x06, 0x72, 0x06, 0x26, 0x00, 0x45, 0x00, 0x00, 0x01, 0x06, 0x02, 0x52, 0x4e, 0xf3, 0x00, 0x0d,
-    0xb7, 0x03, 0x02, 0x3d, 0x0f, 0x01, 0x01, 0x87, 0x56, 0x00, 0x2b, 0x34, 0x34, 0x00, 0xff, 0xff,
-    0x00, 0x11, 0x00, 0x00, 0x05, 0x3f, 0x07, 0xdd, 0x06, 0x26, 0x00, 0x25, 0x00, 0x00, 0x01, 0x07,
-    0x02, 0x53, 0x00, 0xc2, 0x01, 0x15, 0x00, 0x0d, 0xb7, 0x04, 0x03, 0x13, 0x03, 0x01, 0x01, 0x50,
-    0x56, 0x00, 0x2b, 0x34, 0x34, 0x00, 0xff, 0xff, 0x00, 0x56, 0xff, 0xec, 0x04, 0x53, 0x06, 0xa6,
-    0x06, 0x26, 0x00, 0x45, 0x00, 0x00, 0x01, 0x06, 0x02, 0x53, 0x4d, 0xde, 0x00, 0x0d, 0xb7, 0x03,
-    0x02, 0x40, 0x0f, 0x01, 0x01, 0x7b, 0x56, 0x00, 0x2b, 0x34, 0x34, 0x00, 0xff, 0xff, 0x00, 0x11,
-    0x00, 0x00, 0x05, 0x3f, 0x07, 0xd4, 0x06, 0x26, 0x00, 0x25, 0x00, 0x00, 0x01, 0x07, 0x02, 0x54,
-    0x00, 0xc4, 0x01, 0x07, 0x00, 0x0d, 0xb7, 0x04, 0x03, 0x10, 0x07, 0x01, 0x01, 0x3a, 0x56, 0x00,
-    0x2b, 0x34, 0x34, 0x00, 0xff, 0xff, 0x00, 0x56, 0xff, 0xec, 0x03, 0xf9, 0x06, 0x9d, 0x06, 0x26,
-    0x00, 0x45, 0x00, 0x00, 0x01, 0x06, 0x02, 0x54, 0x4f, 0xd0, 0x00, 0x0d, 0xb7, 0x03, 0x02, 0x3d,
-    0x0f, 0x01, 0x01, 0x65, 0x56, 0x00, 0x2b, 0x34, 0x34, 0x00, 0xff, 0xff, 0x00, 0x11, 0xfe, 0x9b,
-    0x05, 0x3f, 0x07, 0x37, 0x06, 0x26, 0x00, 0x25, 0x00, 0x00, 0x00, 0x27, 0x00, 0x9e, 0x00, 0xc2,
-    0x01, 0x37, 0x01, 0x07, 0x00, 0xad, 0x05, 0x0a, 0x00, 0x03, 0x00, 0x17, 0xb4, 0x04, 0x1a, 0x05,
-    0x01, 0x01, 0xb8, 0xff, 0x75, 0xb7, 0x56, 0x03, 0x11, 0x07, 0x01, 0x01, 0x6c, 0x56, 0x00, 0x2b,
-    0x34, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x56, 0xfe, 0x9f, 0x03, 0xf9, 0x06, 0x00, 0x06, 0x26,
-    0x00, 0x45, 0x00, 0x00, 0x00, 0x26, 0x00, 0x9e, 0x4d, 0x00, 0x01, 0x07, 0x00, 0xad, 0x04, 0x3d,
-    0x00, 0x08, 0x00, 0x17, 0xb4, 0x03, 0x47, 0x31, 0x01, 0x01, 0xb8, 0xff, 0x89, 0xb7, 0x56, 0x02,
-    0x3e, 0x0f, 0x01, 0x01, 0x97, 0x56, 0x00, 0x2b, 0x34, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x11,
-    0x00, 0x00, 0x05, 0x3f, 0x07, 0xae, 0x06, 0x26, 0x00, 0x25, 0x00, 0x00, 0x01, 0x07, 0x02, 0x56,
-    0x00, 0xea, 0x01, 0x32, 0x00, 0x0d, 0xb7, 0x04, 0x03, 0x13, 0x07, 0x01, 0x01, 0x5c, 0x56, 0x00,
-    0x2b, 0x34, 0x34, 0x00, 0xff, 0xff, 0x00, 0x56, 0xff, 0xec, 0x03, 0xf9, 0x06, 0x78, 0x06, 0x26,
-    0x00, 0x45, 0x00, 0x00, 0x01, 0x07, 0x02, 0x56, 0x00, 0x75, 0xff, 0xfc, 0x00, 0x0d, 0xb7, 0x03,
-    0x02, 0x40, 0x0f, 0x01, 0x01, 0x87, 0x56, 0x00, 0x2b, 0x34, 0x34, 0x00, 0xff, 0xff, 0x00, 0x11,
-    0x00, 0x00, 0x05, 0x3f, 0x07, 0xae, 0x06, 0x26, 0x00, 0x25, 0x00, 0x00, 0x01, 0x07, 0x02, 0x4f,
-    0x00, 0xea, 0x01, 0x32, 0x00, 0x0d, 0xb7, 0x04, 0x03, 0x13, 0x07, 0x01, 0x01, 0x5c, 0x56, 0x00,
-    0x2b, 0x34, 0x34, 0x00, 0xff, 0xff, 0x00, 0x56, 0xff, 0xec, 0x03, 0xf9, 0x06, 0x78, 0x06, 0x26,
-    0x00, 0x45, 0x00, 0x00, 0x01, 0x07, 0x02, 0x4f, 0x00, 0x75, 0xff, 0xfc, 0x00, 0x0d, 0xb7, 0x03,
-    0x02, 0x40, 0x0f, 0x01, 0x01, 0x87, 0x56, 0x00, 0x2b, 0x34, 0x34, 0x00, 0xff, 0xff, 0x00, 0x11,
-    0x00, 0x00, 0x05, 0x3f, 0x08, 0x3d, 0x06, 0x26, 0x00, 0x25, 0x00, 0x00, 0x01, 0x07, 0x02, 0x57,
-    0x00, 0xe8, 0x01, 0x36, 0x00, 0x0d, 0xb7, 0x04, 0x03, 0x13, 0x07, 0x01, 0x01, 0x6e, 0x56, 0x00,
-    0x2b, 0x34, 0x34, 0x00, 0xff, 0xff, 0x00, 0x56, 0xff, 0xec, 0x03, 0xf9, 0x07, 0x06, 0x06, 0x26,
-    0x00, 0x45, 0x00, 0x00, 0x01, 0x07, 0x02, 0x57, 0x00, 0x73, 0xff, 0xff, 0x00, 0x0d, 0xb7, 0x03,
-    0x02, 0x40, 0x0f, 0x01, 0x01, 0x99, 0x56, 0x00, 0x2b, 0x34, 0x34, 0x00, 0xff, 0xff, 0x00, 0x11,
-    0x00, 0x00, 0x05, 0x3f, 0x08, 0x16, 0x06, 0x26, 0x00, 0x25, 0x00, 0x00, 0x01, 0x07, 0x02, 0x6a,
-    0x00, 0xeb, 0x01, 0x3c, 0x00, 0x0d, 0xb7, 0x04, 0x03, 0x13, 0x07, 0x01, 0x01, 0x6f, 0x56, 0x00,
-    0x2b, 0x34, 0x34, 0x00, 0xff, 0xff, 0x00, 0x56, 0xff, 0xec, 0x03, 0xf9, 0x06, 0xdf, 0x06, 0x26,
-    0x00, 0x45, 0x00, 0x00, 0x01, 0x07, 0x02, 0x6a, 0x00, 0x76, 0x00, 0x05, 0x00, 0x0d, 0xb7, 0x03,
-    0x02, 0x40, 0x0f, 0x01, 0x01, 0x9a, 0x56, 0x00, 0x2b, 0x34, 0x34, 0x00, 0xff, 0xff, 0x00, 0x11,
-    0xfe, 0x9b, 0x05, 0x3f, 0x07, 0x1d, 0x06, 0x26, 0x00, 0x25, 0x00, 0x00, 0x00, 0x27, 0x00, 0xa1,
-    0x00, 0xf0, 0x01, 0x37, 0x01, 0x07, 0x00, 0xad, 0x05, 0x0a, 0x00, 0x03, 0x00, 0x17, 0xb4, 0x04,
-    0x20, 0x05, 0x01, 0x01, 0xb8, 0xff, 0x75, 0xb7, 0x56, 0x03, 0x13, 0x07, 0x01, 0x01, 0x53, 0x56,
-    0x00, 0x2b, 0x34, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x56, 0xfe, 0x9f, 0x03, 0xf9, 0x05, 0xe7,
-    0x06, 0x26, 0x00, 0x45, 0x00, 0x00, 0x00, 0x27, 0x00, 0xa1, 0x00, 0x7b, 0x00, 0x00, 0x01, 0x07,
-    0x00, 0xad, 0x04, 0x3d, 0x00, 0x08, 0x00, 0x17, 0xb4, 0x03, 0x4d, 0x31, 0x01, 0x01, 0xb8, 0xff,
-    0x89, 0xb7, 0x56, 0x02, 0x40, 0x0f, 0x01, 0x01, 0x7e, 0x56, 0x00, 0x2b, 0x34, 0x2b, 0x34, 0x00,
-    0xff, 0xff, 0x00, 0x94, 0xfe, 0xa1, 0x04, 0x4d, 0x05, 0xb0, 0x06, 0x26, 0x00, 0x29, 0x00, 0x00,
-    0x01, 0x07, 0x00, 0xad, 0x04, 0xcb, 0x00, 0x0a, 0x00, 0x0e, 0xb4, 0x04, 0x13, 0x02, 0x01, 0x01,
-    0xb8, 0xff, 0x7f, 0xb0, 0x56, 0x00, 0x2b, 0x34, 0xff, 0xff, 0x00, 0x51, 0xfe, 0x97, 0x04, 0x0a,
-    0x04, 0x4e, 0x06, 0x26, 0x00, 0x49, 0x00, 0x00, 0x01, 0x07, 0x00, 0xad, 0x04, 0x8e, 0x00, 0x00,
-    0x00, 0x0e, 0xb4, 0x01, 0x2f, 0x00, 0x01, 0x01, 0xb8, 0xff, 0x89, 0xb0, 0x56, 0x00, 0x2b, 0x34,
-    0xff, 0xff, 0x00, 0x94, 0x00, 0x00, 0x04, 0x4d, 0x07, 0xc1, 0x06, 0x26, 0x00, 0x29, 0x00, 0x00,
-    0x01, 0x07, 0x00, 0xab, 0x04, 0xcd, 0x01, 0x44, 0x00, 0x0b, 0xb6, 0x04, 0x11, 0x07, 0x01, 0x01,
-    0x7c, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x51, 0xff, 0xec, 0x04, 0x0a, 0x06, 0x84,
-    0x06, 0x26, 0x00, 0x49, 0x00, 0x00, 0x01, 0x07, 0x00, 0xab, 0x04, 0x82, 0x00, 0x07, 0x00, 0x0b,
-    0xb6, 0x01, 0x2d, 0x0b, 0x01, 0x01, 0x9c, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x94,
-    0x00, 0x00, 0x04, 0x4d, 0x07, 0x32, 0x06, 0x26, 0x00, 0x29, 0x00, 0x00, 0x01, 0x07, 0x00, 0xa5,
-    0x00, 0x8f, 0x01, 0x3e, 0x00, 0x0b, 0xb6, 0x04, 0x1e, 0x07, 0x01, 0x01, 0x76, 0x56, 0x00, 0x2b,
-    0x34, 0x00, 0xff, 0xff, 0x00, 0x51, 0xff, 0xec, 0x04, 0x0a, 0x05, 0xf4, 0x06, 0x26, 0x00, 0x49,
-    0x00, 0x00, 0x01, 0x06, 0x00, 0xa5, 0x45, 0x01, 0x00, 0x0b, 0xb6, 0x01, 0x3a, 0x0b, 0x01, 0x01,
-    0x96, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x94, 0x00, 0x00, 0x05, 0x07, 0x07, 0xb2,
-    0x06, 0x26, 0x00, 0x29, 0x00, 0x00, 0x01, 0x07, 0x02, 0x51, 0x00, 0x8c, 0x01, 0x28, 0x00, 0x0d,
-    0xb7, 0x05, 0x04, 0x14, 0x07, 0x01, 0x01, 0x6c, 0x56, 0x00, 0x2b, 0x34, 0x34, 0x00, 0xff, 0xff,
-    0x00, 0x51, 0xff, 0xec, 0x04, 0xbd, 0x06, 0x75, 0x06, 0x26, 0x00, 0x49, 0x00, 0x00, 0x01, 0x06,
-    0x02, 0x51, 0x42, 0xeb, 0x00, 0x0d, 0xb7, 0x02, 0x01, 0x30, 0x0b, 0x01, 0x01, 0x8c, 0x56, 0x00,
-    0x2b, 0x34, 0x34, 0x00, 0xff, 0xff, 0xff, 0xdf, 0x00, 0x00, 0x04, 0x4d, 0x07, 0xb0, 0x06, 0x26,
-    0x00, 0x29, 0x00, 0x00, 0x01, 0x07, 0x02, 0x52, 0x00, 0x8d, 0x01, 0x31, 0x00, 0x0d, 0xb7, 0x05,
-    0x04, 0x12, 0x07, 0x01, 0x01, 0x67, 0x56, 0x00, 0x2b, 0x34, 0x34, 0x00, 0xff, 0xff, 0xff, 0x94,
-    0xff, 0xec, 0x04, 0x0a, 0x06, 0x73, 0x06, 0x26, 0x00, 0x49, 0x00, 0x00, 0x01, 0x06, 0x02, 0x52,
-    0x43, 0xf4, 0x00, 0x0d, 0xb7, 0x02, 0x01, 0x2e, 0x0b, 0x01, 0x01, 0x87, 0x56, 0x00, 0x2b, 0x34,
-    0x34, 0x00, 0xff, 0xff, 0x00, 0x94, 0x00, 0x00, 0x04, 0x92, 0x07, 0xe4, 0x06, 0x26, 0x00, 0x29,
-    0x00, 0x00, 0x01, 0x07, 0x02, 0x53, 0x00, 0x8c, 0x01, 0x1c, 0x00, 0x0d, 0xb7, 0x05, 0x04, 0x15,
-    0x07, 0x01, 0x01, 0x5b, 0x56, 0x00, 0x2b, 0x34, 0x34, 0x00, 0xff, 0xff, 0x00, 0x51, 0xff, 0xec,
-    0x04, 0x48, 0x06, 0xa6, 0x06, 0x26, 0x00, 0x49, 0x00, 0x00, 0x01, 0x06, 0x02, 0x53, 0x42, 0xdf,
-    0x00, 0x0d, 0xb7, 0x02, 0x01, 0x31, 0x0b, 0x01, 0x01, 0x7b, 0x56, 0x00, 0x2b, 0x34, 0x34, 0x00,
-    0xff, 0xff, 0x00, 0x94, 0x00, 0x00, 0x04, 0x4d, 0x07, 0xdb, 0x06, 0x26, 0x00, 0x29, 0x00, 0x00,
-    0x01, 0x07, 0x02, 0x54, 0x00, 0x8e, 0x01, 0x0e, 0x00, 0x0d, 0xb7, 0x05, 0x04, 0x12, 0x07, 0x01,
-    0x01, 0x45, 0x56, 0x00, 0x2b, 0x34, 0x34, 0x00, 0xff, 0xff, 0x00, 0x51, 0xff, 0xec, 0x04, 0x0a,
-    0x06, 0x9d, 0x06, 0x26, 0x00, 0x49, 0x00, 0x00, 0x01, 0x06, 0x02, 0x54, 0x43, 0xd1, 0x00, 0x0d,
-    0xb7, 0x02, 0x01, 0x2e, 0x0b, 0x01, 0x01, 0x65, 0x56, 0x00, 0x2b, 0x34, 0x34, 0x00, 0xff, 0xff,
-    0x00, 0x94, 0xfe, 0xa1, 0x04, 0x4d, 0x07, 0x3e, 0x06, 0x26, 0x00, 0x29, 0x00, 0x00, 0x00, 0x27,
-    0x00, 0x9e, 0x00, 0x8d, 0x01, 0x3e, 0x01, 0x07, 0x00, 0xad, 0x04, 0xcb, 0x00, 0x0a, 0x00, 0x17,
-    0xb4, 0x05, 0x1c, 0x02, 0x01, 0x01, 0xb8, 0xff, 0x7f, 0xb7, 0x56, 0x04, 0x13, 0x07, 0x01, 0x01,
-    0x77, 0x56, 0x00, 0x2b, 0x34, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x51, 0xfe, 0x97, 0x04, 0x0a,
-    0x06, 0x00, 0x06, 0x26, 0x00, 0x49, 0x00, 0x00, 0x00, 0x26, 0x00, 0x9e, 0x42, 0x00, 0x01, 0x07,
-    0x00, 0xad, 0x04, 0x8e, 0x00, 0x00, 0x00, 0x17, 0xb4, 0x02, 0x38, 0x00, 0x01, 0x01, 0xb8, 0xff,
-    0x89, 0xb7, 0x56, 0x01, 0x2f, 0x0b, 0x01, 0x01, 0x97, 0x56, 0x00, 0x2b, 0x34, 0x2b, 0x34, 0x00,
-    0xff, 0xff, 0x00, 0xa5, 0x00, 0x00, 0x02, 0x15, 0x07, 0xc1, 0x06, 0x26, 0x00, 0x2d, 0x00, 0x00,
-    0x01, 0x07, 0x00, 0xab, 0x03, 0x7a, 0x01, 0x44, 0x00, 0x0b, 0xb6, 0x01, 0x05, 0x03, 0x01, 0x01,
-    0x7c, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x90, 0x00, 0x00, 0x01, 0xfe, 0x06, 0x7b,
-    0x06, 0x26, 0x00, 0x8d, 0x00, 0x00, 0x01, 0x07, 0x00, 0xab, 0x03, 0x64, 0xff, 0xfe, 0x00, 0x0b,
-    0xb6, 0x01, 0x05, 0x03, 0x01, 0x01, 0xae, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x95,
-    0xfe, 0x9d, 0x01, 0xa9, 0x05, 0xb0, 0x06, 0x26, 0x00, 0x2d, 0x00, 0x00, 0x01, 0x07, 0x00, 0xad,
-    0x03, 0x78, 0x00, 0x06, 0x00, 0x0e, 0xb4, 0x01, 0x07, 0x02, 0x01, 0x01, 0xb8, 0xff, 0x7e, 0xb0,
-    0x56, 0x00, 0x2b, 0x34, 0xff, 0xff, 0x00, 0x78, 0xfe, 0xa1, 0x01, 0x90, 0x05, 0xd6, 0x06, 0x26,
-    0x00, 0x4d, 0x00, 0x00, 0x01, 0x07, 0x00, 0xad, 0x03, 0x5a, 0x00, 0x0a, 0x00, 0x0e, 0xb4, 0x02,
-    0x13, 0x02, 0x01, 0x01, 0xb8, 0xff, 0x7f, 0xb0, 0x56, 0x00, 0x2b, 0x34, 0xff, 0xff, 0x00, 0x65,
-    0xfe, 0x97, 0x05, 0x1d, 0x05, 0xc4, 0x06, 0x26, 0x00, 0x33, 0x00, 0x00, 0x01, 0x07, 0x00, 0xad,
-    0x05, 0x1b, 0x00, 0x00, 0x00, 0x0e, 0xb4, 0x02, 0x2f, 0x06, 0x01, 0x01, 0xb8, 0xff, 0x89, 0xb0,
-    0x56, 0x00, 0x2b, 0x34, 0xff, 0xff, 0x00, 0x4e, 0xfe, 0x93, 0x04, 0x3c, 0x04, 0x4e, 0x06, 0x26,
-    0x00, 0x53, 0x00, 0x00, 0x01, 0x07, 0x00, 0xad, 0x04, 0x9a, 0xff, 0xfc, 0x00, 0x0e, 0xb4, 0x02,
-    0x2f, 0x11, 0x01, 0x01, 0xb8, 0xff, 0x88, 0xb0, 0x56, 0x00, 0x2b, 0x34, 0xff, 0xff, 0x00, 0x65,
-    0xff, 0xec, 0x05, 0x1d, 0x07, 0xbc, 0x06, 0x26, 0x00, 0x33, 0x00, 0x00, 0x01, 0x07, 0x00, 0xab,
-    0x05, 0x1b, 0x01, 0x3f, 0x00, 0x0b, 0xb6, 0x02, 0x2d, 0x11, 0x01, 0x01, 0x5f, 0x56, 0x00, 0x2b,
-    0x34, 0x00, 0xff, 0xff, 0x00, 0x4e, 0xff, 0xec, 0x04, 0x3c, 0x06, 0x84, 0x06, 0x26, 0x00, 0x53,
-    0x00, 0x00, 0x01, 0x07, 0x00, 0xab, 0x04, 0x98, 0x00, 0x07, 0x00, 0x0b, 0xb6, 0x02, 0x2d, 0x06,
-    0x01, 0x01, 0x9c, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x65, 0xff, 0xec, 0x05, 0x55,
-    0x07, 0xad, 0x06, 0x26, 0x00, 0x33, 0x00, 0x00, 0x01, 0x07, 0x02, 0x51, 0x00, 0xda, 0x01, 0x22,
-    0x00, 0x0d, 0xb7, 0x03, 0x02, 0x30, 0x11, 0x01, 0x01, 0x4f, 0x56, 0x00, 0x2b, 0x34, 0x34, 0x00,
-    0xff, 0xff, 0x00, 0x4e, 0xff, 0xec, 0x04, 0xd2, 0x06, 0x75, 0x06, 0x26, 0x00, 0x53, 0x00, 0x00,
-    0x01, 0x06, 0x02, 0x51, 0x57, 0xea, 0x00, 0x0d, 0xb7, 0x03, 0x02, 0x30, 0x06, 0x01, 0x01, 0x8c,
-    0x56, 0x00, 0x2b, 0x34, 0x34, 0x00, 0xff, 0xff, 0x00, 0x2c, 0xff, 0xec, 0x05, 0x1d, 0x07, 0xaa,
-    0x06, 0x26, 0x00, 0x33, 0x00, 0x00, 0x01, 0x07, 0x02, 0x52, 0x00, 0xdb, 0x01, 0x2b, 0x00, 0x0d,
-    0xb7, 0x03, 0x02, 0x2e, 0x11, 0x01, 0x01, 0x4a, 0x56, 0x00, 0x2b, 0x34, 0x34, 0x00, 0xff, 0xff,
-    0xff, 0xaa, 0xff, 0xec, 0x04, 0x3c, 0x06, 0x72, 0x06, 0x26, 0x00, 0x53, 0x00, 0x00, 0x01, 0x06,
-    0x02, 0x52, 0x59, 0xf3, 0x00, 0x0d, 0xb7, 0x03, 0x02, 0x2e, 0x06, 0x01, 0x01, 0x87, 0x56, 0x00,
-    0x2b, 0x34, 0x34, 0x00, 0xff, 0xff, 0x00, 0x65, 0xff, 0xec, 0x05, 0x1d, 0x07, 0xde, 0x06, 0x26,
-    0x00, 0x33, 0x00, 0x00, 0x01, 0x07, 0x02, 0x53, 0x00, 0xda, 0x01, 0x16, 0x00, 0x0d, 0xb7, 0x03,
-    0x02, 0x31, 0x11, 0x01, 0x01, 0x3e, 0x56, 0x00, 0x2b, 0x34, 0x34, 0x00, 0xff, 0xff, 0x00, 0x4e,
-    0xff, 0xec, 0x04, 0x5d, 0x06, 0xa6, 0x06, 0x26, 0x00, 0x53, 0x00, 0x00, 0x01, 0x06, 0x02, 0x53,
-    0x58, 0xde, 0x00, 0x0d, 0xb7, 0x03, 0x02, 0x31, 0x06, 0x01, 0x01, 0x7b, 0x56, 0x00, 0x2b, 0x34,
-    0x34, 0x00, 0xff, 0xff, 0x00, 0x65, 0xff, 0xec, 0x05, 0x1d, 0x07, 0xd5, 0x06, 0x26, 0x00, 0x33,
-    0x00, 0x00, 0x01, 0x07, 0x02, 0x54, 0x00, 0xdc, 0x01, 0x08, 0x00, 0x0d, 0xb7, 0x03, 0x02, 0x2e,
-    0x11, 0x01, 0x01, 0x28, 0x56, 0x00, 0x2b, 0x34, 0x34, 0x00, 0xff, 0xff, 0x00, 0x4e, 0xff, 0xec,
-    0x04, 0x3c, 0x06, 0x9d, 0x06, 0x26, 0x00, 0x53, 0x00, 0x00, 0x01, 0x06, 0x02, 0x54, 0x59, 0xd0,
-    0x00, 0x0d, 0xb7, 0x03, 0x02, 0x2e, 0x06, 0x01, 0x01, 0x65, 0x56, 0x00, 0x2b, 0x34, 0x34, 0x00,
-    0xff, 0xff, 0x00, 0x65, 0xfe, 0x97, 0x05, 0x1d, 0x07, 0x38, 0x06, 0x26, 0x00, 0x33, 0x00, 0x00,
-    0x00, 0x27, 0x00, 0x9e, 0x00, 0xda, 0x01, 0x38, 0x01, 0x07, 0x00, 0xad, 0x05, 0x1b, 0x00, 0x00,
-    0x00, 0x17, 0xb4, 0x03, 0x38, 0x06, 0x01, 0x01, 0xb8, 0xff, 0x89, 0xb7, 0x56, 0x02, 0x2f, 0x11,
-    0x01, 0x01, 0x5a, 0x56, 0x00, 0x2b, 0x34, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x4e, 0xfe, 0x93,
-    0x04, 0x3c, 0x06, 0x00, 0x06, 0x26, 0x00, 0x53, 0x00, 0x00, 0x00, 0x26, 0x00, 0x9e, 0x58, 0x00,
-    0x01, 0x07, 0x00, 0xad, 0x04, 0x9a, 0xff, 0xfc, 0x00, 0x17, 0xb4, 0x03, 0x38, 0x11, 0x01, 0x01,
-    0xb8, 0xff, 0x88, 0xb7, 0x56, 0x02, 0x2f, 0x06, 0x01, 0x01, 0x97, 0x56, 0x00, 0x2b, 0x34, 0x2b,
-    0x34, 0x00, 0xff, 0xff, 0x00, 0x5b, 0xff, 0xec, 0x05, 0xaf, 0x07, 0x35, 0x06, 0x26, 0x00, 0x98,
-    0x00, 0x00, 0x01, 0x07, 0x00, 0x75, 0x01, 0xd9, 0x01, 0x35, 0x00, 0x0b, 0xb6, 0x03, 0x3a, 0x1c,
-    0x01, 0x01, 0x47, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x4d, 0xff, 0xec, 0x04, 0xb7,
-    0x06, 0x00, 0x06, 0x26, 0x00, 0x99, 0x00, 0x00, 0x01, 0x07, 0x00, 0x75, 0x01, 0x5b, 0x00, 0x00,
-    0x00, 0x0b, 0xb6, 0x03, 0x36, 0x10, 0x01, 0x01, 0x8c, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff,
-    0x00, 0x5b, 0xff, 0xec, 0x05, 0xaf, 0x07, 0x35, 0x06, 0x26, 0x00, 0x98, 0x00, 0x00, 0x01, 0x07,
-    0x00, 0x44, 0x01, 0x32, 0x01, 0x35, 0x00, 0x0b, 0xb6, 0x03, 0x3c, 0x1c, 0x01, 0x01, 0x47, 0x56,
-    0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x4d, 0xff, 0xec, 0x04, 0xb7, 0x06, 0x00, 0x06, 0x26,
-    0x00, 0x99, 0x00, 0x00, 0x01, 0x07, 0x00, 0x44, 0x00, 0xb5, 0x00, 0x00, 0x00, 0x0b, 0xb6, 0x03,
-    0x38, 0x10, 0x01, 0x01, 0x8c, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x5b, 0xff, 0xec,
-    0x05, 0xaf, 0x07, 0xb9, 0x06, 0x26, 0x00, 0x98, 0x00, 0x00, 0x01, 0x07, 0x00, 0xab, 0x05, 0x1a,
-    0x01, 0x3c, 0x00, 0x0b, 0xb6, 0x03, 0x3b, 0x1c, 0x01, 0x01, 0x57, 0x56, 0x00, 0x2b, 0x34, 0x00,
-    0xff, 0xff, 0x00, 0x4d, 0xff, 0xec, 0x04, 0xb7, 0x06, 0x84, 0x06, 0x26, 0x00, 0x99, 0x00, 0x00,
-    0x01, 0x07, 0x00, 0xab, 0x04, 0x9c, 0x00, 0x07, 0x00, 0x0b, 0xb6, 0x03, 0x37, 0x10, 0x01, 0x01,
-    0x9c, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x5b, 0xff, 0xec, 0x05, 0xaf, 0x07, 0x29,
-    0x06, 0x26, 0x00, 0x98, 0x00, 0x00, 0x01, 0x07, 0x00, 0xa5, 0x00, 0xdc, 0x01, 0x36, 0x00, 0x0b,
-    0xb6, 0x03, 0x48, 0x1c, 0x01, 0x01, 0x51, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x4d,
-    0xff, 0xec, 0x04, 0xb7, 0x05, 0xf4, 0x06, 0x26, 0x00, 0x99, 0x00, 0x00, 0x01, 0x06, 0x00, 0xa5,
-    0x5f, 0x01, 0x00, 0x0b, 0xb6, 0x03, 0x44, 0x10, 0x01, 0x01, 0x96, 0x56, 0x00, 0x2b, 0x34, 0x00,
-    0xff, 0xff, 0x00, 0x5b, 0xfe, 0x97, 0x05, 0xaf, 0x06, 0x2b, 0x06, 0x26, 0x00, 0x98, 0x00, 0x00,
-    0x01, 0x07, 0x00, 0xad, 0x05, 0x05, 0x00, 0x00, 0x00, 0x0e, 0xb4, 0x03, 0x3d, 0x10, 0x01, 0x01,
-    0xb8, 0xff, 0x89, 0xb0, 0x56, 0x00, 0x2b, 0x34, 0xff, 0xff, 0x00, 0x4d, 0xfe, 0x8d, 0x04, 0xb7,
-    0x04, 0xa8, 0x06, 0x26, 0x00, 0x99, 0x00, 0x00, 0x01, 0x07, 0x00, 0xad, 0x04, 0x99, 0xff, 0xf6,
-    0x00, 0x0e, 0xb4, 0x03, 0x39, 0x1b, 0x01, 0x01, 0xb8, 0xff, 0x7f, 0xb0, 0x56, 0x00, 0x2b, 0x34,
-    0xff, 0xff, 0x00, 0x80, 0xfe, 0x97, 0x04, 0xbf, 0x05, 0xb0, 0x06, 0x26, 0x00, 0x39, 0x00, 0x00,
-    0x01, 0x07, 0x00, 0xad, 0x04, 0xf3, 0x00, 0x00, 0x00, 0x0e, 0xb4, 0x01, 0x19, 0x06, 0x01, 0x01,
-    0xb8, 0xff, 0x89, 0xb0, 0x56, 0x00, 0x2b, 0x34, 0xff, 0xff, 0x00, 0x77, 0xfe, 0x97, 0x03, 0xf9,
-    0x04, 0x3a, 0x06, 0x26, 0x00, 0x59, 0x00, 0x00, 0x01, 0x07, 0x00, 0xad, 0x04, 0x3e, 0x00, 0x00,
-    0x00, 0x0e, 0xb4, 0x02, 0x1f, 0x0b, 0x01, 0x01, 0xb8, 0xff, 0x89, 0xb0, 0x56, 0x00, 0x2b, 0x34,
-    0xff, 0xff, 0x00, 0x80, 0xff, 0xec, 0x04, 0xbf, 0x07, 0xba, 0x06, 0x26, 0x00, 0x39, 0x00, 0x00,
-    0x01, 0x07, 0x00, 0xab, 0x04, 0xf6, 0x01, 0x3d, 0x00, 0x0b, 0xb6, 0x01, 0x17, 0x00, 0x01, 0x01,
-    0x71, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x77, 0xff, 0xec, 0x03, 0xf9, 0x06, 0x84,
-    0x06, 0x26, 0x00, 0x59, 0x00, 0x00, 0x01, 0x07, 0x00, 0xab, 0x04, 0x93, 0x00, 0x07, 0x00, 0x0b,
-    0xb6, 0x02, 0x1d, 0x11, 0x01, 0x01, 0xb0, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x80,
-    0xff, 0xec, 0x06, 0x3a, 0x07, 0x42, 0x06, 0x26, 0x00, 0x9a, 0x00, 0x00, 0x01, 0x07, 0x00, 0x75,
-    0x01, 0xda, 0x01, 0x42, 0x00, 0x0b, 0xb6, 0x02, 0x20, 0x0a, 0x01, 0x01, 0x6c, 0x56, 0x00, 0x2b,
-    0x34, 0x00, 0xff, 0xff, 0x00, 0x77, 0xff, 0xec, 0x05, 0x24, 0x05, 0xeb, 0x06, 0x26, 0x00, 0x9b,
-    0x00, 0x00, 0x01, 0x07, 0x00, 0x75, 0x01, 0x5a, 0xff, 0xeb, 0x00, 0x0b, 0xb6, 0x03, 0x26, 0x1b,
-    0x01, 0x01, 0x8b, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x80, 0xff, 0xec, 0x06, 0x3a,
-    0x07, 0x42, 0x06, 0x26, 0x00, 0x9a, 0x00, 0x00, 0x01, 0x07, 0x00, 0x44, 0x01, 0x33, 0x01, 0x42,
-    0x00, 0x0b, 0xb6, 0x02, 0x22, 0x0a, 0x01, 0x01, 0x6c, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff,
-    0x00, 0x77, 0xff, 0xec, 0x05, 0x24, 0x05, 0xeb, 0x06, 0x26, 0x00, 0x9b, 0x00, 0x00, 0x01, 0x07,
-    0x00, 0x44, 0x00, 0xb3, 0xff, 0xeb, 0x00, 0x0b, 0xb6, 0x03, 0x28, 0x1b, 0x01, 0x01, 0x8b, 0x56,
-    0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x80, 0xff, 0xec, 0x06, 0x3a, 0x07, 0xc6, 0x06, 0x26,
-    0x00, 0x9a, 0x00, 0x00, 0x01, 0x07, 0x00, 0xab, 0x05, 0x1a, 0x01, 0x49, 0x00, 0x0b, 0xb6, 0x02,
-    0x21, 0x0a, 0x01, 0x01, 0x7c, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x77, 0xff, 0xec,
-    0x05, 0x24, 0x06, 0x6f, 0x06, 0x26, 0x00, 0x9b, 0x00, 0x00, 0x01, 0x07, 0x00, 0xab, 0x04, 0x9a,
-    0xff, 0xf2, 0x00, 0x0b, 0xb6, 0x03, 0x27, 0x1b, 0x01, 0x01, 0x9b, 0x56, 0x00, 0x2b, 0x34, 0x00,
-    0xff, 0xff, 0x00, 0x80, 0xff, 0xec, 0x06, 0x3a, 0x07, 0x36, 0x06, 0x26, 0x00, 0x9a, 0x00, 0x00,
-    0x01, 0x07, 0x00, 0xa5, 0x00, 0xdd, 0x01, 0x43, 0x00, 0x0b, 0xb6, 0x02, 0x2e, 0x15, 0x01, 0x01,
-    0x76, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x77, 0xff, 0xec, 0x05, 0x24, 0x05, 0xdf,
-    0x06, 0x26, 0x00, 0x9b, 0x00, 0x00, 0x01, 0x06, 0x00, 0xa5, 0x5d, 0xec, 0x00, 0x0b, 0xb6, 0x03,
-    0x34, 0x1b, 0x01, 0x01, 0x95, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x80, 0xfe, 0x8e,
-    0x06, 0x3a, 0x06, 0x02, 0x06, 0x26, 0x00, 0x9a, 0x00, 0x00, 0x01, 0x07, 0x00, 0xad, 0x05, 0x16,
-    0xff, 0xf7, 0x00, 0x0e, 0xb4, 0x02, 0x23, 0x10, 0x01, 0x01, 0xb8, 0xff, 0x80, 0xb0, 0x56, 0x00,
-    0x2b, 0x34, 0xff, 0xff, 0x00, 0x77, 0xfe, 0x97, 0x05, 0x24, 0x04, 0x95, 0x06, 0x26, 0x00, 0x9b,
-    0x00, 0x00, 0x01, 0x07, 0x00, 0xad, 0x04, 0x8e, 0x00, 0x00, 0x00, 0x0e, 0xb4, 0x03, 0x29, 0x15,
-    0x01, 0x01, 0xb8, 0xff, 0x89, 0xb0, 0x56, 0x00, 0x2b, 0x34, 0xff, 0xff, 0x00, 0x08, 0xfe, 0xa9,
-    0x04, 0xd9, 0x05, 0xb0, 0x06, 0x26, 0x00, 0x3d, 0x00, 0x00, 0x01, 0x07, 0x00, 0xad, 0x04, 0xc6,
-    0x00, 0x12, 0x00, 0x0e, 0xb4, 0x01, 0x0c, 0x06, 0x01, 0x01, 0xb8, 0xff, 0x76, 0xb0, 0x56, 0x00,
-    0x2b, 0x34, 0xff, 0xff, 0x00, 0x0c, 0xfe, 0x12, 0x03, 0xde, 0x04, 0x3a, 0x06, 0x26, 0x00, 0x5d,
-    0x00, 0x00, 0x01, 0x07, 0x00, 0xad, 0x05, 0x4d, 0xff, 0x7a, 0x00, 0x0e, 0xb4, 0x02, 0x22, 0x08,
-    0x00, 0x00, 0xb8, 0xff, 0xb9, 0xb0, 0x56, 0x00, 0x2b, 0x34, 0xff, 0xff, 0x00, 0x08, 0x00, 0x00,
-    0x04, 0xd9, 0x07, 0xba, 0x06, 0x26, 0x00, 0x3d, 0x00, 0x00, 0x01, 0x07, 0x00, 0xab, 0x04, 0xcc,
-    0x01, 0x3d, 0x00, 0x0b, 0xb6, 0x01, 0x0a, 0x02, 0x01, 0x01, 0x70, 0x56, 0x00, 0x2b, 0x34, 0x00,
-    0xff, 0xff, 0x00, 0x0c, 0xfe, 0x4b, 0x03, 0xde, 0x06, 0x84, 0x06, 0x26, 0x00, 0x5d, 0x00, 0x00,
-    0x01, 0x07, 0x00, 0xab, 0x04, 0x5c, 0x00, 0x07, 0x00, 0x0b, 0xb6, 0x02, 0x1a, 0x01, 0x01, 0x01,
-    0xb0, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x08, 0x00, 0x00, 0x04, 0xd9, 0x07, 0x2a,
-    0x06, 0x26, 0x00, 0x3d, 0x00, 0x00, 0x01, 0x07, 0x00, 0xa5, 0x00, 0x8f, 0x01, 0x37, 0x00, 0x0b,
-    0xb6, 0x01, 0x17, 0x08, 0x01, 0x01, 0x6a, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x0c,
-    0xfe, 0x4b, 0x03, 0xde, 0x05, 0xf4, 0x06, 0x26, 0x00, 0x5d, 0x00, 0x00, 0x01, 0x06, 0x00, 0xa5,
-    0x1f, 0x01, 0x00, 0x0b, 0xb6, 0x02, 0x27, 0x18, 0x01, 0x01, 0xaa, 0x56, 0x00, 0x2b, 0x34, 0x00,
-    0xff, 0xff, 0x00, 0x50, 0xfe, 0xb0, 0x04, 0xad, 0x06, 0x00, 0x04, 0x26, 0x00, 0x48, 0x00, 0x00,
-    0x00, 0x27, 0x02, 0x40, 0x01, 0x80, 0x02, 0x3f, 0x01, 0x07, 0x00, 0x43, 0x00, 0x99, 0xff, 0x6c,
-    0x00, 0x17, 0xb4, 0x04, 0x37, 0x16, 0x01, 0x01, 0xb8, 0xff, 0x77, 0xb7, 0x56, 0x03, 0x32, 0x0b,
-    0x01, 0x01, 0x83, 0x56, 0x00, 0x2b, 0x34, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x2d, 0xfe, 0x9a,
-    0x04, 0xb4, 0x05, 0xb0, 0x06, 0x26, 0x00, 0x38, 0x00, 0x00, 0x01, 0x07, 0x02, 0x6b, 0x02, 0x46,
-    0x00, 0x00, 0x00, 0x0b, 0xb6, 0x02, 0x0b, 0x02, 0x00, 0x00, 0x9a, 0x56, 0x00, 0x2b, 0x34, 0x00,
-    0xff, 0xff, 0x00, 0x23, 0xfe, 0x9a, 0x03, 0xd5, 0x04, 0x3a, 0x06, 0x26, 0x00, 0xf6, 0x00, 0x00,
-    0x01, 0x07, 0x02, 0x6b, 0x01, 0xdf, 0x00, 0x00, 0x00, 0x0b, 0xb6, 0x02, 0x0b, 0x02, 0x00, 0x00,
-    0x9a, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x91, 0xfe, 0x9a, 0x04, 0xed, 0x05, 0xb0,
-    0x06, 0x26, 0x00, 0xe1, 0x00, 0x00, 0x01, 0x07, 0x02, 0x6b, 0x02, 0xce, 0x00, 0x00, 0x00, 0x0b,
-    0xb6, 0x02, 0x1d, 0x19, 0x01, 0x00, 0x9a, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x60,
-    0xfe, 0x9a, 0x03, 0xe1, 0x04, 0x3b, 0x06, 0x26, 0x00, 0xf9, 0x00, 0x00, 0x01, 0x07, 0x02, 0x6b,
-    0x01, 0xc7, 0x00, 0x00, 0x00, 0x0b, 0xb6, 0x02, 0x1b, 0x02, 0x01, 0x00, 0x9a, 0x56, 0x00, 0x2b,
-    0x34, 0x00, 0xff, 0xff, 0x00, 0x99, 0xfe, 0x9a, 0x04, 0x37, 0x05, 0xb0, 0x06, 0x26, 0x00, 0xb1,
-    0x00, 0x00, 0x01, 0x07, 0x02, 0x6b, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x0b, 0xb6, 0x01, 0x09, 0x04,
-    0x00, 0x00, 0x9a, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x83, 0xfe, 0x9a, 0x03, 0x4c,
-    0x04, 0x3a, 0x06, 0x26, 0x00, 0xec, 0x00, 0x00, 0x01, 0x07, 0x02, 0x6b, 0x00, 0xe1, 0x00, 0x00,
-    0x00, 0x0b, 0xb6, 0x01, 0x09, 0x04, 0x00, 0x00, 0x9a, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff,
-    0x00, 0x0a, 0xfe, 0x3d, 0x05, 0xb4, 0x05, 0xc4, 0x06, 0x26, 0x01, 0x4c, 0x00, 0x00, 0x01, 0x07,
-    0x02, 0x6b, 0x02, 0xdf, 0xff, 0xa3, 0x00, 0x0b, 0xb6, 0x02, 0x3a, 0x0a, 0x00, 0x00, 0x6b, 0x56,
-    0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0xff, 0xcb, 0xfe, 0x44, 0x04, 0x90, 0x04, 0x4e, 0x06, 0x26,
-    0x01, 0x4d, 0x00, 0x00, 0x01, 0x07, 0x02, 0x6b, 0x01, 0xef, 0xff, 0xaa, 0x00, 0x0b, 0xb6, 0x02,
-    0x39, 0x09, 0x00, 0x00, 0x6b, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x7a, 0x00, 0x00,
-    0x03, 0xfa, 0x06, 0x00, 0x06, 0x06, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x02, 0xff, 0xd7, 0x00, 0x00,
-    0x04, 0xba, 0x05, 0xb0, 0x00, 0x18, 0x00, 0x1c, 0x00, 0x1a, 0x40, 0x0c, 0x1c, 0x1b, 0x18, 0x00,
-    0x00, 0x0b, 0x0c, 0x02, 0x72, 0x0e, 0x0b, 0x08, 0x00, 0x3f, 0x33, 0x2b, 0x12, 0x39, 0x2f, 0x33,
-    0xcc, 0x32, 0x30, 0x31, 0x41, 0x21, 0x32, 0x16, 0x16, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x21, 0x11,
-    0x33, 0x11, 0x21, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x21, 0x01, 0x15, 0x21, 0x35,
-    0x01, 0x3e, 0x01, 0x6e, 0xa6, 0xec, 0x7c, 0x46, 0x88, 0xc3, 0x7d, 0xfd, 0xe4, 0xfc, 0x01, 0x20,
-    0x5f, 0x7a, 0x3b, 0x3b, 0x7a, 0x5f, 0xfe, 0x92, 0x01, 0x38, 0xfd, 0x61, 0x03, 0x81, 0x6f, 0xc8,
-    0x85, 0x64, 0xa6, 0x79, 0x42, 0x05, 0xb0, 0xfb, 0x17, 0x47, 0x74, 0x45, 0x43, 0x6e, 0x42, 0x02,
-    0x35, 0xa7, 0xa7, 0x00, 0x00, 0x02, 0xff, 0xd7, 0x00, 0x00, 0x04, 0xba, 0x05, 0xb0, 0x00, 0x18,
-    0x00, 0x1c, 0x00, 0x19, 0x40, 0x0b, 0x1c, 0x1b, 0x18, 0x00, 0x00, 0x0b, 0x0c, 0x02, 0x0e, 0x0b,
-    0x08, 0x00, 0x3f, 0x33, 0x3f, 0x12, 0x39, 0x2f, 0x33, 0xcc, 0x32, 0x30, 0x31, 0x41, 0x21, 0x32,
-    0x16, 0x16, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x21, 0x11, 0x33, 0x11, 0x21, 0x32, 0x36, 0x36, 0x35,
-    0x34, 0x26, 0x26, 0x23, 0x21, 0x01, 0x15, 0x21, 0x35, 0x01, 0x3e, 0x01, 0x6e, 0xa6, 0xec, 0x7c,
-    0x46, 0x88, 0xc3, 0x7d, 0xfd, 0xe4, 0xfc, 0x01, 0x20, 0x5f, 0x7a, 0x3b, 0x3b, 0x7a, 0x5f, 0xfe,
-    0x92, 0x01, 0x38, 0xfd, 0x61, 0x03, 0x81, 0x6f, 0xc8, 0x85, 0x64, 0xa6, 0x79, 0x42, 0x05, 0xb0,
-    0xfb, 0x17, 0x47, 0x74, 0x45, 0x43, 0x6e, 0x42, 0x02, 0x35, 0xa7, 0xa7, 0x00, 0x02, 0xff, 0xf4,
-    0x00, 0x00, 0x04, 0x37, 0x05, 0xb0, 0x00, 0x05, 0x00, 0x09, 0x00, 0x16, 0x40, 0x0a, 0x06, 0x07,
-    0x07, 0x04, 0x02, 0x05, 0x02, 0x72, 0x04, 0x08, 0x00, 0x3f, 0x2b, 0x32, 0x12, 0x39, 0x2f, 0x33,
-    0x30, 0x31, 0x41, 0x15, 0x21, 0x11, 0x23, 0x11, 0x01, 0x15, 0x21, 0x35, 0x04, 0x37, 0xfd, 0x5c,
-    0xfa, 0x01, 0xfa, 0xfd, 0x61, 0x05, 0xb0, 0xc8, 0xfb, 0x18, 0x05, 0xb0, 0xfd, 0x97, 0xa6, 0xa6,
-    0x00, 0x02, 0xff, 0xdf, 0x00, 0x00, 0x03, 0x4c, 0x04, 0x3a, 0x00, 0x05, 0x00, 0x09, 0x00, 0x16,
-    0x40, 0x0a, 0x09, 0x08, 0x08, 0x04, 0x02, 0x05, 0x06, 0x72, 0x04, 0x0a, 0x00, 0x3f, 0x2b, 0x32,
-    0x12, 0x39, 0x2f, 0x33, 0x30, 0x31, 0x41, 0x15, 0x21, 0x11, 0x23, 0x11, 0x01, 0x15, 0x21, 0x35,
-    0x03, 0x4c, 0xfe, 0x28, 0xf1, 0x01, 0xfb, 0xfd, 0x61, 0x04, 0x3a, 0xc0, 0xfc, 0x86, 0x04, 0x3a,
-    0xfe, 0x3f, 0xa7, 0xa7, 0x00, 0x04, 0xff, 0xf3, 0x00, 0x00, 0x05, 0x40, 0x05, 0xb0, 0x00, 0x03,
-    0x00, 0x09, 0x00, 0x0d, 0x00, 0x11, 0x00, 0x2b, 0x40, 0x15, 0x0c, 0x0b, 0x0b, 0x07, 0x07, 0x06,
-    0x10, 0x11, 0x06, 0x11, 0x06, 0x11, 0x02, 0x09, 0x03, 0x02, 0x72, 0x0a, 0x02, 0x08, 0x72, 0x00,
-    0x2b, 0x32, 0x2b, 0x32, 0x11, 0x39, 0x39, 0x2f, 0x2f, 0x11, 0x33, 0x11, 0x33, 0x12, 0x39, 0x11,
-    0x33, 0x30, 0x31, 0x41, 0x11, 0x23, 0x11, 0x21, 0x01, 0x21, 0x27, 0x33, 0x01, 0x13, 0x01, 0x37,
-    0x01, 0x01, 0x15, 0x21, 0x35, 0x01, 0xa7, 0xfa, 0x04, 0x66, 0xfd, 0xb0, 0xfe, 0x9d, 0x22, 0xfa,
-    0x01, 0xa8, 0x33, 0xfe, 0x29, 0xa2, 0x02, 0x62, 0xfd, 0x52, 0xfd, 0x61, 0x05, 0xb0, 0xfa, 0x50,
-    0x05, 0xb0, 0xfc, 0xc2, 0xda, 0x02, 0x64, 0xfa, 0x50, 0x02, 0x98, 0xc1, 0xfc, 0xa7, 0x04, 0xe7,
-    0xa7, 0xa7, 0x00, 0x04, 0xff, 0xc9, 0x00, 0x00, 0x04, 0x47, 0x06, 0x00, 0x00, 0x03, 0x00, 0x09,
-    0x00, 0x0d, 0x00, 0x11, 0x00, 0x2d, 0x40, 0x17, 0x04, 0x06, 0x72, 0x0c, 0x0b, 0x0b, 0x07, 0x07,
-    0x06, 0x10, 0x11, 0x06, 0x11, 0x06, 0x11, 0x02, 0x03, 0x00, 0x72, 0x0a, 0x02, 0x0a, 0x72, 0x00,
-    0x2b, 0x32, 0x2b, 0x11, 0x39, 0x39, 0x2f, 0x2f, 0x11, 0x33, 0x11, 0x33, 0x12, 0x39, 0x11, 0x33,
-    0x2b, 0x30, 0x31, 0x41, 0x11, 0x23, 0x11, 0x01, 0x01, 0x21, 0x27, 0x33, 0x01, 0x13, 0x01, 0x37,
-    0x01, 0x01, 0x15, 0x21, 0x35, 0x01, 0x85, 0xf0, 0x03, 0x87, 0xfe, 0x46, 0xfe, 0xdc, 0x45, 0xf1,
-    0x01, 0x18, 0x2d, 0xfe, 0xae, 0x9d, 0x01, 0xcd, 0xfe, 0x21, 0xfd, 0x61, 0x06, 0x00, 0xfa, 0x00,
-    0x06, 0x00, 0xfe, 0x3a, 0xfd, 0xa1, 0xbf, 0x01, 0xa0, 0xfb, 0xc6, 0x01, 0xfa, 0xaa, 0xfd, 0x5c,
-    0x05, 0x63, 0xa6, 0xa6, 0x00, 0x02, 0x00, 0x08, 0x00, 0x00, 0x04, 0xd9, 0x05, 0xb0, 0x00, 0x08,
-    0x00, 0x0c, 0x00, 0x1d, 0x40, 0x0f, 0x0c, 0x01, 0x04, 0x07, 0x03, 0x0b, 0x0b, 0x06, 0x03, 0x08,
-    0x02, 0x72, 0x06, 0x08, 0x72, 0x00, 0x2b, 0x2b, 0x32, 0x11, 0x39, 0x2f, 0x17, 0x39, 0x33, 0x30,
-    0x31, 0x49, 0x02, 0x21, 0x01, 0x11, 0x23, 0x11, 0x01, 0x01, 0x15, 0x21, 0x35, 0x01, 0x1f, 0x01,
-    0x52, 0x01, 0x52, 0x01, 0x16, 0xfe, 0x16, 0xfd, 0xfe, 0x16, 0x03, 0xbf, 0xfd, 0x60, 0x05, 0xb0,
-    0xfd, 0x49, 0x02, 0xb7, 0xfc, 0x68, 0xfd, 0xe8, 0x02, 0x18, 0x03, 0x98, 0xfc, 0xfc, 0xa7, 0xa7,
-    0x00, 0x04, 0x00, 0x1e, 0xfe, 0x5f, 0x03, 0xf5, 0x04, 0x3a, 0x00, 0x03, 0x00, 0x08, 0x00, 0x0d,
-    0x00, 0x11, 0x00, 0x17, 0x40, 0x0b, 0x11, 0x10, 0x10, 0x02, 0x05, 0x0d, 0x06, 0x72, 0x02, 0x0e,
-    0x72, 0x00, 0x2b, 0x2b, 0x32, 0x12, 0x39, 0x2f, 0x33, 0x30, 0x31, 0x65, 0x11, 0x23, 0x11, 0x37,
-    0x13, 0x33, 0x01, 0x23, 0x03, 0x01, 0x17, 0x23, 0x01, 0x01, 0x15, 0x21, 0x35, 0x02, 0x81, 0xf1,
-    0x6f, 0xfb, 0xfb, 0xfe, 0x81, 0xa2, 0xbc, 0x01, 0x04, 0x24, 0xa2, 0xfe, 0x80, 0x03, 0x41, 0xfd,
-    0x61, 0x6d, 0xfd, 0xf2, 0x02, 0x0e, 0x95, 0x03, 0x38, 0xfb, 0xc6, 0x04, 0x3a, 0xfc, 0xc4, 0xfe,
-    0x04, 0x3a, 0xfc, 0x6c, 0xa6, 0xa6, 0x00, 0x02, 0x00, 0x26, 0x00, 0x00, 0x04, 0xe9, 0x05, 0xb0,
-    0x00, 0x0b, 0x00, 0x0f, 0x00, 0x1f, 0x40, 0x0f, 0x0f, 0x07, 0x05, 0x01, 0x04, 0x0a, 0x03, 0x0e,
-    0x0e, 0x09, 0x05, 0x03, 0x00, 0x02, 0x72, 0x00, 0x2b, 0x32, 0x2f, 0x33, 0x39, 0x2f, 0x17, 0x39,
-    0x12, 0x39, 0x33, 0x30, 0x31, 0x49, 0x02, 0x21, 0x01, 0x01, 0x21, 0x01, 0x01, 0x21, 0x09, 0x02,
-    0x15, 0x21, 0x35, 0x01, 0x53, 0x01, 0x35, 0x01, 0x35, 0x01, 0x21, 0xfe, 0x48, 0x01, 0xc3, 0xfe,
-    0xdc, 0xfe, 0xc3, 0xfe, 0xc3, 0xfe, 0xdb, 0x01, 0xc4, 0xfe, 0x47, 0x03, 0xaa, 0xfd, 0x60, 0x05,
-    0xb0, 0xfd, 0xed, 0x02, 0x13, 0xfd, 0x2f, 0xfd, 0x21, 0x02, 0x1d, 0xfd, 0xe3, 0x02, 0xdf, 0x02,
-    0xd1, 0xfd, 0x8d, 0xa7, 0xa7, 0x00, 0x00, 0x02, 0x00, 0x1f, 0x00, 0x00, 0x03, 0xea, 0x04, 0x3a,
-    0x00, 0x0b, 0x00, 0x0f, 0x00, 0x1f, 0x40, 0x0f, 0x0f, 0x07, 0x05, 0x01, 0x0a, 0x04, 0x03, 0x0e,
-    0x0e, 0x09, 0x05, 0x03, 0x00, 0x06, 0x72, 0x00, 0x2b, 0x32, 0x2f, 0x33, 0x39, 0x2f, 0x17, 0x39,
-    0x12, 0x39, 0x33, 0x30, 0x31, 0x41, 0x13, 0x13, 0x21, 0x01, 0x01, 0x21, 0x03, 0x03, 0x21, 0x09,
-    0x02, 0x15, 0x21, 0x35, 0x01, 0x34, 0xce, 0xd2, 0x01, 0x09, 0xfe, 0xb8, 0x01, 0x55, 0xfe, 0xf7,
-    0xdc, 0xdc, 0xfe, 0xf6, 0x01, 0x54, 0xfe, 0xb9, 0x03, 0x2d, 0xfd, 0x61, 0x04, 0x3a, 0xfe, 0x99,
-    0x01, 0x67, 0xfd, 0xed, 0xfd, 0xd9, 0x01, 0x76, 0xfe, 0x8a, 0x02, 0x27, 0x02, 0x13, 0xfe, 0x45,
-    0xa6, 0xa6, 0xff, 0xff, 0x00, 0x62, 0xff, 0xec, 0x04, 0x12, 0x04, 0x4d, 0x06, 0x06, 0x00, 0xbf,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x01, 0x00, 0x00, 0x04, 0x34, 0x05, 0xb0, 0x06, 0x26, 0x00, 0x2a,
-    0x00, 0x00, 0x01, 0x07, 0x02, 0x40, 0xff, 0x74, 0xfe, 0x65, 0x00, 0x0e, 0xb4, 0x03, 0x0e, 0x02,
-    0x02, 0x00, 0xb8, 0x01, 0x08, 0xb0, 0x56, 0x00, 0x2b, 0x34, 0xff, 0xff, 0x00, 0x7b, 0x02, 0x70,
-    0x05, 0xcc, 0x03, 0x31, 0x06, 0x06, 0x01, 0x82, 0x00, 0x00, 0xff, 0xff, 0x00, 0x52, 0x00, 0x00,
-    0x04, 0x3e, 0x05, 0xc4, 0x06, 0x06, 0x00, 0x16, 0x00, 0x00, 0xff, 0xff, 0x00, 0x4e, 0xff, 0xec,
-    0x04, 0x1a, 0x05, 0xc4, 0x06, 0x06, 0x00, 0x17, 0x00, 0x00, 0xff, 0xff, 0x00, 0x37, 0x00, 0x00,
-    0x04, 0x59, 0x05, 0xb0, 0x06, 0x06, 0x00, 0x18, 0x00, 0x00, 0xff, 0xff, 0x00, 0x7f, 0xff, 0xec,
-    0x04, 0x39, 0x05, 0xb0, 0x06, 0x06, 0x00, 0x19, 0x00, 0x00, 0xff, 0xff, 0x00, 0x87, 0xff, 0xec,
-    0x04, 0x4d, 0x05, 0xb9, 0x04, 0x06, 0x00, 0x1a, 0x14, 0x00, 0xff, 0xff, 0x00, 0x7b, 0xff, 0xec,
-    0x04, 0x3a, 0x05, 0xc4, 0x04, 0x06, 0x00, 0x1c, 0x14, 0x00, 0xff, 0xff, 0x00, 0x5d, 0xff, 0xf7,
-    0x04, 0x15, 0x05, 0xc4, 0x04, 0x06, 0x00, 0x1d, 0x00, 0x00, 0xff, 0xff, 0x00, 0x7c, 0xff, 0xec,
-    0x04, 0x37, 0x05, 0xc4, 0x04, 0x06, 0x00, 0x14, 0x14, 0x00, 0xff, 0xff, 0x00, 0x6b, 0xff, 0xec,
-    0x04, 0xf2, 0x07, 0x4b, 0x06, 0x26, 0x00, 0x2b, 0x00, 0x00, 0x01, 0x07, 0x00, 0x75, 0x01, 0xc6,
-    0x01, 0x4b, 0x00, 0x0b, 0xb6, 0x01, 0x2c, 0x10, 0x01, 0x01, 0x6d, 0x56, 0x00, 0x2b, 0x34, 0x00,
-    0xff, 0xff, 0x00, 0x52, 0xfe, 0x55, 0x04, 0x0c, 0x06, 0x00, 0x06, 0x26, 0x00, 0x4b, 0x00, 0x00,
-    0x01, 0x07, 0x00, 0x75, 0x01, 0x43, 0x00, 0x00, 0x00, 0x0b, 0xb6, 0x03, 0x3f, 0x1a, 0x01, 0x01,
-    0x8c, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x94, 0x00, 0x00, 0x05, 0x17, 0x07, 0x37,
-    0x06, 0x26, 0x00, 0x32, 0x00, 0x00, 0x01, 0x07, 0x00, 0x44, 0x01, 0x47, 0x01, 0x37, 0x00, 0x0b,
-    0xb6, 0x01, 0x0c, 0x09, 0x01, 0x01, 0x61, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x7a,
-    0x00, 0x00, 0x03, 0xfa, 0x06, 0x00, 0x06, 0x26, 0x00, 0x52, 0x00, 0x00, 0x01, 0x07, 0x00, 0x44,
-    0x00, 0xb0, 0x00, 0x00, 0x00, 0x0b, 0xb6, 0x02, 0x1e, 0x03, 0x01, 0x01, 0xa0, 0x56, 0x00, 0x2b,
-    0x34, 0x00, 0xff, 0xff, 0x00, 0x11, 0x00, 0x00, 0x05, 0x3f, 0x07, 0x21, 0x06, 0x26, 0x00, 0x25,
-    0x00, 0x00, 0x01, 0x07, 0x00, 0xac, 0x04, 0x7b, 0x01, 0x33, 0x00, 0x0d, 0xb7, 0x04, 0x03, 0x0e,
-    0x03, 0x01, 0x01, 0x66, 0x56, 0x00, 0x2b, 0x34, 0x34, 0x00, 0xff, 0xff, 0x00, 0x0e, 0xff, 0xec,
-    0x03, 0xf9, 0x05, 0xeb, 0x06, 0x26, 0x00, 0x45, 0x00, 0x00, 0x01, 0x07, 0x00, 0xac, 0x04, 0x06,
-    0xff, 0xfd, 0x00, 0x0d, 0xb7, 0x03, 0x02, 0x3c, 0x0f, 0x01, 0x01, 0x91, 0x56, 0x00, 0x2b, 0x34,
-    0x34, 0x00, 0xff, 0xff, 0x00, 0x4e, 0x00, 0x00, 0x04, 0x4d, 0x07, 0x28, 0x06, 0x26, 0x00, 0x29,
-    0x00, 0x00, 0x01, 0x07, 0x00, 0xac, 0x04, 0x46, 0x01, 0x3a, 0x00, 0x0d, 0xb7, 0x05, 0x04, 0x11,
-    0x07, 0x01, 0x01, 0x71, 0x56, 0x00, 0x2b, 0x34, 0x34, 0x00, 0xff, 0xff, 0x00, 0x03, 0xff, 0xec,
-    0x04, 0x0a, 0x05, 0xeb, 0x06, 0x26, 0x00, 0x49, 0x00, 0x00, 0x01, 0x07, 0x00, 0xac, 0x03, 0xfb,
-    0xff, 0xfd, 0x00, 0x0d, 0xb7, 0x02, 0x01, 0x2d, 0x0b, 0x01, 0x01, 0x91, 0x56, 0x00, 0x2b, 0x34,
-    0x34, 0x00, 0xff, 0xff, 0xfe, 0xfb, 0x00, 0x00, 0x02, 0x23, 0x07, 0x28, 0x06, 0x26, 0x00, 0x2d,
-    0x00, 0x00, 0x01, 0x07, 0x00, 0xac, 0x02, 0xf3, 0x01, 0x3a, 0x00, 0x0d, 0xb7, 0x02, 0x01, 0x05,
-    0x03, 0x01, 0x01, 0x71, 0x56, 0x00, 0x2b, 0x34, 0x34, 0x00, 0xff, 0xff, 0xfe, 0xe5, 0x00, 0x00,
-    0x02, 0x0d, 0x05, 0xe2, 0x06, 0x26, 0x00, 0x8d, 0x00, 0x00, 0x01, 0x07, 0x00, 0xac, 0x02, 0xdc,
-    0xff, 0xf4, 0x00, 0x0d, 0xb7, 0x02, 0x01, 0x05, 0x03, 0x01, 0x01, 0xa3, 0x56, 0x00, 0x2b, 0x34,
-    0x34, 0x00, 0xff, 0xff, 0x00, 0x65, 0xff, 0xec, 0x05, 0x1d, 0x07, 0x23, 0x06, 0x26, 0x00, 0x33,
-    0x00, 0x00, 0x01, 0x07, 0x00, 0xac, 0x04, 0x93, 0x01, 0x35, 0x00, 0x0d, 0xb7, 0x03, 0x02, 0x2d,
-    0x11, 0x01, 0x01, 0x54, 0x56, 0x00, 0x2b, 0x34, 0x34, 0x00, 0xff, 0xff, 0x00, 0x19, 0xff, 0xec,
-    0x04, 0x3c, 0x05, 0xeb, 0x06, 0x26, 0x00, 0x53, 0x00, 0x00, 0x01, 0x07, 0x00, 0xac, 0x04, 0x11,
-    0xff, 0xfd, 0x00, 0x0d, 0xb7, 0x03, 0x02, 0x2d, 0x06, 0x01, 0x01, 0x91, 0x56, 0x00, 0x2b, 0x34,
-    0x34, 0x00, 0xff, 0xff, 0x00, 0x35, 0x00, 0x00, 0x04, 0xdf, 0x07, 0x21, 0x06, 0x26, 0x00, 0x36,
-    0x00, 0x00, 0x01, 0x07, 0x00, 0xac, 0x04, 0x2d, 0x01, 0x33, 0x00, 0x0d, 0xb7, 0x03, 0x02, 0x1f,
-    0x00, 0x01, 0x01, 0x66, 0x56, 0x00, 0x2b, 0x34, 0x34, 0x00, 0xff, 0xff, 0xff, 0x73, 0x00, 0x00,
-    0x02, 0xb9, 0x05, 0xeb, 0x06, 0x26, 0x00, 0x56, 0x00, 0x00, 0x01, 0x07, 0x00, 0xac, 0x03, 0x6b,
-    0xff, 0xfd, 0x00, 0x0d, 0xb7, 0x03, 0x02, 0x18, 0x03, 0x01, 0x01, 0xa5, 0x56, 0x00, 0x2b, 0x34,
-    0x34, 0x00, 0xff, 0xff, 0x00, 0x77, 0xff, 0xec, 0x04, 0xbf, 0x07, 0x21, 0x06, 0x26, 0x00, 0x39,
-    0x00, 0x00, 0x01, 0x07, 0x00, 0xac, 0x04, 0x6f, 0x01, 0x33, 0x00, 0x0d, 0xb7, 0x02, 0x01, 0x17,
-    0x0b, 0x01, 0x01, 0x66, 0x56, 0x00, 0x2b, 0x34, 0x34, 0x00, 0xff, 0xff, 0x00, 0x14, 0xff, 0xec,
-    0x03, 0xf9, 0x05, 0xeb, 0x06, 0x26, 0x00, 0x59, 0x00, 0x00, 0x01, 0x07, 0x00, 0xac, 0x04, 0x0c,
-    0xff, 0xfd, 0x00, 0x0d, 0xb7, 0x03, 0x02, 0x1d, 0x11, 0x01, 0x01, 0xa5, 0x56, 0x00, 0x2b, 0x34,
-    0x34, 0x00, 0xff, 0xff, 0xff, 0x0b, 0x00, 0x00, 0x05, 0x0f, 0x06, 0x3f, 0x04, 0x26, 0x00, 0xd0,
-    0x64, 0x00, 0x00, 0x07, 0x00, 0xae, 0xfe, 0x3f, 0xff, 0xff, 0xff, 0xff, 0x00, 0x94, 0xfe, 0xa1,
-    0x04, 0xa5, 0x05, 0xb0, 0x06, 0x26, 0x00, 0x26, 0x00, 0x00, 0x01, 0x07, 0x00, 0xad, 0x04, 0xb3,
-    0x00, 0x0a, 0x00, 0x0e, 0xb4, 0x02, 0x34, 0x1b, 0x01, 0x01, 0xb8, 0xff, 0x7f, 0xb0, 0x56, 0x00,
-    0x2b, 0x34, 0xff, 0xff, 0x00, 0x7d, 0xfe, 0x8d, 0x04, 0x30, 0x06, 0x00, 0x06, 0x26, 0x00, 0x46,
-    0x00, 0x00, 0x01, 0x07, 0x00, 0xad, 0x04, 0xce, 0xff, 0xf6, 0x00, 0x0e, 0xb4, 0x03, 0x33, 0x04,
-    0x01, 0x01, 0xb8, 0xff, 0x6b, 0xb0, 0x56, 0x00, 0x2b, 0x34, 0xff, 0xff, 0x00, 0x94, 0xfe, 0xa1,
-    0x04, 0xd2, 0x05, 0xb0, 0x06, 0x26, 0x00, 0x28, 0x00, 0x00, 0x01, 0x07, 0x00, 0xad, 0x04, 0x8a,
-    0x00, 0x0a, 0x00, 0x0e, 0xb4, 0x02, 0x22, 0x1d, 0x01, 0x01, 0xb8, 0xff, 0x7f, 0xb0, 0x56, 0x00,
-    0x2b, 0x34, 0xff, 0xff, 0x00, 0x50, 0xfe, 0x97, 0x04, 0x02, 0x06, 0x00, 0x06, 0x26, 0x00, 0x48,
-    0x00, 0x00, 0x01, 0x07, 0x00, 0xad, 0x04, 0xaf, 0x00, 0x00, 0x00, 0x0e, 0xb4, 0x03, 0x33, 0x16,
-    0x01, 0x01, 0xb8, 0xff, 0x89, 0xb0, 0x56, 0x00, 0x2b, 0x34, 0xff, 0xff, 0x00, 0x94, 0xfe, 0x06,
-    0x04, 0xd2, 0x05, 0xb0, 0x06, 0x26, 0x00, 0x28, 0x00, 0x00, 0x01, 0x07, 0x01, 0xd4, 0x01, 0x42,
-    0xfe, 0xa2, 0x00, 0x0e, 0xb4, 0x02, 0x28, 0x1d, 0x01, 0x01, 0xb8, 0xff, 0x97, 0xb0, 0x56, 0x00,
-    0x2b, 0x34, 0xff, 0xff, 0x00, 0x50, 0xfd, 0xfc, 0x04, 0x02, 0x06, 0x00, 0x06, 0x26, 0x00, 0x48,
-    0x00, 0x00, 0x01, 0x07, 0x01, 0xd4, 0x01, 0x66, 0xfe, 0x98, 0x00, 0x0e, 0xb4, 0x03, 0x39, 0x16,
-    0x01, 0x01, 0xb8, 0xff, 0xa1, 0xb0, 0x56, 0x00, 0x2b, 0x34, 0xff, 0xff, 0x00, 0x94, 0xfe, 0xa1,
-    0x05, 0x17, 0x05, 0xb0, 0x06, 0x26, 0x00, 0x2c, 0x00, 0x00, 0x01, 0x07, 0x00, 0xad, 0x05, 0x26,
-    0x00, 0x0a, 0x00, 0x0e, 0xb4, 0x03, 0x0f, 0x0a, 0x01, 0x01, 0xb8, 0xff, 0x7f, 0xb0, 0x56, 0x00,
-    0x2b, 0x34, 0xff, 0xff, 0x00, 0x7a, 0xfe, 0xa1, 0x03, 0xfa, 0x06, 0x00, 0x06, 0x26, 0x00, 0x4c,
-    0x00, 0x00, 0x01, 0x07, 0x00, 0xad, 0x04, 0x9f, 0x00, 0x0a, 0x00, 0x0e, 0xb4, 0x02, 0x1e, 0x02,
-    0x01, 0x01, 0xb8, 0xff, 0x7f, 0xb0, 0x56, 0x00, 0x2b, 0x34, 0xff, 0xff, 0x00, 0x94, 0x00, 0x00,
-    0x05, 0x16, 0x07, 0x33, 0x06, 0x26, 0x00, 0x2f, 0x00, 0x00, 0x01, 0x07, 0x00, 0x75, 0x01, 0x71,
-    0x01, 0x33, 0x00, 0x0b, 0xb6, 0x03, 0x0e, 0x03, 0x01, 0x01, 0x5b, 0x56, 0x00, 0x2b, 0x34, 0x00,
-    0xff, 0xff, 0x00, 0x7d, 0x00, 0x00, 0x04, 0x37, 0x07, 0x3d, 0x06, 0x26, 0x00, 0x4f, 0x00, 0x00,
-    0x01, 0x07, 0x00, 0x75, 0x01, 0x77, 0x01, 0x3d, 0x00, 0x0b, 0xb6, 0x03, 0x0e, 0x03, 0x01, 0x00,
-    0x1b, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x94, 0xfe, 0xe4, 0x05, 0x16, 0x05, 0xb0,
-    0x06, 0x26, 0x00, 0x2f, 0x00, 0x00, 0x01, 0x07, 0x00, 0xad, 0x04, 0xe5, 0x00, 0x4c, 0x00, 0x0e,
-    0xb4, 0x03, 0x11, 0x02, 0x01, 0x01, 0xb8, 0xff, 0xcf, 0xb0, 0x56, 0x00, 0x2b, 0x34, 0xff, 0xff,
-    0x00, 0x7d, 0xfe, 0xd0, 0x04, 0x37, 0x06, 0x00, 0x06, 0x26, 0x00, 0x4f, 0x00, 0x00, 0x01, 0x07,
-    0x00, 0xad, 0x04, 0x7a, 0x00, 0x38, 0x00, 0x0e, 0xb4, 0x03, 0x11, 0x02, 0x01, 0x01, 0xb8, 0xff,
-    0xbc, 0xb0, 0x56, 0x00, 0x2b, 0x34, 0xff, 0xff, 0x00, 0x94, 0xfe, 0xa1, 0x04, 0x24, 0x05, 0xb0,
-    0x06, 0x26, 0x00, 0x30, 0x00, 0x00, 0x01, 0x07, 0x00, 0xad, 0x04, 0xb7, 0x00, 0x0a, 0x00, 0x0e,
-    0xb4, 0x02, 0x0b, 0x02, 0x01, 0x01, 0xb8, 0xff, 0x7f, 0xb0, 0x56, 0x00, 0x2b, 0x34, 0xff, 0xff,
-    0x00, 0x78, 0xfe, 0xa1, 0x01, 0x8c, 0x06, 0x00, 0x06, 0x26, 0x00, 0x50, 0x00, 0x00, 0x01, 0x07,
-    0x00, 0xad, 0x03, 0x5a, 0x00, 0x0a, 0x00, 0x0e, 0xb4, 0x01, 0x07, 0x02, 0x01, 0x01, 0xb8, 0xff,
-    0x7f, 0xb0, 0x56, 0x00, 0x2b, 0x34, 0xff, 0xff, 0x00, 0x94, 0xfe, 0xa1, 0x06, 0x6a, 0x05, 0xb0,
-    0x06, 0x26, 0x00, 0x31, 0x00, 0x00, 0x01, 0x07, 0x00, 0xad, 0x05, 0xd4, 0x00, 0x0a, 0x00, 0x0e,
-    0xb4, 0x03, 0x14, 0x06, 0x01, 0x01, 0xb8, 0xff, 0x7f, 0xb0, 0x56, 0x00, 0x2b, 0x34, 0xff, 0xff,
-    0x00, 0x7c, 0xfe, 0xa1, 0x06, 0x7c, 0x04, 0x4e, 0x06, 0x26, 0x00, 0x51, 0x00, 0x00, 0x01, 0x07,
-    0x00, 0xad, 0x05, 0xda, 0x00, 0x0a, 0x00, 0x0e, 0xb4, 0x03, 0x36, 0x02, 0x01, 0x01, 0xb8, 0xff,
-    0x7f, 0xb0, 0x56, 0x00, 0x2b, 0x34, 0xff, 0xff, 0x00, 0x94, 0xfe, 0x9e, 0x05, 0x17, 0x05, 0xb0,
-    0x06, 0x26, 0x00, 0x32, 0x00, 0x00, 0x01, 0x07, 0x00, 0xad, 0x05, 0x28, 0x00, 0x06, 0x00, 0x0e,
-    0xb4, 0x01, 0x0d, 0x02, 0x01, 0x01, 0xb8, 0xff, 0x7f, 0xb0, 0x56, 0x00, 0x2b, 0x34, 0xff, 0xff,
-    0x00, 0x7a, 0xfe, 0xa1, 0x03, 0xfa, 0x04, 0x4e, 0x06, 0x26, 0x00, 0x52, 0x00, 0x00, 0x01, 0x07,
-    0x00, 0xad, 0x04, 0x8f, 0x00, 0x0a, 0x00, 0x0e, 0xb4, 0x02, 0x1f, 0x02, 0x01, 0x01, 0xb8, 0xff,
-    0x7f, 0xb0, 0x56, 0x00, 0x2b, 0x34, 0xff, 0xff, 0x00, 0x65, 0xff, 0xec, 0x05, 0x1d, 0x07, 0xde,
-    0x06, 0x26, 0x00, 0x33, 0x00, 0x00, 0x01, 0x07, 0x02, 0x50, 0x05, 0x00, 0x01, 0x55, 0x00, 0x0d,
-    0xb7, 0x03, 0x02, 0x31, 0x11, 0x01, 0x01, 0x5a, 0x56, 0x00, 0x2b, 0x34, 0x34, 0x00, 0xff, 0xff,
-    0x00, 0x94, 0x00, 0x00, 0x04, 0xcf, 0x07, 0x42, 0x06, 0x26, 0x00, 0x34, 0x00, 0x00, 0x01, 0x07,
-    0x00, 0x75, 0x01, 0x72, 0x01, 0x42, 0x00, 0x0b, 0xb6, 0x01, 0x18, 0x0f, 0x01, 0x01, 0x6c, 0x56,
-    0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x7d, 0xfe, 0x60, 0x04, 0x2f, 0x05, 0xf6, 0x06, 0x26,
-    0x00, 0x54, 0x00, 0x00, 0x01, 0x07, 0x00, 0x75, 0x01, 0xa0, 0xff, 0xf6, 0x00, 0x0b, 0xb6, 0x03,
-    0x30, 0x03, 0x01, 0x01, 0x96, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x94, 0xfe, 0xa1,
-    0x04, 0xdf, 0x05, 0xb0, 0x06, 0x26, 0x00, 0x36, 0x00, 0x00, 0x01, 0x07, 0x00, 0xad, 0x04, 0xb9,
-    0x00, 0x0a, 0x00, 0x0e, 0xb4, 0x02, 0x21, 0x18, 0x01, 0x01, 0xb8, 0xff, 0x7f, 0xb0, 0x56, 0x00,
-    0x2b, 0x34, 0xff, 0xff, 0x00, 0x71, 0xfe, 0xa2, 0x02, 0xb9, 0x04, 0x4e, 0x06, 0x26, 0x00, 0x56,
-    0x00, 0x00, 0x01, 0x07, 0x00, 0xad, 0x03, 0x53, 0x00, 0x0b, 0x00, 0x0e, 0xb4, 0x02, 0x1a, 0x02,
-    0x01, 0x01, 0xb8, 0xff, 0x80, 0xb0, 0x56, 0x00, 0x2b, 0x34, 0xff, 0xff, 0x00, 0x4b, 0xfe, 0x97,
-    0x04, 0x8e, 0x05, 0xc4, 0x06, 0x26, 0x00, 0x37, 0x00, 0x00, 0x01, 0x07, 0x00, 0xad, 0x04, 0xd6,
-    0xff, 0xff, 0x00, 0x0e, 0xb4, 0x01, 0x3d, 0x2b, 0x01, 0x01, 0xb8, 0xff, 0x88, 0xb0, 0x56, 0x00,
-    0x2b, 0x34, 0xff, 0xff, 0x00, 0x49, 0xfe, 0x8d, 0x03, 0xc7, 0x04, 0x4e, 0x06, 0x26, 0x00, 0x57,
-    0x00, 0x00, 0x01, 0x07, 0x00, 0xad, 0x04, 0x74, 0xff, 0xf6, 0x00, 0x0e, 0xb4, 0x01, 0x39, 0x29,
-    0x01, 0x01, 0xb8, 0xff, 0x7f, 0xb0, 0x56, 0x00, 0x2b, 0x34, 0xff, 0xff, 0x00, 0x2d, 0xfe, 0x9b,
-    0x04, 0xb4, 0x05, 0xb0, 0x06, 0x26, 0x00, 0x38, 0x00, 0x00, 0x01, 0x07, 0x00, 0xad, 0x04, 0xc4,
-    0x00, 0x04, 0x00, 0x0e, 0xb4, 0x02, 0x0b, 0x02, 0x01, 0x01, 0xb8, 0xff, 0x75, 0xb0, 0x56, 0x00,
-    0x2b, 0x34, 0xff, 0xff, 0x00, 0x0a, 0xfe, 0x97, 0x02, 0x75, 0x05, 0x43, 0x06, 0x26, 0x00, 0x58,
-    0x00, 0x00, 0x01, 0x07, 0x00, 0xad, 0x04, 0x0f, 0x00, 0x00, 0x00, 0x0e, 0xb4, 0x02, 0x19, 0x11,
-    0x01, 0x01, 0xb8, 0xff, 0x89, 0xb0, 0x56, 0x00, 0x2b, 0x34, 0xff, 0xff, 0x00, 0x80, 0xff, 0xec,
-    0x04, 0xbf, 0x07, 0xdd, 0x06, 0x26, 0x00, 0x39, 0x00, 0x00, 0x01, 0x07, 0x02, 0x50, 0x04, 0xdb,
-    0x01, 0x53, 0x00, 0x0d, 0xb7, 0x02, 0x01, 0x1b, 0x00, 0x01, 0x01, 0x6c, 0x56, 0x00, 0x2b, 0x34,
-    0x34, 0x00, 0xff, 0xff, 0x00, 0x11, 0x00, 0x00, 0x05, 0x1b, 0x07, 0x36, 0x06, 0x26, 0x00, 0x3a,
-    0x00, 0x00, 0x01, 0x07, 0x00, 0xa5, 0x00, 0xb2, 0x01, 0x43, 0x00, 0x0b, 0xb6, 0x02, 0x18, 0x09,
-    0x01, 0x01, 0x76, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x16, 0x00, 0x00, 0x03, 0xdf,
-    0x05, 0xea, 0x06, 0x26, 0x00, 0x5a, 0x00, 0x00, 0x01, 0x06, 0x00, 0xa5, 0x1d, 0xf7, 0x00, 0x0b,
-    0xb6, 0x02, 0x18, 0x09, 0x01, 0x01, 0xa0, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x11,
-    0xfe, 0xa1, 0x05, 0x1b, 0x05, 0xb0, 0x06, 0x26, 0x00, 0x3a, 0x00, 0x00, 0x01, 0x07, 0x00, 0xad,
-    0x04, 0xec, 0x00, 0x0a, 0x00, 0x0e, 0xb4, 0x02, 0x0d, 0x04, 0x01, 0x01, 0xb8, 0xff, 0x7f, 0xb0,
-    0x56, 0x00, 0x2b, 0x34, 0xff, 0xff, 0x00, 0x16, 0xfe, 0xa1, 0x03, 0xdf, 0x04, 0x3a, 0x06, 0x26,
-    0x00, 0x5a, 0x00, 0x00, 0x01, 0x07, 0x00, 0xad, 0x04, 0x56, 0x00, 0x0a, 0x00, 0x0e, 0xb4, 0x02,
-    0x0d, 0x04, 0x01, 0x01, 0xb8, 0xff, 0x7f, 0xb0, 0x56, 0x00, 0x2b, 0x34, 0xff, 0xff, 0x00, 0x2f,
-    0xfe, 0xa1, 0x06, 0xe6, 0x05, 0xb0, 0x06, 0x26, 0x00, 0x3b, 0x00, 0x00, 0x01, 0x07, 0x00, 0xad,
-    0x05, 0xe3, 0x00, 0x0a, 0x00, 0x0e, 0xb4, 0x04, 0x19, 0x13, 0x01, 0x01, 0xb8, 0xff, 0x7f, 0xb0,
-    0x56, 0x00, 0x2b, 0x34, 0xff, 0xff, 0x00, 0x23, 0xfe, 0xa1, 0x05, 0xc8, 0x04, 0x3a, 0x06, 0x26,
-    0x00, 0x5b, 0x00, 0x00, 0x01, 0x07, 0x00, 0xad, 0x05, 0x4c, 0x00, 0x0a, 0x00, 0x0e, 0xb4, 0x04,
-    0x19, 0x13, 0x01, 0x01, 0xb8, 0xff, 0x7f, 0xb0, 0x56, 0x00, 0x2b, 0x34, 0xff, 0xff, 0x00, 0x50,
-    0xfe, 0xa1, 0x04, 0x8e, 0x05, 0xb0, 0x06, 0x26, 0x00, 0x3e, 0x00, 0x00, 0x01, 0x07, 0x00, 0xad,
-    0x04, 0xc4, 0x00, 0x0a, 0x00, 0x0e, 0xb4, 0x03, 0x11, 0x02, 0x01, 0x01, 0xb8, 0xff, 0x7f, 0xb0,
-    0x56, 0x00, 0x2b, 0x34, 0xff, 0xff, 0x00, 0x51, 0xfe, 0xa1, 0x03, 0xc1, 0x04, 0x3a, 0x06, 0x26,
-    0x00, 0x5e, 0x00, 0x00, 0x01, 0x07, 0x00, 0xad, 0x04, 0x64, 0x00, 0x0a, 0x00, 0x0e, 0xb4, 0x03,
-    0x11, 0x02, 0x01, 0x01, 0xb8, 0xff, 0x7f, 0xb0, 0x56, 0x00, 0x2b, 0x34, 0xff, 0xff, 0xfe, 0x6c,
-    0xff, 0xec, 0x05, 0x63, 0x05, 0xd6, 0x04, 0x26, 0x00, 0x33, 0x46, 0x00, 0x01, 0x07, 0x01, 0x71,
-    0xfe, 0x08, 0xff, 0xff, 0x00, 0x0d, 0xb7, 0x03, 0x02, 0x2e, 0x11, 0x00, 0x00, 0x12, 0x56, 0x00,
-    0x2b, 0x34, 0x34, 0x00, 0xff, 0xff, 0x00, 0x08, 0x00, 0x00, 0x04, 0x91, 0x05, 0x1c, 0x06, 0x26,
-    0x02, 0x4d, 0x00, 0x00, 0x00, 0x07, 0x00, 0xae, 0xff, 0x5f, 0xfe, 0xdc, 0xff, 0xff, 0xff, 0x62,
-    0x00, 0x00, 0x03, 0xf2, 0x05, 0x1f, 0x04, 0x26, 0x02, 0x42, 0x3c, 0x00, 0x00, 0x07, 0x00, 0xae,
-    0xfe, 0x96, 0xfe, 0xdf, 0xff, 0xff, 0xff, 0x6b, 0x00, 0x00, 0x04, 0xa3, 0x05, 0x1a, 0x04, 0x26,
-    0x01, 0xfe, 0x3c, 0x00, 0x00, 0x07, 0x00, 0xae, 0xfe, 0x9e, 0xfe, 0xda, 0xff, 0xff, 0xff, 0x6e,
-    0x00, 0x00, 0x01, 0xb4, 0x05, 0x1f, 0x04, 0x26, 0x01, 0xfd, 0x3c, 0x00, 0x00, 0x07, 0x00, 0xae,
-    0xfe, 0xa1, 0xfe, 0xdf, 0xff, 0xff, 0xff, 0x98, 0xff, 0xf0, 0x04, 0x78, 0x05, 0x1c, 0x04, 0x26,
-    0x01, 0xf7, 0x0a, 0x00, 0x00, 0x07, 0x00, 0xae, 0xfe, 0xcc, 0xfe, 0xdc, 0xff, 0xff, 0xff, 0x20,
-    0x00, 0x00, 0x04, 0x74, 0x05, 0x1c, 0x04, 0x26, 0x01, 0xed, 0x3c, 0x00, 0x00, 0x07, 0x00, 0xae,
-    0xfe, 0x53, 0xfe, 0xdc, 0xff, 0xff, 0xff, 0xab, 0x00, 0x00, 0x04, 0x8b, 0x05, 0x1d, 0x04, 0x26,
-    0x02, 0x0d, 0x0a, 0x00, 0x00, 0x07, 0x00, 0xae, 0xfe, 0xde, 0xfe, 0xdc, 0xff, 0xff, 0x00, 0x08,
-    0x00, 0x00, 0x04, 0x91, 0x04, 0x8d, 0x06, 0x06, 0x02, 0x4d, 0x00, 0x00, 0xff, 0xff, 0x00, 0x76,
-    0x00, 0x00, 0x04, 0x0c, 0x04, 0x8d, 0x06, 0x06, 0x02, 0x4c, 0x00, 0x00, 0xff, 0xff, 0x00, 0x76,
-    0x00, 0x00, 0x03, 0xb6, 0x04, 0x8d, 0x06, 0x06, 0x02, 0x42, 0x00, 0x00, 0xff, 0xff, 0x00, 0x41,
-    0x00, 0x00, 0x03, 0xf5, 0x04, 0x8d, 0x06, 0x06, 0x01, 0xec, 0x00, 0x00, 0xff, 0xff, 0x00, 0x76,
-    0x00, 0x00, 0x04, 0x67, 0x04, 0x8d, 0x06, 0x06, 0x01, 0xfe, 0x00, 0x00, 0xff, 0xff, 0x00, 0x86,
-    0x00, 0x00, 0x01, 0x78, 0x04, 0x8d, 0x06, 0x06, 0x01, 0xfd, 0x00, 0x00, 0xff, 0xff, 0x00, 0x76,
-    0x00, 0x00, 0x04, 0x67, 0x04, 0x8d, 0x06, 0x06, 0x01, 0xfb, 0x00, 0x00, 0xff, 0xff, 0x00, 0x76,
-    0x00, 0x00, 0x05, 0x8f, 0x04, 0x8d, 0x06, 0x06, 0x01, 0xf9, 0x00, 0x00, 0xff, 0xff, 0x00, 0x76,
-    0x00, 0x00, 0x04, 0x67, 0x04, 0x8d, 0x06, 0x06, 0x01, 0xf8, 0x00, 0x00, 0xff, 0xff, 0x00, 0x4e,
-    0xff, 0xf0, 0x04, 0x6e, 0x04, 0x9d, 0x06, 0x06, 0x01, 0xf7, 0x00, 0x00, 0xff, 0xff, 0x00, 0x76,
-    0x00, 0x00, 0x04, 0x28, 0x04, 0x8d, 0x06, 0x06, 0x01, 0xf6, 0x00, 0x00, 0xff, 0xff, 0x00, 0x25,
-    0x00, 0x00, 0x04, 0x19, 0x04, 0x8d, 0x06, 0x06, 0x01, 0xf2, 0x00, 0x00, 0xff, 0xff, 0x00, 0x06,
-    0x00, 0x00, 0x04, 0x38, 0x04, 0x8d, 0x06, 0x06, 0x01, 0xed, 0x00, 0x00, 0xff, 0xff, 0x00, 0x13,
-    0x00, 0x00, 0x04, 0x49, 0x04, 0x8d, 0x06, 0x06, 0x01, 0xee, 0x00, 0x00, 0xff, 0xff, 0xff, 0x9c,
-    0x00, 0x00, 0x02, 0x64, 0x05, 0xeb, 0x06, 0x26, 0x01, 0xfd, 0x00, 0x00, 0x01, 0x07, 0x00, 0x6a,
-    0xff, 0x39, 0x00, 0x1e, 0x00, 0x0d, 0xb7, 0x02, 0x01, 0x0d, 0x03, 0x01, 0x01, 0x84, 0x56, 0x00,
-    0x2b, 0x34, 0x34, 0x00, 0xff, 0xff, 0x00, 0x06, 0x00, 0x00, 0x04, 0x38, 0x05, 0xeb, 0x06, 0x26,
-    0x01, 0xed, 0x00, 0x00, 0x01, 0x06, 0x00, 0x6a, 0x52, 0x1e, 0x00, 0x0d, 0xb7, 0x04, 0x03, 0x17,
-    0x09, 0x01, 0x01, 0x83, 0x56, 0x00, 0x2b, 0x34, 0x34, 0x00, 0xff, 0xff, 0x00, 0x76, 0x00, 0x00,
-    0x03, 0xb6, 0x05, 0xeb, 0x06, 0x26, 0x02, 0x42, 0x00, 0x00, 0x01, 0x06, 0x00, 0x6a, 0x5c, 0x1e,
-    0x00, 0x0d, 0xb7, 0x05, 0x04, 0x19, 0x07, 0x01, 0x01, 0x83, 0x56, 0x00, 0x2b, 0x34, 0x34, 0x00,
-    0xff, 0xff, 0x00, 0x76, 0x00, 0x00, 0x03, 0x99, 0x06, 0x1e, 0x06, 0x26, 0x02, 0x04, 0x00, 0x00,
-    0x01, 0x07, 0x00, 0x75, 0x01, 0x23, 0x00, 0x1e, 0x00, 0x0b, 0xb6, 0x02, 0x08, 0x03, 0x01, 0x01,
-    0x83, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x3f, 0xff, 0xf0, 0x03, 0xf0, 0x04, 0x9d,
-    0x06, 0x06, 0x01, 0xf3, 0x00, 0x00, 0xff, 0xff, 0x00, 0x86, 0x00, 0x00, 0x01, 0x78, 0x04, 0x8d,
-    0x06, 0x06, 0x01, 0xfd, 0x00, 0x00, 0xff, 0xff, 0xff, 0x9c, 0x00, 0x00, 0x02, 0x64, 0x05, 0xeb,
-    0x06, 0x26, 0x01, 0xfd, 0x00, 0x00, 0x01, 0x07, 0x00, 0x6a, 0xff, 0x39, 0x00, 0x1e, 0x00, 0x0d,
-    0xb7, 0x02, 0x01, 0x0d, 0x03, 0x01, 0x01, 0x84, 0x56, 0x00, 0x2b, 0x34, 0x34, 0x00, 0xff, 0xff,
-    0x00, 0x26, 0xff, 0xf0, 0x03, 0x65, 0x04, 0x8d, 0x06, 0x06, 0x01, 0xfc, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x76, 0x00, 0x00, 0x04, 0x67, 0x06, 0x1e, 0x06, 0x26, 0x01, 0xfb, 0x00, 0x00, 0x01, 0x07,
-    0x00, 0x75, 0x01, 0x1a, 0x00, 0x1e, 0x00, 0x0b, 0xb6, 0x03, 0x0e, 0x03, 0x01, 0x01, 0x84, 0x56,
-    0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x1f, 0xff, 0xec, 0x04, 0x41, 0x06, 0x05, 0x06, 0x26,
-    0x02, 0x1b, 0x00, 0x00, 0x01, 0x06, 0x00, 0xa1, 0x7d, 0x1e, 0x00, 0x0b, 0xb6, 0x02, 0x1d, 0x17,
-    0x01, 0x01, 0x84, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x08, 0x00, 0x00, 0x04, 0x91,
-    0x04, 0x8d, 0x06, 0x06, 0x02, 0x4d, 0x00, 0x00, 0xff, 0xff, 0x00, 0x76, 0x00, 0x00, 0x04, 0x0c,
-    0x04, 0x8d, 0x06, 0x06, 0x02, 0x4c, 0x00, 0x00, 0xff, 0xff, 0x00, 0x76, 0x00, 0x00, 0x03, 0x99,
-    0x04, 0x8d, 0x06, 0x06, 0x02, 0x04, 0x00, 0x00, 0xff, 0xff, 0x00, 0x76, 0x00, 0x00, 0x03, 0xb6,
-    0x04, 0x8d, 0x06, 0x06, 0x02, 0x42, 0x00, 0x00, 0xff, 0xff, 0x00, 0x76, 0x00, 0x00, 0x04, 0x6d,
-    0x06, 0x05, 0x06, 0x26, 0x02, 0x18, 0x00, 0x00, 0x01, 0x07, 0x00, 0xa1, 0x00, 0xb6, 0x00, 0x1e,
-    0x00, 0x0b, 0xb6, 0x03, 0x11, 0x08, 0x01, 0x01, 0x84, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff,
-    0x00, 0x76, 0x00, 0x00, 0x05, 0x8f, 0x04, 0x8d, 0x06, 0x06, 0x01, 0xf9, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x76, 0x00, 0x00, 0x04, 0x67, 0x04, 0x8d, 0x06, 0x06, 0x01, 0xfe, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x4e, 0xff, 0xf0, 0x04, 0x6e, 0x04, 0x9d, 0x06, 0x06, 0x01, 0xf7, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x76, 0x00, 0x00, 0x04, 0x63, 0x04, 0x8d, 0x06, 0x06, 0x02, 0x09, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x76, 0x00, 0x00, 0x04, 0x28, 0x04, 0x8d, 0x06, 0x06, 0x01, 0xf6, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x4f, 0xff, 0xf0, 0x04, 0x43, 0x04, 0x9d, 0x06, 0x06, 0x02, 0x4b, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x25, 0x00, 0x00, 0x04, 0x19, 0x04, 0x8d, 0x06, 0x06, 0x01, 0xf2, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x13, 0x00, 0x00, 0x04, 0x49, 0x04, 0x8d, 0x06, 0x06, 0x01, 0xee, 0x00, 0x00, 0x00, 0x03,
-    0x00, 0x43, 0xfe, 0x37, 0x03, 0xea, 0x04, 0x9d, 0x00, 0x1e, 0x00, 0x3e, 0x00, 0x42, 0x00, 0x28,
-    0x40, 0x13, 0x1f, 0x01, 0x02, 0x02, 0x3e, 0x3e, 0x15, 0x3f, 0x34, 0x34, 0x40, 0x30, 0x2a, 0x0b,
-    0x72, 0x0f, 0x0b, 0x15, 0x7e, 0x00, 0x3f, 0x33, 0xcc, 0x2b, 0xcc, 0xcd, 0x33, 0x12, 0x39, 0x12,
-    0x39, 0x2f, 0x33, 0x12, 0x39, 0x39, 0x30, 0x31, 0x41, 0x23, 0x35, 0x33, 0x32, 0x36, 0x36, 0x35,
-    0x34, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x15, 0x23, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x1e, 0x02,
-    0x15, 0x14, 0x0e, 0x02, 0x25, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e,
-    0x02, 0x35, 0x33, 0x1e, 0x02, 0x33, 0x32, 0x36, 0x36, 0x35, 0x34, 0x2e, 0x02, 0x23, 0x23, 0x01,
-    0x11, 0x23, 0x11, 0x02, 0x39, 0xb9, 0x91, 0x4d, 0x5e, 0x2a, 0x2d, 0x60, 0x4f, 0x35, 0x59, 0x37,
-    0xf1, 0x43, 0x78, 0x9f, 0x5d, 0x69, 0xa9, 0x78, 0x42, 0x3f, 0x70, 0x97, 0xfe, 0xef, 0xb9, 0x6c,
-    0xa2, 0x6d, 0x36, 0x47, 0x82, 0xae, 0x68, 0x51, 0xa1, 0x85, 0x51, 0xf1, 0x04, 0x3a, 0x60, 0x3b,
-    0x51, 0x68, 0x32, 0x1e, 0x3b, 0x58, 0x3a, 0x8d, 0x01, 0x02, 0xf1, 0x02, 0x2c, 0x7d, 0x27, 0x45,
-    0x2f, 0x2a, 0x45, 0x2a, 0x1d, 0x3c, 0x2e, 0x4e, 0x79, 0x54, 0x2c, 0x28, 0x4f, 0x77, 0x4f, 0x43,
-    0x71, 0x53, 0x2d, 0x46, 0x2d, 0x52, 0x6f, 0x41, 0x54, 0x7f, 0x55, 0x2b, 0x24, 0x50, 0x84, 0x5f,
-    0x35, 0x43, 0x20, 0x2a, 0x49, 0x30, 0x2c, 0x41, 0x2a, 0x15, 0xfe, 0x52, 0xfd, 0xe7, 0x02, 0x19,
-    0x00, 0x04, 0x00, 0x76, 0xfe, 0x9a, 0x05, 0x28, 0x04, 0x8d, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0b,
-    0x00, 0x0f, 0x00, 0x1d, 0x40, 0x0d, 0x03, 0x02, 0x02, 0x06, 0x0b, 0x07, 0x7d, 0x0f, 0x0e, 0x0a,
-    0x0a, 0x06, 0x12, 0x00, 0x3f, 0x33, 0x10, 0xce, 0x33, 0x3f, 0x33, 0x12, 0x39, 0x2f, 0x33, 0x30,
-    0x31, 0x41, 0x15, 0x21, 0x35, 0x13, 0x11, 0x23, 0x11, 0x21, 0x11, 0x23, 0x11, 0x01, 0x11, 0x23,
-    0x11, 0x03, 0xb7, 0xfd, 0x6c, 0x44, 0xf1, 0x03, 0xf1, 0xf1, 0x01, 0xb2, 0xf1, 0x02, 0x9d, 0xc0,
-    0xc0, 0x01, 0xf0, 0xfb, 0x73, 0x04, 0x8d, 0xfb, 0x73, 0x04, 0x8d, 0xfc, 0x26, 0xfd, 0xe7, 0x02,
-    0x19, 0x00, 0x00, 0x02, 0x00, 0x4f, 0xfe, 0x40, 0x04, 0x43, 0x04, 0x9d, 0x00, 0x27, 0x00, 0x2b,
-    0x00, 0x18, 0x40, 0x0b, 0x19, 0x10, 0x7e, 0x28, 0x24, 0x24, 0x2a, 0x2a, 0x05, 0x0b, 0x72, 0x00,
-    0x2b, 0x32, 0x2f, 0x32, 0x11, 0x33, 0x3f, 0x33, 0x30, 0x31, 0x41, 0x33, 0x0e, 0x02, 0x23, 0x22,
-    0x2e, 0x02, 0x35, 0x35, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x16, 0x16, 0x17, 0x23, 0x2e, 0x02, 0x23,
-    0x22, 0x0e, 0x02, 0x15, 0x15, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x36, 0x36, 0x07, 0x11, 0x23, 0x11,
-    0x03, 0x50, 0xf2, 0x09, 0x79, 0xd8, 0x99, 0x77, 0xbd, 0x85, 0x47, 0x48, 0x88, 0xbd, 0x76, 0x9b,
-    0xd4, 0x76, 0x0c, 0xf1, 0x06, 0x36, 0x6c, 0x58, 0x44, 0x66, 0x45, 0x23, 0x1f, 0x42, 0x67, 0x47,
-    0x55, 0x6c, 0x3a, 0x84, 0xf1, 0x01, 0x84, 0x77, 0xb6, 0x67, 0x4e, 0x91, 0xcf, 0x81, 0x4e, 0x81,
-    0xcf, 0x93, 0x4d, 0x69, 0xba, 0x78, 0x41, 0x63, 0x38, 0x2f, 0x5e, 0x89, 0x5a, 0x4f, 0x58, 0x89,
-    0x5e, 0x31, 0x2f, 0x60, 0xe5, 0xfd, 0xe7, 0x02, 0x19, 0x00, 0xff, 0xff, 0x00, 0x06, 0x00, 0x00,
-    0x04, 0x38, 0x04, 0x8d, 0x06, 0x06, 0x01, 0xed, 0x00, 0x00, 0xff, 0xff, 0x00, 0x0e, 0xfe, 0x37,
-    0x05, 0xac, 0x04, 0xa4, 0x06, 0x26, 0x02, 0x31, 0x00, 0x00, 0x00, 0x07, 0x02, 0x6b, 0x02, 0xe6,
-    0xff, 0x9d, 0xff, 0xff, 0x00, 0x76, 0x00, 0x00, 0x04, 0x6d, 0x05, 0xcb, 0x06, 0x26, 0x02, 0x18,
-    0x00, 0x00, 0x01, 0x07, 0x00, 0x70, 0x00, 0x82, 0x00, 0x21, 0x00, 0x0b, 0xb6, 0x03, 0x0e, 0x08,
-    0x01, 0x01, 0xb0, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x1f, 0xff, 0xec, 0x04, 0x41,
-    0x05, 0xcb, 0x06, 0x26, 0x02, 0x1b, 0x00, 0x00, 0x01, 0x06, 0x00, 0x70, 0x4a, 0x21, 0x00, 0x0b,
-    0xb6, 0x02, 0x1a, 0x17, 0x01, 0x01, 0xb0, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x4f,
-    0x00, 0x00, 0x05, 0x57, 0x04, 0x8d, 0x06, 0x06, 0x02, 0x0b, 0x00, 0x00, 0xff, 0xff, 0x00, 0x86,
-    0xff, 0xf0, 0x05, 0x63, 0x04, 0x8d, 0x04, 0x26, 0x01, 0xfd, 0x00, 0x00, 0x00, 0x07, 0x01, 0xfc,
-    0x01, 0xfe, 0x00, 0x00, 0xff, 0xff, 0xff, 0xec, 0x00, 0x00, 0x06, 0x04, 0x06, 0x00, 0x06, 0x26,
-    0x02, 0x8e, 0x00, 0x00, 0x01, 0x07, 0x00, 0x75, 0x02, 0x81, 0x00, 0x00, 0x00, 0x0b, 0xb6, 0x06,
-    0x19, 0x0f, 0x01, 0x01, 0x4d, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x4e, 0xff, 0xc7,
-    0x04, 0x6e, 0x06, 0x1e, 0x06, 0x26, 0x02, 0x90, 0x00, 0x00, 0x01, 0x07, 0x00, 0x75, 0x01, 0x75,
-    0x00, 0x1e, 0x00, 0x0b, 0xb6, 0x03, 0x30, 0x11, 0x01, 0x01, 0x5b, 0x56, 0x00, 0x2b, 0x34, 0x00,
-    0xff, 0xff, 0x00, 0x3f, 0xfd, 0xfc, 0x03, 0xf0, 0x04, 0x9d, 0x06, 0x26, 0x01, 0xf3, 0x00, 0x00,
-    0x00, 0x07, 0x01, 0xd4, 0x01, 0x3f, 0xfe, 0x98, 0xff, 0xff, 0x00, 0x27, 0x00, 0x00, 0x05, 0xe5,
-    0x06, 0x1e, 0x06, 0x26, 0x01, 0xef, 0x00, 0x00, 0x01, 0x07, 0x00, 0x44, 0x01, 0x73, 0x00, 0x1e,
-    0x00, 0x0b, 0xb6, 0x04, 0x18, 0x0a, 0x01, 0x01, 0x6b, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff,
-    0x00, 0x27, 0x00, 0x00, 0x05, 0xe5, 0x06, 0x1e, 0x06, 0x26, 0x01, 0xef, 0x00, 0x00, 0x01, 0x07,
-    0x00, 0x75, 0x02, 0x19, 0x00, 0x1e, 0x00, 0x0b, 0xb6, 0x04, 0x16, 0x0a, 0x01, 0x01, 0x6b, 0x56,
-    0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x27, 0x00, 0x00, 0x05, 0xe5, 0x05, 0xeb, 0x06, 0x26,
-    0x01, 0xef, 0x00, 0x00, 0x01, 0x07, 0x00, 0x6a, 0x01, 0x3b, 0x00, 0x1e, 0x00, 0x0d, 0xb7, 0x05,
-    0x04, 0x1f, 0x0a, 0x01, 0x01, 0x84, 0x56, 0x00, 0x2b, 0x34, 0x34, 0x00, 0xff, 0xff, 0x00, 0x06,
-    0x00, 0x00, 0x04, 0x38, 0x06, 0x1e, 0x06, 0x26, 0x01, 0xed, 0x00, 0x00, 0x00, 0x07, 0x00, 0x44,
-    0x00, 0x8a, 0x00, 0x1e, 0xff, 0xff, 0x00, 0x11, 0xfe, 0x58, 0x05, 0x3f, 0x05, 0xb0, 0x06, 0x26,
-    0x00, 0x25, 0x00, 0x00, 0x01, 0x07, 0x00, 0xa4, 0x01, 0x80, 0x00, 0x03, 0x00, 0x0b, 0xb6, 0x03,
-    0x0e, 0x05, 0x01, 0x01, 0x39, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x56, 0xfe, 0x5c,
-    0x03, 0xf9, 0x04, 0x4e, 0x06, 0x26, 0x00, 0x45, 0x00, 0x00, 0x01, 0x07, 0x00, 0xa4, 0x00, 0xb4,
-    0x00, 0x08, 0x00, 0x0b, 0xb6, 0x02, 0x3b, 0x31, 0x00, 0x00, 0x4d, 0x56, 0x00, 0x2b, 0x34, 0x00,
-    0xff, 0xff, 0x00, 0x94, 0xfe, 0x5e, 0x04, 0x4d, 0x05, 0xb0, 0x06, 0x26, 0x00, 0x29, 0x00, 0x00,
-    0x01, 0x07, 0x00, 0xa4, 0x01, 0x42, 0x00, 0x0a, 0x00, 0x0b, 0xb6, 0x04, 0x10, 0x02, 0x00, 0x00,
-    0x43, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x51, 0xfe, 0x54, 0x04, 0x0a, 0x04, 0x4e,
-    0x06, 0x26, 0x00, 0x49, 0x00, 0x00, 0x01, 0x07, 0x00, 0xa4, 0x01, 0x05, 0x00, 0x00, 0x00, 0x0b,
-    0xb6, 0x01, 0x2c, 0x00, 0x00, 0x00, 0x4d, 0x56, 0x00, 0x2b, 0x34, 0x00, 0xff, 0xff, 0x00, 0x08,
-    0xfe, 0x54, 0x04, 0x91, 0x04, 0x8d, 0x06, 0x26, 0x02, 0x4d, 0x00, 0x00, 0x00, 0x07, 0x00, 0xa4,
-    0x01, 0x22, 0x00, 0x00, 0xff, 0xff, 0x00, 0x76, 0xfe, 0x5c, 0x03, 0xb6, 0x04, 0x8d, 0x06, 0x26,
-    0x02, 0x42, 0x00, 0x00, 0x00, 0x07, 0x00, 0xa4, 0x00, 0xf1, 0x00, 0x08, 0xff, 0xff, 0x00, 0x78,
-    0xfe, 0xa1, 0x01, 0x8c, 0x04, 0x3a, 0x06, 0x26, 0x00, 0x8d, 0x00, 0x00, 0x01, 0x07, 0x00, 0xad,
-    0x03, 0x5a, 0x00, 0x0a, 0x00, 0x0e, 0xb4, 0x01, 0x07, 0x02, 0x01, 0x01, 0xb8, 0xff, 0x7f, 0xb0,
-    0x56, 0x00, 0x2b, 0x34
+    0x8d, 0x7a, 0x07, 0x60, 0x54, 0xc5, 0xd6, 0xff, 0xcc, 0xdc, 0xbb, 0xbb, 0x24, 0x40, 0xc8, 0x26,
+    0xd9, 0x44, 0x20, 0x85, 0xb0, 0xa9, 0xa4, 0x92, 0xcd, 0xee, 0x66, 0x53, 0x77, 0xd3, 0xcb, 0xa6,
+    0xf7, 0x9e, 0x4d, 0x6f, 0xa4, 0x90, 0x4a, 0x0d, 0x09, 0x25, 0x05, 0x22, 0x02, 0x41, 0x14, 0x42,
+    0x51, 0x01, 0x29, 0xf2, 0xc8, 0x27, 0x55, 0x8a, 0x22, 0xa2, 0x28, 0xf2, 0xf0, 0x29, 0xea, 0x13,
+    0xe5, 0x21, 0x4f, 0x7d, 0x7e, 0xfa, 0x50, 0x1f, 0x41, 0x2c, 0x24, 0xd9, 0x9b, 0xff, 0x99, 0xbb,
+    0x1b, 0x8c, 0xef, 0x7b, 0xdf, 0xff, 0x73, 0x93, 0xb9, 0x77, 0xee, 0xdc, 0x99, 0x33, 0xe7, 0x9c,
+    0x39, 0xe7, 0x37, 0x67, 0x66, 0x2e, 0xc2, 0x08, 0xa1, 0x39, 0x68, 0x0d, 0x62, 0x50, 0x53, 0x4c,
+    0x64, 0x54, 0x34, 0x1a, 0x44, 0x5d, 0x08, 0x79, 0x0c, 0x43, 0xa9, 0x6d, 0x4c, 0x4a, 0x72, 0x7a,
+    0x64, 0xbb, 0xb6, 0x0d, 0x9e, 0xcf, 0xc2, 0xf3, 0x82, 0x98, 0xf4, 0xcc, 0xf0, 0x6d, 0x92, 0x1e,
+    0x6b, 0x78, 0xfe, 0x04, 0x9e, 0x15, 0xc9, 0xe9, 0x3e, 0x7e, 0x4b, 0xff, 0xd5, 0xe3, 0x80, 0x10,
+    0xee, 0x84, 0xe7, 0x92, 0xf4, 0x0c, 0x4d, 0x46, 0xd1, 0xaf, 0xea, 0x5b, 0x08, 0x79, 0x9a, 0xc3,
+    0x73, 0x5e, 0xd9, 0x12, 0x5d, 0x93, 0x7a, 0xec, 0x2e, 0x3c, 0x33, 0xeb, 0xe0, 0x39, 0xb8, 0x4a,
+    0xd7, 0xd2, 0x84, 0x66, 0xa0, 0xb9, 0xd0, 0xfe, 0x29, 0x78, 0x9e, 0x55, 0x55, 0xbf, 0xac, 0xf2,
+    0xeb, 0xb7, 0xd7, 0x87, 0x23, 0xc4, 0xbe, 0x84, 0x90, 0x8b, 0x75, 0x75, 0x85, 0xae, 0x7c, 0xd6,
+    0x86, 0xe2, 0x13, 0xf0, 0x6e, 0x82, 0xd2, 0xaf, 0x86, 0x02, 0x33, 0x24, 0x18, 0x04, 0xfa, 0xfe,
+    0xf0, 0xec, 0x54, 0xbd, 0xa4, 0xb5, 0x73, 0xcb, 0x23, 0x69, 0x0c, 0x3c, 0x43, 0xff, 0xf8, 0x48,
+    0x7d, 0x63, 0x99, 0x2e, 0x2a, 0x22, 0x38, 0x1d, 0xe8, 0x5f, 0x82, 0xf7, 0xff, 0x5c, 0xa2, 0xeb,
+    0x6c, 0x42, 0xdd, 0xe8, 0x30, 0xbc, 0xcb, 0xa1, 0xfc, 0x36, 0xe8, 0x96, 0x54, 0xcc, 0xf9, 0xc4,
+    0xe9, 0x1b, 0x84, 0x16, 0x5d, 0x81, 0xe7, 0x97, 0x9a, 0x1a, 0x5b, 0x5a, 0x27, 0x97, 0xa0, 0x72,
+    0xe8, 0xbf, 0x89, 0xbe, 0x47, 0x54, 0x76, 0x86, 0x24, 0x35, 0xc4, 0xdf, 0x12, 0x16, 0xcf, 0x09,
+    0xfe, 0x09, 0xcd, 0x9f, 0x81, 0xe8, 0xef, 0xca, 0x7d, 0xb1, 0x37, 0xbd, 0xff, 0xfd, 0x43, 0xd2,
+    0x38, 0x79, 0x94, 0x5b, 0x2c, 0xfc, 0x5a, 0xf8, 0x2c, 0x3c, 0x9a, 0x20, 0x82, 0x0c, 0x3f, 0x68,
+    0x27, 0xaa, 0xe7, 0x66, 0xc1, 0xd5, 0x6b, 0xf2, 0xe8, 0xe4, 0x03, 0xe1, 0xd7, 0x3c, 0xa5, 0xe9,
+    0x3f, 0x1d, 0x5f, 0xd2, 0x8a, 0x6a, 0x90, 0x10, 0x85, 0x22, 0xf6, 0xdf, 0xde, 0x13, 0x78, 0x66,
+    0xd9, 0x2d, 0xf8, 0x21, 0x12, 0x20, 0x24, 0xd8, 0x29, 0x90, 0x01, 0x49, 0x07, 0xc3, 0x9d, 0x79,
+    0x1f, 0x55, 0x12, 0xbe, 0xca, 0xb4, 0x1f, 0x36, 0x26, 0xfe, 0x17, 0x93, 0x9c, 0x1c, 0x83, 0xd4,
+    0x68, 0xc1, 0x82, 0x7e, 0x21, 0xe2, 0x10, 0xaa, 0x14, 0xed, 0x24, 0x53, 0x75, 0x10, 0x1b, 0x28,
+    0x18, 0xe1, 0x25, 0x63, 0x98, 0x4d, 0xa8, 0x1c, 0xeb, 0x81, 0x8e, 0x3d, 0xda, 0x44, 0x9e, 0x44,
+    0x25, 0xec, 0x4d, 0x94, 0xc5, 0x42, 0x99, 0xe0, 0x2b, 0x48, 0x8e, 0x28, 0x13, 0x67, 0xa3, 0x34,
+    0xf2, 0x26, 0xea, 0x26, 0xd7, 0x91, 0x2b, 0xd4, 0xb5, 0x65, 0x9b, 0x51, 0x38, 0xbe, 0x86, 0x16,
+    0x92, 0xb3, 0x28, 0x85, 0xa8, 0xd0, 0x06, 0xc6, 0x01, 0x61, 0xa8, 0x5f, 0x0d, 0xe9, 0x08, 0xa4,
+    0x34, 0x48, 0x49, 0x90, 0x94, 0x90, 0xba, 0x20, 0xb5, 0x40, 0x8a, 0x84, 0x54, 0x05, 0xa9, 0x90,
+    0xd8, 0xa2, 0x2e, 0x7c, 0x0f, 0xc9, 0x58, 0x0b, 0x14, 0xca, 0xae, 0x41, 0x9b, 0x59, 0x37, 0xb4,
+    0x9a, 0xf9, 0x0a, 0x05, 0x89, 0xbc, 0x50, 0xbe, 0x20, 0x09, 0x89, 0x05, 0xb3, 0xd1, 0x90, 0x40,
+    0x85, 0x2a, 0x21, 0x0d, 0xb1, 0xeb, 0x21, 0x55, 0xc3, 0x73, 0x0b, 0xaa, 0x13, 0x1c, 0x43, 0x43,
+    0x24, 0x12, 0x1d, 0x60, 0x97, 0x22, 0x1f, 0x81, 0x19, 0x94, 0xa7, 0xa1, 0x21, 0xe1, 0x24, 0xbc,
+    0x83, 0x72, 0xc1, 0x5a, 0x54, 0x21, 0x98, 0xcf, 0xdf, 0x4b, 0x04, 0x26, 0xf0, 0xee, 0x13, 0x94,
+    0xc0, 0xde, 0x45, 0x5e, 0x82, 0x60, 0xb4, 0x46, 0xb0, 0x08, 0x89, 0x45, 0x33, 0xa1, 0xcd, 0x6c,
+    0xe4, 0xc2, 0x7e, 0x89, 0x66, 0x80, 0x6c, 0x29, 0xc4, 0x13, 0xad, 0x67, 0x32, 0x91, 0x05, 0xdc,
+    0x67, 0x32, 0x0d, 0x48, 0xc1, 0x6c, 0x47, 0x84, 0x3c, 0x85, 0x02, 0xd8, 0x14, 0x90, 0xbb, 0x0b,
+    0xad, 0x62, 0xbd, 0x80, 0xff, 0x1e, 0x94, 0xc2, 0xc6, 0xa1, 0x54, 0x72, 0x13, 0x79, 0xb0, 0xfd,
+    0x20, 0xd3, 0x52, 0xb4, 0x9c, 0x98, 0xa2, 0x95, 0x84, 0x4c, 0x1e, 0x65, 0x3d, 0xd1, 0x2a, 0xc8,
+    0x6f, 0x12, 0xfe, 0x8a, 0x56, 0xb2, 0xad, 0x68, 0x39, 0x3b, 0x00, 0xf5, 0x69, 0xbb, 0x5e, 0xa0,
+    0xfd, 0x21, 0xdc, 0xed, 0x51, 0x1c, 0x39, 0x82, 0x4c, 0xd9, 0x16, 0xd4, 0xc1, 0xfc, 0x8a, 0xac,
+    0x05, 0xf7, 0x91, 0x94, 0x15, 0x22, 0x07, 0xe6, 0x1e, 0x9a, 0x05, 0xf7, 0x54, 0x72, 0x14, 0x05,
+    0x80, 0xbe, 0x8f, 0xc3, 0xdd, 0x56, 0x90, 0x88, 0xda, 0xc8, 0x4f, 0x48, 0x8b, 0x7a, 0x50, 0x08,
+    0x52, 0x22, 0x05, 0x4a, 0x41, 0x49, 0x70, 0x4f, 0x40, 0x31, 0xf0, 0xdc, 0x03, 0xe5, 0xbf, 0x2f,
+    0x43, 0xc6, 0xe1, 0x66, 0x20, 0x59, 0xc1, 0x15, 0xf3, 0x77, 0x16, 0xb9, 0xc1, 0x5d, 0xc8, 0xdb,
+    0x0e, 0x41, 0xab, 0x17, 0xf4, 0x4f, 0x4e, 0xd2, 0x91, 0x5d, 0xb0, 0x66, 0x72, 0x72, 0xf2, 0xef,
+    0x9f, 0xdf, 0x9d, 0x66, 0x51, 0x7e, 0xf0, 0x97, 0x8a, 0x6a, 0xd1, 0x66, 0xf4, 0x2d, 0xce, 0xc1,
+    0xe7, 0xf0, 0xbb, 0xf8, 0x17, 0x22, 0x25, 0xd1, 0x24, 0x9f, 0x34, 0x93, 0xd5, 0x64, 0x88, 0xec,
+    0x27, 0xdf, 0x90, 0x71, 0xc6, 0x8b, 0xe9, 0x62, 0x86, 0x99, 0x4f, 0x59, 0x17, 0x56, 0xc5, 0x3e,
+    0xc3, 0x7e, 0xc5, 0xde, 0x67, 0x27, 0x04, 0xd6, 0x82, 0x45, 0x82, 0x28, 0x41, 0x9f, 0xd0, 0x5e,
+    0xa8, 0x11, 0x6e, 0x12, 0xbe, 0x29, 0xfc, 0x59, 0xf4, 0x84, 0xc8, 0x5f, 0xd4, 0x26, 0x7a, 0x4a,
+    0xb4, 0x47, 0x74, 0x49, 0xf4, 0x0f, 0xd1, 0xa3, 0x19, 0xf6, 0x33, 0x14, 0x33, 0x3a, 0x67, 0xec,
+    0x9b, 0xf1, 0x9d, 0xc9, 0x02, 0x93, 0x26, 0x93, 0x75, 0x26, 0x87, 0x4c, 0xde, 0x34, 0x79, 0x64,
+    0x3a, 0xdf, 0xd4, 0xdf, 0x34, 0xcd, 0xb4, 0xdc, 0xb4, 0xc5, 0x74, 0xbd, 0xe9, 0x5e, 0xd3, 0xa3,
+    0xa6, 0xe7, 0x66, 0x9a, 0xcd, 0xcc, 0x98, 0x39, 0x38, 0xf3, 0xe6, 0x2c, 0xf1, 0x2c, 0xc5, 0xac,
+    0x2d, 0xb3, 0x2e, 0xce, 0xfa, 0x6c, 0xb6, 0xe9, 0x6c, 0x9f, 0xd9, 0x21, 0xb3, 0xfb, 0x67, 0x9f,
+    0x9e, 0xfd, 0xd0, 0x2c, 0xc8, 0xac, 0xc7, 0xec, 0x88, 0xd9, 0xcf, 0x73, 0x6c, 0xe7, 0xc4, 0xcd,
+    0x29, 0x9f, 0x33, 0x34, 0xe7, 0xe4, 0x9c, 0xaf, 0xcc, 0x89, 0x79, 0x90, 0x79, 0x9c, 0xf9, 0x5a,
+    0xf3, 0x93, 0xe6, 0x17, 0xcd, 0xdf, 0x32, 0x7f, 0xcf, 0xfc, 0x13, 0xf3, 0xbf, 0x9b, 0xff, 0xd3,
+    0xfc, 0x47, 0xf3, 0x09, 0xb1, 0x40, 0x6c, 0x26, 0x0e, 0x12, 0x27, 0x8a, 0xd7, 0x89, 0xaf, 0x8b,
+    0xbf, 0xb1, 0xb0, 0xb5, 0x28, 0xb4, 0x68, 0xb2, 0xb8, 0x66, 0x39, 0x93, 0xd7, 0x06, 0xf8, 0x2e,
+    0xe3, 0x06, 0x36, 0xce, 0x20, 0x11, 0x9a, 0x09, 0xb8, 0x65, 0x89, 0x6c, 0x10, 0xd2, 0x48, 0x1c,
+    0xe5, 0x32, 0xb1, 0x54, 0xec, 0x08, 0xc9, 0x12, 0xf2, 0x18, 0x4b, 0xb1, 0x18, 0xcb, 0x30, 0x63,
+    0xa2, 0x6f, 0x9f, 0xaf, 0x20, 0x57, 0x14, 0x36, 0xfa, 0x76, 0x32, 0xa0, 0x3f, 0x1e, 0x48, 0x52,
+    0xf9, 0x8b, 0x60, 0x44, 0xa1, 0x18, 0x4b, 0x11, 0x8c, 0xf0, 0x69, 0x83, 0x42, 0x21, 0x28, 0x18,
+    0xdb, 0x24, 0x68, 0x35, 0x24, 0xd0, 0xf5, 0xa6, 0xc9, 0x07, 0x78, 0x1f, 0xdf, 0xc7, 0x1c, 0xa0,
+    0xcd, 0x48, 0x19, 0xc6, 0x5f, 0x21, 0xf3, 0xb3, 0x96, 0x58, 0x09, 0xa5, 0x0b, 0x5d, 0xf0, 0xd6,
+    0x27, 0x6e, 0xcc, 0x15, 0xc5, 0x69, 0xd4, 0xf1, 0xf1, 0x6a, 0x4d, 0x9c, 0x60, 0x64, 0x5c, 0xcf,
+    0x32, 0x63, 0x97, 0x95, 0x09, 0x09, 0x4a, 0x79, 0x42, 0x02, 0x1d, 0xc7, 0x12, 0xe6, 0x57, 0x12,
+    0x28, 0x04, 0xb7, 0x06, 0xfe, 0x80, 0x33, 0x46, 0x2a, 0x96, 0x3b, 0xf2, 0x57, 0x6c, 0x26, 0xdd,
+    0x88, 0x3f, 0x95, 0x6e, 0x14, 0xa2, 0x7e, 0xae, 0x1b, 0xb7, 0x0e, 0xd1, 0xeb, 0xca, 0x4d, 0x30,
+    0xbe, 0x59, 0xe0, 0xb7, 0x2f, 0x4f, 0x93, 0x09, 0xb5, 0x00, 0xef, 0xf4, 0x0f, 0x3b, 0xca, 0x1d,
+    0x19, 0x48, 0x0f, 0xf1, 0xac, 0xfd, 0xdc, 0xc3, 0x2f, 0xf8, 0x2b, 0x1e, 0x1a, 0xbf, 0xcf, 0x9a,
+    0x27, 0x8c, 0xff, 0x8b, 0x15, 0x1b, 0x05, 0x48, 0x61, 0xda, 0x76, 0xe9, 0x07, 0x76, 0x51, 0xfb,
+    0x29, 0x9f, 0xf4, 0x64, 0x5d, 0x01, 0xab, 0x28, 0xa5, 0x10, 0xe8, 0x9d, 0xea, 0x03, 0x12, 0xf6,
+    0x77, 0x71, 0x71, 0xf5, 0x26, 0x72, 0x7f, 0x05, 0xc8, 0x61, 0x4f, 0x24, 0x52, 0x7f, 0x6f, 0x22,
+    0x5d, 0x28, 0x14, 0x4a, 0xac, 0xac, 0xad, 0x6d, 0xe0, 0xd9, 0x4a, 0x08, 0x92, 0xc1, 0x7b, 0x99,
+    0x95, 0x3d, 0x91, 0xf9, 0x29, 0x14, 0xe4, 0xbf, 0x76, 0xf6, 0x3e, 0x8b, 0x7d, 0x7d, 0x6a, 0x73,
+    0xd7, 0xbc, 0x56, 0xd3, 0x7c, 0xad, 0xb7, 0xfa, 0xc5, 0xf6, 0xb0, 0xfb, 0x76, 0x01, 0xc9, 0x7e,
+    0x31, 0x05, 0x1e, 0x9e, 0x75, 0x45, 0xdd, 0x17, 0xab, 0x3a, 0x3e, 0x1a, 0xcc, 0x3d, 0xfe, 0x64,
+    0xc6, 0x83, 0x45, 0xb1, 0xb9, 0x5e, 0x09, 0x55, 0x72, 0xe1, 0xb3, 0xdc, 0x47, 0xd8, 0xe3, 0xd1,
+    0x5e, 0x60, 0x6f, 0x16, 0x8e, 0x08, 0xcc, 0x8e, 0x71, 0xf0, 0x6a, 0x7e, 0x71, 0xd5, 0x8a, 0x93,
+    0xa5, 0xa1, 0x9d, 0xc7, 0x9b, 0xd5, 0x15, 0x31, 0x2e, 0xf2, 0x82, 0x20, 0x55, 0x56, 0x94, 0xd4,
+    0xbb, 0xf9, 0xc0, 0xaa, 0xee, 0x93, 0x85, 0x3e, 0xf5, 0x27, 0x7a, 0x92, 0xaa, 0x83, 0xe7, 0xc9,
+    0x0a, 0x41, 0x4b, 0xe5, 0x93, 0xf7, 0x04, 0x03, 0x82, 0x37, 0x91, 0x18, 0x49, 0x91, 0x1c, 0xbc,
+    0x01, 0x94, 0x98, 0x6e, 0xe0, 0xd4, 0xda, 0x5a, 0x62, 0x60, 0xcd, 0xc5, 0x45, 0x49, 0x59, 0xa5,
+    0xac, 0xc9, 0xe5, 0x20, 0x0b, 0xe5, 0x1d, 0xff, 0x81, 0x3a, 0x96, 0xd8, 0x15, 0x97, 0xc7, 0x0e,
+    0xe8, 0xca, 0xfb, 0x63, 0x63, 0xfa, 0xcb, 0x4a, 0x37, 0xc6, 0xbe, 0xe8, 0xa0, 0xf6, 0xf1, 0x0d,
+    0xb1, 0x77, 0x08, 0xf5, 0xf5, 0x0e, 0x73, 0x20, 0x36, 0x71, 0xf4, 0x55, 0x4c, 0x4c, 0x1f, 0xbc,
+    0x8a, 0x3b, 0xe4, 0xa8, 0xf6, 0x92, 0x85, 0xce, 0x77, 0x08, 0xf3, 0xf5, 0x09, 0x75, 0x78, 0x5b,
+    0xaf, 0x5a, 0x41, 0xae, 0xb2, 0x09, 0x89, 0xe9, 0x7d, 0x69, 0x69, 0x7d, 0xe9, 0x89, 0xa9, 0xf4,
+    0xb6, 0x27, 0xd1, 0x2d, 0xd6, 0xd3, 0x33, 0xd6, 0x2d, 0xd1, 0x3d, 0xce, 0xd3, 0x33, 0x6e, 0x22,
+    0x2b, 0x29, 0x8d, 0x96, 0xa6, 0x19, 0x6e, 0xfb, 0x92, 0xdc, 0x62, 0xbd, 0xbc, 0x62, 0xdc, 0x93,
+    0xdc, 0x69, 0x1d, 0x26, 0x6d, 0xfc, 0xc9, 0x18, 0x40, 0x17, 0x8c, 0x32, 0x27, 0xbf, 0x13, 0x98,
+    0x0b, 0xae, 0x20, 0x98, 0xe3, 0x34, 0x4a, 0x60, 0xcd, 0xdf, 0xe5, 0xb1, 0xe2, 0xb1, 0x23, 0x9e,
+    0x1a, 0x13, 0x6b, 0x6a, 0x5c, 0x42, 0x91, 0xc0, 0x8c, 0x18, 0x64, 0x08, 0xa5, 0x63, 0x01, 0x05,
+    0xfc, 0x3f, 0x95, 0x8d, 0x56, 0xc3, 0x6d, 0xe3, 0x61, 0x8a, 0x94, 0x38, 0x59, 0xb4, 0xd4, 0x3b,
+    0xc5, 0x8f, 0x8c, 0x70, 0xdf, 0xea, 0x6f, 0xc4, 0x35, 0x85, 0x16, 0xbd, 0xd4, 0xd2, 0xf8, 0x5c,
+    0xb6, 0x5f, 0x4e, 0x20, 0xf7, 0x9e, 0x5c, 0x66, 0xae, 0xac, 0x4b, 0x4c, 0x1f, 0x5e, 0x19, 0xf7,
+    0x17, 0xf7, 0xdc, 0x58, 0x91, 0x78, 0x46, 0xd6, 0x47, 0x9d, 0x5b, 0x3e, 0x6c, 0x89, 0xef, 0x66,
+    0x9e, 0x38, 0xbc, 0x28, 0x35, 0xc4, 0x3f, 0xc7, 0x27, 0xd1, 0xc7, 0xab, 0xb8, 0x2a, 0x68, 0xe2,
+    0x43, 0xb2, 0x3d, 0x67, 0xdb, 0xc6, 0xf8, 0xa5, 0xfb, 0x73, 0x73, 0xb7, 0x66, 0x47, 0x2d, 0x2d,
+    0x5a, 0x74, 0xc7, 0x23, 0x39, 0x7c, 0xae, 0xba, 0x3a, 0x24, 0x61, 0xe0, 0x52, 0x5b, 0xed, 0xab,
+    0xcf, 0xab, 0x45, 0x12, 0x51, 0x72, 0x62, 0xed, 0xb9, 0xce, 0xdc, 0xde, 0x36, 0x90, 0x21, 0x8d,
+    0xe1, 0xb0, 0x09, 0x6f, 0xd1, 0xbc, 0x3d, 0x5b, 0xca, 0xb1, 0xc9, 0xbc, 0xdd, 0x58, 0x88, 0xba,
+    0xb9, 0x2e, 0xdc, 0xbc, 0x85, 0xce, 0x3c, 0xdd, 0xdc, 0x62, 0xb2, 0x47, 0x58, 0x48, 0x7d, 0x11,
+    0xc6, 0xce, 0xc2, 0x42, 0xa1, 0xb4, 0x31, 0x23, 0x04, 0x46, 0xc6, 0x02, 0xe4, 0x14, 0xb9, 0xb8,
+    0x10, 0xd2, 0x5d, 0xf8, 0xf4, 0xd1, 0x64, 0xdf, 0xc0, 0x96, 0x62, 0x95, 0xaa, 0xb8, 0x25, 0xd0,
+    0x37, 0xf9, 0xe8, 0xd3, 0x85, 0x24, 0x4c, 0xfc, 0x31, 0x2e, 0xc4, 0xa2, 0x63, 0x2e, 0x03, 0x1e,
+    0xcf, 0xfc, 0x8d, 0xbb, 0x75, 0x4e, 0x72, 0x8e, 0xbb, 0x75, 0x67, 0x97, 0xf7, 0x3a, 0xd7, 0x63,
+    0x58, 0x84, 0x0b, 0x29, 0x5d, 0x57, 0xa0, 0x9b, 0x68, 0xa0, 0xab, 0x91, 0x58, 0x11, 0x22, 0x14,
+    0xb9, 0x86, 0x12, 0x0b, 0x18, 0x5f, 0x02, 0x06, 0xad, 0xb4, 0xb6, 0xb6, 0xb0, 0x20, 0x89, 0xc5,
+    0x3b, 0x8e, 0xa7, 0x2c, 0xa6, 0x84, 0x83, 0x4a, 0x97, 0x2a, 0x16, 0xa7, 0x1c, 0xdf, 0x51, 0x4c,
+    0x52, 0xc4, 0x37, 0xb9, 0xfd, 0xdc, 0xaf, 0x23, 0xae, 0xeb, 0x3c, 0x9f, 0xfd, 0x3b, 0x76, 0x03,
+    0xc2, 0xd8, 0xfd, 0xf3, 0x9d, 0x1e, 0xeb, 0x5c, 0x46, 0xb8, 0x5f, 0xb8, 0xfd, 0x40, 0xd7, 0x96,
+    0xa4, 0x30, 0xcb, 0x04, 0xff, 0x85, 0xcc, 0x80, 0x5f, 0x4b, 0x67, 0xa5, 0x80, 0x91, 0x31, 0xce,
+    0x36, 0x02, 0x4b, 0x11, 0xc3, 0xac, 0xf9, 0x80, 0xbb, 0x26, 0xc7, 0xfe, 0x66, 0x7f, 0x32, 0xc7,
+    0x3e, 0x72, 0xee, 0xca, 0x9f, 0x07, 0x5f, 0x39, 0x4d, 0xce, 0x63, 0xcb, 0xbc, 0xfd, 0xed, 0x38,
+    0x9f, 0xdb, 0xd3, 0xfe, 0x62, 0x3e, 0xf7, 0x63, 0x25, 0x5e, 0xc8, 0x7d, 0x4d, 0x3d, 0x3d, 0x1c,
+    0x6d, 0x65, 0xdd, 0xd8, 0xd3, 0xbc, 0xb7, 0xf1, 0x18, 0x84, 0xc1, 0xd7, 0x58, 0xb7, 0x89, 0x79,
+    0xa4, 0xfa, 0x5b, 0xc6, 0xfe, 0xd6, 0x2d, 0xfc, 0xcc, 0xf8, 0x6d, 0xd6, 0x89, 0xca, 0xb1, 0x90,
+    0x3b, 0x8b, 0x8b, 0xd0, 0x37, 0xc8, 0x14, 0xa1, 0x0a, 0x91, 0x15, 0x2f, 0x85, 0x5c, 0x8e, 0x8b,
+    0x70, 0x65, 0x46, 0xb7, 0xad, 0xb7, 0xed, 0x37, 0x2f, 0x55, 0x7e, 0x12, 0x9d, 0xe0, 0x55, 0x50,
+    0x1d, 0x76, 0x0a, 0xea, 0xa6, 0x10, 0x33, 0xa2, 0x23, 0x37, 0xe8, 0x6c, 0x40, 0x69, 0x12, 0x9d,
+    0xfe, 0x5f, 0xe4, 0xc6, 0xa5, 0x4b, 0xf0, 0x66, 0xc3, 0xe4, 0x43, 0xbc, 0x0f, 0xe9, 0x29, 0xae,
+    0x74, 0x4c, 0x43, 0xa4, 0x0d, 0x5a, 0x4d, 0x78, 0x42, 0x42, 0xb8, 0x46, 0xdb, 0x19, 0x90, 0x98,
+    0x18, 0x10, 0xa0, 0xd5, 0xd2, 0x1e, 0xf1, 0xe4, 0x5a, 0xf2, 0x13, 0x8f, 0x29, 0x48, 0x03, 0x68,
+    0x48, 0x7e, 0xd2, 0xbf, 0x73, 0x91, 0x04, 0x08, 0x46, 0x1e, 0xdd, 0x14, 0x7a, 0x51, 0xde, 0xab,
+    0x27, 0xbf, 0x63, 0xa5, 0x60, 0x97, 0x36, 0xc8, 0x87, 0xd7, 0xad, 0x19, 0x00, 0x82, 0x37, 0x03,
+    0x9a, 0x0d, 0x05, 0x04, 0xb0, 0x67, 0x18, 0xb1, 0xbf, 0x37, 0x23, 0x5d, 0x08, 0xf6, 0x28, 0xb6,
+    0xb2, 0x67, 0xa8, 0x41, 0xb2, 0xd2, 0x88, 0xd5, 0xc7, 0xeb, 0xb3, 0xb6, 0xb5, 0xa7, 0x7b, 0x45,
+    0x42, 0x26, 0x7b, 0x5b, 0x5b, 0xba, 0xe7, 0xa8, 0x95, 0x6b, 0x60, 0xbc, 0x77, 0x40, 0x4e, 0xb0,
+    0x83, 0x95, 0x9b, 0x2a, 0xc1, 0x4b, 0x95, 0x13, 0x6c, 0xcf, 0xa4, 0xfd, 0x70, 0x74, 0xf4, 0xe9,
+    0x68, 0xcf, 0xa2, 0xed, 0x7f, 0xe9, 0xff, 0xe1, 0xa5, 0xef, 0xb7, 0x47, 0x7a, 0x14, 0x6c, 0x7b,
+    0x8f, 0xab, 0xc2, 0xfe, 0xd9, 0xeb, 0x0b, 0x83, 0xe6, 0x7b, 0x14, 0x3d, 0xbb, 0x84, 0xbb, 0x9e,
+    0xb3, 0xa1, 0x38, 0xc4, 0xd6, 0x53, 0x37, 0x4c, 0xf9, 0x3c, 0x42, 0x61, 0x4b, 0x70, 0x0a, 0x90,
+    0x9d, 0x47, 0x2b, 0x81, 0xdc, 0x99, 0x41, 0xa3, 0xdc, 0x2e, 0xa2, 0x12, 0x9c, 0x1a, 0x4b, 0x60,
+    0x77, 0x2c, 0xbb, 0xfa, 0x17, 0x5a, 0x2b, 0x0d, 0x10, 0x32, 0x14, 0xb8, 0x85, 0x48, 0xb3, 0x82,
+    0xea, 0x19, 0xd4, 0x67, 0x74, 0x71, 0xc0, 0xb2, 0x29, 0x07, 0x32, 0x23, 0x22, 0xcc, 0x86, 0x4e,
+    0xf8, 0xe2, 0x4f, 0x93, 0xf2, 0x9c, 0x65, 0xa5, 0xd1, 0xa9, 0x0d, 0x01, 0xa3, 0xad, 0xb7, 0x77,
+    0x6d, 0xbd, 0x5e, 0xe7, 0x99, 0xda, 0x10, 0xce, 0xbd, 0x79, 0xe9, 0xd2, 0x01, 0x22, 0xc8, 0x59,
+    0x53, 0xb5, 0x38, 0xaa, 0x26, 0x24, 0x7a, 0x45, 0x72, 0xd7, 0xcd, 0x55, 0xa5, 0x27, 0x57, 0x44,
+    0x6e, 0x58, 0xbf, 0x3e, 0x92, 0x3b, 0x00, 0x1a, 0x49, 0x02, 0x8d, 0xcc, 0x83, 0x3e, 0x6c, 0x51,
+    0x10, 0xf0, 0xc2, 0xe3, 0xc8, 0x7f, 0xea, 0x43, 0x2a, 0x95, 0xc8, 0x79, 0x10, 0x35, 0xa8, 0x8c,
+    0x3a, 0xaa, 0x11, 0x75, 0x68, 0x6d, 0xdc, 0xff, 0x54, 0x46, 0xa3, 0x62, 0x71, 0x99, 0x56, 0x5d,
+    0x15, 0xfc, 0x60, 0xf9, 0xcd, 0x75, 0x83, 0x37, 0xdb, 0x03, 0x97, 0x1e, 0x69, 0x3a, 0x75, 0x6a,
+    0xcd, 0xa9, 0xa5, 0xf2, 0xb8, 0x0d, 0x27, 0x6a, 0x8a, 0x5e, 0xea, 0x4b, 0x1e, 0x0d, 0x69, 0x8c,
+    0xd5, 0x36, 0x04, 0x85, 0x2f, 0x4f, 0x67, 0xa2, 0x02, 0x2b, 0xc3, 0xa3, 0xca, 0x14, 0xb2, 0x42,
+    0x75, 0xeb, 0xc9, 0xaa, 0xc2, 0xb3, 0x7d, 0xa1, 0x6b, 0x6a, 0x34, 0x8a, 0x75, 0xc1, 0x35, 0x1b,
+    0x12, 0x2a, 0xf7, 0x36, 0x04, 0xf8, 0x57, 0xed, 0xaa, 0xd4, 0x94, 0x05, 0x28, 0x6a, 0x13, 0x32,
+    0x6b, 0x65, 0x74, 0xd4, 0x94, 0xa0, 0x87, 0x5c, 0x18, 0x55, 0x91, 0x61, 0x6e, 0x71, 0x74, 0xc5,
+    0x32, 0x06, 0xf3, 0x56, 0x97, 0x3b, 0xfe, 0xf5, 0x0c, 0xd2, 0xfa, 0xfa, 0xfb, 0xdc, 0x0e, 0xd2,
+    0x3c, 0x4a, 0x44, 0x97, 0xb6, 0x30, 0x9f, 0x70, 0x3b, 0xf5, 0x17, 0x99, 0xc3, 0x74, 0x8a, 0x00,
+    0x0d, 0x76, 0x81, 0x74, 0x2a, 0xc8, 0xb9, 0x43, 0x3b, 0x57, 0x4b, 0x47, 0x89, 0x23, 0x63, 0x9c,
+    0x0b, 0x8c, 0x62, 0xb8, 0xca, 0x28, 0xf4, 0x53, 0xbd, 0xf2, 0x53, 0x03, 0xae, 0xbb, 0x94, 0xcc,
+    0x88, 0xf5, 0x67, 0xdc, 0x16, 0x76, 0x26, 0x56, 0xbd, 0xb0, 0x34, 0x38, 0xa8, 0xfd, 0xc4, 0xf2,
+    0xfc, 0x17, 0xd7, 0xa5, 0x08, 0xbf, 0x33, 0x09, 0xa9, 0x8c, 0x08, 0xc9, 0x09, 0xb2, 0x73, 0xd4,
+    0x94, 0xaa, 0xb3, 0xf2, 0xc9, 0x01, 0x1f, 0x72, 0xfb, 0x3a, 0xb7, 0xcb, 0xca, 0x35, 0xa2, 0xeb,
+    0x54, 0x73, 0xc5, 0xc8, 0x86, 0x04, 0x79, 0xcd, 0xae, 0x8a, 0x98, 0x32, 0x7f, 0x8f, 0xd4, 0x86,
+    0x08, 0x75, 0x6d, 0x92, 0x87, 0x1f, 0xf4, 0xdd, 0xc2, 0xf7, 0xfd, 0x0a, 0xc4, 0x3c, 0xa0, 0x57,
+    0x09, 0x6f, 0x55, 0x12, 0xab, 0xdf, 0x75, 0x47, 0x3d, 0x82, 0xf9, 0x9d, 0x56, 0x01, 0x45, 0x14,
+    0x4e, 0x4c, 0xb4, 0xbd, 0xb8, 0xfb, 0x7c, 0x67, 0x90, 0x4b, 0x54, 0x9e, 0xbf, 0x22, 0x27, 0x74,
+    0x81, 0x43, 0x70, 0x6e, 0x60, 0x6c, 0x5b, 0x0c, 0x53, 0x30, 0x23, 0xa2, 0x61, 0x4b, 0x76, 0xed,
+    0x70, 0x95, 0x4c, 0xbd, 0xe2, 0x78, 0x63, 0xdb, 0x99, 0xae, 0xf0, 0x8c, 0xe3, 0xd8, 0x42, 0xf0,
+    0xca, 0x9b, 0x29, 0x9b, 0xce, 0xd7, 0xfc, 0x23, 0x7b, 0x7d, 0xae, 0xb7, 0x57, 0x4a, 0x83, 0x26,
+    0x74, 0x49, 0xba, 0x4f, 0xe4, 0x92, 0x10, 0xfb, 0xc2, 0xa1, 0x6a, 0x65, 0x4a, 0xff, 0xf1, 0xe2,
+    0x9a, 0x53, 0x7d, 0xda, 0xbc, 0x3d, 0x37, 0x5a, 0xca, 0x0f, 0x62, 0xd7, 0x2f, 0xba, 0x81, 0xaf,
+    0x48, 0xd0, 0xa6, 0x1c, 0x74, 0x42, 0x6d, 0x4f, 0x02, 0x4e, 0xe2, 0x28, 0x67, 0xe5, 0xfa, 0x73,
+    0x1c, 0x89, 0xd2, 0x9b, 0x09, 0x46, 0xd6, 0x8d, 0x7d, 0xc8, 0xde, 0xbf, 0x04, 0xb3, 0x73, 0x15,
+    0x70, 0xef, 0x02, 0x76, 0x61, 0x0e, 0x51, 0xb5, 0x2f, 0xc4, 0xdd, 0x48, 0x63, 0x35, 0x85, 0xc9,
+    0xd4, 0x57, 0xac, 0xad, 0x45, 0x53, 0x66, 0x62, 0x34, 0x04, 0x4b, 0xab, 0xdf, 0x30, 0xfb, 0x3f,
+    0xbd, 0x67, 0x5d, 0x56, 0xdf, 0xea, 0xeb, 0xfb, 0x74, 0x75, 0x74, 0xf7, 0xf1, 0xea, 0x81, 0x4f,
+    0x57, 0x3d, 0x08, 0xae, 0x8f, 0x89, 0xad, 0x0d, 0x0a, 0xac, 0x8f, 0x8b, 0xab, 0x0d, 0x7c, 0xbf,
+    0xe5, 0x5a, 0x77, 0xcf, 0xbb, 0x2d, 0x2d, 0xd7, 0x7a, 0x7a, 0xae, 0xb5, 0x8c, 0xca, 0x0a, 0xc2,
+    0xc2, 0x0a, 0xfc, 0xfc, 0x0a, 0xe9, 0x15, 0x0f, 0xf6, 0x9d, 0x2b, 0x2e, 0x3e, 0xd7, 0x97, 0xb7,
+    0xad, 0x2e, 0xb0, 0xf2, 0x64, 0x7d, 0x5c, 0x43, 0x70, 0x70, 0x43, 0x5c, 0x7c, 0x5d, 0x40, 0x40,
+    0x1d, 0xf9, 0x62, 0xc9, 0x11, 0x9d, 0xee, 0xc8, 0x92, 0x9e, 0x13, 0x45, 0x45, 0x27, 0x06, 0xa8,
+    0xbd, 0x94, 0x46, 0x46, 0x94, 0x05, 0x04, 0x94, 0x51, 0xcf, 0x29, 0x9c, 0xfc, 0x85, 0x95, 0x00,
+    0xf7, 0x01, 0xe0, 0x39, 0xbc, 0xc2, 0x0d, 0x1a, 0xa7, 0x13, 0x8d, 0x61, 0x04, 0x94, 0x36, 0x53,
+    0x2a, 0x37, 0xb8, 0x3e, 0x1d, 0x1b, 0x33, 0x46, 0x2a, 0xc5, 0xbe, 0x56, 0x03, 0xaf, 0x34, 0xf8,
+    0x3a, 0x47, 0x64, 0xfb, 0x29, 0xb3, 0x83, 0x1c, 0xec, 0x02, 0x73, 0x82, 0x02, 0x8a, 0xa2, 0xdd,
+    0x48, 0x41, 0x58, 0xe3, 0xb6, 0xac, 0xea, 0xbd, 0x35, 0xfe, 0xea, 0xe5, 0xc7, 0x1b, 0xdb, 0x5f,
+    0x5e, 0x1e, 0xea, 0x5d, 0xf5, 0xe2, 0xe8, 0xf3, 0xd6, 0xaf, 0xc6, 0xf5, 0x8c, 0x54, 0x8d, 0xe7,
+    0xf6, 0xe6, 0x7b, 0x2f, 0xce, 0x6c, 0x56, 0x07, 0x37, 0x66, 0xf9, 0x79, 0xc4, 0x17, 0xf8, 0xda,
+    0x6a, 0xb7, 0x2d, 0x8b, 0x4d, 0xee, 0x1b, 0xd1, 0xd5, 0x9c, 0x1d, 0x4c, 0x2e, 0x78, 0xfe, 0xe3,
+    0x15, 0x99, 0xdd, 0xff, 0x7a, 0xf7, 0xd9, 0x4c, 0x88, 0x64, 0xbb, 0x00, 0xcb, 0x76, 0xb2, 0xa9,
+    0xac, 0x0b, 0x9a, 0xf3, 0x08, 0x96, 0x51, 0x68, 0xce, 0xe4, 0x18, 0x93, 0x01, 0xe5, 0x32, 0x40,
+    0xca, 0x5e, 0x28, 0x77, 0x85, 0x92, 0xff, 0x66, 0x32, 0x60, 0x6c, 0x66, 0x8b, 0xa9, 0xe5, 0x87,
+    0xa2, 0x17, 0x99, 0x7e, 0x56, 0x0b, 0xe3, 0x61, 0x02, 0x98, 0x2d, 0x90, 0x60, 0xb9, 0x33, 0x16,
+    0xc9, 0xf1, 0x43, 0xb2, 0x7d, 0xe2, 0x14, 0x93, 0xa0, 0xaf, 0x3b, 0xcd, 0x24, 0x90, 0x2d, 0xfa,
+    0xef, 0x71, 0xeb, 0xee, 0x43, 0xdc, 0xa4, 0x74, 0x37, 0x6e, 0x81, 0x36, 0x9b, 0x71, 0x39, 0xf3,
+    0x23, 0xf3, 0xc1, 0x34, 0x7c, 0x86, 0xc4, 0xfc, 0x38, 0x31, 0xcc, 0x94, 0x43, 0xfa, 0xe0, 0xad,
+    0xb7, 0xb8, 0x9c, 0xb7, 0xde, 0xa2, 0xb1, 0x35, 0x3a, 0xc4, 0xdc, 0x61, 0x13, 0x0d, 0xb4, 0x35,
+    0xce, 0x50, 0x4d, 0x80, 0x95, 0x12, 0xcc, 0x38, 0xe8, 0x8b, 0x99, 0x92, 0x89, 0x7d, 0xe4, 0x85,
+    0x8b, 0x70, 0xa9, 0x19, 0xff, 0x96, 0x1b, 0xdc, 0x73, 0x14, 0x23, 0xb7, 0xdd, 0xdc, 0x26, 0xca,
+    0x51, 0xd0, 0xe4, 0x43, 0x66, 0x07, 0x68, 0x76, 0x01, 0xf2, 0x84, 0x56, 0x52, 0xd0, 0xe4, 0x6f,
+    0xa8, 0x24, 0x92, 0x1a, 0x4c, 0x43, 0x62, 0x98, 0xc4, 0xa7, 0xc7, 0x8f, 0x24, 0xec, 0x73, 0x6c,
+    0x1f, 0x13, 0xe4, 0x1d, 0xef, 0xb9, 0x28, 0x35, 0xd8, 0x2f, 0x47, 0x41, 0x46, 0x49, 0xeb, 0x95,
+    0x65, 0x1b, 0x5e, 0xad, 0x88, 0x6e, 0xd2, 0x04, 0xb8, 0x3d, 0x8c, 0x57, 0xd3, 0xc0, 0x52, 0x1d,
+    0x8f, 0x8f, 0x15, 0x76, 0x55, 0x07, 0x7a, 0x26, 0xe7, 0x06, 0x86, 0xe5, 0x78, 0xbb, 0xa6, 0x86,
+    0xaf, 0x7e, 0x29, 0x2b, 0xff, 0xd8, 0xf2, 0x9c, 0xcd, 0x2b, 0x42, 0x64, 0x1d, 0xdc, 0x4a, 0x45,
+    0x42, 0x82, 0x02, 0x12, 0x70, 0x91, 0xcf, 0x05, 0x09, 0x3f, 0x16, 0x6c, 0x46, 0x1a, 0x54, 0x0d,
+    0x5c, 0xc0, 0xc0, 0xc1, 0x48, 0x2a, 0x2d, 0x65, 0x8c, 0xd0, 0x38, 0xba, 0x0a, 0x1e, 0xc6, 0x19,
+    0x91, 0x90, 0xa2, 0x38, 0x4c, 0xcb, 0xd4, 0x34, 0x9d, 0x60, 0x42, 0x56, 0x2a, 0x2c, 0x14, 0x0a,
+    0x27, 0x3a, 0xde, 0x16, 0x78, 0xaa, 0xae, 0x8d, 0xb1, 0x79, 0x28, 0x0b, 0xdc, 0xd2, 0x69, 0x9b,
+    0xda, 0x89, 0xf0, 0x3d, 0xd6, 0xaf, 0x62, 0x4f, 0x63, 0x44, 0x75, 0x94, 0xbd, 0x48, 0x76, 0xdc,
+    0x4f, 0x28, 0x76, 0xf2, 0xb6, 0x51, 0x64, 0x85, 0x48, 0x19, 0x91, 0x5b, 0xf1, 0x8e, 0x0f, 0x7a,
+    0x57, 0x7e, 0x70, 0xb0, 0x23, 0x42, 0x28, 0xf2, 0xaa, 0xdc, 0xf5, 0xe7, 0x55, 0x39, 0xa7, 0x42,
+    0x5d, 0xa2, 0x3f, 0x28, 0xdc, 0xc5, 0x4d, 0xbe, 0xd9, 0x13, 0x2a, 0x12, 0x65, 0xed, 0x78, 0x1f,
+    0x0b, 0x77, 0x0e, 0x4f, 0xbc, 0xb6, 0x3a, 0x70, 0x02, 0x89, 0x66, 0x3b, 0x07, 0xbb, 0xcd, 0x55,
+    0x05, 0xf8, 0x89, 0xb5, 0x36, 0xd1, 0x39, 0x95, 0xca, 0xb8, 0xe6, 0x58, 0x7b, 0x13, 0x53, 0x55,
+    0x66, 0xfd, 0xaa, 0xf0, 0xe6, 0x35, 0xaa, 0x22, 0xbb, 0x42, 0xb5, 0xaa, 0x30, 0xda, 0x87, 0xcc,
+    0xd0, 0x5d, 0xda, 0x53, 0xe4, 0x93, 0xb3, 0x2a, 0x91, 0x28, 0xf5, 0xef, 0x84, 0x24, 0x2d, 0x32,
+    0x0f, 0x59, 0xf2, 0x54, 0xc6, 0xa6, 0xef, 0xcf, 0x75, 0x47, 0x6a, 0x37, 0x5f, 0xfd, 0x65, 0x70,
+    0xe8, 0xe1, 0x85, 0xee, 0x70, 0x37, 0xc7, 0xf5, 0x5e, 0x9e, 0x29, 0xbb, 0xee, 0xe2, 0x85, 0xc7,
+    0xf7, 0x63, 0xc7, 0xef, 0x8e, 0x16, 0xa4, 0x0d, 0xdf, 0xe1, 0xbe, 0xe5, 0xf4, 0x91, 0xb5, 0xb1,
+    0x2e, 0x73, 0x03, 0x0a, 0xa3, 0xb2, 0x93, 0x3a, 0x92, 0xdd, 0xd5, 0x6d, 0x2f, 0x54, 0x54, 0x8d,
+    0x0c, 0xe8, 0x64, 0x6a, 0x8f, 0xce, 0xf9, 0xbe, 0xfe, 0x35, 0x3b, 0xc1, 0x0a, 0xc0, 0x90, 0x04,
+    0x61, 0xe0, 0xef, 0x74, 0x9c, 0x67, 0xd3, 0x79, 0xd1, 0x91, 0xc6, 0xd8, 0xae, 0x90, 0xe8, 0x3c,
+    0xfb, 0x2e, 0x97, 0xc8, 0x3d, 0x22, 0x4e, 0x87, 0x70, 0x1e, 0xa7, 0xb5, 0x3c, 0x4c, 0x5c, 0xb8,
+    0x2f, 0x27, 0xbe, 0x61, 0x7f, 0x18, 0xb7, 0xa0, 0x11, 0x36, 0xfb, 0xc3, 0xe5, 0xb1, 0x14, 0x62,
+    0x7b, 0xf5, 0x2a, 0x68, 0x7c, 0x08, 0x50, 0xe3, 0x00, 0x50, 0x99, 0x0b, 0x68, 0x80, 0x34, 0x8e,
+    0xae, 0x8e, 0x53, 0xd8, 0x2f, 0xa5, 0x2b, 0x10, 0x3f, 0x43, 0x38, 0x2d, 0x62, 0x1c, 0x95, 0x8f,
+    0x5f, 0x40, 0xd6, 0x18, 0x65, 0x93, 0xd3, 0xdc, 0x20, 0xc1, 0x91, 0x69, 0x2d, 0xc1, 0x01, 0x2d,
+    0xb9, 0x3f, 0x8e, 0xe3, 0x1f, 0x3a, 0x2f, 0xae, 0x8f, 0xca, 0x3a, 0xb4, 0x2a, 0x9f, 0x8b, 0x6b,
+    0xc6, 0xd1, 0x99, 0x4b, 0x55, 0x7e, 0xf5, 0xd9, 0xdc, 0xd7, 0x04, 0x37, 0xaa, 0x3a, 0x77, 0x69,
+    0x97, 0x7d, 0x41, 0xb6, 0x9e, 0x59, 0x5c, 0x18, 0x1e, 0x57, 0xb0, 0x68, 0xfc, 0x09, 0xc1, 0x88,
+    0xb7, 0x6e, 0xa8, 0x32, 0x6f, 0x7b, 0x91, 0x89, 0xde, 0xe7, 0xaa, 0xaa, 0x22, 0x32, 0xa6, 0x46,
+    0x75, 0x26, 0x8a, 0x2d, 0x1d, 0xce, 0xdb, 0x78, 0x41, 0x47, 0xfd, 0xbc, 0x12, 0x50, 0xea, 0x1e,
+    0x58, 0xa3, 0x2b, 0xc5, 0xd8, 0xc7, 0x18, 0x6a, 0xb0, 0x42, 0x1b, 0xa9, 0xd1, 0xe5, 0x25, 0xc6,
+    0xf8, 0x9e, 0xb9, 0x3f, 0x36, 0xab, 0xef, 0xe7, 0x91, 0xde, 0x4f, 0x76, 0xa6, 0xa6, 0x0f, 0x7f,
+    0xd6, 0xff, 0xa7, 0xfb, 0xeb, 0xe7, 0x8c, 0x99, 0x46, 0xf4, 0xd4, 0x64, 0xad, 0xc9, 0xf2, 0x70,
+    0x4d, 0x5d, 0x9d, 0x53, 0xb7, 0x3e, 0x0a, 0x7f, 0xba, 0xf9, 0xf3, 0x35, 0xba, 0x13, 0xdc, 0xee,
+    0x65, 0xbb, 0xb9, 0x53, 0x25, 0x6b, 0xbe, 0xd8, 0x5a, 0xb4, 0x21, 0x46, 0xbd, 0xf2, 0x54, 0xeb,
+    0x8a, 0x86, 0x13, 0x6b, 0xa2, 0x23, 0xd7, 0x1a, 0xf5, 0xf0, 0x01, 0xe8, 0x61, 0x1e, 0xb2, 0x47,
+    0x48, 0x67, 0x14, 0x97, 0x47, 0x17, 0x58, 0xb1, 0x18, 0x71, 0x84, 0xd0, 0xb9, 0x89, 0x04, 0x71,
+    0xef, 0x10, 0x2c, 0xef, 0x3d, 0x53, 0x28, 0xaf, 0xda, 0xae, 0xe3, 0xce, 0xe1, 0xe8, 0x2d, 0xf7,
+    0x8f, 0x17, 0x15, 0x8d, 0xfc, 0xc8, 0xbd, 0x3a, 0x7e, 0xb5, 0xfd, 0xf6, 0x33, 0xc9, 0xed, 0xa7,
+    0x57, 0xaa, 0xdf, 0xd6, 0x9d, 0xe6, 0x76, 0x27, 0x42, 0x5f, 0x3a, 0xc3, 0xaa, 0x06, 0x88, 0xf3,
+    0x3d, 0x24, 0x4e, 0x5f, 0x17, 0xd1, 0xb9, 0x9f, 0x5f, 0xcf, 0x18, 0x7d, 0x99, 0x4d, 0x9c, 0x18,
+    0x8f, 0x19, 0x67, 0x32, 0xf4, 0x25, 0x0c, 0x84, 0x45, 0x57, 0xaf, 0x5e, 0x65, 0xbf, 0xa5, 0x6d,
+    0xf5, 0xfb, 0xae, 0x5c, 0x21, 0x25, 0x6f, 0xbf, 0x4d, 0x43, 0x0b, 0x4a, 0xc3, 0xff, 0x31, 0x0d,
+    0x3e, 0xc6, 0x98, 0x6a, 0x8d, 0x37, 0x8f, 0x33, 0x89, 0xfa, 0x06, 0xf2, 0x0f, 0xfd, 0x7c, 0x43,
+    0x9f, 0xfa, 0xb5, 0x57, 0xaf, 0x92, 0x55, 0xb4, 0x1d, 0x46, 0x75, 0xa0, 0xcf, 0x07, 0xa0, 0x4f,
+    0x0f, 0xda, 0x86, 0xea, 0x13, 0x7c, 0x86, 0x9f, 0x94, 0x14, 0xff, 0x51, 0xa3, 0x4a, 0x31, 0x70,
+    0xf3, 0xc0, 0x61, 0xed, 0x27, 0xcf, 0xf5, 0x7f, 0x75, 0x20, 0x2f, 0x7d, 0xf8, 0x6f, 0x9b, 0x4e,
+    0xdc, 0x5b, 0x23, 0xfe, 0x79, 0x56, 0x54, 0x57, 0x45, 0xf6, 0xba, 0x6c, 0x4f, 0x99, 0x6e, 0x53,
+    0x4e, 0x56, 0x83, 0xc6, 0x82, 0x7b, 0x9f, 0x7c, 0xa3, 0xff, 0xd0, 0x5d, 0x17, 0x5d, 0x78, 0x12,
+    0x33, 0x07, 0x2b, 0x0e, 0x60, 0xe6, 0x64, 0x61, 0xc7, 0x07, 0xbd, 0xda, 0xce, 0xa8, 0xf0, 0x35,
+    0x67, 0xdb, 0xab, 0x3a, 0xcf, 0xad, 0xd1, 0xd8, 0xb9, 0x5b, 0x62, 0xc7, 0xf3, 0x06, 0xce, 0x05,
+    0x36, 0xd3, 0x38, 0x37, 0xca, 0x4e, 0xd7, 0xb8, 0x6c, 0xd6, 0xc4, 0x78, 0xe8, 0x38, 0xbb, 0x76,
+    0x8c, 0x49, 0x01, 0x8e, 0x4b, 0xa6, 0x96, 0xb2, 0x94, 0xef, 0x03, 0x70, 0xd9, 0x67, 0x8c, 0xfb,
+    0xa8, 0xac, 0xfb, 0xc6, 0x7f, 0x7b, 0xe7, 0x33, 0xf9, 0x1d, 0xf3, 0x0f, 0xc8, 0x5a, 0xd2, 0x77,
+    0x32, 0xf1, 0xd4, 0x34, 0x35, 0x15, 0xc0, 0x90, 0x7b, 0x63, 0x2b, 0x3f, 0xee, 0xdb, 0xf8, 0xd7,
+    0xe5, 0x13, 0xca, 0x8a, 0x48, 0x4d, 0x45, 0x20, 0x3e, 0xc5, 0x8c, 0x4f, 0x08, 0xb6, 0x5c, 0xaf,
+    0x2f, 0xba, 0xbc, 0x3d, 0xab, 0xc6, 0x27, 0xa8, 0xc5, 0xa8, 0x4f, 0x81, 0x35, 0x4f, 0xdf, 0xe0,
+    0x43, 0x94, 0x23, 0xf0, 0x21, 0x4b, 0x6c, 0x89, 0x95, 0x18, 0x34, 0xca, 0x56, 0xea, 0x5f, 0xe6,
+    0x46, 0x3c, 0xef, 0xe3, 0x43, 0x4e, 0x9c, 0xe3, 0x31, 0x52, 0x60, 0xd4, 0x6c, 0x04, 0x37, 0xfc,
+    0x08, 0xbb, 0x11, 0x04, 0x5e, 0xf4, 0xf2, 0xd1, 0x89, 0x17, 0x90, 0xd1, 0x7e, 0x9c, 0x8c, 0xf2,
+    0x3d, 0x1e, 0x59, 0xd6, 0x49, 0xef, 0x1c, 0x3d, 0xfe, 0x78, 0x24, 0x8d, 0x3d, 0x0a, 0x6b, 0xf9,
+    0x59, 0x7a, 0x26, 0xcc, 0xc1, 0x28, 0x1d, 0xdc, 0x55, 0x06, 0x93, 0xb5, 0x0c, 0xaa, 0x63, 0xba,
+    0xe8, 0x1f, 0xbb, 0x8b, 0x0f, 0xe0, 0xfd, 0x77, 0xf5, 0x1f, 0xbe, 0xac, 0x6f, 0xfc, 0xc8, 0x79,
+    0x4c, 0x80, 0x3e, 0x06, 0x91, 0xc7, 0x77, 0xb3, 0x65, 0x94, 0xc0, 0x84, 0x3f, 0x67, 0x4b, 0x59,
+    0xc0, 0x5f, 0x81, 0xfc, 0x53, 0x1a, 0x35, 0xe1, 0xf9, 0xa6, 0xa6, 0x29, 0xc3, 0x62, 0x81, 0xcd,
+    0xb8, 0xbe, 0x65, 0x7c, 0x9c, 0x6c, 0xe6, 0xfd, 0xdc, 0x72, 0xfc, 0x7b, 0x68, 0x7c, 0x8f, 0x95,
+    0x50, 0x0e, 0x2b, 0x60, 0xed, 0x66, 0x07, 0x36, 0x20, 0xe1, 0xad, 0x00, 0xd6, 0x1f, 0x06, 0x85,
+    0x4d, 0xb3, 0x03, 0x0b, 0xd1, 0xe3, 0xe9, 0x74, 0x6a, 0x3e, 0x15, 0xd8, 0x65, 0xed, 0xbd, 0xd3,
+    0xbb, 0xe1, 0x6f, 0xcf, 0xe7, 0xe6, 0x3c, 0xf7, 0xb7, 0x0d, 0xbd, 0x77, 0xf6, 0x65, 0x8f, 0xfb,
+    0xe4, 0xaf, 0x4b, 0x4f, 0xef, 0xc9, 0xf7, 0xf5, 0x2d, 0xec, 0x49, 0xcf, 0xe8, 0xc9, 0xf3, 0x61,
+    0x50, 0xca, 0x01, 0x6e, 0xec, 0xac, 0x4e, 0x77, 0x16, 0x0b, 0x0f, 0xa4, 0x1c, 0xc0, 0x82, 0x57,
+    0x74, 0xba, 0x57, 0xb8, 0xf1, 0x9f, 0xd2, 0x96, 0x9f, 0xef, 0xd2, 0x68, 0xba, 0xce, 0x2f, 0x4f,
+    0x5b, 0x7e, 0xa1, 0x5b, 0xa3, 0xe9, 0xbe, 0x60, 0xe0, 0x99, 0x7d, 0x0f, 0x78, 0xa6, 0x2b, 0x20,
+    0xea, 0x57, 0x53, 0x90, 0xc2, 0x63, 0x8d, 0x61, 0x82, 0x21, 0x17, 0xb9, 0xf5, 0x78, 0x45, 0xd9,
+    0x72, 0x95, 0x6a, 0x79, 0x19, 0xf7, 0xc1, 0x38, 0x71, 0x3f, 0xfc, 0xfd, 0xca, 0x95, 0xdf, 0x13,
+    0x87, 0xab, 0xea, 0xe6, 0xb8, 0xa8, 0x65, 0xf1, 0x14, 0x3b, 0x3a, 0xde, 0xdf, 0x30, 0x78, 0xad,
+    0x9e, 0x6a, 0xb3, 0x64, 0x92, 0x11, 0xcc, 0x05, 0x99, 0x18, 0xc0, 0x2f, 0x88, 0xfc, 0x2b, 0x60,
+    0xa5, 0x85, 0xff, 0xa0, 0x64, 0xcc, 0x0e, 0xdc, 0xf5, 0x02, 0xd7, 0x47, 0xec, 0xb3, 0xf6, 0x4d,
+    0x13, 0xf0, 0xf3, 0x7d, 0xd9, 0x13, 0x3e, 0xf9, 0x6b, 0x33, 0xd2, 0x7a, 0x0a, 0x40, 0xc0, 0xb5,
+    0x69, 0x54, 0xc0, 0xcb, 0xdc, 0x5f, 0x36, 0x63, 0x2f, 0xf2, 0x97, 0x3f, 0x2a, 0xa6, 0xd1, 0x1a,
+    0x3e, 0x07, 0x39, 0x9f, 0x40, 0x76, 0x30, 0xc6, 0x53, 0xa2, 0x89, 0x44, 0xd3, 0xf0, 0x15, 0x64,
+    0x76, 0xc4, 0xce, 0x58, 0x32, 0x44, 0x98, 0x83, 0xff, 0x5c, 0x95, 0xb2, 0xb5, 0x42, 0x0b, 0xab,
+    0x43, 0x9c, 0x9f, 0xd7, 0x19, 0x12, 0xb4, 0xbc, 0x88, 0xfb, 0x75, 0x9c, 0x09, 0xe3, 0x8e, 0x80,
+    0x38, 0xf9, 0x82, 0x91, 0xf2, 0x37, 0x36, 0x2f, 0x39, 0xd8, 0xec, 0xe0, 0x7c, 0x55, 0xdd, 0x18,
+    0xad, 0x6d, 0x0e, 0x19, 0x7f, 0x82, 0x3c, 0x89, 0xf5, 0xab, 0x67, 0x53, 0x1f, 0x48, 0x00, 0xbf,
+    0x7e, 0x12, 0xe4, 0x57, 0x81, 0x3e, 0x41, 0x40, 0x57, 0x58, 0xf3, 0x18, 0x51, 0x12, 0xa2, 0xfc,
+    0xa9, 0x38, 0xcd, 0x9e, 0xd8, 0xd8, 0x33, 0xd3, 0x02, 0x7c, 0x23, 0x6a, 0x6e, 0x9d, 0x1f, 0xb9,
+    0xa2, 0xb8, 0xfa, 0x78, 0x4f, 0x6c, 0xc2, 0xc6, 0x57, 0x5b, 0x9e, 0xbf, 0xd7, 0xf5, 0x28, 0x64,
+    0x45, 0x51, 0x6e, 0x7b, 0xa0, 0x4b, 0x52, 0x7b, 0xca, 0xb2, 0x93, 0x9d, 0xc1, 0xf1, 0xfd, 0xaf,
+    0xb5, 0xd5, 0xbc, 0x7b, 0xb0, 0x74, 0x7c, 0x71, 0x4e, 0x5b, 0x44, 0x4e, 0x47, 0x30, 0xee, 0xf0,
+    0x8a, 0x0e, 0x54, 0xda, 0x2d, 0x48, 0xae, 0xe9, 0xcf, 0xcb, 0xdd, 0x5a, 0x17, 0xd4, 0x79, 0x6d,
+    0x79, 0x6c, 0xa3, 0x5a, 0x51, 0x10, 0xe8, 0x1e, 0xa1, 0xf2, 0xb3, 0x71, 0xca, 0x6e, 0xd8, 0x98,
+    0x53, 0xb0, 0xad, 0x4a, 0x19, 0xd0, 0x72, 0xac, 0x35, 0xa6, 0x3c, 0xcc, 0xde, 0x2f, 0x8f, 0xea,
+    0x01, 0x16, 0x67, 0xec, 0xc9, 0x29, 0xaf, 0xe0, 0xbd, 0x8b, 0xce, 0x4d, 0xf7, 0x1e, 0x91, 0xcb,
+    0xe3, 0xcb, 0x0c, 0xbe, 0x64, 0xc0, 0xa7, 0x35, 0x20, 0xc7, 0x6b, 0x50, 0x4f, 0x42, 0xf1, 0xfe,
+    0xb1, 0x2b, 0x53, 0xaf, 0x36, 0xae, 0x46, 0x98, 0x37, 0xc7, 0x9e, 0xfa, 0xe5, 0x99, 0xdd, 0x3f,
+    0x0f, 0x8e, 0xc5, 0xae, 0xcb, 0xcb, 0x5b, 0x1b, 0x0b, 0xbe, 0x20, 0x3b, 0x78, 0xb7, 0xb9, 0xf9,
+    0xee, 0x41, 0xe6, 0xcf, 0x13, 0xb2, 0x9a, 0x5e, 0xb5, 0xba, 0xb7, 0x06, 0xfa, 0xa3, 0x73, 0xe2,
+    0x7c, 0xe3, 0x9c, 0xc8, 0xcf, 0x88, 0x52, 0x8c, 0x2d, 0x61, 0xbd, 0xd8, 0x8b, 0xbb, 0xb0, 0x44,
+    0xff, 0xf3, 0x79, 0xee, 0x3d, 0xbc, 0xd2, 0xff, 0x82, 0xfe, 0x57, 0x6c, 0xca, 0x1e, 0xa4, 0xbd,
+    0x8f, 0xe7, 0x71, 0x3f, 0x1b, 0xd0, 0x19, 0xac, 0x47, 0xf8, 0x35, 0x64, 0x05, 0xb0, 0xaa, 0x9d,
+    0xc3, 0xf3, 0x41, 0x17, 0x23, 0x52, 0xc6, 0xd2, 0x92, 0x92, 0x00, 0x17, 0x65, 0x28, 0x21, 0x86,
+    0x60, 0xbc, 0xf0, 0x19, 0x31, 0x77, 0x6d, 0xcf, 0x9f, 0xee, 0x49, 0x0e, 0x71, 0xc7, 0xd9, 0x8f,
+    0xbe, 0x19, 0xe3, 0x8e, 0x1f, 0xfa, 0x05, 0x3b, 0x2c, 0xda, 0xc3, 0xbd, 0x67, 0x8e, 0x63, 0xd8,
+    0x1a, 0xee, 0x6f, 0xe3, 0x2d, 0x40, 0x78, 0x1f, 0x37, 0x02, 0xd7, 0x17, 0xd8, 0x42, 0xbe, 0x9b,
+    0x21, 0xee, 0x02, 0x3b, 0x88, 0xa5, 0x20, 0xa9, 0x0b, 0x74, 0xf6, 0x2d, 0xf4, 0x03, 0x18, 0x18,
+    0x47, 0x00, 0x6b, 0x0c, 0xff, 0x38, 0x1d, 0xcb, 0xe1, 0xcf, 0x91, 0x8b, 0xc5, 0x6f, 0x70, 0xb7,
+    0xb9, 0x37, 0xe0, 0xef, 0x33, 0x7c, 0x85, 0x8b, 0x01, 0xac, 0xf9, 0x9e, 0x58, 0xea, 0x7d, 0xf4,
+    0x8e, 0xc4, 0x4e, 0xff, 0x25, 0xf9, 0x9c, 0xbc, 0x4f, 0xb5, 0x35, 0x03, 0x68, 0xdc, 0x02, 0x1a,
+    0x33, 0x0c, 0x34, 0x28, 0x30, 0x62, 0x07, 0x9c, 0x06, 0x7f, 0xd6, 0x9c, 0xb5, 0x9e, 0x03, 0x40,
+    0xd3, 0xc7, 0x91, 0x33, 0x13, 0xd5, 0xfa, 0x6f, 0xc8, 0x13, 0xcc, 0x33, 0xd4, 0x4f, 0x52, 0xa0,
+    0xc5, 0x93, 0xbf, 0xe1, 0x5c, 0x85, 0x61, 0x57, 0x51, 0x8e, 0x65, 0x52, 0x3a, 0xef, 0x3c, 0x39,
+    0x31, 0x9b, 0xb9, 0x3d, 0xd1, 0x7d, 0x88, 0xe9, 0x39, 0x50, 0x38, 0x11, 0x4c, 0xe1, 0x2a, 0x69,
+    0xec, 0xde, 0x5e, 0x81, 0xd8, 0x30, 0x36, 0xeb, 0xb9, 0x73, 0x64, 0x9e, 0x70, 0xb3, 0x21, 0xea,
+    0x04, 0x90, 0x91, 0x38, 0x8a, 0xc9, 0xbc, 0xfd, 0xfb, 0xb9, 0x3a, 0xe1, 0xe6, 0x73, 0x8f, 0xf6,
+    0x9d, 0x17, 0x7d, 0x04, 0x75, 0x2c, 0x26, 0xd7, 0x32, 0x65, 0x06, 0x9c, 0x8e, 0x02, 0x3c, 0x23,
+    0x4b, 0xf5, 0xfb, 0x46, 0x49, 0xc9, 0x2a, 0xa1, 0xd7, 0xa3, 0x9b, 0xf0, 0x76, 0x26, 0xcc, 0x92,
+    0xcf, 0x1b, 0x28, 0xa4, 0xcb, 0x1d, 0xc5, 0x74, 0x77, 0x73, 0x26, 0xde, 0xc1, 0xd5, 0x1c, 0x14,
+    0x7c, 0x74, 0xee, 0x57, 0x8f, 0xf3, 0xc2, 0x12, 0x18, 0x39, 0x05, 0xb9, 0xc5, 0x04, 0x3c, 0x1e,
+    0x39, 0x86, 0x22, 0x22, 0x43, 0x63, 0x99, 0xd7, 0x5f, 0xbf, 0x86, 0x3d, 0x36, 0x75, 0xbf, 0xee,
+    0x39, 0x88, 0x17, 0xb1, 0xef, 0x72, 0x66, 0xe4, 0xaf, 0x7a, 0x77, 0xfc, 0xe0, 0x1f, 0x7a, 0x77,
+    0xba, 0x8f, 0x3c, 0x19, 0xc9, 0x6c, 0x35, 0xec, 0x34, 0xeb, 0x68, 0x2c, 0xbc, 0x75, 0xa2, 0xe9,
+    0x02, 0x45, 0x99, 0x00, 0xf6, 0x26, 0x99, 0x25, 0xe4, 0xcb, 0x35, 0x74, 0xf8, 0xe2, 0xde, 0x78,
+    0x87, 0xfb, 0x49, 0x88, 0xb8, 0x9b, 0xd8, 0x0b, 0x7a, 0xca, 0x82, 0x79, 0xe3, 0x11, 0x9b, 0x84,
+    0xe6, 0xa3, 0x40, 0xd0, 0x84, 0xf8, 0xb7, 0x55, 0xb1, 0xd1, 0x71, 0xc0, 0xe6, 0x6c, 0x24, 0x52,
+    0x17, 0x17, 0x4b, 0x1b, 0xc3, 0xc2, 0xc2, 0x60, 0x81, 0x86, 0x70, 0xd2, 0xb8, 0x4c, 0x22, 0x77,
+    0x16, 0x65, 0xaa, 0x83, 0xb2, 0x7c, 0xef, 0x87, 0xb6, 0xef, 0xaf, 0x5c, 0x7e, 0x71, 0x89, 0xc4,
+    0xea, 0x17, 0xb1, 0xa5, 0x94, 0x1c, 0x8b, 0xa8, 0x8c, 0x5c, 0xe8, 0x96, 0xa8, 0x8c, 0x6f, 0x54,
+    0x93, 0xa4, 0x59, 0x81, 0x85, 0xdd, 0x19, 0xb5, 0x07, 0x8b, 0x34, 0x5d, 0x67, 0xdb, 0x6f, 0x11,
+    0x36, 0x30, 0xc3, 0xdb, 0x2d, 0xd2, 0x43, 0xdd, 0x59, 0xa4, 0x48, 0x3b, 0xb0, 0x92, 0x73, 0x88,
+    0x6f, 0xf3, 0x30, 0x77, 0x5d, 0x86, 0x1f, 0x6c, 0x9f, 0xeb, 0x1b, 0xe9, 0xe1, 0x11, 0xe3, 0x16,
+    0x92, 0xeb, 0x56, 0xe7, 0x5e, 0x94, 0xa9, 0xc8, 0xdc, 0x52, 0x90, 0xb5, 0x3e, 0xcf, 0x87, 0xf2,
+    0xbe, 0x0a, 0x7c, 0xc2, 0x57, 0x48, 0x6d, 0x73, 0x1e, 0xb5, 0xce, 0x74, 0x99, 0x58, 0x24, 0xc5,
+    0x8f, 0x17, 0xb8, 0x72, 0xc3, 0x0a, 0xf3, 0x31, 0xae, 0x89, 0x24, 0x06, 0x58, 0x5b, 0x35, 0x6a,
+    0xf3, 0x29, 0x73, 0x42, 0x5e, 0xb7, 0xbb, 0xaa, 0xe2, 0xe9, 0x8a, 0xd0, 0xd9, 0xb3, 0x43, 0x2b,
+    0xb6, 0x97, 0x57, 0xef, 0xad, 0x95, 0x8f, 0x3e, 0xa1, 0x2c, 0x8c, 0x52, 0x17, 0x84, 0x4a, 0x85,
+    0x26, 0x41, 0xf5, 0x99, 0x11, 0x05, 0xca, 0xb9, 0x42, 0x34, 0xf6, 0xdf, 0xff, 0x4d, 0x5c, 0x25,
+    0x9d, 0xef, 0x0c, 0xa5, 0x6a, 0x37, 0x5d, 0x6e, 0x8b, 0x68, 0x7f, 0x7d, 0x50, 0x9b, 0xb2, 0xed,
+    0xda, 0x66, 0x49, 0x5c, 0x77, 0xa9, 0xca, 0x53, 0x5b, 0x1e, 0x78, 0x2a, 0x61, 0x55, 0x82, 0x42,
+    0xd7, 0x03, 0x1a, 0x4d, 0x02, 0x9d, 0x8d, 0x82, 0xce, 0x20, 0x1e, 0xab, 0xa0, 0xca, 0xf8, 0xff,
+    0xc6, 0x64, 0x44, 0x11, 0x54, 0x1c, 0xc4, 0x7c, 0x49, 0x3a, 0xdf, 0xea, 0x5c, 0x79, 0x76, 0x79,
+    0x48, 0xc8, 0xf2, 0xb3, 0x2b, 0x7a, 0xae, 0x34, 0x93, 0x2f, 0x19, 0x79, 0x71, 0x78, 0x5c, 0x89,
+    0xc2, 0xc6, 0x5a, 0x59, 0xf2, 0x92, 0x4f, 0x86, 0xb2, 0xe6, 0xa5, 0x8a, 0xcc, 0xa7, 0xaf, 0x34,
+    0x49, 0x9b, 0xde, 0x7c, 0x3a, 0xb3, 0xea, 0xcc, 0xb2, 0x60, 0x5d, 0x60, 0x50, 0xc5, 0xaa, 0x08,
+    0x69, 0xc4, 0xea, 0xb2, 0x20, 0x6a, 0xb1, 0x20, 0x3d, 0xf9, 0x4d, 0xfa, 0x0a, 0xc0, 0x02, 0x29,
+    0x9e, 0x5a, 0xd4, 0xd9, 0x48, 0x8c, 0xb1, 0xfd, 0xe3, 0x80, 0x45, 0x6e, 0xd8, 0xdf, 0x61, 0xcc,
+    0x1f, 0x7c, 0xa6, 0x77, 0x0f, 0x6c, 0xd8, 0x53, 0x56, 0x3a, 0x54, 0x4d, 0xa5, 0xaf, 0xde, 0x5e,
+    0x56, 0xba, 0xbb, 0x21, 0x70, 0x74, 0x7e, 0x60, 0xa1, 0x26, 0xad, 0x36, 0x64, 0xa6, 0xd0, 0x39,
+    0x34, 0x3f, 0x34, 0xbc, 0x20, 0xc8, 0xf6, 0xae, 0x60, 0xc1, 0x18, 0x22, 0x62, 0xc9, 0x8a, 0x77,
+    0xb7, 0x25, 0x6b, 0x07, 0xdf, 0xe8, 0x88, 0x68, 0xbd, 0xb4, 0x49, 0x9b, 0x36, 0xf4, 0xce, 0x46,
+    0x49, 0xfc, 0x1a, 0x9d, 0x32, 0x76, 0x85, 0xf6, 0x54, 0x50, 0x65, 0xa2, 0x47, 0x40, 0x29, 0x95,
+    0x3e, 0x15, 0x78, 0x31, 0x05, 0xe9, 0x61, 0xde, 0x8c, 0xfa, 0x4d, 0x6a, 0x1a, 0x13, 0xc2, 0x1c,
+    0x26, 0xff, 0x7d, 0xec, 0xc4, 0x6f, 0x15, 0xe6, 0x76, 0xbe, 0xde, 0x1b, 0x1b, 0xbf, 0xee, 0x64,
+    0x4d, 0xeb, 0x9f, 0x5a, 0x54, 0x13, 0x17, 0x48, 0x16, 0xf1, 0x29, 0x49, 0x09, 0x2e, 0x0c, 0x75,
+    0x74, 0xd5, 0xd6, 0x47, 0x65, 0xf7, 0xf9, 0x75, 0x49, 0x9b, 0x9e, 0xb3, 0x4a, 0x7e, 0xf2, 0x52,
+    0xa3, 0x5b, 0xd7, 0x8d, 0x6d, 0x49, 0x49, 0x83, 0x97, 0xdb, 0xaa, 0x8e, 0x59, 0x6a, 0x96, 0x46,
+    0xcb, 0x4a, 0x7a, 0x33, 0xdc, 0x62, 0x96, 0xe5, 0xc9, 0xa2, 0xd5, 0x2b, 0x64, 0x85, 0x81, 0x14,
+    0x41, 0xa1, 0x4f, 0xf2, 0x91, 0x50, 0x02, 0xc8, 0x06, 0x98, 0xa4, 0x93, 0x8a, 0x0d, 0xab, 0x70,
+    0xc3, 0x72, 0x06, 0xac, 0xd6, 0x86, 0x7a, 0xf2, 0xe5, 0xd1, 0xfc, 0x23, 0xad, 0x4e, 0xd1, 0x8e,
+    0x42, 0x2b, 0x9f, 0xf9, 0xca, 0x64, 0xf7, 0xcf, 0xf5, 0x03, 0xec, 0xf3, 0xcb, 0x0e, 0x64, 0x9a,
+    0x98, 0x9c, 0x13, 0xb0, 0xee, 0x49, 0xaa, 0xea, 0x11, 0x3e, 0xf2, 0x48, 0xe3, 0x32, 0xd9, 0x59,
+    0x20, 0x85, 0x25, 0x72, 0x87, 0xf5, 0xe7, 0x34, 0x9c, 0xa5, 0x5b, 0x8f, 0x3c, 0xc8, 0x8a, 0xff,
+    0x80, 0x82, 0x17, 0x7f, 0xb6, 0xf2, 0xce, 0xd6, 0xd0, 0x1d, 0x83, 0x3e, 0xcd, 0x81, 0x9b, 0x12,
+    0xd3, 0xdb, 0xd4, 0x7a, 0x65, 0x70, 0xd3, 0xbe, 0x8a, 0x9a, 0xed, 0xe5, 0x2a, 0xb3, 0xd9, 0xa1,
+    0x95, 0xdb, 0x2b, 0xca, 0xf6, 0x36, 0x07, 0x8f, 0xda, 0x85, 0x14, 0x6b, 0x32, 0x97, 0x04, 0xcd,
+    0x02, 0x6d, 0x17, 0xa9, 0x35, 0x25, 0x21, 0xf6, 0x6c, 0xe0, 0xf8, 0x57, 0x5b, 0xaf, 0xd7, 0x39,
+    0x25, 0xab, 0x9f, 0x8c, 0x52, 0x87, 0xb4, 0x67, 0x32, 0x9e, 0xdc, 0xf5, 0x3f, 0xa0, 0x7a, 0x90,
+    0x7f, 0x39, 0xb0, 0x3e, 0xc6, 0xfb, 0xf2, 0x3c, 0xe3, 0x09, 0xc0, 0xd4, 0xde, 0x0a, 0xe4, 0xfd,
+    0x0d, 0x8b, 0x3a, 0x5c, 0x7b, 0xff, 0xad, 0x24, 0x1c, 0xd2, 0x38, 0x5c, 0x9c, 0xd2, 0x5d, 0xb4,
+    0xf8, 0x81, 0x57, 0x56, 0xa8, 0xa6, 0x2c, 0xdc, 0x11, 0xec, 0x1b, 0xa2, 0xac, 0x89, 0x28, 0xdc,
+    0xf4, 0xea, 0x60, 0xa2, 0xa7, 0x6e, 0x57, 0x23, 0x80, 0xe2, 0x2b, 0x49, 0x05, 0xee, 0xfe, 0x79,
+    0xed, 0x40, 0x77, 0x25, 0x40, 0xdb, 0x53, 0x82, 0x8f, 0x8d, 0xa7, 0x22, 0x40, 0xeb, 0x77, 0xa7,
+    0x22, 0xab, 0x1f, 0x98, 0x4f, 0x9d, 0x89, 0x00, 0xeb, 0x6f, 0xb1, 0x81, 0xd8, 0x56, 0x19, 0x17,
+    0xa7, 0x54, 0xc4, 0xc6, 0x02, 0x4f, 0x93, 0x47, 0xb9, 0x04, 0xdc, 0x0b, 0x6d, 0xc5, 0xfc, 0xec,
+    0x3e, 0xa5, 0xc7, 0xc7, 0x6a, 0x9c, 0x4e, 0xa9, 0xef, 0x81, 0x76, 0xa8, 0x6e, 0x41, 0x94, 0x03,
+    0x96, 0xf8, 0x48, 0x3c, 0x02, 0xed, 0x25, 0x94, 0x22, 0xa5, 0x0c, 0x54, 0xab, 0x1b, 0x9f, 0x4d,
+    0x36, 0x99, 0x71, 0x81, 0x15, 0xd8, 0xab, 0xe5, 0x82, 0x93, 0x53, 0xe4, 0xc1, 0xef, 0xc1, 0xe8,
+    0x95, 0xbc, 0xc4, 0x8f, 0x63, 0x52, 0x13, 0xe2, 0xaa, 0x34, 0x84, 0xa4, 0x8d, 0x0f, 0x98, 0xad,
+    0x9c, 0x3b, 0xc7, 0x85, 0xbd, 0x81, 0xfd, 0xfc, 0xb9, 0xe7, 0x9e, 0xc1, 0x77, 0x0c, 0x62, 0x72,
+    0x81, 0xfa, 0x9f, 0xb9, 0x5f, 0xaf, 0x8f, 0xe2, 0xcc, 0xf1, 0xb7, 0xf0, 0xc4, 0x61, 0x7d, 0x3e,
+    0x45, 0x6e, 0x58, 0xd8, 0xe3, 0xd5, 0x46, 0x1c, 0xa4, 0x93, 0xc4, 0xea, 0x07, 0x86, 0xca, 0xb4,
+    0x04, 0xe4, 0x17, 0xae, 0x04, 0x6b, 0x60, 0x01, 0x07, 0xfd, 0x0c, 0xef, 0x65, 0x8c, 0xeb, 0x94,
+    0x61, 0xff, 0xa6, 0x5b, 0x81, 0xe8, 0x7f, 0x96, 0xe1, 0x25, 0xa3, 0x5f, 0xce, 0x4d, 0x0b, 0xa8,
+    0x7f, 0xae, 0x36, 0x7e, 0x45, 0xfe, 0xe2, 0x51, 0x9f, 0xec, 0xe0, 0xc8, 0xe2, 0x60, 0x5b, 0xb2,
+    0xb7, 0x59, 0x59, 0xb7, 0xa7, 0x32, 0x7d, 0x6d, 0x81, 0xef, 0x03, 0x9f, 0xac, 0xe0, 0x80, 0xcc,
+    0x40, 0x3b, 0xa6, 0x68, 0xe2, 0x79, 0x36, 0x90, 0x9b, 0xc9, 0x0f, 0x81, 0x47, 0xc1, 0x53, 0x95,
+    0x7a, 0x1f, 0x72, 0x21, 0x39, 0xcf, 0x15, 0x86, 0x80, 0x99, 0x5b, 0x7a, 0x7c, 0xbd, 0xd6, 0xab,
+    0xe4, 0xd9, 0x7a, 0x7d, 0x24, 0xb9, 0x98, 0x96, 0x27, 0x75, 0x8f, 0x2b, 0x7a, 0x3c, 0xde, 0x46,
+    0xbe, 0xa6, 0xb8, 0xfa, 0x9f, 0x03, 0x5e, 0x37, 0xfa, 0xa5, 0x5d, 0x12, 0x0e, 0x6b, 0xde, 0xa3,
+    0x4b, 0xea, 0xca, 0xf7, 0x7d, 0xe0, 0x95, 0x19, 0x16, 0x5a, 0x1a, 0xe1, 0xc4, 0xa4, 0x4f, 0x1c,
+    0xe3, 0xbb, 0x6b, 0xb9, 0x34, 0x90, 0xe0, 0x51, 0xf2, 0x6c, 0xa3, 0x3e, 0x8a, 0x5c, 0x48, 0xca,
+    0x77, 0x35, 0x8c, 0x38, 0xdd, 0x11, 0x0d, 0x06, 0xca, 0x7c, 0xfc, 0x9b, 0x3e, 0x7d, 0x7f, 0x88,
+    0x4c, 0x33, 0xf5, 0x69, 0x7b, 0x4a, 0x49, 0x91, 0xdd, 0xe7, 0xdb, 0x3b, 0xce, 0xf7, 0x44, 0x46,
+    0xf6, 0x9c, 0xe3, 0xef, 0xa3, 0xf6, 0xea, 0xf2, 0xa8, 0x88, 0x32, 0xb5, 0x83, 0x83, 0xa6, 0x2c,
+    0x32, 0xb2, 0x4c, 0x6d, 0x4f, 0xc4, 0x36, 0x6d, 0xef, 0x6c, 0x4f, 0x4f, 0xdf, 0xfe, 0x4e, 0x9b,
+    0x4d, 0xdb, 0xdb, 0x34, 0xf3, 0xf6, 0x26, 0x9b, 0xb8, 0x9e, 0xd2, 0x00, 0x30, 0xde, 0x38, 0x9b,
+    0xd8, 0xee, 0x72, 0x95, 0xaa, 0xbc, 0x9b, 0xc7, 0x72, 0xae, 0x84, 0xf5, 0xe1, 0xa5, 0xe2, 0xd1,
+    0x8c, 0x97, 0xeb, 0xff, 0xc6, 0x72, 0xdc, 0x30, 0x7a, 0x87, 0x7c, 0xa8, 0xac, 0x1b, 0xae, 0xac,
+    0xd8, 0x51, 0x1d, 0x36, 0x7b, 0x76, 0x58, 0xf5, 0xd3, 0xe5, 0x95, 0x7b, 0xea, 0x15, 0xa3, 0xb6,
+    0xc1, 0x85, 0x1a, 0xc0, 0xf2, 0x85, 0xa2, 0x59, 0x81, 0x75, 0x19, 0x1a, 0x40, 0x33, 0xa6, 0x76,
+    0xec, 0x67, 0xc1, 0xa7, 0xfa, 0xef, 0x25, 0xed, 0xef, 0x6c, 0x4f, 0x4b, 0x18, 0x38, 0xdf, 0x94,
+    0xda, 0x71, 0x79, 0x93, 0x36, 0x79, 0xcb, 0xbb, 0x5b, 0x24, 0x09, 0xdd, 0xa5, 0x4a, 0x0f, 0x6d,
+    0x45, 0xd0, 0xe5, 0xd8, 0xce, 0x98, 0x80, 0xb2, 0x1e, 0x3e, 0x1a, 0x00, 0x6e, 0xc8, 0x74, 0x6e,
+    0x94, 0xb2, 0x3f, 0xe2, 0xfa, 0x73, 0x6c, 0xff, 0x3a, 0x91, 0x14, 0xd0, 0xb0, 0xa7, 0xaa, 0x7c,
+    0x7b, 0x55, 0x28, 0x78, 0x7b, 0xf5, 0xd3, 0x15, 0x15, 0x7b, 0x96, 0xa8, 0x46, 0xe7, 0x07, 0x17,
+    0xf0, 0xde, 0x2e, 0x72, 0x0a, 0x2b, 0x54, 0x6b, 0x8a, 0x82, 0x6c, 0xb9, 0x12, 0x01, 0xf3, 0xd7,
+    0x31, 0x17, 0xe6, 0x65, 0x70, 0xf1, 0xad, 0xe0, 0xe2, 0x97, 0x79, 0x17, 0x4f, 0x4c, 0xdb, 0x4e,
+    0x5d, 0xbc, 0xbb, 0x2c, 0x20, 0x7e, 0x15, 0xb8, 0x78, 0x15, 0xb8, 0x38, 0xb0, 0x43, 0xa8, 0xbd,
+    0x93, 0x57, 0x78, 0x6e, 0xac, 0x8d, 0x9a, 0x71, 0x36, 0x6e, 0xd6, 0x88, 0x0c, 0xb6, 0x67, 0x0d,
+    0x7a, 0xf8, 0x1a, 0x67, 0x11, 0x6b, 0xd9, 0xdc, 0xd0, 0xa2, 0xb0, 0x85, 0x8c, 0xd2, 0x2d, 0x75,
+    0x45, 0xaa, 0xb5, 0x8c, 0xa9, 0x9f, 0x18, 0x62, 0x03, 0x45, 0x77, 0x59, 0x56, 0xaa, 0x29, 0x50,
+    0xb1, 0x95, 0x7f, 0x5a, 0x17, 0x3f, 0x83, 0x5a, 0x7d, 0x1c, 0xcc, 0x55, 0x10, 0xc1, 0x20, 0x39,
+    0x8d, 0x89, 0xe9, 0x49, 0xe1, 0xff, 0x16, 0x13, 0x1b, 0xb7, 0x67, 0xe9, 0x9a, 0xd1, 0x78, 0x50,
+    0xf8, 0x99, 0x53, 0x45, 0x69, 0xd6, 0xe6, 0xca, 0x80, 0xc0, 0xfa, 0x5d, 0x25, 0x7d, 0x6f, 0x54,
+    0x8f, 0x7a, 0x64, 0x69, 0x42, 0x53, 0x5d, 0x25, 0x7e, 0xd9, 0xe1, 0x2b, 0x4f, 0x94, 0x84, 0xb4,
+    0x3e, 0x57, 0xbe, 0xed, 0x7a, 0xcd, 0xb7, 0x6c, 0x44, 0x85, 0x42, 0x93, 0xe3, 0x8d, 0x9d, 0x9d,
+    0x82, 0x7c, 0xad, 0x2c, 0xe5, 0xda, 0xea, 0xc8, 0xf0, 0xf6, 0x3c, 0xff, 0xfc, 0x5d, 0x3a, 0x8f,
+    0x04, 0x1f, 0xd7, 0x50, 0xe7, 0xf9, 0x1e, 0x52, 0x7b, 0xb3, 0x79, 0xa9, 0x5d, 0xba, 0xd8, 0x8e,
+    0x6c, 0xdf, 0x9a, 0x03, 0xb9, 0x11, 0xc9, 0x52, 0x69, 0x08, 0xb5, 0x6c, 0xd3, 0xc9, 0xef, 0x48,
+    0x9b, 0x20, 0x02, 0xf4, 0x2f, 0x31, 0xae, 0x7f, 0xa7, 0xc2, 0x5b, 0xc3, 0x3e, 0x16, 0xf0, 0x41,
+    0xea, 0xf5, 0x7b, 0x46, 0x46, 0xed, 0xfc, 0xa5, 0x73, 0xbd, 0xcd, 0xb0, 0x7d, 0xb2, 0x2c, 0x7d,
+    0x4d, 0x2c, 0x1b, 0x38, 0x32, 0x82, 0x4d, 0xc6, 0xbf, 0xf1, 0x93, 0x5b, 0x08, 0x99, 0xb3, 0x26,
+    0x66, 0x41, 0x1b, 0x1a, 0x81, 0x56, 0x07, 0x1f, 0xc3, 0x04, 0x1a, 0xbc, 0x84, 0x9f, 0x1b, 0x2d,
+    0x95, 0x53, 0x01, 0x3e, 0x8d, 0x9a, 0x8d, 0x21, 0xbe, 0xe8, 0xc1, 0x57, 0x56, 0xa9, 0xbe, 0xe5,
+    0xc3, 0x4b, 0x92, 0xd7, 0x15, 0xfb, 0x8f, 0xda, 0xfa, 0xaa, 0x9d, 0xaa, 0x3a, 0x64, 0x93, 0x4c,
+    0x10, 0x60, 0xc4, 0x5d, 0xb2, 0xe4, 0x4c, 0x6f, 0x82, 0x77, 0xc9, 0xce, 0x3a, 0x72, 0x5e, 0x1f,
+    0x11, 0x94, 0xec, 0x6b, 0x95, 0x3a, 0x40, 0xb9, 0x84, 0x31, 0x60, 0x3e, 0xe7, 0x29, 0x9b, 0xd0,
+    0xf5, 0x14, 0x1f, 0xf8, 0xda, 0x40, 0x0c, 0x75, 0x1b, 0x9b, 0x8c, 0x71, 0x7d, 0xc3, 0xe7, 0xb0,
+    0xd9, 0xec, 0x61, 0x6e, 0xc3, 0x6b, 0xcc, 0x0a, 0x8a, 0x8a, 0x13, 0xdd, 0xe7, 0xa1, 0x2a, 0xd4,
+    0x95, 0x42, 0xdc, 0xfd, 0x36, 0x64, 0x1f, 0x47, 0xcf, 0x15, 0x96, 0x32, 0x11, 0x03, 0xd1, 0xb3,
+    0xcd, 0x54, 0xf4, 0x0c, 0x39, 0xc6, 0x15, 0x3f, 0x3f, 0xb6, 0x73, 0xd1, 0xc4, 0x40, 0xc7, 0x1b,
+    0xe6, 0x3b, 0xb9, 0xcf, 0x18, 0xfd, 0xc5, 0x7b, 0xdc, 0xed, 0x9d, 0xe7, 0x7e, 0x71, 0x18, 0x98,
+    0x5c, 0x74, 0x9f, 0x89, 0x9f, 0x98, 0xb8, 0x0c, 0x14, 0x5f, 0xfe, 0x0e, 0x2e, 0x17, 0x98, 0x48,
+    0x9e, 0xfc, 0xa5, 0x31, 0x26, 0x6c, 0x9c, 0x8e, 0xa9, 0x03, 0x70, 0xf5, 0x4f, 0xa0, 0x4f, 0x77,
+    0x0e, 0x2c, 0x2d, 0x69, 0xcc, 0xcc, 0x30, 0x34, 0x6c, 0xf6, 0xbf, 0xf1, 0x01, 0x36, 0xe1, 0xce,
+    0xe2, 0x4c, 0xee, 0x97, 0xdb, 0xb7, 0xb9, 0x9f, 0x71, 0x06, 0xf7, 0x0a, 0x00, 0xc0, 0xb3, 0xb8,
+    0x4a, 0xff, 0xbd, 0xfe, 0x16, 0x6e, 0xe7, 0x06, 0x88, 0x2b, 0xb1, 0x04, 0xa9, 0x66, 0x71, 0x09,
+    0xcc, 0x1d, 0x68, 0x6f, 0x09, 0x2b, 0x32, 0x90, 0xca, 0x11, 0xf3, 0xc1, 0x9c, 0xab, 0xab, 0x31,
+    0xb6, 0x03, 0x11, 0x61, 0xe1, 0x78, 0x1a, 0xbb, 0x60, 0xc2, 0x25, 0xcd, 0xf1, 0x4d, 0x5c, 0x9a,
+    0xba, 0x20, 0x68, 0x1e, 0x36, 0xb5, 0x33, 0x09, 0x4e, 0x91, 0x59, 0xe4, 0x60, 0xec, 0xf1, 0x22,
+    0xd7, 0xd1, 0xce, 0x5c, 0x19, 0x77, 0x74, 0x2b, 0xca, 0x94, 0xcf, 0x14, 0x9e, 0xc5, 0xc4, 0x4e,
+    0xad, 0x60, 0x9f, 0x9e, 0xf8, 0x98, 0xf3, 0x60, 0xe9, 0xe7, 0x3a, 0x28, 0x15, 0x2e, 0xaf, 0x03,
+    0xfd, 0xff, 0x18, 0x5f, 0x33, 0xaf, 0x4f, 0x7c, 0xca, 0x98, 0xeb, 0xc3, 0x87, 0xc9, 0xb9, 0x7d,
+    0x85, 0xfa, 0x39, 0x97, 0x2e, 0x5d, 0x22, 0x5f, 0x4d, 0x14, 0xec, 0x62, 0xf6, 0x5e, 0xba, 0x44,
+    0x35, 0x1e, 0xc0, 0x0d, 0x91, 0x27, 0x85, 0x21, 0x30, 0x9b, 0x38, 0x83, 0x74, 0x60, 0x0a, 0x86,
+    0x23, 0x60, 0xb9, 0x1f, 0xdd, 0x7f, 0x52, 0x28, 0x2c, 0x45, 0x7c, 0xc4, 0x01, 0x86, 0x2b, 0x37,
+    0x1c, 0x0f, 0x5b, 0x5b, 0x93, 0x22, 0xdf, 0xaa, 0xc4, 0xcc, 0xb3, 0xdb, 0xab, 0xf2, 0x34, 0xc3,
+    0x67, 0x7d, 0xfb, 0x86, 0x35, 0x6e, 0x99, 0x91, 0xdb, 0xcf, 0x66, 0x3a, 0x26, 0x0b, 0x43, 0xfa,
+    0xa5, 0x2f, 0xb7, 0xdc, 0x28, 0xdf, 0x5f, 0x32, 0xd0, 0x59, 0x79, 0xa3, 0xe6, 0xcc, 0xc6, 0x47,
+    0xa2, 0x01, 0xd7, 0x8d, 0x67, 0x6a, 0xae, 0x47, 0x95, 0x29, 0x37, 0xea, 0x5e, 0xa8, 0xbc, 0x9e,
+    0xb8, 0xb6, 0x04, 0xb4, 0x79, 0x9c, 0x7b, 0x80, 0x53, 0xa6, 0xed, 0xaa, 0xa4, 0x3c, 0x27, 0x18,
+    0x79, 0x14, 0x2e, 0x7c, 0x95, 0x72, 0x63, 0x0b, 0xdc, 0xb4, 0x00, 0x37, 0x96, 0x74, 0xa5, 0x92,
+    0xae, 0xe4, 0x01, 0x12, 0xb4, 0x24, 0xa1, 0xe6, 0x49, 0xb9, 0x60, 0xf8, 0xc3, 0x3e, 0x1a, 0x85,
+    0x48, 0x16, 0x1a, 0x38, 0xb5, 0xf5, 0xed, 0x1f, 0x56, 0xbb, 0x65, 0x45, 0x0e, 0x9d, 0xcb, 0x5c,
+    0x90, 0x2c, 0xf1, 0x8d, 0x4a, 0x72, 0xcc, 0x3c, 0x37, 0x54, 0x59, 0xa0, 0x1e, 0x16, 0x9c, 0xec,
+    0x77, 0x81, 0xce, 0x6f, 0x44, 0x94, 0x2b, 0xd7, 0x15, 0x3e, 0x57, 0x7e, 0x23, 0x71, 0x5d, 0xc9,
+    0xaf, 0xbf, 0x0c, 0x3c, 0x51, 0xb2, 0x36, 0xf1, 0x7a, 0xe5, 0xbe, 0xc2, 0x75, 0xcb, 0x2a, 0xaf,
+    0x03, 0x87, 0x74, 0x74, 0xdb, 0xf0, 0x06, 0xf6, 0xaf, 0x8c, 0x0f, 0x1d, 0x65, 0x8d, 0xc1, 0x8c,
+    0x5d, 0x5c, 0x7f, 0x1f, 0x95, 0xdb, 0x18, 0xcf, 0x1a, 0xec, 0x5f, 0xf1, 0xcd, 0x5e, 0x16, 0x9b,
+    0xd1, 0x1d, 0xef, 0x9d, 0xe2, 0xed, 0xa5, 0x76, 0x7a, 0xd5, 0x37, 0xbb, 0x33, 0x36, 0xa3, 0x37,
+    0xda, 0x37, 0xc9, 0xd3, 0x2b, 0xd2, 0x85, 0x11, 0xe3, 0xac, 0x2d, 0xb5, 0x41, 0x11, 0x91, 0x9e,
+    0x3e, 0x3e, 0x59, 0xaa, 0xec, 0xcd, 0x55, 0x01, 0xd1, 0x1a, 0x6f, 0x6f, 0x59, 0xde, 0xe4, 0x24,
+    0xd2, 0xc2, 0x42, 0xff, 0x30, 0x3e, 0x21, 0x14, 0xa1, 0x7a, 0x84, 0xb8, 0x6d, 0x50, 0xd2, 0x03,
+    0x72, 0x62, 0x7c, 0x08, 0x4a, 0xea, 0xa0, 0x64, 0x08, 0x4a, 0x42, 0xa0, 0x64, 0x04, 0x9f, 0x84,
+    0x92, 0x5a, 0x63, 0x89, 0x92, 0xeb, 0x87, 0x56, 0xb4, 0x64, 0x89, 0xb1, 0x44, 0x01, 0x75, 0x5e,
+    0xc3, 0x87, 0xa1, 0xa4, 0xc1, 0x58, 0x92, 0x02, 0x75, 0x8e, 0xf1, 0x25, 0x8d, 0xc6, 0x92, 0x24,
+    0x28, 0x39, 0x8b, 0x4f, 0x43, 0x49, 0xd3, 0x63, 0x3a, 0x43, 0xc6, 0x3a, 0xcd, 0xc6, 0x92, 0x04,
+    0xa8, 0x73, 0x84, 0xa7, 0xbc, 0xd4, 0x58, 0x12, 0x03, 0xb6, 0xfa, 0x02, 0x5f, 0xd2, 0x42, 0x4b,
+    0x40, 0x2b, 0x14, 0x34, 0x46, 0x98, 0x05, 0xc8, 0x76, 0xfa, 0x29, 0x21, 0x28, 0x65, 0xda, 0xf9,
+    0x1d, 0xdd, 0x52, 0x20, 0x23, 0xfa, 0xbd, 0xd8, 0xc1, 0x7d, 0xb1, 0x4d, 0x80, 0x5c, 0x1d, 0x76,
+    0x3a, 0xae, 0xb7, 0xa8, 0x78, 0x7d, 0x8c, 0x6f, 0x7e, 0xc4, 0xe0, 0x96, 0x2d, 0xcb, 0xb1, 0x89,
+    0x73, 0x98, 0xbf, 0x85, 0x87, 0x32, 0x46, 0x16, 0xb7, 0x3c, 0x36, 0xb0, 0x5e, 0xab, 0x2c, 0x2c,
+    0x50, 0xb6, 0x03, 0x65, 0x1a, 0x58, 0x61, 0xc6, 0x6a, 0xea, 0x94, 0x52, 0x24, 0x77, 0x26, 0xf8,
+    0xd4, 0x35, 0x5c, 0xcf, 0x58, 0x4d, 0x7c, 0x47, 0xd4, 0x8b, 0x37, 0xd3, 0xd9, 0x52, 0x3b, 0xf9,
+    0x13, 0x39, 0x0c, 0xbd, 0xd3, 0xef, 0x18, 0xe8, 0x6e, 0x91, 0x11, 0xa1, 0xa6, 0x4e, 0x81, 0x98,
+    0xc7, 0xa7, 0x89, 0x53, 0x0b, 0x24, 0x72, 0x58, 0xdb, 0x97, 0x9b, 0xdf, 0x97, 0xa8, 0xed, 0xcb,
+    0xcb, 0xeb, 0x4b, 0x3c, 0x6d, 0xa7, 0x80, 0xda, 0x76, 0x76, 0x4a, 0xb8, 0xda, 0xe2, 0x8f, 0x9f,
+    0x69, 0xda, 0x1a, 0x13, 0xb3, 0xb5, 0x09, 0x6e, 0xb1, 0xb1, 0x5b, 0xb9, 0x1f, 0x8e, 0x85, 0x68,
+    0x9d, 0x9c, 0xb4, 0x21, 0xc7, 0x42, 0xb5, 0x52, 0xa9, 0x96, 0x3f, 0x09, 0x34, 0xf6, 0x36, 0x17,
+    0xc9, 0x7e, 0x3b, 0xad, 0xfc, 0x77, 0x59, 0x0d, 0x67, 0x95, 0xc6, 0xbc, 0x71, 0xab, 0x0f, 0xaa,
+    0x1a, 0x4e, 0x2a, 0xcd, 0xb2, 0x3d, 0x02, 0xec, 0x94, 0xea, 0xc5, 0x11, 0xa7, 0x53, 0x36, 0x24,
+    0xe7, 0x0f, 0x24, 0xc6, 0xac, 0xca, 0x68, 0x6b, 0x2b, 0x5c, 0x17, 0x95, 0xb1, 0x25, 0x2f, 0x61,
+    0x30, 0xff, 0x4c, 0x6c, 0x88, 0x26, 0x4c, 0xaa, 0xf6, 0xc0, 0xef, 0xcf, 0xf5, 0xb4, 0x77, 0x52,
+    0xba, 0x3b, 0xc7, 0x94, 0xfb, 0xcb, 0xca, 0xe3, 0x55, 0x39, 0x8b, 0xdd, 0xd3, 0x3c, 0x72, 0xa2,
+    0xe3, 0xab, 0x15, 0x8b, 0x6b, 0xb3, 0x5c, 0x03, 0x54, 0x1e, 0x2e, 0xde, 0xfc, 0x5e, 0x99, 0x02,
+    0x2e, 0xaf, 0x31, 0x92, 0xe9, 0x27, 0x93, 0x22, 0x11, 0xbf, 0xfb, 0xfb, 0x9a, 0xbe, 0xdb, 0x14,
+    0x37, 0x6e, 0xde, 0x3d, 0x82, 0xdb, 0x4f, 0x63, 0xd5, 0x50, 0x3b, 0x1e, 0x1b, 0xfb, 0x02, 0xdf,
+    0x9e, 0xb8, 0x07, 0x95, 0xe9, 0x69, 0x37, 0xc8, 0x71, 0x0c, 0xb2, 0x8e, 0xe0, 0x3b, 0xfc, 0xb9,
+    0xa4, 0x68, 0x1a, 0xfb, 0x34, 0xd4, 0x96, 0x59, 0x1b, 0x59, 0x06, 0xe1, 0x1e, 0x6e, 0xf1, 0xc7,
+    0xdf, 0x71, 0x87, 0xad, 0xc5, 0x09, 0x9e, 0xd9, 0x9d, 0xea, 0xf0, 0xf5, 0x55, 0xda, 0xfe, 0x6c,
+    0xe6, 0x34, 0x89, 0xf0, 0x8f, 0xf4, 0x8f, 0x0a, 0x97, 0x2b, 0x70, 0xa1, 0x13, 0x1e, 0xda, 0xb2,
+    0x53, 0x68, 0x1d, 0xb2, 0x34, 0x35, 0x66, 0x65, 0x92, 0xb2, 0x3a, 0xd6, 0xcb, 0x2d, 0x41, 0xae,
+    0x8a, 0xb6, 0xe5, 0xd7, 0x63, 0x3f, 0x91, 0xb3, 0xcc, 0x42, 0xba, 0xbf, 0xc2, 0x9f, 0x41, 0x4e,
+    0x1b, 0x07, 0xe3, 0x37, 0x19, 0xf4, 0x50, 0xfe, 0x77, 0xca, 0xa2, 0x93, 0x20, 0xb1, 0xb6, 0x9b,
+    0x99, 0xb3, 0x2e, 0x76, 0x41, 0x90, 0x9b, 0xb3, 0x72, 0x41, 0x78, 0xb0, 0x7b, 0x98, 0x13, 0xf6,
+    0xc5, 0xaa, 0x06, 0x6d, 0x7a, 0x93, 0x2a, 0xa1, 0x37, 0xbf, 0x70, 0x73, 0x6a, 0xc4, 0x8a, 0x83,
+    0xcc, 0xc2, 0x21, 0x9f, 0x46, 0x5d, 0xfb, 0xe2, 0xf0, 0x05, 0x52, 0x95, 0x93, 0x2a, 0xd4, 0xde,
+    0xd3, 0x5a, 0xea, 0x55, 0xac, 0x89, 0xec, 0x48, 0x4c, 0x5c, 0x19, 0x13, 0x37, 0x58, 0x2d, 0x6f,
+    0x3a, 0xd8, 0xa0, 0x00, 0x0e, 0x94, 0xa0, 0x21, 0x2a, 0xe9, 0x6f, 0xa7, 0x8d, 0xe4, 0x18, 0x77,
+    0xf4, 0x12, 0x20, 0x71, 0x3c, 0x23, 0xa9, 0xd4, 0xa7, 0x92, 0xb5, 0x5b, 0x61, 0x5e, 0x48, 0x00,
+    0x3e, 0x8f, 0xc0, 0xb8, 0xce, 0x01, 0xdf, 0xf6, 0xa1, 0x16, 0x5d, 0xf1, 0x7f, 0x9c, 0x26, 0xfe,
+    0x2f, 0xa7, 0x8d, 0xc6, 0xd7, 0xe4, 0x48, 0x72, 0x7f, 0x76, 0xd6, 0x40, 0x4a, 0x4a, 0x7f, 0x56,
+    0x76, 0x7f, 0xca, 0xa9, 0x05, 0x4a, 0x27, 0x27, 0x85, 0xbd, 0x3d, 0x5c, 0x95, 0x0e, 0xcf, 0xc7,
+    0x75, 0x65, 0xa4, 0x77, 0xc7, 0xc5, 0x75, 0xa7, 0xc1, 0xf5, 0x8c, 0x8d, 0xb7, 0xa3, 0xaf, 0xe2,
+    0x09, 0x9f, 0x05, 0x8b, 0xfd, 0x6f, 0x69, 0x2b, 0x64, 0xb2, 0x0a, 0x6d, 0x74, 0xa9, 0x42, 0x51,
+    0xaa, 0x70, 0xf0, 0xb0, 0xb1, 0xf1, 0x70, 0xb0, 0xf7, 0xb2, 0xb1, 0xf1, 0xc2, 0x1d, 0x61, 0x85,
+    0x32, 0x59, 0x61, 0x58, 0x5c, 0xa9, 0x4c, 0x56, 0x9a, 0x69, 0xeb, 0x6a, 0xed, 0xb3, 0x68, 0x9e,
+    0xbb, 0x0d, 0x3d, 0xdf, 0x8d, 0x99, 0xfc, 0x99, 0xbc, 0x00, 0x3c, 0x7b, 0x23, 0xd4, 0xf1, 0xbb,
+    0xef, 0x6f, 0x1e, 0x6b, 0xd8, 0xe6, 0xdf, 0x98, 0x34, 0xc4, 0x90, 0xd2, 0x8f, 0x66, 0xe7, 0xb6,
+    0x07, 0x3b, 0xc8, 0x9d, 0x9d, 0x15, 0x76, 0xb6, 0x2a, 0x77, 0x77, 0x95, 0xbd, 0x32, 0xb4, 0x3a,
+    0x2c, 0xad, 0x3d, 0x24, 0xa1, 0x2f, 0x2f, 0xb7, 0x2f, 0x29, 0xb4, 0xf5, 0x40, 0xf5, 0x9c, 0x5e,
+    0xf7, 0xb2, 0xac, 0x67, 0x16, 0x87, 0xda, 0xbb, 0x84, 0xb9, 0x38, 0xab, 0x16, 0xd8, 0x7b, 0x58,
+    0x3a, 0xf8, 0xe5, 0xa9, 0xc2, 0xda, 0xd3, 0x92, 0xba, 0x13, 0x63, 0x9e, 0xaa, 0x97, 0xb7, 0xec,
+    0xaf, 0xf1, 0xe3, 0xbf, 0x81, 0x13, 0xa1, 0x3c, 0xfa, 0xe5, 0x1c, 0x4b, 0xbf, 0xd1, 0x34, 0xe3,
+    0xe3, 0x75, 0xc8, 0x63, 0x84, 0x66, 0xc1, 0x93, 0x21, 0x8f, 0x61, 0xa6, 0x9d, 0x67, 0xcc, 0xc3,
+    0xfc, 0x86, 0x9c, 0x8c, 0x79, 0x11, 0xe4, 0x7d, 0x8d, 0x79, 0x57, 0xc8, 0x07, 0x1b, 0xf3, 0x6e,
+    0x50, 0x3f, 0x16, 0xa5, 0xa1, 0x0a, 0x54, 0x85, 0xda, 0x00, 0x05, 0x75, 0x80, 0x3c, 0xd9, 0xf0,
+    0x54, 0x03, 0xcf, 0xd5, 0xa8, 0x15, 0xf2, 0x35, 0xa8, 0x1c, 0xee, 0xd5, 0x28, 0x0e, 0xae, 0x3a,
+    0xa8, 0x51, 0x83, 0xca, 0x50, 0x22, 0xd4, 0x28, 0x87, 0x5c, 0x1b, 0x20, 0x60, 0x12, 0x20, 0xdc,
+    0x52, 0xb8, 0xd3, 0x77, 0x69, 0x90, 0xa7, 0xb9, 0x06, 0xfe, 0x2b, 0x3f, 0xf8, 0x4d, 0xd6, 0xd2,
+    0x6f, 0xd9, 0xfe, 0xc3, 0x8f, 0x7e, 0xed, 0x37, 0x03, 0xcd, 0x00, 0x84, 0x9b, 0xc3, 0x7f, 0xe3,
+    0x37, 0xeb, 0xf1, 0x37, 0xa3, 0x04, 0x2d, 0x44, 0x41, 0x50, 0xa6, 0x41, 0xf9, 0xf4, 0x0b, 0x0f,
+    0x28, 0x33, 0x05, 0xac, 0xb3, 0x47, 0x38, 0x32, 0x5a, 0x9b, 0x01, 0x6d, 0x58, 0x9e, 0xee, 0xe4,
+    0xb4, 0x6f, 0x46, 0x4d, 0x61, 0xa5, 0xe2, 0x8f, 0x58, 0xfe, 0xfd, 0xbc, 0xb2, 0x65, 0x4b, 0xeb,
+    0x91, 0x53, 0xd5, 0xd2, 0x8a, 0x3a, 0xe4, 0x54, 0xaf, 0x6b, 0x6d, 0x00, 0x0d, 0xfc, 0xbe, 0xc5,
+    0x54, 0x3b, 0xba, 0x5f, 0x36, 0xf5, 0x2d, 0x22, 0x42, 0x9e, 0x88, 0x74, 0x94, 0xb7, 0x56, 0x83,
+    0xfe, 0x50, 0x47, 0x55, 0x75, 0x2b, 0xdc, 0x70, 0x4d, 0xab, 0xae, 0x1e, 0x53, 0x7e, 0x84, 0xc8,
+    0x82, 0xf6, 0x4f, 0xb9, 0x03, 0xdd, 0x95, 0x1b, 0x5b, 0x23, 0x2c, 0xc2, 0x0f, 0xf9, 0x31, 0x80,
+    0x3a, 0xd8, 0xed, 0x31, 0x37, 0xe8, 0xff, 0x01
 };
 
 #endif // ROBOTO_MEDIUM
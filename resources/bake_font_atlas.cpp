@@ -0,0 +1,94 @@
+// Bakes the app's fonts into a ready-to-upload atlas header, so startup skips TTF parsing
+// and rasterization entirely (build main with -DUSE_BAKED_FONT_ATLAS to use it).
+//
+// build (from the repo root, or run the "bake font atlas" task):
+//   g++ -std=c++14 -I C:/raylib/raylib/src resources/bake_font_atlas.cpp font_library.cpp app_fonts.cpp
+//       -L C:/raylib/raylib/src -lraylib -lopengl32 -lgdi32 -lwinmm -o bake_font_atlas.exe
+// run:
+//   bake_font_atlas.exe resources/FONT_ATLAS.h
+
+#include <cstdio>
+#include "raylib.h"
+#include "../app_fonts.h"
+
+static void writeBytes(FILE* out, const unsigned char* data, int size) {
+    const int bytesPerLine = 16;
+    for (int i = 0; i < size; i++) {
+        if (i % bytesPerLine == 0) fprintf(out, "    ");
+        fprintf(out, "0x%02x", data[i]);
+        if (i + 1 < size) fprintf(out, ",");
+        fprintf(out, ((i + 1) % bytesPerLine == 0 || i + 1 == size) ? "\n" : " ");
+    }
+}
+
+int main(int argc, char** argv) {
+    const char* headerPath = (argc > 1) ? argv[1] : "resources/FONT_ATLAS.h";
+
+    // same registration as the app, CPU only, no window or GL context
+    FontLibrary fonts(APP_FONT_SIZE, APP_FONT_RENDER_MODE);
+    RegisterAppFonts(fonts);
+    Image atlas = fonts.BakeSharedAtlas();
+
+    int pixelsSize = atlas.width * atlas.height * 2; // gray-alpha
+    int compressedSize = 0;
+    unsigned char* compressed = CompressData((const unsigned char*)atlas.data, pixelsSize, &compressedSize);
+
+    FILE* out = fopen(headerPath, "w");
+    if (!out) {
+        fprintf(stderr, "could not open %s\n", headerPath);
+        return 1;
+    }
+
+    Rectangle shapes = fonts.GetShapesRect();
+    bool sdf = (fonts.GetRenderMode() == FontRenderMode::Sdf);
+
+    fprintf(out, "#ifndef FONT_ATLAS_H\n#define FONT_ATLAS_H\n\n");
+    fprintf(out, "#include \"../baked_font_atlas.h\"\n\n");
+    fprintf(out, "// generated by bake_font_atlas.cpp: %dx%d %s atlas, raw DEFLATE, %d bytes -> %d bytes\n",
+            atlas.width, atlas.height, sdf ? "SDF" : "bitmap", compressedSize, pixelsSize);
+    fprintf(out, "static const unsigned char font_atlas_data[] = {\n");
+    writeBytes(out, compressed, compressedSize);
+    fprintf(out, "};\n\n");
+
+    for (int f = 0; f < (int)FontId::Count; f++) {
+        if (!fonts.IsLoaded((FontId)f)) continue;
+
+        const Font& font = fonts.Get((FontId)f);
+        fprintf(out, "static const BakedGlyph font_atlas_glyphs_%d[] = {\n", f);
+        for (int g = 0; g < font.glyphCount; g++) {
+            const GlyphInfo& glyph = font.glyphs[g];
+            const Rectangle& rec = font.recs[g];
+            fprintf(out, "    {%d, %d, %d, %d, %.1ff, %.1ff, %.1ff, %.1ff}%s\n",
+                    glyph.value, glyph.offsetX, glyph.offsetY, glyph.advanceX,
+                    rec.x, rec.y, rec.width, rec.height, (g + 1 < font.glyphCount) ? "," : "");
+        }
+        fprintf(out, "};\n\n");
+    }
+
+    fprintf(out, "static const BakedFont font_atlas_fonts[] = {\n");
+    for (int f = 0; f < (int)FontId::Count; f++) {
+        const char* separator = (f + 1 < (int)FontId::Count) ? "," : "";
+        if (fonts.IsLoaded((FontId)f)) {
+            const Font& font = fonts.Get((FontId)f);
+            fprintf(out, "    {%d, %d, font_atlas_glyphs_%d}%s\n", font.glyphCount, font.glyphPadding, f, separator);
+        } else {
+            fprintf(out, "    {0, 0, nullptr}%s\n", separator);
+        }
+    }
+    fprintf(out, "};\n\n");
+
+    fprintf(out, "static const BakedFontAtlas font_atlas = {\n");
+    fprintf(out, "    %d, %d, %d, %s,\n", atlas.width, atlas.height, fonts.GetFontSize(), sdf ? "true" : "false");
+    fprintf(out, "    {%.1ff, %.1ff, %.1ff, %.1ff},\n", shapes.x, shapes.y, shapes.width, shapes.height);
+    fprintf(out, "    font_atlas_data, (int)sizeof(font_atlas_data),\n");
+    fprintf(out, "    font_atlas_fonts, %d\n", (int)FontId::Count);
+    fprintf(out, "};\n\n#endif // FONT_ATLAS_H\n");
+    fclose(out);
+
+    printf("%s: %dx%d atlas, %d bytes compressed\n", headerPath, atlas.width, atlas.height, compressedSize);
+
+    MemFree(compressed);
+    UnloadImage(atlas);
+    fonts.UnloadAll();
+    return 0;
+}
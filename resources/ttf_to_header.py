@@ -1,35 +1,114 @@
+import argparse
+import io
 import os
+import zlib
 
-ttf_path = "NotoSansSymbols2-Regular.ttf"
-file_name = "NOTO_SYMBOLS"
-array_name = "font_data_symbol"
-header_path = file_name + ".h"
+# codepoints the app actually rasterizes: printable ASCII + subscript digits (see RegisterAppFonts in app_fonts.cpp)
+DEFAULT_CODEPOINTS = list(range(32, 127)) + list(range(0x2080, 0x208A))
 
 
+def parse_codepoints(spec):
+    """'32-126,0x2080-0x2089,0x27A4' -> list of ints"""
+    codepoints = []
+    for part in spec.split(','):
+        part = part.strip()
+        if not part:
+            continue
+        if '-' in part:
+            start, end = part.split('-', 1)
+            codepoints.extend(range(int(start, 0), int(end, 0) + 1))
+        else:
+            codepoints.append(int(part, 0))
+    return codepoints
 
-with open(ttf_path, 'rb') as f:
+
+def subset_font(font_data, codepoints):
+    # stb_truetype (used by raylib) ignores hinting, kerning and layout tables, so drop them
+    from fontTools import subset
+    from fontTools.ttLib import TTFont
+
+    options = subset.Options()
+    options.hinting = False
+    options.layout_features = []
+    options.name_IDs = []
+    options.notdef_outline = True
+    options.glyph_names = False
+
+    font = TTFont(io.BytesIO(font_data), recalcTimestamp=False) # keep output reproducible
+    subsetter = subset.Subsetter(options)
+    subsetter.populate(unicodes=codepoints)
+    subsetter.subset(font)
+
+    out = io.BytesIO()
+    font.save(out)
+    return out.getvalue()
+
+
+def compress_raw_deflate(data):
+    # raw DEFLATE (no zlib header), the format raylib's DecompressData() expects
+    compressor = zlib.compressobj(9, zlib.DEFLATED, -15)
+    return compressor.compress(data) + compressor.flush()
+
+
+def write_header(header_path, file_name, array_name, payload, note):
+    with open(header_path, 'w') as f:
+        f.write(f"#ifndef {file_name}_H\n")
+        f.write(f"#define {file_name}_H\n\n")
+        if note:
+            f.write(f"// {note}\n")
+        f.write(f"static const unsigned char {array_name}[] = {{\n")
+
+        bytes_per_line = 16
+        for i in range(0, len(payload), bytes_per_line):
+            chunk = payload[i:i + bytes_per_line]
+            hex_values = ', '.join(f'0x{b:02x}' for b in chunk)
+            f.write(f"    {hex_values}")
+
+            if i + bytes_per_line < len(payload):
+                f.write(',')
+
+            f.write('\n')
+
+        f.write("};\n\n")
+        f.write(f"#endif // {file_name}\n")
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Embed a TTF as a C header, optionally subset and compressed")
+    parser.add_argument("ttf_path", help="e.g. NotoSansSymbols2-Regular.ttf")
+    parser.add_argument("file_name", help="header name without extension, e.g. NOTO_SYMBOLS")
+    parser.add_argument("--array-name", default=None, help="e.g. font_data_symbol (derived from the ttf name if omitted)")
+    parser.add_argument("--codepoints", default=None,
+                        help="subset to these codepoints, e.g. '32-126,0x27A4,0x25BC' (default: ASCII + subscript digits)")
+    parser.add_argument("--no-subset", action="store_true", help="embed the full font")
+    parser.add_argument("--compress", action="store_true",
+                        help="raw DEFLATE the data, load with FontLibrary::RegisterCompressed")
+    args = parser.parse_args()
+
+    with open(args.ttf_path, 'rb') as f:
         font_data = f.read()
-    
-if array_name is None:
-    base_name = os.path.splitext(os.path.basename(ttf_path))[0]
-    array_name = ''.join(c if c.isalnum() or c == '_' else '_' for c in base_name)
-    array_name = f"font_data_{array_name.lower()}"
-
-with open(header_path, 'w') as f:
-    f.write(f"#ifndef {file_name}_H\n")
-    f.write(f"#define {file_name}_H\n\n")
-    f.write(f"static const unsigned char {array_name}[] = {{\n")
-    
-    bytes_per_line = 16
-    for i in range(0, len(font_data), bytes_per_line):
-        chunk = font_data[i:i + bytes_per_line]
-        hex_values = ', '.join(f'0x{b:02x}' for b in chunk)
-        f.write(f"    {hex_values}")
-        
-        if i + bytes_per_line < len(font_data):
-            f.write(',')
-        
-        f.write('\n')
-    
-    f.write("};\n\n")
-    f.write(f"#endif // {file_name}\n")
\ No newline at end of file
+
+    array_name = args.array_name
+    if array_name is None:
+        base_name = os.path.splitext(os.path.basename(args.ttf_path))[0]
+        array_name = ''.join(c if c.isalnum() or c == '_' else '_' for c in base_name)
+        array_name = f"font_data_{array_name.lower()}"
+
+    notes = []
+    if not args.no_subset:
+        codepoints = parse_codepoints(args.codepoints) if args.codepoints else DEFAULT_CODEPOINTS
+        font_data = subset_font(font_data, codepoints)
+        notes.append(f"subset to {len(codepoints)} codepoints")
+
+    payload = font_data
+    if args.compress:
+        payload = compress_raw_deflate(font_data)
+        notes.append(f"raw DEFLATE, {len(payload)} bytes -> {len(font_data)} bytes")
+
+    header_path = args.file_name + ".h"
+    write_header(header_path, args.file_name, array_name, payload, ", ".join(notes))
+    print(f"{header_path}: {len(payload)} bytes")
+
+
+if __name__ == "__main__":
+    main()
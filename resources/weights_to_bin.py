@@ -0,0 +1,44 @@
+import argparse
+import csv
+import struct
+
+# layout read by LoadWeightTableFile() in weight_table.cpp
+MAGIC = b"MMWT"
+VERSION = 1
+
+
+def read_weights(csv_path):
+    """'atomic_number,weight' rows, blank lines and '#' comments ignored -> list of (int, float)"""
+    records = []
+    with open(csv_path, newline='') as f:
+        for row in csv.reader(f):
+            if not row or row[0].strip().startswith('#'):
+                continue
+            if not row[0].strip().isdigit():  # header row
+                continue
+            records.append((int(row[0]), float(row[1])))
+    return records
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Pack an atomic weight CSV into the app's binary dataset format")
+    parser.add_argument("csv_path", help="rows of atomic_number,weight, e.g. 3,6.94")
+    parser.add_argument("out_path", help="e.g. weights.bin (loaded at startup) or any .bin dropped on the window")
+    parser.add_argument("--name", required=True, help="shown in the app, e.g. 'IUPAC 2021 abridged'")
+    args = parser.parse_args()
+
+    records = read_weights(args.csv_path)
+    name = args.name.encode('utf-8')
+
+    with open(args.out_path, 'wb') as f:
+        f.write(MAGIC)
+        f.write(struct.pack('<III', VERSION, len(records), len(name)))
+        f.write(name)
+        for atomic_number, weight in records:
+            f.write(struct.pack('<Id', atomic_number, weight))
+
+    print(f"{args.out_path}: {len(records)} weights")
+
+
+if __name__ == "__main__":
+    main()
@@ -1,4 +1,5 @@
 #include "text_align.h"
+#include "debug_overlay.h"
 
 void DrawTextAligned(Font font, const char* text, Rectangle bounds, // rectangle bounding alignment
                      float fontSize, float spacing, Color color,
@@ -24,15 +25,24 @@ void DrawTextAligned(Font font, const char* text, Rectangle bounds, // rectangle
     }
 
     DrawTextEx(font, text, pos, fontSize, spacing, color);
+    DebugCountTextDraw();
 }
 
 void DrawTextAlignedAt(Font font, const char* text, float x, float y, // point alignment
                        float fontSize, float spacing, Color color,
                        HorizontalAlign hAlign, VerticalAlign vAlign)
 {
-    Vector2 textSize = MeasureTextEx(font, text, fontSize, spacing);
     Vector2 pos = { x, y };
 
+    // top-left anchored text needs no measuring
+    if (hAlign == HorizontalAlign::Left && vAlign == VerticalAlign::Top) {
+        DrawTextEx(font, text, pos, fontSize, spacing, color);
+        DebugCountTextDraw();
+        return;
+    }
+
+    Vector2 textSize = MeasureTextEx(font, text, fontSize, spacing);
+
 
     switch (hAlign) { 
         case HorizontalAlign::Center: pos.x -= textSize.x / 2.0f; break;
@@ -48,4 +58,5 @@ void DrawTextAlignedAt(Font font, const char* text, float x, float y, // point a
     }
 
     DrawTextEx(font, text, pos, fontSize, spacing, color);
+    DebugCountTextDraw();
 }
\ No newline at end of file
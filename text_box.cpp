@@ -1,10 +1,14 @@
 #include "text_box.h"
+#include "debug_overlay.h"
+#include <algorithm>
 #include <cctype>
 
 TextBox::TextBox(Rectangle rect, Font regular, Font subscript, float size, bool autoSub)
-    : bounds(rect), focused(false), cursorPos(0), cursorBlinkTimer(0.0f),
+    : textCacheChars(0), utf8CacheChars(0), textDirtyFrom(0), utf8DirtyFrom(0), revision(0),
+      bounds(rect), focused(false), cursorPos(0), cursorBlinkTimer(0.0f),
       regularFont(regular), subscriptFont(subscript), fontSize(size),
       autoSubscript(autoSub) {
+    bgColor = {0, 0, 0, 0}; // transparent, the owner usually draws the field background
     textColor = {225, 244, 242, 255};
     placeholderColor = {120, 140, 135, 255};
 }
@@ -14,55 +18,100 @@ void TextBox::SetColors(Color text, Color placeholderCol) {
     placeholderColor = placeholderCol;
 }
 
-void TextBox::updateFormatting() {
-    formatted.clear();
+void TextBox::setSubscript(int index, bool subscript) {
+    unsigned char cell = cells.At(index);
+    unsigned char updated = subscript ? (cell | FormattedChar::SUBSCRIPT_BIT) : (cell & ~FormattedChar::SUBSCRIPT_BIT);
+    if (updated == cell) return;
     
-    if (!autoSubscript) {
-        for (char c : rawText) {
-            formatted.push_back(FormattedChar(c, false));
-        }
-        return;
-    }
+    cells.Set(index, updated);
+    utf8DirtyFrom = std::min(utf8DirtyFrom, index); // plain text is unaffected by the flag
+    revision++;
+}
+
+void TextBox::markDirty(int index) {
+    textDirtyFrom = std::min(textDirtyFrom, index);
+    utf8DirtyFrom = std::min(utf8DirtyFrom, index);
+    revision++;
+}
+
+// applies auto-subscript to [start, end), digits already flagged as subscript keep their flag
+void TextBox::updateFormatting(int start, int end) {
+    if (!autoSubscript) return;
     
-    for (size_t i = 0; i < rawText.length(); i++) {
-        char c = rawText[i];
-        
-        if (std::isdigit(c) && i > 0 && std::isalpha(rawText[i - 1])) {
-            formatted.push_back(FormattedChar(c, true));
-        } else {
-            formatted.push_back(FormattedChar(c, false));
+    for (int i = start; i < end; i++) {
+        char c = charAt(i);
+        if (std::isdigit(c) && i > 0 && std::isalpha(charAt(i - 1))) {
+            setSubscript(i, true);
         }
     }
 }
 
+// symbols, counts, groups and ion charges (NH4+, SO4^2-)
+static bool isFormulaChar(char c) {
+    return std::isalnum((unsigned char)c) || c == '(' || c == ')' || c == '^' || c == '+' || c == '-';
+}
+
 void TextBox::insertChar(char c) {
-    if (std::isalnum(c) || c == '(' || c == ')') {
-        rawText.insert(cursorPos, 1, c);
-        
+    if (isFormulaChar(c)) {
         bool shouldBeSubscript = false;
-        if (autoSubscript && std::isdigit(c) && cursorPos > 0 && std::isalpha(rawText[cursorPos - 1])) {
+        if (autoSubscript && std::isdigit(c) && cursorPos > 0 && std::isalpha(charAt(cursorPos - 1))) {
             shouldBeSubscript = true;
         }
         
-        FormattedChar newChar(c, shouldBeSubscript);
-        formatted.insert(formatted.begin() + cursorPos, newChar);
-        
+        cells.Insert(cursorPos, FormattedChar(c, shouldBeSubscript).Pack());
+        markDirty(cursorPos);
         cursorPos++;
     }
 }
 
+// inserts a whole UTF-8 string at the cursor with one buffer insert and one formatting pass
+void TextBox::insertText(const char* text) {
+    if (!text) return;
+    
+    pasteCells.clear();
+    size_t i = 0;
+    while (text[i] != '\0') {
+        unsigned char byte = (unsigned char)text[i];
+        
+        // UTF-8 subscript digits U+2080..U+2089 (E2 82 80..89)
+        if (byte == 0xE2 && (unsigned char)text[i + 1] == 0x82 &&
+            (unsigned char)text[i + 2] >= 0x80 && (unsigned char)text[i + 2] <= 0x89) {
+            char digit = (char)('0' + ((unsigned char)text[i + 2] - 0x80));
+            pasteCells.push_back(FormattedChar(digit, true).Pack());
+            i += 3;
+            continue;
+        }
+        
+        if (byte < 0x80) {
+            char c = (char)byte;
+            if (isFormulaChar(c)) {
+                pasteCells.push_back(FormattedChar(c, false).Pack());
+            }
+        }
+        i++; // anything else (whitespace, other UTF-8 bytes) is dropped like unsupported keys
+    }
+    
+    if (pasteCells.empty()) return;
+    
+    int start = cursorPos;
+    cells.Insert(start, pasteCells.data(), pasteCells.size());
+    markDirty(start);
+    cursorPos += (int)pasteCells.size();
+    updateFormatting(start, cursorPos);
+}
+
 void TextBox::deleteChar() {
-    if (cursorPos < (int)rawText.length()) {
-        rawText.erase(cursorPos, 1);
-        formatted.erase(formatted.begin() + cursorPos);
+    if (cursorPos < (int)cells.Size()) {
+        cells.Erase(cursorPos);
+        markDirty(cursorPos);
     }
 }
 
 void TextBox::backspace() {
     if (cursorPos > 0) {
-        rawText.erase(cursorPos - 1, 1);
-        formatted.erase(formatted.begin() + cursorPos - 1);
+        cells.Erase(cursorPos - 1);
         cursorPos--;
+        markDirty(cursorPos);
     }
 }
 
@@ -70,26 +119,26 @@ void TextBox::toggleSubscript(bool makeSubscript) {
     if (cursorPos <= 0) return;
     
     int endPos = cursorPos - 1;
-    char endChar = rawText[endPos];
+    char endChar = charAt(endPos);
     
     if (!std::isdigit(endChar)) return;
     
     int startPos = endPos;
-    while (startPos > 0 && std::isdigit(rawText[startPos - 1])) {
+    while (startPos > 0 && std::isdigit(charAt(startPos - 1))) {
         startPos--;
     }
     
-    bool hasLetterBefore = (startPos > 0 && std::isalpha(rawText[startPos - 1]));
+    bool hasLetterBefore = (startPos > 0 && std::isalpha(charAt(startPos - 1)));
     
     if (makeSubscript) {
         if (hasLetterBefore) {
             for (int i = startPos; i <= endPos; i++) {
-                formatted[i].subscript = true;
+                setSubscript(i, true);
             }
         }
     } else {
         for (int i = startPos; i <= endPos; i++) {
-            formatted[i].subscript = false;
+            setSubscript(i, false);
         }
     }
 }
@@ -107,6 +156,10 @@ void TextBox::Update() {
     cursorBlinkTimer += GetFrameTime();
     if (cursorBlinkTimer > 1.0f) cursorBlinkTimer = 0.0f;
     
+    if ((IsKeyDown(KEY_LEFT_CONTROL) || IsKeyDown(KEY_RIGHT_CONTROL)) && IsKeyPressed(KEY_V)) {
+        insertText(GetClipboardText());
+    }
+    
     int key = GetCharPressed();
     while (key > 0) {
         if (key >= 32 && key <= 126) {
@@ -124,14 +177,14 @@ void TextBox::Update() {
     if (IsKeyPressed(KEY_LEFT) && cursorPos > 0) {
         cursorPos--;
     }
-    if (IsKeyPressed(KEY_RIGHT) && cursorPos < (int)rawText.length()) {
+    if (IsKeyPressed(KEY_RIGHT) && cursorPos < (int)cells.Size()) {
         cursorPos++;
     }
     if (IsKeyPressed(KEY_HOME)) {
         cursorPos = 0;
     }
     if (IsKeyPressed(KEY_END)) {
-        cursorPos = (int)rawText.length();
+        cursorPos = (int)cells.Size();
     }
     
     if (IsKeyPressed(KEY_UP)) {
@@ -148,10 +201,11 @@ void TextBox::Draw() {
     float x = bounds.x + 12;
     float y = bounds.y + bounds.height / 2;
     
-    if (rawText.empty()) {
+    if (cells.Empty()) {
         Vector2 textSize = MeasureTextEx(regularFont, placeholder.c_str(), fontSize, 0.0f);
         float textY = y - textSize.y / 2;
         DrawTextEx(regularFont, placeholder.c_str(), {x, textY}, fontSize, 0.0f, placeholderColor);
+        DebugCountTextDraw();
         
         if (focused && cursorBlinkTimer < 0.5f) {
             DrawLine((int)x, (int)(y - fontSize/2), 
@@ -160,26 +214,28 @@ void TextBox::Draw() {
     } else {
         float cursorX = x;
         
-        for (size_t i = 0; i < formatted.size(); i++) {
-            FormattedChar fc = formatted[i];
-            std::string charStr(1, fc.character);
+        int length = (int)cells.Size();
+        for (int i = 0; i < length; i++) {
+            FormattedChar fc = FormattedChar::Unpack(cells.At(i));
+            char charStr[2] = {fc.character, '\0'};
             
             Font activeFont = fc.subscript ? subscriptFont : regularFont;
             float activeFontSize = fc.subscript ? fontSize * 0.6f : fontSize;
             
-            Vector2 textSize = MeasureTextEx(activeFont, charStr.c_str(), activeFontSize, 0.0f);
+            Vector2 textSize = MeasureTextEx(activeFont, charStr, activeFontSize, 0.0f);
             float charY = fc.subscript ? y + (fontSize * 0.2f) : y - textSize.y / 2;
             
-            if ((int)i == cursorPos && focused && cursorBlinkTimer < 0.5f) {    
+            if (i == cursorPos && focused && cursorBlinkTimer < 0.5f) {    
                 DrawLine((int)cursorX, (int)(y - fontSize/2), 
                         (int)cursorX, (int)(y + fontSize/2), textColor);
             }
             
-            DrawTextEx(activeFont, charStr.c_str(), {cursorX, charY}, activeFontSize, 0.0f, textColor);
+            DrawTextEx(activeFont, charStr, {cursorX, charY}, activeFontSize, 0.0f, textColor);
+            DebugCountTextDraw();
             cursorX += textSize.x;
         }       
 
-        if ((int)cursorPos == (int)formatted.size() && focused && cursorBlinkTimer < 0.5f) {
+        if (cursorPos == length && focused && cursorBlinkTimer < 0.5f) {
             DrawLine((int)cursorX, (int)(y - fontSize/2), 
                     (int)cursorX, (int)(y + fontSize/2), textColor);
         }
@@ -191,14 +247,76 @@ bool TextBox::Contains(Vector2 point) const {
            point.y >= bounds.y && point.y <= bounds.y + bounds.height;
 }
 
+const std::string& TextBox::GetText() const {
+    int length = (int)cells.Size();
+    int from = std::min(textDirtyFrom, textCacheChars);
+    
+    textCache.resize(from);
+    for (int i = from; i < length; i++) {
+        textCache += charAt(i);
+    }
+    textCacheChars = length;
+    textDirtyFrom = length;
+    return textCache;
+}
+
+std::vector<FormattedChar> TextBox::GetFormatted() const {
+    std::vector<FormattedChar> result;
+    result.reserve(cells.Size());
+    for (size_t i = 0; i < cells.Size(); i++) {
+        result.push_back(FormattedChar::Unpack(cells.At(i)));
+    }
+    return result;
+}
+
+// byte offset of character `index` in the cached UTF-8, walking from whichever end is closer
+static size_t utf8OffsetOf(const std::string& utf8, int charCount, int index) {
+    if (index <= charCount / 2) {
+        size_t offset = 0;
+        for (int i = 0; i < index; i++) {
+            offset += ((unsigned char)utf8[offset] == 0xE2) ? 3 : 1;
+        }
+        return offset;
+    }
+    
+    size_t offset = utf8.size();
+    for (int i = charCount; i > index; i--) {
+        // subscripts end in a continuation byte (0x80..0x89), plain characters are ASCII
+        offset -= ((unsigned char)utf8[offset - 1] >= 0x80) ? 3 : 1;
+    }
+    return offset;
+}
+
+const std::string& TextBox::GetFormattedText() const {
+    int length = (int)cells.Size();
+    int from = std::min(utf8DirtyFrom, utf8CacheChars);
+    
+    utf8Cache.resize(utf8OffsetOf(utf8Cache, utf8CacheChars, from));
+    for (int i = from; i < length; i++) {
+        FormattedChar fc = FormattedChar::Unpack(cells.At(i));
+        if (fc.subscript && std::isdigit(fc.character)) {
+            // convert to UTF-8 subscript
+            utf8Cache += (char)(0xE2);
+            utf8Cache += (char)(0x82);
+            utf8Cache += (char)(0x80 + (fc.character - '0'));
+        } else {
+            utf8Cache += fc.character;
+        }
+    }
+    utf8CacheChars = length;
+    utf8DirtyFrom = length;
+    return utf8Cache;
+}
+
 void TextBox::SetText(const std::string& text) {
-    rawText = text;
-    cursorPos = rawText.length();
-    updateFormatting();
+    cells.Clear();
+    markDirty(0);
+    cursorPos = 0;
+    insertText(text.c_str());
 }
 
 void TextBox::Clear() {
-    rawText.clear();
-    formatted.clear();
+    cells.Clear();
+    markDirty(0);
     cursorPos = 0;
 }
\ No newline at end of file
@@ -4,6 +4,7 @@
 #include <vector>
 #include "raylib.h"
 #include "text_align.h"
+#include "gap_buffer.h"
 
 struct FormattedChar {
     char character;
@@ -11,12 +12,42 @@ struct FormattedChar {
     
     FormattedChar(char c = ' ', bool sub = false) 
         : character(c), subscript(sub) {}
+
+    // editor cells pack the ASCII character in the low 7 bits and the subscript flag in the high bit
+    static const unsigned char SUBSCRIPT_BIT = 0x80;
+
+    unsigned char Pack() const { return (unsigned char)((character & 0x7F) | (subscript ? SUBSCRIPT_BIT : 0)); }
+    static FormattedChar Unpack(unsigned char cell) {
+        return FormattedChar((char)(cell & 0x7F), (cell & SUBSCRIPT_BIT) != 0);
+    }
+};
+
+// read-only view over the editor contents, indexes straight into the gap buffer
+class FormattedView {
+private:
+    const GapBuffer* cells;
+
+public:
+    explicit FormattedView(const GapBuffer& buffer) : cells(&buffer) {}
+
+    size_t size() const { return cells->Size(); }
+    bool empty() const { return cells->Empty(); }
+    FormattedChar operator[](size_t index) const { return FormattedChar::Unpack(cells->At(index)); }
 };
 
 class TextBox {
 private:
-    std::string rawText;                 
-    std::vector<FormattedChar> formatted; 
+    GapBuffer cells; // packed FormattedChar per character
+    std::vector<unsigned char> pasteCells; // staging for bulk inserts, reused between pastes
+    
+    // encodings are refreshed lazily from the first edited index onwards
+    mutable std::string textCache;
+    mutable std::string utf8Cache;
+    mutable int textCacheChars;
+    mutable int utf8CacheChars;
+    mutable int textDirtyFrom;
+    mutable int utf8DirtyFrom;
+    unsigned int revision;
     Rectangle bounds;
     bool focused;
     int cursorPos;
@@ -34,11 +65,15 @@ private:
     
     bool autoSubscript; 
     
-    void updateFormatting();
+    void updateFormatting(int start, int end);
     void insertChar(char c);
+    void insertText(const char* text);
     void deleteChar();
     void backspace();    
     void toggleSubscript(bool makeSubscript);
+    char charAt(int index) const { return (char)(cells.At(index) & 0x7F); }
+    void setSubscript(int index, bool subscript);
+    void markDirty(int index);
     
 public:
     TextBox(Rectangle rect, Font regular, Font subscript, float size, bool autoSub = true);
@@ -46,28 +81,20 @@ public:
     void Update();
     void Draw();
     
-    std::string GetText() const { return rawText; }
-    std::vector<FormattedChar> GetFormatted() const { return formatted; }
-    std::string GetFormattedText() const {
-        std::string result;
-        for (const auto& fc : formatted) {
-            if (fc.subscript && std::isdigit(fc.character)) {
-                // convert to UTF-8 subscript
-                result += (char)(0xE2);
-                result += (char)(0x82);
-                result += (char)(0x80 + (fc.character - '0'));
-            } else {
-                result += fc.character;
-            }
-        }
-        return result;
-    }
+    // references stay valid until the next edit
+    const std::string& GetText() const;
+    const std::string& GetFormattedText() const; // UTF-8, subscript digits as U+2080..U+2089
+    FormattedView GetFormattedView() const { return FormattedView(cells); }
+    std::vector<FormattedChar> GetFormatted() const;
+    unsigned int GetRevision() const { return revision; } // bumps on every edit
     
     bool IsFocused() const { return focused; }
     
     void SetText(const std::string& text);
+    void Paste(const char* text) { insertText(text); }
     void SetPlaceholder(const std::string& text) { placeholder = text; }
     void SetColors(Color text, Color placeholderCol);
+    void SetBackgroundColor(Color background) { bgColor = background; }
     void SetFocus(bool focus) { focused = focus; }
     void Clear();
     void ToggleSubscript(bool makeSubscript) { toggleSubscript(makeSubscript); }
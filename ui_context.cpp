@@ -93,36 +93,30 @@ void UIContext::ProcessElementClicks() {
     
     if (!mousePressed) return;
     
-
-    std::vector<int> sortedIndices; // sort by z-index
+    // topmost element wins, earliest registered on ties
     for (int i = 0; i < (int)elements.size(); i++) {
-        sortedIndices.push_back(i);
-    }
-    
-    std::sort(sortedIndices.begin(), sortedIndices.end(), 
-        [this](int a, int b) { return elements[a].zIndex > elements[b].zIndex; });
-    
-    for (int idx : sortedIndices) {
-        const UIElement& elem = elements[idx];
+        const UIElement& elem = elements[i];
         if (elem.enabled && CheckElementHover(elem)) {
-            hoveredElement = idx;
-            if (elem.onClick) {
-                elem.onClick();
+            if (hoveredElement < 0 || elem.zIndex > elements[hoveredElement].zIndex) {
+                hoveredElement = i;
             }
-            break; // topmost element
         }
     }
+    
+    if (hoveredElement >= 0 && elements[hoveredElement].onClick) {
+        elements[hoveredElement].onClick();
+    }
 }
 
 bool UIContext::CheckElementHover(const UIElement& element) const {
     return CheckCollisionPointRec(mousePos, element.bounds);
 }
 
-int UIContext::AddElement(float x, float y, float w, float h, std::function<void()> callback, int zIndex) {
+int UIContext::AddElement(float x, float y, float w, float h, const UICallback& callback, int zIndex) {
     return AddElement({x, y, w, h}, callback, zIndex);
 }
 
-int UIContext::AddElement(Rectangle bounds, std::function<void()> callback, int zIndex) {
+int UIContext::AddElement(Rectangle bounds, const UICallback& callback, int zIndex) {
     UIElement elem;
     elem.bounds = Rect(bounds);
     elem.onClick = callback;
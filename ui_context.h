@@ -1,11 +1,13 @@
 #pragma once
 
 #include "raylib.h"
-#include <functional>
 #include <vector>
+#include "inline_delegate.h"
 
 struct UIElement;
 
+typedef InlineDelegate<6 * sizeof(void*)> UICallback; // room for a handful of captured references
+
 class UIContext {
 private:
     float nativeWidth;
@@ -31,7 +33,7 @@ private:
 
     struct UIElement {
         Rectangle bounds;  
-        std::function<void()> onClick;
+        UICallback onClick;
         bool enabled;
         int zIndex;  
     };
@@ -59,11 +61,12 @@ public:
     }
     
     // register a clickable element with native coordinates
-    int AddElement(float x, float y, float w, float h, std::function<void()> callback, int zIndex = 0);
-    int AddElement(Rectangle bounds, std::function<void()> callback, int zIndex = 0);
+    int AddElement(float x, float y, float w, float h, const UICallback& callback, int zIndex = 0);
+    int AddElement(Rectangle bounds, const UICallback& callback, int zIndex = 0);
 
     void RemoveElement(int elementId);
     void ClearElements();
+    int GetElementCount() const { return (int)elements.size(); }
     
     // enable/disable element
     void SetElementEnabled(int elementId, bool enabled);
@@ -0,0 +1,129 @@
+#include "weight_table.h"
+#include "element_data.h"
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <mutex>
+
+static const char WEIGHT_FILE_MAGIC[4] = {'M', 'M', 'W', 'T'};
+static const uint32_t WEIGHT_FILE_VERSION = 1;
+static const size_t WEIGHT_RECORD_SIZE = 12;
+
+namespace {
+    const WeightTable& builtinWeights() {
+        static const WeightTable table = []() {
+            WeightTable builtin;
+            builtin.name = "Built-in";
+            for (const Element& e : GetPeriodicTable()) {
+                if (e.atomicNumber >= (int)builtin.weights.size()) {
+                    builtin.weights.resize(e.atomicNumber + 1, 0.0);
+                }
+                builtin.weights[e.atomicNumber] = e.molarMass;
+            }
+            return builtin;
+        }();
+        return table;
+    }
+
+    std::atomic<const WeightTable*> activeTable(nullptr); // nullptr means built-in
+
+    // owns every loaded table, only touched by loaders
+    std::mutex loadedMutex;
+    std::vector<std::unique_ptr<WeightTable>> loadedTables;
+
+    uint32_t readU32(const unsigned char* p) {
+        return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+    }
+
+    double readF64(const unsigned char* p) {
+        uint64_t bits = 0;
+        for (int i = 7; i >= 0; i--) {
+            bits = (bits << 8) | p[i];
+        }
+        double value;
+        memcpy(&value, &bits, sizeof(value));
+        return value;
+    }
+}
+
+double WeightTable::Get(int atomicNumber) const {
+    if (atomicNumber > 0 && atomicNumber < (int)weights.size() && weights[atomicNumber] > 0.0) {
+        return weights[atomicNumber];
+    }
+    const Element* element = FindElementByAtomicNumber(atomicNumber);
+    return element ? element->molarMass : 0.0;
+}
+
+const WeightTable& GetActiveWeights() {
+    const WeightTable* table = activeTable.load(std::memory_order_acquire);
+    return table ? *table : builtinWeights();
+}
+
+double GetAtomicWeight(int atomicNumber) {
+    return GetActiveWeights().Get(atomicNumber);
+}
+
+bool LoadWeightTableMemory(const unsigned char* data, size_t size) {
+    if (size < 16 || memcmp(data, WEIGHT_FILE_MAGIC, 4) != 0) {
+        printf("Warning: Not an atomic weight file\n");
+        return false;
+    }
+
+    uint32_t version = readU32(data + 4);
+    uint32_t count = readU32(data + 8);
+    uint32_t nameLength = readU32(data + 12);
+    if (version != WEIGHT_FILE_VERSION) {
+        printf("Warning: Unsupported atomic weight file version %u\n", version);
+        return false;
+    }
+    if (nameLength > size - 16 || count > (size - 16 - nameLength) / WEIGHT_RECORD_SIZE) {
+        printf("Warning: Atomic weight file is truncated\n");
+        return false;
+    }
+
+    std::unique_ptr<WeightTable> table(new WeightTable());
+    table->name.assign((const char*)data + 16, nameLength);
+    table->weights.assign(builtinWeights().weights.size(), 0.0);
+
+    const unsigned char* record = data + 16 + nameLength;
+    for (uint32_t i = 0; i < count; i++, record += WEIGHT_RECORD_SIZE) {
+        uint32_t atomicNumber = readU32(record);
+        double weight = readF64(record + 4);
+        if (atomicNumber == 0 || atomicNumber >= table->weights.size() || !(weight > 0.0)) {
+            printf("Warning: Skipping invalid atomic weight record %u\n", i);
+            continue;
+        }
+        table->weights[atomicNumber] = weight;
+    }
+
+    // publish only after the table is complete
+    std::lock_guard<std::mutex> lock(loadedMutex);
+    loadedTables.push_back(std::move(table));
+    activeTable.store(loadedTables.back().get(), std::memory_order_release);
+    return true;
+}
+
+bool LoadWeightTableFile(const char* path) {
+    // dataset files are a couple of KB, a single read is cheaper than setting up a mapping
+    FILE* file = fopen(path, "rb");
+    if (!file) {
+        printf("Warning: Could not open atomic weight file %s\n", path);
+        return false;
+    }
+
+    std::vector<unsigned char> data;
+    unsigned char chunk[4096];
+    size_t read;
+    while ((read = fread(chunk, 1, sizeof(chunk), file)) > 0) {
+        data.insert(data.end(), chunk, chunk + read);
+    }
+    fclose(file);
+
+    return LoadWeightTableMemory(data.data(), data.size());
+}
+
+void UseBuiltinWeights() {
+    activeTable.store(nullptr, std::memory_order_release);
+}
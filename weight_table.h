@@ -0,0 +1,26 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+// one atomic-weight dataset (IUPAC abridged, conventional, lab values, ...)
+// elements the dataset leaves out fall back to the built-in periodic table
+struct WeightTable {
+    std::string name;
+    std::vector<double> weights; // by atomic number, 0 where the dataset has no value
+
+    double Get(int atomicNumber) const;
+};
+
+// the active table is swapped with a single atomic pointer store, readers never block;
+// replaced tables stay alive for the rest of the run so a reader can keep using its snapshot
+const WeightTable& GetActiveWeights();
+double GetAtomicWeight(int atomicNumber); // from the active table
+
+// binary dataset file, little-endian:
+//   char magic[4] = "MMWT", uint32 version = 1, uint32 count, uint32 nameLength, char name[nameLength],
+//   count records of { uint32 atomicNumber, float64 weight }
+// see resources/weights_to_bin.py; returns false and keeps the current table on any error
+bool LoadWeightTableFile(const char* path);
+bool LoadWeightTableMemory(const unsigned char* data, size_t size);
+void UseBuiltinWeights();